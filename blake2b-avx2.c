@@ -0,0 +1,229 @@
+#include "blake2s.h"
+#include "blake2b.h"
+#include "blake2b-internal.h"
+#include <immintrin.h>
+
+/* x86 AVX2 BLAKE2b kernel: the row layout of blake2s-sse.c, with a
+ * row of four 64-bit words per 256-bit register. Rotations by 32, 24
+ * and 16 are shuffles, and by 63 an add and a shift. */
+
+static const u64 blake2b_viv[2][4] ALIGN(32) = {
+    { 0x6a09e667f3bcc908ULL, 0xbb67ae8584caa73bULL,
+      0x3c6ef372fe94f82bULL, 0xa54ff53a5f1d36f1ULL },
+    { 0x510e527fade682d1ULL, 0x9b05688c2b3e6c1fULL,
+      0x1f83d9abfb41bd6bULL, 0x5be0cd19137e2179ULL },
+};
+
+/* pshufb masks rotating every 64-bit word right by 24 and 16 bits */
+static const u8 blake2b_vr24[32] ALIGN(32) = {
+     3,  4,  5,  6,  7,  0,  1,  2, 11, 12, 13, 14, 15,  8,  9, 10,
+     3,  4,  5,  6,  7,  0,  1,  2, 11, 12, 13, 14, 15,  8,  9, 10,
+};
+static const u8 blake2b_vr16[32] ALIGN(32) = {
+     2,  3,  4,  5,  6,  7,  0,  1, 10, 11, 12, 13, 14, 15,  8,  9,
+     2,  3,  4,  5,  6,  7,  0,  1, 10, 11, 12, 13, 14, 15,  8,  9,
+};
+
+static inline void blake2b_12rounds(__m256i va, __m256i vb, __m256i vc,
+                                    __m256i vd, __m256i H[2], const void *msg)
+{
+    const __m256i vr24 = _mm256_load_si256((const __m256i *)blake2b_vr24);
+    const __m256i vr16 = _mm256_load_si256((const __m256i *)blake2b_vr16);
+    u64 m[16];
+    __m256i m1, m2, m3, m4;
+    memcpy(m, msg, sizeof(m)); /* x86 is little endian */
+
+#define ror32(x) _mm256_shuffle_epi32(x, _MM_SHUFFLE(2,3,0,1))
+#define ror24(x) _mm256_shuffle_epi8(x, vr24)
+#define ror16(x) _mm256_shuffle_epi8(x, vr16)
+#define ror63(x) _mm256_xor_si256(_mm256_srli_epi64(x, 63), _mm256_add_epi64(x, x))
+#define add(x,y) _mm256_add_epi64(x, y)
+#define xor(x,y) _mm256_xor_si256(x, y)
+
+#define BLAKE2B_VG(M,N,a,b,c,d) \
+    do { \
+        (a) = add(add(a, b), M);     \
+        (d) = ror32(xor(d, a));      \
+        (c) = add(c, d);             \
+        (b) = ror24(xor(b, c));      \
+        (a) = add(add(a, b), N);     \
+        (d) = ror16(xor(d, a));      \
+        (c) = add(c, d);             \
+        (b) = ror63(xor(b, c));      \
+    } while (0)
+
+#define Si(i,j) B2B_SIGMA(i)[(j)]
+#define MSG(r,a,b,c,d) \
+    _mm256_set_epi64x(m[Si(r,d)], m[Si(r,c)], m[Si(r,b)], m[Si(r,a)])
+
+#define FULLROUND(r) \
+    do { \
+        m1 = MSG(r,  0,  2,  4,  6); \
+        m2 = MSG(r,  1,  3,  5,  7); \
+        m3 = MSG(r,  8, 10, 12, 14); \
+        m4 = MSG(r,  9, 11, 13, 15); \
+        \
+        /* First half:  apply G() on rows */ \
+        BLAKE2B_VG(m1,m2,va,vb,vc,vd); \
+        \
+        /* Second half: apply G() on diagonals */ \
+        vb = _mm256_permute4x64_epi64(vb, _MM_SHUFFLE(0,3,2,1)); \
+        vc = _mm256_permute4x64_epi64(vc, _MM_SHUFFLE(1,0,3,2)); \
+        vd = _mm256_permute4x64_epi64(vd, _MM_SHUFFLE(2,1,0,3)); \
+        BLAKE2B_VG(m3,m4,va,vb,vc,vd); \
+        vb = _mm256_permute4x64_epi64(vb, _MM_SHUFFLE(2,1,0,3)); \
+        vc = _mm256_permute4x64_epi64(vc, _MM_SHUFFLE(1,0,3,2)); \
+        vd = _mm256_permute4x64_epi64(vd, _MM_SHUFFLE(0,3,2,1)); \
+    } while (0)
+
+    /* 12 rounds times 2 applications of G */
+    FULLROUND(0);
+    FULLROUND(1);
+    FULLROUND(2);
+    FULLROUND(3);
+    FULLROUND(4);
+    FULLROUND(5);
+    FULLROUND(6);
+    FULLROUND(7);
+    FULLROUND(8);
+    FULLROUND(9);
+    FULLROUND(10);
+    FULLROUND(11);
+
+    H[0] = xor(H[0], xor(va, vc));
+    H[1] = xor(H[1], xor(vb, vd));
+}
+
+void blake2b_compress_avx2(struct blake2b_ctx *ctx, const void *m)
+{
+    __m256i H[2];
+    __m256i vpr;
+    H[0] = _mm256_load_si256((const __m256i *)ctx->H + 0);
+    H[1] = _mm256_load_si256((const __m256i *)ctx->H + 1);
+    vpr  = _mm256_loadu_si256((const __m256i *)ctx->t); /* t[0], t[1], f[0], f[1] */
+
+    blake2b_12rounds(H[0], H[1],
+                     _mm256_load_si256((const __m256i *)blake2b_viv[0]),
+                     xor(_mm256_load_si256((const __m256i *)blake2b_viv[1]), vpr),
+                     H, m);
+
+    _mm256_store_si256((__m256i *)ctx->H + 0, H[0]);
+    _mm256_store_si256((__m256i *)ctx->H + 1, H[1]);
+}
+
+void blake2b_compress_blocks_avx2(struct blake2b_ctx *ctx, const void *m,
+                                  size_t nblocks)
+{
+    const unsigned char *p = m;
+    __m256i H[2];
+    u64 t0 = ctx->t[0], t1 = ctx->t[1];
+    H[0] = _mm256_load_si256((const __m256i *)ctx->H + 0);
+    H[1] = _mm256_load_si256((const __m256i *)ctx->H + 1);
+
+    for (; nblocks; nblocks--, p += BLAKE2B_BLOCK) {
+        __m256i vpr;
+        t0 += BLAKE2B_BLOCK;
+        t1 += (t0 < BLAKE2B_BLOCK);
+        vpr = _mm256_set_epi64x(ctx->f[1], ctx->f[0], t1, t0);
+        blake2b_12rounds(H[0], H[1],
+                         _mm256_load_si256((const __m256i *)blake2b_viv[0]),
+                         xor(_mm256_load_si256((const __m256i *)blake2b_viv[1]), vpr),
+                         H, p);
+    }
+
+    _mm256_store_si256((__m256i *)ctx->H + 0, H[0]);
+    _mm256_store_si256((__m256i *)ctx->H + 1, H[1]);
+    ctx->t[0] = t0;
+    ctx->t[1] = t1;
+}
+
+/* Multi-buffer kernel: 4 independent messages, one per 64-bit lane,
+ * laid out as in blake2s-avx2.c */
+static const u64 blake2b_zero_block[16];
+
+/* Transpose the 4x4 matrix of words in r[0..3] (row = lane) into
+ * w[0..3] (row = word) */
+static inline void blake2b_transpose4(__m256i w[4], const __m256i r[4])
+{
+    __m256i t0 = _mm256_unpacklo_epi64(r[0], r[1]);
+    __m256i t1 = _mm256_unpackhi_epi64(r[0], r[1]);
+    __m256i t2 = _mm256_unpacklo_epi64(r[2], r[3]);
+    __m256i t3 = _mm256_unpackhi_epi64(r[2], r[3]);
+    w[0] = _mm256_permute2x128_si256(t0, t2, 0x20);
+    w[1] = _mm256_permute2x128_si256(t1, t3, 0x20);
+    w[2] = _mm256_permute2x128_si256(t0, t2, 0x31);
+    w[3] = _mm256_permute2x128_si256(t1, t3, 0x31);
+}
+
+void blake2b_compress_lanes_avx2(struct blake2b_lanes *L, const void *m[],
+                                 unsigned mask)
+{
+    const __m256i vr24 = _mm256_load_si256((const __m256i *)blake2b_vr24);
+    const __m256i vr16 = _mm256_load_si256((const __m256i *)blake2b_vr16);
+    const __m256i lbit = _mm256_setr_epi64x(1, 2, 4, 8);
+    __m256i r[4][4];
+    __m256i w[16];
+    __m256i v[16];
+    __m256i keep;
+
+    /* Message schedule: lane l's block is row l, transpose to columns */
+    for (unsigned l = 0; l < 4; l++) {
+        const __m256i *p = (mask & (1u << l)) ? m[l] : blake2b_zero_block;
+        for (unsigned q = 0; q < 4; q++)
+            r[q][l] = _mm256_loadu_si256(p + q);
+    }
+    for (unsigned q = 0; q < 4; q++)
+        blake2b_transpose4(w + 4*q, r[q]);
+
+    for (unsigned i = 0; i < 8; i++)
+        v[i] = _mm256_load_si256((const __m256i *)L->H[i]);
+    for (unsigned i = 0; i < 4; i++)
+        v[i+8] = _mm256_set1_epi64x(blake2b_iv[i]);
+    v[12] = xor(_mm256_set1_epi64x(blake2b_iv[4]),
+                _mm256_load_si256((const __m256i *)L->t[0]));
+    v[13] = xor(_mm256_set1_epi64x(blake2b_iv[5]),
+                _mm256_load_si256((const __m256i *)L->t[1]));
+    v[14] = xor(_mm256_set1_epi64x(blake2b_iv[6]),
+                _mm256_load_si256((const __m256i *)L->f[0]));
+    v[15] = xor(_mm256_set1_epi64x(blake2b_iv[7]),
+                _mm256_load_si256((const __m256i *)L->f[1]));
+
+#undef FULLROUND
+    /* Lane rounds: G() on whole registers, one 64-bit word of each of
+     * the 4 messages, with w[] picked by sigma as in blake2s-avx2.c */
+#define FULLROUND(r) \
+    do { \
+        BLAKE2B_VG(w[Si(r, 0)], w[Si(r, 1)], v[ 0], v[ 4], v[ 8], v[12]); \
+        BLAKE2B_VG(w[Si(r, 2)], w[Si(r, 3)], v[ 1], v[ 5], v[ 9], v[13]); \
+        BLAKE2B_VG(w[Si(r, 4)], w[Si(r, 5)], v[ 2], v[ 6], v[10], v[14]); \
+        BLAKE2B_VG(w[Si(r, 6)], w[Si(r, 7)], v[ 3], v[ 7], v[11], v[15]); \
+        \
+        BLAKE2B_VG(w[Si(r, 8)], w[Si(r, 9)], v[ 0], v[ 5], v[10], v[15]); \
+        BLAKE2B_VG(w[Si(r,10)], w[Si(r,11)], v[ 1], v[ 6], v[11], v[12]); \
+        BLAKE2B_VG(w[Si(r,12)], w[Si(r,13)], v[ 2], v[ 7], v[ 8], v[13]); \
+        BLAKE2B_VG(w[Si(r,14)], w[Si(r,15)], v[ 3], v[ 4], v[ 9], v[14]); \
+    } while (0)
+
+    /* 12 rounds times 8 applications of G */
+    FULLROUND(0);
+    FULLROUND(1);
+    FULLROUND(2);
+    FULLROUND(3);
+    FULLROUND(4);
+    FULLROUND(5);
+    FULLROUND(6);
+    FULLROUND(7);
+    FULLROUND(8);
+    FULLROUND(9);
+    FULLROUND(10);
+    FULLROUND(11);
+
+    /* Only lanes in `mask` take the new chaining value */
+    keep = _mm256_set1_epi64x(mask);
+    keep = _mm256_cmpeq_epi64(_mm256_and_si256(keep, lbit), lbit);
+    for (unsigned i = 0; i < 8; i++) {
+        __m256i h = _mm256_load_si256((const __m256i *)L->H[i]);
+        __m256i n = xor(h, xor(v[i], v[i+8]));
+        _mm256_store_si256((__m256i *)L->H[i], _mm256_blendv_epi8(h, n, keep));
+    }
+}
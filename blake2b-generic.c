@@ -0,0 +1,99 @@
+#include "blake2s.h"
+#include "blake2b.h"
+#include "blake2b-internal.h"
+
+static inline u64 ror64(unsigned l, u64 x) { return (x >> l) | (x << (64-l)); }
+
+static inline void blake2b_12rounds(u64 v[16], const u64 m[16])
+{
+#define BLAKE2B_G(M,N,a,b,c,d) \
+    do { \
+        (a) += (b) + (M);             \
+        (d) = ror64(32, (d) ^ (a));   \
+        (c) += (d);                   \
+        (b) = ror64(24, (b) ^ (c));   \
+        (a) += (b) + (N);             \
+        (d) = ror64(16, (d) ^ (a));   \
+        (c) += (d);                   \
+        (b) = ror64(63, (b) ^ (c));   \
+    } while (0)
+
+#define Si(i,j) B2B_SIGMA(i)[(j)]
+
+    /* Spelled out as in blake2s-generic.c */
+#define FULLROUND(r) \
+    do { \
+        BLAKE2B_G(m[Si(r, 0)], m[Si(r, 1)], v[ 0], v[ 4], v[ 8], v[12]); \
+        BLAKE2B_G(m[Si(r, 2)], m[Si(r, 3)], v[ 1], v[ 5], v[ 9], v[13]); \
+        BLAKE2B_G(m[Si(r, 4)], m[Si(r, 5)], v[ 2], v[ 6], v[10], v[14]); \
+        BLAKE2B_G(m[Si(r, 6)], m[Si(r, 7)], v[ 3], v[ 7], v[11], v[15]); \
+        \
+        BLAKE2B_G(m[Si(r, 8)], m[Si(r, 9)], v[ 0], v[ 5], v[10], v[15]); \
+        BLAKE2B_G(m[Si(r,10)], m[Si(r,11)], v[ 1], v[ 6], v[11], v[12]); \
+        BLAKE2B_G(m[Si(r,12)], m[Si(r,13)], v[ 2], v[ 7], v[ 8], v[13]); \
+        BLAKE2B_G(m[Si(r,14)], m[Si(r,15)], v[ 3], v[ 4], v[ 9], v[14]); \
+    } while (0)
+
+    /* 12 rounds times 8 applications of G */
+    FULLROUND(0);
+    FULLROUND(1);
+    FULLROUND(2);
+    FULLROUND(3);
+    FULLROUND(4);
+    FULLROUND(5);
+    FULLROUND(6);
+    FULLROUND(7);
+    FULLROUND(8);
+    FULLROUND(9);
+    FULLROUND(10);
+    FULLROUND(11);
+}
+
+static inline void blake2b_block(u64 H[8], const u64 t[2], const u64 f[2],
+                                 const void *msg)
+{
+    u64 v[16];
+    u64 m[16];
+    for (unsigned i = 0; i < 16; i++)
+        m[i] = read_le64((const unsigned char *)msg + i*8);
+    for (unsigned i = 0; i < 8; i++) {
+        v[i] = H[i];
+        v[i+8] = blake2b_iv[i];
+    }
+    v[12] ^= t[0];
+    v[13] ^= t[1];
+    v[14] ^= f[0];
+    v[15] ^= f[1];
+
+    blake2b_12rounds(v, m);
+
+    for (unsigned i = 0; i < 8; i++)
+        H[i] ^= v[i] ^ v[i+8];
+}
+
+void blake2b_compress_generic(struct blake2b_ctx *ctx, const void *msg)
+{
+    blake2b_block(ctx->H, ctx->t, ctx->f, msg);
+}
+
+void blake2b_compress_blocks_generic(struct blake2b_ctx *ctx, const void *msg,
+                                     size_t nblocks)
+{
+    const unsigned char *m = msg;
+    u64 H[8], t[2], f[2];
+    for (unsigned i = 0; i < 8; i++)
+        H[i] = ctx->H[i];
+    t[0] = ctx->t[0];
+    t[1] = ctx->t[1];
+    f[0] = ctx->f[0];
+    f[1] = ctx->f[1];
+    for (; nblocks; nblocks--, m += BLAKE2B_BLOCK) {
+        t[0] += BLAKE2B_BLOCK;
+        t[1] += (t[0] < BLAKE2B_BLOCK);
+        blake2b_block(H, t, f, m);
+    }
+    for (unsigned i = 0; i < 8; i++)
+        ctx->H[i] = H[i];
+    ctx->t[0] = t[0];
+    ctx->t[1] = t[1];
+}
@@ -0,0 +1,26196 @@
+	.file	"blake2b-generic.c"
+# GNU C99 (Debian 12.2.0-14+deb12u1) version 12.2.0 (x86_64-linux-gnu)
+#	compiled by GNU C version 12.2.0, GMP version 6.2.1, MPFR version 4.2.0, MPC version 1.3.1, isl version isl-0.25-GMP
+
+# GGC heuristics: --param ggc-min-expand=100 --param ggc-min-heapsize=131072
+# options passed: -mtune=generic -march=x86-64 -g -O3 -std=c99 -fasynchronous-unwind-tables
+	.text
+.Ltext0:
+	.file 0 "/root/repo" "blake2b-generic.c"
+	.p2align 4
+	.type	blake2b_12rounds, @function
+blake2b_12rounds:
+.LVL0:
+.LFB26:
+	.file 1 "blake2b-generic.c"
+	.loc 1 8 1 view -0
+	.cfi_startproc
+	.loc 1 38 5 view .LVU1
+	.loc 1 38 10 view .LVU2
+	.loc 1 38 15 view .LVU3
+# blake2b-generic.c:8: {
+	.loc 1 8 1 is_stmt 0 view .LVU4
+	pushq	%r15	#
+	.cfi_def_cfa_offset 16
+	.cfi_offset 15, -16
+	movq	%rdi, %rax	# tmp2416, v
+	movq	%rsi, %r9	# tmp2417, m
+	pushq	%r14	#
+	.cfi_def_cfa_offset 24
+	.cfi_offset 14, -24
+	pushq	%r13	#
+	.cfi_def_cfa_offset 32
+	.cfi_offset 13, -32
+	pushq	%r12	#
+	.cfi_def_cfa_offset 40
+	.cfi_offset 12, -40
+	pushq	%rbp	#
+	.cfi_def_cfa_offset 48
+	.cfi_offset 6, -48
+	pushq	%rbx	#
+	.cfi_def_cfa_offset 56
+	.cfi_offset 3, -56
+# blake2b-generic.c:38:     FULLROUND(0);
+	.loc 1 38 28 view .LVU5
+	movq	32(%rdi), %rdx	# MEM[(u64 *)v_1170(D) + 32B], _2
+# blake2b-generic.c:38:     FULLROUND(0);
+	.loc 1 38 23 view .LVU6
+	movq	(%rdi), %r8	# *v_1170(D), tmp1636
+	addq	%rdx, %r8	# _2, tmp1636
+	addq	(%rsi), %r8	# *m_1171(D), _5
+	movq	%r8, (%rdi)	# _5, *v_1170(D)
+	.loc 1 38 71 is_stmt 1 view .LVU7
+.LVL1:
+.LBB785:
+.LBI785:
+	.loc 1 5 19 view .LVU8
+.LBB786:
+	.loc 1 5 46 view .LVU9
+.LBE786:
+.LBE785:
+# blake2b-generic.c:38:     FULLROUND(0);
+	.loc 1 38 81 is_stmt 0 view .LVU10
+	movq	96(%rdi), %rdi	# MEM[(u64 *)v_1170(D) + 96B], tmp1639
+.LVL2:
+# blake2b-generic.c:38:     FULLROUND(0);
+	.loc 1 38 119 view .LVU11
+	movq	64(%rax), %r12	# MEM[(u64 *)v_1170(D) + 64B], _9
+# blake2b-generic.c:38:     FULLROUND(0);
+	.loc 1 38 358 view .LVU12
+	movq	40(%rax), %rbp	# MEM[(u64 *)v_1170(D) + 40B], _18
+# blake2b-generic.c:38:     FULLROUND(0);
+	.loc 1 38 81 view .LVU13
+	xorq	%r8, %rdi	# _5, tmp1639
+.LVL3:
+# blake2b-generic.c:38:     FULLROUND(0);
+	.loc 1 38 411 view .LVU14
+	movq	104(%rax), %rcx	# MEM[(u64 *)v_1170(D) + 104B], tmp1649
+# blake2b-generic.c:38:     FULLROUND(0);
+	.loc 1 38 449 view .LVU15
+	movq	72(%rax), %rbx	# MEM[(u64 *)v_1170(D) + 72B], _25
+.LBB788:
+.LBB787:
+# blake2b-generic.c:5: static inline u64 ror64(unsigned l, u64 x) { return (x >> l) | (x << (64-l)); }
+	.loc 1 5 62 view .LVU16
+	rolq	$32, %rdi	#, _1173
+.LVL4:
+	.loc 1 5 62 view .LVU17
+.LBE787:
+.LBE788:
+# blake2b-generic.c:38:     FULLROUND(0);
+	.loc 1 38 119 view .LVU18
+	addq	%rdi, %r12	# _1173, _9
+# blake2b-generic.c:38:     FULLROUND(0);
+	.loc 1 38 79 view .LVU19
+	movq	%rdi, 96(%rax)	# _1173, MEM[(u64 *)v_1170(D) + 96B]
+	.loc 1 38 111 is_stmt 1 view .LVU20
+# blake2b-generic.c:38:     FULLROUND(0);
+	.loc 1 38 141 is_stmt 0 view .LVU21
+	xorq	%r12, %rdx	# _9, tmp1641
+# blake2b-generic.c:38:     FULLROUND(0);
+	.loc 1 38 119 view .LVU22
+	movq	%r12, 64(%rax)	# _9, MEM[(u64 *)v_1170(D) + 64B]
+	.loc 1 38 131 is_stmt 1 view .LVU23
+.LVL5:
+.LBB789:
+.LBI789:
+	.loc 1 5 19 view .LVU24
+.LBB790:
+	.loc 1 5 46 view .LVU25
+# blake2b-generic.c:5: static inline u64 ror64(unsigned l, u64 x) { return (x >> l) | (x << (64-l)); }
+	.loc 1 5 62 is_stmt 0 view .LVU26
+	rorq	$24, %rdx	#, _1176
+.LVL6:
+	.loc 1 5 62 view .LVU27
+.LBE790:
+.LBE789:
+# blake2b-generic.c:38:     FULLROUND(0);
+	.loc 1 38 139 view .LVU28
+	movq	%rdx, 32(%rax)	# _1176, MEM[(u64 *)v_1170(D) + 32B]
+	.loc 1 38 171 is_stmt 1 view .LVU29
+# blake2b-generic.c:38:     FULLROUND(0);
+	.loc 1 38 179 is_stmt 0 view .LVU30
+	addq	8(%rsi), %r8	# MEM[(const u64 *)m_1171(D) + 8B], tmp1642
+	addq	%rdx, %r8	# _1176, _13
+# blake2b-generic.c:38:     FULLROUND(0);
+	.loc 1 38 353 view .LVU31
+	movq	8(%rax), %rsi	# MEM[(u64 *)v_1170(D) + 8B], tmp1646
+.LVL7:
+# blake2b-generic.c:38:     FULLROUND(0);
+	.loc 1 38 237 view .LVU32
+	xorq	%r8, %rdi	# _13, tmp1644
+# blake2b-generic.c:38:     FULLROUND(0);
+	.loc 1 38 179 view .LVU33
+	movq	%r8, (%rax)	# _13, *v_1170(D)
+	.loc 1 38 227 is_stmt 1 view .LVU34
+.LVL8:
+.LBB791:
+.LBI791:
+	.loc 1 5 19 view .LVU35
+.LBB792:
+	.loc 1 5 46 view .LVU36
+# blake2b-generic.c:5: static inline u64 ror64(unsigned l, u64 x) { return (x >> l) | (x << (64-l)); }
+	.loc 1 5 62 is_stmt 0 view .LVU37
+	rorq	$16, %rdi	#, _1179
+.LVL9:
+	.loc 1 5 62 view .LVU38
+.LBE792:
+.LBE791:
+# blake2b-generic.c:38:     FULLROUND(0);
+	.loc 1 38 353 view .LVU39
+	addq	%rbp, %rsi	# _18, tmp1646
+# blake2b-generic.c:38:     FULLROUND(0);
+	.loc 1 38 275 view .LVU40
+	addq	%rdi, %r12	# _1179, _15
+# blake2b-generic.c:38:     FULLROUND(0);
+	.loc 1 38 235 view .LVU41
+	movq	%rdi, 96(%rax)	# _1179, MEM[(u64 *)v_1170(D) + 96B]
+	.loc 1 38 267 is_stmt 1 view .LVU42
+# blake2b-generic.c:38:     FULLROUND(0);
+	.loc 1 38 297 is_stmt 0 view .LVU43
+	xorq	%r12, %rdx	# _15, tmp1645
+# blake2b-generic.c:38:     FULLROUND(0);
+	.loc 1 38 275 view .LVU44
+	movq	%r12, 64(%rax)	# _15, MEM[(u64 *)v_1170(D) + 64B]
+	.loc 1 38 287 is_stmt 1 view .LVU45
+.LVL10:
+.LBB793:
+.LBI793:
+	.loc 1 5 19 view .LVU46
+.LBB794:
+	.loc 1 5 46 view .LVU47
+# blake2b-generic.c:5: static inline u64 ror64(unsigned l, u64 x) { return (x >> l) | (x << (64-l)); }
+	.loc 1 5 62 is_stmt 0 view .LVU48
+	rolq	%rdx	# tmp1645
+.LBE794:
+.LBE793:
+# blake2b-generic.c:38:     FULLROUND(0);
+	.loc 1 38 295 view .LVU49
+	movq	%rdx, 32(%rax)	# _1182, MEM[(u64 *)v_1170(D) + 32B]
+	.loc 1 38 13 is_stmt 1 view .LVU50
+	.loc 1 38 340 view .LVU51
+	.loc 1 38 345 view .LVU52
+# blake2b-generic.c:38:     FULLROUND(0);
+	.loc 1 38 353 is_stmt 0 view .LVU53
+	addq	16(%r9), %rsi	# MEM[(const u64 *)m_1171(D) + 16B], _21
+# blake2b-generic.c:38:     FULLROUND(0);
+	.loc 1 38 411 view .LVU54
+	xorq	%rsi, %rcx	# _21, tmp1649
+# blake2b-generic.c:38:     FULLROUND(0);
+	.loc 1 38 353 view .LVU55
+	movq	%rsi, 8(%rax)	# _21, MEM[(u64 *)v_1170(D) + 8B]
+	.loc 1 38 401 is_stmt 1 view .LVU56
+.LVL11:
+.LBB795:
+.LBI795:
+	.loc 1 5 19 view .LVU57
+.LBB796:
+	.loc 1 5 46 view .LVU58
+# blake2b-generic.c:5: static inline u64 ror64(unsigned l, u64 x) { return (x >> l) | (x << (64-l)); }
+	.loc 1 5 62 is_stmt 0 view .LVU59
+	rolq	$32, %rcx	#, _1185
+.LVL12:
+	.loc 1 5 62 view .LVU60
+.LBE796:
+.LBE795:
+# blake2b-generic.c:38:     FULLROUND(0);
+	.loc 1 38 295 view .LVU61
+	movq	%rdx, -56(%rsp)	# _1182, %sfp
+# blake2b-generic.c:38:     FULLROUND(0);
+	.loc 1 38 449 view .LVU62
+	addq	%rcx, %rbx	# _1185, _25
+# blake2b-generic.c:38:     FULLROUND(0);
+	.loc 1 38 409 view .LVU63
+	movq	%rcx, 104(%rax)	# _1185, MEM[(u64 *)v_1170(D) + 104B]
+	.loc 1 38 441 is_stmt 1 view .LVU64
+# blake2b-generic.c:38:     FULLROUND(0);
+	.loc 1 38 471 is_stmt 0 view .LVU65
+	xorq	%rbx, %rbp	# _25, tmp1651
+# blake2b-generic.c:38:     FULLROUND(0);
+	.loc 1 38 449 view .LVU66
+	movq	%rbx, 72(%rax)	# _25, MEM[(u64 *)v_1170(D) + 72B]
+	.loc 1 38 461 is_stmt 1 view .LVU67
+.LVL13:
+.LBB797:
+.LBI797:
+	.loc 1 5 19 view .LVU68
+.LBB798:
+	.loc 1 5 46 view .LVU69
+# blake2b-generic.c:5: static inline u64 ror64(unsigned l, u64 x) { return (x >> l) | (x << (64-l)); }
+	.loc 1 5 62 is_stmt 0 view .LVU70
+	rorq	$24, %rbp	#, _1188
+.LVL14:
+	.loc 1 5 62 view .LVU71
+.LBE798:
+.LBE797:
+# blake2b-generic.c:38:     FULLROUND(0);
+	.loc 1 38 469 view .LVU72
+	movq	%rbp, 40(%rax)	# _1188, MEM[(u64 *)v_1170(D) + 40B]
+	.loc 1 38 501 is_stmt 1 view .LVU73
+# blake2b-generic.c:38:     FULLROUND(0);
+	.loc 1 38 509 is_stmt 0 view .LVU74
+	addq	24(%r9), %rsi	# MEM[(const u64 *)m_1171(D) + 24B], tmp1652
+	addq	%rbp, %rsi	# _1188, _29
+# blake2b-generic.c:38:     FULLROUND(0);
+	.loc 1 38 567 view .LVU75
+	xorq	%rsi, %rcx	# _29, tmp1654
+# blake2b-generic.c:38:     FULLROUND(0);
+	.loc 1 38 509 view .LVU76
+	movq	%rsi, 8(%rax)	# _29, MEM[(u64 *)v_1170(D) + 8B]
+	.loc 1 38 557 is_stmt 1 view .LVU77
+.LVL15:
+.LBB799:
+.LBI799:
+	.loc 1 5 19 view .LVU78
+.LBB800:
+	.loc 1 5 46 view .LVU79
+# blake2b-generic.c:5: static inline u64 ror64(unsigned l, u64 x) { return (x >> l) | (x << (64-l)); }
+	.loc 1 5 62 is_stmt 0 view .LVU80
+	rorq	$16, %rcx	#, _1191
+.LVL16:
+	.loc 1 5 62 view .LVU81
+.LBE800:
+.LBE799:
+# blake2b-generic.c:38:     FULLROUND(0);
+	.loc 1 38 605 view .LVU82
+	leaq	(%rbx,%rcx), %rbx	#, _31
+# blake2b-generic.c:38:     FULLROUND(0);
+	.loc 1 38 565 view .LVU83
+	movq	%rcx, 104(%rax)	# _1191, MEM[(u64 *)v_1170(D) + 104B]
+	.loc 1 38 597 is_stmt 1 view .LVU84
+# blake2b-generic.c:38:     FULLROUND(0);
+	.loc 1 38 683 is_stmt 0 view .LVU85
+	movq	16(%rax), %r11	# MEM[(u64 *)v_1170(D) + 16B], tmp1656
+# blake2b-generic.c:38:     FULLROUND(0);
+	.loc 1 38 627 view .LVU86
+	xorq	%rbx, %rbp	# _31, tmp1655
+# blake2b-generic.c:38:     FULLROUND(0);
+	.loc 1 38 741 view .LVU87
+	movq	112(%rax), %r10	# MEM[(u64 *)v_1170(D) + 112B], tmp1659
+# blake2b-generic.c:38:     FULLROUND(0);
+	.loc 1 38 1013 view .LVU88
+	movq	24(%rax), %r14	# MEM[(u64 *)v_1170(D) + 24B], tmp1666
+# blake2b-generic.c:38:     FULLROUND(0);
+	.loc 1 38 605 view .LVU89
+	movq	%rbx, 72(%rax)	# _31, MEM[(u64 *)v_1170(D) + 72B]
+	.loc 1 38 617 is_stmt 1 view .LVU90
+.LVL17:
+.LBB801:
+.LBI801:
+	.loc 1 5 19 view .LVU91
+.LBB802:
+	.loc 1 5 46 view .LVU92
+# blake2b-generic.c:5: static inline u64 ror64(unsigned l, u64 x) { return (x >> l) | (x << (64-l)); }
+	.loc 1 5 62 is_stmt 0 view .LVU93
+	rolq	%rbp	# _1194
+.LVL18:
+	.loc 1 5 62 view .LVU94
+.LBE802:
+.LBE801:
+# blake2b-generic.c:38:     FULLROUND(0);
+	.loc 1 38 627 view .LVU95
+	movq	%rbx, -80(%rsp)	# _31, %sfp
+# blake2b-generic.c:38:     FULLROUND(0);
+	.loc 1 38 688 view .LVU96
+	movq	48(%rax), %rbx	# MEM[(u64 *)v_1170(D) + 48B], _34
+# blake2b-generic.c:38:     FULLROUND(0);
+	.loc 1 38 625 view .LVU97
+	movq	%rbp, 40(%rax)	# _1194, MEM[(u64 *)v_1170(D) + 40B]
+	.loc 1 38 343 is_stmt 1 view .LVU98
+	.loc 1 38 670 view .LVU99
+	.loc 1 38 675 view .LVU100
+# blake2b-generic.c:38:     FULLROUND(0);
+	.loc 1 38 683 is_stmt 0 view .LVU101
+	movq	32(%r9), %rdx	# MEM[(const u64 *)m_1171(D) + 32B], tmp1656
+	addq	%rbx, %r11	# _34, tmp1656
+# blake2b-generic.c:38:     FULLROUND(0);
+	.loc 1 38 1071 view .LVU102
+	movq	120(%rax), %r13	# MEM[(u64 *)v_1170(D) + 120B], tmp1669
+# blake2b-generic.c:38:     FULLROUND(0);
+	.loc 1 38 683 view .LVU103
+	addq	%r11, %rdx	# tmp1656, tmp1656
+# blake2b-generic.c:38:     FULLROUND(0);
+	.loc 1 38 779 view .LVU104
+	movq	80(%rax), %r11	# MEM[(u64 *)v_1170(D) + 80B], _41
+# blake2b-generic.c:38:     FULLROUND(0);
+	.loc 1 38 741 view .LVU105
+	xorq	%rdx, %r10	# _37, tmp1659
+# blake2b-generic.c:38:     FULLROUND(0);
+	.loc 1 38 683 view .LVU106
+	movq	%rdx, 16(%rax)	# _37, MEM[(u64 *)v_1170(D) + 16B]
+	.loc 1 38 731 is_stmt 1 view .LVU107
+.LVL19:
+.LBB803:
+.LBI803:
+	.loc 1 5 19 view .LVU108
+.LBB804:
+	.loc 1 5 46 view .LVU109
+# blake2b-generic.c:5: static inline u64 ror64(unsigned l, u64 x) { return (x >> l) | (x << (64-l)); }
+	.loc 1 5 62 is_stmt 0 view .LVU110
+	rolq	$32, %r10	#, _1197
+.LVL20:
+	.loc 1 5 62 view .LVU111
+.LBE804:
+.LBE803:
+# blake2b-generic.c:38:     FULLROUND(0);
+	.loc 1 38 779 view .LVU112
+	addq	%r10, %r11	# _1197, _41
+# blake2b-generic.c:38:     FULLROUND(0);
+	.loc 1 38 739 view .LVU113
+	movq	%r10, 112(%rax)	# _1197, MEM[(u64 *)v_1170(D) + 112B]
+	.loc 1 38 771 is_stmt 1 view .LVU114
+# blake2b-generic.c:38:     FULLROUND(0);
+	.loc 1 38 801 is_stmt 0 view .LVU115
+	xorq	%r11, %rbx	# _41, tmp1661
+# blake2b-generic.c:38:     FULLROUND(0);
+	.loc 1 38 779 view .LVU116
+	movq	%r11, 80(%rax)	# _41, MEM[(u64 *)v_1170(D) + 80B]
+	.loc 1 38 791 is_stmt 1 view .LVU117
+.LVL21:
+.LBB805:
+.LBI805:
+	.loc 1 5 19 view .LVU118
+.LBB806:
+	.loc 1 5 46 view .LVU119
+.LBE806:
+.LBE805:
+# blake2b-generic.c:38:     FULLROUND(0);
+	.loc 1 38 779 is_stmt 0 view .LVU120
+	movq	%r11, %r15	# _41, _41
+# blake2b-generic.c:38:     FULLROUND(0);
+	.loc 1 38 1018 view .LVU121
+	movq	56(%rax), %r11	# MEM[(u64 *)v_1170(D) + 56B], _50
+.LBB808:
+.LBB807:
+# blake2b-generic.c:5: static inline u64 ror64(unsigned l, u64 x) { return (x >> l) | (x << (64-l)); }
+	.loc 1 5 62 view .LVU122
+	rorq	$24, %rbx	#, _1200
+.LVL22:
+	.loc 1 5 62 view .LVU123
+.LBE807:
+.LBE808:
+# blake2b-generic.c:38:     FULLROUND(0);
+	.loc 1 38 799 view .LVU124
+	movq	%rbx, 48(%rax)	# _1200, MEM[(u64 *)v_1170(D) + 48B]
+	.loc 1 38 831 is_stmt 1 view .LVU125
+# blake2b-generic.c:38:     FULLROUND(0);
+	.loc 1 38 839 is_stmt 0 view .LVU126
+	addq	40(%r9), %rdx	# MEM[(const u64 *)m_1171(D) + 40B], tmp1662
+# blake2b-generic.c:38:     FULLROUND(0);
+	.loc 1 38 1013 view .LVU127
+	addq	%r11, %r14	# _50, tmp1666
+# blake2b-generic.c:38:     FULLROUND(0);
+	.loc 1 38 839 view .LVU128
+	addq	%rbx, %rdx	# _1200, _45
+# blake2b-generic.c:38:     FULLROUND(0);
+	.loc 1 38 897 view .LVU129
+	xorq	%rdx, %r10	# _45, tmp1664
+# blake2b-generic.c:38:     FULLROUND(0);
+	.loc 1 38 839 view .LVU130
+	movq	%rdx, 16(%rax)	# _45, MEM[(u64 *)v_1170(D) + 16B]
+	.loc 1 38 887 is_stmt 1 view .LVU131
+.LVL23:
+.LBB809:
+.LBI809:
+	.loc 1 5 19 view .LVU132
+.LBB810:
+	.loc 1 5 46 view .LVU133
+# blake2b-generic.c:5: static inline u64 ror64(unsigned l, u64 x) { return (x >> l) | (x << (64-l)); }
+	.loc 1 5 62 is_stmt 0 view .LVU134
+	rorq	$16, %r10	#, tmp1664
+.LBE810:
+.LBE809:
+# blake2b-generic.c:38:     FULLROUND(0);
+	.loc 1 38 935 view .LVU135
+	addq	%r10, %r15	# _1203, _47
+# blake2b-generic.c:38:     FULLROUND(0);
+	.loc 1 38 895 view .LVU136
+	movq	%r10, 112(%rax)	# _1203, MEM[(u64 *)v_1170(D) + 112B]
+	.loc 1 38 927 is_stmt 1 view .LVU137
+# blake2b-generic.c:38:     FULLROUND(0);
+	.loc 1 38 957 is_stmt 0 view .LVU138
+	xorq	%r15, %rbx	# _47, tmp1665
+# blake2b-generic.c:38:     FULLROUND(0);
+	.loc 1 38 935 view .LVU139
+	movq	%r15, 80(%rax)	# _47, MEM[(u64 *)v_1170(D) + 80B]
+	.loc 1 38 947 is_stmt 1 view .LVU140
+.LVL24:
+.LBB811:
+.LBI811:
+	.loc 1 5 19 view .LVU141
+.LBB812:
+	.loc 1 5 46 view .LVU142
+# blake2b-generic.c:5: static inline u64 ror64(unsigned l, u64 x) { return (x >> l) | (x << (64-l)); }
+	.loc 1 5 62 is_stmt 0 view .LVU143
+	rolq	%rbx	# _1206
+.LVL25:
+	.loc 1 5 62 view .LVU144
+.LBE812:
+.LBE811:
+# blake2b-generic.c:38:     FULLROUND(0);
+	.loc 1 38 935 view .LVU145
+	movq	%r10, -48(%rsp)	# _1203, %sfp
+# blake2b-generic.c:38:     FULLROUND(0);
+	.loc 1 38 955 view .LVU146
+	movq	%rbx, 48(%rax)	# _1206, MEM[(u64 *)v_1170(D) + 48B]
+	.loc 1 38 673 is_stmt 1 view .LVU147
+	.loc 1 38 1000 view .LVU148
+	.loc 1 38 1005 view .LVU149
+# blake2b-generic.c:38:     FULLROUND(0);
+	.loc 1 38 1013 is_stmt 0 view .LVU150
+	movq	48(%r9), %r10	# MEM[(const u64 *)m_1171(D) + 48B], tmp1666
+	addq	%r14, %r10	# tmp1666, tmp1666
+# blake2b-generic.c:38:     FULLROUND(0);
+	.loc 1 38 1109 view .LVU151
+	movq	88(%rax), %r14	# MEM[(u64 *)v_1170(D) + 88B], _57
+# blake2b-generic.c:38:     FULLROUND(0);
+	.loc 1 38 1071 view .LVU152
+	xorq	%r10, %r13	# _53, tmp1669
+# blake2b-generic.c:38:     FULLROUND(0);
+	.loc 1 38 1013 view .LVU153
+	movq	%r10, 24(%rax)	# _53, MEM[(u64 *)v_1170(D) + 24B]
+	.loc 1 38 1061 is_stmt 1 view .LVU154
+.LVL26:
+.LBB813:
+.LBI813:
+	.loc 1 5 19 view .LVU155
+.LBB814:
+	.loc 1 5 46 view .LVU156
+# blake2b-generic.c:5: static inline u64 ror64(unsigned l, u64 x) { return (x >> l) | (x << (64-l)); }
+	.loc 1 5 62 is_stmt 0 view .LVU157
+	rolq	$32, %r13	#, _1209
+.LVL27:
+	.loc 1 5 62 view .LVU158
+.LBE814:
+.LBE813:
+# blake2b-generic.c:38:     FULLROUND(0);
+	.loc 1 38 1109 view .LVU159
+	addq	%r13, %r14	# _1209, _57
+# blake2b-generic.c:38:     FULLROUND(0);
+	.loc 1 38 1069 view .LVU160
+	movq	%r13, 120(%rax)	# _1209, MEM[(u64 *)v_1170(D) + 120B]
+	.loc 1 38 1101 is_stmt 1 view .LVU161
+# blake2b-generic.c:38:     FULLROUND(0);
+	.loc 1 38 1131 is_stmt 0 view .LVU162
+	xorq	%r14, %r11	# _57, tmp1671
+# blake2b-generic.c:38:     FULLROUND(0);
+	.loc 1 38 1109 view .LVU163
+	movq	%r14, 88(%rax)	# _57, MEM[(u64 *)v_1170(D) + 88B]
+	.loc 1 38 1121 is_stmt 1 view .LVU164
+.LVL28:
+.LBB815:
+.LBI815:
+	.loc 1 5 19 view .LVU165
+.LBB816:
+	.loc 1 5 46 view .LVU166
+# blake2b-generic.c:5: static inline u64 ror64(unsigned l, u64 x) { return (x >> l) | (x << (64-l)); }
+	.loc 1 5 62 is_stmt 0 view .LVU167
+	rorq	$24, %r11	#, _1212
+.LVL29:
+	.loc 1 5 62 view .LVU168
+.LBE816:
+.LBE815:
+# blake2b-generic.c:38:     FULLROUND(0);
+	.loc 1 38 1129 view .LVU169
+	movq	%r11, 56(%rax)	# _1212, MEM[(u64 *)v_1170(D) + 56B]
+	.loc 1 38 1161 is_stmt 1 view .LVU170
+# blake2b-generic.c:38:     FULLROUND(0);
+	.loc 1 38 1169 is_stmt 0 view .LVU171
+	addq	56(%r9), %r10	# MEM[(const u64 *)m_1171(D) + 56B], tmp1672
+	addq	%r11, %r10	# _1212, _61
+# blake2b-generic.c:38:     FULLROUND(0);
+	.loc 1 38 1227 view .LVU172
+	xorq	%r10, %r13	# _61, tmp1674
+# blake2b-generic.c:38:     FULLROUND(0);
+	.loc 1 38 1169 view .LVU173
+	movq	%r10, 24(%rax)	# _61, MEM[(u64 *)v_1170(D) + 24B]
+	.loc 1 38 1217 is_stmt 1 view .LVU174
+.LVL30:
+.LBB817:
+.LBI817:
+	.loc 1 5 19 view .LVU175
+.LBB818:
+	.loc 1 5 46 view .LVU176
+# blake2b-generic.c:5: static inline u64 ror64(unsigned l, u64 x) { return (x >> l) | (x << (64-l)); }
+	.loc 1 5 62 is_stmt 0 view .LVU177
+	rorq	$16, %r13	#, _1215
+.LVL31:
+	.loc 1 5 62 view .LVU178
+.LBE818:
+.LBE817:
+# blake2b-generic.c:38:     FULLROUND(0);
+	.loc 1 38 1265 view .LVU179
+	addq	%r13, %r14	# _1215, _63
+# blake2b-generic.c:38:     FULLROUND(0);
+	.loc 1 38 1225 view .LVU180
+	movq	%r13, 120(%rax)	# _1215, MEM[(u64 *)v_1170(D) + 120B]
+	.loc 1 38 1257 is_stmt 1 view .LVU181
+# blake2b-generic.c:38:     FULLROUND(0);
+	.loc 1 38 1287 is_stmt 0 view .LVU182
+	xorq	%r14, %r11	# _63, tmp1675
+# blake2b-generic.c:38:     FULLROUND(0);
+	.loc 1 38 1265 view .LVU183
+	movq	%r14, 88(%rax)	# _63, MEM[(u64 *)v_1170(D) + 88B]
+	.loc 1 38 1277 is_stmt 1 view .LVU184
+.LVL32:
+.LBB819:
+.LBI819:
+	.loc 1 5 19 view .LVU185
+.LBB820:
+	.loc 1 5 46 view .LVU186
+# blake2b-generic.c:5: static inline u64 ror64(unsigned l, u64 x) { return (x >> l) | (x << (64-l)); }
+	.loc 1 5 62 is_stmt 0 view .LVU187
+	rolq	%r11	# _1218
+.LVL33:
+	.loc 1 5 62 view .LVU188
+.LBE820:
+.LBE819:
+# blake2b-generic.c:38:     FULLROUND(0);
+	.loc 1 38 1285 view .LVU189
+	movq	%r11, 56(%rax)	# _1218, MEM[(u64 *)v_1170(D) + 56B]
+	.loc 1 38 1003 is_stmt 1 view .LVU190
+	.loc 1 38 1330 view .LVU191
+	.loc 1 38 1335 view .LVU192
+# blake2b-generic.c:38:     FULLROUND(0);
+	.loc 1 38 1343 is_stmt 0 view .LVU193
+	addq	64(%r9), %r8	# MEM[(const u64 *)m_1171(D) + 64B], tmp1676
+	addq	%rbp, %r8	# _1194, _67
+# blake2b-generic.c:38:     FULLROUND(0);
+	.loc 1 38 1401 view .LVU194
+	xorq	%r8, %r13	# _67, tmp1678
+# blake2b-generic.c:38:     FULLROUND(0);
+	.loc 1 38 1343 view .LVU195
+	movq	%r8, (%rax)	# _67, *v_1170(D)
+	.loc 1 38 1391 is_stmt 1 view .LVU196
+.LVL34:
+.LBB821:
+.LBI821:
+	.loc 1 5 19 view .LVU197
+.LBB822:
+	.loc 1 5 46 view .LVU198
+# blake2b-generic.c:5: static inline u64 ror64(unsigned l, u64 x) { return (x >> l) | (x << (64-l)); }
+	.loc 1 5 62 is_stmt 0 view .LVU199
+	rolq	$32, %r13	#, _1221
+.LVL35:
+	.loc 1 5 62 view .LVU200
+.LBE822:
+.LBE821:
+# blake2b-generic.c:38:     FULLROUND(0);
+	.loc 1 38 1439 view .LVU201
+	addq	%r13, %r15	# _1221, _69
+# blake2b-generic.c:38:     FULLROUND(0);
+	.loc 1 38 1399 view .LVU202
+	movq	%r13, 120(%rax)	# _1221, MEM[(u64 *)v_1170(D) + 120B]
+	.loc 1 38 1431 is_stmt 1 view .LVU203
+# blake2b-generic.c:38:     FULLROUND(0);
+	.loc 1 38 1461 is_stmt 0 view .LVU204
+	xorq	%r15, %rbp	# _69, tmp1679
+# blake2b-generic.c:38:     FULLROUND(0);
+	.loc 1 38 1439 view .LVU205
+	movq	%r15, 80(%rax)	# _69, MEM[(u64 *)v_1170(D) + 80B]
+	.loc 1 38 1451 is_stmt 1 view .LVU206
+.LVL36:
+.LBB823:
+.LBI823:
+	.loc 1 5 19 view .LVU207
+.LBB824:
+	.loc 1 5 46 view .LVU208
+# blake2b-generic.c:5: static inline u64 ror64(unsigned l, u64 x) { return (x >> l) | (x << (64-l)); }
+	.loc 1 5 62 is_stmt 0 view .LVU209
+	rorq	$24, %rbp	#, _1224
+.LVL37:
+	.loc 1 5 62 view .LVU210
+.LBE824:
+.LBE823:
+# blake2b-generic.c:38:     FULLROUND(0);
+	.loc 1 38 1459 view .LVU211
+	movq	%rbp, 40(%rax)	# _1224, MEM[(u64 *)v_1170(D) + 40B]
+	.loc 1 38 1491 is_stmt 1 view .LVU212
+# blake2b-generic.c:38:     FULLROUND(0);
+	.loc 1 38 1499 is_stmt 0 view .LVU213
+	addq	72(%r9), %r8	# MEM[(const u64 *)m_1171(D) + 72B], tmp1680
+	addq	%rbp, %r8	# _1224, _73
+# blake2b-generic.c:38:     FULLROUND(0);
+	.loc 1 38 1557 view .LVU214
+	xorq	%r8, %r13	# _73, tmp1682
+# blake2b-generic.c:38:     FULLROUND(0);
+	.loc 1 38 1499 view .LVU215
+	movq	%r8, (%rax)	# _73, *v_1170(D)
+	.loc 1 38 1547 is_stmt 1 view .LVU216
+.LVL38:
+.LBB825:
+.LBI825:
+	.loc 1 5 19 view .LVU217
+.LBB826:
+	.loc 1 5 46 view .LVU218
+# blake2b-generic.c:5: static inline u64 ror64(unsigned l, u64 x) { return (x >> l) | (x << (64-l)); }
+	.loc 1 5 62 is_stmt 0 view .LVU219
+	rorq	$16, %r13	#, tmp1682
+.LBE826:
+.LBE825:
+# blake2b-generic.c:38:     FULLROUND(0);
+	.loc 1 38 1595 view .LVU220
+	addq	%r13, %r15	# _1227, _75
+# blake2b-generic.c:38:     FULLROUND(0);
+	.loc 1 38 1555 view .LVU221
+	movq	%r13, 120(%rax)	# _1227, MEM[(u64 *)v_1170(D) + 120B]
+	.loc 1 38 1587 is_stmt 1 view .LVU222
+# blake2b-generic.c:38:     FULLROUND(0);
+	.loc 1 38 1617 is_stmt 0 view .LVU223
+	xorq	%r15, %rbp	# _75, tmp1683
+# blake2b-generic.c:38:     FULLROUND(0);
+	.loc 1 38 1595 view .LVU224
+	movq	%r15, 80(%rax)	# _75, MEM[(u64 *)v_1170(D) + 80B]
+	.loc 1 38 1607 is_stmt 1 view .LVU225
+.LVL39:
+.LBB827:
+.LBI827:
+	.loc 1 5 19 view .LVU226
+.LBB828:
+	.loc 1 5 46 view .LVU227
+# blake2b-generic.c:5: static inline u64 ror64(unsigned l, u64 x) { return (x >> l) | (x << (64-l)); }
+	.loc 1 5 62 is_stmt 0 view .LVU228
+	rolq	%rbp	# _1230
+.LVL40:
+	.loc 1 5 62 view .LVU229
+.LBE828:
+.LBE827:
+# blake2b-generic.c:38:     FULLROUND(0);
+	.loc 1 38 1595 view .LVU230
+	movq	%r13, -40(%rsp)	# _1227, %sfp
+# blake2b-generic.c:38:     FULLROUND(0);
+	.loc 1 38 1615 view .LVU231
+	movq	%rbp, 40(%rax)	# _1230, MEM[(u64 *)v_1170(D) + 40B]
+	.loc 1 38 1333 is_stmt 1 view .LVU232
+	.loc 1 38 1660 view .LVU233
+	.loc 1 38 1665 view .LVU234
+# blake2b-generic.c:38:     FULLROUND(0);
+	.loc 1 38 1673 is_stmt 0 view .LVU235
+	addq	80(%r9), %rsi	# MEM[(const u64 *)m_1171(D) + 80B], tmp1684
+	addq	%rbx, %rsi	# _1206, _79
+# blake2b-generic.c:38:     FULLROUND(0);
+	.loc 1 38 1617 view .LVU236
+	movq	%r15, -72(%rsp)	# _75, %sfp
+# blake2b-generic.c:38:     FULLROUND(0);
+	.loc 1 38 1732 view .LVU237
+	xorq	%rsi, %rdi	# _79, tmp1686
+# blake2b-generic.c:38:     FULLROUND(0);
+	.loc 1 38 1673 view .LVU238
+	movq	%rsi, 8(%rax)	# _79, MEM[(u64 *)v_1170(D) + 8B]
+	.loc 1 38 1722 is_stmt 1 view .LVU239
+.LVL41:
+.LBB829:
+.LBI829:
+	.loc 1 5 19 view .LVU240
+.LBB830:
+	.loc 1 5 46 view .LVU241
+# blake2b-generic.c:5: static inline u64 ror64(unsigned l, u64 x) { return (x >> l) | (x << (64-l)); }
+	.loc 1 5 62 is_stmt 0 view .LVU242
+	rolq	$32, %rdi	#, _1233
+.LVL42:
+	.loc 1 5 62 view .LVU243
+.LBE830:
+.LBE829:
+# blake2b-generic.c:38:     FULLROUND(0);
+	.loc 1 38 1770 view .LVU244
+	addq	%rdi, %r14	# _1233, _81
+# blake2b-generic.c:38:     FULLROUND(0);
+	.loc 1 38 1730 view .LVU245
+	movq	%rdi, 96(%rax)	# _1233, MEM[(u64 *)v_1170(D) + 96B]
+	.loc 1 38 1762 is_stmt 1 view .LVU246
+# blake2b-generic.c:38:     FULLROUND(0);
+	.loc 1 38 1792 is_stmt 0 view .LVU247
+	xorq	%r14, %rbx	# _81, tmp1687
+# blake2b-generic.c:38:     FULLROUND(0);
+	.loc 1 38 1770 view .LVU248
+	movq	%r14, 88(%rax)	# _81, MEM[(u64 *)v_1170(D) + 88B]
+	.loc 1 38 1782 is_stmt 1 view .LVU249
+.LVL43:
+.LBB831:
+.LBI831:
+	.loc 1 5 19 view .LVU250
+.LBB832:
+	.loc 1 5 46 view .LVU251
+# blake2b-generic.c:5: static inline u64 ror64(unsigned l, u64 x) { return (x >> l) | (x << (64-l)); }
+	.loc 1 5 62 is_stmt 0 view .LVU252
+	rorq	$24, %rbx	#, _1236
+.LVL44:
+	.loc 1 5 62 view .LVU253
+.LBE832:
+.LBE831:
+# blake2b-generic.c:38:     FULLROUND(0);
+	.loc 1 38 1790 view .LVU254
+	movq	%rbx, 48(%rax)	# _1236, MEM[(u64 *)v_1170(D) + 48B]
+	.loc 1 38 1822 is_stmt 1 view .LVU255
+# blake2b-generic.c:38:     FULLROUND(0);
+	.loc 1 38 1830 is_stmt 0 view .LVU256
+	addq	88(%r9), %rsi	# MEM[(const u64 *)m_1171(D) + 88B], tmp1688
+	addq	%rbx, %rsi	# _1236, _85
+# blake2b-generic.c:38:     FULLROUND(0);
+	.loc 1 38 1889 view .LVU257
+	xorq	%rsi, %rdi	# _85, tmp1690
+# blake2b-generic.c:38:     FULLROUND(0);
+	.loc 1 38 1830 view .LVU258
+	movq	%rsi, 8(%rax)	# _85, MEM[(u64 *)v_1170(D) + 8B]
+	.loc 1 38 1879 is_stmt 1 view .LVU259
+.LVL45:
+.LBB833:
+.LBI833:
+	.loc 1 5 19 view .LVU260
+.LBB834:
+	.loc 1 5 46 view .LVU261
+# blake2b-generic.c:5: static inline u64 ror64(unsigned l, u64 x) { return (x >> l) | (x << (64-l)); }
+	.loc 1 5 62 is_stmt 0 view .LVU262
+	rorq	$16, %rdi	#, _1239
+.LVL46:
+	.loc 1 5 62 view .LVU263
+.LBE834:
+.LBE833:
+# blake2b-generic.c:38:     FULLROUND(0);
+	.loc 1 38 1927 view .LVU264
+	addq	%rdi, %r14	# _1239, _87
+# blake2b-generic.c:38:     FULLROUND(0);
+	.loc 1 38 1887 view .LVU265
+	movq	%rdi, 96(%rax)	# _1239, MEM[(u64 *)v_1170(D) + 96B]
+	.loc 1 38 1919 is_stmt 1 view .LVU266
+# blake2b-generic.c:38:     FULLROUND(0);
+	.loc 1 38 1949 is_stmt 0 view .LVU267
+	xorq	%r14, %rbx	# _87, tmp1691
+# blake2b-generic.c:38:     FULLROUND(0);
+	.loc 1 38 1927 view .LVU268
+	movq	%r14, 88(%rax)	# _87, MEM[(u64 *)v_1170(D) + 88B]
+	.loc 1 38 1939 is_stmt 1 view .LVU269
+.LVL47:
+.LBB835:
+.LBI835:
+	.loc 1 5 19 view .LVU270
+.LBB836:
+	.loc 1 5 46 view .LVU271
+# blake2b-generic.c:5: static inline u64 ror64(unsigned l, u64 x) { return (x >> l) | (x << (64-l)); }
+	.loc 1 5 62 is_stmt 0 view .LVU272
+	rolq	%rbx	# _1242
+.LVL48:
+	.loc 1 5 62 view .LVU273
+.LBE836:
+.LBE835:
+# blake2b-generic.c:38:     FULLROUND(0);
+	.loc 1 38 1949 view .LVU274
+	movq	%r14, -64(%rsp)	# _87, %sfp
+# blake2b-generic.c:38:     FULLROUND(0);
+	.loc 1 38 1947 view .LVU275
+	movq	%rbx, 48(%rax)	# _1242, MEM[(u64 *)v_1170(D) + 48B]
+	.loc 1 38 1663 is_stmt 1 view .LVU276
+	.loc 1 38 1992 view .LVU277
+	.loc 1 38 1997 view .LVU278
+# blake2b-generic.c:38:     FULLROUND(0);
+	.loc 1 38 2005 is_stmt 0 view .LVU279
+	addq	96(%r9), %rdx	# MEM[(const u64 *)m_1171(D) + 96B], tmp1692
+	addq	%r11, %rdx	# _1218, _91
+# blake2b-generic.c:38:     FULLROUND(0);
+	.loc 1 38 2064 view .LVU280
+	xorq	%rdx, %rcx	# _91, tmp1694
+# blake2b-generic.c:38:     FULLROUND(0);
+	.loc 1 38 2005 view .LVU281
+	movq	%rdx, 16(%rax)	# _91, MEM[(u64 *)v_1170(D) + 16B]
+	.loc 1 38 2054 is_stmt 1 view .LVU282
+.LVL49:
+.LBB837:
+.LBI837:
+	.loc 1 5 19 view .LVU283
+.LBB838:
+	.loc 1 5 46 view .LVU284
+# blake2b-generic.c:5: static inline u64 ror64(unsigned l, u64 x) { return (x >> l) | (x << (64-l)); }
+	.loc 1 5 62 is_stmt 0 view .LVU285
+	rolq	$32, %rcx	#, _1245
+.LVL50:
+	.loc 1 5 62 view .LVU286
+.LBE838:
+.LBE837:
+# blake2b-generic.c:38:     FULLROUND(0);
+	.loc 1 38 2102 view .LVU287
+	addq	%rcx, %r12	# _1245, _93
+# blake2b-generic.c:38:     FULLROUND(0);
+	.loc 1 38 2062 view .LVU288
+	movq	%rcx, 104(%rax)	# _1245, MEM[(u64 *)v_1170(D) + 104B]
+	.loc 1 38 2094 is_stmt 1 view .LVU289
+# blake2b-generic.c:38:     FULLROUND(0);
+	.loc 1 38 2124 is_stmt 0 view .LVU290
+	xorq	%r12, %r11	# _93, tmp1695
+# blake2b-generic.c:38:     FULLROUND(0);
+	.loc 1 38 2102 view .LVU291
+	movq	%r12, 64(%rax)	# _93, MEM[(u64 *)v_1170(D) + 64B]
+	.loc 1 38 2114 is_stmt 1 view .LVU292
+.LVL51:
+.LBB839:
+.LBI839:
+	.loc 1 5 19 view .LVU293
+.LBB840:
+	.loc 1 5 46 view .LVU294
+# blake2b-generic.c:5: static inline u64 ror64(unsigned l, u64 x) { return (x >> l) | (x << (64-l)); }
+	.loc 1 5 62 is_stmt 0 view .LVU295
+	rorq	$24, %r11	#, _1248
+.LVL52:
+	.loc 1 5 62 view .LVU296
+.LBE840:
+.LBE839:
+# blake2b-generic.c:38:     FULLROUND(0);
+	.loc 1 38 2122 view .LVU297
+	movq	%r11, 56(%rax)	# _1248, MEM[(u64 *)v_1170(D) + 56B]
+	.loc 1 38 2154 is_stmt 1 view .LVU298
+# blake2b-generic.c:38:     FULLROUND(0);
+	.loc 1 38 2162 is_stmt 0 view .LVU299
+	addq	104(%r9), %rdx	# MEM[(const u64 *)m_1171(D) + 104B], tmp1696
+	addq	%r11, %rdx	# _1248, _97
+# blake2b-generic.c:38:     FULLROUND(0);
+	.loc 1 38 2221 view .LVU300
+	xorq	%rdx, %rcx	# _97, tmp1698
+# blake2b-generic.c:38:     FULLROUND(0);
+	.loc 1 38 2162 view .LVU301
+	movq	%rdx, 16(%rax)	# _97, MEM[(u64 *)v_1170(D) + 16B]
+	.loc 1 38 2211 is_stmt 1 view .LVU302
+.LVL53:
+.LBB841:
+.LBI841:
+	.loc 1 5 19 view .LVU303
+.LBB842:
+	.loc 1 5 46 view .LVU304
+# blake2b-generic.c:5: static inline u64 ror64(unsigned l, u64 x) { return (x >> l) | (x << (64-l)); }
+	.loc 1 5 62 is_stmt 0 view .LVU305
+	rorq	$16, %rcx	#, _1251
+.LVL54:
+	.loc 1 5 62 view .LVU306
+.LBE842:
+.LBE841:
+# blake2b-generic.c:38:     FULLROUND(0);
+	.loc 1 38 2259 view .LVU307
+	addq	%rcx, %r12	# _1251, _99
+# blake2b-generic.c:38:     FULLROUND(0);
+	.loc 1 38 2219 view .LVU308
+	movq	%rcx, 104(%rax)	# _1251, MEM[(u64 *)v_1170(D) + 104B]
+	.loc 1 38 2251 is_stmt 1 view .LVU309
+# blake2b-generic.c:38:     FULLROUND(0);
+	.loc 1 38 2281 is_stmt 0 view .LVU310
+	xorq	%r12, %r11	# _99, tmp1699
+# blake2b-generic.c:38:     FULLROUND(0);
+	.loc 1 38 2259 view .LVU311
+	movq	%r12, 64(%rax)	# _99, MEM[(u64 *)v_1170(D) + 64B]
+	.loc 1 38 2271 is_stmt 1 view .LVU312
+.LVL55:
+.LBB843:
+.LBI843:
+	.loc 1 5 19 view .LVU313
+.LBB844:
+	.loc 1 5 46 view .LVU314
+# blake2b-generic.c:5: static inline u64 ror64(unsigned l, u64 x) { return (x >> l) | (x << (64-l)); }
+	.loc 1 5 62 is_stmt 0 view .LVU315
+	rolq	%r11	# _1254
+.LVL56:
+	.loc 1 5 62 view .LVU316
+.LBE844:
+.LBE843:
+# blake2b-generic.c:38:     FULLROUND(0);
+	.loc 1 38 2279 view .LVU317
+	movq	%r11, 56(%rax)	# _1254, MEM[(u64 *)v_1170(D) + 56B]
+	.loc 1 38 1995 is_stmt 1 view .LVU318
+	.loc 1 38 2324 view .LVU319
+	.loc 1 38 2329 view .LVU320
+# blake2b-generic.c:38:     FULLROUND(0);
+	.loc 1 38 2337 is_stmt 0 view .LVU321
+	movq	-56(%rsp), %r15	# %sfp, _1182
+	addq	112(%r9), %r10	# MEM[(const u64 *)m_1171(D) + 112B], tmp1700
+# blake2b-generic.c:38:     FULLROUND(0);
+	.loc 1 38 2396 view .LVU322
+	movq	-48(%rsp), %r13	# %sfp, _1203
+# blake2b-generic.c:38:     FULLROUND(0);
+	.loc 1 38 2337 view .LVU323
+	addq	%r15, %r10	# _1182, _103
+# blake2b-generic.c:38:     FULLROUND(0);
+	.loc 1 38 2434 view .LVU324
+	movq	-80(%rsp), %r14	# %sfp, _31
+# blake2b-generic.c:38:     FULLROUND(0);
+	.loc 1 38 2396 view .LVU325
+	xorq	%r10, %r13	# _103, _1203
+# blake2b-generic.c:38:     FULLROUND(0);
+	.loc 1 38 2337 view .LVU326
+	movq	%r10, 24(%rax)	# _103, MEM[(u64 *)v_1170(D) + 24B]
+	.loc 1 38 2386 is_stmt 1 view .LVU327
+.LVL57:
+.LBB845:
+.LBI845:
+	.loc 1 5 19 view .LVU328
+.LBB846:
+	.loc 1 5 46 view .LVU329
+# blake2b-generic.c:5: static inline u64 ror64(unsigned l, u64 x) { return (x >> l) | (x << (64-l)); }
+	.loc 1 5 62 is_stmt 0 view .LVU330
+	rolq	$32, %r13	#, _1257
+.LVL58:
+	.loc 1 5 62 view .LVU331
+.LBE846:
+.LBE845:
+# blake2b-generic.c:38:     FULLROUND(0);
+	.loc 1 38 2434 view .LVU332
+	addq	%r13, %r14	# _1257, _105
+# blake2b-generic.c:38:     FULLROUND(0);
+	.loc 1 38 2394 view .LVU333
+	movq	%r13, 112(%rax)	# _1257, MEM[(u64 *)v_1170(D) + 112B]
+	.loc 1 38 2426 is_stmt 1 view .LVU334
+# blake2b-generic.c:38:     FULLROUND(0);
+	.loc 1 38 2456 is_stmt 0 view .LVU335
+	xorq	%r14, %r15	# _105, _1182
+# blake2b-generic.c:38:     FULLROUND(0);
+	.loc 1 38 2434 view .LVU336
+	movq	%r14, 72(%rax)	# _105, MEM[(u64 *)v_1170(D) + 72B]
+	.loc 1 38 2446 is_stmt 1 view .LVU337
+.LVL59:
+.LBB847:
+.LBI847:
+	.loc 1 5 19 view .LVU338
+.LBB848:
+	.loc 1 5 46 view .LVU339
+# blake2b-generic.c:5: static inline u64 ror64(unsigned l, u64 x) { return (x >> l) | (x << (64-l)); }
+	.loc 1 5 62 is_stmt 0 view .LVU340
+	rorq	$24, %r15	#, _1260
+.LVL60:
+	.loc 1 5 62 view .LVU341
+.LBE848:
+.LBE847:
+# blake2b-generic.c:38:     FULLROUND(0);
+	.loc 1 38 2454 view .LVU342
+	movq	%r15, 32(%rax)	# _1260, MEM[(u64 *)v_1170(D) + 32B]
+	.loc 1 38 2486 is_stmt 1 view .LVU343
+# blake2b-generic.c:38:     FULLROUND(0);
+	.loc 1 38 2494 is_stmt 0 view .LVU344
+	addq	120(%r9), %r10	# MEM[(const u64 *)m_1171(D) + 120B], tmp1704
+	addq	%r15, %r10	# _1260, _109
+# blake2b-generic.c:38:     FULLROUND(0);
+	.loc 1 38 2553 view .LVU345
+	xorq	%r10, %r13	# _109, tmp1706
+# blake2b-generic.c:38:     FULLROUND(0);
+	.loc 1 38 2494 view .LVU346
+	movq	%r10, 24(%rax)	# _109, MEM[(u64 *)v_1170(D) + 24B]
+	.loc 1 38 2543 is_stmt 1 view .LVU347
+.LVL61:
+.LBB849:
+.LBI849:
+	.loc 1 5 19 view .LVU348
+.LBB850:
+	.loc 1 5 46 view .LVU349
+# blake2b-generic.c:5: static inline u64 ror64(unsigned l, u64 x) { return (x >> l) | (x << (64-l)); }
+	.loc 1 5 62 is_stmt 0 view .LVU350
+	rorq	$16, %r13	#, _1263
+.LVL62:
+	.loc 1 5 62 view .LVU351
+.LBE850:
+.LBE849:
+# blake2b-generic.c:38:     FULLROUND(0);
+	.loc 1 38 2591 view .LVU352
+	addq	%r13, %r14	# _1263, _111
+# blake2b-generic.c:38:     FULLROUND(0);
+	.loc 1 38 2551 view .LVU353
+	movq	%r13, 112(%rax)	# _1263, MEM[(u64 *)v_1170(D) + 112B]
+	.loc 1 38 2583 is_stmt 1 view .LVU354
+# blake2b-generic.c:38:     FULLROUND(0);
+	.loc 1 38 2613 is_stmt 0 view .LVU355
+	xorq	%r14, %r15	# _111, tmp1707
+# blake2b-generic.c:38:     FULLROUND(0);
+	.loc 1 38 2591 view .LVU356
+	movq	%r14, 72(%rax)	# _111, MEM[(u64 *)v_1170(D) + 72B]
+	.loc 1 38 2603 is_stmt 1 view .LVU357
+.LVL63:
+.LBB851:
+.LBI851:
+	.loc 1 5 19 view .LVU358
+.LBB852:
+	.loc 1 5 46 view .LVU359
+# blake2b-generic.c:5: static inline u64 ror64(unsigned l, u64 x) { return (x >> l) | (x << (64-l)); }
+	.loc 1 5 62 is_stmt 0 view .LVU360
+	rolq	%r15	# _1266
+.LVL64:
+	.loc 1 5 62 view .LVU361
+.LBE852:
+.LBE851:
+# blake2b-generic.c:38:     FULLROUND(0);
+	.loc 1 38 2611 view .LVU362
+	movq	%r15, 32(%rax)	# _1266, MEM[(u64 *)v_1170(D) + 32B]
+	.loc 1 38 2327 is_stmt 1 view .LVU363
+	.loc 1 38 8 view .LVU364
+	.loc 1 39 5 view .LVU365
+	.loc 1 39 10 view .LVU366
+	.loc 1 39 15 view .LVU367
+# blake2b-generic.c:39:     FULLROUND(1);
+	.loc 1 39 23 is_stmt 0 view .LVU368
+	addq	112(%r9), %r8	# MEM[(const u64 *)m_1171(D) + 112B], tmp1708
+	addq	%r15, %r8	# _1266, _115
+# blake2b-generic.c:39:     FULLROUND(1);
+	.loc 1 39 81 view .LVU369
+	xorq	%r8, %rdi	# _115, tmp1710
+# blake2b-generic.c:39:     FULLROUND(1);
+	.loc 1 39 23 view .LVU370
+	movq	%r8, (%rax)	# _115, *v_1170(D)
+	.loc 1 39 71 is_stmt 1 view .LVU371
+.LVL65:
+.LBB853:
+.LBI853:
+	.loc 1 5 19 view .LVU372
+.LBB854:
+	.loc 1 5 46 view .LVU373
+# blake2b-generic.c:5: static inline u64 ror64(unsigned l, u64 x) { return (x >> l) | (x << (64-l)); }
+	.loc 1 5 62 is_stmt 0 view .LVU374
+	rolq	$32, %rdi	#, _1269
+.LVL66:
+	.loc 1 5 62 view .LVU375
+.LBE854:
+.LBE853:
+# blake2b-generic.c:39:     FULLROUND(1);
+	.loc 1 39 119 view .LVU376
+	addq	%rdi, %r12	# _1269, _117
+# blake2b-generic.c:39:     FULLROUND(1);
+	.loc 1 39 79 view .LVU377
+	movq	%rdi, 96(%rax)	# _1269, MEM[(u64 *)v_1170(D) + 96B]
+	.loc 1 39 111 is_stmt 1 view .LVU378
+# blake2b-generic.c:39:     FULLROUND(1);
+	.loc 1 39 141 is_stmt 0 view .LVU379
+	xorq	%r12, %r15	# _117, tmp1711
+# blake2b-generic.c:39:     FULLROUND(1);
+	.loc 1 39 119 view .LVU380
+	movq	%r12, 64(%rax)	# _117, MEM[(u64 *)v_1170(D) + 64B]
+	.loc 1 39 131 is_stmt 1 view .LVU381
+.LVL67:
+.LBB855:
+.LBI855:
+	.loc 1 5 19 view .LVU382
+.LBB856:
+	.loc 1 5 46 view .LVU383
+# blake2b-generic.c:5: static inline u64 ror64(unsigned l, u64 x) { return (x >> l) | (x << (64-l)); }
+	.loc 1 5 62 is_stmt 0 view .LVU384
+	rorq	$24, %r15	#, _1272
+.LVL68:
+	.loc 1 5 62 view .LVU385
+.LBE856:
+.LBE855:
+# blake2b-generic.c:39:     FULLROUND(1);
+	.loc 1 39 139 view .LVU386
+	movq	%r15, 32(%rax)	# _1272, MEM[(u64 *)v_1170(D) + 32B]
+	.loc 1 39 171 is_stmt 1 view .LVU387
+# blake2b-generic.c:39:     FULLROUND(1);
+	.loc 1 39 179 is_stmt 0 view .LVU388
+	addq	80(%r9), %r8	# MEM[(const u64 *)m_1171(D) + 80B], tmp1712
+	addq	%r15, %r8	# _1272, _121
+# blake2b-generic.c:39:     FULLROUND(1);
+	.loc 1 39 237 view .LVU389
+	xorq	%r8, %rdi	# _121, tmp1714
+# blake2b-generic.c:39:     FULLROUND(1);
+	.loc 1 39 179 view .LVU390
+	movq	%r8, (%rax)	# _121, *v_1170(D)
+	.loc 1 39 227 is_stmt 1 view .LVU391
+.LVL69:
+.LBB857:
+.LBI857:
+	.loc 1 5 19 view .LVU392
+.LBB858:
+	.loc 1 5 46 view .LVU393
+# blake2b-generic.c:5: static inline u64 ror64(unsigned l, u64 x) { return (x >> l) | (x << (64-l)); }
+	.loc 1 5 62 is_stmt 0 view .LVU394
+	rorq	$16, %rdi	#, _1275
+.LVL70:
+	.loc 1 5 62 view .LVU395
+.LBE858:
+.LBE857:
+# blake2b-generic.c:39:     FULLROUND(1);
+	.loc 1 39 275 view .LVU396
+	addq	%rdi, %r12	# _1275, _123
+# blake2b-generic.c:39:     FULLROUND(1);
+	.loc 1 39 235 view .LVU397
+	movq	%rdi, 96(%rax)	# _1275, MEM[(u64 *)v_1170(D) + 96B]
+	.loc 1 39 267 is_stmt 1 view .LVU398
+# blake2b-generic.c:39:     FULLROUND(1);
+	.loc 1 39 297 is_stmt 0 view .LVU399
+	xorq	%r12, %r15	# _123, tmp1715
+# blake2b-generic.c:39:     FULLROUND(1);
+	.loc 1 39 275 view .LVU400
+	movq	%r12, 64(%rax)	# _123, MEM[(u64 *)v_1170(D) + 64B]
+	.loc 1 39 287 is_stmt 1 view .LVU401
+.LVL71:
+.LBB859:
+.LBI859:
+	.loc 1 5 19 view .LVU402
+.LBB860:
+	.loc 1 5 46 view .LVU403
+# blake2b-generic.c:5: static inline u64 ror64(unsigned l, u64 x) { return (x >> l) | (x << (64-l)); }
+	.loc 1 5 62 is_stmt 0 view .LVU404
+	rolq	%r15	# tmp1715
+.LBE860:
+.LBE859:
+# blake2b-generic.c:39:     FULLROUND(1);
+	.loc 1 39 297 view .LVU405
+	movq	%r12, -80(%rsp)	# _123, %sfp
+# blake2b-generic.c:39:     FULLROUND(1);
+	.loc 1 39 295 view .LVU406
+	movq	%r15, 32(%rax)	# _1278, MEM[(u64 *)v_1170(D) + 32B]
+	.loc 1 39 13 is_stmt 1 view .LVU407
+	.loc 1 39 340 view .LVU408
+	.loc 1 39 345 view .LVU409
+# blake2b-generic.c:39:     FULLROUND(1);
+	.loc 1 39 353 is_stmt 0 view .LVU410
+	addq	32(%r9), %rsi	# MEM[(const u64 *)m_1171(D) + 32B], tmp1716
+	addq	%rbp, %rsi	# _1230, _127
+# blake2b-generic.c:39:     FULLROUND(1);
+	.loc 1 39 295 view .LVU411
+	movq	%r15, -48(%rsp)	# _1278, %sfp
+# blake2b-generic.c:39:     FULLROUND(1);
+	.loc 1 39 411 view .LVU412
+	xorq	%rsi, %rcx	# _127, tmp1718
+# blake2b-generic.c:39:     FULLROUND(1);
+	.loc 1 39 353 view .LVU413
+	movq	%rsi, 8(%rax)	# _127, MEM[(u64 *)v_1170(D) + 8B]
+	.loc 1 39 401 is_stmt 1 view .LVU414
+.LVL72:
+.LBB861:
+.LBI861:
+	.loc 1 5 19 view .LVU415
+.LBB862:
+	.loc 1 5 46 view .LVU416
+# blake2b-generic.c:5: static inline u64 ror64(unsigned l, u64 x) { return (x >> l) | (x << (64-l)); }
+	.loc 1 5 62 is_stmt 0 view .LVU417
+	rolq	$32, %rcx	#, _1281
+.LVL73:
+	.loc 1 5 62 view .LVU418
+.LBE862:
+.LBE861:
+# blake2b-generic.c:39:     FULLROUND(1);
+	.loc 1 39 449 view .LVU419
+	addq	%rcx, %r14	# _1281, _129
+# blake2b-generic.c:39:     FULLROUND(1);
+	.loc 1 39 409 view .LVU420
+	movq	%rcx, 104(%rax)	# _1281, MEM[(u64 *)v_1170(D) + 104B]
+	.loc 1 39 441 is_stmt 1 view .LVU421
+# blake2b-generic.c:39:     FULLROUND(1);
+	.loc 1 39 471 is_stmt 0 view .LVU422
+	xorq	%r14, %rbp	# _129, tmp1719
+# blake2b-generic.c:39:     FULLROUND(1);
+	.loc 1 39 449 view .LVU423
+	movq	%r14, 72(%rax)	# _129, MEM[(u64 *)v_1170(D) + 72B]
+	.loc 1 39 461 is_stmt 1 view .LVU424
+.LVL74:
+.LBB863:
+.LBI863:
+	.loc 1 5 19 view .LVU425
+.LBB864:
+	.loc 1 5 46 view .LVU426
+# blake2b-generic.c:5: static inline u64 ror64(unsigned l, u64 x) { return (x >> l) | (x << (64-l)); }
+	.loc 1 5 62 is_stmt 0 view .LVU427
+	rorq	$24, %rbp	#, _1284
+.LVL75:
+	.loc 1 5 62 view .LVU428
+.LBE864:
+.LBE863:
+# blake2b-generic.c:39:     FULLROUND(1);
+	.loc 1 39 469 view .LVU429
+	movq	%rbp, 40(%rax)	# _1284, MEM[(u64 *)v_1170(D) + 40B]
+	.loc 1 39 501 is_stmt 1 view .LVU430
+# blake2b-generic.c:39:     FULLROUND(1);
+	.loc 1 39 509 is_stmt 0 view .LVU431
+	addq	64(%r9), %rsi	# MEM[(const u64 *)m_1171(D) + 64B], tmp1720
+	addq	%rbp, %rsi	# _1284, _133
+# blake2b-generic.c:39:     FULLROUND(1);
+	.loc 1 39 567 view .LVU432
+	xorq	%rsi, %rcx	# _133, tmp1722
+# blake2b-generic.c:39:     FULLROUND(1);
+	.loc 1 39 509 view .LVU433
+	movq	%rsi, 8(%rax)	# _133, MEM[(u64 *)v_1170(D) + 8B]
+	.loc 1 39 557 is_stmt 1 view .LVU434
+.LVL76:
+.LBB865:
+.LBI865:
+	.loc 1 5 19 view .LVU435
+.LBB866:
+	.loc 1 5 46 view .LVU436
+# blake2b-generic.c:5: static inline u64 ror64(unsigned l, u64 x) { return (x >> l) | (x << (64-l)); }
+	.loc 1 5 62 is_stmt 0 view .LVU437
+	rorq	$16, %rcx	#, _1287
+.LVL77:
+	.loc 1 5 62 view .LVU438
+.LBE866:
+.LBE865:
+# blake2b-generic.c:39:     FULLROUND(1);
+	.loc 1 39 605 view .LVU439
+	leaq	(%r14,%rcx), %r12	#, _135
+# blake2b-generic.c:39:     FULLROUND(1);
+	.loc 1 39 565 view .LVU440
+	movq	%rcx, 104(%rax)	# _1287, MEM[(u64 *)v_1170(D) + 104B]
+	.loc 1 39 597 is_stmt 1 view .LVU441
+# blake2b-generic.c:39:     FULLROUND(1);
+	.loc 1 39 779 is_stmt 0 view .LVU442
+	movq	-72(%rsp), %r14	# %sfp, _75
+# blake2b-generic.c:39:     FULLROUND(1);
+	.loc 1 39 627 view .LVU443
+	xorq	%r12, %rbp	# _135, tmp1723
+# blake2b-generic.c:39:     FULLROUND(1);
+	.loc 1 39 605 view .LVU444
+	movq	%r12, 72(%rax)	# _135, MEM[(u64 *)v_1170(D) + 72B]
+	.loc 1 39 617 is_stmt 1 view .LVU445
+.LVL78:
+.LBB867:
+.LBI867:
+	.loc 1 5 19 view .LVU446
+.LBB868:
+	.loc 1 5 46 view .LVU447
+.LBE868:
+.LBE867:
+# blake2b-generic.c:39:     FULLROUND(1);
+	.loc 1 39 1109 is_stmt 0 view .LVU448
+	movq	-64(%rsp), %r15	# %sfp, _87
+.LBB870:
+.LBB869:
+# blake2b-generic.c:5: static inline u64 ror64(unsigned l, u64 x) { return (x >> l) | (x << (64-l)); }
+	.loc 1 5 62 view .LVU449
+	rolq	%rbp	# _1290
+.LVL79:
+	.loc 1 5 62 view .LVU450
+.LBE869:
+.LBE870:
+# blake2b-generic.c:39:     FULLROUND(1);
+	.loc 1 39 627 view .LVU451
+	movq	%r12, -56(%rsp)	# _135, %sfp
+# blake2b-generic.c:39:     FULLROUND(1);
+	.loc 1 39 1071 view .LVU452
+	movq	-40(%rsp), %r12	# %sfp, _1227
+# blake2b-generic.c:39:     FULLROUND(1);
+	.loc 1 39 625 view .LVU453
+	movq	%rbp, 40(%rax)	# _1290, MEM[(u64 *)v_1170(D) + 40B]
+	.loc 1 39 343 is_stmt 1 view .LVU454
+	.loc 1 39 670 view .LVU455
+	.loc 1 39 675 view .LVU456
+# blake2b-generic.c:39:     FULLROUND(1);
+	.loc 1 39 683 is_stmt 0 view .LVU457
+	addq	72(%r9), %rdx	# MEM[(const u64 *)m_1171(D) + 72B], tmp1724
+	addq	%rbx, %rdx	# _1242, _139
+# blake2b-generic.c:39:     FULLROUND(1);
+	.loc 1 39 741 view .LVU458
+	xorq	%rdx, %r13	# _139, tmp1726
+# blake2b-generic.c:39:     FULLROUND(1);
+	.loc 1 39 683 view .LVU459
+	movq	%rdx, 16(%rax)	# _139, MEM[(u64 *)v_1170(D) + 16B]
+	.loc 1 39 731 is_stmt 1 view .LVU460
+.LVL80:
+.LBB871:
+.LBI871:
+	.loc 1 5 19 view .LVU461
+.LBB872:
+	.loc 1 5 46 view .LVU462
+# blake2b-generic.c:5: static inline u64 ror64(unsigned l, u64 x) { return (x >> l) | (x << (64-l)); }
+	.loc 1 5 62 is_stmt 0 view .LVU463
+	rolq	$32, %r13	#, _1293
+.LVL81:
+	.loc 1 5 62 view .LVU464
+.LBE872:
+.LBE871:
+# blake2b-generic.c:39:     FULLROUND(1);
+	.loc 1 39 779 view .LVU465
+	addq	%r13, %r14	# _1293, _141
+# blake2b-generic.c:39:     FULLROUND(1);
+	.loc 1 39 739 view .LVU466
+	movq	%r13, 112(%rax)	# _1293, MEM[(u64 *)v_1170(D) + 112B]
+	.loc 1 39 771 is_stmt 1 view .LVU467
+# blake2b-generic.c:39:     FULLROUND(1);
+	.loc 1 39 801 is_stmt 0 view .LVU468
+	xorq	%r14, %rbx	# _141, tmp1727
+# blake2b-generic.c:39:     FULLROUND(1);
+	.loc 1 39 779 view .LVU469
+	movq	%r14, 80(%rax)	# _141, MEM[(u64 *)v_1170(D) + 80B]
+	.loc 1 39 791 is_stmt 1 view .LVU470
+.LVL82:
+.LBB873:
+.LBI873:
+	.loc 1 5 19 view .LVU471
+.LBB874:
+	.loc 1 5 46 view .LVU472
+# blake2b-generic.c:5: static inline u64 ror64(unsigned l, u64 x) { return (x >> l) | (x << (64-l)); }
+	.loc 1 5 62 is_stmt 0 view .LVU473
+	rorq	$24, %rbx	#, _1296
+.LVL83:
+	.loc 1 5 62 view .LVU474
+.LBE874:
+.LBE873:
+# blake2b-generic.c:39:     FULLROUND(1);
+	.loc 1 39 799 view .LVU475
+	movq	%rbx, 48(%rax)	# _1296, MEM[(u64 *)v_1170(D) + 48B]
+	.loc 1 39 831 is_stmt 1 view .LVU476
+# blake2b-generic.c:39:     FULLROUND(1);
+	.loc 1 39 839 is_stmt 0 view .LVU477
+	addq	120(%r9), %rdx	# MEM[(const u64 *)m_1171(D) + 120B], tmp1728
+	addq	%rbx, %rdx	# _1296, _145
+# blake2b-generic.c:39:     FULLROUND(1);
+	.loc 1 39 897 view .LVU478
+	xorq	%rdx, %r13	# _145, tmp1730
+# blake2b-generic.c:39:     FULLROUND(1);
+	.loc 1 39 839 view .LVU479
+	movq	%rdx, 16(%rax)	# _145, MEM[(u64 *)v_1170(D) + 16B]
+	.loc 1 39 887 is_stmt 1 view .LVU480
+.LVL84:
+.LBB875:
+.LBI875:
+	.loc 1 5 19 view .LVU481
+.LBB876:
+	.loc 1 5 46 view .LVU482
+# blake2b-generic.c:5: static inline u64 ror64(unsigned l, u64 x) { return (x >> l) | (x << (64-l)); }
+	.loc 1 5 62 is_stmt 0 view .LVU483
+	rorq	$16, %r13	#, _1299
+.LVL85:
+	.loc 1 5 62 view .LVU484
+.LBE876:
+.LBE875:
+# blake2b-generic.c:39:     FULLROUND(1);
+	.loc 1 39 935 view .LVU485
+	addq	%r13, %r14	# _1299, _147
+# blake2b-generic.c:39:     FULLROUND(1);
+	.loc 1 39 895 view .LVU486
+	movq	%r13, 112(%rax)	# _1299, MEM[(u64 *)v_1170(D) + 112B]
+	.loc 1 39 927 is_stmt 1 view .LVU487
+# blake2b-generic.c:39:     FULLROUND(1);
+	.loc 1 39 957 is_stmt 0 view .LVU488
+	xorq	%r14, %rbx	# _147, tmp1731
+# blake2b-generic.c:39:     FULLROUND(1);
+	.loc 1 39 935 view .LVU489
+	movq	%r14, 80(%rax)	# _147, MEM[(u64 *)v_1170(D) + 80B]
+	.loc 1 39 947 is_stmt 1 view .LVU490
+.LVL86:
+.LBB877:
+.LBI877:
+	.loc 1 5 19 view .LVU491
+.LBB878:
+	.loc 1 5 46 view .LVU492
+# blake2b-generic.c:5: static inline u64 ror64(unsigned l, u64 x) { return (x >> l) | (x << (64-l)); }
+	.loc 1 5 62 is_stmt 0 view .LVU493
+	rolq	%rbx	# _1302
+.LVL87:
+	.loc 1 5 62 view .LVU494
+.LBE878:
+.LBE877:
+# blake2b-generic.c:39:     FULLROUND(1);
+	.loc 1 39 955 view .LVU495
+	movq	%rbx, 48(%rax)	# _1302, MEM[(u64 *)v_1170(D) + 48B]
+	.loc 1 39 673 is_stmt 1 view .LVU496
+	.loc 1 39 1000 view .LVU497
+	.loc 1 39 1005 view .LVU498
+# blake2b-generic.c:39:     FULLROUND(1);
+	.loc 1 39 1013 is_stmt 0 view .LVU499
+	addq	104(%r9), %r10	# MEM[(const u64 *)m_1171(D) + 104B], tmp1732
+	addq	%r11, %r10	# _1254, _151
+# blake2b-generic.c:39:     FULLROUND(1);
+	.loc 1 39 1071 view .LVU500
+	xorq	%r10, %r12	# _151, _1227
+# blake2b-generic.c:39:     FULLROUND(1);
+	.loc 1 39 1013 view .LVU501
+	movq	%r10, 24(%rax)	# _151, MEM[(u64 *)v_1170(D) + 24B]
+	.loc 1 39 1061 is_stmt 1 view .LVU502
+.LVL88:
+.LBB879:
+.LBI879:
+	.loc 1 5 19 view .LVU503
+.LBB880:
+	.loc 1 5 46 view .LVU504
+# blake2b-generic.c:5: static inline u64 ror64(unsigned l, u64 x) { return (x >> l) | (x << (64-l)); }
+	.loc 1 5 62 is_stmt 0 view .LVU505
+	rolq	$32, %r12	#, _1305
+.LVL89:
+	.loc 1 5 62 view .LVU506
+.LBE880:
+.LBE879:
+# blake2b-generic.c:39:     FULLROUND(1);
+	.loc 1 39 1109 view .LVU507
+	addq	%r12, %r15	# _1305, _153
+# blake2b-generic.c:39:     FULLROUND(1);
+	.loc 1 39 1069 view .LVU508
+	movq	%r12, 120(%rax)	# _1305, MEM[(u64 *)v_1170(D) + 120B]
+	.loc 1 39 1101 is_stmt 1 view .LVU509
+# blake2b-generic.c:39:     FULLROUND(1);
+	.loc 1 39 1131 is_stmt 0 view .LVU510
+	xorq	%r15, %r11	# _153, tmp1735
+# blake2b-generic.c:39:     FULLROUND(1);
+	.loc 1 39 1109 view .LVU511
+	movq	%r15, 88(%rax)	# _153, MEM[(u64 *)v_1170(D) + 88B]
+	.loc 1 39 1121 is_stmt 1 view .LVU512
+.LVL90:
+.LBB881:
+.LBI881:
+	.loc 1 5 19 view .LVU513
+.LBB882:
+	.loc 1 5 46 view .LVU514
+# blake2b-generic.c:5: static inline u64 ror64(unsigned l, u64 x) { return (x >> l) | (x << (64-l)); }
+	.loc 1 5 62 is_stmt 0 view .LVU515
+	rorq	$24, %r11	#, _1308
+.LVL91:
+	.loc 1 5 62 view .LVU516
+.LBE882:
+.LBE881:
+# blake2b-generic.c:39:     FULLROUND(1);
+	.loc 1 39 1129 view .LVU517
+	movq	%r11, 56(%rax)	# _1308, MEM[(u64 *)v_1170(D) + 56B]
+	.loc 1 39 1161 is_stmt 1 view .LVU518
+# blake2b-generic.c:39:     FULLROUND(1);
+	.loc 1 39 1169 is_stmt 0 view .LVU519
+	addq	48(%r9), %r10	# MEM[(const u64 *)m_1171(D) + 48B], tmp1736
+	addq	%r11, %r10	# _1308, _157
+# blake2b-generic.c:39:     FULLROUND(1);
+	.loc 1 39 1227 view .LVU520
+	xorq	%r10, %r12	# _157, tmp1738
+# blake2b-generic.c:39:     FULLROUND(1);
+	.loc 1 39 1169 view .LVU521
+	movq	%r10, 24(%rax)	# _157, MEM[(u64 *)v_1170(D) + 24B]
+	.loc 1 39 1217 is_stmt 1 view .LVU522
+.LVL92:
+.LBB883:
+.LBI883:
+	.loc 1 5 19 view .LVU523
+.LBB884:
+	.loc 1 5 46 view .LVU524
+# blake2b-generic.c:5: static inline u64 ror64(unsigned l, u64 x) { return (x >> l) | (x << (64-l)); }
+	.loc 1 5 62 is_stmt 0 view .LVU525
+	rorq	$16, %r12	#, _1311
+.LVL93:
+	.loc 1 5 62 view .LVU526
+.LBE884:
+.LBE883:
+# blake2b-generic.c:39:     FULLROUND(1);
+	.loc 1 39 1265 view .LVU527
+	addq	%r12, %r15	# _1311, _159
+# blake2b-generic.c:39:     FULLROUND(1);
+	.loc 1 39 1225 view .LVU528
+	movq	%r12, 120(%rax)	# _1311, MEM[(u64 *)v_1170(D) + 120B]
+	.loc 1 39 1257 is_stmt 1 view .LVU529
+# blake2b-generic.c:39:     FULLROUND(1);
+	.loc 1 39 1287 is_stmt 0 view .LVU530
+	xorq	%r15, %r11	# _159, tmp1739
+# blake2b-generic.c:39:     FULLROUND(1);
+	.loc 1 39 1265 view .LVU531
+	movq	%r15, 88(%rax)	# _159, MEM[(u64 *)v_1170(D) + 88B]
+	.loc 1 39 1277 is_stmt 1 view .LVU532
+.LVL94:
+.LBB885:
+.LBI885:
+	.loc 1 5 19 view .LVU533
+.LBB886:
+	.loc 1 5 46 view .LVU534
+# blake2b-generic.c:5: static inline u64 ror64(unsigned l, u64 x) { return (x >> l) | (x << (64-l)); }
+	.loc 1 5 62 is_stmt 0 view .LVU535
+	rolq	%r11	# _1314
+.LVL95:
+	.loc 1 5 62 view .LVU536
+.LBE886:
+.LBE885:
+# blake2b-generic.c:39:     FULLROUND(1);
+	.loc 1 39 1285 view .LVU537
+	movq	%r11, 56(%rax)	# _1314, MEM[(u64 *)v_1170(D) + 56B]
+	.loc 1 39 1003 is_stmt 1 view .LVU538
+	.loc 1 39 1330 view .LVU539
+	.loc 1 39 1335 view .LVU540
+# blake2b-generic.c:39:     FULLROUND(1);
+	.loc 1 39 1343 is_stmt 0 view .LVU541
+	addq	8(%r9), %r8	# MEM[(const u64 *)m_1171(D) + 8B], tmp1740
+	addq	%rbp, %r8	# _1290, _163
+# blake2b-generic.c:39:     FULLROUND(1);
+	.loc 1 39 1401 view .LVU542
+	xorq	%r8, %r12	# _163, tmp1742
+# blake2b-generic.c:39:     FULLROUND(1);
+	.loc 1 39 1343 view .LVU543
+	movq	%r8, (%rax)	# _163, *v_1170(D)
+	.loc 1 39 1391 is_stmt 1 view .LVU544
+.LVL96:
+.LBB887:
+.LBI887:
+	.loc 1 5 19 view .LVU545
+.LBB888:
+	.loc 1 5 46 view .LVU546
+# blake2b-generic.c:5: static inline u64 ror64(unsigned l, u64 x) { return (x >> l) | (x << (64-l)); }
+	.loc 1 5 62 is_stmt 0 view .LVU547
+	rolq	$32, %r12	#, _1317
+.LVL97:
+	.loc 1 5 62 view .LVU548
+.LBE888:
+.LBE887:
+# blake2b-generic.c:39:     FULLROUND(1);
+	.loc 1 39 1439 view .LVU549
+	addq	%r12, %r14	# _1317, _165
+# blake2b-generic.c:39:     FULLROUND(1);
+	.loc 1 39 1399 view .LVU550
+	movq	%r12, 120(%rax)	# _1317, MEM[(u64 *)v_1170(D) + 120B]
+	.loc 1 39 1431 is_stmt 1 view .LVU551
+# blake2b-generic.c:39:     FULLROUND(1);
+	.loc 1 39 1461 is_stmt 0 view .LVU552
+	xorq	%r14, %rbp	# _165, tmp1743
+# blake2b-generic.c:39:     FULLROUND(1);
+	.loc 1 39 1439 view .LVU553
+	movq	%r14, 80(%rax)	# _165, MEM[(u64 *)v_1170(D) + 80B]
+	.loc 1 39 1451 is_stmt 1 view .LVU554
+.LVL98:
+.LBB889:
+.LBI889:
+	.loc 1 5 19 view .LVU555
+.LBB890:
+	.loc 1 5 46 view .LVU556
+# blake2b-generic.c:5: static inline u64 ror64(unsigned l, u64 x) { return (x >> l) | (x << (64-l)); }
+	.loc 1 5 62 is_stmt 0 view .LVU557
+	rorq	$24, %rbp	#, _1320
+.LVL99:
+	.loc 1 5 62 view .LVU558
+.LBE890:
+.LBE889:
+# blake2b-generic.c:39:     FULLROUND(1);
+	.loc 1 39 1459 view .LVU559
+	movq	%rbp, 40(%rax)	# _1320, MEM[(u64 *)v_1170(D) + 40B]
+	.loc 1 39 1491 is_stmt 1 view .LVU560
+# blake2b-generic.c:39:     FULLROUND(1);
+	.loc 1 39 1499 is_stmt 0 view .LVU561
+	addq	96(%r9), %r8	# MEM[(const u64 *)m_1171(D) + 96B], tmp1744
+	addq	%rbp, %r8	# _1320, _169
+# blake2b-generic.c:39:     FULLROUND(1);
+	.loc 1 39 1557 view .LVU562
+	xorq	%r8, %r12	# _169, tmp1746
+# blake2b-generic.c:39:     FULLROUND(1);
+	.loc 1 39 1499 view .LVU563
+	movq	%r8, (%rax)	# _169, *v_1170(D)
+	.loc 1 39 1547 is_stmt 1 view .LVU564
+.LVL100:
+.LBB891:
+.LBI891:
+	.loc 1 5 19 view .LVU565
+.LBB892:
+	.loc 1 5 46 view .LVU566
+# blake2b-generic.c:5: static inline u64 ror64(unsigned l, u64 x) { return (x >> l) | (x << (64-l)); }
+	.loc 1 5 62 is_stmt 0 view .LVU567
+	rorq	$16, %r12	#, tmp1746
+.LBE892:
+.LBE891:
+# blake2b-generic.c:39:     FULLROUND(1);
+	.loc 1 39 1595 view .LVU568
+	addq	%r12, %r14	# _1323, _171
+# blake2b-generic.c:39:     FULLROUND(1);
+	.loc 1 39 1555 view .LVU569
+	movq	%r12, 120(%rax)	# _1323, MEM[(u64 *)v_1170(D) + 120B]
+	.loc 1 39 1587 is_stmt 1 view .LVU570
+# blake2b-generic.c:39:     FULLROUND(1);
+	.loc 1 39 1617 is_stmt 0 view .LVU571
+	xorq	%r14, %rbp	# _171, tmp1747
+# blake2b-generic.c:39:     FULLROUND(1);
+	.loc 1 39 1595 view .LVU572
+	movq	%r14, 80(%rax)	# _171, MEM[(u64 *)v_1170(D) + 80B]
+	.loc 1 39 1607 is_stmt 1 view .LVU573
+.LVL101:
+.LBB893:
+.LBI893:
+	.loc 1 5 19 view .LVU574
+.LBB894:
+	.loc 1 5 46 view .LVU575
+# blake2b-generic.c:5: static inline u64 ror64(unsigned l, u64 x) { return (x >> l) | (x << (64-l)); }
+	.loc 1 5 62 is_stmt 0 view .LVU576
+	rolq	%rbp	# _1326
+.LVL102:
+	.loc 1 5 62 view .LVU577
+.LBE894:
+.LBE893:
+# blake2b-generic.c:39:     FULLROUND(1);
+	.loc 1 39 1617 view .LVU578
+	movq	%r14, -72(%rsp)	# _171, %sfp
+# blake2b-generic.c:39:     FULLROUND(1);
+	.loc 1 39 2102 view .LVU579
+	movq	-80(%rsp), %r14	# %sfp, _123
+# blake2b-generic.c:39:     FULLROUND(1);
+	.loc 1 39 1615 view .LVU580
+	movq	%rbp, 40(%rax)	# _1326, MEM[(u64 *)v_1170(D) + 40B]
+	.loc 1 39 1333 is_stmt 1 view .LVU581
+	.loc 1 39 1660 view .LVU582
+	.loc 1 39 1665 view .LVU583
+# blake2b-generic.c:39:     FULLROUND(1);
+	.loc 1 39 1673 is_stmt 0 view .LVU584
+	addq	(%r9), %rsi	# *m_1171(D), tmp1748
+	addq	%rbx, %rsi	# _1302, _175
+# blake2b-generic.c:39:     FULLROUND(1);
+	.loc 1 39 1595 view .LVU585
+	movq	%r12, -40(%rsp)	# _1323, %sfp
+# blake2b-generic.c:39:     FULLROUND(1);
+	.loc 1 39 1732 view .LVU586
+	xorq	%rsi, %rdi	# _175, tmp1750
+# blake2b-generic.c:39:     FULLROUND(1);
+	.loc 1 39 1673 view .LVU587
+	movq	%rsi, 8(%rax)	# _175, MEM[(u64 *)v_1170(D) + 8B]
+	.loc 1 39 1722 is_stmt 1 view .LVU588
+.LVL103:
+.LBB895:
+.LBI895:
+	.loc 1 5 19 view .LVU589
+.LBB896:
+	.loc 1 5 46 view .LVU590
+# blake2b-generic.c:5: static inline u64 ror64(unsigned l, u64 x) { return (x >> l) | (x << (64-l)); }
+	.loc 1 5 62 is_stmt 0 view .LVU591
+	rolq	$32, %rdi	#, _1329
+.LVL104:
+	.loc 1 5 62 view .LVU592
+.LBE896:
+.LBE895:
+# blake2b-generic.c:39:     FULLROUND(1);
+	.loc 1 39 1770 view .LVU593
+	addq	%rdi, %r15	# _1329, _177
+# blake2b-generic.c:39:     FULLROUND(1);
+	.loc 1 39 1730 view .LVU594
+	movq	%rdi, 96(%rax)	# _1329, MEM[(u64 *)v_1170(D) + 96B]
+	.loc 1 39 1762 is_stmt 1 view .LVU595
+# blake2b-generic.c:39:     FULLROUND(1);
+	.loc 1 39 1792 is_stmt 0 view .LVU596
+	xorq	%r15, %rbx	# _177, tmp1751
+# blake2b-generic.c:39:     FULLROUND(1);
+	.loc 1 39 1770 view .LVU597
+	movq	%r15, 88(%rax)	# _177, MEM[(u64 *)v_1170(D) + 88B]
+	.loc 1 39 1782 is_stmt 1 view .LVU598
+.LVL105:
+.LBB897:
+.LBI897:
+	.loc 1 5 19 view .LVU599
+.LBB898:
+	.loc 1 5 46 view .LVU600
+# blake2b-generic.c:5: static inline u64 ror64(unsigned l, u64 x) { return (x >> l) | (x << (64-l)); }
+	.loc 1 5 62 is_stmt 0 view .LVU601
+	rorq	$24, %rbx	#, _1332
+.LVL106:
+	.loc 1 5 62 view .LVU602
+.LBE898:
+.LBE897:
+# blake2b-generic.c:39:     FULLROUND(1);
+	.loc 1 39 1790 view .LVU603
+	movq	%rbx, 48(%rax)	# _1332, MEM[(u64 *)v_1170(D) + 48B]
+	.loc 1 39 1822 is_stmt 1 view .LVU604
+# blake2b-generic.c:39:     FULLROUND(1);
+	.loc 1 39 1830 is_stmt 0 view .LVU605
+	addq	16(%r9), %rsi	# MEM[(const u64 *)m_1171(D) + 16B], tmp1752
+	addq	%rbx, %rsi	# _1332, _181
+# blake2b-generic.c:39:     FULLROUND(1);
+	.loc 1 39 1889 view .LVU606
+	xorq	%rsi, %rdi	# _181, tmp1754
+# blake2b-generic.c:39:     FULLROUND(1);
+	.loc 1 39 1830 view .LVU607
+	movq	%rsi, 8(%rax)	# _181, MEM[(u64 *)v_1170(D) + 8B]
+	.loc 1 39 1879 is_stmt 1 view .LVU608
+.LVL107:
+.LBB899:
+.LBI899:
+	.loc 1 5 19 view .LVU609
+.LBB900:
+	.loc 1 5 46 view .LVU610
+# blake2b-generic.c:5: static inline u64 ror64(unsigned l, u64 x) { return (x >> l) | (x << (64-l)); }
+	.loc 1 5 62 is_stmt 0 view .LVU611
+	rorq	$16, %rdi	#, _1335
+.LVL108:
+	.loc 1 5 62 view .LVU612
+.LBE900:
+.LBE899:
+# blake2b-generic.c:39:     FULLROUND(1);
+	.loc 1 39 1927 view .LVU613
+	addq	%rdi, %r15	# _1335, _183
+# blake2b-generic.c:39:     FULLROUND(1);
+	.loc 1 39 1887 view .LVU614
+	movq	%rdi, 96(%rax)	# _1335, MEM[(u64 *)v_1170(D) + 96B]
+	.loc 1 39 1919 is_stmt 1 view .LVU615
+# blake2b-generic.c:39:     FULLROUND(1);
+	.loc 1 39 1949 is_stmt 0 view .LVU616
+	xorq	%r15, %rbx	# _183, tmp1755
+# blake2b-generic.c:39:     FULLROUND(1);
+	.loc 1 39 1927 view .LVU617
+	movq	%r15, 88(%rax)	# _183, MEM[(u64 *)v_1170(D) + 88B]
+	.loc 1 39 1939 is_stmt 1 view .LVU618
+.LVL109:
+.LBB901:
+.LBI901:
+	.loc 1 5 19 view .LVU619
+.LBB902:
+	.loc 1 5 46 view .LVU620
+# blake2b-generic.c:5: static inline u64 ror64(unsigned l, u64 x) { return (x >> l) | (x << (64-l)); }
+	.loc 1 5 62 is_stmt 0 view .LVU621
+	rolq	%rbx	# _1338
+.LVL110:
+	.loc 1 5 62 view .LVU622
+.LBE902:
+.LBE901:
+# blake2b-generic.c:39:     FULLROUND(1);
+	.loc 1 39 1949 view .LVU623
+	movq	%r15, -64(%rsp)	# _183, %sfp
+# blake2b-generic.c:39:     FULLROUND(1);
+	.loc 1 39 2434 view .LVU624
+	movq	-56(%rsp), %r15	# %sfp, _135
+# blake2b-generic.c:39:     FULLROUND(1);
+	.loc 1 39 1947 view .LVU625
+	movq	%rbx, 48(%rax)	# _1338, MEM[(u64 *)v_1170(D) + 48B]
+	.loc 1 39 1663 is_stmt 1 view .LVU626
+	.loc 1 39 1992 view .LVU627
+	.loc 1 39 1997 view .LVU628
+# blake2b-generic.c:39:     FULLROUND(1);
+	.loc 1 39 2005 is_stmt 0 view .LVU629
+	addq	88(%r9), %rdx	# MEM[(const u64 *)m_1171(D) + 88B], tmp1756
+	addq	%r11, %rdx	# _1314, _187
+# blake2b-generic.c:39:     FULLROUND(1);
+	.loc 1 39 2064 view .LVU630
+	xorq	%rdx, %rcx	# _187, tmp1758
+# blake2b-generic.c:39:     FULLROUND(1);
+	.loc 1 39 2005 view .LVU631
+	movq	%rdx, 16(%rax)	# _187, MEM[(u64 *)v_1170(D) + 16B]
+	.loc 1 39 2054 is_stmt 1 view .LVU632
+.LVL111:
+.LBB903:
+.LBI903:
+	.loc 1 5 19 view .LVU633
+.LBB904:
+	.loc 1 5 46 view .LVU634
+# blake2b-generic.c:5: static inline u64 ror64(unsigned l, u64 x) { return (x >> l) | (x << (64-l)); }
+	.loc 1 5 62 is_stmt 0 view .LVU635
+	rolq	$32, %rcx	#, _1341
+.LVL112:
+	.loc 1 5 62 view .LVU636
+.LBE904:
+.LBE903:
+# blake2b-generic.c:39:     FULLROUND(1);
+	.loc 1 39 2102 view .LVU637
+	leaq	(%r14,%rcx), %r12	#, _189
+# blake2b-generic.c:39:     FULLROUND(1);
+	.loc 1 39 2062 view .LVU638
+	movq	%rcx, 104(%rax)	# _1341, MEM[(u64 *)v_1170(D) + 104B]
+	.loc 1 39 2094 is_stmt 1 view .LVU639
+# blake2b-generic.c:39:     FULLROUND(1);
+	.loc 1 39 2337 is_stmt 0 view .LVU640
+	movq	-48(%rsp), %r14	# %sfp, _1278
+# blake2b-generic.c:39:     FULLROUND(1);
+	.loc 1 39 2124 view .LVU641
+	xorq	%r12, %r11	# _189, tmp1759
+# blake2b-generic.c:39:     FULLROUND(1);
+	.loc 1 39 2102 view .LVU642
+	movq	%r12, 64(%rax)	# _189, MEM[(u64 *)v_1170(D) + 64B]
+	.loc 1 39 2114 is_stmt 1 view .LVU643
+.LVL113:
+.LBB905:
+.LBI905:
+	.loc 1 5 19 view .LVU644
+.LBB906:
+	.loc 1 5 46 view .LVU645
+# blake2b-generic.c:5: static inline u64 ror64(unsigned l, u64 x) { return (x >> l) | (x << (64-l)); }
+	.loc 1 5 62 is_stmt 0 view .LVU646
+	rorq	$24, %r11	#, _1344
+.LVL114:
+	.loc 1 5 62 view .LVU647
+.LBE906:
+.LBE905:
+# blake2b-generic.c:39:     FULLROUND(1);
+	.loc 1 39 2122 view .LVU648
+	movq	%r11, 56(%rax)	# _1344, MEM[(u64 *)v_1170(D) + 56B]
+	.loc 1 39 2154 is_stmt 1 view .LVU649
+# blake2b-generic.c:39:     FULLROUND(1);
+	.loc 1 39 2162 is_stmt 0 view .LVU650
+	addq	56(%r9), %rdx	# MEM[(const u64 *)m_1171(D) + 56B], tmp1760
+	addq	%r11, %rdx	# _1344, _193
+# blake2b-generic.c:39:     FULLROUND(1);
+	.loc 1 39 2221 view .LVU651
+	xorq	%rdx, %rcx	# _193, tmp1762
+# blake2b-generic.c:39:     FULLROUND(1);
+	.loc 1 39 2162 view .LVU652
+	movq	%rdx, 16(%rax)	# _193, MEM[(u64 *)v_1170(D) + 16B]
+	.loc 1 39 2211 is_stmt 1 view .LVU653
+.LVL115:
+.LBB907:
+.LBI907:
+	.loc 1 5 19 view .LVU654
+.LBB908:
+	.loc 1 5 46 view .LVU655
+# blake2b-generic.c:5: static inline u64 ror64(unsigned l, u64 x) { return (x >> l) | (x << (64-l)); }
+	.loc 1 5 62 is_stmt 0 view .LVU656
+	rorq	$16, %rcx	#, _1347
+.LVL116:
+	.loc 1 5 62 view .LVU657
+.LBE908:
+.LBE907:
+# blake2b-generic.c:39:     FULLROUND(1);
+	.loc 1 39 2259 view .LVU658
+	addq	%rcx, %r12	# _1347, _195
+# blake2b-generic.c:39:     FULLROUND(1);
+	.loc 1 39 2219 view .LVU659
+	movq	%rcx, 104(%rax)	# _1347, MEM[(u64 *)v_1170(D) + 104B]
+	.loc 1 39 2251 is_stmt 1 view .LVU660
+# blake2b-generic.c:39:     FULLROUND(1);
+	.loc 1 39 2281 is_stmt 0 view .LVU661
+	xorq	%r12, %r11	# _195, tmp1763
+# blake2b-generic.c:39:     FULLROUND(1);
+	.loc 1 39 2259 view .LVU662
+	movq	%r12, 64(%rax)	# _195, MEM[(u64 *)v_1170(D) + 64B]
+	.loc 1 39 2271 is_stmt 1 view .LVU663
+.LVL117:
+.LBB909:
+.LBI909:
+	.loc 1 5 19 view .LVU664
+.LBB910:
+	.loc 1 5 46 view .LVU665
+# blake2b-generic.c:5: static inline u64 ror64(unsigned l, u64 x) { return (x >> l) | (x << (64-l)); }
+	.loc 1 5 62 is_stmt 0 view .LVU666
+	rolq	%r11	# _1350
+.LVL118:
+	.loc 1 5 62 view .LVU667
+.LBE910:
+.LBE909:
+# blake2b-generic.c:39:     FULLROUND(1);
+	.loc 1 39 2279 view .LVU668
+	movq	%r11, 56(%rax)	# _1350, MEM[(u64 *)v_1170(D) + 56B]
+	.loc 1 39 1995 is_stmt 1 view .LVU669
+	.loc 1 39 2324 view .LVU670
+	.loc 1 39 2329 view .LVU671
+# blake2b-generic.c:39:     FULLROUND(1);
+	.loc 1 39 2337 is_stmt 0 view .LVU672
+	addq	40(%r9), %r10	# MEM[(const u64 *)m_1171(D) + 40B], tmp1764
+	addq	%r14, %r10	# _1278, _199
+# blake2b-generic.c:39:     FULLROUND(1);
+	.loc 1 39 2396 view .LVU673
+	xorq	%r10, %r13	# _199, tmp1766
+# blake2b-generic.c:39:     FULLROUND(1);
+	.loc 1 39 2337 view .LVU674
+	movq	%r10, 24(%rax)	# _199, MEM[(u64 *)v_1170(D) + 24B]
+	.loc 1 39 2386 is_stmt 1 view .LVU675
+.LVL119:
+.LBB911:
+.LBI911:
+	.loc 1 5 19 view .LVU676
+.LBB912:
+	.loc 1 5 46 view .LVU677
+# blake2b-generic.c:5: static inline u64 ror64(unsigned l, u64 x) { return (x >> l) | (x << (64-l)); }
+	.loc 1 5 62 is_stmt 0 view .LVU678
+	rolq	$32, %r13	#, _1353
+.LVL120:
+	.loc 1 5 62 view .LVU679
+.LBE912:
+.LBE911:
+# blake2b-generic.c:39:     FULLROUND(1);
+	.loc 1 39 2434 view .LVU680
+	addq	%r13, %r15	# _1353, _201
+# blake2b-generic.c:39:     FULLROUND(1);
+	.loc 1 39 2394 view .LVU681
+	movq	%r13, 112(%rax)	# _1353, MEM[(u64 *)v_1170(D) + 112B]
+	.loc 1 39 2426 is_stmt 1 view .LVU682
+# blake2b-generic.c:39:     FULLROUND(1);
+	.loc 1 39 2456 is_stmt 0 view .LVU683
+	xorq	%r15, %r14	# _201, _1278
+# blake2b-generic.c:39:     FULLROUND(1);
+	.loc 1 39 2434 view .LVU684
+	movq	%r15, 72(%rax)	# _201, MEM[(u64 *)v_1170(D) + 72B]
+	.loc 1 39 2446 is_stmt 1 view .LVU685
+.LVL121:
+.LBB913:
+.LBI913:
+	.loc 1 5 19 view .LVU686
+.LBB914:
+	.loc 1 5 46 view .LVU687
+# blake2b-generic.c:5: static inline u64 ror64(unsigned l, u64 x) { return (x >> l) | (x << (64-l)); }
+	.loc 1 5 62 is_stmt 0 view .LVU688
+	rorq	$24, %r14	#, _1356
+.LVL122:
+	.loc 1 5 62 view .LVU689
+.LBE914:
+.LBE913:
+# blake2b-generic.c:39:     FULLROUND(1);
+	.loc 1 39 2454 view .LVU690
+	movq	%r14, 32(%rax)	# _1356, MEM[(u64 *)v_1170(D) + 32B]
+	.loc 1 39 2486 is_stmt 1 view .LVU691
+# blake2b-generic.c:39:     FULLROUND(1);
+	.loc 1 39 2494 is_stmt 0 view .LVU692
+	addq	24(%r9), %r10	# MEM[(const u64 *)m_1171(D) + 24B], tmp1768
+	addq	%r14, %r10	# _1356, _205
+# blake2b-generic.c:39:     FULLROUND(1);
+	.loc 1 39 2553 view .LVU693
+	xorq	%r10, %r13	# _205, tmp1770
+# blake2b-generic.c:39:     FULLROUND(1);
+	.loc 1 39 2494 view .LVU694
+	movq	%r10, 24(%rax)	# _205, MEM[(u64 *)v_1170(D) + 24B]
+	.loc 1 39 2543 is_stmt 1 view .LVU695
+.LVL123:
+.LBB915:
+.LBI915:
+	.loc 1 5 19 view .LVU696
+.LBB916:
+	.loc 1 5 46 view .LVU697
+# blake2b-generic.c:5: static inline u64 ror64(unsigned l, u64 x) { return (x >> l) | (x << (64-l)); }
+	.loc 1 5 62 is_stmt 0 view .LVU698
+	rorq	$16, %r13	#, _1359
+.LVL124:
+	.loc 1 5 62 view .LVU699
+.LBE916:
+.LBE915:
+# blake2b-generic.c:39:     FULLROUND(1);
+	.loc 1 39 2591 view .LVU700
+	addq	%r13, %r15	# _1359, _207
+# blake2b-generic.c:39:     FULLROUND(1);
+	.loc 1 39 2551 view .LVU701
+	movq	%r13, 112(%rax)	# _1359, MEM[(u64 *)v_1170(D) + 112B]
+	.loc 1 39 2583 is_stmt 1 view .LVU702
+# blake2b-generic.c:39:     FULLROUND(1);
+	.loc 1 39 2613 is_stmt 0 view .LVU703
+	xorq	%r15, %r14	# _207, tmp1771
+# blake2b-generic.c:39:     FULLROUND(1);
+	.loc 1 39 2591 view .LVU704
+	movq	%r15, 72(%rax)	# _207, MEM[(u64 *)v_1170(D) + 72B]
+	.loc 1 39 2603 is_stmt 1 view .LVU705
+.LVL125:
+.LBB917:
+.LBI917:
+	.loc 1 5 19 view .LVU706
+.LBB918:
+	.loc 1 5 46 view .LVU707
+# blake2b-generic.c:5: static inline u64 ror64(unsigned l, u64 x) { return (x >> l) | (x << (64-l)); }
+	.loc 1 5 62 is_stmt 0 view .LVU708
+	rolq	%r14	# _1362
+.LVL126:
+	.loc 1 5 62 view .LVU709
+.LBE918:
+.LBE917:
+# blake2b-generic.c:39:     FULLROUND(1);
+	.loc 1 39 2611 view .LVU710
+	movq	%r14, 32(%rax)	# _1362, MEM[(u64 *)v_1170(D) + 32B]
+	.loc 1 39 2327 is_stmt 1 view .LVU711
+	.loc 1 39 8 view .LVU712
+	.loc 1 40 5 view .LVU713
+	.loc 1 40 10 view .LVU714
+	.loc 1 40 15 view .LVU715
+# blake2b-generic.c:40:     FULLROUND(2);
+	.loc 1 40 23 is_stmt 0 view .LVU716
+	addq	88(%r9), %r8	# MEM[(const u64 *)m_1171(D) + 88B], tmp1772
+	addq	%r14, %r8	# _1362, _211
+# blake2b-generic.c:40:     FULLROUND(2);
+	.loc 1 40 81 view .LVU717
+	xorq	%r8, %rdi	# _211, tmp1774
+# blake2b-generic.c:40:     FULLROUND(2);
+	.loc 1 40 23 view .LVU718
+	movq	%r8, (%rax)	# _211, *v_1170(D)
+	.loc 1 40 71 is_stmt 1 view .LVU719
+.LVL127:
+.LBB919:
+.LBI919:
+	.loc 1 5 19 view .LVU720
+.LBB920:
+	.loc 1 5 46 view .LVU721
+# blake2b-generic.c:5: static inline u64 ror64(unsigned l, u64 x) { return (x >> l) | (x << (64-l)); }
+	.loc 1 5 62 is_stmt 0 view .LVU722
+	rolq	$32, %rdi	#, _1365
+.LVL128:
+	.loc 1 5 62 view .LVU723
+.LBE920:
+.LBE919:
+# blake2b-generic.c:40:     FULLROUND(2);
+	.loc 1 40 119 view .LVU724
+	addq	%rdi, %r12	# _1365, _213
+# blake2b-generic.c:40:     FULLROUND(2);
+	.loc 1 40 79 view .LVU725
+	movq	%rdi, 96(%rax)	# _1365, MEM[(u64 *)v_1170(D) + 96B]
+	.loc 1 40 111 is_stmt 1 view .LVU726
+# blake2b-generic.c:40:     FULLROUND(2);
+	.loc 1 40 141 is_stmt 0 view .LVU727
+	xorq	%r12, %r14	# _213, tmp1775
+# blake2b-generic.c:40:     FULLROUND(2);
+	.loc 1 40 119 view .LVU728
+	movq	%r12, 64(%rax)	# _213, MEM[(u64 *)v_1170(D) + 64B]
+	.loc 1 40 131 is_stmt 1 view .LVU729
+.LVL129:
+.LBB921:
+.LBI921:
+	.loc 1 5 19 view .LVU730
+.LBB922:
+	.loc 1 5 46 view .LVU731
+# blake2b-generic.c:5: static inline u64 ror64(unsigned l, u64 x) { return (x >> l) | (x << (64-l)); }
+	.loc 1 5 62 is_stmt 0 view .LVU732
+	rorq	$24, %r14	#, _1368
+.LVL130:
+	.loc 1 5 62 view .LVU733
+.LBE922:
+.LBE921:
+# blake2b-generic.c:40:     FULLROUND(2);
+	.loc 1 40 139 view .LVU734
+	movq	%r14, 32(%rax)	# _1368, MEM[(u64 *)v_1170(D) + 32B]
+	.loc 1 40 171 is_stmt 1 view .LVU735
+# blake2b-generic.c:40:     FULLROUND(2);
+	.loc 1 40 179 is_stmt 0 view .LVU736
+	addq	64(%r9), %r8	# MEM[(const u64 *)m_1171(D) + 64B], tmp1776
+	addq	%r14, %r8	# _1368, _217
+# blake2b-generic.c:40:     FULLROUND(2);
+	.loc 1 40 237 view .LVU737
+	xorq	%r8, %rdi	# _217, tmp1778
+# blake2b-generic.c:40:     FULLROUND(2);
+	.loc 1 40 179 view .LVU738
+	movq	%r8, (%rax)	# _217, *v_1170(D)
+	.loc 1 40 227 is_stmt 1 view .LVU739
+.LVL131:
+.LBB923:
+.LBI923:
+	.loc 1 5 19 view .LVU740
+.LBB924:
+	.loc 1 5 46 view .LVU741
+# blake2b-generic.c:5: static inline u64 ror64(unsigned l, u64 x) { return (x >> l) | (x << (64-l)); }
+	.loc 1 5 62 is_stmt 0 view .LVU742
+	rorq	$16, %rdi	#, _1371
+.LVL132:
+	.loc 1 5 62 view .LVU743
+.LBE924:
+.LBE923:
+# blake2b-generic.c:40:     FULLROUND(2);
+	.loc 1 40 275 view .LVU744
+	addq	%rdi, %r12	# _1371, _219
+# blake2b-generic.c:40:     FULLROUND(2);
+	.loc 1 40 235 view .LVU745
+	movq	%rdi, 96(%rax)	# _1371, MEM[(u64 *)v_1170(D) + 96B]
+	.loc 1 40 267 is_stmt 1 view .LVU746
+# blake2b-generic.c:40:     FULLROUND(2);
+	.loc 1 40 297 is_stmt 0 view .LVU747
+	xorq	%r12, %r14	# _219, tmp1779
+# blake2b-generic.c:40:     FULLROUND(2);
+	.loc 1 40 275 view .LVU748
+	movq	%r12, 64(%rax)	# _219, MEM[(u64 *)v_1170(D) + 64B]
+	.loc 1 40 287 is_stmt 1 view .LVU749
+.LVL133:
+.LBB925:
+.LBI925:
+	.loc 1 5 19 view .LVU750
+.LBB926:
+	.loc 1 5 46 view .LVU751
+# blake2b-generic.c:5: static inline u64 ror64(unsigned l, u64 x) { return (x >> l) | (x << (64-l)); }
+	.loc 1 5 62 is_stmt 0 view .LVU752
+	rolq	%r14	# tmp1779
+.LBE926:
+.LBE925:
+# blake2b-generic.c:40:     FULLROUND(2);
+	.loc 1 40 297 view .LVU753
+	movq	%r12, -80(%rsp)	# _219, %sfp
+# blake2b-generic.c:40:     FULLROUND(2);
+	.loc 1 40 295 view .LVU754
+	movq	%r14, 32(%rax)	# _1374, MEM[(u64 *)v_1170(D) + 32B]
+	.loc 1 40 13 is_stmt 1 view .LVU755
+	.loc 1 40 340 view .LVU756
+	.loc 1 40 345 view .LVU757
+# blake2b-generic.c:40:     FULLROUND(2);
+	.loc 1 40 353 is_stmt 0 view .LVU758
+	addq	96(%r9), %rsi	# MEM[(const u64 *)m_1171(D) + 96B], tmp1780
+	addq	%rbp, %rsi	# _1326, _223
+# blake2b-generic.c:40:     FULLROUND(2);
+	.loc 1 40 295 view .LVU759
+	movq	%r14, -48(%rsp)	# _1374, %sfp
+# blake2b-generic.c:40:     FULLROUND(2);
+	.loc 1 40 411 view .LVU760
+	xorq	%rsi, %rcx	# _223, tmp1782
+# blake2b-generic.c:40:     FULLROUND(2);
+	.loc 1 40 353 view .LVU761
+	movq	%rsi, 8(%rax)	# _223, MEM[(u64 *)v_1170(D) + 8B]
+	.loc 1 40 401 is_stmt 1 view .LVU762
+.LVL134:
+.LBB927:
+.LBI927:
+	.loc 1 5 19 view .LVU763
+.LBB928:
+	.loc 1 5 46 view .LVU764
+# blake2b-generic.c:5: static inline u64 ror64(unsigned l, u64 x) { return (x >> l) | (x << (64-l)); }
+	.loc 1 5 62 is_stmt 0 view .LVU765
+	rolq	$32, %rcx	#, _1377
+.LVL135:
+	.loc 1 5 62 view .LVU766
+.LBE928:
+.LBE927:
+# blake2b-generic.c:40:     FULLROUND(2);
+	.loc 1 40 449 view .LVU767
+	addq	%rcx, %r15	# _1377, _225
+# blake2b-generic.c:40:     FULLROUND(2);
+	.loc 1 40 409 view .LVU768
+	movq	%rcx, 104(%rax)	# _1377, MEM[(u64 *)v_1170(D) + 104B]
+	.loc 1 40 441 is_stmt 1 view .LVU769
+# blake2b-generic.c:40:     FULLROUND(2);
+	.loc 1 40 471 is_stmt 0 view .LVU770
+	xorq	%r15, %rbp	# _225, tmp1783
+# blake2b-generic.c:40:     FULLROUND(2);
+	.loc 1 40 449 view .LVU771
+	movq	%r15, 72(%rax)	# _225, MEM[(u64 *)v_1170(D) + 72B]
+	.loc 1 40 461 is_stmt 1 view .LVU772
+.LVL136:
+.LBB929:
+.LBI929:
+	.loc 1 5 19 view .LVU773
+.LBB930:
+	.loc 1 5 46 view .LVU774
+# blake2b-generic.c:5: static inline u64 ror64(unsigned l, u64 x) { return (x >> l) | (x << (64-l)); }
+	.loc 1 5 62 is_stmt 0 view .LVU775
+	rorq	$24, %rbp	#, _1380
+.LVL137:
+	.loc 1 5 62 view .LVU776
+.LBE930:
+.LBE929:
+# blake2b-generic.c:40:     FULLROUND(2);
+	.loc 1 40 469 view .LVU777
+	movq	%rbp, 40(%rax)	# _1380, MEM[(u64 *)v_1170(D) + 40B]
+	.loc 1 40 501 is_stmt 1 view .LVU778
+# blake2b-generic.c:40:     FULLROUND(2);
+	.loc 1 40 509 is_stmt 0 view .LVU779
+	addq	(%r9), %rsi	# *m_1171(D), tmp1784
+	addq	%rbp, %rsi	# _1380, _229
+# blake2b-generic.c:40:     FULLROUND(2);
+	.loc 1 40 567 view .LVU780
+	xorq	%rsi, %rcx	# _229, tmp1786
+# blake2b-generic.c:40:     FULLROUND(2);
+	.loc 1 40 509 view .LVU781
+	movq	%rsi, 8(%rax)	# _229, MEM[(u64 *)v_1170(D) + 8B]
+	.loc 1 40 557 is_stmt 1 view .LVU782
+.LVL138:
+.LBB931:
+.LBI931:
+	.loc 1 5 19 view .LVU783
+.LBB932:
+	.loc 1 5 46 view .LVU784
+# blake2b-generic.c:5: static inline u64 ror64(unsigned l, u64 x) { return (x >> l) | (x << (64-l)); }
+	.loc 1 5 62 is_stmt 0 view .LVU785
+	rorq	$16, %rcx	#, _1383
+.LVL139:
+	.loc 1 5 62 view .LVU786
+.LBE932:
+.LBE931:
+# blake2b-generic.c:40:     FULLROUND(2);
+	.loc 1 40 605 view .LVU787
+	addq	%rcx, %r15	# _1383, _231
+# blake2b-generic.c:40:     FULLROUND(2);
+	.loc 1 40 565 view .LVU788
+	movq	%rcx, 104(%rax)	# _1383, MEM[(u64 *)v_1170(D) + 104B]
+	.loc 1 40 597 is_stmt 1 view .LVU789
+# blake2b-generic.c:40:     FULLROUND(2);
+	.loc 1 40 627 is_stmt 0 view .LVU790
+	xorq	%r15, %rbp	# _231, tmp1787
+# blake2b-generic.c:40:     FULLROUND(2);
+	.loc 1 40 605 view .LVU791
+	movq	%r15, 72(%rax)	# _231, MEM[(u64 *)v_1170(D) + 72B]
+	.loc 1 40 617 is_stmt 1 view .LVU792
+.LVL140:
+.LBB933:
+.LBI933:
+	.loc 1 5 19 view .LVU793
+.LBB934:
+	.loc 1 5 46 view .LVU794
+# blake2b-generic.c:5: static inline u64 ror64(unsigned l, u64 x) { return (x >> l) | (x << (64-l)); }
+	.loc 1 5 62 is_stmt 0 view .LVU795
+	rolq	%rbp	# _1386
+.LVL141:
+	.loc 1 5 62 view .LVU796
+.LBE934:
+.LBE933:
+# blake2b-generic.c:40:     FULLROUND(2);
+	.loc 1 40 627 view .LVU797
+	movq	%r15, -56(%rsp)	# _231, %sfp
+# blake2b-generic.c:40:     FULLROUND(2);
+	.loc 1 40 625 view .LVU798
+	movq	%rbp, 40(%rax)	# _1386, MEM[(u64 *)v_1170(D) + 40B]
+	.loc 1 40 343 is_stmt 1 view .LVU799
+	.loc 1 40 670 view .LVU800
+	.loc 1 40 675 view .LVU801
+# blake2b-generic.c:40:     FULLROUND(2);
+	.loc 1 40 683 is_stmt 0 view .LVU802
+	addq	40(%r9), %rdx	# MEM[(const u64 *)m_1171(D) + 40B], tmp1788
+	addq	%rbx, %rdx	# _1338, _235
+# blake2b-generic.c:40:     FULLROUND(2);
+	.loc 1 40 741 view .LVU803
+	xorq	%rdx, %r13	# _235, tmp1790
+# blake2b-generic.c:40:     FULLROUND(2);
+	.loc 1 40 683 view .LVU804
+	movq	%rdx, 16(%rax)	# _235, MEM[(u64 *)v_1170(D) + 16B]
+	.loc 1 40 731 is_stmt 1 view .LVU805
+.LVL142:
+.LBB935:
+.LBI935:
+	.loc 1 5 19 view .LVU806
+.LBB936:
+	.loc 1 5 46 view .LVU807
+# blake2b-generic.c:5: static inline u64 ror64(unsigned l, u64 x) { return (x >> l) | (x << (64-l)); }
+	.loc 1 5 62 is_stmt 0 view .LVU808
+	rolq	$32, %r13	#, _1389
+.LVL143:
+	.loc 1 5 62 view .LVU809
+.LBE936:
+.LBE935:
+# blake2b-generic.c:40:     FULLROUND(2);
+	.loc 1 40 739 view .LVU810
+	movq	%r13, 112(%rax)	# _1389, MEM[(u64 *)v_1170(D) + 112B]
+	.loc 1 40 771 is_stmt 1 view .LVU811
+# blake2b-generic.c:40:     FULLROUND(2);
+	.loc 1 40 779 is_stmt 0 view .LVU812
+	movq	-72(%rsp), %r15	# %sfp, _171
+# blake2b-generic.c:40:     FULLROUND(2);
+	.loc 1 40 1071 view .LVU813
+	movq	-40(%rsp), %r12	# %sfp, _1323
+# blake2b-generic.c:40:     FULLROUND(2);
+	.loc 1 40 779 view .LVU814
+	leaq	(%r15,%r13), %r14	#, _237
+# blake2b-generic.c:40:     FULLROUND(2);
+	.loc 1 40 1109 view .LVU815
+	movq	-64(%rsp), %r15	# %sfp, _183
+# blake2b-generic.c:40:     FULLROUND(2);
+	.loc 1 40 801 view .LVU816
+	xorq	%r14, %rbx	# _237, tmp1791
+# blake2b-generic.c:40:     FULLROUND(2);
+	.loc 1 40 779 view .LVU817
+	movq	%r14, 80(%rax)	# _237, MEM[(u64 *)v_1170(D) + 80B]
+	.loc 1 40 791 is_stmt 1 view .LVU818
+.LVL144:
+.LBB937:
+.LBI937:
+	.loc 1 5 19 view .LVU819
+.LBB938:
+	.loc 1 5 46 view .LVU820
+# blake2b-generic.c:5: static inline u64 ror64(unsigned l, u64 x) { return (x >> l) | (x << (64-l)); }
+	.loc 1 5 62 is_stmt 0 view .LVU821
+	rorq	$24, %rbx	#, _1392
+.LVL145:
+	.loc 1 5 62 view .LVU822
+.LBE938:
+.LBE937:
+# blake2b-generic.c:40:     FULLROUND(2);
+	.loc 1 40 799 view .LVU823
+	movq	%rbx, 48(%rax)	# _1392, MEM[(u64 *)v_1170(D) + 48B]
+	.loc 1 40 831 is_stmt 1 view .LVU824
+# blake2b-generic.c:40:     FULLROUND(2);
+	.loc 1 40 839 is_stmt 0 view .LVU825
+	addq	16(%r9), %rdx	# MEM[(const u64 *)m_1171(D) + 16B], tmp1792
+	addq	%rbx, %rdx	# _1392, _241
+# blake2b-generic.c:40:     FULLROUND(2);
+	.loc 1 40 897 view .LVU826
+	xorq	%rdx, %r13	# _241, tmp1794
+# blake2b-generic.c:40:     FULLROUND(2);
+	.loc 1 40 839 view .LVU827
+	movq	%rdx, 16(%rax)	# _241, MEM[(u64 *)v_1170(D) + 16B]
+	.loc 1 40 887 is_stmt 1 view .LVU828
+.LVL146:
+.LBB939:
+.LBI939:
+	.loc 1 5 19 view .LVU829
+.LBB940:
+	.loc 1 5 46 view .LVU830
+# blake2b-generic.c:5: static inline u64 ror64(unsigned l, u64 x) { return (x >> l) | (x << (64-l)); }
+	.loc 1 5 62 is_stmt 0 view .LVU831
+	rorq	$16, %r13	#, _1395
+.LVL147:
+	.loc 1 5 62 view .LVU832
+.LBE940:
+.LBE939:
+# blake2b-generic.c:40:     FULLROUND(2);
+	.loc 1 40 935 view .LVU833
+	addq	%r13, %r14	# _1395, _243
+# blake2b-generic.c:40:     FULLROUND(2);
+	.loc 1 40 895 view .LVU834
+	movq	%r13, 112(%rax)	# _1395, MEM[(u64 *)v_1170(D) + 112B]
+	.loc 1 40 927 is_stmt 1 view .LVU835
+# blake2b-generic.c:40:     FULLROUND(2);
+	.loc 1 40 957 is_stmt 0 view .LVU836
+	xorq	%r14, %rbx	# _243, tmp1795
+# blake2b-generic.c:40:     FULLROUND(2);
+	.loc 1 40 935 view .LVU837
+	movq	%r14, 80(%rax)	# _243, MEM[(u64 *)v_1170(D) + 80B]
+	.loc 1 40 947 is_stmt 1 view .LVU838
+.LVL148:
+.LBB941:
+.LBI941:
+	.loc 1 5 19 view .LVU839
+.LBB942:
+	.loc 1 5 46 view .LVU840
+# blake2b-generic.c:5: static inline u64 ror64(unsigned l, u64 x) { return (x >> l) | (x << (64-l)); }
+	.loc 1 5 62 is_stmt 0 view .LVU841
+	rolq	%rbx	# _1398
+.LVL149:
+	.loc 1 5 62 view .LVU842
+.LBE942:
+.LBE941:
+# blake2b-generic.c:40:     FULLROUND(2);
+	.loc 1 40 955 view .LVU843
+	movq	%rbx, 48(%rax)	# _1398, MEM[(u64 *)v_1170(D) + 48B]
+	.loc 1 40 673 is_stmt 1 view .LVU844
+	.loc 1 40 1000 view .LVU845
+	.loc 1 40 1005 view .LVU846
+# blake2b-generic.c:40:     FULLROUND(2);
+	.loc 1 40 1013 is_stmt 0 view .LVU847
+	addq	120(%r9), %r10	# MEM[(const u64 *)m_1171(D) + 120B], tmp1796
+	addq	%r11, %r10	# _1350, _247
+# blake2b-generic.c:40:     FULLROUND(2);
+	.loc 1 40 1071 view .LVU848
+	xorq	%r10, %r12	# _247, _1323
+# blake2b-generic.c:40:     FULLROUND(2);
+	.loc 1 40 1013 view .LVU849
+	movq	%r10, 24(%rax)	# _247, MEM[(u64 *)v_1170(D) + 24B]
+	.loc 1 40 1061 is_stmt 1 view .LVU850
+.LVL150:
+.LBB943:
+.LBI943:
+	.loc 1 5 19 view .LVU851
+.LBB944:
+	.loc 1 5 46 view .LVU852
+# blake2b-generic.c:5: static inline u64 ror64(unsigned l, u64 x) { return (x >> l) | (x << (64-l)); }
+	.loc 1 5 62 is_stmt 0 view .LVU853
+	rolq	$32, %r12	#, _1401
+.LVL151:
+	.loc 1 5 62 view .LVU854
+.LBE944:
+.LBE943:
+# blake2b-generic.c:40:     FULLROUND(2);
+	.loc 1 40 1109 view .LVU855
+	addq	%r12, %r15	# _1401, _249
+# blake2b-generic.c:40:     FULLROUND(2);
+	.loc 1 40 1069 view .LVU856
+	movq	%r12, 120(%rax)	# _1401, MEM[(u64 *)v_1170(D) + 120B]
+	.loc 1 40 1101 is_stmt 1 view .LVU857
+# blake2b-generic.c:40:     FULLROUND(2);
+	.loc 1 40 1131 is_stmt 0 view .LVU858
+	xorq	%r15, %r11	# _249, tmp1799
+# blake2b-generic.c:40:     FULLROUND(2);
+	.loc 1 40 1109 view .LVU859
+	movq	%r15, 88(%rax)	# _249, MEM[(u64 *)v_1170(D) + 88B]
+	.loc 1 40 1121 is_stmt 1 view .LVU860
+.LVL152:
+.LBB945:
+.LBI945:
+	.loc 1 5 19 view .LVU861
+.LBB946:
+	.loc 1 5 46 view .LVU862
+# blake2b-generic.c:5: static inline u64 ror64(unsigned l, u64 x) { return (x >> l) | (x << (64-l)); }
+	.loc 1 5 62 is_stmt 0 view .LVU863
+	rorq	$24, %r11	#, _1404
+.LVL153:
+	.loc 1 5 62 view .LVU864
+.LBE946:
+.LBE945:
+# blake2b-generic.c:40:     FULLROUND(2);
+	.loc 1 40 1129 view .LVU865
+	movq	%r11, 56(%rax)	# _1404, MEM[(u64 *)v_1170(D) + 56B]
+	.loc 1 40 1161 is_stmt 1 view .LVU866
+# blake2b-generic.c:40:     FULLROUND(2);
+	.loc 1 40 1169 is_stmt 0 view .LVU867
+	addq	104(%r9), %r10	# MEM[(const u64 *)m_1171(D) + 104B], tmp1800
+	addq	%r11, %r10	# _1404, _253
+# blake2b-generic.c:40:     FULLROUND(2);
+	.loc 1 40 1227 view .LVU868
+	xorq	%r10, %r12	# _253, tmp1802
+# blake2b-generic.c:40:     FULLROUND(2);
+	.loc 1 40 1169 view .LVU869
+	movq	%r10, 24(%rax)	# _253, MEM[(u64 *)v_1170(D) + 24B]
+	.loc 1 40 1217 is_stmt 1 view .LVU870
+.LVL154:
+.LBB947:
+.LBI947:
+	.loc 1 5 19 view .LVU871
+.LBB948:
+	.loc 1 5 46 view .LVU872
+# blake2b-generic.c:5: static inline u64 ror64(unsigned l, u64 x) { return (x >> l) | (x << (64-l)); }
+	.loc 1 5 62 is_stmt 0 view .LVU873
+	rorq	$16, %r12	#, _1407
+.LVL155:
+	.loc 1 5 62 view .LVU874
+.LBE948:
+.LBE947:
+# blake2b-generic.c:40:     FULLROUND(2);
+	.loc 1 40 1265 view .LVU875
+	addq	%r12, %r15	# _1407, _255
+# blake2b-generic.c:40:     FULLROUND(2);
+	.loc 1 40 1225 view .LVU876
+	movq	%r12, 120(%rax)	# _1407, MEM[(u64 *)v_1170(D) + 120B]
+	.loc 1 40 1257 is_stmt 1 view .LVU877
+# blake2b-generic.c:40:     FULLROUND(2);
+	.loc 1 40 1287 is_stmt 0 view .LVU878
+	xorq	%r15, %r11	# _255, tmp1803
+# blake2b-generic.c:40:     FULLROUND(2);
+	.loc 1 40 1265 view .LVU879
+	movq	%r15, 88(%rax)	# _255, MEM[(u64 *)v_1170(D) + 88B]
+	.loc 1 40 1277 is_stmt 1 view .LVU880
+.LVL156:
+.LBB949:
+.LBI949:
+	.loc 1 5 19 view .LVU881
+.LBB950:
+	.loc 1 5 46 view .LVU882
+# blake2b-generic.c:5: static inline u64 ror64(unsigned l, u64 x) { return (x >> l) | (x << (64-l)); }
+	.loc 1 5 62 is_stmt 0 view .LVU883
+	rolq	%r11	# _1410
+.LVL157:
+	.loc 1 5 62 view .LVU884
+.LBE950:
+.LBE949:
+# blake2b-generic.c:40:     FULLROUND(2);
+	.loc 1 40 1285 view .LVU885
+	movq	%r11, 56(%rax)	# _1410, MEM[(u64 *)v_1170(D) + 56B]
+	.loc 1 40 1003 is_stmt 1 view .LVU886
+	.loc 1 40 1330 view .LVU887
+	.loc 1 40 1335 view .LVU888
+# blake2b-generic.c:40:     FULLROUND(2);
+	.loc 1 40 1343 is_stmt 0 view .LVU889
+	addq	80(%r9), %r8	# MEM[(const u64 *)m_1171(D) + 80B], tmp1804
+	addq	%rbp, %r8	# _1386, _259
+# blake2b-generic.c:40:     FULLROUND(2);
+	.loc 1 40 1401 view .LVU890
+	xorq	%r8, %r12	# _259, tmp1806
+# blake2b-generic.c:40:     FULLROUND(2);
+	.loc 1 40 1343 view .LVU891
+	movq	%r8, (%rax)	# _259, *v_1170(D)
+	.loc 1 40 1391 is_stmt 1 view .LVU892
+.LVL158:
+.LBB951:
+.LBI951:
+	.loc 1 5 19 view .LVU893
+.LBB952:
+	.loc 1 5 46 view .LVU894
+# blake2b-generic.c:5: static inline u64 ror64(unsigned l, u64 x) { return (x >> l) | (x << (64-l)); }
+	.loc 1 5 62 is_stmt 0 view .LVU895
+	rolq	$32, %r12	#, _1413
+.LVL159:
+	.loc 1 5 62 view .LVU896
+.LBE952:
+.LBE951:
+# blake2b-generic.c:40:     FULLROUND(2);
+	.loc 1 40 1439 view .LVU897
+	addq	%r12, %r14	# _1413, _261
+# blake2b-generic.c:40:     FULLROUND(2);
+	.loc 1 40 1399 view .LVU898
+	movq	%r12, 120(%rax)	# _1413, MEM[(u64 *)v_1170(D) + 120B]
+	.loc 1 40 1431 is_stmt 1 view .LVU899
+# blake2b-generic.c:40:     FULLROUND(2);
+	.loc 1 40 1461 is_stmt 0 view .LVU900
+	xorq	%r14, %rbp	# _261, tmp1807
+# blake2b-generic.c:40:     FULLROUND(2);
+	.loc 1 40 1439 view .LVU901
+	movq	%r14, 80(%rax)	# _261, MEM[(u64 *)v_1170(D) + 80B]
+	.loc 1 40 1451 is_stmt 1 view .LVU902
+.LVL160:
+.LBB953:
+.LBI953:
+	.loc 1 5 19 view .LVU903
+.LBB954:
+	.loc 1 5 46 view .LVU904
+# blake2b-generic.c:5: static inline u64 ror64(unsigned l, u64 x) { return (x >> l) | (x << (64-l)); }
+	.loc 1 5 62 is_stmt 0 view .LVU905
+	rorq	$24, %rbp	#, _1416
+.LVL161:
+	.loc 1 5 62 view .LVU906
+.LBE954:
+.LBE953:
+# blake2b-generic.c:40:     FULLROUND(2);
+	.loc 1 40 1459 view .LVU907
+	movq	%rbp, 40(%rax)	# _1416, MEM[(u64 *)v_1170(D) + 40B]
+	.loc 1 40 1491 is_stmt 1 view .LVU908
+# blake2b-generic.c:40:     FULLROUND(2);
+	.loc 1 40 1499 is_stmt 0 view .LVU909
+	addq	112(%r9), %r8	# MEM[(const u64 *)m_1171(D) + 112B], tmp1808
+	addq	%rbp, %r8	# _1416, _265
+# blake2b-generic.c:40:     FULLROUND(2);
+	.loc 1 40 1557 view .LVU910
+	xorq	%r8, %r12	# _265, tmp1810
+# blake2b-generic.c:40:     FULLROUND(2);
+	.loc 1 40 1499 view .LVU911
+	movq	%r8, (%rax)	# _265, *v_1170(D)
+	.loc 1 40 1547 is_stmt 1 view .LVU912
+.LVL162:
+.LBB955:
+.LBI955:
+	.loc 1 5 19 view .LVU913
+.LBB956:
+	.loc 1 5 46 view .LVU914
+# blake2b-generic.c:5: static inline u64 ror64(unsigned l, u64 x) { return (x >> l) | (x << (64-l)); }
+	.loc 1 5 62 is_stmt 0 view .LVU915
+	rorq	$16, %r12	#, tmp1810
+.LBE956:
+.LBE955:
+# blake2b-generic.c:40:     FULLROUND(2);
+	.loc 1 40 1595 view .LVU916
+	addq	%r12, %r14	# _1419, _267
+	movq	%r12, -40(%rsp)	# _1419, %sfp
+# blake2b-generic.c:40:     FULLROUND(2);
+	.loc 1 40 1617 view .LVU917
+	xorq	%r14, %rbp	# _267, tmp1811
+	movq	%r14, -72(%rsp)	# _267, %sfp
+.LBB957:
+.LBB958:
+# blake2b-generic.c:5: static inline u64 ror64(unsigned l, u64 x) { return (x >> l) | (x << (64-l)); }
+	.loc 1 5 62 view .LVU918
+	rolq	%rbp	# _1422
+.LBE958:
+.LBE957:
+# blake2b-generic.c:40:     FULLROUND(2);
+	.loc 1 40 1555 view .LVU919
+	movq	%r12, 120(%rax)	# _1419, MEM[(u64 *)v_1170(D) + 120B]
+	.loc 1 40 1587 is_stmt 1 view .LVU920
+# blake2b-generic.c:40:     FULLROUND(2);
+	.loc 1 40 1595 is_stmt 0 view .LVU921
+	movq	%r14, 80(%rax)	# _267, MEM[(u64 *)v_1170(D) + 80B]
+	.loc 1 40 1607 is_stmt 1 view .LVU922
+.LVL163:
+.LBB960:
+.LBI957:
+	.loc 1 5 19 view .LVU923
+.LBB959:
+	.loc 1 5 46 view .LVU924
+	.loc 1 5 46 is_stmt 0 view .LVU925
+.LBE959:
+.LBE960:
+# blake2b-generic.c:40:     FULLROUND(2);
+	.loc 1 40 1615 view .LVU926
+	movq	%rbp, 40(%rax)	# _1422, MEM[(u64 *)v_1170(D) + 40B]
+	.loc 1 40 1333 is_stmt 1 view .LVU927
+	.loc 1 40 1660 view .LVU928
+	.loc 1 40 1665 view .LVU929
+# blake2b-generic.c:40:     FULLROUND(2);
+	.loc 1 40 1673 is_stmt 0 view .LVU930
+	addq	24(%r9), %rsi	# MEM[(const u64 *)m_1171(D) + 24B], tmp1812
+	addq	%rbx, %rsi	# _1398, _271
+# blake2b-generic.c:40:     FULLROUND(2);
+	.loc 1 40 2337 view .LVU931
+	movq	-48(%rsp), %r14	# %sfp, _1374
+# blake2b-generic.c:40:     FULLROUND(2);
+	.loc 1 40 1732 view .LVU932
+	xorq	%rsi, %rdi	# _271, tmp1814
+# blake2b-generic.c:40:     FULLROUND(2);
+	.loc 1 40 1673 view .LVU933
+	movq	%rsi, 8(%rax)	# _271, MEM[(u64 *)v_1170(D) + 8B]
+	.loc 1 40 1722 is_stmt 1 view .LVU934
+.LVL164:
+.LBB961:
+.LBI961:
+	.loc 1 5 19 view .LVU935
+.LBB962:
+	.loc 1 5 46 view .LVU936
+# blake2b-generic.c:5: static inline u64 ror64(unsigned l, u64 x) { return (x >> l) | (x << (64-l)); }
+	.loc 1 5 62 is_stmt 0 view .LVU937
+	rolq	$32, %rdi	#, _1425
+.LVL165:
+	.loc 1 5 62 view .LVU938
+.LBE962:
+.LBE961:
+# blake2b-generic.c:40:     FULLROUND(2);
+	.loc 1 40 1770 view .LVU939
+	addq	%rdi, %r15	# _1425, _273
+# blake2b-generic.c:40:     FULLROUND(2);
+	.loc 1 40 1730 view .LVU940
+	movq	%rdi, 96(%rax)	# _1425, MEM[(u64 *)v_1170(D) + 96B]
+	.loc 1 40 1762 is_stmt 1 view .LVU941
+# blake2b-generic.c:40:     FULLROUND(2);
+	.loc 1 40 1792 is_stmt 0 view .LVU942
+	xorq	%r15, %rbx	# _273, tmp1815
+# blake2b-generic.c:40:     FULLROUND(2);
+	.loc 1 40 1770 view .LVU943
+	movq	%r15, 88(%rax)	# _273, MEM[(u64 *)v_1170(D) + 88B]
+	.loc 1 40 1782 is_stmt 1 view .LVU944
+.LVL166:
+.LBB963:
+.LBI963:
+	.loc 1 5 19 view .LVU945
+.LBB964:
+	.loc 1 5 46 view .LVU946
+# blake2b-generic.c:5: static inline u64 ror64(unsigned l, u64 x) { return (x >> l) | (x << (64-l)); }
+	.loc 1 5 62 is_stmt 0 view .LVU947
+	rorq	$24, %rbx	#, _1428
+.LVL167:
+	.loc 1 5 62 view .LVU948
+.LBE964:
+.LBE963:
+# blake2b-generic.c:40:     FULLROUND(2);
+	.loc 1 40 1790 view .LVU949
+	movq	%rbx, 48(%rax)	# _1428, MEM[(u64 *)v_1170(D) + 48B]
+	.loc 1 40 1822 is_stmt 1 view .LVU950
+# blake2b-generic.c:40:     FULLROUND(2);
+	.loc 1 40 1830 is_stmt 0 view .LVU951
+	addq	48(%r9), %rsi	# MEM[(const u64 *)m_1171(D) + 48B], tmp1816
+	addq	%rbx, %rsi	# _1428, _277
+# blake2b-generic.c:40:     FULLROUND(2);
+	.loc 1 40 1889 view .LVU952
+	xorq	%rsi, %rdi	# _277, tmp1818
+# blake2b-generic.c:40:     FULLROUND(2);
+	.loc 1 40 1830 view .LVU953
+	movq	%rsi, 8(%rax)	# _277, MEM[(u64 *)v_1170(D) + 8B]
+	.loc 1 40 1879 is_stmt 1 view .LVU954
+.LVL168:
+.LBB965:
+.LBI965:
+	.loc 1 5 19 view .LVU955
+.LBB966:
+	.loc 1 5 46 view .LVU956
+# blake2b-generic.c:5: static inline u64 ror64(unsigned l, u64 x) { return (x >> l) | (x << (64-l)); }
+	.loc 1 5 62 is_stmt 0 view .LVU957
+	rorq	$16, %rdi	#, _1431
+.LVL169:
+	.loc 1 5 62 view .LVU958
+.LBE966:
+.LBE965:
+# blake2b-generic.c:40:     FULLROUND(2);
+	.loc 1 40 1927 view .LVU959
+	addq	%rdi, %r15	# _1431, _279
+# blake2b-generic.c:40:     FULLROUND(2);
+	.loc 1 40 1887 view .LVU960
+	movq	%rdi, 96(%rax)	# _1431, MEM[(u64 *)v_1170(D) + 96B]
+	.loc 1 40 1919 is_stmt 1 view .LVU961
+# blake2b-generic.c:40:     FULLROUND(2);
+	.loc 1 40 1949 is_stmt 0 view .LVU962
+	xorq	%r15, %rbx	# _279, tmp1819
+# blake2b-generic.c:40:     FULLROUND(2);
+	.loc 1 40 1927 view .LVU963
+	movq	%r15, 88(%rax)	# _279, MEM[(u64 *)v_1170(D) + 88B]
+	.loc 1 40 1939 is_stmt 1 view .LVU964
+.LVL170:
+.LBB967:
+.LBI967:
+	.loc 1 5 19 view .LVU965
+.LBB968:
+	.loc 1 5 46 view .LVU966
+# blake2b-generic.c:5: static inline u64 ror64(unsigned l, u64 x) { return (x >> l) | (x << (64-l)); }
+	.loc 1 5 62 is_stmt 0 view .LVU967
+	rolq	%rbx	# _1434
+.LVL171:
+	.loc 1 5 62 view .LVU968
+.LBE968:
+.LBE967:
+# blake2b-generic.c:40:     FULLROUND(2);
+	.loc 1 40 1949 view .LVU969
+	movq	%r15, -64(%rsp)	# _279, %sfp
+# blake2b-generic.c:40:     FULLROUND(2);
+	.loc 1 40 2102 view .LVU970
+	movq	-80(%rsp), %r15	# %sfp, _219
+# blake2b-generic.c:40:     FULLROUND(2);
+	.loc 1 40 1947 view .LVU971
+	movq	%rbx, 48(%rax)	# _1434, MEM[(u64 *)v_1170(D) + 48B]
+	.loc 1 40 1663 is_stmt 1 view .LVU972
+	.loc 1 40 1992 view .LVU973
+	.loc 1 40 1997 view .LVU974
+# blake2b-generic.c:40:     FULLROUND(2);
+	.loc 1 40 2005 is_stmt 0 view .LVU975
+	addq	56(%r9), %rdx	# MEM[(const u64 *)m_1171(D) + 56B], tmp1820
+	addq	%r11, %rdx	# _1410, _283
+# blake2b-generic.c:40:     FULLROUND(2);
+	.loc 1 40 2064 view .LVU976
+	xorq	%rdx, %rcx	# _283, tmp1822
+# blake2b-generic.c:40:     FULLROUND(2);
+	.loc 1 40 2005 view .LVU977
+	movq	%rdx, 16(%rax)	# _283, MEM[(u64 *)v_1170(D) + 16B]
+	.loc 1 40 2054 is_stmt 1 view .LVU978
+.LVL172:
+.LBB969:
+.LBI969:
+	.loc 1 5 19 view .LVU979
+.LBB970:
+	.loc 1 5 46 view .LVU980
+# blake2b-generic.c:5: static inline u64 ror64(unsigned l, u64 x) { return (x >> l) | (x << (64-l)); }
+	.loc 1 5 62 is_stmt 0 view .LVU981
+	rolq	$32, %rcx	#, _1437
+.LVL173:
+	.loc 1 5 62 view .LVU982
+.LBE970:
+.LBE969:
+# blake2b-generic.c:40:     FULLROUND(2);
+	.loc 1 40 2102 view .LVU983
+	leaq	(%r15,%rcx), %r12	#, _285
+# blake2b-generic.c:40:     FULLROUND(2);
+	.loc 1 40 2062 view .LVU984
+	movq	%rcx, 104(%rax)	# _1437, MEM[(u64 *)v_1170(D) + 104B]
+	.loc 1 40 2094 is_stmt 1 view .LVU985
+# blake2b-generic.c:40:     FULLROUND(2);
+	.loc 1 40 2434 is_stmt 0 view .LVU986
+	movq	-56(%rsp), %r15	# %sfp, _231
+# blake2b-generic.c:40:     FULLROUND(2);
+	.loc 1 40 2124 view .LVU987
+	xorq	%r12, %r11	# _285, tmp1823
+# blake2b-generic.c:40:     FULLROUND(2);
+	.loc 1 40 2102 view .LVU988
+	movq	%r12, 64(%rax)	# _285, MEM[(u64 *)v_1170(D) + 64B]
+	.loc 1 40 2114 is_stmt 1 view .LVU989
+.LVL174:
+.LBB971:
+.LBI971:
+	.loc 1 5 19 view .LVU990
+.LBB972:
+	.loc 1 5 46 view .LVU991
+# blake2b-generic.c:5: static inline u64 ror64(unsigned l, u64 x) { return (x >> l) | (x << (64-l)); }
+	.loc 1 5 62 is_stmt 0 view .LVU992
+	rorq	$24, %r11	#, _1440
+.LVL175:
+	.loc 1 5 62 view .LVU993
+.LBE972:
+.LBE971:
+# blake2b-generic.c:40:     FULLROUND(2);
+	.loc 1 40 2122 view .LVU994
+	movq	%r11, 56(%rax)	# _1440, MEM[(u64 *)v_1170(D) + 56B]
+	.loc 1 40 2154 is_stmt 1 view .LVU995
+# blake2b-generic.c:40:     FULLROUND(2);
+	.loc 1 40 2162 is_stmt 0 view .LVU996
+	addq	8(%r9), %rdx	# MEM[(const u64 *)m_1171(D) + 8B], tmp1824
+	addq	%r11, %rdx	# _1440, _289
+# blake2b-generic.c:40:     FULLROUND(2);
+	.loc 1 40 2221 view .LVU997
+	xorq	%rdx, %rcx	# _289, tmp1826
+# blake2b-generic.c:40:     FULLROUND(2);
+	.loc 1 40 2162 view .LVU998
+	movq	%rdx, 16(%rax)	# _289, MEM[(u64 *)v_1170(D) + 16B]
+	.loc 1 40 2211 is_stmt 1 view .LVU999
+.LVL176:
+.LBB973:
+.LBI973:
+	.loc 1 5 19 view .LVU1000
+.LBB974:
+	.loc 1 5 46 view .LVU1001
+# blake2b-generic.c:5: static inline u64 ror64(unsigned l, u64 x) { return (x >> l) | (x << (64-l)); }
+	.loc 1 5 62 is_stmt 0 view .LVU1002
+	rorq	$16, %rcx	#, _1443
+.LVL177:
+	.loc 1 5 62 view .LVU1003
+.LBE974:
+.LBE973:
+# blake2b-generic.c:40:     FULLROUND(2);
+	.loc 1 40 2259 view .LVU1004
+	addq	%rcx, %r12	# _1443, _291
+# blake2b-generic.c:40:     FULLROUND(2);
+	.loc 1 40 2219 view .LVU1005
+	movq	%rcx, 104(%rax)	# _1443, MEM[(u64 *)v_1170(D) + 104B]
+	.loc 1 40 2251 is_stmt 1 view .LVU1006
+# blake2b-generic.c:40:     FULLROUND(2);
+	.loc 1 40 2281 is_stmt 0 view .LVU1007
+	xorq	%r12, %r11	# _291, tmp1827
+# blake2b-generic.c:40:     FULLROUND(2);
+	.loc 1 40 2259 view .LVU1008
+	movq	%r12, 64(%rax)	# _291, MEM[(u64 *)v_1170(D) + 64B]
+	.loc 1 40 2271 is_stmt 1 view .LVU1009
+.LVL178:
+.LBB975:
+.LBI975:
+	.loc 1 5 19 view .LVU1010
+.LBB976:
+	.loc 1 5 46 view .LVU1011
+# blake2b-generic.c:5: static inline u64 ror64(unsigned l, u64 x) { return (x >> l) | (x << (64-l)); }
+	.loc 1 5 62 is_stmt 0 view .LVU1012
+	rolq	%r11	# _1446
+.LVL179:
+	.loc 1 5 62 view .LVU1013
+.LBE976:
+.LBE975:
+# blake2b-generic.c:40:     FULLROUND(2);
+	.loc 1 40 2279 view .LVU1014
+	movq	%r11, 56(%rax)	# _1446, MEM[(u64 *)v_1170(D) + 56B]
+	.loc 1 40 1995 is_stmt 1 view .LVU1015
+	.loc 1 40 2324 view .LVU1016
+	.loc 1 40 2329 view .LVU1017
+# blake2b-generic.c:40:     FULLROUND(2);
+	.loc 1 40 2337 is_stmt 0 view .LVU1018
+	addq	72(%r9), %r10	# MEM[(const u64 *)m_1171(D) + 72B], tmp1828
+	addq	%r14, %r10	# _1374, _295
+# blake2b-generic.c:40:     FULLROUND(2);
+	.loc 1 40 2396 view .LVU1019
+	xorq	%r10, %r13	# _295, tmp1830
+# blake2b-generic.c:40:     FULLROUND(2);
+	.loc 1 40 2337 view .LVU1020
+	movq	%r10, 24(%rax)	# _295, MEM[(u64 *)v_1170(D) + 24B]
+	.loc 1 40 2386 is_stmt 1 view .LVU1021
+.LVL180:
+.LBB977:
+.LBI977:
+	.loc 1 5 19 view .LVU1022
+.LBB978:
+	.loc 1 5 46 view .LVU1023
+# blake2b-generic.c:5: static inline u64 ror64(unsigned l, u64 x) { return (x >> l) | (x << (64-l)); }
+	.loc 1 5 62 is_stmt 0 view .LVU1024
+	rolq	$32, %r13	#, _1449
+.LVL181:
+	.loc 1 5 62 view .LVU1025
+.LBE978:
+.LBE977:
+# blake2b-generic.c:40:     FULLROUND(2);
+	.loc 1 40 2434 view .LVU1026
+	addq	%r13, %r15	# _1449, _297
+# blake2b-generic.c:40:     FULLROUND(2);
+	.loc 1 40 2394 view .LVU1027
+	movq	%r13, 112(%rax)	# _1449, MEM[(u64 *)v_1170(D) + 112B]
+	.loc 1 40 2426 is_stmt 1 view .LVU1028
+# blake2b-generic.c:40:     FULLROUND(2);
+	.loc 1 40 2456 is_stmt 0 view .LVU1029
+	xorq	%r15, %r14	# _297, _1374
+# blake2b-generic.c:40:     FULLROUND(2);
+	.loc 1 40 2434 view .LVU1030
+	movq	%r15, 72(%rax)	# _297, MEM[(u64 *)v_1170(D) + 72B]
+	.loc 1 40 2446 is_stmt 1 view .LVU1031
+.LVL182:
+.LBB979:
+.LBI979:
+	.loc 1 5 19 view .LVU1032
+.LBB980:
+	.loc 1 5 46 view .LVU1033
+# blake2b-generic.c:5: static inline u64 ror64(unsigned l, u64 x) { return (x >> l) | (x << (64-l)); }
+	.loc 1 5 62 is_stmt 0 view .LVU1034
+	rorq	$24, %r14	#, _1452
+.LVL183:
+	.loc 1 5 62 view .LVU1035
+.LBE980:
+.LBE979:
+# blake2b-generic.c:40:     FULLROUND(2);
+	.loc 1 40 2454 view .LVU1036
+	movq	%r14, 32(%rax)	# _1452, MEM[(u64 *)v_1170(D) + 32B]
+	.loc 1 40 2486 is_stmt 1 view .LVU1037
+# blake2b-generic.c:40:     FULLROUND(2);
+	.loc 1 40 2494 is_stmt 0 view .LVU1038
+	addq	32(%r9), %r10	# MEM[(const u64 *)m_1171(D) + 32B], tmp1832
+	addq	%r14, %r10	# _1452, _301
+# blake2b-generic.c:40:     FULLROUND(2);
+	.loc 1 40 2553 view .LVU1039
+	xorq	%r10, %r13	# _301, tmp1834
+# blake2b-generic.c:40:     FULLROUND(2);
+	.loc 1 40 2494 view .LVU1040
+	movq	%r10, 24(%rax)	# _301, MEM[(u64 *)v_1170(D) + 24B]
+	.loc 1 40 2543 is_stmt 1 view .LVU1041
+.LVL184:
+.LBB981:
+.LBI981:
+	.loc 1 5 19 view .LVU1042
+.LBB982:
+	.loc 1 5 46 view .LVU1043
+# blake2b-generic.c:5: static inline u64 ror64(unsigned l, u64 x) { return (x >> l) | (x << (64-l)); }
+	.loc 1 5 62 is_stmt 0 view .LVU1044
+	rorq	$16, %r13	#, _1455
+.LVL185:
+	.loc 1 5 62 view .LVU1045
+.LBE982:
+.LBE981:
+# blake2b-generic.c:40:     FULLROUND(2);
+	.loc 1 40 2591 view .LVU1046
+	addq	%r13, %r15	# _1455, _303
+# blake2b-generic.c:40:     FULLROUND(2);
+	.loc 1 40 2551 view .LVU1047
+	movq	%r13, 112(%rax)	# _1455, MEM[(u64 *)v_1170(D) + 112B]
+	.loc 1 40 2583 is_stmt 1 view .LVU1048
+# blake2b-generic.c:40:     FULLROUND(2);
+	.loc 1 40 2613 is_stmt 0 view .LVU1049
+	xorq	%r15, %r14	# _303, tmp1835
+# blake2b-generic.c:40:     FULLROUND(2);
+	.loc 1 40 2591 view .LVU1050
+	movq	%r15, 72(%rax)	# _303, MEM[(u64 *)v_1170(D) + 72B]
+	.loc 1 40 2603 is_stmt 1 view .LVU1051
+.LVL186:
+.LBB983:
+.LBI983:
+	.loc 1 5 19 view .LVU1052
+.LBB984:
+	.loc 1 5 46 view .LVU1053
+# blake2b-generic.c:5: static inline u64 ror64(unsigned l, u64 x) { return (x >> l) | (x << (64-l)); }
+	.loc 1 5 62 is_stmt 0 view .LVU1054
+	rolq	%r14	# _1458
+.LVL187:
+	.loc 1 5 62 view .LVU1055
+.LBE984:
+.LBE983:
+# blake2b-generic.c:40:     FULLROUND(2);
+	.loc 1 40 2611 view .LVU1056
+	movq	%r14, 32(%rax)	# _1458, MEM[(u64 *)v_1170(D) + 32B]
+	.loc 1 40 2327 is_stmt 1 view .LVU1057
+	.loc 1 40 8 view .LVU1058
+	.loc 1 41 5 view .LVU1059
+	.loc 1 41 10 view .LVU1060
+	.loc 1 41 15 view .LVU1061
+# blake2b-generic.c:41:     FULLROUND(3);
+	.loc 1 41 23 is_stmt 0 view .LVU1062
+	addq	56(%r9), %r8	# MEM[(const u64 *)m_1171(D) + 56B], tmp1836
+	addq	%r14, %r8	# _1458, _307
+# blake2b-generic.c:41:     FULLROUND(3);
+	.loc 1 41 81 view .LVU1063
+	xorq	%r8, %rdi	# _307, tmp1838
+# blake2b-generic.c:41:     FULLROUND(3);
+	.loc 1 41 23 view .LVU1064
+	movq	%r8, (%rax)	# _307, *v_1170(D)
+	.loc 1 41 71 is_stmt 1 view .LVU1065
+.LVL188:
+.LBB985:
+.LBI985:
+	.loc 1 5 19 view .LVU1066
+.LBB986:
+	.loc 1 5 46 view .LVU1067
+# blake2b-generic.c:5: static inline u64 ror64(unsigned l, u64 x) { return (x >> l) | (x << (64-l)); }
+	.loc 1 5 62 is_stmt 0 view .LVU1068
+	rolq	$32, %rdi	#, _1461
+.LVL189:
+	.loc 1 5 62 view .LVU1069
+.LBE986:
+.LBE985:
+# blake2b-generic.c:41:     FULLROUND(3);
+	.loc 1 41 119 view .LVU1070
+	addq	%rdi, %r12	# _1461, _309
+# blake2b-generic.c:41:     FULLROUND(3);
+	.loc 1 41 79 view .LVU1071
+	movq	%rdi, 96(%rax)	# _1461, MEM[(u64 *)v_1170(D) + 96B]
+	.loc 1 41 111 is_stmt 1 view .LVU1072
+# blake2b-generic.c:41:     FULLROUND(3);
+	.loc 1 41 141 is_stmt 0 view .LVU1073
+	xorq	%r12, %r14	# _309, tmp1839
+# blake2b-generic.c:41:     FULLROUND(3);
+	.loc 1 41 119 view .LVU1074
+	movq	%r12, 64(%rax)	# _309, MEM[(u64 *)v_1170(D) + 64B]
+	.loc 1 41 131 is_stmt 1 view .LVU1075
+.LVL190:
+.LBB987:
+.LBI987:
+	.loc 1 5 19 view .LVU1076
+.LBB988:
+	.loc 1 5 46 view .LVU1077
+# blake2b-generic.c:5: static inline u64 ror64(unsigned l, u64 x) { return (x >> l) | (x << (64-l)); }
+	.loc 1 5 62 is_stmt 0 view .LVU1078
+	rorq	$24, %r14	#, _1464
+.LVL191:
+	.loc 1 5 62 view .LVU1079
+.LBE988:
+.LBE987:
+# blake2b-generic.c:41:     FULLROUND(3);
+	.loc 1 41 139 view .LVU1080
+	movq	%r14, 32(%rax)	# _1464, MEM[(u64 *)v_1170(D) + 32B]
+	.loc 1 41 171 is_stmt 1 view .LVU1081
+# blake2b-generic.c:41:     FULLROUND(3);
+	.loc 1 41 179 is_stmt 0 view .LVU1082
+	addq	72(%r9), %r8	# MEM[(const u64 *)m_1171(D) + 72B], tmp1840
+	addq	%r14, %r8	# _1464, _313
+# blake2b-generic.c:41:     FULLROUND(3);
+	.loc 1 41 237 view .LVU1083
+	xorq	%r8, %rdi	# _313, tmp1842
+# blake2b-generic.c:41:     FULLROUND(3);
+	.loc 1 41 179 view .LVU1084
+	movq	%r8, (%rax)	# _313, *v_1170(D)
+	.loc 1 41 227 is_stmt 1 view .LVU1085
+.LVL192:
+.LBB989:
+.LBI989:
+	.loc 1 5 19 view .LVU1086
+.LBB990:
+	.loc 1 5 46 view .LVU1087
+# blake2b-generic.c:5: static inline u64 ror64(unsigned l, u64 x) { return (x >> l) | (x << (64-l)); }
+	.loc 1 5 62 is_stmt 0 view .LVU1088
+	rorq	$16, %rdi	#, _1467
+.LVL193:
+	.loc 1 5 62 view .LVU1089
+.LBE990:
+.LBE989:
+# blake2b-generic.c:41:     FULLROUND(3);
+	.loc 1 41 275 view .LVU1090
+	addq	%rdi, %r12	# _1467, _315
+# blake2b-generic.c:41:     FULLROUND(3);
+	.loc 1 41 235 view .LVU1091
+	movq	%rdi, 96(%rax)	# _1467, MEM[(u64 *)v_1170(D) + 96B]
+	.loc 1 41 267 is_stmt 1 view .LVU1092
+# blake2b-generic.c:41:     FULLROUND(3);
+	.loc 1 41 297 is_stmt 0 view .LVU1093
+	xorq	%r12, %r14	# _315, tmp1843
+# blake2b-generic.c:41:     FULLROUND(3);
+	.loc 1 41 275 view .LVU1094
+	movq	%r12, 64(%rax)	# _315, MEM[(u64 *)v_1170(D) + 64B]
+	.loc 1 41 287 is_stmt 1 view .LVU1095
+.LVL194:
+.LBB991:
+.LBI991:
+	.loc 1 5 19 view .LVU1096
+.LBB992:
+	.loc 1 5 46 view .LVU1097
+# blake2b-generic.c:5: static inline u64 ror64(unsigned l, u64 x) { return (x >> l) | (x << (64-l)); }
+	.loc 1 5 62 is_stmt 0 view .LVU1098
+	rolq	%r14	# tmp1843
+.LBE992:
+.LBE991:
+# blake2b-generic.c:41:     FULLROUND(3);
+	.loc 1 41 297 view .LVU1099
+	movq	%r12, -80(%rsp)	# _315, %sfp
+# blake2b-generic.c:41:     FULLROUND(3);
+	.loc 1 41 295 view .LVU1100
+	movq	%r14, 32(%rax)	# _1470, MEM[(u64 *)v_1170(D) + 32B]
+	.loc 1 41 13 is_stmt 1 view .LVU1101
+	.loc 1 41 340 view .LVU1102
+	.loc 1 41 345 view .LVU1103
+# blake2b-generic.c:41:     FULLROUND(3);
+	.loc 1 41 353 is_stmt 0 view .LVU1104
+	addq	24(%r9), %rsi	# MEM[(const u64 *)m_1171(D) + 24B], tmp1844
+	addq	%rbp, %rsi	# _1422, _319
+# blake2b-generic.c:41:     FULLROUND(3);
+	.loc 1 41 295 view .LVU1105
+	movq	%r14, -48(%rsp)	# _1470, %sfp
+# blake2b-generic.c:41:     FULLROUND(3);
+	.loc 1 41 411 view .LVU1106
+	xorq	%rsi, %rcx	# _319, tmp1846
+# blake2b-generic.c:41:     FULLROUND(3);
+	.loc 1 41 353 view .LVU1107
+	movq	%rsi, 8(%rax)	# _319, MEM[(u64 *)v_1170(D) + 8B]
+	.loc 1 41 401 is_stmt 1 view .LVU1108
+.LVL195:
+.LBB993:
+.LBI993:
+	.loc 1 5 19 view .LVU1109
+.LBB994:
+	.loc 1 5 46 view .LVU1110
+# blake2b-generic.c:5: static inline u64 ror64(unsigned l, u64 x) { return (x >> l) | (x << (64-l)); }
+	.loc 1 5 62 is_stmt 0 view .LVU1111
+	rolq	$32, %rcx	#, _1473
+.LVL196:
+	.loc 1 5 62 view .LVU1112
+.LBE994:
+.LBE993:
+# blake2b-generic.c:41:     FULLROUND(3);
+	.loc 1 41 449 view .LVU1113
+	addq	%rcx, %r15	# _1473, _321
+# blake2b-generic.c:41:     FULLROUND(3);
+	.loc 1 41 409 view .LVU1114
+	movq	%rcx, 104(%rax)	# _1473, MEM[(u64 *)v_1170(D) + 104B]
+	.loc 1 41 441 is_stmt 1 view .LVU1115
+# blake2b-generic.c:41:     FULLROUND(3);
+	.loc 1 41 471 is_stmt 0 view .LVU1116
+	xorq	%r15, %rbp	# _321, tmp1847
+# blake2b-generic.c:41:     FULLROUND(3);
+	.loc 1 41 449 view .LVU1117
+	movq	%r15, 72(%rax)	# _321, MEM[(u64 *)v_1170(D) + 72B]
+	.loc 1 41 461 is_stmt 1 view .LVU1118
+.LVL197:
+.LBB995:
+.LBI995:
+	.loc 1 5 19 view .LVU1119
+.LBB996:
+	.loc 1 5 46 view .LVU1120
+# blake2b-generic.c:5: static inline u64 ror64(unsigned l, u64 x) { return (x >> l) | (x << (64-l)); }
+	.loc 1 5 62 is_stmt 0 view .LVU1121
+	rorq	$24, %rbp	#, _1476
+.LVL198:
+	.loc 1 5 62 view .LVU1122
+.LBE996:
+.LBE995:
+# blake2b-generic.c:41:     FULLROUND(3);
+	.loc 1 41 469 view .LVU1123
+	movq	%rbp, 40(%rax)	# _1476, MEM[(u64 *)v_1170(D) + 40B]
+	.loc 1 41 501 is_stmt 1 view .LVU1124
+# blake2b-generic.c:41:     FULLROUND(3);
+	.loc 1 41 509 is_stmt 0 view .LVU1125
+	addq	8(%r9), %rsi	# MEM[(const u64 *)m_1171(D) + 8B], tmp1848
+	addq	%rbp, %rsi	# _1476, _325
+# blake2b-generic.c:41:     FULLROUND(3);
+	.loc 1 41 567 view .LVU1126
+	xorq	%rsi, %rcx	# _325, tmp1850
+# blake2b-generic.c:41:     FULLROUND(3);
+	.loc 1 41 509 view .LVU1127
+	movq	%rsi, 8(%rax)	# _325, MEM[(u64 *)v_1170(D) + 8B]
+	.loc 1 41 557 is_stmt 1 view .LVU1128
+.LVL199:
+.LBB997:
+.LBI997:
+	.loc 1 5 19 view .LVU1129
+.LBB998:
+	.loc 1 5 46 view .LVU1130
+# blake2b-generic.c:5: static inline u64 ror64(unsigned l, u64 x) { return (x >> l) | (x << (64-l)); }
+	.loc 1 5 62 is_stmt 0 view .LVU1131
+	rorq	$16, %rcx	#, _1479
+.LVL200:
+	.loc 1 5 62 view .LVU1132
+.LBE998:
+.LBE997:
+# blake2b-generic.c:41:     FULLROUND(3);
+	.loc 1 41 605 view .LVU1133
+	addq	%rcx, %r15	# _1479, _327
+# blake2b-generic.c:41:     FULLROUND(3);
+	.loc 1 41 565 view .LVU1134
+	movq	%rcx, 104(%rax)	# _1479, MEM[(u64 *)v_1170(D) + 104B]
+	.loc 1 41 597 is_stmt 1 view .LVU1135
+# blake2b-generic.c:41:     FULLROUND(3);
+	.loc 1 41 627 is_stmt 0 view .LVU1136
+	xorq	%r15, %rbp	# _327, tmp1851
+# blake2b-generic.c:41:     FULLROUND(3);
+	.loc 1 41 605 view .LVU1137
+	movq	%r15, 72(%rax)	# _327, MEM[(u64 *)v_1170(D) + 72B]
+	.loc 1 41 617 is_stmt 1 view .LVU1138
+.LVL201:
+.LBB999:
+.LBI999:
+	.loc 1 5 19 view .LVU1139
+.LBB1000:
+	.loc 1 5 46 view .LVU1140
+# blake2b-generic.c:5: static inline u64 ror64(unsigned l, u64 x) { return (x >> l) | (x << (64-l)); }
+	.loc 1 5 62 is_stmt 0 view .LVU1141
+	rolq	%rbp	# _1482
+.LVL202:
+	.loc 1 5 62 view .LVU1142
+.LBE1000:
+.LBE999:
+# blake2b-generic.c:41:     FULLROUND(3);
+	.loc 1 41 627 view .LVU1143
+	movq	%r15, -56(%rsp)	# _327, %sfp
+# blake2b-generic.c:41:     FULLROUND(3);
+	.loc 1 41 779 view .LVU1144
+	movq	-72(%rsp), %r15	# %sfp, _267
+# blake2b-generic.c:41:     FULLROUND(3);
+	.loc 1 41 625 view .LVU1145
+	movq	%rbp, 40(%rax)	# _1482, MEM[(u64 *)v_1170(D) + 40B]
+	.loc 1 41 343 is_stmt 1 view .LVU1146
+	.loc 1 41 670 view .LVU1147
+	.loc 1 41 675 view .LVU1148
+# blake2b-generic.c:41:     FULLROUND(3);
+	.loc 1 41 683 is_stmt 0 view .LVU1149
+	addq	104(%r9), %rdx	# MEM[(const u64 *)m_1171(D) + 104B], tmp1852
+	addq	%rbx, %rdx	# _1434, _331
+# blake2b-generic.c:41:     FULLROUND(3);
+	.loc 1 41 741 view .LVU1150
+	xorq	%rdx, %r13	# _331, tmp1854
+# blake2b-generic.c:41:     FULLROUND(3);
+	.loc 1 41 683 view .LVU1151
+	movq	%rdx, 16(%rax)	# _331, MEM[(u64 *)v_1170(D) + 16B]
+	.loc 1 41 731 is_stmt 1 view .LVU1152
+.LVL203:
+.LBB1001:
+.LBI1001:
+	.loc 1 5 19 view .LVU1153
+.LBB1002:
+	.loc 1 5 46 view .LVU1154
+# blake2b-generic.c:5: static inline u64 ror64(unsigned l, u64 x) { return (x >> l) | (x << (64-l)); }
+	.loc 1 5 62 is_stmt 0 view .LVU1155
+	rolq	$32, %r13	#, _1485
+.LVL204:
+	.loc 1 5 62 view .LVU1156
+.LBE1002:
+.LBE1001:
+# blake2b-generic.c:41:     FULLROUND(3);
+	.loc 1 41 779 view .LVU1157
+	leaq	(%r15,%r13), %r14	#, _333
+# blake2b-generic.c:41:     FULLROUND(3);
+	.loc 1 41 739 view .LVU1158
+	movq	%r13, 112(%rax)	# _1485, MEM[(u64 *)v_1170(D) + 112B]
+	.loc 1 41 771 is_stmt 1 view .LVU1159
+# blake2b-generic.c:41:     FULLROUND(3);
+	.loc 1 41 801 is_stmt 0 view .LVU1160
+	xorq	%r14, %rbx	# _333, tmp1855
+# blake2b-generic.c:41:     FULLROUND(3);
+	.loc 1 41 779 view .LVU1161
+	movq	%r14, 80(%rax)	# _333, MEM[(u64 *)v_1170(D) + 80B]
+	.loc 1 41 791 is_stmt 1 view .LVU1162
+.LVL205:
+.LBB1003:
+.LBI1003:
+	.loc 1 5 19 view .LVU1163
+.LBB1004:
+	.loc 1 5 46 view .LVU1164
+# blake2b-generic.c:5: static inline u64 ror64(unsigned l, u64 x) { return (x >> l) | (x << (64-l)); }
+	.loc 1 5 62 is_stmt 0 view .LVU1165
+	rorq	$24, %rbx	#, _1488
+.LVL206:
+	.loc 1 5 62 view .LVU1166
+.LBE1004:
+.LBE1003:
+# blake2b-generic.c:41:     FULLROUND(3);
+	.loc 1 41 799 view .LVU1167
+	movq	%rbx, 48(%rax)	# _1488, MEM[(u64 *)v_1170(D) + 48B]
+	.loc 1 41 831 is_stmt 1 view .LVU1168
+# blake2b-generic.c:41:     FULLROUND(3);
+	.loc 1 41 839 is_stmt 0 view .LVU1169
+	addq	96(%r9), %rdx	# MEM[(const u64 *)m_1171(D) + 96B], tmp1856
+	addq	%rbx, %rdx	# _1488, _337
+# blake2b-generic.c:41:     FULLROUND(3);
+	.loc 1 41 897 view .LVU1170
+	xorq	%rdx, %r13	# _337, tmp1858
+# blake2b-generic.c:41:     FULLROUND(3);
+	.loc 1 41 839 view .LVU1171
+	movq	%rdx, 16(%rax)	# _337, MEM[(u64 *)v_1170(D) + 16B]
+	.loc 1 41 887 is_stmt 1 view .LVU1172
+.LVL207:
+.LBB1005:
+.LBI1005:
+	.loc 1 5 19 view .LVU1173
+.LBB1006:
+	.loc 1 5 46 view .LVU1174
+# blake2b-generic.c:5: static inline u64 ror64(unsigned l, u64 x) { return (x >> l) | (x << (64-l)); }
+	.loc 1 5 62 is_stmt 0 view .LVU1175
+	rorq	$16, %r13	#, _1491
+.LVL208:
+	.loc 1 5 62 view .LVU1176
+.LBE1006:
+.LBE1005:
+# blake2b-generic.c:41:     FULLROUND(3);
+	.loc 1 41 935 view .LVU1177
+	addq	%r13, %r14	# _1491, _339
+# blake2b-generic.c:41:     FULLROUND(3);
+	.loc 1 41 895 view .LVU1178
+	movq	%r13, 112(%rax)	# _1491, MEM[(u64 *)v_1170(D) + 112B]
+	.loc 1 41 927 is_stmt 1 view .LVU1179
+# blake2b-generic.c:41:     FULLROUND(3);
+	.loc 1 41 1071 is_stmt 0 view .LVU1180
+	movq	-40(%rsp), %r12	# %sfp, _1419
+# blake2b-generic.c:41:     FULLROUND(3);
+	.loc 1 41 957 view .LVU1181
+	xorq	%r14, %rbx	# _339, tmp1859
+# blake2b-generic.c:41:     FULLROUND(3);
+	.loc 1 41 935 view .LVU1182
+	movq	%r14, 80(%rax)	# _339, MEM[(u64 *)v_1170(D) + 80B]
+	.loc 1 41 947 is_stmt 1 view .LVU1183
+.LVL209:
+.LBB1007:
+.LBI1007:
+	.loc 1 5 19 view .LVU1184
+.LBB1008:
+	.loc 1 5 46 view .LVU1185
+.LBE1008:
+.LBE1007:
+# blake2b-generic.c:41:     FULLROUND(3);
+	.loc 1 41 1109 is_stmt 0 view .LVU1186
+	movq	-64(%rsp), %r15	# %sfp, _279
+.LBB1010:
+.LBB1009:
+# blake2b-generic.c:5: static inline u64 ror64(unsigned l, u64 x) { return (x >> l) | (x << (64-l)); }
+	.loc 1 5 62 view .LVU1187
+	rolq	%rbx	# _1494
+.LVL210:
+	.loc 1 5 62 view .LVU1188
+.LBE1009:
+.LBE1010:
+# blake2b-generic.c:41:     FULLROUND(3);
+	.loc 1 41 955 view .LVU1189
+	movq	%rbx, 48(%rax)	# _1494, MEM[(u64 *)v_1170(D) + 48B]
+	.loc 1 41 673 is_stmt 1 view .LVU1190
+	.loc 1 41 1000 view .LVU1191
+	.loc 1 41 1005 view .LVU1192
+# blake2b-generic.c:41:     FULLROUND(3);
+	.loc 1 41 1013 is_stmt 0 view .LVU1193
+	addq	88(%r9), %r10	# MEM[(const u64 *)m_1171(D) + 88B], tmp1860
+	addq	%r11, %r10	# _1446, _343
+# blake2b-generic.c:41:     FULLROUND(3);
+	.loc 1 41 1071 view .LVU1194
+	xorq	%r10, %r12	# _343, _1419
+# blake2b-generic.c:41:     FULLROUND(3);
+	.loc 1 41 1013 view .LVU1195
+	movq	%r10, 24(%rax)	# _343, MEM[(u64 *)v_1170(D) + 24B]
+	.loc 1 41 1061 is_stmt 1 view .LVU1196
+.LVL211:
+.LBB1011:
+.LBI1011:
+	.loc 1 5 19 view .LVU1197
+.LBB1012:
+	.loc 1 5 46 view .LVU1198
+# blake2b-generic.c:5: static inline u64 ror64(unsigned l, u64 x) { return (x >> l) | (x << (64-l)); }
+	.loc 1 5 62 is_stmt 0 view .LVU1199
+	rolq	$32, %r12	#, _1497
+.LVL212:
+	.loc 1 5 62 view .LVU1200
+.LBE1012:
+.LBE1011:
+# blake2b-generic.c:41:     FULLROUND(3);
+	.loc 1 41 1109 view .LVU1201
+	addq	%r12, %r15	# _1497, _345
+# blake2b-generic.c:41:     FULLROUND(3);
+	.loc 1 41 1069 view .LVU1202
+	movq	%r12, 120(%rax)	# _1497, MEM[(u64 *)v_1170(D) + 120B]
+	.loc 1 41 1101 is_stmt 1 view .LVU1203
+# blake2b-generic.c:41:     FULLROUND(3);
+	.loc 1 41 1131 is_stmt 0 view .LVU1204
+	xorq	%r15, %r11	# _345, tmp1863
+# blake2b-generic.c:41:     FULLROUND(3);
+	.loc 1 41 1109 view .LVU1205
+	movq	%r15, 88(%rax)	# _345, MEM[(u64 *)v_1170(D) + 88B]
+	.loc 1 41 1121 is_stmt 1 view .LVU1206
+.LVL213:
+.LBB1013:
+.LBI1013:
+	.loc 1 5 19 view .LVU1207
+.LBB1014:
+	.loc 1 5 46 view .LVU1208
+# blake2b-generic.c:5: static inline u64 ror64(unsigned l, u64 x) { return (x >> l) | (x << (64-l)); }
+	.loc 1 5 62 is_stmt 0 view .LVU1209
+	rorq	$24, %r11	#, _1500
+.LVL214:
+	.loc 1 5 62 view .LVU1210
+.LBE1014:
+.LBE1013:
+# blake2b-generic.c:41:     FULLROUND(3);
+	.loc 1 41 1129 view .LVU1211
+	movq	%r11, 56(%rax)	# _1500, MEM[(u64 *)v_1170(D) + 56B]
+	.loc 1 41 1161 is_stmt 1 view .LVU1212
+# blake2b-generic.c:41:     FULLROUND(3);
+	.loc 1 41 1169 is_stmt 0 view .LVU1213
+	addq	112(%r9), %r10	# MEM[(const u64 *)m_1171(D) + 112B], tmp1864
+	addq	%r11, %r10	# _1500, _349
+# blake2b-generic.c:41:     FULLROUND(3);
+	.loc 1 41 1227 view .LVU1214
+	xorq	%r10, %r12	# _349, tmp1866
+# blake2b-generic.c:41:     FULLROUND(3);
+	.loc 1 41 1169 view .LVU1215
+	movq	%r10, 24(%rax)	# _349, MEM[(u64 *)v_1170(D) + 24B]
+	.loc 1 41 1217 is_stmt 1 view .LVU1216
+.LVL215:
+.LBB1015:
+.LBI1015:
+	.loc 1 5 19 view .LVU1217
+.LBB1016:
+	.loc 1 5 46 view .LVU1218
+# blake2b-generic.c:5: static inline u64 ror64(unsigned l, u64 x) { return (x >> l) | (x << (64-l)); }
+	.loc 1 5 62 is_stmt 0 view .LVU1219
+	rorq	$16, %r12	#, _1503
+.LVL216:
+	.loc 1 5 62 view .LVU1220
+.LBE1016:
+.LBE1015:
+# blake2b-generic.c:41:     FULLROUND(3);
+	.loc 1 41 1265 view .LVU1221
+	addq	%r12, %r15	# _1503, _351
+# blake2b-generic.c:41:     FULLROUND(3);
+	.loc 1 41 1225 view .LVU1222
+	movq	%r12, 120(%rax)	# _1503, MEM[(u64 *)v_1170(D) + 120B]
+	.loc 1 41 1257 is_stmt 1 view .LVU1223
+# blake2b-generic.c:41:     FULLROUND(3);
+	.loc 1 41 1287 is_stmt 0 view .LVU1224
+	xorq	%r15, %r11	# _351, tmp1867
+# blake2b-generic.c:41:     FULLROUND(3);
+	.loc 1 41 1265 view .LVU1225
+	movq	%r15, 88(%rax)	# _351, MEM[(u64 *)v_1170(D) + 88B]
+	.loc 1 41 1277 is_stmt 1 view .LVU1226
+.LVL217:
+.LBB1017:
+.LBI1017:
+	.loc 1 5 19 view .LVU1227
+.LBB1018:
+	.loc 1 5 46 view .LVU1228
+# blake2b-generic.c:5: static inline u64 ror64(unsigned l, u64 x) { return (x >> l) | (x << (64-l)); }
+	.loc 1 5 62 is_stmt 0 view .LVU1229
+	rolq	%r11	# _1506
+.LVL218:
+	.loc 1 5 62 view .LVU1230
+.LBE1018:
+.LBE1017:
+# blake2b-generic.c:41:     FULLROUND(3);
+	.loc 1 41 1285 view .LVU1231
+	movq	%r11, 56(%rax)	# _1506, MEM[(u64 *)v_1170(D) + 56B]
+	.loc 1 41 1003 is_stmt 1 view .LVU1232
+	.loc 1 41 1330 view .LVU1233
+	.loc 1 41 1335 view .LVU1234
+# blake2b-generic.c:41:     FULLROUND(3);
+	.loc 1 41 1343 is_stmt 0 view .LVU1235
+	addq	16(%r9), %r8	# MEM[(const u64 *)m_1171(D) + 16B], tmp1868
+	addq	%rbp, %r8	# _1482, _355
+# blake2b-generic.c:41:     FULLROUND(3);
+	.loc 1 41 1401 view .LVU1236
+	xorq	%r8, %r12	# _355, tmp1870
+# blake2b-generic.c:41:     FULLROUND(3);
+	.loc 1 41 1343 view .LVU1237
+	movq	%r8, (%rax)	# _355, *v_1170(D)
+	.loc 1 41 1391 is_stmt 1 view .LVU1238
+.LVL219:
+.LBB1019:
+.LBI1019:
+	.loc 1 5 19 view .LVU1239
+.LBB1020:
+	.loc 1 5 46 view .LVU1240
+# blake2b-generic.c:5: static inline u64 ror64(unsigned l, u64 x) { return (x >> l) | (x << (64-l)); }
+	.loc 1 5 62 is_stmt 0 view .LVU1241
+	rolq	$32, %r12	#, _1509
+.LVL220:
+	.loc 1 5 62 view .LVU1242
+.LBE1020:
+.LBE1019:
+# blake2b-generic.c:41:     FULLROUND(3);
+	.loc 1 41 1439 view .LVU1243
+	addq	%r12, %r14	# _1509, _357
+# blake2b-generic.c:41:     FULLROUND(3);
+	.loc 1 41 1399 view .LVU1244
+	movq	%r12, 120(%rax)	# _1509, MEM[(u64 *)v_1170(D) + 120B]
+	.loc 1 41 1431 is_stmt 1 view .LVU1245
+# blake2b-generic.c:41:     FULLROUND(3);
+	.loc 1 41 1461 is_stmt 0 view .LVU1246
+	xorq	%r14, %rbp	# _357, tmp1871
+# blake2b-generic.c:41:     FULLROUND(3);
+	.loc 1 41 1439 view .LVU1247
+	movq	%r14, 80(%rax)	# _357, MEM[(u64 *)v_1170(D) + 80B]
+	.loc 1 41 1451 is_stmt 1 view .LVU1248
+.LVL221:
+.LBB1021:
+.LBI1021:
+	.loc 1 5 19 view .LVU1249
+.LBB1022:
+	.loc 1 5 46 view .LVU1250
+# blake2b-generic.c:5: static inline u64 ror64(unsigned l, u64 x) { return (x >> l) | (x << (64-l)); }
+	.loc 1 5 62 is_stmt 0 view .LVU1251
+	rorq	$24, %rbp	#, _1512
+.LVL222:
+	.loc 1 5 62 view .LVU1252
+.LBE1022:
+.LBE1021:
+# blake2b-generic.c:41:     FULLROUND(3);
+	.loc 1 41 1459 view .LVU1253
+	movq	%rbp, 40(%rax)	# _1512, MEM[(u64 *)v_1170(D) + 40B]
+	.loc 1 41 1491 is_stmt 1 view .LVU1254
+# blake2b-generic.c:41:     FULLROUND(3);
+	.loc 1 41 1499 is_stmt 0 view .LVU1255
+	addq	48(%r9), %r8	# MEM[(const u64 *)m_1171(D) + 48B], tmp1872
+	addq	%rbp, %r8	# _1512, _361
+# blake2b-generic.c:41:     FULLROUND(3);
+	.loc 1 41 1557 view .LVU1256
+	xorq	%r8, %r12	# _361, tmp1874
+# blake2b-generic.c:41:     FULLROUND(3);
+	.loc 1 41 1499 view .LVU1257
+	movq	%r8, (%rax)	# _361, *v_1170(D)
+	.loc 1 41 1547 is_stmt 1 view .LVU1258
+.LVL223:
+.LBB1023:
+.LBI1023:
+	.loc 1 5 19 view .LVU1259
+.LBB1024:
+	.loc 1 5 46 view .LVU1260
+# blake2b-generic.c:5: static inline u64 ror64(unsigned l, u64 x) { return (x >> l) | (x << (64-l)); }
+	.loc 1 5 62 is_stmt 0 view .LVU1261
+	rorq	$16, %r12	#, tmp1874
+.LBE1024:
+.LBE1023:
+# blake2b-generic.c:41:     FULLROUND(3);
+	.loc 1 41 1595 view .LVU1262
+	addq	%r12, %r14	# _1515, _363
+# blake2b-generic.c:41:     FULLROUND(3);
+	.loc 1 41 1555 view .LVU1263
+	movq	%r12, 120(%rax)	# _1515, MEM[(u64 *)v_1170(D) + 120B]
+	.loc 1 41 1587 is_stmt 1 view .LVU1264
+# blake2b-generic.c:41:     FULLROUND(3);
+	.loc 1 41 1617 is_stmt 0 view .LVU1265
+	xorq	%r14, %rbp	# _363, tmp1875
+# blake2b-generic.c:41:     FULLROUND(3);
+	.loc 1 41 1595 view .LVU1266
+	movq	%r14, 80(%rax)	# _363, MEM[(u64 *)v_1170(D) + 80B]
+	.loc 1 41 1607 is_stmt 1 view .LVU1267
+.LVL224:
+.LBB1025:
+.LBI1025:
+	.loc 1 5 19 view .LVU1268
+.LBB1026:
+	.loc 1 5 46 view .LVU1269
+# blake2b-generic.c:5: static inline u64 ror64(unsigned l, u64 x) { return (x >> l) | (x << (64-l)); }
+	.loc 1 5 62 is_stmt 0 view .LVU1270
+	rolq	%rbp	# _1518
+.LVL225:
+	.loc 1 5 62 view .LVU1271
+.LBE1026:
+.LBE1025:
+# blake2b-generic.c:41:     FULLROUND(3);
+	.loc 1 41 1595 view .LVU1272
+	movq	%r12, -40(%rsp)	# _1515, %sfp
+# blake2b-generic.c:41:     FULLROUND(3);
+	.loc 1 41 1615 view .LVU1273
+	movq	%rbp, 40(%rax)	# _1518, MEM[(u64 *)v_1170(D) + 40B]
+	.loc 1 41 1333 is_stmt 1 view .LVU1274
+	.loc 1 41 1660 view .LVU1275
+	.loc 1 41 1665 view .LVU1276
+# blake2b-generic.c:41:     FULLROUND(3);
+	.loc 1 41 1673 is_stmt 0 view .LVU1277
+	addq	40(%r9), %rsi	# MEM[(const u64 *)m_1171(D) + 40B], tmp1876
+	addq	%rbx, %rsi	# _1494, _367
+# blake2b-generic.c:41:     FULLROUND(3);
+	.loc 1 41 1617 view .LVU1278
+	movq	%r14, -72(%rsp)	# _363, %sfp
+# blake2b-generic.c:41:     FULLROUND(3);
+	.loc 1 41 1732 view .LVU1279
+	xorq	%rsi, %rdi	# _367, tmp1878
+# blake2b-generic.c:41:     FULLROUND(3);
+	.loc 1 41 1673 view .LVU1280
+	movq	%rsi, 8(%rax)	# _367, MEM[(u64 *)v_1170(D) + 8B]
+	.loc 1 41 1722 is_stmt 1 view .LVU1281
+.LVL226:
+.LBB1027:
+.LBI1027:
+	.loc 1 5 19 view .LVU1282
+.LBB1028:
+	.loc 1 5 46 view .LVU1283
+# blake2b-generic.c:5: static inline u64 ror64(unsigned l, u64 x) { return (x >> l) | (x << (64-l)); }
+	.loc 1 5 62 is_stmt 0 view .LVU1284
+	rolq	$32, %rdi	#, _1521
+.LVL227:
+	.loc 1 5 62 view .LVU1285
+.LBE1028:
+.LBE1027:
+# blake2b-generic.c:41:     FULLROUND(3);
+	.loc 1 41 1770 view .LVU1286
+	addq	%rdi, %r15	# _1521, _369
+# blake2b-generic.c:41:     FULLROUND(3);
+	.loc 1 41 1730 view .LVU1287
+	movq	%rdi, 96(%rax)	# _1521, MEM[(u64 *)v_1170(D) + 96B]
+	.loc 1 41 1762 is_stmt 1 view .LVU1288
+# blake2b-generic.c:41:     FULLROUND(3);
+	.loc 1 41 1792 is_stmt 0 view .LVU1289
+	xorq	%r15, %rbx	# _369, tmp1879
+# blake2b-generic.c:41:     FULLROUND(3);
+	.loc 1 41 1770 view .LVU1290
+	movq	%r15, 88(%rax)	# _369, MEM[(u64 *)v_1170(D) + 88B]
+	.loc 1 41 1782 is_stmt 1 view .LVU1291
+.LVL228:
+.LBB1029:
+.LBI1029:
+	.loc 1 5 19 view .LVU1292
+.LBB1030:
+	.loc 1 5 46 view .LVU1293
+# blake2b-generic.c:5: static inline u64 ror64(unsigned l, u64 x) { return (x >> l) | (x << (64-l)); }
+	.loc 1 5 62 is_stmt 0 view .LVU1294
+	rorq	$24, %rbx	#, _1524
+.LVL229:
+	.loc 1 5 62 view .LVU1295
+.LBE1030:
+.LBE1029:
+# blake2b-generic.c:41:     FULLROUND(3);
+	.loc 1 41 1790 view .LVU1296
+	movq	%rbx, 48(%rax)	# _1524, MEM[(u64 *)v_1170(D) + 48B]
+	.loc 1 41 1822 is_stmt 1 view .LVU1297
+# blake2b-generic.c:41:     FULLROUND(3);
+	.loc 1 41 1830 is_stmt 0 view .LVU1298
+	addq	80(%r9), %rsi	# MEM[(const u64 *)m_1171(D) + 80B], tmp1880
+	addq	%rbx, %rsi	# _1524, _373
+# blake2b-generic.c:41:     FULLROUND(3);
+	.loc 1 41 1889 view .LVU1299
+	xorq	%rsi, %rdi	# _373, tmp1882
+# blake2b-generic.c:41:     FULLROUND(3);
+	.loc 1 41 1830 view .LVU1300
+	movq	%rsi, 8(%rax)	# _373, MEM[(u64 *)v_1170(D) + 8B]
+	.loc 1 41 1879 is_stmt 1 view .LVU1301
+.LVL230:
+.LBB1031:
+.LBI1031:
+	.loc 1 5 19 view .LVU1302
+.LBB1032:
+	.loc 1 5 46 view .LVU1303
+.LBE1032:
+.LBE1031:
+# blake2b-generic.c:41:     FULLROUND(3);
+	.loc 1 41 2337 is_stmt 0 view .LVU1304
+	movq	-48(%rsp), %r14	# %sfp, _1470
+.LBB1034:
+.LBB1033:
+# blake2b-generic.c:5: static inline u64 ror64(unsigned l, u64 x) { return (x >> l) | (x << (64-l)); }
+	.loc 1 5 62 view .LVU1305
+	rorq	$16, %rdi	#, _1527
+.LVL231:
+	.loc 1 5 62 view .LVU1306
+.LBE1033:
+.LBE1034:
+# blake2b-generic.c:41:     FULLROUND(3);
+	.loc 1 41 1927 view .LVU1307
+	addq	%rdi, %r15	# _1527, _375
+# blake2b-generic.c:41:     FULLROUND(3);
+	.loc 1 41 1887 view .LVU1308
+	movq	%rdi, 96(%rax)	# _1527, MEM[(u64 *)v_1170(D) + 96B]
+	.loc 1 41 1919 is_stmt 1 view .LVU1309
+# blake2b-generic.c:41:     FULLROUND(3);
+	.loc 1 41 1949 is_stmt 0 view .LVU1310
+	xorq	%r15, %rbx	# _375, tmp1883
+# blake2b-generic.c:41:     FULLROUND(3);
+	.loc 1 41 1927 view .LVU1311
+	movq	%r15, 88(%rax)	# _375, MEM[(u64 *)v_1170(D) + 88B]
+	.loc 1 41 1939 is_stmt 1 view .LVU1312
+.LVL232:
+.LBB1035:
+.LBI1035:
+	.loc 1 5 19 view .LVU1313
+.LBB1036:
+	.loc 1 5 46 view .LVU1314
+# blake2b-generic.c:5: static inline u64 ror64(unsigned l, u64 x) { return (x >> l) | (x << (64-l)); }
+	.loc 1 5 62 is_stmt 0 view .LVU1315
+	rolq	%rbx	# _1530
+.LVL233:
+	.loc 1 5 62 view .LVU1316
+.LBE1036:
+.LBE1035:
+# blake2b-generic.c:41:     FULLROUND(3);
+	.loc 1 41 1949 view .LVU1317
+	movq	%r15, -64(%rsp)	# _375, %sfp
+# blake2b-generic.c:41:     FULLROUND(3);
+	.loc 1 41 2102 view .LVU1318
+	movq	-80(%rsp), %r15	# %sfp, _315
+# blake2b-generic.c:41:     FULLROUND(3);
+	.loc 1 41 1947 view .LVU1319
+	movq	%rbx, 48(%rax)	# _1530, MEM[(u64 *)v_1170(D) + 48B]
+	.loc 1 41 1663 is_stmt 1 view .LVU1320
+	.loc 1 41 1992 view .LVU1321
+	.loc 1 41 1997 view .LVU1322
+# blake2b-generic.c:41:     FULLROUND(3);
+	.loc 1 41 2005 is_stmt 0 view .LVU1323
+	addq	32(%r9), %rdx	# MEM[(const u64 *)m_1171(D) + 32B], tmp1884
+	addq	%r11, %rdx	# _1506, _379
+# blake2b-generic.c:41:     FULLROUND(3);
+	.loc 1 41 2064 view .LVU1324
+	xorq	%rdx, %rcx	# _379, tmp1886
+# blake2b-generic.c:41:     FULLROUND(3);
+	.loc 1 41 2005 view .LVU1325
+	movq	%rdx, 16(%rax)	# _379, MEM[(u64 *)v_1170(D) + 16B]
+	.loc 1 41 2054 is_stmt 1 view .LVU1326
+.LVL234:
+.LBB1037:
+.LBI1037:
+	.loc 1 5 19 view .LVU1327
+.LBB1038:
+	.loc 1 5 46 view .LVU1328
+# blake2b-generic.c:5: static inline u64 ror64(unsigned l, u64 x) { return (x >> l) | (x << (64-l)); }
+	.loc 1 5 62 is_stmt 0 view .LVU1329
+	rolq	$32, %rcx	#, _1533
+.LVL235:
+	.loc 1 5 62 view .LVU1330
+.LBE1038:
+.LBE1037:
+# blake2b-generic.c:41:     FULLROUND(3);
+	.loc 1 41 2102 view .LVU1331
+	leaq	(%r15,%rcx), %r12	#, _381
+# blake2b-generic.c:41:     FULLROUND(3);
+	.loc 1 41 2062 view .LVU1332
+	movq	%rcx, 104(%rax)	# _1533, MEM[(u64 *)v_1170(D) + 104B]
+	.loc 1 41 2094 is_stmt 1 view .LVU1333
+# blake2b-generic.c:41:     FULLROUND(3);
+	.loc 1 41 2434 is_stmt 0 view .LVU1334
+	movq	-56(%rsp), %r15	# %sfp, _327
+# blake2b-generic.c:41:     FULLROUND(3);
+	.loc 1 41 2124 view .LVU1335
+	xorq	%r12, %r11	# _381, tmp1887
+# blake2b-generic.c:41:     FULLROUND(3);
+	.loc 1 41 2102 view .LVU1336
+	movq	%r12, 64(%rax)	# _381, MEM[(u64 *)v_1170(D) + 64B]
+	.loc 1 41 2114 is_stmt 1 view .LVU1337
+.LVL236:
+.LBB1039:
+.LBI1039:
+	.loc 1 5 19 view .LVU1338
+.LBB1040:
+	.loc 1 5 46 view .LVU1339
+# blake2b-generic.c:5: static inline u64 ror64(unsigned l, u64 x) { return (x >> l) | (x << (64-l)); }
+	.loc 1 5 62 is_stmt 0 view .LVU1340
+	rorq	$24, %r11	#, _1536
+.LVL237:
+	.loc 1 5 62 view .LVU1341
+.LBE1040:
+.LBE1039:
+# blake2b-generic.c:41:     FULLROUND(3);
+	.loc 1 41 2122 view .LVU1342
+	movq	%r11, 56(%rax)	# _1536, MEM[(u64 *)v_1170(D) + 56B]
+	.loc 1 41 2154 is_stmt 1 view .LVU1343
+# blake2b-generic.c:41:     FULLROUND(3);
+	.loc 1 41 2162 is_stmt 0 view .LVU1344
+	addq	(%r9), %rdx	# *m_1171(D), tmp1888
+	addq	%r11, %rdx	# _1536, _385
+# blake2b-generic.c:41:     FULLROUND(3);
+	.loc 1 41 2221 view .LVU1345
+	xorq	%rdx, %rcx	# _385, tmp1890
+# blake2b-generic.c:41:     FULLROUND(3);
+	.loc 1 41 2162 view .LVU1346
+	movq	%rdx, 16(%rax)	# _385, MEM[(u64 *)v_1170(D) + 16B]
+	.loc 1 41 2211 is_stmt 1 view .LVU1347
+.LVL238:
+.LBB1041:
+.LBI1041:
+	.loc 1 5 19 view .LVU1348
+.LBB1042:
+	.loc 1 5 46 view .LVU1349
+# blake2b-generic.c:5: static inline u64 ror64(unsigned l, u64 x) { return (x >> l) | (x << (64-l)); }
+	.loc 1 5 62 is_stmt 0 view .LVU1350
+	rorq	$16, %rcx	#, _1539
+.LVL239:
+	.loc 1 5 62 view .LVU1351
+.LBE1042:
+.LBE1041:
+# blake2b-generic.c:41:     FULLROUND(3);
+	.loc 1 41 2259 view .LVU1352
+	addq	%rcx, %r12	# _1539, _387
+# blake2b-generic.c:41:     FULLROUND(3);
+	.loc 1 41 2219 view .LVU1353
+	movq	%rcx, 104(%rax)	# _1539, MEM[(u64 *)v_1170(D) + 104B]
+	.loc 1 41 2251 is_stmt 1 view .LVU1354
+# blake2b-generic.c:41:     FULLROUND(3);
+	.loc 1 41 2281 is_stmt 0 view .LVU1355
+	xorq	%r12, %r11	# _387, tmp1891
+# blake2b-generic.c:41:     FULLROUND(3);
+	.loc 1 41 2259 view .LVU1356
+	movq	%r12, 64(%rax)	# _387, MEM[(u64 *)v_1170(D) + 64B]
+	.loc 1 41 2271 is_stmt 1 view .LVU1357
+.LVL240:
+.LBB1043:
+.LBI1043:
+	.loc 1 5 19 view .LVU1358
+.LBB1044:
+	.loc 1 5 46 view .LVU1359
+# blake2b-generic.c:5: static inline u64 ror64(unsigned l, u64 x) { return (x >> l) | (x << (64-l)); }
+	.loc 1 5 62 is_stmt 0 view .LVU1360
+	rolq	%r11	# _1542
+.LVL241:
+	.loc 1 5 62 view .LVU1361
+.LBE1044:
+.LBE1043:
+# blake2b-generic.c:41:     FULLROUND(3);
+	.loc 1 41 2279 view .LVU1362
+	movq	%r11, 56(%rax)	# _1542, MEM[(u64 *)v_1170(D) + 56B]
+	.loc 1 41 1995 is_stmt 1 view .LVU1363
+	.loc 1 41 2324 view .LVU1364
+	.loc 1 41 2329 view .LVU1365
+# blake2b-generic.c:41:     FULLROUND(3);
+	.loc 1 41 2337 is_stmt 0 view .LVU1366
+	addq	120(%r9), %r10	# MEM[(const u64 *)m_1171(D) + 120B], tmp1892
+	addq	%r14, %r10	# _1470, _391
+# blake2b-generic.c:41:     FULLROUND(3);
+	.loc 1 41 2396 view .LVU1367
+	xorq	%r10, %r13	# _391, tmp1894
+# blake2b-generic.c:41:     FULLROUND(3);
+	.loc 1 41 2337 view .LVU1368
+	movq	%r10, 24(%rax)	# _391, MEM[(u64 *)v_1170(D) + 24B]
+	.loc 1 41 2386 is_stmt 1 view .LVU1369
+.LVL242:
+.LBB1045:
+.LBI1045:
+	.loc 1 5 19 view .LVU1370
+.LBB1046:
+	.loc 1 5 46 view .LVU1371
+# blake2b-generic.c:5: static inline u64 ror64(unsigned l, u64 x) { return (x >> l) | (x << (64-l)); }
+	.loc 1 5 62 is_stmt 0 view .LVU1372
+	rolq	$32, %r13	#, _1545
+.LVL243:
+	.loc 1 5 62 view .LVU1373
+.LBE1046:
+.LBE1045:
+# blake2b-generic.c:41:     FULLROUND(3);
+	.loc 1 41 2434 view .LVU1374
+	addq	%r13, %r15	# _1545, _393
+# blake2b-generic.c:41:     FULLROUND(3);
+	.loc 1 41 2394 view .LVU1375
+	movq	%r13, 112(%rax)	# _1545, MEM[(u64 *)v_1170(D) + 112B]
+	.loc 1 41 2426 is_stmt 1 view .LVU1376
+# blake2b-generic.c:41:     FULLROUND(3);
+	.loc 1 41 2456 is_stmt 0 view .LVU1377
+	xorq	%r15, %r14	# _393, _1470
+# blake2b-generic.c:41:     FULLROUND(3);
+	.loc 1 41 2434 view .LVU1378
+	movq	%r15, 72(%rax)	# _393, MEM[(u64 *)v_1170(D) + 72B]
+	.loc 1 41 2446 is_stmt 1 view .LVU1379
+.LVL244:
+.LBB1047:
+.LBI1047:
+	.loc 1 5 19 view .LVU1380
+.LBB1048:
+	.loc 1 5 46 view .LVU1381
+# blake2b-generic.c:5: static inline u64 ror64(unsigned l, u64 x) { return (x >> l) | (x << (64-l)); }
+	.loc 1 5 62 is_stmt 0 view .LVU1382
+	rorq	$24, %r14	#, _1548
+.LVL245:
+	.loc 1 5 62 view .LVU1383
+.LBE1048:
+.LBE1047:
+# blake2b-generic.c:41:     FULLROUND(3);
+	.loc 1 41 2454 view .LVU1384
+	movq	%r14, 32(%rax)	# _1548, MEM[(u64 *)v_1170(D) + 32B]
+	.loc 1 41 2486 is_stmt 1 view .LVU1385
+# blake2b-generic.c:41:     FULLROUND(3);
+	.loc 1 41 2494 is_stmt 0 view .LVU1386
+	addq	64(%r9), %r10	# MEM[(const u64 *)m_1171(D) + 64B], tmp1896
+	addq	%r14, %r10	# _1548, _397
+# blake2b-generic.c:41:     FULLROUND(3);
+	.loc 1 41 2553 view .LVU1387
+	xorq	%r10, %r13	# _397, tmp1898
+# blake2b-generic.c:41:     FULLROUND(3);
+	.loc 1 41 2494 view .LVU1388
+	movq	%r10, 24(%rax)	# _397, MEM[(u64 *)v_1170(D) + 24B]
+	.loc 1 41 2543 is_stmt 1 view .LVU1389
+.LVL246:
+.LBB1049:
+.LBI1049:
+	.loc 1 5 19 view .LVU1390
+.LBB1050:
+	.loc 1 5 46 view .LVU1391
+# blake2b-generic.c:5: static inline u64 ror64(unsigned l, u64 x) { return (x >> l) | (x << (64-l)); }
+	.loc 1 5 62 is_stmt 0 view .LVU1392
+	rorq	$16, %r13	#, _1551
+.LVL247:
+	.loc 1 5 62 view .LVU1393
+.LBE1050:
+.LBE1049:
+# blake2b-generic.c:41:     FULLROUND(3);
+	.loc 1 41 2591 view .LVU1394
+	addq	%r13, %r15	# _1551, _399
+# blake2b-generic.c:41:     FULLROUND(3);
+	.loc 1 41 2551 view .LVU1395
+	movq	%r13, 112(%rax)	# _1551, MEM[(u64 *)v_1170(D) + 112B]
+	.loc 1 41 2583 is_stmt 1 view .LVU1396
+# blake2b-generic.c:41:     FULLROUND(3);
+	.loc 1 41 2613 is_stmt 0 view .LVU1397
+	xorq	%r15, %r14	# _399, tmp1899
+# blake2b-generic.c:41:     FULLROUND(3);
+	.loc 1 41 2591 view .LVU1398
+	movq	%r15, 72(%rax)	# _399, MEM[(u64 *)v_1170(D) + 72B]
+	.loc 1 41 2603 is_stmt 1 view .LVU1399
+.LVL248:
+.LBB1051:
+.LBI1051:
+	.loc 1 5 19 view .LVU1400
+.LBB1052:
+	.loc 1 5 46 view .LVU1401
+# blake2b-generic.c:5: static inline u64 ror64(unsigned l, u64 x) { return (x >> l) | (x << (64-l)); }
+	.loc 1 5 62 is_stmt 0 view .LVU1402
+	rolq	%r14	# _1554
+.LVL249:
+	.loc 1 5 62 view .LVU1403
+.LBE1052:
+.LBE1051:
+# blake2b-generic.c:41:     FULLROUND(3);
+	.loc 1 41 2611 view .LVU1404
+	movq	%r14, 32(%rax)	# _1554, MEM[(u64 *)v_1170(D) + 32B]
+	.loc 1 41 2327 is_stmt 1 view .LVU1405
+	.loc 1 41 8 view .LVU1406
+	.loc 1 42 5 view .LVU1407
+	.loc 1 42 10 view .LVU1408
+	.loc 1 42 15 view .LVU1409
+# blake2b-generic.c:42:     FULLROUND(4);
+	.loc 1 42 23 is_stmt 0 view .LVU1410
+	addq	72(%r9), %r8	# MEM[(const u64 *)m_1171(D) + 72B], tmp1900
+	addq	%r14, %r8	# _1554, _403
+# blake2b-generic.c:42:     FULLROUND(4);
+	.loc 1 42 81 view .LVU1411
+	xorq	%r8, %rdi	# _403, tmp1902
+# blake2b-generic.c:42:     FULLROUND(4);
+	.loc 1 42 23 view .LVU1412
+	movq	%r8, (%rax)	# _403, *v_1170(D)
+	.loc 1 42 71 is_stmt 1 view .LVU1413
+.LVL250:
+.LBB1053:
+.LBI1053:
+	.loc 1 5 19 view .LVU1414
+.LBB1054:
+	.loc 1 5 46 view .LVU1415
+# blake2b-generic.c:5: static inline u64 ror64(unsigned l, u64 x) { return (x >> l) | (x << (64-l)); }
+	.loc 1 5 62 is_stmt 0 view .LVU1416
+	rolq	$32, %rdi	#, _1557
+.LVL251:
+	.loc 1 5 62 view .LVU1417
+.LBE1054:
+.LBE1053:
+# blake2b-generic.c:42:     FULLROUND(4);
+	.loc 1 42 119 view .LVU1418
+	addq	%rdi, %r12	# _1557, _405
+# blake2b-generic.c:42:     FULLROUND(4);
+	.loc 1 42 79 view .LVU1419
+	movq	%rdi, 96(%rax)	# _1557, MEM[(u64 *)v_1170(D) + 96B]
+	.loc 1 42 111 is_stmt 1 view .LVU1420
+# blake2b-generic.c:42:     FULLROUND(4);
+	.loc 1 42 141 is_stmt 0 view .LVU1421
+	xorq	%r12, %r14	# _405, tmp1903
+# blake2b-generic.c:42:     FULLROUND(4);
+	.loc 1 42 119 view .LVU1422
+	movq	%r12, 64(%rax)	# _405, MEM[(u64 *)v_1170(D) + 64B]
+	.loc 1 42 131 is_stmt 1 view .LVU1423
+.LVL252:
+.LBB1055:
+.LBI1055:
+	.loc 1 5 19 view .LVU1424
+.LBB1056:
+	.loc 1 5 46 view .LVU1425
+# blake2b-generic.c:5: static inline u64 ror64(unsigned l, u64 x) { return (x >> l) | (x << (64-l)); }
+	.loc 1 5 62 is_stmt 0 view .LVU1426
+	rorq	$24, %r14	#, _1560
+.LVL253:
+	.loc 1 5 62 view .LVU1427
+.LBE1056:
+.LBE1055:
+# blake2b-generic.c:42:     FULLROUND(4);
+	.loc 1 42 139 view .LVU1428
+	movq	%r14, 32(%rax)	# _1560, MEM[(u64 *)v_1170(D) + 32B]
+	.loc 1 42 171 is_stmt 1 view .LVU1429
+# blake2b-generic.c:42:     FULLROUND(4);
+	.loc 1 42 179 is_stmt 0 view .LVU1430
+	addq	(%r9), %r8	# *m_1171(D), tmp1904
+	addq	%r14, %r8	# _1560, _409
+# blake2b-generic.c:42:     FULLROUND(4);
+	.loc 1 42 237 view .LVU1431
+	xorq	%r8, %rdi	# _409, tmp1906
+# blake2b-generic.c:42:     FULLROUND(4);
+	.loc 1 42 179 view .LVU1432
+	movq	%r8, (%rax)	# _409, *v_1170(D)
+	.loc 1 42 227 is_stmt 1 view .LVU1433
+.LVL254:
+.LBB1057:
+.LBI1057:
+	.loc 1 5 19 view .LVU1434
+.LBB1058:
+	.loc 1 5 46 view .LVU1435
+# blake2b-generic.c:5: static inline u64 ror64(unsigned l, u64 x) { return (x >> l) | (x << (64-l)); }
+	.loc 1 5 62 is_stmt 0 view .LVU1436
+	rorq	$16, %rdi	#, _1563
+.LVL255:
+	.loc 1 5 62 view .LVU1437
+.LBE1058:
+.LBE1057:
+# blake2b-generic.c:42:     FULLROUND(4);
+	.loc 1 42 275 view .LVU1438
+	addq	%rdi, %r12	# _1563, _411
+# blake2b-generic.c:42:     FULLROUND(4);
+	.loc 1 42 235 view .LVU1439
+	movq	%rdi, 96(%rax)	# _1563, MEM[(u64 *)v_1170(D) + 96B]
+	.loc 1 42 267 is_stmt 1 view .LVU1440
+# blake2b-generic.c:42:     FULLROUND(4);
+	.loc 1 42 297 is_stmt 0 view .LVU1441
+	xorq	%r12, %r14	# _411, tmp1907
+# blake2b-generic.c:42:     FULLROUND(4);
+	.loc 1 42 275 view .LVU1442
+	movq	%r12, 64(%rax)	# _411, MEM[(u64 *)v_1170(D) + 64B]
+	.loc 1 42 287 is_stmt 1 view .LVU1443
+.LVL256:
+.LBB1059:
+.LBI1059:
+	.loc 1 5 19 view .LVU1444
+.LBB1060:
+	.loc 1 5 46 view .LVU1445
+# blake2b-generic.c:5: static inline u64 ror64(unsigned l, u64 x) { return (x >> l) | (x << (64-l)); }
+	.loc 1 5 62 is_stmt 0 view .LVU1446
+	rolq	%r14	# tmp1907
+.LBE1060:
+.LBE1059:
+# blake2b-generic.c:42:     FULLROUND(4);
+	.loc 1 42 297 view .LVU1447
+	movq	%r12, -80(%rsp)	# _411, %sfp
+# blake2b-generic.c:42:     FULLROUND(4);
+	.loc 1 42 1071 view .LVU1448
+	movq	-40(%rsp), %r12	# %sfp, _1515
+# blake2b-generic.c:42:     FULLROUND(4);
+	.loc 1 42 295 view .LVU1449
+	movq	%r14, 32(%rax)	# _1566, MEM[(u64 *)v_1170(D) + 32B]
+	.loc 1 42 13 is_stmt 1 view .LVU1450
+	.loc 1 42 340 view .LVU1451
+	.loc 1 42 345 view .LVU1452
+# blake2b-generic.c:42:     FULLROUND(4);
+	.loc 1 42 353 is_stmt 0 view .LVU1453
+	addq	40(%r9), %rsi	# MEM[(const u64 *)m_1171(D) + 40B], tmp1908
+	addq	%rbp, %rsi	# _1518, _415
+# blake2b-generic.c:42:     FULLROUND(4);
+	.loc 1 42 295 view .LVU1454
+	movq	%r14, -48(%rsp)	# _1566, %sfp
+# blake2b-generic.c:42:     FULLROUND(4);
+	.loc 1 42 411 view .LVU1455
+	xorq	%rsi, %rcx	# _415, tmp1910
+# blake2b-generic.c:42:     FULLROUND(4);
+	.loc 1 42 353 view .LVU1456
+	movq	%rsi, 8(%rax)	# _415, MEM[(u64 *)v_1170(D) + 8B]
+	.loc 1 42 401 is_stmt 1 view .LVU1457
+.LVL257:
+.LBB1061:
+.LBI1061:
+	.loc 1 5 19 view .LVU1458
+.LBB1062:
+	.loc 1 5 46 view .LVU1459
+# blake2b-generic.c:5: static inline u64 ror64(unsigned l, u64 x) { return (x >> l) | (x << (64-l)); }
+	.loc 1 5 62 is_stmt 0 view .LVU1460
+	rolq	$32, %rcx	#, _1569
+.LVL258:
+	.loc 1 5 62 view .LVU1461
+.LBE1062:
+.LBE1061:
+# blake2b-generic.c:42:     FULLROUND(4);
+	.loc 1 42 449 view .LVU1462
+	addq	%rcx, %r15	# _1569, _417
+# blake2b-generic.c:42:     FULLROUND(4);
+	.loc 1 42 409 view .LVU1463
+	movq	%rcx, 104(%rax)	# _1569, MEM[(u64 *)v_1170(D) + 104B]
+	.loc 1 42 441 is_stmt 1 view .LVU1464
+# blake2b-generic.c:42:     FULLROUND(4);
+	.loc 1 42 471 is_stmt 0 view .LVU1465
+	xorq	%r15, %rbp	# _417, tmp1911
+# blake2b-generic.c:42:     FULLROUND(4);
+	.loc 1 42 449 view .LVU1466
+	movq	%r15, 72(%rax)	# _417, MEM[(u64 *)v_1170(D) + 72B]
+	.loc 1 42 461 is_stmt 1 view .LVU1467
+.LVL259:
+.LBB1063:
+.LBI1063:
+	.loc 1 5 19 view .LVU1468
+.LBB1064:
+	.loc 1 5 46 view .LVU1469
+# blake2b-generic.c:5: static inline u64 ror64(unsigned l, u64 x) { return (x >> l) | (x << (64-l)); }
+	.loc 1 5 62 is_stmt 0 view .LVU1470
+	rorq	$24, %rbp	#, _1572
+.LVL260:
+	.loc 1 5 62 view .LVU1471
+.LBE1064:
+.LBE1063:
+# blake2b-generic.c:42:     FULLROUND(4);
+	.loc 1 42 469 view .LVU1472
+	movq	%rbp, 40(%rax)	# _1572, MEM[(u64 *)v_1170(D) + 40B]
+	.loc 1 42 501 is_stmt 1 view .LVU1473
+# blake2b-generic.c:42:     FULLROUND(4);
+	.loc 1 42 509 is_stmt 0 view .LVU1474
+	addq	56(%r9), %rsi	# MEM[(const u64 *)m_1171(D) + 56B], tmp1912
+	addq	%rbp, %rsi	# _1572, _421
+# blake2b-generic.c:42:     FULLROUND(4);
+	.loc 1 42 567 view .LVU1475
+	xorq	%rsi, %rcx	# _421, tmp1914
+# blake2b-generic.c:42:     FULLROUND(4);
+	.loc 1 42 509 view .LVU1476
+	movq	%rsi, 8(%rax)	# _421, MEM[(u64 *)v_1170(D) + 8B]
+	.loc 1 42 557 is_stmt 1 view .LVU1477
+.LVL261:
+.LBB1065:
+.LBI1065:
+	.loc 1 5 19 view .LVU1478
+.LBB1066:
+	.loc 1 5 46 view .LVU1479
+# blake2b-generic.c:5: static inline u64 ror64(unsigned l, u64 x) { return (x >> l) | (x << (64-l)); }
+	.loc 1 5 62 is_stmt 0 view .LVU1480
+	rorq	$16, %rcx	#, _1575
+.LVL262:
+	.loc 1 5 62 view .LVU1481
+.LBE1066:
+.LBE1065:
+# blake2b-generic.c:42:     FULLROUND(4);
+	.loc 1 42 605 view .LVU1482
+	addq	%rcx, %r15	# _1575, _423
+# blake2b-generic.c:42:     FULLROUND(4);
+	.loc 1 42 565 view .LVU1483
+	movq	%rcx, 104(%rax)	# _1575, MEM[(u64 *)v_1170(D) + 104B]
+	.loc 1 42 597 is_stmt 1 view .LVU1484
+# blake2b-generic.c:42:     FULLROUND(4);
+	.loc 1 42 627 is_stmt 0 view .LVU1485
+	xorq	%r15, %rbp	# _423, tmp1915
+# blake2b-generic.c:42:     FULLROUND(4);
+	.loc 1 42 605 view .LVU1486
+	movq	%r15, 72(%rax)	# _423, MEM[(u64 *)v_1170(D) + 72B]
+	.loc 1 42 617 is_stmt 1 view .LVU1487
+.LVL263:
+.LBB1067:
+.LBI1067:
+	.loc 1 5 19 view .LVU1488
+.LBB1068:
+	.loc 1 5 46 view .LVU1489
+# blake2b-generic.c:5: static inline u64 ror64(unsigned l, u64 x) { return (x >> l) | (x << (64-l)); }
+	.loc 1 5 62 is_stmt 0 view .LVU1490
+	rolq	%rbp	# _1578
+.LVL264:
+	.loc 1 5 62 view .LVU1491
+.LBE1068:
+.LBE1067:
+# blake2b-generic.c:42:     FULLROUND(4);
+	.loc 1 42 627 view .LVU1492
+	movq	%r15, -56(%rsp)	# _423, %sfp
+# blake2b-generic.c:42:     FULLROUND(4);
+	.loc 1 42 779 view .LVU1493
+	movq	-72(%rsp), %r15	# %sfp, _363
+# blake2b-generic.c:42:     FULLROUND(4);
+	.loc 1 42 625 view .LVU1494
+	movq	%rbp, 40(%rax)	# _1578, MEM[(u64 *)v_1170(D) + 40B]
+	.loc 1 42 343 is_stmt 1 view .LVU1495
+	.loc 1 42 670 view .LVU1496
+	.loc 1 42 675 view .LVU1497
+# blake2b-generic.c:42:     FULLROUND(4);
+	.loc 1 42 683 is_stmt 0 view .LVU1498
+	addq	16(%r9), %rdx	# MEM[(const u64 *)m_1171(D) + 16B], tmp1916
+	addq	%rbx, %rdx	# _1530, _427
+# blake2b-generic.c:42:     FULLROUND(4);
+	.loc 1 42 741 view .LVU1499
+	xorq	%rdx, %r13	# _427, tmp1918
+# blake2b-generic.c:42:     FULLROUND(4);
+	.loc 1 42 683 view .LVU1500
+	movq	%rdx, 16(%rax)	# _427, MEM[(u64 *)v_1170(D) + 16B]
+	.loc 1 42 731 is_stmt 1 view .LVU1501
+.LVL265:
+.LBB1069:
+.LBI1069:
+	.loc 1 5 19 view .LVU1502
+.LBB1070:
+	.loc 1 5 46 view .LVU1503
+# blake2b-generic.c:5: static inline u64 ror64(unsigned l, u64 x) { return (x >> l) | (x << (64-l)); }
+	.loc 1 5 62 is_stmt 0 view .LVU1504
+	rolq	$32, %r13	#, _1581
+.LVL266:
+	.loc 1 5 62 view .LVU1505
+.LBE1070:
+.LBE1069:
+# blake2b-generic.c:42:     FULLROUND(4);
+	.loc 1 42 779 view .LVU1506
+	leaq	(%r15,%r13), %r14	#, _429
+# blake2b-generic.c:42:     FULLROUND(4);
+	.loc 1 42 739 view .LVU1507
+	movq	%r13, 112(%rax)	# _1581, MEM[(u64 *)v_1170(D) + 112B]
+	.loc 1 42 771 is_stmt 1 view .LVU1508
+# blake2b-generic.c:42:     FULLROUND(4);
+	.loc 1 42 801 is_stmt 0 view .LVU1509
+	xorq	%r14, %rbx	# _429, tmp1919
+# blake2b-generic.c:42:     FULLROUND(4);
+	.loc 1 42 779 view .LVU1510
+	movq	%r14, 80(%rax)	# _429, MEM[(u64 *)v_1170(D) + 80B]
+	.loc 1 42 791 is_stmt 1 view .LVU1511
+.LVL267:
+.LBB1071:
+.LBI1071:
+	.loc 1 5 19 view .LVU1512
+.LBB1072:
+	.loc 1 5 46 view .LVU1513
+# blake2b-generic.c:5: static inline u64 ror64(unsigned l, u64 x) { return (x >> l) | (x << (64-l)); }
+	.loc 1 5 62 is_stmt 0 view .LVU1514
+	rorq	$24, %rbx	#, _1584
+.LVL268:
+	.loc 1 5 62 view .LVU1515
+.LBE1072:
+.LBE1071:
+# blake2b-generic.c:42:     FULLROUND(4);
+	.loc 1 42 799 view .LVU1516
+	movq	%rbx, 48(%rax)	# _1584, MEM[(u64 *)v_1170(D) + 48B]
+	.loc 1 42 831 is_stmt 1 view .LVU1517
+# blake2b-generic.c:42:     FULLROUND(4);
+	.loc 1 42 839 is_stmt 0 view .LVU1518
+	addq	32(%r9), %rdx	# MEM[(const u64 *)m_1171(D) + 32B], tmp1920
+	addq	%rbx, %rdx	# _1584, _433
+# blake2b-generic.c:42:     FULLROUND(4);
+	.loc 1 42 897 view .LVU1519
+	xorq	%rdx, %r13	# _433, tmp1922
+# blake2b-generic.c:42:     FULLROUND(4);
+	.loc 1 42 839 view .LVU1520
+	movq	%rdx, 16(%rax)	# _433, MEM[(u64 *)v_1170(D) + 16B]
+	.loc 1 42 887 is_stmt 1 view .LVU1521
+.LVL269:
+.LBB1073:
+.LBI1073:
+	.loc 1 5 19 view .LVU1522
+.LBB1074:
+	.loc 1 5 46 view .LVU1523
+# blake2b-generic.c:5: static inline u64 ror64(unsigned l, u64 x) { return (x >> l) | (x << (64-l)); }
+	.loc 1 5 62 is_stmt 0 view .LVU1524
+	rorq	$16, %r13	#, _1587
+.LVL270:
+	.loc 1 5 62 view .LVU1525
+.LBE1074:
+.LBE1073:
+# blake2b-generic.c:42:     FULLROUND(4);
+	.loc 1 42 935 view .LVU1526
+	addq	%r13, %r14	# _1587, _435
+# blake2b-generic.c:42:     FULLROUND(4);
+	.loc 1 42 895 view .LVU1527
+	movq	%r13, 112(%rax)	# _1587, MEM[(u64 *)v_1170(D) + 112B]
+	.loc 1 42 927 is_stmt 1 view .LVU1528
+# blake2b-generic.c:42:     FULLROUND(4);
+	.loc 1 42 957 is_stmt 0 view .LVU1529
+	xorq	%r14, %rbx	# _435, tmp1923
+# blake2b-generic.c:42:     FULLROUND(4);
+	.loc 1 42 935 view .LVU1530
+	movq	%r14, 80(%rax)	# _435, MEM[(u64 *)v_1170(D) + 80B]
+	.loc 1 42 947 is_stmt 1 view .LVU1531
+.LVL271:
+.LBB1075:
+.LBI1075:
+	.loc 1 5 19 view .LVU1532
+.LBB1076:
+	.loc 1 5 46 view .LVU1533
+# blake2b-generic.c:5: static inline u64 ror64(unsigned l, u64 x) { return (x >> l) | (x << (64-l)); }
+	.loc 1 5 62 is_stmt 0 view .LVU1534
+	rolq	%rbx	# _1590
+.LVL272:
+	.loc 1 5 62 view .LVU1535
+.LBE1076:
+.LBE1075:
+# blake2b-generic.c:42:     FULLROUND(4);
+	.loc 1 42 955 view .LVU1536
+	movq	%rbx, 48(%rax)	# _1590, MEM[(u64 *)v_1170(D) + 48B]
+	.loc 1 42 673 is_stmt 1 view .LVU1537
+	.loc 1 42 1000 view .LVU1538
+	.loc 1 42 1005 view .LVU1539
+# blake2b-generic.c:42:     FULLROUND(4);
+	.loc 1 42 1013 is_stmt 0 view .LVU1540
+	addq	80(%r9), %r10	# MEM[(const u64 *)m_1171(D) + 80B], tmp1924
+	addq	%r11, %r10	# _1542, _439
+# blake2b-generic.c:42:     FULLROUND(4);
+	.loc 1 42 1071 view .LVU1541
+	xorq	%r10, %r12	# _439, _1515
+# blake2b-generic.c:42:     FULLROUND(4);
+	.loc 1 42 1013 view .LVU1542
+	movq	%r10, 24(%rax)	# _439, MEM[(u64 *)v_1170(D) + 24B]
+	.loc 1 42 1061 is_stmt 1 view .LVU1543
+.LVL273:
+.LBB1077:
+.LBI1077:
+	.loc 1 5 19 view .LVU1544
+.LBB1078:
+	.loc 1 5 46 view .LVU1545
+# blake2b-generic.c:5: static inline u64 ror64(unsigned l, u64 x) { return (x >> l) | (x << (64-l)); }
+	.loc 1 5 62 is_stmt 0 view .LVU1546
+	rolq	$32, %r12	#, _1593
+.LVL274:
+	.loc 1 5 62 view .LVU1547
+.LBE1078:
+.LBE1077:
+# blake2b-generic.c:42:     FULLROUND(4);
+	.loc 1 42 1069 view .LVU1548
+	movq	%r12, 120(%rax)	# _1593, MEM[(u64 *)v_1170(D) + 120B]
+	.loc 1 42 1101 is_stmt 1 view .LVU1549
+# blake2b-generic.c:42:     FULLROUND(4);
+	.loc 1 42 1109 is_stmt 0 view .LVU1550
+	movq	-64(%rsp), %r15	# %sfp, _375
+	addq	%r12, %r15	# _1593, _441
+# blake2b-generic.c:42:     FULLROUND(4);
+	.loc 1 42 1131 view .LVU1551
+	xorq	%r15, %r11	# _441, tmp1927
+# blake2b-generic.c:42:     FULLROUND(4);
+	.loc 1 42 1109 view .LVU1552
+	movq	%r15, 88(%rax)	# _441, MEM[(u64 *)v_1170(D) + 88B]
+	.loc 1 42 1121 is_stmt 1 view .LVU1553
+.LVL275:
+.LBB1079:
+.LBI1079:
+	.loc 1 5 19 view .LVU1554
+.LBB1080:
+	.loc 1 5 46 view .LVU1555
+# blake2b-generic.c:5: static inline u64 ror64(unsigned l, u64 x) { return (x >> l) | (x << (64-l)); }
+	.loc 1 5 62 is_stmt 0 view .LVU1556
+	rorq	$24, %r11	#, _1596
+.LVL276:
+	.loc 1 5 62 view .LVU1557
+.LBE1080:
+.LBE1079:
+# blake2b-generic.c:42:     FULLROUND(4);
+	.loc 1 42 1129 view .LVU1558
+	movq	%r11, 56(%rax)	# _1596, MEM[(u64 *)v_1170(D) + 56B]
+	.loc 1 42 1161 is_stmt 1 view .LVU1559
+# blake2b-generic.c:42:     FULLROUND(4);
+	.loc 1 42 1169 is_stmt 0 view .LVU1560
+	addq	120(%r9), %r10	# MEM[(const u64 *)m_1171(D) + 120B], tmp1928
+	addq	%r11, %r10	# _1596, _445
+# blake2b-generic.c:42:     FULLROUND(4);
+	.loc 1 42 1227 view .LVU1561
+	xorq	%r10, %r12	# _445, tmp1930
+# blake2b-generic.c:42:     FULLROUND(4);
+	.loc 1 42 1169 view .LVU1562
+	movq	%r10, 24(%rax)	# _445, MEM[(u64 *)v_1170(D) + 24B]
+	.loc 1 42 1217 is_stmt 1 view .LVU1563
+.LVL277:
+.LBB1081:
+.LBI1081:
+	.loc 1 5 19 view .LVU1564
+.LBB1082:
+	.loc 1 5 46 view .LVU1565
+# blake2b-generic.c:5: static inline u64 ror64(unsigned l, u64 x) { return (x >> l) | (x << (64-l)); }
+	.loc 1 5 62 is_stmt 0 view .LVU1566
+	rorq	$16, %r12	#, _1599
+.LVL278:
+	.loc 1 5 62 view .LVU1567
+.LBE1082:
+.LBE1081:
+# blake2b-generic.c:42:     FULLROUND(4);
+	.loc 1 42 1265 view .LVU1568
+	addq	%r12, %r15	# _1599, _447
+# blake2b-generic.c:42:     FULLROUND(4);
+	.loc 1 42 1225 view .LVU1569
+	movq	%r12, 120(%rax)	# _1599, MEM[(u64 *)v_1170(D) + 120B]
+	.loc 1 42 1257 is_stmt 1 view .LVU1570
+# blake2b-generic.c:42:     FULLROUND(4);
+	.loc 1 42 1287 is_stmt 0 view .LVU1571
+	xorq	%r15, %r11	# _447, tmp1931
+# blake2b-generic.c:42:     FULLROUND(4);
+	.loc 1 42 1265 view .LVU1572
+	movq	%r15, 88(%rax)	# _447, MEM[(u64 *)v_1170(D) + 88B]
+	.loc 1 42 1277 is_stmt 1 view .LVU1573
+.LVL279:
+.LBB1083:
+.LBI1083:
+	.loc 1 5 19 view .LVU1574
+.LBB1084:
+	.loc 1 5 46 view .LVU1575
+# blake2b-generic.c:5: static inline u64 ror64(unsigned l, u64 x) { return (x >> l) | (x << (64-l)); }
+	.loc 1 5 62 is_stmt 0 view .LVU1576
+	rolq	%r11	# _1602
+.LVL280:
+	.loc 1 5 62 view .LVU1577
+.LBE1084:
+.LBE1083:
+# blake2b-generic.c:42:     FULLROUND(4);
+	.loc 1 42 1285 view .LVU1578
+	movq	%r11, 56(%rax)	# _1602, MEM[(u64 *)v_1170(D) + 56B]
+	.loc 1 42 1003 is_stmt 1 view .LVU1579
+	.loc 1 42 1330 view .LVU1580
+	.loc 1 42 1335 view .LVU1581
+# blake2b-generic.c:42:     FULLROUND(4);
+	.loc 1 42 1343 is_stmt 0 view .LVU1582
+	addq	112(%r9), %r8	# MEM[(const u64 *)m_1171(D) + 112B], tmp1932
+	addq	%rbp, %r8	# _1578, _451
+# blake2b-generic.c:42:     FULLROUND(4);
+	.loc 1 42 1401 view .LVU1583
+	xorq	%r8, %r12	# _451, tmp1934
+# blake2b-generic.c:42:     FULLROUND(4);
+	.loc 1 42 1343 view .LVU1584
+	movq	%r8, (%rax)	# _451, *v_1170(D)
+	.loc 1 42 1391 is_stmt 1 view .LVU1585
+.LVL281:
+.LBB1085:
+.LBI1085:
+	.loc 1 5 19 view .LVU1586
+.LBB1086:
+	.loc 1 5 46 view .LVU1587
+# blake2b-generic.c:5: static inline u64 ror64(unsigned l, u64 x) { return (x >> l) | (x << (64-l)); }
+	.loc 1 5 62 is_stmt 0 view .LVU1588
+	rolq	$32, %r12	#, _1605
+.LVL282:
+	.loc 1 5 62 view .LVU1589
+.LBE1086:
+.LBE1085:
+# blake2b-generic.c:42:     FULLROUND(4);
+	.loc 1 42 1439 view .LVU1590
+	addq	%r12, %r14	# _1605, _453
+# blake2b-generic.c:42:     FULLROUND(4);
+	.loc 1 42 1399 view .LVU1591
+	movq	%r12, 120(%rax)	# _1605, MEM[(u64 *)v_1170(D) + 120B]
+	.loc 1 42 1431 is_stmt 1 view .LVU1592
+# blake2b-generic.c:42:     FULLROUND(4);
+	.loc 1 42 1461 is_stmt 0 view .LVU1593
+	xorq	%r14, %rbp	# _453, tmp1935
+# blake2b-generic.c:42:     FULLROUND(4);
+	.loc 1 42 1439 view .LVU1594
+	movq	%r14, 80(%rax)	# _453, MEM[(u64 *)v_1170(D) + 80B]
+	.loc 1 42 1451 is_stmt 1 view .LVU1595
+.LVL283:
+.LBB1087:
+.LBI1087:
+	.loc 1 5 19 view .LVU1596
+.LBB1088:
+	.loc 1 5 46 view .LVU1597
+# blake2b-generic.c:5: static inline u64 ror64(unsigned l, u64 x) { return (x >> l) | (x << (64-l)); }
+	.loc 1 5 62 is_stmt 0 view .LVU1598
+	rorq	$24, %rbp	#, _1608
+.LVL284:
+	.loc 1 5 62 view .LVU1599
+.LBE1088:
+.LBE1087:
+# blake2b-generic.c:42:     FULLROUND(4);
+	.loc 1 42 1459 view .LVU1600
+	movq	%rbp, 40(%rax)	# _1608, MEM[(u64 *)v_1170(D) + 40B]
+	.loc 1 42 1491 is_stmt 1 view .LVU1601
+# blake2b-generic.c:42:     FULLROUND(4);
+	.loc 1 42 1499 is_stmt 0 view .LVU1602
+	addq	8(%r9), %r8	# MEM[(const u64 *)m_1171(D) + 8B], tmp1936
+	addq	%rbp, %r8	# _1608, _457
+# blake2b-generic.c:42:     FULLROUND(4);
+	.loc 1 42 1557 view .LVU1603
+	xorq	%r8, %r12	# _457, tmp1938
+# blake2b-generic.c:42:     FULLROUND(4);
+	.loc 1 42 1499 view .LVU1604
+	movq	%r8, (%rax)	# _457, *v_1170(D)
+	.loc 1 42 1547 is_stmt 1 view .LVU1605
+.LVL285:
+.LBB1089:
+.LBI1089:
+	.loc 1 5 19 view .LVU1606
+.LBB1090:
+	.loc 1 5 46 view .LVU1607
+# blake2b-generic.c:5: static inline u64 ror64(unsigned l, u64 x) { return (x >> l) | (x << (64-l)); }
+	.loc 1 5 62 is_stmt 0 view .LVU1608
+	rorq	$16, %r12	#, tmp1938
+.LBE1090:
+.LBE1089:
+# blake2b-generic.c:42:     FULLROUND(4);
+	.loc 1 42 1595 view .LVU1609
+	addq	%r12, %r14	# _1611, _459
+# blake2b-generic.c:42:     FULLROUND(4);
+	.loc 1 42 1555 view .LVU1610
+	movq	%r12, 120(%rax)	# _1611, MEM[(u64 *)v_1170(D) + 120B]
+	.loc 1 42 1587 is_stmt 1 view .LVU1611
+# blake2b-generic.c:42:     FULLROUND(4);
+	.loc 1 42 1617 is_stmt 0 view .LVU1612
+	xorq	%r14, %rbp	# _459, tmp1939
+# blake2b-generic.c:42:     FULLROUND(4);
+	.loc 1 42 1595 view .LVU1613
+	movq	%r14, 80(%rax)	# _459, MEM[(u64 *)v_1170(D) + 80B]
+	.loc 1 42 1607 is_stmt 1 view .LVU1614
+.LVL286:
+.LBB1091:
+.LBI1091:
+	.loc 1 5 19 view .LVU1615
+.LBB1092:
+	.loc 1 5 46 view .LVU1616
+# blake2b-generic.c:5: static inline u64 ror64(unsigned l, u64 x) { return (x >> l) | (x << (64-l)); }
+	.loc 1 5 62 is_stmt 0 view .LVU1617
+	rolq	%rbp	# _1614
+.LVL287:
+	.loc 1 5 62 view .LVU1618
+.LBE1092:
+.LBE1091:
+# blake2b-generic.c:42:     FULLROUND(4);
+	.loc 1 42 1595 view .LVU1619
+	movq	%r12, -40(%rsp)	# _1611, %sfp
+# blake2b-generic.c:42:     FULLROUND(4);
+	.loc 1 42 1615 view .LVU1620
+	movq	%rbp, 40(%rax)	# _1614, MEM[(u64 *)v_1170(D) + 40B]
+	.loc 1 42 1333 is_stmt 1 view .LVU1621
+	.loc 1 42 1660 view .LVU1622
+	.loc 1 42 1665 view .LVU1623
+# blake2b-generic.c:42:     FULLROUND(4);
+	.loc 1 42 1673 is_stmt 0 view .LVU1624
+	addq	88(%r9), %rsi	# MEM[(const u64 *)m_1171(D) + 88B], tmp1940
+	addq	%rbx, %rsi	# _1590, _463
+# blake2b-generic.c:42:     FULLROUND(4);
+	.loc 1 42 1617 view .LVU1625
+	movq	%r14, -72(%rsp)	# _459, %sfp
+# blake2b-generic.c:42:     FULLROUND(4);
+	.loc 1 42 1732 view .LVU1626
+	xorq	%rsi, %rdi	# _463, tmp1942
+# blake2b-generic.c:42:     FULLROUND(4);
+	.loc 1 42 1673 view .LVU1627
+	movq	%rsi, 8(%rax)	# _463, MEM[(u64 *)v_1170(D) + 8B]
+	.loc 1 42 1722 is_stmt 1 view .LVU1628
+.LVL288:
+.LBB1093:
+.LBI1093:
+	.loc 1 5 19 view .LVU1629
+.LBB1094:
+	.loc 1 5 46 view .LVU1630
+# blake2b-generic.c:5: static inline u64 ror64(unsigned l, u64 x) { return (x >> l) | (x << (64-l)); }
+	.loc 1 5 62 is_stmt 0 view .LVU1631
+	rolq	$32, %rdi	#, _1617
+.LVL289:
+	.loc 1 5 62 view .LVU1632
+.LBE1094:
+.LBE1093:
+# blake2b-generic.c:42:     FULLROUND(4);
+	.loc 1 42 1770 view .LVU1633
+	addq	%rdi, %r15	# _1617, _465
+# blake2b-generic.c:42:     FULLROUND(4);
+	.loc 1 42 1730 view .LVU1634
+	movq	%rdi, 96(%rax)	# _1617, MEM[(u64 *)v_1170(D) + 96B]
+	.loc 1 42 1762 is_stmt 1 view .LVU1635
+# blake2b-generic.c:42:     FULLROUND(4);
+	.loc 1 42 1792 is_stmt 0 view .LVU1636
+	xorq	%r15, %rbx	# _465, tmp1943
+# blake2b-generic.c:42:     FULLROUND(4);
+	.loc 1 42 1770 view .LVU1637
+	movq	%r15, 88(%rax)	# _465, MEM[(u64 *)v_1170(D) + 88B]
+	.loc 1 42 1782 is_stmt 1 view .LVU1638
+.LVL290:
+.LBB1095:
+.LBI1095:
+	.loc 1 5 19 view .LVU1639
+.LBB1096:
+	.loc 1 5 46 view .LVU1640
+# blake2b-generic.c:5: static inline u64 ror64(unsigned l, u64 x) { return (x >> l) | (x << (64-l)); }
+	.loc 1 5 62 is_stmt 0 view .LVU1641
+	rorq	$24, %rbx	#, _1620
+.LVL291:
+	.loc 1 5 62 view .LVU1642
+.LBE1096:
+.LBE1095:
+# blake2b-generic.c:42:     FULLROUND(4);
+	.loc 1 42 1790 view .LVU1643
+	movq	%rbx, 48(%rax)	# _1620, MEM[(u64 *)v_1170(D) + 48B]
+	.loc 1 42 1822 is_stmt 1 view .LVU1644
+# blake2b-generic.c:42:     FULLROUND(4);
+	.loc 1 42 1830 is_stmt 0 view .LVU1645
+	addq	96(%r9), %rsi	# MEM[(const u64 *)m_1171(D) + 96B], tmp1944
+	addq	%rbx, %rsi	# _1620, _469
+# blake2b-generic.c:42:     FULLROUND(4);
+	.loc 1 42 1889 view .LVU1646
+	xorq	%rsi, %rdi	# _469, tmp1946
+# blake2b-generic.c:42:     FULLROUND(4);
+	.loc 1 42 1830 view .LVU1647
+	movq	%rsi, 8(%rax)	# _469, MEM[(u64 *)v_1170(D) + 8B]
+	.loc 1 42 1879 is_stmt 1 view .LVU1648
+.LVL292:
+.LBB1097:
+.LBI1097:
+	.loc 1 5 19 view .LVU1649
+.LBB1098:
+	.loc 1 5 46 view .LVU1650
+# blake2b-generic.c:5: static inline u64 ror64(unsigned l, u64 x) { return (x >> l) | (x << (64-l)); }
+	.loc 1 5 62 is_stmt 0 view .LVU1651
+	rorq	$16, %rdi	#, _1623
+.LVL293:
+	.loc 1 5 62 view .LVU1652
+.LBE1098:
+.LBE1097:
+# blake2b-generic.c:42:     FULLROUND(4);
+	.loc 1 42 1927 view .LVU1653
+	addq	%rdi, %r15	# _1623, _471
+# blake2b-generic.c:42:     FULLROUND(4);
+	.loc 1 42 1887 view .LVU1654
+	movq	%rdi, 96(%rax)	# _1623, MEM[(u64 *)v_1170(D) + 96B]
+	.loc 1 42 1919 is_stmt 1 view .LVU1655
+# blake2b-generic.c:42:     FULLROUND(4);
+	.loc 1 42 1949 is_stmt 0 view .LVU1656
+	xorq	%r15, %rbx	# _471, tmp1947
+# blake2b-generic.c:42:     FULLROUND(4);
+	.loc 1 42 1927 view .LVU1657
+	movq	%r15, 88(%rax)	# _471, MEM[(u64 *)v_1170(D) + 88B]
+	.loc 1 42 1939 is_stmt 1 view .LVU1658
+.LVL294:
+.LBB1099:
+.LBI1099:
+	.loc 1 5 19 view .LVU1659
+.LBB1100:
+	.loc 1 5 46 view .LVU1660
+# blake2b-generic.c:5: static inline u64 ror64(unsigned l, u64 x) { return (x >> l) | (x << (64-l)); }
+	.loc 1 5 62 is_stmt 0 view .LVU1661
+	rolq	%rbx	# _1626
+.LVL295:
+	.loc 1 5 62 view .LVU1662
+.LBE1100:
+.LBE1099:
+# blake2b-generic.c:42:     FULLROUND(4);
+	.loc 1 42 1949 view .LVU1663
+	movq	%r15, -64(%rsp)	# _471, %sfp
+# blake2b-generic.c:42:     FULLROUND(4);
+	.loc 1 42 1947 view .LVU1664
+	movq	%rbx, 48(%rax)	# _1626, MEM[(u64 *)v_1170(D) + 48B]
+	.loc 1 42 1663 is_stmt 1 view .LVU1665
+	.loc 1 42 1992 view .LVU1666
+	.loc 1 42 1997 view .LVU1667
+# blake2b-generic.c:42:     FULLROUND(4);
+	.loc 1 42 2005 is_stmt 0 view .LVU1668
+	addq	48(%r9), %rdx	# MEM[(const u64 *)m_1171(D) + 48B], tmp1948
+	addq	%r11, %rdx	# _1602, _475
+	movq	%rdx, 16(%rax)	# _475, MEM[(u64 *)v_1170(D) + 16B]
+	.loc 1 42 2054 is_stmt 1 view .LVU1669
+.LVL296:
+.LBB1101:
+.LBI1101:
+	.loc 1 5 19 view .LVU1670
+.LBB1102:
+	.loc 1 5 46 view .LVU1671
+.LBE1102:
+.LBE1101:
+# blake2b-generic.c:42:     FULLROUND(4);
+	.loc 1 42 2064 is_stmt 0 view .LVU1672
+	xorq	%rdx, %rcx	# _475, tmp1950
+.LVL297:
+# blake2b-generic.c:42:     FULLROUND(4);
+	.loc 1 42 2102 view .LVU1673
+	movq	-80(%rsp), %r15	# %sfp, _411
+.LBB1104:
+.LBB1103:
+# blake2b-generic.c:5: static inline u64 ror64(unsigned l, u64 x) { return (x >> l) | (x << (64-l)); }
+	.loc 1 5 62 view .LVU1674
+	rolq	$32, %rcx	#, _1629
+.LVL298:
+	.loc 1 5 62 view .LVU1675
+.LBE1103:
+.LBE1104:
+# blake2b-generic.c:42:     FULLROUND(4);
+	.loc 1 42 2337 view .LVU1676
+	movq	-48(%rsp), %r14	# %sfp, _1566
+# blake2b-generic.c:42:     FULLROUND(4);
+	.loc 1 42 2102 view .LVU1677
+	leaq	(%r15,%rcx), %r12	#, _477
+# blake2b-generic.c:42:     FULLROUND(4);
+	.loc 1 42 2062 view .LVU1678
+	movq	%rcx, 104(%rax)	# _1629, MEM[(u64 *)v_1170(D) + 104B]
+	.loc 1 42 2094 is_stmt 1 view .LVU1679
+# blake2b-generic.c:42:     FULLROUND(4);
+	.loc 1 42 2434 is_stmt 0 view .LVU1680
+	movq	-56(%rsp), %r15	# %sfp, _423
+# blake2b-generic.c:42:     FULLROUND(4);
+	.loc 1 42 2124 view .LVU1681
+	xorq	%r12, %r11	# _477, tmp1951
+# blake2b-generic.c:42:     FULLROUND(4);
+	.loc 1 42 2102 view .LVU1682
+	movq	%r12, 64(%rax)	# _477, MEM[(u64 *)v_1170(D) + 64B]
+	.loc 1 42 2114 is_stmt 1 view .LVU1683
+.LVL299:
+.LBB1105:
+.LBI1105:
+	.loc 1 5 19 view .LVU1684
+.LBB1106:
+	.loc 1 5 46 view .LVU1685
+# blake2b-generic.c:5: static inline u64 ror64(unsigned l, u64 x) { return (x >> l) | (x << (64-l)); }
+	.loc 1 5 62 is_stmt 0 view .LVU1686
+	rorq	$24, %r11	#, _1632
+.LVL300:
+	.loc 1 5 62 view .LVU1687
+.LBE1106:
+.LBE1105:
+# blake2b-generic.c:42:     FULLROUND(4);
+	.loc 1 42 2122 view .LVU1688
+	movq	%r11, 56(%rax)	# _1632, MEM[(u64 *)v_1170(D) + 56B]
+	.loc 1 42 2154 is_stmt 1 view .LVU1689
+# blake2b-generic.c:42:     FULLROUND(4);
+	.loc 1 42 2162 is_stmt 0 view .LVU1690
+	addq	64(%r9), %rdx	# MEM[(const u64 *)m_1171(D) + 64B], tmp1952
+	addq	%r11, %rdx	# _1632, _481
+# blake2b-generic.c:42:     FULLROUND(4);
+	.loc 1 42 2221 view .LVU1691
+	xorq	%rdx, %rcx	# _481, tmp1954
+# blake2b-generic.c:42:     FULLROUND(4);
+	.loc 1 42 2162 view .LVU1692
+	movq	%rdx, 16(%rax)	# _481, MEM[(u64 *)v_1170(D) + 16B]
+	.loc 1 42 2211 is_stmt 1 view .LVU1693
+.LVL301:
+.LBB1107:
+.LBI1107:
+	.loc 1 5 19 view .LVU1694
+.LBB1108:
+	.loc 1 5 46 view .LVU1695
+# blake2b-generic.c:5: static inline u64 ror64(unsigned l, u64 x) { return (x >> l) | (x << (64-l)); }
+	.loc 1 5 62 is_stmt 0 view .LVU1696
+	rorq	$16, %rcx	#, _1635
+.LVL302:
+	.loc 1 5 62 view .LVU1697
+.LBE1108:
+.LBE1107:
+# blake2b-generic.c:42:     FULLROUND(4);
+	.loc 1 42 2259 view .LVU1698
+	addq	%rcx, %r12	# _1635, _483
+# blake2b-generic.c:42:     FULLROUND(4);
+	.loc 1 42 2219 view .LVU1699
+	movq	%rcx, 104(%rax)	# _1635, MEM[(u64 *)v_1170(D) + 104B]
+	.loc 1 42 2251 is_stmt 1 view .LVU1700
+# blake2b-generic.c:42:     FULLROUND(4);
+	.loc 1 42 2281 is_stmt 0 view .LVU1701
+	xorq	%r12, %r11	# _483, tmp1955
+# blake2b-generic.c:42:     FULLROUND(4);
+	.loc 1 42 2259 view .LVU1702
+	movq	%r12, 64(%rax)	# _483, MEM[(u64 *)v_1170(D) + 64B]
+	.loc 1 42 2271 is_stmt 1 view .LVU1703
+.LVL303:
+.LBB1109:
+.LBI1109:
+	.loc 1 5 19 view .LVU1704
+.LBB1110:
+	.loc 1 5 46 view .LVU1705
+# blake2b-generic.c:5: static inline u64 ror64(unsigned l, u64 x) { return (x >> l) | (x << (64-l)); }
+	.loc 1 5 62 is_stmt 0 view .LVU1706
+	rolq	%r11	# _1638
+.LVL304:
+	.loc 1 5 62 view .LVU1707
+.LBE1110:
+.LBE1109:
+# blake2b-generic.c:42:     FULLROUND(4);
+	.loc 1 42 2279 view .LVU1708
+	movq	%r11, 56(%rax)	# _1638, MEM[(u64 *)v_1170(D) + 56B]
+	.loc 1 42 1995 is_stmt 1 view .LVU1709
+	.loc 1 42 2324 view .LVU1710
+	.loc 1 42 2329 view .LVU1711
+# blake2b-generic.c:42:     FULLROUND(4);
+	.loc 1 42 2337 is_stmt 0 view .LVU1712
+	addq	24(%r9), %r10	# MEM[(const u64 *)m_1171(D) + 24B], tmp1956
+	addq	%r14, %r10	# _1566, _487
+# blake2b-generic.c:42:     FULLROUND(4);
+	.loc 1 42 2396 view .LVU1713
+	xorq	%r10, %r13	# _487, tmp1958
+# blake2b-generic.c:42:     FULLROUND(4);
+	.loc 1 42 2337 view .LVU1714
+	movq	%r10, 24(%rax)	# _487, MEM[(u64 *)v_1170(D) + 24B]
+	.loc 1 42 2386 is_stmt 1 view .LVU1715
+.LVL305:
+.LBB1111:
+.LBI1111:
+	.loc 1 5 19 view .LVU1716
+.LBB1112:
+	.loc 1 5 46 view .LVU1717
+# blake2b-generic.c:5: static inline u64 ror64(unsigned l, u64 x) { return (x >> l) | (x << (64-l)); }
+	.loc 1 5 62 is_stmt 0 view .LVU1718
+	rolq	$32, %r13	#, _1641
+.LVL306:
+	.loc 1 5 62 view .LVU1719
+.LBE1112:
+.LBE1111:
+# blake2b-generic.c:42:     FULLROUND(4);
+	.loc 1 42 2434 view .LVU1720
+	addq	%r13, %r15	# _1641, _489
+# blake2b-generic.c:42:     FULLROUND(4);
+	.loc 1 42 2394 view .LVU1721
+	movq	%r13, 112(%rax)	# _1641, MEM[(u64 *)v_1170(D) + 112B]
+	.loc 1 42 2426 is_stmt 1 view .LVU1722
+# blake2b-generic.c:42:     FULLROUND(4);
+	.loc 1 42 2456 is_stmt 0 view .LVU1723
+	xorq	%r15, %r14	# _489, _1566
+# blake2b-generic.c:42:     FULLROUND(4);
+	.loc 1 42 2434 view .LVU1724
+	movq	%r15, 72(%rax)	# _489, MEM[(u64 *)v_1170(D) + 72B]
+	.loc 1 42 2446 is_stmt 1 view .LVU1725
+.LVL307:
+.LBB1113:
+.LBI1113:
+	.loc 1 5 19 view .LVU1726
+.LBB1114:
+	.loc 1 5 46 view .LVU1727
+# blake2b-generic.c:5: static inline u64 ror64(unsigned l, u64 x) { return (x >> l) | (x << (64-l)); }
+	.loc 1 5 62 is_stmt 0 view .LVU1728
+	rorq	$24, %r14	#, _1644
+.LVL308:
+	.loc 1 5 62 view .LVU1729
+.LBE1114:
+.LBE1113:
+# blake2b-generic.c:42:     FULLROUND(4);
+	.loc 1 42 2454 view .LVU1730
+	movq	%r14, 32(%rax)	# _1644, MEM[(u64 *)v_1170(D) + 32B]
+	.loc 1 42 2486 is_stmt 1 view .LVU1731
+# blake2b-generic.c:42:     FULLROUND(4);
+	.loc 1 42 2494 is_stmt 0 view .LVU1732
+	addq	104(%r9), %r10	# MEM[(const u64 *)m_1171(D) + 104B], tmp1960
+	addq	%r14, %r10	# _1644, _493
+# blake2b-generic.c:42:     FULLROUND(4);
+	.loc 1 42 2553 view .LVU1733
+	xorq	%r10, %r13	# _493, tmp1962
+# blake2b-generic.c:42:     FULLROUND(4);
+	.loc 1 42 2494 view .LVU1734
+	movq	%r10, 24(%rax)	# _493, MEM[(u64 *)v_1170(D) + 24B]
+	.loc 1 42 2543 is_stmt 1 view .LVU1735
+.LVL309:
+.LBB1115:
+.LBI1115:
+	.loc 1 5 19 view .LVU1736
+.LBB1116:
+	.loc 1 5 46 view .LVU1737
+# blake2b-generic.c:5: static inline u64 ror64(unsigned l, u64 x) { return (x >> l) | (x << (64-l)); }
+	.loc 1 5 62 is_stmt 0 view .LVU1738
+	rorq	$16, %r13	#, _1647
+.LVL310:
+	.loc 1 5 62 view .LVU1739
+.LBE1116:
+.LBE1115:
+# blake2b-generic.c:42:     FULLROUND(4);
+	.loc 1 42 2591 view .LVU1740
+	addq	%r13, %r15	# _1647, _495
+# blake2b-generic.c:42:     FULLROUND(4);
+	.loc 1 42 2551 view .LVU1741
+	movq	%r13, 112(%rax)	# _1647, MEM[(u64 *)v_1170(D) + 112B]
+	.loc 1 42 2583 is_stmt 1 view .LVU1742
+# blake2b-generic.c:42:     FULLROUND(4);
+	.loc 1 42 2613 is_stmt 0 view .LVU1743
+	xorq	%r15, %r14	# _495, tmp1963
+# blake2b-generic.c:42:     FULLROUND(4);
+	.loc 1 42 2591 view .LVU1744
+	movq	%r15, 72(%rax)	# _495, MEM[(u64 *)v_1170(D) + 72B]
+	.loc 1 42 2603 is_stmt 1 view .LVU1745
+.LVL311:
+.LBB1117:
+.LBI1117:
+	.loc 1 5 19 view .LVU1746
+.LBB1118:
+	.loc 1 5 46 view .LVU1747
+# blake2b-generic.c:5: static inline u64 ror64(unsigned l, u64 x) { return (x >> l) | (x << (64-l)); }
+	.loc 1 5 62 is_stmt 0 view .LVU1748
+	rolq	%r14	# _1650
+.LVL312:
+	.loc 1 5 62 view .LVU1749
+.LBE1118:
+.LBE1117:
+# blake2b-generic.c:42:     FULLROUND(4);
+	.loc 1 42 2611 view .LVU1750
+	movq	%r14, 32(%rax)	# _1650, MEM[(u64 *)v_1170(D) + 32B]
+	.loc 1 42 2327 is_stmt 1 view .LVU1751
+	.loc 1 42 8 view .LVU1752
+	.loc 1 43 5 view .LVU1753
+	.loc 1 43 10 view .LVU1754
+	.loc 1 43 15 view .LVU1755
+# blake2b-generic.c:43:     FULLROUND(5);
+	.loc 1 43 23 is_stmt 0 view .LVU1756
+	addq	16(%r9), %r8	# MEM[(const u64 *)m_1171(D) + 16B], tmp1964
+	addq	%r14, %r8	# _1650, _499
+# blake2b-generic.c:43:     FULLROUND(5);
+	.loc 1 43 81 view .LVU1757
+	xorq	%r8, %rdi	# _499, tmp1966
+# blake2b-generic.c:43:     FULLROUND(5);
+	.loc 1 43 23 view .LVU1758
+	movq	%r8, (%rax)	# _499, *v_1170(D)
+	.loc 1 43 71 is_stmt 1 view .LVU1759
+.LVL313:
+.LBB1119:
+.LBI1119:
+	.loc 1 5 19 view .LVU1760
+.LBB1120:
+	.loc 1 5 46 view .LVU1761
+# blake2b-generic.c:5: static inline u64 ror64(unsigned l, u64 x) { return (x >> l) | (x << (64-l)); }
+	.loc 1 5 62 is_stmt 0 view .LVU1762
+	rolq	$32, %rdi	#, _1653
+.LVL314:
+	.loc 1 5 62 view .LVU1763
+.LBE1120:
+.LBE1119:
+# blake2b-generic.c:43:     FULLROUND(5);
+	.loc 1 43 119 view .LVU1764
+	addq	%rdi, %r12	# _1653, _501
+# blake2b-generic.c:43:     FULLROUND(5);
+	.loc 1 43 79 view .LVU1765
+	movq	%rdi, 96(%rax)	# _1653, MEM[(u64 *)v_1170(D) + 96B]
+	.loc 1 43 111 is_stmt 1 view .LVU1766
+# blake2b-generic.c:43:     FULLROUND(5);
+	.loc 1 43 141 is_stmt 0 view .LVU1767
+	xorq	%r12, %r14	# _501, tmp1967
+# blake2b-generic.c:43:     FULLROUND(5);
+	.loc 1 43 119 view .LVU1768
+	movq	%r12, 64(%rax)	# _501, MEM[(u64 *)v_1170(D) + 64B]
+	.loc 1 43 131 is_stmt 1 view .LVU1769
+.LVL315:
+.LBB1121:
+.LBI1121:
+	.loc 1 5 19 view .LVU1770
+.LBB1122:
+	.loc 1 5 46 view .LVU1771
+# blake2b-generic.c:5: static inline u64 ror64(unsigned l, u64 x) { return (x >> l) | (x << (64-l)); }
+	.loc 1 5 62 is_stmt 0 view .LVU1772
+	rorq	$24, %r14	#, _1656
+.LVL316:
+	.loc 1 5 62 view .LVU1773
+.LBE1122:
+.LBE1121:
+# blake2b-generic.c:43:     FULLROUND(5);
+	.loc 1 43 139 view .LVU1774
+	movq	%r14, 32(%rax)	# _1656, MEM[(u64 *)v_1170(D) + 32B]
+	.loc 1 43 171 is_stmt 1 view .LVU1775
+# blake2b-generic.c:43:     FULLROUND(5);
+	.loc 1 43 179 is_stmt 0 view .LVU1776
+	addq	96(%r9), %r8	# MEM[(const u64 *)m_1171(D) + 96B], tmp1968
+	addq	%r14, %r8	# _1656, _505
+# blake2b-generic.c:43:     FULLROUND(5);
+	.loc 1 43 237 view .LVU1777
+	xorq	%r8, %rdi	# _505, tmp1970
+# blake2b-generic.c:43:     FULLROUND(5);
+	.loc 1 43 179 view .LVU1778
+	movq	%r8, (%rax)	# _505, *v_1170(D)
+	.loc 1 43 227 is_stmt 1 view .LVU1779
+.LVL317:
+.LBB1123:
+.LBI1123:
+	.loc 1 5 19 view .LVU1780
+.LBB1124:
+	.loc 1 5 46 view .LVU1781
+# blake2b-generic.c:5: static inline u64 ror64(unsigned l, u64 x) { return (x >> l) | (x << (64-l)); }
+	.loc 1 5 62 is_stmt 0 view .LVU1782
+	rorq	$16, %rdi	#, _1659
+.LVL318:
+	.loc 1 5 62 view .LVU1783
+.LBE1124:
+.LBE1123:
+# blake2b-generic.c:43:     FULLROUND(5);
+	.loc 1 43 275 view .LVU1784
+	addq	%rdi, %r12	# _1659, _507
+# blake2b-generic.c:43:     FULLROUND(5);
+	.loc 1 43 235 view .LVU1785
+	movq	%rdi, 96(%rax)	# _1659, MEM[(u64 *)v_1170(D) + 96B]
+	.loc 1 43 267 is_stmt 1 view .LVU1786
+# blake2b-generic.c:43:     FULLROUND(5);
+	.loc 1 43 297 is_stmt 0 view .LVU1787
+	xorq	%r12, %r14	# _507, tmp1971
+	movq	%r12, -80(%rsp)	# _507, %sfp
+.LBB1125:
+.LBB1126:
+# blake2b-generic.c:5: static inline u64 ror64(unsigned l, u64 x) { return (x >> l) | (x << (64-l)); }
+	.loc 1 5 62 view .LVU1788
+	rolq	%r14	# tmp1971
+.LBE1126:
+.LBE1125:
+# blake2b-generic.c:43:     FULLROUND(5);
+	.loc 1 43 275 view .LVU1789
+	movq	%r12, 64(%rax)	# _507, MEM[(u64 *)v_1170(D) + 64B]
+	.loc 1 43 287 is_stmt 1 view .LVU1790
+.LVL319:
+.LBB1128:
+.LBI1125:
+	.loc 1 5 19 view .LVU1791
+.LBB1127:
+	.loc 1 5 46 view .LVU1792
+	.loc 1 5 46 is_stmt 0 view .LVU1793
+.LBE1127:
+.LBE1128:
+# blake2b-generic.c:43:     FULLROUND(5);
+	.loc 1 43 295 view .LVU1794
+	movq	%r14, -48(%rsp)	# _1662, %sfp
+	movq	%r14, 32(%rax)	# _1662, MEM[(u64 *)v_1170(D) + 32B]
+	.loc 1 43 13 is_stmt 1 view .LVU1795
+	.loc 1 43 340 view .LVU1796
+	.loc 1 43 345 view .LVU1797
+# blake2b-generic.c:43:     FULLROUND(5);
+	.loc 1 43 353 is_stmt 0 view .LVU1798
+	addq	48(%r9), %rsi	# MEM[(const u64 *)m_1171(D) + 48B], tmp1972
+	addq	%rbp, %rsi	# _1614, _511
+# blake2b-generic.c:43:     FULLROUND(5);
+	.loc 1 43 1071 view .LVU1799
+	movq	-40(%rsp), %r12	# %sfp, _1611
+# blake2b-generic.c:43:     FULLROUND(5);
+	.loc 1 43 411 view .LVU1800
+	xorq	%rsi, %rcx	# _511, tmp1974
+# blake2b-generic.c:43:     FULLROUND(5);
+	.loc 1 43 353 view .LVU1801
+	movq	%rsi, 8(%rax)	# _511, MEM[(u64 *)v_1170(D) + 8B]
+	.loc 1 43 401 is_stmt 1 view .LVU1802
+.LVL320:
+.LBB1129:
+.LBI1129:
+	.loc 1 5 19 view .LVU1803
+.LBB1130:
+	.loc 1 5 46 view .LVU1804
+# blake2b-generic.c:5: static inline u64 ror64(unsigned l, u64 x) { return (x >> l) | (x << (64-l)); }
+	.loc 1 5 62 is_stmt 0 view .LVU1805
+	rolq	$32, %rcx	#, _1665
+.LVL321:
+	.loc 1 5 62 view .LVU1806
+.LBE1130:
+.LBE1129:
+# blake2b-generic.c:43:     FULLROUND(5);
+	.loc 1 43 449 view .LVU1807
+	addq	%rcx, %r15	# _1665, _513
+# blake2b-generic.c:43:     FULLROUND(5);
+	.loc 1 43 409 view .LVU1808
+	movq	%rcx, 104(%rax)	# _1665, MEM[(u64 *)v_1170(D) + 104B]
+	.loc 1 43 441 is_stmt 1 view .LVU1809
+# blake2b-generic.c:43:     FULLROUND(5);
+	.loc 1 43 471 is_stmt 0 view .LVU1810
+	xorq	%r15, %rbp	# _513, tmp1975
+# blake2b-generic.c:43:     FULLROUND(5);
+	.loc 1 43 449 view .LVU1811
+	movq	%r15, 72(%rax)	# _513, MEM[(u64 *)v_1170(D) + 72B]
+	.loc 1 43 461 is_stmt 1 view .LVU1812
+.LVL322:
+.LBB1131:
+.LBI1131:
+	.loc 1 5 19 view .LVU1813
+.LBB1132:
+	.loc 1 5 46 view .LVU1814
+# blake2b-generic.c:5: static inline u64 ror64(unsigned l, u64 x) { return (x >> l) | (x << (64-l)); }
+	.loc 1 5 62 is_stmt 0 view .LVU1815
+	rorq	$24, %rbp	#, _1668
+.LVL323:
+	.loc 1 5 62 view .LVU1816
+.LBE1132:
+.LBE1131:
+# blake2b-generic.c:43:     FULLROUND(5);
+	.loc 1 43 469 view .LVU1817
+	movq	%rbp, 40(%rax)	# _1668, MEM[(u64 *)v_1170(D) + 40B]
+	.loc 1 43 501 is_stmt 1 view .LVU1818
+# blake2b-generic.c:43:     FULLROUND(5);
+	.loc 1 43 509 is_stmt 0 view .LVU1819
+	addq	80(%r9), %rsi	# MEM[(const u64 *)m_1171(D) + 80B], tmp1976
+	addq	%rbp, %rsi	# _1668, _517
+# blake2b-generic.c:43:     FULLROUND(5);
+	.loc 1 43 567 view .LVU1820
+	xorq	%rsi, %rcx	# _517, tmp1978
+# blake2b-generic.c:43:     FULLROUND(5);
+	.loc 1 43 509 view .LVU1821
+	movq	%rsi, 8(%rax)	# _517, MEM[(u64 *)v_1170(D) + 8B]
+	.loc 1 43 557 is_stmt 1 view .LVU1822
+.LVL324:
+.LBB1133:
+.LBI1133:
+	.loc 1 5 19 view .LVU1823
+.LBB1134:
+	.loc 1 5 46 view .LVU1824
+# blake2b-generic.c:5: static inline u64 ror64(unsigned l, u64 x) { return (x >> l) | (x << (64-l)); }
+	.loc 1 5 62 is_stmt 0 view .LVU1825
+	rorq	$16, %rcx	#, _1671
+.LVL325:
+	.loc 1 5 62 view .LVU1826
+.LBE1134:
+.LBE1133:
+# blake2b-generic.c:43:     FULLROUND(5);
+	.loc 1 43 605 view .LVU1827
+	addq	%rcx, %r15	# _1671, _519
+# blake2b-generic.c:43:     FULLROUND(5);
+	.loc 1 43 565 view .LVU1828
+	movq	%rcx, 104(%rax)	# _1671, MEM[(u64 *)v_1170(D) + 104B]
+	.loc 1 43 597 is_stmt 1 view .LVU1829
+# blake2b-generic.c:43:     FULLROUND(5);
+	.loc 1 43 627 is_stmt 0 view .LVU1830
+	xorq	%r15, %rbp	# _519, tmp1979
+# blake2b-generic.c:43:     FULLROUND(5);
+	.loc 1 43 605 view .LVU1831
+	movq	%r15, 72(%rax)	# _519, MEM[(u64 *)v_1170(D) + 72B]
+	.loc 1 43 617 is_stmt 1 view .LVU1832
+.LVL326:
+.LBB1135:
+.LBI1135:
+	.loc 1 5 19 view .LVU1833
+.LBB1136:
+	.loc 1 5 46 view .LVU1834
+# blake2b-generic.c:5: static inline u64 ror64(unsigned l, u64 x) { return (x >> l) | (x << (64-l)); }
+	.loc 1 5 62 is_stmt 0 view .LVU1835
+	rolq	%rbp	# _1674
+.LVL327:
+	.loc 1 5 62 view .LVU1836
+.LBE1136:
+.LBE1135:
+# blake2b-generic.c:43:     FULLROUND(5);
+	.loc 1 43 627 view .LVU1837
+	movq	%r15, -56(%rsp)	# _519, %sfp
+# blake2b-generic.c:43:     FULLROUND(5);
+	.loc 1 43 779 view .LVU1838
+	movq	-72(%rsp), %r15	# %sfp, _459
+# blake2b-generic.c:43:     FULLROUND(5);
+	.loc 1 43 625 view .LVU1839
+	movq	%rbp, 40(%rax)	# _1674, MEM[(u64 *)v_1170(D) + 40B]
+	.loc 1 43 343 is_stmt 1 view .LVU1840
+	.loc 1 43 670 view .LVU1841
+	.loc 1 43 675 view .LVU1842
+# blake2b-generic.c:43:     FULLROUND(5);
+	.loc 1 43 683 is_stmt 0 view .LVU1843
+	addq	(%r9), %rdx	# *m_1171(D), tmp1980
+	addq	%rbx, %rdx	# _1626, _523
+# blake2b-generic.c:43:     FULLROUND(5);
+	.loc 1 43 741 view .LVU1844
+	xorq	%rdx, %r13	# _523, tmp1982
+# blake2b-generic.c:43:     FULLROUND(5);
+	.loc 1 43 683 view .LVU1845
+	movq	%rdx, 16(%rax)	# _523, MEM[(u64 *)v_1170(D) + 16B]
+	.loc 1 43 731 is_stmt 1 view .LVU1846
+.LVL328:
+.LBB1137:
+.LBI1137:
+	.loc 1 5 19 view .LVU1847
+.LBB1138:
+	.loc 1 5 46 view .LVU1848
+# blake2b-generic.c:5: static inline u64 ror64(unsigned l, u64 x) { return (x >> l) | (x << (64-l)); }
+	.loc 1 5 62 is_stmt 0 view .LVU1849
+	rolq	$32, %r13	#, _1677
+.LVL329:
+	.loc 1 5 62 view .LVU1850
+.LBE1138:
+.LBE1137:
+# blake2b-generic.c:43:     FULLROUND(5);
+	.loc 1 43 779 view .LVU1851
+	leaq	(%r15,%r13), %r14	#, _525
+# blake2b-generic.c:43:     FULLROUND(5);
+	.loc 1 43 739 view .LVU1852
+	movq	%r13, 112(%rax)	# _1677, MEM[(u64 *)v_1170(D) + 112B]
+	.loc 1 43 771 is_stmt 1 view .LVU1853
+# blake2b-generic.c:43:     FULLROUND(5);
+	.loc 1 43 1109 is_stmt 0 view .LVU1854
+	movq	-64(%rsp), %r15	# %sfp, _471
+# blake2b-generic.c:43:     FULLROUND(5);
+	.loc 1 43 801 view .LVU1855
+	xorq	%r14, %rbx	# _525, tmp1983
+# blake2b-generic.c:43:     FULLROUND(5);
+	.loc 1 43 779 view .LVU1856
+	movq	%r14, 80(%rax)	# _525, MEM[(u64 *)v_1170(D) + 80B]
+	.loc 1 43 791 is_stmt 1 view .LVU1857
+.LVL330:
+.LBB1139:
+.LBI1139:
+	.loc 1 5 19 view .LVU1858
+.LBB1140:
+	.loc 1 5 46 view .LVU1859
+# blake2b-generic.c:5: static inline u64 ror64(unsigned l, u64 x) { return (x >> l) | (x << (64-l)); }
+	.loc 1 5 62 is_stmt 0 view .LVU1860
+	rorq	$24, %rbx	#, _1680
+.LVL331:
+	.loc 1 5 62 view .LVU1861
+.LBE1140:
+.LBE1139:
+# blake2b-generic.c:43:     FULLROUND(5);
+	.loc 1 43 799 view .LVU1862
+	movq	%rbx, 48(%rax)	# _1680, MEM[(u64 *)v_1170(D) + 48B]
+	.loc 1 43 831 is_stmt 1 view .LVU1863
+# blake2b-generic.c:43:     FULLROUND(5);
+	.loc 1 43 839 is_stmt 0 view .LVU1864
+	addq	88(%r9), %rdx	# MEM[(const u64 *)m_1171(D) + 88B], tmp1984
+	addq	%rbx, %rdx	# _1680, _529
+# blake2b-generic.c:43:     FULLROUND(5);
+	.loc 1 43 897 view .LVU1865
+	xorq	%rdx, %r13	# _529, tmp1986
+# blake2b-generic.c:43:     FULLROUND(5);
+	.loc 1 43 839 view .LVU1866
+	movq	%rdx, 16(%rax)	# _529, MEM[(u64 *)v_1170(D) + 16B]
+	.loc 1 43 887 is_stmt 1 view .LVU1867
+.LVL332:
+.LBB1141:
+.LBI1141:
+	.loc 1 5 19 view .LVU1868
+.LBB1142:
+	.loc 1 5 46 view .LVU1869
+# blake2b-generic.c:5: static inline u64 ror64(unsigned l, u64 x) { return (x >> l) | (x << (64-l)); }
+	.loc 1 5 62 is_stmt 0 view .LVU1870
+	rorq	$16, %r13	#, _1683
+.LVL333:
+	.loc 1 5 62 view .LVU1871
+.LBE1142:
+.LBE1141:
+# blake2b-generic.c:43:     FULLROUND(5);
+	.loc 1 43 935 view .LVU1872
+	addq	%r13, %r14	# _1683, _531
+# blake2b-generic.c:43:     FULLROUND(5);
+	.loc 1 43 895 view .LVU1873
+	movq	%r13, 112(%rax)	# _1683, MEM[(u64 *)v_1170(D) + 112B]
+	.loc 1 43 927 is_stmt 1 view .LVU1874
+# blake2b-generic.c:43:     FULLROUND(5);
+	.loc 1 43 957 is_stmt 0 view .LVU1875
+	xorq	%r14, %rbx	# _531, tmp1987
+# blake2b-generic.c:43:     FULLROUND(5);
+	.loc 1 43 935 view .LVU1876
+	movq	%r14, 80(%rax)	# _531, MEM[(u64 *)v_1170(D) + 80B]
+	.loc 1 43 947 is_stmt 1 view .LVU1877
+.LVL334:
+.LBB1143:
+.LBI1143:
+	.loc 1 5 19 view .LVU1878
+.LBB1144:
+	.loc 1 5 46 view .LVU1879
+# blake2b-generic.c:5: static inline u64 ror64(unsigned l, u64 x) { return (x >> l) | (x << (64-l)); }
+	.loc 1 5 62 is_stmt 0 view .LVU1880
+	rolq	%rbx	# _1686
+.LVL335:
+	.loc 1 5 62 view .LVU1881
+.LBE1144:
+.LBE1143:
+# blake2b-generic.c:43:     FULLROUND(5);
+	.loc 1 43 955 view .LVU1882
+	movq	%rbx, 48(%rax)	# _1686, MEM[(u64 *)v_1170(D) + 48B]
+	.loc 1 43 673 is_stmt 1 view .LVU1883
+	.loc 1 43 1000 view .LVU1884
+	.loc 1 43 1005 view .LVU1885
+# blake2b-generic.c:43:     FULLROUND(5);
+	.loc 1 43 1013 is_stmt 0 view .LVU1886
+	addq	64(%r9), %r10	# MEM[(const u64 *)m_1171(D) + 64B], tmp1988
+	addq	%r11, %r10	# _1638, _535
+# blake2b-generic.c:43:     FULLROUND(5);
+	.loc 1 43 1071 view .LVU1887
+	xorq	%r10, %r12	# _535, _1611
+# blake2b-generic.c:43:     FULLROUND(5);
+	.loc 1 43 1013 view .LVU1888
+	movq	%r10, 24(%rax)	# _535, MEM[(u64 *)v_1170(D) + 24B]
+	.loc 1 43 1061 is_stmt 1 view .LVU1889
+.LVL336:
+.LBB1145:
+.LBI1145:
+	.loc 1 5 19 view .LVU1890
+.LBB1146:
+	.loc 1 5 46 view .LVU1891
+# blake2b-generic.c:5: static inline u64 ror64(unsigned l, u64 x) { return (x >> l) | (x << (64-l)); }
+	.loc 1 5 62 is_stmt 0 view .LVU1892
+	rolq	$32, %r12	#, _1689
+.LVL337:
+	.loc 1 5 62 view .LVU1893
+.LBE1146:
+.LBE1145:
+# blake2b-generic.c:43:     FULLROUND(5);
+	.loc 1 43 1109 view .LVU1894
+	addq	%r12, %r15	# _1689, _537
+# blake2b-generic.c:43:     FULLROUND(5);
+	.loc 1 43 1069 view .LVU1895
+	movq	%r12, 120(%rax)	# _1689, MEM[(u64 *)v_1170(D) + 120B]
+	.loc 1 43 1101 is_stmt 1 view .LVU1896
+# blake2b-generic.c:43:     FULLROUND(5);
+	.loc 1 43 1131 is_stmt 0 view .LVU1897
+	xorq	%r15, %r11	# _537, tmp1991
+# blake2b-generic.c:43:     FULLROUND(5);
+	.loc 1 43 1109 view .LVU1898
+	movq	%r15, 88(%rax)	# _537, MEM[(u64 *)v_1170(D) + 88B]
+	.loc 1 43 1121 is_stmt 1 view .LVU1899
+.LVL338:
+.LBB1147:
+.LBI1147:
+	.loc 1 5 19 view .LVU1900
+.LBB1148:
+	.loc 1 5 46 view .LVU1901
+# blake2b-generic.c:5: static inline u64 ror64(unsigned l, u64 x) { return (x >> l) | (x << (64-l)); }
+	.loc 1 5 62 is_stmt 0 view .LVU1902
+	rorq	$24, %r11	#, _1692
+.LVL339:
+	.loc 1 5 62 view .LVU1903
+.LBE1148:
+.LBE1147:
+# blake2b-generic.c:43:     FULLROUND(5);
+	.loc 1 43 1129 view .LVU1904
+	movq	%r11, 56(%rax)	# _1692, MEM[(u64 *)v_1170(D) + 56B]
+	.loc 1 43 1161 is_stmt 1 view .LVU1905
+# blake2b-generic.c:43:     FULLROUND(5);
+	.loc 1 43 1169 is_stmt 0 view .LVU1906
+	addq	24(%r9), %r10	# MEM[(const u64 *)m_1171(D) + 24B], tmp1992
+	addq	%r11, %r10	# _1692, _541
+# blake2b-generic.c:43:     FULLROUND(5);
+	.loc 1 43 1227 view .LVU1907
+	xorq	%r10, %r12	# _541, tmp1994
+# blake2b-generic.c:43:     FULLROUND(5);
+	.loc 1 43 1169 view .LVU1908
+	movq	%r10, 24(%rax)	# _541, MEM[(u64 *)v_1170(D) + 24B]
+	.loc 1 43 1217 is_stmt 1 view .LVU1909
+.LVL340:
+.LBB1149:
+.LBI1149:
+	.loc 1 5 19 view .LVU1910
+.LBB1150:
+	.loc 1 5 46 view .LVU1911
+# blake2b-generic.c:5: static inline u64 ror64(unsigned l, u64 x) { return (x >> l) | (x << (64-l)); }
+	.loc 1 5 62 is_stmt 0 view .LVU1912
+	rorq	$16, %r12	#, _1695
+.LVL341:
+	.loc 1 5 62 view .LVU1913
+.LBE1150:
+.LBE1149:
+# blake2b-generic.c:43:     FULLROUND(5);
+	.loc 1 43 1265 view .LVU1914
+	addq	%r12, %r15	# _1695, _543
+# blake2b-generic.c:43:     FULLROUND(5);
+	.loc 1 43 1225 view .LVU1915
+	movq	%r12, 120(%rax)	# _1695, MEM[(u64 *)v_1170(D) + 120B]
+	.loc 1 43 1257 is_stmt 1 view .LVU1916
+# blake2b-generic.c:43:     FULLROUND(5);
+	.loc 1 43 1287 is_stmt 0 view .LVU1917
+	xorq	%r15, %r11	# _543, tmp1995
+# blake2b-generic.c:43:     FULLROUND(5);
+	.loc 1 43 1265 view .LVU1918
+	movq	%r15, 88(%rax)	# _543, MEM[(u64 *)v_1170(D) + 88B]
+	.loc 1 43 1277 is_stmt 1 view .LVU1919
+.LVL342:
+.LBB1151:
+.LBI1151:
+	.loc 1 5 19 view .LVU1920
+.LBB1152:
+	.loc 1 5 46 view .LVU1921
+# blake2b-generic.c:5: static inline u64 ror64(unsigned l, u64 x) { return (x >> l) | (x << (64-l)); }
+	.loc 1 5 62 is_stmt 0 view .LVU1922
+	rolq	%r11	# _1698
+.LVL343:
+	.loc 1 5 62 view .LVU1923
+.LBE1152:
+.LBE1151:
+# blake2b-generic.c:43:     FULLROUND(5);
+	.loc 1 43 1285 view .LVU1924
+	movq	%r11, 56(%rax)	# _1698, MEM[(u64 *)v_1170(D) + 56B]
+	.loc 1 43 1003 is_stmt 1 view .LVU1925
+	.loc 1 43 1330 view .LVU1926
+	.loc 1 43 1335 view .LVU1927
+# blake2b-generic.c:43:     FULLROUND(5);
+	.loc 1 43 1343 is_stmt 0 view .LVU1928
+	addq	32(%r9), %r8	# MEM[(const u64 *)m_1171(D) + 32B], tmp1996
+	addq	%rbp, %r8	# _1674, _547
+# blake2b-generic.c:43:     FULLROUND(5);
+	.loc 1 43 1401 view .LVU1929
+	xorq	%r8, %r12	# _547, tmp1998
+# blake2b-generic.c:43:     FULLROUND(5);
+	.loc 1 43 1343 view .LVU1930
+	movq	%r8, (%rax)	# _547, *v_1170(D)
+	.loc 1 43 1391 is_stmt 1 view .LVU1931
+.LVL344:
+.LBB1153:
+.LBI1153:
+	.loc 1 5 19 view .LVU1932
+.LBB1154:
+	.loc 1 5 46 view .LVU1933
+# blake2b-generic.c:5: static inline u64 ror64(unsigned l, u64 x) { return (x >> l) | (x << (64-l)); }
+	.loc 1 5 62 is_stmt 0 view .LVU1934
+	rolq	$32, %r12	#, _1701
+.LVL345:
+	.loc 1 5 62 view .LVU1935
+.LBE1154:
+.LBE1153:
+# blake2b-generic.c:43:     FULLROUND(5);
+	.loc 1 43 1439 view .LVU1936
+	addq	%r12, %r14	# _1701, _549
+# blake2b-generic.c:43:     FULLROUND(5);
+	.loc 1 43 1399 view .LVU1937
+	movq	%r12, 120(%rax)	# _1701, MEM[(u64 *)v_1170(D) + 120B]
+	.loc 1 43 1431 is_stmt 1 view .LVU1938
+# blake2b-generic.c:43:     FULLROUND(5);
+	.loc 1 43 1461 is_stmt 0 view .LVU1939
+	xorq	%r14, %rbp	# _549, tmp1999
+# blake2b-generic.c:43:     FULLROUND(5);
+	.loc 1 43 1439 view .LVU1940
+	movq	%r14, 80(%rax)	# _549, MEM[(u64 *)v_1170(D) + 80B]
+	.loc 1 43 1451 is_stmt 1 view .LVU1941
+.LVL346:
+.LBB1155:
+.LBI1155:
+	.loc 1 5 19 view .LVU1942
+.LBB1156:
+	.loc 1 5 46 view .LVU1943
+# blake2b-generic.c:5: static inline u64 ror64(unsigned l, u64 x) { return (x >> l) | (x << (64-l)); }
+	.loc 1 5 62 is_stmt 0 view .LVU1944
+	rorq	$24, %rbp	#, _1704
+.LVL347:
+	.loc 1 5 62 view .LVU1945
+.LBE1156:
+.LBE1155:
+# blake2b-generic.c:43:     FULLROUND(5);
+	.loc 1 43 1459 view .LVU1946
+	movq	%rbp, 40(%rax)	# _1704, MEM[(u64 *)v_1170(D) + 40B]
+	.loc 1 43 1491 is_stmt 1 view .LVU1947
+# blake2b-generic.c:43:     FULLROUND(5);
+	.loc 1 43 1499 is_stmt 0 view .LVU1948
+	addq	104(%r9), %r8	# MEM[(const u64 *)m_1171(D) + 104B], tmp2000
+	addq	%rbp, %r8	# _1704, _553
+# blake2b-generic.c:43:     FULLROUND(5);
+	.loc 1 43 1557 view .LVU1949
+	xorq	%r8, %r12	# _553, tmp2002
+# blake2b-generic.c:43:     FULLROUND(5);
+	.loc 1 43 1499 view .LVU1950
+	movq	%r8, (%rax)	# _553, *v_1170(D)
+	.loc 1 43 1547 is_stmt 1 view .LVU1951
+.LVL348:
+.LBB1157:
+.LBI1157:
+	.loc 1 5 19 view .LVU1952
+.LBB1158:
+	.loc 1 5 46 view .LVU1953
+# blake2b-generic.c:5: static inline u64 ror64(unsigned l, u64 x) { return (x >> l) | (x << (64-l)); }
+	.loc 1 5 62 is_stmt 0 view .LVU1954
+	rorq	$16, %r12	#, tmp2002
+.LBE1158:
+.LBE1157:
+# blake2b-generic.c:43:     FULLROUND(5);
+	.loc 1 43 1595 view .LVU1955
+	addq	%r12, %r14	# _1707, _555
+# blake2b-generic.c:43:     FULLROUND(5);
+	.loc 1 43 1555 view .LVU1956
+	movq	%r12, 120(%rax)	# _1707, MEM[(u64 *)v_1170(D) + 120B]
+	.loc 1 43 1587 is_stmt 1 view .LVU1957
+# blake2b-generic.c:43:     FULLROUND(5);
+	.loc 1 43 1617 is_stmt 0 view .LVU1958
+	xorq	%r14, %rbp	# _555, tmp2003
+# blake2b-generic.c:43:     FULLROUND(5);
+	.loc 1 43 1595 view .LVU1959
+	movq	%r14, 80(%rax)	# _555, MEM[(u64 *)v_1170(D) + 80B]
+	.loc 1 43 1607 is_stmt 1 view .LVU1960
+.LVL349:
+.LBB1159:
+.LBI1159:
+	.loc 1 5 19 view .LVU1961
+.LBB1160:
+	.loc 1 5 46 view .LVU1962
+# blake2b-generic.c:5: static inline u64 ror64(unsigned l, u64 x) { return (x >> l) | (x << (64-l)); }
+	.loc 1 5 62 is_stmt 0 view .LVU1963
+	rolq	%rbp	# _1710
+.LVL350:
+	.loc 1 5 62 view .LVU1964
+.LBE1160:
+.LBE1159:
+# blake2b-generic.c:43:     FULLROUND(5);
+	.loc 1 43 1595 view .LVU1965
+	movq	%r12, -40(%rsp)	# _1707, %sfp
+# blake2b-generic.c:43:     FULLROUND(5);
+	.loc 1 43 1615 view .LVU1966
+	movq	%rbp, 40(%rax)	# _1710, MEM[(u64 *)v_1170(D) + 40B]
+	.loc 1 43 1333 is_stmt 1 view .LVU1967
+	.loc 1 43 1660 view .LVU1968
+	.loc 1 43 1665 view .LVU1969
+# blake2b-generic.c:43:     FULLROUND(5);
+	.loc 1 43 1673 is_stmt 0 view .LVU1970
+	addq	56(%r9), %rsi	# MEM[(const u64 *)m_1171(D) + 56B], tmp2004
+	addq	%rbx, %rsi	# _1686, _559
+# blake2b-generic.c:43:     FULLROUND(5);
+	.loc 1 43 1617 view .LVU1971
+	movq	%r14, -72(%rsp)	# _555, %sfp
+# blake2b-generic.c:43:     FULLROUND(5);
+	.loc 1 43 1732 view .LVU1972
+	xorq	%rsi, %rdi	# _559, tmp2006
+# blake2b-generic.c:43:     FULLROUND(5);
+	.loc 1 43 1673 view .LVU1973
+	movq	%rsi, 8(%rax)	# _559, MEM[(u64 *)v_1170(D) + 8B]
+	.loc 1 43 1722 is_stmt 1 view .LVU1974
+.LVL351:
+.LBB1161:
+.LBI1161:
+	.loc 1 5 19 view .LVU1975
+.LBB1162:
+	.loc 1 5 46 view .LVU1976
+# blake2b-generic.c:5: static inline u64 ror64(unsigned l, u64 x) { return (x >> l) | (x << (64-l)); }
+	.loc 1 5 62 is_stmt 0 view .LVU1977
+	rolq	$32, %rdi	#, _1713
+.LVL352:
+	.loc 1 5 62 view .LVU1978
+.LBE1162:
+.LBE1161:
+# blake2b-generic.c:43:     FULLROUND(5);
+	.loc 1 43 1770 view .LVU1979
+	addq	%rdi, %r15	# _1713, _561
+# blake2b-generic.c:43:     FULLROUND(5);
+	.loc 1 43 1730 view .LVU1980
+	movq	%rdi, 96(%rax)	# _1713, MEM[(u64 *)v_1170(D) + 96B]
+	.loc 1 43 1762 is_stmt 1 view .LVU1981
+# blake2b-generic.c:43:     FULLROUND(5);
+	.loc 1 43 1792 is_stmt 0 view .LVU1982
+	xorq	%r15, %rbx	# _561, tmp2007
+# blake2b-generic.c:43:     FULLROUND(5);
+	.loc 1 43 1770 view .LVU1983
+	movq	%r15, 88(%rax)	# _561, MEM[(u64 *)v_1170(D) + 88B]
+	.loc 1 43 1782 is_stmt 1 view .LVU1984
+.LVL353:
+.LBB1163:
+.LBI1163:
+	.loc 1 5 19 view .LVU1985
+.LBB1164:
+	.loc 1 5 46 view .LVU1986
+# blake2b-generic.c:5: static inline u64 ror64(unsigned l, u64 x) { return (x >> l) | (x << (64-l)); }
+	.loc 1 5 62 is_stmt 0 view .LVU1987
+	rorq	$24, %rbx	#, _1716
+.LVL354:
+	.loc 1 5 62 view .LVU1988
+.LBE1164:
+.LBE1163:
+# blake2b-generic.c:43:     FULLROUND(5);
+	.loc 1 43 1790 view .LVU1989
+	movq	%rbx, 48(%rax)	# _1716, MEM[(u64 *)v_1170(D) + 48B]
+	.loc 1 43 1822 is_stmt 1 view .LVU1990
+# blake2b-generic.c:43:     FULLROUND(5);
+	.loc 1 43 1830 is_stmt 0 view .LVU1991
+	addq	40(%r9), %rsi	# MEM[(const u64 *)m_1171(D) + 40B], tmp2008
+	addq	%rbx, %rsi	# _1716, _565
+# blake2b-generic.c:43:     FULLROUND(5);
+	.loc 1 43 1889 view .LVU1992
+	xorq	%rsi, %rdi	# _565, tmp2010
+# blake2b-generic.c:43:     FULLROUND(5);
+	.loc 1 43 1830 view .LVU1993
+	movq	%rsi, 8(%rax)	# _565, MEM[(u64 *)v_1170(D) + 8B]
+	.loc 1 43 1879 is_stmt 1 view .LVU1994
+.LVL355:
+.LBB1165:
+.LBI1165:
+	.loc 1 5 19 view .LVU1995
+.LBB1166:
+	.loc 1 5 46 view .LVU1996
+# blake2b-generic.c:5: static inline u64 ror64(unsigned l, u64 x) { return (x >> l) | (x << (64-l)); }
+	.loc 1 5 62 is_stmt 0 view .LVU1997
+	rorq	$16, %rdi	#, _1719
+.LVL356:
+	.loc 1 5 62 view .LVU1998
+.LBE1166:
+.LBE1165:
+# blake2b-generic.c:43:     FULLROUND(5);
+	.loc 1 43 1927 view .LVU1999
+	addq	%rdi, %r15	# _1719, _567
+# blake2b-generic.c:43:     FULLROUND(5);
+	.loc 1 43 1887 view .LVU2000
+	movq	%rdi, 96(%rax)	# _1719, MEM[(u64 *)v_1170(D) + 96B]
+	.loc 1 43 1919 is_stmt 1 view .LVU2001
+# blake2b-generic.c:43:     FULLROUND(5);
+	.loc 1 43 1949 is_stmt 0 view .LVU2002
+	xorq	%r15, %rbx	# _567, tmp2011
+# blake2b-generic.c:43:     FULLROUND(5);
+	.loc 1 43 1927 view .LVU2003
+	movq	%r15, 88(%rax)	# _567, MEM[(u64 *)v_1170(D) + 88B]
+	.loc 1 43 1939 is_stmt 1 view .LVU2004
+.LVL357:
+.LBB1167:
+.LBI1167:
+	.loc 1 5 19 view .LVU2005
+.LBB1168:
+	.loc 1 5 46 view .LVU2006
+# blake2b-generic.c:5: static inline u64 ror64(unsigned l, u64 x) { return (x >> l) | (x << (64-l)); }
+	.loc 1 5 62 is_stmt 0 view .LVU2007
+	rolq	%rbx	# _1722
+.LVL358:
+	.loc 1 5 62 view .LVU2008
+.LBE1168:
+.LBE1167:
+# blake2b-generic.c:43:     FULLROUND(5);
+	.loc 1 43 1949 view .LVU2009
+	movq	%r15, -64(%rsp)	# _567, %sfp
+# blake2b-generic.c:43:     FULLROUND(5);
+	.loc 1 43 2102 view .LVU2010
+	movq	-80(%rsp), %r15	# %sfp, _507
+# blake2b-generic.c:43:     FULLROUND(5);
+	.loc 1 43 1947 view .LVU2011
+	movq	%rbx, 48(%rax)	# _1722, MEM[(u64 *)v_1170(D) + 48B]
+	.loc 1 43 1663 is_stmt 1 view .LVU2012
+	.loc 1 43 1992 view .LVU2013
+	.loc 1 43 1997 view .LVU2014
+# blake2b-generic.c:43:     FULLROUND(5);
+	.loc 1 43 2005 is_stmt 0 view .LVU2015
+	addq	120(%r9), %rdx	# MEM[(const u64 *)m_1171(D) + 120B], tmp2012
+	addq	%r11, %rdx	# _1698, _571
+# blake2b-generic.c:43:     FULLROUND(5);
+	.loc 1 43 2064 view .LVU2016
+	xorq	%rdx, %rcx	# _571, tmp2014
+# blake2b-generic.c:43:     FULLROUND(5);
+	.loc 1 43 2005 view .LVU2017
+	movq	%rdx, 16(%rax)	# _571, MEM[(u64 *)v_1170(D) + 16B]
+	.loc 1 43 2054 is_stmt 1 view .LVU2018
+.LVL359:
+.LBB1169:
+.LBI1169:
+	.loc 1 5 19 view .LVU2019
+.LBB1170:
+	.loc 1 5 46 view .LVU2020
+# blake2b-generic.c:5: static inline u64 ror64(unsigned l, u64 x) { return (x >> l) | (x << (64-l)); }
+	.loc 1 5 62 is_stmt 0 view .LVU2021
+	rolq	$32, %rcx	#, _1725
+.LVL360:
+	.loc 1 5 62 view .LVU2022
+.LBE1170:
+.LBE1169:
+# blake2b-generic.c:43:     FULLROUND(5);
+	.loc 1 43 2102 view .LVU2023
+	leaq	(%r15,%rcx), %r12	#, _573
+# blake2b-generic.c:43:     FULLROUND(5);
+	.loc 1 43 2062 view .LVU2024
+	movq	%rcx, 104(%rax)	# _1725, MEM[(u64 *)v_1170(D) + 104B]
+	.loc 1 43 2094 is_stmt 1 view .LVU2025
+# blake2b-generic.c:43:     FULLROUND(5);
+	.loc 1 43 2124 is_stmt 0 view .LVU2026
+	xorq	%r12, %r11	# _573, tmp2015
+# blake2b-generic.c:43:     FULLROUND(5);
+	.loc 1 43 2102 view .LVU2027
+	movq	%r12, 64(%rax)	# _573, MEM[(u64 *)v_1170(D) + 64B]
+	.loc 1 43 2114 is_stmt 1 view .LVU2028
+.LVL361:
+.LBB1171:
+.LBI1171:
+	.loc 1 5 19 view .LVU2029
+.LBB1172:
+	.loc 1 5 46 view .LVU2030
+# blake2b-generic.c:5: static inline u64 ror64(unsigned l, u64 x) { return (x >> l) | (x << (64-l)); }
+	.loc 1 5 62 is_stmt 0 view .LVU2031
+	rorq	$24, %r11	#, _1728
+.LVL362:
+	.loc 1 5 62 view .LVU2032
+.LBE1172:
+.LBE1171:
+# blake2b-generic.c:43:     FULLROUND(5);
+	.loc 1 43 2122 view .LVU2033
+	movq	%r11, 56(%rax)	# _1728, MEM[(u64 *)v_1170(D) + 56B]
+	.loc 1 43 2154 is_stmt 1 view .LVU2034
+# blake2b-generic.c:43:     FULLROUND(5);
+	.loc 1 43 2162 is_stmt 0 view .LVU2035
+	addq	112(%r9), %rdx	# MEM[(const u64 *)m_1171(D) + 112B], tmp2016
+	addq	%r11, %rdx	# _1728, _577
+# blake2b-generic.c:43:     FULLROUND(5);
+	.loc 1 43 2221 view .LVU2036
+	xorq	%rdx, %rcx	# _577, tmp2018
+# blake2b-generic.c:43:     FULLROUND(5);
+	.loc 1 43 2162 view .LVU2037
+	movq	%rdx, 16(%rax)	# _577, MEM[(u64 *)v_1170(D) + 16B]
+	.loc 1 43 2211 is_stmt 1 view .LVU2038
+.LVL363:
+.LBB1173:
+.LBI1173:
+	.loc 1 5 19 view .LVU2039
+.LBB1174:
+	.loc 1 5 46 view .LVU2040
+# blake2b-generic.c:5: static inline u64 ror64(unsigned l, u64 x) { return (x >> l) | (x << (64-l)); }
+	.loc 1 5 62 is_stmt 0 view .LVU2041
+	rorq	$16, %rcx	#, _1731
+.LVL364:
+	.loc 1 5 62 view .LVU2042
+.LBE1174:
+.LBE1173:
+# blake2b-generic.c:43:     FULLROUND(5);
+	.loc 1 43 2259 view .LVU2043
+	addq	%rcx, %r12	# _1731, _579
+# blake2b-generic.c:43:     FULLROUND(5);
+	.loc 1 43 2219 view .LVU2044
+	movq	%rcx, 104(%rax)	# _1731, MEM[(u64 *)v_1170(D) + 104B]
+	.loc 1 43 2251 is_stmt 1 view .LVU2045
+# blake2b-generic.c:43:     FULLROUND(5);
+	.loc 1 43 2337 is_stmt 0 view .LVU2046
+	movq	-48(%rsp), %r14	# %sfp, _1662
+# blake2b-generic.c:43:     FULLROUND(5);
+	.loc 1 43 2281 view .LVU2047
+	xorq	%r12, %r11	# _579, tmp2019
+# blake2b-generic.c:43:     FULLROUND(5);
+	.loc 1 43 2259 view .LVU2048
+	movq	%r12, 64(%rax)	# _579, MEM[(u64 *)v_1170(D) + 64B]
+	.loc 1 43 2271 is_stmt 1 view .LVU2049
+.LVL365:
+.LBB1175:
+.LBI1175:
+	.loc 1 5 19 view .LVU2050
+.LBB1176:
+	.loc 1 5 46 view .LVU2051
+.LBE1176:
+.LBE1175:
+# blake2b-generic.c:43:     FULLROUND(5);
+	.loc 1 43 2434 is_stmt 0 view .LVU2052
+	movq	-56(%rsp), %r15	# %sfp, _519
+.LBB1178:
+.LBB1177:
+# blake2b-generic.c:5: static inline u64 ror64(unsigned l, u64 x) { return (x >> l) | (x << (64-l)); }
+	.loc 1 5 62 view .LVU2053
+	rolq	%r11	# _1734
+.LVL366:
+	.loc 1 5 62 view .LVU2054
+.LBE1177:
+.LBE1178:
+# blake2b-generic.c:43:     FULLROUND(5);
+	.loc 1 43 2279 view .LVU2055
+	movq	%r11, 56(%rax)	# _1734, MEM[(u64 *)v_1170(D) + 56B]
+	.loc 1 43 1995 is_stmt 1 view .LVU2056
+	.loc 1 43 2324 view .LVU2057
+	.loc 1 43 2329 view .LVU2058
+# blake2b-generic.c:43:     FULLROUND(5);
+	.loc 1 43 2337 is_stmt 0 view .LVU2059
+	addq	8(%r9), %r10	# MEM[(const u64 *)m_1171(D) + 8B], tmp2020
+	addq	%r14, %r10	# _1662, _583
+# blake2b-generic.c:43:     FULLROUND(5);
+	.loc 1 43 2396 view .LVU2060
+	xorq	%r10, %r13	# _583, tmp2022
+# blake2b-generic.c:43:     FULLROUND(5);
+	.loc 1 43 2337 view .LVU2061
+	movq	%r10, 24(%rax)	# _583, MEM[(u64 *)v_1170(D) + 24B]
+	.loc 1 43 2386 is_stmt 1 view .LVU2062
+.LVL367:
+.LBB1179:
+.LBI1179:
+	.loc 1 5 19 view .LVU2063
+.LBB1180:
+	.loc 1 5 46 view .LVU2064
+# blake2b-generic.c:5: static inline u64 ror64(unsigned l, u64 x) { return (x >> l) | (x << (64-l)); }
+	.loc 1 5 62 is_stmt 0 view .LVU2065
+	rolq	$32, %r13	#, _1737
+.LVL368:
+	.loc 1 5 62 view .LVU2066
+.LBE1180:
+.LBE1179:
+# blake2b-generic.c:43:     FULLROUND(5);
+	.loc 1 43 2434 view .LVU2067
+	addq	%r13, %r15	# _1737, _585
+# blake2b-generic.c:43:     FULLROUND(5);
+	.loc 1 43 2394 view .LVU2068
+	movq	%r13, 112(%rax)	# _1737, MEM[(u64 *)v_1170(D) + 112B]
+	.loc 1 43 2426 is_stmt 1 view .LVU2069
+# blake2b-generic.c:43:     FULLROUND(5);
+	.loc 1 43 2456 is_stmt 0 view .LVU2070
+	xorq	%r15, %r14	# _585, _1662
+# blake2b-generic.c:43:     FULLROUND(5);
+	.loc 1 43 2434 view .LVU2071
+	movq	%r15, 72(%rax)	# _585, MEM[(u64 *)v_1170(D) + 72B]
+	.loc 1 43 2446 is_stmt 1 view .LVU2072
+.LVL369:
+.LBB1181:
+.LBI1181:
+	.loc 1 5 19 view .LVU2073
+.LBB1182:
+	.loc 1 5 46 view .LVU2074
+# blake2b-generic.c:5: static inline u64 ror64(unsigned l, u64 x) { return (x >> l) | (x << (64-l)); }
+	.loc 1 5 62 is_stmt 0 view .LVU2075
+	rorq	$24, %r14	#, _1740
+.LVL370:
+	.loc 1 5 62 view .LVU2076
+.LBE1182:
+.LBE1181:
+# blake2b-generic.c:43:     FULLROUND(5);
+	.loc 1 43 2454 view .LVU2077
+	movq	%r14, 32(%rax)	# _1740, MEM[(u64 *)v_1170(D) + 32B]
+	.loc 1 43 2486 is_stmt 1 view .LVU2078
+# blake2b-generic.c:43:     FULLROUND(5);
+	.loc 1 43 2494 is_stmt 0 view .LVU2079
+	addq	72(%r9), %r10	# MEM[(const u64 *)m_1171(D) + 72B], tmp2024
+	addq	%r14, %r10	# _1740, _589
+# blake2b-generic.c:43:     FULLROUND(5);
+	.loc 1 43 2553 view .LVU2080
+	xorq	%r10, %r13	# _589, tmp2026
+# blake2b-generic.c:43:     FULLROUND(5);
+	.loc 1 43 2494 view .LVU2081
+	movq	%r10, 24(%rax)	# _589, MEM[(u64 *)v_1170(D) + 24B]
+	.loc 1 43 2543 is_stmt 1 view .LVU2082
+.LVL371:
+.LBB1183:
+.LBI1183:
+	.loc 1 5 19 view .LVU2083
+.LBB1184:
+	.loc 1 5 46 view .LVU2084
+# blake2b-generic.c:5: static inline u64 ror64(unsigned l, u64 x) { return (x >> l) | (x << (64-l)); }
+	.loc 1 5 62 is_stmt 0 view .LVU2085
+	rorq	$16, %r13	#, _1743
+.LVL372:
+	.loc 1 5 62 view .LVU2086
+.LBE1184:
+.LBE1183:
+# blake2b-generic.c:43:     FULLROUND(5);
+	.loc 1 43 2591 view .LVU2087
+	addq	%r13, %r15	# _1743, _591
+# blake2b-generic.c:43:     FULLROUND(5);
+	.loc 1 43 2551 view .LVU2088
+	movq	%r13, 112(%rax)	# _1743, MEM[(u64 *)v_1170(D) + 112B]
+	.loc 1 43 2583 is_stmt 1 view .LVU2089
+# blake2b-generic.c:43:     FULLROUND(5);
+	.loc 1 43 2613 is_stmt 0 view .LVU2090
+	xorq	%r15, %r14	# _591, tmp2027
+# blake2b-generic.c:43:     FULLROUND(5);
+	.loc 1 43 2591 view .LVU2091
+	movq	%r15, 72(%rax)	# _591, MEM[(u64 *)v_1170(D) + 72B]
+	.loc 1 43 2603 is_stmt 1 view .LVU2092
+.LVL373:
+.LBB1185:
+.LBI1185:
+	.loc 1 5 19 view .LVU2093
+.LBB1186:
+	.loc 1 5 46 view .LVU2094
+# blake2b-generic.c:5: static inline u64 ror64(unsigned l, u64 x) { return (x >> l) | (x << (64-l)); }
+	.loc 1 5 62 is_stmt 0 view .LVU2095
+	rolq	%r14	# _1746
+.LVL374:
+	.loc 1 5 62 view .LVU2096
+.LBE1186:
+.LBE1185:
+# blake2b-generic.c:43:     FULLROUND(5);
+	.loc 1 43 2611 view .LVU2097
+	movq	%r14, 32(%rax)	# _1746, MEM[(u64 *)v_1170(D) + 32B]
+	.loc 1 43 2327 is_stmt 1 view .LVU2098
+	.loc 1 43 8 view .LVU2099
+	.loc 1 44 5 view .LVU2100
+	.loc 1 44 10 view .LVU2101
+	.loc 1 44 15 view .LVU2102
+# blake2b-generic.c:44:     FULLROUND(6);
+	.loc 1 44 23 is_stmt 0 view .LVU2103
+	addq	96(%r9), %r8	# MEM[(const u64 *)m_1171(D) + 96B], tmp2028
+	addq	%r14, %r8	# _1746, _595
+# blake2b-generic.c:44:     FULLROUND(6);
+	.loc 1 44 81 view .LVU2104
+	xorq	%r8, %rdi	# _595, tmp2030
+# blake2b-generic.c:44:     FULLROUND(6);
+	.loc 1 44 23 view .LVU2105
+	movq	%r8, (%rax)	# _595, *v_1170(D)
+	.loc 1 44 71 is_stmt 1 view .LVU2106
+.LVL375:
+.LBB1187:
+.LBI1187:
+	.loc 1 5 19 view .LVU2107
+.LBB1188:
+	.loc 1 5 46 view .LVU2108
+# blake2b-generic.c:5: static inline u64 ror64(unsigned l, u64 x) { return (x >> l) | (x << (64-l)); }
+	.loc 1 5 62 is_stmt 0 view .LVU2109
+	rolq	$32, %rdi	#, _1749
+.LVL376:
+	.loc 1 5 62 view .LVU2110
+.LBE1188:
+.LBE1187:
+# blake2b-generic.c:44:     FULLROUND(6);
+	.loc 1 44 119 view .LVU2111
+	addq	%rdi, %r12	# _1749, _597
+# blake2b-generic.c:44:     FULLROUND(6);
+	.loc 1 44 79 view .LVU2112
+	movq	%rdi, 96(%rax)	# _1749, MEM[(u64 *)v_1170(D) + 96B]
+	.loc 1 44 111 is_stmt 1 view .LVU2113
+# blake2b-generic.c:44:     FULLROUND(6);
+	.loc 1 44 141 is_stmt 0 view .LVU2114
+	xorq	%r12, %r14	# _597, tmp2031
+# blake2b-generic.c:44:     FULLROUND(6);
+	.loc 1 44 119 view .LVU2115
+	movq	%r12, 64(%rax)	# _597, MEM[(u64 *)v_1170(D) + 64B]
+	.loc 1 44 131 is_stmt 1 view .LVU2116
+.LVL377:
+.LBB1189:
+.LBI1189:
+	.loc 1 5 19 view .LVU2117
+.LBB1190:
+	.loc 1 5 46 view .LVU2118
+# blake2b-generic.c:5: static inline u64 ror64(unsigned l, u64 x) { return (x >> l) | (x << (64-l)); }
+	.loc 1 5 62 is_stmt 0 view .LVU2119
+	rorq	$24, %r14	#, _1752
+.LVL378:
+	.loc 1 5 62 view .LVU2120
+.LBE1190:
+.LBE1189:
+# blake2b-generic.c:44:     FULLROUND(6);
+	.loc 1 44 139 view .LVU2121
+	movq	%r14, 32(%rax)	# _1752, MEM[(u64 *)v_1170(D) + 32B]
+	.loc 1 44 171 is_stmt 1 view .LVU2122
+# blake2b-generic.c:44:     FULLROUND(6);
+	.loc 1 44 179 is_stmt 0 view .LVU2123
+	addq	40(%r9), %r8	# MEM[(const u64 *)m_1171(D) + 40B], tmp2032
+	addq	%r14, %r8	# _1752, _601
+# blake2b-generic.c:44:     FULLROUND(6);
+	.loc 1 44 237 view .LVU2124
+	xorq	%r8, %rdi	# _601, tmp2034
+# blake2b-generic.c:44:     FULLROUND(6);
+	.loc 1 44 179 view .LVU2125
+	movq	%r8, (%rax)	# _601, *v_1170(D)
+	.loc 1 44 227 is_stmt 1 view .LVU2126
+.LVL379:
+.LBB1191:
+.LBI1191:
+	.loc 1 5 19 view .LVU2127
+.LBB1192:
+	.loc 1 5 46 view .LVU2128
+# blake2b-generic.c:5: static inline u64 ror64(unsigned l, u64 x) { return (x >> l) | (x << (64-l)); }
+	.loc 1 5 62 is_stmt 0 view .LVU2129
+	rorq	$16, %rdi	#, _1755
+.LVL380:
+	.loc 1 5 62 view .LVU2130
+.LBE1192:
+.LBE1191:
+# blake2b-generic.c:44:     FULLROUND(6);
+	.loc 1 44 275 view .LVU2131
+	addq	%rdi, %r12	# _1755, _603
+# blake2b-generic.c:44:     FULLROUND(6);
+	.loc 1 44 235 view .LVU2132
+	movq	%rdi, 96(%rax)	# _1755, MEM[(u64 *)v_1170(D) + 96B]
+	.loc 1 44 267 is_stmt 1 view .LVU2133
+# blake2b-generic.c:44:     FULLROUND(6);
+	.loc 1 44 297 is_stmt 0 view .LVU2134
+	xorq	%r12, %r14	# _603, tmp2035
+# blake2b-generic.c:44:     FULLROUND(6);
+	.loc 1 44 275 view .LVU2135
+	movq	%r12, 64(%rax)	# _603, MEM[(u64 *)v_1170(D) + 64B]
+	.loc 1 44 287 is_stmt 1 view .LVU2136
+.LVL381:
+.LBB1193:
+.LBI1193:
+	.loc 1 5 19 view .LVU2137
+.LBB1194:
+	.loc 1 5 46 view .LVU2138
+# blake2b-generic.c:5: static inline u64 ror64(unsigned l, u64 x) { return (x >> l) | (x << (64-l)); }
+	.loc 1 5 62 is_stmt 0 view .LVU2139
+	rolq	%r14	# tmp2035
+.LBE1194:
+.LBE1193:
+# blake2b-generic.c:44:     FULLROUND(6);
+	.loc 1 44 297 view .LVU2140
+	movq	%r12, -80(%rsp)	# _603, %sfp
+# blake2b-generic.c:44:     FULLROUND(6);
+	.loc 1 44 295 view .LVU2141
+	movq	%r14, 32(%rax)	# _1758, MEM[(u64 *)v_1170(D) + 32B]
+	.loc 1 44 13 is_stmt 1 view .LVU2142
+	.loc 1 44 340 view .LVU2143
+	.loc 1 44 345 view .LVU2144
+# blake2b-generic.c:44:     FULLROUND(6);
+	.loc 1 44 353 is_stmt 0 view .LVU2145
+	addq	8(%r9), %rsi	# MEM[(const u64 *)m_1171(D) + 8B], tmp2036
+	addq	%rbp, %rsi	# _1710, _607
+# blake2b-generic.c:44:     FULLROUND(6);
+	.loc 1 44 295 view .LVU2146
+	movq	%r14, -48(%rsp)	# _1758, %sfp
+# blake2b-generic.c:44:     FULLROUND(6);
+	.loc 1 44 411 view .LVU2147
+	xorq	%rsi, %rcx	# _607, tmp2038
+# blake2b-generic.c:44:     FULLROUND(6);
+	.loc 1 44 353 view .LVU2148
+	movq	%rsi, 8(%rax)	# _607, MEM[(u64 *)v_1170(D) + 8B]
+	.loc 1 44 401 is_stmt 1 view .LVU2149
+.LVL382:
+.LBB1195:
+.LBI1195:
+	.loc 1 5 19 view .LVU2150
+.LBB1196:
+	.loc 1 5 46 view .LVU2151
+# blake2b-generic.c:5: static inline u64 ror64(unsigned l, u64 x) { return (x >> l) | (x << (64-l)); }
+	.loc 1 5 62 is_stmt 0 view .LVU2152
+	rolq	$32, %rcx	#, _1761
+.LVL383:
+	.loc 1 5 62 view .LVU2153
+.LBE1196:
+.LBE1195:
+# blake2b-generic.c:44:     FULLROUND(6);
+	.loc 1 44 449 view .LVU2154
+	addq	%rcx, %r15	# _1761, _609
+# blake2b-generic.c:44:     FULLROUND(6);
+	.loc 1 44 409 view .LVU2155
+	movq	%rcx, 104(%rax)	# _1761, MEM[(u64 *)v_1170(D) + 104B]
+	.loc 1 44 441 is_stmt 1 view .LVU2156
+# blake2b-generic.c:44:     FULLROUND(6);
+	.loc 1 44 471 is_stmt 0 view .LVU2157
+	xorq	%r15, %rbp	# _609, tmp2039
+# blake2b-generic.c:44:     FULLROUND(6);
+	.loc 1 44 449 view .LVU2158
+	movq	%r15, 72(%rax)	# _609, MEM[(u64 *)v_1170(D) + 72B]
+	.loc 1 44 461 is_stmt 1 view .LVU2159
+.LVL384:
+.LBB1197:
+.LBI1197:
+	.loc 1 5 19 view .LVU2160
+.LBB1198:
+	.loc 1 5 46 view .LVU2161
+# blake2b-generic.c:5: static inline u64 ror64(unsigned l, u64 x) { return (x >> l) | (x << (64-l)); }
+	.loc 1 5 62 is_stmt 0 view .LVU2162
+	rorq	$24, %rbp	#, _1764
+.LVL385:
+	.loc 1 5 62 view .LVU2163
+.LBE1198:
+.LBE1197:
+# blake2b-generic.c:44:     FULLROUND(6);
+	.loc 1 44 469 view .LVU2164
+	movq	%rbp, 40(%rax)	# _1764, MEM[(u64 *)v_1170(D) + 40B]
+	.loc 1 44 501 is_stmt 1 view .LVU2165
+# blake2b-generic.c:44:     FULLROUND(6);
+	.loc 1 44 509 is_stmt 0 view .LVU2166
+	addq	120(%r9), %rsi	# MEM[(const u64 *)m_1171(D) + 120B], tmp2040
+	addq	%rbp, %rsi	# _1764, _613
+# blake2b-generic.c:44:     FULLROUND(6);
+	.loc 1 44 567 view .LVU2167
+	xorq	%rsi, %rcx	# _613, tmp2042
+# blake2b-generic.c:44:     FULLROUND(6);
+	.loc 1 44 509 view .LVU2168
+	movq	%rsi, 8(%rax)	# _613, MEM[(u64 *)v_1170(D) + 8B]
+	.loc 1 44 557 is_stmt 1 view .LVU2169
+.LVL386:
+.LBB1199:
+.LBI1199:
+	.loc 1 5 19 view .LVU2170
+.LBB1200:
+	.loc 1 5 46 view .LVU2171
+.LBE1200:
+.LBE1199:
+# blake2b-generic.c:44:     FULLROUND(6);
+	.loc 1 44 1071 is_stmt 0 view .LVU2172
+	movq	-40(%rsp), %r12	# %sfp, _1707
+.LBB1202:
+.LBB1201:
+# blake2b-generic.c:5: static inline u64 ror64(unsigned l, u64 x) { return (x >> l) | (x << (64-l)); }
+	.loc 1 5 62 view .LVU2173
+	rorq	$16, %rcx	#, _1767
+.LVL387:
+	.loc 1 5 62 view .LVU2174
+.LBE1201:
+.LBE1202:
+# blake2b-generic.c:44:     FULLROUND(6);
+	.loc 1 44 605 view .LVU2175
+	addq	%rcx, %r15	# _1767, _615
+# blake2b-generic.c:44:     FULLROUND(6);
+	.loc 1 44 565 view .LVU2176
+	movq	%rcx, 104(%rax)	# _1767, MEM[(u64 *)v_1170(D) + 104B]
+	.loc 1 44 597 is_stmt 1 view .LVU2177
+# blake2b-generic.c:44:     FULLROUND(6);
+	.loc 1 44 627 is_stmt 0 view .LVU2178
+	xorq	%r15, %rbp	# _615, tmp2043
+# blake2b-generic.c:44:     FULLROUND(6);
+	.loc 1 44 605 view .LVU2179
+	movq	%r15, 72(%rax)	# _615, MEM[(u64 *)v_1170(D) + 72B]
+	.loc 1 44 617 is_stmt 1 view .LVU2180
+.LVL388:
+.LBB1203:
+.LBI1203:
+	.loc 1 5 19 view .LVU2181
+.LBB1204:
+	.loc 1 5 46 view .LVU2182
+# blake2b-generic.c:5: static inline u64 ror64(unsigned l, u64 x) { return (x >> l) | (x << (64-l)); }
+	.loc 1 5 62 is_stmt 0 view .LVU2183
+	rolq	%rbp	# _1770
+.LVL389:
+	.loc 1 5 62 view .LVU2184
+.LBE1204:
+.LBE1203:
+# blake2b-generic.c:44:     FULLROUND(6);
+	.loc 1 44 627 view .LVU2185
+	movq	%r15, -56(%rsp)	# _615, %sfp
+# blake2b-generic.c:44:     FULLROUND(6);
+	.loc 1 44 779 view .LVU2186
+	movq	-72(%rsp), %r15	# %sfp, _555
+# blake2b-generic.c:44:     FULLROUND(6);
+	.loc 1 44 625 view .LVU2187
+	movq	%rbp, 40(%rax)	# _1770, MEM[(u64 *)v_1170(D) + 40B]
+	.loc 1 44 343 is_stmt 1 view .LVU2188
+	.loc 1 44 670 view .LVU2189
+	.loc 1 44 675 view .LVU2190
+# blake2b-generic.c:44:     FULLROUND(6);
+	.loc 1 44 683 is_stmt 0 view .LVU2191
+	addq	112(%r9), %rdx	# MEM[(const u64 *)m_1171(D) + 112B], tmp2044
+	addq	%rbx, %rdx	# _1722, _619
+# blake2b-generic.c:44:     FULLROUND(6);
+	.loc 1 44 741 view .LVU2192
+	xorq	%rdx, %r13	# _619, tmp2046
+# blake2b-generic.c:44:     FULLROUND(6);
+	.loc 1 44 683 view .LVU2193
+	movq	%rdx, 16(%rax)	# _619, MEM[(u64 *)v_1170(D) + 16B]
+	.loc 1 44 731 is_stmt 1 view .LVU2194
+.LVL390:
+.LBB1205:
+.LBI1205:
+	.loc 1 5 19 view .LVU2195
+.LBB1206:
+	.loc 1 5 46 view .LVU2196
+# blake2b-generic.c:5: static inline u64 ror64(unsigned l, u64 x) { return (x >> l) | (x << (64-l)); }
+	.loc 1 5 62 is_stmt 0 view .LVU2197
+	rolq	$32, %r13	#, _1773
+.LVL391:
+	.loc 1 5 62 view .LVU2198
+.LBE1206:
+.LBE1205:
+# blake2b-generic.c:44:     FULLROUND(6);
+	.loc 1 44 779 view .LVU2199
+	leaq	(%r15,%r13), %r14	#, _621
+# blake2b-generic.c:44:     FULLROUND(6);
+	.loc 1 44 739 view .LVU2200
+	movq	%r13, 112(%rax)	# _1773, MEM[(u64 *)v_1170(D) + 112B]
+	.loc 1 44 771 is_stmt 1 view .LVU2201
+# blake2b-generic.c:44:     FULLROUND(6);
+	.loc 1 44 1109 is_stmt 0 view .LVU2202
+	movq	-64(%rsp), %r15	# %sfp, _567
+# blake2b-generic.c:44:     FULLROUND(6);
+	.loc 1 44 801 view .LVU2203
+	xorq	%r14, %rbx	# _621, tmp2047
+# blake2b-generic.c:44:     FULLROUND(6);
+	.loc 1 44 779 view .LVU2204
+	movq	%r14, 80(%rax)	# _621, MEM[(u64 *)v_1170(D) + 80B]
+	.loc 1 44 791 is_stmt 1 view .LVU2205
+.LVL392:
+.LBB1207:
+.LBI1207:
+	.loc 1 5 19 view .LVU2206
+.LBB1208:
+	.loc 1 5 46 view .LVU2207
+# blake2b-generic.c:5: static inline u64 ror64(unsigned l, u64 x) { return (x >> l) | (x << (64-l)); }
+	.loc 1 5 62 is_stmt 0 view .LVU2208
+	rorq	$24, %rbx	#, _1776
+.LVL393:
+	.loc 1 5 62 view .LVU2209
+.LBE1208:
+.LBE1207:
+# blake2b-generic.c:44:     FULLROUND(6);
+	.loc 1 44 799 view .LVU2210
+	movq	%rbx, 48(%rax)	# _1776, MEM[(u64 *)v_1170(D) + 48B]
+	.loc 1 44 831 is_stmt 1 view .LVU2211
+# blake2b-generic.c:44:     FULLROUND(6);
+	.loc 1 44 839 is_stmt 0 view .LVU2212
+	addq	104(%r9), %rdx	# MEM[(const u64 *)m_1171(D) + 104B], tmp2048
+	addq	%rbx, %rdx	# _1776, _625
+# blake2b-generic.c:44:     FULLROUND(6);
+	.loc 1 44 897 view .LVU2213
+	xorq	%rdx, %r13	# _625, tmp2050
+# blake2b-generic.c:44:     FULLROUND(6);
+	.loc 1 44 839 view .LVU2214
+	movq	%rdx, 16(%rax)	# _625, MEM[(u64 *)v_1170(D) + 16B]
+	.loc 1 44 887 is_stmt 1 view .LVU2215
+.LVL394:
+.LBB1209:
+.LBI1209:
+	.loc 1 5 19 view .LVU2216
+.LBB1210:
+	.loc 1 5 46 view .LVU2217
+# blake2b-generic.c:5: static inline u64 ror64(unsigned l, u64 x) { return (x >> l) | (x << (64-l)); }
+	.loc 1 5 62 is_stmt 0 view .LVU2218
+	rorq	$16, %r13	#, _1779
+.LVL395:
+	.loc 1 5 62 view .LVU2219
+.LBE1210:
+.LBE1209:
+# blake2b-generic.c:44:     FULLROUND(6);
+	.loc 1 44 935 view .LVU2220
+	addq	%r13, %r14	# _1779, _627
+# blake2b-generic.c:44:     FULLROUND(6);
+	.loc 1 44 895 view .LVU2221
+	movq	%r13, 112(%rax)	# _1779, MEM[(u64 *)v_1170(D) + 112B]
+	.loc 1 44 927 is_stmt 1 view .LVU2222
+# blake2b-generic.c:44:     FULLROUND(6);
+	.loc 1 44 957 is_stmt 0 view .LVU2223
+	xorq	%r14, %rbx	# _627, tmp2051
+# blake2b-generic.c:44:     FULLROUND(6);
+	.loc 1 44 935 view .LVU2224
+	movq	%r14, 80(%rax)	# _627, MEM[(u64 *)v_1170(D) + 80B]
+	.loc 1 44 947 is_stmt 1 view .LVU2225
+.LVL396:
+.LBB1211:
+.LBI1211:
+	.loc 1 5 19 view .LVU2226
+.LBB1212:
+	.loc 1 5 46 view .LVU2227
+# blake2b-generic.c:5: static inline u64 ror64(unsigned l, u64 x) { return (x >> l) | (x << (64-l)); }
+	.loc 1 5 62 is_stmt 0 view .LVU2228
+	rolq	%rbx	# _1782
+.LVL397:
+	.loc 1 5 62 view .LVU2229
+.LBE1212:
+.LBE1211:
+# blake2b-generic.c:44:     FULLROUND(6);
+	.loc 1 44 955 view .LVU2230
+	movq	%rbx, 48(%rax)	# _1782, MEM[(u64 *)v_1170(D) + 48B]
+	.loc 1 44 673 is_stmt 1 view .LVU2231
+	.loc 1 44 1000 view .LVU2232
+	.loc 1 44 1005 view .LVU2233
+# blake2b-generic.c:44:     FULLROUND(6);
+	.loc 1 44 1013 is_stmt 0 view .LVU2234
+	addq	32(%r9), %r10	# MEM[(const u64 *)m_1171(D) + 32B], tmp2052
+	addq	%r11, %r10	# _1734, _631
+# blake2b-generic.c:44:     FULLROUND(6);
+	.loc 1 44 1071 view .LVU2235
+	xorq	%r10, %r12	# _631, _1707
+# blake2b-generic.c:44:     FULLROUND(6);
+	.loc 1 44 1013 view .LVU2236
+	movq	%r10, 24(%rax)	# _631, MEM[(u64 *)v_1170(D) + 24B]
+	.loc 1 44 1061 is_stmt 1 view .LVU2237
+.LVL398:
+.LBB1213:
+.LBI1213:
+	.loc 1 5 19 view .LVU2238
+.LBB1214:
+	.loc 1 5 46 view .LVU2239
+# blake2b-generic.c:5: static inline u64 ror64(unsigned l, u64 x) { return (x >> l) | (x << (64-l)); }
+	.loc 1 5 62 is_stmt 0 view .LVU2240
+	rolq	$32, %r12	#, _1785
+.LVL399:
+	.loc 1 5 62 view .LVU2241
+.LBE1214:
+.LBE1213:
+# blake2b-generic.c:44:     FULLROUND(6);
+	.loc 1 44 1109 view .LVU2242
+	addq	%r12, %r15	# _1785, _633
+# blake2b-generic.c:44:     FULLROUND(6);
+	.loc 1 44 1069 view .LVU2243
+	movq	%r12, 120(%rax)	# _1785, MEM[(u64 *)v_1170(D) + 120B]
+	.loc 1 44 1101 is_stmt 1 view .LVU2244
+# blake2b-generic.c:44:     FULLROUND(6);
+	.loc 1 44 1131 is_stmt 0 view .LVU2245
+	xorq	%r15, %r11	# _633, tmp2055
+# blake2b-generic.c:44:     FULLROUND(6);
+	.loc 1 44 1109 view .LVU2246
+	movq	%r15, 88(%rax)	# _633, MEM[(u64 *)v_1170(D) + 88B]
+	.loc 1 44 1121 is_stmt 1 view .LVU2247
+.LVL400:
+.LBB1215:
+.LBI1215:
+	.loc 1 5 19 view .LVU2248
+.LBB1216:
+	.loc 1 5 46 view .LVU2249
+# blake2b-generic.c:5: static inline u64 ror64(unsigned l, u64 x) { return (x >> l) | (x << (64-l)); }
+	.loc 1 5 62 is_stmt 0 view .LVU2250
+	rorq	$24, %r11	#, _1788
+.LVL401:
+	.loc 1 5 62 view .LVU2251
+.LBE1216:
+.LBE1215:
+# blake2b-generic.c:44:     FULLROUND(6);
+	.loc 1 44 1129 view .LVU2252
+	movq	%r11, 56(%rax)	# _1788, MEM[(u64 *)v_1170(D) + 56B]
+	.loc 1 44 1161 is_stmt 1 view .LVU2253
+# blake2b-generic.c:44:     FULLROUND(6);
+	.loc 1 44 1169 is_stmt 0 view .LVU2254
+	addq	80(%r9), %r10	# MEM[(const u64 *)m_1171(D) + 80B], tmp2056
+	addq	%r11, %r10	# _1788, _637
+# blake2b-generic.c:44:     FULLROUND(6);
+	.loc 1 44 1227 view .LVU2255
+	xorq	%r10, %r12	# _637, tmp2058
+# blake2b-generic.c:44:     FULLROUND(6);
+	.loc 1 44 1169 view .LVU2256
+	movq	%r10, 24(%rax)	# _637, MEM[(u64 *)v_1170(D) + 24B]
+	.loc 1 44 1217 is_stmt 1 view .LVU2257
+.LVL402:
+.LBB1217:
+.LBI1217:
+	.loc 1 5 19 view .LVU2258
+.LBB1218:
+	.loc 1 5 46 view .LVU2259
+# blake2b-generic.c:5: static inline u64 ror64(unsigned l, u64 x) { return (x >> l) | (x << (64-l)); }
+	.loc 1 5 62 is_stmt 0 view .LVU2260
+	rorq	$16, %r12	#, _1791
+.LVL403:
+	.loc 1 5 62 view .LVU2261
+.LBE1218:
+.LBE1217:
+# blake2b-generic.c:44:     FULLROUND(6);
+	.loc 1 44 1265 view .LVU2262
+	addq	%r12, %r15	# _1791, _639
+# blake2b-generic.c:44:     FULLROUND(6);
+	.loc 1 44 1225 view .LVU2263
+	movq	%r12, 120(%rax)	# _1791, MEM[(u64 *)v_1170(D) + 120B]
+	.loc 1 44 1257 is_stmt 1 view .LVU2264
+# blake2b-generic.c:44:     FULLROUND(6);
+	.loc 1 44 1287 is_stmt 0 view .LVU2265
+	xorq	%r15, %r11	# _639, tmp2059
+# blake2b-generic.c:44:     FULLROUND(6);
+	.loc 1 44 1265 view .LVU2266
+	movq	%r15, 88(%rax)	# _639, MEM[(u64 *)v_1170(D) + 88B]
+	.loc 1 44 1277 is_stmt 1 view .LVU2267
+.LVL404:
+.LBB1219:
+.LBI1219:
+	.loc 1 5 19 view .LVU2268
+.LBB1220:
+	.loc 1 5 46 view .LVU2269
+# blake2b-generic.c:5: static inline u64 ror64(unsigned l, u64 x) { return (x >> l) | (x << (64-l)); }
+	.loc 1 5 62 is_stmt 0 view .LVU2270
+	rolq	%r11	# _1794
+.LVL405:
+	.loc 1 5 62 view .LVU2271
+.LBE1220:
+.LBE1219:
+# blake2b-generic.c:44:     FULLROUND(6);
+	.loc 1 44 1285 view .LVU2272
+	movq	%r11, 56(%rax)	# _1794, MEM[(u64 *)v_1170(D) + 56B]
+	.loc 1 44 1003 is_stmt 1 view .LVU2273
+	.loc 1 44 1330 view .LVU2274
+	.loc 1 44 1335 view .LVU2275
+# blake2b-generic.c:44:     FULLROUND(6);
+	.loc 1 44 1343 is_stmt 0 view .LVU2276
+	addq	(%r9), %r8	# *m_1171(D), tmp2060
+	addq	%rbp, %r8	# _1770, _643
+# blake2b-generic.c:44:     FULLROUND(6);
+	.loc 1 44 1401 view .LVU2277
+	xorq	%r8, %r12	# _643, tmp2062
+# blake2b-generic.c:44:     FULLROUND(6);
+	.loc 1 44 1343 view .LVU2278
+	movq	%r8, (%rax)	# _643, *v_1170(D)
+	.loc 1 44 1391 is_stmt 1 view .LVU2279
+.LVL406:
+.LBB1221:
+.LBI1221:
+	.loc 1 5 19 view .LVU2280
+.LBB1222:
+	.loc 1 5 46 view .LVU2281
+# blake2b-generic.c:5: static inline u64 ror64(unsigned l, u64 x) { return (x >> l) | (x << (64-l)); }
+	.loc 1 5 62 is_stmt 0 view .LVU2282
+	rolq	$32, %r12	#, _1797
+.LVL407:
+	.loc 1 5 62 view .LVU2283
+.LBE1222:
+.LBE1221:
+# blake2b-generic.c:44:     FULLROUND(6);
+	.loc 1 44 1439 view .LVU2284
+	addq	%r12, %r14	# _1797, _645
+# blake2b-generic.c:44:     FULLROUND(6);
+	.loc 1 44 1399 view .LVU2285
+	movq	%r12, 120(%rax)	# _1797, MEM[(u64 *)v_1170(D) + 120B]
+	.loc 1 44 1431 is_stmt 1 view .LVU2286
+# blake2b-generic.c:44:     FULLROUND(6);
+	.loc 1 44 1461 is_stmt 0 view .LVU2287
+	xorq	%r14, %rbp	# _645, tmp2063
+# blake2b-generic.c:44:     FULLROUND(6);
+	.loc 1 44 1439 view .LVU2288
+	movq	%r14, 80(%rax)	# _645, MEM[(u64 *)v_1170(D) + 80B]
+	.loc 1 44 1451 is_stmt 1 view .LVU2289
+.LVL408:
+.LBB1223:
+.LBI1223:
+	.loc 1 5 19 view .LVU2290
+.LBB1224:
+	.loc 1 5 46 view .LVU2291
+# blake2b-generic.c:5: static inline u64 ror64(unsigned l, u64 x) { return (x >> l) | (x << (64-l)); }
+	.loc 1 5 62 is_stmt 0 view .LVU2292
+	rorq	$24, %rbp	#, _1800
+.LVL409:
+	.loc 1 5 62 view .LVU2293
+.LBE1224:
+.LBE1223:
+# blake2b-generic.c:44:     FULLROUND(6);
+	.loc 1 44 1459 view .LVU2294
+	movq	%rbp, 40(%rax)	# _1800, MEM[(u64 *)v_1170(D) + 40B]
+	.loc 1 44 1491 is_stmt 1 view .LVU2295
+# blake2b-generic.c:44:     FULLROUND(6);
+	.loc 1 44 1499 is_stmt 0 view .LVU2296
+	addq	56(%r9), %r8	# MEM[(const u64 *)m_1171(D) + 56B], tmp2064
+	addq	%rbp, %r8	# _1800, _649
+# blake2b-generic.c:44:     FULLROUND(6);
+	.loc 1 44 1557 view .LVU2297
+	xorq	%r8, %r12	# _649, tmp2066
+# blake2b-generic.c:44:     FULLROUND(6);
+	.loc 1 44 1499 view .LVU2298
+	movq	%r8, (%rax)	# _649, *v_1170(D)
+	.loc 1 44 1547 is_stmt 1 view .LVU2299
+.LVL410:
+.LBB1225:
+.LBI1225:
+	.loc 1 5 19 view .LVU2300
+.LBB1226:
+	.loc 1 5 46 view .LVU2301
+# blake2b-generic.c:5: static inline u64 ror64(unsigned l, u64 x) { return (x >> l) | (x << (64-l)); }
+	.loc 1 5 62 is_stmt 0 view .LVU2302
+	rorq	$16, %r12	#, tmp2066
+.LBE1226:
+.LBE1225:
+# blake2b-generic.c:44:     FULLROUND(6);
+	.loc 1 44 1595 view .LVU2303
+	addq	%r12, %r14	# _1803, _651
+# blake2b-generic.c:44:     FULLROUND(6);
+	.loc 1 44 1555 view .LVU2304
+	movq	%r12, 120(%rax)	# _1803, MEM[(u64 *)v_1170(D) + 120B]
+	.loc 1 44 1587 is_stmt 1 view .LVU2305
+# blake2b-generic.c:44:     FULLROUND(6);
+	.loc 1 44 1617 is_stmt 0 view .LVU2306
+	xorq	%r14, %rbp	# _651, tmp2067
+# blake2b-generic.c:44:     FULLROUND(6);
+	.loc 1 44 1595 view .LVU2307
+	movq	%r14, 80(%rax)	# _651, MEM[(u64 *)v_1170(D) + 80B]
+	.loc 1 44 1607 is_stmt 1 view .LVU2308
+.LVL411:
+.LBB1227:
+.LBI1227:
+	.loc 1 5 19 view .LVU2309
+.LBB1228:
+	.loc 1 5 46 view .LVU2310
+# blake2b-generic.c:5: static inline u64 ror64(unsigned l, u64 x) { return (x >> l) | (x << (64-l)); }
+	.loc 1 5 62 is_stmt 0 view .LVU2311
+	rolq	%rbp	# _1806
+.LVL412:
+	.loc 1 5 62 view .LVU2312
+.LBE1228:
+.LBE1227:
+# blake2b-generic.c:44:     FULLROUND(6);
+	.loc 1 44 1595 view .LVU2313
+	movq	%r12, -40(%rsp)	# _1803, %sfp
+# blake2b-generic.c:44:     FULLROUND(6);
+	.loc 1 44 1615 view .LVU2314
+	movq	%rbp, 40(%rax)	# _1806, MEM[(u64 *)v_1170(D) + 40B]
+	.loc 1 44 1333 is_stmt 1 view .LVU2315
+	.loc 1 44 1660 view .LVU2316
+	.loc 1 44 1665 view .LVU2317
+# blake2b-generic.c:44:     FULLROUND(6);
+	.loc 1 44 1673 is_stmt 0 view .LVU2318
+	addq	48(%r9), %rsi	# MEM[(const u64 *)m_1171(D) + 48B], tmp2068
+	addq	%rbx, %rsi	# _1782, _655
+# blake2b-generic.c:44:     FULLROUND(6);
+	.loc 1 44 1617 view .LVU2319
+	movq	%r14, -72(%rsp)	# _651, %sfp
+# blake2b-generic.c:44:     FULLROUND(6);
+	.loc 1 44 2337 view .LVU2320
+	movq	-48(%rsp), %r14	# %sfp, _1758
+# blake2b-generic.c:44:     FULLROUND(6);
+	.loc 1 44 1732 view .LVU2321
+	xorq	%rsi, %rdi	# _655, tmp2070
+# blake2b-generic.c:44:     FULLROUND(6);
+	.loc 1 44 1673 view .LVU2322
+	movq	%rsi, 8(%rax)	# _655, MEM[(u64 *)v_1170(D) + 8B]
+	.loc 1 44 1722 is_stmt 1 view .LVU2323
+.LVL413:
+.LBB1229:
+.LBI1229:
+	.loc 1 5 19 view .LVU2324
+.LBB1230:
+	.loc 1 5 46 view .LVU2325
+# blake2b-generic.c:5: static inline u64 ror64(unsigned l, u64 x) { return (x >> l) | (x << (64-l)); }
+	.loc 1 5 62 is_stmt 0 view .LVU2326
+	rolq	$32, %rdi	#, _1809
+.LVL414:
+	.loc 1 5 62 view .LVU2327
+.LBE1230:
+.LBE1229:
+# blake2b-generic.c:44:     FULLROUND(6);
+	.loc 1 44 1770 view .LVU2328
+	addq	%rdi, %r15	# _1809, _657
+# blake2b-generic.c:44:     FULLROUND(6);
+	.loc 1 44 1730 view .LVU2329
+	movq	%rdi, 96(%rax)	# _1809, MEM[(u64 *)v_1170(D) + 96B]
+	.loc 1 44 1762 is_stmt 1 view .LVU2330
+# blake2b-generic.c:44:     FULLROUND(6);
+	.loc 1 44 1792 is_stmt 0 view .LVU2331
+	xorq	%r15, %rbx	# _657, tmp2071
+# blake2b-generic.c:44:     FULLROUND(6);
+	.loc 1 44 1770 view .LVU2332
+	movq	%r15, 88(%rax)	# _657, MEM[(u64 *)v_1170(D) + 88B]
+	.loc 1 44 1782 is_stmt 1 view .LVU2333
+.LVL415:
+.LBB1231:
+.LBI1231:
+	.loc 1 5 19 view .LVU2334
+.LBB1232:
+	.loc 1 5 46 view .LVU2335
+# blake2b-generic.c:5: static inline u64 ror64(unsigned l, u64 x) { return (x >> l) | (x << (64-l)); }
+	.loc 1 5 62 is_stmt 0 view .LVU2336
+	rorq	$24, %rbx	#, _1812
+.LVL416:
+	.loc 1 5 62 view .LVU2337
+.LBE1232:
+.LBE1231:
+# blake2b-generic.c:44:     FULLROUND(6);
+	.loc 1 44 1790 view .LVU2338
+	movq	%rbx, 48(%rax)	# _1812, MEM[(u64 *)v_1170(D) + 48B]
+	.loc 1 44 1822 is_stmt 1 view .LVU2339
+# blake2b-generic.c:44:     FULLROUND(6);
+	.loc 1 44 1830 is_stmt 0 view .LVU2340
+	addq	24(%r9), %rsi	# MEM[(const u64 *)m_1171(D) + 24B], tmp2072
+	addq	%rbx, %rsi	# _1812, _661
+# blake2b-generic.c:44:     FULLROUND(6);
+	.loc 1 44 1889 view .LVU2341
+	xorq	%rsi, %rdi	# _661, tmp2074
+# blake2b-generic.c:44:     FULLROUND(6);
+	.loc 1 44 1830 view .LVU2342
+	movq	%rsi, 8(%rax)	# _661, MEM[(u64 *)v_1170(D) + 8B]
+	.loc 1 44 1879 is_stmt 1 view .LVU2343
+.LVL417:
+.LBB1233:
+.LBI1233:
+	.loc 1 5 19 view .LVU2344
+.LBB1234:
+	.loc 1 5 46 view .LVU2345
+# blake2b-generic.c:5: static inline u64 ror64(unsigned l, u64 x) { return (x >> l) | (x << (64-l)); }
+	.loc 1 5 62 is_stmt 0 view .LVU2346
+	rorq	$16, %rdi	#, _1815
+.LVL418:
+	.loc 1 5 62 view .LVU2347
+.LBE1234:
+.LBE1233:
+# blake2b-generic.c:44:     FULLROUND(6);
+	.loc 1 44 1927 view .LVU2348
+	addq	%rdi, %r15	# _1815, _663
+# blake2b-generic.c:44:     FULLROUND(6);
+	.loc 1 44 1887 view .LVU2349
+	movq	%rdi, 96(%rax)	# _1815, MEM[(u64 *)v_1170(D) + 96B]
+	.loc 1 44 1919 is_stmt 1 view .LVU2350
+# blake2b-generic.c:44:     FULLROUND(6);
+	.loc 1 44 1949 is_stmt 0 view .LVU2351
+	xorq	%r15, %rbx	# _663, tmp2075
+# blake2b-generic.c:44:     FULLROUND(6);
+	.loc 1 44 1927 view .LVU2352
+	movq	%r15, 88(%rax)	# _663, MEM[(u64 *)v_1170(D) + 88B]
+	.loc 1 44 1939 is_stmt 1 view .LVU2353
+.LVL419:
+.LBB1235:
+.LBI1235:
+	.loc 1 5 19 view .LVU2354
+.LBB1236:
+	.loc 1 5 46 view .LVU2355
+# blake2b-generic.c:5: static inline u64 ror64(unsigned l, u64 x) { return (x >> l) | (x << (64-l)); }
+	.loc 1 5 62 is_stmt 0 view .LVU2356
+	rolq	%rbx	# _1818
+.LVL420:
+	.loc 1 5 62 view .LVU2357
+.LBE1236:
+.LBE1235:
+# blake2b-generic.c:44:     FULLROUND(6);
+	.loc 1 44 1949 view .LVU2358
+	movq	%r15, -64(%rsp)	# _663, %sfp
+# blake2b-generic.c:44:     FULLROUND(6);
+	.loc 1 44 2102 view .LVU2359
+	movq	-80(%rsp), %r15	# %sfp, _603
+# blake2b-generic.c:44:     FULLROUND(6);
+	.loc 1 44 1947 view .LVU2360
+	movq	%rbx, 48(%rax)	# _1818, MEM[(u64 *)v_1170(D) + 48B]
+	.loc 1 44 1663 is_stmt 1 view .LVU2361
+	.loc 1 44 1992 view .LVU2362
+	.loc 1 44 1997 view .LVU2363
+# blake2b-generic.c:44:     FULLROUND(6);
+	.loc 1 44 2005 is_stmt 0 view .LVU2364
+	addq	72(%r9), %rdx	# MEM[(const u64 *)m_1171(D) + 72B], tmp2076
+	addq	%r11, %rdx	# _1794, _667
+# blake2b-generic.c:44:     FULLROUND(6);
+	.loc 1 44 2064 view .LVU2365
+	xorq	%rdx, %rcx	# _667, tmp2078
+# blake2b-generic.c:44:     FULLROUND(6);
+	.loc 1 44 2005 view .LVU2366
+	movq	%rdx, 16(%rax)	# _667, MEM[(u64 *)v_1170(D) + 16B]
+	.loc 1 44 2054 is_stmt 1 view .LVU2367
+.LVL421:
+.LBB1237:
+.LBI1237:
+	.loc 1 5 19 view .LVU2368
+.LBB1238:
+	.loc 1 5 46 view .LVU2369
+# blake2b-generic.c:5: static inline u64 ror64(unsigned l, u64 x) { return (x >> l) | (x << (64-l)); }
+	.loc 1 5 62 is_stmt 0 view .LVU2370
+	rolq	$32, %rcx	#, _1821
+.LVL422:
+	.loc 1 5 62 view .LVU2371
+.LBE1238:
+.LBE1237:
+# blake2b-generic.c:44:     FULLROUND(6);
+	.loc 1 44 2102 view .LVU2372
+	leaq	(%r15,%rcx), %r12	#, _669
+# blake2b-generic.c:44:     FULLROUND(6);
+	.loc 1 44 2062 view .LVU2373
+	movq	%rcx, 104(%rax)	# _1821, MEM[(u64 *)v_1170(D) + 104B]
+	.loc 1 44 2094 is_stmt 1 view .LVU2374
+# blake2b-generic.c:44:     FULLROUND(6);
+	.loc 1 44 2124 is_stmt 0 view .LVU2375
+	xorq	%r12, %r11	# _669, tmp2079
+# blake2b-generic.c:44:     FULLROUND(6);
+	.loc 1 44 2102 view .LVU2376
+	movq	%r12, 64(%rax)	# _669, MEM[(u64 *)v_1170(D) + 64B]
+	.loc 1 44 2114 is_stmt 1 view .LVU2377
+.LVL423:
+.LBB1239:
+.LBI1239:
+	.loc 1 5 19 view .LVU2378
+.LBB1240:
+	.loc 1 5 46 view .LVU2379
+# blake2b-generic.c:5: static inline u64 ror64(unsigned l, u64 x) { return (x >> l) | (x << (64-l)); }
+	.loc 1 5 62 is_stmt 0 view .LVU2380
+	rorq	$24, %r11	#, _1824
+.LVL424:
+	.loc 1 5 62 view .LVU2381
+.LBE1240:
+.LBE1239:
+# blake2b-generic.c:44:     FULLROUND(6);
+	.loc 1 44 2122 view .LVU2382
+	movq	%r11, 56(%rax)	# _1824, MEM[(u64 *)v_1170(D) + 56B]
+	.loc 1 44 2154 is_stmt 1 view .LVU2383
+# blake2b-generic.c:44:     FULLROUND(6);
+	.loc 1 44 2162 is_stmt 0 view .LVU2384
+	addq	16(%r9), %rdx	# MEM[(const u64 *)m_1171(D) + 16B], tmp2080
+	addq	%r11, %rdx	# _1824, _673
+# blake2b-generic.c:44:     FULLROUND(6);
+	.loc 1 44 2221 view .LVU2385
+	xorq	%rdx, %rcx	# _673, tmp2082
+# blake2b-generic.c:44:     FULLROUND(6);
+	.loc 1 44 2162 view .LVU2386
+	movq	%rdx, 16(%rax)	# _673, MEM[(u64 *)v_1170(D) + 16B]
+	.loc 1 44 2211 is_stmt 1 view .LVU2387
+.LVL425:
+.LBB1241:
+.LBI1241:
+	.loc 1 5 19 view .LVU2388
+.LBB1242:
+	.loc 1 5 46 view .LVU2389
+# blake2b-generic.c:5: static inline u64 ror64(unsigned l, u64 x) { return (x >> l) | (x << (64-l)); }
+	.loc 1 5 62 is_stmt 0 view .LVU2390
+	rorq	$16, %rcx	#, _1827
+.LVL426:
+	.loc 1 5 62 view .LVU2391
+.LBE1242:
+.LBE1241:
+# blake2b-generic.c:44:     FULLROUND(6);
+	.loc 1 44 2259 view .LVU2392
+	addq	%rcx, %r12	# _1827, _675
+# blake2b-generic.c:44:     FULLROUND(6);
+	.loc 1 44 2219 view .LVU2393
+	movq	%rcx, 104(%rax)	# _1827, MEM[(u64 *)v_1170(D) + 104B]
+	.loc 1 44 2251 is_stmt 1 view .LVU2394
+# blake2b-generic.c:44:     FULLROUND(6);
+	.loc 1 44 2281 is_stmt 0 view .LVU2395
+	xorq	%r12, %r11	# _675, tmp2083
+# blake2b-generic.c:44:     FULLROUND(6);
+	.loc 1 44 2259 view .LVU2396
+	movq	%r12, 64(%rax)	# _675, MEM[(u64 *)v_1170(D) + 64B]
+	.loc 1 44 2271 is_stmt 1 view .LVU2397
+.LVL427:
+.LBB1243:
+.LBI1243:
+	.loc 1 5 19 view .LVU2398
+.LBB1244:
+	.loc 1 5 46 view .LVU2399
+# blake2b-generic.c:5: static inline u64 ror64(unsigned l, u64 x) { return (x >> l) | (x << (64-l)); }
+	.loc 1 5 62 is_stmt 0 view .LVU2400
+	rolq	%r11	# _1830
+.LVL428:
+	.loc 1 5 62 view .LVU2401
+.LBE1244:
+.LBE1243:
+# blake2b-generic.c:44:     FULLROUND(6);
+	.loc 1 44 2279 view .LVU2402
+	movq	%r11, 56(%rax)	# _1830, MEM[(u64 *)v_1170(D) + 56B]
+	.loc 1 44 1995 is_stmt 1 view .LVU2403
+	.loc 1 44 2324 view .LVU2404
+	.loc 1 44 2329 view .LVU2405
+# blake2b-generic.c:44:     FULLROUND(6);
+	.loc 1 44 2337 is_stmt 0 view .LVU2406
+	addq	64(%r9), %r10	# MEM[(const u64 *)m_1171(D) + 64B], tmp2084
+	addq	%r14, %r10	# _1758, _679
+# blake2b-generic.c:44:     FULLROUND(6);
+	.loc 1 44 2396 view .LVU2407
+	xorq	%r10, %r13	# _679, tmp2086
+# blake2b-generic.c:44:     FULLROUND(6);
+	.loc 1 44 2337 view .LVU2408
+	movq	%r10, 24(%rax)	# _679, MEM[(u64 *)v_1170(D) + 24B]
+	.loc 1 44 2386 is_stmt 1 view .LVU2409
+.LVL429:
+.LBB1245:
+.LBI1245:
+	.loc 1 5 19 view .LVU2410
+.LBB1246:
+	.loc 1 5 46 view .LVU2411
+# blake2b-generic.c:5: static inline u64 ror64(unsigned l, u64 x) { return (x >> l) | (x << (64-l)); }
+	.loc 1 5 62 is_stmt 0 view .LVU2412
+	rolq	$32, %r13	#, _1833
+.LVL430:
+	.loc 1 5 62 view .LVU2413
+.LBE1246:
+.LBE1245:
+# blake2b-generic.c:44:     FULLROUND(6);
+	.loc 1 44 2394 view .LVU2414
+	movq	%r13, 112(%rax)	# _1833, MEM[(u64 *)v_1170(D) + 112B]
+	.loc 1 44 2426 is_stmt 1 view .LVU2415
+# blake2b-generic.c:44:     FULLROUND(6);
+	.loc 1 44 2434 is_stmt 0 view .LVU2416
+	movq	-56(%rsp), %r15	# %sfp, _615
+	addq	%r13, %r15	# _1833, _681
+# blake2b-generic.c:44:     FULLROUND(6);
+	.loc 1 44 2456 view .LVU2417
+	xorq	%r15, %r14	# _681, _1758
+# blake2b-generic.c:44:     FULLROUND(6);
+	.loc 1 44 2434 view .LVU2418
+	movq	%r15, 72(%rax)	# _681, MEM[(u64 *)v_1170(D) + 72B]
+	.loc 1 44 2446 is_stmt 1 view .LVU2419
+.LVL431:
+.LBB1247:
+.LBI1247:
+	.loc 1 5 19 view .LVU2420
+.LBB1248:
+	.loc 1 5 46 view .LVU2421
+# blake2b-generic.c:5: static inline u64 ror64(unsigned l, u64 x) { return (x >> l) | (x << (64-l)); }
+	.loc 1 5 62 is_stmt 0 view .LVU2422
+	rorq	$24, %r14	#, _1836
+.LVL432:
+	.loc 1 5 62 view .LVU2423
+.LBE1248:
+.LBE1247:
+# blake2b-generic.c:44:     FULLROUND(6);
+	.loc 1 44 2454 view .LVU2424
+	movq	%r14, 32(%rax)	# _1836, MEM[(u64 *)v_1170(D) + 32B]
+	.loc 1 44 2486 is_stmt 1 view .LVU2425
+# blake2b-generic.c:44:     FULLROUND(6);
+	.loc 1 44 2494 is_stmt 0 view .LVU2426
+	addq	88(%r9), %r10	# MEM[(const u64 *)m_1171(D) + 88B], tmp2088
+	addq	%r14, %r10	# _1836, _685
+# blake2b-generic.c:44:     FULLROUND(6);
+	.loc 1 44 2553 view .LVU2427
+	xorq	%r10, %r13	# _685, tmp2090
+# blake2b-generic.c:44:     FULLROUND(6);
+	.loc 1 44 2494 view .LVU2428
+	movq	%r10, 24(%rax)	# _685, MEM[(u64 *)v_1170(D) + 24B]
+	.loc 1 44 2543 is_stmt 1 view .LVU2429
+.LVL433:
+.LBB1249:
+.LBI1249:
+	.loc 1 5 19 view .LVU2430
+.LBB1250:
+	.loc 1 5 46 view .LVU2431
+# blake2b-generic.c:5: static inline u64 ror64(unsigned l, u64 x) { return (x >> l) | (x << (64-l)); }
+	.loc 1 5 62 is_stmt 0 view .LVU2432
+	rorq	$16, %r13	#, _1839
+.LVL434:
+	.loc 1 5 62 view .LVU2433
+.LBE1250:
+.LBE1249:
+# blake2b-generic.c:44:     FULLROUND(6);
+	.loc 1 44 2591 view .LVU2434
+	addq	%r13, %r15	# _1839, _687
+# blake2b-generic.c:44:     FULLROUND(6);
+	.loc 1 44 2551 view .LVU2435
+	movq	%r13, 112(%rax)	# _1839, MEM[(u64 *)v_1170(D) + 112B]
+	.loc 1 44 2583 is_stmt 1 view .LVU2436
+# blake2b-generic.c:44:     FULLROUND(6);
+	.loc 1 44 2613 is_stmt 0 view .LVU2437
+	xorq	%r15, %r14	# _687, tmp2091
+# blake2b-generic.c:44:     FULLROUND(6);
+	.loc 1 44 2591 view .LVU2438
+	movq	%r15, 72(%rax)	# _687, MEM[(u64 *)v_1170(D) + 72B]
+	.loc 1 44 2603 is_stmt 1 view .LVU2439
+.LVL435:
+.LBB1251:
+.LBI1251:
+	.loc 1 5 19 view .LVU2440
+.LBB1252:
+	.loc 1 5 46 view .LVU2441
+# blake2b-generic.c:5: static inline u64 ror64(unsigned l, u64 x) { return (x >> l) | (x << (64-l)); }
+	.loc 1 5 62 is_stmt 0 view .LVU2442
+	rolq	%r14	# _1842
+.LVL436:
+	.loc 1 5 62 view .LVU2443
+.LBE1252:
+.LBE1251:
+# blake2b-generic.c:44:     FULLROUND(6);
+	.loc 1 44 2611 view .LVU2444
+	movq	%r14, 32(%rax)	# _1842, MEM[(u64 *)v_1170(D) + 32B]
+	.loc 1 44 2327 is_stmt 1 view .LVU2445
+	.loc 1 44 8 view .LVU2446
+	.loc 1 45 5 view .LVU2447
+	.loc 1 45 10 view .LVU2448
+	.loc 1 45 15 view .LVU2449
+# blake2b-generic.c:45:     FULLROUND(7);
+	.loc 1 45 23 is_stmt 0 view .LVU2450
+	addq	104(%r9), %r8	# MEM[(const u64 *)m_1171(D) + 104B], tmp2092
+	addq	%r14, %r8	# _1842, _691
+# blake2b-generic.c:45:     FULLROUND(7);
+	.loc 1 45 81 view .LVU2451
+	xorq	%r8, %rdi	# _691, tmp2094
+# blake2b-generic.c:45:     FULLROUND(7);
+	.loc 1 45 23 view .LVU2452
+	movq	%r8, (%rax)	# _691, *v_1170(D)
+	.loc 1 45 71 is_stmt 1 view .LVU2453
+.LVL437:
+.LBB1253:
+.LBI1253:
+	.loc 1 5 19 view .LVU2454
+.LBB1254:
+	.loc 1 5 46 view .LVU2455
+# blake2b-generic.c:5: static inline u64 ror64(unsigned l, u64 x) { return (x >> l) | (x << (64-l)); }
+	.loc 1 5 62 is_stmt 0 view .LVU2456
+	rolq	$32, %rdi	#, _1845
+.LVL438:
+	.loc 1 5 62 view .LVU2457
+.LBE1254:
+.LBE1253:
+# blake2b-generic.c:45:     FULLROUND(7);
+	.loc 1 45 119 view .LVU2458
+	addq	%rdi, %r12	# _1845, _693
+# blake2b-generic.c:45:     FULLROUND(7);
+	.loc 1 45 79 view .LVU2459
+	movq	%rdi, 96(%rax)	# _1845, MEM[(u64 *)v_1170(D) + 96B]
+	.loc 1 45 111 is_stmt 1 view .LVU2460
+# blake2b-generic.c:45:     FULLROUND(7);
+	.loc 1 45 141 is_stmt 0 view .LVU2461
+	xorq	%r12, %r14	# _693, tmp2095
+# blake2b-generic.c:45:     FULLROUND(7);
+	.loc 1 45 119 view .LVU2462
+	movq	%r12, 64(%rax)	# _693, MEM[(u64 *)v_1170(D) + 64B]
+	.loc 1 45 131 is_stmt 1 view .LVU2463
+.LVL439:
+.LBB1255:
+.LBI1255:
+	.loc 1 5 19 view .LVU2464
+.LBB1256:
+	.loc 1 5 46 view .LVU2465
+# blake2b-generic.c:5: static inline u64 ror64(unsigned l, u64 x) { return (x >> l) | (x << (64-l)); }
+	.loc 1 5 62 is_stmt 0 view .LVU2466
+	rorq	$24, %r14	#, _1848
+.LVL440:
+	.loc 1 5 62 view .LVU2467
+.LBE1256:
+.LBE1255:
+# blake2b-generic.c:45:     FULLROUND(7);
+	.loc 1 45 139 view .LVU2468
+	movq	%r14, 32(%rax)	# _1848, MEM[(u64 *)v_1170(D) + 32B]
+	.loc 1 45 171 is_stmt 1 view .LVU2469
+# blake2b-generic.c:45:     FULLROUND(7);
+	.loc 1 45 179 is_stmt 0 view .LVU2470
+	addq	88(%r9), %r8	# MEM[(const u64 *)m_1171(D) + 88B], tmp2096
+	addq	%r14, %r8	# _1848, _697
+# blake2b-generic.c:45:     FULLROUND(7);
+	.loc 1 45 237 view .LVU2471
+	xorq	%r8, %rdi	# _697, tmp2098
+# blake2b-generic.c:45:     FULLROUND(7);
+	.loc 1 45 179 view .LVU2472
+	movq	%r8, (%rax)	# _697, *v_1170(D)
+	.loc 1 45 227 is_stmt 1 view .LVU2473
+.LVL441:
+.LBB1257:
+.LBI1257:
+	.loc 1 5 19 view .LVU2474
+.LBB1258:
+	.loc 1 5 46 view .LVU2475
+# blake2b-generic.c:5: static inline u64 ror64(unsigned l, u64 x) { return (x >> l) | (x << (64-l)); }
+	.loc 1 5 62 is_stmt 0 view .LVU2476
+	rorq	$16, %rdi	#, _1851
+.LVL442:
+	.loc 1 5 62 view .LVU2477
+.LBE1258:
+.LBE1257:
+# blake2b-generic.c:45:     FULLROUND(7);
+	.loc 1 45 275 view .LVU2478
+	addq	%rdi, %r12	# _1851, _699
+# blake2b-generic.c:45:     FULLROUND(7);
+	.loc 1 45 235 view .LVU2479
+	movq	%rdi, 96(%rax)	# _1851, MEM[(u64 *)v_1170(D) + 96B]
+	.loc 1 45 267 is_stmt 1 view .LVU2480
+# blake2b-generic.c:45:     FULLROUND(7);
+	.loc 1 45 297 is_stmt 0 view .LVU2481
+	xorq	%r12, %r14	# _699, tmp2099
+# blake2b-generic.c:45:     FULLROUND(7);
+	.loc 1 45 275 view .LVU2482
+	movq	%r12, 64(%rax)	# _699, MEM[(u64 *)v_1170(D) + 64B]
+	.loc 1 45 287 is_stmt 1 view .LVU2483
+.LVL443:
+.LBB1259:
+.LBI1259:
+	.loc 1 5 19 view .LVU2484
+.LBB1260:
+	.loc 1 5 46 view .LVU2485
+# blake2b-generic.c:5: static inline u64 ror64(unsigned l, u64 x) { return (x >> l) | (x << (64-l)); }
+	.loc 1 5 62 is_stmt 0 view .LVU2486
+	rolq	%r14	# tmp2099
+.LBE1260:
+.LBE1259:
+# blake2b-generic.c:45:     FULLROUND(7);
+	.loc 1 45 297 view .LVU2487
+	movq	%r12, -80(%rsp)	# _699, %sfp
+# blake2b-generic.c:45:     FULLROUND(7);
+	.loc 1 45 295 view .LVU2488
+	movq	%r14, 32(%rax)	# _1854, MEM[(u64 *)v_1170(D) + 32B]
+	.loc 1 45 13 is_stmt 1 view .LVU2489
+	.loc 1 45 340 view .LVU2490
+	.loc 1 45 345 view .LVU2491
+# blake2b-generic.c:45:     FULLROUND(7);
+	.loc 1 45 353 is_stmt 0 view .LVU2492
+	addq	56(%r9), %rsi	# MEM[(const u64 *)m_1171(D) + 56B], tmp2100
+	addq	%rbp, %rsi	# _1806, _703
+# blake2b-generic.c:45:     FULLROUND(7);
+	.loc 1 45 295 view .LVU2493
+	movq	%r14, -48(%rsp)	# _1854, %sfp
+# blake2b-generic.c:45:     FULLROUND(7);
+	.loc 1 45 411 view .LVU2494
+	xorq	%rsi, %rcx	# _703, tmp2102
+# blake2b-generic.c:45:     FULLROUND(7);
+	.loc 1 45 353 view .LVU2495
+	movq	%rsi, 8(%rax)	# _703, MEM[(u64 *)v_1170(D) + 8B]
+	.loc 1 45 401 is_stmt 1 view .LVU2496
+.LVL444:
+.LBB1261:
+.LBI1261:
+	.loc 1 5 19 view .LVU2497
+.LBB1262:
+	.loc 1 5 46 view .LVU2498
+# blake2b-generic.c:5: static inline u64 ror64(unsigned l, u64 x) { return (x >> l) | (x << (64-l)); }
+	.loc 1 5 62 is_stmt 0 view .LVU2499
+	rolq	$32, %rcx	#, _1857
+.LVL445:
+	.loc 1 5 62 view .LVU2500
+.LBE1262:
+.LBE1261:
+# blake2b-generic.c:45:     FULLROUND(7);
+	.loc 1 45 449 view .LVU2501
+	addq	%rcx, %r15	# _1857, _705
+# blake2b-generic.c:45:     FULLROUND(7);
+	.loc 1 45 409 view .LVU2502
+	movq	%rcx, 104(%rax)	# _1857, MEM[(u64 *)v_1170(D) + 104B]
+	.loc 1 45 441 is_stmt 1 view .LVU2503
+# blake2b-generic.c:45:     FULLROUND(7);
+	.loc 1 45 471 is_stmt 0 view .LVU2504
+	xorq	%r15, %rbp	# _705, tmp2103
+# blake2b-generic.c:45:     FULLROUND(7);
+	.loc 1 45 449 view .LVU2505
+	movq	%r15, 72(%rax)	# _705, MEM[(u64 *)v_1170(D) + 72B]
+	.loc 1 45 461 is_stmt 1 view .LVU2506
+.LVL446:
+.LBB1263:
+.LBI1263:
+	.loc 1 5 19 view .LVU2507
+.LBB1264:
+	.loc 1 5 46 view .LVU2508
+# blake2b-generic.c:5: static inline u64 ror64(unsigned l, u64 x) { return (x >> l) | (x << (64-l)); }
+	.loc 1 5 62 is_stmt 0 view .LVU2509
+	rorq	$24, %rbp	#, _1860
+.LVL447:
+	.loc 1 5 62 view .LVU2510
+.LBE1264:
+.LBE1263:
+# blake2b-generic.c:45:     FULLROUND(7);
+	.loc 1 45 469 view .LVU2511
+	movq	%rbp, 40(%rax)	# _1860, MEM[(u64 *)v_1170(D) + 40B]
+	.loc 1 45 501 is_stmt 1 view .LVU2512
+# blake2b-generic.c:45:     FULLROUND(7);
+	.loc 1 45 509 is_stmt 0 view .LVU2513
+	addq	112(%r9), %rsi	# MEM[(const u64 *)m_1171(D) + 112B], tmp2104
+	addq	%rbp, %rsi	# _1860, _709
+# blake2b-generic.c:45:     FULLROUND(7);
+	.loc 1 45 567 view .LVU2514
+	xorq	%rsi, %rcx	# _709, tmp2106
+# blake2b-generic.c:45:     FULLROUND(7);
+	.loc 1 45 509 view .LVU2515
+	movq	%rsi, 8(%rax)	# _709, MEM[(u64 *)v_1170(D) + 8B]
+	.loc 1 45 557 is_stmt 1 view .LVU2516
+.LVL448:
+.LBB1265:
+.LBI1265:
+	.loc 1 5 19 view .LVU2517
+.LBB1266:
+	.loc 1 5 46 view .LVU2518
+# blake2b-generic.c:5: static inline u64 ror64(unsigned l, u64 x) { return (x >> l) | (x << (64-l)); }
+	.loc 1 5 62 is_stmt 0 view .LVU2519
+	rorq	$16, %rcx	#, _1863
+.LVL449:
+	.loc 1 5 62 view .LVU2520
+.LBE1266:
+.LBE1265:
+# blake2b-generic.c:45:     FULLROUND(7);
+	.loc 1 45 605 view .LVU2521
+	addq	%rcx, %r15	# _1863, _711
+# blake2b-generic.c:45:     FULLROUND(7);
+	.loc 1 45 565 view .LVU2522
+	movq	%rcx, 104(%rax)	# _1863, MEM[(u64 *)v_1170(D) + 104B]
+	.loc 1 45 597 is_stmt 1 view .LVU2523
+# blake2b-generic.c:45:     FULLROUND(7);
+	.loc 1 45 627 is_stmt 0 view .LVU2524
+	xorq	%r15, %rbp	# _711, tmp2107
+# blake2b-generic.c:45:     FULLROUND(7);
+	.loc 1 45 605 view .LVU2525
+	movq	%r15, 72(%rax)	# _711, MEM[(u64 *)v_1170(D) + 72B]
+	.loc 1 45 617 is_stmt 1 view .LVU2526
+.LVL450:
+.LBB1267:
+.LBI1267:
+	.loc 1 5 19 view .LVU2527
+.LBB1268:
+	.loc 1 5 46 view .LVU2528
+# blake2b-generic.c:5: static inline u64 ror64(unsigned l, u64 x) { return (x >> l) | (x << (64-l)); }
+	.loc 1 5 62 is_stmt 0 view .LVU2529
+	rolq	%rbp	# _1866
+.LVL451:
+	.loc 1 5 62 view .LVU2530
+.LBE1268:
+.LBE1267:
+# blake2b-generic.c:45:     FULLROUND(7);
+	.loc 1 45 627 view .LVU2531
+	movq	%r15, -56(%rsp)	# _711, %sfp
+# blake2b-generic.c:45:     FULLROUND(7);
+	.loc 1 45 625 view .LVU2532
+	movq	%rbp, 40(%rax)	# _1866, MEM[(u64 *)v_1170(D) + 40B]
+	.loc 1 45 343 is_stmt 1 view .LVU2533
+	.loc 1 45 670 view .LVU2534
+	.loc 1 45 675 view .LVU2535
+# blake2b-generic.c:45:     FULLROUND(7);
+	.loc 1 45 683 is_stmt 0 view .LVU2536
+	addq	96(%r9), %rdx	# MEM[(const u64 *)m_1171(D) + 96B], tmp2108
+	addq	%rbx, %rdx	# _1818, _715
+	movq	%rdx, 16(%rax)	# _715, MEM[(u64 *)v_1170(D) + 16B]
+	.loc 1 45 731 is_stmt 1 view .LVU2537
+.LVL452:
+.LBB1269:
+.LBI1269:
+	.loc 1 5 19 view .LVU2538
+.LBB1270:
+	.loc 1 5 46 view .LVU2539
+.LBE1270:
+.LBE1269:
+# blake2b-generic.c:45:     FULLROUND(7);
+	.loc 1 45 741 is_stmt 0 view .LVU2540
+	xorq	%rdx, %r13	# _715, tmp2110
+.LVL453:
+# blake2b-generic.c:45:     FULLROUND(7);
+	.loc 1 45 779 view .LVU2541
+	movq	-72(%rsp), %r15	# %sfp, _651
+.LBB1272:
+.LBB1271:
+# blake2b-generic.c:5: static inline u64 ror64(unsigned l, u64 x) { return (x >> l) | (x << (64-l)); }
+	.loc 1 5 62 view .LVU2542
+	rolq	$32, %r13	#, _1869
+.LVL454:
+	.loc 1 5 62 view .LVU2543
+.LBE1271:
+.LBE1272:
+# blake2b-generic.c:45:     FULLROUND(7);
+	.loc 1 45 1071 view .LVU2544
+	movq	-40(%rsp), %r12	# %sfp, _1803
+# blake2b-generic.c:45:     FULLROUND(7);
+	.loc 1 45 779 view .LVU2545
+	leaq	(%r15,%r13), %r14	#, _717
+# blake2b-generic.c:45:     FULLROUND(7);
+	.loc 1 45 739 view .LVU2546
+	movq	%r13, 112(%rax)	# _1869, MEM[(u64 *)v_1170(D) + 112B]
+	.loc 1 45 771 is_stmt 1 view .LVU2547
+# blake2b-generic.c:45:     FULLROUND(7);
+	.loc 1 45 1109 is_stmt 0 view .LVU2548
+	movq	-64(%rsp), %r15	# %sfp, _663
+# blake2b-generic.c:45:     FULLROUND(7);
+	.loc 1 45 801 view .LVU2549
+	xorq	%r14, %rbx	# _717, tmp2111
+# blake2b-generic.c:45:     FULLROUND(7);
+	.loc 1 45 779 view .LVU2550
+	movq	%r14, 80(%rax)	# _717, MEM[(u64 *)v_1170(D) + 80B]
+	.loc 1 45 791 is_stmt 1 view .LVU2551
+.LVL455:
+.LBB1273:
+.LBI1273:
+	.loc 1 5 19 view .LVU2552
+.LBB1274:
+	.loc 1 5 46 view .LVU2553
+# blake2b-generic.c:5: static inline u64 ror64(unsigned l, u64 x) { return (x >> l) | (x << (64-l)); }
+	.loc 1 5 62 is_stmt 0 view .LVU2554
+	rorq	$24, %rbx	#, _1872
+.LVL456:
+	.loc 1 5 62 view .LVU2555
+.LBE1274:
+.LBE1273:
+# blake2b-generic.c:45:     FULLROUND(7);
+	.loc 1 45 799 view .LVU2556
+	movq	%rbx, 48(%rax)	# _1872, MEM[(u64 *)v_1170(D) + 48B]
+	.loc 1 45 831 is_stmt 1 view .LVU2557
+# blake2b-generic.c:45:     FULLROUND(7);
+	.loc 1 45 839 is_stmt 0 view .LVU2558
+	addq	8(%r9), %rdx	# MEM[(const u64 *)m_1171(D) + 8B], tmp2112
+	addq	%rbx, %rdx	# _1872, _721
+# blake2b-generic.c:45:     FULLROUND(7);
+	.loc 1 45 897 view .LVU2559
+	xorq	%rdx, %r13	# _721, tmp2114
+# blake2b-generic.c:45:     FULLROUND(7);
+	.loc 1 45 839 view .LVU2560
+	movq	%rdx, 16(%rax)	# _721, MEM[(u64 *)v_1170(D) + 16B]
+	.loc 1 45 887 is_stmt 1 view .LVU2561
+.LVL457:
+.LBB1275:
+.LBI1275:
+	.loc 1 5 19 view .LVU2562
+.LBB1276:
+	.loc 1 5 46 view .LVU2563
+# blake2b-generic.c:5: static inline u64 ror64(unsigned l, u64 x) { return (x >> l) | (x << (64-l)); }
+	.loc 1 5 62 is_stmt 0 view .LVU2564
+	rorq	$16, %r13	#, _1875
+.LVL458:
+	.loc 1 5 62 view .LVU2565
+.LBE1276:
+.LBE1275:
+# blake2b-generic.c:45:     FULLROUND(7);
+	.loc 1 45 935 view .LVU2566
+	addq	%r13, %r14	# _1875, _723
+# blake2b-generic.c:45:     FULLROUND(7);
+	.loc 1 45 895 view .LVU2567
+	movq	%r13, 112(%rax)	# _1875, MEM[(u64 *)v_1170(D) + 112B]
+	.loc 1 45 927 is_stmt 1 view .LVU2568
+# blake2b-generic.c:45:     FULLROUND(7);
+	.loc 1 45 957 is_stmt 0 view .LVU2569
+	xorq	%r14, %rbx	# _723, tmp2115
+# blake2b-generic.c:45:     FULLROUND(7);
+	.loc 1 45 935 view .LVU2570
+	movq	%r14, 80(%rax)	# _723, MEM[(u64 *)v_1170(D) + 80B]
+	.loc 1 45 947 is_stmt 1 view .LVU2571
+.LVL459:
+.LBB1277:
+.LBI1277:
+	.loc 1 5 19 view .LVU2572
+.LBB1278:
+	.loc 1 5 46 view .LVU2573
+# blake2b-generic.c:5: static inline u64 ror64(unsigned l, u64 x) { return (x >> l) | (x << (64-l)); }
+	.loc 1 5 62 is_stmt 0 view .LVU2574
+	rolq	%rbx	# _1878
+.LVL460:
+	.loc 1 5 62 view .LVU2575
+.LBE1278:
+.LBE1277:
+# blake2b-generic.c:45:     FULLROUND(7);
+	.loc 1 45 955 view .LVU2576
+	movq	%rbx, 48(%rax)	# _1878, MEM[(u64 *)v_1170(D) + 48B]
+	.loc 1 45 673 is_stmt 1 view .LVU2577
+	.loc 1 45 1000 view .LVU2578
+	.loc 1 45 1005 view .LVU2579
+# blake2b-generic.c:45:     FULLROUND(7);
+	.loc 1 45 1013 is_stmt 0 view .LVU2580
+	addq	24(%r9), %r10	# MEM[(const u64 *)m_1171(D) + 24B], tmp2116
+	addq	%r11, %r10	# _1830, _727
+# blake2b-generic.c:45:     FULLROUND(7);
+	.loc 1 45 1071 view .LVU2581
+	xorq	%r10, %r12	# _727, _1803
+# blake2b-generic.c:45:     FULLROUND(7);
+	.loc 1 45 1013 view .LVU2582
+	movq	%r10, 24(%rax)	# _727, MEM[(u64 *)v_1170(D) + 24B]
+	.loc 1 45 1061 is_stmt 1 view .LVU2583
+.LVL461:
+.LBB1279:
+.LBI1279:
+	.loc 1 5 19 view .LVU2584
+.LBB1280:
+	.loc 1 5 46 view .LVU2585
+# blake2b-generic.c:5: static inline u64 ror64(unsigned l, u64 x) { return (x >> l) | (x << (64-l)); }
+	.loc 1 5 62 is_stmt 0 view .LVU2586
+	rolq	$32, %r12	#, _1881
+.LVL462:
+	.loc 1 5 62 view .LVU2587
+.LBE1280:
+.LBE1279:
+# blake2b-generic.c:45:     FULLROUND(7);
+	.loc 1 45 1109 view .LVU2588
+	addq	%r12, %r15	# _1881, _729
+# blake2b-generic.c:45:     FULLROUND(7);
+	.loc 1 45 1069 view .LVU2589
+	movq	%r12, 120(%rax)	# _1881, MEM[(u64 *)v_1170(D) + 120B]
+	.loc 1 45 1101 is_stmt 1 view .LVU2590
+# blake2b-generic.c:45:     FULLROUND(7);
+	.loc 1 45 1131 is_stmt 0 view .LVU2591
+	xorq	%r15, %r11	# _729, tmp2119
+# blake2b-generic.c:45:     FULLROUND(7);
+	.loc 1 45 1109 view .LVU2592
+	movq	%r15, 88(%rax)	# _729, MEM[(u64 *)v_1170(D) + 88B]
+	.loc 1 45 1121 is_stmt 1 view .LVU2593
+.LVL463:
+.LBB1281:
+.LBI1281:
+	.loc 1 5 19 view .LVU2594
+.LBB1282:
+	.loc 1 5 46 view .LVU2595
+# blake2b-generic.c:5: static inline u64 ror64(unsigned l, u64 x) { return (x >> l) | (x << (64-l)); }
+	.loc 1 5 62 is_stmt 0 view .LVU2596
+	rorq	$24, %r11	#, _1884
+.LVL464:
+	.loc 1 5 62 view .LVU2597
+.LBE1282:
+.LBE1281:
+# blake2b-generic.c:45:     FULLROUND(7);
+	.loc 1 45 1129 view .LVU2598
+	movq	%r11, 56(%rax)	# _1884, MEM[(u64 *)v_1170(D) + 56B]
+	.loc 1 45 1161 is_stmt 1 view .LVU2599
+# blake2b-generic.c:45:     FULLROUND(7);
+	.loc 1 45 1169 is_stmt 0 view .LVU2600
+	addq	72(%r9), %r10	# MEM[(const u64 *)m_1171(D) + 72B], tmp2120
+	addq	%r11, %r10	# _1884, _733
+# blake2b-generic.c:45:     FULLROUND(7);
+	.loc 1 45 1227 view .LVU2601
+	xorq	%r10, %r12	# _733, tmp2122
+# blake2b-generic.c:45:     FULLROUND(7);
+	.loc 1 45 1169 view .LVU2602
+	movq	%r10, 24(%rax)	# _733, MEM[(u64 *)v_1170(D) + 24B]
+	.loc 1 45 1217 is_stmt 1 view .LVU2603
+.LVL465:
+.LBB1283:
+.LBI1283:
+	.loc 1 5 19 view .LVU2604
+.LBB1284:
+	.loc 1 5 46 view .LVU2605
+# blake2b-generic.c:5: static inline u64 ror64(unsigned l, u64 x) { return (x >> l) | (x << (64-l)); }
+	.loc 1 5 62 is_stmt 0 view .LVU2606
+	rorq	$16, %r12	#, _1887
+.LVL466:
+	.loc 1 5 62 view .LVU2607
+.LBE1284:
+.LBE1283:
+# blake2b-generic.c:45:     FULLROUND(7);
+	.loc 1 45 1265 view .LVU2608
+	addq	%r12, %r15	# _1887, _735
+# blake2b-generic.c:45:     FULLROUND(7);
+	.loc 1 45 1225 view .LVU2609
+	movq	%r12, 120(%rax)	# _1887, MEM[(u64 *)v_1170(D) + 120B]
+	.loc 1 45 1257 is_stmt 1 view .LVU2610
+# blake2b-generic.c:45:     FULLROUND(7);
+	.loc 1 45 1287 is_stmt 0 view .LVU2611
+	xorq	%r15, %r11	# _735, tmp2123
+# blake2b-generic.c:45:     FULLROUND(7);
+	.loc 1 45 1265 view .LVU2612
+	movq	%r15, 88(%rax)	# _735, MEM[(u64 *)v_1170(D) + 88B]
+	.loc 1 45 1277 is_stmt 1 view .LVU2613
+.LVL467:
+.LBB1285:
+.LBI1285:
+	.loc 1 5 19 view .LVU2614
+.LBB1286:
+	.loc 1 5 46 view .LVU2615
+# blake2b-generic.c:5: static inline u64 ror64(unsigned l, u64 x) { return (x >> l) | (x << (64-l)); }
+	.loc 1 5 62 is_stmt 0 view .LVU2616
+	rolq	%r11	# _1890
+.LVL468:
+	.loc 1 5 62 view .LVU2617
+.LBE1286:
+.LBE1285:
+# blake2b-generic.c:45:     FULLROUND(7);
+	.loc 1 45 1285 view .LVU2618
+	movq	%r11, 56(%rax)	# _1890, MEM[(u64 *)v_1170(D) + 56B]
+	.loc 1 45 1003 is_stmt 1 view .LVU2619
+	.loc 1 45 1330 view .LVU2620
+	.loc 1 45 1335 view .LVU2621
+# blake2b-generic.c:45:     FULLROUND(7);
+	.loc 1 45 1343 is_stmt 0 view .LVU2622
+	addq	40(%r9), %r8	# MEM[(const u64 *)m_1171(D) + 40B], tmp2124
+	addq	%rbp, %r8	# _1866, _739
+# blake2b-generic.c:45:     FULLROUND(7);
+	.loc 1 45 1401 view .LVU2623
+	xorq	%r8, %r12	# _739, tmp2126
+# blake2b-generic.c:45:     FULLROUND(7);
+	.loc 1 45 1343 view .LVU2624
+	movq	%r8, (%rax)	# _739, *v_1170(D)
+	.loc 1 45 1391 is_stmt 1 view .LVU2625
+.LVL469:
+.LBB1287:
+.LBI1287:
+	.loc 1 5 19 view .LVU2626
+.LBB1288:
+	.loc 1 5 46 view .LVU2627
+# blake2b-generic.c:5: static inline u64 ror64(unsigned l, u64 x) { return (x >> l) | (x << (64-l)); }
+	.loc 1 5 62 is_stmt 0 view .LVU2628
+	rolq	$32, %r12	#, _1893
+.LVL470:
+	.loc 1 5 62 view .LVU2629
+.LBE1288:
+.LBE1287:
+# blake2b-generic.c:45:     FULLROUND(7);
+	.loc 1 45 1439 view .LVU2630
+	addq	%r12, %r14	# _1893, _741
+# blake2b-generic.c:45:     FULLROUND(7);
+	.loc 1 45 1399 view .LVU2631
+	movq	%r12, 120(%rax)	# _1893, MEM[(u64 *)v_1170(D) + 120B]
+	.loc 1 45 1431 is_stmt 1 view .LVU2632
+# blake2b-generic.c:45:     FULLROUND(7);
+	.loc 1 45 1461 is_stmt 0 view .LVU2633
+	xorq	%r14, %rbp	# _741, tmp2127
+# blake2b-generic.c:45:     FULLROUND(7);
+	.loc 1 45 1439 view .LVU2634
+	movq	%r14, 80(%rax)	# _741, MEM[(u64 *)v_1170(D) + 80B]
+	.loc 1 45 1451 is_stmt 1 view .LVU2635
+.LVL471:
+.LBB1289:
+.LBI1289:
+	.loc 1 5 19 view .LVU2636
+.LBB1290:
+	.loc 1 5 46 view .LVU2637
+# blake2b-generic.c:5: static inline u64 ror64(unsigned l, u64 x) { return (x >> l) | (x << (64-l)); }
+	.loc 1 5 62 is_stmt 0 view .LVU2638
+	rorq	$24, %rbp	#, _1896
+.LVL472:
+	.loc 1 5 62 view .LVU2639
+.LBE1290:
+.LBE1289:
+# blake2b-generic.c:45:     FULLROUND(7);
+	.loc 1 45 1459 view .LVU2640
+	movq	%rbp, 40(%rax)	# _1896, MEM[(u64 *)v_1170(D) + 40B]
+	.loc 1 45 1491 is_stmt 1 view .LVU2641
+# blake2b-generic.c:45:     FULLROUND(7);
+	.loc 1 45 1499 is_stmt 0 view .LVU2642
+	addq	(%r9), %r8	# *m_1171(D), tmp2128
+	addq	%rbp, %r8	# _1896, _745
+# blake2b-generic.c:45:     FULLROUND(7);
+	.loc 1 45 1557 view .LVU2643
+	xorq	%r8, %r12	# _745, tmp2130
+# blake2b-generic.c:45:     FULLROUND(7);
+	.loc 1 45 1499 view .LVU2644
+	movq	%r8, (%rax)	# _745, *v_1170(D)
+	.loc 1 45 1547 is_stmt 1 view .LVU2645
+.LVL473:
+.LBB1291:
+.LBI1291:
+	.loc 1 5 19 view .LVU2646
+.LBB1292:
+	.loc 1 5 46 view .LVU2647
+# blake2b-generic.c:5: static inline u64 ror64(unsigned l, u64 x) { return (x >> l) | (x << (64-l)); }
+	.loc 1 5 62 is_stmt 0 view .LVU2648
+	rorq	$16, %r12	#, tmp2130
+.LBE1292:
+.LBE1291:
+# blake2b-generic.c:45:     FULLROUND(7);
+	.loc 1 45 1595 view .LVU2649
+	addq	%r12, %r14	# _1899, _747
+	movq	%r12, -40(%rsp)	# _1899, %sfp
+# blake2b-generic.c:45:     FULLROUND(7);
+	.loc 1 45 1617 view .LVU2650
+	xorq	%r14, %rbp	# _747, tmp2131
+	movq	%r14, -72(%rsp)	# _747, %sfp
+.LBB1293:
+.LBB1294:
+# blake2b-generic.c:5: static inline u64 ror64(unsigned l, u64 x) { return (x >> l) | (x << (64-l)); }
+	.loc 1 5 62 view .LVU2651
+	rolq	%rbp	# _1902
+.LBE1294:
+.LBE1293:
+# blake2b-generic.c:45:     FULLROUND(7);
+	.loc 1 45 1555 view .LVU2652
+	movq	%r12, 120(%rax)	# _1899, MEM[(u64 *)v_1170(D) + 120B]
+	.loc 1 45 1587 is_stmt 1 view .LVU2653
+# blake2b-generic.c:45:     FULLROUND(7);
+	.loc 1 45 1595 is_stmt 0 view .LVU2654
+	movq	%r14, 80(%rax)	# _747, MEM[(u64 *)v_1170(D) + 80B]
+	.loc 1 45 1607 is_stmt 1 view .LVU2655
+.LVL474:
+.LBB1296:
+.LBI1293:
+	.loc 1 5 19 view .LVU2656
+.LBB1295:
+	.loc 1 5 46 view .LVU2657
+	.loc 1 5 46 is_stmt 0 view .LVU2658
+.LBE1295:
+.LBE1296:
+# blake2b-generic.c:45:     FULLROUND(7);
+	.loc 1 45 1615 view .LVU2659
+	movq	%rbp, 40(%rax)	# _1902, MEM[(u64 *)v_1170(D) + 40B]
+	.loc 1 45 1333 is_stmt 1 view .LVU2660
+	.loc 1 45 1660 view .LVU2661
+	.loc 1 45 1665 view .LVU2662
+# blake2b-generic.c:45:     FULLROUND(7);
+	.loc 1 45 1673 is_stmt 0 view .LVU2663
+	addq	120(%r9), %rsi	# MEM[(const u64 *)m_1171(D) + 120B], tmp2132
+	addq	%rbx, %rsi	# _1878, _751
+# blake2b-generic.c:45:     FULLROUND(7);
+	.loc 1 45 2337 view .LVU2664
+	movq	-48(%rsp), %r14	# %sfp, _1854
+# blake2b-generic.c:45:     FULLROUND(7);
+	.loc 1 45 1732 view .LVU2665
+	xorq	%rsi, %rdi	# _751, tmp2134
+# blake2b-generic.c:45:     FULLROUND(7);
+	.loc 1 45 1673 view .LVU2666
+	movq	%rsi, 8(%rax)	# _751, MEM[(u64 *)v_1170(D) + 8B]
+	.loc 1 45 1722 is_stmt 1 view .LVU2667
+.LVL475:
+.LBB1297:
+.LBI1297:
+	.loc 1 5 19 view .LVU2668
+.LBB1298:
+	.loc 1 5 46 view .LVU2669
+# blake2b-generic.c:5: static inline u64 ror64(unsigned l, u64 x) { return (x >> l) | (x << (64-l)); }
+	.loc 1 5 62 is_stmt 0 view .LVU2670
+	rolq	$32, %rdi	#, _1905
+.LVL476:
+	.loc 1 5 62 view .LVU2671
+.LBE1298:
+.LBE1297:
+# blake2b-generic.c:45:     FULLROUND(7);
+	.loc 1 45 1770 view .LVU2672
+	addq	%rdi, %r15	# _1905, _753
+# blake2b-generic.c:45:     FULLROUND(7);
+	.loc 1 45 1730 view .LVU2673
+	movq	%rdi, 96(%rax)	# _1905, MEM[(u64 *)v_1170(D) + 96B]
+	.loc 1 45 1762 is_stmt 1 view .LVU2674
+# blake2b-generic.c:45:     FULLROUND(7);
+	.loc 1 45 1792 is_stmt 0 view .LVU2675
+	xorq	%r15, %rbx	# _753, tmp2135
+# blake2b-generic.c:45:     FULLROUND(7);
+	.loc 1 45 1770 view .LVU2676
+	movq	%r15, 88(%rax)	# _753, MEM[(u64 *)v_1170(D) + 88B]
+	.loc 1 45 1782 is_stmt 1 view .LVU2677
+.LVL477:
+.LBB1299:
+.LBI1299:
+	.loc 1 5 19 view .LVU2678
+.LBB1300:
+	.loc 1 5 46 view .LVU2679
+# blake2b-generic.c:5: static inline u64 ror64(unsigned l, u64 x) { return (x >> l) | (x << (64-l)); }
+	.loc 1 5 62 is_stmt 0 view .LVU2680
+	rorq	$24, %rbx	#, _1908
+.LVL478:
+	.loc 1 5 62 view .LVU2681
+.LBE1300:
+.LBE1299:
+# blake2b-generic.c:45:     FULLROUND(7);
+	.loc 1 45 1790 view .LVU2682
+	movq	%rbx, 48(%rax)	# _1908, MEM[(u64 *)v_1170(D) + 48B]
+	.loc 1 45 1822 is_stmt 1 view .LVU2683
+# blake2b-generic.c:45:     FULLROUND(7);
+	.loc 1 45 1830 is_stmt 0 view .LVU2684
+	addq	32(%r9), %rsi	# MEM[(const u64 *)m_1171(D) + 32B], tmp2136
+	addq	%rbx, %rsi	# _1908, _757
+# blake2b-generic.c:45:     FULLROUND(7);
+	.loc 1 45 1889 view .LVU2685
+	xorq	%rsi, %rdi	# _757, tmp2138
+# blake2b-generic.c:45:     FULLROUND(7);
+	.loc 1 45 1830 view .LVU2686
+	movq	%rsi, 8(%rax)	# _757, MEM[(u64 *)v_1170(D) + 8B]
+	.loc 1 45 1879 is_stmt 1 view .LVU2687
+.LVL479:
+.LBB1301:
+.LBI1301:
+	.loc 1 5 19 view .LVU2688
+.LBB1302:
+	.loc 1 5 46 view .LVU2689
+# blake2b-generic.c:5: static inline u64 ror64(unsigned l, u64 x) { return (x >> l) | (x << (64-l)); }
+	.loc 1 5 62 is_stmt 0 view .LVU2690
+	rorq	$16, %rdi	#, _1911
+.LVL480:
+	.loc 1 5 62 view .LVU2691
+.LBE1302:
+.LBE1301:
+# blake2b-generic.c:45:     FULLROUND(7);
+	.loc 1 45 1927 view .LVU2692
+	addq	%rdi, %r15	# _1911, _759
+# blake2b-generic.c:45:     FULLROUND(7);
+	.loc 1 45 1887 view .LVU2693
+	movq	%rdi, 96(%rax)	# _1911, MEM[(u64 *)v_1170(D) + 96B]
+	.loc 1 45 1919 is_stmt 1 view .LVU2694
+# blake2b-generic.c:45:     FULLROUND(7);
+	.loc 1 45 1949 is_stmt 0 view .LVU2695
+	xorq	%r15, %rbx	# _759, tmp2139
+# blake2b-generic.c:45:     FULLROUND(7);
+	.loc 1 45 1927 view .LVU2696
+	movq	%r15, 88(%rax)	# _759, MEM[(u64 *)v_1170(D) + 88B]
+	.loc 1 45 1939 is_stmt 1 view .LVU2697
+.LVL481:
+.LBB1303:
+.LBI1303:
+	.loc 1 5 19 view .LVU2698
+.LBB1304:
+	.loc 1 5 46 view .LVU2699
+# blake2b-generic.c:5: static inline u64 ror64(unsigned l, u64 x) { return (x >> l) | (x << (64-l)); }
+	.loc 1 5 62 is_stmt 0 view .LVU2700
+	rolq	%rbx	# _1914
+.LVL482:
+	.loc 1 5 62 view .LVU2701
+.LBE1304:
+.LBE1303:
+# blake2b-generic.c:45:     FULLROUND(7);
+	.loc 1 45 1949 view .LVU2702
+	movq	%r15, -64(%rsp)	# _759, %sfp
+# blake2b-generic.c:45:     FULLROUND(7);
+	.loc 1 45 2102 view .LVU2703
+	movq	-80(%rsp), %r15	# %sfp, _699
+# blake2b-generic.c:45:     FULLROUND(7);
+	.loc 1 45 1947 view .LVU2704
+	movq	%rbx, 48(%rax)	# _1914, MEM[(u64 *)v_1170(D) + 48B]
+	.loc 1 45 1663 is_stmt 1 view .LVU2705
+	.loc 1 45 1992 view .LVU2706
+	.loc 1 45 1997 view .LVU2707
+# blake2b-generic.c:45:     FULLROUND(7);
+	.loc 1 45 2005 is_stmt 0 view .LVU2708
+	addq	64(%r9), %rdx	# MEM[(const u64 *)m_1171(D) + 64B], tmp2140
+	addq	%r11, %rdx	# _1890, _763
+# blake2b-generic.c:45:     FULLROUND(7);
+	.loc 1 45 2064 view .LVU2709
+	xorq	%rdx, %rcx	# _763, tmp2142
+# blake2b-generic.c:45:     FULLROUND(7);
+	.loc 1 45 2005 view .LVU2710
+	movq	%rdx, 16(%rax)	# _763, MEM[(u64 *)v_1170(D) + 16B]
+	.loc 1 45 2054 is_stmt 1 view .LVU2711
+.LVL483:
+.LBB1305:
+.LBI1305:
+	.loc 1 5 19 view .LVU2712
+.LBB1306:
+	.loc 1 5 46 view .LVU2713
+# blake2b-generic.c:5: static inline u64 ror64(unsigned l, u64 x) { return (x >> l) | (x << (64-l)); }
+	.loc 1 5 62 is_stmt 0 view .LVU2714
+	rolq	$32, %rcx	#, _1917
+.LVL484:
+	.loc 1 5 62 view .LVU2715
+.LBE1306:
+.LBE1305:
+# blake2b-generic.c:45:     FULLROUND(7);
+	.loc 1 45 2102 view .LVU2716
+	leaq	(%r15,%rcx), %r12	#, _765
+# blake2b-generic.c:45:     FULLROUND(7);
+	.loc 1 45 2062 view .LVU2717
+	movq	%rcx, 104(%rax)	# _1917, MEM[(u64 *)v_1170(D) + 104B]
+	.loc 1 45 2094 is_stmt 1 view .LVU2718
+# blake2b-generic.c:45:     FULLROUND(7);
+	.loc 1 45 2434 is_stmt 0 view .LVU2719
+	movq	-56(%rsp), %r15	# %sfp, _711
+# blake2b-generic.c:45:     FULLROUND(7);
+	.loc 1 45 2124 view .LVU2720
+	xorq	%r12, %r11	# _765, tmp2143
+# blake2b-generic.c:45:     FULLROUND(7);
+	.loc 1 45 2102 view .LVU2721
+	movq	%r12, 64(%rax)	# _765, MEM[(u64 *)v_1170(D) + 64B]
+	.loc 1 45 2114 is_stmt 1 view .LVU2722
+.LVL485:
+.LBB1307:
+.LBI1307:
+	.loc 1 5 19 view .LVU2723
+.LBB1308:
+	.loc 1 5 46 view .LVU2724
+# blake2b-generic.c:5: static inline u64 ror64(unsigned l, u64 x) { return (x >> l) | (x << (64-l)); }
+	.loc 1 5 62 is_stmt 0 view .LVU2725
+	rorq	$24, %r11	#, _1920
+.LVL486:
+	.loc 1 5 62 view .LVU2726
+.LBE1308:
+.LBE1307:
+# blake2b-generic.c:45:     FULLROUND(7);
+	.loc 1 45 2122 view .LVU2727
+	movq	%r11, 56(%rax)	# _1920, MEM[(u64 *)v_1170(D) + 56B]
+	.loc 1 45 2154 is_stmt 1 view .LVU2728
+# blake2b-generic.c:45:     FULLROUND(7);
+	.loc 1 45 2162 is_stmt 0 view .LVU2729
+	addq	48(%r9), %rdx	# MEM[(const u64 *)m_1171(D) + 48B], tmp2144
+	addq	%r11, %rdx	# _1920, _769
+# blake2b-generic.c:45:     FULLROUND(7);
+	.loc 1 45 2221 view .LVU2730
+	xorq	%rdx, %rcx	# _769, tmp2146
+# blake2b-generic.c:45:     FULLROUND(7);
+	.loc 1 45 2162 view .LVU2731
+	movq	%rdx, 16(%rax)	# _769, MEM[(u64 *)v_1170(D) + 16B]
+	.loc 1 45 2211 is_stmt 1 view .LVU2732
+.LVL487:
+.LBB1309:
+.LBI1309:
+	.loc 1 5 19 view .LVU2733
+.LBB1310:
+	.loc 1 5 46 view .LVU2734
+# blake2b-generic.c:5: static inline u64 ror64(unsigned l, u64 x) { return (x >> l) | (x << (64-l)); }
+	.loc 1 5 62 is_stmt 0 view .LVU2735
+	rorq	$16, %rcx	#, _1923
+.LVL488:
+	.loc 1 5 62 view .LVU2736
+.LBE1310:
+.LBE1309:
+# blake2b-generic.c:45:     FULLROUND(7);
+	.loc 1 45 2259 view .LVU2737
+	addq	%rcx, %r12	# _1923, _771
+# blake2b-generic.c:45:     FULLROUND(7);
+	.loc 1 45 2219 view .LVU2738
+	movq	%rcx, 104(%rax)	# _1923, MEM[(u64 *)v_1170(D) + 104B]
+	.loc 1 45 2251 is_stmt 1 view .LVU2739
+# blake2b-generic.c:45:     FULLROUND(7);
+	.loc 1 45 2281 is_stmt 0 view .LVU2740
+	xorq	%r12, %r11	# _771, tmp2147
+# blake2b-generic.c:45:     FULLROUND(7);
+	.loc 1 45 2259 view .LVU2741
+	movq	%r12, 64(%rax)	# _771, MEM[(u64 *)v_1170(D) + 64B]
+	.loc 1 45 2271 is_stmt 1 view .LVU2742
+.LVL489:
+.LBB1311:
+.LBI1311:
+	.loc 1 5 19 view .LVU2743
+.LBB1312:
+	.loc 1 5 46 view .LVU2744
+# blake2b-generic.c:5: static inline u64 ror64(unsigned l, u64 x) { return (x >> l) | (x << (64-l)); }
+	.loc 1 5 62 is_stmt 0 view .LVU2745
+	rolq	%r11	# _1926
+.LVL490:
+	.loc 1 5 62 view .LVU2746
+.LBE1312:
+.LBE1311:
+# blake2b-generic.c:45:     FULLROUND(7);
+	.loc 1 45 2279 view .LVU2747
+	movq	%r11, 56(%rax)	# _1926, MEM[(u64 *)v_1170(D) + 56B]
+	.loc 1 45 1995 is_stmt 1 view .LVU2748
+	.loc 1 45 2324 view .LVU2749
+	.loc 1 45 2329 view .LVU2750
+# blake2b-generic.c:45:     FULLROUND(7);
+	.loc 1 45 2337 is_stmt 0 view .LVU2751
+	addq	16(%r9), %r10	# MEM[(const u64 *)m_1171(D) + 16B], tmp2148
+	addq	%r14, %r10	# _1854, _775
+# blake2b-generic.c:45:     FULLROUND(7);
+	.loc 1 45 2396 view .LVU2752
+	xorq	%r10, %r13	# _775, tmp2150
+# blake2b-generic.c:45:     FULLROUND(7);
+	.loc 1 45 2337 view .LVU2753
+	movq	%r10, 24(%rax)	# _775, MEM[(u64 *)v_1170(D) + 24B]
+	.loc 1 45 2386 is_stmt 1 view .LVU2754
+.LVL491:
+.LBB1313:
+.LBI1313:
+	.loc 1 5 19 view .LVU2755
+.LBB1314:
+	.loc 1 5 46 view .LVU2756
+# blake2b-generic.c:5: static inline u64 ror64(unsigned l, u64 x) { return (x >> l) | (x << (64-l)); }
+	.loc 1 5 62 is_stmt 0 view .LVU2757
+	rolq	$32, %r13	#, _1929
+.LVL492:
+	.loc 1 5 62 view .LVU2758
+.LBE1314:
+.LBE1313:
+# blake2b-generic.c:45:     FULLROUND(7);
+	.loc 1 45 2434 view .LVU2759
+	addq	%r13, %r15	# _1929, _777
+# blake2b-generic.c:45:     FULLROUND(7);
+	.loc 1 45 2394 view .LVU2760
+	movq	%r13, 112(%rax)	# _1929, MEM[(u64 *)v_1170(D) + 112B]
+	.loc 1 45 2426 is_stmt 1 view .LVU2761
+# blake2b-generic.c:45:     FULLROUND(7);
+	.loc 1 45 2456 is_stmt 0 view .LVU2762
+	xorq	%r15, %r14	# _777, _1854
+# blake2b-generic.c:45:     FULLROUND(7);
+	.loc 1 45 2434 view .LVU2763
+	movq	%r15, 72(%rax)	# _777, MEM[(u64 *)v_1170(D) + 72B]
+	.loc 1 45 2446 is_stmt 1 view .LVU2764
+.LVL493:
+.LBB1315:
+.LBI1315:
+	.loc 1 5 19 view .LVU2765
+.LBB1316:
+	.loc 1 5 46 view .LVU2766
+# blake2b-generic.c:5: static inline u64 ror64(unsigned l, u64 x) { return (x >> l) | (x << (64-l)); }
+	.loc 1 5 62 is_stmt 0 view .LVU2767
+	rorq	$24, %r14	#, _1932
+.LVL494:
+	.loc 1 5 62 view .LVU2768
+.LBE1316:
+.LBE1315:
+# blake2b-generic.c:45:     FULLROUND(7);
+	.loc 1 45 2454 view .LVU2769
+	movq	%r14, 32(%rax)	# _1932, MEM[(u64 *)v_1170(D) + 32B]
+	.loc 1 45 2486 is_stmt 1 view .LVU2770
+# blake2b-generic.c:45:     FULLROUND(7);
+	.loc 1 45 2494 is_stmt 0 view .LVU2771
+	addq	80(%r9), %r10	# MEM[(const u64 *)m_1171(D) + 80B], tmp2152
+	addq	%r14, %r10	# _1932, _781
+# blake2b-generic.c:45:     FULLROUND(7);
+	.loc 1 45 2553 view .LVU2772
+	xorq	%r10, %r13	# _781, tmp2154
+# blake2b-generic.c:45:     FULLROUND(7);
+	.loc 1 45 2494 view .LVU2773
+	movq	%r10, 24(%rax)	# _781, MEM[(u64 *)v_1170(D) + 24B]
+	.loc 1 45 2543 is_stmt 1 view .LVU2774
+.LVL495:
+.LBB1317:
+.LBI1317:
+	.loc 1 5 19 view .LVU2775
+.LBB1318:
+	.loc 1 5 46 view .LVU2776
+# blake2b-generic.c:5: static inline u64 ror64(unsigned l, u64 x) { return (x >> l) | (x << (64-l)); }
+	.loc 1 5 62 is_stmt 0 view .LVU2777
+	rorq	$16, %r13	#, _1935
+.LVL496:
+	.loc 1 5 62 view .LVU2778
+.LBE1318:
+.LBE1317:
+# blake2b-generic.c:45:     FULLROUND(7);
+	.loc 1 45 2591 view .LVU2779
+	addq	%r13, %r15	# _1935, _783
+# blake2b-generic.c:45:     FULLROUND(7);
+	.loc 1 45 2551 view .LVU2780
+	movq	%r13, 112(%rax)	# _1935, MEM[(u64 *)v_1170(D) + 112B]
+	.loc 1 45 2583 is_stmt 1 view .LVU2781
+# blake2b-generic.c:45:     FULLROUND(7);
+	.loc 1 45 2613 is_stmt 0 view .LVU2782
+	xorq	%r15, %r14	# _783, tmp2155
+# blake2b-generic.c:45:     FULLROUND(7);
+	.loc 1 45 2591 view .LVU2783
+	movq	%r15, 72(%rax)	# _783, MEM[(u64 *)v_1170(D) + 72B]
+	.loc 1 45 2603 is_stmt 1 view .LVU2784
+.LVL497:
+.LBB1319:
+.LBI1319:
+	.loc 1 5 19 view .LVU2785
+.LBB1320:
+	.loc 1 5 46 view .LVU2786
+# blake2b-generic.c:5: static inline u64 ror64(unsigned l, u64 x) { return (x >> l) | (x << (64-l)); }
+	.loc 1 5 62 is_stmt 0 view .LVU2787
+	rolq	%r14	# _1938
+.LVL498:
+	.loc 1 5 62 view .LVU2788
+.LBE1320:
+.LBE1319:
+# blake2b-generic.c:45:     FULLROUND(7);
+	.loc 1 45 2611 view .LVU2789
+	movq	%r14, 32(%rax)	# _1938, MEM[(u64 *)v_1170(D) + 32B]
+	.loc 1 45 2327 is_stmt 1 view .LVU2790
+	.loc 1 45 8 view .LVU2791
+	.loc 1 46 5 view .LVU2792
+	.loc 1 46 10 view .LVU2793
+	.loc 1 46 15 view .LVU2794
+# blake2b-generic.c:46:     FULLROUND(8);
+	.loc 1 46 23 is_stmt 0 view .LVU2795
+	addq	48(%r9), %r8	# MEM[(const u64 *)m_1171(D) + 48B], tmp2156
+	addq	%r14, %r8	# _1938, _787
+# blake2b-generic.c:46:     FULLROUND(8);
+	.loc 1 46 81 view .LVU2796
+	xorq	%r8, %rdi	# _787, tmp2158
+# blake2b-generic.c:46:     FULLROUND(8);
+	.loc 1 46 23 view .LVU2797
+	movq	%r8, (%rax)	# _787, *v_1170(D)
+	.loc 1 46 71 is_stmt 1 view .LVU2798
+.LVL499:
+.LBB1321:
+.LBI1321:
+	.loc 1 5 19 view .LVU2799
+.LBB1322:
+	.loc 1 5 46 view .LVU2800
+# blake2b-generic.c:5: static inline u64 ror64(unsigned l, u64 x) { return (x >> l) | (x << (64-l)); }
+	.loc 1 5 62 is_stmt 0 view .LVU2801
+	rolq	$32, %rdi	#, _1941
+.LVL500:
+	.loc 1 5 62 view .LVU2802
+.LBE1322:
+.LBE1321:
+# blake2b-generic.c:46:     FULLROUND(8);
+	.loc 1 46 119 view .LVU2803
+	addq	%rdi, %r12	# _1941, _789
+# blake2b-generic.c:46:     FULLROUND(8);
+	.loc 1 46 79 view .LVU2804
+	movq	%rdi, 96(%rax)	# _1941, MEM[(u64 *)v_1170(D) + 96B]
+	.loc 1 46 111 is_stmt 1 view .LVU2805
+# blake2b-generic.c:46:     FULLROUND(8);
+	.loc 1 46 141 is_stmt 0 view .LVU2806
+	xorq	%r12, %r14	# _789, tmp2159
+# blake2b-generic.c:46:     FULLROUND(8);
+	.loc 1 46 119 view .LVU2807
+	movq	%r12, 64(%rax)	# _789, MEM[(u64 *)v_1170(D) + 64B]
+	.loc 1 46 131 is_stmt 1 view .LVU2808
+.LVL501:
+.LBB1323:
+.LBI1323:
+	.loc 1 5 19 view .LVU2809
+.LBB1324:
+	.loc 1 5 46 view .LVU2810
+# blake2b-generic.c:5: static inline u64 ror64(unsigned l, u64 x) { return (x >> l) | (x << (64-l)); }
+	.loc 1 5 62 is_stmt 0 view .LVU2811
+	rorq	$24, %r14	#, _1944
+.LVL502:
+	.loc 1 5 62 view .LVU2812
+.LBE1324:
+.LBE1323:
+# blake2b-generic.c:46:     FULLROUND(8);
+	.loc 1 46 139 view .LVU2813
+	movq	%r14, 32(%rax)	# _1944, MEM[(u64 *)v_1170(D) + 32B]
+	.loc 1 46 171 is_stmt 1 view .LVU2814
+# blake2b-generic.c:46:     FULLROUND(8);
+	.loc 1 46 179 is_stmt 0 view .LVU2815
+	addq	120(%r9), %r8	# MEM[(const u64 *)m_1171(D) + 120B], tmp2160
+	addq	%r14, %r8	# _1944, _793
+# blake2b-generic.c:46:     FULLROUND(8);
+	.loc 1 46 237 view .LVU2816
+	xorq	%r8, %rdi	# _793, tmp2162
+# blake2b-generic.c:46:     FULLROUND(8);
+	.loc 1 46 179 view .LVU2817
+	movq	%r8, (%rax)	# _793, *v_1170(D)
+	.loc 1 46 227 is_stmt 1 view .LVU2818
+.LVL503:
+.LBB1325:
+.LBI1325:
+	.loc 1 5 19 view .LVU2819
+.LBB1326:
+	.loc 1 5 46 view .LVU2820
+# blake2b-generic.c:5: static inline u64 ror64(unsigned l, u64 x) { return (x >> l) | (x << (64-l)); }
+	.loc 1 5 62 is_stmt 0 view .LVU2821
+	rorq	$16, %rdi	#, _1947
+.LVL504:
+	.loc 1 5 62 view .LVU2822
+.LBE1326:
+.LBE1325:
+# blake2b-generic.c:46:     FULLROUND(8);
+	.loc 1 46 275 view .LVU2823
+	addq	%rdi, %r12	# _1947, _795
+# blake2b-generic.c:46:     FULLROUND(8);
+	.loc 1 46 235 view .LVU2824
+	movq	%rdi, 96(%rax)	# _1947, MEM[(u64 *)v_1170(D) + 96B]
+	.loc 1 46 267 is_stmt 1 view .LVU2825
+# blake2b-generic.c:46:     FULLROUND(8);
+	.loc 1 46 297 is_stmt 0 view .LVU2826
+	xorq	%r12, %r14	# _795, tmp2163
+# blake2b-generic.c:46:     FULLROUND(8);
+	.loc 1 46 275 view .LVU2827
+	movq	%r12, 64(%rax)	# _795, MEM[(u64 *)v_1170(D) + 64B]
+	.loc 1 46 287 is_stmt 1 view .LVU2828
+.LVL505:
+.LBB1327:
+.LBI1327:
+	.loc 1 5 19 view .LVU2829
+.LBB1328:
+	.loc 1 5 46 view .LVU2830
+# blake2b-generic.c:5: static inline u64 ror64(unsigned l, u64 x) { return (x >> l) | (x << (64-l)); }
+	.loc 1 5 62 is_stmt 0 view .LVU2831
+	rolq	%r14	# tmp2163
+.LBE1328:
+.LBE1327:
+# blake2b-generic.c:46:     FULLROUND(8);
+	.loc 1 46 297 view .LVU2832
+	movq	%r12, -80(%rsp)	# _795, %sfp
+# blake2b-generic.c:46:     FULLROUND(8);
+	.loc 1 46 295 view .LVU2833
+	movq	%r14, 32(%rax)	# _1950, MEM[(u64 *)v_1170(D) + 32B]
+	.loc 1 46 13 is_stmt 1 view .LVU2834
+	.loc 1 46 340 view .LVU2835
+	.loc 1 46 345 view .LVU2836
+# blake2b-generic.c:46:     FULLROUND(8);
+	.loc 1 46 353 is_stmt 0 view .LVU2837
+	addq	112(%r9), %rsi	# MEM[(const u64 *)m_1171(D) + 112B], tmp2164
+	addq	%rbp, %rsi	# _1902, _799
+# blake2b-generic.c:46:     FULLROUND(8);
+	.loc 1 46 295 view .LVU2838
+	movq	%r14, -48(%rsp)	# _1950, %sfp
+# blake2b-generic.c:46:     FULLROUND(8);
+	.loc 1 46 411 view .LVU2839
+	xorq	%rsi, %rcx	# _799, tmp2166
+# blake2b-generic.c:46:     FULLROUND(8);
+	.loc 1 46 353 view .LVU2840
+	movq	%rsi, 8(%rax)	# _799, MEM[(u64 *)v_1170(D) + 8B]
+	.loc 1 46 401 is_stmt 1 view .LVU2841
+.LVL506:
+.LBB1329:
+.LBI1329:
+	.loc 1 5 19 view .LVU2842
+.LBB1330:
+	.loc 1 5 46 view .LVU2843
+# blake2b-generic.c:5: static inline u64 ror64(unsigned l, u64 x) { return (x >> l) | (x << (64-l)); }
+	.loc 1 5 62 is_stmt 0 view .LVU2844
+	rolq	$32, %rcx	#, _1953
+.LVL507:
+	.loc 1 5 62 view .LVU2845
+.LBE1330:
+.LBE1329:
+# blake2b-generic.c:46:     FULLROUND(8);
+	.loc 1 46 449 view .LVU2846
+	addq	%rcx, %r15	# _1953, _801
+# blake2b-generic.c:46:     FULLROUND(8);
+	.loc 1 46 409 view .LVU2847
+	movq	%rcx, 104(%rax)	# _1953, MEM[(u64 *)v_1170(D) + 104B]
+	.loc 1 46 441 is_stmt 1 view .LVU2848
+# blake2b-generic.c:46:     FULLROUND(8);
+	.loc 1 46 471 is_stmt 0 view .LVU2849
+	xorq	%r15, %rbp	# _801, tmp2167
+# blake2b-generic.c:46:     FULLROUND(8);
+	.loc 1 46 449 view .LVU2850
+	movq	%r15, 72(%rax)	# _801, MEM[(u64 *)v_1170(D) + 72B]
+	.loc 1 46 461 is_stmt 1 view .LVU2851
+.LVL508:
+.LBB1331:
+.LBI1331:
+	.loc 1 5 19 view .LVU2852
+.LBB1332:
+	.loc 1 5 46 view .LVU2853
+# blake2b-generic.c:5: static inline u64 ror64(unsigned l, u64 x) { return (x >> l) | (x << (64-l)); }
+	.loc 1 5 62 is_stmt 0 view .LVU2854
+	rorq	$24, %rbp	#, _1956
+.LVL509:
+	.loc 1 5 62 view .LVU2855
+.LBE1332:
+.LBE1331:
+# blake2b-generic.c:46:     FULLROUND(8);
+	.loc 1 46 469 view .LVU2856
+	movq	%rbp, 40(%rax)	# _1956, MEM[(u64 *)v_1170(D) + 40B]
+	.loc 1 46 501 is_stmt 1 view .LVU2857
+# blake2b-generic.c:46:     FULLROUND(8);
+	.loc 1 46 509 is_stmt 0 view .LVU2858
+	addq	72(%r9), %rsi	# MEM[(const u64 *)m_1171(D) + 72B], tmp2168
+	addq	%rbp, %rsi	# _1956, _805
+# blake2b-generic.c:46:     FULLROUND(8);
+	.loc 1 46 567 view .LVU2859
+	xorq	%rsi, %rcx	# _805, tmp2170
+# blake2b-generic.c:46:     FULLROUND(8);
+	.loc 1 46 509 view .LVU2860
+	movq	%rsi, 8(%rax)	# _805, MEM[(u64 *)v_1170(D) + 8B]
+	.loc 1 46 557 is_stmt 1 view .LVU2861
+.LVL510:
+.LBB1333:
+.LBI1333:
+	.loc 1 5 19 view .LVU2862
+.LBB1334:
+	.loc 1 5 46 view .LVU2863
+# blake2b-generic.c:5: static inline u64 ror64(unsigned l, u64 x) { return (x >> l) | (x << (64-l)); }
+	.loc 1 5 62 is_stmt 0 view .LVU2864
+	rorq	$16, %rcx	#, _1959
+.LVL511:
+	.loc 1 5 62 view .LVU2865
+.LBE1334:
+.LBE1333:
+# blake2b-generic.c:46:     FULLROUND(8);
+	.loc 1 46 605 view .LVU2866
+	addq	%rcx, %r15	# _1959, _807
+# blake2b-generic.c:46:     FULLROUND(8);
+	.loc 1 46 565 view .LVU2867
+	movq	%rcx, 104(%rax)	# _1959, MEM[(u64 *)v_1170(D) + 104B]
+	.loc 1 46 597 is_stmt 1 view .LVU2868
+# blake2b-generic.c:46:     FULLROUND(8);
+	.loc 1 46 627 is_stmt 0 view .LVU2869
+	xorq	%r15, %rbp	# _807, tmp2171
+# blake2b-generic.c:46:     FULLROUND(8);
+	.loc 1 46 605 view .LVU2870
+	movq	%r15, 72(%rax)	# _807, MEM[(u64 *)v_1170(D) + 72B]
+	.loc 1 46 617 is_stmt 1 view .LVU2871
+.LVL512:
+.LBB1335:
+.LBI1335:
+	.loc 1 5 19 view .LVU2872
+.LBB1336:
+	.loc 1 5 46 view .LVU2873
+# blake2b-generic.c:5: static inline u64 ror64(unsigned l, u64 x) { return (x >> l) | (x << (64-l)); }
+	.loc 1 5 62 is_stmt 0 view .LVU2874
+	rolq	%rbp	# _1962
+.LVL513:
+	.loc 1 5 62 view .LVU2875
+.LBE1336:
+.LBE1335:
+# blake2b-generic.c:46:     FULLROUND(8);
+	.loc 1 46 627 view .LVU2876
+	movq	%r15, -56(%rsp)	# _807, %sfp
+# blake2b-generic.c:46:     FULLROUND(8);
+	.loc 1 46 779 view .LVU2877
+	movq	-72(%rsp), %r15	# %sfp, _747
+# blake2b-generic.c:46:     FULLROUND(8);
+	.loc 1 46 625 view .LVU2878
+	movq	%rbp, 40(%rax)	# _1962, MEM[(u64 *)v_1170(D) + 40B]
+	.loc 1 46 343 is_stmt 1 view .LVU2879
+	.loc 1 46 670 view .LVU2880
+	.loc 1 46 675 view .LVU2881
+# blake2b-generic.c:46:     FULLROUND(8);
+	.loc 1 46 683 is_stmt 0 view .LVU2882
+	addq	88(%r9), %rdx	# MEM[(const u64 *)m_1171(D) + 88B], tmp2172
+	addq	%rbx, %rdx	# _1914, _811
+# blake2b-generic.c:46:     FULLROUND(8);
+	.loc 1 46 741 view .LVU2883
+	xorq	%rdx, %r13	# _811, tmp2174
+# blake2b-generic.c:46:     FULLROUND(8);
+	.loc 1 46 683 view .LVU2884
+	movq	%rdx, 16(%rax)	# _811, MEM[(u64 *)v_1170(D) + 16B]
+	.loc 1 46 731 is_stmt 1 view .LVU2885
+.LVL514:
+.LBB1337:
+.LBI1337:
+	.loc 1 5 19 view .LVU2886
+.LBB1338:
+	.loc 1 5 46 view .LVU2887
+# blake2b-generic.c:5: static inline u64 ror64(unsigned l, u64 x) { return (x >> l) | (x << (64-l)); }
+	.loc 1 5 62 is_stmt 0 view .LVU2888
+	rolq	$32, %r13	#, _1965
+.LVL515:
+	.loc 1 5 62 view .LVU2889
+.LBE1338:
+.LBE1337:
+# blake2b-generic.c:46:     FULLROUND(8);
+	.loc 1 46 779 view .LVU2890
+	leaq	(%r15,%r13), %r14	#, _813
+# blake2b-generic.c:46:     FULLROUND(8);
+	.loc 1 46 739 view .LVU2891
+	movq	%r13, 112(%rax)	# _1965, MEM[(u64 *)v_1170(D) + 112B]
+	.loc 1 46 771 is_stmt 1 view .LVU2892
+# blake2b-generic.c:46:     FULLROUND(8);
+	.loc 1 46 801 is_stmt 0 view .LVU2893
+	xorq	%r14, %rbx	# _813, tmp2175
+# blake2b-generic.c:46:     FULLROUND(8);
+	.loc 1 46 779 view .LVU2894
+	movq	%r14, 80(%rax)	# _813, MEM[(u64 *)v_1170(D) + 80B]
+	.loc 1 46 791 is_stmt 1 view .LVU2895
+.LVL516:
+.LBB1339:
+.LBI1339:
+	.loc 1 5 19 view .LVU2896
+.LBB1340:
+	.loc 1 5 46 view .LVU2897
+# blake2b-generic.c:5: static inline u64 ror64(unsigned l, u64 x) { return (x >> l) | (x << (64-l)); }
+	.loc 1 5 62 is_stmt 0 view .LVU2898
+	rorq	$24, %rbx	#, _1968
+.LVL517:
+	.loc 1 5 62 view .LVU2899
+.LBE1340:
+.LBE1339:
+# blake2b-generic.c:46:     FULLROUND(8);
+	.loc 1 46 799 view .LVU2900
+	movq	%rbx, 48(%rax)	# _1968, MEM[(u64 *)v_1170(D) + 48B]
+	.loc 1 46 831 is_stmt 1 view .LVU2901
+# blake2b-generic.c:46:     FULLROUND(8);
+	.loc 1 46 839 is_stmt 0 view .LVU2902
+	addq	24(%r9), %rdx	# MEM[(const u64 *)m_1171(D) + 24B], tmp2176
+	addq	%rbx, %rdx	# _1968, _817
+# blake2b-generic.c:46:     FULLROUND(8);
+	.loc 1 46 897 view .LVU2903
+	xorq	%rdx, %r13	# _817, tmp2178
+# blake2b-generic.c:46:     FULLROUND(8);
+	.loc 1 46 839 view .LVU2904
+	movq	%rdx, 16(%rax)	# _817, MEM[(u64 *)v_1170(D) + 16B]
+	.loc 1 46 887 is_stmt 1 view .LVU2905
+.LVL518:
+.LBB1341:
+.LBI1341:
+	.loc 1 5 19 view .LVU2906
+.LBB1342:
+	.loc 1 5 46 view .LVU2907
+# blake2b-generic.c:5: static inline u64 ror64(unsigned l, u64 x) { return (x >> l) | (x << (64-l)); }
+	.loc 1 5 62 is_stmt 0 view .LVU2908
+	rorq	$16, %r13	#, _1971
+.LVL519:
+	.loc 1 5 62 view .LVU2909
+.LBE1342:
+.LBE1341:
+# blake2b-generic.c:46:     FULLROUND(8);
+	.loc 1 46 935 view .LVU2910
+	addq	%r13, %r14	# _1971, _819
+# blake2b-generic.c:46:     FULLROUND(8);
+	.loc 1 46 895 view .LVU2911
+	movq	%r13, 112(%rax)	# _1971, MEM[(u64 *)v_1170(D) + 112B]
+	.loc 1 46 927 is_stmt 1 view .LVU2912
+# blake2b-generic.c:46:     FULLROUND(8);
+	.loc 1 46 1071 is_stmt 0 view .LVU2913
+	movq	-40(%rsp), %r12	# %sfp, _1899
+# blake2b-generic.c:46:     FULLROUND(8);
+	.loc 1 46 957 view .LVU2914
+	xorq	%r14, %rbx	# _819, tmp2179
+# blake2b-generic.c:46:     FULLROUND(8);
+	.loc 1 46 935 view .LVU2915
+	movq	%r14, 80(%rax)	# _819, MEM[(u64 *)v_1170(D) + 80B]
+	.loc 1 46 947 is_stmt 1 view .LVU2916
+.LVL520:
+.LBB1343:
+.LBI1343:
+	.loc 1 5 19 view .LVU2917
+.LBB1344:
+	.loc 1 5 46 view .LVU2918
+.LBE1344:
+.LBE1343:
+# blake2b-generic.c:46:     FULLROUND(8);
+	.loc 1 46 1109 is_stmt 0 view .LVU2919
+	movq	-64(%rsp), %r15	# %sfp, _759
+.LBB1346:
+.LBB1345:
+# blake2b-generic.c:5: static inline u64 ror64(unsigned l, u64 x) { return (x >> l) | (x << (64-l)); }
+	.loc 1 5 62 view .LVU2920
+	rolq	%rbx	# _1974
+.LVL521:
+	.loc 1 5 62 view .LVU2921
+.LBE1345:
+.LBE1346:
+# blake2b-generic.c:46:     FULLROUND(8);
+	.loc 1 46 955 view .LVU2922
+	movq	%rbx, 48(%rax)	# _1974, MEM[(u64 *)v_1170(D) + 48B]
+	.loc 1 46 673 is_stmt 1 view .LVU2923
+	.loc 1 46 1000 view .LVU2924
+	.loc 1 46 1005 view .LVU2925
+# blake2b-generic.c:46:     FULLROUND(8);
+	.loc 1 46 1013 is_stmt 0 view .LVU2926
+	addq	(%r9), %r10	# *m_1171(D), tmp2180
+	addq	%r11, %r10	# _1926, _823
+# blake2b-generic.c:46:     FULLROUND(8);
+	.loc 1 46 1071 view .LVU2927
+	xorq	%r10, %r12	# _823, _1899
+# blake2b-generic.c:46:     FULLROUND(8);
+	.loc 1 46 1013 view .LVU2928
+	movq	%r10, 24(%rax)	# _823, MEM[(u64 *)v_1170(D) + 24B]
+	.loc 1 46 1061 is_stmt 1 view .LVU2929
+.LVL522:
+.LBB1347:
+.LBI1347:
+	.loc 1 5 19 view .LVU2930
+.LBB1348:
+	.loc 1 5 46 view .LVU2931
+# blake2b-generic.c:5: static inline u64 ror64(unsigned l, u64 x) { return (x >> l) | (x << (64-l)); }
+	.loc 1 5 62 is_stmt 0 view .LVU2932
+	rolq	$32, %r12	#, _1977
+.LVL523:
+	.loc 1 5 62 view .LVU2933
+.LBE1348:
+.LBE1347:
+# blake2b-generic.c:46:     FULLROUND(8);
+	.loc 1 46 1109 view .LVU2934
+	addq	%r12, %r15	# _1977, _825
+# blake2b-generic.c:46:     FULLROUND(8);
+	.loc 1 46 1069 view .LVU2935
+	movq	%r12, 120(%rax)	# _1977, MEM[(u64 *)v_1170(D) + 120B]
+	.loc 1 46 1101 is_stmt 1 view .LVU2936
+# blake2b-generic.c:46:     FULLROUND(8);
+	.loc 1 46 1131 is_stmt 0 view .LVU2937
+	xorq	%r15, %r11	# _825, tmp2183
+# blake2b-generic.c:46:     FULLROUND(8);
+	.loc 1 46 1109 view .LVU2938
+	movq	%r15, 88(%rax)	# _825, MEM[(u64 *)v_1170(D) + 88B]
+	.loc 1 46 1121 is_stmt 1 view .LVU2939
+.LVL524:
+.LBB1349:
+.LBI1349:
+	.loc 1 5 19 view .LVU2940
+.LBB1350:
+	.loc 1 5 46 view .LVU2941
+# blake2b-generic.c:5: static inline u64 ror64(unsigned l, u64 x) { return (x >> l) | (x << (64-l)); }
+	.loc 1 5 62 is_stmt 0 view .LVU2942
+	rorq	$24, %r11	#, _1980
+.LVL525:
+	.loc 1 5 62 view .LVU2943
+.LBE1350:
+.LBE1349:
+# blake2b-generic.c:46:     FULLROUND(8);
+	.loc 1 46 1129 view .LVU2944
+	movq	%r11, 56(%rax)	# _1980, MEM[(u64 *)v_1170(D) + 56B]
+	.loc 1 46 1161 is_stmt 1 view .LVU2945
+# blake2b-generic.c:46:     FULLROUND(8);
+	.loc 1 46 1169 is_stmt 0 view .LVU2946
+	addq	64(%r9), %r10	# MEM[(const u64 *)m_1171(D) + 64B], tmp2184
+	addq	%r11, %r10	# _1980, _829
+# blake2b-generic.c:46:     FULLROUND(8);
+	.loc 1 46 1227 view .LVU2947
+	xorq	%r10, %r12	# _829, tmp2186
+# blake2b-generic.c:46:     FULLROUND(8);
+	.loc 1 46 1169 view .LVU2948
+	movq	%r10, 24(%rax)	# _829, MEM[(u64 *)v_1170(D) + 24B]
+	.loc 1 46 1217 is_stmt 1 view .LVU2949
+.LVL526:
+.LBB1351:
+.LBI1351:
+	.loc 1 5 19 view .LVU2950
+.LBB1352:
+	.loc 1 5 46 view .LVU2951
+# blake2b-generic.c:5: static inline u64 ror64(unsigned l, u64 x) { return (x >> l) | (x << (64-l)); }
+	.loc 1 5 62 is_stmt 0 view .LVU2952
+	rorq	$16, %r12	#, _1983
+.LVL527:
+	.loc 1 5 62 view .LVU2953
+.LBE1352:
+.LBE1351:
+# blake2b-generic.c:46:     FULLROUND(8);
+	.loc 1 46 1265 view .LVU2954
+	addq	%r12, %r15	# _1983, _831
+# blake2b-generic.c:46:     FULLROUND(8);
+	.loc 1 46 1225 view .LVU2955
+	movq	%r12, 120(%rax)	# _1983, MEM[(u64 *)v_1170(D) + 120B]
+	.loc 1 46 1257 is_stmt 1 view .LVU2956
+# blake2b-generic.c:46:     FULLROUND(8);
+	.loc 1 46 1287 is_stmt 0 view .LVU2957
+	xorq	%r15, %r11	# _831, tmp2187
+# blake2b-generic.c:46:     FULLROUND(8);
+	.loc 1 46 1265 view .LVU2958
+	movq	%r15, 88(%rax)	# _831, MEM[(u64 *)v_1170(D) + 88B]
+	.loc 1 46 1277 is_stmt 1 view .LVU2959
+.LVL528:
+.LBB1353:
+.LBI1353:
+	.loc 1 5 19 view .LVU2960
+.LBB1354:
+	.loc 1 5 46 view .LVU2961
+# blake2b-generic.c:5: static inline u64 ror64(unsigned l, u64 x) { return (x >> l) | (x << (64-l)); }
+	.loc 1 5 62 is_stmt 0 view .LVU2962
+	rolq	%r11	# _1986
+.LVL529:
+	.loc 1 5 62 view .LVU2963
+.LBE1354:
+.LBE1353:
+# blake2b-generic.c:46:     FULLROUND(8);
+	.loc 1 46 1285 view .LVU2964
+	movq	%r11, 56(%rax)	# _1986, MEM[(u64 *)v_1170(D) + 56B]
+	.loc 1 46 1003 is_stmt 1 view .LVU2965
+	.loc 1 46 1330 view .LVU2966
+	.loc 1 46 1335 view .LVU2967
+# blake2b-generic.c:46:     FULLROUND(8);
+	.loc 1 46 1343 is_stmt 0 view .LVU2968
+	addq	96(%r9), %r8	# MEM[(const u64 *)m_1171(D) + 96B], tmp2188
+	addq	%rbp, %r8	# _1962, _835
+# blake2b-generic.c:46:     FULLROUND(8);
+	.loc 1 46 1401 view .LVU2969
+	xorq	%r8, %r12	# _835, tmp2190
+# blake2b-generic.c:46:     FULLROUND(8);
+	.loc 1 46 1343 view .LVU2970
+	movq	%r8, (%rax)	# _835, *v_1170(D)
+	.loc 1 46 1391 is_stmt 1 view .LVU2971
+.LVL530:
+.LBB1355:
+.LBI1355:
+	.loc 1 5 19 view .LVU2972
+.LBB1356:
+	.loc 1 5 46 view .LVU2973
+# blake2b-generic.c:5: static inline u64 ror64(unsigned l, u64 x) { return (x >> l) | (x << (64-l)); }
+	.loc 1 5 62 is_stmt 0 view .LVU2974
+	rolq	$32, %r12	#, _1989
+.LVL531:
+	.loc 1 5 62 view .LVU2975
+.LBE1356:
+.LBE1355:
+# blake2b-generic.c:46:     FULLROUND(8);
+	.loc 1 46 1439 view .LVU2976
+	addq	%r12, %r14	# _1989, _837
+# blake2b-generic.c:46:     FULLROUND(8);
+	.loc 1 46 1399 view .LVU2977
+	movq	%r12, 120(%rax)	# _1989, MEM[(u64 *)v_1170(D) + 120B]
+	.loc 1 46 1431 is_stmt 1 view .LVU2978
+# blake2b-generic.c:46:     FULLROUND(8);
+	.loc 1 46 1461 is_stmt 0 view .LVU2979
+	xorq	%r14, %rbp	# _837, tmp2191
+# blake2b-generic.c:46:     FULLROUND(8);
+	.loc 1 46 1439 view .LVU2980
+	movq	%r14, 80(%rax)	# _837, MEM[(u64 *)v_1170(D) + 80B]
+	.loc 1 46 1451 is_stmt 1 view .LVU2981
+.LVL532:
+.LBB1357:
+.LBI1357:
+	.loc 1 5 19 view .LVU2982
+.LBB1358:
+	.loc 1 5 46 view .LVU2983
+# blake2b-generic.c:5: static inline u64 ror64(unsigned l, u64 x) { return (x >> l) | (x << (64-l)); }
+	.loc 1 5 62 is_stmt 0 view .LVU2984
+	rorq	$24, %rbp	#, _1992
+.LVL533:
+	.loc 1 5 62 view .LVU2985
+.LBE1358:
+.LBE1357:
+# blake2b-generic.c:46:     FULLROUND(8);
+	.loc 1 46 1459 view .LVU2986
+	movq	%rbp, 40(%rax)	# _1992, MEM[(u64 *)v_1170(D) + 40B]
+	.loc 1 46 1491 is_stmt 1 view .LVU2987
+# blake2b-generic.c:46:     FULLROUND(8);
+	.loc 1 46 1499 is_stmt 0 view .LVU2988
+	addq	16(%r9), %r8	# MEM[(const u64 *)m_1171(D) + 16B], tmp2192
+	addq	%rbp, %r8	# _1992, _841
+# blake2b-generic.c:46:     FULLROUND(8);
+	.loc 1 46 1557 view .LVU2989
+	xorq	%r8, %r12	# _841, tmp2194
+# blake2b-generic.c:46:     FULLROUND(8);
+	.loc 1 46 1499 view .LVU2990
+	movq	%r8, (%rax)	# _841, *v_1170(D)
+	.loc 1 46 1547 is_stmt 1 view .LVU2991
+.LVL534:
+.LBB1359:
+.LBI1359:
+	.loc 1 5 19 view .LVU2992
+.LBB1360:
+	.loc 1 5 46 view .LVU2993
+# blake2b-generic.c:5: static inline u64 ror64(unsigned l, u64 x) { return (x >> l) | (x << (64-l)); }
+	.loc 1 5 62 is_stmt 0 view .LVU2994
+	rorq	$16, %r12	#, tmp2194
+.LBE1360:
+.LBE1359:
+# blake2b-generic.c:46:     FULLROUND(8);
+	.loc 1 46 1595 view .LVU2995
+	addq	%r12, %r14	# _1995, _843
+# blake2b-generic.c:46:     FULLROUND(8);
+	.loc 1 46 1555 view .LVU2996
+	movq	%r12, 120(%rax)	# _1995, MEM[(u64 *)v_1170(D) + 120B]
+	.loc 1 46 1587 is_stmt 1 view .LVU2997
+# blake2b-generic.c:46:     FULLROUND(8);
+	.loc 1 46 1617 is_stmt 0 view .LVU2998
+	xorq	%r14, %rbp	# _843, tmp2195
+# blake2b-generic.c:46:     FULLROUND(8);
+	.loc 1 46 1595 view .LVU2999
+	movq	%r14, 80(%rax)	# _843, MEM[(u64 *)v_1170(D) + 80B]
+	.loc 1 46 1607 is_stmt 1 view .LVU3000
+.LVL535:
+.LBB1361:
+.LBI1361:
+	.loc 1 5 19 view .LVU3001
+.LBB1362:
+	.loc 1 5 46 view .LVU3002
+# blake2b-generic.c:5: static inline u64 ror64(unsigned l, u64 x) { return (x >> l) | (x << (64-l)); }
+	.loc 1 5 62 is_stmt 0 view .LVU3003
+	rolq	%rbp	# _1998
+.LVL536:
+	.loc 1 5 62 view .LVU3004
+.LBE1362:
+.LBE1361:
+# blake2b-generic.c:46:     FULLROUND(8);
+	.loc 1 46 1595 view .LVU3005
+	movq	%r12, -40(%rsp)	# _1995, %sfp
+# blake2b-generic.c:46:     FULLROUND(8);
+	.loc 1 46 1615 view .LVU3006
+	movq	%rbp, 40(%rax)	# _1998, MEM[(u64 *)v_1170(D) + 40B]
+	.loc 1 46 1333 is_stmt 1 view .LVU3007
+	.loc 1 46 1660 view .LVU3008
+	.loc 1 46 1665 view .LVU3009
+# blake2b-generic.c:46:     FULLROUND(8);
+	.loc 1 46 1673 is_stmt 0 view .LVU3010
+	addq	104(%r9), %rsi	# MEM[(const u64 *)m_1171(D) + 104B], tmp2196
+	addq	%rbx, %rsi	# _1974, _847
+# blake2b-generic.c:46:     FULLROUND(8);
+	.loc 1 46 1617 view .LVU3011
+	movq	%r14, -72(%rsp)	# _843, %sfp
+# blake2b-generic.c:46:     FULLROUND(8);
+	.loc 1 46 1732 view .LVU3012
+	xorq	%rsi, %rdi	# _847, tmp2198
+# blake2b-generic.c:46:     FULLROUND(8);
+	.loc 1 46 1673 view .LVU3013
+	movq	%rsi, 8(%rax)	# _847, MEM[(u64 *)v_1170(D) + 8B]
+	.loc 1 46 1722 is_stmt 1 view .LVU3014
+.LVL537:
+.LBB1363:
+.LBI1363:
+	.loc 1 5 19 view .LVU3015
+.LBB1364:
+	.loc 1 5 46 view .LVU3016
+# blake2b-generic.c:5: static inline u64 ror64(unsigned l, u64 x) { return (x >> l) | (x << (64-l)); }
+	.loc 1 5 62 is_stmt 0 view .LVU3017
+	rolq	$32, %rdi	#, _2001
+.LVL538:
+	.loc 1 5 62 view .LVU3018
+.LBE1364:
+.LBE1363:
+# blake2b-generic.c:46:     FULLROUND(8);
+	.loc 1 46 1770 view .LVU3019
+	addq	%rdi, %r15	# _2001, _849
+# blake2b-generic.c:46:     FULLROUND(8);
+	.loc 1 46 1730 view .LVU3020
+	movq	%rdi, 96(%rax)	# _2001, MEM[(u64 *)v_1170(D) + 96B]
+	.loc 1 46 1762 is_stmt 1 view .LVU3021
+# blake2b-generic.c:46:     FULLROUND(8);
+	.loc 1 46 1792 is_stmt 0 view .LVU3022
+	xorq	%r15, %rbx	# _849, tmp2199
+# blake2b-generic.c:46:     FULLROUND(8);
+	.loc 1 46 1770 view .LVU3023
+	movq	%r15, 88(%rax)	# _849, MEM[(u64 *)v_1170(D) + 88B]
+	.loc 1 46 1782 is_stmt 1 view .LVU3024
+.LVL539:
+.LBB1365:
+.LBI1365:
+	.loc 1 5 19 view .LVU3025
+.LBB1366:
+	.loc 1 5 46 view .LVU3026
+# blake2b-generic.c:5: static inline u64 ror64(unsigned l, u64 x) { return (x >> l) | (x << (64-l)); }
+	.loc 1 5 62 is_stmt 0 view .LVU3027
+	rorq	$24, %rbx	#, _2004
+.LVL540:
+	.loc 1 5 62 view .LVU3028
+.LBE1366:
+.LBE1365:
+# blake2b-generic.c:46:     FULLROUND(8);
+	.loc 1 46 1790 view .LVU3029
+	movq	%rbx, 48(%rax)	# _2004, MEM[(u64 *)v_1170(D) + 48B]
+	.loc 1 46 1822 is_stmt 1 view .LVU3030
+# blake2b-generic.c:46:     FULLROUND(8);
+	.loc 1 46 1830 is_stmt 0 view .LVU3031
+	addq	56(%r9), %rsi	# MEM[(const u64 *)m_1171(D) + 56B], tmp2200
+	addq	%rbx, %rsi	# _2004, _853
+# blake2b-generic.c:46:     FULLROUND(8);
+	.loc 1 46 1889 view .LVU3032
+	xorq	%rsi, %rdi	# _853, tmp2202
+# blake2b-generic.c:46:     FULLROUND(8);
+	.loc 1 46 1830 view .LVU3033
+	movq	%rsi, 8(%rax)	# _853, MEM[(u64 *)v_1170(D) + 8B]
+	.loc 1 46 1879 is_stmt 1 view .LVU3034
+.LVL541:
+.LBB1367:
+.LBI1367:
+	.loc 1 5 19 view .LVU3035
+.LBB1368:
+	.loc 1 5 46 view .LVU3036
+.LBE1368:
+.LBE1367:
+# blake2b-generic.c:46:     FULLROUND(8);
+	.loc 1 46 2337 is_stmt 0 view .LVU3037
+	movq	-48(%rsp), %r14	# %sfp, _1950
+.LBB1370:
+.LBB1369:
+# blake2b-generic.c:5: static inline u64 ror64(unsigned l, u64 x) { return (x >> l) | (x << (64-l)); }
+	.loc 1 5 62 view .LVU3038
+	rorq	$16, %rdi	#, _2007
+.LVL542:
+	.loc 1 5 62 view .LVU3039
+.LBE1369:
+.LBE1370:
+# blake2b-generic.c:46:     FULLROUND(8);
+	.loc 1 46 1927 view .LVU3040
+	addq	%rdi, %r15	# _2007, _855
+# blake2b-generic.c:46:     FULLROUND(8);
+	.loc 1 46 1887 view .LVU3041
+	movq	%rdi, 96(%rax)	# _2007, MEM[(u64 *)v_1170(D) + 96B]
+	.loc 1 46 1919 is_stmt 1 view .LVU3042
+# blake2b-generic.c:46:     FULLROUND(8);
+	.loc 1 46 1949 is_stmt 0 view .LVU3043
+	xorq	%r15, %rbx	# _855, tmp2203
+# blake2b-generic.c:46:     FULLROUND(8);
+	.loc 1 46 1927 view .LVU3044
+	movq	%r15, 88(%rax)	# _855, MEM[(u64 *)v_1170(D) + 88B]
+	.loc 1 46 1939 is_stmt 1 view .LVU3045
+.LVL543:
+.LBB1371:
+.LBI1371:
+	.loc 1 5 19 view .LVU3046
+.LBB1372:
+	.loc 1 5 46 view .LVU3047
+# blake2b-generic.c:5: static inline u64 ror64(unsigned l, u64 x) { return (x >> l) | (x << (64-l)); }
+	.loc 1 5 62 is_stmt 0 view .LVU3048
+	rolq	%rbx	# _2010
+.LVL544:
+	.loc 1 5 62 view .LVU3049
+.LBE1372:
+.LBE1371:
+# blake2b-generic.c:46:     FULLROUND(8);
+	.loc 1 46 1949 view .LVU3050
+	movq	%r15, -64(%rsp)	# _855, %sfp
+# blake2b-generic.c:46:     FULLROUND(8);
+	.loc 1 46 2102 view .LVU3051
+	movq	-80(%rsp), %r15	# %sfp, _795
+# blake2b-generic.c:46:     FULLROUND(8);
+	.loc 1 46 1947 view .LVU3052
+	movq	%rbx, 48(%rax)	# _2010, MEM[(u64 *)v_1170(D) + 48B]
+	.loc 1 46 1663 is_stmt 1 view .LVU3053
+	.loc 1 46 1992 view .LVU3054
+	.loc 1 46 1997 view .LVU3055
+# blake2b-generic.c:46:     FULLROUND(8);
+	.loc 1 46 2005 is_stmt 0 view .LVU3056
+	addq	8(%r9), %rdx	# MEM[(const u64 *)m_1171(D) + 8B], tmp2204
+	addq	%r11, %rdx	# _1986, _859
+# blake2b-generic.c:46:     FULLROUND(8);
+	.loc 1 46 2064 view .LVU3057
+	xorq	%rdx, %rcx	# _859, tmp2206
+# blake2b-generic.c:46:     FULLROUND(8);
+	.loc 1 46 2005 view .LVU3058
+	movq	%rdx, 16(%rax)	# _859, MEM[(u64 *)v_1170(D) + 16B]
+	.loc 1 46 2054 is_stmt 1 view .LVU3059
+.LVL545:
+.LBB1373:
+.LBI1373:
+	.loc 1 5 19 view .LVU3060
+.LBB1374:
+	.loc 1 5 46 view .LVU3061
+# blake2b-generic.c:5: static inline u64 ror64(unsigned l, u64 x) { return (x >> l) | (x << (64-l)); }
+	.loc 1 5 62 is_stmt 0 view .LVU3062
+	rolq	$32, %rcx	#, _2013
+.LVL546:
+	.loc 1 5 62 view .LVU3063
+.LBE1374:
+.LBE1373:
+# blake2b-generic.c:46:     FULLROUND(8);
+	.loc 1 46 2102 view .LVU3064
+	leaq	(%r15,%rcx), %r12	#, _861
+# blake2b-generic.c:46:     FULLROUND(8);
+	.loc 1 46 2062 view .LVU3065
+	movq	%rcx, 104(%rax)	# _2013, MEM[(u64 *)v_1170(D) + 104B]
+	.loc 1 46 2094 is_stmt 1 view .LVU3066
+# blake2b-generic.c:46:     FULLROUND(8);
+	.loc 1 46 2434 is_stmt 0 view .LVU3067
+	movq	-56(%rsp), %r15	# %sfp, _807
+# blake2b-generic.c:46:     FULLROUND(8);
+	.loc 1 46 2124 view .LVU3068
+	xorq	%r12, %r11	# _861, tmp2207
+# blake2b-generic.c:46:     FULLROUND(8);
+	.loc 1 46 2102 view .LVU3069
+	movq	%r12, 64(%rax)	# _861, MEM[(u64 *)v_1170(D) + 64B]
+	.loc 1 46 2114 is_stmt 1 view .LVU3070
+.LVL547:
+.LBB1375:
+.LBI1375:
+	.loc 1 5 19 view .LVU3071
+.LBB1376:
+	.loc 1 5 46 view .LVU3072
+# blake2b-generic.c:5: static inline u64 ror64(unsigned l, u64 x) { return (x >> l) | (x << (64-l)); }
+	.loc 1 5 62 is_stmt 0 view .LVU3073
+	rorq	$24, %r11	#, _2016
+.LVL548:
+	.loc 1 5 62 view .LVU3074
+.LBE1376:
+.LBE1375:
+# blake2b-generic.c:46:     FULLROUND(8);
+	.loc 1 46 2122 view .LVU3075
+	movq	%r11, 56(%rax)	# _2016, MEM[(u64 *)v_1170(D) + 56B]
+	.loc 1 46 2154 is_stmt 1 view .LVU3076
+# blake2b-generic.c:46:     FULLROUND(8);
+	.loc 1 46 2162 is_stmt 0 view .LVU3077
+	addq	32(%r9), %rdx	# MEM[(const u64 *)m_1171(D) + 32B], tmp2208
+	addq	%r11, %rdx	# _2016, _865
+# blake2b-generic.c:46:     FULLROUND(8);
+	.loc 1 46 2221 view .LVU3078
+	xorq	%rdx, %rcx	# _865, tmp2210
+# blake2b-generic.c:46:     FULLROUND(8);
+	.loc 1 46 2162 view .LVU3079
+	movq	%rdx, 16(%rax)	# _865, MEM[(u64 *)v_1170(D) + 16B]
+	.loc 1 46 2211 is_stmt 1 view .LVU3080
+.LVL549:
+.LBB1377:
+.LBI1377:
+	.loc 1 5 19 view .LVU3081
+.LBB1378:
+	.loc 1 5 46 view .LVU3082
+# blake2b-generic.c:5: static inline u64 ror64(unsigned l, u64 x) { return (x >> l) | (x << (64-l)); }
+	.loc 1 5 62 is_stmt 0 view .LVU3083
+	rorq	$16, %rcx	#, _2019
+.LVL550:
+	.loc 1 5 62 view .LVU3084
+.LBE1378:
+.LBE1377:
+# blake2b-generic.c:46:     FULLROUND(8);
+	.loc 1 46 2259 view .LVU3085
+	addq	%rcx, %r12	# _2019, _867
+# blake2b-generic.c:46:     FULLROUND(8);
+	.loc 1 46 2219 view .LVU3086
+	movq	%rcx, 104(%rax)	# _2019, MEM[(u64 *)v_1170(D) + 104B]
+	.loc 1 46 2251 is_stmt 1 view .LVU3087
+# blake2b-generic.c:46:     FULLROUND(8);
+	.loc 1 46 2281 is_stmt 0 view .LVU3088
+	xorq	%r12, %r11	# _867, tmp2211
+# blake2b-generic.c:46:     FULLROUND(8);
+	.loc 1 46 2259 view .LVU3089
+	movq	%r12, 64(%rax)	# _867, MEM[(u64 *)v_1170(D) + 64B]
+	.loc 1 46 2271 is_stmt 1 view .LVU3090
+.LVL551:
+.LBB1379:
+.LBI1379:
+	.loc 1 5 19 view .LVU3091
+.LBB1380:
+	.loc 1 5 46 view .LVU3092
+# blake2b-generic.c:5: static inline u64 ror64(unsigned l, u64 x) { return (x >> l) | (x << (64-l)); }
+	.loc 1 5 62 is_stmt 0 view .LVU3093
+	rolq	%r11	# _2022
+.LVL552:
+	.loc 1 5 62 view .LVU3094
+.LBE1380:
+.LBE1379:
+# blake2b-generic.c:46:     FULLROUND(8);
+	.loc 1 46 2279 view .LVU3095
+	movq	%r11, 56(%rax)	# _2022, MEM[(u64 *)v_1170(D) + 56B]
+	.loc 1 46 1995 is_stmt 1 view .LVU3096
+	.loc 1 46 2324 view .LVU3097
+	.loc 1 46 2329 view .LVU3098
+# blake2b-generic.c:46:     FULLROUND(8);
+	.loc 1 46 2337 is_stmt 0 view .LVU3099
+	addq	80(%r9), %r10	# MEM[(const u64 *)m_1171(D) + 80B], tmp2212
+	addq	%r14, %r10	# _1950, _871
+# blake2b-generic.c:46:     FULLROUND(8);
+	.loc 1 46 2396 view .LVU3100
+	xorq	%r10, %r13	# _871, tmp2214
+# blake2b-generic.c:46:     FULLROUND(8);
+	.loc 1 46 2337 view .LVU3101
+	movq	%r10, 24(%rax)	# _871, MEM[(u64 *)v_1170(D) + 24B]
+	.loc 1 46 2386 is_stmt 1 view .LVU3102
+.LVL553:
+.LBB1381:
+.LBI1381:
+	.loc 1 5 19 view .LVU3103
+.LBB1382:
+	.loc 1 5 46 view .LVU3104
+# blake2b-generic.c:5: static inline u64 ror64(unsigned l, u64 x) { return (x >> l) | (x << (64-l)); }
+	.loc 1 5 62 is_stmt 0 view .LVU3105
+	rolq	$32, %r13	#, _2025
+.LVL554:
+	.loc 1 5 62 view .LVU3106
+.LBE1382:
+.LBE1381:
+# blake2b-generic.c:46:     FULLROUND(8);
+	.loc 1 46 2434 view .LVU3107
+	addq	%r13, %r15	# _2025, _873
+# blake2b-generic.c:46:     FULLROUND(8);
+	.loc 1 46 2394 view .LVU3108
+	movq	%r13, 112(%rax)	# _2025, MEM[(u64 *)v_1170(D) + 112B]
+	.loc 1 46 2426 is_stmt 1 view .LVU3109
+# blake2b-generic.c:46:     FULLROUND(8);
+	.loc 1 46 2456 is_stmt 0 view .LVU3110
+	xorq	%r15, %r14	# _873, _1950
+# blake2b-generic.c:46:     FULLROUND(8);
+	.loc 1 46 2434 view .LVU3111
+	movq	%r15, 72(%rax)	# _873, MEM[(u64 *)v_1170(D) + 72B]
+	.loc 1 46 2446 is_stmt 1 view .LVU3112
+.LVL555:
+.LBB1383:
+.LBI1383:
+	.loc 1 5 19 view .LVU3113
+.LBB1384:
+	.loc 1 5 46 view .LVU3114
+# blake2b-generic.c:5: static inline u64 ror64(unsigned l, u64 x) { return (x >> l) | (x << (64-l)); }
+	.loc 1 5 62 is_stmt 0 view .LVU3115
+	rorq	$24, %r14	#, _2028
+.LVL556:
+	.loc 1 5 62 view .LVU3116
+.LBE1384:
+.LBE1383:
+# blake2b-generic.c:46:     FULLROUND(8);
+	.loc 1 46 2454 view .LVU3117
+	movq	%r14, 32(%rax)	# _2028, MEM[(u64 *)v_1170(D) + 32B]
+	.loc 1 46 2486 is_stmt 1 view .LVU3118
+# blake2b-generic.c:46:     FULLROUND(8);
+	.loc 1 46 2494 is_stmt 0 view .LVU3119
+	addq	40(%r9), %r10	# MEM[(const u64 *)m_1171(D) + 40B], tmp2216
+	addq	%r14, %r10	# _2028, _877
+# blake2b-generic.c:46:     FULLROUND(8);
+	.loc 1 46 2553 view .LVU3120
+	xorq	%r10, %r13	# _877, tmp2218
+# blake2b-generic.c:46:     FULLROUND(8);
+	.loc 1 46 2494 view .LVU3121
+	movq	%r10, 24(%rax)	# _877, MEM[(u64 *)v_1170(D) + 24B]
+	.loc 1 46 2543 is_stmt 1 view .LVU3122
+.LVL557:
+.LBB1385:
+.LBI1385:
+	.loc 1 5 19 view .LVU3123
+.LBB1386:
+	.loc 1 5 46 view .LVU3124
+# blake2b-generic.c:5: static inline u64 ror64(unsigned l, u64 x) { return (x >> l) | (x << (64-l)); }
+	.loc 1 5 62 is_stmt 0 view .LVU3125
+	rorq	$16, %r13	#, _2031
+.LVL558:
+	.loc 1 5 62 view .LVU3126
+.LBE1386:
+.LBE1385:
+# blake2b-generic.c:46:     FULLROUND(8);
+	.loc 1 46 2591 view .LVU3127
+	addq	%r13, %r15	# _2031, _879
+# blake2b-generic.c:46:     FULLROUND(8);
+	.loc 1 46 2551 view .LVU3128
+	movq	%r13, 112(%rax)	# _2031, MEM[(u64 *)v_1170(D) + 112B]
+	.loc 1 46 2583 is_stmt 1 view .LVU3129
+# blake2b-generic.c:46:     FULLROUND(8);
+	.loc 1 46 2613 is_stmt 0 view .LVU3130
+	xorq	%r15, %r14	# _879, tmp2219
+# blake2b-generic.c:46:     FULLROUND(8);
+	.loc 1 46 2591 view .LVU3131
+	movq	%r15, 72(%rax)	# _879, MEM[(u64 *)v_1170(D) + 72B]
+	.loc 1 46 2603 is_stmt 1 view .LVU3132
+.LVL559:
+.LBB1387:
+.LBI1387:
+	.loc 1 5 19 view .LVU3133
+.LBB1388:
+	.loc 1 5 46 view .LVU3134
+# blake2b-generic.c:5: static inline u64 ror64(unsigned l, u64 x) { return (x >> l) | (x << (64-l)); }
+	.loc 1 5 62 is_stmt 0 view .LVU3135
+	rolq	%r14	# _2034
+.LVL560:
+	.loc 1 5 62 view .LVU3136
+.LBE1388:
+.LBE1387:
+# blake2b-generic.c:46:     FULLROUND(8);
+	.loc 1 46 2611 view .LVU3137
+	movq	%r14, 32(%rax)	# _2034, MEM[(u64 *)v_1170(D) + 32B]
+	.loc 1 46 2327 is_stmt 1 view .LVU3138
+	.loc 1 46 8 view .LVU3139
+	.loc 1 47 5 view .LVU3140
+	.loc 1 47 10 view .LVU3141
+	.loc 1 47 15 view .LVU3142
+# blake2b-generic.c:47:     FULLROUND(9);
+	.loc 1 47 23 is_stmt 0 view .LVU3143
+	addq	80(%r9), %r8	# MEM[(const u64 *)m_1171(D) + 80B], tmp2220
+	addq	%r14, %r8	# _2034, _883
+# blake2b-generic.c:47:     FULLROUND(9);
+	.loc 1 47 81 view .LVU3144
+	xorq	%r8, %rdi	# _883, tmp2222
+# blake2b-generic.c:47:     FULLROUND(9);
+	.loc 1 47 23 view .LVU3145
+	movq	%r8, (%rax)	# _883, *v_1170(D)
+	.loc 1 47 71 is_stmt 1 view .LVU3146
+.LVL561:
+.LBB1389:
+.LBI1389:
+	.loc 1 5 19 view .LVU3147
+.LBB1390:
+	.loc 1 5 46 view .LVU3148
+# blake2b-generic.c:5: static inline u64 ror64(unsigned l, u64 x) { return (x >> l) | (x << (64-l)); }
+	.loc 1 5 62 is_stmt 0 view .LVU3149
+	rolq	$32, %rdi	#, _2037
+.LVL562:
+	.loc 1 5 62 view .LVU3150
+.LBE1390:
+.LBE1389:
+# blake2b-generic.c:47:     FULLROUND(9);
+	.loc 1 47 119 view .LVU3151
+	addq	%rdi, %r12	# _2037, _885
+# blake2b-generic.c:47:     FULLROUND(9);
+	.loc 1 47 79 view .LVU3152
+	movq	%rdi, 96(%rax)	# _2037, MEM[(u64 *)v_1170(D) + 96B]
+	.loc 1 47 111 is_stmt 1 view .LVU3153
+# blake2b-generic.c:47:     FULLROUND(9);
+	.loc 1 47 141 is_stmt 0 view .LVU3154
+	xorq	%r12, %r14	# _885, tmp2223
+# blake2b-generic.c:47:     FULLROUND(9);
+	.loc 1 47 119 view .LVU3155
+	movq	%r12, 64(%rax)	# _885, MEM[(u64 *)v_1170(D) + 64B]
+	.loc 1 47 131 is_stmt 1 view .LVU3156
+.LVL563:
+.LBB1391:
+.LBI1391:
+	.loc 1 5 19 view .LVU3157
+.LBB1392:
+	.loc 1 5 46 view .LVU3158
+# blake2b-generic.c:5: static inline u64 ror64(unsigned l, u64 x) { return (x >> l) | (x << (64-l)); }
+	.loc 1 5 62 is_stmt 0 view .LVU3159
+	rorq	$24, %r14	#, _2040
+.LVL564:
+	.loc 1 5 62 view .LVU3160
+.LBE1392:
+.LBE1391:
+# blake2b-generic.c:47:     FULLROUND(9);
+	.loc 1 47 139 view .LVU3161
+	movq	%r14, 32(%rax)	# _2040, MEM[(u64 *)v_1170(D) + 32B]
+	.loc 1 47 171 is_stmt 1 view .LVU3162
+# blake2b-generic.c:47:     FULLROUND(9);
+	.loc 1 47 179 is_stmt 0 view .LVU3163
+	addq	16(%r9), %r8	# MEM[(const u64 *)m_1171(D) + 16B], tmp2224
+	addq	%r14, %r8	# _2040, _889
+# blake2b-generic.c:47:     FULLROUND(9);
+	.loc 1 47 237 view .LVU3164
+	xorq	%r8, %rdi	# _889, tmp2226
+# blake2b-generic.c:47:     FULLROUND(9);
+	.loc 1 47 179 view .LVU3165
+	movq	%r8, (%rax)	# _889, *v_1170(D)
+	.loc 1 47 227 is_stmt 1 view .LVU3166
+.LVL565:
+.LBB1393:
+.LBI1393:
+	.loc 1 5 19 view .LVU3167
+.LBB1394:
+	.loc 1 5 46 view .LVU3168
+# blake2b-generic.c:5: static inline u64 ror64(unsigned l, u64 x) { return (x >> l) | (x << (64-l)); }
+	.loc 1 5 62 is_stmt 0 view .LVU3169
+	rorq	$16, %rdi	#, _2043
+.LVL566:
+	.loc 1 5 62 view .LVU3170
+.LBE1394:
+.LBE1393:
+# blake2b-generic.c:47:     FULLROUND(9);
+	.loc 1 47 275 view .LVU3171
+	addq	%rdi, %r12	# _2043, _891
+# blake2b-generic.c:47:     FULLROUND(9);
+	.loc 1 47 235 view .LVU3172
+	movq	%rdi, 96(%rax)	# _2043, MEM[(u64 *)v_1170(D) + 96B]
+	.loc 1 47 267 is_stmt 1 view .LVU3173
+# blake2b-generic.c:47:     FULLROUND(9);
+	.loc 1 47 297 is_stmt 0 view .LVU3174
+	xorq	%r12, %r14	# _891, tmp2227
+# blake2b-generic.c:47:     FULLROUND(9);
+	.loc 1 47 275 view .LVU3175
+	movq	%r12, 64(%rax)	# _891, MEM[(u64 *)v_1170(D) + 64B]
+	.loc 1 47 287 is_stmt 1 view .LVU3176
+.LVL567:
+.LBB1395:
+.LBI1395:
+	.loc 1 5 19 view .LVU3177
+.LBB1396:
+	.loc 1 5 46 view .LVU3178
+# blake2b-generic.c:5: static inline u64 ror64(unsigned l, u64 x) { return (x >> l) | (x << (64-l)); }
+	.loc 1 5 62 is_stmt 0 view .LVU3179
+	rolq	%r14	# tmp2227
+.LBE1396:
+.LBE1395:
+# blake2b-generic.c:47:     FULLROUND(9);
+	.loc 1 47 297 view .LVU3180
+	movq	%r12, -80(%rsp)	# _891, %sfp
+# blake2b-generic.c:47:     FULLROUND(9);
+	.loc 1 47 1071 view .LVU3181
+	movq	-40(%rsp), %r12	# %sfp, _1995
+# blake2b-generic.c:47:     FULLROUND(9);
+	.loc 1 47 295 view .LVU3182
+	movq	%r14, 32(%rax)	# _2046, MEM[(u64 *)v_1170(D) + 32B]
+	.loc 1 47 13 is_stmt 1 view .LVU3183
+	.loc 1 47 340 view .LVU3184
+	.loc 1 47 345 view .LVU3185
+# blake2b-generic.c:47:     FULLROUND(9);
+	.loc 1 47 353 is_stmt 0 view .LVU3186
+	addq	64(%r9), %rsi	# MEM[(const u64 *)m_1171(D) + 64B], tmp2228
+	addq	%rbp, %rsi	# _1998, _895
+# blake2b-generic.c:47:     FULLROUND(9);
+	.loc 1 47 295 view .LVU3187
+	movq	%r14, -48(%rsp)	# _2046, %sfp
+# blake2b-generic.c:47:     FULLROUND(9);
+	.loc 1 47 411 view .LVU3188
+	xorq	%rsi, %rcx	# _895, tmp2230
+# blake2b-generic.c:47:     FULLROUND(9);
+	.loc 1 47 353 view .LVU3189
+	movq	%rsi, 8(%rax)	# _895, MEM[(u64 *)v_1170(D) + 8B]
+	.loc 1 47 401 is_stmt 1 view .LVU3190
+.LVL568:
+.LBB1397:
+.LBI1397:
+	.loc 1 5 19 view .LVU3191
+.LBB1398:
+	.loc 1 5 46 view .LVU3192
+# blake2b-generic.c:5: static inline u64 ror64(unsigned l, u64 x) { return (x >> l) | (x << (64-l)); }
+	.loc 1 5 62 is_stmt 0 view .LVU3193
+	rolq	$32, %rcx	#, _2049
+.LVL569:
+	.loc 1 5 62 view .LVU3194
+.LBE1398:
+.LBE1397:
+# blake2b-generic.c:47:     FULLROUND(9);
+	.loc 1 47 449 view .LVU3195
+	addq	%rcx, %r15	# _2049, _897
+# blake2b-generic.c:47:     FULLROUND(9);
+	.loc 1 47 409 view .LVU3196
+	movq	%rcx, 104(%rax)	# _2049, MEM[(u64 *)v_1170(D) + 104B]
+	.loc 1 47 441 is_stmt 1 view .LVU3197
+# blake2b-generic.c:47:     FULLROUND(9);
+	.loc 1 47 471 is_stmt 0 view .LVU3198
+	xorq	%r15, %rbp	# _897, tmp2231
+# blake2b-generic.c:47:     FULLROUND(9);
+	.loc 1 47 449 view .LVU3199
+	movq	%r15, 72(%rax)	# _897, MEM[(u64 *)v_1170(D) + 72B]
+	.loc 1 47 461 is_stmt 1 view .LVU3200
+.LVL570:
+.LBB1399:
+.LBI1399:
+	.loc 1 5 19 view .LVU3201
+.LBB1400:
+	.loc 1 5 46 view .LVU3202
+# blake2b-generic.c:5: static inline u64 ror64(unsigned l, u64 x) { return (x >> l) | (x << (64-l)); }
+	.loc 1 5 62 is_stmt 0 view .LVU3203
+	rorq	$24, %rbp	#, _2052
+.LVL571:
+	.loc 1 5 62 view .LVU3204
+.LBE1400:
+.LBE1399:
+# blake2b-generic.c:47:     FULLROUND(9);
+	.loc 1 47 469 view .LVU3205
+	movq	%rbp, 40(%rax)	# _2052, MEM[(u64 *)v_1170(D) + 40B]
+	.loc 1 47 501 is_stmt 1 view .LVU3206
+# blake2b-generic.c:47:     FULLROUND(9);
+	.loc 1 47 509 is_stmt 0 view .LVU3207
+	addq	32(%r9), %rsi	# MEM[(const u64 *)m_1171(D) + 32B], tmp2232
+	addq	%rbp, %rsi	# _2052, _901
+# blake2b-generic.c:47:     FULLROUND(9);
+	.loc 1 47 567 view .LVU3208
+	xorq	%rsi, %rcx	# _901, tmp2234
+# blake2b-generic.c:47:     FULLROUND(9);
+	.loc 1 47 509 view .LVU3209
+	movq	%rsi, 8(%rax)	# _901, MEM[(u64 *)v_1170(D) + 8B]
+	.loc 1 47 557 is_stmt 1 view .LVU3210
+.LVL572:
+.LBB1401:
+.LBI1401:
+	.loc 1 5 19 view .LVU3211
+.LBB1402:
+	.loc 1 5 46 view .LVU3212
+# blake2b-generic.c:5: static inline u64 ror64(unsigned l, u64 x) { return (x >> l) | (x << (64-l)); }
+	.loc 1 5 62 is_stmt 0 view .LVU3213
+	rorq	$16, %rcx	#, _2055
+.LVL573:
+	.loc 1 5 62 view .LVU3214
+.LBE1402:
+.LBE1401:
+# blake2b-generic.c:47:     FULLROUND(9);
+	.loc 1 47 605 view .LVU3215
+	addq	%rcx, %r15	# _2055, _903
+# blake2b-generic.c:47:     FULLROUND(9);
+	.loc 1 47 565 view .LVU3216
+	movq	%rcx, 104(%rax)	# _2055, MEM[(u64 *)v_1170(D) + 104B]
+	.loc 1 47 597 is_stmt 1 view .LVU3217
+# blake2b-generic.c:47:     FULLROUND(9);
+	.loc 1 47 627 is_stmt 0 view .LVU3218
+	xorq	%r15, %rbp	# _903, tmp2235
+# blake2b-generic.c:47:     FULLROUND(9);
+	.loc 1 47 605 view .LVU3219
+	movq	%r15, 72(%rax)	# _903, MEM[(u64 *)v_1170(D) + 72B]
+	.loc 1 47 617 is_stmt 1 view .LVU3220
+.LVL574:
+.LBB1403:
+.LBI1403:
+	.loc 1 5 19 view .LVU3221
+.LBB1404:
+	.loc 1 5 46 view .LVU3222
+# blake2b-generic.c:5: static inline u64 ror64(unsigned l, u64 x) { return (x >> l) | (x << (64-l)); }
+	.loc 1 5 62 is_stmt 0 view .LVU3223
+	rolq	%rbp	# _2058
+.LVL575:
+	.loc 1 5 62 view .LVU3224
+.LBE1404:
+.LBE1403:
+# blake2b-generic.c:47:     FULLROUND(9);
+	.loc 1 47 627 view .LVU3225
+	movq	%r15, -56(%rsp)	# _903, %sfp
+# blake2b-generic.c:47:     FULLROUND(9);
+	.loc 1 47 779 view .LVU3226
+	movq	-72(%rsp), %r15	# %sfp, _843
+# blake2b-generic.c:47:     FULLROUND(9);
+	.loc 1 47 625 view .LVU3227
+	movq	%rbp, 40(%rax)	# _2058, MEM[(u64 *)v_1170(D) + 40B]
+	.loc 1 47 343 is_stmt 1 view .LVU3228
+	.loc 1 47 670 view .LVU3229
+	.loc 1 47 675 view .LVU3230
+# blake2b-generic.c:47:     FULLROUND(9);
+	.loc 1 47 683 is_stmt 0 view .LVU3231
+	addq	56(%r9), %rdx	# MEM[(const u64 *)m_1171(D) + 56B], tmp2236
+	addq	%rbx, %rdx	# _2010, _907
+# blake2b-generic.c:47:     FULLROUND(9);
+	.loc 1 47 741 view .LVU3232
+	xorq	%rdx, %r13	# _907, tmp2238
+# blake2b-generic.c:47:     FULLROUND(9);
+	.loc 1 47 683 view .LVU3233
+	movq	%rdx, 16(%rax)	# _907, MEM[(u64 *)v_1170(D) + 16B]
+	.loc 1 47 731 is_stmt 1 view .LVU3234
+.LVL576:
+.LBB1405:
+.LBI1405:
+	.loc 1 5 19 view .LVU3235
+.LBB1406:
+	.loc 1 5 46 view .LVU3236
+# blake2b-generic.c:5: static inline u64 ror64(unsigned l, u64 x) { return (x >> l) | (x << (64-l)); }
+	.loc 1 5 62 is_stmt 0 view .LVU3237
+	rolq	$32, %r13	#, _2061
+.LVL577:
+	.loc 1 5 62 view .LVU3238
+.LBE1406:
+.LBE1405:
+# blake2b-generic.c:47:     FULLROUND(9);
+	.loc 1 47 779 view .LVU3239
+	leaq	(%r15,%r13), %r14	#, _909
+# blake2b-generic.c:47:     FULLROUND(9);
+	.loc 1 47 739 view .LVU3240
+	movq	%r13, 112(%rax)	# _2061, MEM[(u64 *)v_1170(D) + 112B]
+	.loc 1 47 771 is_stmt 1 view .LVU3241
+# blake2b-generic.c:47:     FULLROUND(9);
+	.loc 1 47 801 is_stmt 0 view .LVU3242
+	xorq	%r14, %rbx	# _909, tmp2239
+# blake2b-generic.c:47:     FULLROUND(9);
+	.loc 1 47 779 view .LVU3243
+	movq	%r14, 80(%rax)	# _909, MEM[(u64 *)v_1170(D) + 80B]
+	.loc 1 47 791 is_stmt 1 view .LVU3244
+.LVL578:
+.LBB1407:
+.LBI1407:
+	.loc 1 5 19 view .LVU3245
+.LBB1408:
+	.loc 1 5 46 view .LVU3246
+# blake2b-generic.c:5: static inline u64 ror64(unsigned l, u64 x) { return (x >> l) | (x << (64-l)); }
+	.loc 1 5 62 is_stmt 0 view .LVU3247
+	rorq	$24, %rbx	#, _2064
+.LVL579:
+	.loc 1 5 62 view .LVU3248
+.LBE1408:
+.LBE1407:
+# blake2b-generic.c:47:     FULLROUND(9);
+	.loc 1 47 799 view .LVU3249
+	movq	%rbx, 48(%rax)	# _2064, MEM[(u64 *)v_1170(D) + 48B]
+	.loc 1 47 831 is_stmt 1 view .LVU3250
+# blake2b-generic.c:47:     FULLROUND(9);
+	.loc 1 47 839 is_stmt 0 view .LVU3251
+	addq	48(%r9), %rdx	# MEM[(const u64 *)m_1171(D) + 48B], tmp2240
+	addq	%rbx, %rdx	# _2064, _913
+# blake2b-generic.c:47:     FULLROUND(9);
+	.loc 1 47 897 view .LVU3252
+	xorq	%rdx, %r13	# _913, tmp2242
+# blake2b-generic.c:47:     FULLROUND(9);
+	.loc 1 47 839 view .LVU3253
+	movq	%rdx, 16(%rax)	# _913, MEM[(u64 *)v_1170(D) + 16B]
+	.loc 1 47 887 is_stmt 1 view .LVU3254
+.LVL580:
+.LBB1409:
+.LBI1409:
+	.loc 1 5 19 view .LVU3255
+.LBB1410:
+	.loc 1 5 46 view .LVU3256
+# blake2b-generic.c:5: static inline u64 ror64(unsigned l, u64 x) { return (x >> l) | (x << (64-l)); }
+	.loc 1 5 62 is_stmt 0 view .LVU3257
+	rorq	$16, %r13	#, _2067
+.LVL581:
+	.loc 1 5 62 view .LVU3258
+.LBE1410:
+.LBE1409:
+# blake2b-generic.c:47:     FULLROUND(9);
+	.loc 1 47 935 view .LVU3259
+	addq	%r13, %r14	# _2067, _915
+# blake2b-generic.c:47:     FULLROUND(9);
+	.loc 1 47 895 view .LVU3260
+	movq	%r13, 112(%rax)	# _2067, MEM[(u64 *)v_1170(D) + 112B]
+	.loc 1 47 927 is_stmt 1 view .LVU3261
+# blake2b-generic.c:47:     FULLROUND(9);
+	.loc 1 47 957 is_stmt 0 view .LVU3262
+	xorq	%r14, %rbx	# _915, tmp2243
+# blake2b-generic.c:47:     FULLROUND(9);
+	.loc 1 47 935 view .LVU3263
+	movq	%r14, 80(%rax)	# _915, MEM[(u64 *)v_1170(D) + 80B]
+	.loc 1 47 947 is_stmt 1 view .LVU3264
+.LVL582:
+.LBB1411:
+.LBI1411:
+	.loc 1 5 19 view .LVU3265
+.LBB1412:
+	.loc 1 5 46 view .LVU3266
+# blake2b-generic.c:5: static inline u64 ror64(unsigned l, u64 x) { return (x >> l) | (x << (64-l)); }
+	.loc 1 5 62 is_stmt 0 view .LVU3267
+	rolq	%rbx	# _2070
+.LVL583:
+	.loc 1 5 62 view .LVU3268
+.LBE1412:
+.LBE1411:
+# blake2b-generic.c:47:     FULLROUND(9);
+	.loc 1 47 955 view .LVU3269
+	movq	%rbx, 48(%rax)	# _2070, MEM[(u64 *)v_1170(D) + 48B]
+	.loc 1 47 673 is_stmt 1 view .LVU3270
+	.loc 1 47 1000 view .LVU3271
+	.loc 1 47 1005 view .LVU3272
+# blake2b-generic.c:47:     FULLROUND(9);
+	.loc 1 47 1013 is_stmt 0 view .LVU3273
+	addq	8(%r9), %r10	# MEM[(const u64 *)m_1171(D) + 8B], tmp2244
+	addq	%r11, %r10	# _2022, _919
+# blake2b-generic.c:47:     FULLROUND(9);
+	.loc 1 47 1071 view .LVU3274
+	xorq	%r10, %r12	# _919, _1995
+# blake2b-generic.c:47:     FULLROUND(9);
+	.loc 1 47 1013 view .LVU3275
+	movq	%r10, 24(%rax)	# _919, MEM[(u64 *)v_1170(D) + 24B]
+	.loc 1 47 1061 is_stmt 1 view .LVU3276
+.LVL584:
+.LBB1413:
+.LBI1413:
+	.loc 1 5 19 view .LVU3277
+.LBB1414:
+	.loc 1 5 46 view .LVU3278
+# blake2b-generic.c:5: static inline u64 ror64(unsigned l, u64 x) { return (x >> l) | (x << (64-l)); }
+	.loc 1 5 62 is_stmt 0 view .LVU3279
+	rolq	$32, %r12	#, _2073
+.LVL585:
+	.loc 1 5 62 view .LVU3280
+.LBE1414:
+.LBE1413:
+# blake2b-generic.c:47:     FULLROUND(9);
+	.loc 1 47 1069 view .LVU3281
+	movq	%r12, 120(%rax)	# _2073, MEM[(u64 *)v_1170(D) + 120B]
+	.loc 1 47 1101 is_stmt 1 view .LVU3282
+# blake2b-generic.c:47:     FULLROUND(9);
+	.loc 1 47 1109 is_stmt 0 view .LVU3283
+	movq	-64(%rsp), %r15	# %sfp, _855
+	addq	%r12, %r15	# _2073, _921
+# blake2b-generic.c:47:     FULLROUND(9);
+	.loc 1 47 1131 view .LVU3284
+	xorq	%r15, %r11	# _921, tmp2247
+# blake2b-generic.c:47:     FULLROUND(9);
+	.loc 1 47 1109 view .LVU3285
+	movq	%r15, 88(%rax)	# _921, MEM[(u64 *)v_1170(D) + 88B]
+	.loc 1 47 1121 is_stmt 1 view .LVU3286
+.LVL586:
+.LBB1415:
+.LBI1415:
+	.loc 1 5 19 view .LVU3287
+.LBB1416:
+	.loc 1 5 46 view .LVU3288
+# blake2b-generic.c:5: static inline u64 ror64(unsigned l, u64 x) { return (x >> l) | (x << (64-l)); }
+	.loc 1 5 62 is_stmt 0 view .LVU3289
+	rorq	$24, %r11	#, _2076
+.LVL587:
+	.loc 1 5 62 view .LVU3290
+.LBE1416:
+.LBE1415:
+# blake2b-generic.c:47:     FULLROUND(9);
+	.loc 1 47 1129 view .LVU3291
+	movq	%r11, 56(%rax)	# _2076, MEM[(u64 *)v_1170(D) + 56B]
+	.loc 1 47 1161 is_stmt 1 view .LVU3292
+# blake2b-generic.c:47:     FULLROUND(9);
+	.loc 1 47 1169 is_stmt 0 view .LVU3293
+	addq	40(%r9), %r10	# MEM[(const u64 *)m_1171(D) + 40B], tmp2248
+	addq	%r11, %r10	# _2076, _925
+# blake2b-generic.c:47:     FULLROUND(9);
+	.loc 1 47 1227 view .LVU3294
+	xorq	%r10, %r12	# _925, tmp2250
+# blake2b-generic.c:47:     FULLROUND(9);
+	.loc 1 47 1169 view .LVU3295
+	movq	%r10, 24(%rax)	# _925, MEM[(u64 *)v_1170(D) + 24B]
+	.loc 1 47 1217 is_stmt 1 view .LVU3296
+.LVL588:
+.LBB1417:
+.LBI1417:
+	.loc 1 5 19 view .LVU3297
+.LBB1418:
+	.loc 1 5 46 view .LVU3298
+# blake2b-generic.c:5: static inline u64 ror64(unsigned l, u64 x) { return (x >> l) | (x << (64-l)); }
+	.loc 1 5 62 is_stmt 0 view .LVU3299
+	rorq	$16, %r12	#, _2079
+.LVL589:
+	.loc 1 5 62 view .LVU3300
+.LBE1418:
+.LBE1417:
+# blake2b-generic.c:47:     FULLROUND(9);
+	.loc 1 47 1265 view .LVU3301
+	addq	%r12, %r15	# _2079, _927
+# blake2b-generic.c:47:     FULLROUND(9);
+	.loc 1 47 1225 view .LVU3302
+	movq	%r12, 120(%rax)	# _2079, MEM[(u64 *)v_1170(D) + 120B]
+	.loc 1 47 1257 is_stmt 1 view .LVU3303
+# blake2b-generic.c:47:     FULLROUND(9);
+	.loc 1 47 1287 is_stmt 0 view .LVU3304
+	xorq	%r15, %r11	# _927, tmp2251
+# blake2b-generic.c:47:     FULLROUND(9);
+	.loc 1 47 1265 view .LVU3305
+	movq	%r15, 88(%rax)	# _927, MEM[(u64 *)v_1170(D) + 88B]
+	.loc 1 47 1277 is_stmt 1 view .LVU3306
+.LVL590:
+.LBB1419:
+.LBI1419:
+	.loc 1 5 19 view .LVU3307
+.LBB1420:
+	.loc 1 5 46 view .LVU3308
+# blake2b-generic.c:5: static inline u64 ror64(unsigned l, u64 x) { return (x >> l) | (x << (64-l)); }
+	.loc 1 5 62 is_stmt 0 view .LVU3309
+	rolq	%r11	# _2082
+.LVL591:
+	.loc 1 5 62 view .LVU3310
+.LBE1420:
+.LBE1419:
+# blake2b-generic.c:47:     FULLROUND(9);
+	.loc 1 47 1285 view .LVU3311
+	movq	%r11, 56(%rax)	# _2082, MEM[(u64 *)v_1170(D) + 56B]
+	.loc 1 47 1003 is_stmt 1 view .LVU3312
+	.loc 1 47 1330 view .LVU3313
+	.loc 1 47 1335 view .LVU3314
+# blake2b-generic.c:47:     FULLROUND(9);
+	.loc 1 47 1343 is_stmt 0 view .LVU3315
+	addq	120(%r9), %r8	# MEM[(const u64 *)m_1171(D) + 120B], tmp2252
+	addq	%rbp, %r8	# _2058, _931
+# blake2b-generic.c:47:     FULLROUND(9);
+	.loc 1 47 1401 view .LVU3316
+	xorq	%r8, %r12	# _931, tmp2254
+# blake2b-generic.c:47:     FULLROUND(9);
+	.loc 1 47 1343 view .LVU3317
+	movq	%r8, (%rax)	# _931, *v_1170(D)
+	.loc 1 47 1391 is_stmt 1 view .LVU3318
+.LVL592:
+.LBB1421:
+.LBI1421:
+	.loc 1 5 19 view .LVU3319
+.LBB1422:
+	.loc 1 5 46 view .LVU3320
+# blake2b-generic.c:5: static inline u64 ror64(unsigned l, u64 x) { return (x >> l) | (x << (64-l)); }
+	.loc 1 5 62 is_stmt 0 view .LVU3321
+	rolq	$32, %r12	#, _2085
+.LVL593:
+	.loc 1 5 62 view .LVU3322
+.LBE1422:
+.LBE1421:
+# blake2b-generic.c:47:     FULLROUND(9);
+	.loc 1 47 1439 view .LVU3323
+	addq	%r12, %r14	# _2085, _933
+# blake2b-generic.c:47:     FULLROUND(9);
+	.loc 1 47 1399 view .LVU3324
+	movq	%r12, 120(%rax)	# _2085, MEM[(u64 *)v_1170(D) + 120B]
+	.loc 1 47 1431 is_stmt 1 view .LVU3325
+# blake2b-generic.c:47:     FULLROUND(9);
+	.loc 1 47 1461 is_stmt 0 view .LVU3326
+	xorq	%r14, %rbp	# _933, tmp2255
+# blake2b-generic.c:47:     FULLROUND(9);
+	.loc 1 47 1439 view .LVU3327
+	movq	%r14, 80(%rax)	# _933, MEM[(u64 *)v_1170(D) + 80B]
+	.loc 1 47 1451 is_stmt 1 view .LVU3328
+.LVL594:
+.LBB1423:
+.LBI1423:
+	.loc 1 5 19 view .LVU3329
+.LBB1424:
+	.loc 1 5 46 view .LVU3330
+# blake2b-generic.c:5: static inline u64 ror64(unsigned l, u64 x) { return (x >> l) | (x << (64-l)); }
+	.loc 1 5 62 is_stmt 0 view .LVU3331
+	rorq	$24, %rbp	#, _2088
+.LVL595:
+	.loc 1 5 62 view .LVU3332
+.LBE1424:
+.LBE1423:
+# blake2b-generic.c:47:     FULLROUND(9);
+	.loc 1 47 1459 view .LVU3333
+	movq	%rbp, 40(%rax)	# _2088, MEM[(u64 *)v_1170(D) + 40B]
+	.loc 1 47 1491 is_stmt 1 view .LVU3334
+# blake2b-generic.c:47:     FULLROUND(9);
+	.loc 1 47 1499 is_stmt 0 view .LVU3335
+	addq	88(%r9), %r8	# MEM[(const u64 *)m_1171(D) + 88B], tmp2256
+	addq	%rbp, %r8	# _2088, _937
+# blake2b-generic.c:47:     FULLROUND(9);
+	.loc 1 47 1557 view .LVU3336
+	xorq	%r8, %r12	# _937, tmp2258
+# blake2b-generic.c:47:     FULLROUND(9);
+	.loc 1 47 1499 view .LVU3337
+	movq	%r8, (%rax)	# _937, *v_1170(D)
+	.loc 1 47 1547 is_stmt 1 view .LVU3338
+.LVL596:
+.LBB1425:
+.LBI1425:
+	.loc 1 5 19 view .LVU3339
+.LBB1426:
+	.loc 1 5 46 view .LVU3340
+# blake2b-generic.c:5: static inline u64 ror64(unsigned l, u64 x) { return (x >> l) | (x << (64-l)); }
+	.loc 1 5 62 is_stmt 0 view .LVU3341
+	rorq	$16, %r12	#, tmp2258
+.LBE1426:
+.LBE1425:
+# blake2b-generic.c:47:     FULLROUND(9);
+	.loc 1 47 1595 view .LVU3342
+	addq	%r12, %r14	# _2091, _939
+# blake2b-generic.c:47:     FULLROUND(9);
+	.loc 1 47 1555 view .LVU3343
+	movq	%r12, 120(%rax)	# _2091, MEM[(u64 *)v_1170(D) + 120B]
+	.loc 1 47 1587 is_stmt 1 view .LVU3344
+# blake2b-generic.c:47:     FULLROUND(9);
+	.loc 1 47 1617 is_stmt 0 view .LVU3345
+	xorq	%r14, %rbp	# _939, tmp2259
+# blake2b-generic.c:47:     FULLROUND(9);
+	.loc 1 47 1595 view .LVU3346
+	movq	%r14, 80(%rax)	# _939, MEM[(u64 *)v_1170(D) + 80B]
+	.loc 1 47 1607 is_stmt 1 view .LVU3347
+.LVL597:
+.LBB1427:
+.LBI1427:
+	.loc 1 5 19 view .LVU3348
+.LBB1428:
+	.loc 1 5 46 view .LVU3349
+# blake2b-generic.c:5: static inline u64 ror64(unsigned l, u64 x) { return (x >> l) | (x << (64-l)); }
+	.loc 1 5 62 is_stmt 0 view .LVU3350
+	rolq	%rbp	# _2094
+.LVL598:
+	.loc 1 5 62 view .LVU3351
+.LBE1428:
+.LBE1427:
+# blake2b-generic.c:47:     FULLROUND(9);
+	.loc 1 47 1595 view .LVU3352
+	movq	%r12, -40(%rsp)	# _2091, %sfp
+# blake2b-generic.c:47:     FULLROUND(9);
+	.loc 1 47 1615 view .LVU3353
+	movq	%rbp, 40(%rax)	# _2094, MEM[(u64 *)v_1170(D) + 40B]
+	.loc 1 47 1333 is_stmt 1 view .LVU3354
+	.loc 1 47 1660 view .LVU3355
+	.loc 1 47 1665 view .LVU3356
+# blake2b-generic.c:47:     FULLROUND(9);
+	.loc 1 47 1673 is_stmt 0 view .LVU3357
+	addq	72(%r9), %rsi	# MEM[(const u64 *)m_1171(D) + 72B], tmp2260
+	addq	%rbx, %rsi	# _2070, _943
+# blake2b-generic.c:47:     FULLROUND(9);
+	.loc 1 47 1617 view .LVU3358
+	movq	%r14, -72(%rsp)	# _939, %sfp
+# blake2b-generic.c:47:     FULLROUND(9);
+	.loc 1 47 1732 view .LVU3359
+	xorq	%rsi, %rdi	# _943, tmp2262
+# blake2b-generic.c:47:     FULLROUND(9);
+	.loc 1 47 1673 view .LVU3360
+	movq	%rsi, 8(%rax)	# _943, MEM[(u64 *)v_1170(D) + 8B]
+	.loc 1 47 1722 is_stmt 1 view .LVU3361
+.LVL599:
+.LBB1429:
+.LBI1429:
+	.loc 1 5 19 view .LVU3362
+.LBB1430:
+	.loc 1 5 46 view .LVU3363
+# blake2b-generic.c:5: static inline u64 ror64(unsigned l, u64 x) { return (x >> l) | (x << (64-l)); }
+	.loc 1 5 62 is_stmt 0 view .LVU3364
+	rolq	$32, %rdi	#, _2097
+.LVL600:
+	.loc 1 5 62 view .LVU3365
+.LBE1430:
+.LBE1429:
+# blake2b-generic.c:47:     FULLROUND(9);
+	.loc 1 47 1770 view .LVU3366
+	addq	%rdi, %r15	# _2097, _945
+# blake2b-generic.c:47:     FULLROUND(9);
+	.loc 1 47 1730 view .LVU3367
+	movq	%rdi, 96(%rax)	# _2097, MEM[(u64 *)v_1170(D) + 96B]
+	.loc 1 47 1762 is_stmt 1 view .LVU3368
+# blake2b-generic.c:47:     FULLROUND(9);
+	.loc 1 47 1792 is_stmt 0 view .LVU3369
+	xorq	%r15, %rbx	# _945, tmp2263
+# blake2b-generic.c:47:     FULLROUND(9);
+	.loc 1 47 1770 view .LVU3370
+	movq	%r15, 88(%rax)	# _945, MEM[(u64 *)v_1170(D) + 88B]
+	.loc 1 47 1782 is_stmt 1 view .LVU3371
+.LVL601:
+.LBB1431:
+.LBI1431:
+	.loc 1 5 19 view .LVU3372
+.LBB1432:
+	.loc 1 5 46 view .LVU3373
+# blake2b-generic.c:5: static inline u64 ror64(unsigned l, u64 x) { return (x >> l) | (x << (64-l)); }
+	.loc 1 5 62 is_stmt 0 view .LVU3374
+	rorq	$24, %rbx	#, _2100
+.LVL602:
+	.loc 1 5 62 view .LVU3375
+.LBE1432:
+.LBE1431:
+# blake2b-generic.c:47:     FULLROUND(9);
+	.loc 1 47 1790 view .LVU3376
+	movq	%rbx, 48(%rax)	# _2100, MEM[(u64 *)v_1170(D) + 48B]
+	.loc 1 47 1822 is_stmt 1 view .LVU3377
+# blake2b-generic.c:47:     FULLROUND(9);
+	.loc 1 47 1830 is_stmt 0 view .LVU3378
+	addq	112(%r9), %rsi	# MEM[(const u64 *)m_1171(D) + 112B], tmp2264
+	addq	%rbx, %rsi	# _2100, _949
+# blake2b-generic.c:47:     FULLROUND(9);
+	.loc 1 47 1889 view .LVU3379
+	xorq	%rsi, %rdi	# _949, tmp2266
+# blake2b-generic.c:47:     FULLROUND(9);
+	.loc 1 47 1830 view .LVU3380
+	movq	%rsi, 8(%rax)	# _949, MEM[(u64 *)v_1170(D) + 8B]
+	.loc 1 47 1879 is_stmt 1 view .LVU3381
+.LVL603:
+.LBB1433:
+.LBI1433:
+	.loc 1 5 19 view .LVU3382
+.LBB1434:
+	.loc 1 5 46 view .LVU3383
+# blake2b-generic.c:5: static inline u64 ror64(unsigned l, u64 x) { return (x >> l) | (x << (64-l)); }
+	.loc 1 5 62 is_stmt 0 view .LVU3384
+	rorq	$16, %rdi	#, _2103
+.LVL604:
+	.loc 1 5 62 view .LVU3385
+.LBE1434:
+.LBE1433:
+# blake2b-generic.c:47:     FULLROUND(9);
+	.loc 1 47 1927 view .LVU3386
+	addq	%rdi, %r15	# _2103, _951
+# blake2b-generic.c:47:     FULLROUND(9);
+	.loc 1 47 1887 view .LVU3387
+	movq	%rdi, 96(%rax)	# _2103, MEM[(u64 *)v_1170(D) + 96B]
+	.loc 1 47 1919 is_stmt 1 view .LVU3388
+# blake2b-generic.c:47:     FULLROUND(9);
+	.loc 1 47 1949 is_stmt 0 view .LVU3389
+	xorq	%r15, %rbx	# _951, tmp2267
+# blake2b-generic.c:47:     FULLROUND(9);
+	.loc 1 47 1927 view .LVU3390
+	movq	%r15, 88(%rax)	# _951, MEM[(u64 *)v_1170(D) + 88B]
+	.loc 1 47 1939 is_stmt 1 view .LVU3391
+.LVL605:
+.LBB1435:
+.LBI1435:
+	.loc 1 5 19 view .LVU3392
+.LBB1436:
+	.loc 1 5 46 view .LVU3393
+# blake2b-generic.c:5: static inline u64 ror64(unsigned l, u64 x) { return (x >> l) | (x << (64-l)); }
+	.loc 1 5 62 is_stmt 0 view .LVU3394
+	rolq	%rbx	# _2106
+.LVL606:
+	.loc 1 5 62 view .LVU3395
+.LBE1436:
+.LBE1435:
+# blake2b-generic.c:47:     FULLROUND(9);
+	.loc 1 47 1949 view .LVU3396
+	movq	%r15, -64(%rsp)	# _951, %sfp
+# blake2b-generic.c:47:     FULLROUND(9);
+	.loc 1 47 1947 view .LVU3397
+	movq	%rbx, 48(%rax)	# _2106, MEM[(u64 *)v_1170(D) + 48B]
+	.loc 1 47 1663 is_stmt 1 view .LVU3398
+	.loc 1 47 1992 view .LVU3399
+	.loc 1 47 1997 view .LVU3400
+# blake2b-generic.c:47:     FULLROUND(9);
+	.loc 1 47 2005 is_stmt 0 view .LVU3401
+	addq	24(%r9), %rdx	# MEM[(const u64 *)m_1171(D) + 24B], tmp2268
+	addq	%r11, %rdx	# _2082, _955
+	movq	%rdx, 16(%rax)	# _955, MEM[(u64 *)v_1170(D) + 16B]
+	.loc 1 47 2054 is_stmt 1 view .LVU3402
+.LVL607:
+.LBB1437:
+.LBI1437:
+	.loc 1 5 19 view .LVU3403
+.LBB1438:
+	.loc 1 5 46 view .LVU3404
+.LBE1438:
+.LBE1437:
+# blake2b-generic.c:47:     FULLROUND(9);
+	.loc 1 47 2064 is_stmt 0 view .LVU3405
+	xorq	%rdx, %rcx	# _955, tmp2270
+.LVL608:
+# blake2b-generic.c:47:     FULLROUND(9);
+	.loc 1 47 2102 view .LVU3406
+	movq	-80(%rsp), %r15	# %sfp, _891
+.LBB1440:
+.LBB1439:
+# blake2b-generic.c:5: static inline u64 ror64(unsigned l, u64 x) { return (x >> l) | (x << (64-l)); }
+	.loc 1 5 62 view .LVU3407
+	rolq	$32, %rcx	#, _2109
+.LVL609:
+	.loc 1 5 62 view .LVU3408
+.LBE1439:
+.LBE1440:
+# blake2b-generic.c:47:     FULLROUND(9);
+	.loc 1 47 2337 view .LVU3409
+	movq	-48(%rsp), %r14	# %sfp, _2046
+# blake2b-generic.c:47:     FULLROUND(9);
+	.loc 1 47 2102 view .LVU3410
+	leaq	(%r15,%rcx), %r12	#, _957
+# blake2b-generic.c:47:     FULLROUND(9);
+	.loc 1 47 2062 view .LVU3411
+	movq	%rcx, 104(%rax)	# _2109, MEM[(u64 *)v_1170(D) + 104B]
+	.loc 1 47 2094 is_stmt 1 view .LVU3412
+# blake2b-generic.c:47:     FULLROUND(9);
+	.loc 1 47 2434 is_stmt 0 view .LVU3413
+	movq	-56(%rsp), %r15	# %sfp, _903
+# blake2b-generic.c:47:     FULLROUND(9);
+	.loc 1 47 2124 view .LVU3414
+	xorq	%r12, %r11	# _957, tmp2271
+# blake2b-generic.c:47:     FULLROUND(9);
+	.loc 1 47 2102 view .LVU3415
+	movq	%r12, 64(%rax)	# _957, MEM[(u64 *)v_1170(D) + 64B]
+	.loc 1 47 2114 is_stmt 1 view .LVU3416
+.LVL610:
+.LBB1441:
+.LBI1441:
+	.loc 1 5 19 view .LVU3417
+.LBB1442:
+	.loc 1 5 46 view .LVU3418
+# blake2b-generic.c:5: static inline u64 ror64(unsigned l, u64 x) { return (x >> l) | (x << (64-l)); }
+	.loc 1 5 62 is_stmt 0 view .LVU3419
+	rorq	$24, %r11	#, _2112
+.LVL611:
+	.loc 1 5 62 view .LVU3420
+.LBE1442:
+.LBE1441:
+# blake2b-generic.c:47:     FULLROUND(9);
+	.loc 1 47 2122 view .LVU3421
+	movq	%r11, 56(%rax)	# _2112, MEM[(u64 *)v_1170(D) + 56B]
+	.loc 1 47 2154 is_stmt 1 view .LVU3422
+# blake2b-generic.c:47:     FULLROUND(9);
+	.loc 1 47 2162 is_stmt 0 view .LVU3423
+	addq	96(%r9), %rdx	# MEM[(const u64 *)m_1171(D) + 96B], tmp2272
+	addq	%r11, %rdx	# _2112, _961
+# blake2b-generic.c:47:     FULLROUND(9);
+	.loc 1 47 2221 view .LVU3424
+	xorq	%rdx, %rcx	# _961, tmp2274
+# blake2b-generic.c:47:     FULLROUND(9);
+	.loc 1 47 2162 view .LVU3425
+	movq	%rdx, 16(%rax)	# _961, MEM[(u64 *)v_1170(D) + 16B]
+	.loc 1 47 2211 is_stmt 1 view .LVU3426
+.LVL612:
+.LBB1443:
+.LBI1443:
+	.loc 1 5 19 view .LVU3427
+.LBB1444:
+	.loc 1 5 46 view .LVU3428
+# blake2b-generic.c:5: static inline u64 ror64(unsigned l, u64 x) { return (x >> l) | (x << (64-l)); }
+	.loc 1 5 62 is_stmt 0 view .LVU3429
+	rorq	$16, %rcx	#, _2115
+.LVL613:
+	.loc 1 5 62 view .LVU3430
+.LBE1444:
+.LBE1443:
+# blake2b-generic.c:47:     FULLROUND(9);
+	.loc 1 47 2259 view .LVU3431
+	addq	%rcx, %r12	# _2115, _963
+# blake2b-generic.c:47:     FULLROUND(9);
+	.loc 1 47 2219 view .LVU3432
+	movq	%rcx, 104(%rax)	# _2115, MEM[(u64 *)v_1170(D) + 104B]
+	.loc 1 47 2251 is_stmt 1 view .LVU3433
+# blake2b-generic.c:47:     FULLROUND(9);
+	.loc 1 47 2281 is_stmt 0 view .LVU3434
+	xorq	%r12, %r11	# _963, tmp2275
+# blake2b-generic.c:47:     FULLROUND(9);
+	.loc 1 47 2259 view .LVU3435
+	movq	%r12, 64(%rax)	# _963, MEM[(u64 *)v_1170(D) + 64B]
+	.loc 1 47 2271 is_stmt 1 view .LVU3436
+.LVL614:
+.LBB1445:
+.LBI1445:
+	.loc 1 5 19 view .LVU3437
+.LBB1446:
+	.loc 1 5 46 view .LVU3438
+# blake2b-generic.c:5: static inline u64 ror64(unsigned l, u64 x) { return (x >> l) | (x << (64-l)); }
+	.loc 1 5 62 is_stmt 0 view .LVU3439
+	rolq	%r11	# _2118
+.LVL615:
+	.loc 1 5 62 view .LVU3440
+.LBE1446:
+.LBE1445:
+# blake2b-generic.c:47:     FULLROUND(9);
+	.loc 1 47 2279 view .LVU3441
+	movq	%r11, 56(%rax)	# _2118, MEM[(u64 *)v_1170(D) + 56B]
+	.loc 1 47 1995 is_stmt 1 view .LVU3442
+	.loc 1 47 2324 view .LVU3443
+	.loc 1 47 2329 view .LVU3444
+# blake2b-generic.c:47:     FULLROUND(9);
+	.loc 1 47 2337 is_stmt 0 view .LVU3445
+	addq	104(%r9), %r10	# MEM[(const u64 *)m_1171(D) + 104B], tmp2276
+	addq	%r14, %r10	# _2046, _967
+# blake2b-generic.c:47:     FULLROUND(9);
+	.loc 1 47 2396 view .LVU3446
+	xorq	%r10, %r13	# _967, tmp2278
+# blake2b-generic.c:47:     FULLROUND(9);
+	.loc 1 47 2337 view .LVU3447
+	movq	%r10, 24(%rax)	# _967, MEM[(u64 *)v_1170(D) + 24B]
+	.loc 1 47 2386 is_stmt 1 view .LVU3448
+.LVL616:
+.LBB1447:
+.LBI1447:
+	.loc 1 5 19 view .LVU3449
+.LBB1448:
+	.loc 1 5 46 view .LVU3450
+# blake2b-generic.c:5: static inline u64 ror64(unsigned l, u64 x) { return (x >> l) | (x << (64-l)); }
+	.loc 1 5 62 is_stmt 0 view .LVU3451
+	rolq	$32, %r13	#, _2121
+.LVL617:
+	.loc 1 5 62 view .LVU3452
+.LBE1448:
+.LBE1447:
+# blake2b-generic.c:47:     FULLROUND(9);
+	.loc 1 47 2434 view .LVU3453
+	addq	%r13, %r15	# _2121, _969
+# blake2b-generic.c:47:     FULLROUND(9);
+	.loc 1 47 2394 view .LVU3454
+	movq	%r13, 112(%rax)	# _2121, MEM[(u64 *)v_1170(D) + 112B]
+	.loc 1 47 2426 is_stmt 1 view .LVU3455
+# blake2b-generic.c:47:     FULLROUND(9);
+	.loc 1 47 2456 is_stmt 0 view .LVU3456
+	xorq	%r15, %r14	# _969, _2046
+# blake2b-generic.c:47:     FULLROUND(9);
+	.loc 1 47 2434 view .LVU3457
+	movq	%r15, 72(%rax)	# _969, MEM[(u64 *)v_1170(D) + 72B]
+	.loc 1 47 2446 is_stmt 1 view .LVU3458
+.LVL618:
+.LBB1449:
+.LBI1449:
+	.loc 1 5 19 view .LVU3459
+.LBB1450:
+	.loc 1 5 46 view .LVU3460
+# blake2b-generic.c:5: static inline u64 ror64(unsigned l, u64 x) { return (x >> l) | (x << (64-l)); }
+	.loc 1 5 62 is_stmt 0 view .LVU3461
+	rorq	$24, %r14	#, _2124
+.LVL619:
+	.loc 1 5 62 view .LVU3462
+.LBE1450:
+.LBE1449:
+# blake2b-generic.c:47:     FULLROUND(9);
+	.loc 1 47 2454 view .LVU3463
+	movq	%r14, 32(%rax)	# _2124, MEM[(u64 *)v_1170(D) + 32B]
+	.loc 1 47 2486 is_stmt 1 view .LVU3464
+# blake2b-generic.c:47:     FULLROUND(9);
+	.loc 1 47 2494 is_stmt 0 view .LVU3465
+	addq	(%r9), %r10	# *m_1171(D), tmp2280
+	addq	%r14, %r10	# _2124, _973
+# blake2b-generic.c:47:     FULLROUND(9);
+	.loc 1 47 2553 view .LVU3466
+	xorq	%r10, %r13	# _973, tmp2282
+# blake2b-generic.c:47:     FULLROUND(9);
+	.loc 1 47 2494 view .LVU3467
+	movq	%r10, 24(%rax)	# _973, MEM[(u64 *)v_1170(D) + 24B]
+	.loc 1 47 2543 is_stmt 1 view .LVU3468
+.LVL620:
+.LBB1451:
+.LBI1451:
+	.loc 1 5 19 view .LVU3469
+.LBB1452:
+	.loc 1 5 46 view .LVU3470
+# blake2b-generic.c:5: static inline u64 ror64(unsigned l, u64 x) { return (x >> l) | (x << (64-l)); }
+	.loc 1 5 62 is_stmt 0 view .LVU3471
+	rorq	$16, %r13	#, _2127
+.LVL621:
+	.loc 1 5 62 view .LVU3472
+.LBE1452:
+.LBE1451:
+# blake2b-generic.c:47:     FULLROUND(9);
+	.loc 1 47 2591 view .LVU3473
+	addq	%r13, %r15	# _2127, _975
+# blake2b-generic.c:47:     FULLROUND(9);
+	.loc 1 47 2551 view .LVU3474
+	movq	%r13, 112(%rax)	# _2127, MEM[(u64 *)v_1170(D) + 112B]
+	.loc 1 47 2583 is_stmt 1 view .LVU3475
+# blake2b-generic.c:47:     FULLROUND(9);
+	.loc 1 47 2613 is_stmt 0 view .LVU3476
+	xorq	%r15, %r14	# _975, tmp2283
+# blake2b-generic.c:47:     FULLROUND(9);
+	.loc 1 47 2591 view .LVU3477
+	movq	%r15, 72(%rax)	# _975, MEM[(u64 *)v_1170(D) + 72B]
+	.loc 1 47 2603 is_stmt 1 view .LVU3478
+.LVL622:
+.LBB1453:
+.LBI1453:
+	.loc 1 5 19 view .LVU3479
+.LBB1454:
+	.loc 1 5 46 view .LVU3480
+# blake2b-generic.c:5: static inline u64 ror64(unsigned l, u64 x) { return (x >> l) | (x << (64-l)); }
+	.loc 1 5 62 is_stmt 0 view .LVU3481
+	rolq	%r14	# _2130
+.LVL623:
+	.loc 1 5 62 view .LVU3482
+.LBE1454:
+.LBE1453:
+# blake2b-generic.c:47:     FULLROUND(9);
+	.loc 1 47 2611 view .LVU3483
+	movq	%r14, 32(%rax)	# _2130, MEM[(u64 *)v_1170(D) + 32B]
+	.loc 1 47 2327 is_stmt 1 view .LVU3484
+	.loc 1 47 8 view .LVU3485
+	.loc 1 48 5 view .LVU3486
+	.loc 1 48 10 view .LVU3487
+	.loc 1 48 15 view .LVU3488
+# blake2b-generic.c:48:     FULLROUND(10);
+	.loc 1 48 23 is_stmt 0 view .LVU3489
+	addq	(%r9), %r8	# *m_1171(D), tmp2284
+	addq	%r14, %r8	# _2130, _979
+# blake2b-generic.c:48:     FULLROUND(10);
+	.loc 1 48 82 view .LVU3490
+	xorq	%r8, %rdi	# _979, tmp2286
+# blake2b-generic.c:48:     FULLROUND(10);
+	.loc 1 48 23 view .LVU3491
+	movq	%r8, (%rax)	# _979, *v_1170(D)
+	.loc 1 48 72 is_stmt 1 view .LVU3492
+.LVL624:
+.LBB1455:
+.LBI1455:
+	.loc 1 5 19 view .LVU3493
+.LBB1456:
+	.loc 1 5 46 view .LVU3494
+# blake2b-generic.c:5: static inline u64 ror64(unsigned l, u64 x) { return (x >> l) | (x << (64-l)); }
+	.loc 1 5 62 is_stmt 0 view .LVU3495
+	rolq	$32, %rdi	#, _2133
+.LVL625:
+	.loc 1 5 62 view .LVU3496
+.LBE1456:
+.LBE1455:
+# blake2b-generic.c:48:     FULLROUND(10);
+	.loc 1 48 120 view .LVU3497
+	addq	%rdi, %r12	# _2133, _981
+# blake2b-generic.c:48:     FULLROUND(10);
+	.loc 1 48 80 view .LVU3498
+	movq	%rdi, 96(%rax)	# _2133, MEM[(u64 *)v_1170(D) + 96B]
+	.loc 1 48 112 is_stmt 1 view .LVU3499
+# blake2b-generic.c:48:     FULLROUND(10);
+	.loc 1 48 142 is_stmt 0 view .LVU3500
+	xorq	%r12, %r14	# _981, tmp2287
+# blake2b-generic.c:48:     FULLROUND(10);
+	.loc 1 48 120 view .LVU3501
+	movq	%r12, 64(%rax)	# _981, MEM[(u64 *)v_1170(D) + 64B]
+	.loc 1 48 132 is_stmt 1 view .LVU3502
+.LVL626:
+.LBB1457:
+.LBI1457:
+	.loc 1 5 19 view .LVU3503
+.LBB1458:
+	.loc 1 5 46 view .LVU3504
+# blake2b-generic.c:5: static inline u64 ror64(unsigned l, u64 x) { return (x >> l) | (x << (64-l)); }
+	.loc 1 5 62 is_stmt 0 view .LVU3505
+	rorq	$24, %r14	#, _2136
+.LVL627:
+	.loc 1 5 62 view .LVU3506
+.LBE1458:
+.LBE1457:
+# blake2b-generic.c:48:     FULLROUND(10);
+	.loc 1 48 140 view .LVU3507
+	movq	%r14, 32(%rax)	# _2136, MEM[(u64 *)v_1170(D) + 32B]
+	.loc 1 48 172 is_stmt 1 view .LVU3508
+# blake2b-generic.c:48:     FULLROUND(10);
+	.loc 1 48 180 is_stmt 0 view .LVU3509
+	addq	8(%r9), %r8	# MEM[(const u64 *)m_1171(D) + 8B], tmp2288
+	addq	%r14, %r8	# _2136, _985
+# blake2b-generic.c:48:     FULLROUND(10);
+	.loc 1 48 239 view .LVU3510
+	xorq	%r8, %rdi	# _985, tmp2290
+# blake2b-generic.c:48:     FULLROUND(10);
+	.loc 1 48 180 view .LVU3511
+	movq	%r8, (%rax)	# _985, *v_1170(D)
+	.loc 1 48 229 is_stmt 1 view .LVU3512
+.LVL628:
+.LBB1459:
+.LBI1459:
+	.loc 1 5 19 view .LVU3513
+.LBB1460:
+	.loc 1 5 46 view .LVU3514
+# blake2b-generic.c:5: static inline u64 ror64(unsigned l, u64 x) { return (x >> l) | (x << (64-l)); }
+	.loc 1 5 62 is_stmt 0 view .LVU3515
+	rorq	$16, %rdi	#, _2139
+.LVL629:
+	.loc 1 5 62 view .LVU3516
+.LBE1460:
+.LBE1459:
+# blake2b-generic.c:48:     FULLROUND(10);
+	.loc 1 48 277 view .LVU3517
+	addq	%rdi, %r12	# _2139, _987
+# blake2b-generic.c:48:     FULLROUND(10);
+	.loc 1 48 237 view .LVU3518
+	movq	%rdi, 96(%rax)	# _2139, MEM[(u64 *)v_1170(D) + 96B]
+	.loc 1 48 269 is_stmt 1 view .LVU3519
+# blake2b-generic.c:48:     FULLROUND(10);
+	.loc 1 48 299 is_stmt 0 view .LVU3520
+	xorq	%r12, %r14	# _987, tmp2291
+	movq	%r12, -80(%rsp)	# _987, %sfp
+.LBB1461:
+.LBB1462:
+# blake2b-generic.c:5: static inline u64 ror64(unsigned l, u64 x) { return (x >> l) | (x << (64-l)); }
+	.loc 1 5 62 view .LVU3521
+	rolq	%r14	# tmp2291
+.LBE1462:
+.LBE1461:
+# blake2b-generic.c:48:     FULLROUND(10);
+	.loc 1 48 277 view .LVU3522
+	movq	%r12, 64(%rax)	# _987, MEM[(u64 *)v_1170(D) + 64B]
+	.loc 1 48 289 is_stmt 1 view .LVU3523
+.LVL630:
+.LBB1464:
+.LBI1461:
+	.loc 1 5 19 view .LVU3524
+.LBB1463:
+	.loc 1 5 46 view .LVU3525
+	.loc 1 5 46 is_stmt 0 view .LVU3526
+.LBE1463:
+.LBE1464:
+# blake2b-generic.c:48:     FULLROUND(10);
+	.loc 1 48 297 view .LVU3527
+	movq	%r14, -48(%rsp)	# _2142, %sfp
+	movq	%r14, 32(%rax)	# _2142, MEM[(u64 *)v_1170(D) + 32B]
+	.loc 1 48 13 is_stmt 1 view .LVU3528
+	.loc 1 48 342 view .LVU3529
+	.loc 1 48 347 view .LVU3530
+# blake2b-generic.c:48:     FULLROUND(10);
+	.loc 1 48 355 is_stmt 0 view .LVU3531
+	addq	16(%r9), %rsi	# MEM[(const u64 *)m_1171(D) + 16B], tmp2292
+	addq	%rbp, %rsi	# _2094, _991
+# blake2b-generic.c:48:     FULLROUND(10);
+	.loc 1 48 414 view .LVU3532
+	xorq	%rsi, %rcx	# _991, tmp2294
+# blake2b-generic.c:48:     FULLROUND(10);
+	.loc 1 48 355 view .LVU3533
+	movq	%rsi, 8(%rax)	# _991, MEM[(u64 *)v_1170(D) + 8B]
+	.loc 1 48 404 is_stmt 1 view .LVU3534
+.LVL631:
+.LBB1465:
+.LBI1465:
+	.loc 1 5 19 view .LVU3535
+.LBB1466:
+	.loc 1 5 46 view .LVU3536
+# blake2b-generic.c:5: static inline u64 ror64(unsigned l, u64 x) { return (x >> l) | (x << (64-l)); }
+	.loc 1 5 62 is_stmt 0 view .LVU3537
+	rolq	$32, %rcx	#, _2145
+.LVL632:
+	.loc 1 5 62 view .LVU3538
+.LBE1466:
+.LBE1465:
+# blake2b-generic.c:48:     FULLROUND(10);
+	.loc 1 48 452 view .LVU3539
+	addq	%rcx, %r15	# _2145, _993
+# blake2b-generic.c:48:     FULLROUND(10);
+	.loc 1 48 412 view .LVU3540
+	movq	%rcx, 104(%rax)	# _2145, MEM[(u64 *)v_1170(D) + 104B]
+	.loc 1 48 444 is_stmt 1 view .LVU3541
+# blake2b-generic.c:48:     FULLROUND(10);
+	.loc 1 48 474 is_stmt 0 view .LVU3542
+	xorq	%r15, %rbp	# _993, tmp2295
+# blake2b-generic.c:48:     FULLROUND(10);
+	.loc 1 48 452 view .LVU3543
+	movq	%r15, 72(%rax)	# _993, MEM[(u64 *)v_1170(D) + 72B]
+	.loc 1 48 464 is_stmt 1 view .LVU3544
+.LVL633:
+.LBB1467:
+.LBI1467:
+	.loc 1 5 19 view .LVU3545
+.LBB1468:
+	.loc 1 5 46 view .LVU3546
+# blake2b-generic.c:5: static inline u64 ror64(unsigned l, u64 x) { return (x >> l) | (x << (64-l)); }
+	.loc 1 5 62 is_stmt 0 view .LVU3547
+	rorq	$24, %rbp	#, _2148
+.LVL634:
+	.loc 1 5 62 view .LVU3548
+.LBE1468:
+.LBE1467:
+# blake2b-generic.c:48:     FULLROUND(10);
+	.loc 1 48 472 view .LVU3549
+	movq	%rbp, 40(%rax)	# _2148, MEM[(u64 *)v_1170(D) + 40B]
+	.loc 1 48 504 is_stmt 1 view .LVU3550
+# blake2b-generic.c:48:     FULLROUND(10);
+	.loc 1 48 512 is_stmt 0 view .LVU3551
+	addq	24(%r9), %rsi	# MEM[(const u64 *)m_1171(D) + 24B], tmp2296
+	addq	%rbp, %rsi	# _2148, _997
+# blake2b-generic.c:48:     FULLROUND(10);
+	.loc 1 48 571 view .LVU3552
+	xorq	%rsi, %rcx	# _997, tmp2298
+# blake2b-generic.c:48:     FULLROUND(10);
+	.loc 1 48 512 view .LVU3553
+	movq	%rsi, 8(%rax)	# _997, MEM[(u64 *)v_1170(D) + 8B]
+	.loc 1 48 561 is_stmt 1 view .LVU3554
+.LVL635:
+.LBB1469:
+.LBI1469:
+	.loc 1 5 19 view .LVU3555
+.LBB1470:
+	.loc 1 5 46 view .LVU3556
+# blake2b-generic.c:5: static inline u64 ror64(unsigned l, u64 x) { return (x >> l) | (x << (64-l)); }
+	.loc 1 5 62 is_stmt 0 view .LVU3557
+	rorq	$16, %rcx	#, _2151
+.LVL636:
+	.loc 1 5 62 view .LVU3558
+.LBE1470:
+.LBE1469:
+# blake2b-generic.c:48:     FULLROUND(10);
+	.loc 1 48 609 view .LVU3559
+	addq	%rcx, %r15	# _2151, _999
+# blake2b-generic.c:48:     FULLROUND(10);
+	.loc 1 48 569 view .LVU3560
+	movq	%rcx, 104(%rax)	# _2151, MEM[(u64 *)v_1170(D) + 104B]
+	.loc 1 48 601 is_stmt 1 view .LVU3561
+# blake2b-generic.c:48:     FULLROUND(10);
+	.loc 1 48 631 is_stmt 0 view .LVU3562
+	xorq	%r15, %rbp	# _999, tmp2299
+# blake2b-generic.c:48:     FULLROUND(10);
+	.loc 1 48 609 view .LVU3563
+	movq	%r15, 72(%rax)	# _999, MEM[(u64 *)v_1170(D) + 72B]
+	.loc 1 48 621 is_stmt 1 view .LVU3564
+.LVL637:
+.LBB1471:
+.LBI1471:
+	.loc 1 5 19 view .LVU3565
+.LBB1472:
+	.loc 1 5 46 view .LVU3566
+# blake2b-generic.c:5: static inline u64 ror64(unsigned l, u64 x) { return (x >> l) | (x << (64-l)); }
+	.loc 1 5 62 is_stmt 0 view .LVU3567
+	rolq	%rbp	# _2154
+.LVL638:
+	.loc 1 5 62 view .LVU3568
+.LBE1472:
+.LBE1471:
+# blake2b-generic.c:48:     FULLROUND(10);
+	.loc 1 48 631 view .LVU3569
+	movq	%r15, -56(%rsp)	# _999, %sfp
+# blake2b-generic.c:48:     FULLROUND(10);
+	.loc 1 48 1116 view .LVU3570
+	movq	-64(%rsp), %r15	# %sfp, _951
+# blake2b-generic.c:48:     FULLROUND(10);
+	.loc 1 48 629 view .LVU3571
+	movq	%rbp, 40(%rax)	# _2154, MEM[(u64 *)v_1170(D) + 40B]
+	.loc 1 48 345 is_stmt 1 view .LVU3572
+	.loc 1 48 674 view .LVU3573
+	.loc 1 48 679 view .LVU3574
+# blake2b-generic.c:48:     FULLROUND(10);
+	.loc 1 48 687 is_stmt 0 view .LVU3575
+	addq	32(%r9), %rdx	# MEM[(const u64 *)m_1171(D) + 32B], tmp2300
+	leaq	(%rdx,%rbx), %r14	#, _1003
+# blake2b-generic.c:48:     FULLROUND(10);
+	.loc 1 48 784 view .LVU3576
+	movq	-72(%rsp), %rdx	# %sfp, _939
+# blake2b-generic.c:48:     FULLROUND(10);
+	.loc 1 48 746 view .LVU3577
+	xorq	%r14, %r13	# _1003, tmp2302
+# blake2b-generic.c:48:     FULLROUND(10);
+	.loc 1 48 687 view .LVU3578
+	movq	%r14, 16(%rax)	# _1003, MEM[(u64 *)v_1170(D) + 16B]
+	.loc 1 48 736 is_stmt 1 view .LVU3579
+.LVL639:
+.LBB1473:
+.LBI1473:
+	.loc 1 5 19 view .LVU3580
+.LBB1474:
+	.loc 1 5 46 view .LVU3581
+# blake2b-generic.c:5: static inline u64 ror64(unsigned l, u64 x) { return (x >> l) | (x << (64-l)); }
+	.loc 1 5 62 is_stmt 0 view .LVU3582
+	rolq	$32, %r13	#, _2157
+.LVL640:
+	.loc 1 5 62 view .LVU3583
+.LBE1474:
+.LBE1473:
+# blake2b-generic.c:48:     FULLROUND(10);
+	.loc 1 48 784 view .LVU3584
+	leaq	(%rdx,%r13), %r12	#, _1005
+# blake2b-generic.c:48:     FULLROUND(10);
+	.loc 1 48 744 view .LVU3585
+	movq	%r13, 112(%rax)	# _2157, MEM[(u64 *)v_1170(D) + 112B]
+	.loc 1 48 776 is_stmt 1 view .LVU3586
+# blake2b-generic.c:48:     FULLROUND(10);
+	.loc 1 48 806 is_stmt 0 view .LVU3587
+	xorq	%r12, %rbx	# _1005, tmp2303
+# blake2b-generic.c:48:     FULLROUND(10);
+	.loc 1 48 784 view .LVU3588
+	movq	%r12, 80(%rax)	# _1005, MEM[(u64 *)v_1170(D) + 80B]
+	.loc 1 48 796 is_stmt 1 view .LVU3589
+.LVL641:
+.LBB1475:
+.LBI1475:
+	.loc 1 5 19 view .LVU3590
+.LBB1476:
+	.loc 1 5 46 view .LVU3591
+# blake2b-generic.c:5: static inline u64 ror64(unsigned l, u64 x) { return (x >> l) | (x << (64-l)); }
+	.loc 1 5 62 is_stmt 0 view .LVU3592
+	rorq	$24, %rbx	#, _2160
+.LVL642:
+	.loc 1 5 62 view .LVU3593
+.LBE1476:
+.LBE1475:
+# blake2b-generic.c:48:     FULLROUND(10);
+	.loc 1 48 804 view .LVU3594
+	movq	%rbx, 48(%rax)	# _2160, MEM[(u64 *)v_1170(D) + 48B]
+	.loc 1 48 836 is_stmt 1 view .LVU3595
+# blake2b-generic.c:48:     FULLROUND(10);
+	.loc 1 48 844 is_stmt 0 view .LVU3596
+	addq	40(%r9), %r14	# MEM[(const u64 *)m_1171(D) + 40B], tmp2304
+	addq	%rbx, %r14	# _2160, _1009
+# blake2b-generic.c:48:     FULLROUND(10);
+	.loc 1 48 903 view .LVU3597
+	xorq	%r14, %r13	# _1009, tmp2306
+# blake2b-generic.c:48:     FULLROUND(10);
+	.loc 1 48 844 view .LVU3598
+	movq	%r14, 16(%rax)	# _1009, MEM[(u64 *)v_1170(D) + 16B]
+	.loc 1 48 893 is_stmt 1 view .LVU3599
+.LVL643:
+.LBB1477:
+.LBI1477:
+	.loc 1 5 19 view .LVU3600
+.LBB1478:
+	.loc 1 5 46 view .LVU3601
+# blake2b-generic.c:5: static inline u64 ror64(unsigned l, u64 x) { return (x >> l) | (x << (64-l)); }
+	.loc 1 5 62 is_stmt 0 view .LVU3602
+	rorq	$16, %r13	#, tmp2306
+.LBE1478:
+.LBE1477:
+# blake2b-generic.c:48:     FULLROUND(10);
+	.loc 1 48 901 view .LVU3603
+	movq	%r13, 112(%rax)	# _2163, MEM[(u64 *)v_1170(D) + 112B]
+	.loc 1 48 933 is_stmt 1 view .LVU3604
+# blake2b-generic.c:48:     FULLROUND(10);
+	.loc 1 48 941 is_stmt 0 view .LVU3605
+	movq	%r13, -32(%rsp)	# _2163, %sfp
+	addq	%r12, %r13	# _1005, _1011
+# blake2b-generic.c:48:     FULLROUND(10);
+	.loc 1 48 963 view .LVU3606
+	xorq	%r13, %rbx	# _1011, tmp2307
+# blake2b-generic.c:48:     FULLROUND(10);
+	.loc 1 48 941 view .LVU3607
+	movq	%r13, 80(%rax)	# _1011, MEM[(u64 *)v_1170(D) + 80B]
+	.loc 1 48 953 is_stmt 1 view .LVU3608
+.LVL644:
+.LBB1479:
+.LBI1479:
+	.loc 1 5 19 view .LVU3609
+.LBB1480:
+	.loc 1 5 46 view .LVU3610
+# blake2b-generic.c:5: static inline u64 ror64(unsigned l, u64 x) { return (x >> l) | (x << (64-l)); }
+	.loc 1 5 62 is_stmt 0 view .LVU3611
+	rolq	%rbx	# _2166
+.LVL645:
+	.loc 1 5 62 view .LVU3612
+.LBE1480:
+.LBE1479:
+# blake2b-generic.c:48:     FULLROUND(10);
+	.loc 1 48 961 view .LVU3613
+	movq	%rbx, 48(%rax)	# _2166, MEM[(u64 *)v_1170(D) + 48B]
+	.loc 1 48 677 is_stmt 1 view .LVU3614
+	.loc 1 48 1006 view .LVU3615
+	.loc 1 48 1011 view .LVU3616
+# blake2b-generic.c:48:     FULLROUND(10);
+	.loc 1 48 1019 is_stmt 0 view .LVU3617
+	addq	48(%r9), %r10	# MEM[(const u64 *)m_1171(D) + 48B], tmp2308
+	leaq	(%r10,%r11), %rdx	#, _1015
+# blake2b-generic.c:48:     FULLROUND(10);
+	.loc 1 48 1078 view .LVU3618
+	movq	-40(%rsp), %r10	# %sfp, _2091
+# blake2b-generic.c:48:     FULLROUND(10);
+	.loc 1 48 1019 view .LVU3619
+	movq	%rdx, 24(%rax)	# _1015, MEM[(u64 *)v_1170(D) + 24B]
+	.loc 1 48 1068 is_stmt 1 view .LVU3620
+.LVL646:
+.LBB1481:
+.LBI1481:
+	.loc 1 5 19 view .LVU3621
+.LBB1482:
+	.loc 1 5 46 view .LVU3622
+.LBE1482:
+.LBE1481:
+# blake2b-generic.c:48:     FULLROUND(10);
+	.loc 1 48 1078 is_stmt 0 view .LVU3623
+	xorq	%rdx, %r10	# _1015, _2091
+.LVL647:
+.LBB1484:
+.LBB1483:
+# blake2b-generic.c:5: static inline u64 ror64(unsigned l, u64 x) { return (x >> l) | (x << (64-l)); }
+	.loc 1 5 62 view .LVU3624
+	rolq	$32, %r10	#, _2169
+.LVL648:
+	.loc 1 5 62 view .LVU3625
+.LBE1483:
+.LBE1484:
+# blake2b-generic.c:48:     FULLROUND(10);
+	.loc 1 48 1116 view .LVU3626
+	addq	%r10, %r15	# _2169, _1017
+# blake2b-generic.c:48:     FULLROUND(10);
+	.loc 1 48 1076 view .LVU3627
+	movq	%r10, 120(%rax)	# _2169, MEM[(u64 *)v_1170(D) + 120B]
+	.loc 1 48 1108 is_stmt 1 view .LVU3628
+# blake2b-generic.c:48:     FULLROUND(10);
+	.loc 1 48 1138 is_stmt 0 view .LVU3629
+	xorq	%r15, %r11	# _1017, tmp2311
+# blake2b-generic.c:48:     FULLROUND(10);
+	.loc 1 48 1116 view .LVU3630
+	movq	%r15, 88(%rax)	# _1017, MEM[(u64 *)v_1170(D) + 88B]
+	.loc 1 48 1128 is_stmt 1 view .LVU3631
+.LVL649:
+.LBB1485:
+.LBI1485:
+	.loc 1 5 19 view .LVU3632
+.LBB1486:
+	.loc 1 5 46 view .LVU3633
+# blake2b-generic.c:5: static inline u64 ror64(unsigned l, u64 x) { return (x >> l) | (x << (64-l)); }
+	.loc 1 5 62 is_stmt 0 view .LVU3634
+	rorq	$24, %r11	#, _2172
+.LVL650:
+	.loc 1 5 62 view .LVU3635
+.LBE1486:
+.LBE1485:
+# blake2b-generic.c:48:     FULLROUND(10);
+	.loc 1 48 1136 view .LVU3636
+	movq	%r11, 56(%rax)	# _2172, MEM[(u64 *)v_1170(D) + 56B]
+	.loc 1 48 1168 is_stmt 1 view .LVU3637
+# blake2b-generic.c:48:     FULLROUND(10);
+	.loc 1 48 1176 is_stmt 0 view .LVU3638
+	addq	56(%r9), %rdx	# MEM[(const u64 *)m_1171(D) + 56B], tmp2312
+	addq	%r11, %rdx	# _2172, _1021
+# blake2b-generic.c:48:     FULLROUND(10);
+	.loc 1 48 1235 view .LVU3639
+	xorq	%rdx, %r10	# _1021, tmp2314
+# blake2b-generic.c:48:     FULLROUND(10);
+	.loc 1 48 1176 view .LVU3640
+	movq	%rdx, 24(%rax)	# _1021, MEM[(u64 *)v_1170(D) + 24B]
+	.loc 1 48 1225 is_stmt 1 view .LVU3641
+.LVL651:
+.LBB1487:
+.LBI1487:
+	.loc 1 5 19 view .LVU3642
+.LBB1488:
+	.loc 1 5 46 view .LVU3643
+# blake2b-generic.c:5: static inline u64 ror64(unsigned l, u64 x) { return (x >> l) | (x << (64-l)); }
+	.loc 1 5 62 is_stmt 0 view .LVU3644
+	rorq	$16, %r10	#, _2175
+.LVL652:
+	.loc 1 5 62 view .LVU3645
+.LBE1488:
+.LBE1487:
+# blake2b-generic.c:48:     FULLROUND(10);
+	.loc 1 48 1273 view .LVU3646
+	addq	%r10, %r15	# _2175, _1023
+# blake2b-generic.c:48:     FULLROUND(10);
+	.loc 1 48 1233 view .LVU3647
+	movq	%r10, 120(%rax)	# _2175, MEM[(u64 *)v_1170(D) + 120B]
+	.loc 1 48 1265 is_stmt 1 view .LVU3648
+# blake2b-generic.c:48:     FULLROUND(10);
+	.loc 1 48 1295 is_stmt 0 view .LVU3649
+	xorq	%r15, %r11	# _1023, tmp2315
+# blake2b-generic.c:48:     FULLROUND(10);
+	.loc 1 48 1273 view .LVU3650
+	movq	%r15, 88(%rax)	# _1023, MEM[(u64 *)v_1170(D) + 88B]
+	.loc 1 48 1285 is_stmt 1 view .LVU3651
+.LVL653:
+.LBB1489:
+.LBI1489:
+	.loc 1 5 19 view .LVU3652
+.LBB1490:
+	.loc 1 5 46 view .LVU3653
+# blake2b-generic.c:5: static inline u64 ror64(unsigned l, u64 x) { return (x >> l) | (x << (64-l)); }
+	.loc 1 5 62 is_stmt 0 view .LVU3654
+	rolq	%r11	# _2178
+.LVL654:
+	.loc 1 5 62 view .LVU3655
+.LBE1490:
+.LBE1489:
+# blake2b-generic.c:48:     FULLROUND(10);
+	.loc 1 48 1293 view .LVU3656
+	movq	%r11, 56(%rax)	# _2178, MEM[(u64 *)v_1170(D) + 56B]
+	.loc 1 48 1009 is_stmt 1 view .LVU3657
+	.loc 1 48 1338 view .LVU3658
+	.loc 1 48 1343 view .LVU3659
+# blake2b-generic.c:48:     FULLROUND(10);
+	.loc 1 48 1351 is_stmt 0 view .LVU3660
+	addq	64(%r9), %r8	# MEM[(const u64 *)m_1171(D) + 64B], tmp2316
+	leaq	(%r8,%rbp), %r12	#, _1027
+# blake2b-generic.c:48:     FULLROUND(10);
+	.loc 1 48 1410 view .LVU3661
+	xorq	%r12, %r10	# _1027, tmp2318
+# blake2b-generic.c:48:     FULLROUND(10);
+	.loc 1 48 1351 view .LVU3662
+	movq	%r12, (%rax)	# _1027, *v_1170(D)
+	.loc 1 48 1400 is_stmt 1 view .LVU3663
+.LVL655:
+.LBB1491:
+.LBI1491:
+	.loc 1 5 19 view .LVU3664
+.LBB1492:
+	.loc 1 5 46 view .LVU3665
+# blake2b-generic.c:5: static inline u64 ror64(unsigned l, u64 x) { return (x >> l) | (x << (64-l)); }
+	.loc 1 5 62 is_stmt 0 view .LVU3666
+	rolq	$32, %r10	#, _2181
+.LVL656:
+	.loc 1 5 62 view .LVU3667
+.LBE1492:
+.LBE1491:
+# blake2b-generic.c:48:     FULLROUND(10);
+	.loc 1 48 1448 view .LVU3668
+	addq	%r10, %r13	# _2181, _1029
+# blake2b-generic.c:48:     FULLROUND(10);
+	.loc 1 48 1408 view .LVU3669
+	movq	%r10, 120(%rax)	# _2181, MEM[(u64 *)v_1170(D) + 120B]
+	.loc 1 48 1440 is_stmt 1 view .LVU3670
+# blake2b-generic.c:48:     FULLROUND(10);
+	.loc 1 48 1470 is_stmt 0 view .LVU3671
+	xorq	%r13, %rbp	# _1029, tmp2319
+# blake2b-generic.c:48:     FULLROUND(10);
+	.loc 1 48 1448 view .LVU3672
+	movq	%r13, 80(%rax)	# _1029, MEM[(u64 *)v_1170(D) + 80B]
+	.loc 1 48 1460 is_stmt 1 view .LVU3673
+.LVL657:
+.LBB1493:
+.LBI1493:
+	.loc 1 5 19 view .LVU3674
+.LBB1494:
+	.loc 1 5 46 view .LVU3675
+# blake2b-generic.c:5: static inline u64 ror64(unsigned l, u64 x) { return (x >> l) | (x << (64-l)); }
+	.loc 1 5 62 is_stmt 0 view .LVU3676
+	rorq	$24, %rbp	#, _2184
+.LVL658:
+	.loc 1 5 62 view .LVU3677
+.LBE1494:
+.LBE1493:
+# blake2b-generic.c:48:     FULLROUND(10);
+	.loc 1 48 1468 view .LVU3678
+	movq	%rbp, 40(%rax)	# _2184, MEM[(u64 *)v_1170(D) + 40B]
+	.loc 1 48 1500 is_stmt 1 view .LVU3679
+# blake2b-generic.c:48:     FULLROUND(10);
+	.loc 1 48 1508 is_stmt 0 view .LVU3680
+	addq	72(%r9), %r12	# MEM[(const u64 *)m_1171(D) + 72B], tmp2320
+	addq	%rbp, %r12	# _2184, _1033
+# blake2b-generic.c:48:     FULLROUND(10);
+	.loc 1 48 1567 view .LVU3681
+	xorq	%r12, %r10	# _1033, tmp2322
+# blake2b-generic.c:48:     FULLROUND(10);
+	.loc 1 48 1508 view .LVU3682
+	movq	%r12, (%rax)	# _1033, *v_1170(D)
+	.loc 1 48 1557 is_stmt 1 view .LVU3683
+.LVL659:
+.LBB1495:
+.LBI1495:
+	.loc 1 5 19 view .LVU3684
+.LBB1496:
+	.loc 1 5 46 view .LVU3685
+# blake2b-generic.c:5: static inline u64 ror64(unsigned l, u64 x) { return (x >> l) | (x << (64-l)); }
+	.loc 1 5 62 is_stmt 0 view .LVU3686
+	movq	%r10, %r8	# tmp2322, tmp2322
+	rorq	$16, %r8	#, tmp2322
+.LBE1496:
+.LBE1495:
+# blake2b-generic.c:48:     FULLROUND(10);
+	.loc 1 48 1605 view .LVU3687
+	leaq	0(%r13,%r8), %r10	#, _1035
+# blake2b-generic.c:48:     FULLROUND(10);
+	.loc 1 48 1565 view .LVU3688
+	movq	%r8, 120(%rax)	# _2187, MEM[(u64 *)v_1170(D) + 120B]
+	.loc 1 48 1597 is_stmt 1 view .LVU3689
+# blake2b-generic.c:48:     FULLROUND(10);
+	.loc 1 48 1627 is_stmt 0 view .LVU3690
+	xorq	%r10, %rbp	# _1035, tmp2323
+# blake2b-generic.c:48:     FULLROUND(10);
+	.loc 1 48 1605 view .LVU3691
+	movq	%r10, 80(%rax)	# _1035, MEM[(u64 *)v_1170(D) + 80B]
+	.loc 1 48 1617 is_stmt 1 view .LVU3692
+.LVL660:
+.LBB1497:
+.LBI1497:
+	.loc 1 5 19 view .LVU3693
+.LBB1498:
+	.loc 1 5 46 view .LVU3694
+# blake2b-generic.c:5: static inline u64 ror64(unsigned l, u64 x) { return (x >> l) | (x << (64-l)); }
+	.loc 1 5 62 is_stmt 0 view .LVU3695
+	rolq	%rbp	# tmp2323
+.LBE1498:
+.LBE1497:
+# blake2b-generic.c:48:     FULLROUND(10);
+	.loc 1 48 1605 view .LVU3696
+	movq	%r8, -40(%rsp)	# _2187, %sfp
+# blake2b-generic.c:48:     FULLROUND(10);
+	.loc 1 48 1625 view .LVU3697
+	movq	%rbp, 40(%rax)	# _2190, MEM[(u64 *)v_1170(D) + 40B]
+	.loc 1 48 1341 is_stmt 1 view .LVU3698
+	.loc 1 48 1670 view .LVU3699
+	.loc 1 48 1675 view .LVU3700
+# blake2b-generic.c:48:     FULLROUND(10);
+	.loc 1 48 1683 is_stmt 0 view .LVU3701
+	addq	80(%r9), %rsi	# MEM[(const u64 *)m_1171(D) + 80B], tmp2324
+	addq	%rbx, %rsi	# _2166, _1039
+# blake2b-generic.c:48:     FULLROUND(10);
+	.loc 1 48 1625 view .LVU3702
+	movq	%rbp, -24(%rsp)	# _2190, %sfp
+# blake2b-generic.c:48:     FULLROUND(10);
+	.loc 1 48 1743 view .LVU3703
+	xorq	%rsi, %rdi	# _1039, tmp2326
+# blake2b-generic.c:48:     FULLROUND(10);
+	.loc 1 48 1683 view .LVU3704
+	movq	%rsi, 8(%rax)	# _1039, MEM[(u64 *)v_1170(D) + 8B]
+	.loc 1 48 1733 is_stmt 1 view .LVU3705
+.LVL661:
+.LBB1499:
+.LBI1499:
+	.loc 1 5 19 view .LVU3706
+.LBB1500:
+	.loc 1 5 46 view .LVU3707
+# blake2b-generic.c:5: static inline u64 ror64(unsigned l, u64 x) { return (x >> l) | (x << (64-l)); }
+	.loc 1 5 62 is_stmt 0 view .LVU3708
+	rolq	$32, %rdi	#, _2193
+.LVL662:
+	.loc 1 5 62 view .LVU3709
+.LBE1500:
+.LBE1499:
+# blake2b-generic.c:48:     FULLROUND(10);
+	.loc 1 48 1627 view .LVU3710
+	movq	%r10, -72(%rsp)	# _1035, %sfp
+# blake2b-generic.c:48:     FULLROUND(10);
+	.loc 1 48 1781 view .LVU3711
+	addq	%rdi, %r15	# _2193, _1041
+# blake2b-generic.c:48:     FULLROUND(10);
+	.loc 1 48 1741 view .LVU3712
+	movq	%rdi, 96(%rax)	# _2193, MEM[(u64 *)v_1170(D) + 96B]
+	.loc 1 48 1773 is_stmt 1 view .LVU3713
+# blake2b-generic.c:48:     FULLROUND(10);
+	.loc 1 48 1803 is_stmt 0 view .LVU3714
+	xorq	%r15, %rbx	# _1041, tmp2327
+# blake2b-generic.c:48:     FULLROUND(10);
+	.loc 1 48 1781 view .LVU3715
+	movq	%r15, 88(%rax)	# _1041, MEM[(u64 *)v_1170(D) + 88B]
+	.loc 1 48 1793 is_stmt 1 view .LVU3716
+.LVL663:
+.LBB1501:
+.LBI1501:
+	.loc 1 5 19 view .LVU3717
+.LBB1502:
+	.loc 1 5 46 view .LVU3718
+# blake2b-generic.c:5: static inline u64 ror64(unsigned l, u64 x) { return (x >> l) | (x << (64-l)); }
+	.loc 1 5 62 is_stmt 0 view .LVU3719
+	rorq	$24, %rbx	#, _2196
+.LVL664:
+	.loc 1 5 62 view .LVU3720
+.LBE1502:
+.LBE1501:
+# blake2b-generic.c:48:     FULLROUND(10);
+	.loc 1 48 1801 view .LVU3721
+	movq	%rbx, 48(%rax)	# _2196, MEM[(u64 *)v_1170(D) + 48B]
+	.loc 1 48 1833 is_stmt 1 view .LVU3722
+# blake2b-generic.c:48:     FULLROUND(10);
+	.loc 1 48 1841 is_stmt 0 view .LVU3723
+	addq	88(%r9), %rsi	# MEM[(const u64 *)m_1171(D) + 88B], tmp2328
+	addq	%rbx, %rsi	# _2196, _1045
+# blake2b-generic.c:48:     FULLROUND(10);
+	.loc 1 48 1901 view .LVU3724
+	xorq	%rsi, %rdi	# _1045, tmp2330
+# blake2b-generic.c:48:     FULLROUND(10);
+	.loc 1 48 1841 view .LVU3725
+	movq	%rsi, 8(%rax)	# _1045, MEM[(u64 *)v_1170(D) + 8B]
+	.loc 1 48 1891 is_stmt 1 view .LVU3726
+.LVL665:
+.LBB1503:
+.LBI1503:
+	.loc 1 5 19 view .LVU3727
+.LBB1504:
+	.loc 1 5 46 view .LVU3728
+# blake2b-generic.c:5: static inline u64 ror64(unsigned l, u64 x) { return (x >> l) | (x << (64-l)); }
+	.loc 1 5 62 is_stmt 0 view .LVU3729
+	rorq	$16, %rdi	#, tmp2330
+.LBE1504:
+.LBE1503:
+# blake2b-generic.c:48:     FULLROUND(10);
+	.loc 1 48 1899 view .LVU3730
+	movq	%rdi, 96(%rax)	# _2199, MEM[(u64 *)v_1170(D) + 96B]
+.LBB1506:
+.LBB1505:
+# blake2b-generic.c:5: static inline u64 ror64(unsigned l, u64 x) { return (x >> l) | (x << (64-l)); }
+	.loc 1 5 62 view .LVU3731
+	movq	%rdi, %rbp	# tmp2330, _2199
+.LVL666:
+	.loc 1 5 62 view .LVU3732
+.LBE1505:
+.LBE1506:
+	.loc 1 48 1931 is_stmt 1 view .LVU3733
+# blake2b-generic.c:48:     FULLROUND(10);
+	.loc 1 48 1939 is_stmt 0 view .LVU3734
+	leaq	(%r15,%rdi), %rdi	#, _1047
+# blake2b-generic.c:48:     FULLROUND(10);
+	.loc 1 48 1961 view .LVU3735
+	xorq	%rdi, %rbx	# _1047, tmp2331
+# blake2b-generic.c:48:     FULLROUND(10);
+	.loc 1 48 1939 view .LVU3736
+	movq	%rdi, 88(%rax)	# _1047, MEM[(u64 *)v_1170(D) + 88B]
+	.loc 1 48 1951 is_stmt 1 view .LVU3737
+.LVL667:
+.LBB1507:
+.LBI1507:
+	.loc 1 5 19 view .LVU3738
+.LBB1508:
+	.loc 1 5 46 view .LVU3739
+# blake2b-generic.c:5: static inline u64 ror64(unsigned l, u64 x) { return (x >> l) | (x << (64-l)); }
+	.loc 1 5 62 is_stmt 0 view .LVU3740
+	rolq	%rbx	# tmp2331
+.LBE1508:
+.LBE1507:
+# blake2b-generic.c:48:     FULLROUND(10);
+	.loc 1 48 1961 view .LVU3741
+	movq	%rdi, -64(%rsp)	# _1047, %sfp
+# blake2b-generic.c:48:     FULLROUND(10);
+	.loc 1 48 2115 view .LVU3742
+	movq	-80(%rsp), %rdi	# %sfp, _987
+# blake2b-generic.c:48:     FULLROUND(10);
+	.loc 1 48 1959 view .LVU3743
+	movq	%rbx, 48(%rax)	# _2202, MEM[(u64 *)v_1170(D) + 48B]
+	.loc 1 48 1673 is_stmt 1 view .LVU3744
+	.loc 1 48 2004 view .LVU3745
+	.loc 1 48 2009 view .LVU3746
+# blake2b-generic.c:48:     FULLROUND(10);
+	.loc 1 48 2017 is_stmt 0 view .LVU3747
+	addq	96(%r9), %r14	# MEM[(const u64 *)m_1171(D) + 96B], tmp2332
+# blake2b-generic.c:48:     FULLROUND(10);
+	.loc 1 48 1959 view .LVU3748
+	movq	%rbx, -16(%rsp)	# _2202, %sfp
+# blake2b-generic.c:48:     FULLROUND(10);
+	.loc 1 48 2017 view .LVU3749
+	leaq	(%r14,%r11), %rbx	#, _1051
+# blake2b-generic.c:48:     FULLROUND(10);
+	.loc 1 48 2077 view .LVU3750
+	xorq	%rbx, %rcx	# _1051, tmp2334
+# blake2b-generic.c:48:     FULLROUND(10);
+	.loc 1 48 2017 view .LVU3751
+	movq	%rbx, 16(%rax)	# _1051, MEM[(u64 *)v_1170(D) + 16B]
+	.loc 1 48 2067 is_stmt 1 view .LVU3752
+.LVL668:
+.LBB1509:
+.LBI1509:
+	.loc 1 5 19 view .LVU3753
+.LBB1510:
+	.loc 1 5 46 view .LVU3754
+# blake2b-generic.c:5: static inline u64 ror64(unsigned l, u64 x) { return (x >> l) | (x << (64-l)); }
+	.loc 1 5 62 is_stmt 0 view .LVU3755
+	rolq	$32, %rcx	#, _2205
+.LVL669:
+	.loc 1 5 62 view .LVU3756
+.LBE1510:
+.LBE1509:
+# blake2b-generic.c:48:     FULLROUND(10);
+	.loc 1 48 2115 view .LVU3757
+	leaq	(%rdi,%rcx), %r13	#, _1053
+# blake2b-generic.c:48:     FULLROUND(10);
+	.loc 1 48 2075 view .LVU3758
+	movq	%rcx, 104(%rax)	# _2205, MEM[(u64 *)v_1170(D) + 104B]
+	.loc 1 48 2107 is_stmt 1 view .LVU3759
+# blake2b-generic.c:48:     FULLROUND(10);
+	.loc 1 48 2137 is_stmt 0 view .LVU3760
+	xorq	%r13, %r11	# _1053, tmp2335
+# blake2b-generic.c:48:     FULLROUND(10);
+	.loc 1 48 2115 view .LVU3761
+	movq	%r13, 64(%rax)	# _1053, MEM[(u64 *)v_1170(D) + 64B]
+	.loc 1 48 2127 is_stmt 1 view .LVU3762
+.LVL670:
+.LBB1511:
+.LBI1511:
+	.loc 1 5 19 view .LVU3763
+.LBB1512:
+	.loc 1 5 46 view .LVU3764
+# blake2b-generic.c:5: static inline u64 ror64(unsigned l, u64 x) { return (x >> l) | (x << (64-l)); }
+	.loc 1 5 62 is_stmt 0 view .LVU3765
+	rorq	$24, %r11	#, _2208
+.LVL671:
+	.loc 1 5 62 view .LVU3766
+.LBE1512:
+.LBE1511:
+# blake2b-generic.c:48:     FULLROUND(10);
+	.loc 1 48 2135 view .LVU3767
+	movq	%r11, 56(%rax)	# _2208, MEM[(u64 *)v_1170(D) + 56B]
+	.loc 1 48 2167 is_stmt 1 view .LVU3768
+# blake2b-generic.c:48:     FULLROUND(10);
+	.loc 1 48 2175 is_stmt 0 view .LVU3769
+	addq	104(%r9), %rbx	# MEM[(const u64 *)m_1171(D) + 104B], tmp2336
+	addq	%r11, %rbx	# _2208, _1057
+# blake2b-generic.c:48:     FULLROUND(10);
+	.loc 1 48 2351 view .LVU3770
+	movq	-48(%rsp), %rdi	# %sfp, _2142
+# blake2b-generic.c:48:     FULLROUND(10);
+	.loc 1 48 2411 view .LVU3771
+	movq	-32(%rsp), %r10	# %sfp, _2163
+# blake2b-generic.c:48:     FULLROUND(10);
+	.loc 1 48 2235 view .LVU3772
+	xorq	%rbx, %rcx	# _1057, tmp2338
+# blake2b-generic.c:48:     FULLROUND(10);
+	.loc 1 48 2175 view .LVU3773
+	movq	%rbx, 16(%rax)	# _1057, MEM[(u64 *)v_1170(D) + 16B]
+	.loc 1 48 2225 is_stmt 1 view .LVU3774
+.LVL672:
+.LBB1513:
+.LBI1513:
+	.loc 1 5 19 view .LVU3775
+.LBB1514:
+	.loc 1 5 46 view .LVU3776
+.LBE1514:
+.LBE1513:
+# blake2b-generic.c:48:     FULLROUND(10);
+	.loc 1 48 2449 is_stmt 0 view .LVU3777
+	movq	-56(%rsp), %r15	# %sfp, _999
+.LBB1516:
+.LBB1515:
+# blake2b-generic.c:5: static inline u64 ror64(unsigned l, u64 x) { return (x >> l) | (x << (64-l)); }
+	.loc 1 5 62 view .LVU3778
+	rorq	$16, %rcx	#, _2211
+.LVL673:
+	.loc 1 5 62 view .LVU3779
+.LBE1515:
+.LBE1516:
+# blake2b-generic.c:48:     FULLROUND(10);
+	.loc 1 48 2273 view .LVU3780
+	addq	%rcx, %r13	# _2211, _1059
+# blake2b-generic.c:48:     FULLROUND(10);
+	.loc 1 48 2233 view .LVU3781
+	movq	%rcx, 104(%rax)	# _2211, MEM[(u64 *)v_1170(D) + 104B]
+	.loc 1 48 2265 is_stmt 1 view .LVU3782
+# blake2b-generic.c:48:     FULLROUND(10);
+	.loc 1 48 2295 is_stmt 0 view .LVU3783
+	xorq	%r13, %r11	# _1059, tmp2339
+# blake2b-generic.c:48:     FULLROUND(10);
+	.loc 1 48 2273 view .LVU3784
+	movq	%r13, 64(%rax)	# _1059, MEM[(u64 *)v_1170(D) + 64B]
+	.loc 1 48 2285 is_stmt 1 view .LVU3785
+.LVL674:
+.LBB1517:
+.LBI1517:
+	.loc 1 5 19 view .LVU3786
+.LBB1518:
+	.loc 1 5 46 view .LVU3787
+# blake2b-generic.c:5: static inline u64 ror64(unsigned l, u64 x) { return (x >> l) | (x << (64-l)); }
+	.loc 1 5 62 is_stmt 0 view .LVU3788
+	rolq	%r11	# tmp2339
+.LBE1518:
+.LBE1517:
+# blake2b-generic.c:48:     FULLROUND(10);
+	.loc 1 48 2293 view .LVU3789
+	movq	%r11, 56(%rax)	# _2214, MEM[(u64 *)v_1170(D) + 56B]
+	.loc 1 48 2007 is_stmt 1 view .LVU3790
+	.loc 1 48 2338 view .LVU3791
+	.loc 1 48 2343 view .LVU3792
+# blake2b-generic.c:48:     FULLROUND(10);
+	.loc 1 48 2351 is_stmt 0 view .LVU3793
+	addq	112(%r9), %rdx	# MEM[(const u64 *)m_1171(D) + 112B], tmp2340
+	addq	%rdi, %rdx	# _2142, _1063
+# blake2b-generic.c:48:     FULLROUND(10);
+	.loc 1 48 2293 view .LVU3794
+	movq	%r11, -8(%rsp)	# _2214, %sfp
+# blake2b-generic.c:48:     FULLROUND(10);
+	.loc 1 48 2411 view .LVU3795
+	xorq	%rdx, %r10	# _1063, _2163
+# blake2b-generic.c:48:     FULLROUND(10);
+	.loc 1 48 2351 view .LVU3796
+	movq	%rdx, 24(%rax)	# _1063, MEM[(u64 *)v_1170(D) + 24B]
+	.loc 1 48 2401 is_stmt 1 view .LVU3797
+.LVL675:
+.LBB1519:
+.LBI1519:
+	.loc 1 5 19 view .LVU3798
+.LBB1520:
+	.loc 1 5 46 view .LVU3799
+# blake2b-generic.c:5: static inline u64 ror64(unsigned l, u64 x) { return (x >> l) | (x << (64-l)); }
+	.loc 1 5 62 is_stmt 0 view .LVU3800
+	rolq	$32, %r10	#, _2217
+.LVL676:
+	.loc 1 5 62 view .LVU3801
+.LBE1520:
+.LBE1519:
+# blake2b-generic.c:48:     FULLROUND(10);
+	.loc 1 48 2449 view .LVU3802
+	leaq	(%r15,%r10), %r11	#, _1065
+# blake2b-generic.c:48:     FULLROUND(10);
+	.loc 1 48 2409 view .LVU3803
+	movq	%r10, 112(%rax)	# _2217, MEM[(u64 *)v_1170(D) + 112B]
+	.loc 1 48 2441 is_stmt 1 view .LVU3804
+# blake2b-generic.c:48:     FULLROUND(10);
+	.loc 1 48 2471 is_stmt 0 view .LVU3805
+	xorq	%r11, %rdi	# _1065, _2142
+# blake2b-generic.c:48:     FULLROUND(10);
+	.loc 1 48 2449 view .LVU3806
+	movq	%r11, 72(%rax)	# _1065, MEM[(u64 *)v_1170(D) + 72B]
+	.loc 1 48 2461 is_stmt 1 view .LVU3807
+.LVL677:
+.LBB1521:
+.LBI1521:
+	.loc 1 5 19 view .LVU3808
+.LBB1522:
+	.loc 1 5 46 view .LVU3809
+.LBE1522:
+.LBE1521:
+# blake2b-generic.c:48:     FULLROUND(10);
+	.loc 1 48 2471 is_stmt 0 view .LVU3810
+	movq	%rdi, %r8	# _2142, tmp2343
+.LBB1524:
+.LBB1523:
+# blake2b-generic.c:5: static inline u64 ror64(unsigned l, u64 x) { return (x >> l) | (x << (64-l)); }
+	.loc 1 5 62 view .LVU3811
+	rorq	$24, %r8	#, _2220
+.LVL678:
+	.loc 1 5 62 view .LVU3812
+.LBE1523:
+.LBE1524:
+# blake2b-generic.c:48:     FULLROUND(10);
+	.loc 1 48 2469 view .LVU3813
+	movq	%r8, 32(%rax)	# _2220, MEM[(u64 *)v_1170(D) + 32B]
+	.loc 1 48 2501 is_stmt 1 view .LVU3814
+# blake2b-generic.c:48:     FULLROUND(10);
+	.loc 1 48 2509 is_stmt 0 view .LVU3815
+	addq	120(%r9), %rdx	# MEM[(const u64 *)m_1171(D) + 120B], tmp2344
+	addq	%r8, %rdx	# _2220, _1069
+# blake2b-generic.c:48:     FULLROUND(10);
+	.loc 1 48 2569 view .LVU3816
+	xorq	%rdx, %r10	# _1069, tmp2346
+# blake2b-generic.c:48:     FULLROUND(10);
+	.loc 1 48 2509 view .LVU3817
+	movq	%rdx, 24(%rax)	# _1069, MEM[(u64 *)v_1170(D) + 24B]
+	.loc 1 48 2559 is_stmt 1 view .LVU3818
+.LVL679:
+.LBB1525:
+.LBI1525:
+	.loc 1 5 19 view .LVU3819
+.LBB1526:
+	.loc 1 5 46 view .LVU3820
+# blake2b-generic.c:5: static inline u64 ror64(unsigned l, u64 x) { return (x >> l) | (x << (64-l)); }
+	.loc 1 5 62 is_stmt 0 view .LVU3821
+	rorq	$16, %r10	#, _2223
+.LVL680:
+	.loc 1 5 62 view .LVU3822
+.LBE1526:
+.LBE1525:
+# blake2b-generic.c:48:     FULLROUND(10);
+	.loc 1 48 2607 view .LVU3823
+	addq	%r10, %r11	# _2223, _1071
+# blake2b-generic.c:48:     FULLROUND(10);
+	.loc 1 48 2567 view .LVU3824
+	movq	%r10, 112(%rax)	# _2223, MEM[(u64 *)v_1170(D) + 112B]
+	.loc 1 48 2599 is_stmt 1 view .LVU3825
+# blake2b-generic.c:48:     FULLROUND(10);
+	.loc 1 48 2629 is_stmt 0 view .LVU3826
+	xorq	%r11, %r8	# _1071, tmp2347
+# blake2b-generic.c:48:     FULLROUND(10);
+	.loc 1 48 2607 view .LVU3827
+	movq	%r11, 72(%rax)	# _1071, MEM[(u64 *)v_1170(D) + 72B]
+	.loc 1 48 2619 is_stmt 1 view .LVU3828
+.LVL681:
+.LBB1527:
+.LBI1527:
+	.loc 1 5 19 view .LVU3829
+.LBB1528:
+	.loc 1 5 46 view .LVU3830
+# blake2b-generic.c:5: static inline u64 ror64(unsigned l, u64 x) { return (x >> l) | (x << (64-l)); }
+	.loc 1 5 62 is_stmt 0 view .LVU3831
+	rolq	%r8	# _2226
+.LVL682:
+	.loc 1 5 62 view .LVU3832
+.LBE1528:
+.LBE1527:
+# blake2b-generic.c:48:     FULLROUND(10);
+	.loc 1 48 2627 view .LVU3833
+	movq	%r8, 32(%rax)	# _2226, MEM[(u64 *)v_1170(D) + 32B]
+	.loc 1 48 2341 is_stmt 1 view .LVU3834
+	.loc 1 48 8 view .LVU3835
+	.loc 1 49 5 view .LVU3836
+	.loc 1 49 10 view .LVU3837
+	.loc 1 49 15 view .LVU3838
+# blake2b-generic.c:49:     FULLROUND(11);
+	.loc 1 49 23 is_stmt 0 view .LVU3839
+	addq	112(%r9), %r12	# MEM[(const u64 *)m_1171(D) + 112B], tmp2348
+	leaq	(%r12,%r8), %rdi	#, _1075
+# blake2b-generic.c:49:     FULLROUND(11);
+	.loc 1 49 82 view .LVU3840
+	xorq	%rdi, %rbp	# _1075, tmp2350
+# blake2b-generic.c:49:     FULLROUND(11);
+	.loc 1 49 23 view .LVU3841
+	movq	%rdi, (%rax)	# _1075, *v_1170(D)
+	.loc 1 49 72 is_stmt 1 view .LVU3842
+.LVL683:
+.LBB1529:
+.LBI1529:
+	.loc 1 5 19 view .LVU3843
+.LBB1530:
+	.loc 1 5 46 view .LVU3844
+# blake2b-generic.c:5: static inline u64 ror64(unsigned l, u64 x) { return (x >> l) | (x << (64-l)); }
+	.loc 1 5 62 is_stmt 0 view .LVU3845
+	rolq	$32, %rbp	#, _2229
+.LVL684:
+	.loc 1 5 62 view .LVU3846
+.LBE1530:
+.LBE1529:
+# blake2b-generic.c:49:     FULLROUND(11);
+	.loc 1 49 120 view .LVU3847
+	addq	%rbp, %r13	# _2229, _1077
+# blake2b-generic.c:49:     FULLROUND(11);
+	.loc 1 49 80 view .LVU3848
+	movq	%rbp, 96(%rax)	# _2229, MEM[(u64 *)v_1170(D) + 96B]
+	.loc 1 49 112 is_stmt 1 view .LVU3849
+# blake2b-generic.c:49:     FULLROUND(11);
+	.loc 1 49 142 is_stmt 0 view .LVU3850
+	xorq	%r13, %r8	# _1077, tmp2351
+# blake2b-generic.c:49:     FULLROUND(11);
+	.loc 1 49 120 view .LVU3851
+	movq	%r13, 64(%rax)	# _1077, MEM[(u64 *)v_1170(D) + 64B]
+	.loc 1 49 132 is_stmt 1 view .LVU3852
+.LVL685:
+.LBB1531:
+.LBI1531:
+	.loc 1 5 19 view .LVU3853
+.LBB1532:
+	.loc 1 5 46 view .LVU3854
+# blake2b-generic.c:5: static inline u64 ror64(unsigned l, u64 x) { return (x >> l) | (x << (64-l)); }
+	.loc 1 5 62 is_stmt 0 view .LVU3855
+	rorq	$24, %r8	#, _2232
+.LVL686:
+	.loc 1 5 62 view .LVU3856
+.LBE1532:
+.LBE1531:
+# blake2b-generic.c:49:     FULLROUND(11);
+	.loc 1 49 140 view .LVU3857
+	movq	%r8, 32(%rax)	# _2232, MEM[(u64 *)v_1170(D) + 32B]
+	.loc 1 49 172 is_stmt 1 view .LVU3858
+# blake2b-generic.c:49:     FULLROUND(11);
+	.loc 1 49 180 is_stmt 0 view .LVU3859
+	addq	80(%r9), %rdi	# MEM[(const u64 *)m_1171(D) + 80B], tmp2352
+	addq	%r8, %rdi	# _2232, _1081
+# blake2b-generic.c:49:     FULLROUND(11);
+	.loc 1 49 239 view .LVU3860
+	xorq	%rdi, %rbp	# _1081, tmp2354
+# blake2b-generic.c:49:     FULLROUND(11);
+	.loc 1 49 180 view .LVU3861
+	movq	%rdi, (%rax)	# _1081, *v_1170(D)
+	.loc 1 49 229 is_stmt 1 view .LVU3862
+.LVL687:
+.LBB1533:
+.LBI1533:
+	.loc 1 5 19 view .LVU3863
+.LBB1534:
+	.loc 1 5 46 view .LVU3864
+# blake2b-generic.c:5: static inline u64 ror64(unsigned l, u64 x) { return (x >> l) | (x << (64-l)); }
+	.loc 1 5 62 is_stmt 0 view .LVU3865
+	movq	%rbp, %r12	# tmp2354, tmp2354
+	rorq	$16, %r12	#, tmp2354
+.LBE1534:
+.LBE1533:
+# blake2b-generic.c:49:     FULLROUND(11);
+	.loc 1 49 277 view .LVU3866
+	leaq	0(%r13,%r12), %r15	#, _1083
+	movq	%r12, -56(%rsp)	# _2235, %sfp
+# blake2b-generic.c:49:     FULLROUND(11);
+	.loc 1 49 299 view .LVU3867
+	xorq	%r15, %r8	# _1083, tmp2355
+	movq	%r15, -80(%rsp)	# _1083, %sfp
+# blake2b-generic.c:49:     FULLROUND(11);
+	.loc 1 49 277 view .LVU3868
+	movq	%r15, 64(%rax)	# _1083, MEM[(u64 *)v_1170(D) + 64B]
+.LBB1535:
+.LBB1536:
+# blake2b-generic.c:5: static inline u64 ror64(unsigned l, u64 x) { return (x >> l) | (x << (64-l)); }
+	.loc 1 5 62 view .LVU3869
+	movq	%r8, %r15	# tmp2355, tmp2355
+	rolq	%r15	# tmp2355
+.LBE1536:
+.LBE1535:
+# blake2b-generic.c:49:     FULLROUND(11);
+	.loc 1 49 237 view .LVU3870
+	movq	%r12, 96(%rax)	# _2235, MEM[(u64 *)v_1170(D) + 96B]
+	.loc 1 49 269 is_stmt 1 view .LVU3871
+	.loc 1 49 289 view .LVU3872
+.LVL688:
+.LBB1538:
+.LBI1535:
+	.loc 1 5 19 view .LVU3873
+.LBB1537:
+	.loc 1 5 46 view .LVU3874
+	.loc 1 5 46 is_stmt 0 view .LVU3875
+.LBE1537:
+.LBE1538:
+# blake2b-generic.c:49:     FULLROUND(11);
+	.loc 1 49 297 view .LVU3876
+	movq	%r15, -48(%rsp)	# _2238, %sfp
+	movq	%r15, 32(%rax)	# _2238, MEM[(u64 *)v_1170(D) + 32B]
+	.loc 1 49 13 is_stmt 1 view .LVU3877
+	.loc 1 49 342 view .LVU3878
+	.loc 1 49 347 view .LVU3879
+# blake2b-generic.c:49:     FULLROUND(11);
+	.loc 1 49 355 is_stmt 0 view .LVU3880
+	addq	32(%r9), %rsi	# MEM[(const u64 *)m_1171(D) + 32B], tmp2356
+	movq	-24(%rsp), %r15	# %sfp, _2190
+# blake2b-generic.c:49:     FULLROUND(11);
+	.loc 1 49 687 view .LVU3881
+	movq	-16(%rsp), %r14	# %sfp, _2202
+# blake2b-generic.c:49:     FULLROUND(11);
+	.loc 1 49 784 view .LVU3882
+	movq	-72(%rsp), %rbp	# %sfp, _1035
+# blake2b-generic.c:49:     FULLROUND(11);
+	.loc 1 49 1078 view .LVU3883
+	movq	-40(%rsp), %r13	# %sfp, _2187
+# blake2b-generic.c:49:     FULLROUND(11);
+	.loc 1 49 355 view .LVU3884
+	addq	%r15, %rsi	# _2190, _1087
+# blake2b-generic.c:49:     FULLROUND(11);
+	.loc 1 49 414 view .LVU3885
+	xorq	%rsi, %rcx	# _1087, tmp2358
+# blake2b-generic.c:49:     FULLROUND(11);
+	.loc 1 49 355 view .LVU3886
+	movq	%rsi, 8(%rax)	# _1087, MEM[(u64 *)v_1170(D) + 8B]
+	.loc 1 49 404 is_stmt 1 view .LVU3887
+.LVL689:
+.LBB1539:
+.LBI1539:
+	.loc 1 5 19 view .LVU3888
+.LBB1540:
+	.loc 1 5 46 view .LVU3889
+# blake2b-generic.c:5: static inline u64 ror64(unsigned l, u64 x) { return (x >> l) | (x << (64-l)); }
+	.loc 1 5 62 is_stmt 0 view .LVU3890
+	rolq	$32, %rcx	#, _2241
+.LVL690:
+	.loc 1 5 62 view .LVU3891
+.LBE1540:
+.LBE1539:
+# blake2b-generic.c:49:     FULLROUND(11);
+	.loc 1 49 452 view .LVU3892
+	addq	%rcx, %r11	# _2241, _1089
+# blake2b-generic.c:49:     FULLROUND(11);
+	.loc 1 49 412 view .LVU3893
+	movq	%rcx, 104(%rax)	# _2241, MEM[(u64 *)v_1170(D) + 104B]
+	.loc 1 49 444 is_stmt 1 view .LVU3894
+# blake2b-generic.c:49:     FULLROUND(11);
+	.loc 1 49 474 is_stmt 0 view .LVU3895
+	xorq	%r11, %r15	# _1089, _2190
+# blake2b-generic.c:49:     FULLROUND(11);
+	.loc 1 49 452 view .LVU3896
+	movq	%r11, 72(%rax)	# _1089, MEM[(u64 *)v_1170(D) + 72B]
+	.loc 1 49 464 is_stmt 1 view .LVU3897
+.LVL691:
+.LBB1541:
+.LBI1541:
+	.loc 1 5 19 view .LVU3898
+.LBB1542:
+	.loc 1 5 46 view .LVU3899
+.LBE1542:
+.LBE1541:
+# blake2b-generic.c:49:     FULLROUND(11);
+	.loc 1 49 474 is_stmt 0 view .LVU3900
+	movq	%r15, %r12	# _2190, tmp2359
+.LBB1544:
+.LBB1543:
+# blake2b-generic.c:5: static inline u64 ror64(unsigned l, u64 x) { return (x >> l) | (x << (64-l)); }
+	.loc 1 5 62 view .LVU3901
+	rorq	$24, %r12	#, _2244
+.LVL692:
+	.loc 1 5 62 view .LVU3902
+.LBE1543:
+.LBE1544:
+# blake2b-generic.c:49:     FULLROUND(11);
+	.loc 1 49 472 view .LVU3903
+	movq	%r12, 40(%rax)	# _2244, MEM[(u64 *)v_1170(D) + 40B]
+	.loc 1 49 504 is_stmt 1 view .LVU3904
+# blake2b-generic.c:49:     FULLROUND(11);
+	.loc 1 49 512 is_stmt 0 view .LVU3905
+	addq	64(%r9), %rsi	# MEM[(const u64 *)m_1171(D) + 64B], tmp2360
+	addq	%r12, %rsi	# _2244, _1093
+# blake2b-generic.c:49:     FULLROUND(11);
+	.loc 1 49 571 view .LVU3906
+	xorq	%rsi, %rcx	# _1093, tmp2362
+# blake2b-generic.c:49:     FULLROUND(11);
+	.loc 1 49 512 view .LVU3907
+	movq	%rsi, 8(%rax)	# _1093, MEM[(u64 *)v_1170(D) + 8B]
+	.loc 1 49 561 is_stmt 1 view .LVU3908
+.LVL693:
+.LBB1545:
+.LBI1545:
+	.loc 1 5 19 view .LVU3909
+.LBB1546:
+	.loc 1 5 46 view .LVU3910
+# blake2b-generic.c:5: static inline u64 ror64(unsigned l, u64 x) { return (x >> l) | (x << (64-l)); }
+	.loc 1 5 62 is_stmt 0 view .LVU3911
+	rorq	$16, %rcx	#, tmp2362
+.LBE1546:
+.LBE1545:
+# blake2b-generic.c:49:     FULLROUND(11);
+	.loc 1 49 609 view .LVU3912
+	addq	%rcx, %r11	# _2247, _1095
+# blake2b-generic.c:49:     FULLROUND(11);
+	.loc 1 49 569 view .LVU3913
+	movq	%rcx, 104(%rax)	# _2247, MEM[(u64 *)v_1170(D) + 104B]
+.LBB1548:
+.LBB1547:
+# blake2b-generic.c:5: static inline u64 ror64(unsigned l, u64 x) { return (x >> l) | (x << (64-l)); }
+	.loc 1 5 62 view .LVU3914
+	movq	%rcx, %r8	# tmp2362, _2247
+.LVL694:
+	.loc 1 5 62 view .LVU3915
+.LBE1547:
+.LBE1548:
+	.loc 1 49 601 is_stmt 1 view .LVU3916
+# blake2b-generic.c:49:     FULLROUND(11);
+	.loc 1 49 631 is_stmt 0 view .LVU3917
+	xorq	%r11, %r12	# _1095, tmp2363
+# blake2b-generic.c:49:     FULLROUND(11);
+	.loc 1 49 609 view .LVU3918
+	movq	%r11, 72(%rax)	# _1095, MEM[(u64 *)v_1170(D) + 72B]
+	.loc 1 49 621 is_stmt 1 view .LVU3919
+.LVL695:
+.LBB1549:
+.LBI1549:
+	.loc 1 5 19 view .LVU3920
+.LBB1550:
+	.loc 1 5 46 view .LVU3921
+# blake2b-generic.c:5: static inline u64 ror64(unsigned l, u64 x) { return (x >> l) | (x << (64-l)); }
+	.loc 1 5 62 is_stmt 0 view .LVU3922
+	rolq	%r12	# _2250
+.LVL696:
+	.loc 1 5 62 view .LVU3923
+.LBE1550:
+.LBE1549:
+# blake2b-generic.c:49:     FULLROUND(11);
+	.loc 1 49 629 view .LVU3924
+	movq	%r12, 40(%rax)	# _2250, MEM[(u64 *)v_1170(D) + 40B]
+	.loc 1 49 345 is_stmt 1 view .LVU3925
+	.loc 1 49 674 view .LVU3926
+	.loc 1 49 679 view .LVU3927
+# blake2b-generic.c:49:     FULLROUND(11);
+	.loc 1 49 687 is_stmt 0 view .LVU3928
+	addq	72(%r9), %rbx	# MEM[(const u64 *)m_1171(D) + 72B], tmp2364
+	leaq	(%rbx,%r14), %rcx	#, _1099
+# blake2b-generic.c:49:     FULLROUND(11);
+	.loc 1 49 1019 view .LVU3929
+	movq	-8(%rsp), %rbx	# %sfp, _2214
+# blake2b-generic.c:49:     FULLROUND(11);
+	.loc 1 49 746 view .LVU3930
+	xorq	%rcx, %r10	# _1099, tmp2366
+# blake2b-generic.c:49:     FULLROUND(11);
+	.loc 1 49 687 view .LVU3931
+	movq	%rcx, 16(%rax)	# _1099, MEM[(u64 *)v_1170(D) + 16B]
+	.loc 1 49 736 is_stmt 1 view .LVU3932
+.LVL697:
+.LBB1551:
+.LBI1551:
+	.loc 1 5 19 view .LVU3933
+.LBB1552:
+	.loc 1 5 46 view .LVU3934
+# blake2b-generic.c:5: static inline u64 ror64(unsigned l, u64 x) { return (x >> l) | (x << (64-l)); }
+	.loc 1 5 62 is_stmt 0 view .LVU3935
+	rolq	$32, %r10	#, _2253
+.LVL698:
+	.loc 1 5 62 view .LVU3936
+.LBE1552:
+.LBE1551:
+# blake2b-generic.c:49:     FULLROUND(11);
+	.loc 1 49 784 view .LVU3937
+	leaq	0(%rbp,%r10), %r15	#, _1101
+# blake2b-generic.c:49:     FULLROUND(11);
+	.loc 1 49 744 view .LVU3938
+	movq	%r10, 112(%rax)	# _2253, MEM[(u64 *)v_1170(D) + 112B]
+	.loc 1 49 776 is_stmt 1 view .LVU3939
+# blake2b-generic.c:49:     FULLROUND(11);
+	.loc 1 49 806 is_stmt 0 view .LVU3940
+	xorq	%r15, %r14	# _1101, _2202
+# blake2b-generic.c:49:     FULLROUND(11);
+	.loc 1 49 784 view .LVU3941
+	movq	%r15, 80(%rax)	# _1101, MEM[(u64 *)v_1170(D) + 80B]
+	.loc 1 49 796 is_stmt 1 view .LVU3942
+.LVL699:
+.LBB1553:
+.LBI1553:
+	.loc 1 5 19 view .LVU3943
+.LBB1554:
+	.loc 1 5 46 view .LVU3944
+.LBE1554:
+.LBE1553:
+# blake2b-generic.c:49:     FULLROUND(11);
+	.loc 1 49 806 is_stmt 0 view .LVU3945
+	movq	%r14, %rbp	# _2202, tmp2367
+# blake2b-generic.c:49:     FULLROUND(11);
+	.loc 1 49 1116 view .LVU3946
+	movq	-64(%rsp), %r14	# %sfp, _1047
+.LBB1556:
+.LBB1555:
+# blake2b-generic.c:5: static inline u64 ror64(unsigned l, u64 x) { return (x >> l) | (x << (64-l)); }
+	.loc 1 5 62 view .LVU3947
+	rorq	$24, %rbp	#, _2256
+.LVL700:
+	.loc 1 5 62 view .LVU3948
+.LBE1555:
+.LBE1556:
+# blake2b-generic.c:49:     FULLROUND(11);
+	.loc 1 49 804 view .LVU3949
+	movq	%rbp, 48(%rax)	# _2256, MEM[(u64 *)v_1170(D) + 48B]
+	.loc 1 49 836 is_stmt 1 view .LVU3950
+# blake2b-generic.c:49:     FULLROUND(11);
+	.loc 1 49 844 is_stmt 0 view .LVU3951
+	addq	120(%r9), %rcx	# MEM[(const u64 *)m_1171(D) + 120B], tmp2368
+	addq	%rbp, %rcx	# _2256, _1105
+# blake2b-generic.c:49:     FULLROUND(11);
+	.loc 1 49 903 view .LVU3952
+	xorq	%rcx, %r10	# _1105, tmp2370
+# blake2b-generic.c:49:     FULLROUND(11);
+	.loc 1 49 844 view .LVU3953
+	movq	%rcx, 16(%rax)	# _1105, MEM[(u64 *)v_1170(D) + 16B]
+	.loc 1 49 893 is_stmt 1 view .LVU3954
+.LVL701:
+.LBB1557:
+.LBI1557:
+	.loc 1 5 19 view .LVU3955
+.LBB1558:
+	.loc 1 5 46 view .LVU3956
+# blake2b-generic.c:5: static inline u64 ror64(unsigned l, u64 x) { return (x >> l) | (x << (64-l)); }
+	.loc 1 5 62 is_stmt 0 view .LVU3957
+	rorq	$16, %r10	#, _2259
+.LVL702:
+	.loc 1 5 62 view .LVU3958
+.LBE1558:
+.LBE1557:
+# blake2b-generic.c:49:     FULLROUND(11);
+	.loc 1 49 941 view .LVU3959
+	addq	%r10, %r15	# _2259, _1107
+# blake2b-generic.c:49:     FULLROUND(11);
+	.loc 1 49 901 view .LVU3960
+	movq	%r10, 112(%rax)	# _2259, MEM[(u64 *)v_1170(D) + 112B]
+	.loc 1 49 933 is_stmt 1 view .LVU3961
+# blake2b-generic.c:49:     FULLROUND(11);
+	.loc 1 49 963 is_stmt 0 view .LVU3962
+	xorq	%r15, %rbp	# _1107, tmp2371
+# blake2b-generic.c:49:     FULLROUND(11);
+	.loc 1 49 941 view .LVU3963
+	movq	%r15, 80(%rax)	# _1107, MEM[(u64 *)v_1170(D) + 80B]
+	.loc 1 49 953 is_stmt 1 view .LVU3964
+.LVL703:
+.LBB1559:
+.LBI1559:
+	.loc 1 5 19 view .LVU3965
+.LBB1560:
+	.loc 1 5 46 view .LVU3966
+# blake2b-generic.c:5: static inline u64 ror64(unsigned l, u64 x) { return (x >> l) | (x << (64-l)); }
+	.loc 1 5 62 is_stmt 0 view .LVU3967
+	rolq	%rbp	# _2262
+.LVL704:
+	.loc 1 5 62 view .LVU3968
+.LBE1560:
+.LBE1559:
+# blake2b-generic.c:49:     FULLROUND(11);
+	.loc 1 49 961 view .LVU3969
+	movq	%rbp, 48(%rax)	# _2262, MEM[(u64 *)v_1170(D) + 48B]
+	.loc 1 49 677 is_stmt 1 view .LVU3970
+	.loc 1 49 1006 view .LVU3971
+	.loc 1 49 1011 view .LVU3972
+# blake2b-generic.c:49:     FULLROUND(11);
+	.loc 1 49 1019 is_stmt 0 view .LVU3973
+	addq	104(%r9), %rdx	# MEM[(const u64 *)m_1171(D) + 104B], tmp2372
+	addq	%rbx, %rdx	# _2214, _1111
+# blake2b-generic.c:49:     FULLROUND(11);
+	.loc 1 49 1078 view .LVU3974
+	xorq	%rdx, %r13	# _1111, _2187
+# blake2b-generic.c:49:     FULLROUND(11);
+	.loc 1 49 1019 view .LVU3975
+	movq	%rdx, 24(%rax)	# _1111, MEM[(u64 *)v_1170(D) + 24B]
+	.loc 1 49 1068 is_stmt 1 view .LVU3976
+.LVL705:
+.LBB1561:
+.LBI1561:
+	.loc 1 5 19 view .LVU3977
+.LBB1562:
+	.loc 1 5 46 view .LVU3978
+# blake2b-generic.c:5: static inline u64 ror64(unsigned l, u64 x) { return (x >> l) | (x << (64-l)); }
+	.loc 1 5 62 is_stmt 0 view .LVU3979
+	rolq	$32, %r13	#, _2265
+.LVL706:
+	.loc 1 5 62 view .LVU3980
+.LBE1562:
+.LBE1561:
+# blake2b-generic.c:49:     FULLROUND(11);
+	.loc 1 49 1116 view .LVU3981
+	addq	%r13, %r14	# _2265, _1113
+# blake2b-generic.c:49:     FULLROUND(11);
+	.loc 1 49 1076 view .LVU3982
+	movq	%r13, 120(%rax)	# _2265, MEM[(u64 *)v_1170(D) + 120B]
+	.loc 1 49 1108 is_stmt 1 view .LVU3983
+# blake2b-generic.c:49:     FULLROUND(11);
+	.loc 1 49 1138 is_stmt 0 view .LVU3984
+	xorq	%r14, %rbx	# _1113, _2214
+# blake2b-generic.c:49:     FULLROUND(11);
+	.loc 1 49 1116 view .LVU3985
+	movq	%r14, 88(%rax)	# _1113, MEM[(u64 *)v_1170(D) + 88B]
+	.loc 1 49 1128 is_stmt 1 view .LVU3986
+.LVL707:
+.LBB1563:
+.LBI1563:
+	.loc 1 5 19 view .LVU3987
+.LBB1564:
+	.loc 1 5 46 view .LVU3988
+# blake2b-generic.c:5: static inline u64 ror64(unsigned l, u64 x) { return (x >> l) | (x << (64-l)); }
+	.loc 1 5 62 is_stmt 0 view .LVU3989
+	rorq	$24, %rbx	#, _2268
+.LVL708:
+	.loc 1 5 62 view .LVU3990
+.LBE1564:
+.LBE1563:
+# blake2b-generic.c:49:     FULLROUND(11);
+	.loc 1 49 1136 view .LVU3991
+	movq	%rbx, 56(%rax)	# _2268, MEM[(u64 *)v_1170(D) + 56B]
+	.loc 1 49 1168 is_stmt 1 view .LVU3992
+# blake2b-generic.c:49:     FULLROUND(11);
+	.loc 1 49 1176 is_stmt 0 view .LVU3993
+	addq	48(%r9), %rdx	# MEM[(const u64 *)m_1171(D) + 48B], tmp2376
+	addq	%rbx, %rdx	# _2268, _1117
+# blake2b-generic.c:49:     FULLROUND(11);
+	.loc 1 49 1235 view .LVU3994
+	xorq	%rdx, %r13	# _1117, tmp2378
+# blake2b-generic.c:49:     FULLROUND(11);
+	.loc 1 49 1176 view .LVU3995
+	movq	%rdx, 24(%rax)	# _1117, MEM[(u64 *)v_1170(D) + 24B]
+	.loc 1 49 1225 is_stmt 1 view .LVU3996
+.LVL709:
+.LBB1565:
+.LBI1565:
+	.loc 1 5 19 view .LVU3997
+.LBB1566:
+	.loc 1 5 46 view .LVU3998
+# blake2b-generic.c:5: static inline u64 ror64(unsigned l, u64 x) { return (x >> l) | (x << (64-l)); }
+	.loc 1 5 62 is_stmt 0 view .LVU3999
+	rorq	$16, %r13	#, _2271
+.LVL710:
+	.loc 1 5 62 view .LVU4000
+.LBE1566:
+.LBE1565:
+# blake2b-generic.c:49:     FULLROUND(11);
+	.loc 1 49 1273 view .LVU4001
+	addq	%r13, %r14	# _2271, _1119
+# blake2b-generic.c:49:     FULLROUND(11);
+	.loc 1 49 1233 view .LVU4002
+	movq	%r13, 120(%rax)	# _2271, MEM[(u64 *)v_1170(D) + 120B]
+	.loc 1 49 1265 is_stmt 1 view .LVU4003
+# blake2b-generic.c:49:     FULLROUND(11);
+	.loc 1 49 1295 is_stmt 0 view .LVU4004
+	xorq	%r14, %rbx	# _1119, tmp2379
+# blake2b-generic.c:49:     FULLROUND(11);
+	.loc 1 49 1273 view .LVU4005
+	movq	%r14, 88(%rax)	# _1119, MEM[(u64 *)v_1170(D) + 88B]
+	.loc 1 49 1285 is_stmt 1 view .LVU4006
+.LVL711:
+.LBB1567:
+.LBI1567:
+	.loc 1 5 19 view .LVU4007
+.LBB1568:
+	.loc 1 5 46 view .LVU4008
+# blake2b-generic.c:5: static inline u64 ror64(unsigned l, u64 x) { return (x >> l) | (x << (64-l)); }
+	.loc 1 5 62 is_stmt 0 view .LVU4009
+	rolq	%rbx	# _2274
+.LVL712:
+	.loc 1 5 62 view .LVU4010
+.LBE1568:
+.LBE1567:
+# blake2b-generic.c:49:     FULLROUND(11);
+	.loc 1 49 1293 view .LVU4011
+	movq	%rbx, 56(%rax)	# _2274, MEM[(u64 *)v_1170(D) + 56B]
+	.loc 1 49 1009 is_stmt 1 view .LVU4012
+	.loc 1 49 1338 view .LVU4013
+	.loc 1 49 1343 view .LVU4014
+# blake2b-generic.c:49:     FULLROUND(11);
+	.loc 1 49 1351 is_stmt 0 view .LVU4015
+	addq	8(%r9), %rdi	# MEM[(const u64 *)m_1171(D) + 8B], tmp2380
+	addq	%r12, %rdi	# _2250, _1123
+# blake2b-generic.c:49:     FULLROUND(11);
+	.loc 1 49 1410 view .LVU4016
+	xorq	%rdi, %r13	# _1123, tmp2382
+# blake2b-generic.c:49:     FULLROUND(11);
+	.loc 1 49 1351 view .LVU4017
+	movq	%rdi, (%rax)	# _1123, *v_1170(D)
+	.loc 1 49 1400 is_stmt 1 view .LVU4018
+.LVL713:
+.LBB1569:
+.LBI1569:
+	.loc 1 5 19 view .LVU4019
+.LBB1570:
+	.loc 1 5 46 view .LVU4020
+# blake2b-generic.c:5: static inline u64 ror64(unsigned l, u64 x) { return (x >> l) | (x << (64-l)); }
+	.loc 1 5 62 is_stmt 0 view .LVU4021
+	rolq	$32, %r13	#, _2277
+.LVL714:
+	.loc 1 5 62 view .LVU4022
+.LBE1570:
+.LBE1569:
+# blake2b-generic.c:49:     FULLROUND(11);
+	.loc 1 49 1448 view .LVU4023
+	addq	%r13, %r15	# _2277, _1125
+# blake2b-generic.c:49:     FULLROUND(11);
+	.loc 1 49 1408 view .LVU4024
+	movq	%r13, 120(%rax)	# _2277, MEM[(u64 *)v_1170(D) + 120B]
+	.loc 1 49 1440 is_stmt 1 view .LVU4025
+# blake2b-generic.c:49:     FULLROUND(11);
+	.loc 1 49 1470 is_stmt 0 view .LVU4026
+	xorq	%r15, %r12	# _1125, tmp2383
+# blake2b-generic.c:49:     FULLROUND(11);
+	.loc 1 49 1448 view .LVU4027
+	movq	%r15, 80(%rax)	# _1125, MEM[(u64 *)v_1170(D) + 80B]
+	.loc 1 49 1460 is_stmt 1 view .LVU4028
+.LVL715:
+.LBB1571:
+.LBI1571:
+	.loc 1 5 19 view .LVU4029
+.LBB1572:
+	.loc 1 5 46 view .LVU4030
+# blake2b-generic.c:5: static inline u64 ror64(unsigned l, u64 x) { return (x >> l) | (x << (64-l)); }
+	.loc 1 5 62 is_stmt 0 view .LVU4031
+	rorq	$24, %r12	#, _2280
+.LVL716:
+	.loc 1 5 62 view .LVU4032
+.LBE1572:
+.LBE1571:
+# blake2b-generic.c:49:     FULLROUND(11);
+	.loc 1 49 1468 view .LVU4033
+	movq	%r12, 40(%rax)	# _2280, MEM[(u64 *)v_1170(D) + 40B]
+	.loc 1 49 1500 is_stmt 1 view .LVU4034
+# blake2b-generic.c:49:     FULLROUND(11);
+	.loc 1 49 1508 is_stmt 0 view .LVU4035
+	addq	96(%r9), %rdi	# MEM[(const u64 *)m_1171(D) + 96B], tmp2384
+	addq	%r12, %rdi	# _2280, _1129
+	movq	%rdi, (%rax)	# _1129, *v_1170(D)
+	.loc 1 49 1557 is_stmt 1 view .LVU4036
+.LVL717:
+.LBB1573:
+.LBI1573:
+	.loc 1 5 19 view .LVU4037
+.LBB1574:
+	.loc 1 5 46 view .LVU4038
+.LBE1574:
+.LBE1573:
+# blake2b-generic.c:49:     FULLROUND(11);
+	.loc 1 49 1567 is_stmt 0 view .LVU4039
+	xorq	%r13, %rdi	# _2277, tmp2386
+.LVL718:
+.LBB1576:
+.LBB1575:
+# blake2b-generic.c:5: static inline u64 ror64(unsigned l, u64 x) { return (x >> l) | (x << (64-l)); }
+	.loc 1 5 62 view .LVU4040
+	rorq	$16, %rdi	#, _2283
+.LVL719:
+	.loc 1 5 62 view .LVU4041
+.LBE1575:
+.LBE1576:
+# blake2b-generic.c:49:     FULLROUND(11);
+	.loc 1 49 1605 view .LVU4042
+	addq	%rdi, %r15	# _2283, _1131
+# blake2b-generic.c:49:     FULLROUND(11);
+	.loc 1 49 1565 view .LVU4043
+	movq	%rdi, 120(%rax)	# _2283, MEM[(u64 *)v_1170(D) + 120B]
+	.loc 1 49 1597 is_stmt 1 view .LVU4044
+# blake2b-generic.c:49:     FULLROUND(11);
+	.loc 1 49 1743 is_stmt 0 view .LVU4045
+	movq	-56(%rsp), %rdi	# %sfp, _2235
+# blake2b-generic.c:49:     FULLROUND(11);
+	.loc 1 49 1605 view .LVU4046
+	movq	%r15, 80(%rax)	# _1131, MEM[(u64 *)v_1170(D) + 80B]
+	.loc 1 49 1617 is_stmt 1 view .LVU4047
+.LVL720:
+.LBB1577:
+.LBI1577:
+	.loc 1 5 19 view .LVU4048
+.LBB1578:
+	.loc 1 5 46 view .LVU4049
+	.loc 1 5 46 is_stmt 0 view .LVU4050
+.LBE1578:
+.LBE1577:
+# blake2b-generic.c:49:     FULLROUND(11);
+	.loc 1 49 1627 view .LVU4051
+	xorq	%r12, %r15	# _2280, tmp2387
+.LBB1580:
+.LBB1579:
+# blake2b-generic.c:5: static inline u64 ror64(unsigned l, u64 x) { return (x >> l) | (x << (64-l)); }
+	.loc 1 5 62 view .LVU4052
+	rolq	%r15	# tmp2388
+	movq	%r15, 40(%rax)	# tmp2388, MEM[(u64 *)v_1170(D) + 40B]
+.LBE1579:
+.LBE1580:
+	.loc 1 49 1341 is_stmt 1 view .LVU4053
+	.loc 1 49 1670 view .LVU4054
+	.loc 1 49 1675 view .LVU4055
+# blake2b-generic.c:49:     FULLROUND(11);
+	.loc 1 49 1683 is_stmt 0 view .LVU4056
+	addq	(%r9), %rsi	# *m_1171(D), tmp2389
+	addq	%rbp, %rsi	# _2262, _1135
+# blake2b-generic.c:49:     FULLROUND(11);
+	.loc 1 49 1743 view .LVU4057
+	xorq	%rsi, %rdi	# _1135, _2235
+# blake2b-generic.c:49:     FULLROUND(11);
+	.loc 1 49 1683 view .LVU4058
+	movq	%rsi, 8(%rax)	# _1135, MEM[(u64 *)v_1170(D) + 8B]
+	.loc 1 49 1733 is_stmt 1 view .LVU4059
+.LVL721:
+.LBB1581:
+.LBI1581:
+	.loc 1 5 19 view .LVU4060
+.LBB1582:
+	.loc 1 5 46 view .LVU4061
+# blake2b-generic.c:5: static inline u64 ror64(unsigned l, u64 x) { return (x >> l) | (x << (64-l)); }
+	.loc 1 5 62 is_stmt 0 view .LVU4062
+	rolq	$32, %rdi	#, _2289
+.LVL722:
+	.loc 1 5 62 view .LVU4063
+.LBE1582:
+.LBE1581:
+# blake2b-generic.c:49:     FULLROUND(11);
+	.loc 1 49 1781 view .LVU4064
+	addq	%rdi, %r14	# _2289, _1137
+# blake2b-generic.c:49:     FULLROUND(11);
+	.loc 1 49 1741 view .LVU4065
+	movq	%rdi, 96(%rax)	# _2289, MEM[(u64 *)v_1170(D) + 96B]
+	.loc 1 49 1773 is_stmt 1 view .LVU4066
+# blake2b-generic.c:49:     FULLROUND(11);
+	.loc 1 49 1803 is_stmt 0 view .LVU4067
+	xorq	%r14, %rbp	# _1137, tmp2392
+# blake2b-generic.c:49:     FULLROUND(11);
+	.loc 1 49 1781 view .LVU4068
+	movq	%r14, 88(%rax)	# _1137, MEM[(u64 *)v_1170(D) + 88B]
+	.loc 1 49 1793 is_stmt 1 view .LVU4069
+.LVL723:
+.LBB1583:
+.LBI1583:
+	.loc 1 5 19 view .LVU4070
+.LBB1584:
+	.loc 1 5 46 view .LVU4071
+# blake2b-generic.c:5: static inline u64 ror64(unsigned l, u64 x) { return (x >> l) | (x << (64-l)); }
+	.loc 1 5 62 is_stmt 0 view .LVU4072
+	rorq	$24, %rbp	#, _2292
+.LVL724:
+	.loc 1 5 62 view .LVU4073
+.LBE1584:
+.LBE1583:
+# blake2b-generic.c:49:     FULLROUND(11);
+	.loc 1 49 1801 view .LVU4074
+	movq	%rbp, 48(%rax)	# _2292, MEM[(u64 *)v_1170(D) + 48B]
+	.loc 1 49 1833 is_stmt 1 view .LVU4075
+# blake2b-generic.c:49:     FULLROUND(11);
+	.loc 1 49 1841 is_stmt 0 view .LVU4076
+	addq	16(%r9), %rsi	# MEM[(const u64 *)m_1171(D) + 16B], tmp2393
+	addq	%rbp, %rsi	# _2292, _1141
+	movq	%rsi, 8(%rax)	# _1141, MEM[(u64 *)v_1170(D) + 8B]
+	.loc 1 49 1891 is_stmt 1 view .LVU4077
+.LVL725:
+.LBB1585:
+.LBI1585:
+	.loc 1 5 19 view .LVU4078
+.LBB1586:
+	.loc 1 5 46 view .LVU4079
+.LBE1586:
+.LBE1585:
+# blake2b-generic.c:49:     FULLROUND(11);
+	.loc 1 49 1901 is_stmt 0 view .LVU4080
+	xorq	%rdi, %rsi	# _2289, tmp2395
+.LVL726:
+.LBB1588:
+.LBB1587:
+# blake2b-generic.c:5: static inline u64 ror64(unsigned l, u64 x) { return (x >> l) | (x << (64-l)); }
+	.loc 1 5 62 view .LVU4081
+	rorq	$16, %rsi	#, _2295
+.LVL727:
+	.loc 1 5 62 view .LVU4082
+.LBE1587:
+.LBE1588:
+# blake2b-generic.c:49:     FULLROUND(11);
+	.loc 1 49 1939 view .LVU4083
+	addq	%rsi, %r14	# _2295, _1143
+# blake2b-generic.c:49:     FULLROUND(11);
+	.loc 1 49 1899 view .LVU4084
+	movq	%rsi, 96(%rax)	# _2295, MEM[(u64 *)v_1170(D) + 96B]
+	.loc 1 49 1931 is_stmt 1 view .LVU4085
+# blake2b-generic.c:49:     FULLROUND(11);
+	.loc 1 49 2115 is_stmt 0 view .LVU4086
+	movq	-80(%rsp), %rsi	# %sfp, _1083
+# blake2b-generic.c:49:     FULLROUND(11);
+	.loc 1 49 1939 view .LVU4087
+	movq	%r14, 88(%rax)	# _1143, MEM[(u64 *)v_1170(D) + 88B]
+	.loc 1 49 1951 is_stmt 1 view .LVU4088
+.LVL728:
+.LBB1589:
+.LBI1589:
+	.loc 1 5 19 view .LVU4089
+.LBB1590:
+	.loc 1 5 46 view .LVU4090
+	.loc 1 5 46 is_stmt 0 view .LVU4091
+.LBE1590:
+.LBE1589:
+# blake2b-generic.c:49:     FULLROUND(11);
+	.loc 1 49 1961 view .LVU4092
+	xorq	%rbp, %r14	# _2292, tmp2396
+.LBB1592:
+.LBB1591:
+# blake2b-generic.c:5: static inline u64 ror64(unsigned l, u64 x) { return (x >> l) | (x << (64-l)); }
+	.loc 1 5 62 view .LVU4093
+	rolq	%r14	# tmp2397
+	movq	%r14, 48(%rax)	# tmp2397, MEM[(u64 *)v_1170(D) + 48B]
+.LBE1591:
+.LBE1592:
+	.loc 1 49 1673 is_stmt 1 view .LVU4094
+	.loc 1 49 2004 view .LVU4095
+	.loc 1 49 2009 view .LVU4096
+# blake2b-generic.c:49:     FULLROUND(11);
+	.loc 1 49 2017 is_stmt 0 view .LVU4097
+	addq	88(%r9), %rcx	# MEM[(const u64 *)m_1171(D) + 88B], tmp2398
+	addq	%rbx, %rcx	# _2274, _1147
+# blake2b-generic.c:49:     FULLROUND(11);
+	.loc 1 49 2077 view .LVU4098
+	xorq	%rcx, %r8	# _1147, tmp2400
+# blake2b-generic.c:49:     FULLROUND(11);
+	.loc 1 49 2017 view .LVU4099
+	movq	%rcx, 16(%rax)	# _1147, MEM[(u64 *)v_1170(D) + 16B]
+	.loc 1 49 2067 is_stmt 1 view .LVU4100
+.LVL729:
+.LBB1593:
+.LBI1593:
+	.loc 1 5 19 view .LVU4101
+.LBB1594:
+	.loc 1 5 46 view .LVU4102
+# blake2b-generic.c:5: static inline u64 ror64(unsigned l, u64 x) { return (x >> l) | (x << (64-l)); }
+	.loc 1 5 62 is_stmt 0 view .LVU4103
+	rolq	$32, %r8	#, _2301
+.LVL730:
+	.loc 1 5 62 view .LVU4104
+.LBE1594:
+.LBE1593:
+# blake2b-generic.c:49:     FULLROUND(11);
+	.loc 1 49 2115 view .LVU4105
+	addq	%r8, %rsi	# _2301, _1149
+# blake2b-generic.c:49:     FULLROUND(11);
+	.loc 1 49 2075 view .LVU4106
+	movq	%r8, 104(%rax)	# _2301, MEM[(u64 *)v_1170(D) + 104B]
+	.loc 1 49 2107 is_stmt 1 view .LVU4107
+# blake2b-generic.c:49:     FULLROUND(11);
+	.loc 1 49 2137 is_stmt 0 view .LVU4108
+	xorq	%rsi, %rbx	# _1149, tmp2401
+# blake2b-generic.c:49:     FULLROUND(11);
+	.loc 1 49 2115 view .LVU4109
+	movq	%rsi, 64(%rax)	# _1149, MEM[(u64 *)v_1170(D) + 64B]
+	.loc 1 49 2127 is_stmt 1 view .LVU4110
+.LVL731:
+.LBB1595:
+.LBI1595:
+	.loc 1 5 19 view .LVU4111
+.LBB1596:
+	.loc 1 5 46 view .LVU4112
+# blake2b-generic.c:5: static inline u64 ror64(unsigned l, u64 x) { return (x >> l) | (x << (64-l)); }
+	.loc 1 5 62 is_stmt 0 view .LVU4113
+	rorq	$24, %rbx	#, _2304
+.LVL732:
+	.loc 1 5 62 view .LVU4114
+.LBE1596:
+.LBE1595:
+# blake2b-generic.c:49:     FULLROUND(11);
+	.loc 1 49 2135 view .LVU4115
+	movq	%rbx, 56(%rax)	# _2304, MEM[(u64 *)v_1170(D) + 56B]
+	.loc 1 49 2167 is_stmt 1 view .LVU4116
+# blake2b-generic.c:49:     FULLROUND(11);
+	.loc 1 49 2175 is_stmt 0 view .LVU4117
+	addq	56(%r9), %rcx	# MEM[(const u64 *)m_1171(D) + 56B], tmp2402
+	addq	%rbx, %rcx	# _2304, _1153
+	movq	%rcx, 16(%rax)	# _1153, MEM[(u64 *)v_1170(D) + 16B]
+	.loc 1 49 2225 is_stmt 1 view .LVU4118
+.LVL733:
+.LBB1597:
+.LBI1597:
+	.loc 1 5 19 view .LVU4119
+.LBB1598:
+	.loc 1 5 46 view .LVU4120
+.LBE1598:
+.LBE1597:
+# blake2b-generic.c:49:     FULLROUND(11);
+	.loc 1 49 2235 is_stmt 0 view .LVU4121
+	xorq	%r8, %rcx	# _2301, tmp2404
+.LVL734:
+.LBB1600:
+.LBB1599:
+# blake2b-generic.c:5: static inline u64 ror64(unsigned l, u64 x) { return (x >> l) | (x << (64-l)); }
+	.loc 1 5 62 view .LVU4122
+	rorq	$16, %rcx	#, _2307
+.LVL735:
+	.loc 1 5 62 view .LVU4123
+.LBE1599:
+.LBE1600:
+# blake2b-generic.c:49:     FULLROUND(11);
+	.loc 1 49 2273 view .LVU4124
+	addq	%rcx, %rsi	# _2307, _1155
+# blake2b-generic.c:49:     FULLROUND(11);
+	.loc 1 49 2233 view .LVU4125
+	movq	%rcx, 104(%rax)	# _2307, MEM[(u64 *)v_1170(D) + 104B]
+	.loc 1 49 2265 is_stmt 1 view .LVU4126
+# blake2b-generic.c:49:     FULLROUND(11);
+	.loc 1 49 2351 is_stmt 0 view .LVU4127
+	movq	-48(%rsp), %rcx	# %sfp, _2238
+# blake2b-generic.c:49:     FULLROUND(11);
+	.loc 1 49 2273 view .LVU4128
+	movq	%rsi, 64(%rax)	# _1155, MEM[(u64 *)v_1170(D) + 64B]
+	.loc 1 49 2285 is_stmt 1 view .LVU4129
+.LVL736:
+.LBB1601:
+.LBI1601:
+	.loc 1 5 19 view .LVU4130
+.LBB1602:
+	.loc 1 5 46 view .LVU4131
+	.loc 1 5 46 is_stmt 0 view .LVU4132
+.LBE1602:
+.LBE1601:
+# blake2b-generic.c:49:     FULLROUND(11);
+	.loc 1 49 2295 view .LVU4133
+	xorq	%rbx, %rsi	# _2304, tmp2405
+# blake2b-generic.c:50: }
+	.loc 1 50 1 view .LVU4134
+	popq	%rbx	#
+	.cfi_def_cfa_offset 48
+.LBB1605:
+.LBB1603:
+# blake2b-generic.c:5: static inline u64 ror64(unsigned l, u64 x) { return (x >> l) | (x << (64-l)); }
+	.loc 1 5 62 view .LVU4135
+	rolq	%rsi	# tmp2406
+.LBE1603:
+.LBE1605:
+# blake2b-generic.c:50: }
+	.loc 1 50 1 view .LVU4136
+	popq	%rbp	#
+	.cfi_def_cfa_offset 40
+	popq	%r12	#
+	.cfi_def_cfa_offset 32
+.LBB1606:
+.LBB1604:
+# blake2b-generic.c:5: static inline u64 ror64(unsigned l, u64 x) { return (x >> l) | (x << (64-l)); }
+	.loc 1 5 62 view .LVU4137
+	movq	%rsi, 56(%rax)	# tmp2406, MEM[(u64 *)v_1170(D) + 56B]
+.LBE1604:
+.LBE1606:
+	.loc 1 49 2007 is_stmt 1 view .LVU4138
+	.loc 1 49 2338 view .LVU4139
+	.loc 1 49 2343 view .LVU4140
+# blake2b-generic.c:49:     FULLROUND(11);
+	.loc 1 49 2351 is_stmt 0 view .LVU4141
+	addq	40(%r9), %rdx	# MEM[(const u64 *)m_1171(D) + 40B], tmp2407
+	addq	%rcx, %rdx	# _2238, _1159
+# blake2b-generic.c:50: }
+	.loc 1 50 1 view .LVU4142
+	popq	%r13	#
+	.cfi_def_cfa_offset 24
+	popq	%r14	#
+	.cfi_def_cfa_offset 16
+# blake2b-generic.c:49:     FULLROUND(11);
+	.loc 1 49 2411 view .LVU4143
+	xorq	%rdx, %r10	# _1159, tmp2409
+# blake2b-generic.c:49:     FULLROUND(11);
+	.loc 1 49 2351 view .LVU4144
+	movq	%rdx, 24(%rax)	# _1159, MEM[(u64 *)v_1170(D) + 24B]
+	.loc 1 49 2401 is_stmt 1 view .LVU4145
+.LVL737:
+.LBB1607:
+.LBI1607:
+	.loc 1 5 19 view .LVU4146
+.LBB1608:
+	.loc 1 5 46 view .LVU4147
+.LBE1608:
+.LBE1607:
+# blake2b-generic.c:50: }
+	.loc 1 50 1 is_stmt 0 view .LVU4148
+	popq	%r15	#
+	.cfi_def_cfa_offset 8
+.LBB1610:
+.LBB1609:
+# blake2b-generic.c:5: static inline u64 ror64(unsigned l, u64 x) { return (x >> l) | (x << (64-l)); }
+	.loc 1 5 62 view .LVU4149
+	rolq	$32, %r10	#, _2313
+.LVL738:
+	.loc 1 5 62 view .LVU4150
+.LBE1609:
+.LBE1610:
+# blake2b-generic.c:49:     FULLROUND(11);
+	.loc 1 49 2449 view .LVU4151
+	addq	%r10, %r11	# _2313, _1161
+# blake2b-generic.c:49:     FULLROUND(11);
+	.loc 1 49 2409 view .LVU4152
+	movq	%r10, 112(%rax)	# _2313, MEM[(u64 *)v_1170(D) + 112B]
+	.loc 1 49 2441 is_stmt 1 view .LVU4153
+# blake2b-generic.c:49:     FULLROUND(11);
+	.loc 1 49 2471 is_stmt 0 view .LVU4154
+	xorq	%r11, %rcx	# _1161, _2238
+# blake2b-generic.c:49:     FULLROUND(11);
+	.loc 1 49 2449 view .LVU4155
+	movq	%r11, 72(%rax)	# _1161, MEM[(u64 *)v_1170(D) + 72B]
+	.loc 1 49 2461 is_stmt 1 view .LVU4156
+.LVL739:
+.LBB1611:
+.LBI1611:
+	.loc 1 5 19 view .LVU4157
+.LBB1612:
+	.loc 1 5 46 view .LVU4158
+# blake2b-generic.c:5: static inline u64 ror64(unsigned l, u64 x) { return (x >> l) | (x << (64-l)); }
+	.loc 1 5 62 is_stmt 0 view .LVU4159
+	rorq	$24, %rcx	#, _2316
+.LVL740:
+	.loc 1 5 62 view .LVU4160
+.LBE1612:
+.LBE1611:
+# blake2b-generic.c:49:     FULLROUND(11);
+	.loc 1 49 2469 view .LVU4161
+	movq	%rcx, 32(%rax)	# _2316, MEM[(u64 *)v_1170(D) + 32B]
+	.loc 1 49 2501 is_stmt 1 view .LVU4162
+# blake2b-generic.c:49:     FULLROUND(11);
+	.loc 1 49 2509 is_stmt 0 view .LVU4163
+	addq	24(%r9), %rdx	# MEM[(const u64 *)m_1171(D) + 24B], tmp2411
+	addq	%rcx, %rdx	# _2316, _1165
+	movq	%rdx, 24(%rax)	# _1165, MEM[(u64 *)v_1170(D) + 24B]
+	.loc 1 49 2559 is_stmt 1 view .LVU4164
+.LVL741:
+.LBB1613:
+.LBI1613:
+	.loc 1 5 19 view .LVU4165
+.LBB1614:
+	.loc 1 5 46 view .LVU4166
+.LBE1614:
+.LBE1613:
+# blake2b-generic.c:49:     FULLROUND(11);
+	.loc 1 49 2569 is_stmt 0 view .LVU4167
+	xorq	%r10, %rdx	# _2313, tmp2413
+.LVL742:
+.LBB1616:
+.LBB1615:
+# blake2b-generic.c:5: static inline u64 ror64(unsigned l, u64 x) { return (x >> l) | (x << (64-l)); }
+	.loc 1 5 62 view .LVU4168
+	rorq	$16, %rdx	#, _2319
+.LVL743:
+	.loc 1 5 62 view .LVU4169
+.LBE1615:
+.LBE1616:
+# blake2b-generic.c:49:     FULLROUND(11);
+	.loc 1 49 2607 view .LVU4170
+	addq	%rdx, %r11	# _2319, _1167
+# blake2b-generic.c:49:     FULLROUND(11);
+	.loc 1 49 2567 view .LVU4171
+	movq	%rdx, 112(%rax)	# _2319, MEM[(u64 *)v_1170(D) + 112B]
+	.loc 1 49 2599 is_stmt 1 view .LVU4172
+# blake2b-generic.c:49:     FULLROUND(11);
+	.loc 1 49 2607 is_stmt 0 view .LVU4173
+	movq	%r11, 72(%rax)	# _1167, MEM[(u64 *)v_1170(D) + 72B]
+	.loc 1 49 2619 is_stmt 1 view .LVU4174
+.LVL744:
+.LBB1617:
+.LBI1617:
+	.loc 1 5 19 view .LVU4175
+.LBB1618:
+	.loc 1 5 46 view .LVU4176
+	.loc 1 5 46 is_stmt 0 view .LVU4177
+.LBE1618:
+.LBE1617:
+# blake2b-generic.c:49:     FULLROUND(11);
+	.loc 1 49 2629 view .LVU4178
+	xorq	%rcx, %r11	# _2316, tmp2414
+.LBB1620:
+.LBB1619:
+# blake2b-generic.c:5: static inline u64 ror64(unsigned l, u64 x) { return (x >> l) | (x << (64-l)); }
+	.loc 1 5 62 view .LVU4179
+	rolq	%r11	# tmp2415
+	movq	%r11, 32(%rax)	# tmp2415, MEM[(u64 *)v_1170(D) + 32B]
+.LBE1619:
+.LBE1620:
+	.loc 1 49 2341 is_stmt 1 view .LVU4180
+	.loc 1 49 8 view .LVU4181
+# blake2b-generic.c:50: }
+	.loc 1 50 1 is_stmt 0 view .LVU4182
+	ret	
+	.cfi_endproc
+.LFE26:
+	.size	blake2b_12rounds, .-blake2b_12rounds
+	.p2align 4
+	.globl	blake2b_compress_generic
+	.type	blake2b_compress_generic, @function
+blake2b_compress_generic:
+.LVL745:
+.LFB28:
+	.loc 1 75 1 is_stmt 1 view -0
+	.cfi_startproc
+	.loc 1 76 5 view .LVU4184
+# blake2b-generic.c:75: {
+	.loc 1 75 1 is_stmt 0 view .LVU4185
+	pushq	%rbx	#
+	.cfi_def_cfa_offset 16
+	.cfi_offset 3, -16
+	movq	%rdi, %rbx	# tmp151, ctx
+.LVL746:
+.LBB1632:
+.LBI1632:
+	.loc 1 52 20 is_stmt 1 view .LVU4186
+.LBB1633:
+	.loc 1 55 5 view .LVU4187
+	.loc 1 56 5 view .LVU4188
+	.loc 1 57 5 view .LVU4189
+.LBB1634:
+	.loc 1 57 10 view .LVU4190
+	.loc 1 57 28 view .LVU4191
+	.loc 1 57 28 is_stmt 0 view .LVU4192
+.LBE1634:
+.LBE1633:
+.LBE1632:
+# blake2b-generic.c:75: {
+	.loc 1 75 1 view .LVU4193
+	subq	$256, %rsp	#,
+	.cfi_def_cfa_offset 272
+.LBB1652:
+.LBB1651:
+.LBB1635:
+# blake2b-generic.c:58:         m[i] = read_le64((const unsigned char *)msg + i*8);
+	.loc 1 58 14 view .LVU4194
+	movdqu	(%rsi), %xmm2	# MEM <char[1:128]> [(void *)msg_6(D)], tmp154
+	movdqu	16(%rsi), %xmm3	# MEM <char[1:128]> [(void *)msg_6(D)], tmp155
+	movdqu	32(%rsi), %xmm4	# MEM <char[1:128]> [(void *)msg_6(D)], tmp156
+	movdqu	48(%rsi), %xmm5	# MEM <char[1:128]> [(void *)msg_6(D)], tmp157
+.LBE1635:
+.LBB1636:
+# blake2b-generic.c:60:         v[i] = H[i];
+	.loc 1 60 14 view .LVU4195
+	movq	%rsp, %rdi	#, tmp118
+.LVL747:
+	.loc 1 60 14 view .LVU4196
+.LBE1636:
+.LBB1637:
+# blake2b-generic.c:58:         m[i] = read_le64((const unsigned char *)msg + i*8);
+	.loc 1 58 14 view .LVU4197
+	leaq	128(%rsp), %rax	#, tmp109
+	movdqu	64(%rsi), %xmm6	# MEM <char[1:128]> [(void *)msg_6(D)], tmp158
+	movdqu	80(%rsi), %xmm7	# MEM <char[1:128]> [(void *)msg_6(D)], tmp159
+	movaps	%xmm2, 128(%rsp)	# tmp154, MEM <char[1:128]> [(void *)&m]
+	movaps	%xmm3, 144(%rsp)	# tmp155, MEM <char[1:128]> [(void *)&m]
+	movdqu	96(%rsi), %xmm2	# MEM <char[1:128]> [(void *)msg_6(D)], tmp160
+	movdqu	112(%rsi), %xmm3	# MEM <char[1:128]> [(void *)msg_6(D)], tmp161
+.LBE1637:
+# blake2b-generic.c:68:     blake2b_12rounds(v, m);
+	.loc 1 68 5 view .LVU4198
+	movq	%rax, %rsi	# tmp109,
+.LVL748:
+.LBB1638:
+# blake2b-generic.c:58:         m[i] = read_le64((const unsigned char *)msg + i*8);
+	.loc 1 58 14 view .LVU4199
+	movaps	%xmm4, 160(%rsp)	# tmp156, MEM <char[1:128]> [(void *)&m]
+.LBE1638:
+.LBB1639:
+# blake2b-generic.c:60:         v[i] = H[i];
+	.loc 1 60 14 view .LVU4200
+	movdqu	(%rbx), %xmm4	# MEM <char[1:64]> [(void *)ctx_4(D)], tmp162
+.LBE1639:
+# blake2b-generic.c:63:     v[12] ^= t[0];
+	.loc 1 63 11 view .LVU4201
+	movdqu	208(%rbx), %xmm0	# MEM <const vector(2) long unsigned int> [(const u64 *)ctx_4(D) + 208B], vect__29.37
+.LBB1640:
+# blake2b-generic.c:58:         m[i] = read_le64((const unsigned char *)msg + i*8);
+	.loc 1 58 14 view .LVU4202
+	movaps	%xmm5, 176(%rsp)	# tmp157, MEM <char[1:128]> [(void *)&m]
+.LBE1640:
+.LBB1641:
+# blake2b-generic.c:60:         v[i] = H[i];
+	.loc 1 60 14 view .LVU4203
+	movdqu	16(%rbx), %xmm5	# MEM <char[1:64]> [(void *)ctx_4(D)], tmp163
+.LBE1641:
+# blake2b-generic.c:63:     v[12] ^= t[0];
+	.loc 1 63 11 view .LVU4204
+	pxor	.LC0(%rip), %xmm0	#, vect__29.37
+.LBB1642:
+# blake2b-generic.c:58:         m[i] = read_le64((const unsigned char *)msg + i*8);
+	.loc 1 58 14 view .LVU4205
+	movaps	%xmm6, 192(%rsp)	# tmp158, MEM <char[1:128]> [(void *)&m]
+.LBE1642:
+.LBB1643:
+# blake2b-generic.c:60:         v[i] = H[i];
+	.loc 1 60 14 view .LVU4206
+	movdqu	32(%rbx), %xmm6	# MEM <char[1:64]> [(void *)ctx_4(D)], tmp164
+.LBE1643:
+.LBB1644:
+# blake2b-generic.c:58:         m[i] = read_le64((const unsigned char *)msg + i*8);
+	.loc 1 58 14 view .LVU4207
+	movaps	%xmm7, 208(%rsp)	# tmp159, MEM <char[1:128]> [(void *)&m]
+.LBE1644:
+.LBB1645:
+# blake2b-generic.c:60:         v[i] = H[i];
+	.loc 1 60 14 view .LVU4208
+	movdqu	48(%rbx), %xmm7	# MEM <char[1:64]> [(void *)ctx_4(D)], tmp165
+.LBE1645:
+.LBB1646:
+# blake2b-generic.c:58:         m[i] = read_le64((const unsigned char *)msg + i*8);
+	.loc 1 58 14 view .LVU4209
+	movaps	%xmm2, 224(%rsp)	# tmp160, MEM <char[1:128]> [(void *)&m]
+.LBE1646:
+.LBB1647:
+# blake2b-generic.c:61:         v[i+8] = blake2b_iv[i];
+	.loc 1 61 16 view .LVU4210
+	movdqa	blake2b_iv(%rip), %xmm2	# MEM <unsigned char[64]> [(char * {ref-all})&blake2b_iv], tmp166
+.LBE1647:
+.LBB1648:
+# blake2b-generic.c:58:         m[i] = read_le64((const unsigned char *)msg + i*8);
+	.loc 1 58 14 view .LVU4211
+	movaps	%xmm3, 240(%rsp)	# tmp161, MEM <char[1:128]> [(void *)&m]
+.LBE1648:
+.LBB1649:
+# blake2b-generic.c:61:         v[i+8] = blake2b_iv[i];
+	.loc 1 61 16 view .LVU4212
+	movdqa	16+blake2b_iv(%rip), %xmm3	# MEM <unsigned char[64]> [(char * {ref-all})&blake2b_iv], tmp167
+# blake2b-generic.c:60:         v[i] = H[i];
+	.loc 1 60 14 view .LVU4213
+	movaps	%xmm4, (%rsp)	# tmp162, MEM <char[1:64]> [(void *)&v]
+	movaps	%xmm5, 16(%rsp)	# tmp163, MEM <char[1:64]> [(void *)&v]
+	movaps	%xmm6, 32(%rsp)	# tmp164, MEM <char[1:64]> [(void *)&v]
+	movaps	%xmm7, 48(%rsp)	# tmp165, MEM <char[1:64]> [(void *)&v]
+# blake2b-generic.c:61:         v[i+8] = blake2b_iv[i];
+	.loc 1 61 16 view .LVU4214
+	movaps	%xmm2, 64(%rsp)	# tmp166, MEM <unsigned char[64]> [(char * {ref-all})&v + 64B]
+	movaps	%xmm3, 80(%rsp)	# tmp167, MEM <unsigned char[64]> [(char * {ref-all})&v + 64B]
+.LBE1649:
+	.loc 1 63 5 is_stmt 1 view .LVU4215
+	.loc 1 64 5 view .LVU4216
+	.loc 1 65 5 view .LVU4217
+	.loc 1 66 5 view .LVU4218
+# blake2b-generic.c:63:     v[12] ^= t[0];
+	.loc 1 63 11 is_stmt 0 view .LVU4219
+	movdqu	192(%rbx), %xmm1	# MEM <const vector(2) long unsigned int> [(const u64 *)ctx_4(D) + 192B], vect__29.37
+	pxor	.LC1(%rip), %xmm1	#, vect__29.37
+	movaps	%xmm0, 112(%rsp)	# vect__29.37, MEM <vector(2) long unsigned int> [(long unsigned int *)&v + 112B]
+	.loc 1 68 5 is_stmt 1 view .LVU4220
+# blake2b-generic.c:63:     v[12] ^= t[0];
+	.loc 1 63 11 is_stmt 0 view .LVU4221
+	movaps	%xmm1, 96(%rsp)	# vect__29.37, MEM <vector(2) long unsigned int> [(long unsigned int *)&v + 96B]
+# blake2b-generic.c:68:     blake2b_12rounds(v, m);
+	.loc 1 68 5 view .LVU4222
+	call	blake2b_12rounds	#
+.LVL749:
+	.loc 1 70 5 is_stmt 1 view .LVU4223
+.LBB1650:
+	.loc 1 70 10 view .LVU4224
+	.loc 1 70 28 view .LVU4225
+	.loc 1 71 9 view .LVU4226
+# blake2b-generic.c:71:         H[i] ^= v[i] ^ v[i+8];
+	.loc 1 71 14 is_stmt 0 view .LVU4227
+	movdqu	(%rbx), %xmm4	# MEM <vector(2) long unsigned int> [(u64 *)ctx_4(D)], tmp171
+# blake2b-generic.c:71:         H[i] ^= v[i] ^ v[i+8];
+	.loc 1 71 22 view .LVU4228
+	movdqa	(%rsp), %xmm0	# MEM <vector(2) long unsigned int> [(long unsigned int *)&v], vect__47.27
+	pxor	64(%rsp), %xmm0	# MEM <vector(2) long unsigned int> [(long unsigned int *)&v + 64B], vect__47.27
+# blake2b-generic.c:71:         H[i] ^= v[i] ^ v[i+8];
+	.loc 1 71 14 view .LVU4229
+	movdqu	16(%rbx), %xmm5	# MEM <vector(2) long unsigned int> [(u64 *)ctx_4(D) + 16B], tmp173
+	movdqu	32(%rbx), %xmm6	# MEM <vector(2) long unsigned int> [(u64 *)ctx_4(D) + 32B], tmp175
+	movdqu	48(%rbx), %xmm7	# MEM <vector(2) long unsigned int> [(u64 *)ctx_4(D) + 48B], tmp177
+	pxor	%xmm4, %xmm0	# tmp171, vect__48.28
+	movups	%xmm0, (%rbx)	# vect__48.28, MEM <vector(2) long unsigned int> [(u64 *)ctx_4(D)]
+	.loc 1 70 34 is_stmt 1 view .LVU4230
+	.loc 1 70 28 view .LVU4231
+	.loc 1 71 9 view .LVU4232
+# blake2b-generic.c:71:         H[i] ^= v[i] ^ v[i+8];
+	.loc 1 71 22 is_stmt 0 view .LVU4233
+	movdqa	80(%rsp), %xmm0	# MEM <vector(2) long unsigned int> [(long unsigned int *)&v + 80B], vect__47.27
+	pxor	16(%rsp), %xmm0	# MEM <vector(2) long unsigned int> [(long unsigned int *)&v + 16B], vect__47.27
+# blake2b-generic.c:71:         H[i] ^= v[i] ^ v[i+8];
+	.loc 1 71 14 view .LVU4234
+	pxor	%xmm5, %xmm0	# tmp173, vect__48.28
+	movups	%xmm0, 16(%rbx)	# vect__48.28, MEM <vector(2) long unsigned int> [(u64 *)ctx_4(D) + 16B]
+	.loc 1 70 34 is_stmt 1 view .LVU4235
+	.loc 1 70 28 view .LVU4236
+	.loc 1 71 9 view .LVU4237
+# blake2b-generic.c:71:         H[i] ^= v[i] ^ v[i+8];
+	.loc 1 71 22 is_stmt 0 view .LVU4238
+	movdqa	96(%rsp), %xmm0	# MEM <vector(2) long unsigned int> [(long unsigned int *)&v + 96B], vect__47.27
+	pxor	32(%rsp), %xmm0	# MEM <vector(2) long unsigned int> [(long unsigned int *)&v + 32B], vect__47.27
+# blake2b-generic.c:71:         H[i] ^= v[i] ^ v[i+8];
+	.loc 1 71 14 view .LVU4239
+	pxor	%xmm6, %xmm0	# tmp175, vect__48.28
+	movups	%xmm0, 32(%rbx)	# vect__48.28, MEM <vector(2) long unsigned int> [(u64 *)ctx_4(D) + 32B]
+	.loc 1 70 34 is_stmt 1 view .LVU4240
+	.loc 1 70 28 view .LVU4241
+	.loc 1 71 9 view .LVU4242
+# blake2b-generic.c:71:         H[i] ^= v[i] ^ v[i+8];
+	.loc 1 71 22 is_stmt 0 view .LVU4243
+	movdqa	112(%rsp), %xmm0	# MEM <vector(2) long unsigned int> [(long unsigned int *)&v + 112B], vect__47.27
+	pxor	48(%rsp), %xmm0	# MEM <vector(2) long unsigned int> [(long unsigned int *)&v + 48B], vect__47.27
+# blake2b-generic.c:71:         H[i] ^= v[i] ^ v[i+8];
+	.loc 1 71 14 view .LVU4244
+	pxor	%xmm7, %xmm0	# tmp177, vect__48.28
+	movups	%xmm0, 48(%rbx)	# vect__48.28, MEM <vector(2) long unsigned int> [(u64 *)ctx_4(D) + 48B]
+	.loc 1 70 34 is_stmt 1 view .LVU4245
+	.loc 1 70 28 view .LVU4246
+.LVL750:
+	.loc 1 70 28 is_stmt 0 view .LVU4247
+.LBE1650:
+.LBE1651:
+.LBE1652:
+# blake2b-generic.c:77: }
+	.loc 1 77 1 view .LVU4248
+	addq	$256, %rsp	#,
+	.cfi_def_cfa_offset 16
+	popq	%rbx	#
+	.cfi_def_cfa_offset 8
+.LVL751:
+	.loc 1 77 1 view .LVU4249
+	ret	
+	.cfi_endproc
+.LFE28:
+	.size	blake2b_compress_generic, .-blake2b_compress_generic
+	.p2align 4
+	.globl	blake2b_compress_blocks_generic
+	.type	blake2b_compress_blocks_generic, @function
+blake2b_compress_blocks_generic:
+.LVL752:
+.LFB29:
+	.loc 1 81 1 is_stmt 1 view -0
+	.cfi_startproc
+	.loc 1 81 1 is_stmt 0 view .LVU4251
+	pushq	%r15	#
+	.cfi_def_cfa_offset 16
+	.cfi_offset 15, -16
+	pushq	%r14	#
+	.cfi_def_cfa_offset 24
+	.cfi_offset 14, -24
+	pushq	%r13	#
+	.cfi_def_cfa_offset 32
+	.cfi_offset 13, -32
+	pushq	%r12	#
+	.cfi_def_cfa_offset 40
+	.cfi_offset 12, -40
+	pushq	%rbp	#
+	.cfi_def_cfa_offset 48
+	.cfi_offset 6, -48
+	movq	%rdi, %rbp	# tmp187, ctx
+	.loc 1 82 5 is_stmt 1 view .LVU4252
+.LVL753:
+	.loc 1 83 5 view .LVU4253
+	.loc 1 84 5 view .LVU4254
+.LBB1666:
+	.loc 1 84 10 view .LVU4255
+	.loc 1 84 28 view .LVU4256
+.LBE1666:
+# blake2b-generic.c:81: {
+	.loc 1 81 1 is_stmt 0 view .LVU4257
+	pushq	%rbx	#
+	.cfi_def_cfa_offset 56
+	.cfi_offset 3, -56
+	subq	$360, %rsp	#,
+	.cfi_def_cfa_offset 416
+.LBB1667:
+# blake2b-generic.c:85:         H[i] = ctx->H[i];
+	.loc 1 85 14 view .LVU4258
+	movdqu	(%rdi), %xmm6	# MEM <char[1:64]> [(void *)ctx_24(D)], tmp191
+	movdqu	16(%rdi), %xmm7	# MEM <char[1:64]> [(void *)ctx_24(D)], tmp192
+.LBE1667:
+# blake2b-generic.c:86:     t[0] = ctx->t[0];
+	.loc 1 86 18 view .LVU4259
+	movdqa	192(%rdi), %xmm1	# MEM <vector(2) long unsigned int> [(long unsigned int *)ctx_24(D) + 192B], vect__2.90
+.LBB1668:
+# blake2b-generic.c:85:         H[i] = ctx->H[i];
+	.loc 1 85 14 view .LVU4260
+	movq	(%rdi), %xmm0	# MEM <char[1:64]> [(void *)ctx_24(D)], tmp185
+.LBE1668:
+# blake2b-generic.c:81: {
+	.loc 1 81 1 view .LVU4261
+	movq	%rdx, 24(%rsp)	# nblocks, %sfp
+.LBB1669:
+# blake2b-generic.c:85:         H[i] = ctx->H[i];
+	.loc 1 85 14 view .LVU4262
+	movaps	%xmm6, 32(%rsp)	# tmp191, MEM <char[1:64]> [(void *)&H]
+	movdqu	32(%rdi), %xmm6	# MEM <char[1:64]> [(void *)ctx_24(D)], tmp193
+	movaps	%xmm7, 48(%rsp)	# tmp192, MEM <char[1:64]> [(void *)&H]
+	movdqu	48(%rdi), %xmm7	# MEM <char[1:64]> [(void *)ctx_24(D)], tmp194
+	movhlps	%xmm1, %xmm5	# vect__2.90, t$1
+	movq	%xmm5, %r14	# t$1, t$1
+	movaps	%xmm6, 64(%rsp)	# tmp193, MEM <char[1:64]> [(void *)&H]
+.LBE1669:
+.LBB1670:
+.LBB1671:
+# blake2b-generic.c:65:     v[14] ^= f[0];
+	.loc 1 65 11 view .LVU4263
+	movdqa	.LC0(%rip), %xmm5	#, tmp135
+	pxor	208(%rdi), %xmm5	# MEM <vector(2) long unsigned int> [(long unsigned int *)ctx_24(D) + 208B], vect__317.54
+.LBE1671:
+.LBE1670:
+.LBB1729:
+# blake2b-generic.c:85:         H[i] = ctx->H[i];
+	.loc 1 85 14 view .LVU4264
+	movaps	%xmm7, 80(%rsp)	# tmp194, MEM <char[1:64]> [(void *)&H]
+.LVL754:
+	.loc 1 85 14 view .LVU4265
+.LBE1729:
+	.loc 1 86 5 is_stmt 1 view .LVU4266
+	movq	%xmm1, 16(%rsp)	# _435, %sfp
+.LVL755:
+	.loc 1 87 5 view .LVU4267
+	.loc 1 88 5 view .LVU4268
+	.loc 1 89 5 view .LVU4269
+	.loc 1 90 5 view .LVU4270
+	.loc 1 90 12 view .LVU4271
+	testq	%rdx, %rdx	# nblocks
+	je	.L7	#,
+	movq	%xmm1, %rax	# vect__2.90, _435
+	movq	48(%rsp), %xmm3	# MEM[(u64 *)&H + 16B], vect_prephitmp_329.81
+	movq	64(%rsp), %xmm2	# MEM[(u64 *)&H + 32B], vect_prephitmp_329.81
+	movq	%rsi, %r12	# tmp188, msg
+	leaq	128(%rax), %r15	#, ivtmp.96
+	leaq	224(%rsp), %rax	#, tmp182
+	movq	80(%rsp), %xmm1	# MEM[(u64 *)&H + 48B], vect_prephitmp_329.81
+	movdqa	.LC2(%rip), %xmm7	#, tmp181
+	movq	%rax, (%rsp)	# tmp182, %sfp
+	leaq	96(%rsp), %rax	#, tmp184
+	movq	%rdx, %rbx	# nblocks, nblocks
+	movdqa	.LC3(%rip), %xmm6	#, tmp183
+	movq	%rax, 8(%rsp)	# tmp184, %sfp
+	movhps	40(%rsp), %xmm0	# MEM[(u64 *)&H + 8B], vect__109.83
+	movhps	56(%rsp), %xmm3	# MEM[(u64 *)&H + 24B], vect_prephitmp_329.81
+	movhps	72(%rsp), %xmm2	# MEM[(u64 *)&H + 40B], vect_prephitmp_329.81
+.LBB1730:
+.LBB1722:
+# blake2b-generic.c:63:     v[12] ^= t[0];
+	.loc 1 63 11 is_stmt 0 view .LVU4272
+	movabsq	$5840696475078001361, %r13	#, tmp159
+	movhps	88(%rsp), %xmm1	# MEM[(u64 *)&H + 56B], vect_prephitmp_329.81
+.LVL756:
+	.p2align 4,,10
+	.p2align 3
+.L8:
+	.loc 1 63 11 view .LVU4273
+.LBE1722:
+.LBE1730:
+	.loc 1 91 9 is_stmt 1 discriminator 2 view .LVU4274
+	.loc 1 92 9 discriminator 2 view .LVU4275
+.LBB1731:
+.LBB1723:
+.LBB1672:
+# blake2b-generic.c:58:         m[i] = read_le64((const unsigned char *)msg + i*8);
+	.loc 1 58 14 is_stmt 0 discriminator 2 view .LVU4276
+	movdqu	(%r12), %xmm4	# MEM <vector(2) long unsigned int> [(char * {ref-all})m_73], tmp203
+.LBE1672:
+.LBE1723:
+.LBE1731:
+# blake2b-generic.c:92:         t[1] += (t[0] < BLAKE2B_BLOCK);
+	.loc 1 92 23 discriminator 2 view .LVU4277
+	xorl	%esi, %esi	# tmp147
+	cmpq	$127, %r15	#, ivtmp.96
+.LBB1732:
+.LBB1724:
+# blake2b-generic.c:68:     blake2b_12rounds(v, m);
+	.loc 1 68 5 discriminator 2 view .LVU4278
+	movq	8(%rsp), %rdi	# %sfp,
+.LBE1724:
+.LBE1732:
+# blake2b-generic.c:92:         t[1] += (t[0] < BLAKE2B_BLOCK);
+	.loc 1 92 23 discriminator 2 view .LVU4279
+	setbe	%sil	#, tmp147
+.LBB1733:
+.LBB1725:
+.LBB1705:
+# blake2b-generic.c:60:         v[i] = H[i];
+	.loc 1 60 14 discriminator 2 view .LVU4280
+	movaps	%xmm0, 96(%rsp)	# vect__109.83, MEM <vector(2) long unsigned int> [(long unsigned int *)&v]
+.LBE1705:
+.LBE1725:
+.LBE1733:
+# blake2b-generic.c:90:     for (; nblocks; nblocks--, m += BLAKE2B_BLOCK) {
+	.loc 1 90 34 discriminator 2 view .LVU4281
+	subq	$-128, %r12	#, msg
+.LVL757:
+.LBB1734:
+.LBB1726:
+.LBB1706:
+# blake2b-generic.c:58:         m[i] = read_le64((const unsigned char *)msg + i*8);
+	.loc 1 58 14 discriminator 2 view .LVU4282
+	movaps	%xmm4, 224(%rsp)	# tmp203, MEM <vector(2) long unsigned int> [(long unsigned int *)&m]
+	movdqu	-112(%r12), %xmm4	# MEM <vector(2) long unsigned int> [(char * {ref-all})m_73 + 16B], tmp204
+.LBE1706:
+.LBE1726:
+.LBE1734:
+# blake2b-generic.c:92:         t[1] += (t[0] < BLAKE2B_BLOCK);
+	.loc 1 92 14 discriminator 2 view .LVU4283
+	addq	%rsi, %r14	# tmp147, t$1
+.LVL758:
+	.loc 1 93 9 is_stmt 1 discriminator 2 view .LVU4284
+.LBB1735:
+.LBI1670:
+	.loc 1 52 20 discriminator 2 view .LVU4285
+.LBB1727:
+	.loc 1 55 5 discriminator 2 view .LVU4286
+	.loc 1 56 5 discriminator 2 view .LVU4287
+	.loc 1 57 5 discriminator 2 view .LVU4288
+.LBB1707:
+	.loc 1 57 10 discriminator 2 view .LVU4289
+	.loc 1 57 28 discriminator 2 view .LVU4290
+	.loc 1 58 9 discriminator 2 view .LVU4291
+.LBB1673:
+.LBI1673:
+	.file 2 "blake2b-internal.h"
+	.loc 2 116 19 discriminator 2 view .LVU4292
+.LBB1674:
+	.loc 2 118 5 discriminator 2 view .LVU4293
+	.loc 2 118 5 is_stmt 0 discriminator 2 view .LVU4294
+.LBE1674:
+.LBE1673:
+	.loc 1 57 35 is_stmt 1 discriminator 2 view .LVU4295
+	.loc 1 57 28 discriminator 2 view .LVU4296
+	.loc 1 58 9 discriminator 2 view .LVU4297
+.LBB1690:
+	.loc 2 116 19 discriminator 2 view .LVU4298
+.LBB1675:
+	.loc 2 118 5 discriminator 2 view .LVU4299
+	.loc 2 118 5 is_stmt 0 discriminator 2 view .LVU4300
+.LBE1675:
+.LBE1690:
+	.loc 1 57 35 is_stmt 1 discriminator 2 view .LVU4301
+	.loc 1 57 28 discriminator 2 view .LVU4302
+	.loc 1 58 9 discriminator 2 view .LVU4303
+.LBB1691:
+	.loc 2 116 19 discriminator 2 view .LVU4304
+.LBB1676:
+	.loc 2 118 5 discriminator 2 view .LVU4305
+	.loc 2 118 5 is_stmt 0 discriminator 2 view .LVU4306
+.LBE1676:
+.LBE1691:
+	.loc 1 57 35 is_stmt 1 discriminator 2 view .LVU4307
+	.loc 1 57 28 discriminator 2 view .LVU4308
+	.loc 1 58 9 discriminator 2 view .LVU4309
+.LBB1692:
+	.loc 2 116 19 discriminator 2 view .LVU4310
+.LBB1677:
+	.loc 2 118 5 discriminator 2 view .LVU4311
+	.loc 2 118 5 is_stmt 0 discriminator 2 view .LVU4312
+.LBE1677:
+.LBE1692:
+	.loc 1 57 35 is_stmt 1 discriminator 2 view .LVU4313
+	.loc 1 57 28 discriminator 2 view .LVU4314
+	.loc 1 58 9 discriminator 2 view .LVU4315
+.LBB1693:
+	.loc 2 116 19 discriminator 2 view .LVU4316
+.LBB1678:
+	.loc 2 118 5 discriminator 2 view .LVU4317
+	.loc 2 118 5 is_stmt 0 discriminator 2 view .LVU4318
+.LBE1678:
+.LBE1693:
+	.loc 1 57 35 is_stmt 1 discriminator 2 view .LVU4319
+	.loc 1 57 28 discriminator 2 view .LVU4320
+	.loc 1 58 9 discriminator 2 view .LVU4321
+.LBB1694:
+	.loc 2 116 19 discriminator 2 view .LVU4322
+.LBB1679:
+	.loc 2 118 5 discriminator 2 view .LVU4323
+	.loc 2 118 5 is_stmt 0 discriminator 2 view .LVU4324
+.LBE1679:
+.LBE1694:
+	.loc 1 57 35 is_stmt 1 discriminator 2 view .LVU4325
+	.loc 1 57 28 discriminator 2 view .LVU4326
+	.loc 1 58 9 discriminator 2 view .LVU4327
+.LBB1695:
+	.loc 2 116 19 discriminator 2 view .LVU4328
+.LBB1680:
+	.loc 2 118 5 discriminator 2 view .LVU4329
+	.loc 2 118 5 is_stmt 0 discriminator 2 view .LVU4330
+.LBE1680:
+.LBE1695:
+	.loc 1 57 35 is_stmt 1 discriminator 2 view .LVU4331
+	.loc 1 57 28 discriminator 2 view .LVU4332
+	.loc 1 58 9 discriminator 2 view .LVU4333
+.LBB1696:
+	.loc 2 116 19 discriminator 2 view .LVU4334
+.LBB1681:
+	.loc 2 118 5 discriminator 2 view .LVU4335
+	.loc 2 118 5 is_stmt 0 discriminator 2 view .LVU4336
+.LBE1681:
+.LBE1696:
+	.loc 1 57 35 is_stmt 1 discriminator 2 view .LVU4337
+	.loc 1 57 28 discriminator 2 view .LVU4338
+	.loc 1 58 9 discriminator 2 view .LVU4339
+.LBB1697:
+	.loc 2 116 19 discriminator 2 view .LVU4340
+.LBB1682:
+	.loc 2 118 5 discriminator 2 view .LVU4341
+	.loc 2 118 5 is_stmt 0 discriminator 2 view .LVU4342
+.LBE1682:
+.LBE1697:
+	.loc 1 57 35 is_stmt 1 discriminator 2 view .LVU4343
+	.loc 1 57 28 discriminator 2 view .LVU4344
+	.loc 1 58 9 discriminator 2 view .LVU4345
+.LBB1698:
+	.loc 2 116 19 discriminator 2 view .LVU4346
+.LBB1683:
+	.loc 2 118 5 discriminator 2 view .LVU4347
+	.loc 2 118 5 is_stmt 0 discriminator 2 view .LVU4348
+.LBE1683:
+.LBE1698:
+	.loc 1 57 35 is_stmt 1 discriminator 2 view .LVU4349
+	.loc 1 57 28 discriminator 2 view .LVU4350
+	.loc 1 58 9 discriminator 2 view .LVU4351
+.LBB1699:
+	.loc 2 116 19 discriminator 2 view .LVU4352
+.LBB1684:
+	.loc 2 118 5 discriminator 2 view .LVU4353
+	.loc 2 118 5 is_stmt 0 discriminator 2 view .LVU4354
+.LBE1684:
+.LBE1699:
+	.loc 1 57 35 is_stmt 1 discriminator 2 view .LVU4355
+	.loc 1 57 28 discriminator 2 view .LVU4356
+	.loc 1 58 9 discriminator 2 view .LVU4357
+.LBB1700:
+	.loc 2 116 19 discriminator 2 view .LVU4358
+.LBB1685:
+	.loc 2 118 5 discriminator 2 view .LVU4359
+	.loc 2 118 5 is_stmt 0 discriminator 2 view .LVU4360
+.LBE1685:
+.LBE1700:
+	.loc 1 57 35 is_stmt 1 discriminator 2 view .LVU4361
+	.loc 1 57 28 discriminator 2 view .LVU4362
+	.loc 1 58 9 discriminator 2 view .LVU4363
+.LBB1701:
+	.loc 2 116 19 discriminator 2 view .LVU4364
+.LBB1686:
+	.loc 2 118 5 discriminator 2 view .LVU4365
+	.loc 2 118 5 is_stmt 0 discriminator 2 view .LVU4366
+.LBE1686:
+.LBE1701:
+	.loc 1 57 35 is_stmt 1 discriminator 2 view .LVU4367
+	.loc 1 57 28 discriminator 2 view .LVU4368
+	.loc 1 58 9 discriminator 2 view .LVU4369
+.LBB1702:
+	.loc 2 116 19 discriminator 2 view .LVU4370
+.LBB1687:
+	.loc 2 118 5 discriminator 2 view .LVU4371
+	.loc 2 118 5 is_stmt 0 discriminator 2 view .LVU4372
+.LBE1687:
+.LBE1702:
+	.loc 1 57 35 is_stmt 1 discriminator 2 view .LVU4373
+	.loc 1 57 28 discriminator 2 view .LVU4374
+	.loc 1 58 9 discriminator 2 view .LVU4375
+.LBB1703:
+	.loc 2 116 19 discriminator 2 view .LVU4376
+.LBB1688:
+	.loc 2 118 5 discriminator 2 view .LVU4377
+	.loc 2 118 5 is_stmt 0 discriminator 2 view .LVU4378
+.LBE1688:
+.LBE1703:
+	.loc 1 57 35 is_stmt 1 discriminator 2 view .LVU4379
+	.loc 1 57 28 discriminator 2 view .LVU4380
+	.loc 1 58 9 discriminator 2 view .LVU4381
+.LBB1704:
+	.loc 2 116 19 discriminator 2 view .LVU4382
+.LBB1689:
+	.loc 2 118 5 discriminator 2 view .LVU4383
+	.loc 2 118 5 is_stmt 0 discriminator 2 view .LVU4384
+.LBE1689:
+.LBE1704:
+.LBE1707:
+# blake2b-generic.c:63:     v[12] ^= t[0];
+	.loc 1 63 11 discriminator 2 view .LVU4385
+	movq	%r15, %rsi	# ivtmp.96, tmp160
+	xorq	%r13, %rsi	# tmp159, tmp160
+.LBB1708:
+# blake2b-generic.c:60:         v[i] = H[i];
+	.loc 1 60 14 discriminator 2 view .LVU4386
+	movaps	%xmm3, 112(%rsp)	# vect_prephitmp_329.81, MEM <vector(2) long unsigned int> [(long unsigned int *)&v + 16B]
+.LBE1708:
+.LBE1727:
+.LBE1735:
+# blake2b-generic.c:90:     for (; nblocks; nblocks--, m += BLAKE2B_BLOCK) {
+	.loc 1 90 12 discriminator 2 view .LVU4387
+	subq	$-128, %r15	#, ivtmp.96
+.LVL759:
+.LBB1736:
+.LBB1728:
+.LBB1709:
+# blake2b-generic.c:58:         m[i] = read_le64((const unsigned char *)msg + i*8);
+	.loc 1 58 14 discriminator 2 view .LVU4388
+	movaps	%xmm4, 240(%rsp)	# tmp204, MEM <vector(2) long unsigned int> [(long unsigned int *)&m + 16B]
+	movdqu	-96(%r12), %xmm4	# MEM <vector(2) long unsigned int> [(char * {ref-all})m_73 + 32B], tmp205
+.LBE1709:
+# blake2b-generic.c:63:     v[12] ^= t[0];
+	.loc 1 63 11 discriminator 2 view .LVU4389
+	movq	%rsi, 192(%rsp)	# tmp160, v[12]
+# blake2b-generic.c:64:     v[13] ^= t[1];
+	.loc 1 64 11 discriminator 2 view .LVU4390
+	movabsq	$-7276294671716946913, %rsi	#, tmp162
+.LBB1710:
+# blake2b-generic.c:58:         m[i] = read_le64((const unsigned char *)msg + i*8);
+	.loc 1 58 14 discriminator 2 view .LVU4391
+	movaps	%xmm4, 256(%rsp)	# tmp205, MEM <vector(2) long unsigned int> [(long unsigned int *)&m + 32B]
+	movdqu	-80(%r12), %xmm4	# MEM <vector(2) long unsigned int> [(char * {ref-all})m_73 + 48B], tmp206
+.LBE1710:
+# blake2b-generic.c:64:     v[13] ^= t[1];
+	.loc 1 64 11 discriminator 2 view .LVU4392
+	xorq	%r14, %rsi	# t$1, tmp162
+	movq	%rsi, 200(%rsp)	# tmp162, v[13]
+# blake2b-generic.c:68:     blake2b_12rounds(v, m);
+	.loc 1 68 5 discriminator 2 view .LVU4393
+	movq	(%rsp), %rsi	# %sfp,
+.LBB1711:
+# blake2b-generic.c:58:         m[i] = read_le64((const unsigned char *)msg + i*8);
+	.loc 1 58 14 discriminator 2 view .LVU4394
+	movaps	%xmm4, 272(%rsp)	# tmp206, MEM <vector(2) long unsigned int> [(long unsigned int *)&m + 48B]
+	movdqu	-64(%r12), %xmm4	# MEM <vector(2) long unsigned int> [(char * {ref-all})m_73 + 64B], tmp207
+.LBE1711:
+.LBB1712:
+# blake2b-generic.c:60:         v[i] = H[i];
+	.loc 1 60 14 discriminator 2 view .LVU4395
+	movaps	%xmm2, 128(%rsp)	# vect_prephitmp_329.81, MEM <vector(2) long unsigned int> [(long unsigned int *)&v + 32B]
+.LBE1712:
+.LBB1713:
+# blake2b-generic.c:58:         m[i] = read_le64((const unsigned char *)msg + i*8);
+	.loc 1 58 14 discriminator 2 view .LVU4396
+	movaps	%xmm4, 288(%rsp)	# tmp207, MEM <vector(2) long unsigned int> [(long unsigned int *)&m + 64B]
+	movdqu	-48(%r12), %xmm4	# MEM <vector(2) long unsigned int> [(char * {ref-all})m_73 + 80B], tmp208
+.LBE1713:
+.LBB1714:
+# blake2b-generic.c:60:         v[i] = H[i];
+	.loc 1 60 14 discriminator 2 view .LVU4397
+	movaps	%xmm1, 144(%rsp)	# vect_prephitmp_329.81, MEM <vector(2) long unsigned int> [(long unsigned int *)&v + 48B]
+.LBE1714:
+.LBB1715:
+# blake2b-generic.c:58:         m[i] = read_le64((const unsigned char *)msg + i*8);
+	.loc 1 58 14 discriminator 2 view .LVU4398
+	movaps	%xmm4, 304(%rsp)	# tmp208, MEM <vector(2) long unsigned int> [(long unsigned int *)&m + 80B]
+	movdqu	-32(%r12), %xmm4	# MEM <vector(2) long unsigned int> [(char * {ref-all})m_73 + 96B], tmp209
+.LBE1715:
+.LBB1716:
+# blake2b-generic.c:61:         v[i+8] = blake2b_iv[i];
+	.loc 1 61 16 discriminator 2 view .LVU4399
+	movaps	%xmm7, 160(%rsp)	# tmp181, MEM <vector(2) long unsigned int> [(long unsigned int *)&v + 64B]
+.LBE1716:
+.LBB1717:
+# blake2b-generic.c:58:         m[i] = read_le64((const unsigned char *)msg + i*8);
+	.loc 1 58 14 discriminator 2 view .LVU4400
+	movaps	%xmm4, 320(%rsp)	# tmp209, MEM <vector(2) long unsigned int> [(long unsigned int *)&m + 96B]
+	movdqu	-16(%r12), %xmm4	# MEM <vector(2) long unsigned int> [(char * {ref-all})m_73 + 112B], tmp210
+.LBE1717:
+.LBB1718:
+# blake2b-generic.c:61:         v[i+8] = blake2b_iv[i];
+	.loc 1 61 16 discriminator 2 view .LVU4401
+	movaps	%xmm6, 176(%rsp)	# tmp183, MEM <vector(2) long unsigned int> [(long unsigned int *)&v + 80B]
+.LBE1718:
+.LBB1719:
+# blake2b-generic.c:58:         m[i] = read_le64((const unsigned char *)msg + i*8);
+	.loc 1 58 14 discriminator 2 view .LVU4402
+	movaps	%xmm4, 336(%rsp)	# tmp210, MEM <vector(2) long unsigned int> [(long unsigned int *)&m + 112B]
+	.loc 1 57 35 is_stmt 1 discriminator 2 view .LVU4403
+.LVL760:
+	.loc 1 57 28 discriminator 2 view .LVU4404
+	.loc 1 57 28 is_stmt 0 discriminator 2 view .LVU4405
+.LBE1719:
+.LBB1720:
+	.loc 1 59 28 is_stmt 1 discriminator 2 view .LVU4406
+	.loc 1 60 9 discriminator 2 view .LVU4407
+	.loc 1 61 9 discriminator 2 view .LVU4408
+	.loc 1 59 34 discriminator 2 view .LVU4409
+	.loc 1 59 28 discriminator 2 view .LVU4410
+	.loc 1 60 9 discriminator 2 view .LVU4411
+	.loc 1 61 9 discriminator 2 view .LVU4412
+	.loc 1 59 34 discriminator 2 view .LVU4413
+	.loc 1 59 28 discriminator 2 view .LVU4414
+	.loc 1 60 9 discriminator 2 view .LVU4415
+	.loc 1 61 9 discriminator 2 view .LVU4416
+	.loc 1 59 34 discriminator 2 view .LVU4417
+	.loc 1 59 28 discriminator 2 view .LVU4418
+	.loc 1 60 9 discriminator 2 view .LVU4419
+	.loc 1 61 9 discriminator 2 view .LVU4420
+	.loc 1 59 34 discriminator 2 view .LVU4421
+	.loc 1 59 28 discriminator 2 view .LVU4422
+	.loc 1 60 9 discriminator 2 view .LVU4423
+	.loc 1 61 9 discriminator 2 view .LVU4424
+	.loc 1 59 34 discriminator 2 view .LVU4425
+	.loc 1 59 28 discriminator 2 view .LVU4426
+	.loc 1 60 9 discriminator 2 view .LVU4427
+	.loc 1 61 9 discriminator 2 view .LVU4428
+	.loc 1 59 34 discriminator 2 view .LVU4429
+	.loc 1 59 28 discriminator 2 view .LVU4430
+	.loc 1 60 9 discriminator 2 view .LVU4431
+	.loc 1 61 9 discriminator 2 view .LVU4432
+	.loc 1 59 34 discriminator 2 view .LVU4433
+	.loc 1 59 28 discriminator 2 view .LVU4434
+	.loc 1 60 9 discriminator 2 view .LVU4435
+	.loc 1 61 9 discriminator 2 view .LVU4436
+	.loc 1 59 34 discriminator 2 view .LVU4437
+	.loc 1 59 28 discriminator 2 view .LVU4438
+.LBE1720:
+	.loc 1 63 5 discriminator 2 view .LVU4439
+	.loc 1 64 5 discriminator 2 view .LVU4440
+	.loc 1 65 5 discriminator 2 view .LVU4441
+	.loc 1 66 5 discriminator 2 view .LVU4442
+# blake2b-generic.c:65:     v[14] ^= f[0];
+	.loc 1 65 11 is_stmt 0 discriminator 2 view .LVU4443
+	movaps	%xmm5, 208(%rsp)	# vect__317.54, MEM <vector(2) long unsigned int> [(long unsigned int *)&v + 112B]
+	.loc 1 68 5 is_stmt 1 discriminator 2 view .LVU4444
+	call	blake2b_12rounds	#
+.LVL761:
+	.loc 1 70 5 discriminator 2 view .LVU4445
+.LBB1721:
+	.loc 1 70 10 discriminator 2 view .LVU4446
+	.loc 1 70 28 discriminator 2 view .LVU4447
+	.loc 1 71 9 discriminator 2 view .LVU4448
+# blake2b-generic.c:71:         H[i] ^= v[i] ^ v[i+8];
+	.loc 1 71 14 is_stmt 0 discriminator 2 view .LVU4449
+	movdqa	96(%rsp), %xmm4	# MEM <vector(2) long unsigned int> [(long unsigned int *)&v], tmp165
+	pxor	160(%rsp), %xmm4	# MEM <vector(2) long unsigned int> [(long unsigned int *)&v + 64B], tmp165
+	pxor	%xmm4, %xmm0	# tmp165, vect__109.83
+	movdqa	112(%rsp), %xmm4	# MEM <vector(2) long unsigned int> [(long unsigned int *)&v + 16B], tmp167
+	pxor	176(%rsp), %xmm4	# MEM <vector(2) long unsigned int> [(long unsigned int *)&v + 80B], tmp167
+	movaps	%xmm0, 32(%rsp)	# vect__109.83, MEM <vector(2) long unsigned int> [(u64 *)&H]
+	pxor	%xmm4, %xmm3	# tmp167, vect_prephitmp_329.81
+	movdqa	128(%rsp), %xmm4	# MEM <vector(2) long unsigned int> [(long unsigned int *)&v + 32B], tmp169
+	pxor	192(%rsp), %xmm4	# MEM <vector(2) long unsigned int> [(long unsigned int *)&v + 96B], tmp169
+	movaps	%xmm3, 48(%rsp)	# vect_prephitmp_329.81, MEM <vector(2) long unsigned int> [(u64 *)&H + 16B]
+	pxor	%xmm4, %xmm2	# tmp169, vect_prephitmp_329.81
+	movdqa	144(%rsp), %xmm4	# MEM <vector(2) long unsigned int> [(long unsigned int *)&v + 48B], tmp171
+	pxor	208(%rsp), %xmm4	# MEM <vector(2) long unsigned int> [(long unsigned int *)&v + 112B], tmp171
+	movaps	%xmm2, 64(%rsp)	# vect_prephitmp_329.81, MEM <vector(2) long unsigned int> [(u64 *)&H + 32B]
+	pxor	%xmm4, %xmm1	# tmp171, vect_prephitmp_329.81
+	.loc 1 70 34 is_stmt 1 discriminator 2 view .LVU4450
+.LVL762:
+	.loc 1 70 28 discriminator 2 view .LVU4451
+	.loc 1 71 9 discriminator 2 view .LVU4452
+	.loc 1 70 34 discriminator 2 view .LVU4453
+	.loc 1 70 28 discriminator 2 view .LVU4454
+	.loc 1 71 9 discriminator 2 view .LVU4455
+	.loc 1 70 34 discriminator 2 view .LVU4456
+	.loc 1 70 28 discriminator 2 view .LVU4457
+	.loc 1 71 9 discriminator 2 view .LVU4458
+	.loc 1 70 34 discriminator 2 view .LVU4459
+	.loc 1 70 28 discriminator 2 view .LVU4460
+	.loc 1 71 9 discriminator 2 view .LVU4461
+	.loc 1 70 34 discriminator 2 view .LVU4462
+	.loc 1 70 28 discriminator 2 view .LVU4463
+	.loc 1 71 9 discriminator 2 view .LVU4464
+	.loc 1 70 34 discriminator 2 view .LVU4465
+	.loc 1 70 28 discriminator 2 view .LVU4466
+	.loc 1 71 9 discriminator 2 view .LVU4467
+	.loc 1 70 34 discriminator 2 view .LVU4468
+	.loc 1 70 28 discriminator 2 view .LVU4469
+	.loc 1 71 9 discriminator 2 view .LVU4470
+# blake2b-generic.c:71:         H[i] ^= v[i] ^ v[i+8];
+	.loc 1 71 14 is_stmt 0 discriminator 2 view .LVU4471
+	movaps	%xmm1, 80(%rsp)	# vect_prephitmp_329.81, MEM <vector(2) long unsigned int> [(u64 *)&H + 48B]
+	.loc 1 70 34 is_stmt 1 discriminator 2 view .LVU4472
+.LVL763:
+	.loc 1 70 28 discriminator 2 view .LVU4473
+	.loc 1 70 28 is_stmt 0 discriminator 2 view .LVU4474
+.LBE1721:
+.LBE1728:
+.LBE1736:
+	.loc 1 90 30 is_stmt 1 discriminator 2 view .LVU4475
+	.loc 1 90 12 discriminator 2 view .LVU4476
+	subq	$1, %rbx	#, nblocks
+.LVL764:
+	.loc 1 90 12 is_stmt 0 discriminator 2 view .LVU4477
+	jne	.L8	#,
+# blake2b-generic.c:91:         t[0] += BLAKE2B_BLOCK;
+	.loc 1 91 14 view .LVU4478
+	movq	24(%rsp), %rax	# %sfp, nblocks
+	movq	16(%rsp), %rcx	# %sfp, _435
+	movq	%r14, %xmm7	# t$1, t$1
+	salq	$7, %rax	#, nblocks
+	addq	%rax, %rcx	# tmp174, _435
+	movq	%rcx, %xmm1	# _435, tmp175
+	punpcklqdq	%xmm7, %xmm1	# t$1, vect__2.90
+.LVL765:
+.L7:
+.LBB1737:
+	.loc 1 95 28 is_stmt 1 view .LVU4479
+# blake2b-generic.c:96:         ctx->H[i] = H[i];
+	.loc 1 96 19 is_stmt 0 view .LVU4480
+	movdqa	32(%rsp), %xmm6	# MEM <char[1:64]> [(void *)&H], tmp220
+	movdqa	48(%rsp), %xmm7	# MEM <char[1:64]> [(void *)&H], tmp221
+.LBE1737:
+# blake2b-generic.c:97:     ctx->t[0] = t[0];
+	.loc 1 97 15 view .LVU4481
+	movaps	%xmm1, 192(%rbp)	# vect__2.90, MEM <vector(2) long unsigned int> [(long unsigned int *)ctx_24(D) + 192B]
+.LBB1738:
+# blake2b-generic.c:96:         ctx->H[i] = H[i];
+	.loc 1 96 19 view .LVU4482
+	movdqa	64(%rsp), %xmm5	# MEM <char[1:64]> [(void *)&H], tmp222
+	movups	%xmm6, 0(%rbp)	# tmp220, MEM <char[1:64]> [(void *)ctx_24(D)]
+	movdqa	80(%rsp), %xmm6	# MEM <char[1:64]> [(void *)&H], tmp223
+	movups	%xmm7, 16(%rbp)	# tmp221, MEM <char[1:64]> [(void *)ctx_24(D)]
+	movups	%xmm5, 32(%rbp)	# tmp222, MEM <char[1:64]> [(void *)ctx_24(D)]
+	movups	%xmm6, 48(%rbp)	# tmp223, MEM <char[1:64]> [(void *)ctx_24(D)]
+.LVL766:
+	.loc 1 96 19 view .LVU4483
+.LBE1738:
+	.loc 1 97 5 is_stmt 1 view .LVU4484
+	.loc 1 98 5 view .LVU4485
+# blake2b-generic.c:99: }
+	.loc 1 99 1 is_stmt 0 view .LVU4486
+	addq	$360, %rsp	#,
+	.cfi_def_cfa_offset 56
+	popq	%rbx	#
+	.cfi_def_cfa_offset 48
+	popq	%rbp	#
+	.cfi_def_cfa_offset 40
+.LVL767:
+	.loc 1 99 1 view .LVU4487
+	popq	%r12	#
+	.cfi_def_cfa_offset 32
+	popq	%r13	#
+	.cfi_def_cfa_offset 24
+	popq	%r14	#
+	.cfi_def_cfa_offset 16
+	popq	%r15	#
+	.cfi_def_cfa_offset 8
+	ret	
+	.cfi_endproc
+.LFE29:
+	.size	blake2b_compress_blocks_generic, .-blake2b_compress_blocks_generic
+	.section	.rodata
+	.align 32
+	.type	blake2b_iv, @object
+	.size	blake2b_iv, 64
+blake2b_iv:
+	.quad	7640891576956012808
+	.quad	-4942790177534073029
+	.quad	4354685564936845355
+	.quad	-6534734903238641935
+	.quad	5840696475078001361
+	.quad	-7276294671716946913
+	.quad	2270897969802886507
+	.quad	6620516959819538809
+	.section	.rodata.cst16,"aM",@progbits,16
+	.align 16
+.LC0:
+	.quad	2270897969802886507
+	.quad	6620516959819538809
+	.align 16
+.LC1:
+	.quad	5840696475078001361
+	.quad	-7276294671716946913
+	.align 16
+.LC2:
+	.quad	7640891576956012808
+	.quad	-4942790177534073029
+	.align 16
+.LC3:
+	.quad	4354685564936845355
+	.quad	-6534734903238641935
+	.text
+.Letext0:
+	.file 3 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stddef.h"
+	.file 4 "/usr/include/x86_64-linux-gnu/bits/types.h"
+	.file 5 "/usr/include/x86_64-linux-gnu/bits/stdint-uintn.h"
+	.file 6 "blake2b.h"
+	.file 7 "blake2s-internal.h"
+	.section	.debug_info,"",@progbits
+.Ldebug_info0:
+	.long	0x5bd2
+	.value	0x5
+	.byte	0x1
+	.byte	0x8
+	.long	.Ldebug_abbrev0
+	.uleb128 0x20
+	.long	.LASF34
+	.byte	0xc
+	.long	.LASF0
+	.long	.LASF1
+	.quad	.Ltext0
+	.quad	.Letext0-.Ltext0
+	.long	.Ldebug_line0
+	.uleb128 0x6
+	.byte	0x8
+	.byte	0x5
+	.long	.LASF2
+	.uleb128 0xb
+	.long	.LASF8
+	.byte	0x3
+	.byte	0xd6
+	.byte	0x1b
+	.long	0x41
+	.uleb128 0x6
+	.byte	0x8
+	.byte	0x7
+	.long	.LASF3
+	.uleb128 0x21
+	.byte	0x4
+	.byte	0x5
+	.string	"int"
+	.uleb128 0xa
+	.long	0x48
+	.uleb128 0x6
+	.byte	0x1
+	.byte	0x8
+	.long	.LASF4
+	.uleb128 0xa
+	.long	0x54
+	.uleb128 0x6
+	.byte	0x2
+	.byte	0x7
+	.long	.LASF5
+	.uleb128 0x6
+	.byte	0x4
+	.byte	0x7
+	.long	.LASF6
+	.uleb128 0x6
+	.byte	0x1
+	.byte	0x6
+	.long	.LASF7
+	.uleb128 0xb
+	.long	.LASF9
+	.byte	0x4
+	.byte	0x26
+	.byte	0x17
+	.long	0x54
+	.uleb128 0x6
+	.byte	0x2
+	.byte	0x5
+	.long	.LASF10
+	.uleb128 0xb
+	.long	.LASF11
+	.byte	0x4
+	.byte	0x2a
+	.byte	0x16
+	.long	0x67
+	.uleb128 0xb
+	.long	.LASF12
+	.byte	0x4
+	.byte	0x2d
+	.byte	0x1b
+	.long	0x41
+	.uleb128 0x6
+	.byte	0x1
+	.byte	0x6
+	.long	.LASF13
+	.uleb128 0xb
+	.long	.LASF14
+	.byte	0x5
+	.byte	0x18
+	.byte	0x13
+	.long	0x75
+	.uleb128 0xb
+	.long	.LASF15
+	.byte	0x5
+	.byte	0x1a
+	.byte	0x14
+	.long	0x88
+	.uleb128 0xb
+	.long	.LASF16
+	.byte	0x5
+	.byte	0x1b
+	.byte	0x14
+	.long	0x94
+	.uleb128 0xe
+	.long	0xd0
+	.uleb128 0x22
+	.uleb128 0x23
+	.long	.LASF35
+	.value	0x100
+	.byte	0x20
+	.byte	0x6
+	.byte	0x32
+	.byte	0x8
+	.long	0x12c
+	.uleb128 0x10
+	.string	"H"
+	.byte	0x33
+	.byte	0xe
+	.long	0x12c
+	.byte	0
+	.uleb128 0x10
+	.string	"buf"
+	.byte	0x34
+	.byte	0x13
+	.long	0x13c
+	.byte	0x40
+	.uleb128 0x10
+	.string	"t"
+	.byte	0x35
+	.byte	0xe
+	.long	0x14c
+	.byte	0xc0
+	.uleb128 0x10
+	.string	"f"
+	.byte	0x36
+	.byte	0xe
+	.long	0x14c
+	.byte	0xd0
+	.uleb128 0x15
+	.long	.LASF17
+	.byte	0x37
+	.long	0x67
+	.byte	0xe0
+	.uleb128 0x15
+	.long	.LASF18
+	.byte	0x38
+	.long	0x67
+	.byte	0xe4
+	.uleb128 0x15
+	.long	.LASF19
+	.byte	0x39
+	.long	0x67
+	.byte	0xe8
+	.byte	0
+	.uleb128 0x8
+	.long	0xbf
+	.long	0x13c
+	.uleb128 0x7
+	.long	0x41
+	.byte	0x7
+	.byte	0
+	.uleb128 0x8
+	.long	0x54
+	.long	0x14c
+	.uleb128 0x7
+	.long	0x41
+	.byte	0x7f
+	.byte	0
+	.uleb128 0x8
+	.long	0xbf
+	.long	0x15c
+	.uleb128 0x7
+	.long	0x41
+	.byte	0x1
+	.byte	0
+	.uleb128 0x6
+	.byte	0x8
+	.byte	0x7
+	.long	.LASF20
+	.uleb128 0x6
+	.byte	0x8
+	.byte	0x5
+	.long	.LASF21
+	.uleb128 0x16
+	.string	"u8"
+	.byte	0x7
+	.byte	0x7
+	.byte	0x11
+	.long	0xa7
+	.uleb128 0xa
+	.long	0x16a
+	.uleb128 0x16
+	.string	"u32"
+	.byte	0x7
+	.byte	0x8
+	.byte	0x12
+	.long	0xb3
+	.uleb128 0xa
+	.long	0x17a
+	.uleb128 0x8
+	.long	0x186
+	.long	0x19b
+	.uleb128 0x7
+	.long	0x41
+	.byte	0x7
+	.byte	0
+	.uleb128 0xa
+	.long	0x18b
+	.uleb128 0x19
+	.long	.LASF22
+	.byte	0xa
+	.byte	0x12
+	.long	0x19b
+	.byte	0x20
+	.byte	0x67
+	.byte	0xe6
+	.byte	0x9
+	.byte	0x6a
+	.byte	0x85
+	.byte	0xae
+	.byte	0x67
+	.byte	0xbb
+	.byte	0x72
+	.byte	0xf3
+	.byte	0x6e
+	.byte	0x3c
+	.byte	0x3a
+	.byte	0xf5
+	.byte	0x4f
+	.byte	0xa5
+	.byte	0x7f
+	.byte	0x52
+	.byte	0xe
+	.byte	0x51
+	.byte	0x8c
+	.byte	0x68
+	.byte	0x5
+	.byte	0x9b
+	.byte	0xab
+	.byte	0xd9
+	.byte	0x83
+	.byte	0x1f
+	.byte	0x19
+	.byte	0xcd
+	.byte	0xe0
+	.byte	0x5b
+	.uleb128 0x8
+	.long	0x175
+	.long	0x1e2
+	.uleb128 0x7
+	.long	0x41
+	.byte	0x9
+	.uleb128 0x7
+	.long	0x41
+	.byte	0xf
+	.byte	0
+	.uleb128 0xa
+	.long	0x1cc
+	.uleb128 0x19
+	.long	.LASF23
+	.byte	0xf
+	.byte	0x11
+	.long	0x1e2
+	.byte	0xa0
+	.byte	0
+	.byte	0x1
+	.byte	0x2
+	.byte	0x3
+	.byte	0x4
+	.byte	0x5
+	.byte	0x6
+	.byte	0x7
+	.byte	0x8
+	.byte	0x9
+	.byte	0xa
+	.byte	0xb
+	.byte	0xc
+	.byte	0xd
+	.byte	0xe
+	.byte	0xf
+	.byte	0xe
+	.byte	0xa
+	.byte	0x4
+	.byte	0x8
+	.byte	0x9
+	.byte	0xf
+	.byte	0xd
+	.byte	0x6
+	.byte	0x1
+	.byte	0xc
+	.byte	0
+	.byte	0x2
+	.byte	0xb
+	.byte	0x7
+	.byte	0x5
+	.byte	0x3
+	.byte	0xb
+	.byte	0x8
+	.byte	0xc
+	.byte	0
+	.byte	0x5
+	.byte	0x2
+	.byte	0xf
+	.byte	0xd
+	.byte	0xa
+	.byte	0xe
+	.byte	0x3
+	.byte	0x6
+	.byte	0x7
+	.byte	0x1
+	.byte	0x9
+	.byte	0x4
+	.byte	0x7
+	.byte	0x9
+	.byte	0x3
+	.byte	0x1
+	.byte	0xd
+	.byte	0xc
+	.byte	0xb
+	.byte	0xe
+	.byte	0x2
+	.byte	0x6
+	.byte	0x5
+	.byte	0xa
+	.byte	0x4
+	.byte	0
+	.byte	0xf
+	.byte	0x8
+	.byte	0x9
+	.byte	0
+	.byte	0x5
+	.byte	0x7
+	.byte	0x2
+	.byte	0x4
+	.byte	0xa
+	.byte	0xf
+	.byte	0xe
+	.byte	0x1
+	.byte	0xb
+	.byte	0xc
+	.byte	0x6
+	.byte	0x8
+	.byte	0x3
+	.byte	0xd
+	.byte	0x2
+	.byte	0xc
+	.byte	0x6
+	.byte	0xa
+	.byte	0
+	.byte	0xb
+	.byte	0x8
+	.byte	0x3
+	.byte	0x4
+	.byte	0xd
+	.byte	0x7
+	.byte	0x5
+	.byte	0xf
+	.byte	0xe
+	.byte	0x1
+	.byte	0x9
+	.byte	0xc
+	.byte	0x5
+	.byte	0x1
+	.byte	0xf
+	.byte	0xe
+	.byte	0xd
+	.byte	0x4
+	.byte	0xa
+	.byte	0
+	.byte	0x7
+	.byte	0x6
+	.byte	0x3
+	.byte	0x9
+	.byte	0x2
+	.byte	0x8
+	.byte	0xb
+	.byte	0xd
+	.byte	0xb
+	.byte	0x7
+	.byte	0xe
+	.byte	0xc
+	.byte	0x1
+	.byte	0x3
+	.byte	0x9
+	.byte	0x5
+	.byte	0
+	.byte	0xf
+	.byte	0x4
+	.byte	0x8
+	.byte	0x6
+	.byte	0x2
+	.byte	0xa
+	.byte	0x6
+	.byte	0xf
+	.byte	0xe
+	.byte	0x9
+	.byte	0xb
+	.byte	0x3
+	.byte	0
+	.byte	0x8
+	.byte	0xc
+	.byte	0x2
+	.byte	0xd
+	.byte	0x7
+	.byte	0x1
+	.byte	0x4
+	.byte	0xa
+	.byte	0x5
+	.byte	0xa
+	.byte	0x2
+	.byte	0x8
+	.byte	0x4
+	.byte	0x7
+	.byte	0x6
+	.byte	0x1
+	.byte	0x5
+	.byte	0xf
+	.byte	0xb
+	.byte	0x9
+	.byte	0xe
+	.byte	0x3
+	.byte	0xc
+	.byte	0xd
+	.byte	0
+	.uleb128 0x16
+	.string	"u64"
+	.byte	0x2
+	.byte	0x6
+	.byte	0x12
+	.long	0xbf
+	.uleb128 0xa
+	.long	0x293
+	.uleb128 0x8
+	.long	0x29f
+	.long	0x2b4
+	.uleb128 0x7
+	.long	0x41
+	.byte	0x7
+	.byte	0
+	.uleb128 0xa
+	.long	0x2a4
+	.uleb128 0x24
+	.long	.LASF24
+	.byte	0x2
+	.byte	0x8
+	.byte	0x12
+	.long	0x2b4
+	.uleb128 0x9
+	.byte	0x3
+	.quad	blake2b_iv
+	.uleb128 0xe
+	.long	0xd1
+	.uleb128 0x1a
+	.long	.LASF26
+	.byte	0x4f
+	.quad	.LFB29
+	.quad	.LFE29-.LFB29
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0x48b
+	.uleb128 0xd
+	.string	"ctx"
+	.byte	0x4f
+	.byte	0x3a
+	.long	0x2cf
+	.long	.LLST459
+	.long	.LVUS459
+	.uleb128 0xd
+	.string	"msg"
+	.byte	0x4f
+	.byte	0x4b
+	.long	0xcb
+	.long	.LLST460
+	.long	.LVUS460
+	.uleb128 0x25
+	.long	.LASF25
+	.byte	0x1
+	.byte	0x50
+	.byte	0x2d
+	.long	0x35
+	.long	.LLST461
+	.long	.LVUS461
+	.uleb128 0x11
+	.string	"m"
+	.byte	0x52
+	.byte	0x1a
+	.long	0x48b
+	.long	.LLST462
+	.long	.LVUS462
+	.uleb128 0x26
+	.string	"H"
+	.byte	0x1
+	.byte	0x53
+	.byte	0x9
+	.long	0x490
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -384
+	.uleb128 0x11
+	.string	"t"
+	.byte	0x53
+	.byte	0xf
+	.long	0x4a0
+	.long	.LLST463
+	.long	.LVUS463
+	.uleb128 0xc
+	.string	"f"
+	.byte	0x1
+	.byte	0x53
+	.byte	0x15
+	.long	0x4a0
+	.uleb128 0x1b
+	.long	.LLRL464
+	.long	0x37f
+	.uleb128 0x11
+	.string	"i"
+	.byte	0x54
+	.byte	0x13
+	.long	0x67
+	.long	.LLST465
+	.long	.LVUS465
+	.byte	0
+	.uleb128 0x1b
+	.long	.LLRL476
+	.long	0x39a
+	.uleb128 0x11
+	.string	"i"
+	.byte	0x5f
+	.byte	0x13
+	.long	0x67
+	.long	.LLST477
+	.long	.LVUS477
+	.byte	0
+	.uleb128 0x17
+	.long	0x5c6
+	.quad	.LBI1670
+	.value	.LVU4285
+	.long	.LLRL466
+	.byte	0x5d
+	.byte	0x9
+	.uleb128 0x2
+	.long	0x5f1
+	.uleb128 0x1
+	.long	0x5e7
+	.long	.LLST467
+	.long	.LVUS467
+	.uleb128 0x1
+	.long	0x5dd
+	.long	.LLST468
+	.long	.LVUS468
+	.uleb128 0x1
+	.long	0x5d3
+	.long	.LLST469
+	.long	.LVUS469
+	.uleb128 0x1c
+	.long	.LLRL466
+	.uleb128 0x12
+	.long	0x5fd
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -320
+	.uleb128 0x12
+	.long	0x607
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -192
+	.uleb128 0x13
+	.long	0x611
+	.long	.LLRL470
+	.long	0x428
+	.uleb128 0xf
+	.long	0x616
+	.long	.LLST471
+	.long	.LVUS471
+	.uleb128 0x17
+	.long	0x5b73
+	.quad	.LBI1673
+	.value	.LVU4292
+	.long	.LLRL472
+	.byte	0x3a
+	.byte	0x10
+	.uleb128 0x2
+	.long	0x5b82
+	.byte	0
+	.byte	0
+	.uleb128 0x13
+	.long	0x621
+	.long	.LLRL473
+	.long	0x443
+	.uleb128 0xf
+	.long	0x626
+	.long	.LLST474
+	.long	.LVUS474
+	.byte	0
+	.uleb128 0x1d
+	.long	0x631
+	.quad	.LBB1721
+	.quad	.LBE1721-.LBB1721
+	.long	0x46a
+	.uleb128 0xf
+	.long	0x632
+	.long	.LLST475
+	.long	.LVUS475
+	.byte	0
+	.uleb128 0x1e
+	.quad	.LVL761
+	.long	0x658
+	.uleb128 0x14
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x4
+	.byte	0x91
+	.sleb128 -408
+	.byte	0x6
+	.uleb128 0x14
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x4
+	.byte	0x91
+	.sleb128 -416
+	.byte	0x6
+	.byte	0
+	.byte	0
+	.byte	0
+	.byte	0
+	.uleb128 0xe
+	.long	0x5b
+	.uleb128 0x8
+	.long	0x293
+	.long	0x4a0
+	.uleb128 0x7
+	.long	0x41
+	.byte	0x7
+	.byte	0
+	.uleb128 0x8
+	.long	0x293
+	.long	0x4b0
+	.uleb128 0x7
+	.long	0x41
+	.byte	0x1
+	.byte	0
+	.uleb128 0x1a
+	.long	.LASF27
+	.byte	0x4a
+	.quad	.LFB28
+	.quad	.LFE28-.LFB28
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0x5c6
+	.uleb128 0xd
+	.string	"ctx"
+	.byte	0x4a
+	.byte	0x33
+	.long	0x2cf
+	.long	.LLST448
+	.long	.LVUS448
+	.uleb128 0xd
+	.string	"msg"
+	.byte	0x4a
+	.byte	0x44
+	.long	0xcb
+	.long	.LLST449
+	.long	.LVUS449
+	.uleb128 0x17
+	.long	0x5c6
+	.quad	.LBI1632
+	.value	.LVU4186
+	.long	.LLRL450
+	.byte	0x4c
+	.byte	0x5
+	.uleb128 0x1
+	.long	0x5f1
+	.long	.LLST451
+	.long	.LVUS451
+	.uleb128 0x1
+	.long	0x5e7
+	.long	.LLST452
+	.long	.LVUS452
+	.uleb128 0x1
+	.long	0x5dd
+	.long	.LLST453
+	.long	.LVUS453
+	.uleb128 0x1
+	.long	0x5d3
+	.long	.LLST454
+	.long	.LVUS454
+	.uleb128 0x1c
+	.long	.LLRL450
+	.uleb128 0x12
+	.long	0x5fd
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -272
+	.uleb128 0x12
+	.long	0x607
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -144
+	.uleb128 0x13
+	.long	0x611
+	.long	.LLRL455
+	.long	0x56d
+	.uleb128 0xf
+	.long	0x616
+	.long	.LLST456
+	.long	.LVUS456
+	.byte	0
+	.uleb128 0x13
+	.long	0x621
+	.long	.LLRL457
+	.long	0x580
+	.uleb128 0x27
+	.long	0x626
+	.byte	0
+	.uleb128 0x1d
+	.long	0x631
+	.quad	.LBB1650
+	.quad	.LBE1650-.LBB1650
+	.long	0x5a7
+	.uleb128 0xf
+	.long	0x632
+	.long	.LLST458
+	.long	.LVUS458
+	.byte	0
+	.uleb128 0x1e
+	.quad	.LVL749
+	.long	0x658
+	.uleb128 0x14
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -272
+	.uleb128 0x14
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -144
+	.byte	0
+	.byte	0
+	.byte	0
+	.byte	0
+	.uleb128 0x28
+	.long	.LASF31
+	.byte	0x1
+	.byte	0x34
+	.byte	0x14
+	.byte	0x3
+	.long	0x63e
+	.uleb128 0x9
+	.string	"H"
+	.byte	0x1
+	.byte	0x34
+	.byte	0x26
+	.long	0x63e
+	.uleb128 0x9
+	.string	"t"
+	.byte	0x1
+	.byte	0x34
+	.byte	0x36
+	.long	0x643
+	.uleb128 0x9
+	.string	"f"
+	.byte	0x1
+	.byte	0x34
+	.byte	0x46
+	.long	0x643
+	.uleb128 0x9
+	.string	"msg"
+	.byte	0x1
+	.byte	0x35
+	.byte	0x2e
+	.long	0xcb
+	.uleb128 0xc
+	.string	"v"
+	.byte	0x1
+	.byte	0x37
+	.byte	0x9
+	.long	0x648
+	.uleb128 0xc
+	.string	"m"
+	.byte	0x1
+	.byte	0x38
+	.byte	0x9
+	.long	0x648
+	.uleb128 0x1f
+	.long	0x621
+	.uleb128 0xc
+	.string	"i"
+	.byte	0x1
+	.byte	0x39
+	.byte	0x13
+	.long	0x67
+	.byte	0
+	.uleb128 0x1f
+	.long	0x631
+	.uleb128 0xc
+	.string	"i"
+	.byte	0x1
+	.byte	0x3b
+	.byte	0x13
+	.long	0x67
+	.byte	0
+	.uleb128 0x29
+	.uleb128 0xc
+	.string	"i"
+	.byte	0x1
+	.byte	0x46
+	.byte	0x13
+	.long	0x67
+	.byte	0
+	.byte	0
+	.uleb128 0xe
+	.long	0x293
+	.uleb128 0xe
+	.long	0x29f
+	.uleb128 0x8
+	.long	0x293
+	.long	0x658
+	.uleb128 0x7
+	.long	0x41
+	.byte	0xf
+	.byte	0
+	.uleb128 0x2a
+	.long	.LASF36
+	.byte	0x1
+	.byte	0x7
+	.byte	0x14
+	.quad	.LFB26
+	.quad	.LFE26-.LFB26
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0x5b4f
+	.uleb128 0xd
+	.string	"v"
+	.byte	0x7
+	.byte	0x29
+	.long	0x63e
+	.long	.LLST0
+	.long	.LVUS0
+	.uleb128 0xd
+	.string	"m"
+	.byte	0x7
+	.byte	0x3a
+	.long	0x643
+	.long	.LLST1
+	.long	.LVUS1
+	.uleb128 0x2b
+	.long	0x5b4f
+	.quad	.LBI785
+	.value	.LVU8
+	.long	.LLRL2
+	.byte	0x1
+	.byte	0x26
+	.byte	0x51
+	.long	0x6cd
+	.uleb128 0x1
+	.long	0x5b68
+	.long	.LLST3
+	.long	.LVUS3
+	.uleb128 0x1
+	.long	0x5b5e
+	.long	.LLST4
+	.long	.LVUS4
+	.byte	0
+	.uleb128 0x4
+	.long	0x5b4f
+	.quad	.LBI789
+	.value	.LVU24
+	.quad	.LBB789
+	.quad	.LBE789-.LBB789
+	.byte	0x26
+	.byte	0x8d
+	.long	0x705
+	.uleb128 0x2
+	.long	0x5b68
+	.uleb128 0x1
+	.long	0x5b5e
+	.long	.LLST5
+	.long	.LVUS5
+	.byte	0
+	.uleb128 0x4
+	.long	0x5b4f
+	.quad	.LBI791
+	.value	.LVU35
+	.quad	.LBB791
+	.quad	.LBE791-.LBB791
+	.byte	0x26
+	.byte	0xed
+	.long	0x73d
+	.uleb128 0x2
+	.long	0x5b68
+	.uleb128 0x1
+	.long	0x5b5e
+	.long	.LLST6
+	.long	.LVUS6
+	.byte	0
+	.uleb128 0x3
+	.long	0x5b4f
+	.quad	.LBI793
+	.value	.LVU46
+	.quad	.LBB793
+	.quad	.LBE793-.LBB793
+	.byte	0x26
+	.value	0x129
+	.long	0x776
+	.uleb128 0x2
+	.long	0x5b68
+	.uleb128 0x1
+	.long	0x5b5e
+	.long	.LLST7
+	.long	.LVUS7
+	.byte	0
+	.uleb128 0x3
+	.long	0x5b4f
+	.quad	.LBI795
+	.value	.LVU57
+	.quad	.LBB795
+	.quad	.LBE795-.LBB795
+	.byte	0x26
+	.value	0x19b
+	.long	0x7b7
+	.uleb128 0x1
+	.long	0x5b68
+	.long	.LLST8
+	.long	.LVUS8
+	.uleb128 0x1
+	.long	0x5b5e
+	.long	.LLST9
+	.long	.LVUS9
+	.byte	0
+	.uleb128 0x3
+	.long	0x5b4f
+	.quad	.LBI797
+	.value	.LVU68
+	.quad	.LBB797
+	.quad	.LBE797-.LBB797
+	.byte	0x26
+	.value	0x1d7
+	.long	0x7f0
+	.uleb128 0x2
+	.long	0x5b68
+	.uleb128 0x1
+	.long	0x5b5e
+	.long	.LLST10
+	.long	.LVUS10
+	.byte	0
+	.uleb128 0x3
+	.long	0x5b4f
+	.quad	.LBI799
+	.value	.LVU78
+	.quad	.LBB799
+	.quad	.LBE799-.LBB799
+	.byte	0x26
+	.value	0x237
+	.long	0x829
+	.uleb128 0x2
+	.long	0x5b68
+	.uleb128 0x1
+	.long	0x5b5e
+	.long	.LLST11
+	.long	.LVUS11
+	.byte	0
+	.uleb128 0x3
+	.long	0x5b4f
+	.quad	.LBI801
+	.value	.LVU91
+	.quad	.LBB801
+	.quad	.LBE801-.LBB801
+	.byte	0x26
+	.value	0x273
+	.long	0x862
+	.uleb128 0x2
+	.long	0x5b68
+	.uleb128 0x1
+	.long	0x5b5e
+	.long	.LLST12
+	.long	.LVUS12
+	.byte	0
+	.uleb128 0x3
+	.long	0x5b4f
+	.quad	.LBI803
+	.value	.LVU108
+	.quad	.LBB803
+	.quad	.LBE803-.LBB803
+	.byte	0x26
+	.value	0x2e5
+	.long	0x8a3
+	.uleb128 0x1
+	.long	0x5b68
+	.long	.LLST13
+	.long	.LVUS13
+	.uleb128 0x1
+	.long	0x5b5e
+	.long	.LLST14
+	.long	.LVUS14
+	.byte	0
+	.uleb128 0x5
+	.long	0x5b4f
+	.quad	.LBI805
+	.value	.LVU118
+	.long	.LLRL15
+	.byte	0x26
+	.value	0x321
+	.long	0x8d0
+	.uleb128 0x2
+	.long	0x5b68
+	.uleb128 0x1
+	.long	0x5b5e
+	.long	.LLST16
+	.long	.LVUS16
+	.byte	0
+	.uleb128 0x3
+	.long	0x5b4f
+	.quad	.LBI809
+	.value	.LVU132
+	.quad	.LBB809
+	.quad	.LBE809-.LBB809
+	.byte	0x26
+	.value	0x381
+	.long	0x909
+	.uleb128 0x2
+	.long	0x5b68
+	.uleb128 0x1
+	.long	0x5b5e
+	.long	.LLST17
+	.long	.LVUS17
+	.byte	0
+	.uleb128 0x3
+	.long	0x5b4f
+	.quad	.LBI811
+	.value	.LVU141
+	.quad	.LBB811
+	.quad	.LBE811-.LBB811
+	.byte	0x26
+	.value	0x3bd
+	.long	0x942
+	.uleb128 0x2
+	.long	0x5b68
+	.uleb128 0x1
+	.long	0x5b5e
+	.long	.LLST18
+	.long	.LVUS18
+	.byte	0
+	.uleb128 0x3
+	.long	0x5b4f
+	.quad	.LBI813
+	.value	.LVU155
+	.quad	.LBB813
+	.quad	.LBE813-.LBB813
+	.byte	0x26
+	.value	0x42f
+	.long	0x983
+	.uleb128 0x1
+	.long	0x5b68
+	.long	.LLST19
+	.long	.LVUS19
+	.uleb128 0x1
+	.long	0x5b5e
+	.long	.LLST20
+	.long	.LVUS20
+	.byte	0
+	.uleb128 0x3
+	.long	0x5b4f
+	.quad	.LBI815
+	.value	.LVU165
+	.quad	.LBB815
+	.quad	.LBE815-.LBB815
+	.byte	0x26
+	.value	0x46b
+	.long	0x9bc
+	.uleb128 0x2
+	.long	0x5b68
+	.uleb128 0x1
+	.long	0x5b5e
+	.long	.LLST21
+	.long	.LVUS21
+	.byte	0
+	.uleb128 0x3
+	.long	0x5b4f
+	.quad	.LBI817
+	.value	.LVU175
+	.quad	.LBB817
+	.quad	.LBE817-.LBB817
+	.byte	0x26
+	.value	0x4cb
+	.long	0x9f5
+	.uleb128 0x2
+	.long	0x5b68
+	.uleb128 0x1
+	.long	0x5b5e
+	.long	.LLST22
+	.long	.LVUS22
+	.byte	0
+	.uleb128 0x3
+	.long	0x5b4f
+	.quad	.LBI819
+	.value	.LVU185
+	.quad	.LBB819
+	.quad	.LBE819-.LBB819
+	.byte	0x26
+	.value	0x507
+	.long	0xa2e
+	.uleb128 0x2
+	.long	0x5b68
+	.uleb128 0x1
+	.long	0x5b5e
+	.long	.LLST23
+	.long	.LVUS23
+	.byte	0
+	.uleb128 0x3
+	.long	0x5b4f
+	.quad	.LBI821
+	.value	.LVU197
+	.quad	.LBB821
+	.quad	.LBE821-.LBB821
+	.byte	0x26
+	.value	0x579
+	.long	0xa67
+	.uleb128 0x2
+	.long	0x5b68
+	.uleb128 0x1
+	.long	0x5b5e
+	.long	.LLST24
+	.long	.LVUS24
+	.byte	0
+	.uleb128 0x3
+	.long	0x5b4f
+	.quad	.LBI823
+	.value	.LVU207
+	.quad	.LBB823
+	.quad	.LBE823-.LBB823
+	.byte	0x26
+	.value	0x5b5
+	.long	0xaa0
+	.uleb128 0x2
+	.long	0x5b68
+	.uleb128 0x1
+	.long	0x5b5e
+	.long	.LLST25
+	.long	.LVUS25
+	.byte	0
+	.uleb128 0x3
+	.long	0x5b4f
+	.quad	.LBI825
+	.value	.LVU217
+	.quad	.LBB825
+	.quad	.LBE825-.LBB825
+	.byte	0x26
+	.value	0x615
+	.long	0xad9
+	.uleb128 0x2
+	.long	0x5b68
+	.uleb128 0x1
+	.long	0x5b5e
+	.long	.LLST26
+	.long	.LVUS26
+	.byte	0
+	.uleb128 0x3
+	.long	0x5b4f
+	.quad	.LBI827
+	.value	.LVU226
+	.quad	.LBB827
+	.quad	.LBE827-.LBB827
+	.byte	0x26
+	.value	0x651
+	.long	0xb12
+	.uleb128 0x2
+	.long	0x5b68
+	.uleb128 0x1
+	.long	0x5b5e
+	.long	.LLST27
+	.long	.LVUS27
+	.byte	0
+	.uleb128 0x3
+	.long	0x5b4f
+	.quad	.LBI829
+	.value	.LVU240
+	.quad	.LBB829
+	.quad	.LBE829-.LBB829
+	.byte	0x26
+	.value	0x6c4
+	.long	0xb4b
+	.uleb128 0x2
+	.long	0x5b68
+	.uleb128 0x1
+	.long	0x5b5e
+	.long	.LLST28
+	.long	.LVUS28
+	.byte	0
+	.uleb128 0x3
+	.long	0x5b4f
+	.quad	.LBI831
+	.value	.LVU250
+	.quad	.LBB831
+	.quad	.LBE831-.LBB831
+	.byte	0x26
+	.value	0x700
+	.long	0xb84
+	.uleb128 0x2
+	.long	0x5b68
+	.uleb128 0x1
+	.long	0x5b5e
+	.long	.LLST29
+	.long	.LVUS29
+	.byte	0
+	.uleb128 0x3
+	.long	0x5b4f
+	.quad	.LBI833
+	.value	.LVU260
+	.quad	.LBB833
+	.quad	.LBE833-.LBB833
+	.byte	0x26
+	.value	0x761
+	.long	0xbbd
+	.uleb128 0x2
+	.long	0x5b68
+	.uleb128 0x1
+	.long	0x5b5e
+	.long	.LLST30
+	.long	.LVUS30
+	.byte	0
+	.uleb128 0x3
+	.long	0x5b4f
+	.quad	.LBI835
+	.value	.LVU270
+	.quad	.LBB835
+	.quad	.LBE835-.LBB835
+	.byte	0x26
+	.value	0x79d
+	.long	0xbf6
+	.uleb128 0x2
+	.long	0x5b68
+	.uleb128 0x1
+	.long	0x5b5e
+	.long	.LLST31
+	.long	.LVUS31
+	.byte	0
+	.uleb128 0x3
+	.long	0x5b4f
+	.quad	.LBI837
+	.value	.LVU283
+	.quad	.LBB837
+	.quad	.LBE837-.LBB837
+	.byte	0x26
+	.value	0x810
+	.long	0xc2f
+	.uleb128 0x2
+	.long	0x5b68
+	.uleb128 0x1
+	.long	0x5b5e
+	.long	.LLST32
+	.long	.LVUS32
+	.byte	0
+	.uleb128 0x3
+	.long	0x5b4f
+	.quad	.LBI839
+	.value	.LVU293
+	.quad	.LBB839
+	.quad	.LBE839-.LBB839
+	.byte	0x26
+	.value	0x84c
+	.long	0xc68
+	.uleb128 0x2
+	.long	0x5b68
+	.uleb128 0x1
+	.long	0x5b5e
+	.long	.LLST33
+	.long	.LVUS33
+	.byte	0
+	.uleb128 0x3
+	.long	0x5b4f
+	.quad	.LBI841
+	.value	.LVU303
+	.quad	.LBB841
+	.quad	.LBE841-.LBB841
+	.byte	0x26
+	.value	0x8ad
+	.long	0xca1
+	.uleb128 0x2
+	.long	0x5b68
+	.uleb128 0x1
+	.long	0x5b5e
+	.long	.LLST34
+	.long	.LVUS34
+	.byte	0
+	.uleb128 0x3
+	.long	0x5b4f
+	.quad	.LBI843
+	.value	.LVU313
+	.quad	.LBB843
+	.quad	.LBE843-.LBB843
+	.byte	0x26
+	.value	0x8e9
+	.long	0xcda
+	.uleb128 0x2
+	.long	0x5b68
+	.uleb128 0x1
+	.long	0x5b5e
+	.long	.LLST35
+	.long	.LVUS35
+	.byte	0
+	.uleb128 0x3
+	.long	0x5b4f
+	.quad	.LBI845
+	.value	.LVU328
+	.quad	.LBB845
+	.quad	.LBE845-.LBB845
+	.byte	0x26
+	.value	0x95c
+	.long	0xd1b
+	.uleb128 0x1
+	.long	0x5b68
+	.long	.LLST36
+	.long	.LVUS36
+	.uleb128 0x1
+	.long	0x5b5e
+	.long	.LLST37
+	.long	.LVUS37
+	.byte	0
+	.uleb128 0x3
+	.long	0x5b4f
+	.quad	.LBI847
+	.value	.LVU338
+	.quad	.LBB847
+	.quad	.LBE847-.LBB847
+	.byte	0x26
+	.value	0x998
+	.long	0xd54
+	.uleb128 0x2
+	.long	0x5b68
+	.uleb128 0x1
+	.long	0x5b5e
+	.long	.LLST38
+	.long	.LVUS38
+	.byte	0
+	.uleb128 0x3
+	.long	0x5b4f
+	.quad	.LBI849
+	.value	.LVU348
+	.quad	.LBB849
+	.quad	.LBE849-.LBB849
+	.byte	0x26
+	.value	0x9f9
+	.long	0xd8d
+	.uleb128 0x2
+	.long	0x5b68
+	.uleb128 0x1
+	.long	0x5b5e
+	.long	.LLST39
+	.long	.LVUS39
+	.byte	0
+	.uleb128 0x3
+	.long	0x5b4f
+	.quad	.LBI851
+	.value	.LVU358
+	.quad	.LBB851
+	.quad	.LBE851-.LBB851
+	.byte	0x26
+	.value	0xa35
+	.long	0xdc6
+	.uleb128 0x2
+	.long	0x5b68
+	.uleb128 0x1
+	.long	0x5b5e
+	.long	.LLST40
+	.long	.LVUS40
+	.byte	0
+	.uleb128 0x4
+	.long	0x5b4f
+	.quad	.LBI853
+	.value	.LVU372
+	.quad	.LBB853
+	.quad	.LBE853-.LBB853
+	.byte	0x27
+	.byte	0x51
+	.long	0xdfe
+	.uleb128 0x2
+	.long	0x5b68
+	.uleb128 0x1
+	.long	0x5b5e
+	.long	.LLST41
+	.long	.LVUS41
+	.byte	0
+	.uleb128 0x4
+	.long	0x5b4f
+	.quad	.LBI855
+	.value	.LVU382
+	.quad	.LBB855
+	.quad	.LBE855-.LBB855
+	.byte	0x27
+	.byte	0x8d
+	.long	0xe36
+	.uleb128 0x2
+	.long	0x5b68
+	.uleb128 0x1
+	.long	0x5b5e
+	.long	.LLST42
+	.long	.LVUS42
+	.byte	0
+	.uleb128 0x4
+	.long	0x5b4f
+	.quad	.LBI857
+	.value	.LVU392
+	.quad	.LBB857
+	.quad	.LBE857-.LBB857
+	.byte	0x27
+	.byte	0xed
+	.long	0xe6e
+	.uleb128 0x2
+	.long	0x5b68
+	.uleb128 0x1
+	.long	0x5b5e
+	.long	.LLST43
+	.long	.LVUS43
+	.byte	0
+	.uleb128 0x3
+	.long	0x5b4f
+	.quad	.LBI859
+	.value	.LVU402
+	.quad	.LBB859
+	.quad	.LBE859-.LBB859
+	.byte	0x27
+	.value	0x129
+	.long	0xea7
+	.uleb128 0x2
+	.long	0x5b68
+	.uleb128 0x1
+	.long	0x5b5e
+	.long	.LLST44
+	.long	.LVUS44
+	.byte	0
+	.uleb128 0x3
+	.long	0x5b4f
+	.quad	.LBI861
+	.value	.LVU415
+	.quad	.LBB861
+	.quad	.LBE861-.LBB861
+	.byte	0x27
+	.value	0x19b
+	.long	0xee0
+	.uleb128 0x2
+	.long	0x5b68
+	.uleb128 0x1
+	.long	0x5b5e
+	.long	.LLST45
+	.long	.LVUS45
+	.byte	0
+	.uleb128 0x3
+	.long	0x5b4f
+	.quad	.LBI863
+	.value	.LVU425
+	.quad	.LBB863
+	.quad	.LBE863-.LBB863
+	.byte	0x27
+	.value	0x1d7
+	.long	0xf19
+	.uleb128 0x2
+	.long	0x5b68
+	.uleb128 0x1
+	.long	0x5b5e
+	.long	.LLST46
+	.long	.LVUS46
+	.byte	0
+	.uleb128 0x3
+	.long	0x5b4f
+	.quad	.LBI865
+	.value	.LVU435
+	.quad	.LBB865
+	.quad	.LBE865-.LBB865
+	.byte	0x27
+	.value	0x237
+	.long	0xf52
+	.uleb128 0x2
+	.long	0x5b68
+	.uleb128 0x1
+	.long	0x5b5e
+	.long	.LLST47
+	.long	.LVUS47
+	.byte	0
+	.uleb128 0x5
+	.long	0x5b4f
+	.quad	.LBI867
+	.value	.LVU446
+	.long	.LLRL48
+	.byte	0x27
+	.value	0x273
+	.long	0xf7f
+	.uleb128 0x2
+	.long	0x5b68
+	.uleb128 0x1
+	.long	0x5b5e
+	.long	.LLST49
+	.long	.LVUS49
+	.byte	0
+	.uleb128 0x3
+	.long	0x5b4f
+	.quad	.LBI871
+	.value	.LVU461
+	.quad	.LBB871
+	.quad	.LBE871-.LBB871
+	.byte	0x27
+	.value	0x2e5
+	.long	0xfb8
+	.uleb128 0x2
+	.long	0x5b68
+	.uleb128 0x1
+	.long	0x5b5e
+	.long	.LLST50
+	.long	.LVUS50
+	.byte	0
+	.uleb128 0x3
+	.long	0x5b4f
+	.quad	.LBI873
+	.value	.LVU471
+	.quad	.LBB873
+	.quad	.LBE873-.LBB873
+	.byte	0x27
+	.value	0x321
+	.long	0xff1
+	.uleb128 0x2
+	.long	0x5b68
+	.uleb128 0x1
+	.long	0x5b5e
+	.long	.LLST51
+	.long	.LVUS51
+	.byte	0
+	.uleb128 0x3
+	.long	0x5b4f
+	.quad	.LBI875
+	.value	.LVU481
+	.quad	.LBB875
+	.quad	.LBE875-.LBB875
+	.byte	0x27
+	.value	0x381
+	.long	0x102a
+	.uleb128 0x2
+	.long	0x5b68
+	.uleb128 0x1
+	.long	0x5b5e
+	.long	.LLST52
+	.long	.LVUS52
+	.byte	0
+	.uleb128 0x3
+	.long	0x5b4f
+	.quad	.LBI877
+	.value	.LVU491
+	.quad	.LBB877
+	.quad	.LBE877-.LBB877
+	.byte	0x27
+	.value	0x3bd
+	.long	0x1063
+	.uleb128 0x2
+	.long	0x5b68
+	.uleb128 0x1
+	.long	0x5b5e
+	.long	.LLST53
+	.long	.LVUS53
+	.byte	0
+	.uleb128 0x3
+	.long	0x5b4f
+	.quad	.LBI879
+	.value	.LVU503
+	.quad	.LBB879
+	.quad	.LBE879-.LBB879
+	.byte	0x27
+	.value	0x42f
+	.long	0x10a4
+	.uleb128 0x1
+	.long	0x5b68
+	.long	.LLST54
+	.long	.LVUS54
+	.uleb128 0x1
+	.long	0x5b5e
+	.long	.LLST55
+	.long	.LVUS55
+	.byte	0
+	.uleb128 0x3
+	.long	0x5b4f
+	.quad	.LBI881
+	.value	.LVU513
+	.quad	.LBB881
+	.quad	.LBE881-.LBB881
+	.byte	0x27
+	.value	0x46b
+	.long	0x10dd
+	.uleb128 0x2
+	.long	0x5b68
+	.uleb128 0x1
+	.long	0x5b5e
+	.long	.LLST56
+	.long	.LVUS56
+	.byte	0
+	.uleb128 0x3
+	.long	0x5b4f
+	.quad	.LBI883
+	.value	.LVU523
+	.quad	.LBB883
+	.quad	.LBE883-.LBB883
+	.byte	0x27
+	.value	0x4cb
+	.long	0x1116
+	.uleb128 0x2
+	.long	0x5b68
+	.uleb128 0x1
+	.long	0x5b5e
+	.long	.LLST57
+	.long	.LVUS57
+	.byte	0
+	.uleb128 0x3
+	.long	0x5b4f
+	.quad	.LBI885
+	.value	.LVU533
+	.quad	.LBB885
+	.quad	.LBE885-.LBB885
+	.byte	0x27
+	.value	0x507
+	.long	0x114f
+	.uleb128 0x2
+	.long	0x5b68
+	.uleb128 0x1
+	.long	0x5b5e
+	.long	.LLST58
+	.long	.LVUS58
+	.byte	0
+	.uleb128 0x3
+	.long	0x5b4f
+	.quad	.LBI887
+	.value	.LVU545
+	.quad	.LBB887
+	.quad	.LBE887-.LBB887
+	.byte	0x27
+	.value	0x579
+	.long	0x1188
+	.uleb128 0x2
+	.long	0x5b68
+	.uleb128 0x1
+	.long	0x5b5e
+	.long	.LLST59
+	.long	.LVUS59
+	.byte	0
+	.uleb128 0x3
+	.long	0x5b4f
+	.quad	.LBI889
+	.value	.LVU555
+	.quad	.LBB889
+	.quad	.LBE889-.LBB889
+	.byte	0x27
+	.value	0x5b5
+	.long	0x11c1
+	.uleb128 0x2
+	.long	0x5b68
+	.uleb128 0x1
+	.long	0x5b5e
+	.long	.LLST60
+	.long	.LVUS60
+	.byte	0
+	.uleb128 0x3
+	.long	0x5b4f
+	.quad	.LBI891
+	.value	.LVU565
+	.quad	.LBB891
+	.quad	.LBE891-.LBB891
+	.byte	0x27
+	.value	0x615
+	.long	0x11fa
+	.uleb128 0x2
+	.long	0x5b68
+	.uleb128 0x1
+	.long	0x5b5e
+	.long	.LLST61
+	.long	.LVUS61
+	.byte	0
+	.uleb128 0x3
+	.long	0x5b4f
+	.quad	.LBI893
+	.value	.LVU574
+	.quad	.LBB893
+	.quad	.LBE893-.LBB893
+	.byte	0x27
+	.value	0x651
+	.long	0x1233
+	.uleb128 0x2
+	.long	0x5b68
+	.uleb128 0x1
+	.long	0x5b5e
+	.long	.LLST62
+	.long	.LVUS62
+	.byte	0
+	.uleb128 0x3
+	.long	0x5b4f
+	.quad	.LBI895
+	.value	.LVU589
+	.quad	.LBB895
+	.quad	.LBE895-.LBB895
+	.byte	0x27
+	.value	0x6c4
+	.long	0x126c
+	.uleb128 0x2
+	.long	0x5b68
+	.uleb128 0x1
+	.long	0x5b5e
+	.long	.LLST63
+	.long	.LVUS63
+	.byte	0
+	.uleb128 0x3
+	.long	0x5b4f
+	.quad	.LBI897
+	.value	.LVU599
+	.quad	.LBB897
+	.quad	.LBE897-.LBB897
+	.byte	0x27
+	.value	0x700
+	.long	0x12a5
+	.uleb128 0x2
+	.long	0x5b68
+	.uleb128 0x1
+	.long	0x5b5e
+	.long	.LLST64
+	.long	.LVUS64
+	.byte	0
+	.uleb128 0x3
+	.long	0x5b4f
+	.quad	.LBI899
+	.value	.LVU609
+	.quad	.LBB899
+	.quad	.LBE899-.LBB899
+	.byte	0x27
+	.value	0x761
+	.long	0x12de
+	.uleb128 0x2
+	.long	0x5b68
+	.uleb128 0x1
+	.long	0x5b5e
+	.long	.LLST65
+	.long	.LVUS65
+	.byte	0
+	.uleb128 0x3
+	.long	0x5b4f
+	.quad	.LBI901
+	.value	.LVU619
+	.quad	.LBB901
+	.quad	.LBE901-.LBB901
+	.byte	0x27
+	.value	0x79d
+	.long	0x1317
+	.uleb128 0x2
+	.long	0x5b68
+	.uleb128 0x1
+	.long	0x5b5e
+	.long	.LLST66
+	.long	.LVUS66
+	.byte	0
+	.uleb128 0x3
+	.long	0x5b4f
+	.quad	.LBI903
+	.value	.LVU633
+	.quad	.LBB903
+	.quad	.LBE903-.LBB903
+	.byte	0x27
+	.value	0x810
+	.long	0x1350
+	.uleb128 0x2
+	.long	0x5b68
+	.uleb128 0x1
+	.long	0x5b5e
+	.long	.LLST67
+	.long	.LVUS67
+	.byte	0
+	.uleb128 0x3
+	.long	0x5b4f
+	.quad	.LBI905
+	.value	.LVU644
+	.quad	.LBB905
+	.quad	.LBE905-.LBB905
+	.byte	0x27
+	.value	0x84c
+	.long	0x1389
+	.uleb128 0x2
+	.long	0x5b68
+	.uleb128 0x1
+	.long	0x5b5e
+	.long	.LLST68
+	.long	.LVUS68
+	.byte	0
+	.uleb128 0x3
+	.long	0x5b4f
+	.quad	.LBI907
+	.value	.LVU654
+	.quad	.LBB907
+	.quad	.LBE907-.LBB907
+	.byte	0x27
+	.value	0x8ad
+	.long	0x13c2
+	.uleb128 0x2
+	.long	0x5b68
+	.uleb128 0x1
+	.long	0x5b5e
+	.long	.LLST69
+	.long	.LVUS69
+	.byte	0
+	.uleb128 0x3
+	.long	0x5b4f
+	.quad	.LBI909
+	.value	.LVU664
+	.quad	.LBB909
+	.quad	.LBE909-.LBB909
+	.byte	0x27
+	.value	0x8e9
+	.long	0x13fb
+	.uleb128 0x2
+	.long	0x5b68
+	.uleb128 0x1
+	.long	0x5b5e
+	.long	.LLST70
+	.long	.LVUS70
+	.byte	0
+	.uleb128 0x3
+	.long	0x5b4f
+	.quad	.LBI911
+	.value	.LVU676
+	.quad	.LBB911
+	.quad	.LBE911-.LBB911
+	.byte	0x27
+	.value	0x95c
+	.long	0x1434
+	.uleb128 0x2
+	.long	0x5b68
+	.uleb128 0x1
+	.long	0x5b5e
+	.long	.LLST71
+	.long	.LVUS71
+	.byte	0
+	.uleb128 0x3
+	.long	0x5b4f
+	.quad	.LBI913
+	.value	.LVU686
+	.quad	.LBB913
+	.quad	.LBE913-.LBB913
+	.byte	0x27
+	.value	0x998
+	.long	0x146d
+	.uleb128 0x2
+	.long	0x5b68
+	.uleb128 0x1
+	.long	0x5b5e
+	.long	.LLST72
+	.long	.LVUS72
+	.byte	0
+	.uleb128 0x3
+	.long	0x5b4f
+	.quad	.LBI915
+	.value	.LVU696
+	.quad	.LBB915
+	.quad	.LBE915-.LBB915
+	.byte	0x27
+	.value	0x9f9
+	.long	0x14a6
+	.uleb128 0x2
+	.long	0x5b68
+	.uleb128 0x1
+	.long	0x5b5e
+	.long	.LLST73
+	.long	.LVUS73
+	.byte	0
+	.uleb128 0x3
+	.long	0x5b4f
+	.quad	.LBI917
+	.value	.LVU706
+	.quad	.LBB917
+	.quad	.LBE917-.LBB917
+	.byte	0x27
+	.value	0xa35
+	.long	0x14df
+	.uleb128 0x2
+	.long	0x5b68
+	.uleb128 0x1
+	.long	0x5b5e
+	.long	.LLST74
+	.long	.LVUS74
+	.byte	0
+	.uleb128 0x4
+	.long	0x5b4f
+	.quad	.LBI919
+	.value	.LVU720
+	.quad	.LBB919
+	.quad	.LBE919-.LBB919
+	.byte	0x28
+	.byte	0x51
+	.long	0x1517
+	.uleb128 0x2
+	.long	0x5b68
+	.uleb128 0x1
+	.long	0x5b5e
+	.long	.LLST75
+	.long	.LVUS75
+	.byte	0
+	.uleb128 0x4
+	.long	0x5b4f
+	.quad	.LBI921
+	.value	.LVU730
+	.quad	.LBB921
+	.quad	.LBE921-.LBB921
+	.byte	0x28
+	.byte	0x8d
+	.long	0x154f
+	.uleb128 0x2
+	.long	0x5b68
+	.uleb128 0x1
+	.long	0x5b5e
+	.long	.LLST76
+	.long	.LVUS76
+	.byte	0
+	.uleb128 0x4
+	.long	0x5b4f
+	.quad	.LBI923
+	.value	.LVU740
+	.quad	.LBB923
+	.quad	.LBE923-.LBB923
+	.byte	0x28
+	.byte	0xed
+	.long	0x1587
+	.uleb128 0x2
+	.long	0x5b68
+	.uleb128 0x1
+	.long	0x5b5e
+	.long	.LLST77
+	.long	.LVUS77
+	.byte	0
+	.uleb128 0x3
+	.long	0x5b4f
+	.quad	.LBI925
+	.value	.LVU750
+	.quad	.LBB925
+	.quad	.LBE925-.LBB925
+	.byte	0x28
+	.value	0x129
+	.long	0x15c0
+	.uleb128 0x2
+	.long	0x5b68
+	.uleb128 0x1
+	.long	0x5b5e
+	.long	.LLST78
+	.long	.LVUS78
+	.byte	0
+	.uleb128 0x3
+	.long	0x5b4f
+	.quad	.LBI927
+	.value	.LVU763
+	.quad	.LBB927
+	.quad	.LBE927-.LBB927
+	.byte	0x28
+	.value	0x19b
+	.long	0x15f9
+	.uleb128 0x2
+	.long	0x5b68
+	.uleb128 0x1
+	.long	0x5b5e
+	.long	.LLST79
+	.long	.LVUS79
+	.byte	0
+	.uleb128 0x3
+	.long	0x5b4f
+	.quad	.LBI929
+	.value	.LVU773
+	.quad	.LBB929
+	.quad	.LBE929-.LBB929
+	.byte	0x28
+	.value	0x1d7
+	.long	0x1632
+	.uleb128 0x2
+	.long	0x5b68
+	.uleb128 0x1
+	.long	0x5b5e
+	.long	.LLST80
+	.long	.LVUS80
+	.byte	0
+	.uleb128 0x3
+	.long	0x5b4f
+	.quad	.LBI931
+	.value	.LVU783
+	.quad	.LBB931
+	.quad	.LBE931-.LBB931
+	.byte	0x28
+	.value	0x237
+	.long	0x166b
+	.uleb128 0x2
+	.long	0x5b68
+	.uleb128 0x1
+	.long	0x5b5e
+	.long	.LLST81
+	.long	.LVUS81
+	.byte	0
+	.uleb128 0x3
+	.long	0x5b4f
+	.quad	.LBI933
+	.value	.LVU793
+	.quad	.LBB933
+	.quad	.LBE933-.LBB933
+	.byte	0x28
+	.value	0x273
+	.long	0x16a4
+	.uleb128 0x2
+	.long	0x5b68
+	.uleb128 0x1
+	.long	0x5b5e
+	.long	.LLST82
+	.long	.LVUS82
+	.byte	0
+	.uleb128 0x3
+	.long	0x5b4f
+	.quad	.LBI935
+	.value	.LVU806
+	.quad	.LBB935
+	.quad	.LBE935-.LBB935
+	.byte	0x28
+	.value	0x2e5
+	.long	0x16dd
+	.uleb128 0x2
+	.long	0x5b68
+	.uleb128 0x1
+	.long	0x5b5e
+	.long	.LLST83
+	.long	.LVUS83
+	.byte	0
+	.uleb128 0x3
+	.long	0x5b4f
+	.quad	.LBI937
+	.value	.LVU819
+	.quad	.LBB937
+	.quad	.LBE937-.LBB937
+	.byte	0x28
+	.value	0x321
+	.long	0x1716
+	.uleb128 0x2
+	.long	0x5b68
+	.uleb128 0x1
+	.long	0x5b5e
+	.long	.LLST84
+	.long	.LVUS84
+	.byte	0
+	.uleb128 0x3
+	.long	0x5b4f
+	.quad	.LBI939
+	.value	.LVU829
+	.quad	.LBB939
+	.quad	.LBE939-.LBB939
+	.byte	0x28
+	.value	0x381
+	.long	0x174f
+	.uleb128 0x2
+	.long	0x5b68
+	.uleb128 0x1
+	.long	0x5b5e
+	.long	.LLST85
+	.long	.LVUS85
+	.byte	0
+	.uleb128 0x3
+	.long	0x5b4f
+	.quad	.LBI941
+	.value	.LVU839
+	.quad	.LBB941
+	.quad	.LBE941-.LBB941
+	.byte	0x28
+	.value	0x3bd
+	.long	0x1788
+	.uleb128 0x2
+	.long	0x5b68
+	.uleb128 0x1
+	.long	0x5b5e
+	.long	.LLST86
+	.long	.LVUS86
+	.byte	0
+	.uleb128 0x3
+	.long	0x5b4f
+	.quad	.LBI943
+	.value	.LVU851
+	.quad	.LBB943
+	.quad	.LBE943-.LBB943
+	.byte	0x28
+	.value	0x42f
+	.long	0x17c9
+	.uleb128 0x1
+	.long	0x5b68
+	.long	.LLST87
+	.long	.LVUS87
+	.uleb128 0x1
+	.long	0x5b5e
+	.long	.LLST88
+	.long	.LVUS88
+	.byte	0
+	.uleb128 0x3
+	.long	0x5b4f
+	.quad	.LBI945
+	.value	.LVU861
+	.quad	.LBB945
+	.quad	.LBE945-.LBB945
+	.byte	0x28
+	.value	0x46b
+	.long	0x1802
+	.uleb128 0x2
+	.long	0x5b68
+	.uleb128 0x1
+	.long	0x5b5e
+	.long	.LLST89
+	.long	.LVUS89
+	.byte	0
+	.uleb128 0x3
+	.long	0x5b4f
+	.quad	.LBI947
+	.value	.LVU871
+	.quad	.LBB947
+	.quad	.LBE947-.LBB947
+	.byte	0x28
+	.value	0x4cb
+	.long	0x183b
+	.uleb128 0x2
+	.long	0x5b68
+	.uleb128 0x1
+	.long	0x5b5e
+	.long	.LLST90
+	.long	.LVUS90
+	.byte	0
+	.uleb128 0x3
+	.long	0x5b4f
+	.quad	.LBI949
+	.value	.LVU881
+	.quad	.LBB949
+	.quad	.LBE949-.LBB949
+	.byte	0x28
+	.value	0x507
+	.long	0x1874
+	.uleb128 0x2
+	.long	0x5b68
+	.uleb128 0x1
+	.long	0x5b5e
+	.long	.LLST91
+	.long	.LVUS91
+	.byte	0
+	.uleb128 0x3
+	.long	0x5b4f
+	.quad	.LBI951
+	.value	.LVU893
+	.quad	.LBB951
+	.quad	.LBE951-.LBB951
+	.byte	0x28
+	.value	0x579
+	.long	0x18ad
+	.uleb128 0x2
+	.long	0x5b68
+	.uleb128 0x1
+	.long	0x5b5e
+	.long	.LLST92
+	.long	.LVUS92
+	.byte	0
+	.uleb128 0x3
+	.long	0x5b4f
+	.quad	.LBI953
+	.value	.LVU903
+	.quad	.LBB953
+	.quad	.LBE953-.LBB953
+	.byte	0x28
+	.value	0x5b5
+	.long	0x18e6
+	.uleb128 0x2
+	.long	0x5b68
+	.uleb128 0x1
+	.long	0x5b5e
+	.long	.LLST93
+	.long	.LVUS93
+	.byte	0
+	.uleb128 0x3
+	.long	0x5b4f
+	.quad	.LBI955
+	.value	.LVU913
+	.quad	.LBB955
+	.quad	.LBE955-.LBB955
+	.byte	0x28
+	.value	0x615
+	.long	0x191f
+	.uleb128 0x2
+	.long	0x5b68
+	.uleb128 0x1
+	.long	0x5b5e
+	.long	.LLST94
+	.long	.LVUS94
+	.byte	0
+	.uleb128 0x5
+	.long	0x5b4f
+	.quad	.LBI957
+	.value	.LVU923
+	.long	.LLRL95
+	.byte	0x28
+	.value	0x651
+	.long	0x194c
+	.uleb128 0x2
+	.long	0x5b68
+	.uleb128 0x1
+	.long	0x5b5e
+	.long	.LLST96
+	.long	.LVUS96
+	.byte	0
+	.uleb128 0x3
+	.long	0x5b4f
+	.quad	.LBI961
+	.value	.LVU935
+	.quad	.LBB961
+	.quad	.LBE961-.LBB961
+	.byte	0x28
+	.value	0x6c4
+	.long	0x1985
+	.uleb128 0x2
+	.long	0x5b68
+	.uleb128 0x1
+	.long	0x5b5e
+	.long	.LLST97
+	.long	.LVUS97
+	.byte	0
+	.uleb128 0x3
+	.long	0x5b4f
+	.quad	.LBI963
+	.value	.LVU945
+	.quad	.LBB963
+	.quad	.LBE963-.LBB963
+	.byte	0x28
+	.value	0x700
+	.long	0x19be
+	.uleb128 0x2
+	.long	0x5b68
+	.uleb128 0x1
+	.long	0x5b5e
+	.long	.LLST98
+	.long	.LVUS98
+	.byte	0
+	.uleb128 0x3
+	.long	0x5b4f
+	.quad	.LBI965
+	.value	.LVU955
+	.quad	.LBB965
+	.quad	.LBE965-.LBB965
+	.byte	0x28
+	.value	0x761
+	.long	0x19f7
+	.uleb128 0x2
+	.long	0x5b68
+	.uleb128 0x1
+	.long	0x5b5e
+	.long	.LLST99
+	.long	.LVUS99
+	.byte	0
+	.uleb128 0x3
+	.long	0x5b4f
+	.quad	.LBI967
+	.value	.LVU965
+	.quad	.LBB967
+	.quad	.LBE967-.LBB967
+	.byte	0x28
+	.value	0x79d
+	.long	0x1a30
+	.uleb128 0x2
+	.long	0x5b68
+	.uleb128 0x1
+	.long	0x5b5e
+	.long	.LLST100
+	.long	.LVUS100
+	.byte	0
+	.uleb128 0x3
+	.long	0x5b4f
+	.quad	.LBI969
+	.value	.LVU979
+	.quad	.LBB969
+	.quad	.LBE969-.LBB969
+	.byte	0x28
+	.value	0x810
+	.long	0x1a69
+	.uleb128 0x2
+	.long	0x5b68
+	.uleb128 0x1
+	.long	0x5b5e
+	.long	.LLST101
+	.long	.LVUS101
+	.byte	0
+	.uleb128 0x3
+	.long	0x5b4f
+	.quad	.LBI971
+	.value	.LVU990
+	.quad	.LBB971
+	.quad	.LBE971-.LBB971
+	.byte	0x28
+	.value	0x84c
+	.long	0x1aa2
+	.uleb128 0x2
+	.long	0x5b68
+	.uleb128 0x1
+	.long	0x5b5e
+	.long	.LLST102
+	.long	.LVUS102
+	.byte	0
+	.uleb128 0x3
+	.long	0x5b4f
+	.quad	.LBI973
+	.value	.LVU1000
+	.quad	.LBB973
+	.quad	.LBE973-.LBB973
+	.byte	0x28
+	.value	0x8ad
+	.long	0x1adb
+	.uleb128 0x2
+	.long	0x5b68
+	.uleb128 0x1
+	.long	0x5b5e
+	.long	.LLST103
+	.long	.LVUS103
+	.byte	0
+	.uleb128 0x3
+	.long	0x5b4f
+	.quad	.LBI975
+	.value	.LVU1010
+	.quad	.LBB975
+	.quad	.LBE975-.LBB975
+	.byte	0x28
+	.value	0x8e9
+	.long	0x1b14
+	.uleb128 0x2
+	.long	0x5b68
+	.uleb128 0x1
+	.long	0x5b5e
+	.long	.LLST104
+	.long	.LVUS104
+	.byte	0
+	.uleb128 0x3
+	.long	0x5b4f
+	.quad	.LBI977
+	.value	.LVU1022
+	.quad	.LBB977
+	.quad	.LBE977-.LBB977
+	.byte	0x28
+	.value	0x95c
+	.long	0x1b4d
+	.uleb128 0x2
+	.long	0x5b68
+	.uleb128 0x1
+	.long	0x5b5e
+	.long	.LLST105
+	.long	.LVUS105
+	.byte	0
+	.uleb128 0x3
+	.long	0x5b4f
+	.quad	.LBI979
+	.value	.LVU1032
+	.quad	.LBB979
+	.quad	.LBE979-.LBB979
+	.byte	0x28
+	.value	0x998
+	.long	0x1b86
+	.uleb128 0x2
+	.long	0x5b68
+	.uleb128 0x1
+	.long	0x5b5e
+	.long	.LLST106
+	.long	.LVUS106
+	.byte	0
+	.uleb128 0x3
+	.long	0x5b4f
+	.quad	.LBI981
+	.value	.LVU1042
+	.quad	.LBB981
+	.quad	.LBE981-.LBB981
+	.byte	0x28
+	.value	0x9f9
+	.long	0x1bbf
+	.uleb128 0x2
+	.long	0x5b68
+	.uleb128 0x1
+	.long	0x5b5e
+	.long	.LLST107
+	.long	.LVUS107
+	.byte	0
+	.uleb128 0x3
+	.long	0x5b4f
+	.quad	.LBI983
+	.value	.LVU1052
+	.quad	.LBB983
+	.quad	.LBE983-.LBB983
+	.byte	0x28
+	.value	0xa35
+	.long	0x1bf8
+	.uleb128 0x2
+	.long	0x5b68
+	.uleb128 0x1
+	.long	0x5b5e
+	.long	.LLST108
+	.long	.LVUS108
+	.byte	0
+	.uleb128 0x4
+	.long	0x5b4f
+	.quad	.LBI985
+	.value	.LVU1066
+	.quad	.LBB985
+	.quad	.LBE985-.LBB985
+	.byte	0x29
+	.byte	0x51
+	.long	0x1c30
+	.uleb128 0x2
+	.long	0x5b68
+	.uleb128 0x1
+	.long	0x5b5e
+	.long	.LLST109
+	.long	.LVUS109
+	.byte	0
+	.uleb128 0x4
+	.long	0x5b4f
+	.quad	.LBI987
+	.value	.LVU1076
+	.quad	.LBB987
+	.quad	.LBE987-.LBB987
+	.byte	0x29
+	.byte	0x8d
+	.long	0x1c68
+	.uleb128 0x2
+	.long	0x5b68
+	.uleb128 0x1
+	.long	0x5b5e
+	.long	.LLST110
+	.long	.LVUS110
+	.byte	0
+	.uleb128 0x4
+	.long	0x5b4f
+	.quad	.LBI989
+	.value	.LVU1086
+	.quad	.LBB989
+	.quad	.LBE989-.LBB989
+	.byte	0x29
+	.byte	0xed
+	.long	0x1ca0
+	.uleb128 0x2
+	.long	0x5b68
+	.uleb128 0x1
+	.long	0x5b5e
+	.long	.LLST111
+	.long	.LVUS111
+	.byte	0
+	.uleb128 0x3
+	.long	0x5b4f
+	.quad	.LBI991
+	.value	.LVU1096
+	.quad	.LBB991
+	.quad	.LBE991-.LBB991
+	.byte	0x29
+	.value	0x129
+	.long	0x1cd9
+	.uleb128 0x2
+	.long	0x5b68
+	.uleb128 0x1
+	.long	0x5b5e
+	.long	.LLST112
+	.long	.LVUS112
+	.byte	0
+	.uleb128 0x3
+	.long	0x5b4f
+	.quad	.LBI993
+	.value	.LVU1109
+	.quad	.LBB993
+	.quad	.LBE993-.LBB993
+	.byte	0x29
+	.value	0x19b
+	.long	0x1d12
+	.uleb128 0x2
+	.long	0x5b68
+	.uleb128 0x1
+	.long	0x5b5e
+	.long	.LLST113
+	.long	.LVUS113
+	.byte	0
+	.uleb128 0x3
+	.long	0x5b4f
+	.quad	.LBI995
+	.value	.LVU1119
+	.quad	.LBB995
+	.quad	.LBE995-.LBB995
+	.byte	0x29
+	.value	0x1d7
+	.long	0x1d4b
+	.uleb128 0x2
+	.long	0x5b68
+	.uleb128 0x1
+	.long	0x5b5e
+	.long	.LLST114
+	.long	.LVUS114
+	.byte	0
+	.uleb128 0x3
+	.long	0x5b4f
+	.quad	.LBI997
+	.value	.LVU1129
+	.quad	.LBB997
+	.quad	.LBE997-.LBB997
+	.byte	0x29
+	.value	0x237
+	.long	0x1d84
+	.uleb128 0x2
+	.long	0x5b68
+	.uleb128 0x1
+	.long	0x5b5e
+	.long	.LLST115
+	.long	.LVUS115
+	.byte	0
+	.uleb128 0x3
+	.long	0x5b4f
+	.quad	.LBI999
+	.value	.LVU1139
+	.quad	.LBB999
+	.quad	.LBE999-.LBB999
+	.byte	0x29
+	.value	0x273
+	.long	0x1dbd
+	.uleb128 0x2
+	.long	0x5b68
+	.uleb128 0x1
+	.long	0x5b5e
+	.long	.LLST116
+	.long	.LVUS116
+	.byte	0
+	.uleb128 0x3
+	.long	0x5b4f
+	.quad	.LBI1001
+	.value	.LVU1153
+	.quad	.LBB1001
+	.quad	.LBE1001-.LBB1001
+	.byte	0x29
+	.value	0x2e5
+	.long	0x1df6
+	.uleb128 0x2
+	.long	0x5b68
+	.uleb128 0x1
+	.long	0x5b5e
+	.long	.LLST117
+	.long	.LVUS117
+	.byte	0
+	.uleb128 0x3
+	.long	0x5b4f
+	.quad	.LBI1003
+	.value	.LVU1163
+	.quad	.LBB1003
+	.quad	.LBE1003-.LBB1003
+	.byte	0x29
+	.value	0x321
+	.long	0x1e2f
+	.uleb128 0x2
+	.long	0x5b68
+	.uleb128 0x1
+	.long	0x5b5e
+	.long	.LLST118
+	.long	.LVUS118
+	.byte	0
+	.uleb128 0x3
+	.long	0x5b4f
+	.quad	.LBI1005
+	.value	.LVU1173
+	.quad	.LBB1005
+	.quad	.LBE1005-.LBB1005
+	.byte	0x29
+	.value	0x381
+	.long	0x1e68
+	.uleb128 0x2
+	.long	0x5b68
+	.uleb128 0x1
+	.long	0x5b5e
+	.long	.LLST119
+	.long	.LVUS119
+	.byte	0
+	.uleb128 0x5
+	.long	0x5b4f
+	.quad	.LBI1007
+	.value	.LVU1184
+	.long	.LLRL120
+	.byte	0x29
+	.value	0x3bd
+	.long	0x1e95
+	.uleb128 0x2
+	.long	0x5b68
+	.uleb128 0x1
+	.long	0x5b5e
+	.long	.LLST121
+	.long	.LVUS121
+	.byte	0
+	.uleb128 0x3
+	.long	0x5b4f
+	.quad	.LBI1011
+	.value	.LVU1197
+	.quad	.LBB1011
+	.quad	.LBE1011-.LBB1011
+	.byte	0x29
+	.value	0x42f
+	.long	0x1ed6
+	.uleb128 0x1
+	.long	0x5b68
+	.long	.LLST122
+	.long	.LVUS122
+	.uleb128 0x1
+	.long	0x5b5e
+	.long	.LLST123
+	.long	.LVUS123
+	.byte	0
+	.uleb128 0x3
+	.long	0x5b4f
+	.quad	.LBI1013
+	.value	.LVU1207
+	.quad	.LBB1013
+	.quad	.LBE1013-.LBB1013
+	.byte	0x29
+	.value	0x46b
+	.long	0x1f0f
+	.uleb128 0x2
+	.long	0x5b68
+	.uleb128 0x1
+	.long	0x5b5e
+	.long	.LLST124
+	.long	.LVUS124
+	.byte	0
+	.uleb128 0x3
+	.long	0x5b4f
+	.quad	.LBI1015
+	.value	.LVU1217
+	.quad	.LBB1015
+	.quad	.LBE1015-.LBB1015
+	.byte	0x29
+	.value	0x4cb
+	.long	0x1f48
+	.uleb128 0x2
+	.long	0x5b68
+	.uleb128 0x1
+	.long	0x5b5e
+	.long	.LLST125
+	.long	.LVUS125
+	.byte	0
+	.uleb128 0x3
+	.long	0x5b4f
+	.quad	.LBI1017
+	.value	.LVU1227
+	.quad	.LBB1017
+	.quad	.LBE1017-.LBB1017
+	.byte	0x29
+	.value	0x507
+	.long	0x1f81
+	.uleb128 0x2
+	.long	0x5b68
+	.uleb128 0x1
+	.long	0x5b5e
+	.long	.LLST126
+	.long	.LVUS126
+	.byte	0
+	.uleb128 0x3
+	.long	0x5b4f
+	.quad	.LBI1019
+	.value	.LVU1239
+	.quad	.LBB1019
+	.quad	.LBE1019-.LBB1019
+	.byte	0x29
+	.value	0x579
+	.long	0x1fba
+	.uleb128 0x2
+	.long	0x5b68
+	.uleb128 0x1
+	.long	0x5b5e
+	.long	.LLST127
+	.long	.LVUS127
+	.byte	0
+	.uleb128 0x3
+	.long	0x5b4f
+	.quad	.LBI1021
+	.value	.LVU1249
+	.quad	.LBB1021
+	.quad	.LBE1021-.LBB1021
+	.byte	0x29
+	.value	0x5b5
+	.long	0x1ff3
+	.uleb128 0x2
+	.long	0x5b68
+	.uleb128 0x1
+	.long	0x5b5e
+	.long	.LLST128
+	.long	.LVUS128
+	.byte	0
+	.uleb128 0x3
+	.long	0x5b4f
+	.quad	.LBI1023
+	.value	.LVU1259
+	.quad	.LBB1023
+	.quad	.LBE1023-.LBB1023
+	.byte	0x29
+	.value	0x615
+	.long	0x202c
+	.uleb128 0x2
+	.long	0x5b68
+	.uleb128 0x1
+	.long	0x5b5e
+	.long	.LLST129
+	.long	.LVUS129
+	.byte	0
+	.uleb128 0x3
+	.long	0x5b4f
+	.quad	.LBI1025
+	.value	.LVU1268
+	.quad	.LBB1025
+	.quad	.LBE1025-.LBB1025
+	.byte	0x29
+	.value	0x651
+	.long	0x2065
+	.uleb128 0x2
+	.long	0x5b68
+	.uleb128 0x1
+	.long	0x5b5e
+	.long	.LLST130
+	.long	.LVUS130
+	.byte	0
+	.uleb128 0x3
+	.long	0x5b4f
+	.quad	.LBI1027
+	.value	.LVU1282
+	.quad	.LBB1027
+	.quad	.LBE1027-.LBB1027
+	.byte	0x29
+	.value	0x6c4
+	.long	0x209e
+	.uleb128 0x2
+	.long	0x5b68
+	.uleb128 0x1
+	.long	0x5b5e
+	.long	.LLST131
+	.long	.LVUS131
+	.byte	0
+	.uleb128 0x3
+	.long	0x5b4f
+	.quad	.LBI1029
+	.value	.LVU1292
+	.quad	.LBB1029
+	.quad	.LBE1029-.LBB1029
+	.byte	0x29
+	.value	0x700
+	.long	0x20d7
+	.uleb128 0x2
+	.long	0x5b68
+	.uleb128 0x1
+	.long	0x5b5e
+	.long	.LLST132
+	.long	.LVUS132
+	.byte	0
+	.uleb128 0x5
+	.long	0x5b4f
+	.quad	.LBI1031
+	.value	.LVU1302
+	.long	.LLRL133
+	.byte	0x29
+	.value	0x761
+	.long	0x2104
+	.uleb128 0x2
+	.long	0x5b68
+	.uleb128 0x1
+	.long	0x5b5e
+	.long	.LLST134
+	.long	.LVUS134
+	.byte	0
+	.uleb128 0x3
+	.long	0x5b4f
+	.quad	.LBI1035
+	.value	.LVU1313
+	.quad	.LBB1035
+	.quad	.LBE1035-.LBB1035
+	.byte	0x29
+	.value	0x79d
+	.long	0x213d
+	.uleb128 0x2
+	.long	0x5b68
+	.uleb128 0x1
+	.long	0x5b5e
+	.long	.LLST135
+	.long	.LVUS135
+	.byte	0
+	.uleb128 0x3
+	.long	0x5b4f
+	.quad	.LBI1037
+	.value	.LVU1327
+	.quad	.LBB1037
+	.quad	.LBE1037-.LBB1037
+	.byte	0x29
+	.value	0x810
+	.long	0x2176
+	.uleb128 0x2
+	.long	0x5b68
+	.uleb128 0x1
+	.long	0x5b5e
+	.long	.LLST136
+	.long	.LVUS136
+	.byte	0
+	.uleb128 0x3
+	.long	0x5b4f
+	.quad	.LBI1039
+	.value	.LVU1338
+	.quad	.LBB1039
+	.quad	.LBE1039-.LBB1039
+	.byte	0x29
+	.value	0x84c
+	.long	0x21af
+	.uleb128 0x2
+	.long	0x5b68
+	.uleb128 0x1
+	.long	0x5b5e
+	.long	.LLST137
+	.long	.LVUS137
+	.byte	0
+	.uleb128 0x3
+	.long	0x5b4f
+	.quad	.LBI1041
+	.value	.LVU1348
+	.quad	.LBB1041
+	.quad	.LBE1041-.LBB1041
+	.byte	0x29
+	.value	0x8ad
+	.long	0x21e8
+	.uleb128 0x2
+	.long	0x5b68
+	.uleb128 0x1
+	.long	0x5b5e
+	.long	.LLST138
+	.long	.LVUS138
+	.byte	0
+	.uleb128 0x3
+	.long	0x5b4f
+	.quad	.LBI1043
+	.value	.LVU1358
+	.quad	.LBB1043
+	.quad	.LBE1043-.LBB1043
+	.byte	0x29
+	.value	0x8e9
+	.long	0x2221
+	.uleb128 0x2
+	.long	0x5b68
+	.uleb128 0x1
+	.long	0x5b5e
+	.long	.LLST139
+	.long	.LVUS139
+	.byte	0
+	.uleb128 0x3
+	.long	0x5b4f
+	.quad	.LBI1045
+	.value	.LVU1370
+	.quad	.LBB1045
+	.quad	.LBE1045-.LBB1045
+	.byte	0x29
+	.value	0x95c
+	.long	0x225a
+	.uleb128 0x2
+	.long	0x5b68
+	.uleb128 0x1
+	.long	0x5b5e
+	.long	.LLST140
+	.long	.LVUS140
+	.byte	0
+	.uleb128 0x3
+	.long	0x5b4f
+	.quad	.LBI1047
+	.value	.LVU1380
+	.quad	.LBB1047
+	.quad	.LBE1047-.LBB1047
+	.byte	0x29
+	.value	0x998
+	.long	0x2293
+	.uleb128 0x2
+	.long	0x5b68
+	.uleb128 0x1
+	.long	0x5b5e
+	.long	.LLST141
+	.long	.LVUS141
+	.byte	0
+	.uleb128 0x3
+	.long	0x5b4f
+	.quad	.LBI1049
+	.value	.LVU1390
+	.quad	.LBB1049
+	.quad	.LBE1049-.LBB1049
+	.byte	0x29
+	.value	0x9f9
+	.long	0x22cc
+	.uleb128 0x2
+	.long	0x5b68
+	.uleb128 0x1
+	.long	0x5b5e
+	.long	.LLST142
+	.long	.LVUS142
+	.byte	0
+	.uleb128 0x3
+	.long	0x5b4f
+	.quad	.LBI1051
+	.value	.LVU1400
+	.quad	.LBB1051
+	.quad	.LBE1051-.LBB1051
+	.byte	0x29
+	.value	0xa35
+	.long	0x2305
+	.uleb128 0x2
+	.long	0x5b68
+	.uleb128 0x1
+	.long	0x5b5e
+	.long	.LLST143
+	.long	.LVUS143
+	.byte	0
+	.uleb128 0x4
+	.long	0x5b4f
+	.quad	.LBI1053
+	.value	.LVU1414
+	.quad	.LBB1053
+	.quad	.LBE1053-.LBB1053
+	.byte	0x2a
+	.byte	0x51
+	.long	0x233d
+	.uleb128 0x2
+	.long	0x5b68
+	.uleb128 0x1
+	.long	0x5b5e
+	.long	.LLST144
+	.long	.LVUS144
+	.byte	0
+	.uleb128 0x4
+	.long	0x5b4f
+	.quad	.LBI1055
+	.value	.LVU1424
+	.quad	.LBB1055
+	.quad	.LBE1055-.LBB1055
+	.byte	0x2a
+	.byte	0x8d
+	.long	0x2375
+	.uleb128 0x2
+	.long	0x5b68
+	.uleb128 0x1
+	.long	0x5b5e
+	.long	.LLST145
+	.long	.LVUS145
+	.byte	0
+	.uleb128 0x4
+	.long	0x5b4f
+	.quad	.LBI1057
+	.value	.LVU1434
+	.quad	.LBB1057
+	.quad	.LBE1057-.LBB1057
+	.byte	0x2a
+	.byte	0xed
+	.long	0x23ad
+	.uleb128 0x2
+	.long	0x5b68
+	.uleb128 0x1
+	.long	0x5b5e
+	.long	.LLST146
+	.long	.LVUS146
+	.byte	0
+	.uleb128 0x3
+	.long	0x5b4f
+	.quad	.LBI1059
+	.value	.LVU1444
+	.quad	.LBB1059
+	.quad	.LBE1059-.LBB1059
+	.byte	0x2a
+	.value	0x129
+	.long	0x23e6
+	.uleb128 0x2
+	.long	0x5b68
+	.uleb128 0x1
+	.long	0x5b5e
+	.long	.LLST147
+	.long	.LVUS147
+	.byte	0
+	.uleb128 0x3
+	.long	0x5b4f
+	.quad	.LBI1061
+	.value	.LVU1458
+	.quad	.LBB1061
+	.quad	.LBE1061-.LBB1061
+	.byte	0x2a
+	.value	0x19b
+	.long	0x241f
+	.uleb128 0x2
+	.long	0x5b68
+	.uleb128 0x1
+	.long	0x5b5e
+	.long	.LLST148
+	.long	.LVUS148
+	.byte	0
+	.uleb128 0x3
+	.long	0x5b4f
+	.quad	.LBI1063
+	.value	.LVU1468
+	.quad	.LBB1063
+	.quad	.LBE1063-.LBB1063
+	.byte	0x2a
+	.value	0x1d7
+	.long	0x2458
+	.uleb128 0x2
+	.long	0x5b68
+	.uleb128 0x1
+	.long	0x5b5e
+	.long	.LLST149
+	.long	.LVUS149
+	.byte	0
+	.uleb128 0x3
+	.long	0x5b4f
+	.quad	.LBI1065
+	.value	.LVU1478
+	.quad	.LBB1065
+	.quad	.LBE1065-.LBB1065
+	.byte	0x2a
+	.value	0x237
+	.long	0x2491
+	.uleb128 0x2
+	.long	0x5b68
+	.uleb128 0x1
+	.long	0x5b5e
+	.long	.LLST150
+	.long	.LVUS150
+	.byte	0
+	.uleb128 0x3
+	.long	0x5b4f
+	.quad	.LBI1067
+	.value	.LVU1488
+	.quad	.LBB1067
+	.quad	.LBE1067-.LBB1067
+	.byte	0x2a
+	.value	0x273
+	.long	0x24ca
+	.uleb128 0x2
+	.long	0x5b68
+	.uleb128 0x1
+	.long	0x5b5e
+	.long	.LLST151
+	.long	.LVUS151
+	.byte	0
+	.uleb128 0x3
+	.long	0x5b4f
+	.quad	.LBI1069
+	.value	.LVU1502
+	.quad	.LBB1069
+	.quad	.LBE1069-.LBB1069
+	.byte	0x2a
+	.value	0x2e5
+	.long	0x2503
+	.uleb128 0x2
+	.long	0x5b68
+	.uleb128 0x1
+	.long	0x5b5e
+	.long	.LLST152
+	.long	.LVUS152
+	.byte	0
+	.uleb128 0x3
+	.long	0x5b4f
+	.quad	.LBI1071
+	.value	.LVU1512
+	.quad	.LBB1071
+	.quad	.LBE1071-.LBB1071
+	.byte	0x2a
+	.value	0x321
+	.long	0x253c
+	.uleb128 0x2
+	.long	0x5b68
+	.uleb128 0x1
+	.long	0x5b5e
+	.long	.LLST153
+	.long	.LVUS153
+	.byte	0
+	.uleb128 0x3
+	.long	0x5b4f
+	.quad	.LBI1073
+	.value	.LVU1522
+	.quad	.LBB1073
+	.quad	.LBE1073-.LBB1073
+	.byte	0x2a
+	.value	0x381
+	.long	0x2575
+	.uleb128 0x2
+	.long	0x5b68
+	.uleb128 0x1
+	.long	0x5b5e
+	.long	.LLST154
+	.long	.LVUS154
+	.byte	0
+	.uleb128 0x3
+	.long	0x5b4f
+	.quad	.LBI1075
+	.value	.LVU1532
+	.quad	.LBB1075
+	.quad	.LBE1075-.LBB1075
+	.byte	0x2a
+	.value	0x3bd
+	.long	0x25ae
+	.uleb128 0x2
+	.long	0x5b68
+	.uleb128 0x1
+	.long	0x5b5e
+	.long	.LLST155
+	.long	.LVUS155
+	.byte	0
+	.uleb128 0x3
+	.long	0x5b4f
+	.quad	.LBI1077
+	.value	.LVU1544
+	.quad	.LBB1077
+	.quad	.LBE1077-.LBB1077
+	.byte	0x2a
+	.value	0x42f
+	.long	0x25ef
+	.uleb128 0x1
+	.long	0x5b68
+	.long	.LLST156
+	.long	.LVUS156
+	.uleb128 0x1
+	.long	0x5b5e
+	.long	.LLST157
+	.long	.LVUS157
+	.byte	0
+	.uleb128 0x3
+	.long	0x5b4f
+	.quad	.LBI1079
+	.value	.LVU1554
+	.quad	.LBB1079
+	.quad	.LBE1079-.LBB1079
+	.byte	0x2a
+	.value	0x46b
+	.long	0x2628
+	.uleb128 0x2
+	.long	0x5b68
+	.uleb128 0x1
+	.long	0x5b5e
+	.long	.LLST158
+	.long	.LVUS158
+	.byte	0
+	.uleb128 0x3
+	.long	0x5b4f
+	.quad	.LBI1081
+	.value	.LVU1564
+	.quad	.LBB1081
+	.quad	.LBE1081-.LBB1081
+	.byte	0x2a
+	.value	0x4cb
+	.long	0x2661
+	.uleb128 0x2
+	.long	0x5b68
+	.uleb128 0x1
+	.long	0x5b5e
+	.long	.LLST159
+	.long	.LVUS159
+	.byte	0
+	.uleb128 0x3
+	.long	0x5b4f
+	.quad	.LBI1083
+	.value	.LVU1574
+	.quad	.LBB1083
+	.quad	.LBE1083-.LBB1083
+	.byte	0x2a
+	.value	0x507
+	.long	0x269a
+	.uleb128 0x2
+	.long	0x5b68
+	.uleb128 0x1
+	.long	0x5b5e
+	.long	.LLST160
+	.long	.LVUS160
+	.byte	0
+	.uleb128 0x3
+	.long	0x5b4f
+	.quad	.LBI1085
+	.value	.LVU1586
+	.quad	.LBB1085
+	.quad	.LBE1085-.LBB1085
+	.byte	0x2a
+	.value	0x579
+	.long	0x26d3
+	.uleb128 0x2
+	.long	0x5b68
+	.uleb128 0x1
+	.long	0x5b5e
+	.long	.LLST161
+	.long	.LVUS161
+	.byte	0
+	.uleb128 0x3
+	.long	0x5b4f
+	.quad	.LBI1087
+	.value	.LVU1596
+	.quad	.LBB1087
+	.quad	.LBE1087-.LBB1087
+	.byte	0x2a
+	.value	0x5b5
+	.long	0x270c
+	.uleb128 0x2
+	.long	0x5b68
+	.uleb128 0x1
+	.long	0x5b5e
+	.long	.LLST162
+	.long	.LVUS162
+	.byte	0
+	.uleb128 0x3
+	.long	0x5b4f
+	.quad	.LBI1089
+	.value	.LVU1606
+	.quad	.LBB1089
+	.quad	.LBE1089-.LBB1089
+	.byte	0x2a
+	.value	0x615
+	.long	0x2745
+	.uleb128 0x2
+	.long	0x5b68
+	.uleb128 0x1
+	.long	0x5b5e
+	.long	.LLST163
+	.long	.LVUS163
+	.byte	0
+	.uleb128 0x3
+	.long	0x5b4f
+	.quad	.LBI1091
+	.value	.LVU1615
+	.quad	.LBB1091
+	.quad	.LBE1091-.LBB1091
+	.byte	0x2a
+	.value	0x651
+	.long	0x277e
+	.uleb128 0x2
+	.long	0x5b68
+	.uleb128 0x1
+	.long	0x5b5e
+	.long	.LLST164
+	.long	.LVUS164
+	.byte	0
+	.uleb128 0x3
+	.long	0x5b4f
+	.quad	.LBI1093
+	.value	.LVU1629
+	.quad	.LBB1093
+	.quad	.LBE1093-.LBB1093
+	.byte	0x2a
+	.value	0x6c4
+	.long	0x27b7
+	.uleb128 0x2
+	.long	0x5b68
+	.uleb128 0x1
+	.long	0x5b5e
+	.long	.LLST165
+	.long	.LVUS165
+	.byte	0
+	.uleb128 0x3
+	.long	0x5b4f
+	.quad	.LBI1095
+	.value	.LVU1639
+	.quad	.LBB1095
+	.quad	.LBE1095-.LBB1095
+	.byte	0x2a
+	.value	0x700
+	.long	0x27f0
+	.uleb128 0x2
+	.long	0x5b68
+	.uleb128 0x1
+	.long	0x5b5e
+	.long	.LLST166
+	.long	.LVUS166
+	.byte	0
+	.uleb128 0x3
+	.long	0x5b4f
+	.quad	.LBI1097
+	.value	.LVU1649
+	.quad	.LBB1097
+	.quad	.LBE1097-.LBB1097
+	.byte	0x2a
+	.value	0x761
+	.long	0x2829
+	.uleb128 0x2
+	.long	0x5b68
+	.uleb128 0x1
+	.long	0x5b5e
+	.long	.LLST167
+	.long	.LVUS167
+	.byte	0
+	.uleb128 0x3
+	.long	0x5b4f
+	.quad	.LBI1099
+	.value	.LVU1659
+	.quad	.LBB1099
+	.quad	.LBE1099-.LBB1099
+	.byte	0x2a
+	.value	0x79d
+	.long	0x2862
+	.uleb128 0x2
+	.long	0x5b68
+	.uleb128 0x1
+	.long	0x5b5e
+	.long	.LLST168
+	.long	.LVUS168
+	.byte	0
+	.uleb128 0x5
+	.long	0x5b4f
+	.quad	.LBI1101
+	.value	.LVU1670
+	.long	.LLRL169
+	.byte	0x2a
+	.value	0x810
+	.long	0x2897
+	.uleb128 0x1
+	.long	0x5b68
+	.long	.LLST170
+	.long	.LVUS170
+	.uleb128 0x1
+	.long	0x5b5e
+	.long	.LLST171
+	.long	.LVUS171
+	.byte	0
+	.uleb128 0x3
+	.long	0x5b4f
+	.quad	.LBI1105
+	.value	.LVU1684
+	.quad	.LBB1105
+	.quad	.LBE1105-.LBB1105
+	.byte	0x2a
+	.value	0x84c
+	.long	0x28d0
+	.uleb128 0x2
+	.long	0x5b68
+	.uleb128 0x1
+	.long	0x5b5e
+	.long	.LLST172
+	.long	.LVUS172
+	.byte	0
+	.uleb128 0x3
+	.long	0x5b4f
+	.quad	.LBI1107
+	.value	.LVU1694
+	.quad	.LBB1107
+	.quad	.LBE1107-.LBB1107
+	.byte	0x2a
+	.value	0x8ad
+	.long	0x2909
+	.uleb128 0x2
+	.long	0x5b68
+	.uleb128 0x1
+	.long	0x5b5e
+	.long	.LLST173
+	.long	.LVUS173
+	.byte	0
+	.uleb128 0x3
+	.long	0x5b4f
+	.quad	.LBI1109
+	.value	.LVU1704
+	.quad	.LBB1109
+	.quad	.LBE1109-.LBB1109
+	.byte	0x2a
+	.value	0x8e9
+	.long	0x2942
+	.uleb128 0x2
+	.long	0x5b68
+	.uleb128 0x1
+	.long	0x5b5e
+	.long	.LLST174
+	.long	.LVUS174
+	.byte	0
+	.uleb128 0x3
+	.long	0x5b4f
+	.quad	.LBI1111
+	.value	.LVU1716
+	.quad	.LBB1111
+	.quad	.LBE1111-.LBB1111
+	.byte	0x2a
+	.value	0x95c
+	.long	0x297b
+	.uleb128 0x2
+	.long	0x5b68
+	.uleb128 0x1
+	.long	0x5b5e
+	.long	.LLST175
+	.long	.LVUS175
+	.byte	0
+	.uleb128 0x3
+	.long	0x5b4f
+	.quad	.LBI1113
+	.value	.LVU1726
+	.quad	.LBB1113
+	.quad	.LBE1113-.LBB1113
+	.byte	0x2a
+	.value	0x998
+	.long	0x29b4
+	.uleb128 0x2
+	.long	0x5b68
+	.uleb128 0x1
+	.long	0x5b5e
+	.long	.LLST176
+	.long	.LVUS176
+	.byte	0
+	.uleb128 0x3
+	.long	0x5b4f
+	.quad	.LBI1115
+	.value	.LVU1736
+	.quad	.LBB1115
+	.quad	.LBE1115-.LBB1115
+	.byte	0x2a
+	.value	0x9f9
+	.long	0x29ed
+	.uleb128 0x2
+	.long	0x5b68
+	.uleb128 0x1
+	.long	0x5b5e
+	.long	.LLST177
+	.long	.LVUS177
+	.byte	0
+	.uleb128 0x3
+	.long	0x5b4f
+	.quad	.LBI1117
+	.value	.LVU1746
+	.quad	.LBB1117
+	.quad	.LBE1117-.LBB1117
+	.byte	0x2a
+	.value	0xa35
+	.long	0x2a26
+	.uleb128 0x2
+	.long	0x5b68
+	.uleb128 0x1
+	.long	0x5b5e
+	.long	.LLST178
+	.long	.LVUS178
+	.byte	0
+	.uleb128 0x4
+	.long	0x5b4f
+	.quad	.LBI1119
+	.value	.LVU1760
+	.quad	.LBB1119
+	.quad	.LBE1119-.LBB1119
+	.byte	0x2b
+	.byte	0x51
+	.long	0x2a5e
+	.uleb128 0x2
+	.long	0x5b68
+	.uleb128 0x1
+	.long	0x5b5e
+	.long	.LLST179
+	.long	.LVUS179
+	.byte	0
+	.uleb128 0x4
+	.long	0x5b4f
+	.quad	.LBI1121
+	.value	.LVU1770
+	.quad	.LBB1121
+	.quad	.LBE1121-.LBB1121
+	.byte	0x2b
+	.byte	0x8d
+	.long	0x2a96
+	.uleb128 0x2
+	.long	0x5b68
+	.uleb128 0x1
+	.long	0x5b5e
+	.long	.LLST180
+	.long	.LVUS180
+	.byte	0
+	.uleb128 0x4
+	.long	0x5b4f
+	.quad	.LBI1123
+	.value	.LVU1780
+	.quad	.LBB1123
+	.quad	.LBE1123-.LBB1123
+	.byte	0x2b
+	.byte	0xed
+	.long	0x2ace
+	.uleb128 0x2
+	.long	0x5b68
+	.uleb128 0x1
+	.long	0x5b5e
+	.long	.LLST181
+	.long	.LVUS181
+	.byte	0
+	.uleb128 0x5
+	.long	0x5b4f
+	.quad	.LBI1125
+	.value	.LVU1791
+	.long	.LLRL182
+	.byte	0x2b
+	.value	0x129
+	.long	0x2afb
+	.uleb128 0x2
+	.long	0x5b68
+	.uleb128 0x1
+	.long	0x5b5e
+	.long	.LLST183
+	.long	.LVUS183
+	.byte	0
+	.uleb128 0x3
+	.long	0x5b4f
+	.quad	.LBI1129
+	.value	.LVU1803
+	.quad	.LBB1129
+	.quad	.LBE1129-.LBB1129
+	.byte	0x2b
+	.value	0x19b
+	.long	0x2b34
+	.uleb128 0x2
+	.long	0x5b68
+	.uleb128 0x1
+	.long	0x5b5e
+	.long	.LLST184
+	.long	.LVUS184
+	.byte	0
+	.uleb128 0x3
+	.long	0x5b4f
+	.quad	.LBI1131
+	.value	.LVU1813
+	.quad	.LBB1131
+	.quad	.LBE1131-.LBB1131
+	.byte	0x2b
+	.value	0x1d7
+	.long	0x2b6d
+	.uleb128 0x2
+	.long	0x5b68
+	.uleb128 0x1
+	.long	0x5b5e
+	.long	.LLST185
+	.long	.LVUS185
+	.byte	0
+	.uleb128 0x3
+	.long	0x5b4f
+	.quad	.LBI1133
+	.value	.LVU1823
+	.quad	.LBB1133
+	.quad	.LBE1133-.LBB1133
+	.byte	0x2b
+	.value	0x237
+	.long	0x2ba6
+	.uleb128 0x2
+	.long	0x5b68
+	.uleb128 0x1
+	.long	0x5b5e
+	.long	.LLST186
+	.long	.LVUS186
+	.byte	0
+	.uleb128 0x3
+	.long	0x5b4f
+	.quad	.LBI1135
+	.value	.LVU1833
+	.quad	.LBB1135
+	.quad	.LBE1135-.LBB1135
+	.byte	0x2b
+	.value	0x273
+	.long	0x2bdf
+	.uleb128 0x2
+	.long	0x5b68
+	.uleb128 0x1
+	.long	0x5b5e
+	.long	.LLST187
+	.long	.LVUS187
+	.byte	0
+	.uleb128 0x3
+	.long	0x5b4f
+	.quad	.LBI1137
+	.value	.LVU1847
+	.quad	.LBB1137
+	.quad	.LBE1137-.LBB1137
+	.byte	0x2b
+	.value	0x2e5
+	.long	0x2c18
+	.uleb128 0x2
+	.long	0x5b68
+	.uleb128 0x1
+	.long	0x5b5e
+	.long	.LLST188
+	.long	.LVUS188
+	.byte	0
+	.uleb128 0x3
+	.long	0x5b4f
+	.quad	.LBI1139
+	.value	.LVU1858
+	.quad	.LBB1139
+	.quad	.LBE1139-.LBB1139
+	.byte	0x2b
+	.value	0x321
+	.long	0x2c51
+	.uleb128 0x2
+	.long	0x5b68
+	.uleb128 0x1
+	.long	0x5b5e
+	.long	.LLST189
+	.long	.LVUS189
+	.byte	0
+	.uleb128 0x3
+	.long	0x5b4f
+	.quad	.LBI1141
+	.value	.LVU1868
+	.quad	.LBB1141
+	.quad	.LBE1141-.LBB1141
+	.byte	0x2b
+	.value	0x381
+	.long	0x2c8a
+	.uleb128 0x2
+	.long	0x5b68
+	.uleb128 0x1
+	.long	0x5b5e
+	.long	.LLST190
+	.long	.LVUS190
+	.byte	0
+	.uleb128 0x3
+	.long	0x5b4f
+	.quad	.LBI1143
+	.value	.LVU1878
+	.quad	.LBB1143
+	.quad	.LBE1143-.LBB1143
+	.byte	0x2b
+	.value	0x3bd
+	.long	0x2cc3
+	.uleb128 0x2
+	.long	0x5b68
+	.uleb128 0x1
+	.long	0x5b5e
+	.long	.LLST191
+	.long	.LVUS191
+	.byte	0
+	.uleb128 0x3
+	.long	0x5b4f
+	.quad	.LBI1145
+	.value	.LVU1890
+	.quad	.LBB1145
+	.quad	.LBE1145-.LBB1145
+	.byte	0x2b
+	.value	0x42f
+	.long	0x2d04
+	.uleb128 0x1
+	.long	0x5b68
+	.long	.LLST192
+	.long	.LVUS192
+	.uleb128 0x1
+	.long	0x5b5e
+	.long	.LLST193
+	.long	.LVUS193
+	.byte	0
+	.uleb128 0x3
+	.long	0x5b4f
+	.quad	.LBI1147
+	.value	.LVU1900
+	.quad	.LBB1147
+	.quad	.LBE1147-.LBB1147
+	.byte	0x2b
+	.value	0x46b
+	.long	0x2d3d
+	.uleb128 0x2
+	.long	0x5b68
+	.uleb128 0x1
+	.long	0x5b5e
+	.long	.LLST194
+	.long	.LVUS194
+	.byte	0
+	.uleb128 0x3
+	.long	0x5b4f
+	.quad	.LBI1149
+	.value	.LVU1910
+	.quad	.LBB1149
+	.quad	.LBE1149-.LBB1149
+	.byte	0x2b
+	.value	0x4cb
+	.long	0x2d76
+	.uleb128 0x2
+	.long	0x5b68
+	.uleb128 0x1
+	.long	0x5b5e
+	.long	.LLST195
+	.long	.LVUS195
+	.byte	0
+	.uleb128 0x3
+	.long	0x5b4f
+	.quad	.LBI1151
+	.value	.LVU1920
+	.quad	.LBB1151
+	.quad	.LBE1151-.LBB1151
+	.byte	0x2b
+	.value	0x507
+	.long	0x2daf
+	.uleb128 0x2
+	.long	0x5b68
+	.uleb128 0x1
+	.long	0x5b5e
+	.long	.LLST196
+	.long	.LVUS196
+	.byte	0
+	.uleb128 0x3
+	.long	0x5b4f
+	.quad	.LBI1153
+	.value	.LVU1932
+	.quad	.LBB1153
+	.quad	.LBE1153-.LBB1153
+	.byte	0x2b
+	.value	0x579
+	.long	0x2de8
+	.uleb128 0x2
+	.long	0x5b68
+	.uleb128 0x1
+	.long	0x5b5e
+	.long	.LLST197
+	.long	.LVUS197
+	.byte	0
+	.uleb128 0x3
+	.long	0x5b4f
+	.quad	.LBI1155
+	.value	.LVU1942
+	.quad	.LBB1155
+	.quad	.LBE1155-.LBB1155
+	.byte	0x2b
+	.value	0x5b5
+	.long	0x2e21
+	.uleb128 0x2
+	.long	0x5b68
+	.uleb128 0x1
+	.long	0x5b5e
+	.long	.LLST198
+	.long	.LVUS198
+	.byte	0
+	.uleb128 0x3
+	.long	0x5b4f
+	.quad	.LBI1157
+	.value	.LVU1952
+	.quad	.LBB1157
+	.quad	.LBE1157-.LBB1157
+	.byte	0x2b
+	.value	0x615
+	.long	0x2e5a
+	.uleb128 0x2
+	.long	0x5b68
+	.uleb128 0x1
+	.long	0x5b5e
+	.long	.LLST199
+	.long	.LVUS199
+	.byte	0
+	.uleb128 0x3
+	.long	0x5b4f
+	.quad	.LBI1159
+	.value	.LVU1961
+	.quad	.LBB1159
+	.quad	.LBE1159-.LBB1159
+	.byte	0x2b
+	.value	0x651
+	.long	0x2e93
+	.uleb128 0x2
+	.long	0x5b68
+	.uleb128 0x1
+	.long	0x5b5e
+	.long	.LLST200
+	.long	.LVUS200
+	.byte	0
+	.uleb128 0x3
+	.long	0x5b4f
+	.quad	.LBI1161
+	.value	.LVU1975
+	.quad	.LBB1161
+	.quad	.LBE1161-.LBB1161
+	.byte	0x2b
+	.value	0x6c4
+	.long	0x2ecc
+	.uleb128 0x2
+	.long	0x5b68
+	.uleb128 0x1
+	.long	0x5b5e
+	.long	.LLST201
+	.long	.LVUS201
+	.byte	0
+	.uleb128 0x3
+	.long	0x5b4f
+	.quad	.LBI1163
+	.value	.LVU1985
+	.quad	.LBB1163
+	.quad	.LBE1163-.LBB1163
+	.byte	0x2b
+	.value	0x700
+	.long	0x2f05
+	.uleb128 0x2
+	.long	0x5b68
+	.uleb128 0x1
+	.long	0x5b5e
+	.long	.LLST202
+	.long	.LVUS202
+	.byte	0
+	.uleb128 0x3
+	.long	0x5b4f
+	.quad	.LBI1165
+	.value	.LVU1995
+	.quad	.LBB1165
+	.quad	.LBE1165-.LBB1165
+	.byte	0x2b
+	.value	0x761
+	.long	0x2f3e
+	.uleb128 0x2
+	.long	0x5b68
+	.uleb128 0x1
+	.long	0x5b5e
+	.long	.LLST203
+	.long	.LVUS203
+	.byte	0
+	.uleb128 0x3
+	.long	0x5b4f
+	.quad	.LBI1167
+	.value	.LVU2005
+	.quad	.LBB1167
+	.quad	.LBE1167-.LBB1167
+	.byte	0x2b
+	.value	0x79d
+	.long	0x2f77
+	.uleb128 0x2
+	.long	0x5b68
+	.uleb128 0x1
+	.long	0x5b5e
+	.long	.LLST204
+	.long	.LVUS204
+	.byte	0
+	.uleb128 0x3
+	.long	0x5b4f
+	.quad	.LBI1169
+	.value	.LVU2019
+	.quad	.LBB1169
+	.quad	.LBE1169-.LBB1169
+	.byte	0x2b
+	.value	0x810
+	.long	0x2fb0
+	.uleb128 0x2
+	.long	0x5b68
+	.uleb128 0x1
+	.long	0x5b5e
+	.long	.LLST205
+	.long	.LVUS205
+	.byte	0
+	.uleb128 0x3
+	.long	0x5b4f
+	.quad	.LBI1171
+	.value	.LVU2029
+	.quad	.LBB1171
+	.quad	.LBE1171-.LBB1171
+	.byte	0x2b
+	.value	0x84c
+	.long	0x2fe9
+	.uleb128 0x2
+	.long	0x5b68
+	.uleb128 0x1
+	.long	0x5b5e
+	.long	.LLST206
+	.long	.LVUS206
+	.byte	0
+	.uleb128 0x3
+	.long	0x5b4f
+	.quad	.LBI1173
+	.value	.LVU2039
+	.quad	.LBB1173
+	.quad	.LBE1173-.LBB1173
+	.byte	0x2b
+	.value	0x8ad
+	.long	0x3022
+	.uleb128 0x2
+	.long	0x5b68
+	.uleb128 0x1
+	.long	0x5b5e
+	.long	.LLST207
+	.long	.LVUS207
+	.byte	0
+	.uleb128 0x5
+	.long	0x5b4f
+	.quad	.LBI1175
+	.value	.LVU2050
+	.long	.LLRL208
+	.byte	0x2b
+	.value	0x8e9
+	.long	0x304f
+	.uleb128 0x2
+	.long	0x5b68
+	.uleb128 0x1
+	.long	0x5b5e
+	.long	.LLST209
+	.long	.LVUS209
+	.byte	0
+	.uleb128 0x3
+	.long	0x5b4f
+	.quad	.LBI1179
+	.value	.LVU2063
+	.quad	.LBB1179
+	.quad	.LBE1179-.LBB1179
+	.byte	0x2b
+	.value	0x95c
+	.long	0x3088
+	.uleb128 0x2
+	.long	0x5b68
+	.uleb128 0x1
+	.long	0x5b5e
+	.long	.LLST210
+	.long	.LVUS210
+	.byte	0
+	.uleb128 0x3
+	.long	0x5b4f
+	.quad	.LBI1181
+	.value	.LVU2073
+	.quad	.LBB1181
+	.quad	.LBE1181-.LBB1181
+	.byte	0x2b
+	.value	0x998
+	.long	0x30c1
+	.uleb128 0x2
+	.long	0x5b68
+	.uleb128 0x1
+	.long	0x5b5e
+	.long	.LLST211
+	.long	.LVUS211
+	.byte	0
+	.uleb128 0x3
+	.long	0x5b4f
+	.quad	.LBI1183
+	.value	.LVU2083
+	.quad	.LBB1183
+	.quad	.LBE1183-.LBB1183
+	.byte	0x2b
+	.value	0x9f9
+	.long	0x30fa
+	.uleb128 0x2
+	.long	0x5b68
+	.uleb128 0x1
+	.long	0x5b5e
+	.long	.LLST212
+	.long	.LVUS212
+	.byte	0
+	.uleb128 0x3
+	.long	0x5b4f
+	.quad	.LBI1185
+	.value	.LVU2093
+	.quad	.LBB1185
+	.quad	.LBE1185-.LBB1185
+	.byte	0x2b
+	.value	0xa35
+	.long	0x3133
+	.uleb128 0x2
+	.long	0x5b68
+	.uleb128 0x1
+	.long	0x5b5e
+	.long	.LLST213
+	.long	.LVUS213
+	.byte	0
+	.uleb128 0x4
+	.long	0x5b4f
+	.quad	.LBI1187
+	.value	.LVU2107
+	.quad	.LBB1187
+	.quad	.LBE1187-.LBB1187
+	.byte	0x2c
+	.byte	0x51
+	.long	0x316b
+	.uleb128 0x2
+	.long	0x5b68
+	.uleb128 0x1
+	.long	0x5b5e
+	.long	.LLST214
+	.long	.LVUS214
+	.byte	0
+	.uleb128 0x4
+	.long	0x5b4f
+	.quad	.LBI1189
+	.value	.LVU2117
+	.quad	.LBB1189
+	.quad	.LBE1189-.LBB1189
+	.byte	0x2c
+	.byte	0x8d
+	.long	0x31a3
+	.uleb128 0x2
+	.long	0x5b68
+	.uleb128 0x1
+	.long	0x5b5e
+	.long	.LLST215
+	.long	.LVUS215
+	.byte	0
+	.uleb128 0x4
+	.long	0x5b4f
+	.quad	.LBI1191
+	.value	.LVU2127
+	.quad	.LBB1191
+	.quad	.LBE1191-.LBB1191
+	.byte	0x2c
+	.byte	0xed
+	.long	0x31db
+	.uleb128 0x2
+	.long	0x5b68
+	.uleb128 0x1
+	.long	0x5b5e
+	.long	.LLST216
+	.long	.LVUS216
+	.byte	0
+	.uleb128 0x3
+	.long	0x5b4f
+	.quad	.LBI1193
+	.value	.LVU2137
+	.quad	.LBB1193
+	.quad	.LBE1193-.LBB1193
+	.byte	0x2c
+	.value	0x129
+	.long	0x3214
+	.uleb128 0x2
+	.long	0x5b68
+	.uleb128 0x1
+	.long	0x5b5e
+	.long	.LLST217
+	.long	.LVUS217
+	.byte	0
+	.uleb128 0x3
+	.long	0x5b4f
+	.quad	.LBI1195
+	.value	.LVU2150
+	.quad	.LBB1195
+	.quad	.LBE1195-.LBB1195
+	.byte	0x2c
+	.value	0x19b
+	.long	0x324d
+	.uleb128 0x2
+	.long	0x5b68
+	.uleb128 0x1
+	.long	0x5b5e
+	.long	.LLST218
+	.long	.LVUS218
+	.byte	0
+	.uleb128 0x3
+	.long	0x5b4f
+	.quad	.LBI1197
+	.value	.LVU2160
+	.quad	.LBB1197
+	.quad	.LBE1197-.LBB1197
+	.byte	0x2c
+	.value	0x1d7
+	.long	0x3286
+	.uleb128 0x2
+	.long	0x5b68
+	.uleb128 0x1
+	.long	0x5b5e
+	.long	.LLST219
+	.long	.LVUS219
+	.byte	0
+	.uleb128 0x5
+	.long	0x5b4f
+	.quad	.LBI1199
+	.value	.LVU2170
+	.long	.LLRL220
+	.byte	0x2c
+	.value	0x237
+	.long	0x32b3
+	.uleb128 0x2
+	.long	0x5b68
+	.uleb128 0x1
+	.long	0x5b5e
+	.long	.LLST221
+	.long	.LVUS221
+	.byte	0
+	.uleb128 0x3
+	.long	0x5b4f
+	.quad	.LBI1203
+	.value	.LVU2181
+	.quad	.LBB1203
+	.quad	.LBE1203-.LBB1203
+	.byte	0x2c
+	.value	0x273
+	.long	0x32ec
+	.uleb128 0x2
+	.long	0x5b68
+	.uleb128 0x1
+	.long	0x5b5e
+	.long	.LLST222
+	.long	.LVUS222
+	.byte	0
+	.uleb128 0x3
+	.long	0x5b4f
+	.quad	.LBI1205
+	.value	.LVU2195
+	.quad	.LBB1205
+	.quad	.LBE1205-.LBB1205
+	.byte	0x2c
+	.value	0x2e5
+	.long	0x3325
+	.uleb128 0x2
+	.long	0x5b68
+	.uleb128 0x1
+	.long	0x5b5e
+	.long	.LLST223
+	.long	.LVUS223
+	.byte	0
+	.uleb128 0x3
+	.long	0x5b4f
+	.quad	.LBI1207
+	.value	.LVU2206
+	.quad	.LBB1207
+	.quad	.LBE1207-.LBB1207
+	.byte	0x2c
+	.value	0x321
+	.long	0x335e
+	.uleb128 0x2
+	.long	0x5b68
+	.uleb128 0x1
+	.long	0x5b5e
+	.long	.LLST224
+	.long	.LVUS224
+	.byte	0
+	.uleb128 0x3
+	.long	0x5b4f
+	.quad	.LBI1209
+	.value	.LVU2216
+	.quad	.LBB1209
+	.quad	.LBE1209-.LBB1209
+	.byte	0x2c
+	.value	0x381
+	.long	0x3397
+	.uleb128 0x2
+	.long	0x5b68
+	.uleb128 0x1
+	.long	0x5b5e
+	.long	.LLST225
+	.long	.LVUS225
+	.byte	0
+	.uleb128 0x3
+	.long	0x5b4f
+	.quad	.LBI1211
+	.value	.LVU2226
+	.quad	.LBB1211
+	.quad	.LBE1211-.LBB1211
+	.byte	0x2c
+	.value	0x3bd
+	.long	0x33d0
+	.uleb128 0x2
+	.long	0x5b68
+	.uleb128 0x1
+	.long	0x5b5e
+	.long	.LLST226
+	.long	.LVUS226
+	.byte	0
+	.uleb128 0x3
+	.long	0x5b4f
+	.quad	.LBI1213
+	.value	.LVU2238
+	.quad	.LBB1213
+	.quad	.LBE1213-.LBB1213
+	.byte	0x2c
+	.value	0x42f
+	.long	0x3411
+	.uleb128 0x1
+	.long	0x5b68
+	.long	.LLST227
+	.long	.LVUS227
+	.uleb128 0x1
+	.long	0x5b5e
+	.long	.LLST228
+	.long	.LVUS228
+	.byte	0
+	.uleb128 0x3
+	.long	0x5b4f
+	.quad	.LBI1215
+	.value	.LVU2248
+	.quad	.LBB1215
+	.quad	.LBE1215-.LBB1215
+	.byte	0x2c
+	.value	0x46b
+	.long	0x344a
+	.uleb128 0x2
+	.long	0x5b68
+	.uleb128 0x1
+	.long	0x5b5e
+	.long	.LLST229
+	.long	.LVUS229
+	.byte	0
+	.uleb128 0x3
+	.long	0x5b4f
+	.quad	.LBI1217
+	.value	.LVU2258
+	.quad	.LBB1217
+	.quad	.LBE1217-.LBB1217
+	.byte	0x2c
+	.value	0x4cb
+	.long	0x3483
+	.uleb128 0x2
+	.long	0x5b68
+	.uleb128 0x1
+	.long	0x5b5e
+	.long	.LLST230
+	.long	.LVUS230
+	.byte	0
+	.uleb128 0x3
+	.long	0x5b4f
+	.quad	.LBI1219
+	.value	.LVU2268
+	.quad	.LBB1219
+	.quad	.LBE1219-.LBB1219
+	.byte	0x2c
+	.value	0x507
+	.long	0x34bc
+	.uleb128 0x2
+	.long	0x5b68
+	.uleb128 0x1
+	.long	0x5b5e
+	.long	.LLST231
+	.long	.LVUS231
+	.byte	0
+	.uleb128 0x3
+	.long	0x5b4f
+	.quad	.LBI1221
+	.value	.LVU2280
+	.quad	.LBB1221
+	.quad	.LBE1221-.LBB1221
+	.byte	0x2c
+	.value	0x579
+	.long	0x34f5
+	.uleb128 0x2
+	.long	0x5b68
+	.uleb128 0x1
+	.long	0x5b5e
+	.long	.LLST232
+	.long	.LVUS232
+	.byte	0
+	.uleb128 0x3
+	.long	0x5b4f
+	.quad	.LBI1223
+	.value	.LVU2290
+	.quad	.LBB1223
+	.quad	.LBE1223-.LBB1223
+	.byte	0x2c
+	.value	0x5b5
+	.long	0x352e
+	.uleb128 0x2
+	.long	0x5b68
+	.uleb128 0x1
+	.long	0x5b5e
+	.long	.LLST233
+	.long	.LVUS233
+	.byte	0
+	.uleb128 0x3
+	.long	0x5b4f
+	.quad	.LBI1225
+	.value	.LVU2300
+	.quad	.LBB1225
+	.quad	.LBE1225-.LBB1225
+	.byte	0x2c
+	.value	0x615
+	.long	0x3567
+	.uleb128 0x2
+	.long	0x5b68
+	.uleb128 0x1
+	.long	0x5b5e
+	.long	.LLST234
+	.long	.LVUS234
+	.byte	0
+	.uleb128 0x3
+	.long	0x5b4f
+	.quad	.LBI1227
+	.value	.LVU2309
+	.quad	.LBB1227
+	.quad	.LBE1227-.LBB1227
+	.byte	0x2c
+	.value	0x651
+	.long	0x35a0
+	.uleb128 0x2
+	.long	0x5b68
+	.uleb128 0x1
+	.long	0x5b5e
+	.long	.LLST235
+	.long	.LVUS235
+	.byte	0
+	.uleb128 0x3
+	.long	0x5b4f
+	.quad	.LBI1229
+	.value	.LVU2324
+	.quad	.LBB1229
+	.quad	.LBE1229-.LBB1229
+	.byte	0x2c
+	.value	0x6c4
+	.long	0x35d9
+	.uleb128 0x2
+	.long	0x5b68
+	.uleb128 0x1
+	.long	0x5b5e
+	.long	.LLST236
+	.long	.LVUS236
+	.byte	0
+	.uleb128 0x3
+	.long	0x5b4f
+	.quad	.LBI1231
+	.value	.LVU2334
+	.quad	.LBB1231
+	.quad	.LBE1231-.LBB1231
+	.byte	0x2c
+	.value	0x700
+	.long	0x3612
+	.uleb128 0x2
+	.long	0x5b68
+	.uleb128 0x1
+	.long	0x5b5e
+	.long	.LLST237
+	.long	.LVUS237
+	.byte	0
+	.uleb128 0x3
+	.long	0x5b4f
+	.quad	.LBI1233
+	.value	.LVU2344
+	.quad	.LBB1233
+	.quad	.LBE1233-.LBB1233
+	.byte	0x2c
+	.value	0x761
+	.long	0x364b
+	.uleb128 0x2
+	.long	0x5b68
+	.uleb128 0x1
+	.long	0x5b5e
+	.long	.LLST238
+	.long	.LVUS238
+	.byte	0
+	.uleb128 0x3
+	.long	0x5b4f
+	.quad	.LBI1235
+	.value	.LVU2354
+	.quad	.LBB1235
+	.quad	.LBE1235-.LBB1235
+	.byte	0x2c
+	.value	0x79d
+	.long	0x3684
+	.uleb128 0x2
+	.long	0x5b68
+	.uleb128 0x1
+	.long	0x5b5e
+	.long	.LLST239
+	.long	.LVUS239
+	.byte	0
+	.uleb128 0x3
+	.long	0x5b4f
+	.quad	.LBI1237
+	.value	.LVU2368
+	.quad	.LBB1237
+	.quad	.LBE1237-.LBB1237
+	.byte	0x2c
+	.value	0x810
+	.long	0x36bd
+	.uleb128 0x2
+	.long	0x5b68
+	.uleb128 0x1
+	.long	0x5b5e
+	.long	.LLST240
+	.long	.LVUS240
+	.byte	0
+	.uleb128 0x3
+	.long	0x5b4f
+	.quad	.LBI1239
+	.value	.LVU2378
+	.quad	.LBB1239
+	.quad	.LBE1239-.LBB1239
+	.byte	0x2c
+	.value	0x84c
+	.long	0x36f6
+	.uleb128 0x2
+	.long	0x5b68
+	.uleb128 0x1
+	.long	0x5b5e
+	.long	.LLST241
+	.long	.LVUS241
+	.byte	0
+	.uleb128 0x3
+	.long	0x5b4f
+	.quad	.LBI1241
+	.value	.LVU2388
+	.quad	.LBB1241
+	.quad	.LBE1241-.LBB1241
+	.byte	0x2c
+	.value	0x8ad
+	.long	0x372f
+	.uleb128 0x2
+	.long	0x5b68
+	.uleb128 0x1
+	.long	0x5b5e
+	.long	.LLST242
+	.long	.LVUS242
+	.byte	0
+	.uleb128 0x3
+	.long	0x5b4f
+	.quad	.LBI1243
+	.value	.LVU2398
+	.quad	.LBB1243
+	.quad	.LBE1243-.LBB1243
+	.byte	0x2c
+	.value	0x8e9
+	.long	0x3768
+	.uleb128 0x2
+	.long	0x5b68
+	.uleb128 0x1
+	.long	0x5b5e
+	.long	.LLST243
+	.long	.LVUS243
+	.byte	0
+	.uleb128 0x3
+	.long	0x5b4f
+	.quad	.LBI1245
+	.value	.LVU2410
+	.quad	.LBB1245
+	.quad	.LBE1245-.LBB1245
+	.byte	0x2c
+	.value	0x95c
+	.long	0x37a1
+	.uleb128 0x2
+	.long	0x5b68
+	.uleb128 0x1
+	.long	0x5b5e
+	.long	.LLST244
+	.long	.LVUS244
+	.byte	0
+	.uleb128 0x3
+	.long	0x5b4f
+	.quad	.LBI1247
+	.value	.LVU2420
+	.quad	.LBB1247
+	.quad	.LBE1247-.LBB1247
+	.byte	0x2c
+	.value	0x998
+	.long	0x37da
+	.uleb128 0x2
+	.long	0x5b68
+	.uleb128 0x1
+	.long	0x5b5e
+	.long	.LLST245
+	.long	.LVUS245
+	.byte	0
+	.uleb128 0x3
+	.long	0x5b4f
+	.quad	.LBI1249
+	.value	.LVU2430
+	.quad	.LBB1249
+	.quad	.LBE1249-.LBB1249
+	.byte	0x2c
+	.value	0x9f9
+	.long	0x3813
+	.uleb128 0x2
+	.long	0x5b68
+	.uleb128 0x1
+	.long	0x5b5e
+	.long	.LLST246
+	.long	.LVUS246
+	.byte	0
+	.uleb128 0x3
+	.long	0x5b4f
+	.quad	.LBI1251
+	.value	.LVU2440
+	.quad	.LBB1251
+	.quad	.LBE1251-.LBB1251
+	.byte	0x2c
+	.value	0xa35
+	.long	0x384c
+	.uleb128 0x2
+	.long	0x5b68
+	.uleb128 0x1
+	.long	0x5b5e
+	.long	.LLST247
+	.long	.LVUS247
+	.byte	0
+	.uleb128 0x4
+	.long	0x5b4f
+	.quad	.LBI1253
+	.value	.LVU2454
+	.quad	.LBB1253
+	.quad	.LBE1253-.LBB1253
+	.byte	0x2d
+	.byte	0x51
+	.long	0x3884
+	.uleb128 0x2
+	.long	0x5b68
+	.uleb128 0x1
+	.long	0x5b5e
+	.long	.LLST248
+	.long	.LVUS248
+	.byte	0
+	.uleb128 0x4
+	.long	0x5b4f
+	.quad	.LBI1255
+	.value	.LVU2464
+	.quad	.LBB1255
+	.quad	.LBE1255-.LBB1255
+	.byte	0x2d
+	.byte	0x8d
+	.long	0x38bc
+	.uleb128 0x2
+	.long	0x5b68
+	.uleb128 0x1
+	.long	0x5b5e
+	.long	.LLST249
+	.long	.LVUS249
+	.byte	0
+	.uleb128 0x4
+	.long	0x5b4f
+	.quad	.LBI1257
+	.value	.LVU2474
+	.quad	.LBB1257
+	.quad	.LBE1257-.LBB1257
+	.byte	0x2d
+	.byte	0xed
+	.long	0x38f4
+	.uleb128 0x2
+	.long	0x5b68
+	.uleb128 0x1
+	.long	0x5b5e
+	.long	.LLST250
+	.long	.LVUS250
+	.byte	0
+	.uleb128 0x3
+	.long	0x5b4f
+	.quad	.LBI1259
+	.value	.LVU2484
+	.quad	.LBB1259
+	.quad	.LBE1259-.LBB1259
+	.byte	0x2d
+	.value	0x129
+	.long	0x392d
+	.uleb128 0x2
+	.long	0x5b68
+	.uleb128 0x1
+	.long	0x5b5e
+	.long	.LLST251
+	.long	.LVUS251
+	.byte	0
+	.uleb128 0x3
+	.long	0x5b4f
+	.quad	.LBI1261
+	.value	.LVU2497
+	.quad	.LBB1261
+	.quad	.LBE1261-.LBB1261
+	.byte	0x2d
+	.value	0x19b
+	.long	0x3966
+	.uleb128 0x2
+	.long	0x5b68
+	.uleb128 0x1
+	.long	0x5b5e
+	.long	.LLST252
+	.long	.LVUS252
+	.byte	0
+	.uleb128 0x3
+	.long	0x5b4f
+	.quad	.LBI1263
+	.value	.LVU2507
+	.quad	.LBB1263
+	.quad	.LBE1263-.LBB1263
+	.byte	0x2d
+	.value	0x1d7
+	.long	0x399f
+	.uleb128 0x2
+	.long	0x5b68
+	.uleb128 0x1
+	.long	0x5b5e
+	.long	.LLST253
+	.long	.LVUS253
+	.byte	0
+	.uleb128 0x3
+	.long	0x5b4f
+	.quad	.LBI1265
+	.value	.LVU2517
+	.quad	.LBB1265
+	.quad	.LBE1265-.LBB1265
+	.byte	0x2d
+	.value	0x237
+	.long	0x39d8
+	.uleb128 0x2
+	.long	0x5b68
+	.uleb128 0x1
+	.long	0x5b5e
+	.long	.LLST254
+	.long	.LVUS254
+	.byte	0
+	.uleb128 0x3
+	.long	0x5b4f
+	.quad	.LBI1267
+	.value	.LVU2527
+	.quad	.LBB1267
+	.quad	.LBE1267-.LBB1267
+	.byte	0x2d
+	.value	0x273
+	.long	0x3a11
+	.uleb128 0x2
+	.long	0x5b68
+	.uleb128 0x1
+	.long	0x5b5e
+	.long	.LLST255
+	.long	.LVUS255
+	.byte	0
+	.uleb128 0x5
+	.long	0x5b4f
+	.quad	.LBI1269
+	.value	.LVU2538
+	.long	.LLRL256
+	.byte	0x2d
+	.value	0x2e5
+	.long	0x3a46
+	.uleb128 0x1
+	.long	0x5b68
+	.long	.LLST257
+	.long	.LVUS257
+	.uleb128 0x1
+	.long	0x5b5e
+	.long	.LLST258
+	.long	.LVUS258
+	.byte	0
+	.uleb128 0x3
+	.long	0x5b4f
+	.quad	.LBI1273
+	.value	.LVU2552
+	.quad	.LBB1273
+	.quad	.LBE1273-.LBB1273
+	.byte	0x2d
+	.value	0x321
+	.long	0x3a7f
+	.uleb128 0x2
+	.long	0x5b68
+	.uleb128 0x1
+	.long	0x5b5e
+	.long	.LLST259
+	.long	.LVUS259
+	.byte	0
+	.uleb128 0x3
+	.long	0x5b4f
+	.quad	.LBI1275
+	.value	.LVU2562
+	.quad	.LBB1275
+	.quad	.LBE1275-.LBB1275
+	.byte	0x2d
+	.value	0x381
+	.long	0x3ab8
+	.uleb128 0x2
+	.long	0x5b68
+	.uleb128 0x1
+	.long	0x5b5e
+	.long	.LLST260
+	.long	.LVUS260
+	.byte	0
+	.uleb128 0x3
+	.long	0x5b4f
+	.quad	.LBI1277
+	.value	.LVU2572
+	.quad	.LBB1277
+	.quad	.LBE1277-.LBB1277
+	.byte	0x2d
+	.value	0x3bd
+	.long	0x3af1
+	.uleb128 0x2
+	.long	0x5b68
+	.uleb128 0x1
+	.long	0x5b5e
+	.long	.LLST261
+	.long	.LVUS261
+	.byte	0
+	.uleb128 0x3
+	.long	0x5b4f
+	.quad	.LBI1279
+	.value	.LVU2584
+	.quad	.LBB1279
+	.quad	.LBE1279-.LBB1279
+	.byte	0x2d
+	.value	0x42f
+	.long	0x3b32
+	.uleb128 0x1
+	.long	0x5b68
+	.long	.LLST262
+	.long	.LVUS262
+	.uleb128 0x1
+	.long	0x5b5e
+	.long	.LLST263
+	.long	.LVUS263
+	.byte	0
+	.uleb128 0x3
+	.long	0x5b4f
+	.quad	.LBI1281
+	.value	.LVU2594
+	.quad	.LBB1281
+	.quad	.LBE1281-.LBB1281
+	.byte	0x2d
+	.value	0x46b
+	.long	0x3b6b
+	.uleb128 0x2
+	.long	0x5b68
+	.uleb128 0x1
+	.long	0x5b5e
+	.long	.LLST264
+	.long	.LVUS264
+	.byte	0
+	.uleb128 0x3
+	.long	0x5b4f
+	.quad	.LBI1283
+	.value	.LVU2604
+	.quad	.LBB1283
+	.quad	.LBE1283-.LBB1283
+	.byte	0x2d
+	.value	0x4cb
+	.long	0x3ba4
+	.uleb128 0x2
+	.long	0x5b68
+	.uleb128 0x1
+	.long	0x5b5e
+	.long	.LLST265
+	.long	.LVUS265
+	.byte	0
+	.uleb128 0x3
+	.long	0x5b4f
+	.quad	.LBI1285
+	.value	.LVU2614
+	.quad	.LBB1285
+	.quad	.LBE1285-.LBB1285
+	.byte	0x2d
+	.value	0x507
+	.long	0x3bdd
+	.uleb128 0x2
+	.long	0x5b68
+	.uleb128 0x1
+	.long	0x5b5e
+	.long	.LLST266
+	.long	.LVUS266
+	.byte	0
+	.uleb128 0x3
+	.long	0x5b4f
+	.quad	.LBI1287
+	.value	.LVU2626
+	.quad	.LBB1287
+	.quad	.LBE1287-.LBB1287
+	.byte	0x2d
+	.value	0x579
+	.long	0x3c16
+	.uleb128 0x2
+	.long	0x5b68
+	.uleb128 0x1
+	.long	0x5b5e
+	.long	.LLST267
+	.long	.LVUS267
+	.byte	0
+	.uleb128 0x3
+	.long	0x5b4f
+	.quad	.LBI1289
+	.value	.LVU2636
+	.quad	.LBB1289
+	.quad	.LBE1289-.LBB1289
+	.byte	0x2d
+	.value	0x5b5
+	.long	0x3c4f
+	.uleb128 0x2
+	.long	0x5b68
+	.uleb128 0x1
+	.long	0x5b5e
+	.long	.LLST268
+	.long	.LVUS268
+	.byte	0
+	.uleb128 0x3
+	.long	0x5b4f
+	.quad	.LBI1291
+	.value	.LVU2646
+	.quad	.LBB1291
+	.quad	.LBE1291-.LBB1291
+	.byte	0x2d
+	.value	0x615
+	.long	0x3c88
+	.uleb128 0x2
+	.long	0x5b68
+	.uleb128 0x1
+	.long	0x5b5e
+	.long	.LLST269
+	.long	.LVUS269
+	.byte	0
+	.uleb128 0x5
+	.long	0x5b4f
+	.quad	.LBI1293
+	.value	.LVU2656
+	.long	.LLRL270
+	.byte	0x2d
+	.value	0x651
+	.long	0x3cb5
+	.uleb128 0x2
+	.long	0x5b68
+	.uleb128 0x1
+	.long	0x5b5e
+	.long	.LLST271
+	.long	.LVUS271
+	.byte	0
+	.uleb128 0x3
+	.long	0x5b4f
+	.quad	.LBI1297
+	.value	.LVU2668
+	.quad	.LBB1297
+	.quad	.LBE1297-.LBB1297
+	.byte	0x2d
+	.value	0x6c4
+	.long	0x3cee
+	.uleb128 0x2
+	.long	0x5b68
+	.uleb128 0x1
+	.long	0x5b5e
+	.long	.LLST272
+	.long	.LVUS272
+	.byte	0
+	.uleb128 0x3
+	.long	0x5b4f
+	.quad	.LBI1299
+	.value	.LVU2678
+	.quad	.LBB1299
+	.quad	.LBE1299-.LBB1299
+	.byte	0x2d
+	.value	0x700
+	.long	0x3d27
+	.uleb128 0x2
+	.long	0x5b68
+	.uleb128 0x1
+	.long	0x5b5e
+	.long	.LLST273
+	.long	.LVUS273
+	.byte	0
+	.uleb128 0x3
+	.long	0x5b4f
+	.quad	.LBI1301
+	.value	.LVU2688
+	.quad	.LBB1301
+	.quad	.LBE1301-.LBB1301
+	.byte	0x2d
+	.value	0x761
+	.long	0x3d60
+	.uleb128 0x2
+	.long	0x5b68
+	.uleb128 0x1
+	.long	0x5b5e
+	.long	.LLST274
+	.long	.LVUS274
+	.byte	0
+	.uleb128 0x3
+	.long	0x5b4f
+	.quad	.LBI1303
+	.value	.LVU2698
+	.quad	.LBB1303
+	.quad	.LBE1303-.LBB1303
+	.byte	0x2d
+	.value	0x79d
+	.long	0x3d99
+	.uleb128 0x2
+	.long	0x5b68
+	.uleb128 0x1
+	.long	0x5b5e
+	.long	.LLST275
+	.long	.LVUS275
+	.byte	0
+	.uleb128 0x3
+	.long	0x5b4f
+	.quad	.LBI1305
+	.value	.LVU2712
+	.quad	.LBB1305
+	.quad	.LBE1305-.LBB1305
+	.byte	0x2d
+	.value	0x810
+	.long	0x3dd2
+	.uleb128 0x2
+	.long	0x5b68
+	.uleb128 0x1
+	.long	0x5b5e
+	.long	.LLST276
+	.long	.LVUS276
+	.byte	0
+	.uleb128 0x3
+	.long	0x5b4f
+	.quad	.LBI1307
+	.value	.LVU2723
+	.quad	.LBB1307
+	.quad	.LBE1307-.LBB1307
+	.byte	0x2d
+	.value	0x84c
+	.long	0x3e0b
+	.uleb128 0x2
+	.long	0x5b68
+	.uleb128 0x1
+	.long	0x5b5e
+	.long	.LLST277
+	.long	.LVUS277
+	.byte	0
+	.uleb128 0x3
+	.long	0x5b4f
+	.quad	.LBI1309
+	.value	.LVU2733
+	.quad	.LBB1309
+	.quad	.LBE1309-.LBB1309
+	.byte	0x2d
+	.value	0x8ad
+	.long	0x3e44
+	.uleb128 0x2
+	.long	0x5b68
+	.uleb128 0x1
+	.long	0x5b5e
+	.long	.LLST278
+	.long	.LVUS278
+	.byte	0
+	.uleb128 0x3
+	.long	0x5b4f
+	.quad	.LBI1311
+	.value	.LVU2743
+	.quad	.LBB1311
+	.quad	.LBE1311-.LBB1311
+	.byte	0x2d
+	.value	0x8e9
+	.long	0x3e7d
+	.uleb128 0x2
+	.long	0x5b68
+	.uleb128 0x1
+	.long	0x5b5e
+	.long	.LLST279
+	.long	.LVUS279
+	.byte	0
+	.uleb128 0x3
+	.long	0x5b4f
+	.quad	.LBI1313
+	.value	.LVU2755
+	.quad	.LBB1313
+	.quad	.LBE1313-.LBB1313
+	.byte	0x2d
+	.value	0x95c
+	.long	0x3eb6
+	.uleb128 0x2
+	.long	0x5b68
+	.uleb128 0x1
+	.long	0x5b5e
+	.long	.LLST280
+	.long	.LVUS280
+	.byte	0
+	.uleb128 0x3
+	.long	0x5b4f
+	.quad	.LBI1315
+	.value	.LVU2765
+	.quad	.LBB1315
+	.quad	.LBE1315-.LBB1315
+	.byte	0x2d
+	.value	0x998
+	.long	0x3eef
+	.uleb128 0x2
+	.long	0x5b68
+	.uleb128 0x1
+	.long	0x5b5e
+	.long	.LLST281
+	.long	.LVUS281
+	.byte	0
+	.uleb128 0x3
+	.long	0x5b4f
+	.quad	.LBI1317
+	.value	.LVU2775
+	.quad	.LBB1317
+	.quad	.LBE1317-.LBB1317
+	.byte	0x2d
+	.value	0x9f9
+	.long	0x3f28
+	.uleb128 0x2
+	.long	0x5b68
+	.uleb128 0x1
+	.long	0x5b5e
+	.long	.LLST282
+	.long	.LVUS282
+	.byte	0
+	.uleb128 0x3
+	.long	0x5b4f
+	.quad	.LBI1319
+	.value	.LVU2785
+	.quad	.LBB1319
+	.quad	.LBE1319-.LBB1319
+	.byte	0x2d
+	.value	0xa35
+	.long	0x3f61
+	.uleb128 0x2
+	.long	0x5b68
+	.uleb128 0x1
+	.long	0x5b5e
+	.long	.LLST283
+	.long	.LVUS283
+	.byte	0
+	.uleb128 0x4
+	.long	0x5b4f
+	.quad	.LBI1321
+	.value	.LVU2799
+	.quad	.LBB1321
+	.quad	.LBE1321-.LBB1321
+	.byte	0x2e
+	.byte	0x51
+	.long	0x3f99
+	.uleb128 0x2
+	.long	0x5b68
+	.uleb128 0x1
+	.long	0x5b5e
+	.long	.LLST284
+	.long	.LVUS284
+	.byte	0
+	.uleb128 0x4
+	.long	0x5b4f
+	.quad	.LBI1323
+	.value	.LVU2809
+	.quad	.LBB1323
+	.quad	.LBE1323-.LBB1323
+	.byte	0x2e
+	.byte	0x8d
+	.long	0x3fd1
+	.uleb128 0x2
+	.long	0x5b68
+	.uleb128 0x1
+	.long	0x5b5e
+	.long	.LLST285
+	.long	.LVUS285
+	.byte	0
+	.uleb128 0x4
+	.long	0x5b4f
+	.quad	.LBI1325
+	.value	.LVU2819
+	.quad	.LBB1325
+	.quad	.LBE1325-.LBB1325
+	.byte	0x2e
+	.byte	0xed
+	.long	0x4009
+	.uleb128 0x2
+	.long	0x5b68
+	.uleb128 0x1
+	.long	0x5b5e
+	.long	.LLST286
+	.long	.LVUS286
+	.byte	0
+	.uleb128 0x3
+	.long	0x5b4f
+	.quad	.LBI1327
+	.value	.LVU2829
+	.quad	.LBB1327
+	.quad	.LBE1327-.LBB1327
+	.byte	0x2e
+	.value	0x129
+	.long	0x4042
+	.uleb128 0x2
+	.long	0x5b68
+	.uleb128 0x1
+	.long	0x5b5e
+	.long	.LLST287
+	.long	.LVUS287
+	.byte	0
+	.uleb128 0x3
+	.long	0x5b4f
+	.quad	.LBI1329
+	.value	.LVU2842
+	.quad	.LBB1329
+	.quad	.LBE1329-.LBB1329
+	.byte	0x2e
+	.value	0x19b
+	.long	0x407b
+	.uleb128 0x2
+	.long	0x5b68
+	.uleb128 0x1
+	.long	0x5b5e
+	.long	.LLST288
+	.long	.LVUS288
+	.byte	0
+	.uleb128 0x3
+	.long	0x5b4f
+	.quad	.LBI1331
+	.value	.LVU2852
+	.quad	.LBB1331
+	.quad	.LBE1331-.LBB1331
+	.byte	0x2e
+	.value	0x1d7
+	.long	0x40b4
+	.uleb128 0x2
+	.long	0x5b68
+	.uleb128 0x1
+	.long	0x5b5e
+	.long	.LLST289
+	.long	.LVUS289
+	.byte	0
+	.uleb128 0x3
+	.long	0x5b4f
+	.quad	.LBI1333
+	.value	.LVU2862
+	.quad	.LBB1333
+	.quad	.LBE1333-.LBB1333
+	.byte	0x2e
+	.value	0x237
+	.long	0x40ed
+	.uleb128 0x2
+	.long	0x5b68
+	.uleb128 0x1
+	.long	0x5b5e
+	.long	.LLST290
+	.long	.LVUS290
+	.byte	0
+	.uleb128 0x3
+	.long	0x5b4f
+	.quad	.LBI1335
+	.value	.LVU2872
+	.quad	.LBB1335
+	.quad	.LBE1335-.LBB1335
+	.byte	0x2e
+	.value	0x273
+	.long	0x4126
+	.uleb128 0x2
+	.long	0x5b68
+	.uleb128 0x1
+	.long	0x5b5e
+	.long	.LLST291
+	.long	.LVUS291
+	.byte	0
+	.uleb128 0x3
+	.long	0x5b4f
+	.quad	.LBI1337
+	.value	.LVU2886
+	.quad	.LBB1337
+	.quad	.LBE1337-.LBB1337
+	.byte	0x2e
+	.value	0x2e5
+	.long	0x415f
+	.uleb128 0x2
+	.long	0x5b68
+	.uleb128 0x1
+	.long	0x5b5e
+	.long	.LLST292
+	.long	.LVUS292
+	.byte	0
+	.uleb128 0x3
+	.long	0x5b4f
+	.quad	.LBI1339
+	.value	.LVU2896
+	.quad	.LBB1339
+	.quad	.LBE1339-.LBB1339
+	.byte	0x2e
+	.value	0x321
+	.long	0x4198
+	.uleb128 0x2
+	.long	0x5b68
+	.uleb128 0x1
+	.long	0x5b5e
+	.long	.LLST293
+	.long	.LVUS293
+	.byte	0
+	.uleb128 0x3
+	.long	0x5b4f
+	.quad	.LBI1341
+	.value	.LVU2906
+	.quad	.LBB1341
+	.quad	.LBE1341-.LBB1341
+	.byte	0x2e
+	.value	0x381
+	.long	0x41d1
+	.uleb128 0x2
+	.long	0x5b68
+	.uleb128 0x1
+	.long	0x5b5e
+	.long	.LLST294
+	.long	.LVUS294
+	.byte	0
+	.uleb128 0x5
+	.long	0x5b4f
+	.quad	.LBI1343
+	.value	.LVU2917
+	.long	.LLRL295
+	.byte	0x2e
+	.value	0x3bd
+	.long	0x41fe
+	.uleb128 0x2
+	.long	0x5b68
+	.uleb128 0x1
+	.long	0x5b5e
+	.long	.LLST296
+	.long	.LVUS296
+	.byte	0
+	.uleb128 0x3
+	.long	0x5b4f
+	.quad	.LBI1347
+	.value	.LVU2930
+	.quad	.LBB1347
+	.quad	.LBE1347-.LBB1347
+	.byte	0x2e
+	.value	0x42f
+	.long	0x423f
+	.uleb128 0x1
+	.long	0x5b68
+	.long	.LLST297
+	.long	.LVUS297
+	.uleb128 0x1
+	.long	0x5b5e
+	.long	.LLST298
+	.long	.LVUS298
+	.byte	0
+	.uleb128 0x3
+	.long	0x5b4f
+	.quad	.LBI1349
+	.value	.LVU2940
+	.quad	.LBB1349
+	.quad	.LBE1349-.LBB1349
+	.byte	0x2e
+	.value	0x46b
+	.long	0x4278
+	.uleb128 0x2
+	.long	0x5b68
+	.uleb128 0x1
+	.long	0x5b5e
+	.long	.LLST299
+	.long	.LVUS299
+	.byte	0
+	.uleb128 0x3
+	.long	0x5b4f
+	.quad	.LBI1351
+	.value	.LVU2950
+	.quad	.LBB1351
+	.quad	.LBE1351-.LBB1351
+	.byte	0x2e
+	.value	0x4cb
+	.long	0x42b1
+	.uleb128 0x2
+	.long	0x5b68
+	.uleb128 0x1
+	.long	0x5b5e
+	.long	.LLST300
+	.long	.LVUS300
+	.byte	0
+	.uleb128 0x3
+	.long	0x5b4f
+	.quad	.LBI1353
+	.value	.LVU2960
+	.quad	.LBB1353
+	.quad	.LBE1353-.LBB1353
+	.byte	0x2e
+	.value	0x507
+	.long	0x42ea
+	.uleb128 0x2
+	.long	0x5b68
+	.uleb128 0x1
+	.long	0x5b5e
+	.long	.LLST301
+	.long	.LVUS301
+	.byte	0
+	.uleb128 0x3
+	.long	0x5b4f
+	.quad	.LBI1355
+	.value	.LVU2972
+	.quad	.LBB1355
+	.quad	.LBE1355-.LBB1355
+	.byte	0x2e
+	.value	0x579
+	.long	0x4323
+	.uleb128 0x2
+	.long	0x5b68
+	.uleb128 0x1
+	.long	0x5b5e
+	.long	.LLST302
+	.long	.LVUS302
+	.byte	0
+	.uleb128 0x3
+	.long	0x5b4f
+	.quad	.LBI1357
+	.value	.LVU2982
+	.quad	.LBB1357
+	.quad	.LBE1357-.LBB1357
+	.byte	0x2e
+	.value	0x5b5
+	.long	0x435c
+	.uleb128 0x2
+	.long	0x5b68
+	.uleb128 0x1
+	.long	0x5b5e
+	.long	.LLST303
+	.long	.LVUS303
+	.byte	0
+	.uleb128 0x3
+	.long	0x5b4f
+	.quad	.LBI1359
+	.value	.LVU2992
+	.quad	.LBB1359
+	.quad	.LBE1359-.LBB1359
+	.byte	0x2e
+	.value	0x615
+	.long	0x4395
+	.uleb128 0x2
+	.long	0x5b68
+	.uleb128 0x1
+	.long	0x5b5e
+	.long	.LLST304
+	.long	.LVUS304
+	.byte	0
+	.uleb128 0x3
+	.long	0x5b4f
+	.quad	.LBI1361
+	.value	.LVU3001
+	.quad	.LBB1361
+	.quad	.LBE1361-.LBB1361
+	.byte	0x2e
+	.value	0x651
+	.long	0x43ce
+	.uleb128 0x2
+	.long	0x5b68
+	.uleb128 0x1
+	.long	0x5b5e
+	.long	.LLST305
+	.long	.LVUS305
+	.byte	0
+	.uleb128 0x3
+	.long	0x5b4f
+	.quad	.LBI1363
+	.value	.LVU3015
+	.quad	.LBB1363
+	.quad	.LBE1363-.LBB1363
+	.byte	0x2e
+	.value	0x6c4
+	.long	0x4407
+	.uleb128 0x2
+	.long	0x5b68
+	.uleb128 0x1
+	.long	0x5b5e
+	.long	.LLST306
+	.long	.LVUS306
+	.byte	0
+	.uleb128 0x3
+	.long	0x5b4f
+	.quad	.LBI1365
+	.value	.LVU3025
+	.quad	.LBB1365
+	.quad	.LBE1365-.LBB1365
+	.byte	0x2e
+	.value	0x700
+	.long	0x4440
+	.uleb128 0x2
+	.long	0x5b68
+	.uleb128 0x1
+	.long	0x5b5e
+	.long	.LLST307
+	.long	.LVUS307
+	.byte	0
+	.uleb128 0x5
+	.long	0x5b4f
+	.quad	.LBI1367
+	.value	.LVU3035
+	.long	.LLRL308
+	.byte	0x2e
+	.value	0x761
+	.long	0x446d
+	.uleb128 0x2
+	.long	0x5b68
+	.uleb128 0x1
+	.long	0x5b5e
+	.long	.LLST309
+	.long	.LVUS309
+	.byte	0
+	.uleb128 0x3
+	.long	0x5b4f
+	.quad	.LBI1371
+	.value	.LVU3046
+	.quad	.LBB1371
+	.quad	.LBE1371-.LBB1371
+	.byte	0x2e
+	.value	0x79d
+	.long	0x44a6
+	.uleb128 0x2
+	.long	0x5b68
+	.uleb128 0x1
+	.long	0x5b5e
+	.long	.LLST310
+	.long	.LVUS310
+	.byte	0
+	.uleb128 0x3
+	.long	0x5b4f
+	.quad	.LBI1373
+	.value	.LVU3060
+	.quad	.LBB1373
+	.quad	.LBE1373-.LBB1373
+	.byte	0x2e
+	.value	0x810
+	.long	0x44df
+	.uleb128 0x2
+	.long	0x5b68
+	.uleb128 0x1
+	.long	0x5b5e
+	.long	.LLST311
+	.long	.LVUS311
+	.byte	0
+	.uleb128 0x3
+	.long	0x5b4f
+	.quad	.LBI1375
+	.value	.LVU3071
+	.quad	.LBB1375
+	.quad	.LBE1375-.LBB1375
+	.byte	0x2e
+	.value	0x84c
+	.long	0x4518
+	.uleb128 0x2
+	.long	0x5b68
+	.uleb128 0x1
+	.long	0x5b5e
+	.long	.LLST312
+	.long	.LVUS312
+	.byte	0
+	.uleb128 0x3
+	.long	0x5b4f
+	.quad	.LBI1377
+	.value	.LVU3081
+	.quad	.LBB1377
+	.quad	.LBE1377-.LBB1377
+	.byte	0x2e
+	.value	0x8ad
+	.long	0x4551
+	.uleb128 0x2
+	.long	0x5b68
+	.uleb128 0x1
+	.long	0x5b5e
+	.long	.LLST313
+	.long	.LVUS313
+	.byte	0
+	.uleb128 0x3
+	.long	0x5b4f
+	.quad	.LBI1379
+	.value	.LVU3091
+	.quad	.LBB1379
+	.quad	.LBE1379-.LBB1379
+	.byte	0x2e
+	.value	0x8e9
+	.long	0x458a
+	.uleb128 0x2
+	.long	0x5b68
+	.uleb128 0x1
+	.long	0x5b5e
+	.long	.LLST314
+	.long	.LVUS314
+	.byte	0
+	.uleb128 0x3
+	.long	0x5b4f
+	.quad	.LBI1381
+	.value	.LVU3103
+	.quad	.LBB1381
+	.quad	.LBE1381-.LBB1381
+	.byte	0x2e
+	.value	0x95c
+	.long	0x45c3
+	.uleb128 0x2
+	.long	0x5b68
+	.uleb128 0x1
+	.long	0x5b5e
+	.long	.LLST315
+	.long	.LVUS315
+	.byte	0
+	.uleb128 0x3
+	.long	0x5b4f
+	.quad	.LBI1383
+	.value	.LVU3113
+	.quad	.LBB1383
+	.quad	.LBE1383-.LBB1383
+	.byte	0x2e
+	.value	0x998
+	.long	0x45fc
+	.uleb128 0x2
+	.long	0x5b68
+	.uleb128 0x1
+	.long	0x5b5e
+	.long	.LLST316
+	.long	.LVUS316
+	.byte	0
+	.uleb128 0x3
+	.long	0x5b4f
+	.quad	.LBI1385
+	.value	.LVU3123
+	.quad	.LBB1385
+	.quad	.LBE1385-.LBB1385
+	.byte	0x2e
+	.value	0x9f9
+	.long	0x4635
+	.uleb128 0x2
+	.long	0x5b68
+	.uleb128 0x1
+	.long	0x5b5e
+	.long	.LLST317
+	.long	.LVUS317
+	.byte	0
+	.uleb128 0x3
+	.long	0x5b4f
+	.quad	.LBI1387
+	.value	.LVU3133
+	.quad	.LBB1387
+	.quad	.LBE1387-.LBB1387
+	.byte	0x2e
+	.value	0xa35
+	.long	0x466e
+	.uleb128 0x2
+	.long	0x5b68
+	.uleb128 0x1
+	.long	0x5b5e
+	.long	.LLST318
+	.long	.LVUS318
+	.byte	0
+	.uleb128 0x4
+	.long	0x5b4f
+	.quad	.LBI1389
+	.value	.LVU3147
+	.quad	.LBB1389
+	.quad	.LBE1389-.LBB1389
+	.byte	0x2f
+	.byte	0x51
+	.long	0x46a6
+	.uleb128 0x2
+	.long	0x5b68
+	.uleb128 0x1
+	.long	0x5b5e
+	.long	.LLST319
+	.long	.LVUS319
+	.byte	0
+	.uleb128 0x4
+	.long	0x5b4f
+	.quad	.LBI1391
+	.value	.LVU3157
+	.quad	.LBB1391
+	.quad	.LBE1391-.LBB1391
+	.byte	0x2f
+	.byte	0x8d
+	.long	0x46de
+	.uleb128 0x2
+	.long	0x5b68
+	.uleb128 0x1
+	.long	0x5b5e
+	.long	.LLST320
+	.long	.LVUS320
+	.byte	0
+	.uleb128 0x4
+	.long	0x5b4f
+	.quad	.LBI1393
+	.value	.LVU3167
+	.quad	.LBB1393
+	.quad	.LBE1393-.LBB1393
+	.byte	0x2f
+	.byte	0xed
+	.long	0x4716
+	.uleb128 0x2
+	.long	0x5b68
+	.uleb128 0x1
+	.long	0x5b5e
+	.long	.LLST321
+	.long	.LVUS321
+	.byte	0
+	.uleb128 0x3
+	.long	0x5b4f
+	.quad	.LBI1395
+	.value	.LVU3177
+	.quad	.LBB1395
+	.quad	.LBE1395-.LBB1395
+	.byte	0x2f
+	.value	0x129
+	.long	0x474f
+	.uleb128 0x2
+	.long	0x5b68
+	.uleb128 0x1
+	.long	0x5b5e
+	.long	.LLST322
+	.long	.LVUS322
+	.byte	0
+	.uleb128 0x3
+	.long	0x5b4f
+	.quad	.LBI1397
+	.value	.LVU3191
+	.quad	.LBB1397
+	.quad	.LBE1397-.LBB1397
+	.byte	0x2f
+	.value	0x19b
+	.long	0x4788
+	.uleb128 0x2
+	.long	0x5b68
+	.uleb128 0x1
+	.long	0x5b5e
+	.long	.LLST323
+	.long	.LVUS323
+	.byte	0
+	.uleb128 0x3
+	.long	0x5b4f
+	.quad	.LBI1399
+	.value	.LVU3201
+	.quad	.LBB1399
+	.quad	.LBE1399-.LBB1399
+	.byte	0x2f
+	.value	0x1d7
+	.long	0x47c1
+	.uleb128 0x2
+	.long	0x5b68
+	.uleb128 0x1
+	.long	0x5b5e
+	.long	.LLST324
+	.long	.LVUS324
+	.byte	0
+	.uleb128 0x3
+	.long	0x5b4f
+	.quad	.LBI1401
+	.value	.LVU3211
+	.quad	.LBB1401
+	.quad	.LBE1401-.LBB1401
+	.byte	0x2f
+	.value	0x237
+	.long	0x47fa
+	.uleb128 0x2
+	.long	0x5b68
+	.uleb128 0x1
+	.long	0x5b5e
+	.long	.LLST325
+	.long	.LVUS325
+	.byte	0
+	.uleb128 0x3
+	.long	0x5b4f
+	.quad	.LBI1403
+	.value	.LVU3221
+	.quad	.LBB1403
+	.quad	.LBE1403-.LBB1403
+	.byte	0x2f
+	.value	0x273
+	.long	0x4833
+	.uleb128 0x2
+	.long	0x5b68
+	.uleb128 0x1
+	.long	0x5b5e
+	.long	.LLST326
+	.long	.LVUS326
+	.byte	0
+	.uleb128 0x3
+	.long	0x5b4f
+	.quad	.LBI1405
+	.value	.LVU3235
+	.quad	.LBB1405
+	.quad	.LBE1405-.LBB1405
+	.byte	0x2f
+	.value	0x2e5
+	.long	0x486c
+	.uleb128 0x2
+	.long	0x5b68
+	.uleb128 0x1
+	.long	0x5b5e
+	.long	.LLST327
+	.long	.LVUS327
+	.byte	0
+	.uleb128 0x3
+	.long	0x5b4f
+	.quad	.LBI1407
+	.value	.LVU3245
+	.quad	.LBB1407
+	.quad	.LBE1407-.LBB1407
+	.byte	0x2f
+	.value	0x321
+	.long	0x48a5
+	.uleb128 0x2
+	.long	0x5b68
+	.uleb128 0x1
+	.long	0x5b5e
+	.long	.LLST328
+	.long	.LVUS328
+	.byte	0
+	.uleb128 0x3
+	.long	0x5b4f
+	.quad	.LBI1409
+	.value	.LVU3255
+	.quad	.LBB1409
+	.quad	.LBE1409-.LBB1409
+	.byte	0x2f
+	.value	0x381
+	.long	0x48de
+	.uleb128 0x2
+	.long	0x5b68
+	.uleb128 0x1
+	.long	0x5b5e
+	.long	.LLST329
+	.long	.LVUS329
+	.byte	0
+	.uleb128 0x3
+	.long	0x5b4f
+	.quad	.LBI1411
+	.value	.LVU3265
+	.quad	.LBB1411
+	.quad	.LBE1411-.LBB1411
+	.byte	0x2f
+	.value	0x3bd
+	.long	0x4917
+	.uleb128 0x2
+	.long	0x5b68
+	.uleb128 0x1
+	.long	0x5b5e
+	.long	.LLST330
+	.long	.LVUS330
+	.byte	0
+	.uleb128 0x3
+	.long	0x5b4f
+	.quad	.LBI1413
+	.value	.LVU3277
+	.quad	.LBB1413
+	.quad	.LBE1413-.LBB1413
+	.byte	0x2f
+	.value	0x42f
+	.long	0x4958
+	.uleb128 0x1
+	.long	0x5b68
+	.long	.LLST331
+	.long	.LVUS331
+	.uleb128 0x1
+	.long	0x5b5e
+	.long	.LLST332
+	.long	.LVUS332
+	.byte	0
+	.uleb128 0x3
+	.long	0x5b4f
+	.quad	.LBI1415
+	.value	.LVU3287
+	.quad	.LBB1415
+	.quad	.LBE1415-.LBB1415
+	.byte	0x2f
+	.value	0x46b
+	.long	0x4991
+	.uleb128 0x2
+	.long	0x5b68
+	.uleb128 0x1
+	.long	0x5b5e
+	.long	.LLST333
+	.long	.LVUS333
+	.byte	0
+	.uleb128 0x3
+	.long	0x5b4f
+	.quad	.LBI1417
+	.value	.LVU3297
+	.quad	.LBB1417
+	.quad	.LBE1417-.LBB1417
+	.byte	0x2f
+	.value	0x4cb
+	.long	0x49ca
+	.uleb128 0x2
+	.long	0x5b68
+	.uleb128 0x1
+	.long	0x5b5e
+	.long	.LLST334
+	.long	.LVUS334
+	.byte	0
+	.uleb128 0x3
+	.long	0x5b4f
+	.quad	.LBI1419
+	.value	.LVU3307
+	.quad	.LBB1419
+	.quad	.LBE1419-.LBB1419
+	.byte	0x2f
+	.value	0x507
+	.long	0x4a03
+	.uleb128 0x2
+	.long	0x5b68
+	.uleb128 0x1
+	.long	0x5b5e
+	.long	.LLST335
+	.long	.LVUS335
+	.byte	0
+	.uleb128 0x3
+	.long	0x5b4f
+	.quad	.LBI1421
+	.value	.LVU3319
+	.quad	.LBB1421
+	.quad	.LBE1421-.LBB1421
+	.byte	0x2f
+	.value	0x579
+	.long	0x4a3c
+	.uleb128 0x2
+	.long	0x5b68
+	.uleb128 0x1
+	.long	0x5b5e
+	.long	.LLST336
+	.long	.LVUS336
+	.byte	0
+	.uleb128 0x3
+	.long	0x5b4f
+	.quad	.LBI1423
+	.value	.LVU3329
+	.quad	.LBB1423
+	.quad	.LBE1423-.LBB1423
+	.byte	0x2f
+	.value	0x5b5
+	.long	0x4a75
+	.uleb128 0x2
+	.long	0x5b68
+	.uleb128 0x1
+	.long	0x5b5e
+	.long	.LLST337
+	.long	.LVUS337
+	.byte	0
+	.uleb128 0x3
+	.long	0x5b4f
+	.quad	.LBI1425
+	.value	.LVU3339
+	.quad	.LBB1425
+	.quad	.LBE1425-.LBB1425
+	.byte	0x2f
+	.value	0x615
+	.long	0x4aae
+	.uleb128 0x2
+	.long	0x5b68
+	.uleb128 0x1
+	.long	0x5b5e
+	.long	.LLST338
+	.long	.LVUS338
+	.byte	0
+	.uleb128 0x3
+	.long	0x5b4f
+	.quad	.LBI1427
+	.value	.LVU3348
+	.quad	.LBB1427
+	.quad	.LBE1427-.LBB1427
+	.byte	0x2f
+	.value	0x651
+	.long	0x4ae7
+	.uleb128 0x2
+	.long	0x5b68
+	.uleb128 0x1
+	.long	0x5b5e
+	.long	.LLST339
+	.long	.LVUS339
+	.byte	0
+	.uleb128 0x3
+	.long	0x5b4f
+	.quad	.LBI1429
+	.value	.LVU3362
+	.quad	.LBB1429
+	.quad	.LBE1429-.LBB1429
+	.byte	0x2f
+	.value	0x6c4
+	.long	0x4b20
+	.uleb128 0x2
+	.long	0x5b68
+	.uleb128 0x1
+	.long	0x5b5e
+	.long	.LLST340
+	.long	.LVUS340
+	.byte	0
+	.uleb128 0x3
+	.long	0x5b4f
+	.quad	.LBI1431
+	.value	.LVU3372
+	.quad	.LBB1431
+	.quad	.LBE1431-.LBB1431
+	.byte	0x2f
+	.value	0x700
+	.long	0x4b59
+	.uleb128 0x2
+	.long	0x5b68
+	.uleb128 0x1
+	.long	0x5b5e
+	.long	.LLST341
+	.long	.LVUS341
+	.byte	0
+	.uleb128 0x3
+	.long	0x5b4f
+	.quad	.LBI1433
+	.value	.LVU3382
+	.quad	.LBB1433
+	.quad	.LBE1433-.LBB1433
+	.byte	0x2f
+	.value	0x761
+	.long	0x4b92
+	.uleb128 0x2
+	.long	0x5b68
+	.uleb128 0x1
+	.long	0x5b5e
+	.long	.LLST342
+	.long	.LVUS342
+	.byte	0
+	.uleb128 0x3
+	.long	0x5b4f
+	.quad	.LBI1435
+	.value	.LVU3392
+	.quad	.LBB1435
+	.quad	.LBE1435-.LBB1435
+	.byte	0x2f
+	.value	0x79d
+	.long	0x4bcb
+	.uleb128 0x2
+	.long	0x5b68
+	.uleb128 0x1
+	.long	0x5b5e
+	.long	.LLST343
+	.long	.LVUS343
+	.byte	0
+	.uleb128 0x5
+	.long	0x5b4f
+	.quad	.LBI1437
+	.value	.LVU3403
+	.long	.LLRL344
+	.byte	0x2f
+	.value	0x810
+	.long	0x4c00
+	.uleb128 0x1
+	.long	0x5b68
+	.long	.LLST345
+	.long	.LVUS345
+	.uleb128 0x1
+	.long	0x5b5e
+	.long	.LLST346
+	.long	.LVUS346
+	.byte	0
+	.uleb128 0x3
+	.long	0x5b4f
+	.quad	.LBI1441
+	.value	.LVU3417
+	.quad	.LBB1441
+	.quad	.LBE1441-.LBB1441
+	.byte	0x2f
+	.value	0x84c
+	.long	0x4c39
+	.uleb128 0x2
+	.long	0x5b68
+	.uleb128 0x1
+	.long	0x5b5e
+	.long	.LLST347
+	.long	.LVUS347
+	.byte	0
+	.uleb128 0x3
+	.long	0x5b4f
+	.quad	.LBI1443
+	.value	.LVU3427
+	.quad	.LBB1443
+	.quad	.LBE1443-.LBB1443
+	.byte	0x2f
+	.value	0x8ad
+	.long	0x4c72
+	.uleb128 0x2
+	.long	0x5b68
+	.uleb128 0x1
+	.long	0x5b5e
+	.long	.LLST348
+	.long	.LVUS348
+	.byte	0
+	.uleb128 0x3
+	.long	0x5b4f
+	.quad	.LBI1445
+	.value	.LVU3437
+	.quad	.LBB1445
+	.quad	.LBE1445-.LBB1445
+	.byte	0x2f
+	.value	0x8e9
+	.long	0x4cab
+	.uleb128 0x2
+	.long	0x5b68
+	.uleb128 0x1
+	.long	0x5b5e
+	.long	.LLST349
+	.long	.LVUS349
+	.byte	0
+	.uleb128 0x3
+	.long	0x5b4f
+	.quad	.LBI1447
+	.value	.LVU3449
+	.quad	.LBB1447
+	.quad	.LBE1447-.LBB1447
+	.byte	0x2f
+	.value	0x95c
+	.long	0x4ce4
+	.uleb128 0x2
+	.long	0x5b68
+	.uleb128 0x1
+	.long	0x5b5e
+	.long	.LLST350
+	.long	.LVUS350
+	.byte	0
+	.uleb128 0x3
+	.long	0x5b4f
+	.quad	.LBI1449
+	.value	.LVU3459
+	.quad	.LBB1449
+	.quad	.LBE1449-.LBB1449
+	.byte	0x2f
+	.value	0x998
+	.long	0x4d1d
+	.uleb128 0x2
+	.long	0x5b68
+	.uleb128 0x1
+	.long	0x5b5e
+	.long	.LLST351
+	.long	.LVUS351
+	.byte	0
+	.uleb128 0x3
+	.long	0x5b4f
+	.quad	.LBI1451
+	.value	.LVU3469
+	.quad	.LBB1451
+	.quad	.LBE1451-.LBB1451
+	.byte	0x2f
+	.value	0x9f9
+	.long	0x4d56
+	.uleb128 0x2
+	.long	0x5b68
+	.uleb128 0x1
+	.long	0x5b5e
+	.long	.LLST352
+	.long	.LVUS352
+	.byte	0
+	.uleb128 0x3
+	.long	0x5b4f
+	.quad	.LBI1453
+	.value	.LVU3479
+	.quad	.LBB1453
+	.quad	.LBE1453-.LBB1453
+	.byte	0x2f
+	.value	0xa35
+	.long	0x4d8f
+	.uleb128 0x2
+	.long	0x5b68
+	.uleb128 0x1
+	.long	0x5b5e
+	.long	.LLST353
+	.long	.LVUS353
+	.byte	0
+	.uleb128 0x4
+	.long	0x5b4f
+	.quad	.LBI1455
+	.value	.LVU3493
+	.quad	.LBB1455
+	.quad	.LBE1455-.LBB1455
+	.byte	0x30
+	.byte	0x52
+	.long	0x4dc7
+	.uleb128 0x2
+	.long	0x5b68
+	.uleb128 0x1
+	.long	0x5b5e
+	.long	.LLST354
+	.long	.LVUS354
+	.byte	0
+	.uleb128 0x4
+	.long	0x5b4f
+	.quad	.LBI1457
+	.value	.LVU3503
+	.quad	.LBB1457
+	.quad	.LBE1457-.LBB1457
+	.byte	0x30
+	.byte	0x8e
+	.long	0x4dff
+	.uleb128 0x2
+	.long	0x5b68
+	.uleb128 0x1
+	.long	0x5b5e
+	.long	.LLST355
+	.long	.LVUS355
+	.byte	0
+	.uleb128 0x4
+	.long	0x5b4f
+	.quad	.LBI1459
+	.value	.LVU3513
+	.quad	.LBB1459
+	.quad	.LBE1459-.LBB1459
+	.byte	0x30
+	.byte	0xef
+	.long	0x4e37
+	.uleb128 0x2
+	.long	0x5b68
+	.uleb128 0x1
+	.long	0x5b5e
+	.long	.LLST356
+	.long	.LVUS356
+	.byte	0
+	.uleb128 0x5
+	.long	0x5b4f
+	.quad	.LBI1461
+	.value	.LVU3524
+	.long	.LLRL357
+	.byte	0x30
+	.value	0x12b
+	.long	0x4e64
+	.uleb128 0x2
+	.long	0x5b68
+	.uleb128 0x1
+	.long	0x5b5e
+	.long	.LLST358
+	.long	.LVUS358
+	.byte	0
+	.uleb128 0x3
+	.long	0x5b4f
+	.quad	.LBI1465
+	.value	.LVU3535
+	.quad	.LBB1465
+	.quad	.LBE1465-.LBB1465
+	.byte	0x30
+	.value	0x19e
+	.long	0x4e9d
+	.uleb128 0x2
+	.long	0x5b68
+	.uleb128 0x1
+	.long	0x5b5e
+	.long	.LLST359
+	.long	.LVUS359
+	.byte	0
+	.uleb128 0x3
+	.long	0x5b4f
+	.quad	.LBI1467
+	.value	.LVU3545
+	.quad	.LBB1467
+	.quad	.LBE1467-.LBB1467
+	.byte	0x30
+	.value	0x1da
+	.long	0x4ed6
+	.uleb128 0x2
+	.long	0x5b68
+	.uleb128 0x1
+	.long	0x5b5e
+	.long	.LLST360
+	.long	.LVUS360
+	.byte	0
+	.uleb128 0x3
+	.long	0x5b4f
+	.quad	.LBI1469
+	.value	.LVU3555
+	.quad	.LBB1469
+	.quad	.LBE1469-.LBB1469
+	.byte	0x30
+	.value	0x23b
+	.long	0x4f0f
+	.uleb128 0x2
+	.long	0x5b68
+	.uleb128 0x1
+	.long	0x5b5e
+	.long	.LLST361
+	.long	.LVUS361
+	.byte	0
+	.uleb128 0x3
+	.long	0x5b4f
+	.quad	.LBI1471
+	.value	.LVU3565
+	.quad	.LBB1471
+	.quad	.LBE1471-.LBB1471
+	.byte	0x30
+	.value	0x277
+	.long	0x4f48
+	.uleb128 0x2
+	.long	0x5b68
+	.uleb128 0x1
+	.long	0x5b5e
+	.long	.LLST362
+	.long	.LVUS362
+	.byte	0
+	.uleb128 0x3
+	.long	0x5b4f
+	.quad	.LBI1473
+	.value	.LVU3580
+	.quad	.LBB1473
+	.quad	.LBE1473-.LBB1473
+	.byte	0x30
+	.value	0x2ea
+	.long	0x4f81
+	.uleb128 0x2
+	.long	0x5b68
+	.uleb128 0x1
+	.long	0x5b5e
+	.long	.LLST363
+	.long	.LVUS363
+	.byte	0
+	.uleb128 0x3
+	.long	0x5b4f
+	.quad	.LBI1475
+	.value	.LVU3590
+	.quad	.LBB1475
+	.quad	.LBE1475-.LBB1475
+	.byte	0x30
+	.value	0x326
+	.long	0x4fba
+	.uleb128 0x2
+	.long	0x5b68
+	.uleb128 0x1
+	.long	0x5b5e
+	.long	.LLST364
+	.long	.LVUS364
+	.byte	0
+	.uleb128 0x3
+	.long	0x5b4f
+	.quad	.LBI1477
+	.value	.LVU3600
+	.quad	.LBB1477
+	.quad	.LBE1477-.LBB1477
+	.byte	0x30
+	.value	0x387
+	.long	0x4ff3
+	.uleb128 0x2
+	.long	0x5b68
+	.uleb128 0x1
+	.long	0x5b5e
+	.long	.LLST365
+	.long	.LVUS365
+	.byte	0
+	.uleb128 0x3
+	.long	0x5b4f
+	.quad	.LBI1479
+	.value	.LVU3609
+	.quad	.LBB1479
+	.quad	.LBE1479-.LBB1479
+	.byte	0x30
+	.value	0x3c3
+	.long	0x502c
+	.uleb128 0x2
+	.long	0x5b68
+	.uleb128 0x1
+	.long	0x5b5e
+	.long	.LLST366
+	.long	.LVUS366
+	.byte	0
+	.uleb128 0x5
+	.long	0x5b4f
+	.quad	.LBI1481
+	.value	.LVU3621
+	.long	.LLRL367
+	.byte	0x30
+	.value	0x436
+	.long	0x5061
+	.uleb128 0x1
+	.long	0x5b68
+	.long	.LLST368
+	.long	.LVUS368
+	.uleb128 0x1
+	.long	0x5b5e
+	.long	.LLST369
+	.long	.LVUS369
+	.byte	0
+	.uleb128 0x3
+	.long	0x5b4f
+	.quad	.LBI1485
+	.value	.LVU3632
+	.quad	.LBB1485
+	.quad	.LBE1485-.LBB1485
+	.byte	0x30
+	.value	0x472
+	.long	0x509a
+	.uleb128 0x2
+	.long	0x5b68
+	.uleb128 0x1
+	.long	0x5b5e
+	.long	.LLST370
+	.long	.LVUS370
+	.byte	0
+	.uleb128 0x3
+	.long	0x5b4f
+	.quad	.LBI1487
+	.value	.LVU3642
+	.quad	.LBB1487
+	.quad	.LBE1487-.LBB1487
+	.byte	0x30
+	.value	0x4d3
+	.long	0x50d3
+	.uleb128 0x2
+	.long	0x5b68
+	.uleb128 0x1
+	.long	0x5b5e
+	.long	.LLST371
+	.long	.LVUS371
+	.byte	0
+	.uleb128 0x3
+	.long	0x5b4f
+	.quad	.LBI1489
+	.value	.LVU3652
+	.quad	.LBB1489
+	.quad	.LBE1489-.LBB1489
+	.byte	0x30
+	.value	0x50f
+	.long	0x510c
+	.uleb128 0x2
+	.long	0x5b68
+	.uleb128 0x1
+	.long	0x5b5e
+	.long	.LLST372
+	.long	.LVUS372
+	.byte	0
+	.uleb128 0x3
+	.long	0x5b4f
+	.quad	.LBI1491
+	.value	.LVU3664
+	.quad	.LBB1491
+	.quad	.LBE1491-.LBB1491
+	.byte	0x30
+	.value	0x582
+	.long	0x5145
+	.uleb128 0x2
+	.long	0x5b68
+	.uleb128 0x1
+	.long	0x5b5e
+	.long	.LLST373
+	.long	.LVUS373
+	.byte	0
+	.uleb128 0x3
+	.long	0x5b4f
+	.quad	.LBI1493
+	.value	.LVU3674
+	.quad	.LBB1493
+	.quad	.LBE1493-.LBB1493
+	.byte	0x30
+	.value	0x5be
+	.long	0x517e
+	.uleb128 0x2
+	.long	0x5b68
+	.uleb128 0x1
+	.long	0x5b5e
+	.long	.LLST374
+	.long	.LVUS374
+	.byte	0
+	.uleb128 0x3
+	.long	0x5b4f
+	.quad	.LBI1495
+	.value	.LVU3684
+	.quad	.LBB1495
+	.quad	.LBE1495-.LBB1495
+	.byte	0x30
+	.value	0x61f
+	.long	0x51b7
+	.uleb128 0x2
+	.long	0x5b68
+	.uleb128 0x1
+	.long	0x5b5e
+	.long	.LLST375
+	.long	.LVUS375
+	.byte	0
+	.uleb128 0x3
+	.long	0x5b4f
+	.quad	.LBI1497
+	.value	.LVU3693
+	.quad	.LBB1497
+	.quad	.LBE1497-.LBB1497
+	.byte	0x30
+	.value	0x65b
+	.long	0x51f0
+	.uleb128 0x2
+	.long	0x5b68
+	.uleb128 0x1
+	.long	0x5b5e
+	.long	.LLST376
+	.long	.LVUS376
+	.byte	0
+	.uleb128 0x3
+	.long	0x5b4f
+	.quad	.LBI1499
+	.value	.LVU3706
+	.quad	.LBB1499
+	.quad	.LBE1499-.LBB1499
+	.byte	0x30
+	.value	0x6cf
+	.long	0x5229
+	.uleb128 0x2
+	.long	0x5b68
+	.uleb128 0x1
+	.long	0x5b5e
+	.long	.LLST377
+	.long	.LVUS377
+	.byte	0
+	.uleb128 0x3
+	.long	0x5b4f
+	.quad	.LBI1501
+	.value	.LVU3717
+	.quad	.LBB1501
+	.quad	.LBE1501-.LBB1501
+	.byte	0x30
+	.value	0x70b
+	.long	0x5262
+	.uleb128 0x2
+	.long	0x5b68
+	.uleb128 0x1
+	.long	0x5b5e
+	.long	.LLST378
+	.long	.LVUS378
+	.byte	0
+	.uleb128 0x5
+	.long	0x5b4f
+	.quad	.LBI1503
+	.value	.LVU3727
+	.long	.LLRL379
+	.byte	0x30
+	.value	0x76d
+	.long	0x528f
+	.uleb128 0x2
+	.long	0x5b68
+	.uleb128 0x1
+	.long	0x5b5e
+	.long	.LLST380
+	.long	.LVUS380
+	.byte	0
+	.uleb128 0x3
+	.long	0x5b4f
+	.quad	.LBI1507
+	.value	.LVU3738
+	.quad	.LBB1507
+	.quad	.LBE1507-.LBB1507
+	.byte	0x30
+	.value	0x7a9
+	.long	0x52c8
+	.uleb128 0x2
+	.long	0x5b68
+	.uleb128 0x1
+	.long	0x5b5e
+	.long	.LLST381
+	.long	.LVUS381
+	.byte	0
+	.uleb128 0x3
+	.long	0x5b4f
+	.quad	.LBI1509
+	.value	.LVU3753
+	.quad	.LBB1509
+	.quad	.LBE1509-.LBB1509
+	.byte	0x30
+	.value	0x81d
+	.long	0x5301
+	.uleb128 0x2
+	.long	0x5b68
+	.uleb128 0x1
+	.long	0x5b5e
+	.long	.LLST382
+	.long	.LVUS382
+	.byte	0
+	.uleb128 0x3
+	.long	0x5b4f
+	.quad	.LBI1511
+	.value	.LVU3763
+	.quad	.LBB1511
+	.quad	.LBE1511-.LBB1511
+	.byte	0x30
+	.value	0x859
+	.long	0x533a
+	.uleb128 0x2
+	.long	0x5b68
+	.uleb128 0x1
+	.long	0x5b5e
+	.long	.LLST383
+	.long	.LVUS383
+	.byte	0
+	.uleb128 0x5
+	.long	0x5b4f
+	.quad	.LBI1513
+	.value	.LVU3775
+	.long	.LLRL384
+	.byte	0x30
+	.value	0x8bb
+	.long	0x5367
+	.uleb128 0x2
+	.long	0x5b68
+	.uleb128 0x1
+	.long	0x5b5e
+	.long	.LLST385
+	.long	.LVUS385
+	.byte	0
+	.uleb128 0x3
+	.long	0x5b4f
+	.quad	.LBI1517
+	.value	.LVU3786
+	.quad	.LBB1517
+	.quad	.LBE1517-.LBB1517
+	.byte	0x30
+	.value	0x8f7
+	.long	0x53a0
+	.uleb128 0x2
+	.long	0x5b68
+	.uleb128 0x1
+	.long	0x5b5e
+	.long	.LLST386
+	.long	.LVUS386
+	.byte	0
+	.uleb128 0x3
+	.long	0x5b4f
+	.quad	.LBI1519
+	.value	.LVU3798
+	.quad	.LBB1519
+	.quad	.LBE1519-.LBB1519
+	.byte	0x30
+	.value	0x96b
+	.long	0x53e1
+	.uleb128 0x1
+	.long	0x5b68
+	.long	.LLST387
+	.long	.LVUS387
+	.uleb128 0x1
+	.long	0x5b5e
+	.long	.LLST388
+	.long	.LVUS388
+	.byte	0
+	.uleb128 0x5
+	.long	0x5b4f
+	.quad	.LBI1521
+	.value	.LVU3808
+	.long	.LLRL389
+	.byte	0x30
+	.value	0x9a7
+	.long	0x540e
+	.uleb128 0x2
+	.long	0x5b68
+	.uleb128 0x1
+	.long	0x5b5e
+	.long	.LLST390
+	.long	.LVUS390
+	.byte	0
+	.uleb128 0x3
+	.long	0x5b4f
+	.quad	.LBI1525
+	.value	.LVU3819
+	.quad	.LBB1525
+	.quad	.LBE1525-.LBB1525
+	.byte	0x30
+	.value	0xa09
+	.long	0x5447
+	.uleb128 0x2
+	.long	0x5b68
+	.uleb128 0x1
+	.long	0x5b5e
+	.long	.LLST391
+	.long	.LVUS391
+	.byte	0
+	.uleb128 0x3
+	.long	0x5b4f
+	.quad	.LBI1527
+	.value	.LVU3829
+	.quad	.LBB1527
+	.quad	.LBE1527-.LBB1527
+	.byte	0x30
+	.value	0xa45
+	.long	0x5480
+	.uleb128 0x2
+	.long	0x5b68
+	.uleb128 0x1
+	.long	0x5b5e
+	.long	.LLST392
+	.long	.LVUS392
+	.byte	0
+	.uleb128 0x4
+	.long	0x5b4f
+	.quad	.LBI1529
+	.value	.LVU3843
+	.quad	.LBB1529
+	.quad	.LBE1529-.LBB1529
+	.byte	0x31
+	.byte	0x52
+	.long	0x54b8
+	.uleb128 0x2
+	.long	0x5b68
+	.uleb128 0x1
+	.long	0x5b5e
+	.long	.LLST393
+	.long	.LVUS393
+	.byte	0
+	.uleb128 0x4
+	.long	0x5b4f
+	.quad	.LBI1531
+	.value	.LVU3853
+	.quad	.LBB1531
+	.quad	.LBE1531-.LBB1531
+	.byte	0x31
+	.byte	0x8e
+	.long	0x54f0
+	.uleb128 0x2
+	.long	0x5b68
+	.uleb128 0x1
+	.long	0x5b5e
+	.long	.LLST394
+	.long	.LVUS394
+	.byte	0
+	.uleb128 0x4
+	.long	0x5b4f
+	.quad	.LBI1533
+	.value	.LVU3863
+	.quad	.LBB1533
+	.quad	.LBE1533-.LBB1533
+	.byte	0x31
+	.byte	0xef
+	.long	0x5528
+	.uleb128 0x2
+	.long	0x5b68
+	.uleb128 0x1
+	.long	0x5b5e
+	.long	.LLST395
+	.long	.LVUS395
+	.byte	0
+	.uleb128 0x5
+	.long	0x5b4f
+	.quad	.LBI1535
+	.value	.LVU3873
+	.long	.LLRL396
+	.byte	0x31
+	.value	0x12b
+	.long	0x5555
+	.uleb128 0x2
+	.long	0x5b68
+	.uleb128 0x1
+	.long	0x5b5e
+	.long	.LLST397
+	.long	.LVUS397
+	.byte	0
+	.uleb128 0x3
+	.long	0x5b4f
+	.quad	.LBI1539
+	.value	.LVU3888
+	.quad	.LBB1539
+	.quad	.LBE1539-.LBB1539
+	.byte	0x31
+	.value	0x19e
+	.long	0x558e
+	.uleb128 0x2
+	.long	0x5b68
+	.uleb128 0x1
+	.long	0x5b5e
+	.long	.LLST398
+	.long	.LVUS398
+	.byte	0
+	.uleb128 0x5
+	.long	0x5b4f
+	.quad	.LBI1541
+	.value	.LVU3898
+	.long	.LLRL399
+	.byte	0x31
+	.value	0x1da
+	.long	0x55bb
+	.uleb128 0x2
+	.long	0x5b68
+	.uleb128 0x1
+	.long	0x5b5e
+	.long	.LLST400
+	.long	.LVUS400
+	.byte	0
+	.uleb128 0x5
+	.long	0x5b4f
+	.quad	.LBI1545
+	.value	.LVU3909
+	.long	.LLRL401
+	.byte	0x31
+	.value	0x23b
+	.long	0x55e8
+	.uleb128 0x2
+	.long	0x5b68
+	.uleb128 0x1
+	.long	0x5b5e
+	.long	.LLST402
+	.long	.LVUS402
+	.byte	0
+	.uleb128 0x3
+	.long	0x5b4f
+	.quad	.LBI1549
+	.value	.LVU3920
+	.quad	.LBB1549
+	.quad	.LBE1549-.LBB1549
+	.byte	0x31
+	.value	0x277
+	.long	0x5621
+	.uleb128 0x2
+	.long	0x5b68
+	.uleb128 0x1
+	.long	0x5b5e
+	.long	.LLST403
+	.long	.LVUS403
+	.byte	0
+	.uleb128 0x3
+	.long	0x5b4f
+	.quad	.LBI1551
+	.value	.LVU3933
+	.quad	.LBB1551
+	.quad	.LBE1551-.LBB1551
+	.byte	0x31
+	.value	0x2ea
+	.long	0x565a
+	.uleb128 0x2
+	.long	0x5b68
+	.uleb128 0x1
+	.long	0x5b5e
+	.long	.LLST404
+	.long	.LVUS404
+	.byte	0
+	.uleb128 0x5
+	.long	0x5b4f
+	.quad	.LBI1553
+	.value	.LVU3943
+	.long	.LLRL405
+	.byte	0x31
+	.value	0x326
+	.long	0x5687
+	.uleb128 0x2
+	.long	0x5b68
+	.uleb128 0x1
+	.long	0x5b5e
+	.long	.LLST406
+	.long	.LVUS406
+	.byte	0
+	.uleb128 0x3
+	.long	0x5b4f
+	.quad	.LBI1557
+	.value	.LVU3955
+	.quad	.LBB1557
+	.quad	.LBE1557-.LBB1557
+	.byte	0x31
+	.value	0x387
+	.long	0x56c0
+	.uleb128 0x2
+	.long	0x5b68
+	.uleb128 0x1
+	.long	0x5b5e
+	.long	.LLST407
+	.long	.LVUS407
+	.byte	0
+	.uleb128 0x3
+	.long	0x5b4f
+	.quad	.LBI1559
+	.value	.LVU3965
+	.quad	.LBB1559
+	.quad	.LBE1559-.LBB1559
+	.byte	0x31
+	.value	0x3c3
+	.long	0x56f9
+	.uleb128 0x2
+	.long	0x5b68
+	.uleb128 0x1
+	.long	0x5b5e
+	.long	.LLST408
+	.long	.LVUS408
+	.byte	0
+	.uleb128 0x3
+	.long	0x5b4f
+	.quad	.LBI1561
+	.value	.LVU3977
+	.quad	.LBB1561
+	.quad	.LBE1561-.LBB1561
+	.byte	0x31
+	.value	0x436
+	.long	0x573a
+	.uleb128 0x1
+	.long	0x5b68
+	.long	.LLST409
+	.long	.LVUS409
+	.uleb128 0x1
+	.long	0x5b5e
+	.long	.LLST410
+	.long	.LVUS410
+	.byte	0
+	.uleb128 0x3
+	.long	0x5b4f
+	.quad	.LBI1563
+	.value	.LVU3987
+	.quad	.LBB1563
+	.quad	.LBE1563-.LBB1563
+	.byte	0x31
+	.value	0x472
+	.long	0x5773
+	.uleb128 0x2
+	.long	0x5b68
+	.uleb128 0x1
+	.long	0x5b5e
+	.long	.LLST411
+	.long	.LVUS411
+	.byte	0
+	.uleb128 0x3
+	.long	0x5b4f
+	.quad	.LBI1565
+	.value	.LVU3997
+	.quad	.LBB1565
+	.quad	.LBE1565-.LBB1565
+	.byte	0x31
+	.value	0x4d3
+	.long	0x57ac
+	.uleb128 0x2
+	.long	0x5b68
+	.uleb128 0x1
+	.long	0x5b5e
+	.long	.LLST412
+	.long	.LVUS412
+	.byte	0
+	.uleb128 0x3
+	.long	0x5b4f
+	.quad	.LBI1567
+	.value	.LVU4007
+	.quad	.LBB1567
+	.quad	.LBE1567-.LBB1567
+	.byte	0x31
+	.value	0x50f
+	.long	0x57e5
+	.uleb128 0x2
+	.long	0x5b68
+	.uleb128 0x1
+	.long	0x5b5e
+	.long	.LLST413
+	.long	.LVUS413
+	.byte	0
+	.uleb128 0x3
+	.long	0x5b4f
+	.quad	.LBI1569
+	.value	.LVU4019
+	.quad	.LBB1569
+	.quad	.LBE1569-.LBB1569
+	.byte	0x31
+	.value	0x582
+	.long	0x581e
+	.uleb128 0x2
+	.long	0x5b68
+	.uleb128 0x1
+	.long	0x5b5e
+	.long	.LLST414
+	.long	.LVUS414
+	.byte	0
+	.uleb128 0x3
+	.long	0x5b4f
+	.quad	.LBI1571
+	.value	.LVU4029
+	.quad	.LBB1571
+	.quad	.LBE1571-.LBB1571
+	.byte	0x31
+	.value	0x5be
+	.long	0x5857
+	.uleb128 0x2
+	.long	0x5b68
+	.uleb128 0x1
+	.long	0x5b5e
+	.long	.LLST415
+	.long	.LVUS415
+	.byte	0
+	.uleb128 0x5
+	.long	0x5b4f
+	.quad	.LBI1573
+	.value	.LVU4037
+	.long	.LLRL416
+	.byte	0x31
+	.value	0x61f
+	.long	0x588c
+	.uleb128 0x1
+	.long	0x5b68
+	.long	.LLST417
+	.long	.LVUS417
+	.uleb128 0x1
+	.long	0x5b5e
+	.long	.LLST418
+	.long	.LVUS418
+	.byte	0
+	.uleb128 0x5
+	.long	0x5b4f
+	.quad	.LBI1577
+	.value	.LVU4048
+	.long	.LLRL419
+	.byte	0x31
+	.value	0x65b
+	.long	0x58c1
+	.uleb128 0x1
+	.long	0x5b68
+	.long	.LLST420
+	.long	.LVUS420
+	.uleb128 0x1
+	.long	0x5b5e
+	.long	.LLST421
+	.long	.LVUS421
+	.byte	0
+	.uleb128 0x3
+	.long	0x5b4f
+	.quad	.LBI1581
+	.value	.LVU4060
+	.quad	.LBB1581
+	.quad	.LBE1581-.LBB1581
+	.byte	0x31
+	.value	0x6cf
+	.long	0x5902
+	.uleb128 0x1
+	.long	0x5b68
+	.long	.LLST422
+	.long	.LVUS422
+	.uleb128 0x1
+	.long	0x5b5e
+	.long	.LLST423
+	.long	.LVUS423
+	.byte	0
+	.uleb128 0x3
+	.long	0x5b4f
+	.quad	.LBI1583
+	.value	.LVU4070
+	.quad	.LBB1583
+	.quad	.LBE1583-.LBB1583
+	.byte	0x31
+	.value	0x70b
+	.long	0x593b
+	.uleb128 0x2
+	.long	0x5b68
+	.uleb128 0x1
+	.long	0x5b5e
+	.long	.LLST424
+	.long	.LVUS424
+	.byte	0
+	.uleb128 0x5
+	.long	0x5b4f
+	.quad	.LBI1585
+	.value	.LVU4078
+	.long	.LLRL425
+	.byte	0x31
+	.value	0x76d
+	.long	0x5970
+	.uleb128 0x1
+	.long	0x5b68
+	.long	.LLST426
+	.long	.LVUS426
+	.uleb128 0x1
+	.long	0x5b5e
+	.long	.LLST427
+	.long	.LVUS427
+	.byte	0
+	.uleb128 0x5
+	.long	0x5b4f
+	.quad	.LBI1589
+	.value	.LVU4089
+	.long	.LLRL428
+	.byte	0x31
+	.value	0x7a9
+	.long	0x59a5
+	.uleb128 0x1
+	.long	0x5b68
+	.long	.LLST429
+	.long	.LVUS429
+	.uleb128 0x1
+	.long	0x5b5e
+	.long	.LLST430
+	.long	.LVUS430
+	.byte	0
+	.uleb128 0x3
+	.long	0x5b4f
+	.quad	.LBI1593
+	.value	.LVU4101
+	.quad	.LBB1593
+	.quad	.LBE1593-.LBB1593
+	.byte	0x31
+	.value	0x81d
+	.long	0x59de
+	.uleb128 0x2
+	.long	0x5b68
+	.uleb128 0x1
+	.long	0x5b5e
+	.long	.LLST431
+	.long	.LVUS431
+	.byte	0
+	.uleb128 0x3
+	.long	0x5b4f
+	.quad	.LBI1595
+	.value	.LVU4111
+	.quad	.LBB1595
+	.quad	.LBE1595-.LBB1595
+	.byte	0x31
+	.value	0x859
+	.long	0x5a17
+	.uleb128 0x2
+	.long	0x5b68
+	.uleb128 0x1
+	.long	0x5b5e
+	.long	.LLST432
+	.long	.LVUS432
+	.byte	0
+	.uleb128 0x5
+	.long	0x5b4f
+	.quad	.LBI1597
+	.value	.LVU4119
+	.long	.LLRL433
+	.byte	0x31
+	.value	0x8bb
+	.long	0x5a4c
+	.uleb128 0x1
+	.long	0x5b68
+	.long	.LLST434
+	.long	.LVUS434
+	.uleb128 0x1
+	.long	0x5b5e
+	.long	.LLST435
+	.long	.LVUS435
+	.byte	0
+	.uleb128 0x5
+	.long	0x5b4f
+	.quad	.LBI1601
+	.value	.LVU4130
+	.long	.LLRL436
+	.byte	0x31
+	.value	0x8f7
+	.long	0x5a81
+	.uleb128 0x1
+	.long	0x5b68
+	.long	.LLST437
+	.long	.LVUS437
+	.uleb128 0x1
+	.long	0x5b5e
+	.long	.LLST438
+	.long	.LVUS438
+	.byte	0
+	.uleb128 0x5
+	.long	0x5b4f
+	.quad	.LBI1607
+	.value	.LVU4146
+	.long	.LLRL439
+	.byte	0x31
+	.value	0x96b
+	.long	0x5aae
+	.uleb128 0x2
+	.long	0x5b68
+	.uleb128 0x1
+	.long	0x5b5e
+	.long	.LLST440
+	.long	.LVUS440
+	.byte	0
+	.uleb128 0x3
+	.long	0x5b4f
+	.quad	.LBI1611
+	.value	.LVU4157
+	.quad	.LBB1611
+	.quad	.LBE1611-.LBB1611
+	.byte	0x31
+	.value	0x9a7
+	.long	0x5ae7
+	.uleb128 0x2
+	.long	0x5b68
+	.uleb128 0x1
+	.long	0x5b5e
+	.long	.LLST441
+	.long	.LVUS441
+	.byte	0
+	.uleb128 0x5
+	.long	0x5b4f
+	.quad	.LBI1613
+	.value	.LVU4165
+	.long	.LLRL442
+	.byte	0x31
+	.value	0xa09
+	.long	0x5b1c
+	.uleb128 0x1
+	.long	0x5b68
+	.long	.LLST443
+	.long	.LVUS443
+	.uleb128 0x1
+	.long	0x5b5e
+	.long	.LLST444
+	.long	.LVUS444
+	.byte	0
+	.uleb128 0x2c
+	.long	0x5b4f
+	.quad	.LBI1617
+	.value	.LVU4175
+	.long	.LLRL445
+	.byte	0x1
+	.byte	0x31
+	.value	0xa45
+	.uleb128 0x1
+	.long	0x5b68
+	.long	.LLST446
+	.long	.LVUS446
+	.uleb128 0x1
+	.long	0x5b5e
+	.long	.LLST447
+	.long	.LVUS447
+	.byte	0
+	.byte	0
+	.uleb128 0x18
+	.long	.LASF28
+	.byte	0x1
+	.byte	0x5
+	.long	0x293
+	.long	0x5b73
+	.uleb128 0x9
+	.string	"l"
+	.byte	0x1
+	.byte	0x5
+	.byte	0x22
+	.long	0x67
+	.uleb128 0x9
+	.string	"x"
+	.byte	0x1
+	.byte	0x5
+	.byte	0x29
+	.long	0x293
+	.byte	0
+	.uleb128 0x18
+	.long	.LASF29
+	.byte	0x2
+	.byte	0x74
+	.long	0x293
+	.long	0x5b8d
+	.uleb128 0x9
+	.string	"x"
+	.byte	0x2
+	.byte	0x74
+	.byte	0x32
+	.long	0x48b
+	.byte	0
+	.uleb128 0x18
+	.long	.LASF30
+	.byte	0x7
+	.byte	0xd9
+	.long	0x17a
+	.long	0x5bb1
+	.uleb128 0x9
+	.string	"x"
+	.byte	0x7
+	.byte	0xd9
+	.byte	0x32
+	.long	0x48b
+	.uleb128 0xc
+	.string	"w"
+	.byte	0x7
+	.byte	0xda
+	.byte	0x9
+	.long	0x17a
+	.byte	0
+	.uleb128 0x2d
+	.long	.LASF32
+	.byte	0x7
+	.byte	0xd4
+	.byte	0x13
+	.long	0x17a
+	.byte	0x3
+	.uleb128 0x9
+	.string	"x"
+	.byte	0x7
+	.byte	0xd4
+	.byte	0x1f
+	.long	0x17a
+	.uleb128 0x2e
+	.long	.LASF33
+	.byte	0x7
+	.byte	0xd5
+	.byte	0xf
+	.long	0x4f
+	.byte	0
+	.byte	0
+	.section	.debug_abbrev,"",@progbits
+.Ldebug_abbrev0:
+	.uleb128 0x1
+	.uleb128 0x5
+	.byte	0
+	.uleb128 0x31
+	.uleb128 0x13
+	.uleb128 0x2
+	.uleb128 0x17
+	.uleb128 0x2137
+	.uleb128 0x17
+	.byte	0
+	.byte	0
+	.uleb128 0x2
+	.uleb128 0x5
+	.byte	0
+	.uleb128 0x31
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x1d
+	.byte	0x1
+	.uleb128 0x31
+	.uleb128 0x13
+	.uleb128 0x52
+	.uleb128 0x1
+	.uleb128 0x2138
+	.uleb128 0x5
+	.uleb128 0x11
+	.uleb128 0x1
+	.uleb128 0x12
+	.uleb128 0x7
+	.uleb128 0x58
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x59
+	.uleb128 0xb
+	.uleb128 0x57
+	.uleb128 0x5
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x4
+	.uleb128 0x1d
+	.byte	0x1
+	.uleb128 0x31
+	.uleb128 0x13
+	.uleb128 0x52
+	.uleb128 0x1
+	.uleb128 0x2138
+	.uleb128 0x5
+	.uleb128 0x11
+	.uleb128 0x1
+	.uleb128 0x12
+	.uleb128 0x7
+	.uleb128 0x58
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x59
+	.uleb128 0xb
+	.uleb128 0x57
+	.uleb128 0xb
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x5
+	.uleb128 0x1d
+	.byte	0x1
+	.uleb128 0x31
+	.uleb128 0x13
+	.uleb128 0x52
+	.uleb128 0x1
+	.uleb128 0x2138
+	.uleb128 0x5
+	.uleb128 0x55
+	.uleb128 0x17
+	.uleb128 0x58
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x59
+	.uleb128 0xb
+	.uleb128 0x57
+	.uleb128 0x5
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x6
+	.uleb128 0x24
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x3e
+	.uleb128 0xb
+	.uleb128 0x3
+	.uleb128 0xe
+	.byte	0
+	.byte	0
+	.uleb128 0x7
+	.uleb128 0x21
+	.byte	0
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x2f
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x8
+	.uleb128 0x1
+	.byte	0x1
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x9
+	.uleb128 0x5
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x8
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0xa
+	.uleb128 0x26
+	.byte	0
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0x16
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0xc
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x8
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0xd
+	.uleb128 0x5
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x8
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x2
+	.uleb128 0x17
+	.uleb128 0x2137
+	.uleb128 0x17
+	.byte	0
+	.byte	0
+	.uleb128 0xe
+	.uleb128 0xf
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0x21
+	.sleb128 8
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0xf
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x31
+	.uleb128 0x13
+	.uleb128 0x2
+	.uleb128 0x17
+	.uleb128 0x2137
+	.uleb128 0x17
+	.byte	0
+	.byte	0
+	.uleb128 0x10
+	.uleb128 0xd
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x8
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 6
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x38
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x11
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x8
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x2
+	.uleb128 0x17
+	.uleb128 0x2137
+	.uleb128 0x17
+	.byte	0
+	.byte	0
+	.uleb128 0x12
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x31
+	.uleb128 0x13
+	.uleb128 0x2
+	.uleb128 0x18
+	.byte	0
+	.byte	0
+	.uleb128 0x13
+	.uleb128 0xb
+	.byte	0x1
+	.uleb128 0x31
+	.uleb128 0x13
+	.uleb128 0x55
+	.uleb128 0x17
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x14
+	.uleb128 0x49
+	.byte	0
+	.uleb128 0x2
+	.uleb128 0x18
+	.uleb128 0x7e
+	.uleb128 0x18
+	.byte	0
+	.byte	0
+	.uleb128 0x15
+	.uleb128 0xd
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 6
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 14
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x38
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x16
+	.uleb128 0x16
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x8
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x17
+	.uleb128 0x1d
+	.byte	0x1
+	.uleb128 0x31
+	.uleb128 0x13
+	.uleb128 0x52
+	.uleb128 0x1
+	.uleb128 0x2138
+	.uleb128 0x5
+	.uleb128 0x55
+	.uleb128 0x17
+	.uleb128 0x58
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x59
+	.uleb128 0xb
+	.uleb128 0x57
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x18
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 19
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x20
+	.uleb128 0x21
+	.sleb128 3
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x19
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 7
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x1c
+	.uleb128 0xa
+	.byte	0
+	.byte	0
+	.uleb128 0x1a
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 6
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x11
+	.uleb128 0x1
+	.uleb128 0x12
+	.uleb128 0x7
+	.uleb128 0x40
+	.uleb128 0x18
+	.uleb128 0x7a
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x1b
+	.uleb128 0xb
+	.byte	0x1
+	.uleb128 0x55
+	.uleb128 0x17
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x1c
+	.uleb128 0xb
+	.byte	0x1
+	.uleb128 0x55
+	.uleb128 0x17
+	.byte	0
+	.byte	0
+	.uleb128 0x1d
+	.uleb128 0xb
+	.byte	0x1
+	.uleb128 0x31
+	.uleb128 0x13
+	.uleb128 0x11
+	.uleb128 0x1
+	.uleb128 0x12
+	.uleb128 0x7
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x1e
+	.uleb128 0x48
+	.byte	0x1
+	.uleb128 0x7d
+	.uleb128 0x1
+	.uleb128 0x7f
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x1f
+	.uleb128 0xb
+	.byte	0x1
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x20
+	.uleb128 0x11
+	.byte	0x1
+	.uleb128 0x25
+	.uleb128 0xe
+	.uleb128 0x13
+	.uleb128 0xb
+	.uleb128 0x3
+	.uleb128 0x1f
+	.uleb128 0x1b
+	.uleb128 0x1f
+	.uleb128 0x11
+	.uleb128 0x1
+	.uleb128 0x12
+	.uleb128 0x7
+	.uleb128 0x10
+	.uleb128 0x17
+	.byte	0
+	.byte	0
+	.uleb128 0x21
+	.uleb128 0x24
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x3e
+	.uleb128 0xb
+	.uleb128 0x3
+	.uleb128 0x8
+	.byte	0
+	.byte	0
+	.uleb128 0x22
+	.uleb128 0x26
+	.byte	0
+	.byte	0
+	.byte	0
+	.uleb128 0x23
+	.uleb128 0x13
+	.byte	0x1
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0xb
+	.uleb128 0x5
+	.uleb128 0x88
+	.uleb128 0xb
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x24
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x2
+	.uleb128 0x18
+	.byte	0
+	.byte	0
+	.uleb128 0x25
+	.uleb128 0x5
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x2
+	.uleb128 0x17
+	.uleb128 0x2137
+	.uleb128 0x17
+	.byte	0
+	.byte	0
+	.uleb128 0x26
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x8
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x2
+	.uleb128 0x18
+	.byte	0
+	.byte	0
+	.uleb128 0x27
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x31
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x28
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x20
+	.uleb128 0xb
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x29
+	.uleb128 0xb
+	.byte	0x1
+	.byte	0
+	.byte	0
+	.uleb128 0x2a
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x11
+	.uleb128 0x1
+	.uleb128 0x12
+	.uleb128 0x7
+	.uleb128 0x40
+	.uleb128 0x18
+	.uleb128 0x7a
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x2b
+	.uleb128 0x1d
+	.byte	0x1
+	.uleb128 0x31
+	.uleb128 0x13
+	.uleb128 0x52
+	.uleb128 0x1
+	.uleb128 0x2138
+	.uleb128 0x5
+	.uleb128 0x55
+	.uleb128 0x17
+	.uleb128 0x58
+	.uleb128 0xb
+	.uleb128 0x59
+	.uleb128 0xb
+	.uleb128 0x57
+	.uleb128 0xb
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x2c
+	.uleb128 0x1d
+	.byte	0x1
+	.uleb128 0x31
+	.uleb128 0x13
+	.uleb128 0x52
+	.uleb128 0x1
+	.uleb128 0x2138
+	.uleb128 0x5
+	.uleb128 0x55
+	.uleb128 0x17
+	.uleb128 0x58
+	.uleb128 0xb
+	.uleb128 0x59
+	.uleb128 0xb
+	.uleb128 0x57
+	.uleb128 0x5
+	.byte	0
+	.byte	0
+	.uleb128 0x2d
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x20
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x2e
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.byte	0
+	.section	.debug_loclists,"",@progbits
+	.long	.Ldebug_loc3-.Ldebug_loc2
+.Ldebug_loc2:
+	.value	0x5
+	.byte	0x8
+	.byte	0
+	.long	0
+.Ldebug_loc0:
+.LVUS459:
+	.uleb128 0
+	.uleb128 .LVU4273
+	.uleb128 .LVU4273
+	.uleb128 .LVU4487
+	.uleb128 .LVU4487
+	.uleb128 0
+.LLST459:
+	.byte	0x4
+	.uleb128 .LVL752-.Ltext0
+	.uleb128 .LVL756-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL756-.Ltext0
+	.uleb128 .LVL767-.Ltext0
+	.uleb128 0x1
+	.byte	0x56
+	.byte	0x4
+	.uleb128 .LVL767-.Ltext0
+	.uleb128 .LFE29-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x9f
+	.byte	0
+.LVUS460:
+	.uleb128 0
+	.uleb128 .LVU4273
+	.uleb128 .LVU4273
+	.uleb128 0
+.LLST460:
+	.byte	0x4
+	.uleb128 .LVL752-.Ltext0
+	.uleb128 .LVL756-.Ltext0
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x4
+	.uleb128 .LVL756-.Ltext0
+	.uleb128 .LFE29-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x9f
+	.byte	0
+.LVUS461:
+	.uleb128 0
+	.uleb128 .LVU4273
+	.uleb128 .LVU4273
+	.uleb128 .LVU4476
+	.uleb128 .LVU4476
+	.uleb128 .LVU4477
+	.uleb128 .LVU4477
+	.uleb128 .LVU4479
+.LLST461:
+	.byte	0x4
+	.uleb128 .LVL752-.Ltext0
+	.uleb128 .LVL756-.Ltext0
+	.uleb128 0x1
+	.byte	0x51
+	.byte	0x4
+	.uleb128 .LVL756-.Ltext0
+	.uleb128 .LVL763-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0x4
+	.uleb128 .LVL763-.Ltext0
+	.uleb128 .LVL764-.Ltext0
+	.uleb128 0x3
+	.byte	0x73
+	.sleb128 -1
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL764-.Ltext0
+	.uleb128 .LVL765-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0
+.LVUS462:
+	.uleb128 .LVU4253
+	.uleb128 .LVU4273
+	.uleb128 .LVU4273
+	.uleb128 .LVU4282
+	.uleb128 .LVU4282
+	.uleb128 .LVU4476
+	.uleb128 .LVU4476
+	.uleb128 .LVU4479
+.LLST462:
+	.byte	0x4
+	.uleb128 .LVL753-.Ltext0
+	.uleb128 .LVL756-.Ltext0
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x4
+	.uleb128 .LVL756-.Ltext0
+	.uleb128 .LVL757-.Ltext0
+	.uleb128 0x1
+	.byte	0x5c
+	.byte	0x4
+	.uleb128 .LVL757-.Ltext0
+	.uleb128 .LVL763-.Ltext0
+	.uleb128 0x4
+	.byte	0x7c
+	.sleb128 -128
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL763-.Ltext0
+	.uleb128 .LVL765-.Ltext0
+	.uleb128 0x1
+	.byte	0x5c
+	.byte	0
+.LVUS463:
+	.uleb128 .LVU4267
+	.uleb128 .LVU4268
+	.uleb128 .LVU4268
+	.uleb128 .LVU4273
+	.uleb128 .LVU4273
+	.uleb128 .LVU4275
+	.uleb128 .LVU4275
+	.uleb128 .LVU4284
+	.uleb128 .LVU4284
+	.uleb128 .LVU4388
+	.uleb128 .LVU4388
+	.uleb128 .LVU4479
+.LLST463:
+	.byte	0x4
+	.uleb128 .LVL755-.Ltext0
+	.uleb128 .LVL755-.Ltext0
+	.uleb128 0x7
+	.byte	0x75
+	.sleb128 192
+	.byte	0x93
+	.uleb128 0x8
+	.byte	0x93
+	.uleb128 0x8
+	.byte	0x4
+	.uleb128 .LVL755-.Ltext0
+	.uleb128 .LVL756-.Ltext0
+	.uleb128 0xa
+	.byte	0x75
+	.sleb128 192
+	.byte	0x93
+	.uleb128 0x8
+	.byte	0x75
+	.sleb128 200
+	.byte	0x93
+	.uleb128 0x8
+	.byte	0x4
+	.uleb128 .LVL756-.Ltext0
+	.uleb128 .LVL756-.Ltext0
+	.uleb128 0x9
+	.byte	0x7f
+	.sleb128 -128
+	.byte	0x9f
+	.byte	0x93
+	.uleb128 0x8
+	.byte	0x5e
+	.byte	0x93
+	.uleb128 0x8
+	.byte	0x4
+	.uleb128 .LVL756-.Ltext0
+	.uleb128 .LVL758-.Ltext0
+	.uleb128 0x6
+	.byte	0x5f
+	.byte	0x93
+	.uleb128 0x8
+	.byte	0x5e
+	.byte	0x93
+	.uleb128 0x8
+	.byte	0x4
+	.uleb128 .LVL758-.Ltext0
+	.uleb128 .LVL759-.Ltext0
+	.uleb128 0x6
+	.byte	0x5f
+	.byte	0x93
+	.uleb128 0x8
+	.byte	0x5e
+	.byte	0x93
+	.uleb128 0x8
+	.byte	0x4
+	.uleb128 .LVL759-.Ltext0
+	.uleb128 .LVL765-.Ltext0
+	.uleb128 0x9
+	.byte	0x7f
+	.sleb128 -128
+	.byte	0x9f
+	.byte	0x93
+	.uleb128 0x8
+	.byte	0x5e
+	.byte	0x93
+	.uleb128 0x8
+	.byte	0
+.LVUS465:
+	.uleb128 .LVU4256
+	.uleb128 .LVU4265
+.LLST465:
+	.byte	0x4
+	.uleb128 .LVL753-.Ltext0
+	.uleb128 .LVL754-.Ltext0
+	.uleb128 0x2
+	.byte	0x30
+	.byte	0x9f
+	.byte	0
+.LVUS477:
+	.uleb128 .LVU4479
+	.uleb128 .LVU4483
+.LLST477:
+	.byte	0x4
+	.uleb128 .LVL765-.Ltext0
+	.uleb128 .LVL766-.Ltext0
+	.uleb128 0x2
+	.byte	0x30
+	.byte	0x9f
+	.byte	0
+.LVUS467:
+	.uleb128 .LVU4285
+	.uleb128 .LVU4474
+.LLST467:
+	.byte	0x4
+	.uleb128 .LVL758-.Ltext0
+	.uleb128 .LVL763-.Ltext0
+	.uleb128 0x6
+	.byte	0xa0
+	.long	.Ldebug_info0+858
+	.sleb128 0
+	.byte	0
+.LVUS468:
+	.uleb128 .LVU4285
+	.uleb128 .LVU4474
+.LLST468:
+	.byte	0x4
+	.uleb128 .LVL758-.Ltext0
+	.uleb128 .LVL763-.Ltext0
+	.uleb128 0x6
+	.byte	0xa0
+	.long	.Ldebug_info0+841
+	.sleb128 0
+	.byte	0
+.LVUS469:
+	.uleb128 .LVU4285
+	.uleb128 .LVU4474
+.LLST469:
+	.byte	0x4
+	.uleb128 .LVL758-.Ltext0
+	.uleb128 .LVL763-.Ltext0
+	.uleb128 0x4
+	.byte	0x91
+	.sleb128 -384
+	.byte	0x9f
+	.byte	0
+.LVUS471:
+	.uleb128 .LVU4290
+	.uleb128 .LVU4296
+	.uleb128 .LVU4296
+	.uleb128 .LVU4302
+	.uleb128 .LVU4302
+	.uleb128 .LVU4308
+	.uleb128 .LVU4308
+	.uleb128 .LVU4314
+	.uleb128 .LVU4314
+	.uleb128 .LVU4320
+	.uleb128 .LVU4320
+	.uleb128 .LVU4326
+	.uleb128 .LVU4326
+	.uleb128 .LVU4332
+	.uleb128 .LVU4332
+	.uleb128 .LVU4338
+	.uleb128 .LVU4338
+	.uleb128 .LVU4344
+	.uleb128 .LVU4344
+	.uleb128 .LVU4350
+	.uleb128 .LVU4350
+	.uleb128 .LVU4356
+	.uleb128 .LVU4356
+	.uleb128 .LVU4362
+	.uleb128 .LVU4362
+	.uleb128 .LVU4368
+	.uleb128 .LVU4368
+	.uleb128 .LVU4374
+	.uleb128 .LVU4374
+	.uleb128 .LVU4380
+	.uleb128 .LVU4380
+	.uleb128 .LVU4404
+	.uleb128 .LVU4404
+	.uleb128 .LVU4474
+.LLST471:
+	.byte	0x4
+	.uleb128 .LVL758-.Ltext0
+	.uleb128 .LVL758-.Ltext0
+	.uleb128 0x2
+	.byte	0x30
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL758-.Ltext0
+	.uleb128 .LVL758-.Ltext0
+	.uleb128 0x2
+	.byte	0x31
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL758-.Ltext0
+	.uleb128 .LVL758-.Ltext0
+	.uleb128 0x2
+	.byte	0x32
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL758-.Ltext0
+	.uleb128 .LVL758-.Ltext0
+	.uleb128 0x2
+	.byte	0x33
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL758-.Ltext0
+	.uleb128 .LVL758-.Ltext0
+	.uleb128 0x2
+	.byte	0x34
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL758-.Ltext0
+	.uleb128 .LVL758-.Ltext0
+	.uleb128 0x2
+	.byte	0x35
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL758-.Ltext0
+	.uleb128 .LVL758-.Ltext0
+	.uleb128 0x2
+	.byte	0x36
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL758-.Ltext0
+	.uleb128 .LVL758-.Ltext0
+	.uleb128 0x2
+	.byte	0x37
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL758-.Ltext0
+	.uleb128 .LVL758-.Ltext0
+	.uleb128 0x2
+	.byte	0x38
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL758-.Ltext0
+	.uleb128 .LVL758-.Ltext0
+	.uleb128 0x2
+	.byte	0x39
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL758-.Ltext0
+	.uleb128 .LVL758-.Ltext0
+	.uleb128 0x2
+	.byte	0x3a
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL758-.Ltext0
+	.uleb128 .LVL758-.Ltext0
+	.uleb128 0x2
+	.byte	0x3b
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL758-.Ltext0
+	.uleb128 .LVL758-.Ltext0
+	.uleb128 0x2
+	.byte	0x3c
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL758-.Ltext0
+	.uleb128 .LVL758-.Ltext0
+	.uleb128 0x2
+	.byte	0x3d
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL758-.Ltext0
+	.uleb128 .LVL758-.Ltext0
+	.uleb128 0x2
+	.byte	0x3e
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL758-.Ltext0
+	.uleb128 .LVL760-.Ltext0
+	.uleb128 0x2
+	.byte	0x3f
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL760-.Ltext0
+	.uleb128 .LVL763-.Ltext0
+	.uleb128 0x2
+	.byte	0x40
+	.byte	0x9f
+	.byte	0
+.LVUS474:
+	.uleb128 .LVU4405
+	.uleb128 .LVU4410
+	.uleb128 .LVU4410
+	.uleb128 .LVU4414
+	.uleb128 .LVU4414
+	.uleb128 .LVU4418
+	.uleb128 .LVU4418
+	.uleb128 .LVU4422
+	.uleb128 .LVU4422
+	.uleb128 .LVU4426
+	.uleb128 .LVU4426
+	.uleb128 .LVU4430
+	.uleb128 .LVU4430
+	.uleb128 .LVU4434
+	.uleb128 .LVU4434
+	.uleb128 .LVU4438
+	.uleb128 .LVU4438
+	.uleb128 .LVU4474
+.LLST474:
+	.byte	0x4
+	.uleb128 .LVL760-.Ltext0
+	.uleb128 .LVL760-.Ltext0
+	.uleb128 0x2
+	.byte	0x30
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL760-.Ltext0
+	.uleb128 .LVL760-.Ltext0
+	.uleb128 0x2
+	.byte	0x31
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL760-.Ltext0
+	.uleb128 .LVL760-.Ltext0
+	.uleb128 0x2
+	.byte	0x32
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL760-.Ltext0
+	.uleb128 .LVL760-.Ltext0
+	.uleb128 0x2
+	.byte	0x33
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL760-.Ltext0
+	.uleb128 .LVL760-.Ltext0
+	.uleb128 0x2
+	.byte	0x34
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL760-.Ltext0
+	.uleb128 .LVL760-.Ltext0
+	.uleb128 0x2
+	.byte	0x35
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL760-.Ltext0
+	.uleb128 .LVL760-.Ltext0
+	.uleb128 0x2
+	.byte	0x36
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL760-.Ltext0
+	.uleb128 .LVL760-.Ltext0
+	.uleb128 0x2
+	.byte	0x37
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL760-.Ltext0
+	.uleb128 .LVL763-.Ltext0
+	.uleb128 0x2
+	.byte	0x38
+	.byte	0x9f
+	.byte	0
+.LVUS475:
+	.uleb128 .LVU4447
+	.uleb128 .LVU4451
+	.uleb128 .LVU4451
+	.uleb128 .LVU4454
+	.uleb128 .LVU4454
+	.uleb128 .LVU4457
+	.uleb128 .LVU4457
+	.uleb128 .LVU4460
+	.uleb128 .LVU4460
+	.uleb128 .LVU4463
+	.uleb128 .LVU4463
+	.uleb128 .LVU4466
+	.uleb128 .LVU4466
+	.uleb128 .LVU4469
+	.uleb128 .LVU4469
+	.uleb128 .LVU4473
+	.uleb128 .LVU4473
+	.uleb128 .LVU4474
+.LLST475:
+	.byte	0x4
+	.uleb128 .LVL761-.Ltext0
+	.uleb128 .LVL762-.Ltext0
+	.uleb128 0x2
+	.byte	0x30
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL762-.Ltext0
+	.uleb128 .LVL762-.Ltext0
+	.uleb128 0x2
+	.byte	0x31
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL762-.Ltext0
+	.uleb128 .LVL762-.Ltext0
+	.uleb128 0x2
+	.byte	0x32
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL762-.Ltext0
+	.uleb128 .LVL762-.Ltext0
+	.uleb128 0x2
+	.byte	0x33
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL762-.Ltext0
+	.uleb128 .LVL762-.Ltext0
+	.uleb128 0x2
+	.byte	0x34
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL762-.Ltext0
+	.uleb128 .LVL762-.Ltext0
+	.uleb128 0x2
+	.byte	0x35
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL762-.Ltext0
+	.uleb128 .LVL762-.Ltext0
+	.uleb128 0x2
+	.byte	0x36
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL762-.Ltext0
+	.uleb128 .LVL763-.Ltext0
+	.uleb128 0x2
+	.byte	0x37
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL763-.Ltext0
+	.uleb128 .LVL763-.Ltext0
+	.uleb128 0x2
+	.byte	0x38
+	.byte	0x9f
+	.byte	0
+.LVUS448:
+	.uleb128 0
+	.uleb128 .LVU4196
+	.uleb128 .LVU4196
+	.uleb128 .LVU4249
+	.uleb128 .LVU4249
+	.uleb128 0
+.LLST448:
+	.byte	0x4
+	.uleb128 .LVL745-.Ltext0
+	.uleb128 .LVL747-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL747-.Ltext0
+	.uleb128 .LVL751-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0x4
+	.uleb128 .LVL751-.Ltext0
+	.uleb128 .LFE28-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x9f
+	.byte	0
+.LVUS449:
+	.uleb128 0
+	.uleb128 .LVU4199
+	.uleb128 .LVU4199
+	.uleb128 0
+.LLST449:
+	.byte	0x4
+	.uleb128 .LVL745-.Ltext0
+	.uleb128 .LVL748-.Ltext0
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x4
+	.uleb128 .LVL748-.Ltext0
+	.uleb128 .LFE28-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x9f
+	.byte	0
+.LVUS451:
+	.uleb128 .LVU4186
+	.uleb128 .LVU4199
+	.uleb128 .LVU4199
+	.uleb128 .LVU4247
+.LLST451:
+	.byte	0x4
+	.uleb128 .LVL746-.Ltext0
+	.uleb128 .LVL748-.Ltext0
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x4
+	.uleb128 .LVL748-.Ltext0
+	.uleb128 .LVL750-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x9f
+	.byte	0
+.LVUS452:
+	.uleb128 .LVU4186
+	.uleb128 .LVU4196
+	.uleb128 .LVU4196
+	.uleb128 .LVU4247
+.LLST452:
+	.byte	0x4
+	.uleb128 .LVL746-.Ltext0
+	.uleb128 .LVL747-.Ltext0
+	.uleb128 0x4
+	.byte	0x75
+	.sleb128 208
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL747-.Ltext0
+	.uleb128 .LVL750-.Ltext0
+	.uleb128 0x4
+	.byte	0x73
+	.sleb128 208
+	.byte	0x9f
+	.byte	0
+.LVUS453:
+	.uleb128 .LVU4186
+	.uleb128 .LVU4196
+	.uleb128 .LVU4196
+	.uleb128 .LVU4247
+.LLST453:
+	.byte	0x4
+	.uleb128 .LVL746-.Ltext0
+	.uleb128 .LVL747-.Ltext0
+	.uleb128 0x4
+	.byte	0x75
+	.sleb128 192
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL747-.Ltext0
+	.uleb128 .LVL750-.Ltext0
+	.uleb128 0x4
+	.byte	0x73
+	.sleb128 192
+	.byte	0x9f
+	.byte	0
+.LVUS454:
+	.uleb128 .LVU4186
+	.uleb128 .LVU4196
+	.uleb128 .LVU4196
+	.uleb128 .LVU4247
+.LLST454:
+	.byte	0x4
+	.uleb128 .LVL746-.Ltext0
+	.uleb128 .LVL747-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL747-.Ltext0
+	.uleb128 .LVL750-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0
+.LVUS456:
+	.uleb128 .LVU4191
+	.uleb128 .LVU4192
+.LLST456:
+	.byte	0x4
+	.uleb128 .LVL746-.Ltext0
+	.uleb128 .LVL746-.Ltext0
+	.uleb128 0x2
+	.byte	0x30
+	.byte	0x9f
+	.byte	0
+.LVUS458:
+	.uleb128 .LVU4225
+	.uleb128 .LVU4226
+.LLST458:
+	.byte	0x4
+	.uleb128 .LVL749-.Ltext0
+	.uleb128 .LVL749-.Ltext0
+	.uleb128 0x2
+	.byte	0x30
+	.byte	0x9f
+	.byte	0
+.LVUS0:
+	.uleb128 0
+	.uleb128 .LVU11
+	.uleb128 .LVU11
+	.uleb128 0
+.LLST0:
+	.byte	0x4
+	.uleb128 .LVL0-.Ltext0
+	.uleb128 .LVL2-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL2-.Ltext0
+	.uleb128 .LFE26-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0
+.LVUS1:
+	.uleb128 0
+	.uleb128 .LVU32
+	.uleb128 .LVU32
+	.uleb128 0
+.LLST1:
+	.byte	0x4
+	.uleb128 .LVL0-.Ltext0
+	.uleb128 .LVL7-.Ltext0
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x4
+	.uleb128 .LVL7-.Ltext0
+	.uleb128 .LFE26-.Ltext0
+	.uleb128 0x1
+	.byte	0x59
+	.byte	0
+.LVUS3:
+	.uleb128 .LVU8
+	.uleb128 .LVU11
+	.uleb128 .LVU11
+	.uleb128 .LVU14
+	.uleb128 .LVU14
+	.uleb128 .LVU17
+.LLST3:
+	.byte	0x4
+	.uleb128 .LVL1-.Ltext0
+	.uleb128 .LVL2-.Ltext0
+	.uleb128 0x8
+	.byte	0x75
+	.sleb128 96
+	.byte	0x6
+	.byte	0x78
+	.sleb128 0
+	.byte	0x27
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL2-.Ltext0
+	.uleb128 .LVL3-.Ltext0
+	.uleb128 0x6
+	.byte	0x75
+	.sleb128 0
+	.byte	0x78
+	.sleb128 0
+	.byte	0x27
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL3-.Ltext0
+	.uleb128 .LVL4-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0
+.LVUS4:
+	.uleb128 .LVU8
+	.uleb128 .LVU17
+.LLST4:
+	.byte	0x4
+	.uleb128 .LVL1-.Ltext0
+	.uleb128 .LVL4-.Ltext0
+	.uleb128 0x3
+	.byte	0x8
+	.byte	0x20
+	.byte	0x9f
+	.byte	0
+.LVUS5:
+	.uleb128 .LVU24
+	.uleb128 .LVU27
+.LLST5:
+	.byte	0x4
+	.uleb128 .LVL5-.Ltext0
+	.uleb128 .LVL6-.Ltext0
+	.uleb128 0x2
+	.byte	0x48
+	.byte	0x9f
+	.byte	0
+.LVUS6:
+	.uleb128 .LVU35
+	.uleb128 .LVU38
+.LLST6:
+	.byte	0x4
+	.uleb128 .LVL8-.Ltext0
+	.uleb128 .LVL9-.Ltext0
+	.uleb128 0x2
+	.byte	0x40
+	.byte	0x9f
+	.byte	0
+.LVUS7:
+	.uleb128 .LVU46
+	.uleb128 .LVU48
+.LLST7:
+	.byte	0x4
+	.uleb128 .LVL10-.Ltext0
+	.uleb128 .LVL10-.Ltext0
+	.uleb128 0x3
+	.byte	0x8
+	.byte	0x3f
+	.byte	0x9f
+	.byte	0
+.LVUS8:
+	.uleb128 .LVU57
+	.uleb128 .LVU60
+.LLST8:
+	.byte	0x4
+	.uleb128 .LVL11-.Ltext0
+	.uleb128 .LVL12-.Ltext0
+	.uleb128 0x1
+	.byte	0x52
+	.byte	0
+.LVUS9:
+	.uleb128 .LVU57
+	.uleb128 .LVU60
+.LLST9:
+	.byte	0x4
+	.uleb128 .LVL11-.Ltext0
+	.uleb128 .LVL12-.Ltext0
+	.uleb128 0x3
+	.byte	0x8
+	.byte	0x20
+	.byte	0x9f
+	.byte	0
+.LVUS10:
+	.uleb128 .LVU68
+	.uleb128 .LVU71
+.LLST10:
+	.byte	0x4
+	.uleb128 .LVL13-.Ltext0
+	.uleb128 .LVL14-.Ltext0
+	.uleb128 0x2
+	.byte	0x48
+	.byte	0x9f
+	.byte	0
+.LVUS11:
+	.uleb128 .LVU78
+	.uleb128 .LVU81
+.LLST11:
+	.byte	0x4
+	.uleb128 .LVL15-.Ltext0
+	.uleb128 .LVL16-.Ltext0
+	.uleb128 0x2
+	.byte	0x40
+	.byte	0x9f
+	.byte	0
+.LVUS12:
+	.uleb128 .LVU91
+	.uleb128 .LVU94
+.LLST12:
+	.byte	0x4
+	.uleb128 .LVL17-.Ltext0
+	.uleb128 .LVL18-.Ltext0
+	.uleb128 0x3
+	.byte	0x8
+	.byte	0x3f
+	.byte	0x9f
+	.byte	0
+.LVUS13:
+	.uleb128 .LVU108
+	.uleb128 .LVU111
+.LLST13:
+	.byte	0x4
+	.uleb128 .LVL19-.Ltext0
+	.uleb128 .LVL20-.Ltext0
+	.uleb128 0x1
+	.byte	0x5a
+	.byte	0
+.LVUS14:
+	.uleb128 .LVU108
+	.uleb128 .LVU111
+.LLST14:
+	.byte	0x4
+	.uleb128 .LVL19-.Ltext0
+	.uleb128 .LVL20-.Ltext0
+	.uleb128 0x3
+	.byte	0x8
+	.byte	0x20
+	.byte	0x9f
+	.byte	0
+.LVUS16:
+	.uleb128 .LVU118
+	.uleb128 .LVU123
+.LLST16:
+	.byte	0x4
+	.uleb128 .LVL21-.Ltext0
+	.uleb128 .LVL22-.Ltext0
+	.uleb128 0x2
+	.byte	0x48
+	.byte	0x9f
+	.byte	0
+.LVUS17:
+	.uleb128 .LVU132
+	.uleb128 .LVU134
+.LLST17:
+	.byte	0x4
+	.uleb128 .LVL23-.Ltext0
+	.uleb128 .LVL23-.Ltext0
+	.uleb128 0x2
+	.byte	0x40
+	.byte	0x9f
+	.byte	0
+.LVUS18:
+	.uleb128 .LVU141
+	.uleb128 .LVU144
+.LLST18:
+	.byte	0x4
+	.uleb128 .LVL24-.Ltext0
+	.uleb128 .LVL25-.Ltext0
+	.uleb128 0x3
+	.byte	0x8
+	.byte	0x3f
+	.byte	0x9f
+	.byte	0
+.LVUS19:
+	.uleb128 .LVU155
+	.uleb128 .LVU158
+.LLST19:
+	.byte	0x4
+	.uleb128 .LVL26-.Ltext0
+	.uleb128 .LVL27-.Ltext0
+	.uleb128 0x1
+	.byte	0x5d
+	.byte	0
+.LVUS20:
+	.uleb128 .LVU155
+	.uleb128 .LVU158
+.LLST20:
+	.byte	0x4
+	.uleb128 .LVL26-.Ltext0
+	.uleb128 .LVL27-.Ltext0
+	.uleb128 0x3
+	.byte	0x8
+	.byte	0x20
+	.byte	0x9f
+	.byte	0
+.LVUS21:
+	.uleb128 .LVU165
+	.uleb128 .LVU168
+.LLST21:
+	.byte	0x4
+	.uleb128 .LVL28-.Ltext0
+	.uleb128 .LVL29-.Ltext0
+	.uleb128 0x2
+	.byte	0x48
+	.byte	0x9f
+	.byte	0
+.LVUS22:
+	.uleb128 .LVU175
+	.uleb128 .LVU178
+.LLST22:
+	.byte	0x4
+	.uleb128 .LVL30-.Ltext0
+	.uleb128 .LVL31-.Ltext0
+	.uleb128 0x2
+	.byte	0x40
+	.byte	0x9f
+	.byte	0
+.LVUS23:
+	.uleb128 .LVU185
+	.uleb128 .LVU188
+.LLST23:
+	.byte	0x4
+	.uleb128 .LVL32-.Ltext0
+	.uleb128 .LVL33-.Ltext0
+	.uleb128 0x3
+	.byte	0x8
+	.byte	0x3f
+	.byte	0x9f
+	.byte	0
+.LVUS24:
+	.uleb128 .LVU197
+	.uleb128 .LVU200
+.LLST24:
+	.byte	0x4
+	.uleb128 .LVL34-.Ltext0
+	.uleb128 .LVL35-.Ltext0
+	.uleb128 0x3
+	.byte	0x8
+	.byte	0x20
+	.byte	0x9f
+	.byte	0
+.LVUS25:
+	.uleb128 .LVU207
+	.uleb128 .LVU210
+.LLST25:
+	.byte	0x4
+	.uleb128 .LVL36-.Ltext0
+	.uleb128 .LVL37-.Ltext0
+	.uleb128 0x2
+	.byte	0x48
+	.byte	0x9f
+	.byte	0
+.LVUS26:
+	.uleb128 .LVU217
+	.uleb128 .LVU219
+.LLST26:
+	.byte	0x4
+	.uleb128 .LVL38-.Ltext0
+	.uleb128 .LVL38-.Ltext0
+	.uleb128 0x2
+	.byte	0x40
+	.byte	0x9f
+	.byte	0
+.LVUS27:
+	.uleb128 .LVU226
+	.uleb128 .LVU229
+.LLST27:
+	.byte	0x4
+	.uleb128 .LVL39-.Ltext0
+	.uleb128 .LVL40-.Ltext0
+	.uleb128 0x3
+	.byte	0x8
+	.byte	0x3f
+	.byte	0x9f
+	.byte	0
+.LVUS28:
+	.uleb128 .LVU240
+	.uleb128 .LVU243
+.LLST28:
+	.byte	0x4
+	.uleb128 .LVL41-.Ltext0
+	.uleb128 .LVL42-.Ltext0
+	.uleb128 0x3
+	.byte	0x8
+	.byte	0x20
+	.byte	0x9f
+	.byte	0
+.LVUS29:
+	.uleb128 .LVU250
+	.uleb128 .LVU253
+.LLST29:
+	.byte	0x4
+	.uleb128 .LVL43-.Ltext0
+	.uleb128 .LVL44-.Ltext0
+	.uleb128 0x2
+	.byte	0x48
+	.byte	0x9f
+	.byte	0
+.LVUS30:
+	.uleb128 .LVU260
+	.uleb128 .LVU263
+.LLST30:
+	.byte	0x4
+	.uleb128 .LVL45-.Ltext0
+	.uleb128 .LVL46-.Ltext0
+	.uleb128 0x2
+	.byte	0x40
+	.byte	0x9f
+	.byte	0
+.LVUS31:
+	.uleb128 .LVU270
+	.uleb128 .LVU273
+.LLST31:
+	.byte	0x4
+	.uleb128 .LVL47-.Ltext0
+	.uleb128 .LVL48-.Ltext0
+	.uleb128 0x3
+	.byte	0x8
+	.byte	0x3f
+	.byte	0x9f
+	.byte	0
+.LVUS32:
+	.uleb128 .LVU283
+	.uleb128 .LVU286
+.LLST32:
+	.byte	0x4
+	.uleb128 .LVL49-.Ltext0
+	.uleb128 .LVL50-.Ltext0
+	.uleb128 0x3
+	.byte	0x8
+	.byte	0x20
+	.byte	0x9f
+	.byte	0
+.LVUS33:
+	.uleb128 .LVU293
+	.uleb128 .LVU296
+.LLST33:
+	.byte	0x4
+	.uleb128 .LVL51-.Ltext0
+	.uleb128 .LVL52-.Ltext0
+	.uleb128 0x2
+	.byte	0x48
+	.byte	0x9f
+	.byte	0
+.LVUS34:
+	.uleb128 .LVU303
+	.uleb128 .LVU306
+.LLST34:
+	.byte	0x4
+	.uleb128 .LVL53-.Ltext0
+	.uleb128 .LVL54-.Ltext0
+	.uleb128 0x2
+	.byte	0x40
+	.byte	0x9f
+	.byte	0
+.LVUS35:
+	.uleb128 .LVU313
+	.uleb128 .LVU316
+.LLST35:
+	.byte	0x4
+	.uleb128 .LVL55-.Ltext0
+	.uleb128 .LVL56-.Ltext0
+	.uleb128 0x3
+	.byte	0x8
+	.byte	0x3f
+	.byte	0x9f
+	.byte	0
+.LVUS36:
+	.uleb128 .LVU328
+	.uleb128 .LVU331
+.LLST36:
+	.byte	0x4
+	.uleb128 .LVL57-.Ltext0
+	.uleb128 .LVL58-.Ltext0
+	.uleb128 0x1
+	.byte	0x5d
+	.byte	0
+.LVUS37:
+	.uleb128 .LVU328
+	.uleb128 .LVU331
+.LLST37:
+	.byte	0x4
+	.uleb128 .LVL57-.Ltext0
+	.uleb128 .LVL58-.Ltext0
+	.uleb128 0x3
+	.byte	0x8
+	.byte	0x20
+	.byte	0x9f
+	.byte	0
+.LVUS38:
+	.uleb128 .LVU338
+	.uleb128 .LVU341
+.LLST38:
+	.byte	0x4
+	.uleb128 .LVL59-.Ltext0
+	.uleb128 .LVL60-.Ltext0
+	.uleb128 0x2
+	.byte	0x48
+	.byte	0x9f
+	.byte	0
+.LVUS39:
+	.uleb128 .LVU348
+	.uleb128 .LVU351
+.LLST39:
+	.byte	0x4
+	.uleb128 .LVL61-.Ltext0
+	.uleb128 .LVL62-.Ltext0
+	.uleb128 0x2
+	.byte	0x40
+	.byte	0x9f
+	.byte	0
+.LVUS40:
+	.uleb128 .LVU358
+	.uleb128 .LVU361
+.LLST40:
+	.byte	0x4
+	.uleb128 .LVL63-.Ltext0
+	.uleb128 .LVL64-.Ltext0
+	.uleb128 0x3
+	.byte	0x8
+	.byte	0x3f
+	.byte	0x9f
+	.byte	0
+.LVUS41:
+	.uleb128 .LVU372
+	.uleb128 .LVU375
+.LLST41:
+	.byte	0x4
+	.uleb128 .LVL65-.Ltext0
+	.uleb128 .LVL66-.Ltext0
+	.uleb128 0x3
+	.byte	0x8
+	.byte	0x20
+	.byte	0x9f
+	.byte	0
+.LVUS42:
+	.uleb128 .LVU382
+	.uleb128 .LVU385
+.LLST42:
+	.byte	0x4
+	.uleb128 .LVL67-.Ltext0
+	.uleb128 .LVL68-.Ltext0
+	.uleb128 0x2
+	.byte	0x48
+	.byte	0x9f
+	.byte	0
+.LVUS43:
+	.uleb128 .LVU392
+	.uleb128 .LVU395
+.LLST43:
+	.byte	0x4
+	.uleb128 .LVL69-.Ltext0
+	.uleb128 .LVL70-.Ltext0
+	.uleb128 0x2
+	.byte	0x40
+	.byte	0x9f
+	.byte	0
+.LVUS44:
+	.uleb128 .LVU402
+	.uleb128 .LVU404
+.LLST44:
+	.byte	0x4
+	.uleb128 .LVL71-.Ltext0
+	.uleb128 .LVL71-.Ltext0
+	.uleb128 0x3
+	.byte	0x8
+	.byte	0x3f
+	.byte	0x9f
+	.byte	0
+.LVUS45:
+	.uleb128 .LVU415
+	.uleb128 .LVU418
+.LLST45:
+	.byte	0x4
+	.uleb128 .LVL72-.Ltext0
+	.uleb128 .LVL73-.Ltext0
+	.uleb128 0x3
+	.byte	0x8
+	.byte	0x20
+	.byte	0x9f
+	.byte	0
+.LVUS46:
+	.uleb128 .LVU425
+	.uleb128 .LVU428
+.LLST46:
+	.byte	0x4
+	.uleb128 .LVL74-.Ltext0
+	.uleb128 .LVL75-.Ltext0
+	.uleb128 0x2
+	.byte	0x48
+	.byte	0x9f
+	.byte	0
+.LVUS47:
+	.uleb128 .LVU435
+	.uleb128 .LVU438
+.LLST47:
+	.byte	0x4
+	.uleb128 .LVL76-.Ltext0
+	.uleb128 .LVL77-.Ltext0
+	.uleb128 0x2
+	.byte	0x40
+	.byte	0x9f
+	.byte	0
+.LVUS49:
+	.uleb128 .LVU446
+	.uleb128 .LVU450
+.LLST49:
+	.byte	0x4
+	.uleb128 .LVL78-.Ltext0
+	.uleb128 .LVL79-.Ltext0
+	.uleb128 0x3
+	.byte	0x8
+	.byte	0x3f
+	.byte	0x9f
+	.byte	0
+.LVUS50:
+	.uleb128 .LVU461
+	.uleb128 .LVU464
+.LLST50:
+	.byte	0x4
+	.uleb128 .LVL80-.Ltext0
+	.uleb128 .LVL81-.Ltext0
+	.uleb128 0x3
+	.byte	0x8
+	.byte	0x20
+	.byte	0x9f
+	.byte	0
+.LVUS51:
+	.uleb128 .LVU471
+	.uleb128 .LVU474
+.LLST51:
+	.byte	0x4
+	.uleb128 .LVL82-.Ltext0
+	.uleb128 .LVL83-.Ltext0
+	.uleb128 0x2
+	.byte	0x48
+	.byte	0x9f
+	.byte	0
+.LVUS52:
+	.uleb128 .LVU481
+	.uleb128 .LVU484
+.LLST52:
+	.byte	0x4
+	.uleb128 .LVL84-.Ltext0
+	.uleb128 .LVL85-.Ltext0
+	.uleb128 0x2
+	.byte	0x40
+	.byte	0x9f
+	.byte	0
+.LVUS53:
+	.uleb128 .LVU491
+	.uleb128 .LVU494
+.LLST53:
+	.byte	0x4
+	.uleb128 .LVL86-.Ltext0
+	.uleb128 .LVL87-.Ltext0
+	.uleb128 0x3
+	.byte	0x8
+	.byte	0x3f
+	.byte	0x9f
+	.byte	0
+.LVUS54:
+	.uleb128 .LVU503
+	.uleb128 .LVU506
+.LLST54:
+	.byte	0x4
+	.uleb128 .LVL88-.Ltext0
+	.uleb128 .LVL89-.Ltext0
+	.uleb128 0x1
+	.byte	0x5c
+	.byte	0
+.LVUS55:
+	.uleb128 .LVU503
+	.uleb128 .LVU506
+.LLST55:
+	.byte	0x4
+	.uleb128 .LVL88-.Ltext0
+	.uleb128 .LVL89-.Ltext0
+	.uleb128 0x3
+	.byte	0x8
+	.byte	0x20
+	.byte	0x9f
+	.byte	0
+.LVUS56:
+	.uleb128 .LVU513
+	.uleb128 .LVU516
+.LLST56:
+	.byte	0x4
+	.uleb128 .LVL90-.Ltext0
+	.uleb128 .LVL91-.Ltext0
+	.uleb128 0x2
+	.byte	0x48
+	.byte	0x9f
+	.byte	0
+.LVUS57:
+	.uleb128 .LVU523
+	.uleb128 .LVU526
+.LLST57:
+	.byte	0x4
+	.uleb128 .LVL92-.Ltext0
+	.uleb128 .LVL93-.Ltext0
+	.uleb128 0x2
+	.byte	0x40
+	.byte	0x9f
+	.byte	0
+.LVUS58:
+	.uleb128 .LVU533
+	.uleb128 .LVU536
+.LLST58:
+	.byte	0x4
+	.uleb128 .LVL94-.Ltext0
+	.uleb128 .LVL95-.Ltext0
+	.uleb128 0x3
+	.byte	0x8
+	.byte	0x3f
+	.byte	0x9f
+	.byte	0
+.LVUS59:
+	.uleb128 .LVU545
+	.uleb128 .LVU548
+.LLST59:
+	.byte	0x4
+	.uleb128 .LVL96-.Ltext0
+	.uleb128 .LVL97-.Ltext0
+	.uleb128 0x3
+	.byte	0x8
+	.byte	0x20
+	.byte	0x9f
+	.byte	0
+.LVUS60:
+	.uleb128 .LVU555
+	.uleb128 .LVU558
+.LLST60:
+	.byte	0x4
+	.uleb128 .LVL98-.Ltext0
+	.uleb128 .LVL99-.Ltext0
+	.uleb128 0x2
+	.byte	0x48
+	.byte	0x9f
+	.byte	0
+.LVUS61:
+	.uleb128 .LVU565
+	.uleb128 .LVU567
+.LLST61:
+	.byte	0x4
+	.uleb128 .LVL100-.Ltext0
+	.uleb128 .LVL100-.Ltext0
+	.uleb128 0x2
+	.byte	0x40
+	.byte	0x9f
+	.byte	0
+.LVUS62:
+	.uleb128 .LVU574
+	.uleb128 .LVU577
+.LLST62:
+	.byte	0x4
+	.uleb128 .LVL101-.Ltext0
+	.uleb128 .LVL102-.Ltext0
+	.uleb128 0x3
+	.byte	0x8
+	.byte	0x3f
+	.byte	0x9f
+	.byte	0
+.LVUS63:
+	.uleb128 .LVU589
+	.uleb128 .LVU592
+.LLST63:
+	.byte	0x4
+	.uleb128 .LVL103-.Ltext0
+	.uleb128 .LVL104-.Ltext0
+	.uleb128 0x3
+	.byte	0x8
+	.byte	0x20
+	.byte	0x9f
+	.byte	0
+.LVUS64:
+	.uleb128 .LVU599
+	.uleb128 .LVU602
+.LLST64:
+	.byte	0x4
+	.uleb128 .LVL105-.Ltext0
+	.uleb128 .LVL106-.Ltext0
+	.uleb128 0x2
+	.byte	0x48
+	.byte	0x9f
+	.byte	0
+.LVUS65:
+	.uleb128 .LVU609
+	.uleb128 .LVU612
+.LLST65:
+	.byte	0x4
+	.uleb128 .LVL107-.Ltext0
+	.uleb128 .LVL108-.Ltext0
+	.uleb128 0x2
+	.byte	0x40
+	.byte	0x9f
+	.byte	0
+.LVUS66:
+	.uleb128 .LVU619
+	.uleb128 .LVU622
+.LLST66:
+	.byte	0x4
+	.uleb128 .LVL109-.Ltext0
+	.uleb128 .LVL110-.Ltext0
+	.uleb128 0x3
+	.byte	0x8
+	.byte	0x3f
+	.byte	0x9f
+	.byte	0
+.LVUS67:
+	.uleb128 .LVU633
+	.uleb128 .LVU636
+.LLST67:
+	.byte	0x4
+	.uleb128 .LVL111-.Ltext0
+	.uleb128 .LVL112-.Ltext0
+	.uleb128 0x3
+	.byte	0x8
+	.byte	0x20
+	.byte	0x9f
+	.byte	0
+.LVUS68:
+	.uleb128 .LVU644
+	.uleb128 .LVU647
+.LLST68:
+	.byte	0x4
+	.uleb128 .LVL113-.Ltext0
+	.uleb128 .LVL114-.Ltext0
+	.uleb128 0x2
+	.byte	0x48
+	.byte	0x9f
+	.byte	0
+.LVUS69:
+	.uleb128 .LVU654
+	.uleb128 .LVU657
+.LLST69:
+	.byte	0x4
+	.uleb128 .LVL115-.Ltext0
+	.uleb128 .LVL116-.Ltext0
+	.uleb128 0x2
+	.byte	0x40
+	.byte	0x9f
+	.byte	0
+.LVUS70:
+	.uleb128 .LVU664
+	.uleb128 .LVU667
+.LLST70:
+	.byte	0x4
+	.uleb128 .LVL117-.Ltext0
+	.uleb128 .LVL118-.Ltext0
+	.uleb128 0x3
+	.byte	0x8
+	.byte	0x3f
+	.byte	0x9f
+	.byte	0
+.LVUS71:
+	.uleb128 .LVU676
+	.uleb128 .LVU679
+.LLST71:
+	.byte	0x4
+	.uleb128 .LVL119-.Ltext0
+	.uleb128 .LVL120-.Ltext0
+	.uleb128 0x3
+	.byte	0x8
+	.byte	0x20
+	.byte	0x9f
+	.byte	0
+.LVUS72:
+	.uleb128 .LVU686
+	.uleb128 .LVU689
+.LLST72:
+	.byte	0x4
+	.uleb128 .LVL121-.Ltext0
+	.uleb128 .LVL122-.Ltext0
+	.uleb128 0x2
+	.byte	0x48
+	.byte	0x9f
+	.byte	0
+.LVUS73:
+	.uleb128 .LVU696
+	.uleb128 .LVU699
+.LLST73:
+	.byte	0x4
+	.uleb128 .LVL123-.Ltext0
+	.uleb128 .LVL124-.Ltext0
+	.uleb128 0x2
+	.byte	0x40
+	.byte	0x9f
+	.byte	0
+.LVUS74:
+	.uleb128 .LVU706
+	.uleb128 .LVU709
+.LLST74:
+	.byte	0x4
+	.uleb128 .LVL125-.Ltext0
+	.uleb128 .LVL126-.Ltext0
+	.uleb128 0x3
+	.byte	0x8
+	.byte	0x3f
+	.byte	0x9f
+	.byte	0
+.LVUS75:
+	.uleb128 .LVU720
+	.uleb128 .LVU723
+.LLST75:
+	.byte	0x4
+	.uleb128 .LVL127-.Ltext0
+	.uleb128 .LVL128-.Ltext0
+	.uleb128 0x3
+	.byte	0x8
+	.byte	0x20
+	.byte	0x9f
+	.byte	0
+.LVUS76:
+	.uleb128 .LVU730
+	.uleb128 .LVU733
+.LLST76:
+	.byte	0x4
+	.uleb128 .LVL129-.Ltext0
+	.uleb128 .LVL130-.Ltext0
+	.uleb128 0x2
+	.byte	0x48
+	.byte	0x9f
+	.byte	0
+.LVUS77:
+	.uleb128 .LVU740
+	.uleb128 .LVU743
+.LLST77:
+	.byte	0x4
+	.uleb128 .LVL131-.Ltext0
+	.uleb128 .LVL132-.Ltext0
+	.uleb128 0x2
+	.byte	0x40
+	.byte	0x9f
+	.byte	0
+.LVUS78:
+	.uleb128 .LVU750
+	.uleb128 .LVU752
+.LLST78:
+	.byte	0x4
+	.uleb128 .LVL133-.Ltext0
+	.uleb128 .LVL133-.Ltext0
+	.uleb128 0x3
+	.byte	0x8
+	.byte	0x3f
+	.byte	0x9f
+	.byte	0
+.LVUS79:
+	.uleb128 .LVU763
+	.uleb128 .LVU766
+.LLST79:
+	.byte	0x4
+	.uleb128 .LVL134-.Ltext0
+	.uleb128 .LVL135-.Ltext0
+	.uleb128 0x3
+	.byte	0x8
+	.byte	0x20
+	.byte	0x9f
+	.byte	0
+.LVUS80:
+	.uleb128 .LVU773
+	.uleb128 .LVU776
+.LLST80:
+	.byte	0x4
+	.uleb128 .LVL136-.Ltext0
+	.uleb128 .LVL137-.Ltext0
+	.uleb128 0x2
+	.byte	0x48
+	.byte	0x9f
+	.byte	0
+.LVUS81:
+	.uleb128 .LVU783
+	.uleb128 .LVU786
+.LLST81:
+	.byte	0x4
+	.uleb128 .LVL138-.Ltext0
+	.uleb128 .LVL139-.Ltext0
+	.uleb128 0x2
+	.byte	0x40
+	.byte	0x9f
+	.byte	0
+.LVUS82:
+	.uleb128 .LVU793
+	.uleb128 .LVU796
+.LLST82:
+	.byte	0x4
+	.uleb128 .LVL140-.Ltext0
+	.uleb128 .LVL141-.Ltext0
+	.uleb128 0x3
+	.byte	0x8
+	.byte	0x3f
+	.byte	0x9f
+	.byte	0
+.LVUS83:
+	.uleb128 .LVU806
+	.uleb128 .LVU809
+.LLST83:
+	.byte	0x4
+	.uleb128 .LVL142-.Ltext0
+	.uleb128 .LVL143-.Ltext0
+	.uleb128 0x3
+	.byte	0x8
+	.byte	0x20
+	.byte	0x9f
+	.byte	0
+.LVUS84:
+	.uleb128 .LVU819
+	.uleb128 .LVU822
+.LLST84:
+	.byte	0x4
+	.uleb128 .LVL144-.Ltext0
+	.uleb128 .LVL145-.Ltext0
+	.uleb128 0x2
+	.byte	0x48
+	.byte	0x9f
+	.byte	0
+.LVUS85:
+	.uleb128 .LVU829
+	.uleb128 .LVU832
+.LLST85:
+	.byte	0x4
+	.uleb128 .LVL146-.Ltext0
+	.uleb128 .LVL147-.Ltext0
+	.uleb128 0x2
+	.byte	0x40
+	.byte	0x9f
+	.byte	0
+.LVUS86:
+	.uleb128 .LVU839
+	.uleb128 .LVU842
+.LLST86:
+	.byte	0x4
+	.uleb128 .LVL148-.Ltext0
+	.uleb128 .LVL149-.Ltext0
+	.uleb128 0x3
+	.byte	0x8
+	.byte	0x3f
+	.byte	0x9f
+	.byte	0
+.LVUS87:
+	.uleb128 .LVU851
+	.uleb128 .LVU854
+.LLST87:
+	.byte	0x4
+	.uleb128 .LVL150-.Ltext0
+	.uleb128 .LVL151-.Ltext0
+	.uleb128 0x1
+	.byte	0x5c
+	.byte	0
+.LVUS88:
+	.uleb128 .LVU851
+	.uleb128 .LVU854
+.LLST88:
+	.byte	0x4
+	.uleb128 .LVL150-.Ltext0
+	.uleb128 .LVL151-.Ltext0
+	.uleb128 0x3
+	.byte	0x8
+	.byte	0x20
+	.byte	0x9f
+	.byte	0
+.LVUS89:
+	.uleb128 .LVU861
+	.uleb128 .LVU864
+.LLST89:
+	.byte	0x4
+	.uleb128 .LVL152-.Ltext0
+	.uleb128 .LVL153-.Ltext0
+	.uleb128 0x2
+	.byte	0x48
+	.byte	0x9f
+	.byte	0
+.LVUS90:
+	.uleb128 .LVU871
+	.uleb128 .LVU874
+.LLST90:
+	.byte	0x4
+	.uleb128 .LVL154-.Ltext0
+	.uleb128 .LVL155-.Ltext0
+	.uleb128 0x2
+	.byte	0x40
+	.byte	0x9f
+	.byte	0
+.LVUS91:
+	.uleb128 .LVU881
+	.uleb128 .LVU884
+.LLST91:
+	.byte	0x4
+	.uleb128 .LVL156-.Ltext0
+	.uleb128 .LVL157-.Ltext0
+	.uleb128 0x3
+	.byte	0x8
+	.byte	0x3f
+	.byte	0x9f
+	.byte	0
+.LVUS92:
+	.uleb128 .LVU893
+	.uleb128 .LVU896
+.LLST92:
+	.byte	0x4
+	.uleb128 .LVL158-.Ltext0
+	.uleb128 .LVL159-.Ltext0
+	.uleb128 0x3
+	.byte	0x8
+	.byte	0x20
+	.byte	0x9f
+	.byte	0
+.LVUS93:
+	.uleb128 .LVU903
+	.uleb128 .LVU906
+.LLST93:
+	.byte	0x4
+	.uleb128 .LVL160-.Ltext0
+	.uleb128 .LVL161-.Ltext0
+	.uleb128 0x2
+	.byte	0x48
+	.byte	0x9f
+	.byte	0
+.LVUS94:
+	.uleb128 .LVU913
+	.uleb128 .LVU915
+.LLST94:
+	.byte	0x4
+	.uleb128 .LVL162-.Ltext0
+	.uleb128 .LVL162-.Ltext0
+	.uleb128 0x2
+	.byte	0x40
+	.byte	0x9f
+	.byte	0
+.LVUS96:
+	.uleb128 .LVU923
+	.uleb128 .LVU925
+.LLST96:
+	.byte	0x4
+	.uleb128 .LVL163-.Ltext0
+	.uleb128 .LVL163-.Ltext0
+	.uleb128 0x3
+	.byte	0x8
+	.byte	0x3f
+	.byte	0x9f
+	.byte	0
+.LVUS97:
+	.uleb128 .LVU935
+	.uleb128 .LVU938
+.LLST97:
+	.byte	0x4
+	.uleb128 .LVL164-.Ltext0
+	.uleb128 .LVL165-.Ltext0
+	.uleb128 0x3
+	.byte	0x8
+	.byte	0x20
+	.byte	0x9f
+	.byte	0
+.LVUS98:
+	.uleb128 .LVU945
+	.uleb128 .LVU948
+.LLST98:
+	.byte	0x4
+	.uleb128 .LVL166-.Ltext0
+	.uleb128 .LVL167-.Ltext0
+	.uleb128 0x2
+	.byte	0x48
+	.byte	0x9f
+	.byte	0
+.LVUS99:
+	.uleb128 .LVU955
+	.uleb128 .LVU958
+.LLST99:
+	.byte	0x4
+	.uleb128 .LVL168-.Ltext0
+	.uleb128 .LVL169-.Ltext0
+	.uleb128 0x2
+	.byte	0x40
+	.byte	0x9f
+	.byte	0
+.LVUS100:
+	.uleb128 .LVU965
+	.uleb128 .LVU968
+.LLST100:
+	.byte	0x4
+	.uleb128 .LVL170-.Ltext0
+	.uleb128 .LVL171-.Ltext0
+	.uleb128 0x3
+	.byte	0x8
+	.byte	0x3f
+	.byte	0x9f
+	.byte	0
+.LVUS101:
+	.uleb128 .LVU979
+	.uleb128 .LVU982
+.LLST101:
+	.byte	0x4
+	.uleb128 .LVL172-.Ltext0
+	.uleb128 .LVL173-.Ltext0
+	.uleb128 0x3
+	.byte	0x8
+	.byte	0x20
+	.byte	0x9f
+	.byte	0
+.LVUS102:
+	.uleb128 .LVU990
+	.uleb128 .LVU993
+.LLST102:
+	.byte	0x4
+	.uleb128 .LVL174-.Ltext0
+	.uleb128 .LVL175-.Ltext0
+	.uleb128 0x2
+	.byte	0x48
+	.byte	0x9f
+	.byte	0
+.LVUS103:
+	.uleb128 .LVU1000
+	.uleb128 .LVU1003
+.LLST103:
+	.byte	0x4
+	.uleb128 .LVL176-.Ltext0
+	.uleb128 .LVL177-.Ltext0
+	.uleb128 0x2
+	.byte	0x40
+	.byte	0x9f
+	.byte	0
+.LVUS104:
+	.uleb128 .LVU1010
+	.uleb128 .LVU1013
+.LLST104:
+	.byte	0x4
+	.uleb128 .LVL178-.Ltext0
+	.uleb128 .LVL179-.Ltext0
+	.uleb128 0x3
+	.byte	0x8
+	.byte	0x3f
+	.byte	0x9f
+	.byte	0
+.LVUS105:
+	.uleb128 .LVU1022
+	.uleb128 .LVU1025
+.LLST105:
+	.byte	0x4
+	.uleb128 .LVL180-.Ltext0
+	.uleb128 .LVL181-.Ltext0
+	.uleb128 0x3
+	.byte	0x8
+	.byte	0x20
+	.byte	0x9f
+	.byte	0
+.LVUS106:
+	.uleb128 .LVU1032
+	.uleb128 .LVU1035
+.LLST106:
+	.byte	0x4
+	.uleb128 .LVL182-.Ltext0
+	.uleb128 .LVL183-.Ltext0
+	.uleb128 0x2
+	.byte	0x48
+	.byte	0x9f
+	.byte	0
+.LVUS107:
+	.uleb128 .LVU1042
+	.uleb128 .LVU1045
+.LLST107:
+	.byte	0x4
+	.uleb128 .LVL184-.Ltext0
+	.uleb128 .LVL185-.Ltext0
+	.uleb128 0x2
+	.byte	0x40
+	.byte	0x9f
+	.byte	0
+.LVUS108:
+	.uleb128 .LVU1052
+	.uleb128 .LVU1055
+.LLST108:
+	.byte	0x4
+	.uleb128 .LVL186-.Ltext0
+	.uleb128 .LVL187-.Ltext0
+	.uleb128 0x3
+	.byte	0x8
+	.byte	0x3f
+	.byte	0x9f
+	.byte	0
+.LVUS109:
+	.uleb128 .LVU1066
+	.uleb128 .LVU1069
+.LLST109:
+	.byte	0x4
+	.uleb128 .LVL188-.Ltext0
+	.uleb128 .LVL189-.Ltext0
+	.uleb128 0x3
+	.byte	0x8
+	.byte	0x20
+	.byte	0x9f
+	.byte	0
+.LVUS110:
+	.uleb128 .LVU1076
+	.uleb128 .LVU1079
+.LLST110:
+	.byte	0x4
+	.uleb128 .LVL190-.Ltext0
+	.uleb128 .LVL191-.Ltext0
+	.uleb128 0x2
+	.byte	0x48
+	.byte	0x9f
+	.byte	0
+.LVUS111:
+	.uleb128 .LVU1086
+	.uleb128 .LVU1089
+.LLST111:
+	.byte	0x4
+	.uleb128 .LVL192-.Ltext0
+	.uleb128 .LVL193-.Ltext0
+	.uleb128 0x2
+	.byte	0x40
+	.byte	0x9f
+	.byte	0
+.LVUS112:
+	.uleb128 .LVU1096
+	.uleb128 .LVU1098
+.LLST112:
+	.byte	0x4
+	.uleb128 .LVL194-.Ltext0
+	.uleb128 .LVL194-.Ltext0
+	.uleb128 0x3
+	.byte	0x8
+	.byte	0x3f
+	.byte	0x9f
+	.byte	0
+.LVUS113:
+	.uleb128 .LVU1109
+	.uleb128 .LVU1112
+.LLST113:
+	.byte	0x4
+	.uleb128 .LVL195-.Ltext0
+	.uleb128 .LVL196-.Ltext0
+	.uleb128 0x3
+	.byte	0x8
+	.byte	0x20
+	.byte	0x9f
+	.byte	0
+.LVUS114:
+	.uleb128 .LVU1119
+	.uleb128 .LVU1122
+.LLST114:
+	.byte	0x4
+	.uleb128 .LVL197-.Ltext0
+	.uleb128 .LVL198-.Ltext0
+	.uleb128 0x2
+	.byte	0x48
+	.byte	0x9f
+	.byte	0
+.LVUS115:
+	.uleb128 .LVU1129
+	.uleb128 .LVU1132
+.LLST115:
+	.byte	0x4
+	.uleb128 .LVL199-.Ltext0
+	.uleb128 .LVL200-.Ltext0
+	.uleb128 0x2
+	.byte	0x40
+	.byte	0x9f
+	.byte	0
+.LVUS116:
+	.uleb128 .LVU1139
+	.uleb128 .LVU1142
+.LLST116:
+	.byte	0x4
+	.uleb128 .LVL201-.Ltext0
+	.uleb128 .LVL202-.Ltext0
+	.uleb128 0x3
+	.byte	0x8
+	.byte	0x3f
+	.byte	0x9f
+	.byte	0
+.LVUS117:
+	.uleb128 .LVU1153
+	.uleb128 .LVU1156
+.LLST117:
+	.byte	0x4
+	.uleb128 .LVL203-.Ltext0
+	.uleb128 .LVL204-.Ltext0
+	.uleb128 0x3
+	.byte	0x8
+	.byte	0x20
+	.byte	0x9f
+	.byte	0
+.LVUS118:
+	.uleb128 .LVU1163
+	.uleb128 .LVU1166
+.LLST118:
+	.byte	0x4
+	.uleb128 .LVL205-.Ltext0
+	.uleb128 .LVL206-.Ltext0
+	.uleb128 0x2
+	.byte	0x48
+	.byte	0x9f
+	.byte	0
+.LVUS119:
+	.uleb128 .LVU1173
+	.uleb128 .LVU1176
+.LLST119:
+	.byte	0x4
+	.uleb128 .LVL207-.Ltext0
+	.uleb128 .LVL208-.Ltext0
+	.uleb128 0x2
+	.byte	0x40
+	.byte	0x9f
+	.byte	0
+.LVUS121:
+	.uleb128 .LVU1184
+	.uleb128 .LVU1188
+.LLST121:
+	.byte	0x4
+	.uleb128 .LVL209-.Ltext0
+	.uleb128 .LVL210-.Ltext0
+	.uleb128 0x3
+	.byte	0x8
+	.byte	0x3f
+	.byte	0x9f
+	.byte	0
+.LVUS122:
+	.uleb128 .LVU1197
+	.uleb128 .LVU1200
+.LLST122:
+	.byte	0x4
+	.uleb128 .LVL211-.Ltext0
+	.uleb128 .LVL212-.Ltext0
+	.uleb128 0x1
+	.byte	0x5c
+	.byte	0
+.LVUS123:
+	.uleb128 .LVU1197
+	.uleb128 .LVU1200
+.LLST123:
+	.byte	0x4
+	.uleb128 .LVL211-.Ltext0
+	.uleb128 .LVL212-.Ltext0
+	.uleb128 0x3
+	.byte	0x8
+	.byte	0x20
+	.byte	0x9f
+	.byte	0
+.LVUS124:
+	.uleb128 .LVU1207
+	.uleb128 .LVU1210
+.LLST124:
+	.byte	0x4
+	.uleb128 .LVL213-.Ltext0
+	.uleb128 .LVL214-.Ltext0
+	.uleb128 0x2
+	.byte	0x48
+	.byte	0x9f
+	.byte	0
+.LVUS125:
+	.uleb128 .LVU1217
+	.uleb128 .LVU1220
+.LLST125:
+	.byte	0x4
+	.uleb128 .LVL215-.Ltext0
+	.uleb128 .LVL216-.Ltext0
+	.uleb128 0x2
+	.byte	0x40
+	.byte	0x9f
+	.byte	0
+.LVUS126:
+	.uleb128 .LVU1227
+	.uleb128 .LVU1230
+.LLST126:
+	.byte	0x4
+	.uleb128 .LVL217-.Ltext0
+	.uleb128 .LVL218-.Ltext0
+	.uleb128 0x3
+	.byte	0x8
+	.byte	0x3f
+	.byte	0x9f
+	.byte	0
+.LVUS127:
+	.uleb128 .LVU1239
+	.uleb128 .LVU1242
+.LLST127:
+	.byte	0x4
+	.uleb128 .LVL219-.Ltext0
+	.uleb128 .LVL220-.Ltext0
+	.uleb128 0x3
+	.byte	0x8
+	.byte	0x20
+	.byte	0x9f
+	.byte	0
+.LVUS128:
+	.uleb128 .LVU1249
+	.uleb128 .LVU1252
+.LLST128:
+	.byte	0x4
+	.uleb128 .LVL221-.Ltext0
+	.uleb128 .LVL222-.Ltext0
+	.uleb128 0x2
+	.byte	0x48
+	.byte	0x9f
+	.byte	0
+.LVUS129:
+	.uleb128 .LVU1259
+	.uleb128 .LVU1261
+.LLST129:
+	.byte	0x4
+	.uleb128 .LVL223-.Ltext0
+	.uleb128 .LVL223-.Ltext0
+	.uleb128 0x2
+	.byte	0x40
+	.byte	0x9f
+	.byte	0
+.LVUS130:
+	.uleb128 .LVU1268
+	.uleb128 .LVU1271
+.LLST130:
+	.byte	0x4
+	.uleb128 .LVL224-.Ltext0
+	.uleb128 .LVL225-.Ltext0
+	.uleb128 0x3
+	.byte	0x8
+	.byte	0x3f
+	.byte	0x9f
+	.byte	0
+.LVUS131:
+	.uleb128 .LVU1282
+	.uleb128 .LVU1285
+.LLST131:
+	.byte	0x4
+	.uleb128 .LVL226-.Ltext0
+	.uleb128 .LVL227-.Ltext0
+	.uleb128 0x3
+	.byte	0x8
+	.byte	0x20
+	.byte	0x9f
+	.byte	0
+.LVUS132:
+	.uleb128 .LVU1292
+	.uleb128 .LVU1295
+.LLST132:
+	.byte	0x4
+	.uleb128 .LVL228-.Ltext0
+	.uleb128 .LVL229-.Ltext0
+	.uleb128 0x2
+	.byte	0x48
+	.byte	0x9f
+	.byte	0
+.LVUS134:
+	.uleb128 .LVU1302
+	.uleb128 .LVU1306
+.LLST134:
+	.byte	0x4
+	.uleb128 .LVL230-.Ltext0
+	.uleb128 .LVL231-.Ltext0
+	.uleb128 0x2
+	.byte	0x40
+	.byte	0x9f
+	.byte	0
+.LVUS135:
+	.uleb128 .LVU1313
+	.uleb128 .LVU1316
+.LLST135:
+	.byte	0x4
+	.uleb128 .LVL232-.Ltext0
+	.uleb128 .LVL233-.Ltext0
+	.uleb128 0x3
+	.byte	0x8
+	.byte	0x3f
+	.byte	0x9f
+	.byte	0
+.LVUS136:
+	.uleb128 .LVU1327
+	.uleb128 .LVU1330
+.LLST136:
+	.byte	0x4
+	.uleb128 .LVL234-.Ltext0
+	.uleb128 .LVL235-.Ltext0
+	.uleb128 0x3
+	.byte	0x8
+	.byte	0x20
+	.byte	0x9f
+	.byte	0
+.LVUS137:
+	.uleb128 .LVU1338
+	.uleb128 .LVU1341
+.LLST137:
+	.byte	0x4
+	.uleb128 .LVL236-.Ltext0
+	.uleb128 .LVL237-.Ltext0
+	.uleb128 0x2
+	.byte	0x48
+	.byte	0x9f
+	.byte	0
+.LVUS138:
+	.uleb128 .LVU1348
+	.uleb128 .LVU1351
+.LLST138:
+	.byte	0x4
+	.uleb128 .LVL238-.Ltext0
+	.uleb128 .LVL239-.Ltext0
+	.uleb128 0x2
+	.byte	0x40
+	.byte	0x9f
+	.byte	0
+.LVUS139:
+	.uleb128 .LVU1358
+	.uleb128 .LVU1361
+.LLST139:
+	.byte	0x4
+	.uleb128 .LVL240-.Ltext0
+	.uleb128 .LVL241-.Ltext0
+	.uleb128 0x3
+	.byte	0x8
+	.byte	0x3f
+	.byte	0x9f
+	.byte	0
+.LVUS140:
+	.uleb128 .LVU1370
+	.uleb128 .LVU1373
+.LLST140:
+	.byte	0x4
+	.uleb128 .LVL242-.Ltext0
+	.uleb128 .LVL243-.Ltext0
+	.uleb128 0x3
+	.byte	0x8
+	.byte	0x20
+	.byte	0x9f
+	.byte	0
+.LVUS141:
+	.uleb128 .LVU1380
+	.uleb128 .LVU1383
+.LLST141:
+	.byte	0x4
+	.uleb128 .LVL244-.Ltext0
+	.uleb128 .LVL245-.Ltext0
+	.uleb128 0x2
+	.byte	0x48
+	.byte	0x9f
+	.byte	0
+.LVUS142:
+	.uleb128 .LVU1390
+	.uleb128 .LVU1393
+.LLST142:
+	.byte	0x4
+	.uleb128 .LVL246-.Ltext0
+	.uleb128 .LVL247-.Ltext0
+	.uleb128 0x2
+	.byte	0x40
+	.byte	0x9f
+	.byte	0
+.LVUS143:
+	.uleb128 .LVU1400
+	.uleb128 .LVU1403
+.LLST143:
+	.byte	0x4
+	.uleb128 .LVL248-.Ltext0
+	.uleb128 .LVL249-.Ltext0
+	.uleb128 0x3
+	.byte	0x8
+	.byte	0x3f
+	.byte	0x9f
+	.byte	0
+.LVUS144:
+	.uleb128 .LVU1414
+	.uleb128 .LVU1417
+.LLST144:
+	.byte	0x4
+	.uleb128 .LVL250-.Ltext0
+	.uleb128 .LVL251-.Ltext0
+	.uleb128 0x3
+	.byte	0x8
+	.byte	0x20
+	.byte	0x9f
+	.byte	0
+.LVUS145:
+	.uleb128 .LVU1424
+	.uleb128 .LVU1427
+.LLST145:
+	.byte	0x4
+	.uleb128 .LVL252-.Ltext0
+	.uleb128 .LVL253-.Ltext0
+	.uleb128 0x2
+	.byte	0x48
+	.byte	0x9f
+	.byte	0
+.LVUS146:
+	.uleb128 .LVU1434
+	.uleb128 .LVU1437
+.LLST146:
+	.byte	0x4
+	.uleb128 .LVL254-.Ltext0
+	.uleb128 .LVL255-.Ltext0
+	.uleb128 0x2
+	.byte	0x40
+	.byte	0x9f
+	.byte	0
+.LVUS147:
+	.uleb128 .LVU1444
+	.uleb128 .LVU1446
+.LLST147:
+	.byte	0x4
+	.uleb128 .LVL256-.Ltext0
+	.uleb128 .LVL256-.Ltext0
+	.uleb128 0x3
+	.byte	0x8
+	.byte	0x3f
+	.byte	0x9f
+	.byte	0
+.LVUS148:
+	.uleb128 .LVU1458
+	.uleb128 .LVU1461
+.LLST148:
+	.byte	0x4
+	.uleb128 .LVL257-.Ltext0
+	.uleb128 .LVL258-.Ltext0
+	.uleb128 0x3
+	.byte	0x8
+	.byte	0x20
+	.byte	0x9f
+	.byte	0
+.LVUS149:
+	.uleb128 .LVU1468
+	.uleb128 .LVU1471
+.LLST149:
+	.byte	0x4
+	.uleb128 .LVL259-.Ltext0
+	.uleb128 .LVL260-.Ltext0
+	.uleb128 0x2
+	.byte	0x48
+	.byte	0x9f
+	.byte	0
+.LVUS150:
+	.uleb128 .LVU1478
+	.uleb128 .LVU1481
+.LLST150:
+	.byte	0x4
+	.uleb128 .LVL261-.Ltext0
+	.uleb128 .LVL262-.Ltext0
+	.uleb128 0x2
+	.byte	0x40
+	.byte	0x9f
+	.byte	0
+.LVUS151:
+	.uleb128 .LVU1488
+	.uleb128 .LVU1491
+.LLST151:
+	.byte	0x4
+	.uleb128 .LVL263-.Ltext0
+	.uleb128 .LVL264-.Ltext0
+	.uleb128 0x3
+	.byte	0x8
+	.byte	0x3f
+	.byte	0x9f
+	.byte	0
+.LVUS152:
+	.uleb128 .LVU1502
+	.uleb128 .LVU1505
+.LLST152:
+	.byte	0x4
+	.uleb128 .LVL265-.Ltext0
+	.uleb128 .LVL266-.Ltext0
+	.uleb128 0x3
+	.byte	0x8
+	.byte	0x20
+	.byte	0x9f
+	.byte	0
+.LVUS153:
+	.uleb128 .LVU1512
+	.uleb128 .LVU1515
+.LLST153:
+	.byte	0x4
+	.uleb128 .LVL267-.Ltext0
+	.uleb128 .LVL268-.Ltext0
+	.uleb128 0x2
+	.byte	0x48
+	.byte	0x9f
+	.byte	0
+.LVUS154:
+	.uleb128 .LVU1522
+	.uleb128 .LVU1525
+.LLST154:
+	.byte	0x4
+	.uleb128 .LVL269-.Ltext0
+	.uleb128 .LVL270-.Ltext0
+	.uleb128 0x2
+	.byte	0x40
+	.byte	0x9f
+	.byte	0
+.LVUS155:
+	.uleb128 .LVU1532
+	.uleb128 .LVU1535
+.LLST155:
+	.byte	0x4
+	.uleb128 .LVL271-.Ltext0
+	.uleb128 .LVL272-.Ltext0
+	.uleb128 0x3
+	.byte	0x8
+	.byte	0x3f
+	.byte	0x9f
+	.byte	0
+.LVUS156:
+	.uleb128 .LVU1544
+	.uleb128 .LVU1547
+.LLST156:
+	.byte	0x4
+	.uleb128 .LVL273-.Ltext0
+	.uleb128 .LVL274-.Ltext0
+	.uleb128 0x1
+	.byte	0x5c
+	.byte	0
+.LVUS157:
+	.uleb128 .LVU1544
+	.uleb128 .LVU1547
+.LLST157:
+	.byte	0x4
+	.uleb128 .LVL273-.Ltext0
+	.uleb128 .LVL274-.Ltext0
+	.uleb128 0x3
+	.byte	0x8
+	.byte	0x20
+	.byte	0x9f
+	.byte	0
+.LVUS158:
+	.uleb128 .LVU1554
+	.uleb128 .LVU1557
+.LLST158:
+	.byte	0x4
+	.uleb128 .LVL275-.Ltext0
+	.uleb128 .LVL276-.Ltext0
+	.uleb128 0x2
+	.byte	0x48
+	.byte	0x9f
+	.byte	0
+.LVUS159:
+	.uleb128 .LVU1564
+	.uleb128 .LVU1567
+.LLST159:
+	.byte	0x4
+	.uleb128 .LVL277-.Ltext0
+	.uleb128 .LVL278-.Ltext0
+	.uleb128 0x2
+	.byte	0x40
+	.byte	0x9f
+	.byte	0
+.LVUS160:
+	.uleb128 .LVU1574
+	.uleb128 .LVU1577
+.LLST160:
+	.byte	0x4
+	.uleb128 .LVL279-.Ltext0
+	.uleb128 .LVL280-.Ltext0
+	.uleb128 0x3
+	.byte	0x8
+	.byte	0x3f
+	.byte	0x9f
+	.byte	0
+.LVUS161:
+	.uleb128 .LVU1586
+	.uleb128 .LVU1589
+.LLST161:
+	.byte	0x4
+	.uleb128 .LVL281-.Ltext0
+	.uleb128 .LVL282-.Ltext0
+	.uleb128 0x3
+	.byte	0x8
+	.byte	0x20
+	.byte	0x9f
+	.byte	0
+.LVUS162:
+	.uleb128 .LVU1596
+	.uleb128 .LVU1599
+.LLST162:
+	.byte	0x4
+	.uleb128 .LVL283-.Ltext0
+	.uleb128 .LVL284-.Ltext0
+	.uleb128 0x2
+	.byte	0x48
+	.byte	0x9f
+	.byte	0
+.LVUS163:
+	.uleb128 .LVU1606
+	.uleb128 .LVU1608
+.LLST163:
+	.byte	0x4
+	.uleb128 .LVL285-.Ltext0
+	.uleb128 .LVL285-.Ltext0
+	.uleb128 0x2
+	.byte	0x40
+	.byte	0x9f
+	.byte	0
+.LVUS164:
+	.uleb128 .LVU1615
+	.uleb128 .LVU1618
+.LLST164:
+	.byte	0x4
+	.uleb128 .LVL286-.Ltext0
+	.uleb128 .LVL287-.Ltext0
+	.uleb128 0x3
+	.byte	0x8
+	.byte	0x3f
+	.byte	0x9f
+	.byte	0
+.LVUS165:
+	.uleb128 .LVU1629
+	.uleb128 .LVU1632
+.LLST165:
+	.byte	0x4
+	.uleb128 .LVL288-.Ltext0
+	.uleb128 .LVL289-.Ltext0
+	.uleb128 0x3
+	.byte	0x8
+	.byte	0x20
+	.byte	0x9f
+	.byte	0
+.LVUS166:
+	.uleb128 .LVU1639
+	.uleb128 .LVU1642
+.LLST166:
+	.byte	0x4
+	.uleb128 .LVL290-.Ltext0
+	.uleb128 .LVL291-.Ltext0
+	.uleb128 0x2
+	.byte	0x48
+	.byte	0x9f
+	.byte	0
+.LVUS167:
+	.uleb128 .LVU1649
+	.uleb128 .LVU1652
+.LLST167:
+	.byte	0x4
+	.uleb128 .LVL292-.Ltext0
+	.uleb128 .LVL293-.Ltext0
+	.uleb128 0x2
+	.byte	0x40
+	.byte	0x9f
+	.byte	0
+.LVUS168:
+	.uleb128 .LVU1659
+	.uleb128 .LVU1662
+.LLST168:
+	.byte	0x4
+	.uleb128 .LVL294-.Ltext0
+	.uleb128 .LVL295-.Ltext0
+	.uleb128 0x3
+	.byte	0x8
+	.byte	0x3f
+	.byte	0x9f
+	.byte	0
+.LVUS170:
+	.uleb128 .LVU1670
+	.uleb128 .LVU1673
+	.uleb128 .LVU1673
+	.uleb128 .LVU1675
+.LLST170:
+	.byte	0x4
+	.uleb128 .LVL296-.Ltext0
+	.uleb128 .LVL297-.Ltext0
+	.uleb128 0x6
+	.byte	0x71
+	.sleb128 0
+	.byte	0x72
+	.sleb128 0
+	.byte	0x27
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL297-.Ltext0
+	.uleb128 .LVL298-.Ltext0
+	.uleb128 0x1
+	.byte	0x52
+	.byte	0
+.LVUS171:
+	.uleb128 .LVU1670
+	.uleb128 .LVU1675
+.LLST171:
+	.byte	0x4
+	.uleb128 .LVL296-.Ltext0
+	.uleb128 .LVL298-.Ltext0
+	.uleb128 0x3
+	.byte	0x8
+	.byte	0x20
+	.byte	0x9f
+	.byte	0
+.LVUS172:
+	.uleb128 .LVU1684
+	.uleb128 .LVU1687
+.LLST172:
+	.byte	0x4
+	.uleb128 .LVL299-.Ltext0
+	.uleb128 .LVL300-.Ltext0
+	.uleb128 0x2
+	.byte	0x48
+	.byte	0x9f
+	.byte	0
+.LVUS173:
+	.uleb128 .LVU1694
+	.uleb128 .LVU1697
+.LLST173:
+	.byte	0x4
+	.uleb128 .LVL301-.Ltext0
+	.uleb128 .LVL302-.Ltext0
+	.uleb128 0x2
+	.byte	0x40
+	.byte	0x9f
+	.byte	0
+.LVUS174:
+	.uleb128 .LVU1704
+	.uleb128 .LVU1707
+.LLST174:
+	.byte	0x4
+	.uleb128 .LVL303-.Ltext0
+	.uleb128 .LVL304-.Ltext0
+	.uleb128 0x3
+	.byte	0x8
+	.byte	0x3f
+	.byte	0x9f
+	.byte	0
+.LVUS175:
+	.uleb128 .LVU1716
+	.uleb128 .LVU1719
+.LLST175:
+	.byte	0x4
+	.uleb128 .LVL305-.Ltext0
+	.uleb128 .LVL306-.Ltext0
+	.uleb128 0x3
+	.byte	0x8
+	.byte	0x20
+	.byte	0x9f
+	.byte	0
+.LVUS176:
+	.uleb128 .LVU1726
+	.uleb128 .LVU1729
+.LLST176:
+	.byte	0x4
+	.uleb128 .LVL307-.Ltext0
+	.uleb128 .LVL308-.Ltext0
+	.uleb128 0x2
+	.byte	0x48
+	.byte	0x9f
+	.byte	0
+.LVUS177:
+	.uleb128 .LVU1736
+	.uleb128 .LVU1739
+.LLST177:
+	.byte	0x4
+	.uleb128 .LVL309-.Ltext0
+	.uleb128 .LVL310-.Ltext0
+	.uleb128 0x2
+	.byte	0x40
+	.byte	0x9f
+	.byte	0
+.LVUS178:
+	.uleb128 .LVU1746
+	.uleb128 .LVU1749
+.LLST178:
+	.byte	0x4
+	.uleb128 .LVL311-.Ltext0
+	.uleb128 .LVL312-.Ltext0
+	.uleb128 0x3
+	.byte	0x8
+	.byte	0x3f
+	.byte	0x9f
+	.byte	0
+.LVUS179:
+	.uleb128 .LVU1760
+	.uleb128 .LVU1763
+.LLST179:
+	.byte	0x4
+	.uleb128 .LVL313-.Ltext0
+	.uleb128 .LVL314-.Ltext0
+	.uleb128 0x3
+	.byte	0x8
+	.byte	0x20
+	.byte	0x9f
+	.byte	0
+.LVUS180:
+	.uleb128 .LVU1770
+	.uleb128 .LVU1773
+.LLST180:
+	.byte	0x4
+	.uleb128 .LVL315-.Ltext0
+	.uleb128 .LVL316-.Ltext0
+	.uleb128 0x2
+	.byte	0x48
+	.byte	0x9f
+	.byte	0
+.LVUS181:
+	.uleb128 .LVU1780
+	.uleb128 .LVU1783
+.LLST181:
+	.byte	0x4
+	.uleb128 .LVL317-.Ltext0
+	.uleb128 .LVL318-.Ltext0
+	.uleb128 0x2
+	.byte	0x40
+	.byte	0x9f
+	.byte	0
+.LVUS183:
+	.uleb128 .LVU1791
+	.uleb128 .LVU1793
+.LLST183:
+	.byte	0x4
+	.uleb128 .LVL319-.Ltext0
+	.uleb128 .LVL319-.Ltext0
+	.uleb128 0x3
+	.byte	0x8
+	.byte	0x3f
+	.byte	0x9f
+	.byte	0
+.LVUS184:
+	.uleb128 .LVU1803
+	.uleb128 .LVU1806
+.LLST184:
+	.byte	0x4
+	.uleb128 .LVL320-.Ltext0
+	.uleb128 .LVL321-.Ltext0
+	.uleb128 0x3
+	.byte	0x8
+	.byte	0x20
+	.byte	0x9f
+	.byte	0
+.LVUS185:
+	.uleb128 .LVU1813
+	.uleb128 .LVU1816
+.LLST185:
+	.byte	0x4
+	.uleb128 .LVL322-.Ltext0
+	.uleb128 .LVL323-.Ltext0
+	.uleb128 0x2
+	.byte	0x48
+	.byte	0x9f
+	.byte	0
+.LVUS186:
+	.uleb128 .LVU1823
+	.uleb128 .LVU1826
+.LLST186:
+	.byte	0x4
+	.uleb128 .LVL324-.Ltext0
+	.uleb128 .LVL325-.Ltext0
+	.uleb128 0x2
+	.byte	0x40
+	.byte	0x9f
+	.byte	0
+.LVUS187:
+	.uleb128 .LVU1833
+	.uleb128 .LVU1836
+.LLST187:
+	.byte	0x4
+	.uleb128 .LVL326-.Ltext0
+	.uleb128 .LVL327-.Ltext0
+	.uleb128 0x3
+	.byte	0x8
+	.byte	0x3f
+	.byte	0x9f
+	.byte	0
+.LVUS188:
+	.uleb128 .LVU1847
+	.uleb128 .LVU1850
+.LLST188:
+	.byte	0x4
+	.uleb128 .LVL328-.Ltext0
+	.uleb128 .LVL329-.Ltext0
+	.uleb128 0x3
+	.byte	0x8
+	.byte	0x20
+	.byte	0x9f
+	.byte	0
+.LVUS189:
+	.uleb128 .LVU1858
+	.uleb128 .LVU1861
+.LLST189:
+	.byte	0x4
+	.uleb128 .LVL330-.Ltext0
+	.uleb128 .LVL331-.Ltext0
+	.uleb128 0x2
+	.byte	0x48
+	.byte	0x9f
+	.byte	0
+.LVUS190:
+	.uleb128 .LVU1868
+	.uleb128 .LVU1871
+.LLST190:
+	.byte	0x4
+	.uleb128 .LVL332-.Ltext0
+	.uleb128 .LVL333-.Ltext0
+	.uleb128 0x2
+	.byte	0x40
+	.byte	0x9f
+	.byte	0
+.LVUS191:
+	.uleb128 .LVU1878
+	.uleb128 .LVU1881
+.LLST191:
+	.byte	0x4
+	.uleb128 .LVL334-.Ltext0
+	.uleb128 .LVL335-.Ltext0
+	.uleb128 0x3
+	.byte	0x8
+	.byte	0x3f
+	.byte	0x9f
+	.byte	0
+.LVUS192:
+	.uleb128 .LVU1890
+	.uleb128 .LVU1893
+.LLST192:
+	.byte	0x4
+	.uleb128 .LVL336-.Ltext0
+	.uleb128 .LVL337-.Ltext0
+	.uleb128 0x1
+	.byte	0x5c
+	.byte	0
+.LVUS193:
+	.uleb128 .LVU1890
+	.uleb128 .LVU1893
+.LLST193:
+	.byte	0x4
+	.uleb128 .LVL336-.Ltext0
+	.uleb128 .LVL337-.Ltext0
+	.uleb128 0x3
+	.byte	0x8
+	.byte	0x20
+	.byte	0x9f
+	.byte	0
+.LVUS194:
+	.uleb128 .LVU1900
+	.uleb128 .LVU1903
+.LLST194:
+	.byte	0x4
+	.uleb128 .LVL338-.Ltext0
+	.uleb128 .LVL339-.Ltext0
+	.uleb128 0x2
+	.byte	0x48
+	.byte	0x9f
+	.byte	0
+.LVUS195:
+	.uleb128 .LVU1910
+	.uleb128 .LVU1913
+.LLST195:
+	.byte	0x4
+	.uleb128 .LVL340-.Ltext0
+	.uleb128 .LVL341-.Ltext0
+	.uleb128 0x2
+	.byte	0x40
+	.byte	0x9f
+	.byte	0
+.LVUS196:
+	.uleb128 .LVU1920
+	.uleb128 .LVU1923
+.LLST196:
+	.byte	0x4
+	.uleb128 .LVL342-.Ltext0
+	.uleb128 .LVL343-.Ltext0
+	.uleb128 0x3
+	.byte	0x8
+	.byte	0x3f
+	.byte	0x9f
+	.byte	0
+.LVUS197:
+	.uleb128 .LVU1932
+	.uleb128 .LVU1935
+.LLST197:
+	.byte	0x4
+	.uleb128 .LVL344-.Ltext0
+	.uleb128 .LVL345-.Ltext0
+	.uleb128 0x3
+	.byte	0x8
+	.byte	0x20
+	.byte	0x9f
+	.byte	0
+.LVUS198:
+	.uleb128 .LVU1942
+	.uleb128 .LVU1945
+.LLST198:
+	.byte	0x4
+	.uleb128 .LVL346-.Ltext0
+	.uleb128 .LVL347-.Ltext0
+	.uleb128 0x2
+	.byte	0x48
+	.byte	0x9f
+	.byte	0
+.LVUS199:
+	.uleb128 .LVU1952
+	.uleb128 .LVU1954
+.LLST199:
+	.byte	0x4
+	.uleb128 .LVL348-.Ltext0
+	.uleb128 .LVL348-.Ltext0
+	.uleb128 0x2
+	.byte	0x40
+	.byte	0x9f
+	.byte	0
+.LVUS200:
+	.uleb128 .LVU1961
+	.uleb128 .LVU1964
+.LLST200:
+	.byte	0x4
+	.uleb128 .LVL349-.Ltext0
+	.uleb128 .LVL350-.Ltext0
+	.uleb128 0x3
+	.byte	0x8
+	.byte	0x3f
+	.byte	0x9f
+	.byte	0
+.LVUS201:
+	.uleb128 .LVU1975
+	.uleb128 .LVU1978
+.LLST201:
+	.byte	0x4
+	.uleb128 .LVL351-.Ltext0
+	.uleb128 .LVL352-.Ltext0
+	.uleb128 0x3
+	.byte	0x8
+	.byte	0x20
+	.byte	0x9f
+	.byte	0
+.LVUS202:
+	.uleb128 .LVU1985
+	.uleb128 .LVU1988
+.LLST202:
+	.byte	0x4
+	.uleb128 .LVL353-.Ltext0
+	.uleb128 .LVL354-.Ltext0
+	.uleb128 0x2
+	.byte	0x48
+	.byte	0x9f
+	.byte	0
+.LVUS203:
+	.uleb128 .LVU1995
+	.uleb128 .LVU1998
+.LLST203:
+	.byte	0x4
+	.uleb128 .LVL355-.Ltext0
+	.uleb128 .LVL356-.Ltext0
+	.uleb128 0x2
+	.byte	0x40
+	.byte	0x9f
+	.byte	0
+.LVUS204:
+	.uleb128 .LVU2005
+	.uleb128 .LVU2008
+.LLST204:
+	.byte	0x4
+	.uleb128 .LVL357-.Ltext0
+	.uleb128 .LVL358-.Ltext0
+	.uleb128 0x3
+	.byte	0x8
+	.byte	0x3f
+	.byte	0x9f
+	.byte	0
+.LVUS205:
+	.uleb128 .LVU2019
+	.uleb128 .LVU2022
+.LLST205:
+	.byte	0x4
+	.uleb128 .LVL359-.Ltext0
+	.uleb128 .LVL360-.Ltext0
+	.uleb128 0x3
+	.byte	0x8
+	.byte	0x20
+	.byte	0x9f
+	.byte	0
+.LVUS206:
+	.uleb128 .LVU2029
+	.uleb128 .LVU2032
+.LLST206:
+	.byte	0x4
+	.uleb128 .LVL361-.Ltext0
+	.uleb128 .LVL362-.Ltext0
+	.uleb128 0x2
+	.byte	0x48
+	.byte	0x9f
+	.byte	0
+.LVUS207:
+	.uleb128 .LVU2039
+	.uleb128 .LVU2042
+.LLST207:
+	.byte	0x4
+	.uleb128 .LVL363-.Ltext0
+	.uleb128 .LVL364-.Ltext0
+	.uleb128 0x2
+	.byte	0x40
+	.byte	0x9f
+	.byte	0
+.LVUS209:
+	.uleb128 .LVU2050
+	.uleb128 .LVU2054
+.LLST209:
+	.byte	0x4
+	.uleb128 .LVL365-.Ltext0
+	.uleb128 .LVL366-.Ltext0
+	.uleb128 0x3
+	.byte	0x8
+	.byte	0x3f
+	.byte	0x9f
+	.byte	0
+.LVUS210:
+	.uleb128 .LVU2063
+	.uleb128 .LVU2066
+.LLST210:
+	.byte	0x4
+	.uleb128 .LVL367-.Ltext0
+	.uleb128 .LVL368-.Ltext0
+	.uleb128 0x3
+	.byte	0x8
+	.byte	0x20
+	.byte	0x9f
+	.byte	0
+.LVUS211:
+	.uleb128 .LVU2073
+	.uleb128 .LVU2076
+.LLST211:
+	.byte	0x4
+	.uleb128 .LVL369-.Ltext0
+	.uleb128 .LVL370-.Ltext0
+	.uleb128 0x2
+	.byte	0x48
+	.byte	0x9f
+	.byte	0
+.LVUS212:
+	.uleb128 .LVU2083
+	.uleb128 .LVU2086
+.LLST212:
+	.byte	0x4
+	.uleb128 .LVL371-.Ltext0
+	.uleb128 .LVL372-.Ltext0
+	.uleb128 0x2
+	.byte	0x40
+	.byte	0x9f
+	.byte	0
+.LVUS213:
+	.uleb128 .LVU2093
+	.uleb128 .LVU2096
+.LLST213:
+	.byte	0x4
+	.uleb128 .LVL373-.Ltext0
+	.uleb128 .LVL374-.Ltext0
+	.uleb128 0x3
+	.byte	0x8
+	.byte	0x3f
+	.byte	0x9f
+	.byte	0
+.LVUS214:
+	.uleb128 .LVU2107
+	.uleb128 .LVU2110
+.LLST214:
+	.byte	0x4
+	.uleb128 .LVL375-.Ltext0
+	.uleb128 .LVL376-.Ltext0
+	.uleb128 0x3
+	.byte	0x8
+	.byte	0x20
+	.byte	0x9f
+	.byte	0
+.LVUS215:
+	.uleb128 .LVU2117
+	.uleb128 .LVU2120
+.LLST215:
+	.byte	0x4
+	.uleb128 .LVL377-.Ltext0
+	.uleb128 .LVL378-.Ltext0
+	.uleb128 0x2
+	.byte	0x48
+	.byte	0x9f
+	.byte	0
+.LVUS216:
+	.uleb128 .LVU2127
+	.uleb128 .LVU2130
+.LLST216:
+	.byte	0x4
+	.uleb128 .LVL379-.Ltext0
+	.uleb128 .LVL380-.Ltext0
+	.uleb128 0x2
+	.byte	0x40
+	.byte	0x9f
+	.byte	0
+.LVUS217:
+	.uleb128 .LVU2137
+	.uleb128 .LVU2139
+.LLST217:
+	.byte	0x4
+	.uleb128 .LVL381-.Ltext0
+	.uleb128 .LVL381-.Ltext0
+	.uleb128 0x3
+	.byte	0x8
+	.byte	0x3f
+	.byte	0x9f
+	.byte	0
+.LVUS218:
+	.uleb128 .LVU2150
+	.uleb128 .LVU2153
+.LLST218:
+	.byte	0x4
+	.uleb128 .LVL382-.Ltext0
+	.uleb128 .LVL383-.Ltext0
+	.uleb128 0x3
+	.byte	0x8
+	.byte	0x20
+	.byte	0x9f
+	.byte	0
+.LVUS219:
+	.uleb128 .LVU2160
+	.uleb128 .LVU2163
+.LLST219:
+	.byte	0x4
+	.uleb128 .LVL384-.Ltext0
+	.uleb128 .LVL385-.Ltext0
+	.uleb128 0x2
+	.byte	0x48
+	.byte	0x9f
+	.byte	0
+.LVUS221:
+	.uleb128 .LVU2170
+	.uleb128 .LVU2174
+.LLST221:
+	.byte	0x4
+	.uleb128 .LVL386-.Ltext0
+	.uleb128 .LVL387-.Ltext0
+	.uleb128 0x2
+	.byte	0x40
+	.byte	0x9f
+	.byte	0
+.LVUS222:
+	.uleb128 .LVU2181
+	.uleb128 .LVU2184
+.LLST222:
+	.byte	0x4
+	.uleb128 .LVL388-.Ltext0
+	.uleb128 .LVL389-.Ltext0
+	.uleb128 0x3
+	.byte	0x8
+	.byte	0x3f
+	.byte	0x9f
+	.byte	0
+.LVUS223:
+	.uleb128 .LVU2195
+	.uleb128 .LVU2198
+.LLST223:
+	.byte	0x4
+	.uleb128 .LVL390-.Ltext0
+	.uleb128 .LVL391-.Ltext0
+	.uleb128 0x3
+	.byte	0x8
+	.byte	0x20
+	.byte	0x9f
+	.byte	0
+.LVUS224:
+	.uleb128 .LVU2206
+	.uleb128 .LVU2209
+.LLST224:
+	.byte	0x4
+	.uleb128 .LVL392-.Ltext0
+	.uleb128 .LVL393-.Ltext0
+	.uleb128 0x2
+	.byte	0x48
+	.byte	0x9f
+	.byte	0
+.LVUS225:
+	.uleb128 .LVU2216
+	.uleb128 .LVU2219
+.LLST225:
+	.byte	0x4
+	.uleb128 .LVL394-.Ltext0
+	.uleb128 .LVL395-.Ltext0
+	.uleb128 0x2
+	.byte	0x40
+	.byte	0x9f
+	.byte	0
+.LVUS226:
+	.uleb128 .LVU2226
+	.uleb128 .LVU2229
+.LLST226:
+	.byte	0x4
+	.uleb128 .LVL396-.Ltext0
+	.uleb128 .LVL397-.Ltext0
+	.uleb128 0x3
+	.byte	0x8
+	.byte	0x3f
+	.byte	0x9f
+	.byte	0
+.LVUS227:
+	.uleb128 .LVU2238
+	.uleb128 .LVU2241
+.LLST227:
+	.byte	0x4
+	.uleb128 .LVL398-.Ltext0
+	.uleb128 .LVL399-.Ltext0
+	.uleb128 0x1
+	.byte	0x5c
+	.byte	0
+.LVUS228:
+	.uleb128 .LVU2238
+	.uleb128 .LVU2241
+.LLST228:
+	.byte	0x4
+	.uleb128 .LVL398-.Ltext0
+	.uleb128 .LVL399-.Ltext0
+	.uleb128 0x3
+	.byte	0x8
+	.byte	0x20
+	.byte	0x9f
+	.byte	0
+.LVUS229:
+	.uleb128 .LVU2248
+	.uleb128 .LVU2251
+.LLST229:
+	.byte	0x4
+	.uleb128 .LVL400-.Ltext0
+	.uleb128 .LVL401-.Ltext0
+	.uleb128 0x2
+	.byte	0x48
+	.byte	0x9f
+	.byte	0
+.LVUS230:
+	.uleb128 .LVU2258
+	.uleb128 .LVU2261
+.LLST230:
+	.byte	0x4
+	.uleb128 .LVL402-.Ltext0
+	.uleb128 .LVL403-.Ltext0
+	.uleb128 0x2
+	.byte	0x40
+	.byte	0x9f
+	.byte	0
+.LVUS231:
+	.uleb128 .LVU2268
+	.uleb128 .LVU2271
+.LLST231:
+	.byte	0x4
+	.uleb128 .LVL404-.Ltext0
+	.uleb128 .LVL405-.Ltext0
+	.uleb128 0x3
+	.byte	0x8
+	.byte	0x3f
+	.byte	0x9f
+	.byte	0
+.LVUS232:
+	.uleb128 .LVU2280
+	.uleb128 .LVU2283
+.LLST232:
+	.byte	0x4
+	.uleb128 .LVL406-.Ltext0
+	.uleb128 .LVL407-.Ltext0
+	.uleb128 0x3
+	.byte	0x8
+	.byte	0x20
+	.byte	0x9f
+	.byte	0
+.LVUS233:
+	.uleb128 .LVU2290
+	.uleb128 .LVU2293
+.LLST233:
+	.byte	0x4
+	.uleb128 .LVL408-.Ltext0
+	.uleb128 .LVL409-.Ltext0
+	.uleb128 0x2
+	.byte	0x48
+	.byte	0x9f
+	.byte	0
+.LVUS234:
+	.uleb128 .LVU2300
+	.uleb128 .LVU2302
+.LLST234:
+	.byte	0x4
+	.uleb128 .LVL410-.Ltext0
+	.uleb128 .LVL410-.Ltext0
+	.uleb128 0x2
+	.byte	0x40
+	.byte	0x9f
+	.byte	0
+.LVUS235:
+	.uleb128 .LVU2309
+	.uleb128 .LVU2312
+.LLST235:
+	.byte	0x4
+	.uleb128 .LVL411-.Ltext0
+	.uleb128 .LVL412-.Ltext0
+	.uleb128 0x3
+	.byte	0x8
+	.byte	0x3f
+	.byte	0x9f
+	.byte	0
+.LVUS236:
+	.uleb128 .LVU2324
+	.uleb128 .LVU2327
+.LLST236:
+	.byte	0x4
+	.uleb128 .LVL413-.Ltext0
+	.uleb128 .LVL414-.Ltext0
+	.uleb128 0x3
+	.byte	0x8
+	.byte	0x20
+	.byte	0x9f
+	.byte	0
+.LVUS237:
+	.uleb128 .LVU2334
+	.uleb128 .LVU2337
+.LLST237:
+	.byte	0x4
+	.uleb128 .LVL415-.Ltext0
+	.uleb128 .LVL416-.Ltext0
+	.uleb128 0x2
+	.byte	0x48
+	.byte	0x9f
+	.byte	0
+.LVUS238:
+	.uleb128 .LVU2344
+	.uleb128 .LVU2347
+.LLST238:
+	.byte	0x4
+	.uleb128 .LVL417-.Ltext0
+	.uleb128 .LVL418-.Ltext0
+	.uleb128 0x2
+	.byte	0x40
+	.byte	0x9f
+	.byte	0
+.LVUS239:
+	.uleb128 .LVU2354
+	.uleb128 .LVU2357
+.LLST239:
+	.byte	0x4
+	.uleb128 .LVL419-.Ltext0
+	.uleb128 .LVL420-.Ltext0
+	.uleb128 0x3
+	.byte	0x8
+	.byte	0x3f
+	.byte	0x9f
+	.byte	0
+.LVUS240:
+	.uleb128 .LVU2368
+	.uleb128 .LVU2371
+.LLST240:
+	.byte	0x4
+	.uleb128 .LVL421-.Ltext0
+	.uleb128 .LVL422-.Ltext0
+	.uleb128 0x3
+	.byte	0x8
+	.byte	0x20
+	.byte	0x9f
+	.byte	0
+.LVUS241:
+	.uleb128 .LVU2378
+	.uleb128 .LVU2381
+.LLST241:
+	.byte	0x4
+	.uleb128 .LVL423-.Ltext0
+	.uleb128 .LVL424-.Ltext0
+	.uleb128 0x2
+	.byte	0x48
+	.byte	0x9f
+	.byte	0
+.LVUS242:
+	.uleb128 .LVU2388
+	.uleb128 .LVU2391
+.LLST242:
+	.byte	0x4
+	.uleb128 .LVL425-.Ltext0
+	.uleb128 .LVL426-.Ltext0
+	.uleb128 0x2
+	.byte	0x40
+	.byte	0x9f
+	.byte	0
+.LVUS243:
+	.uleb128 .LVU2398
+	.uleb128 .LVU2401
+.LLST243:
+	.byte	0x4
+	.uleb128 .LVL427-.Ltext0
+	.uleb128 .LVL428-.Ltext0
+	.uleb128 0x3
+	.byte	0x8
+	.byte	0x3f
+	.byte	0x9f
+	.byte	0
+.LVUS244:
+	.uleb128 .LVU2410
+	.uleb128 .LVU2413
+.LLST244:
+	.byte	0x4
+	.uleb128 .LVL429-.Ltext0
+	.uleb128 .LVL430-.Ltext0
+	.uleb128 0x3
+	.byte	0x8
+	.byte	0x20
+	.byte	0x9f
+	.byte	0
+.LVUS245:
+	.uleb128 .LVU2420
+	.uleb128 .LVU2423
+.LLST245:
+	.byte	0x4
+	.uleb128 .LVL431-.Ltext0
+	.uleb128 .LVL432-.Ltext0
+	.uleb128 0x2
+	.byte	0x48
+	.byte	0x9f
+	.byte	0
+.LVUS246:
+	.uleb128 .LVU2430
+	.uleb128 .LVU2433
+.LLST246:
+	.byte	0x4
+	.uleb128 .LVL433-.Ltext0
+	.uleb128 .LVL434-.Ltext0
+	.uleb128 0x2
+	.byte	0x40
+	.byte	0x9f
+	.byte	0
+.LVUS247:
+	.uleb128 .LVU2440
+	.uleb128 .LVU2443
+.LLST247:
+	.byte	0x4
+	.uleb128 .LVL435-.Ltext0
+	.uleb128 .LVL436-.Ltext0
+	.uleb128 0x3
+	.byte	0x8
+	.byte	0x3f
+	.byte	0x9f
+	.byte	0
+.LVUS248:
+	.uleb128 .LVU2454
+	.uleb128 .LVU2457
+.LLST248:
+	.byte	0x4
+	.uleb128 .LVL437-.Ltext0
+	.uleb128 .LVL438-.Ltext0
+	.uleb128 0x3
+	.byte	0x8
+	.byte	0x20
+	.byte	0x9f
+	.byte	0
+.LVUS249:
+	.uleb128 .LVU2464
+	.uleb128 .LVU2467
+.LLST249:
+	.byte	0x4
+	.uleb128 .LVL439-.Ltext0
+	.uleb128 .LVL440-.Ltext0
+	.uleb128 0x2
+	.byte	0x48
+	.byte	0x9f
+	.byte	0
+.LVUS250:
+	.uleb128 .LVU2474
+	.uleb128 .LVU2477
+.LLST250:
+	.byte	0x4
+	.uleb128 .LVL441-.Ltext0
+	.uleb128 .LVL442-.Ltext0
+	.uleb128 0x2
+	.byte	0x40
+	.byte	0x9f
+	.byte	0
+.LVUS251:
+	.uleb128 .LVU2484
+	.uleb128 .LVU2486
+.LLST251:
+	.byte	0x4
+	.uleb128 .LVL443-.Ltext0
+	.uleb128 .LVL443-.Ltext0
+	.uleb128 0x3
+	.byte	0x8
+	.byte	0x3f
+	.byte	0x9f
+	.byte	0
+.LVUS252:
+	.uleb128 .LVU2497
+	.uleb128 .LVU2500
+.LLST252:
+	.byte	0x4
+	.uleb128 .LVL444-.Ltext0
+	.uleb128 .LVL445-.Ltext0
+	.uleb128 0x3
+	.byte	0x8
+	.byte	0x20
+	.byte	0x9f
+	.byte	0
+.LVUS253:
+	.uleb128 .LVU2507
+	.uleb128 .LVU2510
+.LLST253:
+	.byte	0x4
+	.uleb128 .LVL446-.Ltext0
+	.uleb128 .LVL447-.Ltext0
+	.uleb128 0x2
+	.byte	0x48
+	.byte	0x9f
+	.byte	0
+.LVUS254:
+	.uleb128 .LVU2517
+	.uleb128 .LVU2520
+.LLST254:
+	.byte	0x4
+	.uleb128 .LVL448-.Ltext0
+	.uleb128 .LVL449-.Ltext0
+	.uleb128 0x2
+	.byte	0x40
+	.byte	0x9f
+	.byte	0
+.LVUS255:
+	.uleb128 .LVU2527
+	.uleb128 .LVU2530
+.LLST255:
+	.byte	0x4
+	.uleb128 .LVL450-.Ltext0
+	.uleb128 .LVL451-.Ltext0
+	.uleb128 0x3
+	.byte	0x8
+	.byte	0x3f
+	.byte	0x9f
+	.byte	0
+.LVUS257:
+	.uleb128 .LVU2538
+	.uleb128 .LVU2541
+	.uleb128 .LVU2541
+	.uleb128 .LVU2543
+.LLST257:
+	.byte	0x4
+	.uleb128 .LVL452-.Ltext0
+	.uleb128 .LVL453-.Ltext0
+	.uleb128 0x6
+	.byte	0x71
+	.sleb128 0
+	.byte	0x7d
+	.sleb128 0
+	.byte	0x27
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL453-.Ltext0
+	.uleb128 .LVL454-.Ltext0
+	.uleb128 0x1
+	.byte	0x5d
+	.byte	0
+.LVUS258:
+	.uleb128 .LVU2538
+	.uleb128 .LVU2543
+.LLST258:
+	.byte	0x4
+	.uleb128 .LVL452-.Ltext0
+	.uleb128 .LVL454-.Ltext0
+	.uleb128 0x3
+	.byte	0x8
+	.byte	0x20
+	.byte	0x9f
+	.byte	0
+.LVUS259:
+	.uleb128 .LVU2552
+	.uleb128 .LVU2555
+.LLST259:
+	.byte	0x4
+	.uleb128 .LVL455-.Ltext0
+	.uleb128 .LVL456-.Ltext0
+	.uleb128 0x2
+	.byte	0x48
+	.byte	0x9f
+	.byte	0
+.LVUS260:
+	.uleb128 .LVU2562
+	.uleb128 .LVU2565
+.LLST260:
+	.byte	0x4
+	.uleb128 .LVL457-.Ltext0
+	.uleb128 .LVL458-.Ltext0
+	.uleb128 0x2
+	.byte	0x40
+	.byte	0x9f
+	.byte	0
+.LVUS261:
+	.uleb128 .LVU2572
+	.uleb128 .LVU2575
+.LLST261:
+	.byte	0x4
+	.uleb128 .LVL459-.Ltext0
+	.uleb128 .LVL460-.Ltext0
+	.uleb128 0x3
+	.byte	0x8
+	.byte	0x3f
+	.byte	0x9f
+	.byte	0
+.LVUS262:
+	.uleb128 .LVU2584
+	.uleb128 .LVU2587
+.LLST262:
+	.byte	0x4
+	.uleb128 .LVL461-.Ltext0
+	.uleb128 .LVL462-.Ltext0
+	.uleb128 0x1
+	.byte	0x5c
+	.byte	0
+.LVUS263:
+	.uleb128 .LVU2584
+	.uleb128 .LVU2587
+.LLST263:
+	.byte	0x4
+	.uleb128 .LVL461-.Ltext0
+	.uleb128 .LVL462-.Ltext0
+	.uleb128 0x3
+	.byte	0x8
+	.byte	0x20
+	.byte	0x9f
+	.byte	0
+.LVUS264:
+	.uleb128 .LVU2594
+	.uleb128 .LVU2597
+.LLST264:
+	.byte	0x4
+	.uleb128 .LVL463-.Ltext0
+	.uleb128 .LVL464-.Ltext0
+	.uleb128 0x2
+	.byte	0x48
+	.byte	0x9f
+	.byte	0
+.LVUS265:
+	.uleb128 .LVU2604
+	.uleb128 .LVU2607
+.LLST265:
+	.byte	0x4
+	.uleb128 .LVL465-.Ltext0
+	.uleb128 .LVL466-.Ltext0
+	.uleb128 0x2
+	.byte	0x40
+	.byte	0x9f
+	.byte	0
+.LVUS266:
+	.uleb128 .LVU2614
+	.uleb128 .LVU2617
+.LLST266:
+	.byte	0x4
+	.uleb128 .LVL467-.Ltext0
+	.uleb128 .LVL468-.Ltext0
+	.uleb128 0x3
+	.byte	0x8
+	.byte	0x3f
+	.byte	0x9f
+	.byte	0
+.LVUS267:
+	.uleb128 .LVU2626
+	.uleb128 .LVU2629
+.LLST267:
+	.byte	0x4
+	.uleb128 .LVL469-.Ltext0
+	.uleb128 .LVL470-.Ltext0
+	.uleb128 0x3
+	.byte	0x8
+	.byte	0x20
+	.byte	0x9f
+	.byte	0
+.LVUS268:
+	.uleb128 .LVU2636
+	.uleb128 .LVU2639
+.LLST268:
+	.byte	0x4
+	.uleb128 .LVL471-.Ltext0
+	.uleb128 .LVL472-.Ltext0
+	.uleb128 0x2
+	.byte	0x48
+	.byte	0x9f
+	.byte	0
+.LVUS269:
+	.uleb128 .LVU2646
+	.uleb128 .LVU2648
+.LLST269:
+	.byte	0x4
+	.uleb128 .LVL473-.Ltext0
+	.uleb128 .LVL473-.Ltext0
+	.uleb128 0x2
+	.byte	0x40
+	.byte	0x9f
+	.byte	0
+.LVUS271:
+	.uleb128 .LVU2656
+	.uleb128 .LVU2658
+.LLST271:
+	.byte	0x4
+	.uleb128 .LVL474-.Ltext0
+	.uleb128 .LVL474-.Ltext0
+	.uleb128 0x3
+	.byte	0x8
+	.byte	0x3f
+	.byte	0x9f
+	.byte	0
+.LVUS272:
+	.uleb128 .LVU2668
+	.uleb128 .LVU2671
+.LLST272:
+	.byte	0x4
+	.uleb128 .LVL475-.Ltext0
+	.uleb128 .LVL476-.Ltext0
+	.uleb128 0x3
+	.byte	0x8
+	.byte	0x20
+	.byte	0x9f
+	.byte	0
+.LVUS273:
+	.uleb128 .LVU2678
+	.uleb128 .LVU2681
+.LLST273:
+	.byte	0x4
+	.uleb128 .LVL477-.Ltext0
+	.uleb128 .LVL478-.Ltext0
+	.uleb128 0x2
+	.byte	0x48
+	.byte	0x9f
+	.byte	0
+.LVUS274:
+	.uleb128 .LVU2688
+	.uleb128 .LVU2691
+.LLST274:
+	.byte	0x4
+	.uleb128 .LVL479-.Ltext0
+	.uleb128 .LVL480-.Ltext0
+	.uleb128 0x2
+	.byte	0x40
+	.byte	0x9f
+	.byte	0
+.LVUS275:
+	.uleb128 .LVU2698
+	.uleb128 .LVU2701
+.LLST275:
+	.byte	0x4
+	.uleb128 .LVL481-.Ltext0
+	.uleb128 .LVL482-.Ltext0
+	.uleb128 0x3
+	.byte	0x8
+	.byte	0x3f
+	.byte	0x9f
+	.byte	0
+.LVUS276:
+	.uleb128 .LVU2712
+	.uleb128 .LVU2715
+.LLST276:
+	.byte	0x4
+	.uleb128 .LVL483-.Ltext0
+	.uleb128 .LVL484-.Ltext0
+	.uleb128 0x3
+	.byte	0x8
+	.byte	0x20
+	.byte	0x9f
+	.byte	0
+.LVUS277:
+	.uleb128 .LVU2723
+	.uleb128 .LVU2726
+.LLST277:
+	.byte	0x4
+	.uleb128 .LVL485-.Ltext0
+	.uleb128 .LVL486-.Ltext0
+	.uleb128 0x2
+	.byte	0x48
+	.byte	0x9f
+	.byte	0
+.LVUS278:
+	.uleb128 .LVU2733
+	.uleb128 .LVU2736
+.LLST278:
+	.byte	0x4
+	.uleb128 .LVL487-.Ltext0
+	.uleb128 .LVL488-.Ltext0
+	.uleb128 0x2
+	.byte	0x40
+	.byte	0x9f
+	.byte	0
+.LVUS279:
+	.uleb128 .LVU2743
+	.uleb128 .LVU2746
+.LLST279:
+	.byte	0x4
+	.uleb128 .LVL489-.Ltext0
+	.uleb128 .LVL490-.Ltext0
+	.uleb128 0x3
+	.byte	0x8
+	.byte	0x3f
+	.byte	0x9f
+	.byte	0
+.LVUS280:
+	.uleb128 .LVU2755
+	.uleb128 .LVU2758
+.LLST280:
+	.byte	0x4
+	.uleb128 .LVL491-.Ltext0
+	.uleb128 .LVL492-.Ltext0
+	.uleb128 0x3
+	.byte	0x8
+	.byte	0x20
+	.byte	0x9f
+	.byte	0
+.LVUS281:
+	.uleb128 .LVU2765
+	.uleb128 .LVU2768
+.LLST281:
+	.byte	0x4
+	.uleb128 .LVL493-.Ltext0
+	.uleb128 .LVL494-.Ltext0
+	.uleb128 0x2
+	.byte	0x48
+	.byte	0x9f
+	.byte	0
+.LVUS282:
+	.uleb128 .LVU2775
+	.uleb128 .LVU2778
+.LLST282:
+	.byte	0x4
+	.uleb128 .LVL495-.Ltext0
+	.uleb128 .LVL496-.Ltext0
+	.uleb128 0x2
+	.byte	0x40
+	.byte	0x9f
+	.byte	0
+.LVUS283:
+	.uleb128 .LVU2785
+	.uleb128 .LVU2788
+.LLST283:
+	.byte	0x4
+	.uleb128 .LVL497-.Ltext0
+	.uleb128 .LVL498-.Ltext0
+	.uleb128 0x3
+	.byte	0x8
+	.byte	0x3f
+	.byte	0x9f
+	.byte	0
+.LVUS284:
+	.uleb128 .LVU2799
+	.uleb128 .LVU2802
+.LLST284:
+	.byte	0x4
+	.uleb128 .LVL499-.Ltext0
+	.uleb128 .LVL500-.Ltext0
+	.uleb128 0x3
+	.byte	0x8
+	.byte	0x20
+	.byte	0x9f
+	.byte	0
+.LVUS285:
+	.uleb128 .LVU2809
+	.uleb128 .LVU2812
+.LLST285:
+	.byte	0x4
+	.uleb128 .LVL501-.Ltext0
+	.uleb128 .LVL502-.Ltext0
+	.uleb128 0x2
+	.byte	0x48
+	.byte	0x9f
+	.byte	0
+.LVUS286:
+	.uleb128 .LVU2819
+	.uleb128 .LVU2822
+.LLST286:
+	.byte	0x4
+	.uleb128 .LVL503-.Ltext0
+	.uleb128 .LVL504-.Ltext0
+	.uleb128 0x2
+	.byte	0x40
+	.byte	0x9f
+	.byte	0
+.LVUS287:
+	.uleb128 .LVU2829
+	.uleb128 .LVU2831
+.LLST287:
+	.byte	0x4
+	.uleb128 .LVL505-.Ltext0
+	.uleb128 .LVL505-.Ltext0
+	.uleb128 0x3
+	.byte	0x8
+	.byte	0x3f
+	.byte	0x9f
+	.byte	0
+.LVUS288:
+	.uleb128 .LVU2842
+	.uleb128 .LVU2845
+.LLST288:
+	.byte	0x4
+	.uleb128 .LVL506-.Ltext0
+	.uleb128 .LVL507-.Ltext0
+	.uleb128 0x3
+	.byte	0x8
+	.byte	0x20
+	.byte	0x9f
+	.byte	0
+.LVUS289:
+	.uleb128 .LVU2852
+	.uleb128 .LVU2855
+.LLST289:
+	.byte	0x4
+	.uleb128 .LVL508-.Ltext0
+	.uleb128 .LVL509-.Ltext0
+	.uleb128 0x2
+	.byte	0x48
+	.byte	0x9f
+	.byte	0
+.LVUS290:
+	.uleb128 .LVU2862
+	.uleb128 .LVU2865
+.LLST290:
+	.byte	0x4
+	.uleb128 .LVL510-.Ltext0
+	.uleb128 .LVL511-.Ltext0
+	.uleb128 0x2
+	.byte	0x40
+	.byte	0x9f
+	.byte	0
+.LVUS291:
+	.uleb128 .LVU2872
+	.uleb128 .LVU2875
+.LLST291:
+	.byte	0x4
+	.uleb128 .LVL512-.Ltext0
+	.uleb128 .LVL513-.Ltext0
+	.uleb128 0x3
+	.byte	0x8
+	.byte	0x3f
+	.byte	0x9f
+	.byte	0
+.LVUS292:
+	.uleb128 .LVU2886
+	.uleb128 .LVU2889
+.LLST292:
+	.byte	0x4
+	.uleb128 .LVL514-.Ltext0
+	.uleb128 .LVL515-.Ltext0
+	.uleb128 0x3
+	.byte	0x8
+	.byte	0x20
+	.byte	0x9f
+	.byte	0
+.LVUS293:
+	.uleb128 .LVU2896
+	.uleb128 .LVU2899
+.LLST293:
+	.byte	0x4
+	.uleb128 .LVL516-.Ltext0
+	.uleb128 .LVL517-.Ltext0
+	.uleb128 0x2
+	.byte	0x48
+	.byte	0x9f
+	.byte	0
+.LVUS294:
+	.uleb128 .LVU2906
+	.uleb128 .LVU2909
+.LLST294:
+	.byte	0x4
+	.uleb128 .LVL518-.Ltext0
+	.uleb128 .LVL519-.Ltext0
+	.uleb128 0x2
+	.byte	0x40
+	.byte	0x9f
+	.byte	0
+.LVUS296:
+	.uleb128 .LVU2917
+	.uleb128 .LVU2921
+.LLST296:
+	.byte	0x4
+	.uleb128 .LVL520-.Ltext0
+	.uleb128 .LVL521-.Ltext0
+	.uleb128 0x3
+	.byte	0x8
+	.byte	0x3f
+	.byte	0x9f
+	.byte	0
+.LVUS297:
+	.uleb128 .LVU2930
+	.uleb128 .LVU2933
+.LLST297:
+	.byte	0x4
+	.uleb128 .LVL522-.Ltext0
+	.uleb128 .LVL523-.Ltext0
+	.uleb128 0x1
+	.byte	0x5c
+	.byte	0
+.LVUS298:
+	.uleb128 .LVU2930
+	.uleb128 .LVU2933
+.LLST298:
+	.byte	0x4
+	.uleb128 .LVL522-.Ltext0
+	.uleb128 .LVL523-.Ltext0
+	.uleb128 0x3
+	.byte	0x8
+	.byte	0x20
+	.byte	0x9f
+	.byte	0
+.LVUS299:
+	.uleb128 .LVU2940
+	.uleb128 .LVU2943
+.LLST299:
+	.byte	0x4
+	.uleb128 .LVL524-.Ltext0
+	.uleb128 .LVL525-.Ltext0
+	.uleb128 0x2
+	.byte	0x48
+	.byte	0x9f
+	.byte	0
+.LVUS300:
+	.uleb128 .LVU2950
+	.uleb128 .LVU2953
+.LLST300:
+	.byte	0x4
+	.uleb128 .LVL526-.Ltext0
+	.uleb128 .LVL527-.Ltext0
+	.uleb128 0x2
+	.byte	0x40
+	.byte	0x9f
+	.byte	0
+.LVUS301:
+	.uleb128 .LVU2960
+	.uleb128 .LVU2963
+.LLST301:
+	.byte	0x4
+	.uleb128 .LVL528-.Ltext0
+	.uleb128 .LVL529-.Ltext0
+	.uleb128 0x3
+	.byte	0x8
+	.byte	0x3f
+	.byte	0x9f
+	.byte	0
+.LVUS302:
+	.uleb128 .LVU2972
+	.uleb128 .LVU2975
+.LLST302:
+	.byte	0x4
+	.uleb128 .LVL530-.Ltext0
+	.uleb128 .LVL531-.Ltext0
+	.uleb128 0x3
+	.byte	0x8
+	.byte	0x20
+	.byte	0x9f
+	.byte	0
+.LVUS303:
+	.uleb128 .LVU2982
+	.uleb128 .LVU2985
+.LLST303:
+	.byte	0x4
+	.uleb128 .LVL532-.Ltext0
+	.uleb128 .LVL533-.Ltext0
+	.uleb128 0x2
+	.byte	0x48
+	.byte	0x9f
+	.byte	0
+.LVUS304:
+	.uleb128 .LVU2992
+	.uleb128 .LVU2994
+.LLST304:
+	.byte	0x4
+	.uleb128 .LVL534-.Ltext0
+	.uleb128 .LVL534-.Ltext0
+	.uleb128 0x2
+	.byte	0x40
+	.byte	0x9f
+	.byte	0
+.LVUS305:
+	.uleb128 .LVU3001
+	.uleb128 .LVU3004
+.LLST305:
+	.byte	0x4
+	.uleb128 .LVL535-.Ltext0
+	.uleb128 .LVL536-.Ltext0
+	.uleb128 0x3
+	.byte	0x8
+	.byte	0x3f
+	.byte	0x9f
+	.byte	0
+.LVUS306:
+	.uleb128 .LVU3015
+	.uleb128 .LVU3018
+.LLST306:
+	.byte	0x4
+	.uleb128 .LVL537-.Ltext0
+	.uleb128 .LVL538-.Ltext0
+	.uleb128 0x3
+	.byte	0x8
+	.byte	0x20
+	.byte	0x9f
+	.byte	0
+.LVUS307:
+	.uleb128 .LVU3025
+	.uleb128 .LVU3028
+.LLST307:
+	.byte	0x4
+	.uleb128 .LVL539-.Ltext0
+	.uleb128 .LVL540-.Ltext0
+	.uleb128 0x2
+	.byte	0x48
+	.byte	0x9f
+	.byte	0
+.LVUS309:
+	.uleb128 .LVU3035
+	.uleb128 .LVU3039
+.LLST309:
+	.byte	0x4
+	.uleb128 .LVL541-.Ltext0
+	.uleb128 .LVL542-.Ltext0
+	.uleb128 0x2
+	.byte	0x40
+	.byte	0x9f
+	.byte	0
+.LVUS310:
+	.uleb128 .LVU3046
+	.uleb128 .LVU3049
+.LLST310:
+	.byte	0x4
+	.uleb128 .LVL543-.Ltext0
+	.uleb128 .LVL544-.Ltext0
+	.uleb128 0x3
+	.byte	0x8
+	.byte	0x3f
+	.byte	0x9f
+	.byte	0
+.LVUS311:
+	.uleb128 .LVU3060
+	.uleb128 .LVU3063
+.LLST311:
+	.byte	0x4
+	.uleb128 .LVL545-.Ltext0
+	.uleb128 .LVL546-.Ltext0
+	.uleb128 0x3
+	.byte	0x8
+	.byte	0x20
+	.byte	0x9f
+	.byte	0
+.LVUS312:
+	.uleb128 .LVU3071
+	.uleb128 .LVU3074
+.LLST312:
+	.byte	0x4
+	.uleb128 .LVL547-.Ltext0
+	.uleb128 .LVL548-.Ltext0
+	.uleb128 0x2
+	.byte	0x48
+	.byte	0x9f
+	.byte	0
+.LVUS313:
+	.uleb128 .LVU3081
+	.uleb128 .LVU3084
+.LLST313:
+	.byte	0x4
+	.uleb128 .LVL549-.Ltext0
+	.uleb128 .LVL550-.Ltext0
+	.uleb128 0x2
+	.byte	0x40
+	.byte	0x9f
+	.byte	0
+.LVUS314:
+	.uleb128 .LVU3091
+	.uleb128 .LVU3094
+.LLST314:
+	.byte	0x4
+	.uleb128 .LVL551-.Ltext0
+	.uleb128 .LVL552-.Ltext0
+	.uleb128 0x3
+	.byte	0x8
+	.byte	0x3f
+	.byte	0x9f
+	.byte	0
+.LVUS315:
+	.uleb128 .LVU3103
+	.uleb128 .LVU3106
+.LLST315:
+	.byte	0x4
+	.uleb128 .LVL553-.Ltext0
+	.uleb128 .LVL554-.Ltext0
+	.uleb128 0x3
+	.byte	0x8
+	.byte	0x20
+	.byte	0x9f
+	.byte	0
+.LVUS316:
+	.uleb128 .LVU3113
+	.uleb128 .LVU3116
+.LLST316:
+	.byte	0x4
+	.uleb128 .LVL555-.Ltext0
+	.uleb128 .LVL556-.Ltext0
+	.uleb128 0x2
+	.byte	0x48
+	.byte	0x9f
+	.byte	0
+.LVUS317:
+	.uleb128 .LVU3123
+	.uleb128 .LVU3126
+.LLST317:
+	.byte	0x4
+	.uleb128 .LVL557-.Ltext0
+	.uleb128 .LVL558-.Ltext0
+	.uleb128 0x2
+	.byte	0x40
+	.byte	0x9f
+	.byte	0
+.LVUS318:
+	.uleb128 .LVU3133
+	.uleb128 .LVU3136
+.LLST318:
+	.byte	0x4
+	.uleb128 .LVL559-.Ltext0
+	.uleb128 .LVL560-.Ltext0
+	.uleb128 0x3
+	.byte	0x8
+	.byte	0x3f
+	.byte	0x9f
+	.byte	0
+.LVUS319:
+	.uleb128 .LVU3147
+	.uleb128 .LVU3150
+.LLST319:
+	.byte	0x4
+	.uleb128 .LVL561-.Ltext0
+	.uleb128 .LVL562-.Ltext0
+	.uleb128 0x3
+	.byte	0x8
+	.byte	0x20
+	.byte	0x9f
+	.byte	0
+.LVUS320:
+	.uleb128 .LVU3157
+	.uleb128 .LVU3160
+.LLST320:
+	.byte	0x4
+	.uleb128 .LVL563-.Ltext0
+	.uleb128 .LVL564-.Ltext0
+	.uleb128 0x2
+	.byte	0x48
+	.byte	0x9f
+	.byte	0
+.LVUS321:
+	.uleb128 .LVU3167
+	.uleb128 .LVU3170
+.LLST321:
+	.byte	0x4
+	.uleb128 .LVL565-.Ltext0
+	.uleb128 .LVL566-.Ltext0
+	.uleb128 0x2
+	.byte	0x40
+	.byte	0x9f
+	.byte	0
+.LVUS322:
+	.uleb128 .LVU3177
+	.uleb128 .LVU3179
+.LLST322:
+	.byte	0x4
+	.uleb128 .LVL567-.Ltext0
+	.uleb128 .LVL567-.Ltext0
+	.uleb128 0x3
+	.byte	0x8
+	.byte	0x3f
+	.byte	0x9f
+	.byte	0
+.LVUS323:
+	.uleb128 .LVU3191
+	.uleb128 .LVU3194
+.LLST323:
+	.byte	0x4
+	.uleb128 .LVL568-.Ltext0
+	.uleb128 .LVL569-.Ltext0
+	.uleb128 0x3
+	.byte	0x8
+	.byte	0x20
+	.byte	0x9f
+	.byte	0
+.LVUS324:
+	.uleb128 .LVU3201
+	.uleb128 .LVU3204
+.LLST324:
+	.byte	0x4
+	.uleb128 .LVL570-.Ltext0
+	.uleb128 .LVL571-.Ltext0
+	.uleb128 0x2
+	.byte	0x48
+	.byte	0x9f
+	.byte	0
+.LVUS325:
+	.uleb128 .LVU3211
+	.uleb128 .LVU3214
+.LLST325:
+	.byte	0x4
+	.uleb128 .LVL572-.Ltext0
+	.uleb128 .LVL573-.Ltext0
+	.uleb128 0x2
+	.byte	0x40
+	.byte	0x9f
+	.byte	0
+.LVUS326:
+	.uleb128 .LVU3221
+	.uleb128 .LVU3224
+.LLST326:
+	.byte	0x4
+	.uleb128 .LVL574-.Ltext0
+	.uleb128 .LVL575-.Ltext0
+	.uleb128 0x3
+	.byte	0x8
+	.byte	0x3f
+	.byte	0x9f
+	.byte	0
+.LVUS327:
+	.uleb128 .LVU3235
+	.uleb128 .LVU3238
+.LLST327:
+	.byte	0x4
+	.uleb128 .LVL576-.Ltext0
+	.uleb128 .LVL577-.Ltext0
+	.uleb128 0x3
+	.byte	0x8
+	.byte	0x20
+	.byte	0x9f
+	.byte	0
+.LVUS328:
+	.uleb128 .LVU3245
+	.uleb128 .LVU3248
+.LLST328:
+	.byte	0x4
+	.uleb128 .LVL578-.Ltext0
+	.uleb128 .LVL579-.Ltext0
+	.uleb128 0x2
+	.byte	0x48
+	.byte	0x9f
+	.byte	0
+.LVUS329:
+	.uleb128 .LVU3255
+	.uleb128 .LVU3258
+.LLST329:
+	.byte	0x4
+	.uleb128 .LVL580-.Ltext0
+	.uleb128 .LVL581-.Ltext0
+	.uleb128 0x2
+	.byte	0x40
+	.byte	0x9f
+	.byte	0
+.LVUS330:
+	.uleb128 .LVU3265
+	.uleb128 .LVU3268
+.LLST330:
+	.byte	0x4
+	.uleb128 .LVL582-.Ltext0
+	.uleb128 .LVL583-.Ltext0
+	.uleb128 0x3
+	.byte	0x8
+	.byte	0x3f
+	.byte	0x9f
+	.byte	0
+.LVUS331:
+	.uleb128 .LVU3277
+	.uleb128 .LVU3280
+.LLST331:
+	.byte	0x4
+	.uleb128 .LVL584-.Ltext0
+	.uleb128 .LVL585-.Ltext0
+	.uleb128 0x1
+	.byte	0x5c
+	.byte	0
+.LVUS332:
+	.uleb128 .LVU3277
+	.uleb128 .LVU3280
+.LLST332:
+	.byte	0x4
+	.uleb128 .LVL584-.Ltext0
+	.uleb128 .LVL585-.Ltext0
+	.uleb128 0x3
+	.byte	0x8
+	.byte	0x20
+	.byte	0x9f
+	.byte	0
+.LVUS333:
+	.uleb128 .LVU3287
+	.uleb128 .LVU3290
+.LLST333:
+	.byte	0x4
+	.uleb128 .LVL586-.Ltext0
+	.uleb128 .LVL587-.Ltext0
+	.uleb128 0x2
+	.byte	0x48
+	.byte	0x9f
+	.byte	0
+.LVUS334:
+	.uleb128 .LVU3297
+	.uleb128 .LVU3300
+.LLST334:
+	.byte	0x4
+	.uleb128 .LVL588-.Ltext0
+	.uleb128 .LVL589-.Ltext0
+	.uleb128 0x2
+	.byte	0x40
+	.byte	0x9f
+	.byte	0
+.LVUS335:
+	.uleb128 .LVU3307
+	.uleb128 .LVU3310
+.LLST335:
+	.byte	0x4
+	.uleb128 .LVL590-.Ltext0
+	.uleb128 .LVL591-.Ltext0
+	.uleb128 0x3
+	.byte	0x8
+	.byte	0x3f
+	.byte	0x9f
+	.byte	0
+.LVUS336:
+	.uleb128 .LVU3319
+	.uleb128 .LVU3322
+.LLST336:
+	.byte	0x4
+	.uleb128 .LVL592-.Ltext0
+	.uleb128 .LVL593-.Ltext0
+	.uleb128 0x3
+	.byte	0x8
+	.byte	0x20
+	.byte	0x9f
+	.byte	0
+.LVUS337:
+	.uleb128 .LVU3329
+	.uleb128 .LVU3332
+.LLST337:
+	.byte	0x4
+	.uleb128 .LVL594-.Ltext0
+	.uleb128 .LVL595-.Ltext0
+	.uleb128 0x2
+	.byte	0x48
+	.byte	0x9f
+	.byte	0
+.LVUS338:
+	.uleb128 .LVU3339
+	.uleb128 .LVU3341
+.LLST338:
+	.byte	0x4
+	.uleb128 .LVL596-.Ltext0
+	.uleb128 .LVL596-.Ltext0
+	.uleb128 0x2
+	.byte	0x40
+	.byte	0x9f
+	.byte	0
+.LVUS339:
+	.uleb128 .LVU3348
+	.uleb128 .LVU3351
+.LLST339:
+	.byte	0x4
+	.uleb128 .LVL597-.Ltext0
+	.uleb128 .LVL598-.Ltext0
+	.uleb128 0x3
+	.byte	0x8
+	.byte	0x3f
+	.byte	0x9f
+	.byte	0
+.LVUS340:
+	.uleb128 .LVU3362
+	.uleb128 .LVU3365
+.LLST340:
+	.byte	0x4
+	.uleb128 .LVL599-.Ltext0
+	.uleb128 .LVL600-.Ltext0
+	.uleb128 0x3
+	.byte	0x8
+	.byte	0x20
+	.byte	0x9f
+	.byte	0
+.LVUS341:
+	.uleb128 .LVU3372
+	.uleb128 .LVU3375
+.LLST341:
+	.byte	0x4
+	.uleb128 .LVL601-.Ltext0
+	.uleb128 .LVL602-.Ltext0
+	.uleb128 0x2
+	.byte	0x48
+	.byte	0x9f
+	.byte	0
+.LVUS342:
+	.uleb128 .LVU3382
+	.uleb128 .LVU3385
+.LLST342:
+	.byte	0x4
+	.uleb128 .LVL603-.Ltext0
+	.uleb128 .LVL604-.Ltext0
+	.uleb128 0x2
+	.byte	0x40
+	.byte	0x9f
+	.byte	0
+.LVUS343:
+	.uleb128 .LVU3392
+	.uleb128 .LVU3395
+.LLST343:
+	.byte	0x4
+	.uleb128 .LVL605-.Ltext0
+	.uleb128 .LVL606-.Ltext0
+	.uleb128 0x3
+	.byte	0x8
+	.byte	0x3f
+	.byte	0x9f
+	.byte	0
+.LVUS345:
+	.uleb128 .LVU3403
+	.uleb128 .LVU3406
+	.uleb128 .LVU3406
+	.uleb128 .LVU3408
+.LLST345:
+	.byte	0x4
+	.uleb128 .LVL607-.Ltext0
+	.uleb128 .LVL608-.Ltext0
+	.uleb128 0x6
+	.byte	0x71
+	.sleb128 0
+	.byte	0x72
+	.sleb128 0
+	.byte	0x27
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL608-.Ltext0
+	.uleb128 .LVL609-.Ltext0
+	.uleb128 0x1
+	.byte	0x52
+	.byte	0
+.LVUS346:
+	.uleb128 .LVU3403
+	.uleb128 .LVU3408
+.LLST346:
+	.byte	0x4
+	.uleb128 .LVL607-.Ltext0
+	.uleb128 .LVL609-.Ltext0
+	.uleb128 0x3
+	.byte	0x8
+	.byte	0x20
+	.byte	0x9f
+	.byte	0
+.LVUS347:
+	.uleb128 .LVU3417
+	.uleb128 .LVU3420
+.LLST347:
+	.byte	0x4
+	.uleb128 .LVL610-.Ltext0
+	.uleb128 .LVL611-.Ltext0
+	.uleb128 0x2
+	.byte	0x48
+	.byte	0x9f
+	.byte	0
+.LVUS348:
+	.uleb128 .LVU3427
+	.uleb128 .LVU3430
+.LLST348:
+	.byte	0x4
+	.uleb128 .LVL612-.Ltext0
+	.uleb128 .LVL613-.Ltext0
+	.uleb128 0x2
+	.byte	0x40
+	.byte	0x9f
+	.byte	0
+.LVUS349:
+	.uleb128 .LVU3437
+	.uleb128 .LVU3440
+.LLST349:
+	.byte	0x4
+	.uleb128 .LVL614-.Ltext0
+	.uleb128 .LVL615-.Ltext0
+	.uleb128 0x3
+	.byte	0x8
+	.byte	0x3f
+	.byte	0x9f
+	.byte	0
+.LVUS350:
+	.uleb128 .LVU3449
+	.uleb128 .LVU3452
+.LLST350:
+	.byte	0x4
+	.uleb128 .LVL616-.Ltext0
+	.uleb128 .LVL617-.Ltext0
+	.uleb128 0x3
+	.byte	0x8
+	.byte	0x20
+	.byte	0x9f
+	.byte	0
+.LVUS351:
+	.uleb128 .LVU3459
+	.uleb128 .LVU3462
+.LLST351:
+	.byte	0x4
+	.uleb128 .LVL618-.Ltext0
+	.uleb128 .LVL619-.Ltext0
+	.uleb128 0x2
+	.byte	0x48
+	.byte	0x9f
+	.byte	0
+.LVUS352:
+	.uleb128 .LVU3469
+	.uleb128 .LVU3472
+.LLST352:
+	.byte	0x4
+	.uleb128 .LVL620-.Ltext0
+	.uleb128 .LVL621-.Ltext0
+	.uleb128 0x2
+	.byte	0x40
+	.byte	0x9f
+	.byte	0
+.LVUS353:
+	.uleb128 .LVU3479
+	.uleb128 .LVU3482
+.LLST353:
+	.byte	0x4
+	.uleb128 .LVL622-.Ltext0
+	.uleb128 .LVL623-.Ltext0
+	.uleb128 0x3
+	.byte	0x8
+	.byte	0x3f
+	.byte	0x9f
+	.byte	0
+.LVUS354:
+	.uleb128 .LVU3493
+	.uleb128 .LVU3496
+.LLST354:
+	.byte	0x4
+	.uleb128 .LVL624-.Ltext0
+	.uleb128 .LVL625-.Ltext0
+	.uleb128 0x3
+	.byte	0x8
+	.byte	0x20
+	.byte	0x9f
+	.byte	0
+.LVUS355:
+	.uleb128 .LVU3503
+	.uleb128 .LVU3506
+.LLST355:
+	.byte	0x4
+	.uleb128 .LVL626-.Ltext0
+	.uleb128 .LVL627-.Ltext0
+	.uleb128 0x2
+	.byte	0x48
+	.byte	0x9f
+	.byte	0
+.LVUS356:
+	.uleb128 .LVU3513
+	.uleb128 .LVU3516
+.LLST356:
+	.byte	0x4
+	.uleb128 .LVL628-.Ltext0
+	.uleb128 .LVL629-.Ltext0
+	.uleb128 0x2
+	.byte	0x40
+	.byte	0x9f
+	.byte	0
+.LVUS358:
+	.uleb128 .LVU3524
+	.uleb128 .LVU3526
+.LLST358:
+	.byte	0x4
+	.uleb128 .LVL630-.Ltext0
+	.uleb128 .LVL630-.Ltext0
+	.uleb128 0x3
+	.byte	0x8
+	.byte	0x3f
+	.byte	0x9f
+	.byte	0
+.LVUS359:
+	.uleb128 .LVU3535
+	.uleb128 .LVU3538
+.LLST359:
+	.byte	0x4
+	.uleb128 .LVL631-.Ltext0
+	.uleb128 .LVL632-.Ltext0
+	.uleb128 0x3
+	.byte	0x8
+	.byte	0x20
+	.byte	0x9f
+	.byte	0
+.LVUS360:
+	.uleb128 .LVU3545
+	.uleb128 .LVU3548
+.LLST360:
+	.byte	0x4
+	.uleb128 .LVL633-.Ltext0
+	.uleb128 .LVL634-.Ltext0
+	.uleb128 0x2
+	.byte	0x48
+	.byte	0x9f
+	.byte	0
+.LVUS361:
+	.uleb128 .LVU3555
+	.uleb128 .LVU3558
+.LLST361:
+	.byte	0x4
+	.uleb128 .LVL635-.Ltext0
+	.uleb128 .LVL636-.Ltext0
+	.uleb128 0x2
+	.byte	0x40
+	.byte	0x9f
+	.byte	0
+.LVUS362:
+	.uleb128 .LVU3565
+	.uleb128 .LVU3568
+.LLST362:
+	.byte	0x4
+	.uleb128 .LVL637-.Ltext0
+	.uleb128 .LVL638-.Ltext0
+	.uleb128 0x3
+	.byte	0x8
+	.byte	0x3f
+	.byte	0x9f
+	.byte	0
+.LVUS363:
+	.uleb128 .LVU3580
+	.uleb128 .LVU3583
+.LLST363:
+	.byte	0x4
+	.uleb128 .LVL639-.Ltext0
+	.uleb128 .LVL640-.Ltext0
+	.uleb128 0x3
+	.byte	0x8
+	.byte	0x20
+	.byte	0x9f
+	.byte	0
+.LVUS364:
+	.uleb128 .LVU3590
+	.uleb128 .LVU3593
+.LLST364:
+	.byte	0x4
+	.uleb128 .LVL641-.Ltext0
+	.uleb128 .LVL642-.Ltext0
+	.uleb128 0x2
+	.byte	0x48
+	.byte	0x9f
+	.byte	0
+.LVUS365:
+	.uleb128 .LVU3600
+	.uleb128 .LVU3602
+.LLST365:
+	.byte	0x4
+	.uleb128 .LVL643-.Ltext0
+	.uleb128 .LVL643-.Ltext0
+	.uleb128 0x2
+	.byte	0x40
+	.byte	0x9f
+	.byte	0
+.LVUS366:
+	.uleb128 .LVU3609
+	.uleb128 .LVU3612
+.LLST366:
+	.byte	0x4
+	.uleb128 .LVL644-.Ltext0
+	.uleb128 .LVL645-.Ltext0
+	.uleb128 0x3
+	.byte	0x8
+	.byte	0x3f
+	.byte	0x9f
+	.byte	0
+.LVUS368:
+	.uleb128 .LVU3621
+	.uleb128 .LVU3624
+	.uleb128 .LVU3624
+	.uleb128 .LVU3625
+.LLST368:
+	.byte	0x4
+	.uleb128 .LVL646-.Ltext0
+	.uleb128 .LVL647-.Ltext0
+	.uleb128 0x6
+	.byte	0x71
+	.sleb128 0
+	.byte	0x7a
+	.sleb128 0
+	.byte	0x27
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL647-.Ltext0
+	.uleb128 .LVL648-.Ltext0
+	.uleb128 0x1
+	.byte	0x5a
+	.byte	0
+.LVUS369:
+	.uleb128 .LVU3621
+	.uleb128 .LVU3625
+.LLST369:
+	.byte	0x4
+	.uleb128 .LVL646-.Ltext0
+	.uleb128 .LVL648-.Ltext0
+	.uleb128 0x3
+	.byte	0x8
+	.byte	0x20
+	.byte	0x9f
+	.byte	0
+.LVUS370:
+	.uleb128 .LVU3632
+	.uleb128 .LVU3635
+.LLST370:
+	.byte	0x4
+	.uleb128 .LVL649-.Ltext0
+	.uleb128 .LVL650-.Ltext0
+	.uleb128 0x2
+	.byte	0x48
+	.byte	0x9f
+	.byte	0
+.LVUS371:
+	.uleb128 .LVU3642
+	.uleb128 .LVU3645
+.LLST371:
+	.byte	0x4
+	.uleb128 .LVL651-.Ltext0
+	.uleb128 .LVL652-.Ltext0
+	.uleb128 0x2
+	.byte	0x40
+	.byte	0x9f
+	.byte	0
+.LVUS372:
+	.uleb128 .LVU3652
+	.uleb128 .LVU3655
+.LLST372:
+	.byte	0x4
+	.uleb128 .LVL653-.Ltext0
+	.uleb128 .LVL654-.Ltext0
+	.uleb128 0x3
+	.byte	0x8
+	.byte	0x3f
+	.byte	0x9f
+	.byte	0
+.LVUS373:
+	.uleb128 .LVU3664
+	.uleb128 .LVU3667
+.LLST373:
+	.byte	0x4
+	.uleb128 .LVL655-.Ltext0
+	.uleb128 .LVL656-.Ltext0
+	.uleb128 0x3
+	.byte	0x8
+	.byte	0x20
+	.byte	0x9f
+	.byte	0
+.LVUS374:
+	.uleb128 .LVU3674
+	.uleb128 .LVU3677
+.LLST374:
+	.byte	0x4
+	.uleb128 .LVL657-.Ltext0
+	.uleb128 .LVL658-.Ltext0
+	.uleb128 0x2
+	.byte	0x48
+	.byte	0x9f
+	.byte	0
+.LVUS375:
+	.uleb128 .LVU3684
+	.uleb128 .LVU3686
+.LLST375:
+	.byte	0x4
+	.uleb128 .LVL659-.Ltext0
+	.uleb128 .LVL659-.Ltext0
+	.uleb128 0x2
+	.byte	0x40
+	.byte	0x9f
+	.byte	0
+.LVUS376:
+	.uleb128 .LVU3693
+	.uleb128 .LVU3695
+.LLST376:
+	.byte	0x4
+	.uleb128 .LVL660-.Ltext0
+	.uleb128 .LVL660-.Ltext0
+	.uleb128 0x3
+	.byte	0x8
+	.byte	0x3f
+	.byte	0x9f
+	.byte	0
+.LVUS377:
+	.uleb128 .LVU3706
+	.uleb128 .LVU3709
+.LLST377:
+	.byte	0x4
+	.uleb128 .LVL661-.Ltext0
+	.uleb128 .LVL662-.Ltext0
+	.uleb128 0x3
+	.byte	0x8
+	.byte	0x20
+	.byte	0x9f
+	.byte	0
+.LVUS378:
+	.uleb128 .LVU3717
+	.uleb128 .LVU3720
+.LLST378:
+	.byte	0x4
+	.uleb128 .LVL663-.Ltext0
+	.uleb128 .LVL664-.Ltext0
+	.uleb128 0x2
+	.byte	0x48
+	.byte	0x9f
+	.byte	0
+.LVUS380:
+	.uleb128 .LVU3727
+	.uleb128 .LVU3732
+.LLST380:
+	.byte	0x4
+	.uleb128 .LVL665-.Ltext0
+	.uleb128 .LVL666-.Ltext0
+	.uleb128 0x2
+	.byte	0x40
+	.byte	0x9f
+	.byte	0
+.LVUS381:
+	.uleb128 .LVU3738
+	.uleb128 .LVU3740
+.LLST381:
+	.byte	0x4
+	.uleb128 .LVL667-.Ltext0
+	.uleb128 .LVL667-.Ltext0
+	.uleb128 0x3
+	.byte	0x8
+	.byte	0x3f
+	.byte	0x9f
+	.byte	0
+.LVUS382:
+	.uleb128 .LVU3753
+	.uleb128 .LVU3756
+.LLST382:
+	.byte	0x4
+	.uleb128 .LVL668-.Ltext0
+	.uleb128 .LVL669-.Ltext0
+	.uleb128 0x3
+	.byte	0x8
+	.byte	0x20
+	.byte	0x9f
+	.byte	0
+.LVUS383:
+	.uleb128 .LVU3763
+	.uleb128 .LVU3766
+.LLST383:
+	.byte	0x4
+	.uleb128 .LVL670-.Ltext0
+	.uleb128 .LVL671-.Ltext0
+	.uleb128 0x2
+	.byte	0x48
+	.byte	0x9f
+	.byte	0
+.LVUS385:
+	.uleb128 .LVU3775
+	.uleb128 .LVU3779
+.LLST385:
+	.byte	0x4
+	.uleb128 .LVL672-.Ltext0
+	.uleb128 .LVL673-.Ltext0
+	.uleb128 0x2
+	.byte	0x40
+	.byte	0x9f
+	.byte	0
+.LVUS386:
+	.uleb128 .LVU3786
+	.uleb128 .LVU3788
+.LLST386:
+	.byte	0x4
+	.uleb128 .LVL674-.Ltext0
+	.uleb128 .LVL674-.Ltext0
+	.uleb128 0x3
+	.byte	0x8
+	.byte	0x3f
+	.byte	0x9f
+	.byte	0
+.LVUS387:
+	.uleb128 .LVU3798
+	.uleb128 .LVU3801
+.LLST387:
+	.byte	0x4
+	.uleb128 .LVL675-.Ltext0
+	.uleb128 .LVL676-.Ltext0
+	.uleb128 0x1
+	.byte	0x5a
+	.byte	0
+.LVUS388:
+	.uleb128 .LVU3798
+	.uleb128 .LVU3801
+.LLST388:
+	.byte	0x4
+	.uleb128 .LVL675-.Ltext0
+	.uleb128 .LVL676-.Ltext0
+	.uleb128 0x3
+	.byte	0x8
+	.byte	0x20
+	.byte	0x9f
+	.byte	0
+.LVUS390:
+	.uleb128 .LVU3808
+	.uleb128 .LVU3812
+.LLST390:
+	.byte	0x4
+	.uleb128 .LVL677-.Ltext0
+	.uleb128 .LVL678-.Ltext0
+	.uleb128 0x2
+	.byte	0x48
+	.byte	0x9f
+	.byte	0
+.LVUS391:
+	.uleb128 .LVU3819
+	.uleb128 .LVU3822
+.LLST391:
+	.byte	0x4
+	.uleb128 .LVL679-.Ltext0
+	.uleb128 .LVL680-.Ltext0
+	.uleb128 0x2
+	.byte	0x40
+	.byte	0x9f
+	.byte	0
+.LVUS392:
+	.uleb128 .LVU3829
+	.uleb128 .LVU3832
+.LLST392:
+	.byte	0x4
+	.uleb128 .LVL681-.Ltext0
+	.uleb128 .LVL682-.Ltext0
+	.uleb128 0x3
+	.byte	0x8
+	.byte	0x3f
+	.byte	0x9f
+	.byte	0
+.LVUS393:
+	.uleb128 .LVU3843
+	.uleb128 .LVU3846
+.LLST393:
+	.byte	0x4
+	.uleb128 .LVL683-.Ltext0
+	.uleb128 .LVL684-.Ltext0
+	.uleb128 0x3
+	.byte	0x8
+	.byte	0x20
+	.byte	0x9f
+	.byte	0
+.LVUS394:
+	.uleb128 .LVU3853
+	.uleb128 .LVU3856
+.LLST394:
+	.byte	0x4
+	.uleb128 .LVL685-.Ltext0
+	.uleb128 .LVL686-.Ltext0
+	.uleb128 0x2
+	.byte	0x48
+	.byte	0x9f
+	.byte	0
+.LVUS395:
+	.uleb128 .LVU3863
+	.uleb128 .LVU3865
+.LLST395:
+	.byte	0x4
+	.uleb128 .LVL687-.Ltext0
+	.uleb128 .LVL687-.Ltext0
+	.uleb128 0x2
+	.byte	0x40
+	.byte	0x9f
+	.byte	0
+.LVUS397:
+	.uleb128 .LVU3873
+	.uleb128 .LVU3875
+.LLST397:
+	.byte	0x4
+	.uleb128 .LVL688-.Ltext0
+	.uleb128 .LVL688-.Ltext0
+	.uleb128 0x3
+	.byte	0x8
+	.byte	0x3f
+	.byte	0x9f
+	.byte	0
+.LVUS398:
+	.uleb128 .LVU3888
+	.uleb128 .LVU3891
+.LLST398:
+	.byte	0x4
+	.uleb128 .LVL689-.Ltext0
+	.uleb128 .LVL690-.Ltext0
+	.uleb128 0x3
+	.byte	0x8
+	.byte	0x20
+	.byte	0x9f
+	.byte	0
+.LVUS400:
+	.uleb128 .LVU3898
+	.uleb128 .LVU3902
+.LLST400:
+	.byte	0x4
+	.uleb128 .LVL691-.Ltext0
+	.uleb128 .LVL692-.Ltext0
+	.uleb128 0x2
+	.byte	0x48
+	.byte	0x9f
+	.byte	0
+.LVUS402:
+	.uleb128 .LVU3909
+	.uleb128 .LVU3915
+.LLST402:
+	.byte	0x4
+	.uleb128 .LVL693-.Ltext0
+	.uleb128 .LVL694-.Ltext0
+	.uleb128 0x2
+	.byte	0x40
+	.byte	0x9f
+	.byte	0
+.LVUS403:
+	.uleb128 .LVU3920
+	.uleb128 .LVU3923
+.LLST403:
+	.byte	0x4
+	.uleb128 .LVL695-.Ltext0
+	.uleb128 .LVL696-.Ltext0
+	.uleb128 0x3
+	.byte	0x8
+	.byte	0x3f
+	.byte	0x9f
+	.byte	0
+.LVUS404:
+	.uleb128 .LVU3933
+	.uleb128 .LVU3936
+.LLST404:
+	.byte	0x4
+	.uleb128 .LVL697-.Ltext0
+	.uleb128 .LVL698-.Ltext0
+	.uleb128 0x3
+	.byte	0x8
+	.byte	0x20
+	.byte	0x9f
+	.byte	0
+.LVUS406:
+	.uleb128 .LVU3943
+	.uleb128 .LVU3948
+.LLST406:
+	.byte	0x4
+	.uleb128 .LVL699-.Ltext0
+	.uleb128 .LVL700-.Ltext0
+	.uleb128 0x2
+	.byte	0x48
+	.byte	0x9f
+	.byte	0
+.LVUS407:
+	.uleb128 .LVU3955
+	.uleb128 .LVU3958
+.LLST407:
+	.byte	0x4
+	.uleb128 .LVL701-.Ltext0
+	.uleb128 .LVL702-.Ltext0
+	.uleb128 0x2
+	.byte	0x40
+	.byte	0x9f
+	.byte	0
+.LVUS408:
+	.uleb128 .LVU3965
+	.uleb128 .LVU3968
+.LLST408:
+	.byte	0x4
+	.uleb128 .LVL703-.Ltext0
+	.uleb128 .LVL704-.Ltext0
+	.uleb128 0x3
+	.byte	0x8
+	.byte	0x3f
+	.byte	0x9f
+	.byte	0
+.LVUS409:
+	.uleb128 .LVU3977
+	.uleb128 .LVU3980
+.LLST409:
+	.byte	0x4
+	.uleb128 .LVL705-.Ltext0
+	.uleb128 .LVL706-.Ltext0
+	.uleb128 0x1
+	.byte	0x5d
+	.byte	0
+.LVUS410:
+	.uleb128 .LVU3977
+	.uleb128 .LVU3980
+.LLST410:
+	.byte	0x4
+	.uleb128 .LVL705-.Ltext0
+	.uleb128 .LVL706-.Ltext0
+	.uleb128 0x3
+	.byte	0x8
+	.byte	0x20
+	.byte	0x9f
+	.byte	0
+.LVUS411:
+	.uleb128 .LVU3987
+	.uleb128 .LVU3990
+.LLST411:
+	.byte	0x4
+	.uleb128 .LVL707-.Ltext0
+	.uleb128 .LVL708-.Ltext0
+	.uleb128 0x2
+	.byte	0x48
+	.byte	0x9f
+	.byte	0
+.LVUS412:
+	.uleb128 .LVU3997
+	.uleb128 .LVU4000
+.LLST412:
+	.byte	0x4
+	.uleb128 .LVL709-.Ltext0
+	.uleb128 .LVL710-.Ltext0
+	.uleb128 0x2
+	.byte	0x40
+	.byte	0x9f
+	.byte	0
+.LVUS413:
+	.uleb128 .LVU4007
+	.uleb128 .LVU4010
+.LLST413:
+	.byte	0x4
+	.uleb128 .LVL711-.Ltext0
+	.uleb128 .LVL712-.Ltext0
+	.uleb128 0x3
+	.byte	0x8
+	.byte	0x3f
+	.byte	0x9f
+	.byte	0
+.LVUS414:
+	.uleb128 .LVU4019
+	.uleb128 .LVU4022
+.LLST414:
+	.byte	0x4
+	.uleb128 .LVL713-.Ltext0
+	.uleb128 .LVL714-.Ltext0
+	.uleb128 0x3
+	.byte	0x8
+	.byte	0x20
+	.byte	0x9f
+	.byte	0
+.LVUS415:
+	.uleb128 .LVU4029
+	.uleb128 .LVU4032
+.LLST415:
+	.byte	0x4
+	.uleb128 .LVL715-.Ltext0
+	.uleb128 .LVL716-.Ltext0
+	.uleb128 0x2
+	.byte	0x48
+	.byte	0x9f
+	.byte	0
+.LVUS417:
+	.uleb128 .LVU4037
+	.uleb128 .LVU4040
+	.uleb128 .LVU4040
+	.uleb128 .LVU4041
+.LLST417:
+	.byte	0x4
+	.uleb128 .LVL717-.Ltext0
+	.uleb128 .LVL718-.Ltext0
+	.uleb128 0x6
+	.byte	0x75
+	.sleb128 0
+	.byte	0x7d
+	.sleb128 0
+	.byte	0x27
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL718-.Ltext0
+	.uleb128 .LVL719-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0
+.LVUS418:
+	.uleb128 .LVU4037
+	.uleb128 .LVU4041
+.LLST418:
+	.byte	0x4
+	.uleb128 .LVL717-.Ltext0
+	.uleb128 .LVL719-.Ltext0
+	.uleb128 0x2
+	.byte	0x40
+	.byte	0x9f
+	.byte	0
+.LVUS420:
+	.uleb128 .LVU4048
+	.uleb128 .LVU4050
+.LLST420:
+	.byte	0x4
+	.uleb128 .LVL720-.Ltext0
+	.uleb128 .LVL720-.Ltext0
+	.uleb128 0x6
+	.byte	0x7f
+	.sleb128 0
+	.byte	0x7c
+	.sleb128 0
+	.byte	0x27
+	.byte	0x9f
+	.byte	0
+.LVUS421:
+	.uleb128 .LVU4048
+	.uleb128 .LVU4050
+.LLST421:
+	.byte	0x4
+	.uleb128 .LVL720-.Ltext0
+	.uleb128 .LVL720-.Ltext0
+	.uleb128 0x3
+	.byte	0x8
+	.byte	0x3f
+	.byte	0x9f
+	.byte	0
+.LVUS422:
+	.uleb128 .LVU4060
+	.uleb128 .LVU4063
+.LLST422:
+	.byte	0x4
+	.uleb128 .LVL721-.Ltext0
+	.uleb128 .LVL722-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0
+.LVUS423:
+	.uleb128 .LVU4060
+	.uleb128 .LVU4063
+.LLST423:
+	.byte	0x4
+	.uleb128 .LVL721-.Ltext0
+	.uleb128 .LVL722-.Ltext0
+	.uleb128 0x3
+	.byte	0x8
+	.byte	0x20
+	.byte	0x9f
+	.byte	0
+.LVUS424:
+	.uleb128 .LVU4070
+	.uleb128 .LVU4073
+.LLST424:
+	.byte	0x4
+	.uleb128 .LVL723-.Ltext0
+	.uleb128 .LVL724-.Ltext0
+	.uleb128 0x2
+	.byte	0x48
+	.byte	0x9f
+	.byte	0
+.LVUS426:
+	.uleb128 .LVU4078
+	.uleb128 .LVU4081
+	.uleb128 .LVU4081
+	.uleb128 .LVU4082
+.LLST426:
+	.byte	0x4
+	.uleb128 .LVL725-.Ltext0
+	.uleb128 .LVL726-.Ltext0
+	.uleb128 0x6
+	.byte	0x74
+	.sleb128 0
+	.byte	0x75
+	.sleb128 0
+	.byte	0x27
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL726-.Ltext0
+	.uleb128 .LVL727-.Ltext0
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0
+.LVUS427:
+	.uleb128 .LVU4078
+	.uleb128 .LVU4082
+.LLST427:
+	.byte	0x4
+	.uleb128 .LVL725-.Ltext0
+	.uleb128 .LVL727-.Ltext0
+	.uleb128 0x2
+	.byte	0x40
+	.byte	0x9f
+	.byte	0
+.LVUS429:
+	.uleb128 .LVU4089
+	.uleb128 .LVU4091
+.LLST429:
+	.byte	0x4
+	.uleb128 .LVL728-.Ltext0
+	.uleb128 .LVL728-.Ltext0
+	.uleb128 0x6
+	.byte	0x7e
+	.sleb128 0
+	.byte	0x76
+	.sleb128 0
+	.byte	0x27
+	.byte	0x9f
+	.byte	0
+.LVUS430:
+	.uleb128 .LVU4089
+	.uleb128 .LVU4091
+.LLST430:
+	.byte	0x4
+	.uleb128 .LVL728-.Ltext0
+	.uleb128 .LVL728-.Ltext0
+	.uleb128 0x3
+	.byte	0x8
+	.byte	0x3f
+	.byte	0x9f
+	.byte	0
+.LVUS431:
+	.uleb128 .LVU4101
+	.uleb128 .LVU4104
+.LLST431:
+	.byte	0x4
+	.uleb128 .LVL729-.Ltext0
+	.uleb128 .LVL730-.Ltext0
+	.uleb128 0x3
+	.byte	0x8
+	.byte	0x20
+	.byte	0x9f
+	.byte	0
+.LVUS432:
+	.uleb128 .LVU4111
+	.uleb128 .LVU4114
+.LLST432:
+	.byte	0x4
+	.uleb128 .LVL731-.Ltext0
+	.uleb128 .LVL732-.Ltext0
+	.uleb128 0x2
+	.byte	0x48
+	.byte	0x9f
+	.byte	0
+.LVUS434:
+	.uleb128 .LVU4119
+	.uleb128 .LVU4122
+	.uleb128 .LVU4122
+	.uleb128 .LVU4123
+.LLST434:
+	.byte	0x4
+	.uleb128 .LVL733-.Ltext0
+	.uleb128 .LVL734-.Ltext0
+	.uleb128 0x6
+	.byte	0x72
+	.sleb128 0
+	.byte	0x78
+	.sleb128 0
+	.byte	0x27
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL734-.Ltext0
+	.uleb128 .LVL735-.Ltext0
+	.uleb128 0x1
+	.byte	0x52
+	.byte	0
+.LVUS435:
+	.uleb128 .LVU4119
+	.uleb128 .LVU4123
+.LLST435:
+	.byte	0x4
+	.uleb128 .LVL733-.Ltext0
+	.uleb128 .LVL735-.Ltext0
+	.uleb128 0x2
+	.byte	0x40
+	.byte	0x9f
+	.byte	0
+.LVUS437:
+	.uleb128 .LVU4130
+	.uleb128 .LVU4132
+.LLST437:
+	.byte	0x4
+	.uleb128 .LVL736-.Ltext0
+	.uleb128 .LVL736-.Ltext0
+	.uleb128 0x6
+	.byte	0x74
+	.sleb128 0
+	.byte	0x73
+	.sleb128 0
+	.byte	0x27
+	.byte	0x9f
+	.byte	0
+.LVUS438:
+	.uleb128 .LVU4130
+	.uleb128 .LVU4132
+.LLST438:
+	.byte	0x4
+	.uleb128 .LVL736-.Ltext0
+	.uleb128 .LVL736-.Ltext0
+	.uleb128 0x3
+	.byte	0x8
+	.byte	0x3f
+	.byte	0x9f
+	.byte	0
+.LVUS440:
+	.uleb128 .LVU4146
+	.uleb128 .LVU4150
+.LLST440:
+	.byte	0x4
+	.uleb128 .LVL737-.Ltext0
+	.uleb128 .LVL738-.Ltext0
+	.uleb128 0x3
+	.byte	0x8
+	.byte	0x20
+	.byte	0x9f
+	.byte	0
+.LVUS441:
+	.uleb128 .LVU4157
+	.uleb128 .LVU4160
+.LLST441:
+	.byte	0x4
+	.uleb128 .LVL739-.Ltext0
+	.uleb128 .LVL740-.Ltext0
+	.uleb128 0x2
+	.byte	0x48
+	.byte	0x9f
+	.byte	0
+.LVUS443:
+	.uleb128 .LVU4165
+	.uleb128 .LVU4168
+	.uleb128 .LVU4168
+	.uleb128 .LVU4169
+.LLST443:
+	.byte	0x4
+	.uleb128 .LVL741-.Ltext0
+	.uleb128 .LVL742-.Ltext0
+	.uleb128 0x6
+	.byte	0x71
+	.sleb128 0
+	.byte	0x7a
+	.sleb128 0
+	.byte	0x27
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL742-.Ltext0
+	.uleb128 .LVL743-.Ltext0
+	.uleb128 0x1
+	.byte	0x51
+	.byte	0
+.LVUS444:
+	.uleb128 .LVU4165
+	.uleb128 .LVU4169
+.LLST444:
+	.byte	0x4
+	.uleb128 .LVL741-.Ltext0
+	.uleb128 .LVL743-.Ltext0
+	.uleb128 0x2
+	.byte	0x40
+	.byte	0x9f
+	.byte	0
+.LVUS446:
+	.uleb128 .LVU4175
+	.uleb128 .LVU4177
+.LLST446:
+	.byte	0x4
+	.uleb128 .LVL744-.Ltext0
+	.uleb128 .LVL744-.Ltext0
+	.uleb128 0x6
+	.byte	0x7b
+	.sleb128 0
+	.byte	0x72
+	.sleb128 0
+	.byte	0x27
+	.byte	0x9f
+	.byte	0
+.LVUS447:
+	.uleb128 .LVU4175
+	.uleb128 .LVU4177
+.LLST447:
+	.byte	0x4
+	.uleb128 .LVL744-.Ltext0
+	.uleb128 .LVL744-.Ltext0
+	.uleb128 0x3
+	.byte	0x8
+	.byte	0x3f
+	.byte	0x9f
+	.byte	0
+.Ldebug_loc3:
+	.section	.debug_aranges,"",@progbits
+	.long	0x2c
+	.value	0x2
+	.long	.Ldebug_info0
+	.byte	0x8
+	.byte	0
+	.value	0
+	.value	0
+	.quad	.Ltext0
+	.quad	.Letext0-.Ltext0
+	.quad	0
+	.quad	0
+	.section	.debug_rnglists,"",@progbits
+.Ldebug_ranges0:
+	.long	.Ldebug_ranges3-.Ldebug_ranges2
+.Ldebug_ranges2:
+	.value	0x5
+	.byte	0x8
+	.byte	0
+	.long	0
+.LLRL2:
+	.byte	0x4
+	.uleb128 .LBB785-.Ltext0
+	.uleb128 .LBE785-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB788-.Ltext0
+	.uleb128 .LBE788-.Ltext0
+	.byte	0
+.LLRL15:
+	.byte	0x4
+	.uleb128 .LBB805-.Ltext0
+	.uleb128 .LBE805-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB808-.Ltext0
+	.uleb128 .LBE808-.Ltext0
+	.byte	0
+.LLRL48:
+	.byte	0x4
+	.uleb128 .LBB867-.Ltext0
+	.uleb128 .LBE867-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB870-.Ltext0
+	.uleb128 .LBE870-.Ltext0
+	.byte	0
+.LLRL95:
+	.byte	0x4
+	.uleb128 .LBB957-.Ltext0
+	.uleb128 .LBE957-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB960-.Ltext0
+	.uleb128 .LBE960-.Ltext0
+	.byte	0
+.LLRL120:
+	.byte	0x4
+	.uleb128 .LBB1007-.Ltext0
+	.uleb128 .LBE1007-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB1010-.Ltext0
+	.uleb128 .LBE1010-.Ltext0
+	.byte	0
+.LLRL133:
+	.byte	0x4
+	.uleb128 .LBB1031-.Ltext0
+	.uleb128 .LBE1031-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB1034-.Ltext0
+	.uleb128 .LBE1034-.Ltext0
+	.byte	0
+.LLRL169:
+	.byte	0x4
+	.uleb128 .LBB1101-.Ltext0
+	.uleb128 .LBE1101-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB1104-.Ltext0
+	.uleb128 .LBE1104-.Ltext0
+	.byte	0
+.LLRL182:
+	.byte	0x4
+	.uleb128 .LBB1125-.Ltext0
+	.uleb128 .LBE1125-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB1128-.Ltext0
+	.uleb128 .LBE1128-.Ltext0
+	.byte	0
+.LLRL208:
+	.byte	0x4
+	.uleb128 .LBB1175-.Ltext0
+	.uleb128 .LBE1175-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB1178-.Ltext0
+	.uleb128 .LBE1178-.Ltext0
+	.byte	0
+.LLRL220:
+	.byte	0x4
+	.uleb128 .LBB1199-.Ltext0
+	.uleb128 .LBE1199-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB1202-.Ltext0
+	.uleb128 .LBE1202-.Ltext0
+	.byte	0
+.LLRL256:
+	.byte	0x4
+	.uleb128 .LBB1269-.Ltext0
+	.uleb128 .LBE1269-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB1272-.Ltext0
+	.uleb128 .LBE1272-.Ltext0
+	.byte	0
+.LLRL270:
+	.byte	0x4
+	.uleb128 .LBB1293-.Ltext0
+	.uleb128 .LBE1293-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB1296-.Ltext0
+	.uleb128 .LBE1296-.Ltext0
+	.byte	0
+.LLRL295:
+	.byte	0x4
+	.uleb128 .LBB1343-.Ltext0
+	.uleb128 .LBE1343-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB1346-.Ltext0
+	.uleb128 .LBE1346-.Ltext0
+	.byte	0
+.LLRL308:
+	.byte	0x4
+	.uleb128 .LBB1367-.Ltext0
+	.uleb128 .LBE1367-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB1370-.Ltext0
+	.uleb128 .LBE1370-.Ltext0
+	.byte	0
+.LLRL344:
+	.byte	0x4
+	.uleb128 .LBB1437-.Ltext0
+	.uleb128 .LBE1437-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB1440-.Ltext0
+	.uleb128 .LBE1440-.Ltext0
+	.byte	0
+.LLRL357:
+	.byte	0x4
+	.uleb128 .LBB1461-.Ltext0
+	.uleb128 .LBE1461-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB1464-.Ltext0
+	.uleb128 .LBE1464-.Ltext0
+	.byte	0
+.LLRL367:
+	.byte	0x4
+	.uleb128 .LBB1481-.Ltext0
+	.uleb128 .LBE1481-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB1484-.Ltext0
+	.uleb128 .LBE1484-.Ltext0
+	.byte	0
+.LLRL379:
+	.byte	0x4
+	.uleb128 .LBB1503-.Ltext0
+	.uleb128 .LBE1503-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB1506-.Ltext0
+	.uleb128 .LBE1506-.Ltext0
+	.byte	0
+.LLRL384:
+	.byte	0x4
+	.uleb128 .LBB1513-.Ltext0
+	.uleb128 .LBE1513-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB1516-.Ltext0
+	.uleb128 .LBE1516-.Ltext0
+	.byte	0
+.LLRL389:
+	.byte	0x4
+	.uleb128 .LBB1521-.Ltext0
+	.uleb128 .LBE1521-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB1524-.Ltext0
+	.uleb128 .LBE1524-.Ltext0
+	.byte	0
+.LLRL396:
+	.byte	0x4
+	.uleb128 .LBB1535-.Ltext0
+	.uleb128 .LBE1535-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB1538-.Ltext0
+	.uleb128 .LBE1538-.Ltext0
+	.byte	0
+.LLRL399:
+	.byte	0x4
+	.uleb128 .LBB1541-.Ltext0
+	.uleb128 .LBE1541-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB1544-.Ltext0
+	.uleb128 .LBE1544-.Ltext0
+	.byte	0
+.LLRL401:
+	.byte	0x4
+	.uleb128 .LBB1545-.Ltext0
+	.uleb128 .LBE1545-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB1548-.Ltext0
+	.uleb128 .LBE1548-.Ltext0
+	.byte	0
+.LLRL405:
+	.byte	0x4
+	.uleb128 .LBB1553-.Ltext0
+	.uleb128 .LBE1553-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB1556-.Ltext0
+	.uleb128 .LBE1556-.Ltext0
+	.byte	0
+.LLRL416:
+	.byte	0x4
+	.uleb128 .LBB1573-.Ltext0
+	.uleb128 .LBE1573-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB1576-.Ltext0
+	.uleb128 .LBE1576-.Ltext0
+	.byte	0
+.LLRL419:
+	.byte	0x4
+	.uleb128 .LBB1577-.Ltext0
+	.uleb128 .LBE1577-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB1580-.Ltext0
+	.uleb128 .LBE1580-.Ltext0
+	.byte	0
+.LLRL425:
+	.byte	0x4
+	.uleb128 .LBB1585-.Ltext0
+	.uleb128 .LBE1585-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB1588-.Ltext0
+	.uleb128 .LBE1588-.Ltext0
+	.byte	0
+.LLRL428:
+	.byte	0x4
+	.uleb128 .LBB1589-.Ltext0
+	.uleb128 .LBE1589-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB1592-.Ltext0
+	.uleb128 .LBE1592-.Ltext0
+	.byte	0
+.LLRL433:
+	.byte	0x4
+	.uleb128 .LBB1597-.Ltext0
+	.uleb128 .LBE1597-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB1600-.Ltext0
+	.uleb128 .LBE1600-.Ltext0
+	.byte	0
+.LLRL436:
+	.byte	0x4
+	.uleb128 .LBB1601-.Ltext0
+	.uleb128 .LBE1601-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB1605-.Ltext0
+	.uleb128 .LBE1605-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB1606-.Ltext0
+	.uleb128 .LBE1606-.Ltext0
+	.byte	0
+.LLRL439:
+	.byte	0x4
+	.uleb128 .LBB1607-.Ltext0
+	.uleb128 .LBE1607-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB1610-.Ltext0
+	.uleb128 .LBE1610-.Ltext0
+	.byte	0
+.LLRL442:
+	.byte	0x4
+	.uleb128 .LBB1613-.Ltext0
+	.uleb128 .LBE1613-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB1616-.Ltext0
+	.uleb128 .LBE1616-.Ltext0
+	.byte	0
+.LLRL445:
+	.byte	0x4
+	.uleb128 .LBB1617-.Ltext0
+	.uleb128 .LBE1617-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB1620-.Ltext0
+	.uleb128 .LBE1620-.Ltext0
+	.byte	0
+.LLRL450:
+	.byte	0x4
+	.uleb128 .LBB1632-.Ltext0
+	.uleb128 .LBE1632-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB1652-.Ltext0
+	.uleb128 .LBE1652-.Ltext0
+	.byte	0
+.LLRL455:
+	.byte	0x4
+	.uleb128 .LBB1634-.Ltext0
+	.uleb128 .LBE1634-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB1635-.Ltext0
+	.uleb128 .LBE1635-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB1637-.Ltext0
+	.uleb128 .LBE1637-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB1638-.Ltext0
+	.uleb128 .LBE1638-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB1640-.Ltext0
+	.uleb128 .LBE1640-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB1642-.Ltext0
+	.uleb128 .LBE1642-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB1644-.Ltext0
+	.uleb128 .LBE1644-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB1646-.Ltext0
+	.uleb128 .LBE1646-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB1648-.Ltext0
+	.uleb128 .LBE1648-.Ltext0
+	.byte	0
+.LLRL457:
+	.byte	0x4
+	.uleb128 .LBB1636-.Ltext0
+	.uleb128 .LBE1636-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB1639-.Ltext0
+	.uleb128 .LBE1639-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB1641-.Ltext0
+	.uleb128 .LBE1641-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB1643-.Ltext0
+	.uleb128 .LBE1643-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB1645-.Ltext0
+	.uleb128 .LBE1645-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB1647-.Ltext0
+	.uleb128 .LBE1647-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB1649-.Ltext0
+	.uleb128 .LBE1649-.Ltext0
+	.byte	0
+.LLRL464:
+	.byte	0x4
+	.uleb128 .LBB1666-.Ltext0
+	.uleb128 .LBE1666-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB1667-.Ltext0
+	.uleb128 .LBE1667-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB1668-.Ltext0
+	.uleb128 .LBE1668-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB1669-.Ltext0
+	.uleb128 .LBE1669-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB1729-.Ltext0
+	.uleb128 .LBE1729-.Ltext0
+	.byte	0
+.LLRL466:
+	.byte	0x4
+	.uleb128 .LBB1670-.Ltext0
+	.uleb128 .LBE1670-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB1730-.Ltext0
+	.uleb128 .LBE1730-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB1731-.Ltext0
+	.uleb128 .LBE1731-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB1732-.Ltext0
+	.uleb128 .LBE1732-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB1733-.Ltext0
+	.uleb128 .LBE1733-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB1734-.Ltext0
+	.uleb128 .LBE1734-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB1735-.Ltext0
+	.uleb128 .LBE1735-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB1736-.Ltext0
+	.uleb128 .LBE1736-.Ltext0
+	.byte	0
+.LLRL470:
+	.byte	0x4
+	.uleb128 .LBB1672-.Ltext0
+	.uleb128 .LBE1672-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB1706-.Ltext0
+	.uleb128 .LBE1706-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB1707-.Ltext0
+	.uleb128 .LBE1707-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB1709-.Ltext0
+	.uleb128 .LBE1709-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB1710-.Ltext0
+	.uleb128 .LBE1710-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB1711-.Ltext0
+	.uleb128 .LBE1711-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB1713-.Ltext0
+	.uleb128 .LBE1713-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB1715-.Ltext0
+	.uleb128 .LBE1715-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB1717-.Ltext0
+	.uleb128 .LBE1717-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB1719-.Ltext0
+	.uleb128 .LBE1719-.Ltext0
+	.byte	0
+.LLRL472:
+	.byte	0x4
+	.uleb128 .LBB1673-.Ltext0
+	.uleb128 .LBE1673-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB1690-.Ltext0
+	.uleb128 .LBE1690-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB1691-.Ltext0
+	.uleb128 .LBE1691-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB1692-.Ltext0
+	.uleb128 .LBE1692-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB1693-.Ltext0
+	.uleb128 .LBE1693-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB1694-.Ltext0
+	.uleb128 .LBE1694-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB1695-.Ltext0
+	.uleb128 .LBE1695-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB1696-.Ltext0
+	.uleb128 .LBE1696-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB1697-.Ltext0
+	.uleb128 .LBE1697-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB1698-.Ltext0
+	.uleb128 .LBE1698-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB1699-.Ltext0
+	.uleb128 .LBE1699-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB1700-.Ltext0
+	.uleb128 .LBE1700-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB1701-.Ltext0
+	.uleb128 .LBE1701-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB1702-.Ltext0
+	.uleb128 .LBE1702-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB1703-.Ltext0
+	.uleb128 .LBE1703-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB1704-.Ltext0
+	.uleb128 .LBE1704-.Ltext0
+	.byte	0
+.LLRL473:
+	.byte	0x4
+	.uleb128 .LBB1705-.Ltext0
+	.uleb128 .LBE1705-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB1708-.Ltext0
+	.uleb128 .LBE1708-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB1712-.Ltext0
+	.uleb128 .LBE1712-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB1714-.Ltext0
+	.uleb128 .LBE1714-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB1716-.Ltext0
+	.uleb128 .LBE1716-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB1718-.Ltext0
+	.uleb128 .LBE1718-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB1720-.Ltext0
+	.uleb128 .LBE1720-.Ltext0
+	.byte	0
+.LLRL476:
+	.byte	0x4
+	.uleb128 .LBB1737-.Ltext0
+	.uleb128 .LBE1737-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB1738-.Ltext0
+	.uleb128 .LBE1738-.Ltext0
+	.byte	0
+.Ldebug_ranges3:
+	.section	.debug_line,"",@progbits
+.Ldebug_line0:
+	.section	.debug_str,"MS",@progbits,1
+.LASF29:
+	.string	"read_le64"
+.LASF9:
+	.string	"__uint8_t"
+.LASF18:
+	.string	"digest_len"
+.LASF26:
+	.string	"blake2b_compress_blocks_generic"
+.LASF10:
+	.string	"short int"
+.LASF23:
+	.string	"blake2s_sigma"
+.LASF16:
+	.string	"uint64_t"
+.LASF36:
+	.string	"blake2b_12rounds"
+.LASF4:
+	.string	"unsigned char"
+.LASF3:
+	.string	"long unsigned int"
+.LASF5:
+	.string	"short unsigned int"
+.LASF8:
+	.string	"size_t"
+.LASF25:
+	.string	"nblocks"
+.LASF17:
+	.string	"buf_len"
+.LASF30:
+	.string	"read_le32"
+.LASF11:
+	.string	"__uint32_t"
+.LASF19:
+	.string	"last_node"
+.LASF28:
+	.string	"ror64"
+.LASF6:
+	.string	"unsigned int"
+.LASF20:
+	.string	"long long unsigned int"
+.LASF14:
+	.string	"uint8_t"
+.LASF22:
+	.string	"blake2s_iv"
+.LASF21:
+	.string	"long long int"
+.LASF13:
+	.string	"char"
+.LASF35:
+	.string	"blake2b_ctx"
+.LASF31:
+	.string	"blake2b_block"
+.LASF12:
+	.string	"__uint64_t"
+.LASF34:
+	.string	"GNU C99 12.2.0 -mtune=generic -march=x86-64 -g -O3 -std=c99 -fasynchronous-unwind-tables"
+.LASF15:
+	.string	"uint32_t"
+.LASF2:
+	.string	"long int"
+.LASF32:
+	.string	"to_le32"
+.LASF27:
+	.string	"blake2b_compress_generic"
+.LASF7:
+	.string	"signed char"
+.LASF33:
+	.string	"_one"
+.LASF24:
+	.string	"blake2b_iv"
+	.section	.debug_line_str,"MS",@progbits,1
+.LASF1:
+	.string	"/root/repo"
+.LASF0:
+	.string	"blake2b-generic.c"
+	.ident	"GCC: (Debian 12.2.0-14+deb12u1) 12.2.0"
+	.section	.note.GNU-stack,"",@progbits
@@ -0,0 +1,126 @@
+#ifndef BLAKE2B_INTERNAL_H_
+#define BLAKE2B_INTERNAL_H_
+
+#include "blake2s-internal.h"
+
+typedef uint64_t u64;
+
+static const u64 blake2b_iv[8] = {
+    0x6a09e667f3bcc908ULL, 0xbb67ae8584caa73bULL,
+    0x3c6ef372fe94f82bULL, 0xa54ff53a5f1d36f1ULL,
+    0x510e527fade682d1ULL, 0x9b05688c2b3e6c1fULL,
+    0x1f83d9abfb41bd6bULL, 0x5be0cd19137e2179ULL,
+};
+
+/* BLAKE2b runs 12 rounds; rounds 10 and 11 reuse the permutations of
+ * rounds 0 and 1, see blake2s_sigma */
+#define B2B_SIGMA(r) blake2s_sigma[(r) % 10]
+
+/* Parameter block words 0-3, as for BLAKE2s but 64 bits wide.
+ * Word 0: digest length, key length, fanout, depth, leaf length
+ * Word 1: node offset
+ * Word 2: node depth, inner length
+ * Word 3: reserved
+ */
+#define B2B_PARAM_WORDS 4
+#define B2B_PARAM0(dlen,klen,fanout,depth,leaf_len) \
+    ((u64)LE32W(dlen,klen,fanout,depth) | (u64)(leaf_len) << 32)
+#define B2B_PARAM2(node_depth,inner_len) (u64)LE32W(node_depth,inner_len,0,0)
+
+/* blake2b_init_words: as blake2s_init_words */
+void blake2b_init_words(struct blake2b_ctx *ctx, const u64 P[B2B_PARAM_WORDS],
+                        const void *salt, const void *key, unsigned key_len);
+
+/* Multi-buffer kernels, as struct blake2s_lanes */
+#define B2B_LANES_MAX 4
+
+struct blake2b_lanes {
+    u64 H[8][B2B_LANES_MAX];
+    u64 t[2][B2B_LANES_MAX];
+    u64 f[2][B2B_LANES_MAX];
+} ALIGN(32);
+
+/* A BLAKE2b compression kernel, as struct blake2s_kernel */
+struct blake2b_kernel {
+    const char *name;
+    int (*usable)(void);
+    void (*compress)(struct blake2b_ctx *ctx, const void *m);
+    void (*compress_blocks)(struct blake2b_ctx *ctx, const void *m,
+                            size_t nblocks);
+    unsigned lanes;
+    void (*compress_lanes)(struct blake2b_lanes *L, const void *m[],
+                           unsigned mask);
+};
+
+extern const struct blake2b_kernel *blake2b_kern;
+const struct blake2b_kernel *blake2b_kernel_get(unsigned i);
+
+/* kernels, see blake2s-kernel.c for which are built where */
+void blake2b_compress_generic(struct blake2b_ctx *ctx, const void *m);
+void blake2b_compress_avx2(struct blake2b_ctx *ctx, const void *m);
+void blake2b_compress_blocks_generic(struct blake2b_ctx *ctx, const void *m,
+                                     size_t nblocks);
+void blake2b_compress_blocks_avx2(struct blake2b_ctx *ctx, const void *m,
+                                  size_t nblocks);
+void blake2b_compress_lanes_serial(struct blake2b_lanes *L, const void *m[],
+                                   unsigned mask);
+void blake2b_compress_lanes_avx2(struct blake2b_lanes *L, const void *m[],
+                                 unsigned mask);
+
+static inline void blake2b_compress(struct blake2b_ctx *ctx, const void *m)
+{
+    blake2b_kern->compress(ctx, m);
+}
+
+static inline void blake2b_compress_blocks(struct blake2b_ctx *ctx,
+                                           const void *m, size_t nblocks)
+{
+    blake2b_kern->compress_blocks(ctx, m, nblocks);
+}
+
+static inline void blake2b_compress_lanes(struct blake2b_lanes *L,
+                                          const void *m[], unsigned mask)
+{
+    blake2b_kern->compress_lanes(L, m, mask);
+}
+
+/* Move a context in and out of lane `l` of the transposed state */
+static inline void bblane_load(struct blake2b_lanes *L, unsigned l,
+                               const struct blake2b_ctx *ctx)
+{
+    for (unsigned i = 0; i < 8; i++)
+        L->H[i][l] = ctx->H[i];
+    L->t[0][l] = ctx->t[0];
+    L->t[1][l] = ctx->t[1];
+    L->f[0][l] = ctx->f[0];
+    L->f[1][l] = ctx->f[1];
+}
+
+static inline void bblane_store(const struct blake2b_lanes *L, unsigned l,
+                                struct blake2b_ctx *ctx)
+{
+    for (unsigned i = 0; i < 8; i++)
+        ctx->H[i] = L->H[i][l];
+    ctx->t[0] = L->t[0][l];
+    ctx->t[1] = L->t[1][l];
+    ctx->f[0] = L->f[0][l];
+    ctx->f[1] = L->f[1][l];
+}
+
+static inline void bblane_inc_t(struct blake2b_lanes *L, unsigned l, size_t inc)
+{
+    L->t[0][l] += inc;
+    L->t[1][l] += (L->t[0][l] < inc);
+}
+
+static inline u64 read_le64(const unsigned char *x)
+{
+    return read_le32(x) | (u64)read_le32(x + 4) << 32;
+}
+static inline void write_le64(unsigned char *y, u64 x)
+{
+    write_le32(y, (u32)x);
+    write_le32(y + 4, (u32)(x >> 32));
+}
+
+#endif /* BLAKE2B_INTERNAL_H_ */
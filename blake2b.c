@@ -0,0 +1,200 @@
+#include <stdlib.h>
+#include <stdio.h>
+#include <string.h>
+
+#include "blake2s.h"
+#include "blake2b.h"
+#include "blake2b-internal.h"
+
+/* BLAKE2b: designed for 64-bit arches
+ * + Message is interpreted in little endian
+ * + Padding just zerofills to block size
+ * + block size is 128 bytes
+ *
+ * Parameter block (length, position)
+ * Digest byte length (1, 0) in [1,64]
+ * Key byte length (1, 1)    in [0,64]
+ * Fanout         (1, 2)   = 1 for non-tree hashing style
+ * Max depth      (1, 3)   = 1 for non-tree hashing style
+ * Leaf length    (4, 4-7)   = 0 for non-tree hashing style
+ * Node offset    (8, 8-15)  = 0 for non-tree hashing style
+ * Node depth     (1, 16)    = 0 for non-tree hashing style
+ * Inner length   (1, 17)    = 0 for non-tree hashing style
+ * Reserved       (14, 18-31)
+ * Salt (16, 32-47) default zeros
+ * Personalization (16, 48-63) default zeros
+ */
+#define B2B_BLOCK BLAKE2B_BLOCK
+#define B2B_SALT_WORDS  2
+#define B2B_PERS_WORDS  2
+
+static const u8  blake2b_salt_def [8*B2B_SALT_WORDS]  = {0};
+static const u8  blake2b_pers_def [8*B2B_PERS_WORDS]  = {0};
+
+/* Param word 1: diglen,keylen,1,1, leaf length 0 */
+#define B2B_FIRST_PARAM(dlen,klen) B2B_PARAM0(dlen,klen,1,1,0)
+
+#define B2B_IO_CHUNKSIZ (8 << 10)
+
+static void bbstate_inc_t(struct blake2b_ctx *ctx, size_t inc)
+{
+    ctx->t[0] += inc;
+    ctx->t[1] += (ctx->t[0] < inc);
+}
+
+static void bbstate_buf_zeropad(struct blake2b_ctx *ctx)
+{
+    memset(ctx->buf + ctx->buf_len, 0, B2B_BLOCK - ctx->buf_len);
+}
+
+static void bbstate_buf_add(struct blake2b_ctx *ctx, const void *src,
+                            size_t len, size_t off)
+{
+    memcpy(ctx->buf + off, src, len);
+    ctx->buf_len = off + len;
+}
+
+#define bbstate_buf_append(ctx,s,l) bbstate_buf_add(ctx,(s),l,(ctx)->buf_len)
+#define bbstate_buf_set(ctx,s,l) bbstate_buf_add(ctx,(s),l,0)
+
+void blake2b_update(struct blake2b_ctx *ctx, const void *src, size_t len)
+{
+    unsigned rest = B2B_BLOCK - ctx->buf_len;
+    size_t src_off = 0;
+
+    /* Always save one full block in slop buffer */
+    if (ctx->buf_len + len <= B2B_BLOCK) {
+        bbstate_buf_append(ctx, src, len);
+        return;
+    }
+    /* complete the buffered block, if any */
+    if (ctx->buf_len) {
+        bbstate_buf_append(ctx, src, rest);
+        src_off += rest;
+        len -= rest;
+        bbstate_inc_t(ctx, B2B_BLOCK);
+        blake2b_compress(ctx, ctx->buf);
+        ctx->buf_len = 0;
+    }
+
+    /* full blocks straight from `src`, in one run, except the last */
+    if (len > B2B_BLOCK) {
+        size_t nblocks = (len - 1) / B2B_BLOCK;
+        blake2b_compress_blocks(ctx, (char *)src + src_off, nblocks);
+        len -= nblocks * B2B_BLOCK;
+        src_off += nblocks * B2B_BLOCK;
+    }
+
+    bbstate_buf_set(ctx, (char *)src + src_off, len);
+}
+
+static void bbstate_output_digest(struct blake2b_ctx *ctx, unsigned char *out)
+{
+    unsigned char digest[BLAKE2B_LEN];
+    for (unsigned i = 0; i < 8; i++)
+        write_le64(digest + i*8, ctx->H[i]);
+    memcpy(out, digest, ctx->digest_len);
+    memset(digest, 0, sizeof(digest));
+}
+
+void blake2b_final(struct blake2b_ctx *ctx, unsigned char *out)
+{
+    bbstate_buf_zeropad(ctx);
+    ctx->f[0] = ~0ULL;
+    if (ctx->last_node)
+        ctx->f[1] = ~0ULL;
+    bbstate_inc_t(ctx, ctx->buf_len);
+    blake2b_compress(ctx, ctx->buf);
+    bbstate_output_digest(ctx, out);
+    memset(ctx, 0, sizeof(*ctx));
+}
+
+static void blake2b_init_ex(struct blake2b_ctx *ctx,
+                            const u64 P[B2B_PARAM_WORDS], const void *salt)
+{
+    unsigned i = 0;
+    for (; i < B2B_PARAM_WORDS; i++)
+        ctx->H[i] = blake2b_iv[i] ^ P[i];
+    for (unsigned j = 0; j < B2B_SALT_WORDS; j++, i++)
+        ctx->H[i] = blake2b_iv[i] ^ read_le64((const u8 *)salt + j*8);
+    for (unsigned j = 0; j < B2B_PERS_WORDS; j++, i++)
+        ctx->H[i] = blake2b_iv[i] ^ read_le64(blake2b_pers_def + j*8);
+    ctx->t[0] = 0;
+    ctx->t[1] = 0;
+    ctx->f[0] = 0;
+    ctx->f[1] = 0;
+    ctx->digest_len = P[0] & 0xff;
+    ctx->buf_len = 0;
+    ctx->last_node = 0;
+}
+
+void blake2b_init_words(struct blake2b_ctx *ctx, const u64 P[B2B_PARAM_WORDS],
+                        const void *salt, const void *key, unsigned key_len)
+{
+    blake2b_init_ex(ctx, P, salt ? salt : blake2b_salt_def);
+    if (key_len) {
+        u8 key_block[B2B_BLOCK] = {0};
+        memcpy(key_block, key, key_len);
+        blake2b_update(ctx, key_block, B2B_BLOCK);
+        memset(key_block, 0, sizeof(key_block));
+    }
+}
+
+int blake2b_init_salted(struct blake2b_ctx *ctx, const void *salt,
+                        unsigned dig_len)
+{
+    const u64 P[B2B_PARAM_WORDS] = { B2B_FIRST_PARAM(dig_len,0) };
+    if (dig_len < 1 || dig_len > BLAKE2B_LEN) return -1;
+    blake2b_init_words(ctx, P, salt, NULL, 0);
+    return 0;
+}
+
+void blake2b_init(struct blake2b_ctx *ctx)
+{
+    const u64 P[B2B_PARAM_WORDS] = { B2B_FIRST_PARAM(BLAKE2B_LEN,0) };
+    blake2b_init_words(ctx, P, NULL, NULL, 0);
+}
+
+int blake2b_init_keyed(struct blake2b_ctx *ctx, const void *salt,
+                        const void *key, unsigned key_len, unsigned dig_len)
+{
+    const u64 P[B2B_PARAM_WORDS] = { B2B_FIRST_PARAM(dig_len,key_len) };
+
+    if (key_len < 1 || key_len > BLAKE2B_KEY_LEN)
+        return -1;
+    if (dig_len < 1 || dig_len > BLAKE2B_LEN)
+        return -1;
+
+    blake2b_init_words(ctx, P, salt, key, key_len);
+    return 1;
+}
+
+void blake2b(unsigned char *out, const void *src, size_t len)
+{
+    struct blake2b_ctx ctx;
+    blake2b_init(&ctx);
+    blake2b_update(&ctx, src, len);
+    blake2b_final(&ctx, out);
+}
+
+int blake2b_file(unsigned char *out, FILE *stream)
+{
+    struct blake2b_ctx ctx;
+    unsigned char buf[B2B_IO_CHUNKSIZ] ALIGN(64);
+    int ret = 1;
+
+    blake2b_init(&ctx);
+    while (1) {
+        size_t read = fread(buf, 1, B2B_IO_CHUNKSIZ, stream);
+        if (!read && ferror(stream)) {
+            ret = -1;
+            goto _out;
+        }
+        if (!read)
+            break;
+        blake2b_update(&ctx, buf, read);
+    }
+    blake2b_final(&ctx, out);
+_out:
+    return ret;
+}
@@ -0,0 +1,60 @@
+#ifndef BLAKE2B_H_
+#define BLAKE2B_H_
+
+#include <stddef.h>
+#include <stdint.h>
+#include <stdio.h>
+
+#include "blake2s.h"
+
+/* BLAKE2b: the 64-bit sibling of BLAKE2s, with the same API */
+#define BLAKE2B_LEN 64      /* digest length */
+#define BLAKE2B_KEY_LEN 64  /* max key length */
+#define BLAKE2B_SALT_LEN 16 /* salt length */
+#define BLAKE2B_BLOCK 128
+
+struct blake2b_ctx;
+
+/* blake2b_init_keyed: initialize BLAKE2b with key
+ *
+ * `salt`    must be NULL or BLAKE2B_SALT_LEN bytes
+ * `key_len` must be 1 to BLAKE2B_KEY_LEN
+ * `dig_len` must be 1 to BLAKE2B_LEN
+ *
+ * returns < 0 on parameter error
+ */
+ int blake2b_init_keyed(struct blake2b_ctx *ctx, const void *salt,
+                        const void *key, unsigned key_len, unsigned dig_len);
+/* blake2b_init_salted: like blake2b_init_keyed
+ * returns < 0 on parameter error
+ */
+ int blake2b_init_salted(struct blake2b_ctx *ctx, const void *salt,
+                         unsigned dig_len);
+void blake2b_init(struct blake2b_ctx *ctx);
+
+void blake2b_update(struct blake2b_ctx *ctx, const void *src, size_t len);
+void blake2b_final(struct blake2b_ctx *ctx, unsigned char *out);
+
+void blake2b(unsigned char *out, const void *src, size_t len);
+ int blake2b_file(unsigned char *out, FILE *stream);
+
+/* blake2b_set_kernel: as blake2s_set_kernel(), for BLAKE2b ("generic",
+ * "avx2"). The default is taken from the BLAKE2B_KERNEL environment
+ * variable.
+ *
+ * returns < 0 if the kernel is unknown or this CPU cannot run it
+ */
+ int blake2b_set_kernel(const char *name);
+const char *blake2b_get_kernel(void);
+
+struct blake2b_ctx {
+    uint64_t H[8]; /* 32-aligned */
+    unsigned char buf[BLAKE2B_BLOCK];
+    uint64_t t[2]; /* 16-aligned */
+    uint64_t f[2];
+    unsigned buf_len;
+    unsigned digest_len;
+    unsigned last_node; /* tree hashing: set f[1] with the final block */
+} ALIGN(32);
+
+#endif /* BLAKE2B_H_ */
@@ -0,0 +1,12049 @@
+	.file	"blake2b.c"
+# GNU C99 (Debian 12.2.0-14+deb12u1) version 12.2.0 (x86_64-linux-gnu)
+#	compiled by GNU C version 12.2.0, GMP version 6.2.1, MPFR version 4.2.0, MPC version 1.3.1, isl version isl-0.25-GMP
+
+# GGC heuristics: --param ggc-min-expand=100 --param ggc-min-heapsize=131072
+# options passed: -mtune=generic -march=x86-64 -g -O3 -std=c99 -fasynchronous-unwind-tables
+	.text
+.Ltext0:
+	.file 0 "/root/repo" "blake2b.c"
+	.p2align 4
+	.type	blake2b_init_ex, @function
+blake2b_init_ex:
+.LVL0:
+.LFB36:
+	.file 1 "blake2b.c"
+	.loc 1 114 1 view -0
+	.cfi_startproc
+	.loc 1 115 5 view .LVU1
+	.loc 1 116 5 view .LVU2
+	.loc 1 116 14 view .LVU3
+	.loc 1 117 9 view .LVU4
+# blake2b.c:114: {
+	.loc 1 114 1 is_stmt 0 view .LVU5
+	movq	%rsi, %rcx	# tmp130, P
+.LBB80:
+# blake2b.c:121:         ctx->H[i] = blake2b_iv[i] ^ read_le64(blake2b_pers_def + j*8);
+	.loc 1 121 19 view .LVU6
+	movdqa	.LC0(%rip), %xmm0	#, tmp124
+.LBE80:
+# blake2b.c:117:         ctx->H[i] = blake2b_iv[i] ^ P[i];
+	.loc 1 117 35 view .LVU7
+	movabsq	$7640891576956012808, %rsi	#, tmp103
+.LVL1:
+	.loc 1 117 35 view .LVU8
+	xorq	(%rcx), %rsi	# *P_34(D), tmp102
+# blake2b.c:117:         ctx->H[i] = blake2b_iv[i] ^ P[i];
+	.loc 1 117 19 view .LVU9
+	movq	%rsi, (%rdi)	# tmp102, ctx_29(D)->H[0]
+	.loc 1 116 20 is_stmt 1 view .LVU10
+.LVL2:
+	.loc 1 116 14 view .LVU11
+	.loc 1 117 9 view .LVU12
+# blake2b.c:117:         ctx->H[i] = blake2b_iv[i] ^ P[i];
+	.loc 1 117 35 is_stmt 0 view .LVU13
+	movabsq	$-4942790177534073029, %rsi	#, tmp107
+	xorq	8(%rcx), %rsi	# MEM[(const u64 *)P_34(D) + 8B], tmp106
+# blake2b.c:117:         ctx->H[i] = blake2b_iv[i] ^ P[i];
+	.loc 1 117 19 view .LVU14
+	movq	%rsi, 8(%rdi)	# tmp106, ctx_29(D)->H[1]
+	.loc 1 116 20 is_stmt 1 view .LVU15
+.LVL3:
+	.loc 1 116 14 view .LVU16
+	.loc 1 117 9 view .LVU17
+# blake2b.c:117:         ctx->H[i] = blake2b_iv[i] ^ P[i];
+	.loc 1 117 35 is_stmt 0 view .LVU18
+	movabsq	$4354685564936845355, %rsi	#, tmp111
+	xorq	16(%rcx), %rsi	# MEM[(const u64 *)P_34(D) + 16B], tmp110
+# blake2b.c:117:         ctx->H[i] = blake2b_iv[i] ^ P[i];
+	.loc 1 117 19 view .LVU19
+	movq	%rsi, 16(%rdi)	# tmp110, ctx_29(D)->H[2]
+	.loc 1 116 20 is_stmt 1 view .LVU20
+.LVL4:
+	.loc 1 116 14 view .LVU21
+	.loc 1 117 9 view .LVU22
+# blake2b.c:117:         ctx->H[i] = blake2b_iv[i] ^ P[i];
+	.loc 1 117 35 is_stmt 0 view .LVU23
+	movabsq	$-6534734903238641935, %rsi	#, tmp115
+	xorq	24(%rcx), %rsi	# MEM[(const u64 *)P_34(D) + 24B], tmp114
+# blake2b.c:117:         ctx->H[i] = blake2b_iv[i] ^ P[i];
+	.loc 1 117 19 view .LVU24
+	movq	%rsi, 24(%rdi)	# tmp114, ctx_29(D)->H[3]
+	.loc 1 116 20 is_stmt 1 view .LVU25
+.LVL5:
+	.loc 1 116 14 view .LVU26
+.LBB81:
+	.loc 1 118 28 view .LVU27
+	.loc 1 119 9 view .LVU28
+.LBB82:
+.LBI82:
+	.file 2 "blake2b-internal.h"
+	.loc 2 116 19 view .LVU29
+.LBB83:
+	.loc 2 118 5 view .LVU30
+	.loc 2 118 5 is_stmt 0 view .LVU31
+.LBE83:
+.LBE82:
+# blake2b.c:119:         ctx->H[i] = blake2b_iv[i] ^ read_le64((const u8 *)salt + j*8);
+	.loc 1 119 35 view .LVU32
+	movabsq	$5840696475078001361, %rsi	#, tmp119
+	xorq	(%rdx), %rsi	# MEM <long unsigned int> [(char * {ref-all})salt_42(D)], tmp118
+# blake2b.c:119:         ctx->H[i] = blake2b_iv[i] ^ read_le64((const u8 *)salt + j*8);
+	.loc 1 119 19 view .LVU33
+	movq	%rsi, 32(%rdi)	# tmp118, ctx_29(D)->H[4]
+.LVL6:
+	.loc 1 118 36 is_stmt 1 view .LVU34
+	.loc 1 118 28 view .LVU35
+	.loc 1 119 9 view .LVU36
+.LBB85:
+	.loc 2 116 19 view .LVU37
+.LBB84:
+	.loc 2 118 5 view .LVU38
+	.loc 2 118 5 is_stmt 0 view .LVU39
+.LBE84:
+.LBE85:
+# blake2b.c:119:         ctx->H[i] = blake2b_iv[i] ^ read_le64((const u8 *)salt + j*8);
+	.loc 1 119 35 view .LVU40
+	movabsq	$-7276294671716946913, %rsi	#, tmp123
+	xorq	8(%rdx), %rsi	# MEM <long unsigned int> [(char * {ref-all})salt_42(D) + 8B], tmp123
+.LBE81:
+.LBB86:
+# blake2b.c:121:         ctx->H[i] = blake2b_iv[i] ^ read_le64(blake2b_pers_def + j*8);
+	.loc 1 121 19 view .LVU41
+	movaps	%xmm0, 48(%rdi)	# tmp124, MEM <vector(2) long unsigned int> [(long unsigned int *)ctx_29(D) + 48B]
+.LVL7:
+	.loc 1 121 19 view .LVU42
+.LBE86:
+# blake2b.c:122:     ctx->t[0] = 0;
+	.loc 1 122 15 view .LVU43
+	pxor	%xmm0, %xmm0	# tmp125
+.LBB87:
+# blake2b.c:119:         ctx->H[i] = blake2b_iv[i] ^ read_le64((const u8 *)salt + j*8);
+	.loc 1 119 19 view .LVU44
+	movq	%rsi, 40(%rdi)	# tmp122, ctx_29(D)->H[5]
+	.loc 1 118 36 is_stmt 1 view .LVU45
+.LVL8:
+	.loc 1 118 28 view .LVU46
+	.loc 1 118 28 is_stmt 0 view .LVU47
+.LBE87:
+.LBB88:
+	.loc 1 120 28 is_stmt 1 view .LVU48
+	.loc 1 121 9 view .LVU49
+	.loc 1 120 36 view .LVU50
+	.loc 1 120 28 view .LVU51
+	.loc 1 121 9 view .LVU52
+	.loc 1 120 36 view .LVU53
+	.loc 1 120 28 view .LVU54
+.LBE88:
+	.loc 1 122 5 view .LVU55
+	.loc 1 123 5 view .LVU56
+	.loc 1 124 5 view .LVU57
+	.loc 1 125 5 view .LVU58
+# blake2b.c:122:     ctx->t[0] = 0;
+	.loc 1 122 15 is_stmt 0 view .LVU59
+	movaps	%xmm0, 192(%rdi)	# tmp125, MEM <vector(2) long unsigned int> [(long unsigned int *)ctx_29(D) + 192B]
+	movaps	%xmm0, 208(%rdi)	# tmp125, MEM <vector(2) long unsigned int> [(long unsigned int *)ctx_29(D) + 208B]
+	.loc 1 126 5 is_stmt 1 view .LVU60
+# blake2b.c:126:     ctx->digest_len = P[0] & 0xff;
+	.loc 1 126 28 is_stmt 0 view .LVU61
+	movzbl	(%rcx), %edx	# *P_34(D), tmp128
+.LVL9:
+# blake2b.c:127:     ctx->buf_len = 0;
+	.loc 1 127 18 view .LVU62
+	movl	$0, 224(%rdi)	#, ctx_29(D)->buf_len
+# blake2b.c:126:     ctx->digest_len = P[0] & 0xff;
+	.loc 1 126 28 view .LVU63
+	movl	%edx, 228(%rdi)	# tmp128, ctx_29(D)->digest_len
+	.loc 1 127 5 is_stmt 1 view .LVU64
+	.loc 1 128 5 view .LVU65
+# blake2b.c:128:     ctx->last_node = 0;
+	.loc 1 128 20 is_stmt 0 view .LVU66
+	movl	$0, 232(%rdi)	#, ctx_29(D)->last_node
+# blake2b.c:129: }
+	.loc 1 129 1 view .LVU67
+	ret	
+	.cfi_endproc
+.LFE36:
+	.size	blake2b_init_ex, .-blake2b_init_ex
+	.p2align 4
+	.globl	blake2b_update
+	.type	blake2b_update, @function
+blake2b_update:
+.LVL10:
+.LFB33:
+	.loc 1 61 1 is_stmt 1 view -0
+	.cfi_startproc
+	.loc 1 62 5 view .LVU69
+# blake2b.c:61: {
+	.loc 1 61 1 is_stmt 0 view .LVU70
+	pushq	%r15	#
+	.cfi_def_cfa_offset 16
+	.cfi_offset 15, -16
+	pushq	%r14	#
+	.cfi_def_cfa_offset 24
+	.cfi_offset 14, -24
+	pushq	%r13	#
+	.cfi_def_cfa_offset 32
+	.cfi_offset 13, -32
+	pushq	%r12	#
+	.cfi_def_cfa_offset 40
+	.cfi_offset 12, -40
+	movq	%rsi, %r12	# tmp140, src
+	pushq	%rbp	#
+	.cfi_def_cfa_offset 48
+	.cfi_offset 6, -48
+	movq	%rdi, %rbp	# tmp139, ctx
+	pushq	%rbx	#
+	.cfi_def_cfa_offset 56
+	.cfi_offset 3, -56
+.LBB102:
+.LBB103:
+# blake2b.c:53:     memcpy(ctx->buf + off, src, len);
+	.loc 1 53 12 view .LVU71
+	leaq	64(%rbp), %r15	#, pretmp_67
+.LBE103:
+.LBE102:
+# blake2b.c:61: {
+	.loc 1 61 1 view .LVU72
+	movq	%rdx, %rbx	# tmp141, len
+	subq	$8, %rsp	#,
+	.cfi_def_cfa_offset 64
+# blake2b.c:62:     unsigned rest = B2B_BLOCK - ctx->buf_len;
+	.loc 1 62 30 view .LVU73
+	movl	224(%rdi), %edi	# ctx_17(D)->buf_len,
+.LVL11:
+# blake2b.c:66:     if (ctx->buf_len + len <= B2B_BLOCK) {
+	.loc 1 66 22 view .LVU74
+	leaq	(%rdi,%rdx), %rax	#, tmp110
+# blake2b.c:62:     unsigned rest = B2B_BLOCK - ctx->buf_len;
+	.loc 1 62 30 view .LVU75
+	movq	%rdi, %r13	#,
+.LVL12:
+	.loc 1 63 5 is_stmt 1 view .LVU76
+	.loc 1 66 5 view .LVU77
+# blake2b.c:66:     if (ctx->buf_len + len <= B2B_BLOCK) {
+	.loc 1 66 8 is_stmt 0 view .LVU78
+	cmpq	$128, %rax	#, tmp110
+	jbe	.L11	#,
+	.loc 1 71 5 is_stmt 1 view .LVU79
+# blake2b.c:63:     size_t src_off = 0;
+	.loc 1 63 12 is_stmt 0 view .LVU80
+	xorl	%r14d, %r14d	# _4
+# blake2b.c:71:     if (ctx->buf_len) {
+	.loc 1 71 8 view .LVU81
+	testl	%edi, %edi	# _1
+	jne	.L12	#,
+.LVL13:
+.L6:
+	.loc 1 81 5 is_stmt 1 view .LVU82
+# blake2b.c:81:     if (len > B2B_BLOCK) {
+	.loc 1 81 8 is_stmt 0 view .LVU83
+	cmpq	$128, %rbx	#, len
+	ja	.L13	#,
+.LVL14:
+.L7:
+	.loc 1 88 5 is_stmt 1 view .LVU84
+.LBB106:
+.LBI106:
+	.loc 1 50 13 view .LVU85
+.LBB107:
+	.loc 1 53 5 view .LVU86
+	movq	%rbx, %rdx	# len,
+	movq	%r15, %rdi	# pretmp_67,
+	call	memcpy@PLT	#
+.LVL15:
+	.loc 1 54 5 view .LVU87
+.L5:
+	.loc 1 54 5 is_stmt 0 view .LVU88
+.LBE107:
+.LBE106:
+.LBB108:
+.LBB104:
+# blake2b.c:54:     ctx->buf_len = off + len;
+	.loc 1 54 18 view .LVU89
+	movl	%ebx, 224(%rbp)	# _43, ctx_17(D)->buf_len
+.LBE104:
+.LBE108:
+# blake2b.c:89: }
+	.loc 1 89 1 view .LVU90
+	addq	$8, %rsp	#,
+	.cfi_remember_state
+	.cfi_def_cfa_offset 56
+	popq	%rbx	#
+	.cfi_def_cfa_offset 48
+	popq	%rbp	#
+	.cfi_def_cfa_offset 40
+.LVL16:
+	.loc 1 89 1 view .LVU91
+	popq	%r12	#
+	.cfi_def_cfa_offset 32
+.LVL17:
+	.loc 1 89 1 view .LVU92
+	popq	%r13	#
+	.cfi_def_cfa_offset 24
+	popq	%r14	#
+	.cfi_def_cfa_offset 16
+	popq	%r15	#
+	.cfi_def_cfa_offset 8
+.LVL18:
+	.loc 1 89 1 view .LVU93
+	ret	
+.LVL19:
+	.p2align 4,,10
+	.p2align 3
+.L13:
+	.cfi_restore_state
+.LBB109:
+	.loc 1 82 9 is_stmt 1 view .LVU94
+# blake2b.c:82:         size_t nblocks = (len - 1) / B2B_BLOCK;
+	.loc 1 82 31 is_stmt 0 view .LVU95
+	leaq	-1(%rbx), %r13	#, _5
+.LVL20:
+	.loc 1 83 9 is_stmt 1 view .LVU96
+.LBB110:
+.LBI110:
+	.loc 2 75 20 view .LVU97
+.LBB111:
+	.loc 2 78 5 view .LVU98
+	movq	blake2b_kern(%rip), %rax	# blake2b_kern, blake2b_kern
+	movq	%rbp, %rdi	# ctx,
+.LBE111:
+.LBE110:
+# blake2b.c:82:         size_t nblocks = (len - 1) / B2B_BLOCK;
+	.loc 1 82 16 is_stmt 0 view .LVU99
+	movq	%r13, %rdx	# _5, nblocks
+# blake2b.c:84:         len -= nblocks * B2B_BLOCK;
+	.loc 1 84 24 view .LVU100
+	andq	$-128, %r13	#, _7
+.LVL21:
+# blake2b.c:84:         len -= nblocks * B2B_BLOCK;
+	.loc 1 84 13 view .LVU101
+	subq	%r13, %rbx	# _7, len
+.LVL22:
+# blake2b.c:85:         src_off += nblocks * B2B_BLOCK;
+	.loc 1 85 17 view .LVU102
+	addq	%r14, %r13	# _4, src_off
+# blake2b.c:82:         size_t nblocks = (len - 1) / B2B_BLOCK;
+	.loc 1 82 16 view .LVU103
+	shrq	$7, %rdx	#, nblocks
+.LVL23:
+.LBB113:
+.LBB112:
+# blake2b-internal.h:78:     blake2b_kern->compress_blocks(ctx, m, nblocks);
+	.loc 2 78 5 view .LVU104
+	call	*24(%rax)	# blake2b_kern.1_40->compress_blocks
+.LVL24:
+	.loc 2 78 5 view .LVU105
+.LBE112:
+.LBE113:
+	.loc 1 84 9 is_stmt 1 view .LVU106
+	.loc 1 85 9 view .LVU107
+	.loc 1 85 9 is_stmt 0 view .LVU108
+.LBE109:
+# blake2b.c:88:     bbstate_buf_set(ctx, (char *)src + src_off, len);
+	.loc 1 88 5 view .LVU109
+	leaq	(%r12,%r13), %rsi	#, prephitmp_54
+	jmp	.L7	#
+.LVL25:
+	.p2align 4,,10
+	.p2align 3
+.L12:
+	.loc 1 72 9 is_stmt 1 view .LVU110
+	movl	$128, %r14d	#, tmp118
+	subl	%edi, %r14d	# _1, _4
+.LVL26:
+.LBB114:
+.LBI114:
+	.loc 1 50 13 view .LVU111
+.LBB115:
+	.loc 1 53 5 view .LVU112
+	addq	%r15, %rdi	# pretmp_67, tmp119
+.LVL27:
+	.loc 1 53 5 is_stmt 0 view .LVU113
+	movq	%r14, %rdx	# _4,
+.LVL28:
+	.loc 1 53 5 view .LVU114
+.LBE115:
+.LBE114:
+# blake2b.c:74:         len -= rest;
+	.loc 1 74 13 view .LVU115
+	subq	%r14, %rbx	# _4, len
+.LVL29:
+.LBB118:
+.LBB116:
+# blake2b.c:53:     memcpy(ctx->buf + off, src, len);
+	.loc 1 53 5 view .LVU116
+	call	memcpy@PLT	#
+.LVL30:
+	.loc 1 54 5 is_stmt 1 view .LVU117
+.LBE116:
+.LBE118:
+.LBB119:
+.LBB120:
+# blake2b.c:41:     ctx->t[0] += inc;
+	.loc 1 41 15 is_stmt 0 view .LVU118
+	movq	192(%rbp), %rax	# ctx_17(D)->t[0], tmp143
+.LBE120:
+.LBE119:
+.LBB122:
+.LBB123:
+# blake2b-internal.h:72:     blake2b_kern->compress(ctx, m);
+	.loc 2 72 5 view .LVU119
+	movq	%r15, %rsi	# pretmp_67,
+	movq	%rbp, %rdi	# ctx,
+.LBE123:
+.LBE122:
+.LBB125:
+.LBB117:
+# blake2b.c:54:     ctx->buf_len = off + len;
+	.loc 1 54 18 view .LVU120
+	movl	$128, 224(%rbp)	#, ctx_17(D)->buf_len
+.LVL31:
+	.loc 1 54 18 view .LVU121
+.LBE117:
+.LBE125:
+	.loc 1 73 9 is_stmt 1 view .LVU122
+	.loc 1 74 9 view .LVU123
+	.loc 1 75 9 view .LVU124
+.LBB126:
+.LBI119:
+	.loc 1 39 13 view .LVU125
+.LBB121:
+	.loc 1 41 5 view .LVU126
+# blake2b.c:41:     ctx->t[0] += inc;
+	.loc 1 41 15 is_stmt 0 view .LVU127
+	subq	$-128, %rax	#, _33
+# blake2b.c:42:     ctx->t[1] += (ctx->t[0] < inc);
+	.loc 1 42 29 view .LVU128
+	cmpq	$127, %rax	#, _33
+# blake2b.c:41:     ctx->t[0] += inc;
+	.loc 1 41 15 view .LVU129
+	movq	%rax, 192(%rbp)	# _33, ctx_17(D)->t[0]
+	.loc 1 42 5 is_stmt 1 view .LVU130
+# blake2b.c:42:     ctx->t[1] += (ctx->t[0] < inc);
+	.loc 1 42 29 is_stmt 0 view .LVU131
+	setbe	%al	#, tmp126
+	movzbl	%al, %eax	# tmp126, tmp126
+# blake2b.c:42:     ctx->t[1] += (ctx->t[0] < inc);
+	.loc 1 42 15 view .LVU132
+	addq	%rax, 200(%rbp)	# tmp126, ctx_17(D)->t[1]
+.LVL32:
+	.loc 1 42 15 view .LVU133
+.LBE121:
+.LBE126:
+	.loc 1 76 9 is_stmt 1 view .LVU134
+.LBB127:
+.LBI122:
+	.loc 2 70 20 view .LVU135
+.LBB124:
+	.loc 2 72 5 view .LVU136
+	movq	blake2b_kern(%rip), %rax	# blake2b_kern, blake2b_kern
+	call	*16(%rax)	# blake2b_kern.0_30->compress
+.LVL33:
+	.loc 2 72 5 is_stmt 0 view .LVU137
+.LBE124:
+.LBE127:
+	.loc 1 77 9 is_stmt 1 view .LVU138
+.LBB128:
+# blake2b.c:83:         blake2b_compress_blocks(ctx, (char *)src + src_off, nblocks);
+	.loc 1 83 9 is_stmt 0 view .LVU139
+	leaq	(%r12,%r14), %rsi	#, prephitmp_54
+.LBE128:
+# blake2b.c:77:         ctx->buf_len = 0;
+	.loc 1 77 22 view .LVU140
+	movl	$0, 224(%rbp)	#, ctx_17(D)->buf_len
+	jmp	.L6	#
+.LVL34:
+	.p2align 4,,10
+	.p2align 3
+.L11:
+	.loc 1 67 9 is_stmt 1 view .LVU141
+.LBB129:
+.LBI102:
+	.loc 1 50 13 view .LVU142
+.LBB105:
+	.loc 1 53 5 view .LVU143
+	addq	%r15, %rdi	# pretmp_67, tmp111
+.LVL35:
+# blake2b.c:54:     ctx->buf_len = off + len;
+	.loc 1 54 24 is_stmt 0 view .LVU144
+	addl	%r13d, %ebx	# _1, _43
+# blake2b.c:53:     memcpy(ctx->buf + off, src, len);
+	.loc 1 53 5 view .LVU145
+	call	memcpy@PLT	#
+.LVL36:
+	.loc 1 54 5 is_stmt 1 view .LVU146
+	.loc 1 54 5 is_stmt 0 view .LVU147
+.LBE105:
+.LBE129:
+	.loc 1 68 9 is_stmt 1 view .LVU148
+	jmp	.L5	#
+	.cfi_endproc
+.LFE33:
+	.size	blake2b_update, .-blake2b_update
+	.p2align 4
+	.globl	blake2b_final
+	.type	blake2b_final, @function
+blake2b_final:
+.LVL37:
+.LFB35:
+	.loc 1 101 1 view -0
+	.cfi_startproc
+	.loc 1 102 5 view .LVU150
+.LBB145:
+.LBI145:
+	.loc 1 45 13 view .LVU151
+.LBB146:
+	.loc 1 47 5 view .LVU152
+.LBE146:
+.LBE145:
+# blake2b.c:101: {
+	.loc 1 101 1 is_stmt 0 view .LVU153
+	pushq	%r12	#
+	.cfi_def_cfa_offset 16
+	.cfi_offset 12, -16
+.LBB151:
+.LBB147:
+# blake2b.c:47:     memset(ctx->buf + ctx->buf_len, 0, B2B_BLOCK - ctx->buf_len);
+	.loc 1 47 5 view .LVU154
+	movl	$128, %edx	#, tmp115
+.LBE147:
+.LBE151:
+# blake2b.c:101: {
+	.loc 1 101 1 view .LVU155
+	pushq	%rbp	#
+	.cfi_def_cfa_offset 24
+	.cfi_offset 6, -24
+	movq	%rsi, %rbp	# tmp159, out
+.LBB152:
+.LBB148:
+# blake2b.c:47:     memset(ctx->buf + ctx->buf_len, 0, B2B_BLOCK - ctx->buf_len);
+	.loc 1 47 5 view .LVU156
+	xorl	%esi, %esi	#
+.LVL38:
+	.loc 1 47 5 view .LVU157
+.LBE148:
+.LBE152:
+# blake2b.c:101: {
+	.loc 1 101 1 view .LVU158
+	pushq	%rbx	#
+	.cfi_def_cfa_offset 32
+	.cfi_offset 3, -32
+	movq	%rdi, %rbx	# tmp158, ctx
+.LBB153:
+.LBB149:
+# blake2b.c:47:     memset(ctx->buf + ctx->buf_len, 0, B2B_BLOCK - ctx->buf_len);
+	.loc 1 47 12 view .LVU159
+	leaq	64(%rbx), %r12	#, _15
+.LBE149:
+.LBE153:
+# blake2b.c:101: {
+	.loc 1 101 1 view .LVU160
+	subq	$64, %rsp	#,
+	.cfi_def_cfa_offset 96
+.LBB154:
+.LBB150:
+# blake2b.c:47:     memset(ctx->buf + ctx->buf_len, 0, B2B_BLOCK - ctx->buf_len);
+	.loc 1 47 49 view .LVU161
+	movl	224(%rdi), %edi	# ctx_6(D)->buf_len,
+.LVL39:
+# blake2b.c:47:     memset(ctx->buf + ctx->buf_len, 0, B2B_BLOCK - ctx->buf_len);
+	.loc 1 47 5 view .LVU162
+	subl	%edi, %edx	# _12, tmp116
+	addq	%r12, %rdi	# _15, tmp118
+	call	memset@PLT	#
+.LVL40:
+	.loc 1 47 5 view .LVU163
+.LBE150:
+.LBE154:
+	.loc 1 103 5 is_stmt 1 view .LVU164
+# blake2b.c:104:     if (ctx->last_node)
+	.loc 1 104 8 is_stmt 0 view .LVU165
+	movl	232(%rbx), %eax	# ctx_6(D)->last_node,
+# blake2b.c:103:     ctx->f[0] = ~0ULL;
+	.loc 1 103 15 view .LVU166
+	movq	$-1, 208(%rbx)	#, ctx_6(D)->f[0]
+	.loc 1 104 5 is_stmt 1 view .LVU167
+# blake2b.c:104:     if (ctx->last_node)
+	.loc 1 104 8 is_stmt 0 view .LVU168
+	testl	%eax, %eax	#
+	je	.L15	#,
+	.loc 1 105 9 is_stmt 1 view .LVU169
+# blake2b.c:105:         ctx->f[1] = ~0ULL;
+	.loc 1 105 19 is_stmt 0 view .LVU170
+	movq	$-1, 216(%rbx)	#, ctx_6(D)->f[1]
+.L15:
+	.loc 1 106 5 is_stmt 1 view .LVU171
+.LVL41:
+.LBB155:
+.LBI155:
+	.loc 1 39 13 view .LVU172
+.LBB156:
+	.loc 1 41 5 view .LVU173
+.LBE156:
+.LBE155:
+# blake2b.c:106:     bbstate_inc_t(ctx, ctx->buf_len);
+	.loc 1 106 5 is_stmt 0 view .LVU174
+	movl	224(%rbx), %eax	# ctx_6(D)->buf_len, ctx_6(D)->buf_len
+.LVL42:
+.LBB159:
+.LBB157:
+# blake2b.c:41:     ctx->t[0] += inc;
+	.loc 1 41 15 view .LVU175
+	addq	%rax, 192(%rbx)	# ctx_6(D)->buf_len, ctx_6(D)->t[0]
+	.loc 1 42 5 is_stmt 1 view .LVU176
+.LBE157:
+.LBE159:
+.LBB160:
+.LBB161:
+# blake2b-internal.h:72:     blake2b_kern->compress(ctx, m);
+	.loc 2 72 5 is_stmt 0 view .LVU177
+	movq	%r12, %rsi	# _15,
+	movq	%rbx, %rdi	# ctx,
+	movq	blake2b_kern(%rip), %rax	# blake2b_kern, blake2b_kern
+.LVL43:
+	.loc 2 72 5 view .LVU178
+.LBE161:
+.LBE160:
+.LBB163:
+.LBB158:
+# blake2b.c:42:     ctx->t[1] += (ctx->t[0] < inc);
+	.loc 1 42 15 view .LVU179
+	adcq	$0, 200(%rbx)	# ctx_6(D)->t[1]
+.LVL44:
+	.loc 1 42 15 view .LVU180
+.LBE158:
+.LBE163:
+	.loc 1 107 5 is_stmt 1 view .LVU181
+.LBB164:
+.LBI160:
+	.loc 2 70 20 view .LVU182
+.LBB162:
+	.loc 2 72 5 view .LVU183
+	call	*16(%rax)	# blake2b_kern.0_18->compress
+.LVL45:
+	.loc 2 72 5 is_stmt 0 view .LVU184
+.LBE162:
+.LBE164:
+	.loc 1 108 5 is_stmt 1 view .LVU185
+.LBB165:
+.LBI165:
+	.loc 1 91 13 view .LVU186
+.LBB166:
+	.loc 1 93 5 view .LVU187
+	.loc 1 94 5 view .LVU188
+.LBB167:
+	.loc 1 94 10 view .LVU189
+	.loc 1 94 28 view .LVU190
+	.loc 1 95 9 view .LVU191
+.LBB168:
+.LBI168:
+	.loc 2 120 20 view .LVU192
+	.loc 2 122 5 view .LVU193
+.LBB169:
+.LBI169:
+	.file 3 "blake2s-internal.h"
+	.loc 3 222 20 view .LVU194
+.LBB170:
+	.loc 3 223 5 view .LVU195
+	.loc 3 224 5 view .LVU196
+	.loc 3 225 5 view .LVU197
+	.loc 3 226 5 view .LVU198
+	.loc 3 226 5 is_stmt 0 view .LVU199
+.LBE170:
+.LBE169:
+	.loc 2 123 5 is_stmt 1 view .LVU200
+.LBB187:
+.LBB171:
+# blake2s-internal.h:223:     *y++ = x & 0xff;
+	.loc 3 223 10 is_stmt 0 view .LVU201
+	movq	(%rbx), %rax	# MEM[(long unsigned int *)ctx_6(D)], MEM[(long unsigned int *)ctx_6(D)]
+.LBE171:
+.LBE187:
+.LBE168:
+.LBE167:
+# blake2b.c:96:     memcpy(out, digest, ctx->digest_len);
+	.loc 1 96 5 view .LVU202
+	movl	228(%rbx), %edx	# ctx_6(D)->digest_len, ctx_6(D)->digest_len
+	movq	%rbp, %rdi	# out,
+	movq	%rsp, %rsi	#, tmp141
+.LVL46:
+.LBB211:
+.LBB203:
+.LBB188:
+.LBB172:
+# blake2s-internal.h:223:     *y++ = x & 0xff;
+	.loc 3 223 10 view .LVU203
+	movq	%rax, (%rsp)	# MEM[(long unsigned int *)ctx_6(D)], MEM <unsigned long> [(unsigned char *)&digest]
+.LVL47:
+	.loc 3 223 10 view .LVU204
+.LBE172:
+.LBE188:
+.LBE203:
+	.loc 1 94 34 is_stmt 1 view .LVU205
+	.loc 1 94 28 view .LVU206
+	.loc 1 95 9 view .LVU207
+.LBB204:
+	.loc 2 120 20 view .LVU208
+	.loc 2 122 5 view .LVU209
+.LBB189:
+	.loc 3 222 20 view .LVU210
+.LBB173:
+	.loc 3 223 5 view .LVU211
+	.loc 3 224 5 view .LVU212
+	.loc 3 225 5 view .LVU213
+	.loc 3 226 5 view .LVU214
+	.loc 3 226 5 is_stmt 0 view .LVU215
+.LBE173:
+.LBE189:
+	.loc 2 123 5 is_stmt 1 view .LVU216
+.LBB190:
+.LBB174:
+# blake2s-internal.h:223:     *y++ = x & 0xff;
+	.loc 3 223 10 is_stmt 0 view .LVU217
+	movq	8(%rbx), %rax	# MEM[(long unsigned int *)ctx_6(D) + 8B], MEM[(long unsigned int *)ctx_6(D) + 8B]
+	movq	%rax, 8(%rsp)	# MEM[(long unsigned int *)ctx_6(D) + 8B], MEM <unsigned long> [(unsigned char *)&digest + 8B]
+.LVL48:
+	.loc 3 223 10 view .LVU218
+.LBE174:
+.LBE190:
+.LBE204:
+	.loc 1 94 34 is_stmt 1 view .LVU219
+	.loc 1 94 28 view .LVU220
+	.loc 1 95 9 view .LVU221
+.LBB205:
+	.loc 2 120 20 view .LVU222
+	.loc 2 122 5 view .LVU223
+.LBB191:
+	.loc 3 222 20 view .LVU224
+.LBB175:
+	.loc 3 223 5 view .LVU225
+	.loc 3 224 5 view .LVU226
+	.loc 3 225 5 view .LVU227
+	.loc 3 226 5 view .LVU228
+	.loc 3 226 5 is_stmt 0 view .LVU229
+.LBE175:
+.LBE191:
+	.loc 2 123 5 is_stmt 1 view .LVU230
+.LBB192:
+.LBB176:
+# blake2s-internal.h:223:     *y++ = x & 0xff;
+	.loc 3 223 10 is_stmt 0 view .LVU231
+	movq	16(%rbx), %rax	# MEM[(long unsigned int *)ctx_6(D) + 16B], MEM[(long unsigned int *)ctx_6(D) + 16B]
+	movq	%rax, 16(%rsp)	# MEM[(long unsigned int *)ctx_6(D) + 16B], MEM <unsigned long> [(unsigned char *)&digest + 16B]
+.LVL49:
+	.loc 3 223 10 view .LVU232
+.LBE176:
+.LBE192:
+.LBE205:
+	.loc 1 94 34 is_stmt 1 view .LVU233
+	.loc 1 94 28 view .LVU234
+	.loc 1 95 9 view .LVU235
+.LBB206:
+	.loc 2 120 20 view .LVU236
+	.loc 2 122 5 view .LVU237
+.LBB193:
+	.loc 3 222 20 view .LVU238
+.LBB177:
+	.loc 3 223 5 view .LVU239
+	.loc 3 224 5 view .LVU240
+	.loc 3 225 5 view .LVU241
+	.loc 3 226 5 view .LVU242
+	.loc 3 226 5 is_stmt 0 view .LVU243
+.LBE177:
+.LBE193:
+	.loc 2 123 5 is_stmt 1 view .LVU244
+.LBB194:
+.LBB178:
+# blake2s-internal.h:223:     *y++ = x & 0xff;
+	.loc 3 223 10 is_stmt 0 view .LVU245
+	movq	24(%rbx), %rax	# MEM[(long unsigned int *)ctx_6(D) + 24B], MEM[(long unsigned int *)ctx_6(D) + 24B]
+	movq	%rax, 24(%rsp)	# MEM[(long unsigned int *)ctx_6(D) + 24B], MEM <unsigned long> [(unsigned char *)&digest + 24B]
+.LVL50:
+	.loc 3 223 10 view .LVU246
+.LBE178:
+.LBE194:
+.LBE206:
+	.loc 1 94 34 is_stmt 1 view .LVU247
+	.loc 1 94 28 view .LVU248
+	.loc 1 95 9 view .LVU249
+.LBB207:
+	.loc 2 120 20 view .LVU250
+	.loc 2 122 5 view .LVU251
+.LBB195:
+	.loc 3 222 20 view .LVU252
+.LBB179:
+	.loc 3 223 5 view .LVU253
+	.loc 3 224 5 view .LVU254
+	.loc 3 225 5 view .LVU255
+	.loc 3 226 5 view .LVU256
+	.loc 3 226 5 is_stmt 0 view .LVU257
+.LBE179:
+.LBE195:
+	.loc 2 123 5 is_stmt 1 view .LVU258
+.LBB196:
+.LBB180:
+# blake2s-internal.h:223:     *y++ = x & 0xff;
+	.loc 3 223 10 is_stmt 0 view .LVU259
+	movq	32(%rbx), %rax	# MEM[(long unsigned int *)ctx_6(D) + 32B], MEM[(long unsigned int *)ctx_6(D) + 32B]
+	movq	%rax, 32(%rsp)	# MEM[(long unsigned int *)ctx_6(D) + 32B], MEM <unsigned long> [(unsigned char *)&digest + 32B]
+.LVL51:
+	.loc 3 223 10 view .LVU260
+.LBE180:
+.LBE196:
+.LBE207:
+	.loc 1 94 34 is_stmt 1 view .LVU261
+	.loc 1 94 28 view .LVU262
+	.loc 1 95 9 view .LVU263
+.LBB208:
+	.loc 2 120 20 view .LVU264
+	.loc 2 122 5 view .LVU265
+.LBB197:
+	.loc 3 222 20 view .LVU266
+.LBB181:
+	.loc 3 223 5 view .LVU267
+	.loc 3 224 5 view .LVU268
+	.loc 3 225 5 view .LVU269
+	.loc 3 226 5 view .LVU270
+	.loc 3 226 5 is_stmt 0 view .LVU271
+.LBE181:
+.LBE197:
+	.loc 2 123 5 is_stmt 1 view .LVU272
+.LBB198:
+.LBB182:
+# blake2s-internal.h:223:     *y++ = x & 0xff;
+	.loc 3 223 10 is_stmt 0 view .LVU273
+	movq	40(%rbx), %rax	# MEM[(long unsigned int *)ctx_6(D) + 40B], MEM[(long unsigned int *)ctx_6(D) + 40B]
+	movq	%rax, 40(%rsp)	# MEM[(long unsigned int *)ctx_6(D) + 40B], MEM <unsigned long> [(unsigned char *)&digest + 40B]
+.LVL52:
+	.loc 3 223 10 view .LVU274
+.LBE182:
+.LBE198:
+.LBE208:
+	.loc 1 94 34 is_stmt 1 view .LVU275
+	.loc 1 94 28 view .LVU276
+	.loc 1 95 9 view .LVU277
+.LBB209:
+	.loc 2 120 20 view .LVU278
+	.loc 2 122 5 view .LVU279
+.LBB199:
+	.loc 3 222 20 view .LVU280
+.LBB183:
+	.loc 3 223 5 view .LVU281
+	.loc 3 224 5 view .LVU282
+	.loc 3 225 5 view .LVU283
+	.loc 3 226 5 view .LVU284
+	.loc 3 226 5 is_stmt 0 view .LVU285
+.LBE183:
+.LBE199:
+	.loc 2 123 5 is_stmt 1 view .LVU286
+.LBB200:
+.LBB184:
+# blake2s-internal.h:223:     *y++ = x & 0xff;
+	.loc 3 223 10 is_stmt 0 view .LVU287
+	movq	48(%rbx), %rax	# MEM[(long unsigned int *)ctx_6(D) + 48B], MEM[(long unsigned int *)ctx_6(D) + 48B]
+	movq	%rax, 48(%rsp)	# MEM[(long unsigned int *)ctx_6(D) + 48B], MEM <unsigned long> [(unsigned char *)&digest + 48B]
+.LVL53:
+	.loc 3 223 10 view .LVU288
+.LBE184:
+.LBE200:
+.LBE209:
+	.loc 1 94 34 is_stmt 1 view .LVU289
+	.loc 1 94 28 view .LVU290
+	.loc 1 95 9 view .LVU291
+.LBB210:
+	.loc 2 120 20 view .LVU292
+	.loc 2 122 5 view .LVU293
+.LBB201:
+	.loc 3 222 20 view .LVU294
+.LBB185:
+	.loc 3 223 5 view .LVU295
+	.loc 3 224 5 view .LVU296
+	.loc 3 225 5 view .LVU297
+	.loc 3 226 5 view .LVU298
+	.loc 3 226 5 is_stmt 0 view .LVU299
+.LBE185:
+.LBE201:
+	.loc 2 123 5 is_stmt 1 view .LVU300
+.LBB202:
+.LBB186:
+# blake2s-internal.h:223:     *y++ = x & 0xff;
+	.loc 3 223 10 is_stmt 0 view .LVU301
+	movq	56(%rbx), %rax	# MEM[(long unsigned int *)ctx_6(D) + 56B], MEM[(long unsigned int *)ctx_6(D) + 56B]
+	movq	%rax, 56(%rsp)	# MEM[(long unsigned int *)ctx_6(D) + 56B], MEM <unsigned long> [(unsigned char *)&digest + 56B]
+.LVL54:
+	.loc 3 223 10 view .LVU302
+.LBE186:
+.LBE202:
+.LBE210:
+	.loc 1 94 34 is_stmt 1 view .LVU303
+	.loc 1 94 28 view .LVU304
+.LBE211:
+	.loc 1 96 5 view .LVU305
+	call	memcpy@PLT	#
+.LVL55:
+	.loc 1 97 5 view .LVU306
+	.loc 1 97 5 is_stmt 0 view .LVU307
+.LBE166:
+.LBE165:
+	.loc 1 109 5 is_stmt 1 view .LVU308
+	leaq	8(%rbx), %rdi	#, tmp153
+	movq	$0, (%rbx)	#,* ctx
+	xorl	%eax, %eax	# tmp149
+	movq	$0, 248(%rbx)	#,
+	andq	$-8, %rdi	#, tmp153
+	subq	%rdi, %rbx	# tmp153, ctx
+.LVL56:
+	.loc 1 109 5 is_stmt 0 view .LVU309
+	leal	256(%rbx), %ecx	#, tmp148
+	shrl	$3, %ecx	#,
+	rep stosq
+# blake2b.c:110: }
+	.loc 1 110 1 view .LVU310
+	addq	$64, %rsp	#,
+	.cfi_def_cfa_offset 32
+	popq	%rbx	#
+	.cfi_def_cfa_offset 24
+	popq	%rbp	#
+	.cfi_def_cfa_offset 16
+.LVL57:
+	.loc 1 110 1 view .LVU311
+	popq	%r12	#
+	.cfi_def_cfa_offset 8
+.LVL58:
+	.loc 1 110 1 view .LVU312
+	ret	
+	.cfi_endproc
+.LFE35:
+	.size	blake2b_final, .-blake2b_final
+	.p2align 4
+	.globl	blake2b_init_words
+	.type	blake2b_init_words, @function
+blake2b_init_words:
+.LVL59:
+.LFB37:
+	.loc 1 133 1 is_stmt 1 view -0
+	.cfi_startproc
+# blake2b.c:134:     blake2b_init_ex(ctx, P, salt ? salt : blake2b_salt_def);
+	.loc 1 134 5 is_stmt 0 view .LVU314
+	testq	%rdx, %rdx	# salt
+# blake2b.c:133: {
+	.loc 1 133 1 view .LVU315
+	movq	%rsi, %rax	# tmp150, P
+	.loc 1 134 5 is_stmt 1 view .LVU316
+# blake2b.c:133: {
+	.loc 1 133 1 is_stmt 0 view .LVU317
+	movq	%rdx, %rsi	# tmp151, salt
+.LVL60:
+.LBB231:
+.LBB232:
+.LBB233:
+# blake2b.c:121:         ctx->H[i] = blake2b_iv[i] ^ read_le64(blake2b_pers_def + j*8);
+	.loc 1 121 19 view .LVU318
+	movdqa	.LC0(%rip), %xmm0	#, tmp127
+.LBE233:
+.LBE232:
+.LBE231:
+# blake2b.c:134:     blake2b_init_ex(ctx, P, salt ? salt : blake2b_salt_def);
+	.loc 1 134 5 view .LVU319
+	leaq	blake2b_salt_def(%rip), %rdx	#, tmp140
+.LVL61:
+	.loc 1 134 5 view .LVU320
+	cmove	%rdx, %rsi	# salt,, tmp140, salt
+.LVL62:
+.LBB243:
+.LBI231:
+	.loc 1 112 13 is_stmt 1 view .LVU321
+.LBB242:
+	.loc 1 116 14 view .LVU322
+	.loc 1 117 9 view .LVU323
+# blake2b.c:117:         ctx->H[i] = blake2b_iv[i] ^ P[i];
+	.loc 1 117 35 is_stmt 0 view .LVU324
+	movabsq	$7640891576956012808, %rdx	#, tmp106
+	xorq	(%rax), %rdx	# *P_6(D), tmp105
+# blake2b.c:117:         ctx->H[i] = blake2b_iv[i] ^ P[i];
+	.loc 1 117 19 view .LVU325
+	movq	%rdx, (%rdi)	# tmp105, ctx_5(D)->H[0]
+	.loc 1 116 20 is_stmt 1 view .LVU326
+.LVL63:
+	.loc 1 116 14 view .LVU327
+	.loc 1 117 9 view .LVU328
+# blake2b.c:117:         ctx->H[i] = blake2b_iv[i] ^ P[i];
+	.loc 1 117 35 is_stmt 0 view .LVU329
+	movabsq	$-4942790177534073029, %rdx	#, tmp110
+	xorq	8(%rax), %rdx	# MEM[(const u64 *)P_6(D) + 8B], tmp109
+# blake2b.c:117:         ctx->H[i] = blake2b_iv[i] ^ P[i];
+	.loc 1 117 19 view .LVU330
+	movq	%rdx, 8(%rdi)	# tmp109, ctx_5(D)->H[1]
+	.loc 1 116 20 is_stmt 1 view .LVU331
+.LVL64:
+	.loc 1 116 14 view .LVU332
+	.loc 1 117 9 view .LVU333
+# blake2b.c:117:         ctx->H[i] = blake2b_iv[i] ^ P[i];
+	.loc 1 117 35 is_stmt 0 view .LVU334
+	movabsq	$4354685564936845355, %rdx	#, tmp114
+	xorq	16(%rax), %rdx	# MEM[(const u64 *)P_6(D) + 16B], tmp113
+# blake2b.c:117:         ctx->H[i] = blake2b_iv[i] ^ P[i];
+	.loc 1 117 19 view .LVU335
+	movq	%rdx, 16(%rdi)	# tmp113, ctx_5(D)->H[2]
+	.loc 1 116 20 is_stmt 1 view .LVU336
+.LVL65:
+	.loc 1 116 14 view .LVU337
+	.loc 1 117 9 view .LVU338
+# blake2b.c:117:         ctx->H[i] = blake2b_iv[i] ^ P[i];
+	.loc 1 117 35 is_stmt 0 view .LVU339
+	movabsq	$-6534734903238641935, %rdx	#, tmp118
+	xorq	24(%rax), %rdx	# MEM[(const u64 *)P_6(D) + 24B], tmp117
+# blake2b.c:117:         ctx->H[i] = blake2b_iv[i] ^ P[i];
+	.loc 1 117 19 view .LVU340
+	movq	%rdx, 24(%rdi)	# tmp117, ctx_5(D)->H[3]
+	.loc 1 116 20 is_stmt 1 view .LVU341
+.LVL66:
+	.loc 1 116 14 view .LVU342
+.LBB234:
+	.loc 1 118 28 view .LVU343
+	.loc 1 119 9 view .LVU344
+.LBB235:
+.LBI235:
+	.loc 2 116 19 view .LVU345
+.LBB236:
+	.loc 2 118 5 view .LVU346
+	.loc 2 118 5 is_stmt 0 view .LVU347
+.LBE236:
+.LBE235:
+# blake2b.c:119:         ctx->H[i] = blake2b_iv[i] ^ read_le64((const u8 *)salt + j*8);
+	.loc 1 119 35 view .LVU348
+	movabsq	$5840696475078001361, %rdx	#, tmp122
+	xorq	(%rsi), %rdx	# MEM <long unsigned int> [(char * {ref-all})iftmp.6_1], tmp121
+# blake2b.c:119:         ctx->H[i] = blake2b_iv[i] ^ read_le64((const u8 *)salt + j*8);
+	.loc 1 119 19 view .LVU349
+	movq	%rdx, 32(%rdi)	# tmp121, ctx_5(D)->H[4]
+.LVL67:
+	.loc 1 118 36 is_stmt 1 view .LVU350
+	.loc 1 118 28 view .LVU351
+	.loc 1 119 9 view .LVU352
+.LBB238:
+	.loc 2 116 19 view .LVU353
+.LBB237:
+	.loc 2 118 5 view .LVU354
+	.loc 2 118 5 is_stmt 0 view .LVU355
+.LBE237:
+.LBE238:
+# blake2b.c:119:         ctx->H[i] = blake2b_iv[i] ^ read_le64((const u8 *)salt + j*8);
+	.loc 1 119 35 view .LVU356
+	movabsq	$-7276294671716946913, %rdx	#, tmp126
+	xorq	8(%rsi), %rdx	# MEM <long unsigned int> [(char * {ref-all})iftmp.6_1 + 8B], tmp125
+.LBE234:
+.LBB239:
+# blake2b.c:121:         ctx->H[i] = blake2b_iv[i] ^ read_le64(blake2b_pers_def + j*8);
+	.loc 1 121 19 view .LVU357
+	movaps	%xmm0, 48(%rdi)	# tmp127, MEM <vector(2) long unsigned int> [(long unsigned int *)ctx_5(D) + 48B]
+.LVL68:
+	.loc 1 121 19 view .LVU358
+.LBE239:
+# blake2b.c:122:     ctx->t[0] = 0;
+	.loc 1 122 15 view .LVU359
+	pxor	%xmm0, %xmm0	# tmp128
+.LBB240:
+# blake2b.c:119:         ctx->H[i] = blake2b_iv[i] ^ read_le64((const u8 *)salt + j*8);
+	.loc 1 119 19 view .LVU360
+	movq	%rdx, 40(%rdi)	# tmp125, ctx_5(D)->H[5]
+	.loc 1 118 36 is_stmt 1 view .LVU361
+.LVL69:
+	.loc 1 118 28 view .LVU362
+	.loc 1 118 28 is_stmt 0 view .LVU363
+.LBE240:
+.LBB241:
+	.loc 1 120 28 is_stmt 1 view .LVU364
+	.loc 1 121 9 view .LVU365
+	.loc 1 120 36 view .LVU366
+	.loc 1 120 28 view .LVU367
+	.loc 1 121 9 view .LVU368
+	.loc 1 120 36 view .LVU369
+	.loc 1 120 28 view .LVU370
+.LBE241:
+	.loc 1 122 5 view .LVU371
+	.loc 1 123 5 view .LVU372
+	.loc 1 124 5 view .LVU373
+	.loc 1 125 5 view .LVU374
+# blake2b.c:122:     ctx->t[0] = 0;
+	.loc 1 122 15 is_stmt 0 view .LVU375
+	movaps	%xmm0, 192(%rdi)	# tmp128, MEM <vector(2) long unsigned int> [(long unsigned int *)ctx_5(D) + 192B]
+	movaps	%xmm0, 208(%rdi)	# tmp128, MEM <vector(2) long unsigned int> [(long unsigned int *)ctx_5(D) + 208B]
+	.loc 1 126 5 is_stmt 1 view .LVU376
+# blake2b.c:126:     ctx->digest_len = P[0] & 0xff;
+	.loc 1 126 28 is_stmt 0 view .LVU377
+	movzbl	(%rax), %eax	# *P_6(D), tmp131
+.LVL70:
+# blake2b.c:127:     ctx->buf_len = 0;
+	.loc 1 127 18 view .LVU378
+	movl	$0, 224(%rdi)	#, ctx_5(D)->buf_len
+# blake2b.c:126:     ctx->digest_len = P[0] & 0xff;
+	.loc 1 126 28 view .LVU379
+	movl	%eax, 228(%rdi)	# tmp131, ctx_5(D)->digest_len
+	.loc 1 127 5 is_stmt 1 view .LVU380
+	.loc 1 128 5 view .LVU381
+# blake2b.c:128:     ctx->last_node = 0;
+	.loc 1 128 20 is_stmt 0 view .LVU382
+	movl	$0, 232(%rdi)	#, ctx_5(D)->last_node
+.LVL71:
+	.loc 1 128 20 view .LVU383
+.LBE242:
+.LBE243:
+	.loc 1 135 5 is_stmt 1 view .LVU384
+# blake2b.c:135:     if (key_len) {
+	.loc 1 135 8 is_stmt 0 view .LVU385
+	testl	%r8d, %r8d	# key_len
+	jne	.L29	#,
+	ret	
+	.p2align 4,,10
+	.p2align 3
+.L29:
+# blake2b.c:133: {
+	.loc 1 133 1 view .LVU386
+	pushq	%rbx	#
+	.cfi_def_cfa_offset 16
+	.cfi_offset 3, -16
+.LBB244:
+.LBB245:
+.LBB246:
+# blake2b.c:136:         u8 key_block[B2B_BLOCK] = {0};
+	.loc 1 136 12 view .LVU387
+	pxor	%xmm0, %xmm0	# tmp141
+	movq	%rdi, %rbx	# tmp149, ctx
+.LVL72:
+	.loc 1 136 12 view .LVU388
+.LBE246:
+.LBE245:
+.LBI244:
+	.loc 1 131 6 is_stmt 1 view .LVU389
+.LBB249:
+.LBB247:
+	.loc 1 136 9 view .LVU390
+# blake2b.c:137:         memcpy(key_block, key, key_len);
+	.loc 1 137 9 is_stmt 0 view .LVU391
+	movl	%r8d, %edx	# key_len, key_len
+	movq	%rcx, %rsi	# key,
+.LBE247:
+.LBE249:
+.LBE244:
+# blake2b.c:133: {
+	.loc 1 133 1 view .LVU392
+	addq	$-128, %rsp	#,
+	.cfi_def_cfa_offset 144
+.LBB251:
+.LBB250:
+.LBB248:
+# blake2b.c:137:         memcpy(key_block, key, key_len);
+	.loc 1 137 9 view .LVU393
+	movq	%rsp, %rdi	#, tmp132
+.LVL73:
+# blake2b.c:136:         u8 key_block[B2B_BLOCK] = {0};
+	.loc 1 136 12 view .LVU394
+	movaps	%xmm0, (%rsp)	# tmp141, key_block
+	movaps	%xmm0, 16(%rsp)	# tmp141, key_block
+	movaps	%xmm0, 32(%rsp)	# tmp141, key_block
+	movaps	%xmm0, 48(%rsp)	# tmp141, key_block
+	movaps	%xmm0, 64(%rsp)	# tmp141, key_block
+	movaps	%xmm0, 80(%rsp)	# tmp141, key_block
+	movaps	%xmm0, 96(%rsp)	# tmp141, key_block
+	movaps	%xmm0, 112(%rsp)	# tmp141, key_block
+	.loc 1 137 9 is_stmt 1 view .LVU395
+	call	memcpy@PLT	#
+.LVL74:
+	.loc 1 138 9 view .LVU396
+	movq	%rbx, %rdi	# ctx,
+	movl	$128, %edx	#,
+	movq	%rax, %rsi	# tmp132,
+	call	blake2b_update	#
+.LVL75:
+	.loc 1 139 9 view .LVU397
+	.loc 1 139 9 is_stmt 0 view .LVU398
+.LBE248:
+.LBE250:
+.LBE251:
+# blake2b.c:141: }
+	.loc 1 141 1 view .LVU399
+	subq	$-128, %rsp	#,
+	.cfi_def_cfa_offset 16
+	popq	%rbx	#
+	.cfi_def_cfa_offset 8
+.LVL76:
+	.loc 1 141 1 view .LVU400
+	ret	
+	.cfi_endproc
+.LFE37:
+	.size	blake2b_init_words, .-blake2b_init_words
+	.p2align 4
+	.globl	blake2b_init_salted
+	.type	blake2b_init_salted, @function
+blake2b_init_salted:
+.LVL77:
+.LFB38:
+	.loc 1 145 1 is_stmt 1 view -0
+	.cfi_startproc
+	.loc 1 146 5 view .LVU402
+# blake2b.c:145: {
+	.loc 1 145 1 is_stmt 0 view .LVU403
+	movq	%rdi, %rax	# tmp115, ctx
+# blake2b.c:146:     const u64 P[B2B_PARAM_WORDS] = { B2B_FIRST_PARAM(dig_len,0) };
+	.loc 1 146 76 view .LVU404
+	movl	%edx, %ecx	# dig_len, _2
+# blake2b.c:147:     if (dig_len < 1 || dig_len > BLAKE2B_LEN) return -1;
+	.loc 1 147 21 view .LVU405
+	leal	-1(%rdx), %edi	#, tmp95
+.LVL78:
+# blake2b.c:146:     const u64 P[B2B_PARAM_WORDS] = { B2B_FIRST_PARAM(dig_len,0) };
+	.loc 1 146 76 view .LVU406
+	orl	$16842752, %ecx	#, _2
+	.loc 1 147 5 is_stmt 1 view .LVU407
+# blake2b.c:147:     if (dig_len < 1 || dig_len > BLAKE2B_LEN) return -1;
+	.loc 1 147 8 is_stmt 0 view .LVU408
+	cmpl	$63, %edi	#, tmp95
+	ja	.L33	#,
+	.loc 1 148 5 is_stmt 1 view .LVU409
+.LVL79:
+.LBB270:
+.LBI270:
+	.loc 1 131 6 view .LVU410
+.LBB271:
+	.loc 1 134 5 view .LVU411
+	testq	%rsi, %rsi	# salt
+	leaq	blake2b_salt_def(%rip), %rdi	#, tmp114
+.LBB272:
+.LBB273:
+# blake2b.c:122:     ctx->t[0] = 0;
+	.loc 1 122 15 is_stmt 0 view .LVU412
+	pxor	%xmm0, %xmm0	# tmp111
+.LBE273:
+.LBE272:
+# blake2b.c:134:     blake2b_init_ex(ctx, P, salt ? salt : blake2b_salt_def);
+	.loc 1 134 5 view .LVU413
+	cmove	%rdi, %rsi	# salt,, tmp114, salt
+.LVL80:
+.LBB285:
+.LBI272:
+	.loc 1 112 13 is_stmt 1 view .LVU414
+.LBB283:
+	.loc 1 116 14 view .LVU415
+	.loc 1 117 9 view .LVU416
+# blake2b.c:117:         ctx->H[i] = blake2b_iv[i] ^ P[i];
+	.loc 1 117 35 is_stmt 0 view .LVU417
+	movabsq	$7640891576956012808, %rdi	#, tmp96
+	xorq	%rdi, %rcx	# tmp96, tmp97
+# blake2b.c:117:         ctx->H[i] = blake2b_iv[i] ^ P[i];
+	.loc 1 117 19 view .LVU418
+	movabsq	$-4942790177534073029, %rdi	#, tmp120
+	movq	%rdi, 8(%rax)	# tmp120, ctx_10(D)->H[1]
+	movabsq	$4354685564936845355, %rdi	#, tmp121
+	movq	%rdi, 16(%rax)	# tmp121, ctx_10(D)->H[2]
+	movabsq	$-6534734903238641935, %rdi	#, tmp122
+# blake2b.c:117:         ctx->H[i] = blake2b_iv[i] ^ P[i];
+	.loc 1 117 35 view .LVU419
+	movq	%rcx, (%rax)	# tmp97, ctx_10(D)->H[0]
+	.loc 1 116 20 is_stmt 1 view .LVU420
+.LVL81:
+	.loc 1 116 14 view .LVU421
+	.loc 1 117 9 view .LVU422
+	.loc 1 116 20 view .LVU423
+	.loc 1 116 14 view .LVU424
+	.loc 1 117 9 view .LVU425
+	.loc 1 116 20 view .LVU426
+	.loc 1 116 14 view .LVU427
+	.loc 1 117 9 view .LVU428
+.LBB274:
+# blake2b.c:119:         ctx->H[i] = blake2b_iv[i] ^ read_le64((const u8 *)salt + j*8);
+	.loc 1 119 35 is_stmt 0 view .LVU429
+	movabsq	$5840696475078001361, %rcx	#, tmp104
+.LBE274:
+# blake2b.c:117:         ctx->H[i] = blake2b_iv[i] ^ P[i];
+	.loc 1 117 19 view .LVU430
+	movq	%rdi, 24(%rax)	# tmp122, ctx_10(D)->H[3]
+	.loc 1 116 20 is_stmt 1 view .LVU431
+.LVL82:
+	.loc 1 116 14 view .LVU432
+.LBB279:
+	.loc 1 118 28 view .LVU433
+	.loc 1 119 9 view .LVU434
+.LBB275:
+.LBI275:
+	.loc 2 116 19 view .LVU435
+.LBB276:
+	.loc 2 118 5 view .LVU436
+	.loc 2 118 5 is_stmt 0 view .LVU437
+.LBE276:
+.LBE275:
+# blake2b.c:119:         ctx->H[i] = blake2b_iv[i] ^ read_le64((const u8 *)salt + j*8);
+	.loc 1 119 35 view .LVU438
+	xorq	(%rsi), %rcx	# MEM <long unsigned int> [(char * {ref-all})iftmp.6_13], tmp103
+# blake2b.c:119:         ctx->H[i] = blake2b_iv[i] ^ read_le64((const u8 *)salt + j*8);
+	.loc 1 119 19 view .LVU439
+	movq	%rcx, 32(%rax)	# tmp103, ctx_10(D)->H[4]
+.LVL83:
+	.loc 1 118 36 is_stmt 1 view .LVU440
+	.loc 1 118 28 view .LVU441
+	.loc 1 119 9 view .LVU442
+.LBB278:
+	.loc 2 116 19 view .LVU443
+.LBB277:
+	.loc 2 118 5 view .LVU444
+	.loc 2 118 5 is_stmt 0 view .LVU445
+.LBE277:
+.LBE278:
+# blake2b.c:119:         ctx->H[i] = blake2b_iv[i] ^ read_le64((const u8 *)salt + j*8);
+	.loc 1 119 35 view .LVU446
+	movabsq	$-7276294671716946913, %rcx	#, tmp108
+	xorq	8(%rsi), %rcx	# MEM <long unsigned int> [(char * {ref-all})iftmp.6_13 + 8B], tmp107
+.LBE279:
+.LBB280:
+# blake2b.c:121:         ctx->H[i] = blake2b_iv[i] ^ read_le64(blake2b_pers_def + j*8);
+	.loc 1 121 19 view .LVU447
+	movabsq	$2270897969802886507, %rsi	#, tmp123
+.LVL84:
+	.loc 1 121 19 view .LVU448
+	movq	%rsi, 48(%rax)	# tmp123, ctx_10(D)->H[6]
+.LVL85:
+	.loc 1 121 19 view .LVU449
+	movabsq	$6620516959819538809, %rsi	#, tmp124
+.LBE280:
+.LBB281:
+# blake2b.c:119:         ctx->H[i] = blake2b_iv[i] ^ read_le64((const u8 *)salt + j*8);
+	.loc 1 119 19 view .LVU450
+	movq	%rcx, 40(%rax)	# tmp107, ctx_10(D)->H[5]
+	.loc 1 118 36 is_stmt 1 view .LVU451
+.LVL86:
+	.loc 1 118 28 view .LVU452
+	.loc 1 118 28 is_stmt 0 view .LVU453
+.LBE281:
+.LBB282:
+	.loc 1 120 28 is_stmt 1 view .LVU454
+	.loc 1 121 9 view .LVU455
+	.loc 1 120 36 view .LVU456
+	.loc 1 120 28 view .LVU457
+	.loc 1 121 9 view .LVU458
+# blake2b.c:121:         ctx->H[i] = blake2b_iv[i] ^ read_le64(blake2b_pers_def + j*8);
+	.loc 1 121 19 is_stmt 0 view .LVU459
+	movq	%rsi, 56(%rax)	# tmp124, ctx_10(D)->H[7]
+	.loc 1 120 36 is_stmt 1 view .LVU460
+.LVL87:
+	.loc 1 120 28 view .LVU461
+.LBE282:
+	.loc 1 122 5 view .LVU462
+	.loc 1 123 5 view .LVU463
+	.loc 1 124 5 view .LVU464
+	.loc 1 125 5 view .LVU465
+# blake2b.c:126:     ctx->digest_len = P[0] & 0xff;
+	.loc 1 126 21 is_stmt 0 view .LVU466
+	movl	%edx, 228(%rax)	# dig_len, ctx_10(D)->digest_len
+# blake2b.c:127:     ctx->buf_len = 0;
+	.loc 1 127 18 view .LVU467
+	movl	$0, 224(%rax)	#, ctx_10(D)->buf_len
+# blake2b.c:128:     ctx->last_node = 0;
+	.loc 1 128 20 view .LVU468
+	movl	$0, 232(%rax)	#, ctx_10(D)->last_node
+# blake2b.c:122:     ctx->t[0] = 0;
+	.loc 1 122 15 view .LVU469
+	movaps	%xmm0, 192(%rax)	# tmp111, MEM <vector(2) long unsigned int> [(long unsigned int *)ctx_10(D) + 192B]
+	movaps	%xmm0, 208(%rax)	# tmp111, MEM <vector(2) long unsigned int> [(long unsigned int *)ctx_10(D) + 208B]
+	.loc 1 126 5 is_stmt 1 view .LVU470
+	.loc 1 127 5 view .LVU471
+	.loc 1 128 5 view .LVU472
+.LBE283:
+.LBE285:
+.LBE271:
+.LBE270:
+# blake2b.c:149:     return 0;
+	.loc 1 149 12 is_stmt 0 view .LVU473
+	xorl	%eax, %eax	# <retval>
+.LVL88:
+.LBB288:
+.LBB287:
+.LBB286:
+.LBB284:
+# blake2b.c:129: }
+	.loc 1 129 1 view .LVU474
+	ret	
+.LVL89:
+.L33:
+	.loc 1 129 1 view .LVU475
+.LBE284:
+.LBE286:
+.LBE287:
+.LBE288:
+# blake2b.c:147:     if (dig_len < 1 || dig_len > BLAKE2B_LEN) return -1;
+	.loc 1 147 45 view .LVU476
+	movl	$-1, %eax	#, <retval>
+.LVL90:
+# blake2b.c:150: }
+	.loc 1 150 1 view .LVU477
+	ret	
+	.cfi_endproc
+.LFE38:
+	.size	blake2b_init_salted, .-blake2b_init_salted
+	.p2align 4
+	.globl	blake2b_init
+	.type	blake2b_init, @function
+blake2b_init:
+.LVL91:
+.LFB39:
+	.loc 1 153 1 is_stmt 1 view -0
+	.cfi_startproc
+	.loc 1 154 5 view .LVU479
+	.loc 1 155 5 view .LVU480
+.LBB307:
+.LBI307:
+	.loc 1 131 6 view .LVU481
+	.loc 1 134 5 view .LVU482
+.LBB308:
+.LBI308:
+	.loc 1 112 13 view .LVU483
+.LBB309:
+	.loc 1 116 14 view .LVU484
+	.loc 1 117 9 view .LVU485
+	.loc 1 116 20 view .LVU486
+	.loc 1 116 14 view .LVU487
+	.loc 1 117 9 view .LVU488
+	.loc 1 116 20 view .LVU489
+	.loc 1 116 14 view .LVU490
+	.loc 1 117 9 view .LVU491
+	.loc 1 116 20 view .LVU492
+	.loc 1 116 14 view .LVU493
+	.loc 1 117 9 view .LVU494
+	.loc 1 116 20 view .LVU495
+	.loc 1 116 14 view .LVU496
+	.loc 1 116 14 is_stmt 0 view .LVU497
+.LBE309:
+	.loc 1 118 28 is_stmt 1 view .LVU498
+	.loc 1 119 9 view .LVU499
+	.loc 1 118 36 view .LVU500
+	.loc 1 118 28 view .LVU501
+	.loc 1 119 9 view .LVU502
+	.loc 1 118 36 view .LVU503
+	.loc 1 118 28 view .LVU504
+	.loc 1 120 28 view .LVU505
+	.loc 1 121 9 view .LVU506
+	.loc 1 120 36 view .LVU507
+	.loc 1 120 28 view .LVU508
+	.loc 1 121 9 view .LVU509
+.LBB310:
+# blake2b.c:117:         ctx->H[i] = blake2b_iv[i] ^ P[i];
+	.loc 1 117 19 is_stmt 0 view .LVU510
+	movdqa	.LC3(%rip), %xmm0	#, tmp83
+# blake2b.c:127:     ctx->buf_len = 0;
+	.loc 1 127 18 view .LVU511
+	movq	.LC6(%rip), %rax	#, tmp89
+# blake2b.c:128:     ctx->last_node = 0;
+	.loc 1 128 20 view .LVU512
+	movl	$0, 232(%rdi)	#, ctx_4(D)->last_node
+# blake2b.c:117:         ctx->H[i] = blake2b_iv[i] ^ P[i];
+	.loc 1 117 19 view .LVU513
+	movaps	%xmm0, (%rdi)	# tmp83, MEM <vector(2) long unsigned int> [(long unsigned int *)ctx_4(D)]
+	movdqa	.LC4(%rip), %xmm0	#, tmp84
+# blake2b.c:127:     ctx->buf_len = 0;
+	.loc 1 127 18 view .LVU514
+	movq	%rax, 224(%rdi)	# tmp89, MEM <vector(2) unsigned int> [(unsigned int *)ctx_4(D) + 224B]
+# blake2b.c:117:         ctx->H[i] = blake2b_iv[i] ^ P[i];
+	.loc 1 117 19 view .LVU515
+	movaps	%xmm0, 16(%rdi)	# tmp84, MEM <vector(2) long unsigned int> [(long unsigned int *)ctx_4(D) + 16B]
+	movdqa	.LC5(%rip), %xmm0	#, tmp85
+	movaps	%xmm0, 32(%rdi)	# tmp85, MEM <vector(2) long unsigned int> [(long unsigned int *)ctx_4(D) + 32B]
+	movdqa	.LC0(%rip), %xmm0	#, tmp86
+	movaps	%xmm0, 48(%rdi)	# tmp86, MEM <vector(2) long unsigned int> [(long unsigned int *)ctx_4(D) + 48B]
+.LBE310:
+	.loc 1 120 36 is_stmt 1 view .LVU516
+.LVL92:
+	.loc 1 120 28 view .LVU517
+.LBB311:
+	.loc 1 122 5 view .LVU518
+	.loc 1 123 5 view .LVU519
+	.loc 1 124 5 view .LVU520
+	.loc 1 125 5 view .LVU521
+# blake2b.c:122:     ctx->t[0] = 0;
+	.loc 1 122 15 is_stmt 0 view .LVU522
+	pxor	%xmm0, %xmm0	# tmp87
+	movaps	%xmm0, 192(%rdi)	# tmp87, MEM <vector(2) long unsigned int> [(long unsigned int *)ctx_4(D) + 192B]
+	movaps	%xmm0, 208(%rdi)	# tmp87, MEM <vector(2) long unsigned int> [(long unsigned int *)ctx_4(D) + 208B]
+	.loc 1 126 5 is_stmt 1 view .LVU523
+	.loc 1 127 5 view .LVU524
+	.loc 1 128 5 view .LVU525
+.LVL93:
+	.loc 1 128 5 is_stmt 0 view .LVU526
+.LBE311:
+.LBE308:
+	.loc 1 135 5 is_stmt 1 view .LVU527
+	.loc 1 135 5 is_stmt 0 view .LVU528
+.LBE307:
+# blake2b.c:156: }
+	.loc 1 156 1 view .LVU529
+	ret	
+	.cfi_endproc
+.LFE39:
+	.size	blake2b_init, .-blake2b_init
+	.p2align 4
+	.globl	blake2b_init_keyed
+	.type	blake2b_init_keyed, @function
+blake2b_init_keyed:
+.LVL94:
+.LFB40:
+	.loc 1 160 1 is_stmt 1 view -0
+	.cfi_startproc
+	.loc 1 161 5 view .LVU531
+# blake2b.c:161:     const u64 P[B2B_PARAM_WORDS] = { B2B_FIRST_PARAM(dig_len,key_len) };
+	.loc 1 161 56 is_stmt 0 view .LVU532
+	movl	%ecx, %eax	# key_len, tmp96
+# blake2b.c:160: {
+	.loc 1 160 1 view .LVU533
+	subq	$168, %rsp	#,
+	.cfi_def_cfa_offset 176
+# blake2b.c:161:     const u64 P[B2B_PARAM_WORDS] = { B2B_FIRST_PARAM(dig_len,key_len) };
+	.loc 1 161 15 view .LVU534
+	pxor	%xmm0, %xmm0	# tmp95
+# blake2b.c:160: {
+	.loc 1 160 1 view .LVU535
+	movq	%rdx, %r10	# tmp136, key
+# blake2b.c:161:     const u64 P[B2B_PARAM_WORDS] = { B2B_FIRST_PARAM(dig_len,key_len) };
+	.loc 1 161 56 view .LVU536
+	sall	$8, %eax	#, tmp96
+# blake2b.c:163:     if (key_len < 1 || key_len > BLAKE2B_KEY_LEN)
+	.loc 1 163 21 view .LVU537
+	leal	-1(%rcx), %edx	#, tmp99
+.LVL95:
+# blake2b.c:161:     const u64 P[B2B_PARAM_WORDS] = { B2B_FIRST_PARAM(dig_len,key_len) };
+	.loc 1 161 15 view .LVU538
+	movups	%xmm0, 8(%rsp)	# tmp95, MEM <char[24]> [(u64[4] *)&P + 8B]
+	movq	$0, 24(%rsp)	#, MEM <char[24]> [(u64[4] *)&P + 8B]
+# blake2b.c:161:     const u64 P[B2B_PARAM_WORDS] = { B2B_FIRST_PARAM(dig_len,key_len) };
+	.loc 1 161 45 view .LVU539
+	orl	%r8d, %eax	# dig_len, tmp97
+# blake2b.c:161:     const u64 P[B2B_PARAM_WORDS] = { B2B_FIRST_PARAM(dig_len,key_len) };
+	.loc 1 161 82 view .LVU540
+	orl	$16842752, %eax	#,
+	movq	%rax, (%rsp)	# tmp141, P[0]
+	.loc 1 163 5 is_stmt 1 view .LVU541
+# blake2b.c:164:         return -1;
+	.loc 1 164 16 is_stmt 0 view .LVU542
+	movl	$-1, %eax	#, <retval>
+# blake2b.c:163:     if (key_len < 1 || key_len > BLAKE2B_KEY_LEN)
+	.loc 1 163 8 view .LVU543
+	cmpl	$63, %edx	#, tmp99
+	ja	.L35	#,
+	.loc 1 165 5 is_stmt 1 view .LVU544
+# blake2b.c:165:     if (dig_len < 1 || dig_len > BLAKE2B_LEN)
+	.loc 1 165 21 is_stmt 0 view .LVU545
+	subl	$1, %r8d	#, tmp100
+.LVL96:
+# blake2b.c:165:     if (dig_len < 1 || dig_len > BLAKE2B_LEN)
+	.loc 1 165 8 view .LVU546
+	cmpl	$63, %r8d	#, tmp100
+	jbe	.L58	#,
+.LVL97:
+.L35:
+# blake2b.c:170: }
+	.loc 1 170 1 view .LVU547
+	addq	$168, %rsp	#,
+	.cfi_remember_state
+	.cfi_def_cfa_offset 8
+	ret	
+.LVL98:
+	.p2align 4,,10
+	.p2align 3
+.L58:
+	.cfi_restore_state
+	.loc 1 170 1 view .LVU548
+	movl	%ecx, %r9d	# tmp137, key_len
+	.loc 1 168 5 is_stmt 1 view .LVU549
+.LVL99:
+.LBB317:
+.LBI317:
+	.loc 1 131 6 view .LVU550
+.LBB318:
+	.loc 1 134 5 view .LVU551
+	testq	%rsi, %rsi	# salt
+	je	.L37	#,
+.LVL100:
+	.loc 1 134 5 is_stmt 0 view .LVU552
+	movq	%rsp, %rax	#, tmp101
+.LVL101:
+	.loc 1 134 5 view .LVU553
+	movq	%rsi, %rdx	# salt,
+	movq	%rax, %rsi	# tmp101,
+.LVL102:
+	.loc 1 134 5 view .LVU554
+	call	blake2b_init_ex	#
+.LVL103:
+	.loc 1 135 5 is_stmt 1 view .LVU555
+.L38:
+.LBB319:
+.LBI319:
+	.loc 1 131 6 view .LVU556
+.LBB320:
+.LBB321:
+	.loc 1 136 9 view .LVU557
+# blake2b.c:136:         u8 key_block[B2B_BLOCK] = {0};
+	.loc 1 136 12 is_stmt 0 view .LVU558
+	pxor	%xmm0, %xmm0	# tmp126
+# blake2b.c:137:         memcpy(key_block, key, key_len);
+	.loc 1 137 9 view .LVU559
+	leaq	32(%rsp), %rsi	#, tmp125
+	movq	%r10, %rax	# key, key
+# blake2b.c:136:         u8 key_block[B2B_BLOCK] = {0};
+	.loc 1 136 12 view .LVU560
+	movaps	%xmm0, 32(%rsp)	# tmp126, key_block
+# blake2b.c:137:         memcpy(key_block, key, key_len);
+	.loc 1 137 9 view .LVU561
+	movq	%rsi, %rcx	# tmp125, tmp107
+# blake2b.c:136:         u8 key_block[B2B_BLOCK] = {0};
+	.loc 1 136 12 view .LVU562
+	movaps	%xmm0, 48(%rsp)	# tmp126, key_block
+	movaps	%xmm0, 64(%rsp)	# tmp126, key_block
+	movaps	%xmm0, 80(%rsp)	# tmp126, key_block
+	movaps	%xmm0, 96(%rsp)	# tmp126, key_block
+	movaps	%xmm0, 112(%rsp)	# tmp126, key_block
+	movaps	%xmm0, 128(%rsp)	# tmp126, key_block
+	movaps	%xmm0, 144(%rsp)	# tmp126, key_block
+	.loc 1 137 9 is_stmt 1 view .LVU563
+	cmpl	$8, %r9d	#, key_len
+	jnb	.L59	#,
+.L39:
+	.loc 1 137 9 is_stmt 0 view .LVU564
+	xorl	%edx, %edx	# tmp114
+	testb	$4, %r9b	#, key_len
+	jne	.L60	#,
+.L42:
+	testb	$2, %r9b	#, key_len
+	jne	.L61	#,
+.L43:
+	andl	$1, %r9d	#, key_len
+.LVL104:
+	.loc 1 137 9 view .LVU565
+	jne	.L62	#,
+.L44:
+	.loc 1 138 9 is_stmt 1 view .LVU566
+	movl	$128, %edx	#,
+	call	blake2b_update	#
+.LVL105:
+	.loc 1 139 9 view .LVU567
+.LBE321:
+.LBE320:
+.LBE319:
+.LBE318:
+.LBE317:
+# blake2b.c:169:     return 1;
+	.loc 1 169 12 is_stmt 0 view .LVU568
+	movl	$1, %eax	#, <retval>
+.LBB328:
+.LBB327:
+.LBB325:
+.LBB323:
+# blake2b.c:141: }
+	.loc 1 141 1 view .LVU569
+	jmp	.L35	#
+.LVL106:
+	.p2align 4,,10
+	.p2align 3
+.L37:
+	.loc 1 141 1 view .LVU570
+.LBE323:
+.LBE325:
+# blake2b.c:134:     blake2b_init_ex(ctx, P, salt ? salt : blake2b_salt_def);
+	.loc 1 134 5 view .LVU571
+	movq	%rsp, %rsi	#, tmp102
+.LVL107:
+	.loc 1 134 5 view .LVU572
+	leaq	blake2b_salt_def(%rip), %rdx	#, tmp103
+	call	blake2b_init_ex	#
+.LVL108:
+	.loc 1 135 5 is_stmt 1 view .LVU573
+	jmp	.L38	#
+.LVL109:
+	.p2align 4,,10
+	.p2align 3
+.L62:
+.LBB326:
+.LBB324:
+.LBB322:
+# blake2b.c:137:         memcpy(key_block, key, key_len);
+	.loc 1 137 9 is_stmt 0 view .LVU574
+	movzbl	(%rax,%rdx), %eax	#, tmp122
+	movb	%al, (%rcx,%rdx)	# tmp122,
+	jmp	.L44	#
+.LVL110:
+	.p2align 4,,10
+	.p2align 3
+.L61:
+	.loc 1 137 9 view .LVU575
+	movzwl	(%rax,%rdx), %r8d	#, tmp119
+	movw	%r8w, (%rcx,%rdx)	# tmp119,
+	addq	$2, %rdx	#, tmp114
+	jmp	.L43	#
+	.p2align 4,,10
+	.p2align 3
+.L60:
+	movl	(%rax), %edx	#* key, tmp116
+	movl	%edx, (%rcx)	# tmp116,
+	movl	$4, %edx	#, tmp114
+	jmp	.L42	#
+.LVL111:
+	.p2align 4,,10
+	.p2align 3
+.L59:
+	.loc 1 137 9 view .LVU576
+	movl	%r9d, %r8d	# key_len, tmp110
+	xorl	%eax, %eax	# tmp109
+.LVL112:
+	.loc 1 137 9 view .LVU577
+	andl	$-8, %r8d	#, tmp110
+.L40:
+	.loc 1 137 9 view .LVU578
+	movl	%eax, %edx	# tmp109, tmp111
+	addl	$8, %eax	#,
+	movq	(%r10,%rdx), %rcx	# MEM <char[1:(sizetype) _20]> [(void *)key_16(D)], tmp112
+	movq	%rcx, (%rsi,%rdx)	# tmp112, MEM <char[1:(sizetype) _20]> [(void *)&key_block]
+	cmpl	%r8d, %eax	# tmp110, tmp109
+	jb	.L40	#,
+	leaq	(%rsi,%rax), %rcx	#, tmp107
+	addq	%r10, %rax	# key, key
+	jmp	.L39	#
+.LBE322:
+.LBE324:
+.LBE326:
+.LBE327:
+.LBE328:
+	.cfi_endproc
+.LFE40:
+	.size	blake2b_init_keyed, .-blake2b_init_keyed
+	.p2align 4
+	.globl	blake2b
+	.type	blake2b, @function
+blake2b:
+.LVL113:
+.LFB41:
+	.loc 1 173 1 is_stmt 1 view -0
+	.cfi_startproc
+	.loc 1 174 5 view .LVU580
+	.loc 1 175 5 view .LVU581
+# blake2b.c:173: {
+	.loc 1 173 1 is_stmt 0 view .LVU582
+	pushq	%rbp	#
+	.cfi_def_cfa_offset 16
+	.cfi_offset 6, -16
+.LBB348:
+.LBB349:
+# blake2b.c:154:     const u64 P[B2B_PARAM_WORDS] = { B2B_FIRST_PARAM(BLAKE2B_LEN,0) };
+	.loc 1 154 15 view .LVU583
+	pxor	%xmm0, %xmm0	# tmp109
+.LBE349:
+.LBE348:
+# blake2b.c:173: {
+	.loc 1 173 1 view .LVU584
+	movq	%rsp, %rbp	#,
+	.cfi_def_cfa_register 6
+	pushq	%r15	#
+	pushq	%r14	#
+	pushq	%r13	#
+	pushq	%r12	#
+	.cfi_offset 15, -24
+	.cfi_offset 14, -32
+	.cfi_offset 13, -40
+	.cfi_offset 12, -48
+	movq	%rsi, %r12	# tmp156, src
+	pushq	%rbx	#
+	.cfi_offset 3, -56
+	movq	%rdx, %rbx	# tmp157, len
+.LBB361:
+.LBB358:
+.LBB350:
+.LBB351:
+# blake2b.c:134:     blake2b_init_ex(ctx, P, salt ? salt : blake2b_salt_def);
+	.loc 1 134 5 view .LVU585
+	leaq	blake2b_salt_def(%rip), %rdx	#, tmp112
+.LVL114:
+	.loc 1 134 5 view .LVU586
+.LBE351:
+.LBE350:
+.LBE358:
+.LBE361:
+# blake2b.c:173: {
+	.loc 1 173 1 view .LVU587
+	andq	$-32, %rsp	#,
+	subq	$320, %rsp	#,
+.LVL115:
+.LBB362:
+.LBI348:
+	.loc 1 152 6 is_stmt 1 view .LVU588
+.LBB359:
+	.loc 1 154 5 view .LVU589
+.LBB355:
+.LBB352:
+# blake2b.c:134:     blake2b_init_ex(ctx, P, salt ? salt : blake2b_salt_def);
+	.loc 1 134 5 is_stmt 0 view .LVU590
+	leaq	64(%rsp), %r13	#, tmp154
+.LVL116:
+	.loc 1 134 5 view .LVU591
+.LBE352:
+.LBE355:
+.LBE359:
+.LBE362:
+# blake2b.c:173: {
+	.loc 1 173 1 view .LVU592
+	movq	%rdi, 24(%rsp)	# tmp155, %sfp
+.LBB363:
+.LBB360:
+.LBB356:
+.LBB353:
+# blake2b.c:134:     blake2b_init_ex(ctx, P, salt ? salt : blake2b_salt_def);
+	.loc 1 134 5 view .LVU593
+	leaq	32(%rsp), %rsi	#, tmp110
+.LVL117:
+	.loc 1 134 5 view .LVU594
+	movq	%r13, %rdi	# tmp154,
+.LVL118:
+	.loc 1 134 5 view .LVU595
+.LBE353:
+.LBE356:
+# blake2b.c:154:     const u64 P[B2B_PARAM_WORDS] = { B2B_FIRST_PARAM(BLAKE2B_LEN,0) };
+	.loc 1 154 15 view .LVU596
+	movups	%xmm0, 40(%rsp)	# tmp109, MEM <char[24]> [(u64[4] *)&P + 8B]
+	movq	$0, 56(%rsp)	#, MEM <char[24]> [(u64[4] *)&P + 8B]
+	movq	$16842816, 32(%rsp)	#, P[0]
+	.loc 1 155 5 is_stmt 1 view .LVU597
+.LVL119:
+.LBB357:
+.LBI350:
+	.loc 1 131 6 view .LVU598
+.LBB354:
+	.loc 1 134 5 view .LVU599
+	call	blake2b_init_ex	#
+.LVL120:
+	.loc 1 135 5 view .LVU600
+	.loc 1 135 5 is_stmt 0 view .LVU601
+.LBE354:
+.LBE357:
+.LBE360:
+.LBE363:
+	.loc 1 176 5 is_stmt 1 view .LVU602
+.LBB364:
+.LBI364:
+	.loc 1 60 6 view .LVU603
+.LBB365:
+	.loc 1 62 5 view .LVU604
+# blake2b.c:62:     unsigned rest = B2B_BLOCK - ctx->buf_len;
+	.loc 1 62 30 is_stmt 0 view .LVU605
+	movl	288(%rsp), %edi	# ctx.buf_len,
+# blake2b.c:66:     if (ctx->buf_len + len <= B2B_BLOCK) {
+	.loc 1 66 22 view .LVU606
+	leaq	(%rbx,%rdi), %rax	#, tmp113
+# blake2b.c:62:     unsigned rest = B2B_BLOCK - ctx->buf_len;
+	.loc 1 62 30 view .LVU607
+	movq	%rdi, %r15	#,
+.LVL121:
+	.loc 1 63 5 is_stmt 1 view .LVU608
+	.loc 1 66 5 view .LVU609
+# blake2b.c:66:     if (ctx->buf_len + len <= B2B_BLOCK) {
+	.loc 1 66 8 is_stmt 0 view .LVU610
+	cmpq	$128, %rax	#, tmp113
+	jbe	.L70	#,
+	.loc 1 71 5 is_stmt 1 view .LVU611
+# blake2b.c:71:     if (ctx->buf_len) {
+	.loc 1 71 8 is_stmt 0 view .LVU612
+	testl	%edi, %edi	# _12
+	jne	.L71	#,
+	movq	%r12, %rsi	# src, prephitmp_21
+# blake2b.c:63:     size_t src_off = 0;
+	.loc 1 63 12 view .LVU613
+	xorl	%r14d, %r14d	# _20
+	leaq	128(%rsp), %r15	#, tmp153
+.LVL122:
+.L66:
+	.loc 1 81 5 is_stmt 1 view .LVU614
+# blake2b.c:81:     if (len > B2B_BLOCK) {
+	.loc 1 81 8 is_stmt 0 view .LVU615
+	cmpq	$128, %rbx	#, len
+	ja	.L72	#,
+.LVL123:
+.L67:
+	.loc 1 88 5 is_stmt 1 view .LVU616
+.LBB366:
+.LBI366:
+	.loc 1 50 13 view .LVU617
+.LBB367:
+	.loc 1 53 5 view .LVU618
+	movq	%rbx, %rdx	# len,
+	movq	%r15, %rdi	# tmp153,
+	call	memcpy@PLT	#
+.LVL124:
+	.loc 1 54 5 view .LVU619
+.L65:
+	.loc 1 54 5 is_stmt 0 view .LVU620
+.LBE367:
+.LBE366:
+.LBE365:
+.LBE364:
+# blake2b.c:177:     blake2b_final(&ctx, out);
+	.loc 1 177 5 view .LVU621
+	movq	24(%rsp), %rsi	# %sfp,
+	movq	%r13, %rdi	# tmp154,
+.LBB396:
+.LBB394:
+.LBB368:
+.LBB369:
+# blake2b.c:54:     ctx->buf_len = off + len;
+	.loc 1 54 18 view .LVU622
+	movl	%ebx, 288(%rsp)	# _46, ctx.buf_len
+.LVL125:
+	.loc 1 54 18 view .LVU623
+.LBE369:
+.LBE368:
+.LBE394:
+.LBE396:
+	.loc 1 177 5 is_stmt 1 view .LVU624
+	call	blake2b_final	#
+.LVL126:
+# blake2b.c:178: }
+	.loc 1 178 1 is_stmt 0 view .LVU625
+	leaq	-40(%rbp), %rsp	#,
+.LVL127:
+	.loc 1 178 1 view .LVU626
+	popq	%rbx	#
+	popq	%r12	#
+.LVL128:
+	.loc 1 178 1 view .LVU627
+	popq	%r13	#
+.LVL129:
+	.loc 1 178 1 view .LVU628
+	popq	%r14	#
+	popq	%r15	#
+	popq	%rbp	#
+	.cfi_remember_state
+	.cfi_def_cfa 7, 8
+.LVL130:
+	.loc 1 178 1 view .LVU629
+	ret	
+.LVL131:
+	.p2align 4,,10
+	.p2align 3
+.L72:
+	.cfi_restore_state
+.LBB397:
+.LBB395:
+.LBB371:
+	.loc 1 82 9 is_stmt 1 view .LVU630
+# blake2b.c:82:         size_t nblocks = (len - 1) / B2B_BLOCK;
+	.loc 1 82 31 is_stmt 0 view .LVU631
+	leaq	-1(%rbx), %rax	#, _33
+.LVL132:
+	.loc 1 83 9 is_stmt 1 view .LVU632
+.LBB372:
+.LBI372:
+	.loc 2 75 20 view .LVU633
+.LBB373:
+	.loc 2 78 5 view .LVU634
+	movq	blake2b_kern(%rip), %rcx	# blake2b_kern, blake2b_kern
+	movq	%r13, %rdi	# tmp154,
+.LBE373:
+.LBE372:
+# blake2b.c:82:         size_t nblocks = (len - 1) / B2B_BLOCK;
+	.loc 1 82 16 is_stmt 0 view .LVU635
+	movq	%rax, %rdx	# _33, nblocks
+	movq	%rax, 16(%rsp)	# _33, %sfp
+	shrq	$7, %rdx	#, nblocks
+.LVL133:
+.LBB375:
+.LBB374:
+# blake2b-internal.h:78:     blake2b_kern->compress_blocks(ctx, m, nblocks);
+	.loc 2 78 5 view .LVU636
+	call	*24(%rcx)	# blake2b_kern.1_37->compress_blocks
+.LVL134:
+	.loc 2 78 5 view .LVU637
+.LBE374:
+.LBE375:
+	.loc 1 84 9 is_stmt 1 view .LVU638
+# blake2b.c:84:         len -= nblocks * B2B_BLOCK;
+	.loc 1 84 24 is_stmt 0 view .LVU639
+	movq	16(%rsp), %rax	# %sfp, _33
+	andq	$-128, %rax	#, _39
+# blake2b.c:85:         src_off += nblocks * B2B_BLOCK;
+	.loc 1 85 17 view .LVU640
+	addq	%rax, %r14	# _39, src_off
+.LVL135:
+# blake2b.c:84:         len -= nblocks * B2B_BLOCK;
+	.loc 1 84 13 view .LVU641
+	subq	%rax, %rbx	# _39, len
+.LVL136:
+	.loc 1 85 9 is_stmt 1 view .LVU642
+	.loc 1 85 9 is_stmt 0 view .LVU643
+.LBE371:
+# blake2b.c:88:     bbstate_buf_set(ctx, (char *)src + src_off, len);
+	.loc 1 88 5 view .LVU644
+	leaq	(%r12,%r14), %rsi	#, prephitmp_21
+	jmp	.L67	#
+.LVL137:
+	.p2align 4,,10
+	.p2align 3
+.L71:
+	.loc 1 72 9 is_stmt 1 view .LVU645
+	movl	$128, %r14d	#, tmp123
+.LBB376:
+.LBB377:
+# blake2b.c:53:     memcpy(ctx->buf + off, src, len);
+	.loc 1 53 5 is_stmt 0 view .LVU646
+	leaq	128(%rsp), %r15	#, tmp153
+	movq	%r12, %rsi	# src,
+.LBE377:
+.LBE376:
+# blake2b.c:72:         bbstate_buf_append(ctx, src, rest);
+	.loc 1 72 9 view .LVU647
+	subl	%edi, %r14d	# _12, _20
+.LVL138:
+.LBB381:
+.LBI376:
+	.loc 1 50 13 is_stmt 1 view .LVU648
+.LBB378:
+	.loc 1 53 5 view .LVU649
+	addq	%r15, %rdi	# tmp153, tmp126
+.LVL139:
+	.loc 1 53 5 is_stmt 0 view .LVU650
+	movq	%r14, %rdx	# _20,
+.LBE378:
+.LBE381:
+# blake2b.c:74:         len -= rest;
+	.loc 1 74 13 view .LVU651
+	subq	%r14, %rbx	# _20, len
+.LVL140:
+.LBB382:
+.LBB379:
+# blake2b.c:53:     memcpy(ctx->buf + off, src, len);
+	.loc 1 53 5 view .LVU652
+	call	memcpy@PLT	#
+.LVL141:
+	.loc 1 54 5 is_stmt 1 view .LVU653
+.LBE379:
+.LBE382:
+.LBB383:
+.LBB384:
+# blake2b.c:41:     ctx->t[0] += inc;
+	.loc 1 41 15 is_stmt 0 view .LVU654
+	movq	256(%rsp), %rax	# ctx.t[0], tmp159
+.LBE384:
+.LBE383:
+.LBB386:
+.LBB387:
+# blake2b-internal.h:72:     blake2b_kern->compress(ctx, m);
+	.loc 2 72 5 view .LVU655
+	movq	%r15, %rsi	# tmp153,
+	movq	%r13, %rdi	# tmp154,
+.LBE387:
+.LBE386:
+.LBB389:
+.LBB380:
+# blake2b.c:54:     ctx->buf_len = off + len;
+	.loc 1 54 18 view .LVU656
+	movl	$128, 288(%rsp)	#, ctx.buf_len
+.LVL142:
+	.loc 1 54 18 view .LVU657
+.LBE380:
+.LBE389:
+	.loc 1 73 9 is_stmt 1 view .LVU658
+	.loc 1 74 9 view .LVU659
+	.loc 1 75 9 view .LVU660
+.LBB390:
+.LBI383:
+	.loc 1 39 13 view .LVU661
+.LBB385:
+	.loc 1 41 5 view .LVU662
+# blake2b.c:41:     ctx->t[0] += inc;
+	.loc 1 41 15 is_stmt 0 view .LVU663
+	subq	$-128, %rax	#, _25
+# blake2b.c:42:     ctx->t[1] += (ctx->t[0] < inc);
+	.loc 1 42 29 view .LVU664
+	cmpq	$127, %rax	#, _25
+# blake2b.c:41:     ctx->t[0] += inc;
+	.loc 1 41 15 view .LVU665
+	movq	%rax, 256(%rsp)	# _25, ctx.t[0]
+	.loc 1 42 5 is_stmt 1 view .LVU666
+# blake2b.c:42:     ctx->t[1] += (ctx->t[0] < inc);
+	.loc 1 42 29 is_stmt 0 view .LVU667
+	setbe	%al	#, tmp133
+	movzbl	%al, %eax	# tmp133, tmp133
+# blake2b.c:42:     ctx->t[1] += (ctx->t[0] < inc);
+	.loc 1 42 15 view .LVU668
+	addq	%rax, 264(%rsp)	# tmp133, ctx.t[1]
+.LVL143:
+	.loc 1 42 15 view .LVU669
+.LBE385:
+.LBE390:
+	.loc 1 76 9 is_stmt 1 view .LVU670
+.LBB391:
+.LBI386:
+	.loc 2 70 20 view .LVU671
+.LBB388:
+	.loc 2 72 5 view .LVU672
+	movq	blake2b_kern(%rip), %rax	# blake2b_kern, blake2b_kern
+	call	*16(%rax)	# blake2b_kern.0_30->compress
+.LVL144:
+	.loc 2 72 5 is_stmt 0 view .LVU673
+.LBE388:
+.LBE391:
+	.loc 1 77 9 is_stmt 1 view .LVU674
+.LBB392:
+# blake2b.c:83:         blake2b_compress_blocks(ctx, (char *)src + src_off, nblocks);
+	.loc 1 83 9 is_stmt 0 view .LVU675
+	leaq	(%r12,%r14), %rsi	#, prephitmp_21
+.LBE392:
+# blake2b.c:77:         ctx->buf_len = 0;
+	.loc 1 77 22 view .LVU676
+	movl	$0, 288(%rsp)	#, ctx.buf_len
+	jmp	.L66	#
+.LVL145:
+	.p2align 4,,10
+	.p2align 3
+.L70:
+	.loc 1 67 9 is_stmt 1 view .LVU677
+.LBB393:
+.LBI368:
+	.loc 1 50 13 view .LVU678
+.LBB370:
+	.loc 1 53 5 view .LVU679
+	movq	%rbx, %rdx	# len,
+	leaq	128(%rsp,%rdi), %rdi	#, tmp116
+.LVL146:
+	.loc 1 53 5 is_stmt 0 view .LVU680
+	movq	%r12, %rsi	# src,
+# blake2b.c:54:     ctx->buf_len = off + len;
+	.loc 1 54 24 view .LVU681
+	addl	%r15d, %ebx	# _12, _46
+.LVL147:
+# blake2b.c:53:     memcpy(ctx->buf + off, src, len);
+	.loc 1 53 5 view .LVU682
+	call	memcpy@PLT	#
+.LVL148:
+	.loc 1 54 5 is_stmt 1 view .LVU683
+	.loc 1 54 5 is_stmt 0 view .LVU684
+.LBE370:
+.LBE393:
+	.loc 1 68 9 is_stmt 1 view .LVU685
+	jmp	.L65	#
+.LBE395:
+.LBE397:
+	.cfi_endproc
+.LFE41:
+	.size	blake2b, .-blake2b
+	.p2align 4
+	.globl	blake2b_file
+	.type	blake2b_file, @function
+blake2b_file:
+.LVL149:
+.LFB42:
+	.loc 1 181 1 view -0
+	.cfi_startproc
+	.loc 1 182 5 view .LVU687
+	.loc 1 183 5 view .LVU688
+	.loc 1 184 5 view .LVU689
+	.loc 1 186 5 view .LVU690
+# blake2b.c:181: {
+	.loc 1 181 1 is_stmt 0 view .LVU691
+	pushq	%rbp	#
+	.cfi_def_cfa_offset 16
+	.cfi_offset 6, -16
+.LBB418:
+.LBB419:
+# blake2b.c:154:     const u64 P[B2B_PARAM_WORDS] = { B2B_FIRST_PARAM(BLAKE2B_LEN,0) };
+	.loc 1 154 15 view .LVU692
+	pxor	%xmm0, %xmm0	# tmp111
+.LBB420:
+.LBB421:
+# blake2b.c:134:     blake2b_init_ex(ctx, P, salt ? salt : blake2b_salt_def);
+	.loc 1 134 5 view .LVU693
+	leaq	blake2b_salt_def(%rip), %rdx	#, tmp114
+.LBE421:
+.LBE420:
+.LBE419:
+.LBE418:
+# blake2b.c:181: {
+	.loc 1 181 1 view .LVU694
+	movq	%rsp, %rbp	#,
+	.cfi_def_cfa_register 6
+	pushq	%r15	#
+	pushq	%r14	#
+	.cfi_offset 15, -24
+	.cfi_offset 14, -32
+	movq	%rsi, %r14	# tmp166, stream
+	pushq	%r13	#
+	pushq	%r12	#
+	pushq	%rbx	#
+	andq	$-64, %rsp	#,
+	subq	$8512, %rsp	#,
+	.cfi_offset 13, -40
+	.cfi_offset 12, -48
+	.cfi_offset 3, -56
+.LVL150:
+.LBB434:
+.LBI418:
+	.loc 1 152 6 is_stmt 1 view .LVU695
+.LBB432:
+	.loc 1 154 5 view .LVU696
+.LBB427:
+.LBB422:
+# blake2b.c:134:     blake2b_init_ex(ctx, P, salt ? salt : blake2b_salt_def);
+	.loc 1 134 5 is_stmt 0 view .LVU697
+	leaq	320(%rsp), %r12	#, tmp162
+.LBE422:
+.LBE427:
+.LBE432:
+.LBE434:
+# blake2b.c:181: {
+	.loc 1 181 1 view .LVU698
+	movq	%rdi, 40(%rsp)	# tmp165, %sfp
+.LBB435:
+.LBB433:
+.LBB428:
+.LBB423:
+# blake2b.c:134:     blake2b_init_ex(ctx, P, salt ? salt : blake2b_salt_def);
+	.loc 1 134 5 view .LVU699
+	leaq	64(%rsp), %rdi	#, tmp163
+.LVL151:
+	.loc 1 134 5 view .LVU700
+.LBE423:
+.LBE428:
+# blake2b.c:154:     const u64 P[B2B_PARAM_WORDS] = { B2B_FIRST_PARAM(BLAKE2B_LEN,0) };
+	.loc 1 154 15 view .LVU701
+	movq	$0, 344(%rsp)	#, MEM <char[24]> [(u64[4] *)_67]
+.LBB429:
+.LBB424:
+# blake2b.c:134:     blake2b_init_ex(ctx, P, salt ? salt : blake2b_salt_def);
+	.loc 1 134 5 view .LVU702
+	movq	%r12, %rsi	# tmp162,
+.LVL152:
+	.loc 1 134 5 view .LVU703
+.LBE424:
+.LBE429:
+# blake2b.c:154:     const u64 P[B2B_PARAM_WORDS] = { B2B_FIRST_PARAM(BLAKE2B_LEN,0) };
+	.loc 1 154 15 view .LVU704
+	movq	$16842816, 320(%rsp)	#, MEM[(u64[4] *)_67][0]
+	.loc 1 155 5 is_stmt 1 view .LVU705
+.LVL153:
+.LBB430:
+.LBI420:
+	.loc 1 131 6 view .LVU706
+.LBB425:
+	.loc 1 134 5 view .LVU707
+.LBE425:
+.LBE430:
+# blake2b.c:154:     const u64 P[B2B_PARAM_WORDS] = { B2B_FIRST_PARAM(BLAKE2B_LEN,0) };
+	.loc 1 154 15 is_stmt 0 view .LVU708
+	movups	%xmm0, 328(%rsp)	# tmp111, MEM <char[24]> [(u64[4] *)_67]
+.LBB431:
+.LBB426:
+# blake2b.c:134:     blake2b_init_ex(ctx, P, salt ? salt : blake2b_salt_def);
+	.loc 1 134 5 view .LVU709
+	movq	%rdi, 56(%rsp)	# tmp163, %sfp
+	call	blake2b_init_ex	#
+.LVL154:
+	.loc 1 135 5 is_stmt 1 view .LVU710
+	.loc 1 135 5 is_stmt 0 view .LVU711
+.LBE426:
+.LBE431:
+# blake2b.c:156: }
+	.loc 1 156 1 view .LVU712
+	jmp	.L74	#
+.LVL155:
+	.p2align 4,,10
+	.p2align 3
+.L83:
+	.loc 1 156 1 view .LVU713
+.LBE433:
+.LBE435:
+.LBB436:
+.LBB437:
+.LBB438:
+	movq	%r12, %rsi	# tmp162, prephitmp_51
+# blake2b.c:63:     size_t src_off = 0;
+	.loc 1 63 12 view .LVU714
+	xorl	%ebx, %ebx	# _27
+	leaq	128(%rsp), %r13	#, tmp161
+.LVL156:
+.L80:
+	.loc 1 81 5 is_stmt 1 view .LVU715
+# blake2b.c:81:     if (len > B2B_BLOCK) {
+	.loc 1 81 8 is_stmt 0 view .LVU716
+	cmpq	$128, %r15	#, len
+	jbe	.L81	#,
+.LBB439:
+	.loc 1 82 9 is_stmt 1 view .LVU717
+# blake2b.c:82:         size_t nblocks = (len - 1) / B2B_BLOCK;
+	.loc 1 82 31 is_stmt 0 view .LVU718
+	leaq	-1(%r15), %rax	#, _40
+.LVL157:
+	.loc 1 83 9 is_stmt 1 view .LVU719
+.LBB440:
+.LBI440:
+	.loc 2 75 20 view .LVU720
+.LBB441:
+	.loc 2 78 5 view .LVU721
+	movq	blake2b_kern(%rip), %r8	# blake2b_kern, blake2b_kern
+	movq	56(%rsp), %rdi	# %sfp,
+.LBE441:
+.LBE440:
+# blake2b.c:82:         size_t nblocks = (len - 1) / B2B_BLOCK;
+	.loc 1 82 16 is_stmt 0 view .LVU722
+	movq	%rax, %rdx	# _40, nblocks
+	movq	%rax, 48(%rsp)	# _40, %sfp
+	shrq	$7, %rdx	#, nblocks
+.LVL158:
+.LBB443:
+.LBB442:
+# blake2b-internal.h:78:     blake2b_kern->compress_blocks(ctx, m, nblocks);
+	.loc 2 78 5 view .LVU723
+	call	*24(%r8)	# blake2b_kern.1_44->compress_blocks
+.LVL159:
+	.loc 2 78 5 view .LVU724
+.LBE442:
+.LBE443:
+	.loc 1 84 9 is_stmt 1 view .LVU725
+# blake2b.c:84:         len -= nblocks * B2B_BLOCK;
+	.loc 1 84 24 is_stmt 0 view .LVU726
+	movq	48(%rsp), %rax	# %sfp, _40
+	andq	$-128, %rax	#, _46
+# blake2b.c:85:         src_off += nblocks * B2B_BLOCK;
+	.loc 1 85 17 view .LVU727
+	addq	%rax, %rbx	# _46, src_off
+.LVL160:
+# blake2b.c:84:         len -= nblocks * B2B_BLOCK;
+	.loc 1 84 13 view .LVU728
+	subq	%rax, %r15	# _46, len
+.LVL161:
+	.loc 1 85 9 is_stmt 1 view .LVU729
+	.loc 1 85 9 is_stmt 0 view .LVU730
+.LBE439:
+# blake2b.c:88:     bbstate_buf_set(ctx, (char *)src + src_off, len);
+	.loc 1 88 5 view .LVU731
+	leaq	(%r12,%rbx), %rsi	#, prephitmp_51
+.LVL162:
+.L81:
+	.loc 1 88 5 is_stmt 1 view .LVU732
+.LBB444:
+.LBI444:
+	.loc 1 50 13 view .LVU733
+.LBB445:
+	.loc 1 53 5 view .LVU734
+	movq	%r15, %rdx	# len,
+	movq	%r13, %rdi	# tmp161,
+	call	memcpy@PLT	#
+.LVL163:
+	.loc 1 54 5 view .LVU735
+# blake2b.c:54:     ctx->buf_len = off + len;
+	.loc 1 54 24 is_stmt 0 view .LVU736
+	movl	%r15d, %ecx	# len, _53
+.LVL164:
+.L79:
+# blake2b.c:54:     ctx->buf_len = off + len;
+	.loc 1 54 18 view .LVU737
+	movl	%ecx, 288(%rsp)	# _53, ctx.buf_len
+.LVL165:
+.L74:
+	.loc 1 54 18 view .LVU738
+.LBE445:
+.LBE444:
+.LBE438:
+.LBE437:
+.LBE436:
+	.loc 1 187 5 is_stmt 1 view .LVU739
+.LBB471:
+	.loc 1 188 9 view .LVU740
+# blake2b.c:188:         size_t read = fread(buf, 1, B2B_IO_CHUNKSIZ, stream);
+	.loc 1 188 23 is_stmt 0 view .LVU741
+	movq	%r14, %rcx	# stream,
+	movl	$8192, %edx	#,
+	movl	$1, %esi	#,
+	movq	%r12, %rdi	# tmp162,
+	call	fread@PLT	#
+.LVL166:
+	movq	%rax, %r15	# tmp167, len
+.LVL167:
+	.loc 1 189 9 is_stmt 1 view .LVU742
+# blake2b.c:189:         if (!read && ferror(stream)) {
+	.loc 1 189 12 is_stmt 0 view .LVU743
+	testq	%rax, %rax	# len
+	je	.L86	#,
+	.loc 1 193 9 is_stmt 1 view .LVU744
+	.loc 1 195 9 view .LVU745
+.LVL168:
+.LBB470:
+.LBI437:
+	.loc 1 60 6 view .LVU746
+.LBB469:
+	.loc 1 62 5 view .LVU747
+# blake2b.c:62:     unsigned rest = B2B_BLOCK - ctx->buf_len;
+	.loc 1 62 30 is_stmt 0 view .LVU748
+	movl	288(%rsp), %edi	# ctx.buf_len,
+# blake2b.c:66:     if (ctx->buf_len + len <= B2B_BLOCK) {
+	.loc 1 66 22 view .LVU749
+	leaq	(%rax,%rdi), %rax	#, tmp116
+.LVL169:
+# blake2b.c:62:     unsigned rest = B2B_BLOCK - ctx->buf_len;
+	.loc 1 62 30 view .LVU750
+	movq	%rdi, %r13	#,
+.LVL170:
+	.loc 1 63 5 is_stmt 1 view .LVU751
+	.loc 1 66 5 view .LVU752
+# blake2b.c:66:     if (ctx->buf_len + len <= B2B_BLOCK) {
+	.loc 1 66 8 is_stmt 0 view .LVU753
+	cmpq	$128, %rax	#, tmp116
+	jbe	.L87	#,
+	.loc 1 71 5 is_stmt 1 view .LVU754
+# blake2b.c:71:     if (ctx->buf_len) {
+	.loc 1 71 8 is_stmt 0 view .LVU755
+	testl	%edi, %edi	# _19
+	je	.L83	#,
+	.loc 1 72 9 is_stmt 1 view .LVU756
+	movl	$128, %ebx	#, tmp127
+.LBB446:
+.LBB447:
+# blake2b.c:53:     memcpy(ctx->buf + off, src, len);
+	.loc 1 53 5 is_stmt 0 view .LVU757
+	leaq	128(%rsp), %r13	#, tmp161
+	movq	%r12, %rsi	# tmp162,
+.LBE447:
+.LBE446:
+# blake2b.c:72:         bbstate_buf_append(ctx, src, rest);
+	.loc 1 72 9 view .LVU758
+	subl	%edi, %ebx	# _19, _27
+.LVL171:
+.LBB451:
+.LBI446:
+	.loc 1 50 13 is_stmt 1 view .LVU759
+.LBB448:
+	.loc 1 53 5 view .LVU760
+	addq	%r13, %rdi	# tmp161, tmp130
+.LVL172:
+	.loc 1 53 5 is_stmt 0 view .LVU761
+	movq	%rbx, %rdx	# _27,
+.LBE448:
+.LBE451:
+# blake2b.c:74:         len -= rest;
+	.loc 1 74 13 view .LVU762
+	subq	%rbx, %r15	# _27, len
+.LVL173:
+.LBB452:
+.LBB449:
+# blake2b.c:53:     memcpy(ctx->buf + off, src, len);
+	.loc 1 53 5 view .LVU763
+	call	memcpy@PLT	#
+.LVL174:
+	.loc 1 54 5 is_stmt 1 view .LVU764
+.LBE449:
+.LBE452:
+.LBB453:
+.LBB454:
+# blake2b.c:41:     ctx->t[0] += inc;
+	.loc 1 41 15 is_stmt 0 view .LVU765
+	movq	256(%rsp), %rax	# ctx.t[0], tmp170
+.LBE454:
+.LBE453:
+.LBB457:
+.LBB458:
+# blake2b-internal.h:72:     blake2b_kern->compress(ctx, m);
+	.loc 2 72 5 view .LVU766
+	movq	%r13, %rsi	# tmp161,
+.LBE458:
+.LBE457:
+.LBB461:
+.LBB450:
+# blake2b.c:54:     ctx->buf_len = off + len;
+	.loc 1 54 18 view .LVU767
+	movl	$128, 288(%rsp)	#, ctx.buf_len
+.LVL175:
+	.loc 1 54 18 view .LVU768
+.LBE450:
+.LBE461:
+	.loc 1 73 9 is_stmt 1 view .LVU769
+	.loc 1 74 9 view .LVU770
+	.loc 1 75 9 view .LVU771
+.LBB462:
+.LBI453:
+	.loc 1 39 13 view .LVU772
+.LBB455:
+	.loc 1 41 5 view .LVU773
+.LBE455:
+.LBE462:
+.LBB463:
+.LBB459:
+# blake2b-internal.h:72:     blake2b_kern->compress(ctx, m);
+	.loc 2 72 5 is_stmt 0 view .LVU774
+	movq	56(%rsp), %rdi	# %sfp,
+.LBE459:
+.LBE463:
+.LBB464:
+.LBB456:
+# blake2b.c:41:     ctx->t[0] += inc;
+	.loc 1 41 15 view .LVU775
+	subq	$-128, %rax	#, _32
+# blake2b.c:42:     ctx->t[1] += (ctx->t[0] < inc);
+	.loc 1 42 29 view .LVU776
+	cmpq	$127, %rax	#, _32
+# blake2b.c:41:     ctx->t[0] += inc;
+	.loc 1 41 15 view .LVU777
+	movq	%rax, 256(%rsp)	# _32, ctx.t[0]
+	.loc 1 42 5 is_stmt 1 view .LVU778
+# blake2b.c:42:     ctx->t[1] += (ctx->t[0] < inc);
+	.loc 1 42 29 is_stmt 0 view .LVU779
+	setbe	%al	#, tmp138
+	movzbl	%al, %eax	# tmp138, tmp138
+# blake2b.c:42:     ctx->t[1] += (ctx->t[0] < inc);
+	.loc 1 42 15 view .LVU780
+	addq	%rax, 264(%rsp)	# tmp138, ctx.t[1]
+.LVL176:
+	.loc 1 42 15 view .LVU781
+.LBE456:
+.LBE464:
+	.loc 1 76 9 is_stmt 1 view .LVU782
+.LBB465:
+.LBI457:
+	.loc 2 70 20 view .LVU783
+.LBB460:
+	.loc 2 72 5 view .LVU784
+	movq	blake2b_kern(%rip), %rax	# blake2b_kern, blake2b_kern
+	call	*16(%rax)	# blake2b_kern.0_37->compress
+.LVL177:
+	.loc 2 72 5 is_stmt 0 view .LVU785
+.LBE460:
+.LBE465:
+	.loc 1 77 9 is_stmt 1 view .LVU786
+.LBB466:
+# blake2b.c:83:         blake2b_compress_blocks(ctx, (char *)src + src_off, nblocks);
+	.loc 1 83 9 is_stmt 0 view .LVU787
+	leaq	(%r12,%rbx), %rsi	#, prephitmp_51
+.LBE466:
+# blake2b.c:77:         ctx->buf_len = 0;
+	.loc 1 77 22 view .LVU788
+	movl	$0, 288(%rsp)	#, ctx.buf_len
+	jmp	.L80	#
+.LVL178:
+	.p2align 4,,10
+	.p2align 3
+.L87:
+	.loc 1 67 9 is_stmt 1 view .LVU789
+.LBB467:
+.LBI467:
+	.loc 1 50 13 view .LVU790
+.LBB468:
+	.loc 1 53 5 view .LVU791
+	leaq	128(%rsp,%rdi), %rdi	#, tmp119
+.LVL179:
+	.loc 1 53 5 is_stmt 0 view .LVU792
+	movq	%r15, %rdx	# len,
+	movq	%r12, %rsi	# tmp162,
+	call	memcpy@PLT	#
+.LVL180:
+	.loc 1 54 5 is_stmt 1 view .LVU793
+# blake2b.c:54:     ctx->buf_len = off + len;
+	.loc 1 54 24 is_stmt 0 view .LVU794
+	leal	0(%r13,%r15), %ecx	#, _53
+.LVL181:
+	.loc 1 54 24 view .LVU795
+.LBE468:
+.LBE467:
+	.loc 1 68 9 is_stmt 1 view .LVU796
+	jmp	.L79	#
+.LVL182:
+	.p2align 4,,10
+	.p2align 3
+.L86:
+.L76:
+	.loc 1 68 9 is_stmt 0 view .LVU797
+.LBE469:
+.LBE470:
+# blake2b.c:189:         if (!read && ferror(stream)) {
+	.loc 1 189 22 discriminator 1 view .LVU798
+	movq	%r14, %rdi	# stream,
+	call	ferror@PLT	#
+.LVL183:
+	.loc 1 189 22 discriminator 1 view .LVU799
+	movl	%eax, %edx	#, tmp168
+# blake2b.c:190:             ret = -1;
+	.loc 1 190 17 discriminator 1 view .LVU800
+	movl	$-1, %eax	#, <retval>
+# blake2b.c:189:         if (!read && ferror(stream)) {
+	.loc 1 189 19 discriminator 1 view .LVU801
+	testl	%edx, %edx	# tmp168
+	jne	.L73	#,
+	.loc 1 193 9 is_stmt 1 view .LVU802
+.LBE471:
+	.loc 1 197 5 view .LVU803
+	movq	40(%rsp), %rsi	# %sfp,
+	movq	56(%rsp), %rdi	# %sfp,
+	call	blake2b_final	#
+.LVL184:
+# blake2b.c:184:     int ret = 1;
+	.loc 1 184 9 is_stmt 0 view .LVU804
+	movl	$1, %eax	#, <retval>
+.L73:
+# blake2b.c:200: }
+	.loc 1 200 1 view .LVU805
+	leaq	-40(%rbp), %rsp	#,
+.LVL185:
+	.loc 1 200 1 view .LVU806
+	popq	%rbx	#
+	popq	%r12	#
+.LVL186:
+	.loc 1 200 1 view .LVU807
+	popq	%r13	#
+	popq	%r14	#
+.LVL187:
+	.loc 1 200 1 view .LVU808
+	popq	%r15	#
+.LVL188:
+	.loc 1 200 1 view .LVU809
+	popq	%rbp	#
+	.cfi_def_cfa 7, 8
+.LVL189:
+	.loc 1 200 1 view .LVU810
+	ret	
+	.cfi_endproc
+.LFE42:
+	.size	blake2b_file, .-blake2b_file
+	.section	.rodata
+	.align 16
+	.type	blake2b_salt_def, @object
+	.size	blake2b_salt_def, 16
+blake2b_salt_def:
+	.zero	16
+	.section	.rodata.cst16,"aM",@progbits,16
+	.align 16
+.LC0:
+	.quad	2270897969802886507
+	.quad	6620516959819538809
+	.align 16
+.LC3:
+	.quad	7640891576939301192
+	.quad	-4942790177534073029
+	.align 16
+.LC4:
+	.quad	4354685564936845355
+	.quad	-6534734903238641935
+	.align 16
+.LC5:
+	.quad	5840696475078001361
+	.quad	-7276294671716946913
+	.section	.rodata.cst8,"aM",@progbits,8
+	.align 8
+.LC6:
+	.long	0
+	.long	64
+	.text
+.Letext0:
+	.file 4 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stddef.h"
+	.file 5 "/usr/include/x86_64-linux-gnu/bits/types.h"
+	.file 6 "/usr/include/x86_64-linux-gnu/bits/types/struct_FILE.h"
+	.file 7 "/usr/include/x86_64-linux-gnu/bits/types/FILE.h"
+	.file 8 "/usr/include/x86_64-linux-gnu/bits/stdint-uintn.h"
+	.file 9 "blake2b.h"
+	.file 10 "/usr/include/stdio.h"
+	.file 11 "/usr/include/string.h"
+	.file 12 "<built-in>"
+	.section	.debug_info,"",@progbits
+.Ldebug_info0:
+	.long	0x1c77
+	.value	0x5
+	.byte	0x1
+	.byte	0x8
+	.long	.Ldebug_abbrev0
+	.uleb128 0x33
+	.long	.LASF110
+	.byte	0xc
+	.long	.LASF0
+	.long	.LASF1
+	.quad	.Ltext0
+	.quad	.Letext0-.Ltext0
+	.long	.Ldebug_line0
+	.uleb128 0xe
+	.long	.LASF9
+	.byte	0x4
+	.byte	0xd6
+	.byte	0x1b
+	.long	0x3a
+	.uleb128 0xf
+	.byte	0x8
+	.byte	0x7
+	.long	.LASF2
+	.uleb128 0x34
+	.byte	0x4
+	.byte	0x5
+	.string	"int"
+	.uleb128 0xd
+	.long	0x41
+	.uleb128 0xf
+	.byte	0x8
+	.byte	0x5
+	.long	.LASF3
+	.uleb128 0xf
+	.byte	0x8
+	.byte	0x5
+	.long	.LASF4
+	.uleb128 0x5
+	.long	0x60
+	.uleb128 0x35
+	.uleb128 0xf
+	.byte	0x4
+	.byte	0x7
+	.long	.LASF5
+	.uleb128 0x36
+	.byte	0x8
+	.uleb128 0x29
+	.long	0x68
+	.uleb128 0xf
+	.byte	0x1
+	.byte	0x8
+	.long	.LASF6
+	.uleb128 0xd
+	.long	0x6f
+	.uleb128 0xf
+	.byte	0x2
+	.byte	0x7
+	.long	.LASF7
+	.uleb128 0xf
+	.byte	0x1
+	.byte	0x6
+	.long	.LASF8
+	.uleb128 0xe
+	.long	.LASF10
+	.byte	0x5
+	.byte	0x26
+	.byte	0x17
+	.long	0x6f
+	.uleb128 0xf
+	.byte	0x2
+	.byte	0x5
+	.long	.LASF11
+	.uleb128 0xe
+	.long	.LASF12
+	.byte	0x5
+	.byte	0x2a
+	.byte	0x16
+	.long	0x61
+	.uleb128 0xe
+	.long	.LASF13
+	.byte	0x5
+	.byte	0x2d
+	.byte	0x1b
+	.long	0x3a
+	.uleb128 0xe
+	.long	.LASF14
+	.byte	0x5
+	.byte	0x98
+	.byte	0x12
+	.long	0x4d
+	.uleb128 0xe
+	.long	.LASF15
+	.byte	0x5
+	.byte	0x99
+	.byte	0x12
+	.long	0x4d
+	.uleb128 0x5
+	.long	0xd1
+	.uleb128 0xf
+	.byte	0x1
+	.byte	0x6
+	.long	.LASF16
+	.uleb128 0xd
+	.long	0xd1
+	.uleb128 0x2a
+	.long	.LASF61
+	.byte	0xd8
+	.byte	0x6
+	.byte	0x31
+	.long	0x263
+	.uleb128 0x3
+	.long	.LASF17
+	.byte	0x6
+	.byte	0x33
+	.byte	0x7
+	.long	0x41
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF18
+	.byte	0x6
+	.byte	0x36
+	.byte	0x9
+	.long	0xcc
+	.byte	0x8
+	.uleb128 0x3
+	.long	.LASF19
+	.byte	0x6
+	.byte	0x37
+	.byte	0x9
+	.long	0xcc
+	.byte	0x10
+	.uleb128 0x3
+	.long	.LASF20
+	.byte	0x6
+	.byte	0x38
+	.byte	0x9
+	.long	0xcc
+	.byte	0x18
+	.uleb128 0x3
+	.long	.LASF21
+	.byte	0x6
+	.byte	0x39
+	.byte	0x9
+	.long	0xcc
+	.byte	0x20
+	.uleb128 0x3
+	.long	.LASF22
+	.byte	0x6
+	.byte	0x3a
+	.byte	0x9
+	.long	0xcc
+	.byte	0x28
+	.uleb128 0x3
+	.long	.LASF23
+	.byte	0x6
+	.byte	0x3b
+	.byte	0x9
+	.long	0xcc
+	.byte	0x30
+	.uleb128 0x3
+	.long	.LASF24
+	.byte	0x6
+	.byte	0x3c
+	.byte	0x9
+	.long	0xcc
+	.byte	0x38
+	.uleb128 0x3
+	.long	.LASF25
+	.byte	0x6
+	.byte	0x3d
+	.byte	0x9
+	.long	0xcc
+	.byte	0x40
+	.uleb128 0x3
+	.long	.LASF26
+	.byte	0x6
+	.byte	0x40
+	.byte	0x9
+	.long	0xcc
+	.byte	0x48
+	.uleb128 0x3
+	.long	.LASF27
+	.byte	0x6
+	.byte	0x41
+	.byte	0x9
+	.long	0xcc
+	.byte	0x50
+	.uleb128 0x3
+	.long	.LASF28
+	.byte	0x6
+	.byte	0x42
+	.byte	0x9
+	.long	0xcc
+	.byte	0x58
+	.uleb128 0x3
+	.long	.LASF29
+	.byte	0x6
+	.byte	0x44
+	.byte	0x16
+	.long	0x27c
+	.byte	0x60
+	.uleb128 0x3
+	.long	.LASF30
+	.byte	0x6
+	.byte	0x46
+	.byte	0x14
+	.long	0x281
+	.byte	0x68
+	.uleb128 0x3
+	.long	.LASF31
+	.byte	0x6
+	.byte	0x48
+	.byte	0x7
+	.long	0x41
+	.byte	0x70
+	.uleb128 0x3
+	.long	.LASF32
+	.byte	0x6
+	.byte	0x49
+	.byte	0x7
+	.long	0x41
+	.byte	0x74
+	.uleb128 0x3
+	.long	.LASF33
+	.byte	0x6
+	.byte	0x4a
+	.byte	0xb
+	.long	0xb4
+	.byte	0x78
+	.uleb128 0x3
+	.long	.LASF34
+	.byte	0x6
+	.byte	0x4d
+	.byte	0x12
+	.long	0x7b
+	.byte	0x80
+	.uleb128 0x3
+	.long	.LASF35
+	.byte	0x6
+	.byte	0x4e
+	.byte	0xf
+	.long	0x82
+	.byte	0x82
+	.uleb128 0x3
+	.long	.LASF36
+	.byte	0x6
+	.byte	0x4f
+	.byte	0x8
+	.long	0x286
+	.byte	0x83
+	.uleb128 0x3
+	.long	.LASF37
+	.byte	0x6
+	.byte	0x51
+	.byte	0xf
+	.long	0x296
+	.byte	0x88
+	.uleb128 0x3
+	.long	.LASF38
+	.byte	0x6
+	.byte	0x59
+	.byte	0xd
+	.long	0xc0
+	.byte	0x90
+	.uleb128 0x3
+	.long	.LASF39
+	.byte	0x6
+	.byte	0x5b
+	.byte	0x17
+	.long	0x2a0
+	.byte	0x98
+	.uleb128 0x3
+	.long	.LASF40
+	.byte	0x6
+	.byte	0x5c
+	.byte	0x19
+	.long	0x2aa
+	.byte	0xa0
+	.uleb128 0x3
+	.long	.LASF41
+	.byte	0x6
+	.byte	0x5d
+	.byte	0x14
+	.long	0x281
+	.byte	0xa8
+	.uleb128 0x3
+	.long	.LASF42
+	.byte	0x6
+	.byte	0x5e
+	.byte	0x9
+	.long	0x68
+	.byte	0xb0
+	.uleb128 0x3
+	.long	.LASF43
+	.byte	0x6
+	.byte	0x5f
+	.byte	0xa
+	.long	0x2e
+	.byte	0xb8
+	.uleb128 0x3
+	.long	.LASF44
+	.byte	0x6
+	.byte	0x60
+	.byte	0x7
+	.long	0x41
+	.byte	0xc0
+	.uleb128 0x3
+	.long	.LASF45
+	.byte	0x6
+	.byte	0x62
+	.byte	0x8
+	.long	0x2af
+	.byte	0xc4
+	.byte	0
+	.uleb128 0xe
+	.long	.LASF46
+	.byte	0x7
+	.byte	0x7
+	.byte	0x19
+	.long	0xdd
+	.uleb128 0x37
+	.long	.LASF111
+	.byte	0x6
+	.byte	0x2b
+	.byte	0xe
+	.uleb128 0x20
+	.long	.LASF47
+	.uleb128 0x5
+	.long	0x277
+	.uleb128 0x5
+	.long	0xdd
+	.uleb128 0xc
+	.long	0xd1
+	.long	0x296
+	.uleb128 0xa
+	.long	0x3a
+	.byte	0
+	.byte	0
+	.uleb128 0x5
+	.long	0x26f
+	.uleb128 0x20
+	.long	.LASF48
+	.uleb128 0x5
+	.long	0x29b
+	.uleb128 0x20
+	.long	.LASF49
+	.uleb128 0x5
+	.long	0x2a5
+	.uleb128 0xc
+	.long	0xd1
+	.long	0x2bf
+	.uleb128 0xa
+	.long	0x3a
+	.byte	0x13
+	.byte	0
+	.uleb128 0x5
+	.long	0x263
+	.uleb128 0x29
+	.long	0x2bf
+	.uleb128 0xe
+	.long	.LASF50
+	.byte	0x8
+	.byte	0x18
+	.byte	0x13
+	.long	0x89
+	.uleb128 0xe
+	.long	.LASF51
+	.byte	0x8
+	.byte	0x1a
+	.byte	0x14
+	.long	0x9c
+	.uleb128 0xe
+	.long	.LASF52
+	.byte	0x8
+	.byte	0x1b
+	.byte	0x14
+	.long	0xa8
+	.uleb128 0xc
+	.long	0x6f
+	.long	0x2fd
+	.uleb128 0xa
+	.long	0x3a
+	.byte	0x3f
+	.byte	0
+	.uleb128 0x5
+	.long	0x6f
+	.uleb128 0x2b
+	.long	.LASF59
+	.value	0x100
+	.byte	0x9
+	.byte	0x32
+	.long	0x365
+	.uleb128 0x18
+	.string	"H"
+	.byte	0x9
+	.byte	0x33
+	.byte	0xe
+	.long	0x365
+	.byte	0
+	.uleb128 0x18
+	.string	"buf"
+	.byte	0x9
+	.byte	0x34
+	.byte	0x13
+	.long	0x375
+	.byte	0x40
+	.uleb128 0x18
+	.string	"t"
+	.byte	0x9
+	.byte	0x35
+	.byte	0xe
+	.long	0x385
+	.byte	0xc0
+	.uleb128 0x18
+	.string	"f"
+	.byte	0x9
+	.byte	0x36
+	.byte	0xe
+	.long	0x385
+	.byte	0xd0
+	.uleb128 0x3
+	.long	.LASF53
+	.byte	0x9
+	.byte	0x37
+	.byte	0xe
+	.long	0x61
+	.byte	0xe0
+	.uleb128 0x3
+	.long	.LASF54
+	.byte	0x9
+	.byte	0x38
+	.byte	0xe
+	.long	0x61
+	.byte	0xe4
+	.uleb128 0x3
+	.long	.LASF55
+	.byte	0x9
+	.byte	0x39
+	.byte	0xe
+	.long	0x61
+	.byte	0xe8
+	.byte	0
+	.uleb128 0xc
+	.long	0x2e1
+	.long	0x375
+	.uleb128 0xa
+	.long	0x3a
+	.byte	0x7
+	.byte	0
+	.uleb128 0xc
+	.long	0x6f
+	.long	0x385
+	.uleb128 0xa
+	.long	0x3a
+	.byte	0x7f
+	.byte	0
+	.uleb128 0xc
+	.long	0x2e1
+	.long	0x395
+	.uleb128 0xa
+	.long	0x3a
+	.byte	0x1
+	.byte	0
+	.uleb128 0xf
+	.byte	0x8
+	.byte	0x7
+	.long	.LASF56
+	.uleb128 0x21
+	.string	"u8"
+	.byte	0x3
+	.byte	0x7
+	.byte	0x11
+	.long	0x2c9
+	.uleb128 0xd
+	.long	0x39c
+	.uleb128 0x21
+	.string	"u32"
+	.byte	0x3
+	.byte	0x8
+	.byte	0x12
+	.long	0x2d5
+	.uleb128 0xd
+	.long	0x3ac
+	.uleb128 0xc
+	.long	0x3b8
+	.long	0x3cd
+	.uleb128 0xa
+	.long	0x3a
+	.byte	0x7
+	.byte	0
+	.uleb128 0xd
+	.long	0x3bd
+	.uleb128 0x2c
+	.long	.LASF57
+	.byte	0xa
+	.byte	0x12
+	.long	0x3cd
+	.byte	0x20
+	.byte	0x67
+	.byte	0xe6
+	.byte	0x9
+	.byte	0x6a
+	.byte	0x85
+	.byte	0xae
+	.byte	0x67
+	.byte	0xbb
+	.byte	0x72
+	.byte	0xf3
+	.byte	0x6e
+	.byte	0x3c
+	.byte	0x3a
+	.byte	0xf5
+	.byte	0x4f
+	.byte	0xa5
+	.byte	0x7f
+	.byte	0x52
+	.byte	0xe
+	.byte	0x51
+	.byte	0x8c
+	.byte	0x68
+	.byte	0x5
+	.byte	0x9b
+	.byte	0xab
+	.byte	0xd9
+	.byte	0x83
+	.byte	0x1f
+	.byte	0x19
+	.byte	0xcd
+	.byte	0xe0
+	.byte	0x5b
+	.uleb128 0xc
+	.long	0x3a7
+	.long	0x414
+	.uleb128 0xa
+	.long	0x3a
+	.byte	0x9
+	.uleb128 0xa
+	.long	0x3a
+	.byte	0xf
+	.byte	0
+	.uleb128 0xd
+	.long	0x3fe
+	.uleb128 0x2c
+	.long	.LASF58
+	.byte	0xf
+	.byte	0x11
+	.long	0x414
+	.byte	0xa0
+	.byte	0
+	.byte	0x1
+	.byte	0x2
+	.byte	0x3
+	.byte	0x4
+	.byte	0x5
+	.byte	0x6
+	.byte	0x7
+	.byte	0x8
+	.byte	0x9
+	.byte	0xa
+	.byte	0xb
+	.byte	0xc
+	.byte	0xd
+	.byte	0xe
+	.byte	0xf
+	.byte	0xe
+	.byte	0xa
+	.byte	0x4
+	.byte	0x8
+	.byte	0x9
+	.byte	0xf
+	.byte	0xd
+	.byte	0x6
+	.byte	0x1
+	.byte	0xc
+	.byte	0
+	.byte	0x2
+	.byte	0xb
+	.byte	0x7
+	.byte	0x5
+	.byte	0x3
+	.byte	0xb
+	.byte	0x8
+	.byte	0xc
+	.byte	0
+	.byte	0x5
+	.byte	0x2
+	.byte	0xf
+	.byte	0xd
+	.byte	0xa
+	.byte	0xe
+	.byte	0x3
+	.byte	0x6
+	.byte	0x7
+	.byte	0x1
+	.byte	0x9
+	.byte	0x4
+	.byte	0x7
+	.byte	0x9
+	.byte	0x3
+	.byte	0x1
+	.byte	0xd
+	.byte	0xc
+	.byte	0xb
+	.byte	0xe
+	.byte	0x2
+	.byte	0x6
+	.byte	0x5
+	.byte	0xa
+	.byte	0x4
+	.byte	0
+	.byte	0xf
+	.byte	0x8
+	.byte	0x9
+	.byte	0
+	.byte	0x5
+	.byte	0x7
+	.byte	0x2
+	.byte	0x4
+	.byte	0xa
+	.byte	0xf
+	.byte	0xe
+	.byte	0x1
+	.byte	0xb
+	.byte	0xc
+	.byte	0x6
+	.byte	0x8
+	.byte	0x3
+	.byte	0xd
+	.byte	0x2
+	.byte	0xc
+	.byte	0x6
+	.byte	0xa
+	.byte	0
+	.byte	0xb
+	.byte	0x8
+	.byte	0x3
+	.byte	0x4
+	.byte	0xd
+	.byte	0x7
+	.byte	0x5
+	.byte	0xf
+	.byte	0xe
+	.byte	0x1
+	.byte	0x9
+	.byte	0xc
+	.byte	0x5
+	.byte	0x1
+	.byte	0xf
+	.byte	0xe
+	.byte	0xd
+	.byte	0x4
+	.byte	0xa
+	.byte	0
+	.byte	0x7
+	.byte	0x6
+	.byte	0x3
+	.byte	0x9
+	.byte	0x2
+	.byte	0x8
+	.byte	0xb
+	.byte	0xd
+	.byte	0xb
+	.byte	0x7
+	.byte	0xe
+	.byte	0xc
+	.byte	0x1
+	.byte	0x3
+	.byte	0x9
+	.byte	0x5
+	.byte	0
+	.byte	0xf
+	.byte	0x4
+	.byte	0x8
+	.byte	0x6
+	.byte	0x2
+	.byte	0xa
+	.byte	0x6
+	.byte	0xf
+	.byte	0xe
+	.byte	0x9
+	.byte	0xb
+	.byte	0x3
+	.byte	0
+	.byte	0x8
+	.byte	0xc
+	.byte	0x2
+	.byte	0xd
+	.byte	0x7
+	.byte	0x1
+	.byte	0x4
+	.byte	0xa
+	.byte	0x5
+	.byte	0xa
+	.byte	0x2
+	.byte	0x8
+	.byte	0x4
+	.byte	0x7
+	.byte	0x6
+	.byte	0x1
+	.byte	0x5
+	.byte	0xf
+	.byte	0xb
+	.byte	0x9
+	.byte	0xe
+	.byte	0x3
+	.byte	0xc
+	.byte	0xd
+	.byte	0
+	.uleb128 0x5
+	.long	0xd8
+	.uleb128 0x38
+	.long	0x41
+	.uleb128 0x5
+	.long	0x4ca
+	.uleb128 0x5
+	.long	0x5b
+	.uleb128 0x21
+	.string	"u64"
+	.byte	0x2
+	.byte	0x6
+	.byte	0x12
+	.long	0x2e1
+	.uleb128 0xd
+	.long	0x4d9
+	.uleb128 0xc
+	.long	0x4e5
+	.long	0x4fa
+	.uleb128 0xa
+	.long	0x3a
+	.byte	0x7
+	.byte	0
+	.uleb128 0xd
+	.long	0x4ea
+	.uleb128 0x12
+	.long	.LASF70
+	.byte	0x2
+	.byte	0x8
+	.byte	0x12
+	.long	0x4fa
+	.uleb128 0x2b
+	.long	.LASF60
+	.value	0x180
+	.byte	0x2
+	.byte	0x25
+	.long	0x538
+	.uleb128 0x18
+	.string	"H"
+	.byte	0x2
+	.byte	0x26
+	.byte	0x9
+	.long	0x538
+	.byte	0
+	.uleb128 0x2d
+	.string	"t"
+	.byte	0x27
+	.long	0x54e
+	.value	0x100
+	.uleb128 0x2d
+	.string	"f"
+	.byte	0x28
+	.long	0x54e
+	.value	0x140
+	.byte	0
+	.uleb128 0xc
+	.long	0x4d9
+	.long	0x54e
+	.uleb128 0xa
+	.long	0x3a
+	.byte	0x7
+	.uleb128 0xa
+	.long	0x3a
+	.byte	0x3
+	.byte	0
+	.uleb128 0xc
+	.long	0x4d9
+	.long	0x564
+	.uleb128 0xa
+	.long	0x3a
+	.byte	0x1
+	.uleb128 0xa
+	.long	0x3a
+	.byte	0x3
+	.byte	0
+	.uleb128 0x2a
+	.long	.LASF62
+	.byte	0x30
+	.byte	0x2
+	.byte	0x2c
+	.long	0x5bf
+	.uleb128 0x3
+	.long	.LASF63
+	.byte	0x2
+	.byte	0x2d
+	.byte	0x11
+	.long	0x4c5
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF64
+	.byte	0x2
+	.byte	0x2e
+	.byte	0xb
+	.long	0x4cf
+	.byte	0x8
+	.uleb128 0x3
+	.long	.LASF65
+	.byte	0x2
+	.byte	0x2f
+	.byte	0xc
+	.long	0x5d9
+	.byte	0x10
+	.uleb128 0x3
+	.long	.LASF66
+	.byte	0x2
+	.byte	0x30
+	.byte	0xc
+	.long	0x5f3
+	.byte	0x18
+	.uleb128 0x3
+	.long	.LASF67
+	.byte	0x2
+	.byte	0x32
+	.byte	0xe
+	.long	0x61
+	.byte	0x20
+	.uleb128 0x3
+	.long	.LASF68
+	.byte	0x2
+	.byte	0x33
+	.byte	0xc
+	.long	0x612
+	.byte	0x28
+	.byte	0
+	.uleb128 0xd
+	.long	0x564
+	.uleb128 0x22
+	.long	0x5d4
+	.uleb128 0x7
+	.long	0x5d4
+	.uleb128 0x7
+	.long	0x5b
+	.byte	0
+	.uleb128 0x5
+	.long	0x302
+	.uleb128 0x5
+	.long	0x5c4
+	.uleb128 0x22
+	.long	0x5f3
+	.uleb128 0x7
+	.long	0x5d4
+	.uleb128 0x7
+	.long	0x5b
+	.uleb128 0x7
+	.long	0x2e
+	.byte	0
+	.uleb128 0x5
+	.long	0x5de
+	.uleb128 0x22
+	.long	0x60d
+	.uleb128 0x7
+	.long	0x60d
+	.uleb128 0x7
+	.long	0x4d4
+	.uleb128 0x7
+	.long	0x61
+	.byte	0
+	.uleb128 0x5
+	.long	0x50b
+	.uleb128 0x5
+	.long	0x5f8
+	.uleb128 0x39
+	.long	.LASF77
+	.byte	0x2
+	.byte	0x37
+	.byte	0x25
+	.long	0x623
+	.uleb128 0x5
+	.long	0x5bf
+	.uleb128 0xc
+	.long	0x3a7
+	.long	0x638
+	.uleb128 0xa
+	.long	0x3a
+	.byte	0xf
+	.byte	0
+	.uleb128 0xd
+	.long	0x628
+	.uleb128 0x3a
+	.long	.LASF69
+	.byte	0x1
+	.byte	0x1f
+	.byte	0x11
+	.long	0x638
+	.uleb128 0x9
+	.byte	0x3
+	.quad	blake2b_salt_def
+	.uleb128 0x12
+	.long	.LASF71
+	.byte	0x1
+	.byte	0x20
+	.byte	0x11
+	.long	0x638
+	.uleb128 0x2e
+	.long	.LASF72
+	.value	0x316
+	.byte	0xc
+	.long	0x41
+	.long	0x675
+	.uleb128 0x7
+	.long	0x2bf
+	.byte	0
+	.uleb128 0x2e
+	.long	.LASF73
+	.value	0x2a3
+	.byte	0xf
+	.long	0x2e
+	.long	0x69a
+	.uleb128 0x7
+	.long	0x6a
+	.uleb128 0x7
+	.long	0x2e
+	.uleb128 0x7
+	.long	0x2e
+	.uleb128 0x7
+	.long	0x2c4
+	.byte	0
+	.uleb128 0x2f
+	.long	.LASF74
+	.byte	0x3d
+	.long	0x68
+	.long	0x6b8
+	.uleb128 0x7
+	.long	0x68
+	.uleb128 0x7
+	.long	0x41
+	.uleb128 0x7
+	.long	0x2e
+	.byte	0
+	.uleb128 0x2f
+	.long	.LASF75
+	.byte	0x2b
+	.long	0x68
+	.long	0x6d6
+	.uleb128 0x7
+	.long	0x68
+	.uleb128 0x7
+	.long	0x5b
+	.uleb128 0x7
+	.long	0x2e
+	.byte	0
+	.uleb128 0x23
+	.long	.LASF79
+	.byte	0xb4
+	.long	0x41
+	.quad	.LFB42
+	.quad	.LFE42-.LFB42
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0xb1f
+	.uleb128 0x10
+	.string	"out"
+	.byte	0xb4
+	.byte	0x21
+	.long	0x2fd
+	.long	.LLST168
+	.long	.LVUS168
+	.uleb128 0x19
+	.long	.LASF76
+	.byte	0xb4
+	.byte	0x2c
+	.long	0x2bf
+	.long	.LLST169
+	.long	.LVUS169
+	.uleb128 0x24
+	.string	"ctx"
+	.byte	0xb6
+	.byte	0x18
+	.long	0x302
+	.uleb128 0x3
+	.byte	0x77
+	.sleb128 64
+	.uleb128 0x3b
+	.string	"buf"
+	.byte	0x1
+	.byte	0xb7
+	.byte	0x13
+	.long	0xb1f
+	.byte	0x40
+	.uleb128 0x3
+	.byte	0x77
+	.sleb128 320
+	.uleb128 0x3c
+	.string	"ret"
+	.byte	0x1
+	.byte	0xb8
+	.byte	0x9
+	.long	0x41
+	.byte	0x1
+	.uleb128 0x3d
+	.long	.LASF112
+	.byte	0x1
+	.byte	0xc6
+	.byte	0x1
+	.quad	.L76
+	.uleb128 0x3e
+	.long	.LLRL178
+	.long	0xa4f
+	.uleb128 0x3f
+	.long	.LASF78
+	.byte	0x1
+	.byte	0xbc
+	.byte	0x10
+	.long	0x2e
+	.long	.LLST179
+	.long	.LVUS179
+	.uleb128 0x9
+	.long	0x14f6
+	.quad	.LBI437
+	.byte	.LVU746
+	.long	.LLRL180
+	.byte	0xc3
+	.byte	0x9
+	.long	0xa10
+	.uleb128 0x1
+	.long	0x1518
+	.long	.LLST181
+	.long	.LVUS181
+	.uleb128 0x1
+	.long	0x150c
+	.long	.LLST182
+	.long	.LVUS182
+	.uleb128 0x1
+	.long	0x1500
+	.long	.LLST183
+	.long	.LVUS183
+	.uleb128 0x13
+	.long	.LLRL180
+	.uleb128 0x6
+	.long	0x1524
+	.long	.LLST184
+	.long	.LVUS184
+	.uleb128 0x6
+	.long	0x1530
+	.long	.LLST185
+	.long	.LVUS185
+	.uleb128 0x14
+	.long	0x153c
+	.long	.LLRL186
+	.long	0x846
+	.uleb128 0x6
+	.long	0x153d
+	.long	.LLST187
+	.long	.LVUS187
+	.uleb128 0xb
+	.long	0x160a
+	.quad	.LBI440
+	.byte	.LVU720
+	.long	.LLRL188
+	.byte	0x1
+	.byte	0x53
+	.byte	0x9
+	.uleb128 0x1
+	.long	0x162d
+	.long	.LLST189
+	.long	.LVUS189
+	.uleb128 0x1
+	.long	0x1623
+	.long	.LLST190
+	.long	.LVUS190
+	.uleb128 0x1
+	.long	0x1617
+	.long	.LLST191
+	.long	.LVUS191
+	.uleb128 0x15
+	.quad	.LVL159
+	.uleb128 0x2
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x3
+	.byte	0x77
+	.sleb128 56
+	.byte	0x6
+	.uleb128 0x2
+	.uleb128 0x1
+	.byte	0x51
+	.uleb128 0x5
+	.byte	0x77
+	.sleb128 48
+	.byte	0x6
+	.byte	0x37
+	.byte	0x25
+	.byte	0
+	.byte	0
+	.byte	0
+	.uleb128 0x25
+	.long	0x154b
+	.quad	.LBI444
+	.byte	.LVU733
+	.quad	.LBB444
+	.quad	.LBE444-.LBB444
+	.long	0x8af
+	.uleb128 0x1
+	.long	0x157c
+	.long	.LLST192
+	.long	.LVUS192
+	.uleb128 0x1
+	.long	0x1570
+	.long	.LLST193
+	.long	.LVUS193
+	.uleb128 0x17
+	.long	0x1564
+	.uleb128 0x1
+	.long	0x1558
+	.long	.LLST194
+	.long	.LVUS194
+	.uleb128 0x8
+	.quad	.LVL163
+	.long	0x1c68
+	.uleb128 0x2
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x7d
+	.sleb128 0
+	.uleb128 0x2
+	.uleb128 0x1
+	.byte	0x51
+	.uleb128 0x2
+	.byte	0x7f
+	.sleb128 0
+	.byte	0
+	.byte	0
+	.uleb128 0x9
+	.long	0x154b
+	.quad	.LBI446
+	.byte	.LVU759
+	.long	.LLRL195
+	.byte	0x48
+	.byte	0x9
+	.long	0x916
+	.uleb128 0x1
+	.long	0x157c
+	.long	.LLST196
+	.long	.LVUS196
+	.uleb128 0x1
+	.long	0x1570
+	.long	.LLST197
+	.long	.LVUS197
+	.uleb128 0x1
+	.long	0x1564
+	.long	.LLST198
+	.long	.LVUS198
+	.uleb128 0x1
+	.long	0x1558
+	.long	.LLST199
+	.long	.LVUS199
+	.uleb128 0x8
+	.quad	.LVL174
+	.long	0x1c68
+	.uleb128 0x2
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x2
+	.byte	0x7c
+	.sleb128 0
+	.uleb128 0x2
+	.uleb128 0x1
+	.byte	0x51
+	.uleb128 0x2
+	.byte	0x73
+	.sleb128 0
+	.byte	0
+	.byte	0
+	.uleb128 0x9
+	.long	0x15a3
+	.quad	.LBI453
+	.byte	.LVU772
+	.long	.LLRL200
+	.byte	0x4b
+	.byte	0x9
+	.long	0x949
+	.uleb128 0x1
+	.long	0x15bc
+	.long	.LLST201
+	.long	.LVUS201
+	.uleb128 0x1
+	.long	0x15b0
+	.long	.LLST202
+	.long	.LVUS202
+	.byte	0
+	.uleb128 0x9
+	.long	0x163a
+	.quad	.LBI457
+	.byte	.LVU783
+	.long	.LLRL203
+	.byte	0x4c
+	.byte	0x9
+	.long	0x993
+	.uleb128 0x1
+	.long	0x1653
+	.long	.LLST204
+	.long	.LVUS204
+	.uleb128 0x1
+	.long	0x1647
+	.long	.LLST205
+	.long	.LVUS205
+	.uleb128 0x15
+	.quad	.LVL177
+	.uleb128 0x2
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x3
+	.byte	0x77
+	.sleb128 56
+	.byte	0x6
+	.uleb128 0x2
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x2
+	.byte	0x7d
+	.sleb128 0
+	.byte	0
+	.byte	0
+	.uleb128 0x1c
+	.long	0x154b
+	.quad	.LBI467
+	.byte	.LVU790
+	.quad	.LBB467
+	.quad	.LBE467-.LBB467
+	.byte	0x43
+	.byte	0x9
+	.uleb128 0x1
+	.long	0x157c
+	.long	.LLST206
+	.long	.LVUS206
+	.uleb128 0x1
+	.long	0x1570
+	.long	.LLST207
+	.long	.LVUS207
+	.uleb128 0x1
+	.long	0x1564
+	.long	.LLST208
+	.long	.LVUS208
+	.uleb128 0x1
+	.long	0x1558
+	.long	.LLST209
+	.long	.LVUS209
+	.uleb128 0x8
+	.quad	.LVL180
+	.long	0x1c68
+	.uleb128 0x2
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x8
+	.byte	0x77
+	.sleb128 0
+	.byte	0x7d
+	.sleb128 0
+	.byte	0x22
+	.byte	0x23
+	.uleb128 0x80
+	.uleb128 0x2
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x2
+	.byte	0x7c
+	.sleb128 0
+	.uleb128 0x2
+	.uleb128 0x1
+	.byte	0x51
+	.uleb128 0x2
+	.byte	0x7f
+	.sleb128 0
+	.byte	0
+	.byte	0
+	.byte	0
+	.byte	0
+	.uleb128 0x26
+	.quad	.LVL166
+	.long	0x675
+	.long	0xa3a
+	.uleb128 0x2
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x7c
+	.sleb128 0
+	.uleb128 0x2
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x1
+	.byte	0x31
+	.uleb128 0x2
+	.uleb128 0x1
+	.byte	0x51
+	.uleb128 0x3
+	.byte	0xa
+	.value	0x2000
+	.uleb128 0x2
+	.uleb128 0x1
+	.byte	0x52
+	.uleb128 0x2
+	.byte	0x7e
+	.sleb128 0
+	.byte	0
+	.uleb128 0x8
+	.quad	.LVL183
+	.long	0x65f
+	.uleb128 0x2
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x7e
+	.sleb128 0
+	.byte	0
+	.byte	0
+	.uleb128 0x9
+	.long	0x10ac
+	.quad	.LBI418
+	.byte	.LVU695
+	.long	.LLRL170
+	.byte	0xba
+	.byte	0x5
+	.long	0xb02
+	.uleb128 0x1
+	.long	0x10b6
+	.long	.LLST171
+	.long	.LVUS171
+	.uleb128 0x13
+	.long	.LLRL170
+	.uleb128 0x1a
+	.long	0x10c2
+	.uleb128 0x3
+	.byte	0x77
+	.sleb128 320
+	.uleb128 0xb
+	.long	0x1228
+	.quad	.LBI420
+	.byte	.LVU706
+	.long	.LLRL172
+	.byte	0x1
+	.byte	0x9b
+	.byte	0x5
+	.uleb128 0x1
+	.long	0x1260
+	.long	.LLST173
+	.long	.LVUS173
+	.uleb128 0x1
+	.long	0x1254
+	.long	.LLST173
+	.long	.LVUS173
+	.uleb128 0x1
+	.long	0x1248
+	.long	.LLST173
+	.long	.LVUS173
+	.uleb128 0x1
+	.long	0x123e
+	.long	.LLST176
+	.long	.LVUS176
+	.uleb128 0x1
+	.long	0x1232
+	.long	.LLST177
+	.long	.LVUS177
+	.uleb128 0x8
+	.quad	.LVL154
+	.long	0x1290
+	.uleb128 0x2
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x75
+	.sleb128 0
+	.uleb128 0x2
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x2
+	.byte	0x7c
+	.sleb128 0
+	.uleb128 0x2
+	.uleb128 0x1
+	.byte	0x51
+	.uleb128 0x9
+	.byte	0x3
+	.quad	blake2b_salt_def
+	.byte	0
+	.byte	0
+	.byte	0
+	.byte	0
+	.uleb128 0x8
+	.quad	.LVL184
+	.long	0x12e6
+	.uleb128 0x2
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x3
+	.byte	0x77
+	.sleb128 56
+	.byte	0x6
+	.uleb128 0x2
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x3
+	.byte	0x77
+	.sleb128 40
+	.byte	0x6
+	.byte	0
+	.byte	0
+	.uleb128 0xc
+	.long	0x6f
+	.long	0xb30
+	.uleb128 0x40
+	.long	0x3a
+	.value	0x1fff
+	.byte	0
+	.uleb128 0x30
+	.long	.LASF88
+	.byte	0xac
+	.quad	.LFB41
+	.quad	.LFE41-.LFB41
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0xef0
+	.uleb128 0x10
+	.string	"out"
+	.byte	0xac
+	.byte	0x1d
+	.long	0x2fd
+	.long	.LLST126
+	.long	.LVUS126
+	.uleb128 0x10
+	.string	"src"
+	.byte	0xac
+	.byte	0x2e
+	.long	0x5b
+	.long	.LLST127
+	.long	.LVUS127
+	.uleb128 0x10
+	.string	"len"
+	.byte	0xac
+	.byte	0x3a
+	.long	0x2e
+	.long	.LLST128
+	.long	.LVUS128
+	.uleb128 0x24
+	.string	"ctx"
+	.byte	0xae
+	.byte	0x18
+	.long	0x302
+	.uleb128 0x3
+	.byte	0x77
+	.sleb128 64
+	.uleb128 0x9
+	.long	0x10ac
+	.quad	.LBI348
+	.byte	.LVU588
+	.long	.LLRL129
+	.byte	0xaf
+	.byte	0x5
+	.long	0xc46
+	.uleb128 0x1
+	.long	0x10b6
+	.long	.LLST130
+	.long	.LVUS130
+	.uleb128 0x13
+	.long	.LLRL129
+	.uleb128 0x1a
+	.long	0x10c2
+	.uleb128 0x2
+	.byte	0x77
+	.sleb128 32
+	.uleb128 0xb
+	.long	0x1228
+	.quad	.LBI350
+	.byte	.LVU598
+	.long	.LLRL131
+	.byte	0x1
+	.byte	0x9b
+	.byte	0x5
+	.uleb128 0x1
+	.long	0x1260
+	.long	.LLST132
+	.long	.LVUS132
+	.uleb128 0x1
+	.long	0x1254
+	.long	.LLST132
+	.long	.LVUS132
+	.uleb128 0x1
+	.long	0x1248
+	.long	.LLST132
+	.long	.LVUS132
+	.uleb128 0x1
+	.long	0x123e
+	.long	.LLST135
+	.long	.LVUS135
+	.uleb128 0x1
+	.long	0x1232
+	.long	.LLST136
+	.long	.LVUS136
+	.uleb128 0x8
+	.quad	.LVL120
+	.long	0x1290
+	.uleb128 0x2
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x7d
+	.sleb128 0
+	.uleb128 0x2
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x2
+	.byte	0x77
+	.sleb128 32
+	.uleb128 0x2
+	.uleb128 0x1
+	.byte	0x51
+	.uleb128 0x9
+	.byte	0x3
+	.quad	blake2b_salt_def
+	.byte	0
+	.byte	0
+	.byte	0
+	.byte	0
+	.uleb128 0x9
+	.long	0x14f6
+	.quad	.LBI364
+	.byte	.LVU603
+	.long	.LLRL137
+	.byte	0xb0
+	.byte	0x5
+	.long	0xed4
+	.uleb128 0x1
+	.long	0x1518
+	.long	.LLST138
+	.long	.LVUS138
+	.uleb128 0x1
+	.long	0x150c
+	.long	.LLST139
+	.long	.LVUS139
+	.uleb128 0x1
+	.long	0x1500
+	.long	.LLST140
+	.long	.LVUS140
+	.uleb128 0x13
+	.long	.LLRL137
+	.uleb128 0x6
+	.long	0x1524
+	.long	.LLST141
+	.long	.LVUS141
+	.uleb128 0x6
+	.long	0x1530
+	.long	.LLST142
+	.long	.LVUS142
+	.uleb128 0x25
+	.long	0x154b
+	.quad	.LBI366
+	.byte	.LVU617
+	.quad	.LBB366
+	.quad	.LBE366-.LBB366
+	.long	0xd0d
+	.uleb128 0x1
+	.long	0x157c
+	.long	.LLST143
+	.long	.LVUS143
+	.uleb128 0x1
+	.long	0x1570
+	.long	.LLST144
+	.long	.LVUS144
+	.uleb128 0x17
+	.long	0x1564
+	.uleb128 0x1
+	.long	0x1558
+	.long	.LLST145
+	.long	.LVUS145
+	.uleb128 0x8
+	.quad	.LVL124
+	.long	0x1c68
+	.uleb128 0x2
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x7f
+	.sleb128 0
+	.uleb128 0x2
+	.uleb128 0x1
+	.byte	0x51
+	.uleb128 0x2
+	.byte	0x73
+	.sleb128 0
+	.byte	0
+	.byte	0
+	.uleb128 0x9
+	.long	0x154b
+	.quad	.LBI368
+	.byte	.LVU678
+	.long	.LLRL146
+	.byte	0x43
+	.byte	0x9
+	.long	0xd81
+	.uleb128 0x1
+	.long	0x157c
+	.long	.LLST147
+	.long	.LVUS147
+	.uleb128 0x1
+	.long	0x1570
+	.long	.LLST148
+	.long	.LVUS148
+	.uleb128 0x1
+	.long	0x1564
+	.long	.LLST149
+	.long	.LVUS149
+	.uleb128 0x1
+	.long	0x1558
+	.long	.LLST150
+	.long	.LVUS150
+	.uleb128 0x8
+	.quad	.LVL148
+	.long	0x1c68
+	.uleb128 0x2
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x8
+	.byte	0x77
+	.sleb128 0
+	.byte	0x7f
+	.sleb128 0
+	.byte	0x22
+	.byte	0x23
+	.uleb128 0x80
+	.uleb128 0x2
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x2
+	.byte	0x7c
+	.sleb128 0
+	.uleb128 0x2
+	.uleb128 0x1
+	.byte	0x51
+	.uleb128 0x3
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x51
+	.byte	0
+	.byte	0
+	.uleb128 0x14
+	.long	0x153c
+	.long	.LLRL151
+	.long	0xdf2
+	.uleb128 0x6
+	.long	0x153d
+	.long	.LLST152
+	.long	.LVUS152
+	.uleb128 0xb
+	.long	0x160a
+	.quad	.LBI372
+	.byte	.LVU633
+	.long	.LLRL153
+	.byte	0x1
+	.byte	0x53
+	.byte	0x9
+	.uleb128 0x1
+	.long	0x162d
+	.long	.LLST154
+	.long	.LVUS154
+	.uleb128 0x1
+	.long	0x1623
+	.long	.LLST155
+	.long	.LVUS155
+	.uleb128 0x1
+	.long	0x1617
+	.long	.LLST156
+	.long	.LVUS156
+	.uleb128 0x15
+	.quad	.LVL134
+	.uleb128 0x2
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x7d
+	.sleb128 0
+	.uleb128 0x2
+	.uleb128 0x1
+	.byte	0x51
+	.uleb128 0x5
+	.byte	0x77
+	.sleb128 16
+	.byte	0x6
+	.byte	0x37
+	.byte	0x25
+	.byte	0
+	.byte	0
+	.byte	0
+	.uleb128 0x9
+	.long	0x154b
+	.quad	.LBI376
+	.byte	.LVU648
+	.long	.LLRL157
+	.byte	0x48
+	.byte	0x9
+	.long	0xe59
+	.uleb128 0x1
+	.long	0x157c
+	.long	.LLST158
+	.long	.LVUS158
+	.uleb128 0x1
+	.long	0x1570
+	.long	.LLST159
+	.long	.LVUS159
+	.uleb128 0x1
+	.long	0x1564
+	.long	.LLST160
+	.long	.LVUS160
+	.uleb128 0x1
+	.long	0x1558
+	.long	.LLST161
+	.long	.LVUS161
+	.uleb128 0x8
+	.quad	.LVL141
+	.long	0x1c68
+	.uleb128 0x2
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x2
+	.byte	0x7c
+	.sleb128 0
+	.uleb128 0x2
+	.uleb128 0x1
+	.byte	0x51
+	.uleb128 0x2
+	.byte	0x7e
+	.sleb128 0
+	.byte	0
+	.byte	0
+	.uleb128 0x9
+	.long	0x15a3
+	.quad	.LBI383
+	.byte	.LVU661
+	.long	.LLRL162
+	.byte	0x4b
+	.byte	0x9
+	.long	0xe8c
+	.uleb128 0x1
+	.long	0x15bc
+	.long	.LLST163
+	.long	.LVUS163
+	.uleb128 0x1
+	.long	0x15b0
+	.long	.LLST164
+	.long	.LVUS164
+	.byte	0
+	.uleb128 0xb
+	.long	0x163a
+	.quad	.LBI386
+	.byte	.LVU671
+	.long	.LLRL165
+	.byte	0x1
+	.byte	0x4c
+	.byte	0x9
+	.uleb128 0x1
+	.long	0x1653
+	.long	.LLST166
+	.long	.LVUS166
+	.uleb128 0x1
+	.long	0x1647
+	.long	.LLST167
+	.long	.LVUS167
+	.uleb128 0x15
+	.quad	.LVL144
+	.uleb128 0x2
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x7d
+	.sleb128 0
+	.uleb128 0x2
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x2
+	.byte	0x7f
+	.sleb128 0
+	.byte	0
+	.byte	0
+	.byte	0
+	.byte	0
+	.uleb128 0x8
+	.quad	.LVL126
+	.long	0x12e6
+	.uleb128 0x2
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x7d
+	.sleb128 0
+	.uleb128 0x2
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x3
+	.byte	0x77
+	.sleb128 24
+	.byte	0x6
+	.byte	0
+	.byte	0
+	.uleb128 0x23
+	.long	.LASF80
+	.byte	0x9e
+	.long	0x41
+	.quad	.LFB40
+	.quad	.LFE40-.LFB40
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0x109c
+	.uleb128 0x10
+	.string	"ctx"
+	.byte	0x9e
+	.byte	0x2c
+	.long	0x5d4
+	.long	.LLST108
+	.long	.LVUS108
+	.uleb128 0x19
+	.long	.LASF81
+	.byte	0x9e
+	.byte	0x3d
+	.long	0x5b
+	.long	.LLST109
+	.long	.LVUS109
+	.uleb128 0x10
+	.string	"key"
+	.byte	0x9f
+	.byte	0x25
+	.long	0x5b
+	.long	.LLST110
+	.long	.LVUS110
+	.uleb128 0x19
+	.long	.LASF82
+	.byte	0x9f
+	.byte	0x33
+	.long	0x61
+	.long	.LLST111
+	.long	.LVUS111
+	.uleb128 0x19
+	.long	.LASF83
+	.byte	0x9f
+	.byte	0x45
+	.long	0x61
+	.long	.LLST112
+	.long	.LVUS112
+	.uleb128 0x24
+	.string	"P"
+	.byte	0xa1
+	.byte	0xf
+	.long	0x109c
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -176
+	.uleb128 0xb
+	.long	0x1228
+	.quad	.LBI317
+	.byte	.LVU550
+	.long	.LLRL113
+	.byte	0x1
+	.byte	0xa8
+	.byte	0x5
+	.uleb128 0x1
+	.long	0x1260
+	.long	.LLST114
+	.long	.LVUS114
+	.uleb128 0x1
+	.long	0x1254
+	.long	.LLST115
+	.long	.LVUS115
+	.uleb128 0x1
+	.long	0x1248
+	.long	.LLST116
+	.long	.LVUS116
+	.uleb128 0x1
+	.long	0x123e
+	.long	.LLST117
+	.long	.LVUS117
+	.uleb128 0x1
+	.long	0x1232
+	.long	.LLST118
+	.long	.LVUS118
+	.uleb128 0x9
+	.long	0x1228
+	.quad	.LBI319
+	.byte	.LVU556
+	.long	.LLRL119
+	.byte	0x83
+	.byte	0x6
+	.long	0x1053
+	.uleb128 0x1
+	.long	0x123e
+	.long	.LLST120
+	.long	.LVUS120
+	.uleb128 0x1
+	.long	0x1248
+	.long	.LLST121
+	.long	.LVUS121
+	.uleb128 0x1
+	.long	0x1260
+	.long	.LLST122
+	.long	.LVUS122
+	.uleb128 0x1
+	.long	0x1254
+	.long	.LLST123
+	.long	.LVUS123
+	.uleb128 0x1
+	.long	0x1232
+	.long	.LLST124
+	.long	.LVUS124
+	.uleb128 0x1b
+	.long	0x126c
+	.long	.LLRL125
+	.uleb128 0x1a
+	.long	0x126d
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -144
+	.uleb128 0x8
+	.quad	.LVL105
+	.long	0x14f6
+	.uleb128 0x2
+	.uleb128 0x1
+	.byte	0x51
+	.uleb128 0x2
+	.byte	0x8
+	.byte	0x80
+	.byte	0
+	.byte	0
+	.byte	0
+	.uleb128 0x26
+	.quad	.LVL103
+	.long	0x1290
+	.long	0x1078
+	.uleb128 0x2
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x75
+	.sleb128 0
+	.uleb128 0x2
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x2
+	.byte	0x70
+	.sleb128 0
+	.uleb128 0x2
+	.uleb128 0x1
+	.byte	0x51
+	.uleb128 0x3
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0
+	.uleb128 0x8
+	.quad	.LVL108
+	.long	0x1290
+	.uleb128 0x2
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -176
+	.uleb128 0x2
+	.uleb128 0x1
+	.byte	0x51
+	.uleb128 0x9
+	.byte	0x3
+	.quad	blake2b_salt_def
+	.byte	0
+	.byte	0
+	.byte	0
+	.uleb128 0xc
+	.long	0x4e5
+	.long	0x10ac
+	.uleb128 0xa
+	.long	0x3a
+	.byte	0x3
+	.byte	0
+	.uleb128 0x27
+	.long	.LASF85
+	.byte	0x98
+	.long	0x10cd
+	.uleb128 0x4
+	.string	"ctx"
+	.byte	0x1
+	.byte	0x98
+	.byte	0x27
+	.long	0x5d4
+	.uleb128 0x16
+	.string	"P"
+	.byte	0x1
+	.byte	0x9a
+	.byte	0xf
+	.long	0x109c
+	.byte	0
+	.uleb128 0x23
+	.long	.LASF84
+	.byte	0x8f
+	.long	0x41
+	.quad	.LFB38
+	.quad	.LFE38-.LFB38
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0x1228
+	.uleb128 0x10
+	.string	"ctx"
+	.byte	0x8f
+	.byte	0x2d
+	.long	0x5d4
+	.long	.LLST81
+	.long	.LVUS81
+	.uleb128 0x19
+	.long	.LASF81
+	.byte	0x8f
+	.byte	0x3e
+	.long	0x5b
+	.long	.LLST82
+	.long	.LVUS82
+	.uleb128 0x41
+	.long	.LASF83
+	.byte	0x1
+	.byte	0x90
+	.byte	0x22
+	.long	0x61
+	.uleb128 0x1
+	.byte	0x51
+	.uleb128 0x16
+	.string	"P"
+	.byte	0x1
+	.byte	0x92
+	.byte	0xf
+	.long	0x109c
+	.uleb128 0xb
+	.long	0x1228
+	.quad	.LBI270
+	.byte	.LVU410
+	.long	.LLRL83
+	.byte	0x1
+	.byte	0x94
+	.byte	0x5
+	.uleb128 0x1
+	.long	0x1260
+	.long	.LLST84
+	.long	.LVUS84
+	.uleb128 0x1
+	.long	0x1254
+	.long	.LLST84
+	.long	.LVUS84
+	.uleb128 0x1
+	.long	0x1248
+	.long	.LLST86
+	.long	.LVUS86
+	.uleb128 0x1
+	.long	0x123e
+	.long	.LLST87
+	.long	.LVUS87
+	.uleb128 0x1
+	.long	0x1232
+	.long	.LLST88
+	.long	.LVUS88
+	.uleb128 0xb
+	.long	0x1290
+	.quad	.LBI272
+	.byte	.LVU414
+	.long	.LLRL89
+	.byte	0x1
+	.byte	0x86
+	.byte	0x5
+	.uleb128 0x1
+	.long	0x12b3
+	.long	.LLST90
+	.long	.LVUS90
+	.uleb128 0x1
+	.long	0x12a9
+	.long	.LLST91
+	.long	.LVUS91
+	.uleb128 0x1
+	.long	0x129d
+	.long	.LLST92
+	.long	.LVUS92
+	.uleb128 0x13
+	.long	.LLRL89
+	.uleb128 0x6
+	.long	0x12bf
+	.long	.LLST93
+	.long	.LVUS93
+	.uleb128 0x14
+	.long	0x12c9
+	.long	.LLRL94
+	.long	0x120d
+	.uleb128 0x6
+	.long	0x12ce
+	.long	.LLST95
+	.long	.LVUS95
+	.uleb128 0xb
+	.long	0x15eb
+	.quad	.LBI275
+	.byte	.LVU435
+	.long	.LLRL96
+	.byte	0x1
+	.byte	0x77
+	.byte	0x25
+	.uleb128 0x1
+	.long	0x15fa
+	.long	.LLST97
+	.long	.LVUS97
+	.byte	0
+	.byte	0
+	.uleb128 0x1b
+	.long	0x12d9
+	.long	.LLRL98
+	.uleb128 0x6
+	.long	0x12da
+	.long	.LLST99
+	.long	.LVUS99
+	.byte	0
+	.byte	0
+	.byte	0
+	.byte	0
+	.byte	0
+	.uleb128 0x27
+	.long	.LASF86
+	.byte	0x83
+	.long	0x127b
+	.uleb128 0x4
+	.string	"ctx"
+	.byte	0x1
+	.byte	0x83
+	.byte	0x2d
+	.long	0x5d4
+	.uleb128 0x4
+	.string	"P"
+	.byte	0x1
+	.byte	0x83
+	.byte	0x3c
+	.long	0x127b
+	.uleb128 0x1d
+	.long	.LASF81
+	.byte	0x1
+	.byte	0x84
+	.byte	0x25
+	.long	0x5b
+	.uleb128 0x4
+	.string	"key"
+	.byte	0x1
+	.byte	0x84
+	.byte	0x37
+	.long	0x5b
+	.uleb128 0x1d
+	.long	.LASF82
+	.byte	0x1
+	.byte	0x84
+	.byte	0x45
+	.long	0x61
+	.uleb128 0x1e
+	.uleb128 0x12
+	.long	.LASF87
+	.byte	0x1
+	.byte	0x88
+	.byte	0xc
+	.long	0x1280
+	.byte	0
+	.byte	0
+	.uleb128 0x5
+	.long	0x4e5
+	.uleb128 0xc
+	.long	0x39c
+	.long	0x1290
+	.uleb128 0xa
+	.long	0x3a
+	.byte	0x7f
+	.byte	0
+	.uleb128 0x11
+	.long	.LASF90
+	.byte	0x1
+	.byte	0x70
+	.byte	0xd
+	.byte	0x1
+	.long	0x12e6
+	.uleb128 0x4
+	.string	"ctx"
+	.byte	0x1
+	.byte	0x70
+	.byte	0x31
+	.long	0x5d4
+	.uleb128 0x4
+	.string	"P"
+	.byte	0x1
+	.byte	0x71
+	.byte	0x27
+	.long	0x127b
+	.uleb128 0x1d
+	.long	.LASF81
+	.byte	0x1
+	.byte	0x71
+	.byte	0x39
+	.long	0x5b
+	.uleb128 0x16
+	.string	"i"
+	.byte	0x1
+	.byte	0x73
+	.byte	0xe
+	.long	0x61
+	.uleb128 0x42
+	.long	0x12d9
+	.uleb128 0x16
+	.string	"j"
+	.byte	0x1
+	.byte	0x76
+	.byte	0x13
+	.long	0x61
+	.byte	0
+	.uleb128 0x1e
+	.uleb128 0x16
+	.string	"j"
+	.byte	0x1
+	.byte	0x78
+	.byte	0x13
+	.long	0x61
+	.byte	0
+	.byte	0
+	.uleb128 0x30
+	.long	.LASF89
+	.byte	0x64
+	.quad	.LFB35
+	.quad	.LFE35-.LFB35
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0x14b8
+	.uleb128 0x10
+	.string	"ctx"
+	.byte	0x64
+	.byte	0x28
+	.long	0x5d4
+	.long	.LLST38
+	.long	.LVUS38
+	.uleb128 0x10
+	.string	"out"
+	.byte	0x64
+	.byte	0x3c
+	.long	0x2fd
+	.long	.LLST39
+	.long	.LVUS39
+	.uleb128 0x9
+	.long	0x1589
+	.quad	.LBI145
+	.byte	.LVU151
+	.long	.LLRL40
+	.byte	0x66
+	.byte	0x5
+	.long	0x1361
+	.uleb128 0x1
+	.long	0x1596
+	.long	.LLST41
+	.long	.LVUS41
+	.uleb128 0x8
+	.quad	.LVL40
+	.long	0x1c71
+	.uleb128 0x2
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x1
+	.byte	0x30
+	.byte	0
+	.byte	0
+	.uleb128 0x9
+	.long	0x15a3
+	.quad	.LBI155
+	.byte	.LVU172
+	.long	.LLRL42
+	.byte	0x6a
+	.byte	0x5
+	.long	0x1394
+	.uleb128 0x1
+	.long	0x15bc
+	.long	.LLST43
+	.long	.LVUS43
+	.uleb128 0x1
+	.long	0x15b0
+	.long	.LLST44
+	.long	.LVUS44
+	.byte	0
+	.uleb128 0x9
+	.long	0x163a
+	.quad	.LBI160
+	.byte	.LVU182
+	.long	.LLRL45
+	.byte	0x6b
+	.byte	0x5
+	.long	0x13dd
+	.uleb128 0x1
+	.long	0x1653
+	.long	.LLST46
+	.long	.LVUS46
+	.uleb128 0x1
+	.long	0x1647
+	.long	.LLST47
+	.long	.LVUS47
+	.uleb128 0x15
+	.quad	.LVL45
+	.uleb128 0x2
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x73
+	.sleb128 0
+	.uleb128 0x2
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x2
+	.byte	0x7c
+	.sleb128 0
+	.byte	0
+	.byte	0
+	.uleb128 0x1c
+	.long	0x14b8
+	.quad	.LBI165
+	.byte	.LVU186
+	.quad	.LBB165
+	.quad	.LBE165-.LBB165
+	.byte	0x6c
+	.byte	0x5
+	.uleb128 0x1
+	.long	0x14d1
+	.long	.LLST48
+	.long	.LVUS48
+	.uleb128 0x1
+	.long	0x14c5
+	.long	.LLST49
+	.long	.LVUS49
+	.uleb128 0x1a
+	.long	0x14dd
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -96
+	.uleb128 0x14
+	.long	0x14e9
+	.long	.LLRL50
+	.long	0x149b
+	.uleb128 0x6
+	.long	0x14ea
+	.long	.LLST51
+	.long	.LVUS51
+	.uleb128 0xb
+	.long	0x15c9
+	.quad	.LBI168
+	.byte	.LVU192
+	.long	.LLRL52
+	.byte	0x1
+	.byte	0x5f
+	.byte	0x9
+	.uleb128 0x1
+	.long	0x15e0
+	.long	.LLST53
+	.long	.LVUS53
+	.uleb128 0x1
+	.long	0x15d6
+	.long	.LLST54
+	.long	.LVUS54
+	.uleb128 0xb
+	.long	0x165e
+	.quad	.LBI169
+	.byte	.LVU194
+	.long	.LLRL55
+	.byte	0x2
+	.byte	0x7a
+	.byte	0x5
+	.uleb128 0x1
+	.long	0x1675
+	.long	.LLST56
+	.long	.LVUS56
+	.uleb128 0x1
+	.long	0x166b
+	.long	.LLST57
+	.long	.LVUS57
+	.byte	0
+	.byte	0
+	.byte	0
+	.uleb128 0x8
+	.quad	.LVL55
+	.long	0x1c68
+	.uleb128 0x2
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x76
+	.sleb128 0
+	.uleb128 0x2
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -96
+	.byte	0
+	.byte	0
+	.byte	0
+	.uleb128 0x11
+	.long	.LASF91
+	.byte	0x1
+	.byte	0x5b
+	.byte	0xd
+	.byte	0x1
+	.long	0x14f6
+	.uleb128 0x4
+	.string	"ctx"
+	.byte	0x1
+	.byte	0x5b
+	.byte	0x37
+	.long	0x5d4
+	.uleb128 0x4
+	.string	"out"
+	.byte	0x1
+	.byte	0x5b
+	.byte	0x4b
+	.long	0x2fd
+	.uleb128 0x12
+	.long	.LASF92
+	.byte	0x1
+	.byte	0x5d
+	.byte	0x13
+	.long	0x2ed
+	.uleb128 0x1e
+	.uleb128 0x16
+	.string	"i"
+	.byte	0x1
+	.byte	0x5e
+	.byte	0x13
+	.long	0x61
+	.byte	0
+	.byte	0
+	.uleb128 0x27
+	.long	.LASF93
+	.byte	0x3c
+	.long	0x154b
+	.uleb128 0x4
+	.string	"ctx"
+	.byte	0x1
+	.byte	0x3c
+	.byte	0x29
+	.long	0x5d4
+	.uleb128 0x4
+	.string	"src"
+	.byte	0x1
+	.byte	0x3c
+	.byte	0x3a
+	.long	0x5b
+	.uleb128 0x4
+	.string	"len"
+	.byte	0x1
+	.byte	0x3c
+	.byte	0x46
+	.long	0x2e
+	.uleb128 0x12
+	.long	.LASF94
+	.byte	0x1
+	.byte	0x3e
+	.byte	0xe
+	.long	0x61
+	.uleb128 0x12
+	.long	.LASF95
+	.byte	0x1
+	.byte	0x3f
+	.byte	0xc
+	.long	0x2e
+	.uleb128 0x1e
+	.uleb128 0x12
+	.long	.LASF96
+	.byte	0x1
+	.byte	0x52
+	.byte	0x10
+	.long	0x2e
+	.byte	0
+	.byte	0
+	.uleb128 0x11
+	.long	.LASF97
+	.byte	0x1
+	.byte	0x32
+	.byte	0xd
+	.byte	0x1
+	.long	0x1589
+	.uleb128 0x4
+	.string	"ctx"
+	.byte	0x1
+	.byte	0x32
+	.byte	0x31
+	.long	0x5d4
+	.uleb128 0x4
+	.string	"src"
+	.byte	0x1
+	.byte	0x32
+	.byte	0x42
+	.long	0x5b
+	.uleb128 0x4
+	.string	"len"
+	.byte	0x1
+	.byte	0x33
+	.byte	0x24
+	.long	0x2e
+	.uleb128 0x4
+	.string	"off"
+	.byte	0x1
+	.byte	0x33
+	.byte	0x30
+	.long	0x2e
+	.byte	0
+	.uleb128 0x11
+	.long	.LASF98
+	.byte	0x1
+	.byte	0x2d
+	.byte	0xd
+	.byte	0x1
+	.long	0x15a3
+	.uleb128 0x4
+	.string	"ctx"
+	.byte	0x1
+	.byte	0x2d
+	.byte	0x35
+	.long	0x5d4
+	.byte	0
+	.uleb128 0x11
+	.long	.LASF99
+	.byte	0x1
+	.byte	0x27
+	.byte	0xd
+	.byte	0x1
+	.long	0x15c9
+	.uleb128 0x4
+	.string	"ctx"
+	.byte	0x1
+	.byte	0x27
+	.byte	0x2f
+	.long	0x5d4
+	.uleb128 0x4
+	.string	"inc"
+	.byte	0x1
+	.byte	0x27
+	.byte	0x3b
+	.long	0x2e
+	.byte	0
+	.uleb128 0x11
+	.long	.LASF100
+	.byte	0x2
+	.byte	0x78
+	.byte	0x14
+	.byte	0x3
+	.long	0x15eb
+	.uleb128 0x4
+	.string	"y"
+	.byte	0x2
+	.byte	0x78
+	.byte	0x2e
+	.long	0x2fd
+	.uleb128 0x4
+	.string	"x"
+	.byte	0x2
+	.byte	0x78
+	.byte	0x35
+	.long	0x4d9
+	.byte	0
+	.uleb128 0x28
+	.long	.LASF104
+	.byte	0x2
+	.byte	0x74
+	.long	0x4d9
+	.long	0x1605
+	.uleb128 0x4
+	.string	"x"
+	.byte	0x2
+	.byte	0x74
+	.byte	0x32
+	.long	0x1605
+	.byte	0
+	.uleb128 0x5
+	.long	0x76
+	.uleb128 0x11
+	.long	.LASF101
+	.byte	0x2
+	.byte	0x4b
+	.byte	0x14
+	.byte	0x3
+	.long	0x163a
+	.uleb128 0x4
+	.string	"ctx"
+	.byte	0x2
+	.byte	0x4b
+	.byte	0x40
+	.long	0x5d4
+	.uleb128 0x4
+	.string	"m"
+	.byte	0x2
+	.byte	0x4c
+	.byte	0x38
+	.long	0x5b
+	.uleb128 0x1d
+	.long	.LASF96
+	.byte	0x2
+	.byte	0x4c
+	.byte	0x42
+	.long	0x2e
+	.byte	0
+	.uleb128 0x11
+	.long	.LASF102
+	.byte	0x2
+	.byte	0x46
+	.byte	0x14
+	.byte	0x3
+	.long	0x165e
+	.uleb128 0x4
+	.string	"ctx"
+	.byte	0x2
+	.byte	0x46
+	.byte	0x39
+	.long	0x5d4
+	.uleb128 0x4
+	.string	"m"
+	.byte	0x2
+	.byte	0x46
+	.byte	0x4a
+	.long	0x5b
+	.byte	0
+	.uleb128 0x11
+	.long	.LASF103
+	.byte	0x3
+	.byte	0xde
+	.byte	0x14
+	.byte	0x3
+	.long	0x1680
+	.uleb128 0x4
+	.string	"y"
+	.byte	0x3
+	.byte	0xde
+	.byte	0x2e
+	.long	0x2fd
+	.uleb128 0x4
+	.string	"x"
+	.byte	0x3
+	.byte	0xde
+	.byte	0x35
+	.long	0x3ac
+	.byte	0
+	.uleb128 0x28
+	.long	.LASF105
+	.byte	0x3
+	.byte	0xd9
+	.long	0x3ac
+	.long	0x16a4
+	.uleb128 0x4
+	.string	"x"
+	.byte	0x3
+	.byte	0xd9
+	.byte	0x32
+	.long	0x1605
+	.uleb128 0x16
+	.string	"w"
+	.byte	0x3
+	.byte	0xda
+	.byte	0x9
+	.long	0x3ac
+	.byte	0
+	.uleb128 0x28
+	.long	.LASF106
+	.byte	0x3
+	.byte	0xd4
+	.long	0x3ac
+	.long	0x16ca
+	.uleb128 0x4
+	.string	"x"
+	.byte	0x3
+	.byte	0xd4
+	.byte	0x1f
+	.long	0x3ac
+	.uleb128 0x12
+	.long	.LASF107
+	.byte	0x3
+	.byte	0xd5
+	.byte	0xf
+	.long	0x48
+	.byte	0
+	.uleb128 0x1f
+	.long	0x1290
+	.quad	.LFB36
+	.quad	.LFE36-.LFB36
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0x1769
+	.uleb128 0x31
+	.long	0x129d
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x1
+	.long	0x12a9
+	.long	.LLST0
+	.long	.LVUS0
+	.uleb128 0x1
+	.long	0x12b3
+	.long	.LLST1
+	.long	.LVUS1
+	.uleb128 0x6
+	.long	0x12bf
+	.long	.LLST2
+	.long	.LVUS2
+	.uleb128 0x14
+	.long	0x12d9
+	.long	.LLRL3
+	.long	0x172e
+	.uleb128 0x6
+	.long	0x12da
+	.long	.LLST4
+	.long	.LVUS4
+	.byte	0
+	.uleb128 0x1b
+	.long	0x12c9
+	.long	.LLRL5
+	.uleb128 0x6
+	.long	0x12ce
+	.long	.LLST6
+	.long	.LVUS6
+	.uleb128 0xb
+	.long	0x15eb
+	.quad	.LBI82
+	.byte	.LVU29
+	.long	.LLRL7
+	.byte	0x1
+	.byte	0x77
+	.byte	0x25
+	.uleb128 0x1
+	.long	0x15fa
+	.long	.LLST8
+	.long	.LVUS8
+	.byte	0
+	.byte	0
+	.byte	0
+	.uleb128 0x1f
+	.long	0x14f6
+	.quad	.LFB33
+	.quad	.LFE33-.LFB33
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0x19dd
+	.uleb128 0x1
+	.long	0x1500
+	.long	.LLST9
+	.long	.LVUS9
+	.uleb128 0x1
+	.long	0x150c
+	.long	.LLST10
+	.long	.LVUS10
+	.uleb128 0x1
+	.long	0x1518
+	.long	.LLST11
+	.long	.LVUS11
+	.uleb128 0x6
+	.long	0x1524
+	.long	.LLST12
+	.long	.LVUS12
+	.uleb128 0x6
+	.long	0x1530
+	.long	.LLST13
+	.long	.LVUS13
+	.uleb128 0x9
+	.long	0x154b
+	.quad	.LBI102
+	.byte	.LVU142
+	.long	.LLRL14
+	.byte	0x43
+	.byte	0x9
+	.long	0x1828
+	.uleb128 0x1
+	.long	0x157c
+	.long	.LLST15
+	.long	.LVUS15
+	.uleb128 0x1
+	.long	0x1570
+	.long	.LLST16
+	.long	.LVUS16
+	.uleb128 0x17
+	.long	0x1564
+	.uleb128 0x1
+	.long	0x1558
+	.long	.LLST17
+	.long	.LVUS17
+	.uleb128 0x8
+	.quad	.LVL36
+	.long	0x1c68
+	.uleb128 0x2
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x5
+	.byte	0x7f
+	.sleb128 0
+	.byte	0x7d
+	.sleb128 0
+	.byte	0x22
+	.uleb128 0x2
+	.uleb128 0x1
+	.byte	0x51
+	.uleb128 0x3
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x51
+	.byte	0
+	.byte	0
+	.uleb128 0x25
+	.long	0x154b
+	.quad	.LBI106
+	.byte	.LVU85
+	.quad	.LBB106
+	.quad	.LBE106-.LBB106
+	.long	0x1891
+	.uleb128 0x1
+	.long	0x157c
+	.long	.LLST18
+	.long	.LVUS18
+	.uleb128 0x1
+	.long	0x1570
+	.long	.LLST19
+	.long	.LVUS19
+	.uleb128 0x17
+	.long	0x1564
+	.uleb128 0x1
+	.long	0x1558
+	.long	.LLST20
+	.long	.LVUS20
+	.uleb128 0x8
+	.quad	.LVL15
+	.long	0x1c68
+	.uleb128 0x2
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x7f
+	.sleb128 0
+	.uleb128 0x2
+	.uleb128 0x1
+	.byte	0x51
+	.uleb128 0x2
+	.byte	0x73
+	.sleb128 0
+	.byte	0
+	.byte	0
+	.uleb128 0x14
+	.long	0x153c
+	.long	.LLRL21
+	.long	0x18f9
+	.uleb128 0x6
+	.long	0x153d
+	.long	.LLST22
+	.long	.LVUS22
+	.uleb128 0xb
+	.long	0x160a
+	.quad	.LBI110
+	.byte	.LVU97
+	.long	.LLRL23
+	.byte	0x1
+	.byte	0x53
+	.byte	0x9
+	.uleb128 0x1
+	.long	0x162d
+	.long	.LLST24
+	.long	.LVUS24
+	.uleb128 0x1
+	.long	0x1623
+	.long	.LLST25
+	.long	.LVUS25
+	.uleb128 0x1
+	.long	0x1617
+	.long	.LLST26
+	.long	.LVUS26
+	.uleb128 0x15
+	.quad	.LVL24
+	.uleb128 0x2
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x76
+	.sleb128 0
+	.byte	0
+	.byte	0
+	.byte	0
+	.uleb128 0x9
+	.long	0x154b
+	.quad	.LBI114
+	.byte	.LVU111
+	.long	.LLRL27
+	.byte	0x48
+	.byte	0x9
+	.long	0x1963
+	.uleb128 0x1
+	.long	0x157c
+	.long	.LLST28
+	.long	.LVUS28
+	.uleb128 0x1
+	.long	0x1570
+	.long	.LLST29
+	.long	.LVUS29
+	.uleb128 0x1
+	.long	0x1564
+	.long	.LLST30
+	.long	.LVUS30
+	.uleb128 0x1
+	.long	0x1558
+	.long	.LLST31
+	.long	.LVUS31
+	.uleb128 0x8
+	.quad	.LVL30
+	.long	0x1c68
+	.uleb128 0x2
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x5
+	.byte	0x7f
+	.sleb128 0
+	.byte	0x7d
+	.sleb128 0
+	.byte	0x22
+	.uleb128 0x2
+	.uleb128 0x1
+	.byte	0x51
+	.uleb128 0x2
+	.byte	0x7e
+	.sleb128 0
+	.byte	0
+	.byte	0
+	.uleb128 0x9
+	.long	0x15a3
+	.quad	.LBI119
+	.byte	.LVU125
+	.long	.LLRL32
+	.byte	0x4b
+	.byte	0x9
+	.long	0x1996
+	.uleb128 0x1
+	.long	0x15bc
+	.long	.LLST33
+	.long	.LVUS33
+	.uleb128 0x1
+	.long	0x15b0
+	.long	.LLST34
+	.long	.LVUS34
+	.byte	0
+	.uleb128 0xb
+	.long	0x163a
+	.quad	.LBI122
+	.byte	.LVU135
+	.long	.LLRL35
+	.byte	0x1
+	.byte	0x4c
+	.byte	0x9
+	.uleb128 0x1
+	.long	0x1653
+	.long	.LLST36
+	.long	.LVUS36
+	.uleb128 0x1
+	.long	0x1647
+	.long	.LLST37
+	.long	.LVUS37
+	.uleb128 0x15
+	.quad	.LVL33
+	.uleb128 0x2
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x76
+	.sleb128 0
+	.uleb128 0x2
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x2
+	.byte	0x7f
+	.sleb128 0
+	.byte	0
+	.byte	0
+	.byte	0
+	.uleb128 0x1f
+	.long	0x1228
+	.quad	.LFB37
+	.quad	.LFE37-.LFB37
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0x1b93
+	.uleb128 0x1
+	.long	0x1232
+	.long	.LLST58
+	.long	.LVUS58
+	.uleb128 0x1
+	.long	0x123e
+	.long	.LLST59
+	.long	.LVUS59
+	.uleb128 0x1
+	.long	0x1248
+	.long	.LLST60
+	.long	.LVUS60
+	.uleb128 0x1
+	.long	0x1254
+	.long	.LLST61
+	.long	.LVUS61
+	.uleb128 0x1
+	.long	0x1260
+	.long	.LLST62
+	.long	.LVUS62
+	.uleb128 0x9
+	.long	0x1290
+	.quad	.LBI231
+	.byte	.LVU321
+	.long	.LLRL63
+	.byte	0x86
+	.byte	0x5
+	.long	0x1ae1
+	.uleb128 0x1
+	.long	0x12b3
+	.long	.LLST64
+	.long	.LVUS64
+	.uleb128 0x1
+	.long	0x12a9
+	.long	.LLST65
+	.long	.LVUS65
+	.uleb128 0x1
+	.long	0x129d
+	.long	.LLST66
+	.long	.LVUS66
+	.uleb128 0x13
+	.long	.LLRL63
+	.uleb128 0x6
+	.long	0x12bf
+	.long	.LLST67
+	.long	.LVUS67
+	.uleb128 0x14
+	.long	0x12d9
+	.long	.LLRL68
+	.long	0x1aa5
+	.uleb128 0x6
+	.long	0x12da
+	.long	.LLST69
+	.long	.LVUS69
+	.byte	0
+	.uleb128 0x1b
+	.long	0x12c9
+	.long	.LLRL70
+	.uleb128 0x6
+	.long	0x12ce
+	.long	.LLST71
+	.long	.LVUS71
+	.uleb128 0xb
+	.long	0x15eb
+	.quad	.LBI235
+	.byte	.LVU345
+	.long	.LLRL72
+	.byte	0x1
+	.byte	0x77
+	.byte	0x25
+	.uleb128 0x1
+	.long	0x15fa
+	.long	.LLST73
+	.long	.LVUS73
+	.byte	0
+	.byte	0
+	.byte	0
+	.byte	0
+	.uleb128 0xb
+	.long	0x1228
+	.quad	.LBI244
+	.byte	.LVU389
+	.long	.LLRL74
+	.byte	0x1
+	.byte	0x83
+	.byte	0x6
+	.uleb128 0x1
+	.long	0x123e
+	.long	.LLST75
+	.long	.LVUS75
+	.uleb128 0x1
+	.long	0x1248
+	.long	.LLST76
+	.long	.LVUS76
+	.uleb128 0x1
+	.long	0x1260
+	.long	.LLST77
+	.long	.LVUS77
+	.uleb128 0x1
+	.long	0x1254
+	.long	.LLST78
+	.long	.LVUS78
+	.uleb128 0x1
+	.long	0x1232
+	.long	.LLST79
+	.long	.LVUS79
+	.uleb128 0x1b
+	.long	0x126c
+	.long	.LLRL80
+	.uleb128 0x1a
+	.long	0x126d
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -144
+	.uleb128 0x26
+	.quad	.LVL74
+	.long	0x1c68
+	.long	0x1b76
+	.uleb128 0x2
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -144
+	.uleb128 0x2
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x3
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x52
+	.uleb128 0x2
+	.uleb128 0x1
+	.byte	0x51
+	.uleb128 0x9
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x58
+	.byte	0xc
+	.long	0xffffffff
+	.byte	0x1a
+	.byte	0
+	.uleb128 0x8
+	.quad	.LVL75
+	.long	0x14f6
+	.uleb128 0x2
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x73
+	.sleb128 0
+	.uleb128 0x2
+	.uleb128 0x1
+	.byte	0x51
+	.uleb128 0x2
+	.byte	0x8
+	.byte	0x80
+	.byte	0
+	.byte	0
+	.byte	0
+	.byte	0
+	.uleb128 0x1f
+	.long	0x10ac
+	.quad	.LFB39
+	.quad	.LFE39-.LFB39
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0x1c68
+	.uleb128 0x31
+	.long	0x10b6
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x43
+	.long	0x10c2
+	.uleb128 0x1c
+	.long	0x1228
+	.quad	.LBI307
+	.byte	.LVU481
+	.quad	.LBB307
+	.quad	.LBE307-.LBB307
+	.byte	0x9b
+	.byte	0x5
+	.uleb128 0x1
+	.long	0x1260
+	.long	.LLST100
+	.long	.LVUS100
+	.uleb128 0x1
+	.long	0x1254
+	.long	.LLST100
+	.long	.LVUS100
+	.uleb128 0x1
+	.long	0x1248
+	.long	.LLST100
+	.long	.LVUS100
+	.uleb128 0x17
+	.long	0x123e
+	.uleb128 0x1
+	.long	0x1232
+	.long	.LLST103
+	.long	.LVUS103
+	.uleb128 0x1c
+	.long	0x1290
+	.quad	.LBI308
+	.byte	.LVU483
+	.quad	.LBB308
+	.quad	.LBE308-.LBB308
+	.byte	0x86
+	.byte	0x5
+	.uleb128 0x1
+	.long	0x12b3
+	.long	.LLST104
+	.long	.LVUS104
+	.uleb128 0x17
+	.long	0x12a9
+	.uleb128 0x1
+	.long	0x129d
+	.long	.LLST105
+	.long	.LVUS105
+	.uleb128 0x13
+	.long	.LLRL106
+	.uleb128 0x6
+	.long	0x12bf
+	.long	.LLST107
+	.long	.LVUS107
+	.byte	0
+	.byte	0
+	.byte	0
+	.byte	0
+	.uleb128 0x32
+	.long	.LASF75
+	.long	.LASF108
+	.uleb128 0x32
+	.long	.LASF74
+	.long	.LASF109
+	.byte	0
+	.section	.debug_abbrev,"",@progbits
+.Ldebug_abbrev0:
+	.uleb128 0x1
+	.uleb128 0x5
+	.byte	0
+	.uleb128 0x31
+	.uleb128 0x13
+	.uleb128 0x2
+	.uleb128 0x17
+	.uleb128 0x2137
+	.uleb128 0x17
+	.byte	0
+	.byte	0
+	.uleb128 0x2
+	.uleb128 0x49
+	.byte	0
+	.uleb128 0x2
+	.uleb128 0x18
+	.uleb128 0x7e
+	.uleb128 0x18
+	.byte	0
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xd
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x38
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x4
+	.uleb128 0x5
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x8
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x5
+	.uleb128 0xf
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0x21
+	.sleb128 8
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x6
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x31
+	.uleb128 0x13
+	.uleb128 0x2
+	.uleb128 0x17
+	.uleb128 0x2137
+	.uleb128 0x17
+	.byte	0
+	.byte	0
+	.uleb128 0x7
+	.uleb128 0x5
+	.byte	0
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x8
+	.uleb128 0x48
+	.byte	0x1
+	.uleb128 0x7d
+	.uleb128 0x1
+	.uleb128 0x7f
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x9
+	.uleb128 0x1d
+	.byte	0x1
+	.uleb128 0x31
+	.uleb128 0x13
+	.uleb128 0x52
+	.uleb128 0x1
+	.uleb128 0x2138
+	.uleb128 0xb
+	.uleb128 0x55
+	.uleb128 0x17
+	.uleb128 0x58
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x59
+	.uleb128 0xb
+	.uleb128 0x57
+	.uleb128 0xb
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0xa
+	.uleb128 0x21
+	.byte	0
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x2f
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0x1d
+	.byte	0x1
+	.uleb128 0x31
+	.uleb128 0x13
+	.uleb128 0x52
+	.uleb128 0x1
+	.uleb128 0x2138
+	.uleb128 0xb
+	.uleb128 0x55
+	.uleb128 0x17
+	.uleb128 0x58
+	.uleb128 0xb
+	.uleb128 0x59
+	.uleb128 0xb
+	.uleb128 0x57
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0xc
+	.uleb128 0x1
+	.byte	0x1
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0xd
+	.uleb128 0x26
+	.byte	0
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0xe
+	.uleb128 0x16
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0xf
+	.uleb128 0x24
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x3e
+	.uleb128 0xb
+	.uleb128 0x3
+	.uleb128 0xe
+	.byte	0
+	.byte	0
+	.uleb128 0x10
+	.uleb128 0x5
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x8
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x2
+	.uleb128 0x17
+	.uleb128 0x2137
+	.uleb128 0x17
+	.byte	0
+	.byte	0
+	.uleb128 0x11
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x20
+	.uleb128 0xb
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x12
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x13
+	.uleb128 0xb
+	.byte	0x1
+	.uleb128 0x55
+	.uleb128 0x17
+	.byte	0
+	.byte	0
+	.uleb128 0x14
+	.uleb128 0xb
+	.byte	0x1
+	.uleb128 0x31
+	.uleb128 0x13
+	.uleb128 0x55
+	.uleb128 0x17
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x15
+	.uleb128 0x48
+	.byte	0x1
+	.uleb128 0x7d
+	.uleb128 0x1
+	.byte	0
+	.byte	0
+	.uleb128 0x16
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x8
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x17
+	.uleb128 0x5
+	.byte	0
+	.uleb128 0x31
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x18
+	.uleb128 0xd
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x8
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x38
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x19
+	.uleb128 0x5
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x2
+	.uleb128 0x17
+	.uleb128 0x2137
+	.uleb128 0x17
+	.byte	0
+	.byte	0
+	.uleb128 0x1a
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x31
+	.uleb128 0x13
+	.uleb128 0x2
+	.uleb128 0x18
+	.byte	0
+	.byte	0
+	.uleb128 0x1b
+	.uleb128 0xb
+	.byte	0x1
+	.uleb128 0x31
+	.uleb128 0x13
+	.uleb128 0x55
+	.uleb128 0x17
+	.byte	0
+	.byte	0
+	.uleb128 0x1c
+	.uleb128 0x1d
+	.byte	0x1
+	.uleb128 0x31
+	.uleb128 0x13
+	.uleb128 0x52
+	.uleb128 0x1
+	.uleb128 0x2138
+	.uleb128 0xb
+	.uleb128 0x11
+	.uleb128 0x1
+	.uleb128 0x12
+	.uleb128 0x7
+	.uleb128 0x58
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x59
+	.uleb128 0xb
+	.uleb128 0x57
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x1d
+	.uleb128 0x5
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x1e
+	.uleb128 0xb
+	.byte	0x1
+	.byte	0
+	.byte	0
+	.uleb128 0x1f
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x31
+	.uleb128 0x13
+	.uleb128 0x11
+	.uleb128 0x1
+	.uleb128 0x12
+	.uleb128 0x7
+	.uleb128 0x40
+	.uleb128 0x18
+	.uleb128 0x7a
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x20
+	.uleb128 0x13
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3c
+	.uleb128 0x19
+	.byte	0
+	.byte	0
+	.uleb128 0x21
+	.uleb128 0x16
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x8
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x22
+	.uleb128 0x15
+	.byte	0x1
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x23
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 5
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x11
+	.uleb128 0x1
+	.uleb128 0x12
+	.uleb128 0x7
+	.uleb128 0x40
+	.uleb128 0x18
+	.uleb128 0x7a
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x24
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x8
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x2
+	.uleb128 0x18
+	.byte	0
+	.byte	0
+	.uleb128 0x25
+	.uleb128 0x1d
+	.byte	0x1
+	.uleb128 0x31
+	.uleb128 0x13
+	.uleb128 0x52
+	.uleb128 0x1
+	.uleb128 0x2138
+	.uleb128 0xb
+	.uleb128 0x11
+	.uleb128 0x1
+	.uleb128 0x12
+	.uleb128 0x7
+	.uleb128 0x58
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x59
+	.uleb128 0x21
+	.sleb128 88
+	.uleb128 0x57
+	.uleb128 0x21
+	.sleb128 5
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x26
+	.uleb128 0x48
+	.byte	0x1
+	.uleb128 0x7d
+	.uleb128 0x1
+	.uleb128 0x7f
+	.uleb128 0x13
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x27
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 6
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x20
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x28
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 19
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x20
+	.uleb128 0x21
+	.sleb128 3
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x29
+	.uleb128 0x37
+	.byte	0
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x2a
+	.uleb128 0x13
+	.byte	0x1
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 8
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x2b
+	.uleb128 0x13
+	.byte	0x1
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0xb
+	.uleb128 0x5
+	.uleb128 0x88
+	.uleb128 0x21
+	.sleb128 32
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 8
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x2c
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 3
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x1c
+	.uleb128 0xa
+	.byte	0
+	.byte	0
+	.uleb128 0x2d
+	.uleb128 0xd
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x8
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 2
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 9
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x38
+	.uleb128 0x5
+	.byte	0
+	.byte	0
+	.uleb128 0x2e
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 10
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x3c
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x2f
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 11
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 14
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x3c
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x30
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 6
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x11
+	.uleb128 0x1
+	.uleb128 0x12
+	.uleb128 0x7
+	.uleb128 0x40
+	.uleb128 0x18
+	.uleb128 0x7a
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x31
+	.uleb128 0x5
+	.byte	0
+	.uleb128 0x31
+	.uleb128 0x13
+	.uleb128 0x2
+	.uleb128 0x18
+	.byte	0
+	.byte	0
+	.uleb128 0x32
+	.uleb128 0x2e
+	.byte	0
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3c
+	.uleb128 0x19
+	.uleb128 0x6e
+	.uleb128 0xe
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 12
+	.uleb128 0x3b
+	.uleb128 0x21
+	.sleb128 0
+	.byte	0
+	.byte	0
+	.uleb128 0x33
+	.uleb128 0x11
+	.byte	0x1
+	.uleb128 0x25
+	.uleb128 0xe
+	.uleb128 0x13
+	.uleb128 0xb
+	.uleb128 0x3
+	.uleb128 0x1f
+	.uleb128 0x1b
+	.uleb128 0x1f
+	.uleb128 0x11
+	.uleb128 0x1
+	.uleb128 0x12
+	.uleb128 0x7
+	.uleb128 0x10
+	.uleb128 0x17
+	.byte	0
+	.byte	0
+	.uleb128 0x34
+	.uleb128 0x24
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x3e
+	.uleb128 0xb
+	.uleb128 0x3
+	.uleb128 0x8
+	.byte	0
+	.byte	0
+	.uleb128 0x35
+	.uleb128 0x26
+	.byte	0
+	.byte	0
+	.byte	0
+	.uleb128 0x36
+	.uleb128 0xf
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x37
+	.uleb128 0x16
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x38
+	.uleb128 0x15
+	.byte	0
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x39
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3c
+	.uleb128 0x19
+	.byte	0
+	.byte	0
+	.uleb128 0x3a
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x2
+	.uleb128 0x18
+	.byte	0
+	.byte	0
+	.uleb128 0x3b
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x8
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x88
+	.uleb128 0xb
+	.uleb128 0x2
+	.uleb128 0x18
+	.byte	0
+	.byte	0
+	.uleb128 0x3c
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x8
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x1c
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x3d
+	.uleb128 0xa
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x11
+	.uleb128 0x1
+	.byte	0
+	.byte	0
+	.uleb128 0x3e
+	.uleb128 0xb
+	.byte	0x1
+	.uleb128 0x55
+	.uleb128 0x17
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x3f
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x2
+	.uleb128 0x17
+	.uleb128 0x2137
+	.uleb128 0x17
+	.byte	0
+	.byte	0
+	.uleb128 0x40
+	.uleb128 0x21
+	.byte	0
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x2f
+	.uleb128 0x5
+	.byte	0
+	.byte	0
+	.uleb128 0x41
+	.uleb128 0x5
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x2
+	.uleb128 0x18
+	.byte	0
+	.byte	0
+	.uleb128 0x42
+	.uleb128 0xb
+	.byte	0x1
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x43
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x31
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.byte	0
+	.section	.debug_loclists,"",@progbits
+	.long	.Ldebug_loc3-.Ldebug_loc2
+.Ldebug_loc2:
+	.value	0x5
+	.byte	0x8
+	.byte	0
+	.long	0
+.Ldebug_loc0:
+.LVUS168:
+	.uleb128 0
+	.uleb128 .LVU700
+	.uleb128 .LVU700
+	.uleb128 .LVU806
+	.uleb128 .LVU806
+	.uleb128 .LVU807
+	.uleb128 .LVU807
+	.uleb128 .LVU810
+	.uleb128 .LVU810
+	.uleb128 0
+.LLST168:
+	.byte	0x4
+	.uleb128 .LVL149-.Ltext0
+	.uleb128 .LVL151-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL151-.Ltext0
+	.uleb128 .LVL185-.Ltext0
+	.uleb128 0x2
+	.byte	0x77
+	.sleb128 40
+	.byte	0x4
+	.uleb128 .LVL185-.Ltext0
+	.uleb128 .LVL186-.Ltext0
+	.uleb128 0x3
+	.byte	0x7c
+	.sleb128 -280
+	.byte	0x4
+	.uleb128 .LVL186-.Ltext0
+	.uleb128 .LVL189-.Ltext0
+	.uleb128 0x9
+	.byte	0x76
+	.sleb128 -40
+	.byte	0x9
+	.byte	0xc0
+	.byte	0x1a
+	.byte	0xa
+	.value	0x2118
+	.byte	0x1c
+	.byte	0x4
+	.uleb128 .LVL189-.Ltext0
+	.uleb128 .LFE42-.Ltext0
+	.uleb128 0x9
+	.byte	0x77
+	.sleb128 -48
+	.byte	0x9
+	.byte	0xc0
+	.byte	0x1a
+	.byte	0xa
+	.value	0x2118
+	.byte	0x1c
+	.byte	0
+.LVUS169:
+	.uleb128 0
+	.uleb128 .LVU703
+	.uleb128 .LVU703
+	.uleb128 .LVU808
+	.uleb128 .LVU808
+	.uleb128 0
+.LLST169:
+	.byte	0x4
+	.uleb128 .LVL149-.Ltext0
+	.uleb128 .LVL152-.Ltext0
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x4
+	.uleb128 .LVL152-.Ltext0
+	.uleb128 .LVL187-.Ltext0
+	.uleb128 0x1
+	.byte	0x5e
+	.byte	0x4
+	.uleb128 .LVL187-.Ltext0
+	.uleb128 .LFE42-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x9f
+	.byte	0
+.LVUS179:
+	.uleb128 .LVU713
+	.uleb128 .LVU715
+	.uleb128 .LVU742
+	.uleb128 .LVU750
+	.uleb128 .LVU750
+	.uleb128 .LVU763
+	.uleb128 .LVU789
+	.uleb128 .LVU797
+	.uleb128 .LVU797
+	.uleb128 .LVU799
+	.uleb128 .LVU799
+	.uleb128 .LVU809
+.LLST179:
+	.byte	0x4
+	.uleb128 .LVL155-.Ltext0
+	.uleb128 .LVL156-.Ltext0
+	.uleb128 0x1
+	.byte	0x5f
+	.byte	0x4
+	.uleb128 .LVL167-.Ltext0
+	.uleb128 .LVL169-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL169-.Ltext0
+	.uleb128 .LVL173-.Ltext0
+	.uleb128 0x1
+	.byte	0x5f
+	.byte	0x4
+	.uleb128 .LVL178-.Ltext0
+	.uleb128 .LVL182-.Ltext0
+	.uleb128 0x1
+	.byte	0x5f
+	.byte	0x4
+	.uleb128 .LVL182-.Ltext0
+	.uleb128 .LVL183-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL183-1-.Ltext0
+	.uleb128 .LVL188-.Ltext0
+	.uleb128 0x1
+	.byte	0x5f
+	.byte	0
+.LVUS181:
+	.uleb128 .LVU713
+	.uleb128 .LVU738
+	.uleb128 .LVU746
+	.uleb128 .LVU750
+	.uleb128 .LVU750
+	.uleb128 .LVU763
+	.uleb128 .LVU771
+	.uleb128 .LVU797
+.LLST181:
+	.byte	0x4
+	.uleb128 .LVL155-.Ltext0
+	.uleb128 .LVL165-.Ltext0
+	.uleb128 0x1
+	.byte	0x5f
+	.byte	0x4
+	.uleb128 .LVL168-.Ltext0
+	.uleb128 .LVL169-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL169-.Ltext0
+	.uleb128 .LVL173-.Ltext0
+	.uleb128 0x1
+	.byte	0x5f
+	.byte	0x4
+	.uleb128 .LVL175-.Ltext0
+	.uleb128 .LVL182-.Ltext0
+	.uleb128 0x1
+	.byte	0x5f
+	.byte	0
+.LVUS182:
+	.uleb128 .LVU713
+	.uleb128 .LVU738
+	.uleb128 .LVU746
+	.uleb128 .LVU797
+.LLST182:
+	.byte	0x4
+	.uleb128 .LVL155-.Ltext0
+	.uleb128 .LVL165-.Ltext0
+	.uleb128 0x4
+	.byte	0x77
+	.sleb128 320
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL168-.Ltext0
+	.uleb128 .LVL182-.Ltext0
+	.uleb128 0x4
+	.byte	0x77
+	.sleb128 320
+	.byte	0x9f
+	.byte	0
+.LVUS183:
+	.uleb128 .LVU713
+	.uleb128 .LVU738
+	.uleb128 .LVU746
+	.uleb128 .LVU797
+.LLST183:
+	.byte	0x4
+	.uleb128 .LVL155-.Ltext0
+	.uleb128 .LVL165-.Ltext0
+	.uleb128 0x4
+	.byte	0x77
+	.sleb128 64
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL168-.Ltext0
+	.uleb128 .LVL182-.Ltext0
+	.uleb128 0x4
+	.byte	0x77
+	.sleb128 64
+	.byte	0x9f
+	.byte	0
+.LVUS184:
+	.uleb128 .LVU713
+	.uleb128 .LVU715
+	.uleb128 .LVU751
+	.uleb128 .LVU761
+	.uleb128 .LVU761
+	.uleb128 .LVU764
+	.uleb128 .LVU789
+	.uleb128 .LVU792
+	.uleb128 .LVU792
+	.uleb128 .LVU797
+.LLST184:
+	.byte	0x4
+	.uleb128 .LVL155-.Ltext0
+	.uleb128 .LVL156-.Ltext0
+	.uleb128 0x6
+	.byte	0x8
+	.byte	0x80
+	.byte	0x75
+	.sleb128 0
+	.byte	0x1c
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL170-.Ltext0
+	.uleb128 .LVL172-.Ltext0
+	.uleb128 0x6
+	.byte	0x8
+	.byte	0x80
+	.byte	0x75
+	.sleb128 0
+	.byte	0x1c
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL172-.Ltext0
+	.uleb128 .LVL174-1-.Ltext0
+	.uleb128 0x9
+	.byte	0x8
+	.byte	0x80
+	.byte	0x77
+	.sleb128 288
+	.byte	0x94
+	.byte	0x4
+	.byte	0x1c
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL178-.Ltext0
+	.uleb128 .LVL179-.Ltext0
+	.uleb128 0x6
+	.byte	0x8
+	.byte	0x80
+	.byte	0x75
+	.sleb128 0
+	.byte	0x1c
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL179-.Ltext0
+	.uleb128 .LVL182-.Ltext0
+	.uleb128 0x6
+	.byte	0x8
+	.byte	0x80
+	.byte	0x7d
+	.sleb128 0
+	.byte	0x1c
+	.byte	0x9f
+	.byte	0
+.LVUS185:
+	.uleb128 .LVU713
+	.uleb128 .LVU715
+	.uleb128 .LVU715
+	.uleb128 .LVU728
+	.uleb128 .LVU752
+	.uleb128 .LVU770
+	.uleb128 .LVU770
+	.uleb128 .LVU789
+	.uleb128 .LVU789
+	.uleb128 .LVU797
+.LLST185:
+	.byte	0x4
+	.uleb128 .LVL155-.Ltext0
+	.uleb128 .LVL156-.Ltext0
+	.uleb128 0x2
+	.byte	0x30
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL156-.Ltext0
+	.uleb128 .LVL160-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0x4
+	.uleb128 .LVL170-.Ltext0
+	.uleb128 .LVL175-.Ltext0
+	.uleb128 0x2
+	.byte	0x30
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL175-.Ltext0
+	.uleb128 .LVL178-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0x4
+	.uleb128 .LVL178-.Ltext0
+	.uleb128 .LVL182-.Ltext0
+	.uleb128 0x2
+	.byte	0x30
+	.byte	0x9f
+	.byte	0
+.LVUS187:
+	.uleb128 .LVU719
+	.uleb128 .LVU723
+	.uleb128 .LVU723
+	.uleb128 .LVU724
+	.uleb128 .LVU724
+	.uleb128 .LVU732
+.LLST187:
+	.byte	0x4
+	.uleb128 .LVL157-.Ltext0
+	.uleb128 .LVL158-.Ltext0
+	.uleb128 0x5
+	.byte	0x70
+	.sleb128 0
+	.byte	0x37
+	.byte	0x25
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL158-.Ltext0
+	.uleb128 .LVL159-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x51
+	.byte	0x4
+	.uleb128 .LVL159-1-.Ltext0
+	.uleb128 .LVL162-.Ltext0
+	.uleb128 0x6
+	.byte	0x77
+	.sleb128 48
+	.byte	0x6
+	.byte	0x37
+	.byte	0x25
+	.byte	0x9f
+	.byte	0
+.LVUS189:
+	.uleb128 .LVU720
+	.uleb128 .LVU723
+	.uleb128 .LVU723
+	.uleb128 .LVU724
+	.uleb128 .LVU724
+	.uleb128 .LVU724
+.LLST189:
+	.byte	0x4
+	.uleb128 .LVL157-.Ltext0
+	.uleb128 .LVL158-.Ltext0
+	.uleb128 0x5
+	.byte	0x70
+	.sleb128 0
+	.byte	0x37
+	.byte	0x25
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL158-.Ltext0
+	.uleb128 .LVL159-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x51
+	.byte	0x4
+	.uleb128 .LVL159-1-.Ltext0
+	.uleb128 .LVL159-.Ltext0
+	.uleb128 0x6
+	.byte	0x77
+	.sleb128 48
+	.byte	0x6
+	.byte	0x37
+	.byte	0x25
+	.byte	0x9f
+	.byte	0
+.LVUS190:
+	.uleb128 .LVU720
+	.uleb128 .LVU724
+.LLST190:
+	.byte	0x4
+	.uleb128 .LVL157-.Ltext0
+	.uleb128 .LVL159-.Ltext0
+	.uleb128 0x9
+	.byte	0x77
+	.sleb128 0
+	.byte	0x73
+	.sleb128 0
+	.byte	0x22
+	.byte	0x23
+	.uleb128 0x140
+	.byte	0x9f
+	.byte	0
+.LVUS191:
+	.uleb128 .LVU720
+	.uleb128 .LVU724
+.LLST191:
+	.byte	0x4
+	.uleb128 .LVL157-.Ltext0
+	.uleb128 .LVL159-.Ltext0
+	.uleb128 0x4
+	.byte	0x77
+	.sleb128 64
+	.byte	0x9f
+	.byte	0
+.LVUS192:
+	.uleb128 .LVU733
+	.uleb128 .LVU737
+.LLST192:
+	.byte	0x4
+	.uleb128 .LVL162-.Ltext0
+	.uleb128 .LVL164-.Ltext0
+	.uleb128 0x2
+	.byte	0x30
+	.byte	0x9f
+	.byte	0
+.LVUS193:
+	.uleb128 .LVU733
+	.uleb128 .LVU737
+.LLST193:
+	.byte	0x4
+	.uleb128 .LVL162-.Ltext0
+	.uleb128 .LVL164-.Ltext0
+	.uleb128 0x1
+	.byte	0x5f
+	.byte	0
+.LVUS194:
+	.uleb128 .LVU733
+	.uleb128 .LVU737
+.LLST194:
+	.byte	0x4
+	.uleb128 .LVL162-.Ltext0
+	.uleb128 .LVL164-.Ltext0
+	.uleb128 0x4
+	.byte	0x77
+	.sleb128 64
+	.byte	0x9f
+	.byte	0
+.LVUS196:
+	.uleb128 .LVU759
+	.uleb128 .LVU761
+	.uleb128 .LVU761
+	.uleb128 .LVU764
+.LLST196:
+	.byte	0x4
+	.uleb128 .LVL171-.Ltext0
+	.uleb128 .LVL172-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL172-.Ltext0
+	.uleb128 .LVL174-1-.Ltext0
+	.uleb128 0xc
+	.byte	0x77
+	.sleb128 288
+	.byte	0x94
+	.byte	0x4
+	.byte	0xc
+	.long	0xffffffff
+	.byte	0x1a
+	.byte	0x9f
+	.byte	0
+.LVUS197:
+	.uleb128 .LVU759
+	.uleb128 .LVU768
+.LLST197:
+	.byte	0x4
+	.uleb128 .LVL171-.Ltext0
+	.uleb128 .LVL175-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0
+.LVUS198:
+	.uleb128 .LVU759
+	.uleb128 .LVU768
+.LLST198:
+	.byte	0x4
+	.uleb128 .LVL171-.Ltext0
+	.uleb128 .LVL175-.Ltext0
+	.uleb128 0x4
+	.byte	0x77
+	.sleb128 320
+	.byte	0x9f
+	.byte	0
+.LVUS199:
+	.uleb128 .LVU759
+	.uleb128 .LVU768
+.LLST199:
+	.byte	0x4
+	.uleb128 .LVL171-.Ltext0
+	.uleb128 .LVL175-.Ltext0
+	.uleb128 0x4
+	.byte	0x77
+	.sleb128 64
+	.byte	0x9f
+	.byte	0
+.LVUS201:
+	.uleb128 .LVU772
+	.uleb128 .LVU781
+.LLST201:
+	.byte	0x4
+	.uleb128 .LVL175-.Ltext0
+	.uleb128 .LVL176-.Ltext0
+	.uleb128 0x3
+	.byte	0x8
+	.byte	0x80
+	.byte	0x9f
+	.byte	0
+.LVUS202:
+	.uleb128 .LVU772
+	.uleb128 .LVU781
+.LLST202:
+	.byte	0x4
+	.uleb128 .LVL175-.Ltext0
+	.uleb128 .LVL176-.Ltext0
+	.uleb128 0x4
+	.byte	0x77
+	.sleb128 64
+	.byte	0x9f
+	.byte	0
+.LVUS204:
+	.uleb128 .LVU783
+	.uleb128 .LVU785
+	.uleb128 .LVU785
+	.uleb128 .LVU785
+.LLST204:
+	.byte	0x4
+	.uleb128 .LVL176-.Ltext0
+	.uleb128 .LVL177-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x4
+	.uleb128 .LVL177-1-.Ltext0
+	.uleb128 .LVL177-.Ltext0
+	.uleb128 0x1
+	.byte	0x5d
+	.byte	0
+.LVUS205:
+	.uleb128 .LVU783
+	.uleb128 .LVU785
+.LLST205:
+	.byte	0x4
+	.uleb128 .LVL176-.Ltext0
+	.uleb128 .LVL177-.Ltext0
+	.uleb128 0x4
+	.byte	0x77
+	.sleb128 64
+	.byte	0x9f
+	.byte	0
+.LVUS206:
+	.uleb128 .LVU790
+	.uleb128 .LVU792
+	.uleb128 .LVU792
+	.uleb128 .LVU795
+.LLST206:
+	.byte	0x4
+	.uleb128 .LVL178-.Ltext0
+	.uleb128 .LVL179-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL179-.Ltext0
+	.uleb128 .LVL181-.Ltext0
+	.uleb128 0x1
+	.byte	0x5d
+	.byte	0
+.LVUS207:
+	.uleb128 .LVU790
+	.uleb128 .LVU795
+.LLST207:
+	.byte	0x4
+	.uleb128 .LVL178-.Ltext0
+	.uleb128 .LVL181-.Ltext0
+	.uleb128 0x1
+	.byte	0x5f
+	.byte	0
+.LVUS208:
+	.uleb128 .LVU790
+	.uleb128 .LVU795
+.LLST208:
+	.byte	0x4
+	.uleb128 .LVL178-.Ltext0
+	.uleb128 .LVL181-.Ltext0
+	.uleb128 0x4
+	.byte	0x77
+	.sleb128 320
+	.byte	0x9f
+	.byte	0
+.LVUS209:
+	.uleb128 .LVU790
+	.uleb128 .LVU795
+.LLST209:
+	.byte	0x4
+	.uleb128 .LVL178-.Ltext0
+	.uleb128 .LVL181-.Ltext0
+	.uleb128 0x4
+	.byte	0x77
+	.sleb128 64
+	.byte	0x9f
+	.byte	0
+.LVUS171:
+	.uleb128 .LVU695
+	.uleb128 .LVU700
+	.uleb128 .LVU700
+	.uleb128 .LVU713
+.LLST171:
+	.byte	0x4
+	.uleb128 .LVL150-.Ltext0
+	.uleb128 .LVL151-.Ltext0
+	.uleb128 0x4
+	.byte	0x77
+	.sleb128 64
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL151-.Ltext0
+	.uleb128 .LVL155-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0
+.LVUS173:
+	.uleb128 .LVU706
+	.uleb128 .LVU711
+.LLST173:
+	.byte	0x4
+	.uleb128 .LVL153-.Ltext0
+	.uleb128 .LVL154-.Ltext0
+	.uleb128 0x2
+	.byte	0x30
+	.byte	0x9f
+	.byte	0
+.LVUS176:
+	.uleb128 .LVU706
+	.uleb128 .LVU710
+	.uleb128 .LVU710
+	.uleb128 .LVU711
+.LLST176:
+	.byte	0x4
+	.uleb128 .LVL153-.Ltext0
+	.uleb128 .LVL154-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x4
+	.uleb128 .LVL154-1-.Ltext0
+	.uleb128 .LVL154-.Ltext0
+	.uleb128 0x1
+	.byte	0x5c
+	.byte	0
+.LVUS177:
+	.uleb128 .LVU706
+	.uleb128 .LVU711
+.LLST177:
+	.byte	0x4
+	.uleb128 .LVL153-.Ltext0
+	.uleb128 .LVL154-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0
+.LVUS126:
+	.uleb128 0
+	.uleb128 .LVU595
+	.uleb128 .LVU595
+	.uleb128 .LVU626
+	.uleb128 .LVU626
+	.uleb128 .LVU628
+	.uleb128 .LVU628
+	.uleb128 .LVU629
+	.uleb128 .LVU629
+	.uleb128 .LVU630
+	.uleb128 .LVU630
+	.uleb128 0
+.LLST126:
+	.byte	0x4
+	.uleb128 .LVL113-.Ltext0
+	.uleb128 .LVL118-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL118-.Ltext0
+	.uleb128 .LVL127-.Ltext0
+	.uleb128 0x2
+	.byte	0x77
+	.sleb128 24
+	.byte	0x4
+	.uleb128 .LVL127-.Ltext0
+	.uleb128 .LVL129-.Ltext0
+	.uleb128 0x2
+	.byte	0x7d
+	.sleb128 -40
+	.byte	0x4
+	.uleb128 .LVL129-.Ltext0
+	.uleb128 .LVL130-.Ltext0
+	.uleb128 0x9
+	.byte	0x76
+	.sleb128 -40
+	.byte	0x9
+	.byte	0xe0
+	.byte	0x1a
+	.byte	0xa
+	.value	0x128
+	.byte	0x1c
+	.byte	0x4
+	.uleb128 .LVL130-.Ltext0
+	.uleb128 .LVL131-.Ltext0
+	.uleb128 0x9
+	.byte	0x77
+	.sleb128 -48
+	.byte	0x9
+	.byte	0xe0
+	.byte	0x1a
+	.byte	0xa
+	.value	0x128
+	.byte	0x1c
+	.byte	0x4
+	.uleb128 .LVL131-.Ltext0
+	.uleb128 .LFE41-.Ltext0
+	.uleb128 0x2
+	.byte	0x77
+	.sleb128 24
+	.byte	0
+.LVUS127:
+	.uleb128 0
+	.uleb128 .LVU594
+	.uleb128 .LVU594
+	.uleb128 .LVU627
+	.uleb128 .LVU627
+	.uleb128 .LVU630
+	.uleb128 .LVU630
+	.uleb128 0
+.LLST127:
+	.byte	0x4
+	.uleb128 .LVL113-.Ltext0
+	.uleb128 .LVL117-.Ltext0
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x4
+	.uleb128 .LVL117-.Ltext0
+	.uleb128 .LVL128-.Ltext0
+	.uleb128 0x1
+	.byte	0x5c
+	.byte	0x4
+	.uleb128 .LVL128-.Ltext0
+	.uleb128 .LVL131-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL131-.Ltext0
+	.uleb128 .LFE41-.Ltext0
+	.uleb128 0x1
+	.byte	0x5c
+	.byte	0
+.LVUS128:
+	.uleb128 0
+	.uleb128 .LVU586
+	.uleb128 .LVU586
+	.uleb128 .LVU614
+	.uleb128 .LVU614
+	.uleb128 .LVU645
+	.uleb128 .LVU645
+	.uleb128 .LVU652
+	.uleb128 .LVU652
+	.uleb128 .LVU677
+	.uleb128 .LVU677
+	.uleb128 .LVU682
+	.uleb128 .LVU682
+	.uleb128 .LVU683
+	.uleb128 .LVU683
+	.uleb128 0
+.LLST128:
+	.byte	0x4
+	.uleb128 .LVL113-.Ltext0
+	.uleb128 .LVL114-.Ltext0
+	.uleb128 0x1
+	.byte	0x51
+	.byte	0x4
+	.uleb128 .LVL114-.Ltext0
+	.uleb128 .LVL122-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0x4
+	.uleb128 .LVL122-.Ltext0
+	.uleb128 .LVL137-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x51
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL137-.Ltext0
+	.uleb128 .LVL140-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0x4
+	.uleb128 .LVL140-.Ltext0
+	.uleb128 .LVL145-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x51
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL145-.Ltext0
+	.uleb128 .LVL147-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0x4
+	.uleb128 .LVL147-.Ltext0
+	.uleb128 .LVL148-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x51
+	.byte	0x4
+	.uleb128 .LVL148-1-.Ltext0
+	.uleb128 .LFE41-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x51
+	.byte	0x9f
+	.byte	0
+.LVUS130:
+	.uleb128 .LVU588
+	.uleb128 .LVU591
+	.uleb128 .LVU591
+	.uleb128 .LVU601
+.LLST130:
+	.byte	0x4
+	.uleb128 .LVL115-.Ltext0
+	.uleb128 .LVL116-.Ltext0
+	.uleb128 0x4
+	.byte	0x77
+	.sleb128 64
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL116-.Ltext0
+	.uleb128 .LVL120-.Ltext0
+	.uleb128 0x1
+	.byte	0x5d
+	.byte	0
+.LVUS132:
+	.uleb128 .LVU598
+	.uleb128 .LVU601
+.LLST132:
+	.byte	0x4
+	.uleb128 .LVL119-.Ltext0
+	.uleb128 .LVL120-.Ltext0
+	.uleb128 0x2
+	.byte	0x30
+	.byte	0x9f
+	.byte	0
+.LVUS135:
+	.uleb128 .LVU598
+	.uleb128 .LVU600
+	.uleb128 .LVU600
+	.uleb128 .LVU601
+.LLST135:
+	.byte	0x4
+	.uleb128 .LVL119-.Ltext0
+	.uleb128 .LVL120-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x4
+	.uleb128 .LVL120-1-.Ltext0
+	.uleb128 .LVL120-.Ltext0
+	.uleb128 0x3
+	.byte	0x77
+	.sleb128 32
+	.byte	0x9f
+	.byte	0
+.LVUS136:
+	.uleb128 .LVU598
+	.uleb128 .LVU601
+.LLST136:
+	.byte	0x4
+	.uleb128 .LVL119-.Ltext0
+	.uleb128 .LVL120-.Ltext0
+	.uleb128 0x1
+	.byte	0x5d
+	.byte	0
+.LVUS138:
+	.uleb128 .LVU603
+	.uleb128 .LVU620
+	.uleb128 .LVU630
+	.uleb128 .LVU652
+	.uleb128 .LVU652
+	.uleb128 .LVU660
+	.uleb128 .LVU660
+	.uleb128 .LVU682
+	.uleb128 .LVU682
+	.uleb128 .LVU683
+	.uleb128 .LVU683
+	.uleb128 0
+.LLST138:
+	.byte	0x4
+	.uleb128 .LVL120-.Ltext0
+	.uleb128 .LVL124-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0x4
+	.uleb128 .LVL131-.Ltext0
+	.uleb128 .LVL140-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0x4
+	.uleb128 .LVL140-.Ltext0
+	.uleb128 .LVL142-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x51
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL142-.Ltext0
+	.uleb128 .LVL147-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0x4
+	.uleb128 .LVL147-.Ltext0
+	.uleb128 .LVL148-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x51
+	.byte	0x4
+	.uleb128 .LVL148-1-.Ltext0
+	.uleb128 .LFE41-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x51
+	.byte	0x9f
+	.byte	0
+.LVUS139:
+	.uleb128 .LVU603
+	.uleb128 .LVU623
+	.uleb128 .LVU630
+	.uleb128 0
+.LLST139:
+	.byte	0x4
+	.uleb128 .LVL120-.Ltext0
+	.uleb128 .LVL125-.Ltext0
+	.uleb128 0x1
+	.byte	0x5c
+	.byte	0x4
+	.uleb128 .LVL131-.Ltext0
+	.uleb128 .LFE41-.Ltext0
+	.uleb128 0x1
+	.byte	0x5c
+	.byte	0
+.LVUS140:
+	.uleb128 .LVU603
+	.uleb128 .LVU623
+	.uleb128 .LVU630
+	.uleb128 0
+.LLST140:
+	.byte	0x4
+	.uleb128 .LVL120-.Ltext0
+	.uleb128 .LVL125-.Ltext0
+	.uleb128 0x1
+	.byte	0x5d
+	.byte	0x4
+	.uleb128 .LVL131-.Ltext0
+	.uleb128 .LFE41-.Ltext0
+	.uleb128 0x1
+	.byte	0x5d
+	.byte	0
+.LVUS141:
+	.uleb128 .LVU608
+	.uleb128 .LVU614
+	.uleb128 .LVU645
+	.uleb128 .LVU650
+	.uleb128 .LVU650
+	.uleb128 .LVU653
+	.uleb128 .LVU677
+	.uleb128 .LVU680
+	.uleb128 .LVU680
+	.uleb128 0
+.LLST141:
+	.byte	0x4
+	.uleb128 .LVL121-.Ltext0
+	.uleb128 .LVL122-.Ltext0
+	.uleb128 0x6
+	.byte	0x8
+	.byte	0x80
+	.byte	0x75
+	.sleb128 0
+	.byte	0x1c
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL137-.Ltext0
+	.uleb128 .LVL139-.Ltext0
+	.uleb128 0x6
+	.byte	0x8
+	.byte	0x80
+	.byte	0x75
+	.sleb128 0
+	.byte	0x1c
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL139-.Ltext0
+	.uleb128 .LVL141-1-.Ltext0
+	.uleb128 0x9
+	.byte	0x8
+	.byte	0x80
+	.byte	0x77
+	.sleb128 288
+	.byte	0x94
+	.byte	0x4
+	.byte	0x1c
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL145-.Ltext0
+	.uleb128 .LVL146-.Ltext0
+	.uleb128 0x6
+	.byte	0x8
+	.byte	0x80
+	.byte	0x75
+	.sleb128 0
+	.byte	0x1c
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL146-.Ltext0
+	.uleb128 .LFE41-.Ltext0
+	.uleb128 0x6
+	.byte	0x8
+	.byte	0x80
+	.byte	0x7f
+	.sleb128 0
+	.byte	0x1c
+	.byte	0x9f
+	.byte	0
+.LVUS142:
+	.uleb128 .LVU609
+	.uleb128 .LVU614
+	.uleb128 .LVU614
+	.uleb128 .LVU616
+	.uleb128 .LVU630
+	.uleb128 .LVU641
+	.uleb128 .LVU645
+	.uleb128 .LVU659
+	.uleb128 .LVU659
+	.uleb128 .LVU677
+	.uleb128 .LVU677
+	.uleb128 0
+.LLST142:
+	.byte	0x4
+	.uleb128 .LVL121-.Ltext0
+	.uleb128 .LVL122-.Ltext0
+	.uleb128 0x2
+	.byte	0x30
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL122-.Ltext0
+	.uleb128 .LVL123-.Ltext0
+	.uleb128 0x1
+	.byte	0x5e
+	.byte	0x4
+	.uleb128 .LVL131-.Ltext0
+	.uleb128 .LVL135-.Ltext0
+	.uleb128 0x1
+	.byte	0x5e
+	.byte	0x4
+	.uleb128 .LVL137-.Ltext0
+	.uleb128 .LVL142-.Ltext0
+	.uleb128 0x2
+	.byte	0x30
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL142-.Ltext0
+	.uleb128 .LVL145-.Ltext0
+	.uleb128 0x1
+	.byte	0x5e
+	.byte	0x4
+	.uleb128 .LVL145-.Ltext0
+	.uleb128 .LFE41-.Ltext0
+	.uleb128 0x2
+	.byte	0x30
+	.byte	0x9f
+	.byte	0
+.LVUS143:
+	.uleb128 .LVU617
+	.uleb128 .LVU620
+.LLST143:
+	.byte	0x4
+	.uleb128 .LVL123-.Ltext0
+	.uleb128 .LVL124-.Ltext0
+	.uleb128 0x2
+	.byte	0x30
+	.byte	0x9f
+	.byte	0
+.LVUS144:
+	.uleb128 .LVU617
+	.uleb128 .LVU620
+.LLST144:
+	.byte	0x4
+	.uleb128 .LVL123-.Ltext0
+	.uleb128 .LVL124-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0
+.LVUS145:
+	.uleb128 .LVU617
+	.uleb128 .LVU620
+.LLST145:
+	.byte	0x4
+	.uleb128 .LVL123-.Ltext0
+	.uleb128 .LVL124-.Ltext0
+	.uleb128 0x4
+	.byte	0x77
+	.sleb128 64
+	.byte	0x9f
+	.byte	0
+.LVUS147:
+	.uleb128 .LVU678
+	.uleb128 .LVU680
+	.uleb128 .LVU680
+	.uleb128 .LVU684
+.LLST147:
+	.byte	0x4
+	.uleb128 .LVL145-.Ltext0
+	.uleb128 .LVL146-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL146-.Ltext0
+	.uleb128 .LVL148-.Ltext0
+	.uleb128 0x1
+	.byte	0x5f
+	.byte	0
+.LVUS148:
+	.uleb128 .LVU678
+	.uleb128 .LVU682
+	.uleb128 .LVU682
+	.uleb128 .LVU683
+	.uleb128 .LVU683
+	.uleb128 .LVU684
+.LLST148:
+	.byte	0x4
+	.uleb128 .LVL145-.Ltext0
+	.uleb128 .LVL147-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0x4
+	.uleb128 .LVL147-.Ltext0
+	.uleb128 .LVL148-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x51
+	.byte	0x4
+	.uleb128 .LVL148-1-.Ltext0
+	.uleb128 .LVL148-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x51
+	.byte	0x9f
+	.byte	0
+.LVUS149:
+	.uleb128 .LVU678
+	.uleb128 .LVU684
+.LLST149:
+	.byte	0x4
+	.uleb128 .LVL145-.Ltext0
+	.uleb128 .LVL148-.Ltext0
+	.uleb128 0x1
+	.byte	0x5c
+	.byte	0
+.LVUS150:
+	.uleb128 .LVU678
+	.uleb128 .LVU684
+.LLST150:
+	.byte	0x4
+	.uleb128 .LVL145-.Ltext0
+	.uleb128 .LVL148-.Ltext0
+	.uleb128 0x4
+	.byte	0x77
+	.sleb128 64
+	.byte	0x9f
+	.byte	0
+.LVUS152:
+	.uleb128 .LVU632
+	.uleb128 .LVU636
+	.uleb128 .LVU636
+	.uleb128 .LVU637
+	.uleb128 .LVU637
+	.uleb128 .LVU645
+.LLST152:
+	.byte	0x4
+	.uleb128 .LVL132-.Ltext0
+	.uleb128 .LVL133-.Ltext0
+	.uleb128 0x5
+	.byte	0x70
+	.sleb128 0
+	.byte	0x37
+	.byte	0x25
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL133-.Ltext0
+	.uleb128 .LVL134-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x51
+	.byte	0x4
+	.uleb128 .LVL134-1-.Ltext0
+	.uleb128 .LVL137-.Ltext0
+	.uleb128 0x6
+	.byte	0x77
+	.sleb128 16
+	.byte	0x6
+	.byte	0x37
+	.byte	0x25
+	.byte	0x9f
+	.byte	0
+.LVUS154:
+	.uleb128 .LVU633
+	.uleb128 .LVU636
+	.uleb128 .LVU636
+	.uleb128 .LVU637
+	.uleb128 .LVU637
+	.uleb128 .LVU637
+.LLST154:
+	.byte	0x4
+	.uleb128 .LVL132-.Ltext0
+	.uleb128 .LVL133-.Ltext0
+	.uleb128 0x5
+	.byte	0x70
+	.sleb128 0
+	.byte	0x37
+	.byte	0x25
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL133-.Ltext0
+	.uleb128 .LVL134-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x51
+	.byte	0x4
+	.uleb128 .LVL134-1-.Ltext0
+	.uleb128 .LVL134-.Ltext0
+	.uleb128 0x6
+	.byte	0x77
+	.sleb128 16
+	.byte	0x6
+	.byte	0x37
+	.byte	0x25
+	.byte	0x9f
+	.byte	0
+.LVUS155:
+	.uleb128 .LVU633
+	.uleb128 .LVU637
+.LLST155:
+	.byte	0x4
+	.uleb128 .LVL132-.Ltext0
+	.uleb128 .LVL134-.Ltext0
+	.uleb128 0x6
+	.byte	0x7c
+	.sleb128 0
+	.byte	0x7e
+	.sleb128 0
+	.byte	0x22
+	.byte	0x9f
+	.byte	0
+.LVUS156:
+	.uleb128 .LVU633
+	.uleb128 .LVU637
+.LLST156:
+	.byte	0x4
+	.uleb128 .LVL132-.Ltext0
+	.uleb128 .LVL134-.Ltext0
+	.uleb128 0x4
+	.byte	0x77
+	.sleb128 64
+	.byte	0x9f
+	.byte	0
+.LVUS158:
+	.uleb128 .LVU648
+	.uleb128 .LVU650
+	.uleb128 .LVU650
+	.uleb128 .LVU653
+.LLST158:
+	.byte	0x4
+	.uleb128 .LVL138-.Ltext0
+	.uleb128 .LVL139-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL139-.Ltext0
+	.uleb128 .LVL141-1-.Ltext0
+	.uleb128 0xc
+	.byte	0x77
+	.sleb128 288
+	.byte	0x94
+	.byte	0x4
+	.byte	0xc
+	.long	0xffffffff
+	.byte	0x1a
+	.byte	0x9f
+	.byte	0
+.LVUS159:
+	.uleb128 .LVU648
+	.uleb128 .LVU657
+.LLST159:
+	.byte	0x4
+	.uleb128 .LVL138-.Ltext0
+	.uleb128 .LVL142-.Ltext0
+	.uleb128 0x1
+	.byte	0x5e
+	.byte	0
+.LVUS160:
+	.uleb128 .LVU648
+	.uleb128 .LVU653
+	.uleb128 .LVU653
+	.uleb128 .LVU657
+.LLST160:
+	.byte	0x4
+	.uleb128 .LVL138-.Ltext0
+	.uleb128 .LVL141-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x4
+	.uleb128 .LVL141-1-.Ltext0
+	.uleb128 .LVL142-.Ltext0
+	.uleb128 0x1
+	.byte	0x5c
+	.byte	0
+.LVUS161:
+	.uleb128 .LVU648
+	.uleb128 .LVU657
+.LLST161:
+	.byte	0x4
+	.uleb128 .LVL138-.Ltext0
+	.uleb128 .LVL142-.Ltext0
+	.uleb128 0x4
+	.byte	0x77
+	.sleb128 64
+	.byte	0x9f
+	.byte	0
+.LVUS163:
+	.uleb128 .LVU661
+	.uleb128 .LVU669
+.LLST163:
+	.byte	0x4
+	.uleb128 .LVL142-.Ltext0
+	.uleb128 .LVL143-.Ltext0
+	.uleb128 0x3
+	.byte	0x8
+	.byte	0x80
+	.byte	0x9f
+	.byte	0
+.LVUS164:
+	.uleb128 .LVU661
+	.uleb128 .LVU669
+.LLST164:
+	.byte	0x4
+	.uleb128 .LVL142-.Ltext0
+	.uleb128 .LVL143-.Ltext0
+	.uleb128 0x4
+	.byte	0x77
+	.sleb128 64
+	.byte	0x9f
+	.byte	0
+.LVUS166:
+	.uleb128 .LVU671
+	.uleb128 .LVU673
+	.uleb128 .LVU673
+	.uleb128 .LVU673
+.LLST166:
+	.byte	0x4
+	.uleb128 .LVL143-.Ltext0
+	.uleb128 .LVL144-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x4
+	.uleb128 .LVL144-1-.Ltext0
+	.uleb128 .LVL144-.Ltext0
+	.uleb128 0x1
+	.byte	0x5f
+	.byte	0
+.LVUS167:
+	.uleb128 .LVU671
+	.uleb128 .LVU673
+.LLST167:
+	.byte	0x4
+	.uleb128 .LVL143-.Ltext0
+	.uleb128 .LVL144-.Ltext0
+	.uleb128 0x4
+	.byte	0x77
+	.sleb128 64
+	.byte	0x9f
+	.byte	0
+.LVUS108:
+	.uleb128 0
+	.uleb128 .LVU547
+	.uleb128 .LVU547
+	.uleb128 .LVU548
+	.uleb128 .LVU548
+	.uleb128 .LVU567
+	.uleb128 .LVU567
+	.uleb128 .LVU570
+	.uleb128 .LVU570
+	.uleb128 0
+.LLST108:
+	.byte	0x4
+	.uleb128 .LVL94-.Ltext0
+	.uleb128 .LVL97-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL97-.Ltext0
+	.uleb128 .LVL98-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL98-.Ltext0
+	.uleb128 .LVL105-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL105-1-.Ltext0
+	.uleb128 .LVL106-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL106-.Ltext0
+	.uleb128 .LFE40-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0
+.LVUS109:
+	.uleb128 0
+	.uleb128 .LVU547
+	.uleb128 .LVU547
+	.uleb128 .LVU548
+	.uleb128 .LVU548
+	.uleb128 .LVU554
+	.uleb128 .LVU554
+	.uleb128 .LVU555
+	.uleb128 .LVU555
+	.uleb128 .LVU570
+	.uleb128 .LVU570
+	.uleb128 .LVU572
+	.uleb128 .LVU572
+	.uleb128 0
+.LLST109:
+	.byte	0x4
+	.uleb128 .LVL94-.Ltext0
+	.uleb128 .LVL97-.Ltext0
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x4
+	.uleb128 .LVL97-.Ltext0
+	.uleb128 .LVL98-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL98-.Ltext0
+	.uleb128 .LVL102-.Ltext0
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x4
+	.uleb128 .LVL102-.Ltext0
+	.uleb128 .LVL103-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x51
+	.byte	0x4
+	.uleb128 .LVL103-1-.Ltext0
+	.uleb128 .LVL106-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL106-.Ltext0
+	.uleb128 .LVL107-.Ltext0
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x4
+	.uleb128 .LVL107-.Ltext0
+	.uleb128 .LFE40-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x9f
+	.byte	0
+.LVUS110:
+	.uleb128 0
+	.uleb128 .LVU538
+	.uleb128 .LVU538
+	.uleb128 .LVU547
+	.uleb128 .LVU547
+	.uleb128 .LVU548
+	.uleb128 .LVU548
+	.uleb128 .LVU567
+	.uleb128 .LVU567
+	.uleb128 .LVU570
+	.uleb128 .LVU570
+	.uleb128 .LVU576
+	.uleb128 .LVU576
+	.uleb128 .LVU577
+	.uleb128 .LVU577
+	.uleb128 0
+.LLST110:
+	.byte	0x4
+	.uleb128 .LVL94-.Ltext0
+	.uleb128 .LVL95-.Ltext0
+	.uleb128 0x1
+	.byte	0x51
+	.byte	0x4
+	.uleb128 .LVL95-.Ltext0
+	.uleb128 .LVL97-.Ltext0
+	.uleb128 0x1
+	.byte	0x5a
+	.byte	0x4
+	.uleb128 .LVL97-.Ltext0
+	.uleb128 .LVL98-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x51
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL98-.Ltext0
+	.uleb128 .LVL105-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x5a
+	.byte	0x4
+	.uleb128 .LVL105-1-.Ltext0
+	.uleb128 .LVL106-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x51
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL106-.Ltext0
+	.uleb128 .LVL111-.Ltext0
+	.uleb128 0x1
+	.byte	0x5a
+	.byte	0x4
+	.uleb128 .LVL111-.Ltext0
+	.uleb128 .LVL112-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL112-.Ltext0
+	.uleb128 .LFE40-.Ltext0
+	.uleb128 0x1
+	.byte	0x5a
+	.byte	0
+.LVUS111:
+	.uleb128 0
+	.uleb128 .LVU547
+	.uleb128 .LVU547
+	.uleb128 .LVU548
+	.uleb128 .LVU548
+	.uleb128 .LVU555
+	.uleb128 .LVU555
+	.uleb128 .LVU565
+	.uleb128 .LVU565
+	.uleb128 .LVU570
+	.uleb128 .LVU570
+	.uleb128 .LVU573
+	.uleb128 .LVU573
+	.uleb128 .LVU574
+	.uleb128 .LVU574
+	.uleb128 .LVU575
+	.uleb128 .LVU575
+	.uleb128 0
+.LLST111:
+	.byte	0x4
+	.uleb128 .LVL94-.Ltext0
+	.uleb128 .LVL97-.Ltext0
+	.uleb128 0x1
+	.byte	0x52
+	.byte	0x4
+	.uleb128 .LVL97-.Ltext0
+	.uleb128 .LVL98-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x52
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL98-.Ltext0
+	.uleb128 .LVL103-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x52
+	.byte	0x4
+	.uleb128 .LVL103-1-.Ltext0
+	.uleb128 .LVL104-.Ltext0
+	.uleb128 0x1
+	.byte	0x59
+	.byte	0x4
+	.uleb128 .LVL104-.Ltext0
+	.uleb128 .LVL106-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x52
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL106-.Ltext0
+	.uleb128 .LVL108-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x52
+	.byte	0x4
+	.uleb128 .LVL108-1-.Ltext0
+	.uleb128 .LVL109-.Ltext0
+	.uleb128 0x1
+	.byte	0x59
+	.byte	0x4
+	.uleb128 .LVL109-.Ltext0
+	.uleb128 .LVL110-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x52
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL110-.Ltext0
+	.uleb128 .LFE40-.Ltext0
+	.uleb128 0x1
+	.byte	0x59
+	.byte	0
+.LVUS112:
+	.uleb128 0
+	.uleb128 .LVU546
+	.uleb128 .LVU546
+	.uleb128 .LVU547
+	.uleb128 .LVU547
+	.uleb128 0
+.LLST112:
+	.byte	0x4
+	.uleb128 .LVL94-.Ltext0
+	.uleb128 .LVL96-.Ltext0
+	.uleb128 0x1
+	.byte	0x58
+	.byte	0x4
+	.uleb128 .LVL96-.Ltext0
+	.uleb128 .LVL97-.Ltext0
+	.uleb128 0x3
+	.byte	0x78
+	.sleb128 1
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL97-.Ltext0
+	.uleb128 .LFE40-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x58
+	.byte	0x9f
+	.byte	0
+.LVUS114:
+	.uleb128 .LVU550
+	.uleb128 .LVU552
+	.uleb128 .LVU552
+	.uleb128 .LVU555
+	.uleb128 .LVU555
+	.uleb128 .LVU565
+	.uleb128 .LVU565
+	.uleb128 .LVU570
+	.uleb128 .LVU570
+	.uleb128 .LVU573
+	.uleb128 .LVU573
+	.uleb128 .LVU574
+	.uleb128 .LVU574
+	.uleb128 .LVU575
+	.uleb128 .LVU575
+	.uleb128 0
+.LLST114:
+	.byte	0x4
+	.uleb128 .LVL99-.Ltext0
+	.uleb128 .LVL100-.Ltext0
+	.uleb128 0x1
+	.byte	0x59
+	.byte	0x4
+	.uleb128 .LVL100-.Ltext0
+	.uleb128 .LVL103-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x52
+	.byte	0x4
+	.uleb128 .LVL103-1-.Ltext0
+	.uleb128 .LVL104-.Ltext0
+	.uleb128 0x1
+	.byte	0x59
+	.byte	0x4
+	.uleb128 .LVL104-.Ltext0
+	.uleb128 .LVL106-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x52
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL106-.Ltext0
+	.uleb128 .LVL108-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x52
+	.byte	0x4
+	.uleb128 .LVL108-1-.Ltext0
+	.uleb128 .LVL109-.Ltext0
+	.uleb128 0x1
+	.byte	0x59
+	.byte	0x4
+	.uleb128 .LVL109-.Ltext0
+	.uleb128 .LVL110-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x52
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL110-.Ltext0
+	.uleb128 .LFE40-.Ltext0
+	.uleb128 0x1
+	.byte	0x59
+	.byte	0
+.LVUS115:
+	.uleb128 .LVU550
+	.uleb128 .LVU567
+	.uleb128 .LVU567
+	.uleb128 .LVU570
+	.uleb128 .LVU570
+	.uleb128 .LVU576
+	.uleb128 .LVU576
+	.uleb128 .LVU577
+	.uleb128 .LVU577
+	.uleb128 0
+.LLST115:
+	.byte	0x4
+	.uleb128 .LVL99-.Ltext0
+	.uleb128 .LVL105-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x5a
+	.byte	0x4
+	.uleb128 .LVL105-1-.Ltext0
+	.uleb128 .LVL106-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x51
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL106-.Ltext0
+	.uleb128 .LVL111-.Ltext0
+	.uleb128 0x1
+	.byte	0x5a
+	.byte	0x4
+	.uleb128 .LVL111-.Ltext0
+	.uleb128 .LVL112-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL112-.Ltext0
+	.uleb128 .LFE40-.Ltext0
+	.uleb128 0x1
+	.byte	0x5a
+	.byte	0
+.LVUS116:
+	.uleb128 .LVU550
+	.uleb128 .LVU554
+	.uleb128 .LVU554
+	.uleb128 .LVU555
+	.uleb128 .LVU555
+	.uleb128 .LVU570
+	.uleb128 .LVU570
+	.uleb128 .LVU572
+	.uleb128 .LVU572
+	.uleb128 0
+.LLST116:
+	.byte	0x4
+	.uleb128 .LVL99-.Ltext0
+	.uleb128 .LVL102-.Ltext0
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x4
+	.uleb128 .LVL102-.Ltext0
+	.uleb128 .LVL103-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x51
+	.byte	0x4
+	.uleb128 .LVL103-1-.Ltext0
+	.uleb128 .LVL106-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL106-.Ltext0
+	.uleb128 .LVL107-.Ltext0
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x4
+	.uleb128 .LVL107-.Ltext0
+	.uleb128 .LFE40-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x9f
+	.byte	0
+.LVUS117:
+	.uleb128 .LVU550
+	.uleb128 .LVU553
+	.uleb128 .LVU553
+	.uleb128 .LVU556
+	.uleb128 .LVU556
+	.uleb128 .LVU572
+	.uleb128 .LVU572
+	.uleb128 .LVU573
+	.uleb128 .LVU573
+	.uleb128 0
+.LLST117:
+	.byte	0x4
+	.uleb128 .LVL99-.Ltext0
+	.uleb128 .LVL101-.Ltext0
+	.uleb128 0x4
+	.byte	0x91
+	.sleb128 -176
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL101-.Ltext0
+	.uleb128 .LVL103-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL103-.Ltext0
+	.uleb128 .LVL107-.Ltext0
+	.uleb128 0x4
+	.byte	0x91
+	.sleb128 -176
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL107-.Ltext0
+	.uleb128 .LVL108-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x4
+	.uleb128 .LVL108-1-.Ltext0
+	.uleb128 .LFE40-.Ltext0
+	.uleb128 0x4
+	.byte	0x91
+	.sleb128 -176
+	.byte	0x9f
+	.byte	0
+.LVUS118:
+	.uleb128 .LVU550
+	.uleb128 .LVU567
+	.uleb128 .LVU567
+	.uleb128 .LVU570
+	.uleb128 .LVU570
+	.uleb128 0
+.LLST118:
+	.byte	0x4
+	.uleb128 .LVL99-.Ltext0
+	.uleb128 .LVL105-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL105-1-.Ltext0
+	.uleb128 .LVL106-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL106-.Ltext0
+	.uleb128 .LFE40-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0
+.LVUS120:
+	.uleb128 .LVU557
+	.uleb128 .LVU570
+	.uleb128 .LVU574
+	.uleb128 0
+.LLST120:
+	.byte	0x4
+	.uleb128 .LVL103-.Ltext0
+	.uleb128 .LVL106-.Ltext0
+	.uleb128 0x4
+	.byte	0x91
+	.sleb128 -176
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL109-.Ltext0
+	.uleb128 .LFE40-.Ltext0
+	.uleb128 0x4
+	.byte	0x91
+	.sleb128 -176
+	.byte	0x9f
+	.byte	0
+.LVUS121:
+	.uleb128 .LVU557
+	.uleb128 .LVU570
+	.uleb128 .LVU574
+	.uleb128 0
+.LLST121:
+	.byte	0x4
+	.uleb128 .LVL103-.Ltext0
+	.uleb128 .LVL106-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL109-.Ltext0
+	.uleb128 .LFE40-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x9f
+	.byte	0
+.LVUS122:
+	.uleb128 .LVU556
+	.uleb128 .LVU565
+	.uleb128 .LVU565
+	.uleb128 .LVU570
+	.uleb128 .LVU574
+	.uleb128 .LVU575
+	.uleb128 .LVU575
+	.uleb128 0
+.LLST122:
+	.byte	0x4
+	.uleb128 .LVL103-.Ltext0
+	.uleb128 .LVL104-.Ltext0
+	.uleb128 0x1
+	.byte	0x59
+	.byte	0x4
+	.uleb128 .LVL104-.Ltext0
+	.uleb128 .LVL106-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x52
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL109-.Ltext0
+	.uleb128 .LVL110-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x52
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL110-.Ltext0
+	.uleb128 .LFE40-.Ltext0
+	.uleb128 0x1
+	.byte	0x59
+	.byte	0
+.LVUS123:
+	.uleb128 .LVU556
+	.uleb128 .LVU567
+	.uleb128 .LVU567
+	.uleb128 .LVU570
+	.uleb128 .LVU574
+	.uleb128 .LVU576
+	.uleb128 .LVU576
+	.uleb128 .LVU577
+	.uleb128 .LVU577
+	.uleb128 0
+.LLST123:
+	.byte	0x4
+	.uleb128 .LVL103-.Ltext0
+	.uleb128 .LVL105-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x5a
+	.byte	0x4
+	.uleb128 .LVL105-1-.Ltext0
+	.uleb128 .LVL106-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x51
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL109-.Ltext0
+	.uleb128 .LVL111-.Ltext0
+	.uleb128 0x1
+	.byte	0x5a
+	.byte	0x4
+	.uleb128 .LVL111-.Ltext0
+	.uleb128 .LVL112-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL112-.Ltext0
+	.uleb128 .LFE40-.Ltext0
+	.uleb128 0x1
+	.byte	0x5a
+	.byte	0
+.LVUS124:
+	.uleb128 .LVU556
+	.uleb128 .LVU567
+	.uleb128 .LVU567
+	.uleb128 .LVU570
+	.uleb128 .LVU574
+	.uleb128 0
+.LLST124:
+	.byte	0x4
+	.uleb128 .LVL103-.Ltext0
+	.uleb128 .LVL105-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL105-1-.Ltext0
+	.uleb128 .LVL106-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL109-.Ltext0
+	.uleb128 .LFE40-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0
+.LVUS81:
+	.uleb128 0
+	.uleb128 .LVU406
+	.uleb128 .LVU406
+	.uleb128 .LVU474
+	.uleb128 .LVU474
+	.uleb128 .LVU475
+	.uleb128 .LVU475
+	.uleb128 .LVU477
+	.uleb128 .LVU477
+	.uleb128 0
+.LLST81:
+	.byte	0x4
+	.uleb128 .LVL77-.Ltext0
+	.uleb128 .LVL78-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL78-.Ltext0
+	.uleb128 .LVL88-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL88-.Ltext0
+	.uleb128 .LVL89-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL89-.Ltext0
+	.uleb128 .LVL90-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL90-.Ltext0
+	.uleb128 .LFE38-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x9f
+	.byte	0
+.LVUS82:
+	.uleb128 0
+	.uleb128 .LVU414
+	.uleb128 .LVU414
+	.uleb128 .LVU475
+	.uleb128 .LVU475
+	.uleb128 0
+.LLST82:
+	.byte	0x4
+	.uleb128 .LVL77-.Ltext0
+	.uleb128 .LVL80-.Ltext0
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x4
+	.uleb128 .LVL80-.Ltext0
+	.uleb128 .LVL89-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL89-.Ltext0
+	.uleb128 .LFE38-.Ltext0
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0
+.LVUS84:
+	.uleb128 .LVU410
+	.uleb128 .LVU475
+.LLST84:
+	.byte	0x4
+	.uleb128 .LVL79-.Ltext0
+	.uleb128 .LVL89-.Ltext0
+	.uleb128 0x2
+	.byte	0x30
+	.byte	0x9f
+	.byte	0
+.LVUS86:
+	.uleb128 .LVU410
+	.uleb128 .LVU414
+	.uleb128 .LVU414
+	.uleb128 .LVU475
+.LLST86:
+	.byte	0x4
+	.uleb128 .LVL79-.Ltext0
+	.uleb128 .LVL80-.Ltext0
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x4
+	.uleb128 .LVL80-.Ltext0
+	.uleb128 .LVL89-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x9f
+	.byte	0
+.LVUS87:
+	.uleb128 .LVU410
+	.uleb128 .LVU475
+.LLST87:
+	.byte	0x4
+	.uleb128 .LVL79-.Ltext0
+	.uleb128 .LVL89-.Ltext0
+	.uleb128 0x6
+	.byte	0xa0
+	.long	.Ldebug_info0+4385
+	.sleb128 0
+	.byte	0
+.LVUS88:
+	.uleb128 .LVU410
+	.uleb128 .LVU474
+	.uleb128 .LVU474
+	.uleb128 .LVU475
+.LLST88:
+	.byte	0x4
+	.uleb128 .LVL79-.Ltext0
+	.uleb128 .LVL88-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL88-.Ltext0
+	.uleb128 .LVL89-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x9f
+	.byte	0
+.LVUS90:
+	.uleb128 .LVU414
+	.uleb128 .LVU448
+	.uleb128 .LVU448
+	.uleb128 .LVU475
+.LLST90:
+	.byte	0x4
+	.uleb128 .LVL80-.Ltext0
+	.uleb128 .LVL84-.Ltext0
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x4
+	.uleb128 .LVL84-.Ltext0
+	.uleb128 .LVL89-.Ltext0
+	.uleb128 0x17
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x3
+	.quad	blake2b_salt_def
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x30
+	.byte	0x2e
+	.byte	0x28
+	.value	0x1
+	.byte	0x16
+	.byte	0x13
+	.byte	0x9f
+	.byte	0
+.LVUS91:
+	.uleb128 .LVU414
+	.uleb128 .LVU475
+.LLST91:
+	.byte	0x4
+	.uleb128 .LVL80-.Ltext0
+	.uleb128 .LVL89-.Ltext0
+	.uleb128 0x6
+	.byte	0xa0
+	.long	.Ldebug_info0+4385
+	.sleb128 0
+	.byte	0
+.LVUS92:
+	.uleb128 .LVU414
+	.uleb128 .LVU474
+	.uleb128 .LVU474
+	.uleb128 .LVU475
+.LLST92:
+	.byte	0x4
+	.uleb128 .LVL80-.Ltext0
+	.uleb128 .LVL88-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL88-.Ltext0
+	.uleb128 .LVL89-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x9f
+	.byte	0
+.LVUS93:
+	.uleb128 .LVU415
+	.uleb128 .LVU421
+	.uleb128 .LVU421
+	.uleb128 .LVU424
+	.uleb128 .LVU424
+	.uleb128 .LVU427
+	.uleb128 .LVU427
+	.uleb128 .LVU432
+	.uleb128 .LVU432
+	.uleb128 .LVU441
+	.uleb128 .LVU441
+	.uleb128 .LVU452
+	.uleb128 .LVU452
+	.uleb128 .LVU457
+	.uleb128 .LVU457
+	.uleb128 .LVU461
+	.uleb128 .LVU461
+	.uleb128 .LVU475
+.LLST93:
+	.byte	0x4
+	.uleb128 .LVL80-.Ltext0
+	.uleb128 .LVL81-.Ltext0
+	.uleb128 0x2
+	.byte	0x30
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL81-.Ltext0
+	.uleb128 .LVL81-.Ltext0
+	.uleb128 0x2
+	.byte	0x31
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL81-.Ltext0
+	.uleb128 .LVL81-.Ltext0
+	.uleb128 0x2
+	.byte	0x32
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL81-.Ltext0
+	.uleb128 .LVL82-.Ltext0
+	.uleb128 0x2
+	.byte	0x33
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL82-.Ltext0
+	.uleb128 .LVL83-.Ltext0
+	.uleb128 0x2
+	.byte	0x34
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL83-.Ltext0
+	.uleb128 .LVL86-.Ltext0
+	.uleb128 0x2
+	.byte	0x35
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL86-.Ltext0
+	.uleb128 .LVL86-.Ltext0
+	.uleb128 0x2
+	.byte	0x36
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL86-.Ltext0
+	.uleb128 .LVL87-.Ltext0
+	.uleb128 0x2
+	.byte	0x37
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL87-.Ltext0
+	.uleb128 .LVL89-.Ltext0
+	.uleb128 0x2
+	.byte	0x38
+	.byte	0x9f
+	.byte	0
+.LVUS95:
+	.uleb128 .LVU433
+	.uleb128 .LVU441
+	.uleb128 .LVU441
+	.uleb128 .LVU452
+	.uleb128 .LVU452
+	.uleb128 .LVU475
+.LLST95:
+	.byte	0x4
+	.uleb128 .LVL82-.Ltext0
+	.uleb128 .LVL83-.Ltext0
+	.uleb128 0x2
+	.byte	0x30
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL83-.Ltext0
+	.uleb128 .LVL86-.Ltext0
+	.uleb128 0x2
+	.byte	0x31
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL86-.Ltext0
+	.uleb128 .LVL89-.Ltext0
+	.uleb128 0x2
+	.byte	0x32
+	.byte	0x9f
+	.byte	0
+.LVUS97:
+	.uleb128 .LVU435
+	.uleb128 .LVU437
+	.uleb128 .LVU443
+	.uleb128 .LVU445
+.LLST97:
+	.byte	0x4
+	.uleb128 .LVL82-.Ltext0
+	.uleb128 .LVL82-.Ltext0
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x4
+	.uleb128 .LVL83-.Ltext0
+	.uleb128 .LVL83-.Ltext0
+	.uleb128 0x3
+	.byte	0x74
+	.sleb128 8
+	.byte	0x9f
+	.byte	0
+.LVUS99:
+	.uleb128 .LVU453
+	.uleb128 .LVU457
+	.uleb128 .LVU457
+	.uleb128 .LVU461
+	.uleb128 .LVU461
+	.uleb128 .LVU475
+.LLST99:
+	.byte	0x4
+	.uleb128 .LVL86-.Ltext0
+	.uleb128 .LVL86-.Ltext0
+	.uleb128 0x2
+	.byte	0x30
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL86-.Ltext0
+	.uleb128 .LVL87-.Ltext0
+	.uleb128 0x2
+	.byte	0x31
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL87-.Ltext0
+	.uleb128 .LVL89-.Ltext0
+	.uleb128 0x2
+	.byte	0x32
+	.byte	0x9f
+	.byte	0
+.LVUS38:
+	.uleb128 0
+	.uleb128 .LVU162
+	.uleb128 .LVU162
+	.uleb128 .LVU309
+	.uleb128 .LVU309
+	.uleb128 .LVU312
+	.uleb128 .LVU312
+	.uleb128 0
+.LLST38:
+	.byte	0x4
+	.uleb128 .LVL37-.Ltext0
+	.uleb128 .LVL39-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL39-.Ltext0
+	.uleb128 .LVL56-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0x4
+	.uleb128 .LVL56-.Ltext0
+	.uleb128 .LVL58-.Ltext0
+	.uleb128 0x3
+	.byte	0x7c
+	.sleb128 -64
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL58-.Ltext0
+	.uleb128 .LFE35-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x9f
+	.byte	0
+.LVUS39:
+	.uleb128 0
+	.uleb128 .LVU157
+	.uleb128 .LVU157
+	.uleb128 .LVU311
+	.uleb128 .LVU311
+	.uleb128 0
+.LLST39:
+	.byte	0x4
+	.uleb128 .LVL37-.Ltext0
+	.uleb128 .LVL38-.Ltext0
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x4
+	.uleb128 .LVL38-.Ltext0
+	.uleb128 .LVL57-.Ltext0
+	.uleb128 0x1
+	.byte	0x56
+	.byte	0x4
+	.uleb128 .LVL57-.Ltext0
+	.uleb128 .LFE35-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x9f
+	.byte	0
+.LVUS41:
+	.uleb128 .LVU151
+	.uleb128 .LVU162
+	.uleb128 .LVU162
+	.uleb128 .LVU163
+.LLST41:
+	.byte	0x4
+	.uleb128 .LVL37-.Ltext0
+	.uleb128 .LVL39-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL39-.Ltext0
+	.uleb128 .LVL40-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0
+.LVUS43:
+	.uleb128 .LVU172
+	.uleb128 .LVU175
+	.uleb128 .LVU175
+	.uleb128 .LVU178
+	.uleb128 .LVU178
+	.uleb128 .LVU180
+.LLST43:
+	.byte	0x4
+	.uleb128 .LVL41-.Ltext0
+	.uleb128 .LVL42-.Ltext0
+	.uleb128 0xc
+	.byte	0x73
+	.sleb128 224
+	.byte	0x94
+	.byte	0x4
+	.byte	0xc
+	.long	0xffffffff
+	.byte	0x1a
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL42-.Ltext0
+	.uleb128 .LVL43-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL43-.Ltext0
+	.uleb128 .LVL44-.Ltext0
+	.uleb128 0xc
+	.byte	0x73
+	.sleb128 224
+	.byte	0x94
+	.byte	0x4
+	.byte	0xc
+	.long	0xffffffff
+	.byte	0x1a
+	.byte	0x9f
+	.byte	0
+.LVUS44:
+	.uleb128 .LVU172
+	.uleb128 .LVU180
+.LLST44:
+	.byte	0x4
+	.uleb128 .LVL41-.Ltext0
+	.uleb128 .LVL44-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0
+.LVUS46:
+	.uleb128 .LVU182
+	.uleb128 .LVU184
+	.uleb128 .LVU184
+	.uleb128 .LVU184
+.LLST46:
+	.byte	0x4
+	.uleb128 .LVL44-.Ltext0
+	.uleb128 .LVL45-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x4
+	.uleb128 .LVL45-1-.Ltext0
+	.uleb128 .LVL45-.Ltext0
+	.uleb128 0x1
+	.byte	0x5c
+	.byte	0
+.LVUS47:
+	.uleb128 .LVU182
+	.uleb128 .LVU184
+.LLST47:
+	.byte	0x4
+	.uleb128 .LVL44-.Ltext0
+	.uleb128 .LVL45-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0
+.LVUS48:
+	.uleb128 .LVU186
+	.uleb128 .LVU307
+.LLST48:
+	.byte	0x4
+	.uleb128 .LVL45-.Ltext0
+	.uleb128 .LVL55-.Ltext0
+	.uleb128 0x1
+	.byte	0x56
+	.byte	0
+.LVUS49:
+	.uleb128 .LVU186
+	.uleb128 .LVU307
+.LLST49:
+	.byte	0x4
+	.uleb128 .LVL45-.Ltext0
+	.uleb128 .LVL55-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0
+.LVUS51:
+	.uleb128 .LVU190
+	.uleb128 .LVU206
+	.uleb128 .LVU206
+	.uleb128 .LVU220
+	.uleb128 .LVU220
+	.uleb128 .LVU234
+	.uleb128 .LVU234
+	.uleb128 .LVU248
+	.uleb128 .LVU248
+	.uleb128 .LVU262
+	.uleb128 .LVU262
+	.uleb128 .LVU276
+	.uleb128 .LVU276
+	.uleb128 .LVU290
+	.uleb128 .LVU290
+	.uleb128 .LVU304
+	.uleb128 .LVU304
+	.uleb128 .LVU307
+.LLST51:
+	.byte	0x4
+	.uleb128 .LVL45-.Ltext0
+	.uleb128 .LVL47-.Ltext0
+	.uleb128 0x2
+	.byte	0x30
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL47-.Ltext0
+	.uleb128 .LVL48-.Ltext0
+	.uleb128 0x2
+	.byte	0x31
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL48-.Ltext0
+	.uleb128 .LVL49-.Ltext0
+	.uleb128 0x2
+	.byte	0x32
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL49-.Ltext0
+	.uleb128 .LVL50-.Ltext0
+	.uleb128 0x2
+	.byte	0x33
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL50-.Ltext0
+	.uleb128 .LVL51-.Ltext0
+	.uleb128 0x2
+	.byte	0x34
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL51-.Ltext0
+	.uleb128 .LVL52-.Ltext0
+	.uleb128 0x2
+	.byte	0x35
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL52-.Ltext0
+	.uleb128 .LVL53-.Ltext0
+	.uleb128 0x2
+	.byte	0x36
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL53-.Ltext0
+	.uleb128 .LVL54-.Ltext0
+	.uleb128 0x2
+	.byte	0x37
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL54-.Ltext0
+	.uleb128 .LVL55-.Ltext0
+	.uleb128 0x2
+	.byte	0x38
+	.byte	0x9f
+	.byte	0
+.LVUS53:
+	.uleb128 .LVU192
+	.uleb128 .LVU204
+	.uleb128 .LVU208
+	.uleb128 .LVU218
+	.uleb128 .LVU222
+	.uleb128 .LVU232
+	.uleb128 .LVU236
+	.uleb128 .LVU246
+	.uleb128 .LVU250
+	.uleb128 .LVU260
+	.uleb128 .LVU264
+	.uleb128 .LVU274
+	.uleb128 .LVU278
+	.uleb128 .LVU288
+	.uleb128 .LVU292
+	.uleb128 .LVU302
+.LLST53:
+	.byte	0x4
+	.uleb128 .LVL45-.Ltext0
+	.uleb128 .LVL47-.Ltext0
+	.uleb128 0x2
+	.byte	0x73
+	.sleb128 0
+	.byte	0x4
+	.uleb128 .LVL47-.Ltext0
+	.uleb128 .LVL48-.Ltext0
+	.uleb128 0x2
+	.byte	0x73
+	.sleb128 8
+	.byte	0x4
+	.uleb128 .LVL48-.Ltext0
+	.uleb128 .LVL49-.Ltext0
+	.uleb128 0x2
+	.byte	0x73
+	.sleb128 16
+	.byte	0x4
+	.uleb128 .LVL49-.Ltext0
+	.uleb128 .LVL50-.Ltext0
+	.uleb128 0x2
+	.byte	0x73
+	.sleb128 24
+	.byte	0x4
+	.uleb128 .LVL50-.Ltext0
+	.uleb128 .LVL51-.Ltext0
+	.uleb128 0x2
+	.byte	0x73
+	.sleb128 32
+	.byte	0x4
+	.uleb128 .LVL51-.Ltext0
+	.uleb128 .LVL52-.Ltext0
+	.uleb128 0x2
+	.byte	0x73
+	.sleb128 40
+	.byte	0x4
+	.uleb128 .LVL52-.Ltext0
+	.uleb128 .LVL53-.Ltext0
+	.uleb128 0x2
+	.byte	0x73
+	.sleb128 48
+	.byte	0x4
+	.uleb128 .LVL53-.Ltext0
+	.uleb128 .LVL54-.Ltext0
+	.uleb128 0x2
+	.byte	0x73
+	.sleb128 56
+	.byte	0
+.LVUS54:
+	.uleb128 .LVU192
+	.uleb128 .LVU203
+	.uleb128 .LVU203
+	.uleb128 .LVU204
+	.uleb128 .LVU208
+	.uleb128 .LVU218
+	.uleb128 .LVU222
+	.uleb128 .LVU232
+	.uleb128 .LVU236
+	.uleb128 .LVU246
+	.uleb128 .LVU250
+	.uleb128 .LVU260
+	.uleb128 .LVU264
+	.uleb128 .LVU274
+	.uleb128 .LVU278
+	.uleb128 .LVU288
+	.uleb128 .LVU292
+	.uleb128 .LVU302
+.LLST54:
+	.byte	0x4
+	.uleb128 .LVL45-.Ltext0
+	.uleb128 .LVL46-.Ltext0
+	.uleb128 0x4
+	.byte	0x91
+	.sleb128 -96
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL46-.Ltext0
+	.uleb128 .LVL47-.Ltext0
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x4
+	.uleb128 .LVL47-.Ltext0
+	.uleb128 .LVL48-.Ltext0
+	.uleb128 0x4
+	.byte	0x91
+	.sleb128 -88
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL48-.Ltext0
+	.uleb128 .LVL49-.Ltext0
+	.uleb128 0x4
+	.byte	0x91
+	.sleb128 -80
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL49-.Ltext0
+	.uleb128 .LVL50-.Ltext0
+	.uleb128 0x4
+	.byte	0x91
+	.sleb128 -72
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL50-.Ltext0
+	.uleb128 .LVL51-.Ltext0
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -64
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL51-.Ltext0
+	.uleb128 .LVL52-.Ltext0
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -56
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL52-.Ltext0
+	.uleb128 .LVL53-.Ltext0
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -48
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL53-.Ltext0
+	.uleb128 .LVL54-.Ltext0
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -40
+	.byte	0x9f
+	.byte	0
+.LVUS56:
+	.uleb128 .LVU194
+	.uleb128 .LVU199
+	.uleb128 .LVU210
+	.uleb128 .LVU215
+	.uleb128 .LVU224
+	.uleb128 .LVU229
+	.uleb128 .LVU238
+	.uleb128 .LVU243
+	.uleb128 .LVU252
+	.uleb128 .LVU257
+	.uleb128 .LVU266
+	.uleb128 .LVU271
+	.uleb128 .LVU280
+	.uleb128 .LVU285
+	.uleb128 .LVU294
+	.uleb128 .LVU299
+.LLST56:
+	.byte	0x4
+	.uleb128 .LVL45-.Ltext0
+	.uleb128 .LVL45-.Ltext0
+	.uleb128 0x2
+	.byte	0x73
+	.sleb128 0
+	.byte	0x4
+	.uleb128 .LVL47-.Ltext0
+	.uleb128 .LVL47-.Ltext0
+	.uleb128 0x2
+	.byte	0x73
+	.sleb128 8
+	.byte	0x4
+	.uleb128 .LVL48-.Ltext0
+	.uleb128 .LVL48-.Ltext0
+	.uleb128 0x2
+	.byte	0x73
+	.sleb128 16
+	.byte	0x4
+	.uleb128 .LVL49-.Ltext0
+	.uleb128 .LVL49-.Ltext0
+	.uleb128 0x2
+	.byte	0x73
+	.sleb128 24
+	.byte	0x4
+	.uleb128 .LVL50-.Ltext0
+	.uleb128 .LVL50-.Ltext0
+	.uleb128 0x2
+	.byte	0x73
+	.sleb128 32
+	.byte	0x4
+	.uleb128 .LVL51-.Ltext0
+	.uleb128 .LVL51-.Ltext0
+	.uleb128 0x2
+	.byte	0x73
+	.sleb128 40
+	.byte	0x4
+	.uleb128 .LVL52-.Ltext0
+	.uleb128 .LVL52-.Ltext0
+	.uleb128 0x2
+	.byte	0x73
+	.sleb128 48
+	.byte	0x4
+	.uleb128 .LVL53-.Ltext0
+	.uleb128 .LVL53-.Ltext0
+	.uleb128 0x2
+	.byte	0x73
+	.sleb128 56
+	.byte	0
+.LVUS57:
+	.uleb128 .LVU194
+	.uleb128 .LVU196
+	.uleb128 .LVU196
+	.uleb128 .LVU197
+	.uleb128 .LVU197
+	.uleb128 .LVU198
+	.uleb128 .LVU198
+	.uleb128 .LVU199
+	.uleb128 .LVU210
+	.uleb128 .LVU212
+	.uleb128 .LVU212
+	.uleb128 .LVU213
+	.uleb128 .LVU213
+	.uleb128 .LVU214
+	.uleb128 .LVU214
+	.uleb128 .LVU215
+	.uleb128 .LVU224
+	.uleb128 .LVU226
+	.uleb128 .LVU226
+	.uleb128 .LVU227
+	.uleb128 .LVU227
+	.uleb128 .LVU228
+	.uleb128 .LVU228
+	.uleb128 .LVU229
+	.uleb128 .LVU238
+	.uleb128 .LVU240
+	.uleb128 .LVU240
+	.uleb128 .LVU241
+	.uleb128 .LVU241
+	.uleb128 .LVU242
+	.uleb128 .LVU242
+	.uleb128 .LVU243
+	.uleb128 .LVU252
+	.uleb128 .LVU254
+	.uleb128 .LVU254
+	.uleb128 .LVU255
+	.uleb128 .LVU255
+	.uleb128 .LVU256
+	.uleb128 .LVU256
+	.uleb128 .LVU257
+	.uleb128 .LVU266
+	.uleb128 .LVU268
+	.uleb128 .LVU268
+	.uleb128 .LVU269
+	.uleb128 .LVU269
+	.uleb128 .LVU270
+	.uleb128 .LVU270
+	.uleb128 .LVU271
+	.uleb128 .LVU280
+	.uleb128 .LVU282
+	.uleb128 .LVU282
+	.uleb128 .LVU283
+	.uleb128 .LVU283
+	.uleb128 .LVU284
+	.uleb128 .LVU284
+	.uleb128 .LVU285
+	.uleb128 .LVU294
+	.uleb128 .LVU296
+	.uleb128 .LVU296
+	.uleb128 .LVU297
+	.uleb128 .LVU297
+	.uleb128 .LVU298
+	.uleb128 .LVU298
+	.uleb128 .LVU299
+.LLST57:
+	.byte	0x4
+	.uleb128 .LVL45-.Ltext0
+	.uleb128 .LVL45-.Ltext0
+	.uleb128 0x4
+	.byte	0x91
+	.sleb128 -96
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL45-.Ltext0
+	.uleb128 .LVL45-.Ltext0
+	.uleb128 0x4
+	.byte	0x91
+	.sleb128 -95
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL45-.Ltext0
+	.uleb128 .LVL45-.Ltext0
+	.uleb128 0x4
+	.byte	0x91
+	.sleb128 -94
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL45-.Ltext0
+	.uleb128 .LVL45-.Ltext0
+	.uleb128 0x4
+	.byte	0x91
+	.sleb128 -93
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL47-.Ltext0
+	.uleb128 .LVL47-.Ltext0
+	.uleb128 0x4
+	.byte	0x91
+	.sleb128 -88
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL47-.Ltext0
+	.uleb128 .LVL47-.Ltext0
+	.uleb128 0x4
+	.byte	0x91
+	.sleb128 -87
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL47-.Ltext0
+	.uleb128 .LVL47-.Ltext0
+	.uleb128 0x4
+	.byte	0x91
+	.sleb128 -86
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL47-.Ltext0
+	.uleb128 .LVL47-.Ltext0
+	.uleb128 0x4
+	.byte	0x91
+	.sleb128 -85
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL48-.Ltext0
+	.uleb128 .LVL48-.Ltext0
+	.uleb128 0x4
+	.byte	0x91
+	.sleb128 -80
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL48-.Ltext0
+	.uleb128 .LVL48-.Ltext0
+	.uleb128 0x4
+	.byte	0x91
+	.sleb128 -79
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL48-.Ltext0
+	.uleb128 .LVL48-.Ltext0
+	.uleb128 0x4
+	.byte	0x91
+	.sleb128 -78
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL48-.Ltext0
+	.uleb128 .LVL48-.Ltext0
+	.uleb128 0x4
+	.byte	0x91
+	.sleb128 -77
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL49-.Ltext0
+	.uleb128 .LVL49-.Ltext0
+	.uleb128 0x4
+	.byte	0x91
+	.sleb128 -72
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL49-.Ltext0
+	.uleb128 .LVL49-.Ltext0
+	.uleb128 0x4
+	.byte	0x91
+	.sleb128 -71
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL49-.Ltext0
+	.uleb128 .LVL49-.Ltext0
+	.uleb128 0x4
+	.byte	0x91
+	.sleb128 -70
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL49-.Ltext0
+	.uleb128 .LVL49-.Ltext0
+	.uleb128 0x4
+	.byte	0x91
+	.sleb128 -69
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL50-.Ltext0
+	.uleb128 .LVL50-.Ltext0
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -64
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL50-.Ltext0
+	.uleb128 .LVL50-.Ltext0
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -63
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL50-.Ltext0
+	.uleb128 .LVL50-.Ltext0
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -62
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL50-.Ltext0
+	.uleb128 .LVL50-.Ltext0
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -61
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL51-.Ltext0
+	.uleb128 .LVL51-.Ltext0
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -56
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL51-.Ltext0
+	.uleb128 .LVL51-.Ltext0
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -55
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL51-.Ltext0
+	.uleb128 .LVL51-.Ltext0
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -54
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL51-.Ltext0
+	.uleb128 .LVL51-.Ltext0
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -53
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL52-.Ltext0
+	.uleb128 .LVL52-.Ltext0
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -48
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL52-.Ltext0
+	.uleb128 .LVL52-.Ltext0
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -47
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL52-.Ltext0
+	.uleb128 .LVL52-.Ltext0
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -46
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL52-.Ltext0
+	.uleb128 .LVL52-.Ltext0
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -45
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL53-.Ltext0
+	.uleb128 .LVL53-.Ltext0
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -40
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL53-.Ltext0
+	.uleb128 .LVL53-.Ltext0
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -39
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL53-.Ltext0
+	.uleb128 .LVL53-.Ltext0
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -38
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL53-.Ltext0
+	.uleb128 .LVL53-.Ltext0
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -37
+	.byte	0x9f
+	.byte	0
+.LVUS0:
+	.uleb128 0
+	.uleb128 .LVU8
+	.uleb128 .LVU8
+	.uleb128 0
+.LLST0:
+	.byte	0x4
+	.uleb128 .LVL0-.Ltext0
+	.uleb128 .LVL1-.Ltext0
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x4
+	.uleb128 .LVL1-.Ltext0
+	.uleb128 .LFE36-.Ltext0
+	.uleb128 0x1
+	.byte	0x52
+	.byte	0
+.LVUS1:
+	.uleb128 0
+	.uleb128 .LVU62
+	.uleb128 .LVU62
+	.uleb128 0
+.LLST1:
+	.byte	0x4
+	.uleb128 .LVL0-.Ltext0
+	.uleb128 .LVL9-.Ltext0
+	.uleb128 0x1
+	.byte	0x51
+	.byte	0x4
+	.uleb128 .LVL9-.Ltext0
+	.uleb128 .LFE36-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x51
+	.byte	0x9f
+	.byte	0
+.LVUS2:
+	.uleb128 .LVU2
+	.uleb128 .LVU11
+	.uleb128 .LVU11
+	.uleb128 .LVU16
+	.uleb128 .LVU16
+	.uleb128 .LVU21
+	.uleb128 .LVU21
+	.uleb128 .LVU26
+	.uleb128 .LVU26
+	.uleb128 .LVU35
+	.uleb128 .LVU35
+	.uleb128 .LVU46
+	.uleb128 .LVU46
+	.uleb128 .LVU51
+	.uleb128 .LVU51
+	.uleb128 .LVU54
+	.uleb128 .LVU54
+	.uleb128 0
+.LLST2:
+	.byte	0x4
+	.uleb128 .LVL0-.Ltext0
+	.uleb128 .LVL2-.Ltext0
+	.uleb128 0x2
+	.byte	0x30
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL2-.Ltext0
+	.uleb128 .LVL3-.Ltext0
+	.uleb128 0x2
+	.byte	0x31
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL3-.Ltext0
+	.uleb128 .LVL4-.Ltext0
+	.uleb128 0x2
+	.byte	0x32
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL4-.Ltext0
+	.uleb128 .LVL5-.Ltext0
+	.uleb128 0x2
+	.byte	0x33
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL5-.Ltext0
+	.uleb128 .LVL6-.Ltext0
+	.uleb128 0x2
+	.byte	0x34
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL6-.Ltext0
+	.uleb128 .LVL8-.Ltext0
+	.uleb128 0x2
+	.byte	0x35
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL8-.Ltext0
+	.uleb128 .LVL8-.Ltext0
+	.uleb128 0x2
+	.byte	0x36
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL8-.Ltext0
+	.uleb128 .LVL8-.Ltext0
+	.uleb128 0x2
+	.byte	0x37
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL8-.Ltext0
+	.uleb128 .LFE36-.Ltext0
+	.uleb128 0x2
+	.byte	0x38
+	.byte	0x9f
+	.byte	0
+.LVUS4:
+	.uleb128 .LVU47
+	.uleb128 .LVU51
+	.uleb128 .LVU51
+	.uleb128 .LVU54
+	.uleb128 .LVU54
+	.uleb128 0
+.LLST4:
+	.byte	0x4
+	.uleb128 .LVL8-.Ltext0
+	.uleb128 .LVL8-.Ltext0
+	.uleb128 0x2
+	.byte	0x30
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL8-.Ltext0
+	.uleb128 .LVL8-.Ltext0
+	.uleb128 0x2
+	.byte	0x31
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL8-.Ltext0
+	.uleb128 .LFE36-.Ltext0
+	.uleb128 0x2
+	.byte	0x32
+	.byte	0x9f
+	.byte	0
+.LVUS6:
+	.uleb128 .LVU27
+	.uleb128 .LVU35
+	.uleb128 .LVU35
+	.uleb128 .LVU46
+	.uleb128 .LVU46
+	.uleb128 0
+.LLST6:
+	.byte	0x4
+	.uleb128 .LVL5-.Ltext0
+	.uleb128 .LVL6-.Ltext0
+	.uleb128 0x2
+	.byte	0x30
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL6-.Ltext0
+	.uleb128 .LVL8-.Ltext0
+	.uleb128 0x2
+	.byte	0x31
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL8-.Ltext0
+	.uleb128 .LFE36-.Ltext0
+	.uleb128 0x2
+	.byte	0x32
+	.byte	0x9f
+	.byte	0
+.LVUS8:
+	.uleb128 .LVU29
+	.uleb128 .LVU31
+	.uleb128 .LVU37
+	.uleb128 .LVU39
+.LLST8:
+	.byte	0x4
+	.uleb128 .LVL5-.Ltext0
+	.uleb128 .LVL5-.Ltext0
+	.uleb128 0x1
+	.byte	0x51
+	.byte	0x4
+	.uleb128 .LVL6-.Ltext0
+	.uleb128 .LVL6-.Ltext0
+	.uleb128 0x3
+	.byte	0x71
+	.sleb128 8
+	.byte	0x9f
+	.byte	0
+.LVUS9:
+	.uleb128 0
+	.uleb128 .LVU74
+	.uleb128 .LVU74
+	.uleb128 .LVU91
+	.uleb128 .LVU91
+	.uleb128 .LVU93
+	.uleb128 .LVU93
+	.uleb128 .LVU94
+	.uleb128 .LVU94
+	.uleb128 0
+.LLST9:
+	.byte	0x4
+	.uleb128 .LVL10-.Ltext0
+	.uleb128 .LVL11-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL11-.Ltext0
+	.uleb128 .LVL16-.Ltext0
+	.uleb128 0x1
+	.byte	0x56
+	.byte	0x4
+	.uleb128 .LVL16-.Ltext0
+	.uleb128 .LVL18-.Ltext0
+	.uleb128 0x3
+	.byte	0x7f
+	.sleb128 -64
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL18-.Ltext0
+	.uleb128 .LVL19-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL19-.Ltext0
+	.uleb128 .LFE33-.Ltext0
+	.uleb128 0x1
+	.byte	0x56
+	.byte	0
+.LVUS10:
+	.uleb128 0
+	.uleb128 .LVU82
+	.uleb128 .LVU82
+	.uleb128 .LVU92
+	.uleb128 .LVU92
+	.uleb128 .LVU94
+	.uleb128 .LVU94
+	.uleb128 .LVU110
+	.uleb128 .LVU110
+	.uleb128 .LVU117
+	.uleb128 .LVU117
+	.uleb128 .LVU141
+	.uleb128 .LVU141
+	.uleb128 .LVU146
+	.uleb128 .LVU146
+	.uleb128 0
+.LLST10:
+	.byte	0x4
+	.uleb128 .LVL10-.Ltext0
+	.uleb128 .LVL13-.Ltext0
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x4
+	.uleb128 .LVL13-.Ltext0
+	.uleb128 .LVL17-.Ltext0
+	.uleb128 0x1
+	.byte	0x5c
+	.byte	0x4
+	.uleb128 .LVL17-.Ltext0
+	.uleb128 .LVL19-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL19-.Ltext0
+	.uleb128 .LVL25-.Ltext0
+	.uleb128 0x1
+	.byte	0x5c
+	.byte	0x4
+	.uleb128 .LVL25-.Ltext0
+	.uleb128 .LVL30-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x4
+	.uleb128 .LVL30-1-.Ltext0
+	.uleb128 .LVL34-.Ltext0
+	.uleb128 0x1
+	.byte	0x5c
+	.byte	0x4
+	.uleb128 .LVL34-.Ltext0
+	.uleb128 .LVL36-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x4
+	.uleb128 .LVL36-1-.Ltext0
+	.uleb128 .LFE33-.Ltext0
+	.uleb128 0x1
+	.byte	0x5c
+	.byte	0
+.LVUS11:
+	.uleb128 0
+	.uleb128 .LVU82
+	.uleb128 .LVU82
+	.uleb128 .LVU88
+	.uleb128 .LVU94
+	.uleb128 .LVU102
+	.uleb128 .LVU102
+	.uleb128 .LVU104
+	.uleb128 .LVU107
+	.uleb128 .LVU110
+	.uleb128 .LVU110
+	.uleb128 .LVU114
+	.uleb128 .LVU114
+	.uleb128 .LVU116
+	.uleb128 .LVU116
+	.uleb128 .LVU124
+	.uleb128 .LVU124
+	.uleb128 .LVU141
+	.uleb128 .LVU141
+	.uleb128 .LVU146
+	.uleb128 .LVU146
+	.uleb128 0
+.LLST11:
+	.byte	0x4
+	.uleb128 .LVL10-.Ltext0
+	.uleb128 .LVL13-.Ltext0
+	.uleb128 0x1
+	.byte	0x51
+	.byte	0x4
+	.uleb128 .LVL13-.Ltext0
+	.uleb128 .LVL15-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0x4
+	.uleb128 .LVL19-.Ltext0
+	.uleb128 .LVL22-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0x4
+	.uleb128 .LVL22-.Ltext0
+	.uleb128 .LVL23-.Ltext0
+	.uleb128 0x3
+	.byte	0x71
+	.sleb128 1
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL24-.Ltext0
+	.uleb128 .LVL25-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0x4
+	.uleb128 .LVL25-.Ltext0
+	.uleb128 .LVL28-.Ltext0
+	.uleb128 0x1
+	.byte	0x51
+	.byte	0x4
+	.uleb128 .LVL28-.Ltext0
+	.uleb128 .LVL29-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0x4
+	.uleb128 .LVL29-.Ltext0
+	.uleb128 .LVL31-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x51
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL31-.Ltext0
+	.uleb128 .LVL34-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0x4
+	.uleb128 .LVL34-.Ltext0
+	.uleb128 .LVL36-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x51
+	.byte	0x4
+	.uleb128 .LVL36-1-.Ltext0
+	.uleb128 .LFE33-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x51
+	.byte	0x9f
+	.byte	0
+.LVUS12:
+	.uleb128 .LVU76
+	.uleb128 .LVU82
+	.uleb128 .LVU82
+	.uleb128 .LVU84
+	.uleb128 .LVU94
+	.uleb128 .LVU96
+	.uleb128 .LVU110
+	.uleb128 .LVU113
+	.uleb128 .LVU113
+	.uleb128 .LVU141
+	.uleb128 .LVU141
+	.uleb128 .LVU144
+	.uleb128 .LVU144
+	.uleb128 0
+.LLST12:
+	.byte	0x4
+	.uleb128 .LVL12-.Ltext0
+	.uleb128 .LVL13-.Ltext0
+	.uleb128 0x6
+	.byte	0x8
+	.byte	0x80
+	.byte	0x75
+	.sleb128 0
+	.byte	0x1c
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL13-.Ltext0
+	.uleb128 .LVL14-.Ltext0
+	.uleb128 0x6
+	.byte	0x8
+	.byte	0x80
+	.byte	0x7d
+	.sleb128 0
+	.byte	0x1c
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL19-.Ltext0
+	.uleb128 .LVL20-.Ltext0
+	.uleb128 0x6
+	.byte	0x8
+	.byte	0x80
+	.byte	0x7d
+	.sleb128 0
+	.byte	0x1c
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL25-.Ltext0
+	.uleb128 .LVL27-.Ltext0
+	.uleb128 0x6
+	.byte	0x8
+	.byte	0x80
+	.byte	0x75
+	.sleb128 0
+	.byte	0x1c
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL27-.Ltext0
+	.uleb128 .LVL34-.Ltext0
+	.uleb128 0x6
+	.byte	0x8
+	.byte	0x80
+	.byte	0x7d
+	.sleb128 0
+	.byte	0x1c
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL34-.Ltext0
+	.uleb128 .LVL35-.Ltext0
+	.uleb128 0x6
+	.byte	0x8
+	.byte	0x80
+	.byte	0x75
+	.sleb128 0
+	.byte	0x1c
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL35-.Ltext0
+	.uleb128 .LFE33-.Ltext0
+	.uleb128 0x6
+	.byte	0x8
+	.byte	0x80
+	.byte	0x7d
+	.sleb128 0
+	.byte	0x1c
+	.byte	0x9f
+	.byte	0
+.LVUS13:
+	.uleb128 .LVU77
+	.uleb128 .LVU82
+	.uleb128 .LVU82
+	.uleb128 .LVU84
+	.uleb128 .LVU94
+	.uleb128 .LVU108
+	.uleb128 .LVU110
+	.uleb128 .LVU123
+	.uleb128 .LVU123
+	.uleb128 .LVU141
+	.uleb128 .LVU141
+	.uleb128 0
+.LLST13:
+	.byte	0x4
+	.uleb128 .LVL12-.Ltext0
+	.uleb128 .LVL13-.Ltext0
+	.uleb128 0x2
+	.byte	0x30
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL13-.Ltext0
+	.uleb128 .LVL14-.Ltext0
+	.uleb128 0x1
+	.byte	0x5e
+	.byte	0x4
+	.uleb128 .LVL19-.Ltext0
+	.uleb128 .LVL24-.Ltext0
+	.uleb128 0x1
+	.byte	0x5e
+	.byte	0x4
+	.uleb128 .LVL25-.Ltext0
+	.uleb128 .LVL31-.Ltext0
+	.uleb128 0x2
+	.byte	0x30
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL31-.Ltext0
+	.uleb128 .LVL34-.Ltext0
+	.uleb128 0x1
+	.byte	0x5e
+	.byte	0x4
+	.uleb128 .LVL34-.Ltext0
+	.uleb128 .LFE33-.Ltext0
+	.uleb128 0x2
+	.byte	0x30
+	.byte	0x9f
+	.byte	0
+.LVUS15:
+	.uleb128 .LVU142
+	.uleb128 .LVU144
+	.uleb128 .LVU144
+	.uleb128 .LVU147
+.LLST15:
+	.byte	0x4
+	.uleb128 .LVL34-.Ltext0
+	.uleb128 .LVL35-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL35-.Ltext0
+	.uleb128 .LVL36-.Ltext0
+	.uleb128 0x1
+	.byte	0x5d
+	.byte	0
+.LVUS16:
+	.uleb128 .LVU142
+	.uleb128 .LVU146
+	.uleb128 .LVU146
+	.uleb128 .LVU147
+.LLST16:
+	.byte	0x4
+	.uleb128 .LVL34-.Ltext0
+	.uleb128 .LVL36-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x51
+	.byte	0x4
+	.uleb128 .LVL36-1-.Ltext0
+	.uleb128 .LVL36-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x51
+	.byte	0x9f
+	.byte	0
+.LVUS17:
+	.uleb128 .LVU142
+	.uleb128 .LVU147
+.LLST17:
+	.byte	0x4
+	.uleb128 .LVL34-.Ltext0
+	.uleb128 .LVL36-.Ltext0
+	.uleb128 0x1
+	.byte	0x56
+	.byte	0
+.LVUS18:
+	.uleb128 .LVU85
+	.uleb128 .LVU88
+.LLST18:
+	.byte	0x4
+	.uleb128 .LVL14-.Ltext0
+	.uleb128 .LVL15-.Ltext0
+	.uleb128 0x2
+	.byte	0x30
+	.byte	0x9f
+	.byte	0
+.LVUS19:
+	.uleb128 .LVU85
+	.uleb128 .LVU88
+.LLST19:
+	.byte	0x4
+	.uleb128 .LVL14-.Ltext0
+	.uleb128 .LVL15-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0
+.LVUS20:
+	.uleb128 .LVU85
+	.uleb128 .LVU88
+.LLST20:
+	.byte	0x4
+	.uleb128 .LVL14-.Ltext0
+	.uleb128 .LVL15-.Ltext0
+	.uleb128 0x1
+	.byte	0x56
+	.byte	0
+.LVUS22:
+	.uleb128 .LVU96
+	.uleb128 .LVU101
+	.uleb128 .LVU101
+	.uleb128 .LVU104
+	.uleb128 .LVU104
+	.uleb128 .LVU105
+.LLST22:
+	.byte	0x4
+	.uleb128 .LVL20-.Ltext0
+	.uleb128 .LVL21-.Ltext0
+	.uleb128 0x5
+	.byte	0x7d
+	.sleb128 0
+	.byte	0x37
+	.byte	0x25
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL21-.Ltext0
+	.uleb128 .LVL23-.Ltext0
+	.uleb128 0x5
+	.byte	0x71
+	.sleb128 0
+	.byte	0x37
+	.byte	0x25
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL23-.Ltext0
+	.uleb128 .LVL24-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x51
+	.byte	0
+.LVUS24:
+	.uleb128 .LVU97
+	.uleb128 .LVU101
+	.uleb128 .LVU101
+	.uleb128 .LVU104
+	.uleb128 .LVU104
+	.uleb128 .LVU105
+.LLST24:
+	.byte	0x4
+	.uleb128 .LVL20-.Ltext0
+	.uleb128 .LVL21-.Ltext0
+	.uleb128 0x5
+	.byte	0x7d
+	.sleb128 0
+	.byte	0x37
+	.byte	0x25
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL21-.Ltext0
+	.uleb128 .LVL23-.Ltext0
+	.uleb128 0x5
+	.byte	0x71
+	.sleb128 0
+	.byte	0x37
+	.byte	0x25
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL23-.Ltext0
+	.uleb128 .LVL24-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x51
+	.byte	0
+.LVUS25:
+	.uleb128 .LVU97
+	.uleb128 .LVU105
+.LLST25:
+	.byte	0x4
+	.uleb128 .LVL20-.Ltext0
+	.uleb128 .LVL24-.Ltext0
+	.uleb128 0x6
+	.byte	0x7c
+	.sleb128 0
+	.byte	0x7e
+	.sleb128 0
+	.byte	0x22
+	.byte	0x9f
+	.byte	0
+.LVUS26:
+	.uleb128 .LVU97
+	.uleb128 .LVU105
+.LLST26:
+	.byte	0x4
+	.uleb128 .LVL20-.Ltext0
+	.uleb128 .LVL24-.Ltext0
+	.uleb128 0x1
+	.byte	0x56
+	.byte	0
+.LVUS28:
+	.uleb128 .LVU111
+	.uleb128 .LVU113
+	.uleb128 .LVU113
+	.uleb128 .LVU121
+.LLST28:
+	.byte	0x4
+	.uleb128 .LVL26-.Ltext0
+	.uleb128 .LVL27-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL27-.Ltext0
+	.uleb128 .LVL31-.Ltext0
+	.uleb128 0x1
+	.byte	0x5d
+	.byte	0
+.LVUS29:
+	.uleb128 .LVU111
+	.uleb128 .LVU121
+.LLST29:
+	.byte	0x4
+	.uleb128 .LVL26-.Ltext0
+	.uleb128 .LVL31-.Ltext0
+	.uleb128 0x1
+	.byte	0x5e
+	.byte	0
+.LVUS30:
+	.uleb128 .LVU111
+	.uleb128 .LVU117
+	.uleb128 .LVU117
+	.uleb128 .LVU121
+.LLST30:
+	.byte	0x4
+	.uleb128 .LVL26-.Ltext0
+	.uleb128 .LVL30-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x4
+	.uleb128 .LVL30-1-.Ltext0
+	.uleb128 .LVL31-.Ltext0
+	.uleb128 0x1
+	.byte	0x5c
+	.byte	0
+.LVUS31:
+	.uleb128 .LVU111
+	.uleb128 .LVU121
+.LLST31:
+	.byte	0x4
+	.uleb128 .LVL26-.Ltext0
+	.uleb128 .LVL31-.Ltext0
+	.uleb128 0x1
+	.byte	0x56
+	.byte	0
+.LVUS33:
+	.uleb128 .LVU125
+	.uleb128 .LVU133
+.LLST33:
+	.byte	0x4
+	.uleb128 .LVL31-.Ltext0
+	.uleb128 .LVL32-.Ltext0
+	.uleb128 0x3
+	.byte	0x8
+	.byte	0x80
+	.byte	0x9f
+	.byte	0
+.LVUS34:
+	.uleb128 .LVU125
+	.uleb128 .LVU133
+.LLST34:
+	.byte	0x4
+	.uleb128 .LVL31-.Ltext0
+	.uleb128 .LVL32-.Ltext0
+	.uleb128 0x1
+	.byte	0x56
+	.byte	0
+.LVUS36:
+	.uleb128 .LVU135
+	.uleb128 .LVU137
+.LLST36:
+	.byte	0x4
+	.uleb128 .LVL32-.Ltext0
+	.uleb128 .LVL33-.Ltext0
+	.uleb128 0x4
+	.byte	0x76
+	.sleb128 64
+	.byte	0x9f
+	.byte	0
+.LVUS37:
+	.uleb128 .LVU135
+	.uleb128 .LVU137
+.LLST37:
+	.byte	0x4
+	.uleb128 .LVL32-.Ltext0
+	.uleb128 .LVL33-.Ltext0
+	.uleb128 0x1
+	.byte	0x56
+	.byte	0
+.LVUS58:
+	.uleb128 0
+	.uleb128 .LVU394
+	.uleb128 .LVU394
+	.uleb128 .LVU400
+	.uleb128 .LVU400
+	.uleb128 0
+.LLST58:
+	.byte	0x4
+	.uleb128 .LVL59-.Ltext0
+	.uleb128 .LVL73-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL73-.Ltext0
+	.uleb128 .LVL76-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0x4
+	.uleb128 .LVL76-.Ltext0
+	.uleb128 .LFE37-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x9f
+	.byte	0
+.LVUS59:
+	.uleb128 0
+	.uleb128 .LVU318
+	.uleb128 .LVU318
+	.uleb128 .LVU378
+	.uleb128 .LVU378
+	.uleb128 0
+.LLST59:
+	.byte	0x4
+	.uleb128 .LVL59-.Ltext0
+	.uleb128 .LVL60-.Ltext0
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x4
+	.uleb128 .LVL60-.Ltext0
+	.uleb128 .LVL70-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL70-.Ltext0
+	.uleb128 .LFE37-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x9f
+	.byte	0
+.LVUS60:
+	.uleb128 0
+	.uleb128 .LVU320
+	.uleb128 .LVU320
+	.uleb128 .LVU321
+	.uleb128 .LVU321
+	.uleb128 0
+.LLST60:
+	.byte	0x4
+	.uleb128 .LVL59-.Ltext0
+	.uleb128 .LVL61-.Ltext0
+	.uleb128 0x1
+	.byte	0x51
+	.byte	0x4
+	.uleb128 .LVL61-.Ltext0
+	.uleb128 .LVL62-.Ltext0
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x4
+	.uleb128 .LVL62-.Ltext0
+	.uleb128 .LFE37-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x51
+	.byte	0x9f
+	.byte	0
+.LVUS61:
+	.uleb128 0
+	.uleb128 .LVU396
+	.uleb128 .LVU396
+	.uleb128 0
+.LLST61:
+	.byte	0x4
+	.uleb128 .LVL59-.Ltext0
+	.uleb128 .LVL74-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x52
+	.byte	0x4
+	.uleb128 .LVL74-1-.Ltext0
+	.uleb128 .LFE37-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x52
+	.byte	0x9f
+	.byte	0
+.LVUS62:
+	.uleb128 0
+	.uleb128 .LVU396
+	.uleb128 .LVU396
+	.uleb128 0
+.LLST62:
+	.byte	0x4
+	.uleb128 .LVL59-.Ltext0
+	.uleb128 .LVL74-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x58
+	.byte	0x4
+	.uleb128 .LVL74-1-.Ltext0
+	.uleb128 .LFE37-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x58
+	.byte	0x9f
+	.byte	0
+.LVUS64:
+	.uleb128 .LVU321
+	.uleb128 .LVU383
+.LLST64:
+	.byte	0x4
+	.uleb128 .LVL62-.Ltext0
+	.uleb128 .LVL71-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x51
+	.byte	0x9f
+	.byte	0
+.LVUS65:
+	.uleb128 .LVU321
+	.uleb128 .LVU378
+	.uleb128 .LVU378
+	.uleb128 .LVU383
+.LLST65:
+	.byte	0x4
+	.uleb128 .LVL62-.Ltext0
+	.uleb128 .LVL70-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL70-.Ltext0
+	.uleb128 .LVL71-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x9f
+	.byte	0
+.LVUS66:
+	.uleb128 .LVU321
+	.uleb128 .LVU383
+.LLST66:
+	.byte	0x4
+	.uleb128 .LVL62-.Ltext0
+	.uleb128 .LVL71-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0
+.LVUS67:
+	.uleb128 .LVU322
+	.uleb128 .LVU327
+	.uleb128 .LVU327
+	.uleb128 .LVU332
+	.uleb128 .LVU332
+	.uleb128 .LVU337
+	.uleb128 .LVU337
+	.uleb128 .LVU342
+	.uleb128 .LVU342
+	.uleb128 .LVU351
+	.uleb128 .LVU351
+	.uleb128 .LVU362
+	.uleb128 .LVU362
+	.uleb128 .LVU367
+	.uleb128 .LVU367
+	.uleb128 .LVU370
+	.uleb128 .LVU370
+	.uleb128 .LVU383
+.LLST67:
+	.byte	0x4
+	.uleb128 .LVL62-.Ltext0
+	.uleb128 .LVL63-.Ltext0
+	.uleb128 0x2
+	.byte	0x30
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL63-.Ltext0
+	.uleb128 .LVL64-.Ltext0
+	.uleb128 0x2
+	.byte	0x31
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL64-.Ltext0
+	.uleb128 .LVL65-.Ltext0
+	.uleb128 0x2
+	.byte	0x32
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL65-.Ltext0
+	.uleb128 .LVL66-.Ltext0
+	.uleb128 0x2
+	.byte	0x33
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL66-.Ltext0
+	.uleb128 .LVL67-.Ltext0
+	.uleb128 0x2
+	.byte	0x34
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL67-.Ltext0
+	.uleb128 .LVL69-.Ltext0
+	.uleb128 0x2
+	.byte	0x35
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL69-.Ltext0
+	.uleb128 .LVL69-.Ltext0
+	.uleb128 0x2
+	.byte	0x36
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL69-.Ltext0
+	.uleb128 .LVL69-.Ltext0
+	.uleb128 0x2
+	.byte	0x37
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL69-.Ltext0
+	.uleb128 .LVL71-.Ltext0
+	.uleb128 0x2
+	.byte	0x38
+	.byte	0x9f
+	.byte	0
+.LVUS69:
+	.uleb128 .LVU363
+	.uleb128 .LVU367
+	.uleb128 .LVU367
+	.uleb128 .LVU370
+	.uleb128 .LVU370
+	.uleb128 .LVU383
+.LLST69:
+	.byte	0x4
+	.uleb128 .LVL69-.Ltext0
+	.uleb128 .LVL69-.Ltext0
+	.uleb128 0x2
+	.byte	0x30
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL69-.Ltext0
+	.uleb128 .LVL69-.Ltext0
+	.uleb128 0x2
+	.byte	0x31
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL69-.Ltext0
+	.uleb128 .LVL71-.Ltext0
+	.uleb128 0x2
+	.byte	0x32
+	.byte	0x9f
+	.byte	0
+.LVUS71:
+	.uleb128 .LVU343
+	.uleb128 .LVU351
+	.uleb128 .LVU351
+	.uleb128 .LVU362
+	.uleb128 .LVU362
+	.uleb128 .LVU383
+.LLST71:
+	.byte	0x4
+	.uleb128 .LVL66-.Ltext0
+	.uleb128 .LVL67-.Ltext0
+	.uleb128 0x2
+	.byte	0x30
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL67-.Ltext0
+	.uleb128 .LVL69-.Ltext0
+	.uleb128 0x2
+	.byte	0x31
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL69-.Ltext0
+	.uleb128 .LVL71-.Ltext0
+	.uleb128 0x2
+	.byte	0x32
+	.byte	0x9f
+	.byte	0
+.LVUS73:
+	.uleb128 .LVU345
+	.uleb128 .LVU347
+	.uleb128 .LVU353
+	.uleb128 .LVU355
+.LLST73:
+	.byte	0x4
+	.uleb128 .LVL66-.Ltext0
+	.uleb128 .LVL66-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x51
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL67-.Ltext0
+	.uleb128 .LVL67-.Ltext0
+	.uleb128 0x6
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x51
+	.byte	0x23
+	.uleb128 0x8
+	.byte	0x9f
+	.byte	0
+.LVUS75:
+	.uleb128 .LVU390
+	.uleb128 .LVU398
+.LLST75:
+	.byte	0x4
+	.uleb128 .LVL72-.Ltext0
+	.uleb128 .LVL75-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x9f
+	.byte	0
+.LVUS76:
+	.uleb128 .LVU390
+	.uleb128 .LVU398
+.LLST76:
+	.byte	0x4
+	.uleb128 .LVL72-.Ltext0
+	.uleb128 .LVL75-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x51
+	.byte	0x9f
+	.byte	0
+.LVUS77:
+	.uleb128 .LVU388
+	.uleb128 .LVU396
+	.uleb128 .LVU396
+	.uleb128 .LVU398
+.LLST77:
+	.byte	0x4
+	.uleb128 .LVL72-.Ltext0
+	.uleb128 .LVL74-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x58
+	.byte	0x4
+	.uleb128 .LVL74-1-.Ltext0
+	.uleb128 .LVL75-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x58
+	.byte	0x9f
+	.byte	0
+.LVUS78:
+	.uleb128 .LVU388
+	.uleb128 .LVU396
+	.uleb128 .LVU396
+	.uleb128 .LVU398
+.LLST78:
+	.byte	0x4
+	.uleb128 .LVL72-.Ltext0
+	.uleb128 .LVL74-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x52
+	.byte	0x4
+	.uleb128 .LVL74-1-.Ltext0
+	.uleb128 .LVL75-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x52
+	.byte	0x9f
+	.byte	0
+.LVUS79:
+	.uleb128 .LVU388
+	.uleb128 .LVU398
+.LLST79:
+	.byte	0x4
+	.uleb128 .LVL72-.Ltext0
+	.uleb128 .LVL75-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0
+.LVUS100:
+	.uleb128 .LVU481
+	.uleb128 .LVU528
+.LLST100:
+	.byte	0x4
+	.uleb128 .LVL91-.Ltext0
+	.uleb128 .LVL93-.Ltext0
+	.uleb128 0x2
+	.byte	0x30
+	.byte	0x9f
+	.byte	0
+.LVUS103:
+	.uleb128 .LVU481
+	.uleb128 .LVU528
+.LLST103:
+	.byte	0x4
+	.uleb128 .LVL91-.Ltext0
+	.uleb128 .LVL93-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0
+.LVUS104:
+	.uleb128 .LVU483
+	.uleb128 .LVU526
+.LLST104:
+	.byte	0x4
+	.uleb128 .LVL91-.Ltext0
+	.uleb128 .LVL93-.Ltext0
+	.uleb128 0xa
+	.byte	0x3
+	.quad	blake2b_salt_def
+	.byte	0x9f
+	.byte	0
+.LVUS105:
+	.uleb128 .LVU483
+	.uleb128 .LVU526
+.LLST105:
+	.byte	0x4
+	.uleb128 .LVL91-.Ltext0
+	.uleb128 .LVL93-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0
+.LVUS107:
+	.uleb128 .LVU484
+	.uleb128 .LVU487
+	.uleb128 .LVU487
+	.uleb128 .LVU490
+	.uleb128 .LVU490
+	.uleb128 .LVU493
+	.uleb128 .LVU493
+	.uleb128 .LVU496
+	.uleb128 .LVU496
+	.uleb128 .LVU501
+	.uleb128 .LVU501
+	.uleb128 .LVU504
+	.uleb128 .LVU504
+	.uleb128 .LVU508
+	.uleb128 .LVU508
+	.uleb128 .LVU517
+	.uleb128 .LVU517
+	.uleb128 .LVU526
+.LLST107:
+	.byte	0x4
+	.uleb128 .LVL91-.Ltext0
+	.uleb128 .LVL91-.Ltext0
+	.uleb128 0x2
+	.byte	0x30
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL91-.Ltext0
+	.uleb128 .LVL91-.Ltext0
+	.uleb128 0x2
+	.byte	0x31
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL91-.Ltext0
+	.uleb128 .LVL91-.Ltext0
+	.uleb128 0x2
+	.byte	0x32
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL91-.Ltext0
+	.uleb128 .LVL91-.Ltext0
+	.uleb128 0x2
+	.byte	0x33
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL91-.Ltext0
+	.uleb128 .LVL91-.Ltext0
+	.uleb128 0x2
+	.byte	0x34
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL91-.Ltext0
+	.uleb128 .LVL91-.Ltext0
+	.uleb128 0x2
+	.byte	0x35
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL91-.Ltext0
+	.uleb128 .LVL91-.Ltext0
+	.uleb128 0x2
+	.byte	0x36
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL91-.Ltext0
+	.uleb128 .LVL92-.Ltext0
+	.uleb128 0x2
+	.byte	0x37
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL92-.Ltext0
+	.uleb128 .LVL93-.Ltext0
+	.uleb128 0x2
+	.byte	0x38
+	.byte	0x9f
+	.byte	0
+.Ldebug_loc3:
+	.section	.debug_aranges,"",@progbits
+	.long	0x2c
+	.value	0x2
+	.long	.Ldebug_info0
+	.byte	0x8
+	.byte	0
+	.value	0
+	.value	0
+	.quad	.Ltext0
+	.quad	.Letext0-.Ltext0
+	.quad	0
+	.quad	0
+	.section	.debug_rnglists,"",@progbits
+.Ldebug_ranges0:
+	.long	.Ldebug_ranges3-.Ldebug_ranges2
+.Ldebug_ranges2:
+	.value	0x5
+	.byte	0x8
+	.byte	0
+	.long	0
+.LLRL3:
+	.byte	0x4
+	.uleb128 .LBB80-.Ltext0
+	.uleb128 .LBE80-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB86-.Ltext0
+	.uleb128 .LBE86-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB88-.Ltext0
+	.uleb128 .LBE88-.Ltext0
+	.byte	0
+.LLRL5:
+	.byte	0x4
+	.uleb128 .LBB81-.Ltext0
+	.uleb128 .LBE81-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB87-.Ltext0
+	.uleb128 .LBE87-.Ltext0
+	.byte	0
+.LLRL7:
+	.byte	0x4
+	.uleb128 .LBB82-.Ltext0
+	.uleb128 .LBE82-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB85-.Ltext0
+	.uleb128 .LBE85-.Ltext0
+	.byte	0
+.LLRL14:
+	.byte	0x4
+	.uleb128 .LBB102-.Ltext0
+	.uleb128 .LBE102-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB108-.Ltext0
+	.uleb128 .LBE108-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB129-.Ltext0
+	.uleb128 .LBE129-.Ltext0
+	.byte	0
+.LLRL21:
+	.byte	0x4
+	.uleb128 .LBB109-.Ltext0
+	.uleb128 .LBE109-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB128-.Ltext0
+	.uleb128 .LBE128-.Ltext0
+	.byte	0
+.LLRL23:
+	.byte	0x4
+	.uleb128 .LBB110-.Ltext0
+	.uleb128 .LBE110-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB113-.Ltext0
+	.uleb128 .LBE113-.Ltext0
+	.byte	0
+.LLRL27:
+	.byte	0x4
+	.uleb128 .LBB114-.Ltext0
+	.uleb128 .LBE114-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB118-.Ltext0
+	.uleb128 .LBE118-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB125-.Ltext0
+	.uleb128 .LBE125-.Ltext0
+	.byte	0
+.LLRL32:
+	.byte	0x4
+	.uleb128 .LBB119-.Ltext0
+	.uleb128 .LBE119-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB126-.Ltext0
+	.uleb128 .LBE126-.Ltext0
+	.byte	0
+.LLRL35:
+	.byte	0x4
+	.uleb128 .LBB122-.Ltext0
+	.uleb128 .LBE122-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB127-.Ltext0
+	.uleb128 .LBE127-.Ltext0
+	.byte	0
+.LLRL40:
+	.byte	0x4
+	.uleb128 .LBB145-.Ltext0
+	.uleb128 .LBE145-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB151-.Ltext0
+	.uleb128 .LBE151-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB152-.Ltext0
+	.uleb128 .LBE152-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB153-.Ltext0
+	.uleb128 .LBE153-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB154-.Ltext0
+	.uleb128 .LBE154-.Ltext0
+	.byte	0
+.LLRL42:
+	.byte	0x4
+	.uleb128 .LBB155-.Ltext0
+	.uleb128 .LBE155-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB159-.Ltext0
+	.uleb128 .LBE159-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB163-.Ltext0
+	.uleb128 .LBE163-.Ltext0
+	.byte	0
+.LLRL45:
+	.byte	0x4
+	.uleb128 .LBB160-.Ltext0
+	.uleb128 .LBE160-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB164-.Ltext0
+	.uleb128 .LBE164-.Ltext0
+	.byte	0
+.LLRL50:
+	.byte	0x4
+	.uleb128 .LBB167-.Ltext0
+	.uleb128 .LBE167-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB211-.Ltext0
+	.uleb128 .LBE211-.Ltext0
+	.byte	0
+.LLRL52:
+	.byte	0x4
+	.uleb128 .LBB168-.Ltext0
+	.uleb128 .LBE168-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB203-.Ltext0
+	.uleb128 .LBE203-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB204-.Ltext0
+	.uleb128 .LBE204-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB205-.Ltext0
+	.uleb128 .LBE205-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB206-.Ltext0
+	.uleb128 .LBE206-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB207-.Ltext0
+	.uleb128 .LBE207-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB208-.Ltext0
+	.uleb128 .LBE208-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB209-.Ltext0
+	.uleb128 .LBE209-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB210-.Ltext0
+	.uleb128 .LBE210-.Ltext0
+	.byte	0
+.LLRL55:
+	.byte	0x4
+	.uleb128 .LBB169-.Ltext0
+	.uleb128 .LBE169-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB187-.Ltext0
+	.uleb128 .LBE187-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB188-.Ltext0
+	.uleb128 .LBE188-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB189-.Ltext0
+	.uleb128 .LBE189-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB190-.Ltext0
+	.uleb128 .LBE190-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB191-.Ltext0
+	.uleb128 .LBE191-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB192-.Ltext0
+	.uleb128 .LBE192-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB193-.Ltext0
+	.uleb128 .LBE193-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB194-.Ltext0
+	.uleb128 .LBE194-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB195-.Ltext0
+	.uleb128 .LBE195-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB196-.Ltext0
+	.uleb128 .LBE196-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB197-.Ltext0
+	.uleb128 .LBE197-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB198-.Ltext0
+	.uleb128 .LBE198-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB199-.Ltext0
+	.uleb128 .LBE199-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB200-.Ltext0
+	.uleb128 .LBE200-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB201-.Ltext0
+	.uleb128 .LBE201-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB202-.Ltext0
+	.uleb128 .LBE202-.Ltext0
+	.byte	0
+.LLRL63:
+	.byte	0x4
+	.uleb128 .LBB231-.Ltext0
+	.uleb128 .LBE231-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB243-.Ltext0
+	.uleb128 .LBE243-.Ltext0
+	.byte	0
+.LLRL68:
+	.byte	0x4
+	.uleb128 .LBB233-.Ltext0
+	.uleb128 .LBE233-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB239-.Ltext0
+	.uleb128 .LBE239-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB241-.Ltext0
+	.uleb128 .LBE241-.Ltext0
+	.byte	0
+.LLRL70:
+	.byte	0x4
+	.uleb128 .LBB234-.Ltext0
+	.uleb128 .LBE234-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB240-.Ltext0
+	.uleb128 .LBE240-.Ltext0
+	.byte	0
+.LLRL72:
+	.byte	0x4
+	.uleb128 .LBB235-.Ltext0
+	.uleb128 .LBE235-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB238-.Ltext0
+	.uleb128 .LBE238-.Ltext0
+	.byte	0
+.LLRL74:
+	.byte	0x4
+	.uleb128 .LBB244-.Ltext0
+	.uleb128 .LBE244-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB251-.Ltext0
+	.uleb128 .LBE251-.Ltext0
+	.byte	0
+.LLRL80:
+	.byte	0x4
+	.uleb128 .LBB246-.Ltext0
+	.uleb128 .LBE246-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB247-.Ltext0
+	.uleb128 .LBE247-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB248-.Ltext0
+	.uleb128 .LBE248-.Ltext0
+	.byte	0
+.LLRL83:
+	.byte	0x4
+	.uleb128 .LBB270-.Ltext0
+	.uleb128 .LBE270-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB288-.Ltext0
+	.uleb128 .LBE288-.Ltext0
+	.byte	0
+.LLRL89:
+	.byte	0x4
+	.uleb128 .LBB272-.Ltext0
+	.uleb128 .LBE272-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB285-.Ltext0
+	.uleb128 .LBE285-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB286-.Ltext0
+	.uleb128 .LBE286-.Ltext0
+	.byte	0
+.LLRL94:
+	.byte	0x4
+	.uleb128 .LBB274-.Ltext0
+	.uleb128 .LBE274-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB279-.Ltext0
+	.uleb128 .LBE279-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB281-.Ltext0
+	.uleb128 .LBE281-.Ltext0
+	.byte	0
+.LLRL96:
+	.byte	0x4
+	.uleb128 .LBB275-.Ltext0
+	.uleb128 .LBE275-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB278-.Ltext0
+	.uleb128 .LBE278-.Ltext0
+	.byte	0
+.LLRL98:
+	.byte	0x4
+	.uleb128 .LBB280-.Ltext0
+	.uleb128 .LBE280-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB282-.Ltext0
+	.uleb128 .LBE282-.Ltext0
+	.byte	0
+.LLRL106:
+	.byte	0x4
+	.uleb128 .LBB309-.Ltext0
+	.uleb128 .LBE309-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB310-.Ltext0
+	.uleb128 .LBE310-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB311-.Ltext0
+	.uleb128 .LBE311-.Ltext0
+	.byte	0
+.LLRL113:
+	.byte	0x4
+	.uleb128 .LBB317-.Ltext0
+	.uleb128 .LBE317-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB328-.Ltext0
+	.uleb128 .LBE328-.Ltext0
+	.byte	0
+.LLRL119:
+	.byte	0x4
+	.uleb128 .LBB319-.Ltext0
+	.uleb128 .LBE319-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB325-.Ltext0
+	.uleb128 .LBE325-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB326-.Ltext0
+	.uleb128 .LBE326-.Ltext0
+	.byte	0
+.LLRL125:
+	.byte	0x4
+	.uleb128 .LBB321-.Ltext0
+	.uleb128 .LBE321-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB322-.Ltext0
+	.uleb128 .LBE322-.Ltext0
+	.byte	0
+.LLRL129:
+	.byte	0x4
+	.uleb128 .LBB348-.Ltext0
+	.uleb128 .LBE348-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB361-.Ltext0
+	.uleb128 .LBE361-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB362-.Ltext0
+	.uleb128 .LBE362-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB363-.Ltext0
+	.uleb128 .LBE363-.Ltext0
+	.byte	0
+.LLRL131:
+	.byte	0x4
+	.uleb128 .LBB350-.Ltext0
+	.uleb128 .LBE350-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB355-.Ltext0
+	.uleb128 .LBE355-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB356-.Ltext0
+	.uleb128 .LBE356-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB357-.Ltext0
+	.uleb128 .LBE357-.Ltext0
+	.byte	0
+.LLRL137:
+	.byte	0x4
+	.uleb128 .LBB364-.Ltext0
+	.uleb128 .LBE364-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB396-.Ltext0
+	.uleb128 .LBE396-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB397-.Ltext0
+	.uleb128 .LBE397-.Ltext0
+	.byte	0
+.LLRL146:
+	.byte	0x4
+	.uleb128 .LBB368-.Ltext0
+	.uleb128 .LBE368-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB393-.Ltext0
+	.uleb128 .LBE393-.Ltext0
+	.byte	0
+.LLRL151:
+	.byte	0x4
+	.uleb128 .LBB371-.Ltext0
+	.uleb128 .LBE371-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB392-.Ltext0
+	.uleb128 .LBE392-.Ltext0
+	.byte	0
+.LLRL153:
+	.byte	0x4
+	.uleb128 .LBB372-.Ltext0
+	.uleb128 .LBE372-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB375-.Ltext0
+	.uleb128 .LBE375-.Ltext0
+	.byte	0
+.LLRL157:
+	.byte	0x4
+	.uleb128 .LBB376-.Ltext0
+	.uleb128 .LBE376-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB381-.Ltext0
+	.uleb128 .LBE381-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB382-.Ltext0
+	.uleb128 .LBE382-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB389-.Ltext0
+	.uleb128 .LBE389-.Ltext0
+	.byte	0
+.LLRL162:
+	.byte	0x4
+	.uleb128 .LBB383-.Ltext0
+	.uleb128 .LBE383-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB390-.Ltext0
+	.uleb128 .LBE390-.Ltext0
+	.byte	0
+.LLRL165:
+	.byte	0x4
+	.uleb128 .LBB386-.Ltext0
+	.uleb128 .LBE386-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB391-.Ltext0
+	.uleb128 .LBE391-.Ltext0
+	.byte	0
+.LLRL170:
+	.byte	0x4
+	.uleb128 .LBB418-.Ltext0
+	.uleb128 .LBE418-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB434-.Ltext0
+	.uleb128 .LBE434-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB435-.Ltext0
+	.uleb128 .LBE435-.Ltext0
+	.byte	0
+.LLRL172:
+	.byte	0x4
+	.uleb128 .LBB420-.Ltext0
+	.uleb128 .LBE420-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB427-.Ltext0
+	.uleb128 .LBE427-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB428-.Ltext0
+	.uleb128 .LBE428-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB429-.Ltext0
+	.uleb128 .LBE429-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB430-.Ltext0
+	.uleb128 .LBE430-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB431-.Ltext0
+	.uleb128 .LBE431-.Ltext0
+	.byte	0
+.LLRL178:
+	.byte	0x4
+	.uleb128 .LBB436-.Ltext0
+	.uleb128 .LBE436-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB471-.Ltext0
+	.uleb128 .LBE471-.Ltext0
+	.byte	0
+.LLRL180:
+	.byte	0x4
+	.uleb128 .LBB437-.Ltext0
+	.uleb128 .LBE437-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB470-.Ltext0
+	.uleb128 .LBE470-.Ltext0
+	.byte	0
+.LLRL186:
+	.byte	0x4
+	.uleb128 .LBB439-.Ltext0
+	.uleb128 .LBE439-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB466-.Ltext0
+	.uleb128 .LBE466-.Ltext0
+	.byte	0
+.LLRL188:
+	.byte	0x4
+	.uleb128 .LBB440-.Ltext0
+	.uleb128 .LBE440-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB443-.Ltext0
+	.uleb128 .LBE443-.Ltext0
+	.byte	0
+.LLRL195:
+	.byte	0x4
+	.uleb128 .LBB446-.Ltext0
+	.uleb128 .LBE446-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB451-.Ltext0
+	.uleb128 .LBE451-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB452-.Ltext0
+	.uleb128 .LBE452-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB461-.Ltext0
+	.uleb128 .LBE461-.Ltext0
+	.byte	0
+.LLRL200:
+	.byte	0x4
+	.uleb128 .LBB453-.Ltext0
+	.uleb128 .LBE453-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB462-.Ltext0
+	.uleb128 .LBE462-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB464-.Ltext0
+	.uleb128 .LBE464-.Ltext0
+	.byte	0
+.LLRL203:
+	.byte	0x4
+	.uleb128 .LBB457-.Ltext0
+	.uleb128 .LBE457-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB463-.Ltext0
+	.uleb128 .LBE463-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB465-.Ltext0
+	.uleb128 .LBE465-.Ltext0
+	.byte	0
+.Ldebug_ranges3:
+	.section	.debug_line,"",@progbits
+.Ldebug_line0:
+	.section	.debug_str,"MS",@progbits,1
+.LASF14:
+	.string	"__off_t"
+.LASF18:
+	.string	"_IO_read_ptr"
+.LASF30:
+	.string	"_chain"
+.LASF86:
+	.string	"blake2b_init_words"
+.LASF81:
+	.string	"salt"
+.LASF9:
+	.string	"size_t"
+.LASF36:
+	.string	"_shortbuf"
+.LASF10:
+	.string	"__uint8_t"
+.LASF89:
+	.string	"blake2b_final"
+.LASF76:
+	.string	"stream"
+.LASF24:
+	.string	"_IO_buf_base"
+.LASF109:
+	.string	"__builtin_memset"
+.LASF56:
+	.string	"long long unsigned int"
+.LASF99:
+	.string	"bbstate_inc_t"
+.LASF58:
+	.string	"blake2s_sigma"
+.LASF106:
+	.string	"to_le32"
+.LASF39:
+	.string	"_codecvt"
+.LASF83:
+	.string	"dig_len"
+.LASF4:
+	.string	"long long int"
+.LASF8:
+	.string	"signed char"
+.LASF53:
+	.string	"buf_len"
+.LASF87:
+	.string	"key_block"
+.LASF31:
+	.string	"_fileno"
+.LASF19:
+	.string	"_IO_read_end"
+.LASF3:
+	.string	"long int"
+.LASF17:
+	.string	"_flags"
+.LASF88:
+	.string	"blake2b"
+.LASF25:
+	.string	"_IO_buf_end"
+.LASF34:
+	.string	"_cur_column"
+.LASF95:
+	.string	"src_off"
+.LASF48:
+	.string	"_IO_codecvt"
+.LASF33:
+	.string	"_old_offset"
+.LASF38:
+	.string	"_offset"
+.LASF60:
+	.string	"blake2b_lanes"
+.LASF82:
+	.string	"key_len"
+.LASF12:
+	.string	"__uint32_t"
+.LASF67:
+	.string	"lanes"
+.LASF84:
+	.string	"blake2b_init_salted"
+.LASF102:
+	.string	"blake2b_compress"
+.LASF62:
+	.string	"blake2b_kernel"
+.LASF47:
+	.string	"_IO_marker"
+.LASF5:
+	.string	"unsigned int"
+.LASF94:
+	.string	"rest"
+.LASF42:
+	.string	"_freeres_buf"
+.LASF85:
+	.string	"blake2b_init"
+.LASF2:
+	.string	"long unsigned int"
+.LASF72:
+	.string	"ferror"
+.LASF69:
+	.string	"blake2b_salt_def"
+.LASF104:
+	.string	"read_le64"
+.LASF22:
+	.string	"_IO_write_ptr"
+.LASF63:
+	.string	"name"
+.LASF100:
+	.string	"write_le64"
+.LASF97:
+	.string	"bbstate_buf_add"
+.LASF7:
+	.string	"short unsigned int"
+.LASF26:
+	.string	"_IO_save_base"
+.LASF92:
+	.string	"digest"
+.LASF108:
+	.string	"__builtin_memcpy"
+.LASF37:
+	.string	"_lock"
+.LASF68:
+	.string	"compress_lanes"
+.LASF32:
+	.string	"_flags2"
+.LASF44:
+	.string	"_mode"
+.LASF59:
+	.string	"blake2b_ctx"
+.LASF110:
+	.string	"GNU C99 12.2.0 -mtune=generic -march=x86-64 -g -O3 -std=c99 -fasynchronous-unwind-tables"
+.LASF66:
+	.string	"compress_blocks"
+.LASF96:
+	.string	"nblocks"
+.LASF93:
+	.string	"blake2b_update"
+.LASF23:
+	.string	"_IO_write_end"
+.LASF52:
+	.string	"uint64_t"
+.LASF111:
+	.string	"_IO_lock_t"
+.LASF61:
+	.string	"_IO_FILE"
+.LASF112:
+	.string	"_out"
+.LASF13:
+	.string	"__uint64_t"
+.LASF29:
+	.string	"_markers"
+.LASF107:
+	.string	"_one"
+.LASF6:
+	.string	"unsigned char"
+.LASF11:
+	.string	"short int"
+.LASF49:
+	.string	"_IO_wide_data"
+.LASF35:
+	.string	"_vtable_offset"
+.LASF46:
+	.string	"FILE"
+.LASF73:
+	.string	"fread"
+.LASF77:
+	.string	"blake2b_kern"
+.LASF71:
+	.string	"blake2b_pers_def"
+.LASF54:
+	.string	"digest_len"
+.LASF51:
+	.string	"uint32_t"
+.LASF16:
+	.string	"char"
+.LASF15:
+	.string	"__off64_t"
+.LASF80:
+	.string	"blake2b_init_keyed"
+.LASF20:
+	.string	"_IO_read_base"
+.LASF75:
+	.string	"memcpy"
+.LASF28:
+	.string	"_IO_save_end"
+.LASF55:
+	.string	"last_node"
+.LASF64:
+	.string	"usable"
+.LASF98:
+	.string	"bbstate_buf_zeropad"
+.LASF43:
+	.string	"__pad5"
+.LASF45:
+	.string	"_unused2"
+.LASF74:
+	.string	"memset"
+.LASF101:
+	.string	"blake2b_compress_blocks"
+.LASF50:
+	.string	"uint8_t"
+.LASF27:
+	.string	"_IO_backup_base"
+.LASF70:
+	.string	"blake2b_iv"
+.LASF78:
+	.string	"read"
+.LASF65:
+	.string	"compress"
+.LASF79:
+	.string	"blake2b_file"
+.LASF91:
+	.string	"bbstate_output_digest"
+.LASF41:
+	.string	"_freeres_list"
+.LASF40:
+	.string	"_wide_data"
+.LASF90:
+	.string	"blake2b_init_ex"
+.LASF105:
+	.string	"read_le32"
+.LASF21:
+	.string	"_IO_write_base"
+.LASF103:
+	.string	"write_le32"
+.LASF57:
+	.string	"blake2s_iv"
+	.section	.debug_line_str,"MS",@progbits,1
+.LASF1:
+	.string	"/root/repo"
+.LASF0:
+	.string	"blake2b.c"
+	.ident	"GCC: (Debian 12.2.0-14+deb12u1) 12.2.0"
+	.section	.note.GNU-stack,"",@progbits
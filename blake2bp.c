@@ -0,0 +1,207 @@
+#include <string.h>
+
+#include "blake2s.h"
+#include "blake2b.h"
+#include "blake2bp.h"
+#include "blake2s-internal.h"
+#include "blake2b-internal.h"
+
+/* BLAKE2bp
+ *
+ * Leaf i is a BLAKE2b node with fanout 4, depth 2, node offset i and
+ * node depth 0, and hashes blocks i, i+4, i+8, ... of the input. The
+ * root has node depth 1. The last leaf and the root are last nodes.
+ *
+ * As in blake2sp.c, each stride compresses one block in every leaf
+ * with a single call to the multi-buffer kernel, 4x64 bits wide on
+ * AVX2, straight from the input. The blocks left for blake2bp_final()
+ * go through it too, a call for each block position.
+ */
+#define BBP_LEAVES BLAKE2BP_LEAVES
+#define BBP_STRIDE BLAKE2BP_STRIDE
+#define BBP_HOLD   BLAKE2BP_BUF
+#define BBP_ALL    ((1u << BBP_LEAVES) - 1)
+
+static int bbp_init(struct blake2bp_ctx *ctx, const void *salt,
+                    const void *key, unsigned key_len, unsigned dig_len)
+{
+    u64 P[B2B_PARAM_WORDS] = { B2B_PARAM0(dig_len,key_len,BBP_LEAVES,2,0), 0,
+                               B2B_PARAM2(1, BLAKE2B_LEN), 0 };
+
+    if (key_len > BLAKE2B_KEY_LEN)
+        return -1;
+    if (dig_len < 1 || dig_len > BLAKE2B_LEN)
+        return -1;
+
+    /* only the leaves absorb the key; the root just has its length */
+    blake2b_init_words(&ctx->R, P, salt, NULL, 0);
+    ctx->R.last_node = 1;
+    P[2] = B2B_PARAM2(0, BLAKE2B_LEN);
+    for (unsigned i = 0; i < BBP_LEAVES; i++) {
+        P[1] = i;
+        blake2b_init_words(&ctx->S[i], P, salt, key, key_len);
+        ctx->S[i].digest_len = BLAKE2B_LEN; /* inner length */
+    }
+    ctx->S[BBP_LEAVES-1].last_node = 1;
+    ctx->buf_len = 0;
+    return 0;
+}
+
+int blake2bp_init_keyed(struct blake2bp_ctx *ctx, const void *salt,
+                        const void *key, unsigned key_len, unsigned dig_len)
+{
+    if (key_len < 1)
+        return -1;
+    return bbp_init(ctx, salt, key, key_len, dig_len);
+}
+
+int blake2bp_init_salted(struct blake2bp_ctx *ctx, const void *salt,
+                         unsigned dig_len)
+{
+    return bbp_init(ctx, salt, NULL, 0, dig_len);
+}
+
+void blake2bp_init(struct blake2bp_ctx *ctx)
+{
+    bbp_init(ctx, NULL, NULL, 0, BLAKE2B_LEN);
+}
+
+/* bbp_strides: compress `n` strides at `src` into the leaves, none of
+ * them final */
+static void bbp_strides(struct blake2bp_ctx *ctx, const u8 *src, size_t n)
+{
+    struct blake2b_lanes L;
+    const void *m[BBP_LEAVES];
+
+    for (unsigned i = 0; i < BBP_LEAVES; i++)
+        bblane_load(&L, i, &ctx->S[i]);
+    /* keyed leaves hold their key block until now */
+    if (ctx->S[0].buf_len) {
+        for (unsigned i = 0; i < BBP_LEAVES; i++) {
+            m[i] = ctx->S[i].buf;
+            ctx->S[i].buf_len = 0;
+            bblane_inc_t(&L, i, BLAKE2B_BLOCK);
+        }
+        blake2b_compress_lanes(&L, m, BBP_ALL);
+    }
+    for (; n; n--, src += BBP_STRIDE) {
+        for (unsigned i = 0; i < BBP_LEAVES; i++) {
+            m[i] = src + i*BLAKE2B_BLOCK;
+            bblane_inc_t(&L, i, BLAKE2B_BLOCK);
+        }
+        blake2b_compress_lanes(&L, m, BBP_ALL);
+    }
+    for (unsigned i = 0; i < BBP_LEAVES; i++)
+        bblane_store(&L, i, &ctx->S[i]);
+    memset(&L, 0, sizeof(L));
+}
+
+void blake2bp_update(struct blake2bp_ctx *ctx, const void *src, size_t len)
+{
+    const u8 *in = src;
+
+    /* strides through the buffer, while it has any */
+    while (ctx->buf_len && ctx->buf_len + len > BBP_HOLD) {
+        if (ctx->buf_len < BBP_STRIDE) {
+            size_t fill = BBP_STRIDE - ctx->buf_len;
+            memcpy(ctx->buf + ctx->buf_len, in, fill);
+            ctx->buf_len = BBP_STRIDE;
+            in += fill;
+            len -= fill;
+        }
+        bbp_strides(ctx, ctx->buf, 1);
+        ctx->buf_len -= BBP_STRIDE;
+        memmove(ctx->buf, ctx->buf + BBP_STRIDE, ctx->buf_len);
+    }
+    /* then straight from `src`, in one run, holding back the tail */
+    if (!ctx->buf_len && len > BBP_HOLD) {
+        size_t n = (len - BBP_HOLD - 1) / BBP_STRIDE + 1;
+        bbp_strides(ctx, in, n);
+        in += n * BBP_STRIDE;
+        len -= n * BBP_STRIDE;
+    }
+    memcpy(ctx->buf + ctx->buf_len, in, len);
+    ctx->buf_len += len;
+}
+
+/* bbp_slice: length of block `j` of the `len` buffered bytes */
+static size_t bbp_slice(size_t len, unsigned j)
+{
+    if (len <= j*BLAKE2B_BLOCK)
+        return 0;
+    len -= j*BLAKE2B_BLOCK;
+    return len < BLAKE2B_BLOCK ? len : BLAKE2B_BLOCK;
+}
+
+void blake2bp_final(struct blake2bp_ctx *ctx, unsigned char *out)
+{
+    u8 hash[BBP_LEAVES][BLAKE2B_LEN];
+    u8 last[BBP_LEAVES][BLAKE2B_BLOCK];
+    const void *blk[BBP_LEAVES][3];
+    size_t len[BBP_LEAVES][3];
+    unsigned n[BBP_LEAVES], rounds = 0;
+    struct blake2b_lanes L;
+    const void *m[BBP_LEAVES];
+
+    /* leaf i has up to three blocks left: a held key block, then
+     * buffered blocks i and i+4. The last of them is final, zero padded
+     * in last[i], and a leaf with none ends on an empty block. */
+    for (unsigned i = 0; i < BBP_LEAVES; i++) {
+        n[i] = 0;
+        if (ctx->S[i].buf_len) {
+            blk[i][n[i]] = ctx->S[i].buf;
+            len[i][n[i]++] = BLAKE2B_BLOCK;
+        }
+        for (unsigned j = i; j < 2*BBP_LEAVES; j += BBP_LEAVES) {
+            size_t k = bbp_slice(ctx->buf_len, j);
+            if (k) {
+                blk[i][n[i]] = ctx->buf + j*BLAKE2B_BLOCK;
+                len[i][n[i]++] = k;
+            }
+        }
+        memset(last[i], 0, BLAKE2B_BLOCK);
+        if (n[i])
+            memcpy(last[i], blk[i][n[i]-1], len[i][n[i]-1]);
+        else
+            len[i][n[i]++] = 0;
+        blk[i][n[i]-1] = last[i];
+        if (n[i] > rounds)
+            rounds = n[i];
+        bblane_load(&L, i, &ctx->S[i]);
+    }
+    /* then block r of every leaf that has one, in one kernel call */
+    for (unsigned r = 0; r < rounds; r++) {
+        unsigned mask = 0;
+        for (unsigned i = 0; i < BBP_LEAVES; i++) {
+            if (r >= n[i])
+                continue;
+            m[i] = blk[i][r];
+            bblane_inc_t(&L, i, len[i][r]);
+            if (r == n[i] - 1) {
+                L.f[0][i] = ~0ULL;
+                if (ctx->S[i].last_node)
+                    L.f[1][i] = ~0ULL;
+            }
+            mask |= 1u << i;
+        }
+        blake2b_compress_lanes(&L, m, mask);
+    }
+    for (unsigned i = 0; i < BBP_LEAVES; i++)
+        for (unsigned w = 0; w < 8; w++)
+            write_le64(hash[i] + 8*w, L.H[w][i]);
+
+    blake2b_update(&ctx->R, hash, sizeof(hash));
+    blake2b_final(&ctx->R, out);
+    memset(hash, 0, sizeof(hash));
+    memset(last, 0, sizeof(last));
+    memset(&L, 0, sizeof(L));
+    memset(ctx, 0, sizeof(*ctx));
+}
+
+void blake2bp(unsigned char *out, const void *src, size_t len)
+{
+    struct blake2bp_ctx ctx;
+    blake2bp_init(&ctx);
+    blake2bp_update(&ctx, src, len);
+    blake2bp_final(&ctx, out);
+}
@@ -0,0 +1,48 @@
+#ifndef BLAKE2BP_H_
+#define BLAKE2BP_H_
+
+#include "blake2b.h"
+
+/* BLAKE2bp: the input is dealt out in 128-byte blocks, round-robin, to
+ * 4 BLAKE2b leaves hashed side by side; a root hashes their digests.
+ * Parameters are as for BLAKE2b, and so is the digest length.
+ */
+#define BLAKE2BP_LEAVES 4
+
+struct blake2bp_ctx;
+
+/* blake2bp_init_keyed: initialize BLAKE2bp with key
+ *
+ * `salt`    must be NULL or BLAKE2B_SALT_LEN bytes
+ * `key_len` must be 1 to BLAKE2B_KEY_LEN
+ * `dig_len` must be 1 to BLAKE2B_LEN
+ *
+ * returns < 0 on parameter error
+ */
+ int blake2bp_init_keyed(struct blake2bp_ctx *ctx, const void *salt,
+                         const void *key, unsigned key_len, unsigned dig_len);
+/* blake2bp_init_salted: like blake2bp_init_keyed
+ * returns < 0 on parameter error
+ */
+ int blake2bp_init_salted(struct blake2bp_ctx *ctx, const void *salt,
+                          unsigned dig_len);
+void blake2bp_init(struct blake2bp_ctx *ctx);
+
+void blake2bp_update(struct blake2bp_ctx *ctx, const void *src, size_t len);
+void blake2bp_final(struct blake2bp_ctx *ctx, unsigned char *out);
+
+void blake2bp(unsigned char *out, const void *src, size_t len);
+
+
+/* Held back input, as for BLAKE2sp */
+#define BLAKE2BP_STRIDE (BLAKE2BP_LEAVES * BLAKE2B_BLOCK)
+#define BLAKE2BP_BUF    (2 * BLAKE2BP_STRIDE - BLAKE2B_BLOCK)
+
+struct blake2bp_ctx {
+    struct blake2b_ctx S[BLAKE2BP_LEAVES];
+    struct blake2b_ctx R;
+    unsigned char buf[BLAKE2BP_BUF];
+    unsigned buf_len;
+} ALIGN(32);
+
+#endif /* BLAKE2BP_H_ */
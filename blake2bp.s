@@ -0,0 +1,12485 @@
+	.file	"blake2bp.c"
+# GNU C99 (Debian 12.2.0-14+deb12u1) version 12.2.0 (x86_64-linux-gnu)
+#	compiled by GNU C version 12.2.0, GMP version 6.2.1, MPFR version 4.2.0, MPC version 1.3.1, isl version isl-0.25-GMP
+
+# GGC heuristics: --param ggc-min-expand=100 --param ggc-min-heapsize=131072
+# options passed: -mtune=generic -march=x86-64 -g -O3 -std=c99 -fasynchronous-unwind-tables
+	.text
+.Ltext0:
+	.file 0 "/root/repo" "blake2bp.c"
+	.p2align 4
+	.type	bbp_strides, @function
+bbp_strides:
+.LVL0:
+.LFB29:
+	.file 1 "blake2bp.c"
+	.loc 1 72 1 view -0
+	.cfi_startproc
+	.loc 1 73 5 view .LVU1
+	.loc 1 74 5 view .LVU2
+	.loc 1 76 5 view .LVU3
+.LBB49:
+	.loc 1 76 10 view .LVU4
+	.loc 1 76 28 view .LVU5
+.LBB50:
+.LBB51:
+.LBB52:
+	.file 2 "blake2b-internal.h"
+	.loc 2 91 28 view .LVU6
+	.loc 2 92 9 view .LVU7
+.LBE52:
+.LBE51:
+.LBE50:
+.LBE49:
+# blake2bp.c:72: {
+	.loc 1 72 1 is_stmt 0 view .LVU8
+	pushq	%rbp	#
+	.cfi_def_cfa_offset 16
+	.cfi_offset 6, -16
+	movq	%rsp, %rbp	#,
+	.cfi_def_cfa_register 6
+	pushq	%r15	#
+	pushq	%r14	#
+	pushq	%r13	#
+	.cfi_offset 15, -24
+	.cfi_offset 14, -32
+	.cfi_offset 13, -40
+	movq	%rdx, %r13	# tmp322, n
+	pushq	%r12	#
+	.cfi_offset 12, -48
+	movq	%rsi, %r12	# tmp321, src
+	pushq	%rbx	#
+	.cfi_offset 3, -56
+	movq	%rdi, %rbx	# tmp320, ctx
+	andq	$-32, %rsp	#,
+	subq	$416, %rsp	#,
+.LBB73:
+.LBB68:
+.LBB63:
+.LBB53:
+# blake2b-internal.h:92:         L->H[i][l] = ctx->H[i];
+	.loc 2 92 28 view .LVU9
+	movdqa	(%rdi), %xmm9	# MEM <const vector(2) long unsigned int> [(const struct blake2b_ctx *)ctx_19(D)], vect__394.69
+	movdqa	512(%rdi), %xmm8	# MEM <const vector(2) long unsigned int> [(const struct blake2b_ctx *)ctx_19(D) + 512B], vect__394.101
+	movdqa	192(%rdi), %xmm11	# MEM <const vector(2) long unsigned int> [(const struct blake2b_ctx *)ctx_19(D) + 192B], vect__394.81
+	movdqa	16(%rdi), %xmm7	# MEM <const vector(2) long unsigned int> [(const struct blake2b_ctx *)ctx_19(D) + 16B], vect__394.70
+	movdqa	%xmm9, %xmm14	# vect__394.69, vect__394.131
+	movdqa	32(%rdi), %xmm5	# MEM <const vector(2) long unsigned int> [(const struct blake2b_ctx *)ctx_19(D) + 32B], vect__394.71
+	punpcklqdq	256(%rdi), %xmm14	# MEM <const vector(2) long unsigned int> [(const struct blake2b_ctx *)ctx_19(D) + 256B], vect__394.131
+	movdqa	704(%rdi), %xmm10	# MEM <const vector(2) long unsigned int> [(const struct blake2b_ctx *)ctx_19(D) + 704B], vect__394.113
+	movdqa	48(%rdi), %xmm3	# MEM <const vector(2) long unsigned int> [(const struct blake2b_ctx *)ctx_19(D) + 48B], vect__394.72
+	movdqa	%xmm11, %xmm13	# vect__394.81, vect__394.147
+	punpckhqdq	256(%rdi), %xmm9	# MEM <const vector(2) long unsigned int> [(const struct blake2b_ctx *)ctx_19(D) + 256B], vect__394.133
+# blake2b-internal.h:92:         L->H[i][l] = ctx->H[i];
+	.loc 2 92 20 view .LVU10
+	movaps	%xmm14, 32(%rsp)	# vect__394.131, MEM <vector(2) long unsigned int> [(long unsigned int *)&L]
+# blake2b-internal.h:92:         L->H[i][l] = ctx->H[i];
+	.loc 2 92 28 view .LVU11
+	movdqa	%xmm8, %xmm14	# vect__394.101, vect__394.132
+	punpcklqdq	768(%rdi), %xmm14	# MEM <const vector(2) long unsigned int> [(const struct blake2b_ctx *)ctx_19(D) + 768B], vect__394.132
+	movdqa	208(%rdi), %xmm1	# MEM <const vector(2) long unsigned int> [(const struct blake2b_ctx *)ctx_19(D) + 208B], vect__394.82
+	movdqa	528(%rdi), %xmm6	# MEM <const vector(2) long unsigned int> [(const struct blake2b_ctx *)ctx_19(D) + 528B], vect__394.102
+	movdqa	%xmm10, %xmm12	# vect__394.113, vect__394.148
+	movdqa	544(%rdi), %xmm4	# MEM <const vector(2) long unsigned int> [(const struct blake2b_ctx *)ctx_19(D) + 544B], vect__394.103
+.LBE53:
+# blake2b-internal.h:93:     L->t[0][l] = ctx->t[0];
+	.loc 2 93 24 view .LVU12
+	movq	192(%rdi), %rsi	# MEM <struct blake2bp_ctx> [(const struct blake2b_ctx *)ctx_19(D)].S[0].t[0], _410
+.LVL1:
+.LBB54:
+# blake2b-internal.h:92:         L->H[i][l] = ctx->H[i];
+	.loc 2 92 20 view .LVU13
+	movaps	%xmm14, 48(%rsp)	# vect__394.132, MEM <vector(2) long unsigned int> [(long unsigned int *)&L + 16B]
+# blake2b-internal.h:92:         L->H[i][l] = ctx->H[i];
+	.loc 2 92 28 view .LVU14
+	movdqa	560(%rdi), %xmm2	# MEM <const vector(2) long unsigned int> [(const struct blake2b_ctx *)ctx_19(D) + 560B], vect__394.104
+.LBE54:
+# blake2b-internal.h:93:     L->t[0][l] = ctx->t[0];
+	.loc 2 93 24 view .LVU15
+	movq	448(%rdi), %rcx	# MEM <struct blake2bp_ctx> [(const struct blake2b_ctx *)ctx_19(D)].S[1].t[0], _439
+.LBB55:
+# blake2b-internal.h:92:         L->H[i][l] = ctx->H[i];
+	.loc 2 92 28 view .LVU16
+	movdqa	720(%rdi), %xmm0	# MEM <const vector(2) long unsigned int> [(const struct blake2b_ctx *)ctx_19(D) + 720B], vect__394.114
+.LBE55:
+# blake2b-internal.h:93:     L->t[0][l] = ctx->t[0];
+	.loc 2 93 24 view .LVU17
+	movq	704(%rdi), %rdx	# MEM <struct blake2bp_ctx> [(const struct blake2b_ctx *)ctx_19(D)].S[2].t[0], _468
+.LVL2:
+.LBB56:
+# blake2b-internal.h:92:         L->H[i][l] = ctx->H[i];
+	.loc 2 92 28 view .LVU18
+	punpcklqdq	448(%rdi), %xmm13	# MEM <const vector(2) long unsigned int> [(const struct blake2b_ctx *)ctx_19(D) + 448B], vect__394.147
+.LBE56:
+# blake2b-internal.h:93:     L->t[0][l] = ctx->t[0];
+	.loc 2 93 24 view .LVU19
+	movq	960(%rdi), %rax	# MEM <struct blake2bp_ctx> [(const struct blake2b_ctx *)ctx_19(D)].S[3].t[0], _37
+.LBB57:
+# blake2b-internal.h:92:         L->H[i][l] = ctx->H[i];
+	.loc 2 92 28 view .LVU20
+	punpcklqdq	960(%rdi), %xmm12	# MEM <const vector(2) long unsigned int> [(const struct blake2b_ctx *)ctx_19(D) + 960B], vect__394.148
+	punpckhqdq	448(%rdi), %xmm11	# MEM <const vector(2) long unsigned int> [(const struct blake2b_ctx *)ctx_19(D) + 448B], vect__394.149
+	punpckhqdq	960(%rdi), %xmm10	# MEM <const vector(2) long unsigned int> [(const struct blake2b_ctx *)ctx_19(D) + 960B], vect__394.150
+	.loc 2 91 34 is_stmt 1 view .LVU21
+.LVL3:
+	.loc 2 91 28 view .LVU22
+	.loc 2 92 9 view .LVU23
+	.loc 2 91 34 view .LVU24
+	.loc 2 91 28 view .LVU25
+	.loc 2 92 9 view .LVU26
+	.loc 2 91 34 view .LVU27
+	.loc 2 91 28 view .LVU28
+	.loc 2 92 9 view .LVU29
+	.loc 2 91 34 view .LVU30
+	.loc 2 91 28 view .LVU31
+	.loc 2 92 9 view .LVU32
+	.loc 2 91 34 view .LVU33
+	.loc 2 91 28 view .LVU34
+	.loc 2 92 9 view .LVU35
+	.loc 2 91 34 view .LVU36
+	.loc 2 91 28 view .LVU37
+	.loc 2 92 9 view .LVU38
+	.loc 2 91 34 view .LVU39
+	.loc 2 91 28 view .LVU40
+	.loc 2 92 9 view .LVU41
+	.loc 2 91 34 view .LVU42
+	.loc 2 91 28 view .LVU43
+.LBE57:
+	.loc 2 93 5 view .LVU44
+	.loc 2 94 5 view .LVU45
+	.loc 2 95 5 view .LVU46
+	.loc 2 96 5 view .LVU47
+	.loc 2 96 5 is_stmt 0 view .LVU48
+.LBE63:
+.LBE68:
+	.loc 1 76 34 is_stmt 1 view .LVU49
+	.loc 1 76 28 view .LVU50
+.LBB69:
+.LBB64:
+.LBB58:
+	.loc 2 91 28 view .LVU51
+	.loc 2 92 9 view .LVU52
+	.loc 2 91 34 view .LVU53
+	.loc 2 91 28 view .LVU54
+	.loc 2 92 9 view .LVU55
+	.loc 2 91 34 view .LVU56
+	.loc 2 91 28 view .LVU57
+	.loc 2 92 9 view .LVU58
+	.loc 2 91 34 view .LVU59
+	.loc 2 91 28 view .LVU60
+	.loc 2 92 9 view .LVU61
+	.loc 2 91 34 view .LVU62
+	.loc 2 91 28 view .LVU63
+	.loc 2 92 9 view .LVU64
+	.loc 2 91 34 view .LVU65
+	.loc 2 91 28 view .LVU66
+	.loc 2 92 9 view .LVU67
+	.loc 2 91 34 view .LVU68
+	.loc 2 91 28 view .LVU69
+	.loc 2 92 9 view .LVU70
+	.loc 2 91 34 view .LVU71
+	.loc 2 91 28 view .LVU72
+	.loc 2 92 9 view .LVU73
+	.loc 2 91 34 view .LVU74
+	.loc 2 91 28 view .LVU75
+.LBE58:
+	.loc 2 93 5 view .LVU76
+	.loc 2 94 5 view .LVU77
+	.loc 2 95 5 view .LVU78
+	.loc 2 96 5 view .LVU79
+	.loc 2 96 5 is_stmt 0 view .LVU80
+.LBE64:
+.LBE69:
+	.loc 1 76 34 is_stmt 1 view .LVU81
+	.loc 1 76 28 view .LVU82
+.LBB70:
+.LBB65:
+.LBB59:
+	.loc 2 91 28 view .LVU83
+	.loc 2 92 9 view .LVU84
+	.loc 2 91 34 view .LVU85
+	.loc 2 91 28 view .LVU86
+	.loc 2 92 9 view .LVU87
+	.loc 2 91 34 view .LVU88
+	.loc 2 91 28 view .LVU89
+	.loc 2 92 9 view .LVU90
+	.loc 2 91 34 view .LVU91
+	.loc 2 91 28 view .LVU92
+	.loc 2 92 9 view .LVU93
+	.loc 2 91 34 view .LVU94
+	.loc 2 91 28 view .LVU95
+	.loc 2 92 9 view .LVU96
+	.loc 2 91 34 view .LVU97
+	.loc 2 91 28 view .LVU98
+	.loc 2 92 9 view .LVU99
+	.loc 2 91 34 view .LVU100
+	.loc 2 91 28 view .LVU101
+	.loc 2 92 9 view .LVU102
+	.loc 2 91 34 view .LVU103
+	.loc 2 91 28 view .LVU104
+	.loc 2 92 9 view .LVU105
+	.loc 2 91 34 view .LVU106
+	.loc 2 91 28 view .LVU107
+.LBE59:
+	.loc 2 93 5 view .LVU108
+	.loc 2 94 5 view .LVU109
+	.loc 2 95 5 view .LVU110
+	.loc 2 96 5 view .LVU111
+	.loc 2 96 5 is_stmt 0 view .LVU112
+.LBE65:
+.LBE70:
+	.loc 1 76 34 is_stmt 1 view .LVU113
+	.loc 1 76 28 view .LVU114
+.LBB71:
+.LBB66:
+.LBB60:
+	.loc 2 91 28 view .LVU115
+	.loc 2 92 9 view .LVU116
+	.loc 2 91 34 view .LVU117
+	.loc 2 91 28 view .LVU118
+	.loc 2 92 9 view .LVU119
+	.loc 2 91 34 view .LVU120
+	.loc 2 91 28 view .LVU121
+	.loc 2 92 9 view .LVU122
+	.loc 2 91 34 view .LVU123
+	.loc 2 91 28 view .LVU124
+	.loc 2 92 9 view .LVU125
+	.loc 2 91 34 view .LVU126
+	.loc 2 91 28 view .LVU127
+	.loc 2 92 9 view .LVU128
+	.loc 2 91 34 view .LVU129
+	.loc 2 91 28 view .LVU130
+	.loc 2 92 9 view .LVU131
+	.loc 2 91 34 view .LVU132
+	.loc 2 91 28 view .LVU133
+	.loc 2 92 9 view .LVU134
+	.loc 2 91 34 view .LVU135
+	.loc 2 91 28 view .LVU136
+	.loc 2 92 9 view .LVU137
+	.loc 2 91 34 view .LVU138
+	.loc 2 91 28 view .LVU139
+.LBE60:
+	.loc 2 93 5 view .LVU140
+	.loc 2 94 5 view .LVU141
+	.loc 2 95 5 view .LVU142
+	.loc 2 96 5 view .LVU143
+.LBB61:
+# blake2b-internal.h:92:         L->H[i][l] = ctx->H[i];
+	.loc 2 92 20 is_stmt 0 view .LVU144
+	movaps	%xmm9, 64(%rsp)	# vect__394.133, MEM <vector(2) long unsigned int> [(long unsigned int *)&L + 32B]
+# blake2b-internal.h:92:         L->H[i][l] = ctx->H[i];
+	.loc 2 92 28 view .LVU145
+	punpckhqdq	768(%rdi), %xmm8	# MEM <const vector(2) long unsigned int> [(const struct blake2b_ctx *)ctx_19(D) + 768B], vect__394.134
+# blake2b-internal.h:92:         L->H[i][l] = ctx->H[i];
+	.loc 2 92 20 view .LVU146
+	movaps	%xmm13, 288(%rsp)	# vect__394.147, MEM <vector(2) long unsigned int> [(long unsigned int *)&L + 256B]
+	movaps	%xmm8, 80(%rsp)	# vect__394.134, MEM <vector(2) long unsigned int> [(long unsigned int *)&L + 48B]
+# blake2b-internal.h:92:         L->H[i][l] = ctx->H[i];
+	.loc 2 92 28 view .LVU147
+	movdqa	%xmm7, %xmm8	# vect__394.70, vect__394.135
+	punpcklqdq	272(%rdi), %xmm8	# MEM <const vector(2) long unsigned int> [(const struct blake2b_ctx *)ctx_19(D) + 272B], vect__394.135
+	punpckhqdq	272(%rdi), %xmm7	# MEM <const vector(2) long unsigned int> [(const struct blake2b_ctx *)ctx_19(D) + 272B], vect__394.137
+# blake2b-internal.h:92:         L->H[i][l] = ctx->H[i];
+	.loc 2 92 20 view .LVU148
+	movaps	%xmm12, 304(%rsp)	# vect__394.148, MEM <vector(2) long unsigned int> [(long unsigned int *)&L + 272B]
+	movaps	%xmm8, 96(%rsp)	# vect__394.135, MEM <vector(2) long unsigned int> [(long unsigned int *)&L + 64B]
+# blake2b-internal.h:92:         L->H[i][l] = ctx->H[i];
+	.loc 2 92 28 view .LVU149
+	movdqa	%xmm6, %xmm8	# vect__394.102, vect__394.136
+	punpckhqdq	784(%rdi), %xmm6	# MEM <const vector(2) long unsigned int> [(const struct blake2b_ctx *)ctx_19(D) + 784B], vect__394.138
+	punpcklqdq	784(%rdi), %xmm8	# MEM <const vector(2) long unsigned int> [(const struct blake2b_ctx *)ctx_19(D) + 784B], vect__394.136
+# blake2b-internal.h:92:         L->H[i][l] = ctx->H[i];
+	.loc 2 92 20 view .LVU150
+	movaps	%xmm7, 128(%rsp)	# vect__394.137, MEM <vector(2) long unsigned int> [(long unsigned int *)&L + 96B]
+	movaps	%xmm6, 144(%rsp)	# vect__394.138, MEM <vector(2) long unsigned int> [(long unsigned int *)&L + 112B]
+# blake2b-internal.h:92:         L->H[i][l] = ctx->H[i];
+	.loc 2 92 28 view .LVU151
+	movdqa	%xmm5, %xmm6	# vect__394.71, vect__394.139
+	punpcklqdq	288(%rdi), %xmm6	# MEM <const vector(2) long unsigned int> [(const struct blake2b_ctx *)ctx_19(D) + 288B], vect__394.139
+	punpckhqdq	288(%rdi), %xmm5	# MEM <const vector(2) long unsigned int> [(const struct blake2b_ctx *)ctx_19(D) + 288B], vect__394.141
+# blake2b-internal.h:92:         L->H[i][l] = ctx->H[i];
+	.loc 2 92 20 view .LVU152
+	movaps	%xmm8, 112(%rsp)	# vect__394.136, MEM <vector(2) long unsigned int> [(long unsigned int *)&L + 80B]
+	movaps	%xmm6, 160(%rsp)	# vect__394.139, MEM <vector(2) long unsigned int> [(long unsigned int *)&L + 128B]
+# blake2b-internal.h:92:         L->H[i][l] = ctx->H[i];
+	.loc 2 92 28 view .LVU153
+	movdqa	%xmm4, %xmm6	# vect__394.103, vect__394.140
+	punpckhqdq	800(%rdi), %xmm4	# MEM <const vector(2) long unsigned int> [(const struct blake2b_ctx *)ctx_19(D) + 800B], vect__394.142
+	punpcklqdq	800(%rdi), %xmm6	# MEM <const vector(2) long unsigned int> [(const struct blake2b_ctx *)ctx_19(D) + 800B], vect__394.140
+# blake2b-internal.h:92:         L->H[i][l] = ctx->H[i];
+	.loc 2 92 20 view .LVU154
+	movaps	%xmm5, 192(%rsp)	# vect__394.141, MEM <vector(2) long unsigned int> [(long unsigned int *)&L + 160B]
+	movaps	%xmm4, 208(%rsp)	# vect__394.142, MEM <vector(2) long unsigned int> [(long unsigned int *)&L + 176B]
+# blake2b-internal.h:92:         L->H[i][l] = ctx->H[i];
+	.loc 2 92 28 view .LVU155
+	movdqa	%xmm3, %xmm4	# vect__394.72, vect__394.143
+	punpcklqdq	304(%rdi), %xmm4	# MEM <const vector(2) long unsigned int> [(const struct blake2b_ctx *)ctx_19(D) + 304B], vect__394.143
+	punpckhqdq	304(%rdi), %xmm3	# MEM <const vector(2) long unsigned int> [(const struct blake2b_ctx *)ctx_19(D) + 304B], vect__394.145
+# blake2b-internal.h:92:         L->H[i][l] = ctx->H[i];
+	.loc 2 92 20 view .LVU156
+	movaps	%xmm6, 176(%rsp)	# vect__394.140, MEM <vector(2) long unsigned int> [(long unsigned int *)&L + 144B]
+	movaps	%xmm4, 224(%rsp)	# vect__394.143, MEM <vector(2) long unsigned int> [(long unsigned int *)&L + 192B]
+# blake2b-internal.h:92:         L->H[i][l] = ctx->H[i];
+	.loc 2 92 28 view .LVU157
+	movdqa	%xmm2, %xmm4	# vect__394.104, vect__394.144
+	punpckhqdq	816(%rdi), %xmm2	# MEM <const vector(2) long unsigned int> [(const struct blake2b_ctx *)ctx_19(D) + 816B], vect__394.146
+	punpcklqdq	816(%rdi), %xmm4	# MEM <const vector(2) long unsigned int> [(const struct blake2b_ctx *)ctx_19(D) + 816B], vect__394.144
+# blake2b-internal.h:92:         L->H[i][l] = ctx->H[i];
+	.loc 2 92 20 view .LVU158
+	movaps	%xmm3, 256(%rsp)	# vect__394.145, MEM <vector(2) long unsigned int> [(long unsigned int *)&L + 224B]
+	movaps	%xmm2, 272(%rsp)	# vect__394.146, MEM <vector(2) long unsigned int> [(long unsigned int *)&L + 240B]
+# blake2b-internal.h:92:         L->H[i][l] = ctx->H[i];
+	.loc 2 92 28 view .LVU159
+	movdqa	%xmm1, %xmm2	# vect__394.82, vect__394.151
+	punpcklqdq	464(%rdi), %xmm2	# MEM <const vector(2) long unsigned int> [(const struct blake2b_ctx *)ctx_19(D) + 464B], vect__394.151
+# blake2b-internal.h:92:         L->H[i][l] = ctx->H[i];
+	.loc 2 92 20 view .LVU160
+	movaps	%xmm4, 240(%rsp)	# vect__394.144, MEM <vector(2) long unsigned int> [(long unsigned int *)&L + 208B]
+	movaps	%xmm2, 352(%rsp)	# vect__394.151, MEM <vector(2) long unsigned int> [(long unsigned int *)&L + 320B]
+# blake2b-internal.h:92:         L->H[i][l] = ctx->H[i];
+	.loc 2 92 28 view .LVU161
+	movdqa	%xmm0, %xmm2	# vect__394.114, vect__394.152
+# blake2b-internal.h:92:         L->H[i][l] = ctx->H[i];
+	.loc 2 92 20 view .LVU162
+	movaps	%xmm11, 320(%rsp)	# vect__394.149, MEM <vector(2) long unsigned int> [(long unsigned int *)&L + 288B]
+	movaps	%xmm10, 336(%rsp)	# vect__394.150, MEM <vector(2) long unsigned int> [(long unsigned int *)&L + 304B]
+# blake2b-internal.h:92:         L->H[i][l] = ctx->H[i];
+	.loc 2 92 28 view .LVU163
+	punpcklqdq	976(%rdi), %xmm2	# MEM <const vector(2) long unsigned int> [(const struct blake2b_ctx *)ctx_19(D) + 976B], vect__394.152
+	punpckhqdq	464(%rdi), %xmm1	# MEM <const vector(2) long unsigned int> [(const struct blake2b_ctx *)ctx_19(D) + 464B], vect__394.153
+	punpckhqdq	976(%rdi), %xmm0	# MEM <const vector(2) long unsigned int> [(const struct blake2b_ctx *)ctx_19(D) + 976B], vect__394.154
+.LBE61:
+.LBE66:
+.LBE71:
+.LBE73:
+# blake2bp.c:79:     if (ctx->S[0].buf_len) {
+	.loc 1 79 8 view .LVU164
+	movl	224(%rdi), %edi	# ctx_19(D)->S[0].buf_len,
+.LVL4:
+.LBB74:
+.LBB72:
+.LBB67:
+.LBB62:
+# blake2b-internal.h:92:         L->H[i][l] = ctx->H[i];
+	.loc 2 92 20 view .LVU165
+	movaps	%xmm2, 368(%rsp)	# vect__394.152, MEM <vector(2) long unsigned int> [(long unsigned int *)&L + 336B]
+	movaps	%xmm1, 384(%rsp)	# vect__394.153, MEM <vector(2) long unsigned int> [(long unsigned int *)&L + 352B]
+	movaps	%xmm0, 400(%rsp)	# vect__394.154, MEM <vector(2) long unsigned int> [(long unsigned int *)&L + 368B]
+.LVL5:
+	.loc 2 92 20 view .LVU166
+.LBE62:
+.LBE67:
+.LBE72:
+	.loc 1 76 34 is_stmt 1 view .LVU167
+	.loc 1 76 28 view .LVU168
+.LBE74:
+	.loc 1 79 5 view .LVU169
+# blake2bp.c:79:     if (ctx->S[0].buf_len) {
+	.loc 1 79 8 is_stmt 0 view .LVU170
+	testl	%edi, %edi	#
+	jne	.L6	#,
+	movq	%rsp, %r14	#, tmp318
+	leaq	32(%rsp), %r15	#, tmp319
+.L2:
+	.loc 1 87 12 is_stmt 1 discriminator 1 view .LVU171
+	salq	$9, %r13	#, tmp294
+.LVL6:
+	.loc 1 87 12 is_stmt 0 discriminator 1 view .LVU172
+	addq	%r12, %r13	# src, _350
+.LVL7:
+	.p2align 4,,10
+	.p2align 3
+.L3:
+.LBB75:
+	.loc 1 88 32 is_stmt 1 view .LVU173
+	.loc 1 89 13 view .LVU174
+# blake2bp.c:89:             m[i] = src + i*BLAKE2B_BLOCK;
+	.loc 1 89 18 is_stmt 0 view .LVU175
+	movq	%r12, (%rsp)	# src, m[0]
+	.loc 1 90 13 is_stmt 1 view .LVU176
+.LVL8:
+.LBB76:
+.LBI76:
+	.loc 2 110 20 view .LVU177
+.LBB77:
+	.loc 2 112 5 view .LVU178
+.LBE77:
+.LBE76:
+.LBE75:
+.LBB88:
+.LBB89:
+# blake2b-internal.h:84:     blake2b_kern->compress_lanes(L, m, mask);
+	.loc 2 84 5 is_stmt 0 view .LVU179
+	movl	$15, %edx	#,
+	movq	%r14, %rsi	# tmp318,
+	movq	%r15, %rdi	# tmp319,
+.LBE89:
+.LBE88:
+.LBB91:
+.LBB83:
+.LBB78:
+# blake2b-internal.h:112:     L->t[0][l] += inc;
+	.loc 2 112 16 view .LVU180
+	movq	288(%rsp), %rax	# L.t[0][0], tmp343
+	subq	$-128, %rax	#, _129
+# blake2b-internal.h:113:     L->t[1][l] += (L->t[0][l] < inc);
+	.loc 2 113 31 view .LVU181
+	cmpq	$127, %rax	#, _129
+# blake2b-internal.h:112:     L->t[0][l] += inc;
+	.loc 2 112 16 view .LVU182
+	movq	%rax, 288(%rsp)	# _129, L.t[0][0]
+	.loc 2 113 5 is_stmt 1 view .LVU183
+# blake2b-internal.h:113:     L->t[1][l] += (L->t[0][l] < inc);
+	.loc 2 113 31 is_stmt 0 view .LVU184
+	setbe	%al	#, tmp296
+	movzbl	%al, %eax	# tmp296, tmp296
+# blake2b-internal.h:113:     L->t[1][l] += (L->t[0][l] < inc);
+	.loc 2 113 16 view .LVU185
+	addq	%rax, 320(%rsp)	# tmp296, L.t[1][0]
+.LVL9:
+	.loc 2 113 16 view .LVU186
+.LBE78:
+.LBE83:
+	.loc 1 88 38 is_stmt 1 view .LVU187
+	.loc 1 88 32 view .LVU188
+	.loc 1 89 13 view .LVU189
+# blake2bp.c:89:             m[i] = src + i*BLAKE2B_BLOCK;
+	.loc 1 89 24 is_stmt 0 view .LVU190
+	leaq	128(%r12), %rax	#, tmp298
+	movq	%rax, 8(%rsp)	# tmp298, m[1]
+	.loc 1 90 13 is_stmt 1 view .LVU191
+.LVL10:
+.LBB84:
+	.loc 2 110 20 view .LVU192
+.LBB79:
+	.loc 2 112 5 view .LVU193
+# blake2b-internal.h:112:     L->t[0][l] += inc;
+	.loc 2 112 16 is_stmt 0 view .LVU194
+	movq	296(%rsp), %rax	# L.t[0][1], tmp344
+	subq	$-128, %rax	#, _144
+# blake2b-internal.h:113:     L->t[1][l] += (L->t[0][l] < inc);
+	.loc 2 113 31 view .LVU195
+	cmpq	$127, %rax	#, _144
+# blake2b-internal.h:112:     L->t[0][l] += inc;
+	.loc 2 112 16 view .LVU196
+	movq	%rax, 296(%rsp)	# _144, L.t[0][1]
+	.loc 2 113 5 is_stmt 1 view .LVU197
+# blake2b-internal.h:113:     L->t[1][l] += (L->t[0][l] < inc);
+	.loc 2 113 31 is_stmt 0 view .LVU198
+	setbe	%al	#, tmp300
+	movzbl	%al, %eax	# tmp300, tmp300
+# blake2b-internal.h:113:     L->t[1][l] += (L->t[0][l] < inc);
+	.loc 2 113 16 view .LVU199
+	addq	%rax, 328(%rsp)	# tmp300, L.t[1][1]
+.LVL11:
+	.loc 2 113 16 view .LVU200
+.LBE79:
+.LBE84:
+	.loc 1 88 38 is_stmt 1 view .LVU201
+	.loc 1 88 32 view .LVU202
+	.loc 1 89 13 view .LVU203
+# blake2bp.c:89:             m[i] = src + i*BLAKE2B_BLOCK;
+	.loc 1 89 24 is_stmt 0 view .LVU204
+	leaq	256(%r12), %rax	#, tmp302
+	movq	%rax, 16(%rsp)	# tmp302, m[2]
+	.loc 1 90 13 is_stmt 1 view .LVU205
+.LVL12:
+.LBB85:
+	.loc 2 110 20 view .LVU206
+.LBB80:
+	.loc 2 112 5 view .LVU207
+# blake2b-internal.h:112:     L->t[0][l] += inc;
+	.loc 2 112 16 is_stmt 0 view .LVU208
+	movq	304(%rsp), %rax	# L.t[0][2], tmp345
+	subq	$-128, %rax	#, _159
+# blake2b-internal.h:113:     L->t[1][l] += (L->t[0][l] < inc);
+	.loc 2 113 31 view .LVU209
+	cmpq	$127, %rax	#, _159
+# blake2b-internal.h:112:     L->t[0][l] += inc;
+	.loc 2 112 16 view .LVU210
+	movq	%rax, 304(%rsp)	# _159, L.t[0][2]
+	.loc 2 113 5 is_stmt 1 view .LVU211
+# blake2b-internal.h:113:     L->t[1][l] += (L->t[0][l] < inc);
+	.loc 2 113 31 is_stmt 0 view .LVU212
+	setbe	%al	#, tmp304
+	movzbl	%al, %eax	# tmp304, tmp304
+# blake2b-internal.h:113:     L->t[1][l] += (L->t[0][l] < inc);
+	.loc 2 113 16 view .LVU213
+	addq	%rax, 336(%rsp)	# tmp304, L.t[1][2]
+.LVL13:
+	.loc 2 113 16 view .LVU214
+.LBE80:
+.LBE85:
+	.loc 1 88 38 is_stmt 1 view .LVU215
+	.loc 1 88 32 view .LVU216
+	.loc 1 89 13 view .LVU217
+# blake2bp.c:89:             m[i] = src + i*BLAKE2B_BLOCK;
+	.loc 1 89 24 is_stmt 0 view .LVU218
+	leaq	384(%r12), %rax	#, tmp306
+	movq	%rax, 24(%rsp)	# tmp306, m[3]
+	.loc 1 90 13 is_stmt 1 view .LVU219
+.LVL14:
+.LBB86:
+	.loc 2 110 20 view .LVU220
+.LBB81:
+	.loc 2 112 5 view .LVU221
+# blake2b-internal.h:112:     L->t[0][l] += inc;
+	.loc 2 112 16 is_stmt 0 view .LVU222
+	movq	312(%rsp), %rax	# L.t[0][3], tmp346
+	subq	$-128, %rax	#, _174
+# blake2b-internal.h:113:     L->t[1][l] += (L->t[0][l] < inc);
+	.loc 2 113 31 view .LVU223
+	cmpq	$127, %rax	#, _174
+# blake2b-internal.h:112:     L->t[0][l] += inc;
+	.loc 2 112 16 view .LVU224
+	movq	%rax, 312(%rsp)	# _174, L.t[0][3]
+	.loc 2 113 5 is_stmt 1 view .LVU225
+# blake2b-internal.h:113:     L->t[1][l] += (L->t[0][l] < inc);
+	.loc 2 113 31 is_stmt 0 view .LVU226
+	setbe	%al	#, tmp308
+.LBE81:
+.LBE86:
+.LBE91:
+# blake2bp.c:87:     for (; n; n--, src += BBP_STRIDE) {
+	.loc 1 87 24 view .LVU227
+	addq	$512, %r12	#, src
+.LVL15:
+.LBB92:
+.LBB87:
+.LBB82:
+# blake2b-internal.h:113:     L->t[1][l] += (L->t[0][l] < inc);
+	.loc 2 113 31 view .LVU228
+	movzbl	%al, %eax	# tmp308, tmp308
+# blake2b-internal.h:113:     L->t[1][l] += (L->t[0][l] < inc);
+	.loc 2 113 16 view .LVU229
+	addq	%rax, 344(%rsp)	# tmp308, L.t[1][3]
+.LVL16:
+	.loc 2 113 16 view .LVU230
+.LBE82:
+.LBE87:
+	.loc 1 88 38 is_stmt 1 view .LVU231
+	.loc 1 88 32 view .LVU232
+.LBE92:
+	.loc 1 92 9 view .LVU233
+.LBB93:
+.LBI88:
+	.loc 2 81 20 view .LVU234
+.LBB90:
+	.loc 2 84 5 view .LVU235
+	movq	blake2b_kern(%rip), %rax	# blake2b_kern, blake2b_kern
+	call	*40(%rax)	# blake2b_kern.0_55->compress_lanes
+.LVL17:
+	.loc 2 84 5 is_stmt 0 view .LVU236
+.LBE90:
+.LBE93:
+	.loc 1 87 18 is_stmt 1 view .LVU237
+	.loc 1 87 12 view .LVU238
+	cmpq	%r13, %r12	# _350, src
+	jne	.L3	#,
+.LVL18:
+.LBB94:
+.LBB95:
+.LBB96:
+.LBB97:
+	.loc 2 102 28 view .LVU239
+	.loc 2 103 9 view .LVU240
+	.loc 2 102 34 view .LVU241
+	.loc 2 102 28 view .LVU242
+	.loc 2 103 9 view .LVU243
+	.loc 2 102 34 view .LVU244
+	.loc 2 102 28 view .LVU245
+	.loc 2 103 9 view .LVU246
+	.loc 2 102 34 view .LVU247
+	.loc 2 102 28 view .LVU248
+	.loc 2 103 9 view .LVU249
+	.loc 2 102 34 view .LVU250
+	.loc 2 102 28 view .LVU251
+	.loc 2 103 9 view .LVU252
+	.loc 2 102 34 view .LVU253
+	.loc 2 102 28 view .LVU254
+	.loc 2 103 9 view .LVU255
+	.loc 2 102 34 view .LVU256
+	.loc 2 102 28 view .LVU257
+	.loc 2 103 9 view .LVU258
+	.loc 2 102 34 view .LVU259
+	.loc 2 102 28 view .LVU260
+	.loc 2 103 9 view .LVU261
+# blake2b-internal.h:103:         ctx->H[i] = L->H[i][l];
+	.loc 2 103 19 is_stmt 0 view .LVU262
+	movq	32(%rsp), %rax	# BIT_FIELD_REF <MEM <const vector(2) long unsigned int> [(long unsigned int *)&L], 64, 0>, BIT_FIELD_REF <MEM <const vector(2) long unsigned int> [(long unsigned int *)&L], 64, 0>
+	movq	%rax, (%rbx)	# BIT_FIELD_REF <MEM <const vector(2) long unsigned int> [(long unsigned int *)&L], 64, 0>, MEM <long unsigned int> [(struct blake2b_ctx *)ctx_19(D)]
+	movq	40(%rsp), %rax	# BIT_FIELD_REF <MEM <const vector(2) long unsigned int> [(long unsigned int *)&L], 64, 64>, _227
+	movq	%rax, 256(%rbx)	# _227, MEM <long unsigned int> [(struct blake2b_ctx *)ctx_19(D) + 256B]
+	movq	64(%rsp), %rax	# BIT_FIELD_REF <MEM <const vector(2) long unsigned int> [(long unsigned int *)&L + 32B], 64, 0>, _202
+	movq	%rax, 8(%rbx)	# _202, MEM <long unsigned int> [(struct blake2b_ctx *)ctx_19(D) + 8B]
+	movq	72(%rsp), %rax	# BIT_FIELD_REF <MEM <const vector(2) long unsigned int> [(long unsigned int *)&L + 32B], 64, 64>, _169
+	movq	%rax, 264(%rbx)	# _169, MEM <long unsigned int> [(struct blake2b_ctx *)ctx_19(D) + 264B]
+	movq	96(%rsp), %rax	# BIT_FIELD_REF <MEM <const vector(2) long unsigned int> [(long unsigned int *)&L + 64B], 64, 0>, _3
+	movq	%rax, 16(%rbx)	# _3, MEM <long unsigned int> [(struct blake2b_ctx *)ctx_19(D) + 16B]
+	movq	104(%rsp), %rax	# BIT_FIELD_REF <MEM <const vector(2) long unsigned int> [(long unsigned int *)&L + 64B], 64, 64>, _272
+	movq	%rax, 272(%rbx)	# _272, MEM <long unsigned int> [(struct blake2b_ctx *)ctx_19(D) + 272B]
+	movq	128(%rsp), %rax	# BIT_FIELD_REF <MEM <const vector(2) long unsigned int> [(long unsigned int *)&L + 96B], 64, 0>, _71
+	movq	%rax, 24(%rbx)	# _71, MEM <long unsigned int> [(struct blake2b_ctx *)ctx_19(D) + 24B]
+	movq	136(%rsp), %rax	# BIT_FIELD_REF <MEM <const vector(2) long unsigned int> [(long unsigned int *)&L + 96B], 64, 64>, _115
+	movq	%rax, 280(%rbx)	# _115, MEM <long unsigned int> [(struct blake2b_ctx *)ctx_19(D) + 280B]
+	movq	160(%rsp), %rax	# BIT_FIELD_REF <MEM <const vector(2) long unsigned int> [(long unsigned int *)&L + 128B], 64, 0>, _100
+	movq	%rax, 32(%rbx)	# _100, MEM <long unsigned int> [(struct blake2b_ctx *)ctx_19(D) + 32B]
+	movq	168(%rsp), %rax	# BIT_FIELD_REF <MEM <const vector(2) long unsigned int> [(long unsigned int *)&L + 128B], 64, 64>, _85
+	movq	%rax, 288(%rbx)	# _85, MEM <long unsigned int> [(struct blake2b_ctx *)ctx_19(D) + 288B]
+	movq	192(%rsp), %rax	# BIT_FIELD_REF <MEM <const vector(2) long unsigned int> [(long unsigned int *)&L + 160B], 64, 0>, _275
+	movq	%rax, 40(%rbx)	# _275, MEM <long unsigned int> [(struct blake2b_ctx *)ctx_19(D) + 40B]
+	movq	200(%rsp), %rax	# BIT_FIELD_REF <MEM <const vector(2) long unsigned int> [(long unsigned int *)&L + 160B], 64, 64>, _278
+	movq	%rax, 296(%rbx)	# _278, MEM <long unsigned int> [(struct blake2b_ctx *)ctx_19(D) + 296B]
+	movq	224(%rsp), %rax	# BIT_FIELD_REF <MEM <const vector(2) long unsigned int> [(long unsigned int *)&L + 192B], 64, 0>, _281
+	movq	%rax, 48(%rbx)	# _281, MEM <long unsigned int> [(struct blake2b_ctx *)ctx_19(D) + 48B]
+	movq	232(%rsp), %rax	# BIT_FIELD_REF <MEM <const vector(2) long unsigned int> [(long unsigned int *)&L + 192B], 64, 64>, _284
+	movq	%rax, 304(%rbx)	# _284, MEM <long unsigned int> [(struct blake2b_ctx *)ctx_19(D) + 304B]
+	movq	256(%rsp), %rax	# BIT_FIELD_REF <MEM <const vector(2) long unsigned int> [(long unsigned int *)&L + 224B], 64, 0>, _287
+	movq	%rax, 56(%rbx)	# _287, MEM <long unsigned int> [(struct blake2b_ctx *)ctx_19(D) + 56B]
+	movq	264(%rsp), %rax	# BIT_FIELD_REF <MEM <const vector(2) long unsigned int> [(long unsigned int *)&L + 224B], 64, 64>, _290
+	movq	%rax, 312(%rbx)	# _290, MEM <long unsigned int> [(struct blake2b_ctx *)ctx_19(D) + 312B]
+	.loc 2 102 34 is_stmt 1 view .LVU263
+.LVL19:
+	.loc 2 102 28 view .LVU264
+.LBE97:
+	.loc 2 104 5 view .LVU265
+	.loc 2 105 5 view .LVU266
+	.loc 2 106 5 view .LVU267
+	.loc 2 107 5 view .LVU268
+# blake2b-internal.h:107:     ctx->f[1] = L->f[1][l];
+	.loc 2 107 15 is_stmt 0 view .LVU269
+	movq	288(%rsp), %rax	# BIT_FIELD_REF <MEM <const vector(2) long unsigned int> [(long unsigned int *)&L + 256B], 64, 0>, BIT_FIELD_REF <MEM <const vector(2) long unsigned int> [(long unsigned int *)&L + 256B], 64, 0>
+	movq	%rax, 192(%rbx)	# BIT_FIELD_REF <MEM <const vector(2) long unsigned int> [(long unsigned int *)&L + 256B], 64, 0>, MEM <long unsigned int> [(struct blake2b_ctx *)ctx_19(D) + 192B]
+	movq	296(%rsp), %rax	# BIT_FIELD_REF <MEM <const vector(2) long unsigned int> [(long unsigned int *)&L + 256B], 64, 64>, _299
+	movq	%rax, 448(%rbx)	# _299, MEM <long unsigned int> [(struct blake2b_ctx *)ctx_19(D) + 448B]
+	movq	320(%rsp), %rax	# BIT_FIELD_REF <MEM <const vector(2) long unsigned int> [(long unsigned int *)&L + 288B], 64, 0>, _302
+	movq	%rax, 200(%rbx)	# _302, MEM <long unsigned int> [(struct blake2b_ctx *)ctx_19(D) + 200B]
+	movq	328(%rsp), %rax	# BIT_FIELD_REF <MEM <const vector(2) long unsigned int> [(long unsigned int *)&L + 288B], 64, 64>, _305
+	movq	%rax, 456(%rbx)	# _305, MEM <long unsigned int> [(struct blake2b_ctx *)ctx_19(D) + 456B]
+	movq	352(%rsp), %rax	# BIT_FIELD_REF <MEM <const vector(2) long unsigned int> [(long unsigned int *)&L + 320B], 64, 0>, _308
+	movq	%rax, 208(%rbx)	# _308, MEM <long unsigned int> [(struct blake2b_ctx *)ctx_19(D) + 208B]
+	movq	360(%rsp), %rax	# BIT_FIELD_REF <MEM <const vector(2) long unsigned int> [(long unsigned int *)&L + 320B], 64, 64>, _311
+	movq	%rax, 464(%rbx)	# _311, MEM <long unsigned int> [(struct blake2b_ctx *)ctx_19(D) + 464B]
+	movq	384(%rsp), %rax	# BIT_FIELD_REF <MEM <const vector(2) long unsigned int> [(long unsigned int *)&L + 352B], 64, 0>, _314
+	movq	%rax, 216(%rbx)	# _314, MEM <long unsigned int> [(struct blake2b_ctx *)ctx_19(D) + 216B]
+	movq	392(%rsp), %rax	# BIT_FIELD_REF <MEM <const vector(2) long unsigned int> [(long unsigned int *)&L + 352B], 64, 64>, _317
+	movq	%rax, 472(%rbx)	# _317, MEM <long unsigned int> [(struct blake2b_ctx *)ctx_19(D) + 472B]
+.LVL20:
+	.loc 2 107 15 view .LVU270
+.LBE96:
+.LBE95:
+	.loc 1 94 34 is_stmt 1 view .LVU271
+	.loc 1 94 28 view .LVU272
+.LBB100:
+.LBB99:
+.LBB98:
+	.loc 2 102 28 view .LVU273
+	.loc 2 103 9 view .LVU274
+	.loc 2 102 34 view .LVU275
+	.loc 2 102 28 view .LVU276
+	.loc 2 103 9 view .LVU277
+	.loc 2 102 34 view .LVU278
+	.loc 2 102 28 view .LVU279
+	.loc 2 103 9 view .LVU280
+	.loc 2 102 34 view .LVU281
+	.loc 2 102 28 view .LVU282
+	.loc 2 103 9 view .LVU283
+	.loc 2 102 34 view .LVU284
+	.loc 2 102 28 view .LVU285
+	.loc 2 103 9 view .LVU286
+	.loc 2 102 34 view .LVU287
+	.loc 2 102 28 view .LVU288
+	.loc 2 103 9 view .LVU289
+	.loc 2 102 34 view .LVU290
+	.loc 2 102 28 view .LVU291
+	.loc 2 103 9 view .LVU292
+	.loc 2 102 34 view .LVU293
+	.loc 2 102 28 view .LVU294
+	.loc 2 103 9 view .LVU295
+# blake2b-internal.h:103:         ctx->H[i] = L->H[i][l];
+	.loc 2 103 19 is_stmt 0 view .LVU296
+	movq	48(%rsp), %rax	# BIT_FIELD_REF <MEM <const vector(2) long unsigned int> [(long unsigned int *)&L + 16B], 64, 0>, BIT_FIELD_REF <MEM <const vector(2) long unsigned int> [(long unsigned int *)&L + 16B], 64, 0>
+	movq	%rax, 512(%rbx)	# BIT_FIELD_REF <MEM <const vector(2) long unsigned int> [(long unsigned int *)&L + 16B], 64, 0>, MEM <long unsigned int> [(struct blake2b_ctx *)ctx_19(D) + 512B]
+	movq	56(%rsp), %rax	# BIT_FIELD_REF <MEM <const vector(2) long unsigned int> [(long unsigned int *)&L + 16B], 64, 64>, _125
+	movq	%rax, 768(%rbx)	# _125, MEM <long unsigned int> [(struct blake2b_ctx *)ctx_19(D) + 768B]
+	movq	80(%rsp), %rax	# BIT_FIELD_REF <MEM <const vector(2) long unsigned int> [(long unsigned int *)&L + 48B], 64, 0>, _121
+	movq	%rax, 520(%rbx)	# _121, MEM <long unsigned int> [(struct blake2b_ctx *)ctx_19(D) + 520B]
+	movq	88(%rsp), %rax	# BIT_FIELD_REF <MEM <const vector(2) long unsigned int> [(long unsigned int *)&L + 48B], 64, 64>, _113
+	movq	%rax, 776(%rbx)	# _113, MEM <long unsigned int> [(struct blake2b_ctx *)ctx_19(D) + 776B]
+	movq	112(%rsp), %rax	# BIT_FIELD_REF <MEM <const vector(2) long unsigned int> [(long unsigned int *)&L + 80B], 64, 0>, _106
+	movq	%rax, 528(%rbx)	# _106, MEM <long unsigned int> [(struct blake2b_ctx *)ctx_19(D) + 528B]
+	movq	120(%rsp), %rax	# BIT_FIELD_REF <MEM <const vector(2) long unsigned int> [(long unsigned int *)&L + 80B], 64, 64>, _98
+	movq	%rax, 784(%rbx)	# _98, MEM <long unsigned int> [(struct blake2b_ctx *)ctx_19(D) + 784B]
+	movq	144(%rsp), %rax	# BIT_FIELD_REF <MEM <const vector(2) long unsigned int> [(long unsigned int *)&L + 112B], 64, 0>, _92
+	movq	%rax, 536(%rbx)	# _92, MEM <long unsigned int> [(struct blake2b_ctx *)ctx_19(D) + 536B]
+	movq	152(%rsp), %rax	# BIT_FIELD_REF <MEM <const vector(2) long unsigned int> [(long unsigned int *)&L + 112B], 64, 64>, _87
+	movq	%rax, 792(%rbx)	# _87, MEM <long unsigned int> [(struct blake2b_ctx *)ctx_19(D) + 792B]
+	movq	176(%rsp), %rax	# BIT_FIELD_REF <MEM <const vector(2) long unsigned int> [(long unsigned int *)&L + 144B], 64, 0>, _77
+	movq	%rax, 544(%rbx)	# _77, MEM <long unsigned int> [(struct blake2b_ctx *)ctx_19(D) + 544B]
+	movq	184(%rsp), %rax	# BIT_FIELD_REF <MEM <const vector(2) long unsigned int> [(long unsigned int *)&L + 144B], 64, 64>, _66
+	movq	%rax, 800(%rbx)	# _66, MEM <long unsigned int> [(struct blake2b_ctx *)ctx_19(D) + 800B]
+	movq	208(%rsp), %rax	# BIT_FIELD_REF <MEM <const vector(2) long unsigned int> [(long unsigned int *)&L + 176B], 64, 0>, _54
+	movq	%rax, 552(%rbx)	# _54, MEM <long unsigned int> [(struct blake2b_ctx *)ctx_19(D) + 552B]
+	movq	216(%rsp), %rax	# BIT_FIELD_REF <MEM <const vector(2) long unsigned int> [(long unsigned int *)&L + 176B], 64, 64>, _51
+	movq	%rax, 808(%rbx)	# _51, MEM <long unsigned int> [(struct blake2b_ctx *)ctx_19(D) + 808B]
+	movq	240(%rsp), %rax	# BIT_FIELD_REF <MEM <const vector(2) long unsigned int> [(long unsigned int *)&L + 208B], 64, 0>, _35
+	movq	%rax, 560(%rbx)	# _35, MEM <long unsigned int> [(struct blake2b_ctx *)ctx_19(D) + 560B]
+	movq	248(%rsp), %rax	# BIT_FIELD_REF <MEM <const vector(2) long unsigned int> [(long unsigned int *)&L + 208B], 64, 64>, _31
+	movq	%rax, 816(%rbx)	# _31, MEM <long unsigned int> [(struct blake2b_ctx *)ctx_19(D) + 816B]
+	movq	272(%rsp), %rax	# BIT_FIELD_REF <MEM <const vector(2) long unsigned int> [(long unsigned int *)&L + 240B], 64, 0>, _14
+	movq	%rax, 568(%rbx)	# _14, MEM <long unsigned int> [(struct blake2b_ctx *)ctx_19(D) + 568B]
+	movq	280(%rsp), %rax	# BIT_FIELD_REF <MEM <const vector(2) long unsigned int> [(long unsigned int *)&L + 240B], 64, 64>, _11
+	movq	%rax, 824(%rbx)	# _11, MEM <long unsigned int> [(struct blake2b_ctx *)ctx_19(D) + 824B]
+	.loc 2 102 34 is_stmt 1 view .LVU297
+.LVL21:
+	.loc 2 102 28 view .LVU298
+.LBE98:
+	.loc 2 104 5 view .LVU299
+	.loc 2 105 5 view .LVU300
+	.loc 2 106 5 view .LVU301
+	.loc 2 107 5 view .LVU302
+# blake2b-internal.h:107:     ctx->f[1] = L->f[1][l];
+	.loc 2 107 15 is_stmt 0 view .LVU303
+	movq	304(%rsp), %rax	# BIT_FIELD_REF <MEM <const vector(2) long unsigned int> [(long unsigned int *)&L + 272B], 64, 0>, BIT_FIELD_REF <MEM <const vector(2) long unsigned int> [(long unsigned int *)&L + 272B], 64, 0>
+	movq	%rax, 704(%rbx)	# BIT_FIELD_REF <MEM <const vector(2) long unsigned int> [(long unsigned int *)&L + 272B], 64, 0>, MEM <long unsigned int> [(struct blake2b_ctx *)ctx_19(D) + 704B]
+	movq	312(%rsp), %rax	# BIT_FIELD_REF <MEM <const vector(2) long unsigned int> [(long unsigned int *)&L + 272B], 64, 64>, _246
+	movq	%rax, 960(%rbx)	# _246, MEM <long unsigned int> [(struct blake2b_ctx *)ctx_19(D) + 960B]
+	movq	336(%rsp), %rax	# BIT_FIELD_REF <MEM <const vector(2) long unsigned int> [(long unsigned int *)&L + 304B], 64, 0>, _250
+	movq	%rax, 712(%rbx)	# _250, MEM <long unsigned int> [(struct blake2b_ctx *)ctx_19(D) + 712B]
+	movq	344(%rsp), %rax	# BIT_FIELD_REF <MEM <const vector(2) long unsigned int> [(long unsigned int *)&L + 304B], 64, 64>, _253
+	movq	%rax, 968(%rbx)	# _253, MEM <long unsigned int> [(struct blake2b_ctx *)ctx_19(D) + 968B]
+	movq	368(%rsp), %rax	# BIT_FIELD_REF <MEM <const vector(2) long unsigned int> [(long unsigned int *)&L + 336B], 64, 0>, _257
+	movq	%rax, 720(%rbx)	# _257, MEM <long unsigned int> [(struct blake2b_ctx *)ctx_19(D) + 720B]
+	movq	376(%rsp), %rax	# BIT_FIELD_REF <MEM <const vector(2) long unsigned int> [(long unsigned int *)&L + 336B], 64, 64>, _260
+	movq	%rax, 976(%rbx)	# _260, MEM <long unsigned int> [(struct blake2b_ctx *)ctx_19(D) + 976B]
+	movq	400(%rsp), %rax	# BIT_FIELD_REF <MEM <const vector(2) long unsigned int> [(long unsigned int *)&L + 368B], 64, 0>, _264
+	movq	%rax, 728(%rbx)	# _264, MEM <long unsigned int> [(struct blake2b_ctx *)ctx_19(D) + 728B]
+	movq	408(%rsp), %rax	# BIT_FIELD_REF <MEM <const vector(2) long unsigned int> [(long unsigned int *)&L + 368B], 64, 64>, _267
+	movq	%rax, 984(%rbx)	# _267, MEM <long unsigned int> [(struct blake2b_ctx *)ctx_19(D) + 984B]
+.LVL22:
+	.loc 2 107 15 view .LVU304
+.LBE99:
+.LBE100:
+	.loc 1 94 34 is_stmt 1 view .LVU305
+	.loc 1 94 28 view .LVU306
+.LBE94:
+	.loc 1 96 5 view .LVU307
+# blake2bp.c:97: }
+	.loc 1 97 1 is_stmt 0 view .LVU308
+	leaq	-40(%rbp), %rsp	#,
+	popq	%rbx	#
+.LVL23:
+	.loc 1 97 1 view .LVU309
+	popq	%r12	#
+.LVL24:
+	.loc 1 97 1 view .LVU310
+	popq	%r13	#
+	popq	%r14	#
+	popq	%r15	#
+	popq	%rbp	#
+	.cfi_remember_state
+	.cfi_def_cfa 7, 8
+	ret	
+.LVL25:
+	.p2align 4,,10
+	.p2align 3
+.L6:
+	.cfi_restore_state
+.LBB101:
+	.loc 1 81 13 is_stmt 1 view .LVU311
+	.loc 1 82 13 view .LVU312
+.LBB102:
+.LBB103:
+# blake2b-internal.h:112:     L->t[0][l] += inc;
+	.loc 2 112 16 is_stmt 0 view .LVU313
+	subq	$-128, %rsi	#, tmp275
+# blake2b-internal.h:113:     L->t[1][l] += (L->t[0][l] < inc);
+	.loc 2 113 31 view .LVU314
+	xorl	%edi, %edi	# tmp276
+.LBE103:
+.LBE102:
+# blake2bp.c:81:             m[i] = ctx->S[i].buf;
+	.loc 1 81 20 view .LVU315
+	movq	%rbx, %xmm0	# ctx, tmp265
+.LBE101:
+.LBB130:
+.LBB131:
+# blake2b-internal.h:84:     blake2b_kern->compress_lanes(L, m, mask);
+	.loc 2 84 5 view .LVU316
+	movq	%rsp, %r14	#, tmp318
+.LBE131:
+.LBE130:
+.LBB137:
+.LBB117:
+.LBB104:
+# blake2b-internal.h:113:     L->t[1][l] += (L->t[0][l] < inc);
+	.loc 2 113 31 view .LVU317
+	cmpq	$127, %rsi	#, tmp275
+.LBE104:
+.LBE117:
+# blake2bp.c:81:             m[i] = ctx->S[i].buf;
+	.loc 1 81 20 view .LVU318
+	movdqa	.LC0(%rip), %xmm1	#, vect__340.295
+	punpcklqdq	%xmm0, %xmm0	# tmp265
+.LBE137:
+.LBB138:
+.LBB132:
+# blake2b-internal.h:84:     blake2b_kern->compress_lanes(L, m, mask);
+	.loc 2 84 5 view .LVU319
+	movq	%r14, %rsi	# tmp318,
+.LBE132:
+.LBE138:
+.LBB139:
+.LBB118:
+.LBB105:
+# blake2b-internal.h:113:     L->t[1][l] += (L->t[0][l] < inc);
+	.loc 2 113 31 view .LVU320
+	setbe	%dil	#, tmp276
+# blake2b-internal.h:112:     L->t[0][l] += inc;
+	.loc 2 112 16 view .LVU321
+	subq	$-128, %rcx	#, tmp278
+.LBE105:
+.LBE118:
+.LBE139:
+.LBB140:
+.LBB133:
+# blake2b-internal.h:84:     blake2b_kern->compress_lanes(L, m, mask);
+	.loc 2 84 5 view .LVU322
+	leaq	32(%rsp), %r15	#, tmp319
+.LBE133:
+.LBE140:
+.LBB141:
+# blake2bp.c:82:             ctx->S[i].buf_len = 0;
+	.loc 1 82 31 view .LVU323
+	movl	$0, 224(%rbx)	#, ctx_19(D)->S[0].buf_len
+	.loc 1 83 13 is_stmt 1 view .LVU324
+.LVL26:
+.LBB119:
+.LBI102:
+	.loc 2 110 20 view .LVU325
+.LBB106:
+	.loc 2 112 5 view .LVU326
+	.loc 2 113 5 view .LVU327
+	.loc 2 113 5 is_stmt 0 view .LVU328
+.LBE106:
+.LBE119:
+	.loc 1 80 38 is_stmt 1 view .LVU329
+	.loc 1 80 32 view .LVU330
+	.loc 1 81 13 view .LVU331
+	.loc 1 82 13 view .LVU332
+.LBB120:
+.LBB107:
+# blake2b-internal.h:113:     L->t[1][l] += (L->t[0][l] < inc);
+	.loc 2 113 31 is_stmt 0 view .LVU333
+	cmpq	$127, %rcx	#, tmp278
+.LBE107:
+.LBE120:
+# blake2bp.c:81:             m[i] = ctx->S[i].buf;
+	.loc 1 81 20 view .LVU334
+	paddq	%xmm0, %xmm1	# tmp265, vect__340.295
+	paddq	.LC1(%rip), %xmm0	#, vect__340.295
+# blake2bp.c:82:             ctx->S[i].buf_len = 0;
+	.loc 1 82 31 view .LVU335
+	movl	$0, 480(%rbx)	#, ctx_19(D)->S[1].buf_len
+	.loc 1 83 13 is_stmt 1 view .LVU336
+.LVL27:
+.LBB121:
+	.loc 2 110 20 view .LVU337
+.LBB108:
+	.loc 2 112 5 view .LVU338
+	.loc 2 113 5 view .LVU339
+	.loc 2 113 5 is_stmt 0 view .LVU340
+.LBE108:
+.LBE121:
+	.loc 1 80 38 is_stmt 1 view .LVU341
+	.loc 1 80 32 view .LVU342
+	.loc 1 81 13 view .LVU343
+	.loc 1 82 13 view .LVU344
+.LBB122:
+.LBB109:
+# blake2b-internal.h:113:     L->t[1][l] += (L->t[0][l] < inc);
+	.loc 2 113 31 is_stmt 0 view .LVU345
+	setbe	%cl	#, tmp279
+# blake2b-internal.h:112:     L->t[0][l] += inc;
+	.loc 2 112 16 view .LVU346
+	subq	$-128, %rdx	#, tmp283
+.LBE109:
+.LBE122:
+# blake2bp.c:81:             m[i] = ctx->S[i].buf;
+	.loc 1 81 18 view .LVU347
+	movaps	%xmm1, (%rsp)	# vect__340.295, MEM <vector(2) long unsigned int> [(const void * *)&m]
+.LBB123:
+.LBB110:
+# blake2b-internal.h:113:     L->t[1][l] += (L->t[0][l] < inc);
+	.loc 2 113 31 view .LVU348
+	movzbl	%cl, %ecx	# tmp279, tmp279
+.LBE110:
+.LBE123:
+# blake2bp.c:81:             m[i] = ctx->S[i].buf;
+	.loc 1 81 18 view .LVU349
+	movaps	%xmm0, 16(%rsp)	# vect__340.295, MEM <vector(2) long unsigned int> [(const void * *)&m + 16B]
+.LBB124:
+.LBB111:
+# blake2b-internal.h:112:     L->t[0][l] += inc;
+	.loc 2 112 16 view .LVU350
+	movdqa	.LC2(%rip), %xmm0	#, tmp271
+.LBE111:
+.LBE124:
+# blake2bp.c:82:             ctx->S[i].buf_len = 0;
+	.loc 1 82 31 view .LVU351
+	movl	$0, 736(%rbx)	#, ctx_19(D)->S[2].buf_len
+	.loc 1 83 13 is_stmt 1 view .LVU352
+.LVL28:
+.LBB125:
+	.loc 2 110 20 view .LVU353
+.LBB112:
+	.loc 2 112 5 view .LVU354
+	.loc 2 113 5 view .LVU355
+	.loc 2 113 5 is_stmt 0 view .LVU356
+.LBE112:
+.LBE125:
+	.loc 1 80 38 is_stmt 1 view .LVU357
+	.loc 1 80 32 view .LVU358
+	.loc 1 81 13 view .LVU359
+	.loc 1 82 13 view .LVU360
+.LBB126:
+.LBB113:
+# blake2b-internal.h:113:     L->t[1][l] += (L->t[0][l] < inc);
+	.loc 2 113 16 is_stmt 0 view .LVU361
+	movq	%rcx, %xmm3	# tmp279, tmp279
+# blake2b-internal.h:113:     L->t[1][l] += (L->t[0][l] < inc);
+	.loc 2 113 31 view .LVU362
+	xorl	%ecx, %ecx	# tmp284
+	cmpq	$127, %rdx	#, tmp283
+	setbe	%cl	#, tmp284
+# blake2b-internal.h:112:     L->t[0][l] += inc;
+	.loc 2 112 16 view .LVU363
+	subq	$-128, %rax	#, tmp286
+	paddq	%xmm0, %xmm13	# tmp271, vect__344.223
+.LBE113:
+.LBE126:
+# blake2bp.c:82:             ctx->S[i].buf_len = 0;
+	.loc 1 82 31 view .LVU364
+	movl	$0, 992(%rbx)	#, ctx_19(D)->S[3].buf_len
+	.loc 1 83 13 is_stmt 1 view .LVU365
+.LVL29:
+.LBB127:
+	.loc 2 110 20 view .LVU366
+.LBB114:
+	.loc 2 112 5 view .LVU367
+# blake2b-internal.h:112:     L->t[0][l] += inc;
+	.loc 2 112 16 is_stmt 0 view .LVU368
+	paddq	%xmm0, %xmm12	# tmp271, vect__344.223
+# blake2b-internal.h:113:     L->t[1][l] += (L->t[0][l] < inc);
+	.loc 2 113 31 view .LVU369
+	cmpq	$127, %rax	#, tmp286
+	movq	%rdi, %xmm0	# tmp276, tmp276
+# blake2b-internal.h:112:     L->t[0][l] += inc;
+	.loc 2 112 16 view .LVU370
+	movaps	%xmm13, 288(%rsp)	# vect__344.223, MEM <vector(2) long unsigned int> [(long unsigned int *)&L + 256B]
+# blake2b-internal.h:113:     L->t[1][l] += (L->t[0][l] < inc);
+	.loc 2 113 16 view .LVU371
+	punpcklqdq	%xmm3, %xmm0	# tmp279, tmp274
+# blake2b-internal.h:113:     L->t[1][l] += (L->t[0][l] < inc);
+	.loc 2 113 31 view .LVU372
+	setbe	%al	#, tmp287
+.LBE114:
+.LBE127:
+.LBE141:
+.LBB142:
+.LBB134:
+# blake2b-internal.h:84:     blake2b_kern->compress_lanes(L, m, mask);
+	.loc 2 84 5 view .LVU373
+	movl	$15, %edx	#,
+	movq	%r15, %rdi	# tmp319,
+.LBE134:
+.LBE142:
+.LBB143:
+.LBB128:
+.LBB115:
+# blake2b-internal.h:113:     L->t[1][l] += (L->t[0][l] < inc);
+	.loc 2 113 16 view .LVU374
+	paddq	%xmm11, %xmm0	# vect__394.149, vect__349.292
+# blake2b-internal.h:113:     L->t[1][l] += (L->t[0][l] < inc);
+	.loc 2 113 31 view .LVU375
+	movzbl	%al, %eax	# tmp287, tmp287
+# blake2b-internal.h:112:     L->t[0][l] += inc;
+	.loc 2 112 16 view .LVU376
+	movaps	%xmm12, 304(%rsp)	# vect__344.223, MEM <vector(2) long unsigned int> [(long unsigned int *)&L + 272B]
+	.loc 2 113 5 is_stmt 1 view .LVU377
+# blake2b-internal.h:113:     L->t[1][l] += (L->t[0][l] < inc);
+	.loc 2 113 16 is_stmt 0 view .LVU378
+	movq	%rax, %xmm5	# tmp287, tmp287
+	movaps	%xmm0, 320(%rsp)	# vect__349.292, MEM <vector(2) long unsigned int> [(long unsigned int *)&L + 288B]
+# blake2b-internal.h:113:     L->t[1][l] += (L->t[0][l] < inc);
+	.loc 2 113 31 view .LVU379
+	movq	%rcx, %xmm0	# tmp284, tmp284
+.LBE115:
+.LBE128:
+.LBE143:
+.LBB144:
+.LBB135:
+# blake2b-internal.h:84:     blake2b_kern->compress_lanes(L, m, mask);
+	.loc 2 84 5 view .LVU380
+	movq	blake2b_kern(%rip), %rax	# blake2b_kern, blake2b_kern
+.LBE135:
+.LBE144:
+.LBB145:
+.LBB129:
+.LBB116:
+# blake2b-internal.h:113:     L->t[1][l] += (L->t[0][l] < inc);
+	.loc 2 113 16 view .LVU381
+	punpcklqdq	%xmm5, %xmm0	# tmp287, tmp282
+	paddq	%xmm10, %xmm0	# vect__394.150, vect__349.292
+	movaps	%xmm0, 336(%rsp)	# vect__349.292, MEM <vector(2) long unsigned int> [(long unsigned int *)&L + 304B]
+.LVL30:
+	.loc 2 113 16 view .LVU382
+.LBE116:
+.LBE129:
+	.loc 1 80 38 is_stmt 1 view .LVU383
+	.loc 1 80 32 view .LVU384
+.LBE145:
+	.loc 1 85 9 view .LVU385
+.LBB146:
+.LBI130:
+	.loc 2 81 20 view .LVU386
+.LBB136:
+	.loc 2 84 5 view .LVU387
+	call	*40(%rax)	# blake2b_kern.0_47->compress_lanes
+.LVL31:
+# blake2b-internal.h:85: }
+	.loc 2 85 1 is_stmt 0 view .LVU388
+	jmp	.L2	#
+.LBE136:
+.LBE146:
+	.cfi_endproc
+.LFE29:
+	.size	bbp_strides, .-bbp_strides
+	.p2align 4
+	.globl	blake2bp_init_keyed
+	.type	blake2bp_init_keyed, @function
+blake2bp_init_keyed:
+.LVL32:
+.LFB26:
+	.loc 1 52 1 is_stmt 1 view -0
+	.cfi_startproc
+	.loc 1 53 5 view .LVU390
+# blake2bp.c:52: {
+	.loc 1 52 1 is_stmt 0 view .LVU391
+	pushq	%r15	#
+	.cfi_def_cfa_offset 16
+	.cfi_offset 15, -16
+	pushq	%r14	#
+	.cfi_def_cfa_offset 24
+	.cfi_offset 14, -24
+	pushq	%r13	#
+	.cfi_def_cfa_offset 32
+	.cfi_offset 13, -32
+	pushq	%r12	#
+	.cfi_def_cfa_offset 40
+	.cfi_offset 12, -40
+	pushq	%rbp	#
+	.cfi_def_cfa_offset 48
+	.cfi_offset 6, -48
+	pushq	%rbx	#
+	.cfi_def_cfa_offset 56
+	.cfi_offset 3, -56
+	subq	$56, %rsp	#,
+	.cfi_def_cfa_offset 112
+# blake2bp.c:52: {
+	.loc 1 52 1 view .LVU392
+	movq	%rdx, 8(%rsp)	# tmp108, %sfp
+# blake2bp.c:53:     if (key_len < 1)
+	.loc 1 53 8 view .LVU393
+	testl	%ecx, %ecx	# key_len
+	je	.L13	#,
+.LBB150:
+.LBB151:
+# blake2bp.c:28:     u64 P[B2B_PARAM_WORDS] = { B2B_PARAM0(dig_len,key_len,BBP_LEAVES,2,0), 0,
+	.loc 1 28 9 view .LVU394
+	movq	$0, 24(%rsp)	#, P[1]
+# blake2bp.c:28:     u64 P[B2B_PARAM_WORDS] = { B2B_PARAM0(dig_len,key_len,BBP_LEAVES,2,0), 0,
+	.loc 1 28 50 view .LVU395
+	movl	%ecx, %eax	# key_len, tmp97
+	movl	%ecx, %ebp	# tmp109, key_len
+.LBE151:
+.LBE150:
+	.loc 1 55 5 is_stmt 1 view .LVU396
+.LVL33:
+.LBB154:
+.LBI150:
+	.loc 1 25 12 view .LVU397
+.LBB153:
+	.loc 1 28 5 view .LVU398
+# blake2bp.c:28:     u64 P[B2B_PARAM_WORDS] = { B2B_PARAM0(dig_len,key_len,BBP_LEAVES,2,0), 0,
+	.loc 1 28 9 is_stmt 0 view .LVU399
+	movq	$16385, 32(%rsp)	#, P[2]
+# blake2bp.c:28:     u64 P[B2B_PARAM_WORDS] = { B2B_PARAM0(dig_len,key_len,BBP_LEAVES,2,0), 0,
+	.loc 1 28 50 view .LVU400
+	sall	$8, %eax	#, tmp97
+# blake2bp.c:28:     u64 P[B2B_PARAM_WORDS] = { B2B_PARAM0(dig_len,key_len,BBP_LEAVES,2,0), 0,
+	.loc 1 28 9 view .LVU401
+	movq	$0, 40(%rsp)	#, P[3]
+	.loc 1 31 5 is_stmt 1 view .LVU402
+# blake2bp.c:28:     u64 P[B2B_PARAM_WORDS] = { B2B_PARAM0(dig_len,key_len,BBP_LEAVES,2,0), 0,
+	.loc 1 28 39 is_stmt 0 view .LVU403
+	orl	%r8d, %eax	# dig_len, tmp98
+# blake2bp.c:28:     u64 P[B2B_PARAM_WORDS] = { B2B_PARAM0(dig_len,key_len,BBP_LEAVES,2,0), 0,
+	.loc 1 28 76 view .LVU404
+	orl	$33816576, %eax	#,
+	movq	%rax, 16(%rsp)	# tmp113, P[0]
+# blake2bp.c:31:     if (key_len > BLAKE2B_KEY_LEN)
+	.loc 1 31 8 view .LVU405
+	cmpl	$64, %ecx	#, key_len
+	ja	.L13	#,
+	.loc 1 33 5 is_stmt 1 view .LVU406
+# blake2bp.c:33:     if (dig_len < 1 || dig_len > BLAKE2B_LEN)
+	.loc 1 33 21 is_stmt 0 view .LVU407
+	subl	$1, %r8d	#, tmp100
+.LVL34:
+# blake2bp.c:33:     if (dig_len < 1 || dig_len > BLAKE2B_LEN)
+	.loc 1 33 8 view .LVU408
+	cmpl	$63, %r8d	#, tmp100
+	ja	.L13	#,
+# blake2bp.c:37:     blake2b_init_words(&ctx->R, P, salt, NULL, 0);
+	.loc 1 37 5 view .LVU409
+	leaq	16(%rsp), %r15	#, tmp105
+	movq	%rdi, %r12	# tmp106, ctx
+	movq	%rsi, %rdx	# salt,
+.LVL35:
+	.loc 1 37 5 view .LVU410
+	movq	%rsi, %r13	# tmp107, salt
+	.loc 1 37 5 is_stmt 1 view .LVU411
+	leaq	1024(%rdi), %rdi	#, tmp102
+.LVL36:
+	.loc 1 37 5 is_stmt 0 view .LVU412
+	xorl	%r8d, %r8d	#
+.LVL37:
+	.loc 1 37 5 view .LVU413
+	xorl	%ecx, %ecx	#
+.LVL38:
+	.loc 1 37 5 view .LVU414
+	movq	%r15, %rsi	# tmp105,
+.LVL39:
+	.loc 1 37 5 view .LVU415
+	call	blake2b_init_words@PLT	#
+.LVL40:
+	.loc 1 38 5 is_stmt 1 view .LVU416
+	movq	%r12, %r14	# ctx, ivtmp.320
+# blake2bp.c:39:     P[2] = B2B_PARAM2(0, BLAKE2B_LEN);
+	.loc 1 39 10 is_stmt 0 view .LVU417
+	xorl	%ebx, %ebx	# ivtmp.315
+# blake2bp.c:38:     ctx->R.last_node = 1;
+	.loc 1 38 22 view .LVU418
+	movl	$1, 1256(%r12)	#, ctx_5(D)->R.last_node
+	.loc 1 39 5 is_stmt 1 view .LVU419
+# blake2bp.c:39:     P[2] = B2B_PARAM2(0, BLAKE2B_LEN);
+	.loc 1 39 10 is_stmt 0 view .LVU420
+	movq	$16384, 32(%rsp)	#, P[2]
+	.loc 1 40 5 is_stmt 1 view .LVU421
+.LBB152:
+	.loc 1 40 10 view .LVU422
+.LVL41:
+	.loc 1 40 28 view .LVU423
+.L12:
+	.loc 1 41 9 view .LVU424
+# blake2bp.c:42:         blake2b_init_words(&ctx->S[i], P, salt, key, key_len);
+	.loc 1 42 9 is_stmt 0 view .LVU425
+	movq	8(%rsp), %rcx	# %sfp,
+# blake2bp.c:41:         P[1] = i;
+	.loc 1 41 14 view .LVU426
+	movq	%rbx, 24(%rsp)	# ivtmp.315, P[1]
+	.loc 1 42 9 is_stmt 1 view .LVU427
+	movq	%r14, %rdi	# ivtmp.320,
+	movl	%ebp, %r8d	# key_len,
+	movq	%r13, %rdx	# salt,
+	movq	%r15, %rsi	# tmp105,
+# blake2bp.c:40:     for (unsigned i = 0; i < BBP_LEAVES; i++) {
+	.loc 1 40 28 is_stmt 0 view .LVU428
+	addq	$1, %rbx	#, ivtmp.315
+.LVL42:
+	.loc 1 40 28 view .LVU429
+	addq	$256, %r14	#, ivtmp.320
+# blake2bp.c:42:         blake2b_init_words(&ctx->S[i], P, salt, key, key_len);
+	.loc 1 42 9 view .LVU430
+	call	blake2b_init_words@PLT	#
+.LVL43:
+	.loc 1 43 9 is_stmt 1 view .LVU431
+# blake2bp.c:43:         ctx->S[i].digest_len = BLAKE2B_LEN; /* inner length */
+	.loc 1 43 30 is_stmt 0 view .LVU432
+	movl	$64, -28(%r14)	#, MEM[(unsigned int *)_19 + 228B]
+	.loc 1 40 34 is_stmt 1 view .LVU433
+.LVL44:
+	.loc 1 40 28 view .LVU434
+	cmpq	$4, %rbx	#, ivtmp.315
+	jne	.L12	#,
+.LBE152:
+	.loc 1 45 5 view .LVU435
+# blake2bp.c:45:     ctx->S[BBP_LEAVES-1].last_node = 1;
+	.loc 1 45 28 is_stmt 0 view .LVU436
+	movl	$1, 1000(%r12)	#, ctx_5(D)->S[3].last_node
+	.loc 1 46 5 is_stmt 1 view .LVU437
+# blake2bp.c:47:     return 0;
+	.loc 1 47 12 is_stmt 0 view .LVU438
+	xorl	%eax, %eax	# <retval>
+# blake2bp.c:46:     ctx->buf_len = 0;
+	.loc 1 46 18 view .LVU439
+	movl	$0, 2176(%r12)	#, ctx_5(D)->buf_len
+	.loc 1 47 5 is_stmt 1 view .LVU440
+.LVL45:
+.L9:
+	.loc 1 47 5 is_stmt 0 view .LVU441
+.LBE153:
+.LBE154:
+# blake2bp.c:56: }
+	.loc 1 56 1 view .LVU442
+	addq	$56, %rsp	#,
+	.cfi_remember_state
+	.cfi_def_cfa_offset 56
+	popq	%rbx	#
+	.cfi_def_cfa_offset 48
+	popq	%rbp	#
+	.cfi_def_cfa_offset 40
+	popq	%r12	#
+	.cfi_def_cfa_offset 32
+	popq	%r13	#
+	.cfi_def_cfa_offset 24
+	popq	%r14	#
+	.cfi_def_cfa_offset 16
+	popq	%r15	#
+	.cfi_def_cfa_offset 8
+	ret	
+.LVL46:
+	.p2align 4,,10
+	.p2align 3
+.L13:
+	.cfi_restore_state
+# blake2bp.c:54:         return -1;
+	.loc 1 54 16 view .LVU443
+	movl	$-1, %eax	#, <retval>
+	jmp	.L9	#
+	.cfi_endproc
+.LFE26:
+	.size	blake2bp_init_keyed, .-blake2bp_init_keyed
+	.p2align 4
+	.globl	blake2bp_init_salted
+	.type	blake2bp_init_salted, @function
+blake2bp_init_salted:
+.LVL47:
+.LFB27:
+	.loc 1 60 1 is_stmt 1 view -0
+	.cfi_startproc
+	.loc 1 61 5 view .LVU445
+.LBB158:
+.LBI158:
+	.loc 1 25 12 view .LVU446
+.LBB159:
+	.loc 1 28 5 view .LVU447
+.LBE159:
+.LBE158:
+# blake2bp.c:60: {
+	.loc 1 60 1 is_stmt 0 view .LVU448
+	pushq	%r14	#
+	.cfi_def_cfa_offset 16
+	.cfi_offset 14, -16
+.LBB165:
+.LBB161:
+# blake2bp.c:28:     u64 P[B2B_PARAM_WORDS] = { B2B_PARAM0(dig_len,key_len,BBP_LEAVES,2,0), 0,
+	.loc 1 28 76 view .LVU449
+	movl	%edx, %eax	# dig_len, tmp93
+# blake2bp.c:33:     if (dig_len < 1 || dig_len > BLAKE2B_LEN)
+	.loc 1 33 21 view .LVU450
+	subl	$1, %edx	#, tmp94
+.LVL48:
+	.loc 1 33 21 view .LVU451
+.LBE161:
+.LBE165:
+# blake2bp.c:60: {
+	.loc 1 60 1 view .LVU452
+	pushq	%r13	#
+	.cfi_def_cfa_offset 24
+	.cfi_offset 13, -24
+.LBB166:
+.LBB162:
+# blake2bp.c:28:     u64 P[B2B_PARAM_WORDS] = { B2B_PARAM0(dig_len,key_len,BBP_LEAVES,2,0), 0,
+	.loc 1 28 76 view .LVU453
+	orl	$33816576, %eax	#,
+.LVL49:
+	.loc 1 28 76 view .LVU454
+.LBE162:
+.LBE166:
+# blake2bp.c:60: {
+	.loc 1 60 1 view .LVU455
+	pushq	%r12	#
+	.cfi_def_cfa_offset 32
+	.cfi_offset 12, -32
+	pushq	%rbp	#
+	.cfi_def_cfa_offset 40
+	.cfi_offset 6, -40
+	pushq	%rbx	#
+	.cfi_def_cfa_offset 48
+	.cfi_offset 3, -48
+	subq	$32, %rsp	#,
+	.cfi_def_cfa_offset 80
+.LBB167:
+.LBB163:
+# blake2bp.c:28:     u64 P[B2B_PARAM_WORDS] = { B2B_PARAM0(dig_len,key_len,BBP_LEAVES,2,0), 0,
+	.loc 1 28 76 view .LVU456
+	movq	%rax, (%rsp)	# tmp105, P[0]
+# blake2bp.c:28:     u64 P[B2B_PARAM_WORDS] = { B2B_PARAM0(dig_len,key_len,BBP_LEAVES,2,0), 0,
+	.loc 1 28 9 view .LVU457
+	movq	$0, 8(%rsp)	#, P[1]
+	movq	$16385, 16(%rsp)	#, P[2]
+	movq	$0, 24(%rsp)	#, P[3]
+	.loc 1 31 5 is_stmt 1 view .LVU458
+	.loc 1 33 5 view .LVU459
+# blake2bp.c:33:     if (dig_len < 1 || dig_len > BLAKE2B_LEN)
+	.loc 1 33 8 is_stmt 0 view .LVU460
+	cmpl	$63, %edx	#, tmp94
+	ja	.L21	#,
+# blake2bp.c:37:     blake2b_init_words(&ctx->R, P, salt, NULL, 0);
+	.loc 1 37 5 view .LVU461
+	movq	%rsp, %r14	#, tmp99
+	movq	%rdi, %r12	# tmp100, ctx
+	movq	%rsi, %rdx	# salt,
+.LVL50:
+	.loc 1 37 5 view .LVU462
+	movq	%rsi, %r13	# tmp101, salt
+	.loc 1 37 5 is_stmt 1 view .LVU463
+	leaq	1024(%rdi), %rdi	#, tmp96
+.LVL51:
+	.loc 1 37 5 is_stmt 0 view .LVU464
+	xorl	%r8d, %r8d	#
+	xorl	%ecx, %ecx	#
+	movq	%r14, %rsi	# tmp99,
+.LVL52:
+	.loc 1 37 5 view .LVU465
+	call	blake2b_init_words@PLT	#
+.LVL53:
+	.loc 1 38 5 is_stmt 1 view .LVU466
+	movq	%r12, %rbp	# ctx, ivtmp.333
+# blake2bp.c:39:     P[2] = B2B_PARAM2(0, BLAKE2B_LEN);
+	.loc 1 39 10 is_stmt 0 view .LVU467
+	xorl	%ebx, %ebx	# ivtmp.328
+# blake2bp.c:38:     ctx->R.last_node = 1;
+	.loc 1 38 22 view .LVU468
+	movl	$1, 1256(%r12)	#, ctx_2(D)->R.last_node
+	.loc 1 39 5 is_stmt 1 view .LVU469
+# blake2bp.c:39:     P[2] = B2B_PARAM2(0, BLAKE2B_LEN);
+	.loc 1 39 10 is_stmt 0 view .LVU470
+	movq	$16384, 16(%rsp)	#, P[2]
+	.loc 1 40 5 is_stmt 1 view .LVU471
+.LBB160:
+	.loc 1 40 10 view .LVU472
+.LVL54:
+	.loc 1 40 28 view .LVU473
+.L20:
+	.loc 1 41 9 view .LVU474
+# blake2bp.c:41:         P[1] = i;
+	.loc 1 41 14 is_stmt 0 view .LVU475
+	movq	%rbx, 8(%rsp)	# ivtmp.328, P[1]
+	.loc 1 42 9 is_stmt 1 view .LVU476
+	movq	%rbp, %rdi	# ivtmp.333,
+	xorl	%r8d, %r8d	#
+	xorl	%ecx, %ecx	#
+	movq	%r13, %rdx	# salt,
+	movq	%r14, %rsi	# tmp99,
+# blake2bp.c:40:     for (unsigned i = 0; i < BBP_LEAVES; i++) {
+	.loc 1 40 28 is_stmt 0 view .LVU477
+	addq	$1, %rbx	#, ivtmp.328
+.LVL55:
+	.loc 1 40 28 view .LVU478
+	addq	$256, %rbp	#, ivtmp.333
+# blake2bp.c:42:         blake2b_init_words(&ctx->S[i], P, salt, key, key_len);
+	.loc 1 42 9 view .LVU479
+	call	blake2b_init_words@PLT	#
+.LVL56:
+	.loc 1 43 9 is_stmt 1 view .LVU480
+# blake2bp.c:43:         ctx->S[i].digest_len = BLAKE2B_LEN; /* inner length */
+	.loc 1 43 30 is_stmt 0 view .LVU481
+	movl	$64, -28(%rbp)	#, MEM[(unsigned int *)_15 + 228B]
+	.loc 1 40 34 is_stmt 1 view .LVU482
+.LVL57:
+	.loc 1 40 28 view .LVU483
+	cmpq	$4, %rbx	#, ivtmp.328
+	jne	.L20	#,
+.LBE160:
+	.loc 1 45 5 view .LVU484
+# blake2bp.c:45:     ctx->S[BBP_LEAVES-1].last_node = 1;
+	.loc 1 45 28 is_stmt 0 view .LVU485
+	movl	$1, 1000(%r12)	#, ctx_2(D)->S[3].last_node
+	.loc 1 46 5 is_stmt 1 view .LVU486
+# blake2bp.c:47:     return 0;
+	.loc 1 47 12 is_stmt 0 view .LVU487
+	xorl	%eax, %eax	# <retval>
+# blake2bp.c:46:     ctx->buf_len = 0;
+	.loc 1 46 18 view .LVU488
+	movl	$0, 2176(%r12)	#, ctx_2(D)->buf_len
+	.loc 1 47 5 is_stmt 1 view .LVU489
+.LVL58:
+.L18:
+	.loc 1 47 5 is_stmt 0 view .LVU490
+.LBE163:
+.LBE167:
+# blake2bp.c:62: }
+	.loc 1 62 1 view .LVU491
+	addq	$32, %rsp	#,
+	.cfi_remember_state
+	.cfi_def_cfa_offset 48
+	popq	%rbx	#
+	.cfi_def_cfa_offset 40
+	popq	%rbp	#
+	.cfi_def_cfa_offset 32
+	popq	%r12	#
+	.cfi_def_cfa_offset 24
+	popq	%r13	#
+	.cfi_def_cfa_offset 16
+	popq	%r14	#
+	.cfi_def_cfa_offset 8
+	ret	
+.LVL59:
+.L21:
+	.cfi_restore_state
+.LBB168:
+.LBB164:
+# blake2bp.c:32:         return -1;
+	.loc 1 32 16 view .LVU492
+	movl	$-1, %eax	#, <retval>
+.LVL60:
+	.loc 1 32 16 view .LVU493
+.LBE164:
+.LBE168:
+# blake2bp.c:61:     return bbp_init(ctx, salt, NULL, 0, dig_len);
+	.loc 1 61 12 view .LVU494
+	jmp	.L18	#
+	.cfi_endproc
+.LFE27:
+	.size	blake2bp_init_salted, .-blake2bp_init_salted
+	.p2align 4
+	.globl	blake2bp_init
+	.type	blake2bp_init, @function
+blake2bp_init:
+.LVL61:
+.LFB28:
+	.loc 1 65 1 is_stmt 1 view -0
+	.cfi_startproc
+	.loc 1 66 5 view .LVU496
+.LBB172:
+.LBI172:
+	.loc 1 25 12 view .LVU497
+.LBB173:
+	.loc 1 28 5 view .LVU498
+.LBE173:
+.LBE172:
+# blake2bp.c:65: {
+	.loc 1 65 1 is_stmt 0 view .LVU499
+	pushq	%r13	#
+	.cfi_def_cfa_offset 16
+	.cfi_offset 13, -16
+.LBB179:
+.LBB175:
+# blake2bp.c:37:     blake2b_init_words(&ctx->R, P, salt, NULL, 0);
+	.loc 1 37 5 view .LVU500
+	xorl	%r8d, %r8d	#
+	xorl	%ecx, %ecx	#
+	xorl	%edx, %edx	#
+.LBE175:
+.LBE179:
+# blake2bp.c:65: {
+	.loc 1 65 1 view .LVU501
+	pushq	%r12	#
+	.cfi_def_cfa_offset 24
+	.cfi_offset 12, -24
+	movq	%rdi, %r12	# tmp93, ctx
+.LBB180:
+.LBB176:
+# blake2bp.c:37:     blake2b_init_words(&ctx->R, P, salt, NULL, 0);
+	.loc 1 37 5 view .LVU502
+	leaq	1024(%rdi), %rdi	#, tmp90
+.LVL62:
+	.loc 1 37 5 view .LVU503
+.LBE176:
+.LBE180:
+# blake2bp.c:65: {
+	.loc 1 65 1 view .LVU504
+	pushq	%rbp	#
+	.cfi_def_cfa_offset 32
+	.cfi_offset 6, -32
+	movq	%r12, %rbp	# ctx, ivtmp.348
+	pushq	%rbx	#
+	.cfi_def_cfa_offset 40
+	.cfi_offset 3, -40
+.LBB181:
+.LBB177:
+# blake2bp.c:39:     P[2] = B2B_PARAM2(0, BLAKE2B_LEN);
+	.loc 1 39 10 view .LVU505
+	xorl	%ebx, %ebx	# ivtmp.343
+.LBE177:
+.LBE181:
+# blake2bp.c:65: {
+	.loc 1 65 1 view .LVU506
+	subq	$40, %rsp	#,
+	.cfi_def_cfa_offset 80
+.LBB182:
+.LBB178:
+# blake2bp.c:28:     u64 P[B2B_PARAM_WORDS] = { B2B_PARAM0(dig_len,key_len,BBP_LEAVES,2,0), 0,
+	.loc 1 28 9 view .LVU507
+	movdqa	.LC3(%rip), %xmm0	#, tmp87
+# blake2bp.c:37:     blake2b_init_words(&ctx->R, P, salt, NULL, 0);
+	.loc 1 37 5 view .LVU508
+	movq	%rsp, %r13	#, tmp92
+# blake2bp.c:28:     u64 P[B2B_PARAM_WORDS] = { B2B_PARAM0(dig_len,key_len,BBP_LEAVES,2,0), 0,
+	.loc 1 28 9 view .LVU509
+	movaps	%xmm0, (%rsp)	# tmp87, MEM <vector(2) long unsigned int> [(long unsigned int *)&P]
+	movdqa	.LC4(%rip), %xmm0	#, tmp88
+# blake2bp.c:37:     blake2b_init_words(&ctx->R, P, salt, NULL, 0);
+	.loc 1 37 5 view .LVU510
+	movq	%r13, %rsi	# tmp92,
+# blake2bp.c:28:     u64 P[B2B_PARAM_WORDS] = { B2B_PARAM0(dig_len,key_len,BBP_LEAVES,2,0), 0,
+	.loc 1 28 9 view .LVU511
+	movaps	%xmm0, 16(%rsp)	# tmp88, MEM <vector(2) long unsigned int> [(long unsigned int *)&P + 16B]
+	.loc 1 31 5 is_stmt 1 view .LVU512
+	.loc 1 33 5 view .LVU513
+	.loc 1 37 5 view .LVU514
+	call	blake2b_init_words@PLT	#
+.LVL63:
+	.loc 1 38 5 view .LVU515
+# blake2bp.c:38:     ctx->R.last_node = 1;
+	.loc 1 38 22 is_stmt 0 view .LVU516
+	movl	$1, 1256(%r12)	#, ctx_2(D)->R.last_node
+	.loc 1 39 5 is_stmt 1 view .LVU517
+# blake2bp.c:39:     P[2] = B2B_PARAM2(0, BLAKE2B_LEN);
+	.loc 1 39 10 is_stmt 0 view .LVU518
+	movq	$16384, 16(%rsp)	#, P[2]
+	.loc 1 40 5 is_stmt 1 view .LVU519
+.LBB174:
+	.loc 1 40 10 view .LVU520
+.LVL64:
+	.loc 1 40 28 view .LVU521
+.L25:
+	.loc 1 41 9 view .LVU522
+# blake2bp.c:41:         P[1] = i;
+	.loc 1 41 14 is_stmt 0 view .LVU523
+	movq	%rbx, 8(%rsp)	# ivtmp.343, P[1]
+	.loc 1 42 9 is_stmt 1 view .LVU524
+	movq	%rbp, %rdi	# ivtmp.348,
+	xorl	%r8d, %r8d	#
+	xorl	%ecx, %ecx	#
+	xorl	%edx, %edx	#
+	movq	%r13, %rsi	# tmp92,
+# blake2bp.c:40:     for (unsigned i = 0; i < BBP_LEAVES; i++) {
+	.loc 1 40 28 is_stmt 0 view .LVU525
+	addq	$1, %rbx	#, ivtmp.343
+.LVL65:
+	.loc 1 40 28 view .LVU526
+	addq	$256, %rbp	#, ivtmp.348
+# blake2bp.c:42:         blake2b_init_words(&ctx->S[i], P, salt, key, key_len);
+	.loc 1 42 9 view .LVU527
+	call	blake2b_init_words@PLT	#
+.LVL66:
+	.loc 1 43 9 is_stmt 1 view .LVU528
+# blake2bp.c:43:         ctx->S[i].digest_len = BLAKE2B_LEN; /* inner length */
+	.loc 1 43 30 is_stmt 0 view .LVU529
+	movl	$64, -28(%rbp)	#, MEM[(unsigned int *)_12 + 228B]
+	.loc 1 40 34 is_stmt 1 view .LVU530
+.LVL67:
+	.loc 1 40 28 view .LVU531
+	cmpq	$4, %rbx	#, ivtmp.343
+	jne	.L25	#,
+.LBE174:
+	.loc 1 45 5 view .LVU532
+# blake2bp.c:45:     ctx->S[BBP_LEAVES-1].last_node = 1;
+	.loc 1 45 28 is_stmt 0 view .LVU533
+	movl	$1, 1000(%r12)	#, ctx_2(D)->S[3].last_node
+	.loc 1 46 5 is_stmt 1 view .LVU534
+# blake2bp.c:46:     ctx->buf_len = 0;
+	.loc 1 46 18 is_stmt 0 view .LVU535
+	movl	$0, 2176(%r12)	#, ctx_2(D)->buf_len
+	.loc 1 47 5 is_stmt 1 view .LVU536
+.LVL68:
+	.loc 1 47 5 is_stmt 0 view .LVU537
+.LBE178:
+.LBE182:
+# blake2bp.c:67: }
+	.loc 1 67 1 view .LVU538
+	addq	$40, %rsp	#,
+	.cfi_def_cfa_offset 40
+	popq	%rbx	#
+	.cfi_def_cfa_offset 32
+	popq	%rbp	#
+	.cfi_def_cfa_offset 24
+	popq	%r12	#
+	.cfi_def_cfa_offset 16
+.LVL69:
+	.loc 1 67 1 view .LVU539
+	popq	%r13	#
+	.cfi_def_cfa_offset 8
+	ret	
+	.cfi_endproc
+.LFE28:
+	.size	blake2bp_init, .-blake2bp_init
+	.p2align 4
+	.globl	blake2bp_update
+	.type	blake2bp_update, @function
+blake2bp_update:
+.LVL70:
+.LFB30:
+	.loc 1 100 1 is_stmt 1 view -0
+	.cfi_startproc
+	.loc 1 101 5 view .LVU541
+# blake2bp.c:100: {
+	.loc 1 100 1 is_stmt 0 view .LVU542
+	pushq	%r15	#
+	.cfi_def_cfa_offset 16
+	.cfi_offset 15, -16
+	movq	%rdi, %r15	# tmp157, ctx
+	pushq	%r14	#
+	.cfi_def_cfa_offset 24
+	.cfi_offset 14, -24
+	pushq	%r13	#
+	.cfi_def_cfa_offset 32
+	.cfi_offset 13, -32
+	pushq	%r12	#
+	.cfi_def_cfa_offset 40
+	.cfi_offset 12, -40
+	movq	%rsi, %r12	# tmp158, src
+.LVL71:
+	.loc 1 104 5 is_stmt 1 view .LVU543
+# blake2bp.c:100: {
+	.loc 1 100 1 is_stmt 0 view .LVU544
+	pushq	%rbp	#
+	.cfi_def_cfa_offset 48
+	.cfi_offset 6, -48
+	movq	%rdx, %rbp	# tmp159, len
+	.loc 1 104 25 is_stmt 1 view .LVU545
+# blake2bp.c:100: {
+	.loc 1 100 1 is_stmt 0 view .LVU546
+	pushq	%rbx	#
+	.cfi_def_cfa_offset 56
+	.cfi_offset 3, -56
+.LBB183:
+# blake2bp.c:107:             memcpy(ctx->buf + ctx->buf_len, in, fill);
+	.loc 1 107 20 view .LVU547
+	leaq	1280(%rdi), %rbx	#, pretmp_93
+.LBE183:
+# blake2bp.c:100: {
+	.loc 1 100 1 view .LVU548
+	subq	$8, %rsp	#,
+	.cfi_def_cfa_offset 64
+# blake2bp.c:104:     while (ctx->buf_len && ctx->buf_len + len > BBP_HOLD) {
+	.loc 1 104 15 view .LVU549
+	movl	2176(%rdi), %eax	# ctx_37(D)->buf_len, _11
+# blake2bp.c:104:     while (ctx->buf_len && ctx->buf_len + len > BBP_HOLD) {
+	.loc 1 104 25 view .LVU550
+	testl	%eax, %eax	# _11
+	je	.L29	#,
+# blake2bp.c:104:     while (ctx->buf_len && ctx->buf_len + len > BBP_HOLD) {
+	.loc 1 104 31 view .LVU551
+	movl	%eax, %edx	# _11, _13
+.LVL72:
+# blake2bp.c:104:     while (ctx->buf_len && ctx->buf_len + len > BBP_HOLD) {
+	.loc 1 104 41 view .LVU552
+	leaq	0(%rbp,%rdx), %rcx	#, tmp106
+# blake2bp.c:104:     while (ctx->buf_len && ctx->buf_len + len > BBP_HOLD) {
+	.loc 1 104 25 view .LVU553
+	cmpq	$896, %rcx	#, tmp106
+	jbe	.L30	#,
+# blake2bp.c:114:         memmove(ctx->buf, ctx->buf + BBP_STRIDE, ctx->buf_len);
+	.loc 1 114 9 view .LVU554
+	leaq	1792(%rdi), %r13	#, _70
+.LBB184:
+# blake2bp.c:106:             size_t fill = BBP_STRIDE - ctx->buf_len;
+	.loc 1 106 37 view .LVU555
+	movl	$512, %r14d	#, tmp156
+	jmp	.L36	#
+.LVL73:
+	.p2align 4,,10
+	.p2align 3
+.L31:
+	.loc 1 106 37 view .LVU556
+.LBE184:
+	.loc 1 112 9 is_stmt 1 view .LVU557
+	movl	$1, %edx	#,
+	movq	%rbx, %rsi	# pretmp_93,
+	movq	%r15, %rdi	# ctx,
+	call	bbp_strides	#
+.LVL74:
+	.loc 1 113 9 view .LVU558
+# blake2bp.c:113:         ctx->buf_len -= BBP_STRIDE;
+	.loc 1 113 22 is_stmt 0 view .LVU559
+	movl	2176(%r15), %eax	# ctx_37(D)->buf_len, tmp163
+# blake2bp.c:114:         memmove(ctx->buf, ctx->buf + BBP_STRIDE, ctx->buf_len);
+	.loc 1 114 9 view .LVU560
+	movq	%r13, %rsi	# _70,
+	movq	%rbx, %rdi	# pretmp_93,
+# blake2bp.c:113:         ctx->buf_len -= BBP_STRIDE;
+	.loc 1 113 22 view .LVU561
+	leal	-512(%rax), %edx	#,
+	movl	%edx, 2176(%r15)	# _8, ctx_37(D)->buf_len
+	.loc 1 114 9 is_stmt 1 view .LVU562
+	call	memmove@PLT	#
+.LVL75:
+	.loc 1 104 25 view .LVU563
+# blake2bp.c:104:     while (ctx->buf_len && ctx->buf_len + len > BBP_HOLD) {
+	.loc 1 104 15 is_stmt 0 view .LVU564
+	movl	2176(%r15), %eax	# ctx_37(D)->buf_len, _11
+# blake2bp.c:104:     while (ctx->buf_len && ctx->buf_len + len > BBP_HOLD) {
+	.loc 1 104 25 view .LVU565
+	testl	%eax, %eax	# _11
+	je	.L29	#,
+# blake2bp.c:104:     while (ctx->buf_len && ctx->buf_len + len > BBP_HOLD) {
+	.loc 1 104 31 discriminator 1 view .LVU566
+	movl	%eax, %ecx	# _11, _13
+# blake2bp.c:104:     while (ctx->buf_len && ctx->buf_len + len > BBP_HOLD) {
+	.loc 1 104 41 discriminator 1 view .LVU567
+	leaq	(%rcx,%rbp), %rsi	#, tmp145
+# blake2bp.c:104:     while (ctx->buf_len && ctx->buf_len + len > BBP_HOLD) {
+	.loc 1 104 31 discriminator 1 view .LVU568
+	movq	%rcx, %rdx	# _13, _13
+# blake2bp.c:104:     while (ctx->buf_len && ctx->buf_len + len > BBP_HOLD) {
+	.loc 1 104 25 discriminator 1 view .LVU569
+	cmpq	$896, %rsi	#, tmp145
+	jbe	.L37	#,
+.L36:
+	.loc 1 105 9 is_stmt 1 view .LVU570
+# blake2bp.c:105:         if (ctx->buf_len < BBP_STRIDE) {
+	.loc 1 105 12 is_stmt 0 view .LVU571
+	cmpl	$511, %eax	#, _11
+	ja	.L31	#,
+.LBB185:
+	.loc 1 106 13 is_stmt 1 view .LVU572
+# blake2bp.c:106:             size_t fill = BBP_STRIDE - ctx->buf_len;
+	.loc 1 106 37 is_stmt 0 view .LVU573
+	movl	%r14d, %ecx	# tmp156, tmp107
+# blake2bp.c:107:             memcpy(ctx->buf + ctx->buf_len, in, fill);
+	.loc 1 107 13 view .LVU574
+	addq	%rbx, %rdx	# pretmp_93, tmp109
+# blake2bp.c:106:             size_t fill = BBP_STRIDE - ctx->buf_len;
+	.loc 1 106 37 view .LVU575
+	subl	%eax, %ecx	# _11, tmp107
+# blake2bp.c:106:             size_t fill = BBP_STRIDE - ctx->buf_len;
+	.loc 1 106 20 view .LVU576
+	movl	%ecx, %eax	# tmp107, fill
+.LVL76:
+	.loc 1 107 13 is_stmt 1 view .LVU577
+	cmpl	$8, %ecx	#, tmp107
+	jnb	.L32	#,
+	testb	$4, %cl	#, tmp107
+	jne	.L53	#,
+	testl	%ecx, %ecx	# tmp107
+	je	.L33	#,
+	movzbl	(%r12), %esi	#* src, tmp122
+	andl	$2, %ecx	#, tmp107
+	movb	%sil, (%rdx)	# tmp122,
+	jne	.L54	#,
+.L33:
+	.loc 1 108 13 view .LVU578
+# blake2bp.c:108:             ctx->buf_len = BBP_STRIDE;
+	.loc 1 108 26 is_stmt 0 view .LVU579
+	movl	$512, 2176(%r15)	#, ctx_37(D)->buf_len
+	.loc 1 109 13 is_stmt 1 view .LVU580
+# blake2bp.c:109:             in += fill;
+	.loc 1 109 16 is_stmt 0 view .LVU581
+	addq	%rax, %r12	# fill, src
+.LVL77:
+	.loc 1 110 13 is_stmt 1 view .LVU582
+# blake2bp.c:110:             len -= fill;
+	.loc 1 110 17 is_stmt 0 view .LVU583
+	subq	%rax, %rbp	# fill, len
+.LVL78:
+	.loc 1 110 17 view .LVU584
+	jmp	.L31	#
+	.p2align 4,,10
+	.p2align 3
+.L32:
+# blake2bp.c:107:             memcpy(ctx->buf + ctx->buf_len, in, fill);
+	.loc 1 107 13 view .LVU585
+	movq	(%r12), %rsi	#* src, tmp131
+	leaq	8(%rdx), %rdi	#, tmp139
+	andq	$-8, %rdi	#, tmp139
+	movq	%rsi, (%rdx)	# tmp131,
+	movq	-8(%r12,%rax), %rsi	#, tmp138
+	movq	%rsi, -8(%rdx,%rax)	# tmp138,
+	subq	%rdi, %rdx	# tmp139, tmp111
+	movq	%r12, %rsi	# src, src
+	addl	%edx, %ecx	# tmp111, fill
+	subq	%rdx, %rsi	# tmp111, src
+	shrl	$3, %ecx	#,
+	rep movsq
+	jmp	.L33	#
+.LVL79:
+	.p2align 4,,10
+	.p2align 3
+.L29:
+	.loc 1 107 13 view .LVU586
+.LBE185:
+	.loc 1 117 5 is_stmt 1 view .LVU587
+# blake2bp.c:117:     if (!ctx->buf_len && len > BBP_HOLD) {
+	.loc 1 117 23 is_stmt 0 view .LVU588
+	cmpq	$896, %rbp	#, len
+	ja	.L38	#,
+	.loc 1 117 23 view .LVU589
+	xorl	%ecx, %ecx	# _13
+.L37:
+# blake2bp.c:123:     memcpy(ctx->buf + ctx->buf_len, in, len);
+	.loc 1 123 26 view .LVU590
+	movq	%rcx, %rdx	# _13, _13
+.L30:
+	.loc 1 123 5 is_stmt 1 view .LVU591
+	leaq	(%rbx,%rdx), %rdi	#, tmp148
+	movq	%r12, %rsi	# src,
+	movq	%rbp, %rdx	# len,
+	call	memcpy@PLT	#
+.LVL80:
+	.loc 1 124 5 view .LVU592
+# blake2bp.c:124:     ctx->buf_len += len;
+	.loc 1 124 18 is_stmt 0 view .LVU593
+	addl	%ebp, 2176(%r15)	# len, ctx_37(D)->buf_len
+# blake2bp.c:125: }
+	.loc 1 125 1 view .LVU594
+	addq	$8, %rsp	#,
+	.cfi_remember_state
+	.cfi_def_cfa_offset 56
+	popq	%rbx	#
+	.cfi_def_cfa_offset 48
+	popq	%rbp	#
+	.cfi_def_cfa_offset 40
+.LVL81:
+	.loc 1 125 1 view .LVU595
+	popq	%r12	#
+	.cfi_def_cfa_offset 32
+.LVL82:
+	.loc 1 125 1 view .LVU596
+	popq	%r13	#
+	.cfi_def_cfa_offset 24
+	popq	%r14	#
+	.cfi_def_cfa_offset 16
+	popq	%r15	#
+	.cfi_def_cfa_offset 8
+.LVL83:
+	.loc 1 125 1 view .LVU597
+	ret	
+.LVL84:
+	.p2align 4,,10
+	.p2align 3
+.L38:
+	.cfi_restore_state
+.LBB186:
+	.loc 1 118 9 is_stmt 1 view .LVU598
+# blake2bp.c:118:         size_t n = (len - BBP_HOLD - 1) / BBP_STRIDE + 1;
+	.loc 1 118 49 is_stmt 0 view .LVU599
+	leaq	-897(%rbp), %r13	#, tmp146
+# blake2bp.c:119:         bbp_strides(ctx, in, n);
+	.loc 1 119 9 view .LVU600
+	movq	%r12, %rsi	# src,
+	movq	%r15, %rdi	# ctx,
+# blake2bp.c:118:         size_t n = (len - BBP_HOLD - 1) / BBP_STRIDE + 1;
+	.loc 1 118 54 view .LVU601
+	shrq	$9, %r13	#, tmp147
+# blake2bp.c:118:         size_t n = (len - BBP_HOLD - 1) / BBP_STRIDE + 1;
+	.loc 1 118 16 view .LVU602
+	addq	$1, %r13	#, n
+.LVL85:
+	.loc 1 119 9 is_stmt 1 view .LVU603
+	movq	%r13, %rdx	# n,
+# blake2bp.c:120:         in += n * BBP_STRIDE;
+	.loc 1 120 17 is_stmt 0 view .LVU604
+	salq	$9, %r13	#, _17
+.LVL86:
+# blake2bp.c:119:         bbp_strides(ctx, in, n);
+	.loc 1 119 9 view .LVU605
+	call	bbp_strides	#
+.LVL87:
+	.loc 1 120 9 is_stmt 1 view .LVU606
+# blake2bp.c:120:         in += n * BBP_STRIDE;
+	.loc 1 120 12 is_stmt 0 view .LVU607
+	addq	%r13, %r12	# _17, src
+.LVL88:
+	.loc 1 121 9 is_stmt 1 view .LVU608
+# blake2bp.c:121:         len -= n * BBP_STRIDE;
+	.loc 1 121 13 is_stmt 0 view .LVU609
+	subq	%r13, %rbp	# _17, len
+.LVL89:
+	.loc 1 121 13 view .LVU610
+.LBE186:
+# blake2bp.c:123:     memcpy(ctx->buf + ctx->buf_len, in, len);
+	.loc 1 123 26 view .LVU611
+	movl	2176(%r15), %edx	# ctx_37(D)->buf_len, _13
+	jmp	.L30	#
+.LVL90:
+	.p2align 4,,10
+	.p2align 3
+.L53:
+.LBB187:
+# blake2bp.c:107:             memcpy(ctx->buf + ctx->buf_len, in, fill);
+	.loc 1 107 13 view .LVU612
+	movl	(%r12), %ecx	#* src, tmp114
+	movl	%ecx, (%rdx)	# tmp114,
+	movl	-4(%r12,%rax), %ecx	#, tmp121
+	movl	%ecx, -4(%rdx,%rax)	# tmp121,
+	jmp	.L33	#
+.L54:
+	.loc 1 107 13 view .LVU613
+	movzwl	-2(%r12,%rax), %ecx	#, tmp130
+	movw	%cx, -2(%rdx,%rax)	# tmp130,
+	jmp	.L33	#
+.LBE187:
+	.cfi_endproc
+.LFE30:
+	.size	blake2bp_update, .-blake2bp_update
+	.p2align 4
+	.globl	blake2bp_final
+	.type	blake2bp_final, @function
+blake2bp_final:
+.LVL91:
+.LFB32:
+	.loc 1 137 1 is_stmt 1 view -0
+	.cfi_startproc
+	.loc 1 138 5 view .LVU615
+	.loc 1 139 5 view .LVU616
+	.loc 1 140 5 view .LVU617
+	.loc 1 141 5 view .LVU618
+	.loc 1 142 5 view .LVU619
+	.loc 1 143 5 view .LVU620
+	.loc 1 144 5 view .LVU621
+	.loc 1 149 5 view .LVU622
+.LBB188:
+	.loc 1 149 10 view .LVU623
+	.loc 1 149 28 view .LVU624
+.LBE188:
+# blake2bp.c:137: {
+	.loc 1 137 1 is_stmt 0 view .LVU625
+	pushq	%rbp	#
+	.cfi_def_cfa_offset 16
+	.cfi_offset 6, -16
+	movq	%rdi, %rax	# tmp549, ctx
+.LBB228:
+.LBB189:
+.LBB190:
+# blake2bp.c:156:             size_t k = bbp_slice(ctx->buf_len, j);
+	.loc 1 156 24 view .LVU626
+	xorl	%r11d, %r11d	# ivtmp.402
+.LBE190:
+.LBE189:
+.LBE228:
+# blake2bp.c:137: {
+	.loc 1 137 1 view .LVU627
+	movq	%rsp, %rbp	#,
+	.cfi_def_cfa_register 6
+	pushq	%r15	#
+	pushq	%r14	#
+	.cfi_offset 15, -24
+	.cfi_offset 14, -32
+.LBB229:
+.LBB212:
+.LBB207:
+# blake2bp.c:156:             size_t k = bbp_slice(ctx->buf_len, j);
+	.loc 1 156 24 view .LVU628
+	xorl	%r14d, %r14d	# ivtmp.381
+.LBE207:
+.LBE212:
+.LBE229:
+# blake2bp.c:137: {
+	.loc 1 137 1 view .LVU629
+	pushq	%r13	#
+	pushq	%r12	#
+	.cfi_offset 13, -40
+	.cfi_offset 12, -48
+	leaq	64(%rax), %r12	#, ivtmp.396
+	pushq	%rbx	#
+	.cfi_offset 3, -56
+# blake2bp.c:142:     unsigned n[BBP_LEAVES], rounds = 0;
+	.loc 1 142 20 view .LVU630
+	xorl	%ebx, %ebx	# rounds
+.LBB230:
+# blake2bp.c:162:         memset(last[i], 0, BLAKE2B_BLOCK);
+	.loc 1 162 9 view .LVU631
+	movl	%ebx, %r9d	# rounds, rounds
+.LBE230:
+# blake2bp.c:137: {
+	.loc 1 137 1 view .LVU632
+	andq	$-32, %rsp	#,
+	subq	$1504, %rsp	#,
+.LBB231:
+.LBB213:
+.LBB208:
+# blake2bp.c:156:             size_t k = bbp_slice(ctx->buf_len, j);
+	.loc 1 156 24 view .LVU633
+	movl	2176(%rdi), %r15d	# ctx_50(D)->buf_len, _717
+.LBE208:
+.LBE213:
+.LBE231:
+# blake2bp.c:137: {
+	.loc 1 137 1 view .LVU634
+	movq	%rsi, 40(%rsp)	# tmp550, %sfp
+	leaq	1280(%rax), %rsi	#, ivtmp.394
+.LVL92:
+	.loc 1 137 1 view .LVU635
+	leaq	112(%rsp), %r10	#, tmp538
+	leaq	608(%rsp), %rdi	#, tmp534
+.LVL93:
+	.loc 1 137 1 view .LVU636
+	movq	%rsi, 104(%rsp)	# ivtmp.394, %sfp
+	leaq	992(%rsp), %rsi	#, tmp537
+.LBB232:
+.LBB214:
+.LBB209:
+# blake2bp.c:156:             size_t k = bbp_slice(ctx->buf_len, j);
+	.loc 1 156 24 view .LVU637
+	movq	%r15, 88(%rsp)	# _717, %sfp
+	movq	%rdi, %r13	# tmp534, ivtmp.389
+	movq	%rsi, 80(%rsp)	# tmp537, %sfp
+.LBE209:
+.LBE214:
+# blake2bp.c:162:         memset(last[i], 0, BLAKE2B_BLOCK);
+	.loc 1 162 9 view .LVU638
+	movq	%rdi, 32(%rsp)	# ivtmp.372, %sfp
+	movq	%r15, 96(%rsp)	# ivtmp.393, %sfp
+	movq	%rax, 24(%rsp)	# ctx, %sfp
+	movq	%rdi, 16(%rsp)	# tmp534, %sfp
+.LVL94:
+.L61:
+	.loc 1 150 9 is_stmt 1 view .LVU639
+# blake2bp.c:151:         if (ctx->S[i].buf_len) {
+	.loc 1 151 12 is_stmt 0 view .LVU640
+	movl	160(%r12), %ebx	# MEM[(unsigned int *)_784 + 160B],
+# blake2bp.c:150:         n[i] = 0;
+	.loc 1 150 14 view .LVU641
+	movl	$0, (%r10,%r14,4)	#, MEM[(unsigned int *)&n + ivtmp.381_814 * 4]
+	.loc 1 151 9 is_stmt 1 view .LVU642
+# blake2bp.c:151:         if (ctx->S[i].buf_len) {
+	.loc 1 151 12 is_stmt 0 view .LVU643
+	testl	%ebx, %ebx	#
+	je	.L56	#,
+	.loc 1 152 13 is_stmt 1 view .LVU644
+# blake2bp.c:152:             blk[i][n[i]] = ctx->S[i].buf;
+	.loc 1 152 26 is_stmt 0 view .LVU645
+	movq	%r12, 160(%rsp,%r11)	# ivtmp.396, MEM[(const void * *)&blk + ivtmp.402_798 * 1]
+	.loc 1 153 13 is_stmt 1 view .LVU646
+# blake2bp.c:153:             len[i][n[i]++] = BLAKE2B_BLOCK;
+	.loc 1 153 24 is_stmt 0 view .LVU647
+	movl	$1, (%r10,%r14,4)	#, MEM[(unsigned int *)&n + ivtmp.381_814 * 4]
+# blake2bp.c:153:             len[i][n[i]++] = BLAKE2B_BLOCK;
+	.loc 1 153 28 view .LVU648
+	movq	$128, 256(%rsp,%r11)	#, MEM[(long unsigned int *)&len + ivtmp.402_798 * 1]
+.LVL95:
+.LBB215:
+	.loc 1 155 32 is_stmt 1 view .LVU649
+.L56:
+	.loc 1 155 32 is_stmt 0 view .LVU650
+	movq	%r14, %r8	# ivtmp.381, _765
+.LBB210:
+.LBB191:
+.LBB192:
+# blake2bp.c:130:     if (len <= j*BLAKE2B_BLOCK)
+	.loc 1 130 8 view .LVU651
+	movq	88(%rsp), %rax	# %sfp, _717
+	movl	%r14d, %ebx	# ivtmp.381,
+.LVL96:
+	.loc 1 130 8 view .LVU652
+.LBE192:
+.LBE191:
+	.loc 1 156 13 is_stmt 1 view .LVU653
+.LBB200:
+.LBI191:
+	.loc 1 128 15 view .LVU654
+.LBB193:
+	.loc 1 130 5 view .LVU655
+	salq	$7, %r8	#, _765
+# blake2bp.c:130:     if (len <= j*BLAKE2B_BLOCK)
+	.loc 1 130 8 is_stmt 0 view .LVU656
+	cmpq	%rax, %r8	# _717, _765
+	jnb	.L57	#,
+	.loc 1 132 5 is_stmt 1 view .LVU657
+.LVL97:
+	.loc 1 133 5 view .LVU658
+	.loc 1 133 5 is_stmt 0 view .LVU659
+.LBE193:
+.LBE200:
+	.loc 1 157 13 is_stmt 1 view .LVU660
+	.loc 1 158 17 view .LVU661
+# blake2bp.c:158:                 blk[i][n[i]] = ctx->buf + j*BLAKE2B_BLOCK;
+	.loc 1 158 25 is_stmt 0 view .LVU662
+	movl	(%r10,%r14,4), %ecx	# MEM[(unsigned int *)&n + ivtmp.381_814 * 4],
+# blake2bp.c:158:                 blk[i][n[i]] = ctx->buf + j*BLAKE2B_BLOCK;
+	.loc 1 158 30 view .LVU663
+	movl	%r14d, %eax	# ivtmp.381, _780
+	movq	104(%rsp), %rdi	# %sfp, ivtmp.394
+	leaq	(%rax,%rax,2), %rax	#, tmp353
+	addq	%rcx, %rax	# _676, tmp354
+# blake2bp.c:158:                 blk[i][n[i]] = ctx->buf + j*BLAKE2B_BLOCK;
+	.loc 1 158 25 view .LVU664
+	movq	%rcx, %rdx	#,
+# blake2bp.c:159:                 len[i][n[i]++] = k;
+	.loc 1 159 28 view .LVU665
+	addl	$1, %edx	#, tmp356
+# blake2bp.c:158:                 blk[i][n[i]] = ctx->buf + j*BLAKE2B_BLOCK;
+	.loc 1 158 30 view .LVU666
+	movq	%rdi, 160(%rsp,%rax,8)	# ivtmp.394, blk[_780][_676]
+	.loc 1 159 17 is_stmt 1 view .LVU667
+.LBB201:
+.LBB194:
+# blake2bp.c:133:     return len < BLAKE2B_BLOCK ? len : BLAKE2B_BLOCK;
+	.loc 1 133 28 is_stmt 0 view .LVU668
+	movq	96(%rsp), %rdi	# %sfp, ivtmp.393
+.LBE194:
+.LBE201:
+# blake2bp.c:159:                 len[i][n[i]++] = k;
+	.loc 1 159 28 view .LVU669
+	movl	%edx, (%r10,%r14,4)	# tmp356, MEM[(unsigned int *)&n + ivtmp.381_814 * 4]
+.LBB202:
+.LBB195:
+# blake2bp.c:133:     return len < BLAKE2B_BLOCK ? len : BLAKE2B_BLOCK;
+	.loc 1 133 28 view .LVU670
+	movl	$128, %edx	#, tmp556
+	cmpq	%rdx, %rdi	# tmp556, ivtmp.393
+	cmovbe	%rdi, %rdx	# ivtmp.393,, tmp363
+.LBE195:
+.LBE202:
+# blake2bp.c:159:                 len[i][n[i]++] = k;
+	.loc 1 159 32 view .LVU671
+	movq	%rdx, 256(%rsp,%rax,8)	# tmp363, len[_780][_676]
+.LVL98:
+.L57:
+	.loc 1 159 32 view .LVU672
+.LBE210:
+	.loc 1 155 41 is_stmt 1 view .LVU673
+	.loc 1 155 32 view .LVU674
+.LBB211:
+	.loc 1 156 13 view .LVU675
+.LBB203:
+	.loc 1 128 15 view .LVU676
+.LBB196:
+	.loc 1 130 5 view .LVU677
+# blake2bp.c:130:     if (len <= j*BLAKE2B_BLOCK)
+	.loc 1 130 8 is_stmt 0 view .LVU678
+	movq	88(%rsp), %rdi	# %sfp, _717
+	leaq	512(%r8), %rax	#, tmp364
+	cmpq	%rdi, %rax	# _717, tmp364
+	jnb	.L58	#,
+	.loc 1 132 5 is_stmt 1 view .LVU679
+.LVL99:
+	.loc 1 133 5 view .LVU680
+	.loc 1 133 5 is_stmt 0 view .LVU681
+.LBE196:
+.LBE203:
+	.loc 1 157 13 is_stmt 1 view .LVU682
+	.loc 1 158 17 view .LVU683
+# blake2bp.c:158:                 blk[i][n[i]] = ctx->buf + j*BLAKE2B_BLOCK;
+	.loc 1 158 25 is_stmt 0 view .LVU684
+	movl	(%r10,%r14,4), %ecx	# MEM[(unsigned int *)&n + ivtmp.381_814 * 4],
+# blake2bp.c:158:                 blk[i][n[i]] = ctx->buf + j*BLAKE2B_BLOCK;
+	.loc 1 158 41 view .LVU685
+	movq	104(%rsp), %rdi	# %sfp, ivtmp.394
+# blake2bp.c:158:                 blk[i][n[i]] = ctx->buf + j*BLAKE2B_BLOCK;
+	.loc 1 158 30 view .LVU686
+	leaq	(%rbx,%rbx,2), %rax	#, tmp370
+	addq	%rcx, %rax	# _6, tmp371
+# blake2bp.c:158:                 blk[i][n[i]] = ctx->buf + j*BLAKE2B_BLOCK;
+	.loc 1 158 25 view .LVU687
+	movq	%rcx, %rdx	#,
+# blake2bp.c:158:                 blk[i][n[i]] = ctx->buf + j*BLAKE2B_BLOCK;
+	.loc 1 158 41 view .LVU688
+	leaq	512(%rdi), %rcx	#, tmp372
+.LBB204:
+.LBB197:
+# blake2bp.c:132:     len -= j*BLAKE2B_BLOCK;
+	.loc 1 132 9 view .LVU689
+	movq	96(%rsp), %rdi	# %sfp, ivtmp.393
+.LBE197:
+.LBE204:
+# blake2bp.c:159:                 len[i][n[i]++] = k;
+	.loc 1 159 28 view .LVU690
+	addl	$1, %edx	#, tmp374
+# blake2bp.c:158:                 blk[i][n[i]] = ctx->buf + j*BLAKE2B_BLOCK;
+	.loc 1 158 41 view .LVU691
+	movq	%rcx, 160(%rsp,%rax,8)	# tmp372, blk[_780][_6]
+	.loc 1 159 17 is_stmt 1 view .LVU692
+.LBB205:
+.LBB198:
+# blake2bp.c:133:     return len < BLAKE2B_BLOCK ? len : BLAKE2B_BLOCK;
+	.loc 1 133 28 is_stmt 0 view .LVU693
+	movl	$128, %ecx	#, tmp555
+.LBE198:
+.LBE205:
+# blake2bp.c:159:                 len[i][n[i]++] = k;
+	.loc 1 159 28 view .LVU694
+	movl	%edx, (%r10,%r14,4)	# tmp374, MEM[(unsigned int *)&n + ivtmp.381_814 * 4]
+.LBB206:
+.LBB199:
+# blake2bp.c:132:     len -= j*BLAKE2B_BLOCK;
+	.loc 1 132 9 view .LVU695
+	leaq	-512(%rdi), %rdx	#, tmp381
+# blake2bp.c:133:     return len < BLAKE2B_BLOCK ? len : BLAKE2B_BLOCK;
+	.loc 1 133 28 view .LVU696
+	cmpq	%rcx, %rdx	# tmp555, tmp381
+	cmova	%rcx, %rdx	# tmp381,, tmp555, tmp382
+.LBE199:
+.LBE206:
+# blake2bp.c:159:                 len[i][n[i]++] = k;
+	.loc 1 159 32 view .LVU697
+	movq	%rdx, 256(%rsp,%rax,8)	# tmp382, len[_780][_6]
+.LVL100:
+.L58:
+	.loc 1 159 32 view .LVU698
+.LBE211:
+	.loc 1 155 41 is_stmt 1 discriminator 2 view .LVU699
+	.loc 1 155 32 discriminator 2 view .LVU700
+.LBE215:
+	.loc 1 162 9 discriminator 2 view .LVU701
+# blake2bp.c:162:         memset(last[i], 0, BLAKE2B_BLOCK);
+	.loc 1 162 20 is_stmt 0 discriminator 2 view .LVU702
+	movq	80(%rsp), %rax	# %sfp, tmp537
+# blake2bp.c:163:         if (n[i])
+	.loc 1 163 14 discriminator 2 view .LVU703
+	movl	(%r10,%r14,4), %r15d	# MEM[(unsigned int *)&n + ivtmp.381_814 * 4],
+# blake2bp.c:162:         memset(last[i], 0, BLAKE2B_BLOCK);
+	.loc 1 162 9 discriminator 2 view .LVU704
+	movl	$16, %ecx	#, tmp387
+# blake2bp.c:162:         memset(last[i], 0, BLAKE2B_BLOCK);
+	.loc 1 162 20 discriminator 2 view .LVU705
+	addq	%rax, %r8	# tmp537, _9
+# blake2bp.c:162:         memset(last[i], 0, BLAKE2B_BLOCK);
+	.loc 1 162 9 discriminator 2 view .LVU706
+	xorl	%eax, %eax	# tmp595
+	movq	%r8, %rdi	# _9, _9
+	rep stosq
+	.loc 1 163 9 is_stmt 1 discriminator 2 view .LVU707
+# blake2bp.c:163:         if (n[i])
+	.loc 1 163 12 is_stmt 0 discriminator 2 view .LVU708
+	testl	%r15d, %r15d	# _10
+	jne	.L100	#,
+	.loc 1 166 13 is_stmt 1 view .LVU709
+# blake2bp.c:166:             len[i][n[i]++] = 0;
+	.loc 1 166 24 is_stmt 0 view .LVU710
+	movl	$1, (%r10,%r14,4)	#, MEM[(unsigned int *)&n + ivtmp.381_814 * 4]
+# blake2bp.c:166:             len[i][n[i]++] = 0;
+	.loc 1 166 28 view .LVU711
+	movl	$1, %edx	#, prephitmp_725
+	movq	$0, 256(%rsp,%r11)	#, MEM[(long unsigned int *)&len + ivtmp.402_798 * 1]
+.LVL101:
+.L60:
+	.loc 1 167 9 is_stmt 1 view .LVU712
+# blake2bp.c:167:         blk[i][n[i]-1] = last[i];
+	.loc 1 167 24 is_stmt 0 view .LVU713
+	leaq	(%rbx,%rbx,2), %rax	#, tmp414
+	addq	%r15, %rax	# _10, tmp415
+	cmpl	%edx, %r9d	# prephitmp_725, rounds
+	movq	%r8, 160(%rsp,%rax,8)	# _9, blk[_780][prephitmp_726]
+	.loc 1 168 9 is_stmt 1 view .LVU714
+.LBB216:
+.LBB217:
+.LBB218:
+# blake2b-internal.h:92:         L->H[i][l] = ctx->H[i];
+	.loc 2 92 20 is_stmt 0 view .LVU715
+	movq	-64(%r12), %rax	# MEM <const uint64_t> [(const struct blake2b_ctx *)_784 + -64B], MEM <const uint64_t> [(const struct blake2b_ctx *)_784 + -64B]
+	cmovb	%edx, %r9d	# rounds,, prephitmp_725, rounds
+.LVL102:
+	.loc 2 92 20 view .LVU716
+.LBE218:
+.LBE217:
+.LBE216:
+	.loc 1 170 9 is_stmt 1 view .LVU717
+.LBB225:
+.LBI216:
+	.loc 2 88 20 view .LVU718
+.LBB222:
+	.loc 2 91 5 view .LVU719
+.LBB219:
+	.loc 2 91 10 view .LVU720
+	.loc 2 91 28 view .LVU721
+	.loc 2 92 9 view .LVU722
+.LBE219:
+.LBE222:
+.LBE225:
+# blake2bp.c:149:     for (unsigned i = 0; i < BBP_LEAVES; i++) {
+	.loc 1 149 28 is_stmt 0 view .LVU723
+	addq	$1, %r14	#, ivtmp.381
+.LVL103:
+	.loc 1 149 28 view .LVU724
+	addq	$-128, 96(%rsp)	#, %sfp
+	addq	$8, %r13	#, ivtmp.389
+	addq	$24, %r11	#, ivtmp.402
+.LBB226:
+.LBB223:
+.LBB220:
+# blake2b-internal.h:92:         L->H[i][l] = ctx->H[i];
+	.loc 2 92 20 view .LVU725
+	movq	%rax, -8(%r13)	# MEM <const uint64_t> [(const struct blake2b_ctx *)_784 + -64B], MEM[(long unsigned int *)_779]
+	.loc 2 91 34 is_stmt 1 view .LVU726
+.LVL104:
+	.loc 2 91 28 view .LVU727
+	.loc 2 92 9 view .LVU728
+# blake2b-internal.h:92:         L->H[i][l] = ctx->H[i];
+	.loc 2 92 20 is_stmt 0 view .LVU729
+	movq	-56(%r12), %rax	# MEM <const uint64_t> [(const struct blake2b_ctx *)_784 + -56B], MEM <const uint64_t> [(const struct blake2b_ctx *)_784 + -56B]
+.LBE220:
+.LBE223:
+.LBE226:
+# blake2bp.c:149:     for (unsigned i = 0; i < BBP_LEAVES; i++) {
+	.loc 1 149 28 view .LVU730
+	addq	$256, %r12	#, ivtmp.396
+	subq	$-128, 104(%rsp)	#, %sfp
+.LBB227:
+.LBB224:
+.LBB221:
+# blake2b-internal.h:92:         L->H[i][l] = ctx->H[i];
+	.loc 2 92 20 view .LVU731
+	movq	%rax, 24(%r13)	# MEM <const uint64_t> [(const struct blake2b_ctx *)_784 + -56B], MEM[(long unsigned int *)_779 + 32B]
+	.loc 2 91 34 is_stmt 1 view .LVU732
+.LVL105:
+	.loc 2 91 28 view .LVU733
+	.loc 2 92 9 view .LVU734
+# blake2b-internal.h:92:         L->H[i][l] = ctx->H[i];
+	.loc 2 92 20 is_stmt 0 view .LVU735
+	movq	-304(%r12), %rax	# MEM <const uint64_t> [(const struct blake2b_ctx *)_784 + -48B], MEM <const uint64_t> [(const struct blake2b_ctx *)_784 + -48B]
+	movq	%rax, 56(%r13)	# MEM <const uint64_t> [(const struct blake2b_ctx *)_784 + -48B], MEM[(long unsigned int *)_779 + 64B]
+	.loc 2 91 34 is_stmt 1 view .LVU736
+.LVL106:
+	.loc 2 91 28 view .LVU737
+	.loc 2 92 9 view .LVU738
+# blake2b-internal.h:92:         L->H[i][l] = ctx->H[i];
+	.loc 2 92 20 is_stmt 0 view .LVU739
+	movq	-296(%r12), %rax	# MEM <const uint64_t> [(const struct blake2b_ctx *)_784 + -40B], MEM <const uint64_t> [(const struct blake2b_ctx *)_784 + -40B]
+	movq	%rax, 88(%r13)	# MEM <const uint64_t> [(const struct blake2b_ctx *)_784 + -40B], MEM[(long unsigned int *)_779 + 96B]
+	.loc 2 91 34 is_stmt 1 view .LVU740
+.LVL107:
+	.loc 2 91 28 view .LVU741
+	.loc 2 92 9 view .LVU742
+# blake2b-internal.h:92:         L->H[i][l] = ctx->H[i];
+	.loc 2 92 20 is_stmt 0 view .LVU743
+	movq	-288(%r12), %rax	# MEM <const uint64_t> [(const struct blake2b_ctx *)_784 + -32B], MEM <const uint64_t> [(const struct blake2b_ctx *)_784 + -32B]
+	movq	%rax, 120(%r13)	# MEM <const uint64_t> [(const struct blake2b_ctx *)_784 + -32B], MEM[(long unsigned int *)_779 + 128B]
+	.loc 2 91 34 is_stmt 1 view .LVU744
+.LVL108:
+	.loc 2 91 28 view .LVU745
+	.loc 2 92 9 view .LVU746
+# blake2b-internal.h:92:         L->H[i][l] = ctx->H[i];
+	.loc 2 92 20 is_stmt 0 view .LVU747
+	movq	-280(%r12), %rax	# MEM <const uint64_t> [(const struct blake2b_ctx *)_784 + -24B], MEM <const uint64_t> [(const struct blake2b_ctx *)_784 + -24B]
+	movq	%rax, 152(%r13)	# MEM <const uint64_t> [(const struct blake2b_ctx *)_784 + -24B], MEM[(long unsigned int *)_779 + 160B]
+	.loc 2 91 34 is_stmt 1 view .LVU748
+.LVL109:
+	.loc 2 91 28 view .LVU749
+	.loc 2 92 9 view .LVU750
+# blake2b-internal.h:92:         L->H[i][l] = ctx->H[i];
+	.loc 2 92 20 is_stmt 0 view .LVU751
+	movq	-272(%r12), %rax	# MEM <const uint64_t> [(const struct blake2b_ctx *)_784 + -16B], MEM <const uint64_t> [(const struct blake2b_ctx *)_784 + -16B]
+	movq	%rax, 184(%r13)	# MEM <const uint64_t> [(const struct blake2b_ctx *)_784 + -16B], MEM[(long unsigned int *)_779 + 192B]
+	.loc 2 91 34 is_stmt 1 view .LVU752
+.LVL110:
+	.loc 2 91 28 view .LVU753
+	.loc 2 92 9 view .LVU754
+# blake2b-internal.h:92:         L->H[i][l] = ctx->H[i];
+	.loc 2 92 20 is_stmt 0 view .LVU755
+	movq	-264(%r12), %rax	# MEM <const uint64_t> [(const struct blake2b_ctx *)_784 + -8B], MEM <const uint64_t> [(const struct blake2b_ctx *)_784 + -8B]
+	movq	%rax, 216(%r13)	# MEM <const uint64_t> [(const struct blake2b_ctx *)_784 + -8B], MEM[(long unsigned int *)_779 + 224B]
+	.loc 2 91 34 is_stmt 1 view .LVU756
+.LVL111:
+	.loc 2 91 28 view .LVU757
+.LBE221:
+	.loc 2 93 5 view .LVU758
+# blake2b-internal.h:93:     L->t[0][l] = ctx->t[0];
+	.loc 2 93 16 is_stmt 0 view .LVU759
+	movq	-128(%r12), %rax	# MEM <const uint64_t> [(const struct blake2b_ctx *)_784 + 128B], MEM <const uint64_t> [(const struct blake2b_ctx *)_784 + 128B]
+	movq	%rax, 248(%r13)	# MEM <const uint64_t> [(const struct blake2b_ctx *)_784 + 128B], MEM[(long unsigned int *)_779 + 256B]
+	.loc 2 94 5 is_stmt 1 view .LVU760
+# blake2b-internal.h:94:     L->t[1][l] = ctx->t[1];
+	.loc 2 94 16 is_stmt 0 view .LVU761
+	movq	-120(%r12), %rax	# MEM <const uint64_t> [(const struct blake2b_ctx *)_784 + 136B], MEM <const uint64_t> [(const struct blake2b_ctx *)_784 + 136B]
+	movq	%rax, 280(%r13)	# MEM <const uint64_t> [(const struct blake2b_ctx *)_784 + 136B], MEM[(long unsigned int *)_779 + 288B]
+	.loc 2 95 5 is_stmt 1 view .LVU762
+# blake2b-internal.h:95:     L->f[0][l] = ctx->f[0];
+	.loc 2 95 16 is_stmt 0 view .LVU763
+	movq	-112(%r12), %rax	# MEM <const uint64_t> [(const struct blake2b_ctx *)_784 + 144B], MEM <const uint64_t> [(const struct blake2b_ctx *)_784 + 144B]
+	movq	%rax, 312(%r13)	# MEM <const uint64_t> [(const struct blake2b_ctx *)_784 + 144B], MEM[(long unsigned int *)_779 + 320B]
+	.loc 2 96 5 is_stmt 1 view .LVU764
+# blake2b-internal.h:96:     L->f[1][l] = ctx->f[1];
+	.loc 2 96 16 is_stmt 0 view .LVU765
+	movq	-104(%r12), %rax	# MEM <const uint64_t> [(const struct blake2b_ctx *)_784 + 152B], MEM <const uint64_t> [(const struct blake2b_ctx *)_784 + 152B]
+	movq	%rax, 344(%r13)	# MEM <const uint64_t> [(const struct blake2b_ctx *)_784 + 152B], MEM[(long unsigned int *)_779 + 352B]
+.LVL112:
+	.loc 2 96 16 view .LVU766
+.LBE224:
+.LBE227:
+	.loc 1 149 34 is_stmt 1 view .LVU767
+	.loc 1 149 28 view .LVU768
+	cmpq	$4, %r14	#, ivtmp.381
+	jne	.L61	#,
+	movq	32(%rsp), %rdx	# %sfp, ivtmp.372
+	movq	24(%rsp), %rax	# %sfp, ctx
+	movl	%r9d, %r15d	# rounds,
+.LBE232:
+.LBB233:
+.LBB234:
+.LBB235:
+# blake2bp.c:176:             if (r >= n[i])
+	.loc 1 176 23 is_stmt 0 view .LVU769
+	xorl	%ebx, %ebx	# ivtmp.375
+.LVL113:
+	.loc 1 176 23 view .LVU770
+.LBE235:
+.LBE234:
+.LBE233:
+.LBB255:
+	movq	16(%rsp), %rdi	# %sfp, tmp534
+.LVL114:
+	.loc 1 176 23 view .LVU771
+.LBE255:
+.LBB256:
+	.loc 1 173 28 is_stmt 1 view .LVU772
+.LBB252:
+.LBB244:
+# blake2bp.c:176:             if (r >= n[i])
+	.loc 1 176 23 is_stmt 0 view .LVU773
+	movl	112(%rsp), %esi	# n[0], pretmp_727
+	movq	%r15, 80(%rsp)	# _662, %sfp
+	leaq	128(%rsp), %rcx	#, tmp539
+	movq	%rcx, 88(%rsp)	# tmp539, %sfp
+	movl	116(%rsp), %r14d	# n[1], pretmp_729
+	movq	%rbx, %r15	# ivtmp.375, ivtmp.375
+	movq	%rdx, 72(%rsp)	# ivtmp.372, %sfp
+	movl	120(%rsp), %r13d	# n[2], pretmp_731
+	movl	%esi, %ebx	# pretmp_727, pretmp_727
+	movq	%rax, 96(%rsp)	# ctx, %sfp
+	movl	124(%rsp), %r12d	# n[3], pretmp_733
+	movq	%rdi, 104(%rsp)	# tmp534, %sfp
+.LVL115:
+.L88:
+	.loc 1 175 32 is_stmt 1 view .LVU774
+	.loc 1 176 13 view .LVU775
+	movl	%r15d, %edx	# ivtmp.375, r
+# blake2bp.c:176:             if (r >= n[i])
+	.loc 1 176 16 is_stmt 0 view .LVU776
+	cmpl	%ebx, %r15d	# pretmp_727, ivtmp.375
+	jnb	.L90	#,
+	.loc 1 178 13 is_stmt 1 view .LVU777
+# blake2bp.c:178:             m[i] = blk[i][r];
+	.loc 1 178 18 is_stmt 0 view .LVU778
+	movq	160(%rsp,%r15,8), %rcx	# MEM[(const void * *)&blk + ivtmp.375_659 * 8], MEM[(const void * *)&blk + ivtmp.375_659 * 8]
+	movq	%rcx, 128(%rsp)	# MEM[(const void * *)&blk + ivtmp.375_659 * 8], m[0]
+	.loc 1 179 13 is_stmt 1 view .LVU779
+.LVL116:
+.LBB236:
+.LBI236:
+	.loc 2 110 20 view .LVU780
+.LBB237:
+	.loc 2 112 5 view .LVU781
+	movq	864(%rsp), %rcx	# L.t[0][0], L.t[0][0]
+	addq	256(%rsp,%r15,8), %rcx	# MEM[(long unsigned int *)&len + ivtmp.375_659 * 8], tmp431
+# blake2b-internal.h:113:     L->t[1][l] += (L->t[0][l] < inc);
+	.loc 2 113 16 is_stmt 0 view .LVU782
+	adcq	$0, 896(%rsp)	# L.t[1][0]
+# blake2b-internal.h:112:     L->t[0][l] += inc;
+	.loc 2 112 16 view .LVU783
+	movq	%rcx, 864(%rsp)	# tmp431, L.t[0][0]
+	.loc 2 113 5 is_stmt 1 view .LVU784
+.LVL117:
+	.loc 2 113 5 is_stmt 0 view .LVU785
+.LBE237:
+.LBE236:
+	.loc 1 180 13 is_stmt 1 view .LVU786
+# blake2bp.c:180:             if (r == n[i] - 1) {
+	.loc 1 180 27 is_stmt 0 view .LVU787
+	leal	-1(%rbx), %ecx	#, tmp436
+# blake2bp.c:180:             if (r == n[i] - 1) {
+	.loc 1 180 16 view .LVU788
+	cmpl	%r15d, %ecx	# r, tmp436
+	je	.L101	#,
+.L68:
+.LBE244:
+# blake2bp.c:174:         unsigned mask = 0;
+	.loc 1 174 18 view .LVU789
+	movl	$3, %ecx	#, mask
+.LBB245:
+# blake2bp.c:185:             mask |= 1u << i;
+	.loc 1 185 18 view .LVU790
+	movl	$1, %esi	#, mask
+.L64:
+.LVL118:
+	.loc 1 175 38 is_stmt 1 view .LVU791
+	.loc 1 175 32 view .LVU792
+	.loc 1 176 13 view .LVU793
+# blake2bp.c:176:             if (r >= n[i])
+	.loc 1 176 16 is_stmt 0 view .LVU794
+	cmpl	%r14d, %edx	# pretmp_729, r
+	jnb	.L91	#,
+	.loc 1 178 13 is_stmt 1 view .LVU795
+# blake2bp.c:178:             m[i] = blk[i][r];
+	.loc 1 178 18 is_stmt 0 view .LVU796
+	movq	184(%rsp,%r15,8), %rsi	# MEM[(const void * *)&blk + 24B + ivtmp.375_659 * 8], MEM[(const void * *)&blk + 24B + ivtmp.375_659 * 8]
+.LVL119:
+	.loc 1 178 18 view .LVU797
+	movq	%rsi, 136(%rsp)	# MEM[(const void * *)&blk + 24B + ivtmp.375_659 * 8], m[1]
+	.loc 1 179 13 is_stmt 1 view .LVU798
+.LVL120:
+.LBB241:
+	.loc 2 110 20 view .LVU799
+.LBB238:
+	.loc 2 112 5 view .LVU800
+	movq	872(%rsp), %rsi	# L.t[0][1], L.t[0][1]
+	addq	280(%rsp,%r15,8), %rsi	# MEM[(long unsigned int *)&len + 24B + ivtmp.375_659 * 8], tmp442
+# blake2b-internal.h:113:     L->t[1][l] += (L->t[0][l] < inc);
+	.loc 2 113 16 is_stmt 0 view .LVU801
+	adcq	$0, 904(%rsp)	# L.t[1][1]
+# blake2b-internal.h:112:     L->t[0][l] += inc;
+	.loc 2 112 16 view .LVU802
+	movq	%rsi, 872(%rsp)	# tmp442, L.t[0][1]
+	.loc 2 113 5 is_stmt 1 view .LVU803
+.LVL121:
+	.loc 2 113 5 is_stmt 0 view .LVU804
+.LBE238:
+.LBE241:
+	.loc 1 180 13 is_stmt 1 view .LVU805
+# blake2bp.c:180:             if (r == n[i] - 1) {
+	.loc 1 180 27 is_stmt 0 view .LVU806
+	leal	-1(%r14), %esi	#, tmp447
+# blake2bp.c:180:             if (r == n[i] - 1) {
+	.loc 1 180 16 view .LVU807
+	cmpl	%edx, %esi	# r, tmp447
+	je	.L102	#,
+.L70:
+.LVL122:
+	.loc 1 175 38 is_stmt 1 view .LVU808
+	.loc 1 175 32 view .LVU809
+	.loc 1 176 13 view .LVU810
+# blake2bp.c:176:             if (r >= n[i])
+	.loc 1 176 16 is_stmt 0 view .LVU811
+	cmpl	%r13d, %edx	# pretmp_731, r
+	jnb	.L76	#,
+	.loc 1 178 13 is_stmt 1 view .LVU812
+# blake2bp.c:178:             m[i] = blk[i][r];
+	.loc 1 178 18 is_stmt 0 view .LVU813
+	movq	208(%rsp,%r15,8), %rsi	# MEM[(const void * *)&blk + 48B + ivtmp.375_659 * 8], MEM[(const void * *)&blk + 48B + ivtmp.375_659 * 8]
+	movq	%rsi, 144(%rsp)	# MEM[(const void * *)&blk + 48B + ivtmp.375_659 * 8], m[2]
+	.loc 1 179 13 is_stmt 1 view .LVU814
+.LVL123:
+.LBB242:
+	.loc 2 110 20 view .LVU815
+.LBB239:
+	.loc 2 112 5 view .LVU816
+	movq	880(%rsp), %rsi	# L.t[0][2], L.t[0][2]
+	addq	304(%rsp,%r15,8), %rsi	# MEM[(long unsigned int *)&len + 48B + ivtmp.375_659 * 8], tmp453
+# blake2b-internal.h:113:     L->t[1][l] += (L->t[0][l] < inc);
+	.loc 2 113 16 is_stmt 0 view .LVU817
+	adcq	$0, 912(%rsp)	# L.t[1][2]
+# blake2b-internal.h:112:     L->t[0][l] += inc;
+	.loc 2 112 16 view .LVU818
+	movq	%rsi, 880(%rsp)	# tmp453, L.t[0][2]
+	.loc 2 113 5 is_stmt 1 view .LVU819
+.LVL124:
+	.loc 2 113 5 is_stmt 0 view .LVU820
+.LBE239:
+.LBE242:
+	.loc 1 180 13 is_stmt 1 view .LVU821
+# blake2bp.c:180:             if (r == n[i] - 1) {
+	.loc 1 180 27 is_stmt 0 view .LVU822
+	leal	-1(%r13), %esi	#, tmp458
+# blake2bp.c:180:             if (r == n[i] - 1) {
+	.loc 1 180 16 view .LVU823
+	cmpl	%edx, %esi	# r, tmp458
+	je	.L79	#,
+.L81:
+	.loc 1 185 13 is_stmt 1 view .LVU824
+# blake2bp.c:185:             mask |= 1u << i;
+	.loc 1 185 18 is_stmt 0 view .LVU825
+	orl	$4, %ecx	#, mask
+.LVL125:
+.L76:
+	.loc 1 175 38 is_stmt 1 view .LVU826
+	.loc 1 175 32 view .LVU827
+	.loc 1 176 13 view .LVU828
+# blake2bp.c:176:             if (r >= n[i])
+	.loc 1 176 16 is_stmt 0 view .LVU829
+	cmpl	%r12d, %edx	# pretmp_733, r
+	jnb	.L82	#,
+	.loc 1 178 13 is_stmt 1 view .LVU830
+# blake2bp.c:178:             m[i] = blk[i][r];
+	.loc 1 178 18 is_stmt 0 view .LVU831
+	movq	232(%rsp,%r15,8), %rsi	# MEM[(const void * *)&blk + 72B + ivtmp.375_659 * 8], MEM[(const void * *)&blk + 72B + ivtmp.375_659 * 8]
+	movq	%rsi, 152(%rsp)	# MEM[(const void * *)&blk + 72B + ivtmp.375_659 * 8], m[3]
+	.loc 1 179 13 is_stmt 1 view .LVU832
+.LVL126:
+.LBB243:
+	.loc 2 110 20 view .LVU833
+.LBB240:
+	.loc 2 112 5 view .LVU834
+	movq	888(%rsp), %rsi	# L.t[0][3], L.t[0][3]
+	addq	328(%rsp,%r15,8), %rsi	# MEM[(long unsigned int *)&len + 72B + ivtmp.375_659 * 8], tmp464
+# blake2b-internal.h:113:     L->t[1][l] += (L->t[0][l] < inc);
+	.loc 2 113 16 is_stmt 0 view .LVU835
+	adcq	$0, 920(%rsp)	# L.t[1][3]
+# blake2b-internal.h:112:     L->t[0][l] += inc;
+	.loc 2 112 16 view .LVU836
+	movq	%rsi, 888(%rsp)	# tmp464, L.t[0][3]
+	.loc 2 113 5 is_stmt 1 view .LVU837
+.LVL127:
+	.loc 2 113 5 is_stmt 0 view .LVU838
+.LBE240:
+.LBE243:
+	.loc 1 180 13 is_stmt 1 view .LVU839
+# blake2bp.c:180:             if (r == n[i] - 1) {
+	.loc 1 180 27 is_stmt 0 view .LVU840
+	leal	-1(%r12), %esi	#, tmp469
+# blake2bp.c:180:             if (r == n[i] - 1) {
+	.loc 1 180 16 view .LVU841
+	cmpl	%edx, %esi	# r, tmp469
+	je	.L85	#,
+.L87:
+	.loc 1 185 13 is_stmt 1 view .LVU842
+# blake2bp.c:185:             mask |= 1u << i;
+	.loc 1 185 18 is_stmt 0 view .LVU843
+	orl	$8, %ecx	#, mask
+.LVL128:
+.L82:
+	.loc 1 175 38 is_stmt 1 view .LVU844
+	.loc 1 175 32 view .LVU845
+.LBE245:
+	.loc 1 187 9 view .LVU846
+.LBB246:
+.LBI246:
+	.loc 2 81 20 view .LVU847
+.LBB247:
+	.loc 2 84 5 view .LVU848
+	movl	%ecx, %edx	# mask,
+	movq	88(%rsp), %rsi	# %sfp,
+	movq	104(%rsp), %rdi	# %sfp,
+.LBE247:
+.LBE246:
+.LBE252:
+# blake2bp.c:173:     for (unsigned r = 0; r < rounds; r++) {
+	.loc 1 173 28 is_stmt 0 view .LVU849
+	addq	$1, %r15	#, ivtmp.375
+.LVL129:
+.LBB253:
+.LBB249:
+.LBB248:
+# blake2b-internal.h:84:     blake2b_kern->compress_lanes(L, m, mask);
+	.loc 2 84 5 view .LVU850
+	movq	blake2b_kern(%rip), %rcx	# blake2b_kern, blake2b_kern
+.LVL130:
+	.loc 2 84 5 view .LVU851
+	call	*40(%rcx)	# blake2b_kern.0_104->compress_lanes
+.LVL131:
+	.loc 2 84 5 view .LVU852
+.LBE248:
+.LBE249:
+.LBE253:
+	.loc 1 173 39 is_stmt 1 view .LVU853
+	.loc 1 173 28 view .LVU854
+	movq	80(%rsp), %rax	# %sfp, _662
+	cmpq	%rax, %r15	# _662, ivtmp.375
+	jne	.L88	#,
+	movq	96(%rsp), %rax	# %sfp, ctx
+	leaq	352(%rsp), %rsi	#, tmp536
+	movq	72(%rsp), %rdx	# %sfp, ivtmp.372
+	movq	104(%rsp), %rdi	# %sfp, tmp534
+.LVL132:
+	.loc 1 173 28 is_stmt 0 view .LVU855
+.LBE256:
+.LBB257:
+	.loc 1 189 28 is_stmt 1 view .LVU856
+	movq	%rsi, %rcx	# tmp536, ivtmp.373
+	movq	%rax, %r9	# ctx, ctx
+.LVL133:
+	.p2align 4,,10
+	.p2align 3
+.L63:
+.LBB258:
+	.loc 1 190 32 view .LVU857
+	.loc 1 191 13 view .LVU858
+	movq	(%rdx), %rbx	# MEM[(long unsigned int *)_585], _141
+.LVL134:
+.LBB259:
+.LBI259:
+	.loc 2 120 20 view .LVU859
+.LBB260:
+	.loc 2 122 5 view .LVU860
+.LBB261:
+.LBI261:
+	.file 3 "blake2s-internal.h"
+	.loc 3 222 20 view .LVU861
+.LBB262:
+	.loc 3 223 5 view .LVU862
+# blake2s-internal.h:225:     *y++ = (x >> 16) & 0xff;
+	.loc 3 225 15 is_stmt 0 view .LVU863
+	movl	%ebx, %r8d	# _141, tmp477
+# blake2s-internal.h:223:     *y++ = x & 0xff;
+	.loc 3 223 10 view .LVU864
+	movb	%bl, (%rcx)	# _141, MEM[(unsigned char *)_593]
+	.loc 3 224 5 is_stmt 1 view .LVU865
+.LVL135:
+# blake2s-internal.h:225:     *y++ = (x >> 16) & 0xff;
+	.loc 3 225 15 is_stmt 0 view .LVU866
+	shrl	$16, %r8d	#, tmp477
+# blake2s-internal.h:224:     *y++ = (x >>  8) & 0xff;
+	.loc 3 224 10 view .LVU867
+	movb	%bh, 1(%rcx)	# _141, MEM[(unsigned char *)_593 + 1B]
+	.loc 3 225 5 is_stmt 1 view .LVU868
+.LVL136:
+# blake2s-internal.h:225:     *y++ = (x >> 16) & 0xff;
+	.loc 3 225 10 is_stmt 0 view .LVU869
+	movb	%r8b, 2(%rcx)	# tmp477, MEM[(unsigned char *)_593 + 2B]
+	.loc 3 226 5 is_stmt 1 view .LVU870
+.LVL137:
+# blake2s-internal.h:226:     *y++ = (x >> 24) & 0xff;
+	.loc 3 226 22 is_stmt 0 view .LVU871
+	movl	%ebx, %r8d	# _141, tmp478
+.LBE262:
+.LBE261:
+# blake2b-internal.h:123:     write_le32(y + 4, (u32)(x >> 32));
+	.loc 2 123 31 view .LVU872
+	shrq	$32, %rbx	#, _158
+.LVL138:
+.LBB284:
+.LBB263:
+# blake2s-internal.h:226:     *y++ = (x >> 24) & 0xff;
+	.loc 3 226 22 view .LVU873
+	shrl	$24, %r8d	#, tmp478
+.LVL139:
+	.loc 3 226 22 view .LVU874
+.LBE263:
+.LBE284:
+.LBB285:
+.LBB286:
+# blake2s-internal.h:223:     *y++ = x & 0xff;
+	.loc 3 223 10 view .LVU875
+	movb	%bl, 4(%rcx)	# _158, MEM[(unsigned char *)_593 + 4B]
+.LBE286:
+.LBE285:
+.LBB307:
+.LBB264:
+# blake2s-internal.h:226:     *y++ = (x >> 24) & 0xff;
+	.loc 3 226 10 view .LVU876
+	movb	%r8b, 3(%rcx)	# tmp478, MEM[(unsigned char *)_593 + 3B]
+.LVL140:
+	.loc 3 226 10 view .LVU877
+.LBE264:
+.LBE307:
+	.loc 2 123 5 is_stmt 1 view .LVU878
+.LBB308:
+.LBI285:
+	.loc 3 222 20 view .LVU879
+.LBB287:
+	.loc 3 223 5 view .LVU880
+	.loc 3 224 5 view .LVU881
+# blake2s-internal.h:225:     *y++ = (x >> 16) & 0xff;
+	.loc 3 225 15 is_stmt 0 view .LVU882
+	movl	%ebx, %r8d	# _158, tmp480
+# blake2s-internal.h:224:     *y++ = (x >>  8) & 0xff;
+	.loc 3 224 10 view .LVU883
+	movb	%bh, 5(%rcx)	# _158, MEM[(unsigned char *)_593 + 5B]
+	.loc 3 225 5 is_stmt 1 view .LVU884
+.LVL141:
+# blake2s-internal.h:226:     *y++ = (x >> 24) & 0xff;
+	.loc 3 226 22 is_stmt 0 view .LVU885
+	shrl	$24, %ebx	#, tmp481
+.LVL142:
+# blake2s-internal.h:225:     *y++ = (x >> 16) & 0xff;
+	.loc 3 225 15 view .LVU886
+	shrl	$16, %r8d	#, tmp480
+.LVL143:
+# blake2s-internal.h:226:     *y++ = (x >> 24) & 0xff;
+	.loc 3 226 10 view .LVU887
+	movb	%bl, 7(%rcx)	# tmp481, MEM[(unsigned char *)_593 + 7B]
+.LBE287:
+.LBE308:
+.LBE260:
+.LBE259:
+# blake2bp.c:191:             write_le64(hash[i] + 8*w, L.H[w][i]);
+	.loc 1 191 13 view .LVU888
+	movq	32(%rdx), %rbx	# MEM[(long unsigned int *)_585 + 32B], _174
+.LBB362:
+.LBB347:
+.LBB309:
+.LBB288:
+# blake2s-internal.h:225:     *y++ = (x >> 16) & 0xff;
+	.loc 3 225 10 view .LVU889
+	movb	%r8b, 6(%rcx)	# tmp480, MEM[(unsigned char *)_593 + 6B]
+	.loc 3 226 5 is_stmt 1 view .LVU890
+.LVL144:
+	.loc 3 226 5 is_stmt 0 view .LVU891
+.LBE288:
+.LBE309:
+.LBE347:
+.LBE362:
+	.loc 1 190 38 is_stmt 1 view .LVU892
+	.loc 1 190 32 view .LVU893
+	.loc 1 191 13 view .LVU894
+.LBB363:
+	.loc 2 120 20 view .LVU895
+.LBB348:
+	.loc 2 122 5 view .LVU896
+.LBB310:
+	.loc 3 222 20 view .LVU897
+.LBB265:
+	.loc 3 223 5 view .LVU898
+# blake2s-internal.h:225:     *y++ = (x >> 16) & 0xff;
+	.loc 3 225 15 is_stmt 0 view .LVU899
+	movl	%ebx, %r8d	# _174, tmp483
+# blake2s-internal.h:223:     *y++ = x & 0xff;
+	.loc 3 223 10 view .LVU900
+	movb	%bl, 8(%rcx)	# _174, MEM[(unsigned char *)_593 + 8B]
+	.loc 3 224 5 is_stmt 1 view .LVU901
+.LVL145:
+# blake2s-internal.h:225:     *y++ = (x >> 16) & 0xff;
+	.loc 3 225 15 is_stmt 0 view .LVU902
+	shrl	$16, %r8d	#, tmp483
+# blake2s-internal.h:224:     *y++ = (x >>  8) & 0xff;
+	.loc 3 224 10 view .LVU903
+	movb	%bh, 9(%rcx)	# _174, MEM[(unsigned char *)_593 + 9B]
+	.loc 3 225 5 is_stmt 1 view .LVU904
+.LVL146:
+# blake2s-internal.h:225:     *y++ = (x >> 16) & 0xff;
+	.loc 3 225 10 is_stmt 0 view .LVU905
+	movb	%r8b, 10(%rcx)	# tmp483, MEM[(unsigned char *)_593 + 10B]
+	.loc 3 226 5 is_stmt 1 view .LVU906
+.LVL147:
+# blake2s-internal.h:226:     *y++ = (x >> 24) & 0xff;
+	.loc 3 226 22 is_stmt 0 view .LVU907
+	movl	%ebx, %r8d	# _174, tmp484
+.LBE265:
+.LBE310:
+# blake2b-internal.h:123:     write_le32(y + 4, (u32)(x >> 32));
+	.loc 2 123 31 view .LVU908
+	shrq	$32, %rbx	#, _191
+.LVL148:
+.LBB311:
+.LBB266:
+# blake2s-internal.h:226:     *y++ = (x >> 24) & 0xff;
+	.loc 3 226 22 view .LVU909
+	shrl	$24, %r8d	#, tmp484
+.LVL149:
+	.loc 3 226 22 view .LVU910
+.LBE266:
+.LBE311:
+.LBB312:
+.LBB289:
+# blake2s-internal.h:223:     *y++ = x & 0xff;
+	.loc 3 223 10 view .LVU911
+	movb	%bl, 12(%rcx)	# _191, MEM[(unsigned char *)_593 + 12B]
+.LBE289:
+.LBE312:
+.LBB313:
+.LBB267:
+# blake2s-internal.h:226:     *y++ = (x >> 24) & 0xff;
+	.loc 3 226 10 view .LVU912
+	movb	%r8b, 11(%rcx)	# tmp484, MEM[(unsigned char *)_593 + 11B]
+.LVL150:
+	.loc 3 226 10 view .LVU913
+.LBE267:
+.LBE313:
+	.loc 2 123 5 is_stmt 1 view .LVU914
+.LBB314:
+	.loc 3 222 20 view .LVU915
+.LBB290:
+	.loc 3 223 5 view .LVU916
+	.loc 3 224 5 view .LVU917
+# blake2s-internal.h:225:     *y++ = (x >> 16) & 0xff;
+	.loc 3 225 15 is_stmt 0 view .LVU918
+	movl	%ebx, %r8d	# _191, tmp486
+# blake2s-internal.h:224:     *y++ = (x >>  8) & 0xff;
+	.loc 3 224 10 view .LVU919
+	movb	%bh, 13(%rcx)	# _191, MEM[(unsigned char *)_593 + 13B]
+	.loc 3 225 5 is_stmt 1 view .LVU920
+.LVL151:
+# blake2s-internal.h:226:     *y++ = (x >> 24) & 0xff;
+	.loc 3 226 22 is_stmt 0 view .LVU921
+	shrl	$24, %ebx	#, tmp487
+.LVL152:
+# blake2s-internal.h:225:     *y++ = (x >> 16) & 0xff;
+	.loc 3 225 15 view .LVU922
+	shrl	$16, %r8d	#, tmp486
+.LVL153:
+# blake2s-internal.h:226:     *y++ = (x >> 24) & 0xff;
+	.loc 3 226 10 view .LVU923
+	movb	%bl, 15(%rcx)	# tmp487, MEM[(unsigned char *)_593 + 15B]
+.LBE290:
+.LBE314:
+.LBE348:
+.LBE363:
+# blake2bp.c:191:             write_le64(hash[i] + 8*w, L.H[w][i]);
+	.loc 1 191 13 view .LVU924
+	movq	64(%rdx), %rbx	# MEM[(long unsigned int *)_585 + 64B], _207
+.LBB364:
+.LBB349:
+.LBB315:
+.LBB291:
+# blake2s-internal.h:225:     *y++ = (x >> 16) & 0xff;
+	.loc 3 225 10 view .LVU925
+	movb	%r8b, 14(%rcx)	# tmp486, MEM[(unsigned char *)_593 + 14B]
+	.loc 3 226 5 is_stmt 1 view .LVU926
+.LVL154:
+	.loc 3 226 5 is_stmt 0 view .LVU927
+.LBE291:
+.LBE315:
+.LBE349:
+.LBE364:
+	.loc 1 190 38 is_stmt 1 view .LVU928
+	.loc 1 190 32 view .LVU929
+	.loc 1 191 13 view .LVU930
+.LBB365:
+	.loc 2 120 20 view .LVU931
+.LBB350:
+	.loc 2 122 5 view .LVU932
+.LBB316:
+	.loc 3 222 20 view .LVU933
+.LBB268:
+	.loc 3 223 5 view .LVU934
+# blake2s-internal.h:225:     *y++ = (x >> 16) & 0xff;
+	.loc 3 225 15 is_stmt 0 view .LVU935
+	movl	%ebx, %r8d	# _207, tmp489
+# blake2s-internal.h:223:     *y++ = x & 0xff;
+	.loc 3 223 10 view .LVU936
+	movb	%bl, 16(%rcx)	# _207, MEM[(unsigned char *)_593 + 16B]
+	.loc 3 224 5 is_stmt 1 view .LVU937
+.LVL155:
+# blake2s-internal.h:225:     *y++ = (x >> 16) & 0xff;
+	.loc 3 225 15 is_stmt 0 view .LVU938
+	shrl	$16, %r8d	#, tmp489
+# blake2s-internal.h:224:     *y++ = (x >>  8) & 0xff;
+	.loc 3 224 10 view .LVU939
+	movb	%bh, 17(%rcx)	# _207, MEM[(unsigned char *)_593 + 17B]
+	.loc 3 225 5 is_stmt 1 view .LVU940
+.LVL156:
+# blake2s-internal.h:225:     *y++ = (x >> 16) & 0xff;
+	.loc 3 225 10 is_stmt 0 view .LVU941
+	movb	%r8b, 18(%rcx)	# tmp489, MEM[(unsigned char *)_593 + 18B]
+	.loc 3 226 5 is_stmt 1 view .LVU942
+.LVL157:
+# blake2s-internal.h:226:     *y++ = (x >> 24) & 0xff;
+	.loc 3 226 22 is_stmt 0 view .LVU943
+	movl	%ebx, %r8d	# _207, tmp490
+.LBE268:
+.LBE316:
+# blake2b-internal.h:123:     write_le32(y + 4, (u32)(x >> 32));
+	.loc 2 123 31 view .LVU944
+	shrq	$32, %rbx	#, _224
+.LVL158:
+.LBB317:
+.LBB269:
+# blake2s-internal.h:226:     *y++ = (x >> 24) & 0xff;
+	.loc 3 226 22 view .LVU945
+	shrl	$24, %r8d	#, tmp490
+.LVL159:
+	.loc 3 226 22 view .LVU946
+.LBE269:
+.LBE317:
+.LBB318:
+.LBB292:
+# blake2s-internal.h:223:     *y++ = x & 0xff;
+	.loc 3 223 10 view .LVU947
+	movb	%bl, 20(%rcx)	# _224, MEM[(unsigned char *)_593 + 20B]
+.LBE292:
+.LBE318:
+.LBB319:
+.LBB270:
+# blake2s-internal.h:226:     *y++ = (x >> 24) & 0xff;
+	.loc 3 226 10 view .LVU948
+	movb	%r8b, 19(%rcx)	# tmp490, MEM[(unsigned char *)_593 + 19B]
+.LVL160:
+	.loc 3 226 10 view .LVU949
+.LBE270:
+.LBE319:
+	.loc 2 123 5 is_stmt 1 view .LVU950
+.LBB320:
+	.loc 3 222 20 view .LVU951
+.LBB293:
+	.loc 3 223 5 view .LVU952
+	.loc 3 224 5 view .LVU953
+# blake2s-internal.h:225:     *y++ = (x >> 16) & 0xff;
+	.loc 3 225 15 is_stmt 0 view .LVU954
+	movl	%ebx, %r8d	# _224, tmp492
+# blake2s-internal.h:224:     *y++ = (x >>  8) & 0xff;
+	.loc 3 224 10 view .LVU955
+	movb	%bh, 21(%rcx)	# _224, MEM[(unsigned char *)_593 + 21B]
+	.loc 3 225 5 is_stmt 1 view .LVU956
+.LVL161:
+# blake2s-internal.h:226:     *y++ = (x >> 24) & 0xff;
+	.loc 3 226 22 is_stmt 0 view .LVU957
+	shrl	$24, %ebx	#, tmp493
+.LVL162:
+# blake2s-internal.h:225:     *y++ = (x >> 16) & 0xff;
+	.loc 3 225 15 view .LVU958
+	shrl	$16, %r8d	#, tmp492
+.LVL163:
+# blake2s-internal.h:226:     *y++ = (x >> 24) & 0xff;
+	.loc 3 226 10 view .LVU959
+	movb	%bl, 23(%rcx)	# tmp493, MEM[(unsigned char *)_593 + 23B]
+.LBE293:
+.LBE320:
+.LBE350:
+.LBE365:
+# blake2bp.c:191:             write_le64(hash[i] + 8*w, L.H[w][i]);
+	.loc 1 191 13 view .LVU960
+	movq	96(%rdx), %rbx	# MEM[(long unsigned int *)_585 + 96B], _240
+.LBB366:
+.LBB351:
+.LBB321:
+.LBB294:
+# blake2s-internal.h:225:     *y++ = (x >> 16) & 0xff;
+	.loc 3 225 10 view .LVU961
+	movb	%r8b, 22(%rcx)	# tmp492, MEM[(unsigned char *)_593 + 22B]
+	.loc 3 226 5 is_stmt 1 view .LVU962
+.LVL164:
+	.loc 3 226 5 is_stmt 0 view .LVU963
+.LBE294:
+.LBE321:
+.LBE351:
+.LBE366:
+	.loc 1 190 38 is_stmt 1 view .LVU964
+	.loc 1 190 32 view .LVU965
+	.loc 1 191 13 view .LVU966
+.LBB367:
+	.loc 2 120 20 view .LVU967
+.LBB352:
+	.loc 2 122 5 view .LVU968
+.LBB322:
+	.loc 3 222 20 view .LVU969
+.LBB271:
+	.loc 3 223 5 view .LVU970
+# blake2s-internal.h:225:     *y++ = (x >> 16) & 0xff;
+	.loc 3 225 15 is_stmt 0 view .LVU971
+	movl	%ebx, %r8d	# _240, tmp495
+# blake2s-internal.h:223:     *y++ = x & 0xff;
+	.loc 3 223 10 view .LVU972
+	movb	%bl, 24(%rcx)	# _240, MEM[(unsigned char *)_593 + 24B]
+	.loc 3 224 5 is_stmt 1 view .LVU973
+.LVL165:
+# blake2s-internal.h:225:     *y++ = (x >> 16) & 0xff;
+	.loc 3 225 15 is_stmt 0 view .LVU974
+	shrl	$16, %r8d	#, tmp495
+# blake2s-internal.h:224:     *y++ = (x >>  8) & 0xff;
+	.loc 3 224 10 view .LVU975
+	movb	%bh, 25(%rcx)	# _240, MEM[(unsigned char *)_593 + 25B]
+	.loc 3 225 5 is_stmt 1 view .LVU976
+.LVL166:
+# blake2s-internal.h:225:     *y++ = (x >> 16) & 0xff;
+	.loc 3 225 10 is_stmt 0 view .LVU977
+	movb	%r8b, 26(%rcx)	# tmp495, MEM[(unsigned char *)_593 + 26B]
+	.loc 3 226 5 is_stmt 1 view .LVU978
+.LVL167:
+# blake2s-internal.h:226:     *y++ = (x >> 24) & 0xff;
+	.loc 3 226 22 is_stmt 0 view .LVU979
+	movl	%ebx, %r8d	# _240, tmp496
+.LBE271:
+.LBE322:
+# blake2b-internal.h:123:     write_le32(y + 4, (u32)(x >> 32));
+	.loc 2 123 31 view .LVU980
+	shrq	$32, %rbx	#, _257
+.LVL168:
+.LBB323:
+.LBB272:
+# blake2s-internal.h:226:     *y++ = (x >> 24) & 0xff;
+	.loc 3 226 22 view .LVU981
+	shrl	$24, %r8d	#, tmp496
+.LVL169:
+# blake2s-internal.h:226:     *y++ = (x >> 24) & 0xff;
+	.loc 3 226 10 view .LVU982
+	movb	%r8b, 27(%rcx)	# tmp496, MEM[(unsigned char *)_593 + 27B]
+.LVL170:
+	.loc 3 226 10 view .LVU983
+.LBE272:
+.LBE323:
+	.loc 2 123 5 is_stmt 1 view .LVU984
+.LBB324:
+	.loc 3 222 20 view .LVU985
+.LBB295:
+	.loc 3 223 5 view .LVU986
+# blake2s-internal.h:225:     *y++ = (x >> 16) & 0xff;
+	.loc 3 225 15 is_stmt 0 view .LVU987
+	movl	%ebx, %r8d	# _257, tmp498
+# blake2s-internal.h:223:     *y++ = x & 0xff;
+	.loc 3 223 10 view .LVU988
+	movb	%bl, 28(%rcx)	# _257, MEM[(unsigned char *)_593 + 28B]
+	.loc 3 224 5 is_stmt 1 view .LVU989
+.LVL171:
+# blake2s-internal.h:225:     *y++ = (x >> 16) & 0xff;
+	.loc 3 225 15 is_stmt 0 view .LVU990
+	shrl	$16, %r8d	#, tmp498
+# blake2s-internal.h:224:     *y++ = (x >>  8) & 0xff;
+	.loc 3 224 10 view .LVU991
+	movb	%bh, 29(%rcx)	# _257, MEM[(unsigned char *)_593 + 29B]
+	.loc 3 225 5 is_stmt 1 view .LVU992
+.LVL172:
+# blake2s-internal.h:226:     *y++ = (x >> 24) & 0xff;
+	.loc 3 226 22 is_stmt 0 view .LVU993
+	shrl	$24, %ebx	#, tmp499
+.LVL173:
+# blake2s-internal.h:226:     *y++ = (x >> 24) & 0xff;
+	.loc 3 226 10 view .LVU994
+	movb	%bl, 31(%rcx)	# tmp499, MEM[(unsigned char *)_593 + 31B]
+.LBE295:
+.LBE324:
+.LBE352:
+.LBE367:
+# blake2bp.c:191:             write_le64(hash[i] + 8*w, L.H[w][i]);
+	.loc 1 191 13 view .LVU995
+	movq	128(%rdx), %rbx	# MEM[(long unsigned int *)_585 + 128B], _273
+.LBB368:
+.LBB353:
+.LBB325:
+.LBB296:
+# blake2s-internal.h:225:     *y++ = (x >> 16) & 0xff;
+	.loc 3 225 10 view .LVU996
+	movb	%r8b, 30(%rcx)	# tmp498, MEM[(unsigned char *)_593 + 30B]
+	.loc 3 226 5 is_stmt 1 view .LVU997
+.LVL174:
+	.loc 3 226 5 is_stmt 0 view .LVU998
+.LBE296:
+.LBE325:
+.LBE353:
+.LBE368:
+	.loc 1 190 38 is_stmt 1 view .LVU999
+	.loc 1 190 32 view .LVU1000
+	.loc 1 191 13 view .LVU1001
+.LBB369:
+	.loc 2 120 20 view .LVU1002
+.LBB354:
+	.loc 2 122 5 view .LVU1003
+.LBB326:
+	.loc 3 222 20 view .LVU1004
+.LBB273:
+	.loc 3 223 5 view .LVU1005
+# blake2s-internal.h:225:     *y++ = (x >> 16) & 0xff;
+	.loc 3 225 15 is_stmt 0 view .LVU1006
+	movl	%ebx, %r8d	# _273, tmp501
+# blake2s-internal.h:223:     *y++ = x & 0xff;
+	.loc 3 223 10 view .LVU1007
+	movb	%bl, 32(%rcx)	# _273, MEM[(unsigned char *)_593 + 32B]
+	.loc 3 224 5 is_stmt 1 view .LVU1008
+.LVL175:
+# blake2s-internal.h:225:     *y++ = (x >> 16) & 0xff;
+	.loc 3 225 15 is_stmt 0 view .LVU1009
+	shrl	$16, %r8d	#, tmp501
+# blake2s-internal.h:224:     *y++ = (x >>  8) & 0xff;
+	.loc 3 224 10 view .LVU1010
+	movb	%bh, 33(%rcx)	# _273, MEM[(unsigned char *)_593 + 33B]
+	.loc 3 225 5 is_stmt 1 view .LVU1011
+.LVL176:
+# blake2s-internal.h:225:     *y++ = (x >> 16) & 0xff;
+	.loc 3 225 10 is_stmt 0 view .LVU1012
+	movb	%r8b, 34(%rcx)	# tmp501, MEM[(unsigned char *)_593 + 34B]
+	.loc 3 226 5 is_stmt 1 view .LVU1013
+.LVL177:
+# blake2s-internal.h:226:     *y++ = (x >> 24) & 0xff;
+	.loc 3 226 22 is_stmt 0 view .LVU1014
+	movl	%ebx, %r8d	# _273, tmp502
+.LBE273:
+.LBE326:
+# blake2b-internal.h:123:     write_le32(y + 4, (u32)(x >> 32));
+	.loc 2 123 31 view .LVU1015
+	shrq	$32, %rbx	#, _290
+.LVL178:
+.LBB327:
+.LBB274:
+# blake2s-internal.h:226:     *y++ = (x >> 24) & 0xff;
+	.loc 3 226 22 view .LVU1016
+	shrl	$24, %r8d	#, tmp502
+.LVL179:
+	.loc 3 226 22 view .LVU1017
+.LBE274:
+.LBE327:
+.LBB328:
+.LBB297:
+# blake2s-internal.h:223:     *y++ = x & 0xff;
+	.loc 3 223 10 view .LVU1018
+	movb	%bl, 36(%rcx)	# _290, MEM[(unsigned char *)_593 + 36B]
+.LBE297:
+.LBE328:
+.LBB329:
+.LBB275:
+# blake2s-internal.h:226:     *y++ = (x >> 24) & 0xff;
+	.loc 3 226 10 view .LVU1019
+	movb	%r8b, 35(%rcx)	# tmp502, MEM[(unsigned char *)_593 + 35B]
+.LVL180:
+	.loc 3 226 10 view .LVU1020
+.LBE275:
+.LBE329:
+	.loc 2 123 5 is_stmt 1 view .LVU1021
+.LBB330:
+	.loc 3 222 20 view .LVU1022
+.LBB298:
+	.loc 3 223 5 view .LVU1023
+	.loc 3 224 5 view .LVU1024
+# blake2s-internal.h:225:     *y++ = (x >> 16) & 0xff;
+	.loc 3 225 15 is_stmt 0 view .LVU1025
+	movl	%ebx, %r8d	# _290, tmp504
+# blake2s-internal.h:224:     *y++ = (x >>  8) & 0xff;
+	.loc 3 224 10 view .LVU1026
+	movb	%bh, 37(%rcx)	# _290, MEM[(unsigned char *)_593 + 37B]
+	.loc 3 225 5 is_stmt 1 view .LVU1027
+.LVL181:
+# blake2s-internal.h:226:     *y++ = (x >> 24) & 0xff;
+	.loc 3 226 22 is_stmt 0 view .LVU1028
+	shrl	$24, %ebx	#, tmp505
+.LVL182:
+# blake2s-internal.h:225:     *y++ = (x >> 16) & 0xff;
+	.loc 3 225 15 view .LVU1029
+	shrl	$16, %r8d	#, tmp504
+.LVL183:
+# blake2s-internal.h:226:     *y++ = (x >> 24) & 0xff;
+	.loc 3 226 10 view .LVU1030
+	movb	%bl, 39(%rcx)	# tmp505, MEM[(unsigned char *)_593 + 39B]
+.LBE298:
+.LBE330:
+.LBE354:
+.LBE369:
+# blake2bp.c:191:             write_le64(hash[i] + 8*w, L.H[w][i]);
+	.loc 1 191 13 view .LVU1031
+	movq	160(%rdx), %rbx	# MEM[(long unsigned int *)_585 + 160B], _306
+.LBB370:
+.LBB355:
+.LBB331:
+.LBB299:
+# blake2s-internal.h:225:     *y++ = (x >> 16) & 0xff;
+	.loc 3 225 10 view .LVU1032
+	movb	%r8b, 38(%rcx)	# tmp504, MEM[(unsigned char *)_593 + 38B]
+	.loc 3 226 5 is_stmt 1 view .LVU1033
+.LVL184:
+	.loc 3 226 5 is_stmt 0 view .LVU1034
+.LBE299:
+.LBE331:
+.LBE355:
+.LBE370:
+	.loc 1 190 38 is_stmt 1 view .LVU1035
+	.loc 1 190 32 view .LVU1036
+	.loc 1 191 13 view .LVU1037
+.LBB371:
+	.loc 2 120 20 view .LVU1038
+.LBB356:
+	.loc 2 122 5 view .LVU1039
+.LBB332:
+	.loc 3 222 20 view .LVU1040
+.LBB276:
+	.loc 3 223 5 view .LVU1041
+# blake2s-internal.h:225:     *y++ = (x >> 16) & 0xff;
+	.loc 3 225 15 is_stmt 0 view .LVU1042
+	movl	%ebx, %r8d	# _306, tmp507
+# blake2s-internal.h:223:     *y++ = x & 0xff;
+	.loc 3 223 10 view .LVU1043
+	movb	%bl, 40(%rcx)	# _306, MEM[(unsigned char *)_593 + 40B]
+	.loc 3 224 5 is_stmt 1 view .LVU1044
+.LVL185:
+# blake2s-internal.h:225:     *y++ = (x >> 16) & 0xff;
+	.loc 3 225 15 is_stmt 0 view .LVU1045
+	shrl	$16, %r8d	#, tmp507
+# blake2s-internal.h:224:     *y++ = (x >>  8) & 0xff;
+	.loc 3 224 10 view .LVU1046
+	movb	%bh, 41(%rcx)	# _306, MEM[(unsigned char *)_593 + 41B]
+	.loc 3 225 5 is_stmt 1 view .LVU1047
+.LVL186:
+# blake2s-internal.h:225:     *y++ = (x >> 16) & 0xff;
+	.loc 3 225 10 is_stmt 0 view .LVU1048
+	movb	%r8b, 42(%rcx)	# tmp507, MEM[(unsigned char *)_593 + 42B]
+	.loc 3 226 5 is_stmt 1 view .LVU1049
+.LVL187:
+# blake2s-internal.h:226:     *y++ = (x >> 24) & 0xff;
+	.loc 3 226 22 is_stmt 0 view .LVU1050
+	movl	%ebx, %r8d	# _306, tmp508
+.LBE276:
+.LBE332:
+# blake2b-internal.h:123:     write_le32(y + 4, (u32)(x >> 32));
+	.loc 2 123 31 view .LVU1051
+	shrq	$32, %rbx	#, _323
+.LVL188:
+.LBB333:
+.LBB277:
+# blake2s-internal.h:226:     *y++ = (x >> 24) & 0xff;
+	.loc 3 226 22 view .LVU1052
+	shrl	$24, %r8d	#, tmp508
+.LVL189:
+	.loc 3 226 22 view .LVU1053
+.LBE277:
+.LBE333:
+.LBB334:
+.LBB300:
+# blake2s-internal.h:223:     *y++ = x & 0xff;
+	.loc 3 223 10 view .LVU1054
+	movb	%bl, 44(%rcx)	# _323, MEM[(unsigned char *)_593 + 44B]
+.LBE300:
+.LBE334:
+.LBB335:
+.LBB278:
+# blake2s-internal.h:226:     *y++ = (x >> 24) & 0xff;
+	.loc 3 226 10 view .LVU1055
+	movb	%r8b, 43(%rcx)	# tmp508, MEM[(unsigned char *)_593 + 43B]
+.LVL190:
+	.loc 3 226 10 view .LVU1056
+.LBE278:
+.LBE335:
+	.loc 2 123 5 is_stmt 1 view .LVU1057
+.LBB336:
+	.loc 3 222 20 view .LVU1058
+.LBB301:
+	.loc 3 223 5 view .LVU1059
+	.loc 3 224 5 view .LVU1060
+# blake2s-internal.h:225:     *y++ = (x >> 16) & 0xff;
+	.loc 3 225 15 is_stmt 0 view .LVU1061
+	movl	%ebx, %r8d	# _323, tmp510
+# blake2s-internal.h:224:     *y++ = (x >>  8) & 0xff;
+	.loc 3 224 10 view .LVU1062
+	movb	%bh, 45(%rcx)	# _323, MEM[(unsigned char *)_593 + 45B]
+	.loc 3 225 5 is_stmt 1 view .LVU1063
+.LVL191:
+# blake2s-internal.h:226:     *y++ = (x >> 24) & 0xff;
+	.loc 3 226 22 is_stmt 0 view .LVU1064
+	shrl	$24, %ebx	#, tmp511
+.LVL192:
+# blake2s-internal.h:225:     *y++ = (x >> 16) & 0xff;
+	.loc 3 225 15 view .LVU1065
+	shrl	$16, %r8d	#, tmp510
+.LVL193:
+# blake2s-internal.h:226:     *y++ = (x >> 24) & 0xff;
+	.loc 3 226 10 view .LVU1066
+	movb	%bl, 47(%rcx)	# tmp511, MEM[(unsigned char *)_593 + 47B]
+.LBE301:
+.LBE336:
+.LBE356:
+.LBE371:
+# blake2bp.c:191:             write_le64(hash[i] + 8*w, L.H[w][i]);
+	.loc 1 191 13 view .LVU1067
+	movq	192(%rdx), %rbx	# MEM[(long unsigned int *)_585 + 192B], _339
+.LBB372:
+.LBB357:
+.LBB337:
+.LBB302:
+# blake2s-internal.h:225:     *y++ = (x >> 16) & 0xff;
+	.loc 3 225 10 view .LVU1068
+	movb	%r8b, 46(%rcx)	# tmp510, MEM[(unsigned char *)_593 + 46B]
+	.loc 3 226 5 is_stmt 1 view .LVU1069
+.LVL194:
+	.loc 3 226 5 is_stmt 0 view .LVU1070
+.LBE302:
+.LBE337:
+.LBE357:
+.LBE372:
+	.loc 1 190 38 is_stmt 1 view .LVU1071
+	.loc 1 190 32 view .LVU1072
+	.loc 1 191 13 view .LVU1073
+.LBB373:
+	.loc 2 120 20 view .LVU1074
+.LBB358:
+	.loc 2 122 5 view .LVU1075
+.LBB338:
+	.loc 3 222 20 view .LVU1076
+.LBB279:
+	.loc 3 223 5 view .LVU1077
+# blake2s-internal.h:225:     *y++ = (x >> 16) & 0xff;
+	.loc 3 225 15 is_stmt 0 view .LVU1078
+	movl	%ebx, %r8d	# _339, tmp513
+# blake2s-internal.h:223:     *y++ = x & 0xff;
+	.loc 3 223 10 view .LVU1079
+	movb	%bl, 48(%rcx)	# _339, MEM[(unsigned char *)_593 + 48B]
+	.loc 3 224 5 is_stmt 1 view .LVU1080
+.LVL195:
+# blake2s-internal.h:225:     *y++ = (x >> 16) & 0xff;
+	.loc 3 225 15 is_stmt 0 view .LVU1081
+	shrl	$16, %r8d	#, tmp513
+# blake2s-internal.h:224:     *y++ = (x >>  8) & 0xff;
+	.loc 3 224 10 view .LVU1082
+	movb	%bh, 49(%rcx)	# _339, MEM[(unsigned char *)_593 + 49B]
+	.loc 3 225 5 is_stmt 1 view .LVU1083
+.LVL196:
+# blake2s-internal.h:225:     *y++ = (x >> 16) & 0xff;
+	.loc 3 225 10 is_stmt 0 view .LVU1084
+	movb	%r8b, 50(%rcx)	# tmp513, MEM[(unsigned char *)_593 + 50B]
+	.loc 3 226 5 is_stmt 1 view .LVU1085
+.LVL197:
+# blake2s-internal.h:226:     *y++ = (x >> 24) & 0xff;
+	.loc 3 226 22 is_stmt 0 view .LVU1086
+	movl	%ebx, %r8d	# _339, tmp514
+	shrl	$24, %r8d	#, tmp514
+.LBE279:
+.LBE338:
+# blake2b-internal.h:123:     write_le32(y + 4, (u32)(x >> 32));
+	.loc 2 123 31 view .LVU1087
+	shrq	$32, %rbx	#, _356
+.LVL198:
+	.loc 2 123 31 view .LVU1088
+.LBE358:
+.LBE373:
+.LBE258:
+# blake2bp.c:189:     for (unsigned i = 0; i < BBP_LEAVES; i++)
+	.loc 1 189 28 view .LVU1089
+	addq	$64, %rcx	#, ivtmp.373
+.LVL199:
+	.loc 1 189 28 view .LVU1090
+	addq	$8, %rdx	#, ivtmp.372
+.LVL200:
+.LBB377:
+.LBB374:
+.LBB359:
+.LBB339:
+.LBB280:
+# blake2s-internal.h:226:     *y++ = (x >> 24) & 0xff;
+	.loc 3 226 10 view .LVU1091
+	movb	%r8b, -13(%rcx)	# tmp514, MEM[(unsigned char *)_593 + 51B]
+.LVL201:
+	.loc 3 226 10 view .LVU1092
+.LBE280:
+.LBE339:
+	.loc 2 123 5 is_stmt 1 view .LVU1093
+.LBB340:
+	.loc 3 222 20 view .LVU1094
+.LBB303:
+	.loc 3 223 5 view .LVU1095
+# blake2s-internal.h:225:     *y++ = (x >> 16) & 0xff;
+	.loc 3 225 15 is_stmt 0 view .LVU1096
+	movl	%ebx, %r8d	# _356, tmp516
+# blake2s-internal.h:223:     *y++ = x & 0xff;
+	.loc 3 223 10 view .LVU1097
+	movb	%bl, -12(%rcx)	# _356, MEM[(unsigned char *)_593 + 52B]
+	.loc 3 224 5 is_stmt 1 view .LVU1098
+.LVL202:
+# blake2s-internal.h:225:     *y++ = (x >> 16) & 0xff;
+	.loc 3 225 15 is_stmt 0 view .LVU1099
+	shrl	$16, %r8d	#, tmp516
+# blake2s-internal.h:224:     *y++ = (x >>  8) & 0xff;
+	.loc 3 224 10 view .LVU1100
+	movb	%bh, -11(%rcx)	# _356, MEM[(unsigned char *)_593 + 53B]
+	.loc 3 225 5 is_stmt 1 view .LVU1101
+.LVL203:
+# blake2s-internal.h:226:     *y++ = (x >> 24) & 0xff;
+	.loc 3 226 22 is_stmt 0 view .LVU1102
+	shrl	$24, %ebx	#, tmp517
+.LVL204:
+# blake2s-internal.h:226:     *y++ = (x >> 24) & 0xff;
+	.loc 3 226 10 view .LVU1103
+	movb	%bl, -9(%rcx)	# tmp517, MEM[(unsigned char *)_593 + 55B]
+.LBE303:
+.LBE340:
+.LBE359:
+.LBE374:
+# blake2bp.c:191:             write_le64(hash[i] + 8*w, L.H[w][i]);
+	.loc 1 191 13 view .LVU1104
+	movq	216(%rdx), %rbx	# MEM[(long unsigned int *)_585 + 224B], _372
+.LBB375:
+.LBB360:
+.LBB341:
+.LBB304:
+# blake2s-internal.h:225:     *y++ = (x >> 16) & 0xff;
+	.loc 3 225 10 view .LVU1105
+	movb	%r8b, -10(%rcx)	# tmp516, MEM[(unsigned char *)_593 + 54B]
+	.loc 3 226 5 is_stmt 1 view .LVU1106
+.LVL205:
+	.loc 3 226 5 is_stmt 0 view .LVU1107
+.LBE304:
+.LBE341:
+.LBE360:
+.LBE375:
+	.loc 1 190 38 is_stmt 1 view .LVU1108
+	.loc 1 190 32 view .LVU1109
+	.loc 1 191 13 view .LVU1110
+.LBB376:
+	.loc 2 120 20 view .LVU1111
+.LBB361:
+	.loc 2 122 5 view .LVU1112
+.LBB342:
+	.loc 3 222 20 view .LVU1113
+.LBB281:
+	.loc 3 223 5 view .LVU1114
+# blake2s-internal.h:225:     *y++ = (x >> 16) & 0xff;
+	.loc 3 225 15 is_stmt 0 view .LVU1115
+	movl	%ebx, %r8d	# _372, tmp519
+# blake2s-internal.h:223:     *y++ = x & 0xff;
+	.loc 3 223 10 view .LVU1116
+	movb	%bl, -8(%rcx)	# _372, MEM[(unsigned char *)_593 + 56B]
+	.loc 3 224 5 is_stmt 1 view .LVU1117
+.LVL206:
+# blake2s-internal.h:225:     *y++ = (x >> 16) & 0xff;
+	.loc 3 225 15 is_stmt 0 view .LVU1118
+	shrl	$16, %r8d	#, tmp519
+# blake2s-internal.h:224:     *y++ = (x >>  8) & 0xff;
+	.loc 3 224 10 view .LVU1119
+	movb	%bh, -7(%rcx)	# _372, MEM[(unsigned char *)_593 + 57B]
+	.loc 3 225 5 is_stmt 1 view .LVU1120
+.LVL207:
+# blake2s-internal.h:225:     *y++ = (x >> 16) & 0xff;
+	.loc 3 225 10 is_stmt 0 view .LVU1121
+	movb	%r8b, -6(%rcx)	# tmp519, MEM[(unsigned char *)_593 + 58B]
+	.loc 3 226 5 is_stmt 1 view .LVU1122
+.LVL208:
+# blake2s-internal.h:226:     *y++ = (x >> 24) & 0xff;
+	.loc 3 226 22 is_stmt 0 view .LVU1123
+	movl	%ebx, %r8d	# _372, tmp520
+.LBE281:
+.LBE342:
+# blake2b-internal.h:123:     write_le32(y + 4, (u32)(x >> 32));
+	.loc 2 123 31 view .LVU1124
+	shrq	$32, %rbx	#, _389
+.LVL209:
+.LBB343:
+.LBB282:
+# blake2s-internal.h:226:     *y++ = (x >> 24) & 0xff;
+	.loc 3 226 22 view .LVU1125
+	shrl	$24, %r8d	#, tmp520
+.LVL210:
+	.loc 3 226 22 view .LVU1126
+.LBE282:
+.LBE343:
+.LBB344:
+.LBB305:
+# blake2s-internal.h:223:     *y++ = x & 0xff;
+	.loc 3 223 10 view .LVU1127
+	movb	%bl, -4(%rcx)	# _389, MEM[(unsigned char *)_593 + 60B]
+.LBE305:
+.LBE344:
+.LBB345:
+.LBB283:
+# blake2s-internal.h:226:     *y++ = (x >> 24) & 0xff;
+	.loc 3 226 10 view .LVU1128
+	movb	%r8b, -5(%rcx)	# tmp520, MEM[(unsigned char *)_593 + 59B]
+.LVL211:
+	.loc 3 226 10 view .LVU1129
+.LBE283:
+.LBE345:
+	.loc 2 123 5 is_stmt 1 view .LVU1130
+.LBB346:
+	.loc 3 222 20 view .LVU1131
+.LBB306:
+	.loc 3 223 5 view .LVU1132
+	.loc 3 224 5 view .LVU1133
+# blake2s-internal.h:225:     *y++ = (x >> 16) & 0xff;
+	.loc 3 225 15 is_stmt 0 view .LVU1134
+	movl	%ebx, %r8d	# _389, tmp522
+# blake2s-internal.h:224:     *y++ = (x >>  8) & 0xff;
+	.loc 3 224 10 view .LVU1135
+	movb	%bh, -3(%rcx)	# _389, MEM[(unsigned char *)_593 + 61B]
+	.loc 3 225 5 is_stmt 1 view .LVU1136
+.LVL212:
+# blake2s-internal.h:225:     *y++ = (x >> 16) & 0xff;
+	.loc 3 225 15 is_stmt 0 view .LVU1137
+	shrl	$16, %r8d	#, tmp522
+# blake2s-internal.h:226:     *y++ = (x >> 24) & 0xff;
+	.loc 3 226 22 view .LVU1138
+	shrl	$24, %ebx	#, tmp523
+.LVL213:
+# blake2s-internal.h:225:     *y++ = (x >> 16) & 0xff;
+	.loc 3 225 10 view .LVU1139
+	movb	%r8b, -2(%rcx)	# tmp522, MEM[(unsigned char *)_593 + 62B]
+	.loc 3 226 5 is_stmt 1 view .LVU1140
+.LVL214:
+# blake2s-internal.h:226:     *y++ = (x >> 24) & 0xff;
+	.loc 3 226 10 is_stmt 0 view .LVU1141
+	movb	%bl, -1(%rcx)	# tmp523, MEM[(unsigned char *)_593 + 63B]
+.LVL215:
+	.loc 3 226 10 view .LVU1142
+.LBE306:
+.LBE346:
+.LBE361:
+.LBE376:
+	.loc 1 190 38 is_stmt 1 view .LVU1143
+	.loc 1 190 32 view .LVU1144
+.LBE377:
+	.loc 1 189 34 view .LVU1145
+	.loc 1 189 28 view .LVU1146
+	cmpq	%rdi, %rcx	# tmp534, ivtmp.373
+	jne	.L63	#,
+.LBE257:
+	.loc 1 193 5 view .LVU1147
+	leaq	1024(%r9), %rbx	#, _28
+	movl	$256, %edx	#,
+	movq	%r9, 104(%rsp)	# ctx, %sfp
+	movq	%rbx, %rdi	# _28,
+	call	blake2b_update@PLT	#
+.LVL216:
+	.loc 1 194 5 view .LVU1148
+	movq	40(%rsp), %rsi	# %sfp,
+	movq	%rbx, %rdi	# _28,
+	call	blake2b_final@PLT	#
+.LVL217:
+	.loc 1 195 5 view .LVU1149
+	.loc 1 196 5 view .LVU1150
+	.loc 1 197 5 view .LVU1151
+	.loc 1 198 5 view .LVU1152
+	movq	104(%rsp), %rax	# %sfp, ctx
+	leaq	8(%rax), %rdi	#, tmp531
+	movq	$0, (%rax)	#,* ctx
+.LVL218:
+	.loc 1 198 5 is_stmt 0 view .LVU1153
+	movq	$0, 2200(%rax)	#,
+	andq	$-8, %rdi	#, tmp531
+	subq	%rdi, %rax	# tmp531, ctx
+	leal	2208(%rax), %ecx	#, tmp526
+	xorl	%eax, %eax	# tmp527
+	shrl	$3, %ecx	#,
+	rep stosq
+# blake2bp.c:199: }
+	.loc 1 199 1 view .LVU1154
+	leaq	-40(%rbp), %rsp	#,
+	popq	%rbx	#
+	popq	%r12	#
+	popq	%r13	#
+	popq	%r14	#
+	popq	%r15	#
+	popq	%rbp	#
+	.cfi_remember_state
+	.cfi_def_cfa 7, 8
+	ret	
+.LVL219:
+	.p2align 4,,10
+	.p2align 3
+.L100:
+	.cfi_restore_state
+.LBB378:
+# blake2bp.c:164:             memcpy(last[i], blk[i][n[i]-1], len[i][n[i]-1]);
+	.loc 1 164 56 view .LVU1155
+	leal	-1(%r15), %edx	#,
+# blake2bp.c:164:             memcpy(last[i], blk[i][n[i]-1], len[i][n[i]-1]);
+	.loc 1 164 13 view .LVU1156
+	leaq	(%rbx,%rbx,2), %rax	#, tmp393
+	movq	%r8, %rdi	# _9,
+	movq	%r10, 48(%rsp)	# tmp538, %sfp
+	addq	%rdx, %rax	# _11, tmp394
+	movl	%edx, 72(%rsp)	# _11, %sfp
+	movq	160(%rsp,%rax,8), %rsi	# blk[_780][_11], blk[_780][_11]
+	movq	256(%rsp,%rax,8), %rdx	# len[_780][_11], len[_780][_11]
+	movq	%r11, 56(%rsp)	# ivtmp.402, %sfp
+	movl	%r9d, 68(%rsp)	# rounds, %sfp
+	.loc 1 164 13 is_stmt 1 view .LVU1157
+	call	memcpy@PLT	#
+.LVL220:
+	.loc 1 164 13 is_stmt 0 view .LVU1158
+	movl	72(%rsp), %ecx	# %sfp, _11
+	movl	%r15d, %edx	# _10, prephitmp_725
+	movl	68(%rsp), %r9d	# %sfp, rounds
+	movq	56(%rsp), %r11	# %sfp, ivtmp.402
+	movq	48(%rsp), %r10	# %sfp, tmp538
+	movq	%rax, %r8	#, _9
+	movl	%ecx, %r15d	# _11,
+	jmp	.L60	#
+.LVL221:
+	.p2align 4,,10
+	.p2align 3
+.L91:
+	.loc 1 164 13 view .LVU1159
+.LBE378:
+.LBB379:
+.LBB254:
+.LBB250:
+# blake2bp.c:176:             if (r >= n[i])
+	.loc 1 176 16 view .LVU1160
+	movl	%esi, %ecx	# mask, mask
+	jmp	.L70	#
+.LVL222:
+	.p2align 4,,10
+	.p2align 3
+.L90:
+	.loc 1 176 16 view .LVU1161
+	movl	$2, %ecx	#, mask
+.LBE250:
+# blake2bp.c:174:         unsigned mask = 0;
+	.loc 1 174 18 view .LVU1162
+	xorl	%esi, %esi	# mask
+	jmp	.L64	#
+.LVL223:
+	.p2align 4,,10
+	.p2align 3
+.L102:
+.LBB251:
+	.loc 1 181 17 is_stmt 1 view .LVU1163
+# blake2bp.c:182:                 if (ctx->S[i].last_node)
+	.loc 1 182 20 is_stmt 0 view .LVU1164
+	movq	96(%rsp), %rax	# %sfp, ctx
+# blake2bp.c:181:                 L.f[0][i] = ~0ULL;
+	.loc 1 181 27 view .LVU1165
+	movq	$-1, 936(%rsp)	#, L.f[0][1]
+	.loc 1 182 17 is_stmt 1 view .LVU1166
+# blake2bp.c:182:                 if (ctx->S[i].last_node)
+	.loc 1 182 20 is_stmt 0 view .LVU1167
+	movl	488(%rax), %edi	# ctx_50(D)->S[1].last_node,
+	testl	%edi, %edi	#
+	je	.L70	#,
+	.loc 1 183 21 is_stmt 1 view .LVU1168
+# blake2bp.c:183:                     L.f[1][i] = ~0ULL;
+	.loc 1 183 31 is_stmt 0 view .LVU1169
+	movq	$-1, 968(%rsp)	#, L.f[1][1]
+	jmp	.L70	#
+.LVL224:
+	.p2align 4,,10
+	.p2align 3
+.L85:
+	.loc 1 181 17 is_stmt 1 view .LVU1170
+# blake2bp.c:182:                 if (ctx->S[i].last_node)
+	.loc 1 182 20 is_stmt 0 view .LVU1171
+	movq	96(%rsp), %rax	# %sfp, ctx
+# blake2bp.c:181:                 L.f[0][i] = ~0ULL;
+	.loc 1 181 27 view .LVU1172
+	movq	$-1, 952(%rsp)	#, L.f[0][3]
+	.loc 1 182 17 is_stmt 1 view .LVU1173
+# blake2bp.c:182:                 if (ctx->S[i].last_node)
+	.loc 1 182 20 is_stmt 0 view .LVU1174
+	movl	1000(%rax), %eax	# ctx_50(D)->S[3].last_node,
+	testl	%eax, %eax	#
+	je	.L87	#,
+	.loc 1 183 21 is_stmt 1 view .LVU1175
+# blake2bp.c:183:                     L.f[1][i] = ~0ULL;
+	.loc 1 183 31 is_stmt 0 view .LVU1176
+	movq	$-1, 984(%rsp)	#, L.f[1][3]
+	jmp	.L87	#
+.LVL225:
+	.p2align 4,,10
+	.p2align 3
+.L101:
+	.loc 1 181 17 is_stmt 1 view .LVU1177
+# blake2bp.c:182:                 if (ctx->S[i].last_node)
+	.loc 1 182 20 is_stmt 0 view .LVU1178
+	movq	96(%rsp), %rax	# %sfp, ctx
+# blake2bp.c:181:                 L.f[0][i] = ~0ULL;
+	.loc 1 181 27 view .LVU1179
+	movq	$-1, 928(%rsp)	#, L.f[0][0]
+	.loc 1 182 17 is_stmt 1 view .LVU1180
+# blake2bp.c:182:                 if (ctx->S[i].last_node)
+	.loc 1 182 20 is_stmt 0 view .LVU1181
+	movl	232(%rax), %r8d	# ctx_50(D)->S[0].last_node,
+	testl	%r8d, %r8d	#
+	je	.L68	#,
+	.loc 1 183 21 is_stmt 1 view .LVU1182
+# blake2bp.c:183:                     L.f[1][i] = ~0ULL;
+	.loc 1 183 31 is_stmt 0 view .LVU1183
+	movq	$-1, 960(%rsp)	#, L.f[1][0]
+	jmp	.L68	#
+.LVL226:
+	.p2align 4,,10
+	.p2align 3
+.L79:
+	.loc 1 181 17 is_stmt 1 view .LVU1184
+# blake2bp.c:182:                 if (ctx->S[i].last_node)
+	.loc 1 182 20 is_stmt 0 view .LVU1185
+	movq	96(%rsp), %rax	# %sfp, ctx
+# blake2bp.c:181:                 L.f[0][i] = ~0ULL;
+	.loc 1 181 27 view .LVU1186
+	movq	$-1, 944(%rsp)	#, L.f[0][2]
+	.loc 1 182 17 is_stmt 1 view .LVU1187
+# blake2bp.c:182:                 if (ctx->S[i].last_node)
+	.loc 1 182 20 is_stmt 0 view .LVU1188
+	movl	744(%rax), %esi	# ctx_50(D)->S[2].last_node,
+	testl	%esi, %esi	#
+	je	.L81	#,
+	.loc 1 183 21 is_stmt 1 view .LVU1189
+# blake2bp.c:183:                     L.f[1][i] = ~0ULL;
+	.loc 1 183 31 is_stmt 0 view .LVU1190
+	movq	$-1, 976(%rsp)	#, L.f[1][2]
+	jmp	.L81	#
+.LBE251:
+.LBE254:
+.LBE379:
+	.cfi_endproc
+.LFE32:
+	.size	blake2bp_final, .-blake2bp_final
+	.p2align 4
+	.globl	blake2bp
+	.type	blake2bp, @function
+blake2bp:
+.LVL227:
+.LFB33:
+	.loc 1 202 1 is_stmt 1 view -0
+	.cfi_startproc
+	.loc 1 203 5 view .LVU1192
+	.loc 1 204 5 view .LVU1193
+# blake2bp.c:202: {
+	.loc 1 202 1 is_stmt 0 view .LVU1194
+	pushq	%rbp	#
+	.cfi_def_cfa_offset 16
+	.cfi_offset 6, -16
+.LBB385:
+.LBB386:
+.LBB387:
+# blake2bp.c:37:     blake2b_init_words(&ctx->R, P, salt, NULL, 0);
+	.loc 1 37 5 view .LVU1195
+	xorl	%r8d, %r8d	#
+	xorl	%ecx, %ecx	#
+.LBE387:
+.LBE386:
+.LBE385:
+# blake2bp.c:202: {
+	.loc 1 202 1 view .LVU1196
+	movq	%rsp, %rbp	#,
+	.cfi_def_cfa_register 6
+	pushq	%r15	#
+	.cfi_offset 15, -24
+	movq	%rdx, %r15	# tmp100, len
+.LBB401:
+.LBB395:
+.LBB389:
+# blake2bp.c:37:     blake2b_init_words(&ctx->R, P, salt, NULL, 0);
+	.loc 1 37 5 view .LVU1197
+	xorl	%edx, %edx	#
+.LVL228:
+	.loc 1 37 5 view .LVU1198
+.LBE389:
+.LBE395:
+.LBE401:
+# blake2bp.c:202: {
+	.loc 1 202 1 view .LVU1199
+	pushq	%r14	#
+	pushq	%r13	#
+	.cfi_offset 14, -32
+	.cfi_offset 13, -40
+.LBB402:
+.LBB396:
+.LBB390:
+# blake2bp.c:39:     P[2] = B2B_PARAM2(0, BLAKE2B_LEN);
+	.loc 1 39 10 view .LVU1200
+	xorl	%r13d, %r13d	# ivtmp.411
+.LBE390:
+.LBE396:
+.LBE402:
+# blake2bp.c:202: {
+	.loc 1 202 1 view .LVU1201
+	pushq	%r12	#
+	pushq	%rbx	#
+	andq	$-32, %rsp	#,
+	subq	$2272, %rsp	#,
+	.cfi_offset 12, -48
+	.cfi_offset 3, -56
+.LVL229:
+.LBB403:
+.LBI385:
+	.loc 1 64 6 is_stmt 1 view .LVU1202
+	.loc 1 66 5 view .LVU1203
+.LBB397:
+.LBI386:
+	.loc 1 25 12 view .LVU1204
+.LBB391:
+	.loc 1 28 5 view .LVU1205
+# blake2bp.c:28:     u64 P[B2B_PARAM_WORDS] = { B2B_PARAM0(dig_len,key_len,BBP_LEAVES,2,0), 0,
+	.loc 1 28 9 is_stmt 0 view .LVU1206
+	movdqa	.LC3(%rip), %xmm0	#, tmp88
+# blake2bp.c:37:     blake2b_init_words(&ctx->R, P, salt, NULL, 0);
+	.loc 1 37 5 view .LVU1207
+	leaq	32(%rsp), %rbx	#, tmp96
+.LBE391:
+.LBE397:
+.LBE403:
+# blake2bp.c:202: {
+	.loc 1 202 1 view .LVU1208
+	movq	%rdi, 24(%rsp)	# tmp98, %sfp
+.LBB404:
+.LBB398:
+.LBB392:
+# blake2bp.c:37:     blake2b_init_words(&ctx->R, P, salt, NULL, 0);
+	.loc 1 37 5 view .LVU1209
+	leaq	64(%rsp), %r12	#, tmp97
+.LVL230:
+# blake2bp.c:28:     u64 P[B2B_PARAM_WORDS] = { B2B_PARAM0(dig_len,key_len,BBP_LEAVES,2,0), 0,
+	.loc 1 28 9 view .LVU1210
+	movaps	%xmm0, 32(%rsp)	# tmp88, MEM <vector(2) long unsigned int> [(long unsigned int *)&P]
+	movdqa	.LC4(%rip), %xmm0	#, tmp89
+# blake2bp.c:37:     blake2b_init_words(&ctx->R, P, salt, NULL, 0);
+	.loc 1 37 5 view .LVU1211
+	leaq	1088(%rsp), %rdi	#, tmp92
+.LVL231:
+	.loc 1 37 5 view .LVU1212
+	movq	%r12, %r14	# tmp97, ivtmp.416
+.LBE392:
+.LBE398:
+.LBE404:
+# blake2bp.c:202: {
+	.loc 1 202 1 view .LVU1213
+	movq	%rsi, 16(%rsp)	# tmp99, %sfp
+.LBB405:
+.LBB399:
+.LBB393:
+# blake2bp.c:37:     blake2b_init_words(&ctx->R, P, salt, NULL, 0);
+	.loc 1 37 5 view .LVU1214
+	movq	%rbx, %rsi	# tmp96,
+.LVL232:
+# blake2bp.c:28:     u64 P[B2B_PARAM_WORDS] = { B2B_PARAM0(dig_len,key_len,BBP_LEAVES,2,0), 0,
+	.loc 1 28 9 view .LVU1215
+	movaps	%xmm0, 48(%rsp)	# tmp89, MEM <vector(2) long unsigned int> [(long unsigned int *)&P + 16B]
+	.loc 1 31 5 is_stmt 1 view .LVU1216
+	.loc 1 33 5 view .LVU1217
+	.loc 1 37 5 view .LVU1218
+	call	blake2b_init_words@PLT	#
+.LVL233:
+	.loc 1 38 5 view .LVU1219
+# blake2bp.c:38:     ctx->R.last_node = 1;
+	.loc 1 38 22 is_stmt 0 view .LVU1220
+	movl	$1, 1320(%rsp)	#, ctx.R.last_node
+	.loc 1 39 5 is_stmt 1 view .LVU1221
+# blake2bp.c:39:     P[2] = B2B_PARAM2(0, BLAKE2B_LEN);
+	.loc 1 39 10 is_stmt 0 view .LVU1222
+	movq	$16384, 48(%rsp)	#, P[2]
+	.loc 1 40 5 is_stmt 1 view .LVU1223
+.LBB388:
+	.loc 1 40 10 view .LVU1224
+.LVL234:
+	.loc 1 40 28 view .LVU1225
+.L104:
+	.loc 1 41 9 view .LVU1226
+# blake2bp.c:41:         P[1] = i;
+	.loc 1 41 14 is_stmt 0 view .LVU1227
+	movq	%r13, 40(%rsp)	# ivtmp.411, P[1]
+	.loc 1 42 9 is_stmt 1 view .LVU1228
+	movq	%r14, %rdi	# ivtmp.416,
+	xorl	%r8d, %r8d	#
+	xorl	%ecx, %ecx	#
+	xorl	%edx, %edx	#
+	movq	%rbx, %rsi	# tmp96,
+# blake2bp.c:40:     for (unsigned i = 0; i < BBP_LEAVES; i++) {
+	.loc 1 40 28 is_stmt 0 view .LVU1229
+	addq	$1, %r13	#, ivtmp.411
+.LVL235:
+	.loc 1 40 28 view .LVU1230
+	addq	$256, %r14	#, ivtmp.416
+# blake2bp.c:42:         blake2b_init_words(&ctx->S[i], P, salt, key, key_len);
+	.loc 1 42 9 view .LVU1231
+	call	blake2b_init_words@PLT	#
+.LVL236:
+	.loc 1 43 9 is_stmt 1 view .LVU1232
+# blake2bp.c:43:         ctx->S[i].digest_len = BLAKE2B_LEN; /* inner length */
+	.loc 1 43 30 is_stmt 0 view .LVU1233
+	movl	$64, -28(%r14)	#, MEM[(unsigned int *)_17 + 228B]
+	.loc 1 40 34 is_stmt 1 view .LVU1234
+.LVL237:
+	.loc 1 40 28 view .LVU1235
+	cmpq	$4, %r13	#, ivtmp.411
+	jne	.L104	#,
+.LBE388:
+	.loc 1 45 5 view .LVU1236
+.LBE393:
+.LBE399:
+.LBE405:
+# blake2bp.c:205:     blake2bp_update(&ctx, src, len);
+	.loc 1 205 5 is_stmt 0 view .LVU1237
+	movq	16(%rsp), %rsi	# %sfp,
+	movq	%r15, %rdx	# len,
+	movq	%r12, %rdi	# tmp97,
+.LBB406:
+.LBB400:
+.LBB394:
+# blake2bp.c:45:     ctx->S[BBP_LEAVES-1].last_node = 1;
+	.loc 1 45 28 view .LVU1238
+	movl	$1, 1064(%rsp)	#, ctx.S[3].last_node
+	.loc 1 46 5 is_stmt 1 view .LVU1239
+# blake2bp.c:46:     ctx->buf_len = 0;
+	.loc 1 46 18 is_stmt 0 view .LVU1240
+	movl	$0, 2240(%rsp)	#, ctx.buf_len
+	.loc 1 47 5 is_stmt 1 view .LVU1241
+.LVL238:
+	.loc 1 47 5 is_stmt 0 view .LVU1242
+.LBE394:
+.LBE400:
+.LBE406:
+	.loc 1 205 5 is_stmt 1 view .LVU1243
+	call	blake2bp_update	#
+.LVL239:
+	.loc 1 206 5 view .LVU1244
+	movq	24(%rsp), %rsi	# %sfp,
+	movq	%r12, %rdi	# tmp97,
+	call	blake2bp_final	#
+.LVL240:
+# blake2bp.c:207: }
+	.loc 1 207 1 is_stmt 0 view .LVU1245
+	leaq	-40(%rbp), %rsp	#,
+.LVL241:
+	.loc 1 207 1 view .LVU1246
+	popq	%rbx	#
+	popq	%r12	#
+.LVL242:
+	.loc 1 207 1 view .LVU1247
+	popq	%r13	#
+	popq	%r14	#
+	popq	%r15	#
+.LVL243:
+	.loc 1 207 1 view .LVU1248
+	popq	%rbp	#
+	.cfi_def_cfa 7, 8
+.LVL244:
+	.loc 1 207 1 view .LVU1249
+	ret	
+	.cfi_endproc
+.LFE33:
+	.size	blake2bp, .-blake2bp
+	.section	.rodata.cst16,"aM",@progbits,16
+	.align 16
+.LC0:
+	.quad	64
+	.quad	320
+	.align 16
+.LC1:
+	.quad	576
+	.quad	832
+	.align 16
+.LC2:
+	.quad	128
+	.quad	128
+	.align 16
+.LC3:
+	.quad	33816640
+	.quad	0
+	.align 16
+.LC4:
+	.quad	16385
+	.quad	0
+	.text
+.Letext0:
+	.file 4 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stddef.h"
+	.file 5 "/usr/include/x86_64-linux-gnu/bits/types.h"
+	.file 6 "/usr/include/x86_64-linux-gnu/bits/stdint-uintn.h"
+	.file 7 "blake2b.h"
+	.file 8 "blake2bp.h"
+	.file 9 "/usr/include/string.h"
+	.file 10 "<built-in>"
+	.section	.debug_info,"",@progbits
+.Ldebug_info0:
+	.long	0x148e
+	.value	0x5
+	.byte	0x1
+	.byte	0x8
+	.long	.Ldebug_abbrev0
+	.uleb128 0x2f
+	.long	.LASF63
+	.byte	0xc
+	.long	.LASF0
+	.long	.LASF1
+	.quad	.Ltext0
+	.quad	.Letext0-.Ltext0
+	.long	.Ldebug_line0
+	.uleb128 0x11
+	.long	.LASF8
+	.byte	0x4
+	.byte	0xd6
+	.byte	0x1b
+	.long	0x3a
+	.uleb128 0xc
+	.byte	0x8
+	.byte	0x7
+	.long	.LASF2
+	.uleb128 0xc
+	.byte	0x8
+	.byte	0x5
+	.long	.LASF3
+	.uleb128 0x30
+	.byte	0x4
+	.byte	0x5
+	.string	"int"
+	.uleb128 0xc
+	.byte	0x1
+	.byte	0x8
+	.long	.LASF4
+	.uleb128 0xc
+	.byte	0x2
+	.byte	0x7
+	.long	.LASF5
+	.uleb128 0xc
+	.byte	0x4
+	.byte	0x7
+	.long	.LASF6
+	.uleb128 0xc
+	.byte	0x1
+	.byte	0x6
+	.long	.LASF7
+	.uleb128 0x11
+	.long	.LASF9
+	.byte	0x5
+	.byte	0x26
+	.byte	0x17
+	.long	0x4f
+	.uleb128 0xc
+	.byte	0x2
+	.byte	0x5
+	.long	.LASF10
+	.uleb128 0x11
+	.long	.LASF11
+	.byte	0x5
+	.byte	0x2a
+	.byte	0x16
+	.long	0x5d
+	.uleb128 0x11
+	.long	.LASF12
+	.byte	0x5
+	.byte	0x2d
+	.byte	0x1b
+	.long	0x3a
+	.uleb128 0x31
+	.byte	0x8
+	.uleb128 0xc
+	.byte	0x1
+	.byte	0x6
+	.long	.LASF13
+	.uleb128 0xd
+	.long	0x98
+	.uleb128 0x11
+	.long	.LASF14
+	.byte	0x6
+	.byte	0x18
+	.byte	0x13
+	.long	0x6b
+	.uleb128 0x11
+	.long	.LASF15
+	.byte	0x6
+	.byte	0x1a
+	.byte	0x14
+	.long	0x7e
+	.uleb128 0x11
+	.long	.LASF16
+	.byte	0x6
+	.byte	0x1b
+	.byte	0x14
+	.long	0x8a
+	.uleb128 0x6
+	.long	0xcd
+	.uleb128 0x32
+	.uleb128 0x6
+	.long	0x4f
+	.uleb128 0x1e
+	.long	.LASF20
+	.value	0x100
+	.byte	0x7
+	.byte	0x32
+	.long	0x136
+	.uleb128 0x16
+	.string	"H"
+	.byte	0x7
+	.byte	0x33
+	.byte	0xe
+	.long	0x13b
+	.byte	0
+	.uleb128 0x16
+	.string	"buf"
+	.byte	0x7
+	.byte	0x34
+	.byte	0x13
+	.long	0x14b
+	.byte	0x40
+	.uleb128 0x16
+	.string	"t"
+	.byte	0x7
+	.byte	0x35
+	.byte	0xe
+	.long	0x15b
+	.byte	0xc0
+	.uleb128 0x16
+	.string	"f"
+	.byte	0x7
+	.byte	0x36
+	.byte	0xe
+	.long	0x15b
+	.byte	0xd0
+	.uleb128 0xe
+	.long	.LASF17
+	.byte	0x7
+	.byte	0x37
+	.byte	0xe
+	.long	0x5d
+	.byte	0xe0
+	.uleb128 0xe
+	.long	.LASF18
+	.byte	0x7
+	.byte	0x38
+	.byte	0xe
+	.long	0x5d
+	.byte	0xe4
+	.uleb128 0xe
+	.long	.LASF19
+	.byte	0x7
+	.byte	0x39
+	.byte	0xe
+	.long	0x5d
+	.byte	0xe8
+	.byte	0
+	.uleb128 0xd
+	.long	0xd3
+	.uleb128 0x7
+	.long	0xbc
+	.long	0x14b
+	.uleb128 0x4
+	.long	0x3a
+	.byte	0x7
+	.byte	0
+	.uleb128 0x7
+	.long	0x4f
+	.long	0x15b
+	.uleb128 0x4
+	.long	0x3a
+	.byte	0x7f
+	.byte	0
+	.uleb128 0x7
+	.long	0xbc
+	.long	0x16b
+	.uleb128 0x4
+	.long	0x3a
+	.byte	0x1
+	.byte	0
+	.uleb128 0x1e
+	.long	.LASF21
+	.value	0x8a0
+	.byte	0x8
+	.byte	0x29
+	.long	0x1ae
+	.uleb128 0x33
+	.string	"S"
+	.byte	0x8
+	.byte	0x2a
+	.byte	0x18
+	.long	0x1ae
+	.byte	0x20
+	.byte	0
+	.uleb128 0x34
+	.string	"R"
+	.byte	0x8
+	.byte	0x2b
+	.byte	0x18
+	.long	0xd3
+	.byte	0x20
+	.value	0x400
+	.uleb128 0x1f
+	.string	"buf"
+	.byte	0x8
+	.byte	0x2c
+	.byte	0x13
+	.long	0x1bf
+	.value	0x500
+	.uleb128 0x35
+	.long	.LASF17
+	.byte	0x8
+	.byte	0x2d
+	.byte	0xe
+	.long	0x5d
+	.value	0x880
+	.byte	0
+	.uleb128 0x36
+	.long	0xd3
+	.byte	0x20
+	.long	0x1bf
+	.uleb128 0x4
+	.long	0x3a
+	.byte	0x3
+	.byte	0
+	.uleb128 0x7
+	.long	0x4f
+	.long	0x1d0
+	.uleb128 0x37
+	.long	0x3a
+	.value	0x37f
+	.byte	0
+	.uleb128 0xc
+	.byte	0x8
+	.byte	0x7
+	.long	.LASF22
+	.uleb128 0xc
+	.byte	0x8
+	.byte	0x5
+	.long	.LASF23
+	.uleb128 0x20
+	.string	"u8"
+	.byte	0x3
+	.byte	0x7
+	.byte	0x11
+	.long	0xa4
+	.uleb128 0xd
+	.long	0x1de
+	.uleb128 0x20
+	.string	"u32"
+	.byte	0x3
+	.byte	0x8
+	.byte	0x12
+	.long	0xb0
+	.uleb128 0xd
+	.long	0x1ee
+	.uleb128 0x7
+	.long	0x1fa
+	.long	0x20f
+	.uleb128 0x4
+	.long	0x3a
+	.byte	0x7
+	.byte	0
+	.uleb128 0xd
+	.long	0x1ff
+	.uleb128 0x21
+	.long	.LASF24
+	.byte	0x3
+	.byte	0xa
+	.byte	0x12
+	.long	0x20f
+	.byte	0x20
+	.byte	0x67
+	.byte	0xe6
+	.byte	0x9
+	.byte	0x6a
+	.byte	0x85
+	.byte	0xae
+	.byte	0x67
+	.byte	0xbb
+	.byte	0x72
+	.byte	0xf3
+	.byte	0x6e
+	.byte	0x3c
+	.byte	0x3a
+	.byte	0xf5
+	.byte	0x4f
+	.byte	0xa5
+	.byte	0x7f
+	.byte	0x52
+	.byte	0xe
+	.byte	0x51
+	.byte	0x8c
+	.byte	0x68
+	.byte	0x5
+	.byte	0x9b
+	.byte	0xab
+	.byte	0xd9
+	.byte	0x83
+	.byte	0x1f
+	.byte	0x19
+	.byte	0xcd
+	.byte	0xe0
+	.byte	0x5b
+	.uleb128 0x7
+	.long	0x1e9
+	.long	0x257
+	.uleb128 0x4
+	.long	0x3a
+	.byte	0x9
+	.uleb128 0x4
+	.long	0x3a
+	.byte	0xf
+	.byte	0
+	.uleb128 0xd
+	.long	0x241
+	.uleb128 0x21
+	.long	.LASF25
+	.byte	0x3
+	.byte	0xf
+	.byte	0x11
+	.long	0x257
+	.byte	0xa0
+	.byte	0
+	.byte	0x1
+	.byte	0x2
+	.byte	0x3
+	.byte	0x4
+	.byte	0x5
+	.byte	0x6
+	.byte	0x7
+	.byte	0x8
+	.byte	0x9
+	.byte	0xa
+	.byte	0xb
+	.byte	0xc
+	.byte	0xd
+	.byte	0xe
+	.byte	0xf
+	.byte	0xe
+	.byte	0xa
+	.byte	0x4
+	.byte	0x8
+	.byte	0x9
+	.byte	0xf
+	.byte	0xd
+	.byte	0x6
+	.byte	0x1
+	.byte	0xc
+	.byte	0
+	.byte	0x2
+	.byte	0xb
+	.byte	0x7
+	.byte	0x5
+	.byte	0x3
+	.byte	0xb
+	.byte	0x8
+	.byte	0xc
+	.byte	0
+	.byte	0x5
+	.byte	0x2
+	.byte	0xf
+	.byte	0xd
+	.byte	0xa
+	.byte	0xe
+	.byte	0x3
+	.byte	0x6
+	.byte	0x7
+	.byte	0x1
+	.byte	0x9
+	.byte	0x4
+	.byte	0x7
+	.byte	0x9
+	.byte	0x3
+	.byte	0x1
+	.byte	0xd
+	.byte	0xc
+	.byte	0xb
+	.byte	0xe
+	.byte	0x2
+	.byte	0x6
+	.byte	0x5
+	.byte	0xa
+	.byte	0x4
+	.byte	0
+	.byte	0xf
+	.byte	0x8
+	.byte	0x9
+	.byte	0
+	.byte	0x5
+	.byte	0x7
+	.byte	0x2
+	.byte	0x4
+	.byte	0xa
+	.byte	0xf
+	.byte	0xe
+	.byte	0x1
+	.byte	0xb
+	.byte	0xc
+	.byte	0x6
+	.byte	0x8
+	.byte	0x3
+	.byte	0xd
+	.byte	0x2
+	.byte	0xc
+	.byte	0x6
+	.byte	0xa
+	.byte	0
+	.byte	0xb
+	.byte	0x8
+	.byte	0x3
+	.byte	0x4
+	.byte	0xd
+	.byte	0x7
+	.byte	0x5
+	.byte	0xf
+	.byte	0xe
+	.byte	0x1
+	.byte	0x9
+	.byte	0xc
+	.byte	0x5
+	.byte	0x1
+	.byte	0xf
+	.byte	0xe
+	.byte	0xd
+	.byte	0x4
+	.byte	0xa
+	.byte	0
+	.byte	0x7
+	.byte	0x6
+	.byte	0x3
+	.byte	0x9
+	.byte	0x2
+	.byte	0x8
+	.byte	0xb
+	.byte	0xd
+	.byte	0xb
+	.byte	0x7
+	.byte	0xe
+	.byte	0xc
+	.byte	0x1
+	.byte	0x3
+	.byte	0x9
+	.byte	0x5
+	.byte	0
+	.byte	0xf
+	.byte	0x4
+	.byte	0x8
+	.byte	0x6
+	.byte	0x2
+	.byte	0xa
+	.byte	0x6
+	.byte	0xf
+	.byte	0xe
+	.byte	0x9
+	.byte	0xb
+	.byte	0x3
+	.byte	0
+	.byte	0x8
+	.byte	0xc
+	.byte	0x2
+	.byte	0xd
+	.byte	0x7
+	.byte	0x1
+	.byte	0x4
+	.byte	0xa
+	.byte	0x5
+	.byte	0xa
+	.byte	0x2
+	.byte	0x8
+	.byte	0x4
+	.byte	0x7
+	.byte	0x6
+	.byte	0x1
+	.byte	0x5
+	.byte	0xf
+	.byte	0xb
+	.byte	0x9
+	.byte	0xe
+	.byte	0x3
+	.byte	0xc
+	.byte	0xd
+	.byte	0
+	.uleb128 0x6
+	.long	0x9f
+	.uleb128 0x38
+	.long	0x48
+	.uleb128 0x6
+	.long	0x30e
+	.uleb128 0x6
+	.long	0xc8
+	.uleb128 0x6
+	.long	0x1e9
+	.uleb128 0x20
+	.string	"u64"
+	.byte	0x2
+	.byte	0x6
+	.byte	0x12
+	.long	0xbc
+	.uleb128 0xd
+	.long	0x322
+	.uleb128 0x7
+	.long	0x32e
+	.long	0x343
+	.uleb128 0x4
+	.long	0x3a
+	.byte	0x7
+	.byte	0
+	.uleb128 0xd
+	.long	0x333
+	.uleb128 0x21
+	.long	.LASF26
+	.byte	0x2
+	.byte	0x8
+	.byte	0x12
+	.long	0x343
+	.byte	0x40
+	.byte	0x8
+	.byte	0xc9
+	.byte	0xbc
+	.byte	0xf3
+	.byte	0x67
+	.byte	0xe6
+	.byte	0x9
+	.byte	0x6a
+	.byte	0x3b
+	.byte	0xa7
+	.byte	0xca
+	.byte	0x84
+	.byte	0x85
+	.byte	0xae
+	.byte	0x67
+	.byte	0xbb
+	.byte	0x2b
+	.byte	0xf8
+	.byte	0x94
+	.byte	0xfe
+	.byte	0x72
+	.byte	0xf3
+	.byte	0x6e
+	.byte	0x3c
+	.byte	0xf1
+	.byte	0x36
+	.byte	0x1d
+	.byte	0x5f
+	.byte	0x3a
+	.byte	0xf5
+	.byte	0x4f
+	.byte	0xa5
+	.byte	0xd1
+	.byte	0x82
+	.byte	0xe6
+	.byte	0xad
+	.byte	0x7f
+	.byte	0x52
+	.byte	0xe
+	.byte	0x51
+	.byte	0x1f
+	.byte	0x6c
+	.byte	0x3e
+	.byte	0x2b
+	.byte	0x8c
+	.byte	0x68
+	.byte	0x5
+	.byte	0x9b
+	.byte	0x6b
+	.byte	0xbd
+	.byte	0x41
+	.byte	0xfb
+	.byte	0xab
+	.byte	0xd9
+	.byte	0x83
+	.byte	0x1f
+	.byte	0x79
+	.byte	0x21
+	.byte	0x7e
+	.byte	0x13
+	.byte	0x19
+	.byte	0xcd
+	.byte	0xe0
+	.byte	0x5b
+	.uleb128 0x1e
+	.long	.LASF27
+	.value	0x180
+	.byte	0x2
+	.byte	0x25
+	.long	0x3c6
+	.uleb128 0x16
+	.string	"H"
+	.byte	0x2
+	.byte	0x26
+	.byte	0x9
+	.long	0x3cb
+	.byte	0
+	.uleb128 0x1f
+	.string	"t"
+	.byte	0x2
+	.byte	0x27
+	.byte	0x9
+	.long	0x3e1
+	.value	0x100
+	.uleb128 0x1f
+	.string	"f"
+	.byte	0x2
+	.byte	0x28
+	.byte	0x9
+	.long	0x3e1
+	.value	0x140
+	.byte	0
+	.uleb128 0xd
+	.long	0x395
+	.uleb128 0x7
+	.long	0x322
+	.long	0x3e1
+	.uleb128 0x4
+	.long	0x3a
+	.byte	0x7
+	.uleb128 0x4
+	.long	0x3a
+	.byte	0x3
+	.byte	0
+	.uleb128 0x7
+	.long	0x322
+	.long	0x3f7
+	.uleb128 0x4
+	.long	0x3a
+	.byte	0x1
+	.uleb128 0x4
+	.long	0x3a
+	.byte	0x3
+	.byte	0
+	.uleb128 0x39
+	.long	.LASF64
+	.byte	0x30
+	.byte	0x2
+	.byte	0x2c
+	.byte	0x8
+	.long	0x453
+	.uleb128 0xe
+	.long	.LASF28
+	.byte	0x2
+	.byte	0x2d
+	.byte	0x11
+	.long	0x309
+	.byte	0
+	.uleb128 0xe
+	.long	.LASF29
+	.byte	0x2
+	.byte	0x2e
+	.byte	0xb
+	.long	0x313
+	.byte	0x8
+	.uleb128 0xe
+	.long	.LASF30
+	.byte	0x2
+	.byte	0x2f
+	.byte	0xc
+	.long	0x46d
+	.byte	0x10
+	.uleb128 0xe
+	.long	.LASF31
+	.byte	0x2
+	.byte	0x30
+	.byte	0xc
+	.long	0x487
+	.byte	0x18
+	.uleb128 0xe
+	.long	.LASF32
+	.byte	0x2
+	.byte	0x32
+	.byte	0xe
+	.long	0x5d
+	.byte	0x20
+	.uleb128 0xe
+	.long	.LASF33
+	.byte	0x2
+	.byte	0x33
+	.byte	0xc
+	.long	0x4a6
+	.byte	0x28
+	.byte	0
+	.uleb128 0xd
+	.long	0x3f7
+	.uleb128 0x22
+	.long	0x468
+	.uleb128 0x3
+	.long	0x468
+	.uleb128 0x3
+	.long	0xc8
+	.byte	0
+	.uleb128 0x6
+	.long	0xd3
+	.uleb128 0x6
+	.long	0x458
+	.uleb128 0x22
+	.long	0x487
+	.uleb128 0x3
+	.long	0x468
+	.uleb128 0x3
+	.long	0xc8
+	.uleb128 0x3
+	.long	0x2e
+	.byte	0
+	.uleb128 0x6
+	.long	0x472
+	.uleb128 0x22
+	.long	0x4a1
+	.uleb128 0x3
+	.long	0x4a1
+	.uleb128 0x3
+	.long	0x318
+	.uleb128 0x3
+	.long	0x5d
+	.byte	0
+	.uleb128 0x6
+	.long	0x395
+	.uleb128 0x6
+	.long	0x48c
+	.uleb128 0x3a
+	.long	.LASF44
+	.byte	0x2
+	.byte	0x37
+	.byte	0x25
+	.long	0x4b7
+	.uleb128 0x6
+	.long	0x453
+	.uleb128 0x23
+	.long	.LASF34
+	.byte	0x7
+	.byte	0x24
+	.long	0x4d2
+	.uleb128 0x3
+	.long	0x468
+	.uleb128 0x3
+	.long	0xce
+	.byte	0
+	.uleb128 0x23
+	.long	.LASF35
+	.byte	0x7
+	.byte	0x23
+	.long	0x4ed
+	.uleb128 0x3
+	.long	0x468
+	.uleb128 0x3
+	.long	0xc8
+	.uleb128 0x3
+	.long	0x2e
+	.byte	0
+	.uleb128 0x24
+	.long	.LASF36
+	.byte	0x3d
+	.long	0x96
+	.long	0x50b
+	.uleb128 0x3
+	.long	0x96
+	.uleb128 0x3
+	.long	0x48
+	.uleb128 0x3
+	.long	0x2e
+	.byte	0
+	.uleb128 0x24
+	.long	.LASF37
+	.byte	0x2f
+	.long	0x96
+	.long	0x529
+	.uleb128 0x3
+	.long	0x96
+	.uleb128 0x3
+	.long	0xc8
+	.uleb128 0x3
+	.long	0x2e
+	.byte	0
+	.uleb128 0x24
+	.long	.LASF38
+	.byte	0x2b
+	.long	0x96
+	.long	0x547
+	.uleb128 0x3
+	.long	0x96
+	.uleb128 0x3
+	.long	0xc8
+	.uleb128 0x3
+	.long	0x2e
+	.byte	0
+	.uleb128 0x23
+	.long	.LASF39
+	.byte	0x2
+	.byte	0x1f
+	.long	0x56c
+	.uleb128 0x3
+	.long	0x468
+	.uleb128 0x3
+	.long	0x56c
+	.uleb128 0x3
+	.long	0xc8
+	.uleb128 0x3
+	.long	0xc8
+	.uleb128 0x3
+	.long	0x5d
+	.byte	0
+	.uleb128 0x6
+	.long	0x32e
+	.uleb128 0x25
+	.long	.LASF40
+	.byte	0xc9
+	.quad	.LFB33
+	.quad	.LFE33-.LFB33
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0x722
+	.uleb128 0x8
+	.string	"out"
+	.byte	0xc9
+	.byte	0x1e
+	.long	0xce
+	.long	.LLST111
+	.long	.LVUS111
+	.uleb128 0x8
+	.string	"src"
+	.byte	0xc9
+	.byte	0x2f
+	.long	0xc8
+	.long	.LLST112
+	.long	.LVUS112
+	.uleb128 0x8
+	.string	"len"
+	.byte	0xc9
+	.byte	0x3b
+	.long	0x2e
+	.long	.LLST113
+	.long	.LVUS113
+	.uleb128 0xf
+	.string	"ctx"
+	.byte	0xcb
+	.byte	0x19
+	.long	0x16b
+	.uleb128 0x3
+	.byte	0x77
+	.sleb128 64
+	.uleb128 0x19
+	.long	0xf34
+	.quad	.LBI385
+	.value	.LVU1202
+	.long	.LLRL114
+	.byte	0x1
+	.byte	0xcc
+	.byte	0x5
+	.long	0x6e1
+	.uleb128 0x2
+	.long	0xf41
+	.long	.LLST115
+	.long	.LVUS115
+	.uleb128 0xa
+	.long	0x11f4
+	.quad	.LBI386
+	.value	.LVU1204
+	.long	.LLRL114
+	.byte	0x1
+	.byte	0x42
+	.byte	0x5
+	.uleb128 0x2
+	.long	0x1233
+	.long	.LLST116
+	.long	.LVUS116
+	.uleb128 0x2
+	.long	0x1227
+	.long	.LLST117
+	.long	.LVUS117
+	.uleb128 0x2
+	.long	0x121b
+	.long	.LLST117
+	.long	.LVUS117
+	.uleb128 0x2
+	.long	0x120f
+	.long	.LLST117
+	.long	.LVUS117
+	.uleb128 0x2
+	.long	0x1203
+	.long	.LLST120
+	.long	.LVUS120
+	.uleb128 0x12
+	.long	.LLRL114
+	.uleb128 0x1a
+	.long	0x123f
+	.uleb128 0x2
+	.byte	0x77
+	.sleb128 32
+	.uleb128 0x1b
+	.long	0x1249
+	.quad	.LBB388
+	.quad	.LBE388-.LBB388
+	.long	0x6b1
+	.uleb128 0x13
+	.long	0x124a
+	.long	.LLST121
+	.long	.LVUS121
+	.uleb128 0x9
+	.quad	.LVL236
+	.long	0x547
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x3
+	.byte	0x7e
+	.sleb128 -256
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x2
+	.byte	0x73
+	.sleb128 0
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x51
+	.uleb128 0x1
+	.byte	0x30
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x52
+	.uleb128 0x1
+	.byte	0x30
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x58
+	.uleb128 0x1
+	.byte	0x30
+	.byte	0
+	.byte	0
+	.uleb128 0x9
+	.quad	.LVL233
+	.long	0x547
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x3
+	.byte	0x77
+	.sleb128 1088
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x2
+	.byte	0x73
+	.sleb128 0
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x51
+	.uleb128 0x2
+	.byte	0x7d
+	.sleb128 0
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x52
+	.uleb128 0x2
+	.byte	0x7d
+	.sleb128 0
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x58
+	.uleb128 0x2
+	.byte	0x7d
+	.sleb128 0
+	.byte	0
+	.byte	0
+	.byte	0
+	.byte	0
+	.uleb128 0x1c
+	.quad	.LVL239
+	.long	0xb9c
+	.long	0x706
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x7c
+	.sleb128 0
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x3
+	.byte	0x77
+	.sleb128 16
+	.byte	0x6
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x51
+	.uleb128 0x2
+	.byte	0x7f
+	.sleb128 0
+	.byte	0
+	.uleb128 0x9
+	.quad	.LVL240
+	.long	0x722
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x7c
+	.sleb128 0
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x3
+	.byte	0x77
+	.sleb128 24
+	.byte	0x6
+	.byte	0
+	.byte	0
+	.uleb128 0x25
+	.long	.LASF41
+	.byte	0x88
+	.quad	.LFB32
+	.quad	.LFE32-.LFB32
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0xaf9
+	.uleb128 0x8
+	.string	"ctx"
+	.byte	0x88
+	.byte	0x2a
+	.long	0xaf9
+	.long	.LLST67
+	.long	.LVUS67
+	.uleb128 0x8
+	.string	"out"
+	.byte	0x88
+	.byte	0x3e
+	.long	0xce
+	.long	.LLST68
+	.long	.LVUS68
+	.uleb128 0x2b
+	.long	.LASF42
+	.byte	0x8a
+	.long	0xafe
+	.uleb128 0x3
+	.byte	0x77
+	.sleb128 352
+	.uleb128 0x2b
+	.long	.LASF43
+	.byte	0x8b
+	.long	0xb14
+	.uleb128 0x3
+	.byte	0x77
+	.sleb128 992
+	.uleb128 0xf
+	.string	"blk"
+	.byte	0x8c
+	.byte	0x11
+	.long	0xb2a
+	.uleb128 0x3
+	.byte	0x77
+	.sleb128 160
+	.uleb128 0xf
+	.string	"len"
+	.byte	0x8d
+	.byte	0xc
+	.long	0xb40
+	.uleb128 0x3
+	.byte	0x77
+	.sleb128 256
+	.uleb128 0xf
+	.string	"n"
+	.byte	0x8e
+	.byte	0xe
+	.long	0xb56
+	.uleb128 0x3
+	.byte	0x77
+	.sleb128 112
+	.uleb128 0x26
+	.long	.LASF45
+	.byte	0x8e
+	.byte	0x14
+	.long	0x5d
+	.long	.LLST69
+	.long	.LVUS69
+	.uleb128 0xf
+	.string	"L"
+	.byte	0x8f
+	.byte	0x1a
+	.long	0x395
+	.uleb128 0x3
+	.byte	0x77
+	.sleb128 608
+	.uleb128 0xf
+	.string	"m"
+	.byte	0x90
+	.byte	0x11
+	.long	0xb66
+	.uleb128 0x3
+	.byte	0x77
+	.sleb128 128
+	.uleb128 0x10
+	.long	.LLRL70
+	.long	0x904
+	.uleb128 0xb
+	.string	"i"
+	.byte	0x95
+	.byte	0x13
+	.long	0x5d
+	.long	.LLST71
+	.long	.LVUS71
+	.uleb128 0x10
+	.long	.LLRL72
+	.long	0x855
+	.uleb128 0xb
+	.string	"j"
+	.byte	0x9b
+	.byte	0x17
+	.long	0x5d
+	.long	.LLST73
+	.long	.LVUS73
+	.uleb128 0x12
+	.long	.LLRL74
+	.uleb128 0xb
+	.string	"k"
+	.byte	0x9c
+	.byte	0x14
+	.long	0x2e
+	.long	.LLST75
+	.long	.LVUS75
+	.uleb128 0xa
+	.long	0xb76
+	.quad	.LBI191
+	.value	.LVU654
+	.long	.LLRL76
+	.byte	0x1
+	.byte	0x9c
+	.byte	0x18
+	.uleb128 0x2
+	.long	0xb91
+	.long	.LLST77
+	.long	.LVUS77
+	.uleb128 0x2
+	.long	0xb85
+	.long	.LLST78
+	.long	.LVUS78
+	.byte	0
+	.byte	0
+	.byte	0
+	.uleb128 0x19
+	.long	0x12ef
+	.quad	.LBI216
+	.value	.LVU718
+	.long	.LLRL79
+	.byte	0x1
+	.byte	0xaa
+	.byte	0x9
+	.long	0x8ae
+	.uleb128 0x2
+	.long	0x130e
+	.long	.LLST80
+	.long	.LVUS80
+	.uleb128 0x2
+	.long	0x1304
+	.long	.LLST81
+	.long	.LVUS81
+	.uleb128 0x2
+	.long	0x12fa
+	.long	.LLST82
+	.long	.LVUS82
+	.uleb128 0x27
+	.long	0x131a
+	.long	.LLRL83
+	.uleb128 0x13
+	.long	0x131b
+	.long	.LLST84
+	.long	.LVUS84
+	.byte	0
+	.byte	0
+	.uleb128 0x9
+	.quad	.LVL220
+	.long	0x1486
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x9
+	.byte	0x7e
+	.sleb128 0
+	.byte	0x37
+	.byte	0x24
+	.byte	0x77
+	.sleb128 80
+	.byte	0x6
+	.byte	0x22
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x19
+	.byte	0x73
+	.sleb128 0
+	.byte	0x31
+	.byte	0x24
+	.byte	0x7f
+	.sleb128 -1
+	.byte	0xc
+	.long	0xffffffff
+	.byte	0x1a
+	.byte	0x22
+	.byte	0x73
+	.sleb128 0
+	.byte	0x22
+	.byte	0x33
+	.byte	0x24
+	.byte	0x77
+	.sleb128 0
+	.byte	0x22
+	.byte	0x23
+	.uleb128 0xa0
+	.byte	0x6
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x51
+	.uleb128 0x19
+	.byte	0x73
+	.sleb128 0
+	.byte	0x31
+	.byte	0x24
+	.byte	0x7f
+	.sleb128 -1
+	.byte	0xc
+	.long	0xffffffff
+	.byte	0x1a
+	.byte	0x22
+	.byte	0x73
+	.sleb128 0
+	.byte	0x22
+	.byte	0x33
+	.byte	0x24
+	.byte	0x77
+	.sleb128 0
+	.byte	0x22
+	.byte	0x23
+	.uleb128 0x100
+	.byte	0x6
+	.byte	0
+	.byte	0
+	.uleb128 0x10
+	.long	.LLRL85
+	.long	0x9e9
+	.uleb128 0xb
+	.string	"r"
+	.byte	0xad
+	.byte	0x13
+	.long	0x5d
+	.long	.LLST86
+	.long	.LVUS86
+	.uleb128 0x12
+	.long	.LLRL87
+	.uleb128 0x26
+	.long	.LASF46
+	.byte	0xae
+	.byte	0x12
+	.long	0x5d
+	.long	.LLST88
+	.long	.LVUS88
+	.uleb128 0x10
+	.long	.LLRL89
+	.long	0x98f
+	.uleb128 0xb
+	.string	"i"
+	.byte	0xaf
+	.byte	0x17
+	.long	0x5d
+	.long	.LLST90
+	.long	.LVUS90
+	.uleb128 0xa
+	.long	0x1286
+	.quad	.LBI236
+	.value	.LVU780
+	.long	.LLRL91
+	.byte	0x1
+	.byte	0xb3
+	.byte	0xd
+	.uleb128 0x2
+	.long	0x12a5
+	.long	.LLST92
+	.long	.LVUS92
+	.uleb128 0x2
+	.long	0x129b
+	.long	.LLST93
+	.long	.LVUS93
+	.uleb128 0x2
+	.long	0x1291
+	.long	.LLST94
+	.long	.LVUS94
+	.byte	0
+	.byte	0
+	.uleb128 0xa
+	.long	0x132c
+	.quad	.LBI246
+	.value	.LVU847
+	.long	.LLRL95
+	.byte	0x1
+	.byte	0xbb
+	.byte	0x9
+	.uleb128 0x2
+	.long	0x134b
+	.long	.LLST96
+	.long	.LVUS96
+	.uleb128 0x2
+	.long	0x1341
+	.long	.LLST97
+	.long	.LVUS97
+	.uleb128 0x2
+	.long	0x1337
+	.long	.LLST98
+	.long	.LVUS98
+	.uleb128 0x28
+	.quad	.LVL131
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x4
+	.byte	0x77
+	.sleb128 104
+	.byte	0x6
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x4
+	.byte	0x77
+	.sleb128 88
+	.byte	0x6
+	.byte	0
+	.byte	0
+	.byte	0
+	.byte	0
+	.uleb128 0x29
+	.quad	.LBB257
+	.quad	.LBE257-.LBB257
+	.long	0xabe
+	.uleb128 0xb
+	.string	"i"
+	.byte	0xbd
+	.byte	0x13
+	.long	0x5d
+	.long	.LLST99
+	.long	.LVUS99
+	.uleb128 0x12
+	.long	.LLRL100
+	.uleb128 0xb
+	.string	"w"
+	.byte	0xbe
+	.byte	0x17
+	.long	0x5d
+	.long	.LLST101
+	.long	.LVUS101
+	.uleb128 0xa
+	.long	0x1266
+	.quad	.LBI259
+	.value	.LVU859
+	.long	.LLRL102
+	.byte	0x1
+	.byte	0xbf
+	.byte	0xd
+	.uleb128 0x2
+	.long	0x127b
+	.long	.LLST103
+	.long	.LVUS103
+	.uleb128 0x2
+	.long	0x1271
+	.long	.LLST104
+	.long	.LVUS104
+	.uleb128 0x19
+	.long	0x1358
+	.quad	.LBI261
+	.value	.LVU861
+	.long	.LLRL105
+	.byte	0x2
+	.byte	0x7a
+	.byte	0x5
+	.long	0xa8a
+	.uleb128 0x2
+	.long	0x136d
+	.long	.LLST106
+	.long	.LVUS106
+	.uleb128 0x2
+	.long	0x1363
+	.long	.LLST107
+	.long	.LVUS107
+	.byte	0
+	.uleb128 0xa
+	.long	0x1358
+	.quad	.LBI285
+	.value	.LVU879
+	.long	.LLRL108
+	.byte	0x2
+	.byte	0x7b
+	.byte	0x5
+	.uleb128 0x2
+	.long	0x136d
+	.long	.LLST109
+	.long	.LVUS109
+	.uleb128 0x2
+	.long	0x1363
+	.long	.LLST110
+	.long	.LVUS110
+	.byte	0
+	.byte	0
+	.byte	0
+	.byte	0
+	.uleb128 0x1c
+	.quad	.LVL216
+	.long	0x4d2
+	.long	0xadd
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x73
+	.sleb128 0
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x51
+	.uleb128 0x3
+	.byte	0xa
+	.value	0x100
+	.byte	0
+	.uleb128 0x9
+	.quad	.LVL217
+	.long	0x4bc
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x73
+	.sleb128 0
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x3
+	.byte	0x77
+	.sleb128 40
+	.byte	0x6
+	.byte	0
+	.byte	0
+	.uleb128 0x6
+	.long	0x16b
+	.uleb128 0x7
+	.long	0x1de
+	.long	0xb14
+	.uleb128 0x4
+	.long	0x3a
+	.byte	0x3
+	.uleb128 0x4
+	.long	0x3a
+	.byte	0x3f
+	.byte	0
+	.uleb128 0x7
+	.long	0x1de
+	.long	0xb2a
+	.uleb128 0x4
+	.long	0x3a
+	.byte	0x3
+	.uleb128 0x4
+	.long	0x3a
+	.byte	0x7f
+	.byte	0
+	.uleb128 0x7
+	.long	0xc8
+	.long	0xb40
+	.uleb128 0x4
+	.long	0x3a
+	.byte	0x3
+	.uleb128 0x4
+	.long	0x3a
+	.byte	0x2
+	.byte	0
+	.uleb128 0x7
+	.long	0x2e
+	.long	0xb56
+	.uleb128 0x4
+	.long	0x3a
+	.byte	0x3
+	.uleb128 0x4
+	.long	0x3a
+	.byte	0x2
+	.byte	0
+	.uleb128 0x7
+	.long	0x5d
+	.long	0xb66
+	.uleb128 0x4
+	.long	0x3a
+	.byte	0x3
+	.byte	0
+	.uleb128 0x7
+	.long	0xc8
+	.long	0xb76
+	.uleb128 0x4
+	.long	0x3a
+	.byte	0x3
+	.byte	0
+	.uleb128 0x2c
+	.long	.LASF55
+	.byte	0x80
+	.byte	0xf
+	.long	0x2e
+	.long	0xb9c
+	.uleb128 0x5
+	.string	"len"
+	.byte	0x1
+	.byte	0x80
+	.byte	0x20
+	.long	0x2e
+	.uleb128 0x5
+	.string	"j"
+	.byte	0x1
+	.byte	0x80
+	.byte	0x2e
+	.long	0x5d
+	.byte	0
+	.uleb128 0x25
+	.long	.LASF47
+	.byte	0x63
+	.quad	.LFB30
+	.quad	.LFE30-.LFB30
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0xcc8
+	.uleb128 0x8
+	.string	"ctx"
+	.byte	0x63
+	.byte	0x2b
+	.long	0xaf9
+	.long	.LLST60
+	.long	.LVUS60
+	.uleb128 0x8
+	.string	"src"
+	.byte	0x63
+	.byte	0x3c
+	.long	0xc8
+	.long	.LLST61
+	.long	.LVUS61
+	.uleb128 0x8
+	.string	"len"
+	.byte	0x63
+	.byte	0x48
+	.long	0x2e
+	.long	.LLST62
+	.long	.LVUS62
+	.uleb128 0xb
+	.string	"in"
+	.byte	0x65
+	.byte	0xf
+	.long	0x31d
+	.long	.LLST63
+	.long	.LVUS63
+	.uleb128 0x10
+	.long	.LLRL64
+	.long	0xc20
+	.uleb128 0x26
+	.long	.LASF48
+	.byte	0x6a
+	.byte	0x14
+	.long	0x2e
+	.long	.LLST65
+	.long	.LVUS65
+	.byte	0
+	.uleb128 0x29
+	.quad	.LBB186
+	.quad	.LBE186-.LBB186
+	.long	0xc6c
+	.uleb128 0xb
+	.string	"n"
+	.byte	0x76
+	.byte	0x10
+	.long	0x2e
+	.long	.LLST66
+	.long	.LVUS66
+	.uleb128 0x9
+	.quad	.LVL87
+	.long	0xcc8
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x7f
+	.sleb128 0
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x2
+	.byte	0x7c
+	.sleb128 0
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x51
+	.uleb128 0x7
+	.byte	0x76
+	.sleb128 -897
+	.byte	0x39
+	.byte	0x25
+	.byte	0x23
+	.uleb128 0x1
+	.byte	0
+	.byte	0
+	.uleb128 0x1c
+	.quad	.LVL74
+	.long	0xcc8
+	.long	0xc8f
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x7f
+	.sleb128 0
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x2
+	.byte	0x73
+	.sleb128 0
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x51
+	.uleb128 0x1
+	.byte	0x31
+	.byte	0
+	.uleb128 0x1c
+	.quad	.LVL75
+	.long	0x50b
+	.long	0xcad
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x73
+	.sleb128 0
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x2
+	.byte	0x7d
+	.sleb128 0
+	.byte	0
+	.uleb128 0x9
+	.quad	.LVL80
+	.long	0x1486
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x2
+	.byte	0x7c
+	.sleb128 0
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x51
+	.uleb128 0x2
+	.byte	0x76
+	.sleb128 0
+	.byte	0
+	.byte	0
+	.uleb128 0x3b
+	.long	.LASF65
+	.byte	0x1
+	.byte	0x47
+	.byte	0xd
+	.quad	.LFB29
+	.quad	.LFE29-.LFB29
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0xf34
+	.uleb128 0x8
+	.string	"ctx"
+	.byte	0x47
+	.byte	0x2e
+	.long	0xaf9
+	.long	.LLST0
+	.long	.LVUS0
+	.uleb128 0x8
+	.string	"src"
+	.byte	0x47
+	.byte	0x3d
+	.long	0x31d
+	.long	.LLST1
+	.long	.LVUS1
+	.uleb128 0x8
+	.string	"n"
+	.byte	0x47
+	.byte	0x49
+	.long	0x2e
+	.long	.LLST2
+	.long	.LVUS2
+	.uleb128 0xf
+	.string	"L"
+	.byte	0x49
+	.byte	0x1a
+	.long	0x395
+	.uleb128 0x2
+	.byte	0x77
+	.sleb128 32
+	.uleb128 0xf
+	.string	"m"
+	.byte	0x4a
+	.byte	0x11
+	.long	0xb66
+	.uleb128 0x2
+	.byte	0x77
+	.sleb128 0
+	.uleb128 0x10
+	.long	.LLRL3
+	.long	0xd81
+	.uleb128 0xb
+	.string	"i"
+	.byte	0x4c
+	.byte	0x13
+	.long	0x5d
+	.long	.LLST4
+	.long	.LVUS4
+	.uleb128 0x2d
+	.long	0x12ef
+	.long	.LLRL5
+	.byte	0x4d
+	.uleb128 0x14
+	.long	0x130e
+	.uleb128 0x14
+	.long	0x1304
+	.uleb128 0x14
+	.long	0x12fa
+	.uleb128 0x27
+	.long	0x131a
+	.long	.LLRL6
+	.uleb128 0x13
+	.long	0x131b
+	.long	.LLST7
+	.long	.LVUS7
+	.byte	0
+	.byte	0
+	.byte	0
+	.uleb128 0x10
+	.long	.LLRL21
+	.long	0xdda
+	.uleb128 0xb
+	.string	"i"
+	.byte	0x50
+	.byte	0x17
+	.long	0x5d
+	.long	.LLST22
+	.long	.LVUS22
+	.uleb128 0xa
+	.long	0x1286
+	.quad	.LBI102
+	.value	.LVU325
+	.long	.LLRL23
+	.byte	0x1
+	.byte	0x53
+	.byte	0xd
+	.uleb128 0x2
+	.long	0x12a5
+	.long	.LLST24
+	.long	.LVUS24
+	.uleb128 0x2
+	.long	0x129b
+	.long	.LLST25
+	.long	.LVUS25
+	.uleb128 0x2
+	.long	0x1291
+	.long	.LLST26
+	.long	.LVUS26
+	.byte	0
+	.byte	0
+	.uleb128 0x10
+	.long	.LLRL8
+	.long	0xe33
+	.uleb128 0xb
+	.string	"i"
+	.byte	0x58
+	.byte	0x17
+	.long	0x5d
+	.long	.LLST9
+	.long	.LVUS9
+	.uleb128 0xa
+	.long	0x1286
+	.quad	.LBI76
+	.value	.LVU177
+	.long	.LLRL10
+	.byte	0x1
+	.byte	0x5a
+	.byte	0xd
+	.uleb128 0x2
+	.long	0x12a5
+	.long	.LLST11
+	.long	.LVUS11
+	.uleb128 0x2
+	.long	0x129b
+	.long	.LLST12
+	.long	.LVUS12
+	.uleb128 0x2
+	.long	0x1291
+	.long	.LLST13
+	.long	.LVUS13
+	.byte	0
+	.byte	0
+	.uleb128 0x29
+	.quad	.LBB94
+	.quad	.LBE94-.LBB94
+	.long	0xe84
+	.uleb128 0x17
+	.string	"i"
+	.byte	0x1
+	.byte	0x5e
+	.byte	0x13
+	.long	0x5d
+	.uleb128 0x2d
+	.long	0x12b2
+	.long	.LLRL18
+	.byte	0x5f
+	.uleb128 0x14
+	.long	0x12d1
+	.uleb128 0x14
+	.long	0x12c7
+	.uleb128 0x14
+	.long	0x12bd
+	.uleb128 0x27
+	.long	0x12dd
+	.long	.LLRL19
+	.uleb128 0x13
+	.long	0x12de
+	.long	.LLST20
+	.long	.LVUS20
+	.byte	0
+	.byte	0
+	.byte	0
+	.uleb128 0x19
+	.long	0x132c
+	.quad	.LBI88
+	.value	.LVU234
+	.long	.LLRL14
+	.byte	0x1
+	.byte	0x5c
+	.byte	0x9
+	.long	0xee1
+	.uleb128 0x2
+	.long	0x134b
+	.long	.LLST15
+	.long	.LVUS15
+	.uleb128 0x2
+	.long	0x1341
+	.long	.LLST16
+	.long	.LVUS16
+	.uleb128 0x2
+	.long	0x1337
+	.long	.LLST17
+	.long	.LVUS17
+	.uleb128 0x28
+	.quad	.LVL17
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x7f
+	.sleb128 0
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x2
+	.byte	0x77
+	.sleb128 0
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x51
+	.uleb128 0x1
+	.byte	0x3f
+	.byte	0
+	.byte	0
+	.uleb128 0xa
+	.long	0x132c
+	.quad	.LBI130
+	.value	.LVU386
+	.long	.LLRL27
+	.byte	0x1
+	.byte	0x55
+	.byte	0x9
+	.uleb128 0x3c
+	.long	0x134b
+	.byte	0xf
+	.uleb128 0x2
+	.long	0x1341
+	.long	.LLST28
+	.long	.LVUS28
+	.uleb128 0x2
+	.long	0x1337
+	.long	.LLST29
+	.long	.LVUS29
+	.uleb128 0x28
+	.quad	.LVL31
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x7f
+	.sleb128 0
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x2
+	.byte	0x7e
+	.sleb128 0
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x51
+	.uleb128 0x1
+	.byte	0x3f
+	.byte	0
+	.byte	0
+	.byte	0
+	.uleb128 0x3d
+	.long	.LASF49
+	.byte	0x1
+	.byte	0x40
+	.byte	0x6
+	.byte	0x1
+	.long	0xf4e
+	.uleb128 0x5
+	.string	"ctx"
+	.byte	0x1
+	.byte	0x40
+	.byte	0x29
+	.long	0xaf9
+	.byte	0
+	.uleb128 0x2e
+	.long	.LASF52
+	.byte	0x3a
+	.long	0x48
+	.quad	.LFB27
+	.quad	.LFE27-.LFB27
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0x108c
+	.uleb128 0x8
+	.string	"ctx"
+	.byte	0x3a
+	.byte	0x2f
+	.long	0xaf9
+	.long	.LLST42
+	.long	.LVUS42
+	.uleb128 0x18
+	.long	.LASF50
+	.byte	0x3a
+	.byte	0x40
+	.long	0xc8
+	.long	.LLST43
+	.long	.LVUS43
+	.uleb128 0x18
+	.long	.LASF51
+	.byte	0x3b
+	.byte	0x23
+	.long	0x5d
+	.long	.LLST44
+	.long	.LVUS44
+	.uleb128 0xa
+	.long	0x11f4
+	.quad	.LBI158
+	.value	.LVU446
+	.long	.LLRL45
+	.byte	0x1
+	.byte	0x3d
+	.byte	0xc
+	.uleb128 0x2
+	.long	0x1233
+	.long	.LLST46
+	.long	.LVUS46
+	.uleb128 0x2
+	.long	0x1227
+	.long	.LLST47
+	.long	.LVUS47
+	.uleb128 0x2
+	.long	0x121b
+	.long	.LLST47
+	.long	.LVUS47
+	.uleb128 0x2
+	.long	0x120f
+	.long	.LLST49
+	.long	.LVUS49
+	.uleb128 0x2
+	.long	0x1203
+	.long	.LLST50
+	.long	.LVUS50
+	.uleb128 0x12
+	.long	.LLRL45
+	.uleb128 0x1a
+	.long	0x123f
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -80
+	.uleb128 0x1b
+	.long	0x1249
+	.quad	.LBB160
+	.quad	.LBE160-.LBB160
+	.long	0x105e
+	.uleb128 0x13
+	.long	0x124a
+	.long	.LLST51
+	.long	.LVUS51
+	.uleb128 0x9
+	.quad	.LVL56
+	.long	0x547
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x3
+	.byte	0x76
+	.sleb128 -256
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x2
+	.byte	0x7e
+	.sleb128 0
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x51
+	.uleb128 0x2
+	.byte	0x7d
+	.sleb128 0
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x52
+	.uleb128 0x1
+	.byte	0x30
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x58
+	.uleb128 0x1
+	.byte	0x30
+	.byte	0
+	.byte	0
+	.uleb128 0x9
+	.quad	.LVL53
+	.long	0x547
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x3
+	.byte	0x7c
+	.sleb128 1024
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x2
+	.byte	0x7e
+	.sleb128 0
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x51
+	.uleb128 0x2
+	.byte	0x7d
+	.sleb128 0
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x52
+	.uleb128 0x1
+	.byte	0x30
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x58
+	.uleb128 0x1
+	.byte	0x30
+	.byte	0
+	.byte	0
+	.byte	0
+	.byte	0
+	.uleb128 0x2e
+	.long	.LASF53
+	.byte	0x32
+	.long	0x48
+	.quad	.LFB26
+	.quad	.LFE26-.LFB26
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0x11f4
+	.uleb128 0x8
+	.string	"ctx"
+	.byte	0x32
+	.byte	0x2e
+	.long	0xaf9
+	.long	.LLST30
+	.long	.LVUS30
+	.uleb128 0x18
+	.long	.LASF50
+	.byte	0x32
+	.byte	0x3f
+	.long	0xc8
+	.long	.LLST31
+	.long	.LVUS31
+	.uleb128 0x8
+	.string	"key"
+	.byte	0x33
+	.byte	0x25
+	.long	0xc8
+	.long	.LLST32
+	.long	.LVUS32
+	.uleb128 0x18
+	.long	.LASF54
+	.byte	0x33
+	.byte	0x33
+	.long	0x5d
+	.long	.LLST33
+	.long	.LVUS33
+	.uleb128 0x18
+	.long	.LASF51
+	.byte	0x33
+	.byte	0x45
+	.long	0x5d
+	.long	.LLST34
+	.long	.LVUS34
+	.uleb128 0xa
+	.long	0x11f4
+	.quad	.LBI150
+	.value	.LVU397
+	.long	.LLRL35
+	.byte	0x1
+	.byte	0x37
+	.byte	0xc
+	.uleb128 0x2
+	.long	0x1233
+	.long	.LLST36
+	.long	.LVUS36
+	.uleb128 0x2
+	.long	0x1227
+	.long	.LLST37
+	.long	.LVUS37
+	.uleb128 0x2
+	.long	0x121b
+	.long	.LLST38
+	.long	.LVUS38
+	.uleb128 0x2
+	.long	0x120f
+	.long	.LLST39
+	.long	.LVUS39
+	.uleb128 0x2
+	.long	0x1203
+	.long	.LLST40
+	.long	.LVUS40
+	.uleb128 0x12
+	.long	.LLRL35
+	.uleb128 0x1a
+	.long	0x123f
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -96
+	.uleb128 0x1b
+	.long	0x1249
+	.quad	.LBB152
+	.quad	.LBE152-.LBB152
+	.long	0x11c6
+	.uleb128 0x13
+	.long	0x124a
+	.long	.LLST41
+	.long	.LVUS41
+	.uleb128 0x9
+	.quad	.LVL43
+	.long	0x547
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x3
+	.byte	0x7e
+	.sleb128 -256
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x2
+	.byte	0x7f
+	.sleb128 0
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x51
+	.uleb128 0x2
+	.byte	0x7d
+	.sleb128 0
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x52
+	.uleb128 0x4
+	.byte	0x91
+	.sleb128 -104
+	.byte	0x6
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x58
+	.uleb128 0x2
+	.byte	0x76
+	.sleb128 0
+	.byte	0
+	.byte	0
+	.uleb128 0x9
+	.quad	.LVL40
+	.long	0x547
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x3
+	.byte	0x7c
+	.sleb128 1024
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x2
+	.byte	0x7f
+	.sleb128 0
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x51
+	.uleb128 0x2
+	.byte	0x7d
+	.sleb128 0
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x52
+	.uleb128 0x1
+	.byte	0x30
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x58
+	.uleb128 0x1
+	.byte	0x30
+	.byte	0
+	.byte	0
+	.byte	0
+	.byte	0
+	.uleb128 0x2c
+	.long	.LASF56
+	.byte	0x19
+	.byte	0xc
+	.long	0x48
+	.long	0x1256
+	.uleb128 0x5
+	.string	"ctx"
+	.byte	0x1
+	.byte	0x19
+	.byte	0x2a
+	.long	0xaf9
+	.uleb128 0x1d
+	.long	.LASF50
+	.byte	0x1
+	.byte	0x19
+	.byte	0x3b
+	.long	0xc8
+	.uleb128 0x5
+	.string	"key"
+	.byte	0x1
+	.byte	0x1a
+	.byte	0x21
+	.long	0xc8
+	.uleb128 0x1d
+	.long	.LASF54
+	.byte	0x1
+	.byte	0x1a
+	.byte	0x2f
+	.long	0x5d
+	.uleb128 0x1d
+	.long	.LASF51
+	.byte	0x1
+	.byte	0x1a
+	.byte	0x41
+	.long	0x5d
+	.uleb128 0x17
+	.string	"P"
+	.byte	0x1
+	.byte	0x1c
+	.byte	0x9
+	.long	0x1256
+	.uleb128 0x2a
+	.uleb128 0x17
+	.string	"i"
+	.byte	0x1
+	.byte	0x28
+	.byte	0x13
+	.long	0x5d
+	.byte	0
+	.byte	0
+	.uleb128 0x7
+	.long	0x322
+	.long	0x1266
+	.uleb128 0x4
+	.long	0x3a
+	.byte	0x3
+	.byte	0
+	.uleb128 0x15
+	.long	.LASF57
+	.byte	0x2
+	.byte	0x78
+	.long	0x1286
+	.uleb128 0x5
+	.string	"y"
+	.byte	0x2
+	.byte	0x78
+	.byte	0x2e
+	.long	0xce
+	.uleb128 0x5
+	.string	"x"
+	.byte	0x2
+	.byte	0x78
+	.byte	0x35
+	.long	0x322
+	.byte	0
+	.uleb128 0x15
+	.long	.LASF58
+	.byte	0x2
+	.byte	0x6e
+	.long	0x12b2
+	.uleb128 0x5
+	.string	"L"
+	.byte	0x2
+	.byte	0x6e
+	.byte	0x37
+	.long	0x4a1
+	.uleb128 0x5
+	.string	"l"
+	.byte	0x2
+	.byte	0x6e
+	.byte	0x43
+	.long	0x5d
+	.uleb128 0x5
+	.string	"inc"
+	.byte	0x2
+	.byte	0x6e
+	.byte	0x4d
+	.long	0x2e
+	.byte	0
+	.uleb128 0x15
+	.long	.LASF59
+	.byte	0x2
+	.byte	0x63
+	.long	0x12ea
+	.uleb128 0x5
+	.string	"L"
+	.byte	0x2
+	.byte	0x63
+	.byte	0x3d
+	.long	0x12ea
+	.uleb128 0x5
+	.string	"l"
+	.byte	0x2
+	.byte	0x63
+	.byte	0x49
+	.long	0x5d
+	.uleb128 0x5
+	.string	"ctx"
+	.byte	0x2
+	.byte	0x64
+	.byte	0x35
+	.long	0x468
+	.uleb128 0x2a
+	.uleb128 0x17
+	.string	"i"
+	.byte	0x2
+	.byte	0x66
+	.byte	0x13
+	.long	0x5d
+	.byte	0
+	.byte	0
+	.uleb128 0x6
+	.long	0x3c6
+	.uleb128 0x15
+	.long	.LASF60
+	.byte	0x2
+	.byte	0x58
+	.long	0x1327
+	.uleb128 0x5
+	.string	"L"
+	.byte	0x2
+	.byte	0x58
+	.byte	0x36
+	.long	0x4a1
+	.uleb128 0x5
+	.string	"l"
+	.byte	0x2
+	.byte	0x58
+	.byte	0x42
+	.long	0x5d
+	.uleb128 0x5
+	.string	"ctx"
+	.byte	0x2
+	.byte	0x59
+	.byte	0x3a
+	.long	0x1327
+	.uleb128 0x2a
+	.uleb128 0x17
+	.string	"i"
+	.byte	0x2
+	.byte	0x5b
+	.byte	0x13
+	.long	0x5d
+	.byte	0
+	.byte	0
+	.uleb128 0x6
+	.long	0x136
+	.uleb128 0x15
+	.long	.LASF61
+	.byte	0x2
+	.byte	0x51
+	.long	0x1358
+	.uleb128 0x5
+	.string	"L"
+	.byte	0x2
+	.byte	0x51
+	.byte	0x41
+	.long	0x4a1
+	.uleb128 0x5
+	.string	"m"
+	.byte	0x2
+	.byte	0x52
+	.byte	0x37
+	.long	0x318
+	.uleb128 0x1d
+	.long	.LASF46
+	.byte	0x2
+	.byte	0x52
+	.byte	0x45
+	.long	0x5d
+	.byte	0
+	.uleb128 0x15
+	.long	.LASF62
+	.byte	0x3
+	.byte	0xde
+	.long	0x1378
+	.uleb128 0x5
+	.string	"y"
+	.byte	0x3
+	.byte	0xde
+	.byte	0x2e
+	.long	0xce
+	.uleb128 0x5
+	.string	"x"
+	.byte	0x3
+	.byte	0xde
+	.byte	0x35
+	.long	0x1ee
+	.byte	0
+	.uleb128 0x3e
+	.long	0xf34
+	.quad	.LFB28
+	.quad	.LFE28-.LFB28
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0x1486
+	.uleb128 0x2
+	.long	0xf41
+	.long	.LLST52
+	.long	.LVUS52
+	.uleb128 0xa
+	.long	0x11f4
+	.quad	.LBI172
+	.value	.LVU497
+	.long	.LLRL53
+	.byte	0x1
+	.byte	0x42
+	.byte	0x5
+	.uleb128 0x2
+	.long	0x1233
+	.long	.LLST54
+	.long	.LVUS54
+	.uleb128 0x2
+	.long	0x1227
+	.long	.LLST55
+	.long	.LVUS55
+	.uleb128 0x2
+	.long	0x121b
+	.long	.LLST55
+	.long	.LVUS55
+	.uleb128 0x2
+	.long	0x120f
+	.long	.LLST55
+	.long	.LVUS55
+	.uleb128 0x2
+	.long	0x1203
+	.long	.LLST58
+	.long	.LVUS58
+	.uleb128 0x12
+	.long	.LLRL53
+	.uleb128 0x1a
+	.long	0x123f
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -80
+	.uleb128 0x1b
+	.long	0x1249
+	.quad	.LBB174
+	.quad	.LBE174-.LBB174
+	.long	0x1456
+	.uleb128 0x13
+	.long	0x124a
+	.long	.LLST59
+	.long	.LVUS59
+	.uleb128 0x9
+	.quad	.LVL66
+	.long	0x547
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x3
+	.byte	0x76
+	.sleb128 -256
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x2
+	.byte	0x7d
+	.sleb128 0
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x51
+	.uleb128 0x1
+	.byte	0x30
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x52
+	.uleb128 0x1
+	.byte	0x30
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x58
+	.uleb128 0x1
+	.byte	0x30
+	.byte	0
+	.byte	0
+	.uleb128 0x9
+	.quad	.LVL63
+	.long	0x547
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x3
+	.byte	0x7c
+	.sleb128 1024
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x2
+	.byte	0x7d
+	.sleb128 0
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x51
+	.uleb128 0x2
+	.byte	0x73
+	.sleb128 0
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x52
+	.uleb128 0x2
+	.byte	0x73
+	.sleb128 0
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x58
+	.uleb128 0x2
+	.byte	0x73
+	.sleb128 0
+	.byte	0
+	.byte	0
+	.byte	0
+	.byte	0
+	.uleb128 0x3f
+	.long	.LASF38
+	.long	.LASF66
+	.byte	0xa
+	.byte	0
+	.byte	0
+	.section	.debug_abbrev,"",@progbits
+.Ldebug_abbrev0:
+	.uleb128 0x1
+	.uleb128 0x49
+	.byte	0
+	.uleb128 0x2
+	.uleb128 0x18
+	.uleb128 0x7e
+	.uleb128 0x18
+	.byte	0
+	.byte	0
+	.uleb128 0x2
+	.uleb128 0x5
+	.byte	0
+	.uleb128 0x31
+	.uleb128 0x13
+	.uleb128 0x2
+	.uleb128 0x17
+	.uleb128 0x2137
+	.uleb128 0x17
+	.byte	0
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x5
+	.byte	0
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x4
+	.uleb128 0x21
+	.byte	0
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x2f
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x5
+	.uleb128 0x5
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x8
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x6
+	.uleb128 0xf
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0x21
+	.sleb128 8
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x7
+	.uleb128 0x1
+	.byte	0x1
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x8
+	.uleb128 0x5
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x8
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x2
+	.uleb128 0x17
+	.uleb128 0x2137
+	.uleb128 0x17
+	.byte	0
+	.byte	0
+	.uleb128 0x9
+	.uleb128 0x48
+	.byte	0x1
+	.uleb128 0x7d
+	.uleb128 0x1
+	.uleb128 0x7f
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0xa
+	.uleb128 0x1d
+	.byte	0x1
+	.uleb128 0x31
+	.uleb128 0x13
+	.uleb128 0x52
+	.uleb128 0x1
+	.uleb128 0x2138
+	.uleb128 0x5
+	.uleb128 0x55
+	.uleb128 0x17
+	.uleb128 0x58
+	.uleb128 0xb
+	.uleb128 0x59
+	.uleb128 0xb
+	.uleb128 0x57
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x8
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x2
+	.uleb128 0x17
+	.uleb128 0x2137
+	.uleb128 0x17
+	.byte	0
+	.byte	0
+	.uleb128 0xc
+	.uleb128 0x24
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x3e
+	.uleb128 0xb
+	.uleb128 0x3
+	.uleb128 0xe
+	.byte	0
+	.byte	0
+	.uleb128 0xd
+	.uleb128 0x26
+	.byte	0
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0xe
+	.uleb128 0xd
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x38
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0xf
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x8
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x2
+	.uleb128 0x18
+	.byte	0
+	.byte	0
+	.uleb128 0x10
+	.uleb128 0xb
+	.byte	0x1
+	.uleb128 0x55
+	.uleb128 0x17
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x11
+	.uleb128 0x16
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x12
+	.uleb128 0xb
+	.byte	0x1
+	.uleb128 0x55
+	.uleb128 0x17
+	.byte	0
+	.byte	0
+	.uleb128 0x13
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x31
+	.uleb128 0x13
+	.uleb128 0x2
+	.uleb128 0x17
+	.uleb128 0x2137
+	.uleb128 0x17
+	.byte	0
+	.byte	0
+	.uleb128 0x14
+	.uleb128 0x5
+	.byte	0
+	.uleb128 0x31
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x15
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 20
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x20
+	.uleb128 0x21
+	.sleb128 3
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x16
+	.uleb128 0xd
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x8
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x38
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x17
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x8
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x18
+	.uleb128 0x5
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x2
+	.uleb128 0x17
+	.uleb128 0x2137
+	.uleb128 0x17
+	.byte	0
+	.byte	0
+	.uleb128 0x19
+	.uleb128 0x1d
+	.byte	0x1
+	.uleb128 0x31
+	.uleb128 0x13
+	.uleb128 0x52
+	.uleb128 0x1
+	.uleb128 0x2138
+	.uleb128 0x5
+	.uleb128 0x55
+	.uleb128 0x17
+	.uleb128 0x58
+	.uleb128 0xb
+	.uleb128 0x59
+	.uleb128 0xb
+	.uleb128 0x57
+	.uleb128 0xb
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x1a
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x31
+	.uleb128 0x13
+	.uleb128 0x2
+	.uleb128 0x18
+	.byte	0
+	.byte	0
+	.uleb128 0x1b
+	.uleb128 0xb
+	.byte	0x1
+	.uleb128 0x31
+	.uleb128 0x13
+	.uleb128 0x11
+	.uleb128 0x1
+	.uleb128 0x12
+	.uleb128 0x7
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x1c
+	.uleb128 0x48
+	.byte	0x1
+	.uleb128 0x7d
+	.uleb128 0x1
+	.uleb128 0x7f
+	.uleb128 0x13
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x1d
+	.uleb128 0x5
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x1e
+	.uleb128 0x13
+	.byte	0x1
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0xb
+	.uleb128 0x5
+	.uleb128 0x88
+	.uleb128 0x21
+	.sleb128 32
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 8
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x1f
+	.uleb128 0xd
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x8
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x38
+	.uleb128 0x5
+	.byte	0
+	.byte	0
+	.uleb128 0x20
+	.uleb128 0x16
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x8
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x21
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x1c
+	.uleb128 0xa
+	.byte	0
+	.byte	0
+	.uleb128 0x22
+	.uleb128 0x15
+	.byte	0x1
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x23
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 6
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x3c
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x24
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 9
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 14
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x3c
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x25
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 6
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x11
+	.uleb128 0x1
+	.uleb128 0x12
+	.uleb128 0x7
+	.uleb128 0x40
+	.uleb128 0x18
+	.uleb128 0x7a
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x26
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x2
+	.uleb128 0x17
+	.uleb128 0x2137
+	.uleb128 0x17
+	.byte	0
+	.byte	0
+	.uleb128 0x27
+	.uleb128 0xb
+	.byte	0x1
+	.uleb128 0x31
+	.uleb128 0x13
+	.uleb128 0x55
+	.uleb128 0x17
+	.byte	0
+	.byte	0
+	.uleb128 0x28
+	.uleb128 0x48
+	.byte	0x1
+	.uleb128 0x7d
+	.uleb128 0x1
+	.byte	0
+	.byte	0
+	.uleb128 0x29
+	.uleb128 0xb
+	.byte	0x1
+	.uleb128 0x11
+	.uleb128 0x1
+	.uleb128 0x12
+	.uleb128 0x7
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x2a
+	.uleb128 0xb
+	.byte	0x1
+	.byte	0
+	.byte	0
+	.uleb128 0x2b
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 8
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x2
+	.uleb128 0x18
+	.byte	0
+	.byte	0
+	.uleb128 0x2c
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x20
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x2d
+	.uleb128 0x1d
+	.byte	0x1
+	.uleb128 0x31
+	.uleb128 0x13
+	.uleb128 0x55
+	.uleb128 0x17
+	.uleb128 0x58
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x59
+	.uleb128 0xb
+	.uleb128 0x57
+	.uleb128 0x21
+	.sleb128 9
+	.byte	0
+	.byte	0
+	.uleb128 0x2e
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 5
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x11
+	.uleb128 0x1
+	.uleb128 0x12
+	.uleb128 0x7
+	.uleb128 0x40
+	.uleb128 0x18
+	.uleb128 0x7a
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x2f
+	.uleb128 0x11
+	.byte	0x1
+	.uleb128 0x25
+	.uleb128 0xe
+	.uleb128 0x13
+	.uleb128 0xb
+	.uleb128 0x3
+	.uleb128 0x1f
+	.uleb128 0x1b
+	.uleb128 0x1f
+	.uleb128 0x11
+	.uleb128 0x1
+	.uleb128 0x12
+	.uleb128 0x7
+	.uleb128 0x10
+	.uleb128 0x17
+	.byte	0
+	.byte	0
+	.uleb128 0x30
+	.uleb128 0x24
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x3e
+	.uleb128 0xb
+	.uleb128 0x3
+	.uleb128 0x8
+	.byte	0
+	.byte	0
+	.uleb128 0x31
+	.uleb128 0xf
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x32
+	.uleb128 0x26
+	.byte	0
+	.byte	0
+	.byte	0
+	.uleb128 0x33
+	.uleb128 0xd
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x8
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x88
+	.uleb128 0xb
+	.uleb128 0x38
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x34
+	.uleb128 0xd
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x8
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x88
+	.uleb128 0xb
+	.uleb128 0x38
+	.uleb128 0x5
+	.byte	0
+	.byte	0
+	.uleb128 0x35
+	.uleb128 0xd
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x38
+	.uleb128 0x5
+	.byte	0
+	.byte	0
+	.uleb128 0x36
+	.uleb128 0x1
+	.byte	0x1
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x88
+	.uleb128 0xb
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x37
+	.uleb128 0x21
+	.byte	0
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x2f
+	.uleb128 0x5
+	.byte	0
+	.byte	0
+	.uleb128 0x38
+	.uleb128 0x15
+	.byte	0
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x39
+	.uleb128 0x13
+	.byte	0x1
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x3a
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3c
+	.uleb128 0x19
+	.byte	0
+	.byte	0
+	.uleb128 0x3b
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x11
+	.uleb128 0x1
+	.uleb128 0x12
+	.uleb128 0x7
+	.uleb128 0x40
+	.uleb128 0x18
+	.uleb128 0x7a
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x3c
+	.uleb128 0x5
+	.byte	0
+	.uleb128 0x31
+	.uleb128 0x13
+	.uleb128 0x1c
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x3d
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x20
+	.uleb128 0xb
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x3e
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x31
+	.uleb128 0x13
+	.uleb128 0x11
+	.uleb128 0x1
+	.uleb128 0x12
+	.uleb128 0x7
+	.uleb128 0x40
+	.uleb128 0x18
+	.uleb128 0x7a
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x3f
+	.uleb128 0x2e
+	.byte	0
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3c
+	.uleb128 0x19
+	.uleb128 0x6e
+	.uleb128 0xe
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.byte	0
+	.section	.debug_loclists,"",@progbits
+	.long	.Ldebug_loc3-.Ldebug_loc2
+.Ldebug_loc2:
+	.value	0x5
+	.byte	0x8
+	.byte	0
+	.long	0
+.Ldebug_loc0:
+.LVUS111:
+	.uleb128 0
+	.uleb128 .LVU1212
+	.uleb128 .LVU1212
+	.uleb128 .LVU1246
+	.uleb128 .LVU1246
+	.uleb128 .LVU1247
+	.uleb128 .LVU1247
+	.uleb128 .LVU1249
+	.uleb128 .LVU1249
+	.uleb128 0
+.LLST111:
+	.byte	0x4
+	.uleb128 .LVL227-.Ltext0
+	.uleb128 .LVL231-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL231-.Ltext0
+	.uleb128 .LVL241-.Ltext0
+	.uleb128 0x2
+	.byte	0x77
+	.sleb128 24
+	.byte	0x4
+	.uleb128 .LVL241-.Ltext0
+	.uleb128 .LVL242-.Ltext0
+	.uleb128 0x2
+	.byte	0x7c
+	.sleb128 -40
+	.byte	0x4
+	.uleb128 .LVL242-.Ltext0
+	.uleb128 .LVL244-.Ltext0
+	.uleb128 0x9
+	.byte	0x76
+	.sleb128 -40
+	.byte	0x9
+	.byte	0xe0
+	.byte	0x1a
+	.byte	0xa
+	.value	0x8c8
+	.byte	0x1c
+	.byte	0x4
+	.uleb128 .LVL244-.Ltext0
+	.uleb128 .LFE33-.Ltext0
+	.uleb128 0x9
+	.byte	0x77
+	.sleb128 -48
+	.byte	0x9
+	.byte	0xe0
+	.byte	0x1a
+	.byte	0xa
+	.value	0x8c8
+	.byte	0x1c
+	.byte	0
+.LVUS112:
+	.uleb128 0
+	.uleb128 .LVU1215
+	.uleb128 .LVU1215
+	.uleb128 .LVU1246
+	.uleb128 .LVU1246
+	.uleb128 .LVU1247
+	.uleb128 .LVU1247
+	.uleb128 .LVU1249
+	.uleb128 .LVU1249
+	.uleb128 0
+.LLST112:
+	.byte	0x4
+	.uleb128 .LVL227-.Ltext0
+	.uleb128 .LVL232-.Ltext0
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x4
+	.uleb128 .LVL232-.Ltext0
+	.uleb128 .LVL241-.Ltext0
+	.uleb128 0x2
+	.byte	0x77
+	.sleb128 16
+	.byte	0x4
+	.uleb128 .LVL241-.Ltext0
+	.uleb128 .LVL242-.Ltext0
+	.uleb128 0x2
+	.byte	0x7c
+	.sleb128 -48
+	.byte	0x4
+	.uleb128 .LVL242-.Ltext0
+	.uleb128 .LVL244-.Ltext0
+	.uleb128 0x9
+	.byte	0x76
+	.sleb128 -40
+	.byte	0x9
+	.byte	0xe0
+	.byte	0x1a
+	.byte	0xa
+	.value	0x8d0
+	.byte	0x1c
+	.byte	0x4
+	.uleb128 .LVL244-.Ltext0
+	.uleb128 .LFE33-.Ltext0
+	.uleb128 0x9
+	.byte	0x77
+	.sleb128 -48
+	.byte	0x9
+	.byte	0xe0
+	.byte	0x1a
+	.byte	0xa
+	.value	0x8d0
+	.byte	0x1c
+	.byte	0
+.LVUS113:
+	.uleb128 0
+	.uleb128 .LVU1198
+	.uleb128 .LVU1198
+	.uleb128 .LVU1248
+	.uleb128 .LVU1248
+	.uleb128 0
+.LLST113:
+	.byte	0x4
+	.uleb128 .LVL227-.Ltext0
+	.uleb128 .LVL228-.Ltext0
+	.uleb128 0x1
+	.byte	0x51
+	.byte	0x4
+	.uleb128 .LVL228-.Ltext0
+	.uleb128 .LVL243-.Ltext0
+	.uleb128 0x1
+	.byte	0x5f
+	.byte	0x4
+	.uleb128 .LVL243-.Ltext0
+	.uleb128 .LFE33-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x51
+	.byte	0x9f
+	.byte	0
+.LVUS115:
+	.uleb128 .LVU1202
+	.uleb128 .LVU1210
+	.uleb128 .LVU1210
+	.uleb128 .LVU1242
+.LLST115:
+	.byte	0x4
+	.uleb128 .LVL229-.Ltext0
+	.uleb128 .LVL230-.Ltext0
+	.uleb128 0x4
+	.byte	0x77
+	.sleb128 64
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL230-.Ltext0
+	.uleb128 .LVL238-.Ltext0
+	.uleb128 0x1
+	.byte	0x5c
+	.byte	0
+.LVUS116:
+	.uleb128 .LVU1204
+	.uleb128 .LVU1242
+.LLST116:
+	.byte	0x4
+	.uleb128 .LVL229-.Ltext0
+	.uleb128 .LVL238-.Ltext0
+	.uleb128 0x3
+	.byte	0x8
+	.byte	0x40
+	.byte	0x9f
+	.byte	0
+.LVUS117:
+	.uleb128 .LVU1204
+	.uleb128 .LVU1242
+.LLST117:
+	.byte	0x4
+	.uleb128 .LVL229-.Ltext0
+	.uleb128 .LVL238-.Ltext0
+	.uleb128 0x2
+	.byte	0x30
+	.byte	0x9f
+	.byte	0
+.LVUS120:
+	.uleb128 .LVU1204
+	.uleb128 .LVU1210
+	.uleb128 .LVU1210
+	.uleb128 .LVU1242
+.LLST120:
+	.byte	0x4
+	.uleb128 .LVL229-.Ltext0
+	.uleb128 .LVL230-.Ltext0
+	.uleb128 0x4
+	.byte	0x77
+	.sleb128 64
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL230-.Ltext0
+	.uleb128 .LVL238-.Ltext0
+	.uleb128 0x1
+	.byte	0x5c
+	.byte	0
+.LVUS121:
+	.uleb128 .LVU1225
+	.uleb128 .LVU1226
+	.uleb128 .LVU1226
+	.uleb128 .LVU1230
+.LLST121:
+	.byte	0x4
+	.uleb128 .LVL234-.Ltext0
+	.uleb128 .LVL234-.Ltext0
+	.uleb128 0x2
+	.byte	0x30
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL234-.Ltext0
+	.uleb128 .LVL235-.Ltext0
+	.uleb128 0x1
+	.byte	0x5d
+	.byte	0
+.LVUS67:
+	.uleb128 0
+	.uleb128 .LVU636
+	.uleb128 .LVU636
+	.uleb128 .LVU639
+	.uleb128 .LVU639
+	.uleb128 .LVU1153
+	.uleb128 .LVU1153
+	.uleb128 .LVU1155
+	.uleb128 .LVU1155
+	.uleb128 0
+.LLST67:
+	.byte	0x4
+	.uleb128 .LVL91-.Ltext0
+	.uleb128 .LVL93-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL93-.Ltext0
+	.uleb128 .LVL94-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL94-.Ltext0
+	.uleb128 .LVL218-.Ltext0
+	.uleb128 0x2
+	.byte	0x77
+	.sleb128 24
+	.byte	0x4
+	.uleb128 .LVL218-.Ltext0
+	.uleb128 .LVL219-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL219-.Ltext0
+	.uleb128 .LFE32-.Ltext0
+	.uleb128 0x2
+	.byte	0x77
+	.sleb128 24
+	.byte	0
+.LVUS68:
+	.uleb128 0
+	.uleb128 .LVU635
+	.uleb128 .LVU635
+	.uleb128 .LVU1153
+	.uleb128 .LVU1153
+	.uleb128 .LVU1155
+	.uleb128 .LVU1155
+	.uleb128 0
+.LLST68:
+	.byte	0x4
+	.uleb128 .LVL91-.Ltext0
+	.uleb128 .LVL92-.Ltext0
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x4
+	.uleb128 .LVL92-.Ltext0
+	.uleb128 .LVL218-.Ltext0
+	.uleb128 0x2
+	.byte	0x77
+	.sleb128 40
+	.byte	0x4
+	.uleb128 .LVL218-.Ltext0
+	.uleb128 .LVL219-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL219-.Ltext0
+	.uleb128 .LFE32-.Ltext0
+	.uleb128 0x2
+	.byte	0x77
+	.sleb128 40
+	.byte	0
+.LVUS69:
+	.uleb128 .LVU620
+	.uleb128 .LVU639
+	.uleb128 .LVU639
+	.uleb128 .LVU712
+	.uleb128 .LVU716
+	.uleb128 .LVU774
+	.uleb128 .LVU774
+	.uleb128 .LVU1153
+	.uleb128 .LVU1155
+	.uleb128 .LVU1158
+	.uleb128 .LVU1158
+	.uleb128 .LVU1159
+	.uleb128 .LVU1159
+	.uleb128 0
+.LLST69:
+	.byte	0x4
+	.uleb128 .LVL91-.Ltext0
+	.uleb128 .LVL94-.Ltext0
+	.uleb128 0x2
+	.byte	0x30
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL94-.Ltext0
+	.uleb128 .LVL101-.Ltext0
+	.uleb128 0x1
+	.byte	0x59
+	.byte	0x4
+	.uleb128 .LVL102-.Ltext0
+	.uleb128 .LVL115-.Ltext0
+	.uleb128 0x1
+	.byte	0x59
+	.byte	0x4
+	.uleb128 .LVL115-.Ltext0
+	.uleb128 .LVL218-.Ltext0
+	.uleb128 0x3
+	.byte	0x77
+	.sleb128 80
+	.byte	0x4
+	.uleb128 .LVL219-.Ltext0
+	.uleb128 .LVL220-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x59
+	.byte	0x4
+	.uleb128 .LVL220-1-.Ltext0
+	.uleb128 .LVL221-.Ltext0
+	.uleb128 0x3
+	.byte	0x77
+	.sleb128 68
+	.byte	0x4
+	.uleb128 .LVL221-.Ltext0
+	.uleb128 .LFE32-.Ltext0
+	.uleb128 0x3
+	.byte	0x77
+	.sleb128 80
+	.byte	0
+.LVUS71:
+	.uleb128 .LVU624
+	.uleb128 .LVU639
+	.uleb128 .LVU639
+	.uleb128 .LVU724
+	.uleb128 .LVU724
+	.uleb128 .LVU768
+	.uleb128 .LVU1155
+	.uleb128 .LVU1159
+.LLST71:
+	.byte	0x4
+	.uleb128 .LVL91-.Ltext0
+	.uleb128 .LVL94-.Ltext0
+	.uleb128 0x2
+	.byte	0x30
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL94-.Ltext0
+	.uleb128 .LVL103-.Ltext0
+	.uleb128 0x1
+	.byte	0x5e
+	.byte	0x4
+	.uleb128 .LVL103-.Ltext0
+	.uleb128 .LVL112-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0x4
+	.uleb128 .LVL219-.Ltext0
+	.uleb128 .LVL221-.Ltext0
+	.uleb128 0x1
+	.byte	0x5e
+	.byte	0
+.LVUS73:
+	.uleb128 .LVU649
+	.uleb128 .LVU650
+	.uleb128 .LVU652
+	.uleb128 .LVU674
+	.uleb128 .LVU674
+	.uleb128 .LVU700
+	.uleb128 .LVU700
+	.uleb128 .LVU724
+	.uleb128 .LVU724
+	.uleb128 .LVU770
+	.uleb128 .LVU1155
+	.uleb128 .LVU1159
+.LLST73:
+	.byte	0x4
+	.uleb128 .LVL95-.Ltext0
+	.uleb128 .LVL95-.Ltext0
+	.uleb128 0x1
+	.byte	0x5e
+	.byte	0x4
+	.uleb128 .LVL96-.Ltext0
+	.uleb128 .LVL98-.Ltext0
+	.uleb128 0x1
+	.byte	0x5e
+	.byte	0x4
+	.uleb128 .LVL98-.Ltext0
+	.uleb128 .LVL100-.Ltext0
+	.uleb128 0x3
+	.byte	0x7e
+	.sleb128 4
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL100-.Ltext0
+	.uleb128 .LVL103-.Ltext0
+	.uleb128 0x3
+	.byte	0x7e
+	.sleb128 8
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL103-.Ltext0
+	.uleb128 .LVL113-.Ltext0
+	.uleb128 0x3
+	.byte	0x73
+	.sleb128 8
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL219-.Ltext0
+	.uleb128 .LVL221-.Ltext0
+	.uleb128 0x3
+	.byte	0x7e
+	.sleb128 8
+	.byte	0x9f
+	.byte	0
+.LVUS75:
+	.uleb128 .LVU659
+	.uleb128 .LVU672
+	.uleb128 .LVU681
+	.uleb128 .LVU698
+.LLST75:
+	.byte	0x4
+	.uleb128 .LVL97-.Ltext0
+	.uleb128 .LVL98-.Ltext0
+	.uleb128 0x26
+	.byte	0x77
+	.sleb128 96
+	.byte	0x6
+	.byte	0x12
+	.byte	0x23
+	.uleb128 0x8000000000000000
+	.byte	0x8
+	.byte	0x80
+	.byte	0x16
+	.byte	0x14
+	.byte	0x23
+	.uleb128 0x8000000000000000
+	.byte	0x2d
+	.byte	0x28
+	.value	0x1
+	.byte	0x16
+	.byte	0x13
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL99-.Ltext0
+	.uleb128 .LVL100-.Ltext0
+	.uleb128 0x2a
+	.byte	0x77
+	.sleb128 96
+	.byte	0x6
+	.byte	0xa
+	.value	0x200
+	.byte	0x1c
+	.byte	0x12
+	.byte	0x23
+	.uleb128 0x8000000000000000
+	.byte	0x8
+	.byte	0x80
+	.byte	0x16
+	.byte	0x14
+	.byte	0x23
+	.uleb128 0x8000000000000000
+	.byte	0x2d
+	.byte	0x28
+	.value	0x1
+	.byte	0x16
+	.byte	0x13
+	.byte	0x9f
+	.byte	0
+.LVUS77:
+	.uleb128 .LVU654
+	.uleb128 .LVU659
+	.uleb128 .LVU676
+	.uleb128 .LVU681
+.LLST77:
+	.byte	0x4
+	.uleb128 .LVL96-.Ltext0
+	.uleb128 .LVL97-.Ltext0
+	.uleb128 0x1
+	.byte	0x5e
+	.byte	0x4
+	.uleb128 .LVL98-.Ltext0
+	.uleb128 .LVL99-.Ltext0
+	.uleb128 0x3
+	.byte	0x7e
+	.sleb128 4
+	.byte	0x9f
+	.byte	0
+.LVUS78:
+	.uleb128 .LVU654
+	.uleb128 .LVU658
+	.uleb128 .LVU658
+	.uleb128 .LVU659
+	.uleb128 .LVU676
+	.uleb128 .LVU680
+	.uleb128 .LVU680
+	.uleb128 .LVU681
+.LLST78:
+	.byte	0x4
+	.uleb128 .LVL96-.Ltext0
+	.uleb128 .LVL97-.Ltext0
+	.uleb128 0xf
+	.byte	0x77
+	.sleb128 24
+	.byte	0x6
+	.byte	0x23
+	.uleb128 0x880
+	.byte	0x94
+	.byte	0x4
+	.byte	0xc
+	.long	0xffffffff
+	.byte	0x1a
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL97-.Ltext0
+	.uleb128 .LVL97-.Ltext0
+	.uleb128 0x3
+	.byte	0x77
+	.sleb128 96
+	.byte	0x4
+	.uleb128 .LVL98-.Ltext0
+	.uleb128 .LVL99-.Ltext0
+	.uleb128 0xf
+	.byte	0x77
+	.sleb128 24
+	.byte	0x6
+	.byte	0x23
+	.uleb128 0x880
+	.byte	0x94
+	.byte	0x4
+	.byte	0xc
+	.long	0xffffffff
+	.byte	0x1a
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL99-.Ltext0
+	.uleb128 .LVL99-.Ltext0
+	.uleb128 0x9
+	.byte	0x77
+	.sleb128 96
+	.byte	0x6
+	.byte	0xa
+	.value	0x200
+	.byte	0x1c
+	.byte	0x9f
+	.byte	0
+.LVUS80:
+	.uleb128 .LVU718
+	.uleb128 .LVU724
+	.uleb128 .LVU724
+	.uleb128 .LVU766
+.LLST80:
+	.byte	0x4
+	.uleb128 .LVL102-.Ltext0
+	.uleb128 .LVL103-.Ltext0
+	.uleb128 0xf
+	.byte	0x7e
+	.sleb128 0
+	.byte	0xc
+	.long	0xffffffff
+	.byte	0x1a
+	.byte	0x38
+	.byte	0x24
+	.byte	0x77
+	.sleb128 24
+	.byte	0x6
+	.byte	0x22
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL103-.Ltext0
+	.uleb128 .LVL112-.Ltext0
+	.uleb128 0xf
+	.byte	0x73
+	.sleb128 0
+	.byte	0xc
+	.long	0xffffffff
+	.byte	0x1a
+	.byte	0x38
+	.byte	0x24
+	.byte	0x77
+	.sleb128 24
+	.byte	0x6
+	.byte	0x22
+	.byte	0x9f
+	.byte	0
+.LVUS81:
+	.uleb128 .LVU718
+	.uleb128 .LVU724
+	.uleb128 .LVU724
+	.uleb128 .LVU766
+.LLST81:
+	.byte	0x4
+	.uleb128 .LVL102-.Ltext0
+	.uleb128 .LVL103-.Ltext0
+	.uleb128 0x1
+	.byte	0x5e
+	.byte	0x4
+	.uleb128 .LVL103-.Ltext0
+	.uleb128 .LVL112-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0
+.LVUS82:
+	.uleb128 .LVU718
+	.uleb128 .LVU766
+.LLST82:
+	.byte	0x4
+	.uleb128 .LVL102-.Ltext0
+	.uleb128 .LVL112-.Ltext0
+	.uleb128 0x4
+	.byte	0x77
+	.sleb128 608
+	.byte	0x9f
+	.byte	0
+.LVUS84:
+	.uleb128 .LVU721
+	.uleb128 .LVU727
+	.uleb128 .LVU727
+	.uleb128 .LVU733
+	.uleb128 .LVU733
+	.uleb128 .LVU737
+	.uleb128 .LVU737
+	.uleb128 .LVU741
+	.uleb128 .LVU741
+	.uleb128 .LVU745
+	.uleb128 .LVU745
+	.uleb128 .LVU749
+	.uleb128 .LVU749
+	.uleb128 .LVU753
+	.uleb128 .LVU753
+	.uleb128 .LVU757
+	.uleb128 .LVU757
+	.uleb128 .LVU766
+.LLST84:
+	.byte	0x4
+	.uleb128 .LVL102-.Ltext0
+	.uleb128 .LVL104-.Ltext0
+	.uleb128 0x2
+	.byte	0x30
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL104-.Ltext0
+	.uleb128 .LVL105-.Ltext0
+	.uleb128 0x2
+	.byte	0x31
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL105-.Ltext0
+	.uleb128 .LVL106-.Ltext0
+	.uleb128 0x2
+	.byte	0x32
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL106-.Ltext0
+	.uleb128 .LVL107-.Ltext0
+	.uleb128 0x2
+	.byte	0x33
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL107-.Ltext0
+	.uleb128 .LVL108-.Ltext0
+	.uleb128 0x2
+	.byte	0x34
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL108-.Ltext0
+	.uleb128 .LVL109-.Ltext0
+	.uleb128 0x2
+	.byte	0x35
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL109-.Ltext0
+	.uleb128 .LVL110-.Ltext0
+	.uleb128 0x2
+	.byte	0x36
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL110-.Ltext0
+	.uleb128 .LVL111-.Ltext0
+	.uleb128 0x2
+	.byte	0x37
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL111-.Ltext0
+	.uleb128 .LVL112-.Ltext0
+	.uleb128 0x2
+	.byte	0x38
+	.byte	0x9f
+	.byte	0
+.LVUS86:
+	.uleb128 .LVU771
+	.uleb128 .LVU774
+	.uleb128 .LVU774
+	.uleb128 .LVU850
+	.uleb128 .LVU1159
+	.uleb128 0
+.LLST86:
+	.byte	0x4
+	.uleb128 .LVL114-.Ltext0
+	.uleb128 .LVL115-.Ltext0
+	.uleb128 0x2
+	.byte	0x30
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL115-.Ltext0
+	.uleb128 .LVL129-.Ltext0
+	.uleb128 0x1
+	.byte	0x5f
+	.byte	0x4
+	.uleb128 .LVL221-.Ltext0
+	.uleb128 .LFE32-.Ltext0
+	.uleb128 0x1
+	.byte	0x51
+	.byte	0
+.LVUS88:
+	.uleb128 .LVU774
+	.uleb128 .LVU791
+	.uleb128 .LVU791
+	.uleb128 .LVU797
+	.uleb128 .LVU808
+	.uleb128 .LVU851
+	.uleb128 .LVU851
+	.uleb128 .LVU852
+	.uleb128 .LVU1159
+	.uleb128 .LVU1161
+	.uleb128 .LVU1161
+	.uleb128 .LVU1163
+	.uleb128 .LVU1170
+	.uleb128 .LVU1177
+	.uleb128 .LVU1177
+	.uleb128 .LVU1184
+	.uleb128 .LVU1184
+	.uleb128 0
+.LLST88:
+	.byte	0x4
+	.uleb128 .LVL115-.Ltext0
+	.uleb128 .LVL118-.Ltext0
+	.uleb128 0x2
+	.byte	0x30
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL118-.Ltext0
+	.uleb128 .LVL119-.Ltext0
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x4
+	.uleb128 .LVL122-.Ltext0
+	.uleb128 .LVL130-.Ltext0
+	.uleb128 0x1
+	.byte	0x52
+	.byte	0x4
+	.uleb128 .LVL130-.Ltext0
+	.uleb128 .LVL131-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x51
+	.byte	0x4
+	.uleb128 .LVL221-.Ltext0
+	.uleb128 .LVL222-.Ltext0
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x4
+	.uleb128 .LVL222-.Ltext0
+	.uleb128 .LVL223-.Ltext0
+	.uleb128 0x2
+	.byte	0x30
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL224-.Ltext0
+	.uleb128 .LVL225-.Ltext0
+	.uleb128 0x1
+	.byte	0x52
+	.byte	0x4
+	.uleb128 .LVL225-.Ltext0
+	.uleb128 .LVL226-.Ltext0
+	.uleb128 0x2
+	.byte	0x30
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL226-.Ltext0
+	.uleb128 .LFE32-.Ltext0
+	.uleb128 0x1
+	.byte	0x52
+	.byte	0
+.LVUS90:
+	.uleb128 .LVU774
+	.uleb128 .LVU792
+	.uleb128 .LVU792
+	.uleb128 .LVU809
+	.uleb128 .LVU809
+	.uleb128 .LVU827
+	.uleb128 .LVU827
+	.uleb128 .LVU845
+	.uleb128 .LVU845
+	.uleb128 .LVU1155
+	.uleb128 .LVU1159
+	.uleb128 .LVU1161
+	.uleb128 .LVU1161
+	.uleb128 .LVU1163
+	.uleb128 .LVU1163
+	.uleb128 .LVU1170
+	.uleb128 .LVU1170
+	.uleb128 .LVU1177
+	.uleb128 .LVU1177
+	.uleb128 .LVU1184
+	.uleb128 .LVU1184
+	.uleb128 0
+.LLST90:
+	.byte	0x4
+	.uleb128 .LVL115-.Ltext0
+	.uleb128 .LVL118-.Ltext0
+	.uleb128 0x2
+	.byte	0x30
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL118-.Ltext0
+	.uleb128 .LVL122-.Ltext0
+	.uleb128 0x2
+	.byte	0x31
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL122-.Ltext0
+	.uleb128 .LVL125-.Ltext0
+	.uleb128 0x2
+	.byte	0x32
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL125-.Ltext0
+	.uleb128 .LVL128-.Ltext0
+	.uleb128 0x2
+	.byte	0x33
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL128-.Ltext0
+	.uleb128 .LVL219-.Ltext0
+	.uleb128 0x2
+	.byte	0x34
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL221-.Ltext0
+	.uleb128 .LVL222-.Ltext0
+	.uleb128 0x2
+	.byte	0x31
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL222-.Ltext0
+	.uleb128 .LVL223-.Ltext0
+	.uleb128 0x2
+	.byte	0x30
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL223-.Ltext0
+	.uleb128 .LVL224-.Ltext0
+	.uleb128 0x2
+	.byte	0x31
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL224-.Ltext0
+	.uleb128 .LVL225-.Ltext0
+	.uleb128 0x2
+	.byte	0x33
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL225-.Ltext0
+	.uleb128 .LVL226-.Ltext0
+	.uleb128 0x2
+	.byte	0x30
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL226-.Ltext0
+	.uleb128 .LFE32-.Ltext0
+	.uleb128 0x2
+	.byte	0x32
+	.byte	0x9f
+	.byte	0
+.LVUS92:
+	.uleb128 .LVU780
+	.uleb128 .LVU785
+	.uleb128 .LVU799
+	.uleb128 .LVU804
+	.uleb128 .LVU815
+	.uleb128 .LVU820
+	.uleb128 .LVU833
+	.uleb128 .LVU838
+.LLST92:
+	.byte	0x4
+	.uleb128 .LVL116-.Ltext0
+	.uleb128 .LVL117-.Ltext0
+	.uleb128 0xa
+	.byte	0x7f
+	.sleb128 0
+	.byte	0x33
+	.byte	0x24
+	.byte	0x77
+	.sleb128 0
+	.byte	0x22
+	.byte	0x23
+	.uleb128 0x100
+	.byte	0x4
+	.uleb128 .LVL120-.Ltext0
+	.uleb128 .LVL121-.Ltext0
+	.uleb128 0xa
+	.byte	0x7f
+	.sleb128 3
+	.byte	0x33
+	.byte	0x24
+	.byte	0x77
+	.sleb128 0
+	.byte	0x22
+	.byte	0x23
+	.uleb128 0x100
+	.byte	0x4
+	.uleb128 .LVL123-.Ltext0
+	.uleb128 .LVL124-.Ltext0
+	.uleb128 0xa
+	.byte	0x7f
+	.sleb128 6
+	.byte	0x33
+	.byte	0x24
+	.byte	0x77
+	.sleb128 0
+	.byte	0x22
+	.byte	0x23
+	.uleb128 0x100
+	.byte	0x4
+	.uleb128 .LVL126-.Ltext0
+	.uleb128 .LVL127-.Ltext0
+	.uleb128 0xa
+	.byte	0x7f
+	.sleb128 9
+	.byte	0x33
+	.byte	0x24
+	.byte	0x77
+	.sleb128 0
+	.byte	0x22
+	.byte	0x23
+	.uleb128 0x100
+	.byte	0
+.LVUS93:
+	.uleb128 .LVU780
+	.uleb128 .LVU785
+	.uleb128 .LVU799
+	.uleb128 .LVU804
+	.uleb128 .LVU815
+	.uleb128 .LVU820
+	.uleb128 .LVU833
+	.uleb128 .LVU838
+.LLST93:
+	.byte	0x4
+	.uleb128 .LVL116-.Ltext0
+	.uleb128 .LVL117-.Ltext0
+	.uleb128 0x2
+	.byte	0x30
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL120-.Ltext0
+	.uleb128 .LVL121-.Ltext0
+	.uleb128 0x2
+	.byte	0x31
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL123-.Ltext0
+	.uleb128 .LVL124-.Ltext0
+	.uleb128 0x2
+	.byte	0x32
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL126-.Ltext0
+	.uleb128 .LVL127-.Ltext0
+	.uleb128 0x2
+	.byte	0x33
+	.byte	0x9f
+	.byte	0
+.LVUS94:
+	.uleb128 .LVU780
+	.uleb128 .LVU785
+	.uleb128 .LVU799
+	.uleb128 .LVU804
+	.uleb128 .LVU815
+	.uleb128 .LVU820
+	.uleb128 .LVU833
+	.uleb128 .LVU838
+.LLST94:
+	.byte	0x4
+	.uleb128 .LVL116-.Ltext0
+	.uleb128 .LVL117-.Ltext0
+	.uleb128 0x4
+	.byte	0x77
+	.sleb128 608
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL120-.Ltext0
+	.uleb128 .LVL121-.Ltext0
+	.uleb128 0x4
+	.byte	0x77
+	.sleb128 608
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL123-.Ltext0
+	.uleb128 .LVL124-.Ltext0
+	.uleb128 0x4
+	.byte	0x77
+	.sleb128 608
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL126-.Ltext0
+	.uleb128 .LVL127-.Ltext0
+	.uleb128 0x4
+	.byte	0x77
+	.sleb128 608
+	.byte	0x9f
+	.byte	0
+.LVUS96:
+	.uleb128 .LVU847
+	.uleb128 .LVU851
+	.uleb128 .LVU851
+	.uleb128 .LVU852
+.LLST96:
+	.byte	0x4
+	.uleb128 .LVL128-.Ltext0
+	.uleb128 .LVL130-.Ltext0
+	.uleb128 0x1
+	.byte	0x52
+	.byte	0x4
+	.uleb128 .LVL130-.Ltext0
+	.uleb128 .LVL131-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x51
+	.byte	0
+.LVUS97:
+	.uleb128 .LVU847
+	.uleb128 .LVU852
+.LLST97:
+	.byte	0x4
+	.uleb128 .LVL128-.Ltext0
+	.uleb128 .LVL131-.Ltext0
+	.uleb128 0x4
+	.byte	0x77
+	.sleb128 128
+	.byte	0x9f
+	.byte	0
+.LVUS98:
+	.uleb128 .LVU847
+	.uleb128 .LVU852
+.LLST98:
+	.byte	0x4
+	.uleb128 .LVL128-.Ltext0
+	.uleb128 .LVL131-.Ltext0
+	.uleb128 0x4
+	.byte	0x77
+	.sleb128 608
+	.byte	0x9f
+	.byte	0
+.LVUS99:
+	.uleb128 .LVU855
+	.uleb128 .LVU857
+	.uleb128 .LVU857
+	.uleb128 .LVU1091
+	.uleb128 .LVU1091
+	.uleb128 .LVU1146
+.LLST99:
+	.byte	0x4
+	.uleb128 .LVL132-.Ltext0
+	.uleb128 .LVL133-.Ltext0
+	.uleb128 0x2
+	.byte	0x30
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL133-.Ltext0
+	.uleb128 .LVL200-.Ltext0
+	.uleb128 0xc
+	.byte	0x71
+	.sleb128 0
+	.byte	0x77
+	.sleb128 0
+	.byte	0x1c
+	.byte	0xa
+	.value	0x260
+	.byte	0x1c
+	.byte	0x33
+	.byte	0x25
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL200-.Ltext0
+	.uleb128 .LVL215-.Ltext0
+	.uleb128 0xc
+	.byte	0x71
+	.sleb128 0
+	.byte	0x77
+	.sleb128 0
+	.byte	0x1c
+	.byte	0xa
+	.value	0x268
+	.byte	0x1c
+	.byte	0x33
+	.byte	0x25
+	.byte	0x9f
+	.byte	0
+.LVUS101:
+	.uleb128 .LVU857
+	.uleb128 .LVU893
+	.uleb128 .LVU893
+	.uleb128 .LVU929
+	.uleb128 .LVU929
+	.uleb128 .LVU965
+	.uleb128 .LVU965
+	.uleb128 .LVU1000
+	.uleb128 .LVU1000
+	.uleb128 .LVU1036
+	.uleb128 .LVU1036
+	.uleb128 .LVU1072
+	.uleb128 .LVU1072
+	.uleb128 .LVU1109
+	.uleb128 .LVU1109
+	.uleb128 .LVU1144
+	.uleb128 .LVU1144
+	.uleb128 .LVU1155
+.LLST101:
+	.byte	0x4
+	.uleb128 .LVL133-.Ltext0
+	.uleb128 .LVL144-.Ltext0
+	.uleb128 0x2
+	.byte	0x30
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL144-.Ltext0
+	.uleb128 .LVL154-.Ltext0
+	.uleb128 0x2
+	.byte	0x31
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL154-.Ltext0
+	.uleb128 .LVL164-.Ltext0
+	.uleb128 0x2
+	.byte	0x32
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL164-.Ltext0
+	.uleb128 .LVL174-.Ltext0
+	.uleb128 0x2
+	.byte	0x33
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL174-.Ltext0
+	.uleb128 .LVL184-.Ltext0
+	.uleb128 0x2
+	.byte	0x34
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL184-.Ltext0
+	.uleb128 .LVL194-.Ltext0
+	.uleb128 0x2
+	.byte	0x35
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL194-.Ltext0
+	.uleb128 .LVL205-.Ltext0
+	.uleb128 0x2
+	.byte	0x36
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL205-.Ltext0
+	.uleb128 .LVL215-.Ltext0
+	.uleb128 0x2
+	.byte	0x37
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL215-.Ltext0
+	.uleb128 .LVL219-.Ltext0
+	.uleb128 0x2
+	.byte	0x38
+	.byte	0x9f
+	.byte	0
+.LVUS103:
+	.uleb128 .LVU859
+	.uleb128 .LVU873
+	.uleb128 .LVU873
+	.uleb128 .LVU891
+	.uleb128 .LVU895
+	.uleb128 .LVU909
+	.uleb128 .LVU909
+	.uleb128 .LVU927
+	.uleb128 .LVU931
+	.uleb128 .LVU945
+	.uleb128 .LVU945
+	.uleb128 .LVU963
+	.uleb128 .LVU967
+	.uleb128 .LVU981
+	.uleb128 .LVU981
+	.uleb128 .LVU998
+	.uleb128 .LVU1002
+	.uleb128 .LVU1016
+	.uleb128 .LVU1016
+	.uleb128 .LVU1034
+	.uleb128 .LVU1038
+	.uleb128 .LVU1052
+	.uleb128 .LVU1052
+	.uleb128 .LVU1070
+	.uleb128 .LVU1074
+	.uleb128 .LVU1088
+	.uleb128 .LVU1088
+	.uleb128 .LVU1091
+	.uleb128 .LVU1091
+	.uleb128 .LVU1107
+	.uleb128 .LVU1111
+	.uleb128 .LVU1125
+	.uleb128 .LVU1125
+	.uleb128 .LVU1142
+.LLST103:
+	.byte	0x4
+	.uleb128 .LVL134-.Ltext0
+	.uleb128 .LVL138-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0x4
+	.uleb128 .LVL138-.Ltext0
+	.uleb128 .LVL144-.Ltext0
+	.uleb128 0x2
+	.byte	0x71
+	.sleb128 0
+	.byte	0x4
+	.uleb128 .LVL144-.Ltext0
+	.uleb128 .LVL148-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0x4
+	.uleb128 .LVL148-.Ltext0
+	.uleb128 .LVL154-.Ltext0
+	.uleb128 0x2
+	.byte	0x71
+	.sleb128 32
+	.byte	0x4
+	.uleb128 .LVL154-.Ltext0
+	.uleb128 .LVL158-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0x4
+	.uleb128 .LVL158-.Ltext0
+	.uleb128 .LVL164-.Ltext0
+	.uleb128 0x3
+	.byte	0x71
+	.sleb128 64
+	.byte	0x4
+	.uleb128 .LVL164-.Ltext0
+	.uleb128 .LVL168-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0x4
+	.uleb128 .LVL168-.Ltext0
+	.uleb128 .LVL174-.Ltext0
+	.uleb128 0x3
+	.byte	0x71
+	.sleb128 96
+	.byte	0x4
+	.uleb128 .LVL174-.Ltext0
+	.uleb128 .LVL178-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0x4
+	.uleb128 .LVL178-.Ltext0
+	.uleb128 .LVL184-.Ltext0
+	.uleb128 0x3
+	.byte	0x71
+	.sleb128 128
+	.byte	0x4
+	.uleb128 .LVL184-.Ltext0
+	.uleb128 .LVL188-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0x4
+	.uleb128 .LVL188-.Ltext0
+	.uleb128 .LVL194-.Ltext0
+	.uleb128 0x3
+	.byte	0x71
+	.sleb128 160
+	.byte	0x4
+	.uleb128 .LVL194-.Ltext0
+	.uleb128 .LVL198-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0x4
+	.uleb128 .LVL198-.Ltext0
+	.uleb128 .LVL200-.Ltext0
+	.uleb128 0x3
+	.byte	0x71
+	.sleb128 192
+	.byte	0x4
+	.uleb128 .LVL200-.Ltext0
+	.uleb128 .LVL205-.Ltext0
+	.uleb128 0x3
+	.byte	0x71
+	.sleb128 184
+	.byte	0x4
+	.uleb128 .LVL205-.Ltext0
+	.uleb128 .LVL209-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0x4
+	.uleb128 .LVL209-.Ltext0
+	.uleb128 .LVL215-.Ltext0
+	.uleb128 0x3
+	.byte	0x71
+	.sleb128 216
+	.byte	0
+.LVUS104:
+	.uleb128 .LVU859
+	.uleb128 .LVU891
+	.uleb128 .LVU895
+	.uleb128 .LVU927
+	.uleb128 .LVU931
+	.uleb128 .LVU963
+	.uleb128 .LVU967
+	.uleb128 .LVU998
+	.uleb128 .LVU1002
+	.uleb128 .LVU1034
+	.uleb128 .LVU1038
+	.uleb128 .LVU1070
+	.uleb128 .LVU1074
+	.uleb128 .LVU1090
+	.uleb128 .LVU1090
+	.uleb128 .LVU1107
+	.uleb128 .LVU1111
+	.uleb128 .LVU1142
+.LLST104:
+	.byte	0x4
+	.uleb128 .LVL134-.Ltext0
+	.uleb128 .LVL144-.Ltext0
+	.uleb128 0x1
+	.byte	0x52
+	.byte	0x4
+	.uleb128 .LVL144-.Ltext0
+	.uleb128 .LVL154-.Ltext0
+	.uleb128 0x3
+	.byte	0x72
+	.sleb128 8
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL154-.Ltext0
+	.uleb128 .LVL164-.Ltext0
+	.uleb128 0x3
+	.byte	0x72
+	.sleb128 16
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL164-.Ltext0
+	.uleb128 .LVL174-.Ltext0
+	.uleb128 0x3
+	.byte	0x72
+	.sleb128 24
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL174-.Ltext0
+	.uleb128 .LVL184-.Ltext0
+	.uleb128 0x3
+	.byte	0x72
+	.sleb128 32
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL184-.Ltext0
+	.uleb128 .LVL194-.Ltext0
+	.uleb128 0x3
+	.byte	0x72
+	.sleb128 40
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL194-.Ltext0
+	.uleb128 .LVL199-.Ltext0
+	.uleb128 0x3
+	.byte	0x72
+	.sleb128 48
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL199-.Ltext0
+	.uleb128 .LVL205-.Ltext0
+	.uleb128 0x3
+	.byte	0x72
+	.sleb128 -16
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL205-.Ltext0
+	.uleb128 .LVL215-.Ltext0
+	.uleb128 0x3
+	.byte	0x72
+	.sleb128 -8
+	.byte	0x9f
+	.byte	0
+.LVUS106:
+	.uleb128 .LVU861
+	.uleb128 .LVU873
+	.uleb128 .LVU873
+	.uleb128 .LVU874
+	.uleb128 .LVU874
+	.uleb128 .LVU877
+	.uleb128 .LVU897
+	.uleb128 .LVU909
+	.uleb128 .LVU909
+	.uleb128 .LVU910
+	.uleb128 .LVU910
+	.uleb128 .LVU913
+	.uleb128 .LVU933
+	.uleb128 .LVU945
+	.uleb128 .LVU945
+	.uleb128 .LVU946
+	.uleb128 .LVU946
+	.uleb128 .LVU949
+	.uleb128 .LVU969
+	.uleb128 .LVU981
+	.uleb128 .LVU981
+	.uleb128 .LVU982
+	.uleb128 .LVU982
+	.uleb128 .LVU983
+	.uleb128 .LVU1004
+	.uleb128 .LVU1016
+	.uleb128 .LVU1016
+	.uleb128 .LVU1017
+	.uleb128 .LVU1017
+	.uleb128 .LVU1020
+	.uleb128 .LVU1040
+	.uleb128 .LVU1052
+	.uleb128 .LVU1052
+	.uleb128 .LVU1053
+	.uleb128 .LVU1053
+	.uleb128 .LVU1056
+	.uleb128 .LVU1076
+	.uleb128 .LVU1088
+	.uleb128 .LVU1088
+	.uleb128 .LVU1091
+	.uleb128 .LVU1091
+	.uleb128 .LVU1092
+	.uleb128 .LVU1113
+	.uleb128 .LVU1125
+	.uleb128 .LVU1125
+	.uleb128 .LVU1126
+	.uleb128 .LVU1126
+	.uleb128 .LVU1129
+.LLST106:
+	.byte	0x4
+	.uleb128 .LVL134-.Ltext0
+	.uleb128 .LVL138-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0x4
+	.uleb128 .LVL138-.Ltext0
+	.uleb128 .LVL139-.Ltext0
+	.uleb128 0x1
+	.byte	0x58
+	.byte	0x4
+	.uleb128 .LVL139-.Ltext0
+	.uleb128 .LVL140-.Ltext0
+	.uleb128 0x2
+	.byte	0x71
+	.sleb128 0
+	.byte	0x4
+	.uleb128 .LVL144-.Ltext0
+	.uleb128 .LVL148-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0x4
+	.uleb128 .LVL148-.Ltext0
+	.uleb128 .LVL149-.Ltext0
+	.uleb128 0x1
+	.byte	0x58
+	.byte	0x4
+	.uleb128 .LVL149-.Ltext0
+	.uleb128 .LVL150-.Ltext0
+	.uleb128 0x2
+	.byte	0x71
+	.sleb128 32
+	.byte	0x4
+	.uleb128 .LVL154-.Ltext0
+	.uleb128 .LVL158-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0x4
+	.uleb128 .LVL158-.Ltext0
+	.uleb128 .LVL159-.Ltext0
+	.uleb128 0x1
+	.byte	0x58
+	.byte	0x4
+	.uleb128 .LVL159-.Ltext0
+	.uleb128 .LVL160-.Ltext0
+	.uleb128 0x3
+	.byte	0x71
+	.sleb128 64
+	.byte	0x4
+	.uleb128 .LVL164-.Ltext0
+	.uleb128 .LVL168-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0x4
+	.uleb128 .LVL168-.Ltext0
+	.uleb128 .LVL169-.Ltext0
+	.uleb128 0x1
+	.byte	0x58
+	.byte	0x4
+	.uleb128 .LVL169-.Ltext0
+	.uleb128 .LVL170-.Ltext0
+	.uleb128 0x3
+	.byte	0x71
+	.sleb128 96
+	.byte	0x4
+	.uleb128 .LVL174-.Ltext0
+	.uleb128 .LVL178-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0x4
+	.uleb128 .LVL178-.Ltext0
+	.uleb128 .LVL179-.Ltext0
+	.uleb128 0x1
+	.byte	0x58
+	.byte	0x4
+	.uleb128 .LVL179-.Ltext0
+	.uleb128 .LVL180-.Ltext0
+	.uleb128 0x3
+	.byte	0x71
+	.sleb128 128
+	.byte	0x4
+	.uleb128 .LVL184-.Ltext0
+	.uleb128 .LVL188-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0x4
+	.uleb128 .LVL188-.Ltext0
+	.uleb128 .LVL189-.Ltext0
+	.uleb128 0x1
+	.byte	0x58
+	.byte	0x4
+	.uleb128 .LVL189-.Ltext0
+	.uleb128 .LVL190-.Ltext0
+	.uleb128 0x3
+	.byte	0x71
+	.sleb128 160
+	.byte	0x4
+	.uleb128 .LVL194-.Ltext0
+	.uleb128 .LVL198-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0x4
+	.uleb128 .LVL198-.Ltext0
+	.uleb128 .LVL200-.Ltext0
+	.uleb128 0x3
+	.byte	0x71
+	.sleb128 192
+	.byte	0x4
+	.uleb128 .LVL200-.Ltext0
+	.uleb128 .LVL201-.Ltext0
+	.uleb128 0x3
+	.byte	0x71
+	.sleb128 184
+	.byte	0x4
+	.uleb128 .LVL205-.Ltext0
+	.uleb128 .LVL209-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0x4
+	.uleb128 .LVL209-.Ltext0
+	.uleb128 .LVL210-.Ltext0
+	.uleb128 0x1
+	.byte	0x58
+	.byte	0x4
+	.uleb128 .LVL210-.Ltext0
+	.uleb128 .LVL211-.Ltext0
+	.uleb128 0x3
+	.byte	0x71
+	.sleb128 216
+	.byte	0
+.LVUS107:
+	.uleb128 .LVU861
+	.uleb128 .LVU863
+	.uleb128 .LVU863
+	.uleb128 .LVU866
+	.uleb128 .LVU866
+	.uleb128 .LVU869
+	.uleb128 .LVU869
+	.uleb128 .LVU871
+	.uleb128 .LVU871
+	.uleb128 .LVU877
+	.uleb128 .LVU897
+	.uleb128 .LVU899
+	.uleb128 .LVU899
+	.uleb128 .LVU902
+	.uleb128 .LVU902
+	.uleb128 .LVU905
+	.uleb128 .LVU905
+	.uleb128 .LVU907
+	.uleb128 .LVU907
+	.uleb128 .LVU913
+	.uleb128 .LVU933
+	.uleb128 .LVU935
+	.uleb128 .LVU935
+	.uleb128 .LVU938
+	.uleb128 .LVU938
+	.uleb128 .LVU941
+	.uleb128 .LVU941
+	.uleb128 .LVU943
+	.uleb128 .LVU943
+	.uleb128 .LVU949
+	.uleb128 .LVU969
+	.uleb128 .LVU971
+	.uleb128 .LVU971
+	.uleb128 .LVU974
+	.uleb128 .LVU974
+	.uleb128 .LVU977
+	.uleb128 .LVU977
+	.uleb128 .LVU979
+	.uleb128 .LVU979
+	.uleb128 .LVU983
+	.uleb128 .LVU1004
+	.uleb128 .LVU1006
+	.uleb128 .LVU1006
+	.uleb128 .LVU1009
+	.uleb128 .LVU1009
+	.uleb128 .LVU1012
+	.uleb128 .LVU1012
+	.uleb128 .LVU1014
+	.uleb128 .LVU1014
+	.uleb128 .LVU1020
+	.uleb128 .LVU1040
+	.uleb128 .LVU1042
+	.uleb128 .LVU1042
+	.uleb128 .LVU1045
+	.uleb128 .LVU1045
+	.uleb128 .LVU1048
+	.uleb128 .LVU1048
+	.uleb128 .LVU1050
+	.uleb128 .LVU1050
+	.uleb128 .LVU1056
+	.uleb128 .LVU1076
+	.uleb128 .LVU1078
+	.uleb128 .LVU1078
+	.uleb128 .LVU1081
+	.uleb128 .LVU1081
+	.uleb128 .LVU1084
+	.uleb128 .LVU1084
+	.uleb128 .LVU1086
+	.uleb128 .LVU1086
+	.uleb128 .LVU1090
+	.uleb128 .LVU1090
+	.uleb128 .LVU1092
+	.uleb128 .LVU1113
+	.uleb128 .LVU1115
+	.uleb128 .LVU1115
+	.uleb128 .LVU1118
+	.uleb128 .LVU1118
+	.uleb128 .LVU1121
+	.uleb128 .LVU1121
+	.uleb128 .LVU1123
+	.uleb128 .LVU1123
+	.uleb128 .LVU1129
+.LLST107:
+	.byte	0x4
+	.uleb128 .LVL134-.Ltext0
+	.uleb128 .LVL134-.Ltext0
+	.uleb128 0x1
+	.byte	0x52
+	.byte	0x4
+	.uleb128 .LVL134-.Ltext0
+	.uleb128 .LVL135-.Ltext0
+	.uleb128 0x3
+	.byte	0x72
+	.sleb128 1
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL135-.Ltext0
+	.uleb128 .LVL136-.Ltext0
+	.uleb128 0x3
+	.byte	0x72
+	.sleb128 2
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL136-.Ltext0
+	.uleb128 .LVL137-.Ltext0
+	.uleb128 0x3
+	.byte	0x72
+	.sleb128 3
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL137-.Ltext0
+	.uleb128 .LVL140-.Ltext0
+	.uleb128 0x3
+	.byte	0x72
+	.sleb128 4
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL144-.Ltext0
+	.uleb128 .LVL144-.Ltext0
+	.uleb128 0x3
+	.byte	0x72
+	.sleb128 8
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL144-.Ltext0
+	.uleb128 .LVL145-.Ltext0
+	.uleb128 0x3
+	.byte	0x72
+	.sleb128 9
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL145-.Ltext0
+	.uleb128 .LVL146-.Ltext0
+	.uleb128 0x3
+	.byte	0x72
+	.sleb128 10
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL146-.Ltext0
+	.uleb128 .LVL147-.Ltext0
+	.uleb128 0x3
+	.byte	0x72
+	.sleb128 11
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL147-.Ltext0
+	.uleb128 .LVL150-.Ltext0
+	.uleb128 0x3
+	.byte	0x72
+	.sleb128 12
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL154-.Ltext0
+	.uleb128 .LVL154-.Ltext0
+	.uleb128 0x3
+	.byte	0x72
+	.sleb128 16
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL154-.Ltext0
+	.uleb128 .LVL155-.Ltext0
+	.uleb128 0x3
+	.byte	0x72
+	.sleb128 17
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL155-.Ltext0
+	.uleb128 .LVL156-.Ltext0
+	.uleb128 0x3
+	.byte	0x72
+	.sleb128 18
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL156-.Ltext0
+	.uleb128 .LVL157-.Ltext0
+	.uleb128 0x3
+	.byte	0x72
+	.sleb128 19
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL157-.Ltext0
+	.uleb128 .LVL160-.Ltext0
+	.uleb128 0x3
+	.byte	0x72
+	.sleb128 20
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL164-.Ltext0
+	.uleb128 .LVL164-.Ltext0
+	.uleb128 0x3
+	.byte	0x72
+	.sleb128 24
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL164-.Ltext0
+	.uleb128 .LVL165-.Ltext0
+	.uleb128 0x3
+	.byte	0x72
+	.sleb128 25
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL165-.Ltext0
+	.uleb128 .LVL166-.Ltext0
+	.uleb128 0x3
+	.byte	0x72
+	.sleb128 26
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL166-.Ltext0
+	.uleb128 .LVL167-.Ltext0
+	.uleb128 0x3
+	.byte	0x72
+	.sleb128 27
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL167-.Ltext0
+	.uleb128 .LVL170-.Ltext0
+	.uleb128 0x3
+	.byte	0x72
+	.sleb128 28
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL174-.Ltext0
+	.uleb128 .LVL174-.Ltext0
+	.uleb128 0x3
+	.byte	0x72
+	.sleb128 32
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL174-.Ltext0
+	.uleb128 .LVL175-.Ltext0
+	.uleb128 0x3
+	.byte	0x72
+	.sleb128 33
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL175-.Ltext0
+	.uleb128 .LVL176-.Ltext0
+	.uleb128 0x3
+	.byte	0x72
+	.sleb128 34
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL176-.Ltext0
+	.uleb128 .LVL177-.Ltext0
+	.uleb128 0x3
+	.byte	0x72
+	.sleb128 35
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL177-.Ltext0
+	.uleb128 .LVL180-.Ltext0
+	.uleb128 0x3
+	.byte	0x72
+	.sleb128 36
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL184-.Ltext0
+	.uleb128 .LVL184-.Ltext0
+	.uleb128 0x3
+	.byte	0x72
+	.sleb128 40
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL184-.Ltext0
+	.uleb128 .LVL185-.Ltext0
+	.uleb128 0x3
+	.byte	0x72
+	.sleb128 41
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL185-.Ltext0
+	.uleb128 .LVL186-.Ltext0
+	.uleb128 0x3
+	.byte	0x72
+	.sleb128 42
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL186-.Ltext0
+	.uleb128 .LVL187-.Ltext0
+	.uleb128 0x3
+	.byte	0x72
+	.sleb128 43
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL187-.Ltext0
+	.uleb128 .LVL190-.Ltext0
+	.uleb128 0x3
+	.byte	0x72
+	.sleb128 44
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL194-.Ltext0
+	.uleb128 .LVL194-.Ltext0
+	.uleb128 0x3
+	.byte	0x72
+	.sleb128 48
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL194-.Ltext0
+	.uleb128 .LVL195-.Ltext0
+	.uleb128 0x3
+	.byte	0x72
+	.sleb128 49
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL195-.Ltext0
+	.uleb128 .LVL196-.Ltext0
+	.uleb128 0x3
+	.byte	0x72
+	.sleb128 50
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL196-.Ltext0
+	.uleb128 .LVL197-.Ltext0
+	.uleb128 0x3
+	.byte	0x72
+	.sleb128 51
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL197-.Ltext0
+	.uleb128 .LVL199-.Ltext0
+	.uleb128 0x3
+	.byte	0x72
+	.sleb128 52
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL199-.Ltext0
+	.uleb128 .LVL201-.Ltext0
+	.uleb128 0x3
+	.byte	0x72
+	.sleb128 -12
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL205-.Ltext0
+	.uleb128 .LVL205-.Ltext0
+	.uleb128 0x3
+	.byte	0x72
+	.sleb128 -8
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL205-.Ltext0
+	.uleb128 .LVL206-.Ltext0
+	.uleb128 0x3
+	.byte	0x72
+	.sleb128 -7
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL206-.Ltext0
+	.uleb128 .LVL207-.Ltext0
+	.uleb128 0x3
+	.byte	0x72
+	.sleb128 -6
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL207-.Ltext0
+	.uleb128 .LVL208-.Ltext0
+	.uleb128 0x3
+	.byte	0x72
+	.sleb128 -5
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL208-.Ltext0
+	.uleb128 .LVL211-.Ltext0
+	.uleb128 0x3
+	.byte	0x72
+	.sleb128 -4
+	.byte	0x9f
+	.byte	0
+.LVUS109:
+	.uleb128 .LVU879
+	.uleb128 .LVU886
+	.uleb128 .LVU886
+	.uleb128 .LVU887
+	.uleb128 .LVU887
+	.uleb128 .LVU891
+	.uleb128 .LVU915
+	.uleb128 .LVU922
+	.uleb128 .LVU922
+	.uleb128 .LVU923
+	.uleb128 .LVU923
+	.uleb128 .LVU927
+	.uleb128 .LVU951
+	.uleb128 .LVU958
+	.uleb128 .LVU958
+	.uleb128 .LVU959
+	.uleb128 .LVU959
+	.uleb128 .LVU963
+	.uleb128 .LVU985
+	.uleb128 .LVU994
+	.uleb128 .LVU994
+	.uleb128 .LVU998
+	.uleb128 .LVU1022
+	.uleb128 .LVU1029
+	.uleb128 .LVU1029
+	.uleb128 .LVU1030
+	.uleb128 .LVU1030
+	.uleb128 .LVU1034
+	.uleb128 .LVU1058
+	.uleb128 .LVU1065
+	.uleb128 .LVU1065
+	.uleb128 .LVU1066
+	.uleb128 .LVU1066
+	.uleb128 .LVU1070
+	.uleb128 .LVU1094
+	.uleb128 .LVU1103
+	.uleb128 .LVU1103
+	.uleb128 .LVU1107
+	.uleb128 .LVU1131
+	.uleb128 .LVU1139
+	.uleb128 .LVU1139
+	.uleb128 .LVU1142
+.LLST109:
+	.byte	0x4
+	.uleb128 .LVL140-.Ltext0
+	.uleb128 .LVL142-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0x4
+	.uleb128 .LVL142-.Ltext0
+	.uleb128 .LVL143-.Ltext0
+	.uleb128 0x1
+	.byte	0x58
+	.byte	0x4
+	.uleb128 .LVL143-.Ltext0
+	.uleb128 .LVL144-.Ltext0
+	.uleb128 0x2
+	.byte	0x71
+	.sleb128 4
+	.byte	0x4
+	.uleb128 .LVL150-.Ltext0
+	.uleb128 .LVL152-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0x4
+	.uleb128 .LVL152-.Ltext0
+	.uleb128 .LVL153-.Ltext0
+	.uleb128 0x1
+	.byte	0x58
+	.byte	0x4
+	.uleb128 .LVL153-.Ltext0
+	.uleb128 .LVL154-.Ltext0
+	.uleb128 0x2
+	.byte	0x71
+	.sleb128 36
+	.byte	0x4
+	.uleb128 .LVL160-.Ltext0
+	.uleb128 .LVL162-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0x4
+	.uleb128 .LVL162-.Ltext0
+	.uleb128 .LVL163-.Ltext0
+	.uleb128 0x1
+	.byte	0x58
+	.byte	0x4
+	.uleb128 .LVL163-.Ltext0
+	.uleb128 .LVL164-.Ltext0
+	.uleb128 0x3
+	.byte	0x71
+	.sleb128 68
+	.byte	0x4
+	.uleb128 .LVL170-.Ltext0
+	.uleb128 .LVL173-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0x4
+	.uleb128 .LVL173-.Ltext0
+	.uleb128 .LVL174-.Ltext0
+	.uleb128 0x3
+	.byte	0x71
+	.sleb128 100
+	.byte	0x4
+	.uleb128 .LVL180-.Ltext0
+	.uleb128 .LVL182-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0x4
+	.uleb128 .LVL182-.Ltext0
+	.uleb128 .LVL183-.Ltext0
+	.uleb128 0x1
+	.byte	0x58
+	.byte	0x4
+	.uleb128 .LVL183-.Ltext0
+	.uleb128 .LVL184-.Ltext0
+	.uleb128 0x3
+	.byte	0x71
+	.sleb128 132
+	.byte	0x4
+	.uleb128 .LVL190-.Ltext0
+	.uleb128 .LVL192-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0x4
+	.uleb128 .LVL192-.Ltext0
+	.uleb128 .LVL193-.Ltext0
+	.uleb128 0x1
+	.byte	0x58
+	.byte	0x4
+	.uleb128 .LVL193-.Ltext0
+	.uleb128 .LVL194-.Ltext0
+	.uleb128 0x3
+	.byte	0x71
+	.sleb128 164
+	.byte	0x4
+	.uleb128 .LVL201-.Ltext0
+	.uleb128 .LVL204-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0x4
+	.uleb128 .LVL204-.Ltext0
+	.uleb128 .LVL205-.Ltext0
+	.uleb128 0x3
+	.byte	0x71
+	.sleb128 188
+	.byte	0x4
+	.uleb128 .LVL211-.Ltext0
+	.uleb128 .LVL213-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0x4
+	.uleb128 .LVL213-.Ltext0
+	.uleb128 .LVL215-.Ltext0
+	.uleb128 0x3
+	.byte	0x71
+	.sleb128 220
+	.byte	0
+.LVUS110:
+	.uleb128 .LVU879
+	.uleb128 .LVU881
+	.uleb128 .LVU881
+	.uleb128 .LVU882
+	.uleb128 .LVU882
+	.uleb128 .LVU885
+	.uleb128 .LVU885
+	.uleb128 .LVU891
+	.uleb128 .LVU915
+	.uleb128 .LVU917
+	.uleb128 .LVU917
+	.uleb128 .LVU918
+	.uleb128 .LVU918
+	.uleb128 .LVU921
+	.uleb128 .LVU921
+	.uleb128 .LVU927
+	.uleb128 .LVU951
+	.uleb128 .LVU953
+	.uleb128 .LVU953
+	.uleb128 .LVU954
+	.uleb128 .LVU954
+	.uleb128 .LVU957
+	.uleb128 .LVU957
+	.uleb128 .LVU963
+	.uleb128 .LVU985
+	.uleb128 .LVU987
+	.uleb128 .LVU987
+	.uleb128 .LVU990
+	.uleb128 .LVU990
+	.uleb128 .LVU993
+	.uleb128 .LVU993
+	.uleb128 .LVU998
+	.uleb128 .LVU1022
+	.uleb128 .LVU1024
+	.uleb128 .LVU1024
+	.uleb128 .LVU1025
+	.uleb128 .LVU1025
+	.uleb128 .LVU1028
+	.uleb128 .LVU1028
+	.uleb128 .LVU1034
+	.uleb128 .LVU1058
+	.uleb128 .LVU1060
+	.uleb128 .LVU1060
+	.uleb128 .LVU1061
+	.uleb128 .LVU1061
+	.uleb128 .LVU1064
+	.uleb128 .LVU1064
+	.uleb128 .LVU1070
+	.uleb128 .LVU1094
+	.uleb128 .LVU1096
+	.uleb128 .LVU1096
+	.uleb128 .LVU1099
+	.uleb128 .LVU1099
+	.uleb128 .LVU1102
+	.uleb128 .LVU1102
+	.uleb128 .LVU1107
+	.uleb128 .LVU1131
+	.uleb128 .LVU1133
+	.uleb128 .LVU1133
+	.uleb128 .LVU1134
+	.uleb128 .LVU1134
+	.uleb128 .LVU1137
+	.uleb128 .LVU1137
+	.uleb128 .LVU1141
+	.uleb128 .LVU1141
+	.uleb128 .LVU1142
+.LLST110:
+	.byte	0x4
+	.uleb128 .LVL140-.Ltext0
+	.uleb128 .LVL140-.Ltext0
+	.uleb128 0x3
+	.byte	0x72
+	.sleb128 4
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL140-.Ltext0
+	.uleb128 .LVL140-.Ltext0
+	.uleb128 0x3
+	.byte	0x72
+	.sleb128 5
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL140-.Ltext0
+	.uleb128 .LVL141-.Ltext0
+	.uleb128 0x3
+	.byte	0x72
+	.sleb128 6
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL141-.Ltext0
+	.uleb128 .LVL144-.Ltext0
+	.uleb128 0x3
+	.byte	0x72
+	.sleb128 7
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL150-.Ltext0
+	.uleb128 .LVL150-.Ltext0
+	.uleb128 0x3
+	.byte	0x72
+	.sleb128 12
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL150-.Ltext0
+	.uleb128 .LVL150-.Ltext0
+	.uleb128 0x3
+	.byte	0x72
+	.sleb128 13
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL150-.Ltext0
+	.uleb128 .LVL151-.Ltext0
+	.uleb128 0x3
+	.byte	0x72
+	.sleb128 14
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL151-.Ltext0
+	.uleb128 .LVL154-.Ltext0
+	.uleb128 0x3
+	.byte	0x72
+	.sleb128 15
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL160-.Ltext0
+	.uleb128 .LVL160-.Ltext0
+	.uleb128 0x3
+	.byte	0x72
+	.sleb128 20
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL160-.Ltext0
+	.uleb128 .LVL160-.Ltext0
+	.uleb128 0x3
+	.byte	0x72
+	.sleb128 21
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL160-.Ltext0
+	.uleb128 .LVL161-.Ltext0
+	.uleb128 0x3
+	.byte	0x72
+	.sleb128 22
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL161-.Ltext0
+	.uleb128 .LVL164-.Ltext0
+	.uleb128 0x3
+	.byte	0x72
+	.sleb128 23
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL170-.Ltext0
+	.uleb128 .LVL170-.Ltext0
+	.uleb128 0x3
+	.byte	0x72
+	.sleb128 28
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL170-.Ltext0
+	.uleb128 .LVL171-.Ltext0
+	.uleb128 0x3
+	.byte	0x72
+	.sleb128 29
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL171-.Ltext0
+	.uleb128 .LVL172-.Ltext0
+	.uleb128 0x3
+	.byte	0x72
+	.sleb128 30
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL172-.Ltext0
+	.uleb128 .LVL174-.Ltext0
+	.uleb128 0x3
+	.byte	0x72
+	.sleb128 31
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL180-.Ltext0
+	.uleb128 .LVL180-.Ltext0
+	.uleb128 0x3
+	.byte	0x72
+	.sleb128 36
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL180-.Ltext0
+	.uleb128 .LVL180-.Ltext0
+	.uleb128 0x3
+	.byte	0x72
+	.sleb128 37
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL180-.Ltext0
+	.uleb128 .LVL181-.Ltext0
+	.uleb128 0x3
+	.byte	0x72
+	.sleb128 38
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL181-.Ltext0
+	.uleb128 .LVL184-.Ltext0
+	.uleb128 0x3
+	.byte	0x72
+	.sleb128 39
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL190-.Ltext0
+	.uleb128 .LVL190-.Ltext0
+	.uleb128 0x3
+	.byte	0x72
+	.sleb128 44
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL190-.Ltext0
+	.uleb128 .LVL190-.Ltext0
+	.uleb128 0x3
+	.byte	0x72
+	.sleb128 45
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL190-.Ltext0
+	.uleb128 .LVL191-.Ltext0
+	.uleb128 0x3
+	.byte	0x72
+	.sleb128 46
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL191-.Ltext0
+	.uleb128 .LVL194-.Ltext0
+	.uleb128 0x3
+	.byte	0x72
+	.sleb128 47
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL201-.Ltext0
+	.uleb128 .LVL201-.Ltext0
+	.uleb128 0x3
+	.byte	0x72
+	.sleb128 -12
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL201-.Ltext0
+	.uleb128 .LVL202-.Ltext0
+	.uleb128 0x3
+	.byte	0x72
+	.sleb128 -11
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL202-.Ltext0
+	.uleb128 .LVL203-.Ltext0
+	.uleb128 0x3
+	.byte	0x72
+	.sleb128 -10
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL203-.Ltext0
+	.uleb128 .LVL205-.Ltext0
+	.uleb128 0x3
+	.byte	0x72
+	.sleb128 -9
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL211-.Ltext0
+	.uleb128 .LVL211-.Ltext0
+	.uleb128 0x3
+	.byte	0x72
+	.sleb128 -4
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL211-.Ltext0
+	.uleb128 .LVL211-.Ltext0
+	.uleb128 0x3
+	.byte	0x72
+	.sleb128 -3
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL211-.Ltext0
+	.uleb128 .LVL212-.Ltext0
+	.uleb128 0x3
+	.byte	0x72
+	.sleb128 -2
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL212-.Ltext0
+	.uleb128 .LVL214-.Ltext0
+	.uleb128 0x3
+	.byte	0x72
+	.sleb128 -1
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL214-.Ltext0
+	.uleb128 .LVL215-.Ltext0
+	.uleb128 0x1
+	.byte	0x52
+	.byte	0
+.LVUS60:
+	.uleb128 0
+	.uleb128 .LVU556
+	.uleb128 .LVU556
+	.uleb128 .LVU597
+	.uleb128 .LVU597
+	.uleb128 .LVU598
+	.uleb128 .LVU598
+	.uleb128 0
+.LLST60:
+	.byte	0x4
+	.uleb128 .LVL70-.Ltext0
+	.uleb128 .LVL73-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL73-.Ltext0
+	.uleb128 .LVL83-.Ltext0
+	.uleb128 0x1
+	.byte	0x5f
+	.byte	0x4
+	.uleb128 .LVL83-.Ltext0
+	.uleb128 .LVL84-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL84-.Ltext0
+	.uleb128 .LFE30-.Ltext0
+	.uleb128 0x1
+	.byte	0x5f
+	.byte	0
+.LVUS61:
+	.uleb128 0
+	.uleb128 .LVU556
+	.uleb128 .LVU556
+	.uleb128 0
+.LLST61:
+	.byte	0x4
+	.uleb128 .LVL70-.Ltext0
+	.uleb128 .LVL73-.Ltext0
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x4
+	.uleb128 .LVL73-.Ltext0
+	.uleb128 .LFE30-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x9f
+	.byte	0
+.LVUS62:
+	.uleb128 0
+	.uleb128 .LVU552
+	.uleb128 .LVU552
+	.uleb128 .LVU595
+	.uleb128 .LVU598
+	.uleb128 0
+.LLST62:
+	.byte	0x4
+	.uleb128 .LVL70-.Ltext0
+	.uleb128 .LVL72-.Ltext0
+	.uleb128 0x1
+	.byte	0x51
+	.byte	0x4
+	.uleb128 .LVL72-.Ltext0
+	.uleb128 .LVL81-.Ltext0
+	.uleb128 0x1
+	.byte	0x56
+	.byte	0x4
+	.uleb128 .LVL84-.Ltext0
+	.uleb128 .LFE30-.Ltext0
+	.uleb128 0x1
+	.byte	0x56
+	.byte	0
+.LVUS63:
+	.uleb128 .LVU543
+	.uleb128 .LVU556
+	.uleb128 .LVU556
+	.uleb128 .LVU596
+	.uleb128 .LVU598
+	.uleb128 0
+.LLST63:
+	.byte	0x4
+	.uleb128 .LVL71-.Ltext0
+	.uleb128 .LVL73-.Ltext0
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x4
+	.uleb128 .LVL73-.Ltext0
+	.uleb128 .LVL82-.Ltext0
+	.uleb128 0x1
+	.byte	0x5c
+	.byte	0x4
+	.uleb128 .LVL84-.Ltext0
+	.uleb128 .LFE30-.Ltext0
+	.uleb128 0x1
+	.byte	0x5c
+	.byte	0
+.LVUS65:
+	.uleb128 .LVU577
+	.uleb128 .LVU586
+	.uleb128 .LVU612
+	.uleb128 0
+.LLST65:
+	.byte	0x4
+	.uleb128 .LVL76-.Ltext0
+	.uleb128 .LVL79-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL90-.Ltext0
+	.uleb128 .LFE30-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0
+.LVUS66:
+	.uleb128 .LVU603
+	.uleb128 .LVU605
+	.uleb128 .LVU605
+	.uleb128 .LVU606
+	.uleb128 .LVU606
+	.uleb128 .LVU610
+.LLST66:
+	.byte	0x4
+	.uleb128 .LVL85-.Ltext0
+	.uleb128 .LVL86-.Ltext0
+	.uleb128 0x1
+	.byte	0x5d
+	.byte	0x4
+	.uleb128 .LVL86-.Ltext0
+	.uleb128 .LVL87-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x51
+	.byte	0x4
+	.uleb128 .LVL87-1-.Ltext0
+	.uleb128 .LVL89-.Ltext0
+	.uleb128 0x8
+	.byte	0x76
+	.sleb128 -897
+	.byte	0x39
+	.byte	0x25
+	.byte	0x23
+	.uleb128 0x1
+	.byte	0x9f
+	.byte	0
+.LVUS0:
+	.uleb128 0
+	.uleb128 .LVU165
+	.uleb128 .LVU165
+	.uleb128 .LVU309
+	.uleb128 .LVU309
+	.uleb128 .LVU311
+	.uleb128 .LVU311
+	.uleb128 0
+.LLST0:
+	.byte	0x4
+	.uleb128 .LVL0-.Ltext0
+	.uleb128 .LVL4-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL4-.Ltext0
+	.uleb128 .LVL23-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0x4
+	.uleb128 .LVL23-.Ltext0
+	.uleb128 .LVL25-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL25-.Ltext0
+	.uleb128 .LFE29-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0
+.LVUS1:
+	.uleb128 0
+	.uleb128 .LVU13
+	.uleb128 .LVU13
+	.uleb128 .LVU228
+	.uleb128 .LVU228
+	.uleb128 .LVU236
+	.uleb128 .LVU236
+	.uleb128 .LVU238
+	.uleb128 .LVU238
+	.uleb128 .LVU310
+	.uleb128 .LVU311
+	.uleb128 0
+.LLST1:
+	.byte	0x4
+	.uleb128 .LVL0-.Ltext0
+	.uleb128 .LVL1-.Ltext0
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x4
+	.uleb128 .LVL1-.Ltext0
+	.uleb128 .LVL15-.Ltext0
+	.uleb128 0x1
+	.byte	0x5c
+	.byte	0x4
+	.uleb128 .LVL15-.Ltext0
+	.uleb128 .LVL17-1-.Ltext0
+	.uleb128 0x2
+	.byte	0x77
+	.sleb128 0
+	.byte	0x4
+	.uleb128 .LVL17-1-.Ltext0
+	.uleb128 .LVL17-.Ltext0
+	.uleb128 0x4
+	.byte	0x7c
+	.sleb128 -512
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL17-.Ltext0
+	.uleb128 .LVL24-.Ltext0
+	.uleb128 0x1
+	.byte	0x5c
+	.byte	0x4
+	.uleb128 .LVL25-.Ltext0
+	.uleb128 .LFE29-.Ltext0
+	.uleb128 0x1
+	.byte	0x5c
+	.byte	0
+.LVUS2:
+	.uleb128 0
+	.uleb128 .LVU18
+	.uleb128 .LVU18
+	.uleb128 .LVU172
+	.uleb128 .LVU172
+	.uleb128 .LVU173
+	.uleb128 .LVU311
+	.uleb128 0
+.LLST2:
+	.byte	0x4
+	.uleb128 .LVL0-.Ltext0
+	.uleb128 .LVL2-.Ltext0
+	.uleb128 0x1
+	.byte	0x51
+	.byte	0x4
+	.uleb128 .LVL2-.Ltext0
+	.uleb128 .LVL6-.Ltext0
+	.uleb128 0x1
+	.byte	0x5d
+	.byte	0x4
+	.uleb128 .LVL6-.Ltext0
+	.uleb128 .LVL7-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x51
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL25-.Ltext0
+	.uleb128 .LFE29-.Ltext0
+	.uleb128 0x1
+	.byte	0x5d
+	.byte	0
+.LVUS4:
+	.uleb128 .LVU5
+	.uleb128 .LVU50
+	.uleb128 .LVU50
+	.uleb128 .LVU82
+	.uleb128 .LVU82
+	.uleb128 .LVU114
+	.uleb128 .LVU114
+	.uleb128 .LVU168
+	.uleb128 .LVU168
+	.uleb128 0
+.LLST4:
+	.byte	0x4
+	.uleb128 .LVL0-.Ltext0
+	.uleb128 .LVL3-.Ltext0
+	.uleb128 0x2
+	.byte	0x30
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL3-.Ltext0
+	.uleb128 .LVL3-.Ltext0
+	.uleb128 0x2
+	.byte	0x31
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL3-.Ltext0
+	.uleb128 .LVL3-.Ltext0
+	.uleb128 0x2
+	.byte	0x32
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL3-.Ltext0
+	.uleb128 .LVL5-.Ltext0
+	.uleb128 0x2
+	.byte	0x33
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL5-.Ltext0
+	.uleb128 .LFE29-.Ltext0
+	.uleb128 0x2
+	.byte	0x34
+	.byte	0x9f
+	.byte	0
+.LVUS7:
+	.uleb128 .LVU6
+	.uleb128 .LVU22
+	.uleb128 .LVU22
+	.uleb128 .LVU25
+	.uleb128 .LVU25
+	.uleb128 .LVU28
+	.uleb128 .LVU28
+	.uleb128 .LVU31
+	.uleb128 .LVU31
+	.uleb128 .LVU34
+	.uleb128 .LVU34
+	.uleb128 .LVU37
+	.uleb128 .LVU37
+	.uleb128 .LVU40
+	.uleb128 .LVU40
+	.uleb128 .LVU43
+	.uleb128 .LVU43
+	.uleb128 .LVU48
+	.uleb128 .LVU51
+	.uleb128 .LVU54
+	.uleb128 .LVU54
+	.uleb128 .LVU57
+	.uleb128 .LVU57
+	.uleb128 .LVU60
+	.uleb128 .LVU60
+	.uleb128 .LVU63
+	.uleb128 .LVU63
+	.uleb128 .LVU66
+	.uleb128 .LVU66
+	.uleb128 .LVU69
+	.uleb128 .LVU69
+	.uleb128 .LVU72
+	.uleb128 .LVU72
+	.uleb128 .LVU75
+	.uleb128 .LVU75
+	.uleb128 .LVU80
+	.uleb128 .LVU83
+	.uleb128 .LVU86
+	.uleb128 .LVU86
+	.uleb128 .LVU89
+	.uleb128 .LVU89
+	.uleb128 .LVU92
+	.uleb128 .LVU92
+	.uleb128 .LVU95
+	.uleb128 .LVU95
+	.uleb128 .LVU98
+	.uleb128 .LVU98
+	.uleb128 .LVU101
+	.uleb128 .LVU101
+	.uleb128 .LVU104
+	.uleb128 .LVU104
+	.uleb128 .LVU107
+	.uleb128 .LVU107
+	.uleb128 .LVU112
+	.uleb128 .LVU115
+	.uleb128 .LVU118
+	.uleb128 .LVU118
+	.uleb128 .LVU121
+	.uleb128 .LVU121
+	.uleb128 .LVU124
+	.uleb128 .LVU124
+	.uleb128 .LVU127
+	.uleb128 .LVU127
+	.uleb128 .LVU130
+	.uleb128 .LVU130
+	.uleb128 .LVU133
+	.uleb128 .LVU133
+	.uleb128 .LVU136
+	.uleb128 .LVU136
+	.uleb128 .LVU139
+	.uleb128 .LVU139
+	.uleb128 .LVU166
+.LLST7:
+	.byte	0x4
+	.uleb128 .LVL0-.Ltext0
+	.uleb128 .LVL3-.Ltext0
+	.uleb128 0x2
+	.byte	0x30
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL3-.Ltext0
+	.uleb128 .LVL3-.Ltext0
+	.uleb128 0x2
+	.byte	0x31
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL3-.Ltext0
+	.uleb128 .LVL3-.Ltext0
+	.uleb128 0x2
+	.byte	0x32
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL3-.Ltext0
+	.uleb128 .LVL3-.Ltext0
+	.uleb128 0x2
+	.byte	0x33
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL3-.Ltext0
+	.uleb128 .LVL3-.Ltext0
+	.uleb128 0x2
+	.byte	0x34
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL3-.Ltext0
+	.uleb128 .LVL3-.Ltext0
+	.uleb128 0x2
+	.byte	0x35
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL3-.Ltext0
+	.uleb128 .LVL3-.Ltext0
+	.uleb128 0x2
+	.byte	0x36
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL3-.Ltext0
+	.uleb128 .LVL3-.Ltext0
+	.uleb128 0x2
+	.byte	0x37
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL3-.Ltext0
+	.uleb128 .LVL3-.Ltext0
+	.uleb128 0x2
+	.byte	0x38
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL3-.Ltext0
+	.uleb128 .LVL3-.Ltext0
+	.uleb128 0x2
+	.byte	0x30
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL3-.Ltext0
+	.uleb128 .LVL3-.Ltext0
+	.uleb128 0x2
+	.byte	0x31
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL3-.Ltext0
+	.uleb128 .LVL3-.Ltext0
+	.uleb128 0x2
+	.byte	0x32
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL3-.Ltext0
+	.uleb128 .LVL3-.Ltext0
+	.uleb128 0x2
+	.byte	0x33
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL3-.Ltext0
+	.uleb128 .LVL3-.Ltext0
+	.uleb128 0x2
+	.byte	0x34
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL3-.Ltext0
+	.uleb128 .LVL3-.Ltext0
+	.uleb128 0x2
+	.byte	0x35
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL3-.Ltext0
+	.uleb128 .LVL3-.Ltext0
+	.uleb128 0x2
+	.byte	0x36
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL3-.Ltext0
+	.uleb128 .LVL3-.Ltext0
+	.uleb128 0x2
+	.byte	0x37
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL3-.Ltext0
+	.uleb128 .LVL3-.Ltext0
+	.uleb128 0x2
+	.byte	0x38
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL3-.Ltext0
+	.uleb128 .LVL3-.Ltext0
+	.uleb128 0x2
+	.byte	0x30
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL3-.Ltext0
+	.uleb128 .LVL3-.Ltext0
+	.uleb128 0x2
+	.byte	0x31
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL3-.Ltext0
+	.uleb128 .LVL3-.Ltext0
+	.uleb128 0x2
+	.byte	0x32
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL3-.Ltext0
+	.uleb128 .LVL3-.Ltext0
+	.uleb128 0x2
+	.byte	0x33
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL3-.Ltext0
+	.uleb128 .LVL3-.Ltext0
+	.uleb128 0x2
+	.byte	0x34
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL3-.Ltext0
+	.uleb128 .LVL3-.Ltext0
+	.uleb128 0x2
+	.byte	0x35
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL3-.Ltext0
+	.uleb128 .LVL3-.Ltext0
+	.uleb128 0x2
+	.byte	0x36
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL3-.Ltext0
+	.uleb128 .LVL3-.Ltext0
+	.uleb128 0x2
+	.byte	0x37
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL3-.Ltext0
+	.uleb128 .LVL3-.Ltext0
+	.uleb128 0x2
+	.byte	0x38
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL3-.Ltext0
+	.uleb128 .LVL3-.Ltext0
+	.uleb128 0x2
+	.byte	0x30
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL3-.Ltext0
+	.uleb128 .LVL3-.Ltext0
+	.uleb128 0x2
+	.byte	0x31
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL3-.Ltext0
+	.uleb128 .LVL3-.Ltext0
+	.uleb128 0x2
+	.byte	0x32
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL3-.Ltext0
+	.uleb128 .LVL3-.Ltext0
+	.uleb128 0x2
+	.byte	0x33
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL3-.Ltext0
+	.uleb128 .LVL3-.Ltext0
+	.uleb128 0x2
+	.byte	0x34
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL3-.Ltext0
+	.uleb128 .LVL3-.Ltext0
+	.uleb128 0x2
+	.byte	0x35
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL3-.Ltext0
+	.uleb128 .LVL3-.Ltext0
+	.uleb128 0x2
+	.byte	0x36
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL3-.Ltext0
+	.uleb128 .LVL3-.Ltext0
+	.uleb128 0x2
+	.byte	0x37
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL3-.Ltext0
+	.uleb128 .LVL5-.Ltext0
+	.uleb128 0x2
+	.byte	0x38
+	.byte	0x9f
+	.byte	0
+.LVUS22:
+	.uleb128 .LVU311
+	.uleb128 .LVU330
+	.uleb128 .LVU330
+	.uleb128 .LVU342
+	.uleb128 .LVU342
+	.uleb128 .LVU358
+	.uleb128 .LVU358
+	.uleb128 .LVU384
+	.uleb128 .LVU384
+	.uleb128 0
+.LLST22:
+	.byte	0x4
+	.uleb128 .LVL25-.Ltext0
+	.uleb128 .LVL26-.Ltext0
+	.uleb128 0x2
+	.byte	0x30
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL26-.Ltext0
+	.uleb128 .LVL27-.Ltext0
+	.uleb128 0x2
+	.byte	0x31
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL27-.Ltext0
+	.uleb128 .LVL28-.Ltext0
+	.uleb128 0x2
+	.byte	0x32
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL28-.Ltext0
+	.uleb128 .LVL30-.Ltext0
+	.uleb128 0x2
+	.byte	0x33
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL30-.Ltext0
+	.uleb128 .LFE29-.Ltext0
+	.uleb128 0x2
+	.byte	0x34
+	.byte	0x9f
+	.byte	0
+.LVUS24:
+	.uleb128 .LVU325
+	.uleb128 .LVU328
+	.uleb128 .LVU337
+	.uleb128 .LVU340
+	.uleb128 .LVU353
+	.uleb128 .LVU356
+	.uleb128 .LVU366
+	.uleb128 .LVU382
+.LLST24:
+	.byte	0x4
+	.uleb128 .LVL26-.Ltext0
+	.uleb128 .LVL26-.Ltext0
+	.uleb128 0x3
+	.byte	0x8
+	.byte	0x80
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL27-.Ltext0
+	.uleb128 .LVL27-.Ltext0
+	.uleb128 0x3
+	.byte	0x8
+	.byte	0x80
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL28-.Ltext0
+	.uleb128 .LVL28-.Ltext0
+	.uleb128 0x3
+	.byte	0x8
+	.byte	0x80
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL29-.Ltext0
+	.uleb128 .LVL30-.Ltext0
+	.uleb128 0x3
+	.byte	0x8
+	.byte	0x80
+	.byte	0x9f
+	.byte	0
+.LVUS25:
+	.uleb128 .LVU325
+	.uleb128 .LVU328
+	.uleb128 .LVU337
+	.uleb128 .LVU340
+	.uleb128 .LVU353
+	.uleb128 .LVU356
+	.uleb128 .LVU366
+	.uleb128 .LVU382
+.LLST25:
+	.byte	0x4
+	.uleb128 .LVL26-.Ltext0
+	.uleb128 .LVL26-.Ltext0
+	.uleb128 0x2
+	.byte	0x30
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL27-.Ltext0
+	.uleb128 .LVL27-.Ltext0
+	.uleb128 0x2
+	.byte	0x31
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL28-.Ltext0
+	.uleb128 .LVL28-.Ltext0
+	.uleb128 0x2
+	.byte	0x32
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL29-.Ltext0
+	.uleb128 .LVL30-.Ltext0
+	.uleb128 0x2
+	.byte	0x33
+	.byte	0x9f
+	.byte	0
+.LVUS26:
+	.uleb128 .LVU325
+	.uleb128 .LVU328
+	.uleb128 .LVU337
+	.uleb128 .LVU340
+	.uleb128 .LVU353
+	.uleb128 .LVU356
+	.uleb128 .LVU366
+	.uleb128 .LVU382
+.LLST26:
+	.byte	0x4
+	.uleb128 .LVL26-.Ltext0
+	.uleb128 .LVL26-.Ltext0
+	.uleb128 0x1
+	.byte	0x5f
+	.byte	0x4
+	.uleb128 .LVL27-.Ltext0
+	.uleb128 .LVL27-.Ltext0
+	.uleb128 0x1
+	.byte	0x5f
+	.byte	0x4
+	.uleb128 .LVL28-.Ltext0
+	.uleb128 .LVL28-.Ltext0
+	.uleb128 0x1
+	.byte	0x5f
+	.byte	0x4
+	.uleb128 .LVL29-.Ltext0
+	.uleb128 .LVL30-.Ltext0
+	.uleb128 0x1
+	.byte	0x5f
+	.byte	0
+.LVUS9:
+	.uleb128 .LVU173
+	.uleb128 .LVU188
+	.uleb128 .LVU188
+	.uleb128 .LVU202
+	.uleb128 .LVU202
+	.uleb128 .LVU216
+	.uleb128 .LVU216
+	.uleb128 .LVU232
+	.uleb128 .LVU232
+	.uleb128 .LVU311
+.LLST9:
+	.byte	0x4
+	.uleb128 .LVL7-.Ltext0
+	.uleb128 .LVL9-.Ltext0
+	.uleb128 0x2
+	.byte	0x30
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL9-.Ltext0
+	.uleb128 .LVL11-.Ltext0
+	.uleb128 0x2
+	.byte	0x31
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL11-.Ltext0
+	.uleb128 .LVL13-.Ltext0
+	.uleb128 0x2
+	.byte	0x32
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL13-.Ltext0
+	.uleb128 .LVL16-.Ltext0
+	.uleb128 0x2
+	.byte	0x33
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL16-.Ltext0
+	.uleb128 .LVL25-.Ltext0
+	.uleb128 0x2
+	.byte	0x34
+	.byte	0x9f
+	.byte	0
+.LVUS11:
+	.uleb128 .LVU177
+	.uleb128 .LVU186
+	.uleb128 .LVU192
+	.uleb128 .LVU200
+	.uleb128 .LVU206
+	.uleb128 .LVU214
+	.uleb128 .LVU220
+	.uleb128 .LVU230
+.LLST11:
+	.byte	0x4
+	.uleb128 .LVL8-.Ltext0
+	.uleb128 .LVL9-.Ltext0
+	.uleb128 0x3
+	.byte	0x8
+	.byte	0x80
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL10-.Ltext0
+	.uleb128 .LVL11-.Ltext0
+	.uleb128 0x3
+	.byte	0x8
+	.byte	0x80
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL12-.Ltext0
+	.uleb128 .LVL13-.Ltext0
+	.uleb128 0x3
+	.byte	0x8
+	.byte	0x80
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL14-.Ltext0
+	.uleb128 .LVL16-.Ltext0
+	.uleb128 0x3
+	.byte	0x8
+	.byte	0x80
+	.byte	0x9f
+	.byte	0
+.LVUS12:
+	.uleb128 .LVU177
+	.uleb128 .LVU186
+	.uleb128 .LVU192
+	.uleb128 .LVU200
+	.uleb128 .LVU206
+	.uleb128 .LVU214
+	.uleb128 .LVU220
+	.uleb128 .LVU230
+.LLST12:
+	.byte	0x4
+	.uleb128 .LVL8-.Ltext0
+	.uleb128 .LVL9-.Ltext0
+	.uleb128 0x2
+	.byte	0x30
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL10-.Ltext0
+	.uleb128 .LVL11-.Ltext0
+	.uleb128 0x2
+	.byte	0x31
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL12-.Ltext0
+	.uleb128 .LVL13-.Ltext0
+	.uleb128 0x2
+	.byte	0x32
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL14-.Ltext0
+	.uleb128 .LVL16-.Ltext0
+	.uleb128 0x2
+	.byte	0x33
+	.byte	0x9f
+	.byte	0
+.LVUS13:
+	.uleb128 .LVU177
+	.uleb128 .LVU186
+	.uleb128 .LVU192
+	.uleb128 .LVU200
+	.uleb128 .LVU206
+	.uleb128 .LVU214
+	.uleb128 .LVU220
+	.uleb128 .LVU230
+.LLST13:
+	.byte	0x4
+	.uleb128 .LVL8-.Ltext0
+	.uleb128 .LVL9-.Ltext0
+	.uleb128 0x3
+	.byte	0x77
+	.sleb128 32
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL10-.Ltext0
+	.uleb128 .LVL11-.Ltext0
+	.uleb128 0x3
+	.byte	0x77
+	.sleb128 32
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL12-.Ltext0
+	.uleb128 .LVL13-.Ltext0
+	.uleb128 0x3
+	.byte	0x77
+	.sleb128 32
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL14-.Ltext0
+	.uleb128 .LVL16-.Ltext0
+	.uleb128 0x3
+	.byte	0x77
+	.sleb128 32
+	.byte	0x9f
+	.byte	0
+.LVUS20:
+	.uleb128 .LVU239
+	.uleb128 .LVU242
+	.uleb128 .LVU242
+	.uleb128 .LVU245
+	.uleb128 .LVU245
+	.uleb128 .LVU248
+	.uleb128 .LVU248
+	.uleb128 .LVU251
+	.uleb128 .LVU251
+	.uleb128 .LVU254
+	.uleb128 .LVU254
+	.uleb128 .LVU257
+	.uleb128 .LVU257
+	.uleb128 .LVU260
+	.uleb128 .LVU260
+	.uleb128 .LVU264
+	.uleb128 .LVU264
+	.uleb128 .LVU270
+	.uleb128 .LVU273
+	.uleb128 .LVU276
+	.uleb128 .LVU276
+	.uleb128 .LVU279
+	.uleb128 .LVU279
+	.uleb128 .LVU282
+	.uleb128 .LVU282
+	.uleb128 .LVU285
+	.uleb128 .LVU285
+	.uleb128 .LVU288
+	.uleb128 .LVU288
+	.uleb128 .LVU291
+	.uleb128 .LVU291
+	.uleb128 .LVU294
+	.uleb128 .LVU294
+	.uleb128 .LVU298
+	.uleb128 .LVU298
+	.uleb128 .LVU304
+.LLST20:
+	.byte	0x4
+	.uleb128 .LVL18-.Ltext0
+	.uleb128 .LVL18-.Ltext0
+	.uleb128 0x2
+	.byte	0x30
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL18-.Ltext0
+	.uleb128 .LVL18-.Ltext0
+	.uleb128 0x2
+	.byte	0x31
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL18-.Ltext0
+	.uleb128 .LVL18-.Ltext0
+	.uleb128 0x2
+	.byte	0x32
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL18-.Ltext0
+	.uleb128 .LVL18-.Ltext0
+	.uleb128 0x2
+	.byte	0x33
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL18-.Ltext0
+	.uleb128 .LVL18-.Ltext0
+	.uleb128 0x2
+	.byte	0x34
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL18-.Ltext0
+	.uleb128 .LVL18-.Ltext0
+	.uleb128 0x2
+	.byte	0x35
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL18-.Ltext0
+	.uleb128 .LVL18-.Ltext0
+	.uleb128 0x2
+	.byte	0x36
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL18-.Ltext0
+	.uleb128 .LVL19-.Ltext0
+	.uleb128 0x2
+	.byte	0x37
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL19-.Ltext0
+	.uleb128 .LVL20-.Ltext0
+	.uleb128 0x2
+	.byte	0x38
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL20-.Ltext0
+	.uleb128 .LVL20-.Ltext0
+	.uleb128 0x2
+	.byte	0x30
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL20-.Ltext0
+	.uleb128 .LVL20-.Ltext0
+	.uleb128 0x2
+	.byte	0x31
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL20-.Ltext0
+	.uleb128 .LVL20-.Ltext0
+	.uleb128 0x2
+	.byte	0x32
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL20-.Ltext0
+	.uleb128 .LVL20-.Ltext0
+	.uleb128 0x2
+	.byte	0x33
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL20-.Ltext0
+	.uleb128 .LVL20-.Ltext0
+	.uleb128 0x2
+	.byte	0x34
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL20-.Ltext0
+	.uleb128 .LVL20-.Ltext0
+	.uleb128 0x2
+	.byte	0x35
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL20-.Ltext0
+	.uleb128 .LVL20-.Ltext0
+	.uleb128 0x2
+	.byte	0x36
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL20-.Ltext0
+	.uleb128 .LVL21-.Ltext0
+	.uleb128 0x2
+	.byte	0x37
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL21-.Ltext0
+	.uleb128 .LVL22-.Ltext0
+	.uleb128 0x2
+	.byte	0x38
+	.byte	0x9f
+	.byte	0
+.LVUS15:
+	.uleb128 .LVU234
+	.uleb128 .LVU236
+.LLST15:
+	.byte	0x4
+	.uleb128 .LVL16-.Ltext0
+	.uleb128 .LVL17-.Ltext0
+	.uleb128 0x2
+	.byte	0x3f
+	.byte	0x9f
+	.byte	0
+.LVUS16:
+	.uleb128 .LVU234
+	.uleb128 .LVU236
+.LLST16:
+	.byte	0x4
+	.uleb128 .LVL16-.Ltext0
+	.uleb128 .LVL17-.Ltext0
+	.uleb128 0x1
+	.byte	0x57
+	.byte	0
+.LVUS17:
+	.uleb128 .LVU234
+	.uleb128 .LVU236
+.LLST17:
+	.byte	0x4
+	.uleb128 .LVL16-.Ltext0
+	.uleb128 .LVL17-.Ltext0
+	.uleb128 0x3
+	.byte	0x77
+	.sleb128 32
+	.byte	0x9f
+	.byte	0
+.LVUS28:
+	.uleb128 .LVU386
+	.uleb128 .LVU388
+	.uleb128 .LVU388
+	.uleb128 0
+.LLST28:
+	.byte	0x4
+	.uleb128 .LVL30-.Ltext0
+	.uleb128 .LVL31-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x4
+	.uleb128 .LVL31-1-.Ltext0
+	.uleb128 .LFE29-.Ltext0
+	.uleb128 0x1
+	.byte	0x5e
+	.byte	0
+.LVUS29:
+	.uleb128 .LVU386
+	.uleb128 0
+.LLST29:
+	.byte	0x4
+	.uleb128 .LVL30-.Ltext0
+	.uleb128 .LFE29-.Ltext0
+	.uleb128 0x1
+	.byte	0x5f
+	.byte	0
+.LVUS42:
+	.uleb128 0
+	.uleb128 .LVU464
+	.uleb128 .LVU464
+	.uleb128 .LVU490
+	.uleb128 .LVU490
+	.uleb128 .LVU492
+	.uleb128 .LVU492
+	.uleb128 0
+.LLST42:
+	.byte	0x4
+	.uleb128 .LVL47-.Ltext0
+	.uleb128 .LVL51-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL51-.Ltext0
+	.uleb128 .LVL58-.Ltext0
+	.uleb128 0x1
+	.byte	0x5c
+	.byte	0x4
+	.uleb128 .LVL58-.Ltext0
+	.uleb128 .LVL59-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL59-.Ltext0
+	.uleb128 .LFE27-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0
+.LVUS43:
+	.uleb128 0
+	.uleb128 .LVU465
+	.uleb128 .LVU465
+	.uleb128 .LVU466
+	.uleb128 .LVU466
+	.uleb128 .LVU490
+	.uleb128 .LVU490
+	.uleb128 .LVU492
+	.uleb128 .LVU492
+	.uleb128 0
+.LLST43:
+	.byte	0x4
+	.uleb128 .LVL47-.Ltext0
+	.uleb128 .LVL52-.Ltext0
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x4
+	.uleb128 .LVL52-.Ltext0
+	.uleb128 .LVL53-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x51
+	.byte	0x4
+	.uleb128 .LVL53-1-.Ltext0
+	.uleb128 .LVL58-.Ltext0
+	.uleb128 0x1
+	.byte	0x5d
+	.byte	0x4
+	.uleb128 .LVL58-.Ltext0
+	.uleb128 .LVL59-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL59-.Ltext0
+	.uleb128 .LFE27-.Ltext0
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0
+.LVUS44:
+	.uleb128 0
+	.uleb128 .LVU451
+	.uleb128 .LVU451
+	.uleb128 .LVU454
+	.uleb128 .LVU454
+	.uleb128 .LVU462
+	.uleb128 .LVU462
+	.uleb128 0
+.LLST44:
+	.byte	0x4
+	.uleb128 .LVL47-.Ltext0
+	.uleb128 .LVL48-.Ltext0
+	.uleb128 0x1
+	.byte	0x51
+	.byte	0x4
+	.uleb128 .LVL48-.Ltext0
+	.uleb128 .LVL49-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL49-.Ltext0
+	.uleb128 .LVL50-.Ltext0
+	.uleb128 0x3
+	.byte	0x71
+	.sleb128 1
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL50-.Ltext0
+	.uleb128 .LFE27-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x51
+	.byte	0x9f
+	.byte	0
+.LVUS46:
+	.uleb128 .LVU446
+	.uleb128 .LVU451
+	.uleb128 .LVU451
+	.uleb128 .LVU454
+	.uleb128 .LVU454
+	.uleb128 .LVU462
+	.uleb128 .LVU462
+	.uleb128 .LVU490
+	.uleb128 .LVU492
+	.uleb128 .LVU493
+.LLST46:
+	.byte	0x4
+	.uleb128 .LVL47-.Ltext0
+	.uleb128 .LVL48-.Ltext0
+	.uleb128 0x1
+	.byte	0x51
+	.byte	0x4
+	.uleb128 .LVL48-.Ltext0
+	.uleb128 .LVL49-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL49-.Ltext0
+	.uleb128 .LVL50-.Ltext0
+	.uleb128 0x3
+	.byte	0x71
+	.sleb128 1
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL50-.Ltext0
+	.uleb128 .LVL58-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x51
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL59-.Ltext0
+	.uleb128 .LVL60-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x51
+	.byte	0x9f
+	.byte	0
+.LVUS47:
+	.uleb128 .LVU446
+	.uleb128 .LVU490
+	.uleb128 .LVU492
+	.uleb128 .LVU493
+.LLST47:
+	.byte	0x4
+	.uleb128 .LVL47-.Ltext0
+	.uleb128 .LVL58-.Ltext0
+	.uleb128 0x2
+	.byte	0x30
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL59-.Ltext0
+	.uleb128 .LVL60-.Ltext0
+	.uleb128 0x2
+	.byte	0x30
+	.byte	0x9f
+	.byte	0
+.LVUS49:
+	.uleb128 .LVU446
+	.uleb128 .LVU465
+	.uleb128 .LVU465
+	.uleb128 .LVU466
+	.uleb128 .LVU466
+	.uleb128 .LVU490
+	.uleb128 .LVU492
+	.uleb128 .LVU493
+.LLST49:
+	.byte	0x4
+	.uleb128 .LVL47-.Ltext0
+	.uleb128 .LVL52-.Ltext0
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x4
+	.uleb128 .LVL52-.Ltext0
+	.uleb128 .LVL53-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x51
+	.byte	0x4
+	.uleb128 .LVL53-1-.Ltext0
+	.uleb128 .LVL58-.Ltext0
+	.uleb128 0x1
+	.byte	0x5d
+	.byte	0x4
+	.uleb128 .LVL59-.Ltext0
+	.uleb128 .LVL60-.Ltext0
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0
+.LVUS50:
+	.uleb128 .LVU446
+	.uleb128 .LVU464
+	.uleb128 .LVU464
+	.uleb128 .LVU490
+	.uleb128 .LVU492
+	.uleb128 .LVU493
+.LLST50:
+	.byte	0x4
+	.uleb128 .LVL47-.Ltext0
+	.uleb128 .LVL51-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL51-.Ltext0
+	.uleb128 .LVL58-.Ltext0
+	.uleb128 0x1
+	.byte	0x5c
+	.byte	0x4
+	.uleb128 .LVL59-.Ltext0
+	.uleb128 .LVL60-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0
+.LVUS51:
+	.uleb128 .LVU473
+	.uleb128 .LVU474
+	.uleb128 .LVU474
+	.uleb128 .LVU478
+.LLST51:
+	.byte	0x4
+	.uleb128 .LVL54-.Ltext0
+	.uleb128 .LVL54-.Ltext0
+	.uleb128 0x2
+	.byte	0x30
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL54-.Ltext0
+	.uleb128 .LVL55-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0
+.LVUS30:
+	.uleb128 0
+	.uleb128 .LVU412
+	.uleb128 .LVU412
+	.uleb128 .LVU441
+	.uleb128 .LVU441
+	.uleb128 .LVU443
+	.uleb128 .LVU443
+	.uleb128 0
+.LLST30:
+	.byte	0x4
+	.uleb128 .LVL32-.Ltext0
+	.uleb128 .LVL36-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL36-.Ltext0
+	.uleb128 .LVL45-.Ltext0
+	.uleb128 0x1
+	.byte	0x5c
+	.byte	0x4
+	.uleb128 .LVL45-.Ltext0
+	.uleb128 .LVL46-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL46-.Ltext0
+	.uleb128 .LFE26-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0
+.LVUS31:
+	.uleb128 0
+	.uleb128 .LVU415
+	.uleb128 .LVU415
+	.uleb128 .LVU416
+	.uleb128 .LVU416
+	.uleb128 .LVU441
+	.uleb128 .LVU441
+	.uleb128 .LVU443
+	.uleb128 .LVU443
+	.uleb128 0
+.LLST31:
+	.byte	0x4
+	.uleb128 .LVL32-.Ltext0
+	.uleb128 .LVL39-.Ltext0
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x4
+	.uleb128 .LVL39-.Ltext0
+	.uleb128 .LVL40-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x51
+	.byte	0x4
+	.uleb128 .LVL40-1-.Ltext0
+	.uleb128 .LVL45-.Ltext0
+	.uleb128 0x1
+	.byte	0x5d
+	.byte	0x4
+	.uleb128 .LVL45-.Ltext0
+	.uleb128 .LVL46-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL46-.Ltext0
+	.uleb128 .LFE26-.Ltext0
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0
+.LVUS32:
+	.uleb128 0
+	.uleb128 .LVU410
+	.uleb128 .LVU410
+	.uleb128 .LVU443
+	.uleb128 .LVU443
+	.uleb128 0
+.LLST32:
+	.byte	0x4
+	.uleb128 .LVL32-.Ltext0
+	.uleb128 .LVL35-.Ltext0
+	.uleb128 0x1
+	.byte	0x51
+	.byte	0x4
+	.uleb128 .LVL35-.Ltext0
+	.uleb128 .LVL46-.Ltext0
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -104
+	.byte	0x4
+	.uleb128 .LVL46-.Ltext0
+	.uleb128 .LFE26-.Ltext0
+	.uleb128 0x1
+	.byte	0x51
+	.byte	0
+.LVUS33:
+	.uleb128 0
+	.uleb128 .LVU414
+	.uleb128 .LVU414
+	.uleb128 .LVU441
+	.uleb128 .LVU441
+	.uleb128 .LVU443
+	.uleb128 .LVU443
+	.uleb128 0
+.LLST33:
+	.byte	0x4
+	.uleb128 .LVL32-.Ltext0
+	.uleb128 .LVL38-.Ltext0
+	.uleb128 0x1
+	.byte	0x52
+	.byte	0x4
+	.uleb128 .LVL38-.Ltext0
+	.uleb128 .LVL45-.Ltext0
+	.uleb128 0x1
+	.byte	0x56
+	.byte	0x4
+	.uleb128 .LVL45-.Ltext0
+	.uleb128 .LVL46-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x52
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL46-.Ltext0
+	.uleb128 .LFE26-.Ltext0
+	.uleb128 0x1
+	.byte	0x52
+	.byte	0
+.LVUS34:
+	.uleb128 0
+	.uleb128 .LVU408
+	.uleb128 .LVU408
+	.uleb128 .LVU413
+	.uleb128 .LVU413
+	.uleb128 0
+.LLST34:
+	.byte	0x4
+	.uleb128 .LVL32-.Ltext0
+	.uleb128 .LVL34-.Ltext0
+	.uleb128 0x1
+	.byte	0x58
+	.byte	0x4
+	.uleb128 .LVL34-.Ltext0
+	.uleb128 .LVL37-.Ltext0
+	.uleb128 0x3
+	.byte	0x78
+	.sleb128 1
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL37-.Ltext0
+	.uleb128 .LFE26-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x58
+	.byte	0x9f
+	.byte	0
+.LVUS36:
+	.uleb128 .LVU397
+	.uleb128 .LVU408
+	.uleb128 .LVU408
+	.uleb128 .LVU413
+	.uleb128 .LVU413
+	.uleb128 .LVU441
+.LLST36:
+	.byte	0x4
+	.uleb128 .LVL33-.Ltext0
+	.uleb128 .LVL34-.Ltext0
+	.uleb128 0x1
+	.byte	0x58
+	.byte	0x4
+	.uleb128 .LVL34-.Ltext0
+	.uleb128 .LVL37-.Ltext0
+	.uleb128 0x3
+	.byte	0x78
+	.sleb128 1
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL37-.Ltext0
+	.uleb128 .LVL45-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x58
+	.byte	0x9f
+	.byte	0
+.LVUS37:
+	.uleb128 .LVU397
+	.uleb128 .LVU414
+	.uleb128 .LVU414
+	.uleb128 .LVU441
+.LLST37:
+	.byte	0x4
+	.uleb128 .LVL33-.Ltext0
+	.uleb128 .LVL38-.Ltext0
+	.uleb128 0x1
+	.byte	0x52
+	.byte	0x4
+	.uleb128 .LVL38-.Ltext0
+	.uleb128 .LVL45-.Ltext0
+	.uleb128 0x1
+	.byte	0x56
+	.byte	0
+.LVUS38:
+	.uleb128 .LVU397
+	.uleb128 .LVU410
+	.uleb128 .LVU410
+	.uleb128 .LVU441
+.LLST38:
+	.byte	0x4
+	.uleb128 .LVL33-.Ltext0
+	.uleb128 .LVL35-.Ltext0
+	.uleb128 0x1
+	.byte	0x51
+	.byte	0x4
+	.uleb128 .LVL35-.Ltext0
+	.uleb128 .LVL45-.Ltext0
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -104
+	.byte	0
+.LVUS39:
+	.uleb128 .LVU397
+	.uleb128 .LVU415
+	.uleb128 .LVU415
+	.uleb128 .LVU416
+	.uleb128 .LVU416
+	.uleb128 .LVU441
+.LLST39:
+	.byte	0x4
+	.uleb128 .LVL33-.Ltext0
+	.uleb128 .LVL39-.Ltext0
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x4
+	.uleb128 .LVL39-.Ltext0
+	.uleb128 .LVL40-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x51
+	.byte	0x4
+	.uleb128 .LVL40-1-.Ltext0
+	.uleb128 .LVL45-.Ltext0
+	.uleb128 0x1
+	.byte	0x5d
+	.byte	0
+.LVUS40:
+	.uleb128 .LVU397
+	.uleb128 .LVU412
+	.uleb128 .LVU412
+	.uleb128 .LVU441
+.LLST40:
+	.byte	0x4
+	.uleb128 .LVL33-.Ltext0
+	.uleb128 .LVL36-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL36-.Ltext0
+	.uleb128 .LVL45-.Ltext0
+	.uleb128 0x1
+	.byte	0x5c
+	.byte	0
+.LVUS41:
+	.uleb128 .LVU423
+	.uleb128 .LVU424
+	.uleb128 .LVU424
+	.uleb128 .LVU429
+.LLST41:
+	.byte	0x4
+	.uleb128 .LVL41-.Ltext0
+	.uleb128 .LVL41-.Ltext0
+	.uleb128 0x2
+	.byte	0x30
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL41-.Ltext0
+	.uleb128 .LVL42-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0
+.LVUS52:
+	.uleb128 0
+	.uleb128 .LVU503
+	.uleb128 .LVU503
+	.uleb128 .LVU539
+	.uleb128 .LVU539
+	.uleb128 0
+.LLST52:
+	.byte	0x4
+	.uleb128 .LVL61-.Ltext0
+	.uleb128 .LVL62-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL62-.Ltext0
+	.uleb128 .LVL69-.Ltext0
+	.uleb128 0x1
+	.byte	0x5c
+	.byte	0x4
+	.uleb128 .LVL69-.Ltext0
+	.uleb128 .LFE28-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x9f
+	.byte	0
+.LVUS54:
+	.uleb128 .LVU497
+	.uleb128 .LVU537
+.LLST54:
+	.byte	0x4
+	.uleb128 .LVL61-.Ltext0
+	.uleb128 .LVL68-.Ltext0
+	.uleb128 0x3
+	.byte	0x8
+	.byte	0x40
+	.byte	0x9f
+	.byte	0
+.LVUS55:
+	.uleb128 .LVU497
+	.uleb128 .LVU537
+.LLST55:
+	.byte	0x4
+	.uleb128 .LVL61-.Ltext0
+	.uleb128 .LVL68-.Ltext0
+	.uleb128 0x2
+	.byte	0x30
+	.byte	0x9f
+	.byte	0
+.LVUS58:
+	.uleb128 .LVU497
+	.uleb128 .LVU503
+	.uleb128 .LVU503
+	.uleb128 .LVU537
+.LLST58:
+	.byte	0x4
+	.uleb128 .LVL61-.Ltext0
+	.uleb128 .LVL62-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL62-.Ltext0
+	.uleb128 .LVL68-.Ltext0
+	.uleb128 0x1
+	.byte	0x5c
+	.byte	0
+.LVUS59:
+	.uleb128 .LVU521
+	.uleb128 .LVU522
+	.uleb128 .LVU522
+	.uleb128 .LVU526
+.LLST59:
+	.byte	0x4
+	.uleb128 .LVL64-.Ltext0
+	.uleb128 .LVL64-.Ltext0
+	.uleb128 0x2
+	.byte	0x30
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL64-.Ltext0
+	.uleb128 .LVL65-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0
+.Ldebug_loc3:
+	.section	.debug_aranges,"",@progbits
+	.long	0x2c
+	.value	0x2
+	.long	.Ldebug_info0
+	.byte	0x8
+	.byte	0
+	.value	0
+	.value	0
+	.quad	.Ltext0
+	.quad	.Letext0-.Ltext0
+	.quad	0
+	.quad	0
+	.section	.debug_rnglists,"",@progbits
+.Ldebug_ranges0:
+	.long	.Ldebug_ranges3-.Ldebug_ranges2
+.Ldebug_ranges2:
+	.value	0x5
+	.byte	0x8
+	.byte	0
+	.long	0
+.LLRL3:
+	.byte	0x4
+	.uleb128 .LBB49-.Ltext0
+	.uleb128 .LBE49-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB73-.Ltext0
+	.uleb128 .LBE73-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB74-.Ltext0
+	.uleb128 .LBE74-.Ltext0
+	.byte	0
+.LLRL5:
+	.byte	0x4
+	.uleb128 .LBB50-.Ltext0
+	.uleb128 .LBE50-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB68-.Ltext0
+	.uleb128 .LBE68-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB69-.Ltext0
+	.uleb128 .LBE69-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB70-.Ltext0
+	.uleb128 .LBE70-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB71-.Ltext0
+	.uleb128 .LBE71-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB72-.Ltext0
+	.uleb128 .LBE72-.Ltext0
+	.byte	0
+.LLRL6:
+	.byte	0x4
+	.uleb128 .LBB52-.Ltext0
+	.uleb128 .LBE52-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB53-.Ltext0
+	.uleb128 .LBE53-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB54-.Ltext0
+	.uleb128 .LBE54-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB55-.Ltext0
+	.uleb128 .LBE55-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB56-.Ltext0
+	.uleb128 .LBE56-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB57-.Ltext0
+	.uleb128 .LBE57-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB58-.Ltext0
+	.uleb128 .LBE58-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB59-.Ltext0
+	.uleb128 .LBE59-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB60-.Ltext0
+	.uleb128 .LBE60-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB61-.Ltext0
+	.uleb128 .LBE61-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB62-.Ltext0
+	.uleb128 .LBE62-.Ltext0
+	.byte	0
+.LLRL8:
+	.byte	0x4
+	.uleb128 .LBB75-.Ltext0
+	.uleb128 .LBE75-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB91-.Ltext0
+	.uleb128 .LBE91-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB92-.Ltext0
+	.uleb128 .LBE92-.Ltext0
+	.byte	0
+.LLRL10:
+	.byte	0x4
+	.uleb128 .LBB76-.Ltext0
+	.uleb128 .LBE76-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB83-.Ltext0
+	.uleb128 .LBE83-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB84-.Ltext0
+	.uleb128 .LBE84-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB85-.Ltext0
+	.uleb128 .LBE85-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB86-.Ltext0
+	.uleb128 .LBE86-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB87-.Ltext0
+	.uleb128 .LBE87-.Ltext0
+	.byte	0
+.LLRL14:
+	.byte	0x4
+	.uleb128 .LBB88-.Ltext0
+	.uleb128 .LBE88-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB93-.Ltext0
+	.uleb128 .LBE93-.Ltext0
+	.byte	0
+.LLRL18:
+	.byte	0x4
+	.uleb128 .LBB95-.Ltext0
+	.uleb128 .LBE95-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB100-.Ltext0
+	.uleb128 .LBE100-.Ltext0
+	.byte	0
+.LLRL19:
+	.byte	0x4
+	.uleb128 .LBB97-.Ltext0
+	.uleb128 .LBE97-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB98-.Ltext0
+	.uleb128 .LBE98-.Ltext0
+	.byte	0
+.LLRL21:
+	.byte	0x4
+	.uleb128 .LBB101-.Ltext0
+	.uleb128 .LBE101-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB137-.Ltext0
+	.uleb128 .LBE137-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB139-.Ltext0
+	.uleb128 .LBE139-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB141-.Ltext0
+	.uleb128 .LBE141-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB143-.Ltext0
+	.uleb128 .LBE143-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB145-.Ltext0
+	.uleb128 .LBE145-.Ltext0
+	.byte	0
+.LLRL23:
+	.byte	0x4
+	.uleb128 .LBB102-.Ltext0
+	.uleb128 .LBE102-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB117-.Ltext0
+	.uleb128 .LBE117-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB118-.Ltext0
+	.uleb128 .LBE118-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB119-.Ltext0
+	.uleb128 .LBE119-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB120-.Ltext0
+	.uleb128 .LBE120-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB121-.Ltext0
+	.uleb128 .LBE121-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB122-.Ltext0
+	.uleb128 .LBE122-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB123-.Ltext0
+	.uleb128 .LBE123-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB124-.Ltext0
+	.uleb128 .LBE124-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB125-.Ltext0
+	.uleb128 .LBE125-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB126-.Ltext0
+	.uleb128 .LBE126-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB127-.Ltext0
+	.uleb128 .LBE127-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB128-.Ltext0
+	.uleb128 .LBE128-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB129-.Ltext0
+	.uleb128 .LBE129-.Ltext0
+	.byte	0
+.LLRL27:
+	.byte	0x4
+	.uleb128 .LBB130-.Ltext0
+	.uleb128 .LBE130-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB138-.Ltext0
+	.uleb128 .LBE138-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB140-.Ltext0
+	.uleb128 .LBE140-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB142-.Ltext0
+	.uleb128 .LBE142-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB144-.Ltext0
+	.uleb128 .LBE144-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB146-.Ltext0
+	.uleb128 .LBE146-.Ltext0
+	.byte	0
+.LLRL35:
+	.byte	0x4
+	.uleb128 .LBB150-.Ltext0
+	.uleb128 .LBE150-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB154-.Ltext0
+	.uleb128 .LBE154-.Ltext0
+	.byte	0
+.LLRL45:
+	.byte	0x4
+	.uleb128 .LBB158-.Ltext0
+	.uleb128 .LBE158-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB165-.Ltext0
+	.uleb128 .LBE165-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB166-.Ltext0
+	.uleb128 .LBE166-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB167-.Ltext0
+	.uleb128 .LBE167-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB168-.Ltext0
+	.uleb128 .LBE168-.Ltext0
+	.byte	0
+.LLRL53:
+	.byte	0x4
+	.uleb128 .LBB172-.Ltext0
+	.uleb128 .LBE172-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB179-.Ltext0
+	.uleb128 .LBE179-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB180-.Ltext0
+	.uleb128 .LBE180-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB181-.Ltext0
+	.uleb128 .LBE181-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB182-.Ltext0
+	.uleb128 .LBE182-.Ltext0
+	.byte	0
+.LLRL64:
+	.byte	0x4
+	.uleb128 .LBB183-.Ltext0
+	.uleb128 .LBE183-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB184-.Ltext0
+	.uleb128 .LBE184-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB185-.Ltext0
+	.uleb128 .LBE185-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB187-.Ltext0
+	.uleb128 .LBE187-.Ltext0
+	.byte	0
+.LLRL70:
+	.byte	0x4
+	.uleb128 .LBB188-.Ltext0
+	.uleb128 .LBE188-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB228-.Ltext0
+	.uleb128 .LBE228-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB229-.Ltext0
+	.uleb128 .LBE229-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB230-.Ltext0
+	.uleb128 .LBE230-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB231-.Ltext0
+	.uleb128 .LBE231-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB232-.Ltext0
+	.uleb128 .LBE232-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB255-.Ltext0
+	.uleb128 .LBE255-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB378-.Ltext0
+	.uleb128 .LBE378-.Ltext0
+	.byte	0
+.LLRL72:
+	.byte	0x4
+	.uleb128 .LBB189-.Ltext0
+	.uleb128 .LBE189-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB212-.Ltext0
+	.uleb128 .LBE212-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB213-.Ltext0
+	.uleb128 .LBE213-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB214-.Ltext0
+	.uleb128 .LBE214-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB215-.Ltext0
+	.uleb128 .LBE215-.Ltext0
+	.byte	0
+.LLRL74:
+	.byte	0x4
+	.uleb128 .LBB190-.Ltext0
+	.uleb128 .LBE190-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB207-.Ltext0
+	.uleb128 .LBE207-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB208-.Ltext0
+	.uleb128 .LBE208-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB209-.Ltext0
+	.uleb128 .LBE209-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB210-.Ltext0
+	.uleb128 .LBE210-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB211-.Ltext0
+	.uleb128 .LBE211-.Ltext0
+	.byte	0
+.LLRL76:
+	.byte	0x4
+	.uleb128 .LBB191-.Ltext0
+	.uleb128 .LBE191-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB200-.Ltext0
+	.uleb128 .LBE200-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB201-.Ltext0
+	.uleb128 .LBE201-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB202-.Ltext0
+	.uleb128 .LBE202-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB203-.Ltext0
+	.uleb128 .LBE203-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB204-.Ltext0
+	.uleb128 .LBE204-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB205-.Ltext0
+	.uleb128 .LBE205-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB206-.Ltext0
+	.uleb128 .LBE206-.Ltext0
+	.byte	0
+.LLRL79:
+	.byte	0x4
+	.uleb128 .LBB216-.Ltext0
+	.uleb128 .LBE216-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB225-.Ltext0
+	.uleb128 .LBE225-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB226-.Ltext0
+	.uleb128 .LBE226-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB227-.Ltext0
+	.uleb128 .LBE227-.Ltext0
+	.byte	0
+.LLRL83:
+	.byte	0x4
+	.uleb128 .LBB218-.Ltext0
+	.uleb128 .LBE218-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB219-.Ltext0
+	.uleb128 .LBE219-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB220-.Ltext0
+	.uleb128 .LBE220-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB221-.Ltext0
+	.uleb128 .LBE221-.Ltext0
+	.byte	0
+.LLRL85:
+	.byte	0x4
+	.uleb128 .LBB233-.Ltext0
+	.uleb128 .LBE233-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB256-.Ltext0
+	.uleb128 .LBE256-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB379-.Ltext0
+	.uleb128 .LBE379-.Ltext0
+	.byte	0
+.LLRL87:
+	.byte	0x4
+	.uleb128 .LBB234-.Ltext0
+	.uleb128 .LBE234-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB252-.Ltext0
+	.uleb128 .LBE252-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB253-.Ltext0
+	.uleb128 .LBE253-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB254-.Ltext0
+	.uleb128 .LBE254-.Ltext0
+	.byte	0
+.LLRL89:
+	.byte	0x4
+	.uleb128 .LBB235-.Ltext0
+	.uleb128 .LBE235-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB244-.Ltext0
+	.uleb128 .LBE244-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB245-.Ltext0
+	.uleb128 .LBE245-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB250-.Ltext0
+	.uleb128 .LBE250-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB251-.Ltext0
+	.uleb128 .LBE251-.Ltext0
+	.byte	0
+.LLRL91:
+	.byte	0x4
+	.uleb128 .LBB236-.Ltext0
+	.uleb128 .LBE236-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB241-.Ltext0
+	.uleb128 .LBE241-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB242-.Ltext0
+	.uleb128 .LBE242-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB243-.Ltext0
+	.uleb128 .LBE243-.Ltext0
+	.byte	0
+.LLRL95:
+	.byte	0x4
+	.uleb128 .LBB246-.Ltext0
+	.uleb128 .LBE246-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB249-.Ltext0
+	.uleb128 .LBE249-.Ltext0
+	.byte	0
+.LLRL100:
+	.byte	0x4
+	.uleb128 .LBB258-.Ltext0
+	.uleb128 .LBE258-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB377-.Ltext0
+	.uleb128 .LBE377-.Ltext0
+	.byte	0
+.LLRL102:
+	.byte	0x4
+	.uleb128 .LBB259-.Ltext0
+	.uleb128 .LBE259-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB362-.Ltext0
+	.uleb128 .LBE362-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB363-.Ltext0
+	.uleb128 .LBE363-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB364-.Ltext0
+	.uleb128 .LBE364-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB365-.Ltext0
+	.uleb128 .LBE365-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB366-.Ltext0
+	.uleb128 .LBE366-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB367-.Ltext0
+	.uleb128 .LBE367-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB368-.Ltext0
+	.uleb128 .LBE368-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB369-.Ltext0
+	.uleb128 .LBE369-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB370-.Ltext0
+	.uleb128 .LBE370-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB371-.Ltext0
+	.uleb128 .LBE371-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB372-.Ltext0
+	.uleb128 .LBE372-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB373-.Ltext0
+	.uleb128 .LBE373-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB374-.Ltext0
+	.uleb128 .LBE374-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB375-.Ltext0
+	.uleb128 .LBE375-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB376-.Ltext0
+	.uleb128 .LBE376-.Ltext0
+	.byte	0
+.LLRL105:
+	.byte	0x4
+	.uleb128 .LBB261-.Ltext0
+	.uleb128 .LBE261-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB284-.Ltext0
+	.uleb128 .LBE284-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB307-.Ltext0
+	.uleb128 .LBE307-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB310-.Ltext0
+	.uleb128 .LBE310-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB311-.Ltext0
+	.uleb128 .LBE311-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB313-.Ltext0
+	.uleb128 .LBE313-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB316-.Ltext0
+	.uleb128 .LBE316-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB317-.Ltext0
+	.uleb128 .LBE317-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB319-.Ltext0
+	.uleb128 .LBE319-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB322-.Ltext0
+	.uleb128 .LBE322-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB323-.Ltext0
+	.uleb128 .LBE323-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB326-.Ltext0
+	.uleb128 .LBE326-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB327-.Ltext0
+	.uleb128 .LBE327-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB329-.Ltext0
+	.uleb128 .LBE329-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB332-.Ltext0
+	.uleb128 .LBE332-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB333-.Ltext0
+	.uleb128 .LBE333-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB335-.Ltext0
+	.uleb128 .LBE335-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB338-.Ltext0
+	.uleb128 .LBE338-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB339-.Ltext0
+	.uleb128 .LBE339-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB342-.Ltext0
+	.uleb128 .LBE342-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB343-.Ltext0
+	.uleb128 .LBE343-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB345-.Ltext0
+	.uleb128 .LBE345-.Ltext0
+	.byte	0
+.LLRL108:
+	.byte	0x4
+	.uleb128 .LBB285-.Ltext0
+	.uleb128 .LBE285-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB308-.Ltext0
+	.uleb128 .LBE308-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB309-.Ltext0
+	.uleb128 .LBE309-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB312-.Ltext0
+	.uleb128 .LBE312-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB314-.Ltext0
+	.uleb128 .LBE314-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB315-.Ltext0
+	.uleb128 .LBE315-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB318-.Ltext0
+	.uleb128 .LBE318-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB320-.Ltext0
+	.uleb128 .LBE320-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB321-.Ltext0
+	.uleb128 .LBE321-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB324-.Ltext0
+	.uleb128 .LBE324-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB325-.Ltext0
+	.uleb128 .LBE325-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB328-.Ltext0
+	.uleb128 .LBE328-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB330-.Ltext0
+	.uleb128 .LBE330-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB331-.Ltext0
+	.uleb128 .LBE331-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB334-.Ltext0
+	.uleb128 .LBE334-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB336-.Ltext0
+	.uleb128 .LBE336-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB337-.Ltext0
+	.uleb128 .LBE337-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB340-.Ltext0
+	.uleb128 .LBE340-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB341-.Ltext0
+	.uleb128 .LBE341-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB344-.Ltext0
+	.uleb128 .LBE344-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB346-.Ltext0
+	.uleb128 .LBE346-.Ltext0
+	.byte	0
+.LLRL114:
+	.byte	0x4
+	.uleb128 .LBB385-.Ltext0
+	.uleb128 .LBE385-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB401-.Ltext0
+	.uleb128 .LBE401-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB402-.Ltext0
+	.uleb128 .LBE402-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB403-.Ltext0
+	.uleb128 .LBE403-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB404-.Ltext0
+	.uleb128 .LBE404-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB405-.Ltext0
+	.uleb128 .LBE405-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB406-.Ltext0
+	.uleb128 .LBE406-.Ltext0
+	.byte	0
+.Ldebug_ranges3:
+	.section	.debug_line,"",@progbits
+.Ldebug_line0:
+	.section	.debug_str,"MS",@progbits,1
+.LASF39:
+	.string	"blake2b_init_words"
+.LASF50:
+	.string	"salt"
+.LASF8:
+	.string	"size_t"
+.LASF16:
+	.string	"uint64_t"
+.LASF9:
+	.string	"__uint8_t"
+.LASF34:
+	.string	"blake2b_final"
+.LASF41:
+	.string	"blake2bp_final"
+.LASF22:
+	.string	"long long unsigned int"
+.LASF25:
+	.string	"blake2s_sigma"
+.LASF51:
+	.string	"dig_len"
+.LASF23:
+	.string	"long long int"
+.LASF7:
+	.string	"signed char"
+.LASF17:
+	.string	"buf_len"
+.LASF52:
+	.string	"blake2bp_init_salted"
+.LASF3:
+	.string	"long int"
+.LASF30:
+	.string	"compress"
+.LASF38:
+	.string	"memcpy"
+.LASF27:
+	.string	"blake2b_lanes"
+.LASF45:
+	.string	"rounds"
+.LASF54:
+	.string	"key_len"
+.LASF11:
+	.string	"__uint32_t"
+.LASF32:
+	.string	"lanes"
+.LASF53:
+	.string	"blake2bp_init_keyed"
+.LASF64:
+	.string	"blake2b_kernel"
+.LASF6:
+	.string	"unsigned int"
+.LASF2:
+	.string	"long unsigned int"
+.LASF28:
+	.string	"name"
+.LASF57:
+	.string	"write_le64"
+.LASF5:
+	.string	"short unsigned int"
+.LASF43:
+	.string	"last"
+.LASF66:
+	.string	"__builtin_memcpy"
+.LASF49:
+	.string	"blake2bp_init"
+.LASF20:
+	.string	"blake2b_ctx"
+.LASF63:
+	.string	"GNU C99 12.2.0 -mtune=generic -march=x86-64 -g -O3 -std=c99 -fasynchronous-unwind-tables"
+.LASF31:
+	.string	"compress_blocks"
+.LASF35:
+	.string	"blake2b_update"
+.LASF56:
+	.string	"bbp_init"
+.LASF40:
+	.string	"blake2bp"
+.LASF55:
+	.string	"bbp_slice"
+.LASF21:
+	.string	"blake2bp_ctx"
+.LASF12:
+	.string	"__uint64_t"
+.LASF48:
+	.string	"fill"
+.LASF4:
+	.string	"unsigned char"
+.LASF10:
+	.string	"short int"
+.LASF47:
+	.string	"blake2bp_update"
+.LASF65:
+	.string	"bbp_strides"
+.LASF18:
+	.string	"digest_len"
+.LASF15:
+	.string	"uint32_t"
+.LASF60:
+	.string	"bblane_load"
+.LASF13:
+	.string	"char"
+.LASF44:
+	.string	"blake2b_kern"
+.LASF42:
+	.string	"hash"
+.LASF19:
+	.string	"last_node"
+.LASF29:
+	.string	"usable"
+.LASF33:
+	.string	"compress_lanes"
+.LASF36:
+	.string	"memset"
+.LASF46:
+	.string	"mask"
+.LASF37:
+	.string	"memmove"
+.LASF61:
+	.string	"blake2b_compress_lanes"
+.LASF14:
+	.string	"uint8_t"
+.LASF59:
+	.string	"bblane_store"
+.LASF26:
+	.string	"blake2b_iv"
+.LASF58:
+	.string	"bblane_inc_t"
+.LASF62:
+	.string	"write_le32"
+.LASF24:
+	.string	"blake2s_iv"
+	.section	.debug_line_str,"MS",@progbits,1
+.LASF1:
+	.string	"/root/repo"
+.LASF0:
+	.string	"blake2bp.c"
+	.ident	"GCC: (Debian 12.2.0-14+deb12u1) 12.2.0"
+	.section	.note.GNU-stack,"",@progbits
@@ -60,8 +60,8 @@ static const vu32 blake2s_viv[2] = {
     { 0x510e527f, 0x9b05688c, 0x1f83d9ab, 0x5be0cd19 },
 };
 
-static void blake2s_10rounds(vu32 va, vu32 vb, vu32 vc, vu32 vd,
-                             vu32 H[2], const void *msg)
+static inline void blake2s_10rounds(vu32 va, vu32 vb, vu32 vc, vu32 vd,
+                                    vu32 H[2], const void *msg)
 {
     /* 
      * The compression function state is 16 32-bit words.
@@ -180,7 +180,7 @@ static void blake2s_10rounds(vu32 va, vu32 vb, vu32 vc, vu32 vd,
     H[1] ^= vd;
 }
 
-void blake2s_compress(struct blake2s_ctx *ctx, const void *m)
+void blake2s_compress_altivec(struct blake2s_ctx *ctx, const void *m)
 {
     /* vec_ld: load from __16-byte_aligned_address__ */
     vu32 H[2];
@@ -198,3 +198,36 @@ void blake2s_compress(struct blake2s_ctx *ctx, const void *m)
     vec_st(H[0],  0, ctx->H);
     vec_st(H[1], 16, ctx->H);
 }
+
+/* vec_dst control word: 1 block of 4 x 16 bytes */
+#define B2S_DST_BLOCK ((4 << 24) | (1 << 16) | 64)
+
+void blake2s_compress_blocks_altivec(struct blake2s_ctx *ctx, const void *m,
+                                     size_t nblocks)
+{
+    static const vu32 vinc  = {BLAKE2S_BLOCK, 0, 0, 0};
+    static const vu32 vzero = {0, 0, 0, 0};
+    const u8 *msg = m;
+    vu32 H[2];
+    vu32 vpr, vc;
+    H[0] = vec_ld( 0, ctx->H);
+    H[1] = vec_ld(16, ctx->H);
+    vpr  = vec_ld( 0, &ctx->t[0]);
+
+    for (; nblocks; nblocks--, msg += BLAKE2S_BLOCK) {
+        /* start fetching the next block while this one is compressed */
+        if (nblocks > 1)
+            vec_dst(msg + BLAKE2S_BLOCK, B2S_DST_BLOCK, 0);
+        /* t += BLAKE2S_BLOCK, carrying from t[0] into t[1] */
+        vc  = vec_addc(vpr, vinc);
+        vpr = vec_add(vpr, vinc);
+        vpr = vec_add(vpr, vec_sld(vzero, vc, 12));
+        blake2s_10rounds(H[0], H[1], blake2s_viv[0], blake2s_viv[1] ^ vpr,
+                         H, msg);
+    }
+    vec_dss(0);
+
+    vec_st(H[0],  0, ctx->H);
+    vec_st(H[1], 16, ctx->H);
+    vec_st(vpr,   0, &ctx->t[0]);
+}
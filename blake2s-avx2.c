@@ -0,0 +1,135 @@
+#include "blake2s.h"
+#include "blake2s-internal.h"
+#include <immintrin.h>
+
+/* x86 AVX2 multi-buffer kernel: 8 independent messages, one per 32-bit
+ * lane of a 256-bit register.
+ *
+ * Unlike the row kernels, every vector here holds the same state word
+ * of 8 different messages, so G() is applied on plain vectors and no
+ * diagonal rotation is needed. The cost is moved to the message, which
+ * is transposed so that vector i holds message word i of every lane.
+ */
+static const u32 blake2s_zero_block[16];
+
+/* pshufb masks rotating every 32-bit word right by 16 and 8 bits */
+static const u8 blake2s_vr16[32] ALIGN(32) = {
+     2,  3,  0,  1,  6,  7,  4,  5, 10, 11,  8,  9, 14, 15, 12, 13,
+     2,  3,  0,  1,  6,  7,  4,  5, 10, 11,  8,  9, 14, 15, 12, 13,
+};
+static const u8 blake2s_vr8[32] ALIGN(32) = {
+     1,  2,  3,  0,  5,  6,  7,  4,  9, 10, 11,  8, 13, 14, 15, 12,
+     1,  2,  3,  0,  5,  6,  7,  4,  9, 10, 11,  8, 13, 14, 15, 12,
+};
+
+/* Transpose the 8x8 matrix of words in r[0..7] (row = lane) into
+ * w[0..7] (row = word) */
+static inline void blake2s_transpose8(__m256i w[8], const __m256i r[8])
+{
+    __m256i t[8], u[8];
+    for (unsigned i = 0; i < 8; i += 2) {
+        t[i]   = _mm256_unpacklo_epi32(r[i], r[i+1]);
+        t[i+1] = _mm256_unpackhi_epi32(r[i], r[i+1]);
+    }
+    for (unsigned i = 0; i < 8; i += 4) {
+        u[i]   = _mm256_unpacklo_epi64(t[i],   t[i+2]);
+        u[i+1] = _mm256_unpackhi_epi64(t[i],   t[i+2]);
+        u[i+2] = _mm256_unpacklo_epi64(t[i+1], t[i+3]);
+        u[i+3] = _mm256_unpackhi_epi64(t[i+1], t[i+3]);
+    }
+    for (unsigned i = 0; i < 4; i++) {
+        w[i]   = _mm256_permute2x128_si256(u[i], u[i+4], 0x20);
+        w[i+4] = _mm256_permute2x128_si256(u[i], u[i+4], 0x31);
+    }
+}
+
+void blake2s_compress_lanes_avx2(struct blake2s_lanes *L, const void *m[],
+                                 unsigned mask)
+{
+    const __m256i vr16 = _mm256_load_si256((const __m256i *)blake2s_vr16);
+    const __m256i vr8  = _mm256_load_si256((const __m256i *)blake2s_vr8);
+    const __m256i lbit = _mm256_setr_epi32(1, 2, 4, 8, 16, 32, 64, 128);
+    __m256i lo[8], hi[8];
+    __m256i w[16];
+    __m256i v[16];
+    __m256i keep;
+
+    /* Message schedule: lane l's block is row l, transpose to columns */
+    for (unsigned l = 0; l < 8; l++) {
+        const __m256i *p = (mask & (1u << l)) ? m[l] : blake2s_zero_block;
+        lo[l] = _mm256_loadu_si256(p + 0);
+        hi[l] = _mm256_loadu_si256(p + 1);
+    }
+    blake2s_transpose8(w + 0, lo);
+    blake2s_transpose8(w + 8, hi);
+
+    for (unsigned i = 0; i < 8; i++)
+        v[i] = _mm256_load_si256((const __m256i *)L->H[i]);
+    for (unsigned i = 0; i < 4; i++)
+        v[i+8] = _mm256_set1_epi32(blake2s_iv[i]);
+    v[12] = _mm256_xor_si256(_mm256_set1_epi32(blake2s_iv[4]),
+                             _mm256_load_si256((const __m256i *)L->t[0]));
+    v[13] = _mm256_xor_si256(_mm256_set1_epi32(blake2s_iv[5]),
+                             _mm256_load_si256((const __m256i *)L->t[1]));
+    v[14] = _mm256_xor_si256(_mm256_set1_epi32(blake2s_iv[6]),
+                             _mm256_load_si256((const __m256i *)L->f[0]));
+    v[15] = _mm256_xor_si256(_mm256_set1_epi32(blake2s_iv[7]),
+                             _mm256_load_si256((const __m256i *)L->f[1]));
+
+#define ror16(x) _mm256_shuffle_epi8(x, vr16)
+#define ror12(x) _mm256_or_si256(_mm256_srli_epi32(x, 12), _mm256_slli_epi32(x, 20))
+#define ror8(x)  _mm256_shuffle_epi8(x, vr8)
+#define ror7(x)  _mm256_or_si256(_mm256_srli_epi32(x,  7), _mm256_slli_epi32(x, 25))
+#define add(x,y) _mm256_add_epi32(x, y)
+#define xor(x,y) _mm256_xor_si256(x, y)
+
+#define BLAKE2S_VG(M,N,a,b,c,d) \
+    do { \
+        (a) = add(add(a, b), M);     \
+        (d) = ror16(xor(d, a));      \
+        (c) = add(c, d);             \
+        (b) = ror12(xor(b, c));      \
+        (a) = add(add(a, b), N);     \
+        (d) = ror8(xor(d, a));       \
+        (c) = add(c, d);             \
+        (b) = ror7(xor(b, c));       \
+    } while (0)
+
+#define Si(i,j) blake2s_sigma[(i)][(j)]
+
+    /* Each G() takes two of the 8-lane message registers in w[], named
+     * by the sigma row of its round */
+#define FULLROUND(r) \
+    do { \
+        BLAKE2S_VG(w[Si(r, 0)], w[Si(r, 1)], v[ 0], v[ 4], v[ 8], v[12]); \
+        BLAKE2S_VG(w[Si(r, 2)], w[Si(r, 3)], v[ 1], v[ 5], v[ 9], v[13]); \
+        BLAKE2S_VG(w[Si(r, 4)], w[Si(r, 5)], v[ 2], v[ 6], v[10], v[14]); \
+        BLAKE2S_VG(w[Si(r, 6)], w[Si(r, 7)], v[ 3], v[ 7], v[11], v[15]); \
+        \
+        BLAKE2S_VG(w[Si(r, 8)], w[Si(r, 9)], v[ 0], v[ 5], v[10], v[15]); \
+        BLAKE2S_VG(w[Si(r,10)], w[Si(r,11)], v[ 1], v[ 6], v[11], v[12]); \
+        BLAKE2S_VG(w[Si(r,12)], w[Si(r,13)], v[ 2], v[ 7], v[ 8], v[13]); \
+        BLAKE2S_VG(w[Si(r,14)], w[Si(r,15)], v[ 3], v[ 4], v[ 9], v[14]); \
+    } while (0)
+
+    /* 10 rounds times 8 applications of G */
+    FULLROUND(0);
+    FULLROUND(1);
+    FULLROUND(2);
+    FULLROUND(3);
+    FULLROUND(4);
+    FULLROUND(5);
+    FULLROUND(6);
+    FULLROUND(7);
+    FULLROUND(8);
+    FULLROUND(9);
+
+    /* Only lanes in `mask` take the new chaining value */
+    keep = _mm256_set1_epi32(mask);
+    keep = _mm256_cmpeq_epi32(_mm256_and_si256(keep, lbit), lbit);
+    for (unsigned i = 0; i < 8; i++) {
+        __m256i h = _mm256_load_si256((const __m256i *)L->H[i]);
+        __m256i n = xor(h, xor(v[i], v[i+8]));
+        _mm256_store_si256((__m256i *)L->H[i], _mm256_blendv_epi8(h, n, keep));
+    }
+}
@@ -0,0 +1,119 @@
+#include "blake2s.h"
+#include "blake2s-internal.h"
+#include <immintrin.h>
+
+/* x86 AVX-512 multi-buffer kernel: 16 independent messages, one per
+ * 32-bit lane of a 512-bit register.
+ *
+ * Same transposed layout as blake2s-avx2.c, but all four rotations of
+ * G() are a single vprord, and lanes outside `mask` are simply not
+ * written back, using the mask as a store predicate.
+ */
+static const u32 blake2s_zero_block[16];
+
+/* Transpose the 16x16 matrix of words in r[] (row = lane) into
+ * w[] (row = word) */
+static inline void blake2s_transpose16(__m512i w[16], const __m512i r[16])
+{
+    __m512i t[16], u[16];
+    for (unsigned i = 0; i < 16; i += 2) {
+        t[i]   = _mm512_unpacklo_epi32(r[i], r[i+1]);
+        t[i+1] = _mm512_unpackhi_epi32(r[i], r[i+1]);
+    }
+    /* u[4j+q]: 128-bit lane k holds word 4k+q of rows 4j..4j+3 */
+    for (unsigned i = 0; i < 16; i += 4) {
+        u[i]   = _mm512_unpacklo_epi64(t[i],   t[i+2]);
+        u[i+1] = _mm512_unpackhi_epi64(t[i],   t[i+2]);
+        u[i+2] = _mm512_unpacklo_epi64(t[i+1], t[i+3]);
+        u[i+3] = _mm512_unpackhi_epi64(t[i+1], t[i+3]);
+    }
+    for (unsigned q = 0; q < 4; q++) {
+        __m512i e0 = _mm512_shuffle_i32x4(u[q],   u[q+4],  _MM_SHUFFLE(2,0,2,0));
+        __m512i e1 = _mm512_shuffle_i32x4(u[q+8], u[q+12], _MM_SHUFFLE(2,0,2,0));
+        __m512i o0 = _mm512_shuffle_i32x4(u[q],   u[q+4],  _MM_SHUFFLE(3,1,3,1));
+        __m512i o1 = _mm512_shuffle_i32x4(u[q+8], u[q+12], _MM_SHUFFLE(3,1,3,1));
+        w[q]      = _mm512_shuffle_i32x4(e0, e1, _MM_SHUFFLE(2,0,2,0));
+        w[q+8]    = _mm512_shuffle_i32x4(e0, e1, _MM_SHUFFLE(3,1,3,1));
+        w[q+4]    = _mm512_shuffle_i32x4(o0, o1, _MM_SHUFFLE(2,0,2,0));
+        w[q+12]   = _mm512_shuffle_i32x4(o0, o1, _MM_SHUFFLE(3,1,3,1));
+    }
+}
+
+void blake2s_compress_lanes_avx512(struct blake2s_lanes *L, const void *m[],
+                                   unsigned mask)
+{
+    __m512i r[16];
+    __m512i w[16];
+    __m512i v[16];
+
+    /* Message schedule: lane l's block is row l, transpose to columns */
+    for (unsigned l = 0; l < 16; l++) {
+        const void *p = (mask & (1u << l)) ? m[l] : blake2s_zero_block;
+        r[l] = _mm512_loadu_si512(p);
+    }
+    blake2s_transpose16(w, r);
+
+    for (unsigned i = 0; i < 8; i++)
+        v[i] = _mm512_load_si512(L->H[i]);
+    for (unsigned i = 0; i < 4; i++)
+        v[i+8] = _mm512_set1_epi32(blake2s_iv[i]);
+    v[12] = _mm512_xor_si512(_mm512_set1_epi32(blake2s_iv[4]),
+                             _mm512_load_si512(L->t[0]));
+    v[13] = _mm512_xor_si512(_mm512_set1_epi32(blake2s_iv[5]),
+                             _mm512_load_si512(L->t[1]));
+    v[14] = _mm512_xor_si512(_mm512_set1_epi32(blake2s_iv[6]),
+                             _mm512_load_si512(L->f[0]));
+    v[15] = _mm512_xor_si512(_mm512_set1_epi32(blake2s_iv[7]),
+                             _mm512_load_si512(L->f[1]));
+
+#define ror(l,x) _mm512_ror_epi32(x, l)
+#define add(x,y) _mm512_add_epi32(x, y)
+#define xor(x,y) _mm512_xor_si512(x, y)
+
+#define BLAKE2S_VG(M,N,a,b,c,d) \
+    do { \
+        (a) = add(add(a, b), M);     \
+        (d) = ror(16, xor(d, a));    \
+        (c) = add(c, d);             \
+        (b) = ror(12, xor(b, c));    \
+        (a) = add(add(a, b), N);     \
+        (d) = ror( 8, xor(d, a));    \
+        (c) = add(c, d);             \
+        (b) = ror( 7, xor(b, c));    \
+    } while (0)
+
+#define Si(i,j) blake2s_sigma[(i)][(j)]
+
+    /* The rounds of blake2s-avx2.c, on 16 lanes at a time */
+#define FULLROUND(r) \
+    do { \
+        BLAKE2S_VG(w[Si(r, 0)], w[Si(r, 1)], v[ 0], v[ 4], v[ 8], v[12]); \
+        BLAKE2S_VG(w[Si(r, 2)], w[Si(r, 3)], v[ 1], v[ 5], v[ 9], v[13]); \
+        BLAKE2S_VG(w[Si(r, 4)], w[Si(r, 5)], v[ 2], v[ 6], v[10], v[14]); \
+        BLAKE2S_VG(w[Si(r, 6)], w[Si(r, 7)], v[ 3], v[ 7], v[11], v[15]); \
+        \
+        BLAKE2S_VG(w[Si(r, 8)], w[Si(r, 9)], v[ 0], v[ 5], v[10], v[15]); \
+        BLAKE2S_VG(w[Si(r,10)], w[Si(r,11)], v[ 1], v[ 6], v[11], v[12]); \
+        BLAKE2S_VG(w[Si(r,12)], w[Si(r,13)], v[ 2], v[ 7], v[ 8], v[13]); \
+        BLAKE2S_VG(w[Si(r,14)], w[Si(r,15)], v[ 3], v[ 4], v[ 9], v[14]); \
+    } while (0)
+
+    /* 10 rounds times 8 applications of G */
+    FULLROUND(0);
+    FULLROUND(1);
+    FULLROUND(2);
+    FULLROUND(3);
+    FULLROUND(4);
+    FULLROUND(5);
+    FULLROUND(6);
+    FULLROUND(7);
+    FULLROUND(8);
+    FULLROUND(9);
+
+    /* Only lanes in `mask` take the new chaining value */
+    for (unsigned i = 0; i < 8; i++) {
+        __m512i h = _mm512_load_si512(L->H[i]);
+        _mm512_mask_store_epi32(L->H[i], (__mmask16)mask,
+                                xor(h, xor(v[i], v[i+8])));
+    }
+}
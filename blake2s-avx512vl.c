@@ -0,0 +1,152 @@
+#include "blake2s.h"
+#include "blake2s-internal.h"
+#include <immintrin.h>
+
+/* x86 AVX-512VL kernel: the row layout of blake2s-sse.c on 128-bit
+ * vectors, but with vprord for every rotation, and the message words
+ * for each round gathered by vpermt2d instead of a shuffle sequence.
+ */
+
+static const u32 blake2s_viv[2][4] ALIGN(16) = {
+    { 0x6a09e667, 0xbb67ae85, 0x3c6ef372, 0xa54ff53a },
+    { 0x510e527f, 0x9b05688c, 0x1f83d9ab, 0x5be0cd19 },
+};
+
+/* The BLAKE2 sigma(r) message word permutation, grouped into the four
+ * G() input vectors: even and odd words for the rows, then even and odd
+ * words for the diagonals. Each half indexes the concatenation of
+ * message words 0-7 and 8-15, as vpermt2d does. */
+static const u32 blake2s_vsigma[10][16] ALIGN(32) =
+{
+    {  0,  2,  4,  6,  1,  3,  5,  7,   8, 10, 12, 14,  9, 11, 13, 15 },
+    { 14,  4,  9, 13, 10,  8, 15,  6,   1,  0, 11,  5, 12,  2,  7,  3 },
+    { 11, 12,  5, 15,  8,  0,  2, 13,  10,  3,  7,  9, 14,  6,  1,  4 },
+    {  7,  3, 13, 11,  9,  1, 12, 14,   2,  5,  4, 15,  6, 10,  0,  8 },
+    {  9,  5,  2, 10,  0,  7,  4, 15,  14, 11,  6,  3,  1, 12,  8, 13 },
+    {  2,  6,  0,  8, 12, 10, 11,  3,   4,  7, 15,  1, 13,  5, 14,  9 },
+    { 12,  1, 14,  4,  5, 15, 13, 10,   0,  6,  9,  8,  7,  3,  2, 11 },
+    { 13,  7, 12,  3, 11, 14,  1,  9,   5, 15,  8,  2,  0,  4,  6, 10 },
+    {  6, 14, 11,  0, 15,  9,  3,  8,  12, 13,  1, 10,  2,  7,  4,  5 },
+    { 10,  8,  7,  1,  2,  4,  6,  5,  15,  9,  3, 13, 11, 14, 12,  0 },
+};
+
+static inline void blake2s_10rounds(__m128i va, __m128i vb, __m128i vc,
+                                    __m128i vd, __m128i H[2],
+                                    __m256i mlo, __m256i mhi)
+{
+    __m128i b0, b1, b2, b3;
+
+#define ror(l,v) _mm_ror_epi32(v, l)
+#define add(x,y) _mm_add_epi32(x, y)
+#define xor(x,y) _mm_xor_si128(x, y)
+
+#define BLAKE2S_VG(M,N,a,b,c,d) \
+    do { \
+        (a) = add(add(a, b), M);     \
+        (d) = ror(16, xor(d, a));    \
+        (c) = add(c, d);             \
+        (b) = ror(12, xor(b, c));    \
+        (a) = add(add(a, b), N);     \
+        (d) = ror( 8, xor(d, a));    \
+        (c) = add(c, d);             \
+        (b) = ror( 7, xor(b, c));    \
+    } while (0)
+
+    /* vpermt2d(idx, a, b): pick words by index in idx from concat(a,b) */
+#define FULLROUND(r) \
+    do { \
+        __m256i x1, x2; \
+        x1 = _mm256_permutex2var_epi32(mlo, \
+                _mm256_load_si256((const __m256i *)blake2s_vsigma[r] + 0), mhi); \
+        x2 = _mm256_permutex2var_epi32(mlo, \
+                _mm256_load_si256((const __m256i *)blake2s_vsigma[r] + 1), mhi); \
+        b0 = _mm256_castsi256_si128(x1); \
+        b1 = _mm256_extracti128_si256(x1, 1); \
+        b2 = _mm256_castsi256_si128(x2); \
+        b3 = _mm256_extracti128_si256(x2, 1); \
+        \
+        /* First half:  apply G() on rows */ \
+        BLAKE2S_VG(b0,b1,va,vb,vc,vd); \
+        \
+        /* Second half: apply G() on diagonals */ \
+        vb = _mm_shuffle_epi32(vb, _MM_SHUFFLE(0,3,2,1)); \
+        vc = _mm_shuffle_epi32(vc, _MM_SHUFFLE(1,0,3,2)); \
+        vd = _mm_shuffle_epi32(vd, _MM_SHUFFLE(2,1,0,3)); \
+        BLAKE2S_VG(b2,b3,va,vb,vc,vd); \
+        vb = _mm_shuffle_epi32(vb, _MM_SHUFFLE(2,1,0,3)); \
+        vc = _mm_shuffle_epi32(vc, _MM_SHUFFLE(1,0,3,2)); \
+        vd = _mm_shuffle_epi32(vd, _MM_SHUFFLE(0,3,2,1)); \
+    } while (0)
+
+    /* 10 rounds times 2 applications of G */
+    FULLROUND(0);
+    FULLROUND(1);
+    FULLROUND(2);
+    FULLROUND(3);
+    FULLROUND(4);
+    FULLROUND(5);
+    FULLROUND(6);
+    FULLROUND(7);
+    FULLROUND(8);
+    FULLROUND(9);
+
+    H[0] = xor(H[0], xor(va, vc));
+    H[1] = xor(H[1], xor(vb, vd));
+}
+
+void blake2s_compress_avx512vl(struct blake2s_ctx *ctx, const void *m)
+{
+    const __m256i *p = m;
+    __m128i H[2];
+    __m128i va, vb, vc, vd;
+    __m128i vpr;
+    va = H[0] = _mm_load_si128((const __m128i *)ctx->H + 0);
+    vb = H[1] = _mm_load_si128((const __m128i *)ctx->H + 1);
+          vpr = _mm_load_si128((const __m128i *)ctx->t); /* t[0], t[1], f[0], f[1] */
+    vc = _mm_load_si128((const __m128i *)blake2s_viv[0]);
+    vd = _mm_xor_si128(_mm_load_si128((const __m128i *)blake2s_viv[1]), vpr);
+
+    blake2s_10rounds(va,vb,vc,vd, H, _mm256_loadu_si256(p + 0),
+                     _mm256_loadu_si256(p + 1));
+
+    _mm_store_si128((__m128i *)ctx->H + 0, H[0]);
+    _mm_store_si128((__m128i *)ctx->H + 1, H[1]);
+}
+
+void blake2s_compress_blocks_avx512vl(struct blake2s_ctx *ctx, const void *m,
+                                      size_t nblocks)
+{
+    /* t[0], t[1] read as one little endian 64-bit counter */
+    const __m128i vinc = _mm_set_epi64x(0, BLAKE2S_BLOCK);
+    const __m256i *p = m;
+    __m128i H[2];
+    __m128i vpr;
+    __m256i mlo, mhi;
+
+    if (!nblocks)
+        return;
+    H[0] = _mm_load_si128((const __m128i *)ctx->H + 0);
+    H[1] = _mm_load_si128((const __m128i *)ctx->H + 1);
+    vpr  = _mm_load_si128((const __m128i *)ctx->t);
+
+    mlo = _mm256_loadu_si256(p + 0);
+    mhi = _mm256_loadu_si256(p + 1);
+    while (nblocks--) {
+        __m256i blo = mlo, bhi = mhi;
+        /* load the next block before compressing this one */
+        p += 2;
+        if (nblocks) {
+            mlo = _mm256_loadu_si256(p + 0);
+            mhi = _mm256_loadu_si256(p + 1);
+        }
+        vpr = _mm_add_epi64(vpr, vinc);
+        blake2s_10rounds(H[0], H[1],
+                         _mm_load_si128((const __m128i *)blake2s_viv[0]),
+                         _mm_xor_si128(_mm_load_si128((const __m128i *)blake2s_viv[1]), vpr),
+                         H, blo, bhi);
+    }
+
+    _mm_store_si128((__m128i *)ctx->H + 0, H[0]);
+    _mm_store_si128((__m128i *)ctx->H + 1, H[1]);
+    _mm_store_si128((__m128i *)ctx->t, vpr);
+}
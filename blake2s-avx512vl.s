@@ -0,0 +1,28743 @@
+	.file	"blake2s-avx512vl.c"
+# GNU C99 (Debian 12.2.0-14+deb12u1) version 12.2.0 (x86_64-linux-gnu)
+#	compiled by GNU C version 12.2.0, GMP version 6.2.1, MPFR version 4.2.0, MPC version 1.3.1, isl version isl-0.25-GMP
+
+# GGC heuristics: --param ggc-min-expand=100 --param ggc-min-heapsize=131072
+# options passed: -mavx512f -mavx512vl -mtune=generic -march=x86-64 -g -O3 -std=c99 -fasynchronous-unwind-tables
+	.text
+.Ltext0:
+	.file 0 "/root/repo" "blake2s-avx512vl.c"
+	.p2align 4
+	.type	blake2s_10rounds.constprop.0, @function
+blake2s_10rounds.constprop.0:
+.LVL0:
+.LFB6406:
+	.file 1 "blake2s-avx512vl.c"
+	.loc 1 33 20 view -0
+	.cfi_startproc
+	.loc 1 37 5 view .LVU1
+	.loc 1 82 5 view .LVU2
+.LBB1731:
+	.loc 1 82 10 view .LVU3
+	.loc 1 82 26 view .LVU4
+.LBB1732:
+.LBI1732:
+	.file 2 "/usr/lib/gcc/x86_64-linux-gnu/12/include/avx512vlintrin.h"
+	.loc 2 6674 1 view .LVU5
+.LBB1733:
+	.loc 2 6676 3 view .LVU6
+.LBE1733:
+.LBE1732:
+.LBB1736:
+.LBB1737:
+# /usr/lib/gcc/x86_64-linux-gnu/12/include/avx512vlintrin.h:6676:   return (__m256i) __builtin_ia32_vpermt2vard256_mask ((__v8si) __I
+	.loc 2 6676 20 is_stmt 0 view .LVU7
+	vmovdqa	.LC1(%rip), %ymm8	#, tmp929
+.LBE1737:
+.LBE1736:
+.LBE1731:
+# blake2s-avx512vl.c:33: static inline void blake2s_10rounds(__m128i va, __m128i vb, __m128i vc,
+	.loc 1 33 20 view .LVU8
+	vmovdqa	%xmm0, %xmm7	# va, tmp1669
+.LBB1868:
+.LBB1739:
+.LBB1734:
+# /usr/lib/gcc/x86_64-linux-gnu/12/include/avx512vlintrin.h:6676:   return (__m256i) __builtin_ia32_vpermt2vard256_mask ((__v8si) __I
+	.loc 2 6676 20 view .LVU9
+	vmovdqa	.LC0(%rip), %ymm0	#, tmp924
+.LVL1:
+	.loc 2 6676 20 view .LVU10
+.LBE1734:
+.LBE1739:
+.LBE1868:
+.LBB1869:
+.LBB1870:
+.LBB1871:
+	vmovdqa	.LC4(%rip), %ymm9	#, tmp1004
+.LBE1871:
+.LBE1870:
+.LBE1869:
+.LBB2010:
+.LBB1740:
+.LBB1741:
+# /usr/lib/gcc/x86_64-linux-gnu/12/include/emmintrin.h:1066:   return (__m128i) ((__v4su)__A + (__v4su)__B);
+	.file 3 "/usr/lib/gcc/x86_64-linux-gnu/12/include/emmintrin.h"
+	.loc 3 1066 33 view .LVU11
+	vpaddd	%xmm1, %xmm7, %xmm7	# vb, tmp1669, tmp941
+.LVL2:
+	.loc 3 1066 33 view .LVU12
+.LBE1741:
+.LBE1740:
+.LBB1743:
+.LBB1735:
+# /usr/lib/gcc/x86_64-linux-gnu/12/include/avx512vlintrin.h:6676:   return (__m256i) __builtin_ia32_vpermt2vard256_mask ((__v8si) __I
+	.loc 2 6676 20 view .LVU13
+	vpermi2d	%ymm4, %ymm3, %ymm0	# mhi, mlo, tmp923
+.LVL3:
+	.loc 2 6676 20 view .LVU14
+.LBE1735:
+.LBE1743:
+	.loc 1 82 127 is_stmt 1 view .LVU15
+.LBB1744:
+.LBI1736:
+	.loc 2 6674 1 view .LVU16
+.LBB1738:
+	.loc 2 6676 3 view .LVU17
+# /usr/lib/gcc/x86_64-linux-gnu/12/include/avx512vlintrin.h:6676:   return (__m256i) __builtin_ia32_vpermt2vard256_mask ((__v8si) __I
+	.loc 2 6676 20 is_stmt 0 view .LVU18
+	vpermi2d	%ymm4, %ymm3, %ymm8	# mhi, mlo, tmp928
+.LVL4:
+	.loc 2 6676 20 view .LVU19
+.LBE1738:
+.LBE1744:
+	.loc 1 82 228 is_stmt 1 view .LVU20
+.LBB1745:
+.LBI1745:
+	.file 4 "/usr/lib/gcc/x86_64-linux-gnu/12/include/avxintrin.h"
+	.loc 4 1467 1 view .LVU21
+.LBB1746:
+	.loc 4 1469 3 view .LVU22
+	.loc 4 1469 3 is_stmt 0 view .LVU23
+.LBE1746:
+.LBE1745:
+	.loc 1 82 261 is_stmt 1 view .LVU24
+.LBB1747:
+.LBI1747:
+	.file 5 "/usr/lib/gcc/x86_64-linux-gnu/12/include/avx2intrin.h"
+	.loc 5 1096 1 view .LVU25
+.LBB1748:
+	.loc 5 1098 3 view .LVU26
+.LBE1748:
+.LBE1747:
+.LBB1750:
+.LBB1751:
+# /usr/lib/gcc/x86_64-linux-gnu/12/include/emmintrin.h:1066:   return (__m128i) ((__v4su)__A + (__v4su)__B);
+	.loc 3 1066 33 is_stmt 0 view .LVU27
+	vpaddd	%xmm0, %xmm7, %xmm7	# tmp933, tmp941, _19
+.LBE1751:
+.LBE1750:
+.LBB1753:
+.LBB1749:
+# /usr/lib/gcc/x86_64-linux-gnu/12/include/avx2intrin.h:1098:   return (__m128i) __builtin_ia32_extract128i256 ((__v4di)__X, __M);
+	.loc 5 1098 20 view .LVU28
+	vextracti32x4	$0x1, %ymm0, %xmm5	# tmp923, tmp935
+.LVL5:
+	.loc 5 1098 20 view .LVU29
+.LBE1749:
+.LBE1753:
+	.loc 1 82 299 is_stmt 1 view .LVU30
+.LBB1754:
+.LBI1754:
+	.loc 4 1467 1 view .LVU31
+.LBB1755:
+	.loc 4 1469 3 view .LVU32
+# /usr/lib/gcc/x86_64-linux-gnu/12/include/avxintrin.h:1469:   return (__m128i) __builtin_ia32_si_si256 ((__v8si)__A);
+	.loc 4 1469 20 is_stmt 0 view .LVU33
+	vmovdqa	%xmm8, %xmm6	# tmp928, tmp937
+.LVL6:
+	.loc 4 1469 20 view .LVU34
+.LBE1755:
+.LBE1754:
+	.loc 1 82 332 is_stmt 1 view .LVU35
+.LBB1756:
+.LBI1756:
+	.loc 5 1096 1 view .LVU36
+.LBB1757:
+	.loc 5 1098 3 view .LVU37
+.LBE1757:
+.LBE1756:
+.LBB1759:
+.LBB1760:
+# /usr/lib/gcc/x86_64-linux-gnu/12/include/emmintrin.h:1329:   return (__m128i) ((__v2du)__A ^ (__v2du)__B);
+	.loc 3 1329 33 is_stmt 0 view .LVU38
+	vpxor	%xmm7, %xmm2, %xmm0	# _19, tmp1671, tmp943
+.LVL7:
+	.loc 3 1329 33 view .LVU39
+.LBE1760:
+.LBE1759:
+.LBB1762:
+.LBB1758:
+# /usr/lib/gcc/x86_64-linux-gnu/12/include/avx2intrin.h:1098:   return (__m128i) __builtin_ia32_extract128i256 ((__v4di)__X, __M);
+	.loc 5 1098 20 view .LVU40
+	vextracti32x4	$0x1, %ymm8, %xmm8	# tmp928, tmp939
+.LVL8:
+	.loc 5 1098 20 view .LVU41
+.LBE1758:
+.LBE1762:
+	.loc 1 82 370 is_stmt 1 view .LVU42
+	.loc 1 82 375 view .LVU43
+.LBB1763:
+.LBI1740:
+	.loc 3 1064 1 view .LVU44
+.LBB1742:
+	.loc 3 1066 3 view .LVU45
+	.loc 3 1066 3 is_stmt 0 view .LVU46
+.LBE1742:
+.LBE1763:
+.LBB1764:
+.LBI1750:
+	.loc 3 1064 1 is_stmt 1 view .LVU47
+.LBB1752:
+	.loc 3 1066 3 view .LVU48
+	.loc 3 1066 3 is_stmt 0 view .LVU49
+.LBE1752:
+.LBE1764:
+	.loc 1 82 424 is_stmt 1 view .LVU50
+.LBB1765:
+.LBI1759:
+	.loc 3 1327 1 view .LVU51
+.LBB1761:
+	.loc 3 1329 3 view .LVU52
+	.loc 3 1329 3 is_stmt 0 view .LVU53
+.LBE1761:
+.LBE1765:
+.LBB1766:
+.LBI1766:
+	.loc 2 11663 1 is_stmt 1 view .LVU54
+.LBB1767:
+	.loc 2 11665 3 view .LVU55
+.LBE1767:
+.LBE1766:
+.LBE2010:
+.LBB2011:
+.LBB1874:
+.LBB1872:
+# /usr/lib/gcc/x86_64-linux-gnu/12/include/avx512vlintrin.h:6676:   return (__m256i) __builtin_ia32_vpermt2vard256_mask ((__v8si) __I
+	.loc 2 6676 20 is_stmt 0 view .LVU56
+	vpermi2d	%ymm4, %ymm3, %ymm9	# mhi, mlo, tmp1003
+.LBE1872:
+.LBE1874:
+.LBE2011:
+.LBB2012:
+.LBB1769:
+.LBB1768:
+# /usr/lib/gcc/x86_64-linux-gnu/12/include/avx512vlintrin.h:11665:   return (__m128i) __builtin_ia32_prord128_mask ((__v4si) __A, __B,
+	.loc 2 11665 20 view .LVU57
+	vprold	$16, %xmm0, %xmm0	#, tmp943, tmp942
+.LVL9:
+	.loc 2 11665 20 view .LVU58
+.LBE1768:
+.LBE1769:
+	.loc 1 82 473 is_stmt 1 view .LVU59
+.LBB1770:
+.LBI1770:
+	.loc 3 1064 1 view .LVU60
+.LBB1771:
+	.loc 3 1066 3 view .LVU61
+# /usr/lib/gcc/x86_64-linux-gnu/12/include/emmintrin.h:1066:   return (__m128i) ((__v4su)__A + (__v4su)__B);
+	.loc 3 1066 33 is_stmt 0 view .LVU62
+	vpaddd	.LC2(%rip), %xmm0, %xmm2	#, tmp942, _28
+.LVL10:
+	.loc 3 1066 33 view .LVU63
+.LBE1771:
+.LBE1770:
+	.loc 1 82 503 is_stmt 1 view .LVU64
+.LBB1772:
+.LBI1772:
+	.loc 3 1327 1 view .LVU65
+.LBB1773:
+	.loc 3 1329 3 view .LVU66
+	.loc 3 1329 3 is_stmt 0 view .LVU67
+.LBE1773:
+.LBE1772:
+.LBB1775:
+.LBI1775:
+	.loc 2 11663 1 is_stmt 1 view .LVU68
+.LBB1776:
+	.loc 2 11665 3 view .LVU69
+.LBE1776:
+.LBE1775:
+.LBB1778:
+.LBB1774:
+# /usr/lib/gcc/x86_64-linux-gnu/12/include/emmintrin.h:1329:   return (__m128i) ((__v2du)__A ^ (__v2du)__B);
+	.loc 3 1329 33 is_stmt 0 view .LVU70
+	vpxor	%xmm2, %xmm1, %xmm1	# _28, vb, tmp949
+.LVL11:
+	.loc 3 1329 33 view .LVU71
+.LBE1774:
+.LBE1778:
+.LBB1779:
+.LBB1777:
+# /usr/lib/gcc/x86_64-linux-gnu/12/include/avx512vlintrin.h:11665:   return (__m128i) __builtin_ia32_prord128_mask ((__v4si) __A, __B,
+	.loc 2 11665 20 view .LVU72
+	vprord	$12, %xmm1, %xmm1	#, tmp949, tmp948
+.LVL12:
+	.loc 2 11665 20 view .LVU73
+.LBE1777:
+.LBE1779:
+	.loc 1 82 552 is_stmt 1 view .LVU74
+.LBB1780:
+.LBI1780:
+	.loc 3 1064 1 view .LVU75
+.LBB1781:
+	.loc 3 1066 3 view .LVU76
+	.loc 3 1066 3 is_stmt 0 view .LVU77
+.LBE1781:
+.LBE1780:
+.LBB1782:
+.LBI1782:
+	.loc 3 1064 1 is_stmt 1 view .LVU78
+.LBB1783:
+	.loc 3 1066 3 view .LVU79
+# /usr/lib/gcc/x86_64-linux-gnu/12/include/emmintrin.h:1066:   return (__m128i) ((__v4su)__A + (__v4su)__B);
+	.loc 3 1066 33 is_stmt 0 view .LVU80
+	vpaddd	%xmm5, %xmm1, %xmm5	# tmp935, tmp948, tmp953
+.LVL13:
+	.loc 3 1066 33 view .LVU81
+	vpaddd	%xmm7, %xmm5, %xmm5	# _19, tmp953, _37
+.LVL14:
+	.loc 3 1066 33 view .LVU82
+.LBE1783:
+.LBE1782:
+	.loc 1 82 601 is_stmt 1 view .LVU83
+.LBB1784:
+.LBI1784:
+	.loc 3 1327 1 view .LVU84
+.LBB1785:
+	.loc 3 1329 3 view .LVU85
+	.loc 3 1329 3 is_stmt 0 view .LVU86
+.LBE1785:
+.LBE1784:
+.LBB1787:
+.LBI1787:
+	.loc 2 11663 1 is_stmt 1 view .LVU87
+.LBB1788:
+	.loc 2 11665 3 view .LVU88
+.LBE1788:
+.LBE1787:
+.LBB1790:
+.LBB1786:
+# /usr/lib/gcc/x86_64-linux-gnu/12/include/emmintrin.h:1329:   return (__m128i) ((__v2du)__A ^ (__v2du)__B);
+	.loc 3 1329 33 is_stmt 0 view .LVU89
+	vpxor	%xmm5, %xmm0, %xmm0	# _37, tmp942, tmp955
+.LVL15:
+	.loc 3 1329 33 view .LVU90
+.LBE1786:
+.LBE1790:
+.LBB1791:
+.LBB1789:
+# /usr/lib/gcc/x86_64-linux-gnu/12/include/avx512vlintrin.h:11665:   return (__m128i) __builtin_ia32_prord128_mask ((__v4si) __A, __B,
+	.loc 2 11665 20 view .LVU91
+	vprord	$8, %xmm0, %xmm0	#, tmp955, tmp954
+.LVL16:
+	.loc 2 11665 20 view .LVU92
+.LBE1789:
+.LBE1791:
+	.loc 1 82 649 is_stmt 1 view .LVU93
+.LBB1792:
+.LBI1792:
+	.loc 3 1064 1 view .LVU94
+.LBB1793:
+	.loc 3 1066 3 view .LVU95
+# /usr/lib/gcc/x86_64-linux-gnu/12/include/emmintrin.h:1066:   return (__m128i) ((__v4su)__A + (__v4su)__B);
+	.loc 3 1066 33 is_stmt 0 view .LVU96
+	vpaddd	%xmm2, %xmm0, %xmm2	# _28, tmp954, _44
+.LVL17:
+	.loc 3 1066 33 view .LVU97
+.LBE1793:
+.LBE1792:
+	.loc 1 82 679 is_stmt 1 view .LVU98
+.LBB1794:
+.LBI1794:
+	.loc 3 1327 1 view .LVU99
+.LBB1795:
+	.loc 3 1329 3 view .LVU100
+	.loc 3 1329 3 is_stmt 0 view .LVU101
+.LBE1795:
+.LBE1794:
+.LBB1797:
+.LBI1797:
+	.loc 2 11663 1 is_stmt 1 view .LVU102
+.LBB1798:
+	.loc 2 11665 3 view .LVU103
+.LBE1798:
+.LBE1797:
+.LBB1800:
+.LBB1801:
+# /usr/lib/gcc/x86_64-linux-gnu/12/include/emmintrin.h:1458:   return (__m128i)__builtin_ia32_pshufd ((__v4si)__A, __mask);
+	.loc 3 1458 19 is_stmt 0 view .LVU104
+	vpshufd	$147, %xmm0, %xmm0	#, tmp954, tmp968
+.LVL18:
+	.loc 3 1458 19 view .LVU105
+.LBE1801:
+.LBE1800:
+.LBB1803:
+.LBB1796:
+# /usr/lib/gcc/x86_64-linux-gnu/12/include/emmintrin.h:1329:   return (__m128i) ((__v2du)__A ^ (__v2du)__B);
+	.loc 3 1329 33 view .LVU106
+	vpxor	%xmm2, %xmm1, %xmm1	# _44, tmp948, tmp960
+.LVL19:
+	.loc 3 1329 33 view .LVU107
+.LBE1796:
+.LBE1803:
+.LBB1804:
+.LBB1805:
+# /usr/lib/gcc/x86_64-linux-gnu/12/include/emmintrin.h:1458:   return (__m128i)__builtin_ia32_pshufd ((__v4si)__A, __mask);
+	.loc 3 1458 19 view .LVU108
+	vpshufd	$78, %xmm2, %xmm2	#, _44, tmp966
+.LVL20:
+	.loc 3 1458 19 view .LVU109
+.LBE1805:
+.LBE1804:
+.LBB1807:
+.LBB1799:
+# /usr/lib/gcc/x86_64-linux-gnu/12/include/avx512vlintrin.h:11665:   return (__m128i) __builtin_ia32_prord128_mask ((__v4si) __A, __B,
+	.loc 2 11665 20 view .LVU110
+	vprord	$7, %xmm1, %xmm1	#, tmp960, tmp959
+.LVL21:
+	.loc 2 11665 20 view .LVU111
+.LBE1799:
+.LBE1807:
+	.loc 1 82 373 is_stmt 1 view .LVU112
+	.loc 1 82 740 view .LVU113
+.LBB1808:
+.LBI1808:
+	.loc 3 1456 1 view .LVU114
+.LBB1809:
+	.loc 3 1458 3 view .LVU115
+# /usr/lib/gcc/x86_64-linux-gnu/12/include/emmintrin.h:1458:   return (__m128i)__builtin_ia32_pshufd ((__v4si)__A, __mask);
+	.loc 3 1458 19 is_stmt 0 view .LVU116
+	vpshufd	$57, %xmm1, %xmm1	#, tmp959, tmp964
+.LVL22:
+	.loc 3 1458 19 view .LVU117
+.LBE1809:
+.LBE1808:
+	.loc 1 82 7 is_stmt 1 view .LVU118
+.LBB1810:
+.LBI1804:
+	.loc 3 1456 1 view .LVU119
+.LBB1806:
+	.loc 3 1458 3 view .LVU120
+	.loc 3 1458 3 is_stmt 0 view .LVU121
+.LBE1806:
+.LBE1810:
+	.loc 1 82 7 is_stmt 1 view .LVU122
+.LBB1811:
+.LBI1800:
+	.loc 3 1456 1 view .LVU123
+.LBB1802:
+	.loc 3 1458 3 view .LVU124
+	.loc 3 1458 3 is_stmt 0 view .LVU125
+.LBE1802:
+.LBE1811:
+	.loc 1 82 7 is_stmt 1 view .LVU126
+	.loc 1 82 12 view .LVU127
+.LBB1812:
+.LBI1812:
+	.loc 3 1064 1 view .LVU128
+.LBB1813:
+	.loc 3 1066 3 view .LVU129
+	.loc 3 1066 3 is_stmt 0 view .LVU130
+.LBE1813:
+.LBE1812:
+.LBB1814:
+.LBI1814:
+	.loc 3 1064 1 is_stmt 1 view .LVU131
+.LBB1815:
+	.loc 3 1066 3 view .LVU132
+# /usr/lib/gcc/x86_64-linux-gnu/12/include/emmintrin.h:1066:   return (__m128i) ((__v4su)__A + (__v4su)__B);
+	.loc 3 1066 33 is_stmt 0 view .LVU133
+	vpaddd	%xmm6, %xmm1, %xmm6	# tmp937, tmp964, tmp970
+	vpaddd	%xmm5, %xmm6, %xmm5	# _37, tmp970, _57
+.LVL23:
+	.loc 3 1066 33 view .LVU134
+.LBE1815:
+.LBE1814:
+	.loc 1 82 61 is_stmt 1 view .LVU135
+.LBB1816:
+.LBI1816:
+	.loc 3 1327 1 view .LVU136
+.LBB1817:
+	.loc 3 1329 3 view .LVU137
+	.loc 3 1329 3 is_stmt 0 view .LVU138
+.LBE1817:
+.LBE1816:
+.LBB1819:
+.LBI1819:
+	.loc 2 11663 1 is_stmt 1 view .LVU139
+.LBB1820:
+	.loc 2 11665 3 view .LVU140
+.LBE1820:
+.LBE1819:
+.LBE2012:
+.LBB2013:
+.LBB1875:
+.LBB1876:
+# /usr/lib/gcc/x86_64-linux-gnu/12/include/avxintrin.h:1469:   return (__m128i) __builtin_ia32_si_si256 ((__v8si)__A);
+	.loc 4 1469 20 is_stmt 0 view .LVU141
+	vmovdqa	%xmm9, %xmm6	# tmp1003, tmp1012
+.LBE1876:
+.LBE1875:
+.LBB1878:
+.LBB1879:
+# /usr/lib/gcc/x86_64-linux-gnu/12/include/avx2intrin.h:1098:   return (__m128i) __builtin_ia32_extract128i256 ((__v4di)__X, __M);
+	.loc 5 1098 20 view .LVU142
+	vextracti32x4	$0x1, %ymm9, %xmm9	# tmp1003, tmp1014
+.LBE1879:
+.LBE1878:
+.LBE2013:
+.LBB2014:
+.LBB1822:
+.LBB1818:
+# /usr/lib/gcc/x86_64-linux-gnu/12/include/emmintrin.h:1329:   return (__m128i) ((__v2du)__A ^ (__v2du)__B);
+	.loc 3 1329 33 view .LVU143
+	vpxor	%xmm5, %xmm0, %xmm0	# _57, tmp968, tmp972
+.LVL24:
+	.loc 3 1329 33 view .LVU144
+.LBE1818:
+.LBE1822:
+.LBB1823:
+.LBB1821:
+# /usr/lib/gcc/x86_64-linux-gnu/12/include/avx512vlintrin.h:11665:   return (__m128i) __builtin_ia32_prord128_mask ((__v4si) __A, __B,
+	.loc 2 11665 20 view .LVU145
+	vprold	$16, %xmm0, %xmm0	#, tmp972, tmp971
+.LVL25:
+	.loc 2 11665 20 view .LVU146
+.LBE1821:
+.LBE1823:
+	.loc 1 82 110 is_stmt 1 view .LVU147
+.LBB1824:
+.LBI1824:
+	.loc 3 1064 1 view .LVU148
+.LBB1825:
+	.loc 3 1066 3 view .LVU149
+# /usr/lib/gcc/x86_64-linux-gnu/12/include/emmintrin.h:1066:   return (__m128i) ((__v4su)__A + (__v4su)__B);
+	.loc 3 1066 33 is_stmt 0 view .LVU150
+	vpaddd	%xmm0, %xmm2, %xmm2	# tmp971, tmp966, _65
+.LVL26:
+	.loc 3 1066 33 view .LVU151
+.LBE1825:
+.LBE1824:
+	.loc 1 82 140 is_stmt 1 view .LVU152
+.LBB1826:
+.LBI1826:
+	.loc 3 1327 1 view .LVU153
+.LBB1827:
+	.loc 3 1329 3 view .LVU154
+	.loc 3 1329 3 is_stmt 0 view .LVU155
+.LBE1827:
+.LBE1826:
+.LBB1829:
+.LBI1829:
+	.loc 2 11663 1 is_stmt 1 view .LVU156
+.LBB1830:
+	.loc 2 11665 3 view .LVU157
+.LBE1830:
+.LBE1829:
+.LBB1832:
+.LBB1828:
+# /usr/lib/gcc/x86_64-linux-gnu/12/include/emmintrin.h:1329:   return (__m128i) ((__v2du)__A ^ (__v2du)__B);
+	.loc 3 1329 33 is_stmt 0 view .LVU158
+	vpxor	%xmm2, %xmm1, %xmm1	# _65, tmp964, tmp977
+.LVL27:
+	.loc 3 1329 33 view .LVU159
+.LBE1828:
+.LBE1832:
+.LBB1833:
+.LBB1831:
+# /usr/lib/gcc/x86_64-linux-gnu/12/include/avx512vlintrin.h:11665:   return (__m128i) __builtin_ia32_prord128_mask ((__v4si) __A, __B,
+	.loc 2 11665 20 view .LVU160
+	vprord	$12, %xmm1, %xmm1	#, tmp977, tmp976
+.LVL28:
+	.loc 2 11665 20 view .LVU161
+.LBE1831:
+.LBE1833:
+	.loc 1 82 189 is_stmt 1 view .LVU162
+.LBB1834:
+.LBI1834:
+	.loc 3 1064 1 view .LVU163
+.LBB1835:
+	.loc 3 1066 3 view .LVU164
+	.loc 3 1066 3 is_stmt 0 view .LVU165
+.LBE1835:
+.LBE1834:
+.LBB1836:
+.LBI1836:
+	.loc 3 1064 1 is_stmt 1 view .LVU166
+.LBB1837:
+	.loc 3 1066 3 view .LVU167
+# /usr/lib/gcc/x86_64-linux-gnu/12/include/emmintrin.h:1066:   return (__m128i) ((__v4su)__A + (__v4su)__B);
+	.loc 3 1066 33 is_stmt 0 view .LVU168
+	vpaddd	%xmm8, %xmm1, %xmm8	# tmp939, tmp976, tmp981
+.LVL29:
+	.loc 3 1066 33 view .LVU169
+	vpaddd	%xmm5, %xmm8, %xmm8	# _57, tmp981, _74
+.LVL30:
+	.loc 3 1066 33 view .LVU170
+.LBE1837:
+.LBE1836:
+	.loc 1 82 238 is_stmt 1 view .LVU171
+.LBB1838:
+.LBI1838:
+	.loc 3 1327 1 view .LVU172
+.LBB1839:
+	.loc 3 1329 3 view .LVU173
+	.loc 3 1329 3 is_stmt 0 view .LVU174
+.LBE1839:
+.LBE1838:
+.LBB1841:
+.LBI1841:
+	.loc 2 11663 1 is_stmt 1 view .LVU175
+.LBB1842:
+	.loc 2 11665 3 view .LVU176
+.LBE1842:
+.LBE1841:
+.LBE2014:
+.LBB2015:
+.LBB1881:
+.LBB1882:
+# /usr/lib/gcc/x86_64-linux-gnu/12/include/avx512vlintrin.h:6676:   return (__m256i) __builtin_ia32_vpermt2vard256_mask ((__v8si) __I
+	.loc 2 6676 20 is_stmt 0 view .LVU177
+	vmovdqa	.LC3(%rip), %ymm5	#, tmp999
+.LBE1882:
+.LBE1881:
+.LBE2015:
+.LBB2016:
+.LBB1844:
+.LBB1840:
+# /usr/lib/gcc/x86_64-linux-gnu/12/include/emmintrin.h:1329:   return (__m128i) ((__v2du)__A ^ (__v2du)__B);
+	.loc 3 1329 33 view .LVU178
+	vpxor	%xmm8, %xmm0, %xmm0	# _74, tmp971, tmp983
+.LVL31:
+	.loc 3 1329 33 view .LVU179
+.LBE1840:
+.LBE1844:
+.LBB1845:
+.LBB1843:
+# /usr/lib/gcc/x86_64-linux-gnu/12/include/avx512vlintrin.h:11665:   return (__m128i) __builtin_ia32_prord128_mask ((__v4si) __A, __B,
+	.loc 2 11665 20 view .LVU180
+	vprord	$8, %xmm0, %xmm0	#, tmp983, tmp982
+.LVL32:
+	.loc 2 11665 20 view .LVU181
+.LBE1843:
+.LBE1845:
+	.loc 1 82 286 is_stmt 1 view .LVU182
+.LBB1846:
+.LBI1846:
+	.loc 3 1064 1 view .LVU183
+.LBB1847:
+	.loc 3 1066 3 view .LVU184
+.LBE1847:
+.LBE1846:
+.LBE2016:
+.LBB2017:
+.LBB1885:
+.LBB1883:
+# /usr/lib/gcc/x86_64-linux-gnu/12/include/avx512vlintrin.h:6676:   return (__m256i) __builtin_ia32_vpermt2vard256_mask ((__v8si) __I
+	.loc 2 6676 20 is_stmt 0 view .LVU185
+	vpermi2d	%ymm4, %ymm3, %ymm5	# mhi, mlo, tmp998
+.LBE1883:
+.LBE1885:
+.LBB1886:
+.LBB1887:
+# /usr/lib/gcc/x86_64-linux-gnu/12/include/avxintrin.h:1469:   return (__m128i) __builtin_ia32_si_si256 ((__v8si)__A);
+	.loc 4 1469 20 view .LVU186
+	vmovdqa	%xmm5, %xmm7	# tmp998, tmp1008
+.LBE1887:
+.LBE1886:
+.LBB1889:
+.LBB1890:
+# /usr/lib/gcc/x86_64-linux-gnu/12/include/avx2intrin.h:1098:   return (__m128i) __builtin_ia32_extract128i256 ((__v4di)__X, __M);
+	.loc 5 1098 20 view .LVU187
+	vextracti32x4	$0x1, %ymm5, %xmm5	# tmp998, tmp1010
+.LBE1890:
+.LBE1889:
+.LBE2017:
+.LBB2018:
+.LBB1849:
+.LBB1848:
+# /usr/lib/gcc/x86_64-linux-gnu/12/include/emmintrin.h:1066:   return (__m128i) ((__v4su)__A + (__v4su)__B);
+	.loc 3 1066 33 view .LVU188
+	vpaddd	%xmm2, %xmm0, %xmm2	# _65, tmp982, _81
+.LVL33:
+	.loc 3 1066 33 view .LVU189
+.LBE1848:
+.LBE1849:
+	.loc 1 82 316 is_stmt 1 view .LVU190
+.LBB1850:
+.LBI1850:
+	.loc 3 1327 1 view .LVU191
+.LBB1851:
+	.loc 3 1329 3 view .LVU192
+	.loc 3 1329 3 is_stmt 0 view .LVU193
+.LBE1851:
+.LBE1850:
+.LBB1853:
+.LBI1853:
+	.loc 2 11663 1 is_stmt 1 view .LVU194
+.LBB1854:
+	.loc 2 11665 3 view .LVU195
+.LBE1854:
+.LBE1853:
+.LBB1856:
+.LBB1857:
+# /usr/lib/gcc/x86_64-linux-gnu/12/include/emmintrin.h:1458:   return (__m128i)__builtin_ia32_pshufd ((__v4si)__A, __mask);
+	.loc 3 1458 19 is_stmt 0 view .LVU196
+	vpshufd	$57, %xmm0, %xmm0	#, tmp982, tmp996
+.LVL34:
+	.loc 3 1458 19 view .LVU197
+.LBE1857:
+.LBE1856:
+.LBB1859:
+.LBB1852:
+# /usr/lib/gcc/x86_64-linux-gnu/12/include/emmintrin.h:1329:   return (__m128i) ((__v2du)__A ^ (__v2du)__B);
+	.loc 3 1329 33 view .LVU198
+	vpxor	%xmm2, %xmm1, %xmm1	# _81, tmp976, tmp988
+.LVL35:
+	.loc 3 1329 33 view .LVU199
+.LBE1852:
+.LBE1859:
+.LBB1860:
+.LBB1861:
+# /usr/lib/gcc/x86_64-linux-gnu/12/include/emmintrin.h:1458:   return (__m128i)__builtin_ia32_pshufd ((__v4si)__A, __mask);
+	.loc 3 1458 19 view .LVU200
+	vpshufd	$78, %xmm2, %xmm2	#, _81, tmp994
+.LVL36:
+	.loc 3 1458 19 view .LVU201
+.LBE1861:
+.LBE1860:
+.LBB1863:
+.LBB1855:
+# /usr/lib/gcc/x86_64-linux-gnu/12/include/avx512vlintrin.h:11665:   return (__m128i) __builtin_ia32_prord128_mask ((__v4si) __A, __B,
+	.loc 2 11665 20 view .LVU202
+	vprord	$7, %xmm1, %xmm1	#, tmp988, tmp987
+.LVL37:
+	.loc 2 11665 20 view .LVU203
+.LBE1855:
+.LBE1863:
+	.loc 1 82 10 is_stmt 1 view .LVU204
+	.loc 1 82 377 view .LVU205
+.LBB1864:
+.LBI1864:
+	.loc 3 1456 1 view .LVU206
+.LBB1865:
+	.loc 3 1458 3 view .LVU207
+# /usr/lib/gcc/x86_64-linux-gnu/12/include/emmintrin.h:1458:   return (__m128i)__builtin_ia32_pshufd ((__v4si)__A, __mask);
+	.loc 3 1458 19 is_stmt 0 view .LVU208
+	vpshufd	$147, %xmm1, %xmm1	#, tmp987, tmp992
+.LVL38:
+	.loc 3 1458 19 view .LVU209
+.LBE1865:
+.LBE1864:
+	.loc 1 82 7 is_stmt 1 view .LVU210
+.LBB1866:
+.LBI1860:
+	.loc 3 1456 1 view .LVU211
+.LBB1862:
+	.loc 3 1458 3 view .LVU212
+	.loc 3 1458 3 is_stmt 0 view .LVU213
+.LBE1862:
+.LBE1866:
+	.loc 1 82 7 is_stmt 1 view .LVU214
+.LBB1867:
+.LBI1856:
+	.loc 3 1456 1 view .LVU215
+.LBB1858:
+	.loc 3 1458 3 view .LVU216
+	.loc 3 1458 3 is_stmt 0 view .LVU217
+.LBE1858:
+.LBE1867:
+.LBE2018:
+	.loc 1 82 8 is_stmt 1 view .LVU218
+	.loc 1 83 5 view .LVU219
+.LBB2019:
+	.loc 1 83 10 view .LVU220
+	.loc 1 83 26 view .LVU221
+.LBB1892:
+.LBI1881:
+	.loc 2 6674 1 view .LVU222
+.LBB1884:
+	.loc 2 6676 3 view .LVU223
+	.loc 2 6676 3 is_stmt 0 view .LVU224
+.LBE1884:
+.LBE1892:
+	.loc 1 83 127 is_stmt 1 view .LVU225
+.LBB1893:
+.LBI1870:
+	.loc 2 6674 1 view .LVU226
+.LBB1873:
+	.loc 2 6676 3 view .LVU227
+	.loc 2 6676 3 is_stmt 0 view .LVU228
+.LBE1873:
+.LBE1893:
+	.loc 1 83 228 is_stmt 1 view .LVU229
+.LBB1894:
+.LBI1886:
+	.loc 4 1467 1 view .LVU230
+.LBB1888:
+	.loc 4 1469 3 view .LVU231
+	.loc 4 1469 3 is_stmt 0 view .LVU232
+.LBE1888:
+.LBE1894:
+	.loc 1 83 261 is_stmt 1 view .LVU233
+.LBB1895:
+.LBI1889:
+	.loc 5 1096 1 view .LVU234
+.LBB1891:
+	.loc 5 1098 3 view .LVU235
+	.loc 5 1098 3 is_stmt 0 view .LVU236
+.LBE1891:
+.LBE1895:
+	.loc 1 83 299 is_stmt 1 view .LVU237
+.LBB1896:
+.LBI1875:
+	.loc 4 1467 1 view .LVU238
+.LBB1877:
+	.loc 4 1469 3 view .LVU239
+	.loc 4 1469 3 is_stmt 0 view .LVU240
+.LBE1877:
+.LBE1896:
+	.loc 1 83 332 is_stmt 1 view .LVU241
+.LBB1897:
+.LBI1878:
+	.loc 5 1096 1 view .LVU242
+.LBB1880:
+	.loc 5 1098 3 view .LVU243
+	.loc 5 1098 3 is_stmt 0 view .LVU244
+.LBE1880:
+.LBE1897:
+	.loc 1 83 370 is_stmt 1 view .LVU245
+	.loc 1 83 375 view .LVU246
+.LBB1898:
+.LBI1898:
+	.loc 3 1064 1 view .LVU247
+.LBB1899:
+	.loc 3 1066 3 view .LVU248
+	.loc 3 1066 3 is_stmt 0 view .LVU249
+.LBE1899:
+.LBE1898:
+.LBB1900:
+.LBI1900:
+	.loc 3 1064 1 is_stmt 1 view .LVU250
+.LBB1901:
+	.loc 3 1066 3 view .LVU251
+# /usr/lib/gcc/x86_64-linux-gnu/12/include/emmintrin.h:1066:   return (__m128i) ((__v4su)__A + (__v4su)__B);
+	.loc 3 1066 33 is_stmt 0 view .LVU252
+	vpaddd	%xmm7, %xmm1, %xmm7	# tmp1008, tmp992, tmp1016
+	vpaddd	%xmm8, %xmm7, %xmm7	# _74, tmp1016, _102
+.LVL39:
+	.loc 3 1066 33 view .LVU253
+.LBE1901:
+.LBE1900:
+	.loc 1 83 424 is_stmt 1 view .LVU254
+.LBB1902:
+.LBI1902:
+	.loc 3 1327 1 view .LVU255
+.LBB1903:
+	.loc 3 1329 3 view .LVU256
+	.loc 3 1329 3 is_stmt 0 view .LVU257
+.LBE1903:
+.LBE1902:
+.LBB1905:
+.LBI1905:
+	.loc 2 11663 1 is_stmt 1 view .LVU258
+.LBB1906:
+	.loc 2 11665 3 view .LVU259
+.LBE1906:
+.LBE1905:
+.LBE2019:
+.LBB2020:
+.LBB2021:
+.LBB2022:
+# /usr/lib/gcc/x86_64-linux-gnu/12/include/avx512vlintrin.h:6676:   return (__m256i) __builtin_ia32_vpermt2vard256_mask ((__v8si) __I
+	.loc 2 6676 20 is_stmt 0 view .LVU260
+	vmovdqa	.LC6(%rip), %ymm8	#, tmp1078
+.LBE2022:
+.LBE2021:
+.LBE2020:
+.LBB2161:
+.LBB1908:
+.LBB1904:
+# /usr/lib/gcc/x86_64-linux-gnu/12/include/emmintrin.h:1329:   return (__m128i) ((__v2du)__A ^ (__v2du)__B);
+	.loc 3 1329 33 view .LVU261
+	vpxor	%xmm7, %xmm0, %xmm0	# _102, tmp996, tmp1018
+.LVL40:
+	.loc 3 1329 33 view .LVU262
+.LBE1904:
+.LBE1908:
+.LBB1909:
+.LBB1907:
+# /usr/lib/gcc/x86_64-linux-gnu/12/include/avx512vlintrin.h:11665:   return (__m128i) __builtin_ia32_prord128_mask ((__v4si) __A, __B,
+	.loc 2 11665 20 view .LVU263
+	vprold	$16, %xmm0, %xmm0	#, tmp1018, tmp1017
+.LVL41:
+	.loc 2 11665 20 view .LVU264
+.LBE1907:
+.LBE1909:
+	.loc 1 83 473 is_stmt 1 view .LVU265
+.LBB1910:
+.LBI1910:
+	.loc 3 1064 1 view .LVU266
+.LBB1911:
+	.loc 3 1066 3 view .LVU267
+.LBE1911:
+.LBE1910:
+.LBE2161:
+.LBB2162:
+.LBB2025:
+.LBB2023:
+# /usr/lib/gcc/x86_64-linux-gnu/12/include/avx512vlintrin.h:6676:   return (__m256i) __builtin_ia32_vpermt2vard256_mask ((__v8si) __I
+	.loc 2 6676 20 is_stmt 0 view .LVU268
+	vpermi2d	%ymm4, %ymm3, %ymm8	# mhi, mlo, tmp1077
+.LBE2023:
+.LBE2025:
+.LBE2162:
+.LBB2163:
+.LBB1913:
+.LBB1912:
+# /usr/lib/gcc/x86_64-linux-gnu/12/include/emmintrin.h:1066:   return (__m128i) ((__v4su)__A + (__v4su)__B);
+	.loc 3 1066 33 view .LVU269
+	vpaddd	%xmm0, %xmm2, %xmm2	# tmp1017, tmp994, _110
+.LVL42:
+	.loc 3 1066 33 view .LVU270
+.LBE1912:
+.LBE1913:
+	.loc 1 83 503 is_stmt 1 view .LVU271
+.LBB1914:
+.LBI1914:
+	.loc 3 1327 1 view .LVU272
+.LBB1915:
+	.loc 3 1329 3 view .LVU273
+	.loc 3 1329 3 is_stmt 0 view .LVU274
+.LBE1915:
+.LBE1914:
+.LBB1917:
+.LBI1917:
+	.loc 2 11663 1 is_stmt 1 view .LVU275
+.LBB1918:
+	.loc 2 11665 3 view .LVU276
+.LBE1918:
+.LBE1917:
+.LBB1920:
+.LBB1916:
+# /usr/lib/gcc/x86_64-linux-gnu/12/include/emmintrin.h:1329:   return (__m128i) ((__v2du)__A ^ (__v2du)__B);
+	.loc 3 1329 33 is_stmt 0 view .LVU277
+	vpxor	%xmm2, %xmm1, %xmm1	# _110, tmp992, tmp1023
+.LVL43:
+	.loc 3 1329 33 view .LVU278
+.LBE1916:
+.LBE1920:
+.LBB1921:
+.LBB1919:
+# /usr/lib/gcc/x86_64-linux-gnu/12/include/avx512vlintrin.h:11665:   return (__m128i) __builtin_ia32_prord128_mask ((__v4si) __A, __B,
+	.loc 2 11665 20 view .LVU279
+	vprord	$12, %xmm1, %xmm1	#, tmp1023, tmp1022
+.LVL44:
+	.loc 2 11665 20 view .LVU280
+.LBE1919:
+.LBE1921:
+	.loc 1 83 552 is_stmt 1 view .LVU281
+.LBB1922:
+.LBI1922:
+	.loc 3 1064 1 view .LVU282
+.LBB1923:
+	.loc 3 1066 3 view .LVU283
+	.loc 3 1066 3 is_stmt 0 view .LVU284
+.LBE1923:
+.LBE1922:
+.LBB1924:
+.LBI1924:
+	.loc 3 1064 1 is_stmt 1 view .LVU285
+.LBB1925:
+	.loc 3 1066 3 view .LVU286
+# /usr/lib/gcc/x86_64-linux-gnu/12/include/emmintrin.h:1066:   return (__m128i) ((__v4su)__A + (__v4su)__B);
+	.loc 3 1066 33 is_stmt 0 view .LVU287
+	vpaddd	%xmm5, %xmm1, %xmm5	# tmp1010, tmp1022, tmp1027
+.LVL45:
+	.loc 3 1066 33 view .LVU288
+	vpaddd	%xmm7, %xmm5, %xmm5	# _102, tmp1027, _119
+.LVL46:
+	.loc 3 1066 33 view .LVU289
+.LBE1925:
+.LBE1924:
+	.loc 1 83 601 is_stmt 1 view .LVU290
+.LBB1926:
+.LBI1926:
+	.loc 3 1327 1 view .LVU291
+.LBB1927:
+	.loc 3 1329 3 view .LVU292
+	.loc 3 1329 3 is_stmt 0 view .LVU293
+.LBE1927:
+.LBE1926:
+.LBB1929:
+.LBI1929:
+	.loc 2 11663 1 is_stmt 1 view .LVU294
+.LBB1930:
+	.loc 2 11665 3 view .LVU295
+.LBE1930:
+.LBE1929:
+.LBB1932:
+.LBB1928:
+# /usr/lib/gcc/x86_64-linux-gnu/12/include/emmintrin.h:1329:   return (__m128i) ((__v2du)__A ^ (__v2du)__B);
+	.loc 3 1329 33 is_stmt 0 view .LVU296
+	vpxor	%xmm5, %xmm0, %xmm0	# _119, tmp1017, tmp1029
+.LVL47:
+	.loc 3 1329 33 view .LVU297
+.LBE1928:
+.LBE1932:
+.LBB1933:
+.LBB1931:
+# /usr/lib/gcc/x86_64-linux-gnu/12/include/avx512vlintrin.h:11665:   return (__m128i) __builtin_ia32_prord128_mask ((__v4si) __A, __B,
+	.loc 2 11665 20 view .LVU298
+	vprord	$8, %xmm0, %xmm0	#, tmp1029, tmp1028
+.LVL48:
+	.loc 2 11665 20 view .LVU299
+.LBE1931:
+.LBE1933:
+	.loc 1 83 649 is_stmt 1 view .LVU300
+.LBB1934:
+.LBI1934:
+	.loc 3 1064 1 view .LVU301
+.LBB1935:
+	.loc 3 1066 3 view .LVU302
+# /usr/lib/gcc/x86_64-linux-gnu/12/include/emmintrin.h:1066:   return (__m128i) ((__v4su)__A + (__v4su)__B);
+	.loc 3 1066 33 is_stmt 0 view .LVU303
+	vpaddd	%xmm2, %xmm0, %xmm2	# _110, tmp1028, _126
+.LVL49:
+	.loc 3 1066 33 view .LVU304
+.LBE1935:
+.LBE1934:
+	.loc 1 83 679 is_stmt 1 view .LVU305
+.LBB1936:
+.LBI1936:
+	.loc 3 1327 1 view .LVU306
+.LBB1937:
+	.loc 3 1329 3 view .LVU307
+	.loc 3 1329 3 is_stmt 0 view .LVU308
+.LBE1937:
+.LBE1936:
+.LBB1939:
+.LBI1939:
+	.loc 2 11663 1 is_stmt 1 view .LVU309
+.LBB1940:
+	.loc 2 11665 3 view .LVU310
+.LBE1940:
+.LBE1939:
+.LBB1942:
+.LBB1943:
+# /usr/lib/gcc/x86_64-linux-gnu/12/include/emmintrin.h:1458:   return (__m128i)__builtin_ia32_pshufd ((__v4si)__A, __mask);
+	.loc 3 1458 19 is_stmt 0 view .LVU311
+	vpshufd	$147, %xmm0, %xmm0	#, tmp1028, tmp1042
+.LVL50:
+	.loc 3 1458 19 view .LVU312
+.LBE1943:
+.LBE1942:
+.LBB1945:
+.LBB1938:
+# /usr/lib/gcc/x86_64-linux-gnu/12/include/emmintrin.h:1329:   return (__m128i) ((__v2du)__A ^ (__v2du)__B);
+	.loc 3 1329 33 view .LVU313
+	vpxor	%xmm2, %xmm1, %xmm1	# _126, tmp1022, tmp1034
+.LVL51:
+	.loc 3 1329 33 view .LVU314
+.LBE1938:
+.LBE1945:
+.LBB1946:
+.LBB1947:
+# /usr/lib/gcc/x86_64-linux-gnu/12/include/emmintrin.h:1458:   return (__m128i)__builtin_ia32_pshufd ((__v4si)__A, __mask);
+	.loc 3 1458 19 view .LVU315
+	vpshufd	$78, %xmm2, %xmm2	#, _126, tmp1040
+.LVL52:
+	.loc 3 1458 19 view .LVU316
+.LBE1947:
+.LBE1946:
+.LBB1949:
+.LBB1941:
+# /usr/lib/gcc/x86_64-linux-gnu/12/include/avx512vlintrin.h:11665:   return (__m128i) __builtin_ia32_prord128_mask ((__v4si) __A, __B,
+	.loc 2 11665 20 view .LVU317
+	vprord	$7, %xmm1, %xmm1	#, tmp1034, tmp1033
+.LVL53:
+	.loc 2 11665 20 view .LVU318
+.LBE1941:
+.LBE1949:
+	.loc 1 83 373 is_stmt 1 view .LVU319
+	.loc 1 83 740 view .LVU320
+.LBB1950:
+.LBI1950:
+	.loc 3 1456 1 view .LVU321
+.LBB1951:
+	.loc 3 1458 3 view .LVU322
+# /usr/lib/gcc/x86_64-linux-gnu/12/include/emmintrin.h:1458:   return (__m128i)__builtin_ia32_pshufd ((__v4si)__A, __mask);
+	.loc 3 1458 19 is_stmt 0 view .LVU323
+	vpshufd	$57, %xmm1, %xmm1	#, tmp1033, tmp1038
+.LVL54:
+	.loc 3 1458 19 view .LVU324
+.LBE1951:
+.LBE1950:
+	.loc 1 83 7 is_stmt 1 view .LVU325
+.LBB1952:
+.LBI1946:
+	.loc 3 1456 1 view .LVU326
+.LBB1948:
+	.loc 3 1458 3 view .LVU327
+	.loc 3 1458 3 is_stmt 0 view .LVU328
+.LBE1948:
+.LBE1952:
+	.loc 1 83 7 is_stmt 1 view .LVU329
+.LBB1953:
+.LBI1942:
+	.loc 3 1456 1 view .LVU330
+.LBB1944:
+	.loc 3 1458 3 view .LVU331
+	.loc 3 1458 3 is_stmt 0 view .LVU332
+.LBE1944:
+.LBE1953:
+	.loc 1 83 7 is_stmt 1 view .LVU333
+	.loc 1 83 12 view .LVU334
+.LBB1954:
+.LBI1954:
+	.loc 3 1064 1 view .LVU335
+.LBB1955:
+	.loc 3 1066 3 view .LVU336
+	.loc 3 1066 3 is_stmt 0 view .LVU337
+.LBE1955:
+.LBE1954:
+.LBB1956:
+.LBI1956:
+	.loc 3 1064 1 is_stmt 1 view .LVU338
+.LBB1957:
+	.loc 3 1066 3 view .LVU339
+# /usr/lib/gcc/x86_64-linux-gnu/12/include/emmintrin.h:1066:   return (__m128i) ((__v4su)__A + (__v4su)__B);
+	.loc 3 1066 33 is_stmt 0 view .LVU340
+	vpaddd	%xmm6, %xmm1, %xmm6	# tmp1012, tmp1038, tmp1044
+	vpaddd	%xmm5, %xmm6, %xmm5	# _119, tmp1044, _139
+.LVL55:
+	.loc 3 1066 33 view .LVU341
+.LBE1957:
+.LBE1956:
+	.loc 1 83 61 is_stmt 1 view .LVU342
+.LBB1958:
+.LBI1958:
+	.loc 3 1327 1 view .LVU343
+.LBB1959:
+	.loc 3 1329 3 view .LVU344
+	.loc 3 1329 3 is_stmt 0 view .LVU345
+.LBE1959:
+.LBE1958:
+.LBB1961:
+.LBI1961:
+	.loc 2 11663 1 is_stmt 1 view .LVU346
+.LBB1962:
+	.loc 2 11665 3 view .LVU347
+.LBE1962:
+.LBE1961:
+.LBE2163:
+.LBB2164:
+.LBB2026:
+.LBB2027:
+# /usr/lib/gcc/x86_64-linux-gnu/12/include/avxintrin.h:1469:   return (__m128i) __builtin_ia32_si_si256 ((__v8si)__A);
+	.loc 4 1469 20 is_stmt 0 view .LVU348
+	vmovdqa	%xmm8, %xmm6	# tmp1077, tmp1086
+.LBE2027:
+.LBE2026:
+.LBB2029:
+.LBB2030:
+# /usr/lib/gcc/x86_64-linux-gnu/12/include/avx2intrin.h:1098:   return (__m128i) __builtin_ia32_extract128i256 ((__v4di)__X, __M);
+	.loc 5 1098 20 view .LVU349
+	vextracti32x4	$0x1, %ymm8, %xmm8	# tmp1077, tmp1088
+.LBE2030:
+.LBE2029:
+.LBE2164:
+.LBB2165:
+.LBB1964:
+.LBB1960:
+# /usr/lib/gcc/x86_64-linux-gnu/12/include/emmintrin.h:1329:   return (__m128i) ((__v2du)__A ^ (__v2du)__B);
+	.loc 3 1329 33 view .LVU350
+	vpxor	%xmm5, %xmm0, %xmm0	# _139, tmp1042, tmp1046
+.LVL56:
+	.loc 3 1329 33 view .LVU351
+.LBE1960:
+.LBE1964:
+.LBB1965:
+.LBB1963:
+# /usr/lib/gcc/x86_64-linux-gnu/12/include/avx512vlintrin.h:11665:   return (__m128i) __builtin_ia32_prord128_mask ((__v4si) __A, __B,
+	.loc 2 11665 20 view .LVU352
+	vprold	$16, %xmm0, %xmm0	#, tmp1046, tmp1045
+.LVL57:
+	.loc 2 11665 20 view .LVU353
+.LBE1963:
+.LBE1965:
+	.loc 1 83 110 is_stmt 1 view .LVU354
+.LBB1966:
+.LBI1966:
+	.loc 3 1064 1 view .LVU355
+.LBB1967:
+	.loc 3 1066 3 view .LVU356
+# /usr/lib/gcc/x86_64-linux-gnu/12/include/emmintrin.h:1066:   return (__m128i) ((__v4su)__A + (__v4su)__B);
+	.loc 3 1066 33 is_stmt 0 view .LVU357
+	vpaddd	%xmm0, %xmm2, %xmm2	# tmp1045, tmp1040, _147
+.LVL58:
+	.loc 3 1066 33 view .LVU358
+.LBE1967:
+.LBE1966:
+	.loc 1 83 140 is_stmt 1 view .LVU359
+.LBB1968:
+.LBI1968:
+	.loc 3 1327 1 view .LVU360
+.LBB1969:
+	.loc 3 1329 3 view .LVU361
+	.loc 3 1329 3 is_stmt 0 view .LVU362
+.LBE1969:
+.LBE1968:
+.LBB1971:
+.LBI1971:
+	.loc 2 11663 1 is_stmt 1 view .LVU363
+.LBB1972:
+	.loc 2 11665 3 view .LVU364
+.LBE1972:
+.LBE1971:
+.LBB1974:
+.LBB1970:
+# /usr/lib/gcc/x86_64-linux-gnu/12/include/emmintrin.h:1329:   return (__m128i) ((__v2du)__A ^ (__v2du)__B);
+	.loc 3 1329 33 is_stmt 0 view .LVU365
+	vpxor	%xmm2, %xmm1, %xmm1	# _147, tmp1038, tmp1051
+.LVL59:
+	.loc 3 1329 33 view .LVU366
+.LBE1970:
+.LBE1974:
+.LBB1975:
+.LBB1973:
+# /usr/lib/gcc/x86_64-linux-gnu/12/include/avx512vlintrin.h:11665:   return (__m128i) __builtin_ia32_prord128_mask ((__v4si) __A, __B,
+	.loc 2 11665 20 view .LVU367
+	vprord	$12, %xmm1, %xmm1	#, tmp1051, tmp1050
+.LVL60:
+	.loc 2 11665 20 view .LVU368
+.LBE1973:
+.LBE1975:
+	.loc 1 83 189 is_stmt 1 view .LVU369
+.LBB1976:
+.LBI1976:
+	.loc 3 1064 1 view .LVU370
+.LBB1977:
+	.loc 3 1066 3 view .LVU371
+	.loc 3 1066 3 is_stmt 0 view .LVU372
+.LBE1977:
+.LBE1976:
+.LBB1978:
+.LBI1978:
+	.loc 3 1064 1 is_stmt 1 view .LVU373
+.LBB1979:
+	.loc 3 1066 3 view .LVU374
+# /usr/lib/gcc/x86_64-linux-gnu/12/include/emmintrin.h:1066:   return (__m128i) ((__v4su)__A + (__v4su)__B);
+	.loc 3 1066 33 is_stmt 0 view .LVU375
+	vpaddd	%xmm9, %xmm1, %xmm9	# tmp1014, tmp1050, tmp1055
+.LVL61:
+	.loc 3 1066 33 view .LVU376
+	vpaddd	%xmm5, %xmm9, %xmm9	# _139, tmp1055, _156
+.LVL62:
+	.loc 3 1066 33 view .LVU377
+.LBE1979:
+.LBE1978:
+	.loc 1 83 238 is_stmt 1 view .LVU378
+.LBB1980:
+.LBI1980:
+	.loc 3 1327 1 view .LVU379
+.LBB1981:
+	.loc 3 1329 3 view .LVU380
+	.loc 3 1329 3 is_stmt 0 view .LVU381
+.LBE1981:
+.LBE1980:
+.LBB1983:
+.LBI1983:
+	.loc 2 11663 1 is_stmt 1 view .LVU382
+.LBB1984:
+	.loc 2 11665 3 view .LVU383
+.LBE1984:
+.LBE1983:
+.LBE2165:
+.LBB2166:
+.LBB2032:
+.LBB2033:
+# /usr/lib/gcc/x86_64-linux-gnu/12/include/avx512vlintrin.h:6676:   return (__m256i) __builtin_ia32_vpermt2vard256_mask ((__v8si) __I
+	.loc 2 6676 20 is_stmt 0 view .LVU384
+	vmovdqa	.LC5(%rip), %ymm5	#, tmp1073
+.LBE2033:
+.LBE2032:
+.LBE2166:
+.LBB2167:
+.LBB1986:
+.LBB1982:
+# /usr/lib/gcc/x86_64-linux-gnu/12/include/emmintrin.h:1329:   return (__m128i) ((__v2du)__A ^ (__v2du)__B);
+	.loc 3 1329 33 view .LVU385
+	vpxor	%xmm9, %xmm0, %xmm0	# _156, tmp1045, tmp1057
+.LVL63:
+	.loc 3 1329 33 view .LVU386
+.LBE1982:
+.LBE1986:
+.LBB1987:
+.LBB1985:
+# /usr/lib/gcc/x86_64-linux-gnu/12/include/avx512vlintrin.h:11665:   return (__m128i) __builtin_ia32_prord128_mask ((__v4si) __A, __B,
+	.loc 2 11665 20 view .LVU387
+	vprord	$8, %xmm0, %xmm0	#, tmp1057, tmp1056
+.LVL64:
+	.loc 2 11665 20 view .LVU388
+.LBE1985:
+.LBE1987:
+	.loc 1 83 286 is_stmt 1 view .LVU389
+.LBB1988:
+.LBI1988:
+	.loc 3 1064 1 view .LVU390
+.LBB1989:
+	.loc 3 1066 3 view .LVU391
+.LBE1989:
+.LBE1988:
+.LBE2167:
+.LBB2168:
+.LBB2036:
+.LBB2034:
+# /usr/lib/gcc/x86_64-linux-gnu/12/include/avx512vlintrin.h:6676:   return (__m256i) __builtin_ia32_vpermt2vard256_mask ((__v8si) __I
+	.loc 2 6676 20 is_stmt 0 view .LVU392
+	vpermi2d	%ymm4, %ymm3, %ymm5	# mhi, mlo, tmp1072
+.LBE2034:
+.LBE2036:
+.LBB2037:
+.LBB2038:
+# /usr/lib/gcc/x86_64-linux-gnu/12/include/avxintrin.h:1469:   return (__m128i) __builtin_ia32_si_si256 ((__v8si)__A);
+	.loc 4 1469 20 view .LVU393
+	vmovdqa	%xmm5, %xmm7	# tmp1072, tmp1082
+.LBE2038:
+.LBE2037:
+.LBB2040:
+.LBB2041:
+# /usr/lib/gcc/x86_64-linux-gnu/12/include/avx2intrin.h:1098:   return (__m128i) __builtin_ia32_extract128i256 ((__v4di)__X, __M);
+	.loc 5 1098 20 view .LVU394
+	vextracti32x4	$0x1, %ymm5, %xmm5	# tmp1072, tmp1084
+.LBE2041:
+.LBE2040:
+.LBE2168:
+.LBB2169:
+.LBB1991:
+.LBB1990:
+# /usr/lib/gcc/x86_64-linux-gnu/12/include/emmintrin.h:1066:   return (__m128i) ((__v4su)__A + (__v4su)__B);
+	.loc 3 1066 33 view .LVU395
+	vpaddd	%xmm2, %xmm0, %xmm2	# _147, tmp1056, _163
+.LVL65:
+	.loc 3 1066 33 view .LVU396
+.LBE1990:
+.LBE1991:
+	.loc 1 83 316 is_stmt 1 view .LVU397
+.LBB1992:
+.LBI1992:
+	.loc 3 1327 1 view .LVU398
+.LBB1993:
+	.loc 3 1329 3 view .LVU399
+	.loc 3 1329 3 is_stmt 0 view .LVU400
+.LBE1993:
+.LBE1992:
+.LBB1995:
+.LBI1995:
+	.loc 2 11663 1 is_stmt 1 view .LVU401
+.LBB1996:
+	.loc 2 11665 3 view .LVU402
+.LBE1996:
+.LBE1995:
+.LBB1998:
+.LBB1999:
+# /usr/lib/gcc/x86_64-linux-gnu/12/include/emmintrin.h:1458:   return (__m128i)__builtin_ia32_pshufd ((__v4si)__A, __mask);
+	.loc 3 1458 19 is_stmt 0 view .LVU403
+	vpshufd	$57, %xmm0, %xmm0	#, tmp1056, tmp1070
+.LVL66:
+	.loc 3 1458 19 view .LVU404
+.LBE1999:
+.LBE1998:
+.LBB2001:
+.LBB1994:
+# /usr/lib/gcc/x86_64-linux-gnu/12/include/emmintrin.h:1329:   return (__m128i) ((__v2du)__A ^ (__v2du)__B);
+	.loc 3 1329 33 view .LVU405
+	vpxor	%xmm2, %xmm1, %xmm1	# _163, tmp1050, tmp1062
+.LVL67:
+	.loc 3 1329 33 view .LVU406
+.LBE1994:
+.LBE2001:
+.LBB2002:
+.LBB2003:
+# /usr/lib/gcc/x86_64-linux-gnu/12/include/emmintrin.h:1458:   return (__m128i)__builtin_ia32_pshufd ((__v4si)__A, __mask);
+	.loc 3 1458 19 view .LVU407
+	vpshufd	$78, %xmm2, %xmm2	#, _163, tmp1068
+.LVL68:
+	.loc 3 1458 19 view .LVU408
+.LBE2003:
+.LBE2002:
+.LBB2005:
+.LBB1997:
+# /usr/lib/gcc/x86_64-linux-gnu/12/include/avx512vlintrin.h:11665:   return (__m128i) __builtin_ia32_prord128_mask ((__v4si) __A, __B,
+	.loc 2 11665 20 view .LVU409
+	vprord	$7, %xmm1, %xmm1	#, tmp1062, tmp1061
+.LVL69:
+	.loc 2 11665 20 view .LVU410
+.LBE1997:
+.LBE2005:
+	.loc 1 83 10 is_stmt 1 view .LVU411
+	.loc 1 83 377 view .LVU412
+.LBB2006:
+.LBI2006:
+	.loc 3 1456 1 view .LVU413
+.LBB2007:
+	.loc 3 1458 3 view .LVU414
+# /usr/lib/gcc/x86_64-linux-gnu/12/include/emmintrin.h:1458:   return (__m128i)__builtin_ia32_pshufd ((__v4si)__A, __mask);
+	.loc 3 1458 19 is_stmt 0 view .LVU415
+	vpshufd	$147, %xmm1, %xmm1	#, tmp1061, tmp1066
+.LVL70:
+	.loc 3 1458 19 view .LVU416
+.LBE2007:
+.LBE2006:
+	.loc 1 83 7 is_stmt 1 view .LVU417
+.LBB2008:
+.LBI2002:
+	.loc 3 1456 1 view .LVU418
+.LBB2004:
+	.loc 3 1458 3 view .LVU419
+	.loc 3 1458 3 is_stmt 0 view .LVU420
+.LBE2004:
+.LBE2008:
+	.loc 1 83 7 is_stmt 1 view .LVU421
+.LBB2009:
+.LBI1998:
+	.loc 3 1456 1 view .LVU422
+.LBB2000:
+	.loc 3 1458 3 view .LVU423
+	.loc 3 1458 3 is_stmt 0 view .LVU424
+.LBE2000:
+.LBE2009:
+.LBE2169:
+	.loc 1 83 8 is_stmt 1 view .LVU425
+	.loc 1 84 5 view .LVU426
+.LBB2170:
+	.loc 1 84 10 view .LVU427
+	.loc 1 84 26 view .LVU428
+.LBB2043:
+.LBI2032:
+	.loc 2 6674 1 view .LVU429
+.LBB2035:
+	.loc 2 6676 3 view .LVU430
+	.loc 2 6676 3 is_stmt 0 view .LVU431
+.LBE2035:
+.LBE2043:
+	.loc 1 84 127 is_stmt 1 view .LVU432
+.LBB2044:
+.LBI2021:
+	.loc 2 6674 1 view .LVU433
+.LBB2024:
+	.loc 2 6676 3 view .LVU434
+	.loc 2 6676 3 is_stmt 0 view .LVU435
+.LBE2024:
+.LBE2044:
+	.loc 1 84 228 is_stmt 1 view .LVU436
+.LBB2045:
+.LBI2037:
+	.loc 4 1467 1 view .LVU437
+.LBB2039:
+	.loc 4 1469 3 view .LVU438
+	.loc 4 1469 3 is_stmt 0 view .LVU439
+.LBE2039:
+.LBE2045:
+	.loc 1 84 261 is_stmt 1 view .LVU440
+.LBB2046:
+.LBI2040:
+	.loc 5 1096 1 view .LVU441
+.LBB2042:
+	.loc 5 1098 3 view .LVU442
+	.loc 5 1098 3 is_stmt 0 view .LVU443
+.LBE2042:
+.LBE2046:
+	.loc 1 84 299 is_stmt 1 view .LVU444
+.LBB2047:
+.LBI2026:
+	.loc 4 1467 1 view .LVU445
+.LBB2028:
+	.loc 4 1469 3 view .LVU446
+	.loc 4 1469 3 is_stmt 0 view .LVU447
+.LBE2028:
+.LBE2047:
+	.loc 1 84 332 is_stmt 1 view .LVU448
+.LBB2048:
+.LBI2029:
+	.loc 5 1096 1 view .LVU449
+.LBB2031:
+	.loc 5 1098 3 view .LVU450
+	.loc 5 1098 3 is_stmt 0 view .LVU451
+.LBE2031:
+.LBE2048:
+	.loc 1 84 370 is_stmt 1 view .LVU452
+	.loc 1 84 375 view .LVU453
+.LBB2049:
+.LBI2049:
+	.loc 3 1064 1 view .LVU454
+.LBB2050:
+	.loc 3 1066 3 view .LVU455
+	.loc 3 1066 3 is_stmt 0 view .LVU456
+.LBE2050:
+.LBE2049:
+.LBB2051:
+.LBI2051:
+	.loc 3 1064 1 is_stmt 1 view .LVU457
+.LBB2052:
+	.loc 3 1066 3 view .LVU458
+# /usr/lib/gcc/x86_64-linux-gnu/12/include/emmintrin.h:1066:   return (__m128i) ((__v4su)__A + (__v4su)__B);
+	.loc 3 1066 33 is_stmt 0 view .LVU459
+	vpaddd	%xmm7, %xmm1, %xmm7	# tmp1082, tmp1066, tmp1090
+	vpaddd	%xmm9, %xmm7, %xmm7	# _156, tmp1090, _184
+.LVL71:
+	.loc 3 1066 33 view .LVU460
+.LBE2052:
+.LBE2051:
+	.loc 1 84 424 is_stmt 1 view .LVU461
+.LBB2053:
+.LBI2053:
+	.loc 3 1327 1 view .LVU462
+.LBB2054:
+	.loc 3 1329 3 view .LVU463
+	.loc 3 1329 3 is_stmt 0 view .LVU464
+.LBE2054:
+.LBE2053:
+.LBB2056:
+.LBI2056:
+	.loc 2 11663 1 is_stmt 1 view .LVU465
+.LBB2057:
+	.loc 2 11665 3 view .LVU466
+.LBE2057:
+.LBE2056:
+.LBE2170:
+.LBB2171:
+.LBB2172:
+.LBB2173:
+# /usr/lib/gcc/x86_64-linux-gnu/12/include/avx512vlintrin.h:6676:   return (__m256i) __builtin_ia32_vpermt2vard256_mask ((__v8si) __I
+	.loc 2 6676 20 is_stmt 0 view .LVU467
+	vmovdqa	.LC8(%rip), %ymm9	#, tmp1152
+.LBE2173:
+.LBE2172:
+.LBE2171:
+.LBB2312:
+.LBB2059:
+.LBB2055:
+# /usr/lib/gcc/x86_64-linux-gnu/12/include/emmintrin.h:1329:   return (__m128i) ((__v2du)__A ^ (__v2du)__B);
+	.loc 3 1329 33 view .LVU468
+	vpxor	%xmm7, %xmm0, %xmm0	# _184, tmp1070, tmp1092
+.LVL72:
+	.loc 3 1329 33 view .LVU469
+.LBE2055:
+.LBE2059:
+.LBB2060:
+.LBB2058:
+# /usr/lib/gcc/x86_64-linux-gnu/12/include/avx512vlintrin.h:11665:   return (__m128i) __builtin_ia32_prord128_mask ((__v4si) __A, __B,
+	.loc 2 11665 20 view .LVU470
+	vprold	$16, %xmm0, %xmm0	#, tmp1092, tmp1091
+.LVL73:
+	.loc 2 11665 20 view .LVU471
+.LBE2058:
+.LBE2060:
+	.loc 1 84 473 is_stmt 1 view .LVU472
+.LBB2061:
+.LBI2061:
+	.loc 3 1064 1 view .LVU473
+.LBB2062:
+	.loc 3 1066 3 view .LVU474
+.LBE2062:
+.LBE2061:
+.LBE2312:
+.LBB2313:
+.LBB2176:
+.LBB2174:
+# /usr/lib/gcc/x86_64-linux-gnu/12/include/avx512vlintrin.h:6676:   return (__m256i) __builtin_ia32_vpermt2vard256_mask ((__v8si) __I
+	.loc 2 6676 20 is_stmt 0 view .LVU475
+	vpermi2d	%ymm4, %ymm3, %ymm9	# mhi, mlo, tmp1151
+.LBE2174:
+.LBE2176:
+.LBE2313:
+.LBB2314:
+.LBB2064:
+.LBB2063:
+# /usr/lib/gcc/x86_64-linux-gnu/12/include/emmintrin.h:1066:   return (__m128i) ((__v4su)__A + (__v4su)__B);
+	.loc 3 1066 33 view .LVU476
+	vpaddd	%xmm0, %xmm2, %xmm2	# tmp1091, tmp1068, _192
+.LVL74:
+	.loc 3 1066 33 view .LVU477
+.LBE2063:
+.LBE2064:
+	.loc 1 84 503 is_stmt 1 view .LVU478
+.LBB2065:
+.LBI2065:
+	.loc 3 1327 1 view .LVU479
+.LBB2066:
+	.loc 3 1329 3 view .LVU480
+	.loc 3 1329 3 is_stmt 0 view .LVU481
+.LBE2066:
+.LBE2065:
+.LBB2068:
+.LBI2068:
+	.loc 2 11663 1 is_stmt 1 view .LVU482
+.LBB2069:
+	.loc 2 11665 3 view .LVU483
+.LBE2069:
+.LBE2068:
+.LBB2071:
+.LBB2067:
+# /usr/lib/gcc/x86_64-linux-gnu/12/include/emmintrin.h:1329:   return (__m128i) ((__v2du)__A ^ (__v2du)__B);
+	.loc 3 1329 33 is_stmt 0 view .LVU484
+	vpxor	%xmm2, %xmm1, %xmm1	# _192, tmp1066, tmp1097
+.LVL75:
+	.loc 3 1329 33 view .LVU485
+.LBE2067:
+.LBE2071:
+.LBB2072:
+.LBB2070:
+# /usr/lib/gcc/x86_64-linux-gnu/12/include/avx512vlintrin.h:11665:   return (__m128i) __builtin_ia32_prord128_mask ((__v4si) __A, __B,
+	.loc 2 11665 20 view .LVU486
+	vprord	$12, %xmm1, %xmm1	#, tmp1097, tmp1096
+.LVL76:
+	.loc 2 11665 20 view .LVU487
+.LBE2070:
+.LBE2072:
+	.loc 1 84 552 is_stmt 1 view .LVU488
+.LBB2073:
+.LBI2073:
+	.loc 3 1064 1 view .LVU489
+.LBB2074:
+	.loc 3 1066 3 view .LVU490
+	.loc 3 1066 3 is_stmt 0 view .LVU491
+.LBE2074:
+.LBE2073:
+.LBB2075:
+.LBI2075:
+	.loc 3 1064 1 is_stmt 1 view .LVU492
+.LBB2076:
+	.loc 3 1066 3 view .LVU493
+# /usr/lib/gcc/x86_64-linux-gnu/12/include/emmintrin.h:1066:   return (__m128i) ((__v4su)__A + (__v4su)__B);
+	.loc 3 1066 33 is_stmt 0 view .LVU494
+	vpaddd	%xmm5, %xmm1, %xmm5	# tmp1084, tmp1096, tmp1101
+.LVL77:
+	.loc 3 1066 33 view .LVU495
+	vpaddd	%xmm7, %xmm5, %xmm5	# _184, tmp1101, _201
+.LVL78:
+	.loc 3 1066 33 view .LVU496
+.LBE2076:
+.LBE2075:
+	.loc 1 84 601 is_stmt 1 view .LVU497
+.LBB2077:
+.LBI2077:
+	.loc 3 1327 1 view .LVU498
+.LBB2078:
+	.loc 3 1329 3 view .LVU499
+	.loc 3 1329 3 is_stmt 0 view .LVU500
+.LBE2078:
+.LBE2077:
+.LBB2080:
+.LBI2080:
+	.loc 2 11663 1 is_stmt 1 view .LVU501
+.LBB2081:
+	.loc 2 11665 3 view .LVU502
+.LBE2081:
+.LBE2080:
+.LBB2083:
+.LBB2079:
+# /usr/lib/gcc/x86_64-linux-gnu/12/include/emmintrin.h:1329:   return (__m128i) ((__v2du)__A ^ (__v2du)__B);
+	.loc 3 1329 33 is_stmt 0 view .LVU503
+	vpxor	%xmm5, %xmm0, %xmm0	# _201, tmp1091, tmp1103
+.LVL79:
+	.loc 3 1329 33 view .LVU504
+.LBE2079:
+.LBE2083:
+.LBB2084:
+.LBB2082:
+# /usr/lib/gcc/x86_64-linux-gnu/12/include/avx512vlintrin.h:11665:   return (__m128i) __builtin_ia32_prord128_mask ((__v4si) __A, __B,
+	.loc 2 11665 20 view .LVU505
+	vprord	$8, %xmm0, %xmm0	#, tmp1103, tmp1102
+.LVL80:
+	.loc 2 11665 20 view .LVU506
+.LBE2082:
+.LBE2084:
+	.loc 1 84 649 is_stmt 1 view .LVU507
+.LBB2085:
+.LBI2085:
+	.loc 3 1064 1 view .LVU508
+.LBB2086:
+	.loc 3 1066 3 view .LVU509
+# /usr/lib/gcc/x86_64-linux-gnu/12/include/emmintrin.h:1066:   return (__m128i) ((__v4su)__A + (__v4su)__B);
+	.loc 3 1066 33 is_stmt 0 view .LVU510
+	vpaddd	%xmm2, %xmm0, %xmm2	# _192, tmp1102, _208
+.LVL81:
+	.loc 3 1066 33 view .LVU511
+.LBE2086:
+.LBE2085:
+	.loc 1 84 679 is_stmt 1 view .LVU512
+.LBB2087:
+.LBI2087:
+	.loc 3 1327 1 view .LVU513
+.LBB2088:
+	.loc 3 1329 3 view .LVU514
+	.loc 3 1329 3 is_stmt 0 view .LVU515
+.LBE2088:
+.LBE2087:
+.LBB2090:
+.LBI2090:
+	.loc 2 11663 1 is_stmt 1 view .LVU516
+.LBB2091:
+	.loc 2 11665 3 view .LVU517
+.LBE2091:
+.LBE2090:
+.LBB2093:
+.LBB2094:
+# /usr/lib/gcc/x86_64-linux-gnu/12/include/emmintrin.h:1458:   return (__m128i)__builtin_ia32_pshufd ((__v4si)__A, __mask);
+	.loc 3 1458 19 is_stmt 0 view .LVU518
+	vpshufd	$147, %xmm0, %xmm0	#, tmp1102, tmp1116
+.LVL82:
+	.loc 3 1458 19 view .LVU519
+.LBE2094:
+.LBE2093:
+.LBB2096:
+.LBB2089:
+# /usr/lib/gcc/x86_64-linux-gnu/12/include/emmintrin.h:1329:   return (__m128i) ((__v2du)__A ^ (__v2du)__B);
+	.loc 3 1329 33 view .LVU520
+	vpxor	%xmm2, %xmm1, %xmm1	# _208, tmp1096, tmp1108
+.LVL83:
+	.loc 3 1329 33 view .LVU521
+.LBE2089:
+.LBE2096:
+.LBB2097:
+.LBB2098:
+# /usr/lib/gcc/x86_64-linux-gnu/12/include/emmintrin.h:1458:   return (__m128i)__builtin_ia32_pshufd ((__v4si)__A, __mask);
+	.loc 3 1458 19 view .LVU522
+	vpshufd	$78, %xmm2, %xmm2	#, _208, tmp1114
+.LVL84:
+	.loc 3 1458 19 view .LVU523
+.LBE2098:
+.LBE2097:
+.LBB2100:
+.LBB2092:
+# /usr/lib/gcc/x86_64-linux-gnu/12/include/avx512vlintrin.h:11665:   return (__m128i) __builtin_ia32_prord128_mask ((__v4si) __A, __B,
+	.loc 2 11665 20 view .LVU524
+	vprord	$7, %xmm1, %xmm1	#, tmp1108, tmp1107
+.LVL85:
+	.loc 2 11665 20 view .LVU525
+.LBE2092:
+.LBE2100:
+	.loc 1 84 373 is_stmt 1 view .LVU526
+	.loc 1 84 740 view .LVU527
+.LBB2101:
+.LBI2101:
+	.loc 3 1456 1 view .LVU528
+.LBB2102:
+	.loc 3 1458 3 view .LVU529
+# /usr/lib/gcc/x86_64-linux-gnu/12/include/emmintrin.h:1458:   return (__m128i)__builtin_ia32_pshufd ((__v4si)__A, __mask);
+	.loc 3 1458 19 is_stmt 0 view .LVU530
+	vpshufd	$57, %xmm1, %xmm1	#, tmp1107, tmp1112
+.LVL86:
+	.loc 3 1458 19 view .LVU531
+.LBE2102:
+.LBE2101:
+	.loc 1 84 7 is_stmt 1 view .LVU532
+.LBB2103:
+.LBI2097:
+	.loc 3 1456 1 view .LVU533
+.LBB2099:
+	.loc 3 1458 3 view .LVU534
+	.loc 3 1458 3 is_stmt 0 view .LVU535
+.LBE2099:
+.LBE2103:
+	.loc 1 84 7 is_stmt 1 view .LVU536
+.LBB2104:
+.LBI2093:
+	.loc 3 1456 1 view .LVU537
+.LBB2095:
+	.loc 3 1458 3 view .LVU538
+	.loc 3 1458 3 is_stmt 0 view .LVU539
+.LBE2095:
+.LBE2104:
+	.loc 1 84 7 is_stmt 1 view .LVU540
+	.loc 1 84 12 view .LVU541
+.LBB2105:
+.LBI2105:
+	.loc 3 1064 1 view .LVU542
+.LBB2106:
+	.loc 3 1066 3 view .LVU543
+	.loc 3 1066 3 is_stmt 0 view .LVU544
+.LBE2106:
+.LBE2105:
+.LBB2107:
+.LBI2107:
+	.loc 3 1064 1 is_stmt 1 view .LVU545
+.LBB2108:
+	.loc 3 1066 3 view .LVU546
+# /usr/lib/gcc/x86_64-linux-gnu/12/include/emmintrin.h:1066:   return (__m128i) ((__v4su)__A + (__v4su)__B);
+	.loc 3 1066 33 is_stmt 0 view .LVU547
+	vpaddd	%xmm6, %xmm1, %xmm6	# tmp1086, tmp1112, tmp1118
+	vpaddd	%xmm5, %xmm6, %xmm5	# _201, tmp1118, _221
+.LVL87:
+	.loc 3 1066 33 view .LVU548
+.LBE2108:
+.LBE2107:
+	.loc 1 84 61 is_stmt 1 view .LVU549
+.LBB2109:
+.LBI2109:
+	.loc 3 1327 1 view .LVU550
+.LBB2110:
+	.loc 3 1329 3 view .LVU551
+	.loc 3 1329 3 is_stmt 0 view .LVU552
+.LBE2110:
+.LBE2109:
+.LBB2112:
+.LBI2112:
+	.loc 2 11663 1 is_stmt 1 view .LVU553
+.LBB2113:
+	.loc 2 11665 3 view .LVU554
+.LBE2113:
+.LBE2112:
+.LBE2314:
+.LBB2315:
+.LBB2177:
+.LBB2178:
+# /usr/lib/gcc/x86_64-linux-gnu/12/include/avxintrin.h:1469:   return (__m128i) __builtin_ia32_si_si256 ((__v8si)__A);
+	.loc 4 1469 20 is_stmt 0 view .LVU555
+	vmovdqa	%xmm9, %xmm6	# tmp1151, tmp1160
+.LBE2178:
+.LBE2177:
+.LBB2180:
+.LBB2181:
+# /usr/lib/gcc/x86_64-linux-gnu/12/include/avx2intrin.h:1098:   return (__m128i) __builtin_ia32_extract128i256 ((__v4di)__X, __M);
+	.loc 5 1098 20 view .LVU556
+	vextracti32x4	$0x1, %ymm9, %xmm9	# tmp1151, tmp1162
+.LBE2181:
+.LBE2180:
+.LBE2315:
+.LBB2316:
+.LBB2115:
+.LBB2111:
+# /usr/lib/gcc/x86_64-linux-gnu/12/include/emmintrin.h:1329:   return (__m128i) ((__v2du)__A ^ (__v2du)__B);
+	.loc 3 1329 33 view .LVU557
+	vpxor	%xmm5, %xmm0, %xmm0	# _221, tmp1116, tmp1120
+.LVL88:
+	.loc 3 1329 33 view .LVU558
+.LBE2111:
+.LBE2115:
+.LBB2116:
+.LBB2114:
+# /usr/lib/gcc/x86_64-linux-gnu/12/include/avx512vlintrin.h:11665:   return (__m128i) __builtin_ia32_prord128_mask ((__v4si) __A, __B,
+	.loc 2 11665 20 view .LVU559
+	vprold	$16, %xmm0, %xmm0	#, tmp1120, tmp1119
+.LVL89:
+	.loc 2 11665 20 view .LVU560
+.LBE2114:
+.LBE2116:
+	.loc 1 84 110 is_stmt 1 view .LVU561
+.LBB2117:
+.LBI2117:
+	.loc 3 1064 1 view .LVU562
+.LBB2118:
+	.loc 3 1066 3 view .LVU563
+# /usr/lib/gcc/x86_64-linux-gnu/12/include/emmintrin.h:1066:   return (__m128i) ((__v4su)__A + (__v4su)__B);
+	.loc 3 1066 33 is_stmt 0 view .LVU564
+	vpaddd	%xmm0, %xmm2, %xmm2	# tmp1119, tmp1114, _229
+.LVL90:
+	.loc 3 1066 33 view .LVU565
+.LBE2118:
+.LBE2117:
+	.loc 1 84 140 is_stmt 1 view .LVU566
+.LBB2119:
+.LBI2119:
+	.loc 3 1327 1 view .LVU567
+.LBB2120:
+	.loc 3 1329 3 view .LVU568
+	.loc 3 1329 3 is_stmt 0 view .LVU569
+.LBE2120:
+.LBE2119:
+.LBB2122:
+.LBI2122:
+	.loc 2 11663 1 is_stmt 1 view .LVU570
+.LBB2123:
+	.loc 2 11665 3 view .LVU571
+.LBE2123:
+.LBE2122:
+.LBB2125:
+.LBB2121:
+# /usr/lib/gcc/x86_64-linux-gnu/12/include/emmintrin.h:1329:   return (__m128i) ((__v2du)__A ^ (__v2du)__B);
+	.loc 3 1329 33 is_stmt 0 view .LVU572
+	vpxor	%xmm2, %xmm1, %xmm1	# _229, tmp1112, tmp1125
+.LVL91:
+	.loc 3 1329 33 view .LVU573
+.LBE2121:
+.LBE2125:
+.LBB2126:
+.LBB2124:
+# /usr/lib/gcc/x86_64-linux-gnu/12/include/avx512vlintrin.h:11665:   return (__m128i) __builtin_ia32_prord128_mask ((__v4si) __A, __B,
+	.loc 2 11665 20 view .LVU574
+	vprord	$12, %xmm1, %xmm1	#, tmp1125, tmp1124
+.LVL92:
+	.loc 2 11665 20 view .LVU575
+.LBE2124:
+.LBE2126:
+	.loc 1 84 189 is_stmt 1 view .LVU576
+.LBB2127:
+.LBI2127:
+	.loc 3 1064 1 view .LVU577
+.LBB2128:
+	.loc 3 1066 3 view .LVU578
+	.loc 3 1066 3 is_stmt 0 view .LVU579
+.LBE2128:
+.LBE2127:
+.LBB2129:
+.LBI2129:
+	.loc 3 1064 1 is_stmt 1 view .LVU580
+.LBB2130:
+	.loc 3 1066 3 view .LVU581
+# /usr/lib/gcc/x86_64-linux-gnu/12/include/emmintrin.h:1066:   return (__m128i) ((__v4su)__A + (__v4su)__B);
+	.loc 3 1066 33 is_stmt 0 view .LVU582
+	vpaddd	%xmm8, %xmm1, %xmm8	# tmp1088, tmp1124, tmp1129
+.LVL93:
+	.loc 3 1066 33 view .LVU583
+	vpaddd	%xmm5, %xmm8, %xmm8	# _221, tmp1129, _238
+.LVL94:
+	.loc 3 1066 33 view .LVU584
+.LBE2130:
+.LBE2129:
+	.loc 1 84 238 is_stmt 1 view .LVU585
+.LBB2131:
+.LBI2131:
+	.loc 3 1327 1 view .LVU586
+.LBB2132:
+	.loc 3 1329 3 view .LVU587
+	.loc 3 1329 3 is_stmt 0 view .LVU588
+.LBE2132:
+.LBE2131:
+.LBB2134:
+.LBI2134:
+	.loc 2 11663 1 is_stmt 1 view .LVU589
+.LBB2135:
+	.loc 2 11665 3 view .LVU590
+.LBE2135:
+.LBE2134:
+.LBE2316:
+.LBB2317:
+.LBB2183:
+.LBB2184:
+# /usr/lib/gcc/x86_64-linux-gnu/12/include/avx512vlintrin.h:6676:   return (__m256i) __builtin_ia32_vpermt2vard256_mask ((__v8si) __I
+	.loc 2 6676 20 is_stmt 0 view .LVU591
+	vmovdqa	.LC7(%rip), %ymm5	#, tmp1147
+.LBE2184:
+.LBE2183:
+.LBE2317:
+.LBB2318:
+.LBB2137:
+.LBB2133:
+# /usr/lib/gcc/x86_64-linux-gnu/12/include/emmintrin.h:1329:   return (__m128i) ((__v2du)__A ^ (__v2du)__B);
+	.loc 3 1329 33 view .LVU592
+	vpxor	%xmm8, %xmm0, %xmm0	# _238, tmp1119, tmp1131
+.LVL95:
+	.loc 3 1329 33 view .LVU593
+.LBE2133:
+.LBE2137:
+.LBB2138:
+.LBB2136:
+# /usr/lib/gcc/x86_64-linux-gnu/12/include/avx512vlintrin.h:11665:   return (__m128i) __builtin_ia32_prord128_mask ((__v4si) __A, __B,
+	.loc 2 11665 20 view .LVU594
+	vprord	$8, %xmm0, %xmm0	#, tmp1131, tmp1130
+.LVL96:
+	.loc 2 11665 20 view .LVU595
+.LBE2136:
+.LBE2138:
+	.loc 1 84 286 is_stmt 1 view .LVU596
+.LBB2139:
+.LBI2139:
+	.loc 3 1064 1 view .LVU597
+.LBB2140:
+	.loc 3 1066 3 view .LVU598
+.LBE2140:
+.LBE2139:
+.LBE2318:
+.LBB2319:
+.LBB2187:
+.LBB2185:
+# /usr/lib/gcc/x86_64-linux-gnu/12/include/avx512vlintrin.h:6676:   return (__m256i) __builtin_ia32_vpermt2vard256_mask ((__v8si) __I
+	.loc 2 6676 20 is_stmt 0 view .LVU599
+	vpermi2d	%ymm4, %ymm3, %ymm5	# mhi, mlo, tmp1146
+.LBE2185:
+.LBE2187:
+.LBB2188:
+.LBB2189:
+# /usr/lib/gcc/x86_64-linux-gnu/12/include/avxintrin.h:1469:   return (__m128i) __builtin_ia32_si_si256 ((__v8si)__A);
+	.loc 4 1469 20 view .LVU600
+	vmovdqa	%xmm5, %xmm7	# tmp1146, tmp1156
+.LBE2189:
+.LBE2188:
+.LBB2191:
+.LBB2192:
+# /usr/lib/gcc/x86_64-linux-gnu/12/include/avx2intrin.h:1098:   return (__m128i) __builtin_ia32_extract128i256 ((__v4di)__X, __M);
+	.loc 5 1098 20 view .LVU601
+	vextracti32x4	$0x1, %ymm5, %xmm5	# tmp1146, tmp1158
+.LBE2192:
+.LBE2191:
+.LBE2319:
+.LBB2320:
+.LBB2142:
+.LBB2141:
+# /usr/lib/gcc/x86_64-linux-gnu/12/include/emmintrin.h:1066:   return (__m128i) ((__v4su)__A + (__v4su)__B);
+	.loc 3 1066 33 view .LVU602
+	vpaddd	%xmm2, %xmm0, %xmm2	# _229, tmp1130, _245
+.LVL97:
+	.loc 3 1066 33 view .LVU603
+.LBE2141:
+.LBE2142:
+	.loc 1 84 316 is_stmt 1 view .LVU604
+.LBB2143:
+.LBI2143:
+	.loc 3 1327 1 view .LVU605
+.LBB2144:
+	.loc 3 1329 3 view .LVU606
+	.loc 3 1329 3 is_stmt 0 view .LVU607
+.LBE2144:
+.LBE2143:
+.LBB2146:
+.LBI2146:
+	.loc 2 11663 1 is_stmt 1 view .LVU608
+.LBB2147:
+	.loc 2 11665 3 view .LVU609
+.LBE2147:
+.LBE2146:
+.LBB2149:
+.LBB2150:
+# /usr/lib/gcc/x86_64-linux-gnu/12/include/emmintrin.h:1458:   return (__m128i)__builtin_ia32_pshufd ((__v4si)__A, __mask);
+	.loc 3 1458 19 is_stmt 0 view .LVU610
+	vpshufd	$57, %xmm0, %xmm0	#, tmp1130, tmp1144
+.LVL98:
+	.loc 3 1458 19 view .LVU611
+.LBE2150:
+.LBE2149:
+.LBB2152:
+.LBB2145:
+# /usr/lib/gcc/x86_64-linux-gnu/12/include/emmintrin.h:1329:   return (__m128i) ((__v2du)__A ^ (__v2du)__B);
+	.loc 3 1329 33 view .LVU612
+	vpxor	%xmm2, %xmm1, %xmm1	# _245, tmp1124, tmp1136
+.LVL99:
+	.loc 3 1329 33 view .LVU613
+.LBE2145:
+.LBE2152:
+.LBB2153:
+.LBB2154:
+# /usr/lib/gcc/x86_64-linux-gnu/12/include/emmintrin.h:1458:   return (__m128i)__builtin_ia32_pshufd ((__v4si)__A, __mask);
+	.loc 3 1458 19 view .LVU614
+	vpshufd	$78, %xmm2, %xmm2	#, _245, tmp1142
+.LVL100:
+	.loc 3 1458 19 view .LVU615
+.LBE2154:
+.LBE2153:
+.LBB2156:
+.LBB2148:
+# /usr/lib/gcc/x86_64-linux-gnu/12/include/avx512vlintrin.h:11665:   return (__m128i) __builtin_ia32_prord128_mask ((__v4si) __A, __B,
+	.loc 2 11665 20 view .LVU616
+	vprord	$7, %xmm1, %xmm1	#, tmp1136, tmp1135
+.LVL101:
+	.loc 2 11665 20 view .LVU617
+.LBE2148:
+.LBE2156:
+	.loc 1 84 10 is_stmt 1 view .LVU618
+	.loc 1 84 377 view .LVU619
+.LBB2157:
+.LBI2157:
+	.loc 3 1456 1 view .LVU620
+.LBB2158:
+	.loc 3 1458 3 view .LVU621
+# /usr/lib/gcc/x86_64-linux-gnu/12/include/emmintrin.h:1458:   return (__m128i)__builtin_ia32_pshufd ((__v4si)__A, __mask);
+	.loc 3 1458 19 is_stmt 0 view .LVU622
+	vpshufd	$147, %xmm1, %xmm1	#, tmp1135, tmp1140
+.LVL102:
+	.loc 3 1458 19 view .LVU623
+.LBE2158:
+.LBE2157:
+	.loc 1 84 7 is_stmt 1 view .LVU624
+.LBB2159:
+.LBI2153:
+	.loc 3 1456 1 view .LVU625
+.LBB2155:
+	.loc 3 1458 3 view .LVU626
+	.loc 3 1458 3 is_stmt 0 view .LVU627
+.LBE2155:
+.LBE2159:
+	.loc 1 84 7 is_stmt 1 view .LVU628
+.LBB2160:
+.LBI2149:
+	.loc 3 1456 1 view .LVU629
+.LBB2151:
+	.loc 3 1458 3 view .LVU630
+	.loc 3 1458 3 is_stmt 0 view .LVU631
+.LBE2151:
+.LBE2160:
+.LBE2320:
+	.loc 1 84 8 is_stmt 1 view .LVU632
+	.loc 1 85 5 view .LVU633
+.LBB2321:
+	.loc 1 85 10 view .LVU634
+	.loc 1 85 26 view .LVU635
+.LBB2194:
+.LBI2183:
+	.loc 2 6674 1 view .LVU636
+.LBB2186:
+	.loc 2 6676 3 view .LVU637
+	.loc 2 6676 3 is_stmt 0 view .LVU638
+.LBE2186:
+.LBE2194:
+	.loc 1 85 127 is_stmt 1 view .LVU639
+.LBB2195:
+.LBI2172:
+	.loc 2 6674 1 view .LVU640
+.LBB2175:
+	.loc 2 6676 3 view .LVU641
+	.loc 2 6676 3 is_stmt 0 view .LVU642
+.LBE2175:
+.LBE2195:
+	.loc 1 85 228 is_stmt 1 view .LVU643
+.LBB2196:
+.LBI2188:
+	.loc 4 1467 1 view .LVU644
+.LBB2190:
+	.loc 4 1469 3 view .LVU645
+	.loc 4 1469 3 is_stmt 0 view .LVU646
+.LBE2190:
+.LBE2196:
+	.loc 1 85 261 is_stmt 1 view .LVU647
+.LBB2197:
+.LBI2191:
+	.loc 5 1096 1 view .LVU648
+.LBB2193:
+	.loc 5 1098 3 view .LVU649
+	.loc 5 1098 3 is_stmt 0 view .LVU650
+.LBE2193:
+.LBE2197:
+	.loc 1 85 299 is_stmt 1 view .LVU651
+.LBB2198:
+.LBI2177:
+	.loc 4 1467 1 view .LVU652
+.LBB2179:
+	.loc 4 1469 3 view .LVU653
+	.loc 4 1469 3 is_stmt 0 view .LVU654
+.LBE2179:
+.LBE2198:
+	.loc 1 85 332 is_stmt 1 view .LVU655
+.LBB2199:
+.LBI2180:
+	.loc 5 1096 1 view .LVU656
+.LBB2182:
+	.loc 5 1098 3 view .LVU657
+	.loc 5 1098 3 is_stmt 0 view .LVU658
+.LBE2182:
+.LBE2199:
+	.loc 1 85 370 is_stmt 1 view .LVU659
+	.loc 1 85 375 view .LVU660
+.LBB2200:
+.LBI2200:
+	.loc 3 1064 1 view .LVU661
+.LBB2201:
+	.loc 3 1066 3 view .LVU662
+	.loc 3 1066 3 is_stmt 0 view .LVU663
+.LBE2201:
+.LBE2200:
+.LBB2202:
+.LBI2202:
+	.loc 3 1064 1 is_stmt 1 view .LVU664
+.LBB2203:
+	.loc 3 1066 3 view .LVU665
+# /usr/lib/gcc/x86_64-linux-gnu/12/include/emmintrin.h:1066:   return (__m128i) ((__v4su)__A + (__v4su)__B);
+	.loc 3 1066 33 is_stmt 0 view .LVU666
+	vpaddd	%xmm7, %xmm1, %xmm7	# tmp1156, tmp1140, tmp1164
+	vpaddd	%xmm8, %xmm7, %xmm7	# _238, tmp1164, _266
+.LVL103:
+	.loc 3 1066 33 view .LVU667
+.LBE2203:
+.LBE2202:
+	.loc 1 85 424 is_stmt 1 view .LVU668
+.LBB2204:
+.LBI2204:
+	.loc 3 1327 1 view .LVU669
+.LBB2205:
+	.loc 3 1329 3 view .LVU670
+	.loc 3 1329 3 is_stmt 0 view .LVU671
+.LBE2205:
+.LBE2204:
+.LBB2207:
+.LBI2207:
+	.loc 2 11663 1 is_stmt 1 view .LVU672
+.LBB2208:
+	.loc 2 11665 3 view .LVU673
+.LBE2208:
+.LBE2207:
+.LBE2321:
+.LBB2322:
+.LBB2323:
+.LBB2324:
+# /usr/lib/gcc/x86_64-linux-gnu/12/include/avx512vlintrin.h:6676:   return (__m256i) __builtin_ia32_vpermt2vard256_mask ((__v8si) __I
+	.loc 2 6676 20 is_stmt 0 view .LVU674
+	vmovdqa	.LC10(%rip), %ymm8	#, tmp1226
+.LBE2324:
+.LBE2323:
+.LBE2322:
+.LBB2463:
+.LBB2210:
+.LBB2206:
+# /usr/lib/gcc/x86_64-linux-gnu/12/include/emmintrin.h:1329:   return (__m128i) ((__v2du)__A ^ (__v2du)__B);
+	.loc 3 1329 33 view .LVU675
+	vpxor	%xmm7, %xmm0, %xmm0	# _266, tmp1144, tmp1166
+.LVL104:
+	.loc 3 1329 33 view .LVU676
+.LBE2206:
+.LBE2210:
+.LBB2211:
+.LBB2209:
+# /usr/lib/gcc/x86_64-linux-gnu/12/include/avx512vlintrin.h:11665:   return (__m128i) __builtin_ia32_prord128_mask ((__v4si) __A, __B,
+	.loc 2 11665 20 view .LVU677
+	vprold	$16, %xmm0, %xmm0	#, tmp1166, tmp1165
+.LVL105:
+	.loc 2 11665 20 view .LVU678
+.LBE2209:
+.LBE2211:
+	.loc 1 85 473 is_stmt 1 view .LVU679
+.LBB2212:
+.LBI2212:
+	.loc 3 1064 1 view .LVU680
+.LBB2213:
+	.loc 3 1066 3 view .LVU681
+.LBE2213:
+.LBE2212:
+.LBE2463:
+.LBB2464:
+.LBB2327:
+.LBB2325:
+# /usr/lib/gcc/x86_64-linux-gnu/12/include/avx512vlintrin.h:6676:   return (__m256i) __builtin_ia32_vpermt2vard256_mask ((__v8si) __I
+	.loc 2 6676 20 is_stmt 0 view .LVU682
+	vpermi2d	%ymm4, %ymm3, %ymm8	# mhi, mlo, tmp1225
+.LBE2325:
+.LBE2327:
+.LBE2464:
+.LBB2465:
+.LBB2215:
+.LBB2214:
+# /usr/lib/gcc/x86_64-linux-gnu/12/include/emmintrin.h:1066:   return (__m128i) ((__v4su)__A + (__v4su)__B);
+	.loc 3 1066 33 view .LVU683
+	vpaddd	%xmm0, %xmm2, %xmm2	# tmp1165, tmp1142, _274
+.LVL106:
+	.loc 3 1066 33 view .LVU684
+.LBE2214:
+.LBE2215:
+	.loc 1 85 503 is_stmt 1 view .LVU685
+.LBB2216:
+.LBI2216:
+	.loc 3 1327 1 view .LVU686
+.LBB2217:
+	.loc 3 1329 3 view .LVU687
+	.loc 3 1329 3 is_stmt 0 view .LVU688
+.LBE2217:
+.LBE2216:
+.LBB2219:
+.LBI2219:
+	.loc 2 11663 1 is_stmt 1 view .LVU689
+.LBB2220:
+	.loc 2 11665 3 view .LVU690
+.LBE2220:
+.LBE2219:
+.LBB2222:
+.LBB2218:
+# /usr/lib/gcc/x86_64-linux-gnu/12/include/emmintrin.h:1329:   return (__m128i) ((__v2du)__A ^ (__v2du)__B);
+	.loc 3 1329 33 is_stmt 0 view .LVU691
+	vpxor	%xmm2, %xmm1, %xmm1	# _274, tmp1140, tmp1171
+.LVL107:
+	.loc 3 1329 33 view .LVU692
+.LBE2218:
+.LBE2222:
+.LBB2223:
+.LBB2221:
+# /usr/lib/gcc/x86_64-linux-gnu/12/include/avx512vlintrin.h:11665:   return (__m128i) __builtin_ia32_prord128_mask ((__v4si) __A, __B,
+	.loc 2 11665 20 view .LVU693
+	vprord	$12, %xmm1, %xmm1	#, tmp1171, tmp1170
+.LVL108:
+	.loc 2 11665 20 view .LVU694
+.LBE2221:
+.LBE2223:
+	.loc 1 85 552 is_stmt 1 view .LVU695
+.LBB2224:
+.LBI2224:
+	.loc 3 1064 1 view .LVU696
+.LBB2225:
+	.loc 3 1066 3 view .LVU697
+	.loc 3 1066 3 is_stmt 0 view .LVU698
+.LBE2225:
+.LBE2224:
+.LBB2226:
+.LBI2226:
+	.loc 3 1064 1 is_stmt 1 view .LVU699
+.LBB2227:
+	.loc 3 1066 3 view .LVU700
+# /usr/lib/gcc/x86_64-linux-gnu/12/include/emmintrin.h:1066:   return (__m128i) ((__v4su)__A + (__v4su)__B);
+	.loc 3 1066 33 is_stmt 0 view .LVU701
+	vpaddd	%xmm5, %xmm1, %xmm5	# tmp1158, tmp1170, tmp1175
+.LVL109:
+	.loc 3 1066 33 view .LVU702
+	vpaddd	%xmm7, %xmm5, %xmm5	# _266, tmp1175, _283
+.LVL110:
+	.loc 3 1066 33 view .LVU703
+.LBE2227:
+.LBE2226:
+	.loc 1 85 601 is_stmt 1 view .LVU704
+.LBB2228:
+.LBI2228:
+	.loc 3 1327 1 view .LVU705
+.LBB2229:
+	.loc 3 1329 3 view .LVU706
+	.loc 3 1329 3 is_stmt 0 view .LVU707
+.LBE2229:
+.LBE2228:
+.LBB2231:
+.LBI2231:
+	.loc 2 11663 1 is_stmt 1 view .LVU708
+.LBB2232:
+	.loc 2 11665 3 view .LVU709
+.LBE2232:
+.LBE2231:
+.LBB2234:
+.LBB2230:
+# /usr/lib/gcc/x86_64-linux-gnu/12/include/emmintrin.h:1329:   return (__m128i) ((__v2du)__A ^ (__v2du)__B);
+	.loc 3 1329 33 is_stmt 0 view .LVU710
+	vpxor	%xmm5, %xmm0, %xmm0	# _283, tmp1165, tmp1177
+.LVL111:
+	.loc 3 1329 33 view .LVU711
+.LBE2230:
+.LBE2234:
+.LBB2235:
+.LBB2233:
+# /usr/lib/gcc/x86_64-linux-gnu/12/include/avx512vlintrin.h:11665:   return (__m128i) __builtin_ia32_prord128_mask ((__v4si) __A, __B,
+	.loc 2 11665 20 view .LVU712
+	vprord	$8, %xmm0, %xmm0	#, tmp1177, tmp1176
+.LVL112:
+	.loc 2 11665 20 view .LVU713
+.LBE2233:
+.LBE2235:
+	.loc 1 85 649 is_stmt 1 view .LVU714
+.LBB2236:
+.LBI2236:
+	.loc 3 1064 1 view .LVU715
+.LBB2237:
+	.loc 3 1066 3 view .LVU716
+# /usr/lib/gcc/x86_64-linux-gnu/12/include/emmintrin.h:1066:   return (__m128i) ((__v4su)__A + (__v4su)__B);
+	.loc 3 1066 33 is_stmt 0 view .LVU717
+	vpaddd	%xmm2, %xmm0, %xmm2	# _274, tmp1176, _290
+.LVL113:
+	.loc 3 1066 33 view .LVU718
+.LBE2237:
+.LBE2236:
+	.loc 1 85 679 is_stmt 1 view .LVU719
+.LBB2238:
+.LBI2238:
+	.loc 3 1327 1 view .LVU720
+.LBB2239:
+	.loc 3 1329 3 view .LVU721
+	.loc 3 1329 3 is_stmt 0 view .LVU722
+.LBE2239:
+.LBE2238:
+.LBB2241:
+.LBI2241:
+	.loc 2 11663 1 is_stmt 1 view .LVU723
+.LBB2242:
+	.loc 2 11665 3 view .LVU724
+.LBE2242:
+.LBE2241:
+.LBB2244:
+.LBB2245:
+# /usr/lib/gcc/x86_64-linux-gnu/12/include/emmintrin.h:1458:   return (__m128i)__builtin_ia32_pshufd ((__v4si)__A, __mask);
+	.loc 3 1458 19 is_stmt 0 view .LVU725
+	vpshufd	$147, %xmm0, %xmm0	#, tmp1176, tmp1190
+.LVL114:
+	.loc 3 1458 19 view .LVU726
+.LBE2245:
+.LBE2244:
+.LBB2247:
+.LBB2240:
+# /usr/lib/gcc/x86_64-linux-gnu/12/include/emmintrin.h:1329:   return (__m128i) ((__v2du)__A ^ (__v2du)__B);
+	.loc 3 1329 33 view .LVU727
+	vpxor	%xmm2, %xmm1, %xmm1	# _290, tmp1170, tmp1182
+.LVL115:
+	.loc 3 1329 33 view .LVU728
+.LBE2240:
+.LBE2247:
+.LBB2248:
+.LBB2249:
+# /usr/lib/gcc/x86_64-linux-gnu/12/include/emmintrin.h:1458:   return (__m128i)__builtin_ia32_pshufd ((__v4si)__A, __mask);
+	.loc 3 1458 19 view .LVU729
+	vpshufd	$78, %xmm2, %xmm2	#, _290, tmp1188
+.LVL116:
+	.loc 3 1458 19 view .LVU730
+.LBE2249:
+.LBE2248:
+.LBB2251:
+.LBB2243:
+# /usr/lib/gcc/x86_64-linux-gnu/12/include/avx512vlintrin.h:11665:   return (__m128i) __builtin_ia32_prord128_mask ((__v4si) __A, __B,
+	.loc 2 11665 20 view .LVU731
+	vprord	$7, %xmm1, %xmm1	#, tmp1182, tmp1181
+.LVL117:
+	.loc 2 11665 20 view .LVU732
+.LBE2243:
+.LBE2251:
+	.loc 1 85 373 is_stmt 1 view .LVU733
+	.loc 1 85 740 view .LVU734
+.LBB2252:
+.LBI2252:
+	.loc 3 1456 1 view .LVU735
+.LBB2253:
+	.loc 3 1458 3 view .LVU736
+# /usr/lib/gcc/x86_64-linux-gnu/12/include/emmintrin.h:1458:   return (__m128i)__builtin_ia32_pshufd ((__v4si)__A, __mask);
+	.loc 3 1458 19 is_stmt 0 view .LVU737
+	vpshufd	$57, %xmm1, %xmm1	#, tmp1181, tmp1186
+.LVL118:
+	.loc 3 1458 19 view .LVU738
+.LBE2253:
+.LBE2252:
+	.loc 1 85 7 is_stmt 1 view .LVU739
+.LBB2254:
+.LBI2248:
+	.loc 3 1456 1 view .LVU740
+.LBB2250:
+	.loc 3 1458 3 view .LVU741
+	.loc 3 1458 3 is_stmt 0 view .LVU742
+.LBE2250:
+.LBE2254:
+	.loc 1 85 7 is_stmt 1 view .LVU743
+.LBB2255:
+.LBI2244:
+	.loc 3 1456 1 view .LVU744
+.LBB2246:
+	.loc 3 1458 3 view .LVU745
+	.loc 3 1458 3 is_stmt 0 view .LVU746
+.LBE2246:
+.LBE2255:
+	.loc 1 85 7 is_stmt 1 view .LVU747
+	.loc 1 85 12 view .LVU748
+.LBB2256:
+.LBI2256:
+	.loc 3 1064 1 view .LVU749
+.LBB2257:
+	.loc 3 1066 3 view .LVU750
+	.loc 3 1066 3 is_stmt 0 view .LVU751
+.LBE2257:
+.LBE2256:
+.LBB2258:
+.LBI2258:
+	.loc 3 1064 1 is_stmt 1 view .LVU752
+.LBB2259:
+	.loc 3 1066 3 view .LVU753
+# /usr/lib/gcc/x86_64-linux-gnu/12/include/emmintrin.h:1066:   return (__m128i) ((__v4su)__A + (__v4su)__B);
+	.loc 3 1066 33 is_stmt 0 view .LVU754
+	vpaddd	%xmm6, %xmm1, %xmm6	# tmp1160, tmp1186, tmp1192
+	vpaddd	%xmm5, %xmm6, %xmm5	# _283, tmp1192, _303
+.LVL119:
+	.loc 3 1066 33 view .LVU755
+.LBE2259:
+.LBE2258:
+	.loc 1 85 61 is_stmt 1 view .LVU756
+.LBB2260:
+.LBI2260:
+	.loc 3 1327 1 view .LVU757
+.LBB2261:
+	.loc 3 1329 3 view .LVU758
+	.loc 3 1329 3 is_stmt 0 view .LVU759
+.LBE2261:
+.LBE2260:
+.LBB2263:
+.LBI2263:
+	.loc 2 11663 1 is_stmt 1 view .LVU760
+.LBB2264:
+	.loc 2 11665 3 view .LVU761
+.LBE2264:
+.LBE2263:
+.LBE2465:
+.LBB2466:
+.LBB2328:
+.LBB2329:
+# /usr/lib/gcc/x86_64-linux-gnu/12/include/avxintrin.h:1469:   return (__m128i) __builtin_ia32_si_si256 ((__v8si)__A);
+	.loc 4 1469 20 is_stmt 0 view .LVU762
+	vmovdqa	%xmm8, %xmm6	# tmp1225, tmp1234
+.LBE2329:
+.LBE2328:
+.LBB2331:
+.LBB2332:
+# /usr/lib/gcc/x86_64-linux-gnu/12/include/avx2intrin.h:1098:   return (__m128i) __builtin_ia32_extract128i256 ((__v4di)__X, __M);
+	.loc 5 1098 20 view .LVU763
+	vextracti32x4	$0x1, %ymm8, %xmm8	# tmp1225, tmp1236
+.LBE2332:
+.LBE2331:
+.LBE2466:
+.LBB2467:
+.LBB2266:
+.LBB2262:
+# /usr/lib/gcc/x86_64-linux-gnu/12/include/emmintrin.h:1329:   return (__m128i) ((__v2du)__A ^ (__v2du)__B);
+	.loc 3 1329 33 view .LVU764
+	vpxor	%xmm5, %xmm0, %xmm0	# _303, tmp1190, tmp1194
+.LVL120:
+	.loc 3 1329 33 view .LVU765
+.LBE2262:
+.LBE2266:
+.LBB2267:
+.LBB2265:
+# /usr/lib/gcc/x86_64-linux-gnu/12/include/avx512vlintrin.h:11665:   return (__m128i) __builtin_ia32_prord128_mask ((__v4si) __A, __B,
+	.loc 2 11665 20 view .LVU766
+	vprold	$16, %xmm0, %xmm0	#, tmp1194, tmp1193
+.LVL121:
+	.loc 2 11665 20 view .LVU767
+.LBE2265:
+.LBE2267:
+	.loc 1 85 110 is_stmt 1 view .LVU768
+.LBB2268:
+.LBI2268:
+	.loc 3 1064 1 view .LVU769
+.LBB2269:
+	.loc 3 1066 3 view .LVU770
+# /usr/lib/gcc/x86_64-linux-gnu/12/include/emmintrin.h:1066:   return (__m128i) ((__v4su)__A + (__v4su)__B);
+	.loc 3 1066 33 is_stmt 0 view .LVU771
+	vpaddd	%xmm0, %xmm2, %xmm2	# tmp1193, tmp1188, _311
+.LVL122:
+	.loc 3 1066 33 view .LVU772
+.LBE2269:
+.LBE2268:
+	.loc 1 85 140 is_stmt 1 view .LVU773
+.LBB2270:
+.LBI2270:
+	.loc 3 1327 1 view .LVU774
+.LBB2271:
+	.loc 3 1329 3 view .LVU775
+	.loc 3 1329 3 is_stmt 0 view .LVU776
+.LBE2271:
+.LBE2270:
+.LBB2273:
+.LBI2273:
+	.loc 2 11663 1 is_stmt 1 view .LVU777
+.LBB2274:
+	.loc 2 11665 3 view .LVU778
+.LBE2274:
+.LBE2273:
+.LBB2276:
+.LBB2272:
+# /usr/lib/gcc/x86_64-linux-gnu/12/include/emmintrin.h:1329:   return (__m128i) ((__v2du)__A ^ (__v2du)__B);
+	.loc 3 1329 33 is_stmt 0 view .LVU779
+	vpxor	%xmm2, %xmm1, %xmm1	# _311, tmp1186, tmp1199
+.LVL123:
+	.loc 3 1329 33 view .LVU780
+.LBE2272:
+.LBE2276:
+.LBB2277:
+.LBB2275:
+# /usr/lib/gcc/x86_64-linux-gnu/12/include/avx512vlintrin.h:11665:   return (__m128i) __builtin_ia32_prord128_mask ((__v4si) __A, __B,
+	.loc 2 11665 20 view .LVU781
+	vprord	$12, %xmm1, %xmm1	#, tmp1199, tmp1198
+.LVL124:
+	.loc 2 11665 20 view .LVU782
+.LBE2275:
+.LBE2277:
+	.loc 1 85 189 is_stmt 1 view .LVU783
+.LBB2278:
+.LBI2278:
+	.loc 3 1064 1 view .LVU784
+.LBB2279:
+	.loc 3 1066 3 view .LVU785
+	.loc 3 1066 3 is_stmt 0 view .LVU786
+.LBE2279:
+.LBE2278:
+.LBB2280:
+.LBI2280:
+	.loc 3 1064 1 is_stmt 1 view .LVU787
+.LBB2281:
+	.loc 3 1066 3 view .LVU788
+# /usr/lib/gcc/x86_64-linux-gnu/12/include/emmintrin.h:1066:   return (__m128i) ((__v4su)__A + (__v4su)__B);
+	.loc 3 1066 33 is_stmt 0 view .LVU789
+	vpaddd	%xmm9, %xmm1, %xmm9	# tmp1162, tmp1198, tmp1203
+.LVL125:
+	.loc 3 1066 33 view .LVU790
+	vpaddd	%xmm5, %xmm9, %xmm9	# _303, tmp1203, _320
+.LVL126:
+	.loc 3 1066 33 view .LVU791
+.LBE2281:
+.LBE2280:
+	.loc 1 85 238 is_stmt 1 view .LVU792
+.LBB2282:
+.LBI2282:
+	.loc 3 1327 1 view .LVU793
+.LBB2283:
+	.loc 3 1329 3 view .LVU794
+	.loc 3 1329 3 is_stmt 0 view .LVU795
+.LBE2283:
+.LBE2282:
+.LBB2285:
+.LBI2285:
+	.loc 2 11663 1 is_stmt 1 view .LVU796
+.LBB2286:
+	.loc 2 11665 3 view .LVU797
+.LBE2286:
+.LBE2285:
+.LBE2467:
+.LBB2468:
+.LBB2334:
+.LBB2335:
+# /usr/lib/gcc/x86_64-linux-gnu/12/include/avx512vlintrin.h:6676:   return (__m256i) __builtin_ia32_vpermt2vard256_mask ((__v8si) __I
+	.loc 2 6676 20 is_stmt 0 view .LVU798
+	vmovdqa	.LC9(%rip), %ymm5	#, tmp1221
+.LBE2335:
+.LBE2334:
+.LBE2468:
+.LBB2469:
+.LBB2288:
+.LBB2284:
+# /usr/lib/gcc/x86_64-linux-gnu/12/include/emmintrin.h:1329:   return (__m128i) ((__v2du)__A ^ (__v2du)__B);
+	.loc 3 1329 33 view .LVU799
+	vpxor	%xmm9, %xmm0, %xmm0	# _320, tmp1193, tmp1205
+.LVL127:
+	.loc 3 1329 33 view .LVU800
+.LBE2284:
+.LBE2288:
+.LBB2289:
+.LBB2287:
+# /usr/lib/gcc/x86_64-linux-gnu/12/include/avx512vlintrin.h:11665:   return (__m128i) __builtin_ia32_prord128_mask ((__v4si) __A, __B,
+	.loc 2 11665 20 view .LVU801
+	vprord	$8, %xmm0, %xmm0	#, tmp1205, tmp1204
+.LVL128:
+	.loc 2 11665 20 view .LVU802
+.LBE2287:
+.LBE2289:
+	.loc 1 85 286 is_stmt 1 view .LVU803
+.LBB2290:
+.LBI2290:
+	.loc 3 1064 1 view .LVU804
+.LBB2291:
+	.loc 3 1066 3 view .LVU805
+.LBE2291:
+.LBE2290:
+.LBE2469:
+.LBB2470:
+.LBB2338:
+.LBB2336:
+# /usr/lib/gcc/x86_64-linux-gnu/12/include/avx512vlintrin.h:6676:   return (__m256i) __builtin_ia32_vpermt2vard256_mask ((__v8si) __I
+	.loc 2 6676 20 is_stmt 0 view .LVU806
+	vpermi2d	%ymm4, %ymm3, %ymm5	# mhi, mlo, tmp1220
+.LBE2336:
+.LBE2338:
+.LBB2339:
+.LBB2340:
+# /usr/lib/gcc/x86_64-linux-gnu/12/include/avxintrin.h:1469:   return (__m128i) __builtin_ia32_si_si256 ((__v8si)__A);
+	.loc 4 1469 20 view .LVU807
+	vmovdqa	%xmm5, %xmm7	# tmp1220, tmp1230
+.LBE2340:
+.LBE2339:
+.LBB2342:
+.LBB2343:
+# /usr/lib/gcc/x86_64-linux-gnu/12/include/avx2intrin.h:1098:   return (__m128i) __builtin_ia32_extract128i256 ((__v4di)__X, __M);
+	.loc 5 1098 20 view .LVU808
+	vextracti32x4	$0x1, %ymm5, %xmm5	# tmp1220, tmp1232
+.LBE2343:
+.LBE2342:
+.LBE2470:
+.LBB2471:
+.LBB2293:
+.LBB2292:
+# /usr/lib/gcc/x86_64-linux-gnu/12/include/emmintrin.h:1066:   return (__m128i) ((__v4su)__A + (__v4su)__B);
+	.loc 3 1066 33 view .LVU809
+	vpaddd	%xmm2, %xmm0, %xmm2	# _311, tmp1204, _327
+.LVL129:
+	.loc 3 1066 33 view .LVU810
+.LBE2292:
+.LBE2293:
+	.loc 1 85 316 is_stmt 1 view .LVU811
+.LBB2294:
+.LBI2294:
+	.loc 3 1327 1 view .LVU812
+.LBB2295:
+	.loc 3 1329 3 view .LVU813
+	.loc 3 1329 3 is_stmt 0 view .LVU814
+.LBE2295:
+.LBE2294:
+.LBB2297:
+.LBI2297:
+	.loc 2 11663 1 is_stmt 1 view .LVU815
+.LBB2298:
+	.loc 2 11665 3 view .LVU816
+.LBE2298:
+.LBE2297:
+.LBB2300:
+.LBB2301:
+# /usr/lib/gcc/x86_64-linux-gnu/12/include/emmintrin.h:1458:   return (__m128i)__builtin_ia32_pshufd ((__v4si)__A, __mask);
+	.loc 3 1458 19 is_stmt 0 view .LVU817
+	vpshufd	$57, %xmm0, %xmm0	#, tmp1204, tmp1218
+.LVL130:
+	.loc 3 1458 19 view .LVU818
+.LBE2301:
+.LBE2300:
+.LBB2303:
+.LBB2296:
+# /usr/lib/gcc/x86_64-linux-gnu/12/include/emmintrin.h:1329:   return (__m128i) ((__v2du)__A ^ (__v2du)__B);
+	.loc 3 1329 33 view .LVU819
+	vpxor	%xmm2, %xmm1, %xmm1	# _327, tmp1198, tmp1210
+.LVL131:
+	.loc 3 1329 33 view .LVU820
+.LBE2296:
+.LBE2303:
+.LBB2304:
+.LBB2305:
+# /usr/lib/gcc/x86_64-linux-gnu/12/include/emmintrin.h:1458:   return (__m128i)__builtin_ia32_pshufd ((__v4si)__A, __mask);
+	.loc 3 1458 19 view .LVU821
+	vpshufd	$78, %xmm2, %xmm2	#, _327, tmp1216
+.LVL132:
+	.loc 3 1458 19 view .LVU822
+.LBE2305:
+.LBE2304:
+.LBB2307:
+.LBB2299:
+# /usr/lib/gcc/x86_64-linux-gnu/12/include/avx512vlintrin.h:11665:   return (__m128i) __builtin_ia32_prord128_mask ((__v4si) __A, __B,
+	.loc 2 11665 20 view .LVU823
+	vprord	$7, %xmm1, %xmm1	#, tmp1210, tmp1209
+.LVL133:
+	.loc 2 11665 20 view .LVU824
+.LBE2299:
+.LBE2307:
+	.loc 1 85 10 is_stmt 1 view .LVU825
+	.loc 1 85 377 view .LVU826
+.LBB2308:
+.LBI2308:
+	.loc 3 1456 1 view .LVU827
+.LBB2309:
+	.loc 3 1458 3 view .LVU828
+# /usr/lib/gcc/x86_64-linux-gnu/12/include/emmintrin.h:1458:   return (__m128i)__builtin_ia32_pshufd ((__v4si)__A, __mask);
+	.loc 3 1458 19 is_stmt 0 view .LVU829
+	vpshufd	$147, %xmm1, %xmm1	#, tmp1209, tmp1214
+.LVL134:
+	.loc 3 1458 19 view .LVU830
+.LBE2309:
+.LBE2308:
+	.loc 1 85 7 is_stmt 1 view .LVU831
+.LBB2310:
+.LBI2304:
+	.loc 3 1456 1 view .LVU832
+.LBB2306:
+	.loc 3 1458 3 view .LVU833
+	.loc 3 1458 3 is_stmt 0 view .LVU834
+.LBE2306:
+.LBE2310:
+	.loc 1 85 7 is_stmt 1 view .LVU835
+.LBB2311:
+.LBI2300:
+	.loc 3 1456 1 view .LVU836
+.LBB2302:
+	.loc 3 1458 3 view .LVU837
+	.loc 3 1458 3 is_stmt 0 view .LVU838
+.LBE2302:
+.LBE2311:
+.LBE2471:
+	.loc 1 85 8 is_stmt 1 view .LVU839
+	.loc 1 86 5 view .LVU840
+.LBB2472:
+	.loc 1 86 10 view .LVU841
+	.loc 1 86 26 view .LVU842
+.LBB2345:
+.LBI2334:
+	.loc 2 6674 1 view .LVU843
+.LBB2337:
+	.loc 2 6676 3 view .LVU844
+	.loc 2 6676 3 is_stmt 0 view .LVU845
+.LBE2337:
+.LBE2345:
+	.loc 1 86 127 is_stmt 1 view .LVU846
+.LBB2346:
+.LBI2323:
+	.loc 2 6674 1 view .LVU847
+.LBB2326:
+	.loc 2 6676 3 view .LVU848
+	.loc 2 6676 3 is_stmt 0 view .LVU849
+.LBE2326:
+.LBE2346:
+	.loc 1 86 228 is_stmt 1 view .LVU850
+.LBB2347:
+.LBI2339:
+	.loc 4 1467 1 view .LVU851
+.LBB2341:
+	.loc 4 1469 3 view .LVU852
+	.loc 4 1469 3 is_stmt 0 view .LVU853
+.LBE2341:
+.LBE2347:
+	.loc 1 86 261 is_stmt 1 view .LVU854
+.LBB2348:
+.LBI2342:
+	.loc 5 1096 1 view .LVU855
+.LBB2344:
+	.loc 5 1098 3 view .LVU856
+	.loc 5 1098 3 is_stmt 0 view .LVU857
+.LBE2344:
+.LBE2348:
+	.loc 1 86 299 is_stmt 1 view .LVU858
+.LBB2349:
+.LBI2328:
+	.loc 4 1467 1 view .LVU859
+.LBB2330:
+	.loc 4 1469 3 view .LVU860
+	.loc 4 1469 3 is_stmt 0 view .LVU861
+.LBE2330:
+.LBE2349:
+	.loc 1 86 332 is_stmt 1 view .LVU862
+.LBB2350:
+.LBI2331:
+	.loc 5 1096 1 view .LVU863
+.LBB2333:
+	.loc 5 1098 3 view .LVU864
+	.loc 5 1098 3 is_stmt 0 view .LVU865
+.LBE2333:
+.LBE2350:
+	.loc 1 86 370 is_stmt 1 view .LVU866
+	.loc 1 86 375 view .LVU867
+.LBB2351:
+.LBI2351:
+	.loc 3 1064 1 view .LVU868
+.LBB2352:
+	.loc 3 1066 3 view .LVU869
+	.loc 3 1066 3 is_stmt 0 view .LVU870
+.LBE2352:
+.LBE2351:
+.LBB2353:
+.LBI2353:
+	.loc 3 1064 1 is_stmt 1 view .LVU871
+.LBB2354:
+	.loc 3 1066 3 view .LVU872
+# /usr/lib/gcc/x86_64-linux-gnu/12/include/emmintrin.h:1066:   return (__m128i) ((__v4su)__A + (__v4su)__B);
+	.loc 3 1066 33 is_stmt 0 view .LVU873
+	vpaddd	%xmm7, %xmm1, %xmm7	# tmp1230, tmp1214, tmp1238
+	vpaddd	%xmm9, %xmm7, %xmm7	# _320, tmp1238, _348
+.LVL135:
+	.loc 3 1066 33 view .LVU874
+.LBE2354:
+.LBE2353:
+	.loc 1 86 424 is_stmt 1 view .LVU875
+.LBB2355:
+.LBI2355:
+	.loc 3 1327 1 view .LVU876
+.LBB2356:
+	.loc 3 1329 3 view .LVU877
+	.loc 3 1329 3 is_stmt 0 view .LVU878
+.LBE2356:
+.LBE2355:
+.LBB2358:
+.LBI2358:
+	.loc 2 11663 1 is_stmt 1 view .LVU879
+.LBB2359:
+	.loc 2 11665 3 view .LVU880
+.LBE2359:
+.LBE2358:
+.LBE2472:
+.LBB2473:
+.LBB2474:
+.LBB2475:
+# /usr/lib/gcc/x86_64-linux-gnu/12/include/avx512vlintrin.h:6676:   return (__m256i) __builtin_ia32_vpermt2vard256_mask ((__v8si) __I
+	.loc 2 6676 20 is_stmt 0 view .LVU881
+	vmovdqa	.LC12(%rip), %ymm9	#, tmp1300
+.LBE2475:
+.LBE2474:
+.LBE2473:
+.LBB2614:
+.LBB2361:
+.LBB2357:
+# /usr/lib/gcc/x86_64-linux-gnu/12/include/emmintrin.h:1329:   return (__m128i) ((__v2du)__A ^ (__v2du)__B);
+	.loc 3 1329 33 view .LVU882
+	vpxor	%xmm7, %xmm0, %xmm0	# _348, tmp1218, tmp1240
+.LVL136:
+	.loc 3 1329 33 view .LVU883
+.LBE2357:
+.LBE2361:
+.LBB2362:
+.LBB2360:
+# /usr/lib/gcc/x86_64-linux-gnu/12/include/avx512vlintrin.h:11665:   return (__m128i) __builtin_ia32_prord128_mask ((__v4si) __A, __B,
+	.loc 2 11665 20 view .LVU884
+	vprold	$16, %xmm0, %xmm0	#, tmp1240, tmp1239
+.LVL137:
+	.loc 2 11665 20 view .LVU885
+.LBE2360:
+.LBE2362:
+	.loc 1 86 473 is_stmt 1 view .LVU886
+.LBB2363:
+.LBI2363:
+	.loc 3 1064 1 view .LVU887
+.LBB2364:
+	.loc 3 1066 3 view .LVU888
+.LBE2364:
+.LBE2363:
+.LBE2614:
+.LBB2615:
+.LBB2478:
+.LBB2476:
+# /usr/lib/gcc/x86_64-linux-gnu/12/include/avx512vlintrin.h:6676:   return (__m256i) __builtin_ia32_vpermt2vard256_mask ((__v8si) __I
+	.loc 2 6676 20 is_stmt 0 view .LVU889
+	vpermi2d	%ymm4, %ymm3, %ymm9	# mhi, mlo, tmp1299
+.LBE2476:
+.LBE2478:
+.LBE2615:
+.LBB2616:
+.LBB2366:
+.LBB2365:
+# /usr/lib/gcc/x86_64-linux-gnu/12/include/emmintrin.h:1066:   return (__m128i) ((__v4su)__A + (__v4su)__B);
+	.loc 3 1066 33 view .LVU890
+	vpaddd	%xmm0, %xmm2, %xmm2	# tmp1239, tmp1216, _356
+.LVL138:
+	.loc 3 1066 33 view .LVU891
+.LBE2365:
+.LBE2366:
+	.loc 1 86 503 is_stmt 1 view .LVU892
+.LBB2367:
+.LBI2367:
+	.loc 3 1327 1 view .LVU893
+.LBB2368:
+	.loc 3 1329 3 view .LVU894
+	.loc 3 1329 3 is_stmt 0 view .LVU895
+.LBE2368:
+.LBE2367:
+.LBB2370:
+.LBI2370:
+	.loc 2 11663 1 is_stmt 1 view .LVU896
+.LBB2371:
+	.loc 2 11665 3 view .LVU897
+.LBE2371:
+.LBE2370:
+.LBB2373:
+.LBB2369:
+# /usr/lib/gcc/x86_64-linux-gnu/12/include/emmintrin.h:1329:   return (__m128i) ((__v2du)__A ^ (__v2du)__B);
+	.loc 3 1329 33 is_stmt 0 view .LVU898
+	vpxor	%xmm2, %xmm1, %xmm1	# _356, tmp1214, tmp1245
+.LVL139:
+	.loc 3 1329 33 view .LVU899
+.LBE2369:
+.LBE2373:
+.LBB2374:
+.LBB2372:
+# /usr/lib/gcc/x86_64-linux-gnu/12/include/avx512vlintrin.h:11665:   return (__m128i) __builtin_ia32_prord128_mask ((__v4si) __A, __B,
+	.loc 2 11665 20 view .LVU900
+	vprord	$12, %xmm1, %xmm1	#, tmp1245, tmp1244
+.LVL140:
+	.loc 2 11665 20 view .LVU901
+.LBE2372:
+.LBE2374:
+	.loc 1 86 552 is_stmt 1 view .LVU902
+.LBB2375:
+.LBI2375:
+	.loc 3 1064 1 view .LVU903
+.LBB2376:
+	.loc 3 1066 3 view .LVU904
+	.loc 3 1066 3 is_stmt 0 view .LVU905
+.LBE2376:
+.LBE2375:
+.LBB2377:
+.LBI2377:
+	.loc 3 1064 1 is_stmt 1 view .LVU906
+.LBB2378:
+	.loc 3 1066 3 view .LVU907
+# /usr/lib/gcc/x86_64-linux-gnu/12/include/emmintrin.h:1066:   return (__m128i) ((__v4su)__A + (__v4su)__B);
+	.loc 3 1066 33 is_stmt 0 view .LVU908
+	vpaddd	%xmm5, %xmm1, %xmm5	# tmp1232, tmp1244, tmp1249
+.LVL141:
+	.loc 3 1066 33 view .LVU909
+	vpaddd	%xmm7, %xmm5, %xmm5	# _348, tmp1249, _365
+.LVL142:
+	.loc 3 1066 33 view .LVU910
+.LBE2378:
+.LBE2377:
+	.loc 1 86 601 is_stmt 1 view .LVU911
+.LBB2379:
+.LBI2379:
+	.loc 3 1327 1 view .LVU912
+.LBB2380:
+	.loc 3 1329 3 view .LVU913
+	.loc 3 1329 3 is_stmt 0 view .LVU914
+.LBE2380:
+.LBE2379:
+.LBB2382:
+.LBI2382:
+	.loc 2 11663 1 is_stmt 1 view .LVU915
+.LBB2383:
+	.loc 2 11665 3 view .LVU916
+.LBE2383:
+.LBE2382:
+.LBB2385:
+.LBB2381:
+# /usr/lib/gcc/x86_64-linux-gnu/12/include/emmintrin.h:1329:   return (__m128i) ((__v2du)__A ^ (__v2du)__B);
+	.loc 3 1329 33 is_stmt 0 view .LVU917
+	vpxor	%xmm5, %xmm0, %xmm0	# _365, tmp1239, tmp1251
+.LVL143:
+	.loc 3 1329 33 view .LVU918
+.LBE2381:
+.LBE2385:
+.LBB2386:
+.LBB2384:
+# /usr/lib/gcc/x86_64-linux-gnu/12/include/avx512vlintrin.h:11665:   return (__m128i) __builtin_ia32_prord128_mask ((__v4si) __A, __B,
+	.loc 2 11665 20 view .LVU919
+	vprord	$8, %xmm0, %xmm0	#, tmp1251, tmp1250
+.LVL144:
+	.loc 2 11665 20 view .LVU920
+.LBE2384:
+.LBE2386:
+	.loc 1 86 649 is_stmt 1 view .LVU921
+.LBB2387:
+.LBI2387:
+	.loc 3 1064 1 view .LVU922
+.LBB2388:
+	.loc 3 1066 3 view .LVU923
+# /usr/lib/gcc/x86_64-linux-gnu/12/include/emmintrin.h:1066:   return (__m128i) ((__v4su)__A + (__v4su)__B);
+	.loc 3 1066 33 is_stmt 0 view .LVU924
+	vpaddd	%xmm2, %xmm0, %xmm2	# _356, tmp1250, _372
+.LVL145:
+	.loc 3 1066 33 view .LVU925
+.LBE2388:
+.LBE2387:
+	.loc 1 86 679 is_stmt 1 view .LVU926
+.LBB2389:
+.LBI2389:
+	.loc 3 1327 1 view .LVU927
+.LBB2390:
+	.loc 3 1329 3 view .LVU928
+	.loc 3 1329 3 is_stmt 0 view .LVU929
+.LBE2390:
+.LBE2389:
+.LBB2392:
+.LBI2392:
+	.loc 2 11663 1 is_stmt 1 view .LVU930
+.LBB2393:
+	.loc 2 11665 3 view .LVU931
+.LBE2393:
+.LBE2392:
+.LBB2395:
+.LBB2396:
+# /usr/lib/gcc/x86_64-linux-gnu/12/include/emmintrin.h:1458:   return (__m128i)__builtin_ia32_pshufd ((__v4si)__A, __mask);
+	.loc 3 1458 19 is_stmt 0 view .LVU932
+	vpshufd	$147, %xmm0, %xmm0	#, tmp1250, tmp1264
+.LVL146:
+	.loc 3 1458 19 view .LVU933
+.LBE2396:
+.LBE2395:
+.LBB2398:
+.LBB2391:
+# /usr/lib/gcc/x86_64-linux-gnu/12/include/emmintrin.h:1329:   return (__m128i) ((__v2du)__A ^ (__v2du)__B);
+	.loc 3 1329 33 view .LVU934
+	vpxor	%xmm2, %xmm1, %xmm1	# _372, tmp1244, tmp1256
+.LVL147:
+	.loc 3 1329 33 view .LVU935
+.LBE2391:
+.LBE2398:
+.LBB2399:
+.LBB2400:
+# /usr/lib/gcc/x86_64-linux-gnu/12/include/emmintrin.h:1458:   return (__m128i)__builtin_ia32_pshufd ((__v4si)__A, __mask);
+	.loc 3 1458 19 view .LVU936
+	vpshufd	$78, %xmm2, %xmm2	#, _372, tmp1262
+.LVL148:
+	.loc 3 1458 19 view .LVU937
+.LBE2400:
+.LBE2399:
+.LBB2402:
+.LBB2394:
+# /usr/lib/gcc/x86_64-linux-gnu/12/include/avx512vlintrin.h:11665:   return (__m128i) __builtin_ia32_prord128_mask ((__v4si) __A, __B,
+	.loc 2 11665 20 view .LVU938
+	vprord	$7, %xmm1, %xmm1	#, tmp1256, tmp1255
+.LVL149:
+	.loc 2 11665 20 view .LVU939
+.LBE2394:
+.LBE2402:
+	.loc 1 86 373 is_stmt 1 view .LVU940
+	.loc 1 86 740 view .LVU941
+.LBB2403:
+.LBI2403:
+	.loc 3 1456 1 view .LVU942
+.LBB2404:
+	.loc 3 1458 3 view .LVU943
+# /usr/lib/gcc/x86_64-linux-gnu/12/include/emmintrin.h:1458:   return (__m128i)__builtin_ia32_pshufd ((__v4si)__A, __mask);
+	.loc 3 1458 19 is_stmt 0 view .LVU944
+	vpshufd	$57, %xmm1, %xmm1	#, tmp1255, tmp1260
+.LVL150:
+	.loc 3 1458 19 view .LVU945
+.LBE2404:
+.LBE2403:
+	.loc 1 86 7 is_stmt 1 view .LVU946
+.LBB2405:
+.LBI2399:
+	.loc 3 1456 1 view .LVU947
+.LBB2401:
+	.loc 3 1458 3 view .LVU948
+	.loc 3 1458 3 is_stmt 0 view .LVU949
+.LBE2401:
+.LBE2405:
+	.loc 1 86 7 is_stmt 1 view .LVU950
+.LBB2406:
+.LBI2395:
+	.loc 3 1456 1 view .LVU951
+.LBB2397:
+	.loc 3 1458 3 view .LVU952
+	.loc 3 1458 3 is_stmt 0 view .LVU953
+.LBE2397:
+.LBE2406:
+	.loc 1 86 7 is_stmt 1 view .LVU954
+	.loc 1 86 12 view .LVU955
+.LBB2407:
+.LBI2407:
+	.loc 3 1064 1 view .LVU956
+.LBB2408:
+	.loc 3 1066 3 view .LVU957
+	.loc 3 1066 3 is_stmt 0 view .LVU958
+.LBE2408:
+.LBE2407:
+.LBB2409:
+.LBI2409:
+	.loc 3 1064 1 is_stmt 1 view .LVU959
+.LBB2410:
+	.loc 3 1066 3 view .LVU960
+# /usr/lib/gcc/x86_64-linux-gnu/12/include/emmintrin.h:1066:   return (__m128i) ((__v4su)__A + (__v4su)__B);
+	.loc 3 1066 33 is_stmt 0 view .LVU961
+	vpaddd	%xmm6, %xmm1, %xmm6	# tmp1234, tmp1260, tmp1266
+	vpaddd	%xmm5, %xmm6, %xmm5	# _365, tmp1266, _385
+.LVL151:
+	.loc 3 1066 33 view .LVU962
+.LBE2410:
+.LBE2409:
+	.loc 1 86 61 is_stmt 1 view .LVU963
+.LBB2411:
+.LBI2411:
+	.loc 3 1327 1 view .LVU964
+.LBB2412:
+	.loc 3 1329 3 view .LVU965
+	.loc 3 1329 3 is_stmt 0 view .LVU966
+.LBE2412:
+.LBE2411:
+.LBB2414:
+.LBI2414:
+	.loc 2 11663 1 is_stmt 1 view .LVU967
+.LBB2415:
+	.loc 2 11665 3 view .LVU968
+.LBE2415:
+.LBE2414:
+.LBE2616:
+.LBB2617:
+.LBB2479:
+.LBB2480:
+# /usr/lib/gcc/x86_64-linux-gnu/12/include/avxintrin.h:1469:   return (__m128i) __builtin_ia32_si_si256 ((__v8si)__A);
+	.loc 4 1469 20 is_stmt 0 view .LVU969
+	vmovdqa	%xmm9, %xmm6	# tmp1299, tmp1308
+.LBE2480:
+.LBE2479:
+.LBB2482:
+.LBB2483:
+# /usr/lib/gcc/x86_64-linux-gnu/12/include/avx2intrin.h:1098:   return (__m128i) __builtin_ia32_extract128i256 ((__v4di)__X, __M);
+	.loc 5 1098 20 view .LVU970
+	vextracti32x4	$0x1, %ymm9, %xmm9	# tmp1299, tmp1310
+.LBE2483:
+.LBE2482:
+.LBE2617:
+.LBB2618:
+.LBB2417:
+.LBB2413:
+# /usr/lib/gcc/x86_64-linux-gnu/12/include/emmintrin.h:1329:   return (__m128i) ((__v2du)__A ^ (__v2du)__B);
+	.loc 3 1329 33 view .LVU971
+	vpxor	%xmm5, %xmm0, %xmm0	# _385, tmp1264, tmp1268
+.LVL152:
+	.loc 3 1329 33 view .LVU972
+.LBE2413:
+.LBE2417:
+.LBB2418:
+.LBB2416:
+# /usr/lib/gcc/x86_64-linux-gnu/12/include/avx512vlintrin.h:11665:   return (__m128i) __builtin_ia32_prord128_mask ((__v4si) __A, __B,
+	.loc 2 11665 20 view .LVU973
+	vprold	$16, %xmm0, %xmm0	#, tmp1268, tmp1267
+.LVL153:
+	.loc 2 11665 20 view .LVU974
+.LBE2416:
+.LBE2418:
+	.loc 1 86 110 is_stmt 1 view .LVU975
+.LBB2419:
+.LBI2419:
+	.loc 3 1064 1 view .LVU976
+.LBB2420:
+	.loc 3 1066 3 view .LVU977
+# /usr/lib/gcc/x86_64-linux-gnu/12/include/emmintrin.h:1066:   return (__m128i) ((__v4su)__A + (__v4su)__B);
+	.loc 3 1066 33 is_stmt 0 view .LVU978
+	vpaddd	%xmm0, %xmm2, %xmm2	# tmp1267, tmp1262, _393
+.LVL154:
+	.loc 3 1066 33 view .LVU979
+.LBE2420:
+.LBE2419:
+	.loc 1 86 140 is_stmt 1 view .LVU980
+.LBB2421:
+.LBI2421:
+	.loc 3 1327 1 view .LVU981
+.LBB2422:
+	.loc 3 1329 3 view .LVU982
+	.loc 3 1329 3 is_stmt 0 view .LVU983
+.LBE2422:
+.LBE2421:
+.LBB2424:
+.LBI2424:
+	.loc 2 11663 1 is_stmt 1 view .LVU984
+.LBB2425:
+	.loc 2 11665 3 view .LVU985
+.LBE2425:
+.LBE2424:
+.LBB2427:
+.LBB2423:
+# /usr/lib/gcc/x86_64-linux-gnu/12/include/emmintrin.h:1329:   return (__m128i) ((__v2du)__A ^ (__v2du)__B);
+	.loc 3 1329 33 is_stmt 0 view .LVU986
+	vpxor	%xmm2, %xmm1, %xmm1	# _393, tmp1260, tmp1273
+.LVL155:
+	.loc 3 1329 33 view .LVU987
+.LBE2423:
+.LBE2427:
+.LBB2428:
+.LBB2426:
+# /usr/lib/gcc/x86_64-linux-gnu/12/include/avx512vlintrin.h:11665:   return (__m128i) __builtin_ia32_prord128_mask ((__v4si) __A, __B,
+	.loc 2 11665 20 view .LVU988
+	vprord	$12, %xmm1, %xmm1	#, tmp1273, tmp1272
+.LVL156:
+	.loc 2 11665 20 view .LVU989
+.LBE2426:
+.LBE2428:
+	.loc 1 86 189 is_stmt 1 view .LVU990
+.LBB2429:
+.LBI2429:
+	.loc 3 1064 1 view .LVU991
+.LBB2430:
+	.loc 3 1066 3 view .LVU992
+	.loc 3 1066 3 is_stmt 0 view .LVU993
+.LBE2430:
+.LBE2429:
+.LBB2431:
+.LBI2431:
+	.loc 3 1064 1 is_stmt 1 view .LVU994
+.LBB2432:
+	.loc 3 1066 3 view .LVU995
+# /usr/lib/gcc/x86_64-linux-gnu/12/include/emmintrin.h:1066:   return (__m128i) ((__v4su)__A + (__v4su)__B);
+	.loc 3 1066 33 is_stmt 0 view .LVU996
+	vpaddd	%xmm8, %xmm1, %xmm8	# tmp1236, tmp1272, tmp1277
+.LVL157:
+	.loc 3 1066 33 view .LVU997
+	vpaddd	%xmm5, %xmm8, %xmm8	# _385, tmp1277, _402
+.LVL158:
+	.loc 3 1066 33 view .LVU998
+.LBE2432:
+.LBE2431:
+	.loc 1 86 238 is_stmt 1 view .LVU999
+.LBB2433:
+.LBI2433:
+	.loc 3 1327 1 view .LVU1000
+.LBB2434:
+	.loc 3 1329 3 view .LVU1001
+	.loc 3 1329 3 is_stmt 0 view .LVU1002
+.LBE2434:
+.LBE2433:
+.LBB2436:
+.LBI2436:
+	.loc 2 11663 1 is_stmt 1 view .LVU1003
+.LBB2437:
+	.loc 2 11665 3 view .LVU1004
+.LBE2437:
+.LBE2436:
+.LBE2618:
+.LBB2619:
+.LBB2485:
+.LBB2486:
+# /usr/lib/gcc/x86_64-linux-gnu/12/include/avx512vlintrin.h:6676:   return (__m256i) __builtin_ia32_vpermt2vard256_mask ((__v8si) __I
+	.loc 2 6676 20 is_stmt 0 view .LVU1005
+	vmovdqa	.LC11(%rip), %ymm5	#, tmp1295
+.LBE2486:
+.LBE2485:
+.LBE2619:
+.LBB2620:
+.LBB2439:
+.LBB2435:
+# /usr/lib/gcc/x86_64-linux-gnu/12/include/emmintrin.h:1329:   return (__m128i) ((__v2du)__A ^ (__v2du)__B);
+	.loc 3 1329 33 view .LVU1006
+	vpxor	%xmm8, %xmm0, %xmm0	# _402, tmp1267, tmp1279
+.LVL159:
+	.loc 3 1329 33 view .LVU1007
+.LBE2435:
+.LBE2439:
+.LBB2440:
+.LBB2438:
+# /usr/lib/gcc/x86_64-linux-gnu/12/include/avx512vlintrin.h:11665:   return (__m128i) __builtin_ia32_prord128_mask ((__v4si) __A, __B,
+	.loc 2 11665 20 view .LVU1008
+	vprord	$8, %xmm0, %xmm0	#, tmp1279, tmp1278
+.LVL160:
+	.loc 2 11665 20 view .LVU1009
+.LBE2438:
+.LBE2440:
+	.loc 1 86 286 is_stmt 1 view .LVU1010
+.LBB2441:
+.LBI2441:
+	.loc 3 1064 1 view .LVU1011
+.LBB2442:
+	.loc 3 1066 3 view .LVU1012
+.LBE2442:
+.LBE2441:
+.LBE2620:
+.LBB2621:
+.LBB2489:
+.LBB2487:
+# /usr/lib/gcc/x86_64-linux-gnu/12/include/avx512vlintrin.h:6676:   return (__m256i) __builtin_ia32_vpermt2vard256_mask ((__v8si) __I
+	.loc 2 6676 20 is_stmt 0 view .LVU1013
+	vpermi2d	%ymm4, %ymm3, %ymm5	# mhi, mlo, tmp1294
+.LBE2487:
+.LBE2489:
+.LBB2490:
+.LBB2491:
+# /usr/lib/gcc/x86_64-linux-gnu/12/include/avxintrin.h:1469:   return (__m128i) __builtin_ia32_si_si256 ((__v8si)__A);
+	.loc 4 1469 20 view .LVU1014
+	vmovdqa	%xmm5, %xmm7	# tmp1294, tmp1304
+.LBE2491:
+.LBE2490:
+.LBB2493:
+.LBB2494:
+# /usr/lib/gcc/x86_64-linux-gnu/12/include/avx2intrin.h:1098:   return (__m128i) __builtin_ia32_extract128i256 ((__v4di)__X, __M);
+	.loc 5 1098 20 view .LVU1015
+	vextracti32x4	$0x1, %ymm5, %xmm5	# tmp1294, tmp1306
+.LBE2494:
+.LBE2493:
+.LBE2621:
+.LBB2622:
+.LBB2444:
+.LBB2443:
+# /usr/lib/gcc/x86_64-linux-gnu/12/include/emmintrin.h:1066:   return (__m128i) ((__v4su)__A + (__v4su)__B);
+	.loc 3 1066 33 view .LVU1016
+	vpaddd	%xmm2, %xmm0, %xmm2	# _393, tmp1278, _409
+.LVL161:
+	.loc 3 1066 33 view .LVU1017
+.LBE2443:
+.LBE2444:
+	.loc 1 86 316 is_stmt 1 view .LVU1018
+.LBB2445:
+.LBI2445:
+	.loc 3 1327 1 view .LVU1019
+.LBB2446:
+	.loc 3 1329 3 view .LVU1020
+	.loc 3 1329 3 is_stmt 0 view .LVU1021
+.LBE2446:
+.LBE2445:
+.LBB2448:
+.LBI2448:
+	.loc 2 11663 1 is_stmt 1 view .LVU1022
+.LBB2449:
+	.loc 2 11665 3 view .LVU1023
+.LBE2449:
+.LBE2448:
+.LBB2451:
+.LBB2452:
+# /usr/lib/gcc/x86_64-linux-gnu/12/include/emmintrin.h:1458:   return (__m128i)__builtin_ia32_pshufd ((__v4si)__A, __mask);
+	.loc 3 1458 19 is_stmt 0 view .LVU1024
+	vpshufd	$57, %xmm0, %xmm0	#, tmp1278, tmp1292
+.LVL162:
+	.loc 3 1458 19 view .LVU1025
+.LBE2452:
+.LBE2451:
+.LBB2454:
+.LBB2447:
+# /usr/lib/gcc/x86_64-linux-gnu/12/include/emmintrin.h:1329:   return (__m128i) ((__v2du)__A ^ (__v2du)__B);
+	.loc 3 1329 33 view .LVU1026
+	vpxor	%xmm2, %xmm1, %xmm1	# _409, tmp1272, tmp1284
+.LVL163:
+	.loc 3 1329 33 view .LVU1027
+.LBE2447:
+.LBE2454:
+.LBB2455:
+.LBB2456:
+# /usr/lib/gcc/x86_64-linux-gnu/12/include/emmintrin.h:1458:   return (__m128i)__builtin_ia32_pshufd ((__v4si)__A, __mask);
+	.loc 3 1458 19 view .LVU1028
+	vpshufd	$78, %xmm2, %xmm2	#, _409, tmp1290
+.LVL164:
+	.loc 3 1458 19 view .LVU1029
+.LBE2456:
+.LBE2455:
+.LBB2458:
+.LBB2450:
+# /usr/lib/gcc/x86_64-linux-gnu/12/include/avx512vlintrin.h:11665:   return (__m128i) __builtin_ia32_prord128_mask ((__v4si) __A, __B,
+	.loc 2 11665 20 view .LVU1030
+	vprord	$7, %xmm1, %xmm1	#, tmp1284, tmp1283
+.LVL165:
+	.loc 2 11665 20 view .LVU1031
+.LBE2450:
+.LBE2458:
+	.loc 1 86 10 is_stmt 1 view .LVU1032
+	.loc 1 86 377 view .LVU1033
+.LBB2459:
+.LBI2459:
+	.loc 3 1456 1 view .LVU1034
+.LBB2460:
+	.loc 3 1458 3 view .LVU1035
+# /usr/lib/gcc/x86_64-linux-gnu/12/include/emmintrin.h:1458:   return (__m128i)__builtin_ia32_pshufd ((__v4si)__A, __mask);
+	.loc 3 1458 19 is_stmt 0 view .LVU1036
+	vpshufd	$147, %xmm1, %xmm1	#, tmp1283, tmp1288
+.LVL166:
+	.loc 3 1458 19 view .LVU1037
+.LBE2460:
+.LBE2459:
+	.loc 1 86 7 is_stmt 1 view .LVU1038
+.LBB2461:
+.LBI2455:
+	.loc 3 1456 1 view .LVU1039
+.LBB2457:
+	.loc 3 1458 3 view .LVU1040
+	.loc 3 1458 3 is_stmt 0 view .LVU1041
+.LBE2457:
+.LBE2461:
+	.loc 1 86 7 is_stmt 1 view .LVU1042
+.LBB2462:
+.LBI2451:
+	.loc 3 1456 1 view .LVU1043
+.LBB2453:
+	.loc 3 1458 3 view .LVU1044
+	.loc 3 1458 3 is_stmt 0 view .LVU1045
+.LBE2453:
+.LBE2462:
+.LBE2622:
+	.loc 1 86 8 is_stmt 1 view .LVU1046
+	.loc 1 87 5 view .LVU1047
+.LBB2623:
+	.loc 1 87 10 view .LVU1048
+	.loc 1 87 26 view .LVU1049
+.LBB2496:
+.LBI2485:
+	.loc 2 6674 1 view .LVU1050
+.LBB2488:
+	.loc 2 6676 3 view .LVU1051
+	.loc 2 6676 3 is_stmt 0 view .LVU1052
+.LBE2488:
+.LBE2496:
+	.loc 1 87 127 is_stmt 1 view .LVU1053
+.LBB2497:
+.LBI2474:
+	.loc 2 6674 1 view .LVU1054
+.LBB2477:
+	.loc 2 6676 3 view .LVU1055
+	.loc 2 6676 3 is_stmt 0 view .LVU1056
+.LBE2477:
+.LBE2497:
+	.loc 1 87 228 is_stmt 1 view .LVU1057
+.LBB2498:
+.LBI2490:
+	.loc 4 1467 1 view .LVU1058
+.LBB2492:
+	.loc 4 1469 3 view .LVU1059
+	.loc 4 1469 3 is_stmt 0 view .LVU1060
+.LBE2492:
+.LBE2498:
+	.loc 1 87 261 is_stmt 1 view .LVU1061
+.LBB2499:
+.LBI2493:
+	.loc 5 1096 1 view .LVU1062
+.LBB2495:
+	.loc 5 1098 3 view .LVU1063
+	.loc 5 1098 3 is_stmt 0 view .LVU1064
+.LBE2495:
+.LBE2499:
+	.loc 1 87 299 is_stmt 1 view .LVU1065
+.LBB2500:
+.LBI2479:
+	.loc 4 1467 1 view .LVU1066
+.LBB2481:
+	.loc 4 1469 3 view .LVU1067
+	.loc 4 1469 3 is_stmt 0 view .LVU1068
+.LBE2481:
+.LBE2500:
+	.loc 1 87 332 is_stmt 1 view .LVU1069
+.LBB2501:
+.LBI2482:
+	.loc 5 1096 1 view .LVU1070
+.LBB2484:
+	.loc 5 1098 3 view .LVU1071
+	.loc 5 1098 3 is_stmt 0 view .LVU1072
+.LBE2484:
+.LBE2501:
+	.loc 1 87 370 is_stmt 1 view .LVU1073
+	.loc 1 87 375 view .LVU1074
+.LBB2502:
+.LBI2502:
+	.loc 3 1064 1 view .LVU1075
+.LBB2503:
+	.loc 3 1066 3 view .LVU1076
+	.loc 3 1066 3 is_stmt 0 view .LVU1077
+.LBE2503:
+.LBE2502:
+.LBB2504:
+.LBI2504:
+	.loc 3 1064 1 is_stmt 1 view .LVU1078
+.LBB2505:
+	.loc 3 1066 3 view .LVU1079
+# /usr/lib/gcc/x86_64-linux-gnu/12/include/emmintrin.h:1066:   return (__m128i) ((__v4su)__A + (__v4su)__B);
+	.loc 3 1066 33 is_stmt 0 view .LVU1080
+	vpaddd	%xmm7, %xmm1, %xmm7	# tmp1304, tmp1288, tmp1312
+	vpaddd	%xmm8, %xmm7, %xmm7	# _402, tmp1312, _430
+.LVL167:
+	.loc 3 1066 33 view .LVU1081
+.LBE2505:
+.LBE2504:
+	.loc 1 87 424 is_stmt 1 view .LVU1082
+.LBB2506:
+.LBI2506:
+	.loc 3 1327 1 view .LVU1083
+.LBB2507:
+	.loc 3 1329 3 view .LVU1084
+	.loc 3 1329 3 is_stmt 0 view .LVU1085
+.LBE2507:
+.LBE2506:
+.LBB2509:
+.LBI2509:
+	.loc 2 11663 1 is_stmt 1 view .LVU1086
+.LBB2510:
+	.loc 2 11665 3 view .LVU1087
+.LBE2510:
+.LBE2509:
+.LBE2623:
+.LBB2624:
+.LBB2625:
+.LBB2626:
+# /usr/lib/gcc/x86_64-linux-gnu/12/include/avx512vlintrin.h:6676:   return (__m256i) __builtin_ia32_vpermt2vard256_mask ((__v8si) __I
+	.loc 2 6676 20 is_stmt 0 view .LVU1088
+	vmovdqa	.LC14(%rip), %ymm8	#, tmp1374
+.LBE2626:
+.LBE2625:
+.LBE2624:
+.LBB2765:
+.LBB2512:
+.LBB2508:
+# /usr/lib/gcc/x86_64-linux-gnu/12/include/emmintrin.h:1329:   return (__m128i) ((__v2du)__A ^ (__v2du)__B);
+	.loc 3 1329 33 view .LVU1089
+	vpxor	%xmm7, %xmm0, %xmm0	# _430, tmp1292, tmp1314
+.LVL168:
+	.loc 3 1329 33 view .LVU1090
+.LBE2508:
+.LBE2512:
+.LBB2513:
+.LBB2511:
+# /usr/lib/gcc/x86_64-linux-gnu/12/include/avx512vlintrin.h:11665:   return (__m128i) __builtin_ia32_prord128_mask ((__v4si) __A, __B,
+	.loc 2 11665 20 view .LVU1091
+	vprold	$16, %xmm0, %xmm0	#, tmp1314, tmp1313
+.LVL169:
+	.loc 2 11665 20 view .LVU1092
+.LBE2511:
+.LBE2513:
+	.loc 1 87 473 is_stmt 1 view .LVU1093
+.LBB2514:
+.LBI2514:
+	.loc 3 1064 1 view .LVU1094
+.LBB2515:
+	.loc 3 1066 3 view .LVU1095
+.LBE2515:
+.LBE2514:
+.LBE2765:
+.LBB2766:
+.LBB2629:
+.LBB2627:
+# /usr/lib/gcc/x86_64-linux-gnu/12/include/avx512vlintrin.h:6676:   return (__m256i) __builtin_ia32_vpermt2vard256_mask ((__v8si) __I
+	.loc 2 6676 20 is_stmt 0 view .LVU1096
+	vpermi2d	%ymm4, %ymm3, %ymm8	# mhi, mlo, tmp1373
+.LBE2627:
+.LBE2629:
+.LBE2766:
+.LBB2767:
+.LBB2517:
+.LBB2516:
+# /usr/lib/gcc/x86_64-linux-gnu/12/include/emmintrin.h:1066:   return (__m128i) ((__v4su)__A + (__v4su)__B);
+	.loc 3 1066 33 view .LVU1097
+	vpaddd	%xmm0, %xmm2, %xmm2	# tmp1313, tmp1290, _438
+.LVL170:
+	.loc 3 1066 33 view .LVU1098
+.LBE2516:
+.LBE2517:
+	.loc 1 87 503 is_stmt 1 view .LVU1099
+.LBB2518:
+.LBI2518:
+	.loc 3 1327 1 view .LVU1100
+.LBB2519:
+	.loc 3 1329 3 view .LVU1101
+	.loc 3 1329 3 is_stmt 0 view .LVU1102
+.LBE2519:
+.LBE2518:
+.LBB2521:
+.LBI2521:
+	.loc 2 11663 1 is_stmt 1 view .LVU1103
+.LBB2522:
+	.loc 2 11665 3 view .LVU1104
+.LBE2522:
+.LBE2521:
+.LBB2524:
+.LBB2520:
+# /usr/lib/gcc/x86_64-linux-gnu/12/include/emmintrin.h:1329:   return (__m128i) ((__v2du)__A ^ (__v2du)__B);
+	.loc 3 1329 33 is_stmt 0 view .LVU1105
+	vpxor	%xmm2, %xmm1, %xmm1	# _438, tmp1288, tmp1319
+.LVL171:
+	.loc 3 1329 33 view .LVU1106
+.LBE2520:
+.LBE2524:
+.LBB2525:
+.LBB2523:
+# /usr/lib/gcc/x86_64-linux-gnu/12/include/avx512vlintrin.h:11665:   return (__m128i) __builtin_ia32_prord128_mask ((__v4si) __A, __B,
+	.loc 2 11665 20 view .LVU1107
+	vprord	$12, %xmm1, %xmm1	#, tmp1319, tmp1318
+.LVL172:
+	.loc 2 11665 20 view .LVU1108
+.LBE2523:
+.LBE2525:
+	.loc 1 87 552 is_stmt 1 view .LVU1109
+.LBB2526:
+.LBI2526:
+	.loc 3 1064 1 view .LVU1110
+.LBB2527:
+	.loc 3 1066 3 view .LVU1111
+	.loc 3 1066 3 is_stmt 0 view .LVU1112
+.LBE2527:
+.LBE2526:
+.LBB2528:
+.LBI2528:
+	.loc 3 1064 1 is_stmt 1 view .LVU1113
+.LBB2529:
+	.loc 3 1066 3 view .LVU1114
+# /usr/lib/gcc/x86_64-linux-gnu/12/include/emmintrin.h:1066:   return (__m128i) ((__v4su)__A + (__v4su)__B);
+	.loc 3 1066 33 is_stmt 0 view .LVU1115
+	vpaddd	%xmm5, %xmm1, %xmm5	# tmp1306, tmp1318, tmp1323
+.LVL173:
+	.loc 3 1066 33 view .LVU1116
+	vpaddd	%xmm7, %xmm5, %xmm5	# _430, tmp1323, _447
+.LVL174:
+	.loc 3 1066 33 view .LVU1117
+.LBE2529:
+.LBE2528:
+	.loc 1 87 601 is_stmt 1 view .LVU1118
+.LBB2530:
+.LBI2530:
+	.loc 3 1327 1 view .LVU1119
+.LBB2531:
+	.loc 3 1329 3 view .LVU1120
+	.loc 3 1329 3 is_stmt 0 view .LVU1121
+.LBE2531:
+.LBE2530:
+.LBB2533:
+.LBI2533:
+	.loc 2 11663 1 is_stmt 1 view .LVU1122
+.LBB2534:
+	.loc 2 11665 3 view .LVU1123
+.LBE2534:
+.LBE2533:
+.LBB2536:
+.LBB2532:
+# /usr/lib/gcc/x86_64-linux-gnu/12/include/emmintrin.h:1329:   return (__m128i) ((__v2du)__A ^ (__v2du)__B);
+	.loc 3 1329 33 is_stmt 0 view .LVU1124
+	vpxor	%xmm5, %xmm0, %xmm0	# _447, tmp1313, tmp1325
+.LVL175:
+	.loc 3 1329 33 view .LVU1125
+.LBE2532:
+.LBE2536:
+.LBB2537:
+.LBB2535:
+# /usr/lib/gcc/x86_64-linux-gnu/12/include/avx512vlintrin.h:11665:   return (__m128i) __builtin_ia32_prord128_mask ((__v4si) __A, __B,
+	.loc 2 11665 20 view .LVU1126
+	vprord	$8, %xmm0, %xmm0	#, tmp1325, tmp1324
+.LVL176:
+	.loc 2 11665 20 view .LVU1127
+.LBE2535:
+.LBE2537:
+	.loc 1 87 649 is_stmt 1 view .LVU1128
+.LBB2538:
+.LBI2538:
+	.loc 3 1064 1 view .LVU1129
+.LBB2539:
+	.loc 3 1066 3 view .LVU1130
+# /usr/lib/gcc/x86_64-linux-gnu/12/include/emmintrin.h:1066:   return (__m128i) ((__v4su)__A + (__v4su)__B);
+	.loc 3 1066 33 is_stmt 0 view .LVU1131
+	vpaddd	%xmm2, %xmm0, %xmm2	# _438, tmp1324, _454
+.LVL177:
+	.loc 3 1066 33 view .LVU1132
+.LBE2539:
+.LBE2538:
+	.loc 1 87 679 is_stmt 1 view .LVU1133
+.LBB2540:
+.LBI2540:
+	.loc 3 1327 1 view .LVU1134
+.LBB2541:
+	.loc 3 1329 3 view .LVU1135
+	.loc 3 1329 3 is_stmt 0 view .LVU1136
+.LBE2541:
+.LBE2540:
+.LBB2543:
+.LBI2543:
+	.loc 2 11663 1 is_stmt 1 view .LVU1137
+.LBB2544:
+	.loc 2 11665 3 view .LVU1138
+.LBE2544:
+.LBE2543:
+.LBB2546:
+.LBB2547:
+# /usr/lib/gcc/x86_64-linux-gnu/12/include/emmintrin.h:1458:   return (__m128i)__builtin_ia32_pshufd ((__v4si)__A, __mask);
+	.loc 3 1458 19 is_stmt 0 view .LVU1139
+	vpshufd	$147, %xmm0, %xmm0	#, tmp1324, tmp1338
+.LVL178:
+	.loc 3 1458 19 view .LVU1140
+.LBE2547:
+.LBE2546:
+.LBB2549:
+.LBB2542:
+# /usr/lib/gcc/x86_64-linux-gnu/12/include/emmintrin.h:1329:   return (__m128i) ((__v2du)__A ^ (__v2du)__B);
+	.loc 3 1329 33 view .LVU1141
+	vpxor	%xmm2, %xmm1, %xmm1	# _454, tmp1318, tmp1330
+.LVL179:
+	.loc 3 1329 33 view .LVU1142
+.LBE2542:
+.LBE2549:
+.LBB2550:
+.LBB2551:
+# /usr/lib/gcc/x86_64-linux-gnu/12/include/emmintrin.h:1458:   return (__m128i)__builtin_ia32_pshufd ((__v4si)__A, __mask);
+	.loc 3 1458 19 view .LVU1143
+	vpshufd	$78, %xmm2, %xmm2	#, _454, tmp1336
+.LVL180:
+	.loc 3 1458 19 view .LVU1144
+.LBE2551:
+.LBE2550:
+.LBB2553:
+.LBB2545:
+# /usr/lib/gcc/x86_64-linux-gnu/12/include/avx512vlintrin.h:11665:   return (__m128i) __builtin_ia32_prord128_mask ((__v4si) __A, __B,
+	.loc 2 11665 20 view .LVU1145
+	vprord	$7, %xmm1, %xmm1	#, tmp1330, tmp1329
+.LVL181:
+	.loc 2 11665 20 view .LVU1146
+.LBE2545:
+.LBE2553:
+	.loc 1 87 373 is_stmt 1 view .LVU1147
+	.loc 1 87 740 view .LVU1148
+.LBB2554:
+.LBI2554:
+	.loc 3 1456 1 view .LVU1149
+.LBB2555:
+	.loc 3 1458 3 view .LVU1150
+# /usr/lib/gcc/x86_64-linux-gnu/12/include/emmintrin.h:1458:   return (__m128i)__builtin_ia32_pshufd ((__v4si)__A, __mask);
+	.loc 3 1458 19 is_stmt 0 view .LVU1151
+	vpshufd	$57, %xmm1, %xmm1	#, tmp1329, tmp1334
+.LVL182:
+	.loc 3 1458 19 view .LVU1152
+.LBE2555:
+.LBE2554:
+	.loc 1 87 7 is_stmt 1 view .LVU1153
+.LBB2556:
+.LBI2550:
+	.loc 3 1456 1 view .LVU1154
+.LBB2552:
+	.loc 3 1458 3 view .LVU1155
+	.loc 3 1458 3 is_stmt 0 view .LVU1156
+.LBE2552:
+.LBE2556:
+	.loc 1 87 7 is_stmt 1 view .LVU1157
+.LBB2557:
+.LBI2546:
+	.loc 3 1456 1 view .LVU1158
+.LBB2548:
+	.loc 3 1458 3 view .LVU1159
+	.loc 3 1458 3 is_stmt 0 view .LVU1160
+.LBE2548:
+.LBE2557:
+	.loc 1 87 7 is_stmt 1 view .LVU1161
+	.loc 1 87 12 view .LVU1162
+.LBB2558:
+.LBI2558:
+	.loc 3 1064 1 view .LVU1163
+.LBB2559:
+	.loc 3 1066 3 view .LVU1164
+	.loc 3 1066 3 is_stmt 0 view .LVU1165
+.LBE2559:
+.LBE2558:
+.LBB2560:
+.LBI2560:
+	.loc 3 1064 1 is_stmt 1 view .LVU1166
+.LBB2561:
+	.loc 3 1066 3 view .LVU1167
+# /usr/lib/gcc/x86_64-linux-gnu/12/include/emmintrin.h:1066:   return (__m128i) ((__v4su)__A + (__v4su)__B);
+	.loc 3 1066 33 is_stmt 0 view .LVU1168
+	vpaddd	%xmm6, %xmm1, %xmm6	# tmp1308, tmp1334, tmp1340
+	vpaddd	%xmm5, %xmm6, %xmm5	# _447, tmp1340, _467
+.LVL183:
+	.loc 3 1066 33 view .LVU1169
+.LBE2561:
+.LBE2560:
+	.loc 1 87 61 is_stmt 1 view .LVU1170
+.LBB2562:
+.LBI2562:
+	.loc 3 1327 1 view .LVU1171
+.LBB2563:
+	.loc 3 1329 3 view .LVU1172
+	.loc 3 1329 3 is_stmt 0 view .LVU1173
+.LBE2563:
+.LBE2562:
+.LBB2565:
+.LBI2565:
+	.loc 2 11663 1 is_stmt 1 view .LVU1174
+.LBB2566:
+	.loc 2 11665 3 view .LVU1175
+.LBE2566:
+.LBE2565:
+.LBE2767:
+.LBB2768:
+.LBB2630:
+.LBB2631:
+# /usr/lib/gcc/x86_64-linux-gnu/12/include/avxintrin.h:1469:   return (__m128i) __builtin_ia32_si_si256 ((__v8si)__A);
+	.loc 4 1469 20 is_stmt 0 view .LVU1176
+	vmovdqa	%xmm8, %xmm6	# tmp1373, tmp1382
+.LBE2631:
+.LBE2630:
+.LBB2633:
+.LBB2634:
+# /usr/lib/gcc/x86_64-linux-gnu/12/include/avx2intrin.h:1098:   return (__m128i) __builtin_ia32_extract128i256 ((__v4di)__X, __M);
+	.loc 5 1098 20 view .LVU1177
+	vextracti32x4	$0x1, %ymm8, %xmm8	# tmp1373, tmp1384
+.LBE2634:
+.LBE2633:
+.LBE2768:
+.LBB2769:
+.LBB2568:
+.LBB2564:
+# /usr/lib/gcc/x86_64-linux-gnu/12/include/emmintrin.h:1329:   return (__m128i) ((__v2du)__A ^ (__v2du)__B);
+	.loc 3 1329 33 view .LVU1178
+	vpxor	%xmm5, %xmm0, %xmm0	# _467, tmp1338, tmp1342
+.LVL184:
+	.loc 3 1329 33 view .LVU1179
+.LBE2564:
+.LBE2568:
+.LBB2569:
+.LBB2567:
+# /usr/lib/gcc/x86_64-linux-gnu/12/include/avx512vlintrin.h:11665:   return (__m128i) __builtin_ia32_prord128_mask ((__v4si) __A, __B,
+	.loc 2 11665 20 view .LVU1180
+	vprold	$16, %xmm0, %xmm0	#, tmp1342, tmp1341
+.LVL185:
+	.loc 2 11665 20 view .LVU1181
+.LBE2567:
+.LBE2569:
+	.loc 1 87 110 is_stmt 1 view .LVU1182
+.LBB2570:
+.LBI2570:
+	.loc 3 1064 1 view .LVU1183
+.LBB2571:
+	.loc 3 1066 3 view .LVU1184
+# /usr/lib/gcc/x86_64-linux-gnu/12/include/emmintrin.h:1066:   return (__m128i) ((__v4su)__A + (__v4su)__B);
+	.loc 3 1066 33 is_stmt 0 view .LVU1185
+	vpaddd	%xmm0, %xmm2, %xmm2	# tmp1341, tmp1336, _475
+.LVL186:
+	.loc 3 1066 33 view .LVU1186
+.LBE2571:
+.LBE2570:
+	.loc 1 87 140 is_stmt 1 view .LVU1187
+.LBB2572:
+.LBI2572:
+	.loc 3 1327 1 view .LVU1188
+.LBB2573:
+	.loc 3 1329 3 view .LVU1189
+	.loc 3 1329 3 is_stmt 0 view .LVU1190
+.LBE2573:
+.LBE2572:
+.LBB2575:
+.LBI2575:
+	.loc 2 11663 1 is_stmt 1 view .LVU1191
+.LBB2576:
+	.loc 2 11665 3 view .LVU1192
+.LBE2576:
+.LBE2575:
+.LBB2578:
+.LBB2574:
+# /usr/lib/gcc/x86_64-linux-gnu/12/include/emmintrin.h:1329:   return (__m128i) ((__v2du)__A ^ (__v2du)__B);
+	.loc 3 1329 33 is_stmt 0 view .LVU1193
+	vpxor	%xmm2, %xmm1, %xmm1	# _475, tmp1334, tmp1347
+.LVL187:
+	.loc 3 1329 33 view .LVU1194
+.LBE2574:
+.LBE2578:
+.LBB2579:
+.LBB2577:
+# /usr/lib/gcc/x86_64-linux-gnu/12/include/avx512vlintrin.h:11665:   return (__m128i) __builtin_ia32_prord128_mask ((__v4si) __A, __B,
+	.loc 2 11665 20 view .LVU1195
+	vprord	$12, %xmm1, %xmm1	#, tmp1347, tmp1346
+.LVL188:
+	.loc 2 11665 20 view .LVU1196
+.LBE2577:
+.LBE2579:
+	.loc 1 87 189 is_stmt 1 view .LVU1197
+.LBB2580:
+.LBI2580:
+	.loc 3 1064 1 view .LVU1198
+.LBB2581:
+	.loc 3 1066 3 view .LVU1199
+	.loc 3 1066 3 is_stmt 0 view .LVU1200
+.LBE2581:
+.LBE2580:
+.LBB2582:
+.LBI2582:
+	.loc 3 1064 1 is_stmt 1 view .LVU1201
+.LBB2583:
+	.loc 3 1066 3 view .LVU1202
+# /usr/lib/gcc/x86_64-linux-gnu/12/include/emmintrin.h:1066:   return (__m128i) ((__v4su)__A + (__v4su)__B);
+	.loc 3 1066 33 is_stmt 0 view .LVU1203
+	vpaddd	%xmm9, %xmm1, %xmm9	# tmp1310, tmp1346, tmp1351
+.LVL189:
+	.loc 3 1066 33 view .LVU1204
+	vpaddd	%xmm5, %xmm9, %xmm9	# _467, tmp1351, _484
+.LVL190:
+	.loc 3 1066 33 view .LVU1205
+.LBE2583:
+.LBE2582:
+	.loc 1 87 238 is_stmt 1 view .LVU1206
+.LBB2584:
+.LBI2584:
+	.loc 3 1327 1 view .LVU1207
+.LBB2585:
+	.loc 3 1329 3 view .LVU1208
+	.loc 3 1329 3 is_stmt 0 view .LVU1209
+.LBE2585:
+.LBE2584:
+.LBB2587:
+.LBI2587:
+	.loc 2 11663 1 is_stmt 1 view .LVU1210
+.LBB2588:
+	.loc 2 11665 3 view .LVU1211
+.LBE2588:
+.LBE2587:
+.LBE2769:
+.LBB2770:
+.LBB2636:
+.LBB2637:
+# /usr/lib/gcc/x86_64-linux-gnu/12/include/avx512vlintrin.h:6676:   return (__m256i) __builtin_ia32_vpermt2vard256_mask ((__v8si) __I
+	.loc 2 6676 20 is_stmt 0 view .LVU1212
+	vmovdqa	.LC13(%rip), %ymm5	#, tmp1369
+.LBE2637:
+.LBE2636:
+.LBE2770:
+.LBB2771:
+.LBB2590:
+.LBB2586:
+# /usr/lib/gcc/x86_64-linux-gnu/12/include/emmintrin.h:1329:   return (__m128i) ((__v2du)__A ^ (__v2du)__B);
+	.loc 3 1329 33 view .LVU1213
+	vpxor	%xmm9, %xmm0, %xmm0	# _484, tmp1341, tmp1353
+.LVL191:
+	.loc 3 1329 33 view .LVU1214
+.LBE2586:
+.LBE2590:
+.LBB2591:
+.LBB2589:
+# /usr/lib/gcc/x86_64-linux-gnu/12/include/avx512vlintrin.h:11665:   return (__m128i) __builtin_ia32_prord128_mask ((__v4si) __A, __B,
+	.loc 2 11665 20 view .LVU1215
+	vprord	$8, %xmm0, %xmm0	#, tmp1353, tmp1352
+.LVL192:
+	.loc 2 11665 20 view .LVU1216
+.LBE2589:
+.LBE2591:
+	.loc 1 87 286 is_stmt 1 view .LVU1217
+.LBB2592:
+.LBI2592:
+	.loc 3 1064 1 view .LVU1218
+.LBB2593:
+	.loc 3 1066 3 view .LVU1219
+.LBE2593:
+.LBE2592:
+.LBE2771:
+.LBB2772:
+.LBB2640:
+.LBB2638:
+# /usr/lib/gcc/x86_64-linux-gnu/12/include/avx512vlintrin.h:6676:   return (__m256i) __builtin_ia32_vpermt2vard256_mask ((__v8si) __I
+	.loc 2 6676 20 is_stmt 0 view .LVU1220
+	vpermi2d	%ymm4, %ymm3, %ymm5	# mhi, mlo, tmp1368
+.LBE2638:
+.LBE2640:
+.LBB2641:
+.LBB2642:
+# /usr/lib/gcc/x86_64-linux-gnu/12/include/avxintrin.h:1469:   return (__m128i) __builtin_ia32_si_si256 ((__v8si)__A);
+	.loc 4 1469 20 view .LVU1221
+	vmovdqa	%xmm5, %xmm7	# tmp1368, tmp1378
+.LBE2642:
+.LBE2641:
+.LBB2644:
+.LBB2645:
+# /usr/lib/gcc/x86_64-linux-gnu/12/include/avx2intrin.h:1098:   return (__m128i) __builtin_ia32_extract128i256 ((__v4di)__X, __M);
+	.loc 5 1098 20 view .LVU1222
+	vextracti32x4	$0x1, %ymm5, %xmm5	# tmp1368, tmp1380
+.LBE2645:
+.LBE2644:
+.LBE2772:
+.LBB2773:
+.LBB2595:
+.LBB2594:
+# /usr/lib/gcc/x86_64-linux-gnu/12/include/emmintrin.h:1066:   return (__m128i) ((__v4su)__A + (__v4su)__B);
+	.loc 3 1066 33 view .LVU1223
+	vpaddd	%xmm2, %xmm0, %xmm2	# _475, tmp1352, _491
+.LVL193:
+	.loc 3 1066 33 view .LVU1224
+.LBE2594:
+.LBE2595:
+	.loc 1 87 316 is_stmt 1 view .LVU1225
+.LBB2596:
+.LBI2596:
+	.loc 3 1327 1 view .LVU1226
+.LBB2597:
+	.loc 3 1329 3 view .LVU1227
+	.loc 3 1329 3 is_stmt 0 view .LVU1228
+.LBE2597:
+.LBE2596:
+.LBB2599:
+.LBI2599:
+	.loc 2 11663 1 is_stmt 1 view .LVU1229
+.LBB2600:
+	.loc 2 11665 3 view .LVU1230
+.LBE2600:
+.LBE2599:
+.LBB2602:
+.LBB2603:
+# /usr/lib/gcc/x86_64-linux-gnu/12/include/emmintrin.h:1458:   return (__m128i)__builtin_ia32_pshufd ((__v4si)__A, __mask);
+	.loc 3 1458 19 is_stmt 0 view .LVU1231
+	vpshufd	$57, %xmm0, %xmm0	#, tmp1352, tmp1366
+.LVL194:
+	.loc 3 1458 19 view .LVU1232
+.LBE2603:
+.LBE2602:
+.LBB2605:
+.LBB2598:
+# /usr/lib/gcc/x86_64-linux-gnu/12/include/emmintrin.h:1329:   return (__m128i) ((__v2du)__A ^ (__v2du)__B);
+	.loc 3 1329 33 view .LVU1233
+	vpxor	%xmm2, %xmm1, %xmm1	# _491, tmp1346, tmp1358
+.LVL195:
+	.loc 3 1329 33 view .LVU1234
+.LBE2598:
+.LBE2605:
+.LBB2606:
+.LBB2607:
+# /usr/lib/gcc/x86_64-linux-gnu/12/include/emmintrin.h:1458:   return (__m128i)__builtin_ia32_pshufd ((__v4si)__A, __mask);
+	.loc 3 1458 19 view .LVU1235
+	vpshufd	$78, %xmm2, %xmm2	#, _491, tmp1364
+.LVL196:
+	.loc 3 1458 19 view .LVU1236
+.LBE2607:
+.LBE2606:
+.LBB2609:
+.LBB2601:
+# /usr/lib/gcc/x86_64-linux-gnu/12/include/avx512vlintrin.h:11665:   return (__m128i) __builtin_ia32_prord128_mask ((__v4si) __A, __B,
+	.loc 2 11665 20 view .LVU1237
+	vprord	$7, %xmm1, %xmm1	#, tmp1358, tmp1357
+.LVL197:
+	.loc 2 11665 20 view .LVU1238
+.LBE2601:
+.LBE2609:
+	.loc 1 87 10 is_stmt 1 view .LVU1239
+	.loc 1 87 377 view .LVU1240
+.LBB2610:
+.LBI2610:
+	.loc 3 1456 1 view .LVU1241
+.LBB2611:
+	.loc 3 1458 3 view .LVU1242
+# /usr/lib/gcc/x86_64-linux-gnu/12/include/emmintrin.h:1458:   return (__m128i)__builtin_ia32_pshufd ((__v4si)__A, __mask);
+	.loc 3 1458 19 is_stmt 0 view .LVU1243
+	vpshufd	$147, %xmm1, %xmm1	#, tmp1357, tmp1362
+.LVL198:
+	.loc 3 1458 19 view .LVU1244
+.LBE2611:
+.LBE2610:
+	.loc 1 87 7 is_stmt 1 view .LVU1245
+.LBB2612:
+.LBI2606:
+	.loc 3 1456 1 view .LVU1246
+.LBB2608:
+	.loc 3 1458 3 view .LVU1247
+	.loc 3 1458 3 is_stmt 0 view .LVU1248
+.LBE2608:
+.LBE2612:
+	.loc 1 87 7 is_stmt 1 view .LVU1249
+.LBB2613:
+.LBI2602:
+	.loc 3 1456 1 view .LVU1250
+.LBB2604:
+	.loc 3 1458 3 view .LVU1251
+	.loc 3 1458 3 is_stmt 0 view .LVU1252
+.LBE2604:
+.LBE2613:
+.LBE2773:
+	.loc 1 87 8 is_stmt 1 view .LVU1253
+	.loc 1 88 5 view .LVU1254
+.LBB2774:
+	.loc 1 88 10 view .LVU1255
+	.loc 1 88 26 view .LVU1256
+.LBB2647:
+.LBI2636:
+	.loc 2 6674 1 view .LVU1257
+.LBB2639:
+	.loc 2 6676 3 view .LVU1258
+	.loc 2 6676 3 is_stmt 0 view .LVU1259
+.LBE2639:
+.LBE2647:
+	.loc 1 88 127 is_stmt 1 view .LVU1260
+.LBB2648:
+.LBI2625:
+	.loc 2 6674 1 view .LVU1261
+.LBB2628:
+	.loc 2 6676 3 view .LVU1262
+	.loc 2 6676 3 is_stmt 0 view .LVU1263
+.LBE2628:
+.LBE2648:
+	.loc 1 88 228 is_stmt 1 view .LVU1264
+.LBB2649:
+.LBI2641:
+	.loc 4 1467 1 view .LVU1265
+.LBB2643:
+	.loc 4 1469 3 view .LVU1266
+	.loc 4 1469 3 is_stmt 0 view .LVU1267
+.LBE2643:
+.LBE2649:
+	.loc 1 88 261 is_stmt 1 view .LVU1268
+.LBB2650:
+.LBI2644:
+	.loc 5 1096 1 view .LVU1269
+.LBB2646:
+	.loc 5 1098 3 view .LVU1270
+	.loc 5 1098 3 is_stmt 0 view .LVU1271
+.LBE2646:
+.LBE2650:
+	.loc 1 88 299 is_stmt 1 view .LVU1272
+.LBB2651:
+.LBI2630:
+	.loc 4 1467 1 view .LVU1273
+.LBB2632:
+	.loc 4 1469 3 view .LVU1274
+	.loc 4 1469 3 is_stmt 0 view .LVU1275
+.LBE2632:
+.LBE2651:
+	.loc 1 88 332 is_stmt 1 view .LVU1276
+.LBB2652:
+.LBI2633:
+	.loc 5 1096 1 view .LVU1277
+.LBB2635:
+	.loc 5 1098 3 view .LVU1278
+	.loc 5 1098 3 is_stmt 0 view .LVU1279
+.LBE2635:
+.LBE2652:
+	.loc 1 88 370 is_stmt 1 view .LVU1280
+	.loc 1 88 375 view .LVU1281
+.LBB2653:
+.LBI2653:
+	.loc 3 1064 1 view .LVU1282
+.LBB2654:
+	.loc 3 1066 3 view .LVU1283
+	.loc 3 1066 3 is_stmt 0 view .LVU1284
+.LBE2654:
+.LBE2653:
+.LBB2655:
+.LBI2655:
+	.loc 3 1064 1 is_stmt 1 view .LVU1285
+.LBB2656:
+	.loc 3 1066 3 view .LVU1286
+# /usr/lib/gcc/x86_64-linux-gnu/12/include/emmintrin.h:1066:   return (__m128i) ((__v4su)__A + (__v4su)__B);
+	.loc 3 1066 33 is_stmt 0 view .LVU1287
+	vpaddd	%xmm7, %xmm1, %xmm7	# tmp1378, tmp1362, tmp1386
+	vpaddd	%xmm9, %xmm7, %xmm7	# _484, tmp1386, _512
+.LVL199:
+	.loc 3 1066 33 view .LVU1288
+.LBE2656:
+.LBE2655:
+	.loc 1 88 424 is_stmt 1 view .LVU1289
+.LBB2657:
+.LBI2657:
+	.loc 3 1327 1 view .LVU1290
+.LBB2658:
+	.loc 3 1329 3 view .LVU1291
+	.loc 3 1329 3 is_stmt 0 view .LVU1292
+.LBE2658:
+.LBE2657:
+.LBB2660:
+.LBI2660:
+	.loc 2 11663 1 is_stmt 1 view .LVU1293
+.LBB2661:
+	.loc 2 11665 3 view .LVU1294
+.LBE2661:
+.LBE2660:
+.LBE2774:
+.LBB2775:
+.LBB2776:
+.LBB2777:
+# /usr/lib/gcc/x86_64-linux-gnu/12/include/avx512vlintrin.h:6676:   return (__m256i) __builtin_ia32_vpermt2vard256_mask ((__v8si) __I
+	.loc 2 6676 20 is_stmt 0 view .LVU1295
+	vmovdqa	.LC16(%rip), %ymm9	#, tmp1448
+.LBE2777:
+.LBE2776:
+.LBE2775:
+.LBB2916:
+.LBB2663:
+.LBB2659:
+# /usr/lib/gcc/x86_64-linux-gnu/12/include/emmintrin.h:1329:   return (__m128i) ((__v2du)__A ^ (__v2du)__B);
+	.loc 3 1329 33 view .LVU1296
+	vpxor	%xmm7, %xmm0, %xmm0	# _512, tmp1366, tmp1388
+.LVL200:
+	.loc 3 1329 33 view .LVU1297
+.LBE2659:
+.LBE2663:
+.LBB2664:
+.LBB2662:
+# /usr/lib/gcc/x86_64-linux-gnu/12/include/avx512vlintrin.h:11665:   return (__m128i) __builtin_ia32_prord128_mask ((__v4si) __A, __B,
+	.loc 2 11665 20 view .LVU1298
+	vprold	$16, %xmm0, %xmm0	#, tmp1388, tmp1387
+.LVL201:
+	.loc 2 11665 20 view .LVU1299
+.LBE2662:
+.LBE2664:
+	.loc 1 88 473 is_stmt 1 view .LVU1300
+.LBB2665:
+.LBI2665:
+	.loc 3 1064 1 view .LVU1301
+.LBB2666:
+	.loc 3 1066 3 view .LVU1302
+.LBE2666:
+.LBE2665:
+.LBE2916:
+.LBB2917:
+.LBB2780:
+.LBB2778:
+# /usr/lib/gcc/x86_64-linux-gnu/12/include/avx512vlintrin.h:6676:   return (__m256i) __builtin_ia32_vpermt2vard256_mask ((__v8si) __I
+	.loc 2 6676 20 is_stmt 0 view .LVU1303
+	vpermi2d	%ymm4, %ymm3, %ymm9	# mhi, mlo, tmp1447
+.LBE2778:
+.LBE2780:
+.LBE2917:
+.LBB2918:
+.LBB2668:
+.LBB2667:
+# /usr/lib/gcc/x86_64-linux-gnu/12/include/emmintrin.h:1066:   return (__m128i) ((__v4su)__A + (__v4su)__B);
+	.loc 3 1066 33 view .LVU1304
+	vpaddd	%xmm0, %xmm2, %xmm2	# tmp1387, tmp1364, _520
+.LVL202:
+	.loc 3 1066 33 view .LVU1305
+.LBE2667:
+.LBE2668:
+	.loc 1 88 503 is_stmt 1 view .LVU1306
+.LBB2669:
+.LBI2669:
+	.loc 3 1327 1 view .LVU1307
+.LBB2670:
+	.loc 3 1329 3 view .LVU1308
+	.loc 3 1329 3 is_stmt 0 view .LVU1309
+.LBE2670:
+.LBE2669:
+.LBB2672:
+.LBI2672:
+	.loc 2 11663 1 is_stmt 1 view .LVU1310
+.LBB2673:
+	.loc 2 11665 3 view .LVU1311
+.LBE2673:
+.LBE2672:
+.LBB2675:
+.LBB2671:
+# /usr/lib/gcc/x86_64-linux-gnu/12/include/emmintrin.h:1329:   return (__m128i) ((__v2du)__A ^ (__v2du)__B);
+	.loc 3 1329 33 is_stmt 0 view .LVU1312
+	vpxor	%xmm2, %xmm1, %xmm1	# _520, tmp1362, tmp1393
+.LVL203:
+	.loc 3 1329 33 view .LVU1313
+.LBE2671:
+.LBE2675:
+.LBB2676:
+.LBB2674:
+# /usr/lib/gcc/x86_64-linux-gnu/12/include/avx512vlintrin.h:11665:   return (__m128i) __builtin_ia32_prord128_mask ((__v4si) __A, __B,
+	.loc 2 11665 20 view .LVU1314
+	vprord	$12, %xmm1, %xmm1	#, tmp1393, tmp1392
+.LVL204:
+	.loc 2 11665 20 view .LVU1315
+.LBE2674:
+.LBE2676:
+	.loc 1 88 552 is_stmt 1 view .LVU1316
+.LBB2677:
+.LBI2677:
+	.loc 3 1064 1 view .LVU1317
+.LBB2678:
+	.loc 3 1066 3 view .LVU1318
+	.loc 3 1066 3 is_stmt 0 view .LVU1319
+.LBE2678:
+.LBE2677:
+.LBB2679:
+.LBI2679:
+	.loc 3 1064 1 is_stmt 1 view .LVU1320
+.LBB2680:
+	.loc 3 1066 3 view .LVU1321
+# /usr/lib/gcc/x86_64-linux-gnu/12/include/emmintrin.h:1066:   return (__m128i) ((__v4su)__A + (__v4su)__B);
+	.loc 3 1066 33 is_stmt 0 view .LVU1322
+	vpaddd	%xmm5, %xmm1, %xmm5	# tmp1380, tmp1392, tmp1397
+.LVL205:
+	.loc 3 1066 33 view .LVU1323
+	vpaddd	%xmm7, %xmm5, %xmm5	# _512, tmp1397, _529
+.LVL206:
+	.loc 3 1066 33 view .LVU1324
+.LBE2680:
+.LBE2679:
+	.loc 1 88 601 is_stmt 1 view .LVU1325
+.LBB2681:
+.LBI2681:
+	.loc 3 1327 1 view .LVU1326
+.LBB2682:
+	.loc 3 1329 3 view .LVU1327
+	.loc 3 1329 3 is_stmt 0 view .LVU1328
+.LBE2682:
+.LBE2681:
+.LBB2684:
+.LBI2684:
+	.loc 2 11663 1 is_stmt 1 view .LVU1329
+.LBB2685:
+	.loc 2 11665 3 view .LVU1330
+.LBE2685:
+.LBE2684:
+.LBB2687:
+.LBB2683:
+# /usr/lib/gcc/x86_64-linux-gnu/12/include/emmintrin.h:1329:   return (__m128i) ((__v2du)__A ^ (__v2du)__B);
+	.loc 3 1329 33 is_stmt 0 view .LVU1331
+	vpxor	%xmm5, %xmm0, %xmm0	# _529, tmp1387, tmp1399
+.LVL207:
+	.loc 3 1329 33 view .LVU1332
+.LBE2683:
+.LBE2687:
+.LBB2688:
+.LBB2686:
+# /usr/lib/gcc/x86_64-linux-gnu/12/include/avx512vlintrin.h:11665:   return (__m128i) __builtin_ia32_prord128_mask ((__v4si) __A, __B,
+	.loc 2 11665 20 view .LVU1333
+	vprord	$8, %xmm0, %xmm0	#, tmp1399, tmp1398
+.LVL208:
+	.loc 2 11665 20 view .LVU1334
+.LBE2686:
+.LBE2688:
+	.loc 1 88 649 is_stmt 1 view .LVU1335
+.LBB2689:
+.LBI2689:
+	.loc 3 1064 1 view .LVU1336
+.LBB2690:
+	.loc 3 1066 3 view .LVU1337
+# /usr/lib/gcc/x86_64-linux-gnu/12/include/emmintrin.h:1066:   return (__m128i) ((__v4su)__A + (__v4su)__B);
+	.loc 3 1066 33 is_stmt 0 view .LVU1338
+	vpaddd	%xmm2, %xmm0, %xmm2	# _520, tmp1398, _536
+.LVL209:
+	.loc 3 1066 33 view .LVU1339
+.LBE2690:
+.LBE2689:
+	.loc 1 88 679 is_stmt 1 view .LVU1340
+.LBB2691:
+.LBI2691:
+	.loc 3 1327 1 view .LVU1341
+.LBB2692:
+	.loc 3 1329 3 view .LVU1342
+	.loc 3 1329 3 is_stmt 0 view .LVU1343
+.LBE2692:
+.LBE2691:
+.LBB2694:
+.LBI2694:
+	.loc 2 11663 1 is_stmt 1 view .LVU1344
+.LBB2695:
+	.loc 2 11665 3 view .LVU1345
+.LBE2695:
+.LBE2694:
+.LBB2697:
+.LBB2698:
+# /usr/lib/gcc/x86_64-linux-gnu/12/include/emmintrin.h:1458:   return (__m128i)__builtin_ia32_pshufd ((__v4si)__A, __mask);
+	.loc 3 1458 19 is_stmt 0 view .LVU1346
+	vpshufd	$147, %xmm0, %xmm0	#, tmp1398, tmp1412
+.LVL210:
+	.loc 3 1458 19 view .LVU1347
+.LBE2698:
+.LBE2697:
+.LBB2700:
+.LBB2693:
+# /usr/lib/gcc/x86_64-linux-gnu/12/include/emmintrin.h:1329:   return (__m128i) ((__v2du)__A ^ (__v2du)__B);
+	.loc 3 1329 33 view .LVU1348
+	vpxor	%xmm2, %xmm1, %xmm1	# _536, tmp1392, tmp1404
+.LVL211:
+	.loc 3 1329 33 view .LVU1349
+.LBE2693:
+.LBE2700:
+.LBB2701:
+.LBB2702:
+# /usr/lib/gcc/x86_64-linux-gnu/12/include/emmintrin.h:1458:   return (__m128i)__builtin_ia32_pshufd ((__v4si)__A, __mask);
+	.loc 3 1458 19 view .LVU1350
+	vpshufd	$78, %xmm2, %xmm2	#, _536, tmp1410
+.LVL212:
+	.loc 3 1458 19 view .LVU1351
+.LBE2702:
+.LBE2701:
+.LBB2704:
+.LBB2696:
+# /usr/lib/gcc/x86_64-linux-gnu/12/include/avx512vlintrin.h:11665:   return (__m128i) __builtin_ia32_prord128_mask ((__v4si) __A, __B,
+	.loc 2 11665 20 view .LVU1352
+	vprord	$7, %xmm1, %xmm1	#, tmp1404, tmp1403
+.LVL213:
+	.loc 2 11665 20 view .LVU1353
+.LBE2696:
+.LBE2704:
+	.loc 1 88 373 is_stmt 1 view .LVU1354
+	.loc 1 88 740 view .LVU1355
+.LBB2705:
+.LBI2705:
+	.loc 3 1456 1 view .LVU1356
+.LBB2706:
+	.loc 3 1458 3 view .LVU1357
+# /usr/lib/gcc/x86_64-linux-gnu/12/include/emmintrin.h:1458:   return (__m128i)__builtin_ia32_pshufd ((__v4si)__A, __mask);
+	.loc 3 1458 19 is_stmt 0 view .LVU1358
+	vpshufd	$57, %xmm1, %xmm1	#, tmp1403, tmp1408
+.LVL214:
+	.loc 3 1458 19 view .LVU1359
+.LBE2706:
+.LBE2705:
+	.loc 1 88 7 is_stmt 1 view .LVU1360
+.LBB2707:
+.LBI2701:
+	.loc 3 1456 1 view .LVU1361
+.LBB2703:
+	.loc 3 1458 3 view .LVU1362
+	.loc 3 1458 3 is_stmt 0 view .LVU1363
+.LBE2703:
+.LBE2707:
+	.loc 1 88 7 is_stmt 1 view .LVU1364
+.LBB2708:
+.LBI2697:
+	.loc 3 1456 1 view .LVU1365
+.LBB2699:
+	.loc 3 1458 3 view .LVU1366
+	.loc 3 1458 3 is_stmt 0 view .LVU1367
+.LBE2699:
+.LBE2708:
+	.loc 1 88 7 is_stmt 1 view .LVU1368
+	.loc 1 88 12 view .LVU1369
+.LBB2709:
+.LBI2709:
+	.loc 3 1064 1 view .LVU1370
+.LBB2710:
+	.loc 3 1066 3 view .LVU1371
+	.loc 3 1066 3 is_stmt 0 view .LVU1372
+.LBE2710:
+.LBE2709:
+.LBB2711:
+.LBI2711:
+	.loc 3 1064 1 is_stmt 1 view .LVU1373
+.LBB2712:
+	.loc 3 1066 3 view .LVU1374
+# /usr/lib/gcc/x86_64-linux-gnu/12/include/emmintrin.h:1066:   return (__m128i) ((__v4su)__A + (__v4su)__B);
+	.loc 3 1066 33 is_stmt 0 view .LVU1375
+	vpaddd	%xmm6, %xmm1, %xmm6	# tmp1382, tmp1408, tmp1414
+	vpaddd	%xmm5, %xmm6, %xmm5	# _529, tmp1414, _549
+.LVL215:
+	.loc 3 1066 33 view .LVU1376
+.LBE2712:
+.LBE2711:
+	.loc 1 88 61 is_stmt 1 view .LVU1377
+.LBB2713:
+.LBI2713:
+	.loc 3 1327 1 view .LVU1378
+.LBB2714:
+	.loc 3 1329 3 view .LVU1379
+	.loc 3 1329 3 is_stmt 0 view .LVU1380
+.LBE2714:
+.LBE2713:
+.LBB2716:
+.LBI2716:
+	.loc 2 11663 1 is_stmt 1 view .LVU1381
+.LBB2717:
+	.loc 2 11665 3 view .LVU1382
+.LBE2717:
+.LBE2716:
+.LBE2918:
+.LBB2919:
+.LBB2781:
+.LBB2782:
+# /usr/lib/gcc/x86_64-linux-gnu/12/include/avxintrin.h:1469:   return (__m128i) __builtin_ia32_si_si256 ((__v8si)__A);
+	.loc 4 1469 20 is_stmt 0 view .LVU1383
+	vmovdqa	%xmm9, %xmm6	# tmp1447, tmp1456
+.LBE2782:
+.LBE2781:
+.LBB2784:
+.LBB2785:
+# /usr/lib/gcc/x86_64-linux-gnu/12/include/avx2intrin.h:1098:   return (__m128i) __builtin_ia32_extract128i256 ((__v4di)__X, __M);
+	.loc 5 1098 20 view .LVU1384
+	vextracti32x4	$0x1, %ymm9, %xmm9	# tmp1447, tmp1458
+.LBE2785:
+.LBE2784:
+.LBE2919:
+.LBB2920:
+.LBB2719:
+.LBB2715:
+# /usr/lib/gcc/x86_64-linux-gnu/12/include/emmintrin.h:1329:   return (__m128i) ((__v2du)__A ^ (__v2du)__B);
+	.loc 3 1329 33 view .LVU1385
+	vpxor	%xmm5, %xmm0, %xmm0	# _549, tmp1412, tmp1416
+.LVL216:
+	.loc 3 1329 33 view .LVU1386
+.LBE2715:
+.LBE2719:
+.LBB2720:
+.LBB2718:
+# /usr/lib/gcc/x86_64-linux-gnu/12/include/avx512vlintrin.h:11665:   return (__m128i) __builtin_ia32_prord128_mask ((__v4si) __A, __B,
+	.loc 2 11665 20 view .LVU1387
+	vprold	$16, %xmm0, %xmm0	#, tmp1416, tmp1415
+.LVL217:
+	.loc 2 11665 20 view .LVU1388
+.LBE2718:
+.LBE2720:
+	.loc 1 88 110 is_stmt 1 view .LVU1389
+.LBB2721:
+.LBI2721:
+	.loc 3 1064 1 view .LVU1390
+.LBB2722:
+	.loc 3 1066 3 view .LVU1391
+# /usr/lib/gcc/x86_64-linux-gnu/12/include/emmintrin.h:1066:   return (__m128i) ((__v4su)__A + (__v4su)__B);
+	.loc 3 1066 33 is_stmt 0 view .LVU1392
+	vpaddd	%xmm0, %xmm2, %xmm2	# tmp1415, tmp1410, _557
+.LVL218:
+	.loc 3 1066 33 view .LVU1393
+.LBE2722:
+.LBE2721:
+	.loc 1 88 140 is_stmt 1 view .LVU1394
+.LBB2723:
+.LBI2723:
+	.loc 3 1327 1 view .LVU1395
+.LBB2724:
+	.loc 3 1329 3 view .LVU1396
+	.loc 3 1329 3 is_stmt 0 view .LVU1397
+.LBE2724:
+.LBE2723:
+.LBB2726:
+.LBI2726:
+	.loc 2 11663 1 is_stmt 1 view .LVU1398
+.LBB2727:
+	.loc 2 11665 3 view .LVU1399
+.LBE2727:
+.LBE2726:
+.LBB2729:
+.LBB2725:
+# /usr/lib/gcc/x86_64-linux-gnu/12/include/emmintrin.h:1329:   return (__m128i) ((__v2du)__A ^ (__v2du)__B);
+	.loc 3 1329 33 is_stmt 0 view .LVU1400
+	vpxor	%xmm2, %xmm1, %xmm1	# _557, tmp1408, tmp1421
+.LVL219:
+	.loc 3 1329 33 view .LVU1401
+.LBE2725:
+.LBE2729:
+.LBB2730:
+.LBB2728:
+# /usr/lib/gcc/x86_64-linux-gnu/12/include/avx512vlintrin.h:11665:   return (__m128i) __builtin_ia32_prord128_mask ((__v4si) __A, __B,
+	.loc 2 11665 20 view .LVU1402
+	vprord	$12, %xmm1, %xmm1	#, tmp1421, tmp1420
+.LVL220:
+	.loc 2 11665 20 view .LVU1403
+.LBE2728:
+.LBE2730:
+	.loc 1 88 189 is_stmt 1 view .LVU1404
+.LBB2731:
+.LBI2731:
+	.loc 3 1064 1 view .LVU1405
+.LBB2732:
+	.loc 3 1066 3 view .LVU1406
+	.loc 3 1066 3 is_stmt 0 view .LVU1407
+.LBE2732:
+.LBE2731:
+.LBB2733:
+.LBI2733:
+	.loc 3 1064 1 is_stmt 1 view .LVU1408
+.LBB2734:
+	.loc 3 1066 3 view .LVU1409
+# /usr/lib/gcc/x86_64-linux-gnu/12/include/emmintrin.h:1066:   return (__m128i) ((__v4su)__A + (__v4su)__B);
+	.loc 3 1066 33 is_stmt 0 view .LVU1410
+	vpaddd	%xmm8, %xmm1, %xmm8	# tmp1384, tmp1420, tmp1425
+.LVL221:
+	.loc 3 1066 33 view .LVU1411
+	vpaddd	%xmm5, %xmm8, %xmm8	# _549, tmp1425, _566
+.LVL222:
+	.loc 3 1066 33 view .LVU1412
+.LBE2734:
+.LBE2733:
+	.loc 1 88 238 is_stmt 1 view .LVU1413
+.LBB2735:
+.LBI2735:
+	.loc 3 1327 1 view .LVU1414
+.LBB2736:
+	.loc 3 1329 3 view .LVU1415
+	.loc 3 1329 3 is_stmt 0 view .LVU1416
+.LBE2736:
+.LBE2735:
+.LBB2738:
+.LBI2738:
+	.loc 2 11663 1 is_stmt 1 view .LVU1417
+.LBB2739:
+	.loc 2 11665 3 view .LVU1418
+.LBE2739:
+.LBE2738:
+.LBE2920:
+.LBB2921:
+.LBB2787:
+.LBB2788:
+# /usr/lib/gcc/x86_64-linux-gnu/12/include/avx512vlintrin.h:6676:   return (__m256i) __builtin_ia32_vpermt2vard256_mask ((__v8si) __I
+	.loc 2 6676 20 is_stmt 0 view .LVU1419
+	vmovdqa	.LC15(%rip), %ymm5	#, tmp1443
+.LBE2788:
+.LBE2787:
+.LBE2921:
+.LBB2922:
+.LBB2741:
+.LBB2737:
+# /usr/lib/gcc/x86_64-linux-gnu/12/include/emmintrin.h:1329:   return (__m128i) ((__v2du)__A ^ (__v2du)__B);
+	.loc 3 1329 33 view .LVU1420
+	vpxor	%xmm8, %xmm0, %xmm0	# _566, tmp1415, tmp1427
+.LVL223:
+	.loc 3 1329 33 view .LVU1421
+.LBE2737:
+.LBE2741:
+.LBB2742:
+.LBB2740:
+# /usr/lib/gcc/x86_64-linux-gnu/12/include/avx512vlintrin.h:11665:   return (__m128i) __builtin_ia32_prord128_mask ((__v4si) __A, __B,
+	.loc 2 11665 20 view .LVU1422
+	vprord	$8, %xmm0, %xmm0	#, tmp1427, tmp1426
+.LVL224:
+	.loc 2 11665 20 view .LVU1423
+.LBE2740:
+.LBE2742:
+	.loc 1 88 286 is_stmt 1 view .LVU1424
+.LBB2743:
+.LBI2743:
+	.loc 3 1064 1 view .LVU1425
+.LBB2744:
+	.loc 3 1066 3 view .LVU1426
+.LBE2744:
+.LBE2743:
+.LBE2922:
+.LBB2923:
+.LBB2791:
+.LBB2789:
+# /usr/lib/gcc/x86_64-linux-gnu/12/include/avx512vlintrin.h:6676:   return (__m256i) __builtin_ia32_vpermt2vard256_mask ((__v8si) __I
+	.loc 2 6676 20 is_stmt 0 view .LVU1427
+	vpermi2d	%ymm4, %ymm3, %ymm5	# mhi, mlo, tmp1442
+.LBE2789:
+.LBE2791:
+.LBB2792:
+.LBB2793:
+# /usr/lib/gcc/x86_64-linux-gnu/12/include/avxintrin.h:1469:   return (__m128i) __builtin_ia32_si_si256 ((__v8si)__A);
+	.loc 4 1469 20 view .LVU1428
+	vmovdqa	%xmm5, %xmm7	# tmp1442, tmp1452
+.LBE2793:
+.LBE2792:
+.LBB2795:
+.LBB2796:
+# /usr/lib/gcc/x86_64-linux-gnu/12/include/avx2intrin.h:1098:   return (__m128i) __builtin_ia32_extract128i256 ((__v4di)__X, __M);
+	.loc 5 1098 20 view .LVU1429
+	vextracti32x4	$0x1, %ymm5, %xmm5	# tmp1442, tmp1454
+.LBE2796:
+.LBE2795:
+.LBE2923:
+.LBB2924:
+.LBB2746:
+.LBB2745:
+# /usr/lib/gcc/x86_64-linux-gnu/12/include/emmintrin.h:1066:   return (__m128i) ((__v4su)__A + (__v4su)__B);
+	.loc 3 1066 33 view .LVU1430
+	vpaddd	%xmm2, %xmm0, %xmm2	# _557, tmp1426, _573
+.LVL225:
+	.loc 3 1066 33 view .LVU1431
+.LBE2745:
+.LBE2746:
+	.loc 1 88 316 is_stmt 1 view .LVU1432
+.LBB2747:
+.LBI2747:
+	.loc 3 1327 1 view .LVU1433
+.LBB2748:
+	.loc 3 1329 3 view .LVU1434
+	.loc 3 1329 3 is_stmt 0 view .LVU1435
+.LBE2748:
+.LBE2747:
+.LBB2750:
+.LBI2750:
+	.loc 2 11663 1 is_stmt 1 view .LVU1436
+.LBB2751:
+	.loc 2 11665 3 view .LVU1437
+.LBE2751:
+.LBE2750:
+.LBB2753:
+.LBB2754:
+# /usr/lib/gcc/x86_64-linux-gnu/12/include/emmintrin.h:1458:   return (__m128i)__builtin_ia32_pshufd ((__v4si)__A, __mask);
+	.loc 3 1458 19 is_stmt 0 view .LVU1438
+	vpshufd	$57, %xmm0, %xmm0	#, tmp1426, tmp1440
+.LVL226:
+	.loc 3 1458 19 view .LVU1439
+.LBE2754:
+.LBE2753:
+.LBB2756:
+.LBB2749:
+# /usr/lib/gcc/x86_64-linux-gnu/12/include/emmintrin.h:1329:   return (__m128i) ((__v2du)__A ^ (__v2du)__B);
+	.loc 3 1329 33 view .LVU1440
+	vpxor	%xmm2, %xmm1, %xmm1	# _573, tmp1420, tmp1432
+.LVL227:
+	.loc 3 1329 33 view .LVU1441
+.LBE2749:
+.LBE2756:
+.LBB2757:
+.LBB2758:
+# /usr/lib/gcc/x86_64-linux-gnu/12/include/emmintrin.h:1458:   return (__m128i)__builtin_ia32_pshufd ((__v4si)__A, __mask);
+	.loc 3 1458 19 view .LVU1442
+	vpshufd	$78, %xmm2, %xmm2	#, _573, tmp1438
+.LVL228:
+	.loc 3 1458 19 view .LVU1443
+.LBE2758:
+.LBE2757:
+.LBB2760:
+.LBB2752:
+# /usr/lib/gcc/x86_64-linux-gnu/12/include/avx512vlintrin.h:11665:   return (__m128i) __builtin_ia32_prord128_mask ((__v4si) __A, __B,
+	.loc 2 11665 20 view .LVU1444
+	vprord	$7, %xmm1, %xmm1	#, tmp1432, tmp1431
+.LVL229:
+	.loc 2 11665 20 view .LVU1445
+.LBE2752:
+.LBE2760:
+	.loc 1 88 10 is_stmt 1 view .LVU1446
+	.loc 1 88 377 view .LVU1447
+.LBB2761:
+.LBI2761:
+	.loc 3 1456 1 view .LVU1448
+.LBB2762:
+	.loc 3 1458 3 view .LVU1449
+# /usr/lib/gcc/x86_64-linux-gnu/12/include/emmintrin.h:1458:   return (__m128i)__builtin_ia32_pshufd ((__v4si)__A, __mask);
+	.loc 3 1458 19 is_stmt 0 view .LVU1450
+	vpshufd	$147, %xmm1, %xmm1	#, tmp1431, tmp1436
+.LVL230:
+	.loc 3 1458 19 view .LVU1451
+.LBE2762:
+.LBE2761:
+	.loc 1 88 7 is_stmt 1 view .LVU1452
+.LBB2763:
+.LBI2757:
+	.loc 3 1456 1 view .LVU1453
+.LBB2759:
+	.loc 3 1458 3 view .LVU1454
+	.loc 3 1458 3 is_stmt 0 view .LVU1455
+.LBE2759:
+.LBE2763:
+	.loc 1 88 7 is_stmt 1 view .LVU1456
+.LBB2764:
+.LBI2753:
+	.loc 3 1456 1 view .LVU1457
+.LBB2755:
+	.loc 3 1458 3 view .LVU1458
+	.loc 3 1458 3 is_stmt 0 view .LVU1459
+.LBE2755:
+.LBE2764:
+.LBE2924:
+	.loc 1 88 8 is_stmt 1 view .LVU1460
+	.loc 1 89 5 view .LVU1461
+.LBB2925:
+	.loc 1 89 10 view .LVU1462
+	.loc 1 89 26 view .LVU1463
+.LBB2798:
+.LBI2787:
+	.loc 2 6674 1 view .LVU1464
+.LBB2790:
+	.loc 2 6676 3 view .LVU1465
+	.loc 2 6676 3 is_stmt 0 view .LVU1466
+.LBE2790:
+.LBE2798:
+	.loc 1 89 127 is_stmt 1 view .LVU1467
+.LBB2799:
+.LBI2776:
+	.loc 2 6674 1 view .LVU1468
+.LBB2779:
+	.loc 2 6676 3 view .LVU1469
+	.loc 2 6676 3 is_stmt 0 view .LVU1470
+.LBE2779:
+.LBE2799:
+	.loc 1 89 228 is_stmt 1 view .LVU1471
+.LBB2800:
+.LBI2792:
+	.loc 4 1467 1 view .LVU1472
+.LBB2794:
+	.loc 4 1469 3 view .LVU1473
+	.loc 4 1469 3 is_stmt 0 view .LVU1474
+.LBE2794:
+.LBE2800:
+	.loc 1 89 261 is_stmt 1 view .LVU1475
+.LBB2801:
+.LBI2795:
+	.loc 5 1096 1 view .LVU1476
+.LBB2797:
+	.loc 5 1098 3 view .LVU1477
+	.loc 5 1098 3 is_stmt 0 view .LVU1478
+.LBE2797:
+.LBE2801:
+	.loc 1 89 299 is_stmt 1 view .LVU1479
+.LBB2802:
+.LBI2781:
+	.loc 4 1467 1 view .LVU1480
+.LBB2783:
+	.loc 4 1469 3 view .LVU1481
+	.loc 4 1469 3 is_stmt 0 view .LVU1482
+.LBE2783:
+.LBE2802:
+	.loc 1 89 332 is_stmt 1 view .LVU1483
+.LBB2803:
+.LBI2784:
+	.loc 5 1096 1 view .LVU1484
+.LBB2786:
+	.loc 5 1098 3 view .LVU1485
+	.loc 5 1098 3 is_stmt 0 view .LVU1486
+.LBE2786:
+.LBE2803:
+	.loc 1 89 370 is_stmt 1 view .LVU1487
+	.loc 1 89 375 view .LVU1488
+.LBB2804:
+.LBI2804:
+	.loc 3 1064 1 view .LVU1489
+.LBB2805:
+	.loc 3 1066 3 view .LVU1490
+	.loc 3 1066 3 is_stmt 0 view .LVU1491
+.LBE2805:
+.LBE2804:
+.LBB2806:
+.LBI2806:
+	.loc 3 1064 1 is_stmt 1 view .LVU1492
+.LBB2807:
+	.loc 3 1066 3 view .LVU1493
+# /usr/lib/gcc/x86_64-linux-gnu/12/include/emmintrin.h:1066:   return (__m128i) ((__v4su)__A + (__v4su)__B);
+	.loc 3 1066 33 is_stmt 0 view .LVU1494
+	vpaddd	%xmm7, %xmm1, %xmm7	# tmp1452, tmp1436, tmp1460
+	vpaddd	%xmm8, %xmm7, %xmm7	# _566, tmp1460, _594
+.LVL231:
+	.loc 3 1066 33 view .LVU1495
+.LBE2807:
+.LBE2806:
+	.loc 1 89 424 is_stmt 1 view .LVU1496
+.LBB2808:
+.LBI2808:
+	.loc 3 1327 1 view .LVU1497
+.LBB2809:
+	.loc 3 1329 3 view .LVU1498
+	.loc 3 1329 3 is_stmt 0 view .LVU1499
+.LBE2809:
+.LBE2808:
+.LBB2811:
+.LBI2811:
+	.loc 2 11663 1 is_stmt 1 view .LVU1500
+.LBB2812:
+	.loc 2 11665 3 view .LVU1501
+.LBE2812:
+.LBE2811:
+.LBB2814:
+.LBB2810:
+# /usr/lib/gcc/x86_64-linux-gnu/12/include/emmintrin.h:1329:   return (__m128i) ((__v2du)__A ^ (__v2du)__B);
+	.loc 3 1329 33 is_stmt 0 view .LVU1502
+	vpxor	%xmm7, %xmm0, %xmm0	# _594, tmp1440, tmp1462
+.LVL232:
+	.loc 3 1329 33 view .LVU1503
+.LBE2810:
+.LBE2814:
+.LBB2815:
+.LBB2813:
+# /usr/lib/gcc/x86_64-linux-gnu/12/include/avx512vlintrin.h:11665:   return (__m128i) __builtin_ia32_prord128_mask ((__v4si) __A, __B,
+	.loc 2 11665 20 view .LVU1504
+	vprold	$16, %xmm0, %xmm0	#, tmp1462, tmp1461
+.LVL233:
+	.loc 2 11665 20 view .LVU1505
+.LBE2813:
+.LBE2815:
+	.loc 1 89 473 is_stmt 1 view .LVU1506
+.LBB2816:
+.LBI2816:
+	.loc 3 1064 1 view .LVU1507
+.LBB2817:
+	.loc 3 1066 3 view .LVU1508
+# /usr/lib/gcc/x86_64-linux-gnu/12/include/emmintrin.h:1066:   return (__m128i) ((__v4su)__A + (__v4su)__B);
+	.loc 3 1066 33 is_stmt 0 view .LVU1509
+	vpaddd	%xmm0, %xmm2, %xmm2	# tmp1461, tmp1438, _602
+.LVL234:
+	.loc 3 1066 33 view .LVU1510
+.LBE2817:
+.LBE2816:
+	.loc 1 89 503 is_stmt 1 view .LVU1511
+.LBB2818:
+.LBI2818:
+	.loc 3 1327 1 view .LVU1512
+.LBB2819:
+	.loc 3 1329 3 view .LVU1513
+	.loc 3 1329 3 is_stmt 0 view .LVU1514
+.LBE2819:
+.LBE2818:
+.LBB2821:
+.LBI2821:
+	.loc 2 11663 1 is_stmt 1 view .LVU1515
+.LBB2822:
+	.loc 2 11665 3 view .LVU1516
+.LBE2822:
+.LBE2821:
+.LBB2824:
+.LBB2820:
+# /usr/lib/gcc/x86_64-linux-gnu/12/include/emmintrin.h:1329:   return (__m128i) ((__v2du)__A ^ (__v2du)__B);
+	.loc 3 1329 33 is_stmt 0 view .LVU1517
+	vpxor	%xmm2, %xmm1, %xmm1	# _602, tmp1436, tmp1467
+.LVL235:
+	.loc 3 1329 33 view .LVU1518
+.LBE2820:
+.LBE2824:
+.LBB2825:
+.LBB2823:
+# /usr/lib/gcc/x86_64-linux-gnu/12/include/avx512vlintrin.h:11665:   return (__m128i) __builtin_ia32_prord128_mask ((__v4si) __A, __B,
+	.loc 2 11665 20 view .LVU1519
+	vprord	$12, %xmm1, %xmm1	#, tmp1467, tmp1466
+.LVL236:
+	.loc 2 11665 20 view .LVU1520
+.LBE2823:
+.LBE2825:
+	.loc 1 89 552 is_stmt 1 view .LVU1521
+.LBB2826:
+.LBI2826:
+	.loc 3 1064 1 view .LVU1522
+.LBB2827:
+	.loc 3 1066 3 view .LVU1523
+	.loc 3 1066 3 is_stmt 0 view .LVU1524
+.LBE2827:
+.LBE2826:
+.LBB2828:
+.LBI2828:
+	.loc 3 1064 1 is_stmt 1 view .LVU1525
+.LBB2829:
+	.loc 3 1066 3 view .LVU1526
+# /usr/lib/gcc/x86_64-linux-gnu/12/include/emmintrin.h:1066:   return (__m128i) ((__v4su)__A + (__v4su)__B);
+	.loc 3 1066 33 is_stmt 0 view .LVU1527
+	vpaddd	%xmm5, %xmm1, %xmm5	# tmp1454, tmp1466, tmp1471
+.LVL237:
+	.loc 3 1066 33 view .LVU1528
+	vpaddd	%xmm7, %xmm5, %xmm5	# _594, tmp1471, _611
+.LVL238:
+	.loc 3 1066 33 view .LVU1529
+.LBE2829:
+.LBE2828:
+	.loc 1 89 601 is_stmt 1 view .LVU1530
+.LBB2830:
+.LBI2830:
+	.loc 3 1327 1 view .LVU1531
+.LBB2831:
+	.loc 3 1329 3 view .LVU1532
+	.loc 3 1329 3 is_stmt 0 view .LVU1533
+.LBE2831:
+.LBE2830:
+.LBB2833:
+.LBI2833:
+	.loc 2 11663 1 is_stmt 1 view .LVU1534
+.LBB2834:
+	.loc 2 11665 3 view .LVU1535
+.LBE2834:
+.LBE2833:
+.LBE2925:
+.LBB2926:
+.LBB2927:
+.LBB2928:
+# /usr/lib/gcc/x86_64-linux-gnu/12/include/avx512vlintrin.h:6676:   return (__m256i) __builtin_ia32_vpermt2vard256_mask ((__v8si) __I
+	.loc 2 6676 20 is_stmt 0 view .LVU1536
+	vmovdqa	.LC18(%rip), %ymm7	#, tmp1522
+.LBE2928:
+.LBE2927:
+.LBE2926:
+.LBB3067:
+.LBB2836:
+.LBB2832:
+# /usr/lib/gcc/x86_64-linux-gnu/12/include/emmintrin.h:1329:   return (__m128i) ((__v2du)__A ^ (__v2du)__B);
+	.loc 3 1329 33 view .LVU1537
+	vpxor	%xmm5, %xmm0, %xmm0	# _611, tmp1461, tmp1473
+.LVL239:
+	.loc 3 1329 33 view .LVU1538
+.LBE2832:
+.LBE2836:
+.LBB2837:
+.LBB2835:
+# /usr/lib/gcc/x86_64-linux-gnu/12/include/avx512vlintrin.h:11665:   return (__m128i) __builtin_ia32_prord128_mask ((__v4si) __A, __B,
+	.loc 2 11665 20 view .LVU1539
+	vprord	$8, %xmm0, %xmm0	#, tmp1473, tmp1472
+.LVL240:
+	.loc 2 11665 20 view .LVU1540
+.LBE2835:
+.LBE2837:
+	.loc 1 89 649 is_stmt 1 view .LVU1541
+.LBB2838:
+.LBI2838:
+	.loc 3 1064 1 view .LVU1542
+.LBB2839:
+	.loc 3 1066 3 view .LVU1543
+.LBE2839:
+.LBE2838:
+.LBE3067:
+.LBB3068:
+.LBB2931:
+.LBB2929:
+# /usr/lib/gcc/x86_64-linux-gnu/12/include/avx512vlintrin.h:6676:   return (__m256i) __builtin_ia32_vpermt2vard256_mask ((__v8si) __I
+	.loc 2 6676 20 is_stmt 0 view .LVU1544
+	vpermi2d	%ymm4, %ymm3, %ymm7	# mhi, mlo, tmp1521
+.LBE2929:
+.LBE2931:
+.LBE3068:
+.LBB3069:
+.LBB2841:
+.LBB2840:
+# /usr/lib/gcc/x86_64-linux-gnu/12/include/emmintrin.h:1066:   return (__m128i) ((__v4su)__A + (__v4su)__B);
+	.loc 3 1066 33 view .LVU1545
+	vpaddd	%xmm2, %xmm0, %xmm2	# _602, tmp1472, _618
+.LVL241:
+	.loc 3 1066 33 view .LVU1546
+.LBE2840:
+.LBE2841:
+	.loc 1 89 679 is_stmt 1 view .LVU1547
+.LBB2842:
+.LBI2842:
+	.loc 3 1327 1 view .LVU1548
+.LBB2843:
+	.loc 3 1329 3 view .LVU1549
+	.loc 3 1329 3 is_stmt 0 view .LVU1550
+.LBE2843:
+.LBE2842:
+.LBB2845:
+.LBI2845:
+	.loc 2 11663 1 is_stmt 1 view .LVU1551
+.LBB2846:
+	.loc 2 11665 3 view .LVU1552
+.LBE2846:
+.LBE2845:
+.LBB2848:
+.LBB2849:
+# /usr/lib/gcc/x86_64-linux-gnu/12/include/emmintrin.h:1458:   return (__m128i)__builtin_ia32_pshufd ((__v4si)__A, __mask);
+	.loc 3 1458 19 is_stmt 0 view .LVU1553
+	vpshufd	$147, %xmm0, %xmm0	#, tmp1472, tmp1486
+.LVL242:
+	.loc 3 1458 19 view .LVU1554
+.LBE2849:
+.LBE2848:
+.LBB2851:
+.LBB2844:
+# /usr/lib/gcc/x86_64-linux-gnu/12/include/emmintrin.h:1329:   return (__m128i) ((__v2du)__A ^ (__v2du)__B);
+	.loc 3 1329 33 view .LVU1555
+	vpxor	%xmm2, %xmm1, %xmm1	# _618, tmp1466, tmp1478
+.LVL243:
+	.loc 3 1329 33 view .LVU1556
+.LBE2844:
+.LBE2851:
+.LBB2852:
+.LBB2853:
+# /usr/lib/gcc/x86_64-linux-gnu/12/include/emmintrin.h:1458:   return (__m128i)__builtin_ia32_pshufd ((__v4si)__A, __mask);
+	.loc 3 1458 19 view .LVU1557
+	vpshufd	$78, %xmm2, %xmm2	#, _618, tmp1484
+.LVL244:
+	.loc 3 1458 19 view .LVU1558
+.LBE2853:
+.LBE2852:
+.LBB2855:
+.LBB2847:
+# /usr/lib/gcc/x86_64-linux-gnu/12/include/avx512vlintrin.h:11665:   return (__m128i) __builtin_ia32_prord128_mask ((__v4si) __A, __B,
+	.loc 2 11665 20 view .LVU1559
+	vprord	$7, %xmm1, %xmm1	#, tmp1478, tmp1477
+.LVL245:
+	.loc 2 11665 20 view .LVU1560
+.LBE2847:
+.LBE2855:
+	.loc 1 89 373 is_stmt 1 view .LVU1561
+	.loc 1 89 740 view .LVU1562
+.LBB2856:
+.LBI2856:
+	.loc 3 1456 1 view .LVU1563
+.LBB2857:
+	.loc 3 1458 3 view .LVU1564
+# /usr/lib/gcc/x86_64-linux-gnu/12/include/emmintrin.h:1458:   return (__m128i)__builtin_ia32_pshufd ((__v4si)__A, __mask);
+	.loc 3 1458 19 is_stmt 0 view .LVU1565
+	vpshufd	$57, %xmm1, %xmm1	#, tmp1477, tmp1482
+.LVL246:
+	.loc 3 1458 19 view .LVU1566
+.LBE2857:
+.LBE2856:
+	.loc 1 89 7 is_stmt 1 view .LVU1567
+.LBB2858:
+.LBI2852:
+	.loc 3 1456 1 view .LVU1568
+.LBB2854:
+	.loc 3 1458 3 view .LVU1569
+	.loc 3 1458 3 is_stmt 0 view .LVU1570
+.LBE2854:
+.LBE2858:
+	.loc 1 89 7 is_stmt 1 view .LVU1571
+.LBB2859:
+.LBI2848:
+	.loc 3 1456 1 view .LVU1572
+.LBB2850:
+	.loc 3 1458 3 view .LVU1573
+	.loc 3 1458 3 is_stmt 0 view .LVU1574
+.LBE2850:
+.LBE2859:
+	.loc 1 89 7 is_stmt 1 view .LVU1575
+	.loc 1 89 12 view .LVU1576
+.LBB2860:
+.LBI2860:
+	.loc 3 1064 1 view .LVU1577
+.LBB2861:
+	.loc 3 1066 3 view .LVU1578
+	.loc 3 1066 3 is_stmt 0 view .LVU1579
+.LBE2861:
+.LBE2860:
+.LBB2862:
+.LBI2862:
+	.loc 3 1064 1 is_stmt 1 view .LVU1580
+.LBB2863:
+	.loc 3 1066 3 view .LVU1581
+# /usr/lib/gcc/x86_64-linux-gnu/12/include/emmintrin.h:1066:   return (__m128i) ((__v4su)__A + (__v4su)__B);
+	.loc 3 1066 33 is_stmt 0 view .LVU1582
+	vpaddd	%xmm6, %xmm1, %xmm6	# tmp1456, tmp1482, tmp1488
+	vpaddd	%xmm5, %xmm6, %xmm5	# _611, tmp1488, _631
+.LVL247:
+	.loc 3 1066 33 view .LVU1583
+.LBE2863:
+.LBE2862:
+	.loc 1 89 61 is_stmt 1 view .LVU1584
+.LBB2864:
+.LBI2864:
+	.loc 3 1327 1 view .LVU1585
+.LBB2865:
+	.loc 3 1329 3 view .LVU1586
+	.loc 3 1329 3 is_stmt 0 view .LVU1587
+.LBE2865:
+.LBE2864:
+.LBB2867:
+.LBI2867:
+	.loc 2 11663 1 is_stmt 1 view .LVU1588
+.LBB2868:
+	.loc 2 11665 3 view .LVU1589
+.LBE2868:
+.LBE2867:
+.LBE3069:
+.LBB3070:
+.LBB2932:
+.LBB2933:
+# /usr/lib/gcc/x86_64-linux-gnu/12/include/avxintrin.h:1469:   return (__m128i) __builtin_ia32_si_si256 ((__v8si)__A);
+	.loc 4 1469 20 is_stmt 0 view .LVU1590
+	vmovdqa	%xmm7, %xmm6	# tmp1521, tmp1530
+.LBE2933:
+.LBE2932:
+.LBB2935:
+.LBB2936:
+# /usr/lib/gcc/x86_64-linux-gnu/12/include/avx2intrin.h:1098:   return (__m128i) __builtin_ia32_extract128i256 ((__v4di)__X, __M);
+	.loc 5 1098 20 view .LVU1591
+	vextracti32x4	$0x1, %ymm7, %xmm7	# tmp1521, tmp1532
+.LBE2936:
+.LBE2935:
+.LBE3070:
+.LBB3071:
+.LBB2870:
+.LBB2866:
+# /usr/lib/gcc/x86_64-linux-gnu/12/include/emmintrin.h:1329:   return (__m128i) ((__v2du)__A ^ (__v2du)__B);
+	.loc 3 1329 33 view .LVU1592
+	vpxor	%xmm5, %xmm0, %xmm0	# _631, tmp1486, tmp1490
+.LVL248:
+	.loc 3 1329 33 view .LVU1593
+.LBE2866:
+.LBE2870:
+.LBB2871:
+.LBB2869:
+# /usr/lib/gcc/x86_64-linux-gnu/12/include/avx512vlintrin.h:11665:   return (__m128i) __builtin_ia32_prord128_mask ((__v4si) __A, __B,
+	.loc 2 11665 20 view .LVU1594
+	vprold	$16, %xmm0, %xmm0	#, tmp1490, tmp1489
+.LVL249:
+	.loc 2 11665 20 view .LVU1595
+.LBE2869:
+.LBE2871:
+	.loc 1 89 110 is_stmt 1 view .LVU1596
+.LBB2872:
+.LBI2872:
+	.loc 3 1064 1 view .LVU1597
+.LBB2873:
+	.loc 3 1066 3 view .LVU1598
+# /usr/lib/gcc/x86_64-linux-gnu/12/include/emmintrin.h:1066:   return (__m128i) ((__v4su)__A + (__v4su)__B);
+	.loc 3 1066 33 is_stmt 0 view .LVU1599
+	vpaddd	%xmm0, %xmm2, %xmm2	# tmp1489, tmp1484, _639
+.LVL250:
+	.loc 3 1066 33 view .LVU1600
+.LBE2873:
+.LBE2872:
+	.loc 1 89 140 is_stmt 1 view .LVU1601
+.LBB2874:
+.LBI2874:
+	.loc 3 1327 1 view .LVU1602
+.LBB2875:
+	.loc 3 1329 3 view .LVU1603
+	.loc 3 1329 3 is_stmt 0 view .LVU1604
+.LBE2875:
+.LBE2874:
+.LBB2877:
+.LBI2877:
+	.loc 2 11663 1 is_stmt 1 view .LVU1605
+.LBB2878:
+	.loc 2 11665 3 view .LVU1606
+.LBE2878:
+.LBE2877:
+.LBB2880:
+.LBB2876:
+# /usr/lib/gcc/x86_64-linux-gnu/12/include/emmintrin.h:1329:   return (__m128i) ((__v2du)__A ^ (__v2du)__B);
+	.loc 3 1329 33 is_stmt 0 view .LVU1607
+	vpxor	%xmm2, %xmm1, %xmm1	# _639, tmp1482, tmp1495
+.LVL251:
+	.loc 3 1329 33 view .LVU1608
+.LBE2876:
+.LBE2880:
+.LBB2881:
+.LBB2879:
+# /usr/lib/gcc/x86_64-linux-gnu/12/include/avx512vlintrin.h:11665:   return (__m128i) __builtin_ia32_prord128_mask ((__v4si) __A, __B,
+	.loc 2 11665 20 view .LVU1609
+	vprord	$12, %xmm1, %xmm1	#, tmp1495, tmp1494
+.LVL252:
+	.loc 2 11665 20 view .LVU1610
+.LBE2879:
+.LBE2881:
+	.loc 1 89 189 is_stmt 1 view .LVU1611
+.LBB2882:
+.LBI2882:
+	.loc 3 1064 1 view .LVU1612
+.LBB2883:
+	.loc 3 1066 3 view .LVU1613
+	.loc 3 1066 3 is_stmt 0 view .LVU1614
+.LBE2883:
+.LBE2882:
+.LBB2884:
+.LBI2884:
+	.loc 3 1064 1 is_stmt 1 view .LVU1615
+.LBB2885:
+	.loc 3 1066 3 view .LVU1616
+# /usr/lib/gcc/x86_64-linux-gnu/12/include/emmintrin.h:1066:   return (__m128i) ((__v4su)__A + (__v4su)__B);
+	.loc 3 1066 33 is_stmt 0 view .LVU1617
+	vpaddd	%xmm9, %xmm1, %xmm9	# tmp1458, tmp1494, tmp1499
+.LVL253:
+	.loc 3 1066 33 view .LVU1618
+	vpaddd	%xmm5, %xmm9, %xmm9	# _631, tmp1499, _648
+.LVL254:
+	.loc 3 1066 33 view .LVU1619
+.LBE2885:
+.LBE2884:
+	.loc 1 89 238 is_stmt 1 view .LVU1620
+.LBB2886:
+.LBI2886:
+	.loc 3 1327 1 view .LVU1621
+.LBB2887:
+	.loc 3 1329 3 view .LVU1622
+	.loc 3 1329 3 is_stmt 0 view .LVU1623
+.LBE2887:
+.LBE2886:
+.LBB2889:
+.LBI2889:
+	.loc 2 11663 1 is_stmt 1 view .LVU1624
+.LBB2890:
+	.loc 2 11665 3 view .LVU1625
+.LBE2890:
+.LBE2889:
+.LBE3071:
+.LBB3072:
+.LBB2938:
+.LBB2939:
+# /usr/lib/gcc/x86_64-linux-gnu/12/include/avx512vlintrin.h:6676:   return (__m256i) __builtin_ia32_vpermt2vard256_mask ((__v8si) __I
+	.loc 2 6676 20 is_stmt 0 view .LVU1626
+	vmovdqa	.LC17(%rip), %ymm5	#, tmp1517
+.LBE2939:
+.LBE2938:
+.LBE3072:
+.LBB3073:
+.LBB2892:
+.LBB2888:
+# /usr/lib/gcc/x86_64-linux-gnu/12/include/emmintrin.h:1329:   return (__m128i) ((__v2du)__A ^ (__v2du)__B);
+	.loc 3 1329 33 view .LVU1627
+	vpxor	%xmm9, %xmm0, %xmm0	# _648, tmp1489, tmp1501
+.LVL255:
+	.loc 3 1329 33 view .LVU1628
+.LBE2888:
+.LBE2892:
+.LBB2893:
+.LBB2891:
+# /usr/lib/gcc/x86_64-linux-gnu/12/include/avx512vlintrin.h:11665:   return (__m128i) __builtin_ia32_prord128_mask ((__v4si) __A, __B,
+	.loc 2 11665 20 view .LVU1629
+	vprord	$8, %xmm0, %xmm0	#, tmp1501, tmp1500
+.LVL256:
+	.loc 2 11665 20 view .LVU1630
+.LBE2891:
+.LBE2893:
+	.loc 1 89 286 is_stmt 1 view .LVU1631
+.LBB2894:
+.LBI2894:
+	.loc 3 1064 1 view .LVU1632
+.LBB2895:
+	.loc 3 1066 3 view .LVU1633
+.LBE2895:
+.LBE2894:
+.LBE3073:
+.LBB3074:
+.LBB2942:
+.LBB2940:
+# /usr/lib/gcc/x86_64-linux-gnu/12/include/avx512vlintrin.h:6676:   return (__m256i) __builtin_ia32_vpermt2vard256_mask ((__v8si) __I
+	.loc 2 6676 20 is_stmt 0 view .LVU1634
+	vpermi2d	%ymm4, %ymm3, %ymm5	# mhi, mlo, tmp1516
+.LBE2940:
+.LBE2942:
+.LBB2943:
+.LBB2944:
+# /usr/lib/gcc/x86_64-linux-gnu/12/include/avxintrin.h:1469:   return (__m128i) __builtin_ia32_si_si256 ((__v8si)__A);
+	.loc 4 1469 20 view .LVU1635
+	vmovdqa	%xmm5, %xmm8	# tmp1516, tmp1526
+.LBE2944:
+.LBE2943:
+.LBB2946:
+.LBB2947:
+# /usr/lib/gcc/x86_64-linux-gnu/12/include/avx2intrin.h:1098:   return (__m128i) __builtin_ia32_extract128i256 ((__v4di)__X, __M);
+	.loc 5 1098 20 view .LVU1636
+	vextracti32x4	$0x1, %ymm5, %xmm5	# tmp1516, tmp1528
+.LBE2947:
+.LBE2946:
+.LBE3074:
+.LBB3075:
+.LBB2897:
+.LBB2896:
+# /usr/lib/gcc/x86_64-linux-gnu/12/include/emmintrin.h:1066:   return (__m128i) ((__v4su)__A + (__v4su)__B);
+	.loc 3 1066 33 view .LVU1637
+	vpaddd	%xmm2, %xmm0, %xmm2	# _639, tmp1500, _655
+.LVL257:
+	.loc 3 1066 33 view .LVU1638
+.LBE2896:
+.LBE2897:
+	.loc 1 89 316 is_stmt 1 view .LVU1639
+.LBB2898:
+.LBI2898:
+	.loc 3 1327 1 view .LVU1640
+.LBB2899:
+	.loc 3 1329 3 view .LVU1641
+	.loc 3 1329 3 is_stmt 0 view .LVU1642
+.LBE2899:
+.LBE2898:
+.LBB2901:
+.LBI2901:
+	.loc 2 11663 1 is_stmt 1 view .LVU1643
+.LBB2902:
+	.loc 2 11665 3 view .LVU1644
+.LBE2902:
+.LBE2901:
+.LBB2904:
+.LBB2905:
+# /usr/lib/gcc/x86_64-linux-gnu/12/include/emmintrin.h:1458:   return (__m128i)__builtin_ia32_pshufd ((__v4si)__A, __mask);
+	.loc 3 1458 19 is_stmt 0 view .LVU1645
+	vpshufd	$57, %xmm0, %xmm0	#, tmp1500, tmp1514
+.LVL258:
+	.loc 3 1458 19 view .LVU1646
+.LBE2905:
+.LBE2904:
+.LBB2907:
+.LBB2900:
+# /usr/lib/gcc/x86_64-linux-gnu/12/include/emmintrin.h:1329:   return (__m128i) ((__v2du)__A ^ (__v2du)__B);
+	.loc 3 1329 33 view .LVU1647
+	vpxor	%xmm2, %xmm1, %xmm1	# _655, tmp1494, tmp1506
+.LVL259:
+	.loc 3 1329 33 view .LVU1648
+.LBE2900:
+.LBE2907:
+.LBB2908:
+.LBB2909:
+# /usr/lib/gcc/x86_64-linux-gnu/12/include/emmintrin.h:1458:   return (__m128i)__builtin_ia32_pshufd ((__v4si)__A, __mask);
+	.loc 3 1458 19 view .LVU1649
+	vpshufd	$78, %xmm2, %xmm2	#, _655, tmp1512
+.LVL260:
+	.loc 3 1458 19 view .LVU1650
+.LBE2909:
+.LBE2908:
+.LBB2911:
+.LBB2903:
+# /usr/lib/gcc/x86_64-linux-gnu/12/include/avx512vlintrin.h:11665:   return (__m128i) __builtin_ia32_prord128_mask ((__v4si) __A, __B,
+	.loc 2 11665 20 view .LVU1651
+	vprord	$7, %xmm1, %xmm1	#, tmp1506, tmp1505
+.LVL261:
+	.loc 2 11665 20 view .LVU1652
+.LBE2903:
+.LBE2911:
+	.loc 1 89 10 is_stmt 1 view .LVU1653
+	.loc 1 89 377 view .LVU1654
+.LBB2912:
+.LBI2912:
+	.loc 3 1456 1 view .LVU1655
+.LBB2913:
+	.loc 3 1458 3 view .LVU1656
+# /usr/lib/gcc/x86_64-linux-gnu/12/include/emmintrin.h:1458:   return (__m128i)__builtin_ia32_pshufd ((__v4si)__A, __mask);
+	.loc 3 1458 19 is_stmt 0 view .LVU1657
+	vpshufd	$147, %xmm1, %xmm1	#, tmp1505, tmp1510
+.LVL262:
+	.loc 3 1458 19 view .LVU1658
+.LBE2913:
+.LBE2912:
+	.loc 1 89 7 is_stmt 1 view .LVU1659
+.LBB2914:
+.LBI2908:
+	.loc 3 1456 1 view .LVU1660
+.LBB2910:
+	.loc 3 1458 3 view .LVU1661
+	.loc 3 1458 3 is_stmt 0 view .LVU1662
+.LBE2910:
+.LBE2914:
+	.loc 1 89 7 is_stmt 1 view .LVU1663
+.LBB2915:
+.LBI2904:
+	.loc 3 1456 1 view .LVU1664
+.LBB2906:
+	.loc 3 1458 3 view .LVU1665
+	.loc 3 1458 3 is_stmt 0 view .LVU1666
+.LBE2906:
+.LBE2915:
+.LBE3075:
+	.loc 1 89 8 is_stmt 1 view .LVU1667
+	.loc 1 90 5 view .LVU1668
+.LBB3076:
+	.loc 1 90 10 view .LVU1669
+	.loc 1 90 26 view .LVU1670
+.LBB2949:
+.LBI2938:
+	.loc 2 6674 1 view .LVU1671
+.LBB2941:
+	.loc 2 6676 3 view .LVU1672
+	.loc 2 6676 3 is_stmt 0 view .LVU1673
+.LBE2941:
+.LBE2949:
+	.loc 1 90 127 is_stmt 1 view .LVU1674
+.LBB2950:
+.LBI2927:
+	.loc 2 6674 1 view .LVU1675
+.LBB2930:
+	.loc 2 6676 3 view .LVU1676
+	.loc 2 6676 3 is_stmt 0 view .LVU1677
+.LBE2930:
+.LBE2950:
+	.loc 1 90 228 is_stmt 1 view .LVU1678
+.LBB2951:
+.LBI2943:
+	.loc 4 1467 1 view .LVU1679
+.LBB2945:
+	.loc 4 1469 3 view .LVU1680
+	.loc 4 1469 3 is_stmt 0 view .LVU1681
+.LBE2945:
+.LBE2951:
+	.loc 1 90 261 is_stmt 1 view .LVU1682
+.LBB2952:
+.LBI2946:
+	.loc 5 1096 1 view .LVU1683
+.LBB2948:
+	.loc 5 1098 3 view .LVU1684
+	.loc 5 1098 3 is_stmt 0 view .LVU1685
+.LBE2948:
+.LBE2952:
+	.loc 1 90 299 is_stmt 1 view .LVU1686
+.LBB2953:
+.LBI2932:
+	.loc 4 1467 1 view .LVU1687
+.LBB2934:
+	.loc 4 1469 3 view .LVU1688
+	.loc 4 1469 3 is_stmt 0 view .LVU1689
+.LBE2934:
+.LBE2953:
+	.loc 1 90 332 is_stmt 1 view .LVU1690
+.LBB2954:
+.LBI2935:
+	.loc 5 1096 1 view .LVU1691
+.LBB2937:
+	.loc 5 1098 3 view .LVU1692
+	.loc 5 1098 3 is_stmt 0 view .LVU1693
+.LBE2937:
+.LBE2954:
+	.loc 1 90 370 is_stmt 1 view .LVU1694
+	.loc 1 90 375 view .LVU1695
+.LBB2955:
+.LBI2955:
+	.loc 3 1064 1 view .LVU1696
+.LBB2956:
+	.loc 3 1066 3 view .LVU1697
+	.loc 3 1066 3 is_stmt 0 view .LVU1698
+.LBE2956:
+.LBE2955:
+.LBB2957:
+.LBI2957:
+	.loc 3 1064 1 is_stmt 1 view .LVU1699
+.LBB2958:
+	.loc 3 1066 3 view .LVU1700
+# /usr/lib/gcc/x86_64-linux-gnu/12/include/emmintrin.h:1066:   return (__m128i) ((__v4su)__A + (__v4su)__B);
+	.loc 3 1066 33 is_stmt 0 view .LVU1701
+	vpaddd	%xmm8, %xmm1, %xmm8	# tmp1526, tmp1510, tmp1534
+	vpaddd	%xmm9, %xmm8, %xmm8	# _648, tmp1534, _676
+.LVL263:
+	.loc 3 1066 33 view .LVU1702
+.LBE2958:
+.LBE2957:
+	.loc 1 90 424 is_stmt 1 view .LVU1703
+.LBB2959:
+.LBI2959:
+	.loc 3 1327 1 view .LVU1704
+.LBB2960:
+	.loc 3 1329 3 view .LVU1705
+	.loc 3 1329 3 is_stmt 0 view .LVU1706
+.LBE2960:
+.LBE2959:
+.LBB2962:
+.LBI2962:
+	.loc 2 11663 1 is_stmt 1 view .LVU1707
+.LBB2963:
+	.loc 2 11665 3 view .LVU1708
+.LBE2963:
+.LBE2962:
+.LBB2965:
+.LBB2961:
+# /usr/lib/gcc/x86_64-linux-gnu/12/include/emmintrin.h:1329:   return (__m128i) ((__v2du)__A ^ (__v2du)__B);
+	.loc 3 1329 33 is_stmt 0 view .LVU1709
+	vpxor	%xmm8, %xmm0, %xmm0	# _676, tmp1514, tmp1536
+.LVL264:
+	.loc 3 1329 33 view .LVU1710
+.LBE2961:
+.LBE2965:
+.LBB2966:
+.LBB2964:
+# /usr/lib/gcc/x86_64-linux-gnu/12/include/avx512vlintrin.h:11665:   return (__m128i) __builtin_ia32_prord128_mask ((__v4si) __A, __B,
+	.loc 2 11665 20 view .LVU1711
+	vprold	$16, %xmm0, %xmm0	#, tmp1536, tmp1535
+.LVL265:
+	.loc 2 11665 20 view .LVU1712
+.LBE2964:
+.LBE2966:
+	.loc 1 90 473 is_stmt 1 view .LVU1713
+.LBB2967:
+.LBI2967:
+	.loc 3 1064 1 view .LVU1714
+.LBB2968:
+	.loc 3 1066 3 view .LVU1715
+# /usr/lib/gcc/x86_64-linux-gnu/12/include/emmintrin.h:1066:   return (__m128i) ((__v4su)__A + (__v4su)__B);
+	.loc 3 1066 33 is_stmt 0 view .LVU1716
+	vpaddd	%xmm0, %xmm2, %xmm2	# tmp1535, tmp1512, _684
+.LVL266:
+	.loc 3 1066 33 view .LVU1717
+.LBE2968:
+.LBE2967:
+	.loc 1 90 503 is_stmt 1 view .LVU1718
+.LBB2969:
+.LBI2969:
+	.loc 3 1327 1 view .LVU1719
+.LBB2970:
+	.loc 3 1329 3 view .LVU1720
+	.loc 3 1329 3 is_stmt 0 view .LVU1721
+.LBE2970:
+.LBE2969:
+.LBB2972:
+.LBI2972:
+	.loc 2 11663 1 is_stmt 1 view .LVU1722
+.LBB2973:
+	.loc 2 11665 3 view .LVU1723
+.LBE2973:
+.LBE2972:
+.LBB2975:
+.LBB2971:
+# /usr/lib/gcc/x86_64-linux-gnu/12/include/emmintrin.h:1329:   return (__m128i) ((__v2du)__A ^ (__v2du)__B);
+	.loc 3 1329 33 is_stmt 0 view .LVU1724
+	vpxor	%xmm2, %xmm1, %xmm1	# _684, tmp1510, tmp1541
+.LVL267:
+	.loc 3 1329 33 view .LVU1725
+.LBE2971:
+.LBE2975:
+.LBB2976:
+.LBB2974:
+# /usr/lib/gcc/x86_64-linux-gnu/12/include/avx512vlintrin.h:11665:   return (__m128i) __builtin_ia32_prord128_mask ((__v4si) __A, __B,
+	.loc 2 11665 20 view .LVU1726
+	vprord	$12, %xmm1, %xmm1	#, tmp1541, tmp1540
+.LVL268:
+	.loc 2 11665 20 view .LVU1727
+.LBE2974:
+.LBE2976:
+	.loc 1 90 552 is_stmt 1 view .LVU1728
+.LBB2977:
+.LBI2977:
+	.loc 3 1064 1 view .LVU1729
+.LBB2978:
+	.loc 3 1066 3 view .LVU1730
+	.loc 3 1066 3 is_stmt 0 view .LVU1731
+.LBE2978:
+.LBE2977:
+.LBB2979:
+.LBI2979:
+	.loc 3 1064 1 is_stmt 1 view .LVU1732
+.LBB2980:
+	.loc 3 1066 3 view .LVU1733
+# /usr/lib/gcc/x86_64-linux-gnu/12/include/emmintrin.h:1066:   return (__m128i) ((__v4su)__A + (__v4su)__B);
+	.loc 3 1066 33 is_stmt 0 view .LVU1734
+	vpaddd	%xmm5, %xmm1, %xmm5	# tmp1528, tmp1540, tmp1545
+.LVL269:
+	.loc 3 1066 33 view .LVU1735
+	vpaddd	%xmm8, %xmm5, %xmm5	# _676, tmp1545, _693
+.LVL270:
+	.loc 3 1066 33 view .LVU1736
+.LBE2980:
+.LBE2979:
+	.loc 1 90 601 is_stmt 1 view .LVU1737
+.LBB2981:
+.LBI2981:
+	.loc 3 1327 1 view .LVU1738
+.LBB2982:
+	.loc 3 1329 3 view .LVU1739
+	.loc 3 1329 3 is_stmt 0 view .LVU1740
+.LBE2982:
+.LBE2981:
+.LBB2984:
+.LBI2984:
+	.loc 2 11663 1 is_stmt 1 view .LVU1741
+.LBB2985:
+	.loc 2 11665 3 view .LVU1742
+.LBE2985:
+.LBE2984:
+.LBE3076:
+.LBB3077:
+.LBB3078:
+.LBB3079:
+# /usr/lib/gcc/x86_64-linux-gnu/12/include/avx512vlintrin.h:6676:   return (__m256i) __builtin_ia32_vpermt2vard256_mask ((__v8si) __I
+	.loc 2 6676 20 is_stmt 0 view .LVU1743
+	vmovdqa	.LC20(%rip), %ymm8	#, tmp1596
+.LBE3079:
+.LBE3078:
+.LBE3077:
+.LBB3214:
+.LBB2987:
+.LBB2983:
+# /usr/lib/gcc/x86_64-linux-gnu/12/include/emmintrin.h:1329:   return (__m128i) ((__v2du)__A ^ (__v2du)__B);
+	.loc 3 1329 33 view .LVU1744
+	vpxor	%xmm5, %xmm0, %xmm0	# _693, tmp1535, tmp1547
+.LVL271:
+	.loc 3 1329 33 view .LVU1745
+.LBE2983:
+.LBE2987:
+.LBB2988:
+.LBB2986:
+# /usr/lib/gcc/x86_64-linux-gnu/12/include/avx512vlintrin.h:11665:   return (__m128i) __builtin_ia32_prord128_mask ((__v4si) __A, __B,
+	.loc 2 11665 20 view .LVU1746
+	vprord	$8, %xmm0, %xmm0	#, tmp1547, tmp1546
+.LVL272:
+	.loc 2 11665 20 view .LVU1747
+.LBE2986:
+.LBE2988:
+	.loc 1 90 649 is_stmt 1 view .LVU1748
+.LBB2989:
+.LBI2989:
+	.loc 3 1064 1 view .LVU1749
+.LBB2990:
+	.loc 3 1066 3 view .LVU1750
+.LBE2990:
+.LBE2989:
+.LBE3214:
+.LBB3215:
+.LBB3082:
+.LBB3080:
+# /usr/lib/gcc/x86_64-linux-gnu/12/include/avx512vlintrin.h:6676:   return (__m256i) __builtin_ia32_vpermt2vard256_mask ((__v8si) __I
+	.loc 2 6676 20 is_stmt 0 view .LVU1751
+	vpermi2d	%ymm4, %ymm3, %ymm8	# mhi, mlo, tmp1595
+.LBE3080:
+.LBE3082:
+.LBE3215:
+.LBB3216:
+.LBB2992:
+.LBB2991:
+# /usr/lib/gcc/x86_64-linux-gnu/12/include/emmintrin.h:1066:   return (__m128i) ((__v4su)__A + (__v4su)__B);
+	.loc 3 1066 33 view .LVU1752
+	vpaddd	%xmm2, %xmm0, %xmm2	# _684, tmp1546, _700
+.LVL273:
+	.loc 3 1066 33 view .LVU1753
+.LBE2991:
+.LBE2992:
+	.loc 1 90 679 is_stmt 1 view .LVU1754
+.LBB2993:
+.LBI2993:
+	.loc 3 1327 1 view .LVU1755
+.LBB2994:
+	.loc 3 1329 3 view .LVU1756
+	.loc 3 1329 3 is_stmt 0 view .LVU1757
+.LBE2994:
+.LBE2993:
+.LBB2996:
+.LBI2996:
+	.loc 2 11663 1 is_stmt 1 view .LVU1758
+.LBB2997:
+	.loc 2 11665 3 view .LVU1759
+.LBE2997:
+.LBE2996:
+.LBB2999:
+.LBB3000:
+# /usr/lib/gcc/x86_64-linux-gnu/12/include/emmintrin.h:1458:   return (__m128i)__builtin_ia32_pshufd ((__v4si)__A, __mask);
+	.loc 3 1458 19 is_stmt 0 view .LVU1760
+	vpshufd	$147, %xmm0, %xmm0	#, tmp1546, tmp1560
+.LVL274:
+	.loc 3 1458 19 view .LVU1761
+.LBE3000:
+.LBE2999:
+.LBB3002:
+.LBB2995:
+# /usr/lib/gcc/x86_64-linux-gnu/12/include/emmintrin.h:1329:   return (__m128i) ((__v2du)__A ^ (__v2du)__B);
+	.loc 3 1329 33 view .LVU1762
+	vpxor	%xmm2, %xmm1, %xmm1	# _700, tmp1540, tmp1552
+.LVL275:
+	.loc 3 1329 33 view .LVU1763
+.LBE2995:
+.LBE3002:
+.LBB3003:
+.LBB3004:
+# /usr/lib/gcc/x86_64-linux-gnu/12/include/emmintrin.h:1458:   return (__m128i)__builtin_ia32_pshufd ((__v4si)__A, __mask);
+	.loc 3 1458 19 view .LVU1764
+	vpshufd	$78, %xmm2, %xmm2	#, _700, tmp1558
+.LVL276:
+	.loc 3 1458 19 view .LVU1765
+.LBE3004:
+.LBE3003:
+.LBB3006:
+.LBB2998:
+# /usr/lib/gcc/x86_64-linux-gnu/12/include/avx512vlintrin.h:11665:   return (__m128i) __builtin_ia32_prord128_mask ((__v4si) __A, __B,
+	.loc 2 11665 20 view .LVU1766
+	vprord	$7, %xmm1, %xmm1	#, tmp1552, tmp1551
+.LVL277:
+	.loc 2 11665 20 view .LVU1767
+.LBE2998:
+.LBE3006:
+	.loc 1 90 373 is_stmt 1 view .LVU1768
+	.loc 1 90 740 view .LVU1769
+.LBB3007:
+.LBI3007:
+	.loc 3 1456 1 view .LVU1770
+.LBB3008:
+	.loc 3 1458 3 view .LVU1771
+# /usr/lib/gcc/x86_64-linux-gnu/12/include/emmintrin.h:1458:   return (__m128i)__builtin_ia32_pshufd ((__v4si)__A, __mask);
+	.loc 3 1458 19 is_stmt 0 view .LVU1772
+	vpshufd	$57, %xmm1, %xmm1	#, tmp1551, tmp1556
+.LVL278:
+	.loc 3 1458 19 view .LVU1773
+.LBE3008:
+.LBE3007:
+	.loc 1 90 7 is_stmt 1 view .LVU1774
+.LBB3009:
+.LBI3003:
+	.loc 3 1456 1 view .LVU1775
+.LBB3005:
+	.loc 3 1458 3 view .LVU1776
+	.loc 3 1458 3 is_stmt 0 view .LVU1777
+.LBE3005:
+.LBE3009:
+	.loc 1 90 7 is_stmt 1 view .LVU1778
+.LBB3010:
+.LBI2999:
+	.loc 3 1456 1 view .LVU1779
+.LBB3001:
+	.loc 3 1458 3 view .LVU1780
+	.loc 3 1458 3 is_stmt 0 view .LVU1781
+.LBE3001:
+.LBE3010:
+	.loc 1 90 7 is_stmt 1 view .LVU1782
+	.loc 1 90 12 view .LVU1783
+.LBB3011:
+.LBI3011:
+	.loc 3 1064 1 view .LVU1784
+.LBB3012:
+	.loc 3 1066 3 view .LVU1785
+	.loc 3 1066 3 is_stmt 0 view .LVU1786
+.LBE3012:
+.LBE3011:
+.LBB3013:
+.LBI3013:
+	.loc 3 1064 1 is_stmt 1 view .LVU1787
+.LBB3014:
+	.loc 3 1066 3 view .LVU1788
+# /usr/lib/gcc/x86_64-linux-gnu/12/include/emmintrin.h:1066:   return (__m128i) ((__v4su)__A + (__v4su)__B);
+	.loc 3 1066 33 is_stmt 0 view .LVU1789
+	vpaddd	%xmm6, %xmm1, %xmm6	# tmp1530, tmp1556, tmp1562
+	vpaddd	%xmm5, %xmm6, %xmm5	# _693, tmp1562, _713
+.LVL279:
+	.loc 3 1066 33 view .LVU1790
+.LBE3014:
+.LBE3013:
+	.loc 1 90 61 is_stmt 1 view .LVU1791
+.LBB3015:
+.LBI3015:
+	.loc 3 1327 1 view .LVU1792
+.LBB3016:
+	.loc 3 1329 3 view .LVU1793
+	.loc 3 1329 3 is_stmt 0 view .LVU1794
+.LBE3016:
+.LBE3015:
+.LBB3018:
+.LBI3018:
+	.loc 2 11663 1 is_stmt 1 view .LVU1795
+.LBB3019:
+	.loc 2 11665 3 view .LVU1796
+.LBE3019:
+.LBE3018:
+.LBB3021:
+.LBB3017:
+# /usr/lib/gcc/x86_64-linux-gnu/12/include/emmintrin.h:1329:   return (__m128i) ((__v2du)__A ^ (__v2du)__B);
+	.loc 3 1329 33 is_stmt 0 view .LVU1797
+	vpxor	%xmm5, %xmm0, %xmm0	# _713, tmp1560, tmp1564
+.LVL280:
+	.loc 3 1329 33 view .LVU1798
+.LBE3017:
+.LBE3021:
+.LBB3022:
+.LBB3020:
+# /usr/lib/gcc/x86_64-linux-gnu/12/include/avx512vlintrin.h:11665:   return (__m128i) __builtin_ia32_prord128_mask ((__v4si) __A, __B,
+	.loc 2 11665 20 view .LVU1799
+	vprold	$16, %xmm0, %xmm0	#, tmp1564, tmp1563
+.LVL281:
+	.loc 2 11665 20 view .LVU1800
+.LBE3020:
+.LBE3022:
+	.loc 1 90 110 is_stmt 1 view .LVU1801
+.LBB3023:
+.LBI3023:
+	.loc 3 1064 1 view .LVU1802
+.LBB3024:
+	.loc 3 1066 3 view .LVU1803
+# /usr/lib/gcc/x86_64-linux-gnu/12/include/emmintrin.h:1066:   return (__m128i) ((__v4su)__A + (__v4su)__B);
+	.loc 3 1066 33 is_stmt 0 view .LVU1804
+	vpaddd	%xmm0, %xmm2, %xmm2	# tmp1563, tmp1558, _721
+.LVL282:
+	.loc 3 1066 33 view .LVU1805
+.LBE3024:
+.LBE3023:
+	.loc 1 90 140 is_stmt 1 view .LVU1806
+.LBB3025:
+.LBI3025:
+	.loc 3 1327 1 view .LVU1807
+.LBB3026:
+	.loc 3 1329 3 view .LVU1808
+	.loc 3 1329 3 is_stmt 0 view .LVU1809
+.LBE3026:
+.LBE3025:
+.LBB3028:
+.LBI3028:
+	.loc 2 11663 1 is_stmt 1 view .LVU1810
+.LBB3029:
+	.loc 2 11665 3 view .LVU1811
+.LBE3029:
+.LBE3028:
+.LBB3031:
+.LBB3027:
+# /usr/lib/gcc/x86_64-linux-gnu/12/include/emmintrin.h:1329:   return (__m128i) ((__v2du)__A ^ (__v2du)__B);
+	.loc 3 1329 33 is_stmt 0 view .LVU1812
+	vpxor	%xmm2, %xmm1, %xmm1	# _721, tmp1556, tmp1569
+.LVL283:
+	.loc 3 1329 33 view .LVU1813
+.LBE3027:
+.LBE3031:
+.LBB3032:
+.LBB3030:
+# /usr/lib/gcc/x86_64-linux-gnu/12/include/avx512vlintrin.h:11665:   return (__m128i) __builtin_ia32_prord128_mask ((__v4si) __A, __B,
+	.loc 2 11665 20 view .LVU1814
+	vprord	$12, %xmm1, %xmm1	#, tmp1569, tmp1568
+.LVL284:
+	.loc 2 11665 20 view .LVU1815
+.LBE3030:
+.LBE3032:
+	.loc 1 90 189 is_stmt 1 view .LVU1816
+.LBB3033:
+.LBI3033:
+	.loc 3 1064 1 view .LVU1817
+.LBB3034:
+	.loc 3 1066 3 view .LVU1818
+	.loc 3 1066 3 is_stmt 0 view .LVU1819
+.LBE3034:
+.LBE3033:
+.LBB3035:
+.LBI3035:
+	.loc 3 1064 1 is_stmt 1 view .LVU1820
+.LBB3036:
+	.loc 3 1066 3 view .LVU1821
+# /usr/lib/gcc/x86_64-linux-gnu/12/include/emmintrin.h:1066:   return (__m128i) ((__v4su)__A + (__v4su)__B);
+	.loc 3 1066 33 is_stmt 0 view .LVU1822
+	vpaddd	%xmm7, %xmm1, %xmm7	# tmp1532, tmp1568, tmp1573
+.LVL285:
+	.loc 3 1066 33 view .LVU1823
+	vpaddd	%xmm5, %xmm7, %xmm7	# _713, tmp1573, _730
+.LVL286:
+	.loc 3 1066 33 view .LVU1824
+.LBE3036:
+.LBE3035:
+	.loc 1 90 238 is_stmt 1 view .LVU1825
+.LBB3037:
+.LBI3037:
+	.loc 3 1327 1 view .LVU1826
+.LBB3038:
+	.loc 3 1329 3 view .LVU1827
+	.loc 3 1329 3 is_stmt 0 view .LVU1828
+.LBE3038:
+.LBE3037:
+.LBB3040:
+.LBI3040:
+	.loc 2 11663 1 is_stmt 1 view .LVU1829
+.LBB3041:
+	.loc 2 11665 3 view .LVU1830
+.LBE3041:
+.LBE3040:
+.LBE3216:
+.LBB3217:
+.LBB3083:
+.LBB3084:
+# /usr/lib/gcc/x86_64-linux-gnu/12/include/avx512vlintrin.h:6676:   return (__m256i) __builtin_ia32_vpermt2vard256_mask ((__v8si) __I
+	.loc 2 6676 20 is_stmt 0 view .LVU1831
+	vmovdqa	.LC19(%rip), %ymm5	#, tmp1591
+.LBE3084:
+.LBE3083:
+.LBE3217:
+.LBB3218:
+.LBB3043:
+.LBB3039:
+# /usr/lib/gcc/x86_64-linux-gnu/12/include/emmintrin.h:1329:   return (__m128i) ((__v2du)__A ^ (__v2du)__B);
+	.loc 3 1329 33 view .LVU1832
+	vpxor	%xmm7, %xmm0, %xmm0	# _730, tmp1563, tmp1575
+.LVL287:
+	.loc 3 1329 33 view .LVU1833
+.LBE3039:
+.LBE3043:
+.LBB3044:
+.LBB3042:
+# /usr/lib/gcc/x86_64-linux-gnu/12/include/avx512vlintrin.h:11665:   return (__m128i) __builtin_ia32_prord128_mask ((__v4si) __A, __B,
+	.loc 2 11665 20 view .LVU1834
+	vprord	$8, %xmm0, %xmm0	#, tmp1575, tmp1574
+.LVL288:
+	.loc 2 11665 20 view .LVU1835
+.LBE3042:
+.LBE3044:
+	.loc 1 90 286 is_stmt 1 view .LVU1836
+.LBB3045:
+.LBI3045:
+	.loc 3 1064 1 view .LVU1837
+.LBB3046:
+	.loc 3 1066 3 view .LVU1838
+.LBE3046:
+.LBE3045:
+.LBE3218:
+.LBB3219:
+.LBB3087:
+.LBB3085:
+# /usr/lib/gcc/x86_64-linux-gnu/12/include/avx512vlintrin.h:6676:   return (__m256i) __builtin_ia32_vpermt2vard256_mask ((__v8si) __I
+	.loc 2 6676 20 is_stmt 0 view .LVU1839
+	vpermi2d	%ymm4, %ymm3, %ymm5	# mhi, mlo, tmp1590
+.LBE3085:
+.LBE3087:
+.LBB3088:
+.LBB3089:
+# /usr/lib/gcc/x86_64-linux-gnu/12/include/avx2intrin.h:1098:   return (__m128i) __builtin_ia32_extract128i256 ((__v4di)__X, __M);
+	.loc 5 1098 20 view .LVU1840
+	vextracti32x4	$0x1, %ymm8, %xmm4	# tmp1595, tmp1606
+.LVL289:
+	.loc 5 1098 20 view .LVU1841
+.LBE3089:
+.LBE3088:
+.LBB3091:
+.LBB3092:
+	vextracti32x4	$0x1, %ymm5, %xmm3	# tmp1590, tmp1602
+.LVL290:
+	.loc 5 1098 20 view .LVU1842
+.LBE3092:
+.LBE3091:
+.LBE3219:
+.LBB3220:
+.LBB3048:
+.LBB3047:
+# /usr/lib/gcc/x86_64-linux-gnu/12/include/emmintrin.h:1066:   return (__m128i) ((__v4su)__A + (__v4su)__B);
+	.loc 3 1066 33 view .LVU1843
+	vpaddd	%xmm2, %xmm0, %xmm2	# _721, tmp1574, _737
+.LVL291:
+	.loc 3 1066 33 view .LVU1844
+.LBE3047:
+.LBE3048:
+	.loc 1 90 316 is_stmt 1 view .LVU1845
+.LBB3049:
+.LBI3049:
+	.loc 3 1327 1 view .LVU1846
+.LBB3050:
+	.loc 3 1329 3 view .LVU1847
+	.loc 3 1329 3 is_stmt 0 view .LVU1848
+.LBE3050:
+.LBE3049:
+.LBB3052:
+.LBI3052:
+	.loc 2 11663 1 is_stmt 1 view .LVU1849
+.LBB3053:
+	.loc 2 11665 3 view .LVU1850
+.LBE3053:
+.LBE3052:
+.LBB3055:
+.LBB3056:
+# /usr/lib/gcc/x86_64-linux-gnu/12/include/emmintrin.h:1458:   return (__m128i)__builtin_ia32_pshufd ((__v4si)__A, __mask);
+	.loc 3 1458 19 is_stmt 0 view .LVU1851
+	vpshufd	$57, %xmm0, %xmm0	#, tmp1574, tmp1588
+.LVL292:
+	.loc 3 1458 19 view .LVU1852
+.LBE3056:
+.LBE3055:
+.LBB3058:
+.LBB3051:
+# /usr/lib/gcc/x86_64-linux-gnu/12/include/emmintrin.h:1329:   return (__m128i) ((__v2du)__A ^ (__v2du)__B);
+	.loc 3 1329 33 view .LVU1853
+	vpxor	%xmm2, %xmm1, %xmm1	# _737, tmp1568, tmp1580
+.LVL293:
+	.loc 3 1329 33 view .LVU1854
+.LBE3051:
+.LBE3058:
+.LBB3059:
+.LBB3060:
+# /usr/lib/gcc/x86_64-linux-gnu/12/include/emmintrin.h:1458:   return (__m128i)__builtin_ia32_pshufd ((__v4si)__A, __mask);
+	.loc 3 1458 19 view .LVU1855
+	vpshufd	$78, %xmm2, %xmm2	#, _737, tmp1586
+.LVL294:
+	.loc 3 1458 19 view .LVU1856
+.LBE3060:
+.LBE3059:
+.LBB3062:
+.LBB3054:
+# /usr/lib/gcc/x86_64-linux-gnu/12/include/avx512vlintrin.h:11665:   return (__m128i) __builtin_ia32_prord128_mask ((__v4si) __A, __B,
+	.loc 2 11665 20 view .LVU1857
+	vprord	$7, %xmm1, %xmm1	#, tmp1580, tmp1579
+.LVL295:
+	.loc 2 11665 20 view .LVU1858
+.LBE3054:
+.LBE3062:
+	.loc 1 90 10 is_stmt 1 view .LVU1859
+	.loc 1 90 377 view .LVU1860
+.LBB3063:
+.LBI3063:
+	.loc 3 1456 1 view .LVU1861
+.LBB3064:
+	.loc 3 1458 3 view .LVU1862
+# /usr/lib/gcc/x86_64-linux-gnu/12/include/emmintrin.h:1458:   return (__m128i)__builtin_ia32_pshufd ((__v4si)__A, __mask);
+	.loc 3 1458 19 is_stmt 0 view .LVU1863
+	vpshufd	$147, %xmm1, %xmm1	#, tmp1579, tmp1584
+.LVL296:
+	.loc 3 1458 19 view .LVU1864
+.LBE3064:
+.LBE3063:
+	.loc 1 90 7 is_stmt 1 view .LVU1865
+.LBB3065:
+.LBI3059:
+	.loc 3 1456 1 view .LVU1866
+.LBB3061:
+	.loc 3 1458 3 view .LVU1867
+	.loc 3 1458 3 is_stmt 0 view .LVU1868
+.LBE3061:
+.LBE3065:
+	.loc 1 90 7 is_stmt 1 view .LVU1869
+.LBB3066:
+.LBI3055:
+	.loc 3 1456 1 view .LVU1870
+.LBB3057:
+	.loc 3 1458 3 view .LVU1871
+	.loc 3 1458 3 is_stmt 0 view .LVU1872
+.LBE3057:
+.LBE3066:
+.LBE3220:
+	.loc 1 90 8 is_stmt 1 view .LVU1873
+	.loc 1 91 5 view .LVU1874
+.LBB3221:
+	.loc 1 91 10 view .LVU1875
+	.loc 1 91 26 view .LVU1876
+.LBB3094:
+.LBI3083:
+	.loc 2 6674 1 view .LVU1877
+.LBB3086:
+	.loc 2 6676 3 view .LVU1878
+	.loc 2 6676 3 is_stmt 0 view .LVU1879
+.LBE3086:
+.LBE3094:
+	.loc 1 91 127 is_stmt 1 view .LVU1880
+.LBB3095:
+.LBI3078:
+	.loc 2 6674 1 view .LVU1881
+.LBB3081:
+	.loc 2 6676 3 view .LVU1882
+	.loc 2 6676 3 is_stmt 0 view .LVU1883
+.LBE3081:
+.LBE3095:
+	.loc 1 91 228 is_stmt 1 view .LVU1884
+.LBB3096:
+.LBI3096:
+	.loc 4 1467 1 view .LVU1885
+.LBB3097:
+	.loc 4 1469 3 view .LVU1886
+	.loc 4 1469 3 is_stmt 0 view .LVU1887
+.LBE3097:
+.LBE3096:
+	.loc 1 91 261 is_stmt 1 view .LVU1888
+.LBB3098:
+.LBI3091:
+	.loc 5 1096 1 view .LVU1889
+.LBB3093:
+	.loc 5 1098 3 view .LVU1890
+	.loc 5 1098 3 is_stmt 0 view .LVU1891
+.LBE3093:
+.LBE3098:
+	.loc 1 91 299 is_stmt 1 view .LVU1892
+.LBB3099:
+.LBI3099:
+	.loc 4 1467 1 view .LVU1893
+.LBB3100:
+	.loc 4 1469 3 view .LVU1894
+	.loc 4 1469 3 is_stmt 0 view .LVU1895
+.LBE3100:
+.LBE3099:
+	.loc 1 91 332 is_stmt 1 view .LVU1896
+.LBB3101:
+.LBI3088:
+	.loc 5 1096 1 view .LVU1897
+.LBB3090:
+	.loc 5 1098 3 view .LVU1898
+	.loc 5 1098 3 is_stmt 0 view .LVU1899
+.LBE3090:
+.LBE3101:
+	.loc 1 91 370 is_stmt 1 view .LVU1900
+	.loc 1 91 375 view .LVU1901
+.LBB3102:
+.LBI3102:
+	.loc 3 1064 1 view .LVU1902
+.LBB3103:
+	.loc 3 1066 3 view .LVU1903
+	.loc 3 1066 3 is_stmt 0 view .LVU1904
+.LBE3103:
+.LBE3102:
+.LBB3104:
+.LBI3104:
+	.loc 3 1064 1 is_stmt 1 view .LVU1905
+.LBB3105:
+	.loc 3 1066 3 view .LVU1906
+# /usr/lib/gcc/x86_64-linux-gnu/12/include/emmintrin.h:1066:   return (__m128i) ((__v4su)__A + (__v4su)__B);
+	.loc 3 1066 33 is_stmt 0 view .LVU1907
+	vpaddd	%xmm5, %xmm1, %xmm6	# tmp1600, tmp1584, tmp1608
+	vpaddd	%xmm7, %xmm6, %xmm6	# _730, tmp1608, _758
+.LVL297:
+	.loc 3 1066 33 view .LVU1908
+.LBE3105:
+.LBE3104:
+	.loc 1 91 424 is_stmt 1 view .LVU1909
+.LBB3106:
+.LBI3106:
+	.loc 3 1327 1 view .LVU1910
+.LBB3107:
+	.loc 3 1329 3 view .LVU1911
+	.loc 3 1329 3 is_stmt 0 view .LVU1912
+.LBE3107:
+.LBE3106:
+.LBB3109:
+.LBI3109:
+	.loc 2 11663 1 is_stmt 1 view .LVU1913
+.LBB3110:
+	.loc 2 11665 3 view .LVU1914
+.LBE3110:
+.LBE3109:
+.LBB3112:
+.LBB3108:
+# /usr/lib/gcc/x86_64-linux-gnu/12/include/emmintrin.h:1329:   return (__m128i) ((__v2du)__A ^ (__v2du)__B);
+	.loc 3 1329 33 is_stmt 0 view .LVU1915
+	vpxor	%xmm6, %xmm0, %xmm0	# _758, tmp1588, tmp1610
+.LVL298:
+	.loc 3 1329 33 view .LVU1916
+.LBE3108:
+.LBE3112:
+.LBB3113:
+.LBB3111:
+# /usr/lib/gcc/x86_64-linux-gnu/12/include/avx512vlintrin.h:11665:   return (__m128i) __builtin_ia32_prord128_mask ((__v4si) __A, __B,
+	.loc 2 11665 20 view .LVU1917
+	vprold	$16, %xmm0, %xmm0	#, tmp1610, tmp1609
+.LVL299:
+	.loc 2 11665 20 view .LVU1918
+.LBE3111:
+.LBE3113:
+	.loc 1 91 473 is_stmt 1 view .LVU1919
+.LBB3114:
+.LBI3114:
+	.loc 3 1064 1 view .LVU1920
+.LBB3115:
+	.loc 3 1066 3 view .LVU1921
+# /usr/lib/gcc/x86_64-linux-gnu/12/include/emmintrin.h:1066:   return (__m128i) ((__v4su)__A + (__v4su)__B);
+	.loc 3 1066 33 is_stmt 0 view .LVU1922
+	vpaddd	%xmm0, %xmm2, %xmm2	# tmp1609, tmp1586, _766
+.LVL300:
+	.loc 3 1066 33 view .LVU1923
+.LBE3115:
+.LBE3114:
+	.loc 1 91 503 is_stmt 1 view .LVU1924
+.LBB3116:
+.LBI3116:
+	.loc 3 1327 1 view .LVU1925
+.LBB3117:
+	.loc 3 1329 3 view .LVU1926
+	.loc 3 1329 3 is_stmt 0 view .LVU1927
+.LBE3117:
+.LBE3116:
+.LBB3119:
+.LBI3119:
+	.loc 2 11663 1 is_stmt 1 view .LVU1928
+.LBB3120:
+	.loc 2 11665 3 view .LVU1929
+.LBE3120:
+.LBE3119:
+.LBB3122:
+.LBB3118:
+# /usr/lib/gcc/x86_64-linux-gnu/12/include/emmintrin.h:1329:   return (__m128i) ((__v2du)__A ^ (__v2du)__B);
+	.loc 3 1329 33 is_stmt 0 view .LVU1930
+	vpxor	%xmm2, %xmm1, %xmm1	# _766, tmp1584, tmp1615
+.LVL301:
+	.loc 3 1329 33 view .LVU1931
+.LBE3118:
+.LBE3122:
+.LBB3123:
+.LBB3121:
+# /usr/lib/gcc/x86_64-linux-gnu/12/include/avx512vlintrin.h:11665:   return (__m128i) __builtin_ia32_prord128_mask ((__v4si) __A, __B,
+	.loc 2 11665 20 view .LVU1932
+	vprord	$12, %xmm1, %xmm1	#, tmp1615, tmp1614
+.LVL302:
+	.loc 2 11665 20 view .LVU1933
+.LBE3121:
+.LBE3123:
+	.loc 1 91 552 is_stmt 1 view .LVU1934
+.LBB3124:
+.LBI3124:
+	.loc 3 1064 1 view .LVU1935
+.LBB3125:
+	.loc 3 1066 3 view .LVU1936
+	.loc 3 1066 3 is_stmt 0 view .LVU1937
+.LBE3125:
+.LBE3124:
+.LBB3126:
+.LBI3126:
+	.loc 3 1064 1 is_stmt 1 view .LVU1938
+.LBB3127:
+	.loc 3 1066 3 view .LVU1939
+# /usr/lib/gcc/x86_64-linux-gnu/12/include/emmintrin.h:1066:   return (__m128i) ((__v4su)__A + (__v4su)__B);
+	.loc 3 1066 33 is_stmt 0 view .LVU1940
+	vpaddd	%xmm3, %xmm1, %xmm3	# tmp1602, tmp1614, tmp1619
+.LVL303:
+	.loc 3 1066 33 view .LVU1941
+	vpaddd	%xmm6, %xmm3, %xmm3	# _758, tmp1619, _775
+.LVL304:
+	.loc 3 1066 33 view .LVU1942
+.LBE3127:
+.LBE3126:
+	.loc 1 91 601 is_stmt 1 view .LVU1943
+.LBB3128:
+.LBI3128:
+	.loc 3 1327 1 view .LVU1944
+.LBB3129:
+	.loc 3 1329 3 view .LVU1945
+	.loc 3 1329 3 is_stmt 0 view .LVU1946
+.LBE3129:
+.LBE3128:
+.LBB3131:
+.LBI3131:
+	.loc 2 11663 1 is_stmt 1 view .LVU1947
+.LBB3132:
+	.loc 2 11665 3 view .LVU1948
+.LBE3132:
+.LBE3131:
+.LBB3134:
+.LBB3130:
+# /usr/lib/gcc/x86_64-linux-gnu/12/include/emmintrin.h:1329:   return (__m128i) ((__v2du)__A ^ (__v2du)__B);
+	.loc 3 1329 33 is_stmt 0 view .LVU1949
+	vpxor	%xmm3, %xmm0, %xmm0	# _775, tmp1609, tmp1621
+.LVL305:
+	.loc 3 1329 33 view .LVU1950
+.LBE3130:
+.LBE3134:
+.LBB3135:
+.LBB3133:
+# /usr/lib/gcc/x86_64-linux-gnu/12/include/avx512vlintrin.h:11665:   return (__m128i) __builtin_ia32_prord128_mask ((__v4si) __A, __B,
+	.loc 2 11665 20 view .LVU1951
+	vprord	$8, %xmm0, %xmm0	#, tmp1621, tmp1620
+.LVL306:
+	.loc 2 11665 20 view .LVU1952
+.LBE3133:
+.LBE3135:
+	.loc 1 91 649 is_stmt 1 view .LVU1953
+.LBB3136:
+.LBI3136:
+	.loc 3 1064 1 view .LVU1954
+.LBB3137:
+	.loc 3 1066 3 view .LVU1955
+# /usr/lib/gcc/x86_64-linux-gnu/12/include/emmintrin.h:1066:   return (__m128i) ((__v4su)__A + (__v4su)__B);
+	.loc 3 1066 33 is_stmt 0 view .LVU1956
+	vpaddd	%xmm2, %xmm0, %xmm2	# _766, tmp1620, _782
+.LVL307:
+	.loc 3 1066 33 view .LVU1957
+.LBE3137:
+.LBE3136:
+	.loc 1 91 679 is_stmt 1 view .LVU1958
+.LBB3138:
+.LBI3138:
+	.loc 3 1327 1 view .LVU1959
+.LBB3139:
+	.loc 3 1329 3 view .LVU1960
+	.loc 3 1329 3 is_stmt 0 view .LVU1961
+.LBE3139:
+.LBE3138:
+.LBB3141:
+.LBI3141:
+	.loc 2 11663 1 is_stmt 1 view .LVU1962
+.LBB3142:
+	.loc 2 11665 3 view .LVU1963
+.LBE3142:
+.LBE3141:
+.LBB3144:
+.LBB3145:
+# /usr/lib/gcc/x86_64-linux-gnu/12/include/emmintrin.h:1458:   return (__m128i)__builtin_ia32_pshufd ((__v4si)__A, __mask);
+	.loc 3 1458 19 is_stmt 0 view .LVU1964
+	vpshufd	$147, %xmm0, %xmm0	#, tmp1620, tmp1634
+.LVL308:
+	.loc 3 1458 19 view .LVU1965
+.LBE3145:
+.LBE3144:
+.LBB3147:
+.LBB3140:
+# /usr/lib/gcc/x86_64-linux-gnu/12/include/emmintrin.h:1329:   return (__m128i) ((__v2du)__A ^ (__v2du)__B);
+	.loc 3 1329 33 view .LVU1966
+	vpxor	%xmm2, %xmm1, %xmm1	# _782, tmp1614, tmp1626
+.LVL309:
+	.loc 3 1329 33 view .LVU1967
+.LBE3140:
+.LBE3147:
+.LBB3148:
+.LBB3149:
+# /usr/lib/gcc/x86_64-linux-gnu/12/include/emmintrin.h:1458:   return (__m128i)__builtin_ia32_pshufd ((__v4si)__A, __mask);
+	.loc 3 1458 19 view .LVU1968
+	vpshufd	$78, %xmm2, %xmm2	#, _782, tmp1632
+.LVL310:
+	.loc 3 1458 19 view .LVU1969
+.LBE3149:
+.LBE3148:
+.LBB3151:
+.LBB3143:
+# /usr/lib/gcc/x86_64-linux-gnu/12/include/avx512vlintrin.h:11665:   return (__m128i) __builtin_ia32_prord128_mask ((__v4si) __A, __B,
+	.loc 2 11665 20 view .LVU1970
+	vprord	$7, %xmm1, %xmm1	#, tmp1626, tmp1625
+.LVL311:
+	.loc 2 11665 20 view .LVU1971
+.LBE3143:
+.LBE3151:
+	.loc 1 91 373 is_stmt 1 view .LVU1972
+	.loc 1 91 740 view .LVU1973
+.LBB3152:
+.LBI3152:
+	.loc 3 1456 1 view .LVU1974
+.LBB3153:
+	.loc 3 1458 3 view .LVU1975
+# /usr/lib/gcc/x86_64-linux-gnu/12/include/emmintrin.h:1458:   return (__m128i)__builtin_ia32_pshufd ((__v4si)__A, __mask);
+	.loc 3 1458 19 is_stmt 0 view .LVU1976
+	vpshufd	$57, %xmm1, %xmm1	#, tmp1625, tmp1630
+.LVL312:
+	.loc 3 1458 19 view .LVU1977
+.LBE3153:
+.LBE3152:
+	.loc 1 91 7 is_stmt 1 view .LVU1978
+.LBB3154:
+.LBI3148:
+	.loc 3 1456 1 view .LVU1979
+.LBB3150:
+	.loc 3 1458 3 view .LVU1980
+	.loc 3 1458 3 is_stmt 0 view .LVU1981
+.LBE3150:
+.LBE3154:
+	.loc 1 91 7 is_stmt 1 view .LVU1982
+.LBB3155:
+.LBI3144:
+	.loc 3 1456 1 view .LVU1983
+.LBB3146:
+	.loc 3 1458 3 view .LVU1984
+	.loc 3 1458 3 is_stmt 0 view .LVU1985
+.LBE3146:
+.LBE3155:
+	.loc 1 91 7 is_stmt 1 view .LVU1986
+	.loc 1 91 12 view .LVU1987
+.LBB3156:
+.LBI3156:
+	.loc 3 1064 1 view .LVU1988
+.LBB3157:
+	.loc 3 1066 3 view .LVU1989
+	.loc 3 1066 3 is_stmt 0 view .LVU1990
+.LBE3157:
+.LBE3156:
+.LBB3158:
+.LBI3158:
+	.loc 3 1064 1 is_stmt 1 view .LVU1991
+.LBB3159:
+	.loc 3 1066 3 view .LVU1992
+# /usr/lib/gcc/x86_64-linux-gnu/12/include/emmintrin.h:1066:   return (__m128i) ((__v4su)__A + (__v4su)__B);
+	.loc 3 1066 33 is_stmt 0 view .LVU1993
+	vpaddd	%xmm8, %xmm1, %xmm5	# tmp1604, tmp1630, tmp1636
+.LVL313:
+	.loc 3 1066 33 view .LVU1994
+	vpaddd	%xmm3, %xmm5, %xmm5	# _775, tmp1636, _795
+.LVL314:
+	.loc 3 1066 33 view .LVU1995
+.LBE3159:
+.LBE3158:
+	.loc 1 91 61 is_stmt 1 view .LVU1996
+.LBB3160:
+.LBI3160:
+	.loc 3 1327 1 view .LVU1997
+.LBB3161:
+	.loc 3 1329 3 view .LVU1998
+	.loc 3 1329 3 is_stmt 0 view .LVU1999
+.LBE3161:
+.LBE3160:
+.LBB3163:
+.LBI3163:
+	.loc 2 11663 1 is_stmt 1 view .LVU2000
+.LBB3164:
+	.loc 2 11665 3 view .LVU2001
+.LBE3164:
+.LBE3163:
+.LBB3166:
+.LBB3162:
+# /usr/lib/gcc/x86_64-linux-gnu/12/include/emmintrin.h:1329:   return (__m128i) ((__v2du)__A ^ (__v2du)__B);
+	.loc 3 1329 33 is_stmt 0 view .LVU2002
+	vpxor	%xmm5, %xmm0, %xmm0	# _795, tmp1634, tmp1638
+.LVL315:
+	.loc 3 1329 33 view .LVU2003
+.LBE3162:
+.LBE3166:
+.LBB3167:
+.LBB3165:
+# /usr/lib/gcc/x86_64-linux-gnu/12/include/avx512vlintrin.h:11665:   return (__m128i) __builtin_ia32_prord128_mask ((__v4si) __A, __B,
+	.loc 2 11665 20 view .LVU2004
+	vprold	$16, %xmm0, %xmm0	#, tmp1638, tmp1637
+.LVL316:
+	.loc 2 11665 20 view .LVU2005
+.LBE3165:
+.LBE3167:
+	.loc 1 91 110 is_stmt 1 view .LVU2006
+.LBB3168:
+.LBI3168:
+	.loc 3 1064 1 view .LVU2007
+.LBB3169:
+	.loc 3 1066 3 view .LVU2008
+# /usr/lib/gcc/x86_64-linux-gnu/12/include/emmintrin.h:1066:   return (__m128i) ((__v4su)__A + (__v4su)__B);
+	.loc 3 1066 33 is_stmt 0 view .LVU2009
+	vpaddd	%xmm0, %xmm2, %xmm2	# tmp1637, tmp1632, _803
+.LVL317:
+	.loc 3 1066 33 view .LVU2010
+.LBE3169:
+.LBE3168:
+	.loc 1 91 140 is_stmt 1 view .LVU2011
+.LBB3170:
+.LBI3170:
+	.loc 3 1327 1 view .LVU2012
+.LBB3171:
+	.loc 3 1329 3 view .LVU2013
+	.loc 3 1329 3 is_stmt 0 view .LVU2014
+.LBE3171:
+.LBE3170:
+.LBB3173:
+.LBI3173:
+	.loc 2 11663 1 is_stmt 1 view .LVU2015
+.LBB3174:
+	.loc 2 11665 3 view .LVU2016
+.LBE3174:
+.LBE3173:
+.LBB3176:
+.LBB3172:
+# /usr/lib/gcc/x86_64-linux-gnu/12/include/emmintrin.h:1329:   return (__m128i) ((__v2du)__A ^ (__v2du)__B);
+	.loc 3 1329 33 is_stmt 0 view .LVU2017
+	vpxor	%xmm2, %xmm1, %xmm1	# _803, tmp1630, tmp1643
+.LVL318:
+	.loc 3 1329 33 view .LVU2018
+.LBE3172:
+.LBE3176:
+.LBB3177:
+.LBB3175:
+# /usr/lib/gcc/x86_64-linux-gnu/12/include/avx512vlintrin.h:11665:   return (__m128i) __builtin_ia32_prord128_mask ((__v4si) __A, __B,
+	.loc 2 11665 20 view .LVU2019
+	vprord	$12, %xmm1, %xmm1	#, tmp1643, tmp1642
+.LVL319:
+	.loc 2 11665 20 view .LVU2020
+.LBE3175:
+.LBE3177:
+	.loc 1 91 189 is_stmt 1 view .LVU2021
+.LBB3178:
+.LBI3178:
+	.loc 3 1064 1 view .LVU2022
+.LBB3179:
+	.loc 3 1066 3 view .LVU2023
+	.loc 3 1066 3 is_stmt 0 view .LVU2024
+.LBE3179:
+.LBE3178:
+.LBB3180:
+.LBI3180:
+	.loc 3 1064 1 is_stmt 1 view .LVU2025
+.LBB3181:
+	.loc 3 1066 3 view .LVU2026
+	.loc 3 1066 3 is_stmt 0 view .LVU2027
+.LBE3181:
+.LBE3180:
+	.loc 1 91 238 is_stmt 1 view .LVU2028
+.LBB3183:
+.LBI3183:
+	.loc 3 1327 1 view .LVU2029
+.LBB3184:
+	.loc 3 1329 3 view .LVU2030
+.LBE3184:
+.LBE3183:
+.LBB3186:
+.LBB3182:
+# /usr/lib/gcc/x86_64-linux-gnu/12/include/emmintrin.h:1066:   return (__m128i) ((__v4su)__A + (__v4su)__B);
+	.loc 3 1066 33 is_stmt 0 view .LVU2031
+	vpaddd	%xmm4, %xmm1, %xmm3	# tmp1606, tmp1642, tmp1647
+	vpaddd	%xmm5, %xmm3, %xmm3	# _795, tmp1647, tmp1648
+.LVL320:
+	.loc 3 1066 33 view .LVU2032
+.LBE3182:
+.LBE3186:
+.LBB3187:
+.LBI3187:
+	.loc 2 11663 1 is_stmt 1 view .LVU2033
+.LBB3188:
+	.loc 2 11665 3 view .LVU2034
+.LBE3188:
+.LBE3187:
+.LBB3190:
+.LBB3185:
+# /usr/lib/gcc/x86_64-linux-gnu/12/include/emmintrin.h:1329:   return (__m128i) ((__v2du)__A ^ (__v2du)__B);
+	.loc 3 1329 33 is_stmt 0 view .LVU2035
+	vpxor	%xmm0, %xmm3, %xmm0	# tmp1637, tmp1648, tmp1650
+.LVL321:
+	.loc 3 1329 33 view .LVU2036
+.LBE3185:
+.LBE3190:
+.LBB3191:
+.LBB3189:
+# /usr/lib/gcc/x86_64-linux-gnu/12/include/avx512vlintrin.h:11665:   return (__m128i) __builtin_ia32_prord128_mask ((__v4si) __A, __B,
+	.loc 2 11665 20 view .LVU2037
+	vprord	$8, %xmm0, %xmm0	#, tmp1650, tmp1649
+.LVL322:
+	.loc 2 11665 20 view .LVU2038
+.LBE3189:
+.LBE3191:
+	.loc 1 91 286 is_stmt 1 view .LVU2039
+.LBB3192:
+.LBI3192:
+	.loc 3 1064 1 view .LVU2040
+.LBB3193:
+	.loc 3 1066 3 view .LVU2041
+# /usr/lib/gcc/x86_64-linux-gnu/12/include/emmintrin.h:1066:   return (__m128i) ((__v4su)__A + (__v4su)__B);
+	.loc 3 1066 33 is_stmt 0 view .LVU2042
+	vpaddd	%xmm2, %xmm0, %xmm2	# _803, tmp1649, _819
+.LVL323:
+	.loc 3 1066 33 view .LVU2043
+.LBE3193:
+.LBE3192:
+	.loc 1 91 316 is_stmt 1 view .LVU2044
+.LBB3194:
+.LBI3194:
+	.loc 3 1327 1 view .LVU2045
+.LBB3195:
+	.loc 3 1329 3 view .LVU2046
+	.loc 3 1329 3 is_stmt 0 view .LVU2047
+.LBE3195:
+.LBE3194:
+.LBB3197:
+.LBI3197:
+	.loc 2 11663 1 is_stmt 1 view .LVU2048
+.LBB3198:
+	.loc 2 11665 3 view .LVU2049
+.LBE3198:
+.LBE3197:
+.LBB3200:
+.LBB3201:
+# /usr/lib/gcc/x86_64-linux-gnu/12/include/emmintrin.h:1458:   return (__m128i)__builtin_ia32_pshufd ((__v4si)__A, __mask);
+	.loc 3 1458 19 is_stmt 0 view .LVU2050
+	vpshufd	$57, %xmm0, %xmm0	#, tmp1649, tmp1663
+.LVL324:
+	.loc 3 1458 19 view .LVU2051
+.LBE3201:
+.LBE3200:
+.LBB3203:
+.LBB3196:
+# /usr/lib/gcc/x86_64-linux-gnu/12/include/emmintrin.h:1329:   return (__m128i) ((__v2du)__A ^ (__v2du)__B);
+	.loc 3 1329 33 view .LVU2052
+	vpxor	%xmm2, %xmm1, %xmm1	# _819, tmp1642, tmp1655
+.LVL325:
+	.loc 3 1329 33 view .LVU2053
+.LBE3196:
+.LBE3203:
+.LBB3204:
+.LBB3205:
+# /usr/lib/gcc/x86_64-linux-gnu/12/include/emmintrin.h:1458:   return (__m128i)__builtin_ia32_pshufd ((__v4si)__A, __mask);
+	.loc 3 1458 19 view .LVU2054
+	vpshufd	$78, %xmm2, %xmm2	#, _819, tmp1661
+.LVL326:
+	.loc 3 1458 19 view .LVU2055
+.LBE3205:
+.LBE3204:
+.LBB3207:
+.LBB3199:
+# /usr/lib/gcc/x86_64-linux-gnu/12/include/avx512vlintrin.h:11665:   return (__m128i) __builtin_ia32_prord128_mask ((__v4si) __A, __B,
+	.loc 2 11665 20 view .LVU2056
+	vprord	$7, %xmm1, %xmm1	#, tmp1655, tmp1654
+.LVL327:
+	.loc 2 11665 20 view .LVU2057
+.LBE3199:
+.LBE3207:
+	.loc 1 91 10 is_stmt 1 view .LVU2058
+	.loc 1 91 377 view .LVU2059
+.LBB3208:
+.LBI3208:
+	.loc 3 1456 1 view .LVU2060
+.LBB3209:
+	.loc 3 1458 3 view .LVU2061
+.LBE3209:
+.LBE3208:
+.LBE3221:
+.LBB3222:
+.LBB3223:
+# /usr/lib/gcc/x86_64-linux-gnu/12/include/emmintrin.h:1329:   return (__m128i) ((__v2du)__A ^ (__v2du)__B);
+	.loc 3 1329 33 is_stmt 0 view .LVU2062
+	vpternlogq	$150, (%rdi), %xmm2, %xmm3	#, *H_831(D), tmp1661, tmp1666
+.LBE3223:
+.LBE3222:
+# blake2s-avx512vl.c:93:     H[0] = xor(H[0], xor(va, vc));
+	.loc 1 93 10 view .LVU2063
+	vmovdqa	%xmm3, (%rdi)	# tmp1666, *H_831(D)
+.LBB3225:
+.LBB3211:
+.LBB3210:
+# /usr/lib/gcc/x86_64-linux-gnu/12/include/emmintrin.h:1458:   return (__m128i)__builtin_ia32_pshufd ((__v4si)__A, __mask);
+	.loc 3 1458 19 view .LVU2064
+	vpshufd	$147, %xmm1, %xmm1	#, tmp1654, tmp1659
+.LVL328:
+	.loc 3 1458 19 view .LVU2065
+.LBE3210:
+.LBE3211:
+	.loc 1 91 7 is_stmt 1 view .LVU2066
+.LBB3212:
+.LBI3204:
+	.loc 3 1456 1 view .LVU2067
+.LBB3206:
+	.loc 3 1458 3 view .LVU2068
+	.loc 3 1458 3 is_stmt 0 view .LVU2069
+.LBE3206:
+.LBE3212:
+	.loc 1 91 7 is_stmt 1 view .LVU2070
+.LBB3213:
+.LBI3200:
+	.loc 3 1456 1 view .LVU2071
+.LBB3202:
+	.loc 3 1458 3 view .LVU2072
+	.loc 3 1458 3 is_stmt 0 view .LVU2073
+.LBE3202:
+.LBE3213:
+.LBE3225:
+	.loc 1 91 8 is_stmt 1 view .LVU2074
+	.loc 1 93 5 view .LVU2075
+.LBB3226:
+.LBI3226:
+	.loc 3 1327 1 view .LVU2076
+.LBB3227:
+	.loc 3 1329 3 view .LVU2077
+	.loc 3 1329 3 is_stmt 0 view .LVU2078
+.LBE3227:
+.LBE3226:
+.LBB3228:
+.LBI3222:
+	.loc 3 1327 1 is_stmt 1 view .LVU2079
+.LBB3224:
+	.loc 3 1329 3 view .LVU2080
+	.loc 3 1329 3 is_stmt 0 view .LVU2081
+.LBE3224:
+.LBE3228:
+	.loc 1 94 5 is_stmt 1 view .LVU2082
+.LBB3229:
+.LBI3229:
+	.loc 3 1327 1 view .LVU2083
+.LBB3230:
+	.loc 3 1329 3 view .LVU2084
+	.loc 3 1329 3 is_stmt 0 view .LVU2085
+.LBE3230:
+.LBE3229:
+.LBB3231:
+.LBI3231:
+	.loc 3 1327 1 is_stmt 1 view .LVU2086
+.LBB3232:
+	.loc 3 1329 3 view .LVU2087
+# /usr/lib/gcc/x86_64-linux-gnu/12/include/emmintrin.h:1329:   return (__m128i) ((__v2du)__A ^ (__v2du)__B);
+	.loc 3 1329 33 is_stmt 0 view .LVU2088
+	vpternlogq	$150, 16(%rdi), %xmm1, %xmm0	#, MEM[(__m128i * {ref-all})H_831(D) + 16B], tmp1659, tmp1668
+.LVL329:
+	.loc 3 1329 33 view .LVU2089
+.LBE3232:
+.LBE3231:
+# blake2s-avx512vl.c:94:     H[1] = xor(H[1], xor(vb, vd));
+	.loc 1 94 10 view .LVU2090
+	vmovdqa	%xmm0, 16(%rdi)	# tmp1668, MEM[(__m128i * {ref-all})H_831(D) + 16B]
+# blake2s-avx512vl.c:95: }
+	.loc 1 95 1 view .LVU2091
+	ret	
+	.cfi_endproc
+.LFE6406:
+	.size	blake2s_10rounds.constprop.0, .-blake2s_10rounds.constprop.0
+	.p2align 4
+	.globl	blake2s_compress_avx512vl
+	.type	blake2s_compress_avx512vl, @function
+blake2s_compress_avx512vl:
+.LVL330:
+.LFB6404:
+	.loc 1 98 1 is_stmt 1 view -0
+	.cfi_startproc
+	.loc 1 99 5 view .LVU2093
+	.loc 1 100 5 view .LVU2094
+	.loc 1 101 5 view .LVU2095
+	.loc 1 102 5 view .LVU2096
+	.loc 1 103 5 view .LVU2097
+.LBB3233:
+.LBI3233:
+	.loc 3 695 1 view .LVU2098
+.LBB3234:
+	.loc 3 697 3 view .LVU2099
+.LBE3234:
+.LBE3233:
+# blake2s-avx512vl.c:98: {
+	.loc 1 98 1 is_stmt 0 view .LVU2100
+	leaq	8(%rsp), %r10	#,
+	.cfi_def_cfa 10, 0
+	andq	$-32, %rsp	#,
+	movq	%rdi, %rax	# tmp102, ctx
+	pushq	-8(%r10)	#
+	pushq	%rbp	#
+	movq	%rsp, %rbp	#,
+	.cfi_escape 0x10,0x6,0x2,0x76,0
+	pushq	%r10	#
+	.cfi_escape 0xf,0x3,0x76,0x78,0x6
+	subq	$40, %rsp	#,
+.LBB3236:
+.LBB3235:
+# /usr/lib/gcc/x86_64-linux-gnu/12/include/emmintrin.h:697:   return *__P;
+	.loc 3 697 10 view .LVU2101
+	vmovdqa	(%rdi), %xmm0	# MEM[(const __m128i * {ref-all})ctx_4(D)], _17
+.LVL331:
+	.loc 3 697 10 view .LVU2102
+.LBE3235:
+.LBE3236:
+# blake2s-avx512vl.c:109:     blake2s_10rounds(va,vb,vc,vd, H, _mm256_loadu_si256(p + 0),
+	.loc 1 109 5 view .LVU2103
+	vmovdqu	(%rsi), %ymm3	# MEM[(const __m256i_u * {ref-all})m_3(D)],
+# blake2s-avx512vl.c:104:     vb = H[1] = _mm_load_si128((const __m128i *)ctx->H + 1);
+	.loc 1 104 15 view .LVU2104
+	vmovdqa	16(%rdi), %xmm5	# MEM[(const __m128i * {ref-all})ctx_4(D) + 16B], tmp105
+# blake2s-avx512vl.c:109:     blake2s_10rounds(va,vb,vc,vd, H, _mm256_loadu_si256(p + 0),
+	.loc 1 109 5 view .LVU2105
+	vmovdqu	32(%rsi), %ymm4	# MEM[(const __m256i_u * {ref-all})m_3(D) + 32B],
+	leaq	-48(%rbp), %rdi	#, tmp96
+.LVL332:
+	.loc 1 109 5 view .LVU2106
+	vmovdqa	.LC21(%rip), %xmm2	#, tmp98
+	vpxor	96(%rax), %xmm2, %xmm2	# MEM[(const __m128i * {ref-all})ctx_4(D) + 96B], tmp98,
+# blake2s-avx512vl.c:103:     va = H[0] = _mm_load_si128((const __m128i *)ctx->H + 0);
+	.loc 1 103 15 view .LVU2107
+	vmovdqa	%xmm0, -48(%rbp)	# _17, H[0]
+.LVL333:
+	.loc 1 104 5 is_stmt 1 view .LVU2108
+.LBB3237:
+.LBI3237:
+	.loc 3 695 1 view .LVU2109
+.LBB3238:
+	.loc 3 697 3 view .LVU2110
+	.loc 3 697 3 is_stmt 0 view .LVU2111
+.LBE3238:
+.LBE3237:
+# blake2s-avx512vl.c:109:     blake2s_10rounds(va,vb,vc,vd, H, _mm256_loadu_si256(p + 0),
+	.loc 1 109 5 view .LVU2112
+	vmovdqa	%xmm5, %xmm1	# tmp105,
+# blake2s-avx512vl.c:104:     vb = H[1] = _mm_load_si128((const __m128i *)ctx->H + 1);
+	.loc 1 104 15 view .LVU2113
+	vmovdqa	%xmm5, -32(%rbp)	# tmp105, H[1]
+.LVL334:
+	.loc 1 105 11 is_stmt 1 view .LVU2114
+.LBB3239:
+.LBI3239:
+	.loc 3 695 1 view .LVU2115
+.LBB3240:
+	.loc 3 697 3 view .LVU2116
+	.loc 3 697 3 is_stmt 0 view .LVU2117
+.LBE3240:
+.LBE3239:
+	.loc 1 106 5 is_stmt 1 view .LVU2118
+	.loc 1 107 5 view .LVU2119
+.LBB3241:
+.LBI3241:
+	.loc 3 1327 1 view .LVU2120
+.LBB3242:
+	.loc 3 1329 3 view .LVU2121
+	.loc 3 1329 3 is_stmt 0 view .LVU2122
+.LBE3242:
+.LBE3241:
+	.loc 1 109 5 is_stmt 1 view .LVU2123
+.LBB3243:
+.LBI3243:
+	.loc 4 927 1 view .LVU2124
+.LBB3244:
+	.loc 4 929 3 view .LVU2125
+	.loc 4 929 3 is_stmt 0 view .LVU2126
+.LBE3244:
+.LBE3243:
+.LBB3245:
+.LBI3245:
+	.loc 4 927 1 is_stmt 1 view .LVU2127
+.LBB3246:
+	.loc 4 929 3 view .LVU2128
+	.loc 4 929 3 is_stmt 0 view .LVU2129
+.LBE3246:
+.LBE3245:
+# blake2s-avx512vl.c:109:     blake2s_10rounds(va,vb,vc,vd, H, _mm256_loadu_si256(p + 0),
+	.loc 1 109 5 view .LVU2130
+	call	blake2s_10rounds.constprop.0	#
+.LVL335:
+	.loc 1 112 5 is_stmt 1 view .LVU2131
+.LBB3247:
+.LBI3247:
+	.loc 3 731 1 view .LVU2132
+.LBB3248:
+	.loc 3 733 3 view .LVU2133
+# /usr/lib/gcc/x86_64-linux-gnu/12/include/emmintrin.h:733:   *__P = __B;
+	.loc 3 733 8 is_stmt 0 view .LVU2134
+	vmovdqa	-48(%rbp), %xmm6	# H[0], tmp106
+.LBE3248:
+.LBE3247:
+.LBB3250:
+.LBB3251:
+	vmovdqa	-32(%rbp), %xmm7	# H[1], tmp107
+.LBE3251:
+.LBE3250:
+.LBB3253:
+.LBB3249:
+	vmovdqa	%xmm6, (%rax)	# tmp106, MEM[(__m128i * {ref-all})ctx_4(D)]
+.LVL336:
+	.loc 3 733 8 view .LVU2135
+.LBE3249:
+.LBE3253:
+	.loc 1 113 5 is_stmt 1 view .LVU2136
+.LBB3254:
+.LBI3250:
+	.loc 3 731 1 view .LVU2137
+.LBB3252:
+	.loc 3 733 3 view .LVU2138
+# /usr/lib/gcc/x86_64-linux-gnu/12/include/emmintrin.h:733:   *__P = __B;
+	.loc 3 733 8 is_stmt 0 view .LVU2139
+	vmovdqa	%xmm7, 16(%rax)	# tmp107, MEM[(__m128i * {ref-all})ctx_4(D) + 16B]
+.LVL337:
+	.loc 3 733 8 view .LVU2140
+.LBE3252:
+.LBE3254:
+# blake2s-avx512vl.c:114: }
+	.loc 1 114 1 view .LVU2141
+	movq	-8(%rbp), %r10	#,
+	.cfi_def_cfa 10, 0
+	leave	
+	leaq	-8(%r10), %rsp	#,
+	.cfi_def_cfa 7, 8
+	ret	
+	.cfi_endproc
+.LFE6404:
+	.size	blake2s_compress_avx512vl, .-blake2s_compress_avx512vl
+	.p2align 4
+	.globl	blake2s_compress_blocks_avx512vl
+	.type	blake2s_compress_blocks_avx512vl, @function
+blake2s_compress_blocks_avx512vl:
+.LVL338:
+.LFB6405:
+	.loc 1 118 1 is_stmt 1 view -0
+	.cfi_startproc
+	.loc 1 120 5 view .LVU2143
+	.loc 1 121 5 view .LVU2144
+	.loc 1 122 5 view .LVU2145
+	.loc 1 123 5 view .LVU2146
+	.loc 1 124 5 view .LVU2147
+	.loc 1 126 5 view .LVU2148
+# blake2s-avx512vl.c:126:     if (!nblocks)
+	.loc 1 126 8 is_stmt 0 view .LVU2149
+	testq	%rdx, %rdx	# nblocks
+	je	.L18	#,
+# blake2s-avx512vl.c:118: {
+	.loc 1 118 1 view .LVU2150
+	leaq	8(%rsp), %r10	#,
+	.cfi_def_cfa 10, 0
+	andq	$-32, %rsp	#,
+	movq	%rdi, %rcx	# tmp122, ctx
+	.loc 1 128 5 is_stmt 1 view .LVU2151
+.LVL339:
+.LBB3255:
+.LBI3255:
+	.loc 3 695 1 view .LVU2152
+.LBB3256:
+	.loc 3 697 3 view .LVU2153
+.LBE3256:
+.LBE3255:
+# blake2s-avx512vl.c:118: {
+	.loc 1 118 1 is_stmt 0 view .LVU2154
+	pushq	-8(%r10)	#
+	pushq	%rbp	#
+	movq	%rsp, %rbp	#,
+	.cfi_escape 0x10,0x6,0x2,0x76,0
+	pushq	%r10	#
+	.cfi_escape 0xf,0x3,0x76,0x78,0x6
+	subq	$40, %rsp	#,
+.LBB3258:
+.LBB3257:
+# /usr/lib/gcc/x86_64-linux-gnu/12/include/emmintrin.h:697:   return *__P;
+	.loc 3 697 10 view .LVU2155
+	vmovdqa	(%rdi), %xmm5	# MEM[(const __m128i * {ref-all})ctx_19(D)], prephitmp_55
+.LVL340:
+	.loc 3 697 10 view .LVU2156
+.LBE3257:
+.LBE3258:
+.LBB3259:
+.LBB3260:
+	vmovdqa	16(%rdi), %xmm1	# MEM[(const __m128i * {ref-all})ctx_19(D) + 16B], prephitmp_2
+.LBE3260:
+.LBE3259:
+.LBB3262:
+.LBB3263:
+# /usr/lib/gcc/x86_64-linux-gnu/12/include/avxintrin.h:929:   return *__P;
+	.loc 4 929 10 view .LVU2157
+	vmovdqu	(%rsi), %ymm3	# MEM[(const __m256i_u * {ref-all})m_17(D)], MEM[(const __m256i_u * {ref-all})m_17(D)]
+.LBE3263:
+.LBE3262:
+.LBB3265:
+.LBB3266:
+	vmovdqu	32(%rsi), %ymm4	# MEM[(const __m256i_u * {ref-all})m_17(D) + 32B], MEM[(const __m256i_u * {ref-all})m_17(D) + 32B]
+.LBE3266:
+.LBE3265:
+.LBB3268:
+.LBB3269:
+.LBB3270:
+# /usr/lib/gcc/x86_64-linux-gnu/12/include/emmintrin.h:1072:   return (__m128i) ((__v2du)__A + (__v2du)__B);
+	.loc 3 1072 33 view .LVU2158
+	vmovdqa64	.LC22(%rip), %xmm16	#, tmp120
+	vpaddq	96(%rdi), %xmm16, %xmm0	# MEM[(const __m128i * {ref-all})ctx_19(D) + 96B], tmp120, _6
+.LBE3270:
+.LBE3269:
+.LBE3268:
+# blake2s-avx512vl.c:128:     H[0] = _mm_load_si128((const __m128i *)ctx->H + 0);
+	.loc 1 128 10 view .LVU2159
+	vmovdqa	%xmm5, -48(%rbp)	# prephitmp_55, H[0]
+	.loc 1 129 5 is_stmt 1 view .LVU2160
+.LVL341:
+.LBB3299:
+.LBI3259:
+	.loc 3 695 1 view .LVU2161
+.LBB3261:
+	.loc 3 697 3 view .LVU2162
+	.loc 3 697 3 is_stmt 0 view .LVU2163
+	leaq	-48(%rbp), %rdi	#, tmp121
+.LVL342:
+	.loc 3 697 3 view .LVU2164
+.LBE3261:
+.LBE3299:
+.LBB3300:
+.LBB3276:
+.LBB3277:
+# /usr/lib/gcc/x86_64-linux-gnu/12/include/emmintrin.h:1329:   return (__m128i) ((__v2du)__A ^ (__v2du)__B);
+	.loc 3 1329 33 view .LVU2165
+	vmovdqa	.LC21(%rip), %xmm15	#, tmp119
+.LBE3277:
+.LBE3276:
+.LBE3300:
+# blake2s-avx512vl.c:129:     H[1] = _mm_load_si128((const __m128i *)ctx->H + 1);
+	.loc 1 129 10 view .LVU2166
+	vmovdqa	%xmm1, -32(%rbp)	# prephitmp_2, H[1]
+	.loc 1 130 5 is_stmt 1 view .LVU2167
+.LVL343:
+.LBB3301:
+.LBI3301:
+	.loc 3 695 1 view .LVU2168
+.LBB3302:
+	.loc 3 697 3 view .LVU2169
+	.loc 3 697 3 is_stmt 0 view .LVU2170
+.LBE3302:
+.LBE3301:
+	.loc 1 132 5 is_stmt 1 view .LVU2171
+.LBB3303:
+.LBI3262:
+	.loc 4 927 1 view .LVU2172
+.LBB3264:
+	.loc 4 929 3 view .LVU2173
+# /usr/lib/gcc/x86_64-linux-gnu/12/include/avxintrin.h:929:   return *__P;
+	.loc 4 929 10 is_stmt 0 view .LVU2174
+	vmovdqa	%ymm3, %ymm13	# MEM[(const __m256i_u * {ref-all})m_17(D)], _22
+.LVL344:
+	.loc 4 929 10 view .LVU2175
+.LBE3264:
+.LBE3303:
+	.loc 1 133 5 is_stmt 1 view .LVU2176
+.LBB3304:
+.LBI3265:
+	.loc 4 927 1 view .LVU2177
+.LBB3267:
+	.loc 4 929 3 view .LVU2178
+# /usr/lib/gcc/x86_64-linux-gnu/12/include/avxintrin.h:929:   return *__P;
+	.loc 4 929 10 is_stmt 0 view .LVU2179
+	vmovdqa	%ymm4, %ymm14	# MEM[(const __m256i_u * {ref-all})m_17(D) + 32B], _23
+.LVL345:
+	.loc 4 929 10 view .LVU2180
+.LBE3267:
+.LBE3304:
+	.loc 1 134 5 is_stmt 1 view .LVU2181
+	.loc 1 134 12 view .LVU2182
+.LBB3305:
+	.loc 1 135 9 view .LVU2183
+	.loc 1 137 9 view .LVU2184
+	.loc 1 138 9 view .LVU2185
+.LBB3282:
+.LBB3271:
+# /usr/lib/gcc/x86_64-linux-gnu/12/include/emmintrin.h:1072:   return (__m128i) ((__v2du)__A + (__v2du)__B);
+	.loc 3 1072 10 is_stmt 0 view .LVU2186
+	vmovdqa	%xmm0, %xmm10	# _6, _68
+.LBE3271:
+.LBE3282:
+.LBB3283:
+.LBB3278:
+# /usr/lib/gcc/x86_64-linux-gnu/12/include/emmintrin.h:1329:   return (__m128i) ((__v2du)__A ^ (__v2du)__B);
+	.loc 3 1329 33 view .LVU2187
+	vpxor	%xmm15, %xmm0, %xmm2	# tmp119, _6, _67
+.LBE3278:
+.LBE3283:
+# blake2s-avx512vl.c:138:         if (nblocks) {
+	.loc 1 138 12 view .LVU2188
+	subq	$1, %rdx	#, nblocks
+.LVL346:
+	.loc 1 138 12 view .LVU2189
+	je	.L7	#,
+# blake2s-avx512vl.c:137:         p += 2;
+	.loc 1 137 11 view .LVU2190
+	addq	$64, %rsi	#, p
+.LVL347:
+	.p2align 4,,10
+	.p2align 3
+.L8:
+	.loc 1 139 13 is_stmt 1 view .LVU2191
+.LBB3284:
+.LBI3284:
+	.loc 4 927 1 view .LVU2192
+.LBB3285:
+	.loc 4 929 3 view .LVU2193
+# /usr/lib/gcc/x86_64-linux-gnu/12/include/avxintrin.h:929:   return *__P;
+	.loc 4 929 10 is_stmt 0 view .LVU2194
+	vmovdqu	(%rsi), %ymm12	# MEM[(const __m256i_u * {ref-all})p_35], MEM[(const __m256i_u * {ref-all})p_35]
+.LBE3285:
+.LBE3284:
+.LBB3287:
+.LBB3288:
+	vmovdqu	32(%rsi), %ymm11	# MEM[(const __m256i_u * {ref-all})p_35 + 32B], MEM[(const __m256i_u * {ref-all})p_35 + 32B]
+.LBE3288:
+.LBE3287:
+# blake2s-avx512vl.c:143:         blake2s_10rounds(H[0], H[1],
+	.loc 1 143 9 view .LVU2195
+	vmovdqa	%xmm5, %xmm0	# prephitmp_55,
+# blake2s-avx512vl.c:137:         p += 2;
+	.loc 1 137 11 view .LVU2196
+	addq	$64, %rsi	#, p
+.LVL348:
+# blake2s-avx512vl.c:143:         blake2s_10rounds(H[0], H[1],
+	.loc 1 143 9 view .LVU2197
+	call	blake2s_10rounds.constprop.0	#
+.LVL349:
+.LBB3290:
+.LBB3272:
+# /usr/lib/gcc/x86_64-linux-gnu/12/include/emmintrin.h:1072:   return (__m128i) ((__v2du)__A + (__v2du)__B);
+	.loc 3 1072 33 view .LVU2198
+	vpaddq	%xmm16, %xmm10, %xmm0	# tmp120, _68, _65
+.LBE3272:
+.LBE3290:
+.LBE3305:
+# blake2s-avx512vl.c:150:     _mm_store_si128((__m128i *)ctx->H + 1, H[1]);
+	.loc 1 150 5 view .LVU2199
+	vmovdqa	-32(%rbp), %xmm1	# H[1], prephitmp_2
+# blake2s-avx512vl.c:149:     _mm_store_si128((__m128i *)ctx->H + 0, H[0]);
+	.loc 1 149 5 view .LVU2200
+	vmovdqa	-48(%rbp), %xmm5	# H[0], prephitmp_55
+.LBB3306:
+.LBB3291:
+.LBB3286:
+# /usr/lib/gcc/x86_64-linux-gnu/12/include/avxintrin.h:929:   return *__P;
+	.loc 4 929 10 view .LVU2201
+	vmovdqa	%ymm12, %ymm13	# MEM[(const __m256i_u * {ref-all})p_35], _22
+.LVL350:
+	.loc 4 929 10 view .LVU2202
+.LBE3286:
+.LBE3291:
+	.loc 1 140 13 is_stmt 1 view .LVU2203
+.LBB3292:
+.LBI3287:
+	.loc 4 927 1 view .LVU2204
+.LBB3289:
+	.loc 4 929 3 view .LVU2205
+# /usr/lib/gcc/x86_64-linux-gnu/12/include/avxintrin.h:929:   return *__P;
+	.loc 4 929 10 is_stmt 0 view .LVU2206
+	vmovdqa	%ymm11, %ymm14	# MEM[(const __m256i_u * {ref-all})p_35 + 32B], _23
+.LVL351:
+	.loc 4 929 10 view .LVU2207
+.LBE3289:
+.LBE3292:
+	.loc 1 142 9 is_stmt 1 view .LVU2208
+.LBB3293:
+.LBI3269:
+	.loc 3 1070 1 view .LVU2209
+.LBB3273:
+	.loc 3 1072 3 view .LVU2210
+	.loc 3 1072 3 is_stmt 0 view .LVU2211
+.LBE3273:
+.LBE3293:
+	.loc 1 143 9 is_stmt 1 view .LVU2212
+.LBB3294:
+.LBI3276:
+	.loc 3 1327 1 view .LVU2213
+.LBB3279:
+	.loc 3 1329 3 view .LVU2214
+	.loc 3 1329 3 is_stmt 0 view .LVU2215
+.LBE3279:
+.LBE3294:
+.LBE3306:
+	.loc 1 134 12 is_stmt 1 view .LVU2216
+.LBB3307:
+	.loc 1 135 9 view .LVU2217
+	.loc 1 137 9 view .LVU2218
+	.loc 1 138 9 view .LVU2219
+.LBB3295:
+.LBB3280:
+# /usr/lib/gcc/x86_64-linux-gnu/12/include/emmintrin.h:1329:   return (__m128i) ((__v2du)__A ^ (__v2du)__B);
+	.loc 3 1329 33 is_stmt 0 view .LVU2220
+	vpxor	%xmm15, %xmm0, %xmm2	# tmp119, _65, _67
+.LBE3280:
+.LBE3295:
+.LBB3296:
+.LBB3274:
+# /usr/lib/gcc/x86_64-linux-gnu/12/include/emmintrin.h:1072:   return (__m128i) ((__v2du)__A + (__v2du)__B);
+	.loc 3 1072 10 view .LVU2221
+	vmovdqa	%xmm0, %xmm10	# _65, _68
+.LVL352:
+	.loc 3 1072 10 view .LVU2222
+.LBE3274:
+.LBE3296:
+# blake2s-avx512vl.c:138:         if (nblocks) {
+	.loc 1 138 12 view .LVU2223
+	subq	$1, %rdx	#, nblocks
+.LVL353:
+	.loc 1 138 12 view .LVU2224
+	je	.L7	#,
+# blake2s-avx512vl.c:140:             mhi = _mm256_loadu_si256(p + 1);
+	.loc 1 140 19 view .LVU2225
+	vmovdqa	%ymm11, %ymm4	# MEM[(const __m256i_u * {ref-all})p_35 + 32B], mhi
+# blake2s-avx512vl.c:139:             mlo = _mm256_loadu_si256(p + 0);
+	.loc 1 139 19 view .LVU2226
+	vmovdqa	%ymm12, %ymm3	# MEM[(const __m256i_u * {ref-all})p_35], mlo
+	jmp	.L8	#
+.LVL354:
+	.p2align 4,,10
+	.p2align 3
+.L7:
+	.loc 1 142 9 is_stmt 1 view .LVU2227
+.LBB3297:
+	.loc 3 1070 1 view .LVU2228
+.LBB3275:
+	.loc 3 1072 3 view .LVU2229
+	.loc 3 1072 3 is_stmt 0 view .LVU2230
+.LBE3275:
+.LBE3297:
+	.loc 1 143 9 is_stmt 1 view .LVU2231
+.LBB3298:
+	.loc 3 1327 1 view .LVU2232
+.LBB3281:
+	.loc 3 1329 3 view .LVU2233
+	.loc 3 1329 3 is_stmt 0 view .LVU2234
+.LBE3281:
+.LBE3298:
+# blake2s-avx512vl.c:143:         blake2s_10rounds(H[0], H[1],
+	.loc 1 143 9 view .LVU2235
+	vmovdqa	%ymm14, %ymm4	# _23,
+	vmovdqa	%ymm13, %ymm3	# _22,
+	vmovdqa	%xmm5, %xmm0	# prephitmp_55,
+	call	blake2s_10rounds.constprop.0	#
+.LVL355:
+	.loc 1 143 9 view .LVU2236
+.LBE3307:
+	.loc 1 134 12 is_stmt 1 view .LVU2237
+	.loc 1 149 5 view .LVU2238
+.LBB3308:
+.LBI3308:
+	.loc 3 731 1 view .LVU2239
+.LBB3309:
+	.loc 3 733 3 view .LVU2240
+# /usr/lib/gcc/x86_64-linux-gnu/12/include/emmintrin.h:733:   *__P = __B;
+	.loc 3 733 8 is_stmt 0 view .LVU2241
+	vmovdqa	-48(%rbp), %xmm6	# H[0], tmp126
+.LBE3309:
+.LBE3308:
+.LBB3311:
+.LBB3312:
+	vmovdqa	-32(%rbp), %xmm7	# H[1], tmp127
+.LBE3312:
+.LBE3311:
+.LBB3314:
+.LBB3315:
+	vmovdqa	%xmm10, 96(%rcx)	# _68, MEM[(__m128i * {ref-all})ctx_19(D) + 96B]
+.LBE3315:
+.LBE3314:
+.LBB3317:
+.LBB3310:
+	vmovdqa	%xmm6, (%rcx)	# tmp126, MEM[(__m128i * {ref-all})ctx_19(D)]
+.LVL356:
+	.loc 3 733 8 view .LVU2242
+.LBE3310:
+.LBE3317:
+	.loc 1 150 5 is_stmt 1 view .LVU2243
+.LBB3318:
+.LBI3311:
+	.loc 3 731 1 view .LVU2244
+.LBB3313:
+	.loc 3 733 3 view .LVU2245
+# /usr/lib/gcc/x86_64-linux-gnu/12/include/emmintrin.h:733:   *__P = __B;
+	.loc 3 733 8 is_stmt 0 view .LVU2246
+	vmovdqa	%xmm7, 16(%rcx)	# tmp127, MEM[(__m128i * {ref-all})ctx_19(D) + 16B]
+.LVL357:
+	.loc 3 733 8 view .LVU2247
+.LBE3313:
+.LBE3318:
+	.loc 1 151 5 is_stmt 1 view .LVU2248
+.LBB3319:
+.LBI3314:
+	.loc 3 731 1 view .LVU2249
+.LBB3316:
+	.loc 3 733 3 view .LVU2250
+	.loc 3 733 3 is_stmt 0 view .LVU2251
+.LBE3316:
+.LBE3319:
+# blake2s-avx512vl.c:152: }
+	.loc 1 152 1 view .LVU2252
+	movq	-8(%rbp), %r10	#,
+	.cfi_def_cfa 10, 0
+	leave	
+	leaq	-8(%r10), %rsp	#,
+	.cfi_def_cfa 7, 8
+	ret	
+.LVL358:
+	.p2align 4,,10
+	.p2align 3
+.L18:
+	.cfi_restore 6
+	.loc 1 152 1 view .LVU2253
+	ret	
+	.cfi_endproc
+.LFE6405:
+	.size	blake2s_compress_blocks_avx512vl, .-blake2s_compress_blocks_avx512vl
+	.section	.rodata.cst32,"aM",@progbits,32
+	.align 32
+.LC0:
+	.long	0
+	.long	2
+	.long	4
+	.long	6
+	.long	1
+	.long	3
+	.long	5
+	.long	7
+	.align 32
+.LC1:
+	.long	8
+	.long	10
+	.long	12
+	.long	14
+	.long	9
+	.long	11
+	.long	13
+	.long	15
+	.section	.rodata.cst16,"aM",@progbits,16
+	.align 16
+.LC2:
+	.long	1779033703
+	.long	-1150833019
+	.long	1013904242
+	.long	-1521486534
+	.section	.rodata.cst32
+	.align 32
+.LC3:
+	.long	14
+	.long	4
+	.long	9
+	.long	13
+	.long	10
+	.long	8
+	.long	15
+	.long	6
+	.align 32
+.LC4:
+	.long	1
+	.long	0
+	.long	11
+	.long	5
+	.long	12
+	.long	2
+	.long	7
+	.long	3
+	.align 32
+.LC5:
+	.long	11
+	.long	12
+	.long	5
+	.long	15
+	.long	8
+	.long	0
+	.long	2
+	.long	13
+	.align 32
+.LC6:
+	.long	10
+	.long	3
+	.long	7
+	.long	9
+	.long	14
+	.long	6
+	.long	1
+	.long	4
+	.align 32
+.LC7:
+	.long	7
+	.long	3
+	.long	13
+	.long	11
+	.long	9
+	.long	1
+	.long	12
+	.long	14
+	.align 32
+.LC8:
+	.long	2
+	.long	5
+	.long	4
+	.long	15
+	.long	6
+	.long	10
+	.long	0
+	.long	8
+	.align 32
+.LC9:
+	.long	9
+	.long	5
+	.long	2
+	.long	10
+	.long	0
+	.long	7
+	.long	4
+	.long	15
+	.align 32
+.LC10:
+	.long	14
+	.long	11
+	.long	6
+	.long	3
+	.long	1
+	.long	12
+	.long	8
+	.long	13
+	.align 32
+.LC11:
+	.long	2
+	.long	6
+	.long	0
+	.long	8
+	.long	12
+	.long	10
+	.long	11
+	.long	3
+	.align 32
+.LC12:
+	.long	4
+	.long	7
+	.long	15
+	.long	1
+	.long	13
+	.long	5
+	.long	14
+	.long	9
+	.align 32
+.LC13:
+	.long	12
+	.long	1
+	.long	14
+	.long	4
+	.long	5
+	.long	15
+	.long	13
+	.long	10
+	.align 32
+.LC14:
+	.long	0
+	.long	6
+	.long	9
+	.long	8
+	.long	7
+	.long	3
+	.long	2
+	.long	11
+	.align 32
+.LC15:
+	.long	13
+	.long	7
+	.long	12
+	.long	3
+	.long	11
+	.long	14
+	.long	1
+	.long	9
+	.align 32
+.LC16:
+	.long	5
+	.long	15
+	.long	8
+	.long	2
+	.long	0
+	.long	4
+	.long	6
+	.long	10
+	.align 32
+.LC17:
+	.long	6
+	.long	14
+	.long	11
+	.long	0
+	.long	15
+	.long	9
+	.long	3
+	.long	8
+	.align 32
+.LC18:
+	.long	12
+	.long	13
+	.long	1
+	.long	10
+	.long	2
+	.long	7
+	.long	4
+	.long	5
+	.align 32
+.LC19:
+	.long	10
+	.long	8
+	.long	7
+	.long	1
+	.long	2
+	.long	4
+	.long	6
+	.long	5
+	.align 32
+.LC20:
+	.long	15
+	.long	9
+	.long	3
+	.long	13
+	.long	11
+	.long	14
+	.long	12
+	.long	0
+	.section	.rodata.cst16
+	.align 16
+.LC21:
+	.quad	-7276294671082564993
+	.quad	6620516960021240235
+	.align 16
+.LC22:
+	.quad	64
+	.quad	0
+	.text
+.Letext0:
+	.file 6 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stddef.h"
+	.file 7 "/usr/include/x86_64-linux-gnu/bits/types.h"
+	.file 8 "/usr/include/x86_64-linux-gnu/bits/stdint-uintn.h"
+	.file 9 "blake2s.h"
+	.file 10 "blake2s-internal.h"
+	.file 11 "/usr/lib/gcc/x86_64-linux-gnu/12/include/avx512fintrin.h"
+	.section	.debug_info,"",@progbits
+.Ldebug_info0:
+	.long	0x6480
+	.value	0x5
+	.byte	0x1
+	.byte	0x8
+	.long	.Ldebug_abbrev0
+	.uleb128 0x22
+	.long	.LASF55
+	.byte	0xc
+	.long	.LASF0
+	.long	.LASF1
+	.quad	.Ltext0
+	.quad	.Letext0-.Ltext0
+	.long	.Ldebug_line0
+	.uleb128 0xb
+	.byte	0x8
+	.byte	0x5
+	.long	.LASF2
+	.uleb128 0xa
+	.long	.LASF8
+	.byte	0x6
+	.byte	0xd6
+	.byte	0x1b
+	.long	0x41
+	.uleb128 0xb
+	.byte	0x8
+	.byte	0x7
+	.long	.LASF3
+	.uleb128 0x23
+	.byte	0x4
+	.byte	0x5
+	.string	"int"
+	.uleb128 0xe
+	.long	0x48
+	.uleb128 0xb
+	.byte	0x1
+	.byte	0x8
+	.long	.LASF4
+	.uleb128 0xb
+	.byte	0x2
+	.byte	0x7
+	.long	.LASF5
+	.uleb128 0xb
+	.byte	0x4
+	.byte	0x7
+	.long	.LASF6
+	.uleb128 0xb
+	.byte	0x1
+	.byte	0x6
+	.long	.LASF7
+	.uleb128 0xa
+	.long	.LASF9
+	.byte	0x7
+	.byte	0x26
+	.byte	0x17
+	.long	0x54
+	.uleb128 0xb
+	.byte	0x2
+	.byte	0x5
+	.long	.LASF10
+	.uleb128 0xa
+	.long	.LASF11
+	.byte	0x7
+	.byte	0x2a
+	.byte	0x16
+	.long	0x62
+	.uleb128 0xb
+	.byte	0x1
+	.byte	0x6
+	.long	.LASF12
+	.uleb128 0xa
+	.long	.LASF13
+	.byte	0x8
+	.byte	0x18
+	.byte	0x13
+	.long	0x70
+	.uleb128 0xa
+	.long	.LASF14
+	.byte	0x8
+	.byte	0x1a
+	.byte	0x14
+	.long	0x83
+	.uleb128 0x24
+	.long	.LASF56
+	.byte	0x80
+	.byte	0x10
+	.byte	0x9
+	.byte	0xf7
+	.byte	0x8
+	.long	0x108
+	.uleb128 0x19
+	.string	"H"
+	.byte	0xf8
+	.byte	0xe
+	.long	0x108
+	.byte	0
+	.uleb128 0x19
+	.string	"buf"
+	.byte	0xf9
+	.byte	0x13
+	.long	0x118
+	.byte	0x20
+	.uleb128 0x19
+	.string	"t"
+	.byte	0xfa
+	.byte	0xe
+	.long	0x128
+	.byte	0x60
+	.uleb128 0x19
+	.string	"f"
+	.byte	0xfb
+	.byte	0xe
+	.long	0x128
+	.byte	0x68
+	.uleb128 0x1a
+	.long	.LASF15
+	.byte	0xfc
+	.long	0x62
+	.byte	0x70
+	.uleb128 0x1a
+	.long	.LASF16
+	.byte	0xfd
+	.long	0x62
+	.byte	0x74
+	.uleb128 0x1a
+	.long	.LASF17
+	.byte	0xfe
+	.long	0x62
+	.byte	0x78
+	.byte	0
+	.uleb128 0x13
+	.long	0xa2
+	.long	0x118
+	.uleb128 0xd
+	.long	0x41
+	.byte	0x7
+	.byte	0
+	.uleb128 0x13
+	.long	0x54
+	.long	0x128
+	.uleb128 0xd
+	.long	0x41
+	.byte	0x3f
+	.byte	0
+	.uleb128 0x13
+	.long	0xa2
+	.long	0x138
+	.uleb128 0xd
+	.long	0x41
+	.byte	0x1
+	.byte	0
+	.uleb128 0x18
+	.long	0xae
+	.uleb128 0x18
+	.long	0x142
+	.uleb128 0x25
+	.uleb128 0xb
+	.byte	0x8
+	.byte	0x7
+	.long	.LASF18
+	.uleb128 0xb
+	.byte	0x8
+	.byte	0x5
+	.long	.LASF19
+	.uleb128 0x1d
+	.string	"u8"
+	.byte	0x7
+	.byte	0x11
+	.long	0x96
+	.uleb128 0xe
+	.long	0x151
+	.uleb128 0x1d
+	.string	"u32"
+	.byte	0x8
+	.byte	0x12
+	.long	0xa2
+	.uleb128 0xe
+	.long	0x160
+	.uleb128 0x13
+	.long	0x16b
+	.long	0x180
+	.uleb128 0xd
+	.long	0x41
+	.byte	0x7
+	.byte	0
+	.uleb128 0xe
+	.long	0x170
+	.uleb128 0x1e
+	.long	.LASF20
+	.byte	0xa
+	.byte	0x12
+	.long	0x180
+	.byte	0x20
+	.byte	0x67
+	.byte	0xe6
+	.byte	0x9
+	.byte	0x6a
+	.byte	0x85
+	.byte	0xae
+	.byte	0x67
+	.byte	0xbb
+	.byte	0x72
+	.byte	0xf3
+	.byte	0x6e
+	.byte	0x3c
+	.byte	0x3a
+	.byte	0xf5
+	.byte	0x4f
+	.byte	0xa5
+	.byte	0x7f
+	.byte	0x52
+	.byte	0xe
+	.byte	0x51
+	.byte	0x8c
+	.byte	0x68
+	.byte	0x5
+	.byte	0x9b
+	.byte	0xab
+	.byte	0xd9
+	.byte	0x83
+	.byte	0x1f
+	.byte	0x19
+	.byte	0xcd
+	.byte	0xe0
+	.byte	0x5b
+	.uleb128 0x13
+	.long	0x15b
+	.long	0x1c7
+	.uleb128 0xd
+	.long	0x41
+	.byte	0x9
+	.uleb128 0xd
+	.long	0x41
+	.byte	0xf
+	.byte	0
+	.uleb128 0xe
+	.long	0x1b1
+	.uleb128 0x1e
+	.long	.LASF21
+	.byte	0xf
+	.byte	0x11
+	.long	0x1c7
+	.byte	0xa0
+	.byte	0
+	.byte	0x1
+	.byte	0x2
+	.byte	0x3
+	.byte	0x4
+	.byte	0x5
+	.byte	0x6
+	.byte	0x7
+	.byte	0x8
+	.byte	0x9
+	.byte	0xa
+	.byte	0xb
+	.byte	0xc
+	.byte	0xd
+	.byte	0xe
+	.byte	0xf
+	.byte	0xe
+	.byte	0xa
+	.byte	0x4
+	.byte	0x8
+	.byte	0x9
+	.byte	0xf
+	.byte	0xd
+	.byte	0x6
+	.byte	0x1
+	.byte	0xc
+	.byte	0
+	.byte	0x2
+	.byte	0xb
+	.byte	0x7
+	.byte	0x5
+	.byte	0x3
+	.byte	0xb
+	.byte	0x8
+	.byte	0xc
+	.byte	0
+	.byte	0x5
+	.byte	0x2
+	.byte	0xf
+	.byte	0xd
+	.byte	0xa
+	.byte	0xe
+	.byte	0x3
+	.byte	0x6
+	.byte	0x7
+	.byte	0x1
+	.byte	0x9
+	.byte	0x4
+	.byte	0x7
+	.byte	0x9
+	.byte	0x3
+	.byte	0x1
+	.byte	0xd
+	.byte	0xc
+	.byte	0xb
+	.byte	0xe
+	.byte	0x2
+	.byte	0x6
+	.byte	0x5
+	.byte	0xa
+	.byte	0x4
+	.byte	0
+	.byte	0xf
+	.byte	0x8
+	.byte	0x9
+	.byte	0
+	.byte	0x5
+	.byte	0x7
+	.byte	0x2
+	.byte	0x4
+	.byte	0xa
+	.byte	0xf
+	.byte	0xe
+	.byte	0x1
+	.byte	0xb
+	.byte	0xc
+	.byte	0x6
+	.byte	0x8
+	.byte	0x3
+	.byte	0xd
+	.byte	0x2
+	.byte	0xc
+	.byte	0x6
+	.byte	0xa
+	.byte	0
+	.byte	0xb
+	.byte	0x8
+	.byte	0x3
+	.byte	0x4
+	.byte	0xd
+	.byte	0x7
+	.byte	0x5
+	.byte	0xf
+	.byte	0xe
+	.byte	0x1
+	.byte	0x9
+	.byte	0xc
+	.byte	0x5
+	.byte	0x1
+	.byte	0xf
+	.byte	0xe
+	.byte	0xd
+	.byte	0x4
+	.byte	0xa
+	.byte	0
+	.byte	0x7
+	.byte	0x6
+	.byte	0x3
+	.byte	0x9
+	.byte	0x2
+	.byte	0x8
+	.byte	0xb
+	.byte	0xd
+	.byte	0xb
+	.byte	0x7
+	.byte	0xe
+	.byte	0xc
+	.byte	0x1
+	.byte	0x3
+	.byte	0x9
+	.byte	0x5
+	.byte	0
+	.byte	0xf
+	.byte	0x4
+	.byte	0x8
+	.byte	0x6
+	.byte	0x2
+	.byte	0xa
+	.byte	0x6
+	.byte	0xf
+	.byte	0xe
+	.byte	0x9
+	.byte	0xb
+	.byte	0x3
+	.byte	0
+	.byte	0x8
+	.byte	0xc
+	.byte	0x2
+	.byte	0xd
+	.byte	0x7
+	.byte	0x1
+	.byte	0x4
+	.byte	0xa
+	.byte	0x5
+	.byte	0xa
+	.byte	0x2
+	.byte	0x8
+	.byte	0x4
+	.byte	0x7
+	.byte	0x6
+	.byte	0x1
+	.byte	0x5
+	.byte	0xf
+	.byte	0xb
+	.byte	0x9
+	.byte	0xe
+	.byte	0x3
+	.byte	0xc
+	.byte	0xd
+	.byte	0
+	.uleb128 0xb
+	.byte	0x4
+	.byte	0x4
+	.long	.LASF22
+	.uleb128 0xb
+	.byte	0x8
+	.byte	0x4
+	.long	.LASF23
+	.uleb128 0xa
+	.long	.LASF24
+	.byte	0x3
+	.byte	0x29
+	.byte	0x13
+	.long	0x292
+	.uleb128 0x14
+	.long	0x14a
+	.long	0x29e
+	.uleb128 0x15
+	.byte	0x1
+	.byte	0
+	.uleb128 0xa
+	.long	.LASF25
+	.byte	0x3
+	.byte	0x2a
+	.byte	0x1c
+	.long	0x2aa
+	.uleb128 0x14
+	.long	0x143
+	.long	0x2b6
+	.uleb128 0x15
+	.byte	0x1
+	.byte	0
+	.uleb128 0xa
+	.long	.LASF26
+	.byte	0x3
+	.byte	0x2b
+	.byte	0xd
+	.long	0x2c2
+	.uleb128 0x14
+	.long	0x48
+	.long	0x2ce
+	.uleb128 0x15
+	.byte	0x3
+	.byte	0
+	.uleb128 0xa
+	.long	.LASF27
+	.byte	0x3
+	.byte	0x2c
+	.byte	0x16
+	.long	0x2da
+	.uleb128 0x14
+	.long	0x62
+	.long	0x2e6
+	.uleb128 0x15
+	.byte	0x3
+	.byte	0
+	.uleb128 0xa
+	.long	.LASF28
+	.byte	0x3
+	.byte	0x35
+	.byte	0x13
+	.long	0x2f7
+	.uleb128 0xe
+	.long	0x2e6
+	.uleb128 0x14
+	.long	0x14a
+	.long	0x303
+	.uleb128 0x15
+	.byte	0x1
+	.byte	0
+	.uleb128 0xa
+	.long	.LASF29
+	.byte	0x4
+	.byte	0x2b
+	.byte	0x13
+	.long	0x30f
+	.uleb128 0x14
+	.long	0x14a
+	.long	0x31b
+	.uleb128 0x15
+	.byte	0x3
+	.byte	0
+	.uleb128 0xa
+	.long	.LASF30
+	.byte	0x4
+	.byte	0x2d
+	.byte	0xd
+	.long	0x327
+	.uleb128 0x14
+	.long	0x48
+	.long	0x333
+	.uleb128 0x15
+	.byte	0x7
+	.byte	0
+	.uleb128 0xa
+	.long	.LASF31
+	.byte	0x4
+	.byte	0x39
+	.byte	0x13
+	.long	0x344
+	.uleb128 0xe
+	.long	0x333
+	.uleb128 0x14
+	.long	0x14a
+	.long	0x350
+	.uleb128 0x15
+	.byte	0x3
+	.byte	0
+	.uleb128 0x26
+	.long	.LASF57
+	.byte	0x4
+	.byte	0x42
+	.byte	0x13
+	.long	0x344
+	.byte	0x1
+	.uleb128 0xe
+	.long	0x350
+	.uleb128 0xa
+	.long	.LASF32
+	.byte	0xb
+	.byte	0x3c
+	.byte	0x17
+	.long	0x54
+	.uleb128 0xb
+	.byte	0x2
+	.byte	0x4
+	.long	.LASF33
+	.uleb128 0x13
+	.long	0x16b
+	.long	0x38b
+	.uleb128 0xd
+	.long	0x41
+	.byte	0x1
+	.uleb128 0xd
+	.long	0x41
+	.byte	0x3
+	.byte	0
+	.uleb128 0xe
+	.long	0x375
+	.uleb128 0x27
+	.long	.LASF34
+	.byte	0x1
+	.byte	0xa
+	.byte	0x12
+	.long	0x38b
+	.byte	0x10
+	.byte	0x20
+	.byte	0x67
+	.byte	0xe6
+	.byte	0x9
+	.byte	0x6a
+	.byte	0x85
+	.byte	0xae
+	.byte	0x67
+	.byte	0xbb
+	.byte	0x72
+	.byte	0xf3
+	.byte	0x6e
+	.byte	0x3c
+	.byte	0x3a
+	.byte	0xf5
+	.byte	0x4f
+	.byte	0xa5
+	.byte	0x7f
+	.byte	0x52
+	.byte	0xe
+	.byte	0x51
+	.byte	0x8c
+	.byte	0x68
+	.byte	0x5
+	.byte	0x9b
+	.byte	0xab
+	.byte	0xd9
+	.byte	0x83
+	.byte	0x1f
+	.byte	0x19
+	.byte	0xcd
+	.byte	0xe0
+	.byte	0x5b
+	.uleb128 0x13
+	.long	0x16b
+	.long	0x3d4
+	.uleb128 0xd
+	.long	0x41
+	.byte	0x9
+	.uleb128 0xd
+	.long	0x41
+	.byte	0xf
+	.byte	0
+	.uleb128 0xe
+	.long	0x3be
+	.uleb128 0x28
+	.long	.LASF35
+	.byte	0x1
+	.byte	0x13
+	.byte	0x12
+	.long	0x3d4
+	.byte	0x20
+	.value	0x280
+	.byte	0
+	.byte	0
+	.byte	0
+	.byte	0
+	.byte	0x2
+	.byte	0
+	.byte	0
+	.byte	0
+	.byte	0x4
+	.byte	0
+	.byte	0
+	.byte	0
+	.byte	0x6
+	.byte	0
+	.byte	0
+	.byte	0
+	.byte	0x1
+	.byte	0
+	.byte	0
+	.byte	0
+	.byte	0x3
+	.byte	0
+	.byte	0
+	.byte	0
+	.byte	0x5
+	.byte	0
+	.byte	0
+	.byte	0
+	.byte	0x7
+	.byte	0
+	.byte	0
+	.byte	0
+	.byte	0x8
+	.byte	0
+	.byte	0
+	.byte	0
+	.byte	0xa
+	.byte	0
+	.byte	0
+	.byte	0
+	.byte	0xc
+	.byte	0
+	.byte	0
+	.byte	0
+	.byte	0xe
+	.byte	0
+	.byte	0
+	.byte	0
+	.byte	0x9
+	.byte	0
+	.byte	0
+	.byte	0
+	.byte	0xb
+	.byte	0
+	.byte	0
+	.byte	0
+	.byte	0xd
+	.byte	0
+	.byte	0
+	.byte	0
+	.byte	0xf
+	.byte	0
+	.byte	0
+	.byte	0
+	.byte	0xe
+	.byte	0
+	.byte	0
+	.byte	0
+	.byte	0x4
+	.byte	0
+	.byte	0
+	.byte	0
+	.byte	0x9
+	.byte	0
+	.byte	0
+	.byte	0
+	.byte	0xd
+	.byte	0
+	.byte	0
+	.byte	0
+	.byte	0xa
+	.byte	0
+	.byte	0
+	.byte	0
+	.byte	0x8
+	.byte	0
+	.byte	0
+	.byte	0
+	.byte	0xf
+	.byte	0
+	.byte	0
+	.byte	0
+	.byte	0x6
+	.byte	0
+	.byte	0
+	.byte	0
+	.byte	0x1
+	.byte	0
+	.byte	0
+	.byte	0
+	.byte	0
+	.byte	0
+	.byte	0
+	.byte	0
+	.byte	0xb
+	.byte	0
+	.byte	0
+	.byte	0
+	.byte	0x5
+	.byte	0
+	.byte	0
+	.byte	0
+	.byte	0xc
+	.byte	0
+	.byte	0
+	.byte	0
+	.byte	0x2
+	.byte	0
+	.byte	0
+	.byte	0
+	.byte	0x7
+	.byte	0
+	.byte	0
+	.byte	0
+	.byte	0x3
+	.byte	0
+	.byte	0
+	.byte	0
+	.byte	0xb
+	.byte	0
+	.byte	0
+	.byte	0
+	.byte	0xc
+	.byte	0
+	.byte	0
+	.byte	0
+	.byte	0x5
+	.byte	0
+	.byte	0
+	.byte	0
+	.byte	0xf
+	.byte	0
+	.byte	0
+	.byte	0
+	.byte	0x8
+	.byte	0
+	.byte	0
+	.byte	0
+	.byte	0
+	.byte	0
+	.byte	0
+	.byte	0
+	.byte	0x2
+	.byte	0
+	.byte	0
+	.byte	0
+	.byte	0xd
+	.byte	0
+	.byte	0
+	.byte	0
+	.byte	0xa
+	.byte	0
+	.byte	0
+	.byte	0
+	.byte	0x3
+	.byte	0
+	.byte	0
+	.byte	0
+	.byte	0x7
+	.byte	0
+	.byte	0
+	.byte	0
+	.byte	0x9
+	.byte	0
+	.byte	0
+	.byte	0
+	.byte	0xe
+	.byte	0
+	.byte	0
+	.byte	0
+	.byte	0x6
+	.byte	0
+	.byte	0
+	.byte	0
+	.byte	0x1
+	.byte	0
+	.byte	0
+	.byte	0
+	.byte	0x4
+	.byte	0
+	.byte	0
+	.byte	0
+	.byte	0x7
+	.byte	0
+	.byte	0
+	.byte	0
+	.byte	0x3
+	.byte	0
+	.byte	0
+	.byte	0
+	.byte	0xd
+	.byte	0
+	.byte	0
+	.byte	0
+	.byte	0xb
+	.byte	0
+	.byte	0
+	.byte	0
+	.byte	0x9
+	.byte	0
+	.byte	0
+	.byte	0
+	.byte	0x1
+	.byte	0
+	.byte	0
+	.byte	0
+	.byte	0xc
+	.byte	0
+	.byte	0
+	.byte	0
+	.byte	0xe
+	.byte	0
+	.byte	0
+	.byte	0
+	.byte	0x2
+	.byte	0
+	.byte	0
+	.byte	0
+	.byte	0x5
+	.byte	0
+	.byte	0
+	.byte	0
+	.byte	0x4
+	.byte	0
+	.byte	0
+	.byte	0
+	.byte	0xf
+	.byte	0
+	.byte	0
+	.byte	0
+	.byte	0x6
+	.byte	0
+	.byte	0
+	.byte	0
+	.byte	0xa
+	.byte	0
+	.byte	0
+	.byte	0
+	.byte	0
+	.byte	0
+	.byte	0
+	.byte	0
+	.byte	0x8
+	.byte	0
+	.byte	0
+	.byte	0
+	.byte	0x9
+	.byte	0
+	.byte	0
+	.byte	0
+	.byte	0x5
+	.byte	0
+	.byte	0
+	.byte	0
+	.byte	0x2
+	.byte	0
+	.byte	0
+	.byte	0
+	.byte	0xa
+	.byte	0
+	.byte	0
+	.byte	0
+	.byte	0
+	.byte	0
+	.byte	0
+	.byte	0
+	.byte	0x7
+	.byte	0
+	.byte	0
+	.byte	0
+	.byte	0x4
+	.byte	0
+	.byte	0
+	.byte	0
+	.byte	0xf
+	.byte	0
+	.byte	0
+	.byte	0
+	.byte	0xe
+	.byte	0
+	.byte	0
+	.byte	0
+	.byte	0xb
+	.byte	0
+	.byte	0
+	.byte	0
+	.byte	0x6
+	.byte	0
+	.byte	0
+	.byte	0
+	.byte	0x3
+	.byte	0
+	.byte	0
+	.byte	0
+	.byte	0x1
+	.byte	0
+	.byte	0
+	.byte	0
+	.byte	0xc
+	.byte	0
+	.byte	0
+	.byte	0
+	.byte	0x8
+	.byte	0
+	.byte	0
+	.byte	0
+	.byte	0xd
+	.byte	0
+	.byte	0
+	.byte	0
+	.byte	0x2
+	.byte	0
+	.byte	0
+	.byte	0
+	.byte	0x6
+	.byte	0
+	.byte	0
+	.byte	0
+	.byte	0
+	.byte	0
+	.byte	0
+	.byte	0
+	.byte	0x8
+	.byte	0
+	.byte	0
+	.byte	0
+	.byte	0xc
+	.byte	0
+	.byte	0
+	.byte	0
+	.byte	0xa
+	.byte	0
+	.byte	0
+	.byte	0
+	.byte	0xb
+	.byte	0
+	.byte	0
+	.byte	0
+	.byte	0x3
+	.byte	0
+	.byte	0
+	.byte	0
+	.byte	0x4
+	.byte	0
+	.byte	0
+	.byte	0
+	.byte	0x7
+	.byte	0
+	.byte	0
+	.byte	0
+	.byte	0xf
+	.byte	0
+	.byte	0
+	.byte	0
+	.byte	0x1
+	.byte	0
+	.byte	0
+	.byte	0
+	.byte	0xd
+	.byte	0
+	.byte	0
+	.byte	0
+	.byte	0x5
+	.byte	0
+	.byte	0
+	.byte	0
+	.byte	0xe
+	.byte	0
+	.byte	0
+	.byte	0
+	.byte	0x9
+	.byte	0
+	.byte	0
+	.byte	0
+	.byte	0xc
+	.byte	0
+	.byte	0
+	.byte	0
+	.byte	0x1
+	.byte	0
+	.byte	0
+	.byte	0
+	.byte	0xe
+	.byte	0
+	.byte	0
+	.byte	0
+	.byte	0x4
+	.byte	0
+	.byte	0
+	.byte	0
+	.byte	0x5
+	.byte	0
+	.byte	0
+	.byte	0
+	.byte	0xf
+	.byte	0
+	.byte	0
+	.byte	0
+	.byte	0xd
+	.byte	0
+	.byte	0
+	.byte	0
+	.byte	0xa
+	.byte	0
+	.byte	0
+	.byte	0
+	.byte	0
+	.byte	0
+	.byte	0
+	.byte	0
+	.byte	0x6
+	.byte	0
+	.byte	0
+	.byte	0
+	.byte	0x9
+	.byte	0
+	.byte	0
+	.byte	0
+	.byte	0x8
+	.byte	0
+	.byte	0
+	.byte	0
+	.byte	0x7
+	.byte	0
+	.byte	0
+	.byte	0
+	.byte	0x3
+	.byte	0
+	.byte	0
+	.byte	0
+	.byte	0x2
+	.byte	0
+	.byte	0
+	.byte	0
+	.byte	0xb
+	.byte	0
+	.byte	0
+	.byte	0
+	.byte	0xd
+	.byte	0
+	.byte	0
+	.byte	0
+	.byte	0x7
+	.byte	0
+	.byte	0
+	.byte	0
+	.byte	0xc
+	.byte	0
+	.byte	0
+	.byte	0
+	.byte	0x3
+	.byte	0
+	.byte	0
+	.byte	0
+	.byte	0xb
+	.byte	0
+	.byte	0
+	.byte	0
+	.byte	0xe
+	.byte	0
+	.byte	0
+	.byte	0
+	.byte	0x1
+	.byte	0
+	.byte	0
+	.byte	0
+	.byte	0x9
+	.byte	0
+	.byte	0
+	.byte	0
+	.byte	0x5
+	.byte	0
+	.byte	0
+	.byte	0
+	.byte	0xf
+	.byte	0
+	.byte	0
+	.byte	0
+	.byte	0x8
+	.byte	0
+	.byte	0
+	.byte	0
+	.byte	0x2
+	.byte	0
+	.byte	0
+	.byte	0
+	.byte	0
+	.byte	0
+	.byte	0
+	.byte	0
+	.byte	0x4
+	.byte	0
+	.byte	0
+	.byte	0
+	.byte	0x6
+	.byte	0
+	.byte	0
+	.byte	0
+	.byte	0xa
+	.byte	0
+	.byte	0
+	.byte	0
+	.byte	0x6
+	.byte	0
+	.byte	0
+	.byte	0
+	.byte	0xe
+	.byte	0
+	.byte	0
+	.byte	0
+	.byte	0xb
+	.byte	0
+	.byte	0
+	.byte	0
+	.byte	0
+	.byte	0
+	.byte	0
+	.byte	0
+	.byte	0xf
+	.byte	0
+	.byte	0
+	.byte	0
+	.byte	0x9
+	.byte	0
+	.byte	0
+	.byte	0
+	.byte	0x3
+	.byte	0
+	.byte	0
+	.byte	0
+	.byte	0x8
+	.byte	0
+	.byte	0
+	.byte	0
+	.byte	0xc
+	.byte	0
+	.byte	0
+	.byte	0
+	.byte	0xd
+	.byte	0
+	.byte	0
+	.byte	0
+	.byte	0x1
+	.byte	0
+	.byte	0
+	.byte	0
+	.byte	0xa
+	.byte	0
+	.byte	0
+	.byte	0
+	.byte	0x2
+	.byte	0
+	.byte	0
+	.byte	0
+	.byte	0x7
+	.byte	0
+	.byte	0
+	.byte	0
+	.byte	0x4
+	.byte	0
+	.byte	0
+	.byte	0
+	.byte	0x5
+	.byte	0
+	.byte	0
+	.byte	0
+	.byte	0xa
+	.byte	0
+	.byte	0
+	.byte	0
+	.byte	0x8
+	.byte	0
+	.byte	0
+	.byte	0
+	.byte	0x7
+	.byte	0
+	.byte	0
+	.byte	0
+	.byte	0x1
+	.byte	0
+	.byte	0
+	.byte	0
+	.byte	0x2
+	.byte	0
+	.byte	0
+	.byte	0
+	.byte	0x4
+	.byte	0
+	.byte	0
+	.byte	0
+	.byte	0x6
+	.byte	0
+	.byte	0
+	.byte	0
+	.byte	0x5
+	.byte	0
+	.byte	0
+	.byte	0
+	.byte	0xf
+	.byte	0
+	.byte	0
+	.byte	0
+	.byte	0x9
+	.byte	0
+	.byte	0
+	.byte	0
+	.byte	0x3
+	.byte	0
+	.byte	0
+	.byte	0
+	.byte	0xd
+	.byte	0
+	.byte	0
+	.byte	0
+	.byte	0xb
+	.byte	0
+	.byte	0
+	.byte	0
+	.byte	0xe
+	.byte	0
+	.byte	0
+	.byte	0
+	.byte	0xc
+	.byte	0
+	.byte	0
+	.byte	0
+	.byte	0
+	.byte	0
+	.byte	0
+	.byte	0
+	.uleb128 0x1f
+	.long	.LASF37
+	.byte	0x74
+	.quad	.LFB6405
+	.quad	.LFE6405-.LFB6405
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0x94e
+	.uleb128 0x1b
+	.string	"ctx"
+	.byte	0x74
+	.byte	0x3b
+	.long	0x138
+	.long	.LLST966
+	.long	.LVUS966
+	.uleb128 0x1b
+	.string	"m"
+	.byte	0x74
+	.byte	0x4c
+	.long	0x13d
+	.long	.LLST967
+	.long	.LVUS967
+	.uleb128 0x29
+	.long	.LASF36
+	.byte	0x1
+	.byte	0x75
+	.byte	0x2e
+	.long	0x35
+	.long	.LLST968
+	.long	.LVUS968
+	.uleb128 0x2a
+	.long	.LASF39
+	.byte	0x1
+	.byte	0x78
+	.byte	0x13
+	.long	0x2f2
+	.uleb128 0xf
+	.string	"p"
+	.byte	0x79
+	.byte	0x14
+	.long	0x94e
+	.long	.LLST969
+	.long	.LVUS969
+	.uleb128 0x20
+	.string	"H"
+	.byte	0x7a
+	.long	0x953
+	.uleb128 0x2
+	.byte	0x76
+	.sleb128 -48
+	.uleb128 0xf
+	.string	"vpr"
+	.byte	0x7b
+	.byte	0xd
+	.long	0x2e6
+	.long	.LLST970
+	.long	.LVUS970
+	.uleb128 0xf
+	.string	"mlo"
+	.byte	0x7c
+	.byte	0xd
+	.long	0x333
+	.long	.LLST971
+	.long	.LVUS971
+	.uleb128 0xf
+	.string	"mhi"
+	.byte	0x7c
+	.byte	0x12
+	.long	0x333
+	.long	.LLST972
+	.long	.LVUS972
+	.uleb128 0x2b
+	.long	.LLRL981
+	.long	0x7f5
+	.uleb128 0xf
+	.string	"blo"
+	.byte	0x87
+	.byte	0x11
+	.long	0x333
+	.long	.LLST982
+	.long	.LVUS982
+	.uleb128 0xf
+	.string	"bhi"
+	.byte	0x87
+	.byte	0x1c
+	.long	0x333
+	.long	.LLST983
+	.long	.LVUS983
+	.uleb128 0x4
+	.long	0xe69
+	.quad	.LBI3269
+	.value	.LVU2209
+	.long	.LLRL984
+	.byte	0x8e
+	.byte	0xf
+	.long	0x770
+	.uleb128 0x2
+	.long	0xe86
+	.uleb128 0x2
+	.long	0xe79
+	.byte	0
+	.uleb128 0x4
+	.long	0xe3e
+	.quad	.LBI3276
+	.value	.LVU2213
+	.long	.LLRL985
+	.byte	0x8f
+	.byte	0x9
+	.long	0x794
+	.uleb128 0x2
+	.long	0xe5b
+	.uleb128 0x2
+	.long	0xe4e
+	.byte	0
+	.uleb128 0x4
+	.long	0xdd3
+	.quad	.LBI3284
+	.value	.LVU2192
+	.long	.LLRL986
+	.byte	0x8b
+	.byte	0x13
+	.long	0x7bb
+	.uleb128 0x1
+	.long	0xde3
+	.long	.LLST987
+	.long	.LVUS987
+	.byte	0
+	.uleb128 0x4
+	.long	0xdd3
+	.quad	.LBI3287
+	.value	.LVU2204
+	.long	.LLRL988
+	.byte	0x8c
+	.byte	0x13
+	.long	0x7da
+	.uleb128 0x2
+	.long	0xde3
+	.byte	0
+	.uleb128 0x21
+	.quad	.LVL349
+	.long	0xf42
+	.uleb128 0x21
+	.quad	.LVL355
+	.long	0xf42
+	.byte	0
+	.uleb128 0x4
+	.long	0xef6
+	.quad	.LBI3255
+	.value	.LVU2152
+	.long	.LLRL973
+	.byte	0x80
+	.byte	0xc
+	.long	0x81c
+	.uleb128 0x1
+	.long	0xf06
+	.long	.LLST974
+	.long	.LVUS974
+	.byte	0
+	.uleb128 0x4
+	.long	0xef6
+	.quad	.LBI3259
+	.value	.LVU2161
+	.long	.LLRL975
+	.byte	0x81
+	.byte	0xc
+	.long	0x843
+	.uleb128 0x1
+	.long	0xf06
+	.long	.LLST976
+	.long	.LVUS976
+	.byte	0
+	.uleb128 0x4
+	.long	0xdd3
+	.quad	.LBI3262
+	.value	.LVU2172
+	.long	.LLRL977
+	.byte	0x84
+	.byte	0xb
+	.long	0x86a
+	.uleb128 0x1
+	.long	0xde3
+	.long	.LLST978
+	.long	.LVUS978
+	.byte	0
+	.uleb128 0x4
+	.long	0xdd3
+	.quad	.LBI3265
+	.value	.LVU2177
+	.long	.LLRL979
+	.byte	0x85
+	.byte	0xb
+	.long	0x891
+	.uleb128 0x1
+	.long	0xde3
+	.long	.LLST980
+	.long	.LVUS980
+	.byte	0
+	.uleb128 0x6
+	.long	0xef6
+	.quad	.LBI3301
+	.value	.LVU2168
+	.quad	.LBB3301
+	.quad	.LBE3301-.LBB3301
+	.byte	0x82
+	.byte	0xb
+	.long	0x8bc
+	.uleb128 0x2
+	.long	0xf06
+	.byte	0
+	.uleb128 0x4
+	.long	0xecd
+	.quad	.LBI3308
+	.value	.LVU2239
+	.long	.LLRL989
+	.byte	0x95
+	.byte	0x5
+	.long	0x8f0
+	.uleb128 0x1
+	.long	0xee8
+	.long	.LLST990
+	.long	.LVUS990
+	.uleb128 0x1
+	.long	0xedb
+	.long	.LLST991
+	.long	.LVUS991
+	.byte	0
+	.uleb128 0x4
+	.long	0xecd
+	.quad	.LBI3311
+	.value	.LVU2244
+	.long	.LLRL992
+	.byte	0x96
+	.byte	0x5
+	.long	0x924
+	.uleb128 0x1
+	.long	0xee8
+	.long	.LLST993
+	.long	.LVUS993
+	.uleb128 0x1
+	.long	0xedb
+	.long	.LLST994
+	.long	.LVUS994
+	.byte	0
+	.uleb128 0x2c
+	.long	0xecd
+	.quad	.LBI3314
+	.value	.LVU2249
+	.long	.LLRL995
+	.byte	0x1
+	.byte	0x97
+	.byte	0x5
+	.uleb128 0x2
+	.long	0xee8
+	.uleb128 0x1
+	.long	0xedb
+	.long	.LLST996
+	.long	.LVUS996
+	.byte	0
+	.byte	0
+	.uleb128 0x18
+	.long	0x33f
+	.uleb128 0x13
+	.long	0x2e6
+	.long	0x963
+	.uleb128 0xd
+	.long	0x41
+	.byte	0x1
+	.byte	0
+	.uleb128 0x1f
+	.long	.LASF38
+	.byte	0x61
+	.quad	.LFB6404
+	.quad	.LFE6404-.LFB6404
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0xba5
+	.uleb128 0x1b
+	.string	"ctx"
+	.byte	0x61
+	.byte	0x34
+	.long	0x138
+	.long	.LLST949
+	.long	.LVUS949
+	.uleb128 0x2d
+	.string	"m"
+	.byte	0x1
+	.byte	0x61
+	.byte	0x45
+	.long	0x13d
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0xf
+	.string	"p"
+	.byte	0x63
+	.byte	0x14
+	.long	0x94e
+	.long	.LLST950
+	.long	.LVUS950
+	.uleb128 0x20
+	.string	"H"
+	.byte	0x64
+	.long	0x953
+	.uleb128 0x2
+	.byte	0x76
+	.sleb128 -48
+	.uleb128 0xf
+	.string	"va"
+	.byte	0x65
+	.byte	0xd
+	.long	0x2e6
+	.long	.LLST951
+	.long	.LVUS951
+	.uleb128 0xf
+	.string	"vb"
+	.byte	0x65
+	.byte	0x11
+	.long	0x2e6
+	.long	.LLST952
+	.long	.LVUS952
+	.uleb128 0x7
+	.string	"vc"
+	.byte	0x65
+	.byte	0x15
+	.long	0x2e6
+	.uleb128 0x7
+	.string	"vd"
+	.byte	0x65
+	.byte	0x19
+	.long	0x2e6
+	.uleb128 0xf
+	.string	"vpr"
+	.byte	0x66
+	.byte	0xd
+	.long	0x2e6
+	.long	.LLST953
+	.long	.LVUS953
+	.uleb128 0x4
+	.long	0xef6
+	.quad	.LBI3233
+	.value	.LVU2098
+	.long	.LLRL954
+	.byte	0x67
+	.byte	0x11
+	.long	0xa2c
+	.uleb128 0x1
+	.long	0xf06
+	.long	.LLST955
+	.long	.LVUS955
+	.byte	0
+	.uleb128 0x6
+	.long	0xef6
+	.quad	.LBI3237
+	.value	.LVU2109
+	.quad	.LBB3237
+	.quad	.LBE3237-.LBB3237
+	.byte	0x68
+	.byte	0x11
+	.long	0xa57
+	.uleb128 0x2
+	.long	0xf06
+	.byte	0
+	.uleb128 0x6
+	.long	0xef6
+	.quad	.LBI3239
+	.value	.LVU2115
+	.quad	.LBB3239
+	.quad	.LBE3239-.LBB3239
+	.byte	0x69
+	.byte	0x11
+	.long	0xa8a
+	.uleb128 0x1
+	.long	0xf06
+	.long	.LLST956
+	.long	.LVUS956
+	.byte	0
+	.uleb128 0x6
+	.long	0xe3e
+	.quad	.LBI3241
+	.value	.LVU2120
+	.quad	.LBB3241
+	.quad	.LBE3241-.LBB3241
+	.byte	0x6b
+	.byte	0xa
+	.long	0xac2
+	.uleb128 0x1
+	.long	0xe5b
+	.long	.LLST957
+	.long	.LVUS957
+	.uleb128 0x2
+	.long	0xe4e
+	.byte	0
+	.uleb128 0x6
+	.long	0xdd3
+	.quad	.LBI3243
+	.value	.LVU2124
+	.quad	.LBB3243
+	.quad	.LBE3243-.LBB3243
+	.byte	0x6d
+	.byte	0x5
+	.long	0xaf5
+	.uleb128 0x1
+	.long	0xde3
+	.long	.LLST958
+	.long	.LVUS958
+	.byte	0
+	.uleb128 0x6
+	.long	0xdd3
+	.quad	.LBI3245
+	.value	.LVU2127
+	.quad	.LBB3245
+	.quad	.LBE3245-.LBB3245
+	.byte	0x6d
+	.byte	0x5
+	.long	0xb28
+	.uleb128 0x1
+	.long	0xde3
+	.long	.LLST959
+	.long	.LVUS959
+	.byte	0
+	.uleb128 0x4
+	.long	0xecd
+	.quad	.LBI3247
+	.value	.LVU2132
+	.long	.LLRL960
+	.byte	0x70
+	.byte	0x5
+	.long	0xb5c
+	.uleb128 0x1
+	.long	0xee8
+	.long	.LLST961
+	.long	.LVUS961
+	.uleb128 0x1
+	.long	0xedb
+	.long	.LLST962
+	.long	.LVUS962
+	.byte	0
+	.uleb128 0x4
+	.long	0xecd
+	.quad	.LBI3250
+	.value	.LVU2137
+	.long	.LLRL963
+	.byte	0x71
+	.byte	0x5
+	.long	0xb90
+	.uleb128 0x1
+	.long	0xee8
+	.long	.LLST964
+	.long	.LVUS964
+	.uleb128 0x1
+	.long	0xedb
+	.long	.LLST965
+	.long	.LVUS965
+	.byte	0
+	.uleb128 0x2e
+	.quad	.LVL335
+	.long	0xf42
+	.uleb128 0x2f
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x75
+	.sleb128 0
+	.byte	0
+	.byte	0
+	.uleb128 0x30
+	.long	.LASF58
+	.byte	0x1
+	.byte	0x21
+	.byte	0x14
+	.byte	0x3
+	.long	0xd22
+	.uleb128 0x17
+	.string	"va"
+	.byte	0x21
+	.byte	0x2d
+	.long	0x2e6
+	.uleb128 0x17
+	.string	"vb"
+	.byte	0x21
+	.byte	0x39
+	.long	0x2e6
+	.uleb128 0x17
+	.string	"vc"
+	.byte	0x21
+	.byte	0x45
+	.long	0x2e6
+	.uleb128 0x17
+	.string	"vd"
+	.byte	0x22
+	.byte	0x2d
+	.long	0x2e6
+	.uleb128 0x17
+	.string	"H"
+	.byte	0x22
+	.byte	0x39
+	.long	0xd22
+	.uleb128 0x17
+	.string	"mlo"
+	.byte	0x23
+	.byte	0x2d
+	.long	0x333
+	.uleb128 0x17
+	.string	"mhi"
+	.byte	0x23
+	.byte	0x3a
+	.long	0x333
+	.uleb128 0x7
+	.string	"b0"
+	.byte	0x25
+	.byte	0xd
+	.long	0x2e6
+	.uleb128 0x7
+	.string	"b1"
+	.byte	0x25
+	.byte	0x11
+	.long	0x2e6
+	.uleb128 0x7
+	.string	"b2"
+	.byte	0x25
+	.byte	0x15
+	.long	0x2e6
+	.uleb128 0x7
+	.string	"b3"
+	.byte	0x25
+	.byte	0x19
+	.long	0x2e6
+	.uleb128 0x11
+	.long	0xc3b
+	.uleb128 0x7
+	.string	"x1"
+	.byte	0x52
+	.byte	0x12
+	.long	0x333
+	.uleb128 0x7
+	.string	"x2"
+	.byte	0x52
+	.byte	0x16
+	.long	0x333
+	.byte	0
+	.uleb128 0x11
+	.long	0xc55
+	.uleb128 0x7
+	.string	"x1"
+	.byte	0x53
+	.byte	0x12
+	.long	0x333
+	.uleb128 0x7
+	.string	"x2"
+	.byte	0x53
+	.byte	0x16
+	.long	0x333
+	.byte	0
+	.uleb128 0x11
+	.long	0xc6f
+	.uleb128 0x7
+	.string	"x1"
+	.byte	0x54
+	.byte	0x12
+	.long	0x333
+	.uleb128 0x7
+	.string	"x2"
+	.byte	0x54
+	.byte	0x16
+	.long	0x333
+	.byte	0
+	.uleb128 0x11
+	.long	0xc89
+	.uleb128 0x7
+	.string	"x1"
+	.byte	0x55
+	.byte	0x12
+	.long	0x333
+	.uleb128 0x7
+	.string	"x2"
+	.byte	0x55
+	.byte	0x16
+	.long	0x333
+	.byte	0
+	.uleb128 0x11
+	.long	0xca3
+	.uleb128 0x7
+	.string	"x1"
+	.byte	0x56
+	.byte	0x12
+	.long	0x333
+	.uleb128 0x7
+	.string	"x2"
+	.byte	0x56
+	.byte	0x16
+	.long	0x333
+	.byte	0
+	.uleb128 0x11
+	.long	0xcbd
+	.uleb128 0x7
+	.string	"x1"
+	.byte	0x57
+	.byte	0x12
+	.long	0x333
+	.uleb128 0x7
+	.string	"x2"
+	.byte	0x57
+	.byte	0x16
+	.long	0x333
+	.byte	0
+	.uleb128 0x11
+	.long	0xcd7
+	.uleb128 0x7
+	.string	"x1"
+	.byte	0x58
+	.byte	0x12
+	.long	0x333
+	.uleb128 0x7
+	.string	"x2"
+	.byte	0x58
+	.byte	0x16
+	.long	0x333
+	.byte	0
+	.uleb128 0x11
+	.long	0xcf1
+	.uleb128 0x7
+	.string	"x1"
+	.byte	0x59
+	.byte	0x12
+	.long	0x333
+	.uleb128 0x7
+	.string	"x2"
+	.byte	0x59
+	.byte	0x16
+	.long	0x333
+	.byte	0
+	.uleb128 0x11
+	.long	0xd0b
+	.uleb128 0x7
+	.string	"x1"
+	.byte	0x5a
+	.byte	0x12
+	.long	0x333
+	.uleb128 0x7
+	.string	"x2"
+	.byte	0x5a
+	.byte	0x16
+	.long	0x333
+	.byte	0
+	.uleb128 0x31
+	.uleb128 0x7
+	.string	"x1"
+	.byte	0x5b
+	.byte	0x12
+	.long	0x333
+	.uleb128 0x7
+	.string	"x2"
+	.byte	0x5b
+	.byte	0x16
+	.long	0x333
+	.byte	0
+	.byte	0
+	.uleb128 0x18
+	.long	0x2e6
+	.uleb128 0xc
+	.long	.LASF40
+	.byte	0x2
+	.value	0x2d8f
+	.long	0x2e6
+	.long	0xd52
+	.uleb128 0x8
+	.string	"__A"
+	.byte	0x2
+	.value	0x2d8f
+	.byte	0x18
+	.long	0x2e6
+	.uleb128 0x8
+	.string	"__B"
+	.byte	0x2
+	.value	0x2d8f
+	.byte	0x27
+	.long	0x4f
+	.byte	0
+	.uleb128 0xc
+	.long	.LASF41
+	.byte	0x2
+	.value	0x1a12
+	.long	0x333
+	.long	0xd8a
+	.uleb128 0x8
+	.string	"__A"
+	.byte	0x2
+	.value	0x1a12
+	.byte	0x24
+	.long	0x333
+	.uleb128 0x8
+	.string	"__I"
+	.byte	0x2
+	.value	0x1a12
+	.byte	0x31
+	.long	0x333
+	.uleb128 0x8
+	.string	"__B"
+	.byte	0x2
+	.value	0x1a12
+	.byte	0x3e
+	.long	0x333
+	.byte	0
+	.uleb128 0xc
+	.long	.LASF42
+	.byte	0x5
+	.value	0x448
+	.long	0x2e6
+	.long	0xdb5
+	.uleb128 0x8
+	.string	"__X"
+	.byte	0x5
+	.value	0x448
+	.byte	0x23
+	.long	0x333
+	.uleb128 0x8
+	.string	"__M"
+	.byte	0x5
+	.value	0x448
+	.byte	0x32
+	.long	0x4f
+	.byte	0
+	.uleb128 0xc
+	.long	.LASF43
+	.byte	0x4
+	.value	0x5bb
+	.long	0x2e6
+	.long	0xdd3
+	.uleb128 0x8
+	.string	"__A"
+	.byte	0x4
+	.value	0x5bb
+	.byte	0x21
+	.long	0x333
+	.byte	0
+	.uleb128 0xc
+	.long	.LASF44
+	.byte	0x4
+	.value	0x39f
+	.long	0x333
+	.long	0xdf1
+	.uleb128 0x8
+	.string	"__P"
+	.byte	0x4
+	.value	0x39f
+	.byte	0x26
+	.long	0xdf1
+	.byte	0
+	.uleb128 0x18
+	.long	0x35d
+	.uleb128 0xc
+	.long	.LASF45
+	.byte	0x4
+	.value	0x393
+	.long	0x333
+	.long	0xe14
+	.uleb128 0x8
+	.string	"__P"
+	.byte	0x4
+	.value	0x393
+	.byte	0x23
+	.long	0x94e
+	.byte	0
+	.uleb128 0xc
+	.long	.LASF46
+	.byte	0x3
+	.value	0x5b0
+	.long	0x2e6
+	.long	0xe3e
+	.uleb128 0x8
+	.string	"__A"
+	.byte	0x3
+	.value	0x5b0
+	.byte	0x1c
+	.long	0x2e6
+	.uleb128 0x1c
+	.long	.LASF47
+	.value	0x5b0
+	.byte	0x2b
+	.long	0x4f
+	.byte	0
+	.uleb128 0xc
+	.long	.LASF48
+	.byte	0x3
+	.value	0x52f
+	.long	0x2e6
+	.long	0xe69
+	.uleb128 0x8
+	.string	"__A"
+	.byte	0x3
+	.value	0x52f
+	.byte	0x18
+	.long	0x2e6
+	.uleb128 0x8
+	.string	"__B"
+	.byte	0x3
+	.value	0x52f
+	.byte	0x25
+	.long	0x2e6
+	.byte	0
+	.uleb128 0xc
+	.long	.LASF49
+	.byte	0x3
+	.value	0x42e
+	.long	0x2e6
+	.long	0xe94
+	.uleb128 0x8
+	.string	"__A"
+	.byte	0x3
+	.value	0x42e
+	.byte	0x18
+	.long	0x2e6
+	.uleb128 0x8
+	.string	"__B"
+	.byte	0x3
+	.value	0x42e
+	.byte	0x25
+	.long	0x2e6
+	.byte	0
+	.uleb128 0xc
+	.long	.LASF50
+	.byte	0x3
+	.value	0x428
+	.long	0x2e6
+	.long	0xebf
+	.uleb128 0x8
+	.string	"__A"
+	.byte	0x3
+	.value	0x428
+	.byte	0x18
+	.long	0x2e6
+	.uleb128 0x8
+	.string	"__B"
+	.byte	0x3
+	.value	0x428
+	.byte	0x25
+	.long	0x2e6
+	.byte	0
+	.uleb128 0x32
+	.long	.LASF59
+	.byte	0x3
+	.value	0x31a
+	.byte	0x1
+	.long	0x2e6
+	.byte	0x3
+	.uleb128 0x33
+	.long	.LASF60
+	.byte	0x3
+	.value	0x2db
+	.byte	0x1
+	.byte	0x3
+	.long	0xef6
+	.uleb128 0x8
+	.string	"__P"
+	.byte	0x3
+	.value	0x2db
+	.byte	0x1b
+	.long	0xd22
+	.uleb128 0x8
+	.string	"__B"
+	.byte	0x3
+	.value	0x2db
+	.byte	0x28
+	.long	0x2e6
+	.byte	0
+	.uleb128 0xc
+	.long	.LASF51
+	.byte	0x3
+	.value	0x2b7
+	.long	0x2e6
+	.long	0xf14
+	.uleb128 0x8
+	.string	"__P"
+	.byte	0x3
+	.value	0x2b7
+	.byte	0x20
+	.long	0xf14
+	.byte	0
+	.uleb128 0x18
+	.long	0x2f2
+	.uleb128 0xc
+	.long	.LASF52
+	.byte	0x3
+	.value	0x24e
+	.long	0x2e6
+	.long	0xf42
+	.uleb128 0x1c
+	.long	.LASF53
+	.value	0x24e
+	.byte	0x1b
+	.long	0x14a
+	.uleb128 0x1c
+	.long	.LASF54
+	.value	0x24e
+	.byte	0x2b
+	.long	0x14a
+	.byte	0
+	.uleb128 0x34
+	.long	0xba5
+	.quad	.LFB6406
+	.quad	.LFE6406-.LFB6406
+	.uleb128 0x1
+	.byte	0x9c
+	.uleb128 0x1
+	.long	0xbb2
+	.long	.LLST0
+	.long	.LVUS0
+	.uleb128 0x1
+	.long	0xbbc
+	.long	.LLST1
+	.long	.LVUS1
+	.uleb128 0x1
+	.long	0xbd0
+	.long	.LLST2
+	.long	.LVUS2
+	.uleb128 0x35
+	.long	0xbda
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x1
+	.long	0xbe3
+	.long	.LLST3
+	.long	.LVUS3
+	.uleb128 0x1
+	.long	0xbee
+	.long	.LLST4
+	.long	.LVUS4
+	.uleb128 0x16
+	.long	0xbf9
+	.long	.LLST5
+	.long	.LVUS5
+	.uleb128 0x16
+	.long	0xc03
+	.long	.LLST6
+	.long	.LVUS6
+	.uleb128 0x16
+	.long	0xc0d
+	.long	.LLST7
+	.long	.LVUS7
+	.uleb128 0x16
+	.long	0xc17
+	.long	.LLST8
+	.long	.LVUS8
+	.uleb128 0x1
+	.long	0xbc6
+	.long	.LLST9
+	.long	.LVUS9
+	.uleb128 0x10
+	.long	0xc21
+	.long	.LLRL10
+	.long	0x1866
+	.uleb128 0x16
+	.long	0xc26
+	.long	.LLST11
+	.long	.LVUS11
+	.uleb128 0x16
+	.long	0xc30
+	.long	.LLST12
+	.long	.LVUS12
+	.uleb128 0x4
+	.long	0xd52
+	.quad	.LBI1732
+	.value	.LVU5
+	.long	.LLRL13
+	.byte	0x52
+	.byte	0x1f
+	.long	0x1042
+	.uleb128 0x1
+	.long	0xd7c
+	.long	.LLST14
+	.long	.LVUS14
+	.uleb128 0x2
+	.long	0xd6f
+	.uleb128 0x1
+	.long	0xd62
+	.long	.LLST15
+	.long	.LVUS15
+	.byte	0
+	.uleb128 0x4
+	.long	0xd52
+	.quad	.LBI1736
+	.value	.LVU16
+	.long	.LLRL16
+	.byte	0x52
+	.byte	0x84
+	.long	0x107b
+	.uleb128 0x1
+	.long	0xd7c
+	.long	.LLST17
+	.long	.LVUS17
+	.uleb128 0x2
+	.long	0xd6f
+	.uleb128 0x1
+	.long	0xd62
+	.long	.LLST18
+	.long	.LVUS18
+	.byte	0
+	.uleb128 0x3
+	.long	0xe94
+	.quad	.LBI1740
+	.value	.LVU44
+	.long	.LLRL19
+	.byte	0x52
+	.value	0x17e
+	.long	0x10a8
+	.uleb128 0x1
+	.long	0xeb1
+	.long	.LLST20
+	.long	.LVUS20
+	.uleb128 0x2
+	.long	0xea4
+	.byte	0
+	.uleb128 0x6
+	.long	0xdb5
+	.quad	.LBI1745
+	.value	.LVU21
+	.quad	.LBB1745
+	.quad	.LBE1745-.LBB1745
+	.byte	0x52
+	.byte	0xe9
+	.long	0x10db
+	.uleb128 0x1
+	.long	0xdc5
+	.long	.LLST21
+	.long	.LVUS21
+	.byte	0
+	.uleb128 0x3
+	.long	0xd8a
+	.quad	.LBI1747
+	.value	.LVU25
+	.long	.LLRL22
+	.byte	0x52
+	.value	0x10a
+	.long	0x1110
+	.uleb128 0x1
+	.long	0xda7
+	.long	.LLST23
+	.long	.LVUS23
+	.uleb128 0x1
+	.long	0xd9a
+	.long	.LLST24
+	.long	.LVUS24
+	.byte	0
+	.uleb128 0x3
+	.long	0xe94
+	.quad	.LBI1750
+	.value	.LVU47
+	.long	.LLRL25
+	.byte	0x52
+	.value	0x17e
+	.long	0x1135
+	.uleb128 0x2
+	.long	0xeb1
+	.uleb128 0x2
+	.long	0xea4
+	.byte	0
+	.uleb128 0x5
+	.long	0xdb5
+	.quad	.LBI1754
+	.value	.LVU31
+	.quad	.LBB1754
+	.quad	.LBE1754-.LBB1754
+	.byte	0x52
+	.value	0x130
+	.long	0x1169
+	.uleb128 0x1
+	.long	0xdc5
+	.long	.LLST26
+	.long	.LVUS26
+	.byte	0
+	.uleb128 0x3
+	.long	0xd8a
+	.quad	.LBI1756
+	.value	.LVU36
+	.long	.LLRL27
+	.byte	0x52
+	.value	0x151
+	.long	0x119e
+	.uleb128 0x1
+	.long	0xda7
+	.long	.LLST28
+	.long	.LVUS28
+	.uleb128 0x1
+	.long	0xd9a
+	.long	.LLST29
+	.long	.LVUS29
+	.byte	0
+	.uleb128 0x3
+	.long	0xe3e
+	.quad	.LBI1759
+	.value	.LVU51
+	.long	.LLRL30
+	.byte	0x52
+	.value	0x1af
+	.long	0x11d3
+	.uleb128 0x1
+	.long	0xe5b
+	.long	.LLST31
+	.long	.LVUS31
+	.uleb128 0x1
+	.long	0xe4e
+	.long	.LLST32
+	.long	.LVUS32
+	.byte	0
+	.uleb128 0x3
+	.long	0xd27
+	.quad	.LBI1766
+	.value	.LVU54
+	.long	.LLRL33
+	.byte	0x52
+	.value	0x1af
+	.long	0x1208
+	.uleb128 0x1
+	.long	0xd44
+	.long	.LLST34
+	.long	.LVUS34
+	.uleb128 0x1
+	.long	0xd37
+	.long	.LLST35
+	.long	.LVUS35
+	.byte	0
+	.uleb128 0x5
+	.long	0xe94
+	.quad	.LBI1770
+	.value	.LVU60
+	.quad	.LBB1770
+	.quad	.LBE1770-.LBB1770
+	.byte	0x52
+	.value	0x1e0
+	.long	0x1241
+	.uleb128 0x1
+	.long	0xeb1
+	.long	.LLST36
+	.long	.LVUS36
+	.uleb128 0x2
+	.long	0xea4
+	.byte	0
+	.uleb128 0x3
+	.long	0xe3e
+	.quad	.LBI1772
+	.value	.LVU65
+	.long	.LLRL37
+	.byte	0x52
+	.value	0x1fe
+	.long	0x1276
+	.uleb128 0x1
+	.long	0xe5b
+	.long	.LLST38
+	.long	.LVUS38
+	.uleb128 0x1
+	.long	0xe4e
+	.long	.LLST39
+	.long	.LVUS39
+	.byte	0
+	.uleb128 0x3
+	.long	0xd27
+	.quad	.LBI1775
+	.value	.LVU68
+	.long	.LLRL40
+	.byte	0x52
+	.value	0x1fe
+	.long	0x12ab
+	.uleb128 0x1
+	.long	0xd44
+	.long	.LLST41
+	.long	.LVUS41
+	.uleb128 0x1
+	.long	0xd37
+	.long	.LLST42
+	.long	.LVUS42
+	.byte	0
+	.uleb128 0x5
+	.long	0xe94
+	.quad	.LBI1780
+	.value	.LVU75
+	.quad	.LBB1780
+	.quad	.LBE1780-.LBB1780
+	.byte	0x52
+	.value	0x22f
+	.long	0x12ec
+	.uleb128 0x1
+	.long	0xeb1
+	.long	.LLST43
+	.long	.LVUS43
+	.uleb128 0x1
+	.long	0xea4
+	.long	.LLST44
+	.long	.LVUS44
+	.byte	0
+	.uleb128 0x5
+	.long	0xe94
+	.quad	.LBI1782
+	.value	.LVU78
+	.quad	.LBB1782
+	.quad	.LBE1782-.LBB1782
+	.byte	0x52
+	.value	0x22f
+	.long	0x1325
+	.uleb128 0x1
+	.long	0xeb1
+	.long	.LLST45
+	.long	.LVUS45
+	.uleb128 0x2
+	.long	0xea4
+	.byte	0
+	.uleb128 0x3
+	.long	0xe3e
+	.quad	.LBI1784
+	.value	.LVU84
+	.long	.LLRL46
+	.byte	0x52
+	.value	0x260
+	.long	0x135a
+	.uleb128 0x1
+	.long	0xe5b
+	.long	.LLST47
+	.long	.LVUS47
+	.uleb128 0x1
+	.long	0xe4e
+	.long	.LLST48
+	.long	.LVUS48
+	.byte	0
+	.uleb128 0x3
+	.long	0xd27
+	.quad	.LBI1787
+	.value	.LVU87
+	.long	.LLRL49
+	.byte	0x52
+	.value	0x260
+	.long	0x138f
+	.uleb128 0x1
+	.long	0xd44
+	.long	.LLST50
+	.long	.LVUS50
+	.uleb128 0x1
+	.long	0xd37
+	.long	.LLST51
+	.long	.LVUS51
+	.byte	0
+	.uleb128 0x5
+	.long	0xe94
+	.quad	.LBI1792
+	.value	.LVU94
+	.quad	.LBB1792
+	.quad	.LBE1792-.LBB1792
+	.byte	0x52
+	.value	0x290
+	.long	0x13d0
+	.uleb128 0x1
+	.long	0xeb1
+	.long	.LLST52
+	.long	.LVUS52
+	.uleb128 0x1
+	.long	0xea4
+	.long	.LLST53
+	.long	.LVUS53
+	.byte	0
+	.uleb128 0x3
+	.long	0xe3e
+	.quad	.LBI1794
+	.value	.LVU99
+	.long	.LLRL54
+	.byte	0x52
+	.value	0x2ae
+	.long	0x1405
+	.uleb128 0x1
+	.long	0xe5b
+	.long	.LLST55
+	.long	.LVUS55
+	.uleb128 0x1
+	.long	0xe4e
+	.long	.LLST56
+	.long	.LVUS56
+	.byte	0
+	.uleb128 0x3
+	.long	0xd27
+	.quad	.LBI1797
+	.value	.LVU102
+	.long	.LLRL57
+	.byte	0x52
+	.value	0x2ae
+	.long	0x143a
+	.uleb128 0x1
+	.long	0xd44
+	.long	.LLST58
+	.long	.LVUS58
+	.uleb128 0x1
+	.long	0xd37
+	.long	.LLST59
+	.long	.LVUS59
+	.byte	0
+	.uleb128 0x4
+	.long	0xe14
+	.quad	.LBI1800
+	.value	.LVU123
+	.long	.LLRL60
+	.byte	0x52
+	.byte	0xc
+	.long	0x1466
+	.uleb128 0x1
+	.long	0xe31
+	.long	.LLST61
+	.long	.LVUS61
+	.uleb128 0x2
+	.long	0xe24
+	.byte	0
+	.uleb128 0x4
+	.long	0xe14
+	.quad	.LBI1804
+	.value	.LVU119
+	.long	.LLRL62
+	.byte	0x52
+	.byte	0xc
+	.long	0x1492
+	.uleb128 0x1
+	.long	0xe31
+	.long	.LLST63
+	.long	.LVUS63
+	.uleb128 0x2
+	.long	0xe24
+	.byte	0
+	.uleb128 0x5
+	.long	0xe14
+	.quad	.LBI1808
+	.value	.LVU114
+	.quad	.LBB1808
+	.quad	.LBE1808-.LBB1808
+	.byte	0x52
+	.value	0x2e9
+	.long	0x14d3
+	.uleb128 0x1
+	.long	0xe31
+	.long	.LLST64
+	.long	.LVUS64
+	.uleb128 0x1
+	.long	0xe24
+	.long	.LLST65
+	.long	.LVUS65
+	.byte	0
+	.uleb128 0x6
+	.long	0xe94
+	.quad	.LBI1812
+	.value	.LVU128
+	.quad	.LBB1812
+	.quad	.LBE1812-.LBB1812
+	.byte	0x52
+	.byte	0x13
+	.long	0x1513
+	.uleb128 0x1
+	.long	0xeb1
+	.long	.LLST66
+	.long	.LVUS66
+	.uleb128 0x1
+	.long	0xea4
+	.long	.LLST67
+	.long	.LVUS67
+	.byte	0
+	.uleb128 0x6
+	.long	0xe94
+	.quad	.LBI1814
+	.value	.LVU131
+	.quad	.LBB1814
+	.quad	.LBE1814-.LBB1814
+	.byte	0x52
+	.byte	0x13
+	.long	0x1543
+	.uleb128 0x2
+	.long	0xeb1
+	.uleb128 0x2
+	.long	0xea4
+	.byte	0
+	.uleb128 0x4
+	.long	0xe3e
+	.quad	.LBI1816
+	.value	.LVU136
+	.long	.LLRL68
+	.byte	0x52
+	.byte	0x44
+	.long	0x1577
+	.uleb128 0x1
+	.long	0xe5b
+	.long	.LLST69
+	.long	.LVUS69
+	.uleb128 0x1
+	.long	0xe4e
+	.long	.LLST70
+	.long	.LVUS70
+	.byte	0
+	.uleb128 0x4
+	.long	0xd27
+	.quad	.LBI1819
+	.value	.LVU139
+	.long	.LLRL71
+	.byte	0x52
+	.byte	0x44
+	.long	0x15ab
+	.uleb128 0x1
+	.long	0xd44
+	.long	.LLST72
+	.long	.LVUS72
+	.uleb128 0x1
+	.long	0xd37
+	.long	.LLST73
+	.long	.LVUS73
+	.byte	0
+	.uleb128 0x6
+	.long	0xe94
+	.quad	.LBI1824
+	.value	.LVU148
+	.quad	.LBB1824
+	.quad	.LBE1824-.LBB1824
+	.byte	0x52
+	.byte	0x75
+	.long	0x15eb
+	.uleb128 0x1
+	.long	0xeb1
+	.long	.LLST74
+	.long	.LVUS74
+	.uleb128 0x1
+	.long	0xea4
+	.long	.LLST75
+	.long	.LVUS75
+	.byte	0
+	.uleb128 0x4
+	.long	0xe3e
+	.quad	.LBI1826
+	.value	.LVU153
+	.long	.LLRL76
+	.byte	0x52
+	.byte	0x93
+	.long	0x161f
+	.uleb128 0x1
+	.long	0xe5b
+	.long	.LLST77
+	.long	.LVUS77
+	.uleb128 0x1
+	.long	0xe4e
+	.long	.LLST78
+	.long	.LVUS78
+	.byte	0
+	.uleb128 0x4
+	.long	0xd27
+	.quad	.LBI1829
+	.value	.LVU156
+	.long	.LLRL79
+	.byte	0x52
+	.byte	0x93
+	.long	0x1653
+	.uleb128 0x1
+	.long	0xd44
+	.long	.LLST80
+	.long	.LVUS80
+	.uleb128 0x1
+	.long	0xd37
+	.long	.LLST81
+	.long	.LVUS81
+	.byte	0
+	.uleb128 0x6
+	.long	0xe94
+	.quad	.LBI1834
+	.value	.LVU163
+	.quad	.LBB1834
+	.quad	.LBE1834-.LBB1834
+	.byte	0x52
+	.byte	0xc4
+	.long	0x1693
+	.uleb128 0x1
+	.long	0xeb1
+	.long	.LLST82
+	.long	.LVUS82
+	.uleb128 0x1
+	.long	0xea4
+	.long	.LLST83
+	.long	.LVUS83
+	.byte	0
+	.uleb128 0x6
+	.long	0xe94
+	.quad	.LBI1836
+	.value	.LVU166
+	.quad	.LBB1836
+	.quad	.LBE1836-.LBB1836
+	.byte	0x52
+	.byte	0xc4
+	.long	0x16cb
+	.uleb128 0x1
+	.long	0xeb1
+	.long	.LLST84
+	.long	.LVUS84
+	.uleb128 0x2
+	.long	0xea4
+	.byte	0
+	.uleb128 0x4
+	.long	0xe3e
+	.quad	.LBI1838
+	.value	.LVU172
+	.long	.LLRL85
+	.byte	0x52
+	.byte	0xf5
+	.long	0x16ff
+	.uleb128 0x1
+	.long	0xe5b
+	.long	.LLST86
+	.long	.LVUS86
+	.uleb128 0x1
+	.long	0xe4e
+	.long	.LLST87
+	.long	.LVUS87
+	.byte	0
+	.uleb128 0x4
+	.long	0xd27
+	.quad	.LBI1841
+	.value	.LVU175
+	.long	.LLRL88
+	.byte	0x52
+	.byte	0xf5
+	.long	0x1733
+	.uleb128 0x1
+	.long	0xd44
+	.long	.LLST89
+	.long	.LVUS89
+	.uleb128 0x1
+	.long	0xd37
+	.long	.LLST90
+	.long	.LVUS90
+	.byte	0
+	.uleb128 0x3
+	.long	0xe94
+	.quad	.LBI1846
+	.value	.LVU183
+	.long	.LLRL91
+	.byte	0x52
+	.value	0x125
+	.long	0x1768
+	.uleb128 0x1
+	.long	0xeb1
+	.long	.LLST92
+	.long	.LVUS92
+	.uleb128 0x1
+	.long	0xea4
+	.long	.LLST93
+	.long	.LVUS93
+	.byte	0
+	.uleb128 0x3
+	.long	0xe3e
+	.quad	.LBI1850
+	.value	.LVU191
+	.long	.LLRL94
+	.byte	0x52
+	.value	0x143
+	.long	0x179d
+	.uleb128 0x1
+	.long	0xe5b
+	.long	.LLST95
+	.long	.LVUS95
+	.uleb128 0x1
+	.long	0xe4e
+	.long	.LLST96
+	.long	.LVUS96
+	.byte	0
+	.uleb128 0x3
+	.long	0xd27
+	.quad	.LBI1853
+	.value	.LVU194
+	.long	.LLRL97
+	.byte	0x52
+	.value	0x143
+	.long	0x17d2
+	.uleb128 0x1
+	.long	0xd44
+	.long	.LLST98
+	.long	.LVUS98
+	.uleb128 0x1
+	.long	0xd37
+	.long	.LLST99
+	.long	.LVUS99
+	.byte	0
+	.uleb128 0x4
+	.long	0xe14
+	.quad	.LBI1856
+	.value	.LVU215
+	.long	.LLRL100
+	.byte	0x52
+	.byte	0xc
+	.long	0x17fe
+	.uleb128 0x1
+	.long	0xe31
+	.long	.LLST101
+	.long	.LVUS101
+	.uleb128 0x2
+	.long	0xe24
+	.byte	0
+	.uleb128 0x4
+	.long	0xe14
+	.quad	.LBI1860
+	.value	.LVU211
+	.long	.LLRL102
+	.byte	0x52
+	.byte	0xc
+	.long	0x182a
+	.uleb128 0x1
+	.long	0xe31
+	.long	.LLST103
+	.long	.LVUS103
+	.uleb128 0x2
+	.long	0xe24
+	.byte	0
+	.uleb128 0x12
+	.long	0xe14
+	.quad	.LBI1864
+	.value	.LVU206
+	.quad	.LBB1864
+	.quad	.LBE1864-.LBB1864
+	.byte	0x52
+	.uleb128 0x1
+	.long	0xe31
+	.long	.LLST104
+	.long	.LVUS104
+	.uleb128 0x1
+	.long	0xe24
+	.long	.LLST105
+	.long	.LVUS105
+	.byte	0
+	.byte	0
+	.uleb128 0x10
+	.long	0xc3b
+	.long	.LLRL106
+	.long	0x20be
+	.uleb128 0x9
+	.long	0xc40
+	.uleb128 0x9
+	.long	0xc4a
+	.uleb128 0x4
+	.long	0xd52
+	.quad	.LBI1870
+	.value	.LVU226
+	.long	.LLRL107
+	.byte	0x53
+	.byte	0x84
+	.long	0x18b6
+	.uleb128 0x1
+	.long	0xd7c
+	.long	.LLST108
+	.long	.LVUS108
+	.uleb128 0x2
+	.long	0xd6f
+	.uleb128 0x1
+	.long	0xd62
+	.long	.LLST109
+	.long	.LVUS109
+	.byte	0
+	.uleb128 0x3
+	.long	0xdb5
+	.quad	.LBI1875
+	.value	.LVU238
+	.long	.LLRL110
+	.byte	0x53
+	.value	0x130
+	.long	0x18d6
+	.uleb128 0x2
+	.long	0xdc5
+	.byte	0
+	.uleb128 0x3
+	.long	0xd8a
+	.quad	.LBI1878
+	.value	.LVU242
+	.long	.LLRL111
+	.byte	0x53
+	.value	0x151
+	.long	0x1903
+	.uleb128 0x1
+	.long	0xda7
+	.long	.LLST112
+	.long	.LVUS112
+	.uleb128 0x2
+	.long	0xd9a
+	.byte	0
+	.uleb128 0x4
+	.long	0xd52
+	.quad	.LBI1881
+	.value	.LVU222
+	.long	.LLRL113
+	.byte	0x53
+	.byte	0x1f
+	.long	0x193c
+	.uleb128 0x1
+	.long	0xd7c
+	.long	.LLST114
+	.long	.LVUS114
+	.uleb128 0x2
+	.long	0xd6f
+	.uleb128 0x1
+	.long	0xd62
+	.long	.LLST115
+	.long	.LVUS115
+	.byte	0
+	.uleb128 0x4
+	.long	0xdb5
+	.quad	.LBI1886
+	.value	.LVU230
+	.long	.LLRL116
+	.byte	0x53
+	.byte	0xe9
+	.long	0x195b
+	.uleb128 0x2
+	.long	0xdc5
+	.byte	0
+	.uleb128 0x3
+	.long	0xd8a
+	.quad	.LBI1889
+	.value	.LVU234
+	.long	.LLRL117
+	.byte	0x53
+	.value	0x10a
+	.long	0x1988
+	.uleb128 0x1
+	.long	0xda7
+	.long	.LLST118
+	.long	.LVUS118
+	.uleb128 0x2
+	.long	0xd9a
+	.byte	0
+	.uleb128 0x5
+	.long	0xe94
+	.quad	.LBI1898
+	.value	.LVU247
+	.quad	.LBB1898
+	.quad	.LBE1898-.LBB1898
+	.byte	0x53
+	.value	0x17e
+	.long	0x19c9
+	.uleb128 0x1
+	.long	0xeb1
+	.long	.LLST119
+	.long	.LVUS119
+	.uleb128 0x1
+	.long	0xea4
+	.long	.LLST120
+	.long	.LVUS120
+	.byte	0
+	.uleb128 0x5
+	.long	0xe94
+	.quad	.LBI1900
+	.value	.LVU250
+	.quad	.LBB1900
+	.quad	.LBE1900-.LBB1900
+	.byte	0x53
+	.value	0x17e
+	.long	0x19fa
+	.uleb128 0x2
+	.long	0xeb1
+	.uleb128 0x2
+	.long	0xea4
+	.byte	0
+	.uleb128 0x3
+	.long	0xe3e
+	.quad	.LBI1902
+	.value	.LVU255
+	.long	.LLRL121
+	.byte	0x53
+	.value	0x1af
+	.long	0x1a2f
+	.uleb128 0x1
+	.long	0xe5b
+	.long	.LLST122
+	.long	.LVUS122
+	.uleb128 0x1
+	.long	0xe4e
+	.long	.LLST123
+	.long	.LVUS123
+	.byte	0
+	.uleb128 0x3
+	.long	0xd27
+	.quad	.LBI1905
+	.value	.LVU258
+	.long	.LLRL124
+	.byte	0x53
+	.value	0x1af
+	.long	0x1a64
+	.uleb128 0x1
+	.long	0xd44
+	.long	.LLST125
+	.long	.LVUS125
+	.uleb128 0x1
+	.long	0xd37
+	.long	.LLST126
+	.long	.LVUS126
+	.byte	0
+	.uleb128 0x3
+	.long	0xe94
+	.quad	.LBI1910
+	.value	.LVU266
+	.long	.LLRL127
+	.byte	0x53
+	.value	0x1e0
+	.long	0x1a99
+	.uleb128 0x1
+	.long	0xeb1
+	.long	.LLST128
+	.long	.LVUS128
+	.uleb128 0x1
+	.long	0xea4
+	.long	.LLST129
+	.long	.LVUS129
+	.byte	0
+	.uleb128 0x3
+	.long	0xe3e
+	.quad	.LBI1914
+	.value	.LVU272
+	.long	.LLRL130
+	.byte	0x53
+	.value	0x1fe
+	.long	0x1ace
+	.uleb128 0x1
+	.long	0xe5b
+	.long	.LLST131
+	.long	.LVUS131
+	.uleb128 0x1
+	.long	0xe4e
+	.long	.LLST132
+	.long	.LVUS132
+	.byte	0
+	.uleb128 0x3
+	.long	0xd27
+	.quad	.LBI1917
+	.value	.LVU275
+	.long	.LLRL133
+	.byte	0x53
+	.value	0x1fe
+	.long	0x1b03
+	.uleb128 0x1
+	.long	0xd44
+	.long	.LLST134
+	.long	.LVUS134
+	.uleb128 0x1
+	.long	0xd37
+	.long	.LLST135
+	.long	.LVUS135
+	.byte	0
+	.uleb128 0x5
+	.long	0xe94
+	.quad	.LBI1922
+	.value	.LVU282
+	.quad	.LBB1922
+	.quad	.LBE1922-.LBB1922
+	.byte	0x53
+	.value	0x22f
+	.long	0x1b44
+	.uleb128 0x1
+	.long	0xeb1
+	.long	.LLST136
+	.long	.LVUS136
+	.uleb128 0x1
+	.long	0xea4
+	.long	.LLST137
+	.long	.LVUS137
+	.byte	0
+	.uleb128 0x5
+	.long	0xe94
+	.quad	.LBI1924
+	.value	.LVU285
+	.quad	.LBB1924
+	.quad	.LBE1924-.LBB1924
+	.byte	0x53
+	.value	0x22f
+	.long	0x1b7d
+	.uleb128 0x1
+	.long	0xeb1
+	.long	.LLST138
+	.long	.LVUS138
+	.uleb128 0x2
+	.long	0xea4
+	.byte	0
+	.uleb128 0x3
+	.long	0xe3e
+	.quad	.LBI1926
+	.value	.LVU291
+	.long	.LLRL139
+	.byte	0x53
+	.value	0x260
+	.long	0x1bb2
+	.uleb128 0x1
+	.long	0xe5b
+	.long	.LLST140
+	.long	.LVUS140
+	.uleb128 0x1
+	.long	0xe4e
+	.long	.LLST141
+	.long	.LVUS141
+	.byte	0
+	.uleb128 0x3
+	.long	0xd27
+	.quad	.LBI1929
+	.value	.LVU294
+	.long	.LLRL142
+	.byte	0x53
+	.value	0x260
+	.long	0x1be7
+	.uleb128 0x1
+	.long	0xd44
+	.long	.LLST143
+	.long	.LVUS143
+	.uleb128 0x1
+	.long	0xd37
+	.long	.LLST144
+	.long	.LVUS144
+	.byte	0
+	.uleb128 0x5
+	.long	0xe94
+	.quad	.LBI1934
+	.value	.LVU301
+	.quad	.LBB1934
+	.quad	.LBE1934-.LBB1934
+	.byte	0x53
+	.value	0x290
+	.long	0x1c28
+	.uleb128 0x1
+	.long	0xeb1
+	.long	.LLST145
+	.long	.LVUS145
+	.uleb128 0x1
+	.long	0xea4
+	.long	.LLST146
+	.long	.LVUS146
+	.byte	0
+	.uleb128 0x3
+	.long	0xe3e
+	.quad	.LBI1936
+	.value	.LVU306
+	.long	.LLRL147
+	.byte	0x53
+	.value	0x2ae
+	.long	0x1c5d
+	.uleb128 0x1
+	.long	0xe5b
+	.long	.LLST148
+	.long	.LVUS148
+	.uleb128 0x1
+	.long	0xe4e
+	.long	.LLST149
+	.long	.LVUS149
+	.byte	0
+	.uleb128 0x3
+	.long	0xd27
+	.quad	.LBI1939
+	.value	.LVU309
+	.long	.LLRL150
+	.byte	0x53
+	.value	0x2ae
+	.long	0x1c92
+	.uleb128 0x1
+	.long	0xd44
+	.long	.LLST151
+	.long	.LVUS151
+	.uleb128 0x1
+	.long	0xd37
+	.long	.LLST152
+	.long	.LVUS152
+	.byte	0
+	.uleb128 0x4
+	.long	0xe14
+	.quad	.LBI1942
+	.value	.LVU330
+	.long	.LLRL153
+	.byte	0x53
+	.byte	0xc
+	.long	0x1cbe
+	.uleb128 0x1
+	.long	0xe31
+	.long	.LLST154
+	.long	.LVUS154
+	.uleb128 0x2
+	.long	0xe24
+	.byte	0
+	.uleb128 0x4
+	.long	0xe14
+	.quad	.LBI1946
+	.value	.LVU326
+	.long	.LLRL155
+	.byte	0x53
+	.byte	0xc
+	.long	0x1cea
+	.uleb128 0x1
+	.long	0xe31
+	.long	.LLST156
+	.long	.LVUS156
+	.uleb128 0x2
+	.long	0xe24
+	.byte	0
+	.uleb128 0x5
+	.long	0xe14
+	.quad	.LBI1950
+	.value	.LVU321
+	.quad	.LBB1950
+	.quad	.LBE1950-.LBB1950
+	.byte	0x53
+	.value	0x2e9
+	.long	0x1d2b
+	.uleb128 0x1
+	.long	0xe31
+	.long	.LLST157
+	.long	.LVUS157
+	.uleb128 0x1
+	.long	0xe24
+	.long	.LLST158
+	.long	.LVUS158
+	.byte	0
+	.uleb128 0x6
+	.long	0xe94
+	.quad	.LBI1954
+	.value	.LVU335
+	.quad	.LBB1954
+	.quad	.LBE1954-.LBB1954
+	.byte	0x53
+	.byte	0x13
+	.long	0x1d6b
+	.uleb128 0x1
+	.long	0xeb1
+	.long	.LLST159
+	.long	.LVUS159
+	.uleb128 0x1
+	.long	0xea4
+	.long	.LLST160
+	.long	.LVUS160
+	.byte	0
+	.uleb128 0x6
+	.long	0xe94
+	.quad	.LBI1956
+	.value	.LVU338
+	.quad	.LBB1956
+	.quad	.LBE1956-.LBB1956
+	.byte	0x53
+	.byte	0x13
+	.long	0x1d9b
+	.uleb128 0x2
+	.long	0xeb1
+	.uleb128 0x2
+	.long	0xea4
+	.byte	0
+	.uleb128 0x4
+	.long	0xe3e
+	.quad	.LBI1958
+	.value	.LVU343
+	.long	.LLRL161
+	.byte	0x53
+	.byte	0x44
+	.long	0x1dcf
+	.uleb128 0x1
+	.long	0xe5b
+	.long	.LLST162
+	.long	.LVUS162
+	.uleb128 0x1
+	.long	0xe4e
+	.long	.LLST163
+	.long	.LVUS163
+	.byte	0
+	.uleb128 0x4
+	.long	0xd27
+	.quad	.LBI1961
+	.value	.LVU346
+	.long	.LLRL164
+	.byte	0x53
+	.byte	0x44
+	.long	0x1e03
+	.uleb128 0x1
+	.long	0xd44
+	.long	.LLST165
+	.long	.LVUS165
+	.uleb128 0x1
+	.long	0xd37
+	.long	.LLST166
+	.long	.LVUS166
+	.byte	0
+	.uleb128 0x6
+	.long	0xe94
+	.quad	.LBI1966
+	.value	.LVU355
+	.quad	.LBB1966
+	.quad	.LBE1966-.LBB1966
+	.byte	0x53
+	.byte	0x75
+	.long	0x1e43
+	.uleb128 0x1
+	.long	0xeb1
+	.long	.LLST167
+	.long	.LVUS167
+	.uleb128 0x1
+	.long	0xea4
+	.long	.LLST168
+	.long	.LVUS168
+	.byte	0
+	.uleb128 0x4
+	.long	0xe3e
+	.quad	.LBI1968
+	.value	.LVU360
+	.long	.LLRL169
+	.byte	0x53
+	.byte	0x93
+	.long	0x1e77
+	.uleb128 0x1
+	.long	0xe5b
+	.long	.LLST170
+	.long	.LVUS170
+	.uleb128 0x1
+	.long	0xe4e
+	.long	.LLST171
+	.long	.LVUS171
+	.byte	0
+	.uleb128 0x4
+	.long	0xd27
+	.quad	.LBI1971
+	.value	.LVU363
+	.long	.LLRL172
+	.byte	0x53
+	.byte	0x93
+	.long	0x1eab
+	.uleb128 0x1
+	.long	0xd44
+	.long	.LLST173
+	.long	.LVUS173
+	.uleb128 0x1
+	.long	0xd37
+	.long	.LLST174
+	.long	.LVUS174
+	.byte	0
+	.uleb128 0x6
+	.long	0xe94
+	.quad	.LBI1976
+	.value	.LVU370
+	.quad	.LBB1976
+	.quad	.LBE1976-.LBB1976
+	.byte	0x53
+	.byte	0xc4
+	.long	0x1eeb
+	.uleb128 0x1
+	.long	0xeb1
+	.long	.LLST175
+	.long	.LVUS175
+	.uleb128 0x1
+	.long	0xea4
+	.long	.LLST176
+	.long	.LVUS176
+	.byte	0
+	.uleb128 0x6
+	.long	0xe94
+	.quad	.LBI1978
+	.value	.LVU373
+	.quad	.LBB1978
+	.quad	.LBE1978-.LBB1978
+	.byte	0x53
+	.byte	0xc4
+	.long	0x1f23
+	.uleb128 0x1
+	.long	0xeb1
+	.long	.LLST177
+	.long	.LVUS177
+	.uleb128 0x2
+	.long	0xea4
+	.byte	0
+	.uleb128 0x4
+	.long	0xe3e
+	.quad	.LBI1980
+	.value	.LVU379
+	.long	.LLRL178
+	.byte	0x53
+	.byte	0xf5
+	.long	0x1f57
+	.uleb128 0x1
+	.long	0xe5b
+	.long	.LLST179
+	.long	.LVUS179
+	.uleb128 0x1
+	.long	0xe4e
+	.long	.LLST180
+	.long	.LVUS180
+	.byte	0
+	.uleb128 0x4
+	.long	0xd27
+	.quad	.LBI1983
+	.value	.LVU382
+	.long	.LLRL181
+	.byte	0x53
+	.byte	0xf5
+	.long	0x1f8b
+	.uleb128 0x1
+	.long	0xd44
+	.long	.LLST182
+	.long	.LVUS182
+	.uleb128 0x1
+	.long	0xd37
+	.long	.LLST183
+	.long	.LVUS183
+	.byte	0
+	.uleb128 0x3
+	.long	0xe94
+	.quad	.LBI1988
+	.value	.LVU390
+	.long	.LLRL184
+	.byte	0x53
+	.value	0x125
+	.long	0x1fc0
+	.uleb128 0x1
+	.long	0xeb1
+	.long	.LLST185
+	.long	.LVUS185
+	.uleb128 0x1
+	.long	0xea4
+	.long	.LLST186
+	.long	.LVUS186
+	.byte	0
+	.uleb128 0x3
+	.long	0xe3e
+	.quad	.LBI1992
+	.value	.LVU398
+	.long	.LLRL187
+	.byte	0x53
+	.value	0x143
+	.long	0x1ff5
+	.uleb128 0x1
+	.long	0xe5b
+	.long	.LLST188
+	.long	.LVUS188
+	.uleb128 0x1
+	.long	0xe4e
+	.long	.LLST189
+	.long	.LVUS189
+	.byte	0
+	.uleb128 0x3
+	.long	0xd27
+	.quad	.LBI1995
+	.value	.LVU401
+	.long	.LLRL190
+	.byte	0x53
+	.value	0x143
+	.long	0x202a
+	.uleb128 0x1
+	.long	0xd44
+	.long	.LLST191
+	.long	.LVUS191
+	.uleb128 0x1
+	.long	0xd37
+	.long	.LLST192
+	.long	.LVUS192
+	.byte	0
+	.uleb128 0x4
+	.long	0xe14
+	.quad	.LBI1998
+	.value	.LVU422
+	.long	.LLRL193
+	.byte	0x53
+	.byte	0xc
+	.long	0x2056
+	.uleb128 0x1
+	.long	0xe31
+	.long	.LLST194
+	.long	.LVUS194
+	.uleb128 0x2
+	.long	0xe24
+	.byte	0
+	.uleb128 0x4
+	.long	0xe14
+	.quad	.LBI2002
+	.value	.LVU418
+	.long	.LLRL195
+	.byte	0x53
+	.byte	0xc
+	.long	0x2082
+	.uleb128 0x1
+	.long	0xe31
+	.long	.LLST196
+	.long	.LVUS196
+	.uleb128 0x2
+	.long	0xe24
+	.byte	0
+	.uleb128 0x12
+	.long	0xe14
+	.quad	.LBI2006
+	.value	.LVU413
+	.quad	.LBB2006
+	.quad	.LBE2006-.LBB2006
+	.byte	0x53
+	.uleb128 0x1
+	.long	0xe31
+	.long	.LLST197
+	.long	.LVUS197
+	.uleb128 0x1
+	.long	0xe24
+	.long	.LLST198
+	.long	.LVUS198
+	.byte	0
+	.byte	0
+	.uleb128 0x10
+	.long	0xc55
+	.long	.LLRL199
+	.long	0x2916
+	.uleb128 0x9
+	.long	0xc5a
+	.uleb128 0x9
+	.long	0xc64
+	.uleb128 0x4
+	.long	0xd52
+	.quad	.LBI2021
+	.value	.LVU433
+	.long	.LLRL200
+	.byte	0x54
+	.byte	0x84
+	.long	0x210e
+	.uleb128 0x1
+	.long	0xd7c
+	.long	.LLST201
+	.long	.LVUS201
+	.uleb128 0x2
+	.long	0xd6f
+	.uleb128 0x1
+	.long	0xd62
+	.long	.LLST202
+	.long	.LVUS202
+	.byte	0
+	.uleb128 0x3
+	.long	0xdb5
+	.quad	.LBI2026
+	.value	.LVU445
+	.long	.LLRL203
+	.byte	0x54
+	.value	0x130
+	.long	0x212e
+	.uleb128 0x2
+	.long	0xdc5
+	.byte	0
+	.uleb128 0x3
+	.long	0xd8a
+	.quad	.LBI2029
+	.value	.LVU449
+	.long	.LLRL204
+	.byte	0x54
+	.value	0x151
+	.long	0x215b
+	.uleb128 0x1
+	.long	0xda7
+	.long	.LLST205
+	.long	.LVUS205
+	.uleb128 0x2
+	.long	0xd9a
+	.byte	0
+	.uleb128 0x4
+	.long	0xd52
+	.quad	.LBI2032
+	.value	.LVU429
+	.long	.LLRL206
+	.byte	0x54
+	.byte	0x1f
+	.long	0x2194
+	.uleb128 0x1
+	.long	0xd7c
+	.long	.LLST207
+	.long	.LVUS207
+	.uleb128 0x2
+	.long	0xd6f
+	.uleb128 0x1
+	.long	0xd62
+	.long	.LLST208
+	.long	.LVUS208
+	.byte	0
+	.uleb128 0x4
+	.long	0xdb5
+	.quad	.LBI2037
+	.value	.LVU437
+	.long	.LLRL209
+	.byte	0x54
+	.byte	0xe9
+	.long	0x21b3
+	.uleb128 0x2
+	.long	0xdc5
+	.byte	0
+	.uleb128 0x3
+	.long	0xd8a
+	.quad	.LBI2040
+	.value	.LVU441
+	.long	.LLRL210
+	.byte	0x54
+	.value	0x10a
+	.long	0x21e0
+	.uleb128 0x1
+	.long	0xda7
+	.long	.LLST211
+	.long	.LVUS211
+	.uleb128 0x2
+	.long	0xd9a
+	.byte	0
+	.uleb128 0x5
+	.long	0xe94
+	.quad	.LBI2049
+	.value	.LVU454
+	.quad	.LBB2049
+	.quad	.LBE2049-.LBB2049
+	.byte	0x54
+	.value	0x17e
+	.long	0x2221
+	.uleb128 0x1
+	.long	0xeb1
+	.long	.LLST212
+	.long	.LVUS212
+	.uleb128 0x1
+	.long	0xea4
+	.long	.LLST213
+	.long	.LVUS213
+	.byte	0
+	.uleb128 0x5
+	.long	0xe94
+	.quad	.LBI2051
+	.value	.LVU457
+	.quad	.LBB2051
+	.quad	.LBE2051-.LBB2051
+	.byte	0x54
+	.value	0x17e
+	.long	0x2252
+	.uleb128 0x2
+	.long	0xeb1
+	.uleb128 0x2
+	.long	0xea4
+	.byte	0
+	.uleb128 0x3
+	.long	0xe3e
+	.quad	.LBI2053
+	.value	.LVU462
+	.long	.LLRL214
+	.byte	0x54
+	.value	0x1af
+	.long	0x2287
+	.uleb128 0x1
+	.long	0xe5b
+	.long	.LLST215
+	.long	.LVUS215
+	.uleb128 0x1
+	.long	0xe4e
+	.long	.LLST216
+	.long	.LVUS216
+	.byte	0
+	.uleb128 0x3
+	.long	0xd27
+	.quad	.LBI2056
+	.value	.LVU465
+	.long	.LLRL217
+	.byte	0x54
+	.value	0x1af
+	.long	0x22bc
+	.uleb128 0x1
+	.long	0xd44
+	.long	.LLST218
+	.long	.LVUS218
+	.uleb128 0x1
+	.long	0xd37
+	.long	.LLST219
+	.long	.LVUS219
+	.byte	0
+	.uleb128 0x3
+	.long	0xe94
+	.quad	.LBI2061
+	.value	.LVU473
+	.long	.LLRL220
+	.byte	0x54
+	.value	0x1e0
+	.long	0x22f1
+	.uleb128 0x1
+	.long	0xeb1
+	.long	.LLST221
+	.long	.LVUS221
+	.uleb128 0x1
+	.long	0xea4
+	.long	.LLST222
+	.long	.LVUS222
+	.byte	0
+	.uleb128 0x3
+	.long	0xe3e
+	.quad	.LBI2065
+	.value	.LVU479
+	.long	.LLRL223
+	.byte	0x54
+	.value	0x1fe
+	.long	0x2326
+	.uleb128 0x1
+	.long	0xe5b
+	.long	.LLST224
+	.long	.LVUS224
+	.uleb128 0x1
+	.long	0xe4e
+	.long	.LLST225
+	.long	.LVUS225
+	.byte	0
+	.uleb128 0x3
+	.long	0xd27
+	.quad	.LBI2068
+	.value	.LVU482
+	.long	.LLRL226
+	.byte	0x54
+	.value	0x1fe
+	.long	0x235b
+	.uleb128 0x1
+	.long	0xd44
+	.long	.LLST227
+	.long	.LVUS227
+	.uleb128 0x1
+	.long	0xd37
+	.long	.LLST228
+	.long	.LVUS228
+	.byte	0
+	.uleb128 0x5
+	.long	0xe94
+	.quad	.LBI2073
+	.value	.LVU489
+	.quad	.LBB2073
+	.quad	.LBE2073-.LBB2073
+	.byte	0x54
+	.value	0x22f
+	.long	0x239c
+	.uleb128 0x1
+	.long	0xeb1
+	.long	.LLST229
+	.long	.LVUS229
+	.uleb128 0x1
+	.long	0xea4
+	.long	.LLST230
+	.long	.LVUS230
+	.byte	0
+	.uleb128 0x5
+	.long	0xe94
+	.quad	.LBI2075
+	.value	.LVU492
+	.quad	.LBB2075
+	.quad	.LBE2075-.LBB2075
+	.byte	0x54
+	.value	0x22f
+	.long	0x23d5
+	.uleb128 0x1
+	.long	0xeb1
+	.long	.LLST231
+	.long	.LVUS231
+	.uleb128 0x2
+	.long	0xea4
+	.byte	0
+	.uleb128 0x3
+	.long	0xe3e
+	.quad	.LBI2077
+	.value	.LVU498
+	.long	.LLRL232
+	.byte	0x54
+	.value	0x260
+	.long	0x240a
+	.uleb128 0x1
+	.long	0xe5b
+	.long	.LLST233
+	.long	.LVUS233
+	.uleb128 0x1
+	.long	0xe4e
+	.long	.LLST234
+	.long	.LVUS234
+	.byte	0
+	.uleb128 0x3
+	.long	0xd27
+	.quad	.LBI2080
+	.value	.LVU501
+	.long	.LLRL235
+	.byte	0x54
+	.value	0x260
+	.long	0x243f
+	.uleb128 0x1
+	.long	0xd44
+	.long	.LLST236
+	.long	.LVUS236
+	.uleb128 0x1
+	.long	0xd37
+	.long	.LLST237
+	.long	.LVUS237
+	.byte	0
+	.uleb128 0x5
+	.long	0xe94
+	.quad	.LBI2085
+	.value	.LVU508
+	.quad	.LBB2085
+	.quad	.LBE2085-.LBB2085
+	.byte	0x54
+	.value	0x290
+	.long	0x2480
+	.uleb128 0x1
+	.long	0xeb1
+	.long	.LLST238
+	.long	.LVUS238
+	.uleb128 0x1
+	.long	0xea4
+	.long	.LLST239
+	.long	.LVUS239
+	.byte	0
+	.uleb128 0x3
+	.long	0xe3e
+	.quad	.LBI2087
+	.value	.LVU513
+	.long	.LLRL240
+	.byte	0x54
+	.value	0x2ae
+	.long	0x24b5
+	.uleb128 0x1
+	.long	0xe5b
+	.long	.LLST241
+	.long	.LVUS241
+	.uleb128 0x1
+	.long	0xe4e
+	.long	.LLST242
+	.long	.LVUS242
+	.byte	0
+	.uleb128 0x3
+	.long	0xd27
+	.quad	.LBI2090
+	.value	.LVU516
+	.long	.LLRL243
+	.byte	0x54
+	.value	0x2ae
+	.long	0x24ea
+	.uleb128 0x1
+	.long	0xd44
+	.long	.LLST244
+	.long	.LVUS244
+	.uleb128 0x1
+	.long	0xd37
+	.long	.LLST245
+	.long	.LVUS245
+	.byte	0
+	.uleb128 0x4
+	.long	0xe14
+	.quad	.LBI2093
+	.value	.LVU537
+	.long	.LLRL246
+	.byte	0x54
+	.byte	0xc
+	.long	0x2516
+	.uleb128 0x1
+	.long	0xe31
+	.long	.LLST247
+	.long	.LVUS247
+	.uleb128 0x2
+	.long	0xe24
+	.byte	0
+	.uleb128 0x4
+	.long	0xe14
+	.quad	.LBI2097
+	.value	.LVU533
+	.long	.LLRL248
+	.byte	0x54
+	.byte	0xc
+	.long	0x2542
+	.uleb128 0x1
+	.long	0xe31
+	.long	.LLST249
+	.long	.LVUS249
+	.uleb128 0x2
+	.long	0xe24
+	.byte	0
+	.uleb128 0x5
+	.long	0xe14
+	.quad	.LBI2101
+	.value	.LVU528
+	.quad	.LBB2101
+	.quad	.LBE2101-.LBB2101
+	.byte	0x54
+	.value	0x2e9
+	.long	0x2583
+	.uleb128 0x1
+	.long	0xe31
+	.long	.LLST250
+	.long	.LVUS250
+	.uleb128 0x1
+	.long	0xe24
+	.long	.LLST251
+	.long	.LVUS251
+	.byte	0
+	.uleb128 0x6
+	.long	0xe94
+	.quad	.LBI2105
+	.value	.LVU542
+	.quad	.LBB2105
+	.quad	.LBE2105-.LBB2105
+	.byte	0x54
+	.byte	0x13
+	.long	0x25c3
+	.uleb128 0x1
+	.long	0xeb1
+	.long	.LLST252
+	.long	.LVUS252
+	.uleb128 0x1
+	.long	0xea4
+	.long	.LLST253
+	.long	.LVUS253
+	.byte	0
+	.uleb128 0x6
+	.long	0xe94
+	.quad	.LBI2107
+	.value	.LVU545
+	.quad	.LBB2107
+	.quad	.LBE2107-.LBB2107
+	.byte	0x54
+	.byte	0x13
+	.long	0x25f3
+	.uleb128 0x2
+	.long	0xeb1
+	.uleb128 0x2
+	.long	0xea4
+	.byte	0
+	.uleb128 0x4
+	.long	0xe3e
+	.quad	.LBI2109
+	.value	.LVU550
+	.long	.LLRL254
+	.byte	0x54
+	.byte	0x44
+	.long	0x2627
+	.uleb128 0x1
+	.long	0xe5b
+	.long	.LLST255
+	.long	.LVUS255
+	.uleb128 0x1
+	.long	0xe4e
+	.long	.LLST256
+	.long	.LVUS256
+	.byte	0
+	.uleb128 0x4
+	.long	0xd27
+	.quad	.LBI2112
+	.value	.LVU553
+	.long	.LLRL257
+	.byte	0x54
+	.byte	0x44
+	.long	0x265b
+	.uleb128 0x1
+	.long	0xd44
+	.long	.LLST258
+	.long	.LVUS258
+	.uleb128 0x1
+	.long	0xd37
+	.long	.LLST259
+	.long	.LVUS259
+	.byte	0
+	.uleb128 0x6
+	.long	0xe94
+	.quad	.LBI2117
+	.value	.LVU562
+	.quad	.LBB2117
+	.quad	.LBE2117-.LBB2117
+	.byte	0x54
+	.byte	0x75
+	.long	0x269b
+	.uleb128 0x1
+	.long	0xeb1
+	.long	.LLST260
+	.long	.LVUS260
+	.uleb128 0x1
+	.long	0xea4
+	.long	.LLST261
+	.long	.LVUS261
+	.byte	0
+	.uleb128 0x4
+	.long	0xe3e
+	.quad	.LBI2119
+	.value	.LVU567
+	.long	.LLRL262
+	.byte	0x54
+	.byte	0x93
+	.long	0x26cf
+	.uleb128 0x1
+	.long	0xe5b
+	.long	.LLST263
+	.long	.LVUS263
+	.uleb128 0x1
+	.long	0xe4e
+	.long	.LLST264
+	.long	.LVUS264
+	.byte	0
+	.uleb128 0x4
+	.long	0xd27
+	.quad	.LBI2122
+	.value	.LVU570
+	.long	.LLRL265
+	.byte	0x54
+	.byte	0x93
+	.long	0x2703
+	.uleb128 0x1
+	.long	0xd44
+	.long	.LLST266
+	.long	.LVUS266
+	.uleb128 0x1
+	.long	0xd37
+	.long	.LLST267
+	.long	.LVUS267
+	.byte	0
+	.uleb128 0x6
+	.long	0xe94
+	.quad	.LBI2127
+	.value	.LVU577
+	.quad	.LBB2127
+	.quad	.LBE2127-.LBB2127
+	.byte	0x54
+	.byte	0xc4
+	.long	0x2743
+	.uleb128 0x1
+	.long	0xeb1
+	.long	.LLST268
+	.long	.LVUS268
+	.uleb128 0x1
+	.long	0xea4
+	.long	.LLST269
+	.long	.LVUS269
+	.byte	0
+	.uleb128 0x6
+	.long	0xe94
+	.quad	.LBI2129
+	.value	.LVU580
+	.quad	.LBB2129
+	.quad	.LBE2129-.LBB2129
+	.byte	0x54
+	.byte	0xc4
+	.long	0x277b
+	.uleb128 0x1
+	.long	0xeb1
+	.long	.LLST270
+	.long	.LVUS270
+	.uleb128 0x2
+	.long	0xea4
+	.byte	0
+	.uleb128 0x4
+	.long	0xe3e
+	.quad	.LBI2131
+	.value	.LVU586
+	.long	.LLRL271
+	.byte	0x54
+	.byte	0xf5
+	.long	0x27af
+	.uleb128 0x1
+	.long	0xe5b
+	.long	.LLST272
+	.long	.LVUS272
+	.uleb128 0x1
+	.long	0xe4e
+	.long	.LLST273
+	.long	.LVUS273
+	.byte	0
+	.uleb128 0x4
+	.long	0xd27
+	.quad	.LBI2134
+	.value	.LVU589
+	.long	.LLRL274
+	.byte	0x54
+	.byte	0xf5
+	.long	0x27e3
+	.uleb128 0x1
+	.long	0xd44
+	.long	.LLST275
+	.long	.LVUS275
+	.uleb128 0x1
+	.long	0xd37
+	.long	.LLST276
+	.long	.LVUS276
+	.byte	0
+	.uleb128 0x3
+	.long	0xe94
+	.quad	.LBI2139
+	.value	.LVU597
+	.long	.LLRL277
+	.byte	0x54
+	.value	0x125
+	.long	0x2818
+	.uleb128 0x1
+	.long	0xeb1
+	.long	.LLST278
+	.long	.LVUS278
+	.uleb128 0x1
+	.long	0xea4
+	.long	.LLST279
+	.long	.LVUS279
+	.byte	0
+	.uleb128 0x3
+	.long	0xe3e
+	.quad	.LBI2143
+	.value	.LVU605
+	.long	.LLRL280
+	.byte	0x54
+	.value	0x143
+	.long	0x284d
+	.uleb128 0x1
+	.long	0xe5b
+	.long	.LLST281
+	.long	.LVUS281
+	.uleb128 0x1
+	.long	0xe4e
+	.long	.LLST282
+	.long	.LVUS282
+	.byte	0
+	.uleb128 0x3
+	.long	0xd27
+	.quad	.LBI2146
+	.value	.LVU608
+	.long	.LLRL283
+	.byte	0x54
+	.value	0x143
+	.long	0x2882
+	.uleb128 0x1
+	.long	0xd44
+	.long	.LLST284
+	.long	.LVUS284
+	.uleb128 0x1
+	.long	0xd37
+	.long	.LLST285
+	.long	.LVUS285
+	.byte	0
+	.uleb128 0x4
+	.long	0xe14
+	.quad	.LBI2149
+	.value	.LVU629
+	.long	.LLRL286
+	.byte	0x54
+	.byte	0xc
+	.long	0x28ae
+	.uleb128 0x1
+	.long	0xe31
+	.long	.LLST287
+	.long	.LVUS287
+	.uleb128 0x2
+	.long	0xe24
+	.byte	0
+	.uleb128 0x4
+	.long	0xe14
+	.quad	.LBI2153
+	.value	.LVU625
+	.long	.LLRL288
+	.byte	0x54
+	.byte	0xc
+	.long	0x28da
+	.uleb128 0x1
+	.long	0xe31
+	.long	.LLST289
+	.long	.LVUS289
+	.uleb128 0x2
+	.long	0xe24
+	.byte	0
+	.uleb128 0x12
+	.long	0xe14
+	.quad	.LBI2157
+	.value	.LVU620
+	.quad	.LBB2157
+	.quad	.LBE2157-.LBB2157
+	.byte	0x54
+	.uleb128 0x1
+	.long	0xe31
+	.long	.LLST290
+	.long	.LVUS290
+	.uleb128 0x1
+	.long	0xe24
+	.long	.LLST291
+	.long	.LVUS291
+	.byte	0
+	.byte	0
+	.uleb128 0x10
+	.long	0xc6f
+	.long	.LLRL292
+	.long	0x316e
+	.uleb128 0x9
+	.long	0xc74
+	.uleb128 0x9
+	.long	0xc7e
+	.uleb128 0x4
+	.long	0xd52
+	.quad	.LBI2172
+	.value	.LVU640
+	.long	.LLRL293
+	.byte	0x55
+	.byte	0x84
+	.long	0x2966
+	.uleb128 0x1
+	.long	0xd7c
+	.long	.LLST294
+	.long	.LVUS294
+	.uleb128 0x2
+	.long	0xd6f
+	.uleb128 0x1
+	.long	0xd62
+	.long	.LLST295
+	.long	.LVUS295
+	.byte	0
+	.uleb128 0x3
+	.long	0xdb5
+	.quad	.LBI2177
+	.value	.LVU652
+	.long	.LLRL296
+	.byte	0x55
+	.value	0x130
+	.long	0x2986
+	.uleb128 0x2
+	.long	0xdc5
+	.byte	0
+	.uleb128 0x3
+	.long	0xd8a
+	.quad	.LBI2180
+	.value	.LVU656
+	.long	.LLRL297
+	.byte	0x55
+	.value	0x151
+	.long	0x29b3
+	.uleb128 0x1
+	.long	0xda7
+	.long	.LLST298
+	.long	.LVUS298
+	.uleb128 0x2
+	.long	0xd9a
+	.byte	0
+	.uleb128 0x4
+	.long	0xd52
+	.quad	.LBI2183
+	.value	.LVU636
+	.long	.LLRL299
+	.byte	0x55
+	.byte	0x1f
+	.long	0x29ec
+	.uleb128 0x1
+	.long	0xd7c
+	.long	.LLST300
+	.long	.LVUS300
+	.uleb128 0x2
+	.long	0xd6f
+	.uleb128 0x1
+	.long	0xd62
+	.long	.LLST301
+	.long	.LVUS301
+	.byte	0
+	.uleb128 0x4
+	.long	0xdb5
+	.quad	.LBI2188
+	.value	.LVU644
+	.long	.LLRL302
+	.byte	0x55
+	.byte	0xe9
+	.long	0x2a0b
+	.uleb128 0x2
+	.long	0xdc5
+	.byte	0
+	.uleb128 0x3
+	.long	0xd8a
+	.quad	.LBI2191
+	.value	.LVU648
+	.long	.LLRL303
+	.byte	0x55
+	.value	0x10a
+	.long	0x2a38
+	.uleb128 0x1
+	.long	0xda7
+	.long	.LLST304
+	.long	.LVUS304
+	.uleb128 0x2
+	.long	0xd9a
+	.byte	0
+	.uleb128 0x5
+	.long	0xe94
+	.quad	.LBI2200
+	.value	.LVU661
+	.quad	.LBB2200
+	.quad	.LBE2200-.LBB2200
+	.byte	0x55
+	.value	0x17e
+	.long	0x2a79
+	.uleb128 0x1
+	.long	0xeb1
+	.long	.LLST305
+	.long	.LVUS305
+	.uleb128 0x1
+	.long	0xea4
+	.long	.LLST306
+	.long	.LVUS306
+	.byte	0
+	.uleb128 0x5
+	.long	0xe94
+	.quad	.LBI2202
+	.value	.LVU664
+	.quad	.LBB2202
+	.quad	.LBE2202-.LBB2202
+	.byte	0x55
+	.value	0x17e
+	.long	0x2aaa
+	.uleb128 0x2
+	.long	0xeb1
+	.uleb128 0x2
+	.long	0xea4
+	.byte	0
+	.uleb128 0x3
+	.long	0xe3e
+	.quad	.LBI2204
+	.value	.LVU669
+	.long	.LLRL307
+	.byte	0x55
+	.value	0x1af
+	.long	0x2adf
+	.uleb128 0x1
+	.long	0xe5b
+	.long	.LLST308
+	.long	.LVUS308
+	.uleb128 0x1
+	.long	0xe4e
+	.long	.LLST309
+	.long	.LVUS309
+	.byte	0
+	.uleb128 0x3
+	.long	0xd27
+	.quad	.LBI2207
+	.value	.LVU672
+	.long	.LLRL310
+	.byte	0x55
+	.value	0x1af
+	.long	0x2b14
+	.uleb128 0x1
+	.long	0xd44
+	.long	.LLST311
+	.long	.LVUS311
+	.uleb128 0x1
+	.long	0xd37
+	.long	.LLST312
+	.long	.LVUS312
+	.byte	0
+	.uleb128 0x3
+	.long	0xe94
+	.quad	.LBI2212
+	.value	.LVU680
+	.long	.LLRL313
+	.byte	0x55
+	.value	0x1e0
+	.long	0x2b49
+	.uleb128 0x1
+	.long	0xeb1
+	.long	.LLST314
+	.long	.LVUS314
+	.uleb128 0x1
+	.long	0xea4
+	.long	.LLST315
+	.long	.LVUS315
+	.byte	0
+	.uleb128 0x3
+	.long	0xe3e
+	.quad	.LBI2216
+	.value	.LVU686
+	.long	.LLRL316
+	.byte	0x55
+	.value	0x1fe
+	.long	0x2b7e
+	.uleb128 0x1
+	.long	0xe5b
+	.long	.LLST317
+	.long	.LVUS317
+	.uleb128 0x1
+	.long	0xe4e
+	.long	.LLST318
+	.long	.LVUS318
+	.byte	0
+	.uleb128 0x3
+	.long	0xd27
+	.quad	.LBI2219
+	.value	.LVU689
+	.long	.LLRL319
+	.byte	0x55
+	.value	0x1fe
+	.long	0x2bb3
+	.uleb128 0x1
+	.long	0xd44
+	.long	.LLST320
+	.long	.LVUS320
+	.uleb128 0x1
+	.long	0xd37
+	.long	.LLST321
+	.long	.LVUS321
+	.byte	0
+	.uleb128 0x5
+	.long	0xe94
+	.quad	.LBI2224
+	.value	.LVU696
+	.quad	.LBB2224
+	.quad	.LBE2224-.LBB2224
+	.byte	0x55
+	.value	0x22f
+	.long	0x2bf4
+	.uleb128 0x1
+	.long	0xeb1
+	.long	.LLST322
+	.long	.LVUS322
+	.uleb128 0x1
+	.long	0xea4
+	.long	.LLST323
+	.long	.LVUS323
+	.byte	0
+	.uleb128 0x5
+	.long	0xe94
+	.quad	.LBI2226
+	.value	.LVU699
+	.quad	.LBB2226
+	.quad	.LBE2226-.LBB2226
+	.byte	0x55
+	.value	0x22f
+	.long	0x2c2d
+	.uleb128 0x1
+	.long	0xeb1
+	.long	.LLST324
+	.long	.LVUS324
+	.uleb128 0x2
+	.long	0xea4
+	.byte	0
+	.uleb128 0x3
+	.long	0xe3e
+	.quad	.LBI2228
+	.value	.LVU705
+	.long	.LLRL325
+	.byte	0x55
+	.value	0x260
+	.long	0x2c62
+	.uleb128 0x1
+	.long	0xe5b
+	.long	.LLST326
+	.long	.LVUS326
+	.uleb128 0x1
+	.long	0xe4e
+	.long	.LLST327
+	.long	.LVUS327
+	.byte	0
+	.uleb128 0x3
+	.long	0xd27
+	.quad	.LBI2231
+	.value	.LVU708
+	.long	.LLRL328
+	.byte	0x55
+	.value	0x260
+	.long	0x2c97
+	.uleb128 0x1
+	.long	0xd44
+	.long	.LLST329
+	.long	.LVUS329
+	.uleb128 0x1
+	.long	0xd37
+	.long	.LLST330
+	.long	.LVUS330
+	.byte	0
+	.uleb128 0x5
+	.long	0xe94
+	.quad	.LBI2236
+	.value	.LVU715
+	.quad	.LBB2236
+	.quad	.LBE2236-.LBB2236
+	.byte	0x55
+	.value	0x290
+	.long	0x2cd8
+	.uleb128 0x1
+	.long	0xeb1
+	.long	.LLST331
+	.long	.LVUS331
+	.uleb128 0x1
+	.long	0xea4
+	.long	.LLST332
+	.long	.LVUS332
+	.byte	0
+	.uleb128 0x3
+	.long	0xe3e
+	.quad	.LBI2238
+	.value	.LVU720
+	.long	.LLRL333
+	.byte	0x55
+	.value	0x2ae
+	.long	0x2d0d
+	.uleb128 0x1
+	.long	0xe5b
+	.long	.LLST334
+	.long	.LVUS334
+	.uleb128 0x1
+	.long	0xe4e
+	.long	.LLST335
+	.long	.LVUS335
+	.byte	0
+	.uleb128 0x3
+	.long	0xd27
+	.quad	.LBI2241
+	.value	.LVU723
+	.long	.LLRL336
+	.byte	0x55
+	.value	0x2ae
+	.long	0x2d42
+	.uleb128 0x1
+	.long	0xd44
+	.long	.LLST337
+	.long	.LVUS337
+	.uleb128 0x1
+	.long	0xd37
+	.long	.LLST338
+	.long	.LVUS338
+	.byte	0
+	.uleb128 0x4
+	.long	0xe14
+	.quad	.LBI2244
+	.value	.LVU744
+	.long	.LLRL339
+	.byte	0x55
+	.byte	0xc
+	.long	0x2d6e
+	.uleb128 0x1
+	.long	0xe31
+	.long	.LLST340
+	.long	.LVUS340
+	.uleb128 0x2
+	.long	0xe24
+	.byte	0
+	.uleb128 0x4
+	.long	0xe14
+	.quad	.LBI2248
+	.value	.LVU740
+	.long	.LLRL341
+	.byte	0x55
+	.byte	0xc
+	.long	0x2d9a
+	.uleb128 0x1
+	.long	0xe31
+	.long	.LLST342
+	.long	.LVUS342
+	.uleb128 0x2
+	.long	0xe24
+	.byte	0
+	.uleb128 0x5
+	.long	0xe14
+	.quad	.LBI2252
+	.value	.LVU735
+	.quad	.LBB2252
+	.quad	.LBE2252-.LBB2252
+	.byte	0x55
+	.value	0x2e9
+	.long	0x2ddb
+	.uleb128 0x1
+	.long	0xe31
+	.long	.LLST343
+	.long	.LVUS343
+	.uleb128 0x1
+	.long	0xe24
+	.long	.LLST344
+	.long	.LVUS344
+	.byte	0
+	.uleb128 0x6
+	.long	0xe94
+	.quad	.LBI2256
+	.value	.LVU749
+	.quad	.LBB2256
+	.quad	.LBE2256-.LBB2256
+	.byte	0x55
+	.byte	0x13
+	.long	0x2e1b
+	.uleb128 0x1
+	.long	0xeb1
+	.long	.LLST345
+	.long	.LVUS345
+	.uleb128 0x1
+	.long	0xea4
+	.long	.LLST346
+	.long	.LVUS346
+	.byte	0
+	.uleb128 0x6
+	.long	0xe94
+	.quad	.LBI2258
+	.value	.LVU752
+	.quad	.LBB2258
+	.quad	.LBE2258-.LBB2258
+	.byte	0x55
+	.byte	0x13
+	.long	0x2e4b
+	.uleb128 0x2
+	.long	0xeb1
+	.uleb128 0x2
+	.long	0xea4
+	.byte	0
+	.uleb128 0x4
+	.long	0xe3e
+	.quad	.LBI2260
+	.value	.LVU757
+	.long	.LLRL347
+	.byte	0x55
+	.byte	0x44
+	.long	0x2e7f
+	.uleb128 0x1
+	.long	0xe5b
+	.long	.LLST348
+	.long	.LVUS348
+	.uleb128 0x1
+	.long	0xe4e
+	.long	.LLST349
+	.long	.LVUS349
+	.byte	0
+	.uleb128 0x4
+	.long	0xd27
+	.quad	.LBI2263
+	.value	.LVU760
+	.long	.LLRL350
+	.byte	0x55
+	.byte	0x44
+	.long	0x2eb3
+	.uleb128 0x1
+	.long	0xd44
+	.long	.LLST351
+	.long	.LVUS351
+	.uleb128 0x1
+	.long	0xd37
+	.long	.LLST352
+	.long	.LVUS352
+	.byte	0
+	.uleb128 0x6
+	.long	0xe94
+	.quad	.LBI2268
+	.value	.LVU769
+	.quad	.LBB2268
+	.quad	.LBE2268-.LBB2268
+	.byte	0x55
+	.byte	0x75
+	.long	0x2ef3
+	.uleb128 0x1
+	.long	0xeb1
+	.long	.LLST353
+	.long	.LVUS353
+	.uleb128 0x1
+	.long	0xea4
+	.long	.LLST354
+	.long	.LVUS354
+	.byte	0
+	.uleb128 0x4
+	.long	0xe3e
+	.quad	.LBI2270
+	.value	.LVU774
+	.long	.LLRL355
+	.byte	0x55
+	.byte	0x93
+	.long	0x2f27
+	.uleb128 0x1
+	.long	0xe5b
+	.long	.LLST356
+	.long	.LVUS356
+	.uleb128 0x1
+	.long	0xe4e
+	.long	.LLST357
+	.long	.LVUS357
+	.byte	0
+	.uleb128 0x4
+	.long	0xd27
+	.quad	.LBI2273
+	.value	.LVU777
+	.long	.LLRL358
+	.byte	0x55
+	.byte	0x93
+	.long	0x2f5b
+	.uleb128 0x1
+	.long	0xd44
+	.long	.LLST359
+	.long	.LVUS359
+	.uleb128 0x1
+	.long	0xd37
+	.long	.LLST360
+	.long	.LVUS360
+	.byte	0
+	.uleb128 0x6
+	.long	0xe94
+	.quad	.LBI2278
+	.value	.LVU784
+	.quad	.LBB2278
+	.quad	.LBE2278-.LBB2278
+	.byte	0x55
+	.byte	0xc4
+	.long	0x2f9b
+	.uleb128 0x1
+	.long	0xeb1
+	.long	.LLST361
+	.long	.LVUS361
+	.uleb128 0x1
+	.long	0xea4
+	.long	.LLST362
+	.long	.LVUS362
+	.byte	0
+	.uleb128 0x6
+	.long	0xe94
+	.quad	.LBI2280
+	.value	.LVU787
+	.quad	.LBB2280
+	.quad	.LBE2280-.LBB2280
+	.byte	0x55
+	.byte	0xc4
+	.long	0x2fd3
+	.uleb128 0x1
+	.long	0xeb1
+	.long	.LLST363
+	.long	.LVUS363
+	.uleb128 0x2
+	.long	0xea4
+	.byte	0
+	.uleb128 0x4
+	.long	0xe3e
+	.quad	.LBI2282
+	.value	.LVU793
+	.long	.LLRL364
+	.byte	0x55
+	.byte	0xf5
+	.long	0x3007
+	.uleb128 0x1
+	.long	0xe5b
+	.long	.LLST365
+	.long	.LVUS365
+	.uleb128 0x1
+	.long	0xe4e
+	.long	.LLST366
+	.long	.LVUS366
+	.byte	0
+	.uleb128 0x4
+	.long	0xd27
+	.quad	.LBI2285
+	.value	.LVU796
+	.long	.LLRL367
+	.byte	0x55
+	.byte	0xf5
+	.long	0x303b
+	.uleb128 0x1
+	.long	0xd44
+	.long	.LLST368
+	.long	.LVUS368
+	.uleb128 0x1
+	.long	0xd37
+	.long	.LLST369
+	.long	.LVUS369
+	.byte	0
+	.uleb128 0x3
+	.long	0xe94
+	.quad	.LBI2290
+	.value	.LVU804
+	.long	.LLRL370
+	.byte	0x55
+	.value	0x125
+	.long	0x3070
+	.uleb128 0x1
+	.long	0xeb1
+	.long	.LLST371
+	.long	.LVUS371
+	.uleb128 0x1
+	.long	0xea4
+	.long	.LLST372
+	.long	.LVUS372
+	.byte	0
+	.uleb128 0x3
+	.long	0xe3e
+	.quad	.LBI2294
+	.value	.LVU812
+	.long	.LLRL373
+	.byte	0x55
+	.value	0x143
+	.long	0x30a5
+	.uleb128 0x1
+	.long	0xe5b
+	.long	.LLST374
+	.long	.LVUS374
+	.uleb128 0x1
+	.long	0xe4e
+	.long	.LLST375
+	.long	.LVUS375
+	.byte	0
+	.uleb128 0x3
+	.long	0xd27
+	.quad	.LBI2297
+	.value	.LVU815
+	.long	.LLRL376
+	.byte	0x55
+	.value	0x143
+	.long	0x30da
+	.uleb128 0x1
+	.long	0xd44
+	.long	.LLST377
+	.long	.LVUS377
+	.uleb128 0x1
+	.long	0xd37
+	.long	.LLST378
+	.long	.LVUS378
+	.byte	0
+	.uleb128 0x4
+	.long	0xe14
+	.quad	.LBI2300
+	.value	.LVU836
+	.long	.LLRL379
+	.byte	0x55
+	.byte	0xc
+	.long	0x3106
+	.uleb128 0x1
+	.long	0xe31
+	.long	.LLST380
+	.long	.LVUS380
+	.uleb128 0x2
+	.long	0xe24
+	.byte	0
+	.uleb128 0x4
+	.long	0xe14
+	.quad	.LBI2304
+	.value	.LVU832
+	.long	.LLRL381
+	.byte	0x55
+	.byte	0xc
+	.long	0x3132
+	.uleb128 0x1
+	.long	0xe31
+	.long	.LLST382
+	.long	.LVUS382
+	.uleb128 0x2
+	.long	0xe24
+	.byte	0
+	.uleb128 0x12
+	.long	0xe14
+	.quad	.LBI2308
+	.value	.LVU827
+	.quad	.LBB2308
+	.quad	.LBE2308-.LBB2308
+	.byte	0x55
+	.uleb128 0x1
+	.long	0xe31
+	.long	.LLST383
+	.long	.LVUS383
+	.uleb128 0x1
+	.long	0xe24
+	.long	.LLST384
+	.long	.LVUS384
+	.byte	0
+	.byte	0
+	.uleb128 0x10
+	.long	0xc89
+	.long	.LLRL385
+	.long	0x39c6
+	.uleb128 0x9
+	.long	0xc8e
+	.uleb128 0x9
+	.long	0xc98
+	.uleb128 0x4
+	.long	0xd52
+	.quad	.LBI2323
+	.value	.LVU847
+	.long	.LLRL386
+	.byte	0x56
+	.byte	0x84
+	.long	0x31be
+	.uleb128 0x1
+	.long	0xd7c
+	.long	.LLST387
+	.long	.LVUS387
+	.uleb128 0x2
+	.long	0xd6f
+	.uleb128 0x1
+	.long	0xd62
+	.long	.LLST388
+	.long	.LVUS388
+	.byte	0
+	.uleb128 0x3
+	.long	0xdb5
+	.quad	.LBI2328
+	.value	.LVU859
+	.long	.LLRL389
+	.byte	0x56
+	.value	0x130
+	.long	0x31de
+	.uleb128 0x2
+	.long	0xdc5
+	.byte	0
+	.uleb128 0x3
+	.long	0xd8a
+	.quad	.LBI2331
+	.value	.LVU863
+	.long	.LLRL390
+	.byte	0x56
+	.value	0x151
+	.long	0x320b
+	.uleb128 0x1
+	.long	0xda7
+	.long	.LLST391
+	.long	.LVUS391
+	.uleb128 0x2
+	.long	0xd9a
+	.byte	0
+	.uleb128 0x4
+	.long	0xd52
+	.quad	.LBI2334
+	.value	.LVU843
+	.long	.LLRL392
+	.byte	0x56
+	.byte	0x1f
+	.long	0x3244
+	.uleb128 0x1
+	.long	0xd7c
+	.long	.LLST393
+	.long	.LVUS393
+	.uleb128 0x2
+	.long	0xd6f
+	.uleb128 0x1
+	.long	0xd62
+	.long	.LLST394
+	.long	.LVUS394
+	.byte	0
+	.uleb128 0x4
+	.long	0xdb5
+	.quad	.LBI2339
+	.value	.LVU851
+	.long	.LLRL395
+	.byte	0x56
+	.byte	0xe9
+	.long	0x3263
+	.uleb128 0x2
+	.long	0xdc5
+	.byte	0
+	.uleb128 0x3
+	.long	0xd8a
+	.quad	.LBI2342
+	.value	.LVU855
+	.long	.LLRL396
+	.byte	0x56
+	.value	0x10a
+	.long	0x3290
+	.uleb128 0x1
+	.long	0xda7
+	.long	.LLST397
+	.long	.LVUS397
+	.uleb128 0x2
+	.long	0xd9a
+	.byte	0
+	.uleb128 0x5
+	.long	0xe94
+	.quad	.LBI2351
+	.value	.LVU868
+	.quad	.LBB2351
+	.quad	.LBE2351-.LBB2351
+	.byte	0x56
+	.value	0x17e
+	.long	0x32d1
+	.uleb128 0x1
+	.long	0xeb1
+	.long	.LLST398
+	.long	.LVUS398
+	.uleb128 0x1
+	.long	0xea4
+	.long	.LLST399
+	.long	.LVUS399
+	.byte	0
+	.uleb128 0x5
+	.long	0xe94
+	.quad	.LBI2353
+	.value	.LVU871
+	.quad	.LBB2353
+	.quad	.LBE2353-.LBB2353
+	.byte	0x56
+	.value	0x17e
+	.long	0x3302
+	.uleb128 0x2
+	.long	0xeb1
+	.uleb128 0x2
+	.long	0xea4
+	.byte	0
+	.uleb128 0x3
+	.long	0xe3e
+	.quad	.LBI2355
+	.value	.LVU876
+	.long	.LLRL400
+	.byte	0x56
+	.value	0x1af
+	.long	0x3337
+	.uleb128 0x1
+	.long	0xe5b
+	.long	.LLST401
+	.long	.LVUS401
+	.uleb128 0x1
+	.long	0xe4e
+	.long	.LLST402
+	.long	.LVUS402
+	.byte	0
+	.uleb128 0x3
+	.long	0xd27
+	.quad	.LBI2358
+	.value	.LVU879
+	.long	.LLRL403
+	.byte	0x56
+	.value	0x1af
+	.long	0x336c
+	.uleb128 0x1
+	.long	0xd44
+	.long	.LLST404
+	.long	.LVUS404
+	.uleb128 0x1
+	.long	0xd37
+	.long	.LLST405
+	.long	.LVUS405
+	.byte	0
+	.uleb128 0x3
+	.long	0xe94
+	.quad	.LBI2363
+	.value	.LVU887
+	.long	.LLRL406
+	.byte	0x56
+	.value	0x1e0
+	.long	0x33a1
+	.uleb128 0x1
+	.long	0xeb1
+	.long	.LLST407
+	.long	.LVUS407
+	.uleb128 0x1
+	.long	0xea4
+	.long	.LLST408
+	.long	.LVUS408
+	.byte	0
+	.uleb128 0x3
+	.long	0xe3e
+	.quad	.LBI2367
+	.value	.LVU893
+	.long	.LLRL409
+	.byte	0x56
+	.value	0x1fe
+	.long	0x33d6
+	.uleb128 0x1
+	.long	0xe5b
+	.long	.LLST410
+	.long	.LVUS410
+	.uleb128 0x1
+	.long	0xe4e
+	.long	.LLST411
+	.long	.LVUS411
+	.byte	0
+	.uleb128 0x3
+	.long	0xd27
+	.quad	.LBI2370
+	.value	.LVU896
+	.long	.LLRL412
+	.byte	0x56
+	.value	0x1fe
+	.long	0x340b
+	.uleb128 0x1
+	.long	0xd44
+	.long	.LLST413
+	.long	.LVUS413
+	.uleb128 0x1
+	.long	0xd37
+	.long	.LLST414
+	.long	.LVUS414
+	.byte	0
+	.uleb128 0x5
+	.long	0xe94
+	.quad	.LBI2375
+	.value	.LVU903
+	.quad	.LBB2375
+	.quad	.LBE2375-.LBB2375
+	.byte	0x56
+	.value	0x22f
+	.long	0x344c
+	.uleb128 0x1
+	.long	0xeb1
+	.long	.LLST415
+	.long	.LVUS415
+	.uleb128 0x1
+	.long	0xea4
+	.long	.LLST416
+	.long	.LVUS416
+	.byte	0
+	.uleb128 0x5
+	.long	0xe94
+	.quad	.LBI2377
+	.value	.LVU906
+	.quad	.LBB2377
+	.quad	.LBE2377-.LBB2377
+	.byte	0x56
+	.value	0x22f
+	.long	0x3485
+	.uleb128 0x1
+	.long	0xeb1
+	.long	.LLST417
+	.long	.LVUS417
+	.uleb128 0x2
+	.long	0xea4
+	.byte	0
+	.uleb128 0x3
+	.long	0xe3e
+	.quad	.LBI2379
+	.value	.LVU912
+	.long	.LLRL418
+	.byte	0x56
+	.value	0x260
+	.long	0x34ba
+	.uleb128 0x1
+	.long	0xe5b
+	.long	.LLST419
+	.long	.LVUS419
+	.uleb128 0x1
+	.long	0xe4e
+	.long	.LLST420
+	.long	.LVUS420
+	.byte	0
+	.uleb128 0x3
+	.long	0xd27
+	.quad	.LBI2382
+	.value	.LVU915
+	.long	.LLRL421
+	.byte	0x56
+	.value	0x260
+	.long	0x34ef
+	.uleb128 0x1
+	.long	0xd44
+	.long	.LLST422
+	.long	.LVUS422
+	.uleb128 0x1
+	.long	0xd37
+	.long	.LLST423
+	.long	.LVUS423
+	.byte	0
+	.uleb128 0x5
+	.long	0xe94
+	.quad	.LBI2387
+	.value	.LVU922
+	.quad	.LBB2387
+	.quad	.LBE2387-.LBB2387
+	.byte	0x56
+	.value	0x290
+	.long	0x3530
+	.uleb128 0x1
+	.long	0xeb1
+	.long	.LLST424
+	.long	.LVUS424
+	.uleb128 0x1
+	.long	0xea4
+	.long	.LLST425
+	.long	.LVUS425
+	.byte	0
+	.uleb128 0x3
+	.long	0xe3e
+	.quad	.LBI2389
+	.value	.LVU927
+	.long	.LLRL426
+	.byte	0x56
+	.value	0x2ae
+	.long	0x3565
+	.uleb128 0x1
+	.long	0xe5b
+	.long	.LLST427
+	.long	.LVUS427
+	.uleb128 0x1
+	.long	0xe4e
+	.long	.LLST428
+	.long	.LVUS428
+	.byte	0
+	.uleb128 0x3
+	.long	0xd27
+	.quad	.LBI2392
+	.value	.LVU930
+	.long	.LLRL429
+	.byte	0x56
+	.value	0x2ae
+	.long	0x359a
+	.uleb128 0x1
+	.long	0xd44
+	.long	.LLST430
+	.long	.LVUS430
+	.uleb128 0x1
+	.long	0xd37
+	.long	.LLST431
+	.long	.LVUS431
+	.byte	0
+	.uleb128 0x4
+	.long	0xe14
+	.quad	.LBI2395
+	.value	.LVU951
+	.long	.LLRL432
+	.byte	0x56
+	.byte	0xc
+	.long	0x35c6
+	.uleb128 0x1
+	.long	0xe31
+	.long	.LLST433
+	.long	.LVUS433
+	.uleb128 0x2
+	.long	0xe24
+	.byte	0
+	.uleb128 0x4
+	.long	0xe14
+	.quad	.LBI2399
+	.value	.LVU947
+	.long	.LLRL434
+	.byte	0x56
+	.byte	0xc
+	.long	0x35f2
+	.uleb128 0x1
+	.long	0xe31
+	.long	.LLST435
+	.long	.LVUS435
+	.uleb128 0x2
+	.long	0xe24
+	.byte	0
+	.uleb128 0x5
+	.long	0xe14
+	.quad	.LBI2403
+	.value	.LVU942
+	.quad	.LBB2403
+	.quad	.LBE2403-.LBB2403
+	.byte	0x56
+	.value	0x2e9
+	.long	0x3633
+	.uleb128 0x1
+	.long	0xe31
+	.long	.LLST436
+	.long	.LVUS436
+	.uleb128 0x1
+	.long	0xe24
+	.long	.LLST437
+	.long	.LVUS437
+	.byte	0
+	.uleb128 0x6
+	.long	0xe94
+	.quad	.LBI2407
+	.value	.LVU956
+	.quad	.LBB2407
+	.quad	.LBE2407-.LBB2407
+	.byte	0x56
+	.byte	0x13
+	.long	0x3673
+	.uleb128 0x1
+	.long	0xeb1
+	.long	.LLST438
+	.long	.LVUS438
+	.uleb128 0x1
+	.long	0xea4
+	.long	.LLST439
+	.long	.LVUS439
+	.byte	0
+	.uleb128 0x6
+	.long	0xe94
+	.quad	.LBI2409
+	.value	.LVU959
+	.quad	.LBB2409
+	.quad	.LBE2409-.LBB2409
+	.byte	0x56
+	.byte	0x13
+	.long	0x36a3
+	.uleb128 0x2
+	.long	0xeb1
+	.uleb128 0x2
+	.long	0xea4
+	.byte	0
+	.uleb128 0x4
+	.long	0xe3e
+	.quad	.LBI2411
+	.value	.LVU964
+	.long	.LLRL440
+	.byte	0x56
+	.byte	0x44
+	.long	0x36d7
+	.uleb128 0x1
+	.long	0xe5b
+	.long	.LLST441
+	.long	.LVUS441
+	.uleb128 0x1
+	.long	0xe4e
+	.long	.LLST442
+	.long	.LVUS442
+	.byte	0
+	.uleb128 0x4
+	.long	0xd27
+	.quad	.LBI2414
+	.value	.LVU967
+	.long	.LLRL443
+	.byte	0x56
+	.byte	0x44
+	.long	0x370b
+	.uleb128 0x1
+	.long	0xd44
+	.long	.LLST444
+	.long	.LVUS444
+	.uleb128 0x1
+	.long	0xd37
+	.long	.LLST445
+	.long	.LVUS445
+	.byte	0
+	.uleb128 0x6
+	.long	0xe94
+	.quad	.LBI2419
+	.value	.LVU976
+	.quad	.LBB2419
+	.quad	.LBE2419-.LBB2419
+	.byte	0x56
+	.byte	0x75
+	.long	0x374b
+	.uleb128 0x1
+	.long	0xeb1
+	.long	.LLST446
+	.long	.LVUS446
+	.uleb128 0x1
+	.long	0xea4
+	.long	.LLST447
+	.long	.LVUS447
+	.byte	0
+	.uleb128 0x4
+	.long	0xe3e
+	.quad	.LBI2421
+	.value	.LVU981
+	.long	.LLRL448
+	.byte	0x56
+	.byte	0x93
+	.long	0x377f
+	.uleb128 0x1
+	.long	0xe5b
+	.long	.LLST449
+	.long	.LVUS449
+	.uleb128 0x1
+	.long	0xe4e
+	.long	.LLST450
+	.long	.LVUS450
+	.byte	0
+	.uleb128 0x4
+	.long	0xd27
+	.quad	.LBI2424
+	.value	.LVU984
+	.long	.LLRL451
+	.byte	0x56
+	.byte	0x93
+	.long	0x37b3
+	.uleb128 0x1
+	.long	0xd44
+	.long	.LLST452
+	.long	.LVUS452
+	.uleb128 0x1
+	.long	0xd37
+	.long	.LLST453
+	.long	.LVUS453
+	.byte	0
+	.uleb128 0x6
+	.long	0xe94
+	.quad	.LBI2429
+	.value	.LVU991
+	.quad	.LBB2429
+	.quad	.LBE2429-.LBB2429
+	.byte	0x56
+	.byte	0xc4
+	.long	0x37f3
+	.uleb128 0x1
+	.long	0xeb1
+	.long	.LLST454
+	.long	.LVUS454
+	.uleb128 0x1
+	.long	0xea4
+	.long	.LLST455
+	.long	.LVUS455
+	.byte	0
+	.uleb128 0x6
+	.long	0xe94
+	.quad	.LBI2431
+	.value	.LVU994
+	.quad	.LBB2431
+	.quad	.LBE2431-.LBB2431
+	.byte	0x56
+	.byte	0xc4
+	.long	0x382b
+	.uleb128 0x1
+	.long	0xeb1
+	.long	.LLST456
+	.long	.LVUS456
+	.uleb128 0x2
+	.long	0xea4
+	.byte	0
+	.uleb128 0x4
+	.long	0xe3e
+	.quad	.LBI2433
+	.value	.LVU1000
+	.long	.LLRL457
+	.byte	0x56
+	.byte	0xf5
+	.long	0x385f
+	.uleb128 0x1
+	.long	0xe5b
+	.long	.LLST458
+	.long	.LVUS458
+	.uleb128 0x1
+	.long	0xe4e
+	.long	.LLST459
+	.long	.LVUS459
+	.byte	0
+	.uleb128 0x4
+	.long	0xd27
+	.quad	.LBI2436
+	.value	.LVU1003
+	.long	.LLRL460
+	.byte	0x56
+	.byte	0xf5
+	.long	0x3893
+	.uleb128 0x1
+	.long	0xd44
+	.long	.LLST461
+	.long	.LVUS461
+	.uleb128 0x1
+	.long	0xd37
+	.long	.LLST462
+	.long	.LVUS462
+	.byte	0
+	.uleb128 0x3
+	.long	0xe94
+	.quad	.LBI2441
+	.value	.LVU1011
+	.long	.LLRL463
+	.byte	0x56
+	.value	0x125
+	.long	0x38c8
+	.uleb128 0x1
+	.long	0xeb1
+	.long	.LLST464
+	.long	.LVUS464
+	.uleb128 0x1
+	.long	0xea4
+	.long	.LLST465
+	.long	.LVUS465
+	.byte	0
+	.uleb128 0x3
+	.long	0xe3e
+	.quad	.LBI2445
+	.value	.LVU1019
+	.long	.LLRL466
+	.byte	0x56
+	.value	0x143
+	.long	0x38fd
+	.uleb128 0x1
+	.long	0xe5b
+	.long	.LLST467
+	.long	.LVUS467
+	.uleb128 0x1
+	.long	0xe4e
+	.long	.LLST468
+	.long	.LVUS468
+	.byte	0
+	.uleb128 0x3
+	.long	0xd27
+	.quad	.LBI2448
+	.value	.LVU1022
+	.long	.LLRL469
+	.byte	0x56
+	.value	0x143
+	.long	0x3932
+	.uleb128 0x1
+	.long	0xd44
+	.long	.LLST470
+	.long	.LVUS470
+	.uleb128 0x1
+	.long	0xd37
+	.long	.LLST471
+	.long	.LVUS471
+	.byte	0
+	.uleb128 0x4
+	.long	0xe14
+	.quad	.LBI2451
+	.value	.LVU1043
+	.long	.LLRL472
+	.byte	0x56
+	.byte	0xc
+	.long	0x395e
+	.uleb128 0x1
+	.long	0xe31
+	.long	.LLST473
+	.long	.LVUS473
+	.uleb128 0x2
+	.long	0xe24
+	.byte	0
+	.uleb128 0x4
+	.long	0xe14
+	.quad	.LBI2455
+	.value	.LVU1039
+	.long	.LLRL474
+	.byte	0x56
+	.byte	0xc
+	.long	0x398a
+	.uleb128 0x1
+	.long	0xe31
+	.long	.LLST475
+	.long	.LVUS475
+	.uleb128 0x2
+	.long	0xe24
+	.byte	0
+	.uleb128 0x12
+	.long	0xe14
+	.quad	.LBI2459
+	.value	.LVU1034
+	.quad	.LBB2459
+	.quad	.LBE2459-.LBB2459
+	.byte	0x56
+	.uleb128 0x1
+	.long	0xe31
+	.long	.LLST476
+	.long	.LVUS476
+	.uleb128 0x1
+	.long	0xe24
+	.long	.LLST477
+	.long	.LVUS477
+	.byte	0
+	.byte	0
+	.uleb128 0x10
+	.long	0xca3
+	.long	.LLRL478
+	.long	0x421e
+	.uleb128 0x9
+	.long	0xca8
+	.uleb128 0x9
+	.long	0xcb2
+	.uleb128 0x4
+	.long	0xd52
+	.quad	.LBI2474
+	.value	.LVU1054
+	.long	.LLRL479
+	.byte	0x57
+	.byte	0x84
+	.long	0x3a16
+	.uleb128 0x1
+	.long	0xd7c
+	.long	.LLST480
+	.long	.LVUS480
+	.uleb128 0x2
+	.long	0xd6f
+	.uleb128 0x1
+	.long	0xd62
+	.long	.LLST481
+	.long	.LVUS481
+	.byte	0
+	.uleb128 0x3
+	.long	0xdb5
+	.quad	.LBI2479
+	.value	.LVU1066
+	.long	.LLRL482
+	.byte	0x57
+	.value	0x130
+	.long	0x3a36
+	.uleb128 0x2
+	.long	0xdc5
+	.byte	0
+	.uleb128 0x3
+	.long	0xd8a
+	.quad	.LBI2482
+	.value	.LVU1070
+	.long	.LLRL483
+	.byte	0x57
+	.value	0x151
+	.long	0x3a63
+	.uleb128 0x1
+	.long	0xda7
+	.long	.LLST484
+	.long	.LVUS484
+	.uleb128 0x2
+	.long	0xd9a
+	.byte	0
+	.uleb128 0x4
+	.long	0xd52
+	.quad	.LBI2485
+	.value	.LVU1050
+	.long	.LLRL485
+	.byte	0x57
+	.byte	0x1f
+	.long	0x3a9c
+	.uleb128 0x1
+	.long	0xd7c
+	.long	.LLST486
+	.long	.LVUS486
+	.uleb128 0x2
+	.long	0xd6f
+	.uleb128 0x1
+	.long	0xd62
+	.long	.LLST487
+	.long	.LVUS487
+	.byte	0
+	.uleb128 0x4
+	.long	0xdb5
+	.quad	.LBI2490
+	.value	.LVU1058
+	.long	.LLRL488
+	.byte	0x57
+	.byte	0xe9
+	.long	0x3abb
+	.uleb128 0x2
+	.long	0xdc5
+	.byte	0
+	.uleb128 0x3
+	.long	0xd8a
+	.quad	.LBI2493
+	.value	.LVU1062
+	.long	.LLRL489
+	.byte	0x57
+	.value	0x10a
+	.long	0x3ae8
+	.uleb128 0x1
+	.long	0xda7
+	.long	.LLST490
+	.long	.LVUS490
+	.uleb128 0x2
+	.long	0xd9a
+	.byte	0
+	.uleb128 0x5
+	.long	0xe94
+	.quad	.LBI2502
+	.value	.LVU1075
+	.quad	.LBB2502
+	.quad	.LBE2502-.LBB2502
+	.byte	0x57
+	.value	0x17e
+	.long	0x3b29
+	.uleb128 0x1
+	.long	0xeb1
+	.long	.LLST491
+	.long	.LVUS491
+	.uleb128 0x1
+	.long	0xea4
+	.long	.LLST492
+	.long	.LVUS492
+	.byte	0
+	.uleb128 0x5
+	.long	0xe94
+	.quad	.LBI2504
+	.value	.LVU1078
+	.quad	.LBB2504
+	.quad	.LBE2504-.LBB2504
+	.byte	0x57
+	.value	0x17e
+	.long	0x3b5a
+	.uleb128 0x2
+	.long	0xeb1
+	.uleb128 0x2
+	.long	0xea4
+	.byte	0
+	.uleb128 0x3
+	.long	0xe3e
+	.quad	.LBI2506
+	.value	.LVU1083
+	.long	.LLRL493
+	.byte	0x57
+	.value	0x1af
+	.long	0x3b8f
+	.uleb128 0x1
+	.long	0xe5b
+	.long	.LLST494
+	.long	.LVUS494
+	.uleb128 0x1
+	.long	0xe4e
+	.long	.LLST495
+	.long	.LVUS495
+	.byte	0
+	.uleb128 0x3
+	.long	0xd27
+	.quad	.LBI2509
+	.value	.LVU1086
+	.long	.LLRL496
+	.byte	0x57
+	.value	0x1af
+	.long	0x3bc4
+	.uleb128 0x1
+	.long	0xd44
+	.long	.LLST497
+	.long	.LVUS497
+	.uleb128 0x1
+	.long	0xd37
+	.long	.LLST498
+	.long	.LVUS498
+	.byte	0
+	.uleb128 0x3
+	.long	0xe94
+	.quad	.LBI2514
+	.value	.LVU1094
+	.long	.LLRL499
+	.byte	0x57
+	.value	0x1e0
+	.long	0x3bf9
+	.uleb128 0x1
+	.long	0xeb1
+	.long	.LLST500
+	.long	.LVUS500
+	.uleb128 0x1
+	.long	0xea4
+	.long	.LLST501
+	.long	.LVUS501
+	.byte	0
+	.uleb128 0x3
+	.long	0xe3e
+	.quad	.LBI2518
+	.value	.LVU1100
+	.long	.LLRL502
+	.byte	0x57
+	.value	0x1fe
+	.long	0x3c2e
+	.uleb128 0x1
+	.long	0xe5b
+	.long	.LLST503
+	.long	.LVUS503
+	.uleb128 0x1
+	.long	0xe4e
+	.long	.LLST504
+	.long	.LVUS504
+	.byte	0
+	.uleb128 0x3
+	.long	0xd27
+	.quad	.LBI2521
+	.value	.LVU1103
+	.long	.LLRL505
+	.byte	0x57
+	.value	0x1fe
+	.long	0x3c63
+	.uleb128 0x1
+	.long	0xd44
+	.long	.LLST506
+	.long	.LVUS506
+	.uleb128 0x1
+	.long	0xd37
+	.long	.LLST507
+	.long	.LVUS507
+	.byte	0
+	.uleb128 0x5
+	.long	0xe94
+	.quad	.LBI2526
+	.value	.LVU1110
+	.quad	.LBB2526
+	.quad	.LBE2526-.LBB2526
+	.byte	0x57
+	.value	0x22f
+	.long	0x3ca4
+	.uleb128 0x1
+	.long	0xeb1
+	.long	.LLST508
+	.long	.LVUS508
+	.uleb128 0x1
+	.long	0xea4
+	.long	.LLST509
+	.long	.LVUS509
+	.byte	0
+	.uleb128 0x5
+	.long	0xe94
+	.quad	.LBI2528
+	.value	.LVU1113
+	.quad	.LBB2528
+	.quad	.LBE2528-.LBB2528
+	.byte	0x57
+	.value	0x22f
+	.long	0x3cdd
+	.uleb128 0x1
+	.long	0xeb1
+	.long	.LLST510
+	.long	.LVUS510
+	.uleb128 0x2
+	.long	0xea4
+	.byte	0
+	.uleb128 0x3
+	.long	0xe3e
+	.quad	.LBI2530
+	.value	.LVU1119
+	.long	.LLRL511
+	.byte	0x57
+	.value	0x260
+	.long	0x3d12
+	.uleb128 0x1
+	.long	0xe5b
+	.long	.LLST512
+	.long	.LVUS512
+	.uleb128 0x1
+	.long	0xe4e
+	.long	.LLST513
+	.long	.LVUS513
+	.byte	0
+	.uleb128 0x3
+	.long	0xd27
+	.quad	.LBI2533
+	.value	.LVU1122
+	.long	.LLRL514
+	.byte	0x57
+	.value	0x260
+	.long	0x3d47
+	.uleb128 0x1
+	.long	0xd44
+	.long	.LLST515
+	.long	.LVUS515
+	.uleb128 0x1
+	.long	0xd37
+	.long	.LLST516
+	.long	.LVUS516
+	.byte	0
+	.uleb128 0x5
+	.long	0xe94
+	.quad	.LBI2538
+	.value	.LVU1129
+	.quad	.LBB2538
+	.quad	.LBE2538-.LBB2538
+	.byte	0x57
+	.value	0x290
+	.long	0x3d88
+	.uleb128 0x1
+	.long	0xeb1
+	.long	.LLST517
+	.long	.LVUS517
+	.uleb128 0x1
+	.long	0xea4
+	.long	.LLST518
+	.long	.LVUS518
+	.byte	0
+	.uleb128 0x3
+	.long	0xe3e
+	.quad	.LBI2540
+	.value	.LVU1134
+	.long	.LLRL519
+	.byte	0x57
+	.value	0x2ae
+	.long	0x3dbd
+	.uleb128 0x1
+	.long	0xe5b
+	.long	.LLST520
+	.long	.LVUS520
+	.uleb128 0x1
+	.long	0xe4e
+	.long	.LLST521
+	.long	.LVUS521
+	.byte	0
+	.uleb128 0x3
+	.long	0xd27
+	.quad	.LBI2543
+	.value	.LVU1137
+	.long	.LLRL522
+	.byte	0x57
+	.value	0x2ae
+	.long	0x3df2
+	.uleb128 0x1
+	.long	0xd44
+	.long	.LLST523
+	.long	.LVUS523
+	.uleb128 0x1
+	.long	0xd37
+	.long	.LLST524
+	.long	.LVUS524
+	.byte	0
+	.uleb128 0x4
+	.long	0xe14
+	.quad	.LBI2546
+	.value	.LVU1158
+	.long	.LLRL525
+	.byte	0x57
+	.byte	0xc
+	.long	0x3e1e
+	.uleb128 0x1
+	.long	0xe31
+	.long	.LLST526
+	.long	.LVUS526
+	.uleb128 0x2
+	.long	0xe24
+	.byte	0
+	.uleb128 0x4
+	.long	0xe14
+	.quad	.LBI2550
+	.value	.LVU1154
+	.long	.LLRL527
+	.byte	0x57
+	.byte	0xc
+	.long	0x3e4a
+	.uleb128 0x1
+	.long	0xe31
+	.long	.LLST528
+	.long	.LVUS528
+	.uleb128 0x2
+	.long	0xe24
+	.byte	0
+	.uleb128 0x5
+	.long	0xe14
+	.quad	.LBI2554
+	.value	.LVU1149
+	.quad	.LBB2554
+	.quad	.LBE2554-.LBB2554
+	.byte	0x57
+	.value	0x2e9
+	.long	0x3e8b
+	.uleb128 0x1
+	.long	0xe31
+	.long	.LLST529
+	.long	.LVUS529
+	.uleb128 0x1
+	.long	0xe24
+	.long	.LLST530
+	.long	.LVUS530
+	.byte	0
+	.uleb128 0x6
+	.long	0xe94
+	.quad	.LBI2558
+	.value	.LVU1163
+	.quad	.LBB2558
+	.quad	.LBE2558-.LBB2558
+	.byte	0x57
+	.byte	0x13
+	.long	0x3ecb
+	.uleb128 0x1
+	.long	0xeb1
+	.long	.LLST531
+	.long	.LVUS531
+	.uleb128 0x1
+	.long	0xea4
+	.long	.LLST532
+	.long	.LVUS532
+	.byte	0
+	.uleb128 0x6
+	.long	0xe94
+	.quad	.LBI2560
+	.value	.LVU1166
+	.quad	.LBB2560
+	.quad	.LBE2560-.LBB2560
+	.byte	0x57
+	.byte	0x13
+	.long	0x3efb
+	.uleb128 0x2
+	.long	0xeb1
+	.uleb128 0x2
+	.long	0xea4
+	.byte	0
+	.uleb128 0x4
+	.long	0xe3e
+	.quad	.LBI2562
+	.value	.LVU1171
+	.long	.LLRL533
+	.byte	0x57
+	.byte	0x44
+	.long	0x3f2f
+	.uleb128 0x1
+	.long	0xe5b
+	.long	.LLST534
+	.long	.LVUS534
+	.uleb128 0x1
+	.long	0xe4e
+	.long	.LLST535
+	.long	.LVUS535
+	.byte	0
+	.uleb128 0x4
+	.long	0xd27
+	.quad	.LBI2565
+	.value	.LVU1174
+	.long	.LLRL536
+	.byte	0x57
+	.byte	0x44
+	.long	0x3f63
+	.uleb128 0x1
+	.long	0xd44
+	.long	.LLST537
+	.long	.LVUS537
+	.uleb128 0x1
+	.long	0xd37
+	.long	.LLST538
+	.long	.LVUS538
+	.byte	0
+	.uleb128 0x6
+	.long	0xe94
+	.quad	.LBI2570
+	.value	.LVU1183
+	.quad	.LBB2570
+	.quad	.LBE2570-.LBB2570
+	.byte	0x57
+	.byte	0x75
+	.long	0x3fa3
+	.uleb128 0x1
+	.long	0xeb1
+	.long	.LLST539
+	.long	.LVUS539
+	.uleb128 0x1
+	.long	0xea4
+	.long	.LLST540
+	.long	.LVUS540
+	.byte	0
+	.uleb128 0x4
+	.long	0xe3e
+	.quad	.LBI2572
+	.value	.LVU1188
+	.long	.LLRL541
+	.byte	0x57
+	.byte	0x93
+	.long	0x3fd7
+	.uleb128 0x1
+	.long	0xe5b
+	.long	.LLST542
+	.long	.LVUS542
+	.uleb128 0x1
+	.long	0xe4e
+	.long	.LLST543
+	.long	.LVUS543
+	.byte	0
+	.uleb128 0x4
+	.long	0xd27
+	.quad	.LBI2575
+	.value	.LVU1191
+	.long	.LLRL544
+	.byte	0x57
+	.byte	0x93
+	.long	0x400b
+	.uleb128 0x1
+	.long	0xd44
+	.long	.LLST545
+	.long	.LVUS545
+	.uleb128 0x1
+	.long	0xd37
+	.long	.LLST546
+	.long	.LVUS546
+	.byte	0
+	.uleb128 0x6
+	.long	0xe94
+	.quad	.LBI2580
+	.value	.LVU1198
+	.quad	.LBB2580
+	.quad	.LBE2580-.LBB2580
+	.byte	0x57
+	.byte	0xc4
+	.long	0x404b
+	.uleb128 0x1
+	.long	0xeb1
+	.long	.LLST547
+	.long	.LVUS547
+	.uleb128 0x1
+	.long	0xea4
+	.long	.LLST548
+	.long	.LVUS548
+	.byte	0
+	.uleb128 0x6
+	.long	0xe94
+	.quad	.LBI2582
+	.value	.LVU1201
+	.quad	.LBB2582
+	.quad	.LBE2582-.LBB2582
+	.byte	0x57
+	.byte	0xc4
+	.long	0x4083
+	.uleb128 0x1
+	.long	0xeb1
+	.long	.LLST549
+	.long	.LVUS549
+	.uleb128 0x2
+	.long	0xea4
+	.byte	0
+	.uleb128 0x4
+	.long	0xe3e
+	.quad	.LBI2584
+	.value	.LVU1207
+	.long	.LLRL550
+	.byte	0x57
+	.byte	0xf5
+	.long	0x40b7
+	.uleb128 0x1
+	.long	0xe5b
+	.long	.LLST551
+	.long	.LVUS551
+	.uleb128 0x1
+	.long	0xe4e
+	.long	.LLST552
+	.long	.LVUS552
+	.byte	0
+	.uleb128 0x4
+	.long	0xd27
+	.quad	.LBI2587
+	.value	.LVU1210
+	.long	.LLRL553
+	.byte	0x57
+	.byte	0xf5
+	.long	0x40eb
+	.uleb128 0x1
+	.long	0xd44
+	.long	.LLST554
+	.long	.LVUS554
+	.uleb128 0x1
+	.long	0xd37
+	.long	.LLST555
+	.long	.LVUS555
+	.byte	0
+	.uleb128 0x3
+	.long	0xe94
+	.quad	.LBI2592
+	.value	.LVU1218
+	.long	.LLRL556
+	.byte	0x57
+	.value	0x125
+	.long	0x4120
+	.uleb128 0x1
+	.long	0xeb1
+	.long	.LLST557
+	.long	.LVUS557
+	.uleb128 0x1
+	.long	0xea4
+	.long	.LLST558
+	.long	.LVUS558
+	.byte	0
+	.uleb128 0x3
+	.long	0xe3e
+	.quad	.LBI2596
+	.value	.LVU1226
+	.long	.LLRL559
+	.byte	0x57
+	.value	0x143
+	.long	0x4155
+	.uleb128 0x1
+	.long	0xe5b
+	.long	.LLST560
+	.long	.LVUS560
+	.uleb128 0x1
+	.long	0xe4e
+	.long	.LLST561
+	.long	.LVUS561
+	.byte	0
+	.uleb128 0x3
+	.long	0xd27
+	.quad	.LBI2599
+	.value	.LVU1229
+	.long	.LLRL562
+	.byte	0x57
+	.value	0x143
+	.long	0x418a
+	.uleb128 0x1
+	.long	0xd44
+	.long	.LLST563
+	.long	.LVUS563
+	.uleb128 0x1
+	.long	0xd37
+	.long	.LLST564
+	.long	.LVUS564
+	.byte	0
+	.uleb128 0x4
+	.long	0xe14
+	.quad	.LBI2602
+	.value	.LVU1250
+	.long	.LLRL565
+	.byte	0x57
+	.byte	0xc
+	.long	0x41b6
+	.uleb128 0x1
+	.long	0xe31
+	.long	.LLST566
+	.long	.LVUS566
+	.uleb128 0x2
+	.long	0xe24
+	.byte	0
+	.uleb128 0x4
+	.long	0xe14
+	.quad	.LBI2606
+	.value	.LVU1246
+	.long	.LLRL567
+	.byte	0x57
+	.byte	0xc
+	.long	0x41e2
+	.uleb128 0x1
+	.long	0xe31
+	.long	.LLST568
+	.long	.LVUS568
+	.uleb128 0x2
+	.long	0xe24
+	.byte	0
+	.uleb128 0x12
+	.long	0xe14
+	.quad	.LBI2610
+	.value	.LVU1241
+	.quad	.LBB2610
+	.quad	.LBE2610-.LBB2610
+	.byte	0x57
+	.uleb128 0x1
+	.long	0xe31
+	.long	.LLST569
+	.long	.LVUS569
+	.uleb128 0x1
+	.long	0xe24
+	.long	.LLST570
+	.long	.LVUS570
+	.byte	0
+	.byte	0
+	.uleb128 0x10
+	.long	0xcbd
+	.long	.LLRL571
+	.long	0x4a76
+	.uleb128 0x9
+	.long	0xcc2
+	.uleb128 0x9
+	.long	0xccc
+	.uleb128 0x4
+	.long	0xd52
+	.quad	.LBI2625
+	.value	.LVU1261
+	.long	.LLRL572
+	.byte	0x58
+	.byte	0x84
+	.long	0x426e
+	.uleb128 0x1
+	.long	0xd7c
+	.long	.LLST573
+	.long	.LVUS573
+	.uleb128 0x2
+	.long	0xd6f
+	.uleb128 0x1
+	.long	0xd62
+	.long	.LLST574
+	.long	.LVUS574
+	.byte	0
+	.uleb128 0x3
+	.long	0xdb5
+	.quad	.LBI2630
+	.value	.LVU1273
+	.long	.LLRL575
+	.byte	0x58
+	.value	0x130
+	.long	0x428e
+	.uleb128 0x2
+	.long	0xdc5
+	.byte	0
+	.uleb128 0x3
+	.long	0xd8a
+	.quad	.LBI2633
+	.value	.LVU1277
+	.long	.LLRL576
+	.byte	0x58
+	.value	0x151
+	.long	0x42bb
+	.uleb128 0x1
+	.long	0xda7
+	.long	.LLST577
+	.long	.LVUS577
+	.uleb128 0x2
+	.long	0xd9a
+	.byte	0
+	.uleb128 0x4
+	.long	0xd52
+	.quad	.LBI2636
+	.value	.LVU1257
+	.long	.LLRL578
+	.byte	0x58
+	.byte	0x1f
+	.long	0x42f4
+	.uleb128 0x1
+	.long	0xd7c
+	.long	.LLST579
+	.long	.LVUS579
+	.uleb128 0x2
+	.long	0xd6f
+	.uleb128 0x1
+	.long	0xd62
+	.long	.LLST580
+	.long	.LVUS580
+	.byte	0
+	.uleb128 0x4
+	.long	0xdb5
+	.quad	.LBI2641
+	.value	.LVU1265
+	.long	.LLRL581
+	.byte	0x58
+	.byte	0xe9
+	.long	0x4313
+	.uleb128 0x2
+	.long	0xdc5
+	.byte	0
+	.uleb128 0x3
+	.long	0xd8a
+	.quad	.LBI2644
+	.value	.LVU1269
+	.long	.LLRL582
+	.byte	0x58
+	.value	0x10a
+	.long	0x4340
+	.uleb128 0x1
+	.long	0xda7
+	.long	.LLST583
+	.long	.LVUS583
+	.uleb128 0x2
+	.long	0xd9a
+	.byte	0
+	.uleb128 0x5
+	.long	0xe94
+	.quad	.LBI2653
+	.value	.LVU1282
+	.quad	.LBB2653
+	.quad	.LBE2653-.LBB2653
+	.byte	0x58
+	.value	0x17e
+	.long	0x4381
+	.uleb128 0x1
+	.long	0xeb1
+	.long	.LLST584
+	.long	.LVUS584
+	.uleb128 0x1
+	.long	0xea4
+	.long	.LLST585
+	.long	.LVUS585
+	.byte	0
+	.uleb128 0x5
+	.long	0xe94
+	.quad	.LBI2655
+	.value	.LVU1285
+	.quad	.LBB2655
+	.quad	.LBE2655-.LBB2655
+	.byte	0x58
+	.value	0x17e
+	.long	0x43b2
+	.uleb128 0x2
+	.long	0xeb1
+	.uleb128 0x2
+	.long	0xea4
+	.byte	0
+	.uleb128 0x3
+	.long	0xe3e
+	.quad	.LBI2657
+	.value	.LVU1290
+	.long	.LLRL586
+	.byte	0x58
+	.value	0x1af
+	.long	0x43e7
+	.uleb128 0x1
+	.long	0xe5b
+	.long	.LLST587
+	.long	.LVUS587
+	.uleb128 0x1
+	.long	0xe4e
+	.long	.LLST588
+	.long	.LVUS588
+	.byte	0
+	.uleb128 0x3
+	.long	0xd27
+	.quad	.LBI2660
+	.value	.LVU1293
+	.long	.LLRL589
+	.byte	0x58
+	.value	0x1af
+	.long	0x441c
+	.uleb128 0x1
+	.long	0xd44
+	.long	.LLST590
+	.long	.LVUS590
+	.uleb128 0x1
+	.long	0xd37
+	.long	.LLST591
+	.long	.LVUS591
+	.byte	0
+	.uleb128 0x3
+	.long	0xe94
+	.quad	.LBI2665
+	.value	.LVU1301
+	.long	.LLRL592
+	.byte	0x58
+	.value	0x1e0
+	.long	0x4451
+	.uleb128 0x1
+	.long	0xeb1
+	.long	.LLST593
+	.long	.LVUS593
+	.uleb128 0x1
+	.long	0xea4
+	.long	.LLST594
+	.long	.LVUS594
+	.byte	0
+	.uleb128 0x3
+	.long	0xe3e
+	.quad	.LBI2669
+	.value	.LVU1307
+	.long	.LLRL595
+	.byte	0x58
+	.value	0x1fe
+	.long	0x4486
+	.uleb128 0x1
+	.long	0xe5b
+	.long	.LLST596
+	.long	.LVUS596
+	.uleb128 0x1
+	.long	0xe4e
+	.long	.LLST597
+	.long	.LVUS597
+	.byte	0
+	.uleb128 0x3
+	.long	0xd27
+	.quad	.LBI2672
+	.value	.LVU1310
+	.long	.LLRL598
+	.byte	0x58
+	.value	0x1fe
+	.long	0x44bb
+	.uleb128 0x1
+	.long	0xd44
+	.long	.LLST599
+	.long	.LVUS599
+	.uleb128 0x1
+	.long	0xd37
+	.long	.LLST600
+	.long	.LVUS600
+	.byte	0
+	.uleb128 0x5
+	.long	0xe94
+	.quad	.LBI2677
+	.value	.LVU1317
+	.quad	.LBB2677
+	.quad	.LBE2677-.LBB2677
+	.byte	0x58
+	.value	0x22f
+	.long	0x44fc
+	.uleb128 0x1
+	.long	0xeb1
+	.long	.LLST601
+	.long	.LVUS601
+	.uleb128 0x1
+	.long	0xea4
+	.long	.LLST602
+	.long	.LVUS602
+	.byte	0
+	.uleb128 0x5
+	.long	0xe94
+	.quad	.LBI2679
+	.value	.LVU1320
+	.quad	.LBB2679
+	.quad	.LBE2679-.LBB2679
+	.byte	0x58
+	.value	0x22f
+	.long	0x4535
+	.uleb128 0x1
+	.long	0xeb1
+	.long	.LLST603
+	.long	.LVUS603
+	.uleb128 0x2
+	.long	0xea4
+	.byte	0
+	.uleb128 0x3
+	.long	0xe3e
+	.quad	.LBI2681
+	.value	.LVU1326
+	.long	.LLRL604
+	.byte	0x58
+	.value	0x260
+	.long	0x456a
+	.uleb128 0x1
+	.long	0xe5b
+	.long	.LLST605
+	.long	.LVUS605
+	.uleb128 0x1
+	.long	0xe4e
+	.long	.LLST606
+	.long	.LVUS606
+	.byte	0
+	.uleb128 0x3
+	.long	0xd27
+	.quad	.LBI2684
+	.value	.LVU1329
+	.long	.LLRL607
+	.byte	0x58
+	.value	0x260
+	.long	0x459f
+	.uleb128 0x1
+	.long	0xd44
+	.long	.LLST608
+	.long	.LVUS608
+	.uleb128 0x1
+	.long	0xd37
+	.long	.LLST609
+	.long	.LVUS609
+	.byte	0
+	.uleb128 0x5
+	.long	0xe94
+	.quad	.LBI2689
+	.value	.LVU1336
+	.quad	.LBB2689
+	.quad	.LBE2689-.LBB2689
+	.byte	0x58
+	.value	0x290
+	.long	0x45e0
+	.uleb128 0x1
+	.long	0xeb1
+	.long	.LLST610
+	.long	.LVUS610
+	.uleb128 0x1
+	.long	0xea4
+	.long	.LLST611
+	.long	.LVUS611
+	.byte	0
+	.uleb128 0x3
+	.long	0xe3e
+	.quad	.LBI2691
+	.value	.LVU1341
+	.long	.LLRL612
+	.byte	0x58
+	.value	0x2ae
+	.long	0x4615
+	.uleb128 0x1
+	.long	0xe5b
+	.long	.LLST613
+	.long	.LVUS613
+	.uleb128 0x1
+	.long	0xe4e
+	.long	.LLST614
+	.long	.LVUS614
+	.byte	0
+	.uleb128 0x3
+	.long	0xd27
+	.quad	.LBI2694
+	.value	.LVU1344
+	.long	.LLRL615
+	.byte	0x58
+	.value	0x2ae
+	.long	0x464a
+	.uleb128 0x1
+	.long	0xd44
+	.long	.LLST616
+	.long	.LVUS616
+	.uleb128 0x1
+	.long	0xd37
+	.long	.LLST617
+	.long	.LVUS617
+	.byte	0
+	.uleb128 0x4
+	.long	0xe14
+	.quad	.LBI2697
+	.value	.LVU1365
+	.long	.LLRL618
+	.byte	0x58
+	.byte	0xc
+	.long	0x4676
+	.uleb128 0x1
+	.long	0xe31
+	.long	.LLST619
+	.long	.LVUS619
+	.uleb128 0x2
+	.long	0xe24
+	.byte	0
+	.uleb128 0x4
+	.long	0xe14
+	.quad	.LBI2701
+	.value	.LVU1361
+	.long	.LLRL620
+	.byte	0x58
+	.byte	0xc
+	.long	0x46a2
+	.uleb128 0x1
+	.long	0xe31
+	.long	.LLST621
+	.long	.LVUS621
+	.uleb128 0x2
+	.long	0xe24
+	.byte	0
+	.uleb128 0x5
+	.long	0xe14
+	.quad	.LBI2705
+	.value	.LVU1356
+	.quad	.LBB2705
+	.quad	.LBE2705-.LBB2705
+	.byte	0x58
+	.value	0x2e9
+	.long	0x46e3
+	.uleb128 0x1
+	.long	0xe31
+	.long	.LLST622
+	.long	.LVUS622
+	.uleb128 0x1
+	.long	0xe24
+	.long	.LLST623
+	.long	.LVUS623
+	.byte	0
+	.uleb128 0x6
+	.long	0xe94
+	.quad	.LBI2709
+	.value	.LVU1370
+	.quad	.LBB2709
+	.quad	.LBE2709-.LBB2709
+	.byte	0x58
+	.byte	0x13
+	.long	0x4723
+	.uleb128 0x1
+	.long	0xeb1
+	.long	.LLST624
+	.long	.LVUS624
+	.uleb128 0x1
+	.long	0xea4
+	.long	.LLST625
+	.long	.LVUS625
+	.byte	0
+	.uleb128 0x6
+	.long	0xe94
+	.quad	.LBI2711
+	.value	.LVU1373
+	.quad	.LBB2711
+	.quad	.LBE2711-.LBB2711
+	.byte	0x58
+	.byte	0x13
+	.long	0x4753
+	.uleb128 0x2
+	.long	0xeb1
+	.uleb128 0x2
+	.long	0xea4
+	.byte	0
+	.uleb128 0x4
+	.long	0xe3e
+	.quad	.LBI2713
+	.value	.LVU1378
+	.long	.LLRL626
+	.byte	0x58
+	.byte	0x44
+	.long	0x4787
+	.uleb128 0x1
+	.long	0xe5b
+	.long	.LLST627
+	.long	.LVUS627
+	.uleb128 0x1
+	.long	0xe4e
+	.long	.LLST628
+	.long	.LVUS628
+	.byte	0
+	.uleb128 0x4
+	.long	0xd27
+	.quad	.LBI2716
+	.value	.LVU1381
+	.long	.LLRL629
+	.byte	0x58
+	.byte	0x44
+	.long	0x47bb
+	.uleb128 0x1
+	.long	0xd44
+	.long	.LLST630
+	.long	.LVUS630
+	.uleb128 0x1
+	.long	0xd37
+	.long	.LLST631
+	.long	.LVUS631
+	.byte	0
+	.uleb128 0x6
+	.long	0xe94
+	.quad	.LBI2721
+	.value	.LVU1390
+	.quad	.LBB2721
+	.quad	.LBE2721-.LBB2721
+	.byte	0x58
+	.byte	0x75
+	.long	0x47fb
+	.uleb128 0x1
+	.long	0xeb1
+	.long	.LLST632
+	.long	.LVUS632
+	.uleb128 0x1
+	.long	0xea4
+	.long	.LLST633
+	.long	.LVUS633
+	.byte	0
+	.uleb128 0x4
+	.long	0xe3e
+	.quad	.LBI2723
+	.value	.LVU1395
+	.long	.LLRL634
+	.byte	0x58
+	.byte	0x93
+	.long	0x482f
+	.uleb128 0x1
+	.long	0xe5b
+	.long	.LLST635
+	.long	.LVUS635
+	.uleb128 0x1
+	.long	0xe4e
+	.long	.LLST636
+	.long	.LVUS636
+	.byte	0
+	.uleb128 0x4
+	.long	0xd27
+	.quad	.LBI2726
+	.value	.LVU1398
+	.long	.LLRL637
+	.byte	0x58
+	.byte	0x93
+	.long	0x4863
+	.uleb128 0x1
+	.long	0xd44
+	.long	.LLST638
+	.long	.LVUS638
+	.uleb128 0x1
+	.long	0xd37
+	.long	.LLST639
+	.long	.LVUS639
+	.byte	0
+	.uleb128 0x6
+	.long	0xe94
+	.quad	.LBI2731
+	.value	.LVU1405
+	.quad	.LBB2731
+	.quad	.LBE2731-.LBB2731
+	.byte	0x58
+	.byte	0xc4
+	.long	0x48a3
+	.uleb128 0x1
+	.long	0xeb1
+	.long	.LLST640
+	.long	.LVUS640
+	.uleb128 0x1
+	.long	0xea4
+	.long	.LLST641
+	.long	.LVUS641
+	.byte	0
+	.uleb128 0x6
+	.long	0xe94
+	.quad	.LBI2733
+	.value	.LVU1408
+	.quad	.LBB2733
+	.quad	.LBE2733-.LBB2733
+	.byte	0x58
+	.byte	0xc4
+	.long	0x48db
+	.uleb128 0x1
+	.long	0xeb1
+	.long	.LLST642
+	.long	.LVUS642
+	.uleb128 0x2
+	.long	0xea4
+	.byte	0
+	.uleb128 0x4
+	.long	0xe3e
+	.quad	.LBI2735
+	.value	.LVU1414
+	.long	.LLRL643
+	.byte	0x58
+	.byte	0xf5
+	.long	0x490f
+	.uleb128 0x1
+	.long	0xe5b
+	.long	.LLST644
+	.long	.LVUS644
+	.uleb128 0x1
+	.long	0xe4e
+	.long	.LLST645
+	.long	.LVUS645
+	.byte	0
+	.uleb128 0x4
+	.long	0xd27
+	.quad	.LBI2738
+	.value	.LVU1417
+	.long	.LLRL646
+	.byte	0x58
+	.byte	0xf5
+	.long	0x4943
+	.uleb128 0x1
+	.long	0xd44
+	.long	.LLST647
+	.long	.LVUS647
+	.uleb128 0x1
+	.long	0xd37
+	.long	.LLST648
+	.long	.LVUS648
+	.byte	0
+	.uleb128 0x3
+	.long	0xe94
+	.quad	.LBI2743
+	.value	.LVU1425
+	.long	.LLRL649
+	.byte	0x58
+	.value	0x125
+	.long	0x4978
+	.uleb128 0x1
+	.long	0xeb1
+	.long	.LLST650
+	.long	.LVUS650
+	.uleb128 0x1
+	.long	0xea4
+	.long	.LLST651
+	.long	.LVUS651
+	.byte	0
+	.uleb128 0x3
+	.long	0xe3e
+	.quad	.LBI2747
+	.value	.LVU1433
+	.long	.LLRL652
+	.byte	0x58
+	.value	0x143
+	.long	0x49ad
+	.uleb128 0x1
+	.long	0xe5b
+	.long	.LLST653
+	.long	.LVUS653
+	.uleb128 0x1
+	.long	0xe4e
+	.long	.LLST654
+	.long	.LVUS654
+	.byte	0
+	.uleb128 0x3
+	.long	0xd27
+	.quad	.LBI2750
+	.value	.LVU1436
+	.long	.LLRL655
+	.byte	0x58
+	.value	0x143
+	.long	0x49e2
+	.uleb128 0x1
+	.long	0xd44
+	.long	.LLST656
+	.long	.LVUS656
+	.uleb128 0x1
+	.long	0xd37
+	.long	.LLST657
+	.long	.LVUS657
+	.byte	0
+	.uleb128 0x4
+	.long	0xe14
+	.quad	.LBI2753
+	.value	.LVU1457
+	.long	.LLRL658
+	.byte	0x58
+	.byte	0xc
+	.long	0x4a0e
+	.uleb128 0x1
+	.long	0xe31
+	.long	.LLST659
+	.long	.LVUS659
+	.uleb128 0x2
+	.long	0xe24
+	.byte	0
+	.uleb128 0x4
+	.long	0xe14
+	.quad	.LBI2757
+	.value	.LVU1453
+	.long	.LLRL660
+	.byte	0x58
+	.byte	0xc
+	.long	0x4a3a
+	.uleb128 0x1
+	.long	0xe31
+	.long	.LLST661
+	.long	.LVUS661
+	.uleb128 0x2
+	.long	0xe24
+	.byte	0
+	.uleb128 0x12
+	.long	0xe14
+	.quad	.LBI2761
+	.value	.LVU1448
+	.quad	.LBB2761
+	.quad	.LBE2761-.LBB2761
+	.byte	0x58
+	.uleb128 0x1
+	.long	0xe31
+	.long	.LLST662
+	.long	.LVUS662
+	.uleb128 0x1
+	.long	0xe24
+	.long	.LLST663
+	.long	.LVUS663
+	.byte	0
+	.byte	0
+	.uleb128 0x10
+	.long	0xcd7
+	.long	.LLRL664
+	.long	0x52ce
+	.uleb128 0x9
+	.long	0xcdc
+	.uleb128 0x9
+	.long	0xce6
+	.uleb128 0x4
+	.long	0xd52
+	.quad	.LBI2776
+	.value	.LVU1468
+	.long	.LLRL665
+	.byte	0x59
+	.byte	0x84
+	.long	0x4ac6
+	.uleb128 0x1
+	.long	0xd7c
+	.long	.LLST666
+	.long	.LVUS666
+	.uleb128 0x2
+	.long	0xd6f
+	.uleb128 0x1
+	.long	0xd62
+	.long	.LLST667
+	.long	.LVUS667
+	.byte	0
+	.uleb128 0x3
+	.long	0xdb5
+	.quad	.LBI2781
+	.value	.LVU1480
+	.long	.LLRL668
+	.byte	0x59
+	.value	0x130
+	.long	0x4ae6
+	.uleb128 0x2
+	.long	0xdc5
+	.byte	0
+	.uleb128 0x3
+	.long	0xd8a
+	.quad	.LBI2784
+	.value	.LVU1484
+	.long	.LLRL669
+	.byte	0x59
+	.value	0x151
+	.long	0x4b13
+	.uleb128 0x1
+	.long	0xda7
+	.long	.LLST670
+	.long	.LVUS670
+	.uleb128 0x2
+	.long	0xd9a
+	.byte	0
+	.uleb128 0x4
+	.long	0xd52
+	.quad	.LBI2787
+	.value	.LVU1464
+	.long	.LLRL671
+	.byte	0x59
+	.byte	0x1f
+	.long	0x4b4c
+	.uleb128 0x1
+	.long	0xd7c
+	.long	.LLST672
+	.long	.LVUS672
+	.uleb128 0x2
+	.long	0xd6f
+	.uleb128 0x1
+	.long	0xd62
+	.long	.LLST673
+	.long	.LVUS673
+	.byte	0
+	.uleb128 0x4
+	.long	0xdb5
+	.quad	.LBI2792
+	.value	.LVU1472
+	.long	.LLRL674
+	.byte	0x59
+	.byte	0xe9
+	.long	0x4b6b
+	.uleb128 0x2
+	.long	0xdc5
+	.byte	0
+	.uleb128 0x3
+	.long	0xd8a
+	.quad	.LBI2795
+	.value	.LVU1476
+	.long	.LLRL675
+	.byte	0x59
+	.value	0x10a
+	.long	0x4b98
+	.uleb128 0x1
+	.long	0xda7
+	.long	.LLST676
+	.long	.LVUS676
+	.uleb128 0x2
+	.long	0xd9a
+	.byte	0
+	.uleb128 0x5
+	.long	0xe94
+	.quad	.LBI2804
+	.value	.LVU1489
+	.quad	.LBB2804
+	.quad	.LBE2804-.LBB2804
+	.byte	0x59
+	.value	0x17e
+	.long	0x4bd9
+	.uleb128 0x1
+	.long	0xeb1
+	.long	.LLST677
+	.long	.LVUS677
+	.uleb128 0x1
+	.long	0xea4
+	.long	.LLST678
+	.long	.LVUS678
+	.byte	0
+	.uleb128 0x5
+	.long	0xe94
+	.quad	.LBI2806
+	.value	.LVU1492
+	.quad	.LBB2806
+	.quad	.LBE2806-.LBB2806
+	.byte	0x59
+	.value	0x17e
+	.long	0x4c0a
+	.uleb128 0x2
+	.long	0xeb1
+	.uleb128 0x2
+	.long	0xea4
+	.byte	0
+	.uleb128 0x3
+	.long	0xe3e
+	.quad	.LBI2808
+	.value	.LVU1497
+	.long	.LLRL679
+	.byte	0x59
+	.value	0x1af
+	.long	0x4c3f
+	.uleb128 0x1
+	.long	0xe5b
+	.long	.LLST680
+	.long	.LVUS680
+	.uleb128 0x1
+	.long	0xe4e
+	.long	.LLST681
+	.long	.LVUS681
+	.byte	0
+	.uleb128 0x3
+	.long	0xd27
+	.quad	.LBI2811
+	.value	.LVU1500
+	.long	.LLRL682
+	.byte	0x59
+	.value	0x1af
+	.long	0x4c74
+	.uleb128 0x1
+	.long	0xd44
+	.long	.LLST683
+	.long	.LVUS683
+	.uleb128 0x1
+	.long	0xd37
+	.long	.LLST684
+	.long	.LVUS684
+	.byte	0
+	.uleb128 0x5
+	.long	0xe94
+	.quad	.LBI2816
+	.value	.LVU1507
+	.quad	.LBB2816
+	.quad	.LBE2816-.LBB2816
+	.byte	0x59
+	.value	0x1e0
+	.long	0x4cb5
+	.uleb128 0x1
+	.long	0xeb1
+	.long	.LLST685
+	.long	.LVUS685
+	.uleb128 0x1
+	.long	0xea4
+	.long	.LLST686
+	.long	.LVUS686
+	.byte	0
+	.uleb128 0x3
+	.long	0xe3e
+	.quad	.LBI2818
+	.value	.LVU1512
+	.long	.LLRL687
+	.byte	0x59
+	.value	0x1fe
+	.long	0x4cea
+	.uleb128 0x1
+	.long	0xe5b
+	.long	.LLST688
+	.long	.LVUS688
+	.uleb128 0x1
+	.long	0xe4e
+	.long	.LLST689
+	.long	.LVUS689
+	.byte	0
+	.uleb128 0x3
+	.long	0xd27
+	.quad	.LBI2821
+	.value	.LVU1515
+	.long	.LLRL690
+	.byte	0x59
+	.value	0x1fe
+	.long	0x4d1f
+	.uleb128 0x1
+	.long	0xd44
+	.long	.LLST691
+	.long	.LVUS691
+	.uleb128 0x1
+	.long	0xd37
+	.long	.LLST692
+	.long	.LVUS692
+	.byte	0
+	.uleb128 0x5
+	.long	0xe94
+	.quad	.LBI2826
+	.value	.LVU1522
+	.quad	.LBB2826
+	.quad	.LBE2826-.LBB2826
+	.byte	0x59
+	.value	0x22f
+	.long	0x4d60
+	.uleb128 0x1
+	.long	0xeb1
+	.long	.LLST693
+	.long	.LVUS693
+	.uleb128 0x1
+	.long	0xea4
+	.long	.LLST694
+	.long	.LVUS694
+	.byte	0
+	.uleb128 0x5
+	.long	0xe94
+	.quad	.LBI2828
+	.value	.LVU1525
+	.quad	.LBB2828
+	.quad	.LBE2828-.LBB2828
+	.byte	0x59
+	.value	0x22f
+	.long	0x4d99
+	.uleb128 0x1
+	.long	0xeb1
+	.long	.LLST695
+	.long	.LVUS695
+	.uleb128 0x2
+	.long	0xea4
+	.byte	0
+	.uleb128 0x3
+	.long	0xe3e
+	.quad	.LBI2830
+	.value	.LVU1531
+	.long	.LLRL696
+	.byte	0x59
+	.value	0x260
+	.long	0x4dce
+	.uleb128 0x1
+	.long	0xe5b
+	.long	.LLST697
+	.long	.LVUS697
+	.uleb128 0x1
+	.long	0xe4e
+	.long	.LLST698
+	.long	.LVUS698
+	.byte	0
+	.uleb128 0x3
+	.long	0xd27
+	.quad	.LBI2833
+	.value	.LVU1534
+	.long	.LLRL699
+	.byte	0x59
+	.value	0x260
+	.long	0x4e03
+	.uleb128 0x1
+	.long	0xd44
+	.long	.LLST700
+	.long	.LVUS700
+	.uleb128 0x1
+	.long	0xd37
+	.long	.LLST701
+	.long	.LVUS701
+	.byte	0
+	.uleb128 0x3
+	.long	0xe94
+	.quad	.LBI2838
+	.value	.LVU1542
+	.long	.LLRL702
+	.byte	0x59
+	.value	0x290
+	.long	0x4e38
+	.uleb128 0x1
+	.long	0xeb1
+	.long	.LLST703
+	.long	.LVUS703
+	.uleb128 0x1
+	.long	0xea4
+	.long	.LLST704
+	.long	.LVUS704
+	.byte	0
+	.uleb128 0x3
+	.long	0xe3e
+	.quad	.LBI2842
+	.value	.LVU1548
+	.long	.LLRL705
+	.byte	0x59
+	.value	0x2ae
+	.long	0x4e6d
+	.uleb128 0x1
+	.long	0xe5b
+	.long	.LLST706
+	.long	.LVUS706
+	.uleb128 0x1
+	.long	0xe4e
+	.long	.LLST707
+	.long	.LVUS707
+	.byte	0
+	.uleb128 0x3
+	.long	0xd27
+	.quad	.LBI2845
+	.value	.LVU1551
+	.long	.LLRL708
+	.byte	0x59
+	.value	0x2ae
+	.long	0x4ea2
+	.uleb128 0x1
+	.long	0xd44
+	.long	.LLST709
+	.long	.LVUS709
+	.uleb128 0x1
+	.long	0xd37
+	.long	.LLST710
+	.long	.LVUS710
+	.byte	0
+	.uleb128 0x4
+	.long	0xe14
+	.quad	.LBI2848
+	.value	.LVU1572
+	.long	.LLRL711
+	.byte	0x59
+	.byte	0xc
+	.long	0x4ece
+	.uleb128 0x1
+	.long	0xe31
+	.long	.LLST712
+	.long	.LVUS712
+	.uleb128 0x2
+	.long	0xe24
+	.byte	0
+	.uleb128 0x4
+	.long	0xe14
+	.quad	.LBI2852
+	.value	.LVU1568
+	.long	.LLRL713
+	.byte	0x59
+	.byte	0xc
+	.long	0x4efa
+	.uleb128 0x1
+	.long	0xe31
+	.long	.LLST714
+	.long	.LVUS714
+	.uleb128 0x2
+	.long	0xe24
+	.byte	0
+	.uleb128 0x5
+	.long	0xe14
+	.quad	.LBI2856
+	.value	.LVU1563
+	.quad	.LBB2856
+	.quad	.LBE2856-.LBB2856
+	.byte	0x59
+	.value	0x2e9
+	.long	0x4f3b
+	.uleb128 0x1
+	.long	0xe31
+	.long	.LLST715
+	.long	.LVUS715
+	.uleb128 0x1
+	.long	0xe24
+	.long	.LLST716
+	.long	.LVUS716
+	.byte	0
+	.uleb128 0x6
+	.long	0xe94
+	.quad	.LBI2860
+	.value	.LVU1577
+	.quad	.LBB2860
+	.quad	.LBE2860-.LBB2860
+	.byte	0x59
+	.byte	0x13
+	.long	0x4f7b
+	.uleb128 0x1
+	.long	0xeb1
+	.long	.LLST717
+	.long	.LVUS717
+	.uleb128 0x1
+	.long	0xea4
+	.long	.LLST718
+	.long	.LVUS718
+	.byte	0
+	.uleb128 0x6
+	.long	0xe94
+	.quad	.LBI2862
+	.value	.LVU1580
+	.quad	.LBB2862
+	.quad	.LBE2862-.LBB2862
+	.byte	0x59
+	.byte	0x13
+	.long	0x4fab
+	.uleb128 0x2
+	.long	0xeb1
+	.uleb128 0x2
+	.long	0xea4
+	.byte	0
+	.uleb128 0x4
+	.long	0xe3e
+	.quad	.LBI2864
+	.value	.LVU1585
+	.long	.LLRL719
+	.byte	0x59
+	.byte	0x44
+	.long	0x4fdf
+	.uleb128 0x1
+	.long	0xe5b
+	.long	.LLST720
+	.long	.LVUS720
+	.uleb128 0x1
+	.long	0xe4e
+	.long	.LLST721
+	.long	.LVUS721
+	.byte	0
+	.uleb128 0x4
+	.long	0xd27
+	.quad	.LBI2867
+	.value	.LVU1588
+	.long	.LLRL722
+	.byte	0x59
+	.byte	0x44
+	.long	0x5013
+	.uleb128 0x1
+	.long	0xd44
+	.long	.LLST723
+	.long	.LVUS723
+	.uleb128 0x1
+	.long	0xd37
+	.long	.LLST724
+	.long	.LVUS724
+	.byte	0
+	.uleb128 0x6
+	.long	0xe94
+	.quad	.LBI2872
+	.value	.LVU1597
+	.quad	.LBB2872
+	.quad	.LBE2872-.LBB2872
+	.byte	0x59
+	.byte	0x75
+	.long	0x5053
+	.uleb128 0x1
+	.long	0xeb1
+	.long	.LLST725
+	.long	.LVUS725
+	.uleb128 0x1
+	.long	0xea4
+	.long	.LLST726
+	.long	.LVUS726
+	.byte	0
+	.uleb128 0x4
+	.long	0xe3e
+	.quad	.LBI2874
+	.value	.LVU1602
+	.long	.LLRL727
+	.byte	0x59
+	.byte	0x93
+	.long	0x5087
+	.uleb128 0x1
+	.long	0xe5b
+	.long	.LLST728
+	.long	.LVUS728
+	.uleb128 0x1
+	.long	0xe4e
+	.long	.LLST729
+	.long	.LVUS729
+	.byte	0
+	.uleb128 0x4
+	.long	0xd27
+	.quad	.LBI2877
+	.value	.LVU1605
+	.long	.LLRL730
+	.byte	0x59
+	.byte	0x93
+	.long	0x50bb
+	.uleb128 0x1
+	.long	0xd44
+	.long	.LLST731
+	.long	.LVUS731
+	.uleb128 0x1
+	.long	0xd37
+	.long	.LLST732
+	.long	.LVUS732
+	.byte	0
+	.uleb128 0x6
+	.long	0xe94
+	.quad	.LBI2882
+	.value	.LVU1612
+	.quad	.LBB2882
+	.quad	.LBE2882-.LBB2882
+	.byte	0x59
+	.byte	0xc4
+	.long	0x50fb
+	.uleb128 0x1
+	.long	0xeb1
+	.long	.LLST733
+	.long	.LVUS733
+	.uleb128 0x1
+	.long	0xea4
+	.long	.LLST734
+	.long	.LVUS734
+	.byte	0
+	.uleb128 0x6
+	.long	0xe94
+	.quad	.LBI2884
+	.value	.LVU1615
+	.quad	.LBB2884
+	.quad	.LBE2884-.LBB2884
+	.byte	0x59
+	.byte	0xc4
+	.long	0x5133
+	.uleb128 0x1
+	.long	0xeb1
+	.long	.LLST735
+	.long	.LVUS735
+	.uleb128 0x2
+	.long	0xea4
+	.byte	0
+	.uleb128 0x4
+	.long	0xe3e
+	.quad	.LBI2886
+	.value	.LVU1621
+	.long	.LLRL736
+	.byte	0x59
+	.byte	0xf5
+	.long	0x5167
+	.uleb128 0x1
+	.long	0xe5b
+	.long	.LLST737
+	.long	.LVUS737
+	.uleb128 0x1
+	.long	0xe4e
+	.long	.LLST738
+	.long	.LVUS738
+	.byte	0
+	.uleb128 0x4
+	.long	0xd27
+	.quad	.LBI2889
+	.value	.LVU1624
+	.long	.LLRL739
+	.byte	0x59
+	.byte	0xf5
+	.long	0x519b
+	.uleb128 0x1
+	.long	0xd44
+	.long	.LLST740
+	.long	.LVUS740
+	.uleb128 0x1
+	.long	0xd37
+	.long	.LLST741
+	.long	.LVUS741
+	.byte	0
+	.uleb128 0x3
+	.long	0xe94
+	.quad	.LBI2894
+	.value	.LVU1632
+	.long	.LLRL742
+	.byte	0x59
+	.value	0x125
+	.long	0x51d0
+	.uleb128 0x1
+	.long	0xeb1
+	.long	.LLST743
+	.long	.LVUS743
+	.uleb128 0x1
+	.long	0xea4
+	.long	.LLST744
+	.long	.LVUS744
+	.byte	0
+	.uleb128 0x3
+	.long	0xe3e
+	.quad	.LBI2898
+	.value	.LVU1640
+	.long	.LLRL745
+	.byte	0x59
+	.value	0x143
+	.long	0x5205
+	.uleb128 0x1
+	.long	0xe5b
+	.long	.LLST746
+	.long	.LVUS746
+	.uleb128 0x1
+	.long	0xe4e
+	.long	.LLST747
+	.long	.LVUS747
+	.byte	0
+	.uleb128 0x3
+	.long	0xd27
+	.quad	.LBI2901
+	.value	.LVU1643
+	.long	.LLRL748
+	.byte	0x59
+	.value	0x143
+	.long	0x523a
+	.uleb128 0x1
+	.long	0xd44
+	.long	.LLST749
+	.long	.LVUS749
+	.uleb128 0x1
+	.long	0xd37
+	.long	.LLST750
+	.long	.LVUS750
+	.byte	0
+	.uleb128 0x4
+	.long	0xe14
+	.quad	.LBI2904
+	.value	.LVU1664
+	.long	.LLRL751
+	.byte	0x59
+	.byte	0xc
+	.long	0x5266
+	.uleb128 0x1
+	.long	0xe31
+	.long	.LLST752
+	.long	.LVUS752
+	.uleb128 0x2
+	.long	0xe24
+	.byte	0
+	.uleb128 0x4
+	.long	0xe14
+	.quad	.LBI2908
+	.value	.LVU1660
+	.long	.LLRL753
+	.byte	0x59
+	.byte	0xc
+	.long	0x5292
+	.uleb128 0x1
+	.long	0xe31
+	.long	.LLST754
+	.long	.LVUS754
+	.uleb128 0x2
+	.long	0xe24
+	.byte	0
+	.uleb128 0x12
+	.long	0xe14
+	.quad	.LBI2912
+	.value	.LVU1655
+	.quad	.LBB2912
+	.quad	.LBE2912-.LBB2912
+	.byte	0x59
+	.uleb128 0x1
+	.long	0xe31
+	.long	.LLST755
+	.long	.LVUS755
+	.uleb128 0x1
+	.long	0xe24
+	.long	.LLST756
+	.long	.LVUS756
+	.byte	0
+	.byte	0
+	.uleb128 0x10
+	.long	0xcf1
+	.long	.LLRL757
+	.long	0x5b26
+	.uleb128 0x9
+	.long	0xcf6
+	.uleb128 0x9
+	.long	0xd00
+	.uleb128 0x4
+	.long	0xd52
+	.quad	.LBI2927
+	.value	.LVU1675
+	.long	.LLRL758
+	.byte	0x5a
+	.byte	0x84
+	.long	0x531e
+	.uleb128 0x1
+	.long	0xd7c
+	.long	.LLST759
+	.long	.LVUS759
+	.uleb128 0x2
+	.long	0xd6f
+	.uleb128 0x1
+	.long	0xd62
+	.long	.LLST760
+	.long	.LVUS760
+	.byte	0
+	.uleb128 0x3
+	.long	0xdb5
+	.quad	.LBI2932
+	.value	.LVU1687
+	.long	.LLRL761
+	.byte	0x5a
+	.value	0x130
+	.long	0x533e
+	.uleb128 0x2
+	.long	0xdc5
+	.byte	0
+	.uleb128 0x3
+	.long	0xd8a
+	.quad	.LBI2935
+	.value	.LVU1691
+	.long	.LLRL762
+	.byte	0x5a
+	.value	0x151
+	.long	0x536b
+	.uleb128 0x1
+	.long	0xda7
+	.long	.LLST763
+	.long	.LVUS763
+	.uleb128 0x2
+	.long	0xd9a
+	.byte	0
+	.uleb128 0x4
+	.long	0xd52
+	.quad	.LBI2938
+	.value	.LVU1671
+	.long	.LLRL764
+	.byte	0x5a
+	.byte	0x1f
+	.long	0x53a4
+	.uleb128 0x1
+	.long	0xd7c
+	.long	.LLST765
+	.long	.LVUS765
+	.uleb128 0x2
+	.long	0xd6f
+	.uleb128 0x1
+	.long	0xd62
+	.long	.LLST766
+	.long	.LVUS766
+	.byte	0
+	.uleb128 0x4
+	.long	0xdb5
+	.quad	.LBI2943
+	.value	.LVU1679
+	.long	.LLRL767
+	.byte	0x5a
+	.byte	0xe9
+	.long	0x53c3
+	.uleb128 0x2
+	.long	0xdc5
+	.byte	0
+	.uleb128 0x3
+	.long	0xd8a
+	.quad	.LBI2946
+	.value	.LVU1683
+	.long	.LLRL768
+	.byte	0x5a
+	.value	0x10a
+	.long	0x53f0
+	.uleb128 0x1
+	.long	0xda7
+	.long	.LLST769
+	.long	.LVUS769
+	.uleb128 0x2
+	.long	0xd9a
+	.byte	0
+	.uleb128 0x5
+	.long	0xe94
+	.quad	.LBI2955
+	.value	.LVU1696
+	.quad	.LBB2955
+	.quad	.LBE2955-.LBB2955
+	.byte	0x5a
+	.value	0x17e
+	.long	0x5431
+	.uleb128 0x1
+	.long	0xeb1
+	.long	.LLST770
+	.long	.LVUS770
+	.uleb128 0x1
+	.long	0xea4
+	.long	.LLST771
+	.long	.LVUS771
+	.byte	0
+	.uleb128 0x5
+	.long	0xe94
+	.quad	.LBI2957
+	.value	.LVU1699
+	.quad	.LBB2957
+	.quad	.LBE2957-.LBB2957
+	.byte	0x5a
+	.value	0x17e
+	.long	0x5462
+	.uleb128 0x2
+	.long	0xeb1
+	.uleb128 0x2
+	.long	0xea4
+	.byte	0
+	.uleb128 0x3
+	.long	0xe3e
+	.quad	.LBI2959
+	.value	.LVU1704
+	.long	.LLRL772
+	.byte	0x5a
+	.value	0x1af
+	.long	0x5497
+	.uleb128 0x1
+	.long	0xe5b
+	.long	.LLST773
+	.long	.LVUS773
+	.uleb128 0x1
+	.long	0xe4e
+	.long	.LLST774
+	.long	.LVUS774
+	.byte	0
+	.uleb128 0x3
+	.long	0xd27
+	.quad	.LBI2962
+	.value	.LVU1707
+	.long	.LLRL775
+	.byte	0x5a
+	.value	0x1af
+	.long	0x54cc
+	.uleb128 0x1
+	.long	0xd44
+	.long	.LLST776
+	.long	.LVUS776
+	.uleb128 0x1
+	.long	0xd37
+	.long	.LLST777
+	.long	.LVUS777
+	.byte	0
+	.uleb128 0x5
+	.long	0xe94
+	.quad	.LBI2967
+	.value	.LVU1714
+	.quad	.LBB2967
+	.quad	.LBE2967-.LBB2967
+	.byte	0x5a
+	.value	0x1e0
+	.long	0x550d
+	.uleb128 0x1
+	.long	0xeb1
+	.long	.LLST778
+	.long	.LVUS778
+	.uleb128 0x1
+	.long	0xea4
+	.long	.LLST779
+	.long	.LVUS779
+	.byte	0
+	.uleb128 0x3
+	.long	0xe3e
+	.quad	.LBI2969
+	.value	.LVU1719
+	.long	.LLRL780
+	.byte	0x5a
+	.value	0x1fe
+	.long	0x5542
+	.uleb128 0x1
+	.long	0xe5b
+	.long	.LLST781
+	.long	.LVUS781
+	.uleb128 0x1
+	.long	0xe4e
+	.long	.LLST782
+	.long	.LVUS782
+	.byte	0
+	.uleb128 0x3
+	.long	0xd27
+	.quad	.LBI2972
+	.value	.LVU1722
+	.long	.LLRL783
+	.byte	0x5a
+	.value	0x1fe
+	.long	0x5577
+	.uleb128 0x1
+	.long	0xd44
+	.long	.LLST784
+	.long	.LVUS784
+	.uleb128 0x1
+	.long	0xd37
+	.long	.LLST785
+	.long	.LVUS785
+	.byte	0
+	.uleb128 0x5
+	.long	0xe94
+	.quad	.LBI2977
+	.value	.LVU1729
+	.quad	.LBB2977
+	.quad	.LBE2977-.LBB2977
+	.byte	0x5a
+	.value	0x22f
+	.long	0x55b8
+	.uleb128 0x1
+	.long	0xeb1
+	.long	.LLST786
+	.long	.LVUS786
+	.uleb128 0x1
+	.long	0xea4
+	.long	.LLST787
+	.long	.LVUS787
+	.byte	0
+	.uleb128 0x5
+	.long	0xe94
+	.quad	.LBI2979
+	.value	.LVU1732
+	.quad	.LBB2979
+	.quad	.LBE2979-.LBB2979
+	.byte	0x5a
+	.value	0x22f
+	.long	0x55f1
+	.uleb128 0x1
+	.long	0xeb1
+	.long	.LLST788
+	.long	.LVUS788
+	.uleb128 0x2
+	.long	0xea4
+	.byte	0
+	.uleb128 0x3
+	.long	0xe3e
+	.quad	.LBI2981
+	.value	.LVU1738
+	.long	.LLRL789
+	.byte	0x5a
+	.value	0x260
+	.long	0x5626
+	.uleb128 0x1
+	.long	0xe5b
+	.long	.LLST790
+	.long	.LVUS790
+	.uleb128 0x1
+	.long	0xe4e
+	.long	.LLST791
+	.long	.LVUS791
+	.byte	0
+	.uleb128 0x3
+	.long	0xd27
+	.quad	.LBI2984
+	.value	.LVU1741
+	.long	.LLRL792
+	.byte	0x5a
+	.value	0x260
+	.long	0x565b
+	.uleb128 0x1
+	.long	0xd44
+	.long	.LLST793
+	.long	.LVUS793
+	.uleb128 0x1
+	.long	0xd37
+	.long	.LLST794
+	.long	.LVUS794
+	.byte	0
+	.uleb128 0x3
+	.long	0xe94
+	.quad	.LBI2989
+	.value	.LVU1749
+	.long	.LLRL795
+	.byte	0x5a
+	.value	0x290
+	.long	0x5690
+	.uleb128 0x1
+	.long	0xeb1
+	.long	.LLST796
+	.long	.LVUS796
+	.uleb128 0x1
+	.long	0xea4
+	.long	.LLST797
+	.long	.LVUS797
+	.byte	0
+	.uleb128 0x3
+	.long	0xe3e
+	.quad	.LBI2993
+	.value	.LVU1755
+	.long	.LLRL798
+	.byte	0x5a
+	.value	0x2ae
+	.long	0x56c5
+	.uleb128 0x1
+	.long	0xe5b
+	.long	.LLST799
+	.long	.LVUS799
+	.uleb128 0x1
+	.long	0xe4e
+	.long	.LLST800
+	.long	.LVUS800
+	.byte	0
+	.uleb128 0x3
+	.long	0xd27
+	.quad	.LBI2996
+	.value	.LVU1758
+	.long	.LLRL801
+	.byte	0x5a
+	.value	0x2ae
+	.long	0x56fa
+	.uleb128 0x1
+	.long	0xd44
+	.long	.LLST802
+	.long	.LVUS802
+	.uleb128 0x1
+	.long	0xd37
+	.long	.LLST803
+	.long	.LVUS803
+	.byte	0
+	.uleb128 0x4
+	.long	0xe14
+	.quad	.LBI2999
+	.value	.LVU1779
+	.long	.LLRL804
+	.byte	0x5a
+	.byte	0xc
+	.long	0x5726
+	.uleb128 0x1
+	.long	0xe31
+	.long	.LLST805
+	.long	.LVUS805
+	.uleb128 0x2
+	.long	0xe24
+	.byte	0
+	.uleb128 0x4
+	.long	0xe14
+	.quad	.LBI3003
+	.value	.LVU1775
+	.long	.LLRL806
+	.byte	0x5a
+	.byte	0xc
+	.long	0x5752
+	.uleb128 0x1
+	.long	0xe31
+	.long	.LLST807
+	.long	.LVUS807
+	.uleb128 0x2
+	.long	0xe24
+	.byte	0
+	.uleb128 0x5
+	.long	0xe14
+	.quad	.LBI3007
+	.value	.LVU1770
+	.quad	.LBB3007
+	.quad	.LBE3007-.LBB3007
+	.byte	0x5a
+	.value	0x2e9
+	.long	0x5793
+	.uleb128 0x1
+	.long	0xe31
+	.long	.LLST808
+	.long	.LVUS808
+	.uleb128 0x1
+	.long	0xe24
+	.long	.LLST809
+	.long	.LVUS809
+	.byte	0
+	.uleb128 0x6
+	.long	0xe94
+	.quad	.LBI3011
+	.value	.LVU1784
+	.quad	.LBB3011
+	.quad	.LBE3011-.LBB3011
+	.byte	0x5a
+	.byte	0x13
+	.long	0x57d3
+	.uleb128 0x1
+	.long	0xeb1
+	.long	.LLST810
+	.long	.LVUS810
+	.uleb128 0x1
+	.long	0xea4
+	.long	.LLST811
+	.long	.LVUS811
+	.byte	0
+	.uleb128 0x6
+	.long	0xe94
+	.quad	.LBI3013
+	.value	.LVU1787
+	.quad	.LBB3013
+	.quad	.LBE3013-.LBB3013
+	.byte	0x5a
+	.byte	0x13
+	.long	0x5803
+	.uleb128 0x2
+	.long	0xeb1
+	.uleb128 0x2
+	.long	0xea4
+	.byte	0
+	.uleb128 0x4
+	.long	0xe3e
+	.quad	.LBI3015
+	.value	.LVU1792
+	.long	.LLRL812
+	.byte	0x5a
+	.byte	0x44
+	.long	0x5837
+	.uleb128 0x1
+	.long	0xe5b
+	.long	.LLST813
+	.long	.LVUS813
+	.uleb128 0x1
+	.long	0xe4e
+	.long	.LLST814
+	.long	.LVUS814
+	.byte	0
+	.uleb128 0x4
+	.long	0xd27
+	.quad	.LBI3018
+	.value	.LVU1795
+	.long	.LLRL815
+	.byte	0x5a
+	.byte	0x44
+	.long	0x586b
+	.uleb128 0x1
+	.long	0xd44
+	.long	.LLST816
+	.long	.LVUS816
+	.uleb128 0x1
+	.long	0xd37
+	.long	.LLST817
+	.long	.LVUS817
+	.byte	0
+	.uleb128 0x6
+	.long	0xe94
+	.quad	.LBI3023
+	.value	.LVU1802
+	.quad	.LBB3023
+	.quad	.LBE3023-.LBB3023
+	.byte	0x5a
+	.byte	0x75
+	.long	0x58ab
+	.uleb128 0x1
+	.long	0xeb1
+	.long	.LLST818
+	.long	.LVUS818
+	.uleb128 0x1
+	.long	0xea4
+	.long	.LLST819
+	.long	.LVUS819
+	.byte	0
+	.uleb128 0x4
+	.long	0xe3e
+	.quad	.LBI3025
+	.value	.LVU1807
+	.long	.LLRL820
+	.byte	0x5a
+	.byte	0x93
+	.long	0x58df
+	.uleb128 0x1
+	.long	0xe5b
+	.long	.LLST821
+	.long	.LVUS821
+	.uleb128 0x1
+	.long	0xe4e
+	.long	.LLST822
+	.long	.LVUS822
+	.byte	0
+	.uleb128 0x4
+	.long	0xd27
+	.quad	.LBI3028
+	.value	.LVU1810
+	.long	.LLRL823
+	.byte	0x5a
+	.byte	0x93
+	.long	0x5913
+	.uleb128 0x1
+	.long	0xd44
+	.long	.LLST824
+	.long	.LVUS824
+	.uleb128 0x1
+	.long	0xd37
+	.long	.LLST825
+	.long	.LVUS825
+	.byte	0
+	.uleb128 0x6
+	.long	0xe94
+	.quad	.LBI3033
+	.value	.LVU1817
+	.quad	.LBB3033
+	.quad	.LBE3033-.LBB3033
+	.byte	0x5a
+	.byte	0xc4
+	.long	0x5953
+	.uleb128 0x1
+	.long	0xeb1
+	.long	.LLST826
+	.long	.LVUS826
+	.uleb128 0x1
+	.long	0xea4
+	.long	.LLST827
+	.long	.LVUS827
+	.byte	0
+	.uleb128 0x6
+	.long	0xe94
+	.quad	.LBI3035
+	.value	.LVU1820
+	.quad	.LBB3035
+	.quad	.LBE3035-.LBB3035
+	.byte	0x5a
+	.byte	0xc4
+	.long	0x598b
+	.uleb128 0x1
+	.long	0xeb1
+	.long	.LLST828
+	.long	.LVUS828
+	.uleb128 0x2
+	.long	0xea4
+	.byte	0
+	.uleb128 0x4
+	.long	0xe3e
+	.quad	.LBI3037
+	.value	.LVU1826
+	.long	.LLRL829
+	.byte	0x5a
+	.byte	0xf5
+	.long	0x59bf
+	.uleb128 0x1
+	.long	0xe5b
+	.long	.LLST830
+	.long	.LVUS830
+	.uleb128 0x1
+	.long	0xe4e
+	.long	.LLST831
+	.long	.LVUS831
+	.byte	0
+	.uleb128 0x4
+	.long	0xd27
+	.quad	.LBI3040
+	.value	.LVU1829
+	.long	.LLRL832
+	.byte	0x5a
+	.byte	0xf5
+	.long	0x59f3
+	.uleb128 0x1
+	.long	0xd44
+	.long	.LLST833
+	.long	.LVUS833
+	.uleb128 0x1
+	.long	0xd37
+	.long	.LLST834
+	.long	.LVUS834
+	.byte	0
+	.uleb128 0x3
+	.long	0xe94
+	.quad	.LBI3045
+	.value	.LVU1837
+	.long	.LLRL835
+	.byte	0x5a
+	.value	0x125
+	.long	0x5a28
+	.uleb128 0x1
+	.long	0xeb1
+	.long	.LLST836
+	.long	.LVUS836
+	.uleb128 0x1
+	.long	0xea4
+	.long	.LLST837
+	.long	.LVUS837
+	.byte	0
+	.uleb128 0x3
+	.long	0xe3e
+	.quad	.LBI3049
+	.value	.LVU1846
+	.long	.LLRL838
+	.byte	0x5a
+	.value	0x143
+	.long	0x5a5d
+	.uleb128 0x1
+	.long	0xe5b
+	.long	.LLST839
+	.long	.LVUS839
+	.uleb128 0x1
+	.long	0xe4e
+	.long	.LLST840
+	.long	.LVUS840
+	.byte	0
+	.uleb128 0x3
+	.long	0xd27
+	.quad	.LBI3052
+	.value	.LVU1849
+	.long	.LLRL841
+	.byte	0x5a
+	.value	0x143
+	.long	0x5a92
+	.uleb128 0x1
+	.long	0xd44
+	.long	.LLST842
+	.long	.LVUS842
+	.uleb128 0x1
+	.long	0xd37
+	.long	.LLST843
+	.long	.LVUS843
+	.byte	0
+	.uleb128 0x4
+	.long	0xe14
+	.quad	.LBI3055
+	.value	.LVU1870
+	.long	.LLRL844
+	.byte	0x5a
+	.byte	0xc
+	.long	0x5abe
+	.uleb128 0x1
+	.long	0xe31
+	.long	.LLST845
+	.long	.LVUS845
+	.uleb128 0x2
+	.long	0xe24
+	.byte	0
+	.uleb128 0x4
+	.long	0xe14
+	.quad	.LBI3059
+	.value	.LVU1866
+	.long	.LLRL846
+	.byte	0x5a
+	.byte	0xc
+	.long	0x5aea
+	.uleb128 0x1
+	.long	0xe31
+	.long	.LLST847
+	.long	.LVUS847
+	.uleb128 0x2
+	.long	0xe24
+	.byte	0
+	.uleb128 0x12
+	.long	0xe14
+	.quad	.LBI3063
+	.value	.LVU1861
+	.quad	.LBB3063
+	.quad	.LBE3063-.LBB3063
+	.byte	0x5a
+	.uleb128 0x1
+	.long	0xe31
+	.long	.LLST848
+	.long	.LVUS848
+	.uleb128 0x1
+	.long	0xe24
+	.long	.LLST849
+	.long	.LVUS849
+	.byte	0
+	.byte	0
+	.uleb128 0x10
+	.long	0xd0b
+	.long	.LLRL850
+	.long	0x63b1
+	.uleb128 0x16
+	.long	0xd0c
+	.long	.LLST851
+	.long	.LVUS851
+	.uleb128 0x16
+	.long	0xd16
+	.long	.LLST852
+	.long	.LVUS852
+	.uleb128 0x4
+	.long	0xd52
+	.quad	.LBI3078
+	.value	.LVU1881
+	.long	.LLRL853
+	.byte	0x5b
+	.byte	0x84
+	.long	0x5b76
+	.uleb128 0x2
+	.long	0xd7c
+	.uleb128 0x2
+	.long	0xd6f
+	.uleb128 0x2
+	.long	0xd62
+	.byte	0
+	.uleb128 0x4
+	.long	0xd52
+	.quad	.LBI3083
+	.value	.LVU1877
+	.long	.LLRL854
+	.byte	0x5b
+	.byte	0x1f
+	.long	0x5b9f
+	.uleb128 0x2
+	.long	0xd7c
+	.uleb128 0x2
+	.long	0xd6f
+	.uleb128 0x2
+	.long	0xd62
+	.byte	0
+	.uleb128 0x3
+	.long	0xd8a
+	.quad	.LBI3088
+	.value	.LVU1897
+	.long	.LLRL855
+	.byte	0x5b
+	.value	0x151
+	.long	0x5bd4
+	.uleb128 0x1
+	.long	0xda7
+	.long	.LLST856
+	.long	.LVUS856
+	.uleb128 0x1
+	.long	0xd9a
+	.long	.LLST857
+	.long	.LVUS857
+	.byte	0
+	.uleb128 0x3
+	.long	0xd8a
+	.quad	.LBI3091
+	.value	.LVU1889
+	.long	.LLRL858
+	.byte	0x5b
+	.value	0x10a
+	.long	0x5c09
+	.uleb128 0x1
+	.long	0xda7
+	.long	.LLST859
+	.long	.LVUS859
+	.uleb128 0x1
+	.long	0xd9a
+	.long	.LLST860
+	.long	.LVUS860
+	.byte	0
+	.uleb128 0x6
+	.long	0xdb5
+	.quad	.LBI3096
+	.value	.LVU1885
+	.quad	.LBB3096
+	.quad	.LBE3096-.LBB3096
+	.byte	0x5b
+	.byte	0xe9
+	.long	0x5c3c
+	.uleb128 0x1
+	.long	0xdc5
+	.long	.LLST861
+	.long	.LVUS861
+	.byte	0
+	.uleb128 0x5
+	.long	0xdb5
+	.quad	.LBI3099
+	.value	.LVU1893
+	.quad	.LBB3099
+	.quad	.LBE3099-.LBB3099
+	.byte	0x5b
+	.value	0x130
+	.long	0x5c70
+	.uleb128 0x1
+	.long	0xdc5
+	.long	.LLST862
+	.long	.LVUS862
+	.byte	0
+	.uleb128 0x5
+	.long	0xe94
+	.quad	.LBI3102
+	.value	.LVU1902
+	.quad	.LBB3102
+	.quad	.LBE3102-.LBB3102
+	.byte	0x5b
+	.value	0x17e
+	.long	0x5cb1
+	.uleb128 0x1
+	.long	0xeb1
+	.long	.LLST863
+	.long	.LVUS863
+	.uleb128 0x1
+	.long	0xea4
+	.long	.LLST864
+	.long	.LVUS864
+	.byte	0
+	.uleb128 0x5
+	.long	0xe94
+	.quad	.LBI3104
+	.value	.LVU1905
+	.quad	.LBB3104
+	.quad	.LBE3104-.LBB3104
+	.byte	0x5b
+	.value	0x17e
+	.long	0x5cea
+	.uleb128 0x1
+	.long	0xeb1
+	.long	.LLST865
+	.long	.LVUS865
+	.uleb128 0x2
+	.long	0xea4
+	.byte	0
+	.uleb128 0x3
+	.long	0xe3e
+	.quad	.LBI3106
+	.value	.LVU1910
+	.long	.LLRL866
+	.byte	0x5b
+	.value	0x1af
+	.long	0x5d1f
+	.uleb128 0x1
+	.long	0xe5b
+	.long	.LLST867
+	.long	.LVUS867
+	.uleb128 0x1
+	.long	0xe4e
+	.long	.LLST868
+	.long	.LVUS868
+	.byte	0
+	.uleb128 0x3
+	.long	0xd27
+	.quad	.LBI3109
+	.value	.LVU1913
+	.long	.LLRL869
+	.byte	0x5b
+	.value	0x1af
+	.long	0x5d54
+	.uleb128 0x1
+	.long	0xd44
+	.long	.LLST870
+	.long	.LVUS870
+	.uleb128 0x1
+	.long	0xd37
+	.long	.LLST871
+	.long	.LVUS871
+	.byte	0
+	.uleb128 0x5
+	.long	0xe94
+	.quad	.LBI3114
+	.value	.LVU1920
+	.quad	.LBB3114
+	.quad	.LBE3114-.LBB3114
+	.byte	0x5b
+	.value	0x1e0
+	.long	0x5d95
+	.uleb128 0x1
+	.long	0xeb1
+	.long	.LLST872
+	.long	.LVUS872
+	.uleb128 0x1
+	.long	0xea4
+	.long	.LLST873
+	.long	.LVUS873
+	.byte	0
+	.uleb128 0x3
+	.long	0xe3e
+	.quad	.LBI3116
+	.value	.LVU1925
+	.long	.LLRL874
+	.byte	0x5b
+	.value	0x1fe
+	.long	0x5dca
+	.uleb128 0x1
+	.long	0xe5b
+	.long	.LLST875
+	.long	.LVUS875
+	.uleb128 0x1
+	.long	0xe4e
+	.long	.LLST876
+	.long	.LVUS876
+	.byte	0
+	.uleb128 0x3
+	.long	0xd27
+	.quad	.LBI3119
+	.value	.LVU1928
+	.long	.LLRL877
+	.byte	0x5b
+	.value	0x1fe
+	.long	0x5dff
+	.uleb128 0x1
+	.long	0xd44
+	.long	.LLST878
+	.long	.LVUS878
+	.uleb128 0x1
+	.long	0xd37
+	.long	.LLST879
+	.long	.LVUS879
+	.byte	0
+	.uleb128 0x5
+	.long	0xe94
+	.quad	.LBI3124
+	.value	.LVU1935
+	.quad	.LBB3124
+	.quad	.LBE3124-.LBB3124
+	.byte	0x5b
+	.value	0x22f
+	.long	0x5e40
+	.uleb128 0x1
+	.long	0xeb1
+	.long	.LLST880
+	.long	.LVUS880
+	.uleb128 0x1
+	.long	0xea4
+	.long	.LLST881
+	.long	.LVUS881
+	.byte	0
+	.uleb128 0x5
+	.long	0xe94
+	.quad	.LBI3126
+	.value	.LVU1938
+	.quad	.LBB3126
+	.quad	.LBE3126-.LBB3126
+	.byte	0x5b
+	.value	0x22f
+	.long	0x5e79
+	.uleb128 0x1
+	.long	0xeb1
+	.long	.LLST882
+	.long	.LVUS882
+	.uleb128 0x2
+	.long	0xea4
+	.byte	0
+	.uleb128 0x3
+	.long	0xe3e
+	.quad	.LBI3128
+	.value	.LVU1944
+	.long	.LLRL883
+	.byte	0x5b
+	.value	0x260
+	.long	0x5eae
+	.uleb128 0x1
+	.long	0xe5b
+	.long	.LLST884
+	.long	.LVUS884
+	.uleb128 0x1
+	.long	0xe4e
+	.long	.LLST885
+	.long	.LVUS885
+	.byte	0
+	.uleb128 0x3
+	.long	0xd27
+	.quad	.LBI3131
+	.value	.LVU1947
+	.long	.LLRL886
+	.byte	0x5b
+	.value	0x260
+	.long	0x5ee3
+	.uleb128 0x1
+	.long	0xd44
+	.long	.LLST887
+	.long	.LVUS887
+	.uleb128 0x1
+	.long	0xd37
+	.long	.LLST888
+	.long	.LVUS888
+	.byte	0
+	.uleb128 0x5
+	.long	0xe94
+	.quad	.LBI3136
+	.value	.LVU1954
+	.quad	.LBB3136
+	.quad	.LBE3136-.LBB3136
+	.byte	0x5b
+	.value	0x290
+	.long	0x5f24
+	.uleb128 0x1
+	.long	0xeb1
+	.long	.LLST889
+	.long	.LVUS889
+	.uleb128 0x1
+	.long	0xea4
+	.long	.LLST890
+	.long	.LVUS890
+	.byte	0
+	.uleb128 0x3
+	.long	0xe3e
+	.quad	.LBI3138
+	.value	.LVU1959
+	.long	.LLRL891
+	.byte	0x5b
+	.value	0x2ae
+	.long	0x5f59
+	.uleb128 0x1
+	.long	0xe5b
+	.long	.LLST892
+	.long	.LVUS892
+	.uleb128 0x1
+	.long	0xe4e
+	.long	.LLST893
+	.long	.LVUS893
+	.byte	0
+	.uleb128 0x3
+	.long	0xd27
+	.quad	.LBI3141
+	.value	.LVU1962
+	.long	.LLRL894
+	.byte	0x5b
+	.value	0x2ae
+	.long	0x5f8e
+	.uleb128 0x1
+	.long	0xd44
+	.long	.LLST895
+	.long	.LVUS895
+	.uleb128 0x1
+	.long	0xd37
+	.long	.LLST896
+	.long	.LVUS896
+	.byte	0
+	.uleb128 0x4
+	.long	0xe14
+	.quad	.LBI3144
+	.value	.LVU1983
+	.long	.LLRL897
+	.byte	0x5b
+	.byte	0xc
+	.long	0x5fba
+	.uleb128 0x1
+	.long	0xe31
+	.long	.LLST898
+	.long	.LVUS898
+	.uleb128 0x2
+	.long	0xe24
+	.byte	0
+	.uleb128 0x4
+	.long	0xe14
+	.quad	.LBI3148
+	.value	.LVU1979
+	.long	.LLRL899
+	.byte	0x5b
+	.byte	0xc
+	.long	0x5fe6
+	.uleb128 0x1
+	.long	0xe31
+	.long	.LLST900
+	.long	.LVUS900
+	.uleb128 0x2
+	.long	0xe24
+	.byte	0
+	.uleb128 0x5
+	.long	0xe14
+	.quad	.LBI3152
+	.value	.LVU1974
+	.quad	.LBB3152
+	.quad	.LBE3152-.LBB3152
+	.byte	0x5b
+	.value	0x2e9
+	.long	0x6027
+	.uleb128 0x1
+	.long	0xe31
+	.long	.LLST901
+	.long	.LVUS901
+	.uleb128 0x1
+	.long	0xe24
+	.long	.LLST902
+	.long	.LVUS902
+	.byte	0
+	.uleb128 0x6
+	.long	0xe94
+	.quad	.LBI3156
+	.value	.LVU1988
+	.quad	.LBB3156
+	.quad	.LBE3156-.LBB3156
+	.byte	0x5b
+	.byte	0x13
+	.long	0x6067
+	.uleb128 0x1
+	.long	0xeb1
+	.long	.LLST903
+	.long	.LVUS903
+	.uleb128 0x1
+	.long	0xea4
+	.long	.LLST904
+	.long	.LVUS904
+	.byte	0
+	.uleb128 0x6
+	.long	0xe94
+	.quad	.LBI3158
+	.value	.LVU1991
+	.quad	.LBB3158
+	.quad	.LBE3158-.LBB3158
+	.byte	0x5b
+	.byte	0x13
+	.long	0x609f
+	.uleb128 0x1
+	.long	0xeb1
+	.long	.LLST905
+	.long	.LVUS905
+	.uleb128 0x2
+	.long	0xea4
+	.byte	0
+	.uleb128 0x4
+	.long	0xe3e
+	.quad	.LBI3160
+	.value	.LVU1997
+	.long	.LLRL906
+	.byte	0x5b
+	.byte	0x44
+	.long	0x60d3
+	.uleb128 0x1
+	.long	0xe5b
+	.long	.LLST907
+	.long	.LVUS907
+	.uleb128 0x1
+	.long	0xe4e
+	.long	.LLST908
+	.long	.LVUS908
+	.byte	0
+	.uleb128 0x4
+	.long	0xd27
+	.quad	.LBI3163
+	.value	.LVU2000
+	.long	.LLRL909
+	.byte	0x5b
+	.byte	0x44
+	.long	0x6107
+	.uleb128 0x1
+	.long	0xd44
+	.long	.LLST910
+	.long	.LVUS910
+	.uleb128 0x1
+	.long	0xd37
+	.long	.LLST911
+	.long	.LVUS911
+	.byte	0
+	.uleb128 0x6
+	.long	0xe94
+	.quad	.LBI3168
+	.value	.LVU2007
+	.quad	.LBB3168
+	.quad	.LBE3168-.LBB3168
+	.byte	0x5b
+	.byte	0x75
+	.long	0x6147
+	.uleb128 0x1
+	.long	0xeb1
+	.long	.LLST912
+	.long	.LVUS912
+	.uleb128 0x1
+	.long	0xea4
+	.long	.LLST913
+	.long	.LVUS913
+	.byte	0
+	.uleb128 0x4
+	.long	0xe3e
+	.quad	.LBI3170
+	.value	.LVU2012
+	.long	.LLRL914
+	.byte	0x5b
+	.byte	0x93
+	.long	0x617b
+	.uleb128 0x1
+	.long	0xe5b
+	.long	.LLST915
+	.long	.LVUS915
+	.uleb128 0x1
+	.long	0xe4e
+	.long	.LLST916
+	.long	.LVUS916
+	.byte	0
+	.uleb128 0x4
+	.long	0xd27
+	.quad	.LBI3173
+	.value	.LVU2015
+	.long	.LLRL917
+	.byte	0x5b
+	.byte	0x93
+	.long	0x61af
+	.uleb128 0x1
+	.long	0xd44
+	.long	.LLST918
+	.long	.LVUS918
+	.uleb128 0x1
+	.long	0xd37
+	.long	.LLST919
+	.long	.LVUS919
+	.byte	0
+	.uleb128 0x6
+	.long	0xe94
+	.quad	.LBI3178
+	.value	.LVU2022
+	.quad	.LBB3178
+	.quad	.LBE3178-.LBB3178
+	.byte	0x5b
+	.byte	0xc4
+	.long	0x61ef
+	.uleb128 0x1
+	.long	0xeb1
+	.long	.LLST920
+	.long	.LVUS920
+	.uleb128 0x1
+	.long	0xea4
+	.long	.LLST921
+	.long	.LVUS921
+	.byte	0
+	.uleb128 0x4
+	.long	0xe94
+	.quad	.LBI3180
+	.value	.LVU2025
+	.long	.LLRL922
+	.byte	0x5b
+	.byte	0xc4
+	.long	0x621b
+	.uleb128 0x1
+	.long	0xeb1
+	.long	.LLST923
+	.long	.LVUS923
+	.uleb128 0x2
+	.long	0xea4
+	.byte	0
+	.uleb128 0x4
+	.long	0xe3e
+	.quad	.LBI3183
+	.value	.LVU2029
+	.long	.LLRL924
+	.byte	0x5b
+	.byte	0xf5
+	.long	0x6247
+	.uleb128 0x2
+	.long	0xe5b
+	.uleb128 0x1
+	.long	0xe4e
+	.long	.LLST925
+	.long	.LVUS925
+	.byte	0
+	.uleb128 0x4
+	.long	0xd27
+	.quad	.LBI3187
+	.value	.LVU2033
+	.long	.LLRL926
+	.byte	0x5b
+	.byte	0xf5
+	.long	0x627b
+	.uleb128 0x1
+	.long	0xd44
+	.long	.LLST927
+	.long	.LVUS927
+	.uleb128 0x1
+	.long	0xd37
+	.long	.LLST928
+	.long	.LVUS928
+	.byte	0
+	.uleb128 0x5
+	.long	0xe94
+	.quad	.LBI3192
+	.value	.LVU2040
+	.quad	.LBB3192
+	.quad	.LBE3192-.LBB3192
+	.byte	0x5b
+	.value	0x125
+	.long	0x62bc
+	.uleb128 0x1
+	.long	0xeb1
+	.long	.LLST929
+	.long	.LVUS929
+	.uleb128 0x1
+	.long	0xea4
+	.long	.LLST930
+	.long	.LVUS930
+	.byte	0
+	.uleb128 0x3
+	.long	0xe3e
+	.quad	.LBI3194
+	.value	.LVU2045
+	.long	.LLRL931
+	.byte	0x5b
+	.value	0x143
+	.long	0x62f1
+	.uleb128 0x1
+	.long	0xe5b
+	.long	.LLST932
+	.long	.LVUS932
+	.uleb128 0x1
+	.long	0xe4e
+	.long	.LLST933
+	.long	.LVUS933
+	.byte	0
+	.uleb128 0x3
+	.long	0xd27
+	.quad	.LBI3197
+	.value	.LVU2048
+	.long	.LLRL934
+	.byte	0x5b
+	.value	0x143
+	.long	0x6326
+	.uleb128 0x1
+	.long	0xd44
+	.long	.LLST935
+	.long	.LVUS935
+	.uleb128 0x1
+	.long	0xd37
+	.long	.LLST936
+	.long	.LVUS936
+	.byte	0
+	.uleb128 0x4
+	.long	0xe14
+	.quad	.LBI3200
+	.value	.LVU2071
+	.long	.LLRL937
+	.byte	0x5b
+	.byte	0xc
+	.long	0x6352
+	.uleb128 0x1
+	.long	0xe31
+	.long	.LLST938
+	.long	.LVUS938
+	.uleb128 0x2
+	.long	0xe24
+	.byte	0
+	.uleb128 0x4
+	.long	0xe14
+	.quad	.LBI3204
+	.value	.LVU2067
+	.long	.LLRL939
+	.byte	0x5b
+	.byte	0xc
+	.long	0x637e
+	.uleb128 0x1
+	.long	0xe31
+	.long	.LLST940
+	.long	.LVUS940
+	.uleb128 0x2
+	.long	0xe24
+	.byte	0
+	.uleb128 0x36
+	.long	0xe14
+	.quad	.LBI3208
+	.value	.LVU2060
+	.long	.LLRL941
+	.byte	0x1
+	.byte	0x5b
+	.value	0x17e
+	.uleb128 0x1
+	.long	0xe31
+	.long	.LLST942
+	.long	.LVUS942
+	.uleb128 0x1
+	.long	0xe24
+	.long	.LLST943
+	.long	.LVUS943
+	.byte	0
+	.byte	0
+	.uleb128 0x4
+	.long	0xe3e
+	.quad	.LBI3222
+	.value	.LVU2079
+	.long	.LLRL944
+	.byte	0x5d
+	.byte	0xc
+	.long	0x63d5
+	.uleb128 0x2
+	.long	0xe5b
+	.uleb128 0x2
+	.long	0xe4e
+	.byte	0
+	.uleb128 0x6
+	.long	0xe3e
+	.quad	.LBI3226
+	.value	.LVU2076
+	.quad	.LBB3226
+	.quad	.LBE3226-.LBB3226
+	.byte	0x5d
+	.byte	0xc
+	.long	0x640d
+	.uleb128 0x1
+	.long	0xe5b
+	.long	.LLST945
+	.long	.LVUS945
+	.uleb128 0x2
+	.long	0xe4e
+	.byte	0
+	.uleb128 0x6
+	.long	0xe3e
+	.quad	.LBI3229
+	.value	.LVU2083
+	.quad	.LBB3229
+	.quad	.LBE3229-.LBB3229
+	.byte	0x5e
+	.byte	0xc
+	.long	0x644d
+	.uleb128 0x1
+	.long	0xe5b
+	.long	.LLST946
+	.long	.LVUS946
+	.uleb128 0x1
+	.long	0xe4e
+	.long	.LLST947
+	.long	.LVUS947
+	.byte	0
+	.uleb128 0x37
+	.long	0xe3e
+	.quad	.LBI3231
+	.value	.LVU2086
+	.quad	.LBB3231
+	.quad	.LBE3231-.LBB3231
+	.byte	0x1
+	.byte	0x5e
+	.byte	0xc
+	.uleb128 0x2
+	.long	0xe5b
+	.uleb128 0x1
+	.long	0xe4e
+	.long	.LLST948
+	.long	.LVUS948
+	.byte	0
+	.byte	0
+	.byte	0
+	.section	.debug_abbrev,"",@progbits
+.Ldebug_abbrev0:
+	.uleb128 0x1
+	.uleb128 0x5
+	.byte	0
+	.uleb128 0x31
+	.uleb128 0x13
+	.uleb128 0x2
+	.uleb128 0x17
+	.uleb128 0x2137
+	.uleb128 0x17
+	.byte	0
+	.byte	0
+	.uleb128 0x2
+	.uleb128 0x5
+	.byte	0
+	.uleb128 0x31
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x1d
+	.byte	0x1
+	.uleb128 0x31
+	.uleb128 0x13
+	.uleb128 0x52
+	.uleb128 0x1
+	.uleb128 0x2138
+	.uleb128 0x5
+	.uleb128 0x55
+	.uleb128 0x17
+	.uleb128 0x58
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x59
+	.uleb128 0xb
+	.uleb128 0x57
+	.uleb128 0x5
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x4
+	.uleb128 0x1d
+	.byte	0x1
+	.uleb128 0x31
+	.uleb128 0x13
+	.uleb128 0x52
+	.uleb128 0x1
+	.uleb128 0x2138
+	.uleb128 0x5
+	.uleb128 0x55
+	.uleb128 0x17
+	.uleb128 0x58
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x59
+	.uleb128 0xb
+	.uleb128 0x57
+	.uleb128 0xb
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x5
+	.uleb128 0x1d
+	.byte	0x1
+	.uleb128 0x31
+	.uleb128 0x13
+	.uleb128 0x52
+	.uleb128 0x1
+	.uleb128 0x2138
+	.uleb128 0x5
+	.uleb128 0x11
+	.uleb128 0x1
+	.uleb128 0x12
+	.uleb128 0x7
+	.uleb128 0x58
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x59
+	.uleb128 0xb
+	.uleb128 0x57
+	.uleb128 0x5
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x6
+	.uleb128 0x1d
+	.byte	0x1
+	.uleb128 0x31
+	.uleb128 0x13
+	.uleb128 0x52
+	.uleb128 0x1
+	.uleb128 0x2138
+	.uleb128 0x5
+	.uleb128 0x11
+	.uleb128 0x1
+	.uleb128 0x12
+	.uleb128 0x7
+	.uleb128 0x58
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x59
+	.uleb128 0xb
+	.uleb128 0x57
+	.uleb128 0xb
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x7
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x8
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x8
+	.uleb128 0x5
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x8
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x9
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x31
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0xa
+	.uleb128 0x16
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0x24
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x3e
+	.uleb128 0xb
+	.uleb128 0x3
+	.uleb128 0xe
+	.byte	0
+	.byte	0
+	.uleb128 0xc
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x20
+	.uleb128 0x21
+	.sleb128 3
+	.uleb128 0x34
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0xd
+	.uleb128 0x21
+	.byte	0
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x2f
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0xe
+	.uleb128 0x26
+	.byte	0
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0xf
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x8
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x2
+	.uleb128 0x17
+	.uleb128 0x2137
+	.uleb128 0x17
+	.byte	0
+	.byte	0
+	.uleb128 0x10
+	.uleb128 0xb
+	.byte	0x1
+	.uleb128 0x31
+	.uleb128 0x13
+	.uleb128 0x55
+	.uleb128 0x17
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x11
+	.uleb128 0xb
+	.byte	0x1
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x12
+	.uleb128 0x1d
+	.byte	0x1
+	.uleb128 0x31
+	.uleb128 0x13
+	.uleb128 0x52
+	.uleb128 0x1
+	.uleb128 0x2138
+	.uleb128 0x5
+	.uleb128 0x11
+	.uleb128 0x1
+	.uleb128 0x12
+	.uleb128 0x7
+	.uleb128 0x58
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x59
+	.uleb128 0xb
+	.uleb128 0x57
+	.uleb128 0x21
+	.sleb128 382
+	.byte	0
+	.byte	0
+	.uleb128 0x13
+	.uleb128 0x1
+	.byte	0x1
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x14
+	.uleb128 0x1
+	.byte	0x1
+	.uleb128 0x2107
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x15
+	.uleb128 0x21
+	.byte	0
+	.uleb128 0x2f
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x16
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x31
+	.uleb128 0x13
+	.uleb128 0x2
+	.uleb128 0x17
+	.uleb128 0x2137
+	.uleb128 0x17
+	.byte	0
+	.byte	0
+	.uleb128 0x17
+	.uleb128 0x5
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x8
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x18
+	.uleb128 0xf
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0x21
+	.sleb128 8
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x19
+	.uleb128 0xd
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x8
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 9
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x38
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x1a
+	.uleb128 0xd
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 9
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 14
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x38
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x1b
+	.uleb128 0x5
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x8
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x2
+	.uleb128 0x17
+	.uleb128 0x2137
+	.uleb128 0x17
+	.byte	0
+	.byte	0
+	.uleb128 0x1c
+	.uleb128 0x5
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 3
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x1d
+	.uleb128 0x16
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x8
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 10
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x1e
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 10
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x1c
+	.uleb128 0xa
+	.byte	0
+	.byte	0
+	.uleb128 0x1f
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 6
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x11
+	.uleb128 0x1
+	.uleb128 0x12
+	.uleb128 0x7
+	.uleb128 0x40
+	.uleb128 0x18
+	.uleb128 0x7a
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x20
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x8
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 13
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x2
+	.uleb128 0x18
+	.byte	0
+	.byte	0
+	.uleb128 0x21
+	.uleb128 0x48
+	.byte	0
+	.uleb128 0x7d
+	.uleb128 0x1
+	.uleb128 0x7f
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x22
+	.uleb128 0x11
+	.byte	0x1
+	.uleb128 0x25
+	.uleb128 0xe
+	.uleb128 0x13
+	.uleb128 0xb
+	.uleb128 0x3
+	.uleb128 0x1f
+	.uleb128 0x1b
+	.uleb128 0x1f
+	.uleb128 0x11
+	.uleb128 0x1
+	.uleb128 0x12
+	.uleb128 0x7
+	.uleb128 0x10
+	.uleb128 0x17
+	.byte	0
+	.byte	0
+	.uleb128 0x23
+	.uleb128 0x24
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x3e
+	.uleb128 0xb
+	.uleb128 0x3
+	.uleb128 0x8
+	.byte	0
+	.byte	0
+	.uleb128 0x24
+	.uleb128 0x13
+	.byte	0x1
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x88
+	.uleb128 0xb
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x25
+	.uleb128 0x26
+	.byte	0
+	.byte	0
+	.byte	0
+	.uleb128 0x26
+	.uleb128 0x16
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x88
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x27
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x88
+	.uleb128 0xb
+	.uleb128 0x1c
+	.uleb128 0xa
+	.byte	0
+	.byte	0
+	.uleb128 0x28
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x88
+	.uleb128 0xb
+	.uleb128 0x1c
+	.uleb128 0x3
+	.byte	0
+	.byte	0
+	.uleb128 0x29
+	.uleb128 0x5
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x2
+	.uleb128 0x17
+	.uleb128 0x2137
+	.uleb128 0x17
+	.byte	0
+	.byte	0
+	.uleb128 0x2a
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x2b
+	.uleb128 0xb
+	.byte	0x1
+	.uleb128 0x55
+	.uleb128 0x17
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x2c
+	.uleb128 0x1d
+	.byte	0x1
+	.uleb128 0x31
+	.uleb128 0x13
+	.uleb128 0x52
+	.uleb128 0x1
+	.uleb128 0x2138
+	.uleb128 0x5
+	.uleb128 0x55
+	.uleb128 0x17
+	.uleb128 0x58
+	.uleb128 0xb
+	.uleb128 0x59
+	.uleb128 0xb
+	.uleb128 0x57
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x2d
+	.uleb128 0x5
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x8
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x2
+	.uleb128 0x18
+	.byte	0
+	.byte	0
+	.uleb128 0x2e
+	.uleb128 0x48
+	.byte	0x1
+	.uleb128 0x7d
+	.uleb128 0x1
+	.uleb128 0x7f
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x2f
+	.uleb128 0x49
+	.byte	0
+	.uleb128 0x2
+	.uleb128 0x18
+	.uleb128 0x7e
+	.uleb128 0x18
+	.byte	0
+	.byte	0
+	.uleb128 0x30
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x20
+	.uleb128 0xb
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x31
+	.uleb128 0xb
+	.byte	0x1
+	.byte	0
+	.byte	0
+	.uleb128 0x32
+	.uleb128 0x2e
+	.byte	0
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x20
+	.uleb128 0xb
+	.uleb128 0x34
+	.uleb128 0x19
+	.byte	0
+	.byte	0
+	.uleb128 0x33
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x20
+	.uleb128 0xb
+	.uleb128 0x34
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x34
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x31
+	.uleb128 0x13
+	.uleb128 0x11
+	.uleb128 0x1
+	.uleb128 0x12
+	.uleb128 0x7
+	.uleb128 0x40
+	.uleb128 0x18
+	.uleb128 0x7a
+	.uleb128 0x19
+	.byte	0
+	.byte	0
+	.uleb128 0x35
+	.uleb128 0x5
+	.byte	0
+	.uleb128 0x31
+	.uleb128 0x13
+	.uleb128 0x2
+	.uleb128 0x18
+	.byte	0
+	.byte	0
+	.uleb128 0x36
+	.uleb128 0x1d
+	.byte	0x1
+	.uleb128 0x31
+	.uleb128 0x13
+	.uleb128 0x52
+	.uleb128 0x1
+	.uleb128 0x2138
+	.uleb128 0x5
+	.uleb128 0x55
+	.uleb128 0x17
+	.uleb128 0x58
+	.uleb128 0xb
+	.uleb128 0x59
+	.uleb128 0xb
+	.uleb128 0x57
+	.uleb128 0x5
+	.byte	0
+	.byte	0
+	.uleb128 0x37
+	.uleb128 0x1d
+	.byte	0x1
+	.uleb128 0x31
+	.uleb128 0x13
+	.uleb128 0x52
+	.uleb128 0x1
+	.uleb128 0x2138
+	.uleb128 0x5
+	.uleb128 0x11
+	.uleb128 0x1
+	.uleb128 0x12
+	.uleb128 0x7
+	.uleb128 0x58
+	.uleb128 0xb
+	.uleb128 0x59
+	.uleb128 0xb
+	.uleb128 0x57
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.byte	0
+	.section	.debug_loclists,"",@progbits
+	.long	.Ldebug_loc3-.Ldebug_loc2
+.Ldebug_loc2:
+	.value	0x5
+	.byte	0x8
+	.byte	0
+	.long	0
+.Ldebug_loc0:
+.LVUS966:
+	.uleb128 0
+	.uleb128 .LVU2164
+	.uleb128 .LVU2164
+	.uleb128 .LVU2253
+	.uleb128 .LVU2253
+	.uleb128 0
+.LLST966:
+	.byte	0x4
+	.uleb128 .LVL338-.Ltext0
+	.uleb128 .LVL342-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL342-.Ltext0
+	.uleb128 .LVL358-.Ltext0
+	.uleb128 0x1
+	.byte	0x52
+	.byte	0x4
+	.uleb128 .LVL358-.Ltext0
+	.uleb128 .LFE6405-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0
+.LVUS967:
+	.uleb128 0
+	.uleb128 .LVU2191
+	.uleb128 .LVU2191
+	.uleb128 .LVU2253
+	.uleb128 .LVU2253
+	.uleb128 0
+.LLST967:
+	.byte	0x4
+	.uleb128 .LVL338-.Ltext0
+	.uleb128 .LVL347-.Ltext0
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x4
+	.uleb128 .LVL347-.Ltext0
+	.uleb128 .LVL358-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL358-.Ltext0
+	.uleb128 .LFE6405-.Ltext0
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0
+.LVUS968:
+	.uleb128 0
+	.uleb128 .LVU2183
+	.uleb128 .LVU2183
+	.uleb128 .LVU2189
+	.uleb128 .LVU2189
+	.uleb128 .LVU2217
+	.uleb128 .LVU2217
+	.uleb128 .LVU2224
+	.uleb128 .LVU2224
+	.uleb128 .LVU2238
+	.uleb128 .LVU2238
+	.uleb128 .LVU2253
+	.uleb128 .LVU2253
+	.uleb128 0
+.LLST968:
+	.byte	0x4
+	.uleb128 .LVL338-.Ltext0
+	.uleb128 .LVL345-.Ltext0
+	.uleb128 0x1
+	.byte	0x51
+	.byte	0x4
+	.uleb128 .LVL345-.Ltext0
+	.uleb128 .LVL346-.Ltext0
+	.uleb128 0x3
+	.byte	0x71
+	.sleb128 -1
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL346-.Ltext0
+	.uleb128 .LVL351-.Ltext0
+	.uleb128 0x1
+	.byte	0x51
+	.byte	0x4
+	.uleb128 .LVL351-.Ltext0
+	.uleb128 .LVL353-.Ltext0
+	.uleb128 0x3
+	.byte	0x71
+	.sleb128 -1
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL353-.Ltext0
+	.uleb128 .LVL355-.Ltext0
+	.uleb128 0x1
+	.byte	0x51
+	.byte	0x4
+	.uleb128 .LVL355-.Ltext0
+	.uleb128 .LVL358-.Ltext0
+	.uleb128 0x3
+	.byte	0x71
+	.sleb128 -1
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL358-.Ltext0
+	.uleb128 .LFE6405-.Ltext0
+	.uleb128 0x1
+	.byte	0x51
+	.byte	0
+.LVUS969:
+	.uleb128 .LVU2145
+	.uleb128 .LVU2185
+	.uleb128 .LVU2185
+	.uleb128 .LVU2191
+	.uleb128 .LVU2191
+	.uleb128 .LVU2197
+	.uleb128 .LVU2197
+	.uleb128 .LVU2215
+	.uleb128 .LVU2219
+	.uleb128 .LVU2227
+	.uleb128 .LVU2236
+	.uleb128 .LVU2253
+	.uleb128 .LVU2253
+	.uleb128 0
+.LLST969:
+	.byte	0x4
+	.uleb128 .LVL338-.Ltext0
+	.uleb128 .LVL345-.Ltext0
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x4
+	.uleb128 .LVL345-.Ltext0
+	.uleb128 .LVL347-.Ltext0
+	.uleb128 0x4
+	.byte	0x74
+	.sleb128 64
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL347-.Ltext0
+	.uleb128 .LVL348-.Ltext0
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x4
+	.uleb128 .LVL348-.Ltext0
+	.uleb128 .LVL351-.Ltext0
+	.uleb128 0x3
+	.byte	0x74
+	.sleb128 -64
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL351-.Ltext0
+	.uleb128 .LVL354-.Ltext0
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x4
+	.uleb128 .LVL355-.Ltext0
+	.uleb128 .LVL358-.Ltext0
+	.uleb128 0x6
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x23
+	.uleb128 0x40
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL358-.Ltext0
+	.uleb128 .LFE6405-.Ltext0
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0
+.LVUS970:
+	.uleb128 .LVU2217
+	.uleb128 .LVU2222
+.LLST970:
+	.byte	0x4
+	.uleb128 .LVL351-.Ltext0
+	.uleb128 .LVL352-.Ltext0
+	.uleb128 0x1
+	.byte	0x6b
+	.byte	0
+.LVUS971:
+	.uleb128 .LVU2175
+	.uleb128 .LVU2198
+	.uleb128 .LVU2198
+	.uleb128 .LVU2202
+	.uleb128 .LVU2202
+	.uleb128 .LVU2227
+	.uleb128 .LVU2227
+	.uleb128 .LVU2253
+.LLST971:
+	.byte	0x4
+	.uleb128 .LVL344-.Ltext0
+	.uleb128 .LVL349-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x64
+	.byte	0x4
+	.uleb128 .LVL349-1-.Ltext0
+	.uleb128 .LVL350-.Ltext0
+	.uleb128 0x1
+	.byte	0x6e
+	.byte	0x4
+	.uleb128 .LVL350-.Ltext0
+	.uleb128 .LVL354-.Ltext0
+	.uleb128 0x1
+	.byte	0x6d
+	.byte	0x4
+	.uleb128 .LVL354-.Ltext0
+	.uleb128 .LVL358-.Ltext0
+	.uleb128 0x1
+	.byte	0x6e
+	.byte	0
+.LVUS972:
+	.uleb128 .LVU2180
+	.uleb128 .LVU2198
+	.uleb128 .LVU2198
+	.uleb128 .LVU2207
+	.uleb128 .LVU2207
+	.uleb128 .LVU2227
+	.uleb128 .LVU2227
+	.uleb128 .LVU2253
+.LLST972:
+	.byte	0x4
+	.uleb128 .LVL345-.Ltext0
+	.uleb128 .LVL349-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x65
+	.byte	0x4
+	.uleb128 .LVL349-1-.Ltext0
+	.uleb128 .LVL351-.Ltext0
+	.uleb128 0x1
+	.byte	0x6f
+	.byte	0x4
+	.uleb128 .LVL351-.Ltext0
+	.uleb128 .LVL354-.Ltext0
+	.uleb128 0x1
+	.byte	0x6c
+	.byte	0x4
+	.uleb128 .LVL354-.Ltext0
+	.uleb128 .LVL358-.Ltext0
+	.uleb128 0x1
+	.byte	0x6f
+	.byte	0
+.LVUS982:
+	.uleb128 .LVU2184
+	.uleb128 .LVU2198
+	.uleb128 .LVU2198
+	.uleb128 .LVU2202
+	.uleb128 .LVU2218
+	.uleb128 .LVU2227
+	.uleb128 .LVU2227
+	.uleb128 .LVU2253
+.LLST982:
+	.byte	0x4
+	.uleb128 .LVL345-.Ltext0
+	.uleb128 .LVL349-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x64
+	.byte	0x4
+	.uleb128 .LVL349-1-.Ltext0
+	.uleb128 .LVL350-.Ltext0
+	.uleb128 0x1
+	.byte	0x6e
+	.byte	0x4
+	.uleb128 .LVL351-.Ltext0
+	.uleb128 .LVL354-.Ltext0
+	.uleb128 0x1
+	.byte	0x6d
+	.byte	0x4
+	.uleb128 .LVL354-.Ltext0
+	.uleb128 .LVL358-.Ltext0
+	.uleb128 0x1
+	.byte	0x6e
+	.byte	0
+.LVUS983:
+	.uleb128 .LVU2184
+	.uleb128 .LVU2198
+	.uleb128 .LVU2198
+	.uleb128 .LVU2207
+	.uleb128 .LVU2218
+	.uleb128 .LVU2227
+	.uleb128 .LVU2227
+	.uleb128 .LVU2253
+.LLST983:
+	.byte	0x4
+	.uleb128 .LVL345-.Ltext0
+	.uleb128 .LVL349-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x65
+	.byte	0x4
+	.uleb128 .LVL349-1-.Ltext0
+	.uleb128 .LVL351-.Ltext0
+	.uleb128 0x1
+	.byte	0x6f
+	.byte	0x4
+	.uleb128 .LVL351-.Ltext0
+	.uleb128 .LVL354-.Ltext0
+	.uleb128 0x1
+	.byte	0x6c
+	.byte	0x4
+	.uleb128 .LVL354-.Ltext0
+	.uleb128 .LVL358-.Ltext0
+	.uleb128 0x1
+	.byte	0x6f
+	.byte	0
+.LVUS987:
+	.uleb128 .LVU2192
+	.uleb128 .LVU2197
+	.uleb128 .LVU2197
+	.uleb128 .LVU2202
+.LLST987:
+	.byte	0x4
+	.uleb128 .LVL347-.Ltext0
+	.uleb128 .LVL348-.Ltext0
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x4
+	.uleb128 .LVL348-.Ltext0
+	.uleb128 .LVL350-.Ltext0
+	.uleb128 0x3
+	.byte	0x74
+	.sleb128 -64
+	.byte	0x9f
+	.byte	0
+.LVUS974:
+	.uleb128 .LVU2152
+	.uleb128 .LVU2156
+.LLST974:
+	.byte	0x4
+	.uleb128 .LVL339-.Ltext0
+	.uleb128 .LVL340-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0
+.LVUS976:
+	.uleb128 .LVU2161
+	.uleb128 .LVU2163
+.LLST976:
+	.byte	0x4
+	.uleb128 .LVL341-.Ltext0
+	.uleb128 .LVL341-.Ltext0
+	.uleb128 0x3
+	.byte	0x75
+	.sleb128 16
+	.byte	0x9f
+	.byte	0
+.LVUS978:
+	.uleb128 .LVU2172
+	.uleb128 .LVU2175
+.LLST978:
+	.byte	0x4
+	.uleb128 .LVL343-.Ltext0
+	.uleb128 .LVL344-.Ltext0
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0
+.LVUS980:
+	.uleb128 .LVU2177
+	.uleb128 .LVU2180
+.LLST980:
+	.byte	0x4
+	.uleb128 .LVL344-.Ltext0
+	.uleb128 .LVL345-.Ltext0
+	.uleb128 0x3
+	.byte	0x74
+	.sleb128 32
+	.byte	0x9f
+	.byte	0
+.LVUS990:
+	.uleb128 .LVU2239
+	.uleb128 .LVU2242
+.LLST990:
+	.byte	0x4
+	.uleb128 .LVL355-.Ltext0
+	.uleb128 .LVL356-.Ltext0
+	.uleb128 0x2
+	.byte	0x76
+	.sleb128 -48
+	.byte	0
+.LVUS991:
+	.uleb128 .LVU2239
+	.uleb128 .LVU2242
+.LLST991:
+	.byte	0x4
+	.uleb128 .LVL355-.Ltext0
+	.uleb128 .LVL356-.Ltext0
+	.uleb128 0x1
+	.byte	0x52
+	.byte	0
+.LVUS993:
+	.uleb128 .LVU2244
+	.uleb128 .LVU2247
+.LLST993:
+	.byte	0x4
+	.uleb128 .LVL356-.Ltext0
+	.uleb128 .LVL357-.Ltext0
+	.uleb128 0x1
+	.byte	0x68
+	.byte	0
+.LVUS994:
+	.uleb128 .LVU2244
+	.uleb128 .LVU2247
+.LLST994:
+	.byte	0x4
+	.uleb128 .LVL356-.Ltext0
+	.uleb128 .LVL357-.Ltext0
+	.uleb128 0x3
+	.byte	0x72
+	.sleb128 16
+	.byte	0x9f
+	.byte	0
+.LVUS996:
+	.uleb128 .LVU2249
+	.uleb128 .LVU2251
+.LLST996:
+	.byte	0x4
+	.uleb128 .LVL357-.Ltext0
+	.uleb128 .LVL357-.Ltext0
+	.uleb128 0x4
+	.byte	0x72
+	.sleb128 96
+	.byte	0x9f
+	.byte	0
+.LVUS949:
+	.uleb128 0
+	.uleb128 .LVU2106
+	.uleb128 .LVU2106
+	.uleb128 0
+.LLST949:
+	.byte	0x4
+	.uleb128 .LVL330-.Ltext0
+	.uleb128 .LVL332-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL332-.Ltext0
+	.uleb128 .LFE6404-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0
+.LVUS950:
+	.uleb128 .LVU2094
+	.uleb128 0
+.LLST950:
+	.byte	0x4
+	.uleb128 .LVL330-.Ltext0
+	.uleb128 .LFE6404-.Ltext0
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0
+.LVUS951:
+	.uleb128 .LVU2108
+	.uleb128 .LVU2131
+.LLST951:
+	.byte	0x4
+	.uleb128 .LVL333-.Ltext0
+	.uleb128 .LVL335-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x61
+	.byte	0
+.LVUS952:
+	.uleb128 .LVU2114
+	.uleb128 .LVU2131
+.LLST952:
+	.byte	0x4
+	.uleb128 .LVL334-.Ltext0
+	.uleb128 .LVL335-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x62
+	.byte	0
+.LVUS953:
+	.uleb128 .LVU2117
+	.uleb128 .LVU2131
+.LLST953:
+	.byte	0x4
+	.uleb128 .LVL334-.Ltext0
+	.uleb128 .LVL335-1-.Ltext0
+	.uleb128 0x3
+	.byte	0x70
+	.sleb128 96
+	.byte	0
+.LVUS955:
+	.uleb128 .LVU2098
+	.uleb128 .LVU2102
+.LLST955:
+	.byte	0x4
+	.uleb128 .LVL330-.Ltext0
+	.uleb128 .LVL331-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0
+.LVUS956:
+	.uleb128 .LVU2115
+	.uleb128 .LVU2117
+.LLST956:
+	.byte	0x4
+	.uleb128 .LVL334-.Ltext0
+	.uleb128 .LVL334-.Ltext0
+	.uleb128 0x4
+	.byte	0x70
+	.sleb128 96
+	.byte	0x9f
+	.byte	0
+.LVUS957:
+	.uleb128 .LVU2120
+	.uleb128 .LVU2122
+.LLST957:
+	.byte	0x4
+	.uleb128 .LVL334-.Ltext0
+	.uleb128 .LVL334-.Ltext0
+	.uleb128 0x3
+	.byte	0x70
+	.sleb128 96
+	.byte	0
+.LVUS958:
+	.uleb128 .LVU2124
+	.uleb128 .LVU2126
+.LLST958:
+	.byte	0x4
+	.uleb128 .LVL334-.Ltext0
+	.uleb128 .LVL334-.Ltext0
+	.uleb128 0x3
+	.byte	0x74
+	.sleb128 32
+	.byte	0x9f
+	.byte	0
+.LVUS959:
+	.uleb128 .LVU2126
+	.uleb128 .LVU2129
+.LLST959:
+	.byte	0x4
+	.uleb128 .LVL334-.Ltext0
+	.uleb128 .LVL334-.Ltext0
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0
+.LVUS961:
+	.uleb128 .LVU2132
+	.uleb128 .LVU2135
+.LLST961:
+	.byte	0x4
+	.uleb128 .LVL335-.Ltext0
+	.uleb128 .LVL336-.Ltext0
+	.uleb128 0x2
+	.byte	0x75
+	.sleb128 0
+	.byte	0
+.LVUS962:
+	.uleb128 .LVU2132
+	.uleb128 .LVU2135
+.LLST962:
+	.byte	0x4
+	.uleb128 .LVL335-.Ltext0
+	.uleb128 .LVL336-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0
+.LVUS964:
+	.uleb128 .LVU2137
+	.uleb128 .LVU2140
+.LLST964:
+	.byte	0x4
+	.uleb128 .LVL336-.Ltext0
+	.uleb128 .LVL337-.Ltext0
+	.uleb128 0x1
+	.byte	0x68
+	.byte	0
+.LVUS965:
+	.uleb128 .LVU2137
+	.uleb128 .LVU2140
+.LLST965:
+	.byte	0x4
+	.uleb128 .LVL336-.Ltext0
+	.uleb128 .LVL337-.Ltext0
+	.uleb128 0x3
+	.byte	0x70
+	.sleb128 16
+	.byte	0x9f
+	.byte	0
+.LVUS0:
+	.uleb128 0
+	.uleb128 .LVU10
+	.uleb128 .LVU10
+	.uleb128 .LVU12
+	.uleb128 .LVU49
+	.uleb128 .LVU82
+	.uleb128 .LVU82
+	.uleb128 .LVU170
+	.uleb128 .LVU170
+	.uleb128 .LVU253
+	.uleb128 .LVU253
+	.uleb128 .LVU289
+	.uleb128 .LVU289
+	.uleb128 .LVU377
+	.uleb128 .LVU377
+	.uleb128 .LVU460
+	.uleb128 .LVU460
+	.uleb128 .LVU496
+	.uleb128 .LVU496
+	.uleb128 .LVU584
+	.uleb128 .LVU584
+	.uleb128 .LVU667
+	.uleb128 .LVU667
+	.uleb128 .LVU703
+	.uleb128 .LVU703
+	.uleb128 .LVU791
+	.uleb128 .LVU791
+	.uleb128 .LVU874
+	.uleb128 .LVU874
+	.uleb128 .LVU910
+	.uleb128 .LVU910
+	.uleb128 .LVU998
+	.uleb128 .LVU998
+	.uleb128 .LVU1081
+	.uleb128 .LVU1081
+	.uleb128 .LVU1117
+	.uleb128 .LVU1117
+	.uleb128 .LVU1205
+	.uleb128 .LVU1205
+	.uleb128 .LVU1288
+	.uleb128 .LVU1288
+	.uleb128 .LVU1324
+	.uleb128 .LVU1324
+	.uleb128 .LVU1412
+	.uleb128 .LVU1412
+	.uleb128 .LVU1495
+	.uleb128 .LVU1495
+	.uleb128 .LVU1529
+	.uleb128 .LVU1529
+	.uleb128 .LVU1619
+	.uleb128 .LVU1619
+	.uleb128 .LVU1702
+	.uleb128 .LVU1702
+	.uleb128 .LVU1736
+	.uleb128 .LVU1736
+	.uleb128 .LVU1824
+	.uleb128 .LVU1824
+	.uleb128 .LVU1908
+	.uleb128 .LVU1908
+	.uleb128 .LVU1942
+	.uleb128 .LVU1942
+	.uleb128 .LVU1995
+	.uleb128 .LVU1995
+	.uleb128 .LVU2027
+.LLST0:
+	.byte	0x4
+	.uleb128 .LVL0-.Ltext0
+	.uleb128 .LVL1-.Ltext0
+	.uleb128 0x1
+	.byte	0x61
+	.byte	0x4
+	.uleb128 .LVL1-.Ltext0
+	.uleb128 .LVL2-.Ltext0
+	.uleb128 0x1
+	.byte	0x68
+	.byte	0x4
+	.uleb128 .LVL8-.Ltext0
+	.uleb128 .LVL14-.Ltext0
+	.uleb128 0x1
+	.byte	0x68
+	.byte	0x4
+	.uleb128 .LVL14-.Ltext0
+	.uleb128 .LVL30-.Ltext0
+	.uleb128 0x1
+	.byte	0x66
+	.byte	0x4
+	.uleb128 .LVL30-.Ltext0
+	.uleb128 .LVL39-.Ltext0
+	.uleb128 0x1
+	.byte	0x69
+	.byte	0x4
+	.uleb128 .LVL39-.Ltext0
+	.uleb128 .LVL46-.Ltext0
+	.uleb128 0x1
+	.byte	0x68
+	.byte	0x4
+	.uleb128 .LVL46-.Ltext0
+	.uleb128 .LVL62-.Ltext0
+	.uleb128 0x1
+	.byte	0x66
+	.byte	0x4
+	.uleb128 .LVL62-.Ltext0
+	.uleb128 .LVL71-.Ltext0
+	.uleb128 0x1
+	.byte	0x6a
+	.byte	0x4
+	.uleb128 .LVL71-.Ltext0
+	.uleb128 .LVL78-.Ltext0
+	.uleb128 0x1
+	.byte	0x68
+	.byte	0x4
+	.uleb128 .LVL78-.Ltext0
+	.uleb128 .LVL94-.Ltext0
+	.uleb128 0x1
+	.byte	0x66
+	.byte	0x4
+	.uleb128 .LVL94-.Ltext0
+	.uleb128 .LVL103-.Ltext0
+	.uleb128 0x1
+	.byte	0x69
+	.byte	0x4
+	.uleb128 .LVL103-.Ltext0
+	.uleb128 .LVL110-.Ltext0
+	.uleb128 0x1
+	.byte	0x68
+	.byte	0x4
+	.uleb128 .LVL110-.Ltext0
+	.uleb128 .LVL126-.Ltext0
+	.uleb128 0x1
+	.byte	0x66
+	.byte	0x4
+	.uleb128 .LVL126-.Ltext0
+	.uleb128 .LVL135-.Ltext0
+	.uleb128 0x1
+	.byte	0x6a
+	.byte	0x4
+	.uleb128 .LVL135-.Ltext0
+	.uleb128 .LVL142-.Ltext0
+	.uleb128 0x1
+	.byte	0x68
+	.byte	0x4
+	.uleb128 .LVL142-.Ltext0
+	.uleb128 .LVL158-.Ltext0
+	.uleb128 0x1
+	.byte	0x66
+	.byte	0x4
+	.uleb128 .LVL158-.Ltext0
+	.uleb128 .LVL167-.Ltext0
+	.uleb128 0x1
+	.byte	0x69
+	.byte	0x4
+	.uleb128 .LVL167-.Ltext0
+	.uleb128 .LVL174-.Ltext0
+	.uleb128 0x1
+	.byte	0x68
+	.byte	0x4
+	.uleb128 .LVL174-.Ltext0
+	.uleb128 .LVL190-.Ltext0
+	.uleb128 0x1
+	.byte	0x66
+	.byte	0x4
+	.uleb128 .LVL190-.Ltext0
+	.uleb128 .LVL199-.Ltext0
+	.uleb128 0x1
+	.byte	0x6a
+	.byte	0x4
+	.uleb128 .LVL199-.Ltext0
+	.uleb128 .LVL206-.Ltext0
+	.uleb128 0x1
+	.byte	0x68
+	.byte	0x4
+	.uleb128 .LVL206-.Ltext0
+	.uleb128 .LVL222-.Ltext0
+	.uleb128 0x1
+	.byte	0x66
+	.byte	0x4
+	.uleb128 .LVL222-.Ltext0
+	.uleb128 .LVL231-.Ltext0
+	.uleb128 0x1
+	.byte	0x69
+	.byte	0x4
+	.uleb128 .LVL231-.Ltext0
+	.uleb128 .LVL238-.Ltext0
+	.uleb128 0x1
+	.byte	0x68
+	.byte	0x4
+	.uleb128 .LVL238-.Ltext0
+	.uleb128 .LVL254-.Ltext0
+	.uleb128 0x1
+	.byte	0x66
+	.byte	0x4
+	.uleb128 .LVL254-.Ltext0
+	.uleb128 .LVL263-.Ltext0
+	.uleb128 0x1
+	.byte	0x6a
+	.byte	0x4
+	.uleb128 .LVL263-.Ltext0
+	.uleb128 .LVL270-.Ltext0
+	.uleb128 0x1
+	.byte	0x69
+	.byte	0x4
+	.uleb128 .LVL270-.Ltext0
+	.uleb128 .LVL286-.Ltext0
+	.uleb128 0x1
+	.byte	0x66
+	.byte	0x4
+	.uleb128 .LVL286-.Ltext0
+	.uleb128 .LVL297-.Ltext0
+	.uleb128 0x1
+	.byte	0x68
+	.byte	0x4
+	.uleb128 .LVL297-.Ltext0
+	.uleb128 .LVL304-.Ltext0
+	.uleb128 0x1
+	.byte	0x67
+	.byte	0x4
+	.uleb128 .LVL304-.Ltext0
+	.uleb128 .LVL314-.Ltext0
+	.uleb128 0x1
+	.byte	0x64
+	.byte	0x4
+	.uleb128 .LVL314-.Ltext0
+	.uleb128 .LVL319-.Ltext0
+	.uleb128 0x1
+	.byte	0x66
+	.byte	0
+.LVUS1:
+	.uleb128 0
+	.uleb128 .LVU71
+	.uleb128 .LVU73
+	.uleb128 .LVU107
+	.uleb128 .LVU111
+	.uleb128 .LVU159
+	.uleb128 .LVU161
+	.uleb128 .LVU199
+	.uleb128 .LVU203
+	.uleb128 .LVU278
+	.uleb128 .LVU280
+	.uleb128 .LVU314
+	.uleb128 .LVU318
+	.uleb128 .LVU366
+	.uleb128 .LVU368
+	.uleb128 .LVU406
+	.uleb128 .LVU410
+	.uleb128 .LVU485
+	.uleb128 .LVU487
+	.uleb128 .LVU521
+	.uleb128 .LVU525
+	.uleb128 .LVU573
+	.uleb128 .LVU575
+	.uleb128 .LVU613
+	.uleb128 .LVU617
+	.uleb128 .LVU692
+	.uleb128 .LVU694
+	.uleb128 .LVU728
+	.uleb128 .LVU732
+	.uleb128 .LVU780
+	.uleb128 .LVU782
+	.uleb128 .LVU820
+	.uleb128 .LVU824
+	.uleb128 .LVU899
+	.uleb128 .LVU901
+	.uleb128 .LVU935
+	.uleb128 .LVU939
+	.uleb128 .LVU987
+	.uleb128 .LVU989
+	.uleb128 .LVU1027
+	.uleb128 .LVU1031
+	.uleb128 .LVU1106
+	.uleb128 .LVU1108
+	.uleb128 .LVU1142
+	.uleb128 .LVU1146
+	.uleb128 .LVU1194
+	.uleb128 .LVU1196
+	.uleb128 .LVU1234
+	.uleb128 .LVU1238
+	.uleb128 .LVU1313
+	.uleb128 .LVU1315
+	.uleb128 .LVU1349
+	.uleb128 .LVU1353
+	.uleb128 .LVU1401
+	.uleb128 .LVU1403
+	.uleb128 .LVU1441
+	.uleb128 .LVU1445
+	.uleb128 .LVU1518
+	.uleb128 .LVU1520
+	.uleb128 .LVU1556
+	.uleb128 .LVU1560
+	.uleb128 .LVU1608
+	.uleb128 .LVU1610
+	.uleb128 .LVU1648
+	.uleb128 .LVU1652
+	.uleb128 .LVU1725
+	.uleb128 .LVU1727
+	.uleb128 .LVU1763
+	.uleb128 .LVU1767
+	.uleb128 .LVU1813
+	.uleb128 .LVU1815
+	.uleb128 .LVU1854
+	.uleb128 .LVU1858
+	.uleb128 .LVU1931
+	.uleb128 .LVU1933
+	.uleb128 .LVU1967
+	.uleb128 .LVU1971
+	.uleb128 .LVU2018
+	.uleb128 .LVU2020
+	.uleb128 .LVU2053
+	.uleb128 .LVU2057
+	.uleb128 0
+.LLST1:
+	.byte	0x4
+	.uleb128 .LVL0-.Ltext0
+	.uleb128 .LVL11-.Ltext0
+	.uleb128 0x1
+	.byte	0x62
+	.byte	0x4
+	.uleb128 .LVL12-.Ltext0
+	.uleb128 .LVL19-.Ltext0
+	.uleb128 0x1
+	.byte	0x62
+	.byte	0x4
+	.uleb128 .LVL21-.Ltext0
+	.uleb128 .LVL27-.Ltext0
+	.uleb128 0x1
+	.byte	0x62
+	.byte	0x4
+	.uleb128 .LVL28-.Ltext0
+	.uleb128 .LVL35-.Ltext0
+	.uleb128 0x1
+	.byte	0x62
+	.byte	0x4
+	.uleb128 .LVL37-.Ltext0
+	.uleb128 .LVL43-.Ltext0
+	.uleb128 0x1
+	.byte	0x62
+	.byte	0x4
+	.uleb128 .LVL44-.Ltext0
+	.uleb128 .LVL51-.Ltext0
+	.uleb128 0x1
+	.byte	0x62
+	.byte	0x4
+	.uleb128 .LVL53-.Ltext0
+	.uleb128 .LVL59-.Ltext0
+	.uleb128 0x1
+	.byte	0x62
+	.byte	0x4
+	.uleb128 .LVL60-.Ltext0
+	.uleb128 .LVL67-.Ltext0
+	.uleb128 0x1
+	.byte	0x62
+	.byte	0x4
+	.uleb128 .LVL69-.Ltext0
+	.uleb128 .LVL75-.Ltext0
+	.uleb128 0x1
+	.byte	0x62
+	.byte	0x4
+	.uleb128 .LVL76-.Ltext0
+	.uleb128 .LVL83-.Ltext0
+	.uleb128 0x1
+	.byte	0x62
+	.byte	0x4
+	.uleb128 .LVL85-.Ltext0
+	.uleb128 .LVL91-.Ltext0
+	.uleb128 0x1
+	.byte	0x62
+	.byte	0x4
+	.uleb128 .LVL92-.Ltext0
+	.uleb128 .LVL99-.Ltext0
+	.uleb128 0x1
+	.byte	0x62
+	.byte	0x4
+	.uleb128 .LVL101-.Ltext0
+	.uleb128 .LVL107-.Ltext0
+	.uleb128 0x1
+	.byte	0x62
+	.byte	0x4
+	.uleb128 .LVL108-.Ltext0
+	.uleb128 .LVL115-.Ltext0
+	.uleb128 0x1
+	.byte	0x62
+	.byte	0x4
+	.uleb128 .LVL117-.Ltext0
+	.uleb128 .LVL123-.Ltext0
+	.uleb128 0x1
+	.byte	0x62
+	.byte	0x4
+	.uleb128 .LVL124-.Ltext0
+	.uleb128 .LVL131-.Ltext0
+	.uleb128 0x1
+	.byte	0x62
+	.byte	0x4
+	.uleb128 .LVL133-.Ltext0
+	.uleb128 .LVL139-.Ltext0
+	.uleb128 0x1
+	.byte	0x62
+	.byte	0x4
+	.uleb128 .LVL140-.Ltext0
+	.uleb128 .LVL147-.Ltext0
+	.uleb128 0x1
+	.byte	0x62
+	.byte	0x4
+	.uleb128 .LVL149-.Ltext0
+	.uleb128 .LVL155-.Ltext0
+	.uleb128 0x1
+	.byte	0x62
+	.byte	0x4
+	.uleb128 .LVL156-.Ltext0
+	.uleb128 .LVL163-.Ltext0
+	.uleb128 0x1
+	.byte	0x62
+	.byte	0x4
+	.uleb128 .LVL165-.Ltext0
+	.uleb128 .LVL171-.Ltext0
+	.uleb128 0x1
+	.byte	0x62
+	.byte	0x4
+	.uleb128 .LVL172-.Ltext0
+	.uleb128 .LVL179-.Ltext0
+	.uleb128 0x1
+	.byte	0x62
+	.byte	0x4
+	.uleb128 .LVL181-.Ltext0
+	.uleb128 .LVL187-.Ltext0
+	.uleb128 0x1
+	.byte	0x62
+	.byte	0x4
+	.uleb128 .LVL188-.Ltext0
+	.uleb128 .LVL195-.Ltext0
+	.uleb128 0x1
+	.byte	0x62
+	.byte	0x4
+	.uleb128 .LVL197-.Ltext0
+	.uleb128 .LVL203-.Ltext0
+	.uleb128 0x1
+	.byte	0x62
+	.byte	0x4
+	.uleb128 .LVL204-.Ltext0
+	.uleb128 .LVL211-.Ltext0
+	.uleb128 0x1
+	.byte	0x62
+	.byte	0x4
+	.uleb128 .LVL213-.Ltext0
+	.uleb128 .LVL219-.Ltext0
+	.uleb128 0x1
+	.byte	0x62
+	.byte	0x4
+	.uleb128 .LVL220-.Ltext0
+	.uleb128 .LVL227-.Ltext0
+	.uleb128 0x1
+	.byte	0x62
+	.byte	0x4
+	.uleb128 .LVL229-.Ltext0
+	.uleb128 .LVL235-.Ltext0
+	.uleb128 0x1
+	.byte	0x62
+	.byte	0x4
+	.uleb128 .LVL236-.Ltext0
+	.uleb128 .LVL243-.Ltext0
+	.uleb128 0x1
+	.byte	0x62
+	.byte	0x4
+	.uleb128 .LVL245-.Ltext0
+	.uleb128 .LVL251-.Ltext0
+	.uleb128 0x1
+	.byte	0x62
+	.byte	0x4
+	.uleb128 .LVL252-.Ltext0
+	.uleb128 .LVL259-.Ltext0
+	.uleb128 0x1
+	.byte	0x62
+	.byte	0x4
+	.uleb128 .LVL261-.Ltext0
+	.uleb128 .LVL267-.Ltext0
+	.uleb128 0x1
+	.byte	0x62
+	.byte	0x4
+	.uleb128 .LVL268-.Ltext0
+	.uleb128 .LVL275-.Ltext0
+	.uleb128 0x1
+	.byte	0x62
+	.byte	0x4
+	.uleb128 .LVL277-.Ltext0
+	.uleb128 .LVL283-.Ltext0
+	.uleb128 0x1
+	.byte	0x62
+	.byte	0x4
+	.uleb128 .LVL284-.Ltext0
+	.uleb128 .LVL293-.Ltext0
+	.uleb128 0x1
+	.byte	0x62
+	.byte	0x4
+	.uleb128 .LVL295-.Ltext0
+	.uleb128 .LVL301-.Ltext0
+	.uleb128 0x1
+	.byte	0x62
+	.byte	0x4
+	.uleb128 .LVL302-.Ltext0
+	.uleb128 .LVL309-.Ltext0
+	.uleb128 0x1
+	.byte	0x62
+	.byte	0x4
+	.uleb128 .LVL311-.Ltext0
+	.uleb128 .LVL318-.Ltext0
+	.uleb128 0x1
+	.byte	0x62
+	.byte	0x4
+	.uleb128 .LVL319-.Ltext0
+	.uleb128 .LVL325-.Ltext0
+	.uleb128 0x1
+	.byte	0x62
+	.byte	0x4
+	.uleb128 .LVL327-.Ltext0
+	.uleb128 .LFE6406-.Ltext0
+	.uleb128 0x1
+	.byte	0x62
+	.byte	0
+.LVUS2:
+	.uleb128 0
+	.uleb128 .LVU58
+	.uleb128 .LVU58
+	.uleb128 .LVU90
+	.uleb128 .LVU92
+	.uleb128 .LVU105
+	.uleb128 .LVU125
+	.uleb128 .LVU144
+	.uleb128 .LVU146
+	.uleb128 .LVU179
+	.uleb128 .LVU181
+	.uleb128 .LVU197
+	.uleb128 .LVU217
+	.uleb128 .LVU262
+	.uleb128 .LVU264
+	.uleb128 .LVU297
+	.uleb128 .LVU299
+	.uleb128 .LVU312
+	.uleb128 .LVU332
+	.uleb128 .LVU351
+	.uleb128 .LVU353
+	.uleb128 .LVU386
+	.uleb128 .LVU388
+	.uleb128 .LVU404
+	.uleb128 .LVU424
+	.uleb128 .LVU469
+	.uleb128 .LVU471
+	.uleb128 .LVU504
+	.uleb128 .LVU506
+	.uleb128 .LVU519
+	.uleb128 .LVU539
+	.uleb128 .LVU558
+	.uleb128 .LVU560
+	.uleb128 .LVU593
+	.uleb128 .LVU595
+	.uleb128 .LVU611
+	.uleb128 .LVU631
+	.uleb128 .LVU676
+	.uleb128 .LVU678
+	.uleb128 .LVU711
+	.uleb128 .LVU713
+	.uleb128 .LVU726
+	.uleb128 .LVU746
+	.uleb128 .LVU765
+	.uleb128 .LVU767
+	.uleb128 .LVU800
+	.uleb128 .LVU802
+	.uleb128 .LVU818
+	.uleb128 .LVU838
+	.uleb128 .LVU883
+	.uleb128 .LVU885
+	.uleb128 .LVU918
+	.uleb128 .LVU920
+	.uleb128 .LVU933
+	.uleb128 .LVU953
+	.uleb128 .LVU972
+	.uleb128 .LVU974
+	.uleb128 .LVU1007
+	.uleb128 .LVU1009
+	.uleb128 .LVU1025
+	.uleb128 .LVU1045
+	.uleb128 .LVU1090
+	.uleb128 .LVU1092
+	.uleb128 .LVU1125
+	.uleb128 .LVU1127
+	.uleb128 .LVU1140
+	.uleb128 .LVU1160
+	.uleb128 .LVU1179
+	.uleb128 .LVU1181
+	.uleb128 .LVU1214
+	.uleb128 .LVU1216
+	.uleb128 .LVU1232
+	.uleb128 .LVU1252
+	.uleb128 .LVU1297
+	.uleb128 .LVU1299
+	.uleb128 .LVU1332
+	.uleb128 .LVU1334
+	.uleb128 .LVU1347
+	.uleb128 .LVU1367
+	.uleb128 .LVU1386
+	.uleb128 .LVU1388
+	.uleb128 .LVU1421
+	.uleb128 .LVU1423
+	.uleb128 .LVU1439
+	.uleb128 .LVU1459
+	.uleb128 .LVU1503
+	.uleb128 .LVU1505
+	.uleb128 .LVU1538
+	.uleb128 .LVU1540
+	.uleb128 .LVU1554
+	.uleb128 .LVU1574
+	.uleb128 .LVU1593
+	.uleb128 .LVU1595
+	.uleb128 .LVU1628
+	.uleb128 .LVU1630
+	.uleb128 .LVU1646
+	.uleb128 .LVU1666
+	.uleb128 .LVU1710
+	.uleb128 .LVU1712
+	.uleb128 .LVU1745
+	.uleb128 .LVU1747
+	.uleb128 .LVU1761
+	.uleb128 .LVU1781
+	.uleb128 .LVU1798
+	.uleb128 .LVU1800
+	.uleb128 .LVU1833
+	.uleb128 .LVU1835
+	.uleb128 .LVU1852
+	.uleb128 .LVU1872
+	.uleb128 .LVU1916
+	.uleb128 .LVU1918
+	.uleb128 .LVU1950
+	.uleb128 .LVU1952
+	.uleb128 .LVU1965
+	.uleb128 .LVU1985
+	.uleb128 .LVU2003
+	.uleb128 .LVU2005
+	.uleb128 .LVU2036
+	.uleb128 .LVU2038
+	.uleb128 .LVU2051
+	.uleb128 .LVU2073
+	.uleb128 .LVU2089
+.LLST2:
+	.byte	0x4
+	.uleb128 .LVL0-.Ltext0
+	.uleb128 .LVL9-.Ltext0
+	.uleb128 0x1
+	.byte	0x63
+	.byte	0x4
+	.uleb128 .LVL9-.Ltext0
+	.uleb128 .LVL15-.Ltext0
+	.uleb128 0x1
+	.byte	0x61
+	.byte	0x4
+	.uleb128 .LVL16-.Ltext0
+	.uleb128 .LVL18-.Ltext0
+	.uleb128 0x1
+	.byte	0x61
+	.byte	0x4
+	.uleb128 .LVL22-.Ltext0
+	.uleb128 .LVL24-.Ltext0
+	.uleb128 0x1
+	.byte	0x61
+	.byte	0x4
+	.uleb128 .LVL25-.Ltext0
+	.uleb128 .LVL31-.Ltext0
+	.uleb128 0x1
+	.byte	0x61
+	.byte	0x4
+	.uleb128 .LVL32-.Ltext0
+	.uleb128 .LVL34-.Ltext0
+	.uleb128 0x1
+	.byte	0x61
+	.byte	0x4
+	.uleb128 .LVL38-.Ltext0
+	.uleb128 .LVL40-.Ltext0
+	.uleb128 0x1
+	.byte	0x61
+	.byte	0x4
+	.uleb128 .LVL41-.Ltext0
+	.uleb128 .LVL47-.Ltext0
+	.uleb128 0x1
+	.byte	0x61
+	.byte	0x4
+	.uleb128 .LVL48-.Ltext0
+	.uleb128 .LVL50-.Ltext0
+	.uleb128 0x1
+	.byte	0x61
+	.byte	0x4
+	.uleb128 .LVL54-.Ltext0
+	.uleb128 .LVL56-.Ltext0
+	.uleb128 0x1
+	.byte	0x61
+	.byte	0x4
+	.uleb128 .LVL57-.Ltext0
+	.uleb128 .LVL63-.Ltext0
+	.uleb128 0x1
+	.byte	0x61
+	.byte	0x4
+	.uleb128 .LVL64-.Ltext0
+	.uleb128 .LVL66-.Ltext0
+	.uleb128 0x1
+	.byte	0x61
+	.byte	0x4
+	.uleb128 .LVL70-.Ltext0
+	.uleb128 .LVL72-.Ltext0
+	.uleb128 0x1
+	.byte	0x61
+	.byte	0x4
+	.uleb128 .LVL73-.Ltext0
+	.uleb128 .LVL79-.Ltext0
+	.uleb128 0x1
+	.byte	0x61
+	.byte	0x4
+	.uleb128 .LVL80-.Ltext0
+	.uleb128 .LVL82-.Ltext0
+	.uleb128 0x1
+	.byte	0x61
+	.byte	0x4
+	.uleb128 .LVL86-.Ltext0
+	.uleb128 .LVL88-.Ltext0
+	.uleb128 0x1
+	.byte	0x61
+	.byte	0x4
+	.uleb128 .LVL89-.Ltext0
+	.uleb128 .LVL95-.Ltext0
+	.uleb128 0x1
+	.byte	0x61
+	.byte	0x4
+	.uleb128 .LVL96-.Ltext0
+	.uleb128 .LVL98-.Ltext0
+	.uleb128 0x1
+	.byte	0x61
+	.byte	0x4
+	.uleb128 .LVL102-.Ltext0
+	.uleb128 .LVL104-.Ltext0
+	.uleb128 0x1
+	.byte	0x61
+	.byte	0x4
+	.uleb128 .LVL105-.Ltext0
+	.uleb128 .LVL111-.Ltext0
+	.uleb128 0x1
+	.byte	0x61
+	.byte	0x4
+	.uleb128 .LVL112-.Ltext0
+	.uleb128 .LVL114-.Ltext0
+	.uleb128 0x1
+	.byte	0x61
+	.byte	0x4
+	.uleb128 .LVL118-.Ltext0
+	.uleb128 .LVL120-.Ltext0
+	.uleb128 0x1
+	.byte	0x61
+	.byte	0x4
+	.uleb128 .LVL121-.Ltext0
+	.uleb128 .LVL127-.Ltext0
+	.uleb128 0x1
+	.byte	0x61
+	.byte	0x4
+	.uleb128 .LVL128-.Ltext0
+	.uleb128 .LVL130-.Ltext0
+	.uleb128 0x1
+	.byte	0x61
+	.byte	0x4
+	.uleb128 .LVL134-.Ltext0
+	.uleb128 .LVL136-.Ltext0
+	.uleb128 0x1
+	.byte	0x61
+	.byte	0x4
+	.uleb128 .LVL137-.Ltext0
+	.uleb128 .LVL143-.Ltext0
+	.uleb128 0x1
+	.byte	0x61
+	.byte	0x4
+	.uleb128 .LVL144-.Ltext0
+	.uleb128 .LVL146-.Ltext0
+	.uleb128 0x1
+	.byte	0x61
+	.byte	0x4
+	.uleb128 .LVL150-.Ltext0
+	.uleb128 .LVL152-.Ltext0
+	.uleb128 0x1
+	.byte	0x61
+	.byte	0x4
+	.uleb128 .LVL153-.Ltext0
+	.uleb128 .LVL159-.Ltext0
+	.uleb128 0x1
+	.byte	0x61
+	.byte	0x4
+	.uleb128 .LVL160-.Ltext0
+	.uleb128 .LVL162-.Ltext0
+	.uleb128 0x1
+	.byte	0x61
+	.byte	0x4
+	.uleb128 .LVL166-.Ltext0
+	.uleb128 .LVL168-.Ltext0
+	.uleb128 0x1
+	.byte	0x61
+	.byte	0x4
+	.uleb128 .LVL169-.Ltext0
+	.uleb128 .LVL175-.Ltext0
+	.uleb128 0x1
+	.byte	0x61
+	.byte	0x4
+	.uleb128 .LVL176-.Ltext0
+	.uleb128 .LVL178-.Ltext0
+	.uleb128 0x1
+	.byte	0x61
+	.byte	0x4
+	.uleb128 .LVL182-.Ltext0
+	.uleb128 .LVL184-.Ltext0
+	.uleb128 0x1
+	.byte	0x61
+	.byte	0x4
+	.uleb128 .LVL185-.Ltext0
+	.uleb128 .LVL191-.Ltext0
+	.uleb128 0x1
+	.byte	0x61
+	.byte	0x4
+	.uleb128 .LVL192-.Ltext0
+	.uleb128 .LVL194-.Ltext0
+	.uleb128 0x1
+	.byte	0x61
+	.byte	0x4
+	.uleb128 .LVL198-.Ltext0
+	.uleb128 .LVL200-.Ltext0
+	.uleb128 0x1
+	.byte	0x61
+	.byte	0x4
+	.uleb128 .LVL201-.Ltext0
+	.uleb128 .LVL207-.Ltext0
+	.uleb128 0x1
+	.byte	0x61
+	.byte	0x4
+	.uleb128 .LVL208-.Ltext0
+	.uleb128 .LVL210-.Ltext0
+	.uleb128 0x1
+	.byte	0x61
+	.byte	0x4
+	.uleb128 .LVL214-.Ltext0
+	.uleb128 .LVL216-.Ltext0
+	.uleb128 0x1
+	.byte	0x61
+	.byte	0x4
+	.uleb128 .LVL217-.Ltext0
+	.uleb128 .LVL223-.Ltext0
+	.uleb128 0x1
+	.byte	0x61
+	.byte	0x4
+	.uleb128 .LVL224-.Ltext0
+	.uleb128 .LVL226-.Ltext0
+	.uleb128 0x1
+	.byte	0x61
+	.byte	0x4
+	.uleb128 .LVL230-.Ltext0
+	.uleb128 .LVL232-.Ltext0
+	.uleb128 0x1
+	.byte	0x61
+	.byte	0x4
+	.uleb128 .LVL233-.Ltext0
+	.uleb128 .LVL239-.Ltext0
+	.uleb128 0x1
+	.byte	0x61
+	.byte	0x4
+	.uleb128 .LVL240-.Ltext0
+	.uleb128 .LVL242-.Ltext0
+	.uleb128 0x1
+	.byte	0x61
+	.byte	0x4
+	.uleb128 .LVL246-.Ltext0
+	.uleb128 .LVL248-.Ltext0
+	.uleb128 0x1
+	.byte	0x61
+	.byte	0x4
+	.uleb128 .LVL249-.Ltext0
+	.uleb128 .LVL255-.Ltext0
+	.uleb128 0x1
+	.byte	0x61
+	.byte	0x4
+	.uleb128 .LVL256-.Ltext0
+	.uleb128 .LVL258-.Ltext0
+	.uleb128 0x1
+	.byte	0x61
+	.byte	0x4
+	.uleb128 .LVL262-.Ltext0
+	.uleb128 .LVL264-.Ltext0
+	.uleb128 0x1
+	.byte	0x61
+	.byte	0x4
+	.uleb128 .LVL265-.Ltext0
+	.uleb128 .LVL271-.Ltext0
+	.uleb128 0x1
+	.byte	0x61
+	.byte	0x4
+	.uleb128 .LVL272-.Ltext0
+	.uleb128 .LVL274-.Ltext0
+	.uleb128 0x1
+	.byte	0x61
+	.byte	0x4
+	.uleb128 .LVL278-.Ltext0
+	.uleb128 .LVL280-.Ltext0
+	.uleb128 0x1
+	.byte	0x61
+	.byte	0x4
+	.uleb128 .LVL281-.Ltext0
+	.uleb128 .LVL287-.Ltext0
+	.uleb128 0x1
+	.byte	0x61
+	.byte	0x4
+	.uleb128 .LVL288-.Ltext0
+	.uleb128 .LVL292-.Ltext0
+	.uleb128 0x1
+	.byte	0x61
+	.byte	0x4
+	.uleb128 .LVL296-.Ltext0
+	.uleb128 .LVL298-.Ltext0
+	.uleb128 0x1
+	.byte	0x61
+	.byte	0x4
+	.uleb128 .LVL299-.Ltext0
+	.uleb128 .LVL305-.Ltext0
+	.uleb128 0x1
+	.byte	0x61
+	.byte	0x4
+	.uleb128 .LVL306-.Ltext0
+	.uleb128 .LVL308-.Ltext0
+	.uleb128 0x1
+	.byte	0x61
+	.byte	0x4
+	.uleb128 .LVL312-.Ltext0
+	.uleb128 .LVL315-.Ltext0
+	.uleb128 0x1
+	.byte	0x61
+	.byte	0x4
+	.uleb128 .LVL316-.Ltext0
+	.uleb128 .LVL321-.Ltext0
+	.uleb128 0x1
+	.byte	0x61
+	.byte	0x4
+	.uleb128 .LVL322-.Ltext0
+	.uleb128 .LVL324-.Ltext0
+	.uleb128 0x1
+	.byte	0x61
+	.byte	0x4
+	.uleb128 .LVL328-.Ltext0
+	.uleb128 .LVL329-.Ltext0
+	.uleb128 0x1
+	.byte	0x61
+	.byte	0
+.LVUS3:
+	.uleb128 0
+	.uleb128 .LVU1842
+.LLST3:
+	.byte	0x4
+	.uleb128 .LVL0-.Ltext0
+	.uleb128 .LVL290-.Ltext0
+	.uleb128 0x1
+	.byte	0x64
+	.byte	0
+.LVUS4:
+	.uleb128 0
+	.uleb128 .LVU1841
+.LLST4:
+	.byte	0x4
+	.uleb128 .LVL0-.Ltext0
+	.uleb128 .LVL289-.Ltext0
+	.uleb128 0x1
+	.byte	0x65
+	.byte	0
+.LVUS5:
+	.uleb128 .LVU23
+	.uleb128 .LVU39
+	.uleb128 .LVU1887
+	.uleb128 .LVU1994
+.LLST5:
+	.byte	0x4
+	.uleb128 .LVL4-.Ltext0
+	.uleb128 .LVL7-.Ltext0
+	.uleb128 0x1
+	.byte	0x61
+	.byte	0x4
+	.uleb128 .LVL296-.Ltext0
+	.uleb128 .LVL313-.Ltext0
+	.uleb128 0x1
+	.byte	0x66
+	.byte	0
+.LVUS6:
+	.uleb128 .LVU29
+	.uleb128 .LVU81
+	.uleb128 .LVU236
+	.uleb128 .LVU288
+	.uleb128 .LVU443
+	.uleb128 .LVU495
+	.uleb128 .LVU650
+	.uleb128 .LVU702
+	.uleb128 .LVU857
+	.uleb128 .LVU909
+	.uleb128 .LVU1064
+	.uleb128 .LVU1116
+	.uleb128 .LVU1271
+	.uleb128 .LVU1323
+	.uleb128 .LVU1478
+	.uleb128 .LVU1528
+	.uleb128 .LVU1685
+	.uleb128 .LVU1735
+	.uleb128 .LVU1891
+	.uleb128 .LVU1941
+.LLST6:
+	.byte	0x4
+	.uleb128 .LVL5-.Ltext0
+	.uleb128 .LVL13-.Ltext0
+	.uleb128 0x1
+	.byte	0x66
+	.byte	0x4
+	.uleb128 .LVL38-.Ltext0
+	.uleb128 .LVL45-.Ltext0
+	.uleb128 0x1
+	.byte	0x66
+	.byte	0x4
+	.uleb128 .LVL70-.Ltext0
+	.uleb128 .LVL77-.Ltext0
+	.uleb128 0x1
+	.byte	0x66
+	.byte	0x4
+	.uleb128 .LVL102-.Ltext0
+	.uleb128 .LVL109-.Ltext0
+	.uleb128 0x1
+	.byte	0x66
+	.byte	0x4
+	.uleb128 .LVL134-.Ltext0
+	.uleb128 .LVL141-.Ltext0
+	.uleb128 0x1
+	.byte	0x66
+	.byte	0x4
+	.uleb128 .LVL166-.Ltext0
+	.uleb128 .LVL173-.Ltext0
+	.uleb128 0x1
+	.byte	0x66
+	.byte	0x4
+	.uleb128 .LVL198-.Ltext0
+	.uleb128 .LVL205-.Ltext0
+	.uleb128 0x1
+	.byte	0x66
+	.byte	0x4
+	.uleb128 .LVL230-.Ltext0
+	.uleb128 .LVL237-.Ltext0
+	.uleb128 0x1
+	.byte	0x66
+	.byte	0x4
+	.uleb128 .LVL262-.Ltext0
+	.uleb128 .LVL269-.Ltext0
+	.uleb128 0x1
+	.byte	0x66
+	.byte	0x4
+	.uleb128 .LVL296-.Ltext0
+	.uleb128 .LVL303-.Ltext0
+	.uleb128 0x1
+	.byte	0x64
+	.byte	0
+.LVUS7:
+	.uleb128 .LVU34
+	.uleb128 .LVU41
+	.uleb128 .LVU1895
+	.uleb128 0
+.LLST7:
+	.byte	0x4
+	.uleb128 .LVL6-.Ltext0
+	.uleb128 .LVL8-.Ltext0
+	.uleb128 0x1
+	.byte	0x69
+	.byte	0x4
+	.uleb128 .LVL296-.Ltext0
+	.uleb128 .LFE6406-.Ltext0
+	.uleb128 0x1
+	.byte	0x69
+	.byte	0
+.LVUS8:
+	.uleb128 .LVU41
+	.uleb128 .LVU169
+	.uleb128 .LVU244
+	.uleb128 .LVU376
+	.uleb128 .LVU451
+	.uleb128 .LVU583
+	.uleb128 .LVU658
+	.uleb128 .LVU790
+	.uleb128 .LVU865
+	.uleb128 .LVU997
+	.uleb128 .LVU1072
+	.uleb128 .LVU1204
+	.uleb128 .LVU1279
+	.uleb128 .LVU1411
+	.uleb128 .LVU1486
+	.uleb128 .LVU1618
+	.uleb128 .LVU1693
+	.uleb128 .LVU1823
+	.uleb128 .LVU1899
+	.uleb128 0
+.LLST8:
+	.byte	0x4
+	.uleb128 .LVL8-.Ltext0
+	.uleb128 .LVL29-.Ltext0
+	.uleb128 0x1
+	.byte	0x69
+	.byte	0x4
+	.uleb128 .LVL38-.Ltext0
+	.uleb128 .LVL61-.Ltext0
+	.uleb128 0x1
+	.byte	0x6a
+	.byte	0x4
+	.uleb128 .LVL70-.Ltext0
+	.uleb128 .LVL93-.Ltext0
+	.uleb128 0x1
+	.byte	0x69
+	.byte	0x4
+	.uleb128 .LVL102-.Ltext0
+	.uleb128 .LVL125-.Ltext0
+	.uleb128 0x1
+	.byte	0x6a
+	.byte	0x4
+	.uleb128 .LVL134-.Ltext0
+	.uleb128 .LVL157-.Ltext0
+	.uleb128 0x1
+	.byte	0x69
+	.byte	0x4
+	.uleb128 .LVL166-.Ltext0
+	.uleb128 .LVL189-.Ltext0
+	.uleb128 0x1
+	.byte	0x6a
+	.byte	0x4
+	.uleb128 .LVL198-.Ltext0
+	.uleb128 .LVL221-.Ltext0
+	.uleb128 0x1
+	.byte	0x69
+	.byte	0x4
+	.uleb128 .LVL230-.Ltext0
+	.uleb128 .LVL253-.Ltext0
+	.uleb128 0x1
+	.byte	0x6a
+	.byte	0x4
+	.uleb128 .LVL262-.Ltext0
+	.uleb128 .LVL285-.Ltext0
+	.uleb128 0x1
+	.byte	0x68
+	.byte	0x4
+	.uleb128 .LVL296-.Ltext0
+	.uleb128 .LFE6406-.Ltext0
+	.uleb128 0x1
+	.byte	0x65
+	.byte	0
+.LVUS9:
+	.uleb128 .LVU63
+	.uleb128 .LVU109
+	.uleb128 .LVU121
+	.uleb128 .LVU201
+	.uleb128 .LVU213
+	.uleb128 .LVU316
+	.uleb128 .LVU328
+	.uleb128 .LVU408
+	.uleb128 .LVU420
+	.uleb128 .LVU523
+	.uleb128 .LVU535
+	.uleb128 .LVU615
+	.uleb128 .LVU627
+	.uleb128 .LVU730
+	.uleb128 .LVU742
+	.uleb128 .LVU822
+	.uleb128 .LVU834
+	.uleb128 .LVU937
+	.uleb128 .LVU949
+	.uleb128 .LVU1029
+	.uleb128 .LVU1041
+	.uleb128 .LVU1144
+	.uleb128 .LVU1156
+	.uleb128 .LVU1236
+	.uleb128 .LVU1248
+	.uleb128 .LVU1351
+	.uleb128 .LVU1363
+	.uleb128 .LVU1443
+	.uleb128 .LVU1455
+	.uleb128 .LVU1558
+	.uleb128 .LVU1570
+	.uleb128 .LVU1650
+	.uleb128 .LVU1662
+	.uleb128 .LVU1765
+	.uleb128 .LVU1777
+	.uleb128 .LVU1856
+	.uleb128 .LVU1868
+	.uleb128 .LVU1969
+	.uleb128 .LVU1981
+	.uleb128 .LVU2055
+	.uleb128 .LVU2069
+	.uleb128 0
+.LLST9:
+	.byte	0x4
+	.uleb128 .LVL10-.Ltext0
+	.uleb128 .LVL20-.Ltext0
+	.uleb128 0x1
+	.byte	0x63
+	.byte	0x4
+	.uleb128 .LVL22-.Ltext0
+	.uleb128 .LVL36-.Ltext0
+	.uleb128 0x1
+	.byte	0x63
+	.byte	0x4
+	.uleb128 .LVL38-.Ltext0
+	.uleb128 .LVL52-.Ltext0
+	.uleb128 0x1
+	.byte	0x63
+	.byte	0x4
+	.uleb128 .LVL54-.Ltext0
+	.uleb128 .LVL68-.Ltext0
+	.uleb128 0x1
+	.byte	0x63
+	.byte	0x4
+	.uleb128 .LVL70-.Ltext0
+	.uleb128 .LVL84-.Ltext0
+	.uleb128 0x1
+	.byte	0x63
+	.byte	0x4
+	.uleb128 .LVL86-.Ltext0
+	.uleb128 .LVL100-.Ltext0
+	.uleb128 0x1
+	.byte	0x63
+	.byte	0x4
+	.uleb128 .LVL102-.Ltext0
+	.uleb128 .LVL116-.Ltext0
+	.uleb128 0x1
+	.byte	0x63
+	.byte	0x4
+	.uleb128 .LVL118-.Ltext0
+	.uleb128 .LVL132-.Ltext0
+	.uleb128 0x1
+	.byte	0x63
+	.byte	0x4
+	.uleb128 .LVL134-.Ltext0
+	.uleb128 .LVL148-.Ltext0
+	.uleb128 0x1
+	.byte	0x63
+	.byte	0x4
+	.uleb128 .LVL150-.Ltext0
+	.uleb128 .LVL164-.Ltext0
+	.uleb128 0x1
+	.byte	0x63
+	.byte	0x4
+	.uleb128 .LVL166-.Ltext0
+	.uleb128 .LVL180-.Ltext0
+	.uleb128 0x1
+	.byte	0x63
+	.byte	0x4
+	.uleb128 .LVL182-.Ltext0
+	.uleb128 .LVL196-.Ltext0
+	.uleb128 0x1
+	.byte	0x63
+	.byte	0x4
+	.uleb128 .LVL198-.Ltext0
+	.uleb128 .LVL212-.Ltext0
+	.uleb128 0x1
+	.byte	0x63
+	.byte	0x4
+	.uleb128 .LVL214-.Ltext0
+	.uleb128 .LVL228-.Ltext0
+	.uleb128 0x1
+	.byte	0x63
+	.byte	0x4
+	.uleb128 .LVL230-.Ltext0
+	.uleb128 .LVL244-.Ltext0
+	.uleb128 0x1
+	.byte	0x63
+	.byte	0x4
+	.uleb128 .LVL246-.Ltext0
+	.uleb128 .LVL260-.Ltext0
+	.uleb128 0x1
+	.byte	0x63
+	.byte	0x4
+	.uleb128 .LVL262-.Ltext0
+	.uleb128 .LVL276-.Ltext0
+	.uleb128 0x1
+	.byte	0x63
+	.byte	0x4
+	.uleb128 .LVL278-.Ltext0
+	.uleb128 .LVL294-.Ltext0
+	.uleb128 0x1
+	.byte	0x63
+	.byte	0x4
+	.uleb128 .LVL296-.Ltext0
+	.uleb128 .LVL310-.Ltext0
+	.uleb128 0x1
+	.byte	0x63
+	.byte	0x4
+	.uleb128 .LVL312-.Ltext0
+	.uleb128 .LVL326-.Ltext0
+	.uleb128 0x1
+	.byte	0x63
+	.byte	0x4
+	.uleb128 .LVL328-.Ltext0
+	.uleb128 .LFE6406-.Ltext0
+	.uleb128 0x1
+	.byte	0x63
+	.byte	0
+.LVUS11:
+	.uleb128 .LVU14
+	.uleb128 .LVU39
+.LLST11:
+	.byte	0x4
+	.uleb128 .LVL3-.Ltext0
+	.uleb128 .LVL7-.Ltext0
+	.uleb128 0x1
+	.byte	0x61
+	.byte	0
+.LVUS12:
+	.uleb128 .LVU19
+	.uleb128 .LVU41
+.LLST12:
+	.byte	0x4
+	.uleb128 .LVL4-.Ltext0
+	.uleb128 .LVL8-.Ltext0
+	.uleb128 0x1
+	.byte	0x69
+	.byte	0
+.LVUS14:
+	.uleb128 .LVU5
+	.uleb128 .LVU14
+.LLST14:
+	.byte	0x4
+	.uleb128 .LVL0-.Ltext0
+	.uleb128 .LVL3-.Ltext0
+	.uleb128 0x1
+	.byte	0x65
+	.byte	0
+.LVUS15:
+	.uleb128 .LVU5
+	.uleb128 .LVU14
+.LLST15:
+	.byte	0x4
+	.uleb128 .LVL0-.Ltext0
+	.uleb128 .LVL3-.Ltext0
+	.uleb128 0x1
+	.byte	0x64
+	.byte	0
+.LVUS17:
+	.uleb128 .LVU16
+	.uleb128 .LVU19
+.LLST17:
+	.byte	0x4
+	.uleb128 .LVL3-.Ltext0
+	.uleb128 .LVL4-.Ltext0
+	.uleb128 0x1
+	.byte	0x65
+	.byte	0
+.LVUS18:
+	.uleb128 .LVU16
+	.uleb128 .LVU19
+.LLST18:
+	.byte	0x4
+	.uleb128 .LVL3-.Ltext0
+	.uleb128 .LVL4-.Ltext0
+	.uleb128 0x1
+	.byte	0x64
+	.byte	0
+.LVUS20:
+	.uleb128 .LVU44
+	.uleb128 .LVU46
+.LLST20:
+	.byte	0x4
+	.uleb128 .LVL8-.Ltext0
+	.uleb128 .LVL8-.Ltext0
+	.uleb128 0x1
+	.byte	0x62
+	.byte	0
+.LVUS21:
+	.uleb128 .LVU21
+	.uleb128 .LVU23
+.LLST21:
+	.byte	0x4
+	.uleb128 .LVL4-.Ltext0
+	.uleb128 .LVL4-.Ltext0
+	.uleb128 0x1
+	.byte	0x61
+	.byte	0
+.LVUS23:
+	.uleb128 .LVU25
+	.uleb128 .LVU29
+.LLST23:
+	.byte	0x4
+	.uleb128 .LVL4-.Ltext0
+	.uleb128 .LVL5-.Ltext0
+	.uleb128 0x2
+	.byte	0x31
+	.byte	0x9f
+	.byte	0
+.LVUS24:
+	.uleb128 .LVU25
+	.uleb128 .LVU29
+.LLST24:
+	.byte	0x4
+	.uleb128 .LVL4-.Ltext0
+	.uleb128 .LVL5-.Ltext0
+	.uleb128 0x1
+	.byte	0x61
+	.byte	0
+.LVUS26:
+	.uleb128 .LVU31
+	.uleb128 .LVU34
+.LLST26:
+	.byte	0x4
+	.uleb128 .LVL5-.Ltext0
+	.uleb128 .LVL6-.Ltext0
+	.uleb128 0x1
+	.byte	0x69
+	.byte	0
+.LVUS28:
+	.uleb128 .LVU36
+	.uleb128 .LVU41
+.LLST28:
+	.byte	0x4
+	.uleb128 .LVL6-.Ltext0
+	.uleb128 .LVL8-.Ltext0
+	.uleb128 0x2
+	.byte	0x31
+	.byte	0x9f
+	.byte	0
+.LVUS29:
+	.uleb128 .LVU36
+	.uleb128 .LVU41
+.LLST29:
+	.byte	0x4
+	.uleb128 .LVL6-.Ltext0
+	.uleb128 .LVL8-.Ltext0
+	.uleb128 0x1
+	.byte	0x69
+	.byte	0
+.LVUS31:
+	.uleb128 .LVU51
+	.uleb128 .LVU53
+.LLST31:
+	.byte	0x4
+	.uleb128 .LVL8-.Ltext0
+	.uleb128 .LVL8-.Ltext0
+	.uleb128 0x1
+	.byte	0x68
+	.byte	0
+.LVUS32:
+	.uleb128 .LVU51
+	.uleb128 .LVU53
+.LLST32:
+	.byte	0x4
+	.uleb128 .LVL8-.Ltext0
+	.uleb128 .LVL8-.Ltext0
+	.uleb128 0x1
+	.byte	0x63
+	.byte	0
+.LVUS34:
+	.uleb128 .LVU53
+	.uleb128 .LVU58
+.LLST34:
+	.byte	0x4
+	.uleb128 .LVL8-.Ltext0
+	.uleb128 .LVL9-.Ltext0
+	.uleb128 0x2
+	.byte	0x40
+	.byte	0x9f
+	.byte	0
+.LVUS35:
+	.uleb128 .LVU53
+	.uleb128 .LVU58
+.LLST35:
+	.byte	0x4
+	.uleb128 .LVL8-.Ltext0
+	.uleb128 .LVL9-.Ltext0
+	.uleb128 0x1
+	.byte	0x61
+	.byte	0
+.LVUS36:
+	.uleb128 .LVU60
+	.uleb128 .LVU63
+.LLST36:
+	.byte	0x4
+	.uleb128 .LVL9-.Ltext0
+	.uleb128 .LVL10-.Ltext0
+	.uleb128 0x1
+	.byte	0x61
+	.byte	0
+.LVUS38:
+	.uleb128 .LVU65
+	.uleb128 .LVU67
+.LLST38:
+	.byte	0x4
+	.uleb128 .LVL10-.Ltext0
+	.uleb128 .LVL10-.Ltext0
+	.uleb128 0x1
+	.byte	0x63
+	.byte	0
+.LVUS39:
+	.uleb128 .LVU65
+	.uleb128 .LVU67
+.LLST39:
+	.byte	0x4
+	.uleb128 .LVL10-.Ltext0
+	.uleb128 .LVL10-.Ltext0
+	.uleb128 0x1
+	.byte	0x62
+	.byte	0
+.LVUS41:
+	.uleb128 .LVU67
+	.uleb128 .LVU73
+.LLST41:
+	.byte	0x4
+	.uleb128 .LVL10-.Ltext0
+	.uleb128 .LVL12-.Ltext0
+	.uleb128 0x2
+	.byte	0x3c
+	.byte	0x9f
+	.byte	0
+.LVUS42:
+	.uleb128 .LVU71
+	.uleb128 .LVU73
+.LLST42:
+	.byte	0x4
+	.uleb128 .LVL11-.Ltext0
+	.uleb128 .LVL12-.Ltext0
+	.uleb128 0x1
+	.byte	0x62
+	.byte	0
+.LVUS43:
+	.uleb128 .LVU75
+	.uleb128 .LVU77
+.LLST43:
+	.byte	0x4
+	.uleb128 .LVL12-.Ltext0
+	.uleb128 .LVL12-.Ltext0
+	.uleb128 0x1
+	.byte	0x62
+	.byte	0
+.LVUS44:
+	.uleb128 .LVU75
+	.uleb128 .LVU77
+.LLST44:
+	.byte	0x4
+	.uleb128 .LVL12-.Ltext0
+	.uleb128 .LVL12-.Ltext0
+	.uleb128 0x1
+	.byte	0x68
+	.byte	0
+.LVUS45:
+	.uleb128 .LVU77
+	.uleb128 .LVU81
+.LLST45:
+	.byte	0x4
+	.uleb128 .LVL12-.Ltext0
+	.uleb128 .LVL13-.Ltext0
+	.uleb128 0x1
+	.byte	0x66
+	.byte	0
+.LVUS47:
+	.uleb128 .LVU84
+	.uleb128 .LVU86
+.LLST47:
+	.byte	0x4
+	.uleb128 .LVL14-.Ltext0
+	.uleb128 .LVL14-.Ltext0
+	.uleb128 0x1
+	.byte	0x66
+	.byte	0
+.LVUS48:
+	.uleb128 .LVU84
+	.uleb128 .LVU86
+.LLST48:
+	.byte	0x4
+	.uleb128 .LVL14-.Ltext0
+	.uleb128 .LVL14-.Ltext0
+	.uleb128 0x1
+	.byte	0x61
+	.byte	0
+.LVUS50:
+	.uleb128 .LVU86
+	.uleb128 .LVU92
+.LLST50:
+	.byte	0x4
+	.uleb128 .LVL14-.Ltext0
+	.uleb128 .LVL16-.Ltext0
+	.uleb128 0x2
+	.byte	0x38
+	.byte	0x9f
+	.byte	0
+.LVUS51:
+	.uleb128 .LVU90
+	.uleb128 .LVU92
+.LLST51:
+	.byte	0x4
+	.uleb128 .LVL15-.Ltext0
+	.uleb128 .LVL16-.Ltext0
+	.uleb128 0x1
+	.byte	0x61
+	.byte	0
+.LVUS52:
+	.uleb128 .LVU94
+	.uleb128 .LVU97
+.LLST52:
+	.byte	0x4
+	.uleb128 .LVL16-.Ltext0
+	.uleb128 .LVL17-.Ltext0
+	.uleb128 0x1
+	.byte	0x61
+	.byte	0
+.LVUS53:
+	.uleb128 .LVU94
+	.uleb128 .LVU97
+.LLST53:
+	.byte	0x4
+	.uleb128 .LVL16-.Ltext0
+	.uleb128 .LVL17-.Ltext0
+	.uleb128 0x1
+	.byte	0x63
+	.byte	0
+.LVUS55:
+	.uleb128 .LVU99
+	.uleb128 .LVU101
+.LLST55:
+	.byte	0x4
+	.uleb128 .LVL17-.Ltext0
+	.uleb128 .LVL17-.Ltext0
+	.uleb128 0x1
+	.byte	0x63
+	.byte	0
+.LVUS56:
+	.uleb128 .LVU99
+	.uleb128 .LVU101
+.LLST56:
+	.byte	0x4
+	.uleb128 .LVL17-.Ltext0
+	.uleb128 .LVL17-.Ltext0
+	.uleb128 0x1
+	.byte	0x62
+	.byte	0
+.LVUS58:
+	.uleb128 .LVU101
+	.uleb128 .LVU111
+.LLST58:
+	.byte	0x4
+	.uleb128 .LVL17-.Ltext0
+	.uleb128 .LVL21-.Ltext0
+	.uleb128 0x2
+	.byte	0x37
+	.byte	0x9f
+	.byte	0
+.LVUS59:
+	.uleb128 .LVU107
+	.uleb128 .LVU111
+.LLST59:
+	.byte	0x4
+	.uleb128 .LVL19-.Ltext0
+	.uleb128 .LVL21-.Ltext0
+	.uleb128 0x1
+	.byte	0x62
+	.byte	0
+.LVUS61:
+	.uleb128 .LVU123
+	.uleb128 .LVU125
+.LLST61:
+	.byte	0x4
+	.uleb128 .LVL22-.Ltext0
+	.uleb128 .LVL22-.Ltext0
+	.uleb128 0x3
+	.byte	0x8
+	.byte	0x93
+	.byte	0x9f
+	.byte	0
+.LVUS63:
+	.uleb128 .LVU119
+	.uleb128 .LVU121
+.LLST63:
+	.byte	0x4
+	.uleb128 .LVL22-.Ltext0
+	.uleb128 .LVL22-.Ltext0
+	.uleb128 0x3
+	.byte	0x8
+	.byte	0x4e
+	.byte	0x9f
+	.byte	0
+.LVUS64:
+	.uleb128 .LVU114
+	.uleb128 .LVU117
+.LLST64:
+	.byte	0x4
+	.uleb128 .LVL21-.Ltext0
+	.uleb128 .LVL22-.Ltext0
+	.uleb128 0x3
+	.byte	0x8
+	.byte	0x39
+	.byte	0x9f
+	.byte	0
+.LVUS65:
+	.uleb128 .LVU114
+	.uleb128 .LVU117
+.LLST65:
+	.byte	0x4
+	.uleb128 .LVL21-.Ltext0
+	.uleb128 .LVL22-.Ltext0
+	.uleb128 0x1
+	.byte	0x62
+	.byte	0
+.LVUS66:
+	.uleb128 .LVU128
+	.uleb128 .LVU130
+.LLST66:
+	.byte	0x4
+	.uleb128 .LVL22-.Ltext0
+	.uleb128 .LVL22-.Ltext0
+	.uleb128 0x1
+	.byte	0x62
+	.byte	0
+.LVUS67:
+	.uleb128 .LVU128
+	.uleb128 .LVU130
+.LLST67:
+	.byte	0x4
+	.uleb128 .LVL22-.Ltext0
+	.uleb128 .LVL22-.Ltext0
+	.uleb128 0x1
+	.byte	0x66
+	.byte	0
+.LVUS69:
+	.uleb128 .LVU136
+	.uleb128 .LVU138
+.LLST69:
+	.byte	0x4
+	.uleb128 .LVL23-.Ltext0
+	.uleb128 .LVL23-.Ltext0
+	.uleb128 0x1
+	.byte	0x66
+	.byte	0
+.LVUS70:
+	.uleb128 .LVU136
+	.uleb128 .LVU138
+.LLST70:
+	.byte	0x4
+	.uleb128 .LVL23-.Ltext0
+	.uleb128 .LVL23-.Ltext0
+	.uleb128 0x1
+	.byte	0x61
+	.byte	0
+.LVUS72:
+	.uleb128 .LVU138
+	.uleb128 .LVU146
+.LLST72:
+	.byte	0x4
+	.uleb128 .LVL23-.Ltext0
+	.uleb128 .LVL25-.Ltext0
+	.uleb128 0x2
+	.byte	0x40
+	.byte	0x9f
+	.byte	0
+.LVUS73:
+	.uleb128 .LVU144
+	.uleb128 .LVU146
+.LLST73:
+	.byte	0x4
+	.uleb128 .LVL24-.Ltext0
+	.uleb128 .LVL25-.Ltext0
+	.uleb128 0x1
+	.byte	0x61
+	.byte	0
+.LVUS74:
+	.uleb128 .LVU148
+	.uleb128 .LVU151
+.LLST74:
+	.byte	0x4
+	.uleb128 .LVL25-.Ltext0
+	.uleb128 .LVL26-.Ltext0
+	.uleb128 0x1
+	.byte	0x61
+	.byte	0
+.LVUS75:
+	.uleb128 .LVU148
+	.uleb128 .LVU151
+.LLST75:
+	.byte	0x4
+	.uleb128 .LVL25-.Ltext0
+	.uleb128 .LVL26-.Ltext0
+	.uleb128 0x1
+	.byte	0x63
+	.byte	0
+.LVUS77:
+	.uleb128 .LVU153
+	.uleb128 .LVU155
+.LLST77:
+	.byte	0x4
+	.uleb128 .LVL26-.Ltext0
+	.uleb128 .LVL26-.Ltext0
+	.uleb128 0x1
+	.byte	0x63
+	.byte	0
+.LVUS78:
+	.uleb128 .LVU153
+	.uleb128 .LVU155
+.LLST78:
+	.byte	0x4
+	.uleb128 .LVL26-.Ltext0
+	.uleb128 .LVL26-.Ltext0
+	.uleb128 0x1
+	.byte	0x62
+	.byte	0
+.LVUS80:
+	.uleb128 .LVU155
+	.uleb128 .LVU161
+.LLST80:
+	.byte	0x4
+	.uleb128 .LVL26-.Ltext0
+	.uleb128 .LVL28-.Ltext0
+	.uleb128 0x2
+	.byte	0x3c
+	.byte	0x9f
+	.byte	0
+.LVUS81:
+	.uleb128 .LVU159
+	.uleb128 .LVU161
+.LLST81:
+	.byte	0x4
+	.uleb128 .LVL27-.Ltext0
+	.uleb128 .LVL28-.Ltext0
+	.uleb128 0x1
+	.byte	0x62
+	.byte	0
+.LVUS82:
+	.uleb128 .LVU163
+	.uleb128 .LVU165
+.LLST82:
+	.byte	0x4
+	.uleb128 .LVL28-.Ltext0
+	.uleb128 .LVL28-.Ltext0
+	.uleb128 0x1
+	.byte	0x62
+	.byte	0
+.LVUS83:
+	.uleb128 .LVU163
+	.uleb128 .LVU165
+.LLST83:
+	.byte	0x4
+	.uleb128 .LVL28-.Ltext0
+	.uleb128 .LVL28-.Ltext0
+	.uleb128 0x1
+	.byte	0x66
+	.byte	0
+.LVUS84:
+	.uleb128 .LVU165
+	.uleb128 .LVU169
+.LLST84:
+	.byte	0x4
+	.uleb128 .LVL28-.Ltext0
+	.uleb128 .LVL29-.Ltext0
+	.uleb128 0x1
+	.byte	0x69
+	.byte	0
+.LVUS86:
+	.uleb128 .LVU172
+	.uleb128 .LVU174
+.LLST86:
+	.byte	0x4
+	.uleb128 .LVL30-.Ltext0
+	.uleb128 .LVL30-.Ltext0
+	.uleb128 0x1
+	.byte	0x69
+	.byte	0
+.LVUS87:
+	.uleb128 .LVU172
+	.uleb128 .LVU174
+.LLST87:
+	.byte	0x4
+	.uleb128 .LVL30-.Ltext0
+	.uleb128 .LVL30-.Ltext0
+	.uleb128 0x1
+	.byte	0x61
+	.byte	0
+.LVUS89:
+	.uleb128 .LVU174
+	.uleb128 .LVU181
+.LLST89:
+	.byte	0x4
+	.uleb128 .LVL30-.Ltext0
+	.uleb128 .LVL32-.Ltext0
+	.uleb128 0x2
+	.byte	0x38
+	.byte	0x9f
+	.byte	0
+.LVUS90:
+	.uleb128 .LVU179
+	.uleb128 .LVU181
+.LLST90:
+	.byte	0x4
+	.uleb128 .LVL31-.Ltext0
+	.uleb128 .LVL32-.Ltext0
+	.uleb128 0x1
+	.byte	0x61
+	.byte	0
+.LVUS92:
+	.uleb128 .LVU183
+	.uleb128 .LVU189
+.LLST92:
+	.byte	0x4
+	.uleb128 .LVL32-.Ltext0
+	.uleb128 .LVL33-.Ltext0
+	.uleb128 0x1
+	.byte	0x61
+	.byte	0
+.LVUS93:
+	.uleb128 .LVU183
+	.uleb128 .LVU189
+.LLST93:
+	.byte	0x4
+	.uleb128 .LVL32-.Ltext0
+	.uleb128 .LVL33-.Ltext0
+	.uleb128 0x1
+	.byte	0x63
+	.byte	0
+.LVUS95:
+	.uleb128 .LVU191
+	.uleb128 .LVU193
+.LLST95:
+	.byte	0x4
+	.uleb128 .LVL33-.Ltext0
+	.uleb128 .LVL33-.Ltext0
+	.uleb128 0x1
+	.byte	0x63
+	.byte	0
+.LVUS96:
+	.uleb128 .LVU191
+	.uleb128 .LVU193
+.LLST96:
+	.byte	0x4
+	.uleb128 .LVL33-.Ltext0
+	.uleb128 .LVL33-.Ltext0
+	.uleb128 0x1
+	.byte	0x62
+	.byte	0
+.LVUS98:
+	.uleb128 .LVU193
+	.uleb128 .LVU203
+.LLST98:
+	.byte	0x4
+	.uleb128 .LVL33-.Ltext0
+	.uleb128 .LVL37-.Ltext0
+	.uleb128 0x2
+	.byte	0x37
+	.byte	0x9f
+	.byte	0
+.LVUS99:
+	.uleb128 .LVU199
+	.uleb128 .LVU203
+.LLST99:
+	.byte	0x4
+	.uleb128 .LVL35-.Ltext0
+	.uleb128 .LVL37-.Ltext0
+	.uleb128 0x1
+	.byte	0x62
+	.byte	0
+.LVUS101:
+	.uleb128 .LVU215
+	.uleb128 .LVU217
+.LLST101:
+	.byte	0x4
+	.uleb128 .LVL38-.Ltext0
+	.uleb128 .LVL38-.Ltext0
+	.uleb128 0x3
+	.byte	0x8
+	.byte	0x39
+	.byte	0x9f
+	.byte	0
+.LVUS103:
+	.uleb128 .LVU211
+	.uleb128 .LVU213
+.LLST103:
+	.byte	0x4
+	.uleb128 .LVL38-.Ltext0
+	.uleb128 .LVL38-.Ltext0
+	.uleb128 0x3
+	.byte	0x8
+	.byte	0x4e
+	.byte	0x9f
+	.byte	0
+.LVUS104:
+	.uleb128 .LVU206
+	.uleb128 .LVU209
+.LLST104:
+	.byte	0x4
+	.uleb128 .LVL37-.Ltext0
+	.uleb128 .LVL38-.Ltext0
+	.uleb128 0x3
+	.byte	0x8
+	.byte	0x93
+	.byte	0x9f
+	.byte	0
+.LVUS105:
+	.uleb128 .LVU206
+	.uleb128 .LVU209
+.LLST105:
+	.byte	0x4
+	.uleb128 .LVL37-.Ltext0
+	.uleb128 .LVL38-.Ltext0
+	.uleb128 0x1
+	.byte	0x62
+	.byte	0
+.LVUS108:
+	.uleb128 .LVU226
+	.uleb128 .LVU228
+.LLST108:
+	.byte	0x4
+	.uleb128 .LVL38-.Ltext0
+	.uleb128 .LVL38-.Ltext0
+	.uleb128 0x1
+	.byte	0x65
+	.byte	0
+.LVUS109:
+	.uleb128 .LVU226
+	.uleb128 .LVU228
+.LLST109:
+	.byte	0x4
+	.uleb128 .LVL38-.Ltext0
+	.uleb128 .LVL38-.Ltext0
+	.uleb128 0x1
+	.byte	0x64
+	.byte	0
+.LVUS112:
+	.uleb128 .LVU242
+	.uleb128 .LVU244
+.LLST112:
+	.byte	0x4
+	.uleb128 .LVL38-.Ltext0
+	.uleb128 .LVL38-.Ltext0
+	.uleb128 0x2
+	.byte	0x31
+	.byte	0x9f
+	.byte	0
+.LVUS114:
+	.uleb128 .LVU222
+	.uleb128 .LVU224
+.LLST114:
+	.byte	0x4
+	.uleb128 .LVL38-.Ltext0
+	.uleb128 .LVL38-.Ltext0
+	.uleb128 0x1
+	.byte	0x65
+	.byte	0
+.LVUS115:
+	.uleb128 .LVU222
+	.uleb128 .LVU224
+.LLST115:
+	.byte	0x4
+	.uleb128 .LVL38-.Ltext0
+	.uleb128 .LVL38-.Ltext0
+	.uleb128 0x1
+	.byte	0x64
+	.byte	0
+.LVUS118:
+	.uleb128 .LVU234
+	.uleb128 .LVU236
+.LLST118:
+	.byte	0x4
+	.uleb128 .LVL38-.Ltext0
+	.uleb128 .LVL38-.Ltext0
+	.uleb128 0x2
+	.byte	0x31
+	.byte	0x9f
+	.byte	0
+.LVUS119:
+	.uleb128 .LVU247
+	.uleb128 .LVU249
+.LLST119:
+	.byte	0x4
+	.uleb128 .LVL38-.Ltext0
+	.uleb128 .LVL38-.Ltext0
+	.uleb128 0x1
+	.byte	0x62
+	.byte	0
+.LVUS120:
+	.uleb128 .LVU247
+	.uleb128 .LVU249
+.LLST120:
+	.byte	0x4
+	.uleb128 .LVL38-.Ltext0
+	.uleb128 .LVL38-.Ltext0
+	.uleb128 0x1
+	.byte	0x69
+	.byte	0
+.LVUS122:
+	.uleb128 .LVU255
+	.uleb128 .LVU257
+.LLST122:
+	.byte	0x4
+	.uleb128 .LVL39-.Ltext0
+	.uleb128 .LVL39-.Ltext0
+	.uleb128 0x1
+	.byte	0x68
+	.byte	0
+.LVUS123:
+	.uleb128 .LVU255
+	.uleb128 .LVU257
+.LLST123:
+	.byte	0x4
+	.uleb128 .LVL39-.Ltext0
+	.uleb128 .LVL39-.Ltext0
+	.uleb128 0x1
+	.byte	0x61
+	.byte	0
+.LVUS125:
+	.uleb128 .LVU257
+	.uleb128 .LVU264
+.LLST125:
+	.byte	0x4
+	.uleb128 .LVL39-.Ltext0
+	.uleb128 .LVL41-.Ltext0
+	.uleb128 0x2
+	.byte	0x40
+	.byte	0x9f
+	.byte	0
+.LVUS126:
+	.uleb128 .LVU262
+	.uleb128 .LVU264
+.LLST126:
+	.byte	0x4
+	.uleb128 .LVL40-.Ltext0
+	.uleb128 .LVL41-.Ltext0
+	.uleb128 0x1
+	.byte	0x61
+	.byte	0
+.LVUS128:
+	.uleb128 .LVU266
+	.uleb128 .LVU270
+.LLST128:
+	.byte	0x4
+	.uleb128 .LVL41-.Ltext0
+	.uleb128 .LVL42-.Ltext0
+	.uleb128 0x1
+	.byte	0x61
+	.byte	0
+.LVUS129:
+	.uleb128 .LVU266
+	.uleb128 .LVU270
+.LLST129:
+	.byte	0x4
+	.uleb128 .LVL41-.Ltext0
+	.uleb128 .LVL42-.Ltext0
+	.uleb128 0x1
+	.byte	0x63
+	.byte	0
+.LVUS131:
+	.uleb128 .LVU272
+	.uleb128 .LVU274
+.LLST131:
+	.byte	0x4
+	.uleb128 .LVL42-.Ltext0
+	.uleb128 .LVL42-.Ltext0
+	.uleb128 0x1
+	.byte	0x63
+	.byte	0
+.LVUS132:
+	.uleb128 .LVU272
+	.uleb128 .LVU274
+.LLST132:
+	.byte	0x4
+	.uleb128 .LVL42-.Ltext0
+	.uleb128 .LVL42-.Ltext0
+	.uleb128 0x1
+	.byte	0x62
+	.byte	0
+.LVUS134:
+	.uleb128 .LVU274
+	.uleb128 .LVU280
+.LLST134:
+	.byte	0x4
+	.uleb128 .LVL42-.Ltext0
+	.uleb128 .LVL44-.Ltext0
+	.uleb128 0x2
+	.byte	0x3c
+	.byte	0x9f
+	.byte	0
+.LVUS135:
+	.uleb128 .LVU278
+	.uleb128 .LVU280
+.LLST135:
+	.byte	0x4
+	.uleb128 .LVL43-.Ltext0
+	.uleb128 .LVL44-.Ltext0
+	.uleb128 0x1
+	.byte	0x62
+	.byte	0
+.LVUS136:
+	.uleb128 .LVU282
+	.uleb128 .LVU284
+.LLST136:
+	.byte	0x4
+	.uleb128 .LVL44-.Ltext0
+	.uleb128 .LVL44-.Ltext0
+	.uleb128 0x1
+	.byte	0x62
+	.byte	0
+.LVUS137:
+	.uleb128 .LVU282
+	.uleb128 .LVU284
+.LLST137:
+	.byte	0x4
+	.uleb128 .LVL44-.Ltext0
+	.uleb128 .LVL44-.Ltext0
+	.uleb128 0x1
+	.byte	0x68
+	.byte	0
+.LVUS138:
+	.uleb128 .LVU284
+	.uleb128 .LVU288
+.LLST138:
+	.byte	0x4
+	.uleb128 .LVL44-.Ltext0
+	.uleb128 .LVL45-.Ltext0
+	.uleb128 0x1
+	.byte	0x66
+	.byte	0
+.LVUS140:
+	.uleb128 .LVU291
+	.uleb128 .LVU293
+.LLST140:
+	.byte	0x4
+	.uleb128 .LVL46-.Ltext0
+	.uleb128 .LVL46-.Ltext0
+	.uleb128 0x1
+	.byte	0x66
+	.byte	0
+.LVUS141:
+	.uleb128 .LVU291
+	.uleb128 .LVU293
+.LLST141:
+	.byte	0x4
+	.uleb128 .LVL46-.Ltext0
+	.uleb128 .LVL46-.Ltext0
+	.uleb128 0x1
+	.byte	0x61
+	.byte	0
+.LVUS143:
+	.uleb128 .LVU293
+	.uleb128 .LVU299
+.LLST143:
+	.byte	0x4
+	.uleb128 .LVL46-.Ltext0
+	.uleb128 .LVL48-.Ltext0
+	.uleb128 0x2
+	.byte	0x38
+	.byte	0x9f
+	.byte	0
+.LVUS144:
+	.uleb128 .LVU297
+	.uleb128 .LVU299
+.LLST144:
+	.byte	0x4
+	.uleb128 .LVL47-.Ltext0
+	.uleb128 .LVL48-.Ltext0
+	.uleb128 0x1
+	.byte	0x61
+	.byte	0
+.LVUS145:
+	.uleb128 .LVU301
+	.uleb128 .LVU304
+.LLST145:
+	.byte	0x4
+	.uleb128 .LVL48-.Ltext0
+	.uleb128 .LVL49-.Ltext0
+	.uleb128 0x1
+	.byte	0x61
+	.byte	0
+.LVUS146:
+	.uleb128 .LVU301
+	.uleb128 .LVU304
+.LLST146:
+	.byte	0x4
+	.uleb128 .LVL48-.Ltext0
+	.uleb128 .LVL49-.Ltext0
+	.uleb128 0x1
+	.byte	0x63
+	.byte	0
+.LVUS148:
+	.uleb128 .LVU306
+	.uleb128 .LVU308
+.LLST148:
+	.byte	0x4
+	.uleb128 .LVL49-.Ltext0
+	.uleb128 .LVL49-.Ltext0
+	.uleb128 0x1
+	.byte	0x63
+	.byte	0
+.LVUS149:
+	.uleb128 .LVU306
+	.uleb128 .LVU308
+.LLST149:
+	.byte	0x4
+	.uleb128 .LVL49-.Ltext0
+	.uleb128 .LVL49-.Ltext0
+	.uleb128 0x1
+	.byte	0x62
+	.byte	0
+.LVUS151:
+	.uleb128 .LVU308
+	.uleb128 .LVU318
+.LLST151:
+	.byte	0x4
+	.uleb128 .LVL49-.Ltext0
+	.uleb128 .LVL53-.Ltext0
+	.uleb128 0x2
+	.byte	0x37
+	.byte	0x9f
+	.byte	0
+.LVUS152:
+	.uleb128 .LVU314
+	.uleb128 .LVU318
+.LLST152:
+	.byte	0x4
+	.uleb128 .LVL51-.Ltext0
+	.uleb128 .LVL53-.Ltext0
+	.uleb128 0x1
+	.byte	0x62
+	.byte	0
+.LVUS154:
+	.uleb128 .LVU330
+	.uleb128 .LVU332
+.LLST154:
+	.byte	0x4
+	.uleb128 .LVL54-.Ltext0
+	.uleb128 .LVL54-.Ltext0
+	.uleb128 0x3
+	.byte	0x8
+	.byte	0x93
+	.byte	0x9f
+	.byte	0
+.LVUS156:
+	.uleb128 .LVU326
+	.uleb128 .LVU328
+.LLST156:
+	.byte	0x4
+	.uleb128 .LVL54-.Ltext0
+	.uleb128 .LVL54-.Ltext0
+	.uleb128 0x3
+	.byte	0x8
+	.byte	0x4e
+	.byte	0x9f
+	.byte	0
+.LVUS157:
+	.uleb128 .LVU321
+	.uleb128 .LVU324
+.LLST157:
+	.byte	0x4
+	.uleb128 .LVL53-.Ltext0
+	.uleb128 .LVL54-.Ltext0
+	.uleb128 0x3
+	.byte	0x8
+	.byte	0x39
+	.byte	0x9f
+	.byte	0
+.LVUS158:
+	.uleb128 .LVU321
+	.uleb128 .LVU324
+.LLST158:
+	.byte	0x4
+	.uleb128 .LVL53-.Ltext0
+	.uleb128 .LVL54-.Ltext0
+	.uleb128 0x1
+	.byte	0x62
+	.byte	0
+.LVUS159:
+	.uleb128 .LVU335
+	.uleb128 .LVU337
+.LLST159:
+	.byte	0x4
+	.uleb128 .LVL54-.Ltext0
+	.uleb128 .LVL54-.Ltext0
+	.uleb128 0x1
+	.byte	0x62
+	.byte	0
+.LVUS160:
+	.uleb128 .LVU335
+	.uleb128 .LVU337
+.LLST160:
+	.byte	0x4
+	.uleb128 .LVL54-.Ltext0
+	.uleb128 .LVL54-.Ltext0
+	.uleb128 0x1
+	.byte	0x66
+	.byte	0
+.LVUS162:
+	.uleb128 .LVU343
+	.uleb128 .LVU345
+.LLST162:
+	.byte	0x4
+	.uleb128 .LVL55-.Ltext0
+	.uleb128 .LVL55-.Ltext0
+	.uleb128 0x1
+	.byte	0x66
+	.byte	0
+.LVUS163:
+	.uleb128 .LVU343
+	.uleb128 .LVU345
+.LLST163:
+	.byte	0x4
+	.uleb128 .LVL55-.Ltext0
+	.uleb128 .LVL55-.Ltext0
+	.uleb128 0x1
+	.byte	0x61
+	.byte	0
+.LVUS165:
+	.uleb128 .LVU345
+	.uleb128 .LVU353
+.LLST165:
+	.byte	0x4
+	.uleb128 .LVL55-.Ltext0
+	.uleb128 .LVL57-.Ltext0
+	.uleb128 0x2
+	.byte	0x40
+	.byte	0x9f
+	.byte	0
+.LVUS166:
+	.uleb128 .LVU351
+	.uleb128 .LVU353
+.LLST166:
+	.byte	0x4
+	.uleb128 .LVL56-.Ltext0
+	.uleb128 .LVL57-.Ltext0
+	.uleb128 0x1
+	.byte	0x61
+	.byte	0
+.LVUS167:
+	.uleb128 .LVU355
+	.uleb128 .LVU358
+.LLST167:
+	.byte	0x4
+	.uleb128 .LVL57-.Ltext0
+	.uleb128 .LVL58-.Ltext0
+	.uleb128 0x1
+	.byte	0x61
+	.byte	0
+.LVUS168:
+	.uleb128 .LVU355
+	.uleb128 .LVU358
+.LLST168:
+	.byte	0x4
+	.uleb128 .LVL57-.Ltext0
+	.uleb128 .LVL58-.Ltext0
+	.uleb128 0x1
+	.byte	0x63
+	.byte	0
+.LVUS170:
+	.uleb128 .LVU360
+	.uleb128 .LVU362
+.LLST170:
+	.byte	0x4
+	.uleb128 .LVL58-.Ltext0
+	.uleb128 .LVL58-.Ltext0
+	.uleb128 0x1
+	.byte	0x63
+	.byte	0
+.LVUS171:
+	.uleb128 .LVU360
+	.uleb128 .LVU362
+.LLST171:
+	.byte	0x4
+	.uleb128 .LVL58-.Ltext0
+	.uleb128 .LVL58-.Ltext0
+	.uleb128 0x1
+	.byte	0x62
+	.byte	0
+.LVUS173:
+	.uleb128 .LVU362
+	.uleb128 .LVU368
+.LLST173:
+	.byte	0x4
+	.uleb128 .LVL58-.Ltext0
+	.uleb128 .LVL60-.Ltext0
+	.uleb128 0x2
+	.byte	0x3c
+	.byte	0x9f
+	.byte	0
+.LVUS174:
+	.uleb128 .LVU366
+	.uleb128 .LVU368
+.LLST174:
+	.byte	0x4
+	.uleb128 .LVL59-.Ltext0
+	.uleb128 .LVL60-.Ltext0
+	.uleb128 0x1
+	.byte	0x62
+	.byte	0
+.LVUS175:
+	.uleb128 .LVU370
+	.uleb128 .LVU372
+.LLST175:
+	.byte	0x4
+	.uleb128 .LVL60-.Ltext0
+	.uleb128 .LVL60-.Ltext0
+	.uleb128 0x1
+	.byte	0x62
+	.byte	0
+.LVUS176:
+	.uleb128 .LVU370
+	.uleb128 .LVU372
+.LLST176:
+	.byte	0x4
+	.uleb128 .LVL60-.Ltext0
+	.uleb128 .LVL60-.Ltext0
+	.uleb128 0x1
+	.byte	0x66
+	.byte	0
+.LVUS177:
+	.uleb128 .LVU372
+	.uleb128 .LVU376
+.LLST177:
+	.byte	0x4
+	.uleb128 .LVL60-.Ltext0
+	.uleb128 .LVL61-.Ltext0
+	.uleb128 0x1
+	.byte	0x6a
+	.byte	0
+.LVUS179:
+	.uleb128 .LVU379
+	.uleb128 .LVU381
+.LLST179:
+	.byte	0x4
+	.uleb128 .LVL62-.Ltext0
+	.uleb128 .LVL62-.Ltext0
+	.uleb128 0x1
+	.byte	0x6a
+	.byte	0
+.LVUS180:
+	.uleb128 .LVU379
+	.uleb128 .LVU381
+.LLST180:
+	.byte	0x4
+	.uleb128 .LVL62-.Ltext0
+	.uleb128 .LVL62-.Ltext0
+	.uleb128 0x1
+	.byte	0x61
+	.byte	0
+.LVUS182:
+	.uleb128 .LVU381
+	.uleb128 .LVU388
+.LLST182:
+	.byte	0x4
+	.uleb128 .LVL62-.Ltext0
+	.uleb128 .LVL64-.Ltext0
+	.uleb128 0x2
+	.byte	0x38
+	.byte	0x9f
+	.byte	0
+.LVUS183:
+	.uleb128 .LVU386
+	.uleb128 .LVU388
+.LLST183:
+	.byte	0x4
+	.uleb128 .LVL63-.Ltext0
+	.uleb128 .LVL64-.Ltext0
+	.uleb128 0x1
+	.byte	0x61
+	.byte	0
+.LVUS185:
+	.uleb128 .LVU390
+	.uleb128 .LVU396
+.LLST185:
+	.byte	0x4
+	.uleb128 .LVL64-.Ltext0
+	.uleb128 .LVL65-.Ltext0
+	.uleb128 0x1
+	.byte	0x61
+	.byte	0
+.LVUS186:
+	.uleb128 .LVU390
+	.uleb128 .LVU396
+.LLST186:
+	.byte	0x4
+	.uleb128 .LVL64-.Ltext0
+	.uleb128 .LVL65-.Ltext0
+	.uleb128 0x1
+	.byte	0x63
+	.byte	0
+.LVUS188:
+	.uleb128 .LVU398
+	.uleb128 .LVU400
+.LLST188:
+	.byte	0x4
+	.uleb128 .LVL65-.Ltext0
+	.uleb128 .LVL65-.Ltext0
+	.uleb128 0x1
+	.byte	0x63
+	.byte	0
+.LVUS189:
+	.uleb128 .LVU398
+	.uleb128 .LVU400
+.LLST189:
+	.byte	0x4
+	.uleb128 .LVL65-.Ltext0
+	.uleb128 .LVL65-.Ltext0
+	.uleb128 0x1
+	.byte	0x62
+	.byte	0
+.LVUS191:
+	.uleb128 .LVU400
+	.uleb128 .LVU410
+.LLST191:
+	.byte	0x4
+	.uleb128 .LVL65-.Ltext0
+	.uleb128 .LVL69-.Ltext0
+	.uleb128 0x2
+	.byte	0x37
+	.byte	0x9f
+	.byte	0
+.LVUS192:
+	.uleb128 .LVU406
+	.uleb128 .LVU410
+.LLST192:
+	.byte	0x4
+	.uleb128 .LVL67-.Ltext0
+	.uleb128 .LVL69-.Ltext0
+	.uleb128 0x1
+	.byte	0x62
+	.byte	0
+.LVUS194:
+	.uleb128 .LVU422
+	.uleb128 .LVU424
+.LLST194:
+	.byte	0x4
+	.uleb128 .LVL70-.Ltext0
+	.uleb128 .LVL70-.Ltext0
+	.uleb128 0x3
+	.byte	0x8
+	.byte	0x39
+	.byte	0x9f
+	.byte	0
+.LVUS196:
+	.uleb128 .LVU418
+	.uleb128 .LVU420
+.LLST196:
+	.byte	0x4
+	.uleb128 .LVL70-.Ltext0
+	.uleb128 .LVL70-.Ltext0
+	.uleb128 0x3
+	.byte	0x8
+	.byte	0x4e
+	.byte	0x9f
+	.byte	0
+.LVUS197:
+	.uleb128 .LVU413
+	.uleb128 .LVU416
+.LLST197:
+	.byte	0x4
+	.uleb128 .LVL69-.Ltext0
+	.uleb128 .LVL70-.Ltext0
+	.uleb128 0x3
+	.byte	0x8
+	.byte	0x93
+	.byte	0x9f
+	.byte	0
+.LVUS198:
+	.uleb128 .LVU413
+	.uleb128 .LVU416
+.LLST198:
+	.byte	0x4
+	.uleb128 .LVL69-.Ltext0
+	.uleb128 .LVL70-.Ltext0
+	.uleb128 0x1
+	.byte	0x62
+	.byte	0
+.LVUS201:
+	.uleb128 .LVU433
+	.uleb128 .LVU435
+.LLST201:
+	.byte	0x4
+	.uleb128 .LVL70-.Ltext0
+	.uleb128 .LVL70-.Ltext0
+	.uleb128 0x1
+	.byte	0x65
+	.byte	0
+.LVUS202:
+	.uleb128 .LVU433
+	.uleb128 .LVU435
+.LLST202:
+	.byte	0x4
+	.uleb128 .LVL70-.Ltext0
+	.uleb128 .LVL70-.Ltext0
+	.uleb128 0x1
+	.byte	0x64
+	.byte	0
+.LVUS205:
+	.uleb128 .LVU449
+	.uleb128 .LVU451
+.LLST205:
+	.byte	0x4
+	.uleb128 .LVL70-.Ltext0
+	.uleb128 .LVL70-.Ltext0
+	.uleb128 0x2
+	.byte	0x31
+	.byte	0x9f
+	.byte	0
+.LVUS207:
+	.uleb128 .LVU429
+	.uleb128 .LVU431
+.LLST207:
+	.byte	0x4
+	.uleb128 .LVL70-.Ltext0
+	.uleb128 .LVL70-.Ltext0
+	.uleb128 0x1
+	.byte	0x65
+	.byte	0
+.LVUS208:
+	.uleb128 .LVU429
+	.uleb128 .LVU431
+.LLST208:
+	.byte	0x4
+	.uleb128 .LVL70-.Ltext0
+	.uleb128 .LVL70-.Ltext0
+	.uleb128 0x1
+	.byte	0x64
+	.byte	0
+.LVUS211:
+	.uleb128 .LVU441
+	.uleb128 .LVU443
+.LLST211:
+	.byte	0x4
+	.uleb128 .LVL70-.Ltext0
+	.uleb128 .LVL70-.Ltext0
+	.uleb128 0x2
+	.byte	0x31
+	.byte	0x9f
+	.byte	0
+.LVUS212:
+	.uleb128 .LVU454
+	.uleb128 .LVU456
+.LLST212:
+	.byte	0x4
+	.uleb128 .LVL70-.Ltext0
+	.uleb128 .LVL70-.Ltext0
+	.uleb128 0x1
+	.byte	0x62
+	.byte	0
+.LVUS213:
+	.uleb128 .LVU454
+	.uleb128 .LVU456
+.LLST213:
+	.byte	0x4
+	.uleb128 .LVL70-.Ltext0
+	.uleb128 .LVL70-.Ltext0
+	.uleb128 0x1
+	.byte	0x6a
+	.byte	0
+.LVUS215:
+	.uleb128 .LVU462
+	.uleb128 .LVU464
+.LLST215:
+	.byte	0x4
+	.uleb128 .LVL71-.Ltext0
+	.uleb128 .LVL71-.Ltext0
+	.uleb128 0x1
+	.byte	0x68
+	.byte	0
+.LVUS216:
+	.uleb128 .LVU462
+	.uleb128 .LVU464
+.LLST216:
+	.byte	0x4
+	.uleb128 .LVL71-.Ltext0
+	.uleb128 .LVL71-.Ltext0
+	.uleb128 0x1
+	.byte	0x61
+	.byte	0
+.LVUS218:
+	.uleb128 .LVU464
+	.uleb128 .LVU471
+.LLST218:
+	.byte	0x4
+	.uleb128 .LVL71-.Ltext0
+	.uleb128 .LVL73-.Ltext0
+	.uleb128 0x2
+	.byte	0x40
+	.byte	0x9f
+	.byte	0
+.LVUS219:
+	.uleb128 .LVU469
+	.uleb128 .LVU471
+.LLST219:
+	.byte	0x4
+	.uleb128 .LVL72-.Ltext0
+	.uleb128 .LVL73-.Ltext0
+	.uleb128 0x1
+	.byte	0x61
+	.byte	0
+.LVUS221:
+	.uleb128 .LVU473
+	.uleb128 .LVU477
+.LLST221:
+	.byte	0x4
+	.uleb128 .LVL73-.Ltext0
+	.uleb128 .LVL74-.Ltext0
+	.uleb128 0x1
+	.byte	0x61
+	.byte	0
+.LVUS222:
+	.uleb128 .LVU473
+	.uleb128 .LVU477
+.LLST222:
+	.byte	0x4
+	.uleb128 .LVL73-.Ltext0
+	.uleb128 .LVL74-.Ltext0
+	.uleb128 0x1
+	.byte	0x63
+	.byte	0
+.LVUS224:
+	.uleb128 .LVU479
+	.uleb128 .LVU481
+.LLST224:
+	.byte	0x4
+	.uleb128 .LVL74-.Ltext0
+	.uleb128 .LVL74-.Ltext0
+	.uleb128 0x1
+	.byte	0x63
+	.byte	0
+.LVUS225:
+	.uleb128 .LVU479
+	.uleb128 .LVU481
+.LLST225:
+	.byte	0x4
+	.uleb128 .LVL74-.Ltext0
+	.uleb128 .LVL74-.Ltext0
+	.uleb128 0x1
+	.byte	0x62
+	.byte	0
+.LVUS227:
+	.uleb128 .LVU481
+	.uleb128 .LVU487
+.LLST227:
+	.byte	0x4
+	.uleb128 .LVL74-.Ltext0
+	.uleb128 .LVL76-.Ltext0
+	.uleb128 0x2
+	.byte	0x3c
+	.byte	0x9f
+	.byte	0
+.LVUS228:
+	.uleb128 .LVU485
+	.uleb128 .LVU487
+.LLST228:
+	.byte	0x4
+	.uleb128 .LVL75-.Ltext0
+	.uleb128 .LVL76-.Ltext0
+	.uleb128 0x1
+	.byte	0x62
+	.byte	0
+.LVUS229:
+	.uleb128 .LVU489
+	.uleb128 .LVU491
+.LLST229:
+	.byte	0x4
+	.uleb128 .LVL76-.Ltext0
+	.uleb128 .LVL76-.Ltext0
+	.uleb128 0x1
+	.byte	0x62
+	.byte	0
+.LVUS230:
+	.uleb128 .LVU489
+	.uleb128 .LVU491
+.LLST230:
+	.byte	0x4
+	.uleb128 .LVL76-.Ltext0
+	.uleb128 .LVL76-.Ltext0
+	.uleb128 0x1
+	.byte	0x68
+	.byte	0
+.LVUS231:
+	.uleb128 .LVU491
+	.uleb128 .LVU495
+.LLST231:
+	.byte	0x4
+	.uleb128 .LVL76-.Ltext0
+	.uleb128 .LVL77-.Ltext0
+	.uleb128 0x1
+	.byte	0x66
+	.byte	0
+.LVUS233:
+	.uleb128 .LVU498
+	.uleb128 .LVU500
+.LLST233:
+	.byte	0x4
+	.uleb128 .LVL78-.Ltext0
+	.uleb128 .LVL78-.Ltext0
+	.uleb128 0x1
+	.byte	0x66
+	.byte	0
+.LVUS234:
+	.uleb128 .LVU498
+	.uleb128 .LVU500
+.LLST234:
+	.byte	0x4
+	.uleb128 .LVL78-.Ltext0
+	.uleb128 .LVL78-.Ltext0
+	.uleb128 0x1
+	.byte	0x61
+	.byte	0
+.LVUS236:
+	.uleb128 .LVU500
+	.uleb128 .LVU506
+.LLST236:
+	.byte	0x4
+	.uleb128 .LVL78-.Ltext0
+	.uleb128 .LVL80-.Ltext0
+	.uleb128 0x2
+	.byte	0x38
+	.byte	0x9f
+	.byte	0
+.LVUS237:
+	.uleb128 .LVU504
+	.uleb128 .LVU506
+.LLST237:
+	.byte	0x4
+	.uleb128 .LVL79-.Ltext0
+	.uleb128 .LVL80-.Ltext0
+	.uleb128 0x1
+	.byte	0x61
+	.byte	0
+.LVUS238:
+	.uleb128 .LVU508
+	.uleb128 .LVU511
+.LLST238:
+	.byte	0x4
+	.uleb128 .LVL80-.Ltext0
+	.uleb128 .LVL81-.Ltext0
+	.uleb128 0x1
+	.byte	0x61
+	.byte	0
+.LVUS239:
+	.uleb128 .LVU508
+	.uleb128 .LVU511
+.LLST239:
+	.byte	0x4
+	.uleb128 .LVL80-.Ltext0
+	.uleb128 .LVL81-.Ltext0
+	.uleb128 0x1
+	.byte	0x63
+	.byte	0
+.LVUS241:
+	.uleb128 .LVU513
+	.uleb128 .LVU515
+.LLST241:
+	.byte	0x4
+	.uleb128 .LVL81-.Ltext0
+	.uleb128 .LVL81-.Ltext0
+	.uleb128 0x1
+	.byte	0x63
+	.byte	0
+.LVUS242:
+	.uleb128 .LVU513
+	.uleb128 .LVU515
+.LLST242:
+	.byte	0x4
+	.uleb128 .LVL81-.Ltext0
+	.uleb128 .LVL81-.Ltext0
+	.uleb128 0x1
+	.byte	0x62
+	.byte	0
+.LVUS244:
+	.uleb128 .LVU515
+	.uleb128 .LVU525
+.LLST244:
+	.byte	0x4
+	.uleb128 .LVL81-.Ltext0
+	.uleb128 .LVL85-.Ltext0
+	.uleb128 0x2
+	.byte	0x37
+	.byte	0x9f
+	.byte	0
+.LVUS245:
+	.uleb128 .LVU521
+	.uleb128 .LVU525
+.LLST245:
+	.byte	0x4
+	.uleb128 .LVL83-.Ltext0
+	.uleb128 .LVL85-.Ltext0
+	.uleb128 0x1
+	.byte	0x62
+	.byte	0
+.LVUS247:
+	.uleb128 .LVU537
+	.uleb128 .LVU539
+.LLST247:
+	.byte	0x4
+	.uleb128 .LVL86-.Ltext0
+	.uleb128 .LVL86-.Ltext0
+	.uleb128 0x3
+	.byte	0x8
+	.byte	0x93
+	.byte	0x9f
+	.byte	0
+.LVUS249:
+	.uleb128 .LVU533
+	.uleb128 .LVU535
+.LLST249:
+	.byte	0x4
+	.uleb128 .LVL86-.Ltext0
+	.uleb128 .LVL86-.Ltext0
+	.uleb128 0x3
+	.byte	0x8
+	.byte	0x4e
+	.byte	0x9f
+	.byte	0
+.LVUS250:
+	.uleb128 .LVU528
+	.uleb128 .LVU531
+.LLST250:
+	.byte	0x4
+	.uleb128 .LVL85-.Ltext0
+	.uleb128 .LVL86-.Ltext0
+	.uleb128 0x3
+	.byte	0x8
+	.byte	0x39
+	.byte	0x9f
+	.byte	0
+.LVUS251:
+	.uleb128 .LVU528
+	.uleb128 .LVU531
+.LLST251:
+	.byte	0x4
+	.uleb128 .LVL85-.Ltext0
+	.uleb128 .LVL86-.Ltext0
+	.uleb128 0x1
+	.byte	0x62
+	.byte	0
+.LVUS252:
+	.uleb128 .LVU542
+	.uleb128 .LVU544
+.LLST252:
+	.byte	0x4
+	.uleb128 .LVL86-.Ltext0
+	.uleb128 .LVL86-.Ltext0
+	.uleb128 0x1
+	.byte	0x62
+	.byte	0
+.LVUS253:
+	.uleb128 .LVU542
+	.uleb128 .LVU544
+.LLST253:
+	.byte	0x4
+	.uleb128 .LVL86-.Ltext0
+	.uleb128 .LVL86-.Ltext0
+	.uleb128 0x1
+	.byte	0x66
+	.byte	0
+.LVUS255:
+	.uleb128 .LVU550
+	.uleb128 .LVU552
+.LLST255:
+	.byte	0x4
+	.uleb128 .LVL87-.Ltext0
+	.uleb128 .LVL87-.Ltext0
+	.uleb128 0x1
+	.byte	0x66
+	.byte	0
+.LVUS256:
+	.uleb128 .LVU550
+	.uleb128 .LVU552
+.LLST256:
+	.byte	0x4
+	.uleb128 .LVL87-.Ltext0
+	.uleb128 .LVL87-.Ltext0
+	.uleb128 0x1
+	.byte	0x61
+	.byte	0
+.LVUS258:
+	.uleb128 .LVU552
+	.uleb128 .LVU560
+.LLST258:
+	.byte	0x4
+	.uleb128 .LVL87-.Ltext0
+	.uleb128 .LVL89-.Ltext0
+	.uleb128 0x2
+	.byte	0x40
+	.byte	0x9f
+	.byte	0
+.LVUS259:
+	.uleb128 .LVU558
+	.uleb128 .LVU560
+.LLST259:
+	.byte	0x4
+	.uleb128 .LVL88-.Ltext0
+	.uleb128 .LVL89-.Ltext0
+	.uleb128 0x1
+	.byte	0x61
+	.byte	0
+.LVUS260:
+	.uleb128 .LVU562
+	.uleb128 .LVU565
+.LLST260:
+	.byte	0x4
+	.uleb128 .LVL89-.Ltext0
+	.uleb128 .LVL90-.Ltext0
+	.uleb128 0x1
+	.byte	0x61
+	.byte	0
+.LVUS261:
+	.uleb128 .LVU562
+	.uleb128 .LVU565
+.LLST261:
+	.byte	0x4
+	.uleb128 .LVL89-.Ltext0
+	.uleb128 .LVL90-.Ltext0
+	.uleb128 0x1
+	.byte	0x63
+	.byte	0
+.LVUS263:
+	.uleb128 .LVU567
+	.uleb128 .LVU569
+.LLST263:
+	.byte	0x4
+	.uleb128 .LVL90-.Ltext0
+	.uleb128 .LVL90-.Ltext0
+	.uleb128 0x1
+	.byte	0x63
+	.byte	0
+.LVUS264:
+	.uleb128 .LVU567
+	.uleb128 .LVU569
+.LLST264:
+	.byte	0x4
+	.uleb128 .LVL90-.Ltext0
+	.uleb128 .LVL90-.Ltext0
+	.uleb128 0x1
+	.byte	0x62
+	.byte	0
+.LVUS266:
+	.uleb128 .LVU569
+	.uleb128 .LVU575
+.LLST266:
+	.byte	0x4
+	.uleb128 .LVL90-.Ltext0
+	.uleb128 .LVL92-.Ltext0
+	.uleb128 0x2
+	.byte	0x3c
+	.byte	0x9f
+	.byte	0
+.LVUS267:
+	.uleb128 .LVU573
+	.uleb128 .LVU575
+.LLST267:
+	.byte	0x4
+	.uleb128 .LVL91-.Ltext0
+	.uleb128 .LVL92-.Ltext0
+	.uleb128 0x1
+	.byte	0x62
+	.byte	0
+.LVUS268:
+	.uleb128 .LVU577
+	.uleb128 .LVU579
+.LLST268:
+	.byte	0x4
+	.uleb128 .LVL92-.Ltext0
+	.uleb128 .LVL92-.Ltext0
+	.uleb128 0x1
+	.byte	0x62
+	.byte	0
+.LVUS269:
+	.uleb128 .LVU577
+	.uleb128 .LVU579
+.LLST269:
+	.byte	0x4
+	.uleb128 .LVL92-.Ltext0
+	.uleb128 .LVL92-.Ltext0
+	.uleb128 0x1
+	.byte	0x66
+	.byte	0
+.LVUS270:
+	.uleb128 .LVU579
+	.uleb128 .LVU583
+.LLST270:
+	.byte	0x4
+	.uleb128 .LVL92-.Ltext0
+	.uleb128 .LVL93-.Ltext0
+	.uleb128 0x1
+	.byte	0x69
+	.byte	0
+.LVUS272:
+	.uleb128 .LVU586
+	.uleb128 .LVU588
+.LLST272:
+	.byte	0x4
+	.uleb128 .LVL94-.Ltext0
+	.uleb128 .LVL94-.Ltext0
+	.uleb128 0x1
+	.byte	0x69
+	.byte	0
+.LVUS273:
+	.uleb128 .LVU586
+	.uleb128 .LVU588
+.LLST273:
+	.byte	0x4
+	.uleb128 .LVL94-.Ltext0
+	.uleb128 .LVL94-.Ltext0
+	.uleb128 0x1
+	.byte	0x61
+	.byte	0
+.LVUS275:
+	.uleb128 .LVU588
+	.uleb128 .LVU595
+.LLST275:
+	.byte	0x4
+	.uleb128 .LVL94-.Ltext0
+	.uleb128 .LVL96-.Ltext0
+	.uleb128 0x2
+	.byte	0x38
+	.byte	0x9f
+	.byte	0
+.LVUS276:
+	.uleb128 .LVU593
+	.uleb128 .LVU595
+.LLST276:
+	.byte	0x4
+	.uleb128 .LVL95-.Ltext0
+	.uleb128 .LVL96-.Ltext0
+	.uleb128 0x1
+	.byte	0x61
+	.byte	0
+.LVUS278:
+	.uleb128 .LVU597
+	.uleb128 .LVU603
+.LLST278:
+	.byte	0x4
+	.uleb128 .LVL96-.Ltext0
+	.uleb128 .LVL97-.Ltext0
+	.uleb128 0x1
+	.byte	0x61
+	.byte	0
+.LVUS279:
+	.uleb128 .LVU597
+	.uleb128 .LVU603
+.LLST279:
+	.byte	0x4
+	.uleb128 .LVL96-.Ltext0
+	.uleb128 .LVL97-.Ltext0
+	.uleb128 0x1
+	.byte	0x63
+	.byte	0
+.LVUS281:
+	.uleb128 .LVU605
+	.uleb128 .LVU607
+.LLST281:
+	.byte	0x4
+	.uleb128 .LVL97-.Ltext0
+	.uleb128 .LVL97-.Ltext0
+	.uleb128 0x1
+	.byte	0x63
+	.byte	0
+.LVUS282:
+	.uleb128 .LVU605
+	.uleb128 .LVU607
+.LLST282:
+	.byte	0x4
+	.uleb128 .LVL97-.Ltext0
+	.uleb128 .LVL97-.Ltext0
+	.uleb128 0x1
+	.byte	0x62
+	.byte	0
+.LVUS284:
+	.uleb128 .LVU607
+	.uleb128 .LVU617
+.LLST284:
+	.byte	0x4
+	.uleb128 .LVL97-.Ltext0
+	.uleb128 .LVL101-.Ltext0
+	.uleb128 0x2
+	.byte	0x37
+	.byte	0x9f
+	.byte	0
+.LVUS285:
+	.uleb128 .LVU613
+	.uleb128 .LVU617
+.LLST285:
+	.byte	0x4
+	.uleb128 .LVL99-.Ltext0
+	.uleb128 .LVL101-.Ltext0
+	.uleb128 0x1
+	.byte	0x62
+	.byte	0
+.LVUS287:
+	.uleb128 .LVU629
+	.uleb128 .LVU631
+.LLST287:
+	.byte	0x4
+	.uleb128 .LVL102-.Ltext0
+	.uleb128 .LVL102-.Ltext0
+	.uleb128 0x3
+	.byte	0x8
+	.byte	0x39
+	.byte	0x9f
+	.byte	0
+.LVUS289:
+	.uleb128 .LVU625
+	.uleb128 .LVU627
+.LLST289:
+	.byte	0x4
+	.uleb128 .LVL102-.Ltext0
+	.uleb128 .LVL102-.Ltext0
+	.uleb128 0x3
+	.byte	0x8
+	.byte	0x4e
+	.byte	0x9f
+	.byte	0
+.LVUS290:
+	.uleb128 .LVU620
+	.uleb128 .LVU623
+.LLST290:
+	.byte	0x4
+	.uleb128 .LVL101-.Ltext0
+	.uleb128 .LVL102-.Ltext0
+	.uleb128 0x3
+	.byte	0x8
+	.byte	0x93
+	.byte	0x9f
+	.byte	0
+.LVUS291:
+	.uleb128 .LVU620
+	.uleb128 .LVU623
+.LLST291:
+	.byte	0x4
+	.uleb128 .LVL101-.Ltext0
+	.uleb128 .LVL102-.Ltext0
+	.uleb128 0x1
+	.byte	0x62
+	.byte	0
+.LVUS294:
+	.uleb128 .LVU640
+	.uleb128 .LVU642
+.LLST294:
+	.byte	0x4
+	.uleb128 .LVL102-.Ltext0
+	.uleb128 .LVL102-.Ltext0
+	.uleb128 0x1
+	.byte	0x65
+	.byte	0
+.LVUS295:
+	.uleb128 .LVU640
+	.uleb128 .LVU642
+.LLST295:
+	.byte	0x4
+	.uleb128 .LVL102-.Ltext0
+	.uleb128 .LVL102-.Ltext0
+	.uleb128 0x1
+	.byte	0x64
+	.byte	0
+.LVUS298:
+	.uleb128 .LVU656
+	.uleb128 .LVU658
+.LLST298:
+	.byte	0x4
+	.uleb128 .LVL102-.Ltext0
+	.uleb128 .LVL102-.Ltext0
+	.uleb128 0x2
+	.byte	0x31
+	.byte	0x9f
+	.byte	0
+.LVUS300:
+	.uleb128 .LVU636
+	.uleb128 .LVU638
+.LLST300:
+	.byte	0x4
+	.uleb128 .LVL102-.Ltext0
+	.uleb128 .LVL102-.Ltext0
+	.uleb128 0x1
+	.byte	0x65
+	.byte	0
+.LVUS301:
+	.uleb128 .LVU636
+	.uleb128 .LVU638
+.LLST301:
+	.byte	0x4
+	.uleb128 .LVL102-.Ltext0
+	.uleb128 .LVL102-.Ltext0
+	.uleb128 0x1
+	.byte	0x64
+	.byte	0
+.LVUS304:
+	.uleb128 .LVU648
+	.uleb128 .LVU650
+.LLST304:
+	.byte	0x4
+	.uleb128 .LVL102-.Ltext0
+	.uleb128 .LVL102-.Ltext0
+	.uleb128 0x2
+	.byte	0x31
+	.byte	0x9f
+	.byte	0
+.LVUS305:
+	.uleb128 .LVU661
+	.uleb128 .LVU663
+.LLST305:
+	.byte	0x4
+	.uleb128 .LVL102-.Ltext0
+	.uleb128 .LVL102-.Ltext0
+	.uleb128 0x1
+	.byte	0x62
+	.byte	0
+.LVUS306:
+	.uleb128 .LVU661
+	.uleb128 .LVU663
+.LLST306:
+	.byte	0x4
+	.uleb128 .LVL102-.Ltext0
+	.uleb128 .LVL102-.Ltext0
+	.uleb128 0x1
+	.byte	0x69
+	.byte	0
+.LVUS308:
+	.uleb128 .LVU669
+	.uleb128 .LVU671
+.LLST308:
+	.byte	0x4
+	.uleb128 .LVL103-.Ltext0
+	.uleb128 .LVL103-.Ltext0
+	.uleb128 0x1
+	.byte	0x68
+	.byte	0
+.LVUS309:
+	.uleb128 .LVU669
+	.uleb128 .LVU671
+.LLST309:
+	.byte	0x4
+	.uleb128 .LVL103-.Ltext0
+	.uleb128 .LVL103-.Ltext0
+	.uleb128 0x1
+	.byte	0x61
+	.byte	0
+.LVUS311:
+	.uleb128 .LVU671
+	.uleb128 .LVU678
+.LLST311:
+	.byte	0x4
+	.uleb128 .LVL103-.Ltext0
+	.uleb128 .LVL105-.Ltext0
+	.uleb128 0x2
+	.byte	0x40
+	.byte	0x9f
+	.byte	0
+.LVUS312:
+	.uleb128 .LVU676
+	.uleb128 .LVU678
+.LLST312:
+	.byte	0x4
+	.uleb128 .LVL104-.Ltext0
+	.uleb128 .LVL105-.Ltext0
+	.uleb128 0x1
+	.byte	0x61
+	.byte	0
+.LVUS314:
+	.uleb128 .LVU680
+	.uleb128 .LVU684
+.LLST314:
+	.byte	0x4
+	.uleb128 .LVL105-.Ltext0
+	.uleb128 .LVL106-.Ltext0
+	.uleb128 0x1
+	.byte	0x61
+	.byte	0
+.LVUS315:
+	.uleb128 .LVU680
+	.uleb128 .LVU684
+.LLST315:
+	.byte	0x4
+	.uleb128 .LVL105-.Ltext0
+	.uleb128 .LVL106-.Ltext0
+	.uleb128 0x1
+	.byte	0x63
+	.byte	0
+.LVUS317:
+	.uleb128 .LVU686
+	.uleb128 .LVU688
+.LLST317:
+	.byte	0x4
+	.uleb128 .LVL106-.Ltext0
+	.uleb128 .LVL106-.Ltext0
+	.uleb128 0x1
+	.byte	0x63
+	.byte	0
+.LVUS318:
+	.uleb128 .LVU686
+	.uleb128 .LVU688
+.LLST318:
+	.byte	0x4
+	.uleb128 .LVL106-.Ltext0
+	.uleb128 .LVL106-.Ltext0
+	.uleb128 0x1
+	.byte	0x62
+	.byte	0
+.LVUS320:
+	.uleb128 .LVU688
+	.uleb128 .LVU694
+.LLST320:
+	.byte	0x4
+	.uleb128 .LVL106-.Ltext0
+	.uleb128 .LVL108-.Ltext0
+	.uleb128 0x2
+	.byte	0x3c
+	.byte	0x9f
+	.byte	0
+.LVUS321:
+	.uleb128 .LVU692
+	.uleb128 .LVU694
+.LLST321:
+	.byte	0x4
+	.uleb128 .LVL107-.Ltext0
+	.uleb128 .LVL108-.Ltext0
+	.uleb128 0x1
+	.byte	0x62
+	.byte	0
+.LVUS322:
+	.uleb128 .LVU696
+	.uleb128 .LVU698
+.LLST322:
+	.byte	0x4
+	.uleb128 .LVL108-.Ltext0
+	.uleb128 .LVL108-.Ltext0
+	.uleb128 0x1
+	.byte	0x62
+	.byte	0
+.LVUS323:
+	.uleb128 .LVU696
+	.uleb128 .LVU698
+.LLST323:
+	.byte	0x4
+	.uleb128 .LVL108-.Ltext0
+	.uleb128 .LVL108-.Ltext0
+	.uleb128 0x1
+	.byte	0x68
+	.byte	0
+.LVUS324:
+	.uleb128 .LVU698
+	.uleb128 .LVU702
+.LLST324:
+	.byte	0x4
+	.uleb128 .LVL108-.Ltext0
+	.uleb128 .LVL109-.Ltext0
+	.uleb128 0x1
+	.byte	0x66
+	.byte	0
+.LVUS326:
+	.uleb128 .LVU705
+	.uleb128 .LVU707
+.LLST326:
+	.byte	0x4
+	.uleb128 .LVL110-.Ltext0
+	.uleb128 .LVL110-.Ltext0
+	.uleb128 0x1
+	.byte	0x66
+	.byte	0
+.LVUS327:
+	.uleb128 .LVU705
+	.uleb128 .LVU707
+.LLST327:
+	.byte	0x4
+	.uleb128 .LVL110-.Ltext0
+	.uleb128 .LVL110-.Ltext0
+	.uleb128 0x1
+	.byte	0x61
+	.byte	0
+.LVUS329:
+	.uleb128 .LVU707
+	.uleb128 .LVU713
+.LLST329:
+	.byte	0x4
+	.uleb128 .LVL110-.Ltext0
+	.uleb128 .LVL112-.Ltext0
+	.uleb128 0x2
+	.byte	0x38
+	.byte	0x9f
+	.byte	0
+.LVUS330:
+	.uleb128 .LVU711
+	.uleb128 .LVU713
+.LLST330:
+	.byte	0x4
+	.uleb128 .LVL111-.Ltext0
+	.uleb128 .LVL112-.Ltext0
+	.uleb128 0x1
+	.byte	0x61
+	.byte	0
+.LVUS331:
+	.uleb128 .LVU715
+	.uleb128 .LVU718
+.LLST331:
+	.byte	0x4
+	.uleb128 .LVL112-.Ltext0
+	.uleb128 .LVL113-.Ltext0
+	.uleb128 0x1
+	.byte	0x61
+	.byte	0
+.LVUS332:
+	.uleb128 .LVU715
+	.uleb128 .LVU718
+.LLST332:
+	.byte	0x4
+	.uleb128 .LVL112-.Ltext0
+	.uleb128 .LVL113-.Ltext0
+	.uleb128 0x1
+	.byte	0x63
+	.byte	0
+.LVUS334:
+	.uleb128 .LVU720
+	.uleb128 .LVU722
+.LLST334:
+	.byte	0x4
+	.uleb128 .LVL113-.Ltext0
+	.uleb128 .LVL113-.Ltext0
+	.uleb128 0x1
+	.byte	0x63
+	.byte	0
+.LVUS335:
+	.uleb128 .LVU720
+	.uleb128 .LVU722
+.LLST335:
+	.byte	0x4
+	.uleb128 .LVL113-.Ltext0
+	.uleb128 .LVL113-.Ltext0
+	.uleb128 0x1
+	.byte	0x62
+	.byte	0
+.LVUS337:
+	.uleb128 .LVU722
+	.uleb128 .LVU732
+.LLST337:
+	.byte	0x4
+	.uleb128 .LVL113-.Ltext0
+	.uleb128 .LVL117-.Ltext0
+	.uleb128 0x2
+	.byte	0x37
+	.byte	0x9f
+	.byte	0
+.LVUS338:
+	.uleb128 .LVU728
+	.uleb128 .LVU732
+.LLST338:
+	.byte	0x4
+	.uleb128 .LVL115-.Ltext0
+	.uleb128 .LVL117-.Ltext0
+	.uleb128 0x1
+	.byte	0x62
+	.byte	0
+.LVUS340:
+	.uleb128 .LVU744
+	.uleb128 .LVU746
+.LLST340:
+	.byte	0x4
+	.uleb128 .LVL118-.Ltext0
+	.uleb128 .LVL118-.Ltext0
+	.uleb128 0x3
+	.byte	0x8
+	.byte	0x93
+	.byte	0x9f
+	.byte	0
+.LVUS342:
+	.uleb128 .LVU740
+	.uleb128 .LVU742
+.LLST342:
+	.byte	0x4
+	.uleb128 .LVL118-.Ltext0
+	.uleb128 .LVL118-.Ltext0
+	.uleb128 0x3
+	.byte	0x8
+	.byte	0x4e
+	.byte	0x9f
+	.byte	0
+.LVUS343:
+	.uleb128 .LVU735
+	.uleb128 .LVU738
+.LLST343:
+	.byte	0x4
+	.uleb128 .LVL117-.Ltext0
+	.uleb128 .LVL118-.Ltext0
+	.uleb128 0x3
+	.byte	0x8
+	.byte	0x39
+	.byte	0x9f
+	.byte	0
+.LVUS344:
+	.uleb128 .LVU735
+	.uleb128 .LVU738
+.LLST344:
+	.byte	0x4
+	.uleb128 .LVL117-.Ltext0
+	.uleb128 .LVL118-.Ltext0
+	.uleb128 0x1
+	.byte	0x62
+	.byte	0
+.LVUS345:
+	.uleb128 .LVU749
+	.uleb128 .LVU751
+.LLST345:
+	.byte	0x4
+	.uleb128 .LVL118-.Ltext0
+	.uleb128 .LVL118-.Ltext0
+	.uleb128 0x1
+	.byte	0x62
+	.byte	0
+.LVUS346:
+	.uleb128 .LVU749
+	.uleb128 .LVU751
+.LLST346:
+	.byte	0x4
+	.uleb128 .LVL118-.Ltext0
+	.uleb128 .LVL118-.Ltext0
+	.uleb128 0x1
+	.byte	0x66
+	.byte	0
+.LVUS348:
+	.uleb128 .LVU757
+	.uleb128 .LVU759
+.LLST348:
+	.byte	0x4
+	.uleb128 .LVL119-.Ltext0
+	.uleb128 .LVL119-.Ltext0
+	.uleb128 0x1
+	.byte	0x66
+	.byte	0
+.LVUS349:
+	.uleb128 .LVU757
+	.uleb128 .LVU759
+.LLST349:
+	.byte	0x4
+	.uleb128 .LVL119-.Ltext0
+	.uleb128 .LVL119-.Ltext0
+	.uleb128 0x1
+	.byte	0x61
+	.byte	0
+.LVUS351:
+	.uleb128 .LVU759
+	.uleb128 .LVU767
+.LLST351:
+	.byte	0x4
+	.uleb128 .LVL119-.Ltext0
+	.uleb128 .LVL121-.Ltext0
+	.uleb128 0x2
+	.byte	0x40
+	.byte	0x9f
+	.byte	0
+.LVUS352:
+	.uleb128 .LVU765
+	.uleb128 .LVU767
+.LLST352:
+	.byte	0x4
+	.uleb128 .LVL120-.Ltext0
+	.uleb128 .LVL121-.Ltext0
+	.uleb128 0x1
+	.byte	0x61
+	.byte	0
+.LVUS353:
+	.uleb128 .LVU769
+	.uleb128 .LVU772
+.LLST353:
+	.byte	0x4
+	.uleb128 .LVL121-.Ltext0
+	.uleb128 .LVL122-.Ltext0
+	.uleb128 0x1
+	.byte	0x61
+	.byte	0
+.LVUS354:
+	.uleb128 .LVU769
+	.uleb128 .LVU772
+.LLST354:
+	.byte	0x4
+	.uleb128 .LVL121-.Ltext0
+	.uleb128 .LVL122-.Ltext0
+	.uleb128 0x1
+	.byte	0x63
+	.byte	0
+.LVUS356:
+	.uleb128 .LVU774
+	.uleb128 .LVU776
+.LLST356:
+	.byte	0x4
+	.uleb128 .LVL122-.Ltext0
+	.uleb128 .LVL122-.Ltext0
+	.uleb128 0x1
+	.byte	0x63
+	.byte	0
+.LVUS357:
+	.uleb128 .LVU774
+	.uleb128 .LVU776
+.LLST357:
+	.byte	0x4
+	.uleb128 .LVL122-.Ltext0
+	.uleb128 .LVL122-.Ltext0
+	.uleb128 0x1
+	.byte	0x62
+	.byte	0
+.LVUS359:
+	.uleb128 .LVU776
+	.uleb128 .LVU782
+.LLST359:
+	.byte	0x4
+	.uleb128 .LVL122-.Ltext0
+	.uleb128 .LVL124-.Ltext0
+	.uleb128 0x2
+	.byte	0x3c
+	.byte	0x9f
+	.byte	0
+.LVUS360:
+	.uleb128 .LVU780
+	.uleb128 .LVU782
+.LLST360:
+	.byte	0x4
+	.uleb128 .LVL123-.Ltext0
+	.uleb128 .LVL124-.Ltext0
+	.uleb128 0x1
+	.byte	0x62
+	.byte	0
+.LVUS361:
+	.uleb128 .LVU784
+	.uleb128 .LVU786
+.LLST361:
+	.byte	0x4
+	.uleb128 .LVL124-.Ltext0
+	.uleb128 .LVL124-.Ltext0
+	.uleb128 0x1
+	.byte	0x62
+	.byte	0
+.LVUS362:
+	.uleb128 .LVU784
+	.uleb128 .LVU786
+.LLST362:
+	.byte	0x4
+	.uleb128 .LVL124-.Ltext0
+	.uleb128 .LVL124-.Ltext0
+	.uleb128 0x1
+	.byte	0x66
+	.byte	0
+.LVUS363:
+	.uleb128 .LVU786
+	.uleb128 .LVU790
+.LLST363:
+	.byte	0x4
+	.uleb128 .LVL124-.Ltext0
+	.uleb128 .LVL125-.Ltext0
+	.uleb128 0x1
+	.byte	0x6a
+	.byte	0
+.LVUS365:
+	.uleb128 .LVU793
+	.uleb128 .LVU795
+.LLST365:
+	.byte	0x4
+	.uleb128 .LVL126-.Ltext0
+	.uleb128 .LVL126-.Ltext0
+	.uleb128 0x1
+	.byte	0x6a
+	.byte	0
+.LVUS366:
+	.uleb128 .LVU793
+	.uleb128 .LVU795
+.LLST366:
+	.byte	0x4
+	.uleb128 .LVL126-.Ltext0
+	.uleb128 .LVL126-.Ltext0
+	.uleb128 0x1
+	.byte	0x61
+	.byte	0
+.LVUS368:
+	.uleb128 .LVU795
+	.uleb128 .LVU802
+.LLST368:
+	.byte	0x4
+	.uleb128 .LVL126-.Ltext0
+	.uleb128 .LVL128-.Ltext0
+	.uleb128 0x2
+	.byte	0x38
+	.byte	0x9f
+	.byte	0
+.LVUS369:
+	.uleb128 .LVU800
+	.uleb128 .LVU802
+.LLST369:
+	.byte	0x4
+	.uleb128 .LVL127-.Ltext0
+	.uleb128 .LVL128-.Ltext0
+	.uleb128 0x1
+	.byte	0x61
+	.byte	0
+.LVUS371:
+	.uleb128 .LVU804
+	.uleb128 .LVU810
+.LLST371:
+	.byte	0x4
+	.uleb128 .LVL128-.Ltext0
+	.uleb128 .LVL129-.Ltext0
+	.uleb128 0x1
+	.byte	0x61
+	.byte	0
+.LVUS372:
+	.uleb128 .LVU804
+	.uleb128 .LVU810
+.LLST372:
+	.byte	0x4
+	.uleb128 .LVL128-.Ltext0
+	.uleb128 .LVL129-.Ltext0
+	.uleb128 0x1
+	.byte	0x63
+	.byte	0
+.LVUS374:
+	.uleb128 .LVU812
+	.uleb128 .LVU814
+.LLST374:
+	.byte	0x4
+	.uleb128 .LVL129-.Ltext0
+	.uleb128 .LVL129-.Ltext0
+	.uleb128 0x1
+	.byte	0x63
+	.byte	0
+.LVUS375:
+	.uleb128 .LVU812
+	.uleb128 .LVU814
+.LLST375:
+	.byte	0x4
+	.uleb128 .LVL129-.Ltext0
+	.uleb128 .LVL129-.Ltext0
+	.uleb128 0x1
+	.byte	0x62
+	.byte	0
+.LVUS377:
+	.uleb128 .LVU814
+	.uleb128 .LVU824
+.LLST377:
+	.byte	0x4
+	.uleb128 .LVL129-.Ltext0
+	.uleb128 .LVL133-.Ltext0
+	.uleb128 0x2
+	.byte	0x37
+	.byte	0x9f
+	.byte	0
+.LVUS378:
+	.uleb128 .LVU820
+	.uleb128 .LVU824
+.LLST378:
+	.byte	0x4
+	.uleb128 .LVL131-.Ltext0
+	.uleb128 .LVL133-.Ltext0
+	.uleb128 0x1
+	.byte	0x62
+	.byte	0
+.LVUS380:
+	.uleb128 .LVU836
+	.uleb128 .LVU838
+.LLST380:
+	.byte	0x4
+	.uleb128 .LVL134-.Ltext0
+	.uleb128 .LVL134-.Ltext0
+	.uleb128 0x3
+	.byte	0x8
+	.byte	0x39
+	.byte	0x9f
+	.byte	0
+.LVUS382:
+	.uleb128 .LVU832
+	.uleb128 .LVU834
+.LLST382:
+	.byte	0x4
+	.uleb128 .LVL134-.Ltext0
+	.uleb128 .LVL134-.Ltext0
+	.uleb128 0x3
+	.byte	0x8
+	.byte	0x4e
+	.byte	0x9f
+	.byte	0
+.LVUS383:
+	.uleb128 .LVU827
+	.uleb128 .LVU830
+.LLST383:
+	.byte	0x4
+	.uleb128 .LVL133-.Ltext0
+	.uleb128 .LVL134-.Ltext0
+	.uleb128 0x3
+	.byte	0x8
+	.byte	0x93
+	.byte	0x9f
+	.byte	0
+.LVUS384:
+	.uleb128 .LVU827
+	.uleb128 .LVU830
+.LLST384:
+	.byte	0x4
+	.uleb128 .LVL133-.Ltext0
+	.uleb128 .LVL134-.Ltext0
+	.uleb128 0x1
+	.byte	0x62
+	.byte	0
+.LVUS387:
+	.uleb128 .LVU847
+	.uleb128 .LVU849
+.LLST387:
+	.byte	0x4
+	.uleb128 .LVL134-.Ltext0
+	.uleb128 .LVL134-.Ltext0
+	.uleb128 0x1
+	.byte	0x65
+	.byte	0
+.LVUS388:
+	.uleb128 .LVU847
+	.uleb128 .LVU849
+.LLST388:
+	.byte	0x4
+	.uleb128 .LVL134-.Ltext0
+	.uleb128 .LVL134-.Ltext0
+	.uleb128 0x1
+	.byte	0x64
+	.byte	0
+.LVUS391:
+	.uleb128 .LVU863
+	.uleb128 .LVU865
+.LLST391:
+	.byte	0x4
+	.uleb128 .LVL134-.Ltext0
+	.uleb128 .LVL134-.Ltext0
+	.uleb128 0x2
+	.byte	0x31
+	.byte	0x9f
+	.byte	0
+.LVUS393:
+	.uleb128 .LVU843
+	.uleb128 .LVU845
+.LLST393:
+	.byte	0x4
+	.uleb128 .LVL134-.Ltext0
+	.uleb128 .LVL134-.Ltext0
+	.uleb128 0x1
+	.byte	0x65
+	.byte	0
+.LVUS394:
+	.uleb128 .LVU843
+	.uleb128 .LVU845
+.LLST394:
+	.byte	0x4
+	.uleb128 .LVL134-.Ltext0
+	.uleb128 .LVL134-.Ltext0
+	.uleb128 0x1
+	.byte	0x64
+	.byte	0
+.LVUS397:
+	.uleb128 .LVU855
+	.uleb128 .LVU857
+.LLST397:
+	.byte	0x4
+	.uleb128 .LVL134-.Ltext0
+	.uleb128 .LVL134-.Ltext0
+	.uleb128 0x2
+	.byte	0x31
+	.byte	0x9f
+	.byte	0
+.LVUS398:
+	.uleb128 .LVU868
+	.uleb128 .LVU870
+.LLST398:
+	.byte	0x4
+	.uleb128 .LVL134-.Ltext0
+	.uleb128 .LVL134-.Ltext0
+	.uleb128 0x1
+	.byte	0x62
+	.byte	0
+.LVUS399:
+	.uleb128 .LVU868
+	.uleb128 .LVU870
+.LLST399:
+	.byte	0x4
+	.uleb128 .LVL134-.Ltext0
+	.uleb128 .LVL134-.Ltext0
+	.uleb128 0x1
+	.byte	0x6a
+	.byte	0
+.LVUS401:
+	.uleb128 .LVU876
+	.uleb128 .LVU878
+.LLST401:
+	.byte	0x4
+	.uleb128 .LVL135-.Ltext0
+	.uleb128 .LVL135-.Ltext0
+	.uleb128 0x1
+	.byte	0x68
+	.byte	0
+.LVUS402:
+	.uleb128 .LVU876
+	.uleb128 .LVU878
+.LLST402:
+	.byte	0x4
+	.uleb128 .LVL135-.Ltext0
+	.uleb128 .LVL135-.Ltext0
+	.uleb128 0x1
+	.byte	0x61
+	.byte	0
+.LVUS404:
+	.uleb128 .LVU878
+	.uleb128 .LVU885
+.LLST404:
+	.byte	0x4
+	.uleb128 .LVL135-.Ltext0
+	.uleb128 .LVL137-.Ltext0
+	.uleb128 0x2
+	.byte	0x40
+	.byte	0x9f
+	.byte	0
+.LVUS405:
+	.uleb128 .LVU883
+	.uleb128 .LVU885
+.LLST405:
+	.byte	0x4
+	.uleb128 .LVL136-.Ltext0
+	.uleb128 .LVL137-.Ltext0
+	.uleb128 0x1
+	.byte	0x61
+	.byte	0
+.LVUS407:
+	.uleb128 .LVU887
+	.uleb128 .LVU891
+.LLST407:
+	.byte	0x4
+	.uleb128 .LVL137-.Ltext0
+	.uleb128 .LVL138-.Ltext0
+	.uleb128 0x1
+	.byte	0x61
+	.byte	0
+.LVUS408:
+	.uleb128 .LVU887
+	.uleb128 .LVU891
+.LLST408:
+	.byte	0x4
+	.uleb128 .LVL137-.Ltext0
+	.uleb128 .LVL138-.Ltext0
+	.uleb128 0x1
+	.byte	0x63
+	.byte	0
+.LVUS410:
+	.uleb128 .LVU893
+	.uleb128 .LVU895
+.LLST410:
+	.byte	0x4
+	.uleb128 .LVL138-.Ltext0
+	.uleb128 .LVL138-.Ltext0
+	.uleb128 0x1
+	.byte	0x63
+	.byte	0
+.LVUS411:
+	.uleb128 .LVU893
+	.uleb128 .LVU895
+.LLST411:
+	.byte	0x4
+	.uleb128 .LVL138-.Ltext0
+	.uleb128 .LVL138-.Ltext0
+	.uleb128 0x1
+	.byte	0x62
+	.byte	0
+.LVUS413:
+	.uleb128 .LVU895
+	.uleb128 .LVU901
+.LLST413:
+	.byte	0x4
+	.uleb128 .LVL138-.Ltext0
+	.uleb128 .LVL140-.Ltext0
+	.uleb128 0x2
+	.byte	0x3c
+	.byte	0x9f
+	.byte	0
+.LVUS414:
+	.uleb128 .LVU899
+	.uleb128 .LVU901
+.LLST414:
+	.byte	0x4
+	.uleb128 .LVL139-.Ltext0
+	.uleb128 .LVL140-.Ltext0
+	.uleb128 0x1
+	.byte	0x62
+	.byte	0
+.LVUS415:
+	.uleb128 .LVU903
+	.uleb128 .LVU905
+.LLST415:
+	.byte	0x4
+	.uleb128 .LVL140-.Ltext0
+	.uleb128 .LVL140-.Ltext0
+	.uleb128 0x1
+	.byte	0x62
+	.byte	0
+.LVUS416:
+	.uleb128 .LVU903
+	.uleb128 .LVU905
+.LLST416:
+	.byte	0x4
+	.uleb128 .LVL140-.Ltext0
+	.uleb128 .LVL140-.Ltext0
+	.uleb128 0x1
+	.byte	0x68
+	.byte	0
+.LVUS417:
+	.uleb128 .LVU905
+	.uleb128 .LVU909
+.LLST417:
+	.byte	0x4
+	.uleb128 .LVL140-.Ltext0
+	.uleb128 .LVL141-.Ltext0
+	.uleb128 0x1
+	.byte	0x66
+	.byte	0
+.LVUS419:
+	.uleb128 .LVU912
+	.uleb128 .LVU914
+.LLST419:
+	.byte	0x4
+	.uleb128 .LVL142-.Ltext0
+	.uleb128 .LVL142-.Ltext0
+	.uleb128 0x1
+	.byte	0x66
+	.byte	0
+.LVUS420:
+	.uleb128 .LVU912
+	.uleb128 .LVU914
+.LLST420:
+	.byte	0x4
+	.uleb128 .LVL142-.Ltext0
+	.uleb128 .LVL142-.Ltext0
+	.uleb128 0x1
+	.byte	0x61
+	.byte	0
+.LVUS422:
+	.uleb128 .LVU914
+	.uleb128 .LVU920
+.LLST422:
+	.byte	0x4
+	.uleb128 .LVL142-.Ltext0
+	.uleb128 .LVL144-.Ltext0
+	.uleb128 0x2
+	.byte	0x38
+	.byte	0x9f
+	.byte	0
+.LVUS423:
+	.uleb128 .LVU918
+	.uleb128 .LVU920
+.LLST423:
+	.byte	0x4
+	.uleb128 .LVL143-.Ltext0
+	.uleb128 .LVL144-.Ltext0
+	.uleb128 0x1
+	.byte	0x61
+	.byte	0
+.LVUS424:
+	.uleb128 .LVU922
+	.uleb128 .LVU925
+.LLST424:
+	.byte	0x4
+	.uleb128 .LVL144-.Ltext0
+	.uleb128 .LVL145-.Ltext0
+	.uleb128 0x1
+	.byte	0x61
+	.byte	0
+.LVUS425:
+	.uleb128 .LVU922
+	.uleb128 .LVU925
+.LLST425:
+	.byte	0x4
+	.uleb128 .LVL144-.Ltext0
+	.uleb128 .LVL145-.Ltext0
+	.uleb128 0x1
+	.byte	0x63
+	.byte	0
+.LVUS427:
+	.uleb128 .LVU927
+	.uleb128 .LVU929
+.LLST427:
+	.byte	0x4
+	.uleb128 .LVL145-.Ltext0
+	.uleb128 .LVL145-.Ltext0
+	.uleb128 0x1
+	.byte	0x63
+	.byte	0
+.LVUS428:
+	.uleb128 .LVU927
+	.uleb128 .LVU929
+.LLST428:
+	.byte	0x4
+	.uleb128 .LVL145-.Ltext0
+	.uleb128 .LVL145-.Ltext0
+	.uleb128 0x1
+	.byte	0x62
+	.byte	0
+.LVUS430:
+	.uleb128 .LVU929
+	.uleb128 .LVU939
+.LLST430:
+	.byte	0x4
+	.uleb128 .LVL145-.Ltext0
+	.uleb128 .LVL149-.Ltext0
+	.uleb128 0x2
+	.byte	0x37
+	.byte	0x9f
+	.byte	0
+.LVUS431:
+	.uleb128 .LVU935
+	.uleb128 .LVU939
+.LLST431:
+	.byte	0x4
+	.uleb128 .LVL147-.Ltext0
+	.uleb128 .LVL149-.Ltext0
+	.uleb128 0x1
+	.byte	0x62
+	.byte	0
+.LVUS433:
+	.uleb128 .LVU951
+	.uleb128 .LVU953
+.LLST433:
+	.byte	0x4
+	.uleb128 .LVL150-.Ltext0
+	.uleb128 .LVL150-.Ltext0
+	.uleb128 0x3
+	.byte	0x8
+	.byte	0x93
+	.byte	0x9f
+	.byte	0
+.LVUS435:
+	.uleb128 .LVU947
+	.uleb128 .LVU949
+.LLST435:
+	.byte	0x4
+	.uleb128 .LVL150-.Ltext0
+	.uleb128 .LVL150-.Ltext0
+	.uleb128 0x3
+	.byte	0x8
+	.byte	0x4e
+	.byte	0x9f
+	.byte	0
+.LVUS436:
+	.uleb128 .LVU942
+	.uleb128 .LVU945
+.LLST436:
+	.byte	0x4
+	.uleb128 .LVL149-.Ltext0
+	.uleb128 .LVL150-.Ltext0
+	.uleb128 0x3
+	.byte	0x8
+	.byte	0x39
+	.byte	0x9f
+	.byte	0
+.LVUS437:
+	.uleb128 .LVU942
+	.uleb128 .LVU945
+.LLST437:
+	.byte	0x4
+	.uleb128 .LVL149-.Ltext0
+	.uleb128 .LVL150-.Ltext0
+	.uleb128 0x1
+	.byte	0x62
+	.byte	0
+.LVUS438:
+	.uleb128 .LVU956
+	.uleb128 .LVU958
+.LLST438:
+	.byte	0x4
+	.uleb128 .LVL150-.Ltext0
+	.uleb128 .LVL150-.Ltext0
+	.uleb128 0x1
+	.byte	0x62
+	.byte	0
+.LVUS439:
+	.uleb128 .LVU956
+	.uleb128 .LVU958
+.LLST439:
+	.byte	0x4
+	.uleb128 .LVL150-.Ltext0
+	.uleb128 .LVL150-.Ltext0
+	.uleb128 0x1
+	.byte	0x66
+	.byte	0
+.LVUS441:
+	.uleb128 .LVU964
+	.uleb128 .LVU966
+.LLST441:
+	.byte	0x4
+	.uleb128 .LVL151-.Ltext0
+	.uleb128 .LVL151-.Ltext0
+	.uleb128 0x1
+	.byte	0x66
+	.byte	0
+.LVUS442:
+	.uleb128 .LVU964
+	.uleb128 .LVU966
+.LLST442:
+	.byte	0x4
+	.uleb128 .LVL151-.Ltext0
+	.uleb128 .LVL151-.Ltext0
+	.uleb128 0x1
+	.byte	0x61
+	.byte	0
+.LVUS444:
+	.uleb128 .LVU966
+	.uleb128 .LVU974
+.LLST444:
+	.byte	0x4
+	.uleb128 .LVL151-.Ltext0
+	.uleb128 .LVL153-.Ltext0
+	.uleb128 0x2
+	.byte	0x40
+	.byte	0x9f
+	.byte	0
+.LVUS445:
+	.uleb128 .LVU972
+	.uleb128 .LVU974
+.LLST445:
+	.byte	0x4
+	.uleb128 .LVL152-.Ltext0
+	.uleb128 .LVL153-.Ltext0
+	.uleb128 0x1
+	.byte	0x61
+	.byte	0
+.LVUS446:
+	.uleb128 .LVU976
+	.uleb128 .LVU979
+.LLST446:
+	.byte	0x4
+	.uleb128 .LVL153-.Ltext0
+	.uleb128 .LVL154-.Ltext0
+	.uleb128 0x1
+	.byte	0x61
+	.byte	0
+.LVUS447:
+	.uleb128 .LVU976
+	.uleb128 .LVU979
+.LLST447:
+	.byte	0x4
+	.uleb128 .LVL153-.Ltext0
+	.uleb128 .LVL154-.Ltext0
+	.uleb128 0x1
+	.byte	0x63
+	.byte	0
+.LVUS449:
+	.uleb128 .LVU981
+	.uleb128 .LVU983
+.LLST449:
+	.byte	0x4
+	.uleb128 .LVL154-.Ltext0
+	.uleb128 .LVL154-.Ltext0
+	.uleb128 0x1
+	.byte	0x63
+	.byte	0
+.LVUS450:
+	.uleb128 .LVU981
+	.uleb128 .LVU983
+.LLST450:
+	.byte	0x4
+	.uleb128 .LVL154-.Ltext0
+	.uleb128 .LVL154-.Ltext0
+	.uleb128 0x1
+	.byte	0x62
+	.byte	0
+.LVUS452:
+	.uleb128 .LVU983
+	.uleb128 .LVU989
+.LLST452:
+	.byte	0x4
+	.uleb128 .LVL154-.Ltext0
+	.uleb128 .LVL156-.Ltext0
+	.uleb128 0x2
+	.byte	0x3c
+	.byte	0x9f
+	.byte	0
+.LVUS453:
+	.uleb128 .LVU987
+	.uleb128 .LVU989
+.LLST453:
+	.byte	0x4
+	.uleb128 .LVL155-.Ltext0
+	.uleb128 .LVL156-.Ltext0
+	.uleb128 0x1
+	.byte	0x62
+	.byte	0
+.LVUS454:
+	.uleb128 .LVU991
+	.uleb128 .LVU993
+.LLST454:
+	.byte	0x4
+	.uleb128 .LVL156-.Ltext0
+	.uleb128 .LVL156-.Ltext0
+	.uleb128 0x1
+	.byte	0x62
+	.byte	0
+.LVUS455:
+	.uleb128 .LVU991
+	.uleb128 .LVU993
+.LLST455:
+	.byte	0x4
+	.uleb128 .LVL156-.Ltext0
+	.uleb128 .LVL156-.Ltext0
+	.uleb128 0x1
+	.byte	0x66
+	.byte	0
+.LVUS456:
+	.uleb128 .LVU993
+	.uleb128 .LVU997
+.LLST456:
+	.byte	0x4
+	.uleb128 .LVL156-.Ltext0
+	.uleb128 .LVL157-.Ltext0
+	.uleb128 0x1
+	.byte	0x69
+	.byte	0
+.LVUS458:
+	.uleb128 .LVU1000
+	.uleb128 .LVU1002
+.LLST458:
+	.byte	0x4
+	.uleb128 .LVL158-.Ltext0
+	.uleb128 .LVL158-.Ltext0
+	.uleb128 0x1
+	.byte	0x69
+	.byte	0
+.LVUS459:
+	.uleb128 .LVU1000
+	.uleb128 .LVU1002
+.LLST459:
+	.byte	0x4
+	.uleb128 .LVL158-.Ltext0
+	.uleb128 .LVL158-.Ltext0
+	.uleb128 0x1
+	.byte	0x61
+	.byte	0
+.LVUS461:
+	.uleb128 .LVU1002
+	.uleb128 .LVU1009
+.LLST461:
+	.byte	0x4
+	.uleb128 .LVL158-.Ltext0
+	.uleb128 .LVL160-.Ltext0
+	.uleb128 0x2
+	.byte	0x38
+	.byte	0x9f
+	.byte	0
+.LVUS462:
+	.uleb128 .LVU1007
+	.uleb128 .LVU1009
+.LLST462:
+	.byte	0x4
+	.uleb128 .LVL159-.Ltext0
+	.uleb128 .LVL160-.Ltext0
+	.uleb128 0x1
+	.byte	0x61
+	.byte	0
+.LVUS464:
+	.uleb128 .LVU1011
+	.uleb128 .LVU1017
+.LLST464:
+	.byte	0x4
+	.uleb128 .LVL160-.Ltext0
+	.uleb128 .LVL161-.Ltext0
+	.uleb128 0x1
+	.byte	0x61
+	.byte	0
+.LVUS465:
+	.uleb128 .LVU1011
+	.uleb128 .LVU1017
+.LLST465:
+	.byte	0x4
+	.uleb128 .LVL160-.Ltext0
+	.uleb128 .LVL161-.Ltext0
+	.uleb128 0x1
+	.byte	0x63
+	.byte	0
+.LVUS467:
+	.uleb128 .LVU1019
+	.uleb128 .LVU1021
+.LLST467:
+	.byte	0x4
+	.uleb128 .LVL161-.Ltext0
+	.uleb128 .LVL161-.Ltext0
+	.uleb128 0x1
+	.byte	0x63
+	.byte	0
+.LVUS468:
+	.uleb128 .LVU1019
+	.uleb128 .LVU1021
+.LLST468:
+	.byte	0x4
+	.uleb128 .LVL161-.Ltext0
+	.uleb128 .LVL161-.Ltext0
+	.uleb128 0x1
+	.byte	0x62
+	.byte	0
+.LVUS470:
+	.uleb128 .LVU1021
+	.uleb128 .LVU1031
+.LLST470:
+	.byte	0x4
+	.uleb128 .LVL161-.Ltext0
+	.uleb128 .LVL165-.Ltext0
+	.uleb128 0x2
+	.byte	0x37
+	.byte	0x9f
+	.byte	0
+.LVUS471:
+	.uleb128 .LVU1027
+	.uleb128 .LVU1031
+.LLST471:
+	.byte	0x4
+	.uleb128 .LVL163-.Ltext0
+	.uleb128 .LVL165-.Ltext0
+	.uleb128 0x1
+	.byte	0x62
+	.byte	0
+.LVUS473:
+	.uleb128 .LVU1043
+	.uleb128 .LVU1045
+.LLST473:
+	.byte	0x4
+	.uleb128 .LVL166-.Ltext0
+	.uleb128 .LVL166-.Ltext0
+	.uleb128 0x3
+	.byte	0x8
+	.byte	0x39
+	.byte	0x9f
+	.byte	0
+.LVUS475:
+	.uleb128 .LVU1039
+	.uleb128 .LVU1041
+.LLST475:
+	.byte	0x4
+	.uleb128 .LVL166-.Ltext0
+	.uleb128 .LVL166-.Ltext0
+	.uleb128 0x3
+	.byte	0x8
+	.byte	0x4e
+	.byte	0x9f
+	.byte	0
+.LVUS476:
+	.uleb128 .LVU1034
+	.uleb128 .LVU1037
+.LLST476:
+	.byte	0x4
+	.uleb128 .LVL165-.Ltext0
+	.uleb128 .LVL166-.Ltext0
+	.uleb128 0x3
+	.byte	0x8
+	.byte	0x93
+	.byte	0x9f
+	.byte	0
+.LVUS477:
+	.uleb128 .LVU1034
+	.uleb128 .LVU1037
+.LLST477:
+	.byte	0x4
+	.uleb128 .LVL165-.Ltext0
+	.uleb128 .LVL166-.Ltext0
+	.uleb128 0x1
+	.byte	0x62
+	.byte	0
+.LVUS480:
+	.uleb128 .LVU1054
+	.uleb128 .LVU1056
+.LLST480:
+	.byte	0x4
+	.uleb128 .LVL166-.Ltext0
+	.uleb128 .LVL166-.Ltext0
+	.uleb128 0x1
+	.byte	0x65
+	.byte	0
+.LVUS481:
+	.uleb128 .LVU1054
+	.uleb128 .LVU1056
+.LLST481:
+	.byte	0x4
+	.uleb128 .LVL166-.Ltext0
+	.uleb128 .LVL166-.Ltext0
+	.uleb128 0x1
+	.byte	0x64
+	.byte	0
+.LVUS484:
+	.uleb128 .LVU1070
+	.uleb128 .LVU1072
+.LLST484:
+	.byte	0x4
+	.uleb128 .LVL166-.Ltext0
+	.uleb128 .LVL166-.Ltext0
+	.uleb128 0x2
+	.byte	0x31
+	.byte	0x9f
+	.byte	0
+.LVUS486:
+	.uleb128 .LVU1050
+	.uleb128 .LVU1052
+.LLST486:
+	.byte	0x4
+	.uleb128 .LVL166-.Ltext0
+	.uleb128 .LVL166-.Ltext0
+	.uleb128 0x1
+	.byte	0x65
+	.byte	0
+.LVUS487:
+	.uleb128 .LVU1050
+	.uleb128 .LVU1052
+.LLST487:
+	.byte	0x4
+	.uleb128 .LVL166-.Ltext0
+	.uleb128 .LVL166-.Ltext0
+	.uleb128 0x1
+	.byte	0x64
+	.byte	0
+.LVUS490:
+	.uleb128 .LVU1062
+	.uleb128 .LVU1064
+.LLST490:
+	.byte	0x4
+	.uleb128 .LVL166-.Ltext0
+	.uleb128 .LVL166-.Ltext0
+	.uleb128 0x2
+	.byte	0x31
+	.byte	0x9f
+	.byte	0
+.LVUS491:
+	.uleb128 .LVU1075
+	.uleb128 .LVU1077
+.LLST491:
+	.byte	0x4
+	.uleb128 .LVL166-.Ltext0
+	.uleb128 .LVL166-.Ltext0
+	.uleb128 0x1
+	.byte	0x62
+	.byte	0
+.LVUS492:
+	.uleb128 .LVU1075
+	.uleb128 .LVU1077
+.LLST492:
+	.byte	0x4
+	.uleb128 .LVL166-.Ltext0
+	.uleb128 .LVL166-.Ltext0
+	.uleb128 0x1
+	.byte	0x69
+	.byte	0
+.LVUS494:
+	.uleb128 .LVU1083
+	.uleb128 .LVU1085
+.LLST494:
+	.byte	0x4
+	.uleb128 .LVL167-.Ltext0
+	.uleb128 .LVL167-.Ltext0
+	.uleb128 0x1
+	.byte	0x68
+	.byte	0
+.LVUS495:
+	.uleb128 .LVU1083
+	.uleb128 .LVU1085
+.LLST495:
+	.byte	0x4
+	.uleb128 .LVL167-.Ltext0
+	.uleb128 .LVL167-.Ltext0
+	.uleb128 0x1
+	.byte	0x61
+	.byte	0
+.LVUS497:
+	.uleb128 .LVU1085
+	.uleb128 .LVU1092
+.LLST497:
+	.byte	0x4
+	.uleb128 .LVL167-.Ltext0
+	.uleb128 .LVL169-.Ltext0
+	.uleb128 0x2
+	.byte	0x40
+	.byte	0x9f
+	.byte	0
+.LVUS498:
+	.uleb128 .LVU1090
+	.uleb128 .LVU1092
+.LLST498:
+	.byte	0x4
+	.uleb128 .LVL168-.Ltext0
+	.uleb128 .LVL169-.Ltext0
+	.uleb128 0x1
+	.byte	0x61
+	.byte	0
+.LVUS500:
+	.uleb128 .LVU1094
+	.uleb128 .LVU1098
+.LLST500:
+	.byte	0x4
+	.uleb128 .LVL169-.Ltext0
+	.uleb128 .LVL170-.Ltext0
+	.uleb128 0x1
+	.byte	0x61
+	.byte	0
+.LVUS501:
+	.uleb128 .LVU1094
+	.uleb128 .LVU1098
+.LLST501:
+	.byte	0x4
+	.uleb128 .LVL169-.Ltext0
+	.uleb128 .LVL170-.Ltext0
+	.uleb128 0x1
+	.byte	0x63
+	.byte	0
+.LVUS503:
+	.uleb128 .LVU1100
+	.uleb128 .LVU1102
+.LLST503:
+	.byte	0x4
+	.uleb128 .LVL170-.Ltext0
+	.uleb128 .LVL170-.Ltext0
+	.uleb128 0x1
+	.byte	0x63
+	.byte	0
+.LVUS504:
+	.uleb128 .LVU1100
+	.uleb128 .LVU1102
+.LLST504:
+	.byte	0x4
+	.uleb128 .LVL170-.Ltext0
+	.uleb128 .LVL170-.Ltext0
+	.uleb128 0x1
+	.byte	0x62
+	.byte	0
+.LVUS506:
+	.uleb128 .LVU1102
+	.uleb128 .LVU1108
+.LLST506:
+	.byte	0x4
+	.uleb128 .LVL170-.Ltext0
+	.uleb128 .LVL172-.Ltext0
+	.uleb128 0x2
+	.byte	0x3c
+	.byte	0x9f
+	.byte	0
+.LVUS507:
+	.uleb128 .LVU1106
+	.uleb128 .LVU1108
+.LLST507:
+	.byte	0x4
+	.uleb128 .LVL171-.Ltext0
+	.uleb128 .LVL172-.Ltext0
+	.uleb128 0x1
+	.byte	0x62
+	.byte	0
+.LVUS508:
+	.uleb128 .LVU1110
+	.uleb128 .LVU1112
+.LLST508:
+	.byte	0x4
+	.uleb128 .LVL172-.Ltext0
+	.uleb128 .LVL172-.Ltext0
+	.uleb128 0x1
+	.byte	0x62
+	.byte	0
+.LVUS509:
+	.uleb128 .LVU1110
+	.uleb128 .LVU1112
+.LLST509:
+	.byte	0x4
+	.uleb128 .LVL172-.Ltext0
+	.uleb128 .LVL172-.Ltext0
+	.uleb128 0x1
+	.byte	0x68
+	.byte	0
+.LVUS510:
+	.uleb128 .LVU1112
+	.uleb128 .LVU1116
+.LLST510:
+	.byte	0x4
+	.uleb128 .LVL172-.Ltext0
+	.uleb128 .LVL173-.Ltext0
+	.uleb128 0x1
+	.byte	0x66
+	.byte	0
+.LVUS512:
+	.uleb128 .LVU1119
+	.uleb128 .LVU1121
+.LLST512:
+	.byte	0x4
+	.uleb128 .LVL174-.Ltext0
+	.uleb128 .LVL174-.Ltext0
+	.uleb128 0x1
+	.byte	0x66
+	.byte	0
+.LVUS513:
+	.uleb128 .LVU1119
+	.uleb128 .LVU1121
+.LLST513:
+	.byte	0x4
+	.uleb128 .LVL174-.Ltext0
+	.uleb128 .LVL174-.Ltext0
+	.uleb128 0x1
+	.byte	0x61
+	.byte	0
+.LVUS515:
+	.uleb128 .LVU1121
+	.uleb128 .LVU1127
+.LLST515:
+	.byte	0x4
+	.uleb128 .LVL174-.Ltext0
+	.uleb128 .LVL176-.Ltext0
+	.uleb128 0x2
+	.byte	0x38
+	.byte	0x9f
+	.byte	0
+.LVUS516:
+	.uleb128 .LVU1125
+	.uleb128 .LVU1127
+.LLST516:
+	.byte	0x4
+	.uleb128 .LVL175-.Ltext0
+	.uleb128 .LVL176-.Ltext0
+	.uleb128 0x1
+	.byte	0x61
+	.byte	0
+.LVUS517:
+	.uleb128 .LVU1129
+	.uleb128 .LVU1132
+.LLST517:
+	.byte	0x4
+	.uleb128 .LVL176-.Ltext0
+	.uleb128 .LVL177-.Ltext0
+	.uleb128 0x1
+	.byte	0x61
+	.byte	0
+.LVUS518:
+	.uleb128 .LVU1129
+	.uleb128 .LVU1132
+.LLST518:
+	.byte	0x4
+	.uleb128 .LVL176-.Ltext0
+	.uleb128 .LVL177-.Ltext0
+	.uleb128 0x1
+	.byte	0x63
+	.byte	0
+.LVUS520:
+	.uleb128 .LVU1134
+	.uleb128 .LVU1136
+.LLST520:
+	.byte	0x4
+	.uleb128 .LVL177-.Ltext0
+	.uleb128 .LVL177-.Ltext0
+	.uleb128 0x1
+	.byte	0x63
+	.byte	0
+.LVUS521:
+	.uleb128 .LVU1134
+	.uleb128 .LVU1136
+.LLST521:
+	.byte	0x4
+	.uleb128 .LVL177-.Ltext0
+	.uleb128 .LVL177-.Ltext0
+	.uleb128 0x1
+	.byte	0x62
+	.byte	0
+.LVUS523:
+	.uleb128 .LVU1136
+	.uleb128 .LVU1146
+.LLST523:
+	.byte	0x4
+	.uleb128 .LVL177-.Ltext0
+	.uleb128 .LVL181-.Ltext0
+	.uleb128 0x2
+	.byte	0x37
+	.byte	0x9f
+	.byte	0
+.LVUS524:
+	.uleb128 .LVU1142
+	.uleb128 .LVU1146
+.LLST524:
+	.byte	0x4
+	.uleb128 .LVL179-.Ltext0
+	.uleb128 .LVL181-.Ltext0
+	.uleb128 0x1
+	.byte	0x62
+	.byte	0
+.LVUS526:
+	.uleb128 .LVU1158
+	.uleb128 .LVU1160
+.LLST526:
+	.byte	0x4
+	.uleb128 .LVL182-.Ltext0
+	.uleb128 .LVL182-.Ltext0
+	.uleb128 0x3
+	.byte	0x8
+	.byte	0x93
+	.byte	0x9f
+	.byte	0
+.LVUS528:
+	.uleb128 .LVU1154
+	.uleb128 .LVU1156
+.LLST528:
+	.byte	0x4
+	.uleb128 .LVL182-.Ltext0
+	.uleb128 .LVL182-.Ltext0
+	.uleb128 0x3
+	.byte	0x8
+	.byte	0x4e
+	.byte	0x9f
+	.byte	0
+.LVUS529:
+	.uleb128 .LVU1149
+	.uleb128 .LVU1152
+.LLST529:
+	.byte	0x4
+	.uleb128 .LVL181-.Ltext0
+	.uleb128 .LVL182-.Ltext0
+	.uleb128 0x3
+	.byte	0x8
+	.byte	0x39
+	.byte	0x9f
+	.byte	0
+.LVUS530:
+	.uleb128 .LVU1149
+	.uleb128 .LVU1152
+.LLST530:
+	.byte	0x4
+	.uleb128 .LVL181-.Ltext0
+	.uleb128 .LVL182-.Ltext0
+	.uleb128 0x1
+	.byte	0x62
+	.byte	0
+.LVUS531:
+	.uleb128 .LVU1163
+	.uleb128 .LVU1165
+.LLST531:
+	.byte	0x4
+	.uleb128 .LVL182-.Ltext0
+	.uleb128 .LVL182-.Ltext0
+	.uleb128 0x1
+	.byte	0x62
+	.byte	0
+.LVUS532:
+	.uleb128 .LVU1163
+	.uleb128 .LVU1165
+.LLST532:
+	.byte	0x4
+	.uleb128 .LVL182-.Ltext0
+	.uleb128 .LVL182-.Ltext0
+	.uleb128 0x1
+	.byte	0x66
+	.byte	0
+.LVUS534:
+	.uleb128 .LVU1171
+	.uleb128 .LVU1173
+.LLST534:
+	.byte	0x4
+	.uleb128 .LVL183-.Ltext0
+	.uleb128 .LVL183-.Ltext0
+	.uleb128 0x1
+	.byte	0x66
+	.byte	0
+.LVUS535:
+	.uleb128 .LVU1171
+	.uleb128 .LVU1173
+.LLST535:
+	.byte	0x4
+	.uleb128 .LVL183-.Ltext0
+	.uleb128 .LVL183-.Ltext0
+	.uleb128 0x1
+	.byte	0x61
+	.byte	0
+.LVUS537:
+	.uleb128 .LVU1173
+	.uleb128 .LVU1181
+.LLST537:
+	.byte	0x4
+	.uleb128 .LVL183-.Ltext0
+	.uleb128 .LVL185-.Ltext0
+	.uleb128 0x2
+	.byte	0x40
+	.byte	0x9f
+	.byte	0
+.LVUS538:
+	.uleb128 .LVU1179
+	.uleb128 .LVU1181
+.LLST538:
+	.byte	0x4
+	.uleb128 .LVL184-.Ltext0
+	.uleb128 .LVL185-.Ltext0
+	.uleb128 0x1
+	.byte	0x61
+	.byte	0
+.LVUS539:
+	.uleb128 .LVU1183
+	.uleb128 .LVU1186
+.LLST539:
+	.byte	0x4
+	.uleb128 .LVL185-.Ltext0
+	.uleb128 .LVL186-.Ltext0
+	.uleb128 0x1
+	.byte	0x61
+	.byte	0
+.LVUS540:
+	.uleb128 .LVU1183
+	.uleb128 .LVU1186
+.LLST540:
+	.byte	0x4
+	.uleb128 .LVL185-.Ltext0
+	.uleb128 .LVL186-.Ltext0
+	.uleb128 0x1
+	.byte	0x63
+	.byte	0
+.LVUS542:
+	.uleb128 .LVU1188
+	.uleb128 .LVU1190
+.LLST542:
+	.byte	0x4
+	.uleb128 .LVL186-.Ltext0
+	.uleb128 .LVL186-.Ltext0
+	.uleb128 0x1
+	.byte	0x63
+	.byte	0
+.LVUS543:
+	.uleb128 .LVU1188
+	.uleb128 .LVU1190
+.LLST543:
+	.byte	0x4
+	.uleb128 .LVL186-.Ltext0
+	.uleb128 .LVL186-.Ltext0
+	.uleb128 0x1
+	.byte	0x62
+	.byte	0
+.LVUS545:
+	.uleb128 .LVU1190
+	.uleb128 .LVU1196
+.LLST545:
+	.byte	0x4
+	.uleb128 .LVL186-.Ltext0
+	.uleb128 .LVL188-.Ltext0
+	.uleb128 0x2
+	.byte	0x3c
+	.byte	0x9f
+	.byte	0
+.LVUS546:
+	.uleb128 .LVU1194
+	.uleb128 .LVU1196
+.LLST546:
+	.byte	0x4
+	.uleb128 .LVL187-.Ltext0
+	.uleb128 .LVL188-.Ltext0
+	.uleb128 0x1
+	.byte	0x62
+	.byte	0
+.LVUS547:
+	.uleb128 .LVU1198
+	.uleb128 .LVU1200
+.LLST547:
+	.byte	0x4
+	.uleb128 .LVL188-.Ltext0
+	.uleb128 .LVL188-.Ltext0
+	.uleb128 0x1
+	.byte	0x62
+	.byte	0
+.LVUS548:
+	.uleb128 .LVU1198
+	.uleb128 .LVU1200
+.LLST548:
+	.byte	0x4
+	.uleb128 .LVL188-.Ltext0
+	.uleb128 .LVL188-.Ltext0
+	.uleb128 0x1
+	.byte	0x66
+	.byte	0
+.LVUS549:
+	.uleb128 .LVU1200
+	.uleb128 .LVU1204
+.LLST549:
+	.byte	0x4
+	.uleb128 .LVL188-.Ltext0
+	.uleb128 .LVL189-.Ltext0
+	.uleb128 0x1
+	.byte	0x6a
+	.byte	0
+.LVUS551:
+	.uleb128 .LVU1207
+	.uleb128 .LVU1209
+.LLST551:
+	.byte	0x4
+	.uleb128 .LVL190-.Ltext0
+	.uleb128 .LVL190-.Ltext0
+	.uleb128 0x1
+	.byte	0x6a
+	.byte	0
+.LVUS552:
+	.uleb128 .LVU1207
+	.uleb128 .LVU1209
+.LLST552:
+	.byte	0x4
+	.uleb128 .LVL190-.Ltext0
+	.uleb128 .LVL190-.Ltext0
+	.uleb128 0x1
+	.byte	0x61
+	.byte	0
+.LVUS554:
+	.uleb128 .LVU1209
+	.uleb128 .LVU1216
+.LLST554:
+	.byte	0x4
+	.uleb128 .LVL190-.Ltext0
+	.uleb128 .LVL192-.Ltext0
+	.uleb128 0x2
+	.byte	0x38
+	.byte	0x9f
+	.byte	0
+.LVUS555:
+	.uleb128 .LVU1214
+	.uleb128 .LVU1216
+.LLST555:
+	.byte	0x4
+	.uleb128 .LVL191-.Ltext0
+	.uleb128 .LVL192-.Ltext0
+	.uleb128 0x1
+	.byte	0x61
+	.byte	0
+.LVUS557:
+	.uleb128 .LVU1218
+	.uleb128 .LVU1224
+.LLST557:
+	.byte	0x4
+	.uleb128 .LVL192-.Ltext0
+	.uleb128 .LVL193-.Ltext0
+	.uleb128 0x1
+	.byte	0x61
+	.byte	0
+.LVUS558:
+	.uleb128 .LVU1218
+	.uleb128 .LVU1224
+.LLST558:
+	.byte	0x4
+	.uleb128 .LVL192-.Ltext0
+	.uleb128 .LVL193-.Ltext0
+	.uleb128 0x1
+	.byte	0x63
+	.byte	0
+.LVUS560:
+	.uleb128 .LVU1226
+	.uleb128 .LVU1228
+.LLST560:
+	.byte	0x4
+	.uleb128 .LVL193-.Ltext0
+	.uleb128 .LVL193-.Ltext0
+	.uleb128 0x1
+	.byte	0x63
+	.byte	0
+.LVUS561:
+	.uleb128 .LVU1226
+	.uleb128 .LVU1228
+.LLST561:
+	.byte	0x4
+	.uleb128 .LVL193-.Ltext0
+	.uleb128 .LVL193-.Ltext0
+	.uleb128 0x1
+	.byte	0x62
+	.byte	0
+.LVUS563:
+	.uleb128 .LVU1228
+	.uleb128 .LVU1238
+.LLST563:
+	.byte	0x4
+	.uleb128 .LVL193-.Ltext0
+	.uleb128 .LVL197-.Ltext0
+	.uleb128 0x2
+	.byte	0x37
+	.byte	0x9f
+	.byte	0
+.LVUS564:
+	.uleb128 .LVU1234
+	.uleb128 .LVU1238
+.LLST564:
+	.byte	0x4
+	.uleb128 .LVL195-.Ltext0
+	.uleb128 .LVL197-.Ltext0
+	.uleb128 0x1
+	.byte	0x62
+	.byte	0
+.LVUS566:
+	.uleb128 .LVU1250
+	.uleb128 .LVU1252
+.LLST566:
+	.byte	0x4
+	.uleb128 .LVL198-.Ltext0
+	.uleb128 .LVL198-.Ltext0
+	.uleb128 0x3
+	.byte	0x8
+	.byte	0x39
+	.byte	0x9f
+	.byte	0
+.LVUS568:
+	.uleb128 .LVU1246
+	.uleb128 .LVU1248
+.LLST568:
+	.byte	0x4
+	.uleb128 .LVL198-.Ltext0
+	.uleb128 .LVL198-.Ltext0
+	.uleb128 0x3
+	.byte	0x8
+	.byte	0x4e
+	.byte	0x9f
+	.byte	0
+.LVUS569:
+	.uleb128 .LVU1241
+	.uleb128 .LVU1244
+.LLST569:
+	.byte	0x4
+	.uleb128 .LVL197-.Ltext0
+	.uleb128 .LVL198-.Ltext0
+	.uleb128 0x3
+	.byte	0x8
+	.byte	0x93
+	.byte	0x9f
+	.byte	0
+.LVUS570:
+	.uleb128 .LVU1241
+	.uleb128 .LVU1244
+.LLST570:
+	.byte	0x4
+	.uleb128 .LVL197-.Ltext0
+	.uleb128 .LVL198-.Ltext0
+	.uleb128 0x1
+	.byte	0x62
+	.byte	0
+.LVUS573:
+	.uleb128 .LVU1261
+	.uleb128 .LVU1263
+.LLST573:
+	.byte	0x4
+	.uleb128 .LVL198-.Ltext0
+	.uleb128 .LVL198-.Ltext0
+	.uleb128 0x1
+	.byte	0x65
+	.byte	0
+.LVUS574:
+	.uleb128 .LVU1261
+	.uleb128 .LVU1263
+.LLST574:
+	.byte	0x4
+	.uleb128 .LVL198-.Ltext0
+	.uleb128 .LVL198-.Ltext0
+	.uleb128 0x1
+	.byte	0x64
+	.byte	0
+.LVUS577:
+	.uleb128 .LVU1277
+	.uleb128 .LVU1279
+.LLST577:
+	.byte	0x4
+	.uleb128 .LVL198-.Ltext0
+	.uleb128 .LVL198-.Ltext0
+	.uleb128 0x2
+	.byte	0x31
+	.byte	0x9f
+	.byte	0
+.LVUS579:
+	.uleb128 .LVU1257
+	.uleb128 .LVU1259
+.LLST579:
+	.byte	0x4
+	.uleb128 .LVL198-.Ltext0
+	.uleb128 .LVL198-.Ltext0
+	.uleb128 0x1
+	.byte	0x65
+	.byte	0
+.LVUS580:
+	.uleb128 .LVU1257
+	.uleb128 .LVU1259
+.LLST580:
+	.byte	0x4
+	.uleb128 .LVL198-.Ltext0
+	.uleb128 .LVL198-.Ltext0
+	.uleb128 0x1
+	.byte	0x64
+	.byte	0
+.LVUS583:
+	.uleb128 .LVU1269
+	.uleb128 .LVU1271
+.LLST583:
+	.byte	0x4
+	.uleb128 .LVL198-.Ltext0
+	.uleb128 .LVL198-.Ltext0
+	.uleb128 0x2
+	.byte	0x31
+	.byte	0x9f
+	.byte	0
+.LVUS584:
+	.uleb128 .LVU1282
+	.uleb128 .LVU1284
+.LLST584:
+	.byte	0x4
+	.uleb128 .LVL198-.Ltext0
+	.uleb128 .LVL198-.Ltext0
+	.uleb128 0x1
+	.byte	0x62
+	.byte	0
+.LVUS585:
+	.uleb128 .LVU1282
+	.uleb128 .LVU1284
+.LLST585:
+	.byte	0x4
+	.uleb128 .LVL198-.Ltext0
+	.uleb128 .LVL198-.Ltext0
+	.uleb128 0x1
+	.byte	0x6a
+	.byte	0
+.LVUS587:
+	.uleb128 .LVU1290
+	.uleb128 .LVU1292
+.LLST587:
+	.byte	0x4
+	.uleb128 .LVL199-.Ltext0
+	.uleb128 .LVL199-.Ltext0
+	.uleb128 0x1
+	.byte	0x68
+	.byte	0
+.LVUS588:
+	.uleb128 .LVU1290
+	.uleb128 .LVU1292
+.LLST588:
+	.byte	0x4
+	.uleb128 .LVL199-.Ltext0
+	.uleb128 .LVL199-.Ltext0
+	.uleb128 0x1
+	.byte	0x61
+	.byte	0
+.LVUS590:
+	.uleb128 .LVU1292
+	.uleb128 .LVU1299
+.LLST590:
+	.byte	0x4
+	.uleb128 .LVL199-.Ltext0
+	.uleb128 .LVL201-.Ltext0
+	.uleb128 0x2
+	.byte	0x40
+	.byte	0x9f
+	.byte	0
+.LVUS591:
+	.uleb128 .LVU1297
+	.uleb128 .LVU1299
+.LLST591:
+	.byte	0x4
+	.uleb128 .LVL200-.Ltext0
+	.uleb128 .LVL201-.Ltext0
+	.uleb128 0x1
+	.byte	0x61
+	.byte	0
+.LVUS593:
+	.uleb128 .LVU1301
+	.uleb128 .LVU1305
+.LLST593:
+	.byte	0x4
+	.uleb128 .LVL201-.Ltext0
+	.uleb128 .LVL202-.Ltext0
+	.uleb128 0x1
+	.byte	0x61
+	.byte	0
+.LVUS594:
+	.uleb128 .LVU1301
+	.uleb128 .LVU1305
+.LLST594:
+	.byte	0x4
+	.uleb128 .LVL201-.Ltext0
+	.uleb128 .LVL202-.Ltext0
+	.uleb128 0x1
+	.byte	0x63
+	.byte	0
+.LVUS596:
+	.uleb128 .LVU1307
+	.uleb128 .LVU1309
+.LLST596:
+	.byte	0x4
+	.uleb128 .LVL202-.Ltext0
+	.uleb128 .LVL202-.Ltext0
+	.uleb128 0x1
+	.byte	0x63
+	.byte	0
+.LVUS597:
+	.uleb128 .LVU1307
+	.uleb128 .LVU1309
+.LLST597:
+	.byte	0x4
+	.uleb128 .LVL202-.Ltext0
+	.uleb128 .LVL202-.Ltext0
+	.uleb128 0x1
+	.byte	0x62
+	.byte	0
+.LVUS599:
+	.uleb128 .LVU1309
+	.uleb128 .LVU1315
+.LLST599:
+	.byte	0x4
+	.uleb128 .LVL202-.Ltext0
+	.uleb128 .LVL204-.Ltext0
+	.uleb128 0x2
+	.byte	0x3c
+	.byte	0x9f
+	.byte	0
+.LVUS600:
+	.uleb128 .LVU1313
+	.uleb128 .LVU1315
+.LLST600:
+	.byte	0x4
+	.uleb128 .LVL203-.Ltext0
+	.uleb128 .LVL204-.Ltext0
+	.uleb128 0x1
+	.byte	0x62
+	.byte	0
+.LVUS601:
+	.uleb128 .LVU1317
+	.uleb128 .LVU1319
+.LLST601:
+	.byte	0x4
+	.uleb128 .LVL204-.Ltext0
+	.uleb128 .LVL204-.Ltext0
+	.uleb128 0x1
+	.byte	0x62
+	.byte	0
+.LVUS602:
+	.uleb128 .LVU1317
+	.uleb128 .LVU1319
+.LLST602:
+	.byte	0x4
+	.uleb128 .LVL204-.Ltext0
+	.uleb128 .LVL204-.Ltext0
+	.uleb128 0x1
+	.byte	0x68
+	.byte	0
+.LVUS603:
+	.uleb128 .LVU1319
+	.uleb128 .LVU1323
+.LLST603:
+	.byte	0x4
+	.uleb128 .LVL204-.Ltext0
+	.uleb128 .LVL205-.Ltext0
+	.uleb128 0x1
+	.byte	0x66
+	.byte	0
+.LVUS605:
+	.uleb128 .LVU1326
+	.uleb128 .LVU1328
+.LLST605:
+	.byte	0x4
+	.uleb128 .LVL206-.Ltext0
+	.uleb128 .LVL206-.Ltext0
+	.uleb128 0x1
+	.byte	0x66
+	.byte	0
+.LVUS606:
+	.uleb128 .LVU1326
+	.uleb128 .LVU1328
+.LLST606:
+	.byte	0x4
+	.uleb128 .LVL206-.Ltext0
+	.uleb128 .LVL206-.Ltext0
+	.uleb128 0x1
+	.byte	0x61
+	.byte	0
+.LVUS608:
+	.uleb128 .LVU1328
+	.uleb128 .LVU1334
+.LLST608:
+	.byte	0x4
+	.uleb128 .LVL206-.Ltext0
+	.uleb128 .LVL208-.Ltext0
+	.uleb128 0x2
+	.byte	0x38
+	.byte	0x9f
+	.byte	0
+.LVUS609:
+	.uleb128 .LVU1332
+	.uleb128 .LVU1334
+.LLST609:
+	.byte	0x4
+	.uleb128 .LVL207-.Ltext0
+	.uleb128 .LVL208-.Ltext0
+	.uleb128 0x1
+	.byte	0x61
+	.byte	0
+.LVUS610:
+	.uleb128 .LVU1336
+	.uleb128 .LVU1339
+.LLST610:
+	.byte	0x4
+	.uleb128 .LVL208-.Ltext0
+	.uleb128 .LVL209-.Ltext0
+	.uleb128 0x1
+	.byte	0x61
+	.byte	0
+.LVUS611:
+	.uleb128 .LVU1336
+	.uleb128 .LVU1339
+.LLST611:
+	.byte	0x4
+	.uleb128 .LVL208-.Ltext0
+	.uleb128 .LVL209-.Ltext0
+	.uleb128 0x1
+	.byte	0x63
+	.byte	0
+.LVUS613:
+	.uleb128 .LVU1341
+	.uleb128 .LVU1343
+.LLST613:
+	.byte	0x4
+	.uleb128 .LVL209-.Ltext0
+	.uleb128 .LVL209-.Ltext0
+	.uleb128 0x1
+	.byte	0x63
+	.byte	0
+.LVUS614:
+	.uleb128 .LVU1341
+	.uleb128 .LVU1343
+.LLST614:
+	.byte	0x4
+	.uleb128 .LVL209-.Ltext0
+	.uleb128 .LVL209-.Ltext0
+	.uleb128 0x1
+	.byte	0x62
+	.byte	0
+.LVUS616:
+	.uleb128 .LVU1343
+	.uleb128 .LVU1353
+.LLST616:
+	.byte	0x4
+	.uleb128 .LVL209-.Ltext0
+	.uleb128 .LVL213-.Ltext0
+	.uleb128 0x2
+	.byte	0x37
+	.byte	0x9f
+	.byte	0
+.LVUS617:
+	.uleb128 .LVU1349
+	.uleb128 .LVU1353
+.LLST617:
+	.byte	0x4
+	.uleb128 .LVL211-.Ltext0
+	.uleb128 .LVL213-.Ltext0
+	.uleb128 0x1
+	.byte	0x62
+	.byte	0
+.LVUS619:
+	.uleb128 .LVU1365
+	.uleb128 .LVU1367
+.LLST619:
+	.byte	0x4
+	.uleb128 .LVL214-.Ltext0
+	.uleb128 .LVL214-.Ltext0
+	.uleb128 0x3
+	.byte	0x8
+	.byte	0x93
+	.byte	0x9f
+	.byte	0
+.LVUS621:
+	.uleb128 .LVU1361
+	.uleb128 .LVU1363
+.LLST621:
+	.byte	0x4
+	.uleb128 .LVL214-.Ltext0
+	.uleb128 .LVL214-.Ltext0
+	.uleb128 0x3
+	.byte	0x8
+	.byte	0x4e
+	.byte	0x9f
+	.byte	0
+.LVUS622:
+	.uleb128 .LVU1356
+	.uleb128 .LVU1359
+.LLST622:
+	.byte	0x4
+	.uleb128 .LVL213-.Ltext0
+	.uleb128 .LVL214-.Ltext0
+	.uleb128 0x3
+	.byte	0x8
+	.byte	0x39
+	.byte	0x9f
+	.byte	0
+.LVUS623:
+	.uleb128 .LVU1356
+	.uleb128 .LVU1359
+.LLST623:
+	.byte	0x4
+	.uleb128 .LVL213-.Ltext0
+	.uleb128 .LVL214-.Ltext0
+	.uleb128 0x1
+	.byte	0x62
+	.byte	0
+.LVUS624:
+	.uleb128 .LVU1370
+	.uleb128 .LVU1372
+.LLST624:
+	.byte	0x4
+	.uleb128 .LVL214-.Ltext0
+	.uleb128 .LVL214-.Ltext0
+	.uleb128 0x1
+	.byte	0x62
+	.byte	0
+.LVUS625:
+	.uleb128 .LVU1370
+	.uleb128 .LVU1372
+.LLST625:
+	.byte	0x4
+	.uleb128 .LVL214-.Ltext0
+	.uleb128 .LVL214-.Ltext0
+	.uleb128 0x1
+	.byte	0x66
+	.byte	0
+.LVUS627:
+	.uleb128 .LVU1378
+	.uleb128 .LVU1380
+.LLST627:
+	.byte	0x4
+	.uleb128 .LVL215-.Ltext0
+	.uleb128 .LVL215-.Ltext0
+	.uleb128 0x1
+	.byte	0x66
+	.byte	0
+.LVUS628:
+	.uleb128 .LVU1378
+	.uleb128 .LVU1380
+.LLST628:
+	.byte	0x4
+	.uleb128 .LVL215-.Ltext0
+	.uleb128 .LVL215-.Ltext0
+	.uleb128 0x1
+	.byte	0x61
+	.byte	0
+.LVUS630:
+	.uleb128 .LVU1380
+	.uleb128 .LVU1388
+.LLST630:
+	.byte	0x4
+	.uleb128 .LVL215-.Ltext0
+	.uleb128 .LVL217-.Ltext0
+	.uleb128 0x2
+	.byte	0x40
+	.byte	0x9f
+	.byte	0
+.LVUS631:
+	.uleb128 .LVU1386
+	.uleb128 .LVU1388
+.LLST631:
+	.byte	0x4
+	.uleb128 .LVL216-.Ltext0
+	.uleb128 .LVL217-.Ltext0
+	.uleb128 0x1
+	.byte	0x61
+	.byte	0
+.LVUS632:
+	.uleb128 .LVU1390
+	.uleb128 .LVU1393
+.LLST632:
+	.byte	0x4
+	.uleb128 .LVL217-.Ltext0
+	.uleb128 .LVL218-.Ltext0
+	.uleb128 0x1
+	.byte	0x61
+	.byte	0
+.LVUS633:
+	.uleb128 .LVU1390
+	.uleb128 .LVU1393
+.LLST633:
+	.byte	0x4
+	.uleb128 .LVL217-.Ltext0
+	.uleb128 .LVL218-.Ltext0
+	.uleb128 0x1
+	.byte	0x63
+	.byte	0
+.LVUS635:
+	.uleb128 .LVU1395
+	.uleb128 .LVU1397
+.LLST635:
+	.byte	0x4
+	.uleb128 .LVL218-.Ltext0
+	.uleb128 .LVL218-.Ltext0
+	.uleb128 0x1
+	.byte	0x63
+	.byte	0
+.LVUS636:
+	.uleb128 .LVU1395
+	.uleb128 .LVU1397
+.LLST636:
+	.byte	0x4
+	.uleb128 .LVL218-.Ltext0
+	.uleb128 .LVL218-.Ltext0
+	.uleb128 0x1
+	.byte	0x62
+	.byte	0
+.LVUS638:
+	.uleb128 .LVU1397
+	.uleb128 .LVU1403
+.LLST638:
+	.byte	0x4
+	.uleb128 .LVL218-.Ltext0
+	.uleb128 .LVL220-.Ltext0
+	.uleb128 0x2
+	.byte	0x3c
+	.byte	0x9f
+	.byte	0
+.LVUS639:
+	.uleb128 .LVU1401
+	.uleb128 .LVU1403
+.LLST639:
+	.byte	0x4
+	.uleb128 .LVL219-.Ltext0
+	.uleb128 .LVL220-.Ltext0
+	.uleb128 0x1
+	.byte	0x62
+	.byte	0
+.LVUS640:
+	.uleb128 .LVU1405
+	.uleb128 .LVU1407
+.LLST640:
+	.byte	0x4
+	.uleb128 .LVL220-.Ltext0
+	.uleb128 .LVL220-.Ltext0
+	.uleb128 0x1
+	.byte	0x62
+	.byte	0
+.LVUS641:
+	.uleb128 .LVU1405
+	.uleb128 .LVU1407
+.LLST641:
+	.byte	0x4
+	.uleb128 .LVL220-.Ltext0
+	.uleb128 .LVL220-.Ltext0
+	.uleb128 0x1
+	.byte	0x66
+	.byte	0
+.LVUS642:
+	.uleb128 .LVU1407
+	.uleb128 .LVU1411
+.LLST642:
+	.byte	0x4
+	.uleb128 .LVL220-.Ltext0
+	.uleb128 .LVL221-.Ltext0
+	.uleb128 0x1
+	.byte	0x69
+	.byte	0
+.LVUS644:
+	.uleb128 .LVU1414
+	.uleb128 .LVU1416
+.LLST644:
+	.byte	0x4
+	.uleb128 .LVL222-.Ltext0
+	.uleb128 .LVL222-.Ltext0
+	.uleb128 0x1
+	.byte	0x69
+	.byte	0
+.LVUS645:
+	.uleb128 .LVU1414
+	.uleb128 .LVU1416
+.LLST645:
+	.byte	0x4
+	.uleb128 .LVL222-.Ltext0
+	.uleb128 .LVL222-.Ltext0
+	.uleb128 0x1
+	.byte	0x61
+	.byte	0
+.LVUS647:
+	.uleb128 .LVU1416
+	.uleb128 .LVU1423
+.LLST647:
+	.byte	0x4
+	.uleb128 .LVL222-.Ltext0
+	.uleb128 .LVL224-.Ltext0
+	.uleb128 0x2
+	.byte	0x38
+	.byte	0x9f
+	.byte	0
+.LVUS648:
+	.uleb128 .LVU1421
+	.uleb128 .LVU1423
+.LLST648:
+	.byte	0x4
+	.uleb128 .LVL223-.Ltext0
+	.uleb128 .LVL224-.Ltext0
+	.uleb128 0x1
+	.byte	0x61
+	.byte	0
+.LVUS650:
+	.uleb128 .LVU1425
+	.uleb128 .LVU1431
+.LLST650:
+	.byte	0x4
+	.uleb128 .LVL224-.Ltext0
+	.uleb128 .LVL225-.Ltext0
+	.uleb128 0x1
+	.byte	0x61
+	.byte	0
+.LVUS651:
+	.uleb128 .LVU1425
+	.uleb128 .LVU1431
+.LLST651:
+	.byte	0x4
+	.uleb128 .LVL224-.Ltext0
+	.uleb128 .LVL225-.Ltext0
+	.uleb128 0x1
+	.byte	0x63
+	.byte	0
+.LVUS653:
+	.uleb128 .LVU1433
+	.uleb128 .LVU1435
+.LLST653:
+	.byte	0x4
+	.uleb128 .LVL225-.Ltext0
+	.uleb128 .LVL225-.Ltext0
+	.uleb128 0x1
+	.byte	0x63
+	.byte	0
+.LVUS654:
+	.uleb128 .LVU1433
+	.uleb128 .LVU1435
+.LLST654:
+	.byte	0x4
+	.uleb128 .LVL225-.Ltext0
+	.uleb128 .LVL225-.Ltext0
+	.uleb128 0x1
+	.byte	0x62
+	.byte	0
+.LVUS656:
+	.uleb128 .LVU1435
+	.uleb128 .LVU1445
+.LLST656:
+	.byte	0x4
+	.uleb128 .LVL225-.Ltext0
+	.uleb128 .LVL229-.Ltext0
+	.uleb128 0x2
+	.byte	0x37
+	.byte	0x9f
+	.byte	0
+.LVUS657:
+	.uleb128 .LVU1441
+	.uleb128 .LVU1445
+.LLST657:
+	.byte	0x4
+	.uleb128 .LVL227-.Ltext0
+	.uleb128 .LVL229-.Ltext0
+	.uleb128 0x1
+	.byte	0x62
+	.byte	0
+.LVUS659:
+	.uleb128 .LVU1457
+	.uleb128 .LVU1459
+.LLST659:
+	.byte	0x4
+	.uleb128 .LVL230-.Ltext0
+	.uleb128 .LVL230-.Ltext0
+	.uleb128 0x3
+	.byte	0x8
+	.byte	0x39
+	.byte	0x9f
+	.byte	0
+.LVUS661:
+	.uleb128 .LVU1453
+	.uleb128 .LVU1455
+.LLST661:
+	.byte	0x4
+	.uleb128 .LVL230-.Ltext0
+	.uleb128 .LVL230-.Ltext0
+	.uleb128 0x3
+	.byte	0x8
+	.byte	0x4e
+	.byte	0x9f
+	.byte	0
+.LVUS662:
+	.uleb128 .LVU1448
+	.uleb128 .LVU1451
+.LLST662:
+	.byte	0x4
+	.uleb128 .LVL229-.Ltext0
+	.uleb128 .LVL230-.Ltext0
+	.uleb128 0x3
+	.byte	0x8
+	.byte	0x93
+	.byte	0x9f
+	.byte	0
+.LVUS663:
+	.uleb128 .LVU1448
+	.uleb128 .LVU1451
+.LLST663:
+	.byte	0x4
+	.uleb128 .LVL229-.Ltext0
+	.uleb128 .LVL230-.Ltext0
+	.uleb128 0x1
+	.byte	0x62
+	.byte	0
+.LVUS666:
+	.uleb128 .LVU1468
+	.uleb128 .LVU1470
+.LLST666:
+	.byte	0x4
+	.uleb128 .LVL230-.Ltext0
+	.uleb128 .LVL230-.Ltext0
+	.uleb128 0x1
+	.byte	0x65
+	.byte	0
+.LVUS667:
+	.uleb128 .LVU1468
+	.uleb128 .LVU1470
+.LLST667:
+	.byte	0x4
+	.uleb128 .LVL230-.Ltext0
+	.uleb128 .LVL230-.Ltext0
+	.uleb128 0x1
+	.byte	0x64
+	.byte	0
+.LVUS670:
+	.uleb128 .LVU1484
+	.uleb128 .LVU1486
+.LLST670:
+	.byte	0x4
+	.uleb128 .LVL230-.Ltext0
+	.uleb128 .LVL230-.Ltext0
+	.uleb128 0x2
+	.byte	0x31
+	.byte	0x9f
+	.byte	0
+.LVUS672:
+	.uleb128 .LVU1464
+	.uleb128 .LVU1466
+.LLST672:
+	.byte	0x4
+	.uleb128 .LVL230-.Ltext0
+	.uleb128 .LVL230-.Ltext0
+	.uleb128 0x1
+	.byte	0x65
+	.byte	0
+.LVUS673:
+	.uleb128 .LVU1464
+	.uleb128 .LVU1466
+.LLST673:
+	.byte	0x4
+	.uleb128 .LVL230-.Ltext0
+	.uleb128 .LVL230-.Ltext0
+	.uleb128 0x1
+	.byte	0x64
+	.byte	0
+.LVUS676:
+	.uleb128 .LVU1476
+	.uleb128 .LVU1478
+.LLST676:
+	.byte	0x4
+	.uleb128 .LVL230-.Ltext0
+	.uleb128 .LVL230-.Ltext0
+	.uleb128 0x2
+	.byte	0x31
+	.byte	0x9f
+	.byte	0
+.LVUS677:
+	.uleb128 .LVU1489
+	.uleb128 .LVU1491
+.LLST677:
+	.byte	0x4
+	.uleb128 .LVL230-.Ltext0
+	.uleb128 .LVL230-.Ltext0
+	.uleb128 0x1
+	.byte	0x62
+	.byte	0
+.LVUS678:
+	.uleb128 .LVU1489
+	.uleb128 .LVU1491
+.LLST678:
+	.byte	0x4
+	.uleb128 .LVL230-.Ltext0
+	.uleb128 .LVL230-.Ltext0
+	.uleb128 0x1
+	.byte	0x69
+	.byte	0
+.LVUS680:
+	.uleb128 .LVU1497
+	.uleb128 .LVU1499
+.LLST680:
+	.byte	0x4
+	.uleb128 .LVL231-.Ltext0
+	.uleb128 .LVL231-.Ltext0
+	.uleb128 0x1
+	.byte	0x68
+	.byte	0
+.LVUS681:
+	.uleb128 .LVU1497
+	.uleb128 .LVU1499
+.LLST681:
+	.byte	0x4
+	.uleb128 .LVL231-.Ltext0
+	.uleb128 .LVL231-.Ltext0
+	.uleb128 0x1
+	.byte	0x61
+	.byte	0
+.LVUS683:
+	.uleb128 .LVU1499
+	.uleb128 .LVU1505
+.LLST683:
+	.byte	0x4
+	.uleb128 .LVL231-.Ltext0
+	.uleb128 .LVL233-.Ltext0
+	.uleb128 0x2
+	.byte	0x40
+	.byte	0x9f
+	.byte	0
+.LVUS684:
+	.uleb128 .LVU1503
+	.uleb128 .LVU1505
+.LLST684:
+	.byte	0x4
+	.uleb128 .LVL232-.Ltext0
+	.uleb128 .LVL233-.Ltext0
+	.uleb128 0x1
+	.byte	0x61
+	.byte	0
+.LVUS685:
+	.uleb128 .LVU1507
+	.uleb128 .LVU1510
+.LLST685:
+	.byte	0x4
+	.uleb128 .LVL233-.Ltext0
+	.uleb128 .LVL234-.Ltext0
+	.uleb128 0x1
+	.byte	0x61
+	.byte	0
+.LVUS686:
+	.uleb128 .LVU1507
+	.uleb128 .LVU1510
+.LLST686:
+	.byte	0x4
+	.uleb128 .LVL233-.Ltext0
+	.uleb128 .LVL234-.Ltext0
+	.uleb128 0x1
+	.byte	0x63
+	.byte	0
+.LVUS688:
+	.uleb128 .LVU1512
+	.uleb128 .LVU1514
+.LLST688:
+	.byte	0x4
+	.uleb128 .LVL234-.Ltext0
+	.uleb128 .LVL234-.Ltext0
+	.uleb128 0x1
+	.byte	0x63
+	.byte	0
+.LVUS689:
+	.uleb128 .LVU1512
+	.uleb128 .LVU1514
+.LLST689:
+	.byte	0x4
+	.uleb128 .LVL234-.Ltext0
+	.uleb128 .LVL234-.Ltext0
+	.uleb128 0x1
+	.byte	0x62
+	.byte	0
+.LVUS691:
+	.uleb128 .LVU1514
+	.uleb128 .LVU1520
+.LLST691:
+	.byte	0x4
+	.uleb128 .LVL234-.Ltext0
+	.uleb128 .LVL236-.Ltext0
+	.uleb128 0x2
+	.byte	0x3c
+	.byte	0x9f
+	.byte	0
+.LVUS692:
+	.uleb128 .LVU1518
+	.uleb128 .LVU1520
+.LLST692:
+	.byte	0x4
+	.uleb128 .LVL235-.Ltext0
+	.uleb128 .LVL236-.Ltext0
+	.uleb128 0x1
+	.byte	0x62
+	.byte	0
+.LVUS693:
+	.uleb128 .LVU1522
+	.uleb128 .LVU1524
+.LLST693:
+	.byte	0x4
+	.uleb128 .LVL236-.Ltext0
+	.uleb128 .LVL236-.Ltext0
+	.uleb128 0x1
+	.byte	0x62
+	.byte	0
+.LVUS694:
+	.uleb128 .LVU1522
+	.uleb128 .LVU1524
+.LLST694:
+	.byte	0x4
+	.uleb128 .LVL236-.Ltext0
+	.uleb128 .LVL236-.Ltext0
+	.uleb128 0x1
+	.byte	0x68
+	.byte	0
+.LVUS695:
+	.uleb128 .LVU1524
+	.uleb128 .LVU1528
+.LLST695:
+	.byte	0x4
+	.uleb128 .LVL236-.Ltext0
+	.uleb128 .LVL237-.Ltext0
+	.uleb128 0x1
+	.byte	0x66
+	.byte	0
+.LVUS697:
+	.uleb128 .LVU1531
+	.uleb128 .LVU1533
+.LLST697:
+	.byte	0x4
+	.uleb128 .LVL238-.Ltext0
+	.uleb128 .LVL238-.Ltext0
+	.uleb128 0x1
+	.byte	0x66
+	.byte	0
+.LVUS698:
+	.uleb128 .LVU1531
+	.uleb128 .LVU1533
+.LLST698:
+	.byte	0x4
+	.uleb128 .LVL238-.Ltext0
+	.uleb128 .LVL238-.Ltext0
+	.uleb128 0x1
+	.byte	0x61
+	.byte	0
+.LVUS700:
+	.uleb128 .LVU1533
+	.uleb128 .LVU1540
+.LLST700:
+	.byte	0x4
+	.uleb128 .LVL238-.Ltext0
+	.uleb128 .LVL240-.Ltext0
+	.uleb128 0x2
+	.byte	0x38
+	.byte	0x9f
+	.byte	0
+.LVUS701:
+	.uleb128 .LVU1538
+	.uleb128 .LVU1540
+.LLST701:
+	.byte	0x4
+	.uleb128 .LVL239-.Ltext0
+	.uleb128 .LVL240-.Ltext0
+	.uleb128 0x1
+	.byte	0x61
+	.byte	0
+.LVUS703:
+	.uleb128 .LVU1542
+	.uleb128 .LVU1546
+.LLST703:
+	.byte	0x4
+	.uleb128 .LVL240-.Ltext0
+	.uleb128 .LVL241-.Ltext0
+	.uleb128 0x1
+	.byte	0x61
+	.byte	0
+.LVUS704:
+	.uleb128 .LVU1542
+	.uleb128 .LVU1546
+.LLST704:
+	.byte	0x4
+	.uleb128 .LVL240-.Ltext0
+	.uleb128 .LVL241-.Ltext0
+	.uleb128 0x1
+	.byte	0x63
+	.byte	0
+.LVUS706:
+	.uleb128 .LVU1548
+	.uleb128 .LVU1550
+.LLST706:
+	.byte	0x4
+	.uleb128 .LVL241-.Ltext0
+	.uleb128 .LVL241-.Ltext0
+	.uleb128 0x1
+	.byte	0x63
+	.byte	0
+.LVUS707:
+	.uleb128 .LVU1548
+	.uleb128 .LVU1550
+.LLST707:
+	.byte	0x4
+	.uleb128 .LVL241-.Ltext0
+	.uleb128 .LVL241-.Ltext0
+	.uleb128 0x1
+	.byte	0x62
+	.byte	0
+.LVUS709:
+	.uleb128 .LVU1550
+	.uleb128 .LVU1560
+.LLST709:
+	.byte	0x4
+	.uleb128 .LVL241-.Ltext0
+	.uleb128 .LVL245-.Ltext0
+	.uleb128 0x2
+	.byte	0x37
+	.byte	0x9f
+	.byte	0
+.LVUS710:
+	.uleb128 .LVU1556
+	.uleb128 .LVU1560
+.LLST710:
+	.byte	0x4
+	.uleb128 .LVL243-.Ltext0
+	.uleb128 .LVL245-.Ltext0
+	.uleb128 0x1
+	.byte	0x62
+	.byte	0
+.LVUS712:
+	.uleb128 .LVU1572
+	.uleb128 .LVU1574
+.LLST712:
+	.byte	0x4
+	.uleb128 .LVL246-.Ltext0
+	.uleb128 .LVL246-.Ltext0
+	.uleb128 0x3
+	.byte	0x8
+	.byte	0x93
+	.byte	0x9f
+	.byte	0
+.LVUS714:
+	.uleb128 .LVU1568
+	.uleb128 .LVU1570
+.LLST714:
+	.byte	0x4
+	.uleb128 .LVL246-.Ltext0
+	.uleb128 .LVL246-.Ltext0
+	.uleb128 0x3
+	.byte	0x8
+	.byte	0x4e
+	.byte	0x9f
+	.byte	0
+.LVUS715:
+	.uleb128 .LVU1563
+	.uleb128 .LVU1566
+.LLST715:
+	.byte	0x4
+	.uleb128 .LVL245-.Ltext0
+	.uleb128 .LVL246-.Ltext0
+	.uleb128 0x3
+	.byte	0x8
+	.byte	0x39
+	.byte	0x9f
+	.byte	0
+.LVUS716:
+	.uleb128 .LVU1563
+	.uleb128 .LVU1566
+.LLST716:
+	.byte	0x4
+	.uleb128 .LVL245-.Ltext0
+	.uleb128 .LVL246-.Ltext0
+	.uleb128 0x1
+	.byte	0x62
+	.byte	0
+.LVUS717:
+	.uleb128 .LVU1577
+	.uleb128 .LVU1579
+.LLST717:
+	.byte	0x4
+	.uleb128 .LVL246-.Ltext0
+	.uleb128 .LVL246-.Ltext0
+	.uleb128 0x1
+	.byte	0x62
+	.byte	0
+.LVUS718:
+	.uleb128 .LVU1577
+	.uleb128 .LVU1579
+.LLST718:
+	.byte	0x4
+	.uleb128 .LVL246-.Ltext0
+	.uleb128 .LVL246-.Ltext0
+	.uleb128 0x1
+	.byte	0x66
+	.byte	0
+.LVUS720:
+	.uleb128 .LVU1585
+	.uleb128 .LVU1587
+.LLST720:
+	.byte	0x4
+	.uleb128 .LVL247-.Ltext0
+	.uleb128 .LVL247-.Ltext0
+	.uleb128 0x1
+	.byte	0x66
+	.byte	0
+.LVUS721:
+	.uleb128 .LVU1585
+	.uleb128 .LVU1587
+.LLST721:
+	.byte	0x4
+	.uleb128 .LVL247-.Ltext0
+	.uleb128 .LVL247-.Ltext0
+	.uleb128 0x1
+	.byte	0x61
+	.byte	0
+.LVUS723:
+	.uleb128 .LVU1587
+	.uleb128 .LVU1595
+.LLST723:
+	.byte	0x4
+	.uleb128 .LVL247-.Ltext0
+	.uleb128 .LVL249-.Ltext0
+	.uleb128 0x2
+	.byte	0x40
+	.byte	0x9f
+	.byte	0
+.LVUS724:
+	.uleb128 .LVU1593
+	.uleb128 .LVU1595
+.LLST724:
+	.byte	0x4
+	.uleb128 .LVL248-.Ltext0
+	.uleb128 .LVL249-.Ltext0
+	.uleb128 0x1
+	.byte	0x61
+	.byte	0
+.LVUS725:
+	.uleb128 .LVU1597
+	.uleb128 .LVU1600
+.LLST725:
+	.byte	0x4
+	.uleb128 .LVL249-.Ltext0
+	.uleb128 .LVL250-.Ltext0
+	.uleb128 0x1
+	.byte	0x61
+	.byte	0
+.LVUS726:
+	.uleb128 .LVU1597
+	.uleb128 .LVU1600
+.LLST726:
+	.byte	0x4
+	.uleb128 .LVL249-.Ltext0
+	.uleb128 .LVL250-.Ltext0
+	.uleb128 0x1
+	.byte	0x63
+	.byte	0
+.LVUS728:
+	.uleb128 .LVU1602
+	.uleb128 .LVU1604
+.LLST728:
+	.byte	0x4
+	.uleb128 .LVL250-.Ltext0
+	.uleb128 .LVL250-.Ltext0
+	.uleb128 0x1
+	.byte	0x63
+	.byte	0
+.LVUS729:
+	.uleb128 .LVU1602
+	.uleb128 .LVU1604
+.LLST729:
+	.byte	0x4
+	.uleb128 .LVL250-.Ltext0
+	.uleb128 .LVL250-.Ltext0
+	.uleb128 0x1
+	.byte	0x62
+	.byte	0
+.LVUS731:
+	.uleb128 .LVU1604
+	.uleb128 .LVU1610
+.LLST731:
+	.byte	0x4
+	.uleb128 .LVL250-.Ltext0
+	.uleb128 .LVL252-.Ltext0
+	.uleb128 0x2
+	.byte	0x3c
+	.byte	0x9f
+	.byte	0
+.LVUS732:
+	.uleb128 .LVU1608
+	.uleb128 .LVU1610
+.LLST732:
+	.byte	0x4
+	.uleb128 .LVL251-.Ltext0
+	.uleb128 .LVL252-.Ltext0
+	.uleb128 0x1
+	.byte	0x62
+	.byte	0
+.LVUS733:
+	.uleb128 .LVU1612
+	.uleb128 .LVU1614
+.LLST733:
+	.byte	0x4
+	.uleb128 .LVL252-.Ltext0
+	.uleb128 .LVL252-.Ltext0
+	.uleb128 0x1
+	.byte	0x62
+	.byte	0
+.LVUS734:
+	.uleb128 .LVU1612
+	.uleb128 .LVU1614
+.LLST734:
+	.byte	0x4
+	.uleb128 .LVL252-.Ltext0
+	.uleb128 .LVL252-.Ltext0
+	.uleb128 0x1
+	.byte	0x66
+	.byte	0
+.LVUS735:
+	.uleb128 .LVU1614
+	.uleb128 .LVU1618
+.LLST735:
+	.byte	0x4
+	.uleb128 .LVL252-.Ltext0
+	.uleb128 .LVL253-.Ltext0
+	.uleb128 0x1
+	.byte	0x6a
+	.byte	0
+.LVUS737:
+	.uleb128 .LVU1621
+	.uleb128 .LVU1623
+.LLST737:
+	.byte	0x4
+	.uleb128 .LVL254-.Ltext0
+	.uleb128 .LVL254-.Ltext0
+	.uleb128 0x1
+	.byte	0x6a
+	.byte	0
+.LVUS738:
+	.uleb128 .LVU1621
+	.uleb128 .LVU1623
+.LLST738:
+	.byte	0x4
+	.uleb128 .LVL254-.Ltext0
+	.uleb128 .LVL254-.Ltext0
+	.uleb128 0x1
+	.byte	0x61
+	.byte	0
+.LVUS740:
+	.uleb128 .LVU1623
+	.uleb128 .LVU1630
+.LLST740:
+	.byte	0x4
+	.uleb128 .LVL254-.Ltext0
+	.uleb128 .LVL256-.Ltext0
+	.uleb128 0x2
+	.byte	0x38
+	.byte	0x9f
+	.byte	0
+.LVUS741:
+	.uleb128 .LVU1628
+	.uleb128 .LVU1630
+.LLST741:
+	.byte	0x4
+	.uleb128 .LVL255-.Ltext0
+	.uleb128 .LVL256-.Ltext0
+	.uleb128 0x1
+	.byte	0x61
+	.byte	0
+.LVUS743:
+	.uleb128 .LVU1632
+	.uleb128 .LVU1638
+.LLST743:
+	.byte	0x4
+	.uleb128 .LVL256-.Ltext0
+	.uleb128 .LVL257-.Ltext0
+	.uleb128 0x1
+	.byte	0x61
+	.byte	0
+.LVUS744:
+	.uleb128 .LVU1632
+	.uleb128 .LVU1638
+.LLST744:
+	.byte	0x4
+	.uleb128 .LVL256-.Ltext0
+	.uleb128 .LVL257-.Ltext0
+	.uleb128 0x1
+	.byte	0x63
+	.byte	0
+.LVUS746:
+	.uleb128 .LVU1640
+	.uleb128 .LVU1642
+.LLST746:
+	.byte	0x4
+	.uleb128 .LVL257-.Ltext0
+	.uleb128 .LVL257-.Ltext0
+	.uleb128 0x1
+	.byte	0x63
+	.byte	0
+.LVUS747:
+	.uleb128 .LVU1640
+	.uleb128 .LVU1642
+.LLST747:
+	.byte	0x4
+	.uleb128 .LVL257-.Ltext0
+	.uleb128 .LVL257-.Ltext0
+	.uleb128 0x1
+	.byte	0x62
+	.byte	0
+.LVUS749:
+	.uleb128 .LVU1642
+	.uleb128 .LVU1652
+.LLST749:
+	.byte	0x4
+	.uleb128 .LVL257-.Ltext0
+	.uleb128 .LVL261-.Ltext0
+	.uleb128 0x2
+	.byte	0x37
+	.byte	0x9f
+	.byte	0
+.LVUS750:
+	.uleb128 .LVU1648
+	.uleb128 .LVU1652
+.LLST750:
+	.byte	0x4
+	.uleb128 .LVL259-.Ltext0
+	.uleb128 .LVL261-.Ltext0
+	.uleb128 0x1
+	.byte	0x62
+	.byte	0
+.LVUS752:
+	.uleb128 .LVU1664
+	.uleb128 .LVU1666
+.LLST752:
+	.byte	0x4
+	.uleb128 .LVL262-.Ltext0
+	.uleb128 .LVL262-.Ltext0
+	.uleb128 0x3
+	.byte	0x8
+	.byte	0x39
+	.byte	0x9f
+	.byte	0
+.LVUS754:
+	.uleb128 .LVU1660
+	.uleb128 .LVU1662
+.LLST754:
+	.byte	0x4
+	.uleb128 .LVL262-.Ltext0
+	.uleb128 .LVL262-.Ltext0
+	.uleb128 0x3
+	.byte	0x8
+	.byte	0x4e
+	.byte	0x9f
+	.byte	0
+.LVUS755:
+	.uleb128 .LVU1655
+	.uleb128 .LVU1658
+.LLST755:
+	.byte	0x4
+	.uleb128 .LVL261-.Ltext0
+	.uleb128 .LVL262-.Ltext0
+	.uleb128 0x3
+	.byte	0x8
+	.byte	0x93
+	.byte	0x9f
+	.byte	0
+.LVUS756:
+	.uleb128 .LVU1655
+	.uleb128 .LVU1658
+.LLST756:
+	.byte	0x4
+	.uleb128 .LVL261-.Ltext0
+	.uleb128 .LVL262-.Ltext0
+	.uleb128 0x1
+	.byte	0x62
+	.byte	0
+.LVUS759:
+	.uleb128 .LVU1675
+	.uleb128 .LVU1677
+.LLST759:
+	.byte	0x4
+	.uleb128 .LVL262-.Ltext0
+	.uleb128 .LVL262-.Ltext0
+	.uleb128 0x1
+	.byte	0x65
+	.byte	0
+.LVUS760:
+	.uleb128 .LVU1675
+	.uleb128 .LVU1677
+.LLST760:
+	.byte	0x4
+	.uleb128 .LVL262-.Ltext0
+	.uleb128 .LVL262-.Ltext0
+	.uleb128 0x1
+	.byte	0x64
+	.byte	0
+.LVUS763:
+	.uleb128 .LVU1691
+	.uleb128 .LVU1693
+.LLST763:
+	.byte	0x4
+	.uleb128 .LVL262-.Ltext0
+	.uleb128 .LVL262-.Ltext0
+	.uleb128 0x2
+	.byte	0x31
+	.byte	0x9f
+	.byte	0
+.LVUS765:
+	.uleb128 .LVU1671
+	.uleb128 .LVU1673
+.LLST765:
+	.byte	0x4
+	.uleb128 .LVL262-.Ltext0
+	.uleb128 .LVL262-.Ltext0
+	.uleb128 0x1
+	.byte	0x65
+	.byte	0
+.LVUS766:
+	.uleb128 .LVU1671
+	.uleb128 .LVU1673
+.LLST766:
+	.byte	0x4
+	.uleb128 .LVL262-.Ltext0
+	.uleb128 .LVL262-.Ltext0
+	.uleb128 0x1
+	.byte	0x64
+	.byte	0
+.LVUS769:
+	.uleb128 .LVU1683
+	.uleb128 .LVU1685
+.LLST769:
+	.byte	0x4
+	.uleb128 .LVL262-.Ltext0
+	.uleb128 .LVL262-.Ltext0
+	.uleb128 0x2
+	.byte	0x31
+	.byte	0x9f
+	.byte	0
+.LVUS770:
+	.uleb128 .LVU1696
+	.uleb128 .LVU1698
+.LLST770:
+	.byte	0x4
+	.uleb128 .LVL262-.Ltext0
+	.uleb128 .LVL262-.Ltext0
+	.uleb128 0x1
+	.byte	0x62
+	.byte	0
+.LVUS771:
+	.uleb128 .LVU1696
+	.uleb128 .LVU1698
+.LLST771:
+	.byte	0x4
+	.uleb128 .LVL262-.Ltext0
+	.uleb128 .LVL262-.Ltext0
+	.uleb128 0x1
+	.byte	0x6a
+	.byte	0
+.LVUS773:
+	.uleb128 .LVU1704
+	.uleb128 .LVU1706
+.LLST773:
+	.byte	0x4
+	.uleb128 .LVL263-.Ltext0
+	.uleb128 .LVL263-.Ltext0
+	.uleb128 0x1
+	.byte	0x69
+	.byte	0
+.LVUS774:
+	.uleb128 .LVU1704
+	.uleb128 .LVU1706
+.LLST774:
+	.byte	0x4
+	.uleb128 .LVL263-.Ltext0
+	.uleb128 .LVL263-.Ltext0
+	.uleb128 0x1
+	.byte	0x61
+	.byte	0
+.LVUS776:
+	.uleb128 .LVU1706
+	.uleb128 .LVU1712
+.LLST776:
+	.byte	0x4
+	.uleb128 .LVL263-.Ltext0
+	.uleb128 .LVL265-.Ltext0
+	.uleb128 0x2
+	.byte	0x40
+	.byte	0x9f
+	.byte	0
+.LVUS777:
+	.uleb128 .LVU1710
+	.uleb128 .LVU1712
+.LLST777:
+	.byte	0x4
+	.uleb128 .LVL264-.Ltext0
+	.uleb128 .LVL265-.Ltext0
+	.uleb128 0x1
+	.byte	0x61
+	.byte	0
+.LVUS778:
+	.uleb128 .LVU1714
+	.uleb128 .LVU1717
+.LLST778:
+	.byte	0x4
+	.uleb128 .LVL265-.Ltext0
+	.uleb128 .LVL266-.Ltext0
+	.uleb128 0x1
+	.byte	0x61
+	.byte	0
+.LVUS779:
+	.uleb128 .LVU1714
+	.uleb128 .LVU1717
+.LLST779:
+	.byte	0x4
+	.uleb128 .LVL265-.Ltext0
+	.uleb128 .LVL266-.Ltext0
+	.uleb128 0x1
+	.byte	0x63
+	.byte	0
+.LVUS781:
+	.uleb128 .LVU1719
+	.uleb128 .LVU1721
+.LLST781:
+	.byte	0x4
+	.uleb128 .LVL266-.Ltext0
+	.uleb128 .LVL266-.Ltext0
+	.uleb128 0x1
+	.byte	0x63
+	.byte	0
+.LVUS782:
+	.uleb128 .LVU1719
+	.uleb128 .LVU1721
+.LLST782:
+	.byte	0x4
+	.uleb128 .LVL266-.Ltext0
+	.uleb128 .LVL266-.Ltext0
+	.uleb128 0x1
+	.byte	0x62
+	.byte	0
+.LVUS784:
+	.uleb128 .LVU1721
+	.uleb128 .LVU1727
+.LLST784:
+	.byte	0x4
+	.uleb128 .LVL266-.Ltext0
+	.uleb128 .LVL268-.Ltext0
+	.uleb128 0x2
+	.byte	0x3c
+	.byte	0x9f
+	.byte	0
+.LVUS785:
+	.uleb128 .LVU1725
+	.uleb128 .LVU1727
+.LLST785:
+	.byte	0x4
+	.uleb128 .LVL267-.Ltext0
+	.uleb128 .LVL268-.Ltext0
+	.uleb128 0x1
+	.byte	0x62
+	.byte	0
+.LVUS786:
+	.uleb128 .LVU1729
+	.uleb128 .LVU1731
+.LLST786:
+	.byte	0x4
+	.uleb128 .LVL268-.Ltext0
+	.uleb128 .LVL268-.Ltext0
+	.uleb128 0x1
+	.byte	0x62
+	.byte	0
+.LVUS787:
+	.uleb128 .LVU1729
+	.uleb128 .LVU1731
+.LLST787:
+	.byte	0x4
+	.uleb128 .LVL268-.Ltext0
+	.uleb128 .LVL268-.Ltext0
+	.uleb128 0x1
+	.byte	0x69
+	.byte	0
+.LVUS788:
+	.uleb128 .LVU1731
+	.uleb128 .LVU1735
+.LLST788:
+	.byte	0x4
+	.uleb128 .LVL268-.Ltext0
+	.uleb128 .LVL269-.Ltext0
+	.uleb128 0x1
+	.byte	0x66
+	.byte	0
+.LVUS790:
+	.uleb128 .LVU1738
+	.uleb128 .LVU1740
+.LLST790:
+	.byte	0x4
+	.uleb128 .LVL270-.Ltext0
+	.uleb128 .LVL270-.Ltext0
+	.uleb128 0x1
+	.byte	0x66
+	.byte	0
+.LVUS791:
+	.uleb128 .LVU1738
+	.uleb128 .LVU1740
+.LLST791:
+	.byte	0x4
+	.uleb128 .LVL270-.Ltext0
+	.uleb128 .LVL270-.Ltext0
+	.uleb128 0x1
+	.byte	0x61
+	.byte	0
+.LVUS793:
+	.uleb128 .LVU1740
+	.uleb128 .LVU1747
+.LLST793:
+	.byte	0x4
+	.uleb128 .LVL270-.Ltext0
+	.uleb128 .LVL272-.Ltext0
+	.uleb128 0x2
+	.byte	0x38
+	.byte	0x9f
+	.byte	0
+.LVUS794:
+	.uleb128 .LVU1745
+	.uleb128 .LVU1747
+.LLST794:
+	.byte	0x4
+	.uleb128 .LVL271-.Ltext0
+	.uleb128 .LVL272-.Ltext0
+	.uleb128 0x1
+	.byte	0x61
+	.byte	0
+.LVUS796:
+	.uleb128 .LVU1749
+	.uleb128 .LVU1753
+.LLST796:
+	.byte	0x4
+	.uleb128 .LVL272-.Ltext0
+	.uleb128 .LVL273-.Ltext0
+	.uleb128 0x1
+	.byte	0x61
+	.byte	0
+.LVUS797:
+	.uleb128 .LVU1749
+	.uleb128 .LVU1753
+.LLST797:
+	.byte	0x4
+	.uleb128 .LVL272-.Ltext0
+	.uleb128 .LVL273-.Ltext0
+	.uleb128 0x1
+	.byte	0x63
+	.byte	0
+.LVUS799:
+	.uleb128 .LVU1755
+	.uleb128 .LVU1757
+.LLST799:
+	.byte	0x4
+	.uleb128 .LVL273-.Ltext0
+	.uleb128 .LVL273-.Ltext0
+	.uleb128 0x1
+	.byte	0x63
+	.byte	0
+.LVUS800:
+	.uleb128 .LVU1755
+	.uleb128 .LVU1757
+.LLST800:
+	.byte	0x4
+	.uleb128 .LVL273-.Ltext0
+	.uleb128 .LVL273-.Ltext0
+	.uleb128 0x1
+	.byte	0x62
+	.byte	0
+.LVUS802:
+	.uleb128 .LVU1757
+	.uleb128 .LVU1767
+.LLST802:
+	.byte	0x4
+	.uleb128 .LVL273-.Ltext0
+	.uleb128 .LVL277-.Ltext0
+	.uleb128 0x2
+	.byte	0x37
+	.byte	0x9f
+	.byte	0
+.LVUS803:
+	.uleb128 .LVU1763
+	.uleb128 .LVU1767
+.LLST803:
+	.byte	0x4
+	.uleb128 .LVL275-.Ltext0
+	.uleb128 .LVL277-.Ltext0
+	.uleb128 0x1
+	.byte	0x62
+	.byte	0
+.LVUS805:
+	.uleb128 .LVU1779
+	.uleb128 .LVU1781
+.LLST805:
+	.byte	0x4
+	.uleb128 .LVL278-.Ltext0
+	.uleb128 .LVL278-.Ltext0
+	.uleb128 0x3
+	.byte	0x8
+	.byte	0x93
+	.byte	0x9f
+	.byte	0
+.LVUS807:
+	.uleb128 .LVU1775
+	.uleb128 .LVU1777
+.LLST807:
+	.byte	0x4
+	.uleb128 .LVL278-.Ltext0
+	.uleb128 .LVL278-.Ltext0
+	.uleb128 0x3
+	.byte	0x8
+	.byte	0x4e
+	.byte	0x9f
+	.byte	0
+.LVUS808:
+	.uleb128 .LVU1770
+	.uleb128 .LVU1773
+.LLST808:
+	.byte	0x4
+	.uleb128 .LVL277-.Ltext0
+	.uleb128 .LVL278-.Ltext0
+	.uleb128 0x3
+	.byte	0x8
+	.byte	0x39
+	.byte	0x9f
+	.byte	0
+.LVUS809:
+	.uleb128 .LVU1770
+	.uleb128 .LVU1773
+.LLST809:
+	.byte	0x4
+	.uleb128 .LVL277-.Ltext0
+	.uleb128 .LVL278-.Ltext0
+	.uleb128 0x1
+	.byte	0x62
+	.byte	0
+.LVUS810:
+	.uleb128 .LVU1784
+	.uleb128 .LVU1786
+.LLST810:
+	.byte	0x4
+	.uleb128 .LVL278-.Ltext0
+	.uleb128 .LVL278-.Ltext0
+	.uleb128 0x1
+	.byte	0x62
+	.byte	0
+.LVUS811:
+	.uleb128 .LVU1784
+	.uleb128 .LVU1786
+.LLST811:
+	.byte	0x4
+	.uleb128 .LVL278-.Ltext0
+	.uleb128 .LVL278-.Ltext0
+	.uleb128 0x1
+	.byte	0x66
+	.byte	0
+.LVUS813:
+	.uleb128 .LVU1792
+	.uleb128 .LVU1794
+.LLST813:
+	.byte	0x4
+	.uleb128 .LVL279-.Ltext0
+	.uleb128 .LVL279-.Ltext0
+	.uleb128 0x1
+	.byte	0x66
+	.byte	0
+.LVUS814:
+	.uleb128 .LVU1792
+	.uleb128 .LVU1794
+.LLST814:
+	.byte	0x4
+	.uleb128 .LVL279-.Ltext0
+	.uleb128 .LVL279-.Ltext0
+	.uleb128 0x1
+	.byte	0x61
+	.byte	0
+.LVUS816:
+	.uleb128 .LVU1794
+	.uleb128 .LVU1800
+.LLST816:
+	.byte	0x4
+	.uleb128 .LVL279-.Ltext0
+	.uleb128 .LVL281-.Ltext0
+	.uleb128 0x2
+	.byte	0x40
+	.byte	0x9f
+	.byte	0
+.LVUS817:
+	.uleb128 .LVU1798
+	.uleb128 .LVU1800
+.LLST817:
+	.byte	0x4
+	.uleb128 .LVL280-.Ltext0
+	.uleb128 .LVL281-.Ltext0
+	.uleb128 0x1
+	.byte	0x61
+	.byte	0
+.LVUS818:
+	.uleb128 .LVU1802
+	.uleb128 .LVU1805
+.LLST818:
+	.byte	0x4
+	.uleb128 .LVL281-.Ltext0
+	.uleb128 .LVL282-.Ltext0
+	.uleb128 0x1
+	.byte	0x61
+	.byte	0
+.LVUS819:
+	.uleb128 .LVU1802
+	.uleb128 .LVU1805
+.LLST819:
+	.byte	0x4
+	.uleb128 .LVL281-.Ltext0
+	.uleb128 .LVL282-.Ltext0
+	.uleb128 0x1
+	.byte	0x63
+	.byte	0
+.LVUS821:
+	.uleb128 .LVU1807
+	.uleb128 .LVU1809
+.LLST821:
+	.byte	0x4
+	.uleb128 .LVL282-.Ltext0
+	.uleb128 .LVL282-.Ltext0
+	.uleb128 0x1
+	.byte	0x63
+	.byte	0
+.LVUS822:
+	.uleb128 .LVU1807
+	.uleb128 .LVU1809
+.LLST822:
+	.byte	0x4
+	.uleb128 .LVL282-.Ltext0
+	.uleb128 .LVL282-.Ltext0
+	.uleb128 0x1
+	.byte	0x62
+	.byte	0
+.LVUS824:
+	.uleb128 .LVU1809
+	.uleb128 .LVU1815
+.LLST824:
+	.byte	0x4
+	.uleb128 .LVL282-.Ltext0
+	.uleb128 .LVL284-.Ltext0
+	.uleb128 0x2
+	.byte	0x3c
+	.byte	0x9f
+	.byte	0
+.LVUS825:
+	.uleb128 .LVU1813
+	.uleb128 .LVU1815
+.LLST825:
+	.byte	0x4
+	.uleb128 .LVL283-.Ltext0
+	.uleb128 .LVL284-.Ltext0
+	.uleb128 0x1
+	.byte	0x62
+	.byte	0
+.LVUS826:
+	.uleb128 .LVU1817
+	.uleb128 .LVU1819
+.LLST826:
+	.byte	0x4
+	.uleb128 .LVL284-.Ltext0
+	.uleb128 .LVL284-.Ltext0
+	.uleb128 0x1
+	.byte	0x62
+	.byte	0
+.LVUS827:
+	.uleb128 .LVU1817
+	.uleb128 .LVU1819
+.LLST827:
+	.byte	0x4
+	.uleb128 .LVL284-.Ltext0
+	.uleb128 .LVL284-.Ltext0
+	.uleb128 0x1
+	.byte	0x66
+	.byte	0
+.LVUS828:
+	.uleb128 .LVU1819
+	.uleb128 .LVU1823
+.LLST828:
+	.byte	0x4
+	.uleb128 .LVL284-.Ltext0
+	.uleb128 .LVL285-.Ltext0
+	.uleb128 0x1
+	.byte	0x68
+	.byte	0
+.LVUS830:
+	.uleb128 .LVU1826
+	.uleb128 .LVU1828
+.LLST830:
+	.byte	0x4
+	.uleb128 .LVL286-.Ltext0
+	.uleb128 .LVL286-.Ltext0
+	.uleb128 0x1
+	.byte	0x68
+	.byte	0
+.LVUS831:
+	.uleb128 .LVU1826
+	.uleb128 .LVU1828
+.LLST831:
+	.byte	0x4
+	.uleb128 .LVL286-.Ltext0
+	.uleb128 .LVL286-.Ltext0
+	.uleb128 0x1
+	.byte	0x61
+	.byte	0
+.LVUS833:
+	.uleb128 .LVU1828
+	.uleb128 .LVU1835
+.LLST833:
+	.byte	0x4
+	.uleb128 .LVL286-.Ltext0
+	.uleb128 .LVL288-.Ltext0
+	.uleb128 0x2
+	.byte	0x38
+	.byte	0x9f
+	.byte	0
+.LVUS834:
+	.uleb128 .LVU1833
+	.uleb128 .LVU1835
+.LLST834:
+	.byte	0x4
+	.uleb128 .LVL287-.Ltext0
+	.uleb128 .LVL288-.Ltext0
+	.uleb128 0x1
+	.byte	0x61
+	.byte	0
+.LVUS836:
+	.uleb128 .LVU1837
+	.uleb128 .LVU1844
+.LLST836:
+	.byte	0x4
+	.uleb128 .LVL288-.Ltext0
+	.uleb128 .LVL291-.Ltext0
+	.uleb128 0x1
+	.byte	0x61
+	.byte	0
+.LVUS837:
+	.uleb128 .LVU1837
+	.uleb128 .LVU1844
+.LLST837:
+	.byte	0x4
+	.uleb128 .LVL288-.Ltext0
+	.uleb128 .LVL291-.Ltext0
+	.uleb128 0x1
+	.byte	0x63
+	.byte	0
+.LVUS839:
+	.uleb128 .LVU1846
+	.uleb128 .LVU1848
+.LLST839:
+	.byte	0x4
+	.uleb128 .LVL291-.Ltext0
+	.uleb128 .LVL291-.Ltext0
+	.uleb128 0x1
+	.byte	0x63
+	.byte	0
+.LVUS840:
+	.uleb128 .LVU1846
+	.uleb128 .LVU1848
+.LLST840:
+	.byte	0x4
+	.uleb128 .LVL291-.Ltext0
+	.uleb128 .LVL291-.Ltext0
+	.uleb128 0x1
+	.byte	0x62
+	.byte	0
+.LVUS842:
+	.uleb128 .LVU1848
+	.uleb128 .LVU1858
+.LLST842:
+	.byte	0x4
+	.uleb128 .LVL291-.Ltext0
+	.uleb128 .LVL295-.Ltext0
+	.uleb128 0x2
+	.byte	0x37
+	.byte	0x9f
+	.byte	0
+.LVUS843:
+	.uleb128 .LVU1854
+	.uleb128 .LVU1858
+.LLST843:
+	.byte	0x4
+	.uleb128 .LVL293-.Ltext0
+	.uleb128 .LVL295-.Ltext0
+	.uleb128 0x1
+	.byte	0x62
+	.byte	0
+.LVUS845:
+	.uleb128 .LVU1870
+	.uleb128 .LVU1872
+.LLST845:
+	.byte	0x4
+	.uleb128 .LVL296-.Ltext0
+	.uleb128 .LVL296-.Ltext0
+	.uleb128 0x3
+	.byte	0x8
+	.byte	0x39
+	.byte	0x9f
+	.byte	0
+.LVUS847:
+	.uleb128 .LVU1866
+	.uleb128 .LVU1868
+.LLST847:
+	.byte	0x4
+	.uleb128 .LVL296-.Ltext0
+	.uleb128 .LVL296-.Ltext0
+	.uleb128 0x3
+	.byte	0x8
+	.byte	0x4e
+	.byte	0x9f
+	.byte	0
+.LVUS848:
+	.uleb128 .LVU1861
+	.uleb128 .LVU1864
+.LLST848:
+	.byte	0x4
+	.uleb128 .LVL295-.Ltext0
+	.uleb128 .LVL296-.Ltext0
+	.uleb128 0x3
+	.byte	0x8
+	.byte	0x93
+	.byte	0x9f
+	.byte	0
+.LVUS849:
+	.uleb128 .LVU1861
+	.uleb128 .LVU1864
+.LLST849:
+	.byte	0x4
+	.uleb128 .LVL295-.Ltext0
+	.uleb128 .LVL296-.Ltext0
+	.uleb128 0x1
+	.byte	0x62
+	.byte	0
+.LVUS851:
+	.uleb128 .LVU1879
+	.uleb128 .LVU1994
+.LLST851:
+	.byte	0x4
+	.uleb128 .LVL296-.Ltext0
+	.uleb128 .LVL313-.Ltext0
+	.uleb128 0x1
+	.byte	0x66
+	.byte	0
+.LVUS852:
+	.uleb128 .LVU1883
+	.uleb128 0
+.LLST852:
+	.byte	0x4
+	.uleb128 .LVL296-.Ltext0
+	.uleb128 .LFE6406-.Ltext0
+	.uleb128 0x1
+	.byte	0x69
+	.byte	0
+.LVUS856:
+	.uleb128 .LVU1897
+	.uleb128 .LVU1899
+.LLST856:
+	.byte	0x4
+	.uleb128 .LVL296-.Ltext0
+	.uleb128 .LVL296-.Ltext0
+	.uleb128 0x2
+	.byte	0x31
+	.byte	0x9f
+	.byte	0
+.LVUS857:
+	.uleb128 .LVU1897
+	.uleb128 .LVU1899
+.LLST857:
+	.byte	0x4
+	.uleb128 .LVL296-.Ltext0
+	.uleb128 .LVL296-.Ltext0
+	.uleb128 0x1
+	.byte	0x69
+	.byte	0
+.LVUS859:
+	.uleb128 .LVU1889
+	.uleb128 .LVU1891
+.LLST859:
+	.byte	0x4
+	.uleb128 .LVL296-.Ltext0
+	.uleb128 .LVL296-.Ltext0
+	.uleb128 0x2
+	.byte	0x31
+	.byte	0x9f
+	.byte	0
+.LVUS860:
+	.uleb128 .LVU1889
+	.uleb128 .LVU1891
+.LLST860:
+	.byte	0x4
+	.uleb128 .LVL296-.Ltext0
+	.uleb128 .LVL296-.Ltext0
+	.uleb128 0x1
+	.byte	0x66
+	.byte	0
+.LVUS861:
+	.uleb128 .LVU1885
+	.uleb128 .LVU1887
+.LLST861:
+	.byte	0x4
+	.uleb128 .LVL296-.Ltext0
+	.uleb128 .LVL296-.Ltext0
+	.uleb128 0x1
+	.byte	0x66
+	.byte	0
+.LVUS862:
+	.uleb128 .LVU1893
+	.uleb128 .LVU1895
+.LLST862:
+	.byte	0x4
+	.uleb128 .LVL296-.Ltext0
+	.uleb128 .LVL296-.Ltext0
+	.uleb128 0x1
+	.byte	0x69
+	.byte	0
+.LVUS863:
+	.uleb128 .LVU1902
+	.uleb128 .LVU1904
+.LLST863:
+	.byte	0x4
+	.uleb128 .LVL296-.Ltext0
+	.uleb128 .LVL296-.Ltext0
+	.uleb128 0x1
+	.byte	0x62
+	.byte	0
+.LVUS864:
+	.uleb128 .LVU1902
+	.uleb128 .LVU1904
+.LLST864:
+	.byte	0x4
+	.uleb128 .LVL296-.Ltext0
+	.uleb128 .LVL296-.Ltext0
+	.uleb128 0x1
+	.byte	0x68
+	.byte	0
+.LVUS865:
+	.uleb128 .LVU1904
+	.uleb128 .LVU1908
+.LLST865:
+	.byte	0x4
+	.uleb128 .LVL296-.Ltext0
+	.uleb128 .LVL297-.Ltext0
+	.uleb128 0x1
+	.byte	0x66
+	.byte	0
+.LVUS867:
+	.uleb128 .LVU1910
+	.uleb128 .LVU1912
+.LLST867:
+	.byte	0x4
+	.uleb128 .LVL297-.Ltext0
+	.uleb128 .LVL297-.Ltext0
+	.uleb128 0x1
+	.byte	0x67
+	.byte	0
+.LVUS868:
+	.uleb128 .LVU1910
+	.uleb128 .LVU1912
+.LLST868:
+	.byte	0x4
+	.uleb128 .LVL297-.Ltext0
+	.uleb128 .LVL297-.Ltext0
+	.uleb128 0x1
+	.byte	0x61
+	.byte	0
+.LVUS870:
+	.uleb128 .LVU1912
+	.uleb128 .LVU1918
+.LLST870:
+	.byte	0x4
+	.uleb128 .LVL297-.Ltext0
+	.uleb128 .LVL299-.Ltext0
+	.uleb128 0x2
+	.byte	0x40
+	.byte	0x9f
+	.byte	0
+.LVUS871:
+	.uleb128 .LVU1916
+	.uleb128 .LVU1918
+.LLST871:
+	.byte	0x4
+	.uleb128 .LVL298-.Ltext0
+	.uleb128 .LVL299-.Ltext0
+	.uleb128 0x1
+	.byte	0x61
+	.byte	0
+.LVUS872:
+	.uleb128 .LVU1920
+	.uleb128 .LVU1923
+.LLST872:
+	.byte	0x4
+	.uleb128 .LVL299-.Ltext0
+	.uleb128 .LVL300-.Ltext0
+	.uleb128 0x1
+	.byte	0x61
+	.byte	0
+.LVUS873:
+	.uleb128 .LVU1920
+	.uleb128 .LVU1923
+.LLST873:
+	.byte	0x4
+	.uleb128 .LVL299-.Ltext0
+	.uleb128 .LVL300-.Ltext0
+	.uleb128 0x1
+	.byte	0x63
+	.byte	0
+.LVUS875:
+	.uleb128 .LVU1925
+	.uleb128 .LVU1927
+.LLST875:
+	.byte	0x4
+	.uleb128 .LVL300-.Ltext0
+	.uleb128 .LVL300-.Ltext0
+	.uleb128 0x1
+	.byte	0x63
+	.byte	0
+.LVUS876:
+	.uleb128 .LVU1925
+	.uleb128 .LVU1927
+.LLST876:
+	.byte	0x4
+	.uleb128 .LVL300-.Ltext0
+	.uleb128 .LVL300-.Ltext0
+	.uleb128 0x1
+	.byte	0x62
+	.byte	0
+.LVUS878:
+	.uleb128 .LVU1927
+	.uleb128 .LVU1933
+.LLST878:
+	.byte	0x4
+	.uleb128 .LVL300-.Ltext0
+	.uleb128 .LVL302-.Ltext0
+	.uleb128 0x2
+	.byte	0x3c
+	.byte	0x9f
+	.byte	0
+.LVUS879:
+	.uleb128 .LVU1931
+	.uleb128 .LVU1933
+.LLST879:
+	.byte	0x4
+	.uleb128 .LVL301-.Ltext0
+	.uleb128 .LVL302-.Ltext0
+	.uleb128 0x1
+	.byte	0x62
+	.byte	0
+.LVUS880:
+	.uleb128 .LVU1935
+	.uleb128 .LVU1937
+.LLST880:
+	.byte	0x4
+	.uleb128 .LVL302-.Ltext0
+	.uleb128 .LVL302-.Ltext0
+	.uleb128 0x1
+	.byte	0x62
+	.byte	0
+.LVUS881:
+	.uleb128 .LVU1935
+	.uleb128 .LVU1937
+.LLST881:
+	.byte	0x4
+	.uleb128 .LVL302-.Ltext0
+	.uleb128 .LVL302-.Ltext0
+	.uleb128 0x1
+	.byte	0x67
+	.byte	0
+.LVUS882:
+	.uleb128 .LVU1937
+	.uleb128 .LVU1941
+.LLST882:
+	.byte	0x4
+	.uleb128 .LVL302-.Ltext0
+	.uleb128 .LVL303-.Ltext0
+	.uleb128 0x1
+	.byte	0x64
+	.byte	0
+.LVUS884:
+	.uleb128 .LVU1944
+	.uleb128 .LVU1946
+.LLST884:
+	.byte	0x4
+	.uleb128 .LVL304-.Ltext0
+	.uleb128 .LVL304-.Ltext0
+	.uleb128 0x1
+	.byte	0x64
+	.byte	0
+.LVUS885:
+	.uleb128 .LVU1944
+	.uleb128 .LVU1946
+.LLST885:
+	.byte	0x4
+	.uleb128 .LVL304-.Ltext0
+	.uleb128 .LVL304-.Ltext0
+	.uleb128 0x1
+	.byte	0x61
+	.byte	0
+.LVUS887:
+	.uleb128 .LVU1946
+	.uleb128 .LVU1952
+.LLST887:
+	.byte	0x4
+	.uleb128 .LVL304-.Ltext0
+	.uleb128 .LVL306-.Ltext0
+	.uleb128 0x2
+	.byte	0x38
+	.byte	0x9f
+	.byte	0
+.LVUS888:
+	.uleb128 .LVU1950
+	.uleb128 .LVU1952
+.LLST888:
+	.byte	0x4
+	.uleb128 .LVL305-.Ltext0
+	.uleb128 .LVL306-.Ltext0
+	.uleb128 0x1
+	.byte	0x61
+	.byte	0
+.LVUS889:
+	.uleb128 .LVU1954
+	.uleb128 .LVU1957
+.LLST889:
+	.byte	0x4
+	.uleb128 .LVL306-.Ltext0
+	.uleb128 .LVL307-.Ltext0
+	.uleb128 0x1
+	.byte	0x61
+	.byte	0
+.LVUS890:
+	.uleb128 .LVU1954
+	.uleb128 .LVU1957
+.LLST890:
+	.byte	0x4
+	.uleb128 .LVL306-.Ltext0
+	.uleb128 .LVL307-.Ltext0
+	.uleb128 0x1
+	.byte	0x63
+	.byte	0
+.LVUS892:
+	.uleb128 .LVU1959
+	.uleb128 .LVU1961
+.LLST892:
+	.byte	0x4
+	.uleb128 .LVL307-.Ltext0
+	.uleb128 .LVL307-.Ltext0
+	.uleb128 0x1
+	.byte	0x63
+	.byte	0
+.LVUS893:
+	.uleb128 .LVU1959
+	.uleb128 .LVU1961
+.LLST893:
+	.byte	0x4
+	.uleb128 .LVL307-.Ltext0
+	.uleb128 .LVL307-.Ltext0
+	.uleb128 0x1
+	.byte	0x62
+	.byte	0
+.LVUS895:
+	.uleb128 .LVU1961
+	.uleb128 .LVU1971
+.LLST895:
+	.byte	0x4
+	.uleb128 .LVL307-.Ltext0
+	.uleb128 .LVL311-.Ltext0
+	.uleb128 0x2
+	.byte	0x37
+	.byte	0x9f
+	.byte	0
+.LVUS896:
+	.uleb128 .LVU1967
+	.uleb128 .LVU1971
+.LLST896:
+	.byte	0x4
+	.uleb128 .LVL309-.Ltext0
+	.uleb128 .LVL311-.Ltext0
+	.uleb128 0x1
+	.byte	0x62
+	.byte	0
+.LVUS898:
+	.uleb128 .LVU1983
+	.uleb128 .LVU1985
+.LLST898:
+	.byte	0x4
+	.uleb128 .LVL312-.Ltext0
+	.uleb128 .LVL312-.Ltext0
+	.uleb128 0x3
+	.byte	0x8
+	.byte	0x93
+	.byte	0x9f
+	.byte	0
+.LVUS900:
+	.uleb128 .LVU1979
+	.uleb128 .LVU1981
+.LLST900:
+	.byte	0x4
+	.uleb128 .LVL312-.Ltext0
+	.uleb128 .LVL312-.Ltext0
+	.uleb128 0x3
+	.byte	0x8
+	.byte	0x4e
+	.byte	0x9f
+	.byte	0
+.LVUS901:
+	.uleb128 .LVU1974
+	.uleb128 .LVU1977
+.LLST901:
+	.byte	0x4
+	.uleb128 .LVL311-.Ltext0
+	.uleb128 .LVL312-.Ltext0
+	.uleb128 0x3
+	.byte	0x8
+	.byte	0x39
+	.byte	0x9f
+	.byte	0
+.LVUS902:
+	.uleb128 .LVU1974
+	.uleb128 .LVU1977
+.LLST902:
+	.byte	0x4
+	.uleb128 .LVL311-.Ltext0
+	.uleb128 .LVL312-.Ltext0
+	.uleb128 0x1
+	.byte	0x62
+	.byte	0
+.LVUS903:
+	.uleb128 .LVU1988
+	.uleb128 .LVU1990
+.LLST903:
+	.byte	0x4
+	.uleb128 .LVL312-.Ltext0
+	.uleb128 .LVL312-.Ltext0
+	.uleb128 0x1
+	.byte	0x62
+	.byte	0
+.LVUS904:
+	.uleb128 .LVU1988
+	.uleb128 .LVU1990
+.LLST904:
+	.byte	0x4
+	.uleb128 .LVL312-.Ltext0
+	.uleb128 .LVL312-.Ltext0
+	.uleb128 0x1
+	.byte	0x64
+	.byte	0
+.LVUS905:
+	.uleb128 .LVU1990
+	.uleb128 .LVU1995
+.LLST905:
+	.byte	0x4
+	.uleb128 .LVL312-.Ltext0
+	.uleb128 .LVL314-.Ltext0
+	.uleb128 0x1
+	.byte	0x69
+	.byte	0
+.LVUS907:
+	.uleb128 .LVU1997
+	.uleb128 .LVU1999
+.LLST907:
+	.byte	0x4
+	.uleb128 .LVL314-.Ltext0
+	.uleb128 .LVL314-.Ltext0
+	.uleb128 0x1
+	.byte	0x66
+	.byte	0
+.LVUS908:
+	.uleb128 .LVU1997
+	.uleb128 .LVU1999
+.LLST908:
+	.byte	0x4
+	.uleb128 .LVL314-.Ltext0
+	.uleb128 .LVL314-.Ltext0
+	.uleb128 0x1
+	.byte	0x61
+	.byte	0
+.LVUS910:
+	.uleb128 .LVU1999
+	.uleb128 .LVU2005
+.LLST910:
+	.byte	0x4
+	.uleb128 .LVL314-.Ltext0
+	.uleb128 .LVL316-.Ltext0
+	.uleb128 0x2
+	.byte	0x40
+	.byte	0x9f
+	.byte	0
+.LVUS911:
+	.uleb128 .LVU2003
+	.uleb128 .LVU2005
+.LLST911:
+	.byte	0x4
+	.uleb128 .LVL315-.Ltext0
+	.uleb128 .LVL316-.Ltext0
+	.uleb128 0x1
+	.byte	0x61
+	.byte	0
+.LVUS912:
+	.uleb128 .LVU2007
+	.uleb128 .LVU2010
+.LLST912:
+	.byte	0x4
+	.uleb128 .LVL316-.Ltext0
+	.uleb128 .LVL317-.Ltext0
+	.uleb128 0x1
+	.byte	0x61
+	.byte	0
+.LVUS913:
+	.uleb128 .LVU2007
+	.uleb128 .LVU2010
+.LLST913:
+	.byte	0x4
+	.uleb128 .LVL316-.Ltext0
+	.uleb128 .LVL317-.Ltext0
+	.uleb128 0x1
+	.byte	0x63
+	.byte	0
+.LVUS915:
+	.uleb128 .LVU2012
+	.uleb128 .LVU2014
+.LLST915:
+	.byte	0x4
+	.uleb128 .LVL317-.Ltext0
+	.uleb128 .LVL317-.Ltext0
+	.uleb128 0x1
+	.byte	0x63
+	.byte	0
+.LVUS916:
+	.uleb128 .LVU2012
+	.uleb128 .LVU2014
+.LLST916:
+	.byte	0x4
+	.uleb128 .LVL317-.Ltext0
+	.uleb128 .LVL317-.Ltext0
+	.uleb128 0x1
+	.byte	0x62
+	.byte	0
+.LVUS918:
+	.uleb128 .LVU2014
+	.uleb128 .LVU2020
+.LLST918:
+	.byte	0x4
+	.uleb128 .LVL317-.Ltext0
+	.uleb128 .LVL319-.Ltext0
+	.uleb128 0x2
+	.byte	0x3c
+	.byte	0x9f
+	.byte	0
+.LVUS919:
+	.uleb128 .LVU2018
+	.uleb128 .LVU2020
+.LLST919:
+	.byte	0x4
+	.uleb128 .LVL318-.Ltext0
+	.uleb128 .LVL319-.Ltext0
+	.uleb128 0x1
+	.byte	0x62
+	.byte	0
+.LVUS920:
+	.uleb128 .LVU2022
+	.uleb128 .LVU2024
+.LLST920:
+	.byte	0x4
+	.uleb128 .LVL319-.Ltext0
+	.uleb128 .LVL319-.Ltext0
+	.uleb128 0x1
+	.byte	0x62
+	.byte	0
+.LVUS921:
+	.uleb128 .LVU2022
+	.uleb128 .LVU2024
+.LLST921:
+	.byte	0x4
+	.uleb128 .LVL319-.Ltext0
+	.uleb128 .LVL319-.Ltext0
+	.uleb128 0x1
+	.byte	0x66
+	.byte	0
+.LVUS923:
+	.uleb128 .LVU2024
+	.uleb128 .LVU2027
+.LLST923:
+	.byte	0x4
+	.uleb128 .LVL319-.Ltext0
+	.uleb128 .LVL319-.Ltext0
+	.uleb128 0x1
+	.byte	0x65
+	.byte	0
+.LVUS925:
+	.uleb128 .LVU2029
+	.uleb128 .LVU2032
+.LLST925:
+	.byte	0x4
+	.uleb128 .LVL319-.Ltext0
+	.uleb128 .LVL320-.Ltext0
+	.uleb128 0x1
+	.byte	0x61
+	.byte	0
+.LVUS927:
+	.uleb128 .LVU2032
+	.uleb128 .LVU2038
+.LLST927:
+	.byte	0x4
+	.uleb128 .LVL320-.Ltext0
+	.uleb128 .LVL322-.Ltext0
+	.uleb128 0x2
+	.byte	0x38
+	.byte	0x9f
+	.byte	0
+.LVUS928:
+	.uleb128 .LVU2036
+	.uleb128 .LVU2038
+.LLST928:
+	.byte	0x4
+	.uleb128 .LVL321-.Ltext0
+	.uleb128 .LVL322-.Ltext0
+	.uleb128 0x1
+	.byte	0x61
+	.byte	0
+.LVUS929:
+	.uleb128 .LVU2040
+	.uleb128 .LVU2043
+.LLST929:
+	.byte	0x4
+	.uleb128 .LVL322-.Ltext0
+	.uleb128 .LVL323-.Ltext0
+	.uleb128 0x1
+	.byte	0x61
+	.byte	0
+.LVUS930:
+	.uleb128 .LVU2040
+	.uleb128 .LVU2043
+.LLST930:
+	.byte	0x4
+	.uleb128 .LVL322-.Ltext0
+	.uleb128 .LVL323-.Ltext0
+	.uleb128 0x1
+	.byte	0x63
+	.byte	0
+.LVUS932:
+	.uleb128 .LVU2045
+	.uleb128 .LVU2047
+.LLST932:
+	.byte	0x4
+	.uleb128 .LVL323-.Ltext0
+	.uleb128 .LVL323-.Ltext0
+	.uleb128 0x1
+	.byte	0x63
+	.byte	0
+.LVUS933:
+	.uleb128 .LVU2045
+	.uleb128 .LVU2047
+.LLST933:
+	.byte	0x4
+	.uleb128 .LVL323-.Ltext0
+	.uleb128 .LVL323-.Ltext0
+	.uleb128 0x1
+	.byte	0x62
+	.byte	0
+.LVUS935:
+	.uleb128 .LVU2047
+	.uleb128 .LVU2057
+.LLST935:
+	.byte	0x4
+	.uleb128 .LVL323-.Ltext0
+	.uleb128 .LVL327-.Ltext0
+	.uleb128 0x2
+	.byte	0x37
+	.byte	0x9f
+	.byte	0
+.LVUS936:
+	.uleb128 .LVU2053
+	.uleb128 .LVU2057
+.LLST936:
+	.byte	0x4
+	.uleb128 .LVL325-.Ltext0
+	.uleb128 .LVL327-.Ltext0
+	.uleb128 0x1
+	.byte	0x62
+	.byte	0
+.LVUS938:
+	.uleb128 .LVU2071
+	.uleb128 .LVU2073
+.LLST938:
+	.byte	0x4
+	.uleb128 .LVL328-.Ltext0
+	.uleb128 .LVL328-.Ltext0
+	.uleb128 0x3
+	.byte	0x8
+	.byte	0x39
+	.byte	0x9f
+	.byte	0
+.LVUS940:
+	.uleb128 .LVU2067
+	.uleb128 .LVU2069
+.LLST940:
+	.byte	0x4
+	.uleb128 .LVL328-.Ltext0
+	.uleb128 .LVL328-.Ltext0
+	.uleb128 0x3
+	.byte	0x8
+	.byte	0x4e
+	.byte	0x9f
+	.byte	0
+.LVUS942:
+	.uleb128 .LVU2060
+	.uleb128 .LVU2065
+.LLST942:
+	.byte	0x4
+	.uleb128 .LVL327-.Ltext0
+	.uleb128 .LVL328-.Ltext0
+	.uleb128 0x3
+	.byte	0x8
+	.byte	0x93
+	.byte	0x9f
+	.byte	0
+.LVUS943:
+	.uleb128 .LVU2060
+	.uleb128 .LVU2065
+.LLST943:
+	.byte	0x4
+	.uleb128 .LVL327-.Ltext0
+	.uleb128 .LVL328-.Ltext0
+	.uleb128 0x1
+	.byte	0x62
+	.byte	0
+.LVUS945:
+	.uleb128 .LVU2076
+	.uleb128 .LVU2078
+.LLST945:
+	.byte	0x4
+	.uleb128 .LVL328-.Ltext0
+	.uleb128 .LVL328-.Ltext0
+	.uleb128 0x1
+	.byte	0x63
+	.byte	0
+.LVUS946:
+	.uleb128 .LVU2083
+	.uleb128 .LVU2085
+.LLST946:
+	.byte	0x4
+	.uleb128 .LVL328-.Ltext0
+	.uleb128 .LVL328-.Ltext0
+	.uleb128 0x1
+	.byte	0x61
+	.byte	0
+.LVUS947:
+	.uleb128 .LVU2083
+	.uleb128 .LVU2085
+.LLST947:
+	.byte	0x4
+	.uleb128 .LVL328-.Ltext0
+	.uleb128 .LVL328-.Ltext0
+	.uleb128 0x1
+	.byte	0x62
+	.byte	0
+.LVUS948:
+	.uleb128 .LVU2085
+	.uleb128 .LVU2088
+.LLST948:
+	.byte	0x4
+	.uleb128 .LVL328-.Ltext0
+	.uleb128 .LVL328-.Ltext0
+	.uleb128 0x2
+	.byte	0x75
+	.sleb128 16
+	.byte	0
+.Ldebug_loc3:
+	.section	.debug_aranges,"",@progbits
+	.long	0x2c
+	.value	0x2
+	.long	.Ldebug_info0
+	.byte	0x8
+	.byte	0
+	.value	0
+	.value	0
+	.quad	.Ltext0
+	.quad	.Letext0-.Ltext0
+	.quad	0
+	.quad	0
+	.section	.debug_rnglists,"",@progbits
+.Ldebug_ranges0:
+	.long	.Ldebug_ranges3-.Ldebug_ranges2
+.Ldebug_ranges2:
+	.value	0x5
+	.byte	0x8
+	.byte	0
+	.long	0
+.LLRL10:
+	.byte	0x4
+	.uleb128 .LBB1731-.Ltext0
+	.uleb128 .LBE1731-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB1868-.Ltext0
+	.uleb128 .LBE1868-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB2010-.Ltext0
+	.uleb128 .LBE2010-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB2012-.Ltext0
+	.uleb128 .LBE2012-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB2014-.Ltext0
+	.uleb128 .LBE2014-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB2016-.Ltext0
+	.uleb128 .LBE2016-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB2018-.Ltext0
+	.uleb128 .LBE2018-.Ltext0
+	.byte	0
+.LLRL13:
+	.byte	0x4
+	.uleb128 .LBB1732-.Ltext0
+	.uleb128 .LBE1732-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB1739-.Ltext0
+	.uleb128 .LBE1739-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB1743-.Ltext0
+	.uleb128 .LBE1743-.Ltext0
+	.byte	0
+.LLRL16:
+	.byte	0x4
+	.uleb128 .LBB1736-.Ltext0
+	.uleb128 .LBE1736-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB1744-.Ltext0
+	.uleb128 .LBE1744-.Ltext0
+	.byte	0
+.LLRL19:
+	.byte	0x4
+	.uleb128 .LBB1740-.Ltext0
+	.uleb128 .LBE1740-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB1763-.Ltext0
+	.uleb128 .LBE1763-.Ltext0
+	.byte	0
+.LLRL22:
+	.byte	0x4
+	.uleb128 .LBB1747-.Ltext0
+	.uleb128 .LBE1747-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB1753-.Ltext0
+	.uleb128 .LBE1753-.Ltext0
+	.byte	0
+.LLRL25:
+	.byte	0x4
+	.uleb128 .LBB1750-.Ltext0
+	.uleb128 .LBE1750-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB1764-.Ltext0
+	.uleb128 .LBE1764-.Ltext0
+	.byte	0
+.LLRL27:
+	.byte	0x4
+	.uleb128 .LBB1756-.Ltext0
+	.uleb128 .LBE1756-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB1762-.Ltext0
+	.uleb128 .LBE1762-.Ltext0
+	.byte	0
+.LLRL30:
+	.byte	0x4
+	.uleb128 .LBB1759-.Ltext0
+	.uleb128 .LBE1759-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB1765-.Ltext0
+	.uleb128 .LBE1765-.Ltext0
+	.byte	0
+.LLRL33:
+	.byte	0x4
+	.uleb128 .LBB1766-.Ltext0
+	.uleb128 .LBE1766-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB1769-.Ltext0
+	.uleb128 .LBE1769-.Ltext0
+	.byte	0
+.LLRL37:
+	.byte	0x4
+	.uleb128 .LBB1772-.Ltext0
+	.uleb128 .LBE1772-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB1778-.Ltext0
+	.uleb128 .LBE1778-.Ltext0
+	.byte	0
+.LLRL40:
+	.byte	0x4
+	.uleb128 .LBB1775-.Ltext0
+	.uleb128 .LBE1775-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB1779-.Ltext0
+	.uleb128 .LBE1779-.Ltext0
+	.byte	0
+.LLRL46:
+	.byte	0x4
+	.uleb128 .LBB1784-.Ltext0
+	.uleb128 .LBE1784-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB1790-.Ltext0
+	.uleb128 .LBE1790-.Ltext0
+	.byte	0
+.LLRL49:
+	.byte	0x4
+	.uleb128 .LBB1787-.Ltext0
+	.uleb128 .LBE1787-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB1791-.Ltext0
+	.uleb128 .LBE1791-.Ltext0
+	.byte	0
+.LLRL54:
+	.byte	0x4
+	.uleb128 .LBB1794-.Ltext0
+	.uleb128 .LBE1794-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB1803-.Ltext0
+	.uleb128 .LBE1803-.Ltext0
+	.byte	0
+.LLRL57:
+	.byte	0x4
+	.uleb128 .LBB1797-.Ltext0
+	.uleb128 .LBE1797-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB1807-.Ltext0
+	.uleb128 .LBE1807-.Ltext0
+	.byte	0
+.LLRL60:
+	.byte	0x4
+	.uleb128 .LBB1800-.Ltext0
+	.uleb128 .LBE1800-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB1811-.Ltext0
+	.uleb128 .LBE1811-.Ltext0
+	.byte	0
+.LLRL62:
+	.byte	0x4
+	.uleb128 .LBB1804-.Ltext0
+	.uleb128 .LBE1804-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB1810-.Ltext0
+	.uleb128 .LBE1810-.Ltext0
+	.byte	0
+.LLRL68:
+	.byte	0x4
+	.uleb128 .LBB1816-.Ltext0
+	.uleb128 .LBE1816-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB1822-.Ltext0
+	.uleb128 .LBE1822-.Ltext0
+	.byte	0
+.LLRL71:
+	.byte	0x4
+	.uleb128 .LBB1819-.Ltext0
+	.uleb128 .LBE1819-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB1823-.Ltext0
+	.uleb128 .LBE1823-.Ltext0
+	.byte	0
+.LLRL76:
+	.byte	0x4
+	.uleb128 .LBB1826-.Ltext0
+	.uleb128 .LBE1826-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB1832-.Ltext0
+	.uleb128 .LBE1832-.Ltext0
+	.byte	0
+.LLRL79:
+	.byte	0x4
+	.uleb128 .LBB1829-.Ltext0
+	.uleb128 .LBE1829-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB1833-.Ltext0
+	.uleb128 .LBE1833-.Ltext0
+	.byte	0
+.LLRL85:
+	.byte	0x4
+	.uleb128 .LBB1838-.Ltext0
+	.uleb128 .LBE1838-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB1844-.Ltext0
+	.uleb128 .LBE1844-.Ltext0
+	.byte	0
+.LLRL88:
+	.byte	0x4
+	.uleb128 .LBB1841-.Ltext0
+	.uleb128 .LBE1841-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB1845-.Ltext0
+	.uleb128 .LBE1845-.Ltext0
+	.byte	0
+.LLRL91:
+	.byte	0x4
+	.uleb128 .LBB1846-.Ltext0
+	.uleb128 .LBE1846-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB1849-.Ltext0
+	.uleb128 .LBE1849-.Ltext0
+	.byte	0
+.LLRL94:
+	.byte	0x4
+	.uleb128 .LBB1850-.Ltext0
+	.uleb128 .LBE1850-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB1859-.Ltext0
+	.uleb128 .LBE1859-.Ltext0
+	.byte	0
+.LLRL97:
+	.byte	0x4
+	.uleb128 .LBB1853-.Ltext0
+	.uleb128 .LBE1853-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB1863-.Ltext0
+	.uleb128 .LBE1863-.Ltext0
+	.byte	0
+.LLRL100:
+	.byte	0x4
+	.uleb128 .LBB1856-.Ltext0
+	.uleb128 .LBE1856-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB1867-.Ltext0
+	.uleb128 .LBE1867-.Ltext0
+	.byte	0
+.LLRL102:
+	.byte	0x4
+	.uleb128 .LBB1860-.Ltext0
+	.uleb128 .LBE1860-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB1866-.Ltext0
+	.uleb128 .LBE1866-.Ltext0
+	.byte	0
+.LLRL106:
+	.byte	0x4
+	.uleb128 .LBB1869-.Ltext0
+	.uleb128 .LBE1869-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB2011-.Ltext0
+	.uleb128 .LBE2011-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB2013-.Ltext0
+	.uleb128 .LBE2013-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB2015-.Ltext0
+	.uleb128 .LBE2015-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB2017-.Ltext0
+	.uleb128 .LBE2017-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB2019-.Ltext0
+	.uleb128 .LBE2019-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB2161-.Ltext0
+	.uleb128 .LBE2161-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB2163-.Ltext0
+	.uleb128 .LBE2163-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB2165-.Ltext0
+	.uleb128 .LBE2165-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB2167-.Ltext0
+	.uleb128 .LBE2167-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB2169-.Ltext0
+	.uleb128 .LBE2169-.Ltext0
+	.byte	0
+.LLRL107:
+	.byte	0x4
+	.uleb128 .LBB1870-.Ltext0
+	.uleb128 .LBE1870-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB1874-.Ltext0
+	.uleb128 .LBE1874-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB1893-.Ltext0
+	.uleb128 .LBE1893-.Ltext0
+	.byte	0
+.LLRL110:
+	.byte	0x4
+	.uleb128 .LBB1875-.Ltext0
+	.uleb128 .LBE1875-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB1896-.Ltext0
+	.uleb128 .LBE1896-.Ltext0
+	.byte	0
+.LLRL111:
+	.byte	0x4
+	.uleb128 .LBB1878-.Ltext0
+	.uleb128 .LBE1878-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB1897-.Ltext0
+	.uleb128 .LBE1897-.Ltext0
+	.byte	0
+.LLRL113:
+	.byte	0x4
+	.uleb128 .LBB1881-.Ltext0
+	.uleb128 .LBE1881-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB1885-.Ltext0
+	.uleb128 .LBE1885-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB1892-.Ltext0
+	.uleb128 .LBE1892-.Ltext0
+	.byte	0
+.LLRL116:
+	.byte	0x4
+	.uleb128 .LBB1886-.Ltext0
+	.uleb128 .LBE1886-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB1894-.Ltext0
+	.uleb128 .LBE1894-.Ltext0
+	.byte	0
+.LLRL117:
+	.byte	0x4
+	.uleb128 .LBB1889-.Ltext0
+	.uleb128 .LBE1889-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB1895-.Ltext0
+	.uleb128 .LBE1895-.Ltext0
+	.byte	0
+.LLRL121:
+	.byte	0x4
+	.uleb128 .LBB1902-.Ltext0
+	.uleb128 .LBE1902-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB1908-.Ltext0
+	.uleb128 .LBE1908-.Ltext0
+	.byte	0
+.LLRL124:
+	.byte	0x4
+	.uleb128 .LBB1905-.Ltext0
+	.uleb128 .LBE1905-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB1909-.Ltext0
+	.uleb128 .LBE1909-.Ltext0
+	.byte	0
+.LLRL127:
+	.byte	0x4
+	.uleb128 .LBB1910-.Ltext0
+	.uleb128 .LBE1910-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB1913-.Ltext0
+	.uleb128 .LBE1913-.Ltext0
+	.byte	0
+.LLRL130:
+	.byte	0x4
+	.uleb128 .LBB1914-.Ltext0
+	.uleb128 .LBE1914-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB1920-.Ltext0
+	.uleb128 .LBE1920-.Ltext0
+	.byte	0
+.LLRL133:
+	.byte	0x4
+	.uleb128 .LBB1917-.Ltext0
+	.uleb128 .LBE1917-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB1921-.Ltext0
+	.uleb128 .LBE1921-.Ltext0
+	.byte	0
+.LLRL139:
+	.byte	0x4
+	.uleb128 .LBB1926-.Ltext0
+	.uleb128 .LBE1926-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB1932-.Ltext0
+	.uleb128 .LBE1932-.Ltext0
+	.byte	0
+.LLRL142:
+	.byte	0x4
+	.uleb128 .LBB1929-.Ltext0
+	.uleb128 .LBE1929-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB1933-.Ltext0
+	.uleb128 .LBE1933-.Ltext0
+	.byte	0
+.LLRL147:
+	.byte	0x4
+	.uleb128 .LBB1936-.Ltext0
+	.uleb128 .LBE1936-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB1945-.Ltext0
+	.uleb128 .LBE1945-.Ltext0
+	.byte	0
+.LLRL150:
+	.byte	0x4
+	.uleb128 .LBB1939-.Ltext0
+	.uleb128 .LBE1939-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB1949-.Ltext0
+	.uleb128 .LBE1949-.Ltext0
+	.byte	0
+.LLRL153:
+	.byte	0x4
+	.uleb128 .LBB1942-.Ltext0
+	.uleb128 .LBE1942-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB1953-.Ltext0
+	.uleb128 .LBE1953-.Ltext0
+	.byte	0
+.LLRL155:
+	.byte	0x4
+	.uleb128 .LBB1946-.Ltext0
+	.uleb128 .LBE1946-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB1952-.Ltext0
+	.uleb128 .LBE1952-.Ltext0
+	.byte	0
+.LLRL161:
+	.byte	0x4
+	.uleb128 .LBB1958-.Ltext0
+	.uleb128 .LBE1958-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB1964-.Ltext0
+	.uleb128 .LBE1964-.Ltext0
+	.byte	0
+.LLRL164:
+	.byte	0x4
+	.uleb128 .LBB1961-.Ltext0
+	.uleb128 .LBE1961-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB1965-.Ltext0
+	.uleb128 .LBE1965-.Ltext0
+	.byte	0
+.LLRL169:
+	.byte	0x4
+	.uleb128 .LBB1968-.Ltext0
+	.uleb128 .LBE1968-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB1974-.Ltext0
+	.uleb128 .LBE1974-.Ltext0
+	.byte	0
+.LLRL172:
+	.byte	0x4
+	.uleb128 .LBB1971-.Ltext0
+	.uleb128 .LBE1971-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB1975-.Ltext0
+	.uleb128 .LBE1975-.Ltext0
+	.byte	0
+.LLRL178:
+	.byte	0x4
+	.uleb128 .LBB1980-.Ltext0
+	.uleb128 .LBE1980-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB1986-.Ltext0
+	.uleb128 .LBE1986-.Ltext0
+	.byte	0
+.LLRL181:
+	.byte	0x4
+	.uleb128 .LBB1983-.Ltext0
+	.uleb128 .LBE1983-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB1987-.Ltext0
+	.uleb128 .LBE1987-.Ltext0
+	.byte	0
+.LLRL184:
+	.byte	0x4
+	.uleb128 .LBB1988-.Ltext0
+	.uleb128 .LBE1988-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB1991-.Ltext0
+	.uleb128 .LBE1991-.Ltext0
+	.byte	0
+.LLRL187:
+	.byte	0x4
+	.uleb128 .LBB1992-.Ltext0
+	.uleb128 .LBE1992-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB2001-.Ltext0
+	.uleb128 .LBE2001-.Ltext0
+	.byte	0
+.LLRL190:
+	.byte	0x4
+	.uleb128 .LBB1995-.Ltext0
+	.uleb128 .LBE1995-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB2005-.Ltext0
+	.uleb128 .LBE2005-.Ltext0
+	.byte	0
+.LLRL193:
+	.byte	0x4
+	.uleb128 .LBB1998-.Ltext0
+	.uleb128 .LBE1998-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB2009-.Ltext0
+	.uleb128 .LBE2009-.Ltext0
+	.byte	0
+.LLRL195:
+	.byte	0x4
+	.uleb128 .LBB2002-.Ltext0
+	.uleb128 .LBE2002-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB2008-.Ltext0
+	.uleb128 .LBE2008-.Ltext0
+	.byte	0
+.LLRL199:
+	.byte	0x4
+	.uleb128 .LBB2020-.Ltext0
+	.uleb128 .LBE2020-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB2162-.Ltext0
+	.uleb128 .LBE2162-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB2164-.Ltext0
+	.uleb128 .LBE2164-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB2166-.Ltext0
+	.uleb128 .LBE2166-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB2168-.Ltext0
+	.uleb128 .LBE2168-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB2170-.Ltext0
+	.uleb128 .LBE2170-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB2312-.Ltext0
+	.uleb128 .LBE2312-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB2314-.Ltext0
+	.uleb128 .LBE2314-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB2316-.Ltext0
+	.uleb128 .LBE2316-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB2318-.Ltext0
+	.uleb128 .LBE2318-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB2320-.Ltext0
+	.uleb128 .LBE2320-.Ltext0
+	.byte	0
+.LLRL200:
+	.byte	0x4
+	.uleb128 .LBB2021-.Ltext0
+	.uleb128 .LBE2021-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB2025-.Ltext0
+	.uleb128 .LBE2025-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB2044-.Ltext0
+	.uleb128 .LBE2044-.Ltext0
+	.byte	0
+.LLRL203:
+	.byte	0x4
+	.uleb128 .LBB2026-.Ltext0
+	.uleb128 .LBE2026-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB2047-.Ltext0
+	.uleb128 .LBE2047-.Ltext0
+	.byte	0
+.LLRL204:
+	.byte	0x4
+	.uleb128 .LBB2029-.Ltext0
+	.uleb128 .LBE2029-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB2048-.Ltext0
+	.uleb128 .LBE2048-.Ltext0
+	.byte	0
+.LLRL206:
+	.byte	0x4
+	.uleb128 .LBB2032-.Ltext0
+	.uleb128 .LBE2032-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB2036-.Ltext0
+	.uleb128 .LBE2036-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB2043-.Ltext0
+	.uleb128 .LBE2043-.Ltext0
+	.byte	0
+.LLRL209:
+	.byte	0x4
+	.uleb128 .LBB2037-.Ltext0
+	.uleb128 .LBE2037-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB2045-.Ltext0
+	.uleb128 .LBE2045-.Ltext0
+	.byte	0
+.LLRL210:
+	.byte	0x4
+	.uleb128 .LBB2040-.Ltext0
+	.uleb128 .LBE2040-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB2046-.Ltext0
+	.uleb128 .LBE2046-.Ltext0
+	.byte	0
+.LLRL214:
+	.byte	0x4
+	.uleb128 .LBB2053-.Ltext0
+	.uleb128 .LBE2053-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB2059-.Ltext0
+	.uleb128 .LBE2059-.Ltext0
+	.byte	0
+.LLRL217:
+	.byte	0x4
+	.uleb128 .LBB2056-.Ltext0
+	.uleb128 .LBE2056-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB2060-.Ltext0
+	.uleb128 .LBE2060-.Ltext0
+	.byte	0
+.LLRL220:
+	.byte	0x4
+	.uleb128 .LBB2061-.Ltext0
+	.uleb128 .LBE2061-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB2064-.Ltext0
+	.uleb128 .LBE2064-.Ltext0
+	.byte	0
+.LLRL223:
+	.byte	0x4
+	.uleb128 .LBB2065-.Ltext0
+	.uleb128 .LBE2065-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB2071-.Ltext0
+	.uleb128 .LBE2071-.Ltext0
+	.byte	0
+.LLRL226:
+	.byte	0x4
+	.uleb128 .LBB2068-.Ltext0
+	.uleb128 .LBE2068-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB2072-.Ltext0
+	.uleb128 .LBE2072-.Ltext0
+	.byte	0
+.LLRL232:
+	.byte	0x4
+	.uleb128 .LBB2077-.Ltext0
+	.uleb128 .LBE2077-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB2083-.Ltext0
+	.uleb128 .LBE2083-.Ltext0
+	.byte	0
+.LLRL235:
+	.byte	0x4
+	.uleb128 .LBB2080-.Ltext0
+	.uleb128 .LBE2080-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB2084-.Ltext0
+	.uleb128 .LBE2084-.Ltext0
+	.byte	0
+.LLRL240:
+	.byte	0x4
+	.uleb128 .LBB2087-.Ltext0
+	.uleb128 .LBE2087-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB2096-.Ltext0
+	.uleb128 .LBE2096-.Ltext0
+	.byte	0
+.LLRL243:
+	.byte	0x4
+	.uleb128 .LBB2090-.Ltext0
+	.uleb128 .LBE2090-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB2100-.Ltext0
+	.uleb128 .LBE2100-.Ltext0
+	.byte	0
+.LLRL246:
+	.byte	0x4
+	.uleb128 .LBB2093-.Ltext0
+	.uleb128 .LBE2093-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB2104-.Ltext0
+	.uleb128 .LBE2104-.Ltext0
+	.byte	0
+.LLRL248:
+	.byte	0x4
+	.uleb128 .LBB2097-.Ltext0
+	.uleb128 .LBE2097-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB2103-.Ltext0
+	.uleb128 .LBE2103-.Ltext0
+	.byte	0
+.LLRL254:
+	.byte	0x4
+	.uleb128 .LBB2109-.Ltext0
+	.uleb128 .LBE2109-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB2115-.Ltext0
+	.uleb128 .LBE2115-.Ltext0
+	.byte	0
+.LLRL257:
+	.byte	0x4
+	.uleb128 .LBB2112-.Ltext0
+	.uleb128 .LBE2112-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB2116-.Ltext0
+	.uleb128 .LBE2116-.Ltext0
+	.byte	0
+.LLRL262:
+	.byte	0x4
+	.uleb128 .LBB2119-.Ltext0
+	.uleb128 .LBE2119-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB2125-.Ltext0
+	.uleb128 .LBE2125-.Ltext0
+	.byte	0
+.LLRL265:
+	.byte	0x4
+	.uleb128 .LBB2122-.Ltext0
+	.uleb128 .LBE2122-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB2126-.Ltext0
+	.uleb128 .LBE2126-.Ltext0
+	.byte	0
+.LLRL271:
+	.byte	0x4
+	.uleb128 .LBB2131-.Ltext0
+	.uleb128 .LBE2131-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB2137-.Ltext0
+	.uleb128 .LBE2137-.Ltext0
+	.byte	0
+.LLRL274:
+	.byte	0x4
+	.uleb128 .LBB2134-.Ltext0
+	.uleb128 .LBE2134-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB2138-.Ltext0
+	.uleb128 .LBE2138-.Ltext0
+	.byte	0
+.LLRL277:
+	.byte	0x4
+	.uleb128 .LBB2139-.Ltext0
+	.uleb128 .LBE2139-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB2142-.Ltext0
+	.uleb128 .LBE2142-.Ltext0
+	.byte	0
+.LLRL280:
+	.byte	0x4
+	.uleb128 .LBB2143-.Ltext0
+	.uleb128 .LBE2143-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB2152-.Ltext0
+	.uleb128 .LBE2152-.Ltext0
+	.byte	0
+.LLRL283:
+	.byte	0x4
+	.uleb128 .LBB2146-.Ltext0
+	.uleb128 .LBE2146-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB2156-.Ltext0
+	.uleb128 .LBE2156-.Ltext0
+	.byte	0
+.LLRL286:
+	.byte	0x4
+	.uleb128 .LBB2149-.Ltext0
+	.uleb128 .LBE2149-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB2160-.Ltext0
+	.uleb128 .LBE2160-.Ltext0
+	.byte	0
+.LLRL288:
+	.byte	0x4
+	.uleb128 .LBB2153-.Ltext0
+	.uleb128 .LBE2153-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB2159-.Ltext0
+	.uleb128 .LBE2159-.Ltext0
+	.byte	0
+.LLRL292:
+	.byte	0x4
+	.uleb128 .LBB2171-.Ltext0
+	.uleb128 .LBE2171-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB2313-.Ltext0
+	.uleb128 .LBE2313-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB2315-.Ltext0
+	.uleb128 .LBE2315-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB2317-.Ltext0
+	.uleb128 .LBE2317-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB2319-.Ltext0
+	.uleb128 .LBE2319-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB2321-.Ltext0
+	.uleb128 .LBE2321-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB2463-.Ltext0
+	.uleb128 .LBE2463-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB2465-.Ltext0
+	.uleb128 .LBE2465-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB2467-.Ltext0
+	.uleb128 .LBE2467-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB2469-.Ltext0
+	.uleb128 .LBE2469-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB2471-.Ltext0
+	.uleb128 .LBE2471-.Ltext0
+	.byte	0
+.LLRL293:
+	.byte	0x4
+	.uleb128 .LBB2172-.Ltext0
+	.uleb128 .LBE2172-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB2176-.Ltext0
+	.uleb128 .LBE2176-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB2195-.Ltext0
+	.uleb128 .LBE2195-.Ltext0
+	.byte	0
+.LLRL296:
+	.byte	0x4
+	.uleb128 .LBB2177-.Ltext0
+	.uleb128 .LBE2177-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB2198-.Ltext0
+	.uleb128 .LBE2198-.Ltext0
+	.byte	0
+.LLRL297:
+	.byte	0x4
+	.uleb128 .LBB2180-.Ltext0
+	.uleb128 .LBE2180-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB2199-.Ltext0
+	.uleb128 .LBE2199-.Ltext0
+	.byte	0
+.LLRL299:
+	.byte	0x4
+	.uleb128 .LBB2183-.Ltext0
+	.uleb128 .LBE2183-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB2187-.Ltext0
+	.uleb128 .LBE2187-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB2194-.Ltext0
+	.uleb128 .LBE2194-.Ltext0
+	.byte	0
+.LLRL302:
+	.byte	0x4
+	.uleb128 .LBB2188-.Ltext0
+	.uleb128 .LBE2188-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB2196-.Ltext0
+	.uleb128 .LBE2196-.Ltext0
+	.byte	0
+.LLRL303:
+	.byte	0x4
+	.uleb128 .LBB2191-.Ltext0
+	.uleb128 .LBE2191-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB2197-.Ltext0
+	.uleb128 .LBE2197-.Ltext0
+	.byte	0
+.LLRL307:
+	.byte	0x4
+	.uleb128 .LBB2204-.Ltext0
+	.uleb128 .LBE2204-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB2210-.Ltext0
+	.uleb128 .LBE2210-.Ltext0
+	.byte	0
+.LLRL310:
+	.byte	0x4
+	.uleb128 .LBB2207-.Ltext0
+	.uleb128 .LBE2207-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB2211-.Ltext0
+	.uleb128 .LBE2211-.Ltext0
+	.byte	0
+.LLRL313:
+	.byte	0x4
+	.uleb128 .LBB2212-.Ltext0
+	.uleb128 .LBE2212-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB2215-.Ltext0
+	.uleb128 .LBE2215-.Ltext0
+	.byte	0
+.LLRL316:
+	.byte	0x4
+	.uleb128 .LBB2216-.Ltext0
+	.uleb128 .LBE2216-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB2222-.Ltext0
+	.uleb128 .LBE2222-.Ltext0
+	.byte	0
+.LLRL319:
+	.byte	0x4
+	.uleb128 .LBB2219-.Ltext0
+	.uleb128 .LBE2219-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB2223-.Ltext0
+	.uleb128 .LBE2223-.Ltext0
+	.byte	0
+.LLRL325:
+	.byte	0x4
+	.uleb128 .LBB2228-.Ltext0
+	.uleb128 .LBE2228-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB2234-.Ltext0
+	.uleb128 .LBE2234-.Ltext0
+	.byte	0
+.LLRL328:
+	.byte	0x4
+	.uleb128 .LBB2231-.Ltext0
+	.uleb128 .LBE2231-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB2235-.Ltext0
+	.uleb128 .LBE2235-.Ltext0
+	.byte	0
+.LLRL333:
+	.byte	0x4
+	.uleb128 .LBB2238-.Ltext0
+	.uleb128 .LBE2238-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB2247-.Ltext0
+	.uleb128 .LBE2247-.Ltext0
+	.byte	0
+.LLRL336:
+	.byte	0x4
+	.uleb128 .LBB2241-.Ltext0
+	.uleb128 .LBE2241-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB2251-.Ltext0
+	.uleb128 .LBE2251-.Ltext0
+	.byte	0
+.LLRL339:
+	.byte	0x4
+	.uleb128 .LBB2244-.Ltext0
+	.uleb128 .LBE2244-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB2255-.Ltext0
+	.uleb128 .LBE2255-.Ltext0
+	.byte	0
+.LLRL341:
+	.byte	0x4
+	.uleb128 .LBB2248-.Ltext0
+	.uleb128 .LBE2248-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB2254-.Ltext0
+	.uleb128 .LBE2254-.Ltext0
+	.byte	0
+.LLRL347:
+	.byte	0x4
+	.uleb128 .LBB2260-.Ltext0
+	.uleb128 .LBE2260-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB2266-.Ltext0
+	.uleb128 .LBE2266-.Ltext0
+	.byte	0
+.LLRL350:
+	.byte	0x4
+	.uleb128 .LBB2263-.Ltext0
+	.uleb128 .LBE2263-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB2267-.Ltext0
+	.uleb128 .LBE2267-.Ltext0
+	.byte	0
+.LLRL355:
+	.byte	0x4
+	.uleb128 .LBB2270-.Ltext0
+	.uleb128 .LBE2270-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB2276-.Ltext0
+	.uleb128 .LBE2276-.Ltext0
+	.byte	0
+.LLRL358:
+	.byte	0x4
+	.uleb128 .LBB2273-.Ltext0
+	.uleb128 .LBE2273-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB2277-.Ltext0
+	.uleb128 .LBE2277-.Ltext0
+	.byte	0
+.LLRL364:
+	.byte	0x4
+	.uleb128 .LBB2282-.Ltext0
+	.uleb128 .LBE2282-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB2288-.Ltext0
+	.uleb128 .LBE2288-.Ltext0
+	.byte	0
+.LLRL367:
+	.byte	0x4
+	.uleb128 .LBB2285-.Ltext0
+	.uleb128 .LBE2285-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB2289-.Ltext0
+	.uleb128 .LBE2289-.Ltext0
+	.byte	0
+.LLRL370:
+	.byte	0x4
+	.uleb128 .LBB2290-.Ltext0
+	.uleb128 .LBE2290-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB2293-.Ltext0
+	.uleb128 .LBE2293-.Ltext0
+	.byte	0
+.LLRL373:
+	.byte	0x4
+	.uleb128 .LBB2294-.Ltext0
+	.uleb128 .LBE2294-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB2303-.Ltext0
+	.uleb128 .LBE2303-.Ltext0
+	.byte	0
+.LLRL376:
+	.byte	0x4
+	.uleb128 .LBB2297-.Ltext0
+	.uleb128 .LBE2297-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB2307-.Ltext0
+	.uleb128 .LBE2307-.Ltext0
+	.byte	0
+.LLRL379:
+	.byte	0x4
+	.uleb128 .LBB2300-.Ltext0
+	.uleb128 .LBE2300-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB2311-.Ltext0
+	.uleb128 .LBE2311-.Ltext0
+	.byte	0
+.LLRL381:
+	.byte	0x4
+	.uleb128 .LBB2304-.Ltext0
+	.uleb128 .LBE2304-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB2310-.Ltext0
+	.uleb128 .LBE2310-.Ltext0
+	.byte	0
+.LLRL385:
+	.byte	0x4
+	.uleb128 .LBB2322-.Ltext0
+	.uleb128 .LBE2322-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB2464-.Ltext0
+	.uleb128 .LBE2464-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB2466-.Ltext0
+	.uleb128 .LBE2466-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB2468-.Ltext0
+	.uleb128 .LBE2468-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB2470-.Ltext0
+	.uleb128 .LBE2470-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB2472-.Ltext0
+	.uleb128 .LBE2472-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB2614-.Ltext0
+	.uleb128 .LBE2614-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB2616-.Ltext0
+	.uleb128 .LBE2616-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB2618-.Ltext0
+	.uleb128 .LBE2618-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB2620-.Ltext0
+	.uleb128 .LBE2620-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB2622-.Ltext0
+	.uleb128 .LBE2622-.Ltext0
+	.byte	0
+.LLRL386:
+	.byte	0x4
+	.uleb128 .LBB2323-.Ltext0
+	.uleb128 .LBE2323-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB2327-.Ltext0
+	.uleb128 .LBE2327-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB2346-.Ltext0
+	.uleb128 .LBE2346-.Ltext0
+	.byte	0
+.LLRL389:
+	.byte	0x4
+	.uleb128 .LBB2328-.Ltext0
+	.uleb128 .LBE2328-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB2349-.Ltext0
+	.uleb128 .LBE2349-.Ltext0
+	.byte	0
+.LLRL390:
+	.byte	0x4
+	.uleb128 .LBB2331-.Ltext0
+	.uleb128 .LBE2331-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB2350-.Ltext0
+	.uleb128 .LBE2350-.Ltext0
+	.byte	0
+.LLRL392:
+	.byte	0x4
+	.uleb128 .LBB2334-.Ltext0
+	.uleb128 .LBE2334-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB2338-.Ltext0
+	.uleb128 .LBE2338-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB2345-.Ltext0
+	.uleb128 .LBE2345-.Ltext0
+	.byte	0
+.LLRL395:
+	.byte	0x4
+	.uleb128 .LBB2339-.Ltext0
+	.uleb128 .LBE2339-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB2347-.Ltext0
+	.uleb128 .LBE2347-.Ltext0
+	.byte	0
+.LLRL396:
+	.byte	0x4
+	.uleb128 .LBB2342-.Ltext0
+	.uleb128 .LBE2342-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB2348-.Ltext0
+	.uleb128 .LBE2348-.Ltext0
+	.byte	0
+.LLRL400:
+	.byte	0x4
+	.uleb128 .LBB2355-.Ltext0
+	.uleb128 .LBE2355-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB2361-.Ltext0
+	.uleb128 .LBE2361-.Ltext0
+	.byte	0
+.LLRL403:
+	.byte	0x4
+	.uleb128 .LBB2358-.Ltext0
+	.uleb128 .LBE2358-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB2362-.Ltext0
+	.uleb128 .LBE2362-.Ltext0
+	.byte	0
+.LLRL406:
+	.byte	0x4
+	.uleb128 .LBB2363-.Ltext0
+	.uleb128 .LBE2363-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB2366-.Ltext0
+	.uleb128 .LBE2366-.Ltext0
+	.byte	0
+.LLRL409:
+	.byte	0x4
+	.uleb128 .LBB2367-.Ltext0
+	.uleb128 .LBE2367-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB2373-.Ltext0
+	.uleb128 .LBE2373-.Ltext0
+	.byte	0
+.LLRL412:
+	.byte	0x4
+	.uleb128 .LBB2370-.Ltext0
+	.uleb128 .LBE2370-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB2374-.Ltext0
+	.uleb128 .LBE2374-.Ltext0
+	.byte	0
+.LLRL418:
+	.byte	0x4
+	.uleb128 .LBB2379-.Ltext0
+	.uleb128 .LBE2379-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB2385-.Ltext0
+	.uleb128 .LBE2385-.Ltext0
+	.byte	0
+.LLRL421:
+	.byte	0x4
+	.uleb128 .LBB2382-.Ltext0
+	.uleb128 .LBE2382-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB2386-.Ltext0
+	.uleb128 .LBE2386-.Ltext0
+	.byte	0
+.LLRL426:
+	.byte	0x4
+	.uleb128 .LBB2389-.Ltext0
+	.uleb128 .LBE2389-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB2398-.Ltext0
+	.uleb128 .LBE2398-.Ltext0
+	.byte	0
+.LLRL429:
+	.byte	0x4
+	.uleb128 .LBB2392-.Ltext0
+	.uleb128 .LBE2392-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB2402-.Ltext0
+	.uleb128 .LBE2402-.Ltext0
+	.byte	0
+.LLRL432:
+	.byte	0x4
+	.uleb128 .LBB2395-.Ltext0
+	.uleb128 .LBE2395-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB2406-.Ltext0
+	.uleb128 .LBE2406-.Ltext0
+	.byte	0
+.LLRL434:
+	.byte	0x4
+	.uleb128 .LBB2399-.Ltext0
+	.uleb128 .LBE2399-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB2405-.Ltext0
+	.uleb128 .LBE2405-.Ltext0
+	.byte	0
+.LLRL440:
+	.byte	0x4
+	.uleb128 .LBB2411-.Ltext0
+	.uleb128 .LBE2411-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB2417-.Ltext0
+	.uleb128 .LBE2417-.Ltext0
+	.byte	0
+.LLRL443:
+	.byte	0x4
+	.uleb128 .LBB2414-.Ltext0
+	.uleb128 .LBE2414-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB2418-.Ltext0
+	.uleb128 .LBE2418-.Ltext0
+	.byte	0
+.LLRL448:
+	.byte	0x4
+	.uleb128 .LBB2421-.Ltext0
+	.uleb128 .LBE2421-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB2427-.Ltext0
+	.uleb128 .LBE2427-.Ltext0
+	.byte	0
+.LLRL451:
+	.byte	0x4
+	.uleb128 .LBB2424-.Ltext0
+	.uleb128 .LBE2424-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB2428-.Ltext0
+	.uleb128 .LBE2428-.Ltext0
+	.byte	0
+.LLRL457:
+	.byte	0x4
+	.uleb128 .LBB2433-.Ltext0
+	.uleb128 .LBE2433-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB2439-.Ltext0
+	.uleb128 .LBE2439-.Ltext0
+	.byte	0
+.LLRL460:
+	.byte	0x4
+	.uleb128 .LBB2436-.Ltext0
+	.uleb128 .LBE2436-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB2440-.Ltext0
+	.uleb128 .LBE2440-.Ltext0
+	.byte	0
+.LLRL463:
+	.byte	0x4
+	.uleb128 .LBB2441-.Ltext0
+	.uleb128 .LBE2441-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB2444-.Ltext0
+	.uleb128 .LBE2444-.Ltext0
+	.byte	0
+.LLRL466:
+	.byte	0x4
+	.uleb128 .LBB2445-.Ltext0
+	.uleb128 .LBE2445-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB2454-.Ltext0
+	.uleb128 .LBE2454-.Ltext0
+	.byte	0
+.LLRL469:
+	.byte	0x4
+	.uleb128 .LBB2448-.Ltext0
+	.uleb128 .LBE2448-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB2458-.Ltext0
+	.uleb128 .LBE2458-.Ltext0
+	.byte	0
+.LLRL472:
+	.byte	0x4
+	.uleb128 .LBB2451-.Ltext0
+	.uleb128 .LBE2451-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB2462-.Ltext0
+	.uleb128 .LBE2462-.Ltext0
+	.byte	0
+.LLRL474:
+	.byte	0x4
+	.uleb128 .LBB2455-.Ltext0
+	.uleb128 .LBE2455-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB2461-.Ltext0
+	.uleb128 .LBE2461-.Ltext0
+	.byte	0
+.LLRL478:
+	.byte	0x4
+	.uleb128 .LBB2473-.Ltext0
+	.uleb128 .LBE2473-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB2615-.Ltext0
+	.uleb128 .LBE2615-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB2617-.Ltext0
+	.uleb128 .LBE2617-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB2619-.Ltext0
+	.uleb128 .LBE2619-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB2621-.Ltext0
+	.uleb128 .LBE2621-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB2623-.Ltext0
+	.uleb128 .LBE2623-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB2765-.Ltext0
+	.uleb128 .LBE2765-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB2767-.Ltext0
+	.uleb128 .LBE2767-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB2769-.Ltext0
+	.uleb128 .LBE2769-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB2771-.Ltext0
+	.uleb128 .LBE2771-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB2773-.Ltext0
+	.uleb128 .LBE2773-.Ltext0
+	.byte	0
+.LLRL479:
+	.byte	0x4
+	.uleb128 .LBB2474-.Ltext0
+	.uleb128 .LBE2474-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB2478-.Ltext0
+	.uleb128 .LBE2478-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB2497-.Ltext0
+	.uleb128 .LBE2497-.Ltext0
+	.byte	0
+.LLRL482:
+	.byte	0x4
+	.uleb128 .LBB2479-.Ltext0
+	.uleb128 .LBE2479-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB2500-.Ltext0
+	.uleb128 .LBE2500-.Ltext0
+	.byte	0
+.LLRL483:
+	.byte	0x4
+	.uleb128 .LBB2482-.Ltext0
+	.uleb128 .LBE2482-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB2501-.Ltext0
+	.uleb128 .LBE2501-.Ltext0
+	.byte	0
+.LLRL485:
+	.byte	0x4
+	.uleb128 .LBB2485-.Ltext0
+	.uleb128 .LBE2485-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB2489-.Ltext0
+	.uleb128 .LBE2489-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB2496-.Ltext0
+	.uleb128 .LBE2496-.Ltext0
+	.byte	0
+.LLRL488:
+	.byte	0x4
+	.uleb128 .LBB2490-.Ltext0
+	.uleb128 .LBE2490-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB2498-.Ltext0
+	.uleb128 .LBE2498-.Ltext0
+	.byte	0
+.LLRL489:
+	.byte	0x4
+	.uleb128 .LBB2493-.Ltext0
+	.uleb128 .LBE2493-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB2499-.Ltext0
+	.uleb128 .LBE2499-.Ltext0
+	.byte	0
+.LLRL493:
+	.byte	0x4
+	.uleb128 .LBB2506-.Ltext0
+	.uleb128 .LBE2506-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB2512-.Ltext0
+	.uleb128 .LBE2512-.Ltext0
+	.byte	0
+.LLRL496:
+	.byte	0x4
+	.uleb128 .LBB2509-.Ltext0
+	.uleb128 .LBE2509-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB2513-.Ltext0
+	.uleb128 .LBE2513-.Ltext0
+	.byte	0
+.LLRL499:
+	.byte	0x4
+	.uleb128 .LBB2514-.Ltext0
+	.uleb128 .LBE2514-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB2517-.Ltext0
+	.uleb128 .LBE2517-.Ltext0
+	.byte	0
+.LLRL502:
+	.byte	0x4
+	.uleb128 .LBB2518-.Ltext0
+	.uleb128 .LBE2518-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB2524-.Ltext0
+	.uleb128 .LBE2524-.Ltext0
+	.byte	0
+.LLRL505:
+	.byte	0x4
+	.uleb128 .LBB2521-.Ltext0
+	.uleb128 .LBE2521-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB2525-.Ltext0
+	.uleb128 .LBE2525-.Ltext0
+	.byte	0
+.LLRL511:
+	.byte	0x4
+	.uleb128 .LBB2530-.Ltext0
+	.uleb128 .LBE2530-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB2536-.Ltext0
+	.uleb128 .LBE2536-.Ltext0
+	.byte	0
+.LLRL514:
+	.byte	0x4
+	.uleb128 .LBB2533-.Ltext0
+	.uleb128 .LBE2533-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB2537-.Ltext0
+	.uleb128 .LBE2537-.Ltext0
+	.byte	0
+.LLRL519:
+	.byte	0x4
+	.uleb128 .LBB2540-.Ltext0
+	.uleb128 .LBE2540-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB2549-.Ltext0
+	.uleb128 .LBE2549-.Ltext0
+	.byte	0
+.LLRL522:
+	.byte	0x4
+	.uleb128 .LBB2543-.Ltext0
+	.uleb128 .LBE2543-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB2553-.Ltext0
+	.uleb128 .LBE2553-.Ltext0
+	.byte	0
+.LLRL525:
+	.byte	0x4
+	.uleb128 .LBB2546-.Ltext0
+	.uleb128 .LBE2546-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB2557-.Ltext0
+	.uleb128 .LBE2557-.Ltext0
+	.byte	0
+.LLRL527:
+	.byte	0x4
+	.uleb128 .LBB2550-.Ltext0
+	.uleb128 .LBE2550-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB2556-.Ltext0
+	.uleb128 .LBE2556-.Ltext0
+	.byte	0
+.LLRL533:
+	.byte	0x4
+	.uleb128 .LBB2562-.Ltext0
+	.uleb128 .LBE2562-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB2568-.Ltext0
+	.uleb128 .LBE2568-.Ltext0
+	.byte	0
+.LLRL536:
+	.byte	0x4
+	.uleb128 .LBB2565-.Ltext0
+	.uleb128 .LBE2565-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB2569-.Ltext0
+	.uleb128 .LBE2569-.Ltext0
+	.byte	0
+.LLRL541:
+	.byte	0x4
+	.uleb128 .LBB2572-.Ltext0
+	.uleb128 .LBE2572-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB2578-.Ltext0
+	.uleb128 .LBE2578-.Ltext0
+	.byte	0
+.LLRL544:
+	.byte	0x4
+	.uleb128 .LBB2575-.Ltext0
+	.uleb128 .LBE2575-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB2579-.Ltext0
+	.uleb128 .LBE2579-.Ltext0
+	.byte	0
+.LLRL550:
+	.byte	0x4
+	.uleb128 .LBB2584-.Ltext0
+	.uleb128 .LBE2584-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB2590-.Ltext0
+	.uleb128 .LBE2590-.Ltext0
+	.byte	0
+.LLRL553:
+	.byte	0x4
+	.uleb128 .LBB2587-.Ltext0
+	.uleb128 .LBE2587-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB2591-.Ltext0
+	.uleb128 .LBE2591-.Ltext0
+	.byte	0
+.LLRL556:
+	.byte	0x4
+	.uleb128 .LBB2592-.Ltext0
+	.uleb128 .LBE2592-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB2595-.Ltext0
+	.uleb128 .LBE2595-.Ltext0
+	.byte	0
+.LLRL559:
+	.byte	0x4
+	.uleb128 .LBB2596-.Ltext0
+	.uleb128 .LBE2596-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB2605-.Ltext0
+	.uleb128 .LBE2605-.Ltext0
+	.byte	0
+.LLRL562:
+	.byte	0x4
+	.uleb128 .LBB2599-.Ltext0
+	.uleb128 .LBE2599-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB2609-.Ltext0
+	.uleb128 .LBE2609-.Ltext0
+	.byte	0
+.LLRL565:
+	.byte	0x4
+	.uleb128 .LBB2602-.Ltext0
+	.uleb128 .LBE2602-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB2613-.Ltext0
+	.uleb128 .LBE2613-.Ltext0
+	.byte	0
+.LLRL567:
+	.byte	0x4
+	.uleb128 .LBB2606-.Ltext0
+	.uleb128 .LBE2606-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB2612-.Ltext0
+	.uleb128 .LBE2612-.Ltext0
+	.byte	0
+.LLRL571:
+	.byte	0x4
+	.uleb128 .LBB2624-.Ltext0
+	.uleb128 .LBE2624-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB2766-.Ltext0
+	.uleb128 .LBE2766-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB2768-.Ltext0
+	.uleb128 .LBE2768-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB2770-.Ltext0
+	.uleb128 .LBE2770-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB2772-.Ltext0
+	.uleb128 .LBE2772-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB2774-.Ltext0
+	.uleb128 .LBE2774-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB2916-.Ltext0
+	.uleb128 .LBE2916-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB2918-.Ltext0
+	.uleb128 .LBE2918-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB2920-.Ltext0
+	.uleb128 .LBE2920-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB2922-.Ltext0
+	.uleb128 .LBE2922-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB2924-.Ltext0
+	.uleb128 .LBE2924-.Ltext0
+	.byte	0
+.LLRL572:
+	.byte	0x4
+	.uleb128 .LBB2625-.Ltext0
+	.uleb128 .LBE2625-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB2629-.Ltext0
+	.uleb128 .LBE2629-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB2648-.Ltext0
+	.uleb128 .LBE2648-.Ltext0
+	.byte	0
+.LLRL575:
+	.byte	0x4
+	.uleb128 .LBB2630-.Ltext0
+	.uleb128 .LBE2630-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB2651-.Ltext0
+	.uleb128 .LBE2651-.Ltext0
+	.byte	0
+.LLRL576:
+	.byte	0x4
+	.uleb128 .LBB2633-.Ltext0
+	.uleb128 .LBE2633-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB2652-.Ltext0
+	.uleb128 .LBE2652-.Ltext0
+	.byte	0
+.LLRL578:
+	.byte	0x4
+	.uleb128 .LBB2636-.Ltext0
+	.uleb128 .LBE2636-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB2640-.Ltext0
+	.uleb128 .LBE2640-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB2647-.Ltext0
+	.uleb128 .LBE2647-.Ltext0
+	.byte	0
+.LLRL581:
+	.byte	0x4
+	.uleb128 .LBB2641-.Ltext0
+	.uleb128 .LBE2641-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB2649-.Ltext0
+	.uleb128 .LBE2649-.Ltext0
+	.byte	0
+.LLRL582:
+	.byte	0x4
+	.uleb128 .LBB2644-.Ltext0
+	.uleb128 .LBE2644-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB2650-.Ltext0
+	.uleb128 .LBE2650-.Ltext0
+	.byte	0
+.LLRL586:
+	.byte	0x4
+	.uleb128 .LBB2657-.Ltext0
+	.uleb128 .LBE2657-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB2663-.Ltext0
+	.uleb128 .LBE2663-.Ltext0
+	.byte	0
+.LLRL589:
+	.byte	0x4
+	.uleb128 .LBB2660-.Ltext0
+	.uleb128 .LBE2660-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB2664-.Ltext0
+	.uleb128 .LBE2664-.Ltext0
+	.byte	0
+.LLRL592:
+	.byte	0x4
+	.uleb128 .LBB2665-.Ltext0
+	.uleb128 .LBE2665-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB2668-.Ltext0
+	.uleb128 .LBE2668-.Ltext0
+	.byte	0
+.LLRL595:
+	.byte	0x4
+	.uleb128 .LBB2669-.Ltext0
+	.uleb128 .LBE2669-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB2675-.Ltext0
+	.uleb128 .LBE2675-.Ltext0
+	.byte	0
+.LLRL598:
+	.byte	0x4
+	.uleb128 .LBB2672-.Ltext0
+	.uleb128 .LBE2672-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB2676-.Ltext0
+	.uleb128 .LBE2676-.Ltext0
+	.byte	0
+.LLRL604:
+	.byte	0x4
+	.uleb128 .LBB2681-.Ltext0
+	.uleb128 .LBE2681-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB2687-.Ltext0
+	.uleb128 .LBE2687-.Ltext0
+	.byte	0
+.LLRL607:
+	.byte	0x4
+	.uleb128 .LBB2684-.Ltext0
+	.uleb128 .LBE2684-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB2688-.Ltext0
+	.uleb128 .LBE2688-.Ltext0
+	.byte	0
+.LLRL612:
+	.byte	0x4
+	.uleb128 .LBB2691-.Ltext0
+	.uleb128 .LBE2691-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB2700-.Ltext0
+	.uleb128 .LBE2700-.Ltext0
+	.byte	0
+.LLRL615:
+	.byte	0x4
+	.uleb128 .LBB2694-.Ltext0
+	.uleb128 .LBE2694-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB2704-.Ltext0
+	.uleb128 .LBE2704-.Ltext0
+	.byte	0
+.LLRL618:
+	.byte	0x4
+	.uleb128 .LBB2697-.Ltext0
+	.uleb128 .LBE2697-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB2708-.Ltext0
+	.uleb128 .LBE2708-.Ltext0
+	.byte	0
+.LLRL620:
+	.byte	0x4
+	.uleb128 .LBB2701-.Ltext0
+	.uleb128 .LBE2701-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB2707-.Ltext0
+	.uleb128 .LBE2707-.Ltext0
+	.byte	0
+.LLRL626:
+	.byte	0x4
+	.uleb128 .LBB2713-.Ltext0
+	.uleb128 .LBE2713-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB2719-.Ltext0
+	.uleb128 .LBE2719-.Ltext0
+	.byte	0
+.LLRL629:
+	.byte	0x4
+	.uleb128 .LBB2716-.Ltext0
+	.uleb128 .LBE2716-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB2720-.Ltext0
+	.uleb128 .LBE2720-.Ltext0
+	.byte	0
+.LLRL634:
+	.byte	0x4
+	.uleb128 .LBB2723-.Ltext0
+	.uleb128 .LBE2723-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB2729-.Ltext0
+	.uleb128 .LBE2729-.Ltext0
+	.byte	0
+.LLRL637:
+	.byte	0x4
+	.uleb128 .LBB2726-.Ltext0
+	.uleb128 .LBE2726-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB2730-.Ltext0
+	.uleb128 .LBE2730-.Ltext0
+	.byte	0
+.LLRL643:
+	.byte	0x4
+	.uleb128 .LBB2735-.Ltext0
+	.uleb128 .LBE2735-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB2741-.Ltext0
+	.uleb128 .LBE2741-.Ltext0
+	.byte	0
+.LLRL646:
+	.byte	0x4
+	.uleb128 .LBB2738-.Ltext0
+	.uleb128 .LBE2738-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB2742-.Ltext0
+	.uleb128 .LBE2742-.Ltext0
+	.byte	0
+.LLRL649:
+	.byte	0x4
+	.uleb128 .LBB2743-.Ltext0
+	.uleb128 .LBE2743-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB2746-.Ltext0
+	.uleb128 .LBE2746-.Ltext0
+	.byte	0
+.LLRL652:
+	.byte	0x4
+	.uleb128 .LBB2747-.Ltext0
+	.uleb128 .LBE2747-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB2756-.Ltext0
+	.uleb128 .LBE2756-.Ltext0
+	.byte	0
+.LLRL655:
+	.byte	0x4
+	.uleb128 .LBB2750-.Ltext0
+	.uleb128 .LBE2750-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB2760-.Ltext0
+	.uleb128 .LBE2760-.Ltext0
+	.byte	0
+.LLRL658:
+	.byte	0x4
+	.uleb128 .LBB2753-.Ltext0
+	.uleb128 .LBE2753-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB2764-.Ltext0
+	.uleb128 .LBE2764-.Ltext0
+	.byte	0
+.LLRL660:
+	.byte	0x4
+	.uleb128 .LBB2757-.Ltext0
+	.uleb128 .LBE2757-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB2763-.Ltext0
+	.uleb128 .LBE2763-.Ltext0
+	.byte	0
+.LLRL664:
+	.byte	0x4
+	.uleb128 .LBB2775-.Ltext0
+	.uleb128 .LBE2775-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB2917-.Ltext0
+	.uleb128 .LBE2917-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB2919-.Ltext0
+	.uleb128 .LBE2919-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB2921-.Ltext0
+	.uleb128 .LBE2921-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB2923-.Ltext0
+	.uleb128 .LBE2923-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB2925-.Ltext0
+	.uleb128 .LBE2925-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB3067-.Ltext0
+	.uleb128 .LBE3067-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB3069-.Ltext0
+	.uleb128 .LBE3069-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB3071-.Ltext0
+	.uleb128 .LBE3071-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB3073-.Ltext0
+	.uleb128 .LBE3073-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB3075-.Ltext0
+	.uleb128 .LBE3075-.Ltext0
+	.byte	0
+.LLRL665:
+	.byte	0x4
+	.uleb128 .LBB2776-.Ltext0
+	.uleb128 .LBE2776-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB2780-.Ltext0
+	.uleb128 .LBE2780-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB2799-.Ltext0
+	.uleb128 .LBE2799-.Ltext0
+	.byte	0
+.LLRL668:
+	.byte	0x4
+	.uleb128 .LBB2781-.Ltext0
+	.uleb128 .LBE2781-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB2802-.Ltext0
+	.uleb128 .LBE2802-.Ltext0
+	.byte	0
+.LLRL669:
+	.byte	0x4
+	.uleb128 .LBB2784-.Ltext0
+	.uleb128 .LBE2784-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB2803-.Ltext0
+	.uleb128 .LBE2803-.Ltext0
+	.byte	0
+.LLRL671:
+	.byte	0x4
+	.uleb128 .LBB2787-.Ltext0
+	.uleb128 .LBE2787-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB2791-.Ltext0
+	.uleb128 .LBE2791-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB2798-.Ltext0
+	.uleb128 .LBE2798-.Ltext0
+	.byte	0
+.LLRL674:
+	.byte	0x4
+	.uleb128 .LBB2792-.Ltext0
+	.uleb128 .LBE2792-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB2800-.Ltext0
+	.uleb128 .LBE2800-.Ltext0
+	.byte	0
+.LLRL675:
+	.byte	0x4
+	.uleb128 .LBB2795-.Ltext0
+	.uleb128 .LBE2795-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB2801-.Ltext0
+	.uleb128 .LBE2801-.Ltext0
+	.byte	0
+.LLRL679:
+	.byte	0x4
+	.uleb128 .LBB2808-.Ltext0
+	.uleb128 .LBE2808-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB2814-.Ltext0
+	.uleb128 .LBE2814-.Ltext0
+	.byte	0
+.LLRL682:
+	.byte	0x4
+	.uleb128 .LBB2811-.Ltext0
+	.uleb128 .LBE2811-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB2815-.Ltext0
+	.uleb128 .LBE2815-.Ltext0
+	.byte	0
+.LLRL687:
+	.byte	0x4
+	.uleb128 .LBB2818-.Ltext0
+	.uleb128 .LBE2818-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB2824-.Ltext0
+	.uleb128 .LBE2824-.Ltext0
+	.byte	0
+.LLRL690:
+	.byte	0x4
+	.uleb128 .LBB2821-.Ltext0
+	.uleb128 .LBE2821-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB2825-.Ltext0
+	.uleb128 .LBE2825-.Ltext0
+	.byte	0
+.LLRL696:
+	.byte	0x4
+	.uleb128 .LBB2830-.Ltext0
+	.uleb128 .LBE2830-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB2836-.Ltext0
+	.uleb128 .LBE2836-.Ltext0
+	.byte	0
+.LLRL699:
+	.byte	0x4
+	.uleb128 .LBB2833-.Ltext0
+	.uleb128 .LBE2833-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB2837-.Ltext0
+	.uleb128 .LBE2837-.Ltext0
+	.byte	0
+.LLRL702:
+	.byte	0x4
+	.uleb128 .LBB2838-.Ltext0
+	.uleb128 .LBE2838-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB2841-.Ltext0
+	.uleb128 .LBE2841-.Ltext0
+	.byte	0
+.LLRL705:
+	.byte	0x4
+	.uleb128 .LBB2842-.Ltext0
+	.uleb128 .LBE2842-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB2851-.Ltext0
+	.uleb128 .LBE2851-.Ltext0
+	.byte	0
+.LLRL708:
+	.byte	0x4
+	.uleb128 .LBB2845-.Ltext0
+	.uleb128 .LBE2845-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB2855-.Ltext0
+	.uleb128 .LBE2855-.Ltext0
+	.byte	0
+.LLRL711:
+	.byte	0x4
+	.uleb128 .LBB2848-.Ltext0
+	.uleb128 .LBE2848-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB2859-.Ltext0
+	.uleb128 .LBE2859-.Ltext0
+	.byte	0
+.LLRL713:
+	.byte	0x4
+	.uleb128 .LBB2852-.Ltext0
+	.uleb128 .LBE2852-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB2858-.Ltext0
+	.uleb128 .LBE2858-.Ltext0
+	.byte	0
+.LLRL719:
+	.byte	0x4
+	.uleb128 .LBB2864-.Ltext0
+	.uleb128 .LBE2864-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB2870-.Ltext0
+	.uleb128 .LBE2870-.Ltext0
+	.byte	0
+.LLRL722:
+	.byte	0x4
+	.uleb128 .LBB2867-.Ltext0
+	.uleb128 .LBE2867-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB2871-.Ltext0
+	.uleb128 .LBE2871-.Ltext0
+	.byte	0
+.LLRL727:
+	.byte	0x4
+	.uleb128 .LBB2874-.Ltext0
+	.uleb128 .LBE2874-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB2880-.Ltext0
+	.uleb128 .LBE2880-.Ltext0
+	.byte	0
+.LLRL730:
+	.byte	0x4
+	.uleb128 .LBB2877-.Ltext0
+	.uleb128 .LBE2877-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB2881-.Ltext0
+	.uleb128 .LBE2881-.Ltext0
+	.byte	0
+.LLRL736:
+	.byte	0x4
+	.uleb128 .LBB2886-.Ltext0
+	.uleb128 .LBE2886-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB2892-.Ltext0
+	.uleb128 .LBE2892-.Ltext0
+	.byte	0
+.LLRL739:
+	.byte	0x4
+	.uleb128 .LBB2889-.Ltext0
+	.uleb128 .LBE2889-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB2893-.Ltext0
+	.uleb128 .LBE2893-.Ltext0
+	.byte	0
+.LLRL742:
+	.byte	0x4
+	.uleb128 .LBB2894-.Ltext0
+	.uleb128 .LBE2894-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB2897-.Ltext0
+	.uleb128 .LBE2897-.Ltext0
+	.byte	0
+.LLRL745:
+	.byte	0x4
+	.uleb128 .LBB2898-.Ltext0
+	.uleb128 .LBE2898-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB2907-.Ltext0
+	.uleb128 .LBE2907-.Ltext0
+	.byte	0
+.LLRL748:
+	.byte	0x4
+	.uleb128 .LBB2901-.Ltext0
+	.uleb128 .LBE2901-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB2911-.Ltext0
+	.uleb128 .LBE2911-.Ltext0
+	.byte	0
+.LLRL751:
+	.byte	0x4
+	.uleb128 .LBB2904-.Ltext0
+	.uleb128 .LBE2904-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB2915-.Ltext0
+	.uleb128 .LBE2915-.Ltext0
+	.byte	0
+.LLRL753:
+	.byte	0x4
+	.uleb128 .LBB2908-.Ltext0
+	.uleb128 .LBE2908-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB2914-.Ltext0
+	.uleb128 .LBE2914-.Ltext0
+	.byte	0
+.LLRL757:
+	.byte	0x4
+	.uleb128 .LBB2926-.Ltext0
+	.uleb128 .LBE2926-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB3068-.Ltext0
+	.uleb128 .LBE3068-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB3070-.Ltext0
+	.uleb128 .LBE3070-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB3072-.Ltext0
+	.uleb128 .LBE3072-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB3074-.Ltext0
+	.uleb128 .LBE3074-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB3076-.Ltext0
+	.uleb128 .LBE3076-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB3214-.Ltext0
+	.uleb128 .LBE3214-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB3216-.Ltext0
+	.uleb128 .LBE3216-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB3218-.Ltext0
+	.uleb128 .LBE3218-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB3220-.Ltext0
+	.uleb128 .LBE3220-.Ltext0
+	.byte	0
+.LLRL758:
+	.byte	0x4
+	.uleb128 .LBB2927-.Ltext0
+	.uleb128 .LBE2927-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB2931-.Ltext0
+	.uleb128 .LBE2931-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB2950-.Ltext0
+	.uleb128 .LBE2950-.Ltext0
+	.byte	0
+.LLRL761:
+	.byte	0x4
+	.uleb128 .LBB2932-.Ltext0
+	.uleb128 .LBE2932-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB2953-.Ltext0
+	.uleb128 .LBE2953-.Ltext0
+	.byte	0
+.LLRL762:
+	.byte	0x4
+	.uleb128 .LBB2935-.Ltext0
+	.uleb128 .LBE2935-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB2954-.Ltext0
+	.uleb128 .LBE2954-.Ltext0
+	.byte	0
+.LLRL764:
+	.byte	0x4
+	.uleb128 .LBB2938-.Ltext0
+	.uleb128 .LBE2938-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB2942-.Ltext0
+	.uleb128 .LBE2942-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB2949-.Ltext0
+	.uleb128 .LBE2949-.Ltext0
+	.byte	0
+.LLRL767:
+	.byte	0x4
+	.uleb128 .LBB2943-.Ltext0
+	.uleb128 .LBE2943-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB2951-.Ltext0
+	.uleb128 .LBE2951-.Ltext0
+	.byte	0
+.LLRL768:
+	.byte	0x4
+	.uleb128 .LBB2946-.Ltext0
+	.uleb128 .LBE2946-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB2952-.Ltext0
+	.uleb128 .LBE2952-.Ltext0
+	.byte	0
+.LLRL772:
+	.byte	0x4
+	.uleb128 .LBB2959-.Ltext0
+	.uleb128 .LBE2959-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB2965-.Ltext0
+	.uleb128 .LBE2965-.Ltext0
+	.byte	0
+.LLRL775:
+	.byte	0x4
+	.uleb128 .LBB2962-.Ltext0
+	.uleb128 .LBE2962-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB2966-.Ltext0
+	.uleb128 .LBE2966-.Ltext0
+	.byte	0
+.LLRL780:
+	.byte	0x4
+	.uleb128 .LBB2969-.Ltext0
+	.uleb128 .LBE2969-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB2975-.Ltext0
+	.uleb128 .LBE2975-.Ltext0
+	.byte	0
+.LLRL783:
+	.byte	0x4
+	.uleb128 .LBB2972-.Ltext0
+	.uleb128 .LBE2972-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB2976-.Ltext0
+	.uleb128 .LBE2976-.Ltext0
+	.byte	0
+.LLRL789:
+	.byte	0x4
+	.uleb128 .LBB2981-.Ltext0
+	.uleb128 .LBE2981-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB2987-.Ltext0
+	.uleb128 .LBE2987-.Ltext0
+	.byte	0
+.LLRL792:
+	.byte	0x4
+	.uleb128 .LBB2984-.Ltext0
+	.uleb128 .LBE2984-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB2988-.Ltext0
+	.uleb128 .LBE2988-.Ltext0
+	.byte	0
+.LLRL795:
+	.byte	0x4
+	.uleb128 .LBB2989-.Ltext0
+	.uleb128 .LBE2989-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB2992-.Ltext0
+	.uleb128 .LBE2992-.Ltext0
+	.byte	0
+.LLRL798:
+	.byte	0x4
+	.uleb128 .LBB2993-.Ltext0
+	.uleb128 .LBE2993-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB3002-.Ltext0
+	.uleb128 .LBE3002-.Ltext0
+	.byte	0
+.LLRL801:
+	.byte	0x4
+	.uleb128 .LBB2996-.Ltext0
+	.uleb128 .LBE2996-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB3006-.Ltext0
+	.uleb128 .LBE3006-.Ltext0
+	.byte	0
+.LLRL804:
+	.byte	0x4
+	.uleb128 .LBB2999-.Ltext0
+	.uleb128 .LBE2999-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB3010-.Ltext0
+	.uleb128 .LBE3010-.Ltext0
+	.byte	0
+.LLRL806:
+	.byte	0x4
+	.uleb128 .LBB3003-.Ltext0
+	.uleb128 .LBE3003-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB3009-.Ltext0
+	.uleb128 .LBE3009-.Ltext0
+	.byte	0
+.LLRL812:
+	.byte	0x4
+	.uleb128 .LBB3015-.Ltext0
+	.uleb128 .LBE3015-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB3021-.Ltext0
+	.uleb128 .LBE3021-.Ltext0
+	.byte	0
+.LLRL815:
+	.byte	0x4
+	.uleb128 .LBB3018-.Ltext0
+	.uleb128 .LBE3018-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB3022-.Ltext0
+	.uleb128 .LBE3022-.Ltext0
+	.byte	0
+.LLRL820:
+	.byte	0x4
+	.uleb128 .LBB3025-.Ltext0
+	.uleb128 .LBE3025-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB3031-.Ltext0
+	.uleb128 .LBE3031-.Ltext0
+	.byte	0
+.LLRL823:
+	.byte	0x4
+	.uleb128 .LBB3028-.Ltext0
+	.uleb128 .LBE3028-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB3032-.Ltext0
+	.uleb128 .LBE3032-.Ltext0
+	.byte	0
+.LLRL829:
+	.byte	0x4
+	.uleb128 .LBB3037-.Ltext0
+	.uleb128 .LBE3037-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB3043-.Ltext0
+	.uleb128 .LBE3043-.Ltext0
+	.byte	0
+.LLRL832:
+	.byte	0x4
+	.uleb128 .LBB3040-.Ltext0
+	.uleb128 .LBE3040-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB3044-.Ltext0
+	.uleb128 .LBE3044-.Ltext0
+	.byte	0
+.LLRL835:
+	.byte	0x4
+	.uleb128 .LBB3045-.Ltext0
+	.uleb128 .LBE3045-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB3048-.Ltext0
+	.uleb128 .LBE3048-.Ltext0
+	.byte	0
+.LLRL838:
+	.byte	0x4
+	.uleb128 .LBB3049-.Ltext0
+	.uleb128 .LBE3049-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB3058-.Ltext0
+	.uleb128 .LBE3058-.Ltext0
+	.byte	0
+.LLRL841:
+	.byte	0x4
+	.uleb128 .LBB3052-.Ltext0
+	.uleb128 .LBE3052-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB3062-.Ltext0
+	.uleb128 .LBE3062-.Ltext0
+	.byte	0
+.LLRL844:
+	.byte	0x4
+	.uleb128 .LBB3055-.Ltext0
+	.uleb128 .LBE3055-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB3066-.Ltext0
+	.uleb128 .LBE3066-.Ltext0
+	.byte	0
+.LLRL846:
+	.byte	0x4
+	.uleb128 .LBB3059-.Ltext0
+	.uleb128 .LBE3059-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB3065-.Ltext0
+	.uleb128 .LBE3065-.Ltext0
+	.byte	0
+.LLRL850:
+	.byte	0x4
+	.uleb128 .LBB3077-.Ltext0
+	.uleb128 .LBE3077-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB3215-.Ltext0
+	.uleb128 .LBE3215-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB3217-.Ltext0
+	.uleb128 .LBE3217-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB3219-.Ltext0
+	.uleb128 .LBE3219-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB3221-.Ltext0
+	.uleb128 .LBE3221-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB3225-.Ltext0
+	.uleb128 .LBE3225-.Ltext0
+	.byte	0
+.LLRL853:
+	.byte	0x4
+	.uleb128 .LBB3078-.Ltext0
+	.uleb128 .LBE3078-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB3082-.Ltext0
+	.uleb128 .LBE3082-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB3095-.Ltext0
+	.uleb128 .LBE3095-.Ltext0
+	.byte	0
+.LLRL854:
+	.byte	0x4
+	.uleb128 .LBB3083-.Ltext0
+	.uleb128 .LBE3083-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB3087-.Ltext0
+	.uleb128 .LBE3087-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB3094-.Ltext0
+	.uleb128 .LBE3094-.Ltext0
+	.byte	0
+.LLRL855:
+	.byte	0x4
+	.uleb128 .LBB3088-.Ltext0
+	.uleb128 .LBE3088-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB3101-.Ltext0
+	.uleb128 .LBE3101-.Ltext0
+	.byte	0
+.LLRL858:
+	.byte	0x4
+	.uleb128 .LBB3091-.Ltext0
+	.uleb128 .LBE3091-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB3098-.Ltext0
+	.uleb128 .LBE3098-.Ltext0
+	.byte	0
+.LLRL866:
+	.byte	0x4
+	.uleb128 .LBB3106-.Ltext0
+	.uleb128 .LBE3106-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB3112-.Ltext0
+	.uleb128 .LBE3112-.Ltext0
+	.byte	0
+.LLRL869:
+	.byte	0x4
+	.uleb128 .LBB3109-.Ltext0
+	.uleb128 .LBE3109-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB3113-.Ltext0
+	.uleb128 .LBE3113-.Ltext0
+	.byte	0
+.LLRL874:
+	.byte	0x4
+	.uleb128 .LBB3116-.Ltext0
+	.uleb128 .LBE3116-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB3122-.Ltext0
+	.uleb128 .LBE3122-.Ltext0
+	.byte	0
+.LLRL877:
+	.byte	0x4
+	.uleb128 .LBB3119-.Ltext0
+	.uleb128 .LBE3119-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB3123-.Ltext0
+	.uleb128 .LBE3123-.Ltext0
+	.byte	0
+.LLRL883:
+	.byte	0x4
+	.uleb128 .LBB3128-.Ltext0
+	.uleb128 .LBE3128-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB3134-.Ltext0
+	.uleb128 .LBE3134-.Ltext0
+	.byte	0
+.LLRL886:
+	.byte	0x4
+	.uleb128 .LBB3131-.Ltext0
+	.uleb128 .LBE3131-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB3135-.Ltext0
+	.uleb128 .LBE3135-.Ltext0
+	.byte	0
+.LLRL891:
+	.byte	0x4
+	.uleb128 .LBB3138-.Ltext0
+	.uleb128 .LBE3138-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB3147-.Ltext0
+	.uleb128 .LBE3147-.Ltext0
+	.byte	0
+.LLRL894:
+	.byte	0x4
+	.uleb128 .LBB3141-.Ltext0
+	.uleb128 .LBE3141-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB3151-.Ltext0
+	.uleb128 .LBE3151-.Ltext0
+	.byte	0
+.LLRL897:
+	.byte	0x4
+	.uleb128 .LBB3144-.Ltext0
+	.uleb128 .LBE3144-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB3155-.Ltext0
+	.uleb128 .LBE3155-.Ltext0
+	.byte	0
+.LLRL899:
+	.byte	0x4
+	.uleb128 .LBB3148-.Ltext0
+	.uleb128 .LBE3148-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB3154-.Ltext0
+	.uleb128 .LBE3154-.Ltext0
+	.byte	0
+.LLRL906:
+	.byte	0x4
+	.uleb128 .LBB3160-.Ltext0
+	.uleb128 .LBE3160-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB3166-.Ltext0
+	.uleb128 .LBE3166-.Ltext0
+	.byte	0
+.LLRL909:
+	.byte	0x4
+	.uleb128 .LBB3163-.Ltext0
+	.uleb128 .LBE3163-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB3167-.Ltext0
+	.uleb128 .LBE3167-.Ltext0
+	.byte	0
+.LLRL914:
+	.byte	0x4
+	.uleb128 .LBB3170-.Ltext0
+	.uleb128 .LBE3170-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB3176-.Ltext0
+	.uleb128 .LBE3176-.Ltext0
+	.byte	0
+.LLRL917:
+	.byte	0x4
+	.uleb128 .LBB3173-.Ltext0
+	.uleb128 .LBE3173-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB3177-.Ltext0
+	.uleb128 .LBE3177-.Ltext0
+	.byte	0
+.LLRL922:
+	.byte	0x4
+	.uleb128 .LBB3180-.Ltext0
+	.uleb128 .LBE3180-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB3186-.Ltext0
+	.uleb128 .LBE3186-.Ltext0
+	.byte	0
+.LLRL924:
+	.byte	0x4
+	.uleb128 .LBB3183-.Ltext0
+	.uleb128 .LBE3183-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB3190-.Ltext0
+	.uleb128 .LBE3190-.Ltext0
+	.byte	0
+.LLRL926:
+	.byte	0x4
+	.uleb128 .LBB3187-.Ltext0
+	.uleb128 .LBE3187-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB3191-.Ltext0
+	.uleb128 .LBE3191-.Ltext0
+	.byte	0
+.LLRL931:
+	.byte	0x4
+	.uleb128 .LBB3194-.Ltext0
+	.uleb128 .LBE3194-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB3203-.Ltext0
+	.uleb128 .LBE3203-.Ltext0
+	.byte	0
+.LLRL934:
+	.byte	0x4
+	.uleb128 .LBB3197-.Ltext0
+	.uleb128 .LBE3197-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB3207-.Ltext0
+	.uleb128 .LBE3207-.Ltext0
+	.byte	0
+.LLRL937:
+	.byte	0x4
+	.uleb128 .LBB3200-.Ltext0
+	.uleb128 .LBE3200-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB3213-.Ltext0
+	.uleb128 .LBE3213-.Ltext0
+	.byte	0
+.LLRL939:
+	.byte	0x4
+	.uleb128 .LBB3204-.Ltext0
+	.uleb128 .LBE3204-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB3212-.Ltext0
+	.uleb128 .LBE3212-.Ltext0
+	.byte	0
+.LLRL941:
+	.byte	0x4
+	.uleb128 .LBB3208-.Ltext0
+	.uleb128 .LBE3208-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB3211-.Ltext0
+	.uleb128 .LBE3211-.Ltext0
+	.byte	0
+.LLRL944:
+	.byte	0x4
+	.uleb128 .LBB3222-.Ltext0
+	.uleb128 .LBE3222-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB3228-.Ltext0
+	.uleb128 .LBE3228-.Ltext0
+	.byte	0
+.LLRL954:
+	.byte	0x4
+	.uleb128 .LBB3233-.Ltext0
+	.uleb128 .LBE3233-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB3236-.Ltext0
+	.uleb128 .LBE3236-.Ltext0
+	.byte	0
+.LLRL960:
+	.byte	0x4
+	.uleb128 .LBB3247-.Ltext0
+	.uleb128 .LBE3247-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB3253-.Ltext0
+	.uleb128 .LBE3253-.Ltext0
+	.byte	0
+.LLRL963:
+	.byte	0x4
+	.uleb128 .LBB3250-.Ltext0
+	.uleb128 .LBE3250-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB3254-.Ltext0
+	.uleb128 .LBE3254-.Ltext0
+	.byte	0
+.LLRL973:
+	.byte	0x4
+	.uleb128 .LBB3255-.Ltext0
+	.uleb128 .LBE3255-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB3258-.Ltext0
+	.uleb128 .LBE3258-.Ltext0
+	.byte	0
+.LLRL975:
+	.byte	0x4
+	.uleb128 .LBB3259-.Ltext0
+	.uleb128 .LBE3259-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB3299-.Ltext0
+	.uleb128 .LBE3299-.Ltext0
+	.byte	0
+.LLRL977:
+	.byte	0x4
+	.uleb128 .LBB3262-.Ltext0
+	.uleb128 .LBE3262-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB3303-.Ltext0
+	.uleb128 .LBE3303-.Ltext0
+	.byte	0
+.LLRL979:
+	.byte	0x4
+	.uleb128 .LBB3265-.Ltext0
+	.uleb128 .LBE3265-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB3304-.Ltext0
+	.uleb128 .LBE3304-.Ltext0
+	.byte	0
+.LLRL981:
+	.byte	0x4
+	.uleb128 .LBB3268-.Ltext0
+	.uleb128 .LBE3268-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB3300-.Ltext0
+	.uleb128 .LBE3300-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB3305-.Ltext0
+	.uleb128 .LBE3305-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB3306-.Ltext0
+	.uleb128 .LBE3306-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB3307-.Ltext0
+	.uleb128 .LBE3307-.Ltext0
+	.byte	0
+.LLRL984:
+	.byte	0x4
+	.uleb128 .LBB3269-.Ltext0
+	.uleb128 .LBE3269-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB3282-.Ltext0
+	.uleb128 .LBE3282-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB3290-.Ltext0
+	.uleb128 .LBE3290-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB3293-.Ltext0
+	.uleb128 .LBE3293-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB3296-.Ltext0
+	.uleb128 .LBE3296-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB3297-.Ltext0
+	.uleb128 .LBE3297-.Ltext0
+	.byte	0
+.LLRL985:
+	.byte	0x4
+	.uleb128 .LBB3276-.Ltext0
+	.uleb128 .LBE3276-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB3283-.Ltext0
+	.uleb128 .LBE3283-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB3294-.Ltext0
+	.uleb128 .LBE3294-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB3295-.Ltext0
+	.uleb128 .LBE3295-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB3298-.Ltext0
+	.uleb128 .LBE3298-.Ltext0
+	.byte	0
+.LLRL986:
+	.byte	0x4
+	.uleb128 .LBB3284-.Ltext0
+	.uleb128 .LBE3284-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB3291-.Ltext0
+	.uleb128 .LBE3291-.Ltext0
+	.byte	0
+.LLRL988:
+	.byte	0x4
+	.uleb128 .LBB3287-.Ltext0
+	.uleb128 .LBE3287-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB3292-.Ltext0
+	.uleb128 .LBE3292-.Ltext0
+	.byte	0
+.LLRL989:
+	.byte	0x4
+	.uleb128 .LBB3308-.Ltext0
+	.uleb128 .LBE3308-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB3317-.Ltext0
+	.uleb128 .LBE3317-.Ltext0
+	.byte	0
+.LLRL992:
+	.byte	0x4
+	.uleb128 .LBB3311-.Ltext0
+	.uleb128 .LBE3311-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB3318-.Ltext0
+	.uleb128 .LBE3318-.Ltext0
+	.byte	0
+.LLRL995:
+	.byte	0x4
+	.uleb128 .LBB3314-.Ltext0
+	.uleb128 .LBE3314-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB3319-.Ltext0
+	.uleb128 .LBE3319-.Ltext0
+	.byte	0
+.Ldebug_ranges3:
+	.section	.debug_line,"",@progbits
+.Ldebug_line0:
+	.section	.debug_str,"MS",@progbits,1
+.LASF33:
+	.string	"_Float16"
+.LASF52:
+	.string	"_mm_set_epi64x"
+.LASF46:
+	.string	"_mm_shuffle_epi32"
+.LASF43:
+	.string	"_mm256_castsi256_si128"
+.LASF10:
+	.string	"short int"
+.LASF8:
+	.string	"size_t"
+.LASF51:
+	.string	"_mm_load_si128"
+.LASF47:
+	.string	"__mask"
+.LASF11:
+	.string	"__uint32_t"
+.LASF30:
+	.string	"__v8si"
+.LASF31:
+	.string	"__m256i"
+.LASF22:
+	.string	"float"
+.LASF36:
+	.string	"nblocks"
+.LASF19:
+	.string	"long long int"
+.LASF39:
+	.string	"vinc"
+.LASF2:
+	.string	"long int"
+.LASF58:
+	.string	"blake2s_10rounds"
+.LASF45:
+	.string	"_mm256_load_si256"
+.LASF9:
+	.string	"__uint8_t"
+.LASF21:
+	.string	"blake2s_sigma"
+.LASF48:
+	.string	"_mm_xor_si128"
+.LASF4:
+	.string	"unsigned char"
+.LASF37:
+	.string	"blake2s_compress_blocks_avx512vl"
+.LASF20:
+	.string	"blake2s_iv"
+.LASF7:
+	.string	"signed char"
+.LASF18:
+	.string	"long long unsigned int"
+.LASF14:
+	.string	"uint32_t"
+.LASF57:
+	.string	"__m256i_u"
+.LASF6:
+	.string	"unsigned int"
+.LASF34:
+	.string	"blake2s_viv"
+.LASF54:
+	.string	"__q0"
+.LASF53:
+	.string	"__q1"
+.LASF12:
+	.string	"char"
+.LASF29:
+	.string	"__v4di"
+.LASF26:
+	.string	"__v4si"
+.LASF5:
+	.string	"short unsigned int"
+.LASF15:
+	.string	"buf_len"
+.LASF60:
+	.string	"_mm_store_si128"
+.LASF27:
+	.string	"__v4su"
+.LASF56:
+	.string	"blake2s_ctx"
+.LASF49:
+	.string	"_mm_add_epi64"
+.LASF42:
+	.string	"_mm256_extracti128_si256"
+.LASF3:
+	.string	"long unsigned int"
+.LASF38:
+	.string	"blake2s_compress_avx512vl"
+.LASF23:
+	.string	"double"
+.LASF16:
+	.string	"digest_len"
+.LASF44:
+	.string	"_mm256_loadu_si256"
+.LASF41:
+	.string	"_mm256_permutex2var_epi32"
+.LASF59:
+	.string	"_mm_setzero_si128"
+.LASF13:
+	.string	"uint8_t"
+.LASF35:
+	.string	"blake2s_vsigma"
+.LASF24:
+	.string	"__v2di"
+.LASF40:
+	.string	"_mm_ror_epi32"
+.LASF50:
+	.string	"_mm_add_epi32"
+.LASF28:
+	.string	"__m128i"
+.LASF25:
+	.string	"__v2du"
+.LASF55:
+	.string	"GNU C99 12.2.0 -mavx512f -mavx512vl -mtune=generic -march=x86-64 -g -O3 -std=c99 -fasynchronous-unwind-tables"
+.LASF32:
+	.string	"__mmask8"
+.LASF17:
+	.string	"last_node"
+	.section	.debug_line_str,"MS",@progbits,1
+.LASF0:
+	.string	"blake2s-avx512vl.c"
+.LASF1:
+	.string	"/root/repo"
+	.ident	"GCC: (Debian 12.2.0-14+deb12u1) 12.2.0"
+	.section	.note.GNU-stack,"",@progbits
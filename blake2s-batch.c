@@ -0,0 +1,225 @@
+#define _XOPEN_SOURCE 700
+
+#include <stdlib.h>
+#include <string.h>
+
+#include "blake2s.h"
+#include "blake2s-internal.h"
+
+/* Batch hashing of independent messages
+ *
+ * Messages go through the multi-buffer driver B2S_BATCH contexts at a
+ * time. Within a batch they are ordered by block count, so that the
+ * lanes of a kernel call mostly hold messages of the same length: they
+ * finish in the same call and the next ones join together, rather than
+ * one long message keeping a call going for a single lane.
+ * Lanes share nothing but the kernel call: parameters, key and digest
+ * length are in each context, so differently set up contexts mix freely.
+ */
+#define B2S_BATCH 128
+
+struct bbatch_key {
+    size_t blocks;
+    size_t i;
+};
+
+static int bbatch_cmp(const void *a, const void *b)
+{
+    const struct bbatch_key *x = a, *y = b;
+    if (x->blocks != y->blocks)
+        return x->blocks < y->blocks ? -1 : 1;
+    return x->i < y->i ? -1 : x->i > y->i;
+}
+
+/* bbatch_run: hash messages i to i+k-1 from their contexts, message j
+ * starting from ctx[j - base] */
+static void bbatch_run(struct blake2s_ctx *ctx, size_t base,
+                       unsigned char *const *outs, const void *const *srcs,
+                       const size_t *lens, size_t i, size_t k)
+{
+    struct blake2s_job job[B2S_BATCH];
+    struct bbatch_key key[B2S_BATCH];
+
+    for (size_t j = 0; j < k; j++) {
+        size_t len = ctx[i + j - base].buf_len + lens[i + j];
+        key[j].blocks = len ? (len - 1) / BLAKE2S_BLOCK + 1 : 1;
+        key[j].i = i + j;
+    }
+    qsort(key, k, sizeof(key[0]), bbatch_cmp);
+    for (size_t j = 0; j < k; j++) {
+        size_t at = key[j].i;
+        job[j].ctx = &ctx[at - base];
+        job[j].src = srcs[at];
+        job[j].len = lens[at];
+        job[j].out = outs[at];
+    }
+    blake2s_lanes_run(job, k);
+}
+
+void blake2s_many(unsigned char *const *outs, const void *const *srcs,
+                  const size_t *lens, size_t n)
+{
+    struct blake2s_ctx ctx[B2S_BATCH];
+
+    for (size_t i = 0; i < n; i += B2S_BATCH) {
+        size_t k = n - i < B2S_BATCH ? n - i : B2S_BATCH;
+        for (size_t j = 0; j < k; j++)
+            blake2s_init(&ctx[j]);
+        bbatch_run(ctx, i, outs, srcs, lens, i, k);
+    }
+}
+
+void blake2s_many_ctx(struct blake2s_ctx *ctx, unsigned char *const *outs,
+                      const void *const *srcs, const size_t *lens, size_t n)
+{
+    for (size_t i = 0; i < n; i += B2S_BATCH)
+        bbatch_run(ctx, 0, outs, srcs, lens, i,
+                   n - i < B2S_BATCH ? n - i : B2S_BATCH);
+}
+
+/* A held back full block is compressed once, into `next`, for all the
+ * messages that follow it with more data: only for an empty message is
+ * it the final block.
+ */
+void blake2s_many_suffix(const struct blake2s_ctx *prefix,
+                         unsigned char *const *outs, const void *const *srcs,
+                         const size_t *lens, size_t n)
+{
+    struct blake2s_ctx ctx[B2S_BATCH];
+    struct blake2s_ctx next = *prefix;
+
+    if (next.buf_len == BLAKE2S_BLOCK) {
+        next.t[0] += BLAKE2S_BLOCK;
+        next.t[1] += next.t[0] < BLAKE2S_BLOCK;
+        blake2s_compress(&next, next.buf);
+        next.buf_len = 0;
+    }
+    for (size_t i = 0; i < n; i += B2S_BATCH) {
+        size_t k = n - i < B2S_BATCH ? n - i : B2S_BATCH;
+        for (size_t j = 0; j < k; j++)
+            blake2s_clone(&ctx[j], lens[i + j] ? &next : prefix);
+        bbatch_run(ctx, i, outs, srcs, lens, i, k);
+    }
+    memset(&next, 0, sizeof(next));
+}
+
+/* Job manager
+ *
+ * The lane state stays transposed between calls: a context is loaded
+ * into a free lane when its job is submitted, and only stored back when
+ * the job completes. m[] holds the block each busy lane compresses in
+ * the next kernel call, picked as soon as the previous one is done.
+ */
+struct blake2s_mgr {
+    struct blake2s_lanes L;
+    const struct blake2s_kernel *kern;
+    unsigned width;
+    unsigned busy;                  /* lanes holding a job */
+    unsigned last;                  /* busy lanes on their final block */
+    const void *m[B2S_LANES_MAX];
+    struct blake2s_job lane[B2S_LANES_MAX];
+    struct blake2s_mgr_job *job[B2S_LANES_MAX];
+    struct blake2s_mgr_job *done, **done_tail;  /* oldest first */
+};
+
+struct blake2s_mgr *blake2s_mgr_new(void)
+{
+    void *p;
+    struct blake2s_mgr *M;
+
+    if (posix_memalign(&p, 64, sizeof(*M)))
+        return NULL;
+    M = p;
+    memset(M, 0, sizeof(*M));
+    M->kern = blake2s_kern;
+    M->width = M->kern->lanes;
+    M->done_tail = &M->done;
+    return M;
+}
+
+void blake2s_mgr_free(struct blake2s_mgr *M)
+{
+    if (!M)
+        return;
+    memset(&M->L, 0, sizeof(M->L));
+    free(M);
+}
+
+static void bmgr_complete(struct blake2s_mgr *M, unsigned l)
+{
+    struct blake2s_mgr_job *J = M->job[l];
+
+    blake2s_lane_retire(&M->L, l, &M->lane[l]);
+    M->busy &= ~(1u << l);
+    M->last &= ~(1u << l);
+    J->next = NULL;
+    *M->done_tail = J;
+    M->done_tail = &J->next;
+}
+
+/* bmgr_advance: pick the next block of lane `l`, or complete its job */
+static void bmgr_advance(struct blake2s_mgr *M, unsigned l)
+{
+    int last;
+    const void *p = blake2s_lane_next(&M->L, l, &M->lane[l], &last);
+
+    if (!p) {
+        bmgr_complete(M, l);
+        return;
+    }
+    M->m[l] = p;
+    if (last)
+        M->last |= 1u << l;
+}
+
+/* bmgr_step: one kernel call over the busy lanes */
+static void bmgr_step(struct blake2s_mgr *M)
+{
+    unsigned busy = M->busy;
+
+    M->kern->compress_lanes(&M->L, M->m, busy);
+    for (unsigned l = 0; l < M->width; l++) {
+        if (!(busy & (1u << l)))
+            continue;
+        if (M->last & (1u << l))
+            bmgr_complete(M, l);
+        else
+            bmgr_advance(M, l);
+    }
+}
+
+static struct blake2s_mgr_job *bmgr_pop(struct blake2s_mgr *M)
+{
+    struct blake2s_mgr_job *J = M->done;
+
+    if (J && !(M->done = J->next))
+        M->done_tail = &M->done;
+    return J;
+}
+
+struct blake2s_mgr_job *blake2s_mgr_submit(struct blake2s_mgr *M,
+                                           struct blake2s_mgr_job *job)
+{
+    unsigned full = (1u << M->width) - 1, l = 0;
+
+    while (M->busy == full)
+        bmgr_step(M);
+    while (M->busy & (1u << l))
+        l++;
+    M->job[l] = job;
+    M->lane[l].ctx = job->ctx;
+    M->lane[l].src = job->src;
+    M->lane[l].len = job->len;
+    M->lane[l].out = job->out;
+    blane_load(&M->L, l, job->ctx);
+    M->busy |= 1u << l;
+    bmgr_advance(M, l);
+    return bmgr_pop(M);
+}
+
+struct blake2s_mgr_job *blake2s_mgr_flush(struct blake2s_mgr *M)
+{
+    while (!M->done && M->busy)
+        bmgr_step(M);
+    return bmgr_pop(M);
+}
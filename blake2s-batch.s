@@ -0,0 +1,7213 @@
+	.file	"blake2s-batch.c"
+# GNU C99 (Debian 12.2.0-14+deb12u1) version 12.2.0 (x86_64-linux-gnu)
+#	compiled by GNU C version 12.2.0, GMP version 6.2.1, MPFR version 4.2.0, MPC version 1.3.1, isl version isl-0.25-GMP
+
+# GGC heuristics: --param ggc-min-expand=100 --param ggc-min-heapsize=131072
+# options passed: -mtune=generic -march=x86-64 -g -O3 -std=c99 -fasynchronous-unwind-tables
+	.text
+.Ltext0:
+	.file 0 "/root/repo" "blake2s-batch.c"
+	.p2align 4
+	.type	bbatch_run, @function
+bbatch_run:
+.LVL0:
+.LFB23:
+	.file 1 "blake2s-batch.c"
+	.loc 1 39 1 view -0
+	.cfi_startproc
+	.loc 1 40 5 view .LVU1
+	.loc 1 41 5 view .LVU2
+	.loc 1 43 5 view .LVU3
+.LBB14:
+	.loc 1 43 10 view .LVU4
+	.loc 1 43 26 view .LVU5
+.LBE14:
+# blake2s-batch.c:39: {
+	.loc 1 39 1 is_stmt 0 view .LVU6
+	pushq	%r15	#
+	.cfi_def_cfa_offset 16
+	.cfi_offset 15, -16
+	pushq	%r14	#
+	.cfi_def_cfa_offset 24
+	.cfi_offset 14, -24
+	movq	%r8, %r14	# tmp147, lens
+	pushq	%r13	#
+	.cfi_def_cfa_offset 32
+	.cfi_offset 13, -32
+	movq	%rcx, %r13	# tmp146, srcs
+	pushq	%r12	#
+	.cfi_def_cfa_offset 40
+	.cfi_offset 12, -40
+	movq	%rdx, %r12	# tmp145, outs
+	pushq	%rbp	#
+	.cfi_def_cfa_offset 48
+	.cfi_offset 6, -48
+	movq	%rsi, %rbp	# tmp144, base
+	pushq	%rbx	#
+	.cfi_def_cfa_offset 56
+	.cfi_offset 3, -56
+	movq	%rbp, %rax	# base, tmp126
+	movq	%rdi, %rbx	# tmp143, ctx
+	salq	$7, %rax	#, tmp126
+	movq	%rbx, %rcx	# ctx, _64
+.LVL1:
+	.loc 1 39 1 view .LVU7
+	subq	%rax, %rcx	# tmp126, _64
+	subq	$6152, %rsp	#,
+	.cfi_def_cfa_offset 6208
+# blake2s-batch.c:39: {
+	.loc 1 39 1 view .LVU8
+	movq	6208(%rsp), %rsi	# k, k
+.LVL2:
+	.loc 1 39 1 view .LVU9
+	leaq	8(%rsp), %r15	#, ivtmp.32
+	movq	%r15, %rdx	# ivtmp.32, ivtmp.45
+.LVL3:
+	.loc 1 39 1 view .LVU10
+	leaq	(%rsi,%r9), %rdi	#, _61
+.LVL4:
+	.loc 1 39 1 view .LVU11
+	jmp	.L5	#
+.LVL5:
+	.p2align 4,,10
+	.p2align 3
+.L12:
+.LBB19:
+.LBB15:
+# blake2s-batch.c:45:         key[j].blocks = len ? (len - 1) / BLAKE2S_BLOCK + 1 : 1;
+	.loc 1 45 36 view .LVU12
+	subq	$1, %rax	#, tmp130
+.LVL6:
+# blake2s-batch.c:46:         key[j].i = i + j;
+	.loc 1 46 18 view .LVU13
+	movq	%r9, (%rdx)	# i,* ivtmp.45
+.LBE15:
+# blake2s-batch.c:43:     for (size_t j = 0; j < k; j++) {
+	.loc 1 43 26 view .LVU14
+	addq	$1, %r9	#, i
+	addq	$16, %rdx	#, ivtmp.45
+.LBB16:
+# blake2s-batch.c:45:         key[j].blocks = len ? (len - 1) / BLAKE2S_BLOCK + 1 : 1;
+	.loc 1 45 41 view .LVU15
+	shrq	$6, %rax	#, tmp131
+.LVL7:
+# blake2s-batch.c:45:         key[j].blocks = len ? (len - 1) / BLAKE2S_BLOCK + 1 : 1;
+	.loc 1 45 50 view .LVU16
+	addq	$1, %rax	#, tmp132
+	movq	%rax, -24(%rdx)	# tmp132, MEM[(long unsigned int *)_79 + -8B]
+	.loc 1 46 9 is_stmt 1 view .LVU17
+	.loc 1 46 9 view .LVU18
+.LBE16:
+	.loc 1 43 32 view .LVU19
+.LVL8:
+	.loc 1 43 26 view .LVU20
+	cmpq	%rdi, %r9	# _61, i
+	je	.L11	#,
+.LVL9:
+.L5:
+.LBB17:
+	.loc 1 44 9 view .LVU21
+# blake2s-batch.c:44:         size_t len = ctx[i + j - base].buf_len + lens[i + j];
+	.loc 1 44 39 is_stmt 0 view .LVU22
+	movq	%r9, %rax	# i, tmp127
+	salq	$7, %rax	#, tmp127
+	movl	112(%rcx,%rax), %eax	# MEM[(unsigned int *)_64 + 112B + _63 * 1], MEM[(unsigned int *)_64 + 112B + _63 * 1]
+.LVL10:
+	.loc 1 45 9 is_stmt 1 view .LVU23
+# blake2s-batch.c:45:         key[j].blocks = len ? (len - 1) / BLAKE2S_BLOCK + 1 : 1;
+	.loc 1 45 50 is_stmt 0 view .LVU24
+	addq	(%r14,%r9,8), %rax	# MEM[(const size_t *)lens_39(D) + ivtmp.44_24 * 8], len
+.LVL11:
+	.loc 1 45 50 view .LVU25
+	jne	.L12	#,
+# blake2s-batch.c:46:         key[j].i = i + j;
+	.loc 1 46 18 view .LVU26
+	movq	%r9, (%rdx)	# i,* ivtmp.45
+.LBE17:
+# blake2s-batch.c:43:     for (size_t j = 0; j < k; j++) {
+	.loc 1 43 26 view .LVU27
+	addq	$1, %r9	#, i
+	addq	$16, %rdx	#, ivtmp.45
+.LBB18:
+# blake2s-batch.c:45:         key[j].blocks = len ? (len - 1) / BLAKE2S_BLOCK + 1 : 1;
+	.loc 1 45 23 view .LVU28
+	movq	$1, -24(%rdx)	#, MEM[(long unsigned int *)_62 + -8B]
+	.loc 1 46 9 is_stmt 1 view .LVU29
+.LBE18:
+	.loc 1 43 32 view .LVU30
+.LVL12:
+	.loc 1 43 26 view .LVU31
+	cmpq	%rdi, %r9	# _61, i
+	jne	.L5	#,
+.LVL13:
+.L11:
+	.loc 1 43 26 is_stmt 0 view .LVU32
+.LBE19:
+	.loc 1 48 5 is_stmt 1 view .LVU33
+	movq	%rsp, %rdi	#, tmp133
+	movl	$16, %edx	#,
+	leaq	bbatch_cmp(%rip), %rcx	#, tmp134
+	.loc 1 48 5 is_stmt 0 view .LVU34
+	movq	%rsi, 6208(%rsp)	# k, k
+	call	qsort@PLT	#
+.LVL14:
+	.loc 1 49 5 is_stmt 1 view .LVU35
+.LBB20:
+	.loc 1 49 10 view .LVU36
+	.loc 1 49 26 view .LVU37
+	movq	6208(%rsp), %rsi	# k, k
+	leaq	2048(%rsp), %rdi	#, tmp142
+	movq	%rdi, %rdx	# tmp142, ivtmp.34
+	movq	%rsi, %r8	# k, tmp135
+	salq	$5, %r8	#, tmp135
+	addq	%rdi, %r8	# tmp142, _46
+.LVL15:
+	.p2align 4,,10
+	.p2align 3
+.L6:
+.LBB21:
+	.loc 1 50 9 discriminator 3 view .LVU38
+# blake2s-batch.c:50:         size_t at = key[j].i;
+	.loc 1 50 16 is_stmt 0 discriminator 3 view .LVU39
+	movq	(%r15), %rcx	# MEM[(long unsigned int *)_7], at
+.LVL16:
+	.loc 1 51 9 is_stmt 1 discriminator 3 view .LVU40
+	.loc 1 52 9 discriminator 3 view .LVU41
+.LBE21:
+# blake2s-batch.c:49:     for (size_t j = 0; j < k; j++) {
+	.loc 1 49 26 is_stmt 0 discriminator 3 view .LVU42
+	addq	$32, %rdx	#, ivtmp.34
+	addq	$16, %r15	#, ivtmp.32
+.LBB22:
+# blake2s-batch.c:51:         job[j].ctx = &ctx[at - base];
+	.loc 1 51 30 discriminator 3 view .LVU43
+	movq	%rcx, %rax	# at, tmp137
+	subq	%rbp, %rax	# base, tmp137
+# blake2s-batch.c:51:         job[j].ctx = &ctx[at - base];
+	.loc 1 51 26 discriminator 3 view .LVU44
+	salq	$7, %rax	#, tmp138
+# blake2s-batch.c:51:         job[j].ctx = &ctx[at - base];
+	.loc 1 51 22 discriminator 3 view .LVU45
+	addq	%rbx, %rax	# ctx, tmp139
+	movq	%rax, %xmm0	# tmp139, tmp139
+# blake2s-batch.c:51:         job[j].ctx = &ctx[at - base];
+	.loc 1 51 20 discriminator 3 view .LVU46
+	movhps	0(%r13,%rcx,8), %xmm0	# *_16, tmp136
+	movaps	%xmm0, -32(%rdx)	# tmp136, MEM <vector(2) long unsigned int> [(void *)_8]
+	.loc 1 53 9 is_stmt 1 discriminator 3 view .LVU47
+# blake2s-batch.c:53:         job[j].len = lens[at];
+	.loc 1 53 26 is_stmt 0 discriminator 3 view .LVU48
+	movq	(%r14,%rcx,8), %rax	# *_18, _19
+# blake2s-batch.c:53:         job[j].len = lens[at];
+	.loc 1 53 20 discriminator 3 view .LVU49
+	movq	%rax, -16(%rdx)	# _19, MEM[(long unsigned int *)_8 + 16B]
+	.loc 1 54 9 is_stmt 1 discriminator 3 view .LVU50
+# blake2s-batch.c:54:         job[j].out = outs[at];
+	.loc 1 54 26 is_stmt 0 discriminator 3 view .LVU51
+	movq	(%r12,%rcx,8), %rax	# *_20, _21
+# blake2s-batch.c:54:         job[j].out = outs[at];
+	.loc 1 54 20 discriminator 3 view .LVU52
+	movq	%rax, -8(%rdx)	# _21, MEM[(unsigned char * *)_8 + 24B]
+.LBE22:
+	.loc 1 49 32 is_stmt 1 discriminator 3 view .LVU53
+	.loc 1 49 26 discriminator 3 view .LVU54
+	cmpq	%r8, %rdx	# _46, ivtmp.34
+	jne	.L6	#,
+.LBE20:
+	.loc 1 56 5 view .LVU55
+	call	blake2s_lanes_run@PLT	#
+.LVL17:
+# blake2s-batch.c:57: }
+	.loc 1 57 1 is_stmt 0 view .LVU56
+	addq	$6152, %rsp	#,
+	.cfi_def_cfa_offset 56
+	popq	%rbx	#
+	.cfi_def_cfa_offset 48
+.LVL18:
+	.loc 1 57 1 view .LVU57
+	popq	%rbp	#
+	.cfi_def_cfa_offset 40
+.LVL19:
+	.loc 1 57 1 view .LVU58
+	popq	%r12	#
+	.cfi_def_cfa_offset 32
+.LVL20:
+	.loc 1 57 1 view .LVU59
+	popq	%r13	#
+	.cfi_def_cfa_offset 24
+.LVL21:
+	.loc 1 57 1 view .LVU60
+	popq	%r14	#
+	.cfi_def_cfa_offset 16
+.LVL22:
+	.loc 1 57 1 view .LVU61
+	popq	%r15	#
+	.cfi_def_cfa_offset 8
+	ret	
+	.cfi_endproc
+.LFE23:
+	.size	bbatch_run, .-bbatch_run
+	.p2align 4
+	.type	bbatch_cmp, @function
+bbatch_cmp:
+.LVL23:
+.LFB22:
+	.loc 1 27 1 is_stmt 1 view -0
+	.cfi_startproc
+	.loc 1 28 5 view .LVU63
+	.loc 1 29 5 view .LVU64
+# blake2s-batch.c:29:     if (x->blocks != y->blocks)
+	.loc 1 29 8 is_stmt 0 view .LVU65
+	movq	(%rsi), %rax	# MEM[(const struct bbatch_key *)b_7(D)].blocks, tmp97
+	cmpq	%rax, (%rdi)	# tmp97, MEM[(const struct bbatch_key *)a_6(D)].blocks
+	je	.L14	#,
+	.loc 1 30 9 is_stmt 1 view .LVU66
+# blake2s-batch.c:30:         return x->blocks < y->blocks ? -1 : 1;
+	.loc 1 30 43 is_stmt 0 view .LVU67
+	sbbl	%eax, %eax	# <retval>
+	orl	$1, %eax	#, <retval>
+	ret	
+	.p2align 4,,10
+	.p2align 3
+.L14:
+.LVL24:
+.LBB25:
+.LBI25:
+	.loc 1 26 12 is_stmt 1 view .LVU68
+.LBB26:
+	.loc 1 31 5 view .LVU69
+# blake2s-batch.c:31:     return x->i < y->i ? -1 : x->i > y->i;
+	.loc 1 31 13 is_stmt 0 view .LVU70
+	movq	8(%rdi), %rdx	# MEM[(const struct bbatch_key *)a_6(D)].i, _9
+# blake2s-batch.c:31:     return x->i < y->i ? -1 : x->i > y->i;
+	.loc 1 31 20 view .LVU71
+	movq	8(%rsi), %rcx	# MEM[(const struct bbatch_key *)b_7(D)].i, _10
+.LBE26:
+.LBE25:
+# blake2s-batch.c:30:         return x->blocks < y->blocks ? -1 : 1;
+	.loc 1 30 43 view .LVU72
+	movl	$-1, %eax	#, <retval>
+.LBB28:
+.LBB27:
+# blake2s-batch.c:31:     return x->i < y->i ? -1 : x->i > y->i;
+	.loc 1 31 29 view .LVU73
+	cmpq	%rcx, %rdx	# _10, _9
+	jb	.L13	#,
+# blake2s-batch.c:31:     return x->i < y->i ? -1 : x->i > y->i;
+	.loc 1 31 36 view .LVU74
+	xorl	%eax, %eax	# <retval>
+	cmpq	%rdx, %rcx	# _9, _10
+	setb	%al	#, <retval>
+.L13:
+	.loc 1 31 36 view .LVU75
+.LBE27:
+.LBE28:
+# blake2s-batch.c:32: }
+	.loc 1 32 1 view .LVU76
+	ret	
+	.cfi_endproc
+.LFE22:
+	.size	bbatch_cmp, .-bbatch_cmp
+	.p2align 4
+	.type	bmgr_step, @function
+bmgr_step:
+.LVL25:
+.LFB31:
+	.loc 1 177 1 is_stmt 1 view -0
+	.cfi_startproc
+	.loc 1 178 5 view .LVU78
+# blake2s-batch.c:177: {
+	.loc 1 177 1 is_stmt 0 view .LVU79
+	pushq	%r15	#
+	.cfi_def_cfa_offset 16
+	.cfi_offset 15, -16
+# blake2s-batch.c:180:     M->kern->compress_lanes(&M->L, M->m, busy);
+	.loc 1 180 37 view .LVU80
+	leaq	792(%rdi), %rsi	#, tmp120
+# blake2s-batch.c:177: {
+	.loc 1 177 1 view .LVU81
+	pushq	%r14	#
+	.cfi_def_cfa_offset 24
+	.cfi_offset 14, -24
+	pushq	%r13	#
+	.cfi_def_cfa_offset 32
+	.cfi_offset 13, -32
+	pushq	%r12	#
+	.cfi_def_cfa_offset 40
+	.cfi_offset 12, -40
+	pushq	%rbp	#
+	.cfi_def_cfa_offset 48
+	.cfi_offset 6, -48
+	movq	%rdi, %rbp	# tmp155, M
+	pushq	%rbx	#
+	.cfi_def_cfa_offset 56
+	.cfi_offset 3, -56
+	subq	$24, %rsp	#,
+	.cfi_def_cfa_offset 80
+# blake2s-batch.c:178:     unsigned busy = M->busy;
+	.loc 1 178 14 view .LVU82
+	movl	780(%rdi), %r13d	# M_15(D)->busy, busy
+.LVL26:
+	.loc 1 180 5 is_stmt 1 view .LVU83
+# blake2s-batch.c:180:     M->kern->compress_lanes(&M->L, M->m, busy);
+	.loc 1 180 12 is_stmt 0 view .LVU84
+	movq	768(%rdi), %rax	# M_15(D)->kern, M_15(D)->kern
+# blake2s-batch.c:180:     M->kern->compress_lanes(&M->L, M->m, busy);
+	.loc 1 180 5 view .LVU85
+	movl	%r13d, %edx	# busy,
+	call	*40(%rax)	# _1->compress_lanes
+.LVL27:
+	.loc 1 181 5 is_stmt 1 view .LVU86
+.LBB36:
+	.loc 1 181 10 view .LVU87
+	.loc 1 181 28 view .LVU88
+# blake2s-batch.c:181:     for (unsigned l = 0; l < M->width; l++) {
+	.loc 1 181 31 is_stmt 0 view .LVU89
+	movl	776(%rbp), %eax	# M_15(D)->width, prephitmp_78
+# blake2s-batch.c:181:     for (unsigned l = 0; l < M->width; l++) {
+	.loc 1 181 28 view .LVU90
+	testl	%eax, %eax	# prephitmp_78
+	je	.L18	#,
+	xorl	%ebx, %ebx	# l
+	leaq	12(%rsp), %r14	#, tmp154
+	jmp	.L19	#
+.LVL28:
+	.p2align 4,,10
+	.p2align 3
+.L33:
+	.loc 1 185 13 is_stmt 1 view .LVU91
+.LBB37:
+.LBI37:
+	.loc 1 148 13 view .LVU92
+.LBB38:
+	.loc 1 150 5 view .LVU93
+# blake2s-batch.c:152:     blake2s_lane_retire(&M->L, l, &M->lane[l]);
+	.loc 1 152 5 is_stmt 0 view .LVU94
+	movq	%r15, %rdx	# _86,
+	movl	%ebx, %esi	# l,
+	movq	%rbp, %rdi	# M,
+# blake2s-batch.c:150:     struct blake2s_mgr_job *J = M->job[l];
+	.loc 1 150 29 view .LVU95
+	movq	1432(%rbp,%r12,8), %r12	# M_15(D)->job[l_40], J
+.LVL29:
+	.loc 1 152 5 is_stmt 1 view .LVU96
+	call	blake2s_lane_retire@PLT	#
+.LVL30:
+	.loc 1 153 5 view .LVU97
+# blake2s-batch.c:153:     M->busy &= ~(1u << l);
+	.loc 1 153 21 is_stmt 0 view .LVU98
+	movl	$-2, %eax	#, tmp133
+# blake2s-batch.c:153:     M->busy &= ~(1u << l);
+	.loc 1 153 16 view .LVU99
+	movl	%ebx, %ecx	# l, tmp159
+# blake2s-batch.c:153:     M->busy &= ~(1u << l);
+	.loc 1 153 6 view .LVU100
+	movq	780(%rbp), %xmm1	# MEM <vector(2) unsigned int> [(unsigned int *)M_15(D) + 780B], vect__24.62
+# blake2s-batch.c:153:     M->busy &= ~(1u << l);
+	.loc 1 153 16 view .LVU101
+	roll	%cl, %eax	# tmp159, _26
+	.loc 1 154 5 is_stmt 1 view .LVU102
+# blake2s-batch.c:153:     M->busy &= ~(1u << l);
+	.loc 1 153 13 is_stmt 0 view .LVU103
+	movd	%eax, %xmm2	# _26, _26
+	pshufd	$0xe0, %xmm2, %xmm0	# _26, tmp136
+.LVL31:
+.L32:
+	.loc 1 153 13 view .LVU104
+.LBE38:
+.LBE37:
+.LBB40:
+.LBB41:
+.LBB42:
+.LBB43:
+# blake2s-batch.c:156:     *M->done_tail = J;
+	.loc 1 156 19 view .LVU105
+	movq	1568(%rbp), %rax	# M_15(D)->done_tail, M_15(D)->done_tail
+# blake2s-batch.c:153:     M->busy &= ~(1u << l);
+	.loc 1 153 13 view .LVU106
+	pand	%xmm0, %xmm1	# tmp146, vect__45.57
+	movq	%xmm1, 780(%rbp)	# vect__45.57, MEM <vector(2) unsigned int> [(unsigned int *)M_15(D) + 780B]
+	.loc 1 155 5 is_stmt 1 view .LVU107
+# blake2s-batch.c:155:     J->next = NULL;
+	.loc 1 155 13 is_stmt 0 view .LVU108
+	movq	$0, 40(%r12)	#,
+	.loc 1 156 5 is_stmt 1 view .LVU109
+# blake2s-batch.c:156:     *M->done_tail = J;
+	.loc 1 156 19 is_stmt 0 view .LVU110
+	movq	%r12, (%rax)	# J,* M_15(D)->done_tail
+	.loc 1 157 5 is_stmt 1 view .LVU111
+# blake2s-batch.c:157:     M->done_tail = &J->next;
+	.loc 1 157 20 is_stmt 0 view .LVU112
+	addq	$40, %r12	#, tmp149
+.LBE43:
+.LBE42:
+.LBE41:
+.LBE40:
+# blake2s-batch.c:181:     for (unsigned l = 0; l < M->width; l++) {
+	.loc 1 181 31 view .LVU113
+	movl	776(%rbp), %eax	# M_15(D)->width, prephitmp_78
+.LBB51:
+.LBB48:
+.LBB46:
+.LBB44:
+# blake2s-batch.c:157:     M->done_tail = &J->next;
+	.loc 1 157 20 view .LVU114
+	movq	%r12, 1568(%rbp)	# tmp149, M_15(D)->done_tail
+.LBE44:
+.LBE46:
+	.loc 1 168 9 is_stmt 1 view .LVU115
+.L20:
+	.loc 1 168 9 is_stmt 0 view .LVU116
+.LBE48:
+.LBE51:
+	.loc 1 181 41 is_stmt 1 discriminator 2 view .LVU117
+	addl	$1, %ebx	#, l
+.LVL32:
+	.loc 1 181 28 discriminator 2 view .LVU118
+	cmpl	%eax, %ebx	# prephitmp_78, l
+	jnb	.L18	#,
+.LVL33:
+.L19:
+	.loc 1 182 9 view .LVU119
+# blake2s-batch.c:182:         if (!(busy & (1u << l)))
+	.loc 1 182 12 is_stmt 0 view .LVU120
+	btl	%ebx, %r13d	# l, busy
+	jnc	.L20	#,
+	.loc 1 184 9 is_stmt 1 view .LVU121
+.LBB52:
+.LBB39:
+# blake2s-batch.c:152:     blake2s_lane_retire(&M->L, l, &M->lane[l]);
+	.loc 1 152 5 is_stmt 0 view .LVU122
+	movl	%ebx, %r12d	# l, l
+	movq	%r12, %rax	# l, tmp126
+	salq	$5, %rax	#, tmp126
+	leaq	920(%rbp,%rax), %r15	#, _86
+.LBE39:
+.LBE52:
+# blake2s-batch.c:184:         if (M->last & (1u << l))
+	.loc 1 184 13 view .LVU123
+	movl	784(%rbp), %eax	# M_15(D)->last, M_15(D)->last
+# blake2s-batch.c:184:         if (M->last & (1u << l))
+	.loc 1 184 12 view .LVU124
+	btl	%ebx, %eax	# l, M_15(D)->last
+	jc	.L33	#,
+	.loc 1 187 13 is_stmt 1 view .LVU125
+.LVL34:
+.LBB53:
+.LBI40:
+	.loc 1 161 13 view .LVU126
+.LBB49:
+	.loc 1 163 5 view .LVU127
+	.loc 1 164 5 view .LVU128
+# blake2s-batch.c:164:     const void *p = blake2s_lane_next(&M->L, l, &M->lane[l], &last);
+	.loc 1 164 21 is_stmt 0 view .LVU129
+	movq	%r14, %rcx	# tmp154,
+	movq	%r15, %rdx	# _86,
+	movl	%ebx, %esi	# l,
+	movq	%rbp, %rdi	# M,
+	call	blake2s_lane_next@PLT	#
+.LVL35:
+	.loc 1 166 5 is_stmt 1 view .LVU130
+# blake2s-batch.c:166:     if (!p) {
+	.loc 1 166 8 is_stmt 0 view .LVU131
+	testq	%rax, %rax	# p
+	je	.L34	#,
+	.loc 1 170 5 is_stmt 1 view .LVU132
+# blake2s-batch.c:170:     M->m[l] = p;
+	.loc 1 170 13 is_stmt 0 view .LVU133
+	movq	%rax, 792(%rbp,%r12,8)	# p, M_15(D)->m[l_40]
+	.loc 1 171 5 is_stmt 1 view .LVU134
+# blake2s-batch.c:171:     if (last)
+	.loc 1 171 8 is_stmt 0 view .LVU135
+	movl	12(%rsp), %eax	# last,
+.LVL36:
+	.loc 1 171 8 view .LVU136
+	testl	%eax, %eax	#
+	je	.L23	#,
+	.loc 1 172 9 is_stmt 1 view .LVU137
+# blake2s-batch.c:172:         M->last |= 1u << l;
+	.loc 1 172 23 is_stmt 0 view .LVU138
+	movl	$1, %eax	#, tmp153
+	movl	%ebx, %ecx	# l, tmp163
+	sall	%cl, %eax	# tmp163, tmp152
+# blake2s-batch.c:172:         M->last |= 1u << l;
+	.loc 1 172 17 view .LVU139
+	orl	%eax, 784(%rbp)	# tmp152, M_15(D)->last
+.L23:
+	.loc 1 172 17 view .LVU140
+.LBE49:
+.LBE53:
+# blake2s-batch.c:181:     for (unsigned l = 0; l < M->width; l++) {
+	.loc 1 181 31 view .LVU141
+	movl	776(%rbp), %eax	# M_15(D)->width, prephitmp_78
+.LVL37:
+	.loc 1 181 41 is_stmt 1 view .LVU142
+	addl	$1, %ebx	#, l
+.LVL38:
+	.loc 1 181 28 view .LVU143
+	cmpl	%eax, %ebx	# prephitmp_78, l
+	jb	.L19	#,
+.LVL39:
+.L18:
+	.loc 1 181 28 is_stmt 0 view .LVU144
+.LBE36:
+# blake2s-batch.c:189: }
+	.loc 1 189 1 view .LVU145
+	addq	$24, %rsp	#,
+	.cfi_remember_state
+	.cfi_def_cfa_offset 56
+	popq	%rbx	#
+	.cfi_def_cfa_offset 48
+	popq	%rbp	#
+	.cfi_def_cfa_offset 40
+.LVL40:
+	.loc 1 189 1 view .LVU146
+	popq	%r12	#
+	.cfi_def_cfa_offset 32
+	popq	%r13	#
+	.cfi_def_cfa_offset 24
+.LVL41:
+	.loc 1 189 1 view .LVU147
+	popq	%r14	#
+	.cfi_def_cfa_offset 16
+	popq	%r15	#
+	.cfi_def_cfa_offset 8
+	ret	
+.LVL42:
+	.p2align 4,,10
+	.p2align 3
+.L34:
+	.cfi_restore_state
+.LBB55:
+.LBB54:
+.LBB50:
+	.loc 1 167 9 is_stmt 1 view .LVU148
+.LBB47:
+.LBI42:
+	.loc 1 148 13 view .LVU149
+.LBB45:
+	.loc 1 150 5 view .LVU150
+# blake2s-batch.c:152:     blake2s_lane_retire(&M->L, l, &M->lane[l]);
+	.loc 1 152 5 is_stmt 0 view .LVU151
+	movq	%r15, %rdx	# _86,
+	movl	%ebx, %esi	# l,
+	movq	%rbp, %rdi	# M,
+# blake2s-batch.c:150:     struct blake2s_mgr_job *J = M->job[l];
+	.loc 1 150 29 view .LVU152
+	movq	1432(%rbp,%r12,8), %r12	# M_15(D)->job[l_40], J
+.LVL43:
+	.loc 1 152 5 is_stmt 1 view .LVU153
+	call	blake2s_lane_retire@PLT	#
+.LVL44:
+	.loc 1 153 5 view .LVU154
+# blake2s-batch.c:153:     M->busy &= ~(1u << l);
+	.loc 1 153 21 is_stmt 0 view .LVU155
+	movl	$-2, %eax	#, tmp143
+# blake2s-batch.c:153:     M->busy &= ~(1u << l);
+	.loc 1 153 16 view .LVU156
+	movl	%ebx, %ecx	# l, tmp161
+# blake2s-batch.c:153:     M->busy &= ~(1u << l);
+	.loc 1 153 6 view .LVU157
+	movq	780(%rbp), %xmm1	# MEM <vector(2) unsigned int> [(unsigned int *)M_15(D) + 780B], vect__42.56
+# blake2s-batch.c:153:     M->busy &= ~(1u << l);
+	.loc 1 153 16 view .LVU158
+	roll	%cl, %eax	# tmp161, _44
+	.loc 1 154 5 is_stmt 1 view .LVU159
+# blake2s-batch.c:153:     M->busy &= ~(1u << l);
+	.loc 1 153 13 is_stmt 0 view .LVU160
+	movd	%eax, %xmm3	# _44, _44
+	pshufd	$0xe0, %xmm3, %xmm0	# _44, tmp146
+	jmp	.L32	#
+.LBE45:
+.LBE47:
+.LBE50:
+.LBE54:
+.LBE55:
+	.cfi_endproc
+.LFE31:
+	.size	bmgr_step, .-bmgr_step
+	.p2align 4
+	.globl	blake2s_many
+	.type	blake2s_many, @function
+blake2s_many:
+.LVL45:
+.LFB24:
+	.loc 1 61 1 is_stmt 1 view -0
+	.cfi_startproc
+	.loc 1 62 5 view .LVU162
+	.loc 1 64 5 view .LVU163
+.LBB56:
+	.loc 1 64 10 view .LVU164
+	.loc 1 64 26 view .LVU165
+.LBE56:
+# blake2s-batch.c:61: {
+	.loc 1 61 1 is_stmt 0 view .LVU166
+	pushq	%r15	#
+	.cfi_def_cfa_offset 16
+	.cfi_offset 15, -16
+	pushq	%r14	#
+	.cfi_def_cfa_offset 24
+	.cfi_offset 14, -24
+	pushq	%r13	#
+	.cfi_def_cfa_offset 32
+	.cfi_offset 13, -32
+	pushq	%r12	#
+	.cfi_def_cfa_offset 40
+	.cfi_offset 12, -40
+	pushq	%rbp	#
+	.cfi_def_cfa_offset 48
+	.cfi_offset 6, -48
+	pushq	%rbx	#
+	.cfi_def_cfa_offset 56
+	.cfi_offset 3, -56
+	subq	$16424, %rsp	#,
+	.cfi_def_cfa_offset 16480
+# blake2s-batch.c:61: {
+	.loc 1 61 1 view .LVU167
+	movq	%rdi, 8(%rsp)	# tmp96, %sfp
+	movq	%rsi, 16(%rsp)	# tmp97, %sfp
+	movq	%rdx, 24(%rsp)	# tmp98, %sfp
+.LBB60:
+# blake2s-batch.c:64:     for (size_t i = 0; i < n; i += B2S_BATCH) {
+	.loc 1 64 26 view .LVU168
+	testq	%rcx, %rcx	# n
+	je	.L35	#,
+	movq	%rcx, %r13	# tmp99, n
+# blake2s-batch.c:64:     for (size_t i = 0; i < n; i += B2S_BATCH) {
+	.loc 1 64 17 view .LVU169
+	xorl	%ebp, %ebp	# i
+	leaq	32(%rsp), %r14	#, tmp95
+.LVL46:
+	.p2align 4,,10
+	.p2align 3
+.L39:
+.LBB57:
+	.loc 1 65 9 is_stmt 1 view .LVU170
+# blake2s-batch.c:65:         size_t k = n - i < B2S_BATCH ? n - i : B2S_BATCH;
+	.loc 1 65 22 is_stmt 0 view .LVU171
+	movq	%r13, %r12	# n, k
+# blake2s-batch.c:65:         size_t k = n - i < B2S_BATCH ? n - i : B2S_BATCH;
+	.loc 1 65 16 view .LVU172
+	movl	$128, %eax	#, tmp100
+# blake2s-batch.c:65:         size_t k = n - i < B2S_BATCH ? n - i : B2S_BATCH;
+	.loc 1 65 22 view .LVU173
+	subq	%rbp, %r12	# i, k
+# blake2s-batch.c:65:         size_t k = n - i < B2S_BATCH ? n - i : B2S_BATCH;
+	.loc 1 65 16 view .LVU174
+	cmpq	%rax, %r12	# tmp100, k
+	cmova	%rax, %r12	# k,, tmp100, k
+.LVL47:
+	.loc 1 66 9 is_stmt 1 view .LVU175
+.LBB58:
+	.loc 1 66 14 view .LVU176
+	.loc 1 66 30 view .LVU177
+	cmpq	%rbp, %r13	# i, n
+	je	.L37	#,
+	.loc 1 66 30 is_stmt 0 view .LVU178
+	movq	%r12, %rbx	# k, tmp93
+	movq	%r14, %r15	# tmp95, ivtmp.77
+	salq	$7, %rbx	#, tmp93
+	addq	%r14, %rbx	# tmp95, _3
+.LVL48:
+	.p2align 4,,10
+	.p2align 3
+.L38:
+	.loc 1 67 13 is_stmt 1 discriminator 3 view .LVU179
+	movq	%r15, %rdi	# ivtmp.77,
+# blake2s-batch.c:66:         for (size_t j = 0; j < k; j++)
+	.loc 1 66 30 is_stmt 0 discriminator 3 view .LVU180
+	subq	$-128, %r15	#, ivtmp.77
+# blake2s-batch.c:67:             blake2s_init(&ctx[j]);
+	.loc 1 67 13 discriminator 3 view .LVU181
+	call	blake2s_init@PLT	#
+.LVL49:
+	.loc 1 66 36 is_stmt 1 discriminator 3 view .LVU182
+	.loc 1 66 30 discriminator 3 view .LVU183
+	cmpq	%r15, %rbx	# ivtmp.77, _3
+	jne	.L38	#,
+.L37:
+.LBE58:
+	.loc 1 68 9 view .LVU184
+	subq	$8, %rsp	#,
+	.cfi_def_cfa_offset 16488
+	movq	%rbp, %r9	# i,
+	movq	%rbp, %rsi	# i,
+	movq	%r14, %rdi	# tmp95,
+	pushq	%r12	# k
+	.cfi_def_cfa_offset 16496
+	movq	40(%rsp), %r8	# %sfp,
+.LBE57:
+# blake2s-batch.c:64:     for (size_t i = 0; i < n; i += B2S_BATCH) {
+	.loc 1 64 33 is_stmt 0 view .LVU185
+	subq	$-128, %rbp	#, i
+.LVL50:
+.LBB59:
+# blake2s-batch.c:68:         bbatch_run(ctx, i, outs, srcs, lens, i, k);
+	.loc 1 68 9 view .LVU186
+	movq	32(%rsp), %rcx	# %sfp,
+	movq	24(%rsp), %rdx	# %sfp,
+	call	bbatch_run	#
+.LVL51:
+	.loc 1 68 9 view .LVU187
+.LBE59:
+	.loc 1 64 33 is_stmt 1 view .LVU188
+	.loc 1 64 26 view .LVU189
+	popq	%rax	#
+	.cfi_def_cfa_offset 16488
+	popq	%rdx	#
+	.cfi_def_cfa_offset 16480
+	cmpq	%r13, %rbp	# n, i
+	jb	.L39	#,
+.LVL52:
+.L35:
+	.loc 1 64 26 is_stmt 0 view .LVU190
+.LBE60:
+# blake2s-batch.c:70: }
+	.loc 1 70 1 view .LVU191
+	addq	$16424, %rsp	#,
+	.cfi_def_cfa_offset 56
+	popq	%rbx	#
+	.cfi_def_cfa_offset 48
+	popq	%rbp	#
+	.cfi_def_cfa_offset 40
+	popq	%r12	#
+	.cfi_def_cfa_offset 32
+	popq	%r13	#
+	.cfi_def_cfa_offset 24
+	popq	%r14	#
+	.cfi_def_cfa_offset 16
+	popq	%r15	#
+	.cfi_def_cfa_offset 8
+	ret	
+	.cfi_endproc
+.LFE24:
+	.size	blake2s_many, .-blake2s_many
+	.p2align 4
+	.globl	blake2s_many_ctx
+	.type	blake2s_many_ctx, @function
+blake2s_many_ctx:
+.LVL53:
+.LFB25:
+	.loc 1 74 1 is_stmt 1 view -0
+	.cfi_startproc
+	.loc 1 75 5 view .LVU193
+.LBB61:
+	.loc 1 75 10 view .LVU194
+	.loc 1 75 26 view .LVU195
+	testq	%r8, %r8	# n
+	je	.L54	#,
+.LBE61:
+# blake2s-batch.c:74: {
+	.loc 1 74 1 is_stmt 0 view .LVU196
+	pushq	%r15	#
+	.cfi_def_cfa_offset 16
+	.cfi_offset 15, -16
+	movq	%r8, %r15	# tmp95, n
+	pushq	%r14	#
+	.cfi_def_cfa_offset 24
+	.cfi_offset 14, -24
+	movq	%rcx, %r14	# tmp94, lens
+	pushq	%r13	#
+	.cfi_def_cfa_offset 32
+	.cfi_offset 13, -32
+	movq	%rdx, %r13	# tmp93, srcs
+	pushq	%r12	#
+	.cfi_def_cfa_offset 40
+	.cfi_offset 12, -40
+	movq	%rsi, %r12	# tmp92, outs
+	pushq	%rbp	#
+	.cfi_def_cfa_offset 48
+	.cfi_offset 6, -48
+	movq	%rdi, %rbp	# tmp91, ctx
+	pushq	%rbx	#
+	.cfi_def_cfa_offset 56
+	.cfi_offset 3, -56
+.LBB62:
+# blake2s-batch.c:75:     for (size_t i = 0; i < n; i += B2S_BATCH)
+	.loc 1 75 17 view .LVU197
+	xorl	%ebx, %ebx	# i
+.LBE62:
+# blake2s-batch.c:74: {
+	.loc 1 74 1 view .LVU198
+	subq	$8, %rsp	#,
+	.cfi_def_cfa_offset 64
+.LVL54:
+	.p2align 4,,10
+	.p2align 3
+.L48:
+.LBB63:
+	.loc 1 76 9 is_stmt 1 discriminator 3 view .LVU199
+# blake2s-batch.c:77:                    n - i < B2S_BATCH ? n - i : B2S_BATCH);
+	.loc 1 77 22 is_stmt 0 discriminator 3 view .LVU200
+	movq	%r15, %rax	# n, tmp90
+# blake2s-batch.c:76:         bbatch_run(ctx, 0, outs, srcs, lens, i,
+	.loc 1 76 9 discriminator 3 view .LVU201
+	movl	$128, %edx	#, tmp96
+	subq	$8, %rsp	#,
+	.cfi_def_cfa_offset 72
+	movq	%rbx, %r9	# i,
+# blake2s-batch.c:77:                    n - i < B2S_BATCH ? n - i : B2S_BATCH);
+	.loc 1 77 22 discriminator 3 view .LVU202
+	subq	%rbx, %rax	# i, tmp90
+# blake2s-batch.c:76:         bbatch_run(ctx, 0, outs, srcs, lens, i,
+	.loc 1 76 9 discriminator 3 view .LVU203
+	movq	%r14, %r8	# lens,
+	movq	%r13, %rcx	# srcs,
+	movq	%rbp, %rdi	# ctx,
+	cmpq	%rdx, %rax	# tmp96, tmp90
+	cmova	%rdx, %rax	# tmp90,, tmp96, tmp90
+	movq	%r12, %rdx	# outs,
+	xorl	%esi, %esi	#
+# blake2s-batch.c:75:     for (size_t i = 0; i < n; i += B2S_BATCH)
+	.loc 1 75 33 discriminator 3 view .LVU204
+	subq	$-128, %rbx	#, i
+.LVL55:
+# blake2s-batch.c:76:         bbatch_run(ctx, 0, outs, srcs, lens, i,
+	.loc 1 76 9 discriminator 3 view .LVU205
+	pushq	%rax	# tmp90
+	.cfi_def_cfa_offset 80
+	call	bbatch_run	#
+.LVL56:
+	.loc 1 75 33 is_stmt 1 discriminator 3 view .LVU206
+	.loc 1 75 26 discriminator 3 view .LVU207
+	popq	%rax	#
+	.cfi_def_cfa_offset 72
+	popq	%rdx	#
+	.cfi_def_cfa_offset 64
+	cmpq	%r15, %rbx	# n, i
+	jb	.L48	#,
+.LBE63:
+# blake2s-batch.c:78: }
+	.loc 1 78 1 is_stmt 0 view .LVU208
+	addq	$8, %rsp	#,
+	.cfi_def_cfa_offset 56
+	popq	%rbx	#
+	.cfi_def_cfa_offset 48
+.LVL57:
+	.loc 1 78 1 view .LVU209
+	popq	%rbp	#
+	.cfi_def_cfa_offset 40
+.LVL58:
+	.loc 1 78 1 view .LVU210
+	popq	%r12	#
+	.cfi_def_cfa_offset 32
+.LVL59:
+	.loc 1 78 1 view .LVU211
+	popq	%r13	#
+	.cfi_def_cfa_offset 24
+.LVL60:
+	.loc 1 78 1 view .LVU212
+	popq	%r14	#
+	.cfi_def_cfa_offset 16
+.LVL61:
+	.loc 1 78 1 view .LVU213
+	popq	%r15	#
+	.cfi_def_cfa_offset 8
+.LVL62:
+	.loc 1 78 1 view .LVU214
+	ret	
+.LVL63:
+	.p2align 4,,10
+	.p2align 3
+.L54:
+	.cfi_restore 3
+	.cfi_restore 6
+	.cfi_restore 12
+	.cfi_restore 13
+	.cfi_restore 14
+	.cfi_restore 15
+	.loc 1 78 1 view .LVU215
+	ret	
+	.cfi_endproc
+.LFE25:
+	.size	blake2s_many_ctx, .-blake2s_many_ctx
+	.p2align 4
+	.globl	blake2s_many_suffix
+	.type	blake2s_many_suffix, @function
+blake2s_many_suffix:
+.LVL64:
+.LFB26:
+	.loc 1 87 1 is_stmt 1 view -0
+	.cfi_startproc
+	.loc 1 88 5 view .LVU217
+	.loc 1 89 5 view .LVU218
+# blake2s-batch.c:87: {
+	.loc 1 87 1 is_stmt 0 view .LVU219
+	pushq	%r15	#
+	.cfi_def_cfa_offset 16
+	.cfi_offset 15, -16
+	pushq	%r14	#
+	.cfi_def_cfa_offset 24
+	.cfi_offset 14, -24
+	pushq	%r13	#
+	.cfi_def_cfa_offset 32
+	.cfi_offset 13, -32
+	movq	%rdi, %r13	# tmp136, prefix
+	pushq	%r12	#
+	.cfi_def_cfa_offset 40
+	.cfi_offset 12, -40
+	pushq	%rbp	#
+	.cfi_def_cfa_offset 48
+	.cfi_offset 6, -48
+	pushq	%rbx	#
+	.cfi_def_cfa_offset 56
+	.cfi_offset 3, -56
+	subq	$16568, %rsp	#,
+	.cfi_def_cfa_offset 16624
+# blake2s-batch.c:89:     struct blake2s_ctx next = *prefix;
+	.loc 1 89 24 view .LVU220
+	movdqa	(%rdi), %xmm0	# *prefix_21(D), tmp143
+	movl	112(%rdi), %eax	# *prefix_21(D), tmp134
+	movdqa	16(%rdi), %xmm1	# *prefix_21(D), tmp144
+	movdqa	32(%rdi), %xmm2	# *prefix_21(D), tmp145
+# blake2s-batch.c:87: {
+	.loc 1 87 1 view .LVU221
+	movq	%rsi, 32(%rsp)	# tmp137, %sfp
+# blake2s-batch.c:89:     struct blake2s_ctx next = *prefix;
+	.loc 1 89 24 view .LVU222
+	movdqa	48(%rdi), %xmm3	# *prefix_21(D), tmp146
+	movdqa	64(%rdi), %xmm4	# *prefix_21(D), tmp147
+# blake2s-batch.c:87: {
+	.loc 1 87 1 view .LVU223
+	movq	%rdx, 40(%rsp)	# tmp138, %sfp
+# blake2s-batch.c:89:     struct blake2s_ctx next = *prefix;
+	.loc 1 89 24 view .LVU224
+	movdqa	80(%rdi), %xmm5	# *prefix_21(D), tmp148
+	movdqa	96(%rdi), %xmm6	# *prefix_21(D), tmp149
+# blake2s-batch.c:87: {
+	.loc 1 87 1 view .LVU225
+	movq	%rcx, 16(%rsp)	# tmp139, %sfp
+# blake2s-batch.c:89:     struct blake2s_ctx next = *prefix;
+	.loc 1 89 24 view .LVU226
+	movdqa	112(%rdi), %xmm7	# *prefix_21(D), tmp150
+# blake2s-batch.c:87: {
+	.loc 1 87 1 view .LVU227
+	movq	%r8, 8(%rsp)	# tmp140, %sfp
+# blake2s-batch.c:89:     struct blake2s_ctx next = *prefix;
+	.loc 1 89 24 view .LVU228
+	movaps	%xmm0, 48(%rsp)	# tmp143, next
+	movaps	%xmm1, 64(%rsp)	# tmp144, next
+	movaps	%xmm2, 80(%rsp)	# tmp145, next
+	movaps	%xmm3, 96(%rsp)	# tmp146, next
+	movaps	%xmm4, 112(%rsp)	# tmp147, next
+	movaps	%xmm5, 128(%rsp)	# tmp148, next
+	movaps	%xmm6, 144(%rsp)	# tmp149, next
+	movaps	%xmm7, 160(%rsp)	# tmp150, next
+	.loc 1 91 5 is_stmt 1 view .LVU229
+# blake2s-batch.c:91:     if (next.buf_len == BLAKE2S_BLOCK) {
+	.loc 1 91 8 is_stmt 0 view .LVU230
+	cmpl	$64, %eax	#, tmp134
+	jne	.L58	#,
+	.loc 1 92 9 is_stmt 1 view .LVU231
+# blake2s-batch.c:92:         next.t[0] += BLAKE2S_BLOCK;
+	.loc 1 92 19 is_stmt 0 view .LVU232
+	movl	144(%rsp), %eax	# next.t[0], tmp151
+.LBB64:
+.LBB65:
+# blake2s-internal.h:88:     blake2s_kern->compress(ctx, m);
+	.file 2 "blake2s-internal.h"
+	.loc 2 88 5 view .LVU233
+	leaq	48(%rsp), %rdi	#, tmp121
+.LVL65:
+	.loc 2 88 5 view .LVU234
+	leaq	80(%rsp), %rsi	#, tmp122
+.LVL66:
+	.loc 2 88 5 view .LVU235
+.LBE65:
+.LBE64:
+# blake2s-batch.c:92:         next.t[0] += BLAKE2S_BLOCK;
+	.loc 1 92 19 view .LVU236
+	addl	$64, %eax	#, _3
+# blake2s-batch.c:93:         next.t[1] += next.t[0] < BLAKE2S_BLOCK;
+	.loc 1 93 32 view .LVU237
+	cmpl	$63, %eax	#, _3
+# blake2s-batch.c:92:         next.t[0] += BLAKE2S_BLOCK;
+	.loc 1 92 19 view .LVU238
+	movl	%eax, 144(%rsp)	# _3, next.t[0]
+	.loc 1 93 9 is_stmt 1 view .LVU239
+# blake2s-batch.c:93:         next.t[1] += next.t[0] < BLAKE2S_BLOCK;
+	.loc 1 93 32 is_stmt 0 view .LVU240
+	setbe	%al	#, tmp119
+	movzbl	%al, %eax	# tmp119, tmp119
+# blake2s-batch.c:93:         next.t[1] += next.t[0] < BLAKE2S_BLOCK;
+	.loc 1 93 19 view .LVU241
+	addl	%eax, 148(%rsp)	# tmp119, next.t[1]
+	.loc 1 94 9 is_stmt 1 view .LVU242
+.LVL67:
+.LBB67:
+.LBI64:
+	.loc 2 86 20 view .LVU243
+.LBB66:
+	.loc 2 88 5 view .LVU244
+	movq	blake2s_kern(%rip), %rax	# blake2s_kern, blake2s_kern
+	call	*16(%rax)	# blake2s_kern.4_38->compress
+.LVL68:
+	.loc 2 88 5 is_stmt 0 view .LVU245
+.LBE66:
+.LBE67:
+	.loc 1 95 9 is_stmt 1 view .LVU246
+# blake2s-batch.c:95:         next.buf_len = 0;
+	.loc 1 95 22 is_stmt 0 view .LVU247
+	movl	$0, 160(%rsp)	#, next.buf_len
+.L58:
+.LVL69:
+.LBB68:
+	.loc 1 97 26 is_stmt 1 discriminator 1 view .LVU248
+	cmpq	$0, 8(%rsp)	#, %sfp
+	je	.L57	#,
+	leaq	176(%rsp), %rax	#, tmp131
+# blake2s-batch.c:97:     for (size_t i = 0; i < n; i += B2S_BATCH) {
+	.loc 1 97 26 is_stmt 0 view .LVU249
+	xorl	%ebp, %ebp	# i
+	movq	%rax, 24(%rsp)	# tmp131, %sfp
+.LBB69:
+.LBB70:
+# blake2s-batch.c:100:             blake2s_clone(&ctx[j], lens[i + j] ? &next : prefix);
+	.loc 1 100 13 view .LVU250
+	leaq	48(%rsp), %rax	#, tmp162
+	movq	%rax, (%rsp)	# tmp162, %sfp
+.LVL70:
+	.p2align 4,,10
+	.p2align 3
+.L64:
+	.loc 1 100 13 view .LVU251
+.LBE70:
+	.loc 1 98 9 is_stmt 1 view .LVU252
+# blake2s-batch.c:98:         size_t k = n - i < B2S_BATCH ? n - i : B2S_BATCH;
+	.loc 1 98 22 is_stmt 0 view .LVU253
+	movq	8(%rsp), %rdx	# %sfp, n
+# blake2s-batch.c:98:         size_t k = n - i < B2S_BATCH ? n - i : B2S_BATCH;
+	.loc 1 98 16 view .LVU254
+	movl	$128, %eax	#, tmp141
+# blake2s-batch.c:98:         size_t k = n - i < B2S_BATCH ? n - i : B2S_BATCH;
+	.loc 1 98 22 view .LVU255
+	movq	%rdx, %r12	# n, k
+	subq	%rbp, %r12	# i, k
+# blake2s-batch.c:98:         size_t k = n - i < B2S_BATCH ? n - i : B2S_BATCH;
+	.loc 1 98 16 view .LVU256
+	cmpq	%rax, %r12	# tmp141, k
+	cmova	%rax, %r12	# k,, tmp141, k
+.LVL71:
+	.loc 1 99 9 is_stmt 1 view .LVU257
+.LBB71:
+	.loc 1 99 14 view .LVU258
+	.loc 1 99 30 view .LVU259
+	cmpq	%rdx, %rbp	# n, i
+	je	.L60	#,
+	.loc 1 99 30 is_stmt 0 view .LVU260
+	movq	16(%rsp), %rax	# %sfp, lens
+	leaq	0(%rbp,%r12), %rcx	#, tmp127
+	movq	24(%rsp), %r14	# %sfp, ivtmp.101
+	leaq	(%rax,%rbp,8), %r15	#, ivtmp.100
+	leaq	(%rax,%rcx,8), %rbx	#, _55
+.LVL72:
+	.p2align 4,,10
+	.p2align 3
+.L63:
+	.loc 1 100 13 is_stmt 1 view .LVU261
+	cmpq	$0, (%r15)	#, MEM[(const size_t *)_18]
+	movq	(%rsp), %rsi	# %sfp,
+	jne	.L70	#,
+# blake2s-batch.c:100:             blake2s_clone(&ctx[j], lens[i + j] ? &next : prefix);
+	.loc 1 100 13 is_stmt 0 discriminator 4 view .LVU262
+	movq	%r13, %rsi	# prefix,
+.L70:
+	.loc 1 100 13 discriminator 4 view .LVU263
+	movq	%r14, %rdi	# ivtmp.101,
+# blake2s-batch.c:99:         for (size_t j = 0; j < k; j++)
+	.loc 1 99 30 discriminator 4 view .LVU264
+	addq	$8, %r15	#, ivtmp.100
+	subq	$-128, %r14	#, ivtmp.101
+# blake2s-batch.c:100:             blake2s_clone(&ctx[j], lens[i + j] ? &next : prefix);
+	.loc 1 100 13 discriminator 4 view .LVU265
+	call	blake2s_clone@PLT	#
+.LVL73:
+	.loc 1 99 36 is_stmt 1 discriminator 4 view .LVU266
+	.loc 1 99 30 discriminator 4 view .LVU267
+	cmpq	%rbx, %r15	# _55, ivtmp.100
+	jne	.L63	#,
+.L60:
+.LBE71:
+	.loc 1 101 9 view .LVU268
+	subq	$8, %rsp	#,
+	.cfi_def_cfa_offset 16632
+	movq	%rbp, %r9	# i,
+	movq	%rbp, %rsi	# i,
+.LBE69:
+# blake2s-batch.c:97:     for (size_t i = 0; i < n; i += B2S_BATCH) {
+	.loc 1 97 33 is_stmt 0 view .LVU269
+	subq	$-128, %rbp	#, i
+.LVL74:
+.LBB72:
+# blake2s-batch.c:101:         bbatch_run(ctx, i, outs, srcs, lens, i, k);
+	.loc 1 101 9 view .LVU270
+	pushq	%r12	# k
+	.cfi_def_cfa_offset 16640
+	movq	32(%rsp), %r8	# %sfp,
+	movq	56(%rsp), %rcx	# %sfp,
+	movq	48(%rsp), %rdx	# %sfp,
+	movq	40(%rsp), %rdi	# %sfp,
+	call	bbatch_run	#
+.LVL75:
+	.loc 1 101 9 view .LVU271
+.LBE72:
+	.loc 1 97 33 is_stmt 1 view .LVU272
+	.loc 1 97 26 view .LVU273
+	popq	%rax	#
+	.cfi_def_cfa_offset 16632
+	popq	%rdx	#
+	.cfi_def_cfa_offset 16624
+	movq	8(%rsp), %rax	# %sfp, n
+	cmpq	%rax, %rbp	# n, i
+	jb	.L64	#,
+.LVL76:
+.L57:
+	.loc 1 97 26 is_stmt 0 view .LVU274
+.LBE68:
+# blake2s-batch.c:104: }
+	.loc 1 104 1 view .LVU275
+	addq	$16568, %rsp	#,
+	.cfi_def_cfa_offset 56
+	popq	%rbx	#
+	.cfi_def_cfa_offset 48
+	popq	%rbp	#
+	.cfi_def_cfa_offset 40
+	popq	%r12	#
+	.cfi_def_cfa_offset 32
+	popq	%r13	#
+	.cfi_def_cfa_offset 24
+.LVL77:
+	.loc 1 104 1 view .LVU276
+	popq	%r14	#
+	.cfi_def_cfa_offset 16
+	popq	%r15	#
+	.cfi_def_cfa_offset 8
+	ret	
+	.cfi_endproc
+.LFE26:
+	.size	blake2s_many_suffix, .-blake2s_many_suffix
+	.p2align 4
+	.globl	blake2s_mgr_new
+	.type	blake2s_mgr_new, @function
+blake2s_mgr_new:
+.LFB27:
+	.loc 1 126 1 is_stmt 1 view -0
+	.cfi_startproc
+	.loc 1 127 5 view .LVU278
+	.loc 1 128 5 view .LVU279
+	.loc 1 130 5 view .LVU280
+# blake2s-batch.c:126: {
+	.loc 1 126 1 is_stmt 0 view .LVU281
+	subq	$24, %rsp	#,
+	.cfi_def_cfa_offset 32
+# blake2s-batch.c:130:     if (posix_memalign(&p, 64, sizeof(*M)))
+	.loc 1 130 9 view .LVU282
+	movl	$1600, %edx	#,
+	movl	$64, %esi	#,
+	leaq	8(%rsp), %rdi	#, tmp87
+	call	posix_memalign@PLT	#
+.LVL78:
+	xorl	%edx, %edx	# <retval>
+# blake2s-batch.c:130:     if (posix_memalign(&p, 64, sizeof(*M)))
+	.loc 1 130 8 view .LVU283
+	testl	%eax, %eax	# tmp100
+	jne	.L71	#,
+	.loc 1 132 5 is_stmt 1 view .LVU284
+# blake2s-batch.c:132:     M = p;
+	.loc 1 132 7 is_stmt 0 view .LVU285
+	movq	8(%rsp), %rdx	# p, <retval>
+.LVL79:
+	.loc 1 133 5 is_stmt 1 view .LVU286
+	xorl	%eax, %eax	# tmp90
+	leaq	8(%rdx), %rdi	#, tmp94
+	movq	%rdx, %rcx	# <retval>, <retval>
+	movq	$0, (%rdx)	#,* <retval>
+	movq	$0, 1592(%rdx)	#,
+	andq	$-8, %rdi	#, tmp94
+	subq	%rdi, %rcx	# tmp94, <retval>
+	addl	$1600, %ecx	#, tmp89
+	shrl	$3, %ecx	#,
+	rep stosq
+	.loc 1 134 5 view .LVU287
+# blake2s-batch.c:134:     M->kern = blake2s_kern;
+	.loc 1 134 13 is_stmt 0 view .LVU288
+	movq	blake2s_kern(%rip), %rax	# blake2s_kern, blake2s_kern.5_2
+	movq	%rax, 768(%rdx)	# blake2s_kern.5_2, M_9->kern
+	.loc 1 135 5 is_stmt 1 view .LVU289
+# blake2s-batch.c:135:     M->width = M->kern->lanes;
+	.loc 1 135 14 is_stmt 0 view .LVU290
+	movl	32(%rax), %eax	# blake2s_kern.5_2->lanes, blake2s_kern.5_2->lanes
+	movl	%eax, 776(%rdx)	# blake2s_kern.5_2->lanes, M_9->width
+	.loc 1 136 5 is_stmt 1 view .LVU291
+# blake2s-batch.c:136:     M->done_tail = &M->done;
+	.loc 1 136 20 is_stmt 0 view .LVU292
+	leaq	1560(%rdx), %rax	#, tmp98
+	movq	%rax, 1568(%rdx)	# tmp98, M_9->done_tail
+	.loc 1 137 5 is_stmt 1 view .LVU293
+.LVL80:
+.L71:
+# blake2s-batch.c:138: }
+	.loc 1 138 1 is_stmt 0 view .LVU294
+	movq	%rdx, %rax	# <retval>,
+	addq	$24, %rsp	#,
+	.cfi_def_cfa_offset 8
+	ret	
+	.cfi_endproc
+.LFE27:
+	.size	blake2s_mgr_new, .-blake2s_mgr_new
+	.p2align 4
+	.globl	blake2s_mgr_free
+	.type	blake2s_mgr_free, @function
+blake2s_mgr_free:
+.LVL81:
+.LFB28:
+	.loc 1 141 1 is_stmt 1 view -0
+	.cfi_startproc
+	.loc 1 142 5 view .LVU296
+# blake2s-batch.c:142:     if (!M)
+	.loc 1 142 8 is_stmt 0 view .LVU297
+	testq	%rdi, %rdi	# M
+	je	.L76	#,
+	.loc 1 144 5 is_stmt 1 view .LVU298
+	.loc 1 145 5 view .LVU299
+	jmp	free@PLT	#
+.LVL82:
+	.p2align 4,,10
+	.p2align 3
+.L76:
+# blake2s-batch.c:146: }
+	.loc 1 146 1 is_stmt 0 view .LVU300
+	ret	
+	.cfi_endproc
+.LFE28:
+	.size	blake2s_mgr_free, .-blake2s_mgr_free
+	.p2align 4
+	.globl	blake2s_mgr_submit
+	.type	blake2s_mgr_submit, @function
+blake2s_mgr_submit:
+.LVL83:
+.LFB33:
+	.loc 1 202 1 is_stmt 1 view -0
+	.cfi_startproc
+	.loc 1 203 5 view .LVU302
+# blake2s-batch.c:202: {
+	.loc 1 202 1 is_stmt 0 view .LVU303
+	pushq	%r14	#
+	.cfi_def_cfa_offset 16
+	.cfi_offset 14, -16
+	pushq	%r13	#
+	.cfi_def_cfa_offset 24
+	.cfi_offset 13, -24
+	pushq	%r12	#
+	.cfi_def_cfa_offset 32
+	.cfi_offset 12, -32
+	movq	%rsi, %r12	# tmp201, job
+	pushq	%rbp	#
+	.cfi_def_cfa_offset 40
+	.cfi_offset 6, -40
+# blake2s-batch.c:203:     unsigned full = (1u << M->width) - 1, l = 0;
+	.loc 1 203 25 view .LVU304
+	movl	$1, %ebp	#, tmp151
+# blake2s-batch.c:202: {
+	.loc 1 202 1 view .LVU305
+	pushq	%rbx	#
+	.cfi_def_cfa_offset 48
+	.cfi_offset 3, -48
+	movq	%rdi, %rbx	# tmp200, M
+	subq	$16, %rsp	#,
+	.cfi_def_cfa_offset 64
+# blake2s-batch.c:203:     unsigned full = (1u << M->width) - 1, l = 0;
+	.loc 1 203 25 view .LVU306
+	movl	776(%rdi), %ecx	# M_17(D)->width, M_17(D)->width
+# blake2s-batch.c:205:     while (M->busy == full)
+	.loc 1 205 13 view .LVU307
+	movl	780(%rdi), %eax	# M_17(D)->busy, _3
+# blake2s-batch.c:203:     unsigned full = (1u << M->width) - 1, l = 0;
+	.loc 1 203 25 view .LVU308
+	sall	%cl, %ebp	# M_17(D)->width, tmp150
+# blake2s-batch.c:203:     unsigned full = (1u << M->width) - 1, l = 0;
+	.loc 1 203 14 view .LVU309
+	subl	$1, %ebp	#, full
+.LVL84:
+	.loc 1 205 5 is_stmt 1 view .LVU310
+	.loc 1 205 20 view .LVU311
+	cmpl	%eax, %ebp	# _3, full
+	jne	.L79	#,
+.LVL85:
+	.p2align 4,,10
+	.p2align 3
+.L80:
+	.loc 1 206 9 view .LVU312
+	movq	%rbx, %rdi	# M,
+	call	bmgr_step	#
+.LVL86:
+	.loc 1 205 20 view .LVU313
+# blake2s-batch.c:205:     while (M->busy == full)
+	.loc 1 205 13 is_stmt 0 view .LVU314
+	movl	780(%rbx), %eax	# M_17(D)->busy, _3
+# blake2s-batch.c:205:     while (M->busy == full)
+	.loc 1 205 20 view .LVU315
+	cmpl	%ebp, %eax	# full, _3
+	je	.L80	#,
+.L79:
+	.loc 1 207 12 is_stmt 1 view .LVU316
+	movl	%eax, %ebp	# _3, l
+.LVL87:
+	.loc 1 207 12 is_stmt 0 view .LVU317
+	andl	$1, %ebp	#, l
+	je	.L92	#,
+# blake2s-batch.c:203:     unsigned full = (1u << M->width) - 1, l = 0;
+	.loc 1 203 43 view .LVU318
+	xorl	%ebp, %ebp	# l
+.LVL88:
+	.p2align 4,,10
+	.p2align 3
+.L82:
+	.loc 1 208 9 is_stmt 1 view .LVU319
+# blake2s-batch.c:208:         l++;
+	.loc 1 208 10 is_stmt 0 view .LVU320
+	addl	$1, %ebp	#, l
+.LVL89:
+	.loc 1 207 12 is_stmt 1 view .LVU321
+	btl	%ebp, %eax	# l, _3
+	jc	.L82	#,
+	movl	%ebp, %r13d	# l, l
+# blake2s-batch.c:215:     M->busy |= 1u << l;
+	.loc 1 215 19 is_stmt 0 view .LVU322
+	movl	$1, %r14d	#, tmp154
+	.loc 1 215 19 view .LVU323
+	movl	%ebp, %ecx	# l, tmp206
+	movq	%r13, %rsi	# l, tmp156
+	sall	%cl, %r14d	# tmp206, _96
+	.loc 1 215 19 view .LVU324
+	salq	$5, %rsi	#, tmp156
+	addq	$920, %rsi	#, _102
+.LVL90:
+.L81:
+	.loc 1 209 5 is_stmt 1 view .LVU325
+# blake2s-batch.c:209:     M->job[l] = job;
+	.loc 1 209 15 is_stmt 0 view .LVU326
+	movq	%r12, 1432(%rbx,%r13,8)	# job, M_17(D)->job[l_82]
+	.loc 1 210 5 is_stmt 1 view .LVU327
+# blake2s-batch.c:210:     M->lane[l].ctx = job->ctx;
+	.loc 1 210 20 is_stmt 0 view .LVU328
+	movq	%r13, %rcx	# l, tmp161
+	movq	(%r12), %rdx	# MEM <vector(2) long unsigned int> [(void *)job_19(D)], _186
+	.loc 1 211 5 is_stmt 1 view .LVU329
+# blake2s-batch.c:210:     M->lane[l].ctx = job->ctx;
+	.loc 1 210 20 is_stmt 0 view .LVU330
+	movdqu	(%r12), %xmm2	# MEM <vector(2) long unsigned int> [(void *)job_19(D)], tmp209
+	salq	$5, %rcx	#, tmp161
+	movups	%xmm2, 920(%rbx,%rcx)	# tmp209, MEM <vector(2) long unsigned int> [(void *)vectp.129_86]
+	.loc 1 212 5 is_stmt 1 view .LVU331
+# blake2s-batch.c:212:     M->lane[l].len = job->len;
+	.loc 1 212 20 is_stmt 0 view .LVU332
+	movq	16(%r12), %rdi	# job_19(D)->len, job_19(D)->len
+	addq	%rbx, %rcx	# M, _111
+	movq	%rdi, 936(%rcx)	# job_19(D)->len, MEM <size_t> [(struct blake2s_mgr *)_111 + 936B]
+	.loc 1 213 5 is_stmt 1 view .LVU333
+# blake2s-batch.c:213:     M->lane[l].out = job->out;
+	.loc 1 213 20 is_stmt 0 view .LVU334
+	movq	24(%r12), %rdi	# job_19(D)->out, job_19(D)->out
+	movq	%rdi, 944(%rcx)	# job_19(D)->out, MEM <unsigned char *> [(struct blake2s_mgr *)_111 + 944B]
+	.loc 1 214 5 is_stmt 1 view .LVU335
+.LVL91:
+.LBB82:
+.LBI82:
+	.loc 2 183 20 view .LVU336
+.LBB83:
+	.loc 2 186 5 view .LVU337
+.LBB84:
+	.loc 2 186 10 view .LVU338
+	.loc 2 186 28 view .LVU339
+	leaq	0(,%r13,4), %rdi	#, _93
+	leaq	(%rbx,%rdi), %rcx	#, _92
+	leaq	452(%rbx,%rdi), %rdi	#, tmp167
+	cmpq	%rdi, %rdx	# tmp167, _186
+	jnb	.L93	#,
+	leaq	32(%rdx), %rdi	#, tmp170
+	cmpq	%rdi, %rcx	# tmp170, _92
+	jb	.L83	#,
+.L93:
+.LVL92:
+	.loc 2 187 9 view .LVU340
+	movl	12(%rdx), %edi	# BIT_FIELD_REF <MEM <const vector(4) unsigned int> [(unsigned int *)_186], 32, 96>, _182
+	movl	8(%rdx), %r8d	# BIT_FIELD_REF <MEM <const vector(4) unsigned int> [(unsigned int *)_186], 32, 64>, _179
+	movl	4(%rdx), %r9d	# BIT_FIELD_REF <MEM <const vector(4) unsigned int> [(unsigned int *)_186], 32, 32>, _176
+	movl	(%rdx), %r10d	# BIT_FIELD_REF <MEM <const vector(4) unsigned int> [(unsigned int *)_186], 32, 0>, _173
+# blake2s-internal.h:187:         L->H[i][l] = ctx->H[i];
+	.loc 2 187 20 is_stmt 0 view .LVU341
+	movl	%r8d, 128(%rcx)	# _179, MEM[(unsigned int *)_92 + 128B]
+	movl	%r10d, (%rcx)	# _173, MEM[(unsigned int *)_92]
+	movl	%r9d, 64(%rcx)	# _176, MEM[(unsigned int *)_92 + 64B]
+	movl	%edi, 192(%rcx)	# _182, MEM[(unsigned int *)_92 + 192B]
+	.loc 2 186 34 is_stmt 1 view .LVU342
+	.loc 2 186 28 view .LVU343
+	.loc 2 187 9 view .LVU344
+	movl	28(%rdx), %edi	# BIT_FIELD_REF <MEM <const vector(4) unsigned int> [(unsigned int *)_186 + 16B], 32, 96>, _121
+	movl	24(%rdx), %r8d	# BIT_FIELD_REF <MEM <const vector(4) unsigned int> [(unsigned int *)_186 + 16B], 32, 64>, _118
+	movl	20(%rdx), %r9d	# BIT_FIELD_REF <MEM <const vector(4) unsigned int> [(unsigned int *)_186 + 16B], 32, 32>, _115
+	movl	16(%rdx), %r10d	# BIT_FIELD_REF <MEM <const vector(4) unsigned int> [(unsigned int *)_186 + 16B], 32, 0>, _112
+# blake2s-internal.h:187:         L->H[i][l] = ctx->H[i];
+	.loc 2 187 20 is_stmt 0 view .LVU345
+	movl	%edi, 448(%rcx)	# _121,
+	.loc 2 186 34 is_stmt 1 view .LVU346
+	.loc 2 186 28 view .LVU347
+# blake2s-internal.h:187:         L->H[i][l] = ctx->H[i];
+	.loc 2 187 20 is_stmt 0 view .LVU348
+	movl	%r9d, 320(%rcx)	# _115, MEM[(unsigned int *)_92 + 320B]
+	movl	%r10d, 256(%rcx)	# _112, MEM[(unsigned int *)_92 + 256B]
+	movl	%r8d, 384(%rcx)	# _118, MEM[(unsigned int *)_92 + 384B]
+.L85:
+	.loc 2 187 20 view .LVU349
+.LBE84:
+	.loc 2 188 5 is_stmt 1 view .LVU350
+# blake2s-internal.h:188:     L->t[0][l] = ctx->t[0];
+	.loc 2 188 16 is_stmt 0 view .LVU351
+	movl	96(%rdx), %edi	# MEM[(const struct blake2s_ctx *)_186].t[0], MEM[(const struct blake2s_ctx *)_186].t[0]
+.LBE83:
+.LBE82:
+# blake2s-batch.c:215:     M->busy |= 1u << l;
+	.loc 1 215 13 view .LVU352
+	orl	%r14d, %eax	# _96, tmp185
+.LBB89:
+.LBB90:
+# blake2s-batch.c:164:     const void *p = blake2s_lane_next(&M->L, l, &M->lane[l], &last);
+	.loc 1 164 21 view .LVU353
+	leaq	(%rbx,%rsi), %r12	#, _48
+.LVL93:
+	.loc 1 164 21 view .LVU354
+	movl	%ebp, %esi	# l,
+.LBE90:
+.LBE89:
+.LBB98:
+.LBB86:
+# blake2s-internal.h:188:     L->t[0][l] = ctx->t[0];
+	.loc 2 188 16 view .LVU355
+	movl	%edi, 512(%rcx)	# MEM[(const struct blake2s_ctx *)_186].t[0], MEM <u32> [(struct blake2s_lanes *)_92 + 512B]
+	.loc 2 189 5 is_stmt 1 view .LVU356
+# blake2s-internal.h:189:     L->t[1][l] = ctx->t[1];
+	.loc 2 189 16 is_stmt 0 view .LVU357
+	movl	100(%rdx), %edi	# MEM[(const struct blake2s_ctx *)_186].t[1], MEM[(const struct blake2s_ctx *)_186].t[1]
+	movl	%edi, 576(%rcx)	# MEM[(const struct blake2s_ctx *)_186].t[1], MEM <u32> [(struct blake2s_lanes *)_92 + 576B]
+	.loc 2 190 5 is_stmt 1 view .LVU358
+# blake2s-internal.h:190:     L->f[0][l] = ctx->f[0];
+	.loc 2 190 16 is_stmt 0 view .LVU359
+	movl	104(%rdx), %edi	# MEM[(const struct blake2s_ctx *)_186].f[0], MEM[(const struct blake2s_ctx *)_186].f[0]
+# blake2s-internal.h:191:     L->f[1][l] = ctx->f[1];
+	.loc 2 191 16 view .LVU360
+	movl	108(%rdx), %edx	# MEM[(const struct blake2s_ctx *)_186].f[1], MEM[(const struct blake2s_ctx *)_186].f[1]
+.LVL94:
+# blake2s-internal.h:190:     L->f[0][l] = ctx->f[0];
+	.loc 2 190 16 view .LVU361
+	movl	%edi, 640(%rcx)	# MEM[(const struct blake2s_ctx *)_186].f[0], MEM <u32> [(struct blake2s_lanes *)_92 + 640B]
+	.loc 2 191 5 is_stmt 1 view .LVU362
+.LBE86:
+.LBE98:
+.LBB99:
+.LBB93:
+# blake2s-batch.c:164:     const void *p = blake2s_lane_next(&M->L, l, &M->lane[l], &last);
+	.loc 1 164 21 is_stmt 0 view .LVU363
+	movq	%rbx, %rdi	# M,
+.LBE93:
+.LBE99:
+.LBB100:
+.LBB87:
+# blake2s-internal.h:191:     L->f[1][l] = ctx->f[1];
+	.loc 2 191 16 view .LVU364
+	movl	%edx, 704(%rcx)	# MEM[(const struct blake2s_ctx *)_186].f[1], MEM <u32> [(struct blake2s_lanes *)_92 + 704B]
+.LVL95:
+	.loc 2 191 16 view .LVU365
+.LBE87:
+.LBE100:
+	.loc 1 215 5 is_stmt 1 view .LVU366
+.LBB101:
+.LBB94:
+# blake2s-batch.c:164:     const void *p = blake2s_lane_next(&M->L, l, &M->lane[l], &last);
+	.loc 1 164 21 is_stmt 0 view .LVU367
+	leaq	12(%rsp), %rcx	#, tmp186
+	movq	%r12, %rdx	# _48,
+.LBE94:
+.LBE101:
+# blake2s-batch.c:215:     M->busy |= 1u << l;
+	.loc 1 215 13 view .LVU368
+	movl	%eax, 780(%rbx)	# tmp185, M_17(D)->busy
+	.loc 1 216 5 is_stmt 1 view .LVU369
+.LVL96:
+.LBB102:
+.LBI89:
+	.loc 1 161 13 view .LVU370
+.LBB95:
+	.loc 1 163 5 view .LVU371
+	.loc 1 164 5 view .LVU372
+# blake2s-batch.c:164:     const void *p = blake2s_lane_next(&M->L, l, &M->lane[l], &last);
+	.loc 1 164 21 is_stmt 0 view .LVU373
+	call	blake2s_lane_next@PLT	#
+.LVL97:
+	.loc 1 166 5 is_stmt 1 view .LVU374
+# blake2s-batch.c:166:     if (!p) {
+	.loc 1 166 8 is_stmt 0 view .LVU375
+	testq	%rax, %rax	# p
+	je	.L97	#,
+	.loc 1 170 5 is_stmt 1 view .LVU376
+# blake2s-batch.c:170:     M->m[l] = p;
+	.loc 1 170 13 is_stmt 0 view .LVU377
+	movq	%rax, 792(%rbx,%r13,8)	# p, M_17(D)->m[l_82]
+	.loc 1 171 5 is_stmt 1 view .LVU378
+# blake2s-batch.c:171:     if (last)
+	.loc 1 171 8 is_stmt 0 view .LVU379
+	movl	12(%rsp), %eax	# last,
+.LVL98:
+	.loc 1 171 8 view .LVU380
+	testl	%eax, %eax	#
+	jne	.L98	#,
+.LVL99:
+.L87:
+	.loc 1 171 8 view .LVU381
+.LBE95:
+.LBE102:
+	.loc 1 217 5 is_stmt 1 view .LVU382
+.LBB103:
+.LBI103:
+	.loc 1 191 32 view .LVU383
+.LBB104:
+	.loc 1 193 5 view .LVU384
+# blake2s-batch.c:193:     struct blake2s_mgr_job *J = M->done;
+	.loc 1 193 29 is_stmt 0 view .LVU385
+	movq	1560(%rbx), %rax	# M_17(D)->done, <retval>
+.LVL100:
+	.loc 1 195 5 is_stmt 1 view .LVU386
+# blake2s-batch.c:195:     if (J && !(M->done = J->next))
+	.loc 1 195 8 is_stmt 0 view .LVU387
+	testq	%rax, %rax	# <retval>
+	je	.L78	#,
+# blake2s-batch.c:195:     if (J && !(M->done = J->next))
+	.loc 1 195 27 view .LVU388
+	movq	40(%rax), %rdx	# J_29->next, _30
+# blake2s-batch.c:195:     if (J && !(M->done = J->next))
+	.loc 1 195 24 view .LVU389
+	movq	%rdx, 1560(%rbx)	# _30, M_17(D)->done
+# blake2s-batch.c:195:     if (J && !(M->done = J->next))
+	.loc 1 195 11 view .LVU390
+	testq	%rdx, %rdx	# _30
+	je	.L99	#,
+.L78:
+	.loc 1 195 11 view .LVU391
+.LBE104:
+.LBE103:
+# blake2s-batch.c:218: }
+	.loc 1 218 1 view .LVU392
+	addq	$16, %rsp	#,
+	.cfi_remember_state
+	.cfi_def_cfa_offset 48
+	popq	%rbx	#
+	.cfi_def_cfa_offset 40
+.LVL101:
+	.loc 1 218 1 view .LVU393
+	popq	%rbp	#
+	.cfi_def_cfa_offset 32
+	popq	%r12	#
+	.cfi_def_cfa_offset 24
+	popq	%r13	#
+	.cfi_def_cfa_offset 16
+	popq	%r14	#
+	.cfi_def_cfa_offset 8
+	ret	
+.LVL102:
+	.p2align 4,,10
+	.p2align 3
+.L98:
+	.cfi_restore_state
+.LBB106:
+.LBB96:
+	.loc 1 172 9 is_stmt 1 view .LVU394
+# blake2s-batch.c:172:         M->last |= 1u << l;
+	.loc 1 172 17 is_stmt 0 view .LVU395
+	orl	%r14d, 784(%rbx)	# _96, M_17(D)->last
+	jmp	.L87	#
+.LVL103:
+	.p2align 4,,10
+	.p2align 3
+.L99:
+	.loc 1 172 17 view .LVU396
+.LBE96:
+.LBE106:
+.LBB107:
+.LBB105:
+	.loc 1 196 9 is_stmt 1 view .LVU397
+# blake2s-batch.c:196:         M->done_tail = &M->done;
+	.loc 1 196 24 is_stmt 0 view .LVU398
+	leaq	1560(%rbx), %rdx	#, tmp196
+	movq	%rdx, 1568(%rbx)	# tmp196, M_17(D)->done_tail
+	.loc 1 197 5 is_stmt 1 view .LVU399
+.LVL104:
+	.loc 1 197 5 is_stmt 0 view .LVU400
+.LBE105:
+.LBE107:
+# blake2s-batch.c:218: }
+	.loc 1 218 1 view .LVU401
+	addq	$16, %rsp	#,
+	.cfi_remember_state
+	.cfi_def_cfa_offset 48
+	popq	%rbx	#
+	.cfi_def_cfa_offset 40
+.LVL105:
+	.loc 1 218 1 view .LVU402
+	popq	%rbp	#
+	.cfi_def_cfa_offset 32
+	popq	%r12	#
+	.cfi_def_cfa_offset 24
+	popq	%r13	#
+	.cfi_def_cfa_offset 16
+	popq	%r14	#
+	.cfi_def_cfa_offset 8
+	ret	
+.LVL106:
+	.p2align 4,,10
+	.p2align 3
+.L83:
+	.cfi_restore_state
+.LBB108:
+.LBB88:
+.LBB85:
+	.loc 2 187 9 is_stmt 1 view .LVU403
+# blake2s-internal.h:187:         L->H[i][l] = ctx->H[i];
+	.loc 2 187 20 is_stmt 0 view .LVU404
+	movl	(%rdx), %edi	# MEM[(const struct blake2s_ctx *)_186].H[0], MEM[(const struct blake2s_ctx *)_186].H[0]
+	movl	%edi, (%rcx)	# MEM[(const struct blake2s_ctx *)_186].H[0], MEM <u32> [(struct blake2s_lanes *)_92]
+	.loc 2 186 34 is_stmt 1 view .LVU405
+.LVL107:
+	.loc 2 186 28 view .LVU406
+	.loc 2 187 9 view .LVU407
+# blake2s-internal.h:187:         L->H[i][l] = ctx->H[i];
+	.loc 2 187 20 is_stmt 0 view .LVU408
+	movl	4(%rdx), %edi	# MEM[(const struct blake2s_ctx *)_186].H[1], MEM[(const struct blake2s_ctx *)_186].H[1]
+	movl	%edi, 64(%rcx)	# MEM[(const struct blake2s_ctx *)_186].H[1], MEM <u32> [(struct blake2s_lanes *)_92 + 64B]
+	.loc 2 186 34 is_stmt 1 view .LVU409
+.LVL108:
+	.loc 2 186 28 view .LVU410
+	.loc 2 187 9 view .LVU411
+# blake2s-internal.h:187:         L->H[i][l] = ctx->H[i];
+	.loc 2 187 20 is_stmt 0 view .LVU412
+	movl	8(%rdx), %edi	# MEM[(const struct blake2s_ctx *)_186].H[2], MEM[(const struct blake2s_ctx *)_186].H[2]
+	movl	%edi, 128(%rcx)	# MEM[(const struct blake2s_ctx *)_186].H[2], MEM <u32> [(struct blake2s_lanes *)_92 + 128B]
+	.loc 2 186 34 is_stmt 1 view .LVU413
+.LVL109:
+	.loc 2 186 28 view .LVU414
+	.loc 2 187 9 view .LVU415
+# blake2s-internal.h:187:         L->H[i][l] = ctx->H[i];
+	.loc 2 187 20 is_stmt 0 view .LVU416
+	movl	12(%rdx), %edi	# MEM[(const struct blake2s_ctx *)_186].H[3], MEM[(const struct blake2s_ctx *)_186].H[3]
+	movl	%edi, 192(%rcx)	# MEM[(const struct blake2s_ctx *)_186].H[3], MEM <u32> [(struct blake2s_lanes *)_92 + 192B]
+	.loc 2 186 34 is_stmt 1 view .LVU417
+.LVL110:
+	.loc 2 186 28 view .LVU418
+	.loc 2 187 9 view .LVU419
+# blake2s-internal.h:187:         L->H[i][l] = ctx->H[i];
+	.loc 2 187 20 is_stmt 0 view .LVU420
+	movl	16(%rdx), %edi	# MEM[(const struct blake2s_ctx *)_186].H[4], MEM[(const struct blake2s_ctx *)_186].H[4]
+	movl	%edi, 256(%rcx)	# MEM[(const struct blake2s_ctx *)_186].H[4], MEM <u32> [(struct blake2s_lanes *)_92 + 256B]
+	.loc 2 186 34 is_stmt 1 view .LVU421
+.LVL111:
+	.loc 2 186 28 view .LVU422
+	.loc 2 187 9 view .LVU423
+# blake2s-internal.h:187:         L->H[i][l] = ctx->H[i];
+	.loc 2 187 20 is_stmt 0 view .LVU424
+	movl	20(%rdx), %edi	# MEM[(const struct blake2s_ctx *)_186].H[5], MEM[(const struct blake2s_ctx *)_186].H[5]
+	movl	%edi, 320(%rcx)	# MEM[(const struct blake2s_ctx *)_186].H[5], MEM <u32> [(struct blake2s_lanes *)_92 + 320B]
+	.loc 2 186 34 is_stmt 1 view .LVU425
+.LVL112:
+	.loc 2 186 28 view .LVU426
+	.loc 2 187 9 view .LVU427
+# blake2s-internal.h:187:         L->H[i][l] = ctx->H[i];
+	.loc 2 187 20 is_stmt 0 view .LVU428
+	movl	24(%rdx), %edi	# MEM[(const struct blake2s_ctx *)_186].H[6], MEM[(const struct blake2s_ctx *)_186].H[6]
+	movl	%edi, 384(%rcx)	# MEM[(const struct blake2s_ctx *)_186].H[6], MEM <u32> [(struct blake2s_lanes *)_92 + 384B]
+	.loc 2 186 34 is_stmt 1 view .LVU429
+.LVL113:
+	.loc 2 186 28 view .LVU430
+	.loc 2 187 9 view .LVU431
+# blake2s-internal.h:187:         L->H[i][l] = ctx->H[i];
+	.loc 2 187 20 is_stmt 0 view .LVU432
+	movl	28(%rdx), %edi	# MEM[(const struct blake2s_ctx *)_186].H[7], MEM[(const struct blake2s_ctx *)_186].H[7]
+	movl	%edi, 448(%rcx)	# MEM[(const struct blake2s_ctx *)_186].H[7],
+	.loc 2 186 34 is_stmt 1 view .LVU433
+.LVL114:
+	.loc 2 186 28 view .LVU434
+	jmp	.L85	#
+.LVL115:
+	.p2align 4,,10
+	.p2align 3
+.L92:
+	.loc 2 186 28 is_stmt 0 view .LVU435
+.LBE85:
+.LBE88:
+.LBE108:
+# blake2s-batch.c:207:     while (M->busy & (1u << l))
+	.loc 1 207 12 view .LVU436
+	movl	$920, %esi	#, _102
+	movl	$1, %r14d	#, _96
+	.loc 1 207 12 view .LVU437
+	xorl	%r13d, %r13d	# l
+	jmp	.L81	#
+.LVL116:
+	.p2align 4,,10
+	.p2align 3
+.L97:
+.LBB109:
+.LBB97:
+	.loc 1 167 9 is_stmt 1 view .LVU438
+.LBB91:
+.LBI91:
+	.loc 1 148 13 view .LVU439
+.LBB92:
+	.loc 1 150 5 view .LVU440
+# blake2s-batch.c:152:     blake2s_lane_retire(&M->L, l, &M->lane[l]);
+	.loc 1 152 5 is_stmt 0 view .LVU441
+	movq	%r12, %rdx	# _48,
+	movl	%ebp, %esi	# l,
+	movq	%rbx, %rdi	# M,
+# blake2s-batch.c:153:     M->busy &= ~(1u << l);
+	.loc 1 153 16 view .LVU442
+	notl	%r14d	# _60
+# blake2s-batch.c:150:     struct blake2s_mgr_job *J = M->job[l];
+	.loc 1 150 29 view .LVU443
+	movq	1432(%rbx,%r13,8), %r13	# M_17(D)->job[l_82], J
+.LVL117:
+	.loc 1 152 5 is_stmt 1 view .LVU444
+	call	blake2s_lane_retire@PLT	#
+.LVL118:
+	.loc 1 153 5 view .LVU445
+	.loc 1 154 5 view .LVU446
+# blake2s-batch.c:153:     M->busy &= ~(1u << l);
+	.loc 1 153 13 is_stmt 0 view .LVU447
+	movd	%r14d, %xmm3	# _60, _60
+# blake2s-batch.c:153:     M->busy &= ~(1u << l);
+	.loc 1 153 6 view .LVU448
+	movq	780(%rbx), %xmm0	# MEM <vector(2) unsigned int> [(unsigned int *)M_17(D) + 780B], vect__58.132
+# blake2s-batch.c:156:     *M->done_tail = J;
+	.loc 1 156 19 view .LVU449
+	movq	1568(%rbx), %rax	# M_17(D)->done_tail, M_17(D)->done_tail
+# blake2s-batch.c:153:     M->busy &= ~(1u << l);
+	.loc 1 153 13 view .LVU450
+	pshufd	$0xe0, %xmm3, %xmm1	# _60, tmp190
+	pand	%xmm1, %xmm0	# tmp190, vect__61.133
+	movq	%xmm0, 780(%rbx)	# vect__61.133, MEM <vector(2) unsigned int> [(unsigned int *)M_17(D) + 780B]
+	.loc 1 155 5 is_stmt 1 view .LVU451
+# blake2s-batch.c:155:     J->next = NULL;
+	.loc 1 155 13 is_stmt 0 view .LVU452
+	movq	$0, 40(%r13)	#, J_55->next
+	.loc 1 156 5 is_stmt 1 view .LVU453
+# blake2s-batch.c:156:     *M->done_tail = J;
+	.loc 1 156 19 is_stmt 0 view .LVU454
+	movq	%r13, (%rax)	# J, *_64
+	.loc 1 157 5 is_stmt 1 view .LVU455
+# blake2s-batch.c:157:     M->done_tail = &J->next;
+	.loc 1 157 20 is_stmt 0 view .LVU456
+	addq	$40, %r13	#, tmp193
+.LVL119:
+	.loc 1 157 20 view .LVU457
+	movq	%r13, 1568(%rbx)	# tmp193, M_17(D)->done_tail
+.LVL120:
+	.loc 1 157 20 view .LVU458
+.LBE92:
+.LBE91:
+	.loc 1 168 9 is_stmt 1 view .LVU459
+	jmp	.L87	#
+.LBE97:
+.LBE109:
+	.cfi_endproc
+.LFE33:
+	.size	blake2s_mgr_submit, .-blake2s_mgr_submit
+	.p2align 4
+	.globl	blake2s_mgr_flush
+	.type	blake2s_mgr_flush, @function
+blake2s_mgr_flush:
+.LVL121:
+.LFB34:
+	.loc 1 221 1 view -0
+	.cfi_startproc
+	.loc 1 222 5 view .LVU461
+	.loc 1 222 21 view .LVU462
+# blake2s-batch.c:221: {
+	.loc 1 221 1 is_stmt 0 view .LVU463
+	pushq	%rbp	#
+	.cfi_def_cfa_offset 16
+	.cfi_offset 6, -16
+	pushq	%rbx	#
+	.cfi_def_cfa_offset 24
+	.cfi_offset 3, -24
+	movq	%rdi, %rbx	# tmp92, M
+	subq	$8, %rsp	#,
+	.cfi_def_cfa_offset 32
+# blake2s-batch.c:222:     while (!M->done && M->busy)
+	.loc 1 222 14 view .LVU464
+	movq	1560(%rdi), %rbp	# M_5(D)->done, <retval>
+	movq	%rbp, %rax	# <retval>, _1
+# blake2s-batch.c:222:     while (!M->done && M->busy)
+	.loc 1 222 21 view .LVU465
+	testq	%rbp, %rbp	# <retval>
+	je	.L101	#,
+	jmp	.L102	#
+.LVL122:
+	.p2align 4,,10
+	.p2align 3
+.L103:
+	.loc 1 223 9 is_stmt 1 view .LVU466
+	movq	%rbx, %rdi	# M,
+	call	bmgr_step	#
+.LVL123:
+	.loc 1 222 21 view .LVU467
+# blake2s-batch.c:222:     while (!M->done && M->busy)
+	.loc 1 222 14 is_stmt 0 view .LVU468
+	movq	1560(%rbx), %rax	# M_5(D)->done, _1
+# blake2s-batch.c:222:     while (!M->done && M->busy)
+	.loc 1 222 21 view .LVU469
+	testq	%rax, %rax	# _1
+	jne	.L102	#,
+.L101:
+# blake2s-batch.c:222:     while (!M->done && M->busy)
+	.loc 1 222 21 discriminator 1 view .LVU470
+	movl	780(%rbx), %eax	# M_5(D)->busy,
+	testl	%eax, %eax	#
+	jne	.L103	#,
+# blake2s-batch.c:225: }
+	.loc 1 225 1 view .LVU471
+	addq	$8, %rsp	#,
+	.cfi_remember_state
+	.cfi_def_cfa_offset 24
+	movq	%rbp, %rax	# <retval>,
+	popq	%rbx	#
+	.cfi_def_cfa_offset 16
+.LVL124:
+	.loc 1 225 1 view .LVU472
+	popq	%rbp	#
+	.cfi_def_cfa_offset 8
+	ret	
+.LVL125:
+	.p2align 4,,10
+	.p2align 3
+.L102:
+	.cfi_restore_state
+.LBB110:
+.LBB111:
+# blake2s-batch.c:195:     if (J && !(M->done = J->next))
+	.loc 1 195 27 view .LVU473
+	movq	40(%rax), %rdx	# _14->next, _8
+# blake2s-batch.c:195:     if (J && !(M->done = J->next))
+	.loc 1 195 24 view .LVU474
+	movq	%rdx, 1560(%rbx)	# _8, M_5(D)->done
+# blake2s-batch.c:195:     if (J && !(M->done = J->next))
+	.loc 1 195 11 view .LVU475
+	testq	%rdx, %rdx	# _8
+	je	.L105	#,
+.LBE111:
+.LBE110:
+# blake2s-batch.c:222:     while (!M->done && M->busy)
+	.loc 1 222 14 view .LVU476
+	movq	%rax, %rbp	# _1, <retval>
+.L111:
+# blake2s-batch.c:225: }
+	.loc 1 225 1 view .LVU477
+	addq	$8, %rsp	#,
+	.cfi_remember_state
+	.cfi_def_cfa_offset 24
+	movq	%rbp, %rax	# <retval>,
+	popq	%rbx	#
+	.cfi_def_cfa_offset 16
+.LVL126:
+	.loc 1 225 1 view .LVU478
+	popq	%rbp	#
+	.cfi_def_cfa_offset 8
+	ret	
+.LVL127:
+	.p2align 4,,10
+	.p2align 3
+.L105:
+	.cfi_restore_state
+.LBB114:
+.LBB112:
+	.loc 1 196 9 is_stmt 1 view .LVU479
+# blake2s-batch.c:196:         M->done_tail = &M->done;
+	.loc 1 196 24 is_stmt 0 view .LVU480
+	leaq	1560(%rbx), %rdx	#, tmp88
+.LBE112:
+.LBE114:
+# blake2s-batch.c:222:     while (!M->done && M->busy)
+	.loc 1 222 14 view .LVU481
+	movq	%rax, %rbp	# _1, <retval>
+.LBB115:
+.LBB113:
+# blake2s-batch.c:196:         M->done_tail = &M->done;
+	.loc 1 196 24 view .LVU482
+	movq	%rdx, 1568(%rbx)	# tmp88, M_5(D)->done_tail
+	jmp	.L111	#
+.LBE113:
+.LBE115:
+	.cfi_endproc
+.LFE34:
+	.size	blake2s_mgr_flush, .-blake2s_mgr_flush
+.Letext0:
+	.file 3 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stddef.h"
+	.file 4 "/usr/include/x86_64-linux-gnu/bits/types.h"
+	.file 5 "/usr/include/stdlib.h"
+	.file 6 "/usr/include/x86_64-linux-gnu/bits/stdint-uintn.h"
+	.file 7 "blake2s.h"
+	.file 8 "/usr/include/string.h"
+	.section	.debug_info,"",@progbits
+.Ldebug_info0:
+	.long	0x1201
+	.value	0x5
+	.byte	0x1
+	.byte	0x8
+	.long	.Ldebug_abbrev0
+	.uleb128 0x2f
+	.long	.LASF77
+	.byte	0xc
+	.long	.LASF0
+	.long	.LASF1
+	.quad	.Ltext0
+	.quad	.Letext0-.Ltext0
+	.long	.Ldebug_line0
+	.uleb128 0x14
+	.long	.LASF9
+	.byte	0x3
+	.byte	0xd6
+	.byte	0x1b
+	.long	0x3f
+	.uleb128 0xd
+	.long	0x2e
+	.uleb128 0xe
+	.byte	0x8
+	.byte	0x7
+	.long	.LASF2
+	.uleb128 0x30
+	.byte	0x4
+	.byte	0x5
+	.string	"int"
+	.uleb128 0xe
+	.byte	0x8
+	.byte	0x5
+	.long	.LASF3
+	.uleb128 0xe
+	.byte	0x8
+	.byte	0x5
+	.long	.LASF4
+	.uleb128 0xe
+	.byte	0x1
+	.byte	0x8
+	.long	.LASF5
+	.uleb128 0xe
+	.byte	0x2
+	.byte	0x7
+	.long	.LASF6
+	.uleb128 0xe
+	.byte	0x4
+	.byte	0x7
+	.long	.LASF7
+	.uleb128 0xe
+	.byte	0x1
+	.byte	0x6
+	.long	.LASF8
+	.uleb128 0x14
+	.long	.LASF10
+	.byte	0x4
+	.byte	0x26
+	.byte	0x17
+	.long	0x5b
+	.uleb128 0xe
+	.byte	0x2
+	.byte	0x5
+	.long	.LASF11
+	.uleb128 0x14
+	.long	.LASF12
+	.byte	0x4
+	.byte	0x2a
+	.byte	0x16
+	.long	0x69
+	.uleb128 0x31
+	.byte	0x8
+	.uleb128 0xe
+	.byte	0x1
+	.byte	0x6
+	.long	.LASF13
+	.uleb128 0xd
+	.long	0x98
+	.uleb128 0xe
+	.byte	0x8
+	.byte	0x7
+	.long	.LASF14
+	.uleb128 0x32
+	.long	.LASF15
+	.byte	0x5
+	.value	0x33d
+	.byte	0xf
+	.long	0xb8
+	.uleb128 0x3
+	.long	0xbd
+	.uleb128 0x33
+	.long	0x46
+	.long	0xd1
+	.uleb128 0x2
+	.long	0xd1
+	.uleb128 0x2
+	.long	0xd1
+	.byte	0
+	.uleb128 0x3
+	.long	0xdb
+	.uleb128 0xd
+	.long	0xd1
+	.uleb128 0x34
+	.uleb128 0x3
+	.long	0x9f
+	.uleb128 0x14
+	.long	.LASF16
+	.byte	0x6
+	.byte	0x18
+	.byte	0x13
+	.long	0x77
+	.uleb128 0x14
+	.long	.LASF17
+	.byte	0x6
+	.byte	0x1a
+	.byte	0x14
+	.long	0x8a
+	.uleb128 0x35
+	.long	.LASF25
+	.byte	0x80
+	.byte	0x10
+	.byte	0x7
+	.byte	0xf7
+	.byte	0x8
+	.long	0x15d
+	.uleb128 0xf
+	.string	"H"
+	.byte	0x7
+	.byte	0xf8
+	.byte	0xe
+	.long	0x162
+	.byte	0
+	.uleb128 0xf
+	.string	"buf"
+	.byte	0x7
+	.byte	0xf9
+	.byte	0x13
+	.long	0x172
+	.byte	0x20
+	.uleb128 0xf
+	.string	"t"
+	.byte	0x7
+	.byte	0xfa
+	.byte	0xe
+	.long	0x182
+	.byte	0x60
+	.uleb128 0xf
+	.string	"f"
+	.byte	0x7
+	.byte	0xfb
+	.byte	0xe
+	.long	0x182
+	.byte	0x68
+	.uleb128 0x10
+	.long	.LASF18
+	.byte	0x7
+	.byte	0xfc
+	.byte	0xe
+	.long	0x69
+	.byte	0x70
+	.uleb128 0x10
+	.long	.LASF19
+	.byte	0x7
+	.byte	0xfd
+	.byte	0xe
+	.long	0x69
+	.byte	0x74
+	.uleb128 0x10
+	.long	.LASF20
+	.byte	0x7
+	.byte	0xfe
+	.byte	0xe
+	.long	0x69
+	.byte	0x78
+	.byte	0
+	.uleb128 0xd
+	.long	0xf9
+	.uleb128 0xa
+	.long	0xed
+	.long	0x172
+	.uleb128 0x5
+	.long	0x3f
+	.byte	0x7
+	.byte	0
+	.uleb128 0xa
+	.long	0x5b
+	.long	0x182
+	.uleb128 0x5
+	.long	0x3f
+	.byte	0x3f
+	.byte	0
+	.uleb128 0xa
+	.long	0xed
+	.long	0x192
+	.uleb128 0x5
+	.long	0x3f
+	.byte	0x1
+	.byte	0
+	.uleb128 0x36
+	.long	.LASF27
+	.byte	0x30
+	.byte	0x7
+	.value	0x107
+	.byte	0x8
+	.long	0x1ef
+	.uleb128 0x17
+	.string	"ctx"
+	.value	0x108
+	.byte	0x19
+	.long	0x1ef
+	.byte	0
+	.uleb128 0x17
+	.string	"src"
+	.value	0x109
+	.byte	0x11
+	.long	0xd1
+	.byte	0x8
+	.uleb128 0x17
+	.string	"len"
+	.value	0x10a
+	.byte	0xc
+	.long	0x2e
+	.byte	0x10
+	.uleb128 0x17
+	.string	"out"
+	.value	0x10b
+	.byte	0x14
+	.long	0x1f4
+	.byte	0x18
+	.uleb128 0x23
+	.long	.LASF21
+	.value	0x10c
+	.byte	0xb
+	.long	0x96
+	.byte	0x20
+	.uleb128 0x23
+	.long	.LASF22
+	.value	0x10d
+	.byte	0x1d
+	.long	0x1fe
+	.byte	0x28
+	.byte	0
+	.uleb128 0x3
+	.long	0xf9
+	.uleb128 0x3
+	.long	0x5b
+	.uleb128 0xd
+	.long	0x1f4
+	.uleb128 0x3
+	.long	0x192
+	.uleb128 0x24
+	.string	"u8"
+	.byte	0x7
+	.byte	0x11
+	.long	0xe1
+	.uleb128 0xd
+	.long	0x203
+	.uleb128 0x24
+	.string	"u32"
+	.byte	0x8
+	.byte	0x12
+	.long	0xed
+	.uleb128 0xd
+	.long	0x212
+	.uleb128 0xa
+	.long	0x21d
+	.long	0x232
+	.uleb128 0x5
+	.long	0x3f
+	.byte	0x7
+	.byte	0
+	.uleb128 0xd
+	.long	0x222
+	.uleb128 0x25
+	.long	.LASF23
+	.byte	0xa
+	.byte	0x12
+	.long	0x232
+	.byte	0x20
+	.byte	0x67
+	.byte	0xe6
+	.byte	0x9
+	.byte	0x6a
+	.byte	0x85
+	.byte	0xae
+	.byte	0x67
+	.byte	0xbb
+	.byte	0x72
+	.byte	0xf3
+	.byte	0x6e
+	.byte	0x3c
+	.byte	0x3a
+	.byte	0xf5
+	.byte	0x4f
+	.byte	0xa5
+	.byte	0x7f
+	.byte	0x52
+	.byte	0xe
+	.byte	0x51
+	.byte	0x8c
+	.byte	0x68
+	.byte	0x5
+	.byte	0x9b
+	.byte	0xab
+	.byte	0xd9
+	.byte	0x83
+	.byte	0x1f
+	.byte	0x19
+	.byte	0xcd
+	.byte	0xe0
+	.byte	0x5b
+	.uleb128 0xa
+	.long	0x20d
+	.long	0x279
+	.uleb128 0x5
+	.long	0x3f
+	.byte	0x9
+	.uleb128 0x5
+	.long	0x3f
+	.byte	0xf
+	.byte	0
+	.uleb128 0xd
+	.long	0x263
+	.uleb128 0x25
+	.long	.LASF24
+	.byte	0xf
+	.byte	0x11
+	.long	0x279
+	.byte	0xa0
+	.byte	0
+	.byte	0x1
+	.byte	0x2
+	.byte	0x3
+	.byte	0x4
+	.byte	0x5
+	.byte	0x6
+	.byte	0x7
+	.byte	0x8
+	.byte	0x9
+	.byte	0xa
+	.byte	0xb
+	.byte	0xc
+	.byte	0xd
+	.byte	0xe
+	.byte	0xf
+	.byte	0xe
+	.byte	0xa
+	.byte	0x4
+	.byte	0x8
+	.byte	0x9
+	.byte	0xf
+	.byte	0xd
+	.byte	0x6
+	.byte	0x1
+	.byte	0xc
+	.byte	0
+	.byte	0x2
+	.byte	0xb
+	.byte	0x7
+	.byte	0x5
+	.byte	0x3
+	.byte	0xb
+	.byte	0x8
+	.byte	0xc
+	.byte	0
+	.byte	0x5
+	.byte	0x2
+	.byte	0xf
+	.byte	0xd
+	.byte	0xa
+	.byte	0xe
+	.byte	0x3
+	.byte	0x6
+	.byte	0x7
+	.byte	0x1
+	.byte	0x9
+	.byte	0x4
+	.byte	0x7
+	.byte	0x9
+	.byte	0x3
+	.byte	0x1
+	.byte	0xd
+	.byte	0xc
+	.byte	0xb
+	.byte	0xe
+	.byte	0x2
+	.byte	0x6
+	.byte	0x5
+	.byte	0xa
+	.byte	0x4
+	.byte	0
+	.byte	0xf
+	.byte	0x8
+	.byte	0x9
+	.byte	0
+	.byte	0x5
+	.byte	0x7
+	.byte	0x2
+	.byte	0x4
+	.byte	0xa
+	.byte	0xf
+	.byte	0xe
+	.byte	0x1
+	.byte	0xb
+	.byte	0xc
+	.byte	0x6
+	.byte	0x8
+	.byte	0x3
+	.byte	0xd
+	.byte	0x2
+	.byte	0xc
+	.byte	0x6
+	.byte	0xa
+	.byte	0
+	.byte	0xb
+	.byte	0x8
+	.byte	0x3
+	.byte	0x4
+	.byte	0xd
+	.byte	0x7
+	.byte	0x5
+	.byte	0xf
+	.byte	0xe
+	.byte	0x1
+	.byte	0x9
+	.byte	0xc
+	.byte	0x5
+	.byte	0x1
+	.byte	0xf
+	.byte	0xe
+	.byte	0xd
+	.byte	0x4
+	.byte	0xa
+	.byte	0
+	.byte	0x7
+	.byte	0x6
+	.byte	0x3
+	.byte	0x9
+	.byte	0x2
+	.byte	0x8
+	.byte	0xb
+	.byte	0xd
+	.byte	0xb
+	.byte	0x7
+	.byte	0xe
+	.byte	0xc
+	.byte	0x1
+	.byte	0x3
+	.byte	0x9
+	.byte	0x5
+	.byte	0
+	.byte	0xf
+	.byte	0x4
+	.byte	0x8
+	.byte	0x6
+	.byte	0x2
+	.byte	0xa
+	.byte	0x6
+	.byte	0xf
+	.byte	0xe
+	.byte	0x9
+	.byte	0xb
+	.byte	0x3
+	.byte	0
+	.byte	0x8
+	.byte	0xc
+	.byte	0x2
+	.byte	0xd
+	.byte	0x7
+	.byte	0x1
+	.byte	0x4
+	.byte	0xa
+	.byte	0x5
+	.byte	0xa
+	.byte	0x2
+	.byte	0x8
+	.byte	0x4
+	.byte	0x7
+	.byte	0x6
+	.byte	0x1
+	.byte	0x5
+	.byte	0xf
+	.byte	0xb
+	.byte	0x9
+	.byte	0xe
+	.byte	0x3
+	.byte	0xc
+	.byte	0xd
+	.byte	0
+	.uleb128 0x26
+	.long	.LASF26
+	.value	0x300
+	.byte	0x40
+	.byte	0x2
+	.byte	0x25
+	.long	0x35c
+	.uleb128 0xf
+	.string	"H"
+	.byte	0x2
+	.byte	0x26
+	.byte	0x9
+	.long	0x35c
+	.byte	0
+	.uleb128 0x18
+	.string	"t"
+	.byte	0x2
+	.byte	0x27
+	.byte	0x9
+	.long	0x372
+	.value	0x200
+	.uleb128 0x18
+	.string	"f"
+	.byte	0x2
+	.byte	0x28
+	.byte	0x9
+	.long	0x372
+	.value	0x280
+	.byte	0
+	.uleb128 0xa
+	.long	0x212
+	.long	0x372
+	.uleb128 0x5
+	.long	0x3f
+	.byte	0x7
+	.uleb128 0x5
+	.long	0x3f
+	.byte	0xf
+	.byte	0
+	.uleb128 0xa
+	.long	0x212
+	.long	0x388
+	.uleb128 0x5
+	.long	0x3f
+	.byte	0x1
+	.uleb128 0x5
+	.long	0x3f
+	.byte	0xf
+	.byte	0
+	.uleb128 0x1c
+	.long	.LASF28
+	.byte	0x30
+	.byte	0x2
+	.byte	0x31
+	.long	0x3e3
+	.uleb128 0x10
+	.long	.LASF29
+	.byte	0x2
+	.byte	0x32
+	.byte	0x11
+	.long	0xdc
+	.byte	0
+	.uleb128 0x10
+	.long	.LASF30
+	.byte	0x2
+	.byte	0x33
+	.byte	0xb
+	.long	0x3ed
+	.byte	0x8
+	.uleb128 0x10
+	.long	.LASF31
+	.byte	0x2
+	.byte	0x34
+	.byte	0xc
+	.long	0x402
+	.byte	0x10
+	.uleb128 0x10
+	.long	.LASF32
+	.byte	0x2
+	.byte	0x35
+	.byte	0xc
+	.long	0x41c
+	.byte	0x18
+	.uleb128 0x10
+	.long	.LASF33
+	.byte	0x2
+	.byte	0x37
+	.byte	0xe
+	.long	0x69
+	.byte	0x20
+	.uleb128 0x10
+	.long	.LASF34
+	.byte	0x2
+	.byte	0x38
+	.byte	0xc
+	.long	0x440
+	.byte	0x28
+	.byte	0
+	.uleb128 0xd
+	.long	0x388
+	.uleb128 0x37
+	.long	0x46
+	.uleb128 0x3
+	.long	0x3e8
+	.uleb128 0x1d
+	.long	0x402
+	.uleb128 0x2
+	.long	0x1ef
+	.uleb128 0x2
+	.long	0xd1
+	.byte	0
+	.uleb128 0x3
+	.long	0x3f2
+	.uleb128 0x1d
+	.long	0x41c
+	.uleb128 0x2
+	.long	0x1ef
+	.uleb128 0x2
+	.long	0xd1
+	.uleb128 0x2
+	.long	0x2e
+	.byte	0
+	.uleb128 0x3
+	.long	0x407
+	.uleb128 0x1d
+	.long	0x436
+	.uleb128 0x2
+	.long	0x436
+	.uleb128 0x2
+	.long	0x43b
+	.uleb128 0x2
+	.long	0x69
+	.byte	0
+	.uleb128 0x3
+	.long	0x32a
+	.uleb128 0x3
+	.long	0xd1
+	.uleb128 0x3
+	.long	0x421
+	.uleb128 0x38
+	.long	.LASF57
+	.byte	0x2
+	.byte	0x3c
+	.byte	0x25
+	.long	0x451
+	.uleb128 0x3
+	.long	0x3e3
+	.uleb128 0x1c
+	.long	.LASF35
+	.byte	0x20
+	.byte	0x2
+	.byte	0x80
+	.long	0x497
+	.uleb128 0xf
+	.string	"ctx"
+	.byte	0x2
+	.byte	0x81
+	.byte	0x19
+	.long	0x1ef
+	.byte	0
+	.uleb128 0xf
+	.string	"src"
+	.byte	0x2
+	.byte	0x82
+	.byte	0xf
+	.long	0x497
+	.byte	0x8
+	.uleb128 0xf
+	.string	"len"
+	.byte	0x2
+	.byte	0x83
+	.byte	0xc
+	.long	0x2e
+	.byte	0x10
+	.uleb128 0xf
+	.string	"out"
+	.byte	0x2
+	.byte	0x84
+	.byte	0x14
+	.long	0x1f4
+	.byte	0x18
+	.byte	0
+	.uleb128 0x3
+	.long	0x20d
+	.uleb128 0x1c
+	.long	.LASF36
+	.byte	0x10
+	.byte	0x1
+	.byte	0x15
+	.long	0x4c1
+	.uleb128 0x10
+	.long	.LASF37
+	.byte	0x1
+	.byte	0x16
+	.byte	0xc
+	.long	0x2e
+	.byte	0
+	.uleb128 0xf
+	.string	"i"
+	.byte	0x1
+	.byte	0x17
+	.byte	0xc
+	.long	0x2e
+	.byte	0x8
+	.byte	0
+	.uleb128 0xd
+	.long	0x49c
+	.uleb128 0x26
+	.long	.LASF38
+	.value	0x640
+	.byte	0x40
+	.byte	0x1
+	.byte	0x71
+	.long	0x556
+	.uleb128 0x39
+	.string	"L"
+	.byte	0x1
+	.byte	0x72
+	.byte	0x1a
+	.long	0x32a
+	.byte	0x40
+	.byte	0
+	.uleb128 0x12
+	.long	.LASF39
+	.byte	0x73
+	.byte	0x22
+	.long	0x451
+	.value	0x300
+	.uleb128 0x12
+	.long	.LASF40
+	.byte	0x74
+	.byte	0xe
+	.long	0x69
+	.value	0x308
+	.uleb128 0x12
+	.long	.LASF41
+	.byte	0x75
+	.byte	0xe
+	.long	0x69
+	.value	0x30c
+	.uleb128 0x12
+	.long	.LASF42
+	.byte	0x76
+	.byte	0xe
+	.long	0x69
+	.value	0x310
+	.uleb128 0x18
+	.string	"m"
+	.byte	0x1
+	.byte	0x77
+	.byte	0x11
+	.long	0x556
+	.value	0x318
+	.uleb128 0x12
+	.long	.LASF43
+	.byte	0x78
+	.byte	0x18
+	.long	0x566
+	.value	0x398
+	.uleb128 0x18
+	.string	"job"
+	.byte	0x1
+	.byte	0x79
+	.byte	0x1d
+	.long	0x576
+	.value	0x598
+	.uleb128 0x12
+	.long	.LASF44
+	.byte	0x7a
+	.byte	0x1d
+	.long	0x1fe
+	.value	0x618
+	.uleb128 0x12
+	.long	.LASF45
+	.byte	0x7a
+	.byte	0x25
+	.long	0x586
+	.value	0x620
+	.byte	0
+	.uleb128 0xa
+	.long	0xd1
+	.long	0x566
+	.uleb128 0x5
+	.long	0x3f
+	.byte	0xf
+	.byte	0
+	.uleb128 0xa
+	.long	0x456
+	.long	0x576
+	.uleb128 0x5
+	.long	0x3f
+	.byte	0xf
+	.byte	0
+	.uleb128 0xa
+	.long	0x1fe
+	.long	0x586
+	.uleb128 0x5
+	.long	0x3f
+	.byte	0xf
+	.byte	0
+	.uleb128 0x3
+	.long	0x1fe
+	.uleb128 0x27
+	.long	.LASF48
+	.byte	0x2
+	.byte	0x93
+	.byte	0xd
+	.long	0xd1
+	.long	0x5b0
+	.uleb128 0x2
+	.long	0x436
+	.uleb128 0x2
+	.long	0x69
+	.uleb128 0x2
+	.long	0x5b0
+	.uleb128 0x2
+	.long	0x5b5
+	.byte	0
+	.uleb128 0x3
+	.long	0x456
+	.uleb128 0x3
+	.long	0x46
+	.uleb128 0x19
+	.long	.LASF46
+	.byte	0x2
+	.byte	0x95
+	.long	0x5d5
+	.uleb128 0x2
+	.long	0x436
+	.uleb128 0x2
+	.long	0x69
+	.uleb128 0x2
+	.long	0x5b0
+	.byte	0
+	.uleb128 0x28
+	.long	.LASF47
+	.value	0x238
+	.long	0x5e6
+	.uleb128 0x2
+	.long	0x96
+	.byte	0
+	.uleb128 0x3a
+	.long	.LASF49
+	.byte	0x5
+	.value	0x257
+	.byte	0xc
+	.long	0x46
+	.long	0x607
+	.uleb128 0x2
+	.long	0x607
+	.uleb128 0x2
+	.long	0x2e
+	.uleb128 0x2
+	.long	0x2e
+	.byte	0
+	.uleb128 0x3
+	.long	0x96
+	.uleb128 0x27
+	.long	.LASF50
+	.byte	0x8
+	.byte	0x3d
+	.byte	0xe
+	.long	0x96
+	.long	0x62c
+	.uleb128 0x2
+	.long	0x96
+	.uleb128 0x2
+	.long	0x46
+	.uleb128 0x2
+	.long	0x2e
+	.byte	0
+	.uleb128 0x19
+	.long	.LASF51
+	.byte	0x7
+	.byte	0x5c
+	.long	0x642
+	.uleb128 0x2
+	.long	0x1ef
+	.uleb128 0x2
+	.long	0x642
+	.byte	0
+	.uleb128 0x3
+	.long	0x15d
+	.uleb128 0x19
+	.long	.LASF52
+	.byte	0x2
+	.byte	0x87
+	.long	0x65d
+	.uleb128 0x2
+	.long	0x5b0
+	.uleb128 0x2
+	.long	0x2e
+	.byte	0
+	.uleb128 0x28
+	.long	.LASF53
+	.value	0x353
+	.long	0x67d
+	.uleb128 0x2
+	.long	0x96
+	.uleb128 0x2
+	.long	0x2e
+	.uleb128 0x2
+	.long	0x2e
+	.uleb128 0x2
+	.long	0xab
+	.byte	0
+	.uleb128 0x19
+	.long	.LASF54
+	.byte	0x7
+	.byte	0x2a
+	.long	0x68e
+	.uleb128 0x2
+	.long	0x1ef
+	.byte	0
+	.uleb128 0x1e
+	.long	.LASF55
+	.byte	0xdc
+	.byte	0x19
+	.long	0x1fe
+	.quad	.LFB34
+	.quad	.LFE34-.LFB34
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0x6f6
+	.uleb128 0xb
+	.string	"M"
+	.byte	0xdc
+	.byte	0x3f
+	.long	0x6f6
+	.long	.LLST86
+	.long	.LVUS86
+	.uleb128 0x3b
+	.long	0x8e9
+	.long	.LLRL87
+	.byte	0x1
+	.byte	0xe0
+	.byte	0xc
+	.long	0x6e1
+	.uleb128 0x3c
+	.long	0x8f8
+	.uleb128 0x8
+	.long	.LLRL87
+	.uleb128 0x1f
+	.long	0x902
+	.byte	0
+	.byte	0
+	.uleb128 0x9
+	.quad	.LVL123
+	.long	0x90d
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x73
+	.sleb128 0
+	.byte	0
+	.byte	0
+	.uleb128 0x3
+	.long	0x4c6
+	.uleb128 0x1e
+	.long	.LASF56
+	.byte	0xc8
+	.byte	0x19
+	.long	0x1fe
+	.quad	.LFB33
+	.quad	.LFE33-.LFB33
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0x8e9
+	.uleb128 0xb
+	.string	"M"
+	.byte	0xc8
+	.byte	0x40
+	.long	0x6f6
+	.long	.LLST66
+	.long	.LVUS66
+	.uleb128 0xb
+	.string	"job"
+	.byte	0xc9
+	.byte	0x44
+	.long	0x1fe
+	.long	.LLST67
+	.long	.LVUS67
+	.uleb128 0x29
+	.long	.LASF58
+	.byte	0xcb
+	.long	0x69
+	.long	.LLST68
+	.long	.LVUS68
+	.uleb128 0x6
+	.string	"l"
+	.byte	0xcb
+	.byte	0x2b
+	.long	0x69
+	.long	.LLST69
+	.long	.LVUS69
+	.uleb128 0x15
+	.long	0x1127
+	.quad	.LBI82
+	.byte	.LVU336
+	.long	.LLRL70
+	.byte	0xd6
+	.byte	0x5
+	.long	0x7ba
+	.uleb128 0x4
+	.long	0x1148
+	.long	.LLST71
+	.long	.LVUS71
+	.uleb128 0x4
+	.long	0x113e
+	.long	.LLST72
+	.long	.LVUS72
+	.uleb128 0x4
+	.long	0x1134
+	.long	.LLST73
+	.long	.LVUS73
+	.uleb128 0x3d
+	.long	0x1154
+	.long	.LLRL74
+	.uleb128 0x11
+	.long	0x1155
+	.long	.LLST75
+	.long	.LVUS75
+	.byte	0
+	.byte	0
+	.uleb128 0x15
+	.long	0xac2
+	.quad	.LBI89
+	.byte	.LVU370
+	.long	.LLRL76
+	.byte	0xd8
+	.byte	0x5
+	.long	0x89b
+	.uleb128 0x4
+	.long	0xad9
+	.long	.LLST77
+	.long	.LVUS77
+	.uleb128 0x4
+	.long	0xacf
+	.long	.LLST78
+	.long	.LVUS78
+	.uleb128 0x8
+	.long	.LLRL76
+	.uleb128 0x2a
+	.long	0xae3
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -52
+	.uleb128 0x11
+	.long	0xaef
+	.long	.LLST79
+	.long	.LVUS79
+	.uleb128 0x3e
+	.long	0xafa
+	.quad	.LBI91
+	.byte	.LVU439
+	.quad	.LBB91
+	.quad	.LBE91-.LBB91
+	.byte	0x1
+	.byte	0xa7
+	.byte	0x9
+	.long	0x873
+	.uleb128 0x4
+	.long	0xb11
+	.long	.LLST80
+	.long	.LVUS80
+	.uleb128 0x4
+	.long	0xb07
+	.long	.LLST81
+	.long	.LVUS81
+	.uleb128 0x11
+	.long	0xb1b
+	.long	.LLST82
+	.long	.LVUS82
+	.uleb128 0x9
+	.quad	.LVL118
+	.long	0x5ba
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x73
+	.sleb128 0
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x2
+	.byte	0x76
+	.sleb128 0
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x51
+	.uleb128 0x2
+	.byte	0x7c
+	.sleb128 0
+	.byte	0
+	.byte	0
+	.uleb128 0x9
+	.quad	.LVL97
+	.long	0x58b
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x73
+	.sleb128 0
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x2
+	.byte	0x76
+	.sleb128 0
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x51
+	.uleb128 0x2
+	.byte	0x7c
+	.sleb128 0
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x52
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -52
+	.byte	0
+	.byte	0
+	.byte	0
+	.uleb128 0x15
+	.long	0x8e9
+	.quad	.LBI103
+	.byte	.LVU383
+	.long	.LLRL83
+	.byte	0xd9
+	.byte	0xc
+	.long	0x8d4
+	.uleb128 0x4
+	.long	0x8f8
+	.long	.LLST84
+	.long	.LVUS84
+	.uleb128 0x8
+	.long	.LLRL83
+	.uleb128 0x11
+	.long	0x902
+	.long	.LLST85
+	.long	.LVUS85
+	.byte	0
+	.byte	0
+	.uleb128 0x9
+	.quad	.LVL86
+	.long	0x90d
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x73
+	.sleb128 0
+	.byte	0
+	.byte	0
+	.uleb128 0x2b
+	.long	.LASF73
+	.byte	0xbf
+	.byte	0x20
+	.long	0x1fe
+	.long	0x90d
+	.uleb128 0xc
+	.string	"M"
+	.byte	0x1
+	.byte	0xbf
+	.byte	0x3d
+	.long	0x6f6
+	.uleb128 0x13
+	.string	"J"
+	.byte	0x1
+	.byte	0xc1
+	.byte	0x1d
+	.long	0x1fe
+	.byte	0
+	.uleb128 0x2c
+	.long	.LASF70
+	.byte	0xb0
+	.quad	.LFB31
+	.quad	.LFE31-.LFB31
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0xac2
+	.uleb128 0xb
+	.string	"M"
+	.byte	0xb0
+	.byte	0x2b
+	.long	0x6f6
+	.long	.LLST19
+	.long	.LVUS19
+	.uleb128 0x29
+	.long	.LASF41
+	.byte	0xb2
+	.long	0x69
+	.long	.LLST20
+	.long	.LVUS20
+	.uleb128 0x20
+	.long	.LLRL21
+	.long	0xaa4
+	.uleb128 0x6
+	.string	"l"
+	.byte	0xb5
+	.byte	0x13
+	.long	0x69
+	.long	.LLST22
+	.long	.LVUS22
+	.uleb128 0x15
+	.long	0xafa
+	.quad	.LBI37
+	.byte	.LVU92
+	.long	.LLRL23
+	.byte	0xb9
+	.byte	0xd
+	.long	0x9cc
+	.uleb128 0x4
+	.long	0xb11
+	.long	.LLST24
+	.long	.LVUS24
+	.uleb128 0x4
+	.long	0xb07
+	.long	.LLST25
+	.long	.LVUS25
+	.uleb128 0x8
+	.long	.LLRL23
+	.uleb128 0x11
+	.long	0xb1b
+	.long	.LLST26
+	.long	.LVUS26
+	.uleb128 0x9
+	.quad	.LVL30
+	.long	0x5ba
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x76
+	.sleb128 0
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x2
+	.byte	0x73
+	.sleb128 0
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x51
+	.uleb128 0x2
+	.byte	0x7f
+	.sleb128 0
+	.byte	0
+	.byte	0
+	.byte	0
+	.uleb128 0x21
+	.long	0xac2
+	.quad	.LBI40
+	.byte	.LVU126
+	.long	.LLRL27
+	.byte	0xbb
+	.byte	0xd
+	.uleb128 0x4
+	.long	0xad9
+	.long	.LLST28
+	.long	.LVUS28
+	.uleb128 0x4
+	.long	0xacf
+	.long	.LLST29
+	.long	.LVUS29
+	.uleb128 0x8
+	.long	.LLRL27
+	.uleb128 0x2a
+	.long	0xae3
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -68
+	.uleb128 0x11
+	.long	0xaef
+	.long	.LLST30
+	.long	.LVUS30
+	.uleb128 0x15
+	.long	0xafa
+	.quad	.LBI42
+	.byte	.LVU149
+	.long	.LLRL31
+	.byte	0xa7
+	.byte	0x9
+	.long	0xa7b
+	.uleb128 0x4
+	.long	0xb11
+	.long	.LLST32
+	.long	.LVUS32
+	.uleb128 0x4
+	.long	0xb07
+	.long	.LLST33
+	.long	.LVUS33
+	.uleb128 0x8
+	.long	.LLRL31
+	.uleb128 0x11
+	.long	0xb1b
+	.long	.LLST34
+	.long	.LVUS34
+	.uleb128 0x9
+	.quad	.LVL44
+	.long	0x5ba
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x76
+	.sleb128 0
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x2
+	.byte	0x73
+	.sleb128 0
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x51
+	.uleb128 0x2
+	.byte	0x7f
+	.sleb128 0
+	.byte	0
+	.byte	0
+	.byte	0
+	.uleb128 0x9
+	.quad	.LVL35
+	.long	0x58b
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x76
+	.sleb128 0
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x2
+	.byte	0x73
+	.sleb128 0
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x51
+	.uleb128 0x2
+	.byte	0x7f
+	.sleb128 0
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x52
+	.uleb128 0x2
+	.byte	0x7e
+	.sleb128 0
+	.byte	0
+	.byte	0
+	.byte	0
+	.byte	0
+	.uleb128 0x2d
+	.quad	.LVL27
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x76
+	.sleb128 0
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x3
+	.byte	0x76
+	.sleb128 792
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x51
+	.uleb128 0x2
+	.byte	0x7d
+	.sleb128 0
+	.byte	0
+	.byte	0
+	.uleb128 0x1a
+	.long	.LASF59
+	.byte	0x1
+	.byte	0xa1
+	.byte	0xd
+	.byte	0x1
+	.long	0xafa
+	.uleb128 0xc
+	.string	"M"
+	.byte	0x1
+	.byte	0xa1
+	.byte	0x2e
+	.long	0x6f6
+	.uleb128 0xc
+	.string	"l"
+	.byte	0x1
+	.byte	0xa1
+	.byte	0x3a
+	.long	0x69
+	.uleb128 0x3f
+	.long	.LASF42
+	.byte	0x1
+	.byte	0xa3
+	.byte	0x9
+	.long	0x46
+	.uleb128 0x13
+	.string	"p"
+	.byte	0x1
+	.byte	0xa4
+	.byte	0x11
+	.long	0xd1
+	.byte	0
+	.uleb128 0x1a
+	.long	.LASF60
+	.byte	0x1
+	.byte	0x94
+	.byte	0xd
+	.byte	0x1
+	.long	0xb26
+	.uleb128 0xc
+	.string	"M"
+	.byte	0x1
+	.byte	0x94
+	.byte	0x2f
+	.long	0x6f6
+	.uleb128 0xc
+	.string	"l"
+	.byte	0x1
+	.byte	0x94
+	.byte	0x3b
+	.long	0x69
+	.uleb128 0x13
+	.string	"J"
+	.byte	0x1
+	.byte	0x96
+	.byte	0x1d
+	.long	0x1fe
+	.byte	0
+	.uleb128 0x1b
+	.long	.LASF62
+	.byte	0x8c
+	.quad	.LFB28
+	.quad	.LFE28-.LFB28
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0xb69
+	.uleb128 0xb
+	.string	"M"
+	.byte	0x8c
+	.byte	0x2b
+	.long	0x6f6
+	.long	.LLST65
+	.long	.LVUS65
+	.uleb128 0x40
+	.quad	.LVL82
+	.long	0x5d5
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x3
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0
+	.byte	0
+	.uleb128 0x1e
+	.long	.LASF61
+	.byte	0x7d
+	.byte	0x15
+	.long	0x6f6
+	.quad	.LFB27
+	.quad	.LFE27-.LFB27
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0xbc9
+	.uleb128 0x16
+	.string	"p"
+	.byte	0x7f
+	.byte	0xb
+	.long	0x96
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -24
+	.uleb128 0x6
+	.string	"M"
+	.byte	0x80
+	.byte	0x19
+	.long	0x6f6
+	.long	.LLST64
+	.long	.LVUS64
+	.uleb128 0x9
+	.quad	.LVL78
+	.long	0x5e6
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -24
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x2
+	.byte	0x8
+	.byte	0x40
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x51
+	.uleb128 0x3
+	.byte	0xa
+	.value	0x640
+	.byte	0
+	.byte	0
+	.uleb128 0x1b
+	.long	.LASF63
+	.byte	0x54
+	.quad	.LFB26
+	.quad	.LFE26-.LFB26
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0xd5b
+	.uleb128 0x7
+	.long	.LASF64
+	.byte	0x54
+	.byte	0x34
+	.long	0x642
+	.long	.LLST51
+	.long	.LVUS51
+	.uleb128 0x7
+	.long	.LASF65
+	.byte	0x55
+	.byte	0x30
+	.long	0xd5b
+	.long	.LLST52
+	.long	.LVUS52
+	.uleb128 0x7
+	.long	.LASF66
+	.byte	0x55
+	.byte	0x49
+	.long	0xd60
+	.long	.LLST53
+	.long	.LVUS53
+	.uleb128 0x7
+	.long	.LASF67
+	.byte	0x56
+	.byte	0x28
+	.long	0xd65
+	.long	.LLST54
+	.long	.LVUS54
+	.uleb128 0xb
+	.string	"n"
+	.byte	0x56
+	.byte	0x35
+	.long	0x2e
+	.long	.LLST55
+	.long	.LVUS55
+	.uleb128 0x16
+	.string	"ctx"
+	.byte	0x58
+	.byte	0x18
+	.long	0xd6a
+	.uleb128 0x4
+	.byte	0x91
+	.sleb128 -16448
+	.uleb128 0x41
+	.long	.LASF22
+	.byte	0x1
+	.byte	0x59
+	.byte	0x18
+	.long	0xf9
+	.uleb128 0x4
+	.byte	0x91
+	.sleb128 -16576
+	.uleb128 0x22
+	.quad	.LBB68
+	.quad	.LBE68-.LBB68
+	.long	0xd11
+	.uleb128 0x6
+	.string	"i"
+	.byte	0x61
+	.byte	0x11
+	.long	0x2e
+	.long	.LLST59
+	.long	.LVUS59
+	.uleb128 0x8
+	.long	.LLRL60
+	.uleb128 0x6
+	.string	"k"
+	.byte	0x62
+	.byte	0x10
+	.long	0x2e
+	.long	.LLST61
+	.long	.LVUS61
+	.uleb128 0x20
+	.long	.LLRL62
+	.long	0xccf
+	.uleb128 0x6
+	.string	"j"
+	.byte	0x63
+	.byte	0x15
+	.long	0x2e
+	.long	.LLST63
+	.long	.LVUS63
+	.uleb128 0x9
+	.quad	.LVL73
+	.long	0x62c
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x3
+	.byte	0x7e
+	.sleb128 -128
+	.byte	0
+	.byte	0
+	.uleb128 0x9
+	.quad	.LVL75
+	.long	0xf5c
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x5
+	.byte	0x91
+	.sleb128 -16600
+	.byte	0x6
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x3
+	.byte	0x76
+	.sleb128 -128
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x51
+	.uleb128 0x5
+	.byte	0x91
+	.sleb128 -16592
+	.byte	0x6
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x52
+	.uleb128 0x5
+	.byte	0x91
+	.sleb128 -16584
+	.byte	0x6
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x58
+	.uleb128 0x5
+	.byte	0x91
+	.sleb128 -16608
+	.byte	0x6
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x59
+	.uleb128 0x3
+	.byte	0x76
+	.sleb128 -128
+	.byte	0
+	.byte	0
+	.byte	0
+	.uleb128 0x21
+	.long	0x1161
+	.quad	.LBI64
+	.byte	.LVU243
+	.long	.LLRL56
+	.byte	0x5e
+	.byte	0x9
+	.uleb128 0x4
+	.long	0x117a
+	.long	.LLST57
+	.long	.LVUS57
+	.uleb128 0x4
+	.long	0x116e
+	.long	.LLST58
+	.long	.LVUS58
+	.uleb128 0x2d
+	.quad	.LVL68
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x4
+	.byte	0x91
+	.sleb128 -16576
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x4
+	.byte	0x91
+	.sleb128 -16544
+	.byte	0
+	.byte	0
+	.byte	0
+	.uleb128 0x3
+	.long	0x1f9
+	.uleb128 0x3
+	.long	0xd6
+	.uleb128 0x3
+	.long	0x3a
+	.uleb128 0x42
+	.long	0xf9
+	.byte	0x10
+	.long	0xd7b
+	.uleb128 0x5
+	.long	0x3f
+	.byte	0x7f
+	.byte	0
+	.uleb128 0x1b
+	.long	.LASF68
+	.byte	0x48
+	.quad	.LFB25
+	.quad	.LFE25-.LFB25
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0xe3e
+	.uleb128 0xb
+	.string	"ctx"
+	.byte	0x48
+	.byte	0x2b
+	.long	0x1ef
+	.long	.LLST44
+	.long	.LVUS44
+	.uleb128 0x7
+	.long	.LASF65
+	.byte	0x48
+	.byte	0x46
+	.long	0xd5b
+	.long	.LLST45
+	.long	.LVUS45
+	.uleb128 0x7
+	.long	.LASF66
+	.byte	0x49
+	.byte	0x2a
+	.long	0xd60
+	.long	.LLST46
+	.long	.LVUS46
+	.uleb128 0x7
+	.long	.LASF67
+	.byte	0x49
+	.byte	0x3e
+	.long	0xd65
+	.long	.LLST47
+	.long	.LVUS47
+	.uleb128 0xb
+	.string	"n"
+	.byte	0x49
+	.byte	0x4b
+	.long	0x2e
+	.long	.LLST48
+	.long	.LVUS48
+	.uleb128 0x8
+	.long	.LLRL49
+	.uleb128 0x6
+	.string	"i"
+	.byte	0x4b
+	.byte	0x11
+	.long	0x2e
+	.long	.LLST50
+	.long	.LVUS50
+	.uleb128 0x9
+	.quad	.LVL56
+	.long	0xf5c
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x76
+	.sleb128 0
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x1
+	.byte	0x30
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x51
+	.uleb128 0x2
+	.byte	0x7c
+	.sleb128 0
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x52
+	.uleb128 0x2
+	.byte	0x7d
+	.sleb128 0
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x58
+	.uleb128 0x2
+	.byte	0x7e
+	.sleb128 0
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x59
+	.uleb128 0x3
+	.byte	0x73
+	.sleb128 -128
+	.byte	0
+	.byte	0
+	.byte	0
+	.uleb128 0x1b
+	.long	.LASF69
+	.byte	0x3b
+	.quad	.LFB24
+	.quad	.LFE24-.LFB24
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0xf5c
+	.uleb128 0x7
+	.long	.LASF65
+	.byte	0x3b
+	.byte	0x29
+	.long	0xd5b
+	.long	.LLST35
+	.long	.LVUS35
+	.uleb128 0x7
+	.long	.LASF66
+	.byte	0x3b
+	.byte	0x42
+	.long	0xd60
+	.long	.LLST36
+	.long	.LVUS36
+	.uleb128 0x7
+	.long	.LASF67
+	.byte	0x3c
+	.byte	0x21
+	.long	0xd65
+	.long	.LLST37
+	.long	.LVUS37
+	.uleb128 0xb
+	.string	"n"
+	.byte	0x3c
+	.byte	0x2e
+	.long	0x2e
+	.long	.LLST38
+	.long	.LVUS38
+	.uleb128 0x16
+	.string	"ctx"
+	.byte	0x3e
+	.byte	0x18
+	.long	0xd6a
+	.uleb128 0x4
+	.byte	0x91
+	.sleb128 -16448
+	.uleb128 0x8
+	.long	.LLRL39
+	.uleb128 0x6
+	.string	"i"
+	.byte	0x40
+	.byte	0x11
+	.long	0x2e
+	.long	.LLST40
+	.long	.LVUS40
+	.uleb128 0x8
+	.long	.LLRL41
+	.uleb128 0x6
+	.string	"k"
+	.byte	0x41
+	.byte	0x10
+	.long	0x2e
+	.long	.LLST42
+	.long	.LVUS42
+	.uleb128 0x22
+	.quad	.LBB58
+	.quad	.LBE58-.LBB58
+	.long	0xf1c
+	.uleb128 0x6
+	.string	"j"
+	.byte	0x42
+	.byte	0x15
+	.long	0x2e
+	.long	.LLST43
+	.long	.LVUS43
+	.uleb128 0x9
+	.quad	.LVL49
+	.long	0x67d
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x3
+	.byte	0x7f
+	.sleb128 -128
+	.byte	0
+	.byte	0
+	.uleb128 0x9
+	.quad	.LVL51
+	.long	0xf5c
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x7e
+	.sleb128 0
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x3
+	.byte	0x76
+	.sleb128 -128
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x51
+	.uleb128 0x5
+	.byte	0x91
+	.sleb128 -16472
+	.byte	0x6
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x52
+	.uleb128 0x5
+	.byte	0x91
+	.sleb128 -16464
+	.byte	0x6
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x58
+	.uleb128 0x5
+	.byte	0x91
+	.sleb128 -16456
+	.byte	0x6
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x59
+	.uleb128 0x3
+	.byte	0x76
+	.sleb128 -128
+	.byte	0
+	.byte	0
+	.byte	0
+	.byte	0
+	.uleb128 0x2c
+	.long	.LASF71
+	.byte	0x24
+	.quad	.LFB23
+	.quad	.LFE23-.LFB23
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0x10ca
+	.uleb128 0xb
+	.string	"ctx"
+	.byte	0x24
+	.byte	0x2c
+	.long	0x1ef
+	.long	.LLST0
+	.long	.LVUS0
+	.uleb128 0x7
+	.long	.LASF72
+	.byte	0x24
+	.byte	0x38
+	.long	0x2e
+	.long	.LLST1
+	.long	.LVUS1
+	.uleb128 0x7
+	.long	.LASF65
+	.byte	0x25
+	.byte	0x2e
+	.long	0xd5b
+	.long	.LLST2
+	.long	.LVUS2
+	.uleb128 0x7
+	.long	.LASF66
+	.byte	0x25
+	.byte	0x47
+	.long	0xd60
+	.long	.LLST3
+	.long	.LVUS3
+	.uleb128 0x7
+	.long	.LASF67
+	.byte	0x26
+	.byte	0x26
+	.long	0xd65
+	.long	.LLST4
+	.long	.LVUS4
+	.uleb128 0xb
+	.string	"i"
+	.byte	0x26
+	.byte	0x33
+	.long	0x2e
+	.long	.LLST5
+	.long	.LVUS5
+	.uleb128 0xb
+	.string	"k"
+	.byte	0x26
+	.byte	0x3d
+	.long	0x2e
+	.long	.LLST6
+	.long	.LVUS6
+	.uleb128 0x16
+	.string	"job"
+	.byte	0x28
+	.byte	0x18
+	.long	0x10ca
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -4160
+	.uleb128 0x16
+	.string	"key"
+	.byte	0x29
+	.byte	0x17
+	.long	0x10da
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -6208
+	.uleb128 0x20
+	.long	.LLRL7
+	.long	0x104b
+	.uleb128 0x6
+	.string	"j"
+	.byte	0x2b
+	.byte	0x11
+	.long	0x2e
+	.long	.LLST8
+	.long	.LVUS8
+	.uleb128 0x8
+	.long	.LLRL9
+	.uleb128 0x6
+	.string	"len"
+	.byte	0x2c
+	.byte	0x10
+	.long	0x2e
+	.long	.LLST10
+	.long	.LVUS10
+	.byte	0
+	.byte	0
+	.uleb128 0x22
+	.quad	.LBB20
+	.quad	.LBE20-.LBB20
+	.long	0x108a
+	.uleb128 0x6
+	.string	"j"
+	.byte	0x31
+	.byte	0x11
+	.long	0x2e
+	.long	.LLST11
+	.long	.LVUS11
+	.uleb128 0x8
+	.long	.LLRL12
+	.uleb128 0x6
+	.string	"at"
+	.byte	0x32
+	.byte	0x10
+	.long	0x2e
+	.long	.LLST13
+	.long	.LVUS13
+	.byte	0
+	.byte	0
+	.uleb128 0x43
+	.quad	.LVL14
+	.long	0x65d
+	.long	0x10bc
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -6208
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 0
+	.byte	0x6
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x51
+	.uleb128 0x1
+	.byte	0x40
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x52
+	.uleb128 0x9
+	.byte	0x3
+	.quad	bbatch_cmp
+	.byte	0
+	.uleb128 0x44
+	.quad	.LVL17
+	.long	0x647
+	.byte	0
+	.uleb128 0xa
+	.long	0x456
+	.long	0x10da
+	.uleb128 0x5
+	.long	0x3f
+	.byte	0x7f
+	.byte	0
+	.uleb128 0xa
+	.long	0x49c
+	.long	0x10ea
+	.uleb128 0x5
+	.long	0x3f
+	.byte	0x7f
+	.byte	0
+	.uleb128 0x2b
+	.long	.LASF74
+	.byte	0x1a
+	.byte	0xc
+	.long	0x46
+	.long	0x1122
+	.uleb128 0xc
+	.string	"a"
+	.byte	0x1
+	.byte	0x1a
+	.byte	0x23
+	.long	0xd1
+	.uleb128 0xc
+	.string	"b"
+	.byte	0x1
+	.byte	0x1a
+	.byte	0x32
+	.long	0xd1
+	.uleb128 0x13
+	.string	"x"
+	.byte	0x1
+	.byte	0x1c
+	.byte	0x1e
+	.long	0x1122
+	.uleb128 0x13
+	.string	"y"
+	.byte	0x1
+	.byte	0x1c
+	.byte	0x26
+	.long	0x1122
+	.byte	0
+	.uleb128 0x3
+	.long	0x4c1
+	.uleb128 0x1a
+	.long	.LASF75
+	.byte	0x2
+	.byte	0xb7
+	.byte	0x14
+	.byte	0x3
+	.long	0x1161
+	.uleb128 0xc
+	.string	"L"
+	.byte	0x2
+	.byte	0xb7
+	.byte	0x35
+	.long	0x436
+	.uleb128 0xc
+	.string	"l"
+	.byte	0x2
+	.byte	0xb7
+	.byte	0x41
+	.long	0x69
+	.uleb128 0xc
+	.string	"ctx"
+	.byte	0x2
+	.byte	0xb8
+	.byte	0x39
+	.long	0x642
+	.uleb128 0x45
+	.uleb128 0x13
+	.string	"i"
+	.byte	0x2
+	.byte	0xba
+	.byte	0x13
+	.long	0x69
+	.byte	0
+	.byte	0
+	.uleb128 0x1a
+	.long	.LASF76
+	.byte	0x2
+	.byte	0x56
+	.byte	0x14
+	.byte	0x3
+	.long	0x1185
+	.uleb128 0xc
+	.string	"ctx"
+	.byte	0x2
+	.byte	0x56
+	.byte	0x39
+	.long	0x1ef
+	.uleb128 0xc
+	.string	"m"
+	.byte	0x2
+	.byte	0x56
+	.byte	0x4a
+	.long	0xd1
+	.byte	0
+	.uleb128 0x46
+	.long	0x10ea
+	.quad	.LFB22
+	.quad	.LFE22-.LFB22
+	.uleb128 0x1
+	.byte	0x9c
+	.uleb128 0x2e
+	.long	0x10f9
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2e
+	.long	0x1103
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x11
+	.long	0x110d
+	.long	.LLST14
+	.long	.LVUS14
+	.uleb128 0x11
+	.long	0x1117
+	.long	.LLST15
+	.long	.LVUS15
+	.uleb128 0x21
+	.long	0x10ea
+	.quad	.LBI25
+	.byte	.LVU68
+	.long	.LLRL16
+	.byte	0x1a
+	.byte	0xc
+	.uleb128 0x4
+	.long	0x1103
+	.long	.LLST17
+	.long	.LVUS17
+	.uleb128 0x4
+	.long	0x10f9
+	.long	.LLST18
+	.long	.LVUS18
+	.uleb128 0x8
+	.long	.LLRL16
+	.uleb128 0x1f
+	.long	0x110d
+	.uleb128 0x1f
+	.long	0x1117
+	.byte	0
+	.byte	0
+	.byte	0
+	.byte	0
+	.section	.debug_abbrev,"",@progbits
+.Ldebug_abbrev0:
+	.uleb128 0x1
+	.uleb128 0x49
+	.byte	0
+	.uleb128 0x2
+	.uleb128 0x18
+	.uleb128 0x7e
+	.uleb128 0x18
+	.byte	0
+	.byte	0
+	.uleb128 0x2
+	.uleb128 0x5
+	.byte	0
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xf
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0x21
+	.sleb128 8
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x4
+	.uleb128 0x5
+	.byte	0
+	.uleb128 0x31
+	.uleb128 0x13
+	.uleb128 0x2
+	.uleb128 0x17
+	.uleb128 0x2137
+	.uleb128 0x17
+	.byte	0
+	.byte	0
+	.uleb128 0x5
+	.uleb128 0x21
+	.byte	0
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x2f
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x6
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x8
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x2
+	.uleb128 0x17
+	.uleb128 0x2137
+	.uleb128 0x17
+	.byte	0
+	.byte	0
+	.uleb128 0x7
+	.uleb128 0x5
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x2
+	.uleb128 0x17
+	.uleb128 0x2137
+	.uleb128 0x17
+	.byte	0
+	.byte	0
+	.uleb128 0x8
+	.uleb128 0xb
+	.byte	0x1
+	.uleb128 0x55
+	.uleb128 0x17
+	.byte	0
+	.byte	0
+	.uleb128 0x9
+	.uleb128 0x48
+	.byte	0x1
+	.uleb128 0x7d
+	.uleb128 0x1
+	.uleb128 0x7f
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0xa
+	.uleb128 0x1
+	.byte	0x1
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0x5
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x8
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x2
+	.uleb128 0x17
+	.uleb128 0x2137
+	.uleb128 0x17
+	.byte	0
+	.byte	0
+	.uleb128 0xc
+	.uleb128 0x5
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x8
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0xd
+	.uleb128 0x26
+	.byte	0
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0xe
+	.uleb128 0x24
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x3e
+	.uleb128 0xb
+	.uleb128 0x3
+	.uleb128 0xe
+	.byte	0
+	.byte	0
+	.uleb128 0xf
+	.uleb128 0xd
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x8
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x38
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x10
+	.uleb128 0xd
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x38
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x11
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x31
+	.uleb128 0x13
+	.uleb128 0x2
+	.uleb128 0x17
+	.uleb128 0x2137
+	.uleb128 0x17
+	.byte	0
+	.byte	0
+	.uleb128 0x12
+	.uleb128 0xd
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x38
+	.uleb128 0x5
+	.byte	0
+	.byte	0
+	.uleb128 0x13
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x8
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x14
+	.uleb128 0x16
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x15
+	.uleb128 0x1d
+	.byte	0x1
+	.uleb128 0x31
+	.uleb128 0x13
+	.uleb128 0x52
+	.uleb128 0x1
+	.uleb128 0x2138
+	.uleb128 0xb
+	.uleb128 0x55
+	.uleb128 0x17
+	.uleb128 0x58
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x59
+	.uleb128 0xb
+	.uleb128 0x57
+	.uleb128 0xb
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x16
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x8
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x2
+	.uleb128 0x18
+	.byte	0
+	.byte	0
+	.uleb128 0x17
+	.uleb128 0xd
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x8
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 7
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x38
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x18
+	.uleb128 0xd
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x8
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x38
+	.uleb128 0x5
+	.byte	0
+	.byte	0
+	.uleb128 0x19
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 6
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x3c
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x1a
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x20
+	.uleb128 0xb
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x1b
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 6
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x11
+	.uleb128 0x1
+	.uleb128 0x12
+	.uleb128 0x7
+	.uleb128 0x40
+	.uleb128 0x18
+	.uleb128 0x7a
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x1c
+	.uleb128 0x13
+	.byte	0x1
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 8
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x1d
+	.uleb128 0x15
+	.byte	0x1
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x1e
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x11
+	.uleb128 0x1
+	.uleb128 0x12
+	.uleb128 0x7
+	.uleb128 0x40
+	.uleb128 0x18
+	.uleb128 0x7a
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x1f
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x31
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x20
+	.uleb128 0xb
+	.byte	0x1
+	.uleb128 0x55
+	.uleb128 0x17
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x21
+	.uleb128 0x1d
+	.byte	0x1
+	.uleb128 0x31
+	.uleb128 0x13
+	.uleb128 0x52
+	.uleb128 0x1
+	.uleb128 0x2138
+	.uleb128 0xb
+	.uleb128 0x55
+	.uleb128 0x17
+	.uleb128 0x58
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x59
+	.uleb128 0xb
+	.uleb128 0x57
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x22
+	.uleb128 0xb
+	.byte	0x1
+	.uleb128 0x11
+	.uleb128 0x1
+	.uleb128 0x12
+	.uleb128 0x7
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x23
+	.uleb128 0xd
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 7
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x38
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x24
+	.uleb128 0x16
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x8
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 2
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x25
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 2
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x1c
+	.uleb128 0xa
+	.byte	0
+	.byte	0
+	.uleb128 0x26
+	.uleb128 0x13
+	.byte	0x1
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0xb
+	.uleb128 0x5
+	.uleb128 0x88
+	.uleb128 0xb
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 8
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x27
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x3c
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x28
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 5
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 13
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x3c
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x29
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 14
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x2
+	.uleb128 0x17
+	.uleb128 0x2137
+	.uleb128 0x17
+	.byte	0
+	.byte	0
+	.uleb128 0x2a
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x31
+	.uleb128 0x13
+	.uleb128 0x2
+	.uleb128 0x18
+	.byte	0
+	.byte	0
+	.uleb128 0x2b
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x20
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x2c
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 13
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x11
+	.uleb128 0x1
+	.uleb128 0x12
+	.uleb128 0x7
+	.uleb128 0x40
+	.uleb128 0x18
+	.uleb128 0x7a
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x2d
+	.uleb128 0x48
+	.byte	0x1
+	.uleb128 0x7d
+	.uleb128 0x1
+	.byte	0
+	.byte	0
+	.uleb128 0x2e
+	.uleb128 0x5
+	.byte	0
+	.uleb128 0x31
+	.uleb128 0x13
+	.uleb128 0x2
+	.uleb128 0x18
+	.byte	0
+	.byte	0
+	.uleb128 0x2f
+	.uleb128 0x11
+	.byte	0x1
+	.uleb128 0x25
+	.uleb128 0xe
+	.uleb128 0x13
+	.uleb128 0xb
+	.uleb128 0x3
+	.uleb128 0x1f
+	.uleb128 0x1b
+	.uleb128 0x1f
+	.uleb128 0x11
+	.uleb128 0x1
+	.uleb128 0x12
+	.uleb128 0x7
+	.uleb128 0x10
+	.uleb128 0x17
+	.byte	0
+	.byte	0
+	.uleb128 0x30
+	.uleb128 0x24
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x3e
+	.uleb128 0xb
+	.uleb128 0x3
+	.uleb128 0x8
+	.byte	0
+	.byte	0
+	.uleb128 0x31
+	.uleb128 0xf
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x32
+	.uleb128 0x16
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x33
+	.uleb128 0x15
+	.byte	0x1
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x34
+	.uleb128 0x26
+	.byte	0
+	.byte	0
+	.byte	0
+	.uleb128 0x35
+	.uleb128 0x13
+	.byte	0x1
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x88
+	.uleb128 0xb
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x36
+	.uleb128 0x13
+	.byte	0x1
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x37
+	.uleb128 0x15
+	.byte	0
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x38
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3c
+	.uleb128 0x19
+	.byte	0
+	.byte	0
+	.uleb128 0x39
+	.uleb128 0xd
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x8
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x88
+	.uleb128 0xb
+	.uleb128 0x38
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x3a
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x3c
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x3b
+	.uleb128 0x1d
+	.byte	0x1
+	.uleb128 0x31
+	.uleb128 0x13
+	.uleb128 0x55
+	.uleb128 0x17
+	.uleb128 0x58
+	.uleb128 0xb
+	.uleb128 0x59
+	.uleb128 0xb
+	.uleb128 0x57
+	.uleb128 0xb
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x3c
+	.uleb128 0x5
+	.byte	0
+	.uleb128 0x31
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x3d
+	.uleb128 0xb
+	.byte	0x1
+	.uleb128 0x31
+	.uleb128 0x13
+	.uleb128 0x55
+	.uleb128 0x17
+	.byte	0
+	.byte	0
+	.uleb128 0x3e
+	.uleb128 0x1d
+	.byte	0x1
+	.uleb128 0x31
+	.uleb128 0x13
+	.uleb128 0x52
+	.uleb128 0x1
+	.uleb128 0x2138
+	.uleb128 0xb
+	.uleb128 0x11
+	.uleb128 0x1
+	.uleb128 0x12
+	.uleb128 0x7
+	.uleb128 0x58
+	.uleb128 0xb
+	.uleb128 0x59
+	.uleb128 0xb
+	.uleb128 0x57
+	.uleb128 0xb
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x3f
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x40
+	.uleb128 0x48
+	.byte	0x1
+	.uleb128 0x7d
+	.uleb128 0x1
+	.uleb128 0x82
+	.uleb128 0x19
+	.uleb128 0x7f
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x41
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x2
+	.uleb128 0x18
+	.byte	0
+	.byte	0
+	.uleb128 0x42
+	.uleb128 0x1
+	.byte	0x1
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x88
+	.uleb128 0xb
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x43
+	.uleb128 0x48
+	.byte	0x1
+	.uleb128 0x7d
+	.uleb128 0x1
+	.uleb128 0x7f
+	.uleb128 0x13
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x44
+	.uleb128 0x48
+	.byte	0
+	.uleb128 0x7d
+	.uleb128 0x1
+	.uleb128 0x7f
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x45
+	.uleb128 0xb
+	.byte	0x1
+	.byte	0
+	.byte	0
+	.uleb128 0x46
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x31
+	.uleb128 0x13
+	.uleb128 0x11
+	.uleb128 0x1
+	.uleb128 0x12
+	.uleb128 0x7
+	.uleb128 0x40
+	.uleb128 0x18
+	.uleb128 0x7a
+	.uleb128 0x19
+	.byte	0
+	.byte	0
+	.byte	0
+	.section	.debug_loclists,"",@progbits
+	.long	.Ldebug_loc3-.Ldebug_loc2
+.Ldebug_loc2:
+	.value	0x5
+	.byte	0x8
+	.byte	0
+	.long	0
+.Ldebug_loc0:
+.LVUS86:
+	.uleb128 0
+	.uleb128 .LVU466
+	.uleb128 .LVU466
+	.uleb128 .LVU472
+	.uleb128 .LVU472
+	.uleb128 .LVU473
+	.uleb128 .LVU473
+	.uleb128 .LVU478
+	.uleb128 .LVU478
+	.uleb128 .LVU479
+	.uleb128 .LVU479
+	.uleb128 0
+.LLST86:
+	.byte	0x4
+	.uleb128 .LVL121-.Ltext0
+	.uleb128 .LVL122-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL122-.Ltext0
+	.uleb128 .LVL124-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0x4
+	.uleb128 .LVL124-.Ltext0
+	.uleb128 .LVL125-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL125-.Ltext0
+	.uleb128 .LVL126-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0x4
+	.uleb128 .LVL126-.Ltext0
+	.uleb128 .LVL127-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL127-.Ltext0
+	.uleb128 .LFE34-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0
+.LVUS66:
+	.uleb128 0
+	.uleb128 .LVU312
+	.uleb128 .LVU312
+	.uleb128 .LVU393
+	.uleb128 .LVU393
+	.uleb128 .LVU394
+	.uleb128 .LVU394
+	.uleb128 .LVU402
+	.uleb128 .LVU402
+	.uleb128 .LVU403
+	.uleb128 .LVU403
+	.uleb128 0
+.LLST66:
+	.byte	0x4
+	.uleb128 .LVL83-.Ltext0
+	.uleb128 .LVL85-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL85-.Ltext0
+	.uleb128 .LVL101-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0x4
+	.uleb128 .LVL101-.Ltext0
+	.uleb128 .LVL102-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL102-.Ltext0
+	.uleb128 .LVL105-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0x4
+	.uleb128 .LVL105-.Ltext0
+	.uleb128 .LVL106-.Ltext0
+	.uleb128 0x4
+	.byte	0x71
+	.sleb128 -1560
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL106-.Ltext0
+	.uleb128 .LFE33-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0
+.LVUS67:
+	.uleb128 0
+	.uleb128 .LVU312
+	.uleb128 .LVU312
+	.uleb128 .LVU354
+	.uleb128 .LVU354
+	.uleb128 .LVU403
+	.uleb128 .LVU403
+	.uleb128 .LVU438
+	.uleb128 .LVU438
+	.uleb128 0
+.LLST67:
+	.byte	0x4
+	.uleb128 .LVL83-.Ltext0
+	.uleb128 .LVL85-.Ltext0
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x4
+	.uleb128 .LVL85-.Ltext0
+	.uleb128 .LVL93-.Ltext0
+	.uleb128 0x1
+	.byte	0x5c
+	.byte	0x4
+	.uleb128 .LVL93-.Ltext0
+	.uleb128 .LVL106-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL106-.Ltext0
+	.uleb128 .LVL116-.Ltext0
+	.uleb128 0x1
+	.byte	0x5c
+	.byte	0x4
+	.uleb128 .LVL116-.Ltext0
+	.uleb128 .LFE33-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x9f
+	.byte	0
+.LVUS68:
+	.uleb128 .LVU310
+	.uleb128 .LVU317
+.LLST68:
+	.byte	0x4
+	.uleb128 .LVL84-.Ltext0
+	.uleb128 .LVL87-.Ltext0
+	.uleb128 0x1
+	.byte	0x56
+	.byte	0
+.LVUS69:
+	.uleb128 .LVU310
+	.uleb128 .LVU319
+	.uleb128 .LVU319
+	.uleb128 .LVU325
+	.uleb128 .LVU435
+	.uleb128 .LVU438
+.LLST69:
+	.byte	0x4
+	.uleb128 .LVL84-.Ltext0
+	.uleb128 .LVL88-.Ltext0
+	.uleb128 0x2
+	.byte	0x30
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL88-.Ltext0
+	.uleb128 .LVL90-.Ltext0
+	.uleb128 0x1
+	.byte	0x56
+	.byte	0x4
+	.uleb128 .LVL115-.Ltext0
+	.uleb128 .LVL116-.Ltext0
+	.uleb128 0x2
+	.byte	0x30
+	.byte	0x9f
+	.byte	0
+.LVUS71:
+	.uleb128 .LVU336
+	.uleb128 .LVU361
+	.uleb128 .LVU403
+	.uleb128 .LVU435
+.LLST71:
+	.byte	0x4
+	.uleb128 .LVL91-.Ltext0
+	.uleb128 .LVL94-.Ltext0
+	.uleb128 0x1
+	.byte	0x51
+	.byte	0x4
+	.uleb128 .LVL106-.Ltext0
+	.uleb128 .LVL115-.Ltext0
+	.uleb128 0x1
+	.byte	0x51
+	.byte	0
+.LVUS72:
+	.uleb128 .LVU336
+	.uleb128 .LVU365
+	.uleb128 .LVU403
+	.uleb128 .LVU435
+.LLST72:
+	.byte	0x4
+	.uleb128 .LVL91-.Ltext0
+	.uleb128 .LVL95-.Ltext0
+	.uleb128 0x1
+	.byte	0x56
+	.byte	0x4
+	.uleb128 .LVL106-.Ltext0
+	.uleb128 .LVL115-.Ltext0
+	.uleb128 0x1
+	.byte	0x56
+	.byte	0
+.LVUS73:
+	.uleb128 .LVU336
+	.uleb128 .LVU365
+	.uleb128 .LVU403
+	.uleb128 .LVU435
+.LLST73:
+	.byte	0x4
+	.uleb128 .LVL91-.Ltext0
+	.uleb128 .LVL95-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0x4
+	.uleb128 .LVL106-.Ltext0
+	.uleb128 .LVL115-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0
+.LVUS75:
+	.uleb128 .LVU339
+	.uleb128 .LVU340
+	.uleb128 .LVU403
+	.uleb128 .LVU406
+	.uleb128 .LVU406
+	.uleb128 .LVU410
+	.uleb128 .LVU410
+	.uleb128 .LVU414
+	.uleb128 .LVU414
+	.uleb128 .LVU418
+	.uleb128 .LVU418
+	.uleb128 .LVU422
+	.uleb128 .LVU422
+	.uleb128 .LVU426
+	.uleb128 .LVU426
+	.uleb128 .LVU430
+	.uleb128 .LVU430
+	.uleb128 .LVU434
+	.uleb128 .LVU434
+	.uleb128 .LVU435
+.LLST75:
+	.byte	0x4
+	.uleb128 .LVL91-.Ltext0
+	.uleb128 .LVL92-.Ltext0
+	.uleb128 0x2
+	.byte	0x30
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL106-.Ltext0
+	.uleb128 .LVL107-.Ltext0
+	.uleb128 0x2
+	.byte	0x30
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL107-.Ltext0
+	.uleb128 .LVL108-.Ltext0
+	.uleb128 0x2
+	.byte	0x31
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL108-.Ltext0
+	.uleb128 .LVL109-.Ltext0
+	.uleb128 0x2
+	.byte	0x32
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL109-.Ltext0
+	.uleb128 .LVL110-.Ltext0
+	.uleb128 0x2
+	.byte	0x33
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL110-.Ltext0
+	.uleb128 .LVL111-.Ltext0
+	.uleb128 0x2
+	.byte	0x34
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL111-.Ltext0
+	.uleb128 .LVL112-.Ltext0
+	.uleb128 0x2
+	.byte	0x35
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL112-.Ltext0
+	.uleb128 .LVL113-.Ltext0
+	.uleb128 0x2
+	.byte	0x36
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL113-.Ltext0
+	.uleb128 .LVL114-.Ltext0
+	.uleb128 0x2
+	.byte	0x37
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL114-.Ltext0
+	.uleb128 .LVL115-.Ltext0
+	.uleb128 0x2
+	.byte	0x38
+	.byte	0x9f
+	.byte	0
+.LVUS77:
+	.uleb128 .LVU370
+	.uleb128 .LVU374
+	.uleb128 .LVU374
+	.uleb128 .LVU381
+	.uleb128 .LVU394
+	.uleb128 .LVU396
+	.uleb128 .LVU438
+	.uleb128 0
+.LLST77:
+	.byte	0x4
+	.uleb128 .LVL96-.Ltext0
+	.uleb128 .LVL97-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x4
+	.uleb128 .LVL97-1-.Ltext0
+	.uleb128 .LVL99-.Ltext0
+	.uleb128 0x1
+	.byte	0x56
+	.byte	0x4
+	.uleb128 .LVL102-.Ltext0
+	.uleb128 .LVL103-.Ltext0
+	.uleb128 0x1
+	.byte	0x56
+	.byte	0x4
+	.uleb128 .LVL116-.Ltext0
+	.uleb128 .LFE33-.Ltext0
+	.uleb128 0x1
+	.byte	0x56
+	.byte	0
+.LVUS78:
+	.uleb128 .LVU370
+	.uleb128 .LVU374
+	.uleb128 .LVU374
+	.uleb128 .LVU381
+	.uleb128 .LVU394
+	.uleb128 .LVU396
+	.uleb128 .LVU438
+	.uleb128 0
+.LLST78:
+	.byte	0x4
+	.uleb128 .LVL96-.Ltext0
+	.uleb128 .LVL97-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL97-1-.Ltext0
+	.uleb128 .LVL99-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0x4
+	.uleb128 .LVL102-.Ltext0
+	.uleb128 .LVL103-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0x4
+	.uleb128 .LVL116-.Ltext0
+	.uleb128 .LFE33-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0
+.LVUS79:
+	.uleb128 .LVU374
+	.uleb128 .LVU380
+	.uleb128 .LVU380
+	.uleb128 .LVU381
+	.uleb128 .LVU394
+	.uleb128 .LVU396
+	.uleb128 .LVU438
+	.uleb128 .LVU445
+.LLST79:
+	.byte	0x4
+	.uleb128 .LVL97-.Ltext0
+	.uleb128 .LVL98-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL98-.Ltext0
+	.uleb128 .LVL99-.Ltext0
+	.uleb128 0xa
+	.byte	0x7d
+	.sleb128 0
+	.byte	0x33
+	.byte	0x24
+	.byte	0x73
+	.sleb128 0
+	.byte	0x22
+	.byte	0x23
+	.uleb128 0x318
+	.byte	0x4
+	.uleb128 .LVL102-.Ltext0
+	.uleb128 .LVL103-.Ltext0
+	.uleb128 0xa
+	.byte	0x7d
+	.sleb128 0
+	.byte	0x33
+	.byte	0x24
+	.byte	0x73
+	.sleb128 0
+	.byte	0x22
+	.byte	0x23
+	.uleb128 0x318
+	.byte	0x4
+	.uleb128 .LVL116-.Ltext0
+	.uleb128 .LVL118-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0
+.LVUS80:
+	.uleb128 .LVU439
+	.uleb128 .LVU458
+.LLST80:
+	.byte	0x4
+	.uleb128 .LVL116-.Ltext0
+	.uleb128 .LVL120-.Ltext0
+	.uleb128 0x1
+	.byte	0x56
+	.byte	0
+.LVUS81:
+	.uleb128 .LVU439
+	.uleb128 .LVU458
+.LLST81:
+	.byte	0x4
+	.uleb128 .LVL116-.Ltext0
+	.uleb128 .LVL120-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0
+.LVUS82:
+	.uleb128 .LVU444
+	.uleb128 .LVU457
+	.uleb128 .LVU457
+	.uleb128 .LVU458
+.LLST82:
+	.byte	0x4
+	.uleb128 .LVL117-.Ltext0
+	.uleb128 .LVL119-.Ltext0
+	.uleb128 0x1
+	.byte	0x5d
+	.byte	0x4
+	.uleb128 .LVL119-.Ltext0
+	.uleb128 .LVL120-.Ltext0
+	.uleb128 0x2
+	.byte	0x70
+	.sleb128 0
+	.byte	0
+.LVUS84:
+	.uleb128 .LVU383
+	.uleb128 .LVU393
+	.uleb128 .LVU393
+	.uleb128 .LVU394
+	.uleb128 .LVU396
+	.uleb128 .LVU400
+.LLST84:
+	.byte	0x4
+	.uleb128 .LVL99-.Ltext0
+	.uleb128 .LVL101-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0x4
+	.uleb128 .LVL101-.Ltext0
+	.uleb128 .LVL102-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL103-.Ltext0
+	.uleb128 .LVL104-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0
+.LVUS85:
+	.uleb128 .LVU386
+	.uleb128 .LVU394
+	.uleb128 .LVU396
+	.uleb128 .LVU400
+.LLST85:
+	.byte	0x4
+	.uleb128 .LVL100-.Ltext0
+	.uleb128 .LVL102-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL103-.Ltext0
+	.uleb128 .LVL104-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0
+.LVUS19:
+	.uleb128 0
+	.uleb128 .LVU86
+	.uleb128 .LVU86
+	.uleb128 .LVU146
+	.uleb128 .LVU146
+	.uleb128 .LVU148
+	.uleb128 .LVU148
+	.uleb128 0
+.LLST19:
+	.byte	0x4
+	.uleb128 .LVL25-.Ltext0
+	.uleb128 .LVL27-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL27-1-.Ltext0
+	.uleb128 .LVL40-.Ltext0
+	.uleb128 0x1
+	.byte	0x56
+	.byte	0x4
+	.uleb128 .LVL40-.Ltext0
+	.uleb128 .LVL42-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL42-.Ltext0
+	.uleb128 .LFE31-.Ltext0
+	.uleb128 0x1
+	.byte	0x56
+	.byte	0
+.LVUS20:
+	.uleb128 .LVU83
+	.uleb128 .LVU147
+	.uleb128 .LVU148
+	.uleb128 0
+.LLST20:
+	.byte	0x4
+	.uleb128 .LVL26-.Ltext0
+	.uleb128 .LVL41-.Ltext0
+	.uleb128 0x1
+	.byte	0x5d
+	.byte	0x4
+	.uleb128 .LVL42-.Ltext0
+	.uleb128 .LFE31-.Ltext0
+	.uleb128 0x1
+	.byte	0x5d
+	.byte	0
+.LVUS22:
+	.uleb128 .LVU88
+	.uleb128 .LVU91
+	.uleb128 .LVU91
+	.uleb128 .LVU144
+	.uleb128 .LVU148
+	.uleb128 0
+.LLST22:
+	.byte	0x4
+	.uleb128 .LVL27-.Ltext0
+	.uleb128 .LVL28-.Ltext0
+	.uleb128 0x2
+	.byte	0x30
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL28-.Ltext0
+	.uleb128 .LVL39-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0x4
+	.uleb128 .LVL42-.Ltext0
+	.uleb128 .LFE31-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0
+.LVUS24:
+	.uleb128 .LVU92
+	.uleb128 .LVU104
+.LLST24:
+	.byte	0x4
+	.uleb128 .LVL28-.Ltext0
+	.uleb128 .LVL31-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0
+.LVUS25:
+	.uleb128 .LVU92
+	.uleb128 .LVU104
+.LLST25:
+	.byte	0x4
+	.uleb128 .LVL28-.Ltext0
+	.uleb128 .LVL31-.Ltext0
+	.uleb128 0x1
+	.byte	0x56
+	.byte	0
+.LVUS26:
+	.uleb128 .LVU96
+	.uleb128 .LVU104
+.LLST26:
+	.byte	0x4
+	.uleb128 .LVL29-.Ltext0
+	.uleb128 .LVL31-.Ltext0
+	.uleb128 0x1
+	.byte	0x5c
+	.byte	0
+.LVUS28:
+	.uleb128 .LVU126
+	.uleb128 .LVU142
+	.uleb128 .LVU148
+	.uleb128 0
+.LLST28:
+	.byte	0x4
+	.uleb128 .LVL34-.Ltext0
+	.uleb128 .LVL37-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0x4
+	.uleb128 .LVL42-.Ltext0
+	.uleb128 .LFE31-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0
+.LVUS29:
+	.uleb128 .LVU126
+	.uleb128 .LVU142
+	.uleb128 .LVU148
+	.uleb128 0
+.LLST29:
+	.byte	0x4
+	.uleb128 .LVL34-.Ltext0
+	.uleb128 .LVL37-.Ltext0
+	.uleb128 0x1
+	.byte	0x56
+	.byte	0x4
+	.uleb128 .LVL42-.Ltext0
+	.uleb128 .LFE31-.Ltext0
+	.uleb128 0x1
+	.byte	0x56
+	.byte	0
+.LVUS30:
+	.uleb128 .LVU130
+	.uleb128 .LVU136
+	.uleb128 .LVU136
+	.uleb128 .LVU142
+	.uleb128 .LVU148
+	.uleb128 .LVU154
+.LLST30:
+	.byte	0x4
+	.uleb128 .LVL35-.Ltext0
+	.uleb128 .LVL36-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL36-.Ltext0
+	.uleb128 .LVL37-.Ltext0
+	.uleb128 0xa
+	.byte	0x7c
+	.sleb128 0
+	.byte	0x33
+	.byte	0x24
+	.byte	0x76
+	.sleb128 0
+	.byte	0x22
+	.byte	0x23
+	.uleb128 0x318
+	.byte	0x4
+	.uleb128 .LVL42-.Ltext0
+	.uleb128 .LVL44-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0
+.LVUS32:
+	.uleb128 .LVU149
+	.uleb128 0
+.LLST32:
+	.byte	0x4
+	.uleb128 .LVL42-.Ltext0
+	.uleb128 .LFE31-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0
+.LVUS33:
+	.uleb128 .LVU149
+	.uleb128 0
+.LLST33:
+	.byte	0x4
+	.uleb128 .LVL42-.Ltext0
+	.uleb128 .LFE31-.Ltext0
+	.uleb128 0x1
+	.byte	0x56
+	.byte	0
+.LVUS34:
+	.uleb128 .LVU153
+	.uleb128 0
+.LLST34:
+	.byte	0x4
+	.uleb128 .LVL43-.Ltext0
+	.uleb128 .LFE31-.Ltext0
+	.uleb128 0x1
+	.byte	0x5c
+	.byte	0
+.LVUS65:
+	.uleb128 0
+	.uleb128 .LVU300
+	.uleb128 .LVU300
+	.uleb128 .LVU300
+	.uleb128 .LVU300
+	.uleb128 0
+.LLST65:
+	.byte	0x4
+	.uleb128 .LVL81-.Ltext0
+	.uleb128 .LVL82-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL82-1-.Ltext0
+	.uleb128 .LVL82-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL82-.Ltext0
+	.uleb128 .LFE28-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0
+.LVUS64:
+	.uleb128 .LVU286
+	.uleb128 .LVU294
+.LLST64:
+	.byte	0x4
+	.uleb128 .LVL79-.Ltext0
+	.uleb128 .LVL80-.Ltext0
+	.uleb128 0x1
+	.byte	0x51
+	.byte	0
+.LVUS51:
+	.uleb128 0
+	.uleb128 .LVU234
+	.uleb128 .LVU234
+	.uleb128 .LVU276
+	.uleb128 .LVU276
+	.uleb128 0
+.LLST51:
+	.byte	0x4
+	.uleb128 .LVL64-.Ltext0
+	.uleb128 .LVL65-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL65-.Ltext0
+	.uleb128 .LVL77-.Ltext0
+	.uleb128 0x1
+	.byte	0x5d
+	.byte	0x4
+	.uleb128 .LVL77-.Ltext0
+	.uleb128 .LFE26-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x9f
+	.byte	0
+.LVUS52:
+	.uleb128 0
+	.uleb128 .LVU235
+	.uleb128 .LVU235
+	.uleb128 0
+.LLST52:
+	.byte	0x4
+	.uleb128 .LVL64-.Ltext0
+	.uleb128 .LVL66-.Ltext0
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x4
+	.uleb128 .LVL66-.Ltext0
+	.uleb128 .LFE26-.Ltext0
+	.uleb128 0x4
+	.byte	0x91
+	.sleb128 -16592
+	.byte	0
+.LVUS53:
+	.uleb128 0
+	.uleb128 .LVU245
+	.uleb128 .LVU245
+	.uleb128 0
+.LLST53:
+	.byte	0x4
+	.uleb128 .LVL64-.Ltext0
+	.uleb128 .LVL68-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x51
+	.byte	0x4
+	.uleb128 .LVL68-1-.Ltext0
+	.uleb128 .LFE26-.Ltext0
+	.uleb128 0x4
+	.byte	0x91
+	.sleb128 -16584
+	.byte	0
+.LVUS54:
+	.uleb128 0
+	.uleb128 .LVU245
+	.uleb128 .LVU245
+	.uleb128 0
+.LLST54:
+	.byte	0x4
+	.uleb128 .LVL64-.Ltext0
+	.uleb128 .LVL68-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x52
+	.byte	0x4
+	.uleb128 .LVL68-1-.Ltext0
+	.uleb128 .LFE26-.Ltext0
+	.uleb128 0x4
+	.byte	0x91
+	.sleb128 -16608
+	.byte	0
+.LVUS55:
+	.uleb128 0
+	.uleb128 .LVU245
+	.uleb128 .LVU245
+	.uleb128 0
+.LLST55:
+	.byte	0x4
+	.uleb128 .LVL64-.Ltext0
+	.uleb128 .LVL68-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x58
+	.byte	0x4
+	.uleb128 .LVL68-1-.Ltext0
+	.uleb128 .LFE26-.Ltext0
+	.uleb128 0x4
+	.byte	0x91
+	.sleb128 -16616
+	.byte	0
+.LVUS59:
+	.uleb128 .LVU248
+	.uleb128 .LVU251
+	.uleb128 .LVU251
+	.uleb128 .LVU270
+	.uleb128 .LVU270
+	.uleb128 .LVU271
+	.uleb128 .LVU271
+	.uleb128 .LVU273
+	.uleb128 .LVU273
+	.uleb128 .LVU274
+.LLST59:
+	.byte	0x4
+	.uleb128 .LVL69-.Ltext0
+	.uleb128 .LVL70-.Ltext0
+	.uleb128 0x2
+	.byte	0x30
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL70-.Ltext0
+	.uleb128 .LVL74-.Ltext0
+	.uleb128 0x1
+	.byte	0x56
+	.byte	0x4
+	.uleb128 .LVL74-.Ltext0
+	.uleb128 .LVL75-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x4
+	.uleb128 .LVL75-1-.Ltext0
+	.uleb128 .LVL75-.Ltext0
+	.uleb128 0x4
+	.byte	0x76
+	.sleb128 -128
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL75-.Ltext0
+	.uleb128 .LVL76-.Ltext0
+	.uleb128 0x1
+	.byte	0x56
+	.byte	0
+.LVUS61:
+	.uleb128 .LVU257
+	.uleb128 .LVU274
+.LLST61:
+	.byte	0x4
+	.uleb128 .LVL71-.Ltext0
+	.uleb128 .LVL76-.Ltext0
+	.uleb128 0x1
+	.byte	0x5c
+	.byte	0
+.LVUS63:
+	.uleb128 .LVU259
+	.uleb128 .LVU261
+.LLST63:
+	.byte	0x4
+	.uleb128 .LVL71-.Ltext0
+	.uleb128 .LVL72-.Ltext0
+	.uleb128 0x2
+	.byte	0x30
+	.byte	0x9f
+	.byte	0
+.LVUS57:
+	.uleb128 .LVU243
+	.uleb128 .LVU245
+	.uleb128 .LVU245
+	.uleb128 .LVU245
+.LLST57:
+	.byte	0x4
+	.uleb128 .LVL67-.Ltext0
+	.uleb128 .LVL68-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x4
+	.uleb128 .LVL68-1-.Ltext0
+	.uleb128 .LVL68-.Ltext0
+	.uleb128 0x5
+	.byte	0x91
+	.sleb128 -16544
+	.byte	0x9f
+	.byte	0
+.LVUS58:
+	.uleb128 .LVU243
+	.uleb128 .LVU245
+	.uleb128 .LVU245
+	.uleb128 .LVU245
+.LLST58:
+	.byte	0x4
+	.uleb128 .LVL67-.Ltext0
+	.uleb128 .LVL68-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL68-1-.Ltext0
+	.uleb128 .LVL68-.Ltext0
+	.uleb128 0x5
+	.byte	0x91
+	.sleb128 -16576
+	.byte	0x9f
+	.byte	0
+.LVUS44:
+	.uleb128 0
+	.uleb128 .LVU199
+	.uleb128 .LVU199
+	.uleb128 .LVU210
+	.uleb128 .LVU210
+	.uleb128 .LVU215
+	.uleb128 .LVU215
+	.uleb128 0
+.LLST44:
+	.byte	0x4
+	.uleb128 .LVL53-.Ltext0
+	.uleb128 .LVL54-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL54-.Ltext0
+	.uleb128 .LVL58-.Ltext0
+	.uleb128 0x1
+	.byte	0x56
+	.byte	0x4
+	.uleb128 .LVL58-.Ltext0
+	.uleb128 .LVL63-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL63-.Ltext0
+	.uleb128 .LFE25-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0
+.LVUS45:
+	.uleb128 0
+	.uleb128 .LVU199
+	.uleb128 .LVU199
+	.uleb128 .LVU211
+	.uleb128 .LVU211
+	.uleb128 .LVU215
+	.uleb128 .LVU215
+	.uleb128 0
+.LLST45:
+	.byte	0x4
+	.uleb128 .LVL53-.Ltext0
+	.uleb128 .LVL54-.Ltext0
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x4
+	.uleb128 .LVL54-.Ltext0
+	.uleb128 .LVL59-.Ltext0
+	.uleb128 0x1
+	.byte	0x5c
+	.byte	0x4
+	.uleb128 .LVL59-.Ltext0
+	.uleb128 .LVL63-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL63-.Ltext0
+	.uleb128 .LFE25-.Ltext0
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0
+.LVUS46:
+	.uleb128 0
+	.uleb128 .LVU199
+	.uleb128 .LVU199
+	.uleb128 .LVU212
+	.uleb128 .LVU212
+	.uleb128 .LVU215
+	.uleb128 .LVU215
+	.uleb128 0
+.LLST46:
+	.byte	0x4
+	.uleb128 .LVL53-.Ltext0
+	.uleb128 .LVL54-.Ltext0
+	.uleb128 0x1
+	.byte	0x51
+	.byte	0x4
+	.uleb128 .LVL54-.Ltext0
+	.uleb128 .LVL60-.Ltext0
+	.uleb128 0x1
+	.byte	0x5d
+	.byte	0x4
+	.uleb128 .LVL60-.Ltext0
+	.uleb128 .LVL63-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x51
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL63-.Ltext0
+	.uleb128 .LFE25-.Ltext0
+	.uleb128 0x1
+	.byte	0x51
+	.byte	0
+.LVUS47:
+	.uleb128 0
+	.uleb128 .LVU199
+	.uleb128 .LVU199
+	.uleb128 .LVU213
+	.uleb128 .LVU213
+	.uleb128 .LVU215
+	.uleb128 .LVU215
+	.uleb128 0
+.LLST47:
+	.byte	0x4
+	.uleb128 .LVL53-.Ltext0
+	.uleb128 .LVL54-.Ltext0
+	.uleb128 0x1
+	.byte	0x52
+	.byte	0x4
+	.uleb128 .LVL54-.Ltext0
+	.uleb128 .LVL61-.Ltext0
+	.uleb128 0x1
+	.byte	0x5e
+	.byte	0x4
+	.uleb128 .LVL61-.Ltext0
+	.uleb128 .LVL63-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x52
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL63-.Ltext0
+	.uleb128 .LFE25-.Ltext0
+	.uleb128 0x1
+	.byte	0x52
+	.byte	0
+.LVUS48:
+	.uleb128 0
+	.uleb128 .LVU199
+	.uleb128 .LVU199
+	.uleb128 .LVU214
+	.uleb128 .LVU214
+	.uleb128 .LVU215
+	.uleb128 .LVU215
+	.uleb128 0
+.LLST48:
+	.byte	0x4
+	.uleb128 .LVL53-.Ltext0
+	.uleb128 .LVL54-.Ltext0
+	.uleb128 0x1
+	.byte	0x58
+	.byte	0x4
+	.uleb128 .LVL54-.Ltext0
+	.uleb128 .LVL62-.Ltext0
+	.uleb128 0x1
+	.byte	0x5f
+	.byte	0x4
+	.uleb128 .LVL62-.Ltext0
+	.uleb128 .LVL63-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x58
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL63-.Ltext0
+	.uleb128 .LFE25-.Ltext0
+	.uleb128 0x1
+	.byte	0x58
+	.byte	0
+.LVUS50:
+	.uleb128 .LVU195
+	.uleb128 .LVU199
+	.uleb128 .LVU199
+	.uleb128 .LVU205
+	.uleb128 .LVU205
+	.uleb128 .LVU206
+	.uleb128 .LVU206
+	.uleb128 .LVU207
+	.uleb128 .LVU207
+	.uleb128 .LVU209
+	.uleb128 .LVU215
+	.uleb128 0
+.LLST50:
+	.byte	0x4
+	.uleb128 .LVL53-.Ltext0
+	.uleb128 .LVL54-.Ltext0
+	.uleb128 0x2
+	.byte	0x30
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL54-.Ltext0
+	.uleb128 .LVL55-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0x4
+	.uleb128 .LVL55-.Ltext0
+	.uleb128 .LVL56-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x59
+	.byte	0x4
+	.uleb128 .LVL56-1-.Ltext0
+	.uleb128 .LVL56-.Ltext0
+	.uleb128 0x4
+	.byte	0x73
+	.sleb128 -128
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL56-.Ltext0
+	.uleb128 .LVL57-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0x4
+	.uleb128 .LVL63-.Ltext0
+	.uleb128 .LFE25-.Ltext0
+	.uleb128 0x2
+	.byte	0x30
+	.byte	0x9f
+	.byte	0
+.LVUS35:
+	.uleb128 0
+	.uleb128 .LVU170
+	.uleb128 .LVU170
+	.uleb128 0
+.LLST35:
+	.byte	0x4
+	.uleb128 .LVL45-.Ltext0
+	.uleb128 .LVL46-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL46-.Ltext0
+	.uleb128 .LFE24-.Ltext0
+	.uleb128 0x4
+	.byte	0x91
+	.sleb128 -16472
+	.byte	0
+.LVUS36:
+	.uleb128 0
+	.uleb128 .LVU170
+	.uleb128 .LVU170
+	.uleb128 0
+.LLST36:
+	.byte	0x4
+	.uleb128 .LVL45-.Ltext0
+	.uleb128 .LVL46-.Ltext0
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x4
+	.uleb128 .LVL46-.Ltext0
+	.uleb128 .LFE24-.Ltext0
+	.uleb128 0x4
+	.byte	0x91
+	.sleb128 -16464
+	.byte	0
+.LVUS37:
+	.uleb128 0
+	.uleb128 .LVU170
+	.uleb128 .LVU170
+	.uleb128 0
+.LLST37:
+	.byte	0x4
+	.uleb128 .LVL45-.Ltext0
+	.uleb128 .LVL46-.Ltext0
+	.uleb128 0x1
+	.byte	0x51
+	.byte	0x4
+	.uleb128 .LVL46-.Ltext0
+	.uleb128 .LFE24-.Ltext0
+	.uleb128 0x4
+	.byte	0x91
+	.sleb128 -16456
+	.byte	0
+.LVUS38:
+	.uleb128 0
+	.uleb128 .LVU170
+	.uleb128 .LVU170
+	.uleb128 .LVU190
+	.uleb128 .LVU190
+	.uleb128 0
+.LLST38:
+	.byte	0x4
+	.uleb128 .LVL45-.Ltext0
+	.uleb128 .LVL46-.Ltext0
+	.uleb128 0x1
+	.byte	0x52
+	.byte	0x4
+	.uleb128 .LVL46-.Ltext0
+	.uleb128 .LVL52-.Ltext0
+	.uleb128 0x1
+	.byte	0x5d
+	.byte	0x4
+	.uleb128 .LVL52-.Ltext0
+	.uleb128 .LFE24-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x52
+	.byte	0x9f
+	.byte	0
+.LVUS40:
+	.uleb128 .LVU165
+	.uleb128 .LVU170
+	.uleb128 .LVU170
+	.uleb128 .LVU186
+	.uleb128 .LVU186
+	.uleb128 .LVU187
+	.uleb128 .LVU187
+	.uleb128 .LVU189
+	.uleb128 .LVU189
+	.uleb128 .LVU190
+.LLST40:
+	.byte	0x4
+	.uleb128 .LVL45-.Ltext0
+	.uleb128 .LVL46-.Ltext0
+	.uleb128 0x2
+	.byte	0x30
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL46-.Ltext0
+	.uleb128 .LVL50-.Ltext0
+	.uleb128 0x1
+	.byte	0x56
+	.byte	0x4
+	.uleb128 .LVL50-.Ltext0
+	.uleb128 .LVL51-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x4
+	.uleb128 .LVL51-1-.Ltext0
+	.uleb128 .LVL51-.Ltext0
+	.uleb128 0x4
+	.byte	0x76
+	.sleb128 -128
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL51-.Ltext0
+	.uleb128 .LVL52-.Ltext0
+	.uleb128 0x1
+	.byte	0x56
+	.byte	0
+.LVUS42:
+	.uleb128 .LVU175
+	.uleb128 .LVU190
+.LLST42:
+	.byte	0x4
+	.uleb128 .LVL47-.Ltext0
+	.uleb128 .LVL52-.Ltext0
+	.uleb128 0x1
+	.byte	0x5c
+	.byte	0
+.LVUS43:
+	.uleb128 .LVU177
+	.uleb128 .LVU179
+.LLST43:
+	.byte	0x4
+	.uleb128 .LVL47-.Ltext0
+	.uleb128 .LVL48-.Ltext0
+	.uleb128 0x2
+	.byte	0x30
+	.byte	0x9f
+	.byte	0
+.LVUS0:
+	.uleb128 0
+	.uleb128 .LVU11
+	.uleb128 .LVU11
+	.uleb128 .LVU57
+	.uleb128 .LVU57
+	.uleb128 0
+.LLST0:
+	.byte	0x4
+	.uleb128 .LVL0-.Ltext0
+	.uleb128 .LVL4-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL4-.Ltext0
+	.uleb128 .LVL18-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0x4
+	.uleb128 .LVL18-.Ltext0
+	.uleb128 .LFE23-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x9f
+	.byte	0
+.LVUS1:
+	.uleb128 0
+	.uleb128 .LVU9
+	.uleb128 .LVU9
+	.uleb128 .LVU58
+	.uleb128 .LVU58
+	.uleb128 0
+.LLST1:
+	.byte	0x4
+	.uleb128 .LVL0-.Ltext0
+	.uleb128 .LVL2-.Ltext0
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x4
+	.uleb128 .LVL2-.Ltext0
+	.uleb128 .LVL19-.Ltext0
+	.uleb128 0x1
+	.byte	0x56
+	.byte	0x4
+	.uleb128 .LVL19-.Ltext0
+	.uleb128 .LFE23-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x9f
+	.byte	0
+.LVUS2:
+	.uleb128 0
+	.uleb128 .LVU10
+	.uleb128 .LVU10
+	.uleb128 .LVU59
+	.uleb128 .LVU59
+	.uleb128 0
+.LLST2:
+	.byte	0x4
+	.uleb128 .LVL0-.Ltext0
+	.uleb128 .LVL3-.Ltext0
+	.uleb128 0x1
+	.byte	0x51
+	.byte	0x4
+	.uleb128 .LVL3-.Ltext0
+	.uleb128 .LVL20-.Ltext0
+	.uleb128 0x1
+	.byte	0x5c
+	.byte	0x4
+	.uleb128 .LVL20-.Ltext0
+	.uleb128 .LFE23-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x51
+	.byte	0x9f
+	.byte	0
+.LVUS3:
+	.uleb128 0
+	.uleb128 .LVU7
+	.uleb128 .LVU7
+	.uleb128 .LVU60
+	.uleb128 .LVU60
+	.uleb128 0
+.LLST3:
+	.byte	0x4
+	.uleb128 .LVL0-.Ltext0
+	.uleb128 .LVL1-.Ltext0
+	.uleb128 0x1
+	.byte	0x52
+	.byte	0x4
+	.uleb128 .LVL1-.Ltext0
+	.uleb128 .LVL21-.Ltext0
+	.uleb128 0x1
+	.byte	0x5d
+	.byte	0x4
+	.uleb128 .LVL21-.Ltext0
+	.uleb128 .LFE23-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x52
+	.byte	0x9f
+	.byte	0
+.LVUS4:
+	.uleb128 0
+	.uleb128 .LVU35
+	.uleb128 .LVU35
+	.uleb128 .LVU61
+	.uleb128 .LVU61
+	.uleb128 0
+.LLST4:
+	.byte	0x4
+	.uleb128 .LVL0-.Ltext0
+	.uleb128 .LVL14-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x58
+	.byte	0x4
+	.uleb128 .LVL14-1-.Ltext0
+	.uleb128 .LVL22-.Ltext0
+	.uleb128 0x1
+	.byte	0x5e
+	.byte	0x4
+	.uleb128 .LVL22-.Ltext0
+	.uleb128 .LFE23-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x58
+	.byte	0x9f
+	.byte	0
+.LVUS5:
+	.uleb128 0
+	.uleb128 .LVU12
+	.uleb128 .LVU12
+	.uleb128 0
+.LLST5:
+	.byte	0x4
+	.uleb128 .LVL0-.Ltext0
+	.uleb128 .LVL5-.Ltext0
+	.uleb128 0x1
+	.byte	0x59
+	.byte	0x4
+	.uleb128 .LVL5-.Ltext0
+	.uleb128 .LFE23-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x59
+	.byte	0x9f
+	.byte	0
+.LVUS6:
+	.uleb128 0
+	.uleb128 .LVU12
+.LLST6:
+	.byte	0x4
+	.uleb128 .LVL0-.Ltext0
+	.uleb128 .LVL5-.Ltext0
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 0
+	.byte	0
+.LVUS8:
+	.uleb128 .LVU5
+	.uleb128 .LVU20
+	.uleb128 .LVU20
+	.uleb128 .LVU21
+	.uleb128 .LVU21
+	.uleb128 .LVU31
+	.uleb128 .LVU31
+	.uleb128 0
+.LLST8:
+	.byte	0x4
+	.uleb128 .LVL0-.Ltext0
+	.uleb128 .LVL8-.Ltext0
+	.uleb128 0x2
+	.byte	0x30
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL8-.Ltext0
+	.uleb128 .LVL9-.Ltext0
+	.uleb128 0x2
+	.byte	0x31
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL9-.Ltext0
+	.uleb128 .LVL12-.Ltext0
+	.uleb128 0x2
+	.byte	0x30
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL12-.Ltext0
+	.uleb128 .LFE23-.Ltext0
+	.uleb128 0x2
+	.byte	0x31
+	.byte	0x9f
+	.byte	0
+.LVUS10:
+	.uleb128 .LVU12
+	.uleb128 .LVU13
+	.uleb128 .LVU13
+	.uleb128 .LVU16
+	.uleb128 .LVU23
+	.uleb128 .LVU25
+	.uleb128 .LVU25
+	.uleb128 .LVU32
+.LLST10:
+	.byte	0x4
+	.uleb128 .LVL5-.Ltext0
+	.uleb128 .LVL6-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL6-.Ltext0
+	.uleb128 .LVL7-.Ltext0
+	.uleb128 0x3
+	.byte	0x70
+	.sleb128 1
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL10-.Ltext0
+	.uleb128 .LVL11-.Ltext0
+	.uleb128 0xc
+	.byte	0x70
+	.sleb128 0
+	.byte	0x79
+	.sleb128 0
+	.byte	0x33
+	.byte	0x24
+	.byte	0x78
+	.sleb128 0
+	.byte	0x22
+	.byte	0x6
+	.byte	0x22
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL11-.Ltext0
+	.uleb128 .LVL13-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0
+.LVUS11:
+	.uleb128 .LVU37
+	.uleb128 .LVU38
+.LLST11:
+	.byte	0x4
+	.uleb128 .LVL14-.Ltext0
+	.uleb128 .LVL15-.Ltext0
+	.uleb128 0x2
+	.byte	0x30
+	.byte	0x9f
+	.byte	0
+.LVUS13:
+	.uleb128 .LVU40
+	.uleb128 .LVU56
+.LLST13:
+	.byte	0x4
+	.uleb128 .LVL16-.Ltext0
+	.uleb128 .LVL17-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x52
+	.byte	0
+.LVUS14:
+	.uleb128 .LVU64
+	.uleb128 0
+.LLST14:
+	.byte	0x4
+	.uleb128 .LVL23-.Ltext0
+	.uleb128 .LFE22-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0
+.LVUS15:
+	.uleb128 .LVU64
+	.uleb128 0
+.LLST15:
+	.byte	0x4
+	.uleb128 .LVL23-.Ltext0
+	.uleb128 .LFE22-.Ltext0
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0
+.LVUS17:
+	.uleb128 .LVU68
+	.uleb128 0
+.LLST17:
+	.byte	0x4
+	.uleb128 .LVL24-.Ltext0
+	.uleb128 .LFE22-.Ltext0
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0
+.LVUS18:
+	.uleb128 .LVU68
+	.uleb128 0
+.LLST18:
+	.byte	0x4
+	.uleb128 .LVL24-.Ltext0
+	.uleb128 .LFE22-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0
+.Ldebug_loc3:
+	.section	.debug_aranges,"",@progbits
+	.long	0x2c
+	.value	0x2
+	.long	.Ldebug_info0
+	.byte	0x8
+	.byte	0
+	.value	0
+	.value	0
+	.quad	.Ltext0
+	.quad	.Letext0-.Ltext0
+	.quad	0
+	.quad	0
+	.section	.debug_rnglists,"",@progbits
+.Ldebug_ranges0:
+	.long	.Ldebug_ranges3-.Ldebug_ranges2
+.Ldebug_ranges2:
+	.value	0x5
+	.byte	0x8
+	.byte	0
+	.long	0
+.LLRL7:
+	.byte	0x4
+	.uleb128 .LBB14-.Ltext0
+	.uleb128 .LBE14-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB19-.Ltext0
+	.uleb128 .LBE19-.Ltext0
+	.byte	0
+.LLRL9:
+	.byte	0x4
+	.uleb128 .LBB15-.Ltext0
+	.uleb128 .LBE15-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB16-.Ltext0
+	.uleb128 .LBE16-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB17-.Ltext0
+	.uleb128 .LBE17-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB18-.Ltext0
+	.uleb128 .LBE18-.Ltext0
+	.byte	0
+.LLRL12:
+	.byte	0x4
+	.uleb128 .LBB21-.Ltext0
+	.uleb128 .LBE21-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB22-.Ltext0
+	.uleb128 .LBE22-.Ltext0
+	.byte	0
+.LLRL16:
+	.byte	0x4
+	.uleb128 .LBB25-.Ltext0
+	.uleb128 .LBE25-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB28-.Ltext0
+	.uleb128 .LBE28-.Ltext0
+	.byte	0
+.LLRL21:
+	.byte	0x4
+	.uleb128 .LBB36-.Ltext0
+	.uleb128 .LBE36-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB55-.Ltext0
+	.uleb128 .LBE55-.Ltext0
+	.byte	0
+.LLRL23:
+	.byte	0x4
+	.uleb128 .LBB37-.Ltext0
+	.uleb128 .LBE37-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB52-.Ltext0
+	.uleb128 .LBE52-.Ltext0
+	.byte	0
+.LLRL27:
+	.byte	0x4
+	.uleb128 .LBB40-.Ltext0
+	.uleb128 .LBE40-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB51-.Ltext0
+	.uleb128 .LBE51-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB53-.Ltext0
+	.uleb128 .LBE53-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB54-.Ltext0
+	.uleb128 .LBE54-.Ltext0
+	.byte	0
+.LLRL31:
+	.byte	0x4
+	.uleb128 .LBB42-.Ltext0
+	.uleb128 .LBE42-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB46-.Ltext0
+	.uleb128 .LBE46-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB47-.Ltext0
+	.uleb128 .LBE47-.Ltext0
+	.byte	0
+.LLRL39:
+	.byte	0x4
+	.uleb128 .LBB56-.Ltext0
+	.uleb128 .LBE56-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB60-.Ltext0
+	.uleb128 .LBE60-.Ltext0
+	.byte	0
+.LLRL41:
+	.byte	0x4
+	.uleb128 .LBB57-.Ltext0
+	.uleb128 .LBE57-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB59-.Ltext0
+	.uleb128 .LBE59-.Ltext0
+	.byte	0
+.LLRL49:
+	.byte	0x4
+	.uleb128 .LBB61-.Ltext0
+	.uleb128 .LBE61-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB62-.Ltext0
+	.uleb128 .LBE62-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB63-.Ltext0
+	.uleb128 .LBE63-.Ltext0
+	.byte	0
+.LLRL56:
+	.byte	0x4
+	.uleb128 .LBB64-.Ltext0
+	.uleb128 .LBE64-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB67-.Ltext0
+	.uleb128 .LBE67-.Ltext0
+	.byte	0
+.LLRL60:
+	.byte	0x4
+	.uleb128 .LBB69-.Ltext0
+	.uleb128 .LBE69-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB72-.Ltext0
+	.uleb128 .LBE72-.Ltext0
+	.byte	0
+.LLRL62:
+	.byte	0x4
+	.uleb128 .LBB70-.Ltext0
+	.uleb128 .LBE70-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB71-.Ltext0
+	.uleb128 .LBE71-.Ltext0
+	.byte	0
+.LLRL70:
+	.byte	0x4
+	.uleb128 .LBB82-.Ltext0
+	.uleb128 .LBE82-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB98-.Ltext0
+	.uleb128 .LBE98-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB100-.Ltext0
+	.uleb128 .LBE100-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB108-.Ltext0
+	.uleb128 .LBE108-.Ltext0
+	.byte	0
+.LLRL74:
+	.byte	0x4
+	.uleb128 .LBB84-.Ltext0
+	.uleb128 .LBE84-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB85-.Ltext0
+	.uleb128 .LBE85-.Ltext0
+	.byte	0
+.LLRL76:
+	.byte	0x4
+	.uleb128 .LBB89-.Ltext0
+	.uleb128 .LBE89-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB99-.Ltext0
+	.uleb128 .LBE99-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB101-.Ltext0
+	.uleb128 .LBE101-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB102-.Ltext0
+	.uleb128 .LBE102-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB106-.Ltext0
+	.uleb128 .LBE106-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB109-.Ltext0
+	.uleb128 .LBE109-.Ltext0
+	.byte	0
+.LLRL83:
+	.byte	0x4
+	.uleb128 .LBB103-.Ltext0
+	.uleb128 .LBE103-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB107-.Ltext0
+	.uleb128 .LBE107-.Ltext0
+	.byte	0
+.LLRL87:
+	.byte	0x4
+	.uleb128 .LBB110-.Ltext0
+	.uleb128 .LBE110-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB114-.Ltext0
+	.uleb128 .LBE114-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB115-.Ltext0
+	.uleb128 .LBE115-.Ltext0
+	.byte	0
+.Ldebug_ranges3:
+	.section	.debug_line,"",@progbits
+.Ldebug_line0:
+	.section	.debug_str,"MS",@progbits,1
+.LASF53:
+	.string	"qsort"
+.LASF67:
+	.string	"lens"
+.LASF9:
+	.string	"size_t"
+.LASF10:
+	.string	"__uint8_t"
+.LASF44:
+	.string	"done"
+.LASF14:
+	.string	"long long unsigned int"
+.LASF55:
+	.string	"blake2s_mgr_flush"
+.LASF24:
+	.string	"blake2s_sigma"
+.LASF22:
+	.string	"next"
+.LASF4:
+	.string	"long long int"
+.LASF8:
+	.string	"signed char"
+.LASF25:
+	.string	"blake2s_ctx"
+.LASF18:
+	.string	"buf_len"
+.LASF52:
+	.string	"blake2s_lanes_run"
+.LASF35:
+	.string	"blake2s_job"
+.LASF49:
+	.string	"posix_memalign"
+.LASF74:
+	.string	"bbatch_cmp"
+.LASF3:
+	.string	"long int"
+.LASF31:
+	.string	"compress"
+.LASF66:
+	.string	"srcs"
+.LASF54:
+	.string	"blake2s_init"
+.LASF12:
+	.string	"__uint32_t"
+.LASF33:
+	.string	"lanes"
+.LASF26:
+	.string	"blake2s_lanes"
+.LASF7:
+	.string	"unsigned int"
+.LASF45:
+	.string	"done_tail"
+.LASF68:
+	.string	"blake2s_many_ctx"
+.LASF27:
+	.string	"blake2s_mgr_job"
+.LASF61:
+	.string	"blake2s_mgr_new"
+.LASF2:
+	.string	"long unsigned int"
+.LASF29:
+	.string	"name"
+.LASF40:
+	.string	"width"
+.LASF6:
+	.string	"short unsigned int"
+.LASF42:
+	.string	"last"
+.LASF51:
+	.string	"blake2s_clone"
+.LASF46:
+	.string	"blake2s_lane_retire"
+.LASF56:
+	.string	"blake2s_mgr_submit"
+.LASF71:
+	.string	"bbatch_run"
+.LASF77:
+	.string	"GNU C99 12.2.0 -mtune=generic -march=x86-64 -g -O3 -std=c99 -fasynchronous-unwind-tables"
+.LASF64:
+	.string	"prefix"
+.LASF72:
+	.string	"base"
+.LASF37:
+	.string	"blocks"
+.LASF32:
+	.string	"compress_blocks"
+.LASF60:
+	.string	"bmgr_complete"
+.LASF58:
+	.string	"full"
+.LASF47:
+	.string	"free"
+.LASF38:
+	.string	"blake2s_mgr"
+.LASF62:
+	.string	"blake2s_mgr_free"
+.LASF65:
+	.string	"outs"
+.LASF21:
+	.string	"user"
+.LASF5:
+	.string	"unsigned char"
+.LASF39:
+	.string	"kern"
+.LASF11:
+	.string	"short int"
+.LASF48:
+	.string	"blake2s_lane_next"
+.LASF36:
+	.string	"bbatch_key"
+.LASF43:
+	.string	"lane"
+.LASF19:
+	.string	"digest_len"
+.LASF17:
+	.string	"uint32_t"
+.LASF13:
+	.string	"char"
+.LASF76:
+	.string	"blake2s_compress"
+.LASF28:
+	.string	"blake2s_kernel"
+.LASF69:
+	.string	"blake2s_many"
+.LASF57:
+	.string	"blake2s_kern"
+.LASF20:
+	.string	"last_node"
+.LASF30:
+	.string	"usable"
+.LASF63:
+	.string	"blake2s_many_suffix"
+.LASF34:
+	.string	"compress_lanes"
+.LASF50:
+	.string	"memset"
+.LASF16:
+	.string	"uint8_t"
+.LASF41:
+	.string	"busy"
+.LASF15:
+	.string	"__compar_fn_t"
+.LASF59:
+	.string	"bmgr_advance"
+.LASF73:
+	.string	"bmgr_pop"
+.LASF75:
+	.string	"blane_load"
+.LASF70:
+	.string	"bmgr_step"
+.LASF23:
+	.string	"blake2s_iv"
+	.section	.debug_line_str,"MS",@progbits,1
+.LASF1:
+	.string	"/root/repo"
+.LASF0:
+	.string	"blake2s-batch.c"
+	.ident	"GCC: (Debian 12.2.0-14+deb12u1) 12.2.0"
+	.section	.note.GNU-stack,"",@progbits
@@ -0,0 +1,407 @@
+#define _GNU_SOURCE /* O_DIRECT, madvise() */
+
+#include <errno.h>
+#include <fcntl.h>
+#include <pthread.h>
+#include <stdlib.h>
+#include <string.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#include "blake2s.h"
+#include "blake2s-internal.h"
+
+/* Sequential file hashing
+ *
+ * By default, a regular file is hashed straight from the page cache,
+ * mapped B2S_FILE_WINDOW bytes at a time with sequential read-ahead
+ * hints. Other files, and whatever cannot be mapped, are read in
+ * B2S_FILE_READ pieces: more than the stdio buffer, so that fread()
+ * reads straight into ours. Like any mapping, this gets SIGBUS if the
+ * file is truncated under it.
+ *
+ * The other engines take over the regular file from the stream
+ * position up to its size at the start; bytes appended after that
+ * are read from the stream. With BLAKE2S_IO_DIRECT, they read through
+ * a second, O_DIRECT descriptor from the next aligned offset, after
+ * reading the bytes up to it normally.
+ */
+#define B2S_FILE_WINDOW ((off_t)64 << 20)
+#define B2S_FILE_READ   (64 << 10)
+#define B2S_IO_CHUNK    (1 << 20) /* default for the other engines */
+
+/* bfile_map: hash the regular file `fd` from `off` up to `size`
+ * returns the offset reached, short of `size` if mmap() failed
+ */
+static off_t bfile_map(struct blake2s_ctx *ctx, int fd, off_t off, off_t size)
+{
+    off_t page = sysconf(_SC_PAGESIZE);
+
+    posix_fadvise(fd, off, size - off, POSIX_FADV_SEQUENTIAL);
+    while (off < size) {
+        off_t base = off - off % page;
+        size_t len = size - base < B2S_FILE_WINDOW ? size - base
+                                                   : B2S_FILE_WINDOW;
+        unsigned char *p = mmap(NULL, len, PROT_READ, MAP_SHARED, fd, base);
+        if (p == MAP_FAILED)
+            break;
+        madvise(p, len, MADV_SEQUENTIAL);
+#ifdef MADV_HUGEPAGE
+        madvise(p, len, MADV_HUGEPAGE);
+#endif
+        blake2s_update(ctx, p + (off - base), len - (off - base));
+        munmap(p, len);
+        off = base + len;
+    }
+    return off;
+}
+
+ssize_t blake2s_pread(int fd, void *buf, size_t len, uint64_t off)
+{
+    size_t got = 0;
+    while (got < len) {
+        ssize_t r = pread(fd, (char *)buf + got, len - got, off + got);
+        if (r < 0 && errno == EINTR)
+            continue;
+        if (r < 0)
+            return -1;
+        if (!r)
+            break;
+        got += r;
+    }
+    return got;
+}
+
+/* bfile_read: hash `fd` from `off` up to `size` with pread()s of
+ * `chunk` bytes, O_DIRECT ones if `direct`
+ * returns < 0 on error, with errno set
+ */
+static int bfile_read(struct blake2s_ctx *ctx, int fd, uint64_t off,
+                      uint64_t size, size_t chunk, int direct)
+{
+    unsigned char *buf;
+
+    if (off >= size)
+        return 1;
+    if (posix_memalign((void **)&buf, BLAKE2S_IO_ALIGN, chunk)) {
+        errno = ENOMEM;
+        return -1;
+    }
+    while (off < size) {
+        size_t want = size - off < chunk ? size - off : chunk;
+        ssize_t got = blake2s_pread(fd, buf, direct ? B2S_IO_ROUND(want)
+                                                    : want, off);
+        if (got < (ssize_t)want) {
+            if (got >= 0)
+                errno = EIO; /* the file shrank */
+            free(buf);
+            return -1;
+        }
+        blake2s_update(ctx, buf, want);
+        off += want;
+    }
+    free(buf);
+    return 1;
+}
+
+int blake2s_file_finish(struct blake2s_ctx *ctx, FILE *stream, size_t chunk,
+                        unsigned char *out)
+{
+    unsigned char *buf = malloc(chunk);
+
+    if (!buf) {
+        errno = ENOMEM;
+        return -1;
+    }
+    while (1) {
+        size_t read = fread(buf, 1, chunk, stream);
+        if (!read && ferror(stream)) {
+            free(buf);
+            return -1;
+        }
+        if (!read)
+            break;
+        blake2s_update(ctx, buf, read);
+    }
+    free(buf);
+    blake2s_final(ctx, out);
+    return 1;
+}
+
+/* bfile_open_direct: a second descriptor for the regular file `fd`,
+ * opened O_DIRECT */
+static int bfile_open_direct(int fd)
+{
+#ifdef O_DIRECT
+    char path[32];
+    snprintf(path, sizeof(path), "/proc/self/fd/%d", fd);
+    return open(path, O_RDONLY | O_DIRECT);
+#else
+    (void)fd;
+    errno = EINVAL;
+    return -1;
+#endif
+}
+
+/* bfile_align: hash `fd` from *off up to the next O_DIRECT boundary */
+static int bfile_align(struct blake2s_ctx *ctx, int fd, off_t *off,
+                       off_t size)
+{
+    unsigned char buf[BLAKE2S_IO_ALIGN];
+    size_t len = (BLAKE2S_IO_ALIGN - *off % BLAKE2S_IO_ALIGN)
+                 % BLAKE2S_IO_ALIGN;
+    ssize_t got;
+
+    if (len > (size_t)(size - *off))
+        len = size - *off;
+    got = blake2s_pread(fd, buf, len, *off);
+    if (got < (ssize_t)len) {
+        if (got >= 0)
+            errno = EIO;
+        return -1;
+    }
+    blake2s_update(ctx, buf, len);
+    *off += len;
+    return 0;
+}
+
+int blake2s_file_ex(unsigned char *out, FILE *stream,
+                    const struct blake2s_io *io)
+{
+    static const struct blake2s_io defaults = { BLAKE2S_IO_AUTO, 0, 0 };
+    struct blake2s_ctx ctx;
+    struct stat st;
+    int fd = fileno(stream);
+    int direct, src, ret = 0;
+    size_t chunk;
+    off_t off;
+
+    if (!io)
+        io = &defaults;
+    direct = !!(io->flags & BLAKE2S_IO_DIRECT);
+    chunk = io->chunk;
+    if (!chunk)
+        chunk = io->engine == BLAKE2S_IO_AUTO && !direct ? B2S_FILE_READ
+                                                         : B2S_IO_CHUNK;
+    if (io->engine > BLAKE2S_IO_URING || chunk > BLAKE2S_IO_CHUNK_MAX
+        || (direct && chunk % BLAKE2S_IO_ALIGN)) {
+        errno = EINVAL;
+        return -1;
+    }
+
+    blake2s_init(&ctx);
+    if (fd < 0 || fstat(fd, &st) < 0 || !S_ISREG(st.st_mode)
+        || (off = ftello(stream)) < 0) {
+        /* not a regular file: take the stream as it comes */
+        if (io->engine != BLAKE2S_IO_AUTO
+            && blake2s_pipe_run(&ctx, stream, -1, 0, 0, chunk, 0) < 0)
+            return -1;
+        return blake2s_file_finish(&ctx, stream, chunk, out);
+    }
+    if (off >= st.st_size)
+        return blake2s_file_finish(&ctx, stream, chunk, out);
+
+    src = fd;
+    if (direct) {
+        if (bfile_align(&ctx, fd, &off, st.st_size) < 0)
+            return -1;
+        src = bfile_open_direct(fd);
+        if (src < 0)
+            return -1;
+    }
+    /* an engine that cannot run leaves the file to the next one */
+    if (io->engine == BLAKE2S_IO_URING)
+        ret = blake2s_uring_run(&ctx, src, off, st.st_size, chunk, direct);
+    if (!ret && io->engine != BLAKE2S_IO_AUTO)
+        ret = blake2s_pipe_run(&ctx, NULL, src, off, st.st_size, chunk,
+                               direct);
+    if (!ret) {
+        if (!direct)
+            off = bfile_map(&ctx, fd, off, st.st_size);
+        ret = bfile_read(&ctx, src, off, st.st_size, chunk, direct);
+    }
+    if (direct) {
+        int err = errno;
+        close(src);
+        errno = err;
+    }
+    if (ret < 0 || fseeko(stream, st.st_size, SEEK_SET) < 0)
+        return -1;
+    return blake2s_file_finish(&ctx, stream, chunk, out);
+}
+
+int blake2s_file(unsigned char *out, FILE *stream)
+{
+    return blake2s_file_ex(out, stream, NULL);
+}
+
+/* Multithreaded file hashing in tree mode
+ *
+ * The tree has a fixed shape (see blake2s.h), so the digest does not
+ * depend on the number of threads. A segment is the input of one node
+ * of level 1: BLAKE2S_FILE_FANOUT leaves. Segments are the tasks of a
+ * worker pool job; each pread()s its segment in B2S_FILE_CHUNK pieces,
+ * hashes the leaves of each piece through the multi-buffer kernel, and
+ * the segment's node from their digests. The levels above, if the
+ * file is large enough for the tree to be deeper than
+ * BLAKE2S_FILE_DEPTH, and the root then hash the segment digests.
+ */
+#define B2S_FILE_SEGMENT ((off_t)BLAKE2S_FILE_LEAF * BLAKE2S_FILE_FANOUT)
+#define B2S_FILE_LEAVES  16 /* leaves per read */
+#define B2S_FILE_CHUNK   (B2S_FILE_LEAVES * BLAKE2S_FILE_LEAF)
+
+struct bfile_job {
+    int fd;
+    off_t size;
+    size_t nseg;
+    unsigned depth;
+    int err;                 /* errno of the first failure */
+    pthread_mutex_t lock;
+    unsigned char (*digest)[BLAKE2S_LEN];
+};
+
+/* bfile_depth: the depth of the tree over `nseg` segments, so that
+ * the root has at most BLAKE2S_FILE_FANOUT children */
+static unsigned bfile_depth(size_t nseg)
+{
+    unsigned depth = BLAKE2S_FILE_DEPTH;
+    size_t top = nseg;
+
+    while (top > BLAKE2S_FILE_FANOUT) {
+        top = (top - 1) / BLAKE2S_FILE_FANOUT + 1;
+        depth++;
+    }
+    return depth;
+}
+
+static void bfile_param(struct blake2s_param *P, unsigned depth)
+{
+    memset(P, 0, sizeof(*P));
+    P->digest_len = BLAKE2S_LEN;
+    P->fanout = BLAKE2S_FILE_FANOUT;
+    P->depth = depth;
+    P->leaf_len = BLAKE2S_FILE_LEAF;
+    P->inner_len = BLAKE2S_LEN;
+}
+
+static int bfile_segment(struct bfile_job *J, size_t s, unsigned char *buf,
+                         unsigned char *out)
+{
+    unsigned char leaf[B2S_FILE_LEAVES][BLAKE2S_LEN];
+    struct blake2s_param P;
+    struct blake2s_ctx node;
+    off_t off = (off_t)s * B2S_FILE_SEGMENT;
+    off_t end = off + B2S_FILE_SEGMENT < J->size ? off + B2S_FILE_SEGMENT
+                                                 : J->size;
+
+    bfile_param(&P, J->depth);
+    P.node_depth = 1;
+    P.node_offset = s;
+    P.last_node = (s == J->nseg - 1);
+    blake2s_init_param(&node, &P, NULL);
+    node.digest_len = BLAKE2S_LEN; /* inner length */
+
+    P.node_depth = 0;
+    do {
+        size_t want = end - off < B2S_FILE_CHUNK ? end - off : B2S_FILE_CHUNK;
+        ssize_t got = blake2s_pread(J->fd, buf, want, off);
+        size_t n;
+        if (got < 0)
+            return -1;
+        if ((size_t)got != want) {
+            errno = EIO; /* the file shrank */
+            return -1;
+        }
+        P.node_offset = off / BLAKE2S_FILE_LEAF;
+        P.last_node = (off + got == J->size);
+        n = blake2s_tree_nodes(leaf[0], buf, got, &P, NULL);
+        blake2s_update(&node, leaf, n * BLAKE2S_LEN);
+        off += got;
+    } while (off < end);
+    blake2s_final(&node, out);
+    return 0;
+}
+
+static void bfile_task(void *arg, size_t s)
+{
+    struct bfile_job *J = arg;
+    unsigned char *buf;
+    int err;
+
+    pthread_mutex_lock(&J->lock);
+    err = J->err;
+    pthread_mutex_unlock(&J->lock);
+    if (err)
+        return;
+
+    buf = malloc(B2S_FILE_CHUNK);
+    if (!buf)
+        err = ENOMEM;
+    else if (bfile_segment(J, s, buf, J->digest[s]) < 0)
+        err = errno ? errno : EIO;
+    free(buf);
+    if (err) {
+        pthread_mutex_lock(&J->lock);
+        if (!J->err)
+            J->err = err;
+        pthread_mutex_unlock(&J->lock);
+    }
+}
+
+int blake2s_file_tree(unsigned char *out, FILE *stream, unsigned nthreads)
+{
+    struct bfile_job J;
+    struct blake2s_param P;
+    struct blake2s_ctx root;
+    struct stat st;
+    unsigned char (*up)[BLAKE2S_LEN];
+    size_t n;
+
+    J.fd = fileno(stream);
+    if (J.fd < 0 || fstat(J.fd, &st) < 0)
+        return -1;
+    if (!S_ISREG(st.st_mode)) {
+        errno = ESPIPE;
+        return -1;
+    }
+    J.size = st.st_size;
+    J.nseg = J.size ? (J.size - 1) / B2S_FILE_SEGMENT + 1 : 1;
+    J.depth = bfile_depth(J.nseg);
+    J.err = 0;
+    J.digest = malloc(J.nseg * sizeof(*J.digest));
+    up = malloc(((J.nseg - 1) / BLAKE2S_FILE_FANOUT + 1) * sizeof(*up));
+    if (!J.digest || !up) {
+        free(J.digest);
+        free(up);
+        errno = ENOMEM;
+        return -1;
+    }
+    pthread_mutex_init(&J.lock, NULL);
+    blake2s_pool_run(nthreads, J.nseg, bfile_task, &J);
+    pthread_mutex_destroy(&J.lock);
+
+    if (!J.err) {
+        bfile_param(&P, J.depth);
+        P.last_node = 1;
+        /* levels alternate between J.digest and `up`, as in blake2s_tree */
+        n = J.nseg;
+        for (P.node_depth = 2; P.node_depth < J.depth - 1; P.node_depth++) {
+            int odd = P.node_depth & 1;
+            n = blake2s_tree_nodes(odd ? J.digest[0] : up[0],
+                                   odd ? up : J.digest, n * sizeof(*up),
+                                   &P, NULL);
+        }
+        blake2s_init_param(&root, &P, NULL);
+        blake2s_update(&root, (P.node_depth & 1) ? up : J.digest,
+                       n * sizeof(*up));
+        blake2s_final(&root, out);
+    }
+    free(J.digest);
+    free(up);
+    if (J.err) {
+        errno = J.err;
+        return -1;
+    }
+    return 1;
+}
@@ -0,0 +1,14950 @@
+	.file	"blake2s-file.c"
+# GNU C99 (Debian 12.2.0-14+deb12u1) version 12.2.0 (x86_64-linux-gnu)
+#	compiled by GNU C version 12.2.0, GMP version 6.2.1, MPFR version 4.2.0, MPC version 1.3.1, isl version isl-0.25-GMP
+
+# GGC heuristics: --param ggc-min-expand=100 --param ggc-min-heapsize=131072
+# options passed: -mtune=generic -march=x86-64 -g -O3 -std=c99 -fasynchronous-unwind-tables
+	.text
+.Ltext0:
+	.file 0 "/root/repo" "blake2s-file.c"
+	.p2align 4
+	.type	bfile_segment, @function
+bfile_segment:
+.LVL0:
+.LFB44:
+	.file 1 "blake2s-file.c"
+	.loc 1 290 1 view -0
+	.cfi_startproc
+	.loc 1 291 5 view .LVU1
+	.loc 1 292 5 view .LVU2
+	.loc 1 293 5 view .LVU3
+	.loc 1 294 5 view .LVU4
+# blake2s-file.c:290: {
+	.loc 1 290 1 is_stmt 0 view .LVU5
+	pushq	%r15	#
+	.cfi_def_cfa_offset 16
+	.cfi_offset 15, -16
+.LBB16:
+.LBB17:
+# blake2s-file.c:280:     memset(P, 0, sizeof(*P));
+	.loc 1 280 5 view .LVU6
+	pxor	%xmm0, %xmm0	# tmp139
+.LBE17:
+.LBE16:
+# blake2s-file.c:290: {
+	.loc 1 290 1 view .LVU7
+	movq	%rsi, %rax	# tmp187, s
+	pushq	%r14	#
+	.cfi_def_cfa_offset 24
+	.cfi_offset 14, -24
+	movq	%rdi, %r14	# tmp186, J
+	pushq	%r13	#
+	.cfi_def_cfa_offset 32
+	.cfi_offset 13, -32
+	pushq	%r12	#
+	.cfi_def_cfa_offset 40
+	.cfi_offset 12, -40
+	movq	%rdx, %r12	# tmp188, buf
+	pushq	%rbp	#
+	.cfi_def_cfa_offset 48
+	.cfi_offset 6, -48
+# blake2s-file.c:294:     off_t off = (off_t)s * B2S_FILE_SEGMENT;
+	.loc 1 294 11 view .LVU8
+	movq	%rsi, %rbp	# s, off
+# blake2s-file.c:290: {
+	.loc 1 290 1 view .LVU9
+	pushq	%rbx	#
+	.cfi_def_cfa_offset 56
+	.cfi_offset 3, -56
+# blake2s-file.c:294:     off_t off = (off_t)s * B2S_FILE_SEGMENT;
+	.loc 1 294 11 view .LVU10
+	salq	$23, %rbp	#, off
+.LVL1:
+	.loc 1 295 5 is_stmt 1 view .LVU11
+# blake2s-file.c:295:     off_t end = off + B2S_FILE_SEGMENT < J->size ? off + B2S_FILE_SEGMENT
+	.loc 1 295 21 is_stmt 0 view .LVU12
+	leaq	8388608(%rbp), %r15	#, tmp135
+# blake2s-file.c:290: {
+	.loc 1 290 1 view .LVU13
+	subq	$760, %rsp	#,
+	.cfi_def_cfa_offset 816
+# blake2s-file.c:295:     off_t end = off + B2S_FILE_SEGMENT < J->size ? off + B2S_FILE_SEGMENT
+	.loc 1 295 11 view .LVU14
+	movq	8(%rdi), %rdx	# J_29(D)->size, tmp197
+.LVL2:
+.LBB27:
+.LBB18:
+# blake2s-file.c:280:     memset(P, 0, sizeof(*P));
+	.loc 1 280 5 view .LVU15
+	movups	%xmm0, 52(%rsp)	# tmp139, MEM <char[1:60]> [(void *)&P + 4B]
+	leaq	48(%rsp), %rsi	#, tmp182
+.LVL3:
+	.loc 1 280 5 view .LVU16
+.LBE18:
+.LBE27:
+# blake2s-file.c:295:     off_t end = off + B2S_FILE_SEGMENT < J->size ? off + B2S_FILE_SEGMENT
+	.loc 1 295 11 view .LVU17
+	cmpq	%rdx, %r15	# tmp197, tmp135
+.LBB28:
+.LBB19:
+# blake2s-file.c:280:     memset(P, 0, sizeof(*P));
+	.loc 1 280 5 view .LVU18
+	movups	%xmm0, 68(%rsp)	# tmp139, MEM <char[1:60]> [(void *)&P + 4B]
+.LBE19:
+.LBE28:
+# blake2s-file.c:295:     off_t end = off + B2S_FILE_SEGMENT < J->size ? off + B2S_FILE_SEGMENT
+	.loc 1 295 11 view .LVU19
+	cmovle	%r15, %rdx	# tmp135,, tmp197
+.LBB29:
+.LBB20:
+# blake2s-file.c:280:     memset(P, 0, sizeof(*P));
+	.loc 1 280 5 view .LVU20
+	movups	%xmm0, 84(%rsp)	# tmp139, MEM <char[1:60]> [(void *)&P + 4B]
+.LBE20:
+.LBE29:
+# blake2s-file.c:300:     P.node_offset = s;
+	.loc 1 300 19 view .LVU21
+	movq	%rax, 72(%rsp)	# s, P.node_offset
+# blake2s-file.c:295:     off_t end = off + B2S_FILE_SEGMENT < J->size ? off + B2S_FILE_SEGMENT
+	.loc 1 295 11 view .LVU22
+	movq	%rdx, 8(%rsp)	# tmp197, %sfp
+.LVL4:
+	.loc 1 298 5 is_stmt 1 view .LVU23
+	movl	24(%rdi), %edx	# J_29(D)->depth, _4
+.LVL5:
+.LBB30:
+.LBI16:
+	.loc 1 278 13 view .LVU24
+.LBB21:
+	.loc 1 280 5 view .LVU25
+.LBE21:
+.LBE30:
+# blake2s-file.c:301:     P.last_node = (s == J->nseg - 1);
+	.loc 1 301 33 is_stmt 0 view .LVU26
+	movq	16(%rdi), %rdi	# J_29(D)->nseg, tmp201
+.LVL6:
+.LBB31:
+.LBB22:
+# blake2s-file.c:280:     memset(P, 0, sizeof(*P));
+	.loc 1 280 5 view .LVU27
+	movups	%xmm0, 96(%rsp)	# tmp139, MEM <char[1:60]> [(void *)&P + 4B]
+	.loc 1 281 5 is_stmt 1 view .LVU28
+# blake2s-file.c:283:     P->depth = depth;
+	.loc 1 283 14 is_stmt 0 view .LVU29
+	movl	%edx, 60(%rsp)	# _4, P.depth
+.LBE22:
+.LBE31:
+# blake2s-file.c:299:     P.node_depth = 1;
+	.loc 1 299 18 view .LVU30
+	movq	.LC0(%rip), %rdx	#, tmp140
+.LVL7:
+# blake2s-file.c:290: {
+	.loc 1 290 1 view .LVU31
+	movq	%rcx, 40(%rsp)	# tmp189, %sfp
+# blake2s-file.c:299:     P.node_depth = 1;
+	.loc 1 299 18 view .LVU32
+	movq	%rdx, 80(%rsp)	# tmp140, MEM <vector(2) unsigned int> [(unsigned int *)&P + 32B]
+# blake2s-file.c:301:     P.last_node = (s == J->nseg - 1);
+	.loc 1 301 33 view .LVU33
+	leaq	-1(%rdi), %rdx	#, tmp141
+# blake2s-file.c:301:     P.last_node = (s == J->nseg - 1);
+	.loc 1 301 22 view .LVU34
+	cmpq	%rax, %rdx	# s, tmp141
+.LBB32:
+.LBB23:
+# blake2s-file.c:280:     memset(P, 0, sizeof(*P));
+	.loc 1 280 5 view .LVU35
+	movq	%rsi, 24(%rsp)	# tmp182, %sfp
+.LBE23:
+.LBE32:
+# blake2s-file.c:301:     P.last_node = (s == J->nseg - 1);
+	.loc 1 301 22 view .LVU36
+	sete	%al	#, tmp143
+.LVL8:
+# blake2s-file.c:302:     blake2s_init_param(&node, &P, NULL);
+	.loc 1 302 5 view .LVU37
+	xorl	%edx, %edx	#
+.LBB33:
+.LBB24:
+# blake2s-file.c:281:     P->digest_len = BLAKE2S_LEN;
+	.loc 1 281 19 view .LVU38
+	movl	$32, 48(%rsp)	#, P.digest_len
+	.loc 1 282 5 is_stmt 1 view .LVU39
+.LBE24:
+.LBE33:
+# blake2s-file.c:301:     P.last_node = (s == J->nseg - 1);
+	.loc 1 301 22 is_stmt 0 view .LVU40
+	movzbl	%al, %eax	# tmp143, tmp143
+.LBB34:
+.LBB25:
+# blake2s-file.c:282:     P->fanout = BLAKE2S_FILE_FANOUT;
+	.loc 1 282 15 view .LVU41
+	movl	$128, 56(%rsp)	#, P.fanout
+	.loc 1 283 5 is_stmt 1 view .LVU42
+	.loc 1 284 5 view .LVU43
+.LBE25:
+.LBE34:
+# blake2s-file.c:301:     P.last_node = (s == J->nseg - 1);
+	.loc 1 301 17 is_stmt 0 view .LVU44
+	movl	%eax, 104(%rsp)	# tmp143, P.last_node
+# blake2s-file.c:302:     blake2s_init_param(&node, &P, NULL);
+	.loc 1 302 5 view .LVU45
+	leaq	112(%rsp), %rax	#, tmp183
+	movq	%rax, %rdi	# tmp183,
+.LBB35:
+.LBB26:
+# blake2s-file.c:284:     P->leaf_len = BLAKE2S_FILE_LEAF;
+	.loc 1 284 17 view .LVU46
+	movl	$65536, 64(%rsp)	#, P.leaf_len
+	.loc 1 285 5 is_stmt 1 view .LVU47
+.LVL9:
+	.loc 1 285 5 is_stmt 0 view .LVU48
+.LBE26:
+.LBE35:
+	.loc 1 299 5 is_stmt 1 view .LVU49
+	.loc 1 300 5 view .LVU50
+	.loc 1 301 5 view .LVU51
+	.loc 1 302 5 view .LVU52
+	movq	%rax, 16(%rsp)	# tmp183, %sfp
+	call	blake2s_init_param@PLT	#
+.LVL10:
+	.loc 1 303 5 view .LVU53
+.LBB36:
+# blake2s-file.c:318:         n = blake2s_tree_nodes(leaf[0], buf, got, &P, NULL);
+	.loc 1 318 13 is_stmt 0 view .LVU54
+	leaq	240(%rsp), %rax	#, tmp185
+.LBE36:
+# blake2s-file.c:303:     node.digest_len = BLAKE2S_LEN; /* inner length */
+	.loc 1 303 21 view .LVU55
+	movl	$32, 228(%rsp)	#, node.digest_len
+	.loc 1 305 5 is_stmt 1 view .LVU56
+# blake2s-file.c:305:     P.node_depth = 0;
+	.loc 1 305 18 is_stmt 0 view .LVU57
+	movl	$0, 80(%rsp)	#, P.node_depth
+.LBB45:
+# blake2s-file.c:318:         n = blake2s_tree_nodes(leaf[0], buf, got, &P, NULL);
+	.loc 1 318 13 view .LVU58
+	movq	%rax, 32(%rsp)	# tmp185, %sfp
+.LVL11:
+	.p2align 4,,10
+	.p2align 3
+.L9:
+	.loc 1 318 13 view .LVU59
+.LBE45:
+	.loc 1 306 5 is_stmt 1 view .LVU60
+.LBB46:
+	.loc 1 307 9 view .LVU61
+# blake2s-file.c:307:         size_t want = end - off < B2S_FILE_CHUNK ? end - off : B2S_FILE_CHUNK;
+	.loc 1 307 27 is_stmt 0 view .LVU62
+	movq	8(%rsp), %rbx	# %sfp, _10
+# blake2s-file.c:307:         size_t want = end - off < B2S_FILE_CHUNK ? end - off : B2S_FILE_CHUNK;
+	.loc 1 307 65 view .LVU63
+	movl	$1048576, %eax	#, tmp196
+# blake2s-file.c:308:         ssize_t got = blake2s_pread(J->fd, buf, want, off);
+	.loc 1 308 23 view .LVU64
+	movl	(%r14), %r13d	# J_29(D)->fd, _12
+# blake2s-file.c:307:         size_t want = end - off < B2S_FILE_CHUNK ? end - off : B2S_FILE_CHUNK;
+	.loc 1 307 27 view .LVU65
+	subq	%rbp, %rbx	# off, _10
+# blake2s-file.c:307:         size_t want = end - off < B2S_FILE_CHUNK ? end - off : B2S_FILE_CHUNK;
+	.loc 1 307 65 view .LVU66
+	cmpq	%rax, %rbx	# tmp196, _10
+	cmovg	%rax, %rbx	# _10,, tmp196, _10
+.LVL12:
+	.loc 1 308 9 is_stmt 1 view .LVU67
+.LBB37:
+.LBI37:
+	.loc 1 60 9 view .LVU68
+.LBB38:
+	.loc 1 62 5 view .LVU69
+	.loc 1 63 5 view .LVU70
+	.loc 1 63 16 view .LVU71
+	testq	%rbx, %rbx	# _10
+	je	.L2	#,
+# blake2s-file.c:62:     size_t got = 0;
+	.loc 1 62 12 is_stmt 0 view .LVU72
+	xorl	%r15d, %r15d	# got
+	jmp	.L7	#
+.LVL13:
+	.p2align 4,,10
+	.p2align 3
+.L3:
+.LBB39:
+	.loc 1 69 9 is_stmt 1 view .LVU73
+# blake2s-file.c:69:         if (!r)
+	.loc 1 69 12 is_stmt 0 view .LVU74
+	je	.L6	#,
+	.loc 1 71 9 is_stmt 1 view .LVU75
+# blake2s-file.c:71:         got += r;
+	.loc 1 71 13 is_stmt 0 view .LVU76
+	addq	%rax, %r15	# r, got
+.LVL14:
+.L4:
+	.loc 1 71 13 view .LVU77
+.LBE39:
+	.loc 1 63 16 is_stmt 1 view .LVU78
+	cmpq	%rbx, %r15	# _10, got
+	jnb	.L6	#,
+.LVL15:
+.L7:
+.LBB40:
+	.loc 1 64 9 view .LVU79
+# blake2s-file.c:64:         ssize_t r = pread(fd, (char *)buf + got, len - got, off + got);
+	.loc 1 64 21 is_stmt 0 view .LVU80
+	movq	%rbx, %rdx	# _10, tmp148
+# blake2s-file.c:64:         ssize_t r = pread(fd, (char *)buf + got, len - got, off + got);
+	.loc 1 64 65 view .LVU81
+	leaq	0(%rbp,%r15), %rcx	#, tmp147
+# blake2s-file.c:64:         ssize_t r = pread(fd, (char *)buf + got, len - got, off + got);
+	.loc 1 64 21 view .LVU82
+	leaq	(%r12,%r15), %rsi	#, tmp149
+	movl	%r13d, %edi	# _12,
+	subq	%r15, %rdx	# got, tmp148
+	call	pread@PLT	#
+.LVL16:
+	.loc 1 65 9 is_stmt 1 view .LVU83
+# blake2s-file.c:65:         if (r < 0 && errno == EINTR)
+	.loc 1 65 12 is_stmt 0 view .LVU84
+	testq	%rax, %rax	# r
+	jns	.L3	#,
+# blake2s-file.c:65:         if (r < 0 && errno == EINTR)
+	.loc 1 65 23 view .LVU85
+	call	__errno_location@PLT	#
+.LVL17:
+# blake2s-file.c:65:         if (r < 0 && errno == EINTR)
+	.loc 1 65 19 view .LVU86
+	cmpl	$4, (%rax)	#, *_65
+	je	.L4	#,
+.LVL18:
+.L5:
+	.loc 1 65 19 view .LVU87
+.LBE40:
+.LBE38:
+.LBE37:
+# blake2s-file.c:311:             return -1;
+	.loc 1 311 20 view .LVU88
+	movl	$-1, %eax	#, <retval>
+.LVL19:
+.L1:
+	.loc 1 311 20 view .LVU89
+.LBE46:
+# blake2s-file.c:324: }
+	.loc 1 324 1 view .LVU90
+	addq	$760, %rsp	#,
+	.cfi_remember_state
+	.cfi_def_cfa_offset 56
+	popq	%rbx	#
+	.cfi_def_cfa_offset 48
+	popq	%rbp	#
+	.cfi_def_cfa_offset 40
+.LVL20:
+	.loc 1 324 1 view .LVU91
+	popq	%r12	#
+	.cfi_def_cfa_offset 32
+.LVL21:
+	.loc 1 324 1 view .LVU92
+	popq	%r13	#
+	.cfi_def_cfa_offset 24
+	popq	%r14	#
+	.cfi_def_cfa_offset 16
+.LVL22:
+	.loc 1 324 1 view .LVU93
+	popq	%r15	#
+	.cfi_def_cfa_offset 8
+	ret	
+.LVL23:
+	.p2align 4,,10
+	.p2align 3
+.L6:
+	.cfi_restore_state
+.LBB47:
+.LBB43:
+.LBB41:
+	.loc 1 73 5 is_stmt 1 view .LVU94
+	.loc 1 73 5 is_stmt 0 view .LVU95
+.LBE41:
+.LBE43:
+	.loc 1 309 9 is_stmt 1 view .LVU96
+	.loc 1 310 9 view .LVU97
+# blake2s-file.c:310:         if (got < 0)
+	.loc 1 310 12 is_stmt 0 view .LVU98
+	testq	%r15, %r15	# got
+	js	.L5	#,
+	.loc 1 312 9 is_stmt 1 view .LVU99
+# blake2s-file.c:312:         if ((size_t)got != want) {
+	.loc 1 312 12 is_stmt 0 view .LVU100
+	cmpq	%r15, %rbx	# got, _10
+	jne	.L8	#,
+# blake2s-file.c:316:         P.node_offset = off / BLAKE2S_FILE_LEAF;
+	.loc 1 316 29 view .LVU101
+	testq	%rbp, %rbp	# off
+	leaq	65535(%rbp), %rax	#, tmp151
+# blake2s-file.c:318:         n = blake2s_tree_nodes(leaf[0], buf, got, &P, NULL);
+	.loc 1 318 13 view .LVU102
+	movq	%rbx, %rdx	# _10,
+	movq	%r12, %rsi	# buf,
+# blake2s-file.c:316:         P.node_offset = off / BLAKE2S_FILE_LEAF;
+	.loc 1 316 29 view .LVU103
+	cmovns	%rbp, %rax	# tmp151,, off, off
+# blake2s-file.c:317:         P.last_node = (off + got == J->size);
+	.loc 1 317 28 view .LVU104
+	leaq	0(%rbp,%rbx), %r13	#, _90
+.LVL24:
+	.loc 1 316 9 is_stmt 1 view .LVU105
+# blake2s-file.c:318:         n = blake2s_tree_nodes(leaf[0], buf, got, &P, NULL);
+	.loc 1 318 13 is_stmt 0 view .LVU106
+	movq	32(%rsp), %rbx	# %sfp, tmp185
+.LVL25:
+	.loc 1 318 13 view .LVU107
+	movq	24(%rsp), %rcx	# %sfp,
+# blake2s-file.c:316:         P.node_offset = off / BLAKE2S_FILE_LEAF;
+	.loc 1 316 29 view .LVU108
+	sarq	$16, %rax	#, tmp152
+# blake2s-file.c:318:         n = blake2s_tree_nodes(leaf[0], buf, got, &P, NULL);
+	.loc 1 318 13 view .LVU109
+	movq	%rbx, %rdi	# tmp185,
+# blake2s-file.c:316:         P.node_offset = off / BLAKE2S_FILE_LEAF;
+	.loc 1 316 23 view .LVU110
+	movq	%rax, 72(%rsp)	# tmp152, P.node_offset
+	.loc 1 317 9 is_stmt 1 view .LVU111
+# blake2s-file.c:317:         P.last_node = (off + got == J->size);
+	.loc 1 317 34 is_stmt 0 view .LVU112
+	xorl	%eax, %eax	# tmp153
+	cmpq	%r13, 8(%r14)	# _90, J_29(D)->size
+	sete	%al	#, tmp153
+# blake2s-file.c:318:         n = blake2s_tree_nodes(leaf[0], buf, got, &P, NULL);
+	.loc 1 318 13 view .LVU113
+	xorl	%r8d, %r8d	#
+# blake2s-file.c:317:         P.last_node = (off + got == J->size);
+	.loc 1 317 21 view .LVU114
+	movl	%eax, 104(%rsp)	# tmp153, P.last_node
+	.loc 1 318 9 is_stmt 1 view .LVU115
+# blake2s-file.c:318:         n = blake2s_tree_nodes(leaf[0], buf, got, &P, NULL);
+	.loc 1 318 13 is_stmt 0 view .LVU116
+	call	blake2s_tree_nodes@PLT	#
+.LVL26:
+	.loc 1 319 9 is_stmt 1 view .LVU117
+	movq	16(%rsp), %rdi	# %sfp,
+	movq	%rbx, %rsi	# tmp185,
+	salq	$5, %rax	#, tmp192
+.LVL27:
+	.loc 1 319 9 is_stmt 0 view .LVU118
+	movq	%rax, %rdx	# tmp192, tmp157
+	call	blake2s_update@PLT	#
+.LVL28:
+	.loc 1 320 9 is_stmt 1 view .LVU119
+	.loc 1 320 9 is_stmt 0 view .LVU120
+.LBE47:
+	.loc 1 321 18 is_stmt 1 view .LVU121
+	cmpq	%r13, 8(%rsp)	# _90, %sfp
+	jle	.L10	#,
+.LBB48:
+# blake2s-file.c:317:         P.last_node = (off + got == J->size);
+	.loc 1 317 28 is_stmt 0 view .LVU122
+	movq	%r13, %rbp	# _90, off
+.LVL29:
+	.loc 1 317 28 view .LVU123
+	jmp	.L9	#
+.LVL30:
+.L2:
+	.loc 1 316 9 is_stmt 1 view .LVU124
+# blake2s-file.c:316:         P.node_offset = off / BLAKE2S_FILE_LEAF;
+	.loc 1 316 29 is_stmt 0 view .LVU125
+	testq	%rbp, %rbp	# off
+# blake2s-file.c:318:         n = blake2s_tree_nodes(leaf[0], buf, got, &P, NULL);
+	.loc 1 318 13 view .LVU126
+	movq	24(%rsp), %rcx	# %sfp,
+	movq	%r12, %rsi	# buf,
+# blake2s-file.c:316:         P.node_offset = off / BLAKE2S_FILE_LEAF;
+	.loc 1 316 29 view .LVU127
+	leaq	65535(%rbp), %rax	#, tmp173
+	cmovns	%rbp, %rax	# tmp173,, off, off
+# blake2s-file.c:318:         n = blake2s_tree_nodes(leaf[0], buf, got, &P, NULL);
+	.loc 1 318 13 view .LVU128
+	leaq	240(%rsp), %rbx	#, tmp184
+.LVL31:
+	.loc 1 318 13 view .LVU129
+	movq	%rbx, %rdi	# tmp184,
+# blake2s-file.c:316:         P.node_offset = off / BLAKE2S_FILE_LEAF;
+	.loc 1 316 29 view .LVU130
+	sarq	$16, %rax	#, off
+# blake2s-file.c:316:         P.node_offset = off / BLAKE2S_FILE_LEAF;
+	.loc 1 316 23 view .LVU131
+	movq	%rax, 72(%rsp)	# tmp174, P.node_offset
+	.loc 1 317 9 is_stmt 1 view .LVU132
+# blake2s-file.c:316:         P.node_offset = off / BLAKE2S_FILE_LEAF;
+	.loc 1 316 29 is_stmt 0 view .LVU133
+	movq	%rax, %r13	# off, tmp174
+# blake2s-file.c:317:         P.last_node = (off + got == J->size);
+	.loc 1 317 34 view .LVU134
+	xorl	%eax, %eax	# tmp175
+	cmpq	%rbp, 8(%r14)	# off, J_29(D)->size
+	sete	%al	#, tmp175
+# blake2s-file.c:318:         n = blake2s_tree_nodes(leaf[0], buf, got, &P, NULL);
+	.loc 1 318 13 view .LVU135
+	xorl	%r8d, %r8d	#
+	xorl	%edx, %edx	#
+# blake2s-file.c:317:         P.last_node = (off + got == J->size);
+	.loc 1 317 21 view .LVU136
+	movl	%eax, 104(%rsp)	# tmp175, P.last_node
+	.loc 1 318 9 is_stmt 1 view .LVU137
+# blake2s-file.c:318:         n = blake2s_tree_nodes(leaf[0], buf, got, &P, NULL);
+	.loc 1 318 13 is_stmt 0 view .LVU138
+	call	blake2s_tree_nodes@PLT	#
+.LVL32:
+	.loc 1 319 9 is_stmt 1 view .LVU139
+	movq	16(%rsp), %rdi	# %sfp,
+	movq	%rbx, %rsi	# tmp184,
+	salq	$5, %rax	#, tmp195
+.LVL33:
+	.loc 1 319 9 is_stmt 0 view .LVU140
+	movq	%rax, %rdx	# tmp195, tmp179
+	call	blake2s_update@PLT	#
+.LVL34:
+	.loc 1 320 9 is_stmt 1 view .LVU141
+	.loc 1 320 9 is_stmt 0 view .LVU142
+.LBE48:
+	.loc 1 321 18 is_stmt 1 view .LVU143
+	movq	8(%rsp), %rax	# %sfp, end
+	cmpq	%rax, %rbp	# end, off
+	jge	.L10	#,
+.LVL35:
+.L12:
+	.loc 1 306 5 view .LVU144
+.LBB49:
+	.loc 1 307 9 view .LVU145
+	.loc 1 308 9 view .LVU146
+.LBB44:
+	.loc 1 60 9 view .LVU147
+.LBB42:
+	.loc 1 62 5 view .LVU148
+	.loc 1 63 5 view .LVU149
+	.loc 1 63 16 view .LVU150
+	.loc 1 63 16 is_stmt 0 view .LVU151
+.LBE42:
+.LBE44:
+	.loc 1 316 9 is_stmt 1 view .LVU152
+# blake2s-file.c:318:         n = blake2s_tree_nodes(leaf[0], buf, got, &P, NULL);
+	.loc 1 318 13 is_stmt 0 view .LVU153
+	movq	24(%rsp), %rcx	# %sfp,
+# blake2s-file.c:317:         P.last_node = (off + got == J->size);
+	.loc 1 317 34 view .LVU154
+	xorl	%eax, %eax	# tmp163
+	cmpq	%rbp, 8(%r14)	# off, J_29(D)->size
+# blake2s-file.c:318:         n = blake2s_tree_nodes(leaf[0], buf, got, &P, NULL);
+	.loc 1 318 13 view .LVU155
+	movq	%r12, %rsi	# buf,
+# blake2s-file.c:317:         P.last_node = (off + got == J->size);
+	.loc 1 317 34 view .LVU156
+	sete	%al	#, tmp163
+# blake2s-file.c:318:         n = blake2s_tree_nodes(leaf[0], buf, got, &P, NULL);
+	.loc 1 318 13 view .LVU157
+	movq	%rbx, %rdi	# tmp184,
+	xorl	%edx, %edx	#
+	xorl	%r8d, %r8d	#
+# blake2s-file.c:316:         P.node_offset = off / BLAKE2S_FILE_LEAF;
+	.loc 1 316 23 view .LVU158
+	movq	%r13, 72(%rsp)	# tmp174, P.node_offset
+	.loc 1 317 9 is_stmt 1 view .LVU159
+# blake2s-file.c:317:         P.last_node = (off + got == J->size);
+	.loc 1 317 21 is_stmt 0 view .LVU160
+	movl	%eax, 104(%rsp)	# tmp163, P.last_node
+	.loc 1 318 9 is_stmt 1 view .LVU161
+# blake2s-file.c:318:         n = blake2s_tree_nodes(leaf[0], buf, got, &P, NULL);
+	.loc 1 318 13 is_stmt 0 view .LVU162
+	call	blake2s_tree_nodes@PLT	#
+.LVL36:
+	.loc 1 319 9 is_stmt 1 view .LVU163
+	movq	16(%rsp), %rdi	# %sfp,
+	movq	%rbx, %rsi	# tmp184,
+	salq	$5, %rax	#, tmp194
+.LVL37:
+	.loc 1 319 9 is_stmt 0 view .LVU164
+	movq	%rax, %rdx	# tmp194, tmp167
+	call	blake2s_update@PLT	#
+.LVL38:
+	.loc 1 320 9 is_stmt 1 view .LVU165
+	.loc 1 320 9 is_stmt 0 view .LVU166
+.LBE49:
+	.loc 1 321 18 is_stmt 1 view .LVU167
+	jmp	.L12	#
+.LVL39:
+.L8:
+.LBB50:
+	.loc 1 313 12 view .LVU168
+# blake2s-file.c:313:             errno = EIO; /* the file shrank */
+	.loc 1 313 14 is_stmt 0 view .LVU169
+	call	__errno_location@PLT	#
+.LVL40:
+# blake2s-file.c:313:             errno = EIO; /* the file shrank */
+	.loc 1 313 18 view .LVU170
+	movl	$5, (%rax)	#, *_13
+	.loc 1 314 13 is_stmt 1 view .LVU171
+# blake2s-file.c:314:             return -1;
+	.loc 1 314 20 is_stmt 0 view .LVU172
+	jmp	.L5	#
+.LVL41:
+.L10:
+	.loc 1 314 20 view .LVU173
+.LBE50:
+	.loc 1 322 5 is_stmt 1 view .LVU174
+	movq	40(%rsp), %rsi	# %sfp,
+	movq	16(%rsp), %rdi	# %sfp,
+	call	blake2s_final@PLT	#
+.LVL42:
+	.loc 1 323 5 view .LVU175
+# blake2s-file.c:323:     return 0;
+	.loc 1 323 12 is_stmt 0 view .LVU176
+	xorl	%eax, %eax	# <retval>
+	jmp	.L1	#
+	.cfi_endproc
+.LFE44:
+	.size	bfile_segment, .-bfile_segment
+	.p2align 4
+	.type	bfile_task, @function
+bfile_task:
+.LVL43:
+.LFB45:
+	.loc 1 327 1 is_stmt 1 view -0
+	.cfi_startproc
+	.loc 1 328 5 view .LVU178
+	.loc 1 329 5 view .LVU179
+	.loc 1 330 5 view .LVU180
+	.loc 1 332 5 view .LVU181
+# blake2s-file.c:327: {
+	.loc 1 327 1 is_stmt 0 view .LVU182
+	pushq	%r13	#
+	.cfi_def_cfa_offset 16
+	.cfi_offset 13, -16
+	movq	%rsi, %r13	# tmp100, s
+	pushq	%r12	#
+	.cfi_def_cfa_offset 24
+	.cfi_offset 12, -24
+	pushq	%rbp	#
+	.cfi_def_cfa_offset 32
+	.cfi_offset 6, -32
+# blake2s-file.c:332:     pthread_mutex_lock(&J->lock);
+	.loc 1 332 5 view .LVU183
+	leaq	32(%rdi), %rbp	#, _1
+# blake2s-file.c:327: {
+	.loc 1 327 1 view .LVU184
+	pushq	%rbx	#
+	.cfi_def_cfa_offset 40
+	.cfi_offset 3, -40
+	movq	%rdi, %rbx	# tmp99, arg
+# blake2s-file.c:332:     pthread_mutex_lock(&J->lock);
+	.loc 1 332 5 view .LVU185
+	movq	%rbp, %rdi	# _1,
+.LVL44:
+# blake2s-file.c:327: {
+	.loc 1 327 1 view .LVU186
+	subq	$8, %rsp	#,
+	.cfi_def_cfa_offset 48
+# blake2s-file.c:332:     pthread_mutex_lock(&J->lock);
+	.loc 1 332 5 view .LVU187
+	call	pthread_mutex_lock@PLT	#
+.LVL45:
+	.loc 1 333 5 is_stmt 1 view .LVU188
+# blake2s-file.c:333:     err = J->err;
+	.loc 1 333 9 is_stmt 0 view .LVU189
+	movl	28(%rbx), %r12d	# MEM[(struct bfile_job *)arg_13(D)].err, err
+.LVL46:
+	.loc 1 334 5 is_stmt 1 view .LVU190
+	movq	%rbp, %rdi	# _1,
+	call	pthread_mutex_unlock@PLT	#
+.LVL47:
+	.loc 1 335 5 view .LVU191
+# blake2s-file.c:335:     if (err)
+	.loc 1 335 8 is_stmt 0 view .LVU192
+	testl	%r12d, %r12d	# err
+	je	.L30	#,
+# blake2s-file.c:350: }
+	.loc 1 350 1 view .LVU193
+	addq	$8, %rsp	#,
+	.cfi_remember_state
+	.cfi_def_cfa_offset 40
+	popq	%rbx	#
+	.cfi_def_cfa_offset 32
+.LVL48:
+	.loc 1 350 1 view .LVU194
+	popq	%rbp	#
+	.cfi_def_cfa_offset 24
+.LVL49:
+	.loc 1 350 1 view .LVU195
+	popq	%r12	#
+	.cfi_def_cfa_offset 16
+.LVL50:
+	.loc 1 350 1 view .LVU196
+	popq	%r13	#
+	.cfi_def_cfa_offset 8
+.LVL51:
+	.loc 1 350 1 view .LVU197
+	ret	
+.LVL52:
+	.p2align 4,,10
+	.p2align 3
+.L30:
+	.cfi_restore_state
+	.loc 1 338 5 is_stmt 1 view .LVU198
+# blake2s-file.c:338:     buf = malloc(B2S_FILE_CHUNK);
+	.loc 1 338 11 is_stmt 0 view .LVU199
+	movl	$1048576, %edi	#,
+	call	malloc@PLT	#
+.LVL53:
+	movq	%rax, %r12	# tmp101, tmp94
+.LVL54:
+	.loc 1 339 5 is_stmt 1 view .LVU200
+# blake2s-file.c:339:     if (!buf)
+	.loc 1 339 8 is_stmt 0 view .LVU201
+	testq	%rax, %rax	# tmp94
+	je	.L28	#,
+	.loc 1 341 10 is_stmt 1 view .LVU202
+# blake2s-file.c:341:     else if (bfile_segment(J, s, buf, J->digest[s]) < 0)
+	.loc 1 341 48 is_stmt 0 view .LVU203
+	movq	%r13, %rcx	# s, tmp95
+# blake2s-file.c:341:     else if (bfile_segment(J, s, buf, J->digest[s]) < 0)
+	.loc 1 341 14 view .LVU204
+	movq	%rax, %rdx	# tmp94,
+	movq	%r13, %rsi	# s,
+	movq	%rbx, %rdi	# arg,
+# blake2s-file.c:341:     else if (bfile_segment(J, s, buf, J->digest[s]) < 0)
+	.loc 1 341 48 view .LVU205
+	salq	$5, %rcx	#, tmp95
+	addq	72(%rbx), %rcx	# MEM[(struct bfile_job *)arg_13(D)].digest, tmp96
+# blake2s-file.c:341:     else if (bfile_segment(J, s, buf, J->digest[s]) < 0)
+	.loc 1 341 14 view .LVU206
+	call	bfile_segment	#
+.LVL55:
+# blake2s-file.c:341:     else if (bfile_segment(J, s, buf, J->digest[s]) < 0)
+	.loc 1 341 13 view .LVU207
+	testl	%eax, %eax	# tmp102
+	js	.L31	#,
+.LVL56:
+	.loc 1 343 5 is_stmt 1 view .LVU208
+# blake2s-file.c:350: }
+	.loc 1 350 1 is_stmt 0 view .LVU209
+	addq	$8, %rsp	#,
+	.cfi_remember_state
+	.cfi_def_cfa_offset 40
+# blake2s-file.c:343:     free(buf);
+	.loc 1 343 5 view .LVU210
+	movq	%r12, %rdi	# tmp94,
+# blake2s-file.c:350: }
+	.loc 1 350 1 view .LVU211
+	popq	%rbx	#
+	.cfi_def_cfa_offset 32
+.LVL57:
+	.loc 1 350 1 view .LVU212
+	popq	%rbp	#
+	.cfi_def_cfa_offset 24
+.LVL58:
+	.loc 1 350 1 view .LVU213
+	popq	%r12	#
+	.cfi_def_cfa_offset 16
+.LVL59:
+	.loc 1 350 1 view .LVU214
+	popq	%r13	#
+	.cfi_def_cfa_offset 8
+.LVL60:
+# blake2s-file.c:343:     free(buf);
+	.loc 1 343 5 view .LVU215
+	jmp	free@PLT	#
+.LVL61:
+	.p2align 4,,10
+	.p2align 3
+.L31:
+	.cfi_restore_state
+	.loc 1 342 9 is_stmt 1 view .LVU216
+# blake2s-file.c:342:         err = errno ? errno : EIO;
+	.loc 1 342 16 is_stmt 0 view .LVU217
+	call	__errno_location@PLT	#
+.LVL62:
+# blake2s-file.c:343:     free(buf);
+	.loc 1 343 5 view .LVU218
+	movq	%r12, %rdi	# tmp94,
+# blake2s-file.c:342:         err = errno ? errno : EIO;
+	.loc 1 342 15 view .LVU219
+	movl	(%rax), %r13d	# *_6, _7
+.LVL63:
+# blake2s-file.c:342:         err = errno ? errno : EIO;
+	.loc 1 342 28 view .LVU220
+	testl	%r13d, %r13d	# _7
+	jne	.L32	#,
+.LVL64:
+	.loc 1 343 5 is_stmt 1 view .LVU221
+	call	free@PLT	#
+.LVL65:
+	.loc 1 344 5 view .LVU222
+# blake2s-file.c:342:         err = errno ? errno : EIO;
+	.loc 1 342 28 is_stmt 0 view .LVU223
+	movl	$5, %r13d	#, _7
+.LVL66:
+.L24:
+	.loc 1 345 9 is_stmt 1 view .LVU224
+	movq	%rbp, %rdi	# _1,
+	call	pthread_mutex_lock@PLT	#
+.LVL67:
+	.loc 1 346 9 view .LVU225
+# blake2s-file.c:346:         if (!J->err)
+	.loc 1 346 12 is_stmt 0 view .LVU226
+	movl	28(%rbx), %eax	# MEM[(struct bfile_job *)arg_13(D)].err,
+	testl	%eax, %eax	#
+	jne	.L27	#,
+	.loc 1 347 13 is_stmt 1 view .LVU227
+# blake2s-file.c:347:             J->err = err;
+	.loc 1 347 20 is_stmt 0 view .LVU228
+	movl	%r13d, 28(%rbx)	# _7, MEM[(struct bfile_job *)arg_13(D)].err
+.L27:
+	.loc 1 348 9 is_stmt 1 view .LVU229
+# blake2s-file.c:350: }
+	.loc 1 350 1 is_stmt 0 view .LVU230
+	addq	$8, %rsp	#,
+	.cfi_remember_state
+	.cfi_def_cfa_offset 40
+# blake2s-file.c:348:         pthread_mutex_unlock(&J->lock);
+	.loc 1 348 9 view .LVU231
+	movq	%rbp, %rdi	# _1,
+# blake2s-file.c:350: }
+	.loc 1 350 1 view .LVU232
+	popq	%rbx	#
+	.cfi_def_cfa_offset 32
+.LVL68:
+	.loc 1 350 1 view .LVU233
+	popq	%rbp	#
+	.cfi_def_cfa_offset 24
+.LVL69:
+	.loc 1 350 1 view .LVU234
+	popq	%r12	#
+	.cfi_def_cfa_offset 16
+.LVL70:
+	.loc 1 350 1 view .LVU235
+	popq	%r13	#
+	.cfi_def_cfa_offset 8
+# blake2s-file.c:348:         pthread_mutex_unlock(&J->lock);
+	.loc 1 348 9 view .LVU236
+	jmp	pthread_mutex_unlock@PLT	#
+.LVL71:
+	.p2align 4,,10
+	.p2align 3
+.L32:
+	.cfi_restore_state
+	.loc 1 343 5 is_stmt 1 view .LVU237
+	call	free@PLT	#
+.LVL72:
+	.loc 1 344 5 view .LVU238
+	jmp	.L24	#
+.LVL73:
+.L28:
+# blake2s-file.c:340:         err = ENOMEM;
+	.loc 1 340 13 is_stmt 0 view .LVU239
+	movl	$12, %r13d	#, _7
+.LVL74:
+	.loc 1 340 13 view .LVU240
+	jmp	.L24	#
+	.cfi_endproc
+.LFE45:
+	.size	bfile_task, .-bfile_task
+	.p2align 4
+	.type	bfile_align, @function
+bfile_align:
+.LVL75:
+.LFB39:
+	.loc 1 150 1 is_stmt 1 view -0
+	.cfi_startproc
+	.loc 1 150 1 is_stmt 0 view .LVU242
+	pushq	%r15	#
+	.cfi_def_cfa_offset 16
+	.cfi_offset 15, -16
+	pushq	%r14	#
+	.cfi_def_cfa_offset 24
+	.cfi_offset 14, -24
+	movq	%rdx, %r14	# tmp130, off
+	pushq	%r13	#
+	.cfi_def_cfa_offset 32
+	.cfi_offset 13, -32
+	pushq	%r12	#
+	.cfi_def_cfa_offset 40
+	.cfi_offset 12, -40
+	pushq	%rbp	#
+	.cfi_def_cfa_offset 48
+	.cfi_offset 6, -48
+	pushq	%rbx	#
+	.cfi_def_cfa_offset 56
+	.cfi_offset 3, -56
+	subq	$4120, %rsp	#,
+	.cfi_def_cfa_offset 4176
+# blake2s-file.c:152:     size_t len = (BLAKE2S_IO_ALIGN - *off % BLAKE2S_IO_ALIGN)
+	.loc 1 152 26 view .LVU243
+	movq	(%rdx), %rbp	# *off_20(D), _1
+# blake2s-file.c:150: {
+	.loc 1 150 1 view .LVU244
+	movq	%rdi, 8(%rsp)	# tmp128, %sfp
+	.loc 1 151 5 is_stmt 1 view .LVU245
+	.loc 1 152 5 view .LVU246
+.LVL76:
+	.loc 1 154 5 view .LVU247
+	.loc 1 156 5 view .LVU248
+	leaq	16(%rsp), %r13	#, tmp127
+	movq	%rbp, %rbx	# _1, tmp118
+# blake2s-file.c:156:     if (len > (size_t)(size - *off))
+	.loc 1 156 29 is_stmt 0 view .LVU249
+	subq	%rbp, %rcx	# _1, tmp120
+.LVL77:
+	.loc 1 156 29 view .LVU250
+	negq	%rbx	# tmp118
+	andl	$4095, %ebx	#, tmp119
+	cmpq	%rcx, %rbx	# tmp120, tmp119
+	cmova	%rcx, %rbx	# tmp119,, tmp120, _3
+.LVL78:
+	.loc 1 158 5 is_stmt 1 view .LVU251
+.LBB54:
+.LBI54:
+	.loc 1 60 9 view .LVU252
+.LBB55:
+	.loc 1 62 5 view .LVU253
+	.loc 1 63 5 view .LVU254
+	.loc 1 63 16 view .LVU255
+	testq	%rbx, %rbx	# _3
+	je	.L34	#,
+	movl	%esi, %r12d	# tmp129, fd
+# blake2s-file.c:62:     size_t got = 0;
+	.loc 1 62 12 is_stmt 0 view .LVU256
+	xorl	%r15d, %r15d	# got
+	leaq	16(%rsp), %r13	#, tmp127
+	.loc 1 62 12 view .LVU257
+	jmp	.L39	#
+.LVL79:
+	.p2align 4,,10
+	.p2align 3
+.L35:
+.LBB56:
+	.loc 1 69 9 is_stmt 1 view .LVU258
+# blake2s-file.c:69:         if (!r)
+	.loc 1 69 12 is_stmt 0 view .LVU259
+	je	.L38	#,
+	.loc 1 71 9 is_stmt 1 view .LVU260
+# blake2s-file.c:71:         got += r;
+	.loc 1 71 13 is_stmt 0 view .LVU261
+	addq	%rax, %r15	# r, got
+.LVL80:
+.L36:
+	.loc 1 71 13 view .LVU262
+.LBE56:
+	.loc 1 63 16 is_stmt 1 view .LVU263
+	cmpq	%rbx, %r15	# _3, got
+	jnb	.L38	#,
+.LVL81:
+.L39:
+.LBB57:
+	.loc 1 64 9 view .LVU264
+# blake2s-file.c:64:         ssize_t r = pread(fd, (char *)buf + got, len - got, off + got);
+	.loc 1 64 21 is_stmt 0 view .LVU265
+	movq	%rbx, %rdx	# _3, tmp122
+# blake2s-file.c:64:         ssize_t r = pread(fd, (char *)buf + got, len - got, off + got);
+	.loc 1 64 65 view .LVU266
+	leaq	0(%rbp,%r15), %rcx	#, tmp121
+# blake2s-file.c:64:         ssize_t r = pread(fd, (char *)buf + got, len - got, off + got);
+	.loc 1 64 21 view .LVU267
+	leaq	0(%r13,%r15), %rsi	#, tmp124
+	movl	%r12d, %edi	# fd,
+	subq	%r15, %rdx	# got, tmp122
+	call	pread@PLT	#
+.LVL82:
+	.loc 1 65 9 is_stmt 1 view .LVU268
+# blake2s-file.c:65:         if (r < 0 && errno == EINTR)
+	.loc 1 65 12 is_stmt 0 view .LVU269
+	testq	%rax, %rax	# r
+	jns	.L35	#,
+# blake2s-file.c:65:         if (r < 0 && errno == EINTR)
+	.loc 1 65 23 view .LVU270
+	call	__errno_location@PLT	#
+.LVL83:
+# blake2s-file.c:65:         if (r < 0 && errno == EINTR)
+	.loc 1 65 19 view .LVU271
+	cmpl	$4, (%rax)	#, *_37
+	je	.L36	#,
+.LVL84:
+.L37:
+	.loc 1 65 19 view .LVU272
+.LBE57:
+.LBE55:
+.LBE54:
+# blake2s-file.c:162:         return -1;
+	.loc 1 162 16 view .LVU273
+	movl	$-1, %eax	#, <retval>
+	jmp	.L33	#
+.LVL85:
+	.p2align 4,,10
+	.p2align 3
+.L38:
+.LBB60:
+.LBB58:
+	.loc 1 73 5 is_stmt 1 view .LVU274
+	.loc 1 73 5 is_stmt 0 view .LVU275
+.LBE58:
+.LBE60:
+	.loc 1 159 5 is_stmt 1 view .LVU276
+# blake2s-file.c:159:     if (got < (ssize_t)len) {
+	.loc 1 159 8 is_stmt 0 view .LVU277
+	cmpq	%r15, %rbx	# got, _3
+	jg	.L49	#,
+.LVL86:
+.L34:
+.LBB61:
+.LBB59:
+	.loc 1 73 5 is_stmt 1 view .LVU278
+	.loc 1 73 5 is_stmt 0 view .LVU279
+.LBE59:
+.LBE61:
+	.loc 1 159 5 is_stmt 1 view .LVU280
+	.loc 1 164 5 view .LVU281
+	movq	8(%rsp), %rdi	# %sfp,
+	movq	%rbx, %rdx	# _3,
+	movq	%r13, %rsi	# tmp127,
+	call	blake2s_update@PLT	#
+.LVL87:
+	.loc 1 165 5 view .LVU282
+# blake2s-file.c:165:     *off += len;
+	.loc 1 165 10 is_stmt 0 view .LVU283
+	addq	%rbx, (%r14)	# _3, *off_20(D)
+	.loc 1 166 5 is_stmt 1 view .LVU284
+# blake2s-file.c:166:     return 0;
+	.loc 1 166 12 is_stmt 0 view .LVU285
+	xorl	%eax, %eax	# <retval>
+.LVL88:
+.L33:
+# blake2s-file.c:167: }
+	.loc 1 167 1 view .LVU286
+	addq	$4120, %rsp	#,
+	.cfi_remember_state
+	.cfi_def_cfa_offset 56
+	popq	%rbx	#
+	.cfi_def_cfa_offset 48
+.LVL89:
+	.loc 1 167 1 view .LVU287
+	popq	%rbp	#
+	.cfi_def_cfa_offset 40
+.LVL90:
+	.loc 1 167 1 view .LVU288
+	popq	%r12	#
+	.cfi_def_cfa_offset 32
+	popq	%r13	#
+	.cfi_def_cfa_offset 24
+	popq	%r14	#
+	.cfi_def_cfa_offset 16
+.LVL91:
+	.loc 1 167 1 view .LVU289
+	popq	%r15	#
+	.cfi_def_cfa_offset 8
+	ret	
+.LVL92:
+.L49:
+	.cfi_restore_state
+	.loc 1 160 9 is_stmt 1 view .LVU290
+# blake2s-file.c:160:         if (got >= 0)
+	.loc 1 160 12 is_stmt 0 view .LVU291
+	testq	%r15, %r15	# got
+	js	.L37	#,
+	.loc 1 161 12 is_stmt 1 view .LVU292
+# blake2s-file.c:161:             errno = EIO;
+	.loc 1 161 14 is_stmt 0 view .LVU293
+	call	__errno_location@PLT	#
+.LVL93:
+# blake2s-file.c:161:             errno = EIO;
+	.loc 1 161 18 view .LVU294
+	movl	$5, (%rax)	#, *_11
+	jmp	.L37	#
+	.cfi_endproc
+.LFE39:
+	.size	bfile_align, .-bfile_align
+	.p2align 4
+	.globl	blake2s_pread
+	.type	blake2s_pread, @function
+blake2s_pread:
+.LVL94:
+.LFB35:
+	.loc 1 61 1 is_stmt 1 view -0
+	.cfi_startproc
+	.loc 1 62 5 view .LVU296
+	.loc 1 63 5 view .LVU297
+	.loc 1 63 16 view .LVU298
+	testq	%rdx, %rdx	# len
+	je	.L57	#,
+# blake2s-file.c:61: {
+	.loc 1 61 1 is_stmt 0 view .LVU299
+	pushq	%r14	#
+	.cfi_def_cfa_offset 16
+	.cfi_offset 14, -16
+	movq	%rcx, %r14	# tmp103, off
+	pushq	%r13	#
+	.cfi_def_cfa_offset 24
+	.cfi_offset 13, -24
+	movq	%rsi, %r13	# tmp101, buf
+	pushq	%r12	#
+	.cfi_def_cfa_offset 32
+	.cfi_offset 12, -32
+	movl	%edi, %r12d	# tmp100, fd
+	pushq	%rbp	#
+	.cfi_def_cfa_offset 40
+	.cfi_offset 6, -40
+	movq	%rdx, %rbp	# tmp102, len
+	pushq	%rbx	#
+	.cfi_def_cfa_offset 48
+	.cfi_offset 3, -48
+# blake2s-file.c:62:     size_t got = 0;
+	.loc 1 62 12 view .LVU300
+	xorl	%ebx, %ebx	# got
+	jmp	.L56	#
+.LVL95:
+	.p2align 4,,10
+	.p2align 3
+.L52:
+.LBB63:
+	.loc 1 69 9 is_stmt 1 view .LVU301
+# blake2s-file.c:69:         if (!r)
+	.loc 1 69 12 is_stmt 0 view .LVU302
+	je	.L63	#,
+	.loc 1 71 9 is_stmt 1 view .LVU303
+# blake2s-file.c:71:         got += r;
+	.loc 1 71 13 is_stmt 0 view .LVU304
+	addq	%rax, %rbx	# r, got
+.LVL96:
+.L53:
+	.loc 1 71 13 view .LVU305
+.LBE63:
+	.loc 1 63 16 is_stmt 1 view .LVU306
+	cmpq	%rbp, %rbx	# len, got
+	jnb	.L63	#,
+.LVL97:
+.L56:
+.LBB64:
+	.loc 1 64 9 view .LVU307
+# blake2s-file.c:64:         ssize_t r = pread(fd, (char *)buf + got, len - got, off + got);
+	.loc 1 64 21 is_stmt 0 view .LVU308
+	movq	%rbp, %rdx	# len, tmp97
+# blake2s-file.c:64:         ssize_t r = pread(fd, (char *)buf + got, len - got, off + got);
+	.loc 1 64 65 view .LVU309
+	leaq	(%r14,%rbx), %rcx	#, tmp96
+# blake2s-file.c:64:         ssize_t r = pread(fd, (char *)buf + got, len - got, off + got);
+	.loc 1 64 21 view .LVU310
+	leaq	0(%r13,%rbx), %rsi	#, tmp98
+	movl	%r12d, %edi	# fd,
+	subq	%rbx, %rdx	# got, tmp97
+	call	pread@PLT	#
+.LVL98:
+	.loc 1 65 9 is_stmt 1 view .LVU311
+# blake2s-file.c:65:         if (r < 0 && errno == EINTR)
+	.loc 1 65 12 is_stmt 0 view .LVU312
+	testq	%rax, %rax	# r
+	jns	.L52	#,
+# blake2s-file.c:65:         if (r < 0 && errno == EINTR)
+	.loc 1 65 23 discriminator 1 view .LVU313
+	call	__errno_location@PLT	#
+.LVL99:
+# blake2s-file.c:65:         if (r < 0 && errno == EINTR)
+	.loc 1 65 19 discriminator 1 view .LVU314
+	cmpl	$4, (%rax)	#, *_5
+	je	.L53	#,
+.LBE64:
+# blake2s-file.c:74: }
+	.loc 1 74 1 view .LVU315
+	popq	%rbx	#
+	.cfi_remember_state
+	.cfi_def_cfa_offset 40
+.LVL100:
+.LBB65:
+# blake2s-file.c:68:             return -1;
+	.loc 1 68 20 view .LVU316
+	movq	$-1, %rax	#, <retval>
+.LBE65:
+# blake2s-file.c:74: }
+	.loc 1 74 1 view .LVU317
+	popq	%rbp	#
+	.cfi_def_cfa_offset 32
+.LVL101:
+	.loc 1 74 1 view .LVU318
+	popq	%r12	#
+	.cfi_def_cfa_offset 24
+.LVL102:
+	.loc 1 74 1 view .LVU319
+	popq	%r13	#
+	.cfi_def_cfa_offset 16
+.LVL103:
+	.loc 1 74 1 view .LVU320
+	popq	%r14	#
+	.cfi_def_cfa_offset 8
+.LVL104:
+	.loc 1 74 1 view .LVU321
+	ret	
+.LVL105:
+	.p2align 4,,10
+	.p2align 3
+.L63:
+	.cfi_restore_state
+# blake2s-file.c:73:     return got;
+	.loc 1 73 12 view .LVU322
+	movq	%rbx, %rax	# got, <retval>
+# blake2s-file.c:74: }
+	.loc 1 74 1 view .LVU323
+	popq	%rbx	#
+	.cfi_def_cfa_offset 40
+.LVL106:
+	.loc 1 74 1 view .LVU324
+	popq	%rbp	#
+	.cfi_def_cfa_offset 32
+.LVL107:
+	.loc 1 74 1 view .LVU325
+	popq	%r12	#
+	.cfi_def_cfa_offset 24
+.LVL108:
+	.loc 1 74 1 view .LVU326
+	popq	%r13	#
+	.cfi_def_cfa_offset 16
+.LVL109:
+	.loc 1 74 1 view .LVU327
+	popq	%r14	#
+	.cfi_def_cfa_offset 8
+.LVL110:
+	.loc 1 74 1 view .LVU328
+	ret	
+.LVL111:
+.L57:
+	.cfi_restore 3
+	.cfi_restore 6
+	.cfi_restore 12
+	.cfi_restore 13
+	.cfi_restore 14
+# blake2s-file.c:63:     while (got < len) {
+	.loc 1 63 16 view .LVU329
+	xorl	%eax, %eax	# <retval>
+	.loc 1 73 5 is_stmt 1 view .LVU330
+# blake2s-file.c:74: }
+	.loc 1 74 1 is_stmt 0 view .LVU331
+	ret	
+	.cfi_endproc
+.LFE35:
+	.size	blake2s_pread, .-blake2s_pread
+	.p2align 4
+	.globl	blake2s_file_finish
+	.type	blake2s_file_finish, @function
+blake2s_file_finish:
+.LVL112:
+.LFB37:
+	.loc 1 110 1 is_stmt 1 view -0
+	.cfi_startproc
+	.loc 1 111 5 view .LVU333
+# blake2s-file.c:110: {
+	.loc 1 110 1 is_stmt 0 view .LVU334
+	pushq	%r14	#
+	.cfi_def_cfa_offset 16
+	.cfi_offset 14, -16
+	movq	%rcx, %r14	# tmp96, out
+	pushq	%r13	#
+	.cfi_def_cfa_offset 24
+	.cfi_offset 13, -24
+	movq	%rdi, %r13	# tmp93, ctx
+# blake2s-file.c:111:     unsigned char *buf = malloc(chunk);
+	.loc 1 111 26 view .LVU335
+	movq	%rdx, %rdi	# chunk,
+.LVL113:
+# blake2s-file.c:110: {
+	.loc 1 110 1 view .LVU336
+	pushq	%r12	#
+	.cfi_def_cfa_offset 32
+	.cfi_offset 12, -32
+	movq	%rdx, %r12	# tmp95, chunk
+	pushq	%rbp	#
+	.cfi_def_cfa_offset 40
+	.cfi_offset 6, -40
+	movq	%rsi, %rbp	# tmp94, stream
+	pushq	%rbx	#
+	.cfi_def_cfa_offset 48
+	.cfi_offset 3, -48
+# blake2s-file.c:111:     unsigned char *buf = malloc(chunk);
+	.loc 1 111 26 view .LVU337
+	call	malloc@PLT	#
+.LVL114:
+	.loc 1 113 5 is_stmt 1 view .LVU338
+# blake2s-file.c:113:     if (!buf) {
+	.loc 1 113 8 is_stmt 0 view .LVU339
+	testq	%rax, %rax	# tmp91
+	je	.L73	#,
+	movq	%rax, %rbx	# tmp97, tmp91
+	jmp	.L65	#
+.LVL115:
+	.p2align 4,,10
+	.p2align 3
+.L67:
+.LBB67:
+	.loc 1 123 9 is_stmt 1 view .LVU340
+	.loc 1 125 9 view .LVU341
+	movq	%rbx, %rsi	# tmp91,
+	movq	%r13, %rdi	# ctx,
+	call	blake2s_update@PLT	#
+.LVL116:
+	.loc 1 125 9 is_stmt 0 view .LVU342
+.LBE67:
+	.loc 1 117 11 is_stmt 1 view .LVU343
+.L65:
+	.loc 1 117 5 view .LVU344
+.LBB68:
+	.loc 1 118 9 view .LVU345
+# blake2s-file.c:118:         size_t read = fread(buf, 1, chunk, stream);
+	.loc 1 118 23 is_stmt 0 view .LVU346
+	movq	%r12, %rdx	# chunk,
+	movq	%rbp, %rcx	# stream,
+	movl	$1, %esi	#,
+	movq	%rbx, %rdi	# tmp91,
+	call	fread@PLT	#
+.LVL117:
+	movq	%rax, %rdx	# tmp99, read
+.LVL118:
+	.loc 1 119 9 is_stmt 1 view .LVU347
+# blake2s-file.c:119:         if (!read && ferror(stream)) {
+	.loc 1 119 12 is_stmt 0 view .LVU348
+	testq	%rax, %rax	# read
+	jne	.L67	#,
+# blake2s-file.c:119:         if (!read && ferror(stream)) {
+	.loc 1 119 22 discriminator 1 view .LVU349
+	movq	%rbp, %rdi	# stream,
+	call	ferror@PLT	#
+.LVL119:
+# blake2s-file.c:120:             free(buf);
+	.loc 1 120 13 discriminator 1 view .LVU350
+	movq	%rbx, %rdi	# tmp91,
+# blake2s-file.c:119:         if (!read && ferror(stream)) {
+	.loc 1 119 19 discriminator 1 view .LVU351
+	testl	%eax, %eax	# tmp100
+	jne	.L74	#,
+	.loc 1 123 9 is_stmt 1 view .LVU352
+.LBE68:
+	.loc 1 127 5 view .LVU353
+	call	free@PLT	#
+.LVL120:
+	.loc 1 128 5 view .LVU354
+	movq	%r14, %rsi	# out,
+	movq	%r13, %rdi	# ctx,
+	call	blake2s_final@PLT	#
+.LVL121:
+	.loc 1 129 5 view .LVU355
+# blake2s-file.c:130: }
+	.loc 1 130 1 is_stmt 0 view .LVU356
+	popq	%rbx	#
+	.cfi_remember_state
+	.cfi_def_cfa_offset 40
+.LVL122:
+# blake2s-file.c:129:     return 1;
+	.loc 1 129 12 view .LVU357
+	movl	$1, %eax	#, <retval>
+# blake2s-file.c:130: }
+	.loc 1 130 1 view .LVU358
+	popq	%rbp	#
+	.cfi_def_cfa_offset 32
+.LVL123:
+	.loc 1 130 1 view .LVU359
+	popq	%r12	#
+	.cfi_def_cfa_offset 24
+.LVL124:
+	.loc 1 130 1 view .LVU360
+	popq	%r13	#
+	.cfi_def_cfa_offset 16
+.LVL125:
+	.loc 1 130 1 view .LVU361
+	popq	%r14	#
+	.cfi_def_cfa_offset 8
+.LVL126:
+	.loc 1 130 1 view .LVU362
+	ret	
+.LVL127:
+	.p2align 4,,10
+	.p2align 3
+.L74:
+	.cfi_restore_state
+.LBB69:
+	.loc 1 120 13 is_stmt 1 view .LVU363
+	call	free@PLT	#
+.LVL128:
+	.loc 1 121 13 view .LVU364
+.L66:
+	.loc 1 121 13 is_stmt 0 view .LVU365
+.LBE69:
+# blake2s-file.c:130: }
+	.loc 1 130 1 view .LVU366
+	popq	%rbx	#
+	.cfi_remember_state
+	.cfi_def_cfa_offset 40
+# blake2s-file.c:115:         return -1;
+	.loc 1 115 16 view .LVU367
+	movl	$-1, %eax	#, <retval>
+# blake2s-file.c:130: }
+	.loc 1 130 1 view .LVU368
+	popq	%rbp	#
+	.cfi_def_cfa_offset 32
+.LVL129:
+	.loc 1 130 1 view .LVU369
+	popq	%r12	#
+	.cfi_def_cfa_offset 24
+.LVL130:
+	.loc 1 130 1 view .LVU370
+	popq	%r13	#
+	.cfi_def_cfa_offset 16
+.LVL131:
+	.loc 1 130 1 view .LVU371
+	popq	%r14	#
+	.cfi_def_cfa_offset 8
+.LVL132:
+	.loc 1 130 1 view .LVU372
+	ret	
+.LVL133:
+.L73:
+	.cfi_restore_state
+	.loc 1 114 8 is_stmt 1 view .LVU373
+# blake2s-file.c:114:         errno = ENOMEM;
+	.loc 1 114 10 is_stmt 0 view .LVU374
+	call	__errno_location@PLT	#
+.LVL134:
+# blake2s-file.c:114:         errno = ENOMEM;
+	.loc 1 114 14 view .LVU375
+	movl	$12, (%rax)	#, *_1
+	.loc 1 115 9 is_stmt 1 view .LVU376
+# blake2s-file.c:115:         return -1;
+	.loc 1 115 16 is_stmt 0 view .LVU377
+	jmp	.L66	#
+	.cfi_endproc
+.LFE37:
+	.size	blake2s_file_finish, .-blake2s_file_finish
+	.section	.rodata.str1.1,"aMS",@progbits,1
+.LC2:
+	.string	"/proc/self/fd/%d"
+	.text
+	.p2align 4
+	.globl	blake2s_file_ex
+	.type	blake2s_file_ex, @function
+blake2s_file_ex:
+.LVL135:
+.LFB40:
+	.loc 1 171 1 is_stmt 1 view -0
+	.cfi_startproc
+	.loc 1 172 5 view .LVU379
+	.loc 1 173 5 view .LVU380
+	.loc 1 174 5 view .LVU381
+	.loc 1 175 5 view .LVU382
+# blake2s-file.c:171: {
+	.loc 1 171 1 is_stmt 0 view .LVU383
+	pushq	%r15	#
+	.cfi_def_cfa_offset 16
+	.cfi_offset 15, -16
+	pushq	%r14	#
+	.cfi_def_cfa_offset 24
+	.cfi_offset 14, -24
+	movq	%rdx, %r14	# tmp249, io
+	pushq	%r13	#
+	.cfi_def_cfa_offset 32
+	.cfi_offset 13, -32
+	pushq	%r12	#
+	.cfi_def_cfa_offset 40
+	.cfi_offset 12, -40
+	pushq	%rbp	#
+	.cfi_def_cfa_offset 48
+	.cfi_offset 6, -48
+	pushq	%rbx	#
+	.cfi_def_cfa_offset 56
+	.cfi_offset 3, -56
+	subq	$408, %rsp	#,
+	.cfi_def_cfa_offset 464
+# blake2s-file.c:171: {
+	.loc 1 171 1 view .LVU384
+	movq	%rdi, 16(%rsp)	# tmp247, %sfp
+# blake2s-file.c:175:     int fd = fileno(stream);
+	.loc 1 175 14 view .LVU385
+	movq	%rsi, %rdi	# stream,
+.LVL136:
+# blake2s-file.c:171: {
+	.loc 1 171 1 view .LVU386
+	movq	%rsi, 8(%rsp)	# stream, %sfp
+# blake2s-file.c:175:     int fd = fileno(stream);
+	.loc 1 175 14 view .LVU387
+	call	fileno@PLT	#
+.LVL137:
+	.loc 1 175 14 view .LVU388
+	movl	%eax, %r13d	# tmp250, fd
+.LVL138:
+	.loc 1 176 5 is_stmt 1 view .LVU389
+	.loc 1 177 5 view .LVU390
+	.loc 1 178 5 view .LVU391
+	.loc 1 180 5 view .LVU392
+# blake2s-file.c:180:     if (!io)
+	.loc 1 180 8 is_stmt 0 view .LVU393
+	testq	%r14, %r14	# io
+	je	.L192	#,
+	.loc 1 182 5 is_stmt 1 view .LVU394
+# blake2s-file.c:182:     direct = !!(io->flags & BLAKE2S_IO_DIRECT);
+	.loc 1 182 27 is_stmt 0 view .LVU395
+	movl	4(%r14), %r15d	# io_55(D)->flags, _2
+# blake2s-file.c:183:     chunk = io->chunk;
+	.loc 1 183 11 view .LVU396
+	movq	8(%r14), %rbp	# io_55(D)->chunk, chunk
+# blake2s-file.c:187:     if (io->engine > BLAKE2S_IO_URING || chunk > BLAKE2S_IO_CHUNK_MAX
+	.loc 1 187 11 view .LVU397
+	movl	(%r14), %eax	# io_55(D)->engine, pretmp_18
+.LVL139:
+# blake2s-file.c:182:     direct = !!(io->flags & BLAKE2S_IO_DIRECT);
+	.loc 1 182 27 view .LVU398
+	andl	$1, %r15d	#, _2
+.LVL140:
+	.loc 1 183 5 is_stmt 1 view .LVU399
+	.loc 1 184 5 view .LVU400
+# blake2s-file.c:184:     if (!chunk)
+	.loc 1 184 8 is_stmt 0 view .LVU401
+	testq	%rbp, %rbp	# chunk
+	je	.L193	#,
+	.loc 1 187 5 is_stmt 1 view .LVU402
+# blake2s-file.c:187:     if (io->engine > BLAKE2S_IO_URING || chunk > BLAKE2S_IO_CHUNK_MAX
+	.loc 1 187 24 is_stmt 0 view .LVU403
+	cmpl	$2, %eax	#, pretmp_18
+	ja	.L81	#,
+	cmpq	$268435456, %rbp	#, chunk
+	ja	.L81	#,
+# blake2s-file.c:188:         || (direct && chunk % BLAKE2S_IO_ALIGN)) {
+	.loc 1 188 9 view .LVU404
+	testl	%r15d, %r15d	# _2
+	je	.L146	#,
+# blake2s-file.c:182:     direct = !!(io->flags & BLAKE2S_IO_DIRECT);
+	.loc 1 182 12 discriminator 1 view .LVU405
+	movl	$1, %ebx	#, direct
+# blake2s-file.c:188:         || (direct && chunk % BLAKE2S_IO_ALIGN)) {
+	.loc 1 188 20 discriminator 1 view .LVU406
+	testl	$4095, %ebp	#, chunk
+	jne	.L81	#,
+.LVL141:
+.L80:
+	.loc 1 193 5 is_stmt 1 view .LVU407
+	leaq	128(%rsp), %r12	#, tmp241
+	movq	%r12, %rdi	# tmp241,
+	call	blake2s_init@PLT	#
+.LVL142:
+	.loc 1 194 5 view .LVU408
+# blake2s-file.c:194:     if (fd < 0 || fstat(fd, &st) < 0 || !S_ISREG(st.st_mode)
+	.loc 1 194 8 is_stmt 0 view .LVU409
+	testl	%r13d, %r13d	# fd
+	jns	.L78	#,
+.LVL143:
+.L86:
+	.loc 1 197 9 is_stmt 1 view .LVU410
+# blake2s-file.c:197:         if (io->engine != BLAKE2S_IO_AUTO
+	.loc 1 197 12 is_stmt 0 view .LVU411
+	movl	(%r14), %r15d	# io_169->engine,
+	testl	%r15d, %r15d	#
+	je	.L77	#,
+# blake2s-file.c:198:             && blake2s_pipe_run(&ctx, stream, -1, 0, 0, chunk, 0) < 0)
+	.loc 1 198 16 view .LVU412
+	subq	$8, %rsp	#,
+	.cfi_def_cfa_offset 472
+	movq	%rbp, %r9	# chunk,
+	xorl	%r8d, %r8d	#
+	xorl	%ecx, %ecx	#
+	pushq	$0	#
+	.cfi_def_cfa_offset 480
+	movq	24(%rsp), %rsi	# %sfp,
+	movl	$-1, %edx	#,
+	movq	%r12, %rdi	# tmp241,
+	call	blake2s_pipe_run@PLT	#
+.LVL144:
+# blake2s-file.c:198:             && blake2s_pipe_run(&ctx, stream, -1, 0, 0, chunk, 0) < 0)
+	.loc 1 198 13 view .LVU413
+	popq	%r13	#
+	.cfi_def_cfa_offset 472
+.LVL145:
+	.loc 1 198 13 view .LVU414
+	popq	%r14	#
+	.cfi_def_cfa_offset 464
+	testl	%eax, %eax	# tmp255
+	js	.L82	#,
+.L77:
+	.loc 1 200 9 is_stmt 1 view .LVU415
+.LVL146:
+.LBB91:
+.LBI91:
+	.loc 1 108 5 view .LVU416
+.LBB92:
+	.loc 1 111 5 view .LVU417
+# blake2s-file.c:111:     unsigned char *buf = malloc(chunk);
+	.loc 1 111 26 is_stmt 0 view .LVU418
+	movq	%rbp, %rdi	# chunk,
+	call	malloc@PLT	#
+.LVL147:
+	movq	%rax, %r13	# tmp254, buf
+.LVL148:
+	.loc 1 113 5 is_stmt 1 view .LVU419
+# blake2s-file.c:113:     if (!buf) {
+	.loc 1 113 8 is_stmt 0 view .LVU420
+	testq	%rax, %rax	# buf
+	je	.L185	#,
+	movq	8(%rsp), %rbx	# %sfp, stream
+	jmp	.L90	#
+.LVL149:
+	.p2align 4,,10
+	.p2align 3
+.L92:
+.LBB93:
+	.loc 1 123 9 is_stmt 1 view .LVU421
+	.loc 1 125 9 view .LVU422
+	movq	%r13, %rsi	# buf,
+	movq	%r12, %rdi	# tmp241,
+	call	blake2s_update@PLT	#
+.LVL150:
+	.loc 1 125 9 is_stmt 0 view .LVU423
+.LBE93:
+	.loc 1 117 11 is_stmt 1 view .LVU424
+.L90:
+	.loc 1 117 5 view .LVU425
+.LBB94:
+	.loc 1 118 9 view .LVU426
+# blake2s-file.c:118:         size_t read = fread(buf, 1, chunk, stream);
+	.loc 1 118 23 is_stmt 0 view .LVU427
+	movq	%rbp, %rdx	# chunk,
+	movq	%rbx, %rcx	# stream,
+	movl	$1, %esi	#,
+	movq	%r13, %rdi	# buf,
+	call	fread@PLT	#
+.LVL151:
+	movq	%rax, %rdx	# tmp257, read
+.LVL152:
+	.loc 1 119 9 is_stmt 1 view .LVU428
+# blake2s-file.c:119:         if (!read && ferror(stream)) {
+	.loc 1 119 12 is_stmt 0 view .LVU429
+	testq	%rax, %rax	# read
+	jne	.L92	#,
+.LVL153:
+.L190:
+	.loc 1 119 12 view .LVU430
+.LBE94:
+.LBE92:
+.LBE91:
+.LBB95:
+.LBB96:
+.LBB97:
+# blake2s-file.c:119:         if (!read && ferror(stream)) {
+	.loc 1 119 22 view .LVU431
+	movq	8(%rsp), %rdi	# %sfp,
+	call	ferror@PLT	#
+.LVL154:
+# blake2s-file.c:120:             free(buf);
+	.loc 1 120 13 view .LVU432
+	movq	%r13, %rdi	# tmp229,
+# blake2s-file.c:119:         if (!read && ferror(stream)) {
+	.loc 1 119 19 view .LVU433
+	testl	%eax, %eax	# tmp281
+	jne	.L194	#,
+	.loc 1 123 9 is_stmt 1 view .LVU434
+.LBE97:
+	.loc 1 127 5 view .LVU435
+	call	free@PLT	#
+.LVL155:
+	.loc 1 128 5 view .LVU436
+	movq	16(%rsp), %rsi	# %sfp,
+	movq	%r12, %rdi	# tmp241,
+	call	blake2s_final@PLT	#
+.LVL156:
+	.loc 1 129 5 view .LVU437
+# blake2s-file.c:129:     return 1;
+	.loc 1 129 12 is_stmt 0 view .LVU438
+	movl	$1, %eax	#, <retval>
+.L75:
+.LBE96:
+.LBE95:
+# blake2s-file.c:232: }
+	.loc 1 232 1 view .LVU439
+	addq	$408, %rsp	#,
+	.cfi_remember_state
+	.cfi_def_cfa_offset 56
+	popq	%rbx	#
+	.cfi_def_cfa_offset 48
+	popq	%rbp	#
+	.cfi_def_cfa_offset 40
+	popq	%r12	#
+	.cfi_def_cfa_offset 32
+	popq	%r13	#
+	.cfi_def_cfa_offset 24
+	popq	%r14	#
+	.cfi_def_cfa_offset 16
+	popq	%r15	#
+	.cfi_def_cfa_offset 8
+	ret	
+.LVL157:
+	.p2align 4,,10
+	.p2align 3
+.L193:
+	.cfi_restore_state
+	.loc 1 185 9 is_stmt 1 view .LVU440
+# blake2s-file.c:185:         chunk = io->engine == BLAKE2S_IO_AUTO && !direct ? B2S_FILE_READ
+	.loc 1 185 33 is_stmt 0 view .LVU441
+	movl	%r15d, %ecx	# _2, tmp290
+	orl	%eax, %ecx	# pretmp_18, tmp290
+	je	.L145	#,
+.LVL158:
+	.loc 1 187 5 is_stmt 1 view .LVU442
+# blake2s-file.c:187:     if (io->engine > BLAKE2S_IO_URING || chunk > BLAKE2S_IO_CHUNK_MAX
+	.loc 1 187 8 is_stmt 0 view .LVU443
+	cmpl	$2, %eax	#, pretmp_18
+	ja	.L81	#,
+# blake2s-file.c:182:     direct = !!(io->flags & BLAKE2S_IO_DIRECT);
+	.loc 1 182 12 view .LVU444
+	movl	%r15d, %ebx	# _2, direct
+# blake2s-file.c:186:                                                          : B2S_IO_CHUNK;
+	.loc 1 186 58 view .LVU445
+	movl	$1048576, %ebp	#, chunk
+	jmp	.L80	#
+.LVL159:
+	.p2align 4,,10
+	.p2align 3
+.L192:
+	.loc 1 185 9 is_stmt 1 view .LVU446
+	.loc 1 193 5 view .LVU447
+	leaq	128(%rsp), %r12	#, tmp241
+# blake2s-file.c:194:     if (fd < 0 || fstat(fd, &st) < 0 || !S_ISREG(st.st_mode)
+	.loc 1 194 8 is_stmt 0 view .LVU448
+	movl	$65536, %ebp	#, chunk
+# blake2s-file.c:193:     blake2s_init(&ctx);
+	.loc 1 193 5 view .LVU449
+	movq	%r12, %rdi	# tmp241,
+	call	blake2s_init@PLT	#
+.LVL160:
+	.loc 1 194 5 is_stmt 1 view .LVU450
+# blake2s-file.c:194:     if (fd < 0 || fstat(fd, &st) < 0 || !S_ISREG(st.st_mode)
+	.loc 1 194 8 is_stmt 0 view .LVU451
+	testl	%r13d, %r13d	# fd
+	js	.L77	#,
+# blake2s-file.c:182:     direct = !!(io->flags & BLAKE2S_IO_DIRECT);
+	.loc 1 182 12 view .LVU452
+	xorl	%ebx, %ebx	# direct
+# blake2s-file.c:181:         io = &defaults;
+	.loc 1 181 12 view .LVU453
+	leaq	defaults.0(%rip), %r14	#, io
+# blake2s-file.c:182:     direct = !!(io->flags & BLAKE2S_IO_DIRECT);
+	.loc 1 182 27 view .LVU454
+	xorl	%r15d, %r15d	# _2
+.LVL161:
+.L78:
+# blake2s-file.c:194:     if (fd < 0 || fstat(fd, &st) < 0 || !S_ISREG(st.st_mode)
+	.loc 1 194 19 discriminator 1 view .LVU455
+	leaq	256(%rsp), %rsi	#, tmp197
+	movl	%r13d, %edi	# fd,
+	call	fstat@PLT	#
+.LVL162:
+# blake2s-file.c:194:     if (fd < 0 || fstat(fd, &st) < 0 || !S_ISREG(st.st_mode)
+	.loc 1 194 16 discriminator 1 view .LVU456
+	testl	%eax, %eax	# tmp252
+	js	.L86	#,
+# blake2s-file.c:194:     if (fd < 0 || fstat(fd, &st) < 0 || !S_ISREG(st.st_mode)
+	.loc 1 194 44 discriminator 2 view .LVU457
+	movl	280(%rsp), %eax	# st.st_mode, tmp198
+	andl	$61440, %eax	#, tmp198
+# blake2s-file.c:194:     if (fd < 0 || fstat(fd, &st) < 0 || !S_ISREG(st.st_mode)
+	.loc 1 194 38 discriminator 2 view .LVU458
+	cmpl	$32768, %eax	#, tmp198
+	jne	.L86	#,
+# blake2s-file.c:195:         || (off = ftello(stream)) < 0) {
+	.loc 1 195 18 view .LVU459
+	movq	8(%rsp), %rdi	# %sfp,
+	call	ftello@PLT	#
+.LVL163:
+# blake2s-file.c:195:         || (off = ftello(stream)) < 0) {
+	.loc 1 195 16 view .LVU460
+	movq	%rax, 88(%rsp)	# off, off
+# blake2s-file.c:195:         || (off = ftello(stream)) < 0) {
+	.loc 1 195 18 view .LVU461
+	movq	%rax, %r11	# tmp253, off
+# blake2s-file.c:195:         || (off = ftello(stream)) < 0) {
+	.loc 1 195 8 view .LVU462
+	testq	%rax, %rax	# off
+	js	.L86	#,
+	.loc 1 202 5 is_stmt 1 view .LVU463
+# blake2s-file.c:202:     if (off >= st.st_size)
+	.loc 1 202 18 is_stmt 0 view .LVU464
+	movq	304(%rsp), %r10	# st.st_size, _14
+# blake2s-file.c:202:     if (off >= st.st_size)
+	.loc 1 202 8 view .LVU465
+	cmpq	%r10, %rax	# _14, off
+	jge	.L195	#,
+	.loc 1 205 5 is_stmt 1 view .LVU466
+.LVL164:
+	.loc 1 206 5 view .LVU467
+# blake2s-file.c:206:     if (direct) {
+	.loc 1 206 8 is_stmt 0 view .LVU468
+	testl	%r15d, %r15d	# _2
+	jne	.L99	#,
+	.loc 1 214 5 is_stmt 1 view .LVU469
+# blake2s-file.c:214:     if (io->engine == BLAKE2S_IO_URING)
+	.loc 1 214 11 is_stmt 0 view .LVU470
+	movl	(%r14), %eax	# io_168->engine, _227
+# blake2s-file.c:214:     if (io->engine == BLAKE2S_IO_URING)
+	.loc 1 214 8 view .LVU471
+	cmpl	$2, %eax	#, _227
+	je	.L100	#,
+.LVL165:
+# blake2s-file.c:216:     if (!ret && io->engine != BLAKE2S_IO_AUTO)
+	.loc 1 216 14 view .LVU472
+	testl	%eax, %eax	# _227
+	jne	.L196	#,
+.LBB103:
+.LBB104:
+# blake2s-file.c:39:     off_t page = sysconf(_SC_PAGESIZE);
+	.loc 1 39 18 view .LVU473
+	movl	$30, %edi	#,
+	movq	%r10, 32(%rsp)	# _14, %sfp
+	movq	%r11, 24(%rsp)	# off, %sfp
+.LBE104:
+.LBE103:
+	.loc 1 221 13 is_stmt 1 view .LVU474
+.LVL166:
+.LBB113:
+.LBI103:
+	.loc 1 37 14 view .LVU475
+.LBB107:
+	.loc 1 39 5 view .LVU476
+# blake2s-file.c:39:     off_t page = sysconf(_SC_PAGESIZE);
+	.loc 1 39 18 is_stmt 0 view .LVU477
+	call	sysconf@PLT	#
+.LVL167:
+# blake2s-file.c:41:     posix_fadvise(fd, off, size - off, POSIX_FADV_SEQUENTIAL);
+	.loc 1 41 5 view .LVU478
+	movq	24(%rsp), %r11	# %sfp, off
+	movq	32(%rsp), %rdx	# %sfp, tmp237
+	movl	%r13d, %edi	# fd,
+	movl	$2, %ecx	#,
+# blake2s-file.c:39:     off_t page = sysconf(_SC_PAGESIZE);
+	.loc 1 39 18 view .LVU479
+	movq	%rax, 40(%rsp)	# tmp287, %sfp
+.LVL168:
+	.loc 1 41 5 is_stmt 1 view .LVU480
+	subq	%r11, %rdx	# off, tmp237
+	movq	%r11, %rsi	# off,
+	movq	%r11, 72(%rsp)	# off, %sfp
+	call	posix_fadvise@PLT	#
+.LVL169:
+	.loc 1 42 5 view .LVU481
+	.loc 1 42 16 view .LVU482
+	movl	%r15d, 56(%rsp)	# _2, %sfp
+	movq	32(%rsp), %r15	# %sfp, _14
+# blake2s-file.c:41:     posix_fadvise(fd, off, size - off, POSIX_FADV_SEQUENTIAL);
+	.loc 1 41 5 is_stmt 0 view .LVU483
+	movl	%r13d, 24(%rsp)	# fd, %sfp
+.LVL170:
+	.loc 1 41 5 view .LVU484
+	movq	%r12, 32(%rsp)	# tmp241, %sfp
+.LVL171:
+	.loc 1 41 5 view .LVU485
+	movq	72(%rsp), %r12	# %sfp, off
+.LVL172:
+	.loc 1 41 5 view .LVU486
+	movl	%r13d, 48(%rsp)	# fd, %sfp
+	movq	%rbp, 64(%rsp)	# chunk, %sfp
+	jmp	.L113	#
+.LVL173:
+.L111:
+.LBB105:
+	.loc 1 49 9 is_stmt 1 view .LVU487
+	movl	$2, %edx	#,
+	movq	%rbx, %rsi	# len,
+	movq	%rax, %rdi	# p,
+	call	madvise@PLT	#
+.LVL174:
+	.loc 1 51 9 view .LVU488
+	movl	$14, %edx	#,
+	movq	%rbx, %rsi	# len,
+	movq	%rbp, %rdi	# p,
+	call	madvise@PLT	#
+.LVL175:
+	.loc 1 53 9 view .LVU489
+	movq	32(%rsp), %rdi	# %sfp,
+	movq	%rbx, %rdx	# len, tmp217
+# blake2s-file.c:53:         blake2s_update(ctx, p + (off - base), len - (off - base));
+	.loc 1 53 31 is_stmt 0 view .LVU490
+	leaq	0(%rbp,%r14), %rsi	#, tmp218
+# blake2s-file.c:53:         blake2s_update(ctx, p + (off - base), len - (off - base));
+	.loc 1 53 9 view .LVU491
+	subq	%r14, %rdx	# tmp215, tmp217
+	call	blake2s_update@PLT	#
+.LVL176:
+	.loc 1 54 9 is_stmt 1 view .LVU492
+	movq	%rbx, %rsi	# len,
+	movq	%rbp, %rdi	# p,
+	call	munmap@PLT	#
+.LVL177:
+	.loc 1 55 9 view .LVU493
+# blake2s-file.c:55:         off = base + len;
+	.loc 1 55 20 is_stmt 0 view .LVU494
+	leaq	0(%r13,%rbx), %r8	#, off
+.LVL178:
+# blake2s-file.c:55:         off = base + len;
+	.loc 1 55 13 view .LVU495
+	movq	%r8, %r12	# off, off
+	.loc 1 55 13 view .LVU496
+.LBE105:
+	.loc 1 42 16 is_stmt 1 view .LVU497
+	cmpq	%r8, %r15	# off, _14
+	jle	.L197	#,
+.LVL179:
+.L113:
+.LBB106:
+	.loc 1 43 9 view .LVU498
+# blake2s-file.c:43:         off_t base = off - off % page;
+	.loc 1 43 32 is_stmt 0 view .LVU499
+	movq	%r12, %rax	# off, tmp216
+# blake2s-file.c:43:         off_t base = off - off % page;
+	.loc 1 43 15 view .LVU500
+	movq	%r12, %r13	# off, base
+# blake2s-file.c:44:         size_t len = size - base < B2S_FILE_WINDOW ? size - base
+	.loc 1 44 27 view .LVU501
+	movq	%r15, %rbx	# _14, len
+# blake2s-file.c:46:         unsigned char *p = mmap(NULL, len, PROT_READ, MAP_SHARED, fd, base);
+	.loc 1 46 28 view .LVU502
+	movl	48(%rsp), %r8d	# %sfp,
+# blake2s-file.c:43:         off_t base = off - off % page;
+	.loc 1 43 32 view .LVU503
+	cqto
+# blake2s-file.c:46:         unsigned char *p = mmap(NULL, len, PROT_READ, MAP_SHARED, fd, base);
+	.loc 1 46 28 view .LVU504
+	movl	$1, %ecx	#,
+# blake2s-file.c:43:         off_t base = off - off % page;
+	.loc 1 43 32 view .LVU505
+	idivq	40(%rsp)	# %sfp
+# blake2s-file.c:45:                                                    : B2S_FILE_WINDOW;
+	.loc 1 45 52 view .LVU506
+	movl	$67108864, %eax	#, tmp289
+# blake2s-file.c:43:         off_t base = off - off % page;
+	.loc 1 43 15 view .LVU507
+	subq	%rdx, %r13	# tmp215, base
+.LVL180:
+	.loc 1 44 9 is_stmt 1 view .LVU508
+# blake2s-file.c:43:         off_t base = off - off % page;
+	.loc 1 43 32 is_stmt 0 view .LVU509
+	movq	%rdx, %r14	# tmp215, tmp215
+# blake2s-file.c:46:         unsigned char *p = mmap(NULL, len, PROT_READ, MAP_SHARED, fd, base);
+	.loc 1 46 28 view .LVU510
+	movl	$1, %edx	#,
+# blake2s-file.c:44:         size_t len = size - base < B2S_FILE_WINDOW ? size - base
+	.loc 1 44 27 view .LVU511
+	subq	%r13, %rbx	# base, len
+# blake2s-file.c:46:         unsigned char *p = mmap(NULL, len, PROT_READ, MAP_SHARED, fd, base);
+	.loc 1 46 28 view .LVU512
+	movq	%r13, %r9	# base,
+# blake2s-file.c:45:                                                    : B2S_FILE_WINDOW;
+	.loc 1 45 52 view .LVU513
+	cmpq	%rax, %rbx	# tmp289, len
+	cmovg	%rax, %rbx	# len,, tmp289, len
+.LVL181:
+	.loc 1 46 9 is_stmt 1 view .LVU514
+# blake2s-file.c:46:         unsigned char *p = mmap(NULL, len, PROT_READ, MAP_SHARED, fd, base);
+	.loc 1 46 28 is_stmt 0 view .LVU515
+	xorl	%edi, %edi	#
+	movq	%rbx, %rsi	# len,
+	call	mmap@PLT	#
+.LVL182:
+	movq	%rax, %rbp	# tmp267, p
+.LVL183:
+	.loc 1 47 9 is_stmt 1 view .LVU516
+# blake2s-file.c:47:         if (p == MAP_FAILED)
+	.loc 1 47 12 is_stmt 0 view .LVU517
+	cmpq	$-1, %rax	#, p
+	jne	.L111	#,
+.LBE106:
+.LBE107:
+.LBE113:
+# blake2s-file.c:222:         ret = bfile_read(&ctx, src, off, st.st_size, chunk, direct);
+	.loc 1 222 15 view .LVU518
+	movq	%r12, %r11	# off, off
+	movl	56(%rsp), %r15d	# %sfp, _2
+	movq	64(%rsp), %rbp	# %sfp, chunk
+	movq	32(%rsp), %r12	# %sfp, tmp241
+	movq	%r11, %r8	# off, off
+.LVL184:
+.L112:
+.LBB114:
+.LBB108:
+	.loc 1 57 5 is_stmt 1 view .LVU519
+	.loc 1 57 5 is_stmt 0 view .LVU520
+.LBE108:
+.LBE114:
+# blake2s-file.c:222:         ret = bfile_read(&ctx, src, off, st.st_size, chunk, direct);
+	.loc 1 222 44 view .LVU521
+	movq	304(%rsp), %rsi	# st.st_size, pretmp_167
+# blake2s-file.c:221:             off = bfile_map(&ctx, fd, off, st.st_size);
+	.loc 1 221 17 view .LVU522
+	movq	%r11, 88(%rsp)	# off, off
+	.loc 1 222 9 is_stmt 1 view .LVU523
+# blake2s-file.c:222:         ret = bfile_read(&ctx, src, off, st.st_size, chunk, direct);
+	.loc 1 222 15 is_stmt 0 view .LVU524
+	movq	%rsi, 32(%rsp)	# pretmp_167, %sfp
+.LVL185:
+.LBB115:
+.LBI115:
+	.loc 1 80 12 is_stmt 1 view .LVU525
+.LBB116:
+	.loc 1 83 5 view .LVU526
+	.loc 1 85 5 view .LVU527
+# blake2s-file.c:85:     if (off >= size)
+	.loc 1 85 8 is_stmt 0 view .LVU528
+	cmpq	%rsi, %r8	# pretmp_167, off
+	jnb	.L115	#,
+# blake2s-file.c:87:     if (posix_memalign((void **)&buf, BLAKE2S_IO_ALIGN, chunk)) {
+	.loc 1 87 9 view .LVU529
+	leaq	96(%rsp), %rdi	#, tmp220
+	movq	%rbp, %rdx	# chunk,
+	movl	$4096, %esi	#,
+.LVL186:
+	.loc 1 87 9 view .LVU530
+	movq	%r8, 40(%rsp)	# off, %sfp
+	.loc 1 87 5 is_stmt 1 view .LVU531
+# blake2s-file.c:87:     if (posix_memalign((void **)&buf, BLAKE2S_IO_ALIGN, chunk)) {
+	.loc 1 87 9 is_stmt 0 view .LVU532
+	call	posix_memalign@PLT	#
+.LVL187:
+# blake2s-file.c:87:     if (posix_memalign((void **)&buf, BLAKE2S_IO_ALIGN, chunk)) {
+	.loc 1 87 8 view .LVU533
+	movq	40(%rsp), %r8	# %sfp, off
+	testl	%eax, %eax	# tmp269
+	je	.L182	#,
+.LVL188:
+.L185:
+	.loc 1 87 8 view .LVU534
+.LBE116:
+.LBE115:
+.LBB133:
+.LBB101:
+	.loc 1 114 8 is_stmt 1 view .LVU535
+# blake2s-file.c:114:         errno = ENOMEM;
+	.loc 1 114 10 is_stmt 0 view .LVU536
+	call	__errno_location@PLT	#
+.LVL189:
+# blake2s-file.c:114:         errno = ENOMEM;
+	.loc 1 114 14 view .LVU537
+	movl	$12, (%rax)	#,
+	.loc 1 115 9 is_stmt 1 view .LVU538
+# blake2s-file.c:115:         return -1;
+	.loc 1 115 16 is_stmt 0 view .LVU539
+	jmp	.L82	#
+	.p2align 4,,10
+	.p2align 3
+.L194:
+.LBB98:
+	.loc 1 120 13 is_stmt 1 view .LVU540
+	call	free@PLT	#
+.LVL190:
+	.loc 1 121 13 view .LVU541
+.L82:
+.LBE98:
+.LBE101:
+.LBE133:
+# blake2s-file.c:190:         return -1;
+	.loc 1 190 16 is_stmt 0 view .LVU542
+	movl	$-1, %eax	#, <retval>
+	jmp	.L75	#
+.LVL191:
+	.p2align 4,,10
+	.p2align 3
+.L146:
+# blake2s-file.c:182:     direct = !!(io->flags & BLAKE2S_IO_DIRECT);
+	.loc 1 182 12 view .LVU543
+	xorl	%ebx, %ebx	# direct
+	jmp	.L80	#
+.LVL192:
+.L145:
+# blake2s-file.c:182:     direct = !!(io->flags & BLAKE2S_IO_DIRECT);
+	.loc 1 182 27 view .LVU544
+	xorl	%r15d, %r15d	# _2
+.LVL193:
+# blake2s-file.c:182:     direct = !!(io->flags & BLAKE2S_IO_DIRECT);
+	.loc 1 182 12 view .LVU545
+	xorl	%ebx, %ebx	# direct
+	movl	$65536, %ebp	#, chunk
+	jmp	.L80	#
+.LVL194:
+.L81:
+	.loc 1 189 8 is_stmt 1 view .LVU546
+# blake2s-file.c:189:         errno = EINVAL;
+	.loc 1 189 10 is_stmt 0 view .LVU547
+	call	__errno_location@PLT	#
+.LVL195:
+# blake2s-file.c:189:         errno = EINVAL;
+	.loc 1 189 14 view .LVU548
+	movl	$22, (%rax)	#, *_7
+	.loc 1 190 9 is_stmt 1 view .LVU549
+# blake2s-file.c:190:         return -1;
+	.loc 1 190 16 is_stmt 0 view .LVU550
+	jmp	.L82	#
+.LVL196:
+.L99:
+	.loc 1 207 9 is_stmt 1 view .LVU551
+# blake2s-file.c:207:         if (bfile_align(&ctx, fd, &off, st.st_size) < 0)
+	.loc 1 207 13 is_stmt 0 view .LVU552
+	leaq	88(%rsp), %rdx	#, tmp207
+	movq	%r10, %rcx	# _14,
+	movl	%r13d, %esi	# fd,
+	movq	%r12, %rdi	# tmp241,
+	call	bfile_align	#
+.LVL197:
+# blake2s-file.c:207:         if (bfile_align(&ctx, fd, &off, st.st_size) < 0)
+	.loc 1 207 12 view .LVU553
+	testl	%eax, %eax	# tmp263
+	js	.L82	#,
+	.loc 1 209 9 is_stmt 1 view .LVU554
+.LVL198:
+.LBB134:
+.LBI134:
+	.loc 1 134 12 view .LVU555
+.LBB135:
+	.loc 1 137 5 view .LVU556
+	.loc 1 138 5 view .LVU557
+	leaq	96(%rsp), %rdi	#, tmp209
+	movl	%r13d, %ecx	# fd,
+	movl	$32, %esi	#,
+	xorl	%eax, %eax	#
+	leaq	.LC2(%rip), %rdx	#, tmp210
+	movq	%rdi, 24(%rsp)	# tmp209, %sfp
+	call	snprintf@PLT	#
+.LVL199:
+	.loc 1 139 5 view .LVU558
+# blake2s-file.c:139:     return open(path, O_RDONLY | O_DIRECT);
+	.loc 1 139 12 is_stmt 0 view .LVU559
+	movq	24(%rsp), %rdi	# %sfp, tmp209
+	movl	$16384, %esi	#,
+	xorl	%eax, %eax	#
+	call	open@PLT	#
+.LVL200:
+	movl	%eax, 24(%rsp)	# src, %sfp
+.LVL201:
+	.loc 1 139 12 view .LVU560
+.LBE135:
+.LBE134:
+	.loc 1 210 9 is_stmt 1 view .LVU561
+# blake2s-file.c:210:         if (src < 0)
+	.loc 1 210 12 is_stmt 0 view .LVU562
+	testl	%eax, %eax	# src
+	js	.L82	#,
+	.loc 1 214 5 is_stmt 1 view .LVU563
+# blake2s-file.c:214:     if (io->engine == BLAKE2S_IO_URING)
+	.loc 1 214 11 is_stmt 0 view .LVU564
+	movl	(%r14), %eax	# io_168->engine, _16
+.LVL202:
+# blake2s-file.c:215:         ret = blake2s_uring_run(&ctx, src, off, st.st_size, chunk, direct);
+	.loc 1 215 51 view .LVU565
+	movq	304(%rsp), %rcx	# st.st_size, _163
+# blake2s-file.c:215:         ret = blake2s_uring_run(&ctx, src, off, st.st_size, chunk, direct);
+	.loc 1 215 15 view .LVU566
+	movq	88(%rsp), %rdx	# off, off
+# blake2s-file.c:214:     if (io->engine == BLAKE2S_IO_URING)
+	.loc 1 214 8 view .LVU567
+	cmpl	$2, %eax	#, _16
+	je	.L198	#,
+.LVL203:
+# blake2s-file.c:216:     if (!ret && io->engine != BLAKE2S_IO_AUTO)
+	.loc 1 216 14 view .LVU568
+	testl	%eax, %eax	# _16
+	je	.L136	#,
+	.loc 1 217 9 is_stmt 1 view .LVU569
+# blake2s-file.c:217:         ret = blake2s_pipe_run(&ctx, NULL, src, off, st.st_size, chunk,
+	.loc 1 217 15 is_stmt 0 view .LVU570
+	subq	$8, %rsp	#,
+	.cfi_def_cfa_offset 472
+	movq	%rcx, %r8	# _163,
+	movq	%rdx, %rcx	# off,
+	xorl	%esi, %esi	#
+	pushq	%rbx	# direct
+	.cfi_def_cfa_offset 480
+	movl	40(%rsp), %edx	# %sfp,
+	movq	%rbp, %r9	# chunk,
+	movq	%r12, %rdi	# tmp241,
+	call	blake2s_pipe_run@PLT	#
+.LVL204:
+# blake2s-file.c:219:     if (!ret) {
+	.loc 1 219 8 view .LVU571
+	popq	%rcx	#
+	.cfi_def_cfa_offset 472
+	popq	%rsi	#
+	.cfi_def_cfa_offset 464
+# blake2s-file.c:217:         ret = blake2s_pipe_run(&ctx, NULL, src, off, st.st_size, chunk,
+	.loc 1 217 15 view .LVU572
+	movl	%eax, %edx	# tmp288, ret
+.LVL205:
+	.loc 1 219 5 is_stmt 1 view .LVU573
+# blake2s-file.c:219:     if (!ret) {
+	.loc 1 219 8 is_stmt 0 view .LVU574
+	testl	%eax, %eax	# ret
+	je	.L187	#,
+.L138:
+	.loc 1 219 8 view .LVU575
+	movl	%edx, 32(%rsp)	# ret, %sfp
+.LVL206:
+.LBB136:
+	.loc 1 225 9 is_stmt 1 view .LVU576
+# blake2s-file.c:225:         int err = errno;
+	.loc 1 225 20 is_stmt 0 view .LVU577
+	call	__errno_location@PLT	#
+.LVL207:
+# blake2s-file.c:226:         close(src);
+	.loc 1 226 9 view .LVU578
+	movl	24(%rsp), %edi	# %sfp,
+# blake2s-file.c:225:         int err = errno;
+	.loc 1 225 13 view .LVU579
+	movl	(%rax), %ebx	# *_33, err
+.LVL208:
+	.loc 1 226 9 is_stmt 1 view .LVU580
+# blake2s-file.c:225:         int err = errno;
+	.loc 1 225 20 is_stmt 0 view .LVU581
+	movq	%rax, %r13	# tmp276, _33
+.LVL209:
+# blake2s-file.c:226:         close(src);
+	.loc 1 226 9 view .LVU582
+	call	close@PLT	#
+.LVL210:
+	.loc 1 227 8 is_stmt 1 view .LVU583
+# blake2s-file.c:227:         errno = err;
+	.loc 1 227 14 is_stmt 0 view .LVU584
+	movl	32(%rsp), %edx	# %sfp, ret
+	movl	%ebx, 0(%r13)	# err, *_33
+.LVL211:
+.L129:
+	.loc 1 227 14 view .LVU585
+.LBE136:
+	.loc 1 229 5 is_stmt 1 view .LVU586
+# blake2s-file.c:229:     if (ret < 0 || fseeko(stream, st.st_size, SEEK_SET) < 0)
+	.loc 1 229 8 is_stmt 0 view .LVU587
+	testl	%edx, %edx	# ret
+	js	.L82	#,
+.L188:
+# blake2s-file.c:229:     if (ret < 0 || fseeko(stream, st.st_size, SEEK_SET) < 0)
+	.loc 1 229 20 view .LVU588
+	movq	304(%rsp), %rsi	# st.st_size, pretmp_167
+.L115:
+# blake2s-file.c:229:     if (ret < 0 || fseeko(stream, st.st_size, SEEK_SET) < 0)
+	.loc 1 229 20 discriminator 1 view .LVU589
+	movq	8(%rsp), %rdi	# %sfp,
+	xorl	%edx, %edx	#
+	call	fseeko@PLT	#
+.LVL212:
+# blake2s-file.c:229:     if (ret < 0 || fseeko(stream, st.st_size, SEEK_SET) < 0)
+	.loc 1 229 17 discriminator 1 view .LVU590
+	testl	%eax, %eax	# tmp277
+	js	.L82	#,
+	.loc 1 231 5 is_stmt 1 view .LVU591
+.LVL213:
+.LBB137:
+.LBI95:
+	.loc 1 108 5 view .LVU592
+.LBB102:
+	.loc 1 111 5 view .LVU593
+# blake2s-file.c:111:     unsigned char *buf = malloc(chunk);
+	.loc 1 111 26 is_stmt 0 view .LVU594
+	movq	%rbp, %rdi	# chunk,
+	call	malloc@PLT	#
+.LVL214:
+	movq	%rax, %r13	# tmp278, tmp229
+.LVL215:
+	.loc 1 113 5 is_stmt 1 view .LVU595
+# blake2s-file.c:113:     if (!buf) {
+	.loc 1 113 8 is_stmt 0 view .LVU596
+	testq	%rax, %rax	# tmp229
+	je	.L185	#,
+	movq	8(%rsp), %rbx	# %sfp, stream
+	jmp	.L130	#
+.LVL216:
+	.p2align 4,,10
+	.p2align 3
+.L131:
+.LBB99:
+	.loc 1 123 9 is_stmt 1 view .LVU597
+	.loc 1 125 9 view .LVU598
+	movq	%r13, %rsi	# tmp229,
+	movq	%r12, %rdi	# tmp241,
+	call	blake2s_update@PLT	#
+.LVL217:
+	.loc 1 125 9 is_stmt 0 view .LVU599
+.LBE99:
+	.loc 1 117 11 is_stmt 1 view .LVU600
+.L130:
+	.loc 1 117 5 view .LVU601
+.LBB100:
+	.loc 1 118 9 view .LVU602
+# blake2s-file.c:118:         size_t read = fread(buf, 1, chunk, stream);
+	.loc 1 118 23 is_stmt 0 view .LVU603
+	movq	%rbp, %rdx	# chunk,
+	movq	%rbx, %rcx	# stream,
+	movl	$1, %esi	#,
+	movq	%r13, %rdi	# tmp229,
+	call	fread@PLT	#
+.LVL218:
+	movq	%rax, %rdx	# tmp280, read
+.LVL219:
+	.loc 1 119 9 is_stmt 1 view .LVU604
+# blake2s-file.c:119:         if (!read && ferror(stream)) {
+	.loc 1 119 12 is_stmt 0 view .LVU605
+	testq	%rax, %rax	# read
+	jne	.L131	#,
+	jmp	.L190	#
+.LVL220:
+.L198:
+	.loc 1 119 12 view .LVU606
+.LBE100:
+.LBE102:
+.LBE137:
+	.loc 1 215 9 is_stmt 1 view .LVU607
+# blake2s-file.c:215:         ret = blake2s_uring_run(&ctx, src, off, st.st_size, chunk, direct);
+	.loc 1 215 15 is_stmt 0 view .LVU608
+	movl	24(%rsp), %esi	# %sfp,
+	movl	%ebx, %r9d	# direct,
+	movq	%rbp, %r8	# chunk,
+	movq	%r12, %rdi	# tmp241,
+	call	blake2s_uring_run@PLT	#
+.LVL221:
+	movl	%eax, %edx	# tmp285, ret
+.LVL222:
+	.loc 1 216 5 is_stmt 1 view .LVU609
+# blake2s-file.c:216:     if (!ret && io->engine != BLAKE2S_IO_AUTO)
+	.loc 1 216 8 is_stmt 0 view .LVU610
+	testl	%eax, %eax	# ret
+	jne	.L138	#,
+.LVL223:
+# blake2s-file.c:216:     if (!ret && io->engine != BLAKE2S_IO_AUTO)
+	.loc 1 216 14 view .LVU611
+	movl	(%r14), %eax	# io_168->engine,
+	testl	%eax, %eax	#
+	jne	.L142	#,
+.L187:
+	movq	304(%rsp), %rcx	# st.st_size, _163
+	movq	88(%rsp), %rdx	# off, off
+.L136:
+	.loc 1 222 9 is_stmt 1 view .LVU612
+# blake2s-file.c:222:         ret = bfile_read(&ctx, src, off, st.st_size, chunk, direct);
+	.loc 1 222 15 is_stmt 0 view .LVU613
+	movq	%rcx, 32(%rsp)	# _163, %sfp
+.LVL224:
+.LBB138:
+	.loc 1 80 12 is_stmt 1 view .LVU614
+.LBB126:
+	.loc 1 83 5 view .LVU615
+	.loc 1 85 5 view .LVU616
+# blake2s-file.c:85:     if (off >= size)
+	.loc 1 85 8 is_stmt 0 view .LVU617
+	cmpq	%rcx, %rdx	# _163, off
+	jb	.L199	#,
+.LVL225:
+.L118:
+	.loc 1 85 8 view .LVU618
+.LBE126:
+.LBE138:
+.LBB139:
+	.loc 1 225 9 is_stmt 1 view .LVU619
+# blake2s-file.c:225:         int err = errno;
+	.loc 1 225 20 is_stmt 0 view .LVU620
+	call	__errno_location@PLT	#
+.LVL226:
+# blake2s-file.c:226:         close(src);
+	.loc 1 226 9 view .LVU621
+	movl	24(%rsp), %edi	# %sfp,
+# blake2s-file.c:225:         int err = errno;
+	.loc 1 225 13 view .LVU622
+	movl	(%rax), %ebx	#* _65, err
+.LVL227:
+	.loc 1 226 9 is_stmt 1 view .LVU623
+# blake2s-file.c:225:         int err = errno;
+	.loc 1 225 20 is_stmt 0 view .LVU624
+	movq	%rax, %r13	# tmp275, _65
+# blake2s-file.c:226:         close(src);
+	.loc 1 226 9 view .LVU625
+	call	close@PLT	#
+.LVL228:
+	.loc 1 227 8 is_stmt 1 view .LVU626
+.LBE139:
+# blake2s-file.c:229:     if (ret < 0 || fseeko(stream, st.st_size, SEEK_SET) < 0)
+	.loc 1 229 20 is_stmt 0 view .LVU627
+	movq	304(%rsp), %rsi	# st.st_size, pretmp_167
+.LBB140:
+# blake2s-file.c:227:         errno = err;
+	.loc 1 227 14 view .LVU628
+	movl	%ebx, 0(%r13)	# err,* _65
+.LBE140:
+	.loc 1 229 5 is_stmt 1 view .LVU629
+	jmp	.L115	#
+.LVL229:
+.L195:
+	.loc 1 203 9 view .LVU630
+.LBB141:
+.LBI141:
+	.loc 1 108 5 view .LVU631
+.LBB142:
+	.loc 1 111 5 view .LVU632
+# blake2s-file.c:111:     unsigned char *buf = malloc(chunk);
+	.loc 1 111 26 is_stmt 0 view .LVU633
+	movq	%rbp, %rdi	# chunk,
+	call	malloc@PLT	#
+.LVL230:
+	movq	%rax, %r13	# tmp259, tmp204
+.LVL231:
+	.loc 1 113 5 is_stmt 1 view .LVU634
+# blake2s-file.c:113:     if (!buf) {
+	.loc 1 113 8 is_stmt 0 view .LVU635
+	testq	%rax, %rax	# tmp204
+	je	.L185	#,
+	movq	8(%rsp), %rbx	# %sfp, stream
+	jmp	.L96	#
+.LVL232:
+.L97:
+.LBB143:
+	.loc 1 123 9 is_stmt 1 view .LVU636
+	.loc 1 125 9 view .LVU637
+	movq	%r13, %rsi	# tmp204,
+	movq	%r12, %rdi	# tmp241,
+	call	blake2s_update@PLT	#
+.LVL233:
+	.loc 1 125 9 is_stmt 0 view .LVU638
+.LBE143:
+	.loc 1 117 11 is_stmt 1 view .LVU639
+.L96:
+	.loc 1 117 5 view .LVU640
+.LBB144:
+	.loc 1 118 9 view .LVU641
+# blake2s-file.c:118:         size_t read = fread(buf, 1, chunk, stream);
+	.loc 1 118 23 is_stmt 0 view .LVU642
+	movq	%rbp, %rdx	# chunk,
+	movq	%rbx, %rcx	# stream,
+	movl	$1, %esi	#,
+	movq	%r13, %rdi	# tmp204,
+	call	fread@PLT	#
+.LVL234:
+	movq	%rax, %rdx	# tmp261, read
+.LVL235:
+	.loc 1 119 9 is_stmt 1 view .LVU643
+# blake2s-file.c:119:         if (!read && ferror(stream)) {
+	.loc 1 119 12 is_stmt 0 view .LVU644
+	testq	%rax, %rax	# read
+	jne	.L97	#,
+	jmp	.L190	#
+.LVL236:
+.L196:
+	.loc 1 119 12 view .LVU645
+.LBE144:
+.LBE142:
+.LBE141:
+	.loc 1 217 9 is_stmt 1 view .LVU646
+# blake2s-file.c:217:         ret = blake2s_pipe_run(&ctx, NULL, src, off, st.st_size, chunk,
+	.loc 1 217 15 is_stmt 0 view .LVU647
+	subq	$8, %rsp	#,
+	.cfi_def_cfa_offset 472
+	movq	%r10, %r8	# _14,
+	movq	%r11, %rcx	# off,
+	movl	%r13d, %edx	# fd,
+	pushq	%rbx	# direct
+	.cfi_def_cfa_offset 480
+	xorl	%esi, %esi	#
+	movq	%r12, %rdi	# tmp241,
+	movq	%rbp, %r9	# chunk,
+	movq	%r11, 40(%rsp)	# off, %sfp
+	call	blake2s_pipe_run@PLT	#
+.LVL237:
+# blake2s-file.c:219:     if (!ret) {
+	.loc 1 219 8 view .LVU648
+	popq	%rdi	#
+	.cfi_def_cfa_offset 472
+	popq	%r8	#
+	.cfi_def_cfa_offset 464
+	testl	%eax, %eax	# ret
+	movq	24(%rsp), %r11	# %sfp, off
+# blake2s-file.c:217:         ret = blake2s_pipe_run(&ctx, NULL, src, off, st.st_size, chunk,
+	.loc 1 217 15 view .LVU649
+	movl	%eax, %edx	# tmp284, ret
+.LVL238:
+	.loc 1 219 5 is_stmt 1 view .LVU650
+# blake2s-file.c:219:     if (!ret) {
+	.loc 1 219 8 is_stmt 0 view .LVU651
+	jne	.L129	#,
+.LVL239:
+.L178:
+	.loc 1 220 9 is_stmt 1 view .LVU652
+# blake2s-file.c:222:         ret = bfile_read(&ctx, src, off, st.st_size, chunk, direct);
+	.loc 1 222 44 is_stmt 0 view .LVU653
+	movl	%r13d, 24(%rsp)	# fd, %sfp
+	movq	304(%rsp), %r10	# st.st_size, _14
+.LVL240:
+.L107:
+.LBB145:
+.LBB109:
+# blake2s-file.c:39:     off_t page = sysconf(_SC_PAGESIZE);
+	.loc 1 39 18 view .LVU654
+	movl	$30, %edi	#,
+	movq	%r10, 48(%rsp)	# _14, %sfp
+	movq	%r11, 32(%rsp)	# off, %sfp
+.LBE109:
+.LBE145:
+	.loc 1 221 13 is_stmt 1 view .LVU655
+.LVL241:
+.LBB146:
+	.loc 1 37 14 view .LVU656
+.LBB110:
+	.loc 1 39 5 view .LVU657
+# blake2s-file.c:39:     off_t page = sysconf(_SC_PAGESIZE);
+	.loc 1 39 18 is_stmt 0 view .LVU658
+	call	sysconf@PLT	#
+.LVL242:
+# blake2s-file.c:41:     posix_fadvise(fd, off, size - off, POSIX_FADV_SEQUENTIAL);
+	.loc 1 41 5 view .LVU659
+	movq	32(%rsp), %r11	# %sfp, off
+	movq	48(%rsp), %rdx	# %sfp, tmp214
+	movl	%r13d, %edi	# fd,
+	movl	$2, %ecx	#,
+# blake2s-file.c:39:     off_t page = sysconf(_SC_PAGESIZE);
+	.loc 1 39 18 view .LVU660
+	movq	%rax, 40(%rsp)	# tmp266, %sfp
+.LVL243:
+	.loc 1 41 5 is_stmt 1 view .LVU661
+	subq	%r11, %rdx	# off, tmp214
+	movq	%r11, %rsi	# off,
+	call	posix_fadvise@PLT	#
+.LVL244:
+	.loc 1 42 5 view .LVU662
+	.loc 1 42 16 view .LVU663
+.LBE110:
+.LBE146:
+# blake2s-file.c:222:         ret = bfile_read(&ctx, src, off, st.st_size, chunk, direct);
+	.loc 1 222 15 is_stmt 0 view .LVU664
+	movq	32(%rsp), %r11	# %sfp, off
+.LBB147:
+.LBB111:
+# blake2s-file.c:42:     while (off < size) {
+	.loc 1 42 16 view .LVU665
+	movq	48(%rsp), %r10	# %sfp, _14
+.LBE111:
+.LBE147:
+# blake2s-file.c:222:         ret = bfile_read(&ctx, src, off, st.st_size, chunk, direct);
+	.loc 1 222 15 view .LVU666
+	movq	%r11, %r8	# off, off
+.LBB148:
+.LBB112:
+# blake2s-file.c:42:     while (off < size) {
+	.loc 1 42 16 view .LVU667
+	cmpq	%r11, %r10	# off, _14
+	jle	.L112	#,
+	movl	%r15d, 56(%rsp)	# _2, %sfp
+	movq	%r10, %r15	# _14, _14
+	movq	%r12, 32(%rsp)	# tmp241, %sfp
+	movq	%r11, %r12	# off, off
+.LVL245:
+	.loc 1 42 16 view .LVU668
+	movl	%r13d, 48(%rsp)	# fd, %sfp
+	movq	%rbp, 64(%rsp)	# chunk, %sfp
+	jmp	.L113	#
+.LVL246:
+	.p2align 4,,10
+	.p2align 3
+.L199:
+	.loc 1 42 16 view .LVU669
+	movq	%rdx, 40(%rsp)	# off, %sfp
+.LBE112:
+.LBE148:
+.LBB149:
+.LBB127:
+	.loc 1 87 5 is_stmt 1 view .LVU670
+# blake2s-file.c:87:     if (posix_memalign((void **)&buf, BLAKE2S_IO_ALIGN, chunk)) {
+	.loc 1 87 9 is_stmt 0 view .LVU671
+	leaq	96(%rsp), %rdi	#, tmp233
+	movq	%rbp, %rdx	# chunk,
+.LVL247:
+	.loc 1 87 9 view .LVU672
+	movl	$4096, %esi	#,
+	call	posix_memalign@PLT	#
+.LVL248:
+# blake2s-file.c:87:     if (posix_memalign((void **)&buf, BLAKE2S_IO_ALIGN, chunk)) {
+	.loc 1 87 8 view .LVU673
+	movq	40(%rsp), %r8	# %sfp, off
+	testl	%eax, %eax	# tmp283
+	jne	.L200	#,
+.LVL249:
+.L182:
+	.loc 1 87 8 view .LVU674
+	movl	%r15d, 40(%rsp)	# _2, %sfp
+	movq	%r8, %r14	# off, off
+	movq	%r12, 56(%rsp)	# tmp241, %sfp
+	movq	%rbp, 48(%rsp)	# chunk, %sfp
+	movl	24(%rsp), %ebp	# %sfp, src
+.LVL250:
+.L127:
+.LBB117:
+	.loc 1 92 9 is_stmt 1 view .LVU675
+# blake2s-file.c:92:         size_t want = size - off < chunk ? size - off : chunk;
+	.loc 1 92 28 is_stmt 0 view .LVU676
+	movq	32(%rsp), %rdx	# %sfp, tmp222
+# blake2s-file.c:92:         size_t want = size - off < chunk ? size - off : chunk;
+	.loc 1 92 16 view .LVU677
+	movq	48(%rsp), %rax	# %sfp, chunk
+# blake2s-file.c:93:         ssize_t got = blake2s_pread(fd, buf, direct ? B2S_IO_ROUND(want)
+	.loc 1 93 23 view .LVU678
+	movl	40(%rsp), %r9d	# %sfp,
+	movq	96(%rsp), %r13	# MEM[(unsigned char * *)_327], pretmp_267
+# blake2s-file.c:92:         size_t want = size - off < chunk ? size - off : chunk;
+	.loc 1 92 28 view .LVU679
+	subq	%r14, %rdx	# off, tmp222
+# blake2s-file.c:92:         size_t want = size - off < chunk ? size - off : chunk;
+	.loc 1 92 16 view .LVU680
+	cmpq	%rax, %rdx	# chunk, tmp222
+	cmova	%rax, %rdx	# tmp222,, chunk, tmp222
+# blake2s-file.c:93:         ssize_t got = blake2s_pread(fd, buf, direct ? B2S_IO_ROUND(want)
+	.loc 1 93 23 view .LVU681
+	leaq	4095(%rdx), %rbx	#, tmp223
+# blake2s-file.c:92:         size_t want = size - off < chunk ? size - off : chunk;
+	.loc 1 92 16 view .LVU682
+	movq	%rdx, %r12	# tmp222, want
+.LVL251:
+	.loc 1 93 9 is_stmt 1 view .LVU683
+# blake2s-file.c:93:         ssize_t got = blake2s_pread(fd, buf, direct ? B2S_IO_ROUND(want)
+	.loc 1 93 23 is_stmt 0 view .LVU684
+	andq	$-4096, %rbx	#, tmp246
+	testl	%r9d, %r9d	#
+	cmove	%rdx, %rbx	# tmp246,, want, iftmp.13_123
+.LBB118:
+.LBB119:
+# blake2s-file.c:62:     size_t got = 0;
+	.loc 1 62 12 view .LVU685
+	xorl	%r15d, %r15d	# got
+	jmp	.L125	#
+.LVL252:
+	.p2align 4,,10
+	.p2align 3
+.L121:
+.LBB120:
+	.loc 1 69 9 is_stmt 1 view .LVU686
+# blake2s-file.c:69:         if (!r)
+	.loc 1 69 12 is_stmt 0 view .LVU687
+	je	.L124	#,
+	.loc 1 71 9 is_stmt 1 view .LVU688
+# blake2s-file.c:71:         got += r;
+	.loc 1 71 13 is_stmt 0 view .LVU689
+	addq	%rax, %r15	# r, got
+.LVL253:
+.L122:
+	.loc 1 71 13 view .LVU690
+.LBE120:
+	.loc 1 63 16 is_stmt 1 view .LVU691
+	cmpq	%rbx, %r15	# iftmp.13_123, got
+	jnb	.L124	#,
+.LVL254:
+.L125:
+.LBB121:
+	.loc 1 64 9 view .LVU692
+# blake2s-file.c:64:         ssize_t r = pread(fd, (char *)buf + got, len - got, off + got);
+	.loc 1 64 21 is_stmt 0 view .LVU693
+	movq	%rbx, %rdx	# iftmp.13_123, tmp225
+# blake2s-file.c:64:         ssize_t r = pread(fd, (char *)buf + got, len - got, off + got);
+	.loc 1 64 65 view .LVU694
+	leaq	(%r14,%r15), %rcx	#, tmp224
+# blake2s-file.c:64:         ssize_t r = pread(fd, (char *)buf + got, len - got, off + got);
+	.loc 1 64 21 view .LVU695
+	leaq	0(%r13,%r15), %rsi	#, tmp226
+	movl	%ebp, %edi	# src,
+	subq	%r15, %rdx	# got, tmp225
+	call	pread@PLT	#
+.LVL255:
+	.loc 1 65 9 is_stmt 1 view .LVU696
+# blake2s-file.c:65:         if (r < 0 && errno == EINTR)
+	.loc 1 65 12 is_stmt 0 view .LVU697
+	testq	%rax, %rax	# r
+	jns	.L121	#,
+# blake2s-file.c:65:         if (r < 0 && errno == EINTR)
+	.loc 1 65 23 view .LVU698
+	call	__errno_location@PLT	#
+.LVL256:
+# blake2s-file.c:65:         if (r < 0 && errno == EINTR)
+	.loc 1 65 19 view .LVU699
+	cmpl	$4, (%rax)	#, *_141
+	je	.L122	#,
+	movl	40(%rsp), %r15d	# %sfp, _2
+.LVL257:
+	.loc 1 65 19 view .LVU700
+	movq	96(%rsp), %r13	# MEM[(unsigned char * *)_327], MEM[(unsigned char * *)_327]
+.LVL258:
+.L123:
+	.loc 1 65 19 view .LVU701
+.LBE121:
+.LBE119:
+.LBE118:
+	.loc 1 98 13 is_stmt 1 view .LVU702
+	movq	%r13, %rdi	# MEM[(unsigned char * *)_327],
+	call	free@PLT	#
+.LVL259:
+	.loc 1 99 13 view .LVU703
+	.loc 1 99 13 is_stmt 0 view .LVU704
+.LBE117:
+.LBE127:
+.LBE149:
+	.loc 1 224 5 is_stmt 1 view .LVU705
+# blake2s-file.c:224:     if (direct) {
+	.loc 1 224 8 is_stmt 0 view .LVU706
+	testl	%r15d, %r15d	# _2
+	je	.L82	#,
+.LBB150:
+	.loc 1 225 9 is_stmt 1 view .LVU707
+# blake2s-file.c:225:         int err = errno;
+	.loc 1 225 20 is_stmt 0 view .LVU708
+	call	__errno_location@PLT	#
+.LVL260:
+# blake2s-file.c:226:         close(src);
+	.loc 1 226 9 view .LVU709
+	movl	24(%rsp), %edi	# %sfp,
+# blake2s-file.c:225:         int err = errno;
+	.loc 1 225 13 view .LVU710
+	movl	(%rax), %ebp	# *_170, err
+.LVL261:
+	.loc 1 226 9 is_stmt 1 view .LVU711
+# blake2s-file.c:225:         int err = errno;
+	.loc 1 225 20 is_stmt 0 view .LVU712
+	movq	%rax, %rbx	# tmp274, _170
+# blake2s-file.c:226:         close(src);
+	.loc 1 226 9 view .LVU713
+	call	close@PLT	#
+.LVL262:
+	.loc 1 227 8 is_stmt 1 view .LVU714
+# blake2s-file.c:227:         errno = err;
+	.loc 1 227 14 is_stmt 0 view .LVU715
+	movl	%ebp, (%rbx)	# err, *_170
+.LBE150:
+	.loc 1 229 5 is_stmt 1 view .LVU716
+	jmp	.L82	#
+.LVL263:
+	.p2align 4,,10
+	.p2align 3
+.L124:
+.LBB151:
+.LBB128:
+.LBB124:
+.LBB123:
+.LBB122:
+	.loc 1 73 5 view .LVU717
+	.loc 1 73 5 is_stmt 0 view .LVU718
+.LBE122:
+.LBE123:
+	.loc 1 95 9 is_stmt 1 view .LVU719
+# blake2s-file.c:101:         blake2s_update(ctx, buf, want);
+	.loc 1 101 9 is_stmt 0 view .LVU720
+	movq	96(%rsp), %rsi	# MEM[(unsigned char * *)_327], MEM[(unsigned char * *)_327]
+# blake2s-file.c:95:         if (got < (ssize_t)want) {
+	.loc 1 95 12 view .LVU721
+	cmpq	%r15, %r12	# got, want
+	jg	.L201	#,
+	.loc 1 101 9 is_stmt 1 view .LVU722
+	movq	56(%rsp), %rdi	# %sfp,
+	movq	%r12, %rdx	# want,
+# blake2s-file.c:102:         off += want;
+	.loc 1 102 13 is_stmt 0 view .LVU723
+	addq	%r12, %r14	# want, off
+.LVL264:
+# blake2s-file.c:101:         blake2s_update(ctx, buf, want);
+	.loc 1 101 9 view .LVU724
+	call	blake2s_update@PLT	#
+.LVL265:
+	.loc 1 102 9 is_stmt 1 view .LVU725
+	.loc 1 102 9 is_stmt 0 view .LVU726
+.LBE124:
+	.loc 1 91 16 is_stmt 1 view .LVU727
+	movq	32(%rsp), %rax	# %sfp, _163
+	cmpq	%rax, %r14	# _163, off
+	jb	.L127	#,
+	movl	40(%rsp), %r15d	# %sfp, _2
+.LVL266:
+# blake2s-file.c:104:     free(buf);
+	.loc 1 104 5 is_stmt 0 view .LVU728
+	movq	96(%rsp), %rdi	# MEM[(unsigned char * *)_327],
+	movq	48(%rsp), %rbp	# %sfp, chunk
+	movq	56(%rsp), %r12	# %sfp, tmp241
+.LVL267:
+	.loc 1 104 5 is_stmt 1 view .LVU729
+	call	free@PLT	#
+.LVL268:
+	.loc 1 105 5 view .LVU730
+	.loc 1 105 5 is_stmt 0 view .LVU731
+.LBE128:
+.LBE151:
+	.loc 1 224 5 is_stmt 1 view .LVU732
+# blake2s-file.c:224:     if (direct) {
+	.loc 1 224 8 is_stmt 0 view .LVU733
+	testl	%r15d, %r15d	# _2
+	je	.L188	#,
+	jmp	.L118	#
+.LVL269:
+.L100:
+	.loc 1 215 9 is_stmt 1 view .LVU734
+# blake2s-file.c:215:         ret = blake2s_uring_run(&ctx, src, off, st.st_size, chunk, direct);
+	.loc 1 215 15 is_stmt 0 view .LVU735
+	movq	%r11, %rdx	# off,
+	movl	%ebx, %r9d	# direct,
+	movq	%rbp, %r8	# chunk,
+	movq	%r10, %rcx	# _14,
+	movl	%r13d, %esi	# fd,
+	movq	%r12, %rdi	# tmp241,
+	movq	%r11, 24(%rsp)	# off, %sfp
+	call	blake2s_uring_run@PLT	#
+.LVL270:
+# blake2s-file.c:216:     if (!ret && io->engine != BLAKE2S_IO_AUTO)
+	.loc 1 216 8 view .LVU736
+	movq	24(%rsp), %r11	# %sfp, off
+	testl	%eax, %eax	# ret
+# blake2s-file.c:215:         ret = blake2s_uring_run(&ctx, src, off, st.st_size, chunk, direct);
+	.loc 1 215 15 view .LVU737
+	movl	%eax, %edx	# tmp286, ret
+.LVL271:
+	.loc 1 216 5 is_stmt 1 view .LVU738
+# blake2s-file.c:216:     if (!ret && io->engine != BLAKE2S_IO_AUTO)
+	.loc 1 216 8 is_stmt 0 view .LVU739
+	jne	.L129	#,
+.LVL272:
+# blake2s-file.c:216:     if (!ret && io->engine != BLAKE2S_IO_AUTO)
+	.loc 1 216 14 view .LVU740
+	cmpl	$0, (%r14)	#, io_168->engine
+	je	.L178	#,
+	movl	%r13d, 24(%rsp)	# fd, %sfp
+.LVL273:
+.L142:
+	.loc 1 217 9 is_stmt 1 view .LVU741
+# blake2s-file.c:217:         ret = blake2s_pipe_run(&ctx, NULL, src, off, st.st_size, chunk,
+	.loc 1 217 15 is_stmt 0 view .LVU742
+	movq	88(%rsp), %r11	# off, off
+	pushq	%r10	#
+	.cfi_def_cfa_offset 472
+	movq	%rbp, %r9	# chunk,
+	xorl	%esi, %esi	#
+	pushq	%rbx	# direct
+	.cfi_def_cfa_offset 480
+	movl	40(%rsp), %edx	# %sfp,
+	movq	%r12, %rdi	# tmp241,
+	movq	320(%rsp), %r8	# st.st_size,
+	movq	%r11, %rcx	# off,
+	movq	%r11, 48(%rsp)	# off, %sfp
+	call	blake2s_pipe_run@PLT	#
+.LVL274:
+# blake2s-file.c:219:     if (!ret) {
+	.loc 1 219 8 view .LVU743
+	popq	%r11	#
+	.cfi_def_cfa_offset 472
+	popq	%rbx	#
+	.cfi_def_cfa_offset 464
+# blake2s-file.c:217:         ret = blake2s_pipe_run(&ctx, NULL, src, off, st.st_size, chunk,
+	.loc 1 217 15 view .LVU744
+	movl	%eax, %edx	# tmp265, ret
+.LVL275:
+	.loc 1 219 5 is_stmt 1 view .LVU745
+# blake2s-file.c:219:     if (!ret) {
+	.loc 1 219 8 is_stmt 0 view .LVU746
+	testl	%eax, %eax	# ret
+	je	.L202	#,
+	.loc 1 224 5 is_stmt 1 view .LVU747
+# blake2s-file.c:224:     if (direct) {
+	.loc 1 224 8 is_stmt 0 view .LVU748
+	testl	%r15d, %r15d	# _2
+	je	.L129	#,
+	jmp	.L138	#
+.LVL276:
+.L197:
+	.loc 1 224 8 view .LVU749
+	movl	56(%rsp), %r15d	# %sfp, _2
+	movq	64(%rsp), %rbp	# %sfp, chunk
+.LVL277:
+	.loc 1 224 8 view .LVU750
+	movq	%r8, %r11	# off, off
+	movq	32(%rsp), %r12	# %sfp, tmp241
+	jmp	.L112	#
+.LVL278:
+.L200:
+.LBB152:
+.LBB129:
+	.loc 1 88 8 is_stmt 1 view .LVU751
+# blake2s-file.c:88:         errno = ENOMEM;
+	.loc 1 88 10 is_stmt 0 view .LVU752
+	call	__errno_location@PLT	#
+.LVL279:
+.LBE129:
+.LBE152:
+.LBB153:
+# blake2s-file.c:226:         close(src);
+	.loc 1 226 9 view .LVU753
+	movl	24(%rsp), %edi	# %sfp,
+.LBE153:
+.LBB154:
+.LBB130:
+# blake2s-file.c:88:         errno = ENOMEM;
+	.loc 1 88 14 view .LVU754
+	movl	$12, (%rax)	#, *_249
+	.loc 1 89 9 is_stmt 1 view .LVU755
+.LVL280:
+	.loc 1 89 9 is_stmt 0 view .LVU756
+.LBE130:
+.LBE154:
+	.loc 1 224 5 is_stmt 1 view .LVU757
+.LBB155:
+	.loc 1 225 9 view .LVU758
+	.loc 1 226 9 view .LVU759
+.LBE155:
+.LBB156:
+.LBB131:
+# blake2s-file.c:88:         errno = ENOMEM;
+	.loc 1 88 10 is_stmt 0 view .LVU760
+	movq	%rax, %rbx	# tmp282, _118
+.LBE131:
+.LBE156:
+.LBB157:
+# blake2s-file.c:226:         close(src);
+	.loc 1 226 9 view .LVU761
+	call	close@PLT	#
+.LVL281:
+	.loc 1 227 8 is_stmt 1 view .LVU762
+# blake2s-file.c:227:         errno = err;
+	.loc 1 227 14 is_stmt 0 view .LVU763
+	movl	$12, (%rbx)	#, *_326
+.LBE157:
+	.loc 1 229 5 is_stmt 1 view .LVU764
+	jmp	.L82	#
+.LVL282:
+.L201:
+.LBB158:
+.LBB132:
+.LBB125:
+# blake2s-file.c:96:             if (got >= 0)
+	.loc 1 96 16 is_stmt 0 view .LVU765
+	movq	%r15, %r14	# got, got
+.LVL283:
+	.loc 1 96 16 view .LVU766
+	movq	%rsi, %r13	# MEM[(unsigned char * *)_327], MEM[(unsigned char * *)_327]
+.LVL284:
+	.loc 1 96 13 is_stmt 1 view .LVU767
+# blake2s-file.c:96:             if (got >= 0)
+	.loc 1 96 16 is_stmt 0 view .LVU768
+	movl	40(%rsp), %r15d	# %sfp, _2
+	testq	%r14, %r14	# got
+	js	.L123	#,
+	.loc 1 97 16 is_stmt 1 view .LVU769
+# blake2s-file.c:97:                 errno = EIO; /* the file shrank */
+	.loc 1 97 18 is_stmt 0 view .LVU770
+	call	__errno_location@PLT	#
+.LVL285:
+# blake2s-file.c:97:                 errno = EIO; /* the file shrank */
+	.loc 1 97 22 view .LVU771
+	movl	$5, (%rax)	#, *_129
+	jmp	.L123	#
+.LVL286:
+.L202:
+	.loc 1 97 22 view .LVU772
+.LBE125:
+.LBE132:
+.LBE158:
+	.loc 1 220 9 is_stmt 1 view .LVU773
+# blake2s-file.c:222:         ret = bfile_read(&ctx, src, off, st.st_size, chunk, direct);
+	.loc 1 222 44 is_stmt 0 view .LVU774
+	movq	304(%rsp), %rcx	# st.st_size, _163
+# blake2s-file.c:220:         if (!direct)
+	.loc 1 220 12 view .LVU775
+	testl	%r15d, %r15d	# _2
+	movq	32(%rsp), %r11	# %sfp, off
+# blake2s-file.c:222:         ret = bfile_read(&ctx, src, off, st.st_size, chunk, direct);
+	.loc 1 222 44 view .LVU776
+	movq	%rcx, %r10	# _163, _14
+# blake2s-file.c:220:         if (!direct)
+	.loc 1 220 12 view .LVU777
+	je	.L107	#,
+	movq	88(%rsp), %rdx	# off, off
+	jmp	.L136	#
+	.cfi_endproc
+.LFE40:
+	.size	blake2s_file_ex, .-blake2s_file_ex
+	.p2align 4
+	.globl	blake2s_file
+	.type	blake2s_file, @function
+blake2s_file:
+.LVL287:
+.LFB41:
+	.loc 1 235 1 is_stmt 1 view -0
+	.cfi_startproc
+	.loc 1 236 5 view .LVU779
+# blake2s-file.c:236:     return blake2s_file_ex(out, stream, NULL);
+	.loc 1 236 12 is_stmt 0 view .LVU780
+	xorl	%edx, %edx	#
+	jmp	blake2s_file_ex	#
+.LVL288:
+	.loc 1 236 12 view .LVU781
+	.cfi_endproc
+.LFE41:
+	.size	blake2s_file, .-blake2s_file
+	.p2align 4
+	.globl	blake2s_file_tree
+	.type	blake2s_file_tree, @function
+blake2s_file_tree:
+.LVL289:
+.LFB46:
+	.loc 1 353 1 is_stmt 1 view -0
+	.cfi_startproc
+	.loc 1 354 5 view .LVU783
+	.loc 1 355 5 view .LVU784
+	.loc 1 356 5 view .LVU785
+	.loc 1 357 5 view .LVU786
+	.loc 1 358 5 view .LVU787
+	.loc 1 359 5 view .LVU788
+	.loc 1 361 5 view .LVU789
+# blake2s-file.c:353: {
+	.loc 1 353 1 is_stmt 0 view .LVU790
+	pushq	%r14	#
+	.cfi_def_cfa_offset 16
+	.cfi_offset 14, -16
+	pushq	%r13	#
+	.cfi_def_cfa_offset 24
+	.cfi_offset 13, -24
+	pushq	%r12	#
+	.cfi_def_cfa_offset 32
+	.cfi_offset 12, -32
+	pushq	%rbp	#
+	.cfi_def_cfa_offset 40
+	.cfi_offset 6, -40
+	movq	%rdi, %rbp	# tmp187, out
+	movq	%rsi, %rdi	# tmp188, stream
+.LVL290:
+	.loc 1 353 1 view .LVU791
+	pushq	%rbx	#
+	.cfi_def_cfa_offset 48
+	.cfi_offset 3, -48
+	movl	%edx, %ebx	# tmp189, nthreads
+	subq	$416, %rsp	#,
+	.cfi_def_cfa_offset 464
+# blake2s-file.c:361:     J.fd = fileno(stream);
+	.loc 1 361 12 view .LVU792
+	call	fileno@PLT	#
+.LVL291:
+# blake2s-file.c:361:     J.fd = fileno(stream);
+	.loc 1 361 10 view .LVU793
+	movl	%eax, 64(%rsp)	# _1, J.fd
+	.loc 1 362 5 is_stmt 1 view .LVU794
+# blake2s-file.c:362:     if (J.fd < 0 || fstat(J.fd, &st) < 0)
+	.loc 1 362 8 is_stmt 0 view .LVU795
+	testl	%eax, %eax	# _1
+	js	.L206	#,
+# blake2s-file.c:362:     if (J.fd < 0 || fstat(J.fd, &st) < 0)
+	.loc 1 362 21 discriminator 1 view .LVU796
+	leaq	272(%rsp), %rsi	#, tmp133
+	movl	%eax, %edi	# _1,
+	call	fstat@PLT	#
+.LVL292:
+# blake2s-file.c:362:     if (J.fd < 0 || fstat(J.fd, &st) < 0)
+	.loc 1 362 18 discriminator 1 view .LVU797
+	testl	%eax, %eax	# tmp191
+	js	.L206	#,
+	.loc 1 364 5 is_stmt 1 view .LVU798
+# blake2s-file.c:364:     if (!S_ISREG(st.st_mode)) {
+	.loc 1 364 12 is_stmt 0 view .LVU799
+	movl	296(%rsp), %eax	# st.st_mode, tmp134
+	andl	$61440, %eax	#, tmp134
+# blake2s-file.c:364:     if (!S_ISREG(st.st_mode)) {
+	.loc 1 364 8 view .LVU800
+	cmpl	$32768, %eax	#, tmp134
+	je	.L208	#,
+	.loc 1 365 8 is_stmt 1 view .LVU801
+# blake2s-file.c:365:         errno = ESPIPE;
+	.loc 1 365 10 is_stmt 0 view .LVU802
+	call	__errno_location@PLT	#
+.LVL293:
+# blake2s-file.c:365:         errno = ESPIPE;
+	.loc 1 365 14 view .LVU803
+	movl	$29, (%rax)	#, *_7
+	.loc 1 366 9 is_stmt 1 view .LVU804
+.LVL294:
+.L206:
+# blake2s-file.c:363:         return -1;
+	.loc 1 363 16 is_stmt 0 view .LVU805
+	movl	$-1, %eax	#, <retval>
+.L204:
+# blake2s-file.c:407: }
+	.loc 1 407 1 view .LVU806
+	addq	$416, %rsp	#,
+	.cfi_remember_state
+	.cfi_def_cfa_offset 48
+	popq	%rbx	#
+	.cfi_def_cfa_offset 40
+	popq	%rbp	#
+	.cfi_def_cfa_offset 32
+.LVL295:
+	.loc 1 407 1 view .LVU807
+	popq	%r12	#
+	.cfi_def_cfa_offset 24
+	popq	%r13	#
+	.cfi_def_cfa_offset 16
+	popq	%r14	#
+	.cfi_def_cfa_offset 8
+	ret	
+.LVL296:
+	.p2align 4,,10
+	.p2align 3
+.L208:
+	.cfi_restore_state
+	.loc 1 368 5 is_stmt 1 view .LVU808
+# blake2s-file.c:368:     J.size = st.st_size;
+	.loc 1 368 16 is_stmt 0 view .LVU809
+	movq	320(%rsp), %rcx	# st.st_size, _8
+	.loc 1 369 5 is_stmt 1 view .LVU810
+# blake2s-file.c:369:     J.nseg = J.size ? (J.size - 1) / B2S_FILE_SEGMENT + 1 : 1;
+	.loc 1 369 68 is_stmt 0 view .LVU811
+	testq	%rcx, %rcx	# _8
+	jne	.L231	#,
+	movl	$1, %esi	#, iftmp.19_52
+	movl	$32, %r12d	#, prephitmp_128
+	movl	$32, %edi	#, prephitmp_116
+.LBB159:
+.LBB160:
+# blake2s-file.c:268:     unsigned depth = BLAKE2S_FILE_DEPTH;
+	.loc 1 268 14 view .LVU812
+	movl	$3, %edx	#, depth
+.L210:
+.LBE160:
+.LBE159:
+# blake2s-file.c:368:     J.size = st.st_size;
+	.loc 1 368 12 view .LVU813
+	movq	%rcx, 72(%rsp)	# _8, J.size
+# blake2s-file.c:369:     J.nseg = J.size ? (J.size - 1) / B2S_FILE_SEGMENT + 1 : 1;
+	.loc 1 369 12 view .LVU814
+	movq	%rsi, 80(%rsp)	# iftmp.19_52, J.nseg
+.LBB166:
+.LBB161:
+	.loc 1 275 5 is_stmt 1 view .LVU815
+.LBE161:
+.LBE166:
+# blake2s-file.c:370:     J.depth = bfile_depth(J.nseg);
+	.loc 1 370 13 is_stmt 0 view .LVU816
+	movl	%edx, 88(%rsp)	# depth, J.depth
+	.loc 1 371 5 is_stmt 1 view .LVU817
+# blake2s-file.c:371:     J.err = 0;
+	.loc 1 371 11 is_stmt 0 view .LVU818
+	movl	$0, 92(%rsp)	#, J.err
+	.loc 1 372 5 is_stmt 1 view .LVU819
+# blake2s-file.c:372:     J.digest = malloc(J.nseg * sizeof(*J.digest));
+	.loc 1 372 16 is_stmt 0 view .LVU820
+	call	malloc@PLT	#
+.LVL297:
+# blake2s-file.c:373:     up = malloc(((J.nseg - 1) / BLAKE2S_FILE_FANOUT + 1) * sizeof(*up));
+	.loc 1 373 10 view .LVU821
+	movq	%r12, %rdi	# prephitmp_128,
+# blake2s-file.c:372:     J.digest = malloc(J.nseg * sizeof(*J.digest));
+	.loc 1 372 14 view .LVU822
+	movq	%rax, 136(%rsp)	# tmp143, J.digest
+	.loc 1 373 5 is_stmt 1 view .LVU823
+# blake2s-file.c:372:     J.digest = malloc(J.nseg * sizeof(*J.digest));
+	.loc 1 372 16 is_stmt 0 view .LVU824
+	movq	%rax, %r13	# tmp193, tmp143
+# blake2s-file.c:373:     up = malloc(((J.nseg - 1) / BLAKE2S_FILE_FANOUT + 1) * sizeof(*up));
+	.loc 1 373 10 view .LVU825
+	call	malloc@PLT	#
+.LVL298:
+	movq	%rax, %r12	# tmp194, up
+.LVL299:
+	.loc 1 374 5 is_stmt 1 view .LVU826
+# blake2s-file.c:374:     if (!J.digest || !up) {
+	.loc 1 374 19 is_stmt 0 view .LVU827
+	testq	%rax, %rax	# up
+	je	.L224	#,
+	testq	%r13, %r13	# tmp143
+	je	.L224	#,
+	.loc 1 380 5 is_stmt 1 view .LVU828
+	leaq	96(%rsp), %r13	#, tmp150
+	xorl	%esi, %esi	#
+	leaq	64(%rsp), %r14	#, tmp149
+	movq	%r13, %rdi	# tmp150,
+	call	pthread_mutex_init@PLT	#
+.LVL300:
+	.loc 1 381 5 view .LVU829
+	movq	80(%rsp), %rsi	# J.nseg,
+	movq	%r14, %rcx	# tmp149,
+	movl	%ebx, %edi	# nthreads,
+	leaq	bfile_task(%rip), %rdx	#, tmp153
+	call	blake2s_pool_run@PLT	#
+.LVL301:
+	.loc 1 382 5 view .LVU830
+	movq	%r13, %rdi	# tmp150,
+	call	pthread_mutex_destroy@PLT	#
+.LVL302:
+	.loc 1 384 5 view .LVU831
+# blake2s-file.c:384:     if (!J.err) {
+	.loc 1 384 8 is_stmt 0 view .LVU832
+	movl	92(%rsp), %eax	# J.err,
+	testl	%eax, %eax	#
+	je	.L232	#,
+.LVL303:
+.L214:
+	.loc 1 400 5 is_stmt 1 view .LVU833
+	movq	136(%rsp), %rdi	# J.digest,
+	call	free@PLT	#
+.LVL304:
+	.loc 1 401 5 view .LVU834
+	movq	%r12, %rdi	# up,
+	call	free@PLT	#
+.LVL305:
+	.loc 1 402 5 view .LVU835
+# blake2s-file.c:402:     if (J.err) {
+	.loc 1 402 10 is_stmt 0 view .LVU836
+	movl	92(%rsp), %ebx	# J.err, _34
+# blake2s-file.c:406:     return 1;
+	.loc 1 406 12 view .LVU837
+	movl	$1, %eax	#, <retval>
+# blake2s-file.c:402:     if (J.err) {
+	.loc 1 402 8 view .LVU838
+	testl	%ebx, %ebx	# _34
+	je	.L204	#,
+	.loc 1 403 8 is_stmt 1 view .LVU839
+# blake2s-file.c:403:         errno = J.err;
+	.loc 1 403 10 is_stmt 0 view .LVU840
+	call	__errno_location@PLT	#
+.LVL306:
+# blake2s-file.c:403:         errno = J.err;
+	.loc 1 403 14 view .LVU841
+	movl	%ebx, (%rax)	# _34, *_35
+	.loc 1 404 9 is_stmt 1 view .LVU842
+# blake2s-file.c:404:         return -1;
+	.loc 1 404 16 is_stmt 0 view .LVU843
+	jmp	.L206	#
+.LVL307:
+	.p2align 4,,10
+	.p2align 3
+.L231:
+# blake2s-file.c:369:     J.nseg = J.size ? (J.size - 1) / B2S_FILE_SEGMENT + 1 : 1;
+	.loc 1 369 36 discriminator 1 view .LVU844
+	movq	%rcx, %rax	# _8, tmp136
+	leaq	8388606(%rcx), %r12	#, tmp138
+	subq	$1, %rax	#, tmp136
+	cmovns	%rax, %r12	# tmp138,, tmp136, tmp137
+	sarq	$23, %r12	#, tmp139
+# blake2s-file.c:369:     J.nseg = J.size ? (J.size - 1) / B2S_FILE_SEGMENT + 1 : 1;
+	.loc 1 369 64 discriminator 1 view .LVU845
+	leaq	1(%r12), %rsi	#, iftmp.19_52
+	.loc 1 370 5 is_stmt 1 discriminator 1 view .LVU846
+.LVL308:
+.LBB167:
+.LBI159:
+	.loc 1 266 17 discriminator 1 view .LVU847
+.LBB162:
+	.loc 1 268 5 discriminator 1 view .LVU848
+	.loc 1 269 5 discriminator 1 view .LVU849
+	.loc 1 271 5 discriminator 1 view .LVU850
+	.loc 1 271 16 discriminator 1 view .LVU851
+.LBE162:
+.LBE167:
+# blake2s-file.c:373:     up = malloc(((J.nseg - 1) / BLAKE2S_FILE_FANOUT + 1) * sizeof(*up));
+	.loc 1 373 31 is_stmt 0 discriminator 1 view .LVU852
+	shrq	$7, %r12	#, tmp140
+# blake2s-file.c:372:     J.digest = malloc(J.nseg * sizeof(*J.digest));
+	.loc 1 372 16 discriminator 1 view .LVU853
+	movq	%rsi, %rdi	# iftmp.19_52, prephitmp_116
+# blake2s-file.c:373:     up = malloc(((J.nseg - 1) / BLAKE2S_FILE_FANOUT + 1) * sizeof(*up));
+	.loc 1 373 37 discriminator 1 view .LVU854
+	addq	$1, %r12	#, tmp141
+# blake2s-file.c:372:     J.digest = malloc(J.nseg * sizeof(*J.digest));
+	.loc 1 372 16 discriminator 1 view .LVU855
+	salq	$5, %rdi	#, prephitmp_116
+# blake2s-file.c:373:     up = malloc(((J.nseg - 1) / BLAKE2S_FILE_FANOUT + 1) * sizeof(*up));
+	.loc 1 373 10 discriminator 1 view .LVU856
+	salq	$5, %r12	#, prephitmp_128
+.LBB168:
+.LBB163:
+# blake2s-file.c:271:     while (top > BLAKE2S_FILE_FANOUT) {
+	.loc 1 271 16 discriminator 1 view .LVU857
+	cmpq	$128, %rsi	#, iftmp.19_52
+	jbe	.L221	#,
+.LBE163:
+.LBE168:
+# blake2s-file.c:369:     J.nseg = J.size ? (J.size - 1) / B2S_FILE_SEGMENT + 1 : 1;
+	.loc 1 369 68 view .LVU858
+	movq	%rsi, %rax	# iftmp.19_52, top
+.LBB169:
+.LBB164:
+# blake2s-file.c:268:     unsigned depth = BLAKE2S_FILE_DEPTH;
+	.loc 1 268 14 view .LVU859
+	movl	$3, %edx	#, depth
+.LVL309:
+	.p2align 4,,10
+	.p2align 3
+.L211:
+	.loc 1 272 9 is_stmt 1 view .LVU860
+# blake2s-file.c:272:         top = (top - 1) / BLAKE2S_FILE_FANOUT + 1;
+	.loc 1 272 20 is_stmt 0 view .LVU861
+	subq	$1, %rax	#, tmp142
+.LVL310:
+# blake2s-file.c:273:         depth++;
+	.loc 1 273 14 view .LVU862
+	addl	$1, %edx	#, depth
+.LVL311:
+# blake2s-file.c:272:         top = (top - 1) / BLAKE2S_FILE_FANOUT + 1;
+	.loc 1 272 25 view .LVU863
+	shrq	$7, %rax	#, _90
+.LVL312:
+# blake2s-file.c:272:         top = (top - 1) / BLAKE2S_FILE_FANOUT + 1;
+	.loc 1 272 13 view .LVU864
+	addq	$1, %rax	#, top
+.LVL313:
+	.loc 1 273 9 is_stmt 1 view .LVU865
+	.loc 1 271 16 view .LVU866
+	cmpq	$128, %rax	#, top
+	ja	.L211	#,
+	jmp	.L210	#
+.LVL314:
+	.p2align 4,,10
+	.p2align 3
+.L232:
+	.loc 1 271 16 is_stmt 0 view .LVU867
+.LBE164:
+.LBE169:
+	.loc 1 385 9 is_stmt 1 view .LVU868
+	movl	88(%rsp), %eax	# J.depth, _22
+.LVL315:
+.LBB170:
+.LBI170:
+	.loc 1 278 13 view .LVU869
+.LBB171:
+	.loc 1 280 5 view .LVU870
+	pxor	%xmm0, %xmm0	# tmp159
+.LBE171:
+.LBE170:
+# blake2s-file.c:388:         n = J.nseg;
+	.loc 1 388 11 is_stmt 0 view .LVU871
+	movq	80(%rsp), %rbx	# J.nseg, n
+.LVL316:
+	.loc 1 388 11 view .LVU872
+	movq	%rsp, %r13	#, tmp179
+.LVL317:
+# blake2s-file.c:389:         for (P.node_depth = 2; P.node_depth < J.depth - 1; P.node_depth++) {
+	.loc 1 389 27 view .LVU873
+	movq	.LC3(%rip), %rdx	#, tmp160
+.LBB174:
+.LBB172:
+# blake2s-file.c:280:     memset(P, 0, sizeof(*P));
+	.loc 1 280 5 view .LVU874
+	movups	%xmm0, 4(%rsp)	# tmp159, MEM <char[1:60]> [(void *)&P + 4B]
+# blake2s-file.c:283:     P->depth = depth;
+	.loc 1 283 14 view .LVU875
+	movl	%eax, 12(%rsp)	# _22, P.depth
+.LBE172:
+.LBE174:
+# blake2s-file.c:389:         for (P.node_depth = 2; P.node_depth < J.depth - 1; P.node_depth++) {
+	.loc 1 389 55 view .LVU876
+	subl	$1, %eax	#, tmp161
+.LVL318:
+.LBB175:
+.LBB173:
+# blake2s-file.c:280:     memset(P, 0, sizeof(*P));
+	.loc 1 280 5 view .LVU877
+	movups	%xmm0, 36(%rsp)	# tmp159, MEM <char[1:60]> [(void *)&P + 4B]
+	movups	%xmm0, 20(%rsp)	# tmp159, MEM <char[1:60]> [(void *)&P + 4B]
+	movups	%xmm0, 48(%rsp)	# tmp159, MEM <char[1:60]> [(void *)&P + 4B]
+	.loc 1 281 5 is_stmt 1 view .LVU878
+# blake2s-file.c:281:     P->digest_len = BLAKE2S_LEN;
+	.loc 1 281 19 is_stmt 0 view .LVU879
+	movl	$32, (%rsp)	#, P.digest_len
+	.loc 1 282 5 is_stmt 1 view .LVU880
+# blake2s-file.c:282:     P->fanout = BLAKE2S_FILE_FANOUT;
+	.loc 1 282 15 is_stmt 0 view .LVU881
+	movl	$128, 8(%rsp)	#, P.fanout
+	.loc 1 283 5 is_stmt 1 view .LVU882
+	.loc 1 284 5 view .LVU883
+# blake2s-file.c:284:     P->leaf_len = BLAKE2S_FILE_LEAF;
+	.loc 1 284 17 is_stmt 0 view .LVU884
+	movl	$65536, 16(%rsp)	#, P.leaf_len
+	.loc 1 285 5 is_stmt 1 view .LVU885
+.LVL319:
+	.loc 1 285 5 is_stmt 0 view .LVU886
+.LBE173:
+.LBE175:
+	.loc 1 386 9 is_stmt 1 view .LVU887
+# blake2s-file.c:386:         P.last_node = 1;
+	.loc 1 386 21 is_stmt 0 view .LVU888
+	movl	$1, 56(%rsp)	#, P.last_node
+	.loc 1 388 9 is_stmt 1 view .LVU889
+.LVL320:
+	.loc 1 389 9 view .LVU890
+# blake2s-file.c:389:         for (P.node_depth = 2; P.node_depth < J.depth - 1; P.node_depth++) {
+	.loc 1 389 27 is_stmt 0 view .LVU891
+	movq	%rdx, 32(%rsp)	# tmp160, MEM <vector(2) unsigned int> [(unsigned int *)&P + 32B]
+	.loc 1 389 45 is_stmt 1 view .LVU892
+	cmpl	$2, %eax	#, tmp161
+	jbe	.L215	#,
+# blake2s-file.c:389:         for (P.node_depth = 2; P.node_depth < J.depth - 1; P.node_depth++) {
+	.loc 1 389 33 is_stmt 0 view .LVU893
+	movl	$2, %eax	#, _3
+	movq	%rsp, %r13	#, tmp179
+	.p2align 4,,10
+	.p2align 3
+.L218:
+.LBB176:
+	.loc 1 390 13 is_stmt 1 view .LVU894
+.LVL321:
+	.loc 1 391 13 view .LVU895
+# blake2s-file.c:391:             n = blake2s_tree_nodes(odd ? J.digest[0] : up[0],
+	.loc 1 391 17 is_stmt 0 view .LVU896
+	salq	$5, %rbx	#, n
+.LVL322:
+	.loc 1 391 17 view .LVU897
+	xorl	%r8d, %r8d	#
+	movq	%r13, %rcx	# tmp179,
+	movq	%r12, %rsi	# up,
+	movq	136(%rsp), %rdi	# J.digest, pretmp_129
+	movq	%rbx, %rdx	# n, _24
+	testb	$1, %al	#, _3
+	jne	.L230	#,
+.LVL323:
+# blake2s-file.c:391:             n = blake2s_tree_nodes(odd ? J.digest[0] : up[0],
+	.loc 1 391 17 discriminator 1 view .LVU898
+	movq	%rdi, %rsi	# pretmp_129,
+.LVL324:
+	.loc 1 391 17 discriminator 1 view .LVU899
+	movq	%r12, %rdi	# up,
+.LVL325:
+.L230:
+# blake2s-file.c:391:             n = blake2s_tree_nodes(odd ? J.digest[0] : up[0],
+	.loc 1 391 17 discriminator 8 view .LVU900
+	call	blake2s_tree_nodes@PLT	#
+.LVL326:
+	.loc 1 391 17 discriminator 8 view .LVU901
+.LBE176:
+# blake2s-file.c:389:         for (P.node_depth = 2; P.node_depth < J.depth - 1; P.node_depth++) {
+	.loc 1 389 55 discriminator 8 view .LVU902
+	movl	88(%rsp), %ecx	# J.depth, tmp211
+.LBB177:
+# blake2s-file.c:391:             n = blake2s_tree_nodes(odd ? J.digest[0] : up[0],
+	.loc 1 391 17 discriminator 8 view .LVU903
+	movq	%rax, %rbx	# tmp197, n
+	.loc 1 391 17 discriminator 8 view .LVU904
+.LBE177:
+	.loc 1 389 72 is_stmt 1 discriminator 8 view .LVU905
+	movl	32(%rsp), %eax	# P.node_depth, tmp210
+.LVL327:
+# blake2s-file.c:389:         for (P.node_depth = 2; P.node_depth < J.depth - 1; P.node_depth++) {
+	.loc 1 389 55 is_stmt 0 discriminator 8 view .LVU906
+	leal	-1(%rcx), %edx	#, tmp169
+# blake2s-file.c:389:         for (P.node_depth = 2; P.node_depth < J.depth - 1; P.node_depth++) {
+	.loc 1 389 72 discriminator 8 view .LVU907
+	addl	$1, %eax	#, _3
+	movl	%eax, 32(%rsp)	# _3, P.node_depth
+	.loc 1 389 45 is_stmt 1 discriminator 8 view .LVU908
+	cmpl	%edx, %eax	# tmp169, _3
+	jb	.L218	#,
+.L215:
+	.loc 1 395 9 view .LVU909
+	leaq	144(%rsp), %r14	#, tmp180
+	xorl	%edx, %edx	#
+	movq	%r13, %rsi	# tmp179,
+# blake2s-file.c:396:         blake2s_update(&root, (P.node_depth & 1) ? up : J.digest,
+	.loc 1 396 9 is_stmt 0 view .LVU910
+	salq	$5, %rbx	#, n
+.LVL328:
+# blake2s-file.c:395:         blake2s_init_param(&root, &P, NULL);
+	.loc 1 395 9 view .LVU911
+	movq	%r14, %rdi	# tmp180,
+	call	blake2s_init_param@PLT	#
+.LVL329:
+	.loc 1 396 9 is_stmt 1 view .LVU912
+	movq	%rbx, %rdx	# n, _30
+	movq	%r12, %rsi	# up, iftmp.22_40
+	testb	$1, 32(%rsp)	#, P.node_depth
+	jne	.L219	#,
+.LVL330:
+# blake2s-file.c:396:         blake2s_update(&root, (P.node_depth & 1) ? up : J.digest,
+	.loc 1 396 9 is_stmt 0 discriminator 1 view .LVU913
+	movq	136(%rsp), %rsi	# J.digest, iftmp.22_40
+.LVL331:
+.L219:
+# blake2s-file.c:396:         blake2s_update(&root, (P.node_depth & 1) ? up : J.digest,
+	.loc 1 396 9 discriminator 4 view .LVU914
+	movq	%r14, %rdi	# tmp180,
+	call	blake2s_update@PLT	#
+.LVL332:
+	.loc 1 398 9 is_stmt 1 discriminator 4 view .LVU915
+	movq	%rbp, %rsi	# out,
+	movq	%r14, %rdi	# tmp180,
+	call	blake2s_final@PLT	#
+.LVL333:
+	jmp	.L214	#
+.LVL334:
+.L221:
+.LBB178:
+.LBB165:
+# blake2s-file.c:268:     unsigned depth = BLAKE2S_FILE_DEPTH;
+	.loc 1 268 14 is_stmt 0 view .LVU916
+	movl	$3, %edx	#, depth
+	jmp	.L210	#
+.LVL335:
+.L224:
+	.loc 1 268 14 view .LVU917
+.LBE165:
+.LBE178:
+	.loc 1 375 9 is_stmt 1 view .LVU918
+	movq	%r13, %rdi	# tmp143,
+	call	free@PLT	#
+.LVL336:
+	.loc 1 376 9 view .LVU919
+	movq	%r12, %rdi	# up,
+	call	free@PLT	#
+.LVL337:
+	.loc 1 377 8 view .LVU920
+# blake2s-file.c:377:         errno = ENOMEM;
+	.loc 1 377 10 is_stmt 0 view .LVU921
+	call	__errno_location@PLT	#
+.LVL338:
+# blake2s-file.c:377:         errno = ENOMEM;
+	.loc 1 377 14 view .LVU922
+	movl	$12, (%rax)	#, *_19
+	.loc 1 378 9 is_stmt 1 view .LVU923
+# blake2s-file.c:378:         return -1;
+	.loc 1 378 16 is_stmt 0 view .LVU924
+	jmp	.L206	#
+	.cfi_endproc
+.LFE46:
+	.size	blake2s_file_tree, .-blake2s_file_tree
+	.section	.rodata
+	.align 16
+	.type	defaults.0, @object
+	.size	defaults.0, 16
+defaults.0:
+	.zero	16
+	.section	.rodata.cst8,"aM",@progbits,8
+	.align 8
+.LC0:
+	.long	1
+	.long	32
+	.align 8
+.LC3:
+	.long	2
+	.long	32
+	.text
+.Letext0:
+	.file 2 "/usr/include/x86_64-linux-gnu/bits/types.h"
+	.file 3 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stddef.h"
+	.file 4 "/usr/include/fcntl.h"
+	.file 5 "/usr/include/x86_64-linux-gnu/bits/types/struct_timespec.h"
+	.file 6 "/usr/include/x86_64-linux-gnu/bits/struct_stat.h"
+	.file 7 "/usr/include/x86_64-linux-gnu/bits/thread-shared-types.h"
+	.file 8 "/usr/include/x86_64-linux-gnu/bits/struct_mutex.h"
+	.file 9 "/usr/include/x86_64-linux-gnu/bits/pthreadtypes.h"
+	.file 10 "/usr/include/x86_64-linux-gnu/sys/types.h"
+	.file 11 "/usr/include/x86_64-linux-gnu/bits/stdint-uintn.h"
+	.file 12 "/usr/include/x86_64-linux-gnu/bits/types/struct_FILE.h"
+	.file 13 "/usr/include/x86_64-linux-gnu/bits/types/FILE.h"
+	.file 14 "blake2s.h"
+	.file 15 "blake2s-internal.h"
+	.file 16 "/usr/include/string.h"
+	.file 17 "/usr/include/pthread.h"
+	.file 18 "/usr/include/stdlib.h"
+	.file 19 "/usr/include/x86_64-linux-gnu/sys/mman.h"
+	.file 20 "/usr/include/unistd.h"
+	.file 21 "/usr/include/stdio.h"
+	.file 22 "/usr/include/x86_64-linux-gnu/sys/stat.h"
+	.file 23 "/usr/include/x86_64-linux-gnu/bits/confname.h"
+	.file 24 "/usr/include/errno.h"
+	.section	.debug_info,"",@progbits
+.Ldebug_info0:
+	.long	0x2aaa
+	.value	0x5
+	.byte	0x1
+	.byte	0x8
+	.long	.Ldebug_abbrev0
+	.uleb128 0x39
+	.long	.LASF400
+	.byte	0xc
+	.long	.LASF0
+	.long	.LASF1
+	.quad	.Ltext0
+	.quad	.Letext0-.Ltext0
+	.long	.Ldebug_line0
+	.uleb128 0x9
+	.long	0x33
+	.uleb128 0x10
+	.byte	0x1
+	.byte	0x6
+	.long	.LASF2
+	.uleb128 0x13
+	.long	0x33
+	.uleb128 0x3a
+	.byte	0x4
+	.byte	0x5
+	.string	"int"
+	.uleb128 0x10
+	.byte	0x1
+	.byte	0x8
+	.long	.LASF3
+	.uleb128 0x10
+	.byte	0x2
+	.byte	0x7
+	.long	.LASF4
+	.uleb128 0x10
+	.byte	0x4
+	.byte	0x7
+	.long	.LASF5
+	.uleb128 0x10
+	.byte	0x8
+	.byte	0x7
+	.long	.LASF6
+	.uleb128 0x10
+	.byte	0x1
+	.byte	0x6
+	.long	.LASF7
+	.uleb128 0x7
+	.long	.LASF9
+	.byte	0x2
+	.byte	0x26
+	.byte	0x17
+	.long	0x46
+	.uleb128 0x10
+	.byte	0x2
+	.byte	0x5
+	.long	.LASF8
+	.uleb128 0x7
+	.long	.LASF10
+	.byte	0x2
+	.byte	0x2a
+	.byte	0x16
+	.long	0x54
+	.uleb128 0x10
+	.byte	0x8
+	.byte	0x5
+	.long	.LASF11
+	.uleb128 0x7
+	.long	.LASF12
+	.byte	0x2
+	.byte	0x2d
+	.byte	0x1b
+	.long	0x5b
+	.uleb128 0x7
+	.long	.LASF13
+	.byte	0x2
+	.byte	0x91
+	.byte	0x1b
+	.long	0x5b
+	.uleb128 0x7
+	.long	.LASF14
+	.byte	0x2
+	.byte	0x92
+	.byte	0x16
+	.long	0x54
+	.uleb128 0x7
+	.long	.LASF15
+	.byte	0x2
+	.byte	0x93
+	.byte	0x16
+	.long	0x54
+	.uleb128 0x7
+	.long	.LASF16
+	.byte	0x2
+	.byte	0x94
+	.byte	0x1b
+	.long	0x5b
+	.uleb128 0x7
+	.long	.LASF17
+	.byte	0x2
+	.byte	0x96
+	.byte	0x16
+	.long	0x54
+	.uleb128 0x7
+	.long	.LASF18
+	.byte	0x2
+	.byte	0x97
+	.byte	0x1b
+	.long	0x5b
+	.uleb128 0x7
+	.long	.LASF19
+	.byte	0x2
+	.byte	0x98
+	.byte	0x12
+	.long	0x88
+	.uleb128 0x7
+	.long	.LASF20
+	.byte	0x2
+	.byte	0x99
+	.byte	0x12
+	.long	0x88
+	.uleb128 0x7
+	.long	.LASF21
+	.byte	0x2
+	.byte	0xa0
+	.byte	0x12
+	.long	0x88
+	.uleb128 0x3b
+	.byte	0x8
+	.uleb128 0x2e
+	.long	0x107
+	.uleb128 0x7
+	.long	.LASF22
+	.byte	0x2
+	.byte	0xaf
+	.byte	0x12
+	.long	0x88
+	.uleb128 0x7
+	.long	.LASF23
+	.byte	0x2
+	.byte	0xb4
+	.byte	0x12
+	.long	0x88
+	.uleb128 0x7
+	.long	.LASF24
+	.byte	0x2
+	.byte	0xc2
+	.byte	0x12
+	.long	0x88
+	.uleb128 0x7
+	.long	.LASF25
+	.byte	0x2
+	.byte	0xc5
+	.byte	0x12
+	.long	0x88
+	.uleb128 0x7
+	.long	.LASF26
+	.byte	0x3
+	.byte	0xd6
+	.byte	0x1b
+	.long	0x5b
+	.uleb128 0x7
+	.long	.LASF27
+	.byte	0x4
+	.byte	0x38
+	.byte	0x11
+	.long	0xe3
+	.uleb128 0x14
+	.long	.LASF30
+	.byte	0x10
+	.byte	0x5
+	.byte	0xb
+	.byte	0x8
+	.long	0x17e
+	.uleb128 0x4
+	.long	.LASF28
+	.byte	0x5
+	.byte	0x10
+	.byte	0xc
+	.long	0xfb
+	.byte	0
+	.uleb128 0x4
+	.long	.LASF29
+	.byte	0x5
+	.byte	0x15
+	.byte	0x15
+	.long	0x132
+	.byte	0x8
+	.byte	0
+	.uleb128 0x14
+	.long	.LASF31
+	.byte	0x90
+	.byte	0x6
+	.byte	0x1a
+	.byte	0x8
+	.long	0x24f
+	.uleb128 0x4
+	.long	.LASF32
+	.byte	0x6
+	.byte	0x1f
+	.byte	0xd
+	.long	0x9b
+	.byte	0
+	.uleb128 0x4
+	.long	.LASF33
+	.byte	0x6
+	.byte	0x24
+	.byte	0xd
+	.long	0xbf
+	.byte	0x8
+	.uleb128 0x4
+	.long	.LASF34
+	.byte	0x6
+	.byte	0x2c
+	.byte	0xf
+	.long	0xd7
+	.byte	0x10
+	.uleb128 0x4
+	.long	.LASF35
+	.byte	0x6
+	.byte	0x2d
+	.byte	0xe
+	.long	0xcb
+	.byte	0x18
+	.uleb128 0x4
+	.long	.LASF36
+	.byte	0x6
+	.byte	0x2f
+	.byte	0xd
+	.long	0xa7
+	.byte	0x1c
+	.uleb128 0x4
+	.long	.LASF37
+	.byte	0x6
+	.byte	0x30
+	.byte	0xd
+	.long	0xb3
+	.byte	0x20
+	.uleb128 0x4
+	.long	.LASF38
+	.byte	0x6
+	.byte	0x32
+	.byte	0x9
+	.long	0x3f
+	.byte	0x24
+	.uleb128 0x4
+	.long	.LASF39
+	.byte	0x6
+	.byte	0x34
+	.byte	0xd
+	.long	0x9b
+	.byte	0x28
+	.uleb128 0x4
+	.long	.LASF40
+	.byte	0x6
+	.byte	0x39
+	.byte	0xd
+	.long	0xe3
+	.byte	0x30
+	.uleb128 0x4
+	.long	.LASF41
+	.byte	0x6
+	.byte	0x3d
+	.byte	0x11
+	.long	0x10e
+	.byte	0x38
+	.uleb128 0x4
+	.long	.LASF42
+	.byte	0x6
+	.byte	0x3f
+	.byte	0x10
+	.long	0x11a
+	.byte	0x40
+	.uleb128 0x4
+	.long	.LASF43
+	.byte	0x6
+	.byte	0x4a
+	.byte	0x15
+	.long	0x156
+	.byte	0x48
+	.uleb128 0x4
+	.long	.LASF44
+	.byte	0x6
+	.byte	0x4b
+	.byte	0x15
+	.long	0x156
+	.byte	0x58
+	.uleb128 0x4
+	.long	.LASF45
+	.byte	0x6
+	.byte	0x4c
+	.byte	0x15
+	.long	0x156
+	.byte	0x68
+	.uleb128 0x4
+	.long	.LASF46
+	.byte	0x6
+	.byte	0x59
+	.byte	0x17
+	.long	0x24f
+	.byte	0x78
+	.byte	0
+	.uleb128 0xd
+	.long	0x132
+	.long	0x25f
+	.uleb128 0xb
+	.long	0x5b
+	.byte	0x2
+	.byte	0
+	.uleb128 0x9
+	.long	0x3a
+	.uleb128 0x10
+	.byte	0x8
+	.byte	0x7
+	.long	.LASF47
+	.uleb128 0x14
+	.long	.LASF48
+	.byte	0x10
+	.byte	0x7
+	.byte	0x33
+	.byte	0x10
+	.long	0x293
+	.uleb128 0x4
+	.long	.LASF49
+	.byte	0x7
+	.byte	0x35
+	.byte	0x23
+	.long	0x293
+	.byte	0
+	.uleb128 0x4
+	.long	.LASF50
+	.byte	0x7
+	.byte	0x36
+	.byte	0x23
+	.long	0x293
+	.byte	0x8
+	.byte	0
+	.uleb128 0x9
+	.long	0x26b
+	.uleb128 0x7
+	.long	.LASF51
+	.byte	0x7
+	.byte	0x37
+	.byte	0x3
+	.long	0x26b
+	.uleb128 0x14
+	.long	.LASF52
+	.byte	0x28
+	.byte	0x8
+	.byte	0x16
+	.byte	0x8
+	.long	0x31a
+	.uleb128 0x4
+	.long	.LASF53
+	.byte	0x8
+	.byte	0x18
+	.byte	0x7
+	.long	0x3f
+	.byte	0
+	.uleb128 0x4
+	.long	.LASF54
+	.byte	0x8
+	.byte	0x19
+	.byte	0x10
+	.long	0x54
+	.byte	0x4
+	.uleb128 0x4
+	.long	.LASF55
+	.byte	0x8
+	.byte	0x1a
+	.byte	0x7
+	.long	0x3f
+	.byte	0x8
+	.uleb128 0x4
+	.long	.LASF56
+	.byte	0x8
+	.byte	0x1c
+	.byte	0x10
+	.long	0x54
+	.byte	0xc
+	.uleb128 0x4
+	.long	.LASF57
+	.byte	0x8
+	.byte	0x20
+	.byte	0x7
+	.long	0x3f
+	.byte	0x10
+	.uleb128 0x4
+	.long	.LASF58
+	.byte	0x8
+	.byte	0x22
+	.byte	0x9
+	.long	0x75
+	.byte	0x14
+	.uleb128 0x4
+	.long	.LASF59
+	.byte	0x8
+	.byte	0x23
+	.byte	0x9
+	.long	0x75
+	.byte	0x16
+	.uleb128 0x4
+	.long	.LASF60
+	.byte	0x8
+	.byte	0x24
+	.byte	0x14
+	.long	0x298
+	.byte	0x18
+	.byte	0
+	.uleb128 0x2f
+	.byte	0x4
+	.byte	0x20
+	.long	0x338
+	.uleb128 0x1c
+	.long	.LASF61
+	.byte	0x22
+	.byte	0x8
+	.long	0x338
+	.uleb128 0x1c
+	.long	.LASF62
+	.byte	0x23
+	.byte	0x7
+	.long	0x3f
+	.byte	0
+	.uleb128 0xd
+	.long	0x33
+	.long	0x348
+	.uleb128 0xb
+	.long	0x5b
+	.byte	0x3
+	.byte	0
+	.uleb128 0x7
+	.long	.LASF63
+	.byte	0x9
+	.byte	0x24
+	.byte	0x3
+	.long	0x31a
+	.uleb128 0x13
+	.long	0x348
+	.uleb128 0x2f
+	.byte	0x28
+	.byte	0x43
+	.long	0x382
+	.uleb128 0x1c
+	.long	.LASF64
+	.byte	0x45
+	.byte	0x1c
+	.long	0x2a4
+	.uleb128 0x1c
+	.long	.LASF61
+	.byte	0x46
+	.byte	0x8
+	.long	0x382
+	.uleb128 0x1c
+	.long	.LASF62
+	.byte	0x47
+	.byte	0xc
+	.long	0x88
+	.byte	0
+	.uleb128 0xd
+	.long	0x33
+	.long	0x392
+	.uleb128 0xb
+	.long	0x5b
+	.byte	0x27
+	.byte	0
+	.uleb128 0x7
+	.long	.LASF65
+	.byte	0x9
+	.byte	0x48
+	.byte	0x3
+	.long	0x359
+	.uleb128 0x10
+	.byte	0x8
+	.byte	0x5
+	.long	.LASF66
+	.uleb128 0xd
+	.long	0x33
+	.long	0x3b5
+	.uleb128 0xb
+	.long	0x5b
+	.byte	0x1f
+	.byte	0
+	.uleb128 0x7
+	.long	.LASF67
+	.byte	0xa
+	.byte	0x6c
+	.byte	0x13
+	.long	0x126
+	.uleb128 0x9
+	.long	0x3c6
+	.uleb128 0x3c
+	.uleb128 0x3d
+	.byte	0x7
+	.byte	0x4
+	.long	0x54
+	.byte	0x17
+	.byte	0x48
+	.byte	0x3
+	.long	0x8ec
+	.uleb128 0x1
+	.long	.LASF68
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF69
+	.byte	0x1
+	.uleb128 0x1
+	.long	.LASF70
+	.byte	0x2
+	.uleb128 0x1
+	.long	.LASF71
+	.byte	0x3
+	.uleb128 0x1
+	.long	.LASF72
+	.byte	0x4
+	.uleb128 0x1
+	.long	.LASF73
+	.byte	0x5
+	.uleb128 0x1
+	.long	.LASF74
+	.byte	0x6
+	.uleb128 0x1
+	.long	.LASF75
+	.byte	0x7
+	.uleb128 0x1
+	.long	.LASF76
+	.byte	0x8
+	.uleb128 0x1
+	.long	.LASF77
+	.byte	0x9
+	.uleb128 0x1
+	.long	.LASF78
+	.byte	0xa
+	.uleb128 0x1
+	.long	.LASF79
+	.byte	0xb
+	.uleb128 0x1
+	.long	.LASF80
+	.byte	0xc
+	.uleb128 0x1
+	.long	.LASF81
+	.byte	0xd
+	.uleb128 0x1
+	.long	.LASF82
+	.byte	0xe
+	.uleb128 0x1
+	.long	.LASF83
+	.byte	0xf
+	.uleb128 0x1
+	.long	.LASF84
+	.byte	0x10
+	.uleb128 0x1
+	.long	.LASF85
+	.byte	0x11
+	.uleb128 0x1
+	.long	.LASF86
+	.byte	0x12
+	.uleb128 0x1
+	.long	.LASF87
+	.byte	0x13
+	.uleb128 0x1
+	.long	.LASF88
+	.byte	0x14
+	.uleb128 0x1
+	.long	.LASF89
+	.byte	0x15
+	.uleb128 0x1
+	.long	.LASF90
+	.byte	0x16
+	.uleb128 0x1
+	.long	.LASF91
+	.byte	0x17
+	.uleb128 0x1
+	.long	.LASF92
+	.byte	0x18
+	.uleb128 0x1
+	.long	.LASF93
+	.byte	0x19
+	.uleb128 0x1
+	.long	.LASF94
+	.byte	0x1a
+	.uleb128 0x1
+	.long	.LASF95
+	.byte	0x1b
+	.uleb128 0x1
+	.long	.LASF96
+	.byte	0x1c
+	.uleb128 0x1
+	.long	.LASF97
+	.byte	0x1d
+	.uleb128 0x1
+	.long	.LASF98
+	.byte	0x1e
+	.uleb128 0x1
+	.long	.LASF99
+	.byte	0x1f
+	.uleb128 0x1
+	.long	.LASF100
+	.byte	0x20
+	.uleb128 0x1
+	.long	.LASF101
+	.byte	0x21
+	.uleb128 0x1
+	.long	.LASF102
+	.byte	0x22
+	.uleb128 0x1
+	.long	.LASF103
+	.byte	0x23
+	.uleb128 0x1
+	.long	.LASF104
+	.byte	0x24
+	.uleb128 0x1
+	.long	.LASF105
+	.byte	0x25
+	.uleb128 0x1
+	.long	.LASF106
+	.byte	0x26
+	.uleb128 0x1
+	.long	.LASF107
+	.byte	0x27
+	.uleb128 0x1
+	.long	.LASF108
+	.byte	0x28
+	.uleb128 0x1
+	.long	.LASF109
+	.byte	0x29
+	.uleb128 0x1
+	.long	.LASF110
+	.byte	0x2a
+	.uleb128 0x1
+	.long	.LASF111
+	.byte	0x2b
+	.uleb128 0x1
+	.long	.LASF112
+	.byte	0x2c
+	.uleb128 0x1
+	.long	.LASF113
+	.byte	0x2d
+	.uleb128 0x1
+	.long	.LASF114
+	.byte	0x2e
+	.uleb128 0x1
+	.long	.LASF115
+	.byte	0x2f
+	.uleb128 0x1
+	.long	.LASF116
+	.byte	0x30
+	.uleb128 0x1
+	.long	.LASF117
+	.byte	0x31
+	.uleb128 0x1
+	.long	.LASF118
+	.byte	0x32
+	.uleb128 0x1
+	.long	.LASF119
+	.byte	0x33
+	.uleb128 0x1
+	.long	.LASF120
+	.byte	0x34
+	.uleb128 0x1
+	.long	.LASF121
+	.byte	0x35
+	.uleb128 0x1
+	.long	.LASF122
+	.byte	0x36
+	.uleb128 0x1
+	.long	.LASF123
+	.byte	0x37
+	.uleb128 0x1
+	.long	.LASF124
+	.byte	0x38
+	.uleb128 0x1
+	.long	.LASF125
+	.byte	0x39
+	.uleb128 0x1
+	.long	.LASF126
+	.byte	0x3a
+	.uleb128 0x1
+	.long	.LASF127
+	.byte	0x3b
+	.uleb128 0x1
+	.long	.LASF128
+	.byte	0x3c
+	.uleb128 0x1
+	.long	.LASF129
+	.byte	0x3c
+	.uleb128 0x1
+	.long	.LASF130
+	.byte	0x3d
+	.uleb128 0x1
+	.long	.LASF131
+	.byte	0x3e
+	.uleb128 0x1
+	.long	.LASF132
+	.byte	0x3f
+	.uleb128 0x1
+	.long	.LASF133
+	.byte	0x40
+	.uleb128 0x1
+	.long	.LASF134
+	.byte	0x41
+	.uleb128 0x1
+	.long	.LASF135
+	.byte	0x42
+	.uleb128 0x1
+	.long	.LASF136
+	.byte	0x43
+	.uleb128 0x1
+	.long	.LASF137
+	.byte	0x44
+	.uleb128 0x1
+	.long	.LASF138
+	.byte	0x45
+	.uleb128 0x1
+	.long	.LASF139
+	.byte	0x46
+	.uleb128 0x1
+	.long	.LASF140
+	.byte	0x47
+	.uleb128 0x1
+	.long	.LASF141
+	.byte	0x48
+	.uleb128 0x1
+	.long	.LASF142
+	.byte	0x49
+	.uleb128 0x1
+	.long	.LASF143
+	.byte	0x4a
+	.uleb128 0x1
+	.long	.LASF144
+	.byte	0x4b
+	.uleb128 0x1
+	.long	.LASF145
+	.byte	0x4c
+	.uleb128 0x1
+	.long	.LASF146
+	.byte	0x4d
+	.uleb128 0x1
+	.long	.LASF147
+	.byte	0x4e
+	.uleb128 0x1
+	.long	.LASF148
+	.byte	0x4f
+	.uleb128 0x1
+	.long	.LASF149
+	.byte	0x50
+	.uleb128 0x1
+	.long	.LASF150
+	.byte	0x51
+	.uleb128 0x1
+	.long	.LASF151
+	.byte	0x52
+	.uleb128 0x1
+	.long	.LASF152
+	.byte	0x53
+	.uleb128 0x1
+	.long	.LASF153
+	.byte	0x54
+	.uleb128 0x1
+	.long	.LASF154
+	.byte	0x55
+	.uleb128 0x1
+	.long	.LASF155
+	.byte	0x56
+	.uleb128 0x1
+	.long	.LASF156
+	.byte	0x57
+	.uleb128 0x1
+	.long	.LASF157
+	.byte	0x58
+	.uleb128 0x1
+	.long	.LASF158
+	.byte	0x59
+	.uleb128 0x1
+	.long	.LASF159
+	.byte	0x5a
+	.uleb128 0x1
+	.long	.LASF160
+	.byte	0x5b
+	.uleb128 0x1
+	.long	.LASF161
+	.byte	0x5c
+	.uleb128 0x1
+	.long	.LASF162
+	.byte	0x5d
+	.uleb128 0x1
+	.long	.LASF163
+	.byte	0x5e
+	.uleb128 0x1
+	.long	.LASF164
+	.byte	0x5f
+	.uleb128 0x1
+	.long	.LASF165
+	.byte	0x60
+	.uleb128 0x1
+	.long	.LASF166
+	.byte	0x61
+	.uleb128 0x1
+	.long	.LASF167
+	.byte	0x62
+	.uleb128 0x1
+	.long	.LASF168
+	.byte	0x63
+	.uleb128 0x1
+	.long	.LASF169
+	.byte	0x64
+	.uleb128 0x1
+	.long	.LASF170
+	.byte	0x65
+	.uleb128 0x1
+	.long	.LASF171
+	.byte	0x66
+	.uleb128 0x1
+	.long	.LASF172
+	.byte	0x67
+	.uleb128 0x1
+	.long	.LASF173
+	.byte	0x68
+	.uleb128 0x1
+	.long	.LASF174
+	.byte	0x69
+	.uleb128 0x1
+	.long	.LASF175
+	.byte	0x6a
+	.uleb128 0x1
+	.long	.LASF176
+	.byte	0x6b
+	.uleb128 0x1
+	.long	.LASF177
+	.byte	0x6c
+	.uleb128 0x1
+	.long	.LASF178
+	.byte	0x6d
+	.uleb128 0x1
+	.long	.LASF179
+	.byte	0x6e
+	.uleb128 0x1
+	.long	.LASF180
+	.byte	0x6f
+	.uleb128 0x1
+	.long	.LASF181
+	.byte	0x70
+	.uleb128 0x1
+	.long	.LASF182
+	.byte	0x71
+	.uleb128 0x1
+	.long	.LASF183
+	.byte	0x72
+	.uleb128 0x1
+	.long	.LASF184
+	.byte	0x73
+	.uleb128 0x1
+	.long	.LASF185
+	.byte	0x74
+	.uleb128 0x1
+	.long	.LASF186
+	.byte	0x75
+	.uleb128 0x1
+	.long	.LASF187
+	.byte	0x76
+	.uleb128 0x1
+	.long	.LASF188
+	.byte	0x77
+	.uleb128 0x1
+	.long	.LASF189
+	.byte	0x78
+	.uleb128 0x1
+	.long	.LASF190
+	.byte	0x79
+	.uleb128 0x1
+	.long	.LASF191
+	.byte	0x7a
+	.uleb128 0x1
+	.long	.LASF192
+	.byte	0x7b
+	.uleb128 0x1
+	.long	.LASF193
+	.byte	0x7c
+	.uleb128 0x1
+	.long	.LASF194
+	.byte	0x7d
+	.uleb128 0x1
+	.long	.LASF195
+	.byte	0x7e
+	.uleb128 0x1
+	.long	.LASF196
+	.byte	0x7f
+	.uleb128 0x1
+	.long	.LASF197
+	.byte	0x80
+	.uleb128 0x1
+	.long	.LASF198
+	.byte	0x81
+	.uleb128 0x1
+	.long	.LASF199
+	.byte	0x82
+	.uleb128 0x1
+	.long	.LASF200
+	.byte	0x83
+	.uleb128 0x1
+	.long	.LASF201
+	.byte	0x84
+	.uleb128 0x1
+	.long	.LASF202
+	.byte	0x85
+	.uleb128 0x1
+	.long	.LASF203
+	.byte	0x86
+	.uleb128 0x1
+	.long	.LASF204
+	.byte	0x87
+	.uleb128 0x1
+	.long	.LASF205
+	.byte	0x88
+	.uleb128 0x1
+	.long	.LASF206
+	.byte	0x89
+	.uleb128 0x1
+	.long	.LASF207
+	.byte	0x8a
+	.uleb128 0x1
+	.long	.LASF208
+	.byte	0x8b
+	.uleb128 0x1
+	.long	.LASF209
+	.byte	0x8c
+	.uleb128 0x1
+	.long	.LASF210
+	.byte	0x8d
+	.uleb128 0x1
+	.long	.LASF211
+	.byte	0x8e
+	.uleb128 0x1
+	.long	.LASF212
+	.byte	0x8f
+	.uleb128 0x1
+	.long	.LASF213
+	.byte	0x90
+	.uleb128 0x1
+	.long	.LASF214
+	.byte	0x91
+	.uleb128 0x1
+	.long	.LASF215
+	.byte	0x92
+	.uleb128 0x1
+	.long	.LASF216
+	.byte	0x93
+	.uleb128 0x1
+	.long	.LASF217
+	.byte	0x94
+	.uleb128 0x1
+	.long	.LASF218
+	.byte	0x95
+	.uleb128 0x1
+	.long	.LASF219
+	.byte	0x96
+	.uleb128 0x1
+	.long	.LASF220
+	.byte	0x97
+	.uleb128 0x1
+	.long	.LASF221
+	.byte	0x98
+	.uleb128 0x1
+	.long	.LASF222
+	.byte	0x99
+	.uleb128 0x1
+	.long	.LASF223
+	.byte	0x9a
+	.uleb128 0x1
+	.long	.LASF224
+	.byte	0x9b
+	.uleb128 0x1
+	.long	.LASF225
+	.byte	0x9c
+	.uleb128 0x1
+	.long	.LASF226
+	.byte	0x9d
+	.uleb128 0x1
+	.long	.LASF227
+	.byte	0x9e
+	.uleb128 0x1
+	.long	.LASF228
+	.byte	0x9f
+	.uleb128 0x1
+	.long	.LASF229
+	.byte	0xa0
+	.uleb128 0x1
+	.long	.LASF230
+	.byte	0xa1
+	.uleb128 0x1
+	.long	.LASF231
+	.byte	0xa2
+	.uleb128 0x1
+	.long	.LASF232
+	.byte	0xa3
+	.uleb128 0x1
+	.long	.LASF233
+	.byte	0xa4
+	.uleb128 0x1
+	.long	.LASF234
+	.byte	0xa5
+	.uleb128 0x1
+	.long	.LASF235
+	.byte	0xa6
+	.uleb128 0x1
+	.long	.LASF236
+	.byte	0xa7
+	.uleb128 0x1
+	.long	.LASF237
+	.byte	0xa8
+	.uleb128 0x1
+	.long	.LASF238
+	.byte	0xa9
+	.uleb128 0x1
+	.long	.LASF239
+	.byte	0xaa
+	.uleb128 0x1
+	.long	.LASF240
+	.byte	0xab
+	.uleb128 0x1
+	.long	.LASF241
+	.byte	0xac
+	.uleb128 0x1
+	.long	.LASF242
+	.byte	0xad
+	.uleb128 0x1
+	.long	.LASF243
+	.byte	0xae
+	.uleb128 0x1
+	.long	.LASF244
+	.byte	0xaf
+	.uleb128 0x1
+	.long	.LASF245
+	.byte	0xb0
+	.uleb128 0x1
+	.long	.LASF246
+	.byte	0xb1
+	.uleb128 0x1
+	.long	.LASF247
+	.byte	0xb2
+	.uleb128 0x1
+	.long	.LASF248
+	.byte	0xb3
+	.uleb128 0x1
+	.long	.LASF249
+	.byte	0xb4
+	.uleb128 0x1
+	.long	.LASF250
+	.byte	0xb5
+	.uleb128 0x1
+	.long	.LASF251
+	.byte	0xb6
+	.uleb128 0x1
+	.long	.LASF252
+	.byte	0xb7
+	.uleb128 0x1
+	.long	.LASF253
+	.byte	0xb8
+	.uleb128 0x1
+	.long	.LASF254
+	.byte	0xb9
+	.uleb128 0x1
+	.long	.LASF255
+	.byte	0xba
+	.uleb128 0x1
+	.long	.LASF256
+	.byte	0xbb
+	.uleb128 0x1
+	.long	.LASF257
+	.byte	0xbc
+	.uleb128 0x1
+	.long	.LASF258
+	.byte	0xbd
+	.uleb128 0x1
+	.long	.LASF259
+	.byte	0xbe
+	.uleb128 0x1
+	.long	.LASF260
+	.byte	0xbf
+	.uleb128 0x1
+	.long	.LASF261
+	.byte	0xc0
+	.uleb128 0x1
+	.long	.LASF262
+	.byte	0xc1
+	.uleb128 0x1
+	.long	.LASF263
+	.byte	0xc2
+	.uleb128 0x1
+	.long	.LASF264
+	.byte	0xc3
+	.uleb128 0x1
+	.long	.LASF265
+	.byte	0xc4
+	.uleb128 0x1
+	.long	.LASF266
+	.byte	0xc5
+	.uleb128 0x1
+	.long	.LASF267
+	.byte	0xc6
+	.uleb128 0x1
+	.long	.LASF268
+	.byte	0xc7
+	.uleb128 0x1
+	.long	.LASF269
+	.byte	0xeb
+	.uleb128 0x1
+	.long	.LASF270
+	.byte	0xec
+	.uleb128 0x1
+	.long	.LASF271
+	.byte	0xed
+	.uleb128 0x1
+	.long	.LASF272
+	.byte	0xee
+	.uleb128 0x1
+	.long	.LASF273
+	.byte	0xef
+	.uleb128 0x1
+	.long	.LASF274
+	.byte	0xf0
+	.uleb128 0x1
+	.long	.LASF275
+	.byte	0xf1
+	.uleb128 0x1
+	.long	.LASF276
+	.byte	0xf2
+	.uleb128 0x1
+	.long	.LASF277
+	.byte	0xf3
+	.uleb128 0x1
+	.long	.LASF278
+	.byte	0xf4
+	.uleb128 0x1
+	.long	.LASF279
+	.byte	0xf5
+	.uleb128 0x1
+	.long	.LASF280
+	.byte	0xf6
+	.uleb128 0x1
+	.long	.LASF281
+	.byte	0xf7
+	.uleb128 0x1
+	.long	.LASF282
+	.byte	0xf8
+	.uleb128 0x1
+	.long	.LASF283
+	.byte	0xf9
+	.uleb128 0x1
+	.long	.LASF284
+	.byte	0xfa
+	.byte	0
+	.uleb128 0x7
+	.long	.LASF285
+	.byte	0xb
+	.byte	0x18
+	.byte	0x13
+	.long	0x69
+	.uleb128 0x7
+	.long	.LASF286
+	.byte	0xb
+	.byte	0x1a
+	.byte	0x14
+	.long	0x7c
+	.uleb128 0x7
+	.long	.LASF287
+	.byte	0xb
+	.byte	0x1b
+	.byte	0x14
+	.long	0x8f
+	.uleb128 0x14
+	.long	.LASF288
+	.byte	0xd8
+	.byte	0xc
+	.byte	0x31
+	.byte	0x8
+	.long	0xa97
+	.uleb128 0x4
+	.long	.LASF289
+	.byte	0xc
+	.byte	0x33
+	.byte	0x7
+	.long	0x3f
+	.byte	0
+	.uleb128 0x4
+	.long	.LASF290
+	.byte	0xc
+	.byte	0x36
+	.byte	0x9
+	.long	0x2e
+	.byte	0x8
+	.uleb128 0x4
+	.long	.LASF291
+	.byte	0xc
+	.byte	0x37
+	.byte	0x9
+	.long	0x2e
+	.byte	0x10
+	.uleb128 0x4
+	.long	.LASF292
+	.byte	0xc
+	.byte	0x38
+	.byte	0x9
+	.long	0x2e
+	.byte	0x18
+	.uleb128 0x4
+	.long	.LASF293
+	.byte	0xc
+	.byte	0x39
+	.byte	0x9
+	.long	0x2e
+	.byte	0x20
+	.uleb128 0x4
+	.long	.LASF294
+	.byte	0xc
+	.byte	0x3a
+	.byte	0x9
+	.long	0x2e
+	.byte	0x28
+	.uleb128 0x4
+	.long	.LASF295
+	.byte	0xc
+	.byte	0x3b
+	.byte	0x9
+	.long	0x2e
+	.byte	0x30
+	.uleb128 0x4
+	.long	.LASF296
+	.byte	0xc
+	.byte	0x3c
+	.byte	0x9
+	.long	0x2e
+	.byte	0x38
+	.uleb128 0x4
+	.long	.LASF297
+	.byte	0xc
+	.byte	0x3d
+	.byte	0x9
+	.long	0x2e
+	.byte	0x40
+	.uleb128 0x4
+	.long	.LASF298
+	.byte	0xc
+	.byte	0x40
+	.byte	0x9
+	.long	0x2e
+	.byte	0x48
+	.uleb128 0x4
+	.long	.LASF299
+	.byte	0xc
+	.byte	0x41
+	.byte	0x9
+	.long	0x2e
+	.byte	0x50
+	.uleb128 0x4
+	.long	.LASF300
+	.byte	0xc
+	.byte	0x42
+	.byte	0x9
+	.long	0x2e
+	.byte	0x58
+	.uleb128 0x4
+	.long	.LASF301
+	.byte	0xc
+	.byte	0x44
+	.byte	0x16
+	.long	0xab0
+	.byte	0x60
+	.uleb128 0x4
+	.long	.LASF302
+	.byte	0xc
+	.byte	0x46
+	.byte	0x14
+	.long	0xab5
+	.byte	0x68
+	.uleb128 0x4
+	.long	.LASF303
+	.byte	0xc
+	.byte	0x48
+	.byte	0x7
+	.long	0x3f
+	.byte	0x70
+	.uleb128 0x4
+	.long	.LASF304
+	.byte	0xc
+	.byte	0x49
+	.byte	0x7
+	.long	0x3f
+	.byte	0x74
+	.uleb128 0x4
+	.long	.LASF305
+	.byte	0xc
+	.byte	0x4a
+	.byte	0xb
+	.long	0xe3
+	.byte	0x78
+	.uleb128 0x4
+	.long	.LASF306
+	.byte	0xc
+	.byte	0x4d
+	.byte	0x12
+	.long	0x4d
+	.byte	0x80
+	.uleb128 0x4
+	.long	.LASF307
+	.byte	0xc
+	.byte	0x4e
+	.byte	0xf
+	.long	0x62
+	.byte	0x82
+	.uleb128 0x4
+	.long	.LASF308
+	.byte	0xc
+	.byte	0x4f
+	.byte	0x8
+	.long	0xaba
+	.byte	0x83
+	.uleb128 0x4
+	.long	.LASF309
+	.byte	0xc
+	.byte	0x51
+	.byte	0xf
+	.long	0xaca
+	.byte	0x88
+	.uleb128 0x4
+	.long	.LASF310
+	.byte	0xc
+	.byte	0x59
+	.byte	0xd
+	.long	0xef
+	.byte	0x90
+	.uleb128 0x4
+	.long	.LASF311
+	.byte	0xc
+	.byte	0x5b
+	.byte	0x17
+	.long	0xad4
+	.byte	0x98
+	.uleb128 0x4
+	.long	.LASF312
+	.byte	0xc
+	.byte	0x5c
+	.byte	0x19
+	.long	0xade
+	.byte	0xa0
+	.uleb128 0x4
+	.long	.LASF313
+	.byte	0xc
+	.byte	0x5d
+	.byte	0x14
+	.long	0xab5
+	.byte	0xa8
+	.uleb128 0x4
+	.long	.LASF314
+	.byte	0xc
+	.byte	0x5e
+	.byte	0x9
+	.long	0x107
+	.byte	0xb0
+	.uleb128 0x4
+	.long	.LASF315
+	.byte	0xc
+	.byte	0x5f
+	.byte	0xa
+	.long	0x13e
+	.byte	0xb8
+	.uleb128 0x4
+	.long	.LASF316
+	.byte	0xc
+	.byte	0x60
+	.byte	0x7
+	.long	0x3f
+	.byte	0xc0
+	.uleb128 0x4
+	.long	.LASF317
+	.byte	0xc
+	.byte	0x62
+	.byte	0x8
+	.long	0xae3
+	.byte	0xc4
+	.byte	0
+	.uleb128 0x7
+	.long	.LASF318
+	.byte	0xd
+	.byte	0x7
+	.byte	0x19
+	.long	0x910
+	.uleb128 0x3e
+	.long	.LASF401
+	.byte	0xc
+	.byte	0x2b
+	.byte	0xe
+	.uleb128 0x28
+	.long	.LASF319
+	.uleb128 0x9
+	.long	0xaab
+	.uleb128 0x9
+	.long	0x910
+	.uleb128 0xd
+	.long	0x33
+	.long	0xaca
+	.uleb128 0xb
+	.long	0x5b
+	.byte	0
+	.byte	0
+	.uleb128 0x9
+	.long	0xaa3
+	.uleb128 0x28
+	.long	.LASF320
+	.uleb128 0x9
+	.long	0xacf
+	.uleb128 0x28
+	.long	.LASF321
+	.uleb128 0x9
+	.long	0xad9
+	.uleb128 0xd
+	.long	0x33
+	.long	0xaf3
+	.uleb128 0xb
+	.long	0x5b
+	.byte	0x13
+	.byte	0
+	.uleb128 0x9
+	.long	0xa97
+	.uleb128 0x2e
+	.long	0xaf3
+	.uleb128 0x14
+	.long	.LASF322
+	.byte	0x40
+	.byte	0xe
+	.byte	0x30
+	.byte	0x8
+	.long	0xb9a
+	.uleb128 0x4
+	.long	.LASF323
+	.byte	0xe
+	.byte	0x31
+	.byte	0xe
+	.long	0x54
+	.byte	0
+	.uleb128 0x4
+	.long	.LASF324
+	.byte	0xe
+	.byte	0x32
+	.byte	0xe
+	.long	0x54
+	.byte	0x4
+	.uleb128 0x4
+	.long	.LASF325
+	.byte	0xe
+	.byte	0x33
+	.byte	0xe
+	.long	0x54
+	.byte	0x8
+	.uleb128 0x4
+	.long	.LASF326
+	.byte	0xe
+	.byte	0x34
+	.byte	0xe
+	.long	0x54
+	.byte	0xc
+	.uleb128 0x4
+	.long	.LASF327
+	.byte	0xe
+	.byte	0x35
+	.byte	0xe
+	.long	0x8f8
+	.byte	0x10
+	.uleb128 0x4
+	.long	.LASF328
+	.byte	0xe
+	.byte	0x36
+	.byte	0xe
+	.long	0x904
+	.byte	0x18
+	.uleb128 0x4
+	.long	.LASF329
+	.byte	0xe
+	.byte	0x37
+	.byte	0xe
+	.long	0x54
+	.byte	0x20
+	.uleb128 0x4
+	.long	.LASF330
+	.byte	0xe
+	.byte	0x38
+	.byte	0xe
+	.long	0x54
+	.byte	0x24
+	.uleb128 0x4
+	.long	.LASF331
+	.byte	0xe
+	.byte	0x39
+	.byte	0x13
+	.long	0xb9f
+	.byte	0x28
+	.uleb128 0x4
+	.long	.LASF332
+	.byte	0xe
+	.byte	0x3a
+	.byte	0x13
+	.long	0xb9f
+	.byte	0x30
+	.uleb128 0x4
+	.long	.LASF333
+	.byte	0xe
+	.byte	0x3b
+	.byte	0x9
+	.long	0x3f
+	.byte	0x38
+	.byte	0
+	.uleb128 0x13
+	.long	0xafd
+	.uleb128 0xd
+	.long	0x46
+	.long	0xbaf
+	.uleb128 0xb
+	.long	0x5b
+	.byte	0x7
+	.byte	0
+	.uleb128 0x14
+	.long	.LASF334
+	.byte	0x10
+	.byte	0xe
+	.byte	0xa8
+	.byte	0x8
+	.long	0xbe4
+	.uleb128 0x4
+	.long	.LASF335
+	.byte	0xe
+	.byte	0xa9
+	.byte	0xe
+	.long	0x54
+	.byte	0
+	.uleb128 0x4
+	.long	.LASF336
+	.byte	0xe
+	.byte	0xaa
+	.byte	0xe
+	.long	0x54
+	.byte	0x4
+	.uleb128 0x4
+	.long	.LASF337
+	.byte	0xe
+	.byte	0xab
+	.byte	0xc
+	.long	0x13e
+	.byte	0x8
+	.byte	0
+	.uleb128 0x13
+	.long	0xbaf
+	.uleb128 0x3f
+	.long	.LASF402
+	.byte	0x80
+	.byte	0x10
+	.byte	0xe
+	.byte	0xf7
+	.byte	0x8
+	.long	0xc4d
+	.uleb128 0x1d
+	.string	"H"
+	.byte	0xe
+	.byte	0xf8
+	.byte	0xe
+	.long	0xc4d
+	.byte	0
+	.uleb128 0x1d
+	.string	"buf"
+	.byte	0xe
+	.byte	0xf9
+	.byte	0x13
+	.long	0xc5d
+	.byte	0x20
+	.uleb128 0x1d
+	.string	"t"
+	.byte	0xe
+	.byte	0xfa
+	.byte	0xe
+	.long	0xc6d
+	.byte	0x60
+	.uleb128 0x1d
+	.string	"f"
+	.byte	0xe
+	.byte	0xfb
+	.byte	0xe
+	.long	0xc6d
+	.byte	0x68
+	.uleb128 0x4
+	.long	.LASF338
+	.byte	0xe
+	.byte	0xfc
+	.byte	0xe
+	.long	0x54
+	.byte	0x70
+	.uleb128 0x4
+	.long	.LASF323
+	.byte	0xe
+	.byte	0xfd
+	.byte	0xe
+	.long	0x54
+	.byte	0x74
+	.uleb128 0x4
+	.long	.LASF333
+	.byte	0xe
+	.byte	0xfe
+	.byte	0xe
+	.long	0x54
+	.byte	0x78
+	.byte	0
+	.uleb128 0xd
+	.long	0x8f8
+	.long	0xc5d
+	.uleb128 0xb
+	.long	0x5b
+	.byte	0x7
+	.byte	0
+	.uleb128 0xd
+	.long	0x46
+	.long	0xc6d
+	.uleb128 0xb
+	.long	0x5b
+	.byte	0x3f
+	.byte	0
+	.uleb128 0xd
+	.long	0x8f8
+	.long	0xc7d
+	.uleb128 0xb
+	.long	0x5b
+	.byte	0x1
+	.byte	0
+	.uleb128 0xd
+	.long	0x46
+	.long	0xc8d
+	.uleb128 0xb
+	.long	0x5b
+	.byte	0x1f
+	.byte	0
+	.uleb128 0x9
+	.long	0xbe9
+	.uleb128 0x9
+	.long	0x46
+	.uleb128 0x30
+	.string	"u8"
+	.byte	0x7
+	.byte	0x11
+	.long	0x8ec
+	.uleb128 0x13
+	.long	0xc97
+	.uleb128 0x30
+	.string	"u32"
+	.byte	0x8
+	.byte	0x12
+	.long	0x8f8
+	.uleb128 0x13
+	.long	0xca6
+	.uleb128 0xd
+	.long	0xcb1
+	.long	0xcc6
+	.uleb128 0xb
+	.long	0x5b
+	.byte	0x7
+	.byte	0
+	.uleb128 0x13
+	.long	0xcb6
+	.uleb128 0x31
+	.long	.LASF339
+	.byte	0xa
+	.byte	0x12
+	.long	0xcc6
+	.byte	0x20
+	.byte	0x67
+	.byte	0xe6
+	.byte	0x9
+	.byte	0x6a
+	.byte	0x85
+	.byte	0xae
+	.byte	0x67
+	.byte	0xbb
+	.byte	0x72
+	.byte	0xf3
+	.byte	0x6e
+	.byte	0x3c
+	.byte	0x3a
+	.byte	0xf5
+	.byte	0x4f
+	.byte	0xa5
+	.byte	0x7f
+	.byte	0x52
+	.byte	0xe
+	.byte	0x51
+	.byte	0x8c
+	.byte	0x68
+	.byte	0x5
+	.byte	0x9b
+	.byte	0xab
+	.byte	0xd9
+	.byte	0x83
+	.byte	0x1f
+	.byte	0x19
+	.byte	0xcd
+	.byte	0xe0
+	.byte	0x5b
+	.uleb128 0xd
+	.long	0xca1
+	.long	0xd0d
+	.uleb128 0xb
+	.long	0x5b
+	.byte	0x9
+	.uleb128 0xb
+	.long	0x5b
+	.byte	0xf
+	.byte	0
+	.uleb128 0x13
+	.long	0xcf7
+	.uleb128 0x31
+	.long	.LASF340
+	.byte	0xf
+	.byte	0x11
+	.long	0xd0d
+	.byte	0xa0
+	.byte	0
+	.byte	0x1
+	.byte	0x2
+	.byte	0x3
+	.byte	0x4
+	.byte	0x5
+	.byte	0x6
+	.byte	0x7
+	.byte	0x8
+	.byte	0x9
+	.byte	0xa
+	.byte	0xb
+	.byte	0xc
+	.byte	0xd
+	.byte	0xe
+	.byte	0xf
+	.byte	0xe
+	.byte	0xa
+	.byte	0x4
+	.byte	0x8
+	.byte	0x9
+	.byte	0xf
+	.byte	0xd
+	.byte	0x6
+	.byte	0x1
+	.byte	0xc
+	.byte	0
+	.byte	0x2
+	.byte	0xb
+	.byte	0x7
+	.byte	0x5
+	.byte	0x3
+	.byte	0xb
+	.byte	0x8
+	.byte	0xc
+	.byte	0
+	.byte	0x5
+	.byte	0x2
+	.byte	0xf
+	.byte	0xd
+	.byte	0xa
+	.byte	0xe
+	.byte	0x3
+	.byte	0x6
+	.byte	0x7
+	.byte	0x1
+	.byte	0x9
+	.byte	0x4
+	.byte	0x7
+	.byte	0x9
+	.byte	0x3
+	.byte	0x1
+	.byte	0xd
+	.byte	0xc
+	.byte	0xb
+	.byte	0xe
+	.byte	0x2
+	.byte	0x6
+	.byte	0x5
+	.byte	0xa
+	.byte	0x4
+	.byte	0
+	.byte	0xf
+	.byte	0x8
+	.byte	0x9
+	.byte	0
+	.byte	0x5
+	.byte	0x7
+	.byte	0x2
+	.byte	0x4
+	.byte	0xa
+	.byte	0xf
+	.byte	0xe
+	.byte	0x1
+	.byte	0xb
+	.byte	0xc
+	.byte	0x6
+	.byte	0x8
+	.byte	0x3
+	.byte	0xd
+	.byte	0x2
+	.byte	0xc
+	.byte	0x6
+	.byte	0xa
+	.byte	0
+	.byte	0xb
+	.byte	0x8
+	.byte	0x3
+	.byte	0x4
+	.byte	0xd
+	.byte	0x7
+	.byte	0x5
+	.byte	0xf
+	.byte	0xe
+	.byte	0x1
+	.byte	0x9
+	.byte	0xc
+	.byte	0x5
+	.byte	0x1
+	.byte	0xf
+	.byte	0xe
+	.byte	0xd
+	.byte	0x4
+	.byte	0xa
+	.byte	0
+	.byte	0x7
+	.byte	0x6
+	.byte	0x3
+	.byte	0x9
+	.byte	0x2
+	.byte	0x8
+	.byte	0xb
+	.byte	0xd
+	.byte	0xb
+	.byte	0x7
+	.byte	0xe
+	.byte	0xc
+	.byte	0x1
+	.byte	0x3
+	.byte	0x9
+	.byte	0x5
+	.byte	0
+	.byte	0xf
+	.byte	0x4
+	.byte	0x8
+	.byte	0x6
+	.byte	0x2
+	.byte	0xa
+	.byte	0x6
+	.byte	0xf
+	.byte	0xe
+	.byte	0x9
+	.byte	0xb
+	.byte	0x3
+	.byte	0
+	.byte	0x8
+	.byte	0xc
+	.byte	0x2
+	.byte	0xd
+	.byte	0x7
+	.byte	0x1
+	.byte	0x4
+	.byte	0xa
+	.byte	0x5
+	.byte	0xa
+	.byte	0x2
+	.byte	0x8
+	.byte	0x4
+	.byte	0x7
+	.byte	0x6
+	.byte	0x1
+	.byte	0x5
+	.byte	0xf
+	.byte	0xb
+	.byte	0x9
+	.byte	0xe
+	.byte	0x3
+	.byte	0xc
+	.byte	0xd
+	.byte	0
+	.uleb128 0x14
+	.long	.LASF341
+	.byte	0x50
+	.byte	0x1
+	.byte	0xfe
+	.byte	0x8
+	.long	0xe27
+	.uleb128 0x1d
+	.string	"fd"
+	.byte	0x1
+	.byte	0xff
+	.byte	0x9
+	.long	0x3f
+	.byte	0
+	.uleb128 0x1e
+	.long	.LASF342
+	.value	0x100
+	.byte	0xb
+	.long	0x14a
+	.byte	0x8
+	.uleb128 0x1e
+	.long	.LASF343
+	.value	0x101
+	.byte	0xc
+	.long	0x13e
+	.byte	0x10
+	.uleb128 0x1e
+	.long	.LASF326
+	.value	0x102
+	.byte	0xe
+	.long	0x54
+	.byte	0x18
+	.uleb128 0x40
+	.string	"err"
+	.byte	0x1
+	.value	0x103
+	.byte	0x9
+	.long	0x3f
+	.byte	0x1c
+	.uleb128 0x1e
+	.long	.LASF344
+	.value	0x104
+	.byte	0x15
+	.long	0x392
+	.byte	0x20
+	.uleb128 0x1e
+	.long	.LASF345
+	.value	0x105
+	.byte	0x15
+	.long	0xe27
+	.byte	0x48
+	.byte	0
+	.uleb128 0x9
+	.long	0xc7d
+	.uleb128 0x11
+	.long	.LASF346
+	.byte	0x10
+	.byte	0x3d
+	.byte	0xe
+	.long	0x107
+	.long	0xe4c
+	.uleb128 0x3
+	.long	0x107
+	.uleb128 0x3
+	.long	0x3f
+	.uleb128 0x3
+	.long	0x13e
+	.byte	0
+	.uleb128 0xc
+	.long	.LASF347
+	.byte	0x11
+	.value	0x343
+	.byte	0xc
+	.long	0x3f
+	.long	0xe63
+	.uleb128 0x3
+	.long	0xe63
+	.byte	0
+	.uleb128 0x9
+	.long	0x392
+	.uleb128 0xc
+	.long	.LASF348
+	.byte	0x11
+	.value	0x31a
+	.byte	0xc
+	.long	0x3f
+	.long	0xe7f
+	.uleb128 0x3
+	.long	0xe63
+	.byte	0
+	.uleb128 0x11
+	.long	.LASF349
+	.byte	0xe
+	.byte	0x43
+	.byte	0x6
+	.long	0x3f
+	.long	0xe9f
+	.uleb128 0x3
+	.long	0xc8d
+	.uleb128 0x3
+	.long	0xe9f
+	.uleb128 0x3
+	.long	0x3c1
+	.byte	0
+	.uleb128 0x9
+	.long	0xb9a
+	.uleb128 0x11
+	.long	.LASF350
+	.byte	0xe
+	.byte	0xd7
+	.byte	0x8
+	.long	0x13e
+	.long	0xece
+	.uleb128 0x3
+	.long	0xc92
+	.uleb128 0x3
+	.long	0x3c1
+	.uleb128 0x3
+	.long	0x13e
+	.uleb128 0x3
+	.long	0xe9f
+	.uleb128 0x3
+	.long	0x3c1
+	.byte	0
+	.uleb128 0xc
+	.long	.LASF351
+	.byte	0x11
+	.value	0x312
+	.byte	0xc
+	.long	0x3f
+	.long	0xee5
+	.uleb128 0x3
+	.long	0xe63
+	.byte	0
+	.uleb128 0x20
+	.long	.LASF367
+	.byte	0xf
+	.byte	0xb3
+	.long	0xf05
+	.uleb128 0x3
+	.long	0x54
+	.uleb128 0x3
+	.long	0x13e
+	.uleb128 0x3
+	.long	0xf05
+	.uleb128 0x3
+	.long	0x107
+	.byte	0
+	.uleb128 0x9
+	.long	0xf0a
+	.uleb128 0x41
+	.long	0xf1a
+	.uleb128 0x3
+	.long	0x107
+	.uleb128 0x3
+	.long	0x13e
+	.byte	0
+	.uleb128 0xc
+	.long	.LASF352
+	.byte	0x11
+	.value	0x30d
+	.byte	0xc
+	.long	0x3f
+	.long	0xf36
+	.uleb128 0x3
+	.long	0xe63
+	.uleb128 0x3
+	.long	0xf36
+	.byte	0
+	.uleb128 0x9
+	.long	0x354
+	.uleb128 0xc
+	.long	.LASF353
+	.byte	0x12
+	.value	0x257
+	.byte	0xc
+	.long	0x3f
+	.long	0xf5c
+	.uleb128 0x3
+	.long	0xf5c
+	.uleb128 0x3
+	.long	0x13e
+	.uleb128 0x3
+	.long	0x13e
+	.byte	0
+	.uleb128 0x9
+	.long	0x107
+	.uleb128 0x11
+	.long	.LASF354
+	.byte	0x13
+	.byte	0x4c
+	.byte	0xc
+	.long	0x3f
+	.long	0xf7c
+	.uleb128 0x3
+	.long	0x107
+	.uleb128 0x3
+	.long	0x13e
+	.byte	0
+	.uleb128 0x11
+	.long	.LASF355
+	.byte	0x13
+	.byte	0x5e
+	.byte	0xc
+	.long	0x3f
+	.long	0xf9c
+	.uleb128 0x3
+	.long	0x107
+	.uleb128 0x3
+	.long	0x13e
+	.uleb128 0x3
+	.long	0x3f
+	.byte	0
+	.uleb128 0x11
+	.long	.LASF356
+	.byte	0x13
+	.byte	0x39
+	.byte	0xe
+	.long	0x107
+	.long	0xfcb
+	.uleb128 0x3
+	.long	0x107
+	.uleb128 0x3
+	.long	0x13e
+	.uleb128 0x3
+	.long	0x3f
+	.uleb128 0x3
+	.long	0x3f
+	.uleb128 0x3
+	.long	0x3f
+	.uleb128 0x3
+	.long	0xe3
+	.byte	0
+	.uleb128 0xc
+	.long	.LASF357
+	.byte	0x4
+	.value	0x111
+	.byte	0xc
+	.long	0x3f
+	.long	0xff1
+	.uleb128 0x3
+	.long	0x3f
+	.uleb128 0x3
+	.long	0x14a
+	.uleb128 0x3
+	.long	0x14a
+	.uleb128 0x3
+	.long	0x3f
+	.byte	0
+	.uleb128 0xc
+	.long	.LASF358
+	.byte	0x14
+	.value	0x280
+	.byte	0x11
+	.long	0x88
+	.long	0x1008
+	.uleb128 0x3
+	.long	0x3f
+	.byte	0
+	.uleb128 0x11
+	.long	.LASF359
+	.byte	0x4
+	.byte	0xb5
+	.byte	0xc
+	.long	0x3f
+	.long	0x1024
+	.uleb128 0x3
+	.long	0x25f
+	.uleb128 0x3
+	.long	0x3f
+	.uleb128 0x32
+	.byte	0
+	.uleb128 0xc
+	.long	.LASF360
+	.byte	0x15
+	.value	0x17a
+	.byte	0xc
+	.long	0x3f
+	.long	0x1046
+	.uleb128 0x3
+	.long	0x2e
+	.uleb128 0x3
+	.long	0x13e
+	.uleb128 0x3
+	.long	0x25f
+	.uleb128 0x32
+	.byte	0
+	.uleb128 0xc
+	.long	.LASF361
+	.byte	0x15
+	.value	0x2e0
+	.byte	0xc
+	.long	0x3f
+	.long	0x1067
+	.uleb128 0x3
+	.long	0xaf3
+	.uleb128 0x3
+	.long	0xe3
+	.uleb128 0x3
+	.long	0x3f
+	.byte	0
+	.uleb128 0xc
+	.long	.LASF362
+	.byte	0x14
+	.value	0x166
+	.byte	0xc
+	.long	0x3f
+	.long	0x107e
+	.uleb128 0x3
+	.long	0x3f
+	.byte	0
+	.uleb128 0x11
+	.long	.LASF363
+	.byte	0xf
+	.byte	0xa3
+	.byte	0x5
+	.long	0x3f
+	.long	0x10ad
+	.uleb128 0x3
+	.long	0xc8d
+	.uleb128 0x3
+	.long	0x3f
+	.uleb128 0x3
+	.long	0x904
+	.uleb128 0x3
+	.long	0x904
+	.uleb128 0x3
+	.long	0x13e
+	.uleb128 0x3
+	.long	0x3f
+	.byte	0
+	.uleb128 0x11
+	.long	.LASF364
+	.byte	0xf
+	.byte	0xa1
+	.byte	0x5
+	.long	0x3f
+	.long	0x10e1
+	.uleb128 0x3
+	.long	0xc8d
+	.uleb128 0x3
+	.long	0xaf3
+	.uleb128 0x3
+	.long	0x3f
+	.uleb128 0x3
+	.long	0x904
+	.uleb128 0x3
+	.long	0x904
+	.uleb128 0x3
+	.long	0x13e
+	.uleb128 0x3
+	.long	0x3f
+	.byte	0
+	.uleb128 0xc
+	.long	.LASF365
+	.byte	0x15
+	.value	0x2e5
+	.byte	0x10
+	.long	0xe3
+	.long	0x10f8
+	.uleb128 0x3
+	.long	0xaf3
+	.byte	0
+	.uleb128 0x11
+	.long	.LASF366
+	.byte	0x16
+	.byte	0xd2
+	.byte	0xc
+	.long	0x3f
+	.long	0x1113
+	.uleb128 0x3
+	.long	0x3f
+	.uleb128 0x3
+	.long	0x1113
+	.byte	0
+	.uleb128 0x9
+	.long	0x17e
+	.uleb128 0x20
+	.long	.LASF368
+	.byte	0xe
+	.byte	0x2a
+	.long	0x1129
+	.uleb128 0x3
+	.long	0xc8d
+	.byte	0
+	.uleb128 0xc
+	.long	.LASF369
+	.byte	0x15
+	.value	0x329
+	.byte	0xc
+	.long	0x3f
+	.long	0x1140
+	.uleb128 0x3
+	.long	0xaf3
+	.byte	0
+	.uleb128 0x20
+	.long	.LASF370
+	.byte	0xe
+	.byte	0x47
+	.long	0x1156
+	.uleb128 0x3
+	.long	0xc8d
+	.uleb128 0x3
+	.long	0xc92
+	.byte	0
+	.uleb128 0x20
+	.long	.LASF371
+	.byte	0xe
+	.byte	0x46
+	.long	0x1171
+	.uleb128 0x3
+	.long	0xc8d
+	.uleb128 0x3
+	.long	0x3c1
+	.uleb128 0x3
+	.long	0x13e
+	.byte	0
+	.uleb128 0x42
+	.long	.LASF372
+	.byte	0x12
+	.value	0x238
+	.byte	0xd
+	.long	0x1184
+	.uleb128 0x3
+	.long	0x107
+	.byte	0
+	.uleb128 0xc
+	.long	.LASF373
+	.byte	0x15
+	.value	0x316
+	.byte	0xc
+	.long	0x3f
+	.long	0x119b
+	.uleb128 0x3
+	.long	0xaf3
+	.byte	0
+	.uleb128 0xc
+	.long	.LASF374
+	.byte	0x15
+	.value	0x2a3
+	.byte	0xf
+	.long	0x13e
+	.long	0x11c1
+	.uleb128 0x3
+	.long	0x109
+	.uleb128 0x3
+	.long	0x13e
+	.uleb128 0x3
+	.long	0x13e
+	.uleb128 0x3
+	.long	0xaf8
+	.byte	0
+	.uleb128 0xc
+	.long	.LASF375
+	.byte	0x12
+	.value	0x229
+	.byte	0xe
+	.long	0x107
+	.long	0x11d8
+	.uleb128 0x3
+	.long	0x13e
+	.byte	0
+	.uleb128 0x43
+	.long	.LASF403
+	.byte	0x18
+	.byte	0x25
+	.byte	0xd
+	.long	0x11e4
+	.uleb128 0x9
+	.long	0x3f
+	.uleb128 0xc
+	.long	.LASF376
+	.byte	0x14
+	.value	0x185
+	.byte	0x10
+	.long	0x3b5
+	.long	0x120f
+	.uleb128 0x3
+	.long	0x3f
+	.uleb128 0x3
+	.long	0x107
+	.uleb128 0x3
+	.long	0x13e
+	.uleb128 0x3
+	.long	0xe3
+	.byte	0
+	.uleb128 0x44
+	.long	.LASF383
+	.byte	0x1
+	.value	0x160
+	.byte	0x5
+	.long	0x3f
+	.quad	.LFB46
+	.quad	.LFE46-.LFB46
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0x14ff
+	.uleb128 0x15
+	.string	"out"
+	.value	0x160
+	.byte	0x26
+	.long	0xc92
+	.long	.LLST113
+	.long	.LVUS113
+	.uleb128 0x33
+	.long	.LASF377
+	.byte	0x31
+	.long	0xaf3
+	.long	.LLST114
+	.long	.LVUS114
+	.uleb128 0x33
+	.long	.LASF378
+	.byte	0x42
+	.long	0x54
+	.long	.LLST115
+	.long	.LVUS115
+	.uleb128 0x21
+	.string	"J"
+	.value	0x162
+	.byte	0x16
+	.long	0xdbe
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -400
+	.uleb128 0x21
+	.string	"P"
+	.value	0x163
+	.byte	0x1a
+	.long	0xafd
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -464
+	.uleb128 0x29
+	.long	.LASF379
+	.value	0x164
+	.byte	0x18
+	.long	0xbe9
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -320
+	.uleb128 0x21
+	.string	"st"
+	.value	0x165
+	.byte	0x11
+	.long	0x17e
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -192
+	.uleb128 0x12
+	.string	"up"
+	.value	0x166
+	.byte	0x15
+	.long	0xe27
+	.long	.LLST116
+	.long	.LVUS116
+	.uleb128 0x12
+	.string	"n"
+	.value	0x167
+	.byte	0xc
+	.long	0x13e
+	.long	.LLST117
+	.long	.LVUS117
+	.uleb128 0x2a
+	.long	.LLRL125
+	.long	0x12f5
+	.uleb128 0x12
+	.string	"odd"
+	.value	0x186
+	.byte	0x11
+	.long	0x3f
+	.long	.LLST126
+	.long	.LVUS126
+	.uleb128 0x8
+	.quad	.LVL326
+	.long	0xea4
+	.byte	0
+	.uleb128 0x22
+	.long	0x19f8
+	.quad	.LBI159
+	.value	.LVU847
+	.long	.LLRL118
+	.value	0x172
+	.byte	0xf
+	.long	0x133d
+	.uleb128 0x6
+	.long	0x1a0a
+	.long	.LLST119
+	.long	.LVUS119
+	.uleb128 0x16
+	.long	.LLRL118
+	.uleb128 0xa
+	.long	0x1a16
+	.long	.LLST120
+	.long	.LVUS120
+	.uleb128 0xa
+	.long	0x1a23
+	.long	.LLST121
+	.long	.LVUS121
+	.byte	0
+	.byte	0
+	.uleb128 0x22
+	.long	0x19cd
+	.quad	.LBI170
+	.value	.LVU869
+	.long	.LLRL122
+	.value	0x181
+	.byte	0x9
+	.long	0x1372
+	.uleb128 0x6
+	.long	0x19e6
+	.long	.LLST123
+	.long	.LVUS123
+	.uleb128 0x6
+	.long	0x19db
+	.long	.LLST124
+	.long	.LVUS124
+	.byte	0
+	.uleb128 0x5
+	.quad	.LVL291
+	.long	0x1129
+	.long	0x138b
+	.uleb128 0x2
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x3
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0
+	.uleb128 0x5
+	.quad	.LVL292
+	.long	0x10f8
+	.long	0x13a4
+	.uleb128 0x2
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -192
+	.byte	0
+	.uleb128 0x8
+	.quad	.LVL293
+	.long	0x11d8
+	.uleb128 0x8
+	.quad	.LVL297
+	.long	0x11c1
+	.uleb128 0x5
+	.quad	.LVL298
+	.long	0x11c1
+	.long	0x13d6
+	.uleb128 0x2
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x7c
+	.sleb128 0
+	.byte	0
+	.uleb128 0x5
+	.quad	.LVL300
+	.long	0xf1a
+	.long	0x13f3
+	.uleb128 0x2
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x7d
+	.sleb128 0
+	.uleb128 0x2
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x1
+	.byte	0x30
+	.byte	0
+	.uleb128 0x5
+	.quad	.LVL301
+	.long	0xee5
+	.long	0x141e
+	.uleb128 0x2
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x73
+	.sleb128 0
+	.uleb128 0x2
+	.uleb128 0x1
+	.byte	0x51
+	.uleb128 0x9
+	.byte	0x3
+	.quad	bfile_task
+	.uleb128 0x2
+	.uleb128 0x1
+	.byte	0x52
+	.uleb128 0x2
+	.byte	0x7e
+	.sleb128 0
+	.byte	0
+	.uleb128 0x5
+	.quad	.LVL302
+	.long	0xece
+	.long	0x1436
+	.uleb128 0x2
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x7d
+	.sleb128 0
+	.byte	0
+	.uleb128 0x8
+	.quad	.LVL304
+	.long	0x1171
+	.uleb128 0x5
+	.quad	.LVL305
+	.long	0x1171
+	.long	0x145b
+	.uleb128 0x2
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x7c
+	.sleb128 0
+	.byte	0
+	.uleb128 0x8
+	.quad	.LVL306
+	.long	0x11d8
+	.uleb128 0x5
+	.quad	.LVL329
+	.long	0xe7f
+	.long	0x148b
+	.uleb128 0x2
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x7e
+	.sleb128 0
+	.uleb128 0x2
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x2
+	.byte	0x7d
+	.sleb128 0
+	.uleb128 0x2
+	.uleb128 0x1
+	.byte	0x51
+	.uleb128 0x1
+	.byte	0x30
+	.byte	0
+	.uleb128 0x5
+	.quad	.LVL332
+	.long	0x1156
+	.long	0x14a3
+	.uleb128 0x2
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x7e
+	.sleb128 0
+	.byte	0
+	.uleb128 0x5
+	.quad	.LVL333
+	.long	0x1140
+	.long	0x14c1
+	.uleb128 0x2
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x7e
+	.sleb128 0
+	.uleb128 0x2
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x2
+	.byte	0x76
+	.sleb128 0
+	.byte	0
+	.uleb128 0x5
+	.quad	.LVL336
+	.long	0x1171
+	.long	0x14d9
+	.uleb128 0x2
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x7d
+	.sleb128 0
+	.byte	0
+	.uleb128 0x5
+	.quad	.LVL337
+	.long	0x1171
+	.long	0x14f1
+	.uleb128 0x2
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x7c
+	.sleb128 0
+	.byte	0
+	.uleb128 0x8
+	.quad	.LVL338
+	.long	0x11d8
+	.byte	0
+	.uleb128 0x45
+	.long	.LASF404
+	.byte	0x1
+	.value	0x146
+	.byte	0xd
+	.quad	.LFB45
+	.quad	.LFE45-.LFB45
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0x165e
+	.uleb128 0x15
+	.string	"arg"
+	.value	0x146
+	.byte	0x1e
+	.long	0x107
+	.long	.LLST21
+	.long	.LVUS21
+	.uleb128 0x15
+	.string	"s"
+	.value	0x146
+	.byte	0x2a
+	.long	0x13e
+	.long	.LLST22
+	.long	.LVUS22
+	.uleb128 0x12
+	.string	"J"
+	.value	0x148
+	.byte	0x17
+	.long	0x165e
+	.long	.LLST23
+	.long	.LVUS23
+	.uleb128 0x12
+	.string	"buf"
+	.value	0x149
+	.byte	0x14
+	.long	0xc92
+	.long	.LLST24
+	.long	.LVUS24
+	.uleb128 0x12
+	.string	"err"
+	.value	0x14a
+	.byte	0x9
+	.long	0x3f
+	.long	.LLST25
+	.long	.LVUS25
+	.uleb128 0x5
+	.quad	.LVL45
+	.long	0xe68
+	.long	0x1596
+	.uleb128 0x2
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x76
+	.sleb128 0
+	.byte	0
+	.uleb128 0x5
+	.quad	.LVL47
+	.long	0xe4c
+	.long	0x15ae
+	.uleb128 0x2
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x76
+	.sleb128 0
+	.byte	0
+	.uleb128 0x5
+	.quad	.LVL53
+	.long	0x11c1
+	.long	0x15c7
+	.uleb128 0x2
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x3
+	.byte	0x40
+	.byte	0x40
+	.byte	0x24
+	.byte	0
+	.uleb128 0x5
+	.quad	.LVL55
+	.long	0x1663
+	.long	0x15eb
+	.uleb128 0x2
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x73
+	.sleb128 0
+	.uleb128 0x2
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x2
+	.byte	0x7d
+	.sleb128 0
+	.uleb128 0x2
+	.uleb128 0x1
+	.byte	0x51
+	.uleb128 0x2
+	.byte	0x7c
+	.sleb128 0
+	.byte	0
+	.uleb128 0x46
+	.quad	.LVL61
+	.long	0x1171
+	.uleb128 0x8
+	.quad	.LVL62
+	.long	0x11d8
+	.uleb128 0x5
+	.quad	.LVL65
+	.long	0x1171
+	.long	0x161d
+	.uleb128 0x2
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x7c
+	.sleb128 0
+	.byte	0
+	.uleb128 0x5
+	.quad	.LVL67
+	.long	0xe68
+	.long	0x1635
+	.uleb128 0x2
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x76
+	.sleb128 0
+	.byte	0
+	.uleb128 0x47
+	.quad	.LVL71
+	.long	0xe4c
+	.long	0x1650
+	.uleb128 0x2
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x5
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x23
+	.uleb128 0x20
+	.byte	0
+	.uleb128 0x8
+	.quad	.LVL72
+	.long	0x1171
+	.byte	0
+	.uleb128 0x9
+	.long	0xdbe
+	.uleb128 0x48
+	.long	.LASF388
+	.byte	0x1
+	.value	0x120
+	.byte	0xc
+	.long	0x3f
+	.quad	.LFB44
+	.quad	.LFE44-.LFB44
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0x19b7
+	.uleb128 0x15
+	.string	"J"
+	.value	0x120
+	.byte	0x2c
+	.long	0x165e
+	.long	.LLST0
+	.long	.LVUS0
+	.uleb128 0x15
+	.string	"s"
+	.value	0x120
+	.byte	0x36
+	.long	0x13e
+	.long	.LLST1
+	.long	.LVUS1
+	.uleb128 0x15
+	.string	"buf"
+	.value	0x120
+	.byte	0x48
+	.long	0xc92
+	.long	.LLST2
+	.long	.LVUS2
+	.uleb128 0x15
+	.string	"out"
+	.value	0x121
+	.byte	0x29
+	.long	0xc92
+	.long	.LLST3
+	.long	.LVUS3
+	.uleb128 0x29
+	.long	.LASF380
+	.value	0x123
+	.byte	0x13
+	.long	0x19b7
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -576
+	.uleb128 0x21
+	.string	"P"
+	.value	0x124
+	.byte	0x1a
+	.long	0xafd
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -768
+	.uleb128 0x29
+	.long	.LASF381
+	.value	0x125
+	.byte	0x18
+	.long	0xbe9
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -704
+	.uleb128 0x12
+	.string	"off"
+	.value	0x126
+	.byte	0xb
+	.long	0x14a
+	.long	.LLST4
+	.long	.LVUS4
+	.uleb128 0x12
+	.string	"end"
+	.value	0x127
+	.byte	0xb
+	.long	0x14a
+	.long	.LLST5
+	.long	.LVUS5
+	.uleb128 0x2a
+	.long	.LLRL9
+	.long	0x193c
+	.uleb128 0x49
+	.long	.LASF382
+	.byte	0x1
+	.value	0x133
+	.byte	0x10
+	.long	0x13e
+	.long	.LLST10
+	.long	.LVUS10
+	.uleb128 0x12
+	.string	"got"
+	.value	0x134
+	.byte	0x11
+	.long	0x3b5
+	.long	.LLST11
+	.long	.LVUS11
+	.uleb128 0x12
+	.string	"n"
+	.value	0x135
+	.byte	0x10
+	.long	0x13e
+	.long	.LLST12
+	.long	.LVUS12
+	.uleb128 0x22
+	.long	0x2872
+	.quad	.LBI37
+	.value	.LVU68
+	.long	.LLRL13
+	.value	0x134
+	.byte	0x17
+	.long	0x1825
+	.uleb128 0x6
+	.long	0x28a1
+	.long	.LLST14
+	.long	.LVUS14
+	.uleb128 0x6
+	.long	0x2896
+	.long	.LLST15
+	.long	.LVUS15
+	.uleb128 0x6
+	.long	0x288b
+	.long	.LLST16
+	.long	.LVUS16
+	.uleb128 0x6
+	.long	0x2881
+	.long	.LLST17
+	.long	.LVUS17
+	.uleb128 0x16
+	.long	.LLRL13
+	.uleb128 0xa
+	.long	0x28ac
+	.long	.LLST18
+	.long	.LVUS18
+	.uleb128 0x23
+	.long	0x28b7
+	.long	.LLRL19
+	.uleb128 0xa
+	.long	0x28b8
+	.long	.LLST20
+	.long	.LVUS20
+	.uleb128 0x5
+	.quad	.LVL16
+	.long	0x11e9
+	.long	0x1815
+	.uleb128 0x2
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x7d
+	.sleb128 0
+	.uleb128 0x2
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x5
+	.byte	0x7c
+	.sleb128 0
+	.byte	0x7f
+	.sleb128 0
+	.byte	0x22
+	.uleb128 0x2
+	.uleb128 0x1
+	.byte	0x51
+	.uleb128 0x5
+	.byte	0x73
+	.sleb128 0
+	.byte	0x7f
+	.sleb128 0
+	.byte	0x1c
+	.uleb128 0x2
+	.uleb128 0x1
+	.byte	0x52
+	.uleb128 0x5
+	.byte	0x76
+	.sleb128 0
+	.byte	0x7f
+	.sleb128 0
+	.byte	0x22
+	.byte	0
+	.uleb128 0x8
+	.quad	.LVL17
+	.long	0x11d8
+	.byte	0
+	.byte	0
+	.byte	0
+	.uleb128 0x5
+	.quad	.LVL26
+	.long	0xea4
+	.long	0x186e
+	.uleb128 0x2
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x73
+	.sleb128 0
+	.uleb128 0x2
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x2
+	.byte	0x7c
+	.sleb128 0
+	.uleb128 0x2
+	.uleb128 0x1
+	.byte	0x51
+	.uleb128 0x1a
+	.byte	0x91
+	.sleb128 -808
+	.byte	0x6
+	.byte	0x76
+	.sleb128 0
+	.byte	0x1c
+	.byte	0x40
+	.byte	0x40
+	.byte	0x24
+	.byte	0x91
+	.sleb128 -808
+	.byte	0x6
+	.byte	0x76
+	.sleb128 0
+	.byte	0x1c
+	.byte	0x40
+	.byte	0x40
+	.byte	0x24
+	.byte	0x2c
+	.byte	0x28
+	.value	0x1
+	.byte	0x16
+	.byte	0x13
+	.uleb128 0x2
+	.uleb128 0x1
+	.byte	0x52
+	.uleb128 0x4
+	.byte	0x91
+	.sleb128 -792
+	.byte	0x6
+	.uleb128 0x2
+	.uleb128 0x1
+	.byte	0x58
+	.uleb128 0x1
+	.byte	0x30
+	.byte	0
+	.uleb128 0x5
+	.quad	.LVL28
+	.long	0x1156
+	.long	0x188e
+	.uleb128 0x2
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x4
+	.byte	0x91
+	.sleb128 -800
+	.byte	0x6
+	.uleb128 0x2
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x2
+	.byte	0x73
+	.sleb128 0
+	.byte	0
+	.uleb128 0x5
+	.quad	.LVL32
+	.long	0xea4
+	.long	0x18be
+	.uleb128 0x2
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x73
+	.sleb128 0
+	.uleb128 0x2
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x2
+	.byte	0x7c
+	.sleb128 0
+	.uleb128 0x2
+	.uleb128 0x1
+	.byte	0x51
+	.uleb128 0x1
+	.byte	0x30
+	.uleb128 0x2
+	.uleb128 0x1
+	.byte	0x52
+	.uleb128 0x4
+	.byte	0x91
+	.sleb128 -792
+	.byte	0x6
+	.uleb128 0x2
+	.uleb128 0x1
+	.byte	0x58
+	.uleb128 0x1
+	.byte	0x30
+	.byte	0
+	.uleb128 0x5
+	.quad	.LVL34
+	.long	0x1156
+	.long	0x18de
+	.uleb128 0x2
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x4
+	.byte	0x91
+	.sleb128 -800
+	.byte	0x6
+	.uleb128 0x2
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x2
+	.byte	0x73
+	.sleb128 0
+	.byte	0
+	.uleb128 0x5
+	.quad	.LVL36
+	.long	0xea4
+	.long	0x190e
+	.uleb128 0x2
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x73
+	.sleb128 0
+	.uleb128 0x2
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x2
+	.byte	0x7c
+	.sleb128 0
+	.uleb128 0x2
+	.uleb128 0x1
+	.byte	0x51
+	.uleb128 0x1
+	.byte	0x30
+	.uleb128 0x2
+	.uleb128 0x1
+	.byte	0x52
+	.uleb128 0x4
+	.byte	0x91
+	.sleb128 -792
+	.byte	0x6
+	.uleb128 0x2
+	.uleb128 0x1
+	.byte	0x58
+	.uleb128 0x1
+	.byte	0x30
+	.byte	0
+	.uleb128 0x5
+	.quad	.LVL38
+	.long	0x1156
+	.long	0x192e
+	.uleb128 0x2
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x4
+	.byte	0x91
+	.sleb128 -800
+	.byte	0x6
+	.uleb128 0x2
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x2
+	.byte	0x73
+	.sleb128 0
+	.byte	0
+	.uleb128 0x8
+	.quad	.LVL40
+	.long	0x11d8
+	.byte	0
+	.uleb128 0x22
+	.long	0x19cd
+	.quad	.LBI16
+	.value	.LVU24
+	.long	.LLRL6
+	.value	0x12a
+	.byte	0x5
+	.long	0x1971
+	.uleb128 0x6
+	.long	0x19e6
+	.long	.LLST7
+	.long	.LVUS7
+	.uleb128 0x6
+	.long	0x19db
+	.long	.LLST8
+	.long	.LVUS8
+	.byte	0
+	.uleb128 0x5
+	.quad	.LVL10
+	.long	0xe7f
+	.long	0x1998
+	.uleb128 0x2
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x4
+	.byte	0x91
+	.sleb128 -800
+	.byte	0x6
+	.uleb128 0x2
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x4
+	.byte	0x91
+	.sleb128 -792
+	.byte	0x6
+	.uleb128 0x2
+	.uleb128 0x1
+	.byte	0x51
+	.uleb128 0x1
+	.byte	0x30
+	.byte	0
+	.uleb128 0xf
+	.quad	.LVL42
+	.long	0x1140
+	.uleb128 0x2
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x4
+	.byte	0x91
+	.sleb128 -800
+	.byte	0x6
+	.uleb128 0x2
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x4
+	.byte	0x91
+	.sleb128 -776
+	.byte	0x6
+	.byte	0
+	.byte	0
+	.uleb128 0xd
+	.long	0x46
+	.long	0x19cd
+	.uleb128 0xb
+	.long	0x5b
+	.byte	0xf
+	.uleb128 0xb
+	.long	0x5b
+	.byte	0x1f
+	.byte	0
+	.uleb128 0x4a
+	.long	.LASF405
+	.byte	0x1
+	.value	0x116
+	.byte	0xd
+	.byte	0x1
+	.long	0x19f3
+	.uleb128 0x4b
+	.string	"P"
+	.byte	0x1
+	.value	0x116
+	.byte	0x2f
+	.long	0x19f3
+	.uleb128 0x34
+	.long	.LASF326
+	.value	0x116
+	.byte	0x3b
+	.long	0x54
+	.byte	0
+	.uleb128 0x9
+	.long	0xafd
+	.uleb128 0x4c
+	.long	.LASF390
+	.byte	0x1
+	.value	0x10a
+	.byte	0x11
+	.long	0x54
+	.byte	0x1
+	.long	0x1a31
+	.uleb128 0x34
+	.long	.LASF343
+	.value	0x10a
+	.byte	0x24
+	.long	0x13e
+	.uleb128 0x4d
+	.long	.LASF326
+	.byte	0x1
+	.value	0x10c
+	.byte	0xe
+	.long	0x54
+	.uleb128 0x4e
+	.string	"top"
+	.byte	0x1
+	.value	0x10d
+	.byte	0xc
+	.long	0x13e
+	.byte	0
+	.uleb128 0x35
+	.long	.LASF384
+	.byte	0xea
+	.long	0x3f
+	.quad	.LFB41
+	.quad	.LFE41-.LFB41
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0x1a99
+	.uleb128 0x18
+	.string	"out"
+	.byte	0xea
+	.byte	0x21
+	.long	0xc92
+	.long	.LLST111
+	.long	.LVUS111
+	.uleb128 0x2b
+	.long	.LASF377
+	.byte	0xea
+	.byte	0x2c
+	.long	0xaf3
+	.long	.LLST112
+	.long	.LVUS112
+	.uleb128 0x4f
+	.quad	.LVL288
+	.long	0x1a99
+	.uleb128 0x2
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x3
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x3
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x2
+	.uleb128 0x1
+	.byte	0x51
+	.uleb128 0x1
+	.byte	0x30
+	.byte	0
+	.byte	0
+	.uleb128 0x35
+	.long	.LASF385
+	.byte	0xa9
+	.long	0x3f
+	.quad	.LFB40
+	.quad	.LFE40-.LFB40
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0x2570
+	.uleb128 0x18
+	.string	"out"
+	.byte	0xa9
+	.byte	0x24
+	.long	0xc92
+	.long	.LLST54
+	.long	.LVUS54
+	.uleb128 0x2b
+	.long	.LASF377
+	.byte	0xa9
+	.byte	0x2f
+	.long	0xaf3
+	.long	.LLST55
+	.long	.LVUS55
+	.uleb128 0x18
+	.string	"io"
+	.byte	0xaa
+	.byte	0x2e
+	.long	0x2570
+	.long	.LLST56
+	.long	.LVUS56
+	.uleb128 0x50
+	.long	.LASF386
+	.byte	0x1
+	.byte	0xac
+	.byte	0x24
+	.long	0xbe4
+	.uleb128 0x9
+	.byte	0x3
+	.quad	defaults.0
+	.uleb128 0x24
+	.string	"ctx"
+	.byte	0xad
+	.byte	0x18
+	.long	0xbe9
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -336
+	.uleb128 0x24
+	.string	"st"
+	.byte	0xae
+	.byte	0x11
+	.long	0x17e
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -208
+	.uleb128 0x19
+	.string	"fd"
+	.byte	0xaf
+	.byte	0x9
+	.long	0x3f
+	.long	.LLST57
+	.long	.LVUS57
+	.uleb128 0x36
+	.long	.LASF387
+	.byte	0xb0
+	.byte	0x9
+	.long	0x3f
+	.long	.LLST58
+	.long	.LVUS58
+	.uleb128 0x19
+	.string	"src"
+	.byte	0xb0
+	.byte	0x11
+	.long	0x3f
+	.long	.LLST59
+	.long	.LVUS59
+	.uleb128 0x19
+	.string	"ret"
+	.byte	0xb0
+	.byte	0x16
+	.long	0x3f
+	.long	.LLST60
+	.long	.LVUS60
+	.uleb128 0x36
+	.long	.LASF337
+	.byte	0xb1
+	.byte	0xc
+	.long	0x13e
+	.long	.LLST61
+	.long	.LVUS61
+	.uleb128 0x24
+	.string	"off"
+	.byte	0xb2
+	.byte	0xb
+	.long	0x14a
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -376
+	.uleb128 0x2a
+	.long	.LLRL102
+	.long	0x1c3d
+	.uleb128 0x19
+	.string	"err"
+	.byte	0xe1
+	.byte	0xd
+	.long	0x3f
+	.long	.LLST103
+	.long	.LVUS103
+	.uleb128 0x8
+	.quad	.LVL207
+	.long	0x11d8
+	.uleb128 0x5
+	.quad	.LVL210
+	.long	0x1067
+	.long	0x1bd5
+	.uleb128 0x2
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x5
+	.byte	0x91
+	.sleb128 -440
+	.byte	0x94
+	.byte	0x4
+	.byte	0
+	.uleb128 0x8
+	.quad	.LVL226
+	.long	0x11d8
+	.uleb128 0x5
+	.quad	.LVL228
+	.long	0x1067
+	.long	0x1bfd
+	.uleb128 0x2
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x5
+	.byte	0x91
+	.sleb128 -440
+	.byte	0x94
+	.byte	0x4
+	.byte	0
+	.uleb128 0x8
+	.quad	.LVL260
+	.long	0x11d8
+	.uleb128 0x5
+	.quad	.LVL262
+	.long	0x1067
+	.long	0x1c25
+	.uleb128 0x2
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x5
+	.byte	0x91
+	.sleb128 -440
+	.byte	0x94
+	.byte	0x4
+	.byte	0
+	.uleb128 0xf
+	.quad	.LVL281
+	.long	0x1067
+	.uleb128 0x2
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x5
+	.byte	0x91
+	.sleb128 -440
+	.byte	0x94
+	.byte	0x4
+	.byte	0
+	.byte	0
+	.uleb128 0x2c
+	.long	0x273e
+	.quad	.LBI91
+	.value	.LVU416
+	.quad	.LBB91
+	.quad	.LBE91-.LBB91
+	.byte	0xc8
+	.byte	0x10
+	.long	0x1d16
+	.uleb128 0x6
+	.long	0x276e
+	.long	.LLST62
+	.long	.LVUS62
+	.uleb128 0x6
+	.long	0x2763
+	.long	.LLST63
+	.long	.LVUS63
+	.uleb128 0x6
+	.long	0x2758
+	.long	.LLST64
+	.long	.LVUS64
+	.uleb128 0x6
+	.long	0x274d
+	.long	.LLST65
+	.long	.LVUS65
+	.uleb128 0xa
+	.long	0x2779
+	.long	.LLST66
+	.long	.LVUS66
+	.uleb128 0x1a
+	.long	0x2784
+	.long	.LLRL67
+	.long	0x1d01
+	.uleb128 0xa
+	.long	0x2785
+	.long	.LLST68
+	.long	.LVUS68
+	.uleb128 0x5
+	.quad	.LVL150
+	.long	0x1156
+	.long	0x1cdb
+	.uleb128 0x2
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x7c
+	.sleb128 0
+	.uleb128 0x2
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x2
+	.byte	0x7d
+	.sleb128 0
+	.byte	0
+	.uleb128 0xf
+	.quad	.LVL151
+	.long	0x119b
+	.uleb128 0x2
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x7d
+	.sleb128 0
+	.uleb128 0x2
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x1
+	.byte	0x31
+	.uleb128 0x2
+	.uleb128 0x1
+	.byte	0x51
+	.uleb128 0x2
+	.byte	0x76
+	.sleb128 0
+	.uleb128 0x2
+	.uleb128 0x1
+	.byte	0x52
+	.uleb128 0x2
+	.byte	0x73
+	.sleb128 0
+	.byte	0
+	.byte	0
+	.uleb128 0xf
+	.quad	.LVL147
+	.long	0x11c1
+	.uleb128 0x2
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x76
+	.sleb128 0
+	.byte	0
+	.byte	0
+	.uleb128 0x25
+	.long	0x273e
+	.quad	.LBI95
+	.value	.LVU592
+	.long	.LLRL69
+	.byte	0xe7
+	.byte	0xc
+	.long	0x1e55
+	.uleb128 0x6
+	.long	0x276e
+	.long	.LLST70
+	.long	.LVUS70
+	.uleb128 0x6
+	.long	0x2763
+	.long	.LLST71
+	.long	.LVUS71
+	.uleb128 0x6
+	.long	0x2758
+	.long	.LLST72
+	.long	.LVUS72
+	.uleb128 0x6
+	.long	0x274d
+	.long	.LLST73
+	.long	.LVUS73
+	.uleb128 0x16
+	.long	.LLRL69
+	.uleb128 0xa
+	.long	0x2779
+	.long	.LLST74
+	.long	.LVUS74
+	.uleb128 0x1a
+	.long	0x2784
+	.long	.LLRL75
+	.long	0x1dfa
+	.uleb128 0xa
+	.long	0x2785
+	.long	.LLST76
+	.long	.LVUS76
+	.uleb128 0x5
+	.quad	.LVL154
+	.long	0x1184
+	.long	0x1da9
+	.uleb128 0x2
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x4
+	.byte	0x91
+	.sleb128 -456
+	.byte	0x6
+	.byte	0
+	.uleb128 0x8
+	.quad	.LVL190
+	.long	0x1171
+	.uleb128 0x5
+	.quad	.LVL217
+	.long	0x1156
+	.long	0x1dd4
+	.uleb128 0x2
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x7c
+	.sleb128 0
+	.uleb128 0x2
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x2
+	.byte	0x7d
+	.sleb128 0
+	.byte	0
+	.uleb128 0xf
+	.quad	.LVL218
+	.long	0x119b
+	.uleb128 0x2
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x7d
+	.sleb128 0
+	.uleb128 0x2
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x1
+	.byte	0x31
+	.uleb128 0x2
+	.uleb128 0x1
+	.byte	0x51
+	.uleb128 0x2
+	.byte	0x76
+	.sleb128 0
+	.uleb128 0x2
+	.uleb128 0x1
+	.byte	0x52
+	.uleb128 0x2
+	.byte	0x73
+	.sleb128 0
+	.byte	0
+	.byte	0
+	.uleb128 0x5
+	.quad	.LVL155
+	.long	0x1171
+	.long	0x1e12
+	.uleb128 0x2
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x7d
+	.sleb128 0
+	.byte	0
+	.uleb128 0x5
+	.quad	.LVL156
+	.long	0x1140
+	.long	0x1e32
+	.uleb128 0x2
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x7c
+	.sleb128 0
+	.uleb128 0x2
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x4
+	.byte	0x91
+	.sleb128 -448
+	.byte	0x6
+	.byte	0
+	.uleb128 0x8
+	.quad	.LVL189
+	.long	0x11d8
+	.uleb128 0xf
+	.quad	.LVL214
+	.long	0x11c1
+	.uleb128 0x2
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x76
+	.sleb128 0
+	.byte	0
+	.byte	0
+	.byte	0
+	.uleb128 0x25
+	.long	0x2903
+	.quad	.LBI103
+	.value	.LVU475
+	.long	.LLRL77
+	.byte	0xdd
+	.byte	0x13
+	.long	0x203b
+	.uleb128 0x6
+	.long	0x2932
+	.long	.LLST78
+	.long	.LVUS78
+	.uleb128 0x6
+	.long	0x2927
+	.long	.LLST79
+	.long	.LVUS79
+	.uleb128 0x6
+	.long	0x291d
+	.long	.LLST80
+	.long	.LVUS80
+	.uleb128 0x6
+	.long	0x2912
+	.long	.LLST81
+	.long	.LVUS81
+	.uleb128 0x16
+	.long	.LLRL77
+	.uleb128 0xa
+	.long	0x293d
+	.long	.LLST82
+	.long	.LVUS82
+	.uleb128 0x1a
+	.long	0x2948
+	.long	.LLRL83
+	.long	0x1fab
+	.uleb128 0xa
+	.long	0x2949
+	.long	.LLST84
+	.long	.LVUS84
+	.uleb128 0xa
+	.long	0x2954
+	.long	.LLST85
+	.long	.LVUS85
+	.uleb128 0xa
+	.long	0x295f
+	.long	.LLST86
+	.long	.LVUS86
+	.uleb128 0x5
+	.quad	.LVL174
+	.long	0xf7c
+	.long	0x1f0b
+	.uleb128 0x2
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x76
+	.sleb128 0
+	.uleb128 0x2
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x2
+	.byte	0x73
+	.sleb128 0
+	.uleb128 0x2
+	.uleb128 0x1
+	.byte	0x51
+	.uleb128 0x1
+	.byte	0x32
+	.byte	0
+	.uleb128 0x5
+	.quad	.LVL175
+	.long	0xf7c
+	.long	0x1f2e
+	.uleb128 0x2
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x76
+	.sleb128 0
+	.uleb128 0x2
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x2
+	.byte	0x73
+	.sleb128 0
+	.uleb128 0x2
+	.uleb128 0x1
+	.byte	0x51
+	.uleb128 0x1
+	.byte	0x3e
+	.byte	0
+	.uleb128 0x5
+	.quad	.LVL176
+	.long	0x1156
+	.long	0x1f5a
+	.uleb128 0x2
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x4
+	.byte	0x91
+	.sleb128 -432
+	.byte	0x6
+	.uleb128 0x2
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x5
+	.byte	0x76
+	.sleb128 0
+	.byte	0x7e
+	.sleb128 0
+	.byte	0x22
+	.uleb128 0x2
+	.uleb128 0x1
+	.byte	0x51
+	.uleb128 0x5
+	.byte	0x73
+	.sleb128 0
+	.byte	0x7e
+	.sleb128 0
+	.byte	0x1c
+	.byte	0
+	.uleb128 0x5
+	.quad	.LVL177
+	.long	0xf61
+	.long	0x1f78
+	.uleb128 0x2
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x76
+	.sleb128 0
+	.uleb128 0x2
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x2
+	.byte	0x73
+	.sleb128 0
+	.byte	0
+	.uleb128 0xf
+	.quad	.LVL182
+	.long	0xf9c
+	.uleb128 0x2
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x1
+	.byte	0x30
+	.uleb128 0x2
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x2
+	.byte	0x73
+	.sleb128 0
+	.uleb128 0x2
+	.uleb128 0x1
+	.byte	0x51
+	.uleb128 0x1
+	.byte	0x31
+	.uleb128 0x2
+	.uleb128 0x1
+	.byte	0x52
+	.uleb128 0x1
+	.byte	0x31
+	.uleb128 0x2
+	.uleb128 0x1
+	.byte	0x58
+	.uleb128 0x5
+	.byte	0x91
+	.sleb128 -416
+	.byte	0x94
+	.byte	0x4
+	.uleb128 0x2
+	.uleb128 0x1
+	.byte	0x59
+	.uleb128 0x2
+	.byte	0x7d
+	.sleb128 0
+	.byte	0
+	.byte	0
+	.uleb128 0x5
+	.quad	.LVL167
+	.long	0xff1
+	.long	0x1fc2
+	.uleb128 0x2
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x1
+	.byte	0x4e
+	.byte	0
+	.uleb128 0x5
+	.quad	.LVL169
+	.long	0xfcb
+	.long	0x1ff4
+	.uleb128 0x2
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x7d
+	.sleb128 0
+	.uleb128 0x2
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x4
+	.byte	0x91
+	.sleb128 -440
+	.byte	0x6
+	.uleb128 0x2
+	.uleb128 0x1
+	.byte	0x51
+	.uleb128 0x9
+	.byte	0x91
+	.sleb128 -432
+	.byte	0x6
+	.byte	0x91
+	.sleb128 -440
+	.byte	0x6
+	.byte	0x1c
+	.uleb128 0x2
+	.uleb128 0x1
+	.byte	0x52
+	.uleb128 0x1
+	.byte	0x32
+	.byte	0
+	.uleb128 0x5
+	.quad	.LVL242
+	.long	0xff1
+	.long	0x200b
+	.uleb128 0x2
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x1
+	.byte	0x4e
+	.byte	0
+	.uleb128 0xf
+	.quad	.LVL244
+	.long	0xfcb
+	.uleb128 0x2
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x7d
+	.sleb128 0
+	.uleb128 0x2
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x4
+	.byte	0x91
+	.sleb128 -432
+	.byte	0x6
+	.uleb128 0x2
+	.uleb128 0x1
+	.byte	0x51
+	.uleb128 0x9
+	.byte	0x91
+	.sleb128 -416
+	.byte	0x6
+	.byte	0x91
+	.sleb128 -432
+	.byte	0x6
+	.byte	0x1c
+	.uleb128 0x2
+	.uleb128 0x1
+	.byte	0x52
+	.uleb128 0x1
+	.byte	0x32
+	.byte	0
+	.byte	0
+	.byte	0
+	.uleb128 0x25
+	.long	0x27fe
+	.quad	.LBI115
+	.value	.LVU525
+	.long	.LLRL87
+	.byte	0xde
+	.byte	0xf
+	.long	0x2214
+	.uleb128 0x6
+	.long	0x2843
+	.long	.LLST88
+	.long	.LVUS88
+	.uleb128 0x6
+	.long	0x2838
+	.long	.LLST89
+	.long	.LVUS89
+	.uleb128 0x6
+	.long	0x282d
+	.long	.LLST90
+	.long	.LVUS90
+	.uleb128 0x6
+	.long	0x2822
+	.long	.LLST91
+	.long	.LVUS91
+	.uleb128 0x6
+	.long	0x2818
+	.long	.LLST92
+	.long	.LVUS92
+	.uleb128 0x6
+	.long	0x280d
+	.long	.LLST93
+	.long	.LVUS93
+	.uleb128 0x16
+	.long	.LLRL87
+	.uleb128 0x37
+	.long	0x284e
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -368
+	.uleb128 0x1a
+	.long	0x2859
+	.long	.LLRL94
+	.long	0x21ac
+	.uleb128 0xa
+	.long	0x285a
+	.long	.LLST95
+	.long	.LVUS95
+	.uleb128 0xa
+	.long	0x2865
+	.long	.LLST96
+	.long	.LVUS96
+	.uleb128 0x51
+	.long	0x2872
+	.long	.LLRL97
+	.byte	0x1
+	.byte	0x5d
+	.byte	0x17
+	.long	0x2166
+	.uleb128 0x26
+	.long	0x28a1
+	.uleb128 0x26
+	.long	0x2896
+	.uleb128 0x26
+	.long	0x288b
+	.uleb128 0x26
+	.long	0x2881
+	.uleb128 0x16
+	.long	.LLRL97
+	.uleb128 0xa
+	.long	0x28ac
+	.long	.LLST98
+	.long	.LVUS98
+	.uleb128 0x23
+	.long	0x28b7
+	.long	.LLRL99
+	.uleb128 0xa
+	.long	0x28b8
+	.long	.LLST100
+	.long	.LVUS100
+	.uleb128 0x5
+	.quad	.LVL255
+	.long	0x11e9
+	.long	0x2156
+	.uleb128 0x2
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x76
+	.sleb128 0
+	.uleb128 0x2
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x5
+	.byte	0x7d
+	.sleb128 0
+	.byte	0x7f
+	.sleb128 0
+	.byte	0x22
+	.uleb128 0x2
+	.uleb128 0x1
+	.byte	0x51
+	.uleb128 0x5
+	.byte	0x73
+	.sleb128 0
+	.byte	0x7f
+	.sleb128 0
+	.byte	0x1c
+	.uleb128 0x2
+	.uleb128 0x1
+	.byte	0x52
+	.uleb128 0x5
+	.byte	0x7e
+	.sleb128 0
+	.byte	0x7f
+	.sleb128 0
+	.byte	0x22
+	.byte	0
+	.uleb128 0x8
+	.quad	.LVL256
+	.long	0x11d8
+	.byte	0
+	.byte	0
+	.byte	0
+	.uleb128 0x5
+	.quad	.LVL259
+	.long	0x1171
+	.long	0x217e
+	.uleb128 0x2
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x7d
+	.sleb128 0
+	.byte	0
+	.uleb128 0x5
+	.quad	.LVL265
+	.long	0x1156
+	.long	0x219e
+	.uleb128 0x2
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x4
+	.byte	0x91
+	.sleb128 -408
+	.byte	0x6
+	.uleb128 0x2
+	.uleb128 0x1
+	.byte	0x51
+	.uleb128 0x2
+	.byte	0x7c
+	.sleb128 0
+	.byte	0
+	.uleb128 0x8
+	.quad	.LVL285
+	.long	0x11d8
+	.byte	0
+	.uleb128 0x5
+	.quad	.LVL187
+	.long	0xf3b
+	.long	0x21d2
+	.uleb128 0x2
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -368
+	.uleb128 0x2
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x3
+	.byte	0xa
+	.value	0x1000
+	.uleb128 0x2
+	.uleb128 0x1
+	.byte	0x51
+	.uleb128 0x2
+	.byte	0x76
+	.sleb128 0
+	.byte	0
+	.uleb128 0x5
+	.quad	.LVL248
+	.long	0xf3b
+	.long	0x21f8
+	.uleb128 0x2
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -368
+	.uleb128 0x2
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x3
+	.byte	0xa
+	.value	0x1000
+	.uleb128 0x2
+	.uleb128 0x1
+	.byte	0x51
+	.uleb128 0x2
+	.byte	0x76
+	.sleb128 0
+	.byte	0
+	.uleb128 0x8
+	.quad	.LVL268
+	.long	0x1171
+	.uleb128 0x8
+	.quad	.LVL279
+	.long	0x11d8
+	.byte	0
+	.byte	0
+	.uleb128 0x2c
+	.long	0x2719
+	.quad	.LBI134
+	.value	.LVU555
+	.quad	.LBB134
+	.quad	.LBE134-.LBB134
+	.byte	0xd1
+	.byte	0xf
+	.long	0x22a0
+	.uleb128 0x6
+	.long	0x2728
+	.long	.LLST101
+	.long	.LVUS101
+	.uleb128 0x37
+	.long	0x2732
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -368
+	.uleb128 0x5
+	.quad	.LVL199
+	.long	0x1024
+	.long	0x2282
+	.uleb128 0x2
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x4
+	.byte	0x91
+	.sleb128 -440
+	.byte	0x6
+	.uleb128 0x2
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x2
+	.byte	0x8
+	.byte	0x20
+	.uleb128 0x2
+	.uleb128 0x1
+	.byte	0x51
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC2
+	.uleb128 0x2
+	.uleb128 0x1
+	.byte	0x52
+	.uleb128 0x2
+	.byte	0x7d
+	.sleb128 0
+	.byte	0
+	.uleb128 0xf
+	.quad	.LVL200
+	.long	0x1008
+	.uleb128 0x2
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x4
+	.byte	0x91
+	.sleb128 -440
+	.byte	0x6
+	.uleb128 0x2
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x3
+	.byte	0xa
+	.value	0x4000
+	.byte	0
+	.byte	0
+	.uleb128 0x2c
+	.long	0x273e
+	.quad	.LBI141
+	.value	.LVU631
+	.quad	.LBB141
+	.quad	.LBE141-.LBB141
+	.byte	0xcb
+	.byte	0x10
+	.long	0x2379
+	.uleb128 0x6
+	.long	0x276e
+	.long	.LLST104
+	.long	.LVUS104
+	.uleb128 0x6
+	.long	0x2763
+	.long	.LLST105
+	.long	.LVUS105
+	.uleb128 0x6
+	.long	0x2758
+	.long	.LLST106
+	.long	.LVUS106
+	.uleb128 0x6
+	.long	0x274d
+	.long	.LLST107
+	.long	.LVUS107
+	.uleb128 0xa
+	.long	0x2779
+	.long	.LLST108
+	.long	.LVUS108
+	.uleb128 0x1a
+	.long	0x2784
+	.long	.LLRL109
+	.long	0x2364
+	.uleb128 0xa
+	.long	0x2785
+	.long	.LLST110
+	.long	.LVUS110
+	.uleb128 0x5
+	.quad	.LVL233
+	.long	0x1156
+	.long	0x233e
+	.uleb128 0x2
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x7c
+	.sleb128 0
+	.uleb128 0x2
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x2
+	.byte	0x7d
+	.sleb128 0
+	.byte	0
+	.uleb128 0xf
+	.quad	.LVL234
+	.long	0x119b
+	.uleb128 0x2
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x7d
+	.sleb128 0
+	.uleb128 0x2
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x1
+	.byte	0x31
+	.uleb128 0x2
+	.uleb128 0x1
+	.byte	0x51
+	.uleb128 0x2
+	.byte	0x76
+	.sleb128 0
+	.uleb128 0x2
+	.uleb128 0x1
+	.byte	0x52
+	.uleb128 0x2
+	.byte	0x73
+	.sleb128 0
+	.byte	0
+	.byte	0
+	.uleb128 0xf
+	.quad	.LVL230
+	.long	0x11c1
+	.uleb128 0x2
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x76
+	.sleb128 0
+	.byte	0
+	.byte	0
+	.uleb128 0x5
+	.quad	.LVL137
+	.long	0x1129
+	.long	0x2393
+	.uleb128 0x2
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x4
+	.byte	0x91
+	.sleb128 -456
+	.byte	0x6
+	.byte	0
+	.uleb128 0x5
+	.quad	.LVL142
+	.long	0x1118
+	.long	0x23ab
+	.uleb128 0x2
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x7c
+	.sleb128 0
+	.byte	0
+	.uleb128 0x5
+	.quad	.LVL144
+	.long	0x10ad
+	.long	0x23e1
+	.uleb128 0x2
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x7c
+	.sleb128 0
+	.uleb128 0x2
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x4
+	.byte	0x91
+	.sleb128 -456
+	.byte	0x6
+	.uleb128 0x2
+	.uleb128 0x1
+	.byte	0x51
+	.uleb128 0x2
+	.byte	0x9
+	.byte	0xff
+	.uleb128 0x2
+	.uleb128 0x1
+	.byte	0x52
+	.uleb128 0x1
+	.byte	0x30
+	.uleb128 0x2
+	.uleb128 0x1
+	.byte	0x58
+	.uleb128 0x1
+	.byte	0x30
+	.uleb128 0x2
+	.uleb128 0x1
+	.byte	0x59
+	.uleb128 0x2
+	.byte	0x76
+	.sleb128 0
+	.byte	0
+	.uleb128 0x5
+	.quad	.LVL160
+	.long	0x1118
+	.long	0x23f9
+	.uleb128 0x2
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x7c
+	.sleb128 0
+	.byte	0
+	.uleb128 0x5
+	.quad	.LVL162
+	.long	0x10f8
+	.long	0x2418
+	.uleb128 0x2
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x7d
+	.sleb128 0
+	.uleb128 0x2
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -208
+	.byte	0
+	.uleb128 0x5
+	.quad	.LVL163
+	.long	0x10e1
+	.long	0x2432
+	.uleb128 0x2
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x4
+	.byte	0x91
+	.sleb128 -456
+	.byte	0x6
+	.byte	0
+	.uleb128 0x8
+	.quad	.LVL195
+	.long	0x11d8
+	.uleb128 0x5
+	.quad	.LVL197
+	.long	0x2575
+	.long	0x2464
+	.uleb128 0x2
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x7c
+	.sleb128 0
+	.uleb128 0x2
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x2
+	.byte	0x7d
+	.sleb128 0
+	.uleb128 0x2
+	.uleb128 0x1
+	.byte	0x51
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -376
+	.byte	0
+	.uleb128 0x5
+	.quad	.LVL204
+	.long	0x10ad
+	.long	0x2490
+	.uleb128 0x2
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x7c
+	.sleb128 0
+	.uleb128 0x2
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x1
+	.byte	0x30
+	.uleb128 0x2
+	.uleb128 0x1
+	.byte	0x51
+	.uleb128 0x5
+	.byte	0x91
+	.sleb128 -440
+	.byte	0x94
+	.byte	0x4
+	.uleb128 0x2
+	.uleb128 0x1
+	.byte	0x59
+	.uleb128 0x2
+	.byte	0x76
+	.sleb128 0
+	.byte	0
+	.uleb128 0x5
+	.quad	.LVL212
+	.long	0x1046
+	.long	0x24af
+	.uleb128 0x2
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x4
+	.byte	0x91
+	.sleb128 -456
+	.byte	0x6
+	.uleb128 0x2
+	.uleb128 0x1
+	.byte	0x51
+	.uleb128 0x1
+	.byte	0x30
+	.byte	0
+	.uleb128 0x5
+	.quad	.LVL221
+	.long	0x107e
+	.long	0x24dc
+	.uleb128 0x2
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x7c
+	.sleb128 0
+	.uleb128 0x2
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x5
+	.byte	0x91
+	.sleb128 -440
+	.byte	0x94
+	.byte	0x4
+	.uleb128 0x2
+	.uleb128 0x1
+	.byte	0x58
+	.uleb128 0x2
+	.byte	0x76
+	.sleb128 0
+	.uleb128 0x2
+	.uleb128 0x1
+	.byte	0x59
+	.uleb128 0x2
+	.byte	0x73
+	.sleb128 0
+	.byte	0
+	.uleb128 0x5
+	.quad	.LVL237
+	.long	0x10ad
+	.long	0x250d
+	.uleb128 0x2
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x7c
+	.sleb128 0
+	.uleb128 0x2
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x1
+	.byte	0x30
+	.uleb128 0x2
+	.uleb128 0x1
+	.byte	0x51
+	.uleb128 0x2
+	.byte	0x7d
+	.sleb128 0
+	.uleb128 0x2
+	.uleb128 0x1
+	.byte	0x52
+	.uleb128 0x4
+	.byte	0x91
+	.sleb128 -440
+	.byte	0x6
+	.uleb128 0x2
+	.uleb128 0x1
+	.byte	0x59
+	.uleb128 0x2
+	.byte	0x76
+	.sleb128 0
+	.byte	0
+	.uleb128 0x5
+	.quad	.LVL270
+	.long	0x107e
+	.long	0x253f
+	.uleb128 0x2
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x7c
+	.sleb128 0
+	.uleb128 0x2
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x2
+	.byte	0x7d
+	.sleb128 0
+	.uleb128 0x2
+	.uleb128 0x1
+	.byte	0x51
+	.uleb128 0x4
+	.byte	0x91
+	.sleb128 -440
+	.byte	0x6
+	.uleb128 0x2
+	.uleb128 0x1
+	.byte	0x58
+	.uleb128 0x2
+	.byte	0x76
+	.sleb128 0
+	.uleb128 0x2
+	.uleb128 0x1
+	.byte	0x59
+	.uleb128 0x2
+	.byte	0x73
+	.sleb128 0
+	.byte	0
+	.uleb128 0xf
+	.quad	.LVL274
+	.long	0x10ad
+	.uleb128 0x2
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x7c
+	.sleb128 0
+	.uleb128 0x2
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x1
+	.byte	0x30
+	.uleb128 0x2
+	.uleb128 0x1
+	.byte	0x51
+	.uleb128 0x5
+	.byte	0x91
+	.sleb128 -440
+	.byte	0x94
+	.byte	0x4
+	.uleb128 0x2
+	.uleb128 0x1
+	.byte	0x52
+	.uleb128 0x4
+	.byte	0x91
+	.sleb128 -432
+	.byte	0x6
+	.uleb128 0x2
+	.uleb128 0x1
+	.byte	0x59
+	.uleb128 0x2
+	.byte	0x76
+	.sleb128 0
+	.byte	0
+	.byte	0
+	.uleb128 0x9
+	.long	0xbe4
+	.uleb128 0x52
+	.long	.LASF389
+	.byte	0x1
+	.byte	0x94
+	.byte	0xc
+	.long	0x3f
+	.quad	.LFB39
+	.quad	.LFE39-.LFB39
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0x2703
+	.uleb128 0x18
+	.string	"ctx"
+	.byte	0x94
+	.byte	0x2c
+	.long	0xc8d
+	.long	.LLST26
+	.long	.LVUS26
+	.uleb128 0x18
+	.string	"fd"
+	.byte	0x94
+	.byte	0x35
+	.long	0x3f
+	.long	.LLST27
+	.long	.LVUS27
+	.uleb128 0x18
+	.string	"off"
+	.byte	0x94
+	.byte	0x40
+	.long	0x2703
+	.long	.LLST28
+	.long	.LVUS28
+	.uleb128 0x2b
+	.long	.LASF342
+	.byte	0x95
+	.byte	0x1e
+	.long	0x14a
+	.long	.LLST29
+	.long	.LVUS29
+	.uleb128 0x24
+	.string	"buf"
+	.byte	0x97
+	.byte	0x13
+	.long	0x2708
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -4160
+	.uleb128 0x19
+	.string	"len"
+	.byte	0x98
+	.byte	0xc
+	.long	0x13e
+	.long	.LLST30
+	.long	.LVUS30
+	.uleb128 0x19
+	.string	"got"
+	.byte	0x9a
+	.byte	0xd
+	.long	0x3b5
+	.long	.LLST31
+	.long	.LVUS31
+	.uleb128 0x25
+	.long	0x2872
+	.quad	.LBI54
+	.value	.LVU252
+	.long	.LLRL32
+	.byte	0x9e
+	.byte	0xb
+	.long	0x26cf
+	.uleb128 0x6
+	.long	0x28a1
+	.long	.LLST33
+	.long	.LVUS33
+	.uleb128 0x6
+	.long	0x2896
+	.long	.LLST34
+	.long	.LVUS34
+	.uleb128 0x6
+	.long	0x288b
+	.long	.LLST35
+	.long	.LVUS35
+	.uleb128 0x6
+	.long	0x2881
+	.long	.LLST36
+	.long	.LVUS36
+	.uleb128 0x16
+	.long	.LLRL32
+	.uleb128 0xa
+	.long	0x28ac
+	.long	.LLST37
+	.long	.LVUS37
+	.uleb128 0x23
+	.long	0x28b7
+	.long	.LLRL38
+	.uleb128 0xa
+	.long	0x28b8
+	.long	.LLST39
+	.long	.LVUS39
+	.uleb128 0x5
+	.quad	.LVL82
+	.long	0x11e9
+	.long	0x26bf
+	.uleb128 0x2
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x7c
+	.sleb128 0
+	.uleb128 0x2
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x5
+	.byte	0x7d
+	.sleb128 0
+	.byte	0x7f
+	.sleb128 0
+	.byte	0x22
+	.uleb128 0x2
+	.uleb128 0x1
+	.byte	0x51
+	.uleb128 0x5
+	.byte	0x73
+	.sleb128 0
+	.byte	0x7f
+	.sleb128 0
+	.byte	0x1c
+	.uleb128 0x2
+	.uleb128 0x1
+	.byte	0x52
+	.uleb128 0x5
+	.byte	0x76
+	.sleb128 0
+	.byte	0x7f
+	.sleb128 0
+	.byte	0x22
+	.byte	0
+	.uleb128 0x8
+	.quad	.LVL83
+	.long	0x11d8
+	.byte	0
+	.byte	0
+	.byte	0
+	.uleb128 0x5
+	.quad	.LVL87
+	.long	0x1156
+	.long	0x26f5
+	.uleb128 0x2
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x4
+	.byte	0x91
+	.sleb128 -4168
+	.byte	0x6
+	.uleb128 0x2
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x2
+	.byte	0x7d
+	.sleb128 0
+	.uleb128 0x2
+	.uleb128 0x1
+	.byte	0x51
+	.uleb128 0x2
+	.byte	0x73
+	.sleb128 0
+	.byte	0
+	.uleb128 0x8
+	.quad	.LVL93
+	.long	0x11d8
+	.byte	0
+	.uleb128 0x9
+	.long	0x14a
+	.uleb128 0xd
+	.long	0x46
+	.long	0x2719
+	.uleb128 0x53
+	.long	0x5b
+	.value	0xfff
+	.byte	0
+	.uleb128 0x2d
+	.long	.LASF391
+	.byte	0x86
+	.byte	0xc
+	.long	0x3f
+	.long	0x273e
+	.uleb128 0xe
+	.string	"fd"
+	.byte	0x86
+	.byte	0x22
+	.long	0x3f
+	.uleb128 0x1f
+	.long	.LASF392
+	.byte	0x89
+	.byte	0xa
+	.long	0x3a5
+	.byte	0
+	.uleb128 0x38
+	.long	.LASF393
+	.byte	0x6c
+	.byte	0x5
+	.long	0x3f
+	.long	0x27fe
+	.uleb128 0xe
+	.string	"ctx"
+	.byte	0x6c
+	.byte	0x2d
+	.long	0xc8d
+	.uleb128 0x1b
+	.long	.LASF377
+	.byte	0x6c
+	.byte	0x38
+	.long	0xaf3
+	.uleb128 0x1b
+	.long	.LASF337
+	.byte	0x6c
+	.byte	0x47
+	.long	0x13e
+	.uleb128 0xe
+	.string	"out"
+	.byte	0x6d
+	.byte	0x28
+	.long	0xc92
+	.uleb128 0x17
+	.string	"buf"
+	.byte	0x6f
+	.byte	0x14
+	.long	0xc92
+	.uleb128 0x27
+	.uleb128 0x1f
+	.long	.LASF394
+	.byte	0x76
+	.byte	0x10
+	.long	0x13e
+	.uleb128 0x5
+	.quad	.LVL116
+	.long	0x1156
+	.long	0x27ae
+	.uleb128 0x2
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x7d
+	.sleb128 0
+	.uleb128 0x2
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x2
+	.byte	0x73
+	.sleb128 0
+	.byte	0
+	.uleb128 0x5
+	.quad	.LVL117
+	.long	0x119b
+	.long	0x27d7
+	.uleb128 0x2
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x73
+	.sleb128 0
+	.uleb128 0x2
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x1
+	.byte	0x31
+	.uleb128 0x2
+	.uleb128 0x1
+	.byte	0x51
+	.uleb128 0x2
+	.byte	0x7c
+	.sleb128 0
+	.uleb128 0x2
+	.uleb128 0x1
+	.byte	0x52
+	.uleb128 0x2
+	.byte	0x76
+	.sleb128 0
+	.byte	0
+	.uleb128 0x5
+	.quad	.LVL119
+	.long	0x1184
+	.long	0x27ef
+	.uleb128 0x2
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x76
+	.sleb128 0
+	.byte	0
+	.uleb128 0x8
+	.quad	.LVL128
+	.long	0x1171
+	.byte	0
+	.byte	0
+	.uleb128 0x2d
+	.long	.LASF395
+	.byte	0x50
+	.byte	0xc
+	.long	0x3f
+	.long	0x2872
+	.uleb128 0xe
+	.string	"ctx"
+	.byte	0x50
+	.byte	0x2b
+	.long	0xc8d
+	.uleb128 0xe
+	.string	"fd"
+	.byte	0x50
+	.byte	0x34
+	.long	0x3f
+	.uleb128 0xe
+	.string	"off"
+	.byte	0x50
+	.byte	0x41
+	.long	0x904
+	.uleb128 0x1b
+	.long	.LASF342
+	.byte	0x51
+	.byte	0x20
+	.long	0x904
+	.uleb128 0x1b
+	.long	.LASF337
+	.byte	0x51
+	.byte	0x2d
+	.long	0x13e
+	.uleb128 0x1b
+	.long	.LASF387
+	.byte	0x51
+	.byte	0x38
+	.long	0x3f
+	.uleb128 0x17
+	.string	"buf"
+	.byte	0x53
+	.byte	0x14
+	.long	0xc92
+	.uleb128 0x27
+	.uleb128 0x1f
+	.long	.LASF382
+	.byte	0x5c
+	.byte	0x10
+	.long	0x13e
+	.uleb128 0x17
+	.string	"got"
+	.byte	0x5d
+	.byte	0x11
+	.long	0x3b5
+	.byte	0
+	.byte	0
+	.uleb128 0x38
+	.long	.LASF396
+	.byte	0x3c
+	.byte	0x9
+	.long	0x3b5
+	.long	0x2903
+	.uleb128 0xe
+	.string	"fd"
+	.byte	0x3c
+	.byte	0x1b
+	.long	0x3f
+	.uleb128 0xe
+	.string	"buf"
+	.byte	0x3c
+	.byte	0x25
+	.long	0x107
+	.uleb128 0xe
+	.string	"len"
+	.byte	0x3c
+	.byte	0x31
+	.long	0x13e
+	.uleb128 0xe
+	.string	"off"
+	.byte	0x3c
+	.byte	0x3f
+	.long	0x904
+	.uleb128 0x17
+	.string	"got"
+	.byte	0x3e
+	.byte	0xc
+	.long	0x13e
+	.uleb128 0x27
+	.uleb128 0x17
+	.string	"r"
+	.byte	0x40
+	.byte	0x11
+	.long	0x3b5
+	.uleb128 0x5
+	.quad	.LVL98
+	.long	0x11e9
+	.long	0x28f4
+	.uleb128 0x2
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x7c
+	.sleb128 0
+	.uleb128 0x2
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x5
+	.byte	0x7d
+	.sleb128 0
+	.byte	0x73
+	.sleb128 0
+	.byte	0x22
+	.uleb128 0x2
+	.uleb128 0x1
+	.byte	0x51
+	.uleb128 0x5
+	.byte	0x76
+	.sleb128 0
+	.byte	0x73
+	.sleb128 0
+	.byte	0x1c
+	.uleb128 0x2
+	.uleb128 0x1
+	.byte	0x52
+	.uleb128 0x5
+	.byte	0x7e
+	.sleb128 0
+	.byte	0x73
+	.sleb128 0
+	.byte	0x22
+	.byte	0
+	.uleb128 0x8
+	.quad	.LVL99
+	.long	0x11d8
+	.byte	0
+	.byte	0
+	.uleb128 0x2d
+	.long	.LASF397
+	.byte	0x25
+	.byte	0xe
+	.long	0x14a
+	.long	0x296a
+	.uleb128 0xe
+	.string	"ctx"
+	.byte	0x25
+	.byte	0x2c
+	.long	0xc8d
+	.uleb128 0xe
+	.string	"fd"
+	.byte	0x25
+	.byte	0x35
+	.long	0x3f
+	.uleb128 0xe
+	.string	"off"
+	.byte	0x25
+	.byte	0x3f
+	.long	0x14a
+	.uleb128 0x1b
+	.long	.LASF342
+	.byte	0x25
+	.byte	0x4a
+	.long	0x14a
+	.uleb128 0x1f
+	.long	.LASF398
+	.byte	0x27
+	.byte	0xb
+	.long	0x14a
+	.uleb128 0x27
+	.uleb128 0x1f
+	.long	.LASF399
+	.byte	0x2b
+	.byte	0xf
+	.long	0x14a
+	.uleb128 0x17
+	.string	"len"
+	.byte	0x2c
+	.byte	0x10
+	.long	0x13e
+	.uleb128 0x17
+	.string	"p"
+	.byte	0x2e
+	.byte	0x18
+	.long	0xc92
+	.byte	0
+	.byte	0
+	.uleb128 0x54
+	.long	0x2872
+	.quad	.LFB35
+	.quad	.LFE35-.LFB35
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0x29de
+	.uleb128 0x6
+	.long	0x2881
+	.long	.LLST40
+	.long	.LVUS40
+	.uleb128 0x6
+	.long	0x288b
+	.long	.LLST41
+	.long	.LVUS41
+	.uleb128 0x6
+	.long	0x2896
+	.long	.LLST42
+	.long	.LVUS42
+	.uleb128 0x6
+	.long	0x28a1
+	.long	.LLST43
+	.long	.LVUS43
+	.uleb128 0xa
+	.long	0x28ac
+	.long	.LLST44
+	.long	.LVUS44
+	.uleb128 0x23
+	.long	0x28b7
+	.long	.LLRL45
+	.uleb128 0xa
+	.long	0x28b8
+	.long	.LLST46
+	.long	.LVUS46
+	.byte	0
+	.byte	0
+	.uleb128 0x55
+	.long	0x273e
+	.quad	.LFB37
+	.quad	.LFE37-.LFB37
+	.uleb128 0x1
+	.byte	0x9c
+	.uleb128 0x6
+	.long	0x274d
+	.long	.LLST47
+	.long	.LVUS47
+	.uleb128 0x6
+	.long	0x2758
+	.long	.LLST48
+	.long	.LVUS48
+	.uleb128 0x6
+	.long	0x2763
+	.long	.LLST49
+	.long	.LVUS49
+	.uleb128 0x6
+	.long	0x276e
+	.long	.LLST50
+	.long	.LVUS50
+	.uleb128 0xa
+	.long	0x2779
+	.long	.LLST51
+	.long	.LVUS51
+	.uleb128 0x1a
+	.long	0x2784
+	.long	.LLRL52
+	.long	0x2a51
+	.uleb128 0xa
+	.long	0x2785
+	.long	.LLST53
+	.long	.LVUS53
+	.byte	0
+	.uleb128 0x5
+	.quad	.LVL114
+	.long	0x11c1
+	.long	0x2a69
+	.uleb128 0x2
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x7c
+	.sleb128 0
+	.byte	0
+	.uleb128 0x5
+	.quad	.LVL120
+	.long	0x1171
+	.long	0x2a81
+	.uleb128 0x2
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x73
+	.sleb128 0
+	.byte	0
+	.uleb128 0x5
+	.quad	.LVL121
+	.long	0x1140
+	.long	0x2a9f
+	.uleb128 0x2
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x7d
+	.sleb128 0
+	.uleb128 0x2
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x2
+	.byte	0x7e
+	.sleb128 0
+	.byte	0
+	.uleb128 0x8
+	.quad	.LVL134
+	.long	0x11d8
+	.byte	0
+	.byte	0
+	.section	.debug_abbrev,"",@progbits
+.Ldebug_abbrev0:
+	.uleb128 0x1
+	.uleb128 0x28
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x1c
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x2
+	.uleb128 0x49
+	.byte	0
+	.uleb128 0x2
+	.uleb128 0x18
+	.uleb128 0x7e
+	.uleb128 0x18
+	.byte	0
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x5
+	.byte	0
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x4
+	.uleb128 0xd
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x38
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x5
+	.uleb128 0x48
+	.byte	0x1
+	.uleb128 0x7d
+	.uleb128 0x1
+	.uleb128 0x7f
+	.uleb128 0x13
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x6
+	.uleb128 0x5
+	.byte	0
+	.uleb128 0x31
+	.uleb128 0x13
+	.uleb128 0x2
+	.uleb128 0x17
+	.uleb128 0x2137
+	.uleb128 0x17
+	.byte	0
+	.byte	0
+	.uleb128 0x7
+	.uleb128 0x16
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x8
+	.uleb128 0x48
+	.byte	0
+	.uleb128 0x7d
+	.uleb128 0x1
+	.uleb128 0x7f
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x9
+	.uleb128 0xf
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0x21
+	.sleb128 8
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0xa
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x31
+	.uleb128 0x13
+	.uleb128 0x2
+	.uleb128 0x17
+	.uleb128 0x2137
+	.uleb128 0x17
+	.byte	0
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0x21
+	.byte	0
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x2f
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0xc
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x3c
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0xd
+	.uleb128 0x1
+	.byte	0x1
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0xe
+	.uleb128 0x5
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x8
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0xf
+	.uleb128 0x48
+	.byte	0x1
+	.uleb128 0x7d
+	.uleb128 0x1
+	.uleb128 0x7f
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x10
+	.uleb128 0x24
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x3e
+	.uleb128 0xb
+	.uleb128 0x3
+	.uleb128 0xe
+	.byte	0
+	.byte	0
+	.uleb128 0x11
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x3c
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x12
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x8
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x2
+	.uleb128 0x17
+	.uleb128 0x2137
+	.uleb128 0x17
+	.byte	0
+	.byte	0
+	.uleb128 0x13
+	.uleb128 0x26
+	.byte	0
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x14
+	.uleb128 0x13
+	.byte	0x1
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x15
+	.uleb128 0x5
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x8
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x2
+	.uleb128 0x17
+	.uleb128 0x2137
+	.uleb128 0x17
+	.byte	0
+	.byte	0
+	.uleb128 0x16
+	.uleb128 0xb
+	.byte	0x1
+	.uleb128 0x55
+	.uleb128 0x17
+	.byte	0
+	.byte	0
+	.uleb128 0x17
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x8
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x18
+	.uleb128 0x5
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x8
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x2
+	.uleb128 0x17
+	.uleb128 0x2137
+	.uleb128 0x17
+	.byte	0
+	.byte	0
+	.uleb128 0x19
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x8
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x2
+	.uleb128 0x17
+	.uleb128 0x2137
+	.uleb128 0x17
+	.byte	0
+	.byte	0
+	.uleb128 0x1a
+	.uleb128 0xb
+	.byte	0x1
+	.uleb128 0x31
+	.uleb128 0x13
+	.uleb128 0x55
+	.uleb128 0x17
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x1b
+	.uleb128 0x5
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x1c
+	.uleb128 0xd
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 9
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x1d
+	.uleb128 0xd
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x8
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x38
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x1e
+	.uleb128 0xd
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x38
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x1f
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x20
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 6
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x3c
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x21
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x8
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x2
+	.uleb128 0x18
+	.byte	0
+	.byte	0
+	.uleb128 0x22
+	.uleb128 0x1d
+	.byte	0x1
+	.uleb128 0x31
+	.uleb128 0x13
+	.uleb128 0x52
+	.uleb128 0x1
+	.uleb128 0x2138
+	.uleb128 0x5
+	.uleb128 0x55
+	.uleb128 0x17
+	.uleb128 0x58
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x59
+	.uleb128 0x5
+	.uleb128 0x57
+	.uleb128 0xb
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x23
+	.uleb128 0xb
+	.byte	0x1
+	.uleb128 0x31
+	.uleb128 0x13
+	.uleb128 0x55
+	.uleb128 0x17
+	.byte	0
+	.byte	0
+	.uleb128 0x24
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x8
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x2
+	.uleb128 0x18
+	.byte	0
+	.byte	0
+	.uleb128 0x25
+	.uleb128 0x1d
+	.byte	0x1
+	.uleb128 0x31
+	.uleb128 0x13
+	.uleb128 0x52
+	.uleb128 0x1
+	.uleb128 0x2138
+	.uleb128 0x5
+	.uleb128 0x55
+	.uleb128 0x17
+	.uleb128 0x58
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x59
+	.uleb128 0xb
+	.uleb128 0x57
+	.uleb128 0xb
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x26
+	.uleb128 0x5
+	.byte	0
+	.uleb128 0x31
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x27
+	.uleb128 0xb
+	.byte	0x1
+	.byte	0
+	.byte	0
+	.uleb128 0x28
+	.uleb128 0x13
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3c
+	.uleb128 0x19
+	.byte	0
+	.byte	0
+	.uleb128 0x29
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x2
+	.uleb128 0x18
+	.byte	0
+	.byte	0
+	.uleb128 0x2a
+	.uleb128 0xb
+	.byte	0x1
+	.uleb128 0x55
+	.uleb128 0x17
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x2b
+	.uleb128 0x5
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x2
+	.uleb128 0x17
+	.uleb128 0x2137
+	.uleb128 0x17
+	.byte	0
+	.byte	0
+	.uleb128 0x2c
+	.uleb128 0x1d
+	.byte	0x1
+	.uleb128 0x31
+	.uleb128 0x13
+	.uleb128 0x52
+	.uleb128 0x1
+	.uleb128 0x2138
+	.uleb128 0x5
+	.uleb128 0x11
+	.uleb128 0x1
+	.uleb128 0x12
+	.uleb128 0x7
+	.uleb128 0x58
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x59
+	.uleb128 0xb
+	.uleb128 0x57
+	.uleb128 0xb
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x2d
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x20
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x2e
+	.uleb128 0x37
+	.byte	0
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x2f
+	.uleb128 0x17
+	.byte	0x1
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 9
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 9
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x30
+	.uleb128 0x16
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x8
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 15
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x31
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 15
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x1c
+	.uleb128 0xa
+	.byte	0
+	.byte	0
+	.uleb128 0x32
+	.uleb128 0x18
+	.byte	0
+	.byte	0
+	.byte	0
+	.uleb128 0x33
+	.uleb128 0x5
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x3b
+	.uleb128 0x21
+	.sleb128 352
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x2
+	.uleb128 0x17
+	.uleb128 0x2137
+	.uleb128 0x17
+	.byte	0
+	.byte	0
+	.uleb128 0x34
+	.uleb128 0x5
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x35
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 5
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x11
+	.uleb128 0x1
+	.uleb128 0x12
+	.uleb128 0x7
+	.uleb128 0x40
+	.uleb128 0x18
+	.uleb128 0x7a
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x36
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x2
+	.uleb128 0x17
+	.uleb128 0x2137
+	.uleb128 0x17
+	.byte	0
+	.byte	0
+	.uleb128 0x37
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x31
+	.uleb128 0x13
+	.uleb128 0x2
+	.uleb128 0x18
+	.byte	0
+	.byte	0
+	.uleb128 0x38
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x20
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x39
+	.uleb128 0x11
+	.byte	0x1
+	.uleb128 0x25
+	.uleb128 0xe
+	.uleb128 0x13
+	.uleb128 0xb
+	.uleb128 0x3
+	.uleb128 0x1f
+	.uleb128 0x1b
+	.uleb128 0x1f
+	.uleb128 0x11
+	.uleb128 0x1
+	.uleb128 0x12
+	.uleb128 0x7
+	.uleb128 0x10
+	.uleb128 0x17
+	.byte	0
+	.byte	0
+	.uleb128 0x3a
+	.uleb128 0x24
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x3e
+	.uleb128 0xb
+	.uleb128 0x3
+	.uleb128 0x8
+	.byte	0
+	.byte	0
+	.uleb128 0x3b
+	.uleb128 0xf
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x3c
+	.uleb128 0x26
+	.byte	0
+	.byte	0
+	.byte	0
+	.uleb128 0x3d
+	.uleb128 0x4
+	.byte	0x1
+	.uleb128 0x3e
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x3e
+	.uleb128 0x16
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x3f
+	.uleb128 0x13
+	.byte	0x1
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x88
+	.uleb128 0xb
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x40
+	.uleb128 0xd
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x8
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x38
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x41
+	.uleb128 0x15
+	.byte	0x1
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x42
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x3c
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x43
+	.uleb128 0x2e
+	.byte	0
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x3c
+	.uleb128 0x19
+	.byte	0
+	.byte	0
+	.uleb128 0x44
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x11
+	.uleb128 0x1
+	.uleb128 0x12
+	.uleb128 0x7
+	.uleb128 0x40
+	.uleb128 0x18
+	.uleb128 0x7a
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x45
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x11
+	.uleb128 0x1
+	.uleb128 0x12
+	.uleb128 0x7
+	.uleb128 0x40
+	.uleb128 0x18
+	.uleb128 0x7a
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x46
+	.uleb128 0x48
+	.byte	0
+	.uleb128 0x7d
+	.uleb128 0x1
+	.uleb128 0x82
+	.uleb128 0x19
+	.uleb128 0x7f
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x47
+	.uleb128 0x48
+	.byte	0x1
+	.uleb128 0x7d
+	.uleb128 0x1
+	.uleb128 0x82
+	.uleb128 0x19
+	.uleb128 0x7f
+	.uleb128 0x13
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x48
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x11
+	.uleb128 0x1
+	.uleb128 0x12
+	.uleb128 0x7
+	.uleb128 0x40
+	.uleb128 0x18
+	.uleb128 0x7a
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x49
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x2
+	.uleb128 0x17
+	.uleb128 0x2137
+	.uleb128 0x17
+	.byte	0
+	.byte	0
+	.uleb128 0x4a
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x20
+	.uleb128 0xb
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x4b
+	.uleb128 0x5
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x8
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x4c
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x20
+	.uleb128 0xb
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x4d
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x4e
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x8
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x4f
+	.uleb128 0x48
+	.byte	0x1
+	.uleb128 0x7d
+	.uleb128 0x1
+	.uleb128 0x82
+	.uleb128 0x19
+	.uleb128 0x7f
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x50
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x2
+	.uleb128 0x18
+	.byte	0
+	.byte	0
+	.uleb128 0x51
+	.uleb128 0x1d
+	.byte	0x1
+	.uleb128 0x31
+	.uleb128 0x13
+	.uleb128 0x55
+	.uleb128 0x17
+	.uleb128 0x58
+	.uleb128 0xb
+	.uleb128 0x59
+	.uleb128 0xb
+	.uleb128 0x57
+	.uleb128 0xb
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x52
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x11
+	.uleb128 0x1
+	.uleb128 0x12
+	.uleb128 0x7
+	.uleb128 0x40
+	.uleb128 0x18
+	.uleb128 0x7a
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x53
+	.uleb128 0x21
+	.byte	0
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x2f
+	.uleb128 0x5
+	.byte	0
+	.byte	0
+	.uleb128 0x54
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x31
+	.uleb128 0x13
+	.uleb128 0x11
+	.uleb128 0x1
+	.uleb128 0x12
+	.uleb128 0x7
+	.uleb128 0x40
+	.uleb128 0x18
+	.uleb128 0x7a
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x55
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x31
+	.uleb128 0x13
+	.uleb128 0x11
+	.uleb128 0x1
+	.uleb128 0x12
+	.uleb128 0x7
+	.uleb128 0x40
+	.uleb128 0x18
+	.uleb128 0x7a
+	.uleb128 0x19
+	.byte	0
+	.byte	0
+	.byte	0
+	.section	.debug_loclists,"",@progbits
+	.long	.Ldebug_loc3-.Ldebug_loc2
+.Ldebug_loc2:
+	.value	0x5
+	.byte	0x8
+	.byte	0
+	.long	0
+.Ldebug_loc0:
+.LVUS113:
+	.uleb128 0
+	.uleb128 .LVU791
+	.uleb128 .LVU791
+	.uleb128 .LVU807
+	.uleb128 .LVU807
+	.uleb128 .LVU808
+	.uleb128 .LVU808
+	.uleb128 0
+.LLST113:
+	.byte	0x4
+	.uleb128 .LVL289-.Ltext0
+	.uleb128 .LVL290-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL290-.Ltext0
+	.uleb128 .LVL295-.Ltext0
+	.uleb128 0x1
+	.byte	0x56
+	.byte	0x4
+	.uleb128 .LVL295-.Ltext0
+	.uleb128 .LVL296-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL296-.Ltext0
+	.uleb128 .LFE46-.Ltext0
+	.uleb128 0x1
+	.byte	0x56
+	.byte	0
+.LVUS114:
+	.uleb128 0
+	.uleb128 .LVU793
+	.uleb128 .LVU793
+	.uleb128 0
+.LLST114:
+	.byte	0x4
+	.uleb128 .LVL289-.Ltext0
+	.uleb128 .LVL291-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x4
+	.uleb128 .LVL291-1-.Ltext0
+	.uleb128 .LFE46-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x9f
+	.byte	0
+.LVUS115:
+	.uleb128 0
+	.uleb128 .LVU793
+	.uleb128 .LVU793
+	.uleb128 .LVU805
+	.uleb128 .LVU805
+	.uleb128 .LVU808
+	.uleb128 .LVU808
+	.uleb128 .LVU833
+	.uleb128 .LVU833
+	.uleb128 .LVU844
+	.uleb128 .LVU844
+	.uleb128 .LVU872
+	.uleb128 .LVU872
+	.uleb128 .LVU916
+	.uleb128 .LVU916
+	.uleb128 0
+.LLST115:
+	.byte	0x4
+	.uleb128 .LVL289-.Ltext0
+	.uleb128 .LVL291-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x51
+	.byte	0x4
+	.uleb128 .LVL291-1-.Ltext0
+	.uleb128 .LVL294-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0x4
+	.uleb128 .LVL294-.Ltext0
+	.uleb128 .LVL296-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x51
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL296-.Ltext0
+	.uleb128 .LVL303-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0x4
+	.uleb128 .LVL303-.Ltext0
+	.uleb128 .LVL307-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x51
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL307-.Ltext0
+	.uleb128 .LVL316-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0x4
+	.uleb128 .LVL316-.Ltext0
+	.uleb128 .LVL334-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x51
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL334-.Ltext0
+	.uleb128 .LFE46-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0
+.LVUS116:
+	.uleb128 .LVU826
+	.uleb128 .LVU829
+	.uleb128 .LVU829
+	.uleb128 .LVU844
+	.uleb128 .LVU867
+	.uleb128 .LVU898
+	.uleb128 .LVU898
+	.uleb128 .LVU899
+	.uleb128 .LVU899
+	.uleb128 .LVU913
+	.uleb128 .LVU913
+	.uleb128 .LVU914
+	.uleb128 .LVU914
+	.uleb128 .LVU916
+	.uleb128 .LVU917
+	.uleb128 .LVU919
+	.uleb128 .LVU919
+	.uleb128 0
+.LLST116:
+	.byte	0x4
+	.uleb128 .LVL299-.Ltext0
+	.uleb128 .LVL300-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL300-1-.Ltext0
+	.uleb128 .LVL307-.Ltext0
+	.uleb128 0x1
+	.byte	0x5c
+	.byte	0x4
+	.uleb128 .LVL314-.Ltext0
+	.uleb128 .LVL323-.Ltext0
+	.uleb128 0x1
+	.byte	0x5c
+	.byte	0x4
+	.uleb128 .LVL323-.Ltext0
+	.uleb128 .LVL324-.Ltext0
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x4
+	.uleb128 .LVL324-.Ltext0
+	.uleb128 .LVL330-.Ltext0
+	.uleb128 0x1
+	.byte	0x5c
+	.byte	0x4
+	.uleb128 .LVL330-.Ltext0
+	.uleb128 .LVL331-.Ltext0
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x4
+	.uleb128 .LVL331-.Ltext0
+	.uleb128 .LVL334-.Ltext0
+	.uleb128 0x1
+	.byte	0x5c
+	.byte	0x4
+	.uleb128 .LVL335-.Ltext0
+	.uleb128 .LVL336-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL336-1-.Ltext0
+	.uleb128 .LFE46-.Ltext0
+	.uleb128 0x1
+	.byte	0x5c
+	.byte	0
+.LVUS117:
+	.uleb128 .LVU890
+	.uleb128 .LVU897
+	.uleb128 .LVU901
+	.uleb128 .LVU906
+	.uleb128 .LVU906
+	.uleb128 .LVU911
+.LLST117:
+	.byte	0x4
+	.uleb128 .LVL320-.Ltext0
+	.uleb128 .LVL322-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0x4
+	.uleb128 .LVL326-.Ltext0
+	.uleb128 .LVL327-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL327-.Ltext0
+	.uleb128 .LVL328-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0
+.LVUS126:
+	.uleb128 .LVU895
+	.uleb128 .LVU898
+	.uleb128 .LVU898
+	.uleb128 .LVU900
+.LLST126:
+	.byte	0x4
+	.uleb128 .LVL321-.Ltext0
+	.uleb128 .LVL323-.Ltext0
+	.uleb128 0x5
+	.byte	0x70
+	.sleb128 0
+	.byte	0x31
+	.byte	0x1a
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL323-.Ltext0
+	.uleb128 .LVL325-.Ltext0
+	.uleb128 0x2
+	.byte	0x30
+	.byte	0x9f
+	.byte	0
+.LVUS119:
+	.uleb128 .LVU847
+	.uleb128 .LVU867
+	.uleb128 .LVU916
+	.uleb128 .LVU917
+.LLST119:
+	.byte	0x4
+	.uleb128 .LVL308-.Ltext0
+	.uleb128 .LVL314-.Ltext0
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x4
+	.uleb128 .LVL334-.Ltext0
+	.uleb128 .LVL335-.Ltext0
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0
+.LVUS120:
+	.uleb128 .LVU849
+	.uleb128 .LVU860
+	.uleb128 .LVU860
+	.uleb128 .LVU863
+	.uleb128 .LVU863
+	.uleb128 .LVU866
+	.uleb128 .LVU866
+	.uleb128 .LVU867
+	.uleb128 .LVU916
+	.uleb128 .LVU917
+.LLST120:
+	.byte	0x4
+	.uleb128 .LVL308-.Ltext0
+	.uleb128 .LVL309-.Ltext0
+	.uleb128 0x2
+	.byte	0x33
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL309-.Ltext0
+	.uleb128 .LVL311-.Ltext0
+	.uleb128 0x1
+	.byte	0x51
+	.byte	0x4
+	.uleb128 .LVL311-.Ltext0
+	.uleb128 .LVL313-.Ltext0
+	.uleb128 0x3
+	.byte	0x71
+	.sleb128 -1
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL313-.Ltext0
+	.uleb128 .LVL314-.Ltext0
+	.uleb128 0x1
+	.byte	0x51
+	.byte	0x4
+	.uleb128 .LVL334-.Ltext0
+	.uleb128 .LVL335-.Ltext0
+	.uleb128 0x2
+	.byte	0x33
+	.byte	0x9f
+	.byte	0
+.LVUS121:
+	.uleb128 .LVU850
+	.uleb128 .LVU860
+	.uleb128 .LVU860
+	.uleb128 .LVU862
+	.uleb128 .LVU862
+	.uleb128 .LVU864
+	.uleb128 .LVU865
+	.uleb128 .LVU867
+	.uleb128 .LVU916
+	.uleb128 .LVU917
+.LLST121:
+	.byte	0x4
+	.uleb128 .LVL308-.Ltext0
+	.uleb128 .LVL309-.Ltext0
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x4
+	.uleb128 .LVL309-.Ltext0
+	.uleb128 .LVL310-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL310-.Ltext0
+	.uleb128 .LVL312-.Ltext0
+	.uleb128 0x3
+	.byte	0x70
+	.sleb128 1
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL313-.Ltext0
+	.uleb128 .LVL314-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL334-.Ltext0
+	.uleb128 .LVL335-.Ltext0
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0
+.LVUS123:
+	.uleb128 .LVU869
+	.uleb128 .LVU877
+	.uleb128 .LVU877
+	.uleb128 .LVU886
+.LLST123:
+	.byte	0x4
+	.uleb128 .LVL315-.Ltext0
+	.uleb128 .LVL318-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL318-.Ltext0
+	.uleb128 .LVL319-.Ltext0
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -376
+	.byte	0
+.LVUS124:
+	.uleb128 .LVU869
+	.uleb128 .LVU873
+	.uleb128 .LVU873
+	.uleb128 .LVU886
+.LLST124:
+	.byte	0x4
+	.uleb128 .LVL315-.Ltext0
+	.uleb128 .LVL317-.Ltext0
+	.uleb128 0x4
+	.byte	0x91
+	.sleb128 -464
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL317-.Ltext0
+	.uleb128 .LVL319-.Ltext0
+	.uleb128 0x1
+	.byte	0x5d
+	.byte	0
+.LVUS21:
+	.uleb128 0
+	.uleb128 .LVU186
+	.uleb128 .LVU186
+	.uleb128 .LVU194
+	.uleb128 .LVU194
+	.uleb128 .LVU195
+	.uleb128 .LVU195
+	.uleb128 .LVU198
+	.uleb128 .LVU198
+	.uleb128 .LVU212
+	.uleb128 .LVU212
+	.uleb128 .LVU213
+	.uleb128 .LVU213
+	.uleb128 .LVU216
+	.uleb128 .LVU216
+	.uleb128 .LVU233
+	.uleb128 .LVU233
+	.uleb128 .LVU234
+	.uleb128 .LVU234
+	.uleb128 .LVU237
+	.uleb128 .LVU237
+	.uleb128 .LVU237
+	.uleb128 .LVU237
+	.uleb128 0
+.LLST21:
+	.byte	0x4
+	.uleb128 .LVL43-.Ltext0
+	.uleb128 .LVL44-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL44-.Ltext0
+	.uleb128 .LVL48-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0x4
+	.uleb128 .LVL48-.Ltext0
+	.uleb128 .LVL49-.Ltext0
+	.uleb128 0x3
+	.byte	0x76
+	.sleb128 -32
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL49-.Ltext0
+	.uleb128 .LVL52-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL52-.Ltext0
+	.uleb128 .LVL57-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0x4
+	.uleb128 .LVL57-.Ltext0
+	.uleb128 .LVL58-.Ltext0
+	.uleb128 0x3
+	.byte	0x76
+	.sleb128 -32
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL58-.Ltext0
+	.uleb128 .LVL61-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL61-.Ltext0
+	.uleb128 .LVL68-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0x4
+	.uleb128 .LVL68-.Ltext0
+	.uleb128 .LVL69-.Ltext0
+	.uleb128 0x3
+	.byte	0x76
+	.sleb128 -32
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL69-.Ltext0
+	.uleb128 .LVL71-1-.Ltext0
+	.uleb128 0x3
+	.byte	0x75
+	.sleb128 -32
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL71-1-.Ltext0
+	.uleb128 .LVL71-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL71-.Ltext0
+	.uleb128 .LFE45-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0
+.LVUS22:
+	.uleb128 0
+	.uleb128 .LVU188
+	.uleb128 .LVU188
+	.uleb128 .LVU197
+	.uleb128 .LVU197
+	.uleb128 .LVU198
+	.uleb128 .LVU198
+	.uleb128 .LVU215
+	.uleb128 .LVU215
+	.uleb128 .LVU216
+	.uleb128 .LVU216
+	.uleb128 .LVU220
+	.uleb128 .LVU220
+	.uleb128 .LVU239
+	.uleb128 .LVU239
+	.uleb128 .LVU240
+	.uleb128 .LVU240
+	.uleb128 0
+.LLST22:
+	.byte	0x4
+	.uleb128 .LVL43-.Ltext0
+	.uleb128 .LVL45-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x4
+	.uleb128 .LVL45-1-.Ltext0
+	.uleb128 .LVL51-.Ltext0
+	.uleb128 0x1
+	.byte	0x5d
+	.byte	0x4
+	.uleb128 .LVL51-.Ltext0
+	.uleb128 .LVL52-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL52-.Ltext0
+	.uleb128 .LVL60-.Ltext0
+	.uleb128 0x1
+	.byte	0x5d
+	.byte	0x4
+	.uleb128 .LVL60-.Ltext0
+	.uleb128 .LVL61-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL61-.Ltext0
+	.uleb128 .LVL63-.Ltext0
+	.uleb128 0x1
+	.byte	0x5d
+	.byte	0x4
+	.uleb128 .LVL63-.Ltext0
+	.uleb128 .LVL73-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL73-.Ltext0
+	.uleb128 .LVL74-.Ltext0
+	.uleb128 0x1
+	.byte	0x5d
+	.byte	0x4
+	.uleb128 .LVL74-.Ltext0
+	.uleb128 .LFE45-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x9f
+	.byte	0
+.LVUS23:
+	.uleb128 .LVU179
+	.uleb128 .LVU186
+	.uleb128 .LVU186
+	.uleb128 .LVU194
+	.uleb128 .LVU194
+	.uleb128 .LVU195
+	.uleb128 .LVU195
+	.uleb128 .LVU198
+	.uleb128 .LVU198
+	.uleb128 .LVU212
+	.uleb128 .LVU212
+	.uleb128 .LVU213
+	.uleb128 .LVU213
+	.uleb128 .LVU216
+	.uleb128 .LVU216
+	.uleb128 .LVU233
+	.uleb128 .LVU233
+	.uleb128 .LVU234
+	.uleb128 .LVU234
+	.uleb128 .LVU237
+	.uleb128 .LVU237
+	.uleb128 .LVU237
+	.uleb128 .LVU237
+	.uleb128 0
+.LLST23:
+	.byte	0x4
+	.uleb128 .LVL43-.Ltext0
+	.uleb128 .LVL44-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL44-.Ltext0
+	.uleb128 .LVL48-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0x4
+	.uleb128 .LVL48-.Ltext0
+	.uleb128 .LVL49-.Ltext0
+	.uleb128 0x3
+	.byte	0x76
+	.sleb128 -32
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL49-.Ltext0
+	.uleb128 .LVL52-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL52-.Ltext0
+	.uleb128 .LVL57-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0x4
+	.uleb128 .LVL57-.Ltext0
+	.uleb128 .LVL58-.Ltext0
+	.uleb128 0x3
+	.byte	0x76
+	.sleb128 -32
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL58-.Ltext0
+	.uleb128 .LVL61-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL61-.Ltext0
+	.uleb128 .LVL68-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0x4
+	.uleb128 .LVL68-.Ltext0
+	.uleb128 .LVL69-.Ltext0
+	.uleb128 0x3
+	.byte	0x76
+	.sleb128 -32
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL69-.Ltext0
+	.uleb128 .LVL71-1-.Ltext0
+	.uleb128 0x3
+	.byte	0x75
+	.sleb128 -32
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL71-1-.Ltext0
+	.uleb128 .LVL71-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL71-.Ltext0
+	.uleb128 .LFE45-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0
+.LVUS24:
+	.uleb128 .LVU200
+	.uleb128 .LVU207
+	.uleb128 .LVU207
+	.uleb128 .LVU214
+	.uleb128 .LVU214
+	.uleb128 .LVU216
+	.uleb128 .LVU216
+	.uleb128 .LVU221
+	.uleb128 .LVU221
+	.uleb128 .LVU222
+	.uleb128 .LVU222
+	.uleb128 .LVU235
+	.uleb128 .LVU237
+	.uleb128 .LVU238
+	.uleb128 .LVU238
+	.uleb128 .LVU239
+	.uleb128 .LVU239
+	.uleb128 0
+.LLST24:
+	.byte	0x4
+	.uleb128 .LVL54-.Ltext0
+	.uleb128 .LVL55-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL55-1-.Ltext0
+	.uleb128 .LVL59-.Ltext0
+	.uleb128 0x1
+	.byte	0x5c
+	.byte	0x4
+	.uleb128 .LVL59-.Ltext0
+	.uleb128 .LVL61-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL61-.Ltext0
+	.uleb128 .LVL64-.Ltext0
+	.uleb128 0x1
+	.byte	0x5c
+	.byte	0x4
+	.uleb128 .LVL64-.Ltext0
+	.uleb128 .LVL65-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL65-1-.Ltext0
+	.uleb128 .LVL70-.Ltext0
+	.uleb128 0x1
+	.byte	0x5c
+	.byte	0x4
+	.uleb128 .LVL71-.Ltext0
+	.uleb128 .LVL72-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL72-1-.Ltext0
+	.uleb128 .LVL73-.Ltext0
+	.uleb128 0x1
+	.byte	0x5c
+	.byte	0x4
+	.uleb128 .LVL73-.Ltext0
+	.uleb128 .LFE45-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0
+.LVUS25:
+	.uleb128 .LVU190
+	.uleb128 .LVU196
+	.uleb128 .LVU198
+	.uleb128 .LVU200
+	.uleb128 .LVU208
+	.uleb128 .LVU216
+	.uleb128 .LVU221
+	.uleb128 .LVU224
+	.uleb128 .LVU237
+	.uleb128 .LVU239
+.LLST25:
+	.byte	0x4
+	.uleb128 .LVL46-.Ltext0
+	.uleb128 .LVL50-.Ltext0
+	.uleb128 0x1
+	.byte	0x5c
+	.byte	0x4
+	.uleb128 .LVL52-.Ltext0
+	.uleb128 .LVL54-.Ltext0
+	.uleb128 0x1
+	.byte	0x5c
+	.byte	0x4
+	.uleb128 .LVL56-.Ltext0
+	.uleb128 .LVL61-.Ltext0
+	.uleb128 0x2
+	.byte	0x30
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL64-.Ltext0
+	.uleb128 .LVL66-.Ltext0
+	.uleb128 0x2
+	.byte	0x35
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL71-.Ltext0
+	.uleb128 .LVL73-.Ltext0
+	.uleb128 0x1
+	.byte	0x5d
+	.byte	0
+.LVUS0:
+	.uleb128 0
+	.uleb128 .LVU27
+	.uleb128 .LVU27
+	.uleb128 .LVU93
+	.uleb128 .LVU93
+	.uleb128 .LVU94
+	.uleb128 .LVU94
+	.uleb128 0
+.LLST0:
+	.byte	0x4
+	.uleb128 .LVL0-.Ltext0
+	.uleb128 .LVL6-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL6-.Ltext0
+	.uleb128 .LVL22-.Ltext0
+	.uleb128 0x1
+	.byte	0x5e
+	.byte	0x4
+	.uleb128 .LVL22-.Ltext0
+	.uleb128 .LVL23-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL23-.Ltext0
+	.uleb128 .LFE44-.Ltext0
+	.uleb128 0x1
+	.byte	0x5e
+	.byte	0
+.LVUS1:
+	.uleb128 0
+	.uleb128 .LVU16
+	.uleb128 .LVU16
+	.uleb128 .LVU37
+	.uleb128 .LVU37
+	.uleb128 .LVU53
+	.uleb128 .LVU53
+	.uleb128 0
+.LLST1:
+	.byte	0x4
+	.uleb128 .LVL0-.Ltext0
+	.uleb128 .LVL3-.Ltext0
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x4
+	.uleb128 .LVL3-.Ltext0
+	.uleb128 .LVL8-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL8-.Ltext0
+	.uleb128 .LVL10-1-.Ltext0
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -744
+	.byte	0x4
+	.uleb128 .LVL10-1-.Ltext0
+	.uleb128 .LFE44-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x9f
+	.byte	0
+.LVUS2:
+	.uleb128 0
+	.uleb128 .LVU15
+	.uleb128 .LVU15
+	.uleb128 .LVU92
+	.uleb128 .LVU92
+	.uleb128 .LVU94
+	.uleb128 .LVU94
+	.uleb128 0
+.LLST2:
+	.byte	0x4
+	.uleb128 .LVL0-.Ltext0
+	.uleb128 .LVL2-.Ltext0
+	.uleb128 0x1
+	.byte	0x51
+	.byte	0x4
+	.uleb128 .LVL2-.Ltext0
+	.uleb128 .LVL21-.Ltext0
+	.uleb128 0x1
+	.byte	0x5c
+	.byte	0x4
+	.uleb128 .LVL21-.Ltext0
+	.uleb128 .LVL23-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x51
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL23-.Ltext0
+	.uleb128 .LFE44-.Ltext0
+	.uleb128 0x1
+	.byte	0x5c
+	.byte	0
+.LVUS3:
+	.uleb128 0
+	.uleb128 .LVU53
+	.uleb128 .LVU53
+	.uleb128 0
+.LLST3:
+	.byte	0x4
+	.uleb128 .LVL0-.Ltext0
+	.uleb128 .LVL10-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x52
+	.byte	0x4
+	.uleb128 .LVL10-1-.Ltext0
+	.uleb128 .LFE44-.Ltext0
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -776
+	.byte	0
+.LVUS4:
+	.uleb128 .LVU11
+	.uleb128 .LVU89
+	.uleb128 .LVU94
+	.uleb128 .LVU120
+	.uleb128 .LVU124
+	.uleb128 .LVU142
+	.uleb128 .LVU144
+	.uleb128 .LVU166
+	.uleb128 .LVU168
+	.uleb128 .LVU173
+.LLST4:
+	.byte	0x4
+	.uleb128 .LVL1-.Ltext0
+	.uleb128 .LVL19-.Ltext0
+	.uleb128 0x1
+	.byte	0x56
+	.byte	0x4
+	.uleb128 .LVL23-.Ltext0
+	.uleb128 .LVL28-.Ltext0
+	.uleb128 0x1
+	.byte	0x56
+	.byte	0x4
+	.uleb128 .LVL30-.Ltext0
+	.uleb128 .LVL34-.Ltext0
+	.uleb128 0x1
+	.byte	0x56
+	.byte	0x4
+	.uleb128 .LVL35-.Ltext0
+	.uleb128 .LVL38-.Ltext0
+	.uleb128 0x1
+	.byte	0x56
+	.byte	0x4
+	.uleb128 .LVL39-.Ltext0
+	.uleb128 .LVL41-.Ltext0
+	.uleb128 0x1
+	.byte	0x56
+	.byte	0
+.LVUS5:
+	.uleb128 .LVU23
+	.uleb128 .LVU27
+	.uleb128 .LVU27
+	.uleb128 .LVU53
+.LLST5:
+	.byte	0x4
+	.uleb128 .LVL4-.Ltext0
+	.uleb128 .LVL6-.Ltext0
+	.uleb128 0xf
+	.byte	0x7f
+	.sleb128 0
+	.byte	0x12
+	.byte	0x75
+	.sleb128 8
+	.byte	0x6
+	.byte	0x16
+	.byte	0x14
+	.byte	0x2d
+	.byte	0x28
+	.value	0x1
+	.byte	0x16
+	.byte	0x13
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL6-.Ltext0
+	.uleb128 .LVL10-1-.Ltext0
+	.uleb128 0xf
+	.byte	0x7f
+	.sleb128 0
+	.byte	0x12
+	.byte	0x7e
+	.sleb128 8
+	.byte	0x6
+	.byte	0x16
+	.byte	0x14
+	.byte	0x2d
+	.byte	0x28
+	.value	0x1
+	.byte	0x16
+	.byte	0x13
+	.byte	0x9f
+	.byte	0
+.LVUS10:
+	.uleb128 .LVU67
+	.uleb128 .LVU89
+	.uleb128 .LVU89
+	.uleb128 .LVU91
+	.uleb128 .LVU94
+	.uleb128 .LVU107
+	.uleb128 .LVU107
+	.uleb128 .LVU117
+	.uleb128 .LVU117
+	.uleb128 .LVU123
+	.uleb128 .LVU124
+	.uleb128 .LVU129
+	.uleb128 .LVU129
+	.uleb128 .LVU144
+	.uleb128 .LVU168
+	.uleb128 .LVU173
+	.uleb128 .LVU173
+	.uleb128 0
+.LLST10:
+	.byte	0x4
+	.uleb128 .LVL12-.Ltext0
+	.uleb128 .LVL19-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0x4
+	.uleb128 .LVL19-.Ltext0
+	.uleb128 .LVL20-.Ltext0
+	.uleb128 0x1b
+	.byte	0x91
+	.sleb128 -808
+	.byte	0x6
+	.byte	0x76
+	.sleb128 0
+	.byte	0x1c
+	.byte	0x40
+	.byte	0x40
+	.byte	0x24
+	.byte	0x91
+	.sleb128 -808
+	.byte	0x6
+	.byte	0x76
+	.sleb128 0
+	.byte	0x1c
+	.byte	0x40
+	.byte	0x40
+	.byte	0x24
+	.byte	0x2c
+	.byte	0x28
+	.value	0x1
+	.byte	0x16
+	.byte	0x13
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL23-.Ltext0
+	.uleb128 .LVL25-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0x4
+	.uleb128 .LVL25-.Ltext0
+	.uleb128 .LVL26-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x51
+	.byte	0x4
+	.uleb128 .LVL26-1-.Ltext0
+	.uleb128 .LVL29-.Ltext0
+	.uleb128 0x1b
+	.byte	0x91
+	.sleb128 -808
+	.byte	0x6
+	.byte	0x76
+	.sleb128 0
+	.byte	0x1c
+	.byte	0x40
+	.byte	0x40
+	.byte	0x24
+	.byte	0x91
+	.sleb128 -808
+	.byte	0x6
+	.byte	0x76
+	.sleb128 0
+	.byte	0x1c
+	.byte	0x40
+	.byte	0x40
+	.byte	0x24
+	.byte	0x2c
+	.byte	0x28
+	.value	0x1
+	.byte	0x16
+	.byte	0x13
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL30-.Ltext0
+	.uleb128 .LVL31-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0x4
+	.uleb128 .LVL31-.Ltext0
+	.uleb128 .LVL35-.Ltext0
+	.uleb128 0x1b
+	.byte	0x91
+	.sleb128 -808
+	.byte	0x6
+	.byte	0x76
+	.sleb128 0
+	.byte	0x1c
+	.byte	0x40
+	.byte	0x40
+	.byte	0x24
+	.byte	0x91
+	.sleb128 -808
+	.byte	0x6
+	.byte	0x76
+	.sleb128 0
+	.byte	0x1c
+	.byte	0x40
+	.byte	0x40
+	.byte	0x24
+	.byte	0x2c
+	.byte	0x28
+	.value	0x1
+	.byte	0x16
+	.byte	0x13
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL39-.Ltext0
+	.uleb128 .LVL41-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0x4
+	.uleb128 .LVL41-.Ltext0
+	.uleb128 .LFE44-.Ltext0
+	.uleb128 0x1b
+	.byte	0x91
+	.sleb128 -808
+	.byte	0x6
+	.byte	0x76
+	.sleb128 0
+	.byte	0x1c
+	.byte	0x40
+	.byte	0x40
+	.byte	0x24
+	.byte	0x91
+	.sleb128 -808
+	.byte	0x6
+	.byte	0x76
+	.sleb128 0
+	.byte	0x1c
+	.byte	0x40
+	.byte	0x40
+	.byte	0x24
+	.byte	0x2c
+	.byte	0x28
+	.value	0x1
+	.byte	0x16
+	.byte	0x13
+	.byte	0x9f
+	.byte	0
+.LVUS11:
+	.uleb128 .LVU95
+	.uleb128 .LVU105
+	.uleb128 .LVU168
+	.uleb128 .LVU173
+.LLST11:
+	.byte	0x4
+	.uleb128 .LVL23-.Ltext0
+	.uleb128 .LVL24-.Ltext0
+	.uleb128 0x1
+	.byte	0x5f
+	.byte	0x4
+	.uleb128 .LVL39-.Ltext0
+	.uleb128 .LVL41-.Ltext0
+	.uleb128 0x1
+	.byte	0x5f
+	.byte	0
+.LVUS12:
+	.uleb128 .LVU117
+	.uleb128 .LVU118
+	.uleb128 .LVU139
+	.uleb128 .LVU140
+	.uleb128 .LVU163
+	.uleb128 .LVU164
+.LLST12:
+	.byte	0x4
+	.uleb128 .LVL26-.Ltext0
+	.uleb128 .LVL27-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL32-.Ltext0
+	.uleb128 .LVL33-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL36-.Ltext0
+	.uleb128 .LVL37-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0
+.LVUS14:
+	.uleb128 .LVU68
+	.uleb128 .LVU87
+	.uleb128 .LVU94
+	.uleb128 .LVU95
+	.uleb128 .LVU147
+	.uleb128 .LVU151
+.LLST14:
+	.byte	0x4
+	.uleb128 .LVL12-.Ltext0
+	.uleb128 .LVL18-.Ltext0
+	.uleb128 0x1
+	.byte	0x56
+	.byte	0x4
+	.uleb128 .LVL23-.Ltext0
+	.uleb128 .LVL23-.Ltext0
+	.uleb128 0x1
+	.byte	0x56
+	.byte	0x4
+	.uleb128 .LVL35-.Ltext0
+	.uleb128 .LVL35-.Ltext0
+	.uleb128 0x1
+	.byte	0x56
+	.byte	0
+.LVUS15:
+	.uleb128 .LVU68
+	.uleb128 .LVU87
+	.uleb128 .LVU94
+	.uleb128 .LVU95
+.LLST15:
+	.byte	0x4
+	.uleb128 .LVL12-.Ltext0
+	.uleb128 .LVL18-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0x4
+	.uleb128 .LVL23-.Ltext0
+	.uleb128 .LVL23-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0
+.LVUS16:
+	.uleb128 .LVU68
+	.uleb128 .LVU87
+	.uleb128 .LVU94
+	.uleb128 .LVU95
+	.uleb128 .LVU147
+	.uleb128 .LVU151
+.LLST16:
+	.byte	0x4
+	.uleb128 .LVL12-.Ltext0
+	.uleb128 .LVL18-.Ltext0
+	.uleb128 0x1
+	.byte	0x5c
+	.byte	0x4
+	.uleb128 .LVL23-.Ltext0
+	.uleb128 .LVL23-.Ltext0
+	.uleb128 0x1
+	.byte	0x5c
+	.byte	0x4
+	.uleb128 .LVL35-.Ltext0
+	.uleb128 .LVL35-.Ltext0
+	.uleb128 0x1
+	.byte	0x5c
+	.byte	0
+.LVUS17:
+	.uleb128 .LVU68
+	.uleb128 .LVU87
+	.uleb128 .LVU94
+	.uleb128 .LVU95
+	.uleb128 .LVU147
+	.uleb128 .LVU151
+.LLST17:
+	.byte	0x4
+	.uleb128 .LVL12-.Ltext0
+	.uleb128 .LVL18-.Ltext0
+	.uleb128 0x1
+	.byte	0x5d
+	.byte	0x4
+	.uleb128 .LVL23-.Ltext0
+	.uleb128 .LVL23-.Ltext0
+	.uleb128 0x1
+	.byte	0x5d
+	.byte	0x4
+	.uleb128 .LVL35-.Ltext0
+	.uleb128 .LVL35-.Ltext0
+	.uleb128 0x2
+	.byte	0x7e
+	.sleb128 0
+	.byte	0
+.LVUS18:
+	.uleb128 .LVU70
+	.uleb128 .LVU73
+	.uleb128 .LVU73
+	.uleb128 .LVU87
+	.uleb128 .LVU94
+	.uleb128 .LVU95
+	.uleb128 .LVU149
+	.uleb128 .LVU151
+.LLST18:
+	.byte	0x4
+	.uleb128 .LVL12-.Ltext0
+	.uleb128 .LVL13-.Ltext0
+	.uleb128 0x2
+	.byte	0x30
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL13-.Ltext0
+	.uleb128 .LVL18-.Ltext0
+	.uleb128 0x1
+	.byte	0x5f
+	.byte	0x4
+	.uleb128 .LVL23-.Ltext0
+	.uleb128 .LVL23-.Ltext0
+	.uleb128 0x1
+	.byte	0x5f
+	.byte	0x4
+	.uleb128 .LVL35-.Ltext0
+	.uleb128 .LVL35-.Ltext0
+	.uleb128 0x2
+	.byte	0x30
+	.byte	0x9f
+	.byte	0
+.LVUS20:
+	.uleb128 .LVU73
+	.uleb128 .LVU77
+	.uleb128 .LVU83
+	.uleb128 .LVU86
+.LLST20:
+	.byte	0x4
+	.uleb128 .LVL13-.Ltext0
+	.uleb128 .LVL14-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL16-.Ltext0
+	.uleb128 .LVL17-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0
+.LVUS7:
+	.uleb128 .LVU24
+	.uleb128 .LVU31
+	.uleb128 .LVU31
+	.uleb128 .LVU48
+.LLST7:
+	.byte	0x4
+	.uleb128 .LVL5-.Ltext0
+	.uleb128 .LVL7-.Ltext0
+	.uleb128 0x1
+	.byte	0x51
+	.byte	0x4
+	.uleb128 .LVL7-.Ltext0
+	.uleb128 .LVL9-.Ltext0
+	.uleb128 0x2
+	.byte	0x7e
+	.sleb128 24
+	.byte	0
+.LVUS8:
+	.uleb128 .LVU24
+	.uleb128 .LVU48
+.LLST8:
+	.byte	0x4
+	.uleb128 .LVL5-.Ltext0
+	.uleb128 .LVL9-.Ltext0
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0
+.LVUS111:
+	.uleb128 0
+	.uleb128 .LVU781
+	.uleb128 .LVU781
+	.uleb128 0
+.LLST111:
+	.byte	0x4
+	.uleb128 .LVL287-.Ltext0
+	.uleb128 .LVL288-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL288-1-.Ltext0
+	.uleb128 .LFE41-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x9f
+	.byte	0
+.LVUS112:
+	.uleb128 0
+	.uleb128 .LVU781
+	.uleb128 .LVU781
+	.uleb128 0
+.LLST112:
+	.byte	0x4
+	.uleb128 .LVL287-.Ltext0
+	.uleb128 .LVL288-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x4
+	.uleb128 .LVL288-1-.Ltext0
+	.uleb128 .LFE41-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x9f
+	.byte	0
+.LVUS54:
+	.uleb128 0
+	.uleb128 .LVU386
+	.uleb128 .LVU386
+	.uleb128 0
+.LLST54:
+	.byte	0x4
+	.uleb128 .LVL135-.Ltext0
+	.uleb128 .LVL136-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL136-.Ltext0
+	.uleb128 .LFE40-.Ltext0
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -448
+	.byte	0
+.LVUS55:
+	.uleb128 0
+	.uleb128 .LVU388
+	.uleb128 .LVU388
+	.uleb128 0
+.LLST55:
+	.byte	0x4
+	.uleb128 .LVL135-.Ltext0
+	.uleb128 .LVL137-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x4
+	.uleb128 .LVL137-1-.Ltext0
+	.uleb128 .LFE40-.Ltext0
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -456
+	.byte	0
+.LVUS56:
+	.uleb128 0
+	.uleb128 .LVU388
+	.uleb128 .LVU388
+	.uleb128 .LVU410
+	.uleb128 .LVU440
+	.uleb128 .LVU446
+	.uleb128 .LVU446
+	.uleb128 .LVU455
+	.uleb128 .LVU543
+	.uleb128 .LVU551
+.LLST56:
+	.byte	0x4
+	.uleb128 .LVL135-.Ltext0
+	.uleb128 .LVL137-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x51
+	.byte	0x4
+	.uleb128 .LVL137-1-.Ltext0
+	.uleb128 .LVL143-.Ltext0
+	.uleb128 0x1
+	.byte	0x5e
+	.byte	0x4
+	.uleb128 .LVL157-.Ltext0
+	.uleb128 .LVL159-.Ltext0
+	.uleb128 0x1
+	.byte	0x5e
+	.byte	0x4
+	.uleb128 .LVL159-.Ltext0
+	.uleb128 .LVL161-.Ltext0
+	.uleb128 0xa
+	.byte	0x3
+	.quad	defaults.0
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL191-.Ltext0
+	.uleb128 .LVL196-.Ltext0
+	.uleb128 0x1
+	.byte	0x5e
+	.byte	0
+.LVUS57:
+	.uleb128 .LVU389
+	.uleb128 .LVU398
+	.uleb128 .LVU398
+	.uleb128 .LVU414
+	.uleb128 .LVU440
+	.uleb128 .LVU446
+	.uleb128 .LVU446
+	.uleb128 .LVU450
+	.uleb128 .LVU450
+	.uleb128 .LVU487
+	.uleb128 .LVU487
+	.uleb128 .LVU519
+	.uleb128 .LVU543
+	.uleb128 .LVU582
+	.uleb128 .LVU606
+	.uleb128 .LVU618
+	.uleb128 .LVU630
+	.uleb128 .LVU634
+	.uleb128 .LVU645
+	.uleb128 .LVU674
+	.uleb128 .LVU734
+	.uleb128 .LVU749
+	.uleb128 .LVU749
+	.uleb128 .LVU751
+	.uleb128 .LVU751
+	.uleb128 .LVU765
+	.uleb128 .LVU772
+	.uleb128 0
+.LLST57:
+	.byte	0x4
+	.uleb128 .LVL138-.Ltext0
+	.uleb128 .LVL139-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL139-.Ltext0
+	.uleb128 .LVL145-.Ltext0
+	.uleb128 0x1
+	.byte	0x5d
+	.byte	0x4
+	.uleb128 .LVL157-.Ltext0
+	.uleb128 .LVL159-.Ltext0
+	.uleb128 0x1
+	.byte	0x5d
+	.byte	0x4
+	.uleb128 .LVL159-.Ltext0
+	.uleb128 .LVL160-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL160-1-.Ltext0
+	.uleb128 .LVL173-.Ltext0
+	.uleb128 0x1
+	.byte	0x5d
+	.byte	0x4
+	.uleb128 .LVL173-.Ltext0
+	.uleb128 .LVL184-.Ltext0
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -416
+	.byte	0x4
+	.uleb128 .LVL191-.Ltext0
+	.uleb128 .LVL209-.Ltext0
+	.uleb128 0x1
+	.byte	0x5d
+	.byte	0x4
+	.uleb128 .LVL220-.Ltext0
+	.uleb128 .LVL225-.Ltext0
+	.uleb128 0x1
+	.byte	0x5d
+	.byte	0x4
+	.uleb128 .LVL229-.Ltext0
+	.uleb128 .LVL231-.Ltext0
+	.uleb128 0x1
+	.byte	0x5d
+	.byte	0x4
+	.uleb128 .LVL236-.Ltext0
+	.uleb128 .LVL249-.Ltext0
+	.uleb128 0x1
+	.byte	0x5d
+	.byte	0x4
+	.uleb128 .LVL269-.Ltext0
+	.uleb128 .LVL276-.Ltext0
+	.uleb128 0x1
+	.byte	0x5d
+	.byte	0x4
+	.uleb128 .LVL276-.Ltext0
+	.uleb128 .LVL278-.Ltext0
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -416
+	.byte	0x4
+	.uleb128 .LVL278-.Ltext0
+	.uleb128 .LVL282-.Ltext0
+	.uleb128 0x1
+	.byte	0x5d
+	.byte	0x4
+	.uleb128 .LVL286-.Ltext0
+	.uleb128 .LFE40-.Ltext0
+	.uleb128 0x1
+	.byte	0x5d
+	.byte	0
+.LVUS58:
+	.uleb128 .LVU399
+	.uleb128 .LVU407
+	.uleb128 .LVU407
+	.uleb128 .LVU408
+	.uleb128 .LVU440
+	.uleb128 .LVU446
+	.uleb128 .LVU446
+	.uleb128 .LVU455
+	.uleb128 .LVU543
+	.uleb128 .LVU545
+	.uleb128 .LVU545
+	.uleb128 .LVU546
+	.uleb128 .LVU546
+	.uleb128 .LVU551
+.LLST58:
+	.byte	0x4
+	.uleb128 .LVL140-.Ltext0
+	.uleb128 .LVL141-.Ltext0
+	.uleb128 0x1
+	.byte	0x5f
+	.byte	0x4
+	.uleb128 .LVL141-.Ltext0
+	.uleb128 .LVL142-1-.Ltext0
+	.uleb128 0x7
+	.byte	0x7e
+	.sleb128 4
+	.byte	0x94
+	.byte	0x4
+	.byte	0x31
+	.byte	0x1a
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL157-.Ltext0
+	.uleb128 .LVL159-.Ltext0
+	.uleb128 0x1
+	.byte	0x5f
+	.byte	0x4
+	.uleb128 .LVL159-.Ltext0
+	.uleb128 .LVL161-.Ltext0
+	.uleb128 0x2
+	.byte	0x30
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL191-.Ltext0
+	.uleb128 .LVL193-.Ltext0
+	.uleb128 0x1
+	.byte	0x5f
+	.byte	0x4
+	.uleb128 .LVL193-.Ltext0
+	.uleb128 .LVL194-.Ltext0
+	.uleb128 0x7
+	.byte	0x7e
+	.sleb128 4
+	.byte	0x94
+	.byte	0x4
+	.byte	0x31
+	.byte	0x1a
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL194-.Ltext0
+	.uleb128 .LVL196-.Ltext0
+	.uleb128 0x1
+	.byte	0x5f
+	.byte	0
+.LVUS59:
+	.uleb128 .LVU467
+	.uleb128 .LVU487
+	.uleb128 .LVU487
+	.uleb128 .LVU534
+	.uleb128 .LVU551
+	.uleb128 .LVU560
+	.uleb128 .LVU560
+	.uleb128 .LVU565
+	.uleb128 .LVU565
+	.uleb128 .LVU585
+	.uleb128 .LVU606
+	.uleb128 .LVU630
+	.uleb128 .LVU645
+	.uleb128 .LVU654
+	.uleb128 .LVU654
+	.uleb128 .LVU734
+	.uleb128 .LVU734
+	.uleb128 .LVU741
+	.uleb128 .LVU741
+	.uleb128 0
+.LLST59:
+	.byte	0x4
+	.uleb128 .LVL164-.Ltext0
+	.uleb128 .LVL173-.Ltext0
+	.uleb128 0x1
+	.byte	0x5d
+	.byte	0x4
+	.uleb128 .LVL173-.Ltext0
+	.uleb128 .LVL188-.Ltext0
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -440
+	.byte	0x4
+	.uleb128 .LVL196-.Ltext0
+	.uleb128 .LVL201-.Ltext0
+	.uleb128 0x1
+	.byte	0x5d
+	.byte	0x4
+	.uleb128 .LVL201-.Ltext0
+	.uleb128 .LVL202-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL202-.Ltext0
+	.uleb128 .LVL211-.Ltext0
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -440
+	.byte	0x4
+	.uleb128 .LVL220-.Ltext0
+	.uleb128 .LVL229-.Ltext0
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -440
+	.byte	0x4
+	.uleb128 .LVL236-.Ltext0
+	.uleb128 .LVL240-.Ltext0
+	.uleb128 0x1
+	.byte	0x5d
+	.byte	0x4
+	.uleb128 .LVL240-.Ltext0
+	.uleb128 .LVL269-.Ltext0
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -440
+	.byte	0x4
+	.uleb128 .LVL269-.Ltext0
+	.uleb128 .LVL273-.Ltext0
+	.uleb128 0x1
+	.byte	0x5d
+	.byte	0x4
+	.uleb128 .LVL273-.Ltext0
+	.uleb128 .LFE40-.Ltext0
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -440
+	.byte	0
+.LVUS60:
+	.uleb128 .LVU390
+	.uleb128 .LVU430
+	.uleb128 .LVU440
+	.uleb128 .LVU472
+	.uleb128 .LVU543
+	.uleb128 .LVU568
+	.uleb128 .LVU573
+	.uleb128 .LVU576
+	.uleb128 .LVU576
+	.uleb128 .LVU585
+	.uleb128 .LVU606
+	.uleb128 .LVU609
+	.uleb128 .LVU609
+	.uleb128 .LVU611
+	.uleb128 .LVU630
+	.uleb128 .LVU645
+	.uleb128 .LVU650
+	.uleb128 .LVU652
+	.uleb128 .LVU704
+	.uleb128 .LVU717
+	.uleb128 .LVU731
+	.uleb128 .LVU734
+	.uleb128 .LVU734
+	.uleb128 .LVU738
+	.uleb128 .LVU738
+	.uleb128 .LVU740
+	.uleb128 .LVU745
+	.uleb128 .LVU749
+	.uleb128 .LVU756
+	.uleb128 .LVU765
+.LLST60:
+	.byte	0x4
+	.uleb128 .LVL138-.Ltext0
+	.uleb128 .LVL153-.Ltext0
+	.uleb128 0x2
+	.byte	0x30
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL157-.Ltext0
+	.uleb128 .LVL165-.Ltext0
+	.uleb128 0x2
+	.byte	0x30
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL191-.Ltext0
+	.uleb128 .LVL203-.Ltext0
+	.uleb128 0x2
+	.byte	0x30
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL205-.Ltext0
+	.uleb128 .LVL206-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL206-.Ltext0
+	.uleb128 .LVL211-.Ltext0
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -432
+	.byte	0x4
+	.uleb128 .LVL220-.Ltext0
+	.uleb128 .LVL222-.Ltext0
+	.uleb128 0x2
+	.byte	0x30
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL222-.Ltext0
+	.uleb128 .LVL223-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL229-.Ltext0
+	.uleb128 .LVL236-.Ltext0
+	.uleb128 0x2
+	.byte	0x30
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL238-.Ltext0
+	.uleb128 .LVL239-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL259-.Ltext0
+	.uleb128 .LVL263-.Ltext0
+	.uleb128 0x3
+	.byte	0x9
+	.byte	0xff
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL268-.Ltext0
+	.uleb128 .LVL269-.Ltext0
+	.uleb128 0x2
+	.byte	0x31
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL269-.Ltext0
+	.uleb128 .LVL271-.Ltext0
+	.uleb128 0x2
+	.byte	0x30
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL271-.Ltext0
+	.uleb128 .LVL272-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL275-.Ltext0
+	.uleb128 .LVL276-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL280-.Ltext0
+	.uleb128 .LVL282-.Ltext0
+	.uleb128 0x3
+	.byte	0x9
+	.byte	0xff
+	.byte	0x9f
+	.byte	0
+.LVUS61:
+	.uleb128 .LVU400
+	.uleb128 .LVU407
+	.uleb128 .LVU442
+	.uleb128 .LVU446
+	.uleb128 .LVU543
+	.uleb128 .LVU544
+.LLST61:
+	.byte	0x4
+	.uleb128 .LVL140-.Ltext0
+	.uleb128 .LVL141-.Ltext0
+	.uleb128 0x1
+	.byte	0x56
+	.byte	0x4
+	.uleb128 .LVL158-.Ltext0
+	.uleb128 .LVL159-.Ltext0
+	.uleb128 0x4
+	.byte	0x40
+	.byte	0x40
+	.byte	0x24
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL191-.Ltext0
+	.uleb128 .LVL192-.Ltext0
+	.uleb128 0x1
+	.byte	0x56
+	.byte	0
+.LVUS103:
+	.uleb128 .LVU580
+	.uleb128 .LVU585
+	.uleb128 .LVU623
+	.uleb128 .LVU630
+	.uleb128 .LVU711
+	.uleb128 .LVU717
+	.uleb128 .LVU759
+	.uleb128 .LVU765
+.LLST103:
+	.byte	0x4
+	.uleb128 .LVL208-.Ltext0
+	.uleb128 .LVL211-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0x4
+	.uleb128 .LVL227-.Ltext0
+	.uleb128 .LVL229-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0x4
+	.uleb128 .LVL261-.Ltext0
+	.uleb128 .LVL263-.Ltext0
+	.uleb128 0x1
+	.byte	0x56
+	.byte	0x4
+	.uleb128 .LVL280-.Ltext0
+	.uleb128 .LVL282-.Ltext0
+	.uleb128 0x2
+	.byte	0x3c
+	.byte	0x9f
+	.byte	0
+.LVUS62:
+	.uleb128 .LVU416
+	.uleb128 .LVU430
+.LLST62:
+	.byte	0x4
+	.uleb128 .LVL146-.Ltext0
+	.uleb128 .LVL153-.Ltext0
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -448
+	.byte	0
+.LVUS63:
+	.uleb128 .LVU416
+	.uleb128 .LVU430
+.LLST63:
+	.byte	0x4
+	.uleb128 .LVL146-.Ltext0
+	.uleb128 .LVL153-.Ltext0
+	.uleb128 0x1
+	.byte	0x56
+	.byte	0
+.LVUS64:
+	.uleb128 .LVU416
+	.uleb128 .LVU430
+.LLST64:
+	.byte	0x4
+	.uleb128 .LVL146-.Ltext0
+	.uleb128 .LVL153-.Ltext0
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -456
+	.byte	0
+.LVUS65:
+	.uleb128 .LVU416
+	.uleb128 .LVU430
+.LLST65:
+	.byte	0x4
+	.uleb128 .LVL146-.Ltext0
+	.uleb128 .LVL153-.Ltext0
+	.uleb128 0x1
+	.byte	0x5c
+	.byte	0
+.LVUS66:
+	.uleb128 .LVU419
+	.uleb128 .LVU421
+	.uleb128 .LVU421
+	.uleb128 .LVU430
+.LLST66:
+	.byte	0x4
+	.uleb128 .LVL148-.Ltext0
+	.uleb128 .LVL149-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL149-.Ltext0
+	.uleb128 .LVL153-.Ltext0
+	.uleb128 0x1
+	.byte	0x5d
+	.byte	0
+.LVUS68:
+	.uleb128 .LVU421
+	.uleb128 .LVU423
+	.uleb128 .LVU428
+	.uleb128 .LVU430
+.LLST68:
+	.byte	0x4
+	.uleb128 .LVL149-.Ltext0
+	.uleb128 .LVL150-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL152-.Ltext0
+	.uleb128 .LVL153-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0
+.LVUS70:
+	.uleb128 .LVU592
+	.uleb128 .LVU606
+.LLST70:
+	.byte	0x4
+	.uleb128 .LVL213-.Ltext0
+	.uleb128 .LVL220-.Ltext0
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -448
+	.byte	0
+.LVUS71:
+	.uleb128 .LVU592
+	.uleb128 .LVU606
+.LLST71:
+	.byte	0x4
+	.uleb128 .LVL213-.Ltext0
+	.uleb128 .LVL220-.Ltext0
+	.uleb128 0x1
+	.byte	0x56
+	.byte	0
+.LVUS72:
+	.uleb128 .LVU592
+	.uleb128 .LVU606
+.LLST72:
+	.byte	0x4
+	.uleb128 .LVL213-.Ltext0
+	.uleb128 .LVL220-.Ltext0
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -456
+	.byte	0
+.LVUS73:
+	.uleb128 .LVU592
+	.uleb128 .LVU606
+.LLST73:
+	.byte	0x4
+	.uleb128 .LVL213-.Ltext0
+	.uleb128 .LVL220-.Ltext0
+	.uleb128 0x4
+	.byte	0x91
+	.sleb128 -336
+	.byte	0x9f
+	.byte	0
+.LVUS74:
+	.uleb128 .LVU595
+	.uleb128 .LVU597
+	.uleb128 .LVU597
+	.uleb128 .LVU606
+.LLST74:
+	.byte	0x4
+	.uleb128 .LVL215-.Ltext0
+	.uleb128 .LVL216-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL216-.Ltext0
+	.uleb128 .LVL220-.Ltext0
+	.uleb128 0x1
+	.byte	0x5d
+	.byte	0
+.LVUS76:
+	.uleb128 .LVU597
+	.uleb128 .LVU599
+	.uleb128 .LVU604
+	.uleb128 .LVU606
+.LLST76:
+	.byte	0x4
+	.uleb128 .LVL216-.Ltext0
+	.uleb128 .LVL217-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL219-.Ltext0
+	.uleb128 .LVL220-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0
+.LVUS78:
+	.uleb128 .LVU475
+	.uleb128 .LVU478
+	.uleb128 .LVU478
+	.uleb128 .LVU485
+	.uleb128 .LVU656
+	.uleb128 .LVU659
+.LLST78:
+	.byte	0x4
+	.uleb128 .LVL166-.Ltext0
+	.uleb128 .LVL167-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x5a
+	.byte	0x4
+	.uleb128 .LVL167-1-.Ltext0
+	.uleb128 .LVL171-.Ltext0
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -432
+	.byte	0x4
+	.uleb128 .LVL241-.Ltext0
+	.uleb128 .LVL242-1-.Ltext0
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -160
+	.byte	0
+.LVUS79:
+	.uleb128 .LVU475
+	.uleb128 .LVU478
+	.uleb128 .LVU478
+	.uleb128 .LVU484
+	.uleb128 .LVU495
+	.uleb128 .LVU498
+	.uleb128 .LVU656
+	.uleb128 .LVU659
+	.uleb128 .LVU749
+	.uleb128 .LVU751
+.LLST79:
+	.byte	0x4
+	.uleb128 .LVL166-.Ltext0
+	.uleb128 .LVL167-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x5b
+	.byte	0x4
+	.uleb128 .LVL167-1-.Ltext0
+	.uleb128 .LVL170-.Ltext0
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -440
+	.byte	0x4
+	.uleb128 .LVL178-.Ltext0
+	.uleb128 .LVL179-.Ltext0
+	.uleb128 0x1
+	.byte	0x58
+	.byte	0x4
+	.uleb128 .LVL241-.Ltext0
+	.uleb128 .LVL242-1-.Ltext0
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -376
+	.byte	0x4
+	.uleb128 .LVL276-.Ltext0
+	.uleb128 .LVL278-.Ltext0
+	.uleb128 0x1
+	.byte	0x58
+	.byte	0
+.LVUS80:
+	.uleb128 .LVU475
+	.uleb128 .LVU487
+	.uleb128 .LVU487
+	.uleb128 .LVU519
+	.uleb128 .LVU656
+	.uleb128 .LVU669
+	.uleb128 .LVU749
+	.uleb128 .LVU751
+.LLST80:
+	.byte	0x4
+	.uleb128 .LVL166-.Ltext0
+	.uleb128 .LVL173-.Ltext0
+	.uleb128 0x1
+	.byte	0x5d
+	.byte	0x4
+	.uleb128 .LVL173-.Ltext0
+	.uleb128 .LVL184-.Ltext0
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -416
+	.byte	0x4
+	.uleb128 .LVL241-.Ltext0
+	.uleb128 .LVL246-.Ltext0
+	.uleb128 0x1
+	.byte	0x5d
+	.byte	0x4
+	.uleb128 .LVL276-.Ltext0
+	.uleb128 .LVL278-.Ltext0
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -416
+	.byte	0
+.LVUS81:
+	.uleb128 .LVU475
+	.uleb128 .LVU486
+	.uleb128 .LVU486
+	.uleb128 .LVU519
+	.uleb128 .LVU519
+	.uleb128 .LVU520
+	.uleb128 .LVU656
+	.uleb128 .LVU668
+	.uleb128 .LVU668
+	.uleb128 .LVU669
+	.uleb128 .LVU749
+	.uleb128 .LVU751
+.LLST81:
+	.byte	0x4
+	.uleb128 .LVL166-.Ltext0
+	.uleb128 .LVL172-.Ltext0
+	.uleb128 0x1
+	.byte	0x5c
+	.byte	0x4
+	.uleb128 .LVL172-.Ltext0
+	.uleb128 .LVL184-.Ltext0
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -432
+	.byte	0x4
+	.uleb128 .LVL184-.Ltext0
+	.uleb128 .LVL184-.Ltext0
+	.uleb128 0x4
+	.byte	0x91
+	.sleb128 -336
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL241-.Ltext0
+	.uleb128 .LVL245-.Ltext0
+	.uleb128 0x1
+	.byte	0x5c
+	.byte	0x4
+	.uleb128 .LVL245-.Ltext0
+	.uleb128 .LVL246-.Ltext0
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -432
+	.byte	0x4
+	.uleb128 .LVL276-.Ltext0
+	.uleb128 .LVL278-.Ltext0
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -432
+	.byte	0
+.LVUS82:
+	.uleb128 .LVU480
+	.uleb128 .LVU481
+	.uleb128 .LVU481
+	.uleb128 .LVU520
+	.uleb128 .LVU661
+	.uleb128 .LVU662
+	.uleb128 .LVU662
+	.uleb128 .LVU669
+	.uleb128 .LVU749
+	.uleb128 .LVU751
+.LLST82:
+	.byte	0x4
+	.uleb128 .LVL168-.Ltext0
+	.uleb128 .LVL169-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL169-1-.Ltext0
+	.uleb128 .LVL184-.Ltext0
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -424
+	.byte	0x4
+	.uleb128 .LVL243-.Ltext0
+	.uleb128 .LVL244-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL244-1-.Ltext0
+	.uleb128 .LVL246-.Ltext0
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -424
+	.byte	0x4
+	.uleb128 .LVL276-.Ltext0
+	.uleb128 .LVL278-.Ltext0
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -424
+	.byte	0
+.LVUS84:
+	.uleb128 .LVU487
+	.uleb128 .LVU498
+	.uleb128 .LVU508
+	.uleb128 .LVU519
+	.uleb128 .LVU749
+	.uleb128 .LVU751
+.LLST84:
+	.byte	0x4
+	.uleb128 .LVL173-.Ltext0
+	.uleb128 .LVL179-.Ltext0
+	.uleb128 0x1
+	.byte	0x5d
+	.byte	0x4
+	.uleb128 .LVL180-.Ltext0
+	.uleb128 .LVL184-.Ltext0
+	.uleb128 0x1
+	.byte	0x5d
+	.byte	0x4
+	.uleb128 .LVL276-.Ltext0
+	.uleb128 .LVL278-.Ltext0
+	.uleb128 0x1
+	.byte	0x5d
+	.byte	0
+.LVUS85:
+	.uleb128 .LVU487
+	.uleb128 .LVU498
+	.uleb128 .LVU514
+	.uleb128 .LVU519
+	.uleb128 .LVU749
+	.uleb128 .LVU751
+.LLST85:
+	.byte	0x4
+	.uleb128 .LVL173-.Ltext0
+	.uleb128 .LVL179-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0x4
+	.uleb128 .LVL181-.Ltext0
+	.uleb128 .LVL184-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0x4
+	.uleb128 .LVL276-.Ltext0
+	.uleb128 .LVL278-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0
+.LVUS86:
+	.uleb128 .LVU487
+	.uleb128 .LVU488
+	.uleb128 .LVU488
+	.uleb128 .LVU498
+	.uleb128 .LVU516
+	.uleb128 .LVU519
+	.uleb128 .LVU749
+	.uleb128 .LVU750
+.LLST86:
+	.byte	0x4
+	.uleb128 .LVL173-.Ltext0
+	.uleb128 .LVL174-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL174-1-.Ltext0
+	.uleb128 .LVL179-.Ltext0
+	.uleb128 0x1
+	.byte	0x56
+	.byte	0x4
+	.uleb128 .LVL183-.Ltext0
+	.uleb128 .LVL184-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL276-.Ltext0
+	.uleb128 .LVL277-.Ltext0
+	.uleb128 0x1
+	.byte	0x56
+	.byte	0
+.LVUS88:
+	.uleb128 .LVU614
+	.uleb128 .LVU618
+	.uleb128 .LVU669
+	.uleb128 .LVU674
+	.uleb128 .LVU751
+	.uleb128 .LVU756
+.LLST88:
+	.byte	0x4
+	.uleb128 .LVL224-.Ltext0
+	.uleb128 .LVL225-.Ltext0
+	.uleb128 0x2
+	.byte	0x31
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL246-.Ltext0
+	.uleb128 .LVL249-.Ltext0
+	.uleb128 0x2
+	.byte	0x31
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL278-.Ltext0
+	.uleb128 .LVL280-.Ltext0
+	.uleb128 0x2
+	.byte	0x31
+	.byte	0x9f
+	.byte	0
+.LVUS89:
+	.uleb128 .LVU525
+	.uleb128 .LVU534
+	.uleb128 .LVU614
+	.uleb128 .LVU618
+	.uleb128 .LVU669
+	.uleb128 .LVU675
+	.uleb128 .LVU675
+	.uleb128 .LVU704
+	.uleb128 .LVU717
+	.uleb128 .LVU731
+	.uleb128 .LVU751
+	.uleb128 .LVU756
+	.uleb128 .LVU765
+	.uleb128 .LVU772
+.LLST89:
+	.byte	0x4
+	.uleb128 .LVL185-.Ltext0
+	.uleb128 .LVL188-.Ltext0
+	.uleb128 0x1
+	.byte	0x56
+	.byte	0x4
+	.uleb128 .LVL224-.Ltext0
+	.uleb128 .LVL225-.Ltext0
+	.uleb128 0x1
+	.byte	0x56
+	.byte	0x4
+	.uleb128 .LVL246-.Ltext0
+	.uleb128 .LVL250-.Ltext0
+	.uleb128 0x1
+	.byte	0x56
+	.byte	0x4
+	.uleb128 .LVL250-.Ltext0
+	.uleb128 .LVL259-.Ltext0
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -416
+	.byte	0x4
+	.uleb128 .LVL263-.Ltext0
+	.uleb128 .LVL268-.Ltext0
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -416
+	.byte	0x4
+	.uleb128 .LVL278-.Ltext0
+	.uleb128 .LVL280-.Ltext0
+	.uleb128 0x1
+	.byte	0x56
+	.byte	0x4
+	.uleb128 .LVL282-.Ltext0
+	.uleb128 .LVL286-.Ltext0
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -416
+	.byte	0
+.LVUS90:
+	.uleb128 .LVU525
+	.uleb128 .LVU530
+	.uleb128 .LVU530
+	.uleb128 .LVU533
+	.uleb128 .LVU533
+	.uleb128 .LVU534
+	.uleb128 .LVU614
+	.uleb128 .LVU618
+	.uleb128 .LVU669
+	.uleb128 .LVU673
+	.uleb128 .LVU673
+	.uleb128 .LVU704
+	.uleb128 .LVU717
+	.uleb128 .LVU731
+	.uleb128 .LVU751
+	.uleb128 .LVU756
+	.uleb128 .LVU765
+	.uleb128 .LVU772
+.LLST90:
+	.byte	0x4
+	.uleb128 .LVL185-.Ltext0
+	.uleb128 .LVL186-.Ltext0
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x4
+	.uleb128 .LVL186-.Ltext0
+	.uleb128 .LVL187-1-.Ltext0
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -160
+	.byte	0x4
+	.uleb128 .LVL187-1-.Ltext0
+	.uleb128 .LVL188-.Ltext0
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -432
+	.byte	0x4
+	.uleb128 .LVL224-.Ltext0
+	.uleb128 .LVL225-.Ltext0
+	.uleb128 0x1
+	.byte	0x52
+	.byte	0x4
+	.uleb128 .LVL246-.Ltext0
+	.uleb128 .LVL248-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x52
+	.byte	0x4
+	.uleb128 .LVL248-1-.Ltext0
+	.uleb128 .LVL259-.Ltext0
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -432
+	.byte	0x4
+	.uleb128 .LVL263-.Ltext0
+	.uleb128 .LVL268-.Ltext0
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -432
+	.byte	0x4
+	.uleb128 .LVL278-.Ltext0
+	.uleb128 .LVL280-.Ltext0
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -432
+	.byte	0x4
+	.uleb128 .LVL282-.Ltext0
+	.uleb128 .LVL286-.Ltext0
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -432
+	.byte	0
+.LVUS91:
+	.uleb128 .LVU614
+	.uleb128 .LVU618
+	.uleb128 .LVU669
+	.uleb128 .LVU672
+	.uleb128 .LVU672
+	.uleb128 .LVU674
+	.uleb128 .LVU675
+	.uleb128 .LVU701
+	.uleb128 .LVU717
+	.uleb128 .LVU724
+	.uleb128 .LVU726
+	.uleb128 .LVU731
+	.uleb128 .LVU751
+	.uleb128 .LVU756
+	.uleb128 .LVU765
+	.uleb128 .LVU766
+.LLST91:
+	.byte	0x4
+	.uleb128 .LVL224-.Ltext0
+	.uleb128 .LVL225-.Ltext0
+	.uleb128 0x1
+	.byte	0x51
+	.byte	0x4
+	.uleb128 .LVL246-.Ltext0
+	.uleb128 .LVL247-.Ltext0
+	.uleb128 0x1
+	.byte	0x51
+	.byte	0x4
+	.uleb128 .LVL247-.Ltext0
+	.uleb128 .LVL249-.Ltext0
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -424
+	.byte	0x4
+	.uleb128 .LVL250-.Ltext0
+	.uleb128 .LVL258-.Ltext0
+	.uleb128 0x1
+	.byte	0x5e
+	.byte	0x4
+	.uleb128 .LVL263-.Ltext0
+	.uleb128 .LVL264-.Ltext0
+	.uleb128 0x1
+	.byte	0x5e
+	.byte	0x4
+	.uleb128 .LVL265-.Ltext0
+	.uleb128 .LVL268-.Ltext0
+	.uleb128 0x1
+	.byte	0x5e
+	.byte	0x4
+	.uleb128 .LVL278-.Ltext0
+	.uleb128 .LVL280-.Ltext0
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -424
+	.byte	0x4
+	.uleb128 .LVL282-.Ltext0
+	.uleb128 .LVL283-.Ltext0
+	.uleb128 0x1
+	.byte	0x5e
+	.byte	0
+.LVUS92:
+	.uleb128 .LVU525
+	.uleb128 .LVU534
+	.uleb128 .LVU614
+	.uleb128 .LVU618
+	.uleb128 .LVU669
+	.uleb128 .LVU704
+	.uleb128 .LVU717
+	.uleb128 .LVU731
+	.uleb128 .LVU751
+	.uleb128 .LVU756
+	.uleb128 .LVU765
+	.uleb128 .LVU772
+.LLST92:
+	.byte	0x4
+	.uleb128 .LVL185-.Ltext0
+	.uleb128 .LVL188-.Ltext0
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -440
+	.byte	0x4
+	.uleb128 .LVL224-.Ltext0
+	.uleb128 .LVL225-.Ltext0
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -440
+	.byte	0x4
+	.uleb128 .LVL246-.Ltext0
+	.uleb128 .LVL259-.Ltext0
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -440
+	.byte	0x4
+	.uleb128 .LVL263-.Ltext0
+	.uleb128 .LVL268-.Ltext0
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -440
+	.byte	0x4
+	.uleb128 .LVL278-.Ltext0
+	.uleb128 .LVL280-.Ltext0
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -440
+	.byte	0x4
+	.uleb128 .LVL282-.Ltext0
+	.uleb128 .LVL286-.Ltext0
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -440
+	.byte	0
+.LVUS93:
+	.uleb128 .LVU525
+	.uleb128 .LVU534
+	.uleb128 .LVU614
+	.uleb128 .LVU618
+	.uleb128 .LVU669
+	.uleb128 .LVU674
+	.uleb128 .LVU674
+	.uleb128 .LVU704
+	.uleb128 .LVU717
+	.uleb128 .LVU731
+	.uleb128 .LVU751
+	.uleb128 .LVU756
+	.uleb128 .LVU765
+	.uleb128 .LVU772
+.LLST93:
+	.byte	0x4
+	.uleb128 .LVL185-.Ltext0
+	.uleb128 .LVL188-.Ltext0
+	.uleb128 0x4
+	.byte	0x91
+	.sleb128 -336
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL224-.Ltext0
+	.uleb128 .LVL225-.Ltext0
+	.uleb128 0x1
+	.byte	0x5c
+	.byte	0x4
+	.uleb128 .LVL246-.Ltext0
+	.uleb128 .LVL249-.Ltext0
+	.uleb128 0x1
+	.byte	0x5c
+	.byte	0x4
+	.uleb128 .LVL249-.Ltext0
+	.uleb128 .LVL259-.Ltext0
+	.uleb128 0x4
+	.byte	0x91
+	.sleb128 -336
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL263-.Ltext0
+	.uleb128 .LVL268-.Ltext0
+	.uleb128 0x4
+	.byte	0x91
+	.sleb128 -336
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL278-.Ltext0
+	.uleb128 .LVL280-.Ltext0
+	.uleb128 0x1
+	.byte	0x5c
+	.byte	0x4
+	.uleb128 .LVL282-.Ltext0
+	.uleb128 .LVL286-.Ltext0
+	.uleb128 0x4
+	.byte	0x91
+	.sleb128 -336
+	.byte	0x9f
+	.byte	0
+.LVUS95:
+	.uleb128 .LVU683
+	.uleb128 .LVU686
+	.uleb128 .LVU686
+	.uleb128 .LVU704
+	.uleb128 .LVU717
+	.uleb128 .LVU729
+	.uleb128 .LVU765
+	.uleb128 .LVU772
+.LLST95:
+	.byte	0x4
+	.uleb128 .LVL251-.Ltext0
+	.uleb128 .LVL252-.Ltext0
+	.uleb128 0x1
+	.byte	0x51
+	.byte	0x4
+	.uleb128 .LVL252-.Ltext0
+	.uleb128 .LVL259-.Ltext0
+	.uleb128 0x1
+	.byte	0x5c
+	.byte	0x4
+	.uleb128 .LVL263-.Ltext0
+	.uleb128 .LVL267-.Ltext0
+	.uleb128 0x1
+	.byte	0x5c
+	.byte	0x4
+	.uleb128 .LVL282-.Ltext0
+	.uleb128 .LVL286-.Ltext0
+	.uleb128 0x1
+	.byte	0x5c
+	.byte	0
+.LVUS96:
+	.uleb128 .LVU718
+	.uleb128 .LVU728
+	.uleb128 .LVU765
+	.uleb128 .LVU767
+.LLST96:
+	.byte	0x4
+	.uleb128 .LVL263-.Ltext0
+	.uleb128 .LVL266-.Ltext0
+	.uleb128 0x1
+	.byte	0x5f
+	.byte	0x4
+	.uleb128 .LVL282-.Ltext0
+	.uleb128 .LVL284-.Ltext0
+	.uleb128 0x1
+	.byte	0x5f
+	.byte	0
+.LVUS98:
+	.uleb128 .LVU686
+	.uleb128 .LVU700
+	.uleb128 .LVU717
+	.uleb128 .LVU718
+.LLST98:
+	.byte	0x4
+	.uleb128 .LVL252-.Ltext0
+	.uleb128 .LVL257-.Ltext0
+	.uleb128 0x1
+	.byte	0x5f
+	.byte	0x4
+	.uleb128 .LVL263-.Ltext0
+	.uleb128 .LVL263-.Ltext0
+	.uleb128 0x1
+	.byte	0x5f
+	.byte	0
+.LVUS100:
+	.uleb128 .LVU686
+	.uleb128 .LVU690
+	.uleb128 .LVU696
+	.uleb128 .LVU699
+.LLST100:
+	.byte	0x4
+	.uleb128 .LVL252-.Ltext0
+	.uleb128 .LVL253-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL255-.Ltext0
+	.uleb128 .LVL256-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0
+.LVUS101:
+	.uleb128 .LVU555
+	.uleb128 .LVU560
+.LLST101:
+	.byte	0x4
+	.uleb128 .LVL198-.Ltext0
+	.uleb128 .LVL201-.Ltext0
+	.uleb128 0x1
+	.byte	0x5d
+	.byte	0
+.LVUS104:
+	.uleb128 .LVU631
+	.uleb128 .LVU645
+.LLST104:
+	.byte	0x4
+	.uleb128 .LVL229-.Ltext0
+	.uleb128 .LVL236-.Ltext0
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -448
+	.byte	0
+.LVUS105:
+	.uleb128 .LVU631
+	.uleb128 .LVU645
+.LLST105:
+	.byte	0x4
+	.uleb128 .LVL229-.Ltext0
+	.uleb128 .LVL236-.Ltext0
+	.uleb128 0x1
+	.byte	0x56
+	.byte	0
+.LVUS106:
+	.uleb128 .LVU631
+	.uleb128 .LVU645
+.LLST106:
+	.byte	0x4
+	.uleb128 .LVL229-.Ltext0
+	.uleb128 .LVL236-.Ltext0
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -456
+	.byte	0
+.LVUS107:
+	.uleb128 .LVU631
+	.uleb128 .LVU645
+.LLST107:
+	.byte	0x4
+	.uleb128 .LVL229-.Ltext0
+	.uleb128 .LVL236-.Ltext0
+	.uleb128 0x1
+	.byte	0x5c
+	.byte	0
+.LVUS108:
+	.uleb128 .LVU634
+	.uleb128 .LVU636
+	.uleb128 .LVU636
+	.uleb128 .LVU645
+.LLST108:
+	.byte	0x4
+	.uleb128 .LVL231-.Ltext0
+	.uleb128 .LVL232-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL232-.Ltext0
+	.uleb128 .LVL236-.Ltext0
+	.uleb128 0x1
+	.byte	0x5d
+	.byte	0
+.LVUS110:
+	.uleb128 .LVU636
+	.uleb128 .LVU638
+	.uleb128 .LVU643
+	.uleb128 .LVU645
+.LLST110:
+	.byte	0x4
+	.uleb128 .LVL232-.Ltext0
+	.uleb128 .LVL233-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL235-.Ltext0
+	.uleb128 .LVL236-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0
+.LVUS26:
+	.uleb128 0
+	.uleb128 .LVU258
+	.uleb128 .LVU258
+	.uleb128 0
+.LLST26:
+	.byte	0x4
+	.uleb128 .LVL75-.Ltext0
+	.uleb128 .LVL79-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL79-.Ltext0
+	.uleb128 .LFE39-.Ltext0
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -4168
+	.byte	0
+.LVUS27:
+	.uleb128 0
+	.uleb128 .LVU258
+	.uleb128 .LVU258
+	.uleb128 .LVU278
+	.uleb128 .LVU278
+	.uleb128 .LVU290
+	.uleb128 .LVU290
+	.uleb128 0
+.LLST27:
+	.byte	0x4
+	.uleb128 .LVL75-.Ltext0
+	.uleb128 .LVL79-.Ltext0
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x4
+	.uleb128 .LVL79-.Ltext0
+	.uleb128 .LVL86-.Ltext0
+	.uleb128 0x1
+	.byte	0x5c
+	.byte	0x4
+	.uleb128 .LVL86-.Ltext0
+	.uleb128 .LVL92-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL92-.Ltext0
+	.uleb128 .LFE39-.Ltext0
+	.uleb128 0x1
+	.byte	0x5c
+	.byte	0
+.LVUS28:
+	.uleb128 0
+	.uleb128 .LVU258
+	.uleb128 .LVU258
+	.uleb128 .LVU289
+	.uleb128 .LVU289
+	.uleb128 .LVU290
+	.uleb128 .LVU290
+	.uleb128 0
+.LLST28:
+	.byte	0x4
+	.uleb128 .LVL75-.Ltext0
+	.uleb128 .LVL79-.Ltext0
+	.uleb128 0x1
+	.byte	0x51
+	.byte	0x4
+	.uleb128 .LVL79-.Ltext0
+	.uleb128 .LVL91-.Ltext0
+	.uleb128 0x1
+	.byte	0x5e
+	.byte	0x4
+	.uleb128 .LVL91-.Ltext0
+	.uleb128 .LVL92-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x51
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL92-.Ltext0
+	.uleb128 .LFE39-.Ltext0
+	.uleb128 0x1
+	.byte	0x5e
+	.byte	0
+.LVUS29:
+	.uleb128 0
+	.uleb128 .LVU250
+	.uleb128 .LVU250
+	.uleb128 0
+.LLST29:
+	.byte	0x4
+	.uleb128 .LVL75-.Ltext0
+	.uleb128 .LVL77-.Ltext0
+	.uleb128 0x1
+	.byte	0x52
+	.byte	0x4
+	.uleb128 .LVL77-.Ltext0
+	.uleb128 .LFE39-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x52
+	.byte	0x9f
+	.byte	0
+.LVUS30:
+	.uleb128 .LVU247
+	.uleb128 .LVU251
+	.uleb128 .LVU251
+	.uleb128 .LVU287
+	.uleb128 .LVU287
+	.uleb128 .LVU288
+	.uleb128 .LVU290
+	.uleb128 0
+.LLST30:
+	.byte	0x4
+	.uleb128 .LVL76-.Ltext0
+	.uleb128 .LVL78-.Ltext0
+	.uleb128 0x10
+	.byte	0x76
+	.sleb128 0
+	.byte	0xa
+	.value	0x1000
+	.byte	0x14
+	.byte	0x14
+	.byte	0x1b
+	.byte	0x1e
+	.byte	0x1c
+	.byte	0x1f
+	.byte	0xa
+	.value	0xfff
+	.byte	0x1a
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL78-.Ltext0
+	.uleb128 .LVL89-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0x4
+	.uleb128 .LVL89-.Ltext0
+	.uleb128 .LVL90-.Ltext0
+	.uleb128 0x37
+	.byte	0x76
+	.sleb128 0
+	.byte	0x1f
+	.byte	0xa
+	.value	0xfff
+	.byte	0x1a
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x52
+	.byte	0x76
+	.sleb128 0
+	.byte	0x1c
+	.byte	0x76
+	.sleb128 0
+	.byte	0x1f
+	.byte	0xa
+	.value	0xfff
+	.byte	0x1a
+	.byte	0x23
+	.uleb128 0x8000000000000000
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x52
+	.byte	0x76
+	.sleb128 0
+	.byte	0x1c
+	.byte	0x23
+	.uleb128 0x8000000000000000
+	.byte	0x2c
+	.byte	0x28
+	.value	0x1
+	.byte	0x16
+	.byte	0x13
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL92-.Ltext0
+	.uleb128 .LFE39-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0
+.LVUS31:
+	.uleb128 .LVU275
+	.uleb128 .LVU278
+	.uleb128 .LVU279
+	.uleb128 .LVU286
+	.uleb128 .LVU290
+	.uleb128 0
+.LLST31:
+	.byte	0x4
+	.uleb128 .LVL85-.Ltext0
+	.uleb128 .LVL86-.Ltext0
+	.uleb128 0x1
+	.byte	0x5f
+	.byte	0x4
+	.uleb128 .LVL86-.Ltext0
+	.uleb128 .LVL88-.Ltext0
+	.uleb128 0x2
+	.byte	0x30
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL92-.Ltext0
+	.uleb128 .LFE39-.Ltext0
+	.uleb128 0x1
+	.byte	0x5f
+	.byte	0
+.LVUS33:
+	.uleb128 .LVU252
+	.uleb128 .LVU272
+	.uleb128 .LVU274
+	.uleb128 .LVU275
+.LLST33:
+	.byte	0x4
+	.uleb128 .LVL78-.Ltext0
+	.uleb128 .LVL84-.Ltext0
+	.uleb128 0x1
+	.byte	0x56
+	.byte	0x4
+	.uleb128 .LVL85-.Ltext0
+	.uleb128 .LVL85-.Ltext0
+	.uleb128 0x1
+	.byte	0x56
+	.byte	0
+.LVUS34:
+	.uleb128 .LVU252
+	.uleb128 .LVU272
+	.uleb128 .LVU274
+	.uleb128 .LVU275
+.LLST34:
+	.byte	0x4
+	.uleb128 .LVL78-.Ltext0
+	.uleb128 .LVL84-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0x4
+	.uleb128 .LVL85-.Ltext0
+	.uleb128 .LVL85-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0
+.LVUS35:
+	.uleb128 .LVU252
+	.uleb128 .LVU272
+	.uleb128 .LVU274
+	.uleb128 .LVU275
+.LLST35:
+	.byte	0x4
+	.uleb128 .LVL78-.Ltext0
+	.uleb128 .LVL84-.Ltext0
+	.uleb128 0x1
+	.byte	0x5d
+	.byte	0x4
+	.uleb128 .LVL85-.Ltext0
+	.uleb128 .LVL85-.Ltext0
+	.uleb128 0x1
+	.byte	0x5d
+	.byte	0
+.LVUS36:
+	.uleb128 .LVU252
+	.uleb128 .LVU258
+	.uleb128 .LVU258
+	.uleb128 .LVU272
+	.uleb128 .LVU274
+	.uleb128 .LVU275
+.LLST36:
+	.byte	0x4
+	.uleb128 .LVL78-.Ltext0
+	.uleb128 .LVL79-.Ltext0
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x4
+	.uleb128 .LVL79-.Ltext0
+	.uleb128 .LVL84-.Ltext0
+	.uleb128 0x1
+	.byte	0x5c
+	.byte	0x4
+	.uleb128 .LVL85-.Ltext0
+	.uleb128 .LVL85-.Ltext0
+	.uleb128 0x1
+	.byte	0x5c
+	.byte	0
+.LVUS37:
+	.uleb128 .LVU254
+	.uleb128 .LVU258
+	.uleb128 .LVU258
+	.uleb128 .LVU272
+	.uleb128 .LVU274
+	.uleb128 .LVU275
+.LLST37:
+	.byte	0x4
+	.uleb128 .LVL78-.Ltext0
+	.uleb128 .LVL79-.Ltext0
+	.uleb128 0x2
+	.byte	0x30
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL79-.Ltext0
+	.uleb128 .LVL84-.Ltext0
+	.uleb128 0x1
+	.byte	0x5f
+	.byte	0x4
+	.uleb128 .LVL85-.Ltext0
+	.uleb128 .LVL85-.Ltext0
+	.uleb128 0x1
+	.byte	0x5f
+	.byte	0
+.LVUS39:
+	.uleb128 .LVU258
+	.uleb128 .LVU262
+	.uleb128 .LVU268
+	.uleb128 .LVU271
+.LLST39:
+	.byte	0x4
+	.uleb128 .LVL79-.Ltext0
+	.uleb128 .LVL80-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL82-.Ltext0
+	.uleb128 .LVL83-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0
+.LVUS40:
+	.uleb128 0
+	.uleb128 .LVU301
+	.uleb128 .LVU301
+	.uleb128 .LVU319
+	.uleb128 .LVU319
+	.uleb128 .LVU322
+	.uleb128 .LVU322
+	.uleb128 .LVU326
+	.uleb128 .LVU326
+	.uleb128 .LVU329
+	.uleb128 .LVU329
+	.uleb128 0
+.LLST40:
+	.byte	0x4
+	.uleb128 .LVL94-.Ltext0
+	.uleb128 .LVL95-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL95-.Ltext0
+	.uleb128 .LVL102-.Ltext0
+	.uleb128 0x1
+	.byte	0x5c
+	.byte	0x4
+	.uleb128 .LVL102-.Ltext0
+	.uleb128 .LVL105-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL105-.Ltext0
+	.uleb128 .LVL108-.Ltext0
+	.uleb128 0x1
+	.byte	0x5c
+	.byte	0x4
+	.uleb128 .LVL108-.Ltext0
+	.uleb128 .LVL111-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL111-.Ltext0
+	.uleb128 .LFE35-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0
+.LVUS41:
+	.uleb128 0
+	.uleb128 .LVU301
+	.uleb128 .LVU301
+	.uleb128 .LVU320
+	.uleb128 .LVU320
+	.uleb128 .LVU322
+	.uleb128 .LVU322
+	.uleb128 .LVU327
+	.uleb128 .LVU327
+	.uleb128 .LVU329
+	.uleb128 .LVU329
+	.uleb128 0
+.LLST41:
+	.byte	0x4
+	.uleb128 .LVL94-.Ltext0
+	.uleb128 .LVL95-.Ltext0
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x4
+	.uleb128 .LVL95-.Ltext0
+	.uleb128 .LVL103-.Ltext0
+	.uleb128 0x1
+	.byte	0x5d
+	.byte	0x4
+	.uleb128 .LVL103-.Ltext0
+	.uleb128 .LVL105-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL105-.Ltext0
+	.uleb128 .LVL109-.Ltext0
+	.uleb128 0x1
+	.byte	0x5d
+	.byte	0x4
+	.uleb128 .LVL109-.Ltext0
+	.uleb128 .LVL111-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL111-.Ltext0
+	.uleb128 .LFE35-.Ltext0
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0
+.LVUS42:
+	.uleb128 0
+	.uleb128 .LVU301
+	.uleb128 .LVU301
+	.uleb128 .LVU318
+	.uleb128 .LVU318
+	.uleb128 .LVU322
+	.uleb128 .LVU322
+	.uleb128 .LVU325
+	.uleb128 .LVU325
+	.uleb128 .LVU329
+	.uleb128 .LVU329
+	.uleb128 0
+.LLST42:
+	.byte	0x4
+	.uleb128 .LVL94-.Ltext0
+	.uleb128 .LVL95-.Ltext0
+	.uleb128 0x1
+	.byte	0x51
+	.byte	0x4
+	.uleb128 .LVL95-.Ltext0
+	.uleb128 .LVL101-.Ltext0
+	.uleb128 0x1
+	.byte	0x56
+	.byte	0x4
+	.uleb128 .LVL101-.Ltext0
+	.uleb128 .LVL105-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x51
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL105-.Ltext0
+	.uleb128 .LVL107-.Ltext0
+	.uleb128 0x1
+	.byte	0x56
+	.byte	0x4
+	.uleb128 .LVL107-.Ltext0
+	.uleb128 .LVL111-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x51
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL111-.Ltext0
+	.uleb128 .LFE35-.Ltext0
+	.uleb128 0x1
+	.byte	0x51
+	.byte	0
+.LVUS43:
+	.uleb128 0
+	.uleb128 .LVU301
+	.uleb128 .LVU301
+	.uleb128 .LVU321
+	.uleb128 .LVU321
+	.uleb128 .LVU322
+	.uleb128 .LVU322
+	.uleb128 .LVU328
+	.uleb128 .LVU328
+	.uleb128 .LVU329
+	.uleb128 .LVU329
+	.uleb128 0
+.LLST43:
+	.byte	0x4
+	.uleb128 .LVL94-.Ltext0
+	.uleb128 .LVL95-.Ltext0
+	.uleb128 0x1
+	.byte	0x52
+	.byte	0x4
+	.uleb128 .LVL95-.Ltext0
+	.uleb128 .LVL104-.Ltext0
+	.uleb128 0x1
+	.byte	0x5e
+	.byte	0x4
+	.uleb128 .LVL104-.Ltext0
+	.uleb128 .LVL105-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x52
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL105-.Ltext0
+	.uleb128 .LVL110-.Ltext0
+	.uleb128 0x1
+	.byte	0x5e
+	.byte	0x4
+	.uleb128 .LVL110-.Ltext0
+	.uleb128 .LVL111-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x52
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL111-.Ltext0
+	.uleb128 .LFE35-.Ltext0
+	.uleb128 0x1
+	.byte	0x52
+	.byte	0
+.LVUS44:
+	.uleb128 .LVU297
+	.uleb128 .LVU301
+	.uleb128 .LVU301
+	.uleb128 .LVU316
+	.uleb128 .LVU322
+	.uleb128 .LVU324
+	.uleb128 .LVU324
+	.uleb128 .LVU329
+	.uleb128 .LVU329
+	.uleb128 0
+.LLST44:
+	.byte	0x4
+	.uleb128 .LVL94-.Ltext0
+	.uleb128 .LVL95-.Ltext0
+	.uleb128 0x2
+	.byte	0x30
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL95-.Ltext0
+	.uleb128 .LVL100-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0x4
+	.uleb128 .LVL105-.Ltext0
+	.uleb128 .LVL106-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0x4
+	.uleb128 .LVL106-.Ltext0
+	.uleb128 .LVL111-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL111-.Ltext0
+	.uleb128 .LFE35-.Ltext0
+	.uleb128 0x2
+	.byte	0x30
+	.byte	0x9f
+	.byte	0
+.LVUS46:
+	.uleb128 .LVU301
+	.uleb128 .LVU305
+	.uleb128 .LVU311
+	.uleb128 .LVU314
+.LLST46:
+	.byte	0x4
+	.uleb128 .LVL95-.Ltext0
+	.uleb128 .LVL96-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL98-.Ltext0
+	.uleb128 .LVL99-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0
+.LVUS47:
+	.uleb128 0
+	.uleb128 .LVU336
+	.uleb128 .LVU336
+	.uleb128 .LVU361
+	.uleb128 .LVU361
+	.uleb128 .LVU363
+	.uleb128 .LVU363
+	.uleb128 .LVU371
+	.uleb128 .LVU371
+	.uleb128 .LVU373
+	.uleb128 .LVU373
+	.uleb128 0
+.LLST47:
+	.byte	0x4
+	.uleb128 .LVL112-.Ltext0
+	.uleb128 .LVL113-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL113-.Ltext0
+	.uleb128 .LVL125-.Ltext0
+	.uleb128 0x1
+	.byte	0x5d
+	.byte	0x4
+	.uleb128 .LVL125-.Ltext0
+	.uleb128 .LVL127-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL127-.Ltext0
+	.uleb128 .LVL131-.Ltext0
+	.uleb128 0x1
+	.byte	0x5d
+	.byte	0x4
+	.uleb128 .LVL131-.Ltext0
+	.uleb128 .LVL133-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL133-.Ltext0
+	.uleb128 .LFE37-.Ltext0
+	.uleb128 0x1
+	.byte	0x5d
+	.byte	0
+.LVUS48:
+	.uleb128 0
+	.uleb128 .LVU338
+	.uleb128 .LVU338
+	.uleb128 .LVU359
+	.uleb128 .LVU359
+	.uleb128 .LVU363
+	.uleb128 .LVU363
+	.uleb128 .LVU369
+	.uleb128 .LVU369
+	.uleb128 .LVU373
+	.uleb128 .LVU373
+	.uleb128 0
+.LLST48:
+	.byte	0x4
+	.uleb128 .LVL112-.Ltext0
+	.uleb128 .LVL114-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x4
+	.uleb128 .LVL114-1-.Ltext0
+	.uleb128 .LVL123-.Ltext0
+	.uleb128 0x1
+	.byte	0x56
+	.byte	0x4
+	.uleb128 .LVL123-.Ltext0
+	.uleb128 .LVL127-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL127-.Ltext0
+	.uleb128 .LVL129-.Ltext0
+	.uleb128 0x1
+	.byte	0x56
+	.byte	0x4
+	.uleb128 .LVL129-.Ltext0
+	.uleb128 .LVL133-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL133-.Ltext0
+	.uleb128 .LFE37-.Ltext0
+	.uleb128 0x1
+	.byte	0x56
+	.byte	0
+.LVUS49:
+	.uleb128 0
+	.uleb128 .LVU338
+	.uleb128 .LVU338
+	.uleb128 .LVU360
+	.uleb128 .LVU360
+	.uleb128 .LVU363
+	.uleb128 .LVU363
+	.uleb128 .LVU370
+	.uleb128 .LVU370
+	.uleb128 .LVU373
+	.uleb128 .LVU373
+	.uleb128 0
+.LLST49:
+	.byte	0x4
+	.uleb128 .LVL112-.Ltext0
+	.uleb128 .LVL114-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x51
+	.byte	0x4
+	.uleb128 .LVL114-1-.Ltext0
+	.uleb128 .LVL124-.Ltext0
+	.uleb128 0x1
+	.byte	0x5c
+	.byte	0x4
+	.uleb128 .LVL124-.Ltext0
+	.uleb128 .LVL127-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x51
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL127-.Ltext0
+	.uleb128 .LVL130-.Ltext0
+	.uleb128 0x1
+	.byte	0x5c
+	.byte	0x4
+	.uleb128 .LVL130-.Ltext0
+	.uleb128 .LVL133-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x51
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL133-.Ltext0
+	.uleb128 .LFE37-.Ltext0
+	.uleb128 0x1
+	.byte	0x5c
+	.byte	0
+.LVUS50:
+	.uleb128 0
+	.uleb128 .LVU338
+	.uleb128 .LVU338
+	.uleb128 .LVU362
+	.uleb128 .LVU362
+	.uleb128 .LVU363
+	.uleb128 .LVU363
+	.uleb128 .LVU372
+	.uleb128 .LVU372
+	.uleb128 .LVU373
+	.uleb128 .LVU373
+	.uleb128 0
+.LLST50:
+	.byte	0x4
+	.uleb128 .LVL112-.Ltext0
+	.uleb128 .LVL114-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x52
+	.byte	0x4
+	.uleb128 .LVL114-1-.Ltext0
+	.uleb128 .LVL126-.Ltext0
+	.uleb128 0x1
+	.byte	0x5e
+	.byte	0x4
+	.uleb128 .LVL126-.Ltext0
+	.uleb128 .LVL127-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x52
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL127-.Ltext0
+	.uleb128 .LVL132-.Ltext0
+	.uleb128 0x1
+	.byte	0x5e
+	.byte	0x4
+	.uleb128 .LVL132-.Ltext0
+	.uleb128 .LVL133-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x52
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL133-.Ltext0
+	.uleb128 .LFE37-.Ltext0
+	.uleb128 0x1
+	.byte	0x5e
+	.byte	0
+.LVUS51:
+	.uleb128 .LVU338
+	.uleb128 .LVU340
+	.uleb128 .LVU340
+	.uleb128 .LVU357
+	.uleb128 .LVU363
+	.uleb128 .LVU365
+	.uleb128 .LVU373
+	.uleb128 .LVU375
+.LLST51:
+	.byte	0x4
+	.uleb128 .LVL114-.Ltext0
+	.uleb128 .LVL115-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL115-.Ltext0
+	.uleb128 .LVL122-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0x4
+	.uleb128 .LVL127-.Ltext0
+	.uleb128 .LVL128-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0x4
+	.uleb128 .LVL133-.Ltext0
+	.uleb128 .LVL134-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0
+.LVUS53:
+	.uleb128 .LVU340
+	.uleb128 .LVU342
+	.uleb128 .LVU347
+	.uleb128 .LVU350
+.LLST53:
+	.byte	0x4
+	.uleb128 .LVL115-.Ltext0
+	.uleb128 .LVL116-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL118-.Ltext0
+	.uleb128 .LVL119-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0
+.Ldebug_loc3:
+	.section	.debug_aranges,"",@progbits
+	.long	0x2c
+	.value	0x2
+	.long	.Ldebug_info0
+	.byte	0x8
+	.byte	0
+	.value	0
+	.value	0
+	.quad	.Ltext0
+	.quad	.Letext0-.Ltext0
+	.quad	0
+	.quad	0
+	.section	.debug_rnglists,"",@progbits
+.Ldebug_ranges0:
+	.long	.Ldebug_ranges3-.Ldebug_ranges2
+.Ldebug_ranges2:
+	.value	0x5
+	.byte	0x8
+	.byte	0
+	.long	0
+.LLRL6:
+	.byte	0x4
+	.uleb128 .LBB16-.Ltext0
+	.uleb128 .LBE16-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB27-.Ltext0
+	.uleb128 .LBE27-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB28-.Ltext0
+	.uleb128 .LBE28-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB29-.Ltext0
+	.uleb128 .LBE29-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB30-.Ltext0
+	.uleb128 .LBE30-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB31-.Ltext0
+	.uleb128 .LBE31-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB32-.Ltext0
+	.uleb128 .LBE32-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB33-.Ltext0
+	.uleb128 .LBE33-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB34-.Ltext0
+	.uleb128 .LBE34-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB35-.Ltext0
+	.uleb128 .LBE35-.Ltext0
+	.byte	0
+.LLRL9:
+	.byte	0x4
+	.uleb128 .LBB36-.Ltext0
+	.uleb128 .LBE36-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB45-.Ltext0
+	.uleb128 .LBE45-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB46-.Ltext0
+	.uleb128 .LBE46-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB47-.Ltext0
+	.uleb128 .LBE47-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB48-.Ltext0
+	.uleb128 .LBE48-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB49-.Ltext0
+	.uleb128 .LBE49-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB50-.Ltext0
+	.uleb128 .LBE50-.Ltext0
+	.byte	0
+.LLRL13:
+	.byte	0x4
+	.uleb128 .LBB37-.Ltext0
+	.uleb128 .LBE37-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB43-.Ltext0
+	.uleb128 .LBE43-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB44-.Ltext0
+	.uleb128 .LBE44-.Ltext0
+	.byte	0
+.LLRL19:
+	.byte	0x4
+	.uleb128 .LBB39-.Ltext0
+	.uleb128 .LBE39-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB40-.Ltext0
+	.uleb128 .LBE40-.Ltext0
+	.byte	0
+.LLRL32:
+	.byte	0x4
+	.uleb128 .LBB54-.Ltext0
+	.uleb128 .LBE54-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB60-.Ltext0
+	.uleb128 .LBE60-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB61-.Ltext0
+	.uleb128 .LBE61-.Ltext0
+	.byte	0
+.LLRL38:
+	.byte	0x4
+	.uleb128 .LBB56-.Ltext0
+	.uleb128 .LBE56-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB57-.Ltext0
+	.uleb128 .LBE57-.Ltext0
+	.byte	0
+.LLRL45:
+	.byte	0x4
+	.uleb128 .LBB63-.Ltext0
+	.uleb128 .LBE63-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB64-.Ltext0
+	.uleb128 .LBE64-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB65-.Ltext0
+	.uleb128 .LBE65-.Ltext0
+	.byte	0
+.LLRL52:
+	.byte	0x4
+	.uleb128 .LBB67-.Ltext0
+	.uleb128 .LBE67-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB68-.Ltext0
+	.uleb128 .LBE68-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB69-.Ltext0
+	.uleb128 .LBE69-.Ltext0
+	.byte	0
+.LLRL67:
+	.byte	0x4
+	.uleb128 .LBB93-.Ltext0
+	.uleb128 .LBE93-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB94-.Ltext0
+	.uleb128 .LBE94-.Ltext0
+	.byte	0
+.LLRL69:
+	.byte	0x4
+	.uleb128 .LBB95-.Ltext0
+	.uleb128 .LBE95-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB133-.Ltext0
+	.uleb128 .LBE133-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB137-.Ltext0
+	.uleb128 .LBE137-.Ltext0
+	.byte	0
+.LLRL75:
+	.byte	0x4
+	.uleb128 .LBB97-.Ltext0
+	.uleb128 .LBE97-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB98-.Ltext0
+	.uleb128 .LBE98-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB99-.Ltext0
+	.uleb128 .LBE99-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB100-.Ltext0
+	.uleb128 .LBE100-.Ltext0
+	.byte	0
+.LLRL77:
+	.byte	0x4
+	.uleb128 .LBB103-.Ltext0
+	.uleb128 .LBE103-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB113-.Ltext0
+	.uleb128 .LBE113-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB114-.Ltext0
+	.uleb128 .LBE114-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB145-.Ltext0
+	.uleb128 .LBE145-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB146-.Ltext0
+	.uleb128 .LBE146-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB147-.Ltext0
+	.uleb128 .LBE147-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB148-.Ltext0
+	.uleb128 .LBE148-.Ltext0
+	.byte	0
+.LLRL83:
+	.byte	0x4
+	.uleb128 .LBB105-.Ltext0
+	.uleb128 .LBE105-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB106-.Ltext0
+	.uleb128 .LBE106-.Ltext0
+	.byte	0
+.LLRL87:
+	.byte	0x4
+	.uleb128 .LBB115-.Ltext0
+	.uleb128 .LBE115-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB138-.Ltext0
+	.uleb128 .LBE138-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB149-.Ltext0
+	.uleb128 .LBE149-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB151-.Ltext0
+	.uleb128 .LBE151-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB152-.Ltext0
+	.uleb128 .LBE152-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB154-.Ltext0
+	.uleb128 .LBE154-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB156-.Ltext0
+	.uleb128 .LBE156-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB158-.Ltext0
+	.uleb128 .LBE158-.Ltext0
+	.byte	0
+.LLRL94:
+	.byte	0x4
+	.uleb128 .LBB117-.Ltext0
+	.uleb128 .LBE117-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB124-.Ltext0
+	.uleb128 .LBE124-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB125-.Ltext0
+	.uleb128 .LBE125-.Ltext0
+	.byte	0
+.LLRL97:
+	.byte	0x4
+	.uleb128 .LBB118-.Ltext0
+	.uleb128 .LBE118-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB123-.Ltext0
+	.uleb128 .LBE123-.Ltext0
+	.byte	0
+.LLRL99:
+	.byte	0x4
+	.uleb128 .LBB120-.Ltext0
+	.uleb128 .LBE120-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB121-.Ltext0
+	.uleb128 .LBE121-.Ltext0
+	.byte	0
+.LLRL102:
+	.byte	0x4
+	.uleb128 .LBB136-.Ltext0
+	.uleb128 .LBE136-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB139-.Ltext0
+	.uleb128 .LBE139-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB140-.Ltext0
+	.uleb128 .LBE140-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB150-.Ltext0
+	.uleb128 .LBE150-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB153-.Ltext0
+	.uleb128 .LBE153-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB155-.Ltext0
+	.uleb128 .LBE155-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB157-.Ltext0
+	.uleb128 .LBE157-.Ltext0
+	.byte	0
+.LLRL109:
+	.byte	0x4
+	.uleb128 .LBB143-.Ltext0
+	.uleb128 .LBE143-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB144-.Ltext0
+	.uleb128 .LBE144-.Ltext0
+	.byte	0
+.LLRL118:
+	.byte	0x4
+	.uleb128 .LBB159-.Ltext0
+	.uleb128 .LBE159-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB166-.Ltext0
+	.uleb128 .LBE166-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB167-.Ltext0
+	.uleb128 .LBE167-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB168-.Ltext0
+	.uleb128 .LBE168-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB169-.Ltext0
+	.uleb128 .LBE169-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB178-.Ltext0
+	.uleb128 .LBE178-.Ltext0
+	.byte	0
+.LLRL122:
+	.byte	0x4
+	.uleb128 .LBB170-.Ltext0
+	.uleb128 .LBE170-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB174-.Ltext0
+	.uleb128 .LBE174-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB175-.Ltext0
+	.uleb128 .LBE175-.Ltext0
+	.byte	0
+.LLRL125:
+	.byte	0x4
+	.uleb128 .LBB176-.Ltext0
+	.uleb128 .LBE176-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB177-.Ltext0
+	.uleb128 .LBE177-.Ltext0
+	.byte	0
+.Ldebug_ranges3:
+	.section	.debug_line,"",@progbits
+.Ldebug_line0:
+	.section	.debug_str,"MS",@progbits,1
+.LASF46:
+	.string	"__glibc_reserved"
+.LASF263:
+	.string	"_SC_LEVEL3_CACHE_SIZE"
+.LASF45:
+	.string	"st_ctim"
+.LASF386:
+	.string	"defaults"
+.LASF173:
+	.string	"_SC_INT_MAX"
+.LASF26:
+	.string	"size_t"
+.LASF84:
+	.string	"_SC_MAPPED_FILES"
+.LASF69:
+	.string	"_SC_CHILD_MAX"
+.LASF57:
+	.string	"__kind"
+.LASF70:
+	.string	"_SC_CLK_TCK"
+.LASF337:
+	.string	"chunk"
+.LASF41:
+	.string	"st_blksize"
+.LASF42:
+	.string	"st_blocks"
+.LASF102:
+	.string	"_SC_SIGQUEUE_MAX"
+.LASF24:
+	.string	"__ssize_t"
+.LASF320:
+	.string	"_IO_codecvt"
+.LASF281:
+	.string	"_SC_THREAD_ROBUST_PRIO_INHERIT"
+.LASF209:
+	.string	"_SC_DEVICE_IO"
+.LASF379:
+	.string	"root"
+.LASF51:
+	.string	"__pthread_list_t"
+.LASF300:
+	.string	"_IO_save_end"
+.LASF267:
+	.string	"_SC_LEVEL4_CACHE_ASSOC"
+.LASF75:
+	.string	"_SC_JOB_CONTROL"
+.LASF171:
+	.string	"_SC_CHAR_MAX"
+.LASF15:
+	.string	"__gid_t"
+.LASF392:
+	.string	"path"
+.LASF44:
+	.string	"st_mtim"
+.LASF252:
+	.string	"_SC_TRACE_INHERIT"
+.LASF50:
+	.string	"__next"
+.LASF64:
+	.string	"__data"
+.LASF293:
+	.string	"_IO_write_base"
+.LASF49:
+	.string	"__prev"
+.LASF359:
+	.string	"open"
+.LASF123:
+	.string	"_SC_PII_SOCKET"
+.LASF309:
+	.string	"_lock"
+.LASF76:
+	.string	"_SC_SAVED_IDS"
+.LASF180:
+	.string	"_SC_SCHAR_MAX"
+.LASF48:
+	.string	"__pthread_internal_list"
+.LASF68:
+	.string	"_SC_ARG_MAX"
+.LASF31:
+	.string	"stat"
+.LASF233:
+	.string	"_SC_TIMEOUTS"
+.LASF298:
+	.string	"_IO_save_base"
+.LASF170:
+	.string	"_SC_CHAR_BIT"
+.LASF91:
+	.string	"_SC_AIO_LISTIO_MAX"
+.LASF55:
+	.string	"__owner"
+.LASF177:
+	.string	"_SC_MB_LEN_MAX"
+.LASF388:
+	.string	"bfile_segment"
+.LASF150:
+	.string	"_SC_THREAD_PRIO_PROTECT"
+.LASF124:
+	.string	"_SC_PII_INTERNET"
+.LASF151:
+	.string	"_SC_THREAD_PROCESS_SHARED"
+.LASF389:
+	.string	"bfile_align"
+.LASF302:
+	.string	"_chain"
+.LASF67:
+	.string	"ssize_t"
+.LASF277:
+	.string	"_SC_TRACE_NAME_MAX"
+.LASF306:
+	.string	"_cur_column"
+.LASF204:
+	.string	"_SC_C_LANG_SUPPORT"
+.LASF121:
+	.string	"_SC_PII"
+.LASF93:
+	.string	"_SC_AIO_PRIO_DELTA_MAX"
+.LASF9:
+	.string	"__uint8_t"
+.LASF13:
+	.string	"__dev_t"
+.LASF316:
+	.string	"_mode"
+.LASF369:
+	.string	"fileno"
+.LASF87:
+	.string	"_SC_MEMORY_PROTECTION"
+.LASF72:
+	.string	"_SC_OPEN_MAX"
+.LASF145:
+	.string	"_SC_THREAD_THREADS_MAX"
+.LASF222:
+	.string	"_SC_READER_WRITER_LOCKS"
+.LASF243:
+	.string	"_SC_STREAMS"
+.LASF11:
+	.string	"long int"
+.LASF95:
+	.string	"_SC_MQ_OPEN_MAX"
+.LASF213:
+	.string	"_SC_FIFO"
+.LASF210:
+	.string	"_SC_DEVICE_SPECIFIC"
+.LASF165:
+	.string	"_SC_2_C_VERSION"
+.LASF282:
+	.string	"_SC_THREAD_ROBUST_PRIO_PROTECT"
+.LASF319:
+	.string	"_IO_marker"
+.LASF343:
+	.string	"nseg"
+.LASF105:
+	.string	"_SC_BC_DIM_MAX"
+.LASF146:
+	.string	"_SC_THREAD_ATTR_STACKADDR"
+.LASF271:
+	.string	"_SC_V7_ILP32_OFF32"
+.LASF56:
+	.string	"__nusers"
+.LASF246:
+	.string	"_SC_V6_ILP32_OFFBIG"
+.LASF239:
+	.string	"_SC_2_PBS_LOCATE"
+.LASF380:
+	.string	"leaf"
+.LASF7:
+	.string	"signed char"
+.LASF22:
+	.string	"__blksize_t"
+.LASF259:
+	.string	"_SC_LEVEL1_DCACHE_LINESIZE"
+.LASF288:
+	.string	"_IO_FILE"
+.LASF183:
+	.string	"_SC_SHRT_MIN"
+.LASF36:
+	.string	"st_uid"
+.LASF287:
+	.string	"uint64_t"
+.LASF345:
+	.string	"digest"
+.LASF251:
+	.string	"_SC_TRACE_EVENT_FILTER"
+.LASF189:
+	.string	"_SC_NL_LANGMAX"
+.LASF52:
+	.string	"__pthread_mutex_s"
+.LASF247:
+	.string	"_SC_V6_LP64_OFF64"
+.LASF190:
+	.string	"_SC_NL_MSGMAX"
+.LASF3:
+	.string	"unsigned char"
+.LASF58:
+	.string	"__spins"
+.LASF313:
+	.string	"_freeres_list"
+.LASF133:
+	.string	"_SC_PII_OSI_CLTS"
+.LASF39:
+	.string	"st_rdev"
+.LASF365:
+	.string	"ftello"
+.LASF255:
+	.string	"_SC_LEVEL1_ICACHE_ASSOC"
+.LASF211:
+	.string	"_SC_DEVICE_SPECIFIC_R"
+.LASF387:
+	.string	"direct"
+.LASF178:
+	.string	"_SC_NZERO"
+.LASF167:
+	.string	"_SC_XOPEN_XPG2"
+.LASF168:
+	.string	"_SC_XOPEN_XPG3"
+.LASF169:
+	.string	"_SC_XOPEN_XPG4"
+.LASF186:
+	.string	"_SC_ULONG_MAX"
+.LASF25:
+	.string	"__syscall_slong_t"
+.LASF162:
+	.string	"_SC_XOPEN_ENH_I18N"
+.LASF367:
+	.string	"blake2s_pool_run"
+.LASF174:
+	.string	"_SC_INT_MIN"
+.LASF2:
+	.string	"char"
+.LASF166:
+	.string	"_SC_2_UPE"
+.LASF363:
+	.string	"blake2s_uring_run"
+.LASF384:
+	.string	"blake2s_file"
+.LASF98:
+	.string	"_SC_PAGESIZE"
+.LASF217:
+	.string	"_SC_FILE_SYSTEM"
+.LASF401:
+	.string	"_IO_lock_t"
+.LASF344:
+	.string	"lock"
+.LASF114:
+	.string	"_SC_2_VERSION"
+.LASF403:
+	.string	"__errno_location"
+.LASF112:
+	.string	"_SC_RE_DUP_MAX"
+.LASF385:
+	.string	"blake2s_file_ex"
+.LASF264:
+	.string	"_SC_LEVEL3_CACHE_ASSOC"
+.LASF17:
+	.string	"__mode_t"
+.LASF336:
+	.string	"flags"
+.LASF117:
+	.string	"_SC_2_FORT_DEV"
+.LASF172:
+	.string	"_SC_CHAR_MIN"
+.LASF352:
+	.string	"pthread_mutex_init"
+.LASF327:
+	.string	"leaf_len"
+.LASF129:
+	.string	"_SC_IOV_MAX"
+.LASF353:
+	.string	"posix_memalign"
+.LASF208:
+	.string	"_SC_THREAD_CPUTIME"
+.LASF231:
+	.string	"_SC_SYSTEM_DATABASE"
+.LASF356:
+	.string	"mmap"
+.LASF377:
+	.string	"stream"
+.LASF381:
+	.string	"node"
+.LASF131:
+	.string	"_SC_PII_INTERNET_DGRAM"
+.LASF216:
+	.string	"_SC_FILE_LOCKING"
+.LASF301:
+	.string	"_markers"
+.LASF364:
+	.string	"blake2s_pipe_run"
+.LASF181:
+	.string	"_SC_SCHAR_MIN"
+.LASF397:
+	.string	"bfile_map"
+.LASF128:
+	.string	"_SC_UIO_MAXIOV"
+.LASF371:
+	.string	"blake2s_update"
+.LASF97:
+	.string	"_SC_VERSION"
+.LASF258:
+	.string	"_SC_LEVEL1_DCACHE_ASSOC"
+.LASF53:
+	.string	"__lock"
+.LASF223:
+	.string	"_SC_SPIN_LOCKS"
+.LASF310:
+	.string	"_offset"
+.LASF185:
+	.string	"_SC_UINT_MAX"
+.LASF376:
+	.string	"pread"
+.LASF37:
+	.string	"st_gid"
+.LASF270:
+	.string	"_SC_RAW_SOCKETS"
+.LASF404:
+	.string	"bfile_task"
+.LASF136:
+	.string	"_SC_THREADS"
+.LASF137:
+	.string	"_SC_THREAD_SAFE_FUNCTIONS"
+.LASF176:
+	.string	"_SC_WORD_BIT"
+.LASF224:
+	.string	"_SC_REGEXP"
+.LASF80:
+	.string	"_SC_ASYNCHRONOUS_IO"
+.LASF113:
+	.string	"_SC_CHARCLASS_NAME_MAX"
+.LASF329:
+	.string	"node_depth"
+.LASF158:
+	.string	"_SC_XOPEN_VERSION"
+.LASF265:
+	.string	"_SC_LEVEL3_CACHE_LINESIZE"
+.LASF144:
+	.string	"_SC_THREAD_STACK_MIN"
+.LASF12:
+	.string	"__uint64_t"
+.LASF6:
+	.string	"long unsigned int"
+.LASF160:
+	.string	"_SC_XOPEN_UNIX"
+.LASF193:
+	.string	"_SC_NL_TEXTMAX"
+.LASF304:
+	.string	"_flags2"
+.LASF130:
+	.string	"_SC_PII_INTERNET_STREAM"
+.LASF284:
+	.string	"_SC_SIGSTKSZ"
+.LASF40:
+	.string	"st_size"
+.LASF138:
+	.string	"_SC_GETGR_R_SIZE_MAX"
+.LASF292:
+	.string	"_IO_read_base"
+.LASF272:
+	.string	"_SC_V7_ILP32_OFFBIG"
+.LASF349:
+	.string	"blake2s_init_param"
+.LASF373:
+	.string	"ferror"
+.LASF89:
+	.string	"_SC_SEMAPHORES"
+.LASF266:
+	.string	"_SC_LEVEL4_CACHE_SIZE"
+.LASF283:
+	.string	"_SC_MINSIGSTKSZ"
+.LASF317:
+	.string	"_unused2"
+.LASF219:
+	.string	"_SC_MULTI_PROCESS"
+.LASF153:
+	.string	"_SC_NPROCESSORS_ONLN"
+.LASF61:
+	.string	"__size"
+.LASF235:
+	.string	"_SC_USER_GROUPS"
+.LASF120:
+	.string	"_SC_2_LOCALEDEF"
+.LASF111:
+	.string	"_SC_LINE_MAX"
+.LASF305:
+	.string	"_old_offset"
+.LASF154:
+	.string	"_SC_PHYS_PAGES"
+.LASF199:
+	.string	"_SC_XOPEN_REALTIME"
+.LASF299:
+	.string	"_IO_backup_base"
+.LASF227:
+	.string	"_SC_SIGNALS"
+.LASF366:
+	.string	"fstat"
+.LASF23:
+	.string	"__blkcnt_t"
+.LASF218:
+	.string	"_SC_MONOTONIC_CLOCK"
+.LASF99:
+	.string	"_SC_RTSIG_MAX"
+.LASF215:
+	.string	"_SC_FILE_ATTRIBUTES"
+.LASF16:
+	.string	"__ino_t"
+.LASF236:
+	.string	"_SC_USER_GROUPS_R"
+.LASF159:
+	.string	"_SC_XOPEN_XCU_VERSION"
+.LASF10:
+	.string	"__uint32_t"
+.LASF122:
+	.string	"_SC_PII_XTI"
+.LASF200:
+	.string	"_SC_XOPEN_REALTIME_THREADS"
+.LASF66:
+	.string	"long long int"
+.LASF175:
+	.string	"_SC_LONG_BIT"
+.LASF195:
+	.string	"_SC_XBS5_ILP32_OFFBIG"
+.LASF330:
+	.string	"inner_len"
+.LASF295:
+	.string	"_IO_write_end"
+.LASF326:
+	.string	"depth"
+.LASF184:
+	.string	"_SC_UCHAR_MAX"
+.LASF214:
+	.string	"_SC_PIPE"
+.LASF234:
+	.string	"_SC_TYPED_MEMORY_OBJECTS"
+.LASF140:
+	.string	"_SC_LOGIN_NAME_MAX"
+.LASF143:
+	.string	"_SC_THREAD_KEYS_MAX"
+.LASF357:
+	.string	"posix_fadvise"
+.LASF201:
+	.string	"_SC_ADVISORY_INFO"
+.LASF347:
+	.string	"pthread_mutex_unlock"
+.LASF394:
+	.string	"read"
+.LASF296:
+	.string	"_IO_buf_base"
+.LASF5:
+	.string	"unsigned int"
+.LASF323:
+	.string	"digest_len"
+.LASF335:
+	.string	"engine"
+.LASF65:
+	.string	"pthread_mutex_t"
+.LASF108:
+	.string	"_SC_COLL_WEIGHTS_MAX"
+.LASF134:
+	.string	"_SC_PII_OSI_M"
+.LASF116:
+	.string	"_SC_2_C_DEV"
+.LASF38:
+	.string	"__pad0"
+.LASF315:
+	.string	"__pad5"
+.LASF232:
+	.string	"_SC_SYSTEM_DATABASE_R"
+.LASF276:
+	.string	"_SC_TRACE_EVENT_NAME_MAX"
+.LASF187:
+	.string	"_SC_USHRT_MAX"
+.LASF395:
+	.string	"bfile_read"
+.LASF269:
+	.string	"_SC_IPV6"
+.LASF249:
+	.string	"_SC_HOST_NAME_MAX"
+.LASF107:
+	.string	"_SC_BC_STRING_MAX"
+.LASF148:
+	.string	"_SC_THREAD_PRIORITY_SCHEDULING"
+.LASF289:
+	.string	"_flags"
+.LASF332:
+	.string	"personal"
+.LASF126:
+	.string	"_SC_POLL"
+.LASF398:
+	.string	"page"
+.LASF354:
+	.string	"munmap"
+.LASF311:
+	.string	"_codecvt"
+.LASF331:
+	.string	"salt"
+.LASF54:
+	.string	"__count"
+.LASF119:
+	.string	"_SC_2_SW_DEV"
+.LASF34:
+	.string	"st_nlink"
+.LASF27:
+	.string	"off_t"
+.LASF77:
+	.string	"_SC_REALTIME_SIGNALS"
+.LASF340:
+	.string	"blake2s_sigma"
+.LASF325:
+	.string	"fanout"
+.LASF197:
+	.string	"_SC_XBS5_LPBIG_OFFBIG"
+.LASF238:
+	.string	"_SC_2_PBS_ACCOUNTING"
+.LASF142:
+	.string	"_SC_THREAD_DESTRUCTOR_ITERATIONS"
+.LASF253:
+	.string	"_SC_TRACE_LOG"
+.LASF328:
+	.string	"node_offset"
+.LASF85:
+	.string	"_SC_MEMLOCK"
+.LASF125:
+	.string	"_SC_PII_OSI"
+.LASF391:
+	.string	"bfile_open_direct"
+.LASF94:
+	.string	"_SC_DELAYTIMER_MAX"
+.LASF118:
+	.string	"_SC_2_FORT_RUN"
+.LASF273:
+	.string	"_SC_V7_LP64_OFF64"
+.LASF152:
+	.string	"_SC_NPROCESSORS_CONF"
+.LASF182:
+	.string	"_SC_SHRT_MAX"
+.LASF318:
+	.string	"FILE"
+.LASF341:
+	.string	"bfile_job"
+.LASF92:
+	.string	"_SC_AIO_MAX"
+.LASF202:
+	.string	"_SC_BARRIERS"
+.LASF225:
+	.string	"_SC_REGEX_VERSION"
+.LASF262:
+	.string	"_SC_LEVEL2_CACHE_LINESIZE"
+.LASF32:
+	.string	"st_dev"
+.LASF370:
+	.string	"blake2s_final"
+.LASF30:
+	.string	"timespec"
+.LASF90:
+	.string	"_SC_SHARED_MEMORY_OBJECTS"
+.LASF334:
+	.string	"blake2s_io"
+.LASF339:
+	.string	"blake2s_iv"
+.LASF342:
+	.string	"size"
+.LASF196:
+	.string	"_SC_XBS5_LP64_OFF64"
+.LASF47:
+	.string	"long long unsigned int"
+.LASF274:
+	.string	"_SC_V7_LPBIG_OFFBIG"
+.LASF60:
+	.string	"__list"
+.LASF285:
+	.string	"uint8_t"
+.LASF188:
+	.string	"_SC_NL_ARGMAX"
+.LASF19:
+	.string	"__off_t"
+.LASF220:
+	.string	"_SC_SINGLE_PROCESS"
+.LASF382:
+	.string	"want"
+.LASF155:
+	.string	"_SC_AVPHYS_PAGES"
+.LASF163:
+	.string	"_SC_XOPEN_SHM"
+.LASF230:
+	.string	"_SC_THREAD_SPORADIC_SERVER"
+.LASF314:
+	.string	"_freeres_buf"
+.LASF275:
+	.string	"_SC_SS_REPL_MAX"
+.LASF191:
+	.string	"_SC_NL_NMAX"
+.LASF21:
+	.string	"__time_t"
+.LASF346:
+	.string	"memset"
+.LASF198:
+	.string	"_SC_XOPEN_LEGACY"
+.LASF308:
+	.string	"_shortbuf"
+.LASF240:
+	.string	"_SC_2_PBS_MESSAGE"
+.LASF393:
+	.string	"blake2s_file_finish"
+.LASF100:
+	.string	"_SC_SEM_NSEMS_MAX"
+.LASF135:
+	.string	"_SC_T_IOV_MAX"
+.LASF81:
+	.string	"_SC_PRIORITIZED_IO"
+.LASF375:
+	.string	"malloc"
+.LASF62:
+	.string	"__align"
+.LASF20:
+	.string	"__off64_t"
+.LASF245:
+	.string	"_SC_V6_ILP32_OFF32"
+.LASF73:
+	.string	"_SC_STREAM_MAX"
+.LASF74:
+	.string	"_SC_TZNAME_MAX"
+.LASF244:
+	.string	"_SC_2_PBS_CHECKPOINT"
+.LASF390:
+	.string	"bfile_depth"
+.LASF228:
+	.string	"_SC_SPAWN"
+.LASF86:
+	.string	"_SC_MEMLOCK_RANGE"
+.LASF106:
+	.string	"_SC_BC_SCALE_MAX"
+.LASF358:
+	.string	"sysconf"
+.LASF278:
+	.string	"_SC_TRACE_SYS_MAX"
+.LASF242:
+	.string	"_SC_SYMLOOP_MAX"
+.LASF312:
+	.string	"_wide_data"
+.LASF297:
+	.string	"_IO_buf_end"
+.LASF164:
+	.string	"_SC_2_CHAR_TERM"
+.LASF226:
+	.string	"_SC_SHELL"
+.LASF212:
+	.string	"_SC_FD_MGMT"
+.LASF161:
+	.string	"_SC_XOPEN_CRYPT"
+.LASF256:
+	.string	"_SC_LEVEL1_ICACHE_LINESIZE"
+.LASF205:
+	.string	"_SC_C_LANG_SUPPORT_R"
+.LASF279:
+	.string	"_SC_TRACE_USER_EVENT_MAX"
+.LASF103:
+	.string	"_SC_TIMER_MAX"
+.LASF237:
+	.string	"_SC_2_PBS"
+.LASF207:
+	.string	"_SC_CPUTIME"
+.LASF229:
+	.string	"_SC_SPORADIC_SERVER"
+.LASF8:
+	.string	"short int"
+.LASF206:
+	.string	"_SC_CLOCK_SELECTION"
+.LASF194:
+	.string	"_SC_XBS5_ILP32_OFF32"
+.LASF221:
+	.string	"_SC_NETWORKING"
+.LASF63:
+	.string	"pthread_mutexattr_t"
+.LASF348:
+	.string	"pthread_mutex_lock"
+.LASF268:
+	.string	"_SC_LEVEL4_CACHE_LINESIZE"
+.LASF29:
+	.string	"tv_nsec"
+.LASF156:
+	.string	"_SC_ATEXIT_MAX"
+.LASF132:
+	.string	"_SC_PII_OSI_COTS"
+.LASF96:
+	.string	"_SC_MQ_PRIO_MAX"
+.LASF307:
+	.string	"_vtable_offset"
+.LASF101:
+	.string	"_SC_SEM_VALUE_MAX"
+.LASF59:
+	.string	"__elision"
+.LASF396:
+	.string	"blake2s_pread"
+.LASF405:
+	.string	"bfile_param"
+.LASF355:
+	.string	"madvise"
+.LASF79:
+	.string	"_SC_TIMERS"
+.LASF157:
+	.string	"_SC_PASS_MAX"
+.LASF83:
+	.string	"_SC_FSYNC"
+.LASF127:
+	.string	"_SC_SELECT"
+.LASF360:
+	.string	"snprintf"
+.LASF141:
+	.string	"_SC_TTY_NAME_MAX"
+.LASF383:
+	.string	"blake2s_file_tree"
+.LASF350:
+	.string	"blake2s_tree_nodes"
+.LASF378:
+	.string	"nthreads"
+.LASF368:
+	.string	"blake2s_init"
+.LASF321:
+	.string	"_IO_wide_data"
+.LASF322:
+	.string	"blake2s_param"
+.LASF35:
+	.string	"st_mode"
+.LASF14:
+	.string	"__uid_t"
+.LASF88:
+	.string	"_SC_MESSAGE_PASSING"
+.LASF291:
+	.string	"_IO_read_end"
+.LASF261:
+	.string	"_SC_LEVEL2_CACHE_ASSOC"
+.LASF104:
+	.string	"_SC_BC_BASE_MAX"
+.LASF260:
+	.string	"_SC_LEVEL2_CACHE_SIZE"
+.LASF110:
+	.string	"_SC_EXPR_NEST_MAX"
+.LASF82:
+	.string	"_SC_SYNCHRONIZED_IO"
+.LASF286:
+	.string	"uint32_t"
+.LASF303:
+	.string	"_fileno"
+.LASF280:
+	.string	"_SC_XOPEN_STREAMS"
+.LASF257:
+	.string	"_SC_LEVEL1_DCACHE_SIZE"
+.LASF400:
+	.string	"GNU C99 12.2.0 -mtune=generic -march=x86-64 -g -O3 -std=c99 -fasynchronous-unwind-tables"
+.LASF241:
+	.string	"_SC_2_PBS_TRACK"
+.LASF351:
+	.string	"pthread_mutex_destroy"
+.LASF71:
+	.string	"_SC_NGROUPS_MAX"
+.LASF248:
+	.string	"_SC_V6_LPBIG_OFFBIG"
+.LASF372:
+	.string	"free"
+.LASF338:
+	.string	"buf_len"
+.LASF402:
+	.string	"blake2s_ctx"
+.LASF333:
+	.string	"last_node"
+.LASF4:
+	.string	"short unsigned int"
+.LASF254:
+	.string	"_SC_LEVEL1_ICACHE_SIZE"
+.LASF399:
+	.string	"base"
+.LASF374:
+	.string	"fread"
+.LASF109:
+	.string	"_SC_EQUIV_CLASS_MAX"
+.LASF294:
+	.string	"_IO_write_ptr"
+.LASF203:
+	.string	"_SC_BASE"
+.LASF361:
+	.string	"fseeko"
+.LASF78:
+	.string	"_SC_PRIORITY_SCHEDULING"
+.LASF290:
+	.string	"_IO_read_ptr"
+.LASF179:
+	.string	"_SC_SSIZE_MAX"
+.LASF324:
+	.string	"key_len"
+.LASF139:
+	.string	"_SC_GETPW_R_SIZE_MAX"
+.LASF33:
+	.string	"st_ino"
+.LASF149:
+	.string	"_SC_THREAD_PRIO_INHERIT"
+.LASF18:
+	.string	"__nlink_t"
+.LASF250:
+	.string	"_SC_TRACE"
+.LASF362:
+	.string	"close"
+.LASF192:
+	.string	"_SC_NL_SETMAX"
+.LASF28:
+	.string	"tv_sec"
+.LASF115:
+	.string	"_SC_2_C_BIND"
+.LASF43:
+	.string	"st_atim"
+.LASF147:
+	.string	"_SC_THREAD_ATTR_STACKSIZE"
+	.section	.debug_line_str,"MS",@progbits,1
+.LASF1:
+	.string	"/root/repo"
+.LASF0:
+	.string	"blake2s-file.c"
+	.ident	"GCC: (Debian 12.2.0-14+deb12u1) 12.2.0"
+	.section	.note.GNU-stack,"",@progbits
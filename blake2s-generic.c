@@ -14,7 +14,7 @@ static inline void butil_le32_copy(void *dst, const void *src, unsigned bytes)
 }
 
 
-static void blake2s_10rounds(u32 v[16], const u32 m[16])
+static inline void blake2s_10rounds(u32 v[16], const u32 m[16])
 {
 #define BLAKE2S_G(M,N,a,b,c,d) \
     do { \
@@ -30,41 +30,82 @@ static void blake2s_10rounds(u32 v[16], const u32 m[16])
 
 #define Si(i,j) blake2s_sigma[(i)][(j)]
 
-    /* 10 rounds times 8 applications of G */
-    for (unsigned r = 0; r < 10; r++) {
-        BLAKE2S_G(m[Si(r, 0)], m[Si(r, 1)], v[ 0], v[ 4], v[ 8], v[12]);
-        BLAKE2S_G(m[Si(r, 2)], m[Si(r, 3)], v[ 1], v[ 5], v[ 9], v[13]);
-        BLAKE2S_G(m[Si(r, 4)], m[Si(r, 5)], v[ 2], v[ 6], v[10], v[14]);
-        BLAKE2S_G(m[Si(r, 6)], m[Si(r, 7)], v[ 3], v[ 7], v[11], v[15]);
+    /* Rounds are spelled out so that every sigma lookup is a constant,
+     * and v[] and m[] are only ever indexed by constants: the compiler
+     * can then keep all of them in registers. */
+#define FULLROUND(r) \
+    do { \
+        BLAKE2S_G(m[Si(r, 0)], m[Si(r, 1)], v[ 0], v[ 4], v[ 8], v[12]); \
+        BLAKE2S_G(m[Si(r, 2)], m[Si(r, 3)], v[ 1], v[ 5], v[ 9], v[13]); \
+        BLAKE2S_G(m[Si(r, 4)], m[Si(r, 5)], v[ 2], v[ 6], v[10], v[14]); \
+        BLAKE2S_G(m[Si(r, 6)], m[Si(r, 7)], v[ 3], v[ 7], v[11], v[15]); \
+        \
+        BLAKE2S_G(m[Si(r, 8)], m[Si(r, 9)], v[ 0], v[ 5], v[10], v[15]); \
+        BLAKE2S_G(m[Si(r,10)], m[Si(r,11)], v[ 1], v[ 6], v[11], v[12]); \
+        BLAKE2S_G(m[Si(r,12)], m[Si(r,13)], v[ 2], v[ 7], v[ 8], v[13]); \
+        BLAKE2S_G(m[Si(r,14)], m[Si(r,15)], v[ 3], v[ 4], v[ 9], v[14]); \
+    } while (0)
 
-        BLAKE2S_G(m[Si(r, 8)], m[Si(r, 9)], v[ 0], v[ 5], v[10], v[15]);
-        BLAKE2S_G(m[Si(r,10)], m[Si(r,11)], v[ 1], v[ 6], v[11], v[12]);
-        BLAKE2S_G(m[Si(r,12)], m[Si(r,13)], v[ 2], v[ 7], v[ 8], v[13]);
-        BLAKE2S_G(m[Si(r,14)], m[Si(r,15)], v[ 3], v[ 4], v[ 9], v[14]);
-    }
+    /* 10 rounds times 8 applications of G */
+    FULLROUND(0);
+    FULLROUND(1);
+    FULLROUND(2);
+    FULLROUND(3);
+    FULLROUND(4);
+    FULLROUND(5);
+    FULLROUND(6);
+    FULLROUND(7);
+    FULLROUND(8);
+    FULLROUND(9);
 }
 
-void blake2s_compress(struct blake2s_ctx *ctx, const void *msg)
+static inline void blake2s_block(u32 H[8], const u32 t[2], const u32 f[2],
+                                 const void *msg)
 {
     u32 v[16];
     u32 m[16];
     butil_le32_copy(m, msg, sizeof(m));
-    butil_copy_words(v, ctx->H, sizeof(ctx->H));
+    butil_copy_words(v, H, 8*sizeof(*H));
     v[ 8] = blake2s_iv[0];
     v[ 9] = blake2s_iv[1];
     v[10] = blake2s_iv[2];
     v[11] = blake2s_iv[3];
-    v[12] = blake2s_iv[4] ^ ctx->t[0];
-    v[13] = blake2s_iv[5] ^ ctx->t[1];
-    v[14] = blake2s_iv[6] ^ ctx->f[0];
-    v[15] = blake2s_iv[7] ^ ctx->f[1];
+    v[12] = blake2s_iv[4] ^ t[0];
+    v[13] = blake2s_iv[5] ^ t[1];
+    v[14] = blake2s_iv[6] ^ f[0];
+    v[15] = blake2s_iv[7] ^ f[1];
 
     blake2s_10rounds(v, m);
 
     for (unsigned i = 0; i < 8;) {
-        ctx->H[i] ^= v[i] ^ v[i+8]; i++;
-        ctx->H[i] ^= v[i] ^ v[i+8]; i++;
-        ctx->H[i] ^= v[i] ^ v[i+8]; i++;
-        ctx->H[i] ^= v[i] ^ v[i+8]; i++;
+        H[i] ^= v[i] ^ v[i+8]; i++;
+        H[i] ^= v[i] ^ v[i+8]; i++;
+        H[i] ^= v[i] ^ v[i+8]; i++;
+        H[i] ^= v[i] ^ v[i+8]; i++;
+    }
+}
+
+void blake2s_compress_generic(struct blake2s_ctx *ctx, const void *msg)
+{
+    blake2s_block(ctx->H, ctx->t, ctx->f, msg);
+}
+
+void blake2s_compress_blocks_generic(struct blake2s_ctx *ctx, const void *msg,
+                                     size_t nblocks)
+{
+    const unsigned char *m = msg;
+    u32 H[8], t[2], f[2];
+    butil_copy_words(H, ctx->H, sizeof(H));
+    t[0] = ctx->t[0];
+    t[1] = ctx->t[1];
+    f[0] = ctx->f[0];
+    f[1] = ctx->f[1];
+    for (; nblocks; nblocks--, m += BLAKE2S_BLOCK) {
+        t[0] += BLAKE2S_BLOCK;
+        t[1] += (t[0] < BLAKE2S_BLOCK);
+        blake2s_block(H, t, f, m);
     }
+    butil_copy_words(ctx->H, H, sizeof(H));
+    ctx->t[0] = t[0];
+    ctx->t[1] = t[1];
 }
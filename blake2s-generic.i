@@ -0,0 +1,1531 @@
+# 0 "blake2s-generic.c"
+# 1 "/root/repo//"
+# 0 "<built-in>"
+# 0 "<command-line>"
+# 1 "/usr/include/stdc-predef.h" 1 3 4
+# 0 "<command-line>" 2
+# 1 "blake2s-generic.c"
+
+# 1 "blake2s.h" 1
+# 15 "blake2s.h"
+# 1 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stddef.h" 1 3 4
+# 145 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stddef.h" 3 4
+
+# 145 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stddef.h" 3 4
+typedef long int ptrdiff_t;
+# 214 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stddef.h" 3 4
+typedef long unsigned int size_t;
+# 329 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stddef.h" 3 4
+typedef int wchar_t;
+# 16 "blake2s.h" 2
+# 1 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stdint.h" 1 3 4
+# 9 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stdint.h" 3 4
+# 1 "/usr/include/stdint.h" 1 3 4
+# 26 "/usr/include/stdint.h" 3 4
+# 1 "/usr/include/x86_64-linux-gnu/bits/libc-header-start.h" 1 3 4
+# 33 "/usr/include/x86_64-linux-gnu/bits/libc-header-start.h" 3 4
+# 1 "/usr/include/features.h" 1 3 4
+# 392 "/usr/include/features.h" 3 4
+# 1 "/usr/include/features-time64.h" 1 3 4
+# 20 "/usr/include/features-time64.h" 3 4
+# 1 "/usr/include/x86_64-linux-gnu/bits/wordsize.h" 1 3 4
+# 21 "/usr/include/features-time64.h" 2 3 4
+# 1 "/usr/include/x86_64-linux-gnu/bits/timesize.h" 1 3 4
+# 19 "/usr/include/x86_64-linux-gnu/bits/timesize.h" 3 4
+# 1 "/usr/include/x86_64-linux-gnu/bits/wordsize.h" 1 3 4
+# 20 "/usr/include/x86_64-linux-gnu/bits/timesize.h" 2 3 4
+# 22 "/usr/include/features-time64.h" 2 3 4
+# 393 "/usr/include/features.h" 2 3 4
+# 489 "/usr/include/features.h" 3 4
+# 1 "/usr/include/x86_64-linux-gnu/sys/cdefs.h" 1 3 4
+# 561 "/usr/include/x86_64-linux-gnu/sys/cdefs.h" 3 4
+# 1 "/usr/include/x86_64-linux-gnu/bits/wordsize.h" 1 3 4
+# 562 "/usr/include/x86_64-linux-gnu/sys/cdefs.h" 2 3 4
+# 1 "/usr/include/x86_64-linux-gnu/bits/long-double.h" 1 3 4
+# 563 "/usr/include/x86_64-linux-gnu/sys/cdefs.h" 2 3 4
+# 490 "/usr/include/features.h" 2 3 4
+# 513 "/usr/include/features.h" 3 4
+# 1 "/usr/include/x86_64-linux-gnu/gnu/stubs.h" 1 3 4
+# 10 "/usr/include/x86_64-linux-gnu/gnu/stubs.h" 3 4
+# 1 "/usr/include/x86_64-linux-gnu/gnu/stubs-64.h" 1 3 4
+# 11 "/usr/include/x86_64-linux-gnu/gnu/stubs.h" 2 3 4
+# 514 "/usr/include/features.h" 2 3 4
+# 34 "/usr/include/x86_64-linux-gnu/bits/libc-header-start.h" 2 3 4
+# 27 "/usr/include/stdint.h" 2 3 4
+# 1 "/usr/include/x86_64-linux-gnu/bits/types.h" 1 3 4
+# 27 "/usr/include/x86_64-linux-gnu/bits/types.h" 3 4
+# 1 "/usr/include/x86_64-linux-gnu/bits/wordsize.h" 1 3 4
+# 28 "/usr/include/x86_64-linux-gnu/bits/types.h" 2 3 4
+# 1 "/usr/include/x86_64-linux-gnu/bits/timesize.h" 1 3 4
+# 19 "/usr/include/x86_64-linux-gnu/bits/timesize.h" 3 4
+# 1 "/usr/include/x86_64-linux-gnu/bits/wordsize.h" 1 3 4
+# 20 "/usr/include/x86_64-linux-gnu/bits/timesize.h" 2 3 4
+# 29 "/usr/include/x86_64-linux-gnu/bits/types.h" 2 3 4
+
+
+typedef unsigned char __u_char;
+typedef unsigned short int __u_short;
+typedef unsigned int __u_int;
+typedef unsigned long int __u_long;
+
+
+typedef signed char __int8_t;
+typedef unsigned char __uint8_t;
+typedef signed short int __int16_t;
+typedef unsigned short int __uint16_t;
+typedef signed int __int32_t;
+typedef unsigned int __uint32_t;
+
+typedef signed long int __int64_t;
+typedef unsigned long int __uint64_t;
+
+
+
+
+
+
+typedef __int8_t __int_least8_t;
+typedef __uint8_t __uint_least8_t;
+typedef __int16_t __int_least16_t;
+typedef __uint16_t __uint_least16_t;
+typedef __int32_t __int_least32_t;
+typedef __uint32_t __uint_least32_t;
+typedef __int64_t __int_least64_t;
+typedef __uint64_t __uint_least64_t;
+
+
+
+typedef long int __quad_t;
+typedef unsigned long int __u_quad_t;
+
+
+
+
+
+
+
+typedef long int __intmax_t;
+typedef unsigned long int __uintmax_t;
+# 141 "/usr/include/x86_64-linux-gnu/bits/types.h" 3 4
+# 1 "/usr/include/x86_64-linux-gnu/bits/typesizes.h" 1 3 4
+# 142 "/usr/include/x86_64-linux-gnu/bits/types.h" 2 3 4
+# 1 "/usr/include/x86_64-linux-gnu/bits/time64.h" 1 3 4
+# 143 "/usr/include/x86_64-linux-gnu/bits/types.h" 2 3 4
+
+
+typedef unsigned long int __dev_t;
+typedef unsigned int __uid_t;
+typedef unsigned int __gid_t;
+typedef unsigned long int __ino_t;
+typedef unsigned long int __ino64_t;
+typedef unsigned int __mode_t;
+typedef unsigned long int __nlink_t;
+typedef long int __off_t;
+typedef long int __off64_t;
+typedef int __pid_t;
+typedef struct { int __val[2]; } __fsid_t;
+typedef long int __clock_t;
+typedef unsigned long int __rlim_t;
+typedef unsigned long int __rlim64_t;
+typedef unsigned int __id_t;
+typedef long int __time_t;
+typedef unsigned int __useconds_t;
+typedef long int __suseconds_t;
+typedef long int __suseconds64_t;
+
+typedef int __daddr_t;
+typedef int __key_t;
+
+
+typedef int __clockid_t;
+
+
+typedef void * __timer_t;
+
+
+typedef long int __blksize_t;
+
+
+
+
+typedef long int __blkcnt_t;
+typedef long int __blkcnt64_t;
+
+
+typedef unsigned long int __fsblkcnt_t;
+typedef unsigned long int __fsblkcnt64_t;
+
+
+typedef unsigned long int __fsfilcnt_t;
+typedef unsigned long int __fsfilcnt64_t;
+
+
+typedef long int __fsword_t;
+
+typedef long int __ssize_t;
+
+
+typedef long int __syscall_slong_t;
+
+typedef unsigned long int __syscall_ulong_t;
+
+
+
+typedef __off64_t __loff_t;
+typedef char *__caddr_t;
+
+
+typedef long int __intptr_t;
+
+
+typedef unsigned int __socklen_t;
+
+
+
+
+typedef int __sig_atomic_t;
+# 28 "/usr/include/stdint.h" 2 3 4
+# 1 "/usr/include/x86_64-linux-gnu/bits/wchar.h" 1 3 4
+# 29 "/usr/include/stdint.h" 2 3 4
+# 1 "/usr/include/x86_64-linux-gnu/bits/wordsize.h" 1 3 4
+# 30 "/usr/include/stdint.h" 2 3 4
+
+
+
+
+# 1 "/usr/include/x86_64-linux-gnu/bits/stdint-intn.h" 1 3 4
+# 24 "/usr/include/x86_64-linux-gnu/bits/stdint-intn.h" 3 4
+typedef __int8_t int8_t;
+typedef __int16_t int16_t;
+typedef __int32_t int32_t;
+typedef __int64_t int64_t;
+# 35 "/usr/include/stdint.h" 2 3 4
+
+
+# 1 "/usr/include/x86_64-linux-gnu/bits/stdint-uintn.h" 1 3 4
+# 24 "/usr/include/x86_64-linux-gnu/bits/stdint-uintn.h" 3 4
+typedef __uint8_t uint8_t;
+typedef __uint16_t uint16_t;
+typedef __uint32_t uint32_t;
+typedef __uint64_t uint64_t;
+# 38 "/usr/include/stdint.h" 2 3 4
+
+
+
+
+
+typedef __int_least8_t int_least8_t;
+typedef __int_least16_t int_least16_t;
+typedef __int_least32_t int_least32_t;
+typedef __int_least64_t int_least64_t;
+
+
+typedef __uint_least8_t uint_least8_t;
+typedef __uint_least16_t uint_least16_t;
+typedef __uint_least32_t uint_least32_t;
+typedef __uint_least64_t uint_least64_t;
+
+
+
+
+
+typedef signed char int_fast8_t;
+
+typedef long int int_fast16_t;
+typedef long int int_fast32_t;
+typedef long int int_fast64_t;
+# 71 "/usr/include/stdint.h" 3 4
+typedef unsigned char uint_fast8_t;
+
+typedef unsigned long int uint_fast16_t;
+typedef unsigned long int uint_fast32_t;
+typedef unsigned long int uint_fast64_t;
+# 87 "/usr/include/stdint.h" 3 4
+typedef long int intptr_t;
+
+
+typedef unsigned long int uintptr_t;
+# 101 "/usr/include/stdint.h" 3 4
+typedef __intmax_t intmax_t;
+typedef __uintmax_t uintmax_t;
+# 10 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stdint.h" 2 3 4
+# 17 "blake2s.h" 2
+# 1 "/usr/include/stdio.h" 1 3 4
+# 27 "/usr/include/stdio.h" 3 4
+# 1 "/usr/include/x86_64-linux-gnu/bits/libc-header-start.h" 1 3 4
+# 28 "/usr/include/stdio.h" 2 3 4
+
+
+
+
+
+# 1 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stddef.h" 1 3 4
+# 34 "/usr/include/stdio.h" 2 3 4
+
+
+# 1 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stdarg.h" 1 3 4
+# 40 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stdarg.h" 3 4
+typedef __builtin_va_list __gnuc_va_list;
+# 37 "/usr/include/stdio.h" 2 3 4
+
+
+# 1 "/usr/include/x86_64-linux-gnu/bits/types/__fpos_t.h" 1 3 4
+
+
+
+
+# 1 "/usr/include/x86_64-linux-gnu/bits/types/__mbstate_t.h" 1 3 4
+# 13 "/usr/include/x86_64-linux-gnu/bits/types/__mbstate_t.h" 3 4
+typedef struct
+{
+  int __count;
+  union
+  {
+    unsigned int __wch;
+    char __wchb[4];
+  } __value;
+} __mbstate_t;
+# 6 "/usr/include/x86_64-linux-gnu/bits/types/__fpos_t.h" 2 3 4
+
+
+
+
+typedef struct _G_fpos_t
+{
+  __off_t __pos;
+  __mbstate_t __state;
+} __fpos_t;
+# 40 "/usr/include/stdio.h" 2 3 4
+# 1 "/usr/include/x86_64-linux-gnu/bits/types/__fpos64_t.h" 1 3 4
+# 10 "/usr/include/x86_64-linux-gnu/bits/types/__fpos64_t.h" 3 4
+typedef struct _G_fpos64_t
+{
+  __off64_t __pos;
+  __mbstate_t __state;
+} __fpos64_t;
+# 41 "/usr/include/stdio.h" 2 3 4
+# 1 "/usr/include/x86_64-linux-gnu/bits/types/__FILE.h" 1 3 4
+
+
+
+struct _IO_FILE;
+typedef struct _IO_FILE __FILE;
+# 42 "/usr/include/stdio.h" 2 3 4
+# 1 "/usr/include/x86_64-linux-gnu/bits/types/FILE.h" 1 3 4
+
+
+
+struct _IO_FILE;
+
+
+typedef struct _IO_FILE FILE;
+# 43 "/usr/include/stdio.h" 2 3 4
+# 1 "/usr/include/x86_64-linux-gnu/bits/types/struct_FILE.h" 1 3 4
+# 35 "/usr/include/x86_64-linux-gnu/bits/types/struct_FILE.h" 3 4
+struct _IO_FILE;
+struct _IO_marker;
+struct _IO_codecvt;
+struct _IO_wide_data;
+
+
+
+
+typedef void _IO_lock_t;
+
+
+
+
+
+struct _IO_FILE
+{
+  int _flags;
+
+
+  char *_IO_read_ptr;
+  char *_IO_read_end;
+  char *_IO_read_base;
+  char *_IO_write_base;
+  char *_IO_write_ptr;
+  char *_IO_write_end;
+  char *_IO_buf_base;
+  char *_IO_buf_end;
+
+
+  char *_IO_save_base;
+  char *_IO_backup_base;
+  char *_IO_save_end;
+
+  struct _IO_marker *_markers;
+
+  struct _IO_FILE *_chain;
+
+  int _fileno;
+  int _flags2;
+  __off_t _old_offset;
+
+
+  unsigned short _cur_column;
+  signed char _vtable_offset;
+  char _shortbuf[1];
+
+  _IO_lock_t *_lock;
+
+
+
+
+
+
+
+  __off64_t _offset;
+
+  struct _IO_codecvt *_codecvt;
+  struct _IO_wide_data *_wide_data;
+  struct _IO_FILE *_freeres_list;
+  void *_freeres_buf;
+  size_t __pad5;
+  int _mode;
+
+  char _unused2[15 * sizeof (int) - 4 * sizeof (void *) - sizeof (size_t)];
+};
+# 44 "/usr/include/stdio.h" 2 3 4
+# 84 "/usr/include/stdio.h" 3 4
+typedef __fpos_t fpos_t;
+# 133 "/usr/include/stdio.h" 3 4
+# 1 "/usr/include/x86_64-linux-gnu/bits/stdio_lim.h" 1 3 4
+# 134 "/usr/include/stdio.h" 2 3 4
+# 143 "/usr/include/stdio.h" 3 4
+extern FILE *stdin;
+extern FILE *stdout;
+extern FILE *stderr;
+
+
+
+
+
+
+extern int remove (const char *__filename) __attribute__ ((__nothrow__ , __leaf__));
+
+extern int rename (const char *__old, const char *__new) __attribute__ ((__nothrow__ , __leaf__));
+# 178 "/usr/include/stdio.h" 3 4
+extern int fclose (FILE *__stream);
+# 188 "/usr/include/stdio.h" 3 4
+extern FILE *tmpfile (void)
+  __attribute__ ((__malloc__)) __attribute__ ((__malloc__ (fclose, 1))) ;
+# 205 "/usr/include/stdio.h" 3 4
+extern char *tmpnam (char[20]) __attribute__ ((__nothrow__ , __leaf__)) ;
+# 230 "/usr/include/stdio.h" 3 4
+extern int fflush (FILE *__stream);
+# 258 "/usr/include/stdio.h" 3 4
+extern FILE *fopen (const char *__restrict __filename,
+      const char *__restrict __modes)
+  __attribute__ ((__malloc__)) __attribute__ ((__malloc__ (fclose, 1))) ;
+
+
+
+
+extern FILE *freopen (const char *__restrict __filename,
+        const char *__restrict __modes,
+        FILE *__restrict __stream) ;
+# 293 "/usr/include/stdio.h" 3 4
+extern FILE *fdopen (int __fd, const char *__modes) __attribute__ ((__nothrow__ , __leaf__))
+  __attribute__ ((__malloc__)) __attribute__ ((__malloc__ (fclose, 1))) ;
+# 328 "/usr/include/stdio.h" 3 4
+extern void setbuf (FILE *__restrict __stream, char *__restrict __buf) __attribute__ ((__nothrow__ , __leaf__));
+
+
+
+extern int setvbuf (FILE *__restrict __stream, char *__restrict __buf,
+      int __modes, size_t __n) __attribute__ ((__nothrow__ , __leaf__));
+# 350 "/usr/include/stdio.h" 3 4
+extern int fprintf (FILE *__restrict __stream,
+      const char *__restrict __format, ...);
+
+
+
+
+extern int printf (const char *__restrict __format, ...);
+
+extern int sprintf (char *__restrict __s,
+      const char *__restrict __format, ...) __attribute__ ((__nothrow__));
+
+
+
+
+
+extern int vfprintf (FILE *__restrict __s, const char *__restrict __format,
+       __gnuc_va_list __arg);
+
+
+
+
+extern int vprintf (const char *__restrict __format, __gnuc_va_list __arg);
+
+extern int vsprintf (char *__restrict __s, const char *__restrict __format,
+       __gnuc_va_list __arg) __attribute__ ((__nothrow__));
+
+
+
+extern int snprintf (char *__restrict __s, size_t __maxlen,
+       const char *__restrict __format, ...)
+     __attribute__ ((__nothrow__)) __attribute__ ((__format__ (__printf__, 3, 4)));
+
+extern int vsnprintf (char *__restrict __s, size_t __maxlen,
+        const char *__restrict __format, __gnuc_va_list __arg)
+     __attribute__ ((__nothrow__)) __attribute__ ((__format__ (__printf__, 3, 0)));
+# 415 "/usr/include/stdio.h" 3 4
+extern int fscanf (FILE *__restrict __stream,
+     const char *__restrict __format, ...) ;
+
+
+
+
+extern int scanf (const char *__restrict __format, ...) ;
+
+extern int sscanf (const char *__restrict __s,
+     const char *__restrict __format, ...) __attribute__ ((__nothrow__ , __leaf__));
+
+
+
+
+
+# 1 "/usr/include/x86_64-linux-gnu/bits/floatn.h" 1 3 4
+# 120 "/usr/include/x86_64-linux-gnu/bits/floatn.h" 3 4
+# 1 "/usr/include/x86_64-linux-gnu/bits/floatn-common.h" 1 3 4
+# 24 "/usr/include/x86_64-linux-gnu/bits/floatn-common.h" 3 4
+# 1 "/usr/include/x86_64-linux-gnu/bits/long-double.h" 1 3 4
+# 25 "/usr/include/x86_64-linux-gnu/bits/floatn-common.h" 2 3 4
+# 121 "/usr/include/x86_64-linux-gnu/bits/floatn.h" 2 3 4
+# 431 "/usr/include/stdio.h" 2 3 4
+
+
+
+extern int fscanf (FILE *__restrict __stream, const char *__restrict __format, ...) __asm__ ("" "__isoc99_fscanf")
+
+                               ;
+extern int scanf (const char *__restrict __format, ...) __asm__ ("" "__isoc99_scanf")
+                              ;
+extern int sscanf (const char *__restrict __s, const char *__restrict __format, ...) __asm__ ("" "__isoc99_sscanf") __attribute__ ((__nothrow__ , __leaf__))
+
+                      ;
+# 459 "/usr/include/stdio.h" 3 4
+extern int vfscanf (FILE *__restrict __s, const char *__restrict __format,
+      __gnuc_va_list __arg)
+     __attribute__ ((__format__ (__scanf__, 2, 0))) ;
+
+
+
+
+
+extern int vscanf (const char *__restrict __format, __gnuc_va_list __arg)
+     __attribute__ ((__format__ (__scanf__, 1, 0))) ;
+
+
+extern int vsscanf (const char *__restrict __s,
+      const char *__restrict __format, __gnuc_va_list __arg)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__format__ (__scanf__, 2, 0)));
+
+
+
+
+
+extern int vfscanf (FILE *__restrict __s, const char *__restrict __format, __gnuc_va_list __arg) __asm__ ("" "__isoc99_vfscanf")
+
+
+
+     __attribute__ ((__format__ (__scanf__, 2, 0))) ;
+extern int vscanf (const char *__restrict __format, __gnuc_va_list __arg) __asm__ ("" "__isoc99_vscanf")
+
+     __attribute__ ((__format__ (__scanf__, 1, 0))) ;
+extern int vsscanf (const char *__restrict __s, const char *__restrict __format, __gnuc_va_list __arg) __asm__ ("" "__isoc99_vsscanf") __attribute__ ((__nothrow__ , __leaf__))
+
+
+
+     __attribute__ ((__format__ (__scanf__, 2, 0)));
+# 513 "/usr/include/stdio.h" 3 4
+extern int fgetc (FILE *__stream);
+extern int getc (FILE *__stream);
+
+
+
+
+
+extern int getchar (void);
+
+
+
+
+
+
+extern int getc_unlocked (FILE *__stream);
+extern int getchar_unlocked (void);
+# 549 "/usr/include/stdio.h" 3 4
+extern int fputc (int __c, FILE *__stream);
+extern int putc (int __c, FILE *__stream);
+
+
+
+
+
+extern int putchar (int __c);
+# 573 "/usr/include/stdio.h" 3 4
+extern int putc_unlocked (int __c, FILE *__stream);
+extern int putchar_unlocked (int __c);
+# 592 "/usr/include/stdio.h" 3 4
+extern char *fgets (char *__restrict __s, int __n, FILE *__restrict __stream)
+     __attribute__ ((__access__ (__write_only__, 1, 2)));
+# 605 "/usr/include/stdio.h" 3 4
+extern char *gets (char *__s) __attribute__ ((__deprecated__));
+# 655 "/usr/include/stdio.h" 3 4
+extern int fputs (const char *__restrict __s, FILE *__restrict __stream);
+
+
+
+
+
+extern int puts (const char *__s);
+
+
+
+
+
+
+extern int ungetc (int __c, FILE *__stream);
+
+
+
+
+
+
+extern size_t fread (void *__restrict __ptr, size_t __size,
+       size_t __n, FILE *__restrict __stream) ;
+
+
+
+
+extern size_t fwrite (const void *__restrict __ptr, size_t __size,
+        size_t __n, FILE *__restrict __s);
+# 713 "/usr/include/stdio.h" 3 4
+extern int fseek (FILE *__stream, long int __off, int __whence);
+
+
+
+
+extern long int ftell (FILE *__stream) ;
+
+
+
+
+extern void rewind (FILE *__stream);
+# 760 "/usr/include/stdio.h" 3 4
+extern int fgetpos (FILE *__restrict __stream, fpos_t *__restrict __pos);
+
+
+
+
+extern int fsetpos (FILE *__stream, const fpos_t *__pos);
+# 786 "/usr/include/stdio.h" 3 4
+extern void clearerr (FILE *__stream) __attribute__ ((__nothrow__ , __leaf__));
+
+extern int feof (FILE *__stream) __attribute__ ((__nothrow__ , __leaf__)) ;
+
+extern int ferror (FILE *__stream) __attribute__ ((__nothrow__ , __leaf__)) ;
+# 804 "/usr/include/stdio.h" 3 4
+extern void perror (const char *__s);
+
+
+
+
+extern int fileno (FILE *__stream) __attribute__ ((__nothrow__ , __leaf__)) ;
+# 823 "/usr/include/stdio.h" 3 4
+extern int pclose (FILE *__stream);
+
+
+
+
+
+extern FILE *popen (const char *__command, const char *__modes)
+  __attribute__ ((__malloc__)) __attribute__ ((__malloc__ (pclose, 1))) ;
+
+
+
+
+
+
+extern char *ctermid (char *__s) __attribute__ ((__nothrow__ , __leaf__))
+  __attribute__ ((__access__ (__write_only__, 1)));
+# 867 "/usr/include/stdio.h" 3 4
+extern void flockfile (FILE *__stream) __attribute__ ((__nothrow__ , __leaf__));
+
+
+
+extern int ftrylockfile (FILE *__stream) __attribute__ ((__nothrow__ , __leaf__)) ;
+
+
+extern void funlockfile (FILE *__stream) __attribute__ ((__nothrow__ , __leaf__));
+# 885 "/usr/include/stdio.h" 3 4
+extern int __uflow (FILE *);
+extern int __overflow (FILE *, int);
+# 902 "/usr/include/stdio.h" 3 4
+# 1 "/usr/include/x86_64-linux-gnu/bits/stdio.h" 1 3 4
+# 38 "/usr/include/x86_64-linux-gnu/bits/stdio.h" 3 4
+extern __inline __attribute__ ((__gnu_inline__)) int
+vprintf (const char *__restrict __fmt, __gnuc_va_list __arg)
+{
+  return vfprintf (stdout, __fmt, __arg);
+}
+
+
+
+extern __inline __attribute__ ((__gnu_inline__)) int
+getchar (void)
+{
+  return getc (stdin);
+}
+# 65 "/usr/include/x86_64-linux-gnu/bits/stdio.h" 3 4
+extern __inline __attribute__ ((__gnu_inline__)) int
+getc_unlocked (FILE *__fp)
+{
+  return (__builtin_expect (((__fp)->_IO_read_ptr >= (__fp)->_IO_read_end), 0) ? __uflow (__fp) : *(unsigned char *) (__fp)->_IO_read_ptr++);
+}
+
+
+extern __inline __attribute__ ((__gnu_inline__)) int
+getchar_unlocked (void)
+{
+  return (__builtin_expect (((stdin)->_IO_read_ptr >= (stdin)->_IO_read_end), 0) ? __uflow (stdin) : *(unsigned char *) (stdin)->_IO_read_ptr++);
+}
+
+
+
+
+extern __inline __attribute__ ((__gnu_inline__)) int
+putchar (int __c)
+{
+  return putc (__c, stdout);
+}
+# 100 "/usr/include/x86_64-linux-gnu/bits/stdio.h" 3 4
+extern __inline __attribute__ ((__gnu_inline__)) int
+putc_unlocked (int __c, FILE *__stream)
+{
+  return (__builtin_expect (((__stream)->_IO_write_ptr >= (__stream)->_IO_write_end), 0) ? __overflow (__stream, (unsigned char) (__c)) : (unsigned char) (*(__stream)->_IO_write_ptr++ = (__c)));
+}
+
+
+extern __inline __attribute__ ((__gnu_inline__)) int
+putchar_unlocked (int __c)
+{
+  return (__builtin_expect (((stdout)->_IO_write_ptr >= (stdout)->_IO_write_end), 0) ? __overflow (stdout, (unsigned char) (__c)) : (unsigned char) (*(stdout)->_IO_write_ptr++ = (__c)));
+}
+# 903 "/usr/include/stdio.h" 2 3 4
+
+
+
+
+
+
+
+# 18 "blake2s.h" 2
+
+
+
+
+
+
+
+
+# 25 "blake2s.h"
+struct blake2s_ctx;
+# 35 "blake2s.h"
+ int blake2s_init_keyed(struct blake2s_ctx *ctx, const void *salt,
+                        const void *key, unsigned key_len, unsigned dig_len);
+
+
+
+ int blake2s_init_salted(struct blake2s_ctx *ctx, const void *salt,
+                         unsigned dig_len);
+void blake2s_init(struct blake2s_ctx *ctx);
+
+
+
+
+
+struct blake2s_param {
+    unsigned digest_len;
+    unsigned key_len;
+    unsigned fanout;
+    unsigned depth;
+    uint32_t leaf_len;
+    uint64_t node_offset;
+    unsigned node_depth;
+    unsigned inner_len;
+    unsigned char salt[8];
+    unsigned char personal[8];
+    int last_node;
+};
+
+
+
+
+
+
+ int blake2s_init_param(struct blake2s_ctx *ctx,
+                        const struct blake2s_param *P, const void *key);
+
+void blake2s_update(struct blake2s_ctx *ctx, const void *src, size_t len);
+void blake2s_final(struct blake2s_ctx *ctx, unsigned char *out);
+
+void blake2s(unsigned char *out, const void *src, size_t len);
+
+
+void blake2s_many(unsigned char *const *outs, const void *const *srcs,
+                  const size_t *lens, size_t n);
+
+
+
+
+
+void blake2s_many_ctx(struct blake2s_ctx *ctx, unsigned char *const *outs,
+                      const void *const *srcs, const size_t *lens, size_t n);
+
+
+
+
+
+
+
+void blake2s_clone(struct blake2s_ctx *dst, const struct blake2s_ctx *src);
+
+
+
+
+void blake2s_many_suffix(const struct blake2s_ctx *prefix,
+                         unsigned char *const *outs, const void *const *srcs,
+                         const size_t *lens, size_t n);
+# 115 "blake2s.h"
+struct blake2s_mgr;
+struct blake2s_mgr_job;
+
+struct blake2s_mgr *blake2s_mgr_new(void);
+void blake2s_mgr_free(struct blake2s_mgr *M);
+struct blake2s_mgr_job *blake2s_mgr_submit(struct blake2s_mgr *M,
+                                           struct blake2s_mgr_job *job);
+struct blake2s_mgr_job *blake2s_mgr_flush(struct blake2s_mgr *M);
+# 134 "blake2s.h"
+struct blake2s_mac_key;
+
+ int blake2s_mac_key_init(struct blake2s_mac_key *K, const void *salt,
+                          const void *key, unsigned key_len, unsigned dig_len);
+void blake2s_mac_init(struct blake2s_ctx *ctx, const struct blake2s_mac_key *K);
+void blake2s_mac_final(struct blake2s_ctx *ctx, const struct blake2s_mac_key *K,
+                       unsigned char *out);
+void blake2s_mac(unsigned char *out, const struct blake2s_mac_key *K,
+                 const void *src, size_t len);
+
+ int blake2s_file(unsigned char *out, FILE *stream);
+# 168 "blake2s.h"
+struct blake2s_io {
+    unsigned engine;
+    unsigned flags;
+    size_t chunk;
+};
+
+
+
+
+
+
+ int blake2s_file_ex(unsigned char *out, FILE *stream,
+                     const struct blake2s_io *io);
+
+
+ int blake2s_file_pipelined(unsigned char *out, FILE *stream);
+ int blake2s_file_async(unsigned char *out, FILE *stream);
+# 198 "blake2s.h"
+ int blake2s_tree(unsigned char *out, const void *src, size_t len,
+                  const struct blake2s_param *P, const void *key);
+
+
+
+
+
+ int blake2s_tree_parallel(unsigned char *out, const void *src, size_t len,
+                           const struct blake2s_param *P, const void *key,
+                           unsigned nthreads);
+
+
+
+
+
+
+
+size_t blake2s_tree_nodes(unsigned char *out, const void *src, size_t len,
+                          const struct blake2s_param *P, const void *key);
+# 229 "blake2s.h"
+ int blake2s_file_tree(unsigned char *out, FILE *stream, unsigned nthreads);
+
+
+
+
+
+
+
+ int blake2s_set_kernel(const char *name);
+const char *blake2s_get_kernel(void);
+# 247 "blake2s.h"
+struct blake2s_ctx {
+    uint32_t H[8];
+    unsigned char buf[64];
+    uint32_t t[2];
+    uint32_t f[2];
+    unsigned buf_len;
+    unsigned digest_len;
+    unsigned last_node;
+} __attribute__((aligned(16)));
+
+struct blake2s_mac_key {
+    uint32_t H[8];
+    unsigned char empty[32];
+    unsigned digest_len;
+};
+
+struct blake2s_mgr_job {
+    struct blake2s_ctx *ctx;
+    const void *src;
+    size_t len;
+    unsigned char *out;
+    void *user;
+    struct blake2s_mgr_job *next;
+};
+# 3 "blake2s-generic.c" 2
+# 1 "blake2s-internal.h" 1
+
+
+
+# 1 "/usr/include/string.h" 1 3 4
+# 26 "/usr/include/string.h" 3 4
+# 1 "/usr/include/x86_64-linux-gnu/bits/libc-header-start.h" 1 3 4
+# 27 "/usr/include/string.h" 2 3 4
+
+
+
+
+
+
+# 1 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stddef.h" 1 3 4
+# 34 "/usr/include/string.h" 2 3 4
+# 43 "/usr/include/string.h" 3 4
+
+# 43 "/usr/include/string.h" 3 4
+extern void *memcpy (void *__restrict __dest, const void *__restrict __src,
+       size_t __n) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1, 2)));
+
+
+extern void *memmove (void *__dest, const void *__src, size_t __n)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1, 2)));
+# 61 "/usr/include/string.h" 3 4
+extern void *memset (void *__s, int __c, size_t __n) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1)));
+
+
+extern int memcmp (const void *__s1, const void *__s2, size_t __n)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__pure__)) __attribute__ ((__nonnull__ (1, 2)));
+# 80 "/usr/include/string.h" 3 4
+extern int __memcmpeq (const void *__s1, const void *__s2, size_t __n)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__pure__)) __attribute__ ((__nonnull__ (1, 2)));
+# 107 "/usr/include/string.h" 3 4
+extern void *memchr (const void *__s, int __c, size_t __n)
+      __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__pure__)) __attribute__ ((__nonnull__ (1)));
+# 141 "/usr/include/string.h" 3 4
+extern char *strcpy (char *__restrict __dest, const char *__restrict __src)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1, 2)));
+
+extern char *strncpy (char *__restrict __dest,
+        const char *__restrict __src, size_t __n)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1, 2)));
+
+
+extern char *strcat (char *__restrict __dest, const char *__restrict __src)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1, 2)));
+
+extern char *strncat (char *__restrict __dest, const char *__restrict __src,
+        size_t __n) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1, 2)));
+
+
+extern int strcmp (const char *__s1, const char *__s2)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__pure__)) __attribute__ ((__nonnull__ (1, 2)));
+
+extern int strncmp (const char *__s1, const char *__s2, size_t __n)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__pure__)) __attribute__ ((__nonnull__ (1, 2)));
+
+
+extern int strcoll (const char *__s1, const char *__s2)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__pure__)) __attribute__ ((__nonnull__ (1, 2)));
+
+extern size_t strxfrm (char *__restrict __dest,
+         const char *__restrict __src, size_t __n)
+    __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (2))) __attribute__ ((__access__ (__write_only__, 1, 3)));
+# 246 "/usr/include/string.h" 3 4
+extern char *strchr (const char *__s, int __c)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__pure__)) __attribute__ ((__nonnull__ (1)));
+# 273 "/usr/include/string.h" 3 4
+extern char *strrchr (const char *__s, int __c)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__pure__)) __attribute__ ((__nonnull__ (1)));
+# 293 "/usr/include/string.h" 3 4
+extern size_t strcspn (const char *__s, const char *__reject)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__pure__)) __attribute__ ((__nonnull__ (1, 2)));
+
+
+extern size_t strspn (const char *__s, const char *__accept)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__pure__)) __attribute__ ((__nonnull__ (1, 2)));
+# 323 "/usr/include/string.h" 3 4
+extern char *strpbrk (const char *__s, const char *__accept)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__pure__)) __attribute__ ((__nonnull__ (1, 2)));
+# 350 "/usr/include/string.h" 3 4
+extern char *strstr (const char *__haystack, const char *__needle)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__pure__)) __attribute__ ((__nonnull__ (1, 2)));
+
+
+
+
+extern char *strtok (char *__restrict __s, const char *__restrict __delim)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (2)));
+
+
+
+extern char *__strtok_r (char *__restrict __s,
+    const char *__restrict __delim,
+    char **__restrict __save_ptr)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (2, 3)));
+
+extern char *strtok_r (char *__restrict __s, const char *__restrict __delim,
+         char **__restrict __save_ptr)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (2, 3)));
+# 407 "/usr/include/string.h" 3 4
+extern size_t strlen (const char *__s)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__pure__)) __attribute__ ((__nonnull__ (1)));
+# 419 "/usr/include/string.h" 3 4
+extern char *strerror (int __errnum) __attribute__ ((__nothrow__ , __leaf__));
+# 539 "/usr/include/string.h" 3 4
+
+# 5 "blake2s-internal.h" 2
+# 1 "/usr/include/x86_64-linux-gnu/sys/types.h" 1 3 4
+# 27 "/usr/include/x86_64-linux-gnu/sys/types.h" 3 4
+
+# 47 "/usr/include/x86_64-linux-gnu/sys/types.h" 3 4
+typedef __ino_t ino_t;
+# 59 "/usr/include/x86_64-linux-gnu/sys/types.h" 3 4
+typedef __dev_t dev_t;
+
+
+
+
+typedef __gid_t gid_t;
+
+
+
+
+typedef __mode_t mode_t;
+
+
+
+
+typedef __nlink_t nlink_t;
+
+
+
+
+typedef __uid_t uid_t;
+
+
+
+
+
+typedef __off_t off_t;
+# 97 "/usr/include/x86_64-linux-gnu/sys/types.h" 3 4
+typedef __pid_t pid_t;
+# 108 "/usr/include/x86_64-linux-gnu/sys/types.h" 3 4
+typedef __ssize_t ssize_t;
+# 128 "/usr/include/x86_64-linux-gnu/sys/types.h" 3 4
+# 1 "/usr/include/x86_64-linux-gnu/bits/types/clockid_t.h" 1 3 4
+
+
+
+
+
+
+typedef __clockid_t clockid_t;
+# 129 "/usr/include/x86_64-linux-gnu/sys/types.h" 2 3 4
+# 1 "/usr/include/x86_64-linux-gnu/bits/types/time_t.h" 1 3 4
+# 10 "/usr/include/x86_64-linux-gnu/bits/types/time_t.h" 3 4
+typedef __time_t time_t;
+# 130 "/usr/include/x86_64-linux-gnu/sys/types.h" 2 3 4
+# 1 "/usr/include/x86_64-linux-gnu/bits/types/timer_t.h" 1 3 4
+
+
+
+
+
+
+typedef __timer_t timer_t;
+# 131 "/usr/include/x86_64-linux-gnu/sys/types.h" 2 3 4
+# 144 "/usr/include/x86_64-linux-gnu/sys/types.h" 3 4
+# 1 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stddef.h" 1 3 4
+# 145 "/usr/include/x86_64-linux-gnu/sys/types.h" 2 3 4
+# 158 "/usr/include/x86_64-linux-gnu/sys/types.h" 3 4
+typedef __uint8_t u_int8_t;
+typedef __uint16_t u_int16_t;
+typedef __uint32_t u_int32_t;
+typedef __uint64_t u_int64_t;
+
+
+typedef int register_t __attribute__ ((__mode__ (__word__)));
+# 192 "/usr/include/x86_64-linux-gnu/sys/types.h" 3 4
+typedef __blkcnt_t blkcnt_t;
+
+
+
+typedef __fsblkcnt_t fsblkcnt_t;
+
+
+
+typedef __fsfilcnt_t fsfilcnt_t;
+# 227 "/usr/include/x86_64-linux-gnu/sys/types.h" 3 4
+# 1 "/usr/include/x86_64-linux-gnu/bits/pthreadtypes.h" 1 3 4
+# 23 "/usr/include/x86_64-linux-gnu/bits/pthreadtypes.h" 3 4
+# 1 "/usr/include/x86_64-linux-gnu/bits/thread-shared-types.h" 1 3 4
+# 44 "/usr/include/x86_64-linux-gnu/bits/thread-shared-types.h" 3 4
+# 1 "/usr/include/x86_64-linux-gnu/bits/pthreadtypes-arch.h" 1 3 4
+# 21 "/usr/include/x86_64-linux-gnu/bits/pthreadtypes-arch.h" 3 4
+# 1 "/usr/include/x86_64-linux-gnu/bits/wordsize.h" 1 3 4
+# 22 "/usr/include/x86_64-linux-gnu/bits/pthreadtypes-arch.h" 2 3 4
+# 45 "/usr/include/x86_64-linux-gnu/bits/thread-shared-types.h" 2 3 4
+
+# 1 "/usr/include/x86_64-linux-gnu/bits/atomic_wide_counter.h" 1 3 4
+# 25 "/usr/include/x86_64-linux-gnu/bits/atomic_wide_counter.h" 3 4
+typedef union
+{
+  __extension__ unsigned long long int __value64;
+  struct
+  {
+    unsigned int __low;
+    unsigned int __high;
+  } __value32;
+} __atomic_wide_counter;
+# 47 "/usr/include/x86_64-linux-gnu/bits/thread-shared-types.h" 2 3 4
+
+
+
+
+typedef struct __pthread_internal_list
+{
+  struct __pthread_internal_list *__prev;
+  struct __pthread_internal_list *__next;
+} __pthread_list_t;
+
+typedef struct __pthread_internal_slist
+{
+  struct __pthread_internal_slist *__next;
+} __pthread_slist_t;
+# 76 "/usr/include/x86_64-linux-gnu/bits/thread-shared-types.h" 3 4
+# 1 "/usr/include/x86_64-linux-gnu/bits/struct_mutex.h" 1 3 4
+# 22 "/usr/include/x86_64-linux-gnu/bits/struct_mutex.h" 3 4
+struct __pthread_mutex_s
+{
+  int __lock;
+  unsigned int __count;
+  int __owner;
+
+  unsigned int __nusers;
+
+
+
+  int __kind;
+
+  short __spins;
+  short __elision;
+  __pthread_list_t __list;
+# 53 "/usr/include/x86_64-linux-gnu/bits/struct_mutex.h" 3 4
+};
+# 77 "/usr/include/x86_64-linux-gnu/bits/thread-shared-types.h" 2 3 4
+# 89 "/usr/include/x86_64-linux-gnu/bits/thread-shared-types.h" 3 4
+# 1 "/usr/include/x86_64-linux-gnu/bits/struct_rwlock.h" 1 3 4
+# 23 "/usr/include/x86_64-linux-gnu/bits/struct_rwlock.h" 3 4
+struct __pthread_rwlock_arch_t
+{
+  unsigned int __readers;
+  unsigned int __writers;
+  unsigned int __wrphase_futex;
+  unsigned int __writers_futex;
+  unsigned int __pad3;
+  unsigned int __pad4;
+
+  int __cur_writer;
+  int __shared;
+  signed char __rwelision;
+
+
+
+
+  unsigned char __pad1[7];
+
+
+  unsigned long int __pad2;
+
+
+  unsigned int __flags;
+# 55 "/usr/include/x86_64-linux-gnu/bits/struct_rwlock.h" 3 4
+};
+# 90 "/usr/include/x86_64-linux-gnu/bits/thread-shared-types.h" 2 3 4
+
+
+
+
+struct __pthread_cond_s
+{
+  __atomic_wide_counter __wseq;
+  __atomic_wide_counter __g1_start;
+  unsigned int __g_refs[2] ;
+  unsigned int __g_size[2];
+  unsigned int __g1_orig_size;
+  unsigned int __wrefs;
+  unsigned int __g_signals[2];
+};
+
+typedef unsigned int __tss_t;
+typedef unsigned long int __thrd_t;
+
+typedef struct
+{
+  int __data ;
+} __once_flag;
+# 24 "/usr/include/x86_64-linux-gnu/bits/pthreadtypes.h" 2 3 4
+
+
+
+typedef unsigned long int pthread_t;
+
+
+
+
+typedef union
+{
+  char __size[4];
+  int __align;
+} pthread_mutexattr_t;
+
+
+
+
+typedef union
+{
+  char __size[4];
+  int __align;
+} pthread_condattr_t;
+
+
+
+typedef unsigned int pthread_key_t;
+
+
+
+typedef int pthread_once_t;
+
+
+union pthread_attr_t
+{
+  char __size[56];
+  long int __align;
+};
+
+typedef union pthread_attr_t pthread_attr_t;
+
+
+
+
+typedef union
+{
+  struct __pthread_mutex_s __data;
+  char __size[40];
+  long int __align;
+} pthread_mutex_t;
+
+
+typedef union
+{
+  struct __pthread_cond_s __data;
+  char __size[48];
+  __extension__ long long int __align;
+} pthread_cond_t;
+# 228 "/usr/include/x86_64-linux-gnu/sys/types.h" 2 3 4
+
+
+
+# 6 "blake2s-internal.h" 2
+
+
+# 7 "blake2s-internal.h"
+typedef uint8_t u8;
+typedef uint32_t u32;
+
+static const u32 blake2s_iv[8] = {
+    0x6a09e667, 0xbb67ae85, 0x3c6ef372, 0xa54ff53a,
+    0x510e527f, 0x9b05688c, 0x1f83d9ab, 0x5be0cd19,
+};
+
+static const u8 blake2s_sigma[10][16] =
+{
+  { 0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15 },
+  { 14, 10, 4, 8, 9, 15, 13, 6, 1, 12, 0, 2, 11, 7, 5, 3 },
+  { 11, 8, 12, 0, 5, 2, 15, 13, 10, 14, 3, 6, 7, 1, 9, 4 },
+  { 7, 9, 3, 1, 13, 12, 11, 14, 2, 6, 5, 10, 4, 0, 15, 8 },
+  { 9, 0, 5, 7, 2, 4, 10, 15, 14, 1, 11, 12, 6, 8, 3, 13 },
+  { 2, 12, 6, 10, 0, 11, 8, 3, 4, 13, 7, 5, 15, 14, 1, 9 },
+  { 12, 5, 1, 15, 14, 13, 4, 10, 0, 7, 6, 3, 9, 2, 8, 11 },
+  { 13, 11, 7, 14, 12, 1, 3, 9, 5, 0, 15, 4, 8, 6, 2, 10 },
+  { 6, 15, 14, 9, 11, 3, 0, 8, 12, 2, 13, 7, 1, 4, 10, 5 },
+  { 10, 2, 8, 4, 7, 6, 1, 5, 15, 11, 9, 14, 3, 12, 13 , 0 },
+};
+# 37 "blake2s-internal.h"
+struct blake2s_lanes {
+    u32 H[8][16];
+    u32 t[2][16];
+    u32 f[2][16];
+} __attribute__((aligned(64)));
+
+
+
+
+
+
+
+struct blake2s_kernel {
+    const char *name;
+    int (*usable)(void);
+    void (*compress)(struct blake2s_ctx *ctx, const void *m);
+    void (*compress_blocks)(struct blake2s_ctx *ctx, const void *m,
+                            size_t nblocks);
+    unsigned lanes;
+    void (*compress_lanes)(struct blake2s_lanes *L, const void *m[],
+                           unsigned mask);
+};
+
+extern const struct blake2s_kernel *blake2s_kern;
+const struct blake2s_kernel *blake2s_kernel_get(unsigned i);
+
+
+void blake2s_compress_generic(struct blake2s_ctx *ctx, const void *m);
+void blake2s_compress_altivec(struct blake2s_ctx *ctx, const void *m);
+void blake2s_compress_vec(struct blake2s_ctx *ctx, const void *m);
+void blake2s_compress_sse(struct blake2s_ctx *ctx, const void *m);
+void blake2s_compress_avx512vl(struct blake2s_ctx *ctx, const void *m);
+void blake2s_compress_blocks_generic(struct blake2s_ctx *ctx, const void *m,
+                                     size_t nblocks);
+void blake2s_compress_blocks_altivec(struct blake2s_ctx *ctx, const void *m,
+                                     size_t nblocks);
+void blake2s_compress_blocks_vec(struct blake2s_ctx *ctx, const void *m,
+                                 size_t nblocks);
+void blake2s_compress_blocks_sse(struct blake2s_ctx *ctx, const void *m,
+                                 size_t nblocks);
+void blake2s_compress_blocks_avx512vl(struct blake2s_ctx *ctx, const void *m,
+                                      size_t nblocks);
+void blake2s_compress_lanes_serial(struct blake2s_lanes *L, const void *m[],
+                                   unsigned mask);
+void blake2s_compress_lanes_avx2(struct blake2s_lanes *L, const void *m[],
+                                 unsigned mask);
+void blake2s_compress_lanes_avx512(struct blake2s_lanes *L, const void *m[],
+                                   unsigned mask);
+
+static inline void blake2s_compress(struct blake2s_ctx *ctx, const void *m)
+{
+    blake2s_kern->compress(ctx, m);
+}
+
+static inline void blake2s_compress_blocks(struct blake2s_ctx *ctx,
+                                           const void *m, size_t nblocks)
+{
+    blake2s_kern->compress_blocks(ctx, m, nblocks);
+}
+
+static inline void blake2s_compress_lanes(struct blake2s_lanes *L,
+                                          const void *m[], unsigned mask)
+{
+    blake2s_kern->compress_lanes(L, m, mask);
+}
+# 119 "blake2s-internal.h"
+void blake2s_init_words(struct blake2s_ctx *ctx, const u32 P[4],
+                        const void *salt, const void *personal,
+                        const void *key, unsigned key_len);
+
+
+
+
+
+
+struct blake2s_job {
+    struct blake2s_ctx *ctx;
+    const u8 *src;
+    size_t len;
+    unsigned char *out;
+};
+
+void blake2s_lanes_run(struct blake2s_job *job, size_t n);
+# 147 "blake2s-internal.h"
+const void *blake2s_lane_next(struct blake2s_lanes *L, unsigned l,
+                              struct blake2s_job *lane, int *last);
+void blake2s_lane_retire(struct blake2s_lanes *L, unsigned l,
+                         struct blake2s_job *lane);
+# 161 "blake2s-internal.h"
+int blake2s_pipe_run(struct blake2s_ctx *ctx, FILE *stream, int fd,
+                     uint64_t off, uint64_t size, size_t chunk, int direct);
+int blake2s_uring_run(struct blake2s_ctx *ctx, int fd, uint64_t off,
+                      uint64_t size, size_t chunk, int direct);
+
+
+
+
+int blake2s_file_finish(struct blake2s_ctx *ctx, FILE *stream, size_t chunk,
+                        unsigned char *out);
+
+
+
+ssize_t blake2s_pread(int fd, void *buf, size_t len, uint64_t off);
+
+
+
+
+void blake2s_pool_run(unsigned nthreads, size_t n,
+                      void (*fn)(void *arg, size_t i), void *arg);
+
+
+static inline void blane_load(struct blake2s_lanes *L, unsigned l,
+                              const struct blake2s_ctx *ctx)
+{
+    for (unsigned i = 0; i < 8; i++)
+        L->H[i][l] = ctx->H[i];
+    L->t[0][l] = ctx->t[0];
+    L->t[1][l] = ctx->t[1];
+    L->f[0][l] = ctx->f[0];
+    L->f[1][l] = ctx->f[1];
+}
+
+static inline void blane_store(const struct blake2s_lanes *L, unsigned l,
+                               struct blake2s_ctx *ctx)
+{
+    for (unsigned i = 0; i < 8; i++)
+        ctx->H[i] = L->H[i][l];
+    ctx->t[0] = L->t[0][l];
+    ctx->t[1] = L->t[1][l];
+    ctx->f[0] = L->f[0][l];
+    ctx->f[1] = L->f[1][l];
+}
+
+static inline void blane_inc_t(struct blake2s_lanes *L, unsigned l, size_t inc)
+{
+    L->t[0][l] += inc;
+    L->t[1][l] += (L->t[0][l] < inc);
+}
+
+
+static inline u32 to_le32(u32 x) {
+    const int _one = 1;
+    if (1 == *(unsigned char *)&_one) return x;
+    return ((x>>24) | (x<<24) | ((x>>8) & 0xff00) | ((x<<8) & 0xff0000));
+}
+static inline u32 read_le32(const unsigned char *x) {
+    u32 w;
+    memcpy(&w, x, sizeof(w));
+    return to_le32(w);
+}
+static inline void write_le32(unsigned char *y, u32 x) {
+    *y++ = x & 0xff;
+    *y++ = (x >> 8) & 0xff;
+    *y++ = (x >> 16) & 0xff;
+    *y++ = (x >> 24) & 0xff;
+}
+
+static inline void butil_copy_words(void *dst, const void *src, unsigned bytes)
+{
+    u32 *udst = dst;
+    const u32 *usrc = src;
+    unsigned i = 0;
+    for (; i < bytes/4; i++)
+        udst[i] = usrc[i];
+}
+# 4 "blake2s-generic.c" 2
+
+static inline u32 ror(unsigned l, u32 x) { return (x >> l) | (x << (32-l)); }
+
+static inline void butil_le32_copy(void *dst, const void *src, unsigned bytes)
+{
+    u32 *udst = (void *)dst;
+    const unsigned char *usrc = src;
+    unsigned i = 0;
+    for (; i < bytes/4; i++)
+        udst[i] = read_le32(usrc + i*4);
+}
+
+
+static inline void blake2s_10rounds(u32 v[16], const u32 m[16])
+{
+# 50 "blake2s-generic.c"
+    do { do { (v[ 0]) += (v[ 4]) + (m[blake2s_sigma[(0)][(0)]]); (v[12]) = ror(16, (v[12]) ^ (v[ 0])); (v[ 8]) += (v[12]); (v[ 4]) = ror(12, (v[ 4]) ^ (v[ 8])); (v[ 0]) += (v[ 4]) + (m[blake2s_sigma[(0)][(1)]]); (v[12]) = ror( 8, (v[12]) ^ (v[ 0])); (v[ 8]) += (v[12]); (v[ 4]) = ror( 7, (v[ 4]) ^ (v[ 8])); } while (0); do { (v[ 1]) += (v[ 5]) + (m[blake2s_sigma[(0)][(2)]]); (v[13]) = ror(16, (v[13]) ^ (v[ 1])); (v[ 9]) += (v[13]); (v[ 5]) = ror(12, (v[ 5]) ^ (v[ 9])); (v[ 1]) += (v[ 5]) + (m[blake2s_sigma[(0)][(3)]]); (v[13]) = ror( 8, (v[13]) ^ (v[ 1])); (v[ 9]) += (v[13]); (v[ 5]) = ror( 7, (v[ 5]) ^ (v[ 9])); } while (0); do { (v[ 2]) += (v[ 6]) + (m[blake2s_sigma[(0)][(4)]]); (v[14]) = ror(16, (v[14]) ^ (v[ 2])); (v[10]) += (v[14]); (v[ 6]) = ror(12, (v[ 6]) ^ (v[10])); (v[ 2]) += (v[ 6]) + (m[blake2s_sigma[(0)][(5)]]); (v[14]) = ror( 8, (v[14]) ^ (v[ 2])); (v[10]) += (v[14]); (v[ 6]) = ror( 7, (v[ 6]) ^ (v[10])); } while (0); do { (v[ 3]) += (v[ 7]) + (m[blake2s_sigma[(0)][(6)]]); (v[15]) = ror(16, (v[15]) ^ (v[ 3])); (v[11]) += (v[15]); (v[ 7]) = ror(12, (v[ 7]) ^ (v[11])); (v[ 3]) += (v[ 7]) + (m[blake2s_sigma[(0)][(7)]]); (v[15]) = ror( 8, (v[15]) ^ (v[ 3])); (v[11]) += (v[15]); (v[ 7]) = ror( 7, (v[ 7]) ^ (v[11])); } while (0); do { (v[ 0]) += (v[ 5]) + (m[blake2s_sigma[(0)][(8)]]); (v[15]) = ror(16, (v[15]) ^ (v[ 0])); (v[10]) += (v[15]); (v[ 5]) = ror(12, (v[ 5]) ^ (v[10])); (v[ 0]) += (v[ 5]) + (m[blake2s_sigma[(0)][(9)]]); (v[15]) = ror( 8, (v[15]) ^ (v[ 0])); (v[10]) += (v[15]); (v[ 5]) = ror( 7, (v[ 5]) ^ (v[10])); } while (0); do { (v[ 1]) += (v[ 6]) + (m[blake2s_sigma[(0)][(10)]]); (v[12]) = ror(16, (v[12]) ^ (v[ 1])); (v[11]) += (v[12]); (v[ 6]) = ror(12, (v[ 6]) ^ (v[11])); (v[ 1]) += (v[ 6]) + (m[blake2s_sigma[(0)][(11)]]); (v[12]) = ror( 8, (v[12]) ^ (v[ 1])); (v[11]) += (v[12]); (v[ 6]) = ror( 7, (v[ 6]) ^ (v[11])); } while (0); do { (v[ 2]) += (v[ 7]) + (m[blake2s_sigma[(0)][(12)]]); (v[13]) = ror(16, (v[13]) ^ (v[ 2])); (v[ 8]) += (v[13]); (v[ 7]) = ror(12, (v[ 7]) ^ (v[ 8])); (v[ 2]) += (v[ 7]) + (m[blake2s_sigma[(0)][(13)]]); (v[13]) = ror( 8, (v[13]) ^ (v[ 2])); (v[ 8]) += (v[13]); (v[ 7]) = ror( 7, (v[ 7]) ^ (v[ 8])); } while (0); do { (v[ 3]) += (v[ 4]) + (m[blake2s_sigma[(0)][(14)]]); (v[14]) = ror(16, (v[14]) ^ (v[ 3])); (v[ 9]) += (v[14]); (v[ 4]) = ror(12, (v[ 4]) ^ (v[ 9])); (v[ 3]) += (v[ 4]) + (m[blake2s_sigma[(0)][(15)]]); (v[14]) = ror( 8, (v[14]) ^ (v[ 3])); (v[ 9]) += (v[14]); (v[ 4]) = ror( 7, (v[ 4]) ^ (v[ 9])); } while (0); } while (0);
+    do { do { (v[ 0]) += (v[ 4]) + (m[blake2s_sigma[(1)][(0)]]); (v[12]) = ror(16, (v[12]) ^ (v[ 0])); (v[ 8]) += (v[12]); (v[ 4]) = ror(12, (v[ 4]) ^ (v[ 8])); (v[ 0]) += (v[ 4]) + (m[blake2s_sigma[(1)][(1)]]); (v[12]) = ror( 8, (v[12]) ^ (v[ 0])); (v[ 8]) += (v[12]); (v[ 4]) = ror( 7, (v[ 4]) ^ (v[ 8])); } while (0); do { (v[ 1]) += (v[ 5]) + (m[blake2s_sigma[(1)][(2)]]); (v[13]) = ror(16, (v[13]) ^ (v[ 1])); (v[ 9]) += (v[13]); (v[ 5]) = ror(12, (v[ 5]) ^ (v[ 9])); (v[ 1]) += (v[ 5]) + (m[blake2s_sigma[(1)][(3)]]); (v[13]) = ror( 8, (v[13]) ^ (v[ 1])); (v[ 9]) += (v[13]); (v[ 5]) = ror( 7, (v[ 5]) ^ (v[ 9])); } while (0); do { (v[ 2]) += (v[ 6]) + (m[blake2s_sigma[(1)][(4)]]); (v[14]) = ror(16, (v[14]) ^ (v[ 2])); (v[10]) += (v[14]); (v[ 6]) = ror(12, (v[ 6]) ^ (v[10])); (v[ 2]) += (v[ 6]) + (m[blake2s_sigma[(1)][(5)]]); (v[14]) = ror( 8, (v[14]) ^ (v[ 2])); (v[10]) += (v[14]); (v[ 6]) = ror( 7, (v[ 6]) ^ (v[10])); } while (0); do { (v[ 3]) += (v[ 7]) + (m[blake2s_sigma[(1)][(6)]]); (v[15]) = ror(16, (v[15]) ^ (v[ 3])); (v[11]) += (v[15]); (v[ 7]) = ror(12, (v[ 7]) ^ (v[11])); (v[ 3]) += (v[ 7]) + (m[blake2s_sigma[(1)][(7)]]); (v[15]) = ror( 8, (v[15]) ^ (v[ 3])); (v[11]) += (v[15]); (v[ 7]) = ror( 7, (v[ 7]) ^ (v[11])); } while (0); do { (v[ 0]) += (v[ 5]) + (m[blake2s_sigma[(1)][(8)]]); (v[15]) = ror(16, (v[15]) ^ (v[ 0])); (v[10]) += (v[15]); (v[ 5]) = ror(12, (v[ 5]) ^ (v[10])); (v[ 0]) += (v[ 5]) + (m[blake2s_sigma[(1)][(9)]]); (v[15]) = ror( 8, (v[15]) ^ (v[ 0])); (v[10]) += (v[15]); (v[ 5]) = ror( 7, (v[ 5]) ^ (v[10])); } while (0); do { (v[ 1]) += (v[ 6]) + (m[blake2s_sigma[(1)][(10)]]); (v[12]) = ror(16, (v[12]) ^ (v[ 1])); (v[11]) += (v[12]); (v[ 6]) = ror(12, (v[ 6]) ^ (v[11])); (v[ 1]) += (v[ 6]) + (m[blake2s_sigma[(1)][(11)]]); (v[12]) = ror( 8, (v[12]) ^ (v[ 1])); (v[11]) += (v[12]); (v[ 6]) = ror( 7, (v[ 6]) ^ (v[11])); } while (0); do { (v[ 2]) += (v[ 7]) + (m[blake2s_sigma[(1)][(12)]]); (v[13]) = ror(16, (v[13]) ^ (v[ 2])); (v[ 8]) += (v[13]); (v[ 7]) = ror(12, (v[ 7]) ^ (v[ 8])); (v[ 2]) += (v[ 7]) + (m[blake2s_sigma[(1)][(13)]]); (v[13]) = ror( 8, (v[13]) ^ (v[ 2])); (v[ 8]) += (v[13]); (v[ 7]) = ror( 7, (v[ 7]) ^ (v[ 8])); } while (0); do { (v[ 3]) += (v[ 4]) + (m[blake2s_sigma[(1)][(14)]]); (v[14]) = ror(16, (v[14]) ^ (v[ 3])); (v[ 9]) += (v[14]); (v[ 4]) = ror(12, (v[ 4]) ^ (v[ 9])); (v[ 3]) += (v[ 4]) + (m[blake2s_sigma[(1)][(15)]]); (v[14]) = ror( 8, (v[14]) ^ (v[ 3])); (v[ 9]) += (v[14]); (v[ 4]) = ror( 7, (v[ 4]) ^ (v[ 9])); } while (0); } while (0);
+    do { do { (v[ 0]) += (v[ 4]) + (m[blake2s_sigma[(2)][(0)]]); (v[12]) = ror(16, (v[12]) ^ (v[ 0])); (v[ 8]) += (v[12]); (v[ 4]) = ror(12, (v[ 4]) ^ (v[ 8])); (v[ 0]) += (v[ 4]) + (m[blake2s_sigma[(2)][(1)]]); (v[12]) = ror( 8, (v[12]) ^ (v[ 0])); (v[ 8]) += (v[12]); (v[ 4]) = ror( 7, (v[ 4]) ^ (v[ 8])); } while (0); do { (v[ 1]) += (v[ 5]) + (m[blake2s_sigma[(2)][(2)]]); (v[13]) = ror(16, (v[13]) ^ (v[ 1])); (v[ 9]) += (v[13]); (v[ 5]) = ror(12, (v[ 5]) ^ (v[ 9])); (v[ 1]) += (v[ 5]) + (m[blake2s_sigma[(2)][(3)]]); (v[13]) = ror( 8, (v[13]) ^ (v[ 1])); (v[ 9]) += (v[13]); (v[ 5]) = ror( 7, (v[ 5]) ^ (v[ 9])); } while (0); do { (v[ 2]) += (v[ 6]) + (m[blake2s_sigma[(2)][(4)]]); (v[14]) = ror(16, (v[14]) ^ (v[ 2])); (v[10]) += (v[14]); (v[ 6]) = ror(12, (v[ 6]) ^ (v[10])); (v[ 2]) += (v[ 6]) + (m[blake2s_sigma[(2)][(5)]]); (v[14]) = ror( 8, (v[14]) ^ (v[ 2])); (v[10]) += (v[14]); (v[ 6]) = ror( 7, (v[ 6]) ^ (v[10])); } while (0); do { (v[ 3]) += (v[ 7]) + (m[blake2s_sigma[(2)][(6)]]); (v[15]) = ror(16, (v[15]) ^ (v[ 3])); (v[11]) += (v[15]); (v[ 7]) = ror(12, (v[ 7]) ^ (v[11])); (v[ 3]) += (v[ 7]) + (m[blake2s_sigma[(2)][(7)]]); (v[15]) = ror( 8, (v[15]) ^ (v[ 3])); (v[11]) += (v[15]); (v[ 7]) = ror( 7, (v[ 7]) ^ (v[11])); } while (0); do { (v[ 0]) += (v[ 5]) + (m[blake2s_sigma[(2)][(8)]]); (v[15]) = ror(16, (v[15]) ^ (v[ 0])); (v[10]) += (v[15]); (v[ 5]) = ror(12, (v[ 5]) ^ (v[10])); (v[ 0]) += (v[ 5]) + (m[blake2s_sigma[(2)][(9)]]); (v[15]) = ror( 8, (v[15]) ^ (v[ 0])); (v[10]) += (v[15]); (v[ 5]) = ror( 7, (v[ 5]) ^ (v[10])); } while (0); do { (v[ 1]) += (v[ 6]) + (m[blake2s_sigma[(2)][(10)]]); (v[12]) = ror(16, (v[12]) ^ (v[ 1])); (v[11]) += (v[12]); (v[ 6]) = ror(12, (v[ 6]) ^ (v[11])); (v[ 1]) += (v[ 6]) + (m[blake2s_sigma[(2)][(11)]]); (v[12]) = ror( 8, (v[12]) ^ (v[ 1])); (v[11]) += (v[12]); (v[ 6]) = ror( 7, (v[ 6]) ^ (v[11])); } while (0); do { (v[ 2]) += (v[ 7]) + (m[blake2s_sigma[(2)][(12)]]); (v[13]) = ror(16, (v[13]) ^ (v[ 2])); (v[ 8]) += (v[13]); (v[ 7]) = ror(12, (v[ 7]) ^ (v[ 8])); (v[ 2]) += (v[ 7]) + (m[blake2s_sigma[(2)][(13)]]); (v[13]) = ror( 8, (v[13]) ^ (v[ 2])); (v[ 8]) += (v[13]); (v[ 7]) = ror( 7, (v[ 7]) ^ (v[ 8])); } while (0); do { (v[ 3]) += (v[ 4]) + (m[blake2s_sigma[(2)][(14)]]); (v[14]) = ror(16, (v[14]) ^ (v[ 3])); (v[ 9]) += (v[14]); (v[ 4]) = ror(12, (v[ 4]) ^ (v[ 9])); (v[ 3]) += (v[ 4]) + (m[blake2s_sigma[(2)][(15)]]); (v[14]) = ror( 8, (v[14]) ^ (v[ 3])); (v[ 9]) += (v[14]); (v[ 4]) = ror( 7, (v[ 4]) ^ (v[ 9])); } while (0); } while (0);
+    do { do { (v[ 0]) += (v[ 4]) + (m[blake2s_sigma[(3)][(0)]]); (v[12]) = ror(16, (v[12]) ^ (v[ 0])); (v[ 8]) += (v[12]); (v[ 4]) = ror(12, (v[ 4]) ^ (v[ 8])); (v[ 0]) += (v[ 4]) + (m[blake2s_sigma[(3)][(1)]]); (v[12]) = ror( 8, (v[12]) ^ (v[ 0])); (v[ 8]) += (v[12]); (v[ 4]) = ror( 7, (v[ 4]) ^ (v[ 8])); } while (0); do { (v[ 1]) += (v[ 5]) + (m[blake2s_sigma[(3)][(2)]]); (v[13]) = ror(16, (v[13]) ^ (v[ 1])); (v[ 9]) += (v[13]); (v[ 5]) = ror(12, (v[ 5]) ^ (v[ 9])); (v[ 1]) += (v[ 5]) + (m[blake2s_sigma[(3)][(3)]]); (v[13]) = ror( 8, (v[13]) ^ (v[ 1])); (v[ 9]) += (v[13]); (v[ 5]) = ror( 7, (v[ 5]) ^ (v[ 9])); } while (0); do { (v[ 2]) += (v[ 6]) + (m[blake2s_sigma[(3)][(4)]]); (v[14]) = ror(16, (v[14]) ^ (v[ 2])); (v[10]) += (v[14]); (v[ 6]) = ror(12, (v[ 6]) ^ (v[10])); (v[ 2]) += (v[ 6]) + (m[blake2s_sigma[(3)][(5)]]); (v[14]) = ror( 8, (v[14]) ^ (v[ 2])); (v[10]) += (v[14]); (v[ 6]) = ror( 7, (v[ 6]) ^ (v[10])); } while (0); do { (v[ 3]) += (v[ 7]) + (m[blake2s_sigma[(3)][(6)]]); (v[15]) = ror(16, (v[15]) ^ (v[ 3])); (v[11]) += (v[15]); (v[ 7]) = ror(12, (v[ 7]) ^ (v[11])); (v[ 3]) += (v[ 7]) + (m[blake2s_sigma[(3)][(7)]]); (v[15]) = ror( 8, (v[15]) ^ (v[ 3])); (v[11]) += (v[15]); (v[ 7]) = ror( 7, (v[ 7]) ^ (v[11])); } while (0); do { (v[ 0]) += (v[ 5]) + (m[blake2s_sigma[(3)][(8)]]); (v[15]) = ror(16, (v[15]) ^ (v[ 0])); (v[10]) += (v[15]); (v[ 5]) = ror(12, (v[ 5]) ^ (v[10])); (v[ 0]) += (v[ 5]) + (m[blake2s_sigma[(3)][(9)]]); (v[15]) = ror( 8, (v[15]) ^ (v[ 0])); (v[10]) += (v[15]); (v[ 5]) = ror( 7, (v[ 5]) ^ (v[10])); } while (0); do { (v[ 1]) += (v[ 6]) + (m[blake2s_sigma[(3)][(10)]]); (v[12]) = ror(16, (v[12]) ^ (v[ 1])); (v[11]) += (v[12]); (v[ 6]) = ror(12, (v[ 6]) ^ (v[11])); (v[ 1]) += (v[ 6]) + (m[blake2s_sigma[(3)][(11)]]); (v[12]) = ror( 8, (v[12]) ^ (v[ 1])); (v[11]) += (v[12]); (v[ 6]) = ror( 7, (v[ 6]) ^ (v[11])); } while (0); do { (v[ 2]) += (v[ 7]) + (m[blake2s_sigma[(3)][(12)]]); (v[13]) = ror(16, (v[13]) ^ (v[ 2])); (v[ 8]) += (v[13]); (v[ 7]) = ror(12, (v[ 7]) ^ (v[ 8])); (v[ 2]) += (v[ 7]) + (m[blake2s_sigma[(3)][(13)]]); (v[13]) = ror( 8, (v[13]) ^ (v[ 2])); (v[ 8]) += (v[13]); (v[ 7]) = ror( 7, (v[ 7]) ^ (v[ 8])); } while (0); do { (v[ 3]) += (v[ 4]) + (m[blake2s_sigma[(3)][(14)]]); (v[14]) = ror(16, (v[14]) ^ (v[ 3])); (v[ 9]) += (v[14]); (v[ 4]) = ror(12, (v[ 4]) ^ (v[ 9])); (v[ 3]) += (v[ 4]) + (m[blake2s_sigma[(3)][(15)]]); (v[14]) = ror( 8, (v[14]) ^ (v[ 3])); (v[ 9]) += (v[14]); (v[ 4]) = ror( 7, (v[ 4]) ^ (v[ 9])); } while (0); } while (0);
+    do { do { (v[ 0]) += (v[ 4]) + (m[blake2s_sigma[(4)][(0)]]); (v[12]) = ror(16, (v[12]) ^ (v[ 0])); (v[ 8]) += (v[12]); (v[ 4]) = ror(12, (v[ 4]) ^ (v[ 8])); (v[ 0]) += (v[ 4]) + (m[blake2s_sigma[(4)][(1)]]); (v[12]) = ror( 8, (v[12]) ^ (v[ 0])); (v[ 8]) += (v[12]); (v[ 4]) = ror( 7, (v[ 4]) ^ (v[ 8])); } while (0); do { (v[ 1]) += (v[ 5]) + (m[blake2s_sigma[(4)][(2)]]); (v[13]) = ror(16, (v[13]) ^ (v[ 1])); (v[ 9]) += (v[13]); (v[ 5]) = ror(12, (v[ 5]) ^ (v[ 9])); (v[ 1]) += (v[ 5]) + (m[blake2s_sigma[(4)][(3)]]); (v[13]) = ror( 8, (v[13]) ^ (v[ 1])); (v[ 9]) += (v[13]); (v[ 5]) = ror( 7, (v[ 5]) ^ (v[ 9])); } while (0); do { (v[ 2]) += (v[ 6]) + (m[blake2s_sigma[(4)][(4)]]); (v[14]) = ror(16, (v[14]) ^ (v[ 2])); (v[10]) += (v[14]); (v[ 6]) = ror(12, (v[ 6]) ^ (v[10])); (v[ 2]) += (v[ 6]) + (m[blake2s_sigma[(4)][(5)]]); (v[14]) = ror( 8, (v[14]) ^ (v[ 2])); (v[10]) += (v[14]); (v[ 6]) = ror( 7, (v[ 6]) ^ (v[10])); } while (0); do { (v[ 3]) += (v[ 7]) + (m[blake2s_sigma[(4)][(6)]]); (v[15]) = ror(16, (v[15]) ^ (v[ 3])); (v[11]) += (v[15]); (v[ 7]) = ror(12, (v[ 7]) ^ (v[11])); (v[ 3]) += (v[ 7]) + (m[blake2s_sigma[(4)][(7)]]); (v[15]) = ror( 8, (v[15]) ^ (v[ 3])); (v[11]) += (v[15]); (v[ 7]) = ror( 7, (v[ 7]) ^ (v[11])); } while (0); do { (v[ 0]) += (v[ 5]) + (m[blake2s_sigma[(4)][(8)]]); (v[15]) = ror(16, (v[15]) ^ (v[ 0])); (v[10]) += (v[15]); (v[ 5]) = ror(12, (v[ 5]) ^ (v[10])); (v[ 0]) += (v[ 5]) + (m[blake2s_sigma[(4)][(9)]]); (v[15]) = ror( 8, (v[15]) ^ (v[ 0])); (v[10]) += (v[15]); (v[ 5]) = ror( 7, (v[ 5]) ^ (v[10])); } while (0); do { (v[ 1]) += (v[ 6]) + (m[blake2s_sigma[(4)][(10)]]); (v[12]) = ror(16, (v[12]) ^ (v[ 1])); (v[11]) += (v[12]); (v[ 6]) = ror(12, (v[ 6]) ^ (v[11])); (v[ 1]) += (v[ 6]) + (m[blake2s_sigma[(4)][(11)]]); (v[12]) = ror( 8, (v[12]) ^ (v[ 1])); (v[11]) += (v[12]); (v[ 6]) = ror( 7, (v[ 6]) ^ (v[11])); } while (0); do { (v[ 2]) += (v[ 7]) + (m[blake2s_sigma[(4)][(12)]]); (v[13]) = ror(16, (v[13]) ^ (v[ 2])); (v[ 8]) += (v[13]); (v[ 7]) = ror(12, (v[ 7]) ^ (v[ 8])); (v[ 2]) += (v[ 7]) + (m[blake2s_sigma[(4)][(13)]]); (v[13]) = ror( 8, (v[13]) ^ (v[ 2])); (v[ 8]) += (v[13]); (v[ 7]) = ror( 7, (v[ 7]) ^ (v[ 8])); } while (0); do { (v[ 3]) += (v[ 4]) + (m[blake2s_sigma[(4)][(14)]]); (v[14]) = ror(16, (v[14]) ^ (v[ 3])); (v[ 9]) += (v[14]); (v[ 4]) = ror(12, (v[ 4]) ^ (v[ 9])); (v[ 3]) += (v[ 4]) + (m[blake2s_sigma[(4)][(15)]]); (v[14]) = ror( 8, (v[14]) ^ (v[ 3])); (v[ 9]) += (v[14]); (v[ 4]) = ror( 7, (v[ 4]) ^ (v[ 9])); } while (0); } while (0);
+    do { do { (v[ 0]) += (v[ 4]) + (m[blake2s_sigma[(5)][(0)]]); (v[12]) = ror(16, (v[12]) ^ (v[ 0])); (v[ 8]) += (v[12]); (v[ 4]) = ror(12, (v[ 4]) ^ (v[ 8])); (v[ 0]) += (v[ 4]) + (m[blake2s_sigma[(5)][(1)]]); (v[12]) = ror( 8, (v[12]) ^ (v[ 0])); (v[ 8]) += (v[12]); (v[ 4]) = ror( 7, (v[ 4]) ^ (v[ 8])); } while (0); do { (v[ 1]) += (v[ 5]) + (m[blake2s_sigma[(5)][(2)]]); (v[13]) = ror(16, (v[13]) ^ (v[ 1])); (v[ 9]) += (v[13]); (v[ 5]) = ror(12, (v[ 5]) ^ (v[ 9])); (v[ 1]) += (v[ 5]) + (m[blake2s_sigma[(5)][(3)]]); (v[13]) = ror( 8, (v[13]) ^ (v[ 1])); (v[ 9]) += (v[13]); (v[ 5]) = ror( 7, (v[ 5]) ^ (v[ 9])); } while (0); do { (v[ 2]) += (v[ 6]) + (m[blake2s_sigma[(5)][(4)]]); (v[14]) = ror(16, (v[14]) ^ (v[ 2])); (v[10]) += (v[14]); (v[ 6]) = ror(12, (v[ 6]) ^ (v[10])); (v[ 2]) += (v[ 6]) + (m[blake2s_sigma[(5)][(5)]]); (v[14]) = ror( 8, (v[14]) ^ (v[ 2])); (v[10]) += (v[14]); (v[ 6]) = ror( 7, (v[ 6]) ^ (v[10])); } while (0); do { (v[ 3]) += (v[ 7]) + (m[blake2s_sigma[(5)][(6)]]); (v[15]) = ror(16, (v[15]) ^ (v[ 3])); (v[11]) += (v[15]); (v[ 7]) = ror(12, (v[ 7]) ^ (v[11])); (v[ 3]) += (v[ 7]) + (m[blake2s_sigma[(5)][(7)]]); (v[15]) = ror( 8, (v[15]) ^ (v[ 3])); (v[11]) += (v[15]); (v[ 7]) = ror( 7, (v[ 7]) ^ (v[11])); } while (0); do { (v[ 0]) += (v[ 5]) + (m[blake2s_sigma[(5)][(8)]]); (v[15]) = ror(16, (v[15]) ^ (v[ 0])); (v[10]) += (v[15]); (v[ 5]) = ror(12, (v[ 5]) ^ (v[10])); (v[ 0]) += (v[ 5]) + (m[blake2s_sigma[(5)][(9)]]); (v[15]) = ror( 8, (v[15]) ^ (v[ 0])); (v[10]) += (v[15]); (v[ 5]) = ror( 7, (v[ 5]) ^ (v[10])); } while (0); do { (v[ 1]) += (v[ 6]) + (m[blake2s_sigma[(5)][(10)]]); (v[12]) = ror(16, (v[12]) ^ (v[ 1])); (v[11]) += (v[12]); (v[ 6]) = ror(12, (v[ 6]) ^ (v[11])); (v[ 1]) += (v[ 6]) + (m[blake2s_sigma[(5)][(11)]]); (v[12]) = ror( 8, (v[12]) ^ (v[ 1])); (v[11]) += (v[12]); (v[ 6]) = ror( 7, (v[ 6]) ^ (v[11])); } while (0); do { (v[ 2]) += (v[ 7]) + (m[blake2s_sigma[(5)][(12)]]); (v[13]) = ror(16, (v[13]) ^ (v[ 2])); (v[ 8]) += (v[13]); (v[ 7]) = ror(12, (v[ 7]) ^ (v[ 8])); (v[ 2]) += (v[ 7]) + (m[blake2s_sigma[(5)][(13)]]); (v[13]) = ror( 8, (v[13]) ^ (v[ 2])); (v[ 8]) += (v[13]); (v[ 7]) = ror( 7, (v[ 7]) ^ (v[ 8])); } while (0); do { (v[ 3]) += (v[ 4]) + (m[blake2s_sigma[(5)][(14)]]); (v[14]) = ror(16, (v[14]) ^ (v[ 3])); (v[ 9]) += (v[14]); (v[ 4]) = ror(12, (v[ 4]) ^ (v[ 9])); (v[ 3]) += (v[ 4]) + (m[blake2s_sigma[(5)][(15)]]); (v[14]) = ror( 8, (v[14]) ^ (v[ 3])); (v[ 9]) += (v[14]); (v[ 4]) = ror( 7, (v[ 4]) ^ (v[ 9])); } while (0); } while (0);
+    do { do { (v[ 0]) += (v[ 4]) + (m[blake2s_sigma[(6)][(0)]]); (v[12]) = ror(16, (v[12]) ^ (v[ 0])); (v[ 8]) += (v[12]); (v[ 4]) = ror(12, (v[ 4]) ^ (v[ 8])); (v[ 0]) += (v[ 4]) + (m[blake2s_sigma[(6)][(1)]]); (v[12]) = ror( 8, (v[12]) ^ (v[ 0])); (v[ 8]) += (v[12]); (v[ 4]) = ror( 7, (v[ 4]) ^ (v[ 8])); } while (0); do { (v[ 1]) += (v[ 5]) + (m[blake2s_sigma[(6)][(2)]]); (v[13]) = ror(16, (v[13]) ^ (v[ 1])); (v[ 9]) += (v[13]); (v[ 5]) = ror(12, (v[ 5]) ^ (v[ 9])); (v[ 1]) += (v[ 5]) + (m[blake2s_sigma[(6)][(3)]]); (v[13]) = ror( 8, (v[13]) ^ (v[ 1])); (v[ 9]) += (v[13]); (v[ 5]) = ror( 7, (v[ 5]) ^ (v[ 9])); } while (0); do { (v[ 2]) += (v[ 6]) + (m[blake2s_sigma[(6)][(4)]]); (v[14]) = ror(16, (v[14]) ^ (v[ 2])); (v[10]) += (v[14]); (v[ 6]) = ror(12, (v[ 6]) ^ (v[10])); (v[ 2]) += (v[ 6]) + (m[blake2s_sigma[(6)][(5)]]); (v[14]) = ror( 8, (v[14]) ^ (v[ 2])); (v[10]) += (v[14]); (v[ 6]) = ror( 7, (v[ 6]) ^ (v[10])); } while (0); do { (v[ 3]) += (v[ 7]) + (m[blake2s_sigma[(6)][(6)]]); (v[15]) = ror(16, (v[15]) ^ (v[ 3])); (v[11]) += (v[15]); (v[ 7]) = ror(12, (v[ 7]) ^ (v[11])); (v[ 3]) += (v[ 7]) + (m[blake2s_sigma[(6)][(7)]]); (v[15]) = ror( 8, (v[15]) ^ (v[ 3])); (v[11]) += (v[15]); (v[ 7]) = ror( 7, (v[ 7]) ^ (v[11])); } while (0); do { (v[ 0]) += (v[ 5]) + (m[blake2s_sigma[(6)][(8)]]); (v[15]) = ror(16, (v[15]) ^ (v[ 0])); (v[10]) += (v[15]); (v[ 5]) = ror(12, (v[ 5]) ^ (v[10])); (v[ 0]) += (v[ 5]) + (m[blake2s_sigma[(6)][(9)]]); (v[15]) = ror( 8, (v[15]) ^ (v[ 0])); (v[10]) += (v[15]); (v[ 5]) = ror( 7, (v[ 5]) ^ (v[10])); } while (0); do { (v[ 1]) += (v[ 6]) + (m[blake2s_sigma[(6)][(10)]]); (v[12]) = ror(16, (v[12]) ^ (v[ 1])); (v[11]) += (v[12]); (v[ 6]) = ror(12, (v[ 6]) ^ (v[11])); (v[ 1]) += (v[ 6]) + (m[blake2s_sigma[(6)][(11)]]); (v[12]) = ror( 8, (v[12]) ^ (v[ 1])); (v[11]) += (v[12]); (v[ 6]) = ror( 7, (v[ 6]) ^ (v[11])); } while (0); do { (v[ 2]) += (v[ 7]) + (m[blake2s_sigma[(6)][(12)]]); (v[13]) = ror(16, (v[13]) ^ (v[ 2])); (v[ 8]) += (v[13]); (v[ 7]) = ror(12, (v[ 7]) ^ (v[ 8])); (v[ 2]) += (v[ 7]) + (m[blake2s_sigma[(6)][(13)]]); (v[13]) = ror( 8, (v[13]) ^ (v[ 2])); (v[ 8]) += (v[13]); (v[ 7]) = ror( 7, (v[ 7]) ^ (v[ 8])); } while (0); do { (v[ 3]) += (v[ 4]) + (m[blake2s_sigma[(6)][(14)]]); (v[14]) = ror(16, (v[14]) ^ (v[ 3])); (v[ 9]) += (v[14]); (v[ 4]) = ror(12, (v[ 4]) ^ (v[ 9])); (v[ 3]) += (v[ 4]) + (m[blake2s_sigma[(6)][(15)]]); (v[14]) = ror( 8, (v[14]) ^ (v[ 3])); (v[ 9]) += (v[14]); (v[ 4]) = ror( 7, (v[ 4]) ^ (v[ 9])); } while (0); } while (0);
+    do { do { (v[ 0]) += (v[ 4]) + (m[blake2s_sigma[(7)][(0)]]); (v[12]) = ror(16, (v[12]) ^ (v[ 0])); (v[ 8]) += (v[12]); (v[ 4]) = ror(12, (v[ 4]) ^ (v[ 8])); (v[ 0]) += (v[ 4]) + (m[blake2s_sigma[(7)][(1)]]); (v[12]) = ror( 8, (v[12]) ^ (v[ 0])); (v[ 8]) += (v[12]); (v[ 4]) = ror( 7, (v[ 4]) ^ (v[ 8])); } while (0); do { (v[ 1]) += (v[ 5]) + (m[blake2s_sigma[(7)][(2)]]); (v[13]) = ror(16, (v[13]) ^ (v[ 1])); (v[ 9]) += (v[13]); (v[ 5]) = ror(12, (v[ 5]) ^ (v[ 9])); (v[ 1]) += (v[ 5]) + (m[blake2s_sigma[(7)][(3)]]); (v[13]) = ror( 8, (v[13]) ^ (v[ 1])); (v[ 9]) += (v[13]); (v[ 5]) = ror( 7, (v[ 5]) ^ (v[ 9])); } while (0); do { (v[ 2]) += (v[ 6]) + (m[blake2s_sigma[(7)][(4)]]); (v[14]) = ror(16, (v[14]) ^ (v[ 2])); (v[10]) += (v[14]); (v[ 6]) = ror(12, (v[ 6]) ^ (v[10])); (v[ 2]) += (v[ 6]) + (m[blake2s_sigma[(7)][(5)]]); (v[14]) = ror( 8, (v[14]) ^ (v[ 2])); (v[10]) += (v[14]); (v[ 6]) = ror( 7, (v[ 6]) ^ (v[10])); } while (0); do { (v[ 3]) += (v[ 7]) + (m[blake2s_sigma[(7)][(6)]]); (v[15]) = ror(16, (v[15]) ^ (v[ 3])); (v[11]) += (v[15]); (v[ 7]) = ror(12, (v[ 7]) ^ (v[11])); (v[ 3]) += (v[ 7]) + (m[blake2s_sigma[(7)][(7)]]); (v[15]) = ror( 8, (v[15]) ^ (v[ 3])); (v[11]) += (v[15]); (v[ 7]) = ror( 7, (v[ 7]) ^ (v[11])); } while (0); do { (v[ 0]) += (v[ 5]) + (m[blake2s_sigma[(7)][(8)]]); (v[15]) = ror(16, (v[15]) ^ (v[ 0])); (v[10]) += (v[15]); (v[ 5]) = ror(12, (v[ 5]) ^ (v[10])); (v[ 0]) += (v[ 5]) + (m[blake2s_sigma[(7)][(9)]]); (v[15]) = ror( 8, (v[15]) ^ (v[ 0])); (v[10]) += (v[15]); (v[ 5]) = ror( 7, (v[ 5]) ^ (v[10])); } while (0); do { (v[ 1]) += (v[ 6]) + (m[blake2s_sigma[(7)][(10)]]); (v[12]) = ror(16, (v[12]) ^ (v[ 1])); (v[11]) += (v[12]); (v[ 6]) = ror(12, (v[ 6]) ^ (v[11])); (v[ 1]) += (v[ 6]) + (m[blake2s_sigma[(7)][(11)]]); (v[12]) = ror( 8, (v[12]) ^ (v[ 1])); (v[11]) += (v[12]); (v[ 6]) = ror( 7, (v[ 6]) ^ (v[11])); } while (0); do { (v[ 2]) += (v[ 7]) + (m[blake2s_sigma[(7)][(12)]]); (v[13]) = ror(16, (v[13]) ^ (v[ 2])); (v[ 8]) += (v[13]); (v[ 7]) = ror(12, (v[ 7]) ^ (v[ 8])); (v[ 2]) += (v[ 7]) + (m[blake2s_sigma[(7)][(13)]]); (v[13]) = ror( 8, (v[13]) ^ (v[ 2])); (v[ 8]) += (v[13]); (v[ 7]) = ror( 7, (v[ 7]) ^ (v[ 8])); } while (0); do { (v[ 3]) += (v[ 4]) + (m[blake2s_sigma[(7)][(14)]]); (v[14]) = ror(16, (v[14]) ^ (v[ 3])); (v[ 9]) += (v[14]); (v[ 4]) = ror(12, (v[ 4]) ^ (v[ 9])); (v[ 3]) += (v[ 4]) + (m[blake2s_sigma[(7)][(15)]]); (v[14]) = ror( 8, (v[14]) ^ (v[ 3])); (v[ 9]) += (v[14]); (v[ 4]) = ror( 7, (v[ 4]) ^ (v[ 9])); } while (0); } while (0);
+    do { do { (v[ 0]) += (v[ 4]) + (m[blake2s_sigma[(8)][(0)]]); (v[12]) = ror(16, (v[12]) ^ (v[ 0])); (v[ 8]) += (v[12]); (v[ 4]) = ror(12, (v[ 4]) ^ (v[ 8])); (v[ 0]) += (v[ 4]) + (m[blake2s_sigma[(8)][(1)]]); (v[12]) = ror( 8, (v[12]) ^ (v[ 0])); (v[ 8]) += (v[12]); (v[ 4]) = ror( 7, (v[ 4]) ^ (v[ 8])); } while (0); do { (v[ 1]) += (v[ 5]) + (m[blake2s_sigma[(8)][(2)]]); (v[13]) = ror(16, (v[13]) ^ (v[ 1])); (v[ 9]) += (v[13]); (v[ 5]) = ror(12, (v[ 5]) ^ (v[ 9])); (v[ 1]) += (v[ 5]) + (m[blake2s_sigma[(8)][(3)]]); (v[13]) = ror( 8, (v[13]) ^ (v[ 1])); (v[ 9]) += (v[13]); (v[ 5]) = ror( 7, (v[ 5]) ^ (v[ 9])); } while (0); do { (v[ 2]) += (v[ 6]) + (m[blake2s_sigma[(8)][(4)]]); (v[14]) = ror(16, (v[14]) ^ (v[ 2])); (v[10]) += (v[14]); (v[ 6]) = ror(12, (v[ 6]) ^ (v[10])); (v[ 2]) += (v[ 6]) + (m[blake2s_sigma[(8)][(5)]]); (v[14]) = ror( 8, (v[14]) ^ (v[ 2])); (v[10]) += (v[14]); (v[ 6]) = ror( 7, (v[ 6]) ^ (v[10])); } while (0); do { (v[ 3]) += (v[ 7]) + (m[blake2s_sigma[(8)][(6)]]); (v[15]) = ror(16, (v[15]) ^ (v[ 3])); (v[11]) += (v[15]); (v[ 7]) = ror(12, (v[ 7]) ^ (v[11])); (v[ 3]) += (v[ 7]) + (m[blake2s_sigma[(8)][(7)]]); (v[15]) = ror( 8, (v[15]) ^ (v[ 3])); (v[11]) += (v[15]); (v[ 7]) = ror( 7, (v[ 7]) ^ (v[11])); } while (0); do { (v[ 0]) += (v[ 5]) + (m[blake2s_sigma[(8)][(8)]]); (v[15]) = ror(16, (v[15]) ^ (v[ 0])); (v[10]) += (v[15]); (v[ 5]) = ror(12, (v[ 5]) ^ (v[10])); (v[ 0]) += (v[ 5]) + (m[blake2s_sigma[(8)][(9)]]); (v[15]) = ror( 8, (v[15]) ^ (v[ 0])); (v[10]) += (v[15]); (v[ 5]) = ror( 7, (v[ 5]) ^ (v[10])); } while (0); do { (v[ 1]) += (v[ 6]) + (m[blake2s_sigma[(8)][(10)]]); (v[12]) = ror(16, (v[12]) ^ (v[ 1])); (v[11]) += (v[12]); (v[ 6]) = ror(12, (v[ 6]) ^ (v[11])); (v[ 1]) += (v[ 6]) + (m[blake2s_sigma[(8)][(11)]]); (v[12]) = ror( 8, (v[12]) ^ (v[ 1])); (v[11]) += (v[12]); (v[ 6]) = ror( 7, (v[ 6]) ^ (v[11])); } while (0); do { (v[ 2]) += (v[ 7]) + (m[blake2s_sigma[(8)][(12)]]); (v[13]) = ror(16, (v[13]) ^ (v[ 2])); (v[ 8]) += (v[13]); (v[ 7]) = ror(12, (v[ 7]) ^ (v[ 8])); (v[ 2]) += (v[ 7]) + (m[blake2s_sigma[(8)][(13)]]); (v[13]) = ror( 8, (v[13]) ^ (v[ 2])); (v[ 8]) += (v[13]); (v[ 7]) = ror( 7, (v[ 7]) ^ (v[ 8])); } while (0); do { (v[ 3]) += (v[ 4]) + (m[blake2s_sigma[(8)][(14)]]); (v[14]) = ror(16, (v[14]) ^ (v[ 3])); (v[ 9]) += (v[14]); (v[ 4]) = ror(12, (v[ 4]) ^ (v[ 9])); (v[ 3]) += (v[ 4]) + (m[blake2s_sigma[(8)][(15)]]); (v[14]) = ror( 8, (v[14]) ^ (v[ 3])); (v[ 9]) += (v[14]); (v[ 4]) = ror( 7, (v[ 4]) ^ (v[ 9])); } while (0); } while (0);
+    do { do { (v[ 0]) += (v[ 4]) + (m[blake2s_sigma[(9)][(0)]]); (v[12]) = ror(16, (v[12]) ^ (v[ 0])); (v[ 8]) += (v[12]); (v[ 4]) = ror(12, (v[ 4]) ^ (v[ 8])); (v[ 0]) += (v[ 4]) + (m[blake2s_sigma[(9)][(1)]]); (v[12]) = ror( 8, (v[12]) ^ (v[ 0])); (v[ 8]) += (v[12]); (v[ 4]) = ror( 7, (v[ 4]) ^ (v[ 8])); } while (0); do { (v[ 1]) += (v[ 5]) + (m[blake2s_sigma[(9)][(2)]]); (v[13]) = ror(16, (v[13]) ^ (v[ 1])); (v[ 9]) += (v[13]); (v[ 5]) = ror(12, (v[ 5]) ^ (v[ 9])); (v[ 1]) += (v[ 5]) + (m[blake2s_sigma[(9)][(3)]]); (v[13]) = ror( 8, (v[13]) ^ (v[ 1])); (v[ 9]) += (v[13]); (v[ 5]) = ror( 7, (v[ 5]) ^ (v[ 9])); } while (0); do { (v[ 2]) += (v[ 6]) + (m[blake2s_sigma[(9)][(4)]]); (v[14]) = ror(16, (v[14]) ^ (v[ 2])); (v[10]) += (v[14]); (v[ 6]) = ror(12, (v[ 6]) ^ (v[10])); (v[ 2]) += (v[ 6]) + (m[blake2s_sigma[(9)][(5)]]); (v[14]) = ror( 8, (v[14]) ^ (v[ 2])); (v[10]) += (v[14]); (v[ 6]) = ror( 7, (v[ 6]) ^ (v[10])); } while (0); do { (v[ 3]) += (v[ 7]) + (m[blake2s_sigma[(9)][(6)]]); (v[15]) = ror(16, (v[15]) ^ (v[ 3])); (v[11]) += (v[15]); (v[ 7]) = ror(12, (v[ 7]) ^ (v[11])); (v[ 3]) += (v[ 7]) + (m[blake2s_sigma[(9)][(7)]]); (v[15]) = ror( 8, (v[15]) ^ (v[ 3])); (v[11]) += (v[15]); (v[ 7]) = ror( 7, (v[ 7]) ^ (v[11])); } while (0); do { (v[ 0]) += (v[ 5]) + (m[blake2s_sigma[(9)][(8)]]); (v[15]) = ror(16, (v[15]) ^ (v[ 0])); (v[10]) += (v[15]); (v[ 5]) = ror(12, (v[ 5]) ^ (v[10])); (v[ 0]) += (v[ 5]) + (m[blake2s_sigma[(9)][(9)]]); (v[15]) = ror( 8, (v[15]) ^ (v[ 0])); (v[10]) += (v[15]); (v[ 5]) = ror( 7, (v[ 5]) ^ (v[10])); } while (0); do { (v[ 1]) += (v[ 6]) + (m[blake2s_sigma[(9)][(10)]]); (v[12]) = ror(16, (v[12]) ^ (v[ 1])); (v[11]) += (v[12]); (v[ 6]) = ror(12, (v[ 6]) ^ (v[11])); (v[ 1]) += (v[ 6]) + (m[blake2s_sigma[(9)][(11)]]); (v[12]) = ror( 8, (v[12]) ^ (v[ 1])); (v[11]) += (v[12]); (v[ 6]) = ror( 7, (v[ 6]) ^ (v[11])); } while (0); do { (v[ 2]) += (v[ 7]) + (m[blake2s_sigma[(9)][(12)]]); (v[13]) = ror(16, (v[13]) ^ (v[ 2])); (v[ 8]) += (v[13]); (v[ 7]) = ror(12, (v[ 7]) ^ (v[ 8])); (v[ 2]) += (v[ 7]) + (m[blake2s_sigma[(9)][(13)]]); (v[13]) = ror( 8, (v[13]) ^ (v[ 2])); (v[ 8]) += (v[13]); (v[ 7]) = ror( 7, (v[ 7]) ^ (v[ 8])); } while (0); do { (v[ 3]) += (v[ 4]) + (m[blake2s_sigma[(9)][(14)]]); (v[14]) = ror(16, (v[14]) ^ (v[ 3])); (v[ 9]) += (v[14]); (v[ 4]) = ror(12, (v[ 4]) ^ (v[ 9])); (v[ 3]) += (v[ 4]) + (m[blake2s_sigma[(9)][(15)]]); (v[14]) = ror( 8, (v[14]) ^ (v[ 3])); (v[ 9]) += (v[14]); (v[ 4]) = ror( 7, (v[ 4]) ^ (v[ 9])); } while (0); } while (0);
+}
+
+static inline void blake2s_block(u32 H[8], const u32 t[2], const u32 f[2],
+                                 const void *msg)
+{
+    u32 v[16];
+    u32 m[16];
+    butil_le32_copy(m, msg, sizeof(m));
+    butil_copy_words(v, H, 8*sizeof(*H));
+    v[ 8] = blake2s_iv[0];
+    v[ 9] = blake2s_iv[1];
+    v[10] = blake2s_iv[2];
+    v[11] = blake2s_iv[3];
+    v[12] = blake2s_iv[4] ^ t[0];
+    v[13] = blake2s_iv[5] ^ t[1];
+    v[14] = blake2s_iv[6] ^ f[0];
+    v[15] = blake2s_iv[7] ^ f[1];
+
+    blake2s_10rounds(v, m);
+
+    for (unsigned i = 0; i < 8;) {
+        H[i] ^= v[i] ^ v[i+8]; i++;
+        H[i] ^= v[i] ^ v[i+8]; i++;
+        H[i] ^= v[i] ^ v[i+8]; i++;
+        H[i] ^= v[i] ^ v[i+8]; i++;
+    }
+}
+
+void blake2s_compress_generic(struct blake2s_ctx *ctx, const void *msg)
+{
+    blake2s_block(ctx->H, ctx->t, ctx->f, msg);
+}
+
+void blake2s_compress_blocks_generic(struct blake2s_ctx *ctx, const void *msg,
+                                     size_t nblocks)
+{
+    const unsigned char *m = msg;
+    u32 H[8], t[2], f[2];
+    butil_copy_words(H, ctx->H, sizeof(H));
+    t[0] = ctx->t[0];
+    t[1] = ctx->t[1];
+    f[0] = ctx->f[0];
+    f[1] = ctx->f[1];
+    for (; nblocks; nblocks--, m += 64) {
+        t[0] += 64;
+        t[1] += (t[0] < 64);
+        blake2s_block(H, t, f, m);
+    }
+    butil_copy_words(ctx->H, H, sizeof(H));
+    ctx->t[0] = t[0];
+    ctx->t[1] = t[1];
+}
@@ -0,0 +1,22869 @@
+	.file	"blake2s-generic.c"
+# GNU C99 (Debian 12.2.0-14+deb12u1) version 12.2.0 (x86_64-linux-gnu)
+#	compiled by GNU C version 12.2.0, GMP version 6.2.1, MPFR version 4.2.0, MPC version 1.3.1, isl version isl-0.25-GMP
+
+# GGC heuristics: --param ggc-min-expand=100 --param ggc-min-heapsize=131072
+# options passed: -mtune=generic -march=x86-64 -g -O3 -std=c99 -fasynchronous-unwind-tables
+	.text
+.Ltext0:
+	.file 0 "/root/repo" "blake2s-generic.c"
+	.p2align 4
+	.type	blake2s_10rounds.constprop.0, @function
+blake2s_10rounds.constprop.0:
+.LVL0:
+.LFB23:
+	.file 1 "blake2s-generic.c"
+	.loc 1 17 20 view -0
+	.cfi_startproc
+	.loc 1 50 5 view .LVU1
+	.loc 1 50 10 view .LVU2
+	.loc 1 50 15 view .LVU3
+# blake2s-generic.c:17: static inline void blake2s_10rounds(u32 v[16], const u32 m[16])
+	.loc 1 17 20 is_stmt 0 view .LVU4
+	pushq	%r15	#
+	.cfi_def_cfa_offset 16
+	.cfi_offset 15, -16
+	movq	%rdi, %rax	# tmp2032, v
+	movq	%rsi, %r9	# tmp2033, m
+	pushq	%r14	#
+	.cfi_def_cfa_offset 24
+	.cfi_offset 14, -24
+	pushq	%r13	#
+	.cfi_def_cfa_offset 32
+	.cfi_offset 13, -32
+	pushq	%r12	#
+	.cfi_def_cfa_offset 40
+	.cfi_offset 12, -40
+	pushq	%rbp	#
+	.cfi_def_cfa_offset 48
+	.cfi_offset 6, -48
+	pushq	%rbx	#
+	.cfi_def_cfa_offset 56
+	.cfi_offset 3, -56
+# blake2s-generic.c:50:     FULLROUND(0);
+	.loc 1 50 28 view .LVU5
+	movl	16(%rdi), %edx	# MEM[(u32 *)v_1(D) + 16B], _3
+# blake2s-generic.c:50:     FULLROUND(0);
+	.loc 1 50 23 view .LVU6
+	movl	(%rdi), %r8d	# *v_1(D), tmp1380
+	addl	%edx, %r8d	# _3, tmp1380
+	addl	(%rsi), %r8d	# *m_4(D), _7
+	movl	%r8d, (%rdi)	# _7, *v_1(D)
+	.loc 1 50 66 is_stmt 1 view .LVU7
+.LVL1:
+.LBB1297:
+.LBI1297:
+	.loc 1 5 19 view .LVU8
+.LBB1298:
+	.loc 1 5 44 view .LVU9
+.LBE1298:
+.LBE1297:
+# blake2s-generic.c:50:     FULLROUND(0);
+	.loc 1 50 76 is_stmt 0 view .LVU10
+	movl	48(%rdi), %edi	# MEM[(u32 *)v_1(D) + 48B], tmp1383
+.LVL2:
+# blake2s-generic.c:50:     FULLROUND(0);
+	.loc 1 50 112 view .LVU11
+	movl	32(%rax), %r12d	# MEM[(u32 *)v_1(D) + 32B], _12
+# blake2s-generic.c:50:     FULLROUND(0);
+	.loc 1 50 340 view .LVU12
+	movl	20(%rax), %ebp	# MEM[(u32 *)v_1(D) + 20B], _24
+# blake2s-generic.c:50:     FULLROUND(0);
+	.loc 1 50 76 view .LVU13
+	xorl	%r8d, %edi	# _7, tmp1383
+.LVL3:
+# blake2s-generic.c:50:     FULLROUND(0);
+	.loc 1 50 388 view .LVU14
+	movl	52(%rax), %ecx	# MEM[(u32 *)v_1(D) + 52B], tmp1393
+# blake2s-generic.c:50:     FULLROUND(0);
+	.loc 1 50 424 view .LVU15
+	movl	36(%rax), %ebx	# MEM[(u32 *)v_1(D) + 36B], _32
+.LBB1300:
+.LBB1299:
+# blake2s-generic.c:5: static inline u32 ror(unsigned l, u32 x) { return (x >> l) | (x << (32-l)); }
+	.loc 1 5 60 view .LVU16
+	roll	$16, %edi	#, _10
+.LVL4:
+	.loc 1 5 60 view .LVU17
+.LBE1299:
+.LBE1300:
+# blake2s-generic.c:50:     FULLROUND(0);
+	.loc 1 50 112 view .LVU18
+	addl	%edi, %r12d	# _10, _12
+# blake2s-generic.c:50:     FULLROUND(0);
+	.loc 1 50 74 view .LVU19
+	movl	%edi, 48(%rax)	# _10, MEM[(u32 *)v_1(D) + 48B]
+	.loc 1 50 104 is_stmt 1 view .LVU20
+# blake2s-generic.c:50:     FULLROUND(0);
+	.loc 1 50 134 is_stmt 0 view .LVU21
+	xorl	%r12d, %edx	# _12, tmp1385
+# blake2s-generic.c:50:     FULLROUND(0);
+	.loc 1 50 112 view .LVU22
+	movl	%r12d, 32(%rax)	# _12, MEM[(u32 *)v_1(D) + 32B]
+	.loc 1 50 124 is_stmt 1 view .LVU23
+.LVL5:
+.LBB1301:
+.LBI1301:
+	.loc 1 5 19 view .LVU24
+.LBB1302:
+	.loc 1 5 44 view .LVU25
+# blake2s-generic.c:5: static inline u32 ror(unsigned l, u32 x) { return (x >> l) | (x << (32-l)); }
+	.loc 1 5 60 is_stmt 0 view .LVU26
+	rorl	$12, %edx	#, _14
+.LVL6:
+	.loc 1 5 60 view .LVU27
+.LBE1302:
+.LBE1301:
+# blake2s-generic.c:50:     FULLROUND(0);
+	.loc 1 50 132 view .LVU28
+	movl	%edx, 16(%rax)	# _14, MEM[(u32 *)v_1(D) + 16B]
+	.loc 1 50 162 is_stmt 1 view .LVU29
+# blake2s-generic.c:50:     FULLROUND(0);
+	.loc 1 50 170 is_stmt 0 view .LVU30
+	addl	4(%rsi), %r8d	# MEM[(const u32 *)m_4(D) + 4B], tmp1386
+	addl	%edx, %r8d	# _14, _17
+# blake2s-generic.c:50:     FULLROUND(0);
+	.loc 1 50 335 view .LVU31
+	movl	4(%rax), %esi	# MEM[(u32 *)v_1(D) + 4B], tmp1390
+.LVL7:
+# blake2s-generic.c:50:     FULLROUND(0);
+	.loc 1 50 223 view .LVU32
+	xorl	%r8d, %edi	# _17, tmp1388
+# blake2s-generic.c:50:     FULLROUND(0);
+	.loc 1 50 170 view .LVU33
+	movl	%r8d, (%rax)	# _17, *v_1(D)
+	.loc 1 50 213 is_stmt 1 view .LVU34
+.LVL8:
+.LBB1303:
+.LBI1303:
+	.loc 1 5 19 view .LVU35
+.LBB1304:
+	.loc 1 5 44 view .LVU36
+# blake2s-generic.c:5: static inline u32 ror(unsigned l, u32 x) { return (x >> l) | (x << (32-l)); }
+	.loc 1 5 60 is_stmt 0 view .LVU37
+	rorl	$8, %edi	#, _19
+.LVL9:
+	.loc 1 5 60 view .LVU38
+.LBE1304:
+.LBE1303:
+# blake2s-generic.c:50:     FULLROUND(0);
+	.loc 1 50 335 view .LVU39
+	addl	%ebp, %esi	# _24, tmp1390
+# blake2s-generic.c:50:     FULLROUND(0);
+	.loc 1 50 259 view .LVU40
+	addl	%edi, %r12d	# _19, _20
+# blake2s-generic.c:50:     FULLROUND(0);
+	.loc 1 50 221 view .LVU41
+	movl	%edi, 48(%rax)	# _19, MEM[(u32 *)v_1(D) + 48B]
+	.loc 1 50 251 is_stmt 1 view .LVU42
+# blake2s-generic.c:50:     FULLROUND(0);
+	.loc 1 50 281 is_stmt 0 view .LVU43
+	xorl	%r12d, %edx	# _20, tmp1389
+# blake2s-generic.c:50:     FULLROUND(0);
+	.loc 1 50 259 view .LVU44
+	movl	%r12d, 32(%rax)	# _20, MEM[(u32 *)v_1(D) + 32B]
+	.loc 1 50 271 is_stmt 1 view .LVU45
+.LVL10:
+.LBB1305:
+.LBI1305:
+	.loc 1 5 19 view .LVU46
+.LBB1306:
+	.loc 1 5 44 view .LVU47
+# blake2s-generic.c:5: static inline u32 ror(unsigned l, u32 x) { return (x >> l) | (x << (32-l)); }
+	.loc 1 5 60 is_stmt 0 view .LVU48
+	rorl	$7, %edx	#, tmp1389
+.LBE1306:
+.LBE1305:
+# blake2s-generic.c:50:     FULLROUND(0);
+	.loc 1 50 279 view .LVU49
+	movl	%edx, 16(%rax)	# _22, MEM[(u32 *)v_1(D) + 16B]
+	.loc 1 50 13 is_stmt 1 view .LVU50
+	.loc 1 50 322 view .LVU51
+	.loc 1 50 327 view .LVU52
+# blake2s-generic.c:50:     FULLROUND(0);
+	.loc 1 50 335 is_stmt 0 view .LVU53
+	addl	8(%r9), %esi	# MEM[(const u32 *)m_4(D) + 8B], _27
+# blake2s-generic.c:50:     FULLROUND(0);
+	.loc 1 50 388 view .LVU54
+	xorl	%esi, %ecx	# _27, tmp1393
+# blake2s-generic.c:50:     FULLROUND(0);
+	.loc 1 50 335 view .LVU55
+	movl	%esi, 4(%rax)	# _27, MEM[(u32 *)v_1(D) + 4B]
+	.loc 1 50 378 is_stmt 1 view .LVU56
+.LVL11:
+.LBB1307:
+.LBI1307:
+	.loc 1 5 19 view .LVU57
+.LBB1308:
+	.loc 1 5 44 view .LVU58
+# blake2s-generic.c:5: static inline u32 ror(unsigned l, u32 x) { return (x >> l) | (x << (32-l)); }
+	.loc 1 5 60 is_stmt 0 view .LVU59
+	roll	$16, %ecx	#, _30
+.LVL12:
+	.loc 1 5 60 view .LVU60
+.LBE1308:
+.LBE1307:
+# blake2s-generic.c:50:     FULLROUND(0);
+	.loc 1 50 279 view .LVU61
+	movl	%edx, -28(%rsp)	# _22, %sfp
+# blake2s-generic.c:50:     FULLROUND(0);
+	.loc 1 50 424 view .LVU62
+	addl	%ecx, %ebx	# _30, _32
+# blake2s-generic.c:50:     FULLROUND(0);
+	.loc 1 50 386 view .LVU63
+	movl	%ecx, 52(%rax)	# _30, MEM[(u32 *)v_1(D) + 52B]
+	.loc 1 50 416 is_stmt 1 view .LVU64
+# blake2s-generic.c:50:     FULLROUND(0);
+	.loc 1 50 446 is_stmt 0 view .LVU65
+	xorl	%ebx, %ebp	# _32, tmp1395
+# blake2s-generic.c:50:     FULLROUND(0);
+	.loc 1 50 424 view .LVU66
+	movl	%ebx, 36(%rax)	# _32, MEM[(u32 *)v_1(D) + 36B]
+	.loc 1 50 436 is_stmt 1 view .LVU67
+.LVL13:
+.LBB1309:
+.LBI1309:
+	.loc 1 5 19 view .LVU68
+.LBB1310:
+	.loc 1 5 44 view .LVU69
+# blake2s-generic.c:5: static inline u32 ror(unsigned l, u32 x) { return (x >> l) | (x << (32-l)); }
+	.loc 1 5 60 is_stmt 0 view .LVU70
+	rorl	$12, %ebp	#, _34
+.LVL14:
+	.loc 1 5 60 view .LVU71
+.LBE1310:
+.LBE1309:
+# blake2s-generic.c:50:     FULLROUND(0);
+	.loc 1 50 444 view .LVU72
+	movl	%ebp, 20(%rax)	# _34, MEM[(u32 *)v_1(D) + 20B]
+	.loc 1 50 474 is_stmt 1 view .LVU73
+# blake2s-generic.c:50:     FULLROUND(0);
+	.loc 1 50 482 is_stmt 0 view .LVU74
+	addl	12(%r9), %esi	# MEM[(const u32 *)m_4(D) + 12B], tmp1396
+	addl	%ebp, %esi	# _34, _37
+# blake2s-generic.c:50:     FULLROUND(0);
+	.loc 1 50 535 view .LVU75
+	xorl	%esi, %ecx	# _37, tmp1398
+# blake2s-generic.c:50:     FULLROUND(0);
+	.loc 1 50 482 view .LVU76
+	movl	%esi, 4(%rax)	# _37, MEM[(u32 *)v_1(D) + 4B]
+	.loc 1 50 525 is_stmt 1 view .LVU77
+.LVL15:
+.LBB1311:
+.LBI1311:
+	.loc 1 5 19 view .LVU78
+.LBB1312:
+	.loc 1 5 44 view .LVU79
+# blake2s-generic.c:5: static inline u32 ror(unsigned l, u32 x) { return (x >> l) | (x << (32-l)); }
+	.loc 1 5 60 is_stmt 0 view .LVU80
+	rorl	$8, %ecx	#, _39
+.LVL16:
+	.loc 1 5 60 view .LVU81
+.LBE1312:
+.LBE1311:
+# blake2s-generic.c:50:     FULLROUND(0);
+	.loc 1 50 571 view .LVU82
+	leal	(%rbx,%rcx), %ebx	#, _40
+# blake2s-generic.c:50:     FULLROUND(0);
+	.loc 1 50 533 view .LVU83
+	movl	%ecx, 52(%rax)	# _39, MEM[(u32 *)v_1(D) + 52B]
+	.loc 1 50 563 is_stmt 1 view .LVU84
+# blake2s-generic.c:50:     FULLROUND(0);
+	.loc 1 50 647 is_stmt 0 view .LVU85
+	movl	8(%rax), %r10d	# MEM[(u32 *)v_1(D) + 8B], tmp1400
+# blake2s-generic.c:50:     FULLROUND(0);
+	.loc 1 50 593 view .LVU86
+	xorl	%ebx, %ebp	# _40, tmp1399
+# blake2s-generic.c:50:     FULLROUND(0);
+	.loc 1 50 736 view .LVU87
+	movl	40(%rax), %r11d	# MEM[(u32 *)v_1(D) + 40B], _52
+# blake2s-generic.c:50:     FULLROUND(0);
+	.loc 1 50 959 view .LVU88
+	movl	12(%rax), %r14d	# MEM[(u32 *)v_1(D) + 12B], tmp1410
+# blake2s-generic.c:50:     FULLROUND(0);
+	.loc 1 50 571 view .LVU89
+	movl	%ebx, 36(%rax)	# _40, MEM[(u32 *)v_1(D) + 36B]
+	.loc 1 50 583 is_stmt 1 view .LVU90
+.LVL17:
+.LBB1313:
+.LBI1313:
+	.loc 1 5 19 view .LVU91
+.LBB1314:
+	.loc 1 5 44 view .LVU92
+# blake2s-generic.c:5: static inline u32 ror(unsigned l, u32 x) { return (x >> l) | (x << (32-l)); }
+	.loc 1 5 60 is_stmt 0 view .LVU93
+	rorl	$7, %ebp	#, _42
+.LVL18:
+	.loc 1 5 60 view .LVU94
+.LBE1314:
+.LBE1313:
+# blake2s-generic.c:50:     FULLROUND(0);
+	.loc 1 50 593 view .LVU95
+	movl	%ebx, -24(%rsp)	# _40, %sfp
+# blake2s-generic.c:50:     FULLROUND(0);
+	.loc 1 50 652 view .LVU96
+	movl	24(%rax), %ebx	# MEM[(u32 *)v_1(D) + 24B], _44
+# blake2s-generic.c:50:     FULLROUND(0);
+	.loc 1 50 591 view .LVU97
+	movl	%ebp, 20(%rax)	# _42, MEM[(u32 *)v_1(D) + 20B]
+	.loc 1 50 325 is_stmt 1 view .LVU98
+	.loc 1 50 634 view .LVU99
+	.loc 1 50 639 view .LVU100
+# blake2s-generic.c:50:     FULLROUND(0);
+	.loc 1 50 647 is_stmt 0 view .LVU101
+	movl	16(%r9), %edx	# MEM[(const u32 *)m_4(D) + 16B], tmp1400
+	addl	%ebx, %r10d	# _44, tmp1400
+# blake2s-generic.c:50:     FULLROUND(0);
+	.loc 1 50 1012 view .LVU102
+	movl	60(%rax), %r13d	# MEM[(u32 *)v_1(D) + 60B], tmp1413
+# blake2s-generic.c:50:     FULLROUND(0);
+	.loc 1 50 647 view .LVU103
+	addl	%r10d, %edx	# tmp1400, tmp1400
+# blake2s-generic.c:50:     FULLROUND(0);
+	.loc 1 50 700 view .LVU104
+	movl	56(%rax), %r10d	# MEM[(u32 *)v_1(D) + 56B], tmp1403
+# blake2s-generic.c:50:     FULLROUND(0);
+	.loc 1 50 647 view .LVU105
+	movl	%edx, 8(%rax)	# _47, MEM[(u32 *)v_1(D) + 8B]
+	.loc 1 50 690 is_stmt 1 view .LVU106
+.LVL19:
+.LBB1315:
+.LBI1315:
+	.loc 1 5 19 view .LVU107
+.LBB1316:
+	.loc 1 5 44 view .LVU108
+.LBE1316:
+.LBE1315:
+# blake2s-generic.c:50:     FULLROUND(0);
+	.loc 1 50 700 is_stmt 0 view .LVU109
+	xorl	%edx, %r10d	# _47, tmp1403
+.LVL20:
+.LBB1318:
+.LBB1317:
+# blake2s-generic.c:5: static inline u32 ror(unsigned l, u32 x) { return (x >> l) | (x << (32-l)); }
+	.loc 1 5 60 view .LVU110
+	roll	$16, %r10d	#, _50
+.LVL21:
+	.loc 1 5 60 view .LVU111
+.LBE1317:
+.LBE1318:
+# blake2s-generic.c:50:     FULLROUND(0);
+	.loc 1 50 736 view .LVU112
+	addl	%r10d, %r11d	# _50, _52
+# blake2s-generic.c:50:     FULLROUND(0);
+	.loc 1 50 698 view .LVU113
+	movl	%r10d, 56(%rax)	# _50, MEM[(u32 *)v_1(D) + 56B]
+	.loc 1 50 728 is_stmt 1 view .LVU114
+# blake2s-generic.c:50:     FULLROUND(0);
+	.loc 1 50 758 is_stmt 0 view .LVU115
+	xorl	%r11d, %ebx	# _52, tmp1405
+# blake2s-generic.c:50:     FULLROUND(0);
+	.loc 1 50 736 view .LVU116
+	movl	%r11d, 40(%rax)	# _52, MEM[(u32 *)v_1(D) + 40B]
+	.loc 1 50 748 is_stmt 1 view .LVU117
+.LVL22:
+.LBB1319:
+.LBI1319:
+	.loc 1 5 19 view .LVU118
+.LBB1320:
+	.loc 1 5 44 view .LVU119
+.LBE1320:
+.LBE1319:
+# blake2s-generic.c:50:     FULLROUND(0);
+	.loc 1 50 736 is_stmt 0 view .LVU120
+	movl	%r11d, %r15d	# _52, _52
+# blake2s-generic.c:50:     FULLROUND(0);
+	.loc 1 50 964 view .LVU121
+	movl	28(%rax), %r11d	# MEM[(u32 *)v_1(D) + 28B], _64
+.LBB1322:
+.LBB1321:
+# blake2s-generic.c:5: static inline u32 ror(unsigned l, u32 x) { return (x >> l) | (x << (32-l)); }
+	.loc 1 5 60 view .LVU122
+	rorl	$12, %ebx	#, _54
+.LVL23:
+	.loc 1 5 60 view .LVU123
+.LBE1321:
+.LBE1322:
+# blake2s-generic.c:50:     FULLROUND(0);
+	.loc 1 50 756 view .LVU124
+	movl	%ebx, 24(%rax)	# _54, MEM[(u32 *)v_1(D) + 24B]
+	.loc 1 50 786 is_stmt 1 view .LVU125
+# blake2s-generic.c:50:     FULLROUND(0);
+	.loc 1 50 794 is_stmt 0 view .LVU126
+	addl	20(%r9), %edx	# MEM[(const u32 *)m_4(D) + 20B], tmp1406
+# blake2s-generic.c:50:     FULLROUND(0);
+	.loc 1 50 959 view .LVU127
+	addl	%r11d, %r14d	# _64, tmp1410
+# blake2s-generic.c:50:     FULLROUND(0);
+	.loc 1 50 794 view .LVU128
+	addl	%ebx, %edx	# _54, _57
+# blake2s-generic.c:50:     FULLROUND(0);
+	.loc 1 50 847 view .LVU129
+	xorl	%edx, %r10d	# _57, tmp1408
+# blake2s-generic.c:50:     FULLROUND(0);
+	.loc 1 50 794 view .LVU130
+	movl	%edx, 8(%rax)	# _57, MEM[(u32 *)v_1(D) + 8B]
+	.loc 1 50 837 is_stmt 1 view .LVU131
+.LVL24:
+.LBB1323:
+.LBI1323:
+	.loc 1 5 19 view .LVU132
+.LBB1324:
+	.loc 1 5 44 view .LVU133
+# blake2s-generic.c:5: static inline u32 ror(unsigned l, u32 x) { return (x >> l) | (x << (32-l)); }
+	.loc 1 5 60 is_stmt 0 view .LVU134
+	rorl	$8, %r10d	#, tmp1408
+.LBE1324:
+.LBE1323:
+# blake2s-generic.c:50:     FULLROUND(0);
+	.loc 1 50 883 view .LVU135
+	addl	%r10d, %r15d	# _59, _60
+# blake2s-generic.c:50:     FULLROUND(0);
+	.loc 1 50 845 view .LVU136
+	movl	%r10d, 56(%rax)	# _59, MEM[(u32 *)v_1(D) + 56B]
+	.loc 1 50 875 is_stmt 1 view .LVU137
+# blake2s-generic.c:50:     FULLROUND(0);
+	.loc 1 50 905 is_stmt 0 view .LVU138
+	xorl	%r15d, %ebx	# _60, tmp1409
+# blake2s-generic.c:50:     FULLROUND(0);
+	.loc 1 50 883 view .LVU139
+	movl	%r15d, 40(%rax)	# _60, MEM[(u32 *)v_1(D) + 40B]
+	.loc 1 50 895 is_stmt 1 view .LVU140
+.LVL25:
+.LBB1325:
+.LBI1325:
+	.loc 1 5 19 view .LVU141
+.LBB1326:
+	.loc 1 5 44 view .LVU142
+# blake2s-generic.c:5: static inline u32 ror(unsigned l, u32 x) { return (x >> l) | (x << (32-l)); }
+	.loc 1 5 60 is_stmt 0 view .LVU143
+	rorl	$7, %ebx	#, _62
+.LVL26:
+	.loc 1 5 60 view .LVU144
+.LBE1326:
+.LBE1325:
+# blake2s-generic.c:50:     FULLROUND(0);
+	.loc 1 50 883 view .LVU145
+	movl	%r10d, -20(%rsp)	# _59, %sfp
+# blake2s-generic.c:50:     FULLROUND(0);
+	.loc 1 50 903 view .LVU146
+	movl	%ebx, 24(%rax)	# _62, MEM[(u32 *)v_1(D) + 24B]
+	.loc 1 50 637 is_stmt 1 view .LVU147
+	.loc 1 50 946 view .LVU148
+	.loc 1 50 951 view .LVU149
+# blake2s-generic.c:50:     FULLROUND(0);
+	.loc 1 50 959 is_stmt 0 view .LVU150
+	movl	24(%r9), %r10d	# MEM[(const u32 *)m_4(D) + 24B], tmp1410
+	addl	%r14d, %r10d	# tmp1410, tmp1410
+# blake2s-generic.c:50:     FULLROUND(0);
+	.loc 1 50 1048 view .LVU151
+	movl	44(%rax), %r14d	# MEM[(u32 *)v_1(D) + 44B], _72
+# blake2s-generic.c:50:     FULLROUND(0);
+	.loc 1 50 1012 view .LVU152
+	xorl	%r10d, %r13d	# _67, tmp1413
+# blake2s-generic.c:50:     FULLROUND(0);
+	.loc 1 50 959 view .LVU153
+	movl	%r10d, 12(%rax)	# _67, MEM[(u32 *)v_1(D) + 12B]
+	.loc 1 50 1002 is_stmt 1 view .LVU154
+.LVL27:
+.LBB1327:
+.LBI1327:
+	.loc 1 5 19 view .LVU155
+.LBB1328:
+	.loc 1 5 44 view .LVU156
+# blake2s-generic.c:5: static inline u32 ror(unsigned l, u32 x) { return (x >> l) | (x << (32-l)); }
+	.loc 1 5 60 is_stmt 0 view .LVU157
+	roll	$16, %r13d	#, _70
+.LVL28:
+	.loc 1 5 60 view .LVU158
+.LBE1328:
+.LBE1327:
+# blake2s-generic.c:50:     FULLROUND(0);
+	.loc 1 50 1048 view .LVU159
+	addl	%r13d, %r14d	# _70, _72
+# blake2s-generic.c:50:     FULLROUND(0);
+	.loc 1 50 1010 view .LVU160
+	movl	%r13d, 60(%rax)	# _70, MEM[(u32 *)v_1(D) + 60B]
+	.loc 1 50 1040 is_stmt 1 view .LVU161
+# blake2s-generic.c:50:     FULLROUND(0);
+	.loc 1 50 1070 is_stmt 0 view .LVU162
+	xorl	%r14d, %r11d	# _72, tmp1415
+# blake2s-generic.c:50:     FULLROUND(0);
+	.loc 1 50 1048 view .LVU163
+	movl	%r14d, 44(%rax)	# _72, MEM[(u32 *)v_1(D) + 44B]
+	.loc 1 50 1060 is_stmt 1 view .LVU164
+.LVL29:
+.LBB1329:
+.LBI1329:
+	.loc 1 5 19 view .LVU165
+.LBB1330:
+	.loc 1 5 44 view .LVU166
+# blake2s-generic.c:5: static inline u32 ror(unsigned l, u32 x) { return (x >> l) | (x << (32-l)); }
+	.loc 1 5 60 is_stmt 0 view .LVU167
+	rorl	$12, %r11d	#, _74
+.LVL30:
+	.loc 1 5 60 view .LVU168
+.LBE1330:
+.LBE1329:
+# blake2s-generic.c:50:     FULLROUND(0);
+	.loc 1 50 1068 view .LVU169
+	movl	%r11d, 28(%rax)	# _74, MEM[(u32 *)v_1(D) + 28B]
+	.loc 1 50 1098 is_stmt 1 view .LVU170
+# blake2s-generic.c:50:     FULLROUND(0);
+	.loc 1 50 1106 is_stmt 0 view .LVU171
+	addl	28(%r9), %r10d	# MEM[(const u32 *)m_4(D) + 28B], tmp1416
+	addl	%r11d, %r10d	# _74, _77
+# blake2s-generic.c:50:     FULLROUND(0);
+	.loc 1 50 1159 view .LVU172
+	xorl	%r10d, %r13d	# _77, tmp1418
+# blake2s-generic.c:50:     FULLROUND(0);
+	.loc 1 50 1106 view .LVU173
+	movl	%r10d, 12(%rax)	# _77, MEM[(u32 *)v_1(D) + 12B]
+	.loc 1 50 1149 is_stmt 1 view .LVU174
+.LVL31:
+.LBB1331:
+.LBI1331:
+	.loc 1 5 19 view .LVU175
+.LBB1332:
+	.loc 1 5 44 view .LVU176
+# blake2s-generic.c:5: static inline u32 ror(unsigned l, u32 x) { return (x >> l) | (x << (32-l)); }
+	.loc 1 5 60 is_stmt 0 view .LVU177
+	rorl	$8, %r13d	#, _79
+.LVL32:
+	.loc 1 5 60 view .LVU178
+.LBE1332:
+.LBE1331:
+# blake2s-generic.c:50:     FULLROUND(0);
+	.loc 1 50 1195 view .LVU179
+	addl	%r13d, %r14d	# _79, _80
+# blake2s-generic.c:50:     FULLROUND(0);
+	.loc 1 50 1157 view .LVU180
+	movl	%r13d, 60(%rax)	# _79, MEM[(u32 *)v_1(D) + 60B]
+	.loc 1 50 1187 is_stmt 1 view .LVU181
+# blake2s-generic.c:50:     FULLROUND(0);
+	.loc 1 50 1217 is_stmt 0 view .LVU182
+	xorl	%r14d, %r11d	# _80, tmp1419
+# blake2s-generic.c:50:     FULLROUND(0);
+	.loc 1 50 1195 view .LVU183
+	movl	%r14d, 44(%rax)	# _80, MEM[(u32 *)v_1(D) + 44B]
+	.loc 1 50 1207 is_stmt 1 view .LVU184
+.LVL33:
+.LBB1333:
+.LBI1333:
+	.loc 1 5 19 view .LVU185
+.LBB1334:
+	.loc 1 5 44 view .LVU186
+# blake2s-generic.c:5: static inline u32 ror(unsigned l, u32 x) { return (x >> l) | (x << (32-l)); }
+	.loc 1 5 60 is_stmt 0 view .LVU187
+	rorl	$7, %r11d	#, _82
+.LVL34:
+	.loc 1 5 60 view .LVU188
+.LBE1334:
+.LBE1333:
+# blake2s-generic.c:50:     FULLROUND(0);
+	.loc 1 50 1215 view .LVU189
+	movl	%r11d, 28(%rax)	# _82, MEM[(u32 *)v_1(D) + 28B]
+	.loc 1 50 949 is_stmt 1 view .LVU190
+	.loc 1 50 1258 view .LVU191
+	.loc 1 50 1263 view .LVU192
+# blake2s-generic.c:50:     FULLROUND(0);
+	.loc 1 50 1271 is_stmt 0 view .LVU193
+	addl	32(%r9), %r8d	# MEM[(const u32 *)m_4(D) + 32B], tmp1420
+	addl	%ebp, %r8d	# _42, _85
+# blake2s-generic.c:50:     FULLROUND(0);
+	.loc 1 50 1324 view .LVU194
+	xorl	%r8d, %r13d	# _85, tmp1422
+# blake2s-generic.c:50:     FULLROUND(0);
+	.loc 1 50 1271 view .LVU195
+	movl	%r8d, (%rax)	# _85, *v_1(D)
+	.loc 1 50 1314 is_stmt 1 view .LVU196
+.LVL35:
+.LBB1335:
+.LBI1335:
+	.loc 1 5 19 view .LVU197
+.LBB1336:
+	.loc 1 5 44 view .LVU198
+# blake2s-generic.c:5: static inline u32 ror(unsigned l, u32 x) { return (x >> l) | (x << (32-l)); }
+	.loc 1 5 60 is_stmt 0 view .LVU199
+	roll	$16, %r13d	#, _87
+.LVL36:
+	.loc 1 5 60 view .LVU200
+.LBE1336:
+.LBE1335:
+# blake2s-generic.c:50:     FULLROUND(0);
+	.loc 1 50 1360 view .LVU201
+	addl	%r13d, %r15d	# _87, _88
+# blake2s-generic.c:50:     FULLROUND(0);
+	.loc 1 50 1322 view .LVU202
+	movl	%r13d, 60(%rax)	# _87, MEM[(u32 *)v_1(D) + 60B]
+	.loc 1 50 1352 is_stmt 1 view .LVU203
+# blake2s-generic.c:50:     FULLROUND(0);
+	.loc 1 50 1382 is_stmt 0 view .LVU204
+	xorl	%r15d, %ebp	# _88, tmp1423
+# blake2s-generic.c:50:     FULLROUND(0);
+	.loc 1 50 1360 view .LVU205
+	movl	%r15d, 40(%rax)	# _88, MEM[(u32 *)v_1(D) + 40B]
+	.loc 1 50 1372 is_stmt 1 view .LVU206
+.LVL37:
+.LBB1337:
+.LBI1337:
+	.loc 1 5 19 view .LVU207
+.LBB1338:
+	.loc 1 5 44 view .LVU208
+# blake2s-generic.c:5: static inline u32 ror(unsigned l, u32 x) { return (x >> l) | (x << (32-l)); }
+	.loc 1 5 60 is_stmt 0 view .LVU209
+	rorl	$12, %ebp	#, _90
+.LVL38:
+	.loc 1 5 60 view .LVU210
+.LBE1338:
+.LBE1337:
+# blake2s-generic.c:50:     FULLROUND(0);
+	.loc 1 50 1380 view .LVU211
+	movl	%ebp, 20(%rax)	# _90, MEM[(u32 *)v_1(D) + 20B]
+	.loc 1 50 1410 is_stmt 1 view .LVU212
+# blake2s-generic.c:50:     FULLROUND(0);
+	.loc 1 50 1418 is_stmt 0 view .LVU213
+	addl	36(%r9), %r8d	# MEM[(const u32 *)m_4(D) + 36B], tmp1424
+	addl	%ebp, %r8d	# _90, _93
+# blake2s-generic.c:50:     FULLROUND(0);
+	.loc 1 50 1471 view .LVU214
+	xorl	%r8d, %r13d	# _93, tmp1426
+# blake2s-generic.c:50:     FULLROUND(0);
+	.loc 1 50 1418 view .LVU215
+	movl	%r8d, (%rax)	# _93, *v_1(D)
+	.loc 1 50 1461 is_stmt 1 view .LVU216
+.LVL39:
+.LBB1339:
+.LBI1339:
+	.loc 1 5 19 view .LVU217
+.LBB1340:
+	.loc 1 5 44 view .LVU218
+# blake2s-generic.c:5: static inline u32 ror(unsigned l, u32 x) { return (x >> l) | (x << (32-l)); }
+	.loc 1 5 60 is_stmt 0 view .LVU219
+	rorl	$8, %r13d	#, tmp1426
+.LBE1340:
+.LBE1339:
+# blake2s-generic.c:50:     FULLROUND(0);
+	.loc 1 50 1507 view .LVU220
+	addl	%r13d, %r15d	# _95, _96
+# blake2s-generic.c:50:     FULLROUND(0);
+	.loc 1 50 1469 view .LVU221
+	movl	%r13d, 60(%rax)	# _95, MEM[(u32 *)v_1(D) + 60B]
+	.loc 1 50 1499 is_stmt 1 view .LVU222
+# blake2s-generic.c:50:     FULLROUND(0);
+	.loc 1 50 1529 is_stmt 0 view .LVU223
+	xorl	%r15d, %ebp	# _96, tmp1427
+# blake2s-generic.c:50:     FULLROUND(0);
+	.loc 1 50 1507 view .LVU224
+	movl	%r15d, 40(%rax)	# _96, MEM[(u32 *)v_1(D) + 40B]
+	.loc 1 50 1519 is_stmt 1 view .LVU225
+.LVL40:
+.LBB1341:
+.LBI1341:
+	.loc 1 5 19 view .LVU226
+.LBB1342:
+	.loc 1 5 44 view .LVU227
+# blake2s-generic.c:5: static inline u32 ror(unsigned l, u32 x) { return (x >> l) | (x << (32-l)); }
+	.loc 1 5 60 is_stmt 0 view .LVU228
+	rorl	$7, %ebp	#, _98
+.LVL41:
+	.loc 1 5 60 view .LVU229
+.LBE1342:
+.LBE1341:
+# blake2s-generic.c:50:     FULLROUND(0);
+	.loc 1 50 1507 view .LVU230
+	movl	%r13d, -16(%rsp)	# _95, %sfp
+# blake2s-generic.c:50:     FULLROUND(0);
+	.loc 1 50 1527 view .LVU231
+	movl	%ebp, 20(%rax)	# _98, MEM[(u32 *)v_1(D) + 20B]
+	.loc 1 50 1261 is_stmt 1 view .LVU232
+	.loc 1 50 1570 view .LVU233
+	.loc 1 50 1575 view .LVU234
+# blake2s-generic.c:50:     FULLROUND(0);
+	.loc 1 50 1583 is_stmt 0 view .LVU235
+	addl	40(%r9), %esi	# MEM[(const u32 *)m_4(D) + 40B], tmp1428
+	addl	%ebx, %esi	# _62, _101
+# blake2s-generic.c:50:     FULLROUND(0);
+	.loc 1 50 1529 view .LVU236
+	movl	%r15d, -12(%rsp)	# _96, %sfp
+# blake2s-generic.c:50:     FULLROUND(0);
+	.loc 1 50 1637 view .LVU237
+	xorl	%esi, %edi	# _101, tmp1430
+# blake2s-generic.c:50:     FULLROUND(0);
+	.loc 1 50 1583 view .LVU238
+	movl	%esi, 4(%rax)	# _101, MEM[(u32 *)v_1(D) + 4B]
+	.loc 1 50 1627 is_stmt 1 view .LVU239
+.LVL42:
+.LBB1343:
+.LBI1343:
+	.loc 1 5 19 view .LVU240
+.LBB1344:
+	.loc 1 5 44 view .LVU241
+# blake2s-generic.c:5: static inline u32 ror(unsigned l, u32 x) { return (x >> l) | (x << (32-l)); }
+	.loc 1 5 60 is_stmt 0 view .LVU242
+	roll	$16, %edi	#, _103
+.LVL43:
+	.loc 1 5 60 view .LVU243
+.LBE1344:
+.LBE1343:
+# blake2s-generic.c:50:     FULLROUND(0);
+	.loc 1 50 1673 view .LVU244
+	addl	%edi, %r14d	# _103, _104
+# blake2s-generic.c:50:     FULLROUND(0);
+	.loc 1 50 1635 view .LVU245
+	movl	%edi, 48(%rax)	# _103, MEM[(u32 *)v_1(D) + 48B]
+	.loc 1 50 1665 is_stmt 1 view .LVU246
+# blake2s-generic.c:50:     FULLROUND(0);
+	.loc 1 50 1695 is_stmt 0 view .LVU247
+	xorl	%r14d, %ebx	# _104, tmp1431
+# blake2s-generic.c:50:     FULLROUND(0);
+	.loc 1 50 1673 view .LVU248
+	movl	%r14d, 44(%rax)	# _104, MEM[(u32 *)v_1(D) + 44B]
+	.loc 1 50 1685 is_stmt 1 view .LVU249
+.LVL44:
+.LBB1345:
+.LBI1345:
+	.loc 1 5 19 view .LVU250
+.LBB1346:
+	.loc 1 5 44 view .LVU251
+# blake2s-generic.c:5: static inline u32 ror(unsigned l, u32 x) { return (x >> l) | (x << (32-l)); }
+	.loc 1 5 60 is_stmt 0 view .LVU252
+	rorl	$12, %ebx	#, _106
+.LVL45:
+	.loc 1 5 60 view .LVU253
+.LBE1346:
+.LBE1345:
+# blake2s-generic.c:50:     FULLROUND(0);
+	.loc 1 50 1693 view .LVU254
+	movl	%ebx, 24(%rax)	# _106, MEM[(u32 *)v_1(D) + 24B]
+	.loc 1 50 1723 is_stmt 1 view .LVU255
+# blake2s-generic.c:50:     FULLROUND(0);
+	.loc 1 50 1731 is_stmt 0 view .LVU256
+	addl	44(%r9), %esi	# MEM[(const u32 *)m_4(D) + 44B], tmp1432
+	addl	%ebx, %esi	# _106, _109
+# blake2s-generic.c:50:     FULLROUND(0);
+	.loc 1 50 1785 view .LVU257
+	xorl	%esi, %edi	# _109, tmp1434
+# blake2s-generic.c:50:     FULLROUND(0);
+	.loc 1 50 1731 view .LVU258
+	movl	%esi, 4(%rax)	# _109, MEM[(u32 *)v_1(D) + 4B]
+	.loc 1 50 1775 is_stmt 1 view .LVU259
+.LVL46:
+.LBB1347:
+.LBI1347:
+	.loc 1 5 19 view .LVU260
+.LBB1348:
+	.loc 1 5 44 view .LVU261
+# blake2s-generic.c:5: static inline u32 ror(unsigned l, u32 x) { return (x >> l) | (x << (32-l)); }
+	.loc 1 5 60 is_stmt 0 view .LVU262
+	rorl	$8, %edi	#, _111
+.LVL47:
+	.loc 1 5 60 view .LVU263
+.LBE1348:
+.LBE1347:
+# blake2s-generic.c:50:     FULLROUND(0);
+	.loc 1 50 1821 view .LVU264
+	addl	%edi, %r14d	# _111, _112
+# blake2s-generic.c:50:     FULLROUND(0);
+	.loc 1 50 1783 view .LVU265
+	movl	%edi, 48(%rax)	# _111, MEM[(u32 *)v_1(D) + 48B]
+	.loc 1 50 1813 is_stmt 1 view .LVU266
+# blake2s-generic.c:50:     FULLROUND(0);
+	.loc 1 50 1843 is_stmt 0 view .LVU267
+	xorl	%r14d, %ebx	# _112, tmp1435
+# blake2s-generic.c:50:     FULLROUND(0);
+	.loc 1 50 1821 view .LVU268
+	movl	%r14d, 44(%rax)	# _112, MEM[(u32 *)v_1(D) + 44B]
+	.loc 1 50 1833 is_stmt 1 view .LVU269
+.LVL48:
+.LBB1349:
+.LBI1349:
+	.loc 1 5 19 view .LVU270
+.LBB1350:
+	.loc 1 5 44 view .LVU271
+# blake2s-generic.c:5: static inline u32 ror(unsigned l, u32 x) { return (x >> l) | (x << (32-l)); }
+	.loc 1 5 60 is_stmt 0 view .LVU272
+	rorl	$7, %ebx	#, _114
+.LVL49:
+	.loc 1 5 60 view .LVU273
+.LBE1350:
+.LBE1349:
+# blake2s-generic.c:50:     FULLROUND(0);
+	.loc 1 50 1843 view .LVU274
+	movl	%r14d, -8(%rsp)	# _112, %sfp
+# blake2s-generic.c:50:     FULLROUND(0);
+	.loc 1 50 1841 view .LVU275
+	movl	%ebx, 24(%rax)	# _114, MEM[(u32 *)v_1(D) + 24B]
+	.loc 1 50 1573 is_stmt 1 view .LVU276
+	.loc 1 50 1884 view .LVU277
+	.loc 1 50 1889 view .LVU278
+# blake2s-generic.c:50:     FULLROUND(0);
+	.loc 1 50 1897 is_stmt 0 view .LVU279
+	addl	48(%r9), %edx	# MEM[(const u32 *)m_4(D) + 48B], tmp1436
+	addl	%r11d, %edx	# _82, _117
+# blake2s-generic.c:50:     FULLROUND(0);
+	.loc 1 50 1951 view .LVU280
+	xorl	%edx, %ecx	# _117, tmp1438
+# blake2s-generic.c:50:     FULLROUND(0);
+	.loc 1 50 1897 view .LVU281
+	movl	%edx, 8(%rax)	# _117, MEM[(u32 *)v_1(D) + 8B]
+	.loc 1 50 1941 is_stmt 1 view .LVU282
+.LVL50:
+.LBB1351:
+.LBI1351:
+	.loc 1 5 19 view .LVU283
+.LBB1352:
+	.loc 1 5 44 view .LVU284
+# blake2s-generic.c:5: static inline u32 ror(unsigned l, u32 x) { return (x >> l) | (x << (32-l)); }
+	.loc 1 5 60 is_stmt 0 view .LVU285
+	roll	$16, %ecx	#, _119
+.LVL51:
+	.loc 1 5 60 view .LVU286
+.LBE1352:
+.LBE1351:
+# blake2s-generic.c:50:     FULLROUND(0);
+	.loc 1 50 1987 view .LVU287
+	addl	%ecx, %r12d	# _119, _120
+# blake2s-generic.c:50:     FULLROUND(0);
+	.loc 1 50 1949 view .LVU288
+	movl	%ecx, 52(%rax)	# _119, MEM[(u32 *)v_1(D) + 52B]
+	.loc 1 50 1979 is_stmt 1 view .LVU289
+# blake2s-generic.c:50:     FULLROUND(0);
+	.loc 1 50 2009 is_stmt 0 view .LVU290
+	xorl	%r12d, %r11d	# _120, tmp1439
+# blake2s-generic.c:50:     FULLROUND(0);
+	.loc 1 50 1987 view .LVU291
+	movl	%r12d, 32(%rax)	# _120, MEM[(u32 *)v_1(D) + 32B]
+	.loc 1 50 1999 is_stmt 1 view .LVU292
+.LVL52:
+.LBB1353:
+.LBI1353:
+	.loc 1 5 19 view .LVU293
+.LBB1354:
+	.loc 1 5 44 view .LVU294
+# blake2s-generic.c:5: static inline u32 ror(unsigned l, u32 x) { return (x >> l) | (x << (32-l)); }
+	.loc 1 5 60 is_stmt 0 view .LVU295
+	rorl	$12, %r11d	#, _122
+.LVL53:
+	.loc 1 5 60 view .LVU296
+.LBE1354:
+.LBE1353:
+# blake2s-generic.c:50:     FULLROUND(0);
+	.loc 1 50 2007 view .LVU297
+	movl	%r11d, 28(%rax)	# _122, MEM[(u32 *)v_1(D) + 28B]
+	.loc 1 50 2037 is_stmt 1 view .LVU298
+# blake2s-generic.c:50:     FULLROUND(0);
+	.loc 1 50 2045 is_stmt 0 view .LVU299
+	addl	52(%r9), %edx	# MEM[(const u32 *)m_4(D) + 52B], tmp1440
+	addl	%r11d, %edx	# _122, _125
+# blake2s-generic.c:50:     FULLROUND(0);
+	.loc 1 50 2099 view .LVU300
+	xorl	%edx, %ecx	# _125, tmp1442
+# blake2s-generic.c:50:     FULLROUND(0);
+	.loc 1 50 2045 view .LVU301
+	movl	%edx, 8(%rax)	# _125, MEM[(u32 *)v_1(D) + 8B]
+	.loc 1 50 2089 is_stmt 1 view .LVU302
+.LVL54:
+.LBB1355:
+.LBI1355:
+	.loc 1 5 19 view .LVU303
+.LBB1356:
+	.loc 1 5 44 view .LVU304
+# blake2s-generic.c:5: static inline u32 ror(unsigned l, u32 x) { return (x >> l) | (x << (32-l)); }
+	.loc 1 5 60 is_stmt 0 view .LVU305
+	rorl	$8, %ecx	#, _127
+.LVL55:
+	.loc 1 5 60 view .LVU306
+.LBE1356:
+.LBE1355:
+# blake2s-generic.c:50:     FULLROUND(0);
+	.loc 1 50 2135 view .LVU307
+	addl	%ecx, %r12d	# _127, _128
+# blake2s-generic.c:50:     FULLROUND(0);
+	.loc 1 50 2097 view .LVU308
+	movl	%ecx, 52(%rax)	# _127, MEM[(u32 *)v_1(D) + 52B]
+	.loc 1 50 2127 is_stmt 1 view .LVU309
+# blake2s-generic.c:50:     FULLROUND(0);
+	.loc 1 50 2157 is_stmt 0 view .LVU310
+	xorl	%r12d, %r11d	# _128, tmp1443
+# blake2s-generic.c:50:     FULLROUND(0);
+	.loc 1 50 2135 view .LVU311
+	movl	%r12d, 32(%rax)	# _128, MEM[(u32 *)v_1(D) + 32B]
+	.loc 1 50 2147 is_stmt 1 view .LVU312
+.LVL56:
+.LBB1357:
+.LBI1357:
+	.loc 1 5 19 view .LVU313
+.LBB1358:
+	.loc 1 5 44 view .LVU314
+# blake2s-generic.c:5: static inline u32 ror(unsigned l, u32 x) { return (x >> l) | (x << (32-l)); }
+	.loc 1 5 60 is_stmt 0 view .LVU315
+	rorl	$7, %r11d	#, _130
+.LVL57:
+	.loc 1 5 60 view .LVU316
+.LBE1358:
+.LBE1357:
+# blake2s-generic.c:50:     FULLROUND(0);
+	.loc 1 50 2155 view .LVU317
+	movl	%r11d, 28(%rax)	# _130, MEM[(u32 *)v_1(D) + 28B]
+	.loc 1 50 1887 is_stmt 1 view .LVU318
+	.loc 1 50 2198 view .LVU319
+	.loc 1 50 2203 view .LVU320
+# blake2s-generic.c:50:     FULLROUND(0);
+	.loc 1 50 2211 is_stmt 0 view .LVU321
+	movl	-28(%rsp), %r15d	# %sfp, _22
+	addl	56(%r9), %r10d	# MEM[(const u32 *)m_4(D) + 56B], tmp1444
+# blake2s-generic.c:50:     FULLROUND(0);
+	.loc 1 50 2265 view .LVU322
+	movl	-20(%rsp), %r13d	# %sfp, _59
+# blake2s-generic.c:50:     FULLROUND(0);
+	.loc 1 50 2211 view .LVU323
+	addl	%r15d, %r10d	# _22, _133
+# blake2s-generic.c:50:     FULLROUND(0);
+	.loc 1 50 2301 view .LVU324
+	movl	-24(%rsp), %r14d	# %sfp, _40
+# blake2s-generic.c:50:     FULLROUND(0);
+	.loc 1 50 2265 view .LVU325
+	xorl	%r10d, %r13d	# _133, _59
+# blake2s-generic.c:50:     FULLROUND(0);
+	.loc 1 50 2211 view .LVU326
+	movl	%r10d, 12(%rax)	# _133, MEM[(u32 *)v_1(D) + 12B]
+	.loc 1 50 2255 is_stmt 1 view .LVU327
+.LVL58:
+.LBB1359:
+.LBI1359:
+	.loc 1 5 19 view .LVU328
+.LBB1360:
+	.loc 1 5 44 view .LVU329
+# blake2s-generic.c:5: static inline u32 ror(unsigned l, u32 x) { return (x >> l) | (x << (32-l)); }
+	.loc 1 5 60 is_stmt 0 view .LVU330
+	roll	$16, %r13d	#, _135
+.LVL59:
+	.loc 1 5 60 view .LVU331
+.LBE1360:
+.LBE1359:
+# blake2s-generic.c:50:     FULLROUND(0);
+	.loc 1 50 2301 view .LVU332
+	addl	%r13d, %r14d	# _135, _136
+# blake2s-generic.c:50:     FULLROUND(0);
+	.loc 1 50 2263 view .LVU333
+	movl	%r13d, 56(%rax)	# _135, MEM[(u32 *)v_1(D) + 56B]
+	.loc 1 50 2293 is_stmt 1 view .LVU334
+# blake2s-generic.c:50:     FULLROUND(0);
+	.loc 1 50 2323 is_stmt 0 view .LVU335
+	xorl	%r14d, %r15d	# _136, _22
+# blake2s-generic.c:50:     FULLROUND(0);
+	.loc 1 50 2301 view .LVU336
+	movl	%r14d, 36(%rax)	# _136, MEM[(u32 *)v_1(D) + 36B]
+	.loc 1 50 2313 is_stmt 1 view .LVU337
+.LVL60:
+.LBB1361:
+.LBI1361:
+	.loc 1 5 19 view .LVU338
+.LBB1362:
+	.loc 1 5 44 view .LVU339
+# blake2s-generic.c:5: static inline u32 ror(unsigned l, u32 x) { return (x >> l) | (x << (32-l)); }
+	.loc 1 5 60 is_stmt 0 view .LVU340
+	rorl	$12, %r15d	#, _138
+.LVL61:
+	.loc 1 5 60 view .LVU341
+.LBE1362:
+.LBE1361:
+# blake2s-generic.c:50:     FULLROUND(0);
+	.loc 1 50 2321 view .LVU342
+	movl	%r15d, 16(%rax)	# _138, MEM[(u32 *)v_1(D) + 16B]
+	.loc 1 50 2351 is_stmt 1 view .LVU343
+# blake2s-generic.c:50:     FULLROUND(0);
+	.loc 1 50 2359 is_stmt 0 view .LVU344
+	addl	60(%r9), %r10d	# MEM[(const u32 *)m_4(D) + 60B], tmp1448
+	addl	%r15d, %r10d	# _138, _141
+# blake2s-generic.c:50:     FULLROUND(0);
+	.loc 1 50 2413 view .LVU345
+	xorl	%r10d, %r13d	# _141, tmp1450
+# blake2s-generic.c:50:     FULLROUND(0);
+	.loc 1 50 2359 view .LVU346
+	movl	%r10d, 12(%rax)	# _141, MEM[(u32 *)v_1(D) + 12B]
+	.loc 1 50 2403 is_stmt 1 view .LVU347
+.LVL62:
+.LBB1363:
+.LBI1363:
+	.loc 1 5 19 view .LVU348
+.LBB1364:
+	.loc 1 5 44 view .LVU349
+# blake2s-generic.c:5: static inline u32 ror(unsigned l, u32 x) { return (x >> l) | (x << (32-l)); }
+	.loc 1 5 60 is_stmt 0 view .LVU350
+	rorl	$8, %r13d	#, _143
+.LVL63:
+	.loc 1 5 60 view .LVU351
+.LBE1364:
+.LBE1363:
+# blake2s-generic.c:50:     FULLROUND(0);
+	.loc 1 50 2449 view .LVU352
+	addl	%r13d, %r14d	# _143, _144
+# blake2s-generic.c:50:     FULLROUND(0);
+	.loc 1 50 2411 view .LVU353
+	movl	%r13d, 56(%rax)	# _143, MEM[(u32 *)v_1(D) + 56B]
+	.loc 1 50 2441 is_stmt 1 view .LVU354
+# blake2s-generic.c:50:     FULLROUND(0);
+	.loc 1 50 2471 is_stmt 0 view .LVU355
+	xorl	%r14d, %r15d	# _144, tmp1451
+# blake2s-generic.c:50:     FULLROUND(0);
+	.loc 1 50 2449 view .LVU356
+	movl	%r14d, 36(%rax)	# _144, MEM[(u32 *)v_1(D) + 36B]
+	.loc 1 50 2461 is_stmt 1 view .LVU357
+.LVL64:
+.LBB1365:
+.LBI1365:
+	.loc 1 5 19 view .LVU358
+.LBB1366:
+	.loc 1 5 44 view .LVU359
+# blake2s-generic.c:5: static inline u32 ror(unsigned l, u32 x) { return (x >> l) | (x << (32-l)); }
+	.loc 1 5 60 is_stmt 0 view .LVU360
+	rorl	$7, %r15d	#, _146
+.LVL65:
+	.loc 1 5 60 view .LVU361
+.LBE1366:
+.LBE1365:
+# blake2s-generic.c:50:     FULLROUND(0);
+	.loc 1 50 2469 view .LVU362
+	movl	%r15d, 16(%rax)	# _146, MEM[(u32 *)v_1(D) + 16B]
+	.loc 1 50 2201 is_stmt 1 view .LVU363
+	.loc 1 50 8 view .LVU364
+	.loc 1 51 5 view .LVU365
+	.loc 1 51 10 view .LVU366
+	.loc 1 51 15 view .LVU367
+# blake2s-generic.c:51:     FULLROUND(1);
+	.loc 1 51 23 is_stmt 0 view .LVU368
+	addl	56(%r9), %r8d	# MEM[(const u32 *)m_4(D) + 56B], tmp1452
+	addl	%r15d, %r8d	# _146, _149
+# blake2s-generic.c:51:     FULLROUND(1);
+	.loc 1 51 76 view .LVU369
+	xorl	%r8d, %edi	# _149, tmp1454
+# blake2s-generic.c:51:     FULLROUND(1);
+	.loc 1 51 23 view .LVU370
+	movl	%r8d, (%rax)	# _149, *v_1(D)
+	.loc 1 51 66 is_stmt 1 view .LVU371
+.LVL66:
+.LBB1367:
+.LBI1367:
+	.loc 1 5 19 view .LVU372
+.LBB1368:
+	.loc 1 5 44 view .LVU373
+# blake2s-generic.c:5: static inline u32 ror(unsigned l, u32 x) { return (x >> l) | (x << (32-l)); }
+	.loc 1 5 60 is_stmt 0 view .LVU374
+	roll	$16, %edi	#, _151
+.LVL67:
+	.loc 1 5 60 view .LVU375
+.LBE1368:
+.LBE1367:
+# blake2s-generic.c:51:     FULLROUND(1);
+	.loc 1 51 112 view .LVU376
+	addl	%edi, %r12d	# _151, _152
+# blake2s-generic.c:51:     FULLROUND(1);
+	.loc 1 51 74 view .LVU377
+	movl	%edi, 48(%rax)	# _151, MEM[(u32 *)v_1(D) + 48B]
+	.loc 1 51 104 is_stmt 1 view .LVU378
+# blake2s-generic.c:51:     FULLROUND(1);
+	.loc 1 51 134 is_stmt 0 view .LVU379
+	xorl	%r12d, %r15d	# _152, tmp1455
+# blake2s-generic.c:51:     FULLROUND(1);
+	.loc 1 51 112 view .LVU380
+	movl	%r12d, 32(%rax)	# _152, MEM[(u32 *)v_1(D) + 32B]
+	.loc 1 51 124 is_stmt 1 view .LVU381
+.LVL68:
+.LBB1369:
+.LBI1369:
+	.loc 1 5 19 view .LVU382
+.LBB1370:
+	.loc 1 5 44 view .LVU383
+# blake2s-generic.c:5: static inline u32 ror(unsigned l, u32 x) { return (x >> l) | (x << (32-l)); }
+	.loc 1 5 60 is_stmt 0 view .LVU384
+	rorl	$12, %r15d	#, _154
+.LVL69:
+	.loc 1 5 60 view .LVU385
+.LBE1370:
+.LBE1369:
+# blake2s-generic.c:51:     FULLROUND(1);
+	.loc 1 51 132 view .LVU386
+	movl	%r15d, 16(%rax)	# _154, MEM[(u32 *)v_1(D) + 16B]
+	.loc 1 51 162 is_stmt 1 view .LVU387
+# blake2s-generic.c:51:     FULLROUND(1);
+	.loc 1 51 170 is_stmt 0 view .LVU388
+	addl	40(%r9), %r8d	# MEM[(const u32 *)m_4(D) + 40B], tmp1456
+	addl	%r15d, %r8d	# _154, _157
+# blake2s-generic.c:51:     FULLROUND(1);
+	.loc 1 51 223 view .LVU389
+	xorl	%r8d, %edi	# _157, tmp1458
+# blake2s-generic.c:51:     FULLROUND(1);
+	.loc 1 51 170 view .LVU390
+	movl	%r8d, (%rax)	# _157, *v_1(D)
+	.loc 1 51 213 is_stmt 1 view .LVU391
+.LVL70:
+.LBB1371:
+.LBI1371:
+	.loc 1 5 19 view .LVU392
+.LBB1372:
+	.loc 1 5 44 view .LVU393
+# blake2s-generic.c:5: static inline u32 ror(unsigned l, u32 x) { return (x >> l) | (x << (32-l)); }
+	.loc 1 5 60 is_stmt 0 view .LVU394
+	rorl	$8, %edi	#, _159
+.LVL71:
+	.loc 1 5 60 view .LVU395
+.LBE1372:
+.LBE1371:
+# blake2s-generic.c:51:     FULLROUND(1);
+	.loc 1 51 259 view .LVU396
+	addl	%edi, %r12d	# _159, _160
+# blake2s-generic.c:51:     FULLROUND(1);
+	.loc 1 51 221 view .LVU397
+	movl	%edi, 48(%rax)	# _159, MEM[(u32 *)v_1(D) + 48B]
+	.loc 1 51 251 is_stmt 1 view .LVU398
+# blake2s-generic.c:51:     FULLROUND(1);
+	.loc 1 51 281 is_stmt 0 view .LVU399
+	xorl	%r12d, %r15d	# _160, tmp1459
+# blake2s-generic.c:51:     FULLROUND(1);
+	.loc 1 51 259 view .LVU400
+	movl	%r12d, 32(%rax)	# _160, MEM[(u32 *)v_1(D) + 32B]
+	.loc 1 51 271 is_stmt 1 view .LVU401
+.LVL72:
+.LBB1373:
+.LBI1373:
+	.loc 1 5 19 view .LVU402
+.LBB1374:
+	.loc 1 5 44 view .LVU403
+# blake2s-generic.c:5: static inline u32 ror(unsigned l, u32 x) { return (x >> l) | (x << (32-l)); }
+	.loc 1 5 60 is_stmt 0 view .LVU404
+	rorl	$7, %r15d	#, tmp1459
+.LBE1374:
+.LBE1373:
+# blake2s-generic.c:51:     FULLROUND(1);
+	.loc 1 51 281 view .LVU405
+	movl	%r12d, -28(%rsp)	# _160, %sfp
+# blake2s-generic.c:51:     FULLROUND(1);
+	.loc 1 51 279 view .LVU406
+	movl	%r15d, 16(%rax)	# _162, MEM[(u32 *)v_1(D) + 16B]
+	.loc 1 51 13 is_stmt 1 view .LVU407
+	.loc 1 51 322 view .LVU408
+	.loc 1 51 327 view .LVU409
+# blake2s-generic.c:51:     FULLROUND(1);
+	.loc 1 51 335 is_stmt 0 view .LVU410
+	addl	16(%r9), %esi	# MEM[(const u32 *)m_4(D) + 16B], tmp1460
+	addl	%ebp, %esi	# _98, _165
+# blake2s-generic.c:51:     FULLROUND(1);
+	.loc 1 51 279 view .LVU411
+	movl	%r15d, -24(%rsp)	# _162, %sfp
+# blake2s-generic.c:51:     FULLROUND(1);
+	.loc 1 51 388 view .LVU412
+	xorl	%esi, %ecx	# _165, tmp1462
+# blake2s-generic.c:51:     FULLROUND(1);
+	.loc 1 51 335 view .LVU413
+	movl	%esi, 4(%rax)	# _165, MEM[(u32 *)v_1(D) + 4B]
+	.loc 1 51 378 is_stmt 1 view .LVU414
+.LVL73:
+.LBB1375:
+.LBI1375:
+	.loc 1 5 19 view .LVU415
+.LBB1376:
+	.loc 1 5 44 view .LVU416
+# blake2s-generic.c:5: static inline u32 ror(unsigned l, u32 x) { return (x >> l) | (x << (32-l)); }
+	.loc 1 5 60 is_stmt 0 view .LVU417
+	roll	$16, %ecx	#, _167
+.LVL74:
+	.loc 1 5 60 view .LVU418
+.LBE1376:
+.LBE1375:
+# blake2s-generic.c:51:     FULLROUND(1);
+	.loc 1 51 424 view .LVU419
+	addl	%ecx, %r14d	# _167, _168
+# blake2s-generic.c:51:     FULLROUND(1);
+	.loc 1 51 386 view .LVU420
+	movl	%ecx, 52(%rax)	# _167, MEM[(u32 *)v_1(D) + 52B]
+	.loc 1 51 416 is_stmt 1 view .LVU421
+# blake2s-generic.c:51:     FULLROUND(1);
+	.loc 1 51 446 is_stmt 0 view .LVU422
+	xorl	%r14d, %ebp	# _168, tmp1463
+# blake2s-generic.c:51:     FULLROUND(1);
+	.loc 1 51 424 view .LVU423
+	movl	%r14d, 36(%rax)	# _168, MEM[(u32 *)v_1(D) + 36B]
+	.loc 1 51 436 is_stmt 1 view .LVU424
+.LVL75:
+.LBB1377:
+.LBI1377:
+	.loc 1 5 19 view .LVU425
+.LBB1378:
+	.loc 1 5 44 view .LVU426
+# blake2s-generic.c:5: static inline u32 ror(unsigned l, u32 x) { return (x >> l) | (x << (32-l)); }
+	.loc 1 5 60 is_stmt 0 view .LVU427
+	rorl	$12, %ebp	#, _170
+.LVL76:
+	.loc 1 5 60 view .LVU428
+.LBE1378:
+.LBE1377:
+# blake2s-generic.c:51:     FULLROUND(1);
+	.loc 1 51 444 view .LVU429
+	movl	%ebp, 20(%rax)	# _170, MEM[(u32 *)v_1(D) + 20B]
+	.loc 1 51 474 is_stmt 1 view .LVU430
+# blake2s-generic.c:51:     FULLROUND(1);
+	.loc 1 51 482 is_stmt 0 view .LVU431
+	addl	32(%r9), %esi	# MEM[(const u32 *)m_4(D) + 32B], tmp1464
+	addl	%ebp, %esi	# _170, _173
+# blake2s-generic.c:51:     FULLROUND(1);
+	.loc 1 51 535 view .LVU432
+	xorl	%esi, %ecx	# _173, tmp1466
+# blake2s-generic.c:51:     FULLROUND(1);
+	.loc 1 51 482 view .LVU433
+	movl	%esi, 4(%rax)	# _173, MEM[(u32 *)v_1(D) + 4B]
+	.loc 1 51 525 is_stmt 1 view .LVU434
+.LVL77:
+.LBB1379:
+.LBI1379:
+	.loc 1 5 19 view .LVU435
+.LBB1380:
+	.loc 1 5 44 view .LVU436
+# blake2s-generic.c:5: static inline u32 ror(unsigned l, u32 x) { return (x >> l) | (x << (32-l)); }
+	.loc 1 5 60 is_stmt 0 view .LVU437
+	rorl	$8, %ecx	#, _175
+.LVL78:
+	.loc 1 5 60 view .LVU438
+.LBE1380:
+.LBE1379:
+# blake2s-generic.c:51:     FULLROUND(1);
+	.loc 1 51 571 view .LVU439
+	leal	(%r14,%rcx), %r12d	#, _176
+# blake2s-generic.c:51:     FULLROUND(1);
+	.loc 1 51 533 view .LVU440
+	movl	%ecx, 52(%rax)	# _175, MEM[(u32 *)v_1(D) + 52B]
+	.loc 1 51 563 is_stmt 1 view .LVU441
+# blake2s-generic.c:51:     FULLROUND(1);
+	.loc 1 51 736 is_stmt 0 view .LVU442
+	movl	-12(%rsp), %r14d	# %sfp, _96
+# blake2s-generic.c:51:     FULLROUND(1);
+	.loc 1 51 593 view .LVU443
+	xorl	%r12d, %ebp	# _176, tmp1467
+# blake2s-generic.c:51:     FULLROUND(1);
+	.loc 1 51 571 view .LVU444
+	movl	%r12d, 36(%rax)	# _176, MEM[(u32 *)v_1(D) + 36B]
+	.loc 1 51 583 is_stmt 1 view .LVU445
+.LVL79:
+.LBB1381:
+.LBI1381:
+	.loc 1 5 19 view .LVU446
+.LBB1382:
+	.loc 1 5 44 view .LVU447
+.LBE1382:
+.LBE1381:
+# blake2s-generic.c:51:     FULLROUND(1);
+	.loc 1 51 1048 is_stmt 0 view .LVU448
+	movl	-8(%rsp), %r15d	# %sfp, _112
+.LBB1384:
+.LBB1383:
+# blake2s-generic.c:5: static inline u32 ror(unsigned l, u32 x) { return (x >> l) | (x << (32-l)); }
+	.loc 1 5 60 view .LVU449
+	rorl	$7, %ebp	#, _178
+.LVL80:
+	.loc 1 5 60 view .LVU450
+.LBE1383:
+.LBE1384:
+# blake2s-generic.c:51:     FULLROUND(1);
+	.loc 1 51 593 view .LVU451
+	movl	%r12d, -20(%rsp)	# _176, %sfp
+# blake2s-generic.c:51:     FULLROUND(1);
+	.loc 1 51 1012 view .LVU452
+	movl	-16(%rsp), %r12d	# %sfp, _95
+# blake2s-generic.c:51:     FULLROUND(1);
+	.loc 1 51 591 view .LVU453
+	movl	%ebp, 20(%rax)	# _178, MEM[(u32 *)v_1(D) + 20B]
+	.loc 1 51 325 is_stmt 1 view .LVU454
+	.loc 1 51 634 view .LVU455
+	.loc 1 51 639 view .LVU456
+# blake2s-generic.c:51:     FULLROUND(1);
+	.loc 1 51 647 is_stmt 0 view .LVU457
+	addl	36(%r9), %edx	# MEM[(const u32 *)m_4(D) + 36B], tmp1468
+	addl	%ebx, %edx	# _114, _181
+# blake2s-generic.c:51:     FULLROUND(1);
+	.loc 1 51 700 view .LVU458
+	xorl	%edx, %r13d	# _181, tmp1470
+# blake2s-generic.c:51:     FULLROUND(1);
+	.loc 1 51 647 view .LVU459
+	movl	%edx, 8(%rax)	# _181, MEM[(u32 *)v_1(D) + 8B]
+	.loc 1 51 690 is_stmt 1 view .LVU460
+.LVL81:
+.LBB1385:
+.LBI1385:
+	.loc 1 5 19 view .LVU461
+.LBB1386:
+	.loc 1 5 44 view .LVU462
+# blake2s-generic.c:5: static inline u32 ror(unsigned l, u32 x) { return (x >> l) | (x << (32-l)); }
+	.loc 1 5 60 is_stmt 0 view .LVU463
+	roll	$16, %r13d	#, _183
+.LVL82:
+	.loc 1 5 60 view .LVU464
+.LBE1386:
+.LBE1385:
+# blake2s-generic.c:51:     FULLROUND(1);
+	.loc 1 51 736 view .LVU465
+	addl	%r13d, %r14d	# _183, _184
+# blake2s-generic.c:51:     FULLROUND(1);
+	.loc 1 51 698 view .LVU466
+	movl	%r13d, 56(%rax)	# _183, MEM[(u32 *)v_1(D) + 56B]
+	.loc 1 51 728 is_stmt 1 view .LVU467
+# blake2s-generic.c:51:     FULLROUND(1);
+	.loc 1 51 758 is_stmt 0 view .LVU468
+	xorl	%r14d, %ebx	# _184, tmp1471
+# blake2s-generic.c:51:     FULLROUND(1);
+	.loc 1 51 736 view .LVU469
+	movl	%r14d, 40(%rax)	# _184, MEM[(u32 *)v_1(D) + 40B]
+	.loc 1 51 748 is_stmt 1 view .LVU470
+.LVL83:
+.LBB1387:
+.LBI1387:
+	.loc 1 5 19 view .LVU471
+.LBB1388:
+	.loc 1 5 44 view .LVU472
+# blake2s-generic.c:5: static inline u32 ror(unsigned l, u32 x) { return (x >> l) | (x << (32-l)); }
+	.loc 1 5 60 is_stmt 0 view .LVU473
+	rorl	$12, %ebx	#, _186
+.LVL84:
+	.loc 1 5 60 view .LVU474
+.LBE1388:
+.LBE1387:
+# blake2s-generic.c:51:     FULLROUND(1);
+	.loc 1 51 756 view .LVU475
+	movl	%ebx, 24(%rax)	# _186, MEM[(u32 *)v_1(D) + 24B]
+	.loc 1 51 786 is_stmt 1 view .LVU476
+# blake2s-generic.c:51:     FULLROUND(1);
+	.loc 1 51 794 is_stmt 0 view .LVU477
+	addl	60(%r9), %edx	# MEM[(const u32 *)m_4(D) + 60B], tmp1472
+	addl	%ebx, %edx	# _186, _189
+# blake2s-generic.c:51:     FULLROUND(1);
+	.loc 1 51 847 view .LVU478
+	xorl	%edx, %r13d	# _189, tmp1474
+# blake2s-generic.c:51:     FULLROUND(1);
+	.loc 1 51 794 view .LVU479
+	movl	%edx, 8(%rax)	# _189, MEM[(u32 *)v_1(D) + 8B]
+	.loc 1 51 837 is_stmt 1 view .LVU480
+.LVL85:
+.LBB1389:
+.LBI1389:
+	.loc 1 5 19 view .LVU481
+.LBB1390:
+	.loc 1 5 44 view .LVU482
+# blake2s-generic.c:5: static inline u32 ror(unsigned l, u32 x) { return (x >> l) | (x << (32-l)); }
+	.loc 1 5 60 is_stmt 0 view .LVU483
+	rorl	$8, %r13d	#, _191
+.LVL86:
+	.loc 1 5 60 view .LVU484
+.LBE1390:
+.LBE1389:
+# blake2s-generic.c:51:     FULLROUND(1);
+	.loc 1 51 883 view .LVU485
+	addl	%r13d, %r14d	# _191, _192
+# blake2s-generic.c:51:     FULLROUND(1);
+	.loc 1 51 845 view .LVU486
+	movl	%r13d, 56(%rax)	# _191, MEM[(u32 *)v_1(D) + 56B]
+	.loc 1 51 875 is_stmt 1 view .LVU487
+# blake2s-generic.c:51:     FULLROUND(1);
+	.loc 1 51 905 is_stmt 0 view .LVU488
+	xorl	%r14d, %ebx	# _192, tmp1475
+# blake2s-generic.c:51:     FULLROUND(1);
+	.loc 1 51 883 view .LVU489
+	movl	%r14d, 40(%rax)	# _192, MEM[(u32 *)v_1(D) + 40B]
+	.loc 1 51 895 is_stmt 1 view .LVU490
+.LVL87:
+.LBB1391:
+.LBI1391:
+	.loc 1 5 19 view .LVU491
+.LBB1392:
+	.loc 1 5 44 view .LVU492
+# blake2s-generic.c:5: static inline u32 ror(unsigned l, u32 x) { return (x >> l) | (x << (32-l)); }
+	.loc 1 5 60 is_stmt 0 view .LVU493
+	rorl	$7, %ebx	#, _194
+.LVL88:
+	.loc 1 5 60 view .LVU494
+.LBE1392:
+.LBE1391:
+# blake2s-generic.c:51:     FULLROUND(1);
+	.loc 1 51 903 view .LVU495
+	movl	%ebx, 24(%rax)	# _194, MEM[(u32 *)v_1(D) + 24B]
+	.loc 1 51 637 is_stmt 1 view .LVU496
+	.loc 1 51 946 view .LVU497
+	.loc 1 51 951 view .LVU498
+# blake2s-generic.c:51:     FULLROUND(1);
+	.loc 1 51 959 is_stmt 0 view .LVU499
+	addl	52(%r9), %r10d	# MEM[(const u32 *)m_4(D) + 52B], tmp1476
+	addl	%r11d, %r10d	# _130, _197
+# blake2s-generic.c:51:     FULLROUND(1);
+	.loc 1 51 1012 view .LVU500
+	xorl	%r10d, %r12d	# _197, _95
+# blake2s-generic.c:51:     FULLROUND(1);
+	.loc 1 51 959 view .LVU501
+	movl	%r10d, 12(%rax)	# _197, MEM[(u32 *)v_1(D) + 12B]
+	.loc 1 51 1002 is_stmt 1 view .LVU502
+.LVL89:
+.LBB1393:
+.LBI1393:
+	.loc 1 5 19 view .LVU503
+.LBB1394:
+	.loc 1 5 44 view .LVU504
+# blake2s-generic.c:5: static inline u32 ror(unsigned l, u32 x) { return (x >> l) | (x << (32-l)); }
+	.loc 1 5 60 is_stmt 0 view .LVU505
+	roll	$16, %r12d	#, _199
+.LVL90:
+	.loc 1 5 60 view .LVU506
+.LBE1394:
+.LBE1393:
+# blake2s-generic.c:51:     FULLROUND(1);
+	.loc 1 51 1048 view .LVU507
+	addl	%r12d, %r15d	# _199, _200
+# blake2s-generic.c:51:     FULLROUND(1);
+	.loc 1 51 1010 view .LVU508
+	movl	%r12d, 60(%rax)	# _199, MEM[(u32 *)v_1(D) + 60B]
+	.loc 1 51 1040 is_stmt 1 view .LVU509
+# blake2s-generic.c:51:     FULLROUND(1);
+	.loc 1 51 1070 is_stmt 0 view .LVU510
+	xorl	%r15d, %r11d	# _200, tmp1479
+# blake2s-generic.c:51:     FULLROUND(1);
+	.loc 1 51 1048 view .LVU511
+	movl	%r15d, 44(%rax)	# _200, MEM[(u32 *)v_1(D) + 44B]
+	.loc 1 51 1060 is_stmt 1 view .LVU512
+.LVL91:
+.LBB1395:
+.LBI1395:
+	.loc 1 5 19 view .LVU513
+.LBB1396:
+	.loc 1 5 44 view .LVU514
+# blake2s-generic.c:5: static inline u32 ror(unsigned l, u32 x) { return (x >> l) | (x << (32-l)); }
+	.loc 1 5 60 is_stmt 0 view .LVU515
+	rorl	$12, %r11d	#, _202
+.LVL92:
+	.loc 1 5 60 view .LVU516
+.LBE1396:
+.LBE1395:
+# blake2s-generic.c:51:     FULLROUND(1);
+	.loc 1 51 1068 view .LVU517
+	movl	%r11d, 28(%rax)	# _202, MEM[(u32 *)v_1(D) + 28B]
+	.loc 1 51 1098 is_stmt 1 view .LVU518
+# blake2s-generic.c:51:     FULLROUND(1);
+	.loc 1 51 1106 is_stmt 0 view .LVU519
+	addl	24(%r9), %r10d	# MEM[(const u32 *)m_4(D) + 24B], tmp1480
+	addl	%r11d, %r10d	# _202, _205
+# blake2s-generic.c:51:     FULLROUND(1);
+	.loc 1 51 1159 view .LVU520
+	xorl	%r10d, %r12d	# _205, tmp1482
+# blake2s-generic.c:51:     FULLROUND(1);
+	.loc 1 51 1106 view .LVU521
+	movl	%r10d, 12(%rax)	# _205, MEM[(u32 *)v_1(D) + 12B]
+	.loc 1 51 1149 is_stmt 1 view .LVU522
+.LVL93:
+.LBB1397:
+.LBI1397:
+	.loc 1 5 19 view .LVU523
+.LBB1398:
+	.loc 1 5 44 view .LVU524
+# blake2s-generic.c:5: static inline u32 ror(unsigned l, u32 x) { return (x >> l) | (x << (32-l)); }
+	.loc 1 5 60 is_stmt 0 view .LVU525
+	rorl	$8, %r12d	#, _207
+.LVL94:
+	.loc 1 5 60 view .LVU526
+.LBE1398:
+.LBE1397:
+# blake2s-generic.c:51:     FULLROUND(1);
+	.loc 1 51 1195 view .LVU527
+	addl	%r12d, %r15d	# _207, _208
+# blake2s-generic.c:51:     FULLROUND(1);
+	.loc 1 51 1157 view .LVU528
+	movl	%r12d, 60(%rax)	# _207, MEM[(u32 *)v_1(D) + 60B]
+	.loc 1 51 1187 is_stmt 1 view .LVU529
+# blake2s-generic.c:51:     FULLROUND(1);
+	.loc 1 51 1217 is_stmt 0 view .LVU530
+	xorl	%r15d, %r11d	# _208, tmp1483
+# blake2s-generic.c:51:     FULLROUND(1);
+	.loc 1 51 1195 view .LVU531
+	movl	%r15d, 44(%rax)	# _208, MEM[(u32 *)v_1(D) + 44B]
+	.loc 1 51 1207 is_stmt 1 view .LVU532
+.LVL95:
+.LBB1399:
+.LBI1399:
+	.loc 1 5 19 view .LVU533
+.LBB1400:
+	.loc 1 5 44 view .LVU534
+# blake2s-generic.c:5: static inline u32 ror(unsigned l, u32 x) { return (x >> l) | (x << (32-l)); }
+	.loc 1 5 60 is_stmt 0 view .LVU535
+	rorl	$7, %r11d	#, _210
+.LVL96:
+	.loc 1 5 60 view .LVU536
+.LBE1400:
+.LBE1399:
+# blake2s-generic.c:51:     FULLROUND(1);
+	.loc 1 51 1215 view .LVU537
+	movl	%r11d, 28(%rax)	# _210, MEM[(u32 *)v_1(D) + 28B]
+	.loc 1 51 949 is_stmt 1 view .LVU538
+	.loc 1 51 1258 view .LVU539
+	.loc 1 51 1263 view .LVU540
+# blake2s-generic.c:51:     FULLROUND(1);
+	.loc 1 51 1271 is_stmt 0 view .LVU541
+	addl	4(%r9), %r8d	# MEM[(const u32 *)m_4(D) + 4B], tmp1484
+	addl	%ebp, %r8d	# _178, _213
+# blake2s-generic.c:51:     FULLROUND(1);
+	.loc 1 51 1324 view .LVU542
+	xorl	%r8d, %r12d	# _213, tmp1486
+# blake2s-generic.c:51:     FULLROUND(1);
+	.loc 1 51 1271 view .LVU543
+	movl	%r8d, (%rax)	# _213, *v_1(D)
+	.loc 1 51 1314 is_stmt 1 view .LVU544
+.LVL97:
+.LBB1401:
+.LBI1401:
+	.loc 1 5 19 view .LVU545
+.LBB1402:
+	.loc 1 5 44 view .LVU546
+# blake2s-generic.c:5: static inline u32 ror(unsigned l, u32 x) { return (x >> l) | (x << (32-l)); }
+	.loc 1 5 60 is_stmt 0 view .LVU547
+	roll	$16, %r12d	#, _215
+.LVL98:
+	.loc 1 5 60 view .LVU548
+.LBE1402:
+.LBE1401:
+# blake2s-generic.c:51:     FULLROUND(1);
+	.loc 1 51 1360 view .LVU549
+	addl	%r12d, %r14d	# _215, _216
+# blake2s-generic.c:51:     FULLROUND(1);
+	.loc 1 51 1322 view .LVU550
+	movl	%r12d, 60(%rax)	# _215, MEM[(u32 *)v_1(D) + 60B]
+	.loc 1 51 1352 is_stmt 1 view .LVU551
+# blake2s-generic.c:51:     FULLROUND(1);
+	.loc 1 51 1382 is_stmt 0 view .LVU552
+	xorl	%r14d, %ebp	# _216, tmp1487
+# blake2s-generic.c:51:     FULLROUND(1);
+	.loc 1 51 1360 view .LVU553
+	movl	%r14d, 40(%rax)	# _216, MEM[(u32 *)v_1(D) + 40B]
+	.loc 1 51 1372 is_stmt 1 view .LVU554
+.LVL99:
+.LBB1403:
+.LBI1403:
+	.loc 1 5 19 view .LVU555
+.LBB1404:
+	.loc 1 5 44 view .LVU556
+# blake2s-generic.c:5: static inline u32 ror(unsigned l, u32 x) { return (x >> l) | (x << (32-l)); }
+	.loc 1 5 60 is_stmt 0 view .LVU557
+	rorl	$12, %ebp	#, _218
+.LVL100:
+	.loc 1 5 60 view .LVU558
+.LBE1404:
+.LBE1403:
+# blake2s-generic.c:51:     FULLROUND(1);
+	.loc 1 51 1380 view .LVU559
+	movl	%ebp, 20(%rax)	# _218, MEM[(u32 *)v_1(D) + 20B]
+	.loc 1 51 1410 is_stmt 1 view .LVU560
+# blake2s-generic.c:51:     FULLROUND(1);
+	.loc 1 51 1418 is_stmt 0 view .LVU561
+	addl	48(%r9), %r8d	# MEM[(const u32 *)m_4(D) + 48B], tmp1488
+	addl	%ebp, %r8d	# _218, _221
+# blake2s-generic.c:51:     FULLROUND(1);
+	.loc 1 51 1471 view .LVU562
+	xorl	%r8d, %r12d	# _221, tmp1490
+# blake2s-generic.c:51:     FULLROUND(1);
+	.loc 1 51 1418 view .LVU563
+	movl	%r8d, (%rax)	# _221, *v_1(D)
+	.loc 1 51 1461 is_stmt 1 view .LVU564
+.LVL101:
+.LBB1405:
+.LBI1405:
+	.loc 1 5 19 view .LVU565
+.LBB1406:
+	.loc 1 5 44 view .LVU566
+# blake2s-generic.c:5: static inline u32 ror(unsigned l, u32 x) { return (x >> l) | (x << (32-l)); }
+	.loc 1 5 60 is_stmt 0 view .LVU567
+	rorl	$8, %r12d	#, tmp1490
+.LBE1406:
+.LBE1405:
+# blake2s-generic.c:51:     FULLROUND(1);
+	.loc 1 51 1507 view .LVU568
+	addl	%r12d, %r14d	# _223, _224
+# blake2s-generic.c:51:     FULLROUND(1);
+	.loc 1 51 1469 view .LVU569
+	movl	%r12d, 60(%rax)	# _223, MEM[(u32 *)v_1(D) + 60B]
+	.loc 1 51 1499 is_stmt 1 view .LVU570
+# blake2s-generic.c:51:     FULLROUND(1);
+	.loc 1 51 1529 is_stmt 0 view .LVU571
+	xorl	%r14d, %ebp	# _224, tmp1491
+# blake2s-generic.c:51:     FULLROUND(1);
+	.loc 1 51 1507 view .LVU572
+	movl	%r14d, 40(%rax)	# _224, MEM[(u32 *)v_1(D) + 40B]
+	.loc 1 51 1519 is_stmt 1 view .LVU573
+.LVL102:
+.LBB1407:
+.LBI1407:
+	.loc 1 5 19 view .LVU574
+.LBB1408:
+	.loc 1 5 44 view .LVU575
+# blake2s-generic.c:5: static inline u32 ror(unsigned l, u32 x) { return (x >> l) | (x << (32-l)); }
+	.loc 1 5 60 is_stmt 0 view .LVU576
+	rorl	$7, %ebp	#, _226
+.LVL103:
+	.loc 1 5 60 view .LVU577
+.LBE1408:
+.LBE1407:
+# blake2s-generic.c:51:     FULLROUND(1);
+	.loc 1 51 1529 view .LVU578
+	movl	%r14d, -12(%rsp)	# _224, %sfp
+# blake2s-generic.c:51:     FULLROUND(1);
+	.loc 1 51 1987 view .LVU579
+	movl	-28(%rsp), %r14d	# %sfp, _160
+# blake2s-generic.c:51:     FULLROUND(1);
+	.loc 1 51 1527 view .LVU580
+	movl	%ebp, 20(%rax)	# _226, MEM[(u32 *)v_1(D) + 20B]
+	.loc 1 51 1261 is_stmt 1 view .LVU581
+	.loc 1 51 1570 view .LVU582
+	.loc 1 51 1575 view .LVU583
+# blake2s-generic.c:51:     FULLROUND(1);
+	.loc 1 51 1583 is_stmt 0 view .LVU584
+	addl	(%r9), %esi	# *m_4(D), tmp1492
+	addl	%ebx, %esi	# _194, _229
+# blake2s-generic.c:51:     FULLROUND(1);
+	.loc 1 51 1507 view .LVU585
+	movl	%r12d, -16(%rsp)	# _223, %sfp
+# blake2s-generic.c:51:     FULLROUND(1);
+	.loc 1 51 1637 view .LVU586
+	xorl	%esi, %edi	# _229, tmp1494
+# blake2s-generic.c:51:     FULLROUND(1);
+	.loc 1 51 1583 view .LVU587
+	movl	%esi, 4(%rax)	# _229, MEM[(u32 *)v_1(D) + 4B]
+	.loc 1 51 1627 is_stmt 1 view .LVU588
+.LVL104:
+.LBB1409:
+.LBI1409:
+	.loc 1 5 19 view .LVU589
+.LBB1410:
+	.loc 1 5 44 view .LVU590
+# blake2s-generic.c:5: static inline u32 ror(unsigned l, u32 x) { return (x >> l) | (x << (32-l)); }
+	.loc 1 5 60 is_stmt 0 view .LVU591
+	roll	$16, %edi	#, _231
+.LVL105:
+	.loc 1 5 60 view .LVU592
+.LBE1410:
+.LBE1409:
+# blake2s-generic.c:51:     FULLROUND(1);
+	.loc 1 51 1673 view .LVU593
+	addl	%edi, %r15d	# _231, _232
+# blake2s-generic.c:51:     FULLROUND(1);
+	.loc 1 51 1635 view .LVU594
+	movl	%edi, 48(%rax)	# _231, MEM[(u32 *)v_1(D) + 48B]
+	.loc 1 51 1665 is_stmt 1 view .LVU595
+# blake2s-generic.c:51:     FULLROUND(1);
+	.loc 1 51 1695 is_stmt 0 view .LVU596
+	xorl	%r15d, %ebx	# _232, tmp1495
+# blake2s-generic.c:51:     FULLROUND(1);
+	.loc 1 51 1673 view .LVU597
+	movl	%r15d, 44(%rax)	# _232, MEM[(u32 *)v_1(D) + 44B]
+	.loc 1 51 1685 is_stmt 1 view .LVU598
+.LVL106:
+.LBB1411:
+.LBI1411:
+	.loc 1 5 19 view .LVU599
+.LBB1412:
+	.loc 1 5 44 view .LVU600
+# blake2s-generic.c:5: static inline u32 ror(unsigned l, u32 x) { return (x >> l) | (x << (32-l)); }
+	.loc 1 5 60 is_stmt 0 view .LVU601
+	rorl	$12, %ebx	#, _234
+.LVL107:
+	.loc 1 5 60 view .LVU602
+.LBE1412:
+.LBE1411:
+# blake2s-generic.c:51:     FULLROUND(1);
+	.loc 1 51 1693 view .LVU603
+	movl	%ebx, 24(%rax)	# _234, MEM[(u32 *)v_1(D) + 24B]
+	.loc 1 51 1723 is_stmt 1 view .LVU604
+# blake2s-generic.c:51:     FULLROUND(1);
+	.loc 1 51 1731 is_stmt 0 view .LVU605
+	addl	8(%r9), %esi	# MEM[(const u32 *)m_4(D) + 8B], tmp1496
+	addl	%ebx, %esi	# _234, _237
+# blake2s-generic.c:51:     FULLROUND(1);
+	.loc 1 51 1785 view .LVU606
+	xorl	%esi, %edi	# _237, tmp1498
+# blake2s-generic.c:51:     FULLROUND(1);
+	.loc 1 51 1731 view .LVU607
+	movl	%esi, 4(%rax)	# _237, MEM[(u32 *)v_1(D) + 4B]
+	.loc 1 51 1775 is_stmt 1 view .LVU608
+.LVL108:
+.LBB1413:
+.LBI1413:
+	.loc 1 5 19 view .LVU609
+.LBB1414:
+	.loc 1 5 44 view .LVU610
+# blake2s-generic.c:5: static inline u32 ror(unsigned l, u32 x) { return (x >> l) | (x << (32-l)); }
+	.loc 1 5 60 is_stmt 0 view .LVU611
+	rorl	$8, %edi	#, _239
+.LVL109:
+	.loc 1 5 60 view .LVU612
+.LBE1414:
+.LBE1413:
+# blake2s-generic.c:51:     FULLROUND(1);
+	.loc 1 51 1821 view .LVU613
+	addl	%edi, %r15d	# _239, _240
+# blake2s-generic.c:51:     FULLROUND(1);
+	.loc 1 51 1783 view .LVU614
+	movl	%edi, 48(%rax)	# _239, MEM[(u32 *)v_1(D) + 48B]
+	.loc 1 51 1813 is_stmt 1 view .LVU615
+# blake2s-generic.c:51:     FULLROUND(1);
+	.loc 1 51 1843 is_stmt 0 view .LVU616
+	xorl	%r15d, %ebx	# _240, tmp1499
+# blake2s-generic.c:51:     FULLROUND(1);
+	.loc 1 51 1821 view .LVU617
+	movl	%r15d, 44(%rax)	# _240, MEM[(u32 *)v_1(D) + 44B]
+	.loc 1 51 1833 is_stmt 1 view .LVU618
+.LVL110:
+.LBB1415:
+.LBI1415:
+	.loc 1 5 19 view .LVU619
+.LBB1416:
+	.loc 1 5 44 view .LVU620
+# blake2s-generic.c:5: static inline u32 ror(unsigned l, u32 x) { return (x >> l) | (x << (32-l)); }
+	.loc 1 5 60 is_stmt 0 view .LVU621
+	rorl	$7, %ebx	#, _242
+.LVL111:
+	.loc 1 5 60 view .LVU622
+.LBE1416:
+.LBE1415:
+# blake2s-generic.c:51:     FULLROUND(1);
+	.loc 1 51 1843 view .LVU623
+	movl	%r15d, -8(%rsp)	# _240, %sfp
+# blake2s-generic.c:51:     FULLROUND(1);
+	.loc 1 51 2301 view .LVU624
+	movl	-20(%rsp), %r15d	# %sfp, _176
+# blake2s-generic.c:51:     FULLROUND(1);
+	.loc 1 51 1841 view .LVU625
+	movl	%ebx, 24(%rax)	# _242, MEM[(u32 *)v_1(D) + 24B]
+	.loc 1 51 1573 is_stmt 1 view .LVU626
+	.loc 1 51 1884 view .LVU627
+	.loc 1 51 1889 view .LVU628
+# blake2s-generic.c:51:     FULLROUND(1);
+	.loc 1 51 1897 is_stmt 0 view .LVU629
+	addl	44(%r9), %edx	# MEM[(const u32 *)m_4(D) + 44B], tmp1500
+	addl	%r11d, %edx	# _210, _245
+# blake2s-generic.c:51:     FULLROUND(1);
+	.loc 1 51 1951 view .LVU630
+	xorl	%edx, %ecx	# _245, tmp1502
+# blake2s-generic.c:51:     FULLROUND(1);
+	.loc 1 51 1897 view .LVU631
+	movl	%edx, 8(%rax)	# _245, MEM[(u32 *)v_1(D) + 8B]
+	.loc 1 51 1941 is_stmt 1 view .LVU632
+.LVL112:
+.LBB1417:
+.LBI1417:
+	.loc 1 5 19 view .LVU633
+.LBB1418:
+	.loc 1 5 44 view .LVU634
+# blake2s-generic.c:5: static inline u32 ror(unsigned l, u32 x) { return (x >> l) | (x << (32-l)); }
+	.loc 1 5 60 is_stmt 0 view .LVU635
+	roll	$16, %ecx	#, _247
+.LVL113:
+	.loc 1 5 60 view .LVU636
+.LBE1418:
+.LBE1417:
+# blake2s-generic.c:51:     FULLROUND(1);
+	.loc 1 51 1987 view .LVU637
+	leal	(%r14,%rcx), %r12d	#, _248
+# blake2s-generic.c:51:     FULLROUND(1);
+	.loc 1 51 1949 view .LVU638
+	movl	%ecx, 52(%rax)	# _247, MEM[(u32 *)v_1(D) + 52B]
+	.loc 1 51 1979 is_stmt 1 view .LVU639
+# blake2s-generic.c:51:     FULLROUND(1);
+	.loc 1 51 2211 is_stmt 0 view .LVU640
+	movl	-24(%rsp), %r14d	# %sfp, _162
+# blake2s-generic.c:51:     FULLROUND(1);
+	.loc 1 51 2009 view .LVU641
+	xorl	%r12d, %r11d	# _248, tmp1503
+# blake2s-generic.c:51:     FULLROUND(1);
+	.loc 1 51 1987 view .LVU642
+	movl	%r12d, 32(%rax)	# _248, MEM[(u32 *)v_1(D) + 32B]
+	.loc 1 51 1999 is_stmt 1 view .LVU643
+.LVL114:
+.LBB1419:
+.LBI1419:
+	.loc 1 5 19 view .LVU644
+.LBB1420:
+	.loc 1 5 44 view .LVU645
+# blake2s-generic.c:5: static inline u32 ror(unsigned l, u32 x) { return (x >> l) | (x << (32-l)); }
+	.loc 1 5 60 is_stmt 0 view .LVU646
+	rorl	$12, %r11d	#, _250
+.LVL115:
+	.loc 1 5 60 view .LVU647
+.LBE1420:
+.LBE1419:
+# blake2s-generic.c:51:     FULLROUND(1);
+	.loc 1 51 2007 view .LVU648
+	movl	%r11d, 28(%rax)	# _250, MEM[(u32 *)v_1(D) + 28B]
+	.loc 1 51 2037 is_stmt 1 view .LVU649
+# blake2s-generic.c:51:     FULLROUND(1);
+	.loc 1 51 2045 is_stmt 0 view .LVU650
+	addl	28(%r9), %edx	# MEM[(const u32 *)m_4(D) + 28B], tmp1504
+	addl	%r11d, %edx	# _250, _253
+# blake2s-generic.c:51:     FULLROUND(1);
+	.loc 1 51 2099 view .LVU651
+	xorl	%edx, %ecx	# _253, tmp1506
+# blake2s-generic.c:51:     FULLROUND(1);
+	.loc 1 51 2045 view .LVU652
+	movl	%edx, 8(%rax)	# _253, MEM[(u32 *)v_1(D) + 8B]
+	.loc 1 51 2089 is_stmt 1 view .LVU653
+.LVL116:
+.LBB1421:
+.LBI1421:
+	.loc 1 5 19 view .LVU654
+.LBB1422:
+	.loc 1 5 44 view .LVU655
+# blake2s-generic.c:5: static inline u32 ror(unsigned l, u32 x) { return (x >> l) | (x << (32-l)); }
+	.loc 1 5 60 is_stmt 0 view .LVU656
+	rorl	$8, %ecx	#, _255
+.LVL117:
+	.loc 1 5 60 view .LVU657
+.LBE1422:
+.LBE1421:
+# blake2s-generic.c:51:     FULLROUND(1);
+	.loc 1 51 2135 view .LVU658
+	addl	%ecx, %r12d	# _255, _256
+# blake2s-generic.c:51:     FULLROUND(1);
+	.loc 1 51 2097 view .LVU659
+	movl	%ecx, 52(%rax)	# _255, MEM[(u32 *)v_1(D) + 52B]
+	.loc 1 51 2127 is_stmt 1 view .LVU660
+# blake2s-generic.c:51:     FULLROUND(1);
+	.loc 1 51 2157 is_stmt 0 view .LVU661
+	xorl	%r12d, %r11d	# _256, tmp1507
+# blake2s-generic.c:51:     FULLROUND(1);
+	.loc 1 51 2135 view .LVU662
+	movl	%r12d, 32(%rax)	# _256, MEM[(u32 *)v_1(D) + 32B]
+	.loc 1 51 2147 is_stmt 1 view .LVU663
+.LVL118:
+.LBB1423:
+.LBI1423:
+	.loc 1 5 19 view .LVU664
+.LBB1424:
+	.loc 1 5 44 view .LVU665
+# blake2s-generic.c:5: static inline u32 ror(unsigned l, u32 x) { return (x >> l) | (x << (32-l)); }
+	.loc 1 5 60 is_stmt 0 view .LVU666
+	rorl	$7, %r11d	#, _258
+.LVL119:
+	.loc 1 5 60 view .LVU667
+.LBE1424:
+.LBE1423:
+# blake2s-generic.c:51:     FULLROUND(1);
+	.loc 1 51 2155 view .LVU668
+	movl	%r11d, 28(%rax)	# _258, MEM[(u32 *)v_1(D) + 28B]
+	.loc 1 51 1887 is_stmt 1 view .LVU669
+	.loc 1 51 2198 view .LVU670
+	.loc 1 51 2203 view .LVU671
+# blake2s-generic.c:51:     FULLROUND(1);
+	.loc 1 51 2211 is_stmt 0 view .LVU672
+	addl	20(%r9), %r10d	# MEM[(const u32 *)m_4(D) + 20B], tmp1508
+	addl	%r14d, %r10d	# _162, _261
+# blake2s-generic.c:51:     FULLROUND(1);
+	.loc 1 51 2265 view .LVU673
+	xorl	%r10d, %r13d	# _261, tmp1510
+# blake2s-generic.c:51:     FULLROUND(1);
+	.loc 1 51 2211 view .LVU674
+	movl	%r10d, 12(%rax)	# _261, MEM[(u32 *)v_1(D) + 12B]
+	.loc 1 51 2255 is_stmt 1 view .LVU675
+.LVL120:
+.LBB1425:
+.LBI1425:
+	.loc 1 5 19 view .LVU676
+.LBB1426:
+	.loc 1 5 44 view .LVU677
+# blake2s-generic.c:5: static inline u32 ror(unsigned l, u32 x) { return (x >> l) | (x << (32-l)); }
+	.loc 1 5 60 is_stmt 0 view .LVU678
+	roll	$16, %r13d	#, _263
+.LVL121:
+	.loc 1 5 60 view .LVU679
+.LBE1426:
+.LBE1425:
+# blake2s-generic.c:51:     FULLROUND(1);
+	.loc 1 51 2301 view .LVU680
+	addl	%r13d, %r15d	# _263, _264
+# blake2s-generic.c:51:     FULLROUND(1);
+	.loc 1 51 2263 view .LVU681
+	movl	%r13d, 56(%rax)	# _263, MEM[(u32 *)v_1(D) + 56B]
+	.loc 1 51 2293 is_stmt 1 view .LVU682
+# blake2s-generic.c:51:     FULLROUND(1);
+	.loc 1 51 2323 is_stmt 0 view .LVU683
+	xorl	%r15d, %r14d	# _264, _162
+# blake2s-generic.c:51:     FULLROUND(1);
+	.loc 1 51 2301 view .LVU684
+	movl	%r15d, 36(%rax)	# _264, MEM[(u32 *)v_1(D) + 36B]
+	.loc 1 51 2313 is_stmt 1 view .LVU685
+.LVL122:
+.LBB1427:
+.LBI1427:
+	.loc 1 5 19 view .LVU686
+.LBB1428:
+	.loc 1 5 44 view .LVU687
+# blake2s-generic.c:5: static inline u32 ror(unsigned l, u32 x) { return (x >> l) | (x << (32-l)); }
+	.loc 1 5 60 is_stmt 0 view .LVU688
+	rorl	$12, %r14d	#, _266
+.LVL123:
+	.loc 1 5 60 view .LVU689
+.LBE1428:
+.LBE1427:
+# blake2s-generic.c:51:     FULLROUND(1);
+	.loc 1 51 2321 view .LVU690
+	movl	%r14d, 16(%rax)	# _266, MEM[(u32 *)v_1(D) + 16B]
+	.loc 1 51 2351 is_stmt 1 view .LVU691
+# blake2s-generic.c:51:     FULLROUND(1);
+	.loc 1 51 2359 is_stmt 0 view .LVU692
+	addl	12(%r9), %r10d	# MEM[(const u32 *)m_4(D) + 12B], tmp1512
+	addl	%r14d, %r10d	# _266, _269
+# blake2s-generic.c:51:     FULLROUND(1);
+	.loc 1 51 2413 view .LVU693
+	xorl	%r10d, %r13d	# _269, tmp1514
+# blake2s-generic.c:51:     FULLROUND(1);
+	.loc 1 51 2359 view .LVU694
+	movl	%r10d, 12(%rax)	# _269, MEM[(u32 *)v_1(D) + 12B]
+	.loc 1 51 2403 is_stmt 1 view .LVU695
+.LVL124:
+.LBB1429:
+.LBI1429:
+	.loc 1 5 19 view .LVU696
+.LBB1430:
+	.loc 1 5 44 view .LVU697
+# blake2s-generic.c:5: static inline u32 ror(unsigned l, u32 x) { return (x >> l) | (x << (32-l)); }
+	.loc 1 5 60 is_stmt 0 view .LVU698
+	rorl	$8, %r13d	#, _271
+.LVL125:
+	.loc 1 5 60 view .LVU699
+.LBE1430:
+.LBE1429:
+# blake2s-generic.c:51:     FULLROUND(1);
+	.loc 1 51 2449 view .LVU700
+	addl	%r13d, %r15d	# _271, _272
+# blake2s-generic.c:51:     FULLROUND(1);
+	.loc 1 51 2411 view .LVU701
+	movl	%r13d, 56(%rax)	# _271, MEM[(u32 *)v_1(D) + 56B]
+	.loc 1 51 2441 is_stmt 1 view .LVU702
+# blake2s-generic.c:51:     FULLROUND(1);
+	.loc 1 51 2471 is_stmt 0 view .LVU703
+	xorl	%r15d, %r14d	# _272, tmp1515
+# blake2s-generic.c:51:     FULLROUND(1);
+	.loc 1 51 2449 view .LVU704
+	movl	%r15d, 36(%rax)	# _272, MEM[(u32 *)v_1(D) + 36B]
+	.loc 1 51 2461 is_stmt 1 view .LVU705
+.LVL126:
+.LBB1431:
+.LBI1431:
+	.loc 1 5 19 view .LVU706
+.LBB1432:
+	.loc 1 5 44 view .LVU707
+# blake2s-generic.c:5: static inline u32 ror(unsigned l, u32 x) { return (x >> l) | (x << (32-l)); }
+	.loc 1 5 60 is_stmt 0 view .LVU708
+	rorl	$7, %r14d	#, _274
+.LVL127:
+	.loc 1 5 60 view .LVU709
+.LBE1432:
+.LBE1431:
+# blake2s-generic.c:51:     FULLROUND(1);
+	.loc 1 51 2469 view .LVU710
+	movl	%r14d, 16(%rax)	# _274, MEM[(u32 *)v_1(D) + 16B]
+	.loc 1 51 2201 is_stmt 1 view .LVU711
+	.loc 1 51 8 view .LVU712
+	.loc 1 52 5 view .LVU713
+	.loc 1 52 10 view .LVU714
+	.loc 1 52 15 view .LVU715
+# blake2s-generic.c:52:     FULLROUND(2);
+	.loc 1 52 23 is_stmt 0 view .LVU716
+	addl	44(%r9), %r8d	# MEM[(const u32 *)m_4(D) + 44B], tmp1516
+	addl	%r14d, %r8d	# _274, _277
+# blake2s-generic.c:52:     FULLROUND(2);
+	.loc 1 52 76 view .LVU717
+	xorl	%r8d, %edi	# _277, tmp1518
+# blake2s-generic.c:52:     FULLROUND(2);
+	.loc 1 52 23 view .LVU718
+	movl	%r8d, (%rax)	# _277, *v_1(D)
+	.loc 1 52 66 is_stmt 1 view .LVU719
+.LVL128:
+.LBB1433:
+.LBI1433:
+	.loc 1 5 19 view .LVU720
+.LBB1434:
+	.loc 1 5 44 view .LVU721
+# blake2s-generic.c:5: static inline u32 ror(unsigned l, u32 x) { return (x >> l) | (x << (32-l)); }
+	.loc 1 5 60 is_stmt 0 view .LVU722
+	roll	$16, %edi	#, _279
+.LVL129:
+	.loc 1 5 60 view .LVU723
+.LBE1434:
+.LBE1433:
+# blake2s-generic.c:52:     FULLROUND(2);
+	.loc 1 52 112 view .LVU724
+	addl	%edi, %r12d	# _279, _280
+# blake2s-generic.c:52:     FULLROUND(2);
+	.loc 1 52 74 view .LVU725
+	movl	%edi, 48(%rax)	# _279, MEM[(u32 *)v_1(D) + 48B]
+	.loc 1 52 104 is_stmt 1 view .LVU726
+# blake2s-generic.c:52:     FULLROUND(2);
+	.loc 1 52 134 is_stmt 0 view .LVU727
+	xorl	%r12d, %r14d	# _280, tmp1519
+# blake2s-generic.c:52:     FULLROUND(2);
+	.loc 1 52 112 view .LVU728
+	movl	%r12d, 32(%rax)	# _280, MEM[(u32 *)v_1(D) + 32B]
+	.loc 1 52 124 is_stmt 1 view .LVU729
+.LVL130:
+.LBB1435:
+.LBI1435:
+	.loc 1 5 19 view .LVU730
+.LBB1436:
+	.loc 1 5 44 view .LVU731
+# blake2s-generic.c:5: static inline u32 ror(unsigned l, u32 x) { return (x >> l) | (x << (32-l)); }
+	.loc 1 5 60 is_stmt 0 view .LVU732
+	rorl	$12, %r14d	#, _282
+.LVL131:
+	.loc 1 5 60 view .LVU733
+.LBE1436:
+.LBE1435:
+# blake2s-generic.c:52:     FULLROUND(2);
+	.loc 1 52 132 view .LVU734
+	movl	%r14d, 16(%rax)	# _282, MEM[(u32 *)v_1(D) + 16B]
+	.loc 1 52 162 is_stmt 1 view .LVU735
+# blake2s-generic.c:52:     FULLROUND(2);
+	.loc 1 52 170 is_stmt 0 view .LVU736
+	addl	32(%r9), %r8d	# MEM[(const u32 *)m_4(D) + 32B], tmp1520
+	addl	%r14d, %r8d	# _282, _285
+# blake2s-generic.c:52:     FULLROUND(2);
+	.loc 1 52 223 view .LVU737
+	xorl	%r8d, %edi	# _285, tmp1522
+# blake2s-generic.c:52:     FULLROUND(2);
+	.loc 1 52 170 view .LVU738
+	movl	%r8d, (%rax)	# _285, *v_1(D)
+	.loc 1 52 213 is_stmt 1 view .LVU739
+.LVL132:
+.LBB1437:
+.LBI1437:
+	.loc 1 5 19 view .LVU740
+.LBB1438:
+	.loc 1 5 44 view .LVU741
+# blake2s-generic.c:5: static inline u32 ror(unsigned l, u32 x) { return (x >> l) | (x << (32-l)); }
+	.loc 1 5 60 is_stmt 0 view .LVU742
+	rorl	$8, %edi	#, _287
+.LVL133:
+	.loc 1 5 60 view .LVU743
+.LBE1438:
+.LBE1437:
+# blake2s-generic.c:52:     FULLROUND(2);
+	.loc 1 52 259 view .LVU744
+	addl	%edi, %r12d	# _287, _288
+# blake2s-generic.c:52:     FULLROUND(2);
+	.loc 1 52 221 view .LVU745
+	movl	%edi, 48(%rax)	# _287, MEM[(u32 *)v_1(D) + 48B]
+	.loc 1 52 251 is_stmt 1 view .LVU746
+# blake2s-generic.c:52:     FULLROUND(2);
+	.loc 1 52 281 is_stmt 0 view .LVU747
+	xorl	%r12d, %r14d	# _288, tmp1523
+# blake2s-generic.c:52:     FULLROUND(2);
+	.loc 1 52 259 view .LVU748
+	movl	%r12d, 32(%rax)	# _288, MEM[(u32 *)v_1(D) + 32B]
+	.loc 1 52 271 is_stmt 1 view .LVU749
+.LVL134:
+.LBB1439:
+.LBI1439:
+	.loc 1 5 19 view .LVU750
+.LBB1440:
+	.loc 1 5 44 view .LVU751
+# blake2s-generic.c:5: static inline u32 ror(unsigned l, u32 x) { return (x >> l) | (x << (32-l)); }
+	.loc 1 5 60 is_stmt 0 view .LVU752
+	rorl	$7, %r14d	#, tmp1523
+.LBE1440:
+.LBE1439:
+# blake2s-generic.c:52:     FULLROUND(2);
+	.loc 1 52 281 view .LVU753
+	movl	%r12d, -28(%rsp)	# _288, %sfp
+# blake2s-generic.c:52:     FULLROUND(2);
+	.loc 1 52 279 view .LVU754
+	movl	%r14d, 16(%rax)	# _290, MEM[(u32 *)v_1(D) + 16B]
+	.loc 1 52 13 is_stmt 1 view .LVU755
+	.loc 1 52 322 view .LVU756
+	.loc 1 52 327 view .LVU757
+# blake2s-generic.c:52:     FULLROUND(2);
+	.loc 1 52 335 is_stmt 0 view .LVU758
+	addl	48(%r9), %esi	# MEM[(const u32 *)m_4(D) + 48B], tmp1524
+	addl	%ebp, %esi	# _226, _293
+# blake2s-generic.c:52:     FULLROUND(2);
+	.loc 1 52 279 view .LVU759
+	movl	%r14d, -24(%rsp)	# _290, %sfp
+# blake2s-generic.c:52:     FULLROUND(2);
+	.loc 1 52 388 view .LVU760
+	xorl	%esi, %ecx	# _293, tmp1526
+# blake2s-generic.c:52:     FULLROUND(2);
+	.loc 1 52 335 view .LVU761
+	movl	%esi, 4(%rax)	# _293, MEM[(u32 *)v_1(D) + 4B]
+	.loc 1 52 378 is_stmt 1 view .LVU762
+.LVL135:
+.LBB1441:
+.LBI1441:
+	.loc 1 5 19 view .LVU763
+.LBB1442:
+	.loc 1 5 44 view .LVU764
+# blake2s-generic.c:5: static inline u32 ror(unsigned l, u32 x) { return (x >> l) | (x << (32-l)); }
+	.loc 1 5 60 is_stmt 0 view .LVU765
+	roll	$16, %ecx	#, _295
+.LVL136:
+	.loc 1 5 60 view .LVU766
+.LBE1442:
+.LBE1441:
+# blake2s-generic.c:52:     FULLROUND(2);
+	.loc 1 52 424 view .LVU767
+	addl	%ecx, %r15d	# _295, _296
+# blake2s-generic.c:52:     FULLROUND(2);
+	.loc 1 52 386 view .LVU768
+	movl	%ecx, 52(%rax)	# _295, MEM[(u32 *)v_1(D) + 52B]
+	.loc 1 52 416 is_stmt 1 view .LVU769
+# blake2s-generic.c:52:     FULLROUND(2);
+	.loc 1 52 446 is_stmt 0 view .LVU770
+	xorl	%r15d, %ebp	# _296, tmp1527
+# blake2s-generic.c:52:     FULLROUND(2);
+	.loc 1 52 424 view .LVU771
+	movl	%r15d, 36(%rax)	# _296, MEM[(u32 *)v_1(D) + 36B]
+	.loc 1 52 436 is_stmt 1 view .LVU772
+.LVL137:
+.LBB1443:
+.LBI1443:
+	.loc 1 5 19 view .LVU773
+.LBB1444:
+	.loc 1 5 44 view .LVU774
+# blake2s-generic.c:5: static inline u32 ror(unsigned l, u32 x) { return (x >> l) | (x << (32-l)); }
+	.loc 1 5 60 is_stmt 0 view .LVU775
+	rorl	$12, %ebp	#, _298
+.LVL138:
+	.loc 1 5 60 view .LVU776
+.LBE1444:
+.LBE1443:
+# blake2s-generic.c:52:     FULLROUND(2);
+	.loc 1 52 444 view .LVU777
+	movl	%ebp, 20(%rax)	# _298, MEM[(u32 *)v_1(D) + 20B]
+	.loc 1 52 474 is_stmt 1 view .LVU778
+# blake2s-generic.c:52:     FULLROUND(2);
+	.loc 1 52 482 is_stmt 0 view .LVU779
+	addl	(%r9), %esi	# *m_4(D), tmp1528
+	addl	%ebp, %esi	# _298, _301
+# blake2s-generic.c:52:     FULLROUND(2);
+	.loc 1 52 535 view .LVU780
+	xorl	%esi, %ecx	# _301, tmp1530
+# blake2s-generic.c:52:     FULLROUND(2);
+	.loc 1 52 482 view .LVU781
+	movl	%esi, 4(%rax)	# _301, MEM[(u32 *)v_1(D) + 4B]
+	.loc 1 52 525 is_stmt 1 view .LVU782
+.LVL139:
+.LBB1445:
+.LBI1445:
+	.loc 1 5 19 view .LVU783
+.LBB1446:
+	.loc 1 5 44 view .LVU784
+# blake2s-generic.c:5: static inline u32 ror(unsigned l, u32 x) { return (x >> l) | (x << (32-l)); }
+	.loc 1 5 60 is_stmt 0 view .LVU785
+	rorl	$8, %ecx	#, _303
+.LVL140:
+	.loc 1 5 60 view .LVU786
+.LBE1446:
+.LBE1445:
+# blake2s-generic.c:52:     FULLROUND(2);
+	.loc 1 52 571 view .LVU787
+	addl	%ecx, %r15d	# _303, _304
+# blake2s-generic.c:52:     FULLROUND(2);
+	.loc 1 52 533 view .LVU788
+	movl	%ecx, 52(%rax)	# _303, MEM[(u32 *)v_1(D) + 52B]
+	.loc 1 52 563 is_stmt 1 view .LVU789
+# blake2s-generic.c:52:     FULLROUND(2);
+	.loc 1 52 593 is_stmt 0 view .LVU790
+	xorl	%r15d, %ebp	# _304, tmp1531
+# blake2s-generic.c:52:     FULLROUND(2);
+	.loc 1 52 571 view .LVU791
+	movl	%r15d, 36(%rax)	# _304, MEM[(u32 *)v_1(D) + 36B]
+	.loc 1 52 583 is_stmt 1 view .LVU792
+.LVL141:
+.LBB1447:
+.LBI1447:
+	.loc 1 5 19 view .LVU793
+.LBB1448:
+	.loc 1 5 44 view .LVU794
+# blake2s-generic.c:5: static inline u32 ror(unsigned l, u32 x) { return (x >> l) | (x << (32-l)); }
+	.loc 1 5 60 is_stmt 0 view .LVU795
+	rorl	$7, %ebp	#, _306
+.LVL142:
+	.loc 1 5 60 view .LVU796
+.LBE1448:
+.LBE1447:
+# blake2s-generic.c:52:     FULLROUND(2);
+	.loc 1 52 593 view .LVU797
+	movl	%r15d, -20(%rsp)	# _304, %sfp
+# blake2s-generic.c:52:     FULLROUND(2);
+	.loc 1 52 591 view .LVU798
+	movl	%ebp, 20(%rax)	# _306, MEM[(u32 *)v_1(D) + 20B]
+	.loc 1 52 325 is_stmt 1 view .LVU799
+	.loc 1 52 634 view .LVU800
+	.loc 1 52 639 view .LVU801
+# blake2s-generic.c:52:     FULLROUND(2);
+	.loc 1 52 647 is_stmt 0 view .LVU802
+	addl	20(%r9), %edx	# MEM[(const u32 *)m_4(D) + 20B], tmp1532
+	addl	%ebx, %edx	# _242, _309
+# blake2s-generic.c:52:     FULLROUND(2);
+	.loc 1 52 700 view .LVU803
+	xorl	%edx, %r13d	# _309, tmp1534
+# blake2s-generic.c:52:     FULLROUND(2);
+	.loc 1 52 647 view .LVU804
+	movl	%edx, 8(%rax)	# _309, MEM[(u32 *)v_1(D) + 8B]
+	.loc 1 52 690 is_stmt 1 view .LVU805
+.LVL143:
+.LBB1449:
+.LBI1449:
+	.loc 1 5 19 view .LVU806
+.LBB1450:
+	.loc 1 5 44 view .LVU807
+# blake2s-generic.c:5: static inline u32 ror(unsigned l, u32 x) { return (x >> l) | (x << (32-l)); }
+	.loc 1 5 60 is_stmt 0 view .LVU808
+	roll	$16, %r13d	#, _311
+.LVL144:
+	.loc 1 5 60 view .LVU809
+.LBE1450:
+.LBE1449:
+# blake2s-generic.c:52:     FULLROUND(2);
+	.loc 1 52 698 view .LVU810
+	movl	%r13d, 56(%rax)	# _311, MEM[(u32 *)v_1(D) + 56B]
+	.loc 1 52 728 is_stmt 1 view .LVU811
+# blake2s-generic.c:52:     FULLROUND(2);
+	.loc 1 52 736 is_stmt 0 view .LVU812
+	movl	-12(%rsp), %r15d	# %sfp, _224
+# blake2s-generic.c:52:     FULLROUND(2);
+	.loc 1 52 1012 view .LVU813
+	movl	-16(%rsp), %r12d	# %sfp, _223
+# blake2s-generic.c:52:     FULLROUND(2);
+	.loc 1 52 736 view .LVU814
+	leal	(%r15,%r13), %r14d	#, _312
+# blake2s-generic.c:52:     FULLROUND(2);
+	.loc 1 52 1048 view .LVU815
+	movl	-8(%rsp), %r15d	# %sfp, _240
+# blake2s-generic.c:52:     FULLROUND(2);
+	.loc 1 52 758 view .LVU816
+	xorl	%r14d, %ebx	# _312, tmp1535
+# blake2s-generic.c:52:     FULLROUND(2);
+	.loc 1 52 736 view .LVU817
+	movl	%r14d, 40(%rax)	# _312, MEM[(u32 *)v_1(D) + 40B]
+	.loc 1 52 748 is_stmt 1 view .LVU818
+.LVL145:
+.LBB1451:
+.LBI1451:
+	.loc 1 5 19 view .LVU819
+.LBB1452:
+	.loc 1 5 44 view .LVU820
+# blake2s-generic.c:5: static inline u32 ror(unsigned l, u32 x) { return (x >> l) | (x << (32-l)); }
+	.loc 1 5 60 is_stmt 0 view .LVU821
+	rorl	$12, %ebx	#, _314
+.LVL146:
+	.loc 1 5 60 view .LVU822
+.LBE1452:
+.LBE1451:
+# blake2s-generic.c:52:     FULLROUND(2);
+	.loc 1 52 756 view .LVU823
+	movl	%ebx, 24(%rax)	# _314, MEM[(u32 *)v_1(D) + 24B]
+	.loc 1 52 786 is_stmt 1 view .LVU824
+# blake2s-generic.c:52:     FULLROUND(2);
+	.loc 1 52 794 is_stmt 0 view .LVU825
+	addl	8(%r9), %edx	# MEM[(const u32 *)m_4(D) + 8B], tmp1536
+	addl	%ebx, %edx	# _314, _317
+# blake2s-generic.c:52:     FULLROUND(2);
+	.loc 1 52 847 view .LVU826
+	xorl	%edx, %r13d	# _317, tmp1538
+# blake2s-generic.c:52:     FULLROUND(2);
+	.loc 1 52 794 view .LVU827
+	movl	%edx, 8(%rax)	# _317, MEM[(u32 *)v_1(D) + 8B]
+	.loc 1 52 837 is_stmt 1 view .LVU828
+.LVL147:
+.LBB1453:
+.LBI1453:
+	.loc 1 5 19 view .LVU829
+.LBB1454:
+	.loc 1 5 44 view .LVU830
+# blake2s-generic.c:5: static inline u32 ror(unsigned l, u32 x) { return (x >> l) | (x << (32-l)); }
+	.loc 1 5 60 is_stmt 0 view .LVU831
+	rorl	$8, %r13d	#, _319
+.LVL148:
+	.loc 1 5 60 view .LVU832
+.LBE1454:
+.LBE1453:
+# blake2s-generic.c:52:     FULLROUND(2);
+	.loc 1 52 883 view .LVU833
+	addl	%r13d, %r14d	# _319, _320
+# blake2s-generic.c:52:     FULLROUND(2);
+	.loc 1 52 845 view .LVU834
+	movl	%r13d, 56(%rax)	# _319, MEM[(u32 *)v_1(D) + 56B]
+	.loc 1 52 875 is_stmt 1 view .LVU835
+# blake2s-generic.c:52:     FULLROUND(2);
+	.loc 1 52 905 is_stmt 0 view .LVU836
+	xorl	%r14d, %ebx	# _320, tmp1539
+# blake2s-generic.c:52:     FULLROUND(2);
+	.loc 1 52 883 view .LVU837
+	movl	%r14d, 40(%rax)	# _320, MEM[(u32 *)v_1(D) + 40B]
+	.loc 1 52 895 is_stmt 1 view .LVU838
+.LVL149:
+.LBB1455:
+.LBI1455:
+	.loc 1 5 19 view .LVU839
+.LBB1456:
+	.loc 1 5 44 view .LVU840
+# blake2s-generic.c:5: static inline u32 ror(unsigned l, u32 x) { return (x >> l) | (x << (32-l)); }
+	.loc 1 5 60 is_stmt 0 view .LVU841
+	rorl	$7, %ebx	#, _322
+.LVL150:
+	.loc 1 5 60 view .LVU842
+.LBE1456:
+.LBE1455:
+# blake2s-generic.c:52:     FULLROUND(2);
+	.loc 1 52 903 view .LVU843
+	movl	%ebx, 24(%rax)	# _322, MEM[(u32 *)v_1(D) + 24B]
+	.loc 1 52 637 is_stmt 1 view .LVU844
+	.loc 1 52 946 view .LVU845
+	.loc 1 52 951 view .LVU846
+# blake2s-generic.c:52:     FULLROUND(2);
+	.loc 1 52 959 is_stmt 0 view .LVU847
+	addl	60(%r9), %r10d	# MEM[(const u32 *)m_4(D) + 60B], tmp1540
+	addl	%r11d, %r10d	# _258, _325
+# blake2s-generic.c:52:     FULLROUND(2);
+	.loc 1 52 1012 view .LVU848
+	xorl	%r10d, %r12d	# _325, _223
+# blake2s-generic.c:52:     FULLROUND(2);
+	.loc 1 52 959 view .LVU849
+	movl	%r10d, 12(%rax)	# _325, MEM[(u32 *)v_1(D) + 12B]
+	.loc 1 52 1002 is_stmt 1 view .LVU850
+.LVL151:
+.LBB1457:
+.LBI1457:
+	.loc 1 5 19 view .LVU851
+.LBB1458:
+	.loc 1 5 44 view .LVU852
+# blake2s-generic.c:5: static inline u32 ror(unsigned l, u32 x) { return (x >> l) | (x << (32-l)); }
+	.loc 1 5 60 is_stmt 0 view .LVU853
+	roll	$16, %r12d	#, _327
+.LVL152:
+	.loc 1 5 60 view .LVU854
+.LBE1458:
+.LBE1457:
+# blake2s-generic.c:52:     FULLROUND(2);
+	.loc 1 52 1048 view .LVU855
+	addl	%r12d, %r15d	# _327, _328
+# blake2s-generic.c:52:     FULLROUND(2);
+	.loc 1 52 1010 view .LVU856
+	movl	%r12d, 60(%rax)	# _327, MEM[(u32 *)v_1(D) + 60B]
+	.loc 1 52 1040 is_stmt 1 view .LVU857
+# blake2s-generic.c:52:     FULLROUND(2);
+	.loc 1 52 1070 is_stmt 0 view .LVU858
+	xorl	%r15d, %r11d	# _328, tmp1543
+# blake2s-generic.c:52:     FULLROUND(2);
+	.loc 1 52 1048 view .LVU859
+	movl	%r15d, 44(%rax)	# _328, MEM[(u32 *)v_1(D) + 44B]
+	.loc 1 52 1060 is_stmt 1 view .LVU860
+.LVL153:
+.LBB1459:
+.LBI1459:
+	.loc 1 5 19 view .LVU861
+.LBB1460:
+	.loc 1 5 44 view .LVU862
+# blake2s-generic.c:5: static inline u32 ror(unsigned l, u32 x) { return (x >> l) | (x << (32-l)); }
+	.loc 1 5 60 is_stmt 0 view .LVU863
+	rorl	$12, %r11d	#, _330
+.LVL154:
+	.loc 1 5 60 view .LVU864
+.LBE1460:
+.LBE1459:
+# blake2s-generic.c:52:     FULLROUND(2);
+	.loc 1 52 1068 view .LVU865
+	movl	%r11d, 28(%rax)	# _330, MEM[(u32 *)v_1(D) + 28B]
+	.loc 1 52 1098 is_stmt 1 view .LVU866
+# blake2s-generic.c:52:     FULLROUND(2);
+	.loc 1 52 1106 is_stmt 0 view .LVU867
+	addl	52(%r9), %r10d	# MEM[(const u32 *)m_4(D) + 52B], tmp1544
+	addl	%r11d, %r10d	# _330, _333
+# blake2s-generic.c:52:     FULLROUND(2);
+	.loc 1 52 1159 view .LVU868
+	xorl	%r10d, %r12d	# _333, tmp1546
+# blake2s-generic.c:52:     FULLROUND(2);
+	.loc 1 52 1106 view .LVU869
+	movl	%r10d, 12(%rax)	# _333, MEM[(u32 *)v_1(D) + 12B]
+	.loc 1 52 1149 is_stmt 1 view .LVU870
+.LVL155:
+.LBB1461:
+.LBI1461:
+	.loc 1 5 19 view .LVU871
+.LBB1462:
+	.loc 1 5 44 view .LVU872
+# blake2s-generic.c:5: static inline u32 ror(unsigned l, u32 x) { return (x >> l) | (x << (32-l)); }
+	.loc 1 5 60 is_stmt 0 view .LVU873
+	rorl	$8, %r12d	#, _335
+.LVL156:
+	.loc 1 5 60 view .LVU874
+.LBE1462:
+.LBE1461:
+# blake2s-generic.c:52:     FULLROUND(2);
+	.loc 1 52 1195 view .LVU875
+	addl	%r12d, %r15d	# _335, _336
+# blake2s-generic.c:52:     FULLROUND(2);
+	.loc 1 52 1157 view .LVU876
+	movl	%r12d, 60(%rax)	# _335, MEM[(u32 *)v_1(D) + 60B]
+	.loc 1 52 1187 is_stmt 1 view .LVU877
+# blake2s-generic.c:52:     FULLROUND(2);
+	.loc 1 52 1217 is_stmt 0 view .LVU878
+	xorl	%r15d, %r11d	# _336, tmp1547
+# blake2s-generic.c:52:     FULLROUND(2);
+	.loc 1 52 1195 view .LVU879
+	movl	%r15d, 44(%rax)	# _336, MEM[(u32 *)v_1(D) + 44B]
+	.loc 1 52 1207 is_stmt 1 view .LVU880
+.LVL157:
+.LBB1463:
+.LBI1463:
+	.loc 1 5 19 view .LVU881
+.LBB1464:
+	.loc 1 5 44 view .LVU882
+# blake2s-generic.c:5: static inline u32 ror(unsigned l, u32 x) { return (x >> l) | (x << (32-l)); }
+	.loc 1 5 60 is_stmt 0 view .LVU883
+	rorl	$7, %r11d	#, _338
+.LVL158:
+	.loc 1 5 60 view .LVU884
+.LBE1464:
+.LBE1463:
+# blake2s-generic.c:52:     FULLROUND(2);
+	.loc 1 52 1215 view .LVU885
+	movl	%r11d, 28(%rax)	# _338, MEM[(u32 *)v_1(D) + 28B]
+	.loc 1 52 949 is_stmt 1 view .LVU886
+	.loc 1 52 1258 view .LVU887
+	.loc 1 52 1263 view .LVU888
+# blake2s-generic.c:52:     FULLROUND(2);
+	.loc 1 52 1271 is_stmt 0 view .LVU889
+	addl	40(%r9), %r8d	# MEM[(const u32 *)m_4(D) + 40B], tmp1548
+	addl	%ebp, %r8d	# _306, _341
+# blake2s-generic.c:52:     FULLROUND(2);
+	.loc 1 52 1324 view .LVU890
+	xorl	%r8d, %r12d	# _341, tmp1550
+# blake2s-generic.c:52:     FULLROUND(2);
+	.loc 1 52 1271 view .LVU891
+	movl	%r8d, (%rax)	# _341, *v_1(D)
+	.loc 1 52 1314 is_stmt 1 view .LVU892
+.LVL159:
+.LBB1465:
+.LBI1465:
+	.loc 1 5 19 view .LVU893
+.LBB1466:
+	.loc 1 5 44 view .LVU894
+# blake2s-generic.c:5: static inline u32 ror(unsigned l, u32 x) { return (x >> l) | (x << (32-l)); }
+	.loc 1 5 60 is_stmt 0 view .LVU895
+	roll	$16, %r12d	#, _343
+.LVL160:
+	.loc 1 5 60 view .LVU896
+.LBE1466:
+.LBE1465:
+# blake2s-generic.c:52:     FULLROUND(2);
+	.loc 1 52 1360 view .LVU897
+	addl	%r12d, %r14d	# _343, _344
+# blake2s-generic.c:52:     FULLROUND(2);
+	.loc 1 52 1322 view .LVU898
+	movl	%r12d, 60(%rax)	# _343, MEM[(u32 *)v_1(D) + 60B]
+	.loc 1 52 1352 is_stmt 1 view .LVU899
+# blake2s-generic.c:52:     FULLROUND(2);
+	.loc 1 52 1382 is_stmt 0 view .LVU900
+	xorl	%r14d, %ebp	# _344, tmp1551
+# blake2s-generic.c:52:     FULLROUND(2);
+	.loc 1 52 1360 view .LVU901
+	movl	%r14d, 40(%rax)	# _344, MEM[(u32 *)v_1(D) + 40B]
+	.loc 1 52 1372 is_stmt 1 view .LVU902
+.LVL161:
+.LBB1467:
+.LBI1467:
+	.loc 1 5 19 view .LVU903
+.LBB1468:
+	.loc 1 5 44 view .LVU904
+# blake2s-generic.c:5: static inline u32 ror(unsigned l, u32 x) { return (x >> l) | (x << (32-l)); }
+	.loc 1 5 60 is_stmt 0 view .LVU905
+	rorl	$12, %ebp	#, _346
+.LVL162:
+	.loc 1 5 60 view .LVU906
+.LBE1468:
+.LBE1467:
+# blake2s-generic.c:52:     FULLROUND(2);
+	.loc 1 52 1380 view .LVU907
+	movl	%ebp, 20(%rax)	# _346, MEM[(u32 *)v_1(D) + 20B]
+	.loc 1 52 1410 is_stmt 1 view .LVU908
+# blake2s-generic.c:52:     FULLROUND(2);
+	.loc 1 52 1418 is_stmt 0 view .LVU909
+	addl	56(%r9), %r8d	# MEM[(const u32 *)m_4(D) + 56B], tmp1552
+	addl	%ebp, %r8d	# _346, _349
+# blake2s-generic.c:52:     FULLROUND(2);
+	.loc 1 52 1471 view .LVU910
+	xorl	%r8d, %r12d	# _349, tmp1554
+# blake2s-generic.c:52:     FULLROUND(2);
+	.loc 1 52 1418 view .LVU911
+	movl	%r8d, (%rax)	# _349, *v_1(D)
+	.loc 1 52 1461 is_stmt 1 view .LVU912
+.LVL163:
+.LBB1469:
+.LBI1469:
+	.loc 1 5 19 view .LVU913
+.LBB1470:
+	.loc 1 5 44 view .LVU914
+# blake2s-generic.c:5: static inline u32 ror(unsigned l, u32 x) { return (x >> l) | (x << (32-l)); }
+	.loc 1 5 60 is_stmt 0 view .LVU915
+	rorl	$8, %r12d	#, tmp1554
+.LBE1470:
+.LBE1469:
+# blake2s-generic.c:52:     FULLROUND(2);
+	.loc 1 52 1507 view .LVU916
+	addl	%r12d, %r14d	# _351, _352
+	movl	%r12d, -16(%rsp)	# _351, %sfp
+# blake2s-generic.c:52:     FULLROUND(2);
+	.loc 1 52 1529 view .LVU917
+	xorl	%r14d, %ebp	# _352, tmp1555
+	movl	%r14d, -12(%rsp)	# _352, %sfp
+.LBB1471:
+.LBB1472:
+# blake2s-generic.c:5: static inline u32 ror(unsigned l, u32 x) { return (x >> l) | (x << (32-l)); }
+	.loc 1 5 60 view .LVU918
+	rorl	$7, %ebp	#, _354
+.LBE1472:
+.LBE1471:
+# blake2s-generic.c:52:     FULLROUND(2);
+	.loc 1 52 1469 view .LVU919
+	movl	%r12d, 60(%rax)	# _351, MEM[(u32 *)v_1(D) + 60B]
+	.loc 1 52 1499 is_stmt 1 view .LVU920
+# blake2s-generic.c:52:     FULLROUND(2);
+	.loc 1 52 1507 is_stmt 0 view .LVU921
+	movl	%r14d, 40(%rax)	# _352, MEM[(u32 *)v_1(D) + 40B]
+	.loc 1 52 1519 is_stmt 1 view .LVU922
+.LVL164:
+.LBB1474:
+.LBI1471:
+	.loc 1 5 19 view .LVU923
+.LBB1473:
+	.loc 1 5 44 view .LVU924
+	.loc 1 5 44 is_stmt 0 view .LVU925
+.LBE1473:
+.LBE1474:
+# blake2s-generic.c:52:     FULLROUND(2);
+	.loc 1 52 1527 view .LVU926
+	movl	%ebp, 20(%rax)	# _354, MEM[(u32 *)v_1(D) + 20B]
+	.loc 1 52 1261 is_stmt 1 view .LVU927
+	.loc 1 52 1570 view .LVU928
+	.loc 1 52 1575 view .LVU929
+# blake2s-generic.c:52:     FULLROUND(2);
+	.loc 1 52 1583 is_stmt 0 view .LVU930
+	addl	12(%r9), %esi	# MEM[(const u32 *)m_4(D) + 12B], tmp1556
+	addl	%ebx, %esi	# _322, _357
+# blake2s-generic.c:52:     FULLROUND(2);
+	.loc 1 52 2211 view .LVU931
+	movl	-24(%rsp), %r14d	# %sfp, _290
+# blake2s-generic.c:52:     FULLROUND(2);
+	.loc 1 52 1637 view .LVU932
+	xorl	%esi, %edi	# _357, tmp1558
+# blake2s-generic.c:52:     FULLROUND(2);
+	.loc 1 52 1583 view .LVU933
+	movl	%esi, 4(%rax)	# _357, MEM[(u32 *)v_1(D) + 4B]
+	.loc 1 52 1627 is_stmt 1 view .LVU934
+.LVL165:
+.LBB1475:
+.LBI1475:
+	.loc 1 5 19 view .LVU935
+.LBB1476:
+	.loc 1 5 44 view .LVU936
+# blake2s-generic.c:5: static inline u32 ror(unsigned l, u32 x) { return (x >> l) | (x << (32-l)); }
+	.loc 1 5 60 is_stmt 0 view .LVU937
+	roll	$16, %edi	#, _359
+.LVL166:
+	.loc 1 5 60 view .LVU938
+.LBE1476:
+.LBE1475:
+# blake2s-generic.c:52:     FULLROUND(2);
+	.loc 1 52 1673 view .LVU939
+	addl	%edi, %r15d	# _359, _360
+# blake2s-generic.c:52:     FULLROUND(2);
+	.loc 1 52 1635 view .LVU940
+	movl	%edi, 48(%rax)	# _359, MEM[(u32 *)v_1(D) + 48B]
+	.loc 1 52 1665 is_stmt 1 view .LVU941
+# blake2s-generic.c:52:     FULLROUND(2);
+	.loc 1 52 1695 is_stmt 0 view .LVU942
+	xorl	%r15d, %ebx	# _360, tmp1559
+# blake2s-generic.c:52:     FULLROUND(2);
+	.loc 1 52 1673 view .LVU943
+	movl	%r15d, 44(%rax)	# _360, MEM[(u32 *)v_1(D) + 44B]
+	.loc 1 52 1685 is_stmt 1 view .LVU944
+.LVL167:
+.LBB1477:
+.LBI1477:
+	.loc 1 5 19 view .LVU945
+.LBB1478:
+	.loc 1 5 44 view .LVU946
+# blake2s-generic.c:5: static inline u32 ror(unsigned l, u32 x) { return (x >> l) | (x << (32-l)); }
+	.loc 1 5 60 is_stmt 0 view .LVU947
+	rorl	$12, %ebx	#, _362
+.LVL168:
+	.loc 1 5 60 view .LVU948
+.LBE1478:
+.LBE1477:
+# blake2s-generic.c:52:     FULLROUND(2);
+	.loc 1 52 1693 view .LVU949
+	movl	%ebx, 24(%rax)	# _362, MEM[(u32 *)v_1(D) + 24B]
+	.loc 1 52 1723 is_stmt 1 view .LVU950
+# blake2s-generic.c:52:     FULLROUND(2);
+	.loc 1 52 1731 is_stmt 0 view .LVU951
+	addl	24(%r9), %esi	# MEM[(const u32 *)m_4(D) + 24B], tmp1560
+	addl	%ebx, %esi	# _362, _365
+# blake2s-generic.c:52:     FULLROUND(2);
+	.loc 1 52 1785 view .LVU952
+	xorl	%esi, %edi	# _365, tmp1562
+# blake2s-generic.c:52:     FULLROUND(2);
+	.loc 1 52 1731 view .LVU953
+	movl	%esi, 4(%rax)	# _365, MEM[(u32 *)v_1(D) + 4B]
+	.loc 1 52 1775 is_stmt 1 view .LVU954
+.LVL169:
+.LBB1479:
+.LBI1479:
+	.loc 1 5 19 view .LVU955
+.LBB1480:
+	.loc 1 5 44 view .LVU956
+# blake2s-generic.c:5: static inline u32 ror(unsigned l, u32 x) { return (x >> l) | (x << (32-l)); }
+	.loc 1 5 60 is_stmt 0 view .LVU957
+	rorl	$8, %edi	#, _367
+.LVL170:
+	.loc 1 5 60 view .LVU958
+.LBE1480:
+.LBE1479:
+# blake2s-generic.c:52:     FULLROUND(2);
+	.loc 1 52 1821 view .LVU959
+	addl	%edi, %r15d	# _367, _368
+# blake2s-generic.c:52:     FULLROUND(2);
+	.loc 1 52 1783 view .LVU960
+	movl	%edi, 48(%rax)	# _367, MEM[(u32 *)v_1(D) + 48B]
+	.loc 1 52 1813 is_stmt 1 view .LVU961
+# blake2s-generic.c:52:     FULLROUND(2);
+	.loc 1 52 1843 is_stmt 0 view .LVU962
+	xorl	%r15d, %ebx	# _368, tmp1563
+# blake2s-generic.c:52:     FULLROUND(2);
+	.loc 1 52 1821 view .LVU963
+	movl	%r15d, 44(%rax)	# _368, MEM[(u32 *)v_1(D) + 44B]
+	.loc 1 52 1833 is_stmt 1 view .LVU964
+.LVL171:
+.LBB1481:
+.LBI1481:
+	.loc 1 5 19 view .LVU965
+.LBB1482:
+	.loc 1 5 44 view .LVU966
+# blake2s-generic.c:5: static inline u32 ror(unsigned l, u32 x) { return (x >> l) | (x << (32-l)); }
+	.loc 1 5 60 is_stmt 0 view .LVU967
+	rorl	$7, %ebx	#, _370
+.LVL172:
+	.loc 1 5 60 view .LVU968
+.LBE1482:
+.LBE1481:
+# blake2s-generic.c:52:     FULLROUND(2);
+	.loc 1 52 1843 view .LVU969
+	movl	%r15d, -8(%rsp)	# _368, %sfp
+# blake2s-generic.c:52:     FULLROUND(2);
+	.loc 1 52 1987 view .LVU970
+	movl	-28(%rsp), %r15d	# %sfp, _288
+# blake2s-generic.c:52:     FULLROUND(2);
+	.loc 1 52 1841 view .LVU971
+	movl	%ebx, 24(%rax)	# _370, MEM[(u32 *)v_1(D) + 24B]
+	.loc 1 52 1573 is_stmt 1 view .LVU972
+	.loc 1 52 1884 view .LVU973
+	.loc 1 52 1889 view .LVU974
+# blake2s-generic.c:52:     FULLROUND(2);
+	.loc 1 52 1897 is_stmt 0 view .LVU975
+	addl	28(%r9), %edx	# MEM[(const u32 *)m_4(D) + 28B], tmp1564
+	addl	%r11d, %edx	# _338, _373
+# blake2s-generic.c:52:     FULLROUND(2);
+	.loc 1 52 1951 view .LVU976
+	xorl	%edx, %ecx	# _373, tmp1566
+# blake2s-generic.c:52:     FULLROUND(2);
+	.loc 1 52 1897 view .LVU977
+	movl	%edx, 8(%rax)	# _373, MEM[(u32 *)v_1(D) + 8B]
+	.loc 1 52 1941 is_stmt 1 view .LVU978
+.LVL173:
+.LBB1483:
+.LBI1483:
+	.loc 1 5 19 view .LVU979
+.LBB1484:
+	.loc 1 5 44 view .LVU980
+# blake2s-generic.c:5: static inline u32 ror(unsigned l, u32 x) { return (x >> l) | (x << (32-l)); }
+	.loc 1 5 60 is_stmt 0 view .LVU981
+	roll	$16, %ecx	#, _375
+.LVL174:
+	.loc 1 5 60 view .LVU982
+.LBE1484:
+.LBE1483:
+# blake2s-generic.c:52:     FULLROUND(2);
+	.loc 1 52 1987 view .LVU983
+	leal	(%r15,%rcx), %r12d	#, _376
+# blake2s-generic.c:52:     FULLROUND(2);
+	.loc 1 52 1949 view .LVU984
+	movl	%ecx, 52(%rax)	# _375, MEM[(u32 *)v_1(D) + 52B]
+	.loc 1 52 1979 is_stmt 1 view .LVU985
+# blake2s-generic.c:52:     FULLROUND(2);
+	.loc 1 52 2301 is_stmt 0 view .LVU986
+	movl	-20(%rsp), %r15d	# %sfp, _304
+# blake2s-generic.c:52:     FULLROUND(2);
+	.loc 1 52 2009 view .LVU987
+	xorl	%r12d, %r11d	# _376, tmp1567
+# blake2s-generic.c:52:     FULLROUND(2);
+	.loc 1 52 1987 view .LVU988
+	movl	%r12d, 32(%rax)	# _376, MEM[(u32 *)v_1(D) + 32B]
+	.loc 1 52 1999 is_stmt 1 view .LVU989
+.LVL175:
+.LBB1485:
+.LBI1485:
+	.loc 1 5 19 view .LVU990
+.LBB1486:
+	.loc 1 5 44 view .LVU991
+# blake2s-generic.c:5: static inline u32 ror(unsigned l, u32 x) { return (x >> l) | (x << (32-l)); }
+	.loc 1 5 60 is_stmt 0 view .LVU992
+	rorl	$12, %r11d	#, _378
+.LVL176:
+	.loc 1 5 60 view .LVU993
+.LBE1486:
+.LBE1485:
+# blake2s-generic.c:52:     FULLROUND(2);
+	.loc 1 52 2007 view .LVU994
+	movl	%r11d, 28(%rax)	# _378, MEM[(u32 *)v_1(D) + 28B]
+	.loc 1 52 2037 is_stmt 1 view .LVU995
+# blake2s-generic.c:52:     FULLROUND(2);
+	.loc 1 52 2045 is_stmt 0 view .LVU996
+	addl	4(%r9), %edx	# MEM[(const u32 *)m_4(D) + 4B], tmp1568
+	addl	%r11d, %edx	# _378, _381
+# blake2s-generic.c:52:     FULLROUND(2);
+	.loc 1 52 2099 view .LVU997
+	xorl	%edx, %ecx	# _381, tmp1570
+# blake2s-generic.c:52:     FULLROUND(2);
+	.loc 1 52 2045 view .LVU998
+	movl	%edx, 8(%rax)	# _381, MEM[(u32 *)v_1(D) + 8B]
+	.loc 1 52 2089 is_stmt 1 view .LVU999
+.LVL177:
+.LBB1487:
+.LBI1487:
+	.loc 1 5 19 view .LVU1000
+.LBB1488:
+	.loc 1 5 44 view .LVU1001
+# blake2s-generic.c:5: static inline u32 ror(unsigned l, u32 x) { return (x >> l) | (x << (32-l)); }
+	.loc 1 5 60 is_stmt 0 view .LVU1002
+	rorl	$8, %ecx	#, _383
+.LVL178:
+	.loc 1 5 60 view .LVU1003
+.LBE1488:
+.LBE1487:
+# blake2s-generic.c:52:     FULLROUND(2);
+	.loc 1 52 2135 view .LVU1004
+	addl	%ecx, %r12d	# _383, _384
+# blake2s-generic.c:52:     FULLROUND(2);
+	.loc 1 52 2097 view .LVU1005
+	movl	%ecx, 52(%rax)	# _383, MEM[(u32 *)v_1(D) + 52B]
+	.loc 1 52 2127 is_stmt 1 view .LVU1006
+# blake2s-generic.c:52:     FULLROUND(2);
+	.loc 1 52 2157 is_stmt 0 view .LVU1007
+	xorl	%r12d, %r11d	# _384, tmp1571
+# blake2s-generic.c:52:     FULLROUND(2);
+	.loc 1 52 2135 view .LVU1008
+	movl	%r12d, 32(%rax)	# _384, MEM[(u32 *)v_1(D) + 32B]
+	.loc 1 52 2147 is_stmt 1 view .LVU1009
+.LVL179:
+.LBB1489:
+.LBI1489:
+	.loc 1 5 19 view .LVU1010
+.LBB1490:
+	.loc 1 5 44 view .LVU1011
+# blake2s-generic.c:5: static inline u32 ror(unsigned l, u32 x) { return (x >> l) | (x << (32-l)); }
+	.loc 1 5 60 is_stmt 0 view .LVU1012
+	rorl	$7, %r11d	#, _386
+.LVL180:
+	.loc 1 5 60 view .LVU1013
+.LBE1490:
+.LBE1489:
+# blake2s-generic.c:52:     FULLROUND(2);
+	.loc 1 52 2155 view .LVU1014
+	movl	%r11d, 28(%rax)	# _386, MEM[(u32 *)v_1(D) + 28B]
+	.loc 1 52 1887 is_stmt 1 view .LVU1015
+	.loc 1 52 2198 view .LVU1016
+	.loc 1 52 2203 view .LVU1017
+# blake2s-generic.c:52:     FULLROUND(2);
+	.loc 1 52 2211 is_stmt 0 view .LVU1018
+	addl	36(%r9), %r10d	# MEM[(const u32 *)m_4(D) + 36B], tmp1572
+	addl	%r14d, %r10d	# _290, _389
+# blake2s-generic.c:52:     FULLROUND(2);
+	.loc 1 52 2265 view .LVU1019
+	xorl	%r10d, %r13d	# _389, tmp1574
+# blake2s-generic.c:52:     FULLROUND(2);
+	.loc 1 52 2211 view .LVU1020
+	movl	%r10d, 12(%rax)	# _389, MEM[(u32 *)v_1(D) + 12B]
+	.loc 1 52 2255 is_stmt 1 view .LVU1021
+.LVL181:
+.LBB1491:
+.LBI1491:
+	.loc 1 5 19 view .LVU1022
+.LBB1492:
+	.loc 1 5 44 view .LVU1023
+# blake2s-generic.c:5: static inline u32 ror(unsigned l, u32 x) { return (x >> l) | (x << (32-l)); }
+	.loc 1 5 60 is_stmt 0 view .LVU1024
+	roll	$16, %r13d	#, _391
+.LVL182:
+	.loc 1 5 60 view .LVU1025
+.LBE1492:
+.LBE1491:
+# blake2s-generic.c:52:     FULLROUND(2);
+	.loc 1 52 2301 view .LVU1026
+	addl	%r13d, %r15d	# _391, _392
+# blake2s-generic.c:52:     FULLROUND(2);
+	.loc 1 52 2263 view .LVU1027
+	movl	%r13d, 56(%rax)	# _391, MEM[(u32 *)v_1(D) + 56B]
+	.loc 1 52 2293 is_stmt 1 view .LVU1028
+# blake2s-generic.c:52:     FULLROUND(2);
+	.loc 1 52 2323 is_stmt 0 view .LVU1029
+	xorl	%r15d, %r14d	# _392, _290
+# blake2s-generic.c:52:     FULLROUND(2);
+	.loc 1 52 2301 view .LVU1030
+	movl	%r15d, 36(%rax)	# _392, MEM[(u32 *)v_1(D) + 36B]
+	.loc 1 52 2313 is_stmt 1 view .LVU1031
+.LVL183:
+.LBB1493:
+.LBI1493:
+	.loc 1 5 19 view .LVU1032
+.LBB1494:
+	.loc 1 5 44 view .LVU1033
+# blake2s-generic.c:5: static inline u32 ror(unsigned l, u32 x) { return (x >> l) | (x << (32-l)); }
+	.loc 1 5 60 is_stmt 0 view .LVU1034
+	rorl	$12, %r14d	#, _394
+.LVL184:
+	.loc 1 5 60 view .LVU1035
+.LBE1494:
+.LBE1493:
+# blake2s-generic.c:52:     FULLROUND(2);
+	.loc 1 52 2321 view .LVU1036
+	movl	%r14d, 16(%rax)	# _394, MEM[(u32 *)v_1(D) + 16B]
+	.loc 1 52 2351 is_stmt 1 view .LVU1037
+# blake2s-generic.c:52:     FULLROUND(2);
+	.loc 1 52 2359 is_stmt 0 view .LVU1038
+	addl	16(%r9), %r10d	# MEM[(const u32 *)m_4(D) + 16B], tmp1576
+	addl	%r14d, %r10d	# _394, _397
+# blake2s-generic.c:52:     FULLROUND(2);
+	.loc 1 52 2413 view .LVU1039
+	xorl	%r10d, %r13d	# _397, tmp1578
+# blake2s-generic.c:52:     FULLROUND(2);
+	.loc 1 52 2359 view .LVU1040
+	movl	%r10d, 12(%rax)	# _397, MEM[(u32 *)v_1(D) + 12B]
+	.loc 1 52 2403 is_stmt 1 view .LVU1041
+.LVL185:
+.LBB1495:
+.LBI1495:
+	.loc 1 5 19 view .LVU1042
+.LBB1496:
+	.loc 1 5 44 view .LVU1043
+# blake2s-generic.c:5: static inline u32 ror(unsigned l, u32 x) { return (x >> l) | (x << (32-l)); }
+	.loc 1 5 60 is_stmt 0 view .LVU1044
+	rorl	$8, %r13d	#, _399
+.LVL186:
+	.loc 1 5 60 view .LVU1045
+.LBE1496:
+.LBE1495:
+# blake2s-generic.c:52:     FULLROUND(2);
+	.loc 1 52 2449 view .LVU1046
+	addl	%r13d, %r15d	# _399, _400
+# blake2s-generic.c:52:     FULLROUND(2);
+	.loc 1 52 2411 view .LVU1047
+	movl	%r13d, 56(%rax)	# _399, MEM[(u32 *)v_1(D) + 56B]
+	.loc 1 52 2441 is_stmt 1 view .LVU1048
+# blake2s-generic.c:52:     FULLROUND(2);
+	.loc 1 52 2471 is_stmt 0 view .LVU1049
+	xorl	%r15d, %r14d	# _400, tmp1579
+# blake2s-generic.c:52:     FULLROUND(2);
+	.loc 1 52 2449 view .LVU1050
+	movl	%r15d, 36(%rax)	# _400, MEM[(u32 *)v_1(D) + 36B]
+	.loc 1 52 2461 is_stmt 1 view .LVU1051
+.LVL187:
+.LBB1497:
+.LBI1497:
+	.loc 1 5 19 view .LVU1052
+.LBB1498:
+	.loc 1 5 44 view .LVU1053
+# blake2s-generic.c:5: static inline u32 ror(unsigned l, u32 x) { return (x >> l) | (x << (32-l)); }
+	.loc 1 5 60 is_stmt 0 view .LVU1054
+	rorl	$7, %r14d	#, _402
+.LVL188:
+	.loc 1 5 60 view .LVU1055
+.LBE1498:
+.LBE1497:
+# blake2s-generic.c:52:     FULLROUND(2);
+	.loc 1 52 2469 view .LVU1056
+	movl	%r14d, 16(%rax)	# _402, MEM[(u32 *)v_1(D) + 16B]
+	.loc 1 52 2201 is_stmt 1 view .LVU1057
+	.loc 1 52 8 view .LVU1058
+	.loc 1 53 5 view .LVU1059
+	.loc 1 53 10 view .LVU1060
+	.loc 1 53 15 view .LVU1061
+# blake2s-generic.c:53:     FULLROUND(3);
+	.loc 1 53 23 is_stmt 0 view .LVU1062
+	addl	28(%r9), %r8d	# MEM[(const u32 *)m_4(D) + 28B], tmp1580
+	addl	%r14d, %r8d	# _402, _405
+# blake2s-generic.c:53:     FULLROUND(3);
+	.loc 1 53 76 view .LVU1063
+	xorl	%r8d, %edi	# _405, tmp1582
+# blake2s-generic.c:53:     FULLROUND(3);
+	.loc 1 53 23 view .LVU1064
+	movl	%r8d, (%rax)	# _405, *v_1(D)
+	.loc 1 53 66 is_stmt 1 view .LVU1065
+.LVL189:
+.LBB1499:
+.LBI1499:
+	.loc 1 5 19 view .LVU1066
+.LBB1500:
+	.loc 1 5 44 view .LVU1067
+# blake2s-generic.c:5: static inline u32 ror(unsigned l, u32 x) { return (x >> l) | (x << (32-l)); }
+	.loc 1 5 60 is_stmt 0 view .LVU1068
+	roll	$16, %edi	#, _407
+.LVL190:
+	.loc 1 5 60 view .LVU1069
+.LBE1500:
+.LBE1499:
+# blake2s-generic.c:53:     FULLROUND(3);
+	.loc 1 53 112 view .LVU1070
+	addl	%edi, %r12d	# _407, _408
+# blake2s-generic.c:53:     FULLROUND(3);
+	.loc 1 53 74 view .LVU1071
+	movl	%edi, 48(%rax)	# _407, MEM[(u32 *)v_1(D) + 48B]
+	.loc 1 53 104 is_stmt 1 view .LVU1072
+# blake2s-generic.c:53:     FULLROUND(3);
+	.loc 1 53 134 is_stmt 0 view .LVU1073
+	xorl	%r12d, %r14d	# _408, tmp1583
+# blake2s-generic.c:53:     FULLROUND(3);
+	.loc 1 53 112 view .LVU1074
+	movl	%r12d, 32(%rax)	# _408, MEM[(u32 *)v_1(D) + 32B]
+	.loc 1 53 124 is_stmt 1 view .LVU1075
+.LVL191:
+.LBB1501:
+.LBI1501:
+	.loc 1 5 19 view .LVU1076
+.LBB1502:
+	.loc 1 5 44 view .LVU1077
+# blake2s-generic.c:5: static inline u32 ror(unsigned l, u32 x) { return (x >> l) | (x << (32-l)); }
+	.loc 1 5 60 is_stmt 0 view .LVU1078
+	rorl	$12, %r14d	#, _410
+.LVL192:
+	.loc 1 5 60 view .LVU1079
+.LBE1502:
+.LBE1501:
+# blake2s-generic.c:53:     FULLROUND(3);
+	.loc 1 53 132 view .LVU1080
+	movl	%r14d, 16(%rax)	# _410, MEM[(u32 *)v_1(D) + 16B]
+	.loc 1 53 162 is_stmt 1 view .LVU1081
+# blake2s-generic.c:53:     FULLROUND(3);
+	.loc 1 53 170 is_stmt 0 view .LVU1082
+	addl	36(%r9), %r8d	# MEM[(const u32 *)m_4(D) + 36B], tmp1584
+	addl	%r14d, %r8d	# _410, _413
+# blake2s-generic.c:53:     FULLROUND(3);
+	.loc 1 53 223 view .LVU1083
+	xorl	%r8d, %edi	# _413, tmp1586
+# blake2s-generic.c:53:     FULLROUND(3);
+	.loc 1 53 170 view .LVU1084
+	movl	%r8d, (%rax)	# _413, *v_1(D)
+	.loc 1 53 213 is_stmt 1 view .LVU1085
+.LVL193:
+.LBB1503:
+.LBI1503:
+	.loc 1 5 19 view .LVU1086
+.LBB1504:
+	.loc 1 5 44 view .LVU1087
+# blake2s-generic.c:5: static inline u32 ror(unsigned l, u32 x) { return (x >> l) | (x << (32-l)); }
+	.loc 1 5 60 is_stmt 0 view .LVU1088
+	rorl	$8, %edi	#, _415
+.LVL194:
+	.loc 1 5 60 view .LVU1089
+.LBE1504:
+.LBE1503:
+# blake2s-generic.c:53:     FULLROUND(3);
+	.loc 1 53 259 view .LVU1090
+	addl	%edi, %r12d	# _415, _416
+# blake2s-generic.c:53:     FULLROUND(3);
+	.loc 1 53 221 view .LVU1091
+	movl	%edi, 48(%rax)	# _415, MEM[(u32 *)v_1(D) + 48B]
+	.loc 1 53 251 is_stmt 1 view .LVU1092
+# blake2s-generic.c:53:     FULLROUND(3);
+	.loc 1 53 281 is_stmt 0 view .LVU1093
+	xorl	%r12d, %r14d	# _416, tmp1587
+# blake2s-generic.c:53:     FULLROUND(3);
+	.loc 1 53 259 view .LVU1094
+	movl	%r12d, 32(%rax)	# _416, MEM[(u32 *)v_1(D) + 32B]
+	.loc 1 53 271 is_stmt 1 view .LVU1095
+.LVL195:
+.LBB1505:
+.LBI1505:
+	.loc 1 5 19 view .LVU1096
+.LBB1506:
+	.loc 1 5 44 view .LVU1097
+# blake2s-generic.c:5: static inline u32 ror(unsigned l, u32 x) { return (x >> l) | (x << (32-l)); }
+	.loc 1 5 60 is_stmt 0 view .LVU1098
+	rorl	$7, %r14d	#, tmp1587
+.LBE1506:
+.LBE1505:
+# blake2s-generic.c:53:     FULLROUND(3);
+	.loc 1 53 281 view .LVU1099
+	movl	%r12d, -28(%rsp)	# _416, %sfp
+# blake2s-generic.c:53:     FULLROUND(3);
+	.loc 1 53 279 view .LVU1100
+	movl	%r14d, 16(%rax)	# _418, MEM[(u32 *)v_1(D) + 16B]
+	.loc 1 53 13 is_stmt 1 view .LVU1101
+	.loc 1 53 322 view .LVU1102
+	.loc 1 53 327 view .LVU1103
+# blake2s-generic.c:53:     FULLROUND(3);
+	.loc 1 53 335 is_stmt 0 view .LVU1104
+	addl	12(%r9), %esi	# MEM[(const u32 *)m_4(D) + 12B], tmp1588
+	addl	%ebp, %esi	# _354, _421
+# blake2s-generic.c:53:     FULLROUND(3);
+	.loc 1 53 279 view .LVU1105
+	movl	%r14d, -24(%rsp)	# _418, %sfp
+# blake2s-generic.c:53:     FULLROUND(3);
+	.loc 1 53 388 view .LVU1106
+	xorl	%esi, %ecx	# _421, tmp1590
+# blake2s-generic.c:53:     FULLROUND(3);
+	.loc 1 53 335 view .LVU1107
+	movl	%esi, 4(%rax)	# _421, MEM[(u32 *)v_1(D) + 4B]
+	.loc 1 53 378 is_stmt 1 view .LVU1108
+.LVL196:
+.LBB1507:
+.LBI1507:
+	.loc 1 5 19 view .LVU1109
+.LBB1508:
+	.loc 1 5 44 view .LVU1110
+# blake2s-generic.c:5: static inline u32 ror(unsigned l, u32 x) { return (x >> l) | (x << (32-l)); }
+	.loc 1 5 60 is_stmt 0 view .LVU1111
+	roll	$16, %ecx	#, _423
+.LVL197:
+	.loc 1 5 60 view .LVU1112
+.LBE1508:
+.LBE1507:
+# blake2s-generic.c:53:     FULLROUND(3);
+	.loc 1 53 424 view .LVU1113
+	addl	%ecx, %r15d	# _423, _424
+# blake2s-generic.c:53:     FULLROUND(3);
+	.loc 1 53 386 view .LVU1114
+	movl	%ecx, 52(%rax)	# _423, MEM[(u32 *)v_1(D) + 52B]
+	.loc 1 53 416 is_stmt 1 view .LVU1115
+# blake2s-generic.c:53:     FULLROUND(3);
+	.loc 1 53 446 is_stmt 0 view .LVU1116
+	xorl	%r15d, %ebp	# _424, tmp1591
+# blake2s-generic.c:53:     FULLROUND(3);
+	.loc 1 53 424 view .LVU1117
+	movl	%r15d, 36(%rax)	# _424, MEM[(u32 *)v_1(D) + 36B]
+	.loc 1 53 436 is_stmt 1 view .LVU1118
+.LVL198:
+.LBB1509:
+.LBI1509:
+	.loc 1 5 19 view .LVU1119
+.LBB1510:
+	.loc 1 5 44 view .LVU1120
+# blake2s-generic.c:5: static inline u32 ror(unsigned l, u32 x) { return (x >> l) | (x << (32-l)); }
+	.loc 1 5 60 is_stmt 0 view .LVU1121
+	rorl	$12, %ebp	#, _426
+.LVL199:
+	.loc 1 5 60 view .LVU1122
+.LBE1510:
+.LBE1509:
+# blake2s-generic.c:53:     FULLROUND(3);
+	.loc 1 53 444 view .LVU1123
+	movl	%ebp, 20(%rax)	# _426, MEM[(u32 *)v_1(D) + 20B]
+	.loc 1 53 474 is_stmt 1 view .LVU1124
+# blake2s-generic.c:53:     FULLROUND(3);
+	.loc 1 53 482 is_stmt 0 view .LVU1125
+	addl	4(%r9), %esi	# MEM[(const u32 *)m_4(D) + 4B], tmp1592
+	addl	%ebp, %esi	# _426, _429
+# blake2s-generic.c:53:     FULLROUND(3);
+	.loc 1 53 535 view .LVU1126
+	xorl	%esi, %ecx	# _429, tmp1594
+# blake2s-generic.c:53:     FULLROUND(3);
+	.loc 1 53 482 view .LVU1127
+	movl	%esi, 4(%rax)	# _429, MEM[(u32 *)v_1(D) + 4B]
+	.loc 1 53 525 is_stmt 1 view .LVU1128
+.LVL200:
+.LBB1511:
+.LBI1511:
+	.loc 1 5 19 view .LVU1129
+.LBB1512:
+	.loc 1 5 44 view .LVU1130
+# blake2s-generic.c:5: static inline u32 ror(unsigned l, u32 x) { return (x >> l) | (x << (32-l)); }
+	.loc 1 5 60 is_stmt 0 view .LVU1131
+	rorl	$8, %ecx	#, _431
+.LVL201:
+	.loc 1 5 60 view .LVU1132
+.LBE1512:
+.LBE1511:
+# blake2s-generic.c:53:     FULLROUND(3);
+	.loc 1 53 571 view .LVU1133
+	addl	%ecx, %r15d	# _431, _432
+# blake2s-generic.c:53:     FULLROUND(3);
+	.loc 1 53 533 view .LVU1134
+	movl	%ecx, 52(%rax)	# _431, MEM[(u32 *)v_1(D) + 52B]
+	.loc 1 53 563 is_stmt 1 view .LVU1135
+# blake2s-generic.c:53:     FULLROUND(3);
+	.loc 1 53 593 is_stmt 0 view .LVU1136
+	xorl	%r15d, %ebp	# _432, tmp1595
+# blake2s-generic.c:53:     FULLROUND(3);
+	.loc 1 53 571 view .LVU1137
+	movl	%r15d, 36(%rax)	# _432, MEM[(u32 *)v_1(D) + 36B]
+	.loc 1 53 583 is_stmt 1 view .LVU1138
+.LVL202:
+.LBB1513:
+.LBI1513:
+	.loc 1 5 19 view .LVU1139
+.LBB1514:
+	.loc 1 5 44 view .LVU1140
+# blake2s-generic.c:5: static inline u32 ror(unsigned l, u32 x) { return (x >> l) | (x << (32-l)); }
+	.loc 1 5 60 is_stmt 0 view .LVU1141
+	rorl	$7, %ebp	#, _434
+.LVL203:
+	.loc 1 5 60 view .LVU1142
+.LBE1514:
+.LBE1513:
+# blake2s-generic.c:53:     FULLROUND(3);
+	.loc 1 53 593 view .LVU1143
+	movl	%r15d, -20(%rsp)	# _432, %sfp
+# blake2s-generic.c:53:     FULLROUND(3);
+	.loc 1 53 736 view .LVU1144
+	movl	-12(%rsp), %r15d	# %sfp, _352
+# blake2s-generic.c:53:     FULLROUND(3);
+	.loc 1 53 591 view .LVU1145
+	movl	%ebp, 20(%rax)	# _434, MEM[(u32 *)v_1(D) + 20B]
+	.loc 1 53 325 is_stmt 1 view .LVU1146
+	.loc 1 53 634 view .LVU1147
+	.loc 1 53 639 view .LVU1148
+# blake2s-generic.c:53:     FULLROUND(3);
+	.loc 1 53 647 is_stmt 0 view .LVU1149
+	addl	52(%r9), %edx	# MEM[(const u32 *)m_4(D) + 52B], tmp1596
+	addl	%ebx, %edx	# _370, _437
+# blake2s-generic.c:53:     FULLROUND(3);
+	.loc 1 53 700 view .LVU1150
+	xorl	%edx, %r13d	# _437, tmp1598
+# blake2s-generic.c:53:     FULLROUND(3);
+	.loc 1 53 647 view .LVU1151
+	movl	%edx, 8(%rax)	# _437, MEM[(u32 *)v_1(D) + 8B]
+	.loc 1 53 690 is_stmt 1 view .LVU1152
+.LVL204:
+.LBB1515:
+.LBI1515:
+	.loc 1 5 19 view .LVU1153
+.LBB1516:
+	.loc 1 5 44 view .LVU1154
+# blake2s-generic.c:5: static inline u32 ror(unsigned l, u32 x) { return (x >> l) | (x << (32-l)); }
+	.loc 1 5 60 is_stmt 0 view .LVU1155
+	roll	$16, %r13d	#, _439
+.LVL205:
+	.loc 1 5 60 view .LVU1156
+.LBE1516:
+.LBE1515:
+# blake2s-generic.c:53:     FULLROUND(3);
+	.loc 1 53 736 view .LVU1157
+	leal	(%r15,%r13), %r14d	#, _440
+# blake2s-generic.c:53:     FULLROUND(3);
+	.loc 1 53 698 view .LVU1158
+	movl	%r13d, 56(%rax)	# _439, MEM[(u32 *)v_1(D) + 56B]
+	.loc 1 53 728 is_stmt 1 view .LVU1159
+# blake2s-generic.c:53:     FULLROUND(3);
+	.loc 1 53 758 is_stmt 0 view .LVU1160
+	xorl	%r14d, %ebx	# _440, tmp1599
+# blake2s-generic.c:53:     FULLROUND(3);
+	.loc 1 53 736 view .LVU1161
+	movl	%r14d, 40(%rax)	# _440, MEM[(u32 *)v_1(D) + 40B]
+	.loc 1 53 748 is_stmt 1 view .LVU1162
+.LVL206:
+.LBB1517:
+.LBI1517:
+	.loc 1 5 19 view .LVU1163
+.LBB1518:
+	.loc 1 5 44 view .LVU1164
+# blake2s-generic.c:5: static inline u32 ror(unsigned l, u32 x) { return (x >> l) | (x << (32-l)); }
+	.loc 1 5 60 is_stmt 0 view .LVU1165
+	rorl	$12, %ebx	#, _442
+.LVL207:
+	.loc 1 5 60 view .LVU1166
+.LBE1518:
+.LBE1517:
+# blake2s-generic.c:53:     FULLROUND(3);
+	.loc 1 53 756 view .LVU1167
+	movl	%ebx, 24(%rax)	# _442, MEM[(u32 *)v_1(D) + 24B]
+	.loc 1 53 786 is_stmt 1 view .LVU1168
+# blake2s-generic.c:53:     FULLROUND(3);
+	.loc 1 53 794 is_stmt 0 view .LVU1169
+	addl	48(%r9), %edx	# MEM[(const u32 *)m_4(D) + 48B], tmp1600
+	addl	%ebx, %edx	# _442, _445
+# blake2s-generic.c:53:     FULLROUND(3);
+	.loc 1 53 847 view .LVU1170
+	xorl	%edx, %r13d	# _445, tmp1602
+# blake2s-generic.c:53:     FULLROUND(3);
+	.loc 1 53 794 view .LVU1171
+	movl	%edx, 8(%rax)	# _445, MEM[(u32 *)v_1(D) + 8B]
+	.loc 1 53 837 is_stmt 1 view .LVU1172
+.LVL208:
+.LBB1519:
+.LBI1519:
+	.loc 1 5 19 view .LVU1173
+.LBB1520:
+	.loc 1 5 44 view .LVU1174
+# blake2s-generic.c:5: static inline u32 ror(unsigned l, u32 x) { return (x >> l) | (x << (32-l)); }
+	.loc 1 5 60 is_stmt 0 view .LVU1175
+	rorl	$8, %r13d	#, _447
+.LVL209:
+	.loc 1 5 60 view .LVU1176
+.LBE1520:
+.LBE1519:
+# blake2s-generic.c:53:     FULLROUND(3);
+	.loc 1 53 883 view .LVU1177
+	addl	%r13d, %r14d	# _447, _448
+# blake2s-generic.c:53:     FULLROUND(3);
+	.loc 1 53 845 view .LVU1178
+	movl	%r13d, 56(%rax)	# _447, MEM[(u32 *)v_1(D) + 56B]
+	.loc 1 53 875 is_stmt 1 view .LVU1179
+# blake2s-generic.c:53:     FULLROUND(3);
+	.loc 1 53 1012 is_stmt 0 view .LVU1180
+	movl	-16(%rsp), %r12d	# %sfp, _351
+# blake2s-generic.c:53:     FULLROUND(3);
+	.loc 1 53 905 view .LVU1181
+	xorl	%r14d, %ebx	# _448, tmp1603
+# blake2s-generic.c:53:     FULLROUND(3);
+	.loc 1 53 883 view .LVU1182
+	movl	%r14d, 40(%rax)	# _448, MEM[(u32 *)v_1(D) + 40B]
+	.loc 1 53 895 is_stmt 1 view .LVU1183
+.LVL210:
+.LBB1521:
+.LBI1521:
+	.loc 1 5 19 view .LVU1184
+.LBB1522:
+	.loc 1 5 44 view .LVU1185
+.LBE1522:
+.LBE1521:
+# blake2s-generic.c:53:     FULLROUND(3);
+	.loc 1 53 1048 is_stmt 0 view .LVU1186
+	movl	-8(%rsp), %r15d	# %sfp, _368
+.LBB1524:
+.LBB1523:
+# blake2s-generic.c:5: static inline u32 ror(unsigned l, u32 x) { return (x >> l) | (x << (32-l)); }
+	.loc 1 5 60 view .LVU1187
+	rorl	$7, %ebx	#, _450
+.LVL211:
+	.loc 1 5 60 view .LVU1188
+.LBE1523:
+.LBE1524:
+# blake2s-generic.c:53:     FULLROUND(3);
+	.loc 1 53 903 view .LVU1189
+	movl	%ebx, 24(%rax)	# _450, MEM[(u32 *)v_1(D) + 24B]
+	.loc 1 53 637 is_stmt 1 view .LVU1190
+	.loc 1 53 946 view .LVU1191
+	.loc 1 53 951 view .LVU1192
+# blake2s-generic.c:53:     FULLROUND(3);
+	.loc 1 53 959 is_stmt 0 view .LVU1193
+	addl	44(%r9), %r10d	# MEM[(const u32 *)m_4(D) + 44B], tmp1604
+	addl	%r11d, %r10d	# _386, _453
+# blake2s-generic.c:53:     FULLROUND(3);
+	.loc 1 53 1012 view .LVU1194
+	xorl	%r10d, %r12d	# _453, _351
+# blake2s-generic.c:53:     FULLROUND(3);
+	.loc 1 53 959 view .LVU1195
+	movl	%r10d, 12(%rax)	# _453, MEM[(u32 *)v_1(D) + 12B]
+	.loc 1 53 1002 is_stmt 1 view .LVU1196
+.LVL212:
+.LBB1525:
+.LBI1525:
+	.loc 1 5 19 view .LVU1197
+.LBB1526:
+	.loc 1 5 44 view .LVU1198
+# blake2s-generic.c:5: static inline u32 ror(unsigned l, u32 x) { return (x >> l) | (x << (32-l)); }
+	.loc 1 5 60 is_stmt 0 view .LVU1199
+	roll	$16, %r12d	#, _455
+.LVL213:
+	.loc 1 5 60 view .LVU1200
+.LBE1526:
+.LBE1525:
+# blake2s-generic.c:53:     FULLROUND(3);
+	.loc 1 53 1048 view .LVU1201
+	addl	%r12d, %r15d	# _455, _456
+# blake2s-generic.c:53:     FULLROUND(3);
+	.loc 1 53 1010 view .LVU1202
+	movl	%r12d, 60(%rax)	# _455, MEM[(u32 *)v_1(D) + 60B]
+	.loc 1 53 1040 is_stmt 1 view .LVU1203
+# blake2s-generic.c:53:     FULLROUND(3);
+	.loc 1 53 1070 is_stmt 0 view .LVU1204
+	xorl	%r15d, %r11d	# _456, tmp1607
+# blake2s-generic.c:53:     FULLROUND(3);
+	.loc 1 53 1048 view .LVU1205
+	movl	%r15d, 44(%rax)	# _456, MEM[(u32 *)v_1(D) + 44B]
+	.loc 1 53 1060 is_stmt 1 view .LVU1206
+.LVL214:
+.LBB1527:
+.LBI1527:
+	.loc 1 5 19 view .LVU1207
+.LBB1528:
+	.loc 1 5 44 view .LVU1208
+# blake2s-generic.c:5: static inline u32 ror(unsigned l, u32 x) { return (x >> l) | (x << (32-l)); }
+	.loc 1 5 60 is_stmt 0 view .LVU1209
+	rorl	$12, %r11d	#, _458
+.LVL215:
+	.loc 1 5 60 view .LVU1210
+.LBE1528:
+.LBE1527:
+# blake2s-generic.c:53:     FULLROUND(3);
+	.loc 1 53 1068 view .LVU1211
+	movl	%r11d, 28(%rax)	# _458, MEM[(u32 *)v_1(D) + 28B]
+	.loc 1 53 1098 is_stmt 1 view .LVU1212
+# blake2s-generic.c:53:     FULLROUND(3);
+	.loc 1 53 1106 is_stmt 0 view .LVU1213
+	addl	56(%r9), %r10d	# MEM[(const u32 *)m_4(D) + 56B], tmp1608
+	addl	%r11d, %r10d	# _458, _461
+# blake2s-generic.c:53:     FULLROUND(3);
+	.loc 1 53 1159 view .LVU1214
+	xorl	%r10d, %r12d	# _461, tmp1610
+# blake2s-generic.c:53:     FULLROUND(3);
+	.loc 1 53 1106 view .LVU1215
+	movl	%r10d, 12(%rax)	# _461, MEM[(u32 *)v_1(D) + 12B]
+	.loc 1 53 1149 is_stmt 1 view .LVU1216
+.LVL216:
+.LBB1529:
+.LBI1529:
+	.loc 1 5 19 view .LVU1217
+.LBB1530:
+	.loc 1 5 44 view .LVU1218
+# blake2s-generic.c:5: static inline u32 ror(unsigned l, u32 x) { return (x >> l) | (x << (32-l)); }
+	.loc 1 5 60 is_stmt 0 view .LVU1219
+	rorl	$8, %r12d	#, _463
+.LVL217:
+	.loc 1 5 60 view .LVU1220
+.LBE1530:
+.LBE1529:
+# blake2s-generic.c:53:     FULLROUND(3);
+	.loc 1 53 1195 view .LVU1221
+	addl	%r12d, %r15d	# _463, _464
+# blake2s-generic.c:53:     FULLROUND(3);
+	.loc 1 53 1157 view .LVU1222
+	movl	%r12d, 60(%rax)	# _463, MEM[(u32 *)v_1(D) + 60B]
+	.loc 1 53 1187 is_stmt 1 view .LVU1223
+# blake2s-generic.c:53:     FULLROUND(3);
+	.loc 1 53 1217 is_stmt 0 view .LVU1224
+	xorl	%r15d, %r11d	# _464, tmp1611
+# blake2s-generic.c:53:     FULLROUND(3);
+	.loc 1 53 1195 view .LVU1225
+	movl	%r15d, 44(%rax)	# _464, MEM[(u32 *)v_1(D) + 44B]
+	.loc 1 53 1207 is_stmt 1 view .LVU1226
+.LVL218:
+.LBB1531:
+.LBI1531:
+	.loc 1 5 19 view .LVU1227
+.LBB1532:
+	.loc 1 5 44 view .LVU1228
+# blake2s-generic.c:5: static inline u32 ror(unsigned l, u32 x) { return (x >> l) | (x << (32-l)); }
+	.loc 1 5 60 is_stmt 0 view .LVU1229
+	rorl	$7, %r11d	#, _466
+.LVL219:
+	.loc 1 5 60 view .LVU1230
+.LBE1532:
+.LBE1531:
+# blake2s-generic.c:53:     FULLROUND(3);
+	.loc 1 53 1215 view .LVU1231
+	movl	%r11d, 28(%rax)	# _466, MEM[(u32 *)v_1(D) + 28B]
+	.loc 1 53 949 is_stmt 1 view .LVU1232
+	.loc 1 53 1258 view .LVU1233
+	.loc 1 53 1263 view .LVU1234
+# blake2s-generic.c:53:     FULLROUND(3);
+	.loc 1 53 1271 is_stmt 0 view .LVU1235
+	addl	8(%r9), %r8d	# MEM[(const u32 *)m_4(D) + 8B], tmp1612
+	addl	%ebp, %r8d	# _434, _469
+# blake2s-generic.c:53:     FULLROUND(3);
+	.loc 1 53 1324 view .LVU1236
+	xorl	%r8d, %r12d	# _469, tmp1614
+# blake2s-generic.c:53:     FULLROUND(3);
+	.loc 1 53 1271 view .LVU1237
+	movl	%r8d, (%rax)	# _469, *v_1(D)
+	.loc 1 53 1314 is_stmt 1 view .LVU1238
+.LVL220:
+.LBB1533:
+.LBI1533:
+	.loc 1 5 19 view .LVU1239
+.LBB1534:
+	.loc 1 5 44 view .LVU1240
+# blake2s-generic.c:5: static inline u32 ror(unsigned l, u32 x) { return (x >> l) | (x << (32-l)); }
+	.loc 1 5 60 is_stmt 0 view .LVU1241
+	roll	$16, %r12d	#, _471
+.LVL221:
+	.loc 1 5 60 view .LVU1242
+.LBE1534:
+.LBE1533:
+# blake2s-generic.c:53:     FULLROUND(3);
+	.loc 1 53 1360 view .LVU1243
+	addl	%r12d, %r14d	# _471, _472
+# blake2s-generic.c:53:     FULLROUND(3);
+	.loc 1 53 1322 view .LVU1244
+	movl	%r12d, 60(%rax)	# _471, MEM[(u32 *)v_1(D) + 60B]
+	.loc 1 53 1352 is_stmt 1 view .LVU1245
+# blake2s-generic.c:53:     FULLROUND(3);
+	.loc 1 53 1382 is_stmt 0 view .LVU1246
+	xorl	%r14d, %ebp	# _472, tmp1615
+# blake2s-generic.c:53:     FULLROUND(3);
+	.loc 1 53 1360 view .LVU1247
+	movl	%r14d, 40(%rax)	# _472, MEM[(u32 *)v_1(D) + 40B]
+	.loc 1 53 1372 is_stmt 1 view .LVU1248
+.LVL222:
+.LBB1535:
+.LBI1535:
+	.loc 1 5 19 view .LVU1249
+.LBB1536:
+	.loc 1 5 44 view .LVU1250
+# blake2s-generic.c:5: static inline u32 ror(unsigned l, u32 x) { return (x >> l) | (x << (32-l)); }
+	.loc 1 5 60 is_stmt 0 view .LVU1251
+	rorl	$12, %ebp	#, _474
+.LVL223:
+	.loc 1 5 60 view .LVU1252
+.LBE1536:
+.LBE1535:
+# blake2s-generic.c:53:     FULLROUND(3);
+	.loc 1 53 1380 view .LVU1253
+	movl	%ebp, 20(%rax)	# _474, MEM[(u32 *)v_1(D) + 20B]
+	.loc 1 53 1410 is_stmt 1 view .LVU1254
+# blake2s-generic.c:53:     FULLROUND(3);
+	.loc 1 53 1418 is_stmt 0 view .LVU1255
+	addl	24(%r9), %r8d	# MEM[(const u32 *)m_4(D) + 24B], tmp1616
+	addl	%ebp, %r8d	# _474, _477
+# blake2s-generic.c:53:     FULLROUND(3);
+	.loc 1 53 1471 view .LVU1256
+	xorl	%r8d, %r12d	# _477, tmp1618
+# blake2s-generic.c:53:     FULLROUND(3);
+	.loc 1 53 1418 view .LVU1257
+	movl	%r8d, (%rax)	# _477, *v_1(D)
+	.loc 1 53 1461 is_stmt 1 view .LVU1258
+.LVL224:
+.LBB1537:
+.LBI1537:
+	.loc 1 5 19 view .LVU1259
+.LBB1538:
+	.loc 1 5 44 view .LVU1260
+# blake2s-generic.c:5: static inline u32 ror(unsigned l, u32 x) { return (x >> l) | (x << (32-l)); }
+	.loc 1 5 60 is_stmt 0 view .LVU1261
+	rorl	$8, %r12d	#, tmp1618
+.LBE1538:
+.LBE1537:
+# blake2s-generic.c:53:     FULLROUND(3);
+	.loc 1 53 1507 view .LVU1262
+	addl	%r12d, %r14d	# _479, _480
+# blake2s-generic.c:53:     FULLROUND(3);
+	.loc 1 53 1469 view .LVU1263
+	movl	%r12d, 60(%rax)	# _479, MEM[(u32 *)v_1(D) + 60B]
+	.loc 1 53 1499 is_stmt 1 view .LVU1264
+# blake2s-generic.c:53:     FULLROUND(3);
+	.loc 1 53 1529 is_stmt 0 view .LVU1265
+	xorl	%r14d, %ebp	# _480, tmp1619
+# blake2s-generic.c:53:     FULLROUND(3);
+	.loc 1 53 1507 view .LVU1266
+	movl	%r14d, 40(%rax)	# _480, MEM[(u32 *)v_1(D) + 40B]
+	.loc 1 53 1519 is_stmt 1 view .LVU1267
+.LVL225:
+.LBB1539:
+.LBI1539:
+	.loc 1 5 19 view .LVU1268
+.LBB1540:
+	.loc 1 5 44 view .LVU1269
+# blake2s-generic.c:5: static inline u32 ror(unsigned l, u32 x) { return (x >> l) | (x << (32-l)); }
+	.loc 1 5 60 is_stmt 0 view .LVU1270
+	rorl	$7, %ebp	#, _482
+.LVL226:
+	.loc 1 5 60 view .LVU1271
+.LBE1540:
+.LBE1539:
+# blake2s-generic.c:53:     FULLROUND(3);
+	.loc 1 53 1507 view .LVU1272
+	movl	%r12d, -16(%rsp)	# _479, %sfp
+# blake2s-generic.c:53:     FULLROUND(3);
+	.loc 1 53 1527 view .LVU1273
+	movl	%ebp, 20(%rax)	# _482, MEM[(u32 *)v_1(D) + 20B]
+	.loc 1 53 1261 is_stmt 1 view .LVU1274
+	.loc 1 53 1570 view .LVU1275
+	.loc 1 53 1575 view .LVU1276
+# blake2s-generic.c:53:     FULLROUND(3);
+	.loc 1 53 1583 is_stmt 0 view .LVU1277
+	addl	20(%r9), %esi	# MEM[(const u32 *)m_4(D) + 20B], tmp1620
+	addl	%ebx, %esi	# _450, _485
+# blake2s-generic.c:53:     FULLROUND(3);
+	.loc 1 53 1529 view .LVU1278
+	movl	%r14d, -12(%rsp)	# _480, %sfp
+# blake2s-generic.c:53:     FULLROUND(3);
+	.loc 1 53 1637 view .LVU1279
+	xorl	%esi, %edi	# _485, tmp1622
+# blake2s-generic.c:53:     FULLROUND(3);
+	.loc 1 53 1583 view .LVU1280
+	movl	%esi, 4(%rax)	# _485, MEM[(u32 *)v_1(D) + 4B]
+	.loc 1 53 1627 is_stmt 1 view .LVU1281
+.LVL227:
+.LBB1541:
+.LBI1541:
+	.loc 1 5 19 view .LVU1282
+.LBB1542:
+	.loc 1 5 44 view .LVU1283
+# blake2s-generic.c:5: static inline u32 ror(unsigned l, u32 x) { return (x >> l) | (x << (32-l)); }
+	.loc 1 5 60 is_stmt 0 view .LVU1284
+	roll	$16, %edi	#, _487
+.LVL228:
+	.loc 1 5 60 view .LVU1285
+.LBE1542:
+.LBE1541:
+# blake2s-generic.c:53:     FULLROUND(3);
+	.loc 1 53 1673 view .LVU1286
+	addl	%edi, %r15d	# _487, _488
+# blake2s-generic.c:53:     FULLROUND(3);
+	.loc 1 53 1635 view .LVU1287
+	movl	%edi, 48(%rax)	# _487, MEM[(u32 *)v_1(D) + 48B]
+	.loc 1 53 1665 is_stmt 1 view .LVU1288
+# blake2s-generic.c:53:     FULLROUND(3);
+	.loc 1 53 1695 is_stmt 0 view .LVU1289
+	xorl	%r15d, %ebx	# _488, tmp1623
+# blake2s-generic.c:53:     FULLROUND(3);
+	.loc 1 53 1673 view .LVU1290
+	movl	%r15d, 44(%rax)	# _488, MEM[(u32 *)v_1(D) + 44B]
+	.loc 1 53 1685 is_stmt 1 view .LVU1291
+.LVL229:
+.LBB1543:
+.LBI1543:
+	.loc 1 5 19 view .LVU1292
+.LBB1544:
+	.loc 1 5 44 view .LVU1293
+# blake2s-generic.c:5: static inline u32 ror(unsigned l, u32 x) { return (x >> l) | (x << (32-l)); }
+	.loc 1 5 60 is_stmt 0 view .LVU1294
+	rorl	$12, %ebx	#, _490
+.LVL230:
+	.loc 1 5 60 view .LVU1295
+.LBE1544:
+.LBE1543:
+# blake2s-generic.c:53:     FULLROUND(3);
+	.loc 1 53 1693 view .LVU1296
+	movl	%ebx, 24(%rax)	# _490, MEM[(u32 *)v_1(D) + 24B]
+	.loc 1 53 1723 is_stmt 1 view .LVU1297
+# blake2s-generic.c:53:     FULLROUND(3);
+	.loc 1 53 1731 is_stmt 0 view .LVU1298
+	addl	40(%r9), %esi	# MEM[(const u32 *)m_4(D) + 40B], tmp1624
+	addl	%ebx, %esi	# _490, _493
+# blake2s-generic.c:53:     FULLROUND(3);
+	.loc 1 53 1785 view .LVU1299
+	xorl	%esi, %edi	# _493, tmp1626
+# blake2s-generic.c:53:     FULLROUND(3);
+	.loc 1 53 1731 view .LVU1300
+	movl	%esi, 4(%rax)	# _493, MEM[(u32 *)v_1(D) + 4B]
+	.loc 1 53 1775 is_stmt 1 view .LVU1301
+.LVL231:
+.LBB1545:
+.LBI1545:
+	.loc 1 5 19 view .LVU1302
+.LBB1546:
+	.loc 1 5 44 view .LVU1303
+.LBE1546:
+.LBE1545:
+# blake2s-generic.c:53:     FULLROUND(3);
+	.loc 1 53 2211 is_stmt 0 view .LVU1304
+	movl	-24(%rsp), %r14d	# %sfp, _418
+.LBB1548:
+.LBB1547:
+# blake2s-generic.c:5: static inline u32 ror(unsigned l, u32 x) { return (x >> l) | (x << (32-l)); }
+	.loc 1 5 60 view .LVU1305
+	rorl	$8, %edi	#, _495
+.LVL232:
+	.loc 1 5 60 view .LVU1306
+.LBE1547:
+.LBE1548:
+# blake2s-generic.c:53:     FULLROUND(3);
+	.loc 1 53 1821 view .LVU1307
+	addl	%edi, %r15d	# _495, _496
+# blake2s-generic.c:53:     FULLROUND(3);
+	.loc 1 53 1783 view .LVU1308
+	movl	%edi, 48(%rax)	# _495, MEM[(u32 *)v_1(D) + 48B]
+	.loc 1 53 1813 is_stmt 1 view .LVU1309
+# blake2s-generic.c:53:     FULLROUND(3);
+	.loc 1 53 1843 is_stmt 0 view .LVU1310
+	xorl	%r15d, %ebx	# _496, tmp1627
+# blake2s-generic.c:53:     FULLROUND(3);
+	.loc 1 53 1821 view .LVU1311
+	movl	%r15d, 44(%rax)	# _496, MEM[(u32 *)v_1(D) + 44B]
+	.loc 1 53 1833 is_stmt 1 view .LVU1312
+.LVL233:
+.LBB1549:
+.LBI1549:
+	.loc 1 5 19 view .LVU1313
+.LBB1550:
+	.loc 1 5 44 view .LVU1314
+# blake2s-generic.c:5: static inline u32 ror(unsigned l, u32 x) { return (x >> l) | (x << (32-l)); }
+	.loc 1 5 60 is_stmt 0 view .LVU1315
+	rorl	$7, %ebx	#, _498
+.LVL234:
+	.loc 1 5 60 view .LVU1316
+.LBE1550:
+.LBE1549:
+# blake2s-generic.c:53:     FULLROUND(3);
+	.loc 1 53 1843 view .LVU1317
+	movl	%r15d, -8(%rsp)	# _496, %sfp
+# blake2s-generic.c:53:     FULLROUND(3);
+	.loc 1 53 1987 view .LVU1318
+	movl	-28(%rsp), %r15d	# %sfp, _416
+# blake2s-generic.c:53:     FULLROUND(3);
+	.loc 1 53 1841 view .LVU1319
+	movl	%ebx, 24(%rax)	# _498, MEM[(u32 *)v_1(D) + 24B]
+	.loc 1 53 1573 is_stmt 1 view .LVU1320
+	.loc 1 53 1884 view .LVU1321
+	.loc 1 53 1889 view .LVU1322
+# blake2s-generic.c:53:     FULLROUND(3);
+	.loc 1 53 1897 is_stmt 0 view .LVU1323
+	addl	16(%r9), %edx	# MEM[(const u32 *)m_4(D) + 16B], tmp1628
+	addl	%r11d, %edx	# _466, _501
+# blake2s-generic.c:53:     FULLROUND(3);
+	.loc 1 53 1951 view .LVU1324
+	xorl	%edx, %ecx	# _501, tmp1630
+# blake2s-generic.c:53:     FULLROUND(3);
+	.loc 1 53 1897 view .LVU1325
+	movl	%edx, 8(%rax)	# _501, MEM[(u32 *)v_1(D) + 8B]
+	.loc 1 53 1941 is_stmt 1 view .LVU1326
+.LVL235:
+.LBB1551:
+.LBI1551:
+	.loc 1 5 19 view .LVU1327
+.LBB1552:
+	.loc 1 5 44 view .LVU1328
+# blake2s-generic.c:5: static inline u32 ror(unsigned l, u32 x) { return (x >> l) | (x << (32-l)); }
+	.loc 1 5 60 is_stmt 0 view .LVU1329
+	roll	$16, %ecx	#, _503
+.LVL236:
+	.loc 1 5 60 view .LVU1330
+.LBE1552:
+.LBE1551:
+# blake2s-generic.c:53:     FULLROUND(3);
+	.loc 1 53 1987 view .LVU1331
+	leal	(%r15,%rcx), %r12d	#, _504
+# blake2s-generic.c:53:     FULLROUND(3);
+	.loc 1 53 1949 view .LVU1332
+	movl	%ecx, 52(%rax)	# _503, MEM[(u32 *)v_1(D) + 52B]
+	.loc 1 53 1979 is_stmt 1 view .LVU1333
+# blake2s-generic.c:53:     FULLROUND(3);
+	.loc 1 53 2301 is_stmt 0 view .LVU1334
+	movl	-20(%rsp), %r15d	# %sfp, _432
+# blake2s-generic.c:53:     FULLROUND(3);
+	.loc 1 53 2009 view .LVU1335
+	xorl	%r12d, %r11d	# _504, tmp1631
+# blake2s-generic.c:53:     FULLROUND(3);
+	.loc 1 53 1987 view .LVU1336
+	movl	%r12d, 32(%rax)	# _504, MEM[(u32 *)v_1(D) + 32B]
+	.loc 1 53 1999 is_stmt 1 view .LVU1337
+.LVL237:
+.LBB1553:
+.LBI1553:
+	.loc 1 5 19 view .LVU1338
+.LBB1554:
+	.loc 1 5 44 view .LVU1339
+# blake2s-generic.c:5: static inline u32 ror(unsigned l, u32 x) { return (x >> l) | (x << (32-l)); }
+	.loc 1 5 60 is_stmt 0 view .LVU1340
+	rorl	$12, %r11d	#, _506
+.LVL238:
+	.loc 1 5 60 view .LVU1341
+.LBE1554:
+.LBE1553:
+# blake2s-generic.c:53:     FULLROUND(3);
+	.loc 1 53 2007 view .LVU1342
+	movl	%r11d, 28(%rax)	# _506, MEM[(u32 *)v_1(D) + 28B]
+	.loc 1 53 2037 is_stmt 1 view .LVU1343
+# blake2s-generic.c:53:     FULLROUND(3);
+	.loc 1 53 2045 is_stmt 0 view .LVU1344
+	addl	(%r9), %edx	# *m_4(D), tmp1632
+	addl	%r11d, %edx	# _506, _509
+# blake2s-generic.c:53:     FULLROUND(3);
+	.loc 1 53 2099 view .LVU1345
+	xorl	%edx, %ecx	# _509, tmp1634
+# blake2s-generic.c:53:     FULLROUND(3);
+	.loc 1 53 2045 view .LVU1346
+	movl	%edx, 8(%rax)	# _509, MEM[(u32 *)v_1(D) + 8B]
+	.loc 1 53 2089 is_stmt 1 view .LVU1347
+.LVL239:
+.LBB1555:
+.LBI1555:
+	.loc 1 5 19 view .LVU1348
+.LBB1556:
+	.loc 1 5 44 view .LVU1349
+# blake2s-generic.c:5: static inline u32 ror(unsigned l, u32 x) { return (x >> l) | (x << (32-l)); }
+	.loc 1 5 60 is_stmt 0 view .LVU1350
+	rorl	$8, %ecx	#, _511
+.LVL240:
+	.loc 1 5 60 view .LVU1351
+.LBE1556:
+.LBE1555:
+# blake2s-generic.c:53:     FULLROUND(3);
+	.loc 1 53 2135 view .LVU1352
+	addl	%ecx, %r12d	# _511, _512
+# blake2s-generic.c:53:     FULLROUND(3);
+	.loc 1 53 2097 view .LVU1353
+	movl	%ecx, 52(%rax)	# _511, MEM[(u32 *)v_1(D) + 52B]
+	.loc 1 53 2127 is_stmt 1 view .LVU1354
+# blake2s-generic.c:53:     FULLROUND(3);
+	.loc 1 53 2157 is_stmt 0 view .LVU1355
+	xorl	%r12d, %r11d	# _512, tmp1635
+# blake2s-generic.c:53:     FULLROUND(3);
+	.loc 1 53 2135 view .LVU1356
+	movl	%r12d, 32(%rax)	# _512, MEM[(u32 *)v_1(D) + 32B]
+	.loc 1 53 2147 is_stmt 1 view .LVU1357
+.LVL241:
+.LBB1557:
+.LBI1557:
+	.loc 1 5 19 view .LVU1358
+.LBB1558:
+	.loc 1 5 44 view .LVU1359
+# blake2s-generic.c:5: static inline u32 ror(unsigned l, u32 x) { return (x >> l) | (x << (32-l)); }
+	.loc 1 5 60 is_stmt 0 view .LVU1360
+	rorl	$7, %r11d	#, _514
+.LVL242:
+	.loc 1 5 60 view .LVU1361
+.LBE1558:
+.LBE1557:
+# blake2s-generic.c:53:     FULLROUND(3);
+	.loc 1 53 2155 view .LVU1362
+	movl	%r11d, 28(%rax)	# _514, MEM[(u32 *)v_1(D) + 28B]
+	.loc 1 53 1887 is_stmt 1 view .LVU1363
+	.loc 1 53 2198 view .LVU1364
+	.loc 1 53 2203 view .LVU1365
+# blake2s-generic.c:53:     FULLROUND(3);
+	.loc 1 53 2211 is_stmt 0 view .LVU1366
+	addl	60(%r9), %r10d	# MEM[(const u32 *)m_4(D) + 60B], tmp1636
+	addl	%r14d, %r10d	# _418, _517
+# blake2s-generic.c:53:     FULLROUND(3);
+	.loc 1 53 2265 view .LVU1367
+	xorl	%r10d, %r13d	# _517, tmp1638
+# blake2s-generic.c:53:     FULLROUND(3);
+	.loc 1 53 2211 view .LVU1368
+	movl	%r10d, 12(%rax)	# _517, MEM[(u32 *)v_1(D) + 12B]
+	.loc 1 53 2255 is_stmt 1 view .LVU1369
+.LVL243:
+.LBB1559:
+.LBI1559:
+	.loc 1 5 19 view .LVU1370
+.LBB1560:
+	.loc 1 5 44 view .LVU1371
+# blake2s-generic.c:5: static inline u32 ror(unsigned l, u32 x) { return (x >> l) | (x << (32-l)); }
+	.loc 1 5 60 is_stmt 0 view .LVU1372
+	roll	$16, %r13d	#, _519
+.LVL244:
+	.loc 1 5 60 view .LVU1373
+.LBE1560:
+.LBE1559:
+# blake2s-generic.c:53:     FULLROUND(3);
+	.loc 1 53 2301 view .LVU1374
+	addl	%r13d, %r15d	# _519, _520
+# blake2s-generic.c:53:     FULLROUND(3);
+	.loc 1 53 2263 view .LVU1375
+	movl	%r13d, 56(%rax)	# _519, MEM[(u32 *)v_1(D) + 56B]
+	.loc 1 53 2293 is_stmt 1 view .LVU1376
+# blake2s-generic.c:53:     FULLROUND(3);
+	.loc 1 53 2323 is_stmt 0 view .LVU1377
+	xorl	%r15d, %r14d	# _520, _418
+# blake2s-generic.c:53:     FULLROUND(3);
+	.loc 1 53 2301 view .LVU1378
+	movl	%r15d, 36(%rax)	# _520, MEM[(u32 *)v_1(D) + 36B]
+	.loc 1 53 2313 is_stmt 1 view .LVU1379
+.LVL245:
+.LBB1561:
+.LBI1561:
+	.loc 1 5 19 view .LVU1380
+.LBB1562:
+	.loc 1 5 44 view .LVU1381
+# blake2s-generic.c:5: static inline u32 ror(unsigned l, u32 x) { return (x >> l) | (x << (32-l)); }
+	.loc 1 5 60 is_stmt 0 view .LVU1382
+	rorl	$12, %r14d	#, _522
+.LVL246:
+	.loc 1 5 60 view .LVU1383
+.LBE1562:
+.LBE1561:
+# blake2s-generic.c:53:     FULLROUND(3);
+	.loc 1 53 2321 view .LVU1384
+	movl	%r14d, 16(%rax)	# _522, MEM[(u32 *)v_1(D) + 16B]
+	.loc 1 53 2351 is_stmt 1 view .LVU1385
+# blake2s-generic.c:53:     FULLROUND(3);
+	.loc 1 53 2359 is_stmt 0 view .LVU1386
+	addl	32(%r9), %r10d	# MEM[(const u32 *)m_4(D) + 32B], tmp1640
+	addl	%r14d, %r10d	# _522, _525
+# blake2s-generic.c:53:     FULLROUND(3);
+	.loc 1 53 2413 view .LVU1387
+	xorl	%r10d, %r13d	# _525, tmp1642
+# blake2s-generic.c:53:     FULLROUND(3);
+	.loc 1 53 2359 view .LVU1388
+	movl	%r10d, 12(%rax)	# _525, MEM[(u32 *)v_1(D) + 12B]
+	.loc 1 53 2403 is_stmt 1 view .LVU1389
+.LVL247:
+.LBB1563:
+.LBI1563:
+	.loc 1 5 19 view .LVU1390
+.LBB1564:
+	.loc 1 5 44 view .LVU1391
+# blake2s-generic.c:5: static inline u32 ror(unsigned l, u32 x) { return (x >> l) | (x << (32-l)); }
+	.loc 1 5 60 is_stmt 0 view .LVU1392
+	rorl	$8, %r13d	#, _527
+.LVL248:
+	.loc 1 5 60 view .LVU1393
+.LBE1564:
+.LBE1563:
+# blake2s-generic.c:53:     FULLROUND(3);
+	.loc 1 53 2449 view .LVU1394
+	addl	%r13d, %r15d	# _527, _528
+# blake2s-generic.c:53:     FULLROUND(3);
+	.loc 1 53 2411 view .LVU1395
+	movl	%r13d, 56(%rax)	# _527, MEM[(u32 *)v_1(D) + 56B]
+	.loc 1 53 2441 is_stmt 1 view .LVU1396
+# blake2s-generic.c:53:     FULLROUND(3);
+	.loc 1 53 2471 is_stmt 0 view .LVU1397
+	xorl	%r15d, %r14d	# _528, tmp1643
+# blake2s-generic.c:53:     FULLROUND(3);
+	.loc 1 53 2449 view .LVU1398
+	movl	%r15d, 36(%rax)	# _528, MEM[(u32 *)v_1(D) + 36B]
+	.loc 1 53 2461 is_stmt 1 view .LVU1399
+.LVL249:
+.LBB1565:
+.LBI1565:
+	.loc 1 5 19 view .LVU1400
+.LBB1566:
+	.loc 1 5 44 view .LVU1401
+# blake2s-generic.c:5: static inline u32 ror(unsigned l, u32 x) { return (x >> l) | (x << (32-l)); }
+	.loc 1 5 60 is_stmt 0 view .LVU1402
+	rorl	$7, %r14d	#, _530
+.LVL250:
+	.loc 1 5 60 view .LVU1403
+.LBE1566:
+.LBE1565:
+# blake2s-generic.c:53:     FULLROUND(3);
+	.loc 1 53 2469 view .LVU1404
+	movl	%r14d, 16(%rax)	# _530, MEM[(u32 *)v_1(D) + 16B]
+	.loc 1 53 2201 is_stmt 1 view .LVU1405
+	.loc 1 53 8 view .LVU1406
+	.loc 1 54 5 view .LVU1407
+	.loc 1 54 10 view .LVU1408
+	.loc 1 54 15 view .LVU1409
+# blake2s-generic.c:54:     FULLROUND(4);
+	.loc 1 54 23 is_stmt 0 view .LVU1410
+	addl	36(%r9), %r8d	# MEM[(const u32 *)m_4(D) + 36B], tmp1644
+	addl	%r14d, %r8d	# _530, _533
+# blake2s-generic.c:54:     FULLROUND(4);
+	.loc 1 54 76 view .LVU1411
+	xorl	%r8d, %edi	# _533, tmp1646
+# blake2s-generic.c:54:     FULLROUND(4);
+	.loc 1 54 23 view .LVU1412
+	movl	%r8d, (%rax)	# _533, *v_1(D)
+	.loc 1 54 66 is_stmt 1 view .LVU1413
+.LVL251:
+.LBB1567:
+.LBI1567:
+	.loc 1 5 19 view .LVU1414
+.LBB1568:
+	.loc 1 5 44 view .LVU1415
+# blake2s-generic.c:5: static inline u32 ror(unsigned l, u32 x) { return (x >> l) | (x << (32-l)); }
+	.loc 1 5 60 is_stmt 0 view .LVU1416
+	roll	$16, %edi	#, _535
+.LVL252:
+	.loc 1 5 60 view .LVU1417
+.LBE1568:
+.LBE1567:
+# blake2s-generic.c:54:     FULLROUND(4);
+	.loc 1 54 112 view .LVU1418
+	addl	%edi, %r12d	# _535, _536
+# blake2s-generic.c:54:     FULLROUND(4);
+	.loc 1 54 74 view .LVU1419
+	movl	%edi, 48(%rax)	# _535, MEM[(u32 *)v_1(D) + 48B]
+	.loc 1 54 104 is_stmt 1 view .LVU1420
+# blake2s-generic.c:54:     FULLROUND(4);
+	.loc 1 54 134 is_stmt 0 view .LVU1421
+	xorl	%r12d, %r14d	# _536, tmp1647
+# blake2s-generic.c:54:     FULLROUND(4);
+	.loc 1 54 112 view .LVU1422
+	movl	%r12d, 32(%rax)	# _536, MEM[(u32 *)v_1(D) + 32B]
+	.loc 1 54 124 is_stmt 1 view .LVU1423
+.LVL253:
+.LBB1569:
+.LBI1569:
+	.loc 1 5 19 view .LVU1424
+.LBB1570:
+	.loc 1 5 44 view .LVU1425
+# blake2s-generic.c:5: static inline u32 ror(unsigned l, u32 x) { return (x >> l) | (x << (32-l)); }
+	.loc 1 5 60 is_stmt 0 view .LVU1426
+	rorl	$12, %r14d	#, _538
+.LVL254:
+	.loc 1 5 60 view .LVU1427
+.LBE1570:
+.LBE1569:
+# blake2s-generic.c:54:     FULLROUND(4);
+	.loc 1 54 132 view .LVU1428
+	movl	%r14d, 16(%rax)	# _538, MEM[(u32 *)v_1(D) + 16B]
+	.loc 1 54 162 is_stmt 1 view .LVU1429
+# blake2s-generic.c:54:     FULLROUND(4);
+	.loc 1 54 170 is_stmt 0 view .LVU1430
+	addl	(%r9), %r8d	# *m_4(D), tmp1648
+	addl	%r14d, %r8d	# _538, _541
+# blake2s-generic.c:54:     FULLROUND(4);
+	.loc 1 54 223 view .LVU1431
+	xorl	%r8d, %edi	# _541, tmp1650
+# blake2s-generic.c:54:     FULLROUND(4);
+	.loc 1 54 170 view .LVU1432
+	movl	%r8d, (%rax)	# _541, *v_1(D)
+	.loc 1 54 213 is_stmt 1 view .LVU1433
+.LVL255:
+.LBB1571:
+.LBI1571:
+	.loc 1 5 19 view .LVU1434
+.LBB1572:
+	.loc 1 5 44 view .LVU1435
+# blake2s-generic.c:5: static inline u32 ror(unsigned l, u32 x) { return (x >> l) | (x << (32-l)); }
+	.loc 1 5 60 is_stmt 0 view .LVU1436
+	rorl	$8, %edi	#, _543
+.LVL256:
+	.loc 1 5 60 view .LVU1437
+.LBE1572:
+.LBE1571:
+# blake2s-generic.c:54:     FULLROUND(4);
+	.loc 1 54 259 view .LVU1438
+	addl	%edi, %r12d	# _543, _544
+# blake2s-generic.c:54:     FULLROUND(4);
+	.loc 1 54 221 view .LVU1439
+	movl	%edi, 48(%rax)	# _543, MEM[(u32 *)v_1(D) + 48B]
+	.loc 1 54 251 is_stmt 1 view .LVU1440
+# blake2s-generic.c:54:     FULLROUND(4);
+	.loc 1 54 281 is_stmt 0 view .LVU1441
+	xorl	%r12d, %r14d	# _544, tmp1651
+# blake2s-generic.c:54:     FULLROUND(4);
+	.loc 1 54 259 view .LVU1442
+	movl	%r12d, 32(%rax)	# _544, MEM[(u32 *)v_1(D) + 32B]
+	.loc 1 54 271 is_stmt 1 view .LVU1443
+.LVL257:
+.LBB1573:
+.LBI1573:
+	.loc 1 5 19 view .LVU1444
+.LBB1574:
+	.loc 1 5 44 view .LVU1445
+# blake2s-generic.c:5: static inline u32 ror(unsigned l, u32 x) { return (x >> l) | (x << (32-l)); }
+	.loc 1 5 60 is_stmt 0 view .LVU1446
+	rorl	$7, %r14d	#, tmp1651
+.LBE1574:
+.LBE1573:
+# blake2s-generic.c:54:     FULLROUND(4);
+	.loc 1 54 281 view .LVU1447
+	movl	%r12d, -28(%rsp)	# _544, %sfp
+# blake2s-generic.c:54:     FULLROUND(4);
+	.loc 1 54 1012 view .LVU1448
+	movl	-16(%rsp), %r12d	# %sfp, _479
+# blake2s-generic.c:54:     FULLROUND(4);
+	.loc 1 54 279 view .LVU1449
+	movl	%r14d, 16(%rax)	# _546, MEM[(u32 *)v_1(D) + 16B]
+	.loc 1 54 13 is_stmt 1 view .LVU1450
+	.loc 1 54 322 view .LVU1451
+	.loc 1 54 327 view .LVU1452
+# blake2s-generic.c:54:     FULLROUND(4);
+	.loc 1 54 335 is_stmt 0 view .LVU1453
+	addl	20(%r9), %esi	# MEM[(const u32 *)m_4(D) + 20B], tmp1652
+	addl	%ebp, %esi	# _482, _549
+# blake2s-generic.c:54:     FULLROUND(4);
+	.loc 1 54 279 view .LVU1454
+	movl	%r14d, -24(%rsp)	# _546, %sfp
+# blake2s-generic.c:54:     FULLROUND(4);
+	.loc 1 54 388 view .LVU1455
+	xorl	%esi, %ecx	# _549, tmp1654
+# blake2s-generic.c:54:     FULLROUND(4);
+	.loc 1 54 335 view .LVU1456
+	movl	%esi, 4(%rax)	# _549, MEM[(u32 *)v_1(D) + 4B]
+	.loc 1 54 378 is_stmt 1 view .LVU1457
+.LVL258:
+.LBB1575:
+.LBI1575:
+	.loc 1 5 19 view .LVU1458
+.LBB1576:
+	.loc 1 5 44 view .LVU1459
+# blake2s-generic.c:5: static inline u32 ror(unsigned l, u32 x) { return (x >> l) | (x << (32-l)); }
+	.loc 1 5 60 is_stmt 0 view .LVU1460
+	roll	$16, %ecx	#, _551
+.LVL259:
+	.loc 1 5 60 view .LVU1461
+.LBE1576:
+.LBE1575:
+# blake2s-generic.c:54:     FULLROUND(4);
+	.loc 1 54 424 view .LVU1462
+	addl	%ecx, %r15d	# _551, _552
+# blake2s-generic.c:54:     FULLROUND(4);
+	.loc 1 54 386 view .LVU1463
+	movl	%ecx, 52(%rax)	# _551, MEM[(u32 *)v_1(D) + 52B]
+	.loc 1 54 416 is_stmt 1 view .LVU1464
+# blake2s-generic.c:54:     FULLROUND(4);
+	.loc 1 54 446 is_stmt 0 view .LVU1465
+	xorl	%r15d, %ebp	# _552, tmp1655
+# blake2s-generic.c:54:     FULLROUND(4);
+	.loc 1 54 424 view .LVU1466
+	movl	%r15d, 36(%rax)	# _552, MEM[(u32 *)v_1(D) + 36B]
+	.loc 1 54 436 is_stmt 1 view .LVU1467
+.LVL260:
+.LBB1577:
+.LBI1577:
+	.loc 1 5 19 view .LVU1468
+.LBB1578:
+	.loc 1 5 44 view .LVU1469
+# blake2s-generic.c:5: static inline u32 ror(unsigned l, u32 x) { return (x >> l) | (x << (32-l)); }
+	.loc 1 5 60 is_stmt 0 view .LVU1470
+	rorl	$12, %ebp	#, _554
+.LVL261:
+	.loc 1 5 60 view .LVU1471
+.LBE1578:
+.LBE1577:
+# blake2s-generic.c:54:     FULLROUND(4);
+	.loc 1 54 444 view .LVU1472
+	movl	%ebp, 20(%rax)	# _554, MEM[(u32 *)v_1(D) + 20B]
+	.loc 1 54 474 is_stmt 1 view .LVU1473
+# blake2s-generic.c:54:     FULLROUND(4);
+	.loc 1 54 482 is_stmt 0 view .LVU1474
+	addl	28(%r9), %esi	# MEM[(const u32 *)m_4(D) + 28B], tmp1656
+	addl	%ebp, %esi	# _554, _557
+# blake2s-generic.c:54:     FULLROUND(4);
+	.loc 1 54 535 view .LVU1475
+	xorl	%esi, %ecx	# _557, tmp1658
+# blake2s-generic.c:54:     FULLROUND(4);
+	.loc 1 54 482 view .LVU1476
+	movl	%esi, 4(%rax)	# _557, MEM[(u32 *)v_1(D) + 4B]
+	.loc 1 54 525 is_stmt 1 view .LVU1477
+.LVL262:
+.LBB1579:
+.LBI1579:
+	.loc 1 5 19 view .LVU1478
+.LBB1580:
+	.loc 1 5 44 view .LVU1479
+# blake2s-generic.c:5: static inline u32 ror(unsigned l, u32 x) { return (x >> l) | (x << (32-l)); }
+	.loc 1 5 60 is_stmt 0 view .LVU1480
+	rorl	$8, %ecx	#, _559
+.LVL263:
+	.loc 1 5 60 view .LVU1481
+.LBE1580:
+.LBE1579:
+# blake2s-generic.c:54:     FULLROUND(4);
+	.loc 1 54 571 view .LVU1482
+	addl	%ecx, %r15d	# _559, _560
+# blake2s-generic.c:54:     FULLROUND(4);
+	.loc 1 54 533 view .LVU1483
+	movl	%ecx, 52(%rax)	# _559, MEM[(u32 *)v_1(D) + 52B]
+	.loc 1 54 563 is_stmt 1 view .LVU1484
+# blake2s-generic.c:54:     FULLROUND(4);
+	.loc 1 54 593 is_stmt 0 view .LVU1485
+	xorl	%r15d, %ebp	# _560, tmp1659
+# blake2s-generic.c:54:     FULLROUND(4);
+	.loc 1 54 571 view .LVU1486
+	movl	%r15d, 36(%rax)	# _560, MEM[(u32 *)v_1(D) + 36B]
+	.loc 1 54 583 is_stmt 1 view .LVU1487
+.LVL264:
+.LBB1581:
+.LBI1581:
+	.loc 1 5 19 view .LVU1488
+.LBB1582:
+	.loc 1 5 44 view .LVU1489
+# blake2s-generic.c:5: static inline u32 ror(unsigned l, u32 x) { return (x >> l) | (x << (32-l)); }
+	.loc 1 5 60 is_stmt 0 view .LVU1490
+	rorl	$7, %ebp	#, _562
+.LVL265:
+	.loc 1 5 60 view .LVU1491
+.LBE1582:
+.LBE1581:
+# blake2s-generic.c:54:     FULLROUND(4);
+	.loc 1 54 593 view .LVU1492
+	movl	%r15d, -20(%rsp)	# _560, %sfp
+# blake2s-generic.c:54:     FULLROUND(4);
+	.loc 1 54 736 view .LVU1493
+	movl	-12(%rsp), %r15d	# %sfp, _480
+# blake2s-generic.c:54:     FULLROUND(4);
+	.loc 1 54 591 view .LVU1494
+	movl	%ebp, 20(%rax)	# _562, MEM[(u32 *)v_1(D) + 20B]
+	.loc 1 54 325 is_stmt 1 view .LVU1495
+	.loc 1 54 634 view .LVU1496
+	.loc 1 54 639 view .LVU1497
+# blake2s-generic.c:54:     FULLROUND(4);
+	.loc 1 54 647 is_stmt 0 view .LVU1498
+	addl	8(%r9), %edx	# MEM[(const u32 *)m_4(D) + 8B], tmp1660
+	addl	%ebx, %edx	# _498, _565
+# blake2s-generic.c:54:     FULLROUND(4);
+	.loc 1 54 700 view .LVU1499
+	xorl	%edx, %r13d	# _565, tmp1662
+# blake2s-generic.c:54:     FULLROUND(4);
+	.loc 1 54 647 view .LVU1500
+	movl	%edx, 8(%rax)	# _565, MEM[(u32 *)v_1(D) + 8B]
+	.loc 1 54 690 is_stmt 1 view .LVU1501
+.LVL266:
+.LBB1583:
+.LBI1583:
+	.loc 1 5 19 view .LVU1502
+.LBB1584:
+	.loc 1 5 44 view .LVU1503
+# blake2s-generic.c:5: static inline u32 ror(unsigned l, u32 x) { return (x >> l) | (x << (32-l)); }
+	.loc 1 5 60 is_stmt 0 view .LVU1504
+	roll	$16, %r13d	#, _567
+.LVL267:
+	.loc 1 5 60 view .LVU1505
+.LBE1584:
+.LBE1583:
+# blake2s-generic.c:54:     FULLROUND(4);
+	.loc 1 54 736 view .LVU1506
+	leal	(%r15,%r13), %r14d	#, _568
+# blake2s-generic.c:54:     FULLROUND(4);
+	.loc 1 54 698 view .LVU1507
+	movl	%r13d, 56(%rax)	# _567, MEM[(u32 *)v_1(D) + 56B]
+	.loc 1 54 728 is_stmt 1 view .LVU1508
+# blake2s-generic.c:54:     FULLROUND(4);
+	.loc 1 54 758 is_stmt 0 view .LVU1509
+	xorl	%r14d, %ebx	# _568, tmp1663
+# blake2s-generic.c:54:     FULLROUND(4);
+	.loc 1 54 736 view .LVU1510
+	movl	%r14d, 40(%rax)	# _568, MEM[(u32 *)v_1(D) + 40B]
+	.loc 1 54 748 is_stmt 1 view .LVU1511
+.LVL268:
+.LBB1585:
+.LBI1585:
+	.loc 1 5 19 view .LVU1512
+.LBB1586:
+	.loc 1 5 44 view .LVU1513
+# blake2s-generic.c:5: static inline u32 ror(unsigned l, u32 x) { return (x >> l) | (x << (32-l)); }
+	.loc 1 5 60 is_stmt 0 view .LVU1514
+	rorl	$12, %ebx	#, _570
+.LVL269:
+	.loc 1 5 60 view .LVU1515
+.LBE1586:
+.LBE1585:
+# blake2s-generic.c:54:     FULLROUND(4);
+	.loc 1 54 756 view .LVU1516
+	movl	%ebx, 24(%rax)	# _570, MEM[(u32 *)v_1(D) + 24B]
+	.loc 1 54 786 is_stmt 1 view .LVU1517
+# blake2s-generic.c:54:     FULLROUND(4);
+	.loc 1 54 794 is_stmt 0 view .LVU1518
+	addl	16(%r9), %edx	# MEM[(const u32 *)m_4(D) + 16B], tmp1664
+	addl	%ebx, %edx	# _570, _573
+# blake2s-generic.c:54:     FULLROUND(4);
+	.loc 1 54 847 view .LVU1519
+	xorl	%edx, %r13d	# _573, tmp1666
+# blake2s-generic.c:54:     FULLROUND(4);
+	.loc 1 54 794 view .LVU1520
+	movl	%edx, 8(%rax)	# _573, MEM[(u32 *)v_1(D) + 8B]
+	.loc 1 54 837 is_stmt 1 view .LVU1521
+.LVL270:
+.LBB1587:
+.LBI1587:
+	.loc 1 5 19 view .LVU1522
+.LBB1588:
+	.loc 1 5 44 view .LVU1523
+# blake2s-generic.c:5: static inline u32 ror(unsigned l, u32 x) { return (x >> l) | (x << (32-l)); }
+	.loc 1 5 60 is_stmt 0 view .LVU1524
+	rorl	$8, %r13d	#, _575
+.LVL271:
+	.loc 1 5 60 view .LVU1525
+.LBE1588:
+.LBE1587:
+# blake2s-generic.c:54:     FULLROUND(4);
+	.loc 1 54 883 view .LVU1526
+	addl	%r13d, %r14d	# _575, _576
+# blake2s-generic.c:54:     FULLROUND(4);
+	.loc 1 54 845 view .LVU1527
+	movl	%r13d, 56(%rax)	# _575, MEM[(u32 *)v_1(D) + 56B]
+	.loc 1 54 875 is_stmt 1 view .LVU1528
+# blake2s-generic.c:54:     FULLROUND(4);
+	.loc 1 54 905 is_stmt 0 view .LVU1529
+	xorl	%r14d, %ebx	# _576, tmp1667
+# blake2s-generic.c:54:     FULLROUND(4);
+	.loc 1 54 883 view .LVU1530
+	movl	%r14d, 40(%rax)	# _576, MEM[(u32 *)v_1(D) + 40B]
+	.loc 1 54 895 is_stmt 1 view .LVU1531
+.LVL272:
+.LBB1589:
+.LBI1589:
+	.loc 1 5 19 view .LVU1532
+.LBB1590:
+	.loc 1 5 44 view .LVU1533
+# blake2s-generic.c:5: static inline u32 ror(unsigned l, u32 x) { return (x >> l) | (x << (32-l)); }
+	.loc 1 5 60 is_stmt 0 view .LVU1534
+	rorl	$7, %ebx	#, _578
+.LVL273:
+	.loc 1 5 60 view .LVU1535
+.LBE1590:
+.LBE1589:
+# blake2s-generic.c:54:     FULLROUND(4);
+	.loc 1 54 903 view .LVU1536
+	movl	%ebx, 24(%rax)	# _578, MEM[(u32 *)v_1(D) + 24B]
+	.loc 1 54 637 is_stmt 1 view .LVU1537
+	.loc 1 54 946 view .LVU1538
+	.loc 1 54 951 view .LVU1539
+# blake2s-generic.c:54:     FULLROUND(4);
+	.loc 1 54 959 is_stmt 0 view .LVU1540
+	addl	40(%r9), %r10d	# MEM[(const u32 *)m_4(D) + 40B], tmp1668
+	addl	%r11d, %r10d	# _514, _581
+# blake2s-generic.c:54:     FULLROUND(4);
+	.loc 1 54 1012 view .LVU1541
+	xorl	%r10d, %r12d	# _581, _479
+# blake2s-generic.c:54:     FULLROUND(4);
+	.loc 1 54 959 view .LVU1542
+	movl	%r10d, 12(%rax)	# _581, MEM[(u32 *)v_1(D) + 12B]
+	.loc 1 54 1002 is_stmt 1 view .LVU1543
+.LVL274:
+.LBB1591:
+.LBI1591:
+	.loc 1 5 19 view .LVU1544
+.LBB1592:
+	.loc 1 5 44 view .LVU1545
+# blake2s-generic.c:5: static inline u32 ror(unsigned l, u32 x) { return (x >> l) | (x << (32-l)); }
+	.loc 1 5 60 is_stmt 0 view .LVU1546
+	roll	$16, %r12d	#, _583
+.LVL275:
+	.loc 1 5 60 view .LVU1547
+.LBE1592:
+.LBE1591:
+# blake2s-generic.c:54:     FULLROUND(4);
+	.loc 1 54 1010 view .LVU1548
+	movl	%r12d, 60(%rax)	# _583, MEM[(u32 *)v_1(D) + 60B]
+	.loc 1 54 1040 is_stmt 1 view .LVU1549
+# blake2s-generic.c:54:     FULLROUND(4);
+	.loc 1 54 1048 is_stmt 0 view .LVU1550
+	movl	-8(%rsp), %r15d	# %sfp, _496
+	addl	%r12d, %r15d	# _583, _584
+# blake2s-generic.c:54:     FULLROUND(4);
+	.loc 1 54 1070 view .LVU1551
+	xorl	%r15d, %r11d	# _584, tmp1671
+# blake2s-generic.c:54:     FULLROUND(4);
+	.loc 1 54 1048 view .LVU1552
+	movl	%r15d, 44(%rax)	# _584, MEM[(u32 *)v_1(D) + 44B]
+	.loc 1 54 1060 is_stmt 1 view .LVU1553
+.LVL276:
+.LBB1593:
+.LBI1593:
+	.loc 1 5 19 view .LVU1554
+.LBB1594:
+	.loc 1 5 44 view .LVU1555
+# blake2s-generic.c:5: static inline u32 ror(unsigned l, u32 x) { return (x >> l) | (x << (32-l)); }
+	.loc 1 5 60 is_stmt 0 view .LVU1556
+	rorl	$12, %r11d	#, _586
+.LVL277:
+	.loc 1 5 60 view .LVU1557
+.LBE1594:
+.LBE1593:
+# blake2s-generic.c:54:     FULLROUND(4);
+	.loc 1 54 1068 view .LVU1558
+	movl	%r11d, 28(%rax)	# _586, MEM[(u32 *)v_1(D) + 28B]
+	.loc 1 54 1098 is_stmt 1 view .LVU1559
+# blake2s-generic.c:54:     FULLROUND(4);
+	.loc 1 54 1106 is_stmt 0 view .LVU1560
+	addl	60(%r9), %r10d	# MEM[(const u32 *)m_4(D) + 60B], tmp1672
+	addl	%r11d, %r10d	# _586, _589
+# blake2s-generic.c:54:     FULLROUND(4);
+	.loc 1 54 1159 view .LVU1561
+	xorl	%r10d, %r12d	# _589, tmp1674
+# blake2s-generic.c:54:     FULLROUND(4);
+	.loc 1 54 1106 view .LVU1562
+	movl	%r10d, 12(%rax)	# _589, MEM[(u32 *)v_1(D) + 12B]
+	.loc 1 54 1149 is_stmt 1 view .LVU1563
+.LVL278:
+.LBB1595:
+.LBI1595:
+	.loc 1 5 19 view .LVU1564
+.LBB1596:
+	.loc 1 5 44 view .LVU1565
+# blake2s-generic.c:5: static inline u32 ror(unsigned l, u32 x) { return (x >> l) | (x << (32-l)); }
+	.loc 1 5 60 is_stmt 0 view .LVU1566
+	rorl	$8, %r12d	#, _591
+.LVL279:
+	.loc 1 5 60 view .LVU1567
+.LBE1596:
+.LBE1595:
+# blake2s-generic.c:54:     FULLROUND(4);
+	.loc 1 54 1195 view .LVU1568
+	addl	%r12d, %r15d	# _591, _592
+# blake2s-generic.c:54:     FULLROUND(4);
+	.loc 1 54 1157 view .LVU1569
+	movl	%r12d, 60(%rax)	# _591, MEM[(u32 *)v_1(D) + 60B]
+	.loc 1 54 1187 is_stmt 1 view .LVU1570
+# blake2s-generic.c:54:     FULLROUND(4);
+	.loc 1 54 1217 is_stmt 0 view .LVU1571
+	xorl	%r15d, %r11d	# _592, tmp1675
+# blake2s-generic.c:54:     FULLROUND(4);
+	.loc 1 54 1195 view .LVU1572
+	movl	%r15d, 44(%rax)	# _592, MEM[(u32 *)v_1(D) + 44B]
+	.loc 1 54 1207 is_stmt 1 view .LVU1573
+.LVL280:
+.LBB1597:
+.LBI1597:
+	.loc 1 5 19 view .LVU1574
+.LBB1598:
+	.loc 1 5 44 view .LVU1575
+# blake2s-generic.c:5: static inline u32 ror(unsigned l, u32 x) { return (x >> l) | (x << (32-l)); }
+	.loc 1 5 60 is_stmt 0 view .LVU1576
+	rorl	$7, %r11d	#, _594
+.LVL281:
+	.loc 1 5 60 view .LVU1577
+.LBE1598:
+.LBE1597:
+# blake2s-generic.c:54:     FULLROUND(4);
+	.loc 1 54 1215 view .LVU1578
+	movl	%r11d, 28(%rax)	# _594, MEM[(u32 *)v_1(D) + 28B]
+	.loc 1 54 949 is_stmt 1 view .LVU1579
+	.loc 1 54 1258 view .LVU1580
+	.loc 1 54 1263 view .LVU1581
+# blake2s-generic.c:54:     FULLROUND(4);
+	.loc 1 54 1271 is_stmt 0 view .LVU1582
+	addl	56(%r9), %r8d	# MEM[(const u32 *)m_4(D) + 56B], tmp1676
+	addl	%ebp, %r8d	# _562, _597
+# blake2s-generic.c:54:     FULLROUND(4);
+	.loc 1 54 1324 view .LVU1583
+	xorl	%r8d, %r12d	# _597, tmp1678
+# blake2s-generic.c:54:     FULLROUND(4);
+	.loc 1 54 1271 view .LVU1584
+	movl	%r8d, (%rax)	# _597, *v_1(D)
+	.loc 1 54 1314 is_stmt 1 view .LVU1585
+.LVL282:
+.LBB1599:
+.LBI1599:
+	.loc 1 5 19 view .LVU1586
+.LBB1600:
+	.loc 1 5 44 view .LVU1587
+# blake2s-generic.c:5: static inline u32 ror(unsigned l, u32 x) { return (x >> l) | (x << (32-l)); }
+	.loc 1 5 60 is_stmt 0 view .LVU1588
+	roll	$16, %r12d	#, _599
+.LVL283:
+	.loc 1 5 60 view .LVU1589
+.LBE1600:
+.LBE1599:
+# blake2s-generic.c:54:     FULLROUND(4);
+	.loc 1 54 1360 view .LVU1590
+	addl	%r12d, %r14d	# _599, _600
+# blake2s-generic.c:54:     FULLROUND(4);
+	.loc 1 54 1322 view .LVU1591
+	movl	%r12d, 60(%rax)	# _599, MEM[(u32 *)v_1(D) + 60B]
+	.loc 1 54 1352 is_stmt 1 view .LVU1592
+# blake2s-generic.c:54:     FULLROUND(4);
+	.loc 1 54 1382 is_stmt 0 view .LVU1593
+	xorl	%r14d, %ebp	# _600, tmp1679
+# blake2s-generic.c:54:     FULLROUND(4);
+	.loc 1 54 1360 view .LVU1594
+	movl	%r14d, 40(%rax)	# _600, MEM[(u32 *)v_1(D) + 40B]
+	.loc 1 54 1372 is_stmt 1 view .LVU1595
+.LVL284:
+.LBB1601:
+.LBI1601:
+	.loc 1 5 19 view .LVU1596
+.LBB1602:
+	.loc 1 5 44 view .LVU1597
+# blake2s-generic.c:5: static inline u32 ror(unsigned l, u32 x) { return (x >> l) | (x << (32-l)); }
+	.loc 1 5 60 is_stmt 0 view .LVU1598
+	rorl	$12, %ebp	#, _602
+.LVL285:
+	.loc 1 5 60 view .LVU1599
+.LBE1602:
+.LBE1601:
+# blake2s-generic.c:54:     FULLROUND(4);
+	.loc 1 54 1380 view .LVU1600
+	movl	%ebp, 20(%rax)	# _602, MEM[(u32 *)v_1(D) + 20B]
+	.loc 1 54 1410 is_stmt 1 view .LVU1601
+# blake2s-generic.c:54:     FULLROUND(4);
+	.loc 1 54 1418 is_stmt 0 view .LVU1602
+	addl	4(%r9), %r8d	# MEM[(const u32 *)m_4(D) + 4B], tmp1680
+	addl	%ebp, %r8d	# _602, _605
+# blake2s-generic.c:54:     FULLROUND(4);
+	.loc 1 54 1471 view .LVU1603
+	xorl	%r8d, %r12d	# _605, tmp1682
+# blake2s-generic.c:54:     FULLROUND(4);
+	.loc 1 54 1418 view .LVU1604
+	movl	%r8d, (%rax)	# _605, *v_1(D)
+	.loc 1 54 1461 is_stmt 1 view .LVU1605
+.LVL286:
+.LBB1603:
+.LBI1603:
+	.loc 1 5 19 view .LVU1606
+.LBB1604:
+	.loc 1 5 44 view .LVU1607
+# blake2s-generic.c:5: static inline u32 ror(unsigned l, u32 x) { return (x >> l) | (x << (32-l)); }
+	.loc 1 5 60 is_stmt 0 view .LVU1608
+	rorl	$8, %r12d	#, tmp1682
+.LBE1604:
+.LBE1603:
+# blake2s-generic.c:54:     FULLROUND(4);
+	.loc 1 54 1507 view .LVU1609
+	addl	%r12d, %r14d	# _607, _608
+# blake2s-generic.c:54:     FULLROUND(4);
+	.loc 1 54 1469 view .LVU1610
+	movl	%r12d, 60(%rax)	# _607, MEM[(u32 *)v_1(D) + 60B]
+	.loc 1 54 1499 is_stmt 1 view .LVU1611
+# blake2s-generic.c:54:     FULLROUND(4);
+	.loc 1 54 1529 is_stmt 0 view .LVU1612
+	xorl	%r14d, %ebp	# _608, tmp1683
+# blake2s-generic.c:54:     FULLROUND(4);
+	.loc 1 54 1507 view .LVU1613
+	movl	%r14d, 40(%rax)	# _608, MEM[(u32 *)v_1(D) + 40B]
+	.loc 1 54 1519 is_stmt 1 view .LVU1614
+.LVL287:
+.LBB1605:
+.LBI1605:
+	.loc 1 5 19 view .LVU1615
+.LBB1606:
+	.loc 1 5 44 view .LVU1616
+# blake2s-generic.c:5: static inline u32 ror(unsigned l, u32 x) { return (x >> l) | (x << (32-l)); }
+	.loc 1 5 60 is_stmt 0 view .LVU1617
+	rorl	$7, %ebp	#, _610
+.LVL288:
+	.loc 1 5 60 view .LVU1618
+.LBE1606:
+.LBE1605:
+# blake2s-generic.c:54:     FULLROUND(4);
+	.loc 1 54 1507 view .LVU1619
+	movl	%r12d, -16(%rsp)	# _607, %sfp
+# blake2s-generic.c:54:     FULLROUND(4);
+	.loc 1 54 1527 view .LVU1620
+	movl	%ebp, 20(%rax)	# _610, MEM[(u32 *)v_1(D) + 20B]
+	.loc 1 54 1261 is_stmt 1 view .LVU1621
+	.loc 1 54 1570 view .LVU1622
+	.loc 1 54 1575 view .LVU1623
+# blake2s-generic.c:54:     FULLROUND(4);
+	.loc 1 54 1583 is_stmt 0 view .LVU1624
+	addl	44(%r9), %esi	# MEM[(const u32 *)m_4(D) + 44B], tmp1684
+	addl	%ebx, %esi	# _578, _613
+# blake2s-generic.c:54:     FULLROUND(4);
+	.loc 1 54 1529 view .LVU1625
+	movl	%r14d, -12(%rsp)	# _608, %sfp
+# blake2s-generic.c:54:     FULLROUND(4);
+	.loc 1 54 1637 view .LVU1626
+	xorl	%esi, %edi	# _613, tmp1686
+# blake2s-generic.c:54:     FULLROUND(4);
+	.loc 1 54 1583 view .LVU1627
+	movl	%esi, 4(%rax)	# _613, MEM[(u32 *)v_1(D) + 4B]
+	.loc 1 54 1627 is_stmt 1 view .LVU1628
+.LVL289:
+.LBB1607:
+.LBI1607:
+	.loc 1 5 19 view .LVU1629
+.LBB1608:
+	.loc 1 5 44 view .LVU1630
+# blake2s-generic.c:5: static inline u32 ror(unsigned l, u32 x) { return (x >> l) | (x << (32-l)); }
+	.loc 1 5 60 is_stmt 0 view .LVU1631
+	roll	$16, %edi	#, _615
+.LVL290:
+	.loc 1 5 60 view .LVU1632
+.LBE1608:
+.LBE1607:
+# blake2s-generic.c:54:     FULLROUND(4);
+	.loc 1 54 1673 view .LVU1633
+	addl	%edi, %r15d	# _615, _616
+# blake2s-generic.c:54:     FULLROUND(4);
+	.loc 1 54 1635 view .LVU1634
+	movl	%edi, 48(%rax)	# _615, MEM[(u32 *)v_1(D) + 48B]
+	.loc 1 54 1665 is_stmt 1 view .LVU1635
+# blake2s-generic.c:54:     FULLROUND(4);
+	.loc 1 54 1695 is_stmt 0 view .LVU1636
+	xorl	%r15d, %ebx	# _616, tmp1687
+# blake2s-generic.c:54:     FULLROUND(4);
+	.loc 1 54 1673 view .LVU1637
+	movl	%r15d, 44(%rax)	# _616, MEM[(u32 *)v_1(D) + 44B]
+	.loc 1 54 1685 is_stmt 1 view .LVU1638
+.LVL291:
+.LBB1609:
+.LBI1609:
+	.loc 1 5 19 view .LVU1639
+.LBB1610:
+	.loc 1 5 44 view .LVU1640
+# blake2s-generic.c:5: static inline u32 ror(unsigned l, u32 x) { return (x >> l) | (x << (32-l)); }
+	.loc 1 5 60 is_stmt 0 view .LVU1641
+	rorl	$12, %ebx	#, _618
+.LVL292:
+	.loc 1 5 60 view .LVU1642
+.LBE1610:
+.LBE1609:
+# blake2s-generic.c:54:     FULLROUND(4);
+	.loc 1 54 1693 view .LVU1643
+	movl	%ebx, 24(%rax)	# _618, MEM[(u32 *)v_1(D) + 24B]
+	.loc 1 54 1723 is_stmt 1 view .LVU1644
+# blake2s-generic.c:54:     FULLROUND(4);
+	.loc 1 54 1731 is_stmt 0 view .LVU1645
+	addl	48(%r9), %esi	# MEM[(const u32 *)m_4(D) + 48B], tmp1688
+	addl	%ebx, %esi	# _618, _621
+# blake2s-generic.c:54:     FULLROUND(4);
+	.loc 1 54 1785 view .LVU1646
+	xorl	%esi, %edi	# _621, tmp1690
+# blake2s-generic.c:54:     FULLROUND(4);
+	.loc 1 54 1731 view .LVU1647
+	movl	%esi, 4(%rax)	# _621, MEM[(u32 *)v_1(D) + 4B]
+	.loc 1 54 1775 is_stmt 1 view .LVU1648
+.LVL293:
+.LBB1611:
+.LBI1611:
+	.loc 1 5 19 view .LVU1649
+.LBB1612:
+	.loc 1 5 44 view .LVU1650
+# blake2s-generic.c:5: static inline u32 ror(unsigned l, u32 x) { return (x >> l) | (x << (32-l)); }
+	.loc 1 5 60 is_stmt 0 view .LVU1651
+	rorl	$8, %edi	#, _623
+.LVL294:
+	.loc 1 5 60 view .LVU1652
+.LBE1612:
+.LBE1611:
+# blake2s-generic.c:54:     FULLROUND(4);
+	.loc 1 54 1821 view .LVU1653
+	addl	%edi, %r15d	# _623, _624
+# blake2s-generic.c:54:     FULLROUND(4);
+	.loc 1 54 1783 view .LVU1654
+	movl	%edi, 48(%rax)	# _623, MEM[(u32 *)v_1(D) + 48B]
+	.loc 1 54 1813 is_stmt 1 view .LVU1655
+# blake2s-generic.c:54:     FULLROUND(4);
+	.loc 1 54 1843 is_stmt 0 view .LVU1656
+	xorl	%r15d, %ebx	# _624, tmp1691
+# blake2s-generic.c:54:     FULLROUND(4);
+	.loc 1 54 1821 view .LVU1657
+	movl	%r15d, 44(%rax)	# _624, MEM[(u32 *)v_1(D) + 44B]
+	.loc 1 54 1833 is_stmt 1 view .LVU1658
+.LVL295:
+.LBB1613:
+.LBI1613:
+	.loc 1 5 19 view .LVU1659
+.LBB1614:
+	.loc 1 5 44 view .LVU1660
+# blake2s-generic.c:5: static inline u32 ror(unsigned l, u32 x) { return (x >> l) | (x << (32-l)); }
+	.loc 1 5 60 is_stmt 0 view .LVU1661
+	rorl	$7, %ebx	#, _626
+.LVL296:
+	.loc 1 5 60 view .LVU1662
+.LBE1614:
+.LBE1613:
+# blake2s-generic.c:54:     FULLROUND(4);
+	.loc 1 54 1843 view .LVU1663
+	movl	%r15d, -8(%rsp)	# _624, %sfp
+# blake2s-generic.c:54:     FULLROUND(4);
+	.loc 1 54 1841 view .LVU1664
+	movl	%ebx, 24(%rax)	# _626, MEM[(u32 *)v_1(D) + 24B]
+	.loc 1 54 1573 is_stmt 1 view .LVU1665
+	.loc 1 54 1884 view .LVU1666
+	.loc 1 54 1889 view .LVU1667
+# blake2s-generic.c:54:     FULLROUND(4);
+	.loc 1 54 1897 is_stmt 0 view .LVU1668
+	addl	24(%r9), %edx	# MEM[(const u32 *)m_4(D) + 24B], tmp1692
+	addl	%r11d, %edx	# _594, _629
+	movl	%edx, 8(%rax)	# _629, MEM[(u32 *)v_1(D) + 8B]
+	.loc 1 54 1941 is_stmt 1 view .LVU1669
+.LVL297:
+.LBB1615:
+.LBI1615:
+	.loc 1 5 19 view .LVU1670
+.LBB1616:
+	.loc 1 5 44 view .LVU1671
+.LBE1616:
+.LBE1615:
+# blake2s-generic.c:54:     FULLROUND(4);
+	.loc 1 54 1951 is_stmt 0 view .LVU1672
+	xorl	%edx, %ecx	# _629, tmp1694
+.LVL298:
+# blake2s-generic.c:54:     FULLROUND(4);
+	.loc 1 54 1987 view .LVU1673
+	movl	-28(%rsp), %r15d	# %sfp, _544
+.LBB1618:
+.LBB1617:
+# blake2s-generic.c:5: static inline u32 ror(unsigned l, u32 x) { return (x >> l) | (x << (32-l)); }
+	.loc 1 5 60 view .LVU1674
+	roll	$16, %ecx	#, _631
+.LVL299:
+	.loc 1 5 60 view .LVU1675
+.LBE1617:
+.LBE1618:
+# blake2s-generic.c:54:     FULLROUND(4);
+	.loc 1 54 2211 view .LVU1676
+	movl	-24(%rsp), %r14d	# %sfp, _546
+# blake2s-generic.c:54:     FULLROUND(4);
+	.loc 1 54 1987 view .LVU1677
+	leal	(%r15,%rcx), %r12d	#, _632
+# blake2s-generic.c:54:     FULLROUND(4);
+	.loc 1 54 1949 view .LVU1678
+	movl	%ecx, 52(%rax)	# _631, MEM[(u32 *)v_1(D) + 52B]
+	.loc 1 54 1979 is_stmt 1 view .LVU1679
+# blake2s-generic.c:54:     FULLROUND(4);
+	.loc 1 54 2301 is_stmt 0 view .LVU1680
+	movl	-20(%rsp), %r15d	# %sfp, _560
+# blake2s-generic.c:54:     FULLROUND(4);
+	.loc 1 54 2009 view .LVU1681
+	xorl	%r12d, %r11d	# _632, tmp1695
+# blake2s-generic.c:54:     FULLROUND(4);
+	.loc 1 54 1987 view .LVU1682
+	movl	%r12d, 32(%rax)	# _632, MEM[(u32 *)v_1(D) + 32B]
+	.loc 1 54 1999 is_stmt 1 view .LVU1683
+.LVL300:
+.LBB1619:
+.LBI1619:
+	.loc 1 5 19 view .LVU1684
+.LBB1620:
+	.loc 1 5 44 view .LVU1685
+# blake2s-generic.c:5: static inline u32 ror(unsigned l, u32 x) { return (x >> l) | (x << (32-l)); }
+	.loc 1 5 60 is_stmt 0 view .LVU1686
+	rorl	$12, %r11d	#, _634
+.LVL301:
+	.loc 1 5 60 view .LVU1687
+.LBE1620:
+.LBE1619:
+# blake2s-generic.c:54:     FULLROUND(4);
+	.loc 1 54 2007 view .LVU1688
+	movl	%r11d, 28(%rax)	# _634, MEM[(u32 *)v_1(D) + 28B]
+	.loc 1 54 2037 is_stmt 1 view .LVU1689
+# blake2s-generic.c:54:     FULLROUND(4);
+	.loc 1 54 2045 is_stmt 0 view .LVU1690
+	addl	32(%r9), %edx	# MEM[(const u32 *)m_4(D) + 32B], tmp1696
+	addl	%r11d, %edx	# _634, _637
+# blake2s-generic.c:54:     FULLROUND(4);
+	.loc 1 54 2099 view .LVU1691
+	xorl	%edx, %ecx	# _637, tmp1698
+# blake2s-generic.c:54:     FULLROUND(4);
+	.loc 1 54 2045 view .LVU1692
+	movl	%edx, 8(%rax)	# _637, MEM[(u32 *)v_1(D) + 8B]
+	.loc 1 54 2089 is_stmt 1 view .LVU1693
+.LVL302:
+.LBB1621:
+.LBI1621:
+	.loc 1 5 19 view .LVU1694
+.LBB1622:
+	.loc 1 5 44 view .LVU1695
+# blake2s-generic.c:5: static inline u32 ror(unsigned l, u32 x) { return (x >> l) | (x << (32-l)); }
+	.loc 1 5 60 is_stmt 0 view .LVU1696
+	rorl	$8, %ecx	#, _639
+.LVL303:
+	.loc 1 5 60 view .LVU1697
+.LBE1622:
+.LBE1621:
+# blake2s-generic.c:54:     FULLROUND(4);
+	.loc 1 54 2135 view .LVU1698
+	addl	%ecx, %r12d	# _639, _640
+# blake2s-generic.c:54:     FULLROUND(4);
+	.loc 1 54 2097 view .LVU1699
+	movl	%ecx, 52(%rax)	# _639, MEM[(u32 *)v_1(D) + 52B]
+	.loc 1 54 2127 is_stmt 1 view .LVU1700
+# blake2s-generic.c:54:     FULLROUND(4);
+	.loc 1 54 2157 is_stmt 0 view .LVU1701
+	xorl	%r12d, %r11d	# _640, tmp1699
+# blake2s-generic.c:54:     FULLROUND(4);
+	.loc 1 54 2135 view .LVU1702
+	movl	%r12d, 32(%rax)	# _640, MEM[(u32 *)v_1(D) + 32B]
+	.loc 1 54 2147 is_stmt 1 view .LVU1703
+.LVL304:
+.LBB1623:
+.LBI1623:
+	.loc 1 5 19 view .LVU1704
+.LBB1624:
+	.loc 1 5 44 view .LVU1705
+# blake2s-generic.c:5: static inline u32 ror(unsigned l, u32 x) { return (x >> l) | (x << (32-l)); }
+	.loc 1 5 60 is_stmt 0 view .LVU1706
+	rorl	$7, %r11d	#, _642
+.LVL305:
+	.loc 1 5 60 view .LVU1707
+.LBE1624:
+.LBE1623:
+# blake2s-generic.c:54:     FULLROUND(4);
+	.loc 1 54 2155 view .LVU1708
+	movl	%r11d, 28(%rax)	# _642, MEM[(u32 *)v_1(D) + 28B]
+	.loc 1 54 1887 is_stmt 1 view .LVU1709
+	.loc 1 54 2198 view .LVU1710
+	.loc 1 54 2203 view .LVU1711
+# blake2s-generic.c:54:     FULLROUND(4);
+	.loc 1 54 2211 is_stmt 0 view .LVU1712
+	addl	12(%r9), %r10d	# MEM[(const u32 *)m_4(D) + 12B], tmp1700
+	addl	%r14d, %r10d	# _546, _645
+# blake2s-generic.c:54:     FULLROUND(4);
+	.loc 1 54 2265 view .LVU1713
+	xorl	%r10d, %r13d	# _645, tmp1702
+# blake2s-generic.c:54:     FULLROUND(4);
+	.loc 1 54 2211 view .LVU1714
+	movl	%r10d, 12(%rax)	# _645, MEM[(u32 *)v_1(D) + 12B]
+	.loc 1 54 2255 is_stmt 1 view .LVU1715
+.LVL306:
+.LBB1625:
+.LBI1625:
+	.loc 1 5 19 view .LVU1716
+.LBB1626:
+	.loc 1 5 44 view .LVU1717
+# blake2s-generic.c:5: static inline u32 ror(unsigned l, u32 x) { return (x >> l) | (x << (32-l)); }
+	.loc 1 5 60 is_stmt 0 view .LVU1718
+	roll	$16, %r13d	#, _647
+.LVL307:
+	.loc 1 5 60 view .LVU1719
+.LBE1626:
+.LBE1625:
+# blake2s-generic.c:54:     FULLROUND(4);
+	.loc 1 54 2301 view .LVU1720
+	addl	%r13d, %r15d	# _647, _648
+# blake2s-generic.c:54:     FULLROUND(4);
+	.loc 1 54 2263 view .LVU1721
+	movl	%r13d, 56(%rax)	# _647, MEM[(u32 *)v_1(D) + 56B]
+	.loc 1 54 2293 is_stmt 1 view .LVU1722
+# blake2s-generic.c:54:     FULLROUND(4);
+	.loc 1 54 2323 is_stmt 0 view .LVU1723
+	xorl	%r15d, %r14d	# _648, _546
+# blake2s-generic.c:54:     FULLROUND(4);
+	.loc 1 54 2301 view .LVU1724
+	movl	%r15d, 36(%rax)	# _648, MEM[(u32 *)v_1(D) + 36B]
+	.loc 1 54 2313 is_stmt 1 view .LVU1725
+.LVL308:
+.LBB1627:
+.LBI1627:
+	.loc 1 5 19 view .LVU1726
+.LBB1628:
+	.loc 1 5 44 view .LVU1727
+# blake2s-generic.c:5: static inline u32 ror(unsigned l, u32 x) { return (x >> l) | (x << (32-l)); }
+	.loc 1 5 60 is_stmt 0 view .LVU1728
+	rorl	$12, %r14d	#, _650
+.LVL309:
+	.loc 1 5 60 view .LVU1729
+.LBE1628:
+.LBE1627:
+# blake2s-generic.c:54:     FULLROUND(4);
+	.loc 1 54 2321 view .LVU1730
+	movl	%r14d, 16(%rax)	# _650, MEM[(u32 *)v_1(D) + 16B]
+	.loc 1 54 2351 is_stmt 1 view .LVU1731
+# blake2s-generic.c:54:     FULLROUND(4);
+	.loc 1 54 2359 is_stmt 0 view .LVU1732
+	addl	52(%r9), %r10d	# MEM[(const u32 *)m_4(D) + 52B], tmp1704
+	addl	%r14d, %r10d	# _650, _653
+# blake2s-generic.c:54:     FULLROUND(4);
+	.loc 1 54 2413 view .LVU1733
+	xorl	%r10d, %r13d	# _653, tmp1706
+# blake2s-generic.c:54:     FULLROUND(4);
+	.loc 1 54 2359 view .LVU1734
+	movl	%r10d, 12(%rax)	# _653, MEM[(u32 *)v_1(D) + 12B]
+	.loc 1 54 2403 is_stmt 1 view .LVU1735
+.LVL310:
+.LBB1629:
+.LBI1629:
+	.loc 1 5 19 view .LVU1736
+.LBB1630:
+	.loc 1 5 44 view .LVU1737
+# blake2s-generic.c:5: static inline u32 ror(unsigned l, u32 x) { return (x >> l) | (x << (32-l)); }
+	.loc 1 5 60 is_stmt 0 view .LVU1738
+	rorl	$8, %r13d	#, _655
+.LVL311:
+	.loc 1 5 60 view .LVU1739
+.LBE1630:
+.LBE1629:
+# blake2s-generic.c:54:     FULLROUND(4);
+	.loc 1 54 2449 view .LVU1740
+	addl	%r13d, %r15d	# _655, _656
+# blake2s-generic.c:54:     FULLROUND(4);
+	.loc 1 54 2411 view .LVU1741
+	movl	%r13d, 56(%rax)	# _655, MEM[(u32 *)v_1(D) + 56B]
+	.loc 1 54 2441 is_stmt 1 view .LVU1742
+# blake2s-generic.c:54:     FULLROUND(4);
+	.loc 1 54 2471 is_stmt 0 view .LVU1743
+	xorl	%r15d, %r14d	# _656, tmp1707
+# blake2s-generic.c:54:     FULLROUND(4);
+	.loc 1 54 2449 view .LVU1744
+	movl	%r15d, 36(%rax)	# _656, MEM[(u32 *)v_1(D) + 36B]
+	.loc 1 54 2461 is_stmt 1 view .LVU1745
+.LVL312:
+.LBB1631:
+.LBI1631:
+	.loc 1 5 19 view .LVU1746
+.LBB1632:
+	.loc 1 5 44 view .LVU1747
+# blake2s-generic.c:5: static inline u32 ror(unsigned l, u32 x) { return (x >> l) | (x << (32-l)); }
+	.loc 1 5 60 is_stmt 0 view .LVU1748
+	rorl	$7, %r14d	#, _658
+.LVL313:
+	.loc 1 5 60 view .LVU1749
+.LBE1632:
+.LBE1631:
+# blake2s-generic.c:54:     FULLROUND(4);
+	.loc 1 54 2469 view .LVU1750
+	movl	%r14d, 16(%rax)	# _658, MEM[(u32 *)v_1(D) + 16B]
+	.loc 1 54 2201 is_stmt 1 view .LVU1751
+	.loc 1 54 8 view .LVU1752
+	.loc 1 55 5 view .LVU1753
+	.loc 1 55 10 view .LVU1754
+	.loc 1 55 15 view .LVU1755
+# blake2s-generic.c:55:     FULLROUND(5);
+	.loc 1 55 23 is_stmt 0 view .LVU1756
+	addl	8(%r9), %r8d	# MEM[(const u32 *)m_4(D) + 8B], tmp1708
+	addl	%r14d, %r8d	# _658, _661
+# blake2s-generic.c:55:     FULLROUND(5);
+	.loc 1 55 76 view .LVU1757
+	xorl	%r8d, %edi	# _661, tmp1710
+# blake2s-generic.c:55:     FULLROUND(5);
+	.loc 1 55 23 view .LVU1758
+	movl	%r8d, (%rax)	# _661, *v_1(D)
+	.loc 1 55 66 is_stmt 1 view .LVU1759
+.LVL314:
+.LBB1633:
+.LBI1633:
+	.loc 1 5 19 view .LVU1760
+.LBB1634:
+	.loc 1 5 44 view .LVU1761
+# blake2s-generic.c:5: static inline u32 ror(unsigned l, u32 x) { return (x >> l) | (x << (32-l)); }
+	.loc 1 5 60 is_stmt 0 view .LVU1762
+	roll	$16, %edi	#, _663
+.LVL315:
+	.loc 1 5 60 view .LVU1763
+.LBE1634:
+.LBE1633:
+# blake2s-generic.c:55:     FULLROUND(5);
+	.loc 1 55 112 view .LVU1764
+	addl	%edi, %r12d	# _663, _664
+# blake2s-generic.c:55:     FULLROUND(5);
+	.loc 1 55 74 view .LVU1765
+	movl	%edi, 48(%rax)	# _663, MEM[(u32 *)v_1(D) + 48B]
+	.loc 1 55 104 is_stmt 1 view .LVU1766
+# blake2s-generic.c:55:     FULLROUND(5);
+	.loc 1 55 134 is_stmt 0 view .LVU1767
+	xorl	%r12d, %r14d	# _664, tmp1711
+# blake2s-generic.c:55:     FULLROUND(5);
+	.loc 1 55 112 view .LVU1768
+	movl	%r12d, 32(%rax)	# _664, MEM[(u32 *)v_1(D) + 32B]
+	.loc 1 55 124 is_stmt 1 view .LVU1769
+.LVL316:
+.LBB1635:
+.LBI1635:
+	.loc 1 5 19 view .LVU1770
+.LBB1636:
+	.loc 1 5 44 view .LVU1771
+# blake2s-generic.c:5: static inline u32 ror(unsigned l, u32 x) { return (x >> l) | (x << (32-l)); }
+	.loc 1 5 60 is_stmt 0 view .LVU1772
+	rorl	$12, %r14d	#, _666
+.LVL317:
+	.loc 1 5 60 view .LVU1773
+.LBE1636:
+.LBE1635:
+# blake2s-generic.c:55:     FULLROUND(5);
+	.loc 1 55 132 view .LVU1774
+	movl	%r14d, 16(%rax)	# _666, MEM[(u32 *)v_1(D) + 16B]
+	.loc 1 55 162 is_stmt 1 view .LVU1775
+# blake2s-generic.c:55:     FULLROUND(5);
+	.loc 1 55 170 is_stmt 0 view .LVU1776
+	addl	48(%r9), %r8d	# MEM[(const u32 *)m_4(D) + 48B], tmp1712
+	addl	%r14d, %r8d	# _666, _669
+# blake2s-generic.c:55:     FULLROUND(5);
+	.loc 1 55 223 view .LVU1777
+	xorl	%r8d, %edi	# _669, tmp1714
+# blake2s-generic.c:55:     FULLROUND(5);
+	.loc 1 55 170 view .LVU1778
+	movl	%r8d, (%rax)	# _669, *v_1(D)
+	.loc 1 55 213 is_stmt 1 view .LVU1779
+.LVL318:
+.LBB1637:
+.LBI1637:
+	.loc 1 5 19 view .LVU1780
+.LBB1638:
+	.loc 1 5 44 view .LVU1781
+# blake2s-generic.c:5: static inline u32 ror(unsigned l, u32 x) { return (x >> l) | (x << (32-l)); }
+	.loc 1 5 60 is_stmt 0 view .LVU1782
+	rorl	$8, %edi	#, _671
+.LVL319:
+	.loc 1 5 60 view .LVU1783
+.LBE1638:
+.LBE1637:
+# blake2s-generic.c:55:     FULLROUND(5);
+	.loc 1 55 259 view .LVU1784
+	addl	%edi, %r12d	# _671, _672
+# blake2s-generic.c:55:     FULLROUND(5);
+	.loc 1 55 221 view .LVU1785
+	movl	%edi, 48(%rax)	# _671, MEM[(u32 *)v_1(D) + 48B]
+	.loc 1 55 251 is_stmt 1 view .LVU1786
+# blake2s-generic.c:55:     FULLROUND(5);
+	.loc 1 55 281 is_stmt 0 view .LVU1787
+	xorl	%r12d, %r14d	# _672, tmp1715
+	movl	%r12d, -28(%rsp)	# _672, %sfp
+.LBB1639:
+.LBB1640:
+# blake2s-generic.c:5: static inline u32 ror(unsigned l, u32 x) { return (x >> l) | (x << (32-l)); }
+	.loc 1 5 60 view .LVU1788
+	rorl	$7, %r14d	#, tmp1715
+.LBE1640:
+.LBE1639:
+# blake2s-generic.c:55:     FULLROUND(5);
+	.loc 1 55 259 view .LVU1789
+	movl	%r12d, 32(%rax)	# _672, MEM[(u32 *)v_1(D) + 32B]
+	.loc 1 55 271 is_stmt 1 view .LVU1790
+.LVL320:
+.LBB1642:
+.LBI1639:
+	.loc 1 5 19 view .LVU1791
+.LBB1641:
+	.loc 1 5 44 view .LVU1792
+	.loc 1 5 44 is_stmt 0 view .LVU1793
+.LBE1641:
+.LBE1642:
+# blake2s-generic.c:55:     FULLROUND(5);
+	.loc 1 55 279 view .LVU1794
+	movl	%r14d, -24(%rsp)	# _674, %sfp
+	movl	%r14d, 16(%rax)	# _674, MEM[(u32 *)v_1(D) + 16B]
+	.loc 1 55 13 is_stmt 1 view .LVU1795
+	.loc 1 55 322 view .LVU1796
+	.loc 1 55 327 view .LVU1797
+# blake2s-generic.c:55:     FULLROUND(5);
+	.loc 1 55 335 is_stmt 0 view .LVU1798
+	addl	24(%r9), %esi	# MEM[(const u32 *)m_4(D) + 24B], tmp1716
+	addl	%ebp, %esi	# _610, _677
+# blake2s-generic.c:55:     FULLROUND(5);
+	.loc 1 55 1012 view .LVU1799
+	movl	-16(%rsp), %r12d	# %sfp, _607
+# blake2s-generic.c:55:     FULLROUND(5);
+	.loc 1 55 388 view .LVU1800
+	xorl	%esi, %ecx	# _677, tmp1718
+# blake2s-generic.c:55:     FULLROUND(5);
+	.loc 1 55 335 view .LVU1801
+	movl	%esi, 4(%rax)	# _677, MEM[(u32 *)v_1(D) + 4B]
+	.loc 1 55 378 is_stmt 1 view .LVU1802
+.LVL321:
+.LBB1643:
+.LBI1643:
+	.loc 1 5 19 view .LVU1803
+.LBB1644:
+	.loc 1 5 44 view .LVU1804
+# blake2s-generic.c:5: static inline u32 ror(unsigned l, u32 x) { return (x >> l) | (x << (32-l)); }
+	.loc 1 5 60 is_stmt 0 view .LVU1805
+	roll	$16, %ecx	#, _679
+.LVL322:
+	.loc 1 5 60 view .LVU1806
+.LBE1644:
+.LBE1643:
+# blake2s-generic.c:55:     FULLROUND(5);
+	.loc 1 55 424 view .LVU1807
+	addl	%ecx, %r15d	# _679, _680
+# blake2s-generic.c:55:     FULLROUND(5);
+	.loc 1 55 386 view .LVU1808
+	movl	%ecx, 52(%rax)	# _679, MEM[(u32 *)v_1(D) + 52B]
+	.loc 1 55 416 is_stmt 1 view .LVU1809
+# blake2s-generic.c:55:     FULLROUND(5);
+	.loc 1 55 446 is_stmt 0 view .LVU1810
+	xorl	%r15d, %ebp	# _680, tmp1719
+# blake2s-generic.c:55:     FULLROUND(5);
+	.loc 1 55 424 view .LVU1811
+	movl	%r15d, 36(%rax)	# _680, MEM[(u32 *)v_1(D) + 36B]
+	.loc 1 55 436 is_stmt 1 view .LVU1812
+.LVL323:
+.LBB1645:
+.LBI1645:
+	.loc 1 5 19 view .LVU1813
+.LBB1646:
+	.loc 1 5 44 view .LVU1814
+# blake2s-generic.c:5: static inline u32 ror(unsigned l, u32 x) { return (x >> l) | (x << (32-l)); }
+	.loc 1 5 60 is_stmt 0 view .LVU1815
+	rorl	$12, %ebp	#, _682
+.LVL324:
+	.loc 1 5 60 view .LVU1816
+.LBE1646:
+.LBE1645:
+# blake2s-generic.c:55:     FULLROUND(5);
+	.loc 1 55 444 view .LVU1817
+	movl	%ebp, 20(%rax)	# _682, MEM[(u32 *)v_1(D) + 20B]
+	.loc 1 55 474 is_stmt 1 view .LVU1818
+# blake2s-generic.c:55:     FULLROUND(5);
+	.loc 1 55 482 is_stmt 0 view .LVU1819
+	addl	40(%r9), %esi	# MEM[(const u32 *)m_4(D) + 40B], tmp1720
+	addl	%ebp, %esi	# _682, _685
+# blake2s-generic.c:55:     FULLROUND(5);
+	.loc 1 55 535 view .LVU1820
+	xorl	%esi, %ecx	# _685, tmp1722
+# blake2s-generic.c:55:     FULLROUND(5);
+	.loc 1 55 482 view .LVU1821
+	movl	%esi, 4(%rax)	# _685, MEM[(u32 *)v_1(D) + 4B]
+	.loc 1 55 525 is_stmt 1 view .LVU1822
+.LVL325:
+.LBB1647:
+.LBI1647:
+	.loc 1 5 19 view .LVU1823
+.LBB1648:
+	.loc 1 5 44 view .LVU1824
+# blake2s-generic.c:5: static inline u32 ror(unsigned l, u32 x) { return (x >> l) | (x << (32-l)); }
+	.loc 1 5 60 is_stmt 0 view .LVU1825
+	rorl	$8, %ecx	#, _687
+.LVL326:
+	.loc 1 5 60 view .LVU1826
+.LBE1648:
+.LBE1647:
+# blake2s-generic.c:55:     FULLROUND(5);
+	.loc 1 55 571 view .LVU1827
+	addl	%ecx, %r15d	# _687, _688
+# blake2s-generic.c:55:     FULLROUND(5);
+	.loc 1 55 533 view .LVU1828
+	movl	%ecx, 52(%rax)	# _687, MEM[(u32 *)v_1(D) + 52B]
+	.loc 1 55 563 is_stmt 1 view .LVU1829
+# blake2s-generic.c:55:     FULLROUND(5);
+	.loc 1 55 593 is_stmt 0 view .LVU1830
+	xorl	%r15d, %ebp	# _688, tmp1723
+# blake2s-generic.c:55:     FULLROUND(5);
+	.loc 1 55 571 view .LVU1831
+	movl	%r15d, 36(%rax)	# _688, MEM[(u32 *)v_1(D) + 36B]
+	.loc 1 55 583 is_stmt 1 view .LVU1832
+.LVL327:
+.LBB1649:
+.LBI1649:
+	.loc 1 5 19 view .LVU1833
+.LBB1650:
+	.loc 1 5 44 view .LVU1834
+# blake2s-generic.c:5: static inline u32 ror(unsigned l, u32 x) { return (x >> l) | (x << (32-l)); }
+	.loc 1 5 60 is_stmt 0 view .LVU1835
+	rorl	$7, %ebp	#, _690
+.LVL328:
+	.loc 1 5 60 view .LVU1836
+.LBE1650:
+.LBE1649:
+# blake2s-generic.c:55:     FULLROUND(5);
+	.loc 1 55 593 view .LVU1837
+	movl	%r15d, -20(%rsp)	# _688, %sfp
+# blake2s-generic.c:55:     FULLROUND(5);
+	.loc 1 55 736 view .LVU1838
+	movl	-12(%rsp), %r15d	# %sfp, _608
+# blake2s-generic.c:55:     FULLROUND(5);
+	.loc 1 55 591 view .LVU1839
+	movl	%ebp, 20(%rax)	# _690, MEM[(u32 *)v_1(D) + 20B]
+	.loc 1 55 325 is_stmt 1 view .LVU1840
+	.loc 1 55 634 view .LVU1841
+	.loc 1 55 639 view .LVU1842
+# blake2s-generic.c:55:     FULLROUND(5);
+	.loc 1 55 647 is_stmt 0 view .LVU1843
+	addl	(%r9), %edx	# *m_4(D), tmp1724
+	addl	%ebx, %edx	# _626, _693
+# blake2s-generic.c:55:     FULLROUND(5);
+	.loc 1 55 700 view .LVU1844
+	xorl	%edx, %r13d	# _693, tmp1726
+# blake2s-generic.c:55:     FULLROUND(5);
+	.loc 1 55 647 view .LVU1845
+	movl	%edx, 8(%rax)	# _693, MEM[(u32 *)v_1(D) + 8B]
+	.loc 1 55 690 is_stmt 1 view .LVU1846
+.LVL329:
+.LBB1651:
+.LBI1651:
+	.loc 1 5 19 view .LVU1847
+.LBB1652:
+	.loc 1 5 44 view .LVU1848
+# blake2s-generic.c:5: static inline u32 ror(unsigned l, u32 x) { return (x >> l) | (x << (32-l)); }
+	.loc 1 5 60 is_stmt 0 view .LVU1849
+	roll	$16, %r13d	#, _695
+.LVL330:
+	.loc 1 5 60 view .LVU1850
+.LBE1652:
+.LBE1651:
+# blake2s-generic.c:55:     FULLROUND(5);
+	.loc 1 55 736 view .LVU1851
+	leal	(%r15,%r13), %r14d	#, _696
+# blake2s-generic.c:55:     FULLROUND(5);
+	.loc 1 55 698 view .LVU1852
+	movl	%r13d, 56(%rax)	# _695, MEM[(u32 *)v_1(D) + 56B]
+	.loc 1 55 728 is_stmt 1 view .LVU1853
+# blake2s-generic.c:55:     FULLROUND(5);
+	.loc 1 55 1048 is_stmt 0 view .LVU1854
+	movl	-8(%rsp), %r15d	# %sfp, _624
+# blake2s-generic.c:55:     FULLROUND(5);
+	.loc 1 55 758 view .LVU1855
+	xorl	%r14d, %ebx	# _696, tmp1727
+# blake2s-generic.c:55:     FULLROUND(5);
+	.loc 1 55 736 view .LVU1856
+	movl	%r14d, 40(%rax)	# _696, MEM[(u32 *)v_1(D) + 40B]
+	.loc 1 55 748 is_stmt 1 view .LVU1857
+.LVL331:
+.LBB1653:
+.LBI1653:
+	.loc 1 5 19 view .LVU1858
+.LBB1654:
+	.loc 1 5 44 view .LVU1859
+# blake2s-generic.c:5: static inline u32 ror(unsigned l, u32 x) { return (x >> l) | (x << (32-l)); }
+	.loc 1 5 60 is_stmt 0 view .LVU1860
+	rorl	$12, %ebx	#, _698
+.LVL332:
+	.loc 1 5 60 view .LVU1861
+.LBE1654:
+.LBE1653:
+# blake2s-generic.c:55:     FULLROUND(5);
+	.loc 1 55 756 view .LVU1862
+	movl	%ebx, 24(%rax)	# _698, MEM[(u32 *)v_1(D) + 24B]
+	.loc 1 55 786 is_stmt 1 view .LVU1863
+# blake2s-generic.c:55:     FULLROUND(5);
+	.loc 1 55 794 is_stmt 0 view .LVU1864
+	addl	44(%r9), %edx	# MEM[(const u32 *)m_4(D) + 44B], tmp1728
+	addl	%ebx, %edx	# _698, _701
+# blake2s-generic.c:55:     FULLROUND(5);
+	.loc 1 55 847 view .LVU1865
+	xorl	%edx, %r13d	# _701, tmp1730
+# blake2s-generic.c:55:     FULLROUND(5);
+	.loc 1 55 794 view .LVU1866
+	movl	%edx, 8(%rax)	# _701, MEM[(u32 *)v_1(D) + 8B]
+	.loc 1 55 837 is_stmt 1 view .LVU1867
+.LVL333:
+.LBB1655:
+.LBI1655:
+	.loc 1 5 19 view .LVU1868
+.LBB1656:
+	.loc 1 5 44 view .LVU1869
+# blake2s-generic.c:5: static inline u32 ror(unsigned l, u32 x) { return (x >> l) | (x << (32-l)); }
+	.loc 1 5 60 is_stmt 0 view .LVU1870
+	rorl	$8, %r13d	#, _703
+.LVL334:
+	.loc 1 5 60 view .LVU1871
+.LBE1656:
+.LBE1655:
+# blake2s-generic.c:55:     FULLROUND(5);
+	.loc 1 55 883 view .LVU1872
+	addl	%r13d, %r14d	# _703, _704
+# blake2s-generic.c:55:     FULLROUND(5);
+	.loc 1 55 845 view .LVU1873
+	movl	%r13d, 56(%rax)	# _703, MEM[(u32 *)v_1(D) + 56B]
+	.loc 1 55 875 is_stmt 1 view .LVU1874
+# blake2s-generic.c:55:     FULLROUND(5);
+	.loc 1 55 905 is_stmt 0 view .LVU1875
+	xorl	%r14d, %ebx	# _704, tmp1731
+# blake2s-generic.c:55:     FULLROUND(5);
+	.loc 1 55 883 view .LVU1876
+	movl	%r14d, 40(%rax)	# _704, MEM[(u32 *)v_1(D) + 40B]
+	.loc 1 55 895 is_stmt 1 view .LVU1877
+.LVL335:
+.LBB1657:
+.LBI1657:
+	.loc 1 5 19 view .LVU1878
+.LBB1658:
+	.loc 1 5 44 view .LVU1879
+# blake2s-generic.c:5: static inline u32 ror(unsigned l, u32 x) { return (x >> l) | (x << (32-l)); }
+	.loc 1 5 60 is_stmt 0 view .LVU1880
+	rorl	$7, %ebx	#, _706
+.LVL336:
+	.loc 1 5 60 view .LVU1881
+.LBE1658:
+.LBE1657:
+# blake2s-generic.c:55:     FULLROUND(5);
+	.loc 1 55 903 view .LVU1882
+	movl	%ebx, 24(%rax)	# _706, MEM[(u32 *)v_1(D) + 24B]
+	.loc 1 55 637 is_stmt 1 view .LVU1883
+	.loc 1 55 946 view .LVU1884
+	.loc 1 55 951 view .LVU1885
+# blake2s-generic.c:55:     FULLROUND(5);
+	.loc 1 55 959 is_stmt 0 view .LVU1886
+	addl	32(%r9), %r10d	# MEM[(const u32 *)m_4(D) + 32B], tmp1732
+	addl	%r11d, %r10d	# _642, _709
+# blake2s-generic.c:55:     FULLROUND(5);
+	.loc 1 55 1012 view .LVU1887
+	xorl	%r10d, %r12d	# _709, _607
+# blake2s-generic.c:55:     FULLROUND(5);
+	.loc 1 55 959 view .LVU1888
+	movl	%r10d, 12(%rax)	# _709, MEM[(u32 *)v_1(D) + 12B]
+	.loc 1 55 1002 is_stmt 1 view .LVU1889
+.LVL337:
+.LBB1659:
+.LBI1659:
+	.loc 1 5 19 view .LVU1890
+.LBB1660:
+	.loc 1 5 44 view .LVU1891
+# blake2s-generic.c:5: static inline u32 ror(unsigned l, u32 x) { return (x >> l) | (x << (32-l)); }
+	.loc 1 5 60 is_stmt 0 view .LVU1892
+	roll	$16, %r12d	#, _711
+.LVL338:
+	.loc 1 5 60 view .LVU1893
+.LBE1660:
+.LBE1659:
+# blake2s-generic.c:55:     FULLROUND(5);
+	.loc 1 55 1048 view .LVU1894
+	addl	%r12d, %r15d	# _711, _712
+# blake2s-generic.c:55:     FULLROUND(5);
+	.loc 1 55 1010 view .LVU1895
+	movl	%r12d, 60(%rax)	# _711, MEM[(u32 *)v_1(D) + 60B]
+	.loc 1 55 1040 is_stmt 1 view .LVU1896
+# blake2s-generic.c:55:     FULLROUND(5);
+	.loc 1 55 1070 is_stmt 0 view .LVU1897
+	xorl	%r15d, %r11d	# _712, tmp1735
+# blake2s-generic.c:55:     FULLROUND(5);
+	.loc 1 55 1048 view .LVU1898
+	movl	%r15d, 44(%rax)	# _712, MEM[(u32 *)v_1(D) + 44B]
+	.loc 1 55 1060 is_stmt 1 view .LVU1899
+.LVL339:
+.LBB1661:
+.LBI1661:
+	.loc 1 5 19 view .LVU1900
+.LBB1662:
+	.loc 1 5 44 view .LVU1901
+# blake2s-generic.c:5: static inline u32 ror(unsigned l, u32 x) { return (x >> l) | (x << (32-l)); }
+	.loc 1 5 60 is_stmt 0 view .LVU1902
+	rorl	$12, %r11d	#, _714
+.LVL340:
+	.loc 1 5 60 view .LVU1903
+.LBE1662:
+.LBE1661:
+# blake2s-generic.c:55:     FULLROUND(5);
+	.loc 1 55 1068 view .LVU1904
+	movl	%r11d, 28(%rax)	# _714, MEM[(u32 *)v_1(D) + 28B]
+	.loc 1 55 1098 is_stmt 1 view .LVU1905
+# blake2s-generic.c:55:     FULLROUND(5);
+	.loc 1 55 1106 is_stmt 0 view .LVU1906
+	addl	12(%r9), %r10d	# MEM[(const u32 *)m_4(D) + 12B], tmp1736
+	addl	%r11d, %r10d	# _714, _717
+# blake2s-generic.c:55:     FULLROUND(5);
+	.loc 1 55 1159 view .LVU1907
+	xorl	%r10d, %r12d	# _717, tmp1738
+# blake2s-generic.c:55:     FULLROUND(5);
+	.loc 1 55 1106 view .LVU1908
+	movl	%r10d, 12(%rax)	# _717, MEM[(u32 *)v_1(D) + 12B]
+	.loc 1 55 1149 is_stmt 1 view .LVU1909
+.LVL341:
+.LBB1663:
+.LBI1663:
+	.loc 1 5 19 view .LVU1910
+.LBB1664:
+	.loc 1 5 44 view .LVU1911
+# blake2s-generic.c:5: static inline u32 ror(unsigned l, u32 x) { return (x >> l) | (x << (32-l)); }
+	.loc 1 5 60 is_stmt 0 view .LVU1912
+	rorl	$8, %r12d	#, _719
+.LVL342:
+	.loc 1 5 60 view .LVU1913
+.LBE1664:
+.LBE1663:
+# blake2s-generic.c:55:     FULLROUND(5);
+	.loc 1 55 1195 view .LVU1914
+	addl	%r12d, %r15d	# _719, _720
+# blake2s-generic.c:55:     FULLROUND(5);
+	.loc 1 55 1157 view .LVU1915
+	movl	%r12d, 60(%rax)	# _719, MEM[(u32 *)v_1(D) + 60B]
+	.loc 1 55 1187 is_stmt 1 view .LVU1916
+# blake2s-generic.c:55:     FULLROUND(5);
+	.loc 1 55 1217 is_stmt 0 view .LVU1917
+	xorl	%r15d, %r11d	# _720, tmp1739
+# blake2s-generic.c:55:     FULLROUND(5);
+	.loc 1 55 1195 view .LVU1918
+	movl	%r15d, 44(%rax)	# _720, MEM[(u32 *)v_1(D) + 44B]
+	.loc 1 55 1207 is_stmt 1 view .LVU1919
+.LVL343:
+.LBB1665:
+.LBI1665:
+	.loc 1 5 19 view .LVU1920
+.LBB1666:
+	.loc 1 5 44 view .LVU1921
+# blake2s-generic.c:5: static inline u32 ror(unsigned l, u32 x) { return (x >> l) | (x << (32-l)); }
+	.loc 1 5 60 is_stmt 0 view .LVU1922
+	rorl	$7, %r11d	#, _722
+.LVL344:
+	.loc 1 5 60 view .LVU1923
+.LBE1666:
+.LBE1665:
+# blake2s-generic.c:55:     FULLROUND(5);
+	.loc 1 55 1215 view .LVU1924
+	movl	%r11d, 28(%rax)	# _722, MEM[(u32 *)v_1(D) + 28B]
+	.loc 1 55 949 is_stmt 1 view .LVU1925
+	.loc 1 55 1258 view .LVU1926
+	.loc 1 55 1263 view .LVU1927
+# blake2s-generic.c:55:     FULLROUND(5);
+	.loc 1 55 1271 is_stmt 0 view .LVU1928
+	addl	16(%r9), %r8d	# MEM[(const u32 *)m_4(D) + 16B], tmp1740
+	addl	%ebp, %r8d	# _690, _725
+# blake2s-generic.c:55:     FULLROUND(5);
+	.loc 1 55 1324 view .LVU1929
+	xorl	%r8d, %r12d	# _725, tmp1742
+# blake2s-generic.c:55:     FULLROUND(5);
+	.loc 1 55 1271 view .LVU1930
+	movl	%r8d, (%rax)	# _725, *v_1(D)
+	.loc 1 55 1314 is_stmt 1 view .LVU1931
+.LVL345:
+.LBB1667:
+.LBI1667:
+	.loc 1 5 19 view .LVU1932
+.LBB1668:
+	.loc 1 5 44 view .LVU1933
+# blake2s-generic.c:5: static inline u32 ror(unsigned l, u32 x) { return (x >> l) | (x << (32-l)); }
+	.loc 1 5 60 is_stmt 0 view .LVU1934
+	roll	$16, %r12d	#, _727
+.LVL346:
+	.loc 1 5 60 view .LVU1935
+.LBE1668:
+.LBE1667:
+# blake2s-generic.c:55:     FULLROUND(5);
+	.loc 1 55 1360 view .LVU1936
+	addl	%r12d, %r14d	# _727, _728
+# blake2s-generic.c:55:     FULLROUND(5);
+	.loc 1 55 1322 view .LVU1937
+	movl	%r12d, 60(%rax)	# _727, MEM[(u32 *)v_1(D) + 60B]
+	.loc 1 55 1352 is_stmt 1 view .LVU1938
+# blake2s-generic.c:55:     FULLROUND(5);
+	.loc 1 55 1382 is_stmt 0 view .LVU1939
+	xorl	%r14d, %ebp	# _728, tmp1743
+# blake2s-generic.c:55:     FULLROUND(5);
+	.loc 1 55 1360 view .LVU1940
+	movl	%r14d, 40(%rax)	# _728, MEM[(u32 *)v_1(D) + 40B]
+	.loc 1 55 1372 is_stmt 1 view .LVU1941
+.LVL347:
+.LBB1669:
+.LBI1669:
+	.loc 1 5 19 view .LVU1942
+.LBB1670:
+	.loc 1 5 44 view .LVU1943
+# blake2s-generic.c:5: static inline u32 ror(unsigned l, u32 x) { return (x >> l) | (x << (32-l)); }
+	.loc 1 5 60 is_stmt 0 view .LVU1944
+	rorl	$12, %ebp	#, _730
+.LVL348:
+	.loc 1 5 60 view .LVU1945
+.LBE1670:
+.LBE1669:
+# blake2s-generic.c:55:     FULLROUND(5);
+	.loc 1 55 1380 view .LVU1946
+	movl	%ebp, 20(%rax)	# _730, MEM[(u32 *)v_1(D) + 20B]
+	.loc 1 55 1410 is_stmt 1 view .LVU1947
+# blake2s-generic.c:55:     FULLROUND(5);
+	.loc 1 55 1418 is_stmt 0 view .LVU1948
+	addl	52(%r9), %r8d	# MEM[(const u32 *)m_4(D) + 52B], tmp1744
+	addl	%ebp, %r8d	# _730, _733
+# blake2s-generic.c:55:     FULLROUND(5);
+	.loc 1 55 1471 view .LVU1949
+	xorl	%r8d, %r12d	# _733, tmp1746
+# blake2s-generic.c:55:     FULLROUND(5);
+	.loc 1 55 1418 view .LVU1950
+	movl	%r8d, (%rax)	# _733, *v_1(D)
+	.loc 1 55 1461 is_stmt 1 view .LVU1951
+.LVL349:
+.LBB1671:
+.LBI1671:
+	.loc 1 5 19 view .LVU1952
+.LBB1672:
+	.loc 1 5 44 view .LVU1953
+# blake2s-generic.c:5: static inline u32 ror(unsigned l, u32 x) { return (x >> l) | (x << (32-l)); }
+	.loc 1 5 60 is_stmt 0 view .LVU1954
+	rorl	$8, %r12d	#, tmp1746
+.LBE1672:
+.LBE1671:
+# blake2s-generic.c:55:     FULLROUND(5);
+	.loc 1 55 1507 view .LVU1955
+	addl	%r12d, %r14d	# _735, _736
+# blake2s-generic.c:55:     FULLROUND(5);
+	.loc 1 55 1469 view .LVU1956
+	movl	%r12d, 60(%rax)	# _735, MEM[(u32 *)v_1(D) + 60B]
+	.loc 1 55 1499 is_stmt 1 view .LVU1957
+# blake2s-generic.c:55:     FULLROUND(5);
+	.loc 1 55 1529 is_stmt 0 view .LVU1958
+	xorl	%r14d, %ebp	# _736, tmp1747
+# blake2s-generic.c:55:     FULLROUND(5);
+	.loc 1 55 1507 view .LVU1959
+	movl	%r14d, 40(%rax)	# _736, MEM[(u32 *)v_1(D) + 40B]
+	.loc 1 55 1519 is_stmt 1 view .LVU1960
+.LVL350:
+.LBB1673:
+.LBI1673:
+	.loc 1 5 19 view .LVU1961
+.LBB1674:
+	.loc 1 5 44 view .LVU1962
+# blake2s-generic.c:5: static inline u32 ror(unsigned l, u32 x) { return (x >> l) | (x << (32-l)); }
+	.loc 1 5 60 is_stmt 0 view .LVU1963
+	rorl	$7, %ebp	#, _738
+.LVL351:
+	.loc 1 5 60 view .LVU1964
+.LBE1674:
+.LBE1673:
+# blake2s-generic.c:55:     FULLROUND(5);
+	.loc 1 55 1507 view .LVU1965
+	movl	%r12d, -16(%rsp)	# _735, %sfp
+# blake2s-generic.c:55:     FULLROUND(5);
+	.loc 1 55 1527 view .LVU1966
+	movl	%ebp, 20(%rax)	# _738, MEM[(u32 *)v_1(D) + 20B]
+	.loc 1 55 1261 is_stmt 1 view .LVU1967
+	.loc 1 55 1570 view .LVU1968
+	.loc 1 55 1575 view .LVU1969
+# blake2s-generic.c:55:     FULLROUND(5);
+	.loc 1 55 1583 is_stmt 0 view .LVU1970
+	addl	28(%r9), %esi	# MEM[(const u32 *)m_4(D) + 28B], tmp1748
+	addl	%ebx, %esi	# _706, _741
+# blake2s-generic.c:55:     FULLROUND(5);
+	.loc 1 55 1529 view .LVU1971
+	movl	%r14d, -12(%rsp)	# _736, %sfp
+# blake2s-generic.c:55:     FULLROUND(5);
+	.loc 1 55 1637 view .LVU1972
+	xorl	%esi, %edi	# _741, tmp1750
+# blake2s-generic.c:55:     FULLROUND(5);
+	.loc 1 55 1583 view .LVU1973
+	movl	%esi, 4(%rax)	# _741, MEM[(u32 *)v_1(D) + 4B]
+	.loc 1 55 1627 is_stmt 1 view .LVU1974
+.LVL352:
+.LBB1675:
+.LBI1675:
+	.loc 1 5 19 view .LVU1975
+.LBB1676:
+	.loc 1 5 44 view .LVU1976
+# blake2s-generic.c:5: static inline u32 ror(unsigned l, u32 x) { return (x >> l) | (x << (32-l)); }
+	.loc 1 5 60 is_stmt 0 view .LVU1977
+	roll	$16, %edi	#, _743
+.LVL353:
+	.loc 1 5 60 view .LVU1978
+.LBE1676:
+.LBE1675:
+# blake2s-generic.c:55:     FULLROUND(5);
+	.loc 1 55 1673 view .LVU1979
+	addl	%edi, %r15d	# _743, _744
+# blake2s-generic.c:55:     FULLROUND(5);
+	.loc 1 55 1635 view .LVU1980
+	movl	%edi, 48(%rax)	# _743, MEM[(u32 *)v_1(D) + 48B]
+	.loc 1 55 1665 is_stmt 1 view .LVU1981
+# blake2s-generic.c:55:     FULLROUND(5);
+	.loc 1 55 1695 is_stmt 0 view .LVU1982
+	xorl	%r15d, %ebx	# _744, tmp1751
+# blake2s-generic.c:55:     FULLROUND(5);
+	.loc 1 55 1673 view .LVU1983
+	movl	%r15d, 44(%rax)	# _744, MEM[(u32 *)v_1(D) + 44B]
+	.loc 1 55 1685 is_stmt 1 view .LVU1984
+.LVL354:
+.LBB1677:
+.LBI1677:
+	.loc 1 5 19 view .LVU1985
+.LBB1678:
+	.loc 1 5 44 view .LVU1986
+# blake2s-generic.c:5: static inline u32 ror(unsigned l, u32 x) { return (x >> l) | (x << (32-l)); }
+	.loc 1 5 60 is_stmt 0 view .LVU1987
+	rorl	$12, %ebx	#, _746
+.LVL355:
+	.loc 1 5 60 view .LVU1988
+.LBE1678:
+.LBE1677:
+# blake2s-generic.c:55:     FULLROUND(5);
+	.loc 1 55 1693 view .LVU1989
+	movl	%ebx, 24(%rax)	# _746, MEM[(u32 *)v_1(D) + 24B]
+	.loc 1 55 1723 is_stmt 1 view .LVU1990
+# blake2s-generic.c:55:     FULLROUND(5);
+	.loc 1 55 1731 is_stmt 0 view .LVU1991
+	addl	20(%r9), %esi	# MEM[(const u32 *)m_4(D) + 20B], tmp1752
+	addl	%ebx, %esi	# _746, _749
+# blake2s-generic.c:55:     FULLROUND(5);
+	.loc 1 55 1785 view .LVU1992
+	xorl	%esi, %edi	# _749, tmp1754
+# blake2s-generic.c:55:     FULLROUND(5);
+	.loc 1 55 1731 view .LVU1993
+	movl	%esi, 4(%rax)	# _749, MEM[(u32 *)v_1(D) + 4B]
+	.loc 1 55 1775 is_stmt 1 view .LVU1994
+.LVL356:
+.LBB1679:
+.LBI1679:
+	.loc 1 5 19 view .LVU1995
+.LBB1680:
+	.loc 1 5 44 view .LVU1996
+# blake2s-generic.c:5: static inline u32 ror(unsigned l, u32 x) { return (x >> l) | (x << (32-l)); }
+	.loc 1 5 60 is_stmt 0 view .LVU1997
+	rorl	$8, %edi	#, _751
+.LVL357:
+	.loc 1 5 60 view .LVU1998
+.LBE1680:
+.LBE1679:
+# blake2s-generic.c:55:     FULLROUND(5);
+	.loc 1 55 1821 view .LVU1999
+	addl	%edi, %r15d	# _751, _752
+# blake2s-generic.c:55:     FULLROUND(5);
+	.loc 1 55 1783 view .LVU2000
+	movl	%edi, 48(%rax)	# _751, MEM[(u32 *)v_1(D) + 48B]
+	.loc 1 55 1813 is_stmt 1 view .LVU2001
+# blake2s-generic.c:55:     FULLROUND(5);
+	.loc 1 55 1843 is_stmt 0 view .LVU2002
+	xorl	%r15d, %ebx	# _752, tmp1755
+# blake2s-generic.c:55:     FULLROUND(5);
+	.loc 1 55 1821 view .LVU2003
+	movl	%r15d, 44(%rax)	# _752, MEM[(u32 *)v_1(D) + 44B]
+	.loc 1 55 1833 is_stmt 1 view .LVU2004
+.LVL358:
+.LBB1681:
+.LBI1681:
+	.loc 1 5 19 view .LVU2005
+.LBB1682:
+	.loc 1 5 44 view .LVU2006
+# blake2s-generic.c:5: static inline u32 ror(unsigned l, u32 x) { return (x >> l) | (x << (32-l)); }
+	.loc 1 5 60 is_stmt 0 view .LVU2007
+	rorl	$7, %ebx	#, _754
+.LVL359:
+	.loc 1 5 60 view .LVU2008
+.LBE1682:
+.LBE1681:
+# blake2s-generic.c:55:     FULLROUND(5);
+	.loc 1 55 1843 view .LVU2009
+	movl	%r15d, -8(%rsp)	# _752, %sfp
+# blake2s-generic.c:55:     FULLROUND(5);
+	.loc 1 55 1987 view .LVU2010
+	movl	-28(%rsp), %r15d	# %sfp, _672
+# blake2s-generic.c:55:     FULLROUND(5);
+	.loc 1 55 1841 view .LVU2011
+	movl	%ebx, 24(%rax)	# _754, MEM[(u32 *)v_1(D) + 24B]
+	.loc 1 55 1573 is_stmt 1 view .LVU2012
+	.loc 1 55 1884 view .LVU2013
+	.loc 1 55 1889 view .LVU2014
+# blake2s-generic.c:55:     FULLROUND(5);
+	.loc 1 55 1897 is_stmt 0 view .LVU2015
+	addl	60(%r9), %edx	# MEM[(const u32 *)m_4(D) + 60B], tmp1756
+	addl	%r11d, %edx	# _722, _757
+# blake2s-generic.c:55:     FULLROUND(5);
+	.loc 1 55 1951 view .LVU2016
+	xorl	%edx, %ecx	# _757, tmp1758
+# blake2s-generic.c:55:     FULLROUND(5);
+	.loc 1 55 1897 view .LVU2017
+	movl	%edx, 8(%rax)	# _757, MEM[(u32 *)v_1(D) + 8B]
+	.loc 1 55 1941 is_stmt 1 view .LVU2018
+.LVL360:
+.LBB1683:
+.LBI1683:
+	.loc 1 5 19 view .LVU2019
+.LBB1684:
+	.loc 1 5 44 view .LVU2020
+# blake2s-generic.c:5: static inline u32 ror(unsigned l, u32 x) { return (x >> l) | (x << (32-l)); }
+	.loc 1 5 60 is_stmt 0 view .LVU2021
+	roll	$16, %ecx	#, _759
+.LVL361:
+	.loc 1 5 60 view .LVU2022
+.LBE1684:
+.LBE1683:
+# blake2s-generic.c:55:     FULLROUND(5);
+	.loc 1 55 1987 view .LVU2023
+	leal	(%r15,%rcx), %r12d	#, _760
+# blake2s-generic.c:55:     FULLROUND(5);
+	.loc 1 55 1949 view .LVU2024
+	movl	%ecx, 52(%rax)	# _759, MEM[(u32 *)v_1(D) + 52B]
+	.loc 1 55 1979 is_stmt 1 view .LVU2025
+# blake2s-generic.c:55:     FULLROUND(5);
+	.loc 1 55 2009 is_stmt 0 view .LVU2026
+	xorl	%r12d, %r11d	# _760, tmp1759
+# blake2s-generic.c:55:     FULLROUND(5);
+	.loc 1 55 1987 view .LVU2027
+	movl	%r12d, 32(%rax)	# _760, MEM[(u32 *)v_1(D) + 32B]
+	.loc 1 55 1999 is_stmt 1 view .LVU2028
+.LVL362:
+.LBB1685:
+.LBI1685:
+	.loc 1 5 19 view .LVU2029
+.LBB1686:
+	.loc 1 5 44 view .LVU2030
+# blake2s-generic.c:5: static inline u32 ror(unsigned l, u32 x) { return (x >> l) | (x << (32-l)); }
+	.loc 1 5 60 is_stmt 0 view .LVU2031
+	rorl	$12, %r11d	#, _762
+.LVL363:
+	.loc 1 5 60 view .LVU2032
+.LBE1686:
+.LBE1685:
+# blake2s-generic.c:55:     FULLROUND(5);
+	.loc 1 55 2007 view .LVU2033
+	movl	%r11d, 28(%rax)	# _762, MEM[(u32 *)v_1(D) + 28B]
+	.loc 1 55 2037 is_stmt 1 view .LVU2034
+# blake2s-generic.c:55:     FULLROUND(5);
+	.loc 1 55 2045 is_stmt 0 view .LVU2035
+	addl	56(%r9), %edx	# MEM[(const u32 *)m_4(D) + 56B], tmp1760
+	addl	%r11d, %edx	# _762, _765
+# blake2s-generic.c:55:     FULLROUND(5);
+	.loc 1 55 2099 view .LVU2036
+	xorl	%edx, %ecx	# _765, tmp1762
+# blake2s-generic.c:55:     FULLROUND(5);
+	.loc 1 55 2045 view .LVU2037
+	movl	%edx, 8(%rax)	# _765, MEM[(u32 *)v_1(D) + 8B]
+	.loc 1 55 2089 is_stmt 1 view .LVU2038
+.LVL364:
+.LBB1687:
+.LBI1687:
+	.loc 1 5 19 view .LVU2039
+.LBB1688:
+	.loc 1 5 44 view .LVU2040
+# blake2s-generic.c:5: static inline u32 ror(unsigned l, u32 x) { return (x >> l) | (x << (32-l)); }
+	.loc 1 5 60 is_stmt 0 view .LVU2041
+	rorl	$8, %ecx	#, _767
+.LVL365:
+	.loc 1 5 60 view .LVU2042
+.LBE1688:
+.LBE1687:
+# blake2s-generic.c:55:     FULLROUND(5);
+	.loc 1 55 2135 view .LVU2043
+	addl	%ecx, %r12d	# _767, _768
+# blake2s-generic.c:55:     FULLROUND(5);
+	.loc 1 55 2097 view .LVU2044
+	movl	%ecx, 52(%rax)	# _767, MEM[(u32 *)v_1(D) + 52B]
+	.loc 1 55 2127 is_stmt 1 view .LVU2045
+# blake2s-generic.c:55:     FULLROUND(5);
+	.loc 1 55 2211 is_stmt 0 view .LVU2046
+	movl	-24(%rsp), %r14d	# %sfp, _674
+# blake2s-generic.c:55:     FULLROUND(5);
+	.loc 1 55 2157 view .LVU2047
+	xorl	%r12d, %r11d	# _768, tmp1763
+# blake2s-generic.c:55:     FULLROUND(5);
+	.loc 1 55 2135 view .LVU2048
+	movl	%r12d, 32(%rax)	# _768, MEM[(u32 *)v_1(D) + 32B]
+	.loc 1 55 2147 is_stmt 1 view .LVU2049
+.LVL366:
+.LBB1689:
+.LBI1689:
+	.loc 1 5 19 view .LVU2050
+.LBB1690:
+	.loc 1 5 44 view .LVU2051
+.LBE1690:
+.LBE1689:
+# blake2s-generic.c:55:     FULLROUND(5);
+	.loc 1 55 2301 is_stmt 0 view .LVU2052
+	movl	-20(%rsp), %r15d	# %sfp, _688
+.LBB1692:
+.LBB1691:
+# blake2s-generic.c:5: static inline u32 ror(unsigned l, u32 x) { return (x >> l) | (x << (32-l)); }
+	.loc 1 5 60 view .LVU2053
+	rorl	$7, %r11d	#, _770
+.LVL367:
+	.loc 1 5 60 view .LVU2054
+.LBE1691:
+.LBE1692:
+# blake2s-generic.c:55:     FULLROUND(5);
+	.loc 1 55 2155 view .LVU2055
+	movl	%r11d, 28(%rax)	# _770, MEM[(u32 *)v_1(D) + 28B]
+	.loc 1 55 1887 is_stmt 1 view .LVU2056
+	.loc 1 55 2198 view .LVU2057
+	.loc 1 55 2203 view .LVU2058
+# blake2s-generic.c:55:     FULLROUND(5);
+	.loc 1 55 2211 is_stmt 0 view .LVU2059
+	addl	4(%r9), %r10d	# MEM[(const u32 *)m_4(D) + 4B], tmp1764
+	addl	%r14d, %r10d	# _674, _773
+# blake2s-generic.c:55:     FULLROUND(5);
+	.loc 1 55 2265 view .LVU2060
+	xorl	%r10d, %r13d	# _773, tmp1766
+# blake2s-generic.c:55:     FULLROUND(5);
+	.loc 1 55 2211 view .LVU2061
+	movl	%r10d, 12(%rax)	# _773, MEM[(u32 *)v_1(D) + 12B]
+	.loc 1 55 2255 is_stmt 1 view .LVU2062
+.LVL368:
+.LBB1693:
+.LBI1693:
+	.loc 1 5 19 view .LVU2063
+.LBB1694:
+	.loc 1 5 44 view .LVU2064
+# blake2s-generic.c:5: static inline u32 ror(unsigned l, u32 x) { return (x >> l) | (x << (32-l)); }
+	.loc 1 5 60 is_stmt 0 view .LVU2065
+	roll	$16, %r13d	#, _775
+.LVL369:
+	.loc 1 5 60 view .LVU2066
+.LBE1694:
+.LBE1693:
+# blake2s-generic.c:55:     FULLROUND(5);
+	.loc 1 55 2301 view .LVU2067
+	addl	%r13d, %r15d	# _775, _776
+# blake2s-generic.c:55:     FULLROUND(5);
+	.loc 1 55 2263 view .LVU2068
+	movl	%r13d, 56(%rax)	# _775, MEM[(u32 *)v_1(D) + 56B]
+	.loc 1 55 2293 is_stmt 1 view .LVU2069
+# blake2s-generic.c:55:     FULLROUND(5);
+	.loc 1 55 2323 is_stmt 0 view .LVU2070
+	xorl	%r15d, %r14d	# _776, _674
+# blake2s-generic.c:55:     FULLROUND(5);
+	.loc 1 55 2301 view .LVU2071
+	movl	%r15d, 36(%rax)	# _776, MEM[(u32 *)v_1(D) + 36B]
+	.loc 1 55 2313 is_stmt 1 view .LVU2072
+.LVL370:
+.LBB1695:
+.LBI1695:
+	.loc 1 5 19 view .LVU2073
+.LBB1696:
+	.loc 1 5 44 view .LVU2074
+# blake2s-generic.c:5: static inline u32 ror(unsigned l, u32 x) { return (x >> l) | (x << (32-l)); }
+	.loc 1 5 60 is_stmt 0 view .LVU2075
+	rorl	$12, %r14d	#, _778
+.LVL371:
+	.loc 1 5 60 view .LVU2076
+.LBE1696:
+.LBE1695:
+# blake2s-generic.c:55:     FULLROUND(5);
+	.loc 1 55 2321 view .LVU2077
+	movl	%r14d, 16(%rax)	# _778, MEM[(u32 *)v_1(D) + 16B]
+	.loc 1 55 2351 is_stmt 1 view .LVU2078
+# blake2s-generic.c:55:     FULLROUND(5);
+	.loc 1 55 2359 is_stmt 0 view .LVU2079
+	addl	36(%r9), %r10d	# MEM[(const u32 *)m_4(D) + 36B], tmp1768
+	addl	%r14d, %r10d	# _778, _781
+# blake2s-generic.c:55:     FULLROUND(5);
+	.loc 1 55 2413 view .LVU2080
+	xorl	%r10d, %r13d	# _781, tmp1770
+# blake2s-generic.c:55:     FULLROUND(5);
+	.loc 1 55 2359 view .LVU2081
+	movl	%r10d, 12(%rax)	# _781, MEM[(u32 *)v_1(D) + 12B]
+	.loc 1 55 2403 is_stmt 1 view .LVU2082
+.LVL372:
+.LBB1697:
+.LBI1697:
+	.loc 1 5 19 view .LVU2083
+.LBB1698:
+	.loc 1 5 44 view .LVU2084
+# blake2s-generic.c:5: static inline u32 ror(unsigned l, u32 x) { return (x >> l) | (x << (32-l)); }
+	.loc 1 5 60 is_stmt 0 view .LVU2085
+	rorl	$8, %r13d	#, _783
+.LVL373:
+	.loc 1 5 60 view .LVU2086
+.LBE1698:
+.LBE1697:
+# blake2s-generic.c:55:     FULLROUND(5);
+	.loc 1 55 2449 view .LVU2087
+	addl	%r13d, %r15d	# _783, _784
+# blake2s-generic.c:55:     FULLROUND(5);
+	.loc 1 55 2411 view .LVU2088
+	movl	%r13d, 56(%rax)	# _783, MEM[(u32 *)v_1(D) + 56B]
+	.loc 1 55 2441 is_stmt 1 view .LVU2089
+# blake2s-generic.c:55:     FULLROUND(5);
+	.loc 1 55 2471 is_stmt 0 view .LVU2090
+	xorl	%r15d, %r14d	# _784, tmp1771
+# blake2s-generic.c:55:     FULLROUND(5);
+	.loc 1 55 2449 view .LVU2091
+	movl	%r15d, 36(%rax)	# _784, MEM[(u32 *)v_1(D) + 36B]
+	.loc 1 55 2461 is_stmt 1 view .LVU2092
+.LVL374:
+.LBB1699:
+.LBI1699:
+	.loc 1 5 19 view .LVU2093
+.LBB1700:
+	.loc 1 5 44 view .LVU2094
+# blake2s-generic.c:5: static inline u32 ror(unsigned l, u32 x) { return (x >> l) | (x << (32-l)); }
+	.loc 1 5 60 is_stmt 0 view .LVU2095
+	rorl	$7, %r14d	#, _786
+.LVL375:
+	.loc 1 5 60 view .LVU2096
+.LBE1700:
+.LBE1699:
+# blake2s-generic.c:55:     FULLROUND(5);
+	.loc 1 55 2469 view .LVU2097
+	movl	%r14d, 16(%rax)	# _786, MEM[(u32 *)v_1(D) + 16B]
+	.loc 1 55 2201 is_stmt 1 view .LVU2098
+	.loc 1 55 8 view .LVU2099
+	.loc 1 56 5 view .LVU2100
+	.loc 1 56 10 view .LVU2101
+	.loc 1 56 15 view .LVU2102
+# blake2s-generic.c:56:     FULLROUND(6);
+	.loc 1 56 23 is_stmt 0 view .LVU2103
+	addl	48(%r9), %r8d	# MEM[(const u32 *)m_4(D) + 48B], tmp1772
+	addl	%r14d, %r8d	# _786, _789
+# blake2s-generic.c:56:     FULLROUND(6);
+	.loc 1 56 76 view .LVU2104
+	xorl	%r8d, %edi	# _789, tmp1774
+# blake2s-generic.c:56:     FULLROUND(6);
+	.loc 1 56 23 view .LVU2105
+	movl	%r8d, (%rax)	# _789, *v_1(D)
+	.loc 1 56 66 is_stmt 1 view .LVU2106
+.LVL376:
+.LBB1701:
+.LBI1701:
+	.loc 1 5 19 view .LVU2107
+.LBB1702:
+	.loc 1 5 44 view .LVU2108
+# blake2s-generic.c:5: static inline u32 ror(unsigned l, u32 x) { return (x >> l) | (x << (32-l)); }
+	.loc 1 5 60 is_stmt 0 view .LVU2109
+	roll	$16, %edi	#, _791
+.LVL377:
+	.loc 1 5 60 view .LVU2110
+.LBE1702:
+.LBE1701:
+# blake2s-generic.c:56:     FULLROUND(6);
+	.loc 1 56 112 view .LVU2111
+	addl	%edi, %r12d	# _791, _792
+# blake2s-generic.c:56:     FULLROUND(6);
+	.loc 1 56 74 view .LVU2112
+	movl	%edi, 48(%rax)	# _791, MEM[(u32 *)v_1(D) + 48B]
+	.loc 1 56 104 is_stmt 1 view .LVU2113
+# blake2s-generic.c:56:     FULLROUND(6);
+	.loc 1 56 134 is_stmt 0 view .LVU2114
+	xorl	%r12d, %r14d	# _792, tmp1775
+# blake2s-generic.c:56:     FULLROUND(6);
+	.loc 1 56 112 view .LVU2115
+	movl	%r12d, 32(%rax)	# _792, MEM[(u32 *)v_1(D) + 32B]
+	.loc 1 56 124 is_stmt 1 view .LVU2116
+.LVL378:
+.LBB1703:
+.LBI1703:
+	.loc 1 5 19 view .LVU2117
+.LBB1704:
+	.loc 1 5 44 view .LVU2118
+# blake2s-generic.c:5: static inline u32 ror(unsigned l, u32 x) { return (x >> l) | (x << (32-l)); }
+	.loc 1 5 60 is_stmt 0 view .LVU2119
+	rorl	$12, %r14d	#, _794
+.LVL379:
+	.loc 1 5 60 view .LVU2120
+.LBE1704:
+.LBE1703:
+# blake2s-generic.c:56:     FULLROUND(6);
+	.loc 1 56 132 view .LVU2121
+	movl	%r14d, 16(%rax)	# _794, MEM[(u32 *)v_1(D) + 16B]
+	.loc 1 56 162 is_stmt 1 view .LVU2122
+# blake2s-generic.c:56:     FULLROUND(6);
+	.loc 1 56 170 is_stmt 0 view .LVU2123
+	addl	20(%r9), %r8d	# MEM[(const u32 *)m_4(D) + 20B], tmp1776
+	addl	%r14d, %r8d	# _794, _797
+# blake2s-generic.c:56:     FULLROUND(6);
+	.loc 1 56 223 view .LVU2124
+	xorl	%r8d, %edi	# _797, tmp1778
+# blake2s-generic.c:56:     FULLROUND(6);
+	.loc 1 56 170 view .LVU2125
+	movl	%r8d, (%rax)	# _797, *v_1(D)
+	.loc 1 56 213 is_stmt 1 view .LVU2126
+.LVL380:
+.LBB1705:
+.LBI1705:
+	.loc 1 5 19 view .LVU2127
+.LBB1706:
+	.loc 1 5 44 view .LVU2128
+# blake2s-generic.c:5: static inline u32 ror(unsigned l, u32 x) { return (x >> l) | (x << (32-l)); }
+	.loc 1 5 60 is_stmt 0 view .LVU2129
+	rorl	$8, %edi	#, _799
+.LVL381:
+	.loc 1 5 60 view .LVU2130
+.LBE1706:
+.LBE1705:
+# blake2s-generic.c:56:     FULLROUND(6);
+	.loc 1 56 259 view .LVU2131
+	addl	%edi, %r12d	# _799, _800
+# blake2s-generic.c:56:     FULLROUND(6);
+	.loc 1 56 221 view .LVU2132
+	movl	%edi, 48(%rax)	# _799, MEM[(u32 *)v_1(D) + 48B]
+	.loc 1 56 251 is_stmt 1 view .LVU2133
+# blake2s-generic.c:56:     FULLROUND(6);
+	.loc 1 56 281 is_stmt 0 view .LVU2134
+	xorl	%r12d, %r14d	# _800, tmp1779
+# blake2s-generic.c:56:     FULLROUND(6);
+	.loc 1 56 259 view .LVU2135
+	movl	%r12d, 32(%rax)	# _800, MEM[(u32 *)v_1(D) + 32B]
+	.loc 1 56 271 is_stmt 1 view .LVU2136
+.LVL382:
+.LBB1707:
+.LBI1707:
+	.loc 1 5 19 view .LVU2137
+.LBB1708:
+	.loc 1 5 44 view .LVU2138
+# blake2s-generic.c:5: static inline u32 ror(unsigned l, u32 x) { return (x >> l) | (x << (32-l)); }
+	.loc 1 5 60 is_stmt 0 view .LVU2139
+	rorl	$7, %r14d	#, tmp1779
+.LBE1708:
+.LBE1707:
+# blake2s-generic.c:56:     FULLROUND(6);
+	.loc 1 56 281 view .LVU2140
+	movl	%r12d, -28(%rsp)	# _800, %sfp
+# blake2s-generic.c:56:     FULLROUND(6);
+	.loc 1 56 279 view .LVU2141
+	movl	%r14d, 16(%rax)	# _802, MEM[(u32 *)v_1(D) + 16B]
+	.loc 1 56 13 is_stmt 1 view .LVU2142
+	.loc 1 56 322 view .LVU2143
+	.loc 1 56 327 view .LVU2144
+# blake2s-generic.c:56:     FULLROUND(6);
+	.loc 1 56 335 is_stmt 0 view .LVU2145
+	addl	4(%r9), %esi	# MEM[(const u32 *)m_4(D) + 4B], tmp1780
+	addl	%ebp, %esi	# _738, _805
+# blake2s-generic.c:56:     FULLROUND(6);
+	.loc 1 56 279 view .LVU2146
+	movl	%r14d, -24(%rsp)	# _802, %sfp
+# blake2s-generic.c:56:     FULLROUND(6);
+	.loc 1 56 388 view .LVU2147
+	xorl	%esi, %ecx	# _805, tmp1782
+# blake2s-generic.c:56:     FULLROUND(6);
+	.loc 1 56 335 view .LVU2148
+	movl	%esi, 4(%rax)	# _805, MEM[(u32 *)v_1(D) + 4B]
+	.loc 1 56 378 is_stmt 1 view .LVU2149
+.LVL383:
+.LBB1709:
+.LBI1709:
+	.loc 1 5 19 view .LVU2150
+.LBB1710:
+	.loc 1 5 44 view .LVU2151
+# blake2s-generic.c:5: static inline u32 ror(unsigned l, u32 x) { return (x >> l) | (x << (32-l)); }
+	.loc 1 5 60 is_stmt 0 view .LVU2152
+	roll	$16, %ecx	#, _807
+.LVL384:
+	.loc 1 5 60 view .LVU2153
+.LBE1710:
+.LBE1709:
+# blake2s-generic.c:56:     FULLROUND(6);
+	.loc 1 56 424 view .LVU2154
+	addl	%ecx, %r15d	# _807, _808
+# blake2s-generic.c:56:     FULLROUND(6);
+	.loc 1 56 386 view .LVU2155
+	movl	%ecx, 52(%rax)	# _807, MEM[(u32 *)v_1(D) + 52B]
+	.loc 1 56 416 is_stmt 1 view .LVU2156
+# blake2s-generic.c:56:     FULLROUND(6);
+	.loc 1 56 446 is_stmt 0 view .LVU2157
+	xorl	%r15d, %ebp	# _808, tmp1783
+# blake2s-generic.c:56:     FULLROUND(6);
+	.loc 1 56 424 view .LVU2158
+	movl	%r15d, 36(%rax)	# _808, MEM[(u32 *)v_1(D) + 36B]
+	.loc 1 56 436 is_stmt 1 view .LVU2159
+.LVL385:
+.LBB1711:
+.LBI1711:
+	.loc 1 5 19 view .LVU2160
+.LBB1712:
+	.loc 1 5 44 view .LVU2161
+# blake2s-generic.c:5: static inline u32 ror(unsigned l, u32 x) { return (x >> l) | (x << (32-l)); }
+	.loc 1 5 60 is_stmt 0 view .LVU2162
+	rorl	$12, %ebp	#, _810
+.LVL386:
+	.loc 1 5 60 view .LVU2163
+.LBE1712:
+.LBE1711:
+# blake2s-generic.c:56:     FULLROUND(6);
+	.loc 1 56 444 view .LVU2164
+	movl	%ebp, 20(%rax)	# _810, MEM[(u32 *)v_1(D) + 20B]
+	.loc 1 56 474 is_stmt 1 view .LVU2165
+# blake2s-generic.c:56:     FULLROUND(6);
+	.loc 1 56 482 is_stmt 0 view .LVU2166
+	addl	60(%r9), %esi	# MEM[(const u32 *)m_4(D) + 60B], tmp1784
+	addl	%ebp, %esi	# _810, _813
+# blake2s-generic.c:56:     FULLROUND(6);
+	.loc 1 56 535 view .LVU2167
+	xorl	%esi, %ecx	# _813, tmp1786
+# blake2s-generic.c:56:     FULLROUND(6);
+	.loc 1 56 482 view .LVU2168
+	movl	%esi, 4(%rax)	# _813, MEM[(u32 *)v_1(D) + 4B]
+	.loc 1 56 525 is_stmt 1 view .LVU2169
+.LVL387:
+.LBB1713:
+.LBI1713:
+	.loc 1 5 19 view .LVU2170
+.LBB1714:
+	.loc 1 5 44 view .LVU2171
+.LBE1714:
+.LBE1713:
+# blake2s-generic.c:56:     FULLROUND(6);
+	.loc 1 56 1012 is_stmt 0 view .LVU2172
+	movl	-16(%rsp), %r12d	# %sfp, _735
+.LBB1716:
+.LBB1715:
+# blake2s-generic.c:5: static inline u32 ror(unsigned l, u32 x) { return (x >> l) | (x << (32-l)); }
+	.loc 1 5 60 view .LVU2173
+	rorl	$8, %ecx	#, _815
+.LVL388:
+	.loc 1 5 60 view .LVU2174
+.LBE1715:
+.LBE1716:
+# blake2s-generic.c:56:     FULLROUND(6);
+	.loc 1 56 571 view .LVU2175
+	addl	%ecx, %r15d	# _815, _816
+# blake2s-generic.c:56:     FULLROUND(6);
+	.loc 1 56 533 view .LVU2176
+	movl	%ecx, 52(%rax)	# _815, MEM[(u32 *)v_1(D) + 52B]
+	.loc 1 56 563 is_stmt 1 view .LVU2177
+# blake2s-generic.c:56:     FULLROUND(6);
+	.loc 1 56 593 is_stmt 0 view .LVU2178
+	xorl	%r15d, %ebp	# _816, tmp1787
+# blake2s-generic.c:56:     FULLROUND(6);
+	.loc 1 56 571 view .LVU2179
+	movl	%r15d, 36(%rax)	# _816, MEM[(u32 *)v_1(D) + 36B]
+	.loc 1 56 583 is_stmt 1 view .LVU2180
+.LVL389:
+.LBB1717:
+.LBI1717:
+	.loc 1 5 19 view .LVU2181
+.LBB1718:
+	.loc 1 5 44 view .LVU2182
+# blake2s-generic.c:5: static inline u32 ror(unsigned l, u32 x) { return (x >> l) | (x << (32-l)); }
+	.loc 1 5 60 is_stmt 0 view .LVU2183
+	rorl	$7, %ebp	#, _818
+.LVL390:
+	.loc 1 5 60 view .LVU2184
+.LBE1718:
+.LBE1717:
+# blake2s-generic.c:56:     FULLROUND(6);
+	.loc 1 56 593 view .LVU2185
+	movl	%r15d, -20(%rsp)	# _816, %sfp
+# blake2s-generic.c:56:     FULLROUND(6);
+	.loc 1 56 736 view .LVU2186
+	movl	-12(%rsp), %r15d	# %sfp, _736
+# blake2s-generic.c:56:     FULLROUND(6);
+	.loc 1 56 591 view .LVU2187
+	movl	%ebp, 20(%rax)	# _818, MEM[(u32 *)v_1(D) + 20B]
+	.loc 1 56 325 is_stmt 1 view .LVU2188
+	.loc 1 56 634 view .LVU2189
+	.loc 1 56 639 view .LVU2190
+# blake2s-generic.c:56:     FULLROUND(6);
+	.loc 1 56 647 is_stmt 0 view .LVU2191
+	addl	56(%r9), %edx	# MEM[(const u32 *)m_4(D) + 56B], tmp1788
+	addl	%ebx, %edx	# _754, _821
+# blake2s-generic.c:56:     FULLROUND(6);
+	.loc 1 56 700 view .LVU2192
+	xorl	%edx, %r13d	# _821, tmp1790
+# blake2s-generic.c:56:     FULLROUND(6);
+	.loc 1 56 647 view .LVU2193
+	movl	%edx, 8(%rax)	# _821, MEM[(u32 *)v_1(D) + 8B]
+	.loc 1 56 690 is_stmt 1 view .LVU2194
+.LVL391:
+.LBB1719:
+.LBI1719:
+	.loc 1 5 19 view .LVU2195
+.LBB1720:
+	.loc 1 5 44 view .LVU2196
+# blake2s-generic.c:5: static inline u32 ror(unsigned l, u32 x) { return (x >> l) | (x << (32-l)); }
+	.loc 1 5 60 is_stmt 0 view .LVU2197
+	roll	$16, %r13d	#, _823
+.LVL392:
+	.loc 1 5 60 view .LVU2198
+.LBE1720:
+.LBE1719:
+# blake2s-generic.c:56:     FULLROUND(6);
+	.loc 1 56 736 view .LVU2199
+	leal	(%r15,%r13), %r14d	#, _824
+# blake2s-generic.c:56:     FULLROUND(6);
+	.loc 1 56 698 view .LVU2200
+	movl	%r13d, 56(%rax)	# _823, MEM[(u32 *)v_1(D) + 56B]
+	.loc 1 56 728 is_stmt 1 view .LVU2201
+# blake2s-generic.c:56:     FULLROUND(6);
+	.loc 1 56 1048 is_stmt 0 view .LVU2202
+	movl	-8(%rsp), %r15d	# %sfp, _752
+# blake2s-generic.c:56:     FULLROUND(6);
+	.loc 1 56 758 view .LVU2203
+	xorl	%r14d, %ebx	# _824, tmp1791
+# blake2s-generic.c:56:     FULLROUND(6);
+	.loc 1 56 736 view .LVU2204
+	movl	%r14d, 40(%rax)	# _824, MEM[(u32 *)v_1(D) + 40B]
+	.loc 1 56 748 is_stmt 1 view .LVU2205
+.LVL393:
+.LBB1721:
+.LBI1721:
+	.loc 1 5 19 view .LVU2206
+.LBB1722:
+	.loc 1 5 44 view .LVU2207
+# blake2s-generic.c:5: static inline u32 ror(unsigned l, u32 x) { return (x >> l) | (x << (32-l)); }
+	.loc 1 5 60 is_stmt 0 view .LVU2208
+	rorl	$12, %ebx	#, _826
+.LVL394:
+	.loc 1 5 60 view .LVU2209
+.LBE1722:
+.LBE1721:
+# blake2s-generic.c:56:     FULLROUND(6);
+	.loc 1 56 756 view .LVU2210
+	movl	%ebx, 24(%rax)	# _826, MEM[(u32 *)v_1(D) + 24B]
+	.loc 1 56 786 is_stmt 1 view .LVU2211
+# blake2s-generic.c:56:     FULLROUND(6);
+	.loc 1 56 794 is_stmt 0 view .LVU2212
+	addl	52(%r9), %edx	# MEM[(const u32 *)m_4(D) + 52B], tmp1792
+	addl	%ebx, %edx	# _826, _829
+# blake2s-generic.c:56:     FULLROUND(6);
+	.loc 1 56 847 view .LVU2213
+	xorl	%edx, %r13d	# _829, tmp1794
+# blake2s-generic.c:56:     FULLROUND(6);
+	.loc 1 56 794 view .LVU2214
+	movl	%edx, 8(%rax)	# _829, MEM[(u32 *)v_1(D) + 8B]
+	.loc 1 56 837 is_stmt 1 view .LVU2215
+.LVL395:
+.LBB1723:
+.LBI1723:
+	.loc 1 5 19 view .LVU2216
+.LBB1724:
+	.loc 1 5 44 view .LVU2217
+# blake2s-generic.c:5: static inline u32 ror(unsigned l, u32 x) { return (x >> l) | (x << (32-l)); }
+	.loc 1 5 60 is_stmt 0 view .LVU2218
+	rorl	$8, %r13d	#, _831
+.LVL396:
+	.loc 1 5 60 view .LVU2219
+.LBE1724:
+.LBE1723:
+# blake2s-generic.c:56:     FULLROUND(6);
+	.loc 1 56 883 view .LVU2220
+	addl	%r13d, %r14d	# _831, _832
+# blake2s-generic.c:56:     FULLROUND(6);
+	.loc 1 56 845 view .LVU2221
+	movl	%r13d, 56(%rax)	# _831, MEM[(u32 *)v_1(D) + 56B]
+	.loc 1 56 875 is_stmt 1 view .LVU2222
+# blake2s-generic.c:56:     FULLROUND(6);
+	.loc 1 56 905 is_stmt 0 view .LVU2223
+	xorl	%r14d, %ebx	# _832, tmp1795
+# blake2s-generic.c:56:     FULLROUND(6);
+	.loc 1 56 883 view .LVU2224
+	movl	%r14d, 40(%rax)	# _832, MEM[(u32 *)v_1(D) + 40B]
+	.loc 1 56 895 is_stmt 1 view .LVU2225
+.LVL397:
+.LBB1725:
+.LBI1725:
+	.loc 1 5 19 view .LVU2226
+.LBB1726:
+	.loc 1 5 44 view .LVU2227
+# blake2s-generic.c:5: static inline u32 ror(unsigned l, u32 x) { return (x >> l) | (x << (32-l)); }
+	.loc 1 5 60 is_stmt 0 view .LVU2228
+	rorl	$7, %ebx	#, _834
+.LVL398:
+	.loc 1 5 60 view .LVU2229
+.LBE1726:
+.LBE1725:
+# blake2s-generic.c:56:     FULLROUND(6);
+	.loc 1 56 903 view .LVU2230
+	movl	%ebx, 24(%rax)	# _834, MEM[(u32 *)v_1(D) + 24B]
+	.loc 1 56 637 is_stmt 1 view .LVU2231
+	.loc 1 56 946 view .LVU2232
+	.loc 1 56 951 view .LVU2233
+# blake2s-generic.c:56:     FULLROUND(6);
+	.loc 1 56 959 is_stmt 0 view .LVU2234
+	addl	16(%r9), %r10d	# MEM[(const u32 *)m_4(D) + 16B], tmp1796
+	addl	%r11d, %r10d	# _770, _837
+# blake2s-generic.c:56:     FULLROUND(6);
+	.loc 1 56 1012 view .LVU2235
+	xorl	%r10d, %r12d	# _837, _735
+# blake2s-generic.c:56:     FULLROUND(6);
+	.loc 1 56 959 view .LVU2236
+	movl	%r10d, 12(%rax)	# _837, MEM[(u32 *)v_1(D) + 12B]
+	.loc 1 56 1002 is_stmt 1 view .LVU2237
+.LVL399:
+.LBB1727:
+.LBI1727:
+	.loc 1 5 19 view .LVU2238
+.LBB1728:
+	.loc 1 5 44 view .LVU2239
+# blake2s-generic.c:5: static inline u32 ror(unsigned l, u32 x) { return (x >> l) | (x << (32-l)); }
+	.loc 1 5 60 is_stmt 0 view .LVU2240
+	roll	$16, %r12d	#, _839
+.LVL400:
+	.loc 1 5 60 view .LVU2241
+.LBE1728:
+.LBE1727:
+# blake2s-generic.c:56:     FULLROUND(6);
+	.loc 1 56 1048 view .LVU2242
+	addl	%r12d, %r15d	# _839, _840
+# blake2s-generic.c:56:     FULLROUND(6);
+	.loc 1 56 1010 view .LVU2243
+	movl	%r12d, 60(%rax)	# _839, MEM[(u32 *)v_1(D) + 60B]
+	.loc 1 56 1040 is_stmt 1 view .LVU2244
+# blake2s-generic.c:56:     FULLROUND(6);
+	.loc 1 56 1070 is_stmt 0 view .LVU2245
+	xorl	%r15d, %r11d	# _840, tmp1799
+# blake2s-generic.c:56:     FULLROUND(6);
+	.loc 1 56 1048 view .LVU2246
+	movl	%r15d, 44(%rax)	# _840, MEM[(u32 *)v_1(D) + 44B]
+	.loc 1 56 1060 is_stmt 1 view .LVU2247
+.LVL401:
+.LBB1729:
+.LBI1729:
+	.loc 1 5 19 view .LVU2248
+.LBB1730:
+	.loc 1 5 44 view .LVU2249
+# blake2s-generic.c:5: static inline u32 ror(unsigned l, u32 x) { return (x >> l) | (x << (32-l)); }
+	.loc 1 5 60 is_stmt 0 view .LVU2250
+	rorl	$12, %r11d	#, _842
+.LVL402:
+	.loc 1 5 60 view .LVU2251
+.LBE1730:
+.LBE1729:
+# blake2s-generic.c:56:     FULLROUND(6);
+	.loc 1 56 1068 view .LVU2252
+	movl	%r11d, 28(%rax)	# _842, MEM[(u32 *)v_1(D) + 28B]
+	.loc 1 56 1098 is_stmt 1 view .LVU2253
+# blake2s-generic.c:56:     FULLROUND(6);
+	.loc 1 56 1106 is_stmt 0 view .LVU2254
+	addl	40(%r9), %r10d	# MEM[(const u32 *)m_4(D) + 40B], tmp1800
+	addl	%r11d, %r10d	# _842, _845
+# blake2s-generic.c:56:     FULLROUND(6);
+	.loc 1 56 1159 view .LVU2255
+	xorl	%r10d, %r12d	# _845, tmp1802
+# blake2s-generic.c:56:     FULLROUND(6);
+	.loc 1 56 1106 view .LVU2256
+	movl	%r10d, 12(%rax)	# _845, MEM[(u32 *)v_1(D) + 12B]
+	.loc 1 56 1149 is_stmt 1 view .LVU2257
+.LVL403:
+.LBB1731:
+.LBI1731:
+	.loc 1 5 19 view .LVU2258
+.LBB1732:
+	.loc 1 5 44 view .LVU2259
+# blake2s-generic.c:5: static inline u32 ror(unsigned l, u32 x) { return (x >> l) | (x << (32-l)); }
+	.loc 1 5 60 is_stmt 0 view .LVU2260
+	rorl	$8, %r12d	#, _847
+.LVL404:
+	.loc 1 5 60 view .LVU2261
+.LBE1732:
+.LBE1731:
+# blake2s-generic.c:56:     FULLROUND(6);
+	.loc 1 56 1195 view .LVU2262
+	addl	%r12d, %r15d	# _847, _848
+# blake2s-generic.c:56:     FULLROUND(6);
+	.loc 1 56 1157 view .LVU2263
+	movl	%r12d, 60(%rax)	# _847, MEM[(u32 *)v_1(D) + 60B]
+	.loc 1 56 1187 is_stmt 1 view .LVU2264
+# blake2s-generic.c:56:     FULLROUND(6);
+	.loc 1 56 1217 is_stmt 0 view .LVU2265
+	xorl	%r15d, %r11d	# _848, tmp1803
+# blake2s-generic.c:56:     FULLROUND(6);
+	.loc 1 56 1195 view .LVU2266
+	movl	%r15d, 44(%rax)	# _848, MEM[(u32 *)v_1(D) + 44B]
+	.loc 1 56 1207 is_stmt 1 view .LVU2267
+.LVL405:
+.LBB1733:
+.LBI1733:
+	.loc 1 5 19 view .LVU2268
+.LBB1734:
+	.loc 1 5 44 view .LVU2269
+# blake2s-generic.c:5: static inline u32 ror(unsigned l, u32 x) { return (x >> l) | (x << (32-l)); }
+	.loc 1 5 60 is_stmt 0 view .LVU2270
+	rorl	$7, %r11d	#, _850
+.LVL406:
+	.loc 1 5 60 view .LVU2271
+.LBE1734:
+.LBE1733:
+# blake2s-generic.c:56:     FULLROUND(6);
+	.loc 1 56 1215 view .LVU2272
+	movl	%r11d, 28(%rax)	# _850, MEM[(u32 *)v_1(D) + 28B]
+	.loc 1 56 949 is_stmt 1 view .LVU2273
+	.loc 1 56 1258 view .LVU2274
+	.loc 1 56 1263 view .LVU2275
+# blake2s-generic.c:56:     FULLROUND(6);
+	.loc 1 56 1271 is_stmt 0 view .LVU2276
+	addl	(%r9), %r8d	# *m_4(D), tmp1804
+	addl	%ebp, %r8d	# _818, _853
+# blake2s-generic.c:56:     FULLROUND(6);
+	.loc 1 56 1324 view .LVU2277
+	xorl	%r8d, %r12d	# _853, tmp1806
+# blake2s-generic.c:56:     FULLROUND(6);
+	.loc 1 56 1271 view .LVU2278
+	movl	%r8d, (%rax)	# _853, *v_1(D)
+	.loc 1 56 1314 is_stmt 1 view .LVU2279
+.LVL407:
+.LBB1735:
+.LBI1735:
+	.loc 1 5 19 view .LVU2280
+.LBB1736:
+	.loc 1 5 44 view .LVU2281
+# blake2s-generic.c:5: static inline u32 ror(unsigned l, u32 x) { return (x >> l) | (x << (32-l)); }
+	.loc 1 5 60 is_stmt 0 view .LVU2282
+	roll	$16, %r12d	#, _855
+.LVL408:
+	.loc 1 5 60 view .LVU2283
+.LBE1736:
+.LBE1735:
+# blake2s-generic.c:56:     FULLROUND(6);
+	.loc 1 56 1360 view .LVU2284
+	addl	%r12d, %r14d	# _855, _856
+# blake2s-generic.c:56:     FULLROUND(6);
+	.loc 1 56 1322 view .LVU2285
+	movl	%r12d, 60(%rax)	# _855, MEM[(u32 *)v_1(D) + 60B]
+	.loc 1 56 1352 is_stmt 1 view .LVU2286
+# blake2s-generic.c:56:     FULLROUND(6);
+	.loc 1 56 1382 is_stmt 0 view .LVU2287
+	xorl	%r14d, %ebp	# _856, tmp1807
+# blake2s-generic.c:56:     FULLROUND(6);
+	.loc 1 56 1360 view .LVU2288
+	movl	%r14d, 40(%rax)	# _856, MEM[(u32 *)v_1(D) + 40B]
+	.loc 1 56 1372 is_stmt 1 view .LVU2289
+.LVL409:
+.LBB1737:
+.LBI1737:
+	.loc 1 5 19 view .LVU2290
+.LBB1738:
+	.loc 1 5 44 view .LVU2291
+# blake2s-generic.c:5: static inline u32 ror(unsigned l, u32 x) { return (x >> l) | (x << (32-l)); }
+	.loc 1 5 60 is_stmt 0 view .LVU2292
+	rorl	$12, %ebp	#, _858
+.LVL410:
+	.loc 1 5 60 view .LVU2293
+.LBE1738:
+.LBE1737:
+# blake2s-generic.c:56:     FULLROUND(6);
+	.loc 1 56 1380 view .LVU2294
+	movl	%ebp, 20(%rax)	# _858, MEM[(u32 *)v_1(D) + 20B]
+	.loc 1 56 1410 is_stmt 1 view .LVU2295
+# blake2s-generic.c:56:     FULLROUND(6);
+	.loc 1 56 1418 is_stmt 0 view .LVU2296
+	addl	28(%r9), %r8d	# MEM[(const u32 *)m_4(D) + 28B], tmp1808
+	addl	%ebp, %r8d	# _858, _861
+# blake2s-generic.c:56:     FULLROUND(6);
+	.loc 1 56 1471 view .LVU2297
+	xorl	%r8d, %r12d	# _861, tmp1810
+# blake2s-generic.c:56:     FULLROUND(6);
+	.loc 1 56 1418 view .LVU2298
+	movl	%r8d, (%rax)	# _861, *v_1(D)
+	.loc 1 56 1461 is_stmt 1 view .LVU2299
+.LVL411:
+.LBB1739:
+.LBI1739:
+	.loc 1 5 19 view .LVU2300
+.LBB1740:
+	.loc 1 5 44 view .LVU2301
+# blake2s-generic.c:5: static inline u32 ror(unsigned l, u32 x) { return (x >> l) | (x << (32-l)); }
+	.loc 1 5 60 is_stmt 0 view .LVU2302
+	rorl	$8, %r12d	#, tmp1810
+.LBE1740:
+.LBE1739:
+# blake2s-generic.c:56:     FULLROUND(6);
+	.loc 1 56 1507 view .LVU2303
+	addl	%r12d, %r14d	# _863, _864
+# blake2s-generic.c:56:     FULLROUND(6);
+	.loc 1 56 1469 view .LVU2304
+	movl	%r12d, 60(%rax)	# _863, MEM[(u32 *)v_1(D) + 60B]
+	.loc 1 56 1499 is_stmt 1 view .LVU2305
+# blake2s-generic.c:56:     FULLROUND(6);
+	.loc 1 56 1529 is_stmt 0 view .LVU2306
+	xorl	%r14d, %ebp	# _864, tmp1811
+# blake2s-generic.c:56:     FULLROUND(6);
+	.loc 1 56 1507 view .LVU2307
+	movl	%r14d, 40(%rax)	# _864, MEM[(u32 *)v_1(D) + 40B]
+	.loc 1 56 1519 is_stmt 1 view .LVU2308
+.LVL412:
+.LBB1741:
+.LBI1741:
+	.loc 1 5 19 view .LVU2309
+.LBB1742:
+	.loc 1 5 44 view .LVU2310
+# blake2s-generic.c:5: static inline u32 ror(unsigned l, u32 x) { return (x >> l) | (x << (32-l)); }
+	.loc 1 5 60 is_stmt 0 view .LVU2311
+	rorl	$7, %ebp	#, _866
+.LVL413:
+	.loc 1 5 60 view .LVU2312
+.LBE1742:
+.LBE1741:
+# blake2s-generic.c:56:     FULLROUND(6);
+	.loc 1 56 1507 view .LVU2313
+	movl	%r12d, -16(%rsp)	# _863, %sfp
+# blake2s-generic.c:56:     FULLROUND(6);
+	.loc 1 56 1527 view .LVU2314
+	movl	%ebp, 20(%rax)	# _866, MEM[(u32 *)v_1(D) + 20B]
+	.loc 1 56 1261 is_stmt 1 view .LVU2315
+	.loc 1 56 1570 view .LVU2316
+	.loc 1 56 1575 view .LVU2317
+# blake2s-generic.c:56:     FULLROUND(6);
+	.loc 1 56 1583 is_stmt 0 view .LVU2318
+	addl	24(%r9), %esi	# MEM[(const u32 *)m_4(D) + 24B], tmp1812
+	addl	%ebx, %esi	# _834, _869
+# blake2s-generic.c:56:     FULLROUND(6);
+	.loc 1 56 1529 view .LVU2319
+	movl	%r14d, -12(%rsp)	# _864, %sfp
+# blake2s-generic.c:56:     FULLROUND(6);
+	.loc 1 56 2211 view .LVU2320
+	movl	-24(%rsp), %r14d	# %sfp, _802
+# blake2s-generic.c:56:     FULLROUND(6);
+	.loc 1 56 1637 view .LVU2321
+	xorl	%esi, %edi	# _869, tmp1814
+# blake2s-generic.c:56:     FULLROUND(6);
+	.loc 1 56 1583 view .LVU2322
+	movl	%esi, 4(%rax)	# _869, MEM[(u32 *)v_1(D) + 4B]
+	.loc 1 56 1627 is_stmt 1 view .LVU2323
+.LVL414:
+.LBB1743:
+.LBI1743:
+	.loc 1 5 19 view .LVU2324
+.LBB1744:
+	.loc 1 5 44 view .LVU2325
+# blake2s-generic.c:5: static inline u32 ror(unsigned l, u32 x) { return (x >> l) | (x << (32-l)); }
+	.loc 1 5 60 is_stmt 0 view .LVU2326
+	roll	$16, %edi	#, _871
+.LVL415:
+	.loc 1 5 60 view .LVU2327
+.LBE1744:
+.LBE1743:
+# blake2s-generic.c:56:     FULLROUND(6);
+	.loc 1 56 1673 view .LVU2328
+	addl	%edi, %r15d	# _871, _872
+# blake2s-generic.c:56:     FULLROUND(6);
+	.loc 1 56 1635 view .LVU2329
+	movl	%edi, 48(%rax)	# _871, MEM[(u32 *)v_1(D) + 48B]
+	.loc 1 56 1665 is_stmt 1 view .LVU2330
+# blake2s-generic.c:56:     FULLROUND(6);
+	.loc 1 56 1695 is_stmt 0 view .LVU2331
+	xorl	%r15d, %ebx	# _872, tmp1815
+# blake2s-generic.c:56:     FULLROUND(6);
+	.loc 1 56 1673 view .LVU2332
+	movl	%r15d, 44(%rax)	# _872, MEM[(u32 *)v_1(D) + 44B]
+	.loc 1 56 1685 is_stmt 1 view .LVU2333
+.LVL416:
+.LBB1745:
+.LBI1745:
+	.loc 1 5 19 view .LVU2334
+.LBB1746:
+	.loc 1 5 44 view .LVU2335
+# blake2s-generic.c:5: static inline u32 ror(unsigned l, u32 x) { return (x >> l) | (x << (32-l)); }
+	.loc 1 5 60 is_stmt 0 view .LVU2336
+	rorl	$12, %ebx	#, _874
+.LVL417:
+	.loc 1 5 60 view .LVU2337
+.LBE1746:
+.LBE1745:
+# blake2s-generic.c:56:     FULLROUND(6);
+	.loc 1 56 1693 view .LVU2338
+	movl	%ebx, 24(%rax)	# _874, MEM[(u32 *)v_1(D) + 24B]
+	.loc 1 56 1723 is_stmt 1 view .LVU2339
+# blake2s-generic.c:56:     FULLROUND(6);
+	.loc 1 56 1731 is_stmt 0 view .LVU2340
+	addl	12(%r9), %esi	# MEM[(const u32 *)m_4(D) + 12B], tmp1816
+	addl	%ebx, %esi	# _874, _877
+# blake2s-generic.c:56:     FULLROUND(6);
+	.loc 1 56 1785 view .LVU2341
+	xorl	%esi, %edi	# _877, tmp1818
+# blake2s-generic.c:56:     FULLROUND(6);
+	.loc 1 56 1731 view .LVU2342
+	movl	%esi, 4(%rax)	# _877, MEM[(u32 *)v_1(D) + 4B]
+	.loc 1 56 1775 is_stmt 1 view .LVU2343
+.LVL418:
+.LBB1747:
+.LBI1747:
+	.loc 1 5 19 view .LVU2344
+.LBB1748:
+	.loc 1 5 44 view .LVU2345
+# blake2s-generic.c:5: static inline u32 ror(unsigned l, u32 x) { return (x >> l) | (x << (32-l)); }
+	.loc 1 5 60 is_stmt 0 view .LVU2346
+	rorl	$8, %edi	#, _879
+.LVL419:
+	.loc 1 5 60 view .LVU2347
+.LBE1748:
+.LBE1747:
+# blake2s-generic.c:56:     FULLROUND(6);
+	.loc 1 56 1821 view .LVU2348
+	addl	%edi, %r15d	# _879, _880
+# blake2s-generic.c:56:     FULLROUND(6);
+	.loc 1 56 1783 view .LVU2349
+	movl	%edi, 48(%rax)	# _879, MEM[(u32 *)v_1(D) + 48B]
+	.loc 1 56 1813 is_stmt 1 view .LVU2350
+# blake2s-generic.c:56:     FULLROUND(6);
+	.loc 1 56 1843 is_stmt 0 view .LVU2351
+	xorl	%r15d, %ebx	# _880, tmp1819
+# blake2s-generic.c:56:     FULLROUND(6);
+	.loc 1 56 1821 view .LVU2352
+	movl	%r15d, 44(%rax)	# _880, MEM[(u32 *)v_1(D) + 44B]
+	.loc 1 56 1833 is_stmt 1 view .LVU2353
+.LVL420:
+.LBB1749:
+.LBI1749:
+	.loc 1 5 19 view .LVU2354
+.LBB1750:
+	.loc 1 5 44 view .LVU2355
+# blake2s-generic.c:5: static inline u32 ror(unsigned l, u32 x) { return (x >> l) | (x << (32-l)); }
+	.loc 1 5 60 is_stmt 0 view .LVU2356
+	rorl	$7, %ebx	#, _882
+.LVL421:
+	.loc 1 5 60 view .LVU2357
+.LBE1750:
+.LBE1749:
+# blake2s-generic.c:56:     FULLROUND(6);
+	.loc 1 56 1843 view .LVU2358
+	movl	%r15d, -8(%rsp)	# _880, %sfp
+# blake2s-generic.c:56:     FULLROUND(6);
+	.loc 1 56 1987 view .LVU2359
+	movl	-28(%rsp), %r15d	# %sfp, _800
+# blake2s-generic.c:56:     FULLROUND(6);
+	.loc 1 56 1841 view .LVU2360
+	movl	%ebx, 24(%rax)	# _882, MEM[(u32 *)v_1(D) + 24B]
+	.loc 1 56 1573 is_stmt 1 view .LVU2361
+	.loc 1 56 1884 view .LVU2362
+	.loc 1 56 1889 view .LVU2363
+# blake2s-generic.c:56:     FULLROUND(6);
+	.loc 1 56 1897 is_stmt 0 view .LVU2364
+	addl	36(%r9), %edx	# MEM[(const u32 *)m_4(D) + 36B], tmp1820
+	addl	%r11d, %edx	# _850, _885
+# blake2s-generic.c:56:     FULLROUND(6);
+	.loc 1 56 1951 view .LVU2365
+	xorl	%edx, %ecx	# _885, tmp1822
+# blake2s-generic.c:56:     FULLROUND(6);
+	.loc 1 56 1897 view .LVU2366
+	movl	%edx, 8(%rax)	# _885, MEM[(u32 *)v_1(D) + 8B]
+	.loc 1 56 1941 is_stmt 1 view .LVU2367
+.LVL422:
+.LBB1751:
+.LBI1751:
+	.loc 1 5 19 view .LVU2368
+.LBB1752:
+	.loc 1 5 44 view .LVU2369
+# blake2s-generic.c:5: static inline u32 ror(unsigned l, u32 x) { return (x >> l) | (x << (32-l)); }
+	.loc 1 5 60 is_stmt 0 view .LVU2370
+	roll	$16, %ecx	#, _887
+.LVL423:
+	.loc 1 5 60 view .LVU2371
+.LBE1752:
+.LBE1751:
+# blake2s-generic.c:56:     FULLROUND(6);
+	.loc 1 56 1987 view .LVU2372
+	leal	(%r15,%rcx), %r12d	#, _888
+# blake2s-generic.c:56:     FULLROUND(6);
+	.loc 1 56 1949 view .LVU2373
+	movl	%ecx, 52(%rax)	# _887, MEM[(u32 *)v_1(D) + 52B]
+	.loc 1 56 1979 is_stmt 1 view .LVU2374
+# blake2s-generic.c:56:     FULLROUND(6);
+	.loc 1 56 2009 is_stmt 0 view .LVU2375
+	xorl	%r12d, %r11d	# _888, tmp1823
+# blake2s-generic.c:56:     FULLROUND(6);
+	.loc 1 56 1987 view .LVU2376
+	movl	%r12d, 32(%rax)	# _888, MEM[(u32 *)v_1(D) + 32B]
+	.loc 1 56 1999 is_stmt 1 view .LVU2377
+.LVL424:
+.LBB1753:
+.LBI1753:
+	.loc 1 5 19 view .LVU2378
+.LBB1754:
+	.loc 1 5 44 view .LVU2379
+# blake2s-generic.c:5: static inline u32 ror(unsigned l, u32 x) { return (x >> l) | (x << (32-l)); }
+	.loc 1 5 60 is_stmt 0 view .LVU2380
+	rorl	$12, %r11d	#, _890
+.LVL425:
+	.loc 1 5 60 view .LVU2381
+.LBE1754:
+.LBE1753:
+# blake2s-generic.c:56:     FULLROUND(6);
+	.loc 1 56 2007 view .LVU2382
+	movl	%r11d, 28(%rax)	# _890, MEM[(u32 *)v_1(D) + 28B]
+	.loc 1 56 2037 is_stmt 1 view .LVU2383
+# blake2s-generic.c:56:     FULLROUND(6);
+	.loc 1 56 2045 is_stmt 0 view .LVU2384
+	addl	8(%r9), %edx	# MEM[(const u32 *)m_4(D) + 8B], tmp1824
+	addl	%r11d, %edx	# _890, _893
+# blake2s-generic.c:56:     FULLROUND(6);
+	.loc 1 56 2099 view .LVU2385
+	xorl	%edx, %ecx	# _893, tmp1826
+# blake2s-generic.c:56:     FULLROUND(6);
+	.loc 1 56 2045 view .LVU2386
+	movl	%edx, 8(%rax)	# _893, MEM[(u32 *)v_1(D) + 8B]
+	.loc 1 56 2089 is_stmt 1 view .LVU2387
+.LVL426:
+.LBB1755:
+.LBI1755:
+	.loc 1 5 19 view .LVU2388
+.LBB1756:
+	.loc 1 5 44 view .LVU2389
+# blake2s-generic.c:5: static inline u32 ror(unsigned l, u32 x) { return (x >> l) | (x << (32-l)); }
+	.loc 1 5 60 is_stmt 0 view .LVU2390
+	rorl	$8, %ecx	#, _895
+.LVL427:
+	.loc 1 5 60 view .LVU2391
+.LBE1756:
+.LBE1755:
+# blake2s-generic.c:56:     FULLROUND(6);
+	.loc 1 56 2135 view .LVU2392
+	addl	%ecx, %r12d	# _895, _896
+# blake2s-generic.c:56:     FULLROUND(6);
+	.loc 1 56 2097 view .LVU2393
+	movl	%ecx, 52(%rax)	# _895, MEM[(u32 *)v_1(D) + 52B]
+	.loc 1 56 2127 is_stmt 1 view .LVU2394
+# blake2s-generic.c:56:     FULLROUND(6);
+	.loc 1 56 2157 is_stmt 0 view .LVU2395
+	xorl	%r12d, %r11d	# _896, tmp1827
+# blake2s-generic.c:56:     FULLROUND(6);
+	.loc 1 56 2135 view .LVU2396
+	movl	%r12d, 32(%rax)	# _896, MEM[(u32 *)v_1(D) + 32B]
+	.loc 1 56 2147 is_stmt 1 view .LVU2397
+.LVL428:
+.LBB1757:
+.LBI1757:
+	.loc 1 5 19 view .LVU2398
+.LBB1758:
+	.loc 1 5 44 view .LVU2399
+# blake2s-generic.c:5: static inline u32 ror(unsigned l, u32 x) { return (x >> l) | (x << (32-l)); }
+	.loc 1 5 60 is_stmt 0 view .LVU2400
+	rorl	$7, %r11d	#, _898
+.LVL429:
+	.loc 1 5 60 view .LVU2401
+.LBE1758:
+.LBE1757:
+# blake2s-generic.c:56:     FULLROUND(6);
+	.loc 1 56 2155 view .LVU2402
+	movl	%r11d, 28(%rax)	# _898, MEM[(u32 *)v_1(D) + 28B]
+	.loc 1 56 1887 is_stmt 1 view .LVU2403
+	.loc 1 56 2198 view .LVU2404
+	.loc 1 56 2203 view .LVU2405
+# blake2s-generic.c:56:     FULLROUND(6);
+	.loc 1 56 2211 is_stmt 0 view .LVU2406
+	addl	32(%r9), %r10d	# MEM[(const u32 *)m_4(D) + 32B], tmp1828
+	addl	%r14d, %r10d	# _802, _901
+# blake2s-generic.c:56:     FULLROUND(6);
+	.loc 1 56 2265 view .LVU2407
+	xorl	%r10d, %r13d	# _901, tmp1830
+# blake2s-generic.c:56:     FULLROUND(6);
+	.loc 1 56 2211 view .LVU2408
+	movl	%r10d, 12(%rax)	# _901, MEM[(u32 *)v_1(D) + 12B]
+	.loc 1 56 2255 is_stmt 1 view .LVU2409
+.LVL430:
+.LBB1759:
+.LBI1759:
+	.loc 1 5 19 view .LVU2410
+.LBB1760:
+	.loc 1 5 44 view .LVU2411
+# blake2s-generic.c:5: static inline u32 ror(unsigned l, u32 x) { return (x >> l) | (x << (32-l)); }
+	.loc 1 5 60 is_stmt 0 view .LVU2412
+	roll	$16, %r13d	#, _903
+.LVL431:
+	.loc 1 5 60 view .LVU2413
+.LBE1760:
+.LBE1759:
+# blake2s-generic.c:56:     FULLROUND(6);
+	.loc 1 56 2263 view .LVU2414
+	movl	%r13d, 56(%rax)	# _903, MEM[(u32 *)v_1(D) + 56B]
+	.loc 1 56 2293 is_stmt 1 view .LVU2415
+# blake2s-generic.c:56:     FULLROUND(6);
+	.loc 1 56 2301 is_stmt 0 view .LVU2416
+	movl	-20(%rsp), %r15d	# %sfp, _816
+	addl	%r13d, %r15d	# _903, _904
+# blake2s-generic.c:56:     FULLROUND(6);
+	.loc 1 56 2323 view .LVU2417
+	xorl	%r15d, %r14d	# _904, _802
+# blake2s-generic.c:56:     FULLROUND(6);
+	.loc 1 56 2301 view .LVU2418
+	movl	%r15d, 36(%rax)	# _904, MEM[(u32 *)v_1(D) + 36B]
+	.loc 1 56 2313 is_stmt 1 view .LVU2419
+.LVL432:
+.LBB1761:
+.LBI1761:
+	.loc 1 5 19 view .LVU2420
+.LBB1762:
+	.loc 1 5 44 view .LVU2421
+# blake2s-generic.c:5: static inline u32 ror(unsigned l, u32 x) { return (x >> l) | (x << (32-l)); }
+	.loc 1 5 60 is_stmt 0 view .LVU2422
+	rorl	$12, %r14d	#, _906
+.LVL433:
+	.loc 1 5 60 view .LVU2423
+.LBE1762:
+.LBE1761:
+# blake2s-generic.c:56:     FULLROUND(6);
+	.loc 1 56 2321 view .LVU2424
+	movl	%r14d, 16(%rax)	# _906, MEM[(u32 *)v_1(D) + 16B]
+	.loc 1 56 2351 is_stmt 1 view .LVU2425
+# blake2s-generic.c:56:     FULLROUND(6);
+	.loc 1 56 2359 is_stmt 0 view .LVU2426
+	addl	44(%r9), %r10d	# MEM[(const u32 *)m_4(D) + 44B], tmp1832
+	addl	%r14d, %r10d	# _906, _909
+# blake2s-generic.c:56:     FULLROUND(6);
+	.loc 1 56 2413 view .LVU2427
+	xorl	%r10d, %r13d	# _909, tmp1834
+# blake2s-generic.c:56:     FULLROUND(6);
+	.loc 1 56 2359 view .LVU2428
+	movl	%r10d, 12(%rax)	# _909, MEM[(u32 *)v_1(D) + 12B]
+	.loc 1 56 2403 is_stmt 1 view .LVU2429
+.LVL434:
+.LBB1763:
+.LBI1763:
+	.loc 1 5 19 view .LVU2430
+.LBB1764:
+	.loc 1 5 44 view .LVU2431
+# blake2s-generic.c:5: static inline u32 ror(unsigned l, u32 x) { return (x >> l) | (x << (32-l)); }
+	.loc 1 5 60 is_stmt 0 view .LVU2432
+	rorl	$8, %r13d	#, _911
+.LVL435:
+	.loc 1 5 60 view .LVU2433
+.LBE1764:
+.LBE1763:
+# blake2s-generic.c:56:     FULLROUND(6);
+	.loc 1 56 2449 view .LVU2434
+	addl	%r13d, %r15d	# _911, _912
+# blake2s-generic.c:56:     FULLROUND(6);
+	.loc 1 56 2411 view .LVU2435
+	movl	%r13d, 56(%rax)	# _911, MEM[(u32 *)v_1(D) + 56B]
+	.loc 1 56 2441 is_stmt 1 view .LVU2436
+# blake2s-generic.c:56:     FULLROUND(6);
+	.loc 1 56 2471 is_stmt 0 view .LVU2437
+	xorl	%r15d, %r14d	# _912, tmp1835
+# blake2s-generic.c:56:     FULLROUND(6);
+	.loc 1 56 2449 view .LVU2438
+	movl	%r15d, 36(%rax)	# _912, MEM[(u32 *)v_1(D) + 36B]
+	.loc 1 56 2461 is_stmt 1 view .LVU2439
+.LVL436:
+.LBB1765:
+.LBI1765:
+	.loc 1 5 19 view .LVU2440
+.LBB1766:
+	.loc 1 5 44 view .LVU2441
+# blake2s-generic.c:5: static inline u32 ror(unsigned l, u32 x) { return (x >> l) | (x << (32-l)); }
+	.loc 1 5 60 is_stmt 0 view .LVU2442
+	rorl	$7, %r14d	#, _914
+.LVL437:
+	.loc 1 5 60 view .LVU2443
+.LBE1766:
+.LBE1765:
+# blake2s-generic.c:56:     FULLROUND(6);
+	.loc 1 56 2469 view .LVU2444
+	movl	%r14d, 16(%rax)	# _914, MEM[(u32 *)v_1(D) + 16B]
+	.loc 1 56 2201 is_stmt 1 view .LVU2445
+	.loc 1 56 8 view .LVU2446
+	.loc 1 57 5 view .LVU2447
+	.loc 1 57 10 view .LVU2448
+	.loc 1 57 15 view .LVU2449
+# blake2s-generic.c:57:     FULLROUND(7);
+	.loc 1 57 23 is_stmt 0 view .LVU2450
+	addl	52(%r9), %r8d	# MEM[(const u32 *)m_4(D) + 52B], tmp1836
+	addl	%r14d, %r8d	# _914, _917
+# blake2s-generic.c:57:     FULLROUND(7);
+	.loc 1 57 76 view .LVU2451
+	xorl	%r8d, %edi	# _917, tmp1838
+# blake2s-generic.c:57:     FULLROUND(7);
+	.loc 1 57 23 view .LVU2452
+	movl	%r8d, (%rax)	# _917, *v_1(D)
+	.loc 1 57 66 is_stmt 1 view .LVU2453
+.LVL438:
+.LBB1767:
+.LBI1767:
+	.loc 1 5 19 view .LVU2454
+.LBB1768:
+	.loc 1 5 44 view .LVU2455
+# blake2s-generic.c:5: static inline u32 ror(unsigned l, u32 x) { return (x >> l) | (x << (32-l)); }
+	.loc 1 5 60 is_stmt 0 view .LVU2456
+	roll	$16, %edi	#, _919
+.LVL439:
+	.loc 1 5 60 view .LVU2457
+.LBE1768:
+.LBE1767:
+# blake2s-generic.c:57:     FULLROUND(7);
+	.loc 1 57 112 view .LVU2458
+	addl	%edi, %r12d	# _919, _920
+# blake2s-generic.c:57:     FULLROUND(7);
+	.loc 1 57 74 view .LVU2459
+	movl	%edi, 48(%rax)	# _919, MEM[(u32 *)v_1(D) + 48B]
+	.loc 1 57 104 is_stmt 1 view .LVU2460
+# blake2s-generic.c:57:     FULLROUND(7);
+	.loc 1 57 134 is_stmt 0 view .LVU2461
+	xorl	%r12d, %r14d	# _920, tmp1839
+# blake2s-generic.c:57:     FULLROUND(7);
+	.loc 1 57 112 view .LVU2462
+	movl	%r12d, 32(%rax)	# _920, MEM[(u32 *)v_1(D) + 32B]
+	.loc 1 57 124 is_stmt 1 view .LVU2463
+.LVL440:
+.LBB1769:
+.LBI1769:
+	.loc 1 5 19 view .LVU2464
+.LBB1770:
+	.loc 1 5 44 view .LVU2465
+# blake2s-generic.c:5: static inline u32 ror(unsigned l, u32 x) { return (x >> l) | (x << (32-l)); }
+	.loc 1 5 60 is_stmt 0 view .LVU2466
+	rorl	$12, %r14d	#, _922
+.LVL441:
+	.loc 1 5 60 view .LVU2467
+.LBE1770:
+.LBE1769:
+# blake2s-generic.c:57:     FULLROUND(7);
+	.loc 1 57 132 view .LVU2468
+	movl	%r14d, 16(%rax)	# _922, MEM[(u32 *)v_1(D) + 16B]
+	.loc 1 57 162 is_stmt 1 view .LVU2469
+# blake2s-generic.c:57:     FULLROUND(7);
+	.loc 1 57 170 is_stmt 0 view .LVU2470
+	addl	44(%r9), %r8d	# MEM[(const u32 *)m_4(D) + 44B], tmp1840
+	addl	%r14d, %r8d	# _922, _925
+# blake2s-generic.c:57:     FULLROUND(7);
+	.loc 1 57 223 view .LVU2471
+	xorl	%r8d, %edi	# _925, tmp1842
+# blake2s-generic.c:57:     FULLROUND(7);
+	.loc 1 57 170 view .LVU2472
+	movl	%r8d, (%rax)	# _925, *v_1(D)
+	.loc 1 57 213 is_stmt 1 view .LVU2473
+.LVL442:
+.LBB1771:
+.LBI1771:
+	.loc 1 5 19 view .LVU2474
+.LBB1772:
+	.loc 1 5 44 view .LVU2475
+# blake2s-generic.c:5: static inline u32 ror(unsigned l, u32 x) { return (x >> l) | (x << (32-l)); }
+	.loc 1 5 60 is_stmt 0 view .LVU2476
+	rorl	$8, %edi	#, _927
+.LVL443:
+	.loc 1 5 60 view .LVU2477
+.LBE1772:
+.LBE1771:
+# blake2s-generic.c:57:     FULLROUND(7);
+	.loc 1 57 259 view .LVU2478
+	addl	%edi, %r12d	# _927, _928
+# blake2s-generic.c:57:     FULLROUND(7);
+	.loc 1 57 221 view .LVU2479
+	movl	%edi, 48(%rax)	# _927, MEM[(u32 *)v_1(D) + 48B]
+	.loc 1 57 251 is_stmt 1 view .LVU2480
+# blake2s-generic.c:57:     FULLROUND(7);
+	.loc 1 57 281 is_stmt 0 view .LVU2481
+	xorl	%r12d, %r14d	# _928, tmp1843
+# blake2s-generic.c:57:     FULLROUND(7);
+	.loc 1 57 259 view .LVU2482
+	movl	%r12d, 32(%rax)	# _928, MEM[(u32 *)v_1(D) + 32B]
+	.loc 1 57 271 is_stmt 1 view .LVU2483
+.LVL444:
+.LBB1773:
+.LBI1773:
+	.loc 1 5 19 view .LVU2484
+.LBB1774:
+	.loc 1 5 44 view .LVU2485
+# blake2s-generic.c:5: static inline u32 ror(unsigned l, u32 x) { return (x >> l) | (x << (32-l)); }
+	.loc 1 5 60 is_stmt 0 view .LVU2486
+	rorl	$7, %r14d	#, tmp1843
+.LBE1774:
+.LBE1773:
+# blake2s-generic.c:57:     FULLROUND(7);
+	.loc 1 57 281 view .LVU2487
+	movl	%r12d, -28(%rsp)	# _928, %sfp
+# blake2s-generic.c:57:     FULLROUND(7);
+	.loc 1 57 279 view .LVU2488
+	movl	%r14d, 16(%rax)	# _930, MEM[(u32 *)v_1(D) + 16B]
+	.loc 1 57 13 is_stmt 1 view .LVU2489
+	.loc 1 57 322 view .LVU2490
+	.loc 1 57 327 view .LVU2491
+# blake2s-generic.c:57:     FULLROUND(7);
+	.loc 1 57 335 is_stmt 0 view .LVU2492
+	addl	28(%r9), %esi	# MEM[(const u32 *)m_4(D) + 28B], tmp1844
+	addl	%ebp, %esi	# _866, _933
+# blake2s-generic.c:57:     FULLROUND(7);
+	.loc 1 57 279 view .LVU2493
+	movl	%r14d, -24(%rsp)	# _930, %sfp
+# blake2s-generic.c:57:     FULLROUND(7);
+	.loc 1 57 388 view .LVU2494
+	xorl	%esi, %ecx	# _933, tmp1846
+# blake2s-generic.c:57:     FULLROUND(7);
+	.loc 1 57 335 view .LVU2495
+	movl	%esi, 4(%rax)	# _933, MEM[(u32 *)v_1(D) + 4B]
+	.loc 1 57 378 is_stmt 1 view .LVU2496
+.LVL445:
+.LBB1775:
+.LBI1775:
+	.loc 1 5 19 view .LVU2497
+.LBB1776:
+	.loc 1 5 44 view .LVU2498
+# blake2s-generic.c:5: static inline u32 ror(unsigned l, u32 x) { return (x >> l) | (x << (32-l)); }
+	.loc 1 5 60 is_stmt 0 view .LVU2499
+	roll	$16, %ecx	#, _935
+.LVL446:
+	.loc 1 5 60 view .LVU2500
+.LBE1776:
+.LBE1775:
+# blake2s-generic.c:57:     FULLROUND(7);
+	.loc 1 57 424 view .LVU2501
+	addl	%ecx, %r15d	# _935, _936
+# blake2s-generic.c:57:     FULLROUND(7);
+	.loc 1 57 386 view .LVU2502
+	movl	%ecx, 52(%rax)	# _935, MEM[(u32 *)v_1(D) + 52B]
+	.loc 1 57 416 is_stmt 1 view .LVU2503
+# blake2s-generic.c:57:     FULLROUND(7);
+	.loc 1 57 446 is_stmt 0 view .LVU2504
+	xorl	%r15d, %ebp	# _936, tmp1847
+# blake2s-generic.c:57:     FULLROUND(7);
+	.loc 1 57 424 view .LVU2505
+	movl	%r15d, 36(%rax)	# _936, MEM[(u32 *)v_1(D) + 36B]
+	.loc 1 57 436 is_stmt 1 view .LVU2506
+.LVL447:
+.LBB1777:
+.LBI1777:
+	.loc 1 5 19 view .LVU2507
+.LBB1778:
+	.loc 1 5 44 view .LVU2508
+# blake2s-generic.c:5: static inline u32 ror(unsigned l, u32 x) { return (x >> l) | (x << (32-l)); }
+	.loc 1 5 60 is_stmt 0 view .LVU2509
+	rorl	$12, %ebp	#, _938
+.LVL448:
+	.loc 1 5 60 view .LVU2510
+.LBE1778:
+.LBE1777:
+# blake2s-generic.c:57:     FULLROUND(7);
+	.loc 1 57 444 view .LVU2511
+	movl	%ebp, 20(%rax)	# _938, MEM[(u32 *)v_1(D) + 20B]
+	.loc 1 57 474 is_stmt 1 view .LVU2512
+# blake2s-generic.c:57:     FULLROUND(7);
+	.loc 1 57 482 is_stmt 0 view .LVU2513
+	addl	56(%r9), %esi	# MEM[(const u32 *)m_4(D) + 56B], tmp1848
+	addl	%ebp, %esi	# _938, _941
+# blake2s-generic.c:57:     FULLROUND(7);
+	.loc 1 57 535 view .LVU2514
+	xorl	%esi, %ecx	# _941, tmp1850
+# blake2s-generic.c:57:     FULLROUND(7);
+	.loc 1 57 482 view .LVU2515
+	movl	%esi, 4(%rax)	# _941, MEM[(u32 *)v_1(D) + 4B]
+	.loc 1 57 525 is_stmt 1 view .LVU2516
+.LVL449:
+.LBB1779:
+.LBI1779:
+	.loc 1 5 19 view .LVU2517
+.LBB1780:
+	.loc 1 5 44 view .LVU2518
+# blake2s-generic.c:5: static inline u32 ror(unsigned l, u32 x) { return (x >> l) | (x << (32-l)); }
+	.loc 1 5 60 is_stmt 0 view .LVU2519
+	rorl	$8, %ecx	#, _943
+.LVL450:
+	.loc 1 5 60 view .LVU2520
+.LBE1780:
+.LBE1779:
+# blake2s-generic.c:57:     FULLROUND(7);
+	.loc 1 57 571 view .LVU2521
+	addl	%ecx, %r15d	# _943, _944
+# blake2s-generic.c:57:     FULLROUND(7);
+	.loc 1 57 533 view .LVU2522
+	movl	%ecx, 52(%rax)	# _943, MEM[(u32 *)v_1(D) + 52B]
+	.loc 1 57 563 is_stmt 1 view .LVU2523
+# blake2s-generic.c:57:     FULLROUND(7);
+	.loc 1 57 593 is_stmt 0 view .LVU2524
+	xorl	%r15d, %ebp	# _944, tmp1851
+# blake2s-generic.c:57:     FULLROUND(7);
+	.loc 1 57 571 view .LVU2525
+	movl	%r15d, 36(%rax)	# _944, MEM[(u32 *)v_1(D) + 36B]
+	.loc 1 57 583 is_stmt 1 view .LVU2526
+.LVL451:
+.LBB1781:
+.LBI1781:
+	.loc 1 5 19 view .LVU2527
+.LBB1782:
+	.loc 1 5 44 view .LVU2528
+# blake2s-generic.c:5: static inline u32 ror(unsigned l, u32 x) { return (x >> l) | (x << (32-l)); }
+	.loc 1 5 60 is_stmt 0 view .LVU2529
+	rorl	$7, %ebp	#, _946
+.LVL452:
+	.loc 1 5 60 view .LVU2530
+.LBE1782:
+.LBE1781:
+# blake2s-generic.c:57:     FULLROUND(7);
+	.loc 1 57 593 view .LVU2531
+	movl	%r15d, -20(%rsp)	# _944, %sfp
+# blake2s-generic.c:57:     FULLROUND(7);
+	.loc 1 57 591 view .LVU2532
+	movl	%ebp, 20(%rax)	# _946, MEM[(u32 *)v_1(D) + 20B]
+	.loc 1 57 325 is_stmt 1 view .LVU2533
+	.loc 1 57 634 view .LVU2534
+	.loc 1 57 639 view .LVU2535
+# blake2s-generic.c:57:     FULLROUND(7);
+	.loc 1 57 647 is_stmt 0 view .LVU2536
+	addl	48(%r9), %edx	# MEM[(const u32 *)m_4(D) + 48B], tmp1852
+	addl	%ebx, %edx	# _882, _949
+	movl	%edx, 8(%rax)	# _949, MEM[(u32 *)v_1(D) + 8B]
+	.loc 1 57 690 is_stmt 1 view .LVU2537
+.LVL453:
+.LBB1783:
+.LBI1783:
+	.loc 1 5 19 view .LVU2538
+.LBB1784:
+	.loc 1 5 44 view .LVU2539
+.LBE1784:
+.LBE1783:
+# blake2s-generic.c:57:     FULLROUND(7);
+	.loc 1 57 700 is_stmt 0 view .LVU2540
+	xorl	%edx, %r13d	# _949, tmp1854
+.LVL454:
+# blake2s-generic.c:57:     FULLROUND(7);
+	.loc 1 57 736 view .LVU2541
+	movl	-12(%rsp), %r15d	# %sfp, _864
+.LBB1786:
+.LBB1785:
+# blake2s-generic.c:5: static inline u32 ror(unsigned l, u32 x) { return (x >> l) | (x << (32-l)); }
+	.loc 1 5 60 view .LVU2542
+	roll	$16, %r13d	#, _951
+.LVL455:
+	.loc 1 5 60 view .LVU2543
+.LBE1785:
+.LBE1786:
+# blake2s-generic.c:57:     FULLROUND(7);
+	.loc 1 57 1012 view .LVU2544
+	movl	-16(%rsp), %r12d	# %sfp, _863
+# blake2s-generic.c:57:     FULLROUND(7);
+	.loc 1 57 736 view .LVU2545
+	leal	(%r15,%r13), %r14d	#, _952
+# blake2s-generic.c:57:     FULLROUND(7);
+	.loc 1 57 698 view .LVU2546
+	movl	%r13d, 56(%rax)	# _951, MEM[(u32 *)v_1(D) + 56B]
+	.loc 1 57 728 is_stmt 1 view .LVU2547
+# blake2s-generic.c:57:     FULLROUND(7);
+	.loc 1 57 1048 is_stmt 0 view .LVU2548
+	movl	-8(%rsp), %r15d	# %sfp, _880
+# blake2s-generic.c:57:     FULLROUND(7);
+	.loc 1 57 758 view .LVU2549
+	xorl	%r14d, %ebx	# _952, tmp1855
+# blake2s-generic.c:57:     FULLROUND(7);
+	.loc 1 57 736 view .LVU2550
+	movl	%r14d, 40(%rax)	# _952, MEM[(u32 *)v_1(D) + 40B]
+	.loc 1 57 748 is_stmt 1 view .LVU2551
+.LVL456:
+.LBB1787:
+.LBI1787:
+	.loc 1 5 19 view .LVU2552
+.LBB1788:
+	.loc 1 5 44 view .LVU2553
+# blake2s-generic.c:5: static inline u32 ror(unsigned l, u32 x) { return (x >> l) | (x << (32-l)); }
+	.loc 1 5 60 is_stmt 0 view .LVU2554
+	rorl	$12, %ebx	#, _954
+.LVL457:
+	.loc 1 5 60 view .LVU2555
+.LBE1788:
+.LBE1787:
+# blake2s-generic.c:57:     FULLROUND(7);
+	.loc 1 57 756 view .LVU2556
+	movl	%ebx, 24(%rax)	# _954, MEM[(u32 *)v_1(D) + 24B]
+	.loc 1 57 786 is_stmt 1 view .LVU2557
+# blake2s-generic.c:57:     FULLROUND(7);
+	.loc 1 57 794 is_stmt 0 view .LVU2558
+	addl	4(%r9), %edx	# MEM[(const u32 *)m_4(D) + 4B], tmp1856
+	addl	%ebx, %edx	# _954, _957
+# blake2s-generic.c:57:     FULLROUND(7);
+	.loc 1 57 847 view .LVU2559
+	xorl	%edx, %r13d	# _957, tmp1858
+# blake2s-generic.c:57:     FULLROUND(7);
+	.loc 1 57 794 view .LVU2560
+	movl	%edx, 8(%rax)	# _957, MEM[(u32 *)v_1(D) + 8B]
+	.loc 1 57 837 is_stmt 1 view .LVU2561
+.LVL458:
+.LBB1789:
+.LBI1789:
+	.loc 1 5 19 view .LVU2562
+.LBB1790:
+	.loc 1 5 44 view .LVU2563
+# blake2s-generic.c:5: static inline u32 ror(unsigned l, u32 x) { return (x >> l) | (x << (32-l)); }
+	.loc 1 5 60 is_stmt 0 view .LVU2564
+	rorl	$8, %r13d	#, _959
+.LVL459:
+	.loc 1 5 60 view .LVU2565
+.LBE1790:
+.LBE1789:
+# blake2s-generic.c:57:     FULLROUND(7);
+	.loc 1 57 883 view .LVU2566
+	addl	%r13d, %r14d	# _959, _960
+# blake2s-generic.c:57:     FULLROUND(7);
+	.loc 1 57 845 view .LVU2567
+	movl	%r13d, 56(%rax)	# _959, MEM[(u32 *)v_1(D) + 56B]
+	.loc 1 57 875 is_stmt 1 view .LVU2568
+# blake2s-generic.c:57:     FULLROUND(7);
+	.loc 1 57 905 is_stmt 0 view .LVU2569
+	xorl	%r14d, %ebx	# _960, tmp1859
+# blake2s-generic.c:57:     FULLROUND(7);
+	.loc 1 57 883 view .LVU2570
+	movl	%r14d, 40(%rax)	# _960, MEM[(u32 *)v_1(D) + 40B]
+	.loc 1 57 895 is_stmt 1 view .LVU2571
+.LVL460:
+.LBB1791:
+.LBI1791:
+	.loc 1 5 19 view .LVU2572
+.LBB1792:
+	.loc 1 5 44 view .LVU2573
+# blake2s-generic.c:5: static inline u32 ror(unsigned l, u32 x) { return (x >> l) | (x << (32-l)); }
+	.loc 1 5 60 is_stmt 0 view .LVU2574
+	rorl	$7, %ebx	#, _962
+.LVL461:
+	.loc 1 5 60 view .LVU2575
+.LBE1792:
+.LBE1791:
+# blake2s-generic.c:57:     FULLROUND(7);
+	.loc 1 57 903 view .LVU2576
+	movl	%ebx, 24(%rax)	# _962, MEM[(u32 *)v_1(D) + 24B]
+	.loc 1 57 637 is_stmt 1 view .LVU2577
+	.loc 1 57 946 view .LVU2578
+	.loc 1 57 951 view .LVU2579
+# blake2s-generic.c:57:     FULLROUND(7);
+	.loc 1 57 959 is_stmt 0 view .LVU2580
+	addl	12(%r9), %r10d	# MEM[(const u32 *)m_4(D) + 12B], tmp1860
+	addl	%r11d, %r10d	# _898, _965
+# blake2s-generic.c:57:     FULLROUND(7);
+	.loc 1 57 1012 view .LVU2581
+	xorl	%r10d, %r12d	# _965, _863
+# blake2s-generic.c:57:     FULLROUND(7);
+	.loc 1 57 959 view .LVU2582
+	movl	%r10d, 12(%rax)	# _965, MEM[(u32 *)v_1(D) + 12B]
+	.loc 1 57 1002 is_stmt 1 view .LVU2583
+.LVL462:
+.LBB1793:
+.LBI1793:
+	.loc 1 5 19 view .LVU2584
+.LBB1794:
+	.loc 1 5 44 view .LVU2585
+# blake2s-generic.c:5: static inline u32 ror(unsigned l, u32 x) { return (x >> l) | (x << (32-l)); }
+	.loc 1 5 60 is_stmt 0 view .LVU2586
+	roll	$16, %r12d	#, _967
+.LVL463:
+	.loc 1 5 60 view .LVU2587
+.LBE1794:
+.LBE1793:
+# blake2s-generic.c:57:     FULLROUND(7);
+	.loc 1 57 1048 view .LVU2588
+	addl	%r12d, %r15d	# _967, _968
+# blake2s-generic.c:57:     FULLROUND(7);
+	.loc 1 57 1010 view .LVU2589
+	movl	%r12d, 60(%rax)	# _967, MEM[(u32 *)v_1(D) + 60B]
+	.loc 1 57 1040 is_stmt 1 view .LVU2590
+# blake2s-generic.c:57:     FULLROUND(7);
+	.loc 1 57 1070 is_stmt 0 view .LVU2591
+	xorl	%r15d, %r11d	# _968, tmp1863
+# blake2s-generic.c:57:     FULLROUND(7);
+	.loc 1 57 1048 view .LVU2592
+	movl	%r15d, 44(%rax)	# _968, MEM[(u32 *)v_1(D) + 44B]
+	.loc 1 57 1060 is_stmt 1 view .LVU2593
+.LVL464:
+.LBB1795:
+.LBI1795:
+	.loc 1 5 19 view .LVU2594
+.LBB1796:
+	.loc 1 5 44 view .LVU2595
+# blake2s-generic.c:5: static inline u32 ror(unsigned l, u32 x) { return (x >> l) | (x << (32-l)); }
+	.loc 1 5 60 is_stmt 0 view .LVU2596
+	rorl	$12, %r11d	#, _970
+.LVL465:
+	.loc 1 5 60 view .LVU2597
+.LBE1796:
+.LBE1795:
+# blake2s-generic.c:57:     FULLROUND(7);
+	.loc 1 57 1068 view .LVU2598
+	movl	%r11d, 28(%rax)	# _970, MEM[(u32 *)v_1(D) + 28B]
+	.loc 1 57 1098 is_stmt 1 view .LVU2599
+# blake2s-generic.c:57:     FULLROUND(7);
+	.loc 1 57 1106 is_stmt 0 view .LVU2600
+	addl	36(%r9), %r10d	# MEM[(const u32 *)m_4(D) + 36B], tmp1864
+	addl	%r11d, %r10d	# _970, _973
+# blake2s-generic.c:57:     FULLROUND(7);
+	.loc 1 57 1159 view .LVU2601
+	xorl	%r10d, %r12d	# _973, tmp1866
+# blake2s-generic.c:57:     FULLROUND(7);
+	.loc 1 57 1106 view .LVU2602
+	movl	%r10d, 12(%rax)	# _973, MEM[(u32 *)v_1(D) + 12B]
+	.loc 1 57 1149 is_stmt 1 view .LVU2603
+.LVL466:
+.LBB1797:
+.LBI1797:
+	.loc 1 5 19 view .LVU2604
+.LBB1798:
+	.loc 1 5 44 view .LVU2605
+# blake2s-generic.c:5: static inline u32 ror(unsigned l, u32 x) { return (x >> l) | (x << (32-l)); }
+	.loc 1 5 60 is_stmt 0 view .LVU2606
+	rorl	$8, %r12d	#, _975
+.LVL467:
+	.loc 1 5 60 view .LVU2607
+.LBE1798:
+.LBE1797:
+# blake2s-generic.c:57:     FULLROUND(7);
+	.loc 1 57 1195 view .LVU2608
+	addl	%r12d, %r15d	# _975, _976
+# blake2s-generic.c:57:     FULLROUND(7);
+	.loc 1 57 1157 view .LVU2609
+	movl	%r12d, 60(%rax)	# _975, MEM[(u32 *)v_1(D) + 60B]
+	.loc 1 57 1187 is_stmt 1 view .LVU2610
+# blake2s-generic.c:57:     FULLROUND(7);
+	.loc 1 57 1217 is_stmt 0 view .LVU2611
+	xorl	%r15d, %r11d	# _976, tmp1867
+# blake2s-generic.c:57:     FULLROUND(7);
+	.loc 1 57 1195 view .LVU2612
+	movl	%r15d, 44(%rax)	# _976, MEM[(u32 *)v_1(D) + 44B]
+	.loc 1 57 1207 is_stmt 1 view .LVU2613
+.LVL468:
+.LBB1799:
+.LBI1799:
+	.loc 1 5 19 view .LVU2614
+.LBB1800:
+	.loc 1 5 44 view .LVU2615
+# blake2s-generic.c:5: static inline u32 ror(unsigned l, u32 x) { return (x >> l) | (x << (32-l)); }
+	.loc 1 5 60 is_stmt 0 view .LVU2616
+	rorl	$7, %r11d	#, _978
+.LVL469:
+	.loc 1 5 60 view .LVU2617
+.LBE1800:
+.LBE1799:
+# blake2s-generic.c:57:     FULLROUND(7);
+	.loc 1 57 1215 view .LVU2618
+	movl	%r11d, 28(%rax)	# _978, MEM[(u32 *)v_1(D) + 28B]
+	.loc 1 57 949 is_stmt 1 view .LVU2619
+	.loc 1 57 1258 view .LVU2620
+	.loc 1 57 1263 view .LVU2621
+# blake2s-generic.c:57:     FULLROUND(7);
+	.loc 1 57 1271 is_stmt 0 view .LVU2622
+	addl	20(%r9), %r8d	# MEM[(const u32 *)m_4(D) + 20B], tmp1868
+	addl	%ebp, %r8d	# _946, _981
+# blake2s-generic.c:57:     FULLROUND(7);
+	.loc 1 57 1324 view .LVU2623
+	xorl	%r8d, %r12d	# _981, tmp1870
+# blake2s-generic.c:57:     FULLROUND(7);
+	.loc 1 57 1271 view .LVU2624
+	movl	%r8d, (%rax)	# _981, *v_1(D)
+	.loc 1 57 1314 is_stmt 1 view .LVU2625
+.LVL470:
+.LBB1801:
+.LBI1801:
+	.loc 1 5 19 view .LVU2626
+.LBB1802:
+	.loc 1 5 44 view .LVU2627
+# blake2s-generic.c:5: static inline u32 ror(unsigned l, u32 x) { return (x >> l) | (x << (32-l)); }
+	.loc 1 5 60 is_stmt 0 view .LVU2628
+	roll	$16, %r12d	#, _983
+.LVL471:
+	.loc 1 5 60 view .LVU2629
+.LBE1802:
+.LBE1801:
+# blake2s-generic.c:57:     FULLROUND(7);
+	.loc 1 57 1360 view .LVU2630
+	addl	%r12d, %r14d	# _983, _984
+# blake2s-generic.c:57:     FULLROUND(7);
+	.loc 1 57 1322 view .LVU2631
+	movl	%r12d, 60(%rax)	# _983, MEM[(u32 *)v_1(D) + 60B]
+	.loc 1 57 1352 is_stmt 1 view .LVU2632
+# blake2s-generic.c:57:     FULLROUND(7);
+	.loc 1 57 1382 is_stmt 0 view .LVU2633
+	xorl	%r14d, %ebp	# _984, tmp1871
+# blake2s-generic.c:57:     FULLROUND(7);
+	.loc 1 57 1360 view .LVU2634
+	movl	%r14d, 40(%rax)	# _984, MEM[(u32 *)v_1(D) + 40B]
+	.loc 1 57 1372 is_stmt 1 view .LVU2635
+.LVL472:
+.LBB1803:
+.LBI1803:
+	.loc 1 5 19 view .LVU2636
+.LBB1804:
+	.loc 1 5 44 view .LVU2637
+# blake2s-generic.c:5: static inline u32 ror(unsigned l, u32 x) { return (x >> l) | (x << (32-l)); }
+	.loc 1 5 60 is_stmt 0 view .LVU2638
+	rorl	$12, %ebp	#, _986
+.LVL473:
+	.loc 1 5 60 view .LVU2639
+.LBE1804:
+.LBE1803:
+# blake2s-generic.c:57:     FULLROUND(7);
+	.loc 1 57 1380 view .LVU2640
+	movl	%ebp, 20(%rax)	# _986, MEM[(u32 *)v_1(D) + 20B]
+	.loc 1 57 1410 is_stmt 1 view .LVU2641
+# blake2s-generic.c:57:     FULLROUND(7);
+	.loc 1 57 1418 is_stmt 0 view .LVU2642
+	addl	(%r9), %r8d	# *m_4(D), tmp1872
+	addl	%ebp, %r8d	# _986, _989
+# blake2s-generic.c:57:     FULLROUND(7);
+	.loc 1 57 1471 view .LVU2643
+	xorl	%r8d, %r12d	# _989, tmp1874
+# blake2s-generic.c:57:     FULLROUND(7);
+	.loc 1 57 1418 view .LVU2644
+	movl	%r8d, (%rax)	# _989, *v_1(D)
+	.loc 1 57 1461 is_stmt 1 view .LVU2645
+.LVL474:
+.LBB1805:
+.LBI1805:
+	.loc 1 5 19 view .LVU2646
+.LBB1806:
+	.loc 1 5 44 view .LVU2647
+# blake2s-generic.c:5: static inline u32 ror(unsigned l, u32 x) { return (x >> l) | (x << (32-l)); }
+	.loc 1 5 60 is_stmt 0 view .LVU2648
+	rorl	$8, %r12d	#, tmp1874
+.LBE1806:
+.LBE1805:
+# blake2s-generic.c:57:     FULLROUND(7);
+	.loc 1 57 1507 view .LVU2649
+	addl	%r12d, %r14d	# _991, _992
+	movl	%r12d, -16(%rsp)	# _991, %sfp
+# blake2s-generic.c:57:     FULLROUND(7);
+	.loc 1 57 1529 view .LVU2650
+	xorl	%r14d, %ebp	# _992, tmp1875
+	movl	%r14d, -12(%rsp)	# _992, %sfp
+.LBB1807:
+.LBB1808:
+# blake2s-generic.c:5: static inline u32 ror(unsigned l, u32 x) { return (x >> l) | (x << (32-l)); }
+	.loc 1 5 60 view .LVU2651
+	rorl	$7, %ebp	#, _994
+.LBE1808:
+.LBE1807:
+# blake2s-generic.c:57:     FULLROUND(7);
+	.loc 1 57 1469 view .LVU2652
+	movl	%r12d, 60(%rax)	# _991, MEM[(u32 *)v_1(D) + 60B]
+	.loc 1 57 1499 is_stmt 1 view .LVU2653
+# blake2s-generic.c:57:     FULLROUND(7);
+	.loc 1 57 1507 is_stmt 0 view .LVU2654
+	movl	%r14d, 40(%rax)	# _992, MEM[(u32 *)v_1(D) + 40B]
+	.loc 1 57 1519 is_stmt 1 view .LVU2655
+.LVL475:
+.LBB1810:
+.LBI1807:
+	.loc 1 5 19 view .LVU2656
+.LBB1809:
+	.loc 1 5 44 view .LVU2657
+	.loc 1 5 44 is_stmt 0 view .LVU2658
+.LBE1809:
+.LBE1810:
+# blake2s-generic.c:57:     FULLROUND(7);
+	.loc 1 57 1527 view .LVU2659
+	movl	%ebp, 20(%rax)	# _994, MEM[(u32 *)v_1(D) + 20B]
+	.loc 1 57 1261 is_stmt 1 view .LVU2660
+	.loc 1 57 1570 view .LVU2661
+	.loc 1 57 1575 view .LVU2662
+# blake2s-generic.c:57:     FULLROUND(7);
+	.loc 1 57 1583 is_stmt 0 view .LVU2663
+	addl	60(%r9), %esi	# MEM[(const u32 *)m_4(D) + 60B], tmp1876
+	addl	%ebx, %esi	# _962, _997
+# blake2s-generic.c:57:     FULLROUND(7);
+	.loc 1 57 2211 view .LVU2664
+	movl	-24(%rsp), %r14d	# %sfp, _930
+# blake2s-generic.c:57:     FULLROUND(7);
+	.loc 1 57 1637 view .LVU2665
+	xorl	%esi, %edi	# _997, tmp1878
+# blake2s-generic.c:57:     FULLROUND(7);
+	.loc 1 57 1583 view .LVU2666
+	movl	%esi, 4(%rax)	# _997, MEM[(u32 *)v_1(D) + 4B]
+	.loc 1 57 1627 is_stmt 1 view .LVU2667
+.LVL476:
+.LBB1811:
+.LBI1811:
+	.loc 1 5 19 view .LVU2668
+.LBB1812:
+	.loc 1 5 44 view .LVU2669
+# blake2s-generic.c:5: static inline u32 ror(unsigned l, u32 x) { return (x >> l) | (x << (32-l)); }
+	.loc 1 5 60 is_stmt 0 view .LVU2670
+	roll	$16, %edi	#, _999
+.LVL477:
+	.loc 1 5 60 view .LVU2671
+.LBE1812:
+.LBE1811:
+# blake2s-generic.c:57:     FULLROUND(7);
+	.loc 1 57 1673 view .LVU2672
+	addl	%edi, %r15d	# _999, _1000
+# blake2s-generic.c:57:     FULLROUND(7);
+	.loc 1 57 1635 view .LVU2673
+	movl	%edi, 48(%rax)	# _999, MEM[(u32 *)v_1(D) + 48B]
+	.loc 1 57 1665 is_stmt 1 view .LVU2674
+# blake2s-generic.c:57:     FULLROUND(7);
+	.loc 1 57 1695 is_stmt 0 view .LVU2675
+	xorl	%r15d, %ebx	# _1000, tmp1879
+# blake2s-generic.c:57:     FULLROUND(7);
+	.loc 1 57 1673 view .LVU2676
+	movl	%r15d, 44(%rax)	# _1000, MEM[(u32 *)v_1(D) + 44B]
+	.loc 1 57 1685 is_stmt 1 view .LVU2677
+.LVL478:
+.LBB1813:
+.LBI1813:
+	.loc 1 5 19 view .LVU2678
+.LBB1814:
+	.loc 1 5 44 view .LVU2679
+# blake2s-generic.c:5: static inline u32 ror(unsigned l, u32 x) { return (x >> l) | (x << (32-l)); }
+	.loc 1 5 60 is_stmt 0 view .LVU2680
+	rorl	$12, %ebx	#, _1002
+.LVL479:
+	.loc 1 5 60 view .LVU2681
+.LBE1814:
+.LBE1813:
+# blake2s-generic.c:57:     FULLROUND(7);
+	.loc 1 57 1693 view .LVU2682
+	movl	%ebx, 24(%rax)	# _1002, MEM[(u32 *)v_1(D) + 24B]
+	.loc 1 57 1723 is_stmt 1 view .LVU2683
+# blake2s-generic.c:57:     FULLROUND(7);
+	.loc 1 57 1731 is_stmt 0 view .LVU2684
+	addl	16(%r9), %esi	# MEM[(const u32 *)m_4(D) + 16B], tmp1880
+	addl	%ebx, %esi	# _1002, _1005
+# blake2s-generic.c:57:     FULLROUND(7);
+	.loc 1 57 1785 view .LVU2685
+	xorl	%esi, %edi	# _1005, tmp1882
+# blake2s-generic.c:57:     FULLROUND(7);
+	.loc 1 57 1731 view .LVU2686
+	movl	%esi, 4(%rax)	# _1005, MEM[(u32 *)v_1(D) + 4B]
+	.loc 1 57 1775 is_stmt 1 view .LVU2687
+.LVL480:
+.LBB1815:
+.LBI1815:
+	.loc 1 5 19 view .LVU2688
+.LBB1816:
+	.loc 1 5 44 view .LVU2689
+# blake2s-generic.c:5: static inline u32 ror(unsigned l, u32 x) { return (x >> l) | (x << (32-l)); }
+	.loc 1 5 60 is_stmt 0 view .LVU2690
+	rorl	$8, %edi	#, _1007
+.LVL481:
+	.loc 1 5 60 view .LVU2691
+.LBE1816:
+.LBE1815:
+# blake2s-generic.c:57:     FULLROUND(7);
+	.loc 1 57 1821 view .LVU2692
+	addl	%edi, %r15d	# _1007, _1008
+# blake2s-generic.c:57:     FULLROUND(7);
+	.loc 1 57 1783 view .LVU2693
+	movl	%edi, 48(%rax)	# _1007, MEM[(u32 *)v_1(D) + 48B]
+	.loc 1 57 1813 is_stmt 1 view .LVU2694
+# blake2s-generic.c:57:     FULLROUND(7);
+	.loc 1 57 1843 is_stmt 0 view .LVU2695
+	xorl	%r15d, %ebx	# _1008, tmp1883
+# blake2s-generic.c:57:     FULLROUND(7);
+	.loc 1 57 1821 view .LVU2696
+	movl	%r15d, 44(%rax)	# _1008, MEM[(u32 *)v_1(D) + 44B]
+	.loc 1 57 1833 is_stmt 1 view .LVU2697
+.LVL482:
+.LBB1817:
+.LBI1817:
+	.loc 1 5 19 view .LVU2698
+.LBB1818:
+	.loc 1 5 44 view .LVU2699
+# blake2s-generic.c:5: static inline u32 ror(unsigned l, u32 x) { return (x >> l) | (x << (32-l)); }
+	.loc 1 5 60 is_stmt 0 view .LVU2700
+	rorl	$7, %ebx	#, _1010
+.LVL483:
+	.loc 1 5 60 view .LVU2701
+.LBE1818:
+.LBE1817:
+# blake2s-generic.c:57:     FULLROUND(7);
+	.loc 1 57 1843 view .LVU2702
+	movl	%r15d, -8(%rsp)	# _1008, %sfp
+# blake2s-generic.c:57:     FULLROUND(7);
+	.loc 1 57 1987 view .LVU2703
+	movl	-28(%rsp), %r15d	# %sfp, _928
+# blake2s-generic.c:57:     FULLROUND(7);
+	.loc 1 57 1841 view .LVU2704
+	movl	%ebx, 24(%rax)	# _1010, MEM[(u32 *)v_1(D) + 24B]
+	.loc 1 57 1573 is_stmt 1 view .LVU2705
+	.loc 1 57 1884 view .LVU2706
+	.loc 1 57 1889 view .LVU2707
+# blake2s-generic.c:57:     FULLROUND(7);
+	.loc 1 57 1897 is_stmt 0 view .LVU2708
+	addl	32(%r9), %edx	# MEM[(const u32 *)m_4(D) + 32B], tmp1884
+	addl	%r11d, %edx	# _978, _1013
+# blake2s-generic.c:57:     FULLROUND(7);
+	.loc 1 57 1951 view .LVU2709
+	xorl	%edx, %ecx	# _1013, tmp1886
+# blake2s-generic.c:57:     FULLROUND(7);
+	.loc 1 57 1897 view .LVU2710
+	movl	%edx, 8(%rax)	# _1013, MEM[(u32 *)v_1(D) + 8B]
+	.loc 1 57 1941 is_stmt 1 view .LVU2711
+.LVL484:
+.LBB1819:
+.LBI1819:
+	.loc 1 5 19 view .LVU2712
+.LBB1820:
+	.loc 1 5 44 view .LVU2713
+# blake2s-generic.c:5: static inline u32 ror(unsigned l, u32 x) { return (x >> l) | (x << (32-l)); }
+	.loc 1 5 60 is_stmt 0 view .LVU2714
+	roll	$16, %ecx	#, _1015
+.LVL485:
+	.loc 1 5 60 view .LVU2715
+.LBE1820:
+.LBE1819:
+# blake2s-generic.c:57:     FULLROUND(7);
+	.loc 1 57 1987 view .LVU2716
+	leal	(%r15,%rcx), %r12d	#, _1016
+# blake2s-generic.c:57:     FULLROUND(7);
+	.loc 1 57 1949 view .LVU2717
+	movl	%ecx, 52(%rax)	# _1015, MEM[(u32 *)v_1(D) + 52B]
+	.loc 1 57 1979 is_stmt 1 view .LVU2718
+# blake2s-generic.c:57:     FULLROUND(7);
+	.loc 1 57 2301 is_stmt 0 view .LVU2719
+	movl	-20(%rsp), %r15d	# %sfp, _944
+# blake2s-generic.c:57:     FULLROUND(7);
+	.loc 1 57 2009 view .LVU2720
+	xorl	%r12d, %r11d	# _1016, tmp1887
+# blake2s-generic.c:57:     FULLROUND(7);
+	.loc 1 57 1987 view .LVU2721
+	movl	%r12d, 32(%rax)	# _1016, MEM[(u32 *)v_1(D) + 32B]
+	.loc 1 57 1999 is_stmt 1 view .LVU2722
+.LVL486:
+.LBB1821:
+.LBI1821:
+	.loc 1 5 19 view .LVU2723
+.LBB1822:
+	.loc 1 5 44 view .LVU2724
+# blake2s-generic.c:5: static inline u32 ror(unsigned l, u32 x) { return (x >> l) | (x << (32-l)); }
+	.loc 1 5 60 is_stmt 0 view .LVU2725
+	rorl	$12, %r11d	#, _1018
+.LVL487:
+	.loc 1 5 60 view .LVU2726
+.LBE1822:
+.LBE1821:
+# blake2s-generic.c:57:     FULLROUND(7);
+	.loc 1 57 2007 view .LVU2727
+	movl	%r11d, 28(%rax)	# _1018, MEM[(u32 *)v_1(D) + 28B]
+	.loc 1 57 2037 is_stmt 1 view .LVU2728
+# blake2s-generic.c:57:     FULLROUND(7);
+	.loc 1 57 2045 is_stmt 0 view .LVU2729
+	addl	24(%r9), %edx	# MEM[(const u32 *)m_4(D) + 24B], tmp1888
+	addl	%r11d, %edx	# _1018, _1021
+# blake2s-generic.c:57:     FULLROUND(7);
+	.loc 1 57 2099 view .LVU2730
+	xorl	%edx, %ecx	# _1021, tmp1890
+# blake2s-generic.c:57:     FULLROUND(7);
+	.loc 1 57 2045 view .LVU2731
+	movl	%edx, 8(%rax)	# _1021, MEM[(u32 *)v_1(D) + 8B]
+	.loc 1 57 2089 is_stmt 1 view .LVU2732
+.LVL488:
+.LBB1823:
+.LBI1823:
+	.loc 1 5 19 view .LVU2733
+.LBB1824:
+	.loc 1 5 44 view .LVU2734
+# blake2s-generic.c:5: static inline u32 ror(unsigned l, u32 x) { return (x >> l) | (x << (32-l)); }
+	.loc 1 5 60 is_stmt 0 view .LVU2735
+	rorl	$8, %ecx	#, _1023
+.LVL489:
+	.loc 1 5 60 view .LVU2736
+.LBE1824:
+.LBE1823:
+# blake2s-generic.c:57:     FULLROUND(7);
+	.loc 1 57 2135 view .LVU2737
+	addl	%ecx, %r12d	# _1023, _1024
+# blake2s-generic.c:57:     FULLROUND(7);
+	.loc 1 57 2097 view .LVU2738
+	movl	%ecx, 52(%rax)	# _1023, MEM[(u32 *)v_1(D) + 52B]
+	.loc 1 57 2127 is_stmt 1 view .LVU2739
+# blake2s-generic.c:57:     FULLROUND(7);
+	.loc 1 57 2157 is_stmt 0 view .LVU2740
+	xorl	%r12d, %r11d	# _1024, tmp1891
+# blake2s-generic.c:57:     FULLROUND(7);
+	.loc 1 57 2135 view .LVU2741
+	movl	%r12d, 32(%rax)	# _1024, MEM[(u32 *)v_1(D) + 32B]
+	.loc 1 57 2147 is_stmt 1 view .LVU2742
+.LVL490:
+.LBB1825:
+.LBI1825:
+	.loc 1 5 19 view .LVU2743
+.LBB1826:
+	.loc 1 5 44 view .LVU2744
+# blake2s-generic.c:5: static inline u32 ror(unsigned l, u32 x) { return (x >> l) | (x << (32-l)); }
+	.loc 1 5 60 is_stmt 0 view .LVU2745
+	rorl	$7, %r11d	#, _1026
+.LVL491:
+	.loc 1 5 60 view .LVU2746
+.LBE1826:
+.LBE1825:
+# blake2s-generic.c:57:     FULLROUND(7);
+	.loc 1 57 2155 view .LVU2747
+	movl	%r11d, 28(%rax)	# _1026, MEM[(u32 *)v_1(D) + 28B]
+	.loc 1 57 1887 is_stmt 1 view .LVU2748
+	.loc 1 57 2198 view .LVU2749
+	.loc 1 57 2203 view .LVU2750
+# blake2s-generic.c:57:     FULLROUND(7);
+	.loc 1 57 2211 is_stmt 0 view .LVU2751
+	addl	8(%r9), %r10d	# MEM[(const u32 *)m_4(D) + 8B], tmp1892
+	addl	%r14d, %r10d	# _930, _1029
+# blake2s-generic.c:57:     FULLROUND(7);
+	.loc 1 57 2265 view .LVU2752
+	xorl	%r10d, %r13d	# _1029, tmp1894
+# blake2s-generic.c:57:     FULLROUND(7);
+	.loc 1 57 2211 view .LVU2753
+	movl	%r10d, 12(%rax)	# _1029, MEM[(u32 *)v_1(D) + 12B]
+	.loc 1 57 2255 is_stmt 1 view .LVU2754
+.LVL492:
+.LBB1827:
+.LBI1827:
+	.loc 1 5 19 view .LVU2755
+.LBB1828:
+	.loc 1 5 44 view .LVU2756
+# blake2s-generic.c:5: static inline u32 ror(unsigned l, u32 x) { return (x >> l) | (x << (32-l)); }
+	.loc 1 5 60 is_stmt 0 view .LVU2757
+	roll	$16, %r13d	#, _1031
+.LVL493:
+	.loc 1 5 60 view .LVU2758
+.LBE1828:
+.LBE1827:
+# blake2s-generic.c:57:     FULLROUND(7);
+	.loc 1 57 2301 view .LVU2759
+	addl	%r13d, %r15d	# _1031, _1032
+# blake2s-generic.c:57:     FULLROUND(7);
+	.loc 1 57 2263 view .LVU2760
+	movl	%r13d, 56(%rax)	# _1031, MEM[(u32 *)v_1(D) + 56B]
+	.loc 1 57 2293 is_stmt 1 view .LVU2761
+# blake2s-generic.c:57:     FULLROUND(7);
+	.loc 1 57 2323 is_stmt 0 view .LVU2762
+	xorl	%r15d, %r14d	# _1032, _930
+# blake2s-generic.c:57:     FULLROUND(7);
+	.loc 1 57 2301 view .LVU2763
+	movl	%r15d, 36(%rax)	# _1032, MEM[(u32 *)v_1(D) + 36B]
+	.loc 1 57 2313 is_stmt 1 view .LVU2764
+.LVL494:
+.LBB1829:
+.LBI1829:
+	.loc 1 5 19 view .LVU2765
+.LBB1830:
+	.loc 1 5 44 view .LVU2766
+# blake2s-generic.c:5: static inline u32 ror(unsigned l, u32 x) { return (x >> l) | (x << (32-l)); }
+	.loc 1 5 60 is_stmt 0 view .LVU2767
+	rorl	$12, %r14d	#, _1034
+.LVL495:
+	.loc 1 5 60 view .LVU2768
+.LBE1830:
+.LBE1829:
+# blake2s-generic.c:57:     FULLROUND(7);
+	.loc 1 57 2321 view .LVU2769
+	movl	%r14d, 16(%rax)	# _1034, MEM[(u32 *)v_1(D) + 16B]
+	.loc 1 57 2351 is_stmt 1 view .LVU2770
+# blake2s-generic.c:57:     FULLROUND(7);
+	.loc 1 57 2359 is_stmt 0 view .LVU2771
+	addl	40(%r9), %r10d	# MEM[(const u32 *)m_4(D) + 40B], tmp1896
+	addl	%r14d, %r10d	# _1034, _1037
+# blake2s-generic.c:57:     FULLROUND(7);
+	.loc 1 57 2413 view .LVU2772
+	xorl	%r10d, %r13d	# _1037, tmp1898
+# blake2s-generic.c:57:     FULLROUND(7);
+	.loc 1 57 2359 view .LVU2773
+	movl	%r10d, 12(%rax)	# _1037, MEM[(u32 *)v_1(D) + 12B]
+	.loc 1 57 2403 is_stmt 1 view .LVU2774
+.LVL496:
+.LBB1831:
+.LBI1831:
+	.loc 1 5 19 view .LVU2775
+.LBB1832:
+	.loc 1 5 44 view .LVU2776
+# blake2s-generic.c:5: static inline u32 ror(unsigned l, u32 x) { return (x >> l) | (x << (32-l)); }
+	.loc 1 5 60 is_stmt 0 view .LVU2777
+	rorl	$8, %r13d	#, _1039
+.LVL497:
+	.loc 1 5 60 view .LVU2778
+.LBE1832:
+.LBE1831:
+# blake2s-generic.c:57:     FULLROUND(7);
+	.loc 1 57 2449 view .LVU2779
+	addl	%r13d, %r15d	# _1039, _1040
+# blake2s-generic.c:57:     FULLROUND(7);
+	.loc 1 57 2411 view .LVU2780
+	movl	%r13d, 56(%rax)	# _1039, MEM[(u32 *)v_1(D) + 56B]
+	.loc 1 57 2441 is_stmt 1 view .LVU2781
+# blake2s-generic.c:57:     FULLROUND(7);
+	.loc 1 57 2471 is_stmt 0 view .LVU2782
+	xorl	%r15d, %r14d	# _1040, tmp1899
+# blake2s-generic.c:57:     FULLROUND(7);
+	.loc 1 57 2449 view .LVU2783
+	movl	%r15d, 36(%rax)	# _1040, MEM[(u32 *)v_1(D) + 36B]
+	.loc 1 57 2461 is_stmt 1 view .LVU2784
+.LVL498:
+.LBB1833:
+.LBI1833:
+	.loc 1 5 19 view .LVU2785
+.LBB1834:
+	.loc 1 5 44 view .LVU2786
+# blake2s-generic.c:5: static inline u32 ror(unsigned l, u32 x) { return (x >> l) | (x << (32-l)); }
+	.loc 1 5 60 is_stmt 0 view .LVU2787
+	rorl	$7, %r14d	#, _1042
+.LVL499:
+	.loc 1 5 60 view .LVU2788
+.LBE1834:
+.LBE1833:
+# blake2s-generic.c:57:     FULLROUND(7);
+	.loc 1 57 2469 view .LVU2789
+	movl	%r14d, 16(%rax)	# _1042, MEM[(u32 *)v_1(D) + 16B]
+	.loc 1 57 2201 is_stmt 1 view .LVU2790
+	.loc 1 57 8 view .LVU2791
+	.loc 1 58 5 view .LVU2792
+	.loc 1 58 10 view .LVU2793
+	.loc 1 58 15 view .LVU2794
+# blake2s-generic.c:58:     FULLROUND(8);
+	.loc 1 58 23 is_stmt 0 view .LVU2795
+	addl	24(%r9), %r8d	# MEM[(const u32 *)m_4(D) + 24B], tmp1900
+	addl	%r14d, %r8d	# _1042, _1045
+# blake2s-generic.c:58:     FULLROUND(8);
+	.loc 1 58 76 view .LVU2796
+	xorl	%r8d, %edi	# _1045, tmp1902
+# blake2s-generic.c:58:     FULLROUND(8);
+	.loc 1 58 23 view .LVU2797
+	movl	%r8d, (%rax)	# _1045, *v_1(D)
+	.loc 1 58 66 is_stmt 1 view .LVU2798
+.LVL500:
+.LBB1835:
+.LBI1835:
+	.loc 1 5 19 view .LVU2799
+.LBB1836:
+	.loc 1 5 44 view .LVU2800
+# blake2s-generic.c:5: static inline u32 ror(unsigned l, u32 x) { return (x >> l) | (x << (32-l)); }
+	.loc 1 5 60 is_stmt 0 view .LVU2801
+	roll	$16, %edi	#, _1047
+.LVL501:
+	.loc 1 5 60 view .LVU2802
+.LBE1836:
+.LBE1835:
+# blake2s-generic.c:58:     FULLROUND(8);
+	.loc 1 58 112 view .LVU2803
+	addl	%edi, %r12d	# _1047, _1048
+# blake2s-generic.c:58:     FULLROUND(8);
+	.loc 1 58 74 view .LVU2804
+	movl	%edi, 48(%rax)	# _1047, MEM[(u32 *)v_1(D) + 48B]
+	.loc 1 58 104 is_stmt 1 view .LVU2805
+# blake2s-generic.c:58:     FULLROUND(8);
+	.loc 1 58 134 is_stmt 0 view .LVU2806
+	xorl	%r12d, %r14d	# _1048, tmp1903
+# blake2s-generic.c:58:     FULLROUND(8);
+	.loc 1 58 112 view .LVU2807
+	movl	%r12d, 32(%rax)	# _1048, MEM[(u32 *)v_1(D) + 32B]
+	.loc 1 58 124 is_stmt 1 view .LVU2808
+.LVL502:
+.LBB1837:
+.LBI1837:
+	.loc 1 5 19 view .LVU2809
+.LBB1838:
+	.loc 1 5 44 view .LVU2810
+# blake2s-generic.c:5: static inline u32 ror(unsigned l, u32 x) { return (x >> l) | (x << (32-l)); }
+	.loc 1 5 60 is_stmt 0 view .LVU2811
+	rorl	$12, %r14d	#, _1050
+.LVL503:
+	.loc 1 5 60 view .LVU2812
+.LBE1838:
+.LBE1837:
+# blake2s-generic.c:58:     FULLROUND(8);
+	.loc 1 58 132 view .LVU2813
+	movl	%r14d, 16(%rax)	# _1050, MEM[(u32 *)v_1(D) + 16B]
+	.loc 1 58 162 is_stmt 1 view .LVU2814
+# blake2s-generic.c:58:     FULLROUND(8);
+	.loc 1 58 170 is_stmt 0 view .LVU2815
+	addl	60(%r9), %r8d	# MEM[(const u32 *)m_4(D) + 60B], tmp1904
+	addl	%r14d, %r8d	# _1050, _1053
+# blake2s-generic.c:58:     FULLROUND(8);
+	.loc 1 58 223 view .LVU2816
+	xorl	%r8d, %edi	# _1053, tmp1906
+# blake2s-generic.c:58:     FULLROUND(8);
+	.loc 1 58 170 view .LVU2817
+	movl	%r8d, (%rax)	# _1053, *v_1(D)
+	.loc 1 58 213 is_stmt 1 view .LVU2818
+.LVL504:
+.LBB1839:
+.LBI1839:
+	.loc 1 5 19 view .LVU2819
+.LBB1840:
+	.loc 1 5 44 view .LVU2820
+# blake2s-generic.c:5: static inline u32 ror(unsigned l, u32 x) { return (x >> l) | (x << (32-l)); }
+	.loc 1 5 60 is_stmt 0 view .LVU2821
+	rorl	$8, %edi	#, _1055
+.LVL505:
+	.loc 1 5 60 view .LVU2822
+.LBE1840:
+.LBE1839:
+# blake2s-generic.c:58:     FULLROUND(8);
+	.loc 1 58 259 view .LVU2823
+	addl	%edi, %r12d	# _1055, _1056
+# blake2s-generic.c:58:     FULLROUND(8);
+	.loc 1 58 221 view .LVU2824
+	movl	%edi, 48(%rax)	# _1055, MEM[(u32 *)v_1(D) + 48B]
+	.loc 1 58 251 is_stmt 1 view .LVU2825
+# blake2s-generic.c:58:     FULLROUND(8);
+	.loc 1 58 281 is_stmt 0 view .LVU2826
+	xorl	%r12d, %r14d	# _1056, tmp1907
+# blake2s-generic.c:58:     FULLROUND(8);
+	.loc 1 58 259 view .LVU2827
+	movl	%r12d, 32(%rax)	# _1056, MEM[(u32 *)v_1(D) + 32B]
+	.loc 1 58 271 is_stmt 1 view .LVU2828
+.LVL506:
+.LBB1841:
+.LBI1841:
+	.loc 1 5 19 view .LVU2829
+.LBB1842:
+	.loc 1 5 44 view .LVU2830
+# blake2s-generic.c:5: static inline u32 ror(unsigned l, u32 x) { return (x >> l) | (x << (32-l)); }
+	.loc 1 5 60 is_stmt 0 view .LVU2831
+	rorl	$7, %r14d	#, tmp1907
+.LBE1842:
+.LBE1841:
+# blake2s-generic.c:58:     FULLROUND(8);
+	.loc 1 58 281 view .LVU2832
+	movl	%r12d, -28(%rsp)	# _1056, %sfp
+# blake2s-generic.c:58:     FULLROUND(8);
+	.loc 1 58 279 view .LVU2833
+	movl	%r14d, 16(%rax)	# _1058, MEM[(u32 *)v_1(D) + 16B]
+	.loc 1 58 13 is_stmt 1 view .LVU2834
+	.loc 1 58 322 view .LVU2835
+	.loc 1 58 327 view .LVU2836
+# blake2s-generic.c:58:     FULLROUND(8);
+	.loc 1 58 335 is_stmt 0 view .LVU2837
+	addl	56(%r9), %esi	# MEM[(const u32 *)m_4(D) + 56B], tmp1908
+	addl	%ebp, %esi	# _994, _1061
+# blake2s-generic.c:58:     FULLROUND(8);
+	.loc 1 58 279 view .LVU2838
+	movl	%r14d, -24(%rsp)	# _1058, %sfp
+# blake2s-generic.c:58:     FULLROUND(8);
+	.loc 1 58 388 view .LVU2839
+	xorl	%esi, %ecx	# _1061, tmp1910
+# blake2s-generic.c:58:     FULLROUND(8);
+	.loc 1 58 335 view .LVU2840
+	movl	%esi, 4(%rax)	# _1061, MEM[(u32 *)v_1(D) + 4B]
+	.loc 1 58 378 is_stmt 1 view .LVU2841
+.LVL507:
+.LBB1843:
+.LBI1843:
+	.loc 1 5 19 view .LVU2842
+.LBB1844:
+	.loc 1 5 44 view .LVU2843
+# blake2s-generic.c:5: static inline u32 ror(unsigned l, u32 x) { return (x >> l) | (x << (32-l)); }
+	.loc 1 5 60 is_stmt 0 view .LVU2844
+	roll	$16, %ecx	#, _1063
+.LVL508:
+	.loc 1 5 60 view .LVU2845
+.LBE1844:
+.LBE1843:
+# blake2s-generic.c:58:     FULLROUND(8);
+	.loc 1 58 424 view .LVU2846
+	addl	%ecx, %r15d	# _1063, _1064
+# blake2s-generic.c:58:     FULLROUND(8);
+	.loc 1 58 386 view .LVU2847
+	movl	%ecx, 52(%rax)	# _1063, MEM[(u32 *)v_1(D) + 52B]
+	.loc 1 58 416 is_stmt 1 view .LVU2848
+# blake2s-generic.c:58:     FULLROUND(8);
+	.loc 1 58 446 is_stmt 0 view .LVU2849
+	xorl	%r15d, %ebp	# _1064, tmp1911
+# blake2s-generic.c:58:     FULLROUND(8);
+	.loc 1 58 424 view .LVU2850
+	movl	%r15d, 36(%rax)	# _1064, MEM[(u32 *)v_1(D) + 36B]
+	.loc 1 58 436 is_stmt 1 view .LVU2851
+.LVL509:
+.LBB1845:
+.LBI1845:
+	.loc 1 5 19 view .LVU2852
+.LBB1846:
+	.loc 1 5 44 view .LVU2853
+# blake2s-generic.c:5: static inline u32 ror(unsigned l, u32 x) { return (x >> l) | (x << (32-l)); }
+	.loc 1 5 60 is_stmt 0 view .LVU2854
+	rorl	$12, %ebp	#, _1066
+.LVL510:
+	.loc 1 5 60 view .LVU2855
+.LBE1846:
+.LBE1845:
+# blake2s-generic.c:58:     FULLROUND(8);
+	.loc 1 58 444 view .LVU2856
+	movl	%ebp, 20(%rax)	# _1066, MEM[(u32 *)v_1(D) + 20B]
+	.loc 1 58 474 is_stmt 1 view .LVU2857
+# blake2s-generic.c:58:     FULLROUND(8);
+	.loc 1 58 482 is_stmt 0 view .LVU2858
+	addl	36(%r9), %esi	# MEM[(const u32 *)m_4(D) + 36B], tmp1912
+	addl	%ebp, %esi	# _1066, _1069
+# blake2s-generic.c:58:     FULLROUND(8);
+	.loc 1 58 535 view .LVU2859
+	xorl	%esi, %ecx	# _1069, tmp1914
+# blake2s-generic.c:58:     FULLROUND(8);
+	.loc 1 58 482 view .LVU2860
+	movl	%esi, 4(%rax)	# _1069, MEM[(u32 *)v_1(D) + 4B]
+	.loc 1 58 525 is_stmt 1 view .LVU2861
+.LVL511:
+.LBB1847:
+.LBI1847:
+	.loc 1 5 19 view .LVU2862
+.LBB1848:
+	.loc 1 5 44 view .LVU2863
+# blake2s-generic.c:5: static inline u32 ror(unsigned l, u32 x) { return (x >> l) | (x << (32-l)); }
+	.loc 1 5 60 is_stmt 0 view .LVU2864
+	rorl	$8, %ecx	#, _1071
+.LVL512:
+	.loc 1 5 60 view .LVU2865
+.LBE1848:
+.LBE1847:
+# blake2s-generic.c:58:     FULLROUND(8);
+	.loc 1 58 571 view .LVU2866
+	addl	%ecx, %r15d	# _1071, _1072
+# blake2s-generic.c:58:     FULLROUND(8);
+	.loc 1 58 533 view .LVU2867
+	movl	%ecx, 52(%rax)	# _1071, MEM[(u32 *)v_1(D) + 52B]
+	.loc 1 58 563 is_stmt 1 view .LVU2868
+# blake2s-generic.c:58:     FULLROUND(8);
+	.loc 1 58 593 is_stmt 0 view .LVU2869
+	xorl	%r15d, %ebp	# _1072, tmp1915
+# blake2s-generic.c:58:     FULLROUND(8);
+	.loc 1 58 571 view .LVU2870
+	movl	%r15d, 36(%rax)	# _1072, MEM[(u32 *)v_1(D) + 36B]
+	.loc 1 58 583 is_stmt 1 view .LVU2871
+.LVL513:
+.LBB1849:
+.LBI1849:
+	.loc 1 5 19 view .LVU2872
+.LBB1850:
+	.loc 1 5 44 view .LVU2873
+# blake2s-generic.c:5: static inline u32 ror(unsigned l, u32 x) { return (x >> l) | (x << (32-l)); }
+	.loc 1 5 60 is_stmt 0 view .LVU2874
+	rorl	$7, %ebp	#, _1074
+.LVL514:
+	.loc 1 5 60 view .LVU2875
+.LBE1850:
+.LBE1849:
+# blake2s-generic.c:58:     FULLROUND(8);
+	.loc 1 58 593 view .LVU2876
+	movl	%r15d, -20(%rsp)	# _1072, %sfp
+# blake2s-generic.c:58:     FULLROUND(8);
+	.loc 1 58 591 view .LVU2877
+	movl	%ebp, 20(%rax)	# _1074, MEM[(u32 *)v_1(D) + 20B]
+	.loc 1 58 325 is_stmt 1 view .LVU2878
+	.loc 1 58 634 view .LVU2879
+	.loc 1 58 639 view .LVU2880
+# blake2s-generic.c:58:     FULLROUND(8);
+	.loc 1 58 647 is_stmt 0 view .LVU2881
+	addl	44(%r9), %edx	# MEM[(const u32 *)m_4(D) + 44B], tmp1916
+	leal	(%rdx,%rbx), %r12d	#, _1077
+# blake2s-generic.c:58:     FULLROUND(8);
+	.loc 1 58 736 view .LVU2882
+	movl	-12(%rsp), %edx	# %sfp, _992
+# blake2s-generic.c:58:     FULLROUND(8);
+	.loc 1 58 700 view .LVU2883
+	xorl	%r12d, %r13d	# _1077, tmp1918
+# blake2s-generic.c:58:     FULLROUND(8);
+	.loc 1 58 647 view .LVU2884
+	movl	%r12d, 8(%rax)	# _1077, MEM[(u32 *)v_1(D) + 8B]
+	.loc 1 58 690 is_stmt 1 view .LVU2885
+.LVL515:
+.LBB1851:
+.LBI1851:
+	.loc 1 5 19 view .LVU2886
+.LBB1852:
+	.loc 1 5 44 view .LVU2887
+# blake2s-generic.c:5: static inline u32 ror(unsigned l, u32 x) { return (x >> l) | (x << (32-l)); }
+	.loc 1 5 60 is_stmt 0 view .LVU2888
+	roll	$16, %r13d	#, _1079
+.LVL516:
+	.loc 1 5 60 view .LVU2889
+.LBE1852:
+.LBE1851:
+# blake2s-generic.c:58:     FULLROUND(8);
+	.loc 1 58 736 view .LVU2890
+	leal	(%rdx,%r13), %r14d	#, _1080
+# blake2s-generic.c:58:     FULLROUND(8);
+	.loc 1 58 698 view .LVU2891
+	movl	%r13d, 56(%rax)	# _1079, MEM[(u32 *)v_1(D) + 56B]
+	.loc 1 58 728 is_stmt 1 view .LVU2892
+# blake2s-generic.c:58:     FULLROUND(8);
+	.loc 1 58 758 is_stmt 0 view .LVU2893
+	xorl	%r14d, %ebx	# _1080, tmp1919
+# blake2s-generic.c:58:     FULLROUND(8);
+	.loc 1 58 736 view .LVU2894
+	movl	%r14d, 40(%rax)	# _1080, MEM[(u32 *)v_1(D) + 40B]
+	.loc 1 58 748 is_stmt 1 view .LVU2895
+.LVL517:
+.LBB1853:
+.LBI1853:
+	.loc 1 5 19 view .LVU2896
+.LBB1854:
+	.loc 1 5 44 view .LVU2897
+# blake2s-generic.c:5: static inline u32 ror(unsigned l, u32 x) { return (x >> l) | (x << (32-l)); }
+	.loc 1 5 60 is_stmt 0 view .LVU2898
+	rorl	$12, %ebx	#, _1082
+.LVL518:
+	.loc 1 5 60 view .LVU2899
+.LBE1854:
+.LBE1853:
+# blake2s-generic.c:58:     FULLROUND(8);
+	.loc 1 58 756 view .LVU2900
+	movl	%ebx, 24(%rax)	# _1082, MEM[(u32 *)v_1(D) + 24B]
+	.loc 1 58 786 is_stmt 1 view .LVU2901
+# blake2s-generic.c:58:     FULLROUND(8);
+	.loc 1 58 794 is_stmt 0 view .LVU2902
+	addl	12(%r9), %r12d	# MEM[(const u32 *)m_4(D) + 12B], tmp1920
+	addl	%ebx, %r12d	# _1082, _1085
+# blake2s-generic.c:58:     FULLROUND(8);
+	.loc 1 58 847 view .LVU2903
+	xorl	%r12d, %r13d	# _1085, tmp1922
+# blake2s-generic.c:58:     FULLROUND(8);
+	.loc 1 58 794 view .LVU2904
+	movl	%r12d, 8(%rax)	# _1085, MEM[(u32 *)v_1(D) + 8B]
+	.loc 1 58 837 is_stmt 1 view .LVU2905
+.LVL519:
+.LBB1855:
+.LBI1855:
+	.loc 1 5 19 view .LVU2906
+.LBB1856:
+	.loc 1 5 44 view .LVU2907
+# blake2s-generic.c:5: static inline u32 ror(unsigned l, u32 x) { return (x >> l) | (x << (32-l)); }
+	.loc 1 5 60 is_stmt 0 view .LVU2908
+	rorl	$8, %r13d	#, tmp1922
+.LBE1856:
+.LBE1855:
+# blake2s-generic.c:58:     FULLROUND(8);
+	.loc 1 58 845 view .LVU2909
+	movl	%r13d, 56(%rax)	# _1087, MEM[(u32 *)v_1(D) + 56B]
+	.loc 1 58 875 is_stmt 1 view .LVU2910
+# blake2s-generic.c:58:     FULLROUND(8);
+	.loc 1 58 1048 is_stmt 0 view .LVU2911
+	movl	-8(%rsp), %r15d	# %sfp, _1008
+# blake2s-generic.c:58:     FULLROUND(8);
+	.loc 1 58 883 view .LVU2912
+	movl	%r13d, -12(%rsp)	# _1087, %sfp
+	addl	%r14d, %r13d	# _1080, _1088
+# blake2s-generic.c:58:     FULLROUND(8);
+	.loc 1 58 905 view .LVU2913
+	xorl	%r13d, %ebx	# _1088, tmp1923
+# blake2s-generic.c:58:     FULLROUND(8);
+	.loc 1 58 883 view .LVU2914
+	movl	%r13d, 40(%rax)	# _1088, MEM[(u32 *)v_1(D) + 40B]
+	.loc 1 58 895 is_stmt 1 view .LVU2915
+.LVL520:
+.LBB1857:
+.LBI1857:
+	.loc 1 5 19 view .LVU2916
+.LBB1858:
+	.loc 1 5 44 view .LVU2917
+# blake2s-generic.c:5: static inline u32 ror(unsigned l, u32 x) { return (x >> l) | (x << (32-l)); }
+	.loc 1 5 60 is_stmt 0 view .LVU2918
+	rorl	$7, %ebx	#, _1090
+.LVL521:
+	.loc 1 5 60 view .LVU2919
+.LBE1858:
+.LBE1857:
+# blake2s-generic.c:58:     FULLROUND(8);
+	.loc 1 58 903 view .LVU2920
+	movl	%ebx, 24(%rax)	# _1090, MEM[(u32 *)v_1(D) + 24B]
+	.loc 1 58 637 is_stmt 1 view .LVU2921
+	.loc 1 58 946 view .LVU2922
+	.loc 1 58 951 view .LVU2923
+# blake2s-generic.c:58:     FULLROUND(8);
+	.loc 1 58 959 is_stmt 0 view .LVU2924
+	addl	(%r9), %r10d	# *m_4(D), tmp1924
+	leal	(%r10,%r11), %edx	#, _1093
+# blake2s-generic.c:58:     FULLROUND(8);
+	.loc 1 58 1012 view .LVU2925
+	movl	-16(%rsp), %r10d	# %sfp, _991
+# blake2s-generic.c:58:     FULLROUND(8);
+	.loc 1 58 959 view .LVU2926
+	movl	%edx, 12(%rax)	# _1093, MEM[(u32 *)v_1(D) + 12B]
+	.loc 1 58 1002 is_stmt 1 view .LVU2927
+.LVL522:
+.LBB1859:
+.LBI1859:
+	.loc 1 5 19 view .LVU2928
+.LBB1860:
+	.loc 1 5 44 view .LVU2929
+.LBE1860:
+.LBE1859:
+# blake2s-generic.c:58:     FULLROUND(8);
+	.loc 1 58 1012 is_stmt 0 view .LVU2930
+	xorl	%edx, %r10d	# _1093, _991
+.LVL523:
+.LBB1862:
+.LBB1861:
+# blake2s-generic.c:5: static inline u32 ror(unsigned l, u32 x) { return (x >> l) | (x << (32-l)); }
+	.loc 1 5 60 view .LVU2931
+	roll	$16, %r10d	#, _1095
+.LVL524:
+	.loc 1 5 60 view .LVU2932
+.LBE1861:
+.LBE1862:
+# blake2s-generic.c:58:     FULLROUND(8);
+	.loc 1 58 1048 view .LVU2933
+	leal	(%r15,%r10), %r14d	#, _1096
+# blake2s-generic.c:58:     FULLROUND(8);
+	.loc 1 58 1010 view .LVU2934
+	movl	%r10d, 60(%rax)	# _1095, MEM[(u32 *)v_1(D) + 60B]
+	.loc 1 58 1040 is_stmt 1 view .LVU2935
+# blake2s-generic.c:58:     FULLROUND(8);
+	.loc 1 58 1070 is_stmt 0 view .LVU2936
+	xorl	%r14d, %r11d	# _1096, tmp1927
+# blake2s-generic.c:58:     FULLROUND(8);
+	.loc 1 58 1048 view .LVU2937
+	movl	%r14d, 44(%rax)	# _1096, MEM[(u32 *)v_1(D) + 44B]
+	.loc 1 58 1060 is_stmt 1 view .LVU2938
+.LVL525:
+.LBB1863:
+.LBI1863:
+	.loc 1 5 19 view .LVU2939
+.LBB1864:
+	.loc 1 5 44 view .LVU2940
+# blake2s-generic.c:5: static inline u32 ror(unsigned l, u32 x) { return (x >> l) | (x << (32-l)); }
+	.loc 1 5 60 is_stmt 0 view .LVU2941
+	rorl	$12, %r11d	#, _1098
+.LVL526:
+	.loc 1 5 60 view .LVU2942
+.LBE1864:
+.LBE1863:
+# blake2s-generic.c:58:     FULLROUND(8);
+	.loc 1 58 1068 view .LVU2943
+	movl	%r11d, 28(%rax)	# _1098, MEM[(u32 *)v_1(D) + 28B]
+	.loc 1 58 1098 is_stmt 1 view .LVU2944
+# blake2s-generic.c:58:     FULLROUND(8);
+	.loc 1 58 1106 is_stmt 0 view .LVU2945
+	addl	32(%r9), %edx	# MEM[(const u32 *)m_4(D) + 32B], tmp1928
+	addl	%r11d, %edx	# _1098, _1101
+# blake2s-generic.c:58:     FULLROUND(8);
+	.loc 1 58 1159 view .LVU2946
+	xorl	%edx, %r10d	# _1101, tmp1930
+# blake2s-generic.c:58:     FULLROUND(8);
+	.loc 1 58 1106 view .LVU2947
+	movl	%edx, 12(%rax)	# _1101, MEM[(u32 *)v_1(D) + 12B]
+	.loc 1 58 1149 is_stmt 1 view .LVU2948
+.LVL527:
+.LBB1865:
+.LBI1865:
+	.loc 1 5 19 view .LVU2949
+.LBB1866:
+	.loc 1 5 44 view .LVU2950
+# blake2s-generic.c:5: static inline u32 ror(unsigned l, u32 x) { return (x >> l) | (x << (32-l)); }
+	.loc 1 5 60 is_stmt 0 view .LVU2951
+	rorl	$8, %r10d	#, _1103
+.LVL528:
+	.loc 1 5 60 view .LVU2952
+.LBE1866:
+.LBE1865:
+# blake2s-generic.c:58:     FULLROUND(8);
+	.loc 1 58 1195 view .LVU2953
+	addl	%r10d, %r14d	# _1103, _1104
+# blake2s-generic.c:58:     FULLROUND(8);
+	.loc 1 58 1157 view .LVU2954
+	movl	%r10d, 60(%rax)	# _1103, MEM[(u32 *)v_1(D) + 60B]
+	.loc 1 58 1187 is_stmt 1 view .LVU2955
+# blake2s-generic.c:58:     FULLROUND(8);
+	.loc 1 58 1217 is_stmt 0 view .LVU2956
+	xorl	%r14d, %r11d	# _1104, tmp1931
+# blake2s-generic.c:58:     FULLROUND(8);
+	.loc 1 58 1195 view .LVU2957
+	movl	%r14d, 44(%rax)	# _1104, MEM[(u32 *)v_1(D) + 44B]
+	.loc 1 58 1207 is_stmt 1 view .LVU2958
+.LVL529:
+.LBB1867:
+.LBI1867:
+	.loc 1 5 19 view .LVU2959
+.LBB1868:
+	.loc 1 5 44 view .LVU2960
+# blake2s-generic.c:5: static inline u32 ror(unsigned l, u32 x) { return (x >> l) | (x << (32-l)); }
+	.loc 1 5 60 is_stmt 0 view .LVU2961
+	rorl	$7, %r11d	#, _1106
+.LVL530:
+	.loc 1 5 60 view .LVU2962
+.LBE1868:
+.LBE1867:
+# blake2s-generic.c:58:     FULLROUND(8);
+	.loc 1 58 1215 view .LVU2963
+	movl	%r11d, 28(%rax)	# _1106, MEM[(u32 *)v_1(D) + 28B]
+	.loc 1 58 949 is_stmt 1 view .LVU2964
+	.loc 1 58 1258 view .LVU2965
+	.loc 1 58 1263 view .LVU2966
+# blake2s-generic.c:58:     FULLROUND(8);
+	.loc 1 58 1271 is_stmt 0 view .LVU2967
+	addl	48(%r9), %r8d	# MEM[(const u32 *)m_4(D) + 48B], tmp1932
+	addl	%ebp, %r8d	# _1074, _1109
+# blake2s-generic.c:58:     FULLROUND(8);
+	.loc 1 58 1324 view .LVU2968
+	xorl	%r8d, %r10d	# _1109, tmp1934
+# blake2s-generic.c:58:     FULLROUND(8);
+	.loc 1 58 1271 view .LVU2969
+	movl	%r8d, (%rax)	# _1109, *v_1(D)
+	.loc 1 58 1314 is_stmt 1 view .LVU2970
+.LVL531:
+.LBB1869:
+.LBI1869:
+	.loc 1 5 19 view .LVU2971
+.LBB1870:
+	.loc 1 5 44 view .LVU2972
+# blake2s-generic.c:5: static inline u32 ror(unsigned l, u32 x) { return (x >> l) | (x << (32-l)); }
+	.loc 1 5 60 is_stmt 0 view .LVU2973
+	roll	$16, %r10d	#, _1111
+.LVL532:
+	.loc 1 5 60 view .LVU2974
+.LBE1870:
+.LBE1869:
+# blake2s-generic.c:58:     FULLROUND(8);
+	.loc 1 58 1360 view .LVU2975
+	addl	%r10d, %r13d	# _1111, _1112
+# blake2s-generic.c:58:     FULLROUND(8);
+	.loc 1 58 1322 view .LVU2976
+	movl	%r10d, 60(%rax)	# _1111, MEM[(u32 *)v_1(D) + 60B]
+	.loc 1 58 1352 is_stmt 1 view .LVU2977
+# blake2s-generic.c:58:     FULLROUND(8);
+	.loc 1 58 1382 is_stmt 0 view .LVU2978
+	xorl	%r13d, %ebp	# _1112, tmp1935
+# blake2s-generic.c:58:     FULLROUND(8);
+	.loc 1 58 1360 view .LVU2979
+	movl	%r13d, 40(%rax)	# _1112, MEM[(u32 *)v_1(D) + 40B]
+	.loc 1 58 1372 is_stmt 1 view .LVU2980
+.LVL533:
+.LBB1871:
+.LBI1871:
+	.loc 1 5 19 view .LVU2981
+.LBB1872:
+	.loc 1 5 44 view .LVU2982
+# blake2s-generic.c:5: static inline u32 ror(unsigned l, u32 x) { return (x >> l) | (x << (32-l)); }
+	.loc 1 5 60 is_stmt 0 view .LVU2983
+	rorl	$12, %ebp	#, _1114
+.LVL534:
+	.loc 1 5 60 view .LVU2984
+.LBE1872:
+.LBE1871:
+# blake2s-generic.c:58:     FULLROUND(8);
+	.loc 1 58 1380 view .LVU2985
+	movl	%ebp, 20(%rax)	# _1114, MEM[(u32 *)v_1(D) + 20B]
+	.loc 1 58 1410 is_stmt 1 view .LVU2986
+# blake2s-generic.c:58:     FULLROUND(8);
+	.loc 1 58 1418 is_stmt 0 view .LVU2987
+	addl	8(%r9), %r8d	# MEM[(const u32 *)m_4(D) + 8B], tmp1936
+	addl	%ebp, %r8d	# _1114, _1117
+# blake2s-generic.c:58:     FULLROUND(8);
+	.loc 1 58 1471 view .LVU2988
+	xorl	%r8d, %r10d	# _1117, tmp1938
+# blake2s-generic.c:58:     FULLROUND(8);
+	.loc 1 58 1418 view .LVU2989
+	movl	%r8d, (%rax)	# _1117, *v_1(D)
+	.loc 1 58 1461 is_stmt 1 view .LVU2990
+.LVL535:
+.LBB1873:
+.LBI1873:
+	.loc 1 5 19 view .LVU2991
+.LBB1874:
+	.loc 1 5 44 view .LVU2992
+# blake2s-generic.c:5: static inline u32 ror(unsigned l, u32 x) { return (x >> l) | (x << (32-l)); }
+	.loc 1 5 60 is_stmt 0 view .LVU2993
+	movl	%r10d, %r15d	# tmp1938, tmp1938
+	rorl	$8, %r15d	#, tmp1938
+.LBE1874:
+.LBE1873:
+# blake2s-generic.c:58:     FULLROUND(8);
+	.loc 1 58 1469 view .LVU2994
+	movl	%r15d, 60(%rax)	# _1119, MEM[(u32 *)v_1(D) + 60B]
+	.loc 1 58 1499 is_stmt 1 view .LVU2995
+# blake2s-generic.c:58:     FULLROUND(8);
+	.loc 1 58 1507 is_stmt 0 view .LVU2996
+	movl	%r15d, -16(%rsp)	# _1119, %sfp
+	addl	%r13d, %r15d	# _1112, _1120
+# blake2s-generic.c:58:     FULLROUND(8);
+	.loc 1 58 1529 view .LVU2997
+	xorl	%r15d, %ebp	# _1120, tmp1939
+# blake2s-generic.c:58:     FULLROUND(8);
+	.loc 1 58 1507 view .LVU2998
+	movl	%r15d, 40(%rax)	# _1120, MEM[(u32 *)v_1(D) + 40B]
+	.loc 1 58 1519 is_stmt 1 view .LVU2999
+.LVL536:
+.LBB1875:
+.LBI1875:
+	.loc 1 5 19 view .LVU3000
+.LBB1876:
+	.loc 1 5 44 view .LVU3001
+# blake2s-generic.c:5: static inline u32 ror(unsigned l, u32 x) { return (x >> l) | (x << (32-l)); }
+	.loc 1 5 60 is_stmt 0 view .LVU3002
+	rorl	$7, %ebp	#, tmp1939
+.LBE1876:
+.LBE1875:
+# blake2s-generic.c:58:     FULLROUND(8);
+	.loc 1 58 1527 view .LVU3003
+	movl	%ebp, 20(%rax)	# _1122, MEM[(u32 *)v_1(D) + 20B]
+	.loc 1 58 1261 is_stmt 1 view .LVU3004
+	.loc 1 58 1570 view .LVU3005
+	.loc 1 58 1575 view .LVU3006
+# blake2s-generic.c:58:     FULLROUND(8);
+	.loc 1 58 1583 is_stmt 0 view .LVU3007
+	addl	52(%r9), %esi	# MEM[(const u32 *)m_4(D) + 52B], tmp1940
+# blake2s-generic.c:58:     FULLROUND(8);
+	.loc 1 58 1527 view .LVU3008
+	movl	%ebp, -8(%rsp)	# _1122, %sfp
+# blake2s-generic.c:58:     FULLROUND(8);
+	.loc 1 58 1583 view .LVU3009
+	leal	(%rsi,%rbx), %ebp	#, _1125
+# blake2s-generic.c:58:     FULLROUND(8);
+	.loc 1 58 1637 view .LVU3010
+	xorl	%ebp, %edi	# _1125, tmp1942
+# blake2s-generic.c:58:     FULLROUND(8);
+	.loc 1 58 1583 view .LVU3011
+	movl	%ebp, 4(%rax)	# _1125, MEM[(u32 *)v_1(D) + 4B]
+	.loc 1 58 1627 is_stmt 1 view .LVU3012
+.LVL537:
+.LBB1877:
+.LBI1877:
+	.loc 1 5 19 view .LVU3013
+.LBB1878:
+	.loc 1 5 44 view .LVU3014
+# blake2s-generic.c:5: static inline u32 ror(unsigned l, u32 x) { return (x >> l) | (x << (32-l)); }
+	.loc 1 5 60 is_stmt 0 view .LVU3015
+	roll	$16, %edi	#, _1127
+.LVL538:
+	.loc 1 5 60 view .LVU3016
+.LBE1878:
+.LBE1877:
+# blake2s-generic.c:58:     FULLROUND(8);
+	.loc 1 58 1673 view .LVU3017
+	addl	%edi, %r14d	# _1127, _1128
+# blake2s-generic.c:58:     FULLROUND(8);
+	.loc 1 58 1635 view .LVU3018
+	movl	%edi, 48(%rax)	# _1127, MEM[(u32 *)v_1(D) + 48B]
+	.loc 1 58 1665 is_stmt 1 view .LVU3019
+# blake2s-generic.c:58:     FULLROUND(8);
+	.loc 1 58 1695 is_stmt 0 view .LVU3020
+	xorl	%r14d, %ebx	# _1128, tmp1943
+# blake2s-generic.c:58:     FULLROUND(8);
+	.loc 1 58 1673 view .LVU3021
+	movl	%r14d, 44(%rax)	# _1128, MEM[(u32 *)v_1(D) + 44B]
+	.loc 1 58 1685 is_stmt 1 view .LVU3022
+.LVL539:
+.LBB1879:
+.LBI1879:
+	.loc 1 5 19 view .LVU3023
+.LBB1880:
+	.loc 1 5 44 view .LVU3024
+# blake2s-generic.c:5: static inline u32 ror(unsigned l, u32 x) { return (x >> l) | (x << (32-l)); }
+	.loc 1 5 60 is_stmt 0 view .LVU3025
+	rorl	$12, %ebx	#, _1130
+.LVL540:
+	.loc 1 5 60 view .LVU3026
+.LBE1880:
+.LBE1879:
+# blake2s-generic.c:58:     FULLROUND(8);
+	.loc 1 58 1693 view .LVU3027
+	movl	%ebx, 24(%rax)	# _1130, MEM[(u32 *)v_1(D) + 24B]
+	.loc 1 58 1723 is_stmt 1 view .LVU3028
+# blake2s-generic.c:58:     FULLROUND(8);
+	.loc 1 58 1731 is_stmt 0 view .LVU3029
+	addl	28(%r9), %ebp	# MEM[(const u32 *)m_4(D) + 28B], tmp1944
+	addl	%ebx, %ebp	# _1130, _1133
+# blake2s-generic.c:58:     FULLROUND(8);
+	.loc 1 58 2265 view .LVU3030
+	movl	-12(%rsp), %r10d	# %sfp, _1087
+# blake2s-generic.c:58:     FULLROUND(8);
+	.loc 1 58 2301 view .LVU3031
+	movl	-20(%rsp), %r13d	# %sfp, _1072
+# blake2s-generic.c:58:     FULLROUND(8);
+	.loc 1 58 1785 view .LVU3032
+	xorl	%ebp, %edi	# _1133, tmp1946
+# blake2s-generic.c:58:     FULLROUND(8);
+	.loc 1 58 1731 view .LVU3033
+	movl	%ebp, 4(%rax)	# _1133, MEM[(u32 *)v_1(D) + 4B]
+	.loc 1 58 1775 is_stmt 1 view .LVU3034
+.LVL541:
+.LBB1881:
+.LBI1881:
+	.loc 1 5 19 view .LVU3035
+.LBB1882:
+	.loc 1 5 44 view .LVU3036
+# blake2s-generic.c:5: static inline u32 ror(unsigned l, u32 x) { return (x >> l) | (x << (32-l)); }
+	.loc 1 5 60 is_stmt 0 view .LVU3037
+	rorl	$8, %edi	#, _1135
+.LVL542:
+	.loc 1 5 60 view .LVU3038
+.LBE1882:
+.LBE1881:
+# blake2s-generic.c:58:     FULLROUND(8);
+	.loc 1 58 1821 view .LVU3039
+	addl	%edi, %r14d	# _1135, _1136
+# blake2s-generic.c:58:     FULLROUND(8);
+	.loc 1 58 1783 view .LVU3040
+	movl	%edi, 48(%rax)	# _1135, MEM[(u32 *)v_1(D) + 48B]
+	.loc 1 58 1813 is_stmt 1 view .LVU3041
+# blake2s-generic.c:58:     FULLROUND(8);
+	.loc 1 58 1843 is_stmt 0 view .LVU3042
+	xorl	%r14d, %ebx	# _1136, tmp1947
+# blake2s-generic.c:58:     FULLROUND(8);
+	.loc 1 58 1821 view .LVU3043
+	movl	%r14d, 44(%rax)	# _1136, MEM[(u32 *)v_1(D) + 44B]
+	.loc 1 58 1833 is_stmt 1 view .LVU3044
+.LVL543:
+.LBB1883:
+.LBI1883:
+	.loc 1 5 19 view .LVU3045
+.LBB1884:
+	.loc 1 5 44 view .LVU3046
+# blake2s-generic.c:5: static inline u32 ror(unsigned l, u32 x) { return (x >> l) | (x << (32-l)); }
+	.loc 1 5 60 is_stmt 0 view .LVU3047
+	rorl	$7, %ebx	#, tmp1947
+.LBE1884:
+.LBE1883:
+# blake2s-generic.c:58:     FULLROUND(8);
+	.loc 1 58 1841 view .LVU3048
+	movl	%ebx, 24(%rax)	# _1138, MEM[(u32 *)v_1(D) + 24B]
+	.loc 1 58 1573 is_stmt 1 view .LVU3049
+	.loc 1 58 1884 view .LVU3050
+	.loc 1 58 1889 view .LVU3051
+# blake2s-generic.c:58:     FULLROUND(8);
+	.loc 1 58 1897 is_stmt 0 view .LVU3052
+	addl	4(%r9), %r12d	# MEM[(const u32 *)m_4(D) + 4B], tmp1948
+	leal	(%r12,%r11), %esi	#, _1141
+# blake2s-generic.c:58:     FULLROUND(8);
+	.loc 1 58 1987 view .LVU3053
+	movl	-28(%rsp), %r12d	# %sfp, _1056
+# blake2s-generic.c:58:     FULLROUND(8);
+	.loc 1 58 1841 view .LVU3054
+	movl	%ebx, -4(%rsp)	# _1138, %sfp
+# blake2s-generic.c:58:     FULLROUND(8);
+	.loc 1 58 1951 view .LVU3055
+	xorl	%esi, %ecx	# _1141, tmp1950
+# blake2s-generic.c:58:     FULLROUND(8);
+	.loc 1 58 1897 view .LVU3056
+	movl	%esi, 8(%rax)	# _1141, MEM[(u32 *)v_1(D) + 8B]
+	.loc 1 58 1941 is_stmt 1 view .LVU3057
+.LVL544:
+.LBB1885:
+.LBI1885:
+	.loc 1 5 19 view .LVU3058
+.LBB1886:
+	.loc 1 5 44 view .LVU3059
+# blake2s-generic.c:5: static inline u32 ror(unsigned l, u32 x) { return (x >> l) | (x << (32-l)); }
+	.loc 1 5 60 is_stmt 0 view .LVU3060
+	roll	$16, %ecx	#, _1143
+.LVL545:
+	.loc 1 5 60 view .LVU3061
+.LBE1886:
+.LBE1885:
+# blake2s-generic.c:58:     FULLROUND(8);
+	.loc 1 58 1987 view .LVU3062
+	leal	(%r12,%rcx), %ebx	#, _1144
+# blake2s-generic.c:58:     FULLROUND(8);
+	.loc 1 58 1949 view .LVU3063
+	movl	%ecx, 52(%rax)	# _1143, MEM[(u32 *)v_1(D) + 52B]
+	.loc 1 58 1979 is_stmt 1 view .LVU3064
+# blake2s-generic.c:58:     FULLROUND(8);
+	.loc 1 58 2009 is_stmt 0 view .LVU3065
+	xorl	%ebx, %r11d	# _1144, tmp1951
+# blake2s-generic.c:58:     FULLROUND(8);
+	.loc 1 58 1987 view .LVU3066
+	movl	%ebx, 32(%rax)	# _1144, MEM[(u32 *)v_1(D) + 32B]
+	.loc 1 58 1999 is_stmt 1 view .LVU3067
+.LVL546:
+.LBB1887:
+.LBI1887:
+	.loc 1 5 19 view .LVU3068
+.LBB1888:
+	.loc 1 5 44 view .LVU3069
+# blake2s-generic.c:5: static inline u32 ror(unsigned l, u32 x) { return (x >> l) | (x << (32-l)); }
+	.loc 1 5 60 is_stmt 0 view .LVU3070
+	rorl	$12, %r11d	#, _1146
+.LVL547:
+	.loc 1 5 60 view .LVU3071
+.LBE1888:
+.LBE1887:
+# blake2s-generic.c:58:     FULLROUND(8);
+	.loc 1 58 2007 view .LVU3072
+	movl	%r11d, 28(%rax)	# _1146, MEM[(u32 *)v_1(D) + 28B]
+	.loc 1 58 2037 is_stmt 1 view .LVU3073
+# blake2s-generic.c:58:     FULLROUND(8);
+	.loc 1 58 2045 is_stmt 0 view .LVU3074
+	addl	16(%r9), %esi	# MEM[(const u32 *)m_4(D) + 16B], tmp1952
+	addl	%r11d, %esi	# _1146, _1149
+# blake2s-generic.c:58:     FULLROUND(8);
+	.loc 1 58 2099 view .LVU3075
+	xorl	%esi, %ecx	# _1149, tmp1954
+# blake2s-generic.c:58:     FULLROUND(8);
+	.loc 1 58 2045 view .LVU3076
+	movl	%esi, 8(%rax)	# _1149, MEM[(u32 *)v_1(D) + 8B]
+	.loc 1 58 2089 is_stmt 1 view .LVU3077
+.LVL548:
+.LBB1889:
+.LBI1889:
+	.loc 1 5 19 view .LVU3078
+.LBB1890:
+	.loc 1 5 44 view .LVU3079
+# blake2s-generic.c:5: static inline u32 ror(unsigned l, u32 x) { return (x >> l) | (x << (32-l)); }
+	.loc 1 5 60 is_stmt 0 view .LVU3080
+	rorl	$8, %ecx	#, _1151
+.LVL549:
+	.loc 1 5 60 view .LVU3081
+.LBE1890:
+.LBE1889:
+# blake2s-generic.c:58:     FULLROUND(8);
+	.loc 1 58 2135 view .LVU3082
+	addl	%ecx, %ebx	# _1151, _1152
+# blake2s-generic.c:58:     FULLROUND(8);
+	.loc 1 58 2097 view .LVU3083
+	movl	%ecx, 52(%rax)	# _1151, MEM[(u32 *)v_1(D) + 52B]
+	.loc 1 58 2127 is_stmt 1 view .LVU3084
+# blake2s-generic.c:58:     FULLROUND(8);
+	.loc 1 58 2157 is_stmt 0 view .LVU3085
+	xorl	%ebx, %r11d	# _1152, tmp1955
+# blake2s-generic.c:58:     FULLROUND(8);
+	.loc 1 58 2135 view .LVU3086
+	movl	%ebx, 32(%rax)	# _1152, MEM[(u32 *)v_1(D) + 32B]
+	.loc 1 58 2147 is_stmt 1 view .LVU3087
+.LVL550:
+.LBB1891:
+.LBI1891:
+	.loc 1 5 19 view .LVU3088
+.LBB1892:
+	.loc 1 5 44 view .LVU3089
+# blake2s-generic.c:5: static inline u32 ror(unsigned l, u32 x) { return (x >> l) | (x << (32-l)); }
+	.loc 1 5 60 is_stmt 0 view .LVU3090
+	movl	%r11d, %r12d	# tmp1955, tmp1955
+.LBE1892:
+.LBE1891:
+# blake2s-generic.c:58:     FULLROUND(8);
+	.loc 1 58 2211 view .LVU3091
+	movl	-24(%rsp), %r11d	# %sfp, _1058
+.LBB1894:
+.LBB1893:
+# blake2s-generic.c:5: static inline u32 ror(unsigned l, u32 x) { return (x >> l) | (x << (32-l)); }
+	.loc 1 5 60 view .LVU3092
+	rorl	$7, %r12d	#, tmp1955
+.LBE1893:
+.LBE1894:
+# blake2s-generic.c:58:     FULLROUND(8);
+	.loc 1 58 2155 view .LVU3093
+	movl	%r12d, 28(%rax)	# _1154, MEM[(u32 *)v_1(D) + 28B]
+	.loc 1 58 1887 is_stmt 1 view .LVU3094
+	.loc 1 58 2198 view .LVU3095
+	.loc 1 58 2203 view .LVU3096
+# blake2s-generic.c:58:     FULLROUND(8);
+	.loc 1 58 2211 is_stmt 0 view .LVU3097
+	addl	40(%r9), %edx	# MEM[(const u32 *)m_4(D) + 40B], tmp1956
+	addl	%r11d, %edx	# _1058, _1157
+# blake2s-generic.c:58:     FULLROUND(8);
+	.loc 1 58 2155 view .LVU3098
+	movl	%r12d, -28(%rsp)	# _1154, %sfp
+# blake2s-generic.c:58:     FULLROUND(8);
+	.loc 1 58 2265 view .LVU3099
+	xorl	%edx, %r10d	# _1157, _1087
+# blake2s-generic.c:58:     FULLROUND(8);
+	.loc 1 58 2211 view .LVU3100
+	movl	%edx, 12(%rax)	# _1157, MEM[(u32 *)v_1(D) + 12B]
+	.loc 1 58 2255 is_stmt 1 view .LVU3101
+.LVL551:
+.LBB1895:
+.LBI1895:
+	.loc 1 5 19 view .LVU3102
+.LBB1896:
+	.loc 1 5 44 view .LVU3103
+# blake2s-generic.c:5: static inline u32 ror(unsigned l, u32 x) { return (x >> l) | (x << (32-l)); }
+	.loc 1 5 60 is_stmt 0 view .LVU3104
+	roll	$16, %r10d	#, _1159
+.LVL552:
+	.loc 1 5 60 view .LVU3105
+.LBE1896:
+.LBE1895:
+# blake2s-generic.c:58:     FULLROUND(8);
+	.loc 1 58 2301 view .LVU3106
+	addl	%r10d, %r13d	# _1159, _1160
+# blake2s-generic.c:58:     FULLROUND(8);
+	.loc 1 58 2263 view .LVU3107
+	movl	%r10d, 56(%rax)	# _1159, MEM[(u32 *)v_1(D) + 56B]
+	.loc 1 58 2293 is_stmt 1 view .LVU3108
+# blake2s-generic.c:58:     FULLROUND(8);
+	.loc 1 58 2323 is_stmt 0 view .LVU3109
+	xorl	%r13d, %r11d	# _1160, _1058
+# blake2s-generic.c:58:     FULLROUND(8);
+	.loc 1 58 2301 view .LVU3110
+	movl	%r13d, 36(%rax)	# _1160, MEM[(u32 *)v_1(D) + 36B]
+	.loc 1 58 2313 is_stmt 1 view .LVU3111
+.LVL553:
+.LBB1897:
+.LBI1897:
+	.loc 1 5 19 view .LVU3112
+.LBB1898:
+	.loc 1 5 44 view .LVU3113
+# blake2s-generic.c:5: static inline u32 ror(unsigned l, u32 x) { return (x >> l) | (x << (32-l)); }
+	.loc 1 5 60 is_stmt 0 view .LVU3114
+	rorl	$12, %r11d	#, _1162
+.LVL554:
+	.loc 1 5 60 view .LVU3115
+.LBE1898:
+.LBE1897:
+# blake2s-generic.c:58:     FULLROUND(8);
+	.loc 1 58 2321 view .LVU3116
+	movl	%r11d, 16(%rax)	# _1162, MEM[(u32 *)v_1(D) + 16B]
+	.loc 1 58 2351 is_stmt 1 view .LVU3117
+# blake2s-generic.c:58:     FULLROUND(8);
+	.loc 1 58 2359 is_stmt 0 view .LVU3118
+	addl	20(%r9), %edx	# MEM[(const u32 *)m_4(D) + 20B], tmp1960
+	addl	%r11d, %edx	# _1162, _1165
+# blake2s-generic.c:58:     FULLROUND(8);
+	.loc 1 58 2413 view .LVU3119
+	xorl	%edx, %r10d	# _1165, tmp1962
+# blake2s-generic.c:58:     FULLROUND(8);
+	.loc 1 58 2359 view .LVU3120
+	movl	%edx, 12(%rax)	# _1165, MEM[(u32 *)v_1(D) + 12B]
+	.loc 1 58 2403 is_stmt 1 view .LVU3121
+.LVL555:
+.LBB1899:
+.LBI1899:
+	.loc 1 5 19 view .LVU3122
+.LBB1900:
+	.loc 1 5 44 view .LVU3123
+# blake2s-generic.c:5: static inline u32 ror(unsigned l, u32 x) { return (x >> l) | (x << (32-l)); }
+	.loc 1 5 60 is_stmt 0 view .LVU3124
+	rorl	$8, %r10d	#, _1167
+.LVL556:
+	.loc 1 5 60 view .LVU3125
+.LBE1900:
+.LBE1899:
+# blake2s-generic.c:58:     FULLROUND(8);
+	.loc 1 58 2449 view .LVU3126
+	addl	%r10d, %r13d	# _1167, _1168
+# blake2s-generic.c:58:     FULLROUND(8);
+	.loc 1 58 2411 view .LVU3127
+	movl	%r10d, 56(%rax)	# _1167, MEM[(u32 *)v_1(D) + 56B]
+	.loc 1 58 2441 is_stmt 1 view .LVU3128
+# blake2s-generic.c:58:     FULLROUND(8);
+	.loc 1 58 2471 is_stmt 0 view .LVU3129
+	xorl	%r13d, %r11d	# _1168, tmp1963
+# blake2s-generic.c:58:     FULLROUND(8);
+	.loc 1 58 2449 view .LVU3130
+	movl	%r13d, 36(%rax)	# _1168, MEM[(u32 *)v_1(D) + 36B]
+	.loc 1 58 2461 is_stmt 1 view .LVU3131
+.LVL557:
+.LBB1901:
+.LBI1901:
+	.loc 1 5 19 view .LVU3132
+.LBB1902:
+	.loc 1 5 44 view .LVU3133
+# blake2s-generic.c:5: static inline u32 ror(unsigned l, u32 x) { return (x >> l) | (x << (32-l)); }
+	.loc 1 5 60 is_stmt 0 view .LVU3134
+	rorl	$7, %r11d	#, _1170
+.LVL558:
+	.loc 1 5 60 view .LVU3135
+.LBE1902:
+.LBE1901:
+# blake2s-generic.c:58:     FULLROUND(8);
+	.loc 1 58 2469 view .LVU3136
+	movl	%r11d, 16(%rax)	# _1170, MEM[(u32 *)v_1(D) + 16B]
+	.loc 1 58 2201 is_stmt 1 view .LVU3137
+	.loc 1 58 8 view .LVU3138
+	.loc 1 59 5 view .LVU3139
+	.loc 1 59 10 view .LVU3140
+	.loc 1 59 15 view .LVU3141
+# blake2s-generic.c:59:     FULLROUND(9);
+	.loc 1 59 23 is_stmt 0 view .LVU3142
+	addl	40(%r9), %r8d	# MEM[(const u32 *)m_4(D) + 40B], tmp1964
+	addl	%r11d, %r8d	# _1170, _1173
+# blake2s-generic.c:59:     FULLROUND(9);
+	.loc 1 59 76 view .LVU3143
+	xorl	%r8d, %edi	# _1173, tmp1966
+# blake2s-generic.c:59:     FULLROUND(9);
+	.loc 1 59 23 view .LVU3144
+	movl	%r8d, (%rax)	# _1173, *v_1(D)
+	.loc 1 59 66 is_stmt 1 view .LVU3145
+.LVL559:
+.LBB1903:
+.LBI1903:
+	.loc 1 5 19 view .LVU3146
+.LBB1904:
+	.loc 1 5 44 view .LVU3147
+# blake2s-generic.c:5: static inline u32 ror(unsigned l, u32 x) { return (x >> l) | (x << (32-l)); }
+	.loc 1 5 60 is_stmt 0 view .LVU3148
+	roll	$16, %edi	#, _1175
+.LVL560:
+	.loc 1 5 60 view .LVU3149
+.LBE1904:
+.LBE1903:
+# blake2s-generic.c:59:     FULLROUND(9);
+	.loc 1 59 112 view .LVU3150
+	addl	%edi, %ebx	# _1175, _1176
+# blake2s-generic.c:59:     FULLROUND(9);
+	.loc 1 59 74 view .LVU3151
+	movl	%edi, 48(%rax)	# _1175, MEM[(u32 *)v_1(D) + 48B]
+	.loc 1 59 104 is_stmt 1 view .LVU3152
+# blake2s-generic.c:59:     FULLROUND(9);
+	.loc 1 59 134 is_stmt 0 view .LVU3153
+	xorl	%ebx, %r11d	# _1176, tmp1967
+# blake2s-generic.c:59:     FULLROUND(9);
+	.loc 1 59 112 view .LVU3154
+	movl	%ebx, 32(%rax)	# _1176, MEM[(u32 *)v_1(D) + 32B]
+	.loc 1 59 124 is_stmt 1 view .LVU3155
+.LVL561:
+.LBB1905:
+.LBI1905:
+	.loc 1 5 19 view .LVU3156
+.LBB1906:
+	.loc 1 5 44 view .LVU3157
+# blake2s-generic.c:5: static inline u32 ror(unsigned l, u32 x) { return (x >> l) | (x << (32-l)); }
+	.loc 1 5 60 is_stmt 0 view .LVU3158
+	rorl	$12, %r11d	#, _1178
+.LVL562:
+	.loc 1 5 60 view .LVU3159
+.LBE1906:
+.LBE1905:
+# blake2s-generic.c:59:     FULLROUND(9);
+	.loc 1 59 132 view .LVU3160
+	movl	%r11d, 16(%rax)	# _1178, MEM[(u32 *)v_1(D) + 16B]
+	.loc 1 59 162 is_stmt 1 view .LVU3161
+# blake2s-generic.c:59:     FULLROUND(9);
+	.loc 1 59 170 is_stmt 0 view .LVU3162
+	addl	8(%r9), %r8d	# MEM[(const u32 *)m_4(D) + 8B], tmp1968
+	addl	%r11d, %r8d	# _1178, _1181
+# blake2s-generic.c:59:     FULLROUND(9);
+	.loc 1 59 223 view .LVU3163
+	xorl	%r8d, %edi	# _1181, tmp1970
+# blake2s-generic.c:59:     FULLROUND(9);
+	.loc 1 59 170 view .LVU3164
+	movl	%r8d, (%rax)	# _1181, *v_1(D)
+	.loc 1 59 213 is_stmt 1 view .LVU3165
+.LVL563:
+.LBB1907:
+.LBI1907:
+	.loc 1 5 19 view .LVU3166
+.LBB1908:
+	.loc 1 5 44 view .LVU3167
+# blake2s-generic.c:5: static inline u32 ror(unsigned l, u32 x) { return (x >> l) | (x << (32-l)); }
+	.loc 1 5 60 is_stmt 0 view .LVU3168
+	rorl	$8, %edi	#, tmp1970
+.LBE1908:
+.LBE1907:
+# blake2s-generic.c:59:     FULLROUND(9);
+	.loc 1 59 259 view .LVU3169
+	leal	(%rbx,%rdi), %r12d	#, _1184
+# blake2s-generic.c:59:     FULLROUND(9);
+	.loc 1 59 335 view .LVU3170
+	movl	-8(%rsp), %ebx	# %sfp, _1122
+# blake2s-generic.c:59:     FULLROUND(9);
+	.loc 1 59 221 view .LVU3171
+	movl	%edi, 48(%rax)	# _1183, MEM[(u32 *)v_1(D) + 48B]
+	.loc 1 59 251 is_stmt 1 view .LVU3172
+# blake2s-generic.c:59:     FULLROUND(9);
+	.loc 1 59 281 is_stmt 0 view .LVU3173
+	xorl	%r12d, %r11d	# _1184, tmp1971
+# blake2s-generic.c:59:     FULLROUND(9);
+	.loc 1 59 259 view .LVU3174
+	movl	%r12d, 32(%rax)	# _1184, MEM[(u32 *)v_1(D) + 32B]
+	.loc 1 59 271 is_stmt 1 view .LVU3175
+.LVL564:
+.LBB1909:
+.LBI1909:
+	.loc 1 5 19 view .LVU3176
+.LBB1910:
+	.loc 1 5 44 view .LVU3177
+# blake2s-generic.c:5: static inline u32 ror(unsigned l, u32 x) { return (x >> l) | (x << (32-l)); }
+	.loc 1 5 60 is_stmt 0 view .LVU3178
+	rorl	$7, %r11d	#, tmp1971
+.LBE1910:
+.LBE1909:
+# blake2s-generic.c:59:     FULLROUND(9);
+	.loc 1 59 259 view .LVU3179
+	movl	%edi, -24(%rsp)	# _1183, %sfp
+# blake2s-generic.c:59:     FULLROUND(9);
+	.loc 1 59 279 view .LVU3180
+	movl	%r11d, 16(%rax)	# _1186, MEM[(u32 *)v_1(D) + 16B]
+	.loc 1 59 13 is_stmt 1 view .LVU3181
+	.loc 1 59 322 view .LVU3182
+	.loc 1 59 327 view .LVU3183
+# blake2s-generic.c:59:     FULLROUND(9);
+	.loc 1 59 335 is_stmt 0 view .LVU3184
+	addl	32(%r9), %ebp	# MEM[(const u32 *)m_4(D) + 32B], tmp1972
+	leal	0(%rbp,%rbx), %edi	#, _1189
+# blake2s-generic.c:59:     FULLROUND(9);
+	.loc 1 59 281 view .LVU3185
+	movl	%r12d, -20(%rsp)	# _1184, %sfp
+# blake2s-generic.c:59:     FULLROUND(9);
+	.loc 1 59 388 view .LVU3186
+	xorl	%edi, %ecx	# _1189, tmp1974
+# blake2s-generic.c:59:     FULLROUND(9);
+	.loc 1 59 335 view .LVU3187
+	movl	%edi, 4(%rax)	# _1189, MEM[(u32 *)v_1(D) + 4B]
+	.loc 1 59 378 is_stmt 1 view .LVU3188
+.LVL565:
+.LBB1911:
+.LBI1911:
+	.loc 1 5 19 view .LVU3189
+.LBB1912:
+	.loc 1 5 44 view .LVU3190
+# blake2s-generic.c:5: static inline u32 ror(unsigned l, u32 x) { return (x >> l) | (x << (32-l)); }
+	.loc 1 5 60 is_stmt 0 view .LVU3191
+	roll	$16, %ecx	#, _1191
+.LVL566:
+	.loc 1 5 60 view .LVU3192
+.LBE1912:
+.LBE1911:
+# blake2s-generic.c:59:     FULLROUND(9);
+	.loc 1 59 279 view .LVU3193
+	movl	%r11d, -12(%rsp)	# _1186, %sfp
+# blake2s-generic.c:59:     FULLROUND(9);
+	.loc 1 59 424 view .LVU3194
+	addl	%ecx, %r13d	# _1191, _1192
+# blake2s-generic.c:59:     FULLROUND(9);
+	.loc 1 59 386 view .LVU3195
+	movl	%ecx, 52(%rax)	# _1191, MEM[(u32 *)v_1(D) + 52B]
+	.loc 1 59 416 is_stmt 1 view .LVU3196
+# blake2s-generic.c:59:     FULLROUND(9);
+	.loc 1 59 446 is_stmt 0 view .LVU3197
+	xorl	%r13d, %ebx	# _1192, _1122
+# blake2s-generic.c:59:     FULLROUND(9);
+	.loc 1 59 424 view .LVU3198
+	movl	%r13d, 36(%rax)	# _1192, MEM[(u32 *)v_1(D) + 36B]
+	.loc 1 59 436 is_stmt 1 view .LVU3199
+.LVL567:
+.LBB1913:
+.LBI1913:
+	.loc 1 5 19 view .LVU3200
+.LBB1914:
+	.loc 1 5 44 view .LVU3201
+.LBE1914:
+.LBE1913:
+# blake2s-generic.c:59:     FULLROUND(9);
+	.loc 1 59 446 is_stmt 0 view .LVU3202
+	movl	%ebx, %r12d	# _1122, tmp1975
+# blake2s-generic.c:59:     FULLROUND(9);
+	.loc 1 59 647 view .LVU3203
+	movl	-4(%rsp), %ebx	# %sfp, _1138
+.LBB1916:
+.LBB1915:
+# blake2s-generic.c:5: static inline u32 ror(unsigned l, u32 x) { return (x >> l) | (x << (32-l)); }
+	.loc 1 5 60 view .LVU3204
+	rorl	$12, %r12d	#, _1194
+.LVL568:
+	.loc 1 5 60 view .LVU3205
+.LBE1915:
+.LBE1916:
+# blake2s-generic.c:59:     FULLROUND(9);
+	.loc 1 59 444 view .LVU3206
+	movl	%r12d, 20(%rax)	# _1194, MEM[(u32 *)v_1(D) + 20B]
+	.loc 1 59 474 is_stmt 1 view .LVU3207
+# blake2s-generic.c:59:     FULLROUND(9);
+	.loc 1 59 482 is_stmt 0 view .LVU3208
+	addl	16(%r9), %edi	# MEM[(const u32 *)m_4(D) + 16B], tmp1976
+	addl	%r12d, %edi	# _1194, _1197
+# blake2s-generic.c:59:     FULLROUND(9);
+	.loc 1 59 535 view .LVU3209
+	xorl	%edi, %ecx	# _1197, tmp1978
+# blake2s-generic.c:59:     FULLROUND(9);
+	.loc 1 59 482 view .LVU3210
+	movl	%edi, 4(%rax)	# _1197, MEM[(u32 *)v_1(D) + 4B]
+	.loc 1 59 525 is_stmt 1 view .LVU3211
+.LVL569:
+.LBB1917:
+.LBI1917:
+	.loc 1 5 19 view .LVU3212
+.LBB1918:
+	.loc 1 5 44 view .LVU3213
+# blake2s-generic.c:5: static inline u32 ror(unsigned l, u32 x) { return (x >> l) | (x << (32-l)); }
+	.loc 1 5 60 is_stmt 0 view .LVU3214
+	rorl	$8, %ecx	#, _1199
+.LVL570:
+	.loc 1 5 60 view .LVU3215
+.LBE1918:
+.LBE1917:
+# blake2s-generic.c:59:     FULLROUND(9);
+	.loc 1 59 571 view .LVU3216
+	addl	%ecx, %r13d	# _1199, _1200
+# blake2s-generic.c:59:     FULLROUND(9);
+	.loc 1 59 533 view .LVU3217
+	movl	%ecx, 52(%rax)	# _1199, MEM[(u32 *)v_1(D) + 52B]
+	.loc 1 59 563 is_stmt 1 view .LVU3218
+# blake2s-generic.c:59:     FULLROUND(9);
+	.loc 1 59 593 is_stmt 0 view .LVU3219
+	xorl	%r13d, %r12d	# _1200, tmp1979
+# blake2s-generic.c:59:     FULLROUND(9);
+	.loc 1 59 571 view .LVU3220
+	movl	%r13d, 36(%rax)	# _1200, MEM[(u32 *)v_1(D) + 36B]
+	.loc 1 59 583 is_stmt 1 view .LVU3221
+.LVL571:
+.LBB1919:
+.LBI1919:
+	.loc 1 5 19 view .LVU3222
+.LBB1920:
+	.loc 1 5 44 view .LVU3223
+# blake2s-generic.c:5: static inline u32 ror(unsigned l, u32 x) { return (x >> l) | (x << (32-l)); }
+	.loc 1 5 60 is_stmt 0 view .LVU3224
+	rorl	$7, %r12d	#, _1202
+.LVL572:
+	.loc 1 5 60 view .LVU3225
+.LBE1920:
+.LBE1919:
+# blake2s-generic.c:59:     FULLROUND(9);
+	.loc 1 59 591 view .LVU3226
+	movl	%r12d, 20(%rax)	# _1202, MEM[(u32 *)v_1(D) + 20B]
+	.loc 1 59 325 is_stmt 1 view .LVU3227
+	.loc 1 59 634 view .LVU3228
+	.loc 1 59 639 view .LVU3229
+# blake2s-generic.c:59:     FULLROUND(9);
+	.loc 1 59 647 is_stmt 0 view .LVU3230
+	addl	28(%r9), %esi	# MEM[(const u32 *)m_4(D) + 28B], tmp1980
+	addl	%ebx, %esi	# _1138, _1205
+# blake2s-generic.c:59:     FULLROUND(9);
+	.loc 1 59 700 view .LVU3231
+	xorl	%esi, %r10d	# _1205, tmp1982
+# blake2s-generic.c:59:     FULLROUND(9);
+	.loc 1 59 647 view .LVU3232
+	movl	%esi, 8(%rax)	# _1205, MEM[(u32 *)v_1(D) + 8B]
+	.loc 1 59 690 is_stmt 1 view .LVU3233
+.LVL573:
+.LBB1921:
+.LBI1921:
+	.loc 1 5 19 view .LVU3234
+.LBB1922:
+	.loc 1 5 44 view .LVU3235
+# blake2s-generic.c:5: static inline u32 ror(unsigned l, u32 x) { return (x >> l) | (x << (32-l)); }
+	.loc 1 5 60 is_stmt 0 view .LVU3236
+	roll	$16, %r10d	#, _1207
+.LVL574:
+	.loc 1 5 60 view .LVU3237
+.LBE1922:
+.LBE1921:
+# blake2s-generic.c:59:     FULLROUND(9);
+	.loc 1 59 736 view .LVU3238
+	addl	%r10d, %r15d	# _1207, _1208
+# blake2s-generic.c:59:     FULLROUND(9);
+	.loc 1 59 698 view .LVU3239
+	movl	%r10d, 56(%rax)	# _1207, MEM[(u32 *)v_1(D) + 56B]
+	.loc 1 59 728 is_stmt 1 view .LVU3240
+# blake2s-generic.c:59:     FULLROUND(9);
+	.loc 1 59 758 is_stmt 0 view .LVU3241
+	xorl	%r15d, %ebx	# _1208, _1138
+# blake2s-generic.c:59:     FULLROUND(9);
+	.loc 1 59 736 view .LVU3242
+	movl	%r15d, 40(%rax)	# _1208, MEM[(u32 *)v_1(D) + 40B]
+	.loc 1 59 748 is_stmt 1 view .LVU3243
+.LVL575:
+.LBB1923:
+.LBI1923:
+	.loc 1 5 19 view .LVU3244
+.LBB1924:
+	.loc 1 5 44 view .LVU3245
+.LBE1924:
+.LBE1923:
+# blake2s-generic.c:59:     FULLROUND(9);
+	.loc 1 59 758 is_stmt 0 view .LVU3246
+	movl	%ebx, %ebp	# _1138, tmp1983
+.LBB1926:
+.LBB1925:
+# blake2s-generic.c:5: static inline u32 ror(unsigned l, u32 x) { return (x >> l) | (x << (32-l)); }
+	.loc 1 5 60 view .LVU3247
+	rorl	$12, %ebp	#, _1210
+.LVL576:
+	.loc 1 5 60 view .LVU3248
+.LBE1925:
+.LBE1926:
+# blake2s-generic.c:59:     FULLROUND(9);
+	.loc 1 59 756 view .LVU3249
+	movl	%ebp, 24(%rax)	# _1210, MEM[(u32 *)v_1(D) + 24B]
+	.loc 1 59 786 is_stmt 1 view .LVU3250
+# blake2s-generic.c:59:     FULLROUND(9);
+	.loc 1 59 794 is_stmt 0 view .LVU3251
+	addl	24(%r9), %esi	# MEM[(const u32 *)m_4(D) + 24B], tmp1984
+	addl	%ebp, %esi	# _1210, _1213
+# blake2s-generic.c:59:     FULLROUND(9);
+	.loc 1 59 847 view .LVU3252
+	xorl	%esi, %r10d	# _1213, tmp1986
+# blake2s-generic.c:59:     FULLROUND(9);
+	.loc 1 59 794 view .LVU3253
+	movl	%esi, 8(%rax)	# _1213, MEM[(u32 *)v_1(D) + 8B]
+	.loc 1 59 837 is_stmt 1 view .LVU3254
+.LVL577:
+.LBB1927:
+.LBI1927:
+	.loc 1 5 19 view .LVU3255
+.LBB1928:
+	.loc 1 5 44 view .LVU3256
+# blake2s-generic.c:5: static inline u32 ror(unsigned l, u32 x) { return (x >> l) | (x << (32-l)); }
+	.loc 1 5 60 is_stmt 0 view .LVU3257
+	rorl	$8, %r10d	#, _1215
+.LVL578:
+	.loc 1 5 60 view .LVU3258
+.LBE1928:
+.LBE1927:
+# blake2s-generic.c:59:     FULLROUND(9);
+	.loc 1 59 883 view .LVU3259
+	addl	%r10d, %r15d	# _1215, _1216
+# blake2s-generic.c:59:     FULLROUND(9);
+	.loc 1 59 845 view .LVU3260
+	movl	%r10d, 56(%rax)	# _1215, MEM[(u32 *)v_1(D) + 56B]
+	.loc 1 59 875 is_stmt 1 view .LVU3261
+# blake2s-generic.c:59:     FULLROUND(9);
+	.loc 1 59 905 is_stmt 0 view .LVU3262
+	xorl	%r15d, %ebp	# _1216, tmp1987
+# blake2s-generic.c:59:     FULLROUND(9);
+	.loc 1 59 883 view .LVU3263
+	movl	%r15d, 40(%rax)	# _1216, MEM[(u32 *)v_1(D) + 40B]
+	.loc 1 59 895 is_stmt 1 view .LVU3264
+.LVL579:
+.LBB1929:
+.LBI1929:
+	.loc 1 5 19 view .LVU3265
+.LBB1930:
+	.loc 1 5 44 view .LVU3266
+# blake2s-generic.c:5: static inline u32 ror(unsigned l, u32 x) { return (x >> l) | (x << (32-l)); }
+	.loc 1 5 60 is_stmt 0 view .LVU3267
+	rorl	$7, %ebp	#, _1218
+.LVL580:
+	.loc 1 5 60 view .LVU3268
+.LBE1930:
+.LBE1929:
+# blake2s-generic.c:59:     FULLROUND(9);
+	.loc 1 59 903 view .LVU3269
+	movl	%ebp, 24(%rax)	# _1218, MEM[(u32 *)v_1(D) + 24B]
+	.loc 1 59 637 is_stmt 1 view .LVU3270
+	.loc 1 59 946 view .LVU3271
+	.loc 1 59 951 view .LVU3272
+# blake2s-generic.c:59:     FULLROUND(9);
+	.loc 1 59 959 is_stmt 0 view .LVU3273
+	movl	-28(%rsp), %ebx	# %sfp, _1154
+	addl	4(%r9), %edx	# MEM[(const u32 *)m_4(D) + 4B], tmp1988
+# blake2s-generic.c:59:     FULLROUND(9);
+	.loc 1 59 1012 view .LVU3274
+	movl	-16(%rsp), %r11d	# %sfp, _1119
+# blake2s-generic.c:59:     FULLROUND(9);
+	.loc 1 59 959 view .LVU3275
+	addl	%ebx, %edx	# _1154, _1221
+# blake2s-generic.c:59:     FULLROUND(9);
+	.loc 1 59 1012 view .LVU3276
+	xorl	%edx, %r11d	# _1221, _1119
+# blake2s-generic.c:59:     FULLROUND(9);
+	.loc 1 59 959 view .LVU3277
+	movl	%edx, 12(%rax)	# _1221, MEM[(u32 *)v_1(D) + 12B]
+	.loc 1 59 1002 is_stmt 1 view .LVU3278
+.LVL581:
+.LBB1931:
+.LBI1931:
+	.loc 1 5 19 view .LVU3279
+.LBB1932:
+	.loc 1 5 44 view .LVU3280
+# blake2s-generic.c:5: static inline u32 ror(unsigned l, u32 x) { return (x >> l) | (x << (32-l)); }
+	.loc 1 5 60 is_stmt 0 view .LVU3281
+	roll	$16, %r11d	#, _1223
+.LVL582:
+	.loc 1 5 60 view .LVU3282
+.LBE1932:
+.LBE1931:
+# blake2s-generic.c:59:     FULLROUND(9);
+	.loc 1 59 1048 view .LVU3283
+	addl	%r11d, %r14d	# _1223, _1224
+# blake2s-generic.c:59:     FULLROUND(9);
+	.loc 1 59 1010 view .LVU3284
+	movl	%r11d, 60(%rax)	# _1223, MEM[(u32 *)v_1(D) + 60B]
+	.loc 1 59 1040 is_stmt 1 view .LVU3285
+# blake2s-generic.c:59:     FULLROUND(9);
+	.loc 1 59 1070 is_stmt 0 view .LVU3286
+	xorl	%r14d, %ebx	# _1224, _1154
+# blake2s-generic.c:59:     FULLROUND(9);
+	.loc 1 59 1048 view .LVU3287
+	movl	%r14d, 44(%rax)	# _1224, MEM[(u32 *)v_1(D) + 44B]
+	.loc 1 59 1060 is_stmt 1 view .LVU3288
+.LVL583:
+.LBB1933:
+.LBI1933:
+	.loc 1 5 19 view .LVU3289
+.LBB1934:
+	.loc 1 5 44 view .LVU3290
+# blake2s-generic.c:5: static inline u32 ror(unsigned l, u32 x) { return (x >> l) | (x << (32-l)); }
+	.loc 1 5 60 is_stmt 0 view .LVU3291
+	rorl	$12, %ebx	#, _1226
+.LVL584:
+	.loc 1 5 60 view .LVU3292
+.LBE1934:
+.LBE1933:
+# blake2s-generic.c:59:     FULLROUND(9);
+	.loc 1 59 1068 view .LVU3293
+	movl	%ebx, 28(%rax)	# _1226, MEM[(u32 *)v_1(D) + 28B]
+	.loc 1 59 1098 is_stmt 1 view .LVU3294
+# blake2s-generic.c:59:     FULLROUND(9);
+	.loc 1 59 1106 is_stmt 0 view .LVU3295
+	addl	20(%r9), %edx	# MEM[(const u32 *)m_4(D) + 20B], tmp1992
+	addl	%ebx, %edx	# _1226, _1229
+# blake2s-generic.c:59:     FULLROUND(9);
+	.loc 1 59 1159 view .LVU3296
+	xorl	%edx, %r11d	# _1229, tmp1994
+# blake2s-generic.c:59:     FULLROUND(9);
+	.loc 1 59 1106 view .LVU3297
+	movl	%edx, 12(%rax)	# _1229, MEM[(u32 *)v_1(D) + 12B]
+	.loc 1 59 1149 is_stmt 1 view .LVU3298
+.LVL585:
+.LBB1935:
+.LBI1935:
+	.loc 1 5 19 view .LVU3299
+.LBB1936:
+	.loc 1 5 44 view .LVU3300
+# blake2s-generic.c:5: static inline u32 ror(unsigned l, u32 x) { return (x >> l) | (x << (32-l)); }
+	.loc 1 5 60 is_stmt 0 view .LVU3301
+	rorl	$8, %r11d	#, _1231
+.LVL586:
+	.loc 1 5 60 view .LVU3302
+.LBE1936:
+.LBE1935:
+# blake2s-generic.c:59:     FULLROUND(9);
+	.loc 1 59 1195 view .LVU3303
+	addl	%r11d, %r14d	# _1231, _1232
+# blake2s-generic.c:59:     FULLROUND(9);
+	.loc 1 59 1157 view .LVU3304
+	movl	%r11d, 60(%rax)	# _1231, MEM[(u32 *)v_1(D) + 60B]
+	.loc 1 59 1187 is_stmt 1 view .LVU3305
+# blake2s-generic.c:59:     FULLROUND(9);
+	.loc 1 59 1217 is_stmt 0 view .LVU3306
+	xorl	%r14d, %ebx	# _1232, tmp1995
+# blake2s-generic.c:59:     FULLROUND(9);
+	.loc 1 59 1195 view .LVU3307
+	movl	%r14d, 44(%rax)	# _1232, MEM[(u32 *)v_1(D) + 44B]
+	.loc 1 59 1207 is_stmt 1 view .LVU3308
+.LVL587:
+.LBB1937:
+.LBI1937:
+	.loc 1 5 19 view .LVU3309
+.LBB1938:
+	.loc 1 5 44 view .LVU3310
+# blake2s-generic.c:5: static inline u32 ror(unsigned l, u32 x) { return (x >> l) | (x << (32-l)); }
+	.loc 1 5 60 is_stmt 0 view .LVU3311
+	rorl	$7, %ebx	#, _1234
+.LVL588:
+	.loc 1 5 60 view .LVU3312
+.LBE1938:
+.LBE1937:
+# blake2s-generic.c:59:     FULLROUND(9);
+	.loc 1 59 1215 view .LVU3313
+	movl	%ebx, 28(%rax)	# _1234, MEM[(u32 *)v_1(D) + 28B]
+	.loc 1 59 949 is_stmt 1 view .LVU3314
+	.loc 1 59 1258 view .LVU3315
+	.loc 1 59 1263 view .LVU3316
+# blake2s-generic.c:59:     FULLROUND(9);
+	.loc 1 59 1271 is_stmt 0 view .LVU3317
+	addl	60(%r9), %r8d	# MEM[(const u32 *)m_4(D) + 60B], tmp1996
+	addl	%r12d, %r8d	# _1202, _1237
+# blake2s-generic.c:59:     FULLROUND(9);
+	.loc 1 59 1324 view .LVU3318
+	xorl	%r8d, %r11d	# _1237, tmp1998
+# blake2s-generic.c:59:     FULLROUND(9);
+	.loc 1 59 1271 view .LVU3319
+	movl	%r8d, (%rax)	# _1237, *v_1(D)
+	.loc 1 59 1314 is_stmt 1 view .LVU3320
+.LVL589:
+.LBB1939:
+.LBI1939:
+	.loc 1 5 19 view .LVU3321
+.LBB1940:
+	.loc 1 5 44 view .LVU3322
+# blake2s-generic.c:5: static inline u32 ror(unsigned l, u32 x) { return (x >> l) | (x << (32-l)); }
+	.loc 1 5 60 is_stmt 0 view .LVU3323
+	roll	$16, %r11d	#, _1239
+.LVL590:
+	.loc 1 5 60 view .LVU3324
+.LBE1940:
+.LBE1939:
+# blake2s-generic.c:59:     FULLROUND(9);
+	.loc 1 59 1360 view .LVU3325
+	addl	%r11d, %r15d	# _1239, _1240
+# blake2s-generic.c:59:     FULLROUND(9);
+	.loc 1 59 1322 view .LVU3326
+	movl	%r11d, 60(%rax)	# _1239, MEM[(u32 *)v_1(D) + 60B]
+	.loc 1 59 1352 is_stmt 1 view .LVU3327
+# blake2s-generic.c:59:     FULLROUND(9);
+	.loc 1 59 1382 is_stmt 0 view .LVU3328
+	xorl	%r15d, %r12d	# _1240, tmp1999
+# blake2s-generic.c:59:     FULLROUND(9);
+	.loc 1 59 1360 view .LVU3329
+	movl	%r15d, 40(%rax)	# _1240, MEM[(u32 *)v_1(D) + 40B]
+	.loc 1 59 1372 is_stmt 1 view .LVU3330
+.LVL591:
+.LBB1941:
+.LBI1941:
+	.loc 1 5 19 view .LVU3331
+.LBB1942:
+	.loc 1 5 44 view .LVU3332
+# blake2s-generic.c:5: static inline u32 ror(unsigned l, u32 x) { return (x >> l) | (x << (32-l)); }
+	.loc 1 5 60 is_stmt 0 view .LVU3333
+	rorl	$12, %r12d	#, _1242
+.LVL592:
+	.loc 1 5 60 view .LVU3334
+.LBE1942:
+.LBE1941:
+# blake2s-generic.c:59:     FULLROUND(9);
+	.loc 1 59 1380 view .LVU3335
+	movl	%r12d, 20(%rax)	# _1242, MEM[(u32 *)v_1(D) + 20B]
+	.loc 1 59 1410 is_stmt 1 view .LVU3336
+# blake2s-generic.c:59:     FULLROUND(9);
+	.loc 1 59 1418 is_stmt 0 view .LVU3337
+	addl	44(%r9), %r8d	# MEM[(const u32 *)m_4(D) + 44B], tmp2000
+	addl	%r12d, %r8d	# _1242, _1245
+# blake2s-generic.c:59:     FULLROUND(9);
+	.loc 1 59 1471 view .LVU3338
+	xorl	%r8d, %r11d	# _1245, tmp2002
+# blake2s-generic.c:59:     FULLROUND(9);
+	.loc 1 59 1418 view .LVU3339
+	movl	%r8d, (%rax)	# _1245, *v_1(D)
+	.loc 1 59 1461 is_stmt 1 view .LVU3340
+.LVL593:
+.LBB1943:
+.LBI1943:
+	.loc 1 5 19 view .LVU3341
+.LBB1944:
+	.loc 1 5 44 view .LVU3342
+.LBE1944:
+.LBE1943:
+# blake2s-generic.c:59:     FULLROUND(9);
+	.loc 1 59 1637 is_stmt 0 view .LVU3343
+	movl	-24(%rsp), %r8d	# %sfp, _1183
+.LBB1946:
+.LBB1945:
+# blake2s-generic.c:5: static inline u32 ror(unsigned l, u32 x) { return (x >> l) | (x << (32-l)); }
+	.loc 1 5 60 view .LVU3344
+	rorl	$8, %r11d	#, _1247
+.LVL594:
+	.loc 1 5 60 view .LVU3345
+.LBE1945:
+.LBE1946:
+# blake2s-generic.c:59:     FULLROUND(9);
+	.loc 1 59 1507 view .LVU3346
+	addl	%r11d, %r15d	# _1247, _1248
+# blake2s-generic.c:59:     FULLROUND(9);
+	.loc 1 59 1469 view .LVU3347
+	movl	%r11d, 60(%rax)	# _1247, MEM[(u32 *)v_1(D) + 60B]
+	.loc 1 59 1499 is_stmt 1 view .LVU3348
+# blake2s-generic.c:59:     FULLROUND(9);
+	.loc 1 59 1529 is_stmt 0 view .LVU3349
+	xorl	%r15d, %r12d	# _1248, tmp2003
+# blake2s-generic.c:59:     FULLROUND(9);
+	.loc 1 59 1507 view .LVU3350
+	movl	%r15d, 40(%rax)	# _1248, MEM[(u32 *)v_1(D) + 40B]
+	.loc 1 59 1519 is_stmt 1 view .LVU3351
+.LVL595:
+.LBB1947:
+.LBI1947:
+	.loc 1 5 19 view .LVU3352
+.LBB1948:
+	.loc 1 5 44 view .LVU3353
+# blake2s-generic.c:5: static inline u32 ror(unsigned l, u32 x) { return (x >> l) | (x << (32-l)); }
+	.loc 1 5 60 is_stmt 0 view .LVU3354
+	rorl	$7, %r12d	#, tmp2004
+	movl	%r12d, 20(%rax)	# tmp2004, MEM[(u32 *)v_1(D) + 20B]
+.LBE1948:
+.LBE1947:
+	.loc 1 59 1261 is_stmt 1 view .LVU3355
+	.loc 1 59 1570 view .LVU3356
+	.loc 1 59 1575 view .LVU3357
+# blake2s-generic.c:59:     FULLROUND(9);
+	.loc 1 59 1583 is_stmt 0 view .LVU3358
+	addl	36(%r9), %edi	# MEM[(const u32 *)m_4(D) + 36B], tmp2005
+	addl	%ebp, %edi	# _1218, _1253
+# blake2s-generic.c:59:     FULLROUND(9);
+	.loc 1 59 1637 view .LVU3359
+	xorl	%edi, %r8d	# _1253, _1183
+# blake2s-generic.c:59:     FULLROUND(9);
+	.loc 1 59 1583 view .LVU3360
+	movl	%edi, 4(%rax)	# _1253, MEM[(u32 *)v_1(D) + 4B]
+	.loc 1 59 1627 is_stmt 1 view .LVU3361
+.LVL596:
+.LBB1949:
+.LBI1949:
+	.loc 1 5 19 view .LVU3362
+.LBB1950:
+	.loc 1 5 44 view .LVU3363
+# blake2s-generic.c:5: static inline u32 ror(unsigned l, u32 x) { return (x >> l) | (x << (32-l)); }
+	.loc 1 5 60 is_stmt 0 view .LVU3364
+	roll	$16, %r8d	#, _1255
+.LVL597:
+	.loc 1 5 60 view .LVU3365
+.LBE1950:
+.LBE1949:
+# blake2s-generic.c:59:     FULLROUND(9);
+	.loc 1 59 1673 view .LVU3366
+	addl	%r8d, %r14d	# _1255, _1256
+# blake2s-generic.c:59:     FULLROUND(9);
+	.loc 1 59 1635 view .LVU3367
+	movl	%r8d, 48(%rax)	# _1255, MEM[(u32 *)v_1(D) + 48B]
+	.loc 1 59 1665 is_stmt 1 view .LVU3368
+# blake2s-generic.c:59:     FULLROUND(9);
+	.loc 1 59 1695 is_stmt 0 view .LVU3369
+	xorl	%r14d, %ebp	# _1256, tmp2008
+# blake2s-generic.c:59:     FULLROUND(9);
+	.loc 1 59 1673 view .LVU3370
+	movl	%r14d, 44(%rax)	# _1256, MEM[(u32 *)v_1(D) + 44B]
+	.loc 1 59 1685 is_stmt 1 view .LVU3371
+.LVL598:
+.LBB1951:
+.LBI1951:
+	.loc 1 5 19 view .LVU3372
+.LBB1952:
+	.loc 1 5 44 view .LVU3373
+# blake2s-generic.c:5: static inline u32 ror(unsigned l, u32 x) { return (x >> l) | (x << (32-l)); }
+	.loc 1 5 60 is_stmt 0 view .LVU3374
+	rorl	$12, %ebp	#, _1258
+.LVL599:
+	.loc 1 5 60 view .LVU3375
+.LBE1952:
+.LBE1951:
+# blake2s-generic.c:59:     FULLROUND(9);
+	.loc 1 59 1693 view .LVU3376
+	movl	%ebp, 24(%rax)	# _1258, MEM[(u32 *)v_1(D) + 24B]
+	.loc 1 59 1723 is_stmt 1 view .LVU3377
+# blake2s-generic.c:59:     FULLROUND(9);
+	.loc 1 59 1731 is_stmt 0 view .LVU3378
+	addl	56(%r9), %edi	# MEM[(const u32 *)m_4(D) + 56B], tmp2009
+	addl	%ebp, %edi	# _1258, _1261
+# blake2s-generic.c:59:     FULLROUND(9);
+	.loc 1 59 1785 view .LVU3379
+	xorl	%edi, %r8d	# _1261, tmp2011
+# blake2s-generic.c:59:     FULLROUND(9);
+	.loc 1 59 1731 view .LVU3380
+	movl	%edi, 4(%rax)	# _1261, MEM[(u32 *)v_1(D) + 4B]
+	.loc 1 59 1775 is_stmt 1 view .LVU3381
+.LVL600:
+.LBB1953:
+.LBI1953:
+	.loc 1 5 19 view .LVU3382
+.LBB1954:
+	.loc 1 5 44 view .LVU3383
+# blake2s-generic.c:5: static inline u32 ror(unsigned l, u32 x) { return (x >> l) | (x << (32-l)); }
+	.loc 1 5 60 is_stmt 0 view .LVU3384
+	rorl	$8, %r8d	#, _1263
+.LVL601:
+	.loc 1 5 60 view .LVU3385
+.LBE1954:
+.LBE1953:
+# blake2s-generic.c:59:     FULLROUND(9);
+	.loc 1 59 1821 view .LVU3386
+	addl	%r8d, %r14d	# _1263, _1264
+# blake2s-generic.c:59:     FULLROUND(9);
+	.loc 1 59 1783 view .LVU3387
+	movl	%r8d, 48(%rax)	# _1263, MEM[(u32 *)v_1(D) + 48B]
+	.loc 1 59 1813 is_stmt 1 view .LVU3388
+# blake2s-generic.c:59:     FULLROUND(9);
+	.loc 1 59 1843 is_stmt 0 view .LVU3389
+	xorl	%r14d, %ebp	# _1264, tmp2012
+# blake2s-generic.c:59:     FULLROUND(9);
+	.loc 1 59 1821 view .LVU3390
+	movl	%r14d, 44(%rax)	# _1264, MEM[(u32 *)v_1(D) + 44B]
+	.loc 1 59 1833 is_stmt 1 view .LVU3391
+.LVL602:
+.LBB1955:
+.LBI1955:
+	.loc 1 5 19 view .LVU3392
+.LBB1956:
+	.loc 1 5 44 view .LVU3393
+# blake2s-generic.c:5: static inline u32 ror(unsigned l, u32 x) { return (x >> l) | (x << (32-l)); }
+	.loc 1 5 60 is_stmt 0 view .LVU3394
+	rorl	$7, %ebp	#, tmp2013
+	movl	%ebp, 24(%rax)	# tmp2013, MEM[(u32 *)v_1(D) + 24B]
+.LBE1956:
+.LBE1955:
+	.loc 1 59 1573 is_stmt 1 view .LVU3395
+	.loc 1 59 1884 view .LVU3396
+	.loc 1 59 1889 view .LVU3397
+# blake2s-generic.c:59:     FULLROUND(9);
+	.loc 1 59 1897 is_stmt 0 view .LVU3398
+	addl	12(%r9), %esi	# MEM[(const u32 *)m_4(D) + 12B], tmp2014
+	addl	%ebx, %esi	# _1234, _1269
+# blake2s-generic.c:59:     FULLROUND(9);
+	.loc 1 59 1987 view .LVU3399
+	movl	-20(%rsp), %r12d	# %sfp, _1184
+# blake2s-generic.c:59:     FULLROUND(9);
+	.loc 1 59 1951 view .LVU3400
+	xorl	%esi, %ecx	# _1269, tmp2016
+# blake2s-generic.c:59:     FULLROUND(9);
+	.loc 1 59 1897 view .LVU3401
+	movl	%esi, 8(%rax)	# _1269, MEM[(u32 *)v_1(D) + 8B]
+	.loc 1 59 1941 is_stmt 1 view .LVU3402
+.LVL603:
+.LBB1957:
+.LBI1957:
+	.loc 1 5 19 view .LVU3403
+.LBB1958:
+	.loc 1 5 44 view .LVU3404
+# blake2s-generic.c:5: static inline u32 ror(unsigned l, u32 x) { return (x >> l) | (x << (32-l)); }
+	.loc 1 5 60 is_stmt 0 view .LVU3405
+	roll	$16, %ecx	#, _1271
+.LVL604:
+	.loc 1 5 60 view .LVU3406
+.LBE1958:
+.LBE1957:
+# blake2s-generic.c:59:     FULLROUND(9);
+	.loc 1 59 1987 view .LVU3407
+	leal	(%r12,%rcx), %edi	#, _1272
+# blake2s-generic.c:59:     FULLROUND(9);
+	.loc 1 59 1949 view .LVU3408
+	movl	%ecx, 52(%rax)	# _1271, MEM[(u32 *)v_1(D) + 52B]
+	.loc 1 59 1979 is_stmt 1 view .LVU3409
+# blake2s-generic.c:59:     FULLROUND(9);
+	.loc 1 59 2009 is_stmt 0 view .LVU3410
+	xorl	%edi, %ebx	# _1272, tmp2017
+# blake2s-generic.c:59:     FULLROUND(9);
+	.loc 1 59 1987 view .LVU3411
+	movl	%edi, 32(%rax)	# _1272, MEM[(u32 *)v_1(D) + 32B]
+	.loc 1 59 1999 is_stmt 1 view .LVU3412
+.LVL605:
+.LBB1959:
+.LBI1959:
+	.loc 1 5 19 view .LVU3413
+.LBB1960:
+	.loc 1 5 44 view .LVU3414
+# blake2s-generic.c:5: static inline u32 ror(unsigned l, u32 x) { return (x >> l) | (x << (32-l)); }
+	.loc 1 5 60 is_stmt 0 view .LVU3415
+	rorl	$12, %ebx	#, _1274
+.LVL606:
+	.loc 1 5 60 view .LVU3416
+.LBE1960:
+.LBE1959:
+# blake2s-generic.c:59:     FULLROUND(9);
+	.loc 1 59 2007 view .LVU3417
+	movl	%ebx, 28(%rax)	# _1274, MEM[(u32 *)v_1(D) + 28B]
+	.loc 1 59 2037 is_stmt 1 view .LVU3418
+# blake2s-generic.c:59:     FULLROUND(9);
+	.loc 1 59 2045 is_stmt 0 view .LVU3419
+	addl	48(%r9), %esi	# MEM[(const u32 *)m_4(D) + 48B], tmp2018
+	addl	%ebx, %esi	# _1274, _1277
+# blake2s-generic.c:59:     FULLROUND(9);
+	.loc 1 59 2099 view .LVU3420
+	xorl	%esi, %ecx	# _1277, tmp2020
+# blake2s-generic.c:59:     FULLROUND(9);
+	.loc 1 59 2045 view .LVU3421
+	movl	%esi, 8(%rax)	# _1277, MEM[(u32 *)v_1(D) + 8B]
+	.loc 1 59 2089 is_stmt 1 view .LVU3422
+.LVL607:
+.LBB1961:
+.LBI1961:
+	.loc 1 5 19 view .LVU3423
+.LBB1962:
+	.loc 1 5 44 view .LVU3424
+.LBE1962:
+.LBE1961:
+# blake2s-generic.c:59:     FULLROUND(9);
+	.loc 1 59 2211 is_stmt 0 view .LVU3425
+	movl	-12(%rsp), %esi	# %sfp, _1186
+.LBB1964:
+.LBB1963:
+# blake2s-generic.c:5: static inline u32 ror(unsigned l, u32 x) { return (x >> l) | (x << (32-l)); }
+	.loc 1 5 60 view .LVU3426
+	rorl	$8, %ecx	#, _1279
+.LVL608:
+	.loc 1 5 60 view .LVU3427
+.LBE1963:
+.LBE1964:
+# blake2s-generic.c:59:     FULLROUND(9);
+	.loc 1 59 2135 view .LVU3428
+	addl	%ecx, %edi	# _1279, _1280
+# blake2s-generic.c:59:     FULLROUND(9);
+	.loc 1 59 2097 view .LVU3429
+	movl	%ecx, 52(%rax)	# _1279, MEM[(u32 *)v_1(D) + 52B]
+	.loc 1 59 2127 is_stmt 1 view .LVU3430
+# blake2s-generic.c:59:     FULLROUND(9);
+	.loc 1 59 2323 is_stmt 0 view .LVU3431
+	movl	%esi, %ecx	# _1186, _1186
+# blake2s-generic.c:59:     FULLROUND(9);
+	.loc 1 59 2157 view .LVU3432
+	xorl	%edi, %ebx	# _1280, tmp2021
+# blake2s-generic.c:59:     FULLROUND(9);
+	.loc 1 59 2135 view .LVU3433
+	movl	%edi, 32(%rax)	# _1280, MEM[(u32 *)v_1(D) + 32B]
+	.loc 1 59 2147 is_stmt 1 view .LVU3434
+.LVL609:
+.LBB1965:
+.LBI1965:
+	.loc 1 5 19 view .LVU3435
+.LBB1966:
+	.loc 1 5 44 view .LVU3436
+# blake2s-generic.c:5: static inline u32 ror(unsigned l, u32 x) { return (x >> l) | (x << (32-l)); }
+	.loc 1 5 60 is_stmt 0 view .LVU3437
+	rorl	$7, %ebx	#, tmp2022
+	movl	%ebx, 28(%rax)	# tmp2022, MEM[(u32 *)v_1(D) + 28B]
+.LBE1966:
+.LBE1965:
+	.loc 1 59 1887 is_stmt 1 view .LVU3438
+	.loc 1 59 2198 view .LVU3439
+	.loc 1 59 2203 view .LVU3440
+# blake2s-generic.c:59:     FULLROUND(9);
+	.loc 1 59 2211 is_stmt 0 view .LVU3441
+	addl	52(%r9), %edx	# MEM[(const u32 *)m_4(D) + 52B], tmp2023
+	addl	%esi, %edx	# _1186, _1285
+# blake2s-generic.c:60: }
+	.loc 1 60 1 view .LVU3442
+	popq	%rbx	#
+	.cfi_def_cfa_offset 48
+	popq	%rbp	#
+	.cfi_def_cfa_offset 40
+# blake2s-generic.c:59:     FULLROUND(9);
+	.loc 1 59 2265 view .LVU3443
+	xorl	%edx, %r10d	# _1285, tmp2025
+# blake2s-generic.c:59:     FULLROUND(9);
+	.loc 1 59 2211 view .LVU3444
+	movl	%edx, 12(%rax)	# _1285, MEM[(u32 *)v_1(D) + 12B]
+	.loc 1 59 2255 is_stmt 1 view .LVU3445
+.LVL610:
+.LBB1967:
+.LBI1967:
+	.loc 1 5 19 view .LVU3446
+.LBB1968:
+	.loc 1 5 44 view .LVU3447
+.LBE1968:
+.LBE1967:
+# blake2s-generic.c:60: }
+	.loc 1 60 1 is_stmt 0 view .LVU3448
+	popq	%r12	#
+	.cfi_def_cfa_offset 32
+.LBB1970:
+.LBB1969:
+# blake2s-generic.c:5: static inline u32 ror(unsigned l, u32 x) { return (x >> l) | (x << (32-l)); }
+	.loc 1 5 60 view .LVU3449
+	roll	$16, %r10d	#, _1287
+.LVL611:
+	.loc 1 5 60 view .LVU3450
+.LBE1969:
+.LBE1970:
+# blake2s-generic.c:59:     FULLROUND(9);
+	.loc 1 59 2301 view .LVU3451
+	addl	%r10d, %r13d	# _1287, _1288
+# blake2s-generic.c:59:     FULLROUND(9);
+	.loc 1 59 2263 view .LVU3452
+	movl	%r10d, 56(%rax)	# _1287, MEM[(u32 *)v_1(D) + 56B]
+	.loc 1 59 2293 is_stmt 1 view .LVU3453
+# blake2s-generic.c:59:     FULLROUND(9);
+	.loc 1 59 2323 is_stmt 0 view .LVU3454
+	xorl	%r13d, %ecx	# _1288, _1186
+# blake2s-generic.c:59:     FULLROUND(9);
+	.loc 1 59 2301 view .LVU3455
+	movl	%r13d, 36(%rax)	# _1288, MEM[(u32 *)v_1(D) + 36B]
+	.loc 1 59 2313 is_stmt 1 view .LVU3456
+.LVL612:
+.LBB1971:
+.LBI1971:
+	.loc 1 5 19 view .LVU3457
+.LBB1972:
+	.loc 1 5 44 view .LVU3458
+# blake2s-generic.c:5: static inline u32 ror(unsigned l, u32 x) { return (x >> l) | (x << (32-l)); }
+	.loc 1 5 60 is_stmt 0 view .LVU3459
+	rorl	$12, %ecx	#, _1290
+.LVL613:
+	.loc 1 5 60 view .LVU3460
+.LBE1972:
+.LBE1971:
+# blake2s-generic.c:59:     FULLROUND(9);
+	.loc 1 59 2321 view .LVU3461
+	movl	%ecx, 16(%rax)	# _1290, MEM[(u32 *)v_1(D) + 16B]
+	.loc 1 59 2351 is_stmt 1 view .LVU3462
+# blake2s-generic.c:59:     FULLROUND(9);
+	.loc 1 59 2359 is_stmt 0 view .LVU3463
+	addl	(%r9), %edx	# *m_4(D), tmp2027
+	addl	%ecx, %edx	# _1290, _1293
+# blake2s-generic.c:59:     FULLROUND(9);
+	.loc 1 59 2413 view .LVU3464
+	xorl	%edx, %r10d	# _1293, tmp2029
+# blake2s-generic.c:59:     FULLROUND(9);
+	.loc 1 59 2359 view .LVU3465
+	movl	%edx, 12(%rax)	# _1293, MEM[(u32 *)v_1(D) + 12B]
+	.loc 1 59 2403 is_stmt 1 view .LVU3466
+.LVL614:
+.LBB1973:
+.LBI1973:
+	.loc 1 5 19 view .LVU3467
+.LBB1974:
+	.loc 1 5 44 view .LVU3468
+# blake2s-generic.c:5: static inline u32 ror(unsigned l, u32 x) { return (x >> l) | (x << (32-l)); }
+	.loc 1 5 60 is_stmt 0 view .LVU3469
+	rorl	$8, %r10d	#, _1295
+.LVL615:
+	.loc 1 5 60 view .LVU3470
+.LBE1974:
+.LBE1973:
+# blake2s-generic.c:59:     FULLROUND(9);
+	.loc 1 59 2449 view .LVU3471
+	addl	%r10d, %r13d	# _1295, _1296
+# blake2s-generic.c:59:     FULLROUND(9);
+	.loc 1 59 2411 view .LVU3472
+	movl	%r10d, 56(%rax)	# _1295, MEM[(u32 *)v_1(D) + 56B]
+	.loc 1 59 2441 is_stmt 1 view .LVU3473
+# blake2s-generic.c:59:     FULLROUND(9);
+	.loc 1 59 2471 is_stmt 0 view .LVU3474
+	xorl	%r13d, %ecx	# _1296, tmp2030
+# blake2s-generic.c:59:     FULLROUND(9);
+	.loc 1 59 2449 view .LVU3475
+	movl	%r13d, 36(%rax)	# _1296, MEM[(u32 *)v_1(D) + 36B]
+	.loc 1 59 2461 is_stmt 1 view .LVU3476
+.LVL616:
+.LBB1975:
+.LBI1975:
+	.loc 1 5 19 view .LVU3477
+.LBB1976:
+	.loc 1 5 44 view .LVU3478
+	.loc 1 5 44 is_stmt 0 view .LVU3479
+.LBE1976:
+.LBE1975:
+# blake2s-generic.c:60: }
+	.loc 1 60 1 view .LVU3480
+	popq	%r13	#
+	.cfi_def_cfa_offset 24
+.LBB1979:
+.LBB1977:
+# blake2s-generic.c:5: static inline u32 ror(unsigned l, u32 x) { return (x >> l) | (x << (32-l)); }
+	.loc 1 5 60 view .LVU3481
+	rorl	$7, %ecx	#, tmp2031
+.LBE1977:
+.LBE1979:
+# blake2s-generic.c:60: }
+	.loc 1 60 1 view .LVU3482
+	popq	%r14	#
+	.cfi_def_cfa_offset 16
+	popq	%r15	#
+	.cfi_def_cfa_offset 8
+.LBB1980:
+.LBB1978:
+# blake2s-generic.c:5: static inline u32 ror(unsigned l, u32 x) { return (x >> l) | (x << (32-l)); }
+	.loc 1 5 60 view .LVU3483
+	movl	%ecx, 16(%rax)	# tmp2031, MEM[(u32 *)v_1(D) + 16B]
+.LBE1978:
+.LBE1980:
+	.loc 1 59 2201 is_stmt 1 view .LVU3484
+	.loc 1 59 8 view .LVU3485
+# blake2s-generic.c:60: }
+	.loc 1 60 1 is_stmt 0 view .LVU3486
+	ret	
+	.cfi_endproc
+.LFE23:
+	.size	blake2s_10rounds.constprop.0, .-blake2s_10rounds.constprop.0
+	.p2align 4
+	.globl	blake2s_compress_generic
+	.type	blake2s_compress_generic, @function
+blake2s_compress_generic:
+.LVL617:
+.LFB21:
+	.loc 1 89 1 is_stmt 1 view -0
+	.cfi_startproc
+	.loc 1 90 5 view .LVU3488
+# blake2s-generic.c:89: {
+	.loc 1 89 1 is_stmt 0 view .LVU3489
+	pushq	%rbx	#
+	.cfi_def_cfa_offset 16
+	.cfi_offset 3, -16
+	movq	%rdi, %rbx	# tmp118, ctx
+.LVL618:
+.LBB1990:
+.LBI1990:
+	.loc 1 62 20 is_stmt 1 view .LVU3490
+.LBB1991:
+	.loc 1 65 5 view .LVU3491
+	.loc 1 66 5 view .LVU3492
+	.loc 1 67 5 view .LVU3493
+.LBE1991:
+.LBE1990:
+# blake2s-generic.c:89: {
+	.loc 1 89 1 is_stmt 0 view .LVU3494
+	addq	$-128, %rsp	#,
+	.cfi_def_cfa_offset 144
+.LVL619:
+.LBB2016:
+.LBB2015:
+.LBB1992:
+.LBI1992:
+	.loc 1 7 20 is_stmt 1 view .LVU3495
+.LBB1993:
+	.loc 1 9 5 view .LVU3496
+	.loc 1 10 5 view .LVU3497
+	.loc 1 11 5 view .LVU3498
+	.loc 1 12 5 view .LVU3499
+	.loc 1 12 14 view .LVU3500
+	.loc 1 12 14 is_stmt 0 view .LVU3501
+.LBE1993:
+.LBE1992:
+# blake2s-generic.c:69:     v[ 8] = blake2s_iv[0];
+	.loc 1 69 11 view .LVU3502
+	movdqa	.LC0(%rip), %xmm0	#, tmp105
+.LBB2000:
+.LBB1994:
+# blake2s-generic.c:13:         udst[i] = read_le32(usrc + i*4);
+	.loc 1 13 17 view .LVU3503
+	movdqu	(%rsi), %xmm2	# MEM <char[1:64]> [(void *)msg_6(D)], tmp121
+	movdqu	16(%rsi), %xmm3	# MEM <char[1:64]> [(void *)msg_6(D)], tmp122
+.LBE1994:
+.LBE2000:
+.LBB2001:
+.LBB2002:
+# blake2s-internal.h:235:         udst[i] = usrc[i];
+	.file 2 "blake2s-internal.h"
+	.loc 2 235 17 view .LVU3504
+	movdqu	(%rbx), %xmm6	# MEM <char[1:32]> [(void *)ctx_4(D)], tmp125
+.LBE2002:
+.LBE2001:
+.LBB2006:
+.LBB1995:
+# blake2s-generic.c:13:         udst[i] = read_le32(usrc + i*4);
+	.loc 1 13 17 view .LVU3505
+	leaq	64(%rsp), %rax	#, tmp97
+.LVL620:
+	.loc 1 13 17 view .LVU3506
+.LBE1995:
+.LBE2006:
+.LBB2007:
+.LBB2003:
+# blake2s-internal.h:235:         udst[i] = usrc[i];
+	.loc 2 235 17 view .LVU3507
+	movq	%rsp, %rdi	#, tmp102
+.LVL621:
+	.loc 2 235 17 view .LVU3508
+.LBE2003:
+.LBE2007:
+.LBB2008:
+.LBB1996:
+# blake2s-generic.c:13:         udst[i] = read_le32(usrc + i*4);
+	.loc 1 13 17 view .LVU3509
+	movdqu	32(%rsi), %xmm4	# MEM <char[1:64]> [(void *)msg_6(D)], tmp123
+	movdqu	48(%rsi), %xmm5	# MEM <char[1:64]> [(void *)msg_6(D)], tmp124
+.LBE1996:
+.LBE2008:
+# blake2s-generic.c:69:     v[ 8] = blake2s_iv[0];
+	.loc 1 69 11 view .LVU3510
+	movaps	%xmm0, 32(%rsp)	# tmp105, MEM <vector(4) unsigned int> [(unsigned int *)&v + 32B]
+# blake2s-generic.c:78:     blake2s_10rounds(v, m);
+	.loc 1 78 5 view .LVU3511
+	movq	%rax, %rsi	# tmp97,
+.LVL622:
+.LBB2009:
+.LBB2004:
+# blake2s-internal.h:235:         udst[i] = usrc[i];
+	.loc 2 235 17 view .LVU3512
+	movdqu	16(%rbx), %xmm7	# MEM <char[1:32]> [(void *)ctx_4(D)], tmp126
+.LBE2004:
+.LBE2009:
+# blake2s-generic.c:73:     v[12] = blake2s_iv[4] ^ t[0];
+	.loc 1 73 27 view .LVU3513
+	movdqu	96(%rbx), %xmm0	# MEM <const vector(4) unsigned int> [(const u32 *)ctx_4(D) + 96B], vect__25.23
+.LBB2010:
+.LBB1997:
+# blake2s-generic.c:13:         udst[i] = read_le32(usrc + i*4);
+	.loc 1 13 17 view .LVU3514
+	movaps	%xmm2, 64(%rsp)	# tmp121, MEM <char[1:64]> [(void *)&m]
+.LBE1997:
+.LBE2010:
+# blake2s-generic.c:73:     v[12] = blake2s_iv[4] ^ t[0];
+	.loc 1 73 27 view .LVU3515
+	pxor	.LC1(%rip), %xmm0	#, vect__25.23
+.LBB2011:
+.LBB1998:
+# blake2s-generic.c:13:         udst[i] = read_le32(usrc + i*4);
+	.loc 1 13 17 view .LVU3516
+	movaps	%xmm3, 80(%rsp)	# tmp122, MEM <char[1:64]> [(void *)&m]
+	movaps	%xmm4, 96(%rsp)	# tmp123, MEM <char[1:64]> [(void *)&m]
+.LBE1998:
+.LBE2011:
+# blake2s-generic.c:73:     v[12] = blake2s_iv[4] ^ t[0];
+	.loc 1 73 11 view .LVU3517
+	movaps	%xmm0, 48(%rsp)	# vect__25.23, MEM <vector(4) unsigned int> [(unsigned int *)&v + 48B]
+.LBB2012:
+.LBB1999:
+# blake2s-generic.c:13:         udst[i] = read_le32(usrc + i*4);
+	.loc 1 13 17 view .LVU3518
+	movaps	%xmm5, 112(%rsp)	# tmp124, MEM <char[1:64]> [(void *)&m]
+.LBE1999:
+.LBE2012:
+.LBB2013:
+.LBB2005:
+# blake2s-internal.h:235:         udst[i] = usrc[i];
+	.loc 2 235 17 view .LVU3519
+	movaps	%xmm6, (%rsp)	# tmp125, MEM <char[1:32]> [(void *)&v]
+	movaps	%xmm7, 16(%rsp)	# tmp126, MEM <char[1:32]> [(void *)&v]
+.LVL623:
+	.loc 2 235 17 view .LVU3520
+.LBE2005:
+.LBE2013:
+	.loc 1 69 5 is_stmt 1 view .LVU3521
+	.loc 1 70 5 view .LVU3522
+	.loc 1 71 5 view .LVU3523
+	.loc 1 72 5 view .LVU3524
+	.loc 1 73 5 view .LVU3525
+	.loc 1 74 5 view .LVU3526
+	.loc 1 75 5 view .LVU3527
+	.loc 1 76 5 view .LVU3528
+	.loc 1 78 5 view .LVU3529
+	call	blake2s_10rounds.constprop.0	#
+.LVL624:
+	.loc 1 80 5 view .LVU3530
+.LBB2014:
+	.loc 1 80 10 view .LVU3531
+	.loc 1 80 28 view .LVU3532
+	.loc 1 81 9 view .LVU3533
+# blake2s-generic.c:81:         H[i] ^= v[i] ^ v[i+8]; i++;
+	.loc 1 81 14 is_stmt 0 view .LVU3534
+	movdqu	16(%rbx), %xmm2	# MEM <vector(4) unsigned int> [(u32 *)ctx_4(D) + 16B], tmp129
+	movdqu	(%rbx), %xmm3	# MEM <vector(4) unsigned int> [(u32 *)ctx_4(D)], tmp131
+# blake2s-generic.c:81:         H[i] ^= v[i] ^ v[i+8]; i++;
+	.loc 1 81 22 view .LVU3535
+	movdqa	16(%rsp), %xmm0	# MEM <vector(4) unsigned int> [(unsigned int *)&v + 16B], vect__101.38
+	movdqa	(%rsp), %xmm1	# MEM <vector(4) unsigned int> [(unsigned int *)&v], vect__101.38
+	pxor	48(%rsp), %xmm0	# MEM <vector(4) unsigned int> [(unsigned int *)&v + 48B], vect__101.38
+	pxor	32(%rsp), %xmm1	# MEM <vector(4) unsigned int> [(unsigned int *)&v + 32B], vect__101.38
+# blake2s-generic.c:81:         H[i] ^= v[i] ^ v[i+8]; i++;
+	.loc 1 81 14 view .LVU3536
+	pxor	%xmm2, %xmm0	# tmp129, vect__102.39
+	.loc 1 81 32 is_stmt 1 view .LVU3537
+.LVL625:
+	.loc 1 82 9 view .LVU3538
+	.loc 1 82 32 view .LVU3539
+	.loc 1 83 9 view .LVU3540
+	.loc 1 83 32 view .LVU3541
+	.loc 1 84 9 view .LVU3542
+	.loc 1 84 32 view .LVU3543
+	.loc 1 80 28 view .LVU3544
+	.loc 1 81 9 view .LVU3545
+	.loc 1 81 32 view .LVU3546
+	.loc 1 82 9 view .LVU3547
+	.loc 1 82 32 view .LVU3548
+	.loc 1 83 9 view .LVU3549
+	.loc 1 83 32 view .LVU3550
+	.loc 1 84 9 view .LVU3551
+# blake2s-generic.c:81:         H[i] ^= v[i] ^ v[i+8]; i++;
+	.loc 1 81 14 is_stmt 0 view .LVU3552
+	pxor	%xmm3, %xmm1	# tmp131, vect__102.39
+	movups	%xmm1, (%rbx)	# vect__102.39, MEM <vector(4) unsigned int> [(u32 *)ctx_4(D)]
+	movups	%xmm0, 16(%rbx)	# vect__102.39, MEM <vector(4) unsigned int> [(u32 *)ctx_4(D) + 16B]
+	.loc 1 84 32 is_stmt 1 view .LVU3553
+.LVL626:
+	.loc 1 80 28 view .LVU3554
+	.loc 1 80 28 is_stmt 0 view .LVU3555
+.LBE2014:
+.LBE2015:
+.LBE2016:
+# blake2s-generic.c:91: }
+	.loc 1 91 1 view .LVU3556
+	subq	$-128, %rsp	#,
+	.cfi_def_cfa_offset 16
+	popq	%rbx	#
+	.cfi_def_cfa_offset 8
+.LVL627:
+	.loc 1 91 1 view .LVU3557
+	ret	
+	.cfi_endproc
+.LFE21:
+	.size	blake2s_compress_generic, .-blake2s_compress_generic
+	.p2align 4
+	.globl	blake2s_compress_blocks_generic
+	.type	blake2s_compress_blocks_generic, @function
+blake2s_compress_blocks_generic:
+.LVL628:
+.LFB22:
+	.loc 1 95 1 is_stmt 1 view -0
+	.cfi_startproc
+	.loc 1 96 5 view .LVU3559
+# blake2s-generic.c:95: {
+	.loc 1 95 1 is_stmt 0 view .LVU3560
+	pushq	%r15	#
+	.cfi_def_cfa_offset 16
+	.cfi_offset 15, -16
+	pushq	%r14	#
+	.cfi_def_cfa_offset 24
+	.cfi_offset 14, -24
+	pushq	%r13	#
+	.cfi_def_cfa_offset 32
+	.cfi_offset 13, -32
+	pushq	%r12	#
+	.cfi_def_cfa_offset 40
+	.cfi_offset 12, -40
+	movq	%rsi, %r12	# tmp175, msg
+.LVL629:
+	.loc 1 97 5 is_stmt 1 view .LVU3561
+	.loc 1 98 5 view .LVU3562
+# blake2s-generic.c:95: {
+	.loc 1 95 1 is_stmt 0 view .LVU3563
+	pushq	%rbp	#
+	.cfi_def_cfa_offset 48
+	.cfi_offset 6, -48
+	pushq	%rbx	#
+	.cfi_def_cfa_offset 56
+	.cfi_offset 3, -56
+	subq	$216, %rsp	#,
+	.cfi_def_cfa_offset 272
+.LVL630:
+.LBB2030:
+.LBI2030:
+	.loc 2 229 20 is_stmt 1 view .LVU3564
+.LBB2031:
+	.loc 2 231 5 view .LVU3565
+	.loc 2 232 5 view .LVU3566
+	.loc 2 233 5 view .LVU3567
+	.loc 2 234 5 view .LVU3568
+	.loc 2 234 14 view .LVU3569
+# blake2s-internal.h:235:         udst[i] = usrc[i];
+	.loc 2 235 17 is_stmt 0 view .LVU3570
+	movdqu	(%rdi), %xmm5	# MEM <char[1:32]> [(void *)_1], MEM <char[1:32]> [(void *)_1]
+.LBE2031:
+.LBE2030:
+# blake2s-generic.c:99:     t[0] = ctx->t[0];
+	.loc 1 99 18 view .LVU3571
+	movq	96(%rdi), %xmm0	# MEM <vector(2) unsigned int> [(unsigned int *)ctx_18(D) + 96B], vect_t_0_50.96
+# blake2s-generic.c:95: {
+	.loc 1 95 1 view .LVU3572
+	movq	%rdi, 24(%rsp)	# ctx, %sfp
+# blake2s-generic.c:101:     f[0] = ctx->f[0];
+	.loc 1 101 18 view .LVU3573
+	movl	104(%rdi), %esi	# ctx_18(D)->f[0], _4
+.LVL631:
+.LBB2034:
+.LBB2032:
+# blake2s-internal.h:235:         udst[i] = usrc[i];
+	.loc 2 235 17 view .LVU3574
+	movaps	%xmm5, (%rsp)	# MEM <char[1:32]> [(void *)_1], %sfp
+	pshufd	$0xe5, %xmm0, %xmm4	# vect_t_0_50.96, t$1
+	movd	(%rsp), %xmm1	# %sfp, tmp172
+	movaps	%xmm5, 48(%rsp)	# MEM <char[1:32]> [(void *)_1], MEM <char[1:32]> [(void *)&H]
+	movdqu	16(%rdi), %xmm5	# MEM <char[1:32]> [(void *)_1], MEM <char[1:32]> [(void *)_1]
+.LBE2032:
+.LBE2034:
+# blake2s-generic.c:102:     f[1] = ctx->f[1];
+	.loc 1 102 18 view .LVU3575
+	movl	108(%rdi), %edi	# ctx_18(D)->f[1], _5
+.LVL632:
+# blake2s-generic.c:95: {
+	.loc 1 95 1 view .LVU3576
+	movq	%rdx, 40(%rsp)	# nblocks, %sfp
+.LBB2035:
+.LBB2033:
+# blake2s-internal.h:235:         udst[i] = usrc[i];
+	.loc 2 235 17 view .LVU3577
+	movaps	%xmm5, (%rsp)	# MEM <char[1:32]> [(void *)_1], %sfp
+	movaps	%xmm5, 64(%rsp)	# MEM <char[1:32]> [(void *)_1], MEM <char[1:32]> [(void *)&H]
+.LVL633:
+	.loc 2 235 17 view .LVU3578
+.LBE2033:
+.LBE2035:
+	.loc 1 99 5 is_stmt 1 view .LVU3579
+	movd	%xmm0, 36(%rsp)	# _280, %sfp
+.LVL634:
+	.loc 1 100 5 view .LVU3580
+	.loc 1 101 5 view .LVU3581
+	.loc 1 102 5 view .LVU3582
+	.loc 1 103 5 view .LVU3583
+	.loc 1 103 12 view .LVU3584
+	testq	%rdx, %rdx	# nblocks
+	je	.L7	#,
+	movd	%xmm0, %ecx	# vect_t_0_50.96, _280
+	movd	%xmm4, %ebx	# t$1, t$1
+	movd	52(%rsp), %xmm5	# MEM[(const u32 *)&H + 4B], tmp191
+	movd	60(%rsp), %xmm4	# MEM[(const u32 *)&H + 12B], tmp190
+	leaq	144(%rsp), %rax	#, tmp170
+	movd	56(%rsp), %xmm0	# MEM[(const u32 *)&H + 8B], tmp130
+	leal	64(%rcx), %r15d	#, ivtmp.101
+.LBB2036:
+.LBB2037:
+.LBB2038:
+.LBB2039:
+# blake2s-internal.h:235:         udst[i] = usrc[i];
+	.loc 2 235 23 is_stmt 0 view .LVU3585
+	movl	64(%rsp), %r14d	# MEM[(const u32 *)&H + 16B], prephitmp_138
+	movq	%rax, 16(%rsp)	# tmp170, %sfp
+	leaq	80(%rsp), %rax	#, tmp168
+	punpckldq	%xmm5, %xmm1	# tmp191, tmp133
+	movq	%rdx, %rbp	# nblocks, nblocks
+	punpckldq	%xmm4, %xmm0	# tmp190, tmp130
+	movd	%edi, %xmm5	# _5, _5
+	movd	%esi, %xmm4	# _4, tmp167
+	movq	%rax, (%rsp)	# tmp168, %sfp
+	punpckldq	%xmm5, %xmm4	# _5, tmp167
+	movq	68(%rsp), %xmm2	# MEM <const vector(2) unsigned int> [(const u32 *)&H + 20B], vect__204.88
+	movl	76(%rsp), %r13d	# MEM[(const u32 *)&H + 28B], _226
+	punpcklqdq	%xmm0, %xmm1	# tmp130, vect_prephitmp_371.70
+	movdqa	.LC0(%rip), %xmm6	#, tmp169
+	movdqa	.LC1(%rip), %xmm5	#, tmp171
+.LVL635:
+	.p2align 4,,10
+	.p2align 3
+.L8:
+	.loc 2 235 23 view .LVU3586
+.LBE2039:
+.LBE2038:
+.LBE2037:
+.LBE2036:
+	.loc 1 104 9 is_stmt 1 discriminator 2 view .LVU3587
+	.loc 1 105 9 discriminator 2 view .LVU3588
+# blake2s-generic.c:105:         t[1] += (t[0] < BLAKE2S_BLOCK);
+	.loc 1 105 23 is_stmt 0 discriminator 2 view .LVU3589
+	xorl	%esi, %esi	# tmp136
+.LBB2101:
+.LBB2095:
+.LBB2045:
+.LBB2046:
+# blake2s-generic.c:13:         udst[i] = read_le32(usrc + i*4);
+	.loc 1 13 17 discriminator 2 view .LVU3590
+	movdqu	(%r12), %xmm7	# MEM <vector(4) unsigned int> [(char * {ref-all})m_470], tmp197
+.LBE2046:
+.LBE2045:
+.LBE2095:
+.LBE2101:
+# blake2s-generic.c:105:         t[1] += (t[0] < BLAKE2S_BLOCK);
+	.loc 1 105 23 discriminator 2 view .LVU3591
+	cmpl	$63, %r15d	#, ivtmp.101
+.LBB2102:
+.LBB2096:
+# blake2s-generic.c:78:     blake2s_10rounds(v, m);
+	.loc 1 78 5 discriminator 2 view .LVU3592
+	movq	(%rsp), %rdi	# %sfp,
+.LBE2096:
+.LBE2102:
+# blake2s-generic.c:105:         t[1] += (t[0] < BLAKE2S_BLOCK);
+	.loc 1 105 23 discriminator 2 view .LVU3593
+	setbe	%sil	#, tmp136
+.LBB2103:
+.LBB2097:
+.LBB2084:
+.LBB2079:
+# blake2s-generic.c:13:         udst[i] = read_le32(usrc + i*4);
+	.loc 1 13 17 discriminator 2 view .LVU3594
+	movdqu	16(%r12), %xmm3	# MEM <vector(4) unsigned int> [(char * {ref-all})m_470 + 16B], tmp198
+.LBE2079:
+.LBE2084:
+# blake2s-generic.c:73:     v[12] = blake2s_iv[4] ^ t[0];
+	.loc 1 73 27 discriminator 2 view .LVU3595
+	movd	%r15d, %xmm0	# ivtmp.101, tmp145
+.LBB2085:
+.LBB2040:
+# blake2s-internal.h:235:         udst[i] = usrc[i];
+	.loc 2 235 17 discriminator 2 view .LVU3596
+	movl	%r14d, 96(%rsp)	# prephitmp_138, MEM[(u32 *)&v + 16B]
+.LBE2040:
+.LBE2085:
+.LBE2097:
+.LBE2103:
+# blake2s-generic.c:105:         t[1] += (t[0] < BLAKE2S_BLOCK);
+	.loc 1 105 14 discriminator 2 view .LVU3597
+	addl	%esi, %ebx	# tmp136, t$1
+.LVL636:
+	.loc 1 106 9 is_stmt 1 discriminator 2 view .LVU3598
+.LBB2104:
+.LBI2036:
+	.loc 1 62 20 discriminator 2 view .LVU3599
+.LBB2098:
+	.loc 1 65 5 discriminator 2 view .LVU3600
+	.loc 1 66 5 discriminator 2 view .LVU3601
+	.loc 1 67 5 discriminator 2 view .LVU3602
+.LBB2086:
+.LBI2045:
+	.loc 1 7 20 discriminator 2 view .LVU3603
+.LBB2080:
+	.loc 1 9 5 discriminator 2 view .LVU3604
+	.loc 1 10 5 discriminator 2 view .LVU3605
+	.loc 1 11 5 discriminator 2 view .LVU3606
+	.loc 1 12 5 discriminator 2 view .LVU3607
+	.loc 1 12 14 discriminator 2 view .LVU3608
+	.loc 1 13 9 discriminator 2 view .LVU3609
+.LBB2047:
+.LBI2047:
+	.loc 2 217 19 discriminator 2 view .LVU3610
+.LBB2048:
+	.loc 2 218 5 discriminator 2 view .LVU3611
+	.loc 2 219 5 discriminator 2 view .LVU3612
+	.loc 2 220 5 discriminator 2 view .LVU3613
+	.loc 2 220 5 is_stmt 0 discriminator 2 view .LVU3614
+.LBE2048:
+.LBE2047:
+	.loc 1 12 26 is_stmt 1 discriminator 2 view .LVU3615
+	.loc 1 12 14 discriminator 2 view .LVU3616
+	.loc 1 13 9 discriminator 2 view .LVU3617
+.LBB2064:
+	.loc 2 217 19 discriminator 2 view .LVU3618
+.LBB2049:
+	.loc 2 218 5 discriminator 2 view .LVU3619
+	.loc 2 219 5 discriminator 2 view .LVU3620
+	.loc 2 220 5 discriminator 2 view .LVU3621
+	.loc 2 220 5 is_stmt 0 discriminator 2 view .LVU3622
+.LBE2049:
+.LBE2064:
+	.loc 1 12 26 is_stmt 1 discriminator 2 view .LVU3623
+	.loc 1 12 14 discriminator 2 view .LVU3624
+	.loc 1 13 9 discriminator 2 view .LVU3625
+.LBB2065:
+	.loc 2 217 19 discriminator 2 view .LVU3626
+.LBB2050:
+	.loc 2 218 5 discriminator 2 view .LVU3627
+	.loc 2 219 5 discriminator 2 view .LVU3628
+	.loc 2 220 5 discriminator 2 view .LVU3629
+	.loc 2 220 5 is_stmt 0 discriminator 2 view .LVU3630
+.LBE2050:
+.LBE2065:
+	.loc 1 12 26 is_stmt 1 discriminator 2 view .LVU3631
+	.loc 1 12 14 discriminator 2 view .LVU3632
+	.loc 1 13 9 discriminator 2 view .LVU3633
+.LBB2066:
+	.loc 2 217 19 discriminator 2 view .LVU3634
+.LBB2051:
+	.loc 2 218 5 discriminator 2 view .LVU3635
+	.loc 2 219 5 discriminator 2 view .LVU3636
+	.loc 2 220 5 discriminator 2 view .LVU3637
+	.loc 2 220 5 is_stmt 0 discriminator 2 view .LVU3638
+.LBE2051:
+.LBE2066:
+	.loc 1 12 26 is_stmt 1 discriminator 2 view .LVU3639
+	.loc 1 12 14 discriminator 2 view .LVU3640
+	.loc 1 13 9 discriminator 2 view .LVU3641
+.LBB2067:
+	.loc 2 217 19 discriminator 2 view .LVU3642
+.LBB2052:
+	.loc 2 218 5 discriminator 2 view .LVU3643
+	.loc 2 219 5 discriminator 2 view .LVU3644
+	.loc 2 220 5 discriminator 2 view .LVU3645
+	.loc 2 220 5 is_stmt 0 discriminator 2 view .LVU3646
+.LBE2052:
+.LBE2067:
+	.loc 1 12 26 is_stmt 1 discriminator 2 view .LVU3647
+	.loc 1 12 14 discriminator 2 view .LVU3648
+	.loc 1 13 9 discriminator 2 view .LVU3649
+.LBB2068:
+	.loc 2 217 19 discriminator 2 view .LVU3650
+.LBB2053:
+	.loc 2 218 5 discriminator 2 view .LVU3651
+	.loc 2 219 5 discriminator 2 view .LVU3652
+	.loc 2 220 5 discriminator 2 view .LVU3653
+	.loc 2 220 5 is_stmt 0 discriminator 2 view .LVU3654
+.LBE2053:
+.LBE2068:
+	.loc 1 12 26 is_stmt 1 discriminator 2 view .LVU3655
+	.loc 1 12 14 discriminator 2 view .LVU3656
+	.loc 1 13 9 discriminator 2 view .LVU3657
+.LBB2069:
+	.loc 2 217 19 discriminator 2 view .LVU3658
+.LBB2054:
+	.loc 2 218 5 discriminator 2 view .LVU3659
+	.loc 2 219 5 discriminator 2 view .LVU3660
+	.loc 2 220 5 discriminator 2 view .LVU3661
+	.loc 2 220 5 is_stmt 0 discriminator 2 view .LVU3662
+.LBE2054:
+.LBE2069:
+	.loc 1 12 26 is_stmt 1 discriminator 2 view .LVU3663
+	.loc 1 12 14 discriminator 2 view .LVU3664
+	.loc 1 13 9 discriminator 2 view .LVU3665
+.LBB2070:
+	.loc 2 217 19 discriminator 2 view .LVU3666
+.LBB2055:
+	.loc 2 218 5 discriminator 2 view .LVU3667
+	.loc 2 219 5 discriminator 2 view .LVU3668
+	.loc 2 220 5 discriminator 2 view .LVU3669
+	.loc 2 220 5 is_stmt 0 discriminator 2 view .LVU3670
+.LBE2055:
+.LBE2070:
+	.loc 1 12 26 is_stmt 1 discriminator 2 view .LVU3671
+	.loc 1 12 14 discriminator 2 view .LVU3672
+	.loc 1 13 9 discriminator 2 view .LVU3673
+.LBB2071:
+	.loc 2 217 19 discriminator 2 view .LVU3674
+.LBB2056:
+	.loc 2 218 5 discriminator 2 view .LVU3675
+	.loc 2 219 5 discriminator 2 view .LVU3676
+	.loc 2 220 5 discriminator 2 view .LVU3677
+	.loc 2 220 5 is_stmt 0 discriminator 2 view .LVU3678
+.LBE2056:
+.LBE2071:
+	.loc 1 12 26 is_stmt 1 discriminator 2 view .LVU3679
+	.loc 1 12 14 discriminator 2 view .LVU3680
+	.loc 1 13 9 discriminator 2 view .LVU3681
+.LBB2072:
+	.loc 2 217 19 discriminator 2 view .LVU3682
+.LBB2057:
+	.loc 2 218 5 discriminator 2 view .LVU3683
+	.loc 2 219 5 discriminator 2 view .LVU3684
+	.loc 2 220 5 discriminator 2 view .LVU3685
+	.loc 2 220 5 is_stmt 0 discriminator 2 view .LVU3686
+.LBE2057:
+.LBE2072:
+	.loc 1 12 26 is_stmt 1 discriminator 2 view .LVU3687
+	.loc 1 12 14 discriminator 2 view .LVU3688
+	.loc 1 13 9 discriminator 2 view .LVU3689
+.LBB2073:
+	.loc 2 217 19 discriminator 2 view .LVU3690
+.LBB2058:
+	.loc 2 218 5 discriminator 2 view .LVU3691
+	.loc 2 219 5 discriminator 2 view .LVU3692
+	.loc 2 220 5 discriminator 2 view .LVU3693
+	.loc 2 220 5 is_stmt 0 discriminator 2 view .LVU3694
+.LBE2058:
+.LBE2073:
+	.loc 1 12 26 is_stmt 1 discriminator 2 view .LVU3695
+	.loc 1 12 14 discriminator 2 view .LVU3696
+	.loc 1 13 9 discriminator 2 view .LVU3697
+.LBB2074:
+	.loc 2 217 19 discriminator 2 view .LVU3698
+.LBB2059:
+	.loc 2 218 5 discriminator 2 view .LVU3699
+	.loc 2 219 5 discriminator 2 view .LVU3700
+	.loc 2 220 5 discriminator 2 view .LVU3701
+	.loc 2 220 5 is_stmt 0 discriminator 2 view .LVU3702
+.LBE2059:
+.LBE2074:
+	.loc 1 12 26 is_stmt 1 discriminator 2 view .LVU3703
+	.loc 1 12 14 discriminator 2 view .LVU3704
+	.loc 1 13 9 discriminator 2 view .LVU3705
+.LBB2075:
+	.loc 2 217 19 discriminator 2 view .LVU3706
+.LBB2060:
+	.loc 2 218 5 discriminator 2 view .LVU3707
+	.loc 2 219 5 discriminator 2 view .LVU3708
+	.loc 2 220 5 discriminator 2 view .LVU3709
+	.loc 2 220 5 is_stmt 0 discriminator 2 view .LVU3710
+.LBE2060:
+.LBE2075:
+	.loc 1 12 26 is_stmt 1 discriminator 2 view .LVU3711
+	.loc 1 12 14 discriminator 2 view .LVU3712
+	.loc 1 13 9 discriminator 2 view .LVU3713
+.LBB2076:
+	.loc 2 217 19 discriminator 2 view .LVU3714
+.LBB2061:
+	.loc 2 218 5 discriminator 2 view .LVU3715
+	.loc 2 219 5 discriminator 2 view .LVU3716
+	.loc 2 220 5 discriminator 2 view .LVU3717
+	.loc 2 220 5 is_stmt 0 discriminator 2 view .LVU3718
+.LBE2061:
+.LBE2076:
+	.loc 1 12 26 is_stmt 1 discriminator 2 view .LVU3719
+	.loc 1 12 14 discriminator 2 view .LVU3720
+	.loc 1 13 9 discriminator 2 view .LVU3721
+.LBB2077:
+	.loc 2 217 19 discriminator 2 view .LVU3722
+.LBB2062:
+	.loc 2 218 5 discriminator 2 view .LVU3723
+	.loc 2 219 5 discriminator 2 view .LVU3724
+	.loc 2 220 5 discriminator 2 view .LVU3725
+	.loc 2 220 5 is_stmt 0 discriminator 2 view .LVU3726
+.LBE2062:
+.LBE2077:
+	.loc 1 12 26 is_stmt 1 discriminator 2 view .LVU3727
+	.loc 1 12 14 discriminator 2 view .LVU3728
+	.loc 1 13 9 discriminator 2 view .LVU3729
+.LBB2078:
+	.loc 2 217 19 discriminator 2 view .LVU3730
+.LBB2063:
+	.loc 2 218 5 discriminator 2 view .LVU3731
+	.loc 2 219 5 discriminator 2 view .LVU3732
+	.loc 2 220 5 discriminator 2 view .LVU3733
+	.loc 2 220 5 is_stmt 0 discriminator 2 view .LVU3734
+.LBE2063:
+.LBE2078:
+.LBE2080:
+.LBE2086:
+# blake2s-generic.c:78:     blake2s_10rounds(v, m);
+	.loc 1 78 5 discriminator 2 view .LVU3735
+	movq	16(%rsp), %rsi	# %sfp,
+.LBB2087:
+.LBB2041:
+# blake2s-internal.h:235:         udst[i] = usrc[i];
+	.loc 2 235 17 discriminator 2 view .LVU3736
+	movl	%r13d, 108(%rsp)	# _226, MEM[(u32 *)&v + 28B]
+.LBE2041:
+.LBE2087:
+.LBE2098:
+.LBE2104:
+# blake2s-generic.c:103:     for (; nblocks; nblocks--, m += BLAKE2S_BLOCK) {
+	.loc 1 103 34 discriminator 2 view .LVU3737
+	addq	$64, %r12	#, msg
+.LVL637:
+.LBB2105:
+.LBB2099:
+.LBB2088:
+.LBB2081:
+# blake2s-generic.c:13:         udst[i] = read_le32(usrc + i*4);
+	.loc 1 13 17 discriminator 2 view .LVU3738
+	movaps	%xmm7, 144(%rsp)	# tmp197, MEM <vector(4) unsigned int> [(u32 *)&m]
+	movdqu	-32(%r12), %xmm7	# MEM <vector(4) unsigned int> [(char * {ref-all})m_470 + 32B], tmp199
+.LBE2081:
+.LBE2088:
+.LBE2099:
+.LBE2105:
+# blake2s-generic.c:103:     for (; nblocks; nblocks--, m += BLAKE2S_BLOCK) {
+	.loc 1 103 12 discriminator 2 view .LVU3739
+	addl	$64, %r15d	#, ivtmp.101
+.LVL638:
+.LBB2106:
+.LBB2100:
+.LBB2089:
+.LBB2082:
+# blake2s-generic.c:13:         udst[i] = read_le32(usrc + i*4);
+	.loc 1 13 17 discriminator 2 view .LVU3740
+	movaps	%xmm3, 160(%rsp)	# tmp198, MEM <vector(4) unsigned int> [(u32 *)&m + 16B]
+	movdqu	-16(%r12), %xmm3	# MEM <vector(4) unsigned int> [(char * {ref-all})m_470 + 48B], tmp200
+	movaps	%xmm7, 176(%rsp)	# tmp199, MEM <vector(4) unsigned int> [(u32 *)&m + 32B]
+.LBE2082:
+.LBE2089:
+# blake2s-generic.c:73:     v[12] = blake2s_iv[4] ^ t[0];
+	.loc 1 73 27 discriminator 2 view .LVU3741
+	movd	%ebx, %xmm7	# t$1, t$1
+	punpckldq	%xmm7, %xmm0	# t$1, tmp145
+.LVL639:
+.LBB2090:
+.LBB2083:
+# blake2s-generic.c:13:         udst[i] = read_le32(usrc + i*4);
+	.loc 1 13 17 discriminator 2 view .LVU3742
+	movaps	%xmm3, 192(%rsp)	# tmp200, MEM <vector(4) unsigned int> [(u32 *)&m + 48B]
+	.loc 1 12 26 is_stmt 1 discriminator 2 view .LVU3743
+.LVL640:
+	.loc 1 12 14 discriminator 2 view .LVU3744
+	.loc 1 12 14 is_stmt 0 discriminator 2 view .LVU3745
+.LBE2083:
+.LBE2090:
+.LBB2091:
+.LBB2042:
+	.loc 2 234 14 is_stmt 1 discriminator 2 view .LVU3746
+	.loc 2 235 9 discriminator 2 view .LVU3747
+	.loc 2 234 26 discriminator 2 view .LVU3748
+	.loc 2 234 14 discriminator 2 view .LVU3749
+	.loc 2 235 9 discriminator 2 view .LVU3750
+	.loc 2 234 26 discriminator 2 view .LVU3751
+	.loc 2 234 14 discriminator 2 view .LVU3752
+	.loc 2 235 9 discriminator 2 view .LVU3753
+	.loc 2 234 26 discriminator 2 view .LVU3754
+	.loc 2 234 14 discriminator 2 view .LVU3755
+	.loc 2 235 9 discriminator 2 view .LVU3756
+.LBE2042:
+.LBE2091:
+# blake2s-generic.c:73:     v[12] = blake2s_iv[4] ^ t[0];
+	.loc 1 73 27 is_stmt 0 discriminator 2 view .LVU3757
+	punpcklqdq	%xmm4, %xmm0	# tmp167, tmp143
+.LBB2092:
+.LBB2043:
+# blake2s-internal.h:235:         udst[i] = usrc[i];
+	.loc 2 235 17 discriminator 2 view .LVU3758
+	movaps	%xmm1, 80(%rsp)	# vect_prephitmp_371.70, MEM <vector(4) unsigned int> [(u32 *)&v]
+	.loc 2 234 26 is_stmt 1 discriminator 2 view .LVU3759
+.LVL641:
+	.loc 2 234 14 discriminator 2 view .LVU3760
+	.loc 2 235 9 discriminator 2 view .LVU3761
+	.loc 2 234 26 discriminator 2 view .LVU3762
+	.loc 2 234 14 discriminator 2 view .LVU3763
+	.loc 2 235 9 discriminator 2 view .LVU3764
+	.loc 2 234 26 discriminator 2 view .LVU3765
+	.loc 2 234 14 discriminator 2 view .LVU3766
+	.loc 2 235 9 discriminator 2 view .LVU3767
+.LBE2043:
+.LBE2092:
+# blake2s-generic.c:73:     v[12] = blake2s_iv[4] ^ t[0];
+	.loc 1 73 27 is_stmt 0 discriminator 2 view .LVU3768
+	pxor	%xmm5, %xmm0	# tmp171, vect__70.53
+.LBB2093:
+.LBB2044:
+# blake2s-internal.h:235:         udst[i] = usrc[i];
+	.loc 2 235 17 discriminator 2 view .LVU3769
+	movq	%xmm2, 100(%rsp)	# vect__204.88, MEM <vector(2) unsigned int> [(u32 *)&v + 20B]
+	.loc 2 234 26 is_stmt 1 discriminator 2 view .LVU3770
+.LVL642:
+	.loc 2 234 14 discriminator 2 view .LVU3771
+	.loc 2 235 9 discriminator 2 view .LVU3772
+	.loc 2 234 26 discriminator 2 view .LVU3773
+	.loc 2 234 14 discriminator 2 view .LVU3774
+	.loc 2 234 14 is_stmt 0 discriminator 2 view .LVU3775
+.LBE2044:
+.LBE2093:
+	.loc 1 69 5 is_stmt 1 discriminator 2 view .LVU3776
+	.loc 1 70 5 discriminator 2 view .LVU3777
+	.loc 1 71 5 discriminator 2 view .LVU3778
+	.loc 1 72 5 discriminator 2 view .LVU3779
+# blake2s-generic.c:73:     v[12] = blake2s_iv[4] ^ t[0];
+	.loc 1 73 11 is_stmt 0 discriminator 2 view .LVU3780
+	movaps	%xmm0, 128(%rsp)	# vect__70.53, MEM <vector(4) unsigned int> [(unsigned int *)&v + 48B]
+# blake2s-generic.c:69:     v[ 8] = blake2s_iv[0];
+	.loc 1 69 11 discriminator 2 view .LVU3781
+	movaps	%xmm6, 112(%rsp)	# tmp169, MEM <vector(4) unsigned int> [(unsigned int *)&v + 32B]
+	.loc 1 73 5 is_stmt 1 discriminator 2 view .LVU3782
+	.loc 1 74 5 discriminator 2 view .LVU3783
+	.loc 1 75 5 discriminator 2 view .LVU3784
+	.loc 1 76 5 discriminator 2 view .LVU3785
+	.loc 1 78 5 discriminator 2 view .LVU3786
+	call	blake2s_10rounds.constprop.0	#
+.LVL643:
+	.loc 1 80 5 discriminator 2 view .LVU3787
+.LBB2094:
+	.loc 1 80 10 discriminator 2 view .LVU3788
+	.loc 1 80 28 discriminator 2 view .LVU3789
+	.loc 1 81 9 discriminator 2 view .LVU3790
+# blake2s-generic.c:81:         H[i] ^= v[i] ^ v[i+8]; i++;
+	.loc 1 81 14 is_stmt 0 discriminator 2 view .LVU3791
+	movdqa	112(%rsp), %xmm0	# MEM <vector(4) unsigned int> [(unsigned int *)&v + 32B], tmp150
+	movl	96(%rsp), %esi	# v[4], v[4]
+	pxor	80(%rsp), %xmm0	# MEM <vector(4) unsigned int> [(unsigned int *)&v], tmp150
+	xorl	128(%rsp), %esi	# v[12], tmp152
+# blake2s-generic.c:82:         H[i] ^= v[i] ^ v[i+8]; i++;
+	.loc 1 82 14 discriminator 2 view .LVU3792
+	movq	132(%rsp), %xmm3	# MEM <vector(2) unsigned int> [(unsigned int *)&v + 52B], vect__202.82
+# blake2s-generic.c:81:         H[i] ^= v[i] ^ v[i+8]; i++;
+	.loc 1 81 14 discriminator 2 view .LVU3793
+	xorl	%esi, %r14d	# tmp152, prephitmp_138
+# blake2s-generic.c:84:         H[i] ^= v[i] ^ v[i+8]; i++;
+	.loc 1 84 14 discriminator 2 view .LVU3794
+	movl	108(%rsp), %esi	# v[7], v[7]
+# blake2s-generic.c:81:         H[i] ^= v[i] ^ v[i+8]; i++;
+	.loc 1 81 14 discriminator 2 view .LVU3795
+	pxor	%xmm0, %xmm1	# tmp150, vect_prephitmp_371.70
+	.loc 1 81 32 is_stmt 1 discriminator 2 view .LVU3796
+.LVL644:
+	.loc 1 82 9 discriminator 2 view .LVU3797
+	.loc 1 82 32 discriminator 2 view .LVU3798
+	.loc 1 83 9 discriminator 2 view .LVU3799
+	.loc 1 83 32 discriminator 2 view .LVU3800
+	.loc 1 84 9 discriminator 2 view .LVU3801
+# blake2s-generic.c:82:         H[i] ^= v[i] ^ v[i+8]; i++;
+	.loc 1 82 14 is_stmt 0 discriminator 2 view .LVU3802
+	movq	100(%rsp), %xmm0	# MEM <vector(2) unsigned int> [(unsigned int *)&v + 20B], vect__200.79
+# blake2s-generic.c:84:         H[i] ^= v[i] ^ v[i+8]; i++;
+	.loc 1 84 14 discriminator 2 view .LVU3803
+	xorl	140(%rsp), %esi	# v[15], tmp157
+# blake2s-generic.c:81:         H[i] ^= v[i] ^ v[i+8]; i++;
+	.loc 1 81 14 discriminator 2 view .LVU3804
+	movl	%r14d, 64(%rsp)	# prephitmp_138, MEM[(u32 *)&H + 16B]
+# blake2s-generic.c:84:         H[i] ^= v[i] ^ v[i+8]; i++;
+	.loc 1 84 14 discriminator 2 view .LVU3805
+	xorl	%esi, %r13d	# tmp157, _226
+# blake2s-generic.c:81:         H[i] ^= v[i] ^ v[i+8]; i++;
+	.loc 1 81 14 discriminator 2 view .LVU3806
+	movaps	%xmm1, 48(%rsp)	# vect_prephitmp_371.70, MEM <vector(4) unsigned int> [(u32 *)&H]
+	.loc 1 84 32 is_stmt 1 discriminator 2 view .LVU3807
+.LVL645:
+	.loc 1 80 28 discriminator 2 view .LVU3808
+	.loc 1 81 9 discriminator 2 view .LVU3809
+	.loc 1 81 32 discriminator 2 view .LVU3810
+	.loc 1 82 9 discriminator 2 view .LVU3811
+# blake2s-generic.c:82:         H[i] ^= v[i] ^ v[i+8]; i++;
+	.loc 1 82 14 is_stmt 0 discriminator 2 view .LVU3812
+	pxor	%xmm3, %xmm0	# vect__202.82, tmp156
+# blake2s-generic.c:84:         H[i] ^= v[i] ^ v[i+8]; i++;
+	.loc 1 84 14 discriminator 2 view .LVU3813
+	movl	%r13d, 76(%rsp)	# _226, MEM[(u32 *)&H + 28B]
+# blake2s-generic.c:82:         H[i] ^= v[i] ^ v[i+8]; i++;
+	.loc 1 82 14 discriminator 2 view .LVU3814
+	pxor	%xmm0, %xmm2	# tmp156, vect__204.88
+	.loc 1 82 32 is_stmt 1 discriminator 2 view .LVU3815
+.LVL646:
+	.loc 1 83 9 discriminator 2 view .LVU3816
+# blake2s-generic.c:82:         H[i] ^= v[i] ^ v[i+8]; i++;
+	.loc 1 82 14 is_stmt 0 discriminator 2 view .LVU3817
+	movq	%xmm2, 68(%rsp)	# vect__204.88, MEM <vector(2) unsigned int> [(u32 *)&H + 20B]
+	.loc 1 83 32 is_stmt 1 discriminator 2 view .LVU3818
+.LVL647:
+	.loc 1 84 9 discriminator 2 view .LVU3819
+	.loc 1 84 32 discriminator 2 view .LVU3820
+	.loc 1 80 28 discriminator 2 view .LVU3821
+	.loc 1 80 28 is_stmt 0 discriminator 2 view .LVU3822
+.LBE2094:
+.LBE2100:
+.LBE2106:
+	.loc 1 103 30 is_stmt 1 discriminator 2 view .LVU3823
+	.loc 1 103 12 discriminator 2 view .LVU3824
+	subq	$1, %rbp	#, nblocks
+.LVL648:
+	.loc 1 103 12 is_stmt 0 discriminator 2 view .LVU3825
+	jne	.L8	#,
+# blake2s-generic.c:104:         t[0] += BLAKE2S_BLOCK;
+	.loc 1 104 14 view .LVU3826
+	movl	40(%rsp), %r15d	# %sfp, tmp162
+.LVL649:
+	.loc 1 104 14 view .LVU3827
+	movl	36(%rsp), %eax	# %sfp, _280
+	sall	$6, %r15d	#, tmp162
+	addl	%r15d, %eax	# tmp162, _280
+	movd	%eax, %xmm0	# _280, tmp163
+	punpckldq	%xmm7, %xmm0	# t$1, vect_t_0_50.96
+.LVL650:
+.L7:
+.LBB2107:
+.LBB2108:
+	.loc 2 234 14 is_stmt 1 view .LVU3828
+# blake2s-internal.h:235:         udst[i] = usrc[i];
+	.loc 2 235 17 is_stmt 0 view .LVU3829
+	movq	24(%rsp), %rax	# %sfp, ctx
+	movdqa	48(%rsp), %xmm5	# MEM <char[1:32]> [(void *)&H], tmp208
+	movdqa	64(%rsp), %xmm6	# MEM <char[1:32]> [(void *)&H], tmp210
+	movups	%xmm5, (%rax)	# tmp208, MEM <char[1:32]> [(void *)_1]
+	movups	%xmm6, 16(%rax)	# tmp210, MEM <char[1:32]> [(void *)_1]
+.LVL651:
+	.loc 2 235 17 view .LVU3830
+.LBE2108:
+.LBE2107:
+	.loc 1 109 5 is_stmt 1 view .LVU3831
+	.loc 1 110 5 view .LVU3832
+# blake2s-generic.c:109:     ctx->t[0] = t[0];
+	.loc 1 109 15 is_stmt 0 view .LVU3833
+	movq	%xmm0, 96(%rax)	# vect_t_0_50.96, MEM <vector(2) unsigned int> [(unsigned int *)ctx_18(D) + 96B]
+# blake2s-generic.c:111: }
+	.loc 1 111 1 view .LVU3834
+	addq	$216, %rsp	#,
+	.cfi_def_cfa_offset 56
+	popq	%rbx	#
+	.cfi_def_cfa_offset 48
+	popq	%rbp	#
+	.cfi_def_cfa_offset 40
+	popq	%r12	#
+	.cfi_def_cfa_offset 32
+.LVL652:
+	.loc 1 111 1 view .LVU3835
+	popq	%r13	#
+	.cfi_def_cfa_offset 24
+	popq	%r14	#
+	.cfi_def_cfa_offset 16
+	popq	%r15	#
+	.cfi_def_cfa_offset 8
+	ret	
+	.cfi_endproc
+.LFE22:
+	.size	blake2s_compress_blocks_generic, .-blake2s_compress_blocks_generic
+	.section	.rodata.cst16,"aM",@progbits,16
+	.align 16
+.LC0:
+	.long	1779033703
+	.long	-1150833019
+	.long	1013904242
+	.long	-1521486534
+	.align 16
+.LC1:
+	.long	1359893119
+	.long	-1694144372
+	.long	528734635
+	.long	1541459225
+	.text
+.Letext0:
+	.file 3 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stddef.h"
+	.file 4 "/usr/include/x86_64-linux-gnu/bits/types.h"
+	.file 5 "/usr/include/x86_64-linux-gnu/bits/stdint-uintn.h"
+	.file 6 "blake2s.h"
+	.section	.debug_info,"",@progbits
+.Ldebug_info0:
+	.long	0x4f81
+	.value	0x5
+	.byte	0x1
+	.byte	0x8
+	.long	.Ldebug_abbrev0
+	.uleb128 0x23
+	.long	.LASF35
+	.byte	0xc
+	.long	.LASF0
+	.long	.LASF1
+	.quad	.Ltext0
+	.quad	.Letext0-.Ltext0
+	.long	.Ldebug_line0
+	.uleb128 0x8
+	.byte	0x8
+	.byte	0x5
+	.long	.LASF2
+	.uleb128 0xf
+	.long	.LASF8
+	.byte	0x3
+	.byte	0xd6
+	.byte	0x1b
+	.long	0x41
+	.uleb128 0x8
+	.byte	0x8
+	.byte	0x7
+	.long	.LASF3
+	.uleb128 0x24
+	.byte	0x4
+	.byte	0x5
+	.string	"int"
+	.uleb128 0xe
+	.long	0x48
+	.uleb128 0x8
+	.byte	0x1
+	.byte	0x8
+	.long	.LASF4
+	.uleb128 0xe
+	.long	0x54
+	.uleb128 0x8
+	.byte	0x2
+	.byte	0x7
+	.long	.LASF5
+	.uleb128 0x8
+	.byte	0x4
+	.byte	0x7
+	.long	.LASF6
+	.uleb128 0x8
+	.byte	0x1
+	.byte	0x6
+	.long	.LASF7
+	.uleb128 0xf
+	.long	.LASF9
+	.byte	0x4
+	.byte	0x26
+	.byte	0x17
+	.long	0x54
+	.uleb128 0x8
+	.byte	0x2
+	.byte	0x5
+	.long	.LASF10
+	.uleb128 0xf
+	.long	.LASF11
+	.byte	0x4
+	.byte	0x2a
+	.byte	0x16
+	.long	0x67
+	.uleb128 0x25
+	.byte	0x8
+	.uleb128 0x8
+	.byte	0x1
+	.byte	0x6
+	.long	.LASF12
+	.uleb128 0xf
+	.long	.LASF13
+	.byte	0x5
+	.byte	0x18
+	.byte	0x13
+	.long	0x75
+	.uleb128 0xf
+	.long	.LASF14
+	.byte	0x5
+	.byte	0x1a
+	.byte	0x14
+	.long	0x88
+	.uleb128 0x26
+	.long	.LASF36
+	.byte	0x80
+	.byte	0x10
+	.byte	0x6
+	.byte	0xf7
+	.byte	0x8
+	.long	0x10f
+	.uleb128 0x13
+	.string	"H"
+	.byte	0xf8
+	.byte	0xe
+	.long	0x10f
+	.byte	0
+	.uleb128 0x13
+	.string	"buf"
+	.byte	0xf9
+	.byte	0x13
+	.long	0x11f
+	.byte	0x20
+	.uleb128 0x13
+	.string	"t"
+	.byte	0xfa
+	.byte	0xe
+	.long	0x12f
+	.byte	0x60
+	.uleb128 0x13
+	.string	"f"
+	.byte	0xfb
+	.byte	0xe
+	.long	0x12f
+	.byte	0x68
+	.uleb128 0x18
+	.long	.LASF15
+	.byte	0xfc
+	.long	0x67
+	.byte	0x70
+	.uleb128 0x18
+	.long	.LASF16
+	.byte	0xfd
+	.long	0x67
+	.byte	0x74
+	.uleb128 0x18
+	.long	.LASF17
+	.byte	0xfe
+	.long	0x67
+	.byte	0x78
+	.byte	0
+	.uleb128 0xa
+	.long	0xa9
+	.long	0x11f
+	.uleb128 0x9
+	.long	0x41
+	.byte	0x7
+	.byte	0
+	.uleb128 0xa
+	.long	0x54
+	.long	0x12f
+	.uleb128 0x9
+	.long	0x41
+	.byte	0x3f
+	.byte	0
+	.uleb128 0xa
+	.long	0xa9
+	.long	0x13f
+	.uleb128 0x9
+	.long	0x41
+	.byte	0x1
+	.byte	0
+	.uleb128 0x10
+	.long	0xb5
+	.uleb128 0x10
+	.long	0x149
+	.uleb128 0x27
+	.uleb128 0x8
+	.byte	0x8
+	.byte	0x7
+	.long	.LASF18
+	.uleb128 0x8
+	.byte	0x8
+	.byte	0x5
+	.long	.LASF19
+	.uleb128 0x19
+	.string	"u8"
+	.byte	0x7
+	.byte	0x11
+	.long	0x9d
+	.uleb128 0xe
+	.long	0x158
+	.uleb128 0x19
+	.string	"u32"
+	.byte	0x8
+	.byte	0x12
+	.long	0xa9
+	.uleb128 0xe
+	.long	0x167
+	.uleb128 0xa
+	.long	0x172
+	.long	0x187
+	.uleb128 0x9
+	.long	0x41
+	.byte	0x7
+	.byte	0
+	.uleb128 0xe
+	.long	0x177
+	.uleb128 0x1a
+	.long	.LASF20
+	.byte	0xa
+	.byte	0x12
+	.long	0x187
+	.byte	0x20
+	.byte	0x67
+	.byte	0xe6
+	.byte	0x9
+	.byte	0x6a
+	.byte	0x85
+	.byte	0xae
+	.byte	0x67
+	.byte	0xbb
+	.byte	0x72
+	.byte	0xf3
+	.byte	0x6e
+	.byte	0x3c
+	.byte	0x3a
+	.byte	0xf5
+	.byte	0x4f
+	.byte	0xa5
+	.byte	0x7f
+	.byte	0x52
+	.byte	0xe
+	.byte	0x51
+	.byte	0x8c
+	.byte	0x68
+	.byte	0x5
+	.byte	0x9b
+	.byte	0xab
+	.byte	0xd9
+	.byte	0x83
+	.byte	0x1f
+	.byte	0x19
+	.byte	0xcd
+	.byte	0xe0
+	.byte	0x5b
+	.uleb128 0xa
+	.long	0x162
+	.long	0x1ce
+	.uleb128 0x9
+	.long	0x41
+	.byte	0x9
+	.uleb128 0x9
+	.long	0x41
+	.byte	0xf
+	.byte	0
+	.uleb128 0xe
+	.long	0x1b8
+	.uleb128 0x1a
+	.long	.LASF21
+	.byte	0xf
+	.byte	0x11
+	.long	0x1ce
+	.byte	0xa0
+	.byte	0
+	.byte	0x1
+	.byte	0x2
+	.byte	0x3
+	.byte	0x4
+	.byte	0x5
+	.byte	0x6
+	.byte	0x7
+	.byte	0x8
+	.byte	0x9
+	.byte	0xa
+	.byte	0xb
+	.byte	0xc
+	.byte	0xd
+	.byte	0xe
+	.byte	0xf
+	.byte	0xe
+	.byte	0xa
+	.byte	0x4
+	.byte	0x8
+	.byte	0x9
+	.byte	0xf
+	.byte	0xd
+	.byte	0x6
+	.byte	0x1
+	.byte	0xc
+	.byte	0
+	.byte	0x2
+	.byte	0xb
+	.byte	0x7
+	.byte	0x5
+	.byte	0x3
+	.byte	0xb
+	.byte	0x8
+	.byte	0xc
+	.byte	0
+	.byte	0x5
+	.byte	0x2
+	.byte	0xf
+	.byte	0xd
+	.byte	0xa
+	.byte	0xe
+	.byte	0x3
+	.byte	0x6
+	.byte	0x7
+	.byte	0x1
+	.byte	0x9
+	.byte	0x4
+	.byte	0x7
+	.byte	0x9
+	.byte	0x3
+	.byte	0x1
+	.byte	0xd
+	.byte	0xc
+	.byte	0xb
+	.byte	0xe
+	.byte	0x2
+	.byte	0x6
+	.byte	0x5
+	.byte	0xa
+	.byte	0x4
+	.byte	0
+	.byte	0xf
+	.byte	0x8
+	.byte	0x9
+	.byte	0
+	.byte	0x5
+	.byte	0x7
+	.byte	0x2
+	.byte	0x4
+	.byte	0xa
+	.byte	0xf
+	.byte	0xe
+	.byte	0x1
+	.byte	0xb
+	.byte	0xc
+	.byte	0x6
+	.byte	0x8
+	.byte	0x3
+	.byte	0xd
+	.byte	0x2
+	.byte	0xc
+	.byte	0x6
+	.byte	0xa
+	.byte	0
+	.byte	0xb
+	.byte	0x8
+	.byte	0x3
+	.byte	0x4
+	.byte	0xd
+	.byte	0x7
+	.byte	0x5
+	.byte	0xf
+	.byte	0xe
+	.byte	0x1
+	.byte	0x9
+	.byte	0xc
+	.byte	0x5
+	.byte	0x1
+	.byte	0xf
+	.byte	0xe
+	.byte	0xd
+	.byte	0x4
+	.byte	0xa
+	.byte	0
+	.byte	0x7
+	.byte	0x6
+	.byte	0x3
+	.byte	0x9
+	.byte	0x2
+	.byte	0x8
+	.byte	0xb
+	.byte	0xd
+	.byte	0xb
+	.byte	0x7
+	.byte	0xe
+	.byte	0xc
+	.byte	0x1
+	.byte	0x3
+	.byte	0x9
+	.byte	0x5
+	.byte	0
+	.byte	0xf
+	.byte	0x4
+	.byte	0x8
+	.byte	0x6
+	.byte	0x2
+	.byte	0xa
+	.byte	0x6
+	.byte	0xf
+	.byte	0xe
+	.byte	0x9
+	.byte	0xb
+	.byte	0x3
+	.byte	0
+	.byte	0x8
+	.byte	0xc
+	.byte	0x2
+	.byte	0xd
+	.byte	0x7
+	.byte	0x1
+	.byte	0x4
+	.byte	0xa
+	.byte	0x5
+	.byte	0xa
+	.byte	0x2
+	.byte	0x8
+	.byte	0x4
+	.byte	0x7
+	.byte	0x6
+	.byte	0x1
+	.byte	0x5
+	.byte	0xf
+	.byte	0xb
+	.byte	0x9
+	.byte	0xe
+	.byte	0x3
+	.byte	0xc
+	.byte	0xd
+	.byte	0
+	.uleb128 0x1b
+	.long	.LASF23
+	.byte	0x5d
+	.quad	.LFB22
+	.quad	.LFE22-.LFB22
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0x547
+	.uleb128 0x14
+	.string	"ctx"
+	.byte	0x5d
+	.byte	0x3a
+	.long	0x13f
+	.long	.LLST378
+	.long	.LVUS378
+	.uleb128 0x14
+	.string	"msg"
+	.byte	0x5d
+	.byte	0x4b
+	.long	0x144
+	.long	.LLST379
+	.long	.LVUS379
+	.uleb128 0x28
+	.long	.LASF22
+	.byte	0x1
+	.byte	0x5e
+	.byte	0x2d
+	.long	0x35
+	.long	.LLST380
+	.long	.LVUS380
+	.uleb128 0x1c
+	.string	"m"
+	.byte	0x60
+	.byte	0x1a
+	.long	0x547
+	.long	.LLST381
+	.long	.LVUS381
+	.uleb128 0x29
+	.string	"H"
+	.byte	0x1
+	.byte	0x61
+	.byte	0x9
+	.long	0x54c
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -224
+	.uleb128 0x1c
+	.string	"t"
+	.byte	0x61
+	.byte	0xf
+	.long	0x55c
+	.long	.LLST382
+	.long	.LVUS382
+	.uleb128 0xc
+	.string	"f"
+	.byte	0x1
+	.byte	0x61
+	.byte	0x15
+	.long	0x55c
+	.uleb128 0x11
+	.long	0x7fd
+	.quad	.LBI2030
+	.value	.LVU3564
+	.long	.LLRL383
+	.byte	0x62
+	.byte	0x5
+	.long	0x37d
+	.uleb128 0x1
+	.long	0x820
+	.long	.LLST384
+	.long	.LVUS384
+	.uleb128 0x1
+	.long	0x814
+	.long	.LLST385
+	.long	.LVUS385
+	.uleb128 0x1
+	.long	0x808
+	.long	.LLST386
+	.long	.LVUS386
+	.uleb128 0xb
+	.long	.LLRL383
+	.uleb128 0x6
+	.long	0x82c
+	.long	.LLST387
+	.long	.LVUS387
+	.uleb128 0x6
+	.long	0x838
+	.long	.LLST388
+	.long	.LVUS388
+	.uleb128 0x6
+	.long	0x844
+	.long	.LLST389
+	.long	.LVUS389
+	.byte	0
+	.byte	0
+	.uleb128 0x11
+	.long	0x6f5
+	.quad	.LBI2036
+	.value	.LVU3599
+	.long	.LLRL390
+	.byte	0x6a
+	.byte	0x9
+	.long	0x507
+	.uleb128 0x1
+	.long	0x71e
+	.long	.LLST391
+	.long	.LVUS391
+	.uleb128 0x1
+	.long	0x714
+	.long	.LLST392
+	.long	.LVUS392
+	.uleb128 0x1
+	.long	0x70a
+	.long	.LLST393
+	.long	.LVUS393
+	.uleb128 0x1
+	.long	0x700
+	.long	.LLST394
+	.long	.LVUS394
+	.uleb128 0xb
+	.long	.LLRL390
+	.uleb128 0x15
+	.long	0x72a
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -192
+	.uleb128 0x15
+	.long	0x734
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -128
+	.uleb128 0x1d
+	.long	0x7fd
+	.long	.LLRL395
+	.byte	0x44
+	.long	0x41c
+	.uleb128 0x2
+	.long	0x820
+	.uleb128 0x2
+	.long	0x814
+	.uleb128 0x2
+	.long	0x808
+	.uleb128 0xb
+	.long	.LLRL395
+	.uleb128 0xd
+	.long	0x82c
+	.uleb128 0xd
+	.long	0x838
+	.uleb128 0x6
+	.long	0x844
+	.long	.LLST396
+	.long	.LVUS396
+	.byte	0
+	.byte	0
+	.uleb128 0x11
+	.long	0x785
+	.quad	.LBI2045
+	.value	.LVU3603
+	.long	.LLRL397
+	.byte	0x43
+	.byte	0x5
+	.long	0x4c0
+	.uleb128 0x1
+	.long	0x7a8
+	.long	.LLST398
+	.long	.LVUS398
+	.uleb128 0x1
+	.long	0x79c
+	.long	.LLST399
+	.long	.LVUS399
+	.uleb128 0x1
+	.long	0x790
+	.long	.LLST400
+	.long	.LVUS400
+	.uleb128 0xb
+	.long	.LLRL397
+	.uleb128 0x6
+	.long	0x7b4
+	.long	.LLST401
+	.long	.LVUS401
+	.uleb128 0x6
+	.long	0x7c0
+	.long	.LLST402
+	.long	.LVUS402
+	.uleb128 0x6
+	.long	0x7cc
+	.long	.LLST403
+	.long	.LVUS403
+	.uleb128 0x1e
+	.long	0x84f
+	.quad	.LBI2047
+	.value	.LVU3610
+	.long	.LLRL404
+	.byte	0xd
+	.byte	0x13
+	.uleb128 0x1
+	.long	0x85d
+	.long	.LLST405
+	.long	.LVUS405
+	.uleb128 0xb
+	.long	.LLRL404
+	.uleb128 0x6
+	.long	0x867
+	.long	.LLST406
+	.long	.LVUS406
+	.byte	0
+	.byte	0
+	.byte	0
+	.byte	0
+	.uleb128 0x1f
+	.long	0x73e
+	.quad	.LBB2094
+	.quad	.LBE2094-.LBB2094
+	.long	0x4e7
+	.uleb128 0x6
+	.long	0x73f
+	.long	.LLST407
+	.long	.LVUS407
+	.byte	0
+	.uleb128 0x20
+	.quad	.LVL643
+	.long	0x897
+	.uleb128 0x16
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x4
+	.byte	0x91
+	.sleb128 -272
+	.byte	0x6
+	.uleb128 0x16
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x4
+	.byte	0x91
+	.sleb128 -256
+	.byte	0x6
+	.byte	0
+	.byte	0
+	.byte	0
+	.uleb128 0x2a
+	.long	0x7fd
+	.quad	.LBB2107
+	.quad	.LBE2107-.LBB2107
+	.byte	0x1
+	.byte	0x6c
+	.byte	0x5
+	.uleb128 0x2
+	.long	0x820
+	.uleb128 0x2
+	.long	0x814
+	.uleb128 0x2
+	.long	0x808
+	.uleb128 0xd
+	.long	0x82c
+	.uleb128 0xd
+	.long	0x838
+	.uleb128 0x6
+	.long	0x844
+	.long	.LLST408
+	.long	.LVUS408
+	.byte	0
+	.byte	0
+	.uleb128 0x10
+	.long	0x5b
+	.uleb128 0xa
+	.long	0x167
+	.long	0x55c
+	.uleb128 0x9
+	.long	0x41
+	.byte	0x7
+	.byte	0
+	.uleb128 0xa
+	.long	0x167
+	.long	0x56c
+	.uleb128 0x9
+	.long	0x41
+	.byte	0x1
+	.byte	0
+	.uleb128 0x1b
+	.long	.LASF24
+	.byte	0x58
+	.quad	.LFB21
+	.quad	.LFE21-.LFB21
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0x6f5
+	.uleb128 0x14
+	.string	"ctx"
+	.byte	0x58
+	.byte	0x33
+	.long	0x13f
+	.long	.LLST362
+	.long	.LVUS362
+	.uleb128 0x14
+	.string	"msg"
+	.byte	0x58
+	.byte	0x44
+	.long	0x144
+	.long	.LLST363
+	.long	.LVUS363
+	.uleb128 0x1e
+	.long	0x6f5
+	.quad	.LBI1990
+	.value	.LVU3490
+	.long	.LLRL364
+	.byte	0x5a
+	.byte	0x5
+	.uleb128 0x1
+	.long	0x71e
+	.long	.LLST365
+	.long	.LVUS365
+	.uleb128 0x1
+	.long	0x714
+	.long	.LLST366
+	.long	.LVUS366
+	.uleb128 0x1
+	.long	0x70a
+	.long	.LLST367
+	.long	.LVUS367
+	.uleb128 0x1
+	.long	0x700
+	.long	.LLST368
+	.long	.LVUS368
+	.uleb128 0xb
+	.long	.LLRL364
+	.uleb128 0x15
+	.long	0x72a
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -144
+	.uleb128 0x15
+	.long	0x734
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -80
+	.uleb128 0x11
+	.long	0x785
+	.quad	.LBI1992
+	.value	.LVU3495
+	.long	.LLRL369
+	.byte	0x43
+	.byte	0x5
+	.long	0x67c
+	.uleb128 0x1
+	.long	0x7a8
+	.long	.LLST370
+	.long	.LVUS370
+	.uleb128 0x1
+	.long	0x79c
+	.long	.LLST371
+	.long	.LVUS371
+	.uleb128 0x1
+	.long	0x790
+	.long	.LLST372
+	.long	.LVUS372
+	.uleb128 0xb
+	.long	.LLRL369
+	.uleb128 0x6
+	.long	0x7b4
+	.long	.LLST373
+	.long	.LVUS373
+	.uleb128 0x6
+	.long	0x7c0
+	.long	.LLST374
+	.long	.LVUS374
+	.uleb128 0x6
+	.long	0x7cc
+	.long	.LLST375
+	.long	.LVUS375
+	.byte	0
+	.byte	0
+	.uleb128 0x1d
+	.long	0x7fd
+	.long	.LLRL376
+	.byte	0x44
+	.long	0x6af
+	.uleb128 0x2
+	.long	0x820
+	.uleb128 0x2
+	.long	0x814
+	.uleb128 0x2
+	.long	0x808
+	.uleb128 0xb
+	.long	.LLRL376
+	.uleb128 0xd
+	.long	0x82c
+	.uleb128 0xd
+	.long	0x838
+	.uleb128 0xd
+	.long	0x844
+	.byte	0
+	.byte	0
+	.uleb128 0x1f
+	.long	0x73e
+	.quad	.LBB2014
+	.quad	.LBE2014-.LBB2014
+	.long	0x6d6
+	.uleb128 0x6
+	.long	0x73f
+	.long	.LLST377
+	.long	.LVUS377
+	.byte	0
+	.uleb128 0x20
+	.quad	.LVL624
+	.long	0x897
+	.uleb128 0x16
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -144
+	.uleb128 0x16
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -80
+	.byte	0
+	.byte	0
+	.byte	0
+	.byte	0
+	.uleb128 0x17
+	.long	.LASF25
+	.byte	0x1
+	.byte	0x3e
+	.long	0x74b
+	.uleb128 0x7
+	.string	"H"
+	.byte	0x1
+	.byte	0x3e
+	.byte	0x26
+	.long	0x74b
+	.uleb128 0x7
+	.string	"t"
+	.byte	0x1
+	.byte	0x3e
+	.byte	0x36
+	.long	0x750
+	.uleb128 0x7
+	.string	"f"
+	.byte	0x1
+	.byte	0x3e
+	.byte	0x46
+	.long	0x750
+	.uleb128 0x7
+	.string	"msg"
+	.byte	0x1
+	.byte	0x3f
+	.byte	0x2e
+	.long	0x144
+	.uleb128 0xc
+	.string	"v"
+	.byte	0x1
+	.byte	0x41
+	.byte	0x9
+	.long	0x755
+	.uleb128 0xc
+	.string	"m"
+	.byte	0x1
+	.byte	0x42
+	.byte	0x9
+	.long	0x755
+	.uleb128 0x2b
+	.uleb128 0xc
+	.string	"i"
+	.byte	0x1
+	.byte	0x50
+	.byte	0x13
+	.long	0x67
+	.byte	0
+	.byte	0
+	.uleb128 0x10
+	.long	0x167
+	.uleb128 0x10
+	.long	0x172
+	.uleb128 0xa
+	.long	0x167
+	.long	0x765
+	.uleb128 0x9
+	.long	0x41
+	.byte	0xf
+	.byte	0
+	.uleb128 0x17
+	.long	.LASF26
+	.byte	0x1
+	.byte	0x11
+	.long	0x785
+	.uleb128 0x7
+	.string	"v"
+	.byte	0x1
+	.byte	0x11
+	.byte	0x29
+	.long	0x74b
+	.uleb128 0x7
+	.string	"m"
+	.byte	0x1
+	.byte	0x11
+	.byte	0x3a
+	.long	0x750
+	.byte	0
+	.uleb128 0x17
+	.long	.LASF27
+	.byte	0x1
+	.byte	0x7
+	.long	0x7d7
+	.uleb128 0x7
+	.string	"dst"
+	.byte	0x1
+	.byte	0x7
+	.byte	0x2a
+	.long	0x94
+	.uleb128 0x7
+	.string	"src"
+	.byte	0x1
+	.byte	0x7
+	.byte	0x3b
+	.long	0x144
+	.uleb128 0x21
+	.long	.LASF28
+	.byte	0x1
+	.byte	0x7
+	.byte	0x49
+	.long	0x67
+	.uleb128 0x12
+	.long	.LASF29
+	.byte	0x1
+	.byte	0x9
+	.byte	0xa
+	.long	0x74b
+	.uleb128 0x12
+	.long	.LASF30
+	.byte	0x1
+	.byte	0xa
+	.byte	0x1a
+	.long	0x547
+	.uleb128 0xc
+	.string	"i"
+	.byte	0x1
+	.byte	0xb
+	.byte	0xe
+	.long	0x67
+	.byte	0
+	.uleb128 0x2c
+	.string	"ror"
+	.byte	0x1
+	.byte	0x5
+	.byte	0x13
+	.long	0x167
+	.byte	0x3
+	.long	0x7fd
+	.uleb128 0x7
+	.string	"l"
+	.byte	0x1
+	.byte	0x5
+	.byte	0x20
+	.long	0x67
+	.uleb128 0x7
+	.string	"x"
+	.byte	0x1
+	.byte	0x5
+	.byte	0x27
+	.long	0x167
+	.byte	0
+	.uleb128 0x17
+	.long	.LASF31
+	.byte	0x2
+	.byte	0xe5
+	.long	0x84f
+	.uleb128 0x7
+	.string	"dst"
+	.byte	0x2
+	.byte	0xe5
+	.byte	0x2b
+	.long	0x94
+	.uleb128 0x7
+	.string	"src"
+	.byte	0x2
+	.byte	0xe5
+	.byte	0x3c
+	.long	0x144
+	.uleb128 0x21
+	.long	.LASF28
+	.byte	0x2
+	.byte	0xe5
+	.byte	0x4a
+	.long	0x67
+	.uleb128 0x12
+	.long	.LASF29
+	.byte	0x2
+	.byte	0xe7
+	.byte	0xa
+	.long	0x74b
+	.uleb128 0x12
+	.long	.LASF30
+	.byte	0x2
+	.byte	0xe8
+	.byte	0x10
+	.long	0x750
+	.uleb128 0xc
+	.string	"i"
+	.byte	0x2
+	.byte	0xe9
+	.byte	0xe
+	.long	0x67
+	.byte	0
+	.uleb128 0x22
+	.long	.LASF32
+	.byte	0xd9
+	.long	0x167
+	.long	0x872
+	.uleb128 0x7
+	.string	"x"
+	.byte	0x2
+	.byte	0xd9
+	.byte	0x32
+	.long	0x547
+	.uleb128 0xc
+	.string	"w"
+	.byte	0x2
+	.byte	0xda
+	.byte	0x9
+	.long	0x167
+	.byte	0
+	.uleb128 0x22
+	.long	.LASF33
+	.byte	0xd4
+	.long	0x167
+	.long	0x897
+	.uleb128 0x7
+	.string	"x"
+	.byte	0x2
+	.byte	0xd4
+	.byte	0x1f
+	.long	0x167
+	.uleb128 0x12
+	.long	.LASF34
+	.byte	0x2
+	.byte	0xd5
+	.byte	0xf
+	.long	0x4f
+	.byte	0
+	.uleb128 0x2d
+	.long	0x765
+	.quad	.LFB23
+	.quad	.LFE23-.LFB23
+	.uleb128 0x1
+	.byte	0x9c
+	.uleb128 0x1
+	.long	0x770
+	.long	.LLST0
+	.long	.LVUS0
+	.uleb128 0x1
+	.long	0x77a
+	.long	.LLST1
+	.long	.LVUS1
+	.uleb128 0x11
+	.long	0x7d7
+	.quad	.LBI1297
+	.value	.LVU8
+	.long	.LLRL2
+	.byte	0x32
+	.byte	0x4c
+	.long	0x8fc
+	.uleb128 0x1
+	.long	0x7f2
+	.long	.LLST3
+	.long	.LVUS3
+	.uleb128 0x1
+	.long	0x7e8
+	.long	.LLST4
+	.long	.LVUS4
+	.byte	0
+	.uleb128 0x4
+	.long	0x7d7
+	.quad	.LBI1301
+	.value	.LVU24
+	.quad	.LBB1301
+	.quad	.LBE1301-.LBB1301
+	.byte	0x32
+	.byte	0x86
+	.long	0x934
+	.uleb128 0x2
+	.long	0x7f2
+	.uleb128 0x1
+	.long	0x7e8
+	.long	.LLST5
+	.long	.LVUS5
+	.byte	0
+	.uleb128 0x4
+	.long	0x7d7
+	.quad	.LBI1303
+	.value	.LVU35
+	.quad	.LBB1303
+	.quad	.LBE1303-.LBB1303
+	.byte	0x32
+	.byte	0xdf
+	.long	0x96c
+	.uleb128 0x2
+	.long	0x7f2
+	.uleb128 0x1
+	.long	0x7e8
+	.long	.LLST6
+	.long	.LVUS6
+	.byte	0
+	.uleb128 0x3
+	.long	0x7d7
+	.quad	.LBI1305
+	.value	.LVU46
+	.quad	.LBB1305
+	.quad	.LBE1305-.LBB1305
+	.byte	0x32
+	.value	0x119
+	.long	0x9a5
+	.uleb128 0x2
+	.long	0x7f2
+	.uleb128 0x1
+	.long	0x7e8
+	.long	.LLST7
+	.long	.LVUS7
+	.byte	0
+	.uleb128 0x3
+	.long	0x7d7
+	.quad	.LBI1307
+	.value	.LVU57
+	.quad	.LBB1307
+	.quad	.LBE1307-.LBB1307
+	.byte	0x32
+	.value	0x184
+	.long	0x9e6
+	.uleb128 0x1
+	.long	0x7f2
+	.long	.LLST8
+	.long	.LVUS8
+	.uleb128 0x1
+	.long	0x7e8
+	.long	.LLST9
+	.long	.LVUS9
+	.byte	0
+	.uleb128 0x3
+	.long	0x7d7
+	.quad	.LBI1309
+	.value	.LVU68
+	.quad	.LBB1309
+	.quad	.LBE1309-.LBB1309
+	.byte	0x32
+	.value	0x1be
+	.long	0xa1f
+	.uleb128 0x2
+	.long	0x7f2
+	.uleb128 0x1
+	.long	0x7e8
+	.long	.LLST10
+	.long	.LVUS10
+	.byte	0
+	.uleb128 0x3
+	.long	0x7d7
+	.quad	.LBI1311
+	.value	.LVU78
+	.quad	.LBB1311
+	.quad	.LBE1311-.LBB1311
+	.byte	0x32
+	.value	0x217
+	.long	0xa58
+	.uleb128 0x2
+	.long	0x7f2
+	.uleb128 0x1
+	.long	0x7e8
+	.long	.LLST11
+	.long	.LVUS11
+	.byte	0
+	.uleb128 0x3
+	.long	0x7d7
+	.quad	.LBI1313
+	.value	.LVU91
+	.quad	.LBB1313
+	.quad	.LBE1313-.LBB1313
+	.byte	0x32
+	.value	0x251
+	.long	0xa91
+	.uleb128 0x2
+	.long	0x7f2
+	.uleb128 0x1
+	.long	0x7e8
+	.long	.LLST12
+	.long	.LVUS12
+	.byte	0
+	.uleb128 0x5
+	.long	0x7d7
+	.quad	.LBI1315
+	.value	.LVU107
+	.long	.LLRL13
+	.byte	0x32
+	.value	0x2bc
+	.long	0xac6
+	.uleb128 0x1
+	.long	0x7f2
+	.long	.LLST14
+	.long	.LVUS14
+	.uleb128 0x1
+	.long	0x7e8
+	.long	.LLST15
+	.long	.LVUS15
+	.byte	0
+	.uleb128 0x5
+	.long	0x7d7
+	.quad	.LBI1319
+	.value	.LVU118
+	.long	.LLRL16
+	.byte	0x32
+	.value	0x2f6
+	.long	0xaf3
+	.uleb128 0x2
+	.long	0x7f2
+	.uleb128 0x1
+	.long	0x7e8
+	.long	.LLST17
+	.long	.LVUS17
+	.byte	0
+	.uleb128 0x3
+	.long	0x7d7
+	.quad	.LBI1323
+	.value	.LVU132
+	.quad	.LBB1323
+	.quad	.LBE1323-.LBB1323
+	.byte	0x32
+	.value	0x34f
+	.long	0xb2c
+	.uleb128 0x2
+	.long	0x7f2
+	.uleb128 0x1
+	.long	0x7e8
+	.long	.LLST18
+	.long	.LVUS18
+	.byte	0
+	.uleb128 0x3
+	.long	0x7d7
+	.quad	.LBI1325
+	.value	.LVU141
+	.quad	.LBB1325
+	.quad	.LBE1325-.LBB1325
+	.byte	0x32
+	.value	0x389
+	.long	0xb65
+	.uleb128 0x2
+	.long	0x7f2
+	.uleb128 0x1
+	.long	0x7e8
+	.long	.LLST19
+	.long	.LVUS19
+	.byte	0
+	.uleb128 0x3
+	.long	0x7d7
+	.quad	.LBI1327
+	.value	.LVU155
+	.quad	.LBB1327
+	.quad	.LBE1327-.LBB1327
+	.byte	0x32
+	.value	0x3f4
+	.long	0xba6
+	.uleb128 0x1
+	.long	0x7f2
+	.long	.LLST20
+	.long	.LVUS20
+	.uleb128 0x1
+	.long	0x7e8
+	.long	.LLST21
+	.long	.LVUS21
+	.byte	0
+	.uleb128 0x3
+	.long	0x7d7
+	.quad	.LBI1329
+	.value	.LVU165
+	.quad	.LBB1329
+	.quad	.LBE1329-.LBB1329
+	.byte	0x32
+	.value	0x42e
+	.long	0xbdf
+	.uleb128 0x2
+	.long	0x7f2
+	.uleb128 0x1
+	.long	0x7e8
+	.long	.LLST22
+	.long	.LVUS22
+	.byte	0
+	.uleb128 0x3
+	.long	0x7d7
+	.quad	.LBI1331
+	.value	.LVU175
+	.quad	.LBB1331
+	.quad	.LBE1331-.LBB1331
+	.byte	0x32
+	.value	0x487
+	.long	0xc18
+	.uleb128 0x2
+	.long	0x7f2
+	.uleb128 0x1
+	.long	0x7e8
+	.long	.LLST23
+	.long	.LVUS23
+	.byte	0
+	.uleb128 0x3
+	.long	0x7d7
+	.quad	.LBI1333
+	.value	.LVU185
+	.quad	.LBB1333
+	.quad	.LBE1333-.LBB1333
+	.byte	0x32
+	.value	0x4c1
+	.long	0xc51
+	.uleb128 0x2
+	.long	0x7f2
+	.uleb128 0x1
+	.long	0x7e8
+	.long	.LLST24
+	.long	.LVUS24
+	.byte	0
+	.uleb128 0x3
+	.long	0x7d7
+	.quad	.LBI1335
+	.value	.LVU197
+	.quad	.LBB1335
+	.quad	.LBE1335-.LBB1335
+	.byte	0x32
+	.value	0x52c
+	.long	0xc8a
+	.uleb128 0x2
+	.long	0x7f2
+	.uleb128 0x1
+	.long	0x7e8
+	.long	.LLST25
+	.long	.LVUS25
+	.byte	0
+	.uleb128 0x3
+	.long	0x7d7
+	.quad	.LBI1337
+	.value	.LVU207
+	.quad	.LBB1337
+	.quad	.LBE1337-.LBB1337
+	.byte	0x32
+	.value	0x566
+	.long	0xcc3
+	.uleb128 0x2
+	.long	0x7f2
+	.uleb128 0x1
+	.long	0x7e8
+	.long	.LLST26
+	.long	.LVUS26
+	.byte	0
+	.uleb128 0x3
+	.long	0x7d7
+	.quad	.LBI1339
+	.value	.LVU217
+	.quad	.LBB1339
+	.quad	.LBE1339-.LBB1339
+	.byte	0x32
+	.value	0x5bf
+	.long	0xcfc
+	.uleb128 0x2
+	.long	0x7f2
+	.uleb128 0x1
+	.long	0x7e8
+	.long	.LLST27
+	.long	.LVUS27
+	.byte	0
+	.uleb128 0x3
+	.long	0x7d7
+	.quad	.LBI1341
+	.value	.LVU226
+	.quad	.LBB1341
+	.quad	.LBE1341-.LBB1341
+	.byte	0x32
+	.value	0x5f9
+	.long	0xd35
+	.uleb128 0x2
+	.long	0x7f2
+	.uleb128 0x1
+	.long	0x7e8
+	.long	.LLST28
+	.long	.LVUS28
+	.byte	0
+	.uleb128 0x3
+	.long	0x7d7
+	.quad	.LBI1343
+	.value	.LVU240
+	.quad	.LBB1343
+	.quad	.LBE1343-.LBB1343
+	.byte	0x32
+	.value	0x665
+	.long	0xd6e
+	.uleb128 0x2
+	.long	0x7f2
+	.uleb128 0x1
+	.long	0x7e8
+	.long	.LLST29
+	.long	.LVUS29
+	.byte	0
+	.uleb128 0x3
+	.long	0x7d7
+	.quad	.LBI1345
+	.value	.LVU250
+	.quad	.LBB1345
+	.quad	.LBE1345-.LBB1345
+	.byte	0x32
+	.value	0x69f
+	.long	0xda7
+	.uleb128 0x2
+	.long	0x7f2
+	.uleb128 0x1
+	.long	0x7e8
+	.long	.LLST30
+	.long	.LVUS30
+	.byte	0
+	.uleb128 0x3
+	.long	0x7d7
+	.quad	.LBI1347
+	.value	.LVU260
+	.quad	.LBB1347
+	.quad	.LBE1347-.LBB1347
+	.byte	0x32
+	.value	0x6f9
+	.long	0xde0
+	.uleb128 0x2
+	.long	0x7f2
+	.uleb128 0x1
+	.long	0x7e8
+	.long	.LLST31
+	.long	.LVUS31
+	.byte	0
+	.uleb128 0x3
+	.long	0x7d7
+	.quad	.LBI1349
+	.value	.LVU270
+	.quad	.LBB1349
+	.quad	.LBE1349-.LBB1349
+	.byte	0x32
+	.value	0x733
+	.long	0xe19
+	.uleb128 0x2
+	.long	0x7f2
+	.uleb128 0x1
+	.long	0x7e8
+	.long	.LLST32
+	.long	.LVUS32
+	.byte	0
+	.uleb128 0x3
+	.long	0x7d7
+	.quad	.LBI1351
+	.value	.LVU283
+	.quad	.LBB1351
+	.quad	.LBE1351-.LBB1351
+	.byte	0x32
+	.value	0x79f
+	.long	0xe52
+	.uleb128 0x2
+	.long	0x7f2
+	.uleb128 0x1
+	.long	0x7e8
+	.long	.LLST33
+	.long	.LVUS33
+	.byte	0
+	.uleb128 0x3
+	.long	0x7d7
+	.quad	.LBI1353
+	.value	.LVU293
+	.quad	.LBB1353
+	.quad	.LBE1353-.LBB1353
+	.byte	0x32
+	.value	0x7d9
+	.long	0xe8b
+	.uleb128 0x2
+	.long	0x7f2
+	.uleb128 0x1
+	.long	0x7e8
+	.long	.LLST34
+	.long	.LVUS34
+	.byte	0
+	.uleb128 0x3
+	.long	0x7d7
+	.quad	.LBI1355
+	.value	.LVU303
+	.quad	.LBB1355
+	.quad	.LBE1355-.LBB1355
+	.byte	0x32
+	.value	0x833
+	.long	0xec4
+	.uleb128 0x2
+	.long	0x7f2
+	.uleb128 0x1
+	.long	0x7e8
+	.long	.LLST35
+	.long	.LVUS35
+	.byte	0
+	.uleb128 0x3
+	.long	0x7d7
+	.quad	.LBI1357
+	.value	.LVU313
+	.quad	.LBB1357
+	.quad	.LBE1357-.LBB1357
+	.byte	0x32
+	.value	0x86d
+	.long	0xefd
+	.uleb128 0x2
+	.long	0x7f2
+	.uleb128 0x1
+	.long	0x7e8
+	.long	.LLST36
+	.long	.LVUS36
+	.byte	0
+	.uleb128 0x3
+	.long	0x7d7
+	.quad	.LBI1359
+	.value	.LVU328
+	.quad	.LBB1359
+	.quad	.LBE1359-.LBB1359
+	.byte	0x32
+	.value	0x8d9
+	.long	0xf3e
+	.uleb128 0x1
+	.long	0x7f2
+	.long	.LLST37
+	.long	.LVUS37
+	.uleb128 0x1
+	.long	0x7e8
+	.long	.LLST38
+	.long	.LVUS38
+	.byte	0
+	.uleb128 0x3
+	.long	0x7d7
+	.quad	.LBI1361
+	.value	.LVU338
+	.quad	.LBB1361
+	.quad	.LBE1361-.LBB1361
+	.byte	0x32
+	.value	0x913
+	.long	0xf77
+	.uleb128 0x2
+	.long	0x7f2
+	.uleb128 0x1
+	.long	0x7e8
+	.long	.LLST39
+	.long	.LVUS39
+	.byte	0
+	.uleb128 0x3
+	.long	0x7d7
+	.quad	.LBI1363
+	.value	.LVU348
+	.quad	.LBB1363
+	.quad	.LBE1363-.LBB1363
+	.byte	0x32
+	.value	0x96d
+	.long	0xfb0
+	.uleb128 0x2
+	.long	0x7f2
+	.uleb128 0x1
+	.long	0x7e8
+	.long	.LLST40
+	.long	.LVUS40
+	.byte	0
+	.uleb128 0x3
+	.long	0x7d7
+	.quad	.LBI1365
+	.value	.LVU358
+	.quad	.LBB1365
+	.quad	.LBE1365-.LBB1365
+	.byte	0x32
+	.value	0x9a7
+	.long	0xfe9
+	.uleb128 0x2
+	.long	0x7f2
+	.uleb128 0x1
+	.long	0x7e8
+	.long	.LLST41
+	.long	.LVUS41
+	.byte	0
+	.uleb128 0x4
+	.long	0x7d7
+	.quad	.LBI1367
+	.value	.LVU372
+	.quad	.LBB1367
+	.quad	.LBE1367-.LBB1367
+	.byte	0x33
+	.byte	0x4c
+	.long	0x1021
+	.uleb128 0x2
+	.long	0x7f2
+	.uleb128 0x1
+	.long	0x7e8
+	.long	.LLST42
+	.long	.LVUS42
+	.byte	0
+	.uleb128 0x4
+	.long	0x7d7
+	.quad	.LBI1369
+	.value	.LVU382
+	.quad	.LBB1369
+	.quad	.LBE1369-.LBB1369
+	.byte	0x33
+	.byte	0x86
+	.long	0x1059
+	.uleb128 0x2
+	.long	0x7f2
+	.uleb128 0x1
+	.long	0x7e8
+	.long	.LLST43
+	.long	.LVUS43
+	.byte	0
+	.uleb128 0x4
+	.long	0x7d7
+	.quad	.LBI1371
+	.value	.LVU392
+	.quad	.LBB1371
+	.quad	.LBE1371-.LBB1371
+	.byte	0x33
+	.byte	0xdf
+	.long	0x1091
+	.uleb128 0x2
+	.long	0x7f2
+	.uleb128 0x1
+	.long	0x7e8
+	.long	.LLST44
+	.long	.LVUS44
+	.byte	0
+	.uleb128 0x3
+	.long	0x7d7
+	.quad	.LBI1373
+	.value	.LVU402
+	.quad	.LBB1373
+	.quad	.LBE1373-.LBB1373
+	.byte	0x33
+	.value	0x119
+	.long	0x10ca
+	.uleb128 0x2
+	.long	0x7f2
+	.uleb128 0x1
+	.long	0x7e8
+	.long	.LLST45
+	.long	.LVUS45
+	.byte	0
+	.uleb128 0x3
+	.long	0x7d7
+	.quad	.LBI1375
+	.value	.LVU415
+	.quad	.LBB1375
+	.quad	.LBE1375-.LBB1375
+	.byte	0x33
+	.value	0x184
+	.long	0x1103
+	.uleb128 0x2
+	.long	0x7f2
+	.uleb128 0x1
+	.long	0x7e8
+	.long	.LLST46
+	.long	.LVUS46
+	.byte	0
+	.uleb128 0x3
+	.long	0x7d7
+	.quad	.LBI1377
+	.value	.LVU425
+	.quad	.LBB1377
+	.quad	.LBE1377-.LBB1377
+	.byte	0x33
+	.value	0x1be
+	.long	0x113c
+	.uleb128 0x2
+	.long	0x7f2
+	.uleb128 0x1
+	.long	0x7e8
+	.long	.LLST47
+	.long	.LVUS47
+	.byte	0
+	.uleb128 0x3
+	.long	0x7d7
+	.quad	.LBI1379
+	.value	.LVU435
+	.quad	.LBB1379
+	.quad	.LBE1379-.LBB1379
+	.byte	0x33
+	.value	0x217
+	.long	0x1175
+	.uleb128 0x2
+	.long	0x7f2
+	.uleb128 0x1
+	.long	0x7e8
+	.long	.LLST48
+	.long	.LVUS48
+	.byte	0
+	.uleb128 0x5
+	.long	0x7d7
+	.quad	.LBI1381
+	.value	.LVU446
+	.long	.LLRL49
+	.byte	0x33
+	.value	0x251
+	.long	0x11a2
+	.uleb128 0x2
+	.long	0x7f2
+	.uleb128 0x1
+	.long	0x7e8
+	.long	.LLST50
+	.long	.LVUS50
+	.byte	0
+	.uleb128 0x3
+	.long	0x7d7
+	.quad	.LBI1385
+	.value	.LVU461
+	.quad	.LBB1385
+	.quad	.LBE1385-.LBB1385
+	.byte	0x33
+	.value	0x2bc
+	.long	0x11db
+	.uleb128 0x2
+	.long	0x7f2
+	.uleb128 0x1
+	.long	0x7e8
+	.long	.LLST51
+	.long	.LVUS51
+	.byte	0
+	.uleb128 0x3
+	.long	0x7d7
+	.quad	.LBI1387
+	.value	.LVU471
+	.quad	.LBB1387
+	.quad	.LBE1387-.LBB1387
+	.byte	0x33
+	.value	0x2f6
+	.long	0x1214
+	.uleb128 0x2
+	.long	0x7f2
+	.uleb128 0x1
+	.long	0x7e8
+	.long	.LLST52
+	.long	.LVUS52
+	.byte	0
+	.uleb128 0x3
+	.long	0x7d7
+	.quad	.LBI1389
+	.value	.LVU481
+	.quad	.LBB1389
+	.quad	.LBE1389-.LBB1389
+	.byte	0x33
+	.value	0x34f
+	.long	0x124d
+	.uleb128 0x2
+	.long	0x7f2
+	.uleb128 0x1
+	.long	0x7e8
+	.long	.LLST53
+	.long	.LVUS53
+	.byte	0
+	.uleb128 0x3
+	.long	0x7d7
+	.quad	.LBI1391
+	.value	.LVU491
+	.quad	.LBB1391
+	.quad	.LBE1391-.LBB1391
+	.byte	0x33
+	.value	0x389
+	.long	0x1286
+	.uleb128 0x2
+	.long	0x7f2
+	.uleb128 0x1
+	.long	0x7e8
+	.long	.LLST54
+	.long	.LVUS54
+	.byte	0
+	.uleb128 0x3
+	.long	0x7d7
+	.quad	.LBI1393
+	.value	.LVU503
+	.quad	.LBB1393
+	.quad	.LBE1393-.LBB1393
+	.byte	0x33
+	.value	0x3f4
+	.long	0x12c7
+	.uleb128 0x1
+	.long	0x7f2
+	.long	.LLST55
+	.long	.LVUS55
+	.uleb128 0x1
+	.long	0x7e8
+	.long	.LLST56
+	.long	.LVUS56
+	.byte	0
+	.uleb128 0x3
+	.long	0x7d7
+	.quad	.LBI1395
+	.value	.LVU513
+	.quad	.LBB1395
+	.quad	.LBE1395-.LBB1395
+	.byte	0x33
+	.value	0x42e
+	.long	0x1300
+	.uleb128 0x2
+	.long	0x7f2
+	.uleb128 0x1
+	.long	0x7e8
+	.long	.LLST57
+	.long	.LVUS57
+	.byte	0
+	.uleb128 0x3
+	.long	0x7d7
+	.quad	.LBI1397
+	.value	.LVU523
+	.quad	.LBB1397
+	.quad	.LBE1397-.LBB1397
+	.byte	0x33
+	.value	0x487
+	.long	0x1339
+	.uleb128 0x2
+	.long	0x7f2
+	.uleb128 0x1
+	.long	0x7e8
+	.long	.LLST58
+	.long	.LVUS58
+	.byte	0
+	.uleb128 0x3
+	.long	0x7d7
+	.quad	.LBI1399
+	.value	.LVU533
+	.quad	.LBB1399
+	.quad	.LBE1399-.LBB1399
+	.byte	0x33
+	.value	0x4c1
+	.long	0x1372
+	.uleb128 0x2
+	.long	0x7f2
+	.uleb128 0x1
+	.long	0x7e8
+	.long	.LLST59
+	.long	.LVUS59
+	.byte	0
+	.uleb128 0x3
+	.long	0x7d7
+	.quad	.LBI1401
+	.value	.LVU545
+	.quad	.LBB1401
+	.quad	.LBE1401-.LBB1401
+	.byte	0x33
+	.value	0x52c
+	.long	0x13ab
+	.uleb128 0x2
+	.long	0x7f2
+	.uleb128 0x1
+	.long	0x7e8
+	.long	.LLST60
+	.long	.LVUS60
+	.byte	0
+	.uleb128 0x3
+	.long	0x7d7
+	.quad	.LBI1403
+	.value	.LVU555
+	.quad	.LBB1403
+	.quad	.LBE1403-.LBB1403
+	.byte	0x33
+	.value	0x566
+	.long	0x13e4
+	.uleb128 0x2
+	.long	0x7f2
+	.uleb128 0x1
+	.long	0x7e8
+	.long	.LLST61
+	.long	.LVUS61
+	.byte	0
+	.uleb128 0x3
+	.long	0x7d7
+	.quad	.LBI1405
+	.value	.LVU565
+	.quad	.LBB1405
+	.quad	.LBE1405-.LBB1405
+	.byte	0x33
+	.value	0x5bf
+	.long	0x141d
+	.uleb128 0x2
+	.long	0x7f2
+	.uleb128 0x1
+	.long	0x7e8
+	.long	.LLST62
+	.long	.LVUS62
+	.byte	0
+	.uleb128 0x3
+	.long	0x7d7
+	.quad	.LBI1407
+	.value	.LVU574
+	.quad	.LBB1407
+	.quad	.LBE1407-.LBB1407
+	.byte	0x33
+	.value	0x5f9
+	.long	0x1456
+	.uleb128 0x2
+	.long	0x7f2
+	.uleb128 0x1
+	.long	0x7e8
+	.long	.LLST63
+	.long	.LVUS63
+	.byte	0
+	.uleb128 0x3
+	.long	0x7d7
+	.quad	.LBI1409
+	.value	.LVU589
+	.quad	.LBB1409
+	.quad	.LBE1409-.LBB1409
+	.byte	0x33
+	.value	0x665
+	.long	0x148f
+	.uleb128 0x2
+	.long	0x7f2
+	.uleb128 0x1
+	.long	0x7e8
+	.long	.LLST64
+	.long	.LVUS64
+	.byte	0
+	.uleb128 0x3
+	.long	0x7d7
+	.quad	.LBI1411
+	.value	.LVU599
+	.quad	.LBB1411
+	.quad	.LBE1411-.LBB1411
+	.byte	0x33
+	.value	0x69f
+	.long	0x14c8
+	.uleb128 0x2
+	.long	0x7f2
+	.uleb128 0x1
+	.long	0x7e8
+	.long	.LLST65
+	.long	.LVUS65
+	.byte	0
+	.uleb128 0x3
+	.long	0x7d7
+	.quad	.LBI1413
+	.value	.LVU609
+	.quad	.LBB1413
+	.quad	.LBE1413-.LBB1413
+	.byte	0x33
+	.value	0x6f9
+	.long	0x1501
+	.uleb128 0x2
+	.long	0x7f2
+	.uleb128 0x1
+	.long	0x7e8
+	.long	.LLST66
+	.long	.LVUS66
+	.byte	0
+	.uleb128 0x3
+	.long	0x7d7
+	.quad	.LBI1415
+	.value	.LVU619
+	.quad	.LBB1415
+	.quad	.LBE1415-.LBB1415
+	.byte	0x33
+	.value	0x733
+	.long	0x153a
+	.uleb128 0x2
+	.long	0x7f2
+	.uleb128 0x1
+	.long	0x7e8
+	.long	.LLST67
+	.long	.LVUS67
+	.byte	0
+	.uleb128 0x3
+	.long	0x7d7
+	.quad	.LBI1417
+	.value	.LVU633
+	.quad	.LBB1417
+	.quad	.LBE1417-.LBB1417
+	.byte	0x33
+	.value	0x79f
+	.long	0x1573
+	.uleb128 0x2
+	.long	0x7f2
+	.uleb128 0x1
+	.long	0x7e8
+	.long	.LLST68
+	.long	.LVUS68
+	.byte	0
+	.uleb128 0x3
+	.long	0x7d7
+	.quad	.LBI1419
+	.value	.LVU644
+	.quad	.LBB1419
+	.quad	.LBE1419-.LBB1419
+	.byte	0x33
+	.value	0x7d9
+	.long	0x15ac
+	.uleb128 0x2
+	.long	0x7f2
+	.uleb128 0x1
+	.long	0x7e8
+	.long	.LLST69
+	.long	.LVUS69
+	.byte	0
+	.uleb128 0x3
+	.long	0x7d7
+	.quad	.LBI1421
+	.value	.LVU654
+	.quad	.LBB1421
+	.quad	.LBE1421-.LBB1421
+	.byte	0x33
+	.value	0x833
+	.long	0x15e5
+	.uleb128 0x2
+	.long	0x7f2
+	.uleb128 0x1
+	.long	0x7e8
+	.long	.LLST70
+	.long	.LVUS70
+	.byte	0
+	.uleb128 0x3
+	.long	0x7d7
+	.quad	.LBI1423
+	.value	.LVU664
+	.quad	.LBB1423
+	.quad	.LBE1423-.LBB1423
+	.byte	0x33
+	.value	0x86d
+	.long	0x161e
+	.uleb128 0x2
+	.long	0x7f2
+	.uleb128 0x1
+	.long	0x7e8
+	.long	.LLST71
+	.long	.LVUS71
+	.byte	0
+	.uleb128 0x3
+	.long	0x7d7
+	.quad	.LBI1425
+	.value	.LVU676
+	.quad	.LBB1425
+	.quad	.LBE1425-.LBB1425
+	.byte	0x33
+	.value	0x8d9
+	.long	0x1657
+	.uleb128 0x2
+	.long	0x7f2
+	.uleb128 0x1
+	.long	0x7e8
+	.long	.LLST72
+	.long	.LVUS72
+	.byte	0
+	.uleb128 0x3
+	.long	0x7d7
+	.quad	.LBI1427
+	.value	.LVU686
+	.quad	.LBB1427
+	.quad	.LBE1427-.LBB1427
+	.byte	0x33
+	.value	0x913
+	.long	0x1690
+	.uleb128 0x2
+	.long	0x7f2
+	.uleb128 0x1
+	.long	0x7e8
+	.long	.LLST73
+	.long	.LVUS73
+	.byte	0
+	.uleb128 0x3
+	.long	0x7d7
+	.quad	.LBI1429
+	.value	.LVU696
+	.quad	.LBB1429
+	.quad	.LBE1429-.LBB1429
+	.byte	0x33
+	.value	0x96d
+	.long	0x16c9
+	.uleb128 0x2
+	.long	0x7f2
+	.uleb128 0x1
+	.long	0x7e8
+	.long	.LLST74
+	.long	.LVUS74
+	.byte	0
+	.uleb128 0x3
+	.long	0x7d7
+	.quad	.LBI1431
+	.value	.LVU706
+	.quad	.LBB1431
+	.quad	.LBE1431-.LBB1431
+	.byte	0x33
+	.value	0x9a7
+	.long	0x1702
+	.uleb128 0x2
+	.long	0x7f2
+	.uleb128 0x1
+	.long	0x7e8
+	.long	.LLST75
+	.long	.LVUS75
+	.byte	0
+	.uleb128 0x4
+	.long	0x7d7
+	.quad	.LBI1433
+	.value	.LVU720
+	.quad	.LBB1433
+	.quad	.LBE1433-.LBB1433
+	.byte	0x34
+	.byte	0x4c
+	.long	0x173a
+	.uleb128 0x2
+	.long	0x7f2
+	.uleb128 0x1
+	.long	0x7e8
+	.long	.LLST76
+	.long	.LVUS76
+	.byte	0
+	.uleb128 0x4
+	.long	0x7d7
+	.quad	.LBI1435
+	.value	.LVU730
+	.quad	.LBB1435
+	.quad	.LBE1435-.LBB1435
+	.byte	0x34
+	.byte	0x86
+	.long	0x1772
+	.uleb128 0x2
+	.long	0x7f2
+	.uleb128 0x1
+	.long	0x7e8
+	.long	.LLST77
+	.long	.LVUS77
+	.byte	0
+	.uleb128 0x4
+	.long	0x7d7
+	.quad	.LBI1437
+	.value	.LVU740
+	.quad	.LBB1437
+	.quad	.LBE1437-.LBB1437
+	.byte	0x34
+	.byte	0xdf
+	.long	0x17aa
+	.uleb128 0x2
+	.long	0x7f2
+	.uleb128 0x1
+	.long	0x7e8
+	.long	.LLST78
+	.long	.LVUS78
+	.byte	0
+	.uleb128 0x3
+	.long	0x7d7
+	.quad	.LBI1439
+	.value	.LVU750
+	.quad	.LBB1439
+	.quad	.LBE1439-.LBB1439
+	.byte	0x34
+	.value	0x119
+	.long	0x17e3
+	.uleb128 0x2
+	.long	0x7f2
+	.uleb128 0x1
+	.long	0x7e8
+	.long	.LLST79
+	.long	.LVUS79
+	.byte	0
+	.uleb128 0x3
+	.long	0x7d7
+	.quad	.LBI1441
+	.value	.LVU763
+	.quad	.LBB1441
+	.quad	.LBE1441-.LBB1441
+	.byte	0x34
+	.value	0x184
+	.long	0x181c
+	.uleb128 0x2
+	.long	0x7f2
+	.uleb128 0x1
+	.long	0x7e8
+	.long	.LLST80
+	.long	.LVUS80
+	.byte	0
+	.uleb128 0x3
+	.long	0x7d7
+	.quad	.LBI1443
+	.value	.LVU773
+	.quad	.LBB1443
+	.quad	.LBE1443-.LBB1443
+	.byte	0x34
+	.value	0x1be
+	.long	0x1855
+	.uleb128 0x2
+	.long	0x7f2
+	.uleb128 0x1
+	.long	0x7e8
+	.long	.LLST81
+	.long	.LVUS81
+	.byte	0
+	.uleb128 0x3
+	.long	0x7d7
+	.quad	.LBI1445
+	.value	.LVU783
+	.quad	.LBB1445
+	.quad	.LBE1445-.LBB1445
+	.byte	0x34
+	.value	0x217
+	.long	0x188e
+	.uleb128 0x2
+	.long	0x7f2
+	.uleb128 0x1
+	.long	0x7e8
+	.long	.LLST82
+	.long	.LVUS82
+	.byte	0
+	.uleb128 0x3
+	.long	0x7d7
+	.quad	.LBI1447
+	.value	.LVU793
+	.quad	.LBB1447
+	.quad	.LBE1447-.LBB1447
+	.byte	0x34
+	.value	0x251
+	.long	0x18c7
+	.uleb128 0x2
+	.long	0x7f2
+	.uleb128 0x1
+	.long	0x7e8
+	.long	.LLST83
+	.long	.LVUS83
+	.byte	0
+	.uleb128 0x3
+	.long	0x7d7
+	.quad	.LBI1449
+	.value	.LVU806
+	.quad	.LBB1449
+	.quad	.LBE1449-.LBB1449
+	.byte	0x34
+	.value	0x2bc
+	.long	0x1900
+	.uleb128 0x2
+	.long	0x7f2
+	.uleb128 0x1
+	.long	0x7e8
+	.long	.LLST84
+	.long	.LVUS84
+	.byte	0
+	.uleb128 0x3
+	.long	0x7d7
+	.quad	.LBI1451
+	.value	.LVU819
+	.quad	.LBB1451
+	.quad	.LBE1451-.LBB1451
+	.byte	0x34
+	.value	0x2f6
+	.long	0x1939
+	.uleb128 0x2
+	.long	0x7f2
+	.uleb128 0x1
+	.long	0x7e8
+	.long	.LLST85
+	.long	.LVUS85
+	.byte	0
+	.uleb128 0x3
+	.long	0x7d7
+	.quad	.LBI1453
+	.value	.LVU829
+	.quad	.LBB1453
+	.quad	.LBE1453-.LBB1453
+	.byte	0x34
+	.value	0x34f
+	.long	0x1972
+	.uleb128 0x2
+	.long	0x7f2
+	.uleb128 0x1
+	.long	0x7e8
+	.long	.LLST86
+	.long	.LVUS86
+	.byte	0
+	.uleb128 0x3
+	.long	0x7d7
+	.quad	.LBI1455
+	.value	.LVU839
+	.quad	.LBB1455
+	.quad	.LBE1455-.LBB1455
+	.byte	0x34
+	.value	0x389
+	.long	0x19ab
+	.uleb128 0x2
+	.long	0x7f2
+	.uleb128 0x1
+	.long	0x7e8
+	.long	.LLST87
+	.long	.LVUS87
+	.byte	0
+	.uleb128 0x3
+	.long	0x7d7
+	.quad	.LBI1457
+	.value	.LVU851
+	.quad	.LBB1457
+	.quad	.LBE1457-.LBB1457
+	.byte	0x34
+	.value	0x3f4
+	.long	0x19ec
+	.uleb128 0x1
+	.long	0x7f2
+	.long	.LLST88
+	.long	.LVUS88
+	.uleb128 0x1
+	.long	0x7e8
+	.long	.LLST89
+	.long	.LVUS89
+	.byte	0
+	.uleb128 0x3
+	.long	0x7d7
+	.quad	.LBI1459
+	.value	.LVU861
+	.quad	.LBB1459
+	.quad	.LBE1459-.LBB1459
+	.byte	0x34
+	.value	0x42e
+	.long	0x1a25
+	.uleb128 0x2
+	.long	0x7f2
+	.uleb128 0x1
+	.long	0x7e8
+	.long	.LLST90
+	.long	.LVUS90
+	.byte	0
+	.uleb128 0x3
+	.long	0x7d7
+	.quad	.LBI1461
+	.value	.LVU871
+	.quad	.LBB1461
+	.quad	.LBE1461-.LBB1461
+	.byte	0x34
+	.value	0x487
+	.long	0x1a5e
+	.uleb128 0x2
+	.long	0x7f2
+	.uleb128 0x1
+	.long	0x7e8
+	.long	.LLST91
+	.long	.LVUS91
+	.byte	0
+	.uleb128 0x3
+	.long	0x7d7
+	.quad	.LBI1463
+	.value	.LVU881
+	.quad	.LBB1463
+	.quad	.LBE1463-.LBB1463
+	.byte	0x34
+	.value	0x4c1
+	.long	0x1a97
+	.uleb128 0x2
+	.long	0x7f2
+	.uleb128 0x1
+	.long	0x7e8
+	.long	.LLST92
+	.long	.LVUS92
+	.byte	0
+	.uleb128 0x3
+	.long	0x7d7
+	.quad	.LBI1465
+	.value	.LVU893
+	.quad	.LBB1465
+	.quad	.LBE1465-.LBB1465
+	.byte	0x34
+	.value	0x52c
+	.long	0x1ad0
+	.uleb128 0x2
+	.long	0x7f2
+	.uleb128 0x1
+	.long	0x7e8
+	.long	.LLST93
+	.long	.LVUS93
+	.byte	0
+	.uleb128 0x3
+	.long	0x7d7
+	.quad	.LBI1467
+	.value	.LVU903
+	.quad	.LBB1467
+	.quad	.LBE1467-.LBB1467
+	.byte	0x34
+	.value	0x566
+	.long	0x1b09
+	.uleb128 0x2
+	.long	0x7f2
+	.uleb128 0x1
+	.long	0x7e8
+	.long	.LLST94
+	.long	.LVUS94
+	.byte	0
+	.uleb128 0x3
+	.long	0x7d7
+	.quad	.LBI1469
+	.value	.LVU913
+	.quad	.LBB1469
+	.quad	.LBE1469-.LBB1469
+	.byte	0x34
+	.value	0x5bf
+	.long	0x1b42
+	.uleb128 0x2
+	.long	0x7f2
+	.uleb128 0x1
+	.long	0x7e8
+	.long	.LLST95
+	.long	.LVUS95
+	.byte	0
+	.uleb128 0x5
+	.long	0x7d7
+	.quad	.LBI1471
+	.value	.LVU923
+	.long	.LLRL96
+	.byte	0x34
+	.value	0x5f9
+	.long	0x1b6f
+	.uleb128 0x2
+	.long	0x7f2
+	.uleb128 0x1
+	.long	0x7e8
+	.long	.LLST97
+	.long	.LVUS97
+	.byte	0
+	.uleb128 0x3
+	.long	0x7d7
+	.quad	.LBI1475
+	.value	.LVU935
+	.quad	.LBB1475
+	.quad	.LBE1475-.LBB1475
+	.byte	0x34
+	.value	0x665
+	.long	0x1ba8
+	.uleb128 0x2
+	.long	0x7f2
+	.uleb128 0x1
+	.long	0x7e8
+	.long	.LLST98
+	.long	.LVUS98
+	.byte	0
+	.uleb128 0x3
+	.long	0x7d7
+	.quad	.LBI1477
+	.value	.LVU945
+	.quad	.LBB1477
+	.quad	.LBE1477-.LBB1477
+	.byte	0x34
+	.value	0x69f
+	.long	0x1be1
+	.uleb128 0x2
+	.long	0x7f2
+	.uleb128 0x1
+	.long	0x7e8
+	.long	.LLST99
+	.long	.LVUS99
+	.byte	0
+	.uleb128 0x3
+	.long	0x7d7
+	.quad	.LBI1479
+	.value	.LVU955
+	.quad	.LBB1479
+	.quad	.LBE1479-.LBB1479
+	.byte	0x34
+	.value	0x6f9
+	.long	0x1c1a
+	.uleb128 0x2
+	.long	0x7f2
+	.uleb128 0x1
+	.long	0x7e8
+	.long	.LLST100
+	.long	.LVUS100
+	.byte	0
+	.uleb128 0x3
+	.long	0x7d7
+	.quad	.LBI1481
+	.value	.LVU965
+	.quad	.LBB1481
+	.quad	.LBE1481-.LBB1481
+	.byte	0x34
+	.value	0x733
+	.long	0x1c53
+	.uleb128 0x2
+	.long	0x7f2
+	.uleb128 0x1
+	.long	0x7e8
+	.long	.LLST101
+	.long	.LVUS101
+	.byte	0
+	.uleb128 0x3
+	.long	0x7d7
+	.quad	.LBI1483
+	.value	.LVU979
+	.quad	.LBB1483
+	.quad	.LBE1483-.LBB1483
+	.byte	0x34
+	.value	0x79f
+	.long	0x1c8c
+	.uleb128 0x2
+	.long	0x7f2
+	.uleb128 0x1
+	.long	0x7e8
+	.long	.LLST102
+	.long	.LVUS102
+	.byte	0
+	.uleb128 0x3
+	.long	0x7d7
+	.quad	.LBI1485
+	.value	.LVU990
+	.quad	.LBB1485
+	.quad	.LBE1485-.LBB1485
+	.byte	0x34
+	.value	0x7d9
+	.long	0x1cc5
+	.uleb128 0x2
+	.long	0x7f2
+	.uleb128 0x1
+	.long	0x7e8
+	.long	.LLST103
+	.long	.LVUS103
+	.byte	0
+	.uleb128 0x3
+	.long	0x7d7
+	.quad	.LBI1487
+	.value	.LVU1000
+	.quad	.LBB1487
+	.quad	.LBE1487-.LBB1487
+	.byte	0x34
+	.value	0x833
+	.long	0x1cfe
+	.uleb128 0x2
+	.long	0x7f2
+	.uleb128 0x1
+	.long	0x7e8
+	.long	.LLST104
+	.long	.LVUS104
+	.byte	0
+	.uleb128 0x3
+	.long	0x7d7
+	.quad	.LBI1489
+	.value	.LVU1010
+	.quad	.LBB1489
+	.quad	.LBE1489-.LBB1489
+	.byte	0x34
+	.value	0x86d
+	.long	0x1d37
+	.uleb128 0x2
+	.long	0x7f2
+	.uleb128 0x1
+	.long	0x7e8
+	.long	.LLST105
+	.long	.LVUS105
+	.byte	0
+	.uleb128 0x3
+	.long	0x7d7
+	.quad	.LBI1491
+	.value	.LVU1022
+	.quad	.LBB1491
+	.quad	.LBE1491-.LBB1491
+	.byte	0x34
+	.value	0x8d9
+	.long	0x1d70
+	.uleb128 0x2
+	.long	0x7f2
+	.uleb128 0x1
+	.long	0x7e8
+	.long	.LLST106
+	.long	.LVUS106
+	.byte	0
+	.uleb128 0x3
+	.long	0x7d7
+	.quad	.LBI1493
+	.value	.LVU1032
+	.quad	.LBB1493
+	.quad	.LBE1493-.LBB1493
+	.byte	0x34
+	.value	0x913
+	.long	0x1da9
+	.uleb128 0x2
+	.long	0x7f2
+	.uleb128 0x1
+	.long	0x7e8
+	.long	.LLST107
+	.long	.LVUS107
+	.byte	0
+	.uleb128 0x3
+	.long	0x7d7
+	.quad	.LBI1495
+	.value	.LVU1042
+	.quad	.LBB1495
+	.quad	.LBE1495-.LBB1495
+	.byte	0x34
+	.value	0x96d
+	.long	0x1de2
+	.uleb128 0x2
+	.long	0x7f2
+	.uleb128 0x1
+	.long	0x7e8
+	.long	.LLST108
+	.long	.LVUS108
+	.byte	0
+	.uleb128 0x3
+	.long	0x7d7
+	.quad	.LBI1497
+	.value	.LVU1052
+	.quad	.LBB1497
+	.quad	.LBE1497-.LBB1497
+	.byte	0x34
+	.value	0x9a7
+	.long	0x1e1b
+	.uleb128 0x2
+	.long	0x7f2
+	.uleb128 0x1
+	.long	0x7e8
+	.long	.LLST109
+	.long	.LVUS109
+	.byte	0
+	.uleb128 0x4
+	.long	0x7d7
+	.quad	.LBI1499
+	.value	.LVU1066
+	.quad	.LBB1499
+	.quad	.LBE1499-.LBB1499
+	.byte	0x35
+	.byte	0x4c
+	.long	0x1e53
+	.uleb128 0x2
+	.long	0x7f2
+	.uleb128 0x1
+	.long	0x7e8
+	.long	.LLST110
+	.long	.LVUS110
+	.byte	0
+	.uleb128 0x4
+	.long	0x7d7
+	.quad	.LBI1501
+	.value	.LVU1076
+	.quad	.LBB1501
+	.quad	.LBE1501-.LBB1501
+	.byte	0x35
+	.byte	0x86
+	.long	0x1e8b
+	.uleb128 0x2
+	.long	0x7f2
+	.uleb128 0x1
+	.long	0x7e8
+	.long	.LLST111
+	.long	.LVUS111
+	.byte	0
+	.uleb128 0x4
+	.long	0x7d7
+	.quad	.LBI1503
+	.value	.LVU1086
+	.quad	.LBB1503
+	.quad	.LBE1503-.LBB1503
+	.byte	0x35
+	.byte	0xdf
+	.long	0x1ec3
+	.uleb128 0x2
+	.long	0x7f2
+	.uleb128 0x1
+	.long	0x7e8
+	.long	.LLST112
+	.long	.LVUS112
+	.byte	0
+	.uleb128 0x3
+	.long	0x7d7
+	.quad	.LBI1505
+	.value	.LVU1096
+	.quad	.LBB1505
+	.quad	.LBE1505-.LBB1505
+	.byte	0x35
+	.value	0x119
+	.long	0x1efc
+	.uleb128 0x2
+	.long	0x7f2
+	.uleb128 0x1
+	.long	0x7e8
+	.long	.LLST113
+	.long	.LVUS113
+	.byte	0
+	.uleb128 0x3
+	.long	0x7d7
+	.quad	.LBI1507
+	.value	.LVU1109
+	.quad	.LBB1507
+	.quad	.LBE1507-.LBB1507
+	.byte	0x35
+	.value	0x184
+	.long	0x1f35
+	.uleb128 0x2
+	.long	0x7f2
+	.uleb128 0x1
+	.long	0x7e8
+	.long	.LLST114
+	.long	.LVUS114
+	.byte	0
+	.uleb128 0x3
+	.long	0x7d7
+	.quad	.LBI1509
+	.value	.LVU1119
+	.quad	.LBB1509
+	.quad	.LBE1509-.LBB1509
+	.byte	0x35
+	.value	0x1be
+	.long	0x1f6e
+	.uleb128 0x2
+	.long	0x7f2
+	.uleb128 0x1
+	.long	0x7e8
+	.long	.LLST115
+	.long	.LVUS115
+	.byte	0
+	.uleb128 0x3
+	.long	0x7d7
+	.quad	.LBI1511
+	.value	.LVU1129
+	.quad	.LBB1511
+	.quad	.LBE1511-.LBB1511
+	.byte	0x35
+	.value	0x217
+	.long	0x1fa7
+	.uleb128 0x2
+	.long	0x7f2
+	.uleb128 0x1
+	.long	0x7e8
+	.long	.LLST116
+	.long	.LVUS116
+	.byte	0
+	.uleb128 0x3
+	.long	0x7d7
+	.quad	.LBI1513
+	.value	.LVU1139
+	.quad	.LBB1513
+	.quad	.LBE1513-.LBB1513
+	.byte	0x35
+	.value	0x251
+	.long	0x1fe0
+	.uleb128 0x2
+	.long	0x7f2
+	.uleb128 0x1
+	.long	0x7e8
+	.long	.LLST117
+	.long	.LVUS117
+	.byte	0
+	.uleb128 0x3
+	.long	0x7d7
+	.quad	.LBI1515
+	.value	.LVU1153
+	.quad	.LBB1515
+	.quad	.LBE1515-.LBB1515
+	.byte	0x35
+	.value	0x2bc
+	.long	0x2019
+	.uleb128 0x2
+	.long	0x7f2
+	.uleb128 0x1
+	.long	0x7e8
+	.long	.LLST118
+	.long	.LVUS118
+	.byte	0
+	.uleb128 0x3
+	.long	0x7d7
+	.quad	.LBI1517
+	.value	.LVU1163
+	.quad	.LBB1517
+	.quad	.LBE1517-.LBB1517
+	.byte	0x35
+	.value	0x2f6
+	.long	0x2052
+	.uleb128 0x2
+	.long	0x7f2
+	.uleb128 0x1
+	.long	0x7e8
+	.long	.LLST119
+	.long	.LVUS119
+	.byte	0
+	.uleb128 0x3
+	.long	0x7d7
+	.quad	.LBI1519
+	.value	.LVU1173
+	.quad	.LBB1519
+	.quad	.LBE1519-.LBB1519
+	.byte	0x35
+	.value	0x34f
+	.long	0x208b
+	.uleb128 0x2
+	.long	0x7f2
+	.uleb128 0x1
+	.long	0x7e8
+	.long	.LLST120
+	.long	.LVUS120
+	.byte	0
+	.uleb128 0x5
+	.long	0x7d7
+	.quad	.LBI1521
+	.value	.LVU1184
+	.long	.LLRL121
+	.byte	0x35
+	.value	0x389
+	.long	0x20b8
+	.uleb128 0x2
+	.long	0x7f2
+	.uleb128 0x1
+	.long	0x7e8
+	.long	.LLST122
+	.long	.LVUS122
+	.byte	0
+	.uleb128 0x3
+	.long	0x7d7
+	.quad	.LBI1525
+	.value	.LVU1197
+	.quad	.LBB1525
+	.quad	.LBE1525-.LBB1525
+	.byte	0x35
+	.value	0x3f4
+	.long	0x20f9
+	.uleb128 0x1
+	.long	0x7f2
+	.long	.LLST123
+	.long	.LVUS123
+	.uleb128 0x1
+	.long	0x7e8
+	.long	.LLST124
+	.long	.LVUS124
+	.byte	0
+	.uleb128 0x3
+	.long	0x7d7
+	.quad	.LBI1527
+	.value	.LVU1207
+	.quad	.LBB1527
+	.quad	.LBE1527-.LBB1527
+	.byte	0x35
+	.value	0x42e
+	.long	0x2132
+	.uleb128 0x2
+	.long	0x7f2
+	.uleb128 0x1
+	.long	0x7e8
+	.long	.LLST125
+	.long	.LVUS125
+	.byte	0
+	.uleb128 0x3
+	.long	0x7d7
+	.quad	.LBI1529
+	.value	.LVU1217
+	.quad	.LBB1529
+	.quad	.LBE1529-.LBB1529
+	.byte	0x35
+	.value	0x487
+	.long	0x216b
+	.uleb128 0x2
+	.long	0x7f2
+	.uleb128 0x1
+	.long	0x7e8
+	.long	.LLST126
+	.long	.LVUS126
+	.byte	0
+	.uleb128 0x3
+	.long	0x7d7
+	.quad	.LBI1531
+	.value	.LVU1227
+	.quad	.LBB1531
+	.quad	.LBE1531-.LBB1531
+	.byte	0x35
+	.value	0x4c1
+	.long	0x21a4
+	.uleb128 0x2
+	.long	0x7f2
+	.uleb128 0x1
+	.long	0x7e8
+	.long	.LLST127
+	.long	.LVUS127
+	.byte	0
+	.uleb128 0x3
+	.long	0x7d7
+	.quad	.LBI1533
+	.value	.LVU1239
+	.quad	.LBB1533
+	.quad	.LBE1533-.LBB1533
+	.byte	0x35
+	.value	0x52c
+	.long	0x21dd
+	.uleb128 0x2
+	.long	0x7f2
+	.uleb128 0x1
+	.long	0x7e8
+	.long	.LLST128
+	.long	.LVUS128
+	.byte	0
+	.uleb128 0x3
+	.long	0x7d7
+	.quad	.LBI1535
+	.value	.LVU1249
+	.quad	.LBB1535
+	.quad	.LBE1535-.LBB1535
+	.byte	0x35
+	.value	0x566
+	.long	0x2216
+	.uleb128 0x2
+	.long	0x7f2
+	.uleb128 0x1
+	.long	0x7e8
+	.long	.LLST129
+	.long	.LVUS129
+	.byte	0
+	.uleb128 0x3
+	.long	0x7d7
+	.quad	.LBI1537
+	.value	.LVU1259
+	.quad	.LBB1537
+	.quad	.LBE1537-.LBB1537
+	.byte	0x35
+	.value	0x5bf
+	.long	0x224f
+	.uleb128 0x2
+	.long	0x7f2
+	.uleb128 0x1
+	.long	0x7e8
+	.long	.LLST130
+	.long	.LVUS130
+	.byte	0
+	.uleb128 0x3
+	.long	0x7d7
+	.quad	.LBI1539
+	.value	.LVU1268
+	.quad	.LBB1539
+	.quad	.LBE1539-.LBB1539
+	.byte	0x35
+	.value	0x5f9
+	.long	0x2288
+	.uleb128 0x2
+	.long	0x7f2
+	.uleb128 0x1
+	.long	0x7e8
+	.long	.LLST131
+	.long	.LVUS131
+	.byte	0
+	.uleb128 0x3
+	.long	0x7d7
+	.quad	.LBI1541
+	.value	.LVU1282
+	.quad	.LBB1541
+	.quad	.LBE1541-.LBB1541
+	.byte	0x35
+	.value	0x665
+	.long	0x22c1
+	.uleb128 0x2
+	.long	0x7f2
+	.uleb128 0x1
+	.long	0x7e8
+	.long	.LLST132
+	.long	.LVUS132
+	.byte	0
+	.uleb128 0x3
+	.long	0x7d7
+	.quad	.LBI1543
+	.value	.LVU1292
+	.quad	.LBB1543
+	.quad	.LBE1543-.LBB1543
+	.byte	0x35
+	.value	0x69f
+	.long	0x22fa
+	.uleb128 0x2
+	.long	0x7f2
+	.uleb128 0x1
+	.long	0x7e8
+	.long	.LLST133
+	.long	.LVUS133
+	.byte	0
+	.uleb128 0x5
+	.long	0x7d7
+	.quad	.LBI1545
+	.value	.LVU1302
+	.long	.LLRL134
+	.byte	0x35
+	.value	0x6f9
+	.long	0x2327
+	.uleb128 0x2
+	.long	0x7f2
+	.uleb128 0x1
+	.long	0x7e8
+	.long	.LLST135
+	.long	.LVUS135
+	.byte	0
+	.uleb128 0x3
+	.long	0x7d7
+	.quad	.LBI1549
+	.value	.LVU1313
+	.quad	.LBB1549
+	.quad	.LBE1549-.LBB1549
+	.byte	0x35
+	.value	0x733
+	.long	0x2360
+	.uleb128 0x2
+	.long	0x7f2
+	.uleb128 0x1
+	.long	0x7e8
+	.long	.LLST136
+	.long	.LVUS136
+	.byte	0
+	.uleb128 0x3
+	.long	0x7d7
+	.quad	.LBI1551
+	.value	.LVU1327
+	.quad	.LBB1551
+	.quad	.LBE1551-.LBB1551
+	.byte	0x35
+	.value	0x79f
+	.long	0x2399
+	.uleb128 0x2
+	.long	0x7f2
+	.uleb128 0x1
+	.long	0x7e8
+	.long	.LLST137
+	.long	.LVUS137
+	.byte	0
+	.uleb128 0x3
+	.long	0x7d7
+	.quad	.LBI1553
+	.value	.LVU1338
+	.quad	.LBB1553
+	.quad	.LBE1553-.LBB1553
+	.byte	0x35
+	.value	0x7d9
+	.long	0x23d2
+	.uleb128 0x2
+	.long	0x7f2
+	.uleb128 0x1
+	.long	0x7e8
+	.long	.LLST138
+	.long	.LVUS138
+	.byte	0
+	.uleb128 0x3
+	.long	0x7d7
+	.quad	.LBI1555
+	.value	.LVU1348
+	.quad	.LBB1555
+	.quad	.LBE1555-.LBB1555
+	.byte	0x35
+	.value	0x833
+	.long	0x240b
+	.uleb128 0x2
+	.long	0x7f2
+	.uleb128 0x1
+	.long	0x7e8
+	.long	.LLST139
+	.long	.LVUS139
+	.byte	0
+	.uleb128 0x3
+	.long	0x7d7
+	.quad	.LBI1557
+	.value	.LVU1358
+	.quad	.LBB1557
+	.quad	.LBE1557-.LBB1557
+	.byte	0x35
+	.value	0x86d
+	.long	0x2444
+	.uleb128 0x2
+	.long	0x7f2
+	.uleb128 0x1
+	.long	0x7e8
+	.long	.LLST140
+	.long	.LVUS140
+	.byte	0
+	.uleb128 0x3
+	.long	0x7d7
+	.quad	.LBI1559
+	.value	.LVU1370
+	.quad	.LBB1559
+	.quad	.LBE1559-.LBB1559
+	.byte	0x35
+	.value	0x8d9
+	.long	0x247d
+	.uleb128 0x2
+	.long	0x7f2
+	.uleb128 0x1
+	.long	0x7e8
+	.long	.LLST141
+	.long	.LVUS141
+	.byte	0
+	.uleb128 0x3
+	.long	0x7d7
+	.quad	.LBI1561
+	.value	.LVU1380
+	.quad	.LBB1561
+	.quad	.LBE1561-.LBB1561
+	.byte	0x35
+	.value	0x913
+	.long	0x24b6
+	.uleb128 0x2
+	.long	0x7f2
+	.uleb128 0x1
+	.long	0x7e8
+	.long	.LLST142
+	.long	.LVUS142
+	.byte	0
+	.uleb128 0x3
+	.long	0x7d7
+	.quad	.LBI1563
+	.value	.LVU1390
+	.quad	.LBB1563
+	.quad	.LBE1563-.LBB1563
+	.byte	0x35
+	.value	0x96d
+	.long	0x24ef
+	.uleb128 0x2
+	.long	0x7f2
+	.uleb128 0x1
+	.long	0x7e8
+	.long	.LLST143
+	.long	.LVUS143
+	.byte	0
+	.uleb128 0x3
+	.long	0x7d7
+	.quad	.LBI1565
+	.value	.LVU1400
+	.quad	.LBB1565
+	.quad	.LBE1565-.LBB1565
+	.byte	0x35
+	.value	0x9a7
+	.long	0x2528
+	.uleb128 0x2
+	.long	0x7f2
+	.uleb128 0x1
+	.long	0x7e8
+	.long	.LLST144
+	.long	.LVUS144
+	.byte	0
+	.uleb128 0x4
+	.long	0x7d7
+	.quad	.LBI1567
+	.value	.LVU1414
+	.quad	.LBB1567
+	.quad	.LBE1567-.LBB1567
+	.byte	0x36
+	.byte	0x4c
+	.long	0x2560
+	.uleb128 0x2
+	.long	0x7f2
+	.uleb128 0x1
+	.long	0x7e8
+	.long	.LLST145
+	.long	.LVUS145
+	.byte	0
+	.uleb128 0x4
+	.long	0x7d7
+	.quad	.LBI1569
+	.value	.LVU1424
+	.quad	.LBB1569
+	.quad	.LBE1569-.LBB1569
+	.byte	0x36
+	.byte	0x86
+	.long	0x2598
+	.uleb128 0x2
+	.long	0x7f2
+	.uleb128 0x1
+	.long	0x7e8
+	.long	.LLST146
+	.long	.LVUS146
+	.byte	0
+	.uleb128 0x4
+	.long	0x7d7
+	.quad	.LBI1571
+	.value	.LVU1434
+	.quad	.LBB1571
+	.quad	.LBE1571-.LBB1571
+	.byte	0x36
+	.byte	0xdf
+	.long	0x25d0
+	.uleb128 0x2
+	.long	0x7f2
+	.uleb128 0x1
+	.long	0x7e8
+	.long	.LLST147
+	.long	.LVUS147
+	.byte	0
+	.uleb128 0x3
+	.long	0x7d7
+	.quad	.LBI1573
+	.value	.LVU1444
+	.quad	.LBB1573
+	.quad	.LBE1573-.LBB1573
+	.byte	0x36
+	.value	0x119
+	.long	0x2609
+	.uleb128 0x2
+	.long	0x7f2
+	.uleb128 0x1
+	.long	0x7e8
+	.long	.LLST148
+	.long	.LVUS148
+	.byte	0
+	.uleb128 0x3
+	.long	0x7d7
+	.quad	.LBI1575
+	.value	.LVU1458
+	.quad	.LBB1575
+	.quad	.LBE1575-.LBB1575
+	.byte	0x36
+	.value	0x184
+	.long	0x2642
+	.uleb128 0x2
+	.long	0x7f2
+	.uleb128 0x1
+	.long	0x7e8
+	.long	.LLST149
+	.long	.LVUS149
+	.byte	0
+	.uleb128 0x3
+	.long	0x7d7
+	.quad	.LBI1577
+	.value	.LVU1468
+	.quad	.LBB1577
+	.quad	.LBE1577-.LBB1577
+	.byte	0x36
+	.value	0x1be
+	.long	0x267b
+	.uleb128 0x2
+	.long	0x7f2
+	.uleb128 0x1
+	.long	0x7e8
+	.long	.LLST150
+	.long	.LVUS150
+	.byte	0
+	.uleb128 0x3
+	.long	0x7d7
+	.quad	.LBI1579
+	.value	.LVU1478
+	.quad	.LBB1579
+	.quad	.LBE1579-.LBB1579
+	.byte	0x36
+	.value	0x217
+	.long	0x26b4
+	.uleb128 0x2
+	.long	0x7f2
+	.uleb128 0x1
+	.long	0x7e8
+	.long	.LLST151
+	.long	.LVUS151
+	.byte	0
+	.uleb128 0x3
+	.long	0x7d7
+	.quad	.LBI1581
+	.value	.LVU1488
+	.quad	.LBB1581
+	.quad	.LBE1581-.LBB1581
+	.byte	0x36
+	.value	0x251
+	.long	0x26ed
+	.uleb128 0x2
+	.long	0x7f2
+	.uleb128 0x1
+	.long	0x7e8
+	.long	.LLST152
+	.long	.LVUS152
+	.byte	0
+	.uleb128 0x3
+	.long	0x7d7
+	.quad	.LBI1583
+	.value	.LVU1502
+	.quad	.LBB1583
+	.quad	.LBE1583-.LBB1583
+	.byte	0x36
+	.value	0x2bc
+	.long	0x2726
+	.uleb128 0x2
+	.long	0x7f2
+	.uleb128 0x1
+	.long	0x7e8
+	.long	.LLST153
+	.long	.LVUS153
+	.byte	0
+	.uleb128 0x3
+	.long	0x7d7
+	.quad	.LBI1585
+	.value	.LVU1512
+	.quad	.LBB1585
+	.quad	.LBE1585-.LBB1585
+	.byte	0x36
+	.value	0x2f6
+	.long	0x275f
+	.uleb128 0x2
+	.long	0x7f2
+	.uleb128 0x1
+	.long	0x7e8
+	.long	.LLST154
+	.long	.LVUS154
+	.byte	0
+	.uleb128 0x3
+	.long	0x7d7
+	.quad	.LBI1587
+	.value	.LVU1522
+	.quad	.LBB1587
+	.quad	.LBE1587-.LBB1587
+	.byte	0x36
+	.value	0x34f
+	.long	0x2798
+	.uleb128 0x2
+	.long	0x7f2
+	.uleb128 0x1
+	.long	0x7e8
+	.long	.LLST155
+	.long	.LVUS155
+	.byte	0
+	.uleb128 0x3
+	.long	0x7d7
+	.quad	.LBI1589
+	.value	.LVU1532
+	.quad	.LBB1589
+	.quad	.LBE1589-.LBB1589
+	.byte	0x36
+	.value	0x389
+	.long	0x27d1
+	.uleb128 0x2
+	.long	0x7f2
+	.uleb128 0x1
+	.long	0x7e8
+	.long	.LLST156
+	.long	.LVUS156
+	.byte	0
+	.uleb128 0x3
+	.long	0x7d7
+	.quad	.LBI1591
+	.value	.LVU1544
+	.quad	.LBB1591
+	.quad	.LBE1591-.LBB1591
+	.byte	0x36
+	.value	0x3f4
+	.long	0x2812
+	.uleb128 0x1
+	.long	0x7f2
+	.long	.LLST157
+	.long	.LVUS157
+	.uleb128 0x1
+	.long	0x7e8
+	.long	.LLST158
+	.long	.LVUS158
+	.byte	0
+	.uleb128 0x3
+	.long	0x7d7
+	.quad	.LBI1593
+	.value	.LVU1554
+	.quad	.LBB1593
+	.quad	.LBE1593-.LBB1593
+	.byte	0x36
+	.value	0x42e
+	.long	0x284b
+	.uleb128 0x2
+	.long	0x7f2
+	.uleb128 0x1
+	.long	0x7e8
+	.long	.LLST159
+	.long	.LVUS159
+	.byte	0
+	.uleb128 0x3
+	.long	0x7d7
+	.quad	.LBI1595
+	.value	.LVU1564
+	.quad	.LBB1595
+	.quad	.LBE1595-.LBB1595
+	.byte	0x36
+	.value	0x487
+	.long	0x2884
+	.uleb128 0x2
+	.long	0x7f2
+	.uleb128 0x1
+	.long	0x7e8
+	.long	.LLST160
+	.long	.LVUS160
+	.byte	0
+	.uleb128 0x3
+	.long	0x7d7
+	.quad	.LBI1597
+	.value	.LVU1574
+	.quad	.LBB1597
+	.quad	.LBE1597-.LBB1597
+	.byte	0x36
+	.value	0x4c1
+	.long	0x28bd
+	.uleb128 0x2
+	.long	0x7f2
+	.uleb128 0x1
+	.long	0x7e8
+	.long	.LLST161
+	.long	.LVUS161
+	.byte	0
+	.uleb128 0x3
+	.long	0x7d7
+	.quad	.LBI1599
+	.value	.LVU1586
+	.quad	.LBB1599
+	.quad	.LBE1599-.LBB1599
+	.byte	0x36
+	.value	0x52c
+	.long	0x28f6
+	.uleb128 0x2
+	.long	0x7f2
+	.uleb128 0x1
+	.long	0x7e8
+	.long	.LLST162
+	.long	.LVUS162
+	.byte	0
+	.uleb128 0x3
+	.long	0x7d7
+	.quad	.LBI1601
+	.value	.LVU1596
+	.quad	.LBB1601
+	.quad	.LBE1601-.LBB1601
+	.byte	0x36
+	.value	0x566
+	.long	0x292f
+	.uleb128 0x2
+	.long	0x7f2
+	.uleb128 0x1
+	.long	0x7e8
+	.long	.LLST163
+	.long	.LVUS163
+	.byte	0
+	.uleb128 0x3
+	.long	0x7d7
+	.quad	.LBI1603
+	.value	.LVU1606
+	.quad	.LBB1603
+	.quad	.LBE1603-.LBB1603
+	.byte	0x36
+	.value	0x5bf
+	.long	0x2968
+	.uleb128 0x2
+	.long	0x7f2
+	.uleb128 0x1
+	.long	0x7e8
+	.long	.LLST164
+	.long	.LVUS164
+	.byte	0
+	.uleb128 0x3
+	.long	0x7d7
+	.quad	.LBI1605
+	.value	.LVU1615
+	.quad	.LBB1605
+	.quad	.LBE1605-.LBB1605
+	.byte	0x36
+	.value	0x5f9
+	.long	0x29a1
+	.uleb128 0x2
+	.long	0x7f2
+	.uleb128 0x1
+	.long	0x7e8
+	.long	.LLST165
+	.long	.LVUS165
+	.byte	0
+	.uleb128 0x3
+	.long	0x7d7
+	.quad	.LBI1607
+	.value	.LVU1629
+	.quad	.LBB1607
+	.quad	.LBE1607-.LBB1607
+	.byte	0x36
+	.value	0x665
+	.long	0x29da
+	.uleb128 0x2
+	.long	0x7f2
+	.uleb128 0x1
+	.long	0x7e8
+	.long	.LLST166
+	.long	.LVUS166
+	.byte	0
+	.uleb128 0x3
+	.long	0x7d7
+	.quad	.LBI1609
+	.value	.LVU1639
+	.quad	.LBB1609
+	.quad	.LBE1609-.LBB1609
+	.byte	0x36
+	.value	0x69f
+	.long	0x2a13
+	.uleb128 0x2
+	.long	0x7f2
+	.uleb128 0x1
+	.long	0x7e8
+	.long	.LLST167
+	.long	.LVUS167
+	.byte	0
+	.uleb128 0x3
+	.long	0x7d7
+	.quad	.LBI1611
+	.value	.LVU1649
+	.quad	.LBB1611
+	.quad	.LBE1611-.LBB1611
+	.byte	0x36
+	.value	0x6f9
+	.long	0x2a4c
+	.uleb128 0x2
+	.long	0x7f2
+	.uleb128 0x1
+	.long	0x7e8
+	.long	.LLST168
+	.long	.LVUS168
+	.byte	0
+	.uleb128 0x3
+	.long	0x7d7
+	.quad	.LBI1613
+	.value	.LVU1659
+	.quad	.LBB1613
+	.quad	.LBE1613-.LBB1613
+	.byte	0x36
+	.value	0x733
+	.long	0x2a85
+	.uleb128 0x2
+	.long	0x7f2
+	.uleb128 0x1
+	.long	0x7e8
+	.long	.LLST169
+	.long	.LVUS169
+	.byte	0
+	.uleb128 0x5
+	.long	0x7d7
+	.quad	.LBI1615
+	.value	.LVU1670
+	.long	.LLRL170
+	.byte	0x36
+	.value	0x79f
+	.long	0x2aba
+	.uleb128 0x1
+	.long	0x7f2
+	.long	.LLST171
+	.long	.LVUS171
+	.uleb128 0x1
+	.long	0x7e8
+	.long	.LLST172
+	.long	.LVUS172
+	.byte	0
+	.uleb128 0x3
+	.long	0x7d7
+	.quad	.LBI1619
+	.value	.LVU1684
+	.quad	.LBB1619
+	.quad	.LBE1619-.LBB1619
+	.byte	0x36
+	.value	0x7d9
+	.long	0x2af3
+	.uleb128 0x2
+	.long	0x7f2
+	.uleb128 0x1
+	.long	0x7e8
+	.long	.LLST173
+	.long	.LVUS173
+	.byte	0
+	.uleb128 0x3
+	.long	0x7d7
+	.quad	.LBI1621
+	.value	.LVU1694
+	.quad	.LBB1621
+	.quad	.LBE1621-.LBB1621
+	.byte	0x36
+	.value	0x833
+	.long	0x2b2c
+	.uleb128 0x2
+	.long	0x7f2
+	.uleb128 0x1
+	.long	0x7e8
+	.long	.LLST174
+	.long	.LVUS174
+	.byte	0
+	.uleb128 0x3
+	.long	0x7d7
+	.quad	.LBI1623
+	.value	.LVU1704
+	.quad	.LBB1623
+	.quad	.LBE1623-.LBB1623
+	.byte	0x36
+	.value	0x86d
+	.long	0x2b65
+	.uleb128 0x2
+	.long	0x7f2
+	.uleb128 0x1
+	.long	0x7e8
+	.long	.LLST175
+	.long	.LVUS175
+	.byte	0
+	.uleb128 0x3
+	.long	0x7d7
+	.quad	.LBI1625
+	.value	.LVU1716
+	.quad	.LBB1625
+	.quad	.LBE1625-.LBB1625
+	.byte	0x36
+	.value	0x8d9
+	.long	0x2b9e
+	.uleb128 0x2
+	.long	0x7f2
+	.uleb128 0x1
+	.long	0x7e8
+	.long	.LLST176
+	.long	.LVUS176
+	.byte	0
+	.uleb128 0x3
+	.long	0x7d7
+	.quad	.LBI1627
+	.value	.LVU1726
+	.quad	.LBB1627
+	.quad	.LBE1627-.LBB1627
+	.byte	0x36
+	.value	0x913
+	.long	0x2bd7
+	.uleb128 0x2
+	.long	0x7f2
+	.uleb128 0x1
+	.long	0x7e8
+	.long	.LLST177
+	.long	.LVUS177
+	.byte	0
+	.uleb128 0x3
+	.long	0x7d7
+	.quad	.LBI1629
+	.value	.LVU1736
+	.quad	.LBB1629
+	.quad	.LBE1629-.LBB1629
+	.byte	0x36
+	.value	0x96d
+	.long	0x2c10
+	.uleb128 0x2
+	.long	0x7f2
+	.uleb128 0x1
+	.long	0x7e8
+	.long	.LLST178
+	.long	.LVUS178
+	.byte	0
+	.uleb128 0x3
+	.long	0x7d7
+	.quad	.LBI1631
+	.value	.LVU1746
+	.quad	.LBB1631
+	.quad	.LBE1631-.LBB1631
+	.byte	0x36
+	.value	0x9a7
+	.long	0x2c49
+	.uleb128 0x2
+	.long	0x7f2
+	.uleb128 0x1
+	.long	0x7e8
+	.long	.LLST179
+	.long	.LVUS179
+	.byte	0
+	.uleb128 0x4
+	.long	0x7d7
+	.quad	.LBI1633
+	.value	.LVU1760
+	.quad	.LBB1633
+	.quad	.LBE1633-.LBB1633
+	.byte	0x37
+	.byte	0x4c
+	.long	0x2c81
+	.uleb128 0x2
+	.long	0x7f2
+	.uleb128 0x1
+	.long	0x7e8
+	.long	.LLST180
+	.long	.LVUS180
+	.byte	0
+	.uleb128 0x4
+	.long	0x7d7
+	.quad	.LBI1635
+	.value	.LVU1770
+	.quad	.LBB1635
+	.quad	.LBE1635-.LBB1635
+	.byte	0x37
+	.byte	0x86
+	.long	0x2cb9
+	.uleb128 0x2
+	.long	0x7f2
+	.uleb128 0x1
+	.long	0x7e8
+	.long	.LLST181
+	.long	.LVUS181
+	.byte	0
+	.uleb128 0x4
+	.long	0x7d7
+	.quad	.LBI1637
+	.value	.LVU1780
+	.quad	.LBB1637
+	.quad	.LBE1637-.LBB1637
+	.byte	0x37
+	.byte	0xdf
+	.long	0x2cf1
+	.uleb128 0x2
+	.long	0x7f2
+	.uleb128 0x1
+	.long	0x7e8
+	.long	.LLST182
+	.long	.LVUS182
+	.byte	0
+	.uleb128 0x5
+	.long	0x7d7
+	.quad	.LBI1639
+	.value	.LVU1791
+	.long	.LLRL183
+	.byte	0x37
+	.value	0x119
+	.long	0x2d1e
+	.uleb128 0x2
+	.long	0x7f2
+	.uleb128 0x1
+	.long	0x7e8
+	.long	.LLST184
+	.long	.LVUS184
+	.byte	0
+	.uleb128 0x3
+	.long	0x7d7
+	.quad	.LBI1643
+	.value	.LVU1803
+	.quad	.LBB1643
+	.quad	.LBE1643-.LBB1643
+	.byte	0x37
+	.value	0x184
+	.long	0x2d57
+	.uleb128 0x2
+	.long	0x7f2
+	.uleb128 0x1
+	.long	0x7e8
+	.long	.LLST185
+	.long	.LVUS185
+	.byte	0
+	.uleb128 0x3
+	.long	0x7d7
+	.quad	.LBI1645
+	.value	.LVU1813
+	.quad	.LBB1645
+	.quad	.LBE1645-.LBB1645
+	.byte	0x37
+	.value	0x1be
+	.long	0x2d90
+	.uleb128 0x2
+	.long	0x7f2
+	.uleb128 0x1
+	.long	0x7e8
+	.long	.LLST186
+	.long	.LVUS186
+	.byte	0
+	.uleb128 0x3
+	.long	0x7d7
+	.quad	.LBI1647
+	.value	.LVU1823
+	.quad	.LBB1647
+	.quad	.LBE1647-.LBB1647
+	.byte	0x37
+	.value	0x217
+	.long	0x2dc9
+	.uleb128 0x2
+	.long	0x7f2
+	.uleb128 0x1
+	.long	0x7e8
+	.long	.LLST187
+	.long	.LVUS187
+	.byte	0
+	.uleb128 0x3
+	.long	0x7d7
+	.quad	.LBI1649
+	.value	.LVU1833
+	.quad	.LBB1649
+	.quad	.LBE1649-.LBB1649
+	.byte	0x37
+	.value	0x251
+	.long	0x2e02
+	.uleb128 0x2
+	.long	0x7f2
+	.uleb128 0x1
+	.long	0x7e8
+	.long	.LLST188
+	.long	.LVUS188
+	.byte	0
+	.uleb128 0x3
+	.long	0x7d7
+	.quad	.LBI1651
+	.value	.LVU1847
+	.quad	.LBB1651
+	.quad	.LBE1651-.LBB1651
+	.byte	0x37
+	.value	0x2bc
+	.long	0x2e3b
+	.uleb128 0x2
+	.long	0x7f2
+	.uleb128 0x1
+	.long	0x7e8
+	.long	.LLST189
+	.long	.LVUS189
+	.byte	0
+	.uleb128 0x3
+	.long	0x7d7
+	.quad	.LBI1653
+	.value	.LVU1858
+	.quad	.LBB1653
+	.quad	.LBE1653-.LBB1653
+	.byte	0x37
+	.value	0x2f6
+	.long	0x2e74
+	.uleb128 0x2
+	.long	0x7f2
+	.uleb128 0x1
+	.long	0x7e8
+	.long	.LLST190
+	.long	.LVUS190
+	.byte	0
+	.uleb128 0x3
+	.long	0x7d7
+	.quad	.LBI1655
+	.value	.LVU1868
+	.quad	.LBB1655
+	.quad	.LBE1655-.LBB1655
+	.byte	0x37
+	.value	0x34f
+	.long	0x2ead
+	.uleb128 0x2
+	.long	0x7f2
+	.uleb128 0x1
+	.long	0x7e8
+	.long	.LLST191
+	.long	.LVUS191
+	.byte	0
+	.uleb128 0x3
+	.long	0x7d7
+	.quad	.LBI1657
+	.value	.LVU1878
+	.quad	.LBB1657
+	.quad	.LBE1657-.LBB1657
+	.byte	0x37
+	.value	0x389
+	.long	0x2ee6
+	.uleb128 0x2
+	.long	0x7f2
+	.uleb128 0x1
+	.long	0x7e8
+	.long	.LLST192
+	.long	.LVUS192
+	.byte	0
+	.uleb128 0x3
+	.long	0x7d7
+	.quad	.LBI1659
+	.value	.LVU1890
+	.quad	.LBB1659
+	.quad	.LBE1659-.LBB1659
+	.byte	0x37
+	.value	0x3f4
+	.long	0x2f27
+	.uleb128 0x1
+	.long	0x7f2
+	.long	.LLST193
+	.long	.LVUS193
+	.uleb128 0x1
+	.long	0x7e8
+	.long	.LLST194
+	.long	.LVUS194
+	.byte	0
+	.uleb128 0x3
+	.long	0x7d7
+	.quad	.LBI1661
+	.value	.LVU1900
+	.quad	.LBB1661
+	.quad	.LBE1661-.LBB1661
+	.byte	0x37
+	.value	0x42e
+	.long	0x2f60
+	.uleb128 0x2
+	.long	0x7f2
+	.uleb128 0x1
+	.long	0x7e8
+	.long	.LLST195
+	.long	.LVUS195
+	.byte	0
+	.uleb128 0x3
+	.long	0x7d7
+	.quad	.LBI1663
+	.value	.LVU1910
+	.quad	.LBB1663
+	.quad	.LBE1663-.LBB1663
+	.byte	0x37
+	.value	0x487
+	.long	0x2f99
+	.uleb128 0x2
+	.long	0x7f2
+	.uleb128 0x1
+	.long	0x7e8
+	.long	.LLST196
+	.long	.LVUS196
+	.byte	0
+	.uleb128 0x3
+	.long	0x7d7
+	.quad	.LBI1665
+	.value	.LVU1920
+	.quad	.LBB1665
+	.quad	.LBE1665-.LBB1665
+	.byte	0x37
+	.value	0x4c1
+	.long	0x2fd2
+	.uleb128 0x2
+	.long	0x7f2
+	.uleb128 0x1
+	.long	0x7e8
+	.long	.LLST197
+	.long	.LVUS197
+	.byte	0
+	.uleb128 0x3
+	.long	0x7d7
+	.quad	.LBI1667
+	.value	.LVU1932
+	.quad	.LBB1667
+	.quad	.LBE1667-.LBB1667
+	.byte	0x37
+	.value	0x52c
+	.long	0x300b
+	.uleb128 0x2
+	.long	0x7f2
+	.uleb128 0x1
+	.long	0x7e8
+	.long	.LLST198
+	.long	.LVUS198
+	.byte	0
+	.uleb128 0x3
+	.long	0x7d7
+	.quad	.LBI1669
+	.value	.LVU1942
+	.quad	.LBB1669
+	.quad	.LBE1669-.LBB1669
+	.byte	0x37
+	.value	0x566
+	.long	0x3044
+	.uleb128 0x2
+	.long	0x7f2
+	.uleb128 0x1
+	.long	0x7e8
+	.long	.LLST199
+	.long	.LVUS199
+	.byte	0
+	.uleb128 0x3
+	.long	0x7d7
+	.quad	.LBI1671
+	.value	.LVU1952
+	.quad	.LBB1671
+	.quad	.LBE1671-.LBB1671
+	.byte	0x37
+	.value	0x5bf
+	.long	0x307d
+	.uleb128 0x2
+	.long	0x7f2
+	.uleb128 0x1
+	.long	0x7e8
+	.long	.LLST200
+	.long	.LVUS200
+	.byte	0
+	.uleb128 0x3
+	.long	0x7d7
+	.quad	.LBI1673
+	.value	.LVU1961
+	.quad	.LBB1673
+	.quad	.LBE1673-.LBB1673
+	.byte	0x37
+	.value	0x5f9
+	.long	0x30b6
+	.uleb128 0x2
+	.long	0x7f2
+	.uleb128 0x1
+	.long	0x7e8
+	.long	.LLST201
+	.long	.LVUS201
+	.byte	0
+	.uleb128 0x3
+	.long	0x7d7
+	.quad	.LBI1675
+	.value	.LVU1975
+	.quad	.LBB1675
+	.quad	.LBE1675-.LBB1675
+	.byte	0x37
+	.value	0x665
+	.long	0x30ef
+	.uleb128 0x2
+	.long	0x7f2
+	.uleb128 0x1
+	.long	0x7e8
+	.long	.LLST202
+	.long	.LVUS202
+	.byte	0
+	.uleb128 0x3
+	.long	0x7d7
+	.quad	.LBI1677
+	.value	.LVU1985
+	.quad	.LBB1677
+	.quad	.LBE1677-.LBB1677
+	.byte	0x37
+	.value	0x69f
+	.long	0x3128
+	.uleb128 0x2
+	.long	0x7f2
+	.uleb128 0x1
+	.long	0x7e8
+	.long	.LLST203
+	.long	.LVUS203
+	.byte	0
+	.uleb128 0x3
+	.long	0x7d7
+	.quad	.LBI1679
+	.value	.LVU1995
+	.quad	.LBB1679
+	.quad	.LBE1679-.LBB1679
+	.byte	0x37
+	.value	0x6f9
+	.long	0x3161
+	.uleb128 0x2
+	.long	0x7f2
+	.uleb128 0x1
+	.long	0x7e8
+	.long	.LLST204
+	.long	.LVUS204
+	.byte	0
+	.uleb128 0x3
+	.long	0x7d7
+	.quad	.LBI1681
+	.value	.LVU2005
+	.quad	.LBB1681
+	.quad	.LBE1681-.LBB1681
+	.byte	0x37
+	.value	0x733
+	.long	0x319a
+	.uleb128 0x2
+	.long	0x7f2
+	.uleb128 0x1
+	.long	0x7e8
+	.long	.LLST205
+	.long	.LVUS205
+	.byte	0
+	.uleb128 0x3
+	.long	0x7d7
+	.quad	.LBI1683
+	.value	.LVU2019
+	.quad	.LBB1683
+	.quad	.LBE1683-.LBB1683
+	.byte	0x37
+	.value	0x79f
+	.long	0x31d3
+	.uleb128 0x2
+	.long	0x7f2
+	.uleb128 0x1
+	.long	0x7e8
+	.long	.LLST206
+	.long	.LVUS206
+	.byte	0
+	.uleb128 0x3
+	.long	0x7d7
+	.quad	.LBI1685
+	.value	.LVU2029
+	.quad	.LBB1685
+	.quad	.LBE1685-.LBB1685
+	.byte	0x37
+	.value	0x7d9
+	.long	0x320c
+	.uleb128 0x2
+	.long	0x7f2
+	.uleb128 0x1
+	.long	0x7e8
+	.long	.LLST207
+	.long	.LVUS207
+	.byte	0
+	.uleb128 0x3
+	.long	0x7d7
+	.quad	.LBI1687
+	.value	.LVU2039
+	.quad	.LBB1687
+	.quad	.LBE1687-.LBB1687
+	.byte	0x37
+	.value	0x833
+	.long	0x3245
+	.uleb128 0x2
+	.long	0x7f2
+	.uleb128 0x1
+	.long	0x7e8
+	.long	.LLST208
+	.long	.LVUS208
+	.byte	0
+	.uleb128 0x5
+	.long	0x7d7
+	.quad	.LBI1689
+	.value	.LVU2050
+	.long	.LLRL209
+	.byte	0x37
+	.value	0x86d
+	.long	0x3272
+	.uleb128 0x2
+	.long	0x7f2
+	.uleb128 0x1
+	.long	0x7e8
+	.long	.LLST210
+	.long	.LVUS210
+	.byte	0
+	.uleb128 0x3
+	.long	0x7d7
+	.quad	.LBI1693
+	.value	.LVU2063
+	.quad	.LBB1693
+	.quad	.LBE1693-.LBB1693
+	.byte	0x37
+	.value	0x8d9
+	.long	0x32ab
+	.uleb128 0x2
+	.long	0x7f2
+	.uleb128 0x1
+	.long	0x7e8
+	.long	.LLST211
+	.long	.LVUS211
+	.byte	0
+	.uleb128 0x3
+	.long	0x7d7
+	.quad	.LBI1695
+	.value	.LVU2073
+	.quad	.LBB1695
+	.quad	.LBE1695-.LBB1695
+	.byte	0x37
+	.value	0x913
+	.long	0x32e4
+	.uleb128 0x2
+	.long	0x7f2
+	.uleb128 0x1
+	.long	0x7e8
+	.long	.LLST212
+	.long	.LVUS212
+	.byte	0
+	.uleb128 0x3
+	.long	0x7d7
+	.quad	.LBI1697
+	.value	.LVU2083
+	.quad	.LBB1697
+	.quad	.LBE1697-.LBB1697
+	.byte	0x37
+	.value	0x96d
+	.long	0x331d
+	.uleb128 0x2
+	.long	0x7f2
+	.uleb128 0x1
+	.long	0x7e8
+	.long	.LLST213
+	.long	.LVUS213
+	.byte	0
+	.uleb128 0x3
+	.long	0x7d7
+	.quad	.LBI1699
+	.value	.LVU2093
+	.quad	.LBB1699
+	.quad	.LBE1699-.LBB1699
+	.byte	0x37
+	.value	0x9a7
+	.long	0x3356
+	.uleb128 0x2
+	.long	0x7f2
+	.uleb128 0x1
+	.long	0x7e8
+	.long	.LLST214
+	.long	.LVUS214
+	.byte	0
+	.uleb128 0x4
+	.long	0x7d7
+	.quad	.LBI1701
+	.value	.LVU2107
+	.quad	.LBB1701
+	.quad	.LBE1701-.LBB1701
+	.byte	0x38
+	.byte	0x4c
+	.long	0x338e
+	.uleb128 0x2
+	.long	0x7f2
+	.uleb128 0x1
+	.long	0x7e8
+	.long	.LLST215
+	.long	.LVUS215
+	.byte	0
+	.uleb128 0x4
+	.long	0x7d7
+	.quad	.LBI1703
+	.value	.LVU2117
+	.quad	.LBB1703
+	.quad	.LBE1703-.LBB1703
+	.byte	0x38
+	.byte	0x86
+	.long	0x33c6
+	.uleb128 0x2
+	.long	0x7f2
+	.uleb128 0x1
+	.long	0x7e8
+	.long	.LLST216
+	.long	.LVUS216
+	.byte	0
+	.uleb128 0x4
+	.long	0x7d7
+	.quad	.LBI1705
+	.value	.LVU2127
+	.quad	.LBB1705
+	.quad	.LBE1705-.LBB1705
+	.byte	0x38
+	.byte	0xdf
+	.long	0x33fe
+	.uleb128 0x2
+	.long	0x7f2
+	.uleb128 0x1
+	.long	0x7e8
+	.long	.LLST217
+	.long	.LVUS217
+	.byte	0
+	.uleb128 0x3
+	.long	0x7d7
+	.quad	.LBI1707
+	.value	.LVU2137
+	.quad	.LBB1707
+	.quad	.LBE1707-.LBB1707
+	.byte	0x38
+	.value	0x119
+	.long	0x3437
+	.uleb128 0x2
+	.long	0x7f2
+	.uleb128 0x1
+	.long	0x7e8
+	.long	.LLST218
+	.long	.LVUS218
+	.byte	0
+	.uleb128 0x3
+	.long	0x7d7
+	.quad	.LBI1709
+	.value	.LVU2150
+	.quad	.LBB1709
+	.quad	.LBE1709-.LBB1709
+	.byte	0x38
+	.value	0x184
+	.long	0x3470
+	.uleb128 0x2
+	.long	0x7f2
+	.uleb128 0x1
+	.long	0x7e8
+	.long	.LLST219
+	.long	.LVUS219
+	.byte	0
+	.uleb128 0x3
+	.long	0x7d7
+	.quad	.LBI1711
+	.value	.LVU2160
+	.quad	.LBB1711
+	.quad	.LBE1711-.LBB1711
+	.byte	0x38
+	.value	0x1be
+	.long	0x34a9
+	.uleb128 0x2
+	.long	0x7f2
+	.uleb128 0x1
+	.long	0x7e8
+	.long	.LLST220
+	.long	.LVUS220
+	.byte	0
+	.uleb128 0x5
+	.long	0x7d7
+	.quad	.LBI1713
+	.value	.LVU2170
+	.long	.LLRL221
+	.byte	0x38
+	.value	0x217
+	.long	0x34d6
+	.uleb128 0x2
+	.long	0x7f2
+	.uleb128 0x1
+	.long	0x7e8
+	.long	.LLST222
+	.long	.LVUS222
+	.byte	0
+	.uleb128 0x3
+	.long	0x7d7
+	.quad	.LBI1717
+	.value	.LVU2181
+	.quad	.LBB1717
+	.quad	.LBE1717-.LBB1717
+	.byte	0x38
+	.value	0x251
+	.long	0x350f
+	.uleb128 0x2
+	.long	0x7f2
+	.uleb128 0x1
+	.long	0x7e8
+	.long	.LLST223
+	.long	.LVUS223
+	.byte	0
+	.uleb128 0x3
+	.long	0x7d7
+	.quad	.LBI1719
+	.value	.LVU2195
+	.quad	.LBB1719
+	.quad	.LBE1719-.LBB1719
+	.byte	0x38
+	.value	0x2bc
+	.long	0x3548
+	.uleb128 0x2
+	.long	0x7f2
+	.uleb128 0x1
+	.long	0x7e8
+	.long	.LLST224
+	.long	.LVUS224
+	.byte	0
+	.uleb128 0x3
+	.long	0x7d7
+	.quad	.LBI1721
+	.value	.LVU2206
+	.quad	.LBB1721
+	.quad	.LBE1721-.LBB1721
+	.byte	0x38
+	.value	0x2f6
+	.long	0x3581
+	.uleb128 0x2
+	.long	0x7f2
+	.uleb128 0x1
+	.long	0x7e8
+	.long	.LLST225
+	.long	.LVUS225
+	.byte	0
+	.uleb128 0x3
+	.long	0x7d7
+	.quad	.LBI1723
+	.value	.LVU2216
+	.quad	.LBB1723
+	.quad	.LBE1723-.LBB1723
+	.byte	0x38
+	.value	0x34f
+	.long	0x35ba
+	.uleb128 0x2
+	.long	0x7f2
+	.uleb128 0x1
+	.long	0x7e8
+	.long	.LLST226
+	.long	.LVUS226
+	.byte	0
+	.uleb128 0x3
+	.long	0x7d7
+	.quad	.LBI1725
+	.value	.LVU2226
+	.quad	.LBB1725
+	.quad	.LBE1725-.LBB1725
+	.byte	0x38
+	.value	0x389
+	.long	0x35f3
+	.uleb128 0x2
+	.long	0x7f2
+	.uleb128 0x1
+	.long	0x7e8
+	.long	.LLST227
+	.long	.LVUS227
+	.byte	0
+	.uleb128 0x3
+	.long	0x7d7
+	.quad	.LBI1727
+	.value	.LVU2238
+	.quad	.LBB1727
+	.quad	.LBE1727-.LBB1727
+	.byte	0x38
+	.value	0x3f4
+	.long	0x3634
+	.uleb128 0x1
+	.long	0x7f2
+	.long	.LLST228
+	.long	.LVUS228
+	.uleb128 0x1
+	.long	0x7e8
+	.long	.LLST229
+	.long	.LVUS229
+	.byte	0
+	.uleb128 0x3
+	.long	0x7d7
+	.quad	.LBI1729
+	.value	.LVU2248
+	.quad	.LBB1729
+	.quad	.LBE1729-.LBB1729
+	.byte	0x38
+	.value	0x42e
+	.long	0x366d
+	.uleb128 0x2
+	.long	0x7f2
+	.uleb128 0x1
+	.long	0x7e8
+	.long	.LLST230
+	.long	.LVUS230
+	.byte	0
+	.uleb128 0x3
+	.long	0x7d7
+	.quad	.LBI1731
+	.value	.LVU2258
+	.quad	.LBB1731
+	.quad	.LBE1731-.LBB1731
+	.byte	0x38
+	.value	0x487
+	.long	0x36a6
+	.uleb128 0x2
+	.long	0x7f2
+	.uleb128 0x1
+	.long	0x7e8
+	.long	.LLST231
+	.long	.LVUS231
+	.byte	0
+	.uleb128 0x3
+	.long	0x7d7
+	.quad	.LBI1733
+	.value	.LVU2268
+	.quad	.LBB1733
+	.quad	.LBE1733-.LBB1733
+	.byte	0x38
+	.value	0x4c1
+	.long	0x36df
+	.uleb128 0x2
+	.long	0x7f2
+	.uleb128 0x1
+	.long	0x7e8
+	.long	.LLST232
+	.long	.LVUS232
+	.byte	0
+	.uleb128 0x3
+	.long	0x7d7
+	.quad	.LBI1735
+	.value	.LVU2280
+	.quad	.LBB1735
+	.quad	.LBE1735-.LBB1735
+	.byte	0x38
+	.value	0x52c
+	.long	0x3718
+	.uleb128 0x2
+	.long	0x7f2
+	.uleb128 0x1
+	.long	0x7e8
+	.long	.LLST233
+	.long	.LVUS233
+	.byte	0
+	.uleb128 0x3
+	.long	0x7d7
+	.quad	.LBI1737
+	.value	.LVU2290
+	.quad	.LBB1737
+	.quad	.LBE1737-.LBB1737
+	.byte	0x38
+	.value	0x566
+	.long	0x3751
+	.uleb128 0x2
+	.long	0x7f2
+	.uleb128 0x1
+	.long	0x7e8
+	.long	.LLST234
+	.long	.LVUS234
+	.byte	0
+	.uleb128 0x3
+	.long	0x7d7
+	.quad	.LBI1739
+	.value	.LVU2300
+	.quad	.LBB1739
+	.quad	.LBE1739-.LBB1739
+	.byte	0x38
+	.value	0x5bf
+	.long	0x378a
+	.uleb128 0x2
+	.long	0x7f2
+	.uleb128 0x1
+	.long	0x7e8
+	.long	.LLST235
+	.long	.LVUS235
+	.byte	0
+	.uleb128 0x3
+	.long	0x7d7
+	.quad	.LBI1741
+	.value	.LVU2309
+	.quad	.LBB1741
+	.quad	.LBE1741-.LBB1741
+	.byte	0x38
+	.value	0x5f9
+	.long	0x37c3
+	.uleb128 0x2
+	.long	0x7f2
+	.uleb128 0x1
+	.long	0x7e8
+	.long	.LLST236
+	.long	.LVUS236
+	.byte	0
+	.uleb128 0x3
+	.long	0x7d7
+	.quad	.LBI1743
+	.value	.LVU2324
+	.quad	.LBB1743
+	.quad	.LBE1743-.LBB1743
+	.byte	0x38
+	.value	0x665
+	.long	0x37fc
+	.uleb128 0x2
+	.long	0x7f2
+	.uleb128 0x1
+	.long	0x7e8
+	.long	.LLST237
+	.long	.LVUS237
+	.byte	0
+	.uleb128 0x3
+	.long	0x7d7
+	.quad	.LBI1745
+	.value	.LVU2334
+	.quad	.LBB1745
+	.quad	.LBE1745-.LBB1745
+	.byte	0x38
+	.value	0x69f
+	.long	0x3835
+	.uleb128 0x2
+	.long	0x7f2
+	.uleb128 0x1
+	.long	0x7e8
+	.long	.LLST238
+	.long	.LVUS238
+	.byte	0
+	.uleb128 0x3
+	.long	0x7d7
+	.quad	.LBI1747
+	.value	.LVU2344
+	.quad	.LBB1747
+	.quad	.LBE1747-.LBB1747
+	.byte	0x38
+	.value	0x6f9
+	.long	0x386e
+	.uleb128 0x2
+	.long	0x7f2
+	.uleb128 0x1
+	.long	0x7e8
+	.long	.LLST239
+	.long	.LVUS239
+	.byte	0
+	.uleb128 0x3
+	.long	0x7d7
+	.quad	.LBI1749
+	.value	.LVU2354
+	.quad	.LBB1749
+	.quad	.LBE1749-.LBB1749
+	.byte	0x38
+	.value	0x733
+	.long	0x38a7
+	.uleb128 0x2
+	.long	0x7f2
+	.uleb128 0x1
+	.long	0x7e8
+	.long	.LLST240
+	.long	.LVUS240
+	.byte	0
+	.uleb128 0x3
+	.long	0x7d7
+	.quad	.LBI1751
+	.value	.LVU2368
+	.quad	.LBB1751
+	.quad	.LBE1751-.LBB1751
+	.byte	0x38
+	.value	0x79f
+	.long	0x38e0
+	.uleb128 0x2
+	.long	0x7f2
+	.uleb128 0x1
+	.long	0x7e8
+	.long	.LLST241
+	.long	.LVUS241
+	.byte	0
+	.uleb128 0x3
+	.long	0x7d7
+	.quad	.LBI1753
+	.value	.LVU2378
+	.quad	.LBB1753
+	.quad	.LBE1753-.LBB1753
+	.byte	0x38
+	.value	0x7d9
+	.long	0x3919
+	.uleb128 0x2
+	.long	0x7f2
+	.uleb128 0x1
+	.long	0x7e8
+	.long	.LLST242
+	.long	.LVUS242
+	.byte	0
+	.uleb128 0x3
+	.long	0x7d7
+	.quad	.LBI1755
+	.value	.LVU2388
+	.quad	.LBB1755
+	.quad	.LBE1755-.LBB1755
+	.byte	0x38
+	.value	0x833
+	.long	0x3952
+	.uleb128 0x2
+	.long	0x7f2
+	.uleb128 0x1
+	.long	0x7e8
+	.long	.LLST243
+	.long	.LVUS243
+	.byte	0
+	.uleb128 0x3
+	.long	0x7d7
+	.quad	.LBI1757
+	.value	.LVU2398
+	.quad	.LBB1757
+	.quad	.LBE1757-.LBB1757
+	.byte	0x38
+	.value	0x86d
+	.long	0x398b
+	.uleb128 0x2
+	.long	0x7f2
+	.uleb128 0x1
+	.long	0x7e8
+	.long	.LLST244
+	.long	.LVUS244
+	.byte	0
+	.uleb128 0x3
+	.long	0x7d7
+	.quad	.LBI1759
+	.value	.LVU2410
+	.quad	.LBB1759
+	.quad	.LBE1759-.LBB1759
+	.byte	0x38
+	.value	0x8d9
+	.long	0x39c4
+	.uleb128 0x2
+	.long	0x7f2
+	.uleb128 0x1
+	.long	0x7e8
+	.long	.LLST245
+	.long	.LVUS245
+	.byte	0
+	.uleb128 0x3
+	.long	0x7d7
+	.quad	.LBI1761
+	.value	.LVU2420
+	.quad	.LBB1761
+	.quad	.LBE1761-.LBB1761
+	.byte	0x38
+	.value	0x913
+	.long	0x39fd
+	.uleb128 0x2
+	.long	0x7f2
+	.uleb128 0x1
+	.long	0x7e8
+	.long	.LLST246
+	.long	.LVUS246
+	.byte	0
+	.uleb128 0x3
+	.long	0x7d7
+	.quad	.LBI1763
+	.value	.LVU2430
+	.quad	.LBB1763
+	.quad	.LBE1763-.LBB1763
+	.byte	0x38
+	.value	0x96d
+	.long	0x3a36
+	.uleb128 0x2
+	.long	0x7f2
+	.uleb128 0x1
+	.long	0x7e8
+	.long	.LLST247
+	.long	.LVUS247
+	.byte	0
+	.uleb128 0x3
+	.long	0x7d7
+	.quad	.LBI1765
+	.value	.LVU2440
+	.quad	.LBB1765
+	.quad	.LBE1765-.LBB1765
+	.byte	0x38
+	.value	0x9a7
+	.long	0x3a6f
+	.uleb128 0x2
+	.long	0x7f2
+	.uleb128 0x1
+	.long	0x7e8
+	.long	.LLST248
+	.long	.LVUS248
+	.byte	0
+	.uleb128 0x4
+	.long	0x7d7
+	.quad	.LBI1767
+	.value	.LVU2454
+	.quad	.LBB1767
+	.quad	.LBE1767-.LBB1767
+	.byte	0x39
+	.byte	0x4c
+	.long	0x3aa7
+	.uleb128 0x2
+	.long	0x7f2
+	.uleb128 0x1
+	.long	0x7e8
+	.long	.LLST249
+	.long	.LVUS249
+	.byte	0
+	.uleb128 0x4
+	.long	0x7d7
+	.quad	.LBI1769
+	.value	.LVU2464
+	.quad	.LBB1769
+	.quad	.LBE1769-.LBB1769
+	.byte	0x39
+	.byte	0x86
+	.long	0x3adf
+	.uleb128 0x2
+	.long	0x7f2
+	.uleb128 0x1
+	.long	0x7e8
+	.long	.LLST250
+	.long	.LVUS250
+	.byte	0
+	.uleb128 0x4
+	.long	0x7d7
+	.quad	.LBI1771
+	.value	.LVU2474
+	.quad	.LBB1771
+	.quad	.LBE1771-.LBB1771
+	.byte	0x39
+	.byte	0xdf
+	.long	0x3b17
+	.uleb128 0x2
+	.long	0x7f2
+	.uleb128 0x1
+	.long	0x7e8
+	.long	.LLST251
+	.long	.LVUS251
+	.byte	0
+	.uleb128 0x3
+	.long	0x7d7
+	.quad	.LBI1773
+	.value	.LVU2484
+	.quad	.LBB1773
+	.quad	.LBE1773-.LBB1773
+	.byte	0x39
+	.value	0x119
+	.long	0x3b50
+	.uleb128 0x2
+	.long	0x7f2
+	.uleb128 0x1
+	.long	0x7e8
+	.long	.LLST252
+	.long	.LVUS252
+	.byte	0
+	.uleb128 0x3
+	.long	0x7d7
+	.quad	.LBI1775
+	.value	.LVU2497
+	.quad	.LBB1775
+	.quad	.LBE1775-.LBB1775
+	.byte	0x39
+	.value	0x184
+	.long	0x3b89
+	.uleb128 0x2
+	.long	0x7f2
+	.uleb128 0x1
+	.long	0x7e8
+	.long	.LLST253
+	.long	.LVUS253
+	.byte	0
+	.uleb128 0x3
+	.long	0x7d7
+	.quad	.LBI1777
+	.value	.LVU2507
+	.quad	.LBB1777
+	.quad	.LBE1777-.LBB1777
+	.byte	0x39
+	.value	0x1be
+	.long	0x3bc2
+	.uleb128 0x2
+	.long	0x7f2
+	.uleb128 0x1
+	.long	0x7e8
+	.long	.LLST254
+	.long	.LVUS254
+	.byte	0
+	.uleb128 0x3
+	.long	0x7d7
+	.quad	.LBI1779
+	.value	.LVU2517
+	.quad	.LBB1779
+	.quad	.LBE1779-.LBB1779
+	.byte	0x39
+	.value	0x217
+	.long	0x3bfb
+	.uleb128 0x2
+	.long	0x7f2
+	.uleb128 0x1
+	.long	0x7e8
+	.long	.LLST255
+	.long	.LVUS255
+	.byte	0
+	.uleb128 0x3
+	.long	0x7d7
+	.quad	.LBI1781
+	.value	.LVU2527
+	.quad	.LBB1781
+	.quad	.LBE1781-.LBB1781
+	.byte	0x39
+	.value	0x251
+	.long	0x3c34
+	.uleb128 0x2
+	.long	0x7f2
+	.uleb128 0x1
+	.long	0x7e8
+	.long	.LLST256
+	.long	.LVUS256
+	.byte	0
+	.uleb128 0x5
+	.long	0x7d7
+	.quad	.LBI1783
+	.value	.LVU2538
+	.long	.LLRL257
+	.byte	0x39
+	.value	0x2bc
+	.long	0x3c69
+	.uleb128 0x1
+	.long	0x7f2
+	.long	.LLST258
+	.long	.LVUS258
+	.uleb128 0x1
+	.long	0x7e8
+	.long	.LLST259
+	.long	.LVUS259
+	.byte	0
+	.uleb128 0x3
+	.long	0x7d7
+	.quad	.LBI1787
+	.value	.LVU2552
+	.quad	.LBB1787
+	.quad	.LBE1787-.LBB1787
+	.byte	0x39
+	.value	0x2f6
+	.long	0x3ca2
+	.uleb128 0x2
+	.long	0x7f2
+	.uleb128 0x1
+	.long	0x7e8
+	.long	.LLST260
+	.long	.LVUS260
+	.byte	0
+	.uleb128 0x3
+	.long	0x7d7
+	.quad	.LBI1789
+	.value	.LVU2562
+	.quad	.LBB1789
+	.quad	.LBE1789-.LBB1789
+	.byte	0x39
+	.value	0x34f
+	.long	0x3cdb
+	.uleb128 0x2
+	.long	0x7f2
+	.uleb128 0x1
+	.long	0x7e8
+	.long	.LLST261
+	.long	.LVUS261
+	.byte	0
+	.uleb128 0x3
+	.long	0x7d7
+	.quad	.LBI1791
+	.value	.LVU2572
+	.quad	.LBB1791
+	.quad	.LBE1791-.LBB1791
+	.byte	0x39
+	.value	0x389
+	.long	0x3d14
+	.uleb128 0x2
+	.long	0x7f2
+	.uleb128 0x1
+	.long	0x7e8
+	.long	.LLST262
+	.long	.LVUS262
+	.byte	0
+	.uleb128 0x3
+	.long	0x7d7
+	.quad	.LBI1793
+	.value	.LVU2584
+	.quad	.LBB1793
+	.quad	.LBE1793-.LBB1793
+	.byte	0x39
+	.value	0x3f4
+	.long	0x3d55
+	.uleb128 0x1
+	.long	0x7f2
+	.long	.LLST263
+	.long	.LVUS263
+	.uleb128 0x1
+	.long	0x7e8
+	.long	.LLST264
+	.long	.LVUS264
+	.byte	0
+	.uleb128 0x3
+	.long	0x7d7
+	.quad	.LBI1795
+	.value	.LVU2594
+	.quad	.LBB1795
+	.quad	.LBE1795-.LBB1795
+	.byte	0x39
+	.value	0x42e
+	.long	0x3d8e
+	.uleb128 0x2
+	.long	0x7f2
+	.uleb128 0x1
+	.long	0x7e8
+	.long	.LLST265
+	.long	.LVUS265
+	.byte	0
+	.uleb128 0x3
+	.long	0x7d7
+	.quad	.LBI1797
+	.value	.LVU2604
+	.quad	.LBB1797
+	.quad	.LBE1797-.LBB1797
+	.byte	0x39
+	.value	0x487
+	.long	0x3dc7
+	.uleb128 0x2
+	.long	0x7f2
+	.uleb128 0x1
+	.long	0x7e8
+	.long	.LLST266
+	.long	.LVUS266
+	.byte	0
+	.uleb128 0x3
+	.long	0x7d7
+	.quad	.LBI1799
+	.value	.LVU2614
+	.quad	.LBB1799
+	.quad	.LBE1799-.LBB1799
+	.byte	0x39
+	.value	0x4c1
+	.long	0x3e00
+	.uleb128 0x2
+	.long	0x7f2
+	.uleb128 0x1
+	.long	0x7e8
+	.long	.LLST267
+	.long	.LVUS267
+	.byte	0
+	.uleb128 0x3
+	.long	0x7d7
+	.quad	.LBI1801
+	.value	.LVU2626
+	.quad	.LBB1801
+	.quad	.LBE1801-.LBB1801
+	.byte	0x39
+	.value	0x52c
+	.long	0x3e39
+	.uleb128 0x2
+	.long	0x7f2
+	.uleb128 0x1
+	.long	0x7e8
+	.long	.LLST268
+	.long	.LVUS268
+	.byte	0
+	.uleb128 0x3
+	.long	0x7d7
+	.quad	.LBI1803
+	.value	.LVU2636
+	.quad	.LBB1803
+	.quad	.LBE1803-.LBB1803
+	.byte	0x39
+	.value	0x566
+	.long	0x3e72
+	.uleb128 0x2
+	.long	0x7f2
+	.uleb128 0x1
+	.long	0x7e8
+	.long	.LLST269
+	.long	.LVUS269
+	.byte	0
+	.uleb128 0x3
+	.long	0x7d7
+	.quad	.LBI1805
+	.value	.LVU2646
+	.quad	.LBB1805
+	.quad	.LBE1805-.LBB1805
+	.byte	0x39
+	.value	0x5bf
+	.long	0x3eab
+	.uleb128 0x2
+	.long	0x7f2
+	.uleb128 0x1
+	.long	0x7e8
+	.long	.LLST270
+	.long	.LVUS270
+	.byte	0
+	.uleb128 0x5
+	.long	0x7d7
+	.quad	.LBI1807
+	.value	.LVU2656
+	.long	.LLRL271
+	.byte	0x39
+	.value	0x5f9
+	.long	0x3ed8
+	.uleb128 0x2
+	.long	0x7f2
+	.uleb128 0x1
+	.long	0x7e8
+	.long	.LLST272
+	.long	.LVUS272
+	.byte	0
+	.uleb128 0x3
+	.long	0x7d7
+	.quad	.LBI1811
+	.value	.LVU2668
+	.quad	.LBB1811
+	.quad	.LBE1811-.LBB1811
+	.byte	0x39
+	.value	0x665
+	.long	0x3f11
+	.uleb128 0x2
+	.long	0x7f2
+	.uleb128 0x1
+	.long	0x7e8
+	.long	.LLST273
+	.long	.LVUS273
+	.byte	0
+	.uleb128 0x3
+	.long	0x7d7
+	.quad	.LBI1813
+	.value	.LVU2678
+	.quad	.LBB1813
+	.quad	.LBE1813-.LBB1813
+	.byte	0x39
+	.value	0x69f
+	.long	0x3f4a
+	.uleb128 0x2
+	.long	0x7f2
+	.uleb128 0x1
+	.long	0x7e8
+	.long	.LLST274
+	.long	.LVUS274
+	.byte	0
+	.uleb128 0x3
+	.long	0x7d7
+	.quad	.LBI1815
+	.value	.LVU2688
+	.quad	.LBB1815
+	.quad	.LBE1815-.LBB1815
+	.byte	0x39
+	.value	0x6f9
+	.long	0x3f83
+	.uleb128 0x2
+	.long	0x7f2
+	.uleb128 0x1
+	.long	0x7e8
+	.long	.LLST275
+	.long	.LVUS275
+	.byte	0
+	.uleb128 0x3
+	.long	0x7d7
+	.quad	.LBI1817
+	.value	.LVU2698
+	.quad	.LBB1817
+	.quad	.LBE1817-.LBB1817
+	.byte	0x39
+	.value	0x733
+	.long	0x3fbc
+	.uleb128 0x2
+	.long	0x7f2
+	.uleb128 0x1
+	.long	0x7e8
+	.long	.LLST276
+	.long	.LVUS276
+	.byte	0
+	.uleb128 0x3
+	.long	0x7d7
+	.quad	.LBI1819
+	.value	.LVU2712
+	.quad	.LBB1819
+	.quad	.LBE1819-.LBB1819
+	.byte	0x39
+	.value	0x79f
+	.long	0x3ff5
+	.uleb128 0x2
+	.long	0x7f2
+	.uleb128 0x1
+	.long	0x7e8
+	.long	.LLST277
+	.long	.LVUS277
+	.byte	0
+	.uleb128 0x3
+	.long	0x7d7
+	.quad	.LBI1821
+	.value	.LVU2723
+	.quad	.LBB1821
+	.quad	.LBE1821-.LBB1821
+	.byte	0x39
+	.value	0x7d9
+	.long	0x402e
+	.uleb128 0x2
+	.long	0x7f2
+	.uleb128 0x1
+	.long	0x7e8
+	.long	.LLST278
+	.long	.LVUS278
+	.byte	0
+	.uleb128 0x3
+	.long	0x7d7
+	.quad	.LBI1823
+	.value	.LVU2733
+	.quad	.LBB1823
+	.quad	.LBE1823-.LBB1823
+	.byte	0x39
+	.value	0x833
+	.long	0x4067
+	.uleb128 0x2
+	.long	0x7f2
+	.uleb128 0x1
+	.long	0x7e8
+	.long	.LLST279
+	.long	.LVUS279
+	.byte	0
+	.uleb128 0x3
+	.long	0x7d7
+	.quad	.LBI1825
+	.value	.LVU2743
+	.quad	.LBB1825
+	.quad	.LBE1825-.LBB1825
+	.byte	0x39
+	.value	0x86d
+	.long	0x40a0
+	.uleb128 0x2
+	.long	0x7f2
+	.uleb128 0x1
+	.long	0x7e8
+	.long	.LLST280
+	.long	.LVUS280
+	.byte	0
+	.uleb128 0x3
+	.long	0x7d7
+	.quad	.LBI1827
+	.value	.LVU2755
+	.quad	.LBB1827
+	.quad	.LBE1827-.LBB1827
+	.byte	0x39
+	.value	0x8d9
+	.long	0x40d9
+	.uleb128 0x2
+	.long	0x7f2
+	.uleb128 0x1
+	.long	0x7e8
+	.long	.LLST281
+	.long	.LVUS281
+	.byte	0
+	.uleb128 0x3
+	.long	0x7d7
+	.quad	.LBI1829
+	.value	.LVU2765
+	.quad	.LBB1829
+	.quad	.LBE1829-.LBB1829
+	.byte	0x39
+	.value	0x913
+	.long	0x4112
+	.uleb128 0x2
+	.long	0x7f2
+	.uleb128 0x1
+	.long	0x7e8
+	.long	.LLST282
+	.long	.LVUS282
+	.byte	0
+	.uleb128 0x3
+	.long	0x7d7
+	.quad	.LBI1831
+	.value	.LVU2775
+	.quad	.LBB1831
+	.quad	.LBE1831-.LBB1831
+	.byte	0x39
+	.value	0x96d
+	.long	0x414b
+	.uleb128 0x2
+	.long	0x7f2
+	.uleb128 0x1
+	.long	0x7e8
+	.long	.LLST283
+	.long	.LVUS283
+	.byte	0
+	.uleb128 0x3
+	.long	0x7d7
+	.quad	.LBI1833
+	.value	.LVU2785
+	.quad	.LBB1833
+	.quad	.LBE1833-.LBB1833
+	.byte	0x39
+	.value	0x9a7
+	.long	0x4184
+	.uleb128 0x2
+	.long	0x7f2
+	.uleb128 0x1
+	.long	0x7e8
+	.long	.LLST284
+	.long	.LVUS284
+	.byte	0
+	.uleb128 0x4
+	.long	0x7d7
+	.quad	.LBI1835
+	.value	.LVU2799
+	.quad	.LBB1835
+	.quad	.LBE1835-.LBB1835
+	.byte	0x3a
+	.byte	0x4c
+	.long	0x41bc
+	.uleb128 0x2
+	.long	0x7f2
+	.uleb128 0x1
+	.long	0x7e8
+	.long	.LLST285
+	.long	.LVUS285
+	.byte	0
+	.uleb128 0x4
+	.long	0x7d7
+	.quad	.LBI1837
+	.value	.LVU2809
+	.quad	.LBB1837
+	.quad	.LBE1837-.LBB1837
+	.byte	0x3a
+	.byte	0x86
+	.long	0x41f4
+	.uleb128 0x2
+	.long	0x7f2
+	.uleb128 0x1
+	.long	0x7e8
+	.long	.LLST286
+	.long	.LVUS286
+	.byte	0
+	.uleb128 0x4
+	.long	0x7d7
+	.quad	.LBI1839
+	.value	.LVU2819
+	.quad	.LBB1839
+	.quad	.LBE1839-.LBB1839
+	.byte	0x3a
+	.byte	0xdf
+	.long	0x422c
+	.uleb128 0x2
+	.long	0x7f2
+	.uleb128 0x1
+	.long	0x7e8
+	.long	.LLST287
+	.long	.LVUS287
+	.byte	0
+	.uleb128 0x3
+	.long	0x7d7
+	.quad	.LBI1841
+	.value	.LVU2829
+	.quad	.LBB1841
+	.quad	.LBE1841-.LBB1841
+	.byte	0x3a
+	.value	0x119
+	.long	0x4265
+	.uleb128 0x2
+	.long	0x7f2
+	.uleb128 0x1
+	.long	0x7e8
+	.long	.LLST288
+	.long	.LVUS288
+	.byte	0
+	.uleb128 0x3
+	.long	0x7d7
+	.quad	.LBI1843
+	.value	.LVU2842
+	.quad	.LBB1843
+	.quad	.LBE1843-.LBB1843
+	.byte	0x3a
+	.value	0x184
+	.long	0x429e
+	.uleb128 0x2
+	.long	0x7f2
+	.uleb128 0x1
+	.long	0x7e8
+	.long	.LLST289
+	.long	.LVUS289
+	.byte	0
+	.uleb128 0x3
+	.long	0x7d7
+	.quad	.LBI1845
+	.value	.LVU2852
+	.quad	.LBB1845
+	.quad	.LBE1845-.LBB1845
+	.byte	0x3a
+	.value	0x1be
+	.long	0x42d7
+	.uleb128 0x2
+	.long	0x7f2
+	.uleb128 0x1
+	.long	0x7e8
+	.long	.LLST290
+	.long	.LVUS290
+	.byte	0
+	.uleb128 0x3
+	.long	0x7d7
+	.quad	.LBI1847
+	.value	.LVU2862
+	.quad	.LBB1847
+	.quad	.LBE1847-.LBB1847
+	.byte	0x3a
+	.value	0x217
+	.long	0x4310
+	.uleb128 0x2
+	.long	0x7f2
+	.uleb128 0x1
+	.long	0x7e8
+	.long	.LLST291
+	.long	.LVUS291
+	.byte	0
+	.uleb128 0x3
+	.long	0x7d7
+	.quad	.LBI1849
+	.value	.LVU2872
+	.quad	.LBB1849
+	.quad	.LBE1849-.LBB1849
+	.byte	0x3a
+	.value	0x251
+	.long	0x4349
+	.uleb128 0x2
+	.long	0x7f2
+	.uleb128 0x1
+	.long	0x7e8
+	.long	.LLST292
+	.long	.LVUS292
+	.byte	0
+	.uleb128 0x3
+	.long	0x7d7
+	.quad	.LBI1851
+	.value	.LVU2886
+	.quad	.LBB1851
+	.quad	.LBE1851-.LBB1851
+	.byte	0x3a
+	.value	0x2bc
+	.long	0x4382
+	.uleb128 0x2
+	.long	0x7f2
+	.uleb128 0x1
+	.long	0x7e8
+	.long	.LLST293
+	.long	.LVUS293
+	.byte	0
+	.uleb128 0x3
+	.long	0x7d7
+	.quad	.LBI1853
+	.value	.LVU2896
+	.quad	.LBB1853
+	.quad	.LBE1853-.LBB1853
+	.byte	0x3a
+	.value	0x2f6
+	.long	0x43bb
+	.uleb128 0x2
+	.long	0x7f2
+	.uleb128 0x1
+	.long	0x7e8
+	.long	.LLST294
+	.long	.LVUS294
+	.byte	0
+	.uleb128 0x3
+	.long	0x7d7
+	.quad	.LBI1855
+	.value	.LVU2906
+	.quad	.LBB1855
+	.quad	.LBE1855-.LBB1855
+	.byte	0x3a
+	.value	0x34f
+	.long	0x43f4
+	.uleb128 0x2
+	.long	0x7f2
+	.uleb128 0x1
+	.long	0x7e8
+	.long	.LLST295
+	.long	.LVUS295
+	.byte	0
+	.uleb128 0x3
+	.long	0x7d7
+	.quad	.LBI1857
+	.value	.LVU2916
+	.quad	.LBB1857
+	.quad	.LBE1857-.LBB1857
+	.byte	0x3a
+	.value	0x389
+	.long	0x442d
+	.uleb128 0x2
+	.long	0x7f2
+	.uleb128 0x1
+	.long	0x7e8
+	.long	.LLST296
+	.long	.LVUS296
+	.byte	0
+	.uleb128 0x5
+	.long	0x7d7
+	.quad	.LBI1859
+	.value	.LVU2928
+	.long	.LLRL297
+	.byte	0x3a
+	.value	0x3f4
+	.long	0x4462
+	.uleb128 0x1
+	.long	0x7f2
+	.long	.LLST298
+	.long	.LVUS298
+	.uleb128 0x1
+	.long	0x7e8
+	.long	.LLST299
+	.long	.LVUS299
+	.byte	0
+	.uleb128 0x3
+	.long	0x7d7
+	.quad	.LBI1863
+	.value	.LVU2939
+	.quad	.LBB1863
+	.quad	.LBE1863-.LBB1863
+	.byte	0x3a
+	.value	0x42e
+	.long	0x449b
+	.uleb128 0x2
+	.long	0x7f2
+	.uleb128 0x1
+	.long	0x7e8
+	.long	.LLST300
+	.long	.LVUS300
+	.byte	0
+	.uleb128 0x3
+	.long	0x7d7
+	.quad	.LBI1865
+	.value	.LVU2949
+	.quad	.LBB1865
+	.quad	.LBE1865-.LBB1865
+	.byte	0x3a
+	.value	0x487
+	.long	0x44d4
+	.uleb128 0x2
+	.long	0x7f2
+	.uleb128 0x1
+	.long	0x7e8
+	.long	.LLST301
+	.long	.LVUS301
+	.byte	0
+	.uleb128 0x3
+	.long	0x7d7
+	.quad	.LBI1867
+	.value	.LVU2959
+	.quad	.LBB1867
+	.quad	.LBE1867-.LBB1867
+	.byte	0x3a
+	.value	0x4c1
+	.long	0x450d
+	.uleb128 0x2
+	.long	0x7f2
+	.uleb128 0x1
+	.long	0x7e8
+	.long	.LLST302
+	.long	.LVUS302
+	.byte	0
+	.uleb128 0x3
+	.long	0x7d7
+	.quad	.LBI1869
+	.value	.LVU2971
+	.quad	.LBB1869
+	.quad	.LBE1869-.LBB1869
+	.byte	0x3a
+	.value	0x52c
+	.long	0x4546
+	.uleb128 0x2
+	.long	0x7f2
+	.uleb128 0x1
+	.long	0x7e8
+	.long	.LLST303
+	.long	.LVUS303
+	.byte	0
+	.uleb128 0x3
+	.long	0x7d7
+	.quad	.LBI1871
+	.value	.LVU2981
+	.quad	.LBB1871
+	.quad	.LBE1871-.LBB1871
+	.byte	0x3a
+	.value	0x566
+	.long	0x457f
+	.uleb128 0x2
+	.long	0x7f2
+	.uleb128 0x1
+	.long	0x7e8
+	.long	.LLST304
+	.long	.LVUS304
+	.byte	0
+	.uleb128 0x3
+	.long	0x7d7
+	.quad	.LBI1873
+	.value	.LVU2991
+	.quad	.LBB1873
+	.quad	.LBE1873-.LBB1873
+	.byte	0x3a
+	.value	0x5bf
+	.long	0x45b8
+	.uleb128 0x2
+	.long	0x7f2
+	.uleb128 0x1
+	.long	0x7e8
+	.long	.LLST305
+	.long	.LVUS305
+	.byte	0
+	.uleb128 0x3
+	.long	0x7d7
+	.quad	.LBI1875
+	.value	.LVU3000
+	.quad	.LBB1875
+	.quad	.LBE1875-.LBB1875
+	.byte	0x3a
+	.value	0x5f9
+	.long	0x45f1
+	.uleb128 0x2
+	.long	0x7f2
+	.uleb128 0x1
+	.long	0x7e8
+	.long	.LLST306
+	.long	.LVUS306
+	.byte	0
+	.uleb128 0x3
+	.long	0x7d7
+	.quad	.LBI1877
+	.value	.LVU3013
+	.quad	.LBB1877
+	.quad	.LBE1877-.LBB1877
+	.byte	0x3a
+	.value	0x665
+	.long	0x462a
+	.uleb128 0x2
+	.long	0x7f2
+	.uleb128 0x1
+	.long	0x7e8
+	.long	.LLST307
+	.long	.LVUS307
+	.byte	0
+	.uleb128 0x3
+	.long	0x7d7
+	.quad	.LBI1879
+	.value	.LVU3023
+	.quad	.LBB1879
+	.quad	.LBE1879-.LBB1879
+	.byte	0x3a
+	.value	0x69f
+	.long	0x4663
+	.uleb128 0x2
+	.long	0x7f2
+	.uleb128 0x1
+	.long	0x7e8
+	.long	.LLST308
+	.long	.LVUS308
+	.byte	0
+	.uleb128 0x3
+	.long	0x7d7
+	.quad	.LBI1881
+	.value	.LVU3035
+	.quad	.LBB1881
+	.quad	.LBE1881-.LBB1881
+	.byte	0x3a
+	.value	0x6f9
+	.long	0x469c
+	.uleb128 0x2
+	.long	0x7f2
+	.uleb128 0x1
+	.long	0x7e8
+	.long	.LLST309
+	.long	.LVUS309
+	.byte	0
+	.uleb128 0x3
+	.long	0x7d7
+	.quad	.LBI1883
+	.value	.LVU3045
+	.quad	.LBB1883
+	.quad	.LBE1883-.LBB1883
+	.byte	0x3a
+	.value	0x733
+	.long	0x46d5
+	.uleb128 0x2
+	.long	0x7f2
+	.uleb128 0x1
+	.long	0x7e8
+	.long	.LLST310
+	.long	.LVUS310
+	.byte	0
+	.uleb128 0x3
+	.long	0x7d7
+	.quad	.LBI1885
+	.value	.LVU3058
+	.quad	.LBB1885
+	.quad	.LBE1885-.LBB1885
+	.byte	0x3a
+	.value	0x79f
+	.long	0x470e
+	.uleb128 0x2
+	.long	0x7f2
+	.uleb128 0x1
+	.long	0x7e8
+	.long	.LLST311
+	.long	.LVUS311
+	.byte	0
+	.uleb128 0x3
+	.long	0x7d7
+	.quad	.LBI1887
+	.value	.LVU3068
+	.quad	.LBB1887
+	.quad	.LBE1887-.LBB1887
+	.byte	0x3a
+	.value	0x7d9
+	.long	0x4747
+	.uleb128 0x2
+	.long	0x7f2
+	.uleb128 0x1
+	.long	0x7e8
+	.long	.LLST312
+	.long	.LVUS312
+	.byte	0
+	.uleb128 0x3
+	.long	0x7d7
+	.quad	.LBI1889
+	.value	.LVU3078
+	.quad	.LBB1889
+	.quad	.LBE1889-.LBB1889
+	.byte	0x3a
+	.value	0x833
+	.long	0x4780
+	.uleb128 0x2
+	.long	0x7f2
+	.uleb128 0x1
+	.long	0x7e8
+	.long	.LLST313
+	.long	.LVUS313
+	.byte	0
+	.uleb128 0x5
+	.long	0x7d7
+	.quad	.LBI1891
+	.value	.LVU3088
+	.long	.LLRL314
+	.byte	0x3a
+	.value	0x86d
+	.long	0x47ad
+	.uleb128 0x2
+	.long	0x7f2
+	.uleb128 0x1
+	.long	0x7e8
+	.long	.LLST315
+	.long	.LVUS315
+	.byte	0
+	.uleb128 0x3
+	.long	0x7d7
+	.quad	.LBI1895
+	.value	.LVU3102
+	.quad	.LBB1895
+	.quad	.LBE1895-.LBB1895
+	.byte	0x3a
+	.value	0x8d9
+	.long	0x47ee
+	.uleb128 0x1
+	.long	0x7f2
+	.long	.LLST316
+	.long	.LVUS316
+	.uleb128 0x1
+	.long	0x7e8
+	.long	.LLST317
+	.long	.LVUS317
+	.byte	0
+	.uleb128 0x3
+	.long	0x7d7
+	.quad	.LBI1897
+	.value	.LVU3112
+	.quad	.LBB1897
+	.quad	.LBE1897-.LBB1897
+	.byte	0x3a
+	.value	0x913
+	.long	0x4827
+	.uleb128 0x2
+	.long	0x7f2
+	.uleb128 0x1
+	.long	0x7e8
+	.long	.LLST318
+	.long	.LVUS318
+	.byte	0
+	.uleb128 0x3
+	.long	0x7d7
+	.quad	.LBI1899
+	.value	.LVU3122
+	.quad	.LBB1899
+	.quad	.LBE1899-.LBB1899
+	.byte	0x3a
+	.value	0x96d
+	.long	0x4860
+	.uleb128 0x2
+	.long	0x7f2
+	.uleb128 0x1
+	.long	0x7e8
+	.long	.LLST319
+	.long	.LVUS319
+	.byte	0
+	.uleb128 0x3
+	.long	0x7d7
+	.quad	.LBI1901
+	.value	.LVU3132
+	.quad	.LBB1901
+	.quad	.LBE1901-.LBB1901
+	.byte	0x3a
+	.value	0x9a7
+	.long	0x4899
+	.uleb128 0x2
+	.long	0x7f2
+	.uleb128 0x1
+	.long	0x7e8
+	.long	.LLST320
+	.long	.LVUS320
+	.byte	0
+	.uleb128 0x4
+	.long	0x7d7
+	.quad	.LBI1903
+	.value	.LVU3146
+	.quad	.LBB1903
+	.quad	.LBE1903-.LBB1903
+	.byte	0x3b
+	.byte	0x4c
+	.long	0x48d1
+	.uleb128 0x2
+	.long	0x7f2
+	.uleb128 0x1
+	.long	0x7e8
+	.long	.LLST321
+	.long	.LVUS321
+	.byte	0
+	.uleb128 0x4
+	.long	0x7d7
+	.quad	.LBI1905
+	.value	.LVU3156
+	.quad	.LBB1905
+	.quad	.LBE1905-.LBB1905
+	.byte	0x3b
+	.byte	0x86
+	.long	0x4909
+	.uleb128 0x2
+	.long	0x7f2
+	.uleb128 0x1
+	.long	0x7e8
+	.long	.LLST322
+	.long	.LVUS322
+	.byte	0
+	.uleb128 0x4
+	.long	0x7d7
+	.quad	.LBI1907
+	.value	.LVU3166
+	.quad	.LBB1907
+	.quad	.LBE1907-.LBB1907
+	.byte	0x3b
+	.byte	0xdf
+	.long	0x4941
+	.uleb128 0x2
+	.long	0x7f2
+	.uleb128 0x1
+	.long	0x7e8
+	.long	.LLST323
+	.long	.LVUS323
+	.byte	0
+	.uleb128 0x3
+	.long	0x7d7
+	.quad	.LBI1909
+	.value	.LVU3176
+	.quad	.LBB1909
+	.quad	.LBE1909-.LBB1909
+	.byte	0x3b
+	.value	0x119
+	.long	0x497a
+	.uleb128 0x2
+	.long	0x7f2
+	.uleb128 0x1
+	.long	0x7e8
+	.long	.LLST324
+	.long	.LVUS324
+	.byte	0
+	.uleb128 0x3
+	.long	0x7d7
+	.quad	.LBI1911
+	.value	.LVU3189
+	.quad	.LBB1911
+	.quad	.LBE1911-.LBB1911
+	.byte	0x3b
+	.value	0x184
+	.long	0x49b3
+	.uleb128 0x2
+	.long	0x7f2
+	.uleb128 0x1
+	.long	0x7e8
+	.long	.LLST325
+	.long	.LVUS325
+	.byte	0
+	.uleb128 0x5
+	.long	0x7d7
+	.quad	.LBI1913
+	.value	.LVU3200
+	.long	.LLRL326
+	.byte	0x3b
+	.value	0x1be
+	.long	0x49e0
+	.uleb128 0x2
+	.long	0x7f2
+	.uleb128 0x1
+	.long	0x7e8
+	.long	.LLST327
+	.long	.LVUS327
+	.byte	0
+	.uleb128 0x3
+	.long	0x7d7
+	.quad	.LBI1917
+	.value	.LVU3212
+	.quad	.LBB1917
+	.quad	.LBE1917-.LBB1917
+	.byte	0x3b
+	.value	0x217
+	.long	0x4a19
+	.uleb128 0x2
+	.long	0x7f2
+	.uleb128 0x1
+	.long	0x7e8
+	.long	.LLST328
+	.long	.LVUS328
+	.byte	0
+	.uleb128 0x3
+	.long	0x7d7
+	.quad	.LBI1919
+	.value	.LVU3222
+	.quad	.LBB1919
+	.quad	.LBE1919-.LBB1919
+	.byte	0x3b
+	.value	0x251
+	.long	0x4a52
+	.uleb128 0x2
+	.long	0x7f2
+	.uleb128 0x1
+	.long	0x7e8
+	.long	.LLST329
+	.long	.LVUS329
+	.byte	0
+	.uleb128 0x3
+	.long	0x7d7
+	.quad	.LBI1921
+	.value	.LVU3234
+	.quad	.LBB1921
+	.quad	.LBE1921-.LBB1921
+	.byte	0x3b
+	.value	0x2bc
+	.long	0x4a8b
+	.uleb128 0x2
+	.long	0x7f2
+	.uleb128 0x1
+	.long	0x7e8
+	.long	.LLST330
+	.long	.LVUS330
+	.byte	0
+	.uleb128 0x5
+	.long	0x7d7
+	.quad	.LBI1923
+	.value	.LVU3244
+	.long	.LLRL331
+	.byte	0x3b
+	.value	0x2f6
+	.long	0x4ab8
+	.uleb128 0x2
+	.long	0x7f2
+	.uleb128 0x1
+	.long	0x7e8
+	.long	.LLST332
+	.long	.LVUS332
+	.byte	0
+	.uleb128 0x3
+	.long	0x7d7
+	.quad	.LBI1927
+	.value	.LVU3255
+	.quad	.LBB1927
+	.quad	.LBE1927-.LBB1927
+	.byte	0x3b
+	.value	0x34f
+	.long	0x4af1
+	.uleb128 0x2
+	.long	0x7f2
+	.uleb128 0x1
+	.long	0x7e8
+	.long	.LLST333
+	.long	.LVUS333
+	.byte	0
+	.uleb128 0x3
+	.long	0x7d7
+	.quad	.LBI1929
+	.value	.LVU3265
+	.quad	.LBB1929
+	.quad	.LBE1929-.LBB1929
+	.byte	0x3b
+	.value	0x389
+	.long	0x4b2a
+	.uleb128 0x2
+	.long	0x7f2
+	.uleb128 0x1
+	.long	0x7e8
+	.long	.LLST334
+	.long	.LVUS334
+	.byte	0
+	.uleb128 0x3
+	.long	0x7d7
+	.quad	.LBI1931
+	.value	.LVU3279
+	.quad	.LBB1931
+	.quad	.LBE1931-.LBB1931
+	.byte	0x3b
+	.value	0x3f4
+	.long	0x4b6b
+	.uleb128 0x1
+	.long	0x7f2
+	.long	.LLST335
+	.long	.LVUS335
+	.uleb128 0x1
+	.long	0x7e8
+	.long	.LLST336
+	.long	.LVUS336
+	.byte	0
+	.uleb128 0x3
+	.long	0x7d7
+	.quad	.LBI1933
+	.value	.LVU3289
+	.quad	.LBB1933
+	.quad	.LBE1933-.LBB1933
+	.byte	0x3b
+	.value	0x42e
+	.long	0x4ba4
+	.uleb128 0x2
+	.long	0x7f2
+	.uleb128 0x1
+	.long	0x7e8
+	.long	.LLST337
+	.long	.LVUS337
+	.byte	0
+	.uleb128 0x3
+	.long	0x7d7
+	.quad	.LBI1935
+	.value	.LVU3299
+	.quad	.LBB1935
+	.quad	.LBE1935-.LBB1935
+	.byte	0x3b
+	.value	0x487
+	.long	0x4bdd
+	.uleb128 0x2
+	.long	0x7f2
+	.uleb128 0x1
+	.long	0x7e8
+	.long	.LLST338
+	.long	.LVUS338
+	.byte	0
+	.uleb128 0x3
+	.long	0x7d7
+	.quad	.LBI1937
+	.value	.LVU3309
+	.quad	.LBB1937
+	.quad	.LBE1937-.LBB1937
+	.byte	0x3b
+	.value	0x4c1
+	.long	0x4c16
+	.uleb128 0x2
+	.long	0x7f2
+	.uleb128 0x1
+	.long	0x7e8
+	.long	.LLST339
+	.long	.LVUS339
+	.byte	0
+	.uleb128 0x3
+	.long	0x7d7
+	.quad	.LBI1939
+	.value	.LVU3321
+	.quad	.LBB1939
+	.quad	.LBE1939-.LBB1939
+	.byte	0x3b
+	.value	0x52c
+	.long	0x4c4f
+	.uleb128 0x2
+	.long	0x7f2
+	.uleb128 0x1
+	.long	0x7e8
+	.long	.LLST340
+	.long	.LVUS340
+	.byte	0
+	.uleb128 0x3
+	.long	0x7d7
+	.quad	.LBI1941
+	.value	.LVU3331
+	.quad	.LBB1941
+	.quad	.LBE1941-.LBB1941
+	.byte	0x3b
+	.value	0x566
+	.long	0x4c88
+	.uleb128 0x2
+	.long	0x7f2
+	.uleb128 0x1
+	.long	0x7e8
+	.long	.LLST341
+	.long	.LVUS341
+	.byte	0
+	.uleb128 0x5
+	.long	0x7d7
+	.quad	.LBI1943
+	.value	.LVU3341
+	.long	.LLRL342
+	.byte	0x3b
+	.value	0x5bf
+	.long	0x4cb5
+	.uleb128 0x2
+	.long	0x7f2
+	.uleb128 0x1
+	.long	0x7e8
+	.long	.LLST343
+	.long	.LVUS343
+	.byte	0
+	.uleb128 0x3
+	.long	0x7d7
+	.quad	.LBI1947
+	.value	.LVU3352
+	.quad	.LBB1947
+	.quad	.LBE1947-.LBB1947
+	.byte	0x3b
+	.value	0x5f9
+	.long	0x4cee
+	.uleb128 0x2
+	.long	0x7f2
+	.uleb128 0x1
+	.long	0x7e8
+	.long	.LLST344
+	.long	.LVUS344
+	.byte	0
+	.uleb128 0x3
+	.long	0x7d7
+	.quad	.LBI1949
+	.value	.LVU3362
+	.quad	.LBB1949
+	.quad	.LBE1949-.LBB1949
+	.byte	0x3b
+	.value	0x665
+	.long	0x4d2f
+	.uleb128 0x1
+	.long	0x7f2
+	.long	.LLST345
+	.long	.LVUS345
+	.uleb128 0x1
+	.long	0x7e8
+	.long	.LLST346
+	.long	.LVUS346
+	.byte	0
+	.uleb128 0x3
+	.long	0x7d7
+	.quad	.LBI1951
+	.value	.LVU3372
+	.quad	.LBB1951
+	.quad	.LBE1951-.LBB1951
+	.byte	0x3b
+	.value	0x69f
+	.long	0x4d68
+	.uleb128 0x2
+	.long	0x7f2
+	.uleb128 0x1
+	.long	0x7e8
+	.long	.LLST347
+	.long	.LVUS347
+	.byte	0
+	.uleb128 0x3
+	.long	0x7d7
+	.quad	.LBI1953
+	.value	.LVU3382
+	.quad	.LBB1953
+	.quad	.LBE1953-.LBB1953
+	.byte	0x3b
+	.value	0x6f9
+	.long	0x4da1
+	.uleb128 0x2
+	.long	0x7f2
+	.uleb128 0x1
+	.long	0x7e8
+	.long	.LLST348
+	.long	.LVUS348
+	.byte	0
+	.uleb128 0x3
+	.long	0x7d7
+	.quad	.LBI1955
+	.value	.LVU3392
+	.quad	.LBB1955
+	.quad	.LBE1955-.LBB1955
+	.byte	0x3b
+	.value	0x733
+	.long	0x4dda
+	.uleb128 0x2
+	.long	0x7f2
+	.uleb128 0x1
+	.long	0x7e8
+	.long	.LLST349
+	.long	.LVUS349
+	.byte	0
+	.uleb128 0x3
+	.long	0x7d7
+	.quad	.LBI1957
+	.value	.LVU3403
+	.quad	.LBB1957
+	.quad	.LBE1957-.LBB1957
+	.byte	0x3b
+	.value	0x79f
+	.long	0x4e13
+	.uleb128 0x2
+	.long	0x7f2
+	.uleb128 0x1
+	.long	0x7e8
+	.long	.LLST350
+	.long	.LVUS350
+	.byte	0
+	.uleb128 0x3
+	.long	0x7d7
+	.quad	.LBI1959
+	.value	.LVU3413
+	.quad	.LBB1959
+	.quad	.LBE1959-.LBB1959
+	.byte	0x3b
+	.value	0x7d9
+	.long	0x4e4c
+	.uleb128 0x2
+	.long	0x7f2
+	.uleb128 0x1
+	.long	0x7e8
+	.long	.LLST351
+	.long	.LVUS351
+	.byte	0
+	.uleb128 0x5
+	.long	0x7d7
+	.quad	.LBI1961
+	.value	.LVU3423
+	.long	.LLRL352
+	.byte	0x3b
+	.value	0x833
+	.long	0x4e79
+	.uleb128 0x2
+	.long	0x7f2
+	.uleb128 0x1
+	.long	0x7e8
+	.long	.LLST353
+	.long	.LVUS353
+	.byte	0
+	.uleb128 0x3
+	.long	0x7d7
+	.quad	.LBI1965
+	.value	.LVU3435
+	.quad	.LBB1965
+	.quad	.LBE1965-.LBB1965
+	.byte	0x3b
+	.value	0x86d
+	.long	0x4eb2
+	.uleb128 0x2
+	.long	0x7f2
+	.uleb128 0x1
+	.long	0x7e8
+	.long	.LLST354
+	.long	.LVUS354
+	.byte	0
+	.uleb128 0x5
+	.long	0x7d7
+	.quad	.LBI1967
+	.value	.LVU3446
+	.long	.LLRL355
+	.byte	0x3b
+	.value	0x8d9
+	.long	0x4edf
+	.uleb128 0x2
+	.long	0x7f2
+	.uleb128 0x1
+	.long	0x7e8
+	.long	.LLST356
+	.long	.LVUS356
+	.byte	0
+	.uleb128 0x3
+	.long	0x7d7
+	.quad	.LBI1971
+	.value	.LVU3457
+	.quad	.LBB1971
+	.quad	.LBE1971-.LBB1971
+	.byte	0x3b
+	.value	0x913
+	.long	0x4f20
+	.uleb128 0x1
+	.long	0x7f2
+	.long	.LLST357
+	.long	.LVUS357
+	.uleb128 0x1
+	.long	0x7e8
+	.long	.LLST358
+	.long	.LVUS358
+	.byte	0
+	.uleb128 0x3
+	.long	0x7d7
+	.quad	.LBI1973
+	.value	.LVU3467
+	.quad	.LBB1973
+	.quad	.LBE1973-.LBB1973
+	.byte	0x3b
+	.value	0x96d
+	.long	0x4f59
+	.uleb128 0x2
+	.long	0x7f2
+	.uleb128 0x1
+	.long	0x7e8
+	.long	.LLST359
+	.long	.LVUS359
+	.byte	0
+	.uleb128 0x2e
+	.long	0x7d7
+	.quad	.LBI1975
+	.value	.LVU3477
+	.long	.LLRL360
+	.byte	0x1
+	.byte	0x3b
+	.value	0x9a7
+	.uleb128 0x2
+	.long	0x7f2
+	.uleb128 0x1
+	.long	0x7e8
+	.long	.LLST361
+	.long	.LVUS361
+	.byte	0
+	.byte	0
+	.byte	0
+	.section	.debug_abbrev,"",@progbits
+.Ldebug_abbrev0:
+	.uleb128 0x1
+	.uleb128 0x5
+	.byte	0
+	.uleb128 0x31
+	.uleb128 0x13
+	.uleb128 0x2
+	.uleb128 0x17
+	.uleb128 0x2137
+	.uleb128 0x17
+	.byte	0
+	.byte	0
+	.uleb128 0x2
+	.uleb128 0x5
+	.byte	0
+	.uleb128 0x31
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x1d
+	.byte	0x1
+	.uleb128 0x31
+	.uleb128 0x13
+	.uleb128 0x52
+	.uleb128 0x1
+	.uleb128 0x2138
+	.uleb128 0x5
+	.uleb128 0x11
+	.uleb128 0x1
+	.uleb128 0x12
+	.uleb128 0x7
+	.uleb128 0x58
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x59
+	.uleb128 0xb
+	.uleb128 0x57
+	.uleb128 0x5
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x4
+	.uleb128 0x1d
+	.byte	0x1
+	.uleb128 0x31
+	.uleb128 0x13
+	.uleb128 0x52
+	.uleb128 0x1
+	.uleb128 0x2138
+	.uleb128 0x5
+	.uleb128 0x11
+	.uleb128 0x1
+	.uleb128 0x12
+	.uleb128 0x7
+	.uleb128 0x58
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x59
+	.uleb128 0xb
+	.uleb128 0x57
+	.uleb128 0xb
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x5
+	.uleb128 0x1d
+	.byte	0x1
+	.uleb128 0x31
+	.uleb128 0x13
+	.uleb128 0x52
+	.uleb128 0x1
+	.uleb128 0x2138
+	.uleb128 0x5
+	.uleb128 0x55
+	.uleb128 0x17
+	.uleb128 0x58
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x59
+	.uleb128 0xb
+	.uleb128 0x57
+	.uleb128 0x5
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x6
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x31
+	.uleb128 0x13
+	.uleb128 0x2
+	.uleb128 0x17
+	.uleb128 0x2137
+	.uleb128 0x17
+	.byte	0
+	.byte	0
+	.uleb128 0x7
+	.uleb128 0x5
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x8
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x8
+	.uleb128 0x24
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x3e
+	.uleb128 0xb
+	.uleb128 0x3
+	.uleb128 0xe
+	.byte	0
+	.byte	0
+	.uleb128 0x9
+	.uleb128 0x21
+	.byte	0
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x2f
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0xa
+	.uleb128 0x1
+	.byte	0x1
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0xb
+	.byte	0x1
+	.uleb128 0x55
+	.uleb128 0x17
+	.byte	0
+	.byte	0
+	.uleb128 0xc
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x8
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0xd
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x31
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0xe
+	.uleb128 0x26
+	.byte	0
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0xf
+	.uleb128 0x16
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x10
+	.uleb128 0xf
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0x21
+	.sleb128 8
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x11
+	.uleb128 0x1d
+	.byte	0x1
+	.uleb128 0x31
+	.uleb128 0x13
+	.uleb128 0x52
+	.uleb128 0x1
+	.uleb128 0x2138
+	.uleb128 0x5
+	.uleb128 0x55
+	.uleb128 0x17
+	.uleb128 0x58
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x59
+	.uleb128 0xb
+	.uleb128 0x57
+	.uleb128 0xb
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x12
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x13
+	.uleb128 0xd
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x8
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 6
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x38
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x14
+	.uleb128 0x5
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x8
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x2
+	.uleb128 0x17
+	.uleb128 0x2137
+	.uleb128 0x17
+	.byte	0
+	.byte	0
+	.uleb128 0x15
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x31
+	.uleb128 0x13
+	.uleb128 0x2
+	.uleb128 0x18
+	.byte	0
+	.byte	0
+	.uleb128 0x16
+	.uleb128 0x49
+	.byte	0
+	.uleb128 0x2
+	.uleb128 0x18
+	.uleb128 0x7e
+	.uleb128 0x18
+	.byte	0
+	.byte	0
+	.uleb128 0x17
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 20
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x20
+	.uleb128 0x21
+	.sleb128 3
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x18
+	.uleb128 0xd
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 6
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 14
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x38
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x19
+	.uleb128 0x16
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x8
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 2
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x1a
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 2
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x1c
+	.uleb128 0xa
+	.byte	0
+	.byte	0
+	.uleb128 0x1b
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 6
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x11
+	.uleb128 0x1
+	.uleb128 0x12
+	.uleb128 0x7
+	.uleb128 0x40
+	.uleb128 0x18
+	.uleb128 0x7a
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x1c
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x8
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x2
+	.uleb128 0x17
+	.uleb128 0x2137
+	.uleb128 0x17
+	.byte	0
+	.byte	0
+	.uleb128 0x1d
+	.uleb128 0x1d
+	.byte	0x1
+	.uleb128 0x31
+	.uleb128 0x13
+	.uleb128 0x55
+	.uleb128 0x17
+	.uleb128 0x58
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x59
+	.uleb128 0xb
+	.uleb128 0x57
+	.uleb128 0x21
+	.sleb128 5
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x1e
+	.uleb128 0x1d
+	.byte	0x1
+	.uleb128 0x31
+	.uleb128 0x13
+	.uleb128 0x52
+	.uleb128 0x1
+	.uleb128 0x2138
+	.uleb128 0x5
+	.uleb128 0x55
+	.uleb128 0x17
+	.uleb128 0x58
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x59
+	.uleb128 0xb
+	.uleb128 0x57
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x1f
+	.uleb128 0xb
+	.byte	0x1
+	.uleb128 0x31
+	.uleb128 0x13
+	.uleb128 0x11
+	.uleb128 0x1
+	.uleb128 0x12
+	.uleb128 0x7
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x20
+	.uleb128 0x48
+	.byte	0x1
+	.uleb128 0x7d
+	.uleb128 0x1
+	.uleb128 0x7f
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x21
+	.uleb128 0x5
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x22
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 2
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 19
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x20
+	.uleb128 0x21
+	.sleb128 3
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x23
+	.uleb128 0x11
+	.byte	0x1
+	.uleb128 0x25
+	.uleb128 0xe
+	.uleb128 0x13
+	.uleb128 0xb
+	.uleb128 0x3
+	.uleb128 0x1f
+	.uleb128 0x1b
+	.uleb128 0x1f
+	.uleb128 0x11
+	.uleb128 0x1
+	.uleb128 0x12
+	.uleb128 0x7
+	.uleb128 0x10
+	.uleb128 0x17
+	.byte	0
+	.byte	0
+	.uleb128 0x24
+	.uleb128 0x24
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x3e
+	.uleb128 0xb
+	.uleb128 0x3
+	.uleb128 0x8
+	.byte	0
+	.byte	0
+	.uleb128 0x25
+	.uleb128 0xf
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x26
+	.uleb128 0x13
+	.byte	0x1
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x88
+	.uleb128 0xb
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x27
+	.uleb128 0x26
+	.byte	0
+	.byte	0
+	.byte	0
+	.uleb128 0x28
+	.uleb128 0x5
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x2
+	.uleb128 0x17
+	.uleb128 0x2137
+	.uleb128 0x17
+	.byte	0
+	.byte	0
+	.uleb128 0x29
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x8
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x2
+	.uleb128 0x18
+	.byte	0
+	.byte	0
+	.uleb128 0x2a
+	.uleb128 0x1d
+	.byte	0x1
+	.uleb128 0x31
+	.uleb128 0x13
+	.uleb128 0x11
+	.uleb128 0x1
+	.uleb128 0x12
+	.uleb128 0x7
+	.uleb128 0x58
+	.uleb128 0xb
+	.uleb128 0x59
+	.uleb128 0xb
+	.uleb128 0x57
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x2b
+	.uleb128 0xb
+	.byte	0x1
+	.byte	0
+	.byte	0
+	.uleb128 0x2c
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3
+	.uleb128 0x8
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x20
+	.uleb128 0xb
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x2d
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x31
+	.uleb128 0x13
+	.uleb128 0x11
+	.uleb128 0x1
+	.uleb128 0x12
+	.uleb128 0x7
+	.uleb128 0x40
+	.uleb128 0x18
+	.uleb128 0x7a
+	.uleb128 0x19
+	.byte	0
+	.byte	0
+	.uleb128 0x2e
+	.uleb128 0x1d
+	.byte	0x1
+	.uleb128 0x31
+	.uleb128 0x13
+	.uleb128 0x52
+	.uleb128 0x1
+	.uleb128 0x2138
+	.uleb128 0x5
+	.uleb128 0x55
+	.uleb128 0x17
+	.uleb128 0x58
+	.uleb128 0xb
+	.uleb128 0x59
+	.uleb128 0xb
+	.uleb128 0x57
+	.uleb128 0x5
+	.byte	0
+	.byte	0
+	.byte	0
+	.section	.debug_loclists,"",@progbits
+	.long	.Ldebug_loc3-.Ldebug_loc2
+.Ldebug_loc2:
+	.value	0x5
+	.byte	0x8
+	.byte	0
+	.long	0
+.Ldebug_loc0:
+.LVUS378:
+	.uleb128 0
+	.uleb128 .LVU3576
+	.uleb128 .LVU3576
+	.uleb128 0
+.LLST378:
+	.byte	0x4
+	.uleb128 .LVL628-.Ltext0
+	.uleb128 .LVL632-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL632-.Ltext0
+	.uleb128 .LFE22-.Ltext0
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -248
+	.byte	0
+.LVUS379:
+	.uleb128 0
+	.uleb128 .LVU3574
+	.uleb128 .LVU3574
+	.uleb128 .LVU3586
+	.uleb128 .LVU3586
+	.uleb128 0
+.LLST379:
+	.byte	0x4
+	.uleb128 .LVL628-.Ltext0
+	.uleb128 .LVL631-.Ltext0
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x4
+	.uleb128 .LVL631-.Ltext0
+	.uleb128 .LVL635-.Ltext0
+	.uleb128 0x1
+	.byte	0x5c
+	.byte	0x4
+	.uleb128 .LVL635-.Ltext0
+	.uleb128 .LFE22-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x9f
+	.byte	0
+.LVUS380:
+	.uleb128 0
+	.uleb128 .LVU3586
+	.uleb128 .LVU3586
+	.uleb128 .LVU3824
+	.uleb128 .LVU3824
+	.uleb128 .LVU3825
+	.uleb128 .LVU3825
+	.uleb128 .LVU3828
+.LLST380:
+	.byte	0x4
+	.uleb128 .LVL628-.Ltext0
+	.uleb128 .LVL635-.Ltext0
+	.uleb128 0x1
+	.byte	0x51
+	.byte	0x4
+	.uleb128 .LVL635-.Ltext0
+	.uleb128 .LVL647-.Ltext0
+	.uleb128 0x1
+	.byte	0x56
+	.byte	0x4
+	.uleb128 .LVL647-.Ltext0
+	.uleb128 .LVL648-.Ltext0
+	.uleb128 0x3
+	.byte	0x76
+	.sleb128 -1
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL648-.Ltext0
+	.uleb128 .LVL650-.Ltext0
+	.uleb128 0x1
+	.byte	0x56
+	.byte	0
+.LVUS381:
+	.uleb128 .LVU3561
+	.uleb128 .LVU3574
+	.uleb128 .LVU3574
+	.uleb128 .LVU3738
+	.uleb128 .LVU3738
+	.uleb128 .LVU3824
+	.uleb128 .LVU3824
+	.uleb128 .LVU3835
+.LLST381:
+	.byte	0x4
+	.uleb128 .LVL629-.Ltext0
+	.uleb128 .LVL631-.Ltext0
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x4
+	.uleb128 .LVL631-.Ltext0
+	.uleb128 .LVL637-.Ltext0
+	.uleb128 0x1
+	.byte	0x5c
+	.byte	0x4
+	.uleb128 .LVL637-.Ltext0
+	.uleb128 .LVL647-.Ltext0
+	.uleb128 0x3
+	.byte	0x7c
+	.sleb128 -64
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL647-.Ltext0
+	.uleb128 .LVL652-.Ltext0
+	.uleb128 0x1
+	.byte	0x5c
+	.byte	0
+.LVUS382:
+	.uleb128 .LVU3580
+	.uleb128 .LVU3581
+	.uleb128 .LVU3581
+	.uleb128 .LVU3586
+	.uleb128 .LVU3586
+	.uleb128 .LVU3588
+	.uleb128 .LVU3588
+	.uleb128 .LVU3598
+	.uleb128 .LVU3598
+	.uleb128 .LVU3740
+	.uleb128 .LVU3740
+	.uleb128 .LVU3742
+	.uleb128 .LVU3742
+	.uleb128 .LVU3827
+	.uleb128 .LVU3827
+	.uleb128 .LVU3828
+.LLST382:
+	.byte	0x4
+	.uleb128 .LVL634-.Ltext0
+	.uleb128 .LVL634-.Ltext0
+	.uleb128 0xa
+	.byte	0x91
+	.sleb128 -248
+	.byte	0x6
+	.byte	0x23
+	.uleb128 0x60
+	.byte	0x93
+	.uleb128 0x4
+	.byte	0x93
+	.uleb128 0x4
+	.byte	0x4
+	.uleb128 .LVL634-.Ltext0
+	.uleb128 .LVL635-.Ltext0
+	.uleb128 0x10
+	.byte	0x91
+	.sleb128 -248
+	.byte	0x6
+	.byte	0x23
+	.uleb128 0x60
+	.byte	0x93
+	.uleb128 0x4
+	.byte	0x91
+	.sleb128 -248
+	.byte	0x6
+	.byte	0x23
+	.uleb128 0x64
+	.byte	0x93
+	.uleb128 0x4
+	.byte	0x4
+	.uleb128 .LVL635-.Ltext0
+	.uleb128 .LVL635-.Ltext0
+	.uleb128 0x8
+	.byte	0x7f
+	.sleb128 -64
+	.byte	0x9f
+	.byte	0x93
+	.uleb128 0x4
+	.byte	0x53
+	.byte	0x93
+	.uleb128 0x4
+	.byte	0x4
+	.uleb128 .LVL635-.Ltext0
+	.uleb128 .LVL636-.Ltext0
+	.uleb128 0x6
+	.byte	0x5f
+	.byte	0x93
+	.uleb128 0x4
+	.byte	0x53
+	.byte	0x93
+	.uleb128 0x4
+	.byte	0x4
+	.uleb128 .LVL636-.Ltext0
+	.uleb128 .LVL638-.Ltext0
+	.uleb128 0x6
+	.byte	0x5f
+	.byte	0x93
+	.uleb128 0x4
+	.byte	0x53
+	.byte	0x93
+	.uleb128 0x4
+	.byte	0x4
+	.uleb128 .LVL638-.Ltext0
+	.uleb128 .LVL639-.Ltext0
+	.uleb128 0x6
+	.byte	0x61
+	.byte	0x93
+	.uleb128 0x4
+	.byte	0x53
+	.byte	0x93
+	.uleb128 0x4
+	.byte	0x4
+	.uleb128 .LVL639-.Ltext0
+	.uleb128 .LVL649-.Ltext0
+	.uleb128 0x8
+	.byte	0x7f
+	.sleb128 -64
+	.byte	0x9f
+	.byte	0x93
+	.uleb128 0x4
+	.byte	0x53
+	.byte	0x93
+	.uleb128 0x4
+	.byte	0x4
+	.uleb128 .LVL649-.Ltext0
+	.uleb128 .LVL650-.Ltext0
+	.uleb128 0x5
+	.byte	0x93
+	.uleb128 0x4
+	.byte	0x53
+	.byte	0x93
+	.uleb128 0x4
+	.byte	0
+.LVUS384:
+	.uleb128 .LVU3564
+	.uleb128 .LVU3578
+.LLST384:
+	.byte	0x4
+	.uleb128 .LVL630-.Ltext0
+	.uleb128 .LVL633-.Ltext0
+	.uleb128 0x3
+	.byte	0x8
+	.byte	0x20
+	.byte	0x9f
+	.byte	0
+.LVUS385:
+	.uleb128 .LVU3564
+	.uleb128 .LVU3576
+	.uleb128 .LVU3576
+	.uleb128 .LVU3578
+.LLST385:
+	.byte	0x4
+	.uleb128 .LVL630-.Ltext0
+	.uleb128 .LVL632-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL632-.Ltext0
+	.uleb128 .LVL633-.Ltext0
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -248
+	.byte	0
+.LVUS386:
+	.uleb128 .LVU3564
+	.uleb128 .LVU3578
+.LLST386:
+	.byte	0x4
+	.uleb128 .LVL630-.Ltext0
+	.uleb128 .LVL633-.Ltext0
+	.uleb128 0x4
+	.byte	0x91
+	.sleb128 -224
+	.byte	0x9f
+	.byte	0
+.LVUS387:
+	.uleb128 .LVU3566
+	.uleb128 0
+.LLST387:
+	.byte	0x4
+	.uleb128 .LVL630-.Ltext0
+	.uleb128 .LFE22-.Ltext0
+	.uleb128 0x4
+	.byte	0x91
+	.sleb128 -224
+	.byte	0x9f
+	.byte	0
+.LVUS388:
+	.uleb128 .LVU3567
+	.uleb128 .LVU3576
+	.uleb128 .LVU3576
+	.uleb128 0
+.LLST388:
+	.byte	0x4
+	.uleb128 .LVL630-.Ltext0
+	.uleb128 .LVL632-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL632-.Ltext0
+	.uleb128 .LFE22-.Ltext0
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -248
+	.byte	0
+.LVUS389:
+	.uleb128 .LVU3568
+	.uleb128 .LVU3578
+.LLST389:
+	.byte	0x4
+	.uleb128 .LVL630-.Ltext0
+	.uleb128 .LVL633-.Ltext0
+	.uleb128 0x2
+	.byte	0x30
+	.byte	0x9f
+	.byte	0
+.LVUS391:
+	.uleb128 .LVU3599
+	.uleb128 .LVU3738
+	.uleb128 .LVU3738
+	.uleb128 .LVU3822
+.LLST391:
+	.byte	0x4
+	.uleb128 .LVL636-.Ltext0
+	.uleb128 .LVL637-.Ltext0
+	.uleb128 0x1
+	.byte	0x5c
+	.byte	0x4
+	.uleb128 .LVL637-.Ltext0
+	.uleb128 .LVL647-.Ltext0
+	.uleb128 0x3
+	.byte	0x7c
+	.sleb128 -64
+	.byte	0x9f
+	.byte	0
+.LVUS392:
+	.uleb128 .LVU3599
+	.uleb128 .LVU3822
+.LLST392:
+	.byte	0x4
+	.uleb128 .LVL636-.Ltext0
+	.uleb128 .LVL647-.Ltext0
+	.uleb128 0x6
+	.byte	0xa0
+	.long	.Ldebug_info0+773
+	.sleb128 0
+	.byte	0
+.LVUS393:
+	.uleb128 .LVU3599
+	.uleb128 .LVU3822
+.LLST393:
+	.byte	0x4
+	.uleb128 .LVL636-.Ltext0
+	.uleb128 .LVL647-.Ltext0
+	.uleb128 0x6
+	.byte	0xa0
+	.long	.Ldebug_info0+756
+	.sleb128 0
+	.byte	0
+.LVUS394:
+	.uleb128 .LVU3599
+	.uleb128 .LVU3822
+.LLST394:
+	.byte	0x4
+	.uleb128 .LVL636-.Ltext0
+	.uleb128 .LVL647-.Ltext0
+	.uleb128 0x4
+	.byte	0x91
+	.sleb128 -224
+	.byte	0x9f
+	.byte	0
+.LVUS396:
+	.uleb128 .LVU3745
+	.uleb128 .LVU3749
+	.uleb128 .LVU3749
+	.uleb128 .LVU3752
+	.uleb128 .LVU3752
+	.uleb128 .LVU3755
+	.uleb128 .LVU3755
+	.uleb128 .LVU3760
+	.uleb128 .LVU3760
+	.uleb128 .LVU3763
+	.uleb128 .LVU3763
+	.uleb128 .LVU3766
+	.uleb128 .LVU3766
+	.uleb128 .LVU3771
+	.uleb128 .LVU3771
+	.uleb128 .LVU3774
+	.uleb128 .LVU3774
+	.uleb128 .LVU3775
+.LLST396:
+	.byte	0x4
+	.uleb128 .LVL640-.Ltext0
+	.uleb128 .LVL640-.Ltext0
+	.uleb128 0x2
+	.byte	0x30
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL640-.Ltext0
+	.uleb128 .LVL640-.Ltext0
+	.uleb128 0x2
+	.byte	0x31
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL640-.Ltext0
+	.uleb128 .LVL640-.Ltext0
+	.uleb128 0x2
+	.byte	0x32
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL640-.Ltext0
+	.uleb128 .LVL641-.Ltext0
+	.uleb128 0x2
+	.byte	0x33
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL641-.Ltext0
+	.uleb128 .LVL641-.Ltext0
+	.uleb128 0x2
+	.byte	0x34
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL641-.Ltext0
+	.uleb128 .LVL641-.Ltext0
+	.uleb128 0x2
+	.byte	0x35
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL641-.Ltext0
+	.uleb128 .LVL642-.Ltext0
+	.uleb128 0x2
+	.byte	0x36
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL642-.Ltext0
+	.uleb128 .LVL642-.Ltext0
+	.uleb128 0x2
+	.byte	0x37
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL642-.Ltext0
+	.uleb128 .LVL642-.Ltext0
+	.uleb128 0x2
+	.byte	0x38
+	.byte	0x9f
+	.byte	0
+.LVUS398:
+	.uleb128 .LVU3603
+	.uleb128 .LVU3745
+.LLST398:
+	.byte	0x4
+	.uleb128 .LVL636-.Ltext0
+	.uleb128 .LVL640-.Ltext0
+	.uleb128 0x3
+	.byte	0x8
+	.byte	0x40
+	.byte	0x9f
+	.byte	0
+.LVUS399:
+	.uleb128 .LVU3603
+	.uleb128 .LVU3738
+	.uleb128 .LVU3738
+	.uleb128 .LVU3745
+.LLST399:
+	.byte	0x4
+	.uleb128 .LVL636-.Ltext0
+	.uleb128 .LVL637-.Ltext0
+	.uleb128 0x1
+	.byte	0x5c
+	.byte	0x4
+	.uleb128 .LVL637-.Ltext0
+	.uleb128 .LVL640-.Ltext0
+	.uleb128 0x3
+	.byte	0x7c
+	.sleb128 -64
+	.byte	0x9f
+	.byte	0
+.LVUS400:
+	.uleb128 .LVU3603
+	.uleb128 .LVU3745
+.LLST400:
+	.byte	0x4
+	.uleb128 .LVL636-.Ltext0
+	.uleb128 .LVL640-.Ltext0
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -256
+	.byte	0
+.LVUS401:
+	.uleb128 .LVU3605
+	.uleb128 .LVU3828
+.LLST401:
+	.byte	0x4
+	.uleb128 .LVL636-.Ltext0
+	.uleb128 .LVL650-.Ltext0
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -256
+	.byte	0
+.LVUS402:
+	.uleb128 .LVU3606
+	.uleb128 .LVU3738
+	.uleb128 .LVU3738
+	.uleb128 .LVU3828
+.LLST402:
+	.byte	0x4
+	.uleb128 .LVL636-.Ltext0
+	.uleb128 .LVL637-.Ltext0
+	.uleb128 0x1
+	.byte	0x5c
+	.byte	0x4
+	.uleb128 .LVL637-.Ltext0
+	.uleb128 .LVL650-.Ltext0
+	.uleb128 0x3
+	.byte	0x7c
+	.sleb128 -64
+	.byte	0x9f
+	.byte	0
+.LVUS403:
+	.uleb128 .LVU3607
+	.uleb128 .LVU3616
+	.uleb128 .LVU3616
+	.uleb128 .LVU3624
+	.uleb128 .LVU3624
+	.uleb128 .LVU3632
+	.uleb128 .LVU3632
+	.uleb128 .LVU3640
+	.uleb128 .LVU3640
+	.uleb128 .LVU3648
+	.uleb128 .LVU3648
+	.uleb128 .LVU3656
+	.uleb128 .LVU3656
+	.uleb128 .LVU3664
+	.uleb128 .LVU3664
+	.uleb128 .LVU3672
+	.uleb128 .LVU3672
+	.uleb128 .LVU3680
+	.uleb128 .LVU3680
+	.uleb128 .LVU3688
+	.uleb128 .LVU3688
+	.uleb128 .LVU3696
+	.uleb128 .LVU3696
+	.uleb128 .LVU3704
+	.uleb128 .LVU3704
+	.uleb128 .LVU3712
+	.uleb128 .LVU3712
+	.uleb128 .LVU3720
+	.uleb128 .LVU3720
+	.uleb128 .LVU3728
+	.uleb128 .LVU3728
+	.uleb128 .LVU3744
+	.uleb128 .LVU3744
+	.uleb128 .LVU3745
+.LLST403:
+	.byte	0x4
+	.uleb128 .LVL636-.Ltext0
+	.uleb128 .LVL636-.Ltext0
+	.uleb128 0x2
+	.byte	0x30
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL636-.Ltext0
+	.uleb128 .LVL636-.Ltext0
+	.uleb128 0x2
+	.byte	0x31
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL636-.Ltext0
+	.uleb128 .LVL636-.Ltext0
+	.uleb128 0x2
+	.byte	0x32
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL636-.Ltext0
+	.uleb128 .LVL636-.Ltext0
+	.uleb128 0x2
+	.byte	0x33
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL636-.Ltext0
+	.uleb128 .LVL636-.Ltext0
+	.uleb128 0x2
+	.byte	0x34
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL636-.Ltext0
+	.uleb128 .LVL636-.Ltext0
+	.uleb128 0x2
+	.byte	0x35
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL636-.Ltext0
+	.uleb128 .LVL636-.Ltext0
+	.uleb128 0x2
+	.byte	0x36
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL636-.Ltext0
+	.uleb128 .LVL636-.Ltext0
+	.uleb128 0x2
+	.byte	0x37
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL636-.Ltext0
+	.uleb128 .LVL636-.Ltext0
+	.uleb128 0x2
+	.byte	0x38
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL636-.Ltext0
+	.uleb128 .LVL636-.Ltext0
+	.uleb128 0x2
+	.byte	0x39
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL636-.Ltext0
+	.uleb128 .LVL636-.Ltext0
+	.uleb128 0x2
+	.byte	0x3a
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL636-.Ltext0
+	.uleb128 .LVL636-.Ltext0
+	.uleb128 0x2
+	.byte	0x3b
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL636-.Ltext0
+	.uleb128 .LVL636-.Ltext0
+	.uleb128 0x2
+	.byte	0x3c
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL636-.Ltext0
+	.uleb128 .LVL636-.Ltext0
+	.uleb128 0x2
+	.byte	0x3d
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL636-.Ltext0
+	.uleb128 .LVL636-.Ltext0
+	.uleb128 0x2
+	.byte	0x3e
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL636-.Ltext0
+	.uleb128 .LVL640-.Ltext0
+	.uleb128 0x2
+	.byte	0x3f
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL640-.Ltext0
+	.uleb128 .LVL640-.Ltext0
+	.uleb128 0x2
+	.byte	0x40
+	.byte	0x9f
+	.byte	0
+.LVUS405:
+	.uleb128 .LVU3610
+	.uleb128 .LVU3614
+	.uleb128 .LVU3618
+	.uleb128 .LVU3622
+	.uleb128 .LVU3626
+	.uleb128 .LVU3630
+	.uleb128 .LVU3634
+	.uleb128 .LVU3638
+	.uleb128 .LVU3642
+	.uleb128 .LVU3646
+	.uleb128 .LVU3650
+	.uleb128 .LVU3654
+	.uleb128 .LVU3658
+	.uleb128 .LVU3662
+	.uleb128 .LVU3666
+	.uleb128 .LVU3670
+	.uleb128 .LVU3674
+	.uleb128 .LVU3678
+	.uleb128 .LVU3682
+	.uleb128 .LVU3686
+	.uleb128 .LVU3690
+	.uleb128 .LVU3694
+	.uleb128 .LVU3698
+	.uleb128 .LVU3702
+	.uleb128 .LVU3706
+	.uleb128 .LVU3710
+	.uleb128 .LVU3714
+	.uleb128 .LVU3718
+	.uleb128 .LVU3722
+	.uleb128 .LVU3726
+	.uleb128 .LVU3730
+	.uleb128 .LVU3734
+.LLST405:
+	.byte	0x4
+	.uleb128 .LVL636-.Ltext0
+	.uleb128 .LVL636-.Ltext0
+	.uleb128 0x1
+	.byte	0x5c
+	.byte	0x4
+	.uleb128 .LVL636-.Ltext0
+	.uleb128 .LVL636-.Ltext0
+	.uleb128 0x3
+	.byte	0x7c
+	.sleb128 4
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL636-.Ltext0
+	.uleb128 .LVL636-.Ltext0
+	.uleb128 0x3
+	.byte	0x7c
+	.sleb128 8
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL636-.Ltext0
+	.uleb128 .LVL636-.Ltext0
+	.uleb128 0x3
+	.byte	0x7c
+	.sleb128 12
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL636-.Ltext0
+	.uleb128 .LVL636-.Ltext0
+	.uleb128 0x3
+	.byte	0x7c
+	.sleb128 16
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL636-.Ltext0
+	.uleb128 .LVL636-.Ltext0
+	.uleb128 0x3
+	.byte	0x7c
+	.sleb128 20
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL636-.Ltext0
+	.uleb128 .LVL636-.Ltext0
+	.uleb128 0x3
+	.byte	0x7c
+	.sleb128 24
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL636-.Ltext0
+	.uleb128 .LVL636-.Ltext0
+	.uleb128 0x3
+	.byte	0x7c
+	.sleb128 28
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL636-.Ltext0
+	.uleb128 .LVL636-.Ltext0
+	.uleb128 0x3
+	.byte	0x7c
+	.sleb128 32
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL636-.Ltext0
+	.uleb128 .LVL636-.Ltext0
+	.uleb128 0x3
+	.byte	0x7c
+	.sleb128 36
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL636-.Ltext0
+	.uleb128 .LVL636-.Ltext0
+	.uleb128 0x3
+	.byte	0x7c
+	.sleb128 40
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL636-.Ltext0
+	.uleb128 .LVL636-.Ltext0
+	.uleb128 0x3
+	.byte	0x7c
+	.sleb128 44
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL636-.Ltext0
+	.uleb128 .LVL636-.Ltext0
+	.uleb128 0x3
+	.byte	0x7c
+	.sleb128 48
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL636-.Ltext0
+	.uleb128 .LVL636-.Ltext0
+	.uleb128 0x3
+	.byte	0x7c
+	.sleb128 52
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL636-.Ltext0
+	.uleb128 .LVL636-.Ltext0
+	.uleb128 0x3
+	.byte	0x7c
+	.sleb128 56
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL636-.Ltext0
+	.uleb128 .LVL636-.Ltext0
+	.uleb128 0x3
+	.byte	0x7c
+	.sleb128 60
+	.byte	0x9f
+	.byte	0
+.LVUS406:
+	.uleb128 .LVU3613
+	.uleb128 .LVU3621
+	.uleb128 .LVU3621
+	.uleb128 .LVU3629
+	.uleb128 .LVU3629
+	.uleb128 .LVU3637
+	.uleb128 .LVU3637
+	.uleb128 .LVU3645
+	.uleb128 .LVU3645
+	.uleb128 .LVU3653
+	.uleb128 .LVU3653
+	.uleb128 .LVU3661
+	.uleb128 .LVU3661
+	.uleb128 .LVU3669
+	.uleb128 .LVU3669
+	.uleb128 .LVU3677
+	.uleb128 .LVU3677
+	.uleb128 .LVU3685
+	.uleb128 .LVU3685
+	.uleb128 .LVU3693
+	.uleb128 .LVU3693
+	.uleb128 .LVU3701
+	.uleb128 .LVU3701
+	.uleb128 .LVU3709
+	.uleb128 .LVU3709
+	.uleb128 .LVU3717
+	.uleb128 .LVU3717
+	.uleb128 .LVU3725
+	.uleb128 .LVU3725
+	.uleb128 .LVU3733
+	.uleb128 .LVU3733
+	.uleb128 .LVU3738
+	.uleb128 .LVU3738
+	.uleb128 .LVU3787
+.LLST406:
+	.byte	0x4
+	.uleb128 .LVL636-.Ltext0
+	.uleb128 .LVL636-.Ltext0
+	.uleb128 0x2
+	.byte	0x7c
+	.sleb128 0
+	.byte	0x4
+	.uleb128 .LVL636-.Ltext0
+	.uleb128 .LVL636-.Ltext0
+	.uleb128 0x2
+	.byte	0x7c
+	.sleb128 4
+	.byte	0x4
+	.uleb128 .LVL636-.Ltext0
+	.uleb128 .LVL636-.Ltext0
+	.uleb128 0x2
+	.byte	0x7c
+	.sleb128 8
+	.byte	0x4
+	.uleb128 .LVL636-.Ltext0
+	.uleb128 .LVL636-.Ltext0
+	.uleb128 0x2
+	.byte	0x7c
+	.sleb128 12
+	.byte	0x4
+	.uleb128 .LVL636-.Ltext0
+	.uleb128 .LVL636-.Ltext0
+	.uleb128 0x2
+	.byte	0x7c
+	.sleb128 16
+	.byte	0x4
+	.uleb128 .LVL636-.Ltext0
+	.uleb128 .LVL636-.Ltext0
+	.uleb128 0x2
+	.byte	0x7c
+	.sleb128 20
+	.byte	0x4
+	.uleb128 .LVL636-.Ltext0
+	.uleb128 .LVL636-.Ltext0
+	.uleb128 0x2
+	.byte	0x7c
+	.sleb128 24
+	.byte	0x4
+	.uleb128 .LVL636-.Ltext0
+	.uleb128 .LVL636-.Ltext0
+	.uleb128 0x2
+	.byte	0x7c
+	.sleb128 28
+	.byte	0x4
+	.uleb128 .LVL636-.Ltext0
+	.uleb128 .LVL636-.Ltext0
+	.uleb128 0x2
+	.byte	0x7c
+	.sleb128 32
+	.byte	0x4
+	.uleb128 .LVL636-.Ltext0
+	.uleb128 .LVL636-.Ltext0
+	.uleb128 0x2
+	.byte	0x7c
+	.sleb128 36
+	.byte	0x4
+	.uleb128 .LVL636-.Ltext0
+	.uleb128 .LVL636-.Ltext0
+	.uleb128 0x2
+	.byte	0x7c
+	.sleb128 40
+	.byte	0x4
+	.uleb128 .LVL636-.Ltext0
+	.uleb128 .LVL636-.Ltext0
+	.uleb128 0x2
+	.byte	0x7c
+	.sleb128 44
+	.byte	0x4
+	.uleb128 .LVL636-.Ltext0
+	.uleb128 .LVL636-.Ltext0
+	.uleb128 0x2
+	.byte	0x7c
+	.sleb128 48
+	.byte	0x4
+	.uleb128 .LVL636-.Ltext0
+	.uleb128 .LVL636-.Ltext0
+	.uleb128 0x2
+	.byte	0x7c
+	.sleb128 52
+	.byte	0x4
+	.uleb128 .LVL636-.Ltext0
+	.uleb128 .LVL636-.Ltext0
+	.uleb128 0x2
+	.byte	0x7c
+	.sleb128 56
+	.byte	0x4
+	.uleb128 .LVL636-.Ltext0
+	.uleb128 .LVL637-.Ltext0
+	.uleb128 0x2
+	.byte	0x7c
+	.sleb128 60
+	.byte	0x4
+	.uleb128 .LVL637-.Ltext0
+	.uleb128 .LVL643-1-.Ltext0
+	.uleb128 0x2
+	.byte	0x7c
+	.sleb128 -4
+	.byte	0
+.LVUS407:
+	.uleb128 .LVU3789
+	.uleb128 .LVU3797
+	.uleb128 .LVU3797
+	.uleb128 .LVU3799
+	.uleb128 .LVU3799
+	.uleb128 .LVU3801
+	.uleb128 .LVU3801
+	.uleb128 .LVU3808
+	.uleb128 .LVU3808
+	.uleb128 .LVU3811
+	.uleb128 .LVU3811
+	.uleb128 .LVU3816
+	.uleb128 .LVU3816
+	.uleb128 .LVU3819
+	.uleb128 .LVU3819
+	.uleb128 .LVU3821
+	.uleb128 .LVU3821
+	.uleb128 .LVU3822
+.LLST407:
+	.byte	0x4
+	.uleb128 .LVL643-.Ltext0
+	.uleb128 .LVL644-.Ltext0
+	.uleb128 0x2
+	.byte	0x30
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL644-.Ltext0
+	.uleb128 .LVL644-.Ltext0
+	.uleb128 0x2
+	.byte	0x31
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL644-.Ltext0
+	.uleb128 .LVL644-.Ltext0
+	.uleb128 0x2
+	.byte	0x32
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL644-.Ltext0
+	.uleb128 .LVL645-.Ltext0
+	.uleb128 0x2
+	.byte	0x33
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL645-.Ltext0
+	.uleb128 .LVL645-.Ltext0
+	.uleb128 0x2
+	.byte	0x34
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL645-.Ltext0
+	.uleb128 .LVL646-.Ltext0
+	.uleb128 0x2
+	.byte	0x35
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL646-.Ltext0
+	.uleb128 .LVL647-.Ltext0
+	.uleb128 0x2
+	.byte	0x36
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL647-.Ltext0
+	.uleb128 .LVL647-.Ltext0
+	.uleb128 0x2
+	.byte	0x37
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL647-.Ltext0
+	.uleb128 .LVL647-.Ltext0
+	.uleb128 0x2
+	.byte	0x38
+	.byte	0x9f
+	.byte	0
+.LVUS408:
+	.uleb128 .LVU3828
+	.uleb128 .LVU3830
+.LLST408:
+	.byte	0x4
+	.uleb128 .LVL650-.Ltext0
+	.uleb128 .LVL651-.Ltext0
+	.uleb128 0x2
+	.byte	0x30
+	.byte	0x9f
+	.byte	0
+.LVUS362:
+	.uleb128 0
+	.uleb128 .LVU3508
+	.uleb128 .LVU3508
+	.uleb128 .LVU3557
+	.uleb128 .LVU3557
+	.uleb128 0
+.LLST362:
+	.byte	0x4
+	.uleb128 .LVL617-.Ltext0
+	.uleb128 .LVL621-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL621-.Ltext0
+	.uleb128 .LVL627-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0x4
+	.uleb128 .LVL627-.Ltext0
+	.uleb128 .LFE21-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x9f
+	.byte	0
+.LVUS363:
+	.uleb128 0
+	.uleb128 .LVU3512
+	.uleb128 .LVU3512
+	.uleb128 0
+.LLST363:
+	.byte	0x4
+	.uleb128 .LVL617-.Ltext0
+	.uleb128 .LVL622-.Ltext0
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x4
+	.uleb128 .LVL622-.Ltext0
+	.uleb128 .LFE21-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x9f
+	.byte	0
+.LVUS365:
+	.uleb128 .LVU3490
+	.uleb128 .LVU3512
+	.uleb128 .LVU3512
+	.uleb128 .LVU3555
+.LLST365:
+	.byte	0x4
+	.uleb128 .LVL618-.Ltext0
+	.uleb128 .LVL622-.Ltext0
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x4
+	.uleb128 .LVL622-.Ltext0
+	.uleb128 .LVL626-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x9f
+	.byte	0
+.LVUS366:
+	.uleb128 .LVU3490
+	.uleb128 .LVU3508
+	.uleb128 .LVU3508
+	.uleb128 .LVU3555
+.LLST366:
+	.byte	0x4
+	.uleb128 .LVL618-.Ltext0
+	.uleb128 .LVL621-.Ltext0
+	.uleb128 0x4
+	.byte	0x75
+	.sleb128 104
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL621-.Ltext0
+	.uleb128 .LVL626-.Ltext0
+	.uleb128 0x4
+	.byte	0x73
+	.sleb128 104
+	.byte	0x9f
+	.byte	0
+.LVUS367:
+	.uleb128 .LVU3490
+	.uleb128 .LVU3508
+	.uleb128 .LVU3508
+	.uleb128 .LVU3555
+.LLST367:
+	.byte	0x4
+	.uleb128 .LVL618-.Ltext0
+	.uleb128 .LVL621-.Ltext0
+	.uleb128 0x4
+	.byte	0x75
+	.sleb128 96
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL621-.Ltext0
+	.uleb128 .LVL626-.Ltext0
+	.uleb128 0x4
+	.byte	0x73
+	.sleb128 96
+	.byte	0x9f
+	.byte	0
+.LVUS368:
+	.uleb128 .LVU3490
+	.uleb128 .LVU3508
+	.uleb128 .LVU3508
+	.uleb128 .LVU3555
+.LLST368:
+	.byte	0x4
+	.uleb128 .LVL618-.Ltext0
+	.uleb128 .LVL621-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL621-.Ltext0
+	.uleb128 .LVL626-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0
+.LVUS370:
+	.uleb128 .LVU3495
+	.uleb128 .LVU3520
+.LLST370:
+	.byte	0x4
+	.uleb128 .LVL619-.Ltext0
+	.uleb128 .LVL623-.Ltext0
+	.uleb128 0x3
+	.byte	0x8
+	.byte	0x40
+	.byte	0x9f
+	.byte	0
+.LVUS371:
+	.uleb128 .LVU3495
+	.uleb128 .LVU3512
+	.uleb128 .LVU3512
+	.uleb128 .LVU3520
+.LLST371:
+	.byte	0x4
+	.uleb128 .LVL619-.Ltext0
+	.uleb128 .LVL622-.Ltext0
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x4
+	.uleb128 .LVL622-.Ltext0
+	.uleb128 .LVL623-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x9f
+	.byte	0
+.LVUS372:
+	.uleb128 .LVU3495
+	.uleb128 .LVU3506
+	.uleb128 .LVU3506
+	.uleb128 .LVU3520
+.LLST372:
+	.byte	0x4
+	.uleb128 .LVL619-.Ltext0
+	.uleb128 .LVL620-.Ltext0
+	.uleb128 0x4
+	.byte	0x91
+	.sleb128 -80
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL620-.Ltext0
+	.uleb128 .LVL623-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0
+.LVUS373:
+	.uleb128 .LVU3497
+	.uleb128 .LVU3506
+	.uleb128 .LVU3506
+	.uleb128 .LVU3530
+	.uleb128 .LVU3530
+	.uleb128 0
+.LLST373:
+	.byte	0x4
+	.uleb128 .LVL619-.Ltext0
+	.uleb128 .LVL620-.Ltext0
+	.uleb128 0x4
+	.byte	0x91
+	.sleb128 -80
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL620-.Ltext0
+	.uleb128 .LVL624-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL624-1-.Ltext0
+	.uleb128 .LFE21-.Ltext0
+	.uleb128 0x4
+	.byte	0x91
+	.sleb128 -80
+	.byte	0x9f
+	.byte	0
+.LVUS374:
+	.uleb128 .LVU3498
+	.uleb128 .LVU3512
+	.uleb128 .LVU3512
+	.uleb128 0
+.LLST374:
+	.byte	0x4
+	.uleb128 .LVL619-.Ltext0
+	.uleb128 .LVL622-.Ltext0
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x4
+	.uleb128 .LVL622-.Ltext0
+	.uleb128 .LFE21-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x9f
+	.byte	0
+.LVUS375:
+	.uleb128 .LVU3499
+	.uleb128 .LVU3501
+.LLST375:
+	.byte	0x4
+	.uleb128 .LVL619-.Ltext0
+	.uleb128 .LVL619-.Ltext0
+	.uleb128 0x2
+	.byte	0x30
+	.byte	0x9f
+	.byte	0
+.LVUS377:
+	.uleb128 .LVU3532
+	.uleb128 .LVU3538
+	.uleb128 .LVU3538
+	.uleb128 .LVU3540
+	.uleb128 .LVU3540
+	.uleb128 .LVU3542
+	.uleb128 .LVU3542
+	.uleb128 .LVU3544
+	.uleb128 .LVU3544
+	.uleb128 .LVU3547
+	.uleb128 .LVU3547
+	.uleb128 .LVU3549
+	.uleb128 .LVU3549
+	.uleb128 .LVU3551
+	.uleb128 .LVU3551
+	.uleb128 .LVU3554
+	.uleb128 .LVU3554
+	.uleb128 .LVU3555
+.LLST377:
+	.byte	0x4
+	.uleb128 .LVL624-.Ltext0
+	.uleb128 .LVL625-.Ltext0
+	.uleb128 0x2
+	.byte	0x30
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL625-.Ltext0
+	.uleb128 .LVL625-.Ltext0
+	.uleb128 0x2
+	.byte	0x31
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL625-.Ltext0
+	.uleb128 .LVL625-.Ltext0
+	.uleb128 0x2
+	.byte	0x32
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL625-.Ltext0
+	.uleb128 .LVL625-.Ltext0
+	.uleb128 0x2
+	.byte	0x33
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL625-.Ltext0
+	.uleb128 .LVL625-.Ltext0
+	.uleb128 0x2
+	.byte	0x34
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL625-.Ltext0
+	.uleb128 .LVL625-.Ltext0
+	.uleb128 0x2
+	.byte	0x35
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL625-.Ltext0
+	.uleb128 .LVL625-.Ltext0
+	.uleb128 0x2
+	.byte	0x36
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL625-.Ltext0
+	.uleb128 .LVL626-.Ltext0
+	.uleb128 0x2
+	.byte	0x37
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL626-.Ltext0
+	.uleb128 .LVL626-.Ltext0
+	.uleb128 0x2
+	.byte	0x38
+	.byte	0x9f
+	.byte	0
+.LVUS0:
+	.uleb128 0
+	.uleb128 .LVU11
+	.uleb128 .LVU11
+	.uleb128 0
+.LLST0:
+	.byte	0x4
+	.uleb128 .LVL0-.Ltext0
+	.uleb128 .LVL2-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL2-.Ltext0
+	.uleb128 .LFE23-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0
+.LVUS1:
+	.uleb128 0
+	.uleb128 .LVU32
+	.uleb128 .LVU32
+	.uleb128 0
+.LLST1:
+	.byte	0x4
+	.uleb128 .LVL0-.Ltext0
+	.uleb128 .LVL7-.Ltext0
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x4
+	.uleb128 .LVL7-.Ltext0
+	.uleb128 .LFE23-.Ltext0
+	.uleb128 0x1
+	.byte	0x59
+	.byte	0
+.LVUS3:
+	.uleb128 .LVU8
+	.uleb128 .LVU11
+	.uleb128 .LVU11
+	.uleb128 .LVU14
+	.uleb128 .LVU14
+	.uleb128 .LVU17
+.LLST3:
+	.byte	0x4
+	.uleb128 .LVL1-.Ltext0
+	.uleb128 .LVL2-.Ltext0
+	.uleb128 0x8
+	.byte	0x75
+	.sleb128 48
+	.byte	0x94
+	.byte	0x4
+	.byte	0x78
+	.sleb128 0
+	.byte	0x27
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL2-.Ltext0
+	.uleb128 .LVL3-.Ltext0
+	.uleb128 0x6
+	.byte	0x75
+	.sleb128 0
+	.byte	0x78
+	.sleb128 0
+	.byte	0x27
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL3-.Ltext0
+	.uleb128 .LVL4-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0
+.LVUS4:
+	.uleb128 .LVU8
+	.uleb128 .LVU17
+.LLST4:
+	.byte	0x4
+	.uleb128 .LVL1-.Ltext0
+	.uleb128 .LVL4-.Ltext0
+	.uleb128 0x2
+	.byte	0x40
+	.byte	0x9f
+	.byte	0
+.LVUS5:
+	.uleb128 .LVU24
+	.uleb128 .LVU27
+.LLST5:
+	.byte	0x4
+	.uleb128 .LVL5-.Ltext0
+	.uleb128 .LVL6-.Ltext0
+	.uleb128 0x2
+	.byte	0x3c
+	.byte	0x9f
+	.byte	0
+.LVUS6:
+	.uleb128 .LVU35
+	.uleb128 .LVU38
+.LLST6:
+	.byte	0x4
+	.uleb128 .LVL8-.Ltext0
+	.uleb128 .LVL9-.Ltext0
+	.uleb128 0x2
+	.byte	0x38
+	.byte	0x9f
+	.byte	0
+.LVUS7:
+	.uleb128 .LVU46
+	.uleb128 .LVU48
+.LLST7:
+	.byte	0x4
+	.uleb128 .LVL10-.Ltext0
+	.uleb128 .LVL10-.Ltext0
+	.uleb128 0x2
+	.byte	0x37
+	.byte	0x9f
+	.byte	0
+.LVUS8:
+	.uleb128 .LVU57
+	.uleb128 .LVU60
+.LLST8:
+	.byte	0x4
+	.uleb128 .LVL11-.Ltext0
+	.uleb128 .LVL12-.Ltext0
+	.uleb128 0x1
+	.byte	0x52
+	.byte	0
+.LVUS9:
+	.uleb128 .LVU57
+	.uleb128 .LVU60
+.LLST9:
+	.byte	0x4
+	.uleb128 .LVL11-.Ltext0
+	.uleb128 .LVL12-.Ltext0
+	.uleb128 0x2
+	.byte	0x40
+	.byte	0x9f
+	.byte	0
+.LVUS10:
+	.uleb128 .LVU68
+	.uleb128 .LVU71
+.LLST10:
+	.byte	0x4
+	.uleb128 .LVL13-.Ltext0
+	.uleb128 .LVL14-.Ltext0
+	.uleb128 0x2
+	.byte	0x3c
+	.byte	0x9f
+	.byte	0
+.LVUS11:
+	.uleb128 .LVU78
+	.uleb128 .LVU81
+.LLST11:
+	.byte	0x4
+	.uleb128 .LVL15-.Ltext0
+	.uleb128 .LVL16-.Ltext0
+	.uleb128 0x2
+	.byte	0x38
+	.byte	0x9f
+	.byte	0
+.LVUS12:
+	.uleb128 .LVU91
+	.uleb128 .LVU94
+.LLST12:
+	.byte	0x4
+	.uleb128 .LVL17-.Ltext0
+	.uleb128 .LVL18-.Ltext0
+	.uleb128 0x2
+	.byte	0x37
+	.byte	0x9f
+	.byte	0
+.LVUS14:
+	.uleb128 .LVU107
+	.uleb128 .LVU110
+	.uleb128 .LVU110
+	.uleb128 .LVU111
+.LLST14:
+	.byte	0x4
+	.uleb128 .LVL19-.Ltext0
+	.uleb128 .LVL20-.Ltext0
+	.uleb128 0x6
+	.byte	0x7a
+	.sleb128 0
+	.byte	0x71
+	.sleb128 0
+	.byte	0x27
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL20-.Ltext0
+	.uleb128 .LVL21-.Ltext0
+	.uleb128 0x1
+	.byte	0x5a
+	.byte	0
+.LVUS15:
+	.uleb128 .LVU107
+	.uleb128 .LVU111
+.LLST15:
+	.byte	0x4
+	.uleb128 .LVL19-.Ltext0
+	.uleb128 .LVL21-.Ltext0
+	.uleb128 0x2
+	.byte	0x40
+	.byte	0x9f
+	.byte	0
+.LVUS17:
+	.uleb128 .LVU118
+	.uleb128 .LVU123
+.LLST17:
+	.byte	0x4
+	.uleb128 .LVL22-.Ltext0
+	.uleb128 .LVL23-.Ltext0
+	.uleb128 0x2
+	.byte	0x3c
+	.byte	0x9f
+	.byte	0
+.LVUS18:
+	.uleb128 .LVU132
+	.uleb128 .LVU134
+.LLST18:
+	.byte	0x4
+	.uleb128 .LVL24-.Ltext0
+	.uleb128 .LVL24-.Ltext0
+	.uleb128 0x2
+	.byte	0x38
+	.byte	0x9f
+	.byte	0
+.LVUS19:
+	.uleb128 .LVU141
+	.uleb128 .LVU144
+.LLST19:
+	.byte	0x4
+	.uleb128 .LVL25-.Ltext0
+	.uleb128 .LVL26-.Ltext0
+	.uleb128 0x2
+	.byte	0x37
+	.byte	0x9f
+	.byte	0
+.LVUS20:
+	.uleb128 .LVU155
+	.uleb128 .LVU158
+.LLST20:
+	.byte	0x4
+	.uleb128 .LVL27-.Ltext0
+	.uleb128 .LVL28-.Ltext0
+	.uleb128 0x1
+	.byte	0x5d
+	.byte	0
+.LVUS21:
+	.uleb128 .LVU155
+	.uleb128 .LVU158
+.LLST21:
+	.byte	0x4
+	.uleb128 .LVL27-.Ltext0
+	.uleb128 .LVL28-.Ltext0
+	.uleb128 0x2
+	.byte	0x40
+	.byte	0x9f
+	.byte	0
+.LVUS22:
+	.uleb128 .LVU165
+	.uleb128 .LVU168
+.LLST22:
+	.byte	0x4
+	.uleb128 .LVL29-.Ltext0
+	.uleb128 .LVL30-.Ltext0
+	.uleb128 0x2
+	.byte	0x3c
+	.byte	0x9f
+	.byte	0
+.LVUS23:
+	.uleb128 .LVU175
+	.uleb128 .LVU178
+.LLST23:
+	.byte	0x4
+	.uleb128 .LVL31-.Ltext0
+	.uleb128 .LVL32-.Ltext0
+	.uleb128 0x2
+	.byte	0x38
+	.byte	0x9f
+	.byte	0
+.LVUS24:
+	.uleb128 .LVU185
+	.uleb128 .LVU188
+.LLST24:
+	.byte	0x4
+	.uleb128 .LVL33-.Ltext0
+	.uleb128 .LVL34-.Ltext0
+	.uleb128 0x2
+	.byte	0x37
+	.byte	0x9f
+	.byte	0
+.LVUS25:
+	.uleb128 .LVU197
+	.uleb128 .LVU200
+.LLST25:
+	.byte	0x4
+	.uleb128 .LVL35-.Ltext0
+	.uleb128 .LVL36-.Ltext0
+	.uleb128 0x2
+	.byte	0x40
+	.byte	0x9f
+	.byte	0
+.LVUS26:
+	.uleb128 .LVU207
+	.uleb128 .LVU210
+.LLST26:
+	.byte	0x4
+	.uleb128 .LVL37-.Ltext0
+	.uleb128 .LVL38-.Ltext0
+	.uleb128 0x2
+	.byte	0x3c
+	.byte	0x9f
+	.byte	0
+.LVUS27:
+	.uleb128 .LVU217
+	.uleb128 .LVU219
+.LLST27:
+	.byte	0x4
+	.uleb128 .LVL39-.Ltext0
+	.uleb128 .LVL39-.Ltext0
+	.uleb128 0x2
+	.byte	0x38
+	.byte	0x9f
+	.byte	0
+.LVUS28:
+	.uleb128 .LVU226
+	.uleb128 .LVU229
+.LLST28:
+	.byte	0x4
+	.uleb128 .LVL40-.Ltext0
+	.uleb128 .LVL41-.Ltext0
+	.uleb128 0x2
+	.byte	0x37
+	.byte	0x9f
+	.byte	0
+.LVUS29:
+	.uleb128 .LVU240
+	.uleb128 .LVU243
+.LLST29:
+	.byte	0x4
+	.uleb128 .LVL42-.Ltext0
+	.uleb128 .LVL43-.Ltext0
+	.uleb128 0x2
+	.byte	0x40
+	.byte	0x9f
+	.byte	0
+.LVUS30:
+	.uleb128 .LVU250
+	.uleb128 .LVU253
+.LLST30:
+	.byte	0x4
+	.uleb128 .LVL44-.Ltext0
+	.uleb128 .LVL45-.Ltext0
+	.uleb128 0x2
+	.byte	0x3c
+	.byte	0x9f
+	.byte	0
+.LVUS31:
+	.uleb128 .LVU260
+	.uleb128 .LVU263
+.LLST31:
+	.byte	0x4
+	.uleb128 .LVL46-.Ltext0
+	.uleb128 .LVL47-.Ltext0
+	.uleb128 0x2
+	.byte	0x38
+	.byte	0x9f
+	.byte	0
+.LVUS32:
+	.uleb128 .LVU270
+	.uleb128 .LVU273
+.LLST32:
+	.byte	0x4
+	.uleb128 .LVL48-.Ltext0
+	.uleb128 .LVL49-.Ltext0
+	.uleb128 0x2
+	.byte	0x37
+	.byte	0x9f
+	.byte	0
+.LVUS33:
+	.uleb128 .LVU283
+	.uleb128 .LVU286
+.LLST33:
+	.byte	0x4
+	.uleb128 .LVL50-.Ltext0
+	.uleb128 .LVL51-.Ltext0
+	.uleb128 0x2
+	.byte	0x40
+	.byte	0x9f
+	.byte	0
+.LVUS34:
+	.uleb128 .LVU293
+	.uleb128 .LVU296
+.LLST34:
+	.byte	0x4
+	.uleb128 .LVL52-.Ltext0
+	.uleb128 .LVL53-.Ltext0
+	.uleb128 0x2
+	.byte	0x3c
+	.byte	0x9f
+	.byte	0
+.LVUS35:
+	.uleb128 .LVU303
+	.uleb128 .LVU306
+.LLST35:
+	.byte	0x4
+	.uleb128 .LVL54-.Ltext0
+	.uleb128 .LVL55-.Ltext0
+	.uleb128 0x2
+	.byte	0x38
+	.byte	0x9f
+	.byte	0
+.LVUS36:
+	.uleb128 .LVU313
+	.uleb128 .LVU316
+.LLST36:
+	.byte	0x4
+	.uleb128 .LVL56-.Ltext0
+	.uleb128 .LVL57-.Ltext0
+	.uleb128 0x2
+	.byte	0x37
+	.byte	0x9f
+	.byte	0
+.LVUS37:
+	.uleb128 .LVU328
+	.uleb128 .LVU331
+.LLST37:
+	.byte	0x4
+	.uleb128 .LVL58-.Ltext0
+	.uleb128 .LVL59-.Ltext0
+	.uleb128 0x1
+	.byte	0x5d
+	.byte	0
+.LVUS38:
+	.uleb128 .LVU328
+	.uleb128 .LVU331
+.LLST38:
+	.byte	0x4
+	.uleb128 .LVL58-.Ltext0
+	.uleb128 .LVL59-.Ltext0
+	.uleb128 0x2
+	.byte	0x40
+	.byte	0x9f
+	.byte	0
+.LVUS39:
+	.uleb128 .LVU338
+	.uleb128 .LVU341
+.LLST39:
+	.byte	0x4
+	.uleb128 .LVL60-.Ltext0
+	.uleb128 .LVL61-.Ltext0
+	.uleb128 0x2
+	.byte	0x3c
+	.byte	0x9f
+	.byte	0
+.LVUS40:
+	.uleb128 .LVU348
+	.uleb128 .LVU351
+.LLST40:
+	.byte	0x4
+	.uleb128 .LVL62-.Ltext0
+	.uleb128 .LVL63-.Ltext0
+	.uleb128 0x2
+	.byte	0x38
+	.byte	0x9f
+	.byte	0
+.LVUS41:
+	.uleb128 .LVU358
+	.uleb128 .LVU361
+.LLST41:
+	.byte	0x4
+	.uleb128 .LVL64-.Ltext0
+	.uleb128 .LVL65-.Ltext0
+	.uleb128 0x2
+	.byte	0x37
+	.byte	0x9f
+	.byte	0
+.LVUS42:
+	.uleb128 .LVU372
+	.uleb128 .LVU375
+.LLST42:
+	.byte	0x4
+	.uleb128 .LVL66-.Ltext0
+	.uleb128 .LVL67-.Ltext0
+	.uleb128 0x2
+	.byte	0x40
+	.byte	0x9f
+	.byte	0
+.LVUS43:
+	.uleb128 .LVU382
+	.uleb128 .LVU385
+.LLST43:
+	.byte	0x4
+	.uleb128 .LVL68-.Ltext0
+	.uleb128 .LVL69-.Ltext0
+	.uleb128 0x2
+	.byte	0x3c
+	.byte	0x9f
+	.byte	0
+.LVUS44:
+	.uleb128 .LVU392
+	.uleb128 .LVU395
+.LLST44:
+	.byte	0x4
+	.uleb128 .LVL70-.Ltext0
+	.uleb128 .LVL71-.Ltext0
+	.uleb128 0x2
+	.byte	0x38
+	.byte	0x9f
+	.byte	0
+.LVUS45:
+	.uleb128 .LVU402
+	.uleb128 .LVU404
+.LLST45:
+	.byte	0x4
+	.uleb128 .LVL72-.Ltext0
+	.uleb128 .LVL72-.Ltext0
+	.uleb128 0x2
+	.byte	0x37
+	.byte	0x9f
+	.byte	0
+.LVUS46:
+	.uleb128 .LVU415
+	.uleb128 .LVU418
+.LLST46:
+	.byte	0x4
+	.uleb128 .LVL73-.Ltext0
+	.uleb128 .LVL74-.Ltext0
+	.uleb128 0x2
+	.byte	0x40
+	.byte	0x9f
+	.byte	0
+.LVUS47:
+	.uleb128 .LVU425
+	.uleb128 .LVU428
+.LLST47:
+	.byte	0x4
+	.uleb128 .LVL75-.Ltext0
+	.uleb128 .LVL76-.Ltext0
+	.uleb128 0x2
+	.byte	0x3c
+	.byte	0x9f
+	.byte	0
+.LVUS48:
+	.uleb128 .LVU435
+	.uleb128 .LVU438
+.LLST48:
+	.byte	0x4
+	.uleb128 .LVL77-.Ltext0
+	.uleb128 .LVL78-.Ltext0
+	.uleb128 0x2
+	.byte	0x38
+	.byte	0x9f
+	.byte	0
+.LVUS50:
+	.uleb128 .LVU446
+	.uleb128 .LVU450
+.LLST50:
+	.byte	0x4
+	.uleb128 .LVL79-.Ltext0
+	.uleb128 .LVL80-.Ltext0
+	.uleb128 0x2
+	.byte	0x37
+	.byte	0x9f
+	.byte	0
+.LVUS51:
+	.uleb128 .LVU461
+	.uleb128 .LVU464
+.LLST51:
+	.byte	0x4
+	.uleb128 .LVL81-.Ltext0
+	.uleb128 .LVL82-.Ltext0
+	.uleb128 0x2
+	.byte	0x40
+	.byte	0x9f
+	.byte	0
+.LVUS52:
+	.uleb128 .LVU471
+	.uleb128 .LVU474
+.LLST52:
+	.byte	0x4
+	.uleb128 .LVL83-.Ltext0
+	.uleb128 .LVL84-.Ltext0
+	.uleb128 0x2
+	.byte	0x3c
+	.byte	0x9f
+	.byte	0
+.LVUS53:
+	.uleb128 .LVU481
+	.uleb128 .LVU484
+.LLST53:
+	.byte	0x4
+	.uleb128 .LVL85-.Ltext0
+	.uleb128 .LVL86-.Ltext0
+	.uleb128 0x2
+	.byte	0x38
+	.byte	0x9f
+	.byte	0
+.LVUS54:
+	.uleb128 .LVU491
+	.uleb128 .LVU494
+.LLST54:
+	.byte	0x4
+	.uleb128 .LVL87-.Ltext0
+	.uleb128 .LVL88-.Ltext0
+	.uleb128 0x2
+	.byte	0x37
+	.byte	0x9f
+	.byte	0
+.LVUS55:
+	.uleb128 .LVU503
+	.uleb128 .LVU506
+.LLST55:
+	.byte	0x4
+	.uleb128 .LVL89-.Ltext0
+	.uleb128 .LVL90-.Ltext0
+	.uleb128 0x1
+	.byte	0x5c
+	.byte	0
+.LVUS56:
+	.uleb128 .LVU503
+	.uleb128 .LVU506
+.LLST56:
+	.byte	0x4
+	.uleb128 .LVL89-.Ltext0
+	.uleb128 .LVL90-.Ltext0
+	.uleb128 0x2
+	.byte	0x40
+	.byte	0x9f
+	.byte	0
+.LVUS57:
+	.uleb128 .LVU513
+	.uleb128 .LVU516
+.LLST57:
+	.byte	0x4
+	.uleb128 .LVL91-.Ltext0
+	.uleb128 .LVL92-.Ltext0
+	.uleb128 0x2
+	.byte	0x3c
+	.byte	0x9f
+	.byte	0
+.LVUS58:
+	.uleb128 .LVU523
+	.uleb128 .LVU526
+.LLST58:
+	.byte	0x4
+	.uleb128 .LVL93-.Ltext0
+	.uleb128 .LVL94-.Ltext0
+	.uleb128 0x2
+	.byte	0x38
+	.byte	0x9f
+	.byte	0
+.LVUS59:
+	.uleb128 .LVU533
+	.uleb128 .LVU536
+.LLST59:
+	.byte	0x4
+	.uleb128 .LVL95-.Ltext0
+	.uleb128 .LVL96-.Ltext0
+	.uleb128 0x2
+	.byte	0x37
+	.byte	0x9f
+	.byte	0
+.LVUS60:
+	.uleb128 .LVU545
+	.uleb128 .LVU548
+.LLST60:
+	.byte	0x4
+	.uleb128 .LVL97-.Ltext0
+	.uleb128 .LVL98-.Ltext0
+	.uleb128 0x2
+	.byte	0x40
+	.byte	0x9f
+	.byte	0
+.LVUS61:
+	.uleb128 .LVU555
+	.uleb128 .LVU558
+.LLST61:
+	.byte	0x4
+	.uleb128 .LVL99-.Ltext0
+	.uleb128 .LVL100-.Ltext0
+	.uleb128 0x2
+	.byte	0x3c
+	.byte	0x9f
+	.byte	0
+.LVUS62:
+	.uleb128 .LVU565
+	.uleb128 .LVU567
+.LLST62:
+	.byte	0x4
+	.uleb128 .LVL101-.Ltext0
+	.uleb128 .LVL101-.Ltext0
+	.uleb128 0x2
+	.byte	0x38
+	.byte	0x9f
+	.byte	0
+.LVUS63:
+	.uleb128 .LVU574
+	.uleb128 .LVU577
+.LLST63:
+	.byte	0x4
+	.uleb128 .LVL102-.Ltext0
+	.uleb128 .LVL103-.Ltext0
+	.uleb128 0x2
+	.byte	0x37
+	.byte	0x9f
+	.byte	0
+.LVUS64:
+	.uleb128 .LVU589
+	.uleb128 .LVU592
+.LLST64:
+	.byte	0x4
+	.uleb128 .LVL104-.Ltext0
+	.uleb128 .LVL105-.Ltext0
+	.uleb128 0x2
+	.byte	0x40
+	.byte	0x9f
+	.byte	0
+.LVUS65:
+	.uleb128 .LVU599
+	.uleb128 .LVU602
+.LLST65:
+	.byte	0x4
+	.uleb128 .LVL106-.Ltext0
+	.uleb128 .LVL107-.Ltext0
+	.uleb128 0x2
+	.byte	0x3c
+	.byte	0x9f
+	.byte	0
+.LVUS66:
+	.uleb128 .LVU609
+	.uleb128 .LVU612
+.LLST66:
+	.byte	0x4
+	.uleb128 .LVL108-.Ltext0
+	.uleb128 .LVL109-.Ltext0
+	.uleb128 0x2
+	.byte	0x38
+	.byte	0x9f
+	.byte	0
+.LVUS67:
+	.uleb128 .LVU619
+	.uleb128 .LVU622
+.LLST67:
+	.byte	0x4
+	.uleb128 .LVL110-.Ltext0
+	.uleb128 .LVL111-.Ltext0
+	.uleb128 0x2
+	.byte	0x37
+	.byte	0x9f
+	.byte	0
+.LVUS68:
+	.uleb128 .LVU633
+	.uleb128 .LVU636
+.LLST68:
+	.byte	0x4
+	.uleb128 .LVL112-.Ltext0
+	.uleb128 .LVL113-.Ltext0
+	.uleb128 0x2
+	.byte	0x40
+	.byte	0x9f
+	.byte	0
+.LVUS69:
+	.uleb128 .LVU644
+	.uleb128 .LVU647
+.LLST69:
+	.byte	0x4
+	.uleb128 .LVL114-.Ltext0
+	.uleb128 .LVL115-.Ltext0
+	.uleb128 0x2
+	.byte	0x3c
+	.byte	0x9f
+	.byte	0
+.LVUS70:
+	.uleb128 .LVU654
+	.uleb128 .LVU657
+.LLST70:
+	.byte	0x4
+	.uleb128 .LVL116-.Ltext0
+	.uleb128 .LVL117-.Ltext0
+	.uleb128 0x2
+	.byte	0x38
+	.byte	0x9f
+	.byte	0
+.LVUS71:
+	.uleb128 .LVU664
+	.uleb128 .LVU667
+.LLST71:
+	.byte	0x4
+	.uleb128 .LVL118-.Ltext0
+	.uleb128 .LVL119-.Ltext0
+	.uleb128 0x2
+	.byte	0x37
+	.byte	0x9f
+	.byte	0
+.LVUS72:
+	.uleb128 .LVU676
+	.uleb128 .LVU679
+.LLST72:
+	.byte	0x4
+	.uleb128 .LVL120-.Ltext0
+	.uleb128 .LVL121-.Ltext0
+	.uleb128 0x2
+	.byte	0x40
+	.byte	0x9f
+	.byte	0
+.LVUS73:
+	.uleb128 .LVU686
+	.uleb128 .LVU689
+.LLST73:
+	.byte	0x4
+	.uleb128 .LVL122-.Ltext0
+	.uleb128 .LVL123-.Ltext0
+	.uleb128 0x2
+	.byte	0x3c
+	.byte	0x9f
+	.byte	0
+.LVUS74:
+	.uleb128 .LVU696
+	.uleb128 .LVU699
+.LLST74:
+	.byte	0x4
+	.uleb128 .LVL124-.Ltext0
+	.uleb128 .LVL125-.Ltext0
+	.uleb128 0x2
+	.byte	0x38
+	.byte	0x9f
+	.byte	0
+.LVUS75:
+	.uleb128 .LVU706
+	.uleb128 .LVU709
+.LLST75:
+	.byte	0x4
+	.uleb128 .LVL126-.Ltext0
+	.uleb128 .LVL127-.Ltext0
+	.uleb128 0x2
+	.byte	0x37
+	.byte	0x9f
+	.byte	0
+.LVUS76:
+	.uleb128 .LVU720
+	.uleb128 .LVU723
+.LLST76:
+	.byte	0x4
+	.uleb128 .LVL128-.Ltext0
+	.uleb128 .LVL129-.Ltext0
+	.uleb128 0x2
+	.byte	0x40
+	.byte	0x9f
+	.byte	0
+.LVUS77:
+	.uleb128 .LVU730
+	.uleb128 .LVU733
+.LLST77:
+	.byte	0x4
+	.uleb128 .LVL130-.Ltext0
+	.uleb128 .LVL131-.Ltext0
+	.uleb128 0x2
+	.byte	0x3c
+	.byte	0x9f
+	.byte	0
+.LVUS78:
+	.uleb128 .LVU740
+	.uleb128 .LVU743
+.LLST78:
+	.byte	0x4
+	.uleb128 .LVL132-.Ltext0
+	.uleb128 .LVL133-.Ltext0
+	.uleb128 0x2
+	.byte	0x38
+	.byte	0x9f
+	.byte	0
+.LVUS79:
+	.uleb128 .LVU750
+	.uleb128 .LVU752
+.LLST79:
+	.byte	0x4
+	.uleb128 .LVL134-.Ltext0
+	.uleb128 .LVL134-.Ltext0
+	.uleb128 0x2
+	.byte	0x37
+	.byte	0x9f
+	.byte	0
+.LVUS80:
+	.uleb128 .LVU763
+	.uleb128 .LVU766
+.LLST80:
+	.byte	0x4
+	.uleb128 .LVL135-.Ltext0
+	.uleb128 .LVL136-.Ltext0
+	.uleb128 0x2
+	.byte	0x40
+	.byte	0x9f
+	.byte	0
+.LVUS81:
+	.uleb128 .LVU773
+	.uleb128 .LVU776
+.LLST81:
+	.byte	0x4
+	.uleb128 .LVL137-.Ltext0
+	.uleb128 .LVL138-.Ltext0
+	.uleb128 0x2
+	.byte	0x3c
+	.byte	0x9f
+	.byte	0
+.LVUS82:
+	.uleb128 .LVU783
+	.uleb128 .LVU786
+.LLST82:
+	.byte	0x4
+	.uleb128 .LVL139-.Ltext0
+	.uleb128 .LVL140-.Ltext0
+	.uleb128 0x2
+	.byte	0x38
+	.byte	0x9f
+	.byte	0
+.LVUS83:
+	.uleb128 .LVU793
+	.uleb128 .LVU796
+.LLST83:
+	.byte	0x4
+	.uleb128 .LVL141-.Ltext0
+	.uleb128 .LVL142-.Ltext0
+	.uleb128 0x2
+	.byte	0x37
+	.byte	0x9f
+	.byte	0
+.LVUS84:
+	.uleb128 .LVU806
+	.uleb128 .LVU809
+.LLST84:
+	.byte	0x4
+	.uleb128 .LVL143-.Ltext0
+	.uleb128 .LVL144-.Ltext0
+	.uleb128 0x2
+	.byte	0x40
+	.byte	0x9f
+	.byte	0
+.LVUS85:
+	.uleb128 .LVU819
+	.uleb128 .LVU822
+.LLST85:
+	.byte	0x4
+	.uleb128 .LVL145-.Ltext0
+	.uleb128 .LVL146-.Ltext0
+	.uleb128 0x2
+	.byte	0x3c
+	.byte	0x9f
+	.byte	0
+.LVUS86:
+	.uleb128 .LVU829
+	.uleb128 .LVU832
+.LLST86:
+	.byte	0x4
+	.uleb128 .LVL147-.Ltext0
+	.uleb128 .LVL148-.Ltext0
+	.uleb128 0x2
+	.byte	0x38
+	.byte	0x9f
+	.byte	0
+.LVUS87:
+	.uleb128 .LVU839
+	.uleb128 .LVU842
+.LLST87:
+	.byte	0x4
+	.uleb128 .LVL149-.Ltext0
+	.uleb128 .LVL150-.Ltext0
+	.uleb128 0x2
+	.byte	0x37
+	.byte	0x9f
+	.byte	0
+.LVUS88:
+	.uleb128 .LVU851
+	.uleb128 .LVU854
+.LLST88:
+	.byte	0x4
+	.uleb128 .LVL151-.Ltext0
+	.uleb128 .LVL152-.Ltext0
+	.uleb128 0x1
+	.byte	0x5c
+	.byte	0
+.LVUS89:
+	.uleb128 .LVU851
+	.uleb128 .LVU854
+.LLST89:
+	.byte	0x4
+	.uleb128 .LVL151-.Ltext0
+	.uleb128 .LVL152-.Ltext0
+	.uleb128 0x2
+	.byte	0x40
+	.byte	0x9f
+	.byte	0
+.LVUS90:
+	.uleb128 .LVU861
+	.uleb128 .LVU864
+.LLST90:
+	.byte	0x4
+	.uleb128 .LVL153-.Ltext0
+	.uleb128 .LVL154-.Ltext0
+	.uleb128 0x2
+	.byte	0x3c
+	.byte	0x9f
+	.byte	0
+.LVUS91:
+	.uleb128 .LVU871
+	.uleb128 .LVU874
+.LLST91:
+	.byte	0x4
+	.uleb128 .LVL155-.Ltext0
+	.uleb128 .LVL156-.Ltext0
+	.uleb128 0x2
+	.byte	0x38
+	.byte	0x9f
+	.byte	0
+.LVUS92:
+	.uleb128 .LVU881
+	.uleb128 .LVU884
+.LLST92:
+	.byte	0x4
+	.uleb128 .LVL157-.Ltext0
+	.uleb128 .LVL158-.Ltext0
+	.uleb128 0x2
+	.byte	0x37
+	.byte	0x9f
+	.byte	0
+.LVUS93:
+	.uleb128 .LVU893
+	.uleb128 .LVU896
+.LLST93:
+	.byte	0x4
+	.uleb128 .LVL159-.Ltext0
+	.uleb128 .LVL160-.Ltext0
+	.uleb128 0x2
+	.byte	0x40
+	.byte	0x9f
+	.byte	0
+.LVUS94:
+	.uleb128 .LVU903
+	.uleb128 .LVU906
+.LLST94:
+	.byte	0x4
+	.uleb128 .LVL161-.Ltext0
+	.uleb128 .LVL162-.Ltext0
+	.uleb128 0x2
+	.byte	0x3c
+	.byte	0x9f
+	.byte	0
+.LVUS95:
+	.uleb128 .LVU913
+	.uleb128 .LVU915
+.LLST95:
+	.byte	0x4
+	.uleb128 .LVL163-.Ltext0
+	.uleb128 .LVL163-.Ltext0
+	.uleb128 0x2
+	.byte	0x38
+	.byte	0x9f
+	.byte	0
+.LVUS97:
+	.uleb128 .LVU923
+	.uleb128 .LVU925
+.LLST97:
+	.byte	0x4
+	.uleb128 .LVL164-.Ltext0
+	.uleb128 .LVL164-.Ltext0
+	.uleb128 0x2
+	.byte	0x37
+	.byte	0x9f
+	.byte	0
+.LVUS98:
+	.uleb128 .LVU935
+	.uleb128 .LVU938
+.LLST98:
+	.byte	0x4
+	.uleb128 .LVL165-.Ltext0
+	.uleb128 .LVL166-.Ltext0
+	.uleb128 0x2
+	.byte	0x40
+	.byte	0x9f
+	.byte	0
+.LVUS99:
+	.uleb128 .LVU945
+	.uleb128 .LVU948
+.LLST99:
+	.byte	0x4
+	.uleb128 .LVL167-.Ltext0
+	.uleb128 .LVL168-.Ltext0
+	.uleb128 0x2
+	.byte	0x3c
+	.byte	0x9f
+	.byte	0
+.LVUS100:
+	.uleb128 .LVU955
+	.uleb128 .LVU958
+.LLST100:
+	.byte	0x4
+	.uleb128 .LVL169-.Ltext0
+	.uleb128 .LVL170-.Ltext0
+	.uleb128 0x2
+	.byte	0x38
+	.byte	0x9f
+	.byte	0
+.LVUS101:
+	.uleb128 .LVU965
+	.uleb128 .LVU968
+.LLST101:
+	.byte	0x4
+	.uleb128 .LVL171-.Ltext0
+	.uleb128 .LVL172-.Ltext0
+	.uleb128 0x2
+	.byte	0x37
+	.byte	0x9f
+	.byte	0
+.LVUS102:
+	.uleb128 .LVU979
+	.uleb128 .LVU982
+.LLST102:
+	.byte	0x4
+	.uleb128 .LVL173-.Ltext0
+	.uleb128 .LVL174-.Ltext0
+	.uleb128 0x2
+	.byte	0x40
+	.byte	0x9f
+	.byte	0
+.LVUS103:
+	.uleb128 .LVU990
+	.uleb128 .LVU993
+.LLST103:
+	.byte	0x4
+	.uleb128 .LVL175-.Ltext0
+	.uleb128 .LVL176-.Ltext0
+	.uleb128 0x2
+	.byte	0x3c
+	.byte	0x9f
+	.byte	0
+.LVUS104:
+	.uleb128 .LVU1000
+	.uleb128 .LVU1003
+.LLST104:
+	.byte	0x4
+	.uleb128 .LVL177-.Ltext0
+	.uleb128 .LVL178-.Ltext0
+	.uleb128 0x2
+	.byte	0x38
+	.byte	0x9f
+	.byte	0
+.LVUS105:
+	.uleb128 .LVU1010
+	.uleb128 .LVU1013
+.LLST105:
+	.byte	0x4
+	.uleb128 .LVL179-.Ltext0
+	.uleb128 .LVL180-.Ltext0
+	.uleb128 0x2
+	.byte	0x37
+	.byte	0x9f
+	.byte	0
+.LVUS106:
+	.uleb128 .LVU1022
+	.uleb128 .LVU1025
+.LLST106:
+	.byte	0x4
+	.uleb128 .LVL181-.Ltext0
+	.uleb128 .LVL182-.Ltext0
+	.uleb128 0x2
+	.byte	0x40
+	.byte	0x9f
+	.byte	0
+.LVUS107:
+	.uleb128 .LVU1032
+	.uleb128 .LVU1035
+.LLST107:
+	.byte	0x4
+	.uleb128 .LVL183-.Ltext0
+	.uleb128 .LVL184-.Ltext0
+	.uleb128 0x2
+	.byte	0x3c
+	.byte	0x9f
+	.byte	0
+.LVUS108:
+	.uleb128 .LVU1042
+	.uleb128 .LVU1045
+.LLST108:
+	.byte	0x4
+	.uleb128 .LVL185-.Ltext0
+	.uleb128 .LVL186-.Ltext0
+	.uleb128 0x2
+	.byte	0x38
+	.byte	0x9f
+	.byte	0
+.LVUS109:
+	.uleb128 .LVU1052
+	.uleb128 .LVU1055
+.LLST109:
+	.byte	0x4
+	.uleb128 .LVL187-.Ltext0
+	.uleb128 .LVL188-.Ltext0
+	.uleb128 0x2
+	.byte	0x37
+	.byte	0x9f
+	.byte	0
+.LVUS110:
+	.uleb128 .LVU1066
+	.uleb128 .LVU1069
+.LLST110:
+	.byte	0x4
+	.uleb128 .LVL189-.Ltext0
+	.uleb128 .LVL190-.Ltext0
+	.uleb128 0x2
+	.byte	0x40
+	.byte	0x9f
+	.byte	0
+.LVUS111:
+	.uleb128 .LVU1076
+	.uleb128 .LVU1079
+.LLST111:
+	.byte	0x4
+	.uleb128 .LVL191-.Ltext0
+	.uleb128 .LVL192-.Ltext0
+	.uleb128 0x2
+	.byte	0x3c
+	.byte	0x9f
+	.byte	0
+.LVUS112:
+	.uleb128 .LVU1086
+	.uleb128 .LVU1089
+.LLST112:
+	.byte	0x4
+	.uleb128 .LVL193-.Ltext0
+	.uleb128 .LVL194-.Ltext0
+	.uleb128 0x2
+	.byte	0x38
+	.byte	0x9f
+	.byte	0
+.LVUS113:
+	.uleb128 .LVU1096
+	.uleb128 .LVU1098
+.LLST113:
+	.byte	0x4
+	.uleb128 .LVL195-.Ltext0
+	.uleb128 .LVL195-.Ltext0
+	.uleb128 0x2
+	.byte	0x37
+	.byte	0x9f
+	.byte	0
+.LVUS114:
+	.uleb128 .LVU1109
+	.uleb128 .LVU1112
+.LLST114:
+	.byte	0x4
+	.uleb128 .LVL196-.Ltext0
+	.uleb128 .LVL197-.Ltext0
+	.uleb128 0x2
+	.byte	0x40
+	.byte	0x9f
+	.byte	0
+.LVUS115:
+	.uleb128 .LVU1119
+	.uleb128 .LVU1122
+.LLST115:
+	.byte	0x4
+	.uleb128 .LVL198-.Ltext0
+	.uleb128 .LVL199-.Ltext0
+	.uleb128 0x2
+	.byte	0x3c
+	.byte	0x9f
+	.byte	0
+.LVUS116:
+	.uleb128 .LVU1129
+	.uleb128 .LVU1132
+.LLST116:
+	.byte	0x4
+	.uleb128 .LVL200-.Ltext0
+	.uleb128 .LVL201-.Ltext0
+	.uleb128 0x2
+	.byte	0x38
+	.byte	0x9f
+	.byte	0
+.LVUS117:
+	.uleb128 .LVU1139
+	.uleb128 .LVU1142
+.LLST117:
+	.byte	0x4
+	.uleb128 .LVL202-.Ltext0
+	.uleb128 .LVL203-.Ltext0
+	.uleb128 0x2
+	.byte	0x37
+	.byte	0x9f
+	.byte	0
+.LVUS118:
+	.uleb128 .LVU1153
+	.uleb128 .LVU1156
+.LLST118:
+	.byte	0x4
+	.uleb128 .LVL204-.Ltext0
+	.uleb128 .LVL205-.Ltext0
+	.uleb128 0x2
+	.byte	0x40
+	.byte	0x9f
+	.byte	0
+.LVUS119:
+	.uleb128 .LVU1163
+	.uleb128 .LVU1166
+.LLST119:
+	.byte	0x4
+	.uleb128 .LVL206-.Ltext0
+	.uleb128 .LVL207-.Ltext0
+	.uleb128 0x2
+	.byte	0x3c
+	.byte	0x9f
+	.byte	0
+.LVUS120:
+	.uleb128 .LVU1173
+	.uleb128 .LVU1176
+.LLST120:
+	.byte	0x4
+	.uleb128 .LVL208-.Ltext0
+	.uleb128 .LVL209-.Ltext0
+	.uleb128 0x2
+	.byte	0x38
+	.byte	0x9f
+	.byte	0
+.LVUS122:
+	.uleb128 .LVU1184
+	.uleb128 .LVU1188
+.LLST122:
+	.byte	0x4
+	.uleb128 .LVL210-.Ltext0
+	.uleb128 .LVL211-.Ltext0
+	.uleb128 0x2
+	.byte	0x37
+	.byte	0x9f
+	.byte	0
+.LVUS123:
+	.uleb128 .LVU1197
+	.uleb128 .LVU1200
+.LLST123:
+	.byte	0x4
+	.uleb128 .LVL212-.Ltext0
+	.uleb128 .LVL213-.Ltext0
+	.uleb128 0x1
+	.byte	0x5c
+	.byte	0
+.LVUS124:
+	.uleb128 .LVU1197
+	.uleb128 .LVU1200
+.LLST124:
+	.byte	0x4
+	.uleb128 .LVL212-.Ltext0
+	.uleb128 .LVL213-.Ltext0
+	.uleb128 0x2
+	.byte	0x40
+	.byte	0x9f
+	.byte	0
+.LVUS125:
+	.uleb128 .LVU1207
+	.uleb128 .LVU1210
+.LLST125:
+	.byte	0x4
+	.uleb128 .LVL214-.Ltext0
+	.uleb128 .LVL215-.Ltext0
+	.uleb128 0x2
+	.byte	0x3c
+	.byte	0x9f
+	.byte	0
+.LVUS126:
+	.uleb128 .LVU1217
+	.uleb128 .LVU1220
+.LLST126:
+	.byte	0x4
+	.uleb128 .LVL216-.Ltext0
+	.uleb128 .LVL217-.Ltext0
+	.uleb128 0x2
+	.byte	0x38
+	.byte	0x9f
+	.byte	0
+.LVUS127:
+	.uleb128 .LVU1227
+	.uleb128 .LVU1230
+.LLST127:
+	.byte	0x4
+	.uleb128 .LVL218-.Ltext0
+	.uleb128 .LVL219-.Ltext0
+	.uleb128 0x2
+	.byte	0x37
+	.byte	0x9f
+	.byte	0
+.LVUS128:
+	.uleb128 .LVU1239
+	.uleb128 .LVU1242
+.LLST128:
+	.byte	0x4
+	.uleb128 .LVL220-.Ltext0
+	.uleb128 .LVL221-.Ltext0
+	.uleb128 0x2
+	.byte	0x40
+	.byte	0x9f
+	.byte	0
+.LVUS129:
+	.uleb128 .LVU1249
+	.uleb128 .LVU1252
+.LLST129:
+	.byte	0x4
+	.uleb128 .LVL222-.Ltext0
+	.uleb128 .LVL223-.Ltext0
+	.uleb128 0x2
+	.byte	0x3c
+	.byte	0x9f
+	.byte	0
+.LVUS130:
+	.uleb128 .LVU1259
+	.uleb128 .LVU1261
+.LLST130:
+	.byte	0x4
+	.uleb128 .LVL224-.Ltext0
+	.uleb128 .LVL224-.Ltext0
+	.uleb128 0x2
+	.byte	0x38
+	.byte	0x9f
+	.byte	0
+.LVUS131:
+	.uleb128 .LVU1268
+	.uleb128 .LVU1271
+.LLST131:
+	.byte	0x4
+	.uleb128 .LVL225-.Ltext0
+	.uleb128 .LVL226-.Ltext0
+	.uleb128 0x2
+	.byte	0x37
+	.byte	0x9f
+	.byte	0
+.LVUS132:
+	.uleb128 .LVU1282
+	.uleb128 .LVU1285
+.LLST132:
+	.byte	0x4
+	.uleb128 .LVL227-.Ltext0
+	.uleb128 .LVL228-.Ltext0
+	.uleb128 0x2
+	.byte	0x40
+	.byte	0x9f
+	.byte	0
+.LVUS133:
+	.uleb128 .LVU1292
+	.uleb128 .LVU1295
+.LLST133:
+	.byte	0x4
+	.uleb128 .LVL229-.Ltext0
+	.uleb128 .LVL230-.Ltext0
+	.uleb128 0x2
+	.byte	0x3c
+	.byte	0x9f
+	.byte	0
+.LVUS135:
+	.uleb128 .LVU1302
+	.uleb128 .LVU1306
+.LLST135:
+	.byte	0x4
+	.uleb128 .LVL231-.Ltext0
+	.uleb128 .LVL232-.Ltext0
+	.uleb128 0x2
+	.byte	0x38
+	.byte	0x9f
+	.byte	0
+.LVUS136:
+	.uleb128 .LVU1313
+	.uleb128 .LVU1316
+.LLST136:
+	.byte	0x4
+	.uleb128 .LVL233-.Ltext0
+	.uleb128 .LVL234-.Ltext0
+	.uleb128 0x2
+	.byte	0x37
+	.byte	0x9f
+	.byte	0
+.LVUS137:
+	.uleb128 .LVU1327
+	.uleb128 .LVU1330
+.LLST137:
+	.byte	0x4
+	.uleb128 .LVL235-.Ltext0
+	.uleb128 .LVL236-.Ltext0
+	.uleb128 0x2
+	.byte	0x40
+	.byte	0x9f
+	.byte	0
+.LVUS138:
+	.uleb128 .LVU1338
+	.uleb128 .LVU1341
+.LLST138:
+	.byte	0x4
+	.uleb128 .LVL237-.Ltext0
+	.uleb128 .LVL238-.Ltext0
+	.uleb128 0x2
+	.byte	0x3c
+	.byte	0x9f
+	.byte	0
+.LVUS139:
+	.uleb128 .LVU1348
+	.uleb128 .LVU1351
+.LLST139:
+	.byte	0x4
+	.uleb128 .LVL239-.Ltext0
+	.uleb128 .LVL240-.Ltext0
+	.uleb128 0x2
+	.byte	0x38
+	.byte	0x9f
+	.byte	0
+.LVUS140:
+	.uleb128 .LVU1358
+	.uleb128 .LVU1361
+.LLST140:
+	.byte	0x4
+	.uleb128 .LVL241-.Ltext0
+	.uleb128 .LVL242-.Ltext0
+	.uleb128 0x2
+	.byte	0x37
+	.byte	0x9f
+	.byte	0
+.LVUS141:
+	.uleb128 .LVU1370
+	.uleb128 .LVU1373
+.LLST141:
+	.byte	0x4
+	.uleb128 .LVL243-.Ltext0
+	.uleb128 .LVL244-.Ltext0
+	.uleb128 0x2
+	.byte	0x40
+	.byte	0x9f
+	.byte	0
+.LVUS142:
+	.uleb128 .LVU1380
+	.uleb128 .LVU1383
+.LLST142:
+	.byte	0x4
+	.uleb128 .LVL245-.Ltext0
+	.uleb128 .LVL246-.Ltext0
+	.uleb128 0x2
+	.byte	0x3c
+	.byte	0x9f
+	.byte	0
+.LVUS143:
+	.uleb128 .LVU1390
+	.uleb128 .LVU1393
+.LLST143:
+	.byte	0x4
+	.uleb128 .LVL247-.Ltext0
+	.uleb128 .LVL248-.Ltext0
+	.uleb128 0x2
+	.byte	0x38
+	.byte	0x9f
+	.byte	0
+.LVUS144:
+	.uleb128 .LVU1400
+	.uleb128 .LVU1403
+.LLST144:
+	.byte	0x4
+	.uleb128 .LVL249-.Ltext0
+	.uleb128 .LVL250-.Ltext0
+	.uleb128 0x2
+	.byte	0x37
+	.byte	0x9f
+	.byte	0
+.LVUS145:
+	.uleb128 .LVU1414
+	.uleb128 .LVU1417
+.LLST145:
+	.byte	0x4
+	.uleb128 .LVL251-.Ltext0
+	.uleb128 .LVL252-.Ltext0
+	.uleb128 0x2
+	.byte	0x40
+	.byte	0x9f
+	.byte	0
+.LVUS146:
+	.uleb128 .LVU1424
+	.uleb128 .LVU1427
+.LLST146:
+	.byte	0x4
+	.uleb128 .LVL253-.Ltext0
+	.uleb128 .LVL254-.Ltext0
+	.uleb128 0x2
+	.byte	0x3c
+	.byte	0x9f
+	.byte	0
+.LVUS147:
+	.uleb128 .LVU1434
+	.uleb128 .LVU1437
+.LLST147:
+	.byte	0x4
+	.uleb128 .LVL255-.Ltext0
+	.uleb128 .LVL256-.Ltext0
+	.uleb128 0x2
+	.byte	0x38
+	.byte	0x9f
+	.byte	0
+.LVUS148:
+	.uleb128 .LVU1444
+	.uleb128 .LVU1446
+.LLST148:
+	.byte	0x4
+	.uleb128 .LVL257-.Ltext0
+	.uleb128 .LVL257-.Ltext0
+	.uleb128 0x2
+	.byte	0x37
+	.byte	0x9f
+	.byte	0
+.LVUS149:
+	.uleb128 .LVU1458
+	.uleb128 .LVU1461
+.LLST149:
+	.byte	0x4
+	.uleb128 .LVL258-.Ltext0
+	.uleb128 .LVL259-.Ltext0
+	.uleb128 0x2
+	.byte	0x40
+	.byte	0x9f
+	.byte	0
+.LVUS150:
+	.uleb128 .LVU1468
+	.uleb128 .LVU1471
+.LLST150:
+	.byte	0x4
+	.uleb128 .LVL260-.Ltext0
+	.uleb128 .LVL261-.Ltext0
+	.uleb128 0x2
+	.byte	0x3c
+	.byte	0x9f
+	.byte	0
+.LVUS151:
+	.uleb128 .LVU1478
+	.uleb128 .LVU1481
+.LLST151:
+	.byte	0x4
+	.uleb128 .LVL262-.Ltext0
+	.uleb128 .LVL263-.Ltext0
+	.uleb128 0x2
+	.byte	0x38
+	.byte	0x9f
+	.byte	0
+.LVUS152:
+	.uleb128 .LVU1488
+	.uleb128 .LVU1491
+.LLST152:
+	.byte	0x4
+	.uleb128 .LVL264-.Ltext0
+	.uleb128 .LVL265-.Ltext0
+	.uleb128 0x2
+	.byte	0x37
+	.byte	0x9f
+	.byte	0
+.LVUS153:
+	.uleb128 .LVU1502
+	.uleb128 .LVU1505
+.LLST153:
+	.byte	0x4
+	.uleb128 .LVL266-.Ltext0
+	.uleb128 .LVL267-.Ltext0
+	.uleb128 0x2
+	.byte	0x40
+	.byte	0x9f
+	.byte	0
+.LVUS154:
+	.uleb128 .LVU1512
+	.uleb128 .LVU1515
+.LLST154:
+	.byte	0x4
+	.uleb128 .LVL268-.Ltext0
+	.uleb128 .LVL269-.Ltext0
+	.uleb128 0x2
+	.byte	0x3c
+	.byte	0x9f
+	.byte	0
+.LVUS155:
+	.uleb128 .LVU1522
+	.uleb128 .LVU1525
+.LLST155:
+	.byte	0x4
+	.uleb128 .LVL270-.Ltext0
+	.uleb128 .LVL271-.Ltext0
+	.uleb128 0x2
+	.byte	0x38
+	.byte	0x9f
+	.byte	0
+.LVUS156:
+	.uleb128 .LVU1532
+	.uleb128 .LVU1535
+.LLST156:
+	.byte	0x4
+	.uleb128 .LVL272-.Ltext0
+	.uleb128 .LVL273-.Ltext0
+	.uleb128 0x2
+	.byte	0x37
+	.byte	0x9f
+	.byte	0
+.LVUS157:
+	.uleb128 .LVU1544
+	.uleb128 .LVU1547
+.LLST157:
+	.byte	0x4
+	.uleb128 .LVL274-.Ltext0
+	.uleb128 .LVL275-.Ltext0
+	.uleb128 0x1
+	.byte	0x5c
+	.byte	0
+.LVUS158:
+	.uleb128 .LVU1544
+	.uleb128 .LVU1547
+.LLST158:
+	.byte	0x4
+	.uleb128 .LVL274-.Ltext0
+	.uleb128 .LVL275-.Ltext0
+	.uleb128 0x2
+	.byte	0x40
+	.byte	0x9f
+	.byte	0
+.LVUS159:
+	.uleb128 .LVU1554
+	.uleb128 .LVU1557
+.LLST159:
+	.byte	0x4
+	.uleb128 .LVL276-.Ltext0
+	.uleb128 .LVL277-.Ltext0
+	.uleb128 0x2
+	.byte	0x3c
+	.byte	0x9f
+	.byte	0
+.LVUS160:
+	.uleb128 .LVU1564
+	.uleb128 .LVU1567
+.LLST160:
+	.byte	0x4
+	.uleb128 .LVL278-.Ltext0
+	.uleb128 .LVL279-.Ltext0
+	.uleb128 0x2
+	.byte	0x38
+	.byte	0x9f
+	.byte	0
+.LVUS161:
+	.uleb128 .LVU1574
+	.uleb128 .LVU1577
+.LLST161:
+	.byte	0x4
+	.uleb128 .LVL280-.Ltext0
+	.uleb128 .LVL281-.Ltext0
+	.uleb128 0x2
+	.byte	0x37
+	.byte	0x9f
+	.byte	0
+.LVUS162:
+	.uleb128 .LVU1586
+	.uleb128 .LVU1589
+.LLST162:
+	.byte	0x4
+	.uleb128 .LVL282-.Ltext0
+	.uleb128 .LVL283-.Ltext0
+	.uleb128 0x2
+	.byte	0x40
+	.byte	0x9f
+	.byte	0
+.LVUS163:
+	.uleb128 .LVU1596
+	.uleb128 .LVU1599
+.LLST163:
+	.byte	0x4
+	.uleb128 .LVL284-.Ltext0
+	.uleb128 .LVL285-.Ltext0
+	.uleb128 0x2
+	.byte	0x3c
+	.byte	0x9f
+	.byte	0
+.LVUS164:
+	.uleb128 .LVU1606
+	.uleb128 .LVU1608
+.LLST164:
+	.byte	0x4
+	.uleb128 .LVL286-.Ltext0
+	.uleb128 .LVL286-.Ltext0
+	.uleb128 0x2
+	.byte	0x38
+	.byte	0x9f
+	.byte	0
+.LVUS165:
+	.uleb128 .LVU1615
+	.uleb128 .LVU1618
+.LLST165:
+	.byte	0x4
+	.uleb128 .LVL287-.Ltext0
+	.uleb128 .LVL288-.Ltext0
+	.uleb128 0x2
+	.byte	0x37
+	.byte	0x9f
+	.byte	0
+.LVUS166:
+	.uleb128 .LVU1629
+	.uleb128 .LVU1632
+.LLST166:
+	.byte	0x4
+	.uleb128 .LVL289-.Ltext0
+	.uleb128 .LVL290-.Ltext0
+	.uleb128 0x2
+	.byte	0x40
+	.byte	0x9f
+	.byte	0
+.LVUS167:
+	.uleb128 .LVU1639
+	.uleb128 .LVU1642
+.LLST167:
+	.byte	0x4
+	.uleb128 .LVL291-.Ltext0
+	.uleb128 .LVL292-.Ltext0
+	.uleb128 0x2
+	.byte	0x3c
+	.byte	0x9f
+	.byte	0
+.LVUS168:
+	.uleb128 .LVU1649
+	.uleb128 .LVU1652
+.LLST168:
+	.byte	0x4
+	.uleb128 .LVL293-.Ltext0
+	.uleb128 .LVL294-.Ltext0
+	.uleb128 0x2
+	.byte	0x38
+	.byte	0x9f
+	.byte	0
+.LVUS169:
+	.uleb128 .LVU1659
+	.uleb128 .LVU1662
+.LLST169:
+	.byte	0x4
+	.uleb128 .LVL295-.Ltext0
+	.uleb128 .LVL296-.Ltext0
+	.uleb128 0x2
+	.byte	0x37
+	.byte	0x9f
+	.byte	0
+.LVUS171:
+	.uleb128 .LVU1670
+	.uleb128 .LVU1673
+	.uleb128 .LVU1673
+	.uleb128 .LVU1675
+.LLST171:
+	.byte	0x4
+	.uleb128 .LVL297-.Ltext0
+	.uleb128 .LVL298-.Ltext0
+	.uleb128 0x6
+	.byte	0x72
+	.sleb128 0
+	.byte	0x71
+	.sleb128 0
+	.byte	0x27
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL298-.Ltext0
+	.uleb128 .LVL299-.Ltext0
+	.uleb128 0x1
+	.byte	0x52
+	.byte	0
+.LVUS172:
+	.uleb128 .LVU1670
+	.uleb128 .LVU1675
+.LLST172:
+	.byte	0x4
+	.uleb128 .LVL297-.Ltext0
+	.uleb128 .LVL299-.Ltext0
+	.uleb128 0x2
+	.byte	0x40
+	.byte	0x9f
+	.byte	0
+.LVUS173:
+	.uleb128 .LVU1684
+	.uleb128 .LVU1687
+.LLST173:
+	.byte	0x4
+	.uleb128 .LVL300-.Ltext0
+	.uleb128 .LVL301-.Ltext0
+	.uleb128 0x2
+	.byte	0x3c
+	.byte	0x9f
+	.byte	0
+.LVUS174:
+	.uleb128 .LVU1694
+	.uleb128 .LVU1697
+.LLST174:
+	.byte	0x4
+	.uleb128 .LVL302-.Ltext0
+	.uleb128 .LVL303-.Ltext0
+	.uleb128 0x2
+	.byte	0x38
+	.byte	0x9f
+	.byte	0
+.LVUS175:
+	.uleb128 .LVU1704
+	.uleb128 .LVU1707
+.LLST175:
+	.byte	0x4
+	.uleb128 .LVL304-.Ltext0
+	.uleb128 .LVL305-.Ltext0
+	.uleb128 0x2
+	.byte	0x37
+	.byte	0x9f
+	.byte	0
+.LVUS176:
+	.uleb128 .LVU1716
+	.uleb128 .LVU1719
+.LLST176:
+	.byte	0x4
+	.uleb128 .LVL306-.Ltext0
+	.uleb128 .LVL307-.Ltext0
+	.uleb128 0x2
+	.byte	0x40
+	.byte	0x9f
+	.byte	0
+.LVUS177:
+	.uleb128 .LVU1726
+	.uleb128 .LVU1729
+.LLST177:
+	.byte	0x4
+	.uleb128 .LVL308-.Ltext0
+	.uleb128 .LVL309-.Ltext0
+	.uleb128 0x2
+	.byte	0x3c
+	.byte	0x9f
+	.byte	0
+.LVUS178:
+	.uleb128 .LVU1736
+	.uleb128 .LVU1739
+.LLST178:
+	.byte	0x4
+	.uleb128 .LVL310-.Ltext0
+	.uleb128 .LVL311-.Ltext0
+	.uleb128 0x2
+	.byte	0x38
+	.byte	0x9f
+	.byte	0
+.LVUS179:
+	.uleb128 .LVU1746
+	.uleb128 .LVU1749
+.LLST179:
+	.byte	0x4
+	.uleb128 .LVL312-.Ltext0
+	.uleb128 .LVL313-.Ltext0
+	.uleb128 0x2
+	.byte	0x37
+	.byte	0x9f
+	.byte	0
+.LVUS180:
+	.uleb128 .LVU1760
+	.uleb128 .LVU1763
+.LLST180:
+	.byte	0x4
+	.uleb128 .LVL314-.Ltext0
+	.uleb128 .LVL315-.Ltext0
+	.uleb128 0x2
+	.byte	0x40
+	.byte	0x9f
+	.byte	0
+.LVUS181:
+	.uleb128 .LVU1770
+	.uleb128 .LVU1773
+.LLST181:
+	.byte	0x4
+	.uleb128 .LVL316-.Ltext0
+	.uleb128 .LVL317-.Ltext0
+	.uleb128 0x2
+	.byte	0x3c
+	.byte	0x9f
+	.byte	0
+.LVUS182:
+	.uleb128 .LVU1780
+	.uleb128 .LVU1783
+.LLST182:
+	.byte	0x4
+	.uleb128 .LVL318-.Ltext0
+	.uleb128 .LVL319-.Ltext0
+	.uleb128 0x2
+	.byte	0x38
+	.byte	0x9f
+	.byte	0
+.LVUS184:
+	.uleb128 .LVU1791
+	.uleb128 .LVU1793
+.LLST184:
+	.byte	0x4
+	.uleb128 .LVL320-.Ltext0
+	.uleb128 .LVL320-.Ltext0
+	.uleb128 0x2
+	.byte	0x37
+	.byte	0x9f
+	.byte	0
+.LVUS185:
+	.uleb128 .LVU1803
+	.uleb128 .LVU1806
+.LLST185:
+	.byte	0x4
+	.uleb128 .LVL321-.Ltext0
+	.uleb128 .LVL322-.Ltext0
+	.uleb128 0x2
+	.byte	0x40
+	.byte	0x9f
+	.byte	0
+.LVUS186:
+	.uleb128 .LVU1813
+	.uleb128 .LVU1816
+.LLST186:
+	.byte	0x4
+	.uleb128 .LVL323-.Ltext0
+	.uleb128 .LVL324-.Ltext0
+	.uleb128 0x2
+	.byte	0x3c
+	.byte	0x9f
+	.byte	0
+.LVUS187:
+	.uleb128 .LVU1823
+	.uleb128 .LVU1826
+.LLST187:
+	.byte	0x4
+	.uleb128 .LVL325-.Ltext0
+	.uleb128 .LVL326-.Ltext0
+	.uleb128 0x2
+	.byte	0x38
+	.byte	0x9f
+	.byte	0
+.LVUS188:
+	.uleb128 .LVU1833
+	.uleb128 .LVU1836
+.LLST188:
+	.byte	0x4
+	.uleb128 .LVL327-.Ltext0
+	.uleb128 .LVL328-.Ltext0
+	.uleb128 0x2
+	.byte	0x37
+	.byte	0x9f
+	.byte	0
+.LVUS189:
+	.uleb128 .LVU1847
+	.uleb128 .LVU1850
+.LLST189:
+	.byte	0x4
+	.uleb128 .LVL329-.Ltext0
+	.uleb128 .LVL330-.Ltext0
+	.uleb128 0x2
+	.byte	0x40
+	.byte	0x9f
+	.byte	0
+.LVUS190:
+	.uleb128 .LVU1858
+	.uleb128 .LVU1861
+.LLST190:
+	.byte	0x4
+	.uleb128 .LVL331-.Ltext0
+	.uleb128 .LVL332-.Ltext0
+	.uleb128 0x2
+	.byte	0x3c
+	.byte	0x9f
+	.byte	0
+.LVUS191:
+	.uleb128 .LVU1868
+	.uleb128 .LVU1871
+.LLST191:
+	.byte	0x4
+	.uleb128 .LVL333-.Ltext0
+	.uleb128 .LVL334-.Ltext0
+	.uleb128 0x2
+	.byte	0x38
+	.byte	0x9f
+	.byte	0
+.LVUS192:
+	.uleb128 .LVU1878
+	.uleb128 .LVU1881
+.LLST192:
+	.byte	0x4
+	.uleb128 .LVL335-.Ltext0
+	.uleb128 .LVL336-.Ltext0
+	.uleb128 0x2
+	.byte	0x37
+	.byte	0x9f
+	.byte	0
+.LVUS193:
+	.uleb128 .LVU1890
+	.uleb128 .LVU1893
+.LLST193:
+	.byte	0x4
+	.uleb128 .LVL337-.Ltext0
+	.uleb128 .LVL338-.Ltext0
+	.uleb128 0x1
+	.byte	0x5c
+	.byte	0
+.LVUS194:
+	.uleb128 .LVU1890
+	.uleb128 .LVU1893
+.LLST194:
+	.byte	0x4
+	.uleb128 .LVL337-.Ltext0
+	.uleb128 .LVL338-.Ltext0
+	.uleb128 0x2
+	.byte	0x40
+	.byte	0x9f
+	.byte	0
+.LVUS195:
+	.uleb128 .LVU1900
+	.uleb128 .LVU1903
+.LLST195:
+	.byte	0x4
+	.uleb128 .LVL339-.Ltext0
+	.uleb128 .LVL340-.Ltext0
+	.uleb128 0x2
+	.byte	0x3c
+	.byte	0x9f
+	.byte	0
+.LVUS196:
+	.uleb128 .LVU1910
+	.uleb128 .LVU1913
+.LLST196:
+	.byte	0x4
+	.uleb128 .LVL341-.Ltext0
+	.uleb128 .LVL342-.Ltext0
+	.uleb128 0x2
+	.byte	0x38
+	.byte	0x9f
+	.byte	0
+.LVUS197:
+	.uleb128 .LVU1920
+	.uleb128 .LVU1923
+.LLST197:
+	.byte	0x4
+	.uleb128 .LVL343-.Ltext0
+	.uleb128 .LVL344-.Ltext0
+	.uleb128 0x2
+	.byte	0x37
+	.byte	0x9f
+	.byte	0
+.LVUS198:
+	.uleb128 .LVU1932
+	.uleb128 .LVU1935
+.LLST198:
+	.byte	0x4
+	.uleb128 .LVL345-.Ltext0
+	.uleb128 .LVL346-.Ltext0
+	.uleb128 0x2
+	.byte	0x40
+	.byte	0x9f
+	.byte	0
+.LVUS199:
+	.uleb128 .LVU1942
+	.uleb128 .LVU1945
+.LLST199:
+	.byte	0x4
+	.uleb128 .LVL347-.Ltext0
+	.uleb128 .LVL348-.Ltext0
+	.uleb128 0x2
+	.byte	0x3c
+	.byte	0x9f
+	.byte	0
+.LVUS200:
+	.uleb128 .LVU1952
+	.uleb128 .LVU1954
+.LLST200:
+	.byte	0x4
+	.uleb128 .LVL349-.Ltext0
+	.uleb128 .LVL349-.Ltext0
+	.uleb128 0x2
+	.byte	0x38
+	.byte	0x9f
+	.byte	0
+.LVUS201:
+	.uleb128 .LVU1961
+	.uleb128 .LVU1964
+.LLST201:
+	.byte	0x4
+	.uleb128 .LVL350-.Ltext0
+	.uleb128 .LVL351-.Ltext0
+	.uleb128 0x2
+	.byte	0x37
+	.byte	0x9f
+	.byte	0
+.LVUS202:
+	.uleb128 .LVU1975
+	.uleb128 .LVU1978
+.LLST202:
+	.byte	0x4
+	.uleb128 .LVL352-.Ltext0
+	.uleb128 .LVL353-.Ltext0
+	.uleb128 0x2
+	.byte	0x40
+	.byte	0x9f
+	.byte	0
+.LVUS203:
+	.uleb128 .LVU1985
+	.uleb128 .LVU1988
+.LLST203:
+	.byte	0x4
+	.uleb128 .LVL354-.Ltext0
+	.uleb128 .LVL355-.Ltext0
+	.uleb128 0x2
+	.byte	0x3c
+	.byte	0x9f
+	.byte	0
+.LVUS204:
+	.uleb128 .LVU1995
+	.uleb128 .LVU1998
+.LLST204:
+	.byte	0x4
+	.uleb128 .LVL356-.Ltext0
+	.uleb128 .LVL357-.Ltext0
+	.uleb128 0x2
+	.byte	0x38
+	.byte	0x9f
+	.byte	0
+.LVUS205:
+	.uleb128 .LVU2005
+	.uleb128 .LVU2008
+.LLST205:
+	.byte	0x4
+	.uleb128 .LVL358-.Ltext0
+	.uleb128 .LVL359-.Ltext0
+	.uleb128 0x2
+	.byte	0x37
+	.byte	0x9f
+	.byte	0
+.LVUS206:
+	.uleb128 .LVU2019
+	.uleb128 .LVU2022
+.LLST206:
+	.byte	0x4
+	.uleb128 .LVL360-.Ltext0
+	.uleb128 .LVL361-.Ltext0
+	.uleb128 0x2
+	.byte	0x40
+	.byte	0x9f
+	.byte	0
+.LVUS207:
+	.uleb128 .LVU2029
+	.uleb128 .LVU2032
+.LLST207:
+	.byte	0x4
+	.uleb128 .LVL362-.Ltext0
+	.uleb128 .LVL363-.Ltext0
+	.uleb128 0x2
+	.byte	0x3c
+	.byte	0x9f
+	.byte	0
+.LVUS208:
+	.uleb128 .LVU2039
+	.uleb128 .LVU2042
+.LLST208:
+	.byte	0x4
+	.uleb128 .LVL364-.Ltext0
+	.uleb128 .LVL365-.Ltext0
+	.uleb128 0x2
+	.byte	0x38
+	.byte	0x9f
+	.byte	0
+.LVUS210:
+	.uleb128 .LVU2050
+	.uleb128 .LVU2054
+.LLST210:
+	.byte	0x4
+	.uleb128 .LVL366-.Ltext0
+	.uleb128 .LVL367-.Ltext0
+	.uleb128 0x2
+	.byte	0x37
+	.byte	0x9f
+	.byte	0
+.LVUS211:
+	.uleb128 .LVU2063
+	.uleb128 .LVU2066
+.LLST211:
+	.byte	0x4
+	.uleb128 .LVL368-.Ltext0
+	.uleb128 .LVL369-.Ltext0
+	.uleb128 0x2
+	.byte	0x40
+	.byte	0x9f
+	.byte	0
+.LVUS212:
+	.uleb128 .LVU2073
+	.uleb128 .LVU2076
+.LLST212:
+	.byte	0x4
+	.uleb128 .LVL370-.Ltext0
+	.uleb128 .LVL371-.Ltext0
+	.uleb128 0x2
+	.byte	0x3c
+	.byte	0x9f
+	.byte	0
+.LVUS213:
+	.uleb128 .LVU2083
+	.uleb128 .LVU2086
+.LLST213:
+	.byte	0x4
+	.uleb128 .LVL372-.Ltext0
+	.uleb128 .LVL373-.Ltext0
+	.uleb128 0x2
+	.byte	0x38
+	.byte	0x9f
+	.byte	0
+.LVUS214:
+	.uleb128 .LVU2093
+	.uleb128 .LVU2096
+.LLST214:
+	.byte	0x4
+	.uleb128 .LVL374-.Ltext0
+	.uleb128 .LVL375-.Ltext0
+	.uleb128 0x2
+	.byte	0x37
+	.byte	0x9f
+	.byte	0
+.LVUS215:
+	.uleb128 .LVU2107
+	.uleb128 .LVU2110
+.LLST215:
+	.byte	0x4
+	.uleb128 .LVL376-.Ltext0
+	.uleb128 .LVL377-.Ltext0
+	.uleb128 0x2
+	.byte	0x40
+	.byte	0x9f
+	.byte	0
+.LVUS216:
+	.uleb128 .LVU2117
+	.uleb128 .LVU2120
+.LLST216:
+	.byte	0x4
+	.uleb128 .LVL378-.Ltext0
+	.uleb128 .LVL379-.Ltext0
+	.uleb128 0x2
+	.byte	0x3c
+	.byte	0x9f
+	.byte	0
+.LVUS217:
+	.uleb128 .LVU2127
+	.uleb128 .LVU2130
+.LLST217:
+	.byte	0x4
+	.uleb128 .LVL380-.Ltext0
+	.uleb128 .LVL381-.Ltext0
+	.uleb128 0x2
+	.byte	0x38
+	.byte	0x9f
+	.byte	0
+.LVUS218:
+	.uleb128 .LVU2137
+	.uleb128 .LVU2139
+.LLST218:
+	.byte	0x4
+	.uleb128 .LVL382-.Ltext0
+	.uleb128 .LVL382-.Ltext0
+	.uleb128 0x2
+	.byte	0x37
+	.byte	0x9f
+	.byte	0
+.LVUS219:
+	.uleb128 .LVU2150
+	.uleb128 .LVU2153
+.LLST219:
+	.byte	0x4
+	.uleb128 .LVL383-.Ltext0
+	.uleb128 .LVL384-.Ltext0
+	.uleb128 0x2
+	.byte	0x40
+	.byte	0x9f
+	.byte	0
+.LVUS220:
+	.uleb128 .LVU2160
+	.uleb128 .LVU2163
+.LLST220:
+	.byte	0x4
+	.uleb128 .LVL385-.Ltext0
+	.uleb128 .LVL386-.Ltext0
+	.uleb128 0x2
+	.byte	0x3c
+	.byte	0x9f
+	.byte	0
+.LVUS222:
+	.uleb128 .LVU2170
+	.uleb128 .LVU2174
+.LLST222:
+	.byte	0x4
+	.uleb128 .LVL387-.Ltext0
+	.uleb128 .LVL388-.Ltext0
+	.uleb128 0x2
+	.byte	0x38
+	.byte	0x9f
+	.byte	0
+.LVUS223:
+	.uleb128 .LVU2181
+	.uleb128 .LVU2184
+.LLST223:
+	.byte	0x4
+	.uleb128 .LVL389-.Ltext0
+	.uleb128 .LVL390-.Ltext0
+	.uleb128 0x2
+	.byte	0x37
+	.byte	0x9f
+	.byte	0
+.LVUS224:
+	.uleb128 .LVU2195
+	.uleb128 .LVU2198
+.LLST224:
+	.byte	0x4
+	.uleb128 .LVL391-.Ltext0
+	.uleb128 .LVL392-.Ltext0
+	.uleb128 0x2
+	.byte	0x40
+	.byte	0x9f
+	.byte	0
+.LVUS225:
+	.uleb128 .LVU2206
+	.uleb128 .LVU2209
+.LLST225:
+	.byte	0x4
+	.uleb128 .LVL393-.Ltext0
+	.uleb128 .LVL394-.Ltext0
+	.uleb128 0x2
+	.byte	0x3c
+	.byte	0x9f
+	.byte	0
+.LVUS226:
+	.uleb128 .LVU2216
+	.uleb128 .LVU2219
+.LLST226:
+	.byte	0x4
+	.uleb128 .LVL395-.Ltext0
+	.uleb128 .LVL396-.Ltext0
+	.uleb128 0x2
+	.byte	0x38
+	.byte	0x9f
+	.byte	0
+.LVUS227:
+	.uleb128 .LVU2226
+	.uleb128 .LVU2229
+.LLST227:
+	.byte	0x4
+	.uleb128 .LVL397-.Ltext0
+	.uleb128 .LVL398-.Ltext0
+	.uleb128 0x2
+	.byte	0x37
+	.byte	0x9f
+	.byte	0
+.LVUS228:
+	.uleb128 .LVU2238
+	.uleb128 .LVU2241
+.LLST228:
+	.byte	0x4
+	.uleb128 .LVL399-.Ltext0
+	.uleb128 .LVL400-.Ltext0
+	.uleb128 0x1
+	.byte	0x5c
+	.byte	0
+.LVUS229:
+	.uleb128 .LVU2238
+	.uleb128 .LVU2241
+.LLST229:
+	.byte	0x4
+	.uleb128 .LVL399-.Ltext0
+	.uleb128 .LVL400-.Ltext0
+	.uleb128 0x2
+	.byte	0x40
+	.byte	0x9f
+	.byte	0
+.LVUS230:
+	.uleb128 .LVU2248
+	.uleb128 .LVU2251
+.LLST230:
+	.byte	0x4
+	.uleb128 .LVL401-.Ltext0
+	.uleb128 .LVL402-.Ltext0
+	.uleb128 0x2
+	.byte	0x3c
+	.byte	0x9f
+	.byte	0
+.LVUS231:
+	.uleb128 .LVU2258
+	.uleb128 .LVU2261
+.LLST231:
+	.byte	0x4
+	.uleb128 .LVL403-.Ltext0
+	.uleb128 .LVL404-.Ltext0
+	.uleb128 0x2
+	.byte	0x38
+	.byte	0x9f
+	.byte	0
+.LVUS232:
+	.uleb128 .LVU2268
+	.uleb128 .LVU2271
+.LLST232:
+	.byte	0x4
+	.uleb128 .LVL405-.Ltext0
+	.uleb128 .LVL406-.Ltext0
+	.uleb128 0x2
+	.byte	0x37
+	.byte	0x9f
+	.byte	0
+.LVUS233:
+	.uleb128 .LVU2280
+	.uleb128 .LVU2283
+.LLST233:
+	.byte	0x4
+	.uleb128 .LVL407-.Ltext0
+	.uleb128 .LVL408-.Ltext0
+	.uleb128 0x2
+	.byte	0x40
+	.byte	0x9f
+	.byte	0
+.LVUS234:
+	.uleb128 .LVU2290
+	.uleb128 .LVU2293
+.LLST234:
+	.byte	0x4
+	.uleb128 .LVL409-.Ltext0
+	.uleb128 .LVL410-.Ltext0
+	.uleb128 0x2
+	.byte	0x3c
+	.byte	0x9f
+	.byte	0
+.LVUS235:
+	.uleb128 .LVU2300
+	.uleb128 .LVU2302
+.LLST235:
+	.byte	0x4
+	.uleb128 .LVL411-.Ltext0
+	.uleb128 .LVL411-.Ltext0
+	.uleb128 0x2
+	.byte	0x38
+	.byte	0x9f
+	.byte	0
+.LVUS236:
+	.uleb128 .LVU2309
+	.uleb128 .LVU2312
+.LLST236:
+	.byte	0x4
+	.uleb128 .LVL412-.Ltext0
+	.uleb128 .LVL413-.Ltext0
+	.uleb128 0x2
+	.byte	0x37
+	.byte	0x9f
+	.byte	0
+.LVUS237:
+	.uleb128 .LVU2324
+	.uleb128 .LVU2327
+.LLST237:
+	.byte	0x4
+	.uleb128 .LVL414-.Ltext0
+	.uleb128 .LVL415-.Ltext0
+	.uleb128 0x2
+	.byte	0x40
+	.byte	0x9f
+	.byte	0
+.LVUS238:
+	.uleb128 .LVU2334
+	.uleb128 .LVU2337
+.LLST238:
+	.byte	0x4
+	.uleb128 .LVL416-.Ltext0
+	.uleb128 .LVL417-.Ltext0
+	.uleb128 0x2
+	.byte	0x3c
+	.byte	0x9f
+	.byte	0
+.LVUS239:
+	.uleb128 .LVU2344
+	.uleb128 .LVU2347
+.LLST239:
+	.byte	0x4
+	.uleb128 .LVL418-.Ltext0
+	.uleb128 .LVL419-.Ltext0
+	.uleb128 0x2
+	.byte	0x38
+	.byte	0x9f
+	.byte	0
+.LVUS240:
+	.uleb128 .LVU2354
+	.uleb128 .LVU2357
+.LLST240:
+	.byte	0x4
+	.uleb128 .LVL420-.Ltext0
+	.uleb128 .LVL421-.Ltext0
+	.uleb128 0x2
+	.byte	0x37
+	.byte	0x9f
+	.byte	0
+.LVUS241:
+	.uleb128 .LVU2368
+	.uleb128 .LVU2371
+.LLST241:
+	.byte	0x4
+	.uleb128 .LVL422-.Ltext0
+	.uleb128 .LVL423-.Ltext0
+	.uleb128 0x2
+	.byte	0x40
+	.byte	0x9f
+	.byte	0
+.LVUS242:
+	.uleb128 .LVU2378
+	.uleb128 .LVU2381
+.LLST242:
+	.byte	0x4
+	.uleb128 .LVL424-.Ltext0
+	.uleb128 .LVL425-.Ltext0
+	.uleb128 0x2
+	.byte	0x3c
+	.byte	0x9f
+	.byte	0
+.LVUS243:
+	.uleb128 .LVU2388
+	.uleb128 .LVU2391
+.LLST243:
+	.byte	0x4
+	.uleb128 .LVL426-.Ltext0
+	.uleb128 .LVL427-.Ltext0
+	.uleb128 0x2
+	.byte	0x38
+	.byte	0x9f
+	.byte	0
+.LVUS244:
+	.uleb128 .LVU2398
+	.uleb128 .LVU2401
+.LLST244:
+	.byte	0x4
+	.uleb128 .LVL428-.Ltext0
+	.uleb128 .LVL429-.Ltext0
+	.uleb128 0x2
+	.byte	0x37
+	.byte	0x9f
+	.byte	0
+.LVUS245:
+	.uleb128 .LVU2410
+	.uleb128 .LVU2413
+.LLST245:
+	.byte	0x4
+	.uleb128 .LVL430-.Ltext0
+	.uleb128 .LVL431-.Ltext0
+	.uleb128 0x2
+	.byte	0x40
+	.byte	0x9f
+	.byte	0
+.LVUS246:
+	.uleb128 .LVU2420
+	.uleb128 .LVU2423
+.LLST246:
+	.byte	0x4
+	.uleb128 .LVL432-.Ltext0
+	.uleb128 .LVL433-.Ltext0
+	.uleb128 0x2
+	.byte	0x3c
+	.byte	0x9f
+	.byte	0
+.LVUS247:
+	.uleb128 .LVU2430
+	.uleb128 .LVU2433
+.LLST247:
+	.byte	0x4
+	.uleb128 .LVL434-.Ltext0
+	.uleb128 .LVL435-.Ltext0
+	.uleb128 0x2
+	.byte	0x38
+	.byte	0x9f
+	.byte	0
+.LVUS248:
+	.uleb128 .LVU2440
+	.uleb128 .LVU2443
+.LLST248:
+	.byte	0x4
+	.uleb128 .LVL436-.Ltext0
+	.uleb128 .LVL437-.Ltext0
+	.uleb128 0x2
+	.byte	0x37
+	.byte	0x9f
+	.byte	0
+.LVUS249:
+	.uleb128 .LVU2454
+	.uleb128 .LVU2457
+.LLST249:
+	.byte	0x4
+	.uleb128 .LVL438-.Ltext0
+	.uleb128 .LVL439-.Ltext0
+	.uleb128 0x2
+	.byte	0x40
+	.byte	0x9f
+	.byte	0
+.LVUS250:
+	.uleb128 .LVU2464
+	.uleb128 .LVU2467
+.LLST250:
+	.byte	0x4
+	.uleb128 .LVL440-.Ltext0
+	.uleb128 .LVL441-.Ltext0
+	.uleb128 0x2
+	.byte	0x3c
+	.byte	0x9f
+	.byte	0
+.LVUS251:
+	.uleb128 .LVU2474
+	.uleb128 .LVU2477
+.LLST251:
+	.byte	0x4
+	.uleb128 .LVL442-.Ltext0
+	.uleb128 .LVL443-.Ltext0
+	.uleb128 0x2
+	.byte	0x38
+	.byte	0x9f
+	.byte	0
+.LVUS252:
+	.uleb128 .LVU2484
+	.uleb128 .LVU2486
+.LLST252:
+	.byte	0x4
+	.uleb128 .LVL444-.Ltext0
+	.uleb128 .LVL444-.Ltext0
+	.uleb128 0x2
+	.byte	0x37
+	.byte	0x9f
+	.byte	0
+.LVUS253:
+	.uleb128 .LVU2497
+	.uleb128 .LVU2500
+.LLST253:
+	.byte	0x4
+	.uleb128 .LVL445-.Ltext0
+	.uleb128 .LVL446-.Ltext0
+	.uleb128 0x2
+	.byte	0x40
+	.byte	0x9f
+	.byte	0
+.LVUS254:
+	.uleb128 .LVU2507
+	.uleb128 .LVU2510
+.LLST254:
+	.byte	0x4
+	.uleb128 .LVL447-.Ltext0
+	.uleb128 .LVL448-.Ltext0
+	.uleb128 0x2
+	.byte	0x3c
+	.byte	0x9f
+	.byte	0
+.LVUS255:
+	.uleb128 .LVU2517
+	.uleb128 .LVU2520
+.LLST255:
+	.byte	0x4
+	.uleb128 .LVL449-.Ltext0
+	.uleb128 .LVL450-.Ltext0
+	.uleb128 0x2
+	.byte	0x38
+	.byte	0x9f
+	.byte	0
+.LVUS256:
+	.uleb128 .LVU2527
+	.uleb128 .LVU2530
+.LLST256:
+	.byte	0x4
+	.uleb128 .LVL451-.Ltext0
+	.uleb128 .LVL452-.Ltext0
+	.uleb128 0x2
+	.byte	0x37
+	.byte	0x9f
+	.byte	0
+.LVUS258:
+	.uleb128 .LVU2538
+	.uleb128 .LVU2541
+	.uleb128 .LVU2541
+	.uleb128 .LVU2543
+.LLST258:
+	.byte	0x4
+	.uleb128 .LVL453-.Ltext0
+	.uleb128 .LVL454-.Ltext0
+	.uleb128 0x6
+	.byte	0x7d
+	.sleb128 0
+	.byte	0x71
+	.sleb128 0
+	.byte	0x27
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL454-.Ltext0
+	.uleb128 .LVL455-.Ltext0
+	.uleb128 0x1
+	.byte	0x5d
+	.byte	0
+.LVUS259:
+	.uleb128 .LVU2538
+	.uleb128 .LVU2543
+.LLST259:
+	.byte	0x4
+	.uleb128 .LVL453-.Ltext0
+	.uleb128 .LVL455-.Ltext0
+	.uleb128 0x2
+	.byte	0x40
+	.byte	0x9f
+	.byte	0
+.LVUS260:
+	.uleb128 .LVU2552
+	.uleb128 .LVU2555
+.LLST260:
+	.byte	0x4
+	.uleb128 .LVL456-.Ltext0
+	.uleb128 .LVL457-.Ltext0
+	.uleb128 0x2
+	.byte	0x3c
+	.byte	0x9f
+	.byte	0
+.LVUS261:
+	.uleb128 .LVU2562
+	.uleb128 .LVU2565
+.LLST261:
+	.byte	0x4
+	.uleb128 .LVL458-.Ltext0
+	.uleb128 .LVL459-.Ltext0
+	.uleb128 0x2
+	.byte	0x38
+	.byte	0x9f
+	.byte	0
+.LVUS262:
+	.uleb128 .LVU2572
+	.uleb128 .LVU2575
+.LLST262:
+	.byte	0x4
+	.uleb128 .LVL460-.Ltext0
+	.uleb128 .LVL461-.Ltext0
+	.uleb128 0x2
+	.byte	0x37
+	.byte	0x9f
+	.byte	0
+.LVUS263:
+	.uleb128 .LVU2584
+	.uleb128 .LVU2587
+.LLST263:
+	.byte	0x4
+	.uleb128 .LVL462-.Ltext0
+	.uleb128 .LVL463-.Ltext0
+	.uleb128 0x1
+	.byte	0x5c
+	.byte	0
+.LVUS264:
+	.uleb128 .LVU2584
+	.uleb128 .LVU2587
+.LLST264:
+	.byte	0x4
+	.uleb128 .LVL462-.Ltext0
+	.uleb128 .LVL463-.Ltext0
+	.uleb128 0x2
+	.byte	0x40
+	.byte	0x9f
+	.byte	0
+.LVUS265:
+	.uleb128 .LVU2594
+	.uleb128 .LVU2597
+.LLST265:
+	.byte	0x4
+	.uleb128 .LVL464-.Ltext0
+	.uleb128 .LVL465-.Ltext0
+	.uleb128 0x2
+	.byte	0x3c
+	.byte	0x9f
+	.byte	0
+.LVUS266:
+	.uleb128 .LVU2604
+	.uleb128 .LVU2607
+.LLST266:
+	.byte	0x4
+	.uleb128 .LVL466-.Ltext0
+	.uleb128 .LVL467-.Ltext0
+	.uleb128 0x2
+	.byte	0x38
+	.byte	0x9f
+	.byte	0
+.LVUS267:
+	.uleb128 .LVU2614
+	.uleb128 .LVU2617
+.LLST267:
+	.byte	0x4
+	.uleb128 .LVL468-.Ltext0
+	.uleb128 .LVL469-.Ltext0
+	.uleb128 0x2
+	.byte	0x37
+	.byte	0x9f
+	.byte	0
+.LVUS268:
+	.uleb128 .LVU2626
+	.uleb128 .LVU2629
+.LLST268:
+	.byte	0x4
+	.uleb128 .LVL470-.Ltext0
+	.uleb128 .LVL471-.Ltext0
+	.uleb128 0x2
+	.byte	0x40
+	.byte	0x9f
+	.byte	0
+.LVUS269:
+	.uleb128 .LVU2636
+	.uleb128 .LVU2639
+.LLST269:
+	.byte	0x4
+	.uleb128 .LVL472-.Ltext0
+	.uleb128 .LVL473-.Ltext0
+	.uleb128 0x2
+	.byte	0x3c
+	.byte	0x9f
+	.byte	0
+.LVUS270:
+	.uleb128 .LVU2646
+	.uleb128 .LVU2648
+.LLST270:
+	.byte	0x4
+	.uleb128 .LVL474-.Ltext0
+	.uleb128 .LVL474-.Ltext0
+	.uleb128 0x2
+	.byte	0x38
+	.byte	0x9f
+	.byte	0
+.LVUS272:
+	.uleb128 .LVU2656
+	.uleb128 .LVU2658
+.LLST272:
+	.byte	0x4
+	.uleb128 .LVL475-.Ltext0
+	.uleb128 .LVL475-.Ltext0
+	.uleb128 0x2
+	.byte	0x37
+	.byte	0x9f
+	.byte	0
+.LVUS273:
+	.uleb128 .LVU2668
+	.uleb128 .LVU2671
+.LLST273:
+	.byte	0x4
+	.uleb128 .LVL476-.Ltext0
+	.uleb128 .LVL477-.Ltext0
+	.uleb128 0x2
+	.byte	0x40
+	.byte	0x9f
+	.byte	0
+.LVUS274:
+	.uleb128 .LVU2678
+	.uleb128 .LVU2681
+.LLST274:
+	.byte	0x4
+	.uleb128 .LVL478-.Ltext0
+	.uleb128 .LVL479-.Ltext0
+	.uleb128 0x2
+	.byte	0x3c
+	.byte	0x9f
+	.byte	0
+.LVUS275:
+	.uleb128 .LVU2688
+	.uleb128 .LVU2691
+.LLST275:
+	.byte	0x4
+	.uleb128 .LVL480-.Ltext0
+	.uleb128 .LVL481-.Ltext0
+	.uleb128 0x2
+	.byte	0x38
+	.byte	0x9f
+	.byte	0
+.LVUS276:
+	.uleb128 .LVU2698
+	.uleb128 .LVU2701
+.LLST276:
+	.byte	0x4
+	.uleb128 .LVL482-.Ltext0
+	.uleb128 .LVL483-.Ltext0
+	.uleb128 0x2
+	.byte	0x37
+	.byte	0x9f
+	.byte	0
+.LVUS277:
+	.uleb128 .LVU2712
+	.uleb128 .LVU2715
+.LLST277:
+	.byte	0x4
+	.uleb128 .LVL484-.Ltext0
+	.uleb128 .LVL485-.Ltext0
+	.uleb128 0x2
+	.byte	0x40
+	.byte	0x9f
+	.byte	0
+.LVUS278:
+	.uleb128 .LVU2723
+	.uleb128 .LVU2726
+.LLST278:
+	.byte	0x4
+	.uleb128 .LVL486-.Ltext0
+	.uleb128 .LVL487-.Ltext0
+	.uleb128 0x2
+	.byte	0x3c
+	.byte	0x9f
+	.byte	0
+.LVUS279:
+	.uleb128 .LVU2733
+	.uleb128 .LVU2736
+.LLST279:
+	.byte	0x4
+	.uleb128 .LVL488-.Ltext0
+	.uleb128 .LVL489-.Ltext0
+	.uleb128 0x2
+	.byte	0x38
+	.byte	0x9f
+	.byte	0
+.LVUS280:
+	.uleb128 .LVU2743
+	.uleb128 .LVU2746
+.LLST280:
+	.byte	0x4
+	.uleb128 .LVL490-.Ltext0
+	.uleb128 .LVL491-.Ltext0
+	.uleb128 0x2
+	.byte	0x37
+	.byte	0x9f
+	.byte	0
+.LVUS281:
+	.uleb128 .LVU2755
+	.uleb128 .LVU2758
+.LLST281:
+	.byte	0x4
+	.uleb128 .LVL492-.Ltext0
+	.uleb128 .LVL493-.Ltext0
+	.uleb128 0x2
+	.byte	0x40
+	.byte	0x9f
+	.byte	0
+.LVUS282:
+	.uleb128 .LVU2765
+	.uleb128 .LVU2768
+.LLST282:
+	.byte	0x4
+	.uleb128 .LVL494-.Ltext0
+	.uleb128 .LVL495-.Ltext0
+	.uleb128 0x2
+	.byte	0x3c
+	.byte	0x9f
+	.byte	0
+.LVUS283:
+	.uleb128 .LVU2775
+	.uleb128 .LVU2778
+.LLST283:
+	.byte	0x4
+	.uleb128 .LVL496-.Ltext0
+	.uleb128 .LVL497-.Ltext0
+	.uleb128 0x2
+	.byte	0x38
+	.byte	0x9f
+	.byte	0
+.LVUS284:
+	.uleb128 .LVU2785
+	.uleb128 .LVU2788
+.LLST284:
+	.byte	0x4
+	.uleb128 .LVL498-.Ltext0
+	.uleb128 .LVL499-.Ltext0
+	.uleb128 0x2
+	.byte	0x37
+	.byte	0x9f
+	.byte	0
+.LVUS285:
+	.uleb128 .LVU2799
+	.uleb128 .LVU2802
+.LLST285:
+	.byte	0x4
+	.uleb128 .LVL500-.Ltext0
+	.uleb128 .LVL501-.Ltext0
+	.uleb128 0x2
+	.byte	0x40
+	.byte	0x9f
+	.byte	0
+.LVUS286:
+	.uleb128 .LVU2809
+	.uleb128 .LVU2812
+.LLST286:
+	.byte	0x4
+	.uleb128 .LVL502-.Ltext0
+	.uleb128 .LVL503-.Ltext0
+	.uleb128 0x2
+	.byte	0x3c
+	.byte	0x9f
+	.byte	0
+.LVUS287:
+	.uleb128 .LVU2819
+	.uleb128 .LVU2822
+.LLST287:
+	.byte	0x4
+	.uleb128 .LVL504-.Ltext0
+	.uleb128 .LVL505-.Ltext0
+	.uleb128 0x2
+	.byte	0x38
+	.byte	0x9f
+	.byte	0
+.LVUS288:
+	.uleb128 .LVU2829
+	.uleb128 .LVU2831
+.LLST288:
+	.byte	0x4
+	.uleb128 .LVL506-.Ltext0
+	.uleb128 .LVL506-.Ltext0
+	.uleb128 0x2
+	.byte	0x37
+	.byte	0x9f
+	.byte	0
+.LVUS289:
+	.uleb128 .LVU2842
+	.uleb128 .LVU2845
+.LLST289:
+	.byte	0x4
+	.uleb128 .LVL507-.Ltext0
+	.uleb128 .LVL508-.Ltext0
+	.uleb128 0x2
+	.byte	0x40
+	.byte	0x9f
+	.byte	0
+.LVUS290:
+	.uleb128 .LVU2852
+	.uleb128 .LVU2855
+.LLST290:
+	.byte	0x4
+	.uleb128 .LVL509-.Ltext0
+	.uleb128 .LVL510-.Ltext0
+	.uleb128 0x2
+	.byte	0x3c
+	.byte	0x9f
+	.byte	0
+.LVUS291:
+	.uleb128 .LVU2862
+	.uleb128 .LVU2865
+.LLST291:
+	.byte	0x4
+	.uleb128 .LVL511-.Ltext0
+	.uleb128 .LVL512-.Ltext0
+	.uleb128 0x2
+	.byte	0x38
+	.byte	0x9f
+	.byte	0
+.LVUS292:
+	.uleb128 .LVU2872
+	.uleb128 .LVU2875
+.LLST292:
+	.byte	0x4
+	.uleb128 .LVL513-.Ltext0
+	.uleb128 .LVL514-.Ltext0
+	.uleb128 0x2
+	.byte	0x37
+	.byte	0x9f
+	.byte	0
+.LVUS293:
+	.uleb128 .LVU2886
+	.uleb128 .LVU2889
+.LLST293:
+	.byte	0x4
+	.uleb128 .LVL515-.Ltext0
+	.uleb128 .LVL516-.Ltext0
+	.uleb128 0x2
+	.byte	0x40
+	.byte	0x9f
+	.byte	0
+.LVUS294:
+	.uleb128 .LVU2896
+	.uleb128 .LVU2899
+.LLST294:
+	.byte	0x4
+	.uleb128 .LVL517-.Ltext0
+	.uleb128 .LVL518-.Ltext0
+	.uleb128 0x2
+	.byte	0x3c
+	.byte	0x9f
+	.byte	0
+.LVUS295:
+	.uleb128 .LVU2906
+	.uleb128 .LVU2908
+.LLST295:
+	.byte	0x4
+	.uleb128 .LVL519-.Ltext0
+	.uleb128 .LVL519-.Ltext0
+	.uleb128 0x2
+	.byte	0x38
+	.byte	0x9f
+	.byte	0
+.LVUS296:
+	.uleb128 .LVU2916
+	.uleb128 .LVU2919
+.LLST296:
+	.byte	0x4
+	.uleb128 .LVL520-.Ltext0
+	.uleb128 .LVL521-.Ltext0
+	.uleb128 0x2
+	.byte	0x37
+	.byte	0x9f
+	.byte	0
+.LVUS298:
+	.uleb128 .LVU2928
+	.uleb128 .LVU2931
+	.uleb128 .LVU2931
+	.uleb128 .LVU2932
+.LLST298:
+	.byte	0x4
+	.uleb128 .LVL522-.Ltext0
+	.uleb128 .LVL523-.Ltext0
+	.uleb128 0x6
+	.byte	0x7a
+	.sleb128 0
+	.byte	0x71
+	.sleb128 0
+	.byte	0x27
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL523-.Ltext0
+	.uleb128 .LVL524-.Ltext0
+	.uleb128 0x1
+	.byte	0x5a
+	.byte	0
+.LVUS299:
+	.uleb128 .LVU2928
+	.uleb128 .LVU2932
+.LLST299:
+	.byte	0x4
+	.uleb128 .LVL522-.Ltext0
+	.uleb128 .LVL524-.Ltext0
+	.uleb128 0x2
+	.byte	0x40
+	.byte	0x9f
+	.byte	0
+.LVUS300:
+	.uleb128 .LVU2939
+	.uleb128 .LVU2942
+.LLST300:
+	.byte	0x4
+	.uleb128 .LVL525-.Ltext0
+	.uleb128 .LVL526-.Ltext0
+	.uleb128 0x2
+	.byte	0x3c
+	.byte	0x9f
+	.byte	0
+.LVUS301:
+	.uleb128 .LVU2949
+	.uleb128 .LVU2952
+.LLST301:
+	.byte	0x4
+	.uleb128 .LVL527-.Ltext0
+	.uleb128 .LVL528-.Ltext0
+	.uleb128 0x2
+	.byte	0x38
+	.byte	0x9f
+	.byte	0
+.LVUS302:
+	.uleb128 .LVU2959
+	.uleb128 .LVU2962
+.LLST302:
+	.byte	0x4
+	.uleb128 .LVL529-.Ltext0
+	.uleb128 .LVL530-.Ltext0
+	.uleb128 0x2
+	.byte	0x37
+	.byte	0x9f
+	.byte	0
+.LVUS303:
+	.uleb128 .LVU2971
+	.uleb128 .LVU2974
+.LLST303:
+	.byte	0x4
+	.uleb128 .LVL531-.Ltext0
+	.uleb128 .LVL532-.Ltext0
+	.uleb128 0x2
+	.byte	0x40
+	.byte	0x9f
+	.byte	0
+.LVUS304:
+	.uleb128 .LVU2981
+	.uleb128 .LVU2984
+.LLST304:
+	.byte	0x4
+	.uleb128 .LVL533-.Ltext0
+	.uleb128 .LVL534-.Ltext0
+	.uleb128 0x2
+	.byte	0x3c
+	.byte	0x9f
+	.byte	0
+.LVUS305:
+	.uleb128 .LVU2991
+	.uleb128 .LVU2993
+.LLST305:
+	.byte	0x4
+	.uleb128 .LVL535-.Ltext0
+	.uleb128 .LVL535-.Ltext0
+	.uleb128 0x2
+	.byte	0x38
+	.byte	0x9f
+	.byte	0
+.LVUS306:
+	.uleb128 .LVU3000
+	.uleb128 .LVU3002
+.LLST306:
+	.byte	0x4
+	.uleb128 .LVL536-.Ltext0
+	.uleb128 .LVL536-.Ltext0
+	.uleb128 0x2
+	.byte	0x37
+	.byte	0x9f
+	.byte	0
+.LVUS307:
+	.uleb128 .LVU3013
+	.uleb128 .LVU3016
+.LLST307:
+	.byte	0x4
+	.uleb128 .LVL537-.Ltext0
+	.uleb128 .LVL538-.Ltext0
+	.uleb128 0x2
+	.byte	0x40
+	.byte	0x9f
+	.byte	0
+.LVUS308:
+	.uleb128 .LVU3023
+	.uleb128 .LVU3026
+.LLST308:
+	.byte	0x4
+	.uleb128 .LVL539-.Ltext0
+	.uleb128 .LVL540-.Ltext0
+	.uleb128 0x2
+	.byte	0x3c
+	.byte	0x9f
+	.byte	0
+.LVUS309:
+	.uleb128 .LVU3035
+	.uleb128 .LVU3038
+.LLST309:
+	.byte	0x4
+	.uleb128 .LVL541-.Ltext0
+	.uleb128 .LVL542-.Ltext0
+	.uleb128 0x2
+	.byte	0x38
+	.byte	0x9f
+	.byte	0
+.LVUS310:
+	.uleb128 .LVU3045
+	.uleb128 .LVU3047
+.LLST310:
+	.byte	0x4
+	.uleb128 .LVL543-.Ltext0
+	.uleb128 .LVL543-.Ltext0
+	.uleb128 0x2
+	.byte	0x37
+	.byte	0x9f
+	.byte	0
+.LVUS311:
+	.uleb128 .LVU3058
+	.uleb128 .LVU3061
+.LLST311:
+	.byte	0x4
+	.uleb128 .LVL544-.Ltext0
+	.uleb128 .LVL545-.Ltext0
+	.uleb128 0x2
+	.byte	0x40
+	.byte	0x9f
+	.byte	0
+.LVUS312:
+	.uleb128 .LVU3068
+	.uleb128 .LVU3071
+.LLST312:
+	.byte	0x4
+	.uleb128 .LVL546-.Ltext0
+	.uleb128 .LVL547-.Ltext0
+	.uleb128 0x2
+	.byte	0x3c
+	.byte	0x9f
+	.byte	0
+.LVUS313:
+	.uleb128 .LVU3078
+	.uleb128 .LVU3081
+.LLST313:
+	.byte	0x4
+	.uleb128 .LVL548-.Ltext0
+	.uleb128 .LVL549-.Ltext0
+	.uleb128 0x2
+	.byte	0x38
+	.byte	0x9f
+	.byte	0
+.LVUS315:
+	.uleb128 .LVU3088
+	.uleb128 .LVU3090
+.LLST315:
+	.byte	0x4
+	.uleb128 .LVL550-.Ltext0
+	.uleb128 .LVL550-.Ltext0
+	.uleb128 0x2
+	.byte	0x37
+	.byte	0x9f
+	.byte	0
+.LVUS316:
+	.uleb128 .LVU3102
+	.uleb128 .LVU3105
+.LLST316:
+	.byte	0x4
+	.uleb128 .LVL551-.Ltext0
+	.uleb128 .LVL552-.Ltext0
+	.uleb128 0x1
+	.byte	0x5a
+	.byte	0
+.LVUS317:
+	.uleb128 .LVU3102
+	.uleb128 .LVU3105
+.LLST317:
+	.byte	0x4
+	.uleb128 .LVL551-.Ltext0
+	.uleb128 .LVL552-.Ltext0
+	.uleb128 0x2
+	.byte	0x40
+	.byte	0x9f
+	.byte	0
+.LVUS318:
+	.uleb128 .LVU3112
+	.uleb128 .LVU3115
+.LLST318:
+	.byte	0x4
+	.uleb128 .LVL553-.Ltext0
+	.uleb128 .LVL554-.Ltext0
+	.uleb128 0x2
+	.byte	0x3c
+	.byte	0x9f
+	.byte	0
+.LVUS319:
+	.uleb128 .LVU3122
+	.uleb128 .LVU3125
+.LLST319:
+	.byte	0x4
+	.uleb128 .LVL555-.Ltext0
+	.uleb128 .LVL556-.Ltext0
+	.uleb128 0x2
+	.byte	0x38
+	.byte	0x9f
+	.byte	0
+.LVUS320:
+	.uleb128 .LVU3132
+	.uleb128 .LVU3135
+.LLST320:
+	.byte	0x4
+	.uleb128 .LVL557-.Ltext0
+	.uleb128 .LVL558-.Ltext0
+	.uleb128 0x2
+	.byte	0x37
+	.byte	0x9f
+	.byte	0
+.LVUS321:
+	.uleb128 .LVU3146
+	.uleb128 .LVU3149
+.LLST321:
+	.byte	0x4
+	.uleb128 .LVL559-.Ltext0
+	.uleb128 .LVL560-.Ltext0
+	.uleb128 0x2
+	.byte	0x40
+	.byte	0x9f
+	.byte	0
+.LVUS322:
+	.uleb128 .LVU3156
+	.uleb128 .LVU3159
+.LLST322:
+	.byte	0x4
+	.uleb128 .LVL561-.Ltext0
+	.uleb128 .LVL562-.Ltext0
+	.uleb128 0x2
+	.byte	0x3c
+	.byte	0x9f
+	.byte	0
+.LVUS323:
+	.uleb128 .LVU3166
+	.uleb128 .LVU3168
+.LLST323:
+	.byte	0x4
+	.uleb128 .LVL563-.Ltext0
+	.uleb128 .LVL563-.Ltext0
+	.uleb128 0x2
+	.byte	0x38
+	.byte	0x9f
+	.byte	0
+.LVUS324:
+	.uleb128 .LVU3176
+	.uleb128 .LVU3178
+.LLST324:
+	.byte	0x4
+	.uleb128 .LVL564-.Ltext0
+	.uleb128 .LVL564-.Ltext0
+	.uleb128 0x2
+	.byte	0x37
+	.byte	0x9f
+	.byte	0
+.LVUS325:
+	.uleb128 .LVU3189
+	.uleb128 .LVU3192
+.LLST325:
+	.byte	0x4
+	.uleb128 .LVL565-.Ltext0
+	.uleb128 .LVL566-.Ltext0
+	.uleb128 0x2
+	.byte	0x40
+	.byte	0x9f
+	.byte	0
+.LVUS327:
+	.uleb128 .LVU3200
+	.uleb128 .LVU3205
+.LLST327:
+	.byte	0x4
+	.uleb128 .LVL567-.Ltext0
+	.uleb128 .LVL568-.Ltext0
+	.uleb128 0x2
+	.byte	0x3c
+	.byte	0x9f
+	.byte	0
+.LVUS328:
+	.uleb128 .LVU3212
+	.uleb128 .LVU3215
+.LLST328:
+	.byte	0x4
+	.uleb128 .LVL569-.Ltext0
+	.uleb128 .LVL570-.Ltext0
+	.uleb128 0x2
+	.byte	0x38
+	.byte	0x9f
+	.byte	0
+.LVUS329:
+	.uleb128 .LVU3222
+	.uleb128 .LVU3225
+.LLST329:
+	.byte	0x4
+	.uleb128 .LVL571-.Ltext0
+	.uleb128 .LVL572-.Ltext0
+	.uleb128 0x2
+	.byte	0x37
+	.byte	0x9f
+	.byte	0
+.LVUS330:
+	.uleb128 .LVU3234
+	.uleb128 .LVU3237
+.LLST330:
+	.byte	0x4
+	.uleb128 .LVL573-.Ltext0
+	.uleb128 .LVL574-.Ltext0
+	.uleb128 0x2
+	.byte	0x40
+	.byte	0x9f
+	.byte	0
+.LVUS332:
+	.uleb128 .LVU3244
+	.uleb128 .LVU3248
+.LLST332:
+	.byte	0x4
+	.uleb128 .LVL575-.Ltext0
+	.uleb128 .LVL576-.Ltext0
+	.uleb128 0x2
+	.byte	0x3c
+	.byte	0x9f
+	.byte	0
+.LVUS333:
+	.uleb128 .LVU3255
+	.uleb128 .LVU3258
+.LLST333:
+	.byte	0x4
+	.uleb128 .LVL577-.Ltext0
+	.uleb128 .LVL578-.Ltext0
+	.uleb128 0x2
+	.byte	0x38
+	.byte	0x9f
+	.byte	0
+.LVUS334:
+	.uleb128 .LVU3265
+	.uleb128 .LVU3268
+.LLST334:
+	.byte	0x4
+	.uleb128 .LVL579-.Ltext0
+	.uleb128 .LVL580-.Ltext0
+	.uleb128 0x2
+	.byte	0x37
+	.byte	0x9f
+	.byte	0
+.LVUS335:
+	.uleb128 .LVU3279
+	.uleb128 .LVU3282
+.LLST335:
+	.byte	0x4
+	.uleb128 .LVL581-.Ltext0
+	.uleb128 .LVL582-.Ltext0
+	.uleb128 0x1
+	.byte	0x5b
+	.byte	0
+.LVUS336:
+	.uleb128 .LVU3279
+	.uleb128 .LVU3282
+.LLST336:
+	.byte	0x4
+	.uleb128 .LVL581-.Ltext0
+	.uleb128 .LVL582-.Ltext0
+	.uleb128 0x2
+	.byte	0x40
+	.byte	0x9f
+	.byte	0
+.LVUS337:
+	.uleb128 .LVU3289
+	.uleb128 .LVU3292
+.LLST337:
+	.byte	0x4
+	.uleb128 .LVL583-.Ltext0
+	.uleb128 .LVL584-.Ltext0
+	.uleb128 0x2
+	.byte	0x3c
+	.byte	0x9f
+	.byte	0
+.LVUS338:
+	.uleb128 .LVU3299
+	.uleb128 .LVU3302
+.LLST338:
+	.byte	0x4
+	.uleb128 .LVL585-.Ltext0
+	.uleb128 .LVL586-.Ltext0
+	.uleb128 0x2
+	.byte	0x38
+	.byte	0x9f
+	.byte	0
+.LVUS339:
+	.uleb128 .LVU3309
+	.uleb128 .LVU3312
+.LLST339:
+	.byte	0x4
+	.uleb128 .LVL587-.Ltext0
+	.uleb128 .LVL588-.Ltext0
+	.uleb128 0x2
+	.byte	0x37
+	.byte	0x9f
+	.byte	0
+.LVUS340:
+	.uleb128 .LVU3321
+	.uleb128 .LVU3324
+.LLST340:
+	.byte	0x4
+	.uleb128 .LVL589-.Ltext0
+	.uleb128 .LVL590-.Ltext0
+	.uleb128 0x2
+	.byte	0x40
+	.byte	0x9f
+	.byte	0
+.LVUS341:
+	.uleb128 .LVU3331
+	.uleb128 .LVU3334
+.LLST341:
+	.byte	0x4
+	.uleb128 .LVL591-.Ltext0
+	.uleb128 .LVL592-.Ltext0
+	.uleb128 0x2
+	.byte	0x3c
+	.byte	0x9f
+	.byte	0
+.LVUS343:
+	.uleb128 .LVU3341
+	.uleb128 .LVU3345
+.LLST343:
+	.byte	0x4
+	.uleb128 .LVL593-.Ltext0
+	.uleb128 .LVL594-.Ltext0
+	.uleb128 0x2
+	.byte	0x38
+	.byte	0x9f
+	.byte	0
+.LVUS344:
+	.uleb128 .LVU3352
+	.uleb128 .LVU3354
+.LLST344:
+	.byte	0x4
+	.uleb128 .LVL595-.Ltext0
+	.uleb128 .LVL595-.Ltext0
+	.uleb128 0x2
+	.byte	0x37
+	.byte	0x9f
+	.byte	0
+.LVUS345:
+	.uleb128 .LVU3362
+	.uleb128 .LVU3365
+.LLST345:
+	.byte	0x4
+	.uleb128 .LVL596-.Ltext0
+	.uleb128 .LVL597-.Ltext0
+	.uleb128 0x1
+	.byte	0x58
+	.byte	0
+.LVUS346:
+	.uleb128 .LVU3362
+	.uleb128 .LVU3365
+.LLST346:
+	.byte	0x4
+	.uleb128 .LVL596-.Ltext0
+	.uleb128 .LVL597-.Ltext0
+	.uleb128 0x2
+	.byte	0x40
+	.byte	0x9f
+	.byte	0
+.LVUS347:
+	.uleb128 .LVU3372
+	.uleb128 .LVU3375
+.LLST347:
+	.byte	0x4
+	.uleb128 .LVL598-.Ltext0
+	.uleb128 .LVL599-.Ltext0
+	.uleb128 0x2
+	.byte	0x3c
+	.byte	0x9f
+	.byte	0
+.LVUS348:
+	.uleb128 .LVU3382
+	.uleb128 .LVU3385
+.LLST348:
+	.byte	0x4
+	.uleb128 .LVL600-.Ltext0
+	.uleb128 .LVL601-.Ltext0
+	.uleb128 0x2
+	.byte	0x38
+	.byte	0x9f
+	.byte	0
+.LVUS349:
+	.uleb128 .LVU3392
+	.uleb128 .LVU3394
+.LLST349:
+	.byte	0x4
+	.uleb128 .LVL602-.Ltext0
+	.uleb128 .LVL602-.Ltext0
+	.uleb128 0x2
+	.byte	0x37
+	.byte	0x9f
+	.byte	0
+.LVUS350:
+	.uleb128 .LVU3403
+	.uleb128 .LVU3406
+.LLST350:
+	.byte	0x4
+	.uleb128 .LVL603-.Ltext0
+	.uleb128 .LVL604-.Ltext0
+	.uleb128 0x2
+	.byte	0x40
+	.byte	0x9f
+	.byte	0
+.LVUS351:
+	.uleb128 .LVU3413
+	.uleb128 .LVU3416
+.LLST351:
+	.byte	0x4
+	.uleb128 .LVL605-.Ltext0
+	.uleb128 .LVL606-.Ltext0
+	.uleb128 0x2
+	.byte	0x3c
+	.byte	0x9f
+	.byte	0
+.LVUS353:
+	.uleb128 .LVU3423
+	.uleb128 .LVU3427
+.LLST353:
+	.byte	0x4
+	.uleb128 .LVL607-.Ltext0
+	.uleb128 .LVL608-.Ltext0
+	.uleb128 0x2
+	.byte	0x38
+	.byte	0x9f
+	.byte	0
+.LVUS354:
+	.uleb128 .LVU3435
+	.uleb128 .LVU3437
+.LLST354:
+	.byte	0x4
+	.uleb128 .LVL609-.Ltext0
+	.uleb128 .LVL609-.Ltext0
+	.uleb128 0x2
+	.byte	0x37
+	.byte	0x9f
+	.byte	0
+.LVUS356:
+	.uleb128 .LVU3446
+	.uleb128 .LVU3450
+.LLST356:
+	.byte	0x4
+	.uleb128 .LVL610-.Ltext0
+	.uleb128 .LVL611-.Ltext0
+	.uleb128 0x2
+	.byte	0x40
+	.byte	0x9f
+	.byte	0
+.LVUS357:
+	.uleb128 .LVU3457
+	.uleb128 .LVU3460
+.LLST357:
+	.byte	0x4
+	.uleb128 .LVL612-.Ltext0
+	.uleb128 .LVL613-.Ltext0
+	.uleb128 0x1
+	.byte	0x52
+	.byte	0
+.LVUS358:
+	.uleb128 .LVU3457
+	.uleb128 .LVU3460
+.LLST358:
+	.byte	0x4
+	.uleb128 .LVL612-.Ltext0
+	.uleb128 .LVL613-.Ltext0
+	.uleb128 0x2
+	.byte	0x3c
+	.byte	0x9f
+	.byte	0
+.LVUS359:
+	.uleb128 .LVU3467
+	.uleb128 .LVU3470
+.LLST359:
+	.byte	0x4
+	.uleb128 .LVL614-.Ltext0
+	.uleb128 .LVL615-.Ltext0
+	.uleb128 0x2
+	.byte	0x38
+	.byte	0x9f
+	.byte	0
+.LVUS361:
+	.uleb128 .LVU3477
+	.uleb128 .LVU3479
+.LLST361:
+	.byte	0x4
+	.uleb128 .LVL616-.Ltext0
+	.uleb128 .LVL616-.Ltext0
+	.uleb128 0x2
+	.byte	0x37
+	.byte	0x9f
+	.byte	0
+.Ldebug_loc3:
+	.section	.debug_aranges,"",@progbits
+	.long	0x2c
+	.value	0x2
+	.long	.Ldebug_info0
+	.byte	0x8
+	.byte	0
+	.value	0
+	.value	0
+	.quad	.Ltext0
+	.quad	.Letext0-.Ltext0
+	.quad	0
+	.quad	0
+	.section	.debug_rnglists,"",@progbits
+.Ldebug_ranges0:
+	.long	.Ldebug_ranges3-.Ldebug_ranges2
+.Ldebug_ranges2:
+	.value	0x5
+	.byte	0x8
+	.byte	0
+	.long	0
+.LLRL2:
+	.byte	0x4
+	.uleb128 .LBB1297-.Ltext0
+	.uleb128 .LBE1297-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB1300-.Ltext0
+	.uleb128 .LBE1300-.Ltext0
+	.byte	0
+.LLRL13:
+	.byte	0x4
+	.uleb128 .LBB1315-.Ltext0
+	.uleb128 .LBE1315-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB1318-.Ltext0
+	.uleb128 .LBE1318-.Ltext0
+	.byte	0
+.LLRL16:
+	.byte	0x4
+	.uleb128 .LBB1319-.Ltext0
+	.uleb128 .LBE1319-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB1322-.Ltext0
+	.uleb128 .LBE1322-.Ltext0
+	.byte	0
+.LLRL49:
+	.byte	0x4
+	.uleb128 .LBB1381-.Ltext0
+	.uleb128 .LBE1381-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB1384-.Ltext0
+	.uleb128 .LBE1384-.Ltext0
+	.byte	0
+.LLRL96:
+	.byte	0x4
+	.uleb128 .LBB1471-.Ltext0
+	.uleb128 .LBE1471-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB1474-.Ltext0
+	.uleb128 .LBE1474-.Ltext0
+	.byte	0
+.LLRL121:
+	.byte	0x4
+	.uleb128 .LBB1521-.Ltext0
+	.uleb128 .LBE1521-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB1524-.Ltext0
+	.uleb128 .LBE1524-.Ltext0
+	.byte	0
+.LLRL134:
+	.byte	0x4
+	.uleb128 .LBB1545-.Ltext0
+	.uleb128 .LBE1545-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB1548-.Ltext0
+	.uleb128 .LBE1548-.Ltext0
+	.byte	0
+.LLRL170:
+	.byte	0x4
+	.uleb128 .LBB1615-.Ltext0
+	.uleb128 .LBE1615-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB1618-.Ltext0
+	.uleb128 .LBE1618-.Ltext0
+	.byte	0
+.LLRL183:
+	.byte	0x4
+	.uleb128 .LBB1639-.Ltext0
+	.uleb128 .LBE1639-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB1642-.Ltext0
+	.uleb128 .LBE1642-.Ltext0
+	.byte	0
+.LLRL209:
+	.byte	0x4
+	.uleb128 .LBB1689-.Ltext0
+	.uleb128 .LBE1689-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB1692-.Ltext0
+	.uleb128 .LBE1692-.Ltext0
+	.byte	0
+.LLRL221:
+	.byte	0x4
+	.uleb128 .LBB1713-.Ltext0
+	.uleb128 .LBE1713-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB1716-.Ltext0
+	.uleb128 .LBE1716-.Ltext0
+	.byte	0
+.LLRL257:
+	.byte	0x4
+	.uleb128 .LBB1783-.Ltext0
+	.uleb128 .LBE1783-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB1786-.Ltext0
+	.uleb128 .LBE1786-.Ltext0
+	.byte	0
+.LLRL271:
+	.byte	0x4
+	.uleb128 .LBB1807-.Ltext0
+	.uleb128 .LBE1807-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB1810-.Ltext0
+	.uleb128 .LBE1810-.Ltext0
+	.byte	0
+.LLRL297:
+	.byte	0x4
+	.uleb128 .LBB1859-.Ltext0
+	.uleb128 .LBE1859-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB1862-.Ltext0
+	.uleb128 .LBE1862-.Ltext0
+	.byte	0
+.LLRL314:
+	.byte	0x4
+	.uleb128 .LBB1891-.Ltext0
+	.uleb128 .LBE1891-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB1894-.Ltext0
+	.uleb128 .LBE1894-.Ltext0
+	.byte	0
+.LLRL326:
+	.byte	0x4
+	.uleb128 .LBB1913-.Ltext0
+	.uleb128 .LBE1913-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB1916-.Ltext0
+	.uleb128 .LBE1916-.Ltext0
+	.byte	0
+.LLRL331:
+	.byte	0x4
+	.uleb128 .LBB1923-.Ltext0
+	.uleb128 .LBE1923-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB1926-.Ltext0
+	.uleb128 .LBE1926-.Ltext0
+	.byte	0
+.LLRL342:
+	.byte	0x4
+	.uleb128 .LBB1943-.Ltext0
+	.uleb128 .LBE1943-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB1946-.Ltext0
+	.uleb128 .LBE1946-.Ltext0
+	.byte	0
+.LLRL352:
+	.byte	0x4
+	.uleb128 .LBB1961-.Ltext0
+	.uleb128 .LBE1961-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB1964-.Ltext0
+	.uleb128 .LBE1964-.Ltext0
+	.byte	0
+.LLRL355:
+	.byte	0x4
+	.uleb128 .LBB1967-.Ltext0
+	.uleb128 .LBE1967-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB1970-.Ltext0
+	.uleb128 .LBE1970-.Ltext0
+	.byte	0
+.LLRL360:
+	.byte	0x4
+	.uleb128 .LBB1975-.Ltext0
+	.uleb128 .LBE1975-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB1979-.Ltext0
+	.uleb128 .LBE1979-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB1980-.Ltext0
+	.uleb128 .LBE1980-.Ltext0
+	.byte	0
+.LLRL364:
+	.byte	0x4
+	.uleb128 .LBB1990-.Ltext0
+	.uleb128 .LBE1990-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB2016-.Ltext0
+	.uleb128 .LBE2016-.Ltext0
+	.byte	0
+.LLRL369:
+	.byte	0x4
+	.uleb128 .LBB1992-.Ltext0
+	.uleb128 .LBE1992-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB2000-.Ltext0
+	.uleb128 .LBE2000-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB2006-.Ltext0
+	.uleb128 .LBE2006-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB2008-.Ltext0
+	.uleb128 .LBE2008-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB2010-.Ltext0
+	.uleb128 .LBE2010-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB2011-.Ltext0
+	.uleb128 .LBE2011-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB2012-.Ltext0
+	.uleb128 .LBE2012-.Ltext0
+	.byte	0
+.LLRL376:
+	.byte	0x4
+	.uleb128 .LBB2001-.Ltext0
+	.uleb128 .LBE2001-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB2007-.Ltext0
+	.uleb128 .LBE2007-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB2009-.Ltext0
+	.uleb128 .LBE2009-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB2013-.Ltext0
+	.uleb128 .LBE2013-.Ltext0
+	.byte	0
+.LLRL383:
+	.byte	0x4
+	.uleb128 .LBB2030-.Ltext0
+	.uleb128 .LBE2030-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB2034-.Ltext0
+	.uleb128 .LBE2034-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB2035-.Ltext0
+	.uleb128 .LBE2035-.Ltext0
+	.byte	0
+.LLRL390:
+	.byte	0x4
+	.uleb128 .LBB2036-.Ltext0
+	.uleb128 .LBE2036-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB2101-.Ltext0
+	.uleb128 .LBE2101-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB2102-.Ltext0
+	.uleb128 .LBE2102-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB2103-.Ltext0
+	.uleb128 .LBE2103-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB2104-.Ltext0
+	.uleb128 .LBE2104-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB2105-.Ltext0
+	.uleb128 .LBE2105-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB2106-.Ltext0
+	.uleb128 .LBE2106-.Ltext0
+	.byte	0
+.LLRL395:
+	.byte	0x4
+	.uleb128 .LBB2038-.Ltext0
+	.uleb128 .LBE2038-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB2085-.Ltext0
+	.uleb128 .LBE2085-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB2087-.Ltext0
+	.uleb128 .LBE2087-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB2091-.Ltext0
+	.uleb128 .LBE2091-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB2092-.Ltext0
+	.uleb128 .LBE2092-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB2093-.Ltext0
+	.uleb128 .LBE2093-.Ltext0
+	.byte	0
+.LLRL397:
+	.byte	0x4
+	.uleb128 .LBB2045-.Ltext0
+	.uleb128 .LBE2045-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB2084-.Ltext0
+	.uleb128 .LBE2084-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB2086-.Ltext0
+	.uleb128 .LBE2086-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB2088-.Ltext0
+	.uleb128 .LBE2088-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB2089-.Ltext0
+	.uleb128 .LBE2089-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB2090-.Ltext0
+	.uleb128 .LBE2090-.Ltext0
+	.byte	0
+.LLRL404:
+	.byte	0x4
+	.uleb128 .LBB2047-.Ltext0
+	.uleb128 .LBE2047-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB2064-.Ltext0
+	.uleb128 .LBE2064-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB2065-.Ltext0
+	.uleb128 .LBE2065-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB2066-.Ltext0
+	.uleb128 .LBE2066-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB2067-.Ltext0
+	.uleb128 .LBE2067-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB2068-.Ltext0
+	.uleb128 .LBE2068-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB2069-.Ltext0
+	.uleb128 .LBE2069-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB2070-.Ltext0
+	.uleb128 .LBE2070-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB2071-.Ltext0
+	.uleb128 .LBE2071-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB2072-.Ltext0
+	.uleb128 .LBE2072-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB2073-.Ltext0
+	.uleb128 .LBE2073-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB2074-.Ltext0
+	.uleb128 .LBE2074-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB2075-.Ltext0
+	.uleb128 .LBE2075-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB2076-.Ltext0
+	.uleb128 .LBE2076-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB2077-.Ltext0
+	.uleb128 .LBE2077-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB2078-.Ltext0
+	.uleb128 .LBE2078-.Ltext0
+	.byte	0
+.Ldebug_ranges3:
+	.section	.debug_line,"",@progbits
+.Ldebug_line0:
+	.section	.debug_str,"MS",@progbits,1
+.LASF31:
+	.string	"butil_copy_words"
+.LASF9:
+	.string	"__uint8_t"
+.LASF16:
+	.string	"digest_len"
+.LASF2:
+	.string	"long int"
+.LASF10:
+	.string	"short int"
+.LASF21:
+	.string	"blake2s_sigma"
+.LASF25:
+	.string	"blake2s_block"
+.LASF23:
+	.string	"blake2s_compress_blocks_generic"
+.LASF27:
+	.string	"butil_le32_copy"
+.LASF3:
+	.string	"long unsigned int"
+.LASF5:
+	.string	"short unsigned int"
+.LASF8:
+	.string	"size_t"
+.LASF22:
+	.string	"nblocks"
+.LASF15:
+	.string	"buf_len"
+.LASF32:
+	.string	"read_le32"
+.LASF29:
+	.string	"udst"
+.LASF4:
+	.string	"unsigned char"
+.LASF11:
+	.string	"__uint32_t"
+.LASF17:
+	.string	"last_node"
+.LASF6:
+	.string	"unsigned int"
+.LASF18:
+	.string	"long long unsigned int"
+.LASF13:
+	.string	"uint8_t"
+.LASF20:
+	.string	"blake2s_iv"
+.LASF24:
+	.string	"blake2s_compress_generic"
+.LASF19:
+	.string	"long long int"
+.LASF12:
+	.string	"char"
+.LASF35:
+	.string	"GNU C99 12.2.0 -mtune=generic -march=x86-64 -g -O3 -std=c99 -fasynchronous-unwind-tables"
+.LASF14:
+	.string	"uint32_t"
+.LASF26:
+	.string	"blake2s_10rounds"
+.LASF33:
+	.string	"to_le32"
+.LASF28:
+	.string	"bytes"
+.LASF36:
+	.string	"blake2s_ctx"
+.LASF7:
+	.string	"signed char"
+.LASF34:
+	.string	"_one"
+.LASF30:
+	.string	"usrc"
+	.section	.debug_line_str,"MS",@progbits,1
+.LASF1:
+	.string	"/root/repo"
+.LASF0:
+	.string	"blake2s-generic.c"
+	.ident	"GCC: (Debian 12.2.0-14+deb12u1) 12.2.0"
+	.section	.note.GNU-stack,"",@progbits
@@ -1,6 +1,9 @@
 #ifndef BLAKE2S_INTERNAL_H_
 #define BLAKE2S_INTERNAL_H_
 
+#include <string.h>
+#include <sys/types.h>
+
 typedef uint8_t  u8;
 typedef uint32_t u32;
 
@@ -23,7 +26,187 @@ static const u8 blake2s_sigma[10][16] =
   { 10,  2,  8,  4,  7,  6,  1,  5, 15, 11,  9, 14,  3, 12, 13 , 0 },
 };
 
-void blake2s_compress(struct blake2s_ctx *ctx, const void *m);
+/* Multi-buffer kernels compress one block for each of up to `lanes`
+ * independent states at once. The states are kept transposed: word i
+ * of lane l is at H[i][l], so each row is a vector. Lanes whose bit is
+ * clear in `mask` are left untouched, and their message pointer is not
+ * read.
+ */
+#define B2S_LANES_MAX 16
+
+struct blake2s_lanes {
+    u32 H[8][B2S_LANES_MAX];
+    u32 t[2][B2S_LANES_MAX];
+    u32 f[2][B2S_LANES_MAX];
+} ALIGN(64);
+
+/* A compression kernel: a single-block function and a multi-buffer one.
+ * compress_blocks() compresses `nblocks` consecutive non-final blocks,
+ * adding BLAKE2S_BLOCK to t before each, without going through memory
+ * for the state in between.
+ * `usable` is NULL if the kernel runs on any CPU of its architecture.
+ */
+struct blake2s_kernel {
+    const char *name;
+    int (*usable)(void);
+    void (*compress)(struct blake2s_ctx *ctx, const void *m);
+    void (*compress_blocks)(struct blake2s_ctx *ctx, const void *m,
+                            size_t nblocks);
+    unsigned lanes;
+    void (*compress_lanes)(struct blake2s_lanes *L, const void *m[],
+                           unsigned mask);
+};
+
+extern const struct blake2s_kernel *blake2s_kern;
+const struct blake2s_kernel *blake2s_kernel_get(unsigned i);
+
+/* kernels, see blake2s-kernel.c for which are built where */
+void blake2s_compress_generic(struct blake2s_ctx *ctx, const void *m);
+void blake2s_compress_altivec(struct blake2s_ctx *ctx, const void *m);
+void blake2s_compress_vec(struct blake2s_ctx *ctx, const void *m);
+void blake2s_compress_sse(struct blake2s_ctx *ctx, const void *m);
+void blake2s_compress_avx512vl(struct blake2s_ctx *ctx, const void *m);
+void blake2s_compress_blocks_generic(struct blake2s_ctx *ctx, const void *m,
+                                     size_t nblocks);
+void blake2s_compress_blocks_altivec(struct blake2s_ctx *ctx, const void *m,
+                                     size_t nblocks);
+void blake2s_compress_blocks_vec(struct blake2s_ctx *ctx, const void *m,
+                                 size_t nblocks);
+void blake2s_compress_blocks_sse(struct blake2s_ctx *ctx, const void *m,
+                                 size_t nblocks);
+void blake2s_compress_blocks_avx512vl(struct blake2s_ctx *ctx, const void *m,
+                                      size_t nblocks);
+void blake2s_compress_lanes_serial(struct blake2s_lanes *L, const void *m[],
+                                   unsigned mask);
+void blake2s_compress_lanes_avx2(struct blake2s_lanes *L, const void *m[],
+                                 unsigned mask);
+void blake2s_compress_lanes_avx512(struct blake2s_lanes *L, const void *m[],
+                                   unsigned mask);
+
+static inline void blake2s_compress(struct blake2s_ctx *ctx, const void *m)
+{
+    blake2s_kern->compress(ctx, m);
+}
+
+static inline void blake2s_compress_blocks(struct blake2s_ctx *ctx,
+                                           const void *m, size_t nblocks)
+{
+    blake2s_kern->compress_blocks(ctx, m, nblocks);
+}
+
+static inline void blake2s_compress_lanes(struct blake2s_lanes *L,
+                                          const void *m[], unsigned mask)
+{
+    blake2s_kern->compress_lanes(L, m, mask);
+}
+
+
+/* Parameter block words 0-3; words 4-7 are salt and personalization.
+ * Word 0: digest length, key length, fanout, depth
+ * Word 1: leaf length
+ * Word 2: node offset
+ * Word 3: node offset (high 16 bits), node depth, inner length
+ */
+#define B2S_PARAM_WORDS 4
+#define LE32W(x,y,z,w) (u32)((x)|((y)<<8)|((z)<<16)|((w)<<24))
+#define B2S_PARAM3(off_hi,node_depth,inner_len) \
+    ((u32)(off_hi) | LE32W(0,0,node_depth,inner_len))
+
+/* blake2s_init_words: initialize with parameter words `P`, `salt` and
+ * `personal` (NULL for zeros), then absorb the key block if `key_len`
+ * is not 0. Parameters are not checked.
+ */
+void blake2s_init_words(struct blake2s_ctx *ctx, const u32 P[B2S_PARAM_WORDS],
+                        const void *salt, const void *personal,
+                        const void *key, unsigned key_len);
+
+/* Multi-buffer driver: absorb `len` bytes at `src` into `ctx`, then
+ * finish into `out`, or leave the context open if `out` is NULL.
+ * blake2s_lanes_run() runs `n` such jobs through the lanes of the
+ * current kernel; a context must not appear in two jobs of one call.
+ */
+struct blake2s_job {
+    struct blake2s_ctx *ctx;
+    const u8 *src;
+    size_t len;
+    unsigned char *out;
+};
+
+void blake2s_lanes_run(struct blake2s_job *job, size_t n);
+
+/* The steps of the driver, for a job loaded into lane `l`:
+ *
+ * blake2s_lane_next: pick the next block lane `l` compresses, and
+ * account for it in the lane's counter. Mirrors blake2s_update(), then
+ * blake2s_final() if the job has an output: sets *last when it is the
+ * final block. Returns NULL when an open job has been fully absorbed,
+ * or when a MAC of the empty message is ready to retire.
+ * blake2s_lane_retire: take the job out of lane `l`, storing its
+ * context, and its digest if it has an output.
+ */
+const void *blake2s_lane_next(struct blake2s_lanes *L, unsigned l,
+                              struct blake2s_job *lane, int *last);
+void blake2s_lane_retire(struct blake2s_lanes *L, unsigned l,
+                         struct blake2s_job *lane);
+
+/* File hashing engines for blake2s_file_ex(): hash `fd` from `off` up
+ * to `size` in reads of `chunk` bytes, rounded up to BLAKE2S_IO_ALIGN
+ * for an O_DIRECT `fd` if `direct`; or, for a negative `fd`, all of
+ * `stream`. They return 0, having hashed nothing, where they cannot
+ * run (no threads, no io_uring), and < 0 on error, with errno set.
+ */
+#define B2S_IO_ROUND(n) \
+    (((n) + BLAKE2S_IO_ALIGN - 1) & ~(size_t)(BLAKE2S_IO_ALIGN - 1))
+
+int blake2s_pipe_run(struct blake2s_ctx *ctx, FILE *stream, int fd,
+                     uint64_t off, uint64_t size, size_t chunk, int direct);
+int blake2s_uring_run(struct blake2s_ctx *ctx, int fd, uint64_t off,
+                      uint64_t size, size_t chunk, int direct);
+
+/* blake2s_file_finish: hash the rest of `stream` in reads of `chunk`
+ * bytes and finalize into `out`
+ * returns < 0 on error, with errno set */
+int blake2s_file_finish(struct blake2s_ctx *ctx, FILE *stream, size_t chunk,
+                        unsigned char *out);
+
+/* blake2s_pread: read `len` bytes at `off`, all of them unless at EOF
+ * returns the bytes read, < 0 on error */
+ssize_t blake2s_pread(int fd, void *buf, size_t len, uint64_t off);
+
+/* blake2s_pool_run: call fn(arg, i) for every i in [0, n) on up to
+ * `nthreads` threads of the persistent pool, the caller included, and
+ * return when all are done */
+void blake2s_pool_run(unsigned nthreads, size_t n,
+                      void (*fn)(void *arg, size_t i), void *arg);
+
+/* Move a context in and out of lane `l` of the transposed state */
+static inline void blane_load(struct blake2s_lanes *L, unsigned l,
+                              const struct blake2s_ctx *ctx)
+{
+    for (unsigned i = 0; i < 8; i++)
+        L->H[i][l] = ctx->H[i];
+    L->t[0][l] = ctx->t[0];
+    L->t[1][l] = ctx->t[1];
+    L->f[0][l] = ctx->f[0];
+    L->f[1][l] = ctx->f[1];
+}
+
+static inline void blane_store(const struct blake2s_lanes *L, unsigned l,
+                               struct blake2s_ctx *ctx)
+{
+    for (unsigned i = 0; i < 8; i++)
+        ctx->H[i] = L->H[i][l];
+    ctx->t[0] = L->t[0][l];
+    ctx->t[1] = L->t[1][l];
+    ctx->f[0] = L->f[0][l];
+    ctx->f[1] = L->f[1][l];
+}
+
+static inline void blane_inc_t(struct blake2s_lanes *L, unsigned l, size_t inc)
+{
+    L->t[0][l] += inc;
+    L->t[1][l] += (L->t[0][l] < inc);
+}
 
 
 static inline u32 to_le32(u32 x) {
@@ -32,7 +215,9 @@ static inline u32 to_le32(u32 x) {
     return ((x>>24) | (x<<24) | ((x>>8) & 0xff00) | ((x<<8) & 0xff0000));
 }
 static inline u32 read_le32(const unsigned char *x) {
-    return to_le32(*(u32 *)x);
+    u32 w;
+    memcpy(&w, x, sizeof(w)); /* any alignment */
+    return to_le32(w);
 }
 static inline void write_le32(unsigned char *y, u32 x) {
     *y++ = x & 0xff;
@@ -0,0 +1,209 @@
+#include <stdlib.h>
+#include <string.h>
+
+#include "blake2s.h"
+#include "blake2b.h"
+#include "blake2s-internal.h"
+#include "blake2b-internal.h"
+
+#if defined(__x86_64__) || defined(__i386__)
+#define B2S_X86 1
+#endif
+#if defined(__powerpc__) || defined(__ppc__)
+#define B2S_PPC 1
+#ifdef __linux__
+#include <sys/auxv.h>
+#include <asm/cputable.h>
+#endif
+#endif
+
+/* Runtime kernel selection
+ *
+ * Every kernel for the target architecture is linked in. At startup,
+ * the first usable one in blake2s_kernels[] (fastest first) is picked,
+ * unless the BLAKE2S_KERNEL environment variable names another one.
+ * BLAKE2b has its own list, and BLAKE2B_KERNEL.
+ */
+#define B2S_KERNEL_ENV "BLAKE2S_KERNEL"
+#define B2B_KERNEL_ENV "BLAKE2B_KERNEL"
+
+#ifdef B2S_X86
+static int cpu_has_sse41(void)
+{
+    __builtin_cpu_init();
+    return __builtin_cpu_supports("sse4.1");
+}
+static int cpu_has_avx2(void)
+{
+    __builtin_cpu_init();
+    return __builtin_cpu_supports("avx2");
+}
+static int cpu_has_avx512(void)
+{
+    __builtin_cpu_init();
+    return __builtin_cpu_supports("avx512f")
+        && __builtin_cpu_supports("avx512vl");
+}
+
+static const struct blake2s_kernel blake2s_kernel_avx512 = {
+    "avx512", cpu_has_avx512, blake2s_compress_avx512vl,
+    blake2s_compress_blocks_avx512vl,
+    16, blake2s_compress_lanes_avx512,
+};
+static const struct blake2s_kernel blake2s_kernel_avx2 = {
+    "avx2", cpu_has_avx2, blake2s_compress_sse,
+    blake2s_compress_blocks_sse,
+    8, blake2s_compress_lanes_avx2,
+};
+static const struct blake2s_kernel blake2s_kernel_sse = {
+    "sse", cpu_has_sse41, blake2s_compress_sse,
+    blake2s_compress_blocks_sse,
+    1, blake2s_compress_lanes_serial,
+};
+#endif
+
+#ifdef B2S_PPC
+#ifdef __linux__
+static int cpu_has_altivec(void)
+{
+    return !!(getauxval(AT_HWCAP) & PPC_FEATURE_HAS_ALTIVEC);
+}
+#else
+#define cpu_has_altivec NULL
+#endif
+
+static const struct blake2s_kernel blake2s_kernel_altivec = {
+    "altivec", cpu_has_altivec, blake2s_compress_altivec,
+    blake2s_compress_blocks_altivec,
+    1, blake2s_compress_lanes_serial,
+};
+#endif
+
+#ifdef __GNUC__
+static const struct blake2s_kernel blake2s_kernel_vec = {
+    "vector", NULL, blake2s_compress_vec,
+    blake2s_compress_blocks_vec,
+    1, blake2s_compress_lanes_serial,
+};
+#endif
+
+static const struct blake2s_kernel blake2s_kernel_generic = {
+    "generic", NULL, blake2s_compress_generic,
+    blake2s_compress_blocks_generic,
+    1, blake2s_compress_lanes_serial,
+};
+
+static const struct blake2s_kernel *const blake2s_kernels[] = {
+#ifdef B2S_X86
+    &blake2s_kernel_avx512,
+    &blake2s_kernel_avx2,
+    &blake2s_kernel_sse,
+#endif
+#ifdef B2S_PPC
+    &blake2s_kernel_altivec,
+#endif
+#ifdef __GNUC__
+    &blake2s_kernel_vec,
+#endif
+    &blake2s_kernel_generic,
+};
+
+#define B2S_NKERNELS (sizeof(blake2s_kernels)/sizeof(blake2s_kernels[0]))
+
+const struct blake2s_kernel *blake2s_kern = &blake2s_kernel_generic;
+
+/* BLAKE2b kernels, fastest first */
+#ifdef B2S_X86
+static const struct blake2b_kernel blake2b_kernel_avx2 = {
+    "avx2", cpu_has_avx2, blake2b_compress_avx2,
+    blake2b_compress_blocks_avx2,
+    4, blake2b_compress_lanes_avx2,
+};
+#endif
+
+static const struct blake2b_kernel blake2b_kernel_generic = {
+    "generic", NULL, blake2b_compress_generic,
+    blake2b_compress_blocks_generic,
+    1, blake2b_compress_lanes_serial,
+};
+
+static const struct blake2b_kernel *const blake2b_kernels[] = {
+#ifdef B2S_X86
+    &blake2b_kernel_avx2,
+#endif
+    &blake2b_kernel_generic,
+};
+
+#define B2B_NKERNELS (sizeof(blake2b_kernels)/sizeof(blake2b_kernels[0]))
+
+const struct blake2b_kernel *blake2b_kern = &blake2b_kernel_generic;
+
+const struct blake2s_kernel *blake2s_kernel_get(unsigned i)
+{
+    return i < B2S_NKERNELS ? blake2s_kernels[i] : NULL;
+}
+
+static int bkern_usable(const struct blake2s_kernel *k)
+{
+    return !k->usable || k->usable();
+}
+
+int blake2s_set_kernel(const char *name)
+{
+    for (unsigned i = 0; i < B2S_NKERNELS; i++) {
+        const struct blake2s_kernel *k = blake2s_kernels[i];
+        if (name && strcmp(name, k->name))
+            continue;
+        if (!bkern_usable(k)) {
+            if (name) return -1;
+            continue;
+        }
+        blake2s_kern = k;
+        return 0;
+    }
+    return -1;
+}
+
+const struct blake2b_kernel *blake2b_kernel_get(unsigned i)
+{
+    return i < B2B_NKERNELS ? blake2b_kernels[i] : NULL;
+}
+
+int blake2b_set_kernel(const char *name)
+{
+    for (unsigned i = 0; i < B2B_NKERNELS; i++) {
+        const struct blake2b_kernel *k = blake2b_kernels[i];
+        if (name && strcmp(name, k->name))
+            continue;
+        if (k->usable && !k->usable()) {
+            if (name) return -1;
+            continue;
+        }
+        blake2b_kern = k;
+        return 0;
+    }
+    return -1;
+}
+
+const char *blake2s_get_kernel(void)
+{
+    return blake2s_kern->name;
+}
+
+const char *blake2b_get_kernel(void)
+{
+    return blake2b_kern->name;
+}
+
+#ifdef __GNUC__
+__attribute__((constructor))
+static void bkern_select(void)
+{
+    const char *name = getenv(B2S_KERNEL_ENV);
+    if (!name || blake2s_set_kernel(name) < 0)
+        blake2s_set_kernel(NULL);
+    name = getenv(B2B_KERNEL_ENV);
+    if (!name || blake2b_set_kernel(name) < 0)
+        blake2b_set_kernel(NULL);
+}
+#endif
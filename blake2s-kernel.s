@@ -0,0 +1,3937 @@
+	.file	"blake2s-kernel.c"
+# GNU C99 (Debian 12.2.0-14+deb12u1) version 12.2.0 (x86_64-linux-gnu)
+#	compiled by GNU C version 12.2.0, GMP version 6.2.1, MPFR version 4.2.0, MPC version 1.3.1, isl version isl-0.25-GMP
+
+# GGC heuristics: --param ggc-min-expand=100 --param ggc-min-heapsize=131072
+# options passed: -mtune=generic -march=x86-64 -g -O3 -std=c99 -fasynchronous-unwind-tables
+	.text
+.Ltext0:
+	.file 0 "/root/repo" "blake2s-kernel.c"
+	.p2align 4
+	.type	cpu_has_sse41, @function
+cpu_has_sse41:
+.LFB30:
+	.file 1 "blake2s-kernel.c"
+	.loc 1 32 1 view -0
+	.cfi_startproc
+	.loc 1 33 5 view .LVU1
+# blake2s-kernel.c:32: {
+	.loc 1 32 1 is_stmt 0 view .LVU2
+	subq	$8, %rsp	#,
+	.cfi_def_cfa_offset 16
+# blake2s-kernel.c:33:     __builtin_cpu_init();
+	.loc 1 33 5 view .LVU3
+	call	__cpu_indicator_init@PLT	#
+.LVL0:
+	.loc 1 34 5 is_stmt 1 view .LVU4
+# blake2s-kernel.c:34:     return __builtin_cpu_supports("sse4.1");
+	.loc 1 34 12 is_stmt 0 view .LVU5
+	movq	__cpu_model@GOTPCREL(%rip), %rax	#, tmp88
+	movl	12(%rax), %eax	# __cpu_model.__cpu_features[0], __cpu_model.__cpu_features[0]
+# blake2s-kernel.c:35: }
+	.loc 1 35 1 view .LVU6
+	addq	$8, %rsp	#,
+	.cfi_def_cfa_offset 8
+# blake2s-kernel.c:34:     return __builtin_cpu_supports("sse4.1");
+	.loc 1 34 12 view .LVU7
+	andl	$128, %eax	#, tmp87
+# blake2s-kernel.c:35: }
+	.loc 1 35 1 view .LVU8
+	ret	
+	.cfi_endproc
+.LFE30:
+	.size	cpu_has_sse41, .-cpu_has_sse41
+	.p2align 4
+	.type	cpu_has_avx2, @function
+cpu_has_avx2:
+.LFB31:
+	.loc 1 37 1 is_stmt 1 view -0
+	.cfi_startproc
+	.loc 1 38 5 view .LVU10
+# blake2s-kernel.c:37: {
+	.loc 1 37 1 is_stmt 0 view .LVU11
+	subq	$8, %rsp	#,
+	.cfi_def_cfa_offset 16
+# blake2s-kernel.c:38:     __builtin_cpu_init();
+	.loc 1 38 5 view .LVU12
+	call	__cpu_indicator_init@PLT	#
+.LVL1:
+	.loc 1 39 5 is_stmt 1 view .LVU13
+# blake2s-kernel.c:39:     return __builtin_cpu_supports("avx2");
+	.loc 1 39 12 is_stmt 0 view .LVU14
+	movq	__cpu_model@GOTPCREL(%rip), %rax	#, tmp88
+	movl	12(%rax), %eax	# __cpu_model.__cpu_features[0], __cpu_model.__cpu_features[0]
+# blake2s-kernel.c:40: }
+	.loc 1 40 1 view .LVU15
+	addq	$8, %rsp	#,
+	.cfi_def_cfa_offset 8
+# blake2s-kernel.c:39:     return __builtin_cpu_supports("avx2");
+	.loc 1 39 12 view .LVU16
+	andl	$1024, %eax	#, tmp87
+# blake2s-kernel.c:40: }
+	.loc 1 40 1 view .LVU17
+	ret	
+	.cfi_endproc
+.LFE31:
+	.size	cpu_has_avx2, .-cpu_has_avx2
+	.p2align 4
+	.type	cpu_has_avx512, @function
+cpu_has_avx512:
+.LFB32:
+	.loc 1 42 1 is_stmt 1 view -0
+	.cfi_startproc
+	.loc 1 43 5 view .LVU19
+# blake2s-kernel.c:42: {
+	.loc 1 42 1 is_stmt 0 view .LVU20
+	subq	$8, %rsp	#,
+	.cfi_def_cfa_offset 16
+# blake2s-kernel.c:43:     __builtin_cpu_init();
+	.loc 1 43 5 view .LVU21
+	call	__cpu_indicator_init@PLT	#
+.LVL2:
+	.loc 1 44 5 is_stmt 1 view .LVU22
+# blake2s-kernel.c:45:         && __builtin_cpu_supports("avx512vl");
+	.loc 1 45 9 is_stmt 0 view .LVU23
+	movq	__cpu_model@GOTPCREL(%rip), %rax	#, tmp89
+	movl	12(%rax), %eax	# __cpu_model, __cpu_model
+	andl	$1081344, %eax	#, tmp90
+	cmpl	$1081344, %eax	#, tmp90
+	sete	%al	#, tmp92
+# blake2s-kernel.c:46: }
+	.loc 1 46 1 view .LVU24
+	addq	$8, %rsp	#,
+	.cfi_def_cfa_offset 8
+# blake2s-kernel.c:45:         && __builtin_cpu_supports("avx512vl");
+	.loc 1 45 9 view .LVU25
+	movzbl	%al, %eax	# tmp92, tmp92
+# blake2s-kernel.c:46: }
+	.loc 1 46 1 view .LVU26
+	ret	
+	.cfi_endproc
+.LFE32:
+	.size	cpu_has_avx512, .-cpu_has_avx512
+	.p2align 4
+	.globl	blake2s_kernel_get
+	.type	blake2s_kernel_get, @function
+blake2s_kernel_get:
+.LVL3:
+.LFB33:
+	.loc 1 142 1 is_stmt 1 view -0
+	.cfi_startproc
+	.loc 1 143 5 view .LVU28
+# blake2s-kernel.c:143:     return i < B2S_NKERNELS ? blake2s_kernels[i] : NULL;
+	.loc 1 143 90 is_stmt 0 view .LVU29
+	xorl	%eax, %eax	# <retval>
+	cmpl	$4, %edi	#, i
+	ja	.L8	#,
+# blake2s-kernel.c:143:     return i < B2S_NKERNELS ? blake2s_kernels[i] : NULL;
+	.loc 1 143 90 discriminator 1 view .LVU30
+	movl	%edi, %edi	# i, i
+	.loc 1 143 90 discriminator 1 view .LVU31
+	leaq	blake2s_kernels(%rip), %rax	#, tmp84
+	movq	(%rax,%rdi,8), %rax	# blake2s_kernels[i_2(D)], <retval>
+.LVL4:
+.L8:
+# blake2s-kernel.c:144: }
+	.loc 1 144 1 view .LVU32
+	ret	
+	.cfi_endproc
+.LFE33:
+	.size	blake2s_kernel_get, .-blake2s_kernel_get
+	.section	.rodata.str1.1,"aMS",@progbits,1
+.LC0:
+	.string	"avx512"
+.LC1:
+	.string	"avx2"
+.LC2:
+	.string	"sse"
+.LC3:
+	.string	"vector"
+.LC4:
+	.string	"generic"
+	.text
+	.p2align 4
+	.globl	blake2s_set_kernel
+	.type	blake2s_set_kernel, @function
+blake2s_set_kernel:
+.LVL5:
+.LFB35:
+	.loc 1 152 1 is_stmt 1 view -0
+	.cfi_startproc
+	.loc 1 153 5 view .LVU34
+.LBB6:
+	.loc 1 153 10 view .LVU35
+	.loc 1 153 28 view .LVU36
+.LBE6:
+# blake2s-kernel.c:152: {
+	.loc 1 152 1 is_stmt 0 view .LVU37
+	pushq	%r12	#
+	.cfi_def_cfa_offset 16
+	.cfi_offset 12, -16
+	pushq	%rbp	#
+	.cfi_def_cfa_offset 24
+	.cfi_offset 6, -24
+	pushq	%rbx	#
+	.cfi_def_cfa_offset 32
+	.cfi_offset 3, -32
+	testq	%rdi, %rdi	# name
+	je	.L35	#,
+.LBB18:
+.LBB7:
+# blake2s-kernel.c:155:         if (name && strcmp(name, k->name))
+	.loc 1 155 21 view .LVU38
+	leaq	.LC0(%rip), %rsi	#, tmp98
+	movq	%rdi, %rbx	# tmp109, name
+	.loc 1 154 9 is_stmt 1 view .LVU39
+.LVL6:
+	.loc 1 155 9 view .LVU40
+# blake2s-kernel.c:154:         const struct blake2s_kernel *k = blake2s_kernels[i];
+	.loc 1 154 38 is_stmt 0 view .LVU41
+	leaq	blake2s_kernel_avx512(%rip), %rbp	#, k
+# blake2s-kernel.c:155:         if (name && strcmp(name, k->name))
+	.loc 1 155 21 view .LVU42
+	call	strcmp@PLT	#
+.LVL7:
+# blake2s-kernel.c:155:         if (name && strcmp(name, k->name))
+	.loc 1 155 18 view .LVU43
+	testl	%eax, %eax	# tmp111
+	jne	.L36	#,
+.LVL8:
+.L18:
+	.loc 1 157 9 is_stmt 1 view .LVU44
+.LBB8:
+.LBI8:
+	.loc 1 146 12 view .LVU45
+.LBB9:
+	.loc 1 148 5 view .LVU46
+# blake2s-kernel.c:148:     return !k->usable || k->usable();
+	.loc 1 148 26 is_stmt 0 view .LVU47
+	call	*8(%rbp)	# k_37->usable
+.LVL9:
+# blake2s-kernel.c:148:     return !k->usable || k->usable();
+	.loc 1 148 23 view .LVU48
+	testl	%eax, %eax	# tmp116
+	je	.L17	#,
+.LVL10:
+.L15:
+	.loc 1 148 23 view .LVU49
+.LBE9:
+.LBE8:
+	.loc 1 161 9 is_stmt 1 view .LVU50
+.LBE7:
+.LBE18:
+# blake2s-kernel.c:165: }
+	.loc 1 165 1 is_stmt 0 view .LVU51
+	popq	%rbx	#
+	.cfi_remember_state
+	.cfi_def_cfa_offset 24
+.LBB19:
+.LBB12:
+# blake2s-kernel.c:161:         blake2s_kern = k;
+	.loc 1 161 22 view .LVU52
+	movq	%rbp, blake2s_kern(%rip)	# k, blake2s_kern
+	.loc 1 162 9 is_stmt 1 view .LVU53
+# blake2s-kernel.c:162:         return 0;
+	.loc 1 162 16 is_stmt 0 view .LVU54
+	xorl	%eax, %eax	# <retval>
+.LBE12:
+.LBE19:
+# blake2s-kernel.c:165: }
+	.loc 1 165 1 view .LVU55
+	popq	%rbp	#
+	.cfi_def_cfa_offset 16
+	popq	%r12	#
+	.cfi_def_cfa_offset 8
+	ret	
+.LVL11:
+	.p2align 4,,10
+	.p2align 3
+.L36:
+	.cfi_restore_state
+.LBB20:
+	.loc 1 153 85 is_stmt 1 view .LVU56
+	.loc 1 153 28 view .LVU57
+.LBB13:
+	.loc 1 154 9 view .LVU58
+	.loc 1 155 9 view .LVU59
+# blake2s-kernel.c:155:         if (name && strcmp(name, k->name))
+	.loc 1 155 21 is_stmt 0 view .LVU60
+	leaq	.LC1(%rip), %rsi	#, tmp100
+	movq	%rbx, %rdi	# name,
+# blake2s-kernel.c:154:         const struct blake2s_kernel *k = blake2s_kernels[i];
+	.loc 1 154 38 view .LVU61
+	leaq	blake2s_kernel_avx2(%rip), %rbp	#, k
+# blake2s-kernel.c:155:         if (name && strcmp(name, k->name))
+	.loc 1 155 21 view .LVU62
+	call	strcmp@PLT	#
+.LVL12:
+# blake2s-kernel.c:155:         if (name && strcmp(name, k->name))
+	.loc 1 155 18 view .LVU63
+	testl	%eax, %eax	# tmp112
+	je	.L18	#,
+.LBE13:
+	.loc 1 153 85 is_stmt 1 view .LVU64
+.LVL13:
+	.loc 1 153 28 view .LVU65
+.LBB14:
+	.loc 1 154 9 view .LVU66
+	.loc 1 155 9 view .LVU67
+# blake2s-kernel.c:155:         if (name && strcmp(name, k->name))
+	.loc 1 155 21 is_stmt 0 view .LVU68
+	leaq	.LC2(%rip), %rsi	#, tmp102
+	movq	%rbx, %rdi	# name,
+# blake2s-kernel.c:154:         const struct blake2s_kernel *k = blake2s_kernels[i];
+	.loc 1 154 38 view .LVU69
+	leaq	blake2s_kernel_sse(%rip), %rbp	#, k
+# blake2s-kernel.c:155:         if (name && strcmp(name, k->name))
+	.loc 1 155 21 view .LVU70
+	call	strcmp@PLT	#
+.LVL14:
+# blake2s-kernel.c:155:         if (name && strcmp(name, k->name))
+	.loc 1 155 18 view .LVU71
+	testl	%eax, %eax	# tmp113
+	je	.L18	#,
+.LBE14:
+	.loc 1 153 85 is_stmt 1 view .LVU72
+.LVL15:
+	.loc 1 153 28 view .LVU73
+.LBB15:
+	.loc 1 154 9 view .LVU74
+	.loc 1 155 9 view .LVU75
+# blake2s-kernel.c:155:         if (name && strcmp(name, k->name))
+	.loc 1 155 21 is_stmt 0 view .LVU76
+	leaq	.LC3(%rip), %rsi	#, tmp104
+	movq	%rbx, %rdi	# name,
+# blake2s-kernel.c:154:         const struct blake2s_kernel *k = blake2s_kernels[i];
+	.loc 1 154 38 view .LVU77
+	leaq	blake2s_kernel_vec(%rip), %rbp	#, k
+# blake2s-kernel.c:155:         if (name && strcmp(name, k->name))
+	.loc 1 155 21 view .LVU78
+	call	strcmp@PLT	#
+.LVL16:
+# blake2s-kernel.c:155:         if (name && strcmp(name, k->name))
+	.loc 1 155 18 view .LVU79
+	testl	%eax, %eax	# tmp114
+	je	.L15	#,
+.LBE15:
+	.loc 1 153 85 is_stmt 1 view .LVU80
+.LVL17:
+	.loc 1 153 28 view .LVU81
+.LBB16:
+	.loc 1 154 9 view .LVU82
+	.loc 1 155 9 view .LVU83
+# blake2s-kernel.c:155:         if (name && strcmp(name, k->name))
+	.loc 1 155 21 is_stmt 0 view .LVU84
+	leaq	.LC4(%rip), %rsi	#, tmp106
+	movq	%rbx, %rdi	# name,
+	call	strcmp@PLT	#
+.LVL18:
+# blake2s-kernel.c:155:         if (name && strcmp(name, k->name))
+	.loc 1 155 18 view .LVU85
+	testl	%eax, %eax	# tmp115
+	jne	.L17	#,
+# blake2s-kernel.c:154:         const struct blake2s_kernel *k = blake2s_kernels[i];
+	.loc 1 154 38 view .LVU86
+	leaq	blake2s_kernel_generic(%rip), %rbp	#, k
+	jmp	.L15	#
+.LVL19:
+	.p2align 4,,10
+	.p2align 3
+.L35:
+	.loc 1 154 38 view .LVU87
+	leaq	blake2s_kernels(%rip), %rbx	#, ivtmp.38
+	leaq	40(%rbx), %r12	#, _38
+.LVL20:
+.L16:
+	.loc 1 154 9 is_stmt 1 view .LVU88
+# blake2s-kernel.c:154:         const struct blake2s_kernel *k = blake2s_kernels[i];
+	.loc 1 154 38 is_stmt 0 view .LVU89
+	movq	(%rbx), %rbp	# MEM[(const struct blake2s_kernel * *)_35], k
+.LVL21:
+	.loc 1 155 9 is_stmt 1 view .LVU90
+	.loc 1 157 9 view .LVU91
+.LBB11:
+	.loc 1 146 12 view .LVU92
+.LBB10:
+	.loc 1 148 5 view .LVU93
+# blake2s-kernel.c:148:     return !k->usable || k->usable();
+	.loc 1 148 14 is_stmt 0 view .LVU94
+	movq	8(%rbp), %rax	# k_6->usable, _3
+# blake2s-kernel.c:148:     return !k->usable || k->usable();
+	.loc 1 148 23 view .LVU95
+	testq	%rax, %rax	# _3
+	je	.L15	#,
+# blake2s-kernel.c:148:     return !k->usable || k->usable();
+	.loc 1 148 26 view .LVU96
+	call	*%rax	# _3
+.LVL22:
+# blake2s-kernel.c:148:     return !k->usable || k->usable();
+	.loc 1 148 23 view .LVU97
+	testl	%eax, %eax	# tmp110
+	jne	.L15	#,
+.LVL23:
+	.loc 1 148 23 view .LVU98
+.LBE10:
+.LBE11:
+	.loc 1 158 13 is_stmt 1 view .LVU99
+.LBE16:
+	.loc 1 153 85 view .LVU100
+	.loc 1 153 28 view .LVU101
+	addq	$8, %rbx	#, ivtmp.38
+.LVL24:
+	.loc 1 153 28 is_stmt 0 view .LVU102
+	cmpq	%r12, %rbx	# _38, ivtmp.38
+	jne	.L16	#,
+.LVL25:
+.L17:
+	.loc 1 153 28 view .LVU103
+.LBE20:
+# blake2s-kernel.c:165: }
+	.loc 1 165 1 view .LVU104
+	popq	%rbx	#
+	.cfi_def_cfa_offset 24
+.LBB21:
+.LBB17:
+# blake2s-kernel.c:158:             if (name) return -1;
+	.loc 1 158 30 view .LVU105
+	movl	$-1, %eax	#, <retval>
+.LBE17:
+.LBE21:
+# blake2s-kernel.c:165: }
+	.loc 1 165 1 view .LVU106
+	popq	%rbp	#
+	.cfi_def_cfa_offset 16
+	popq	%r12	#
+	.cfi_def_cfa_offset 8
+	ret	
+	.cfi_endproc
+.LFE35:
+	.size	blake2s_set_kernel, .-blake2s_set_kernel
+	.p2align 4
+	.globl	blake2b_kernel_get
+	.type	blake2b_kernel_get, @function
+blake2b_kernel_get:
+.LVL26:
+.LFB36:
+	.loc 1 168 1 is_stmt 1 view -0
+	.cfi_startproc
+	.loc 1 169 5 view .LVU108
+# blake2s-kernel.c:169:     return i < B2B_NKERNELS ? blake2b_kernels[i] : NULL;
+	.loc 1 169 90 is_stmt 0 view .LVU109
+	xorl	%eax, %eax	# <retval>
+	cmpl	$1, %edi	#, i
+	ja	.L37	#,
+# blake2s-kernel.c:169:     return i < B2B_NKERNELS ? blake2b_kernels[i] : NULL;
+	.loc 1 169 90 discriminator 1 view .LVU110
+	movl	%edi, %edi	# i, i
+	.loc 1 169 90 discriminator 1 view .LVU111
+	leaq	blake2b_kernels(%rip), %rax	#, tmp84
+	movq	(%rax,%rdi,8), %rax	# blake2b_kernels[i_2(D)], <retval>
+.LVL27:
+.L37:
+# blake2s-kernel.c:170: }
+	.loc 1 170 1 view .LVU112
+	ret	
+	.cfi_endproc
+.LFE36:
+	.size	blake2b_kernel_get, .-blake2b_kernel_get
+	.p2align 4
+	.globl	blake2b_set_kernel
+	.type	blake2b_set_kernel, @function
+blake2b_set_kernel:
+.LVL28:
+.LFB37:
+	.loc 1 173 1 is_stmt 1 view -0
+	.cfi_startproc
+	.loc 1 174 5 view .LVU114
+.LBB22:
+	.loc 1 174 10 view .LVU115
+	.loc 1 174 28 view .LVU116
+.LBB23:
+	.loc 1 175 9 view .LVU117
+	.loc 1 176 9 view .LVU118
+.LBE23:
+.LBE22:
+# blake2s-kernel.c:173: {
+	.loc 1 173 1 is_stmt 0 view .LVU119
+	pushq	%rbx	#
+	.cfi_def_cfa_offset 16
+	.cfi_offset 3, -16
+.LBB28:
+.LBB24:
+# blake2s-kernel.c:176:         if (name && strcmp(name, k->name))
+	.loc 1 176 12 view .LVU120
+	testq	%rdi, %rdi	# name
+	je	.L55	#,
+# blake2s-kernel.c:176:         if (name && strcmp(name, k->name))
+	.loc 1 176 21 view .LVU121
+	leaq	.LC1(%rip), %rsi	#, tmp90
+	movq	%rdi, %rbx	# tmp94, name
+	call	strcmp@PLT	#
+.LVL29:
+# blake2s-kernel.c:176:         if (name && strcmp(name, k->name))
+	.loc 1 176 18 view .LVU122
+	testl	%eax, %eax	# tmp96
+	jne	.L44	#,
+	.loc 1 178 9 is_stmt 1 view .LVU123
+# blake2s-kernel.c:178:         if (k->usable && !k->usable()) {
+	.loc 1 178 27 is_stmt 0 view .LVU124
+	call	cpu_has_avx2	#
+.LVL30:
+# blake2s-kernel.c:178:         if (k->usable && !k->usable()) {
+	.loc 1 178 23 view .LVU125
+	testl	%eax, %eax	# tmp97
+	jne	.L46	#,
+.LVL31:
+.L45:
+# blake2s-kernel.c:179:             if (name) return -1;
+	.loc 1 179 30 view .LVU126
+	movl	$-1, %eax	#, <retval>
+.LBE24:
+.LBE28:
+# blake2s-kernel.c:186: }
+	.loc 1 186 1 view .LVU127
+	popq	%rbx	#
+	.cfi_remember_state
+	.cfi_def_cfa_offset 8
+.LVL32:
+	.loc 1 186 1 view .LVU128
+	ret	
+.LVL33:
+	.p2align 4,,10
+	.p2align 3
+.L44:
+	.cfi_restore_state
+.LBB29:
+	.loc 1 174 85 is_stmt 1 view .LVU129
+	.loc 1 174 28 view .LVU130
+.LBB25:
+	.loc 1 175 9 view .LVU131
+	.loc 1 176 9 view .LVU132
+# blake2s-kernel.c:176:         if (name && strcmp(name, k->name))
+	.loc 1 176 21 is_stmt 0 view .LVU133
+	leaq	.LC4(%rip), %rsi	#, tmp92
+	movq	%rbx, %rdi	# name,
+	call	strcmp@PLT	#
+.LVL34:
+# blake2s-kernel.c:176:         if (name && strcmp(name, k->name))
+	.loc 1 176 18 view .LVU134
+	testl	%eax, %eax	# tmp98
+	jne	.L45	#,
+.LVL35:
+.L42:
+# blake2s-kernel.c:175:         const struct blake2b_kernel *k = blake2b_kernels[i];
+	.loc 1 175 38 view .LVU135
+	leaq	blake2b_kernel_generic(%rip), %rax	#, k
+.L43:
+	.loc 1 182 9 is_stmt 1 view .LVU136
+# blake2s-kernel.c:182:         blake2b_kern = k;
+	.loc 1 182 22 is_stmt 0 view .LVU137
+	movq	%rax, blake2b_kern(%rip)	# k, blake2b_kern
+	.loc 1 183 9 is_stmt 1 view .LVU138
+.LBE25:
+.LBE29:
+# blake2s-kernel.c:186: }
+	.loc 1 186 1 is_stmt 0 view .LVU139
+	popq	%rbx	#
+	.cfi_remember_state
+	.cfi_def_cfa_offset 8
+.LBB30:
+.LBB26:
+# blake2s-kernel.c:183:         return 0;
+	.loc 1 183 16 view .LVU140
+	xorl	%eax, %eax	# <retval>
+.LBE26:
+.LBE30:
+# blake2s-kernel.c:186: }
+	.loc 1 186 1 view .LVU141
+	ret	
+.LVL36:
+	.p2align 4,,10
+	.p2align 3
+.L55:
+	.cfi_restore_state
+.LBB31:
+.LBB27:
+	.loc 1 178 9 is_stmt 1 view .LVU142
+# blake2s-kernel.c:178:         if (k->usable && !k->usable()) {
+	.loc 1 178 27 is_stmt 0 view .LVU143
+	call	cpu_has_avx2	#
+.LVL37:
+# blake2s-kernel.c:178:         if (k->usable && !k->usable()) {
+	.loc 1 178 23 view .LVU144
+	testl	%eax, %eax	# tmp95
+	je	.L42	#,
+.L46:
+# blake2s-kernel.c:175:         const struct blake2b_kernel *k = blake2b_kernels[i];
+	.loc 1 175 38 view .LVU145
+	leaq	blake2b_kernel_avx2(%rip), %rax	#, k
+	jmp	.L43	#
+.LBE27:
+.LBE31:
+	.cfi_endproc
+.LFE37:
+	.size	blake2b_set_kernel, .-blake2b_set_kernel
+	.p2align 4
+	.globl	blake2s_get_kernel
+	.type	blake2s_get_kernel, @function
+blake2s_get_kernel:
+.LFB38:
+	.loc 1 189 1 is_stmt 1 view -0
+	.cfi_startproc
+	.loc 1 190 5 view .LVU147
+# blake2s-kernel.c:190:     return blake2s_kern->name;
+	.loc 1 190 24 is_stmt 0 view .LVU148
+	movq	blake2s_kern(%rip), %rax	# blake2s_kern, blake2s_kern
+	movq	(%rax), %rax	# blake2s_kern.3_1->name, blake2s_kern.3_1->name
+# blake2s-kernel.c:191: }
+	.loc 1 191 1 view .LVU149
+	ret	
+	.cfi_endproc
+.LFE38:
+	.size	blake2s_get_kernel, .-blake2s_get_kernel
+	.p2align 4
+	.globl	blake2b_get_kernel
+	.type	blake2b_get_kernel, @function
+blake2b_get_kernel:
+.LFB39:
+	.loc 1 194 1 is_stmt 1 view -0
+	.cfi_startproc
+	.loc 1 195 5 view .LVU151
+# blake2s-kernel.c:195:     return blake2b_kern->name;
+	.loc 1 195 24 is_stmt 0 view .LVU152
+	movq	blake2b_kern(%rip), %rax	# blake2b_kern, blake2b_kern
+	movq	(%rax), %rax	# blake2b_kern.4_1->name, blake2b_kern.4_1->name
+# blake2s-kernel.c:196: }
+	.loc 1 196 1 view .LVU153
+	ret	
+	.cfi_endproc
+.LFE39:
+	.size	blake2b_get_kernel, .-blake2b_get_kernel
+	.section	.rodata.str1.1
+.LC5:
+	.string	"BLAKE2S_KERNEL"
+.LC6:
+	.string	"BLAKE2B_KERNEL"
+	.section	.text.startup,"ax",@progbits
+	.p2align 4
+	.type	bkern_select, @function
+bkern_select:
+.LFB40:
+	.loc 1 201 1 is_stmt 1 view -0
+	.cfi_startproc
+	.loc 1 202 5 view .LVU155
+# blake2s-kernel.c:201: {
+	.loc 1 201 1 is_stmt 0 view .LVU156
+	subq	$8, %rsp	#,
+	.cfi_def_cfa_offset 16
+# blake2s-kernel.c:202:     const char *name = getenv(B2S_KERNEL_ENV);
+	.loc 1 202 24 view .LVU157
+	leaq	.LC5(%rip), %rdi	#, tmp86
+	call	getenv@PLT	#
+.LVL38:
+	.loc 1 203 5 is_stmt 1 view .LVU158
+# blake2s-kernel.c:203:     if (!name || blake2s_set_kernel(name) < 0)
+	.loc 1 203 8 is_stmt 0 view .LVU159
+	testq	%rax, %rax	# name
+	je	.L61	#,
+	movq	%rax, %rdi	# tmp88, name
+# blake2s-kernel.c:203:     if (!name || blake2s_set_kernel(name) < 0)
+	.loc 1 203 18 discriminator 1 view .LVU160
+	call	blake2s_set_kernel	#
+.LVL39:
+# blake2s-kernel.c:203:     if (!name || blake2s_set_kernel(name) < 0)
+	.loc 1 203 15 discriminator 1 view .LVU161
+	testl	%eax, %eax	# tmp89
+	js	.L61	#,
+.L60:
+	.loc 1 205 5 is_stmt 1 view .LVU162
+# blake2s-kernel.c:205:     name = getenv(B2B_KERNEL_ENV);
+	.loc 1 205 12 is_stmt 0 view .LVU163
+	leaq	.LC6(%rip), %rdi	#, tmp87
+	call	getenv@PLT	#
+.LVL40:
+	movq	%rax, %rdi	# tmp90, name
+.LVL41:
+	.loc 1 206 5 is_stmt 1 view .LVU164
+# blake2s-kernel.c:206:     if (!name || blake2b_set_kernel(name) < 0)
+	.loc 1 206 8 is_stmt 0 view .LVU165
+	testq	%rax, %rax	# name
+	je	.L63	#,
+# blake2s-kernel.c:206:     if (!name || blake2b_set_kernel(name) < 0)
+	.loc 1 206 18 discriminator 1 view .LVU166
+	call	blake2b_set_kernel	#
+.LVL42:
+# blake2s-kernel.c:206:     if (!name || blake2b_set_kernel(name) < 0)
+	.loc 1 206 15 discriminator 1 view .LVU167
+	testl	%eax, %eax	# tmp91
+	js	.L63	#,
+# blake2s-kernel.c:208: }
+	.loc 1 208 1 view .LVU168
+	popq	%rax	#
+	.cfi_remember_state
+	.cfi_def_cfa_offset 8
+	ret	
+.L63:
+	.cfi_restore_state
+	.loc 1 207 9 is_stmt 1 view .LVU169
+	xorl	%edi, %edi	#
+# blake2s-kernel.c:208: }
+	.loc 1 208 1 is_stmt 0 view .LVU170
+	popq	%rdx	#
+	.cfi_remember_state
+	.cfi_def_cfa_offset 8
+# blake2s-kernel.c:207:         blake2b_set_kernel(NULL);
+	.loc 1 207 9 view .LVU171
+	jmp	blake2b_set_kernel	#
+.LVL43:
+.L61:
+	.cfi_restore_state
+	.loc 1 204 9 is_stmt 1 view .LVU172
+	xorl	%edi, %edi	#
+	call	blake2s_set_kernel	#
+.LVL44:
+	jmp	.L60	#
+	.cfi_endproc
+.LFE40:
+	.size	bkern_select, .-bkern_select
+	.section	.init_array,"aw"
+	.align 8
+	.quad	bkern_select
+	.globl	blake2b_kern
+	.section	.data.rel.local,"aw"
+	.align 8
+	.type	blake2b_kern, @object
+	.size	blake2b_kern, 8
+blake2b_kern:
+	.quad	blake2b_kernel_generic
+	.section	.data.rel.ro.local,"aw"
+	.align 16
+	.type	blake2b_kernels, @object
+	.size	blake2b_kernels, 16
+blake2b_kernels:
+	.quad	blake2b_kernel_avx2
+	.quad	blake2b_kernel_generic
+	.section	.data.rel.ro,"aw"
+	.align 32
+	.type	blake2b_kernel_generic, @object
+	.size	blake2b_kernel_generic, 48
+blake2b_kernel_generic:
+# name:
+	.quad	.LC4
+# usable:
+	.quad	0
+# compress:
+	.quad	blake2b_compress_generic
+# compress_blocks:
+	.quad	blake2b_compress_blocks_generic
+# lanes:
+	.long	1
+# compress_lanes:
+	.zero	4
+	.quad	blake2b_compress_lanes_serial
+	.align 32
+	.type	blake2b_kernel_avx2, @object
+	.size	blake2b_kernel_avx2, 48
+blake2b_kernel_avx2:
+# name:
+	.quad	.LC1
+# usable:
+	.quad	cpu_has_avx2
+# compress:
+	.quad	blake2b_compress_avx2
+# compress_blocks:
+	.quad	blake2b_compress_blocks_avx2
+# lanes:
+	.long	4
+# compress_lanes:
+	.zero	4
+	.quad	blake2b_compress_lanes_avx2
+	.globl	blake2s_kern
+	.section	.data.rel.local
+	.align 8
+	.type	blake2s_kern, @object
+	.size	blake2s_kern, 8
+blake2s_kern:
+	.quad	blake2s_kernel_generic
+	.section	.data.rel.ro.local
+	.align 32
+	.type	blake2s_kernels, @object
+	.size	blake2s_kernels, 40
+blake2s_kernels:
+	.quad	blake2s_kernel_avx512
+	.quad	blake2s_kernel_avx2
+	.quad	blake2s_kernel_sse
+	.quad	blake2s_kernel_vec
+	.quad	blake2s_kernel_generic
+	.section	.data.rel.ro
+	.align 32
+	.type	blake2s_kernel_generic, @object
+	.size	blake2s_kernel_generic, 48
+blake2s_kernel_generic:
+# name:
+	.quad	.LC4
+# usable:
+	.quad	0
+# compress:
+	.quad	blake2s_compress_generic
+# compress_blocks:
+	.quad	blake2s_compress_blocks_generic
+# lanes:
+	.long	1
+# compress_lanes:
+	.zero	4
+	.quad	blake2s_compress_lanes_serial
+	.align 32
+	.type	blake2s_kernel_vec, @object
+	.size	blake2s_kernel_vec, 48
+blake2s_kernel_vec:
+# name:
+	.quad	.LC3
+# usable:
+	.quad	0
+# compress:
+	.quad	blake2s_compress_vec
+# compress_blocks:
+	.quad	blake2s_compress_blocks_vec
+# lanes:
+	.long	1
+# compress_lanes:
+	.zero	4
+	.quad	blake2s_compress_lanes_serial
+	.align 32
+	.type	blake2s_kernel_sse, @object
+	.size	blake2s_kernel_sse, 48
+blake2s_kernel_sse:
+# name:
+	.quad	.LC2
+# usable:
+	.quad	cpu_has_sse41
+# compress:
+	.quad	blake2s_compress_sse
+# compress_blocks:
+	.quad	blake2s_compress_blocks_sse
+# lanes:
+	.long	1
+# compress_lanes:
+	.zero	4
+	.quad	blake2s_compress_lanes_serial
+	.align 32
+	.type	blake2s_kernel_avx2, @object
+	.size	blake2s_kernel_avx2, 48
+blake2s_kernel_avx2:
+# name:
+	.quad	.LC1
+# usable:
+	.quad	cpu_has_avx2
+# compress:
+	.quad	blake2s_compress_sse
+# compress_blocks:
+	.quad	blake2s_compress_blocks_sse
+# lanes:
+	.long	8
+# compress_lanes:
+	.zero	4
+	.quad	blake2s_compress_lanes_avx2
+	.align 32
+	.type	blake2s_kernel_avx512, @object
+	.size	blake2s_kernel_avx512, 48
+blake2s_kernel_avx512:
+# name:
+	.quad	.LC0
+# usable:
+	.quad	cpu_has_avx512
+# compress:
+	.quad	blake2s_compress_avx512vl
+# compress_blocks:
+	.quad	blake2s_compress_blocks_avx512vl
+# lanes:
+	.long	16
+# compress_lanes:
+	.zero	4
+	.quad	blake2s_compress_lanes_avx512
+	.text
+.Letext0:
+	.file 2 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stddef.h"
+	.file 3 "/usr/include/x86_64-linux-gnu/bits/types.h"
+	.file 4 "/usr/include/x86_64-linux-gnu/bits/stdint-uintn.h"
+	.file 5 "blake2s.h"
+	.file 6 "blake2b.h"
+	.file 7 "blake2s-internal.h"
+	.file 8 "blake2b-internal.h"
+	.file 9 "/usr/include/stdlib.h"
+	.file 10 "/usr/include/string.h"
+	.section	.debug_info,"",@progbits
+.Ldebug_info0:
+	.long	0xcf5
+	.value	0x5
+	.byte	0x1
+	.byte	0x8
+	.long	.Ldebug_abbrev0
+	.uleb128 0x20
+	.long	.LASF77
+	.byte	0xc
+	.long	.LASF0
+	.long	.LASF1
+	.long	.LLRL14
+	.quad	0
+	.long	.Ldebug_line0
+	.uleb128 0xd
+	.long	.LASF9
+	.byte	0x2
+	.byte	0xd6
+	.byte	0x1b
+	.long	0x36
+	.uleb128 0x9
+	.byte	0x8
+	.byte	0x7
+	.long	.LASF2
+	.uleb128 0x21
+	.byte	0x4
+	.byte	0x5
+	.string	"int"
+	.uleb128 0x9
+	.byte	0x8
+	.byte	0x5
+	.long	.LASF3
+	.uleb128 0x9
+	.byte	0x8
+	.byte	0x5
+	.long	.LASF4
+	.uleb128 0x5
+	.long	0x57
+	.uleb128 0x22
+	.uleb128 0x9
+	.byte	0x1
+	.byte	0x8
+	.long	.LASF5
+	.uleb128 0x9
+	.byte	0x2
+	.byte	0x7
+	.long	.LASF6
+	.uleb128 0x9
+	.byte	0x4
+	.byte	0x7
+	.long	.LASF7
+	.uleb128 0x9
+	.byte	0x1
+	.byte	0x6
+	.long	.LASF8
+	.uleb128 0xd
+	.long	.LASF10
+	.byte	0x3
+	.byte	0x26
+	.byte	0x17
+	.long	0x58
+	.uleb128 0x9
+	.byte	0x2
+	.byte	0x5
+	.long	.LASF11
+	.uleb128 0xd
+	.long	.LASF12
+	.byte	0x3
+	.byte	0x2a
+	.byte	0x16
+	.long	0x66
+	.uleb128 0xd
+	.long	.LASF13
+	.byte	0x3
+	.byte	0x2d
+	.byte	0x1b
+	.long	0x36
+	.uleb128 0x5
+	.long	0xa4
+	.uleb128 0x9
+	.byte	0x1
+	.byte	0x6
+	.long	.LASF14
+	.uleb128 0x8
+	.long	0xa4
+	.uleb128 0xd
+	.long	.LASF15
+	.byte	0x4
+	.byte	0x18
+	.byte	0x13
+	.long	0x74
+	.uleb128 0xd
+	.long	.LASF16
+	.byte	0x4
+	.byte	0x1a
+	.byte	0x14
+	.long	0x87
+	.uleb128 0xd
+	.long	.LASF17
+	.byte	0x4
+	.byte	0x1b
+	.byte	0x14
+	.long	0x93
+	.uleb128 0x23
+	.long	.LASF21
+	.byte	0x80
+	.byte	0x10
+	.byte	0x5
+	.byte	0xf7
+	.byte	0x8
+	.long	0x138
+	.uleb128 0xa
+	.string	"H"
+	.byte	0x5
+	.byte	0xf8
+	.byte	0xe
+	.long	0x138
+	.byte	0
+	.uleb128 0xa
+	.string	"buf"
+	.byte	0x5
+	.byte	0xf9
+	.byte	0x13
+	.long	0x148
+	.byte	0x20
+	.uleb128 0xa
+	.string	"t"
+	.byte	0x5
+	.byte	0xfa
+	.byte	0xe
+	.long	0x158
+	.byte	0x60
+	.uleb128 0xa
+	.string	"f"
+	.byte	0x5
+	.byte	0xfb
+	.byte	0xe
+	.long	0x158
+	.byte	0x68
+	.uleb128 0x3
+	.long	.LASF18
+	.byte	0x5
+	.byte	0xfc
+	.byte	0xe
+	.long	0x66
+	.byte	0x70
+	.uleb128 0x3
+	.long	.LASF19
+	.byte	0x5
+	.byte	0xfd
+	.byte	0xe
+	.long	0x66
+	.byte	0x74
+	.uleb128 0x3
+	.long	.LASF20
+	.byte	0x5
+	.byte	0xfe
+	.byte	0xe
+	.long	0x66
+	.byte	0x78
+	.byte	0
+	.uleb128 0x7
+	.long	0xbc
+	.long	0x148
+	.uleb128 0x2
+	.long	0x36
+	.byte	0x7
+	.byte	0
+	.uleb128 0x7
+	.long	0x58
+	.long	0x158
+	.uleb128 0x2
+	.long	0x36
+	.byte	0x3f
+	.byte	0
+	.uleb128 0x7
+	.long	0xbc
+	.long	0x168
+	.uleb128 0x2
+	.long	0x36
+	.byte	0x1
+	.byte	0
+	.uleb128 0x5
+	.long	0xd4
+	.uleb128 0x13
+	.long	.LASF22
+	.value	0x100
+	.byte	0x20
+	.byte	0x6
+	.byte	0x32
+	.long	0x1d1
+	.uleb128 0xa
+	.string	"H"
+	.byte	0x6
+	.byte	0x33
+	.byte	0xe
+	.long	0x1d1
+	.byte	0
+	.uleb128 0xa
+	.string	"buf"
+	.byte	0x6
+	.byte	0x34
+	.byte	0x13
+	.long	0x1e1
+	.byte	0x40
+	.uleb128 0xa
+	.string	"t"
+	.byte	0x6
+	.byte	0x35
+	.byte	0xe
+	.long	0x1f1
+	.byte	0xc0
+	.uleb128 0xa
+	.string	"f"
+	.byte	0x6
+	.byte	0x36
+	.byte	0xe
+	.long	0x1f1
+	.byte	0xd0
+	.uleb128 0x3
+	.long	.LASF18
+	.byte	0x6
+	.byte	0x37
+	.byte	0xe
+	.long	0x66
+	.byte	0xe0
+	.uleb128 0x3
+	.long	.LASF19
+	.byte	0x6
+	.byte	0x38
+	.byte	0xe
+	.long	0x66
+	.byte	0xe4
+	.uleb128 0x3
+	.long	.LASF20
+	.byte	0x6
+	.byte	0x39
+	.byte	0xe
+	.long	0x66
+	.byte	0xe8
+	.byte	0
+	.uleb128 0x7
+	.long	0xc8
+	.long	0x1e1
+	.uleb128 0x2
+	.long	0x36
+	.byte	0x7
+	.byte	0
+	.uleb128 0x7
+	.long	0x58
+	.long	0x1f1
+	.uleb128 0x2
+	.long	0x36
+	.byte	0x7f
+	.byte	0
+	.uleb128 0x7
+	.long	0xc8
+	.long	0x201
+	.uleb128 0x2
+	.long	0x36
+	.byte	0x1
+	.byte	0
+	.uleb128 0x9
+	.byte	0x8
+	.byte	0x7
+	.long	.LASF23
+	.uleb128 0x14
+	.string	"u8"
+	.byte	0x7
+	.byte	0x7
+	.byte	0x11
+	.long	0xb0
+	.uleb128 0x8
+	.long	0x208
+	.uleb128 0x14
+	.string	"u32"
+	.byte	0x7
+	.byte	0x8
+	.byte	0x12
+	.long	0xbc
+	.uleb128 0x8
+	.long	0x218
+	.uleb128 0x7
+	.long	0x224
+	.long	0x239
+	.uleb128 0x2
+	.long	0x36
+	.byte	0x7
+	.byte	0
+	.uleb128 0x8
+	.long	0x229
+	.uleb128 0x15
+	.long	.LASF24
+	.byte	0x7
+	.byte	0xa
+	.byte	0x12
+	.long	0x239
+	.byte	0x20
+	.byte	0x67
+	.byte	0xe6
+	.byte	0x9
+	.byte	0x6a
+	.byte	0x85
+	.byte	0xae
+	.byte	0x67
+	.byte	0xbb
+	.byte	0x72
+	.byte	0xf3
+	.byte	0x6e
+	.byte	0x3c
+	.byte	0x3a
+	.byte	0xf5
+	.byte	0x4f
+	.byte	0xa5
+	.byte	0x7f
+	.byte	0x52
+	.byte	0xe
+	.byte	0x51
+	.byte	0x8c
+	.byte	0x68
+	.byte	0x5
+	.byte	0x9b
+	.byte	0xab
+	.byte	0xd9
+	.byte	0x83
+	.byte	0x1f
+	.byte	0x19
+	.byte	0xcd
+	.byte	0xe0
+	.byte	0x5b
+	.uleb128 0x7
+	.long	0x213
+	.long	0x281
+	.uleb128 0x2
+	.long	0x36
+	.byte	0x9
+	.uleb128 0x2
+	.long	0x36
+	.byte	0xf
+	.byte	0
+	.uleb128 0x8
+	.long	0x26b
+	.uleb128 0x15
+	.long	.LASF25
+	.byte	0x7
+	.byte	0xf
+	.byte	0x11
+	.long	0x281
+	.byte	0xa0
+	.byte	0
+	.byte	0x1
+	.byte	0x2
+	.byte	0x3
+	.byte	0x4
+	.byte	0x5
+	.byte	0x6
+	.byte	0x7
+	.byte	0x8
+	.byte	0x9
+	.byte	0xa
+	.byte	0xb
+	.byte	0xc
+	.byte	0xd
+	.byte	0xe
+	.byte	0xf
+	.byte	0xe
+	.byte	0xa
+	.byte	0x4
+	.byte	0x8
+	.byte	0x9
+	.byte	0xf
+	.byte	0xd
+	.byte	0x6
+	.byte	0x1
+	.byte	0xc
+	.byte	0
+	.byte	0x2
+	.byte	0xb
+	.byte	0x7
+	.byte	0x5
+	.byte	0x3
+	.byte	0xb
+	.byte	0x8
+	.byte	0xc
+	.byte	0
+	.byte	0x5
+	.byte	0x2
+	.byte	0xf
+	.byte	0xd
+	.byte	0xa
+	.byte	0xe
+	.byte	0x3
+	.byte	0x6
+	.byte	0x7
+	.byte	0x1
+	.byte	0x9
+	.byte	0x4
+	.byte	0x7
+	.byte	0x9
+	.byte	0x3
+	.byte	0x1
+	.byte	0xd
+	.byte	0xc
+	.byte	0xb
+	.byte	0xe
+	.byte	0x2
+	.byte	0x6
+	.byte	0x5
+	.byte	0xa
+	.byte	0x4
+	.byte	0
+	.byte	0xf
+	.byte	0x8
+	.byte	0x9
+	.byte	0
+	.byte	0x5
+	.byte	0x7
+	.byte	0x2
+	.byte	0x4
+	.byte	0xa
+	.byte	0xf
+	.byte	0xe
+	.byte	0x1
+	.byte	0xb
+	.byte	0xc
+	.byte	0x6
+	.byte	0x8
+	.byte	0x3
+	.byte	0xd
+	.byte	0x2
+	.byte	0xc
+	.byte	0x6
+	.byte	0xa
+	.byte	0
+	.byte	0xb
+	.byte	0x8
+	.byte	0x3
+	.byte	0x4
+	.byte	0xd
+	.byte	0x7
+	.byte	0x5
+	.byte	0xf
+	.byte	0xe
+	.byte	0x1
+	.byte	0x9
+	.byte	0xc
+	.byte	0x5
+	.byte	0x1
+	.byte	0xf
+	.byte	0xe
+	.byte	0xd
+	.byte	0x4
+	.byte	0xa
+	.byte	0
+	.byte	0x7
+	.byte	0x6
+	.byte	0x3
+	.byte	0x9
+	.byte	0x2
+	.byte	0x8
+	.byte	0xb
+	.byte	0xd
+	.byte	0xb
+	.byte	0x7
+	.byte	0xe
+	.byte	0xc
+	.byte	0x1
+	.byte	0x3
+	.byte	0x9
+	.byte	0x5
+	.byte	0
+	.byte	0xf
+	.byte	0x4
+	.byte	0x8
+	.byte	0x6
+	.byte	0x2
+	.byte	0xa
+	.byte	0x6
+	.byte	0xf
+	.byte	0xe
+	.byte	0x9
+	.byte	0xb
+	.byte	0x3
+	.byte	0
+	.byte	0x8
+	.byte	0xc
+	.byte	0x2
+	.byte	0xd
+	.byte	0x7
+	.byte	0x1
+	.byte	0x4
+	.byte	0xa
+	.byte	0x5
+	.byte	0xa
+	.byte	0x2
+	.byte	0x8
+	.byte	0x4
+	.byte	0x7
+	.byte	0x6
+	.byte	0x1
+	.byte	0x5
+	.byte	0xf
+	.byte	0xb
+	.byte	0x9
+	.byte	0xe
+	.byte	0x3
+	.byte	0xc
+	.byte	0xd
+	.byte	0
+	.uleb128 0x13
+	.long	.LASF26
+	.value	0x300
+	.byte	0x40
+	.byte	0x7
+	.byte	0x25
+	.long	0x363
+	.uleb128 0xa
+	.string	"H"
+	.byte	0x7
+	.byte	0x26
+	.byte	0x9
+	.long	0x363
+	.byte	0
+	.uleb128 0x10
+	.string	"t"
+	.byte	0x7
+	.byte	0x27
+	.long	0x379
+	.value	0x200
+	.uleb128 0x10
+	.string	"f"
+	.byte	0x7
+	.byte	0x28
+	.long	0x379
+	.value	0x280
+	.byte	0
+	.uleb128 0x7
+	.long	0x218
+	.long	0x379
+	.uleb128 0x2
+	.long	0x36
+	.byte	0x7
+	.uleb128 0x2
+	.long	0x36
+	.byte	0xf
+	.byte	0
+	.uleb128 0x7
+	.long	0x218
+	.long	0x38f
+	.uleb128 0x2
+	.long	0x36
+	.byte	0x1
+	.uleb128 0x2
+	.long	0x36
+	.byte	0xf
+	.byte	0
+	.uleb128 0x19
+	.long	.LASF35
+	.byte	0x7
+	.byte	0x31
+	.long	0x3e9
+	.uleb128 0x3
+	.long	.LASF27
+	.byte	0x7
+	.byte	0x32
+	.byte	0x11
+	.long	0x3ee
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF28
+	.byte	0x7
+	.byte	0x33
+	.byte	0xb
+	.long	0x3f8
+	.byte	0x8
+	.uleb128 0x3
+	.long	.LASF29
+	.byte	0x7
+	.byte	0x34
+	.byte	0xc
+	.long	0x40d
+	.byte	0x10
+	.uleb128 0x3
+	.long	.LASF30
+	.byte	0x7
+	.byte	0x35
+	.byte	0xc
+	.long	0x427
+	.byte	0x18
+	.uleb128 0x3
+	.long	.LASF31
+	.byte	0x7
+	.byte	0x37
+	.byte	0xe
+	.long	0x66
+	.byte	0x20
+	.uleb128 0x3
+	.long	.LASF32
+	.byte	0x7
+	.byte	0x38
+	.byte	0xc
+	.long	0x44b
+	.byte	0x28
+	.byte	0
+	.uleb128 0x8
+	.long	0x38f
+	.uleb128 0x5
+	.long	0xab
+	.uleb128 0x24
+	.long	0x3d
+	.uleb128 0x5
+	.long	0x3f3
+	.uleb128 0xf
+	.long	0x40d
+	.uleb128 0x1
+	.long	0x168
+	.uleb128 0x1
+	.long	0x52
+	.byte	0
+	.uleb128 0x5
+	.long	0x3fd
+	.uleb128 0xf
+	.long	0x427
+	.uleb128 0x1
+	.long	0x168
+	.uleb128 0x1
+	.long	0x52
+	.uleb128 0x1
+	.long	0x2a
+	.byte	0
+	.uleb128 0x5
+	.long	0x412
+	.uleb128 0xf
+	.long	0x441
+	.uleb128 0x1
+	.long	0x441
+	.uleb128 0x1
+	.long	0x446
+	.uleb128 0x1
+	.long	0x66
+	.byte	0
+	.uleb128 0x5
+	.long	0x333
+	.uleb128 0x5
+	.long	0x52
+	.uleb128 0x5
+	.long	0x42c
+	.uleb128 0x1a
+	.long	.LASF37
+	.byte	0x7
+	.byte	0x3c
+	.long	0x45b
+	.uleb128 0x5
+	.long	0x3e9
+	.uleb128 0x8
+	.long	0x45b
+	.uleb128 0x14
+	.string	"u64"
+	.byte	0x8
+	.byte	0x6
+	.byte	0x12
+	.long	0xc8
+	.uleb128 0x8
+	.long	0x465
+	.uleb128 0x7
+	.long	0x471
+	.long	0x486
+	.uleb128 0x2
+	.long	0x36
+	.byte	0x7
+	.byte	0
+	.uleb128 0x8
+	.long	0x476
+	.uleb128 0x15
+	.long	.LASF33
+	.byte	0x8
+	.byte	0x8
+	.byte	0x12
+	.long	0x486
+	.byte	0x40
+	.byte	0x8
+	.byte	0xc9
+	.byte	0xbc
+	.byte	0xf3
+	.byte	0x67
+	.byte	0xe6
+	.byte	0x9
+	.byte	0x6a
+	.byte	0x3b
+	.byte	0xa7
+	.byte	0xca
+	.byte	0x84
+	.byte	0x85
+	.byte	0xae
+	.byte	0x67
+	.byte	0xbb
+	.byte	0x2b
+	.byte	0xf8
+	.byte	0x94
+	.byte	0xfe
+	.byte	0x72
+	.byte	0xf3
+	.byte	0x6e
+	.byte	0x3c
+	.byte	0xf1
+	.byte	0x36
+	.byte	0x1d
+	.byte	0x5f
+	.byte	0x3a
+	.byte	0xf5
+	.byte	0x4f
+	.byte	0xa5
+	.byte	0xd1
+	.byte	0x82
+	.byte	0xe6
+	.byte	0xad
+	.byte	0x7f
+	.byte	0x52
+	.byte	0xe
+	.byte	0x51
+	.byte	0x1f
+	.byte	0x6c
+	.byte	0x3e
+	.byte	0x2b
+	.byte	0x8c
+	.byte	0x68
+	.byte	0x5
+	.byte	0x9b
+	.byte	0x6b
+	.byte	0xbd
+	.byte	0x41
+	.byte	0xfb
+	.byte	0xab
+	.byte	0xd9
+	.byte	0x83
+	.byte	0x1f
+	.byte	0x79
+	.byte	0x21
+	.byte	0x7e
+	.byte	0x13
+	.byte	0x19
+	.byte	0xcd
+	.byte	0xe0
+	.byte	0x5b
+	.uleb128 0x13
+	.long	.LASF34
+	.value	0x180
+	.byte	0x20
+	.byte	0x8
+	.byte	0x25
+	.long	0x508
+	.uleb128 0xa
+	.string	"H"
+	.byte	0x8
+	.byte	0x26
+	.byte	0x9
+	.long	0x508
+	.byte	0
+	.uleb128 0x10
+	.string	"t"
+	.byte	0x8
+	.byte	0x27
+	.long	0x51e
+	.value	0x100
+	.uleb128 0x10
+	.string	"f"
+	.byte	0x8
+	.byte	0x28
+	.long	0x51e
+	.value	0x140
+	.byte	0
+	.uleb128 0x7
+	.long	0x465
+	.long	0x51e
+	.uleb128 0x2
+	.long	0x36
+	.byte	0x7
+	.uleb128 0x2
+	.long	0x36
+	.byte	0x3
+	.byte	0
+	.uleb128 0x7
+	.long	0x465
+	.long	0x534
+	.uleb128 0x2
+	.long	0x36
+	.byte	0x1
+	.uleb128 0x2
+	.long	0x36
+	.byte	0x3
+	.byte	0
+	.uleb128 0x19
+	.long	.LASF36
+	.byte	0x8
+	.byte	0x2c
+	.long	0x58e
+	.uleb128 0x3
+	.long	.LASF27
+	.byte	0x8
+	.byte	0x2d
+	.byte	0x11
+	.long	0x3ee
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF28
+	.byte	0x8
+	.byte	0x2e
+	.byte	0xb
+	.long	0x3f8
+	.byte	0x8
+	.uleb128 0x3
+	.long	.LASF29
+	.byte	0x8
+	.byte	0x2f
+	.byte	0xc
+	.long	0x5a8
+	.byte	0x10
+	.uleb128 0x3
+	.long	.LASF30
+	.byte	0x8
+	.byte	0x30
+	.byte	0xc
+	.long	0x5c2
+	.byte	0x18
+	.uleb128 0x3
+	.long	.LASF31
+	.byte	0x8
+	.byte	0x32
+	.byte	0xe
+	.long	0x66
+	.byte	0x20
+	.uleb128 0x3
+	.long	.LASF32
+	.byte	0x8
+	.byte	0x33
+	.byte	0xc
+	.long	0x5e1
+	.byte	0x28
+	.byte	0
+	.uleb128 0x8
+	.long	0x534
+	.uleb128 0xf
+	.long	0x5a3
+	.uleb128 0x1
+	.long	0x5a3
+	.uleb128 0x1
+	.long	0x52
+	.byte	0
+	.uleb128 0x5
+	.long	0x16d
+	.uleb128 0x5
+	.long	0x593
+	.uleb128 0xf
+	.long	0x5c2
+	.uleb128 0x1
+	.long	0x5a3
+	.uleb128 0x1
+	.long	0x52
+	.uleb128 0x1
+	.long	0x2a
+	.byte	0
+	.uleb128 0x5
+	.long	0x5ad
+	.uleb128 0xf
+	.long	0x5dc
+	.uleb128 0x1
+	.long	0x5dc
+	.uleb128 0x1
+	.long	0x446
+	.uleb128 0x1
+	.long	0x66
+	.byte	0
+	.uleb128 0x5
+	.long	0x4d8
+	.uleb128 0x5
+	.long	0x5c7
+	.uleb128 0x1a
+	.long	.LASF38
+	.byte	0x8
+	.byte	0x37
+	.long	0x5f1
+	.uleb128 0x5
+	.long	0x58e
+	.uleb128 0x8
+	.long	0x5f1
+	.uleb128 0xb
+	.long	.LASF39
+	.byte	0x30
+	.byte	0x24
+	.long	0x3e9
+	.uleb128 0x9
+	.byte	0x3
+	.quad	blake2s_kernel_avx512
+	.uleb128 0xb
+	.long	.LASF40
+	.byte	0x35
+	.byte	0x24
+	.long	0x3e9
+	.uleb128 0x9
+	.byte	0x3
+	.quad	blake2s_kernel_avx2
+	.uleb128 0xb
+	.long	.LASF41
+	.byte	0x3a
+	.byte	0x24
+	.long	0x3e9
+	.uleb128 0x9
+	.byte	0x3
+	.quad	blake2s_kernel_sse
+	.uleb128 0xb
+	.long	.LASF42
+	.byte	0x53
+	.byte	0x24
+	.long	0x3e9
+	.uleb128 0x9
+	.byte	0x3
+	.quad	blake2s_kernel_vec
+	.uleb128 0xb
+	.long	.LASF43
+	.byte	0x5a
+	.byte	0x24
+	.long	0x3e9
+	.uleb128 0x9
+	.byte	0x3
+	.quad	blake2s_kernel_generic
+	.uleb128 0x7
+	.long	0x460
+	.long	0x674
+	.uleb128 0x2
+	.long	0x36
+	.byte	0x4
+	.byte	0
+	.uleb128 0x8
+	.long	0x664
+	.uleb128 0xb
+	.long	.LASF44
+	.byte	0x60
+	.byte	0x2b
+	.long	0x674
+	.uleb128 0x9
+	.byte	0x3
+	.quad	blake2s_kernels
+	.uleb128 0x1b
+	.long	0x450
+	.byte	0x71
+	.uleb128 0x9
+	.byte	0x3
+	.quad	blake2s_kern
+	.uleb128 0xb
+	.long	.LASF45
+	.byte	0x75
+	.byte	0x24
+	.long	0x58e
+	.uleb128 0x9
+	.byte	0x3
+	.quad	blake2b_kernel_avx2
+	.uleb128 0xb
+	.long	.LASF46
+	.byte	0x7c
+	.byte	0x24
+	.long	0x58e
+	.uleb128 0x9
+	.byte	0x3
+	.quad	blake2b_kernel_generic
+	.uleb128 0x7
+	.long	0x5f6
+	.long	0x6d8
+	.uleb128 0x2
+	.long	0x36
+	.byte	0x1
+	.byte	0
+	.uleb128 0x8
+	.long	0x6c8
+	.uleb128 0xb
+	.long	.LASF47
+	.byte	0x82
+	.byte	0x2b
+	.long	0x6d8
+	.uleb128 0x9
+	.byte	0x3
+	.quad	blake2b_kernels
+	.uleb128 0x1b
+	.long	0x5e6
+	.byte	0x8b
+	.uleb128 0x9
+	.byte	0x3
+	.quad	blake2b_kern
+	.uleb128 0x25
+	.long	.LASF51
+	.byte	0x9
+	.value	0x28e
+	.byte	0xe
+	.long	0x9f
+	.long	0x719
+	.uleb128 0x1
+	.long	0x3ee
+	.byte	0
+	.uleb128 0x6
+	.long	.LASF48
+	.byte	0x8
+	.byte	0x43
+	.long	0x734
+	.uleb128 0x1
+	.long	0x5dc
+	.uleb128 0x1
+	.long	0x446
+	.uleb128 0x1
+	.long	0x66
+	.byte	0
+	.uleb128 0x6
+	.long	.LASF49
+	.byte	0x8
+	.byte	0x3f
+	.long	0x74f
+	.uleb128 0x1
+	.long	0x5a3
+	.uleb128 0x1
+	.long	0x52
+	.uleb128 0x1
+	.long	0x2a
+	.byte	0
+	.uleb128 0x6
+	.long	.LASF50
+	.byte	0x8
+	.byte	0x3c
+	.long	0x765
+	.uleb128 0x1
+	.long	0x5a3
+	.uleb128 0x1
+	.long	0x52
+	.byte	0
+	.uleb128 0x26
+	.long	.LASF52
+	.byte	0xa
+	.byte	0x9c
+	.byte	0xc
+	.long	0x3d
+	.long	0x780
+	.uleb128 0x1
+	.long	0x3ee
+	.uleb128 0x1
+	.long	0x3ee
+	.byte	0
+	.uleb128 0x6
+	.long	.LASF53
+	.byte	0x7
+	.byte	0x53
+	.long	0x79b
+	.uleb128 0x1
+	.long	0x441
+	.uleb128 0x1
+	.long	0x446
+	.uleb128 0x1
+	.long	0x66
+	.byte	0
+	.uleb128 0x6
+	.long	.LASF54
+	.byte	0x7
+	.byte	0x4d
+	.long	0x7b6
+	.uleb128 0x1
+	.long	0x168
+	.uleb128 0x1
+	.long	0x52
+	.uleb128 0x1
+	.long	0x2a
+	.byte	0
+	.uleb128 0x6
+	.long	.LASF55
+	.byte	0x7
+	.byte	0x44
+	.long	0x7cc
+	.uleb128 0x1
+	.long	0x168
+	.uleb128 0x1
+	.long	0x52
+	.byte	0
+	.uleb128 0x6
+	.long	.LASF56
+	.byte	0x7
+	.byte	0x51
+	.long	0x7e7
+	.uleb128 0x1
+	.long	0x441
+	.uleb128 0x1
+	.long	0x446
+	.uleb128 0x1
+	.long	0x66
+	.byte	0
+	.uleb128 0x6
+	.long	.LASF57
+	.byte	0x7
+	.byte	0x4b
+	.long	0x802
+	.uleb128 0x1
+	.long	0x168
+	.uleb128 0x1
+	.long	0x52
+	.uleb128 0x1
+	.long	0x2a
+	.byte	0
+	.uleb128 0x6
+	.long	.LASF58
+	.byte	0x7
+	.byte	0x43
+	.long	0x818
+	.uleb128 0x1
+	.long	0x168
+	.uleb128 0x1
+	.long	0x52
+	.byte	0
+	.uleb128 0x6
+	.long	.LASF59
+	.byte	0x7
+	.byte	0x49
+	.long	0x833
+	.uleb128 0x1
+	.long	0x168
+	.uleb128 0x1
+	.long	0x52
+	.uleb128 0x1
+	.long	0x2a
+	.byte	0
+	.uleb128 0x6
+	.long	.LASF60
+	.byte	0x7
+	.byte	0x42
+	.long	0x849
+	.uleb128 0x1
+	.long	0x168
+	.uleb128 0x1
+	.long	0x52
+	.byte	0
+	.uleb128 0x6
+	.long	.LASF61
+	.byte	0x8
+	.byte	0x41
+	.long	0x864
+	.uleb128 0x1
+	.long	0x5dc
+	.uleb128 0x1
+	.long	0x446
+	.uleb128 0x1
+	.long	0x66
+	.byte	0
+	.uleb128 0x6
+	.long	.LASF62
+	.byte	0x8
+	.byte	0x3d
+	.long	0x87f
+	.uleb128 0x1
+	.long	0x5a3
+	.uleb128 0x1
+	.long	0x52
+	.uleb128 0x1
+	.long	0x2a
+	.byte	0
+	.uleb128 0x6
+	.long	.LASF63
+	.byte	0x8
+	.byte	0x3b
+	.long	0x895
+	.uleb128 0x1
+	.long	0x5a3
+	.uleb128 0x1
+	.long	0x52
+	.byte	0
+	.uleb128 0x6
+	.long	.LASF64
+	.byte	0x7
+	.byte	0x4f
+	.long	0x8b0
+	.uleb128 0x1
+	.long	0x441
+	.uleb128 0x1
+	.long	0x446
+	.uleb128 0x1
+	.long	0x66
+	.byte	0
+	.uleb128 0x6
+	.long	.LASF65
+	.byte	0x7
+	.byte	0x45
+	.long	0x8cb
+	.uleb128 0x1
+	.long	0x168
+	.uleb128 0x1
+	.long	0x52
+	.uleb128 0x1
+	.long	0x2a
+	.byte	0
+	.uleb128 0x6
+	.long	.LASF66
+	.byte	0x7
+	.byte	0x40
+	.long	0x8e1
+	.uleb128 0x1
+	.long	0x168
+	.uleb128 0x1
+	.long	0x52
+	.byte	0
+	.uleb128 0x27
+	.long	.LASF78
+	.byte	0x1
+	.byte	0xc8
+	.byte	0xd
+	.quad	.LFB40
+	.quad	.LFE40-.LFB40
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0x996
+	.uleb128 0x28
+	.long	.LASF27
+	.byte	0x1
+	.byte	0xca
+	.byte	0x11
+	.long	0x3ee
+	.long	.LLST13
+	.long	.LVUS13
+	.uleb128 0xc
+	.quad	.LVL38
+	.long	0x702
+	.long	0x932
+	.uleb128 0x4
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC5
+	.byte	0
+	.uleb128 0xe
+	.quad	.LVL39
+	.long	0xac6
+	.uleb128 0xc
+	.quad	.LVL40
+	.long	0x702
+	.long	0x95e
+	.uleb128 0x4
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC6
+	.byte	0
+	.uleb128 0xe
+	.quad	.LVL42
+	.long	0x9ce
+	.uleb128 0x29
+	.quad	.LVL43
+	.long	0x9ce
+	.long	0x982
+	.uleb128 0x4
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x1
+	.byte	0x30
+	.byte	0
+	.uleb128 0x1c
+	.quad	.LVL44
+	.long	0xac6
+	.uleb128 0x4
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x1
+	.byte	0x30
+	.byte	0
+	.byte	0
+	.uleb128 0x1d
+	.long	.LASF67
+	.byte	0xc1
+	.long	0x3ee
+	.quad	.LFB39
+	.quad	.LFE39-.LFB39
+	.uleb128 0x1
+	.byte	0x9c
+	.uleb128 0x1d
+	.long	.LASF68
+	.byte	0xbc
+	.long	0x3ee
+	.quad	.LFB38
+	.quad	.LFE38-.LFB38
+	.uleb128 0x1
+	.byte	0x9c
+	.uleb128 0x16
+	.long	.LASF69
+	.byte	0xac
+	.byte	0x5
+	.long	0x3d
+	.quad	.LFB37
+	.quad	.LFE37-.LFB37
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0xa94
+	.uleb128 0x1e
+	.long	.LASF27
+	.byte	0xac
+	.long	0x3ee
+	.long	.LLST9
+	.long	.LVUS9
+	.uleb128 0x11
+	.long	.LLRL10
+	.uleb128 0x12
+	.string	"i"
+	.byte	0xae
+	.byte	0x13
+	.long	0x66
+	.long	.LLST11
+	.long	.LVUS11
+	.uleb128 0x11
+	.long	.LLRL10
+	.uleb128 0x12
+	.string	"k"
+	.byte	0xaf
+	.byte	0x26
+	.long	0x5f1
+	.long	.LLST12
+	.long	.LVUS12
+	.uleb128 0xc
+	.quad	.LVL29
+	.long	0x765
+	.long	0xa52
+	.uleb128 0x4
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x73
+	.sleb128 0
+	.uleb128 0x4
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC1
+	.byte	0
+	.uleb128 0xe
+	.quad	.LVL30
+	.long	0xc81
+	.uleb128 0xc
+	.quad	.LVL34
+	.long	0x765
+	.long	0xa84
+	.uleb128 0x4
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x73
+	.sleb128 0
+	.uleb128 0x4
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC4
+	.byte	0
+	.uleb128 0xe
+	.quad	.LVL37
+	.long	0xc81
+	.byte	0
+	.byte	0
+	.byte	0
+	.uleb128 0x16
+	.long	.LASF70
+	.byte	0xa7
+	.byte	0x1e
+	.long	0x5f1
+	.quad	.LFB36
+	.quad	.LFE36-.LFB36
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0xac6
+	.uleb128 0x1f
+	.string	"i"
+	.byte	0xa7
+	.long	0x66
+	.long	.LLST8
+	.long	.LVUS8
+	.byte	0
+	.uleb128 0x2a
+	.long	.LASF71
+	.byte	0x1
+	.byte	0x97
+	.byte	0x5
+	.long	0x3d
+	.quad	.LFB35
+	.quad	.LFE35-.LFB35
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0xc05
+	.uleb128 0x1e
+	.long	.LASF27
+	.byte	0x97
+	.long	0x3ee
+	.long	.LLST1
+	.long	.LVUS1
+	.uleb128 0x11
+	.long	.LLRL2
+	.uleb128 0x12
+	.string	"i"
+	.byte	0x99
+	.byte	0x13
+	.long	0x66
+	.long	.LLST3
+	.long	.LVUS3
+	.uleb128 0x11
+	.long	.LLRL4
+	.uleb128 0x12
+	.string	"k"
+	.byte	0x9a
+	.byte	0x26
+	.long	0x45b
+	.long	.LLST5
+	.long	.LVUS5
+	.uleb128 0x2b
+	.long	0xc05
+	.quad	.LBI8
+	.byte	.LVU45
+	.long	.LLRL6
+	.byte	0x1
+	.byte	0x9d
+	.byte	0xe
+	.long	0xb4d
+	.uleb128 0x2c
+	.long	0xc16
+	.long	.LLST7
+	.long	.LVUS7
+	.byte	0
+	.uleb128 0xc
+	.quad	.LVL7
+	.long	0x765
+	.long	0xb72
+	.uleb128 0x4
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x73
+	.sleb128 0
+	.uleb128 0x4
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC0
+	.byte	0
+	.uleb128 0xc
+	.quad	.LVL12
+	.long	0x765
+	.long	0xb97
+	.uleb128 0x4
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x73
+	.sleb128 0
+	.uleb128 0x4
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC1
+	.byte	0
+	.uleb128 0xc
+	.quad	.LVL14
+	.long	0x765
+	.long	0xbbc
+	.uleb128 0x4
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x73
+	.sleb128 0
+	.uleb128 0x4
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC2
+	.byte	0
+	.uleb128 0xc
+	.quad	.LVL16
+	.long	0x765
+	.long	0xbe1
+	.uleb128 0x4
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x73
+	.sleb128 0
+	.uleb128 0x4
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC3
+	.byte	0
+	.uleb128 0x1c
+	.quad	.LVL18
+	.long	0x765
+	.uleb128 0x4
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x73
+	.sleb128 0
+	.uleb128 0x4
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC4
+	.byte	0
+	.byte	0
+	.byte	0
+	.byte	0
+	.uleb128 0x2d
+	.long	.LASF79
+	.byte	0x1
+	.byte	0x92
+	.byte	0xc
+	.long	0x3d
+	.byte	0x1
+	.long	0xc21
+	.uleb128 0x2e
+	.string	"k"
+	.byte	0x1
+	.byte	0x92
+	.byte	0x36
+	.long	0x45b
+	.byte	0
+	.uleb128 0x16
+	.long	.LASF72
+	.byte	0x8d
+	.byte	0x1e
+	.long	0x45b
+	.quad	.LFB33
+	.quad	.LFE33-.LFB33
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0xc53
+	.uleb128 0x1f
+	.string	"i"
+	.byte	0x8d
+	.long	0x66
+	.long	.LLST0
+	.long	.LVUS0
+	.byte	0
+	.uleb128 0x17
+	.long	.LASF73
+	.byte	0x29
+	.long	0x3d
+	.quad	.LFB32
+	.quad	.LFE32-.LFB32
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0xc81
+	.uleb128 0xe
+	.quad	.LVL2
+	.long	0xcdd
+	.byte	0
+	.uleb128 0x17
+	.long	.LASF74
+	.byte	0x24
+	.long	0x3d
+	.quad	.LFB31
+	.quad	.LFE31-.LFB31
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0xcaf
+	.uleb128 0xe
+	.quad	.LVL1
+	.long	0xce6
+	.byte	0
+	.uleb128 0x17
+	.long	.LASF75
+	.byte	0x1f
+	.long	0x3d
+	.quad	.LFB30
+	.quad	.LFE30-.LFB30
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0xcdd
+	.uleb128 0xe
+	.quad	.LVL0
+	.long	0xcef
+	.byte	0
+	.uleb128 0x18
+	.long	.LASF76
+	.long	.LASF76
+	.uleb128 0x18
+	.long	.LASF76
+	.long	.LASF76
+	.uleb128 0x18
+	.long	.LASF76
+	.long	.LASF76
+	.byte	0
+	.section	.debug_abbrev,"",@progbits
+.Ldebug_abbrev0:
+	.uleb128 0x1
+	.uleb128 0x5
+	.byte	0
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x2
+	.uleb128 0x21
+	.byte	0
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x2f
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xd
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x38
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x4
+	.uleb128 0x49
+	.byte	0
+	.uleb128 0x2
+	.uleb128 0x18
+	.uleb128 0x7e
+	.uleb128 0x18
+	.byte	0
+	.byte	0
+	.uleb128 0x5
+	.uleb128 0xf
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0x21
+	.sleb128 8
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x6
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 6
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x3c
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x7
+	.uleb128 0x1
+	.byte	0x1
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x8
+	.uleb128 0x26
+	.byte	0
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x9
+	.uleb128 0x24
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x3e
+	.uleb128 0xb
+	.uleb128 0x3
+	.uleb128 0xe
+	.byte	0
+	.byte	0
+	.uleb128 0xa
+	.uleb128 0xd
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x8
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x38
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x2
+	.uleb128 0x18
+	.byte	0
+	.byte	0
+	.uleb128 0xc
+	.uleb128 0x48
+	.byte	0x1
+	.uleb128 0x7d
+	.uleb128 0x1
+	.uleb128 0x7f
+	.uleb128 0x13
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0xd
+	.uleb128 0x16
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0xe
+	.uleb128 0x48
+	.byte	0
+	.uleb128 0x7d
+	.uleb128 0x1
+	.uleb128 0x7f
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0xf
+	.uleb128 0x15
+	.byte	0x1
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x10
+	.uleb128 0xd
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x8
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 9
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x38
+	.uleb128 0x5
+	.byte	0
+	.byte	0
+	.uleb128 0x11
+	.uleb128 0xb
+	.byte	0x1
+	.uleb128 0x55
+	.uleb128 0x17
+	.byte	0
+	.byte	0
+	.uleb128 0x12
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x8
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x2
+	.uleb128 0x17
+	.uleb128 0x2137
+	.uleb128 0x17
+	.byte	0
+	.byte	0
+	.uleb128 0x13
+	.uleb128 0x13
+	.byte	0x1
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0xb
+	.uleb128 0x5
+	.uleb128 0x88
+	.uleb128 0xb
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 8
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x14
+	.uleb128 0x16
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x8
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x15
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x1c
+	.uleb128 0xa
+	.byte	0
+	.byte	0
+	.uleb128 0x16
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x11
+	.uleb128 0x1
+	.uleb128 0x12
+	.uleb128 0x7
+	.uleb128 0x40
+	.uleb128 0x18
+	.uleb128 0x7a
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x17
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 12
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x11
+	.uleb128 0x1
+	.uleb128 0x12
+	.uleb128 0x7
+	.uleb128 0x40
+	.uleb128 0x18
+	.uleb128 0x7a
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x18
+	.uleb128 0x2e
+	.byte	0
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3c
+	.uleb128 0x19
+	.uleb128 0x6e
+	.uleb128 0xe
+	.uleb128 0x3
+	.uleb128 0xe
+	.byte	0
+	.byte	0
+	.uleb128 0x19
+	.uleb128 0x13
+	.byte	0x1
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0xb
+	.uleb128 0x21
+	.sleb128 48
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 8
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x1a
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 37
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3c
+	.uleb128 0x19
+	.byte	0
+	.byte	0
+	.uleb128 0x1b
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x47
+	.uleb128 0x13
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 30
+	.uleb128 0x2
+	.uleb128 0x18
+	.byte	0
+	.byte	0
+	.uleb128 0x1c
+	.uleb128 0x48
+	.byte	0x1
+	.uleb128 0x7d
+	.uleb128 0x1
+	.uleb128 0x7f
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x1d
+	.uleb128 0x2e
+	.byte	0
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 13
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x11
+	.uleb128 0x1
+	.uleb128 0x12
+	.uleb128 0x7
+	.uleb128 0x40
+	.uleb128 0x18
+	.uleb128 0x7a
+	.uleb128 0x19
+	.byte	0
+	.byte	0
+	.uleb128 0x1e
+	.uleb128 0x5
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 36
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x2
+	.uleb128 0x17
+	.uleb128 0x2137
+	.uleb128 0x17
+	.byte	0
+	.byte	0
+	.uleb128 0x1f
+	.uleb128 0x5
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x8
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 58
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x2
+	.uleb128 0x17
+	.uleb128 0x2137
+	.uleb128 0x17
+	.byte	0
+	.byte	0
+	.uleb128 0x20
+	.uleb128 0x11
+	.byte	0x1
+	.uleb128 0x25
+	.uleb128 0xe
+	.uleb128 0x13
+	.uleb128 0xb
+	.uleb128 0x3
+	.uleb128 0x1f
+	.uleb128 0x1b
+	.uleb128 0x1f
+	.uleb128 0x55
+	.uleb128 0x17
+	.uleb128 0x11
+	.uleb128 0x1
+	.uleb128 0x10
+	.uleb128 0x17
+	.byte	0
+	.byte	0
+	.uleb128 0x21
+	.uleb128 0x24
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x3e
+	.uleb128 0xb
+	.uleb128 0x3
+	.uleb128 0x8
+	.byte	0
+	.byte	0
+	.uleb128 0x22
+	.uleb128 0x26
+	.byte	0
+	.byte	0
+	.byte	0
+	.uleb128 0x23
+	.uleb128 0x13
+	.byte	0x1
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x88
+	.uleb128 0xb
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x24
+	.uleb128 0x15
+	.byte	0
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x25
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x3c
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x26
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x3c
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x27
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x11
+	.uleb128 0x1
+	.uleb128 0x12
+	.uleb128 0x7
+	.uleb128 0x40
+	.uleb128 0x18
+	.uleb128 0x7a
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x28
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x2
+	.uleb128 0x17
+	.uleb128 0x2137
+	.uleb128 0x17
+	.byte	0
+	.byte	0
+	.uleb128 0x29
+	.uleb128 0x48
+	.byte	0x1
+	.uleb128 0x7d
+	.uleb128 0x1
+	.uleb128 0x82
+	.uleb128 0x19
+	.uleb128 0x7f
+	.uleb128 0x13
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x2a
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x11
+	.uleb128 0x1
+	.uleb128 0x12
+	.uleb128 0x7
+	.uleb128 0x40
+	.uleb128 0x18
+	.uleb128 0x7c
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x2b
+	.uleb128 0x1d
+	.byte	0x1
+	.uleb128 0x31
+	.uleb128 0x13
+	.uleb128 0x52
+	.uleb128 0x1
+	.uleb128 0x2138
+	.uleb128 0xb
+	.uleb128 0x55
+	.uleb128 0x17
+	.uleb128 0x58
+	.uleb128 0xb
+	.uleb128 0x59
+	.uleb128 0xb
+	.uleb128 0x57
+	.uleb128 0xb
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x2c
+	.uleb128 0x5
+	.byte	0
+	.uleb128 0x31
+	.uleb128 0x13
+	.uleb128 0x2
+	.uleb128 0x17
+	.uleb128 0x2137
+	.uleb128 0x17
+	.byte	0
+	.byte	0
+	.uleb128 0x2d
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x20
+	.uleb128 0xb
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x2e
+	.uleb128 0x5
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x8
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.byte	0
+	.section	.debug_loclists,"",@progbits
+	.long	.Ldebug_loc3-.Ldebug_loc2
+.Ldebug_loc2:
+	.value	0x5
+	.byte	0x8
+	.byte	0
+	.long	0
+.Ldebug_loc0:
+.LVUS13:
+	.uleb128 .LVU158
+	.uleb128 .LVU161
+	.uleb128 .LVU164
+	.uleb128 .LVU167
+.LLST13:
+	.byte	0x6
+	.quad	.LVL38
+	.byte	0x4
+	.uleb128 .LVL38-.LVL38
+	.uleb128 .LVL39-1-.LVL38
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL41-.LVL38
+	.uleb128 .LVL42-1-.LVL38
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0
+.LVUS9:
+	.uleb128 0
+	.uleb128 .LVU122
+	.uleb128 .LVU122
+	.uleb128 .LVU128
+	.uleb128 .LVU128
+	.uleb128 .LVU129
+	.uleb128 .LVU129
+	.uleb128 .LVU135
+	.uleb128 .LVU135
+	.uleb128 .LVU142
+	.uleb128 .LVU142
+	.uleb128 .LVU144
+	.uleb128 .LVU144
+	.uleb128 0
+.LLST9:
+	.byte	0x6
+	.quad	.LVL28
+	.byte	0x4
+	.uleb128 .LVL28-.LVL28
+	.uleb128 .LVL29-1-.LVL28
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL29-1-.LVL28
+	.uleb128 .LVL32-.LVL28
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0x4
+	.uleb128 .LVL32-.LVL28
+	.uleb128 .LVL33-.LVL28
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL33-.LVL28
+	.uleb128 .LVL35-.LVL28
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0x4
+	.uleb128 .LVL35-.LVL28
+	.uleb128 .LVL36-.LVL28
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL36-.LVL28
+	.uleb128 .LVL37-1-.LVL28
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL37-1-.LVL28
+	.uleb128 .LFE37-.LVL28
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x9f
+	.byte	0
+.LVUS11:
+	.uleb128 .LVU116
+	.uleb128 .LVU126
+	.uleb128 .LVU129
+	.uleb128 .LVU130
+	.uleb128 .LVU130
+	.uleb128 .LVU135
+	.uleb128 .LVU142
+	.uleb128 0
+.LLST11:
+	.byte	0x6
+	.quad	.LVL28
+	.byte	0x4
+	.uleb128 .LVL28-.LVL28
+	.uleb128 .LVL31-.LVL28
+	.uleb128 0x2
+	.byte	0x30
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL33-.LVL28
+	.uleb128 .LVL33-.LVL28
+	.uleb128 0x2
+	.byte	0x30
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL33-.LVL28
+	.uleb128 .LVL35-.LVL28
+	.uleb128 0x2
+	.byte	0x31
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL36-.LVL28
+	.uleb128 .LFE37-.LVL28
+	.uleb128 0x2
+	.byte	0x30
+	.byte	0x9f
+	.byte	0
+.LVUS12:
+	.uleb128 .LVU118
+	.uleb128 .LVU126
+	.uleb128 .LVU129
+	.uleb128 .LVU132
+	.uleb128 .LVU132
+	.uleb128 .LVU135
+	.uleb128 .LVU142
+	.uleb128 0
+.LLST12:
+	.byte	0x6
+	.quad	.LVL28
+	.byte	0x4
+	.uleb128 .LVL28-.LVL28
+	.uleb128 .LVL31-.LVL28
+	.uleb128 0xa
+	.byte	0x3
+	.quad	blake2b_kernel_avx2
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL33-.LVL28
+	.uleb128 .LVL33-.LVL28
+	.uleb128 0xa
+	.byte	0x3
+	.quad	blake2b_kernel_avx2
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL33-.LVL28
+	.uleb128 .LVL35-.LVL28
+	.uleb128 0xa
+	.byte	0x3
+	.quad	blake2b_kernel_generic
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL36-.LVL28
+	.uleb128 .LFE37-.LVL28
+	.uleb128 0xa
+	.byte	0x3
+	.quad	blake2b_kernel_avx2
+	.byte	0x9f
+	.byte	0
+.LVUS8:
+	.uleb128 0
+	.uleb128 .LVU112
+	.uleb128 .LVU112
+	.uleb128 0
+.LLST8:
+	.byte	0x6
+	.quad	.LVL26
+	.byte	0x4
+	.uleb128 .LVL26-.LVL26
+	.uleb128 .LVL27-.LVL26
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL27-.LVL26
+	.uleb128 .LFE36-.LVL26
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x9f
+	.byte	0
+.LVUS1:
+	.uleb128 0
+	.uleb128 .LVU43
+	.uleb128 .LVU43
+	.uleb128 .LVU49
+	.uleb128 .LVU49
+	.uleb128 .LVU56
+	.uleb128 .LVU56
+	.uleb128 .LVU87
+	.uleb128 .LVU87
+	.uleb128 .LVU88
+	.uleb128 .LVU88
+	.uleb128 0
+.LLST1:
+	.byte	0x6
+	.quad	.LVL5
+	.byte	0x4
+	.uleb128 .LVL5-.LVL5
+	.uleb128 .LVL7-1-.LVL5
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL7-1-.LVL5
+	.uleb128 .LVL10-.LVL5
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0x4
+	.uleb128 .LVL10-.LVL5
+	.uleb128 .LVL11-.LVL5
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL11-.LVL5
+	.uleb128 .LVL19-.LVL5
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0x4
+	.uleb128 .LVL19-.LVL5
+	.uleb128 .LVL20-.LVL5
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL20-.LVL5
+	.uleb128 .LFE35-.LVL5
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x9f
+	.byte	0
+.LVUS3:
+	.uleb128 .LVU36
+	.uleb128 .LVU44
+	.uleb128 .LVU56
+	.uleb128 .LVU57
+	.uleb128 .LVU57
+	.uleb128 .LVU65
+	.uleb128 .LVU65
+	.uleb128 .LVU73
+	.uleb128 .LVU73
+	.uleb128 .LVU81
+	.uleb128 .LVU81
+	.uleb128 .LVU87
+	.uleb128 .LVU87
+	.uleb128 .LVU88
+	.uleb128 .LVU88
+	.uleb128 .LVU101
+	.uleb128 .LVU101
+	.uleb128 .LVU102
+	.uleb128 .LVU102
+	.uleb128 .LVU103
+.LLST3:
+	.byte	0x6
+	.quad	.LVL5
+	.byte	0x4
+	.uleb128 .LVL5-.LVL5
+	.uleb128 .LVL8-.LVL5
+	.uleb128 0x2
+	.byte	0x30
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL11-.LVL5
+	.uleb128 .LVL11-.LVL5
+	.uleb128 0x2
+	.byte	0x30
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL11-.LVL5
+	.uleb128 .LVL13-.LVL5
+	.uleb128 0x2
+	.byte	0x31
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL13-.LVL5
+	.uleb128 .LVL15-.LVL5
+	.uleb128 0x2
+	.byte	0x32
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL15-.LVL5
+	.uleb128 .LVL17-.LVL5
+	.uleb128 0x2
+	.byte	0x33
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL17-.LVL5
+	.uleb128 .LVL19-.LVL5
+	.uleb128 0x2
+	.byte	0x34
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL19-.LVL5
+	.uleb128 .LVL20-.LVL5
+	.uleb128 0x2
+	.byte	0x30
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL20-.LVL5
+	.uleb128 .LVL23-.LVL5
+	.uleb128 0xf
+	.byte	0x73
+	.sleb128 0
+	.byte	0x3
+	.quad	blake2s_kernels
+	.byte	0x1c
+	.byte	0x33
+	.byte	0x25
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL23-.LVL5
+	.uleb128 .LVL24-.LVL5
+	.uleb128 0x11
+	.byte	0x73
+	.sleb128 0
+	.byte	0x3
+	.quad	blake2s_kernels
+	.byte	0x1c
+	.byte	0x33
+	.byte	0x25
+	.byte	0x23
+	.uleb128 0x1
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL24-.LVL5
+	.uleb128 .LVL25-.LVL5
+	.uleb128 0x11
+	.byte	0x73
+	.sleb128 0
+	.byte	0x3
+	.quad	blake2s_kernels+8
+	.byte	0x1c
+	.byte	0x33
+	.byte	0x25
+	.byte	0x23
+	.uleb128 0x1
+	.byte	0x9f
+	.byte	0
+.LVUS5:
+	.uleb128 .LVU40
+	.uleb128 .LVU44
+	.uleb128 .LVU56
+	.uleb128 .LVU59
+	.uleb128 .LVU59
+	.uleb128 .LVU67
+	.uleb128 .LVU67
+	.uleb128 .LVU75
+	.uleb128 .LVU75
+	.uleb128 .LVU83
+	.uleb128 .LVU83
+	.uleb128 .LVU87
+	.uleb128 .LVU90
+	.uleb128 .LVU103
+.LLST5:
+	.byte	0x6
+	.quad	.LVL6
+	.byte	0x4
+	.uleb128 .LVL6-.LVL6
+	.uleb128 .LVL8-.LVL6
+	.uleb128 0xa
+	.byte	0x3
+	.quad	blake2s_kernel_avx512
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL11-.LVL6
+	.uleb128 .LVL11-.LVL6
+	.uleb128 0xa
+	.byte	0x3
+	.quad	blake2s_kernel_avx512
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL11-.LVL6
+	.uleb128 .LVL13-.LVL6
+	.uleb128 0xa
+	.byte	0x3
+	.quad	blake2s_kernel_avx2
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL13-.LVL6
+	.uleb128 .LVL15-.LVL6
+	.uleb128 0xa
+	.byte	0x3
+	.quad	blake2s_kernel_sse
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL15-.LVL6
+	.uleb128 .LVL17-.LVL6
+	.uleb128 0xa
+	.byte	0x3
+	.quad	blake2s_kernel_vec
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL17-.LVL6
+	.uleb128 .LVL19-.LVL6
+	.uleb128 0xa
+	.byte	0x3
+	.quad	blake2s_kernel_generic
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL21-.LVL6
+	.uleb128 .LVL25-.LVL6
+	.uleb128 0x1
+	.byte	0x56
+	.byte	0
+.LVUS7:
+	.uleb128 .LVU45
+	.uleb128 .LVU49
+	.uleb128 .LVU92
+	.uleb128 .LVU98
+.LLST7:
+	.byte	0x6
+	.quad	.LVL8
+	.byte	0x4
+	.uleb128 .LVL8-.LVL8
+	.uleb128 .LVL10-.LVL8
+	.uleb128 0x1
+	.byte	0x56
+	.byte	0x4
+	.uleb128 .LVL21-.LVL8
+	.uleb128 .LVL23-.LVL8
+	.uleb128 0x1
+	.byte	0x56
+	.byte	0
+.LVUS0:
+	.uleb128 0
+	.uleb128 .LVU32
+	.uleb128 .LVU32
+	.uleb128 0
+.LLST0:
+	.byte	0x6
+	.quad	.LVL3
+	.byte	0x4
+	.uleb128 .LVL3-.LVL3
+	.uleb128 .LVL4-.LVL3
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL4-.LVL3
+	.uleb128 .LFE33-.LVL3
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x9f
+	.byte	0
+.Ldebug_loc3:
+	.section	.debug_aranges,"",@progbits
+	.long	0x3c
+	.value	0x2
+	.long	.Ldebug_info0
+	.byte	0x8
+	.byte	0
+	.value	0
+	.value	0
+	.quad	.Ltext0
+	.quad	.Letext0-.Ltext0
+	.quad	.LFB40
+	.quad	.LFE40-.LFB40
+	.quad	0
+	.quad	0
+	.section	.debug_rnglists,"",@progbits
+.Ldebug_ranges0:
+	.long	.Ldebug_ranges3-.Ldebug_ranges2
+.Ldebug_ranges2:
+	.value	0x5
+	.byte	0x8
+	.byte	0
+	.long	0
+.LLRL2:
+	.byte	0x5
+	.quad	.LBB6
+	.byte	0x4
+	.uleb128 .LBB6-.LBB6
+	.uleb128 .LBE6-.LBB6
+	.byte	0x4
+	.uleb128 .LBB18-.LBB6
+	.uleb128 .LBE18-.LBB6
+	.byte	0x4
+	.uleb128 .LBB19-.LBB6
+	.uleb128 .LBE19-.LBB6
+	.byte	0x4
+	.uleb128 .LBB20-.LBB6
+	.uleb128 .LBE20-.LBB6
+	.byte	0x4
+	.uleb128 .LBB21-.LBB6
+	.uleb128 .LBE21-.LBB6
+	.byte	0
+.LLRL4:
+	.byte	0x5
+	.quad	.LBB7
+	.byte	0x4
+	.uleb128 .LBB7-.LBB7
+	.uleb128 .LBE7-.LBB7
+	.byte	0x4
+	.uleb128 .LBB12-.LBB7
+	.uleb128 .LBE12-.LBB7
+	.byte	0x4
+	.uleb128 .LBB13-.LBB7
+	.uleb128 .LBE13-.LBB7
+	.byte	0x4
+	.uleb128 .LBB14-.LBB7
+	.uleb128 .LBE14-.LBB7
+	.byte	0x4
+	.uleb128 .LBB15-.LBB7
+	.uleb128 .LBE15-.LBB7
+	.byte	0x4
+	.uleb128 .LBB16-.LBB7
+	.uleb128 .LBE16-.LBB7
+	.byte	0x4
+	.uleb128 .LBB17-.LBB7
+	.uleb128 .LBE17-.LBB7
+	.byte	0
+.LLRL6:
+	.byte	0x5
+	.quad	.LBB8
+	.byte	0x4
+	.uleb128 .LBB8-.LBB8
+	.uleb128 .LBE8-.LBB8
+	.byte	0x4
+	.uleb128 .LBB11-.LBB8
+	.uleb128 .LBE11-.LBB8
+	.byte	0
+.LLRL10:
+	.byte	0x5
+	.quad	.LBB22
+	.byte	0x4
+	.uleb128 .LBB22-.LBB22
+	.uleb128 .LBE22-.LBB22
+	.byte	0x4
+	.uleb128 .LBB28-.LBB22
+	.uleb128 .LBE28-.LBB22
+	.byte	0x4
+	.uleb128 .LBB29-.LBB22
+	.uleb128 .LBE29-.LBB22
+	.byte	0x4
+	.uleb128 .LBB30-.LBB22
+	.uleb128 .LBE30-.LBB22
+	.byte	0x4
+	.uleb128 .LBB31-.LBB22
+	.uleb128 .LBE31-.LBB22
+	.byte	0
+.LLRL14:
+	.byte	0x7
+	.quad	.Ltext0
+	.uleb128 .Letext0-.Ltext0
+	.byte	0x7
+	.quad	.LFB40
+	.uleb128 .LFE40-.LFB40
+	.byte	0
+.Ldebug_ranges3:
+	.section	.debug_line,"",@progbits
+.Ldebug_line0:
+	.section	.debug_str,"MS",@progbits,1
+.LASF52:
+	.string	"strcmp"
+.LASF9:
+	.string	"size_t"
+.LASF57:
+	.string	"blake2s_compress_blocks_sse"
+.LASF17:
+	.string	"uint64_t"
+.LASF10:
+	.string	"__uint8_t"
+.LASF23:
+	.string	"long long unsigned int"
+.LASF48:
+	.string	"blake2b_compress_lanes_avx2"
+.LASF25:
+	.string	"blake2s_sigma"
+.LASF41:
+	.string	"blake2s_kernel_sse"
+.LASF47:
+	.string	"blake2b_kernels"
+.LASF76:
+	.string	"__cpu_indicator_init"
+.LASF64:
+	.string	"blake2s_compress_lanes_serial"
+.LASF71:
+	.string	"blake2s_set_kernel"
+.LASF4:
+	.string	"long long int"
+.LASF8:
+	.string	"signed char"
+.LASF21:
+	.string	"blake2s_ctx"
+.LASF18:
+	.string	"buf_len"
+.LASF50:
+	.string	"blake2b_compress_avx2"
+.LASF55:
+	.string	"blake2s_compress_avx512vl"
+.LASF70:
+	.string	"blake2b_kernel_get"
+.LASF54:
+	.string	"blake2s_compress_blocks_avx512vl"
+.LASF3:
+	.string	"long int"
+.LASF46:
+	.string	"blake2b_kernel_generic"
+.LASF29:
+	.string	"compress"
+.LASF34:
+	.string	"blake2b_lanes"
+.LASF56:
+	.string	"blake2s_compress_lanes_avx2"
+.LASF12:
+	.string	"__uint32_t"
+.LASF31:
+	.string	"lanes"
+.LASF26:
+	.string	"blake2s_lanes"
+.LASF36:
+	.string	"blake2b_kernel"
+.LASF7:
+	.string	"unsigned int"
+.LASF2:
+	.string	"long unsigned int"
+.LASF27:
+	.string	"name"
+.LASF39:
+	.string	"blake2s_kernel_avx512"
+.LASF6:
+	.string	"short unsigned int"
+.LASF67:
+	.string	"blake2b_get_kernel"
+.LASF68:
+	.string	"blake2s_get_kernel"
+.LASF53:
+	.string	"blake2s_compress_lanes_avx512"
+.LASF22:
+	.string	"blake2b_ctx"
+.LASF77:
+	.string	"GNU C99 12.2.0 -mtune=generic -march=x86-64 -g -O3 -std=c99 -fasynchronous-unwind-tables"
+.LASF72:
+	.string	"blake2s_kernel_get"
+.LASF51:
+	.string	"getenv"
+.LASF30:
+	.string	"compress_blocks"
+.LASF63:
+	.string	"blake2b_compress_generic"
+.LASF65:
+	.string	"blake2s_compress_blocks_generic"
+.LASF75:
+	.string	"cpu_has_sse41"
+.LASF69:
+	.string	"blake2b_set_kernel"
+.LASF78:
+	.string	"bkern_select"
+.LASF45:
+	.string	"blake2b_kernel_avx2"
+.LASF40:
+	.string	"blake2s_kernel_avx2"
+.LASF13:
+	.string	"__uint64_t"
+.LASF58:
+	.string	"blake2s_compress_sse"
+.LASF43:
+	.string	"blake2s_kernel_generic"
+.LASF5:
+	.string	"unsigned char"
+.LASF59:
+	.string	"blake2s_compress_blocks_vec"
+.LASF44:
+	.string	"blake2s_kernels"
+.LASF11:
+	.string	"short int"
+.LASF73:
+	.string	"cpu_has_avx512"
+.LASF79:
+	.string	"bkern_usable"
+.LASF19:
+	.string	"digest_len"
+.LASF42:
+	.string	"blake2s_kernel_vec"
+.LASF16:
+	.string	"uint32_t"
+.LASF14:
+	.string	"char"
+.LASF61:
+	.string	"blake2b_compress_lanes_serial"
+.LASF35:
+	.string	"blake2s_kernel"
+.LASF37:
+	.string	"blake2s_kern"
+.LASF62:
+	.string	"blake2b_compress_blocks_generic"
+.LASF38:
+	.string	"blake2b_kern"
+.LASF20:
+	.string	"last_node"
+.LASF74:
+	.string	"cpu_has_avx2"
+.LASF28:
+	.string	"usable"
+.LASF32:
+	.string	"compress_lanes"
+.LASF15:
+	.string	"uint8_t"
+.LASF66:
+	.string	"blake2s_compress_generic"
+.LASF33:
+	.string	"blake2b_iv"
+.LASF60:
+	.string	"blake2s_compress_vec"
+.LASF49:
+	.string	"blake2b_compress_blocks_avx2"
+.LASF24:
+	.string	"blake2s_iv"
+	.section	.debug_line_str,"MS",@progbits,1
+.LASF0:
+	.string	"blake2s-kernel.c"
+.LASF1:
+	.string	"/root/repo"
+	.ident	"GCC: (Debian 12.2.0-14+deb12u1) 12.2.0"
+	.section	.note.GNU-stack,"",@progbits
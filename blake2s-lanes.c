@@ -0,0 +1,44 @@
+#include "blake2s.h"
+#include "blake2b.h"
+#include "blake2s-internal.h"
+#include "blake2b-internal.h"
+
+/* Multi-buffer fallback for kernels without one: the lanes go through
+ * the single-block kernel one after the other */
+void blake2s_compress_lanes_serial(struct blake2s_lanes *L, const void *m[],
+                                   unsigned mask)
+{
+    struct blake2s_ctx ctx;
+    for (unsigned l = 0; mask; l++, mask >>= 1) {
+        if (!(mask & 1))
+            continue;
+        for (unsigned i = 0; i < 8; i++)
+            ctx.H[i] = L->H[i][l];
+        ctx.t[0] = L->t[0][l];
+        ctx.t[1] = L->t[1][l];
+        ctx.f[0] = L->f[0][l];
+        ctx.f[1] = L->f[1][l];
+        blake2s_compress(&ctx, m[l]);
+        for (unsigned i = 0; i < 8; i++)
+            L->H[i][l] = ctx.H[i];
+    }
+}
+
+void blake2b_compress_lanes_serial(struct blake2b_lanes *L, const void *m[],
+                                   unsigned mask)
+{
+    struct blake2b_ctx ctx;
+    for (unsigned l = 0; mask; l++, mask >>= 1) {
+        if (!(mask & 1))
+            continue;
+        for (unsigned i = 0; i < 8; i++)
+            ctx.H[i] = L->H[i][l];
+        ctx.t[0] = L->t[0][l];
+        ctx.t[1] = L->t[1][l];
+        ctx.f[0] = L->f[0][l];
+        ctx.f[1] = L->f[1][l];
+        blake2b_compress(&ctx, m[l]);
+        for (unsigned i = 0; i < 8; i++)
+            L->H[i][l] = ctx.H[i];
+    }
+}
@@ -0,0 +1,3046 @@
+	.file	"blake2s-lanes.c"
+# GNU C99 (Debian 12.2.0-14+deb12u1) version 12.2.0 (x86_64-linux-gnu)
+#	compiled by GNU C version 12.2.0, GMP version 6.2.1, MPFR version 4.2.0, MPC version 1.3.1, isl version isl-0.25-GMP
+
+# GGC heuristics: --param ggc-min-expand=100 --param ggc-min-heapsize=131072
+# options passed: -mtune=generic -march=x86-64 -g -O3 -std=c99 -fasynchronous-unwind-tables
+	.text
+.Ltext0:
+	.file 0 "/root/repo" "blake2s-lanes.c"
+	.p2align 4
+	.globl	blake2s_compress_lanes_serial
+	.type	blake2s_compress_lanes_serial, @function
+blake2s_compress_lanes_serial:
+.LVL0:
+.LFB25:
+	.file 1 "blake2s-lanes.c"
+	.loc 1 10 1 view -0
+	.cfi_startproc
+	.loc 1 11 5 view .LVU1
+	.loc 1 12 5 view .LVU2
+.LBB12:
+	.loc 1 12 10 view .LVU3
+	.loc 1 12 26 view .LVU4
+	testl	%edx, %edx	# mask
+	je	.L13	#,
+.LBE12:
+# blake2s-lanes.c:10: {
+	.loc 1 10 1 is_stmt 0 view .LVU5
+	pushq	%r15	#
+	.cfi_def_cfa_offset 16
+	.cfi_offset 15, -16
+.LBB29:
+# blake2s-lanes.c:12:     for (unsigned l = 0; mask; l++, mask >>= 1) {
+	.loc 1 12 19 view .LVU6
+	xorl	%r15d, %r15d	# l
+.LBE29:
+# blake2s-lanes.c:10: {
+	.loc 1 10 1 view .LVU7
+	pushq	%r14	#
+	.cfi_def_cfa_offset 24
+	.cfi_offset 14, -24
+	pushq	%r13	#
+	.cfi_def_cfa_offset 32
+	.cfi_offset 13, -32
+	movq	%rsi, %r13	# tmp155, m
+	pushq	%r12	#
+	.cfi_def_cfa_offset 40
+	.cfi_offset 12, -40
+	movq	%rdi, %r12	# tmp154, L
+	pushq	%rbp	#
+	.cfi_def_cfa_offset 48
+	.cfi_offset 6, -48
+	movl	%edx, %ebp	# tmp156, mask
+	pushq	%rbx	#
+	.cfi_def_cfa_offset 56
+	.cfi_offset 3, -56
+	subq	$136, %rsp	#,
+	.cfi_def_cfa_offset 192
+.LBB30:
+.LBB13:
+.LBB14:
+# blake2s-internal.h:88:     blake2s_kern->compress(ctx, m);
+	.file 2 "blake2s-internal.h"
+	.loc 2 88 5 view .LVU8
+	movq	%rsp, %r14	#, tmp153
+.LVL1:
+	.p2align 4,,10
+	.p2align 3
+.L4:
+	.loc 2 88 5 view .LVU9
+.LBE14:
+.LBE13:
+	.loc 1 13 9 is_stmt 1 view .LVU10
+# blake2s-lanes.c:13:         if (!(mask & 1))
+	.loc 1 13 12 is_stmt 0 view .LVU11
+	testb	$1, %bpl	#, mask
+	je	.L3	#,
+.LVL2:
+.LBB18:
+	.loc 1 15 32 is_stmt 1 view .LVU12
+	.loc 1 16 13 view .LVU13
+	movl	%r15d, %eax	# l, _64
+.LBE18:
+.LBB19:
+.LBB15:
+# blake2s-internal.h:88:     blake2s_kern->compress(ctx, m);
+	.loc 2 88 5 is_stmt 0 view .LVU14
+	movq	%r14, %rdi	# tmp153,
+	leaq	(%r12,%rax,4), %rbx	#, _26
+.LBE15:
+.LBE19:
+.LBB20:
+	.loc 1 15 38 is_stmt 1 view .LVU15
+.LVL3:
+	.loc 1 15 32 view .LVU16
+	.loc 1 16 13 view .LVU17
+	.loc 1 15 38 view .LVU18
+	.loc 1 15 32 view .LVU19
+	.loc 1 16 13 view .LVU20
+	.loc 1 15 38 view .LVU21
+	.loc 1 15 32 view .LVU22
+	.loc 1 16 13 view .LVU23
+	.loc 1 15 38 view .LVU24
+	.loc 1 15 32 view .LVU25
+	.loc 1 16 13 view .LVU26
+	.loc 1 15 38 view .LVU27
+	.loc 1 15 32 view .LVU28
+	.loc 1 16 13 view .LVU29
+	.loc 1 15 38 view .LVU30
+	.loc 1 15 32 view .LVU31
+	.loc 1 16 13 view .LVU32
+	.loc 1 15 38 view .LVU33
+	.loc 1 15 32 view .LVU34
+	.loc 1 16 13 view .LVU35
+.LBE20:
+.LBB21:
+.LBB16:
+# blake2s-internal.h:88:     blake2s_kern->compress(ctx, m);
+	.loc 2 88 5 is_stmt 0 view .LVU36
+	movq	0(%r13,%rax,8), %rsi	# *_9, *_9
+	movq	blake2s_kern(%rip), %rax	# blake2s_kern, blake2s_kern
+	movd	448(%rbx), %xmm3	# MEM <u32> [(struct blake2s_lanes *)_26 + 448B], tmp159
+	movd	384(%rbx), %xmm1	# MEM <u32> [(struct blake2s_lanes *)_26 + 384B], tmp121
+	movd	256(%rbx), %xmm0	# MEM <u32> [(struct blake2s_lanes *)_26 + 256B], tmp124
+	movd	320(%rbx), %xmm4	# MEM <u32> [(struct blake2s_lanes *)_26 + 320B], tmp161
+	punpckldq	%xmm3, %xmm1	# tmp159, tmp121
+.LBE16:
+.LBE21:
+.LBB22:
+# blake2s-lanes.c:16:             ctx.H[i] = L->H[i][l];
+	.loc 1 16 22 view .LVU37
+	movd	128(%rbx), %xmm2	# MEM <u32> [(struct blake2s_lanes *)_26 + 128B], tmp128
+	movd	192(%rbx), %xmm5	# MEM <u32> [(struct blake2s_lanes *)_26 + 192B], tmp163
+	punpckldq	%xmm4, %xmm0	# tmp161, tmp124
+	movd	64(%rbx), %xmm6	# MEM <u32> [(struct blake2s_lanes *)_26 + 64B], tmp165
+.LBE22:
+# blake2s-lanes.c:17:         ctx.t[0] = L->t[0][l];
+	.loc 1 17 18 view .LVU38
+	movd	704(%rbx), %xmm7	# MEM <u32> [(struct blake2s_lanes *)_26 + 704B], tmp167
+	punpcklqdq	%xmm1, %xmm0	# tmp121, tmp120
+.LBB23:
+# blake2s-lanes.c:16:             ctx.H[i] = L->H[i][l];
+	.loc 1 16 22 view .LVU39
+	movd	(%rbx), %xmm1	# MEM <u32> [(struct blake2s_lanes *)_26], tmp131
+	punpckldq	%xmm5, %xmm2	# tmp163, tmp128
+.LBE23:
+# blake2s-lanes.c:17:         ctx.t[0] = L->t[0][l];
+	.loc 1 17 18 view .LVU40
+	movd	576(%rbx), %xmm3	# MEM <u32> [(struct blake2s_lanes *)_26 + 576B], tmp169
+.LBB24:
+# blake2s-lanes.c:16:             ctx.H[i] = L->H[i][l];
+	.loc 1 16 22 view .LVU41
+	movaps	%xmm0, 16(%rsp)	# tmp120, MEM <vector(4) unsigned int> [(unsigned int *)&ctx + 16B]
+	.loc 1 15 38 is_stmt 1 view .LVU42
+.LVL4:
+	.loc 1 15 32 view .LVU43
+.LBE24:
+	.loc 1 17 9 view .LVU44
+	.loc 1 18 9 view .LVU45
+	.loc 1 19 9 view .LVU46
+	.loc 1 20 9 view .LVU47
+# blake2s-lanes.c:17:         ctx.t[0] = L->t[0][l];
+	.loc 1 17 18 is_stmt 0 view .LVU48
+	movd	512(%rbx), %xmm0	# MEM <u32> [(struct blake2s_lanes *)_26 + 512B], tmp138
+.LBB25:
+# blake2s-lanes.c:16:             ctx.H[i] = L->H[i][l];
+	.loc 1 16 22 view .LVU49
+	punpckldq	%xmm6, %xmm1	# tmp165, tmp131
+	punpcklqdq	%xmm2, %xmm1	# tmp128, tmp127
+.LBE25:
+# blake2s-lanes.c:17:         ctx.t[0] = L->t[0][l];
+	.loc 1 17 18 view .LVU50
+	punpckldq	%xmm3, %xmm0	# tmp169, tmp138
+.LBB26:
+# blake2s-lanes.c:16:             ctx.H[i] = L->H[i][l];
+	.loc 1 16 22 view .LVU51
+	movaps	%xmm1, (%rsp)	# tmp127, MEM <vector(4) unsigned int> [(unsigned int *)&ctx]
+.LBE26:
+# blake2s-lanes.c:17:         ctx.t[0] = L->t[0][l];
+	.loc 1 17 18 view .LVU52
+	movd	640(%rbx), %xmm1	# MEM <u32> [(struct blake2s_lanes *)_26 + 640B], tmp135
+	punpckldq	%xmm7, %xmm1	# tmp167, tmp135
+	punpcklqdq	%xmm1, %xmm0	# tmp135, tmp134
+	movaps	%xmm0, 96(%rsp)	# tmp134, MEM <vector(4) unsigned int> [(unsigned int *)&ctx + 96B]
+	.loc 1 21 9 is_stmt 1 view .LVU53
+.LVL5:
+.LBB27:
+.LBI13:
+	.loc 2 86 20 view .LVU54
+.LBB17:
+	.loc 2 88 5 view .LVU55
+	call	*16(%rax)	# blake2s_kern.0_35->compress
+.LVL6:
+	.loc 2 88 5 is_stmt 0 view .LVU56
+.LBE17:
+.LBE27:
+	.loc 1 22 9 is_stmt 1 view .LVU57
+.LBB28:
+	.loc 1 22 14 view .LVU58
+	.loc 1 22 32 view .LVU59
+	.loc 1 23 13 view .LVU60
+# blake2s-lanes.c:23:             L->H[i][l] = ctx.H[i];
+	.loc 1 23 24 is_stmt 0 view .LVU61
+	movl	(%rsp), %eax	# ctx.H[0], ctx.H[0]
+	movl	%eax, (%rbx)	# ctx.H[0], MEM <u32> [(struct blake2s_lanes *)_26]
+	.loc 1 22 38 is_stmt 1 view .LVU62
+.LVL7:
+	.loc 1 22 32 view .LVU63
+	.loc 1 23 13 view .LVU64
+# blake2s-lanes.c:23:             L->H[i][l] = ctx.H[i];
+	.loc 1 23 24 is_stmt 0 view .LVU65
+	movl	4(%rsp), %eax	# ctx.H[1], ctx.H[1]
+	movl	%eax, 64(%rbx)	# ctx.H[1], MEM <u32> [(struct blake2s_lanes *)_26 + 64B]
+	.loc 1 22 38 is_stmt 1 view .LVU66
+.LVL8:
+	.loc 1 22 32 view .LVU67
+	.loc 1 23 13 view .LVU68
+# blake2s-lanes.c:23:             L->H[i][l] = ctx.H[i];
+	.loc 1 23 24 is_stmt 0 view .LVU69
+	movl	8(%rsp), %eax	# ctx.H[2], ctx.H[2]
+	movl	%eax, 128(%rbx)	# ctx.H[2], MEM <u32> [(struct blake2s_lanes *)_26 + 128B]
+	.loc 1 22 38 is_stmt 1 view .LVU70
+.LVL9:
+	.loc 1 22 32 view .LVU71
+	.loc 1 23 13 view .LVU72
+# blake2s-lanes.c:23:             L->H[i][l] = ctx.H[i];
+	.loc 1 23 24 is_stmt 0 view .LVU73
+	movl	12(%rsp), %eax	# ctx.H[3], ctx.H[3]
+	movl	%eax, 192(%rbx)	# ctx.H[3], MEM <u32> [(struct blake2s_lanes *)_26 + 192B]
+	.loc 1 22 38 is_stmt 1 view .LVU74
+.LVL10:
+	.loc 1 22 32 view .LVU75
+	.loc 1 23 13 view .LVU76
+# blake2s-lanes.c:23:             L->H[i][l] = ctx.H[i];
+	.loc 1 23 24 is_stmt 0 view .LVU77
+	movl	16(%rsp), %eax	# ctx.H[4], ctx.H[4]
+	movl	%eax, 256(%rbx)	# ctx.H[4], MEM <u32> [(struct blake2s_lanes *)_26 + 256B]
+	.loc 1 22 38 is_stmt 1 view .LVU78
+.LVL11:
+	.loc 1 22 32 view .LVU79
+	.loc 1 23 13 view .LVU80
+# blake2s-lanes.c:23:             L->H[i][l] = ctx.H[i];
+	.loc 1 23 24 is_stmt 0 view .LVU81
+	movl	20(%rsp), %eax	# ctx.H[5], ctx.H[5]
+	movl	%eax, 320(%rbx)	# ctx.H[5], MEM <u32> [(struct blake2s_lanes *)_26 + 320B]
+	.loc 1 22 38 is_stmt 1 view .LVU82
+.LVL12:
+	.loc 1 22 32 view .LVU83
+	.loc 1 23 13 view .LVU84
+# blake2s-lanes.c:23:             L->H[i][l] = ctx.H[i];
+	.loc 1 23 24 is_stmt 0 view .LVU85
+	movl	24(%rsp), %eax	# ctx.H[6], ctx.H[6]
+	movl	%eax, 384(%rbx)	# ctx.H[6], MEM <u32> [(struct blake2s_lanes *)_26 + 384B]
+	.loc 1 22 38 is_stmt 1 view .LVU86
+.LVL13:
+	.loc 1 22 32 view .LVU87
+	.loc 1 23 13 view .LVU88
+# blake2s-lanes.c:23:             L->H[i][l] = ctx.H[i];
+	.loc 1 23 24 is_stmt 0 view .LVU89
+	movl	28(%rsp), %eax	# ctx.H[7], ctx.H[7]
+	movl	%eax, 448(%rbx)	# ctx.H[7], MEM <u32> [(struct blake2s_lanes *)_26 + 448B]
+	.loc 1 22 38 is_stmt 1 view .LVU90
+.LVL14:
+	.loc 1 22 32 view .LVU91
+.L3:
+	.loc 1 22 32 is_stmt 0 view .LVU92
+.LBE28:
+	.loc 1 12 35 is_stmt 1 discriminator 2 view .LVU93
+# blake2s-lanes.c:12:     for (unsigned l = 0; mask; l++, mask >>= 1) {
+	.loc 1 12 33 is_stmt 0 discriminator 2 view .LVU94
+	addl	$1, %r15d	#, l
+.LVL15:
+	.loc 1 12 26 is_stmt 1 discriminator 2 view .LVU95
+	shrl	%ebp	# mask
+.LVL16:
+	.loc 1 12 26 is_stmt 0 discriminator 2 view .LVU96
+	jne	.L4	#,
+.LBE30:
+# blake2s-lanes.c:25: }
+	.loc 1 25 1 view .LVU97
+	addq	$136, %rsp	#,
+	.cfi_def_cfa_offset 56
+	popq	%rbx	#
+	.cfi_def_cfa_offset 48
+	popq	%rbp	#
+	.cfi_def_cfa_offset 40
+.LVL17:
+	.loc 1 25 1 view .LVU98
+	popq	%r12	#
+	.cfi_def_cfa_offset 32
+.LVL18:
+	.loc 1 25 1 view .LVU99
+	popq	%r13	#
+	.cfi_def_cfa_offset 24
+.LVL19:
+	.loc 1 25 1 view .LVU100
+	popq	%r14	#
+	.cfi_def_cfa_offset 16
+	popq	%r15	#
+	.cfi_def_cfa_offset 8
+.LVL20:
+	.loc 1 25 1 view .LVU101
+	ret	
+.LVL21:
+.L13:
+	.cfi_restore 3
+	.cfi_restore 6
+	.cfi_restore 12
+	.cfi_restore 13
+	.cfi_restore 14
+	.cfi_restore 15
+	.loc 1 25 1 view .LVU102
+	ret	
+	.cfi_endproc
+.LFE25:
+	.size	blake2s_compress_lanes_serial, .-blake2s_compress_lanes_serial
+	.p2align 4
+	.globl	blake2b_compress_lanes_serial
+	.type	blake2b_compress_lanes_serial, @function
+blake2b_compress_lanes_serial:
+.LVL22:
+.LFB26:
+	.loc 1 29 1 is_stmt 1 view -0
+	.cfi_startproc
+	.loc 1 30 5 view .LVU104
+	.loc 1 31 5 view .LVU105
+.LBB31:
+	.loc 1 31 10 view .LVU106
+	.loc 1 31 26 view .LVU107
+	testl	%edx, %edx	# mask
+	je	.L29	#,
+.LBE31:
+# blake2s-lanes.c:29: {
+	.loc 1 29 1 is_stmt 0 view .LVU108
+	pushq	%rbp	#
+	.cfi_def_cfa_offset 16
+	.cfi_offset 6, -16
+	movq	%rsp, %rbp	#,
+	.cfi_def_cfa_register 6
+	pushq	%r15	#
+	.cfi_offset 15, -24
+.LBB44:
+# blake2s-lanes.c:31:     for (unsigned l = 0; mask; l++, mask >>= 1) {
+	.loc 1 31 19 view .LVU109
+	xorl	%r15d, %r15d	# l
+.LBE44:
+# blake2s-lanes.c:29: {
+	.loc 1 29 1 view .LVU110
+	pushq	%r14	#
+	.cfi_offset 14, -32
+	movq	%rsi, %r14	# tmp154, m
+	pushq	%r13	#
+	.cfi_offset 13, -40
+	movq	%rdi, %r13	# tmp153, L
+	pushq	%r12	#
+	.cfi_offset 12, -48
+	movl	%edx, %r12d	# tmp155, mask
+	pushq	%rbx	#
+	andq	$-32, %rsp	#,
+	subq	$288, %rsp	#,
+	.cfi_offset 3, -56
+.LBB45:
+.LBB32:
+.LBB33:
+# blake2b-internal.h:72:     blake2b_kern->compress(ctx, m);
+	.file 3 "blake2b-internal.h"
+	.loc 3 72 5 view .LVU111
+	leaq	32(%rsp), %rax	#, tmp167
+	movq	%rax, 24(%rsp)	# tmp167, %sfp
+.LVL23:
+.L20:
+	.loc 3 72 5 view .LVU112
+.LBE33:
+.LBE32:
+	.loc 1 32 9 is_stmt 1 view .LVU113
+# blake2s-lanes.c:32:         if (!(mask & 1))
+	.loc 1 32 12 is_stmt 0 view .LVU114
+	testb	$1, %r12b	#, mask
+	je	.L19	#,
+.LVL24:
+.LBB36:
+	.loc 1 34 32 is_stmt 1 view .LVU115
+	.loc 1 35 13 view .LVU116
+	movl	%r15d, %edx	# l, l
+.LBE36:
+.LBB37:
+.LBB34:
+# blake2b-internal.h:72:     blake2b_kern->compress(ctx, m);
+	.loc 3 72 5 is_stmt 0 view .LVU117
+	movq	24(%rsp), %rdi	# %sfp,
+	leaq	0(%r13,%rdx,8), %rbx	#, vectp.24
+	movq	(%r14,%rdx,8), %rsi	# *_9, *_9
+	movq	blake2b_kern(%rip), %rdx	# blake2b_kern, blake2b_kern
+.LBE34:
+.LBE37:
+.LBB38:
+# blake2s-lanes.c:35:             ctx.H[i] = L->H[i][l];
+	.loc 1 35 31 view .LVU118
+	movdqu	128(%rbx), %xmm1	# MEM <vector(2) long unsigned int> [(long unsigned int *)vectp.24_19 + 128B], vect__80.50
+	movdqu	160(%rbx), %xmm5	# MEM <vector(2) long unsigned int> [(long unsigned int *)vectp.24_19 + 160B], tmp160
+	movdqu	192(%rbx), %xmm0	# MEM <vector(2) long unsigned int> [(long unsigned int *)vectp.24_19 + 192B], vect__80.51
+	movdqu	224(%rbx), %xmm6	# MEM <vector(2) long unsigned int> [(long unsigned int *)vectp.24_19 + 224B], tmp162
+	punpcklqdq	%xmm5, %xmm1	# tmp160, vect__80.50
+	movdqu	64(%rbx), %xmm2	# MEM <vector(2) long unsigned int> [(long unsigned int *)vectp.24_19 + 64B], vect__80.49
+	movdqu	96(%rbx), %xmm4	# MEM <vector(2) long unsigned int> [(long unsigned int *)vectp.24_19 + 96B], tmp158
+	punpcklqdq	%xmm6, %xmm0	# tmp162, vect__80.51
+	.loc 1 34 38 is_stmt 1 view .LVU119
+.LVL25:
+	.loc 1 34 32 view .LVU120
+	.loc 1 35 13 view .LVU121
+	.loc 1 34 38 view .LVU122
+	.loc 1 34 32 view .LVU123
+	.loc 1 35 13 view .LVU124
+	.loc 1 34 38 view .LVU125
+	.loc 1 34 32 view .LVU126
+	.loc 1 35 13 view .LVU127
+	.loc 1 34 38 view .LVU128
+	.loc 1 34 32 view .LVU129
+	.loc 1 35 13 view .LVU130
+	.loc 1 34 38 view .LVU131
+	.loc 1 34 32 view .LVU132
+	.loc 1 35 13 view .LVU133
+	.loc 1 34 38 view .LVU134
+	.loc 1 34 32 view .LVU135
+	.loc 1 35 13 view .LVU136
+	.loc 1 34 38 view .LVU137
+	.loc 1 34 32 view .LVU138
+	.loc 1 35 13 view .LVU139
+# blake2s-lanes.c:35:             ctx.H[i] = L->H[i][l];
+	.loc 1 35 31 is_stmt 0 view .LVU140
+	movdqu	(%rbx), %xmm3	# MEM <vector(2) long unsigned int> [(long unsigned int *)vectp.24_19], vect__80.48
+	movdqu	32(%rbx), %xmm7	# MEM <vector(2) long unsigned int> [(long unsigned int *)vectp.24_19 + 32B], tmp164
+# blake2s-lanes.c:35:             ctx.H[i] = L->H[i][l];
+	.loc 1 35 22 view .LVU141
+	movaps	%xmm1, 64(%rsp)	# vect__80.50, MEM <vector(2) long unsigned int> [(long unsigned int *)&ctx + 32B]
+	movaps	%xmm0, 80(%rsp)	# vect__80.51, MEM <vector(2) long unsigned int> [(long unsigned int *)&ctx + 48B]
+	.loc 1 34 38 is_stmt 1 view .LVU142
+.LVL26:
+	.loc 1 34 32 view .LVU143
+.LBE38:
+	.loc 1 36 9 view .LVU144
+	.loc 1 37 9 view .LVU145
+	.loc 1 38 9 view .LVU146
+	.loc 1 39 9 view .LVU147
+.LBB39:
+# blake2s-lanes.c:35:             ctx.H[i] = L->H[i][l];
+	.loc 1 35 31 is_stmt 0 view .LVU148
+	punpcklqdq	%xmm4, %xmm2	# tmp158, vect__80.49
+	movq	320(%rbx), %xmm0	# MEM <u64> [(struct blake2b_lanes *)_26 + 320B], tmp134
+.LBE39:
+# blake2s-lanes.c:36:         ctx.t[0] = L->t[0][l];
+	.loc 1 36 18 view .LVU149
+	movq	256(%rbx), %xmm1	# MEM <u64> [(struct blake2b_lanes *)_26 + 256B], tmp137
+.LBB40:
+# blake2s-lanes.c:35:             ctx.H[i] = L->H[i][l];
+	.loc 1 35 31 view .LVU150
+	punpcklqdq	%xmm7, %xmm3	# tmp164, vect__80.48
+# blake2s-lanes.c:35:             ctx.H[i] = L->H[i][l];
+	.loc 1 35 22 view .LVU151
+	movaps	%xmm2, 48(%rsp)	# vect__80.49, MEM <vector(2) long unsigned int> [(long unsigned int *)&ctx + 16B]
+	movhps	352(%rbx), %xmm0	# MEM <u64> [(struct blake2b_lanes *)_26 + 352B], tmp134
+.LBE40:
+# blake2s-lanes.c:36:         ctx.t[0] = L->t[0][l];
+	.loc 1 36 18 view .LVU152
+	movhps	288(%rbx), %xmm1	# MEM <u64> [(struct blake2b_lanes *)_26 + 288B], tmp137
+.LBB41:
+# blake2s-lanes.c:35:             ctx.H[i] = L->H[i][l];
+	.loc 1 35 22 view .LVU153
+	movaps	%xmm3, 32(%rsp)	# vect__80.48, MEM <vector(2) long unsigned int> [(long unsigned int *)&ctx]
+.LBE41:
+# blake2s-lanes.c:36:         ctx.t[0] = L->t[0][l];
+	.loc 1 36 18 view .LVU154
+	movaps	%xmm1, 224(%rsp)	# tmp137, MEM <vector(2) long unsigned int> [(long unsigned int *)&ctx + 192B]
+	movaps	%xmm0, 240(%rsp)	# tmp134, MEM <vector(2) long unsigned int> [(long unsigned int *)&ctx + 208B]
+	.loc 1 40 9 is_stmt 1 view .LVU155
+.LVL27:
+.LBB42:
+.LBI32:
+	.loc 3 70 20 view .LVU156
+.LBB35:
+	.loc 3 72 5 view .LVU157
+	call	*16(%rdx)	# blake2b_kern.1_35->compress
+.LVL28:
+	.loc 3 72 5 is_stmt 0 view .LVU158
+.LBE35:
+.LBE42:
+	.loc 1 41 9 is_stmt 1 view .LVU159
+.LBB43:
+	.loc 1 41 14 view .LVU160
+	.loc 1 41 32 view .LVU161
+	.loc 1 42 13 view .LVU162
+# blake2s-lanes.c:42:             L->H[i][l] = ctx.H[i];
+	.loc 1 42 24 is_stmt 0 view .LVU163
+	movq	32(%rsp), %rdx	# ctx.H[0], ctx.H[0]
+	movq	%rdx, (%rbx)	# ctx.H[0], MEM <u64> [(struct blake2b_lanes *)_26]
+	.loc 1 41 38 is_stmt 1 view .LVU164
+.LVL29:
+	.loc 1 41 32 view .LVU165
+	.loc 1 42 13 view .LVU166
+# blake2s-lanes.c:42:             L->H[i][l] = ctx.H[i];
+	.loc 1 42 24 is_stmt 0 view .LVU167
+	movq	40(%rsp), %rdx	# ctx.H[1], ctx.H[1]
+	movq	%rdx, 32(%rbx)	# ctx.H[1], MEM <u64> [(struct blake2b_lanes *)_26 + 32B]
+	.loc 1 41 38 is_stmt 1 view .LVU168
+.LVL30:
+	.loc 1 41 32 view .LVU169
+	.loc 1 42 13 view .LVU170
+# blake2s-lanes.c:42:             L->H[i][l] = ctx.H[i];
+	.loc 1 42 24 is_stmt 0 view .LVU171
+	movq	48(%rsp), %rdx	# ctx.H[2], ctx.H[2]
+	movq	%rdx, 64(%rbx)	# ctx.H[2], MEM <u64> [(struct blake2b_lanes *)_26 + 64B]
+	.loc 1 41 38 is_stmt 1 view .LVU172
+.LVL31:
+	.loc 1 41 32 view .LVU173
+	.loc 1 42 13 view .LVU174
+# blake2s-lanes.c:42:             L->H[i][l] = ctx.H[i];
+	.loc 1 42 24 is_stmt 0 view .LVU175
+	movq	56(%rsp), %rdx	# ctx.H[3], ctx.H[3]
+	movq	%rdx, 96(%rbx)	# ctx.H[3], MEM <u64> [(struct blake2b_lanes *)_26 + 96B]
+	.loc 1 41 38 is_stmt 1 view .LVU176
+.LVL32:
+	.loc 1 41 32 view .LVU177
+	.loc 1 42 13 view .LVU178
+# blake2s-lanes.c:42:             L->H[i][l] = ctx.H[i];
+	.loc 1 42 24 is_stmt 0 view .LVU179
+	movq	64(%rsp), %rdx	# ctx.H[4], ctx.H[4]
+	movq	%rdx, 128(%rbx)	# ctx.H[4], MEM <u64> [(struct blake2b_lanes *)_26 + 128B]
+	.loc 1 41 38 is_stmt 1 view .LVU180
+.LVL33:
+	.loc 1 41 32 view .LVU181
+	.loc 1 42 13 view .LVU182
+# blake2s-lanes.c:42:             L->H[i][l] = ctx.H[i];
+	.loc 1 42 24 is_stmt 0 view .LVU183
+	movq	72(%rsp), %rdx	# ctx.H[5], ctx.H[5]
+	movq	%rdx, 160(%rbx)	# ctx.H[5], MEM <u64> [(struct blake2b_lanes *)_26 + 160B]
+	.loc 1 41 38 is_stmt 1 view .LVU184
+.LVL34:
+	.loc 1 41 32 view .LVU185
+	.loc 1 42 13 view .LVU186
+# blake2s-lanes.c:42:             L->H[i][l] = ctx.H[i];
+	.loc 1 42 24 is_stmt 0 view .LVU187
+	movq	80(%rsp), %rdx	# ctx.H[6], ctx.H[6]
+	movq	%rdx, 192(%rbx)	# ctx.H[6], MEM <u64> [(struct blake2b_lanes *)_26 + 192B]
+	.loc 1 41 38 is_stmt 1 view .LVU188
+.LVL35:
+	.loc 1 41 32 view .LVU189
+	.loc 1 42 13 view .LVU190
+# blake2s-lanes.c:42:             L->H[i][l] = ctx.H[i];
+	.loc 1 42 24 is_stmt 0 view .LVU191
+	movq	88(%rsp), %rdx	# ctx.H[7], ctx.H[7]
+	movq	%rdx, 224(%rbx)	# ctx.H[7], MEM <u64> [(struct blake2b_lanes *)_26 + 224B]
+	.loc 1 41 38 is_stmt 1 view .LVU192
+.LVL36:
+	.loc 1 41 32 view .LVU193
+.L19:
+	.loc 1 41 32 is_stmt 0 view .LVU194
+.LBE43:
+	.loc 1 31 35 is_stmt 1 discriminator 2 view .LVU195
+# blake2s-lanes.c:31:     for (unsigned l = 0; mask; l++, mask >>= 1) {
+	.loc 1 31 33 is_stmt 0 discriminator 2 view .LVU196
+	addl	$1, %r15d	#, l
+.LVL37:
+	.loc 1 31 26 is_stmt 1 discriminator 2 view .LVU197
+	shrl	%r12d	# mask
+.LVL38:
+	.loc 1 31 26 is_stmt 0 discriminator 2 view .LVU198
+	jne	.L20	#,
+.LBE45:
+# blake2s-lanes.c:44: }
+	.loc 1 44 1 view .LVU199
+	leaq	-40(%rbp), %rsp	#,
+	popq	%rbx	#
+	popq	%r12	#
+.LVL39:
+	.loc 1 44 1 view .LVU200
+	popq	%r13	#
+.LVL40:
+	.loc 1 44 1 view .LVU201
+	popq	%r14	#
+.LVL41:
+	.loc 1 44 1 view .LVU202
+	popq	%r15	#
+.LVL42:
+	.loc 1 44 1 view .LVU203
+	popq	%rbp	#
+	.cfi_def_cfa 7, 8
+	ret	
+.LVL43:
+	.p2align 4,,10
+	.p2align 3
+.L29:
+	.cfi_restore 3
+	.cfi_restore 6
+	.cfi_restore 12
+	.cfi_restore 13
+	.cfi_restore 14
+	.cfi_restore 15
+	.loc 1 44 1 view .LVU204
+	ret	
+	.cfi_endproc
+.LFE26:
+	.size	blake2b_compress_lanes_serial, .-blake2b_compress_lanes_serial
+.Letext0:
+	.file 4 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stddef.h"
+	.file 5 "/usr/include/x86_64-linux-gnu/bits/types.h"
+	.file 6 "/usr/include/x86_64-linux-gnu/bits/stdint-uintn.h"
+	.file 7 "blake2s.h"
+	.file 8 "blake2b.h"
+	.section	.debug_info,"",@progbits
+.Ldebug_info0:
+	.long	0x80d
+	.value	0x5
+	.byte	0x1
+	.byte	0x8
+	.long	.Ldebug_abbrev0
+	.uleb128 0x1f
+	.long	.LASF42
+	.byte	0xc
+	.long	.LASF0
+	.long	.LASF1
+	.quad	.Ltext0
+	.quad	.Letext0-.Ltext0
+	.long	.Ldebug_line0
+	.uleb128 0x6
+	.byte	0x8
+	.byte	0x5
+	.long	.LASF2
+	.uleb128 0x9
+	.long	.LASF8
+	.byte	0x4
+	.byte	0xd6
+	.byte	0x1b
+	.long	0x41
+	.uleb128 0x6
+	.byte	0x8
+	.byte	0x7
+	.long	.LASF3
+	.uleb128 0x20
+	.byte	0x4
+	.byte	0x5
+	.string	"int"
+	.uleb128 0x6
+	.byte	0x1
+	.byte	0x8
+	.long	.LASF4
+	.uleb128 0x6
+	.byte	0x2
+	.byte	0x7
+	.long	.LASF5
+	.uleb128 0x6
+	.byte	0x4
+	.byte	0x7
+	.long	.LASF6
+	.uleb128 0x6
+	.byte	0x1
+	.byte	0x6
+	.long	.LASF7
+	.uleb128 0x9
+	.long	.LASF9
+	.byte	0x5
+	.byte	0x26
+	.byte	0x17
+	.long	0x4f
+	.uleb128 0x6
+	.byte	0x2
+	.byte	0x5
+	.long	.LASF10
+	.uleb128 0x9
+	.long	.LASF11
+	.byte	0x5
+	.byte	0x2a
+	.byte	0x16
+	.long	0x5d
+	.uleb128 0x9
+	.long	.LASF12
+	.byte	0x5
+	.byte	0x2d
+	.byte	0x1b
+	.long	0x41
+	.uleb128 0x6
+	.byte	0x1
+	.byte	0x6
+	.long	.LASF13
+	.uleb128 0x8
+	.long	0x96
+	.uleb128 0x9
+	.long	.LASF14
+	.byte	0x6
+	.byte	0x18
+	.byte	0x13
+	.long	0x6b
+	.uleb128 0x9
+	.long	.LASF15
+	.byte	0x6
+	.byte	0x1a
+	.byte	0x14
+	.long	0x7e
+	.uleb128 0x9
+	.long	.LASF16
+	.byte	0x6
+	.byte	0x1b
+	.byte	0x14
+	.long	0x8a
+	.uleb128 0x21
+	.long	.LASF20
+	.byte	0x80
+	.byte	0x10
+	.byte	0x7
+	.byte	0xf7
+	.byte	0x8
+	.long	0x12a
+	.uleb128 0x7
+	.string	"H"
+	.byte	0x7
+	.byte	0xf8
+	.byte	0xe
+	.long	0x12a
+	.byte	0
+	.uleb128 0x7
+	.string	"buf"
+	.byte	0x7
+	.byte	0xf9
+	.byte	0x13
+	.long	0x13a
+	.byte	0x20
+	.uleb128 0x7
+	.string	"t"
+	.byte	0x7
+	.byte	0xfa
+	.byte	0xe
+	.long	0x14a
+	.byte	0x60
+	.uleb128 0x7
+	.string	"f"
+	.byte	0x7
+	.byte	0xfb
+	.byte	0xe
+	.long	0x14a
+	.byte	0x68
+	.uleb128 0x1
+	.long	.LASF17
+	.byte	0x7
+	.byte	0xfc
+	.byte	0xe
+	.long	0x5d
+	.byte	0x70
+	.uleb128 0x1
+	.long	.LASF18
+	.byte	0x7
+	.byte	0xfd
+	.byte	0xe
+	.long	0x5d
+	.byte	0x74
+	.uleb128 0x1
+	.long	.LASF19
+	.byte	0x7
+	.byte	0xfe
+	.byte	0xe
+	.long	0x5d
+	.byte	0x78
+	.byte	0
+	.uleb128 0x5
+	.long	0xae
+	.long	0x13a
+	.uleb128 0x2
+	.long	0x41
+	.byte	0x7
+	.byte	0
+	.uleb128 0x5
+	.long	0x4f
+	.long	0x14a
+	.uleb128 0x2
+	.long	0x41
+	.byte	0x3f
+	.byte	0
+	.uleb128 0x5
+	.long	0xae
+	.long	0x15a
+	.uleb128 0x2
+	.long	0x41
+	.byte	0x1
+	.byte	0
+	.uleb128 0x3
+	.long	0xc6
+	.uleb128 0x3
+	.long	0x164
+	.uleb128 0x22
+	.uleb128 0xf
+	.long	.LASF21
+	.value	0x100
+	.byte	0x20
+	.byte	0x8
+	.byte	0x32
+	.long	0x1c9
+	.uleb128 0x7
+	.string	"H"
+	.byte	0x8
+	.byte	0x33
+	.byte	0xe
+	.long	0x1c9
+	.byte	0
+	.uleb128 0x7
+	.string	"buf"
+	.byte	0x8
+	.byte	0x34
+	.byte	0x13
+	.long	0x1d9
+	.byte	0x40
+	.uleb128 0x7
+	.string	"t"
+	.byte	0x8
+	.byte	0x35
+	.byte	0xe
+	.long	0x1e9
+	.byte	0xc0
+	.uleb128 0x7
+	.string	"f"
+	.byte	0x8
+	.byte	0x36
+	.byte	0xe
+	.long	0x1e9
+	.byte	0xd0
+	.uleb128 0x1
+	.long	.LASF17
+	.byte	0x8
+	.byte	0x37
+	.byte	0xe
+	.long	0x5d
+	.byte	0xe0
+	.uleb128 0x1
+	.long	.LASF18
+	.byte	0x8
+	.byte	0x38
+	.byte	0xe
+	.long	0x5d
+	.byte	0xe4
+	.uleb128 0x1
+	.long	.LASF19
+	.byte	0x8
+	.byte	0x39
+	.byte	0xe
+	.long	0x5d
+	.byte	0xe8
+	.byte	0
+	.uleb128 0x5
+	.long	0xba
+	.long	0x1d9
+	.uleb128 0x2
+	.long	0x41
+	.byte	0x7
+	.byte	0
+	.uleb128 0x5
+	.long	0x4f
+	.long	0x1e9
+	.uleb128 0x2
+	.long	0x41
+	.byte	0x7f
+	.byte	0
+	.uleb128 0x5
+	.long	0xba
+	.long	0x1f9
+	.uleb128 0x2
+	.long	0x41
+	.byte	0x1
+	.byte	0
+	.uleb128 0x6
+	.byte	0x8
+	.byte	0x7
+	.long	.LASF22
+	.uleb128 0x6
+	.byte	0x8
+	.byte	0x5
+	.long	.LASF23
+	.uleb128 0x10
+	.string	"u8"
+	.byte	0x2
+	.byte	0x7
+	.byte	0x11
+	.long	0xa2
+	.uleb128 0x8
+	.long	0x207
+	.uleb128 0x10
+	.string	"u32"
+	.byte	0x2
+	.byte	0x8
+	.byte	0x12
+	.long	0xae
+	.uleb128 0x8
+	.long	0x217
+	.uleb128 0x5
+	.long	0x223
+	.long	0x238
+	.uleb128 0x2
+	.long	0x41
+	.byte	0x7
+	.byte	0
+	.uleb128 0x8
+	.long	0x228
+	.uleb128 0x11
+	.long	.LASF24
+	.byte	0x2
+	.byte	0xa
+	.byte	0x12
+	.long	0x238
+	.byte	0x20
+	.byte	0x67
+	.byte	0xe6
+	.byte	0x9
+	.byte	0x6a
+	.byte	0x85
+	.byte	0xae
+	.byte	0x67
+	.byte	0xbb
+	.byte	0x72
+	.byte	0xf3
+	.byte	0x6e
+	.byte	0x3c
+	.byte	0x3a
+	.byte	0xf5
+	.byte	0x4f
+	.byte	0xa5
+	.byte	0x7f
+	.byte	0x52
+	.byte	0xe
+	.byte	0x51
+	.byte	0x8c
+	.byte	0x68
+	.byte	0x5
+	.byte	0x9b
+	.byte	0xab
+	.byte	0xd9
+	.byte	0x83
+	.byte	0x1f
+	.byte	0x19
+	.byte	0xcd
+	.byte	0xe0
+	.byte	0x5b
+	.uleb128 0x5
+	.long	0x212
+	.long	0x280
+	.uleb128 0x2
+	.long	0x41
+	.byte	0x9
+	.uleb128 0x2
+	.long	0x41
+	.byte	0xf
+	.byte	0
+	.uleb128 0x8
+	.long	0x26a
+	.uleb128 0x11
+	.long	.LASF25
+	.byte	0x2
+	.byte	0xf
+	.byte	0x11
+	.long	0x280
+	.byte	0xa0
+	.byte	0
+	.byte	0x1
+	.byte	0x2
+	.byte	0x3
+	.byte	0x4
+	.byte	0x5
+	.byte	0x6
+	.byte	0x7
+	.byte	0x8
+	.byte	0x9
+	.byte	0xa
+	.byte	0xb
+	.byte	0xc
+	.byte	0xd
+	.byte	0xe
+	.byte	0xf
+	.byte	0xe
+	.byte	0xa
+	.byte	0x4
+	.byte	0x8
+	.byte	0x9
+	.byte	0xf
+	.byte	0xd
+	.byte	0x6
+	.byte	0x1
+	.byte	0xc
+	.byte	0
+	.byte	0x2
+	.byte	0xb
+	.byte	0x7
+	.byte	0x5
+	.byte	0x3
+	.byte	0xb
+	.byte	0x8
+	.byte	0xc
+	.byte	0
+	.byte	0x5
+	.byte	0x2
+	.byte	0xf
+	.byte	0xd
+	.byte	0xa
+	.byte	0xe
+	.byte	0x3
+	.byte	0x6
+	.byte	0x7
+	.byte	0x1
+	.byte	0x9
+	.byte	0x4
+	.byte	0x7
+	.byte	0x9
+	.byte	0x3
+	.byte	0x1
+	.byte	0xd
+	.byte	0xc
+	.byte	0xb
+	.byte	0xe
+	.byte	0x2
+	.byte	0x6
+	.byte	0x5
+	.byte	0xa
+	.byte	0x4
+	.byte	0
+	.byte	0xf
+	.byte	0x8
+	.byte	0x9
+	.byte	0
+	.byte	0x5
+	.byte	0x7
+	.byte	0x2
+	.byte	0x4
+	.byte	0xa
+	.byte	0xf
+	.byte	0xe
+	.byte	0x1
+	.byte	0xb
+	.byte	0xc
+	.byte	0x6
+	.byte	0x8
+	.byte	0x3
+	.byte	0xd
+	.byte	0x2
+	.byte	0xc
+	.byte	0x6
+	.byte	0xa
+	.byte	0
+	.byte	0xb
+	.byte	0x8
+	.byte	0x3
+	.byte	0x4
+	.byte	0xd
+	.byte	0x7
+	.byte	0x5
+	.byte	0xf
+	.byte	0xe
+	.byte	0x1
+	.byte	0x9
+	.byte	0xc
+	.byte	0x5
+	.byte	0x1
+	.byte	0xf
+	.byte	0xe
+	.byte	0xd
+	.byte	0x4
+	.byte	0xa
+	.byte	0
+	.byte	0x7
+	.byte	0x6
+	.byte	0x3
+	.byte	0x9
+	.byte	0x2
+	.byte	0x8
+	.byte	0xb
+	.byte	0xd
+	.byte	0xb
+	.byte	0x7
+	.byte	0xe
+	.byte	0xc
+	.byte	0x1
+	.byte	0x3
+	.byte	0x9
+	.byte	0x5
+	.byte	0
+	.byte	0xf
+	.byte	0x4
+	.byte	0x8
+	.byte	0x6
+	.byte	0x2
+	.byte	0xa
+	.byte	0x6
+	.byte	0xf
+	.byte	0xe
+	.byte	0x9
+	.byte	0xb
+	.byte	0x3
+	.byte	0
+	.byte	0x8
+	.byte	0xc
+	.byte	0x2
+	.byte	0xd
+	.byte	0x7
+	.byte	0x1
+	.byte	0x4
+	.byte	0xa
+	.byte	0x5
+	.byte	0xa
+	.byte	0x2
+	.byte	0x8
+	.byte	0x4
+	.byte	0x7
+	.byte	0x6
+	.byte	0x1
+	.byte	0x5
+	.byte	0xf
+	.byte	0xb
+	.byte	0x9
+	.byte	0xe
+	.byte	0x3
+	.byte	0xc
+	.byte	0xd
+	.byte	0
+	.uleb128 0xf
+	.long	.LASF26
+	.value	0x300
+	.byte	0x40
+	.byte	0x2
+	.byte	0x25
+	.long	0x362
+	.uleb128 0x7
+	.string	"H"
+	.byte	0x2
+	.byte	0x26
+	.byte	0x9
+	.long	0x362
+	.byte	0
+	.uleb128 0xc
+	.string	"t"
+	.byte	0x2
+	.byte	0x27
+	.long	0x378
+	.value	0x200
+	.uleb128 0xc
+	.string	"f"
+	.byte	0x2
+	.byte	0x28
+	.long	0x378
+	.value	0x280
+	.byte	0
+	.uleb128 0x5
+	.long	0x217
+	.long	0x378
+	.uleb128 0x2
+	.long	0x41
+	.byte	0x7
+	.uleb128 0x2
+	.long	0x41
+	.byte	0xf
+	.byte	0
+	.uleb128 0x5
+	.long	0x217
+	.long	0x38e
+	.uleb128 0x2
+	.long	0x41
+	.byte	0x1
+	.uleb128 0x2
+	.long	0x41
+	.byte	0xf
+	.byte	0
+	.uleb128 0x12
+	.long	.LASF35
+	.byte	0x2
+	.byte	0x31
+	.long	0x3e8
+	.uleb128 0x1
+	.long	.LASF27
+	.byte	0x2
+	.byte	0x32
+	.byte	0x11
+	.long	0x3ed
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF28
+	.byte	0x2
+	.byte	0x33
+	.byte	0xb
+	.long	0x3f7
+	.byte	0x8
+	.uleb128 0x1
+	.long	.LASF29
+	.byte	0x2
+	.byte	0x34
+	.byte	0xc
+	.long	0x40c
+	.byte	0x10
+	.uleb128 0x1
+	.long	.LASF30
+	.byte	0x2
+	.byte	0x35
+	.byte	0xc
+	.long	0x426
+	.byte	0x18
+	.uleb128 0x1
+	.long	.LASF31
+	.byte	0x2
+	.byte	0x37
+	.byte	0xe
+	.long	0x5d
+	.byte	0x20
+	.uleb128 0x1
+	.long	.LASF32
+	.byte	0x2
+	.byte	0x38
+	.byte	0xc
+	.long	0x44a
+	.byte	0x28
+	.byte	0
+	.uleb128 0x8
+	.long	0x38e
+	.uleb128 0x3
+	.long	0x9d
+	.uleb128 0x23
+	.long	0x48
+	.uleb128 0x3
+	.long	0x3f2
+	.uleb128 0xa
+	.long	0x40c
+	.uleb128 0x4
+	.long	0x15a
+	.uleb128 0x4
+	.long	0x15f
+	.byte	0
+	.uleb128 0x3
+	.long	0x3fc
+	.uleb128 0xa
+	.long	0x426
+	.uleb128 0x4
+	.long	0x15a
+	.uleb128 0x4
+	.long	0x15f
+	.uleb128 0x4
+	.long	0x35
+	.byte	0
+	.uleb128 0x3
+	.long	0x411
+	.uleb128 0xa
+	.long	0x440
+	.uleb128 0x4
+	.long	0x440
+	.uleb128 0x4
+	.long	0x445
+	.uleb128 0x4
+	.long	0x5d
+	.byte	0
+	.uleb128 0x3
+	.long	0x332
+	.uleb128 0x3
+	.long	0x15f
+	.uleb128 0x3
+	.long	0x42b
+	.uleb128 0x13
+	.long	.LASF37
+	.byte	0x2
+	.byte	0x3c
+	.long	0x45a
+	.uleb128 0x3
+	.long	0x3e8
+	.uleb128 0x10
+	.string	"u64"
+	.byte	0x3
+	.byte	0x6
+	.byte	0x12
+	.long	0xba
+	.uleb128 0x8
+	.long	0x45f
+	.uleb128 0x5
+	.long	0x46b
+	.long	0x480
+	.uleb128 0x2
+	.long	0x41
+	.byte	0x7
+	.byte	0
+	.uleb128 0x8
+	.long	0x470
+	.uleb128 0x11
+	.long	.LASF33
+	.byte	0x3
+	.byte	0x8
+	.byte	0x12
+	.long	0x480
+	.byte	0x40
+	.byte	0x8
+	.byte	0xc9
+	.byte	0xbc
+	.byte	0xf3
+	.byte	0x67
+	.byte	0xe6
+	.byte	0x9
+	.byte	0x6a
+	.byte	0x3b
+	.byte	0xa7
+	.byte	0xca
+	.byte	0x84
+	.byte	0x85
+	.byte	0xae
+	.byte	0x67
+	.byte	0xbb
+	.byte	0x2b
+	.byte	0xf8
+	.byte	0x94
+	.byte	0xfe
+	.byte	0x72
+	.byte	0xf3
+	.byte	0x6e
+	.byte	0x3c
+	.byte	0xf1
+	.byte	0x36
+	.byte	0x1d
+	.byte	0x5f
+	.byte	0x3a
+	.byte	0xf5
+	.byte	0x4f
+	.byte	0xa5
+	.byte	0xd1
+	.byte	0x82
+	.byte	0xe6
+	.byte	0xad
+	.byte	0x7f
+	.byte	0x52
+	.byte	0xe
+	.byte	0x51
+	.byte	0x1f
+	.byte	0x6c
+	.byte	0x3e
+	.byte	0x2b
+	.byte	0x8c
+	.byte	0x68
+	.byte	0x5
+	.byte	0x9b
+	.byte	0x6b
+	.byte	0xbd
+	.byte	0x41
+	.byte	0xfb
+	.byte	0xab
+	.byte	0xd9
+	.byte	0x83
+	.byte	0x1f
+	.byte	0x79
+	.byte	0x21
+	.byte	0x7e
+	.byte	0x13
+	.byte	0x19
+	.byte	0xcd
+	.byte	0xe0
+	.byte	0x5b
+	.uleb128 0xf
+	.long	.LASF34
+	.value	0x180
+	.byte	0x20
+	.byte	0x3
+	.byte	0x25
+	.long	0x502
+	.uleb128 0x7
+	.string	"H"
+	.byte	0x3
+	.byte	0x26
+	.byte	0x9
+	.long	0x502
+	.byte	0
+	.uleb128 0xc
+	.string	"t"
+	.byte	0x3
+	.byte	0x27
+	.long	0x518
+	.value	0x100
+	.uleb128 0xc
+	.string	"f"
+	.byte	0x3
+	.byte	0x28
+	.long	0x518
+	.value	0x140
+	.byte	0
+	.uleb128 0x5
+	.long	0x45f
+	.long	0x518
+	.uleb128 0x2
+	.long	0x41
+	.byte	0x7
+	.uleb128 0x2
+	.long	0x41
+	.byte	0x3
+	.byte	0
+	.uleb128 0x5
+	.long	0x45f
+	.long	0x52e
+	.uleb128 0x2
+	.long	0x41
+	.byte	0x1
+	.uleb128 0x2
+	.long	0x41
+	.byte	0x3
+	.byte	0
+	.uleb128 0x12
+	.long	.LASF36
+	.byte	0x3
+	.byte	0x2c
+	.long	0x588
+	.uleb128 0x1
+	.long	.LASF27
+	.byte	0x3
+	.byte	0x2d
+	.byte	0x11
+	.long	0x3ed
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF28
+	.byte	0x3
+	.byte	0x2e
+	.byte	0xb
+	.long	0x3f7
+	.byte	0x8
+	.uleb128 0x1
+	.long	.LASF29
+	.byte	0x3
+	.byte	0x2f
+	.byte	0xc
+	.long	0x5a2
+	.byte	0x10
+	.uleb128 0x1
+	.long	.LASF30
+	.byte	0x3
+	.byte	0x30
+	.byte	0xc
+	.long	0x5bc
+	.byte	0x18
+	.uleb128 0x1
+	.long	.LASF31
+	.byte	0x3
+	.byte	0x32
+	.byte	0xe
+	.long	0x5d
+	.byte	0x20
+	.uleb128 0x1
+	.long	.LASF32
+	.byte	0x3
+	.byte	0x33
+	.byte	0xc
+	.long	0x5db
+	.byte	0x28
+	.byte	0
+	.uleb128 0x8
+	.long	0x52e
+	.uleb128 0xa
+	.long	0x59d
+	.uleb128 0x4
+	.long	0x59d
+	.uleb128 0x4
+	.long	0x15f
+	.byte	0
+	.uleb128 0x3
+	.long	0x165
+	.uleb128 0x3
+	.long	0x58d
+	.uleb128 0xa
+	.long	0x5bc
+	.uleb128 0x4
+	.long	0x59d
+	.uleb128 0x4
+	.long	0x15f
+	.uleb128 0x4
+	.long	0x35
+	.byte	0
+	.uleb128 0x3
+	.long	0x5a7
+	.uleb128 0xa
+	.long	0x5d6
+	.uleb128 0x4
+	.long	0x5d6
+	.uleb128 0x4
+	.long	0x445
+	.uleb128 0x4
+	.long	0x5d
+	.byte	0
+	.uleb128 0x3
+	.long	0x4d2
+	.uleb128 0x3
+	.long	0x5c1
+	.uleb128 0x13
+	.long	.LASF38
+	.byte	0x3
+	.byte	0x37
+	.long	0x5eb
+	.uleb128 0x3
+	.long	0x588
+	.uleb128 0x14
+	.long	.LASF40
+	.byte	0x1b
+	.quad	.LFB26
+	.quad	.LFE26-.LFB26
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0x6de
+	.uleb128 0xd
+	.string	"L"
+	.byte	0x1b
+	.byte	0x3a
+	.long	0x5d6
+	.long	.LLST10
+	.long	.LVUS10
+	.uleb128 0xd
+	.string	"m"
+	.byte	0x1b
+	.byte	0x49
+	.long	0x445
+	.long	.LLST11
+	.long	.LVUS11
+	.uleb128 0x15
+	.long	.LASF39
+	.byte	0x1c
+	.long	0x5d
+	.long	.LLST12
+	.long	.LVUS12
+	.uleb128 0x16
+	.string	"ctx"
+	.byte	0x1e
+	.long	0x165
+	.uleb128 0x2
+	.byte	0x77
+	.sleb128 32
+	.uleb128 0x17
+	.long	.LLRL13
+	.uleb128 0xb
+	.string	"l"
+	.byte	0x1f
+	.byte	0x13
+	.long	0x5d
+	.long	.LLST14
+	.long	.LVUS14
+	.uleb128 0x18
+	.long	.LLRL17
+	.long	0x67e
+	.uleb128 0xb
+	.string	"i"
+	.byte	0x22
+	.byte	0x17
+	.long	0x5d
+	.long	.LLST18
+	.long	.LVUS18
+	.byte	0
+	.uleb128 0x19
+	.quad	.LBB43
+	.quad	.LBE43-.LBB43
+	.long	0x6a5
+	.uleb128 0xb
+	.string	"i"
+	.byte	0x29
+	.byte	0x17
+	.long	0x5d
+	.long	.LLST19
+	.long	.LVUS19
+	.byte	0
+	.uleb128 0x1a
+	.long	0x7cc
+	.quad	.LBI32
+	.byte	.LVU156
+	.long	.LLRL15
+	.byte	0x28
+	.uleb128 0x1b
+	.long	0x7e5
+	.uleb128 0x1c
+	.long	0x7d9
+	.long	.LLST16
+	.long	.LVUS16
+	.uleb128 0x1d
+	.quad	.LVL28
+	.uleb128 0x1e
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x3
+	.byte	0x77
+	.sleb128 24
+	.byte	0x6
+	.byte	0
+	.byte	0
+	.byte	0
+	.byte	0
+	.uleb128 0x14
+	.long	.LASF41
+	.byte	0x8
+	.quad	.LFB25
+	.quad	.LFE25-.LFB25
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0x7cc
+	.uleb128 0xd
+	.string	"L"
+	.byte	0x8
+	.byte	0x3a
+	.long	0x440
+	.long	.LLST0
+	.long	.LVUS0
+	.uleb128 0xd
+	.string	"m"
+	.byte	0x8
+	.byte	0x49
+	.long	0x445
+	.long	.LLST1
+	.long	.LVUS1
+	.uleb128 0x15
+	.long	.LASF39
+	.byte	0x9
+	.long	0x5d
+	.long	.LLST2
+	.long	.LVUS2
+	.uleb128 0x16
+	.string	"ctx"
+	.byte	0xb
+	.long	0xc6
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -192
+	.uleb128 0x17
+	.long	.LLRL3
+	.uleb128 0xb
+	.string	"l"
+	.byte	0xc
+	.byte	0x13
+	.long	0x5d
+	.long	.LLST4
+	.long	.LVUS4
+	.uleb128 0x18
+	.long	.LLRL7
+	.long	0x76d
+	.uleb128 0xb
+	.string	"i"
+	.byte	0xf
+	.byte	0x17
+	.long	0x5d
+	.long	.LLST8
+	.long	.LVUS8
+	.byte	0
+	.uleb128 0x19
+	.quad	.LBB28
+	.quad	.LBE28-.LBB28
+	.long	0x794
+	.uleb128 0xb
+	.string	"i"
+	.byte	0x16
+	.byte	0x17
+	.long	0x5d
+	.long	.LLST9
+	.long	.LVUS9
+	.byte	0
+	.uleb128 0x1a
+	.long	0x7f0
+	.quad	.LBI13
+	.byte	.LVU54
+	.long	.LLRL5
+	.byte	0x15
+	.uleb128 0x1b
+	.long	0x805
+	.uleb128 0x1c
+	.long	0x7f9
+	.long	.LLST6
+	.long	.LVUS6
+	.uleb128 0x1d
+	.quad	.LVL6
+	.uleb128 0x1e
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x7e
+	.sleb128 0
+	.byte	0
+	.byte	0
+	.byte	0
+	.byte	0
+	.uleb128 0x24
+	.long	.LASF43
+	.byte	0x3
+	.byte	0x46
+	.byte	0x14
+	.byte	0x3
+	.long	0x7f0
+	.uleb128 0xe
+	.string	"ctx"
+	.byte	0x3
+	.byte	0x46
+	.byte	0x39
+	.long	0x59d
+	.uleb128 0xe
+	.string	"m"
+	.byte	0x3
+	.byte	0x46
+	.byte	0x4a
+	.long	0x15f
+	.byte	0
+	.uleb128 0x25
+	.long	.LASF44
+	.byte	0x2
+	.byte	0x56
+	.byte	0x14
+	.byte	0x3
+	.uleb128 0xe
+	.string	"ctx"
+	.byte	0x2
+	.byte	0x56
+	.byte	0x39
+	.long	0x15a
+	.uleb128 0xe
+	.string	"m"
+	.byte	0x2
+	.byte	0x56
+	.byte	0x4a
+	.long	0x15f
+	.byte	0
+	.byte	0
+	.section	.debug_abbrev,"",@progbits
+.Ldebug_abbrev0:
+	.uleb128 0x1
+	.uleb128 0xd
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x38
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x2
+	.uleb128 0x21
+	.byte	0
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x2f
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xf
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0x21
+	.sleb128 8
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x4
+	.uleb128 0x5
+	.byte	0
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x5
+	.uleb128 0x1
+	.byte	0x1
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x6
+	.uleb128 0x24
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x3e
+	.uleb128 0xb
+	.uleb128 0x3
+	.uleb128 0xe
+	.byte	0
+	.byte	0
+	.uleb128 0x7
+	.uleb128 0xd
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x8
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x38
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x8
+	.uleb128 0x26
+	.byte	0
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x9
+	.uleb128 0x16
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0xa
+	.uleb128 0x15
+	.byte	0x1
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x8
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x2
+	.uleb128 0x17
+	.uleb128 0x2137
+	.uleb128 0x17
+	.byte	0
+	.byte	0
+	.uleb128 0xc
+	.uleb128 0xd
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x8
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 9
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x38
+	.uleb128 0x5
+	.byte	0
+	.byte	0
+	.uleb128 0xd
+	.uleb128 0x5
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x8
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x2
+	.uleb128 0x17
+	.uleb128 0x2137
+	.uleb128 0x17
+	.byte	0
+	.byte	0
+	.uleb128 0xe
+	.uleb128 0x5
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x8
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0xf
+	.uleb128 0x13
+	.byte	0x1
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0xb
+	.uleb128 0x5
+	.uleb128 0x88
+	.uleb128 0xb
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 8
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x10
+	.uleb128 0x16
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x8
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x11
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x1c
+	.uleb128 0xa
+	.byte	0
+	.byte	0
+	.uleb128 0x12
+	.uleb128 0x13
+	.byte	0x1
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0xb
+	.uleb128 0x21
+	.sleb128 48
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 8
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x13
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 37
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3c
+	.uleb128 0x19
+	.byte	0
+	.byte	0
+	.uleb128 0x14
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 6
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x11
+	.uleb128 0x1
+	.uleb128 0x12
+	.uleb128 0x7
+	.uleb128 0x40
+	.uleb128 0x18
+	.uleb128 0x7a
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x15
+	.uleb128 0x5
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 45
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x2
+	.uleb128 0x17
+	.uleb128 0x2137
+	.uleb128 0x17
+	.byte	0
+	.byte	0
+	.uleb128 0x16
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x8
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 24
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x2
+	.uleb128 0x18
+	.byte	0
+	.byte	0
+	.uleb128 0x17
+	.uleb128 0xb
+	.byte	0x1
+	.uleb128 0x55
+	.uleb128 0x17
+	.byte	0
+	.byte	0
+	.uleb128 0x18
+	.uleb128 0xb
+	.byte	0x1
+	.uleb128 0x55
+	.uleb128 0x17
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x19
+	.uleb128 0xb
+	.byte	0x1
+	.uleb128 0x11
+	.uleb128 0x1
+	.uleb128 0x12
+	.uleb128 0x7
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x1a
+	.uleb128 0x1d
+	.byte	0x1
+	.uleb128 0x31
+	.uleb128 0x13
+	.uleb128 0x52
+	.uleb128 0x1
+	.uleb128 0x2138
+	.uleb128 0xb
+	.uleb128 0x55
+	.uleb128 0x17
+	.uleb128 0x58
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x59
+	.uleb128 0xb
+	.uleb128 0x57
+	.uleb128 0x21
+	.sleb128 9
+	.byte	0
+	.byte	0
+	.uleb128 0x1b
+	.uleb128 0x5
+	.byte	0
+	.uleb128 0x31
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x1c
+	.uleb128 0x5
+	.byte	0
+	.uleb128 0x31
+	.uleb128 0x13
+	.uleb128 0x2
+	.uleb128 0x17
+	.uleb128 0x2137
+	.uleb128 0x17
+	.byte	0
+	.byte	0
+	.uleb128 0x1d
+	.uleb128 0x48
+	.byte	0x1
+	.uleb128 0x7d
+	.uleb128 0x1
+	.byte	0
+	.byte	0
+	.uleb128 0x1e
+	.uleb128 0x49
+	.byte	0
+	.uleb128 0x2
+	.uleb128 0x18
+	.uleb128 0x7e
+	.uleb128 0x18
+	.byte	0
+	.byte	0
+	.uleb128 0x1f
+	.uleb128 0x11
+	.byte	0x1
+	.uleb128 0x25
+	.uleb128 0xe
+	.uleb128 0x13
+	.uleb128 0xb
+	.uleb128 0x3
+	.uleb128 0x1f
+	.uleb128 0x1b
+	.uleb128 0x1f
+	.uleb128 0x11
+	.uleb128 0x1
+	.uleb128 0x12
+	.uleb128 0x7
+	.uleb128 0x10
+	.uleb128 0x17
+	.byte	0
+	.byte	0
+	.uleb128 0x20
+	.uleb128 0x24
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x3e
+	.uleb128 0xb
+	.uleb128 0x3
+	.uleb128 0x8
+	.byte	0
+	.byte	0
+	.uleb128 0x21
+	.uleb128 0x13
+	.byte	0x1
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x88
+	.uleb128 0xb
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x22
+	.uleb128 0x26
+	.byte	0
+	.byte	0
+	.byte	0
+	.uleb128 0x23
+	.uleb128 0x15
+	.byte	0
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x24
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x20
+	.uleb128 0xb
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x25
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x20
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.byte	0
+	.section	.debug_loclists,"",@progbits
+	.long	.Ldebug_loc3-.Ldebug_loc2
+.Ldebug_loc2:
+	.value	0x5
+	.byte	0x8
+	.byte	0
+	.long	0
+.Ldebug_loc0:
+.LVUS10:
+	.uleb128 0
+	.uleb128 .LVU112
+	.uleb128 .LVU112
+	.uleb128 .LVU201
+	.uleb128 .LVU201
+	.uleb128 .LVU204
+	.uleb128 .LVU204
+	.uleb128 0
+.LLST10:
+	.byte	0x4
+	.uleb128 .LVL22-.Ltext0
+	.uleb128 .LVL23-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL23-.Ltext0
+	.uleb128 .LVL40-.Ltext0
+	.uleb128 0x1
+	.byte	0x5d
+	.byte	0x4
+	.uleb128 .LVL40-.Ltext0
+	.uleb128 .LVL43-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL43-.Ltext0
+	.uleb128 .LFE26-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0
+.LVUS11:
+	.uleb128 0
+	.uleb128 .LVU112
+	.uleb128 .LVU112
+	.uleb128 .LVU202
+	.uleb128 .LVU202
+	.uleb128 .LVU204
+	.uleb128 .LVU204
+	.uleb128 0
+.LLST11:
+	.byte	0x4
+	.uleb128 .LVL22-.Ltext0
+	.uleb128 .LVL23-.Ltext0
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x4
+	.uleb128 .LVL23-.Ltext0
+	.uleb128 .LVL41-.Ltext0
+	.uleb128 0x1
+	.byte	0x5e
+	.byte	0x4
+	.uleb128 .LVL41-.Ltext0
+	.uleb128 .LVL43-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL43-.Ltext0
+	.uleb128 .LFE26-.Ltext0
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0
+.LVUS12:
+	.uleb128 0
+	.uleb128 .LVU112
+	.uleb128 .LVU112
+	.uleb128 .LVU197
+	.uleb128 .LVU197
+	.uleb128 .LVU198
+	.uleb128 .LVU198
+	.uleb128 .LVU200
+	.uleb128 .LVU204
+	.uleb128 0
+.LLST12:
+	.byte	0x4
+	.uleb128 .LVL22-.Ltext0
+	.uleb128 .LVL23-.Ltext0
+	.uleb128 0x1
+	.byte	0x51
+	.byte	0x4
+	.uleb128 .LVL23-.Ltext0
+	.uleb128 .LVL37-.Ltext0
+	.uleb128 0x1
+	.byte	0x5c
+	.byte	0x4
+	.uleb128 .LVL37-.Ltext0
+	.uleb128 .LVL38-.Ltext0
+	.uleb128 0x5
+	.byte	0x7c
+	.sleb128 0
+	.byte	0x31
+	.byte	0x25
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL38-.Ltext0
+	.uleb128 .LVL39-.Ltext0
+	.uleb128 0x1
+	.byte	0x5c
+	.byte	0x4
+	.uleb128 .LVL43-.Ltext0
+	.uleb128 .LFE26-.Ltext0
+	.uleb128 0x1
+	.byte	0x51
+	.byte	0
+.LVUS14:
+	.uleb128 .LVU107
+	.uleb128 .LVU112
+	.uleb128 .LVU112
+	.uleb128 .LVU203
+	.uleb128 .LVU204
+	.uleb128 0
+.LLST14:
+	.byte	0x4
+	.uleb128 .LVL22-.Ltext0
+	.uleb128 .LVL23-.Ltext0
+	.uleb128 0x2
+	.byte	0x30
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL23-.Ltext0
+	.uleb128 .LVL42-.Ltext0
+	.uleb128 0x1
+	.byte	0x5f
+	.byte	0x4
+	.uleb128 .LVL43-.Ltext0
+	.uleb128 .LFE26-.Ltext0
+	.uleb128 0x2
+	.byte	0x30
+	.byte	0x9f
+	.byte	0
+.LVUS18:
+	.uleb128 .LVU115
+	.uleb128 .LVU120
+	.uleb128 .LVU120
+	.uleb128 .LVU123
+	.uleb128 .LVU123
+	.uleb128 .LVU126
+	.uleb128 .LVU126
+	.uleb128 .LVU129
+	.uleb128 .LVU129
+	.uleb128 .LVU132
+	.uleb128 .LVU132
+	.uleb128 .LVU135
+	.uleb128 .LVU135
+	.uleb128 .LVU138
+	.uleb128 .LVU138
+	.uleb128 .LVU143
+	.uleb128 .LVU143
+	.uleb128 .LVU194
+.LLST18:
+	.byte	0x4
+	.uleb128 .LVL24-.Ltext0
+	.uleb128 .LVL25-.Ltext0
+	.uleb128 0x2
+	.byte	0x30
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL25-.Ltext0
+	.uleb128 .LVL25-.Ltext0
+	.uleb128 0x2
+	.byte	0x31
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL25-.Ltext0
+	.uleb128 .LVL25-.Ltext0
+	.uleb128 0x2
+	.byte	0x32
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL25-.Ltext0
+	.uleb128 .LVL25-.Ltext0
+	.uleb128 0x2
+	.byte	0x33
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL25-.Ltext0
+	.uleb128 .LVL25-.Ltext0
+	.uleb128 0x2
+	.byte	0x34
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL25-.Ltext0
+	.uleb128 .LVL25-.Ltext0
+	.uleb128 0x2
+	.byte	0x35
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL25-.Ltext0
+	.uleb128 .LVL25-.Ltext0
+	.uleb128 0x2
+	.byte	0x36
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL25-.Ltext0
+	.uleb128 .LVL26-.Ltext0
+	.uleb128 0x2
+	.byte	0x37
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL26-.Ltext0
+	.uleb128 .LVL36-.Ltext0
+	.uleb128 0x2
+	.byte	0x38
+	.byte	0x9f
+	.byte	0
+.LVUS19:
+	.uleb128 .LVU161
+	.uleb128 .LVU165
+	.uleb128 .LVU165
+	.uleb128 .LVU169
+	.uleb128 .LVU169
+	.uleb128 .LVU173
+	.uleb128 .LVU173
+	.uleb128 .LVU177
+	.uleb128 .LVU177
+	.uleb128 .LVU181
+	.uleb128 .LVU181
+	.uleb128 .LVU185
+	.uleb128 .LVU185
+	.uleb128 .LVU189
+	.uleb128 .LVU189
+	.uleb128 .LVU193
+	.uleb128 .LVU193
+	.uleb128 .LVU194
+.LLST19:
+	.byte	0x4
+	.uleb128 .LVL28-.Ltext0
+	.uleb128 .LVL29-.Ltext0
+	.uleb128 0x2
+	.byte	0x30
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL29-.Ltext0
+	.uleb128 .LVL30-.Ltext0
+	.uleb128 0x2
+	.byte	0x31
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL30-.Ltext0
+	.uleb128 .LVL31-.Ltext0
+	.uleb128 0x2
+	.byte	0x32
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL31-.Ltext0
+	.uleb128 .LVL32-.Ltext0
+	.uleb128 0x2
+	.byte	0x33
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL32-.Ltext0
+	.uleb128 .LVL33-.Ltext0
+	.uleb128 0x2
+	.byte	0x34
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL33-.Ltext0
+	.uleb128 .LVL34-.Ltext0
+	.uleb128 0x2
+	.byte	0x35
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL34-.Ltext0
+	.uleb128 .LVL35-.Ltext0
+	.uleb128 0x2
+	.byte	0x36
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL35-.Ltext0
+	.uleb128 .LVL36-.Ltext0
+	.uleb128 0x2
+	.byte	0x37
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL36-.Ltext0
+	.uleb128 .LVL36-.Ltext0
+	.uleb128 0x2
+	.byte	0x38
+	.byte	0x9f
+	.byte	0
+.LVUS16:
+	.uleb128 .LVU156
+	.uleb128 .LVU158
+.LLST16:
+	.byte	0x4
+	.uleb128 .LVL27-.Ltext0
+	.uleb128 .LVL28-.Ltext0
+	.uleb128 0x3
+	.byte	0x77
+	.sleb128 32
+	.byte	0x9f
+	.byte	0
+.LVUS0:
+	.uleb128 0
+	.uleb128 .LVU9
+	.uleb128 .LVU9
+	.uleb128 .LVU99
+	.uleb128 .LVU99
+	.uleb128 .LVU102
+	.uleb128 .LVU102
+	.uleb128 0
+.LLST0:
+	.byte	0x4
+	.uleb128 .LVL0-.Ltext0
+	.uleb128 .LVL1-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL1-.Ltext0
+	.uleb128 .LVL18-.Ltext0
+	.uleb128 0x1
+	.byte	0x5c
+	.byte	0x4
+	.uleb128 .LVL18-.Ltext0
+	.uleb128 .LVL21-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL21-.Ltext0
+	.uleb128 .LFE25-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0
+.LVUS1:
+	.uleb128 0
+	.uleb128 .LVU9
+	.uleb128 .LVU9
+	.uleb128 .LVU100
+	.uleb128 .LVU100
+	.uleb128 .LVU102
+	.uleb128 .LVU102
+	.uleb128 0
+.LLST1:
+	.byte	0x4
+	.uleb128 .LVL0-.Ltext0
+	.uleb128 .LVL1-.Ltext0
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x4
+	.uleb128 .LVL1-.Ltext0
+	.uleb128 .LVL19-.Ltext0
+	.uleb128 0x1
+	.byte	0x5d
+	.byte	0x4
+	.uleb128 .LVL19-.Ltext0
+	.uleb128 .LVL21-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL21-.Ltext0
+	.uleb128 .LFE25-.Ltext0
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0
+.LVUS2:
+	.uleb128 0
+	.uleb128 .LVU9
+	.uleb128 .LVU9
+	.uleb128 .LVU95
+	.uleb128 .LVU95
+	.uleb128 .LVU96
+	.uleb128 .LVU96
+	.uleb128 .LVU98
+	.uleb128 .LVU102
+	.uleb128 0
+.LLST2:
+	.byte	0x4
+	.uleb128 .LVL0-.Ltext0
+	.uleb128 .LVL1-.Ltext0
+	.uleb128 0x1
+	.byte	0x51
+	.byte	0x4
+	.uleb128 .LVL1-.Ltext0
+	.uleb128 .LVL15-.Ltext0
+	.uleb128 0x1
+	.byte	0x56
+	.byte	0x4
+	.uleb128 .LVL15-.Ltext0
+	.uleb128 .LVL16-.Ltext0
+	.uleb128 0x5
+	.byte	0x76
+	.sleb128 0
+	.byte	0x31
+	.byte	0x25
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL16-.Ltext0
+	.uleb128 .LVL17-.Ltext0
+	.uleb128 0x1
+	.byte	0x56
+	.byte	0x4
+	.uleb128 .LVL21-.Ltext0
+	.uleb128 .LFE25-.Ltext0
+	.uleb128 0x1
+	.byte	0x51
+	.byte	0
+.LVUS4:
+	.uleb128 .LVU4
+	.uleb128 .LVU9
+	.uleb128 .LVU9
+	.uleb128 .LVU101
+	.uleb128 .LVU102
+	.uleb128 0
+.LLST4:
+	.byte	0x4
+	.uleb128 .LVL0-.Ltext0
+	.uleb128 .LVL1-.Ltext0
+	.uleb128 0x2
+	.byte	0x30
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL1-.Ltext0
+	.uleb128 .LVL20-.Ltext0
+	.uleb128 0x1
+	.byte	0x5f
+	.byte	0x4
+	.uleb128 .LVL21-.Ltext0
+	.uleb128 .LFE25-.Ltext0
+	.uleb128 0x2
+	.byte	0x30
+	.byte	0x9f
+	.byte	0
+.LVUS8:
+	.uleb128 .LVU12
+	.uleb128 .LVU16
+	.uleb128 .LVU16
+	.uleb128 .LVU19
+	.uleb128 .LVU19
+	.uleb128 .LVU22
+	.uleb128 .LVU22
+	.uleb128 .LVU25
+	.uleb128 .LVU25
+	.uleb128 .LVU28
+	.uleb128 .LVU28
+	.uleb128 .LVU31
+	.uleb128 .LVU31
+	.uleb128 .LVU34
+	.uleb128 .LVU34
+	.uleb128 .LVU43
+	.uleb128 .LVU43
+	.uleb128 .LVU92
+.LLST8:
+	.byte	0x4
+	.uleb128 .LVL2-.Ltext0
+	.uleb128 .LVL3-.Ltext0
+	.uleb128 0x2
+	.byte	0x30
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL3-.Ltext0
+	.uleb128 .LVL3-.Ltext0
+	.uleb128 0x2
+	.byte	0x31
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL3-.Ltext0
+	.uleb128 .LVL3-.Ltext0
+	.uleb128 0x2
+	.byte	0x32
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL3-.Ltext0
+	.uleb128 .LVL3-.Ltext0
+	.uleb128 0x2
+	.byte	0x33
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL3-.Ltext0
+	.uleb128 .LVL3-.Ltext0
+	.uleb128 0x2
+	.byte	0x34
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL3-.Ltext0
+	.uleb128 .LVL3-.Ltext0
+	.uleb128 0x2
+	.byte	0x35
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL3-.Ltext0
+	.uleb128 .LVL3-.Ltext0
+	.uleb128 0x2
+	.byte	0x36
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL3-.Ltext0
+	.uleb128 .LVL4-.Ltext0
+	.uleb128 0x2
+	.byte	0x37
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL4-.Ltext0
+	.uleb128 .LVL14-.Ltext0
+	.uleb128 0x2
+	.byte	0x38
+	.byte	0x9f
+	.byte	0
+.LVUS9:
+	.uleb128 .LVU59
+	.uleb128 .LVU63
+	.uleb128 .LVU63
+	.uleb128 .LVU67
+	.uleb128 .LVU67
+	.uleb128 .LVU71
+	.uleb128 .LVU71
+	.uleb128 .LVU75
+	.uleb128 .LVU75
+	.uleb128 .LVU79
+	.uleb128 .LVU79
+	.uleb128 .LVU83
+	.uleb128 .LVU83
+	.uleb128 .LVU87
+	.uleb128 .LVU87
+	.uleb128 .LVU91
+	.uleb128 .LVU91
+	.uleb128 .LVU92
+.LLST9:
+	.byte	0x4
+	.uleb128 .LVL6-.Ltext0
+	.uleb128 .LVL7-.Ltext0
+	.uleb128 0x2
+	.byte	0x30
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL7-.Ltext0
+	.uleb128 .LVL8-.Ltext0
+	.uleb128 0x2
+	.byte	0x31
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL8-.Ltext0
+	.uleb128 .LVL9-.Ltext0
+	.uleb128 0x2
+	.byte	0x32
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL9-.Ltext0
+	.uleb128 .LVL10-.Ltext0
+	.uleb128 0x2
+	.byte	0x33
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL10-.Ltext0
+	.uleb128 .LVL11-.Ltext0
+	.uleb128 0x2
+	.byte	0x34
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL11-.Ltext0
+	.uleb128 .LVL12-.Ltext0
+	.uleb128 0x2
+	.byte	0x35
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL12-.Ltext0
+	.uleb128 .LVL13-.Ltext0
+	.uleb128 0x2
+	.byte	0x36
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL13-.Ltext0
+	.uleb128 .LVL14-.Ltext0
+	.uleb128 0x2
+	.byte	0x37
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL14-.Ltext0
+	.uleb128 .LVL14-.Ltext0
+	.uleb128 0x2
+	.byte	0x38
+	.byte	0x9f
+	.byte	0
+.LVUS6:
+	.uleb128 .LVU54
+	.uleb128 .LVU56
+.LLST6:
+	.byte	0x4
+	.uleb128 .LVL5-.Ltext0
+	.uleb128 .LVL6-.Ltext0
+	.uleb128 0x1
+	.byte	0x5e
+	.byte	0
+.Ldebug_loc3:
+	.section	.debug_aranges,"",@progbits
+	.long	0x2c
+	.value	0x2
+	.long	.Ldebug_info0
+	.byte	0x8
+	.byte	0
+	.value	0
+	.value	0
+	.quad	.Ltext0
+	.quad	.Letext0-.Ltext0
+	.quad	0
+	.quad	0
+	.section	.debug_rnglists,"",@progbits
+.Ldebug_ranges0:
+	.long	.Ldebug_ranges3-.Ldebug_ranges2
+.Ldebug_ranges2:
+	.value	0x5
+	.byte	0x8
+	.byte	0
+	.long	0
+.LLRL3:
+	.byte	0x4
+	.uleb128 .LBB12-.Ltext0
+	.uleb128 .LBE12-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB29-.Ltext0
+	.uleb128 .LBE29-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB30-.Ltext0
+	.uleb128 .LBE30-.Ltext0
+	.byte	0
+.LLRL5:
+	.byte	0x4
+	.uleb128 .LBB13-.Ltext0
+	.uleb128 .LBE13-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB19-.Ltext0
+	.uleb128 .LBE19-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB21-.Ltext0
+	.uleb128 .LBE21-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB27-.Ltext0
+	.uleb128 .LBE27-.Ltext0
+	.byte	0
+.LLRL7:
+	.byte	0x4
+	.uleb128 .LBB18-.Ltext0
+	.uleb128 .LBE18-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB20-.Ltext0
+	.uleb128 .LBE20-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB22-.Ltext0
+	.uleb128 .LBE22-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB23-.Ltext0
+	.uleb128 .LBE23-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB24-.Ltext0
+	.uleb128 .LBE24-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB25-.Ltext0
+	.uleb128 .LBE25-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB26-.Ltext0
+	.uleb128 .LBE26-.Ltext0
+	.byte	0
+.LLRL13:
+	.byte	0x4
+	.uleb128 .LBB31-.Ltext0
+	.uleb128 .LBE31-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB44-.Ltext0
+	.uleb128 .LBE44-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB45-.Ltext0
+	.uleb128 .LBE45-.Ltext0
+	.byte	0
+.LLRL15:
+	.byte	0x4
+	.uleb128 .LBB32-.Ltext0
+	.uleb128 .LBE32-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB37-.Ltext0
+	.uleb128 .LBE37-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB42-.Ltext0
+	.uleb128 .LBE42-.Ltext0
+	.byte	0
+.LLRL17:
+	.byte	0x4
+	.uleb128 .LBB36-.Ltext0
+	.uleb128 .LBE36-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB38-.Ltext0
+	.uleb128 .LBE38-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB39-.Ltext0
+	.uleb128 .LBE39-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB40-.Ltext0
+	.uleb128 .LBE40-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB41-.Ltext0
+	.uleb128 .LBE41-.Ltext0
+	.byte	0
+.Ldebug_ranges3:
+	.section	.debug_line,"",@progbits
+.Ldebug_line0:
+	.section	.debug_str,"MS",@progbits,1
+.LASF41:
+	.string	"blake2s_compress_lanes_serial"
+.LASF36:
+	.string	"blake2b_kernel"
+.LASF9:
+	.string	"__uint8_t"
+.LASF8:
+	.string	"size_t"
+.LASF32:
+	.string	"compress_lanes"
+.LASF43:
+	.string	"blake2b_compress"
+.LASF18:
+	.string	"digest_len"
+.LASF26:
+	.string	"blake2s_lanes"
+.LASF39:
+	.string	"mask"
+.LASF31:
+	.string	"lanes"
+.LASF10:
+	.string	"short int"
+.LASF25:
+	.string	"blake2s_sigma"
+.LASF16:
+	.string	"uint64_t"
+.LASF29:
+	.string	"compress"
+.LASF35:
+	.string	"blake2s_kernel"
+.LASF4:
+	.string	"unsigned char"
+.LASF28:
+	.string	"usable"
+.LASF24:
+	.string	"blake2s_iv"
+.LASF3:
+	.string	"long unsigned int"
+.LASF5:
+	.string	"short unsigned int"
+.LASF17:
+	.string	"buf_len"
+.LASF11:
+	.string	"__uint32_t"
+.LASF30:
+	.string	"compress_blocks"
+.LASF19:
+	.string	"last_node"
+.LASF6:
+	.string	"unsigned int"
+.LASF22:
+	.string	"long long unsigned int"
+.LASF14:
+	.string	"uint8_t"
+.LASF34:
+	.string	"blake2b_lanes"
+.LASF38:
+	.string	"blake2b_kern"
+.LASF40:
+	.string	"blake2b_compress_lanes_serial"
+.LASF23:
+	.string	"long long int"
+.LASF27:
+	.string	"name"
+.LASF21:
+	.string	"blake2b_ctx"
+.LASF44:
+	.string	"blake2s_compress"
+.LASF12:
+	.string	"__uint64_t"
+.LASF42:
+	.string	"GNU C99 12.2.0 -mtune=generic -march=x86-64 -g -O3 -std=c99 -fasynchronous-unwind-tables"
+.LASF15:
+	.string	"uint32_t"
+.LASF2:
+	.string	"long int"
+.LASF13:
+	.string	"char"
+.LASF20:
+	.string	"blake2s_ctx"
+.LASF7:
+	.string	"signed char"
+.LASF37:
+	.string	"blake2s_kern"
+.LASF33:
+	.string	"blake2b_iv"
+	.section	.debug_line_str,"MS",@progbits,1
+.LASF1:
+	.string	"/root/repo"
+.LASF0:
+	.string	"blake2s-lanes.c"
+	.ident	"GCC: (Debian 12.2.0-14+deb12u1) 12.2.0"
+	.section	.note.GNU-stack,"",@progbits
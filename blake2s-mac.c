@@ -0,0 +1,63 @@
+#include <string.h>
+
+#include "blake2s.h"
+#include "blake2s-internal.h"
+
+/* Keyed MACs from a precomputed key
+ *
+ * A keyed context holds the padded key as its first block, and only
+ * compresses it once data follows. A blake2s_mac_key keeps the chaining
+ * value after that compression instead, plus the MAC of the empty
+ * message, the one case where the key block is also the final block.
+ * A MAC started from the key has absorbed nothing while its buf_len
+ * is 0: blake2s_update() always leaves data in the buffer. Until then
+ * its buf holds that empty MAC, and blake2s_final() and the lanes put
+ * it out for a context with a count but no data held back.
+ */
+int blake2s_mac_key_init(struct blake2s_mac_key *K, const void *salt,
+                         const void *key, unsigned key_len, unsigned dig_len)
+{
+    struct blake2s_ctx ctx, empty;
+
+    if (blake2s_init_keyed(&ctx, salt, key, key_len, dig_len) < 0)
+        return -1;
+    empty = ctx;
+    blake2s_final(&empty, K->empty);
+
+    ctx.t[0] = BLAKE2S_BLOCK;
+    blake2s_compress(&ctx, ctx.buf);
+    memcpy(K->H, ctx.H, sizeof(K->H));
+    K->digest_len = dig_len;
+    memset(&ctx, 0, sizeof(ctx));
+    return 0;
+}
+
+void blake2s_mac_init(struct blake2s_ctx *ctx, const struct blake2s_mac_key *K)
+{
+    memcpy(ctx->H, K->H, sizeof(ctx->H));
+    ctx->t[0] = BLAKE2S_BLOCK;
+    ctx->t[1] = 0;
+    ctx->f[0] = 0;
+    ctx->f[1] = 0;
+    ctx->buf_len = 0;
+    ctx->digest_len = K->digest_len;
+    ctx->last_node = 0;
+    memcpy(ctx->buf, K->empty, K->digest_len);
+}
+
+void blake2s_mac_final(struct blake2s_ctx *ctx, const struct blake2s_mac_key *K,
+                       unsigned char *out)
+{
+    (void)K;
+    blake2s_final(ctx, out);
+}
+
+void blake2s_mac(unsigned char *out, const struct blake2s_mac_key *K,
+                 const void *src, size_t len)
+{
+    struct blake2s_ctx ctx;
+
+    blake2s_mac_init(&ctx, K);
+    blake2s_update(&ctx, src, len);
+    blake2s_mac_final(&ctx, K, out);
+}
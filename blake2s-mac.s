@@ -0,0 +1,2774 @@
+	.file	"blake2s-mac.c"
+# GNU C99 (Debian 12.2.0-14+deb12u1) version 12.2.0 (x86_64-linux-gnu)
+#	compiled by GNU C version 12.2.0, GMP version 6.2.1, MPFR version 4.2.0, MPC version 1.3.1, isl version isl-0.25-GMP
+
+# GGC heuristics: --param ggc-min-expand=100 --param ggc-min-heapsize=131072
+# options passed: -mtune=generic -march=x86-64 -g -O3 -std=c99 -fasynchronous-unwind-tables
+	.text
+.Ltext0:
+	.file 0 "/root/repo" "blake2s-mac.c"
+	.p2align 4
+	.globl	blake2s_mac_key_init
+	.type	blake2s_mac_key_init, @function
+blake2s_mac_key_init:
+.LVL0:
+.LFB17:
+	.file 1 "blake2s-mac.c"
+	.loc 1 19 1 view -0
+	.cfi_startproc
+	.loc 1 20 5 view .LVU1
+	.loc 1 22 5 view .LVU2
+# blake2s-mac.c:19: {
+	.loc 1 19 1 is_stmt 0 view .LVU3
+	pushq	%r12	#
+	.cfi_def_cfa_offset 16
+	.cfi_offset 12, -16
+	pushq	%rbp	#
+	.cfi_def_cfa_offset 24
+	.cfi_offset 6, -24
+	movl	%r8d, %ebp	# tmp117, dig_len
+	pushq	%rbx	#
+	.cfi_def_cfa_offset 32
+	.cfi_offset 3, -32
+	movq	%rdi, %rbx	# tmp113, K
+	subq	$256, %rsp	#,
+	.cfi_def_cfa_offset 288
+# blake2s-mac.c:22:     if (blake2s_init_keyed(&ctx, salt, key, key_len, dig_len) < 0)
+	.loc 1 22 9 view .LVU4
+	movq	%rsp, %r12	#, tmp93
+	movq	%r12, %rdi	# tmp93,
+.LVL1:
+	.loc 1 22 9 view .LVU5
+	call	blake2s_init_keyed@PLT	#
+.LVL2:
+# blake2s-mac.c:22:     if (blake2s_init_keyed(&ctx, salt, key, key_len, dig_len) < 0)
+	.loc 1 22 8 view .LVU6
+	testl	%eax, %eax	# tmp118
+	js	.L3	#,
+	.loc 1 24 5 is_stmt 1 view .LVU7
+# blake2s-mac.c:24:     empty = ctx;
+	.loc 1 24 11 is_stmt 0 view .LVU8
+	movdqa	(%rsp), %xmm0	# ctx, tmp120
+	movdqa	16(%rsp), %xmm1	# ctx, tmp121
+# blake2s-mac.c:25:     blake2s_final(&empty, K->empty);
+	.loc 1 25 28 view .LVU9
+	leaq	32(%rbx), %rsi	#, tmp102
+# blake2s-mac.c:25:     blake2s_final(&empty, K->empty);
+	.loc 1 25 5 view .LVU10
+	leaq	128(%rsp), %rdi	#, tmp103
+# blake2s-mac.c:24:     empty = ctx;
+	.loc 1 24 11 view .LVU11
+	movdqa	32(%rsp), %xmm2	# ctx, tmp122
+	movdqa	48(%rsp), %xmm3	# ctx, tmp123
+	movdqa	64(%rsp), %xmm4	# ctx, tmp124
+	movdqa	80(%rsp), %xmm5	# ctx, tmp125
+	movaps	%xmm0, 128(%rsp)	# tmp120, empty
+	movdqa	96(%rsp), %xmm6	# ctx, tmp126
+	movdqa	112(%rsp), %xmm7	# ctx, tmp127
+	movaps	%xmm1, 144(%rsp)	# tmp121, empty
+	movaps	%xmm2, 160(%rsp)	# tmp122, empty
+	movaps	%xmm3, 176(%rsp)	# tmp123, empty
+	movaps	%xmm4, 192(%rsp)	# tmp124, empty
+	movaps	%xmm5, 208(%rsp)	# tmp125, empty
+	movaps	%xmm6, 224(%rsp)	# tmp126, empty
+	movaps	%xmm7, 240(%rsp)	# tmp127, empty
+	.loc 1 25 5 is_stmt 1 view .LVU12
+	call	blake2s_final@PLT	#
+.LVL3:
+	.loc 1 27 5 view .LVU13
+.LBB6:
+.LBB7:
+# blake2s-internal.h:88:     blake2s_kern->compress(ctx, m);
+	.file 2 "blake2s-internal.h"
+	.loc 2 88 5 is_stmt 0 view .LVU14
+	movq	blake2s_kern(%rip), %rax	# blake2s_kern, blake2s_kern
+	leaq	32(%rsp), %rsi	#, tmp105
+	movq	%r12, %rdi	# tmp93,
+.LBE7:
+.LBE6:
+# blake2s-mac.c:27:     ctx.t[0] = BLAKE2S_BLOCK;
+	.loc 1 27 14 view .LVU15
+	movl	$64, 96(%rsp)	#, ctx.t[0]
+	.loc 1 28 5 is_stmt 1 view .LVU16
+.LVL4:
+.LBB9:
+.LBI6:
+	.loc 2 86 20 view .LVU17
+.LBB8:
+	.loc 2 88 5 view .LVU18
+	call	*16(%rax)	# blake2s_kern.0_20->compress
+.LVL5:
+	.loc 2 88 5 is_stmt 0 view .LVU19
+.LBE8:
+.LBE9:
+	.loc 1 29 5 is_stmt 1 view .LVU20
+	movdqa	(%rsp), %xmm0	# MEM <char[1:32]> [(void *)&ctx], tmp128
+	movdqa	16(%rsp), %xmm1	# MEM <char[1:32]> [(void *)&ctx], tmp129
+# blake2s-mac.c:32:     return 0;
+	.loc 1 32 12 is_stmt 0 view .LVU21
+	xorl	%eax, %eax	# <retval>
+# blake2s-mac.c:30:     K->digest_len = dig_len;
+	.loc 1 30 19 view .LVU22
+	movl	%ebp, 64(%rbx)	# dig_len, K_13(D)->digest_len
+# blake2s-mac.c:29:     memcpy(K->H, ctx.H, sizeof(K->H));
+	.loc 1 29 5 view .LVU23
+	movups	%xmm0, (%rbx)	# tmp128, MEM <char[1:32]> [(void *)K_13(D)]
+	movups	%xmm1, 16(%rbx)	# tmp129, MEM <char[1:32]> [(void *)K_13(D)]
+	.loc 1 30 5 is_stmt 1 view .LVU24
+	.loc 1 31 5 view .LVU25
+	.loc 1 32 5 view .LVU26
+.L1:
+# blake2s-mac.c:33: }
+	.loc 1 33 1 is_stmt 0 view .LVU27
+	addq	$256, %rsp	#,
+	.cfi_remember_state
+	.cfi_def_cfa_offset 32
+	popq	%rbx	#
+	.cfi_def_cfa_offset 24
+.LVL6:
+	.loc 1 33 1 view .LVU28
+	popq	%rbp	#
+	.cfi_def_cfa_offset 16
+.LVL7:
+	.loc 1 33 1 view .LVU29
+	popq	%r12	#
+	.cfi_def_cfa_offset 8
+	ret	
+.LVL8:
+	.p2align 4,,10
+	.p2align 3
+.L3:
+	.cfi_restore_state
+# blake2s-mac.c:23:         return -1;
+	.loc 1 23 16 view .LVU30
+	movl	$-1, %eax	#, <retval>
+	jmp	.L1	#
+	.cfi_endproc
+.LFE17:
+	.size	blake2s_mac_key_init, .-blake2s_mac_key_init
+	.p2align 4
+	.globl	blake2s_mac_init
+	.type	blake2s_mac_init, @function
+blake2s_mac_init:
+.LVL9:
+.LFB18:
+	.loc 1 36 1 is_stmt 1 view -0
+	.cfi_startproc
+	.loc 1 37 5 view .LVU32
+	movdqu	(%rsi), %xmm1	# MEM <char[1:32]> [(void *)K_7(D)], tmp104
+# blake2s-mac.c:38:     ctx->t[0] = BLAKE2S_BLOCK;
+	.loc 1 38 15 is_stmt 0 view .LVU33
+	movdqa	.LC0(%rip), %xmm0	#, tmp92
+# blake2s-mac.c:45:     memcpy(ctx->buf, K->empty, K->digest_len);
+	.loc 1 45 5 view .LVU34
+	addq	$32, %rdi	#, tmp93
+.LVL10:
+	.loc 1 45 5 view .LVU35
+	addq	$32, %rsi	#, tmp95
+.LVL11:
+# blake2s-mac.c:37:     memcpy(ctx->H, K->H, sizeof(ctx->H));
+	.loc 1 37 5 view .LVU36
+	movups	%xmm1, -32(%rdi)	# tmp104, MEM <char[1:32]> [(void *)ctx_8(D)]
+	movdqu	-16(%rsi), %xmm2	# MEM <char[1:32]> [(void *)K_7(D)], tmp105
+# blake2s-mac.c:38:     ctx->t[0] = BLAKE2S_BLOCK;
+	.loc 1 38 15 view .LVU37
+	movaps	%xmm0, 64(%rdi)	# tmp92, MEM <vector(4) unsigned int> [(unsigned int *)ctx_8(D) + 96B]
+# blake2s-mac.c:37:     memcpy(ctx->H, K->H, sizeof(ctx->H));
+	.loc 1 37 5 view .LVU38
+	movups	%xmm2, -16(%rdi)	# tmp105, MEM <char[1:32]> [(void *)ctx_8(D)]
+	.loc 1 38 5 is_stmt 1 view .LVU39
+	.loc 1 39 5 view .LVU40
+	.loc 1 40 5 view .LVU41
+	.loc 1 41 5 view .LVU42
+	.loc 1 42 5 view .LVU43
+# blake2s-mac.c:43:     ctx->digest_len = K->digest_len;
+	.loc 1 43 24 is_stmt 0 view .LVU44
+	movl	32(%rsi), %edx	# K_7(D)->digest_len,
+# blake2s-mac.c:42:     ctx->buf_len = 0;
+	.loc 1 42 18 view .LVU45
+	movl	$0, 80(%rdi)	#, ctx_8(D)->buf_len
+	.loc 1 43 5 is_stmt 1 view .LVU46
+# blake2s-mac.c:43:     ctx->digest_len = K->digest_len;
+	.loc 1 43 21 is_stmt 0 view .LVU47
+	movl	%edx, 84(%rdi)	# _3, ctx_8(D)->digest_len
+	.loc 1 44 5 is_stmt 1 view .LVU48
+# blake2s-mac.c:44:     ctx->last_node = 0;
+	.loc 1 44 20 is_stmt 0 view .LVU49
+	movl	$0, 88(%rdi)	#, ctx_8(D)->last_node
+	.loc 1 45 5 is_stmt 1 view .LVU50
+	jmp	memcpy@PLT	#
+.LVL12:
+	.loc 1 45 5 is_stmt 0 view .LVU51
+	.cfi_endproc
+.LFE18:
+	.size	blake2s_mac_init, .-blake2s_mac_init
+	.p2align 4
+	.globl	blake2s_mac_final
+	.type	blake2s_mac_final, @function
+blake2s_mac_final:
+.LVL13:
+.LFB19:
+	.loc 1 50 1 is_stmt 1 view -0
+	.cfi_startproc
+	.loc 1 51 5 view .LVU53
+	.loc 1 52 5 view .LVU54
+# blake2s-mac.c:50: {
+	.loc 1 50 1 is_stmt 0 view .LVU55
+	movq	%rdx, %rsi	# tmp86, out
+.LVL14:
+# blake2s-mac.c:52:     blake2s_final(ctx, out);
+	.loc 1 52 5 view .LVU56
+	jmp	blake2s_final@PLT	#
+.LVL15:
+	.loc 1 52 5 view .LVU57
+	.cfi_endproc
+.LFE19:
+	.size	blake2s_mac_final, .-blake2s_mac_final
+	.p2align 4
+	.globl	blake2s_mac
+	.type	blake2s_mac, @function
+blake2s_mac:
+.LVL16:
+.LFB20:
+	.loc 1 57 1 is_stmt 1 view -0
+	.cfi_startproc
+	.loc 1 57 1 is_stmt 0 view .LVU59
+	pushq	%r13	#
+	.cfi_def_cfa_offset 16
+	.cfi_offset 13, -16
+.LBB14:
+.LBB15:
+# blake2s-mac.c:45:     memcpy(ctx->buf, K->empty, K->digest_len);
+	.loc 1 45 5 view .LVU60
+	addq	$32, %rsi	#, tmp97
+.LVL17:
+	.loc 1 45 5 view .LVU61
+.LBE15:
+.LBE14:
+# blake2s-mac.c:57: {
+	.loc 1 57 1 view .LVU62
+	pushq	%r12	#
+	.cfi_def_cfa_offset 24
+	.cfi_offset 12, -24
+	movq	%rcx, %r12	# tmp108, len
+	pushq	%rbp	#
+	.cfi_def_cfa_offset 32
+	.cfi_offset 6, -32
+	movq	%rdx, %rbp	# tmp107, src
+	pushq	%rbx	#
+	.cfi_def_cfa_offset 40
+	.cfi_offset 3, -40
+	movq	%rdi, %rbx	# tmp105, out
+	.loc 1 58 5 is_stmt 1 view .LVU63
+	.loc 1 60 5 view .LVU64
+# blake2s-mac.c:57: {
+	.loc 1 57 1 is_stmt 0 view .LVU65
+	subq	$136, %rsp	#,
+	.cfi_def_cfa_offset 176
+.LVL18:
+.LBB17:
+.LBI14:
+	.loc 1 35 6 is_stmt 1 view .LVU66
+.LBB16:
+	.loc 1 37 5 view .LVU67
+	movdqu	-32(%rsi), %xmm1	# MEM <char[1:32]> [(void *)K_2(D)], tmp110
+	movdqu	-16(%rsi), %xmm2	# MEM <char[1:32]> [(void *)K_2(D)], tmp111
+# blake2s-mac.c:43:     ctx->digest_len = K->digest_len;
+	.loc 1 43 24 is_stmt 0 view .LVU68
+	movl	32(%rsi), %edx	# K_2(D)->digest_len,
+.LVL19:
+# blake2s-mac.c:38:     ctx->t[0] = BLAKE2S_BLOCK;
+	.loc 1 38 15 view .LVU69
+	movdqa	.LC0(%rip), %xmm0	#, tmp93
+# blake2s-mac.c:37:     memcpy(ctx->H, K->H, sizeof(ctx->H));
+	.loc 1 37 5 view .LVU70
+	movq	%rsp, %r13	#, tmp90
+.LVL20:
+# blake2s-mac.c:45:     memcpy(ctx->buf, K->empty, K->digest_len);
+	.loc 1 45 5 view .LVU71
+	leaq	32(%rsp), %rdi	#, tmp95
+.LVL21:
+# blake2s-mac.c:37:     memcpy(ctx->H, K->H, sizeof(ctx->H));
+	.loc 1 37 5 view .LVU72
+	movaps	%xmm1, (%rsp)	# tmp110, MEM <char[1:32]> [(void *)&ctx]
+	movaps	%xmm2, 16(%rsp)	# tmp111, MEM <char[1:32]> [(void *)&ctx]
+	.loc 1 38 5 is_stmt 1 view .LVU73
+	.loc 1 39 5 view .LVU74
+	.loc 1 40 5 view .LVU75
+	.loc 1 41 5 view .LVU76
+# blake2s-mac.c:38:     ctx->t[0] = BLAKE2S_BLOCK;
+	.loc 1 38 15 is_stmt 0 view .LVU77
+	movaps	%xmm0, 96(%rsp)	# tmp93, MEM <vector(4) unsigned int> [(unsigned int *)&ctx + 96B]
+	.loc 1 42 5 is_stmt 1 view .LVU78
+# blake2s-mac.c:43:     ctx->digest_len = K->digest_len;
+	.loc 1 43 21 is_stmt 0 view .LVU79
+	movl	%edx, 116(%rsp)	# _12, ctx.digest_len
+# blake2s-mac.c:42:     ctx->buf_len = 0;
+	.loc 1 42 18 view .LVU80
+	movl	$0, 112(%rsp)	#, ctx.buf_len
+	.loc 1 43 5 is_stmt 1 view .LVU81
+	.loc 1 44 5 view .LVU82
+# blake2s-mac.c:44:     ctx->last_node = 0;
+	.loc 1 44 20 is_stmt 0 view .LVU83
+	movl	$0, 120(%rsp)	#, ctx.last_node
+	.loc 1 45 5 is_stmt 1 view .LVU84
+	call	memcpy@PLT	#
+.LVL22:
+	.loc 1 45 5 is_stmt 0 view .LVU85
+.LBE16:
+.LBE17:
+	.loc 1 61 5 is_stmt 1 view .LVU86
+	movq	%r12, %rdx	# len,
+	movq	%rbp, %rsi	# src,
+	movq	%r13, %rdi	# tmp90,
+	call	blake2s_update@PLT	#
+.LVL23:
+	.loc 1 62 5 view .LVU87
+.LBB18:
+.LBI18:
+	.loc 1 48 6 view .LVU88
+.LBB19:
+	.loc 1 51 5 view .LVU89
+	.loc 1 52 5 view .LVU90
+	movq	%rbx, %rsi	# out,
+	movq	%r13, %rdi	# tmp90,
+	call	blake2s_final@PLT	#
+.LVL24:
+	.loc 1 52 5 is_stmt 0 view .LVU91
+.LBE19:
+.LBE18:
+# blake2s-mac.c:63: }
+	.loc 1 63 1 view .LVU92
+	addq	$136, %rsp	#,
+	.cfi_def_cfa_offset 40
+	popq	%rbx	#
+	.cfi_def_cfa_offset 32
+.LVL25:
+	.loc 1 63 1 view .LVU93
+	popq	%rbp	#
+	.cfi_def_cfa_offset 24
+.LVL26:
+	.loc 1 63 1 view .LVU94
+	popq	%r12	#
+	.cfi_def_cfa_offset 16
+.LVL27:
+	.loc 1 63 1 view .LVU95
+	popq	%r13	#
+	.cfi_def_cfa_offset 8
+	ret	
+	.cfi_endproc
+.LFE20:
+	.size	blake2s_mac, .-blake2s_mac
+	.section	.rodata.cst16,"aM",@progbits,16
+	.align 16
+.LC0:
+	.long	64
+	.long	0
+	.long	0
+	.long	0
+	.text
+.Letext0:
+	.file 3 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stddef.h"
+	.file 4 "/usr/include/x86_64-linux-gnu/bits/types.h"
+	.file 5 "/usr/include/x86_64-linux-gnu/bits/stdint-uintn.h"
+	.file 6 "blake2s.h"
+	.file 7 "/usr/include/string.h"
+	.file 8 "<built-in>"
+	.section	.debug_info,"",@progbits
+.Ldebug_info0:
+	.long	0x847
+	.value	0x5
+	.byte	0x1
+	.byte	0x8
+	.long	.Ldebug_abbrev0
+	.uleb128 0x1d
+	.long	.LASF43
+	.byte	0xc
+	.long	.LASF0
+	.long	.LASF1
+	.quad	.Ltext0
+	.quad	.Letext0-.Ltext0
+	.long	.Ldebug_line0
+	.uleb128 0xc
+	.long	.LASF8
+	.byte	0x3
+	.byte	0xd6
+	.byte	0x1b
+	.long	0x3a
+	.uleb128 0x5
+	.byte	0x8
+	.byte	0x7
+	.long	.LASF2
+	.uleb128 0x5
+	.byte	0x8
+	.byte	0x5
+	.long	.LASF3
+	.uleb128 0x1e
+	.byte	0x4
+	.byte	0x5
+	.string	"int"
+	.uleb128 0x5
+	.byte	0x1
+	.byte	0x8
+	.long	.LASF4
+	.uleb128 0x5
+	.byte	0x2
+	.byte	0x7
+	.long	.LASF5
+	.uleb128 0x5
+	.byte	0x4
+	.byte	0x7
+	.long	.LASF6
+	.uleb128 0x5
+	.byte	0x1
+	.byte	0x6
+	.long	.LASF7
+	.uleb128 0xc
+	.long	.LASF9
+	.byte	0x4
+	.byte	0x26
+	.byte	0x17
+	.long	0x4f
+	.uleb128 0x5
+	.byte	0x2
+	.byte	0x5
+	.long	.LASF10
+	.uleb128 0xc
+	.long	.LASF11
+	.byte	0x4
+	.byte	0x2a
+	.byte	0x16
+	.long	0x5d
+	.uleb128 0x1f
+	.byte	0x8
+	.uleb128 0x5
+	.byte	0x1
+	.byte	0x6
+	.long	.LASF12
+	.uleb128 0x9
+	.long	0x8c
+	.uleb128 0xc
+	.long	.LASF13
+	.byte	0x5
+	.byte	0x18
+	.byte	0x13
+	.long	0x6b
+	.uleb128 0xc
+	.long	.LASF14
+	.byte	0x5
+	.byte	0x1a
+	.byte	0x14
+	.long	0x7e
+	.uleb128 0x20
+	.long	.LASF23
+	.byte	0x80
+	.byte	0x10
+	.byte	0x6
+	.byte	0xf7
+	.byte	0x8
+	.long	0x114
+	.uleb128 0xd
+	.string	"H"
+	.byte	0x6
+	.byte	0xf8
+	.byte	0xe
+	.long	0x114
+	.byte	0
+	.uleb128 0xd
+	.string	"buf"
+	.byte	0x6
+	.byte	0xf9
+	.byte	0x13
+	.long	0x124
+	.byte	0x20
+	.uleb128 0xd
+	.string	"t"
+	.byte	0x6
+	.byte	0xfa
+	.byte	0xe
+	.long	0x134
+	.byte	0x60
+	.uleb128 0xd
+	.string	"f"
+	.byte	0x6
+	.byte	0xfb
+	.byte	0xe
+	.long	0x134
+	.byte	0x68
+	.uleb128 0x7
+	.long	.LASF15
+	.byte	0x6
+	.byte	0xfc
+	.byte	0xe
+	.long	0x5d
+	.byte	0x70
+	.uleb128 0x7
+	.long	.LASF16
+	.byte	0x6
+	.byte	0xfd
+	.byte	0xe
+	.long	0x5d
+	.byte	0x74
+	.uleb128 0x7
+	.long	.LASF17
+	.byte	0x6
+	.byte	0xfe
+	.byte	0xe
+	.long	0x5d
+	.byte	0x78
+	.byte	0
+	.uleb128 0x8
+	.long	0xa4
+	.long	0x124
+	.uleb128 0x4
+	.long	0x3a
+	.byte	0x7
+	.byte	0
+	.uleb128 0x8
+	.long	0x4f
+	.long	0x134
+	.uleb128 0x4
+	.long	0x3a
+	.byte	0x3f
+	.byte	0
+	.uleb128 0x8
+	.long	0xa4
+	.long	0x144
+	.uleb128 0x4
+	.long	0x3a
+	.byte	0x1
+	.byte	0
+	.uleb128 0x21
+	.long	.LASF25
+	.byte	0x44
+	.byte	0x6
+	.value	0x101
+	.byte	0x8
+	.long	0x179
+	.uleb128 0x22
+	.string	"H"
+	.byte	0x6
+	.value	0x102
+	.byte	0xe
+	.long	0x114
+	.byte	0
+	.uleb128 0x12
+	.long	.LASF18
+	.value	0x103
+	.byte	0x13
+	.long	0x17e
+	.byte	0x20
+	.uleb128 0x12
+	.long	.LASF16
+	.value	0x104
+	.byte	0xe
+	.long	0x5d
+	.byte	0x40
+	.byte	0
+	.uleb128 0x9
+	.long	0x144
+	.uleb128 0x8
+	.long	0x4f
+	.long	0x18e
+	.uleb128 0x4
+	.long	0x3a
+	.byte	0x1f
+	.byte	0
+	.uleb128 0x3
+	.long	0xb0
+	.uleb128 0x3
+	.long	0x198
+	.uleb128 0x23
+	.uleb128 0x3
+	.long	0x4f
+	.uleb128 0x5
+	.byte	0x8
+	.byte	0x7
+	.long	.LASF19
+	.uleb128 0x5
+	.byte	0x8
+	.byte	0x5
+	.long	.LASF20
+	.uleb128 0x13
+	.string	"u8"
+	.byte	0x7
+	.byte	0x11
+	.long	0x98
+	.uleb128 0x9
+	.long	0x1ac
+	.uleb128 0x13
+	.string	"u32"
+	.byte	0x8
+	.byte	0x12
+	.long	0xa4
+	.uleb128 0x9
+	.long	0x1bb
+	.uleb128 0x8
+	.long	0x1c6
+	.long	0x1db
+	.uleb128 0x4
+	.long	0x3a
+	.byte	0x7
+	.byte	0
+	.uleb128 0x9
+	.long	0x1cb
+	.uleb128 0x14
+	.long	.LASF21
+	.byte	0xa
+	.byte	0x12
+	.long	0x1db
+	.byte	0x20
+	.byte	0x67
+	.byte	0xe6
+	.byte	0x9
+	.byte	0x6a
+	.byte	0x85
+	.byte	0xae
+	.byte	0x67
+	.byte	0xbb
+	.byte	0x72
+	.byte	0xf3
+	.byte	0x6e
+	.byte	0x3c
+	.byte	0x3a
+	.byte	0xf5
+	.byte	0x4f
+	.byte	0xa5
+	.byte	0x7f
+	.byte	0x52
+	.byte	0xe
+	.byte	0x51
+	.byte	0x8c
+	.byte	0x68
+	.byte	0x5
+	.byte	0x9b
+	.byte	0xab
+	.byte	0xd9
+	.byte	0x83
+	.byte	0x1f
+	.byte	0x19
+	.byte	0xcd
+	.byte	0xe0
+	.byte	0x5b
+	.uleb128 0x8
+	.long	0x1b6
+	.long	0x222
+	.uleb128 0x4
+	.long	0x3a
+	.byte	0x9
+	.uleb128 0x4
+	.long	0x3a
+	.byte	0xf
+	.byte	0
+	.uleb128 0x9
+	.long	0x20c
+	.uleb128 0x14
+	.long	.LASF22
+	.byte	0xf
+	.byte	0x11
+	.long	0x222
+	.byte	0xa0
+	.byte	0
+	.byte	0x1
+	.byte	0x2
+	.byte	0x3
+	.byte	0x4
+	.byte	0x5
+	.byte	0x6
+	.byte	0x7
+	.byte	0x8
+	.byte	0x9
+	.byte	0xa
+	.byte	0xb
+	.byte	0xc
+	.byte	0xd
+	.byte	0xe
+	.byte	0xf
+	.byte	0xe
+	.byte	0xa
+	.byte	0x4
+	.byte	0x8
+	.byte	0x9
+	.byte	0xf
+	.byte	0xd
+	.byte	0x6
+	.byte	0x1
+	.byte	0xc
+	.byte	0
+	.byte	0x2
+	.byte	0xb
+	.byte	0x7
+	.byte	0x5
+	.byte	0x3
+	.byte	0xb
+	.byte	0x8
+	.byte	0xc
+	.byte	0
+	.byte	0x5
+	.byte	0x2
+	.byte	0xf
+	.byte	0xd
+	.byte	0xa
+	.byte	0xe
+	.byte	0x3
+	.byte	0x6
+	.byte	0x7
+	.byte	0x1
+	.byte	0x9
+	.byte	0x4
+	.byte	0x7
+	.byte	0x9
+	.byte	0x3
+	.byte	0x1
+	.byte	0xd
+	.byte	0xc
+	.byte	0xb
+	.byte	0xe
+	.byte	0x2
+	.byte	0x6
+	.byte	0x5
+	.byte	0xa
+	.byte	0x4
+	.byte	0
+	.byte	0xf
+	.byte	0x8
+	.byte	0x9
+	.byte	0
+	.byte	0x5
+	.byte	0x7
+	.byte	0x2
+	.byte	0x4
+	.byte	0xa
+	.byte	0xf
+	.byte	0xe
+	.byte	0x1
+	.byte	0xb
+	.byte	0xc
+	.byte	0x6
+	.byte	0x8
+	.byte	0x3
+	.byte	0xd
+	.byte	0x2
+	.byte	0xc
+	.byte	0x6
+	.byte	0xa
+	.byte	0
+	.byte	0xb
+	.byte	0x8
+	.byte	0x3
+	.byte	0x4
+	.byte	0xd
+	.byte	0x7
+	.byte	0x5
+	.byte	0xf
+	.byte	0xe
+	.byte	0x1
+	.byte	0x9
+	.byte	0xc
+	.byte	0x5
+	.byte	0x1
+	.byte	0xf
+	.byte	0xe
+	.byte	0xd
+	.byte	0x4
+	.byte	0xa
+	.byte	0
+	.byte	0x7
+	.byte	0x6
+	.byte	0x3
+	.byte	0x9
+	.byte	0x2
+	.byte	0x8
+	.byte	0xb
+	.byte	0xd
+	.byte	0xb
+	.byte	0x7
+	.byte	0xe
+	.byte	0xc
+	.byte	0x1
+	.byte	0x3
+	.byte	0x9
+	.byte	0x5
+	.byte	0
+	.byte	0xf
+	.byte	0x4
+	.byte	0x8
+	.byte	0x6
+	.byte	0x2
+	.byte	0xa
+	.byte	0x6
+	.byte	0xf
+	.byte	0xe
+	.byte	0x9
+	.byte	0xb
+	.byte	0x3
+	.byte	0
+	.byte	0x8
+	.byte	0xc
+	.byte	0x2
+	.byte	0xd
+	.byte	0x7
+	.byte	0x1
+	.byte	0x4
+	.byte	0xa
+	.byte	0x5
+	.byte	0xa
+	.byte	0x2
+	.byte	0x8
+	.byte	0x4
+	.byte	0x7
+	.byte	0x6
+	.byte	0x1
+	.byte	0x5
+	.byte	0xf
+	.byte	0xb
+	.byte	0x9
+	.byte	0xe
+	.byte	0x3
+	.byte	0xc
+	.byte	0xd
+	.byte	0
+	.uleb128 0x24
+	.long	.LASF24
+	.value	0x300
+	.byte	0x40
+	.byte	0x2
+	.byte	0x25
+	.byte	0x8
+	.long	0x302
+	.uleb128 0xd
+	.string	"H"
+	.byte	0x2
+	.byte	0x26
+	.byte	0x9
+	.long	0x302
+	.byte	0
+	.uleb128 0x15
+	.string	"t"
+	.byte	0x27
+	.long	0x318
+	.value	0x200
+	.uleb128 0x15
+	.string	"f"
+	.byte	0x28
+	.long	0x318
+	.value	0x280
+	.byte	0
+	.uleb128 0x8
+	.long	0x1bb
+	.long	0x318
+	.uleb128 0x4
+	.long	0x3a
+	.byte	0x7
+	.uleb128 0x4
+	.long	0x3a
+	.byte	0xf
+	.byte	0
+	.uleb128 0x8
+	.long	0x1bb
+	.long	0x32e
+	.uleb128 0x4
+	.long	0x3a
+	.byte	0x1
+	.uleb128 0x4
+	.long	0x3a
+	.byte	0xf
+	.byte	0
+	.uleb128 0x25
+	.long	.LASF26
+	.byte	0x30
+	.byte	0x2
+	.byte	0x31
+	.byte	0x8
+	.long	0x38a
+	.uleb128 0x7
+	.long	.LASF27
+	.byte	0x2
+	.byte	0x32
+	.byte	0x11
+	.long	0x38f
+	.byte	0
+	.uleb128 0x7
+	.long	.LASF28
+	.byte	0x2
+	.byte	0x33
+	.byte	0xb
+	.long	0x399
+	.byte	0x8
+	.uleb128 0x7
+	.long	.LASF29
+	.byte	0x2
+	.byte	0x34
+	.byte	0xc
+	.long	0x3ae
+	.byte	0x10
+	.uleb128 0x7
+	.long	.LASF30
+	.byte	0x2
+	.byte	0x35
+	.byte	0xc
+	.long	0x3c8
+	.byte	0x18
+	.uleb128 0x7
+	.long	.LASF31
+	.byte	0x2
+	.byte	0x37
+	.byte	0xe
+	.long	0x5d
+	.byte	0x20
+	.uleb128 0x7
+	.long	.LASF32
+	.byte	0x2
+	.byte	0x38
+	.byte	0xc
+	.long	0x3ec
+	.byte	0x28
+	.byte	0
+	.uleb128 0x9
+	.long	0x32e
+	.uleb128 0x3
+	.long	0x93
+	.uleb128 0x26
+	.long	0x48
+	.uleb128 0x3
+	.long	0x394
+	.uleb128 0xf
+	.long	0x3ae
+	.uleb128 0x1
+	.long	0x18e
+	.uleb128 0x1
+	.long	0x193
+	.byte	0
+	.uleb128 0x3
+	.long	0x39e
+	.uleb128 0xf
+	.long	0x3c8
+	.uleb128 0x1
+	.long	0x18e
+	.uleb128 0x1
+	.long	0x193
+	.uleb128 0x1
+	.long	0x2e
+	.byte	0
+	.uleb128 0x3
+	.long	0x3b3
+	.uleb128 0xf
+	.long	0x3e2
+	.uleb128 0x1
+	.long	0x3e2
+	.uleb128 0x1
+	.long	0x3e7
+	.uleb128 0x1
+	.long	0x5d
+	.byte	0
+	.uleb128 0x3
+	.long	0x2d3
+	.uleb128 0x3
+	.long	0x193
+	.uleb128 0x3
+	.long	0x3cd
+	.uleb128 0x27
+	.long	.LASF44
+	.byte	0x2
+	.byte	0x3c
+	.byte	0x25
+	.long	0x3fd
+	.uleb128 0x3
+	.long	0x38a
+	.uleb128 0x16
+	.long	.LASF35
+	.byte	0x46
+	.long	0x41c
+	.uleb128 0x1
+	.long	0x18e
+	.uleb128 0x1
+	.long	0x193
+	.uleb128 0x1
+	.long	0x2e
+	.byte	0
+	.uleb128 0x10
+	.long	.LASF33
+	.byte	0x7
+	.byte	0x3d
+	.byte	0xe
+	.long	0x8a
+	.long	0x43c
+	.uleb128 0x1
+	.long	0x8a
+	.uleb128 0x1
+	.long	0x48
+	.uleb128 0x1
+	.long	0x2e
+	.byte	0
+	.uleb128 0x10
+	.long	.LASF34
+	.byte	0x7
+	.byte	0x2b
+	.byte	0xe
+	.long	0x8a
+	.long	0x45c
+	.uleb128 0x1
+	.long	0x8a
+	.uleb128 0x1
+	.long	0x193
+	.uleb128 0x1
+	.long	0x2e
+	.byte	0
+	.uleb128 0x16
+	.long	.LASF36
+	.byte	0x47
+	.long	0x471
+	.uleb128 0x1
+	.long	0x18e
+	.uleb128 0x1
+	.long	0x199
+	.byte	0
+	.uleb128 0x10
+	.long	.LASF37
+	.byte	0x6
+	.byte	0x23
+	.byte	0x6
+	.long	0x48
+	.long	0x49b
+	.uleb128 0x1
+	.long	0x18e
+	.uleb128 0x1
+	.long	0x193
+	.uleb128 0x1
+	.long	0x193
+	.uleb128 0x1
+	.long	0x5d
+	.uleb128 0x1
+	.long	0x5d
+	.byte	0
+	.uleb128 0x28
+	.long	.LASF45
+	.byte	0x1
+	.byte	0x37
+	.byte	0x6
+	.quad	.LFB20
+	.quad	.LFE20-.LFB20
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0x5d9
+	.uleb128 0xb
+	.string	"out"
+	.byte	0x37
+	.byte	0x21
+	.long	0x199
+	.long	.LLST13
+	.long	.LVUS13
+	.uleb128 0xb
+	.string	"K"
+	.byte	0x37
+	.byte	0x44
+	.long	0x5d9
+	.long	.LLST14
+	.long	.LVUS14
+	.uleb128 0xb
+	.string	"src"
+	.byte	0x38
+	.byte	0x1e
+	.long	0x193
+	.long	.LLST15
+	.long	.LVUS15
+	.uleb128 0xb
+	.string	"len"
+	.byte	0x38
+	.byte	0x2a
+	.long	0x2e
+	.long	.LLST16
+	.long	.LVUS16
+	.uleb128 0x17
+	.string	"ctx"
+	.byte	0x3a
+	.long	0xb0
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -176
+	.uleb128 0x18
+	.long	0x60b
+	.quad	.LBI14
+	.byte	.LVU66
+	.long	.LLRL17
+	.byte	0x3c
+	.long	0x559
+	.uleb128 0x19
+	.long	0x621
+	.uleb128 0x6
+	.long	0x615
+	.long	.LLST18
+	.long	.LVUS18
+	.uleb128 0xe
+	.quad	.LVL22
+	.long	0x83f
+	.uleb128 0x2
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -144
+	.uleb128 0x2
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x5
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x23
+	.uleb128 0x20
+	.byte	0
+	.byte	0
+	.uleb128 0x29
+	.long	0x5de
+	.quad	.LBI18
+	.byte	.LVU88
+	.quad	.LBB18
+	.quad	.LBE18-.LBB18
+	.byte	0x1
+	.byte	0x3e
+	.byte	0x5
+	.long	0x5b8
+	.uleb128 0x6
+	.long	0x5fe
+	.long	.LLST19
+	.long	.LVUS19
+	.uleb128 0x19
+	.long	0x5f4
+	.uleb128 0x6
+	.long	0x5e8
+	.long	.LLST20
+	.long	.LVUS20
+	.uleb128 0xe
+	.quad	.LVL24
+	.long	0x45c
+	.uleb128 0x2
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x7d
+	.sleb128 0
+	.uleb128 0x2
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x2
+	.byte	0x73
+	.sleb128 0
+	.byte	0
+	.byte	0
+	.uleb128 0xe
+	.quad	.LVL23
+	.long	0x402
+	.uleb128 0x2
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x7d
+	.sleb128 0
+	.uleb128 0x2
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x2
+	.byte	0x76
+	.sleb128 0
+	.uleb128 0x2
+	.uleb128 0x1
+	.byte	0x51
+	.uleb128 0x2
+	.byte	0x7c
+	.sleb128 0
+	.byte	0
+	.byte	0
+	.uleb128 0x3
+	.long	0x179
+	.uleb128 0x1a
+	.long	.LASF38
+	.byte	0x30
+	.long	0x60b
+	.uleb128 0xa
+	.string	"ctx"
+	.byte	0x1
+	.byte	0x30
+	.byte	0x2c
+	.long	0x18e
+	.uleb128 0xa
+	.string	"K"
+	.byte	0x1
+	.byte	0x30
+	.byte	0x4f
+	.long	0x5d9
+	.uleb128 0xa
+	.string	"out"
+	.byte	0x1
+	.byte	0x31
+	.byte	0x27
+	.long	0x199
+	.byte	0
+	.uleb128 0x1a
+	.long	.LASF39
+	.byte	0x23
+	.long	0x62c
+	.uleb128 0xa
+	.string	"ctx"
+	.byte	0x1
+	.byte	0x23
+	.byte	0x2b
+	.long	0x18e
+	.uleb128 0xa
+	.string	"K"
+	.byte	0x1
+	.byte	0x23
+	.byte	0x4e
+	.long	0x5d9
+	.byte	0
+	.uleb128 0x2a
+	.long	.LASF46
+	.byte	0x1
+	.byte	0x11
+	.byte	0x5
+	.long	0x48
+	.quad	.LFB17
+	.quad	.LFE17-.LFB17
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0x761
+	.uleb128 0xb
+	.string	"K"
+	.byte	0x11
+	.byte	0x32
+	.long	0x761
+	.long	.LLST0
+	.long	.LVUS0
+	.uleb128 0x11
+	.long	.LASF40
+	.byte	0x11
+	.byte	0x41
+	.long	0x193
+	.long	.LLST1
+	.long	.LVUS1
+	.uleb128 0xb
+	.string	"key"
+	.byte	0x12
+	.byte	0x26
+	.long	0x193
+	.long	.LLST2
+	.long	.LVUS2
+	.uleb128 0x11
+	.long	.LASF41
+	.byte	0x12
+	.byte	0x34
+	.long	0x5d
+	.long	.LLST3
+	.long	.LVUS3
+	.uleb128 0x11
+	.long	.LASF42
+	.byte	0x12
+	.byte	0x46
+	.long	0x5d
+	.long	.LLST4
+	.long	.LVUS4
+	.uleb128 0x17
+	.string	"ctx"
+	.byte	0x14
+	.long	0xb0
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -288
+	.uleb128 0x2b
+	.long	.LASF18
+	.byte	0x1
+	.byte	0x14
+	.byte	0x1d
+	.long	0xb0
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -160
+	.uleb128 0x18
+	.long	0x766
+	.quad	.LBI6
+	.byte	.LVU17
+	.long	.LLRL5
+	.byte	0x1c
+	.long	0x712
+	.uleb128 0x6
+	.long	0x77f
+	.long	.LLST6
+	.long	.LVUS6
+	.uleb128 0x6
+	.long	0x773
+	.long	.LLST7
+	.long	.LVUS7
+	.uleb128 0x2c
+	.quad	.LVL5
+	.uleb128 0x2
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x7c
+	.sleb128 0
+	.uleb128 0x2
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -256
+	.byte	0
+	.byte	0
+	.uleb128 0x2d
+	.quad	.LVL2
+	.long	0x471
+	.long	0x745
+	.uleb128 0x2
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x7c
+	.sleb128 0
+	.uleb128 0x2
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x3
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x2
+	.uleb128 0x1
+	.byte	0x51
+	.uleb128 0x3
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x51
+	.uleb128 0x2
+	.uleb128 0x1
+	.byte	0x52
+	.uleb128 0x3
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x52
+	.uleb128 0x2
+	.uleb128 0x1
+	.byte	0x58
+	.uleb128 0x2
+	.byte	0x76
+	.sleb128 0
+	.byte	0
+	.uleb128 0xe
+	.quad	.LVL3
+	.long	0x45c
+	.uleb128 0x2
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -160
+	.uleb128 0x2
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x2
+	.byte	0x73
+	.sleb128 32
+	.byte	0
+	.byte	0
+	.uleb128 0x3
+	.long	0x144
+	.uleb128 0x2e
+	.long	.LASF47
+	.byte	0x2
+	.byte	0x56
+	.byte	0x14
+	.byte	0x3
+	.long	0x78a
+	.uleb128 0xa
+	.string	"ctx"
+	.byte	0x2
+	.byte	0x56
+	.byte	0x39
+	.long	0x18e
+	.uleb128 0xa
+	.string	"m"
+	.byte	0x2
+	.byte	0x56
+	.byte	0x4a
+	.long	0x193
+	.byte	0
+	.uleb128 0x1b
+	.long	0x60b
+	.quad	.LFB18
+	.quad	.LFE18-.LFB18
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0x7e0
+	.uleb128 0x6
+	.long	0x615
+	.long	.LLST8
+	.long	.LVUS8
+	.uleb128 0x6
+	.long	0x621
+	.long	.LLST9
+	.long	.LVUS9
+	.uleb128 0x1c
+	.quad	.LVL12
+	.long	0x83f
+	.uleb128 0x2
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x5
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x23
+	.uleb128 0x20
+	.uleb128 0x2
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x5
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x23
+	.uleb128 0x20
+	.byte	0
+	.byte	0
+	.uleb128 0x1b
+	.long	0x5de
+	.quad	.LFB19
+	.quad	.LFE19-.LFB19
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0x83f
+	.uleb128 0x6
+	.long	0x5e8
+	.long	.LLST10
+	.long	.LVUS10
+	.uleb128 0x6
+	.long	0x5f4
+	.long	.LLST11
+	.long	.LVUS11
+	.uleb128 0x6
+	.long	0x5fe
+	.long	.LLST12
+	.long	.LVUS12
+	.uleb128 0x1c
+	.quad	.LVL15
+	.long	0x45c
+	.uleb128 0x2
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x3
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x3
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x51
+	.byte	0
+	.byte	0
+	.uleb128 0x2f
+	.long	.LASF34
+	.long	.LASF48
+	.byte	0x8
+	.byte	0
+	.byte	0
+	.section	.debug_abbrev,"",@progbits
+.Ldebug_abbrev0:
+	.uleb128 0x1
+	.uleb128 0x5
+	.byte	0
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x2
+	.uleb128 0x49
+	.byte	0
+	.uleb128 0x2
+	.uleb128 0x18
+	.uleb128 0x7e
+	.uleb128 0x18
+	.byte	0
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xf
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0x21
+	.sleb128 8
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x4
+	.uleb128 0x21
+	.byte	0
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x2f
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x5
+	.uleb128 0x24
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x3e
+	.uleb128 0xb
+	.uleb128 0x3
+	.uleb128 0xe
+	.byte	0
+	.byte	0
+	.uleb128 0x6
+	.uleb128 0x5
+	.byte	0
+	.uleb128 0x31
+	.uleb128 0x13
+	.uleb128 0x2
+	.uleb128 0x17
+	.uleb128 0x2137
+	.uleb128 0x17
+	.byte	0
+	.byte	0
+	.uleb128 0x7
+	.uleb128 0xd
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x38
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x8
+	.uleb128 0x1
+	.byte	0x1
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x9
+	.uleb128 0x26
+	.byte	0
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0xa
+	.uleb128 0x5
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x8
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0x5
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x8
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x2
+	.uleb128 0x17
+	.uleb128 0x2137
+	.uleb128 0x17
+	.byte	0
+	.byte	0
+	.uleb128 0xc
+	.uleb128 0x16
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0xd
+	.uleb128 0xd
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x8
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x38
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0xe
+	.uleb128 0x48
+	.byte	0x1
+	.uleb128 0x7d
+	.uleb128 0x1
+	.uleb128 0x7f
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0xf
+	.uleb128 0x15
+	.byte	0x1
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x10
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x3c
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x11
+	.uleb128 0x5
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x2
+	.uleb128 0x17
+	.uleb128 0x2137
+	.uleb128 0x17
+	.byte	0
+	.byte	0
+	.uleb128 0x12
+	.uleb128 0xd
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 6
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x38
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x13
+	.uleb128 0x16
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x8
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 2
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x14
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 2
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x1c
+	.uleb128 0xa
+	.byte	0
+	.byte	0
+	.uleb128 0x15
+	.uleb128 0xd
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x8
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 2
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 9
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x38
+	.uleb128 0x5
+	.byte	0
+	.byte	0
+	.uleb128 0x16
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 6
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 6
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x3c
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x17
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x8
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 24
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x2
+	.uleb128 0x18
+	.byte	0
+	.byte	0
+	.uleb128 0x18
+	.uleb128 0x1d
+	.byte	0x1
+	.uleb128 0x31
+	.uleb128 0x13
+	.uleb128 0x52
+	.uleb128 0x1
+	.uleb128 0x2138
+	.uleb128 0xb
+	.uleb128 0x55
+	.uleb128 0x17
+	.uleb128 0x58
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x59
+	.uleb128 0xb
+	.uleb128 0x57
+	.uleb128 0x21
+	.sleb128 5
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x19
+	.uleb128 0x5
+	.byte	0
+	.uleb128 0x31
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x1a
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 6
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x20
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x1b
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x31
+	.uleb128 0x13
+	.uleb128 0x11
+	.uleb128 0x1
+	.uleb128 0x12
+	.uleb128 0x7
+	.uleb128 0x40
+	.uleb128 0x18
+	.uleb128 0x7a
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x1c
+	.uleb128 0x48
+	.byte	0x1
+	.uleb128 0x7d
+	.uleb128 0x1
+	.uleb128 0x82
+	.uleb128 0x19
+	.uleb128 0x7f
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x1d
+	.uleb128 0x11
+	.byte	0x1
+	.uleb128 0x25
+	.uleb128 0xe
+	.uleb128 0x13
+	.uleb128 0xb
+	.uleb128 0x3
+	.uleb128 0x1f
+	.uleb128 0x1b
+	.uleb128 0x1f
+	.uleb128 0x11
+	.uleb128 0x1
+	.uleb128 0x12
+	.uleb128 0x7
+	.uleb128 0x10
+	.uleb128 0x17
+	.byte	0
+	.byte	0
+	.uleb128 0x1e
+	.uleb128 0x24
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x3e
+	.uleb128 0xb
+	.uleb128 0x3
+	.uleb128 0x8
+	.byte	0
+	.byte	0
+	.uleb128 0x1f
+	.uleb128 0xf
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x20
+	.uleb128 0x13
+	.byte	0x1
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x88
+	.uleb128 0xb
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x21
+	.uleb128 0x13
+	.byte	0x1
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x22
+	.uleb128 0xd
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x8
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x38
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x23
+	.uleb128 0x26
+	.byte	0
+	.byte	0
+	.byte	0
+	.uleb128 0x24
+	.uleb128 0x13
+	.byte	0x1
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0xb
+	.uleb128 0x5
+	.uleb128 0x88
+	.uleb128 0xb
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x25
+	.uleb128 0x13
+	.byte	0x1
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x26
+	.uleb128 0x15
+	.byte	0
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x27
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3c
+	.uleb128 0x19
+	.byte	0
+	.byte	0
+	.uleb128 0x28
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x11
+	.uleb128 0x1
+	.uleb128 0x12
+	.uleb128 0x7
+	.uleb128 0x40
+	.uleb128 0x18
+	.uleb128 0x7a
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x29
+	.uleb128 0x1d
+	.byte	0x1
+	.uleb128 0x31
+	.uleb128 0x13
+	.uleb128 0x52
+	.uleb128 0x1
+	.uleb128 0x2138
+	.uleb128 0xb
+	.uleb128 0x11
+	.uleb128 0x1
+	.uleb128 0x12
+	.uleb128 0x7
+	.uleb128 0x58
+	.uleb128 0xb
+	.uleb128 0x59
+	.uleb128 0xb
+	.uleb128 0x57
+	.uleb128 0xb
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x2a
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x11
+	.uleb128 0x1
+	.uleb128 0x12
+	.uleb128 0x7
+	.uleb128 0x40
+	.uleb128 0x18
+	.uleb128 0x7a
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x2b
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x2
+	.uleb128 0x18
+	.byte	0
+	.byte	0
+	.uleb128 0x2c
+	.uleb128 0x48
+	.byte	0x1
+	.uleb128 0x7d
+	.uleb128 0x1
+	.byte	0
+	.byte	0
+	.uleb128 0x2d
+	.uleb128 0x48
+	.byte	0x1
+	.uleb128 0x7d
+	.uleb128 0x1
+	.uleb128 0x7f
+	.uleb128 0x13
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x2e
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x20
+	.uleb128 0xb
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x2f
+	.uleb128 0x2e
+	.byte	0
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3c
+	.uleb128 0x19
+	.uleb128 0x6e
+	.uleb128 0xe
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.byte	0
+	.section	.debug_loclists,"",@progbits
+	.long	.Ldebug_loc3-.Ldebug_loc2
+.Ldebug_loc2:
+	.value	0x5
+	.byte	0x8
+	.byte	0
+	.long	0
+.Ldebug_loc0:
+.LVUS13:
+	.uleb128 0
+	.uleb128 .LVU72
+	.uleb128 .LVU72
+	.uleb128 .LVU93
+	.uleb128 .LVU93
+	.uleb128 0
+.LLST13:
+	.byte	0x4
+	.uleb128 .LVL16-.Ltext0
+	.uleb128 .LVL21-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL21-.Ltext0
+	.uleb128 .LVL25-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0x4
+	.uleb128 .LVL25-.Ltext0
+	.uleb128 .LFE20-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x9f
+	.byte	0
+.LVUS14:
+	.uleb128 0
+	.uleb128 .LVU61
+	.uleb128 .LVU61
+	.uleb128 .LVU85
+	.uleb128 .LVU85
+	.uleb128 0
+.LLST14:
+	.byte	0x4
+	.uleb128 .LVL16-.Ltext0
+	.uleb128 .LVL17-.Ltext0
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x4
+	.uleb128 .LVL17-.Ltext0
+	.uleb128 .LVL22-1-.Ltext0
+	.uleb128 0x3
+	.byte	0x74
+	.sleb128 -32
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL22-1-.Ltext0
+	.uleb128 .LFE20-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x9f
+	.byte	0
+.LVUS15:
+	.uleb128 0
+	.uleb128 .LVU69
+	.uleb128 .LVU69
+	.uleb128 .LVU94
+	.uleb128 .LVU94
+	.uleb128 0
+.LLST15:
+	.byte	0x4
+	.uleb128 .LVL16-.Ltext0
+	.uleb128 .LVL19-.Ltext0
+	.uleb128 0x1
+	.byte	0x51
+	.byte	0x4
+	.uleb128 .LVL19-.Ltext0
+	.uleb128 .LVL26-.Ltext0
+	.uleb128 0x1
+	.byte	0x56
+	.byte	0x4
+	.uleb128 .LVL26-.Ltext0
+	.uleb128 .LFE20-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x51
+	.byte	0x9f
+	.byte	0
+.LVUS16:
+	.uleb128 0
+	.uleb128 .LVU85
+	.uleb128 .LVU85
+	.uleb128 .LVU95
+	.uleb128 .LVU95
+	.uleb128 0
+.LLST16:
+	.byte	0x4
+	.uleb128 .LVL16-.Ltext0
+	.uleb128 .LVL22-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x52
+	.byte	0x4
+	.uleb128 .LVL22-1-.Ltext0
+	.uleb128 .LVL27-.Ltext0
+	.uleb128 0x1
+	.byte	0x5c
+	.byte	0x4
+	.uleb128 .LVL27-.Ltext0
+	.uleb128 .LFE20-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x52
+	.byte	0x9f
+	.byte	0
+.LVUS18:
+	.uleb128 .LVU66
+	.uleb128 .LVU71
+	.uleb128 .LVU71
+	.uleb128 .LVU85
+.LLST18:
+	.byte	0x4
+	.uleb128 .LVL18-.Ltext0
+	.uleb128 .LVL20-.Ltext0
+	.uleb128 0x4
+	.byte	0x91
+	.sleb128 -176
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL20-.Ltext0
+	.uleb128 .LVL22-.Ltext0
+	.uleb128 0x1
+	.byte	0x5d
+	.byte	0
+.LVUS19:
+	.uleb128 .LVU88
+	.uleb128 .LVU91
+.LLST19:
+	.byte	0x4
+	.uleb128 .LVL23-.Ltext0
+	.uleb128 .LVL24-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0
+.LVUS20:
+	.uleb128 .LVU88
+	.uleb128 .LVU91
+.LLST20:
+	.byte	0x4
+	.uleb128 .LVL23-.Ltext0
+	.uleb128 .LVL24-.Ltext0
+	.uleb128 0x1
+	.byte	0x5d
+	.byte	0
+.LVUS0:
+	.uleb128 0
+	.uleb128 .LVU5
+	.uleb128 .LVU5
+	.uleb128 .LVU28
+	.uleb128 .LVU28
+	.uleb128 .LVU30
+	.uleb128 .LVU30
+	.uleb128 0
+.LLST0:
+	.byte	0x4
+	.uleb128 .LVL0-.Ltext0
+	.uleb128 .LVL1-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL1-.Ltext0
+	.uleb128 .LVL6-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0x4
+	.uleb128 .LVL6-.Ltext0
+	.uleb128 .LVL8-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL8-.Ltext0
+	.uleb128 .LFE17-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0
+.LVUS1:
+	.uleb128 0
+	.uleb128 .LVU6
+	.uleb128 .LVU6
+	.uleb128 0
+.LLST1:
+	.byte	0x4
+	.uleb128 .LVL0-.Ltext0
+	.uleb128 .LVL2-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x4
+	.uleb128 .LVL2-1-.Ltext0
+	.uleb128 .LFE17-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x9f
+	.byte	0
+.LVUS2:
+	.uleb128 0
+	.uleb128 .LVU6
+	.uleb128 .LVU6
+	.uleb128 0
+.LLST2:
+	.byte	0x4
+	.uleb128 .LVL0-.Ltext0
+	.uleb128 .LVL2-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x51
+	.byte	0x4
+	.uleb128 .LVL2-1-.Ltext0
+	.uleb128 .LFE17-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x51
+	.byte	0x9f
+	.byte	0
+.LVUS3:
+	.uleb128 0
+	.uleb128 .LVU6
+	.uleb128 .LVU6
+	.uleb128 0
+.LLST3:
+	.byte	0x4
+	.uleb128 .LVL0-.Ltext0
+	.uleb128 .LVL2-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x52
+	.byte	0x4
+	.uleb128 .LVL2-1-.Ltext0
+	.uleb128 .LFE17-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x52
+	.byte	0x9f
+	.byte	0
+.LVUS4:
+	.uleb128 0
+	.uleb128 .LVU6
+	.uleb128 .LVU6
+	.uleb128 .LVU29
+	.uleb128 .LVU29
+	.uleb128 .LVU30
+	.uleb128 .LVU30
+	.uleb128 0
+.LLST4:
+	.byte	0x4
+	.uleb128 .LVL0-.Ltext0
+	.uleb128 .LVL2-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x58
+	.byte	0x4
+	.uleb128 .LVL2-1-.Ltext0
+	.uleb128 .LVL7-.Ltext0
+	.uleb128 0x1
+	.byte	0x56
+	.byte	0x4
+	.uleb128 .LVL7-.Ltext0
+	.uleb128 .LVL8-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x58
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL8-.Ltext0
+	.uleb128 .LFE17-.Ltext0
+	.uleb128 0x1
+	.byte	0x56
+	.byte	0
+.LVUS6:
+	.uleb128 .LVU17
+	.uleb128 .LVU19
+	.uleb128 .LVU19
+	.uleb128 .LVU19
+.LLST6:
+	.byte	0x4
+	.uleb128 .LVL4-.Ltext0
+	.uleb128 .LVL5-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x4
+	.uleb128 .LVL5-1-.Ltext0
+	.uleb128 .LVL5-.Ltext0
+	.uleb128 0x4
+	.byte	0x91
+	.sleb128 -256
+	.byte	0x9f
+	.byte	0
+.LVUS7:
+	.uleb128 .LVU17
+	.uleb128 .LVU19
+.LLST7:
+	.byte	0x4
+	.uleb128 .LVL4-.Ltext0
+	.uleb128 .LVL5-.Ltext0
+	.uleb128 0x1
+	.byte	0x5c
+	.byte	0
+.LVUS8:
+	.uleb128 0
+	.uleb128 .LVU35
+	.uleb128 .LVU35
+	.uleb128 .LVU51
+	.uleb128 .LVU51
+	.uleb128 0
+.LLST8:
+	.byte	0x4
+	.uleb128 .LVL9-.Ltext0
+	.uleb128 .LVL10-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL10-.Ltext0
+	.uleb128 .LVL12-1-.Ltext0
+	.uleb128 0x3
+	.byte	0x75
+	.sleb128 -32
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL12-1-.Ltext0
+	.uleb128 .LFE18-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x9f
+	.byte	0
+.LVUS9:
+	.uleb128 0
+	.uleb128 .LVU36
+	.uleb128 .LVU36
+	.uleb128 .LVU51
+	.uleb128 .LVU51
+	.uleb128 0
+.LLST9:
+	.byte	0x4
+	.uleb128 .LVL9-.Ltext0
+	.uleb128 .LVL11-.Ltext0
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x4
+	.uleb128 .LVL11-.Ltext0
+	.uleb128 .LVL12-1-.Ltext0
+	.uleb128 0x3
+	.byte	0x74
+	.sleb128 -32
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL12-1-.Ltext0
+	.uleb128 .LFE18-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x9f
+	.byte	0
+.LVUS10:
+	.uleb128 0
+	.uleb128 .LVU57
+	.uleb128 .LVU57
+	.uleb128 0
+.LLST10:
+	.byte	0x4
+	.uleb128 .LVL13-.Ltext0
+	.uleb128 .LVL15-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL15-1-.Ltext0
+	.uleb128 .LFE19-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x9f
+	.byte	0
+.LVUS11:
+	.uleb128 0
+	.uleb128 .LVU56
+	.uleb128 .LVU56
+	.uleb128 0
+.LLST11:
+	.byte	0x4
+	.uleb128 .LVL13-.Ltext0
+	.uleb128 .LVL14-.Ltext0
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x4
+	.uleb128 .LVL14-.Ltext0
+	.uleb128 .LFE19-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x9f
+	.byte	0
+.LVUS12:
+	.uleb128 0
+	.uleb128 .LVU57
+	.uleb128 .LVU57
+	.uleb128 0
+.LLST12:
+	.byte	0x4
+	.uleb128 .LVL13-.Ltext0
+	.uleb128 .LVL15-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x51
+	.byte	0x4
+	.uleb128 .LVL15-1-.Ltext0
+	.uleb128 .LFE19-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x51
+	.byte	0x9f
+	.byte	0
+.Ldebug_loc3:
+	.section	.debug_aranges,"",@progbits
+	.long	0x2c
+	.value	0x2
+	.long	.Ldebug_info0
+	.byte	0x8
+	.byte	0
+	.value	0
+	.value	0
+	.quad	.Ltext0
+	.quad	.Letext0-.Ltext0
+	.quad	0
+	.quad	0
+	.section	.debug_rnglists,"",@progbits
+.Ldebug_ranges0:
+	.long	.Ldebug_ranges3-.Ldebug_ranges2
+.Ldebug_ranges2:
+	.value	0x5
+	.byte	0x8
+	.byte	0
+	.long	0
+.LLRL5:
+	.byte	0x4
+	.uleb128 .LBB6-.Ltext0
+	.uleb128 .LBE6-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB9-.Ltext0
+	.uleb128 .LBE9-.Ltext0
+	.byte	0
+.LLRL17:
+	.byte	0x4
+	.uleb128 .LBB14-.Ltext0
+	.uleb128 .LBE14-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB17-.Ltext0
+	.uleb128 .LBE17-.Ltext0
+	.byte	0
+.Ldebug_ranges3:
+	.section	.debug_line,"",@progbits
+.Ldebug_line0:
+	.section	.debug_str,"MS",@progbits,1
+.LASF9:
+	.string	"__uint8_t"
+.LASF48:
+	.string	"__builtin_memcpy"
+.LASF32:
+	.string	"compress_lanes"
+.LASF42:
+	.string	"dig_len"
+.LASF16:
+	.string	"digest_len"
+.LASF24:
+	.string	"blake2s_lanes"
+.LASF37:
+	.string	"blake2s_init_keyed"
+.LASF31:
+	.string	"lanes"
+.LASF35:
+	.string	"blake2s_update"
+.LASF38:
+	.string	"blake2s_mac_final"
+.LASF22:
+	.string	"blake2s_sigma"
+.LASF36:
+	.string	"blake2s_final"
+.LASF29:
+	.string	"compress"
+.LASF39:
+	.string	"blake2s_mac_init"
+.LASF40:
+	.string	"salt"
+.LASF4:
+	.string	"unsigned char"
+.LASF28:
+	.string	"usable"
+.LASF2:
+	.string	"long unsigned int"
+.LASF5:
+	.string	"short unsigned int"
+.LASF8:
+	.string	"size_t"
+.LASF15:
+	.string	"buf_len"
+.LASF25:
+	.string	"blake2s_mac_key"
+.LASF33:
+	.string	"memset"
+.LASF45:
+	.string	"blake2s_mac"
+.LASF11:
+	.string	"__uint32_t"
+.LASF30:
+	.string	"compress_blocks"
+.LASF17:
+	.string	"last_node"
+.LASF6:
+	.string	"unsigned int"
+.LASF19:
+	.string	"long long unsigned int"
+.LASF13:
+	.string	"uint8_t"
+.LASF46:
+	.string	"blake2s_mac_key_init"
+.LASF18:
+	.string	"empty"
+.LASF21:
+	.string	"blake2s_iv"
+.LASF20:
+	.string	"long long int"
+.LASF34:
+	.string	"memcpy"
+.LASF47:
+	.string	"blake2s_compress"
+.LASF26:
+	.string	"blake2s_kernel"
+.LASF43:
+	.string	"GNU C99 12.2.0 -mtune=generic -march=x86-64 -g -O3 -std=c99 -fasynchronous-unwind-tables"
+.LASF41:
+	.string	"key_len"
+.LASF10:
+	.string	"short int"
+.LASF14:
+	.string	"uint32_t"
+.LASF3:
+	.string	"long int"
+.LASF12:
+	.string	"char"
+.LASF23:
+	.string	"blake2s_ctx"
+.LASF7:
+	.string	"signed char"
+.LASF44:
+	.string	"blake2s_kern"
+.LASF27:
+	.string	"name"
+	.section	.debug_line_str,"MS",@progbits,1
+.LASF1:
+	.string	"/root/repo"
+.LASF0:
+	.string	"blake2s-mac.c"
+	.ident	"GCC: (Debian 12.2.0-14+deb12u1) 12.2.0"
+	.section	.note.GNU-stack,"",@progbits
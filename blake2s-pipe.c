@@ -0,0 +1,159 @@
+#define _XOPEN_SOURCE 700
+
+#include <errno.h>
+#include <pthread.h>
+#include <stdlib.h>
+
+#include "blake2s.h"
+#include "blake2s-internal.h"
+
+/* Pipelined file hashing
+ *
+ * A reader thread fills a ring of B2S_PIPE_SLOTS buffers while the
+ * calling thread hashes them, so I/O latency overlaps the compression.
+ * The ring is single-producer single-consumer: `head` counts the slots
+ * filled and is only written by the reader, `tail` counts the slots
+ * hashed and is only written by the hasher. A side that finds the ring
+ * empty (or full) spins for a little while, then sleeps on a condition
+ * variable; the other side only takes the lock when someone sleeps.
+ * A slot of length 0 ends the stream.
+ */
+#define B2S_PIPE_SLOTS 4
+#define B2S_PIPE_SPIN  1000
+
+struct bpipe {
+    FILE *stream;
+    int fd;                 /* pread() from `off` to `size` unless < 0 */
+    int direct;
+    uint64_t off, size;
+    size_t chunk;
+    unsigned char *buf[B2S_PIPE_SLOTS];
+    size_t len[B2S_PIPE_SLOTS];
+    unsigned long head;
+    unsigned long tail;
+    int err;                /* errno of the reader, set before its last slot */
+    int sleepers;
+    pthread_mutex_t lock;
+    pthread_cond_t wake;
+};
+
+/* bpipe_wait: wait until *pos moves on from `seen` */
+static void bpipe_wait(struct bpipe *Q, unsigned long *pos, unsigned long seen)
+{
+    for (unsigned i = 0; i < B2S_PIPE_SPIN; i++)
+        if (__atomic_load_n(pos, __ATOMIC_ACQUIRE) != seen)
+            return;
+
+    pthread_mutex_lock(&Q->lock);
+    __atomic_store_n(&Q->sleepers, Q->sleepers + 1, __ATOMIC_SEQ_CST);
+    while (__atomic_load_n(pos, __ATOMIC_SEQ_CST) == seen)
+        pthread_cond_wait(&Q->wake, &Q->lock);
+    __atomic_store_n(&Q->sleepers, Q->sleepers - 1, __ATOMIC_SEQ_CST);
+    pthread_mutex_unlock(&Q->lock);
+}
+
+/* bpipe_post: move *pos on to `v` and wake the other side if it sleeps */
+static void bpipe_post(struct bpipe *Q, unsigned long *pos, unsigned long v)
+{
+    __atomic_store_n(pos, v, __ATOMIC_SEQ_CST);
+    if (__atomic_load_n(&Q->sleepers, __ATOMIC_SEQ_CST)) {
+        pthread_mutex_lock(&Q->lock);
+        pthread_cond_broadcast(&Q->wake);
+        pthread_mutex_unlock(&Q->lock);
+    }
+}
+
+static void *bpipe_reader(void *arg)
+{
+    struct bpipe *Q = arg;
+
+    for (unsigned long head = 0;; head++) {
+        unsigned s = head % B2S_PIPE_SLOTS;
+        size_t len;
+
+        if (head - __atomic_load_n(&Q->tail, __ATOMIC_ACQUIRE) == B2S_PIPE_SLOTS)
+            bpipe_wait(Q, &Q->tail, head - B2S_PIPE_SLOTS);
+        if (Q->fd < 0) {
+            len = fread(Q->buf[s], 1, Q->chunk, Q->stream);
+            if (!len && ferror(Q->stream))
+                Q->err = errno ? errno : EIO;
+        } else {
+            ssize_t got = 0;
+            len = Q->size - Q->off < Q->chunk ? Q->size - Q->off : Q->chunk;
+            if (len)
+                got = blake2s_pread(Q->fd, Q->buf[s], Q->direct
+                                    ? B2S_IO_ROUND(len) : len, Q->off);
+            if (got < (ssize_t)len) {
+                Q->err = got < 0 ? errno : EIO; /* EIO: the file shrank */
+                len = 0;
+            }
+            Q->off += len;
+        }
+        Q->len[s] = len;
+        bpipe_post(Q, &Q->head, head + 1);
+        if (!len)
+            break;
+    }
+    return NULL;
+}
+
+int blake2s_pipe_run(struct blake2s_ctx *ctx, FILE *stream, int fd,
+                     uint64_t off, uint64_t size, size_t chunk, int direct)
+{
+    struct bpipe Q;
+    pthread_t reader;
+    unsigned i;
+    int ret = 0;
+
+    Q.stream = stream;
+    Q.fd = fd;
+    Q.direct = direct;
+    Q.off = off;
+    Q.size = size;
+    Q.chunk = chunk;
+    Q.head = Q.tail = 0;
+    Q.err = 0;
+    Q.sleepers = 0;
+    for (i = 0; i < B2S_PIPE_SLOTS; i++)
+        if (posix_memalign((void **)&Q.buf[i], BLAKE2S_IO_ALIGN, chunk))
+            break;
+    if (i < B2S_PIPE_SLOTS) {
+        while (i--)
+            free(Q.buf[i]);
+        errno = ENOMEM;
+        return -1;
+    }
+    pthread_mutex_init(&Q.lock, NULL);
+    pthread_cond_init(&Q.wake, NULL);
+    if (pthread_create(&reader, NULL, bpipe_reader, &Q))
+        goto _out;
+
+    for (unsigned long tail = 0;; tail++) {
+        unsigned s = tail % B2S_PIPE_SLOTS;
+
+        if (__atomic_load_n(&Q.head, __ATOMIC_ACQUIRE) == tail)
+            bpipe_wait(&Q, &Q.head, tail);
+        if (!Q.len[s])
+            break;
+        blake2s_update(ctx, Q.buf[s], Q.len[s]);
+        bpipe_post(&Q, &Q.tail, tail + 1);
+    }
+    pthread_join(reader, NULL);
+    ret = 1;
+    if (Q.err) {
+        errno = Q.err;
+        ret = -1;
+    }
+_out:
+    pthread_cond_destroy(&Q.wake);
+    pthread_mutex_destroy(&Q.lock);
+    for (i = 0; i < B2S_PIPE_SLOTS; i++)
+        free(Q.buf[i]);
+    return ret;
+}
+
+int blake2s_file_pipelined(unsigned char *out, FILE *stream)
+{
+    struct blake2s_io io = { BLAKE2S_IO_PIPE, 0, 0 };
+    return blake2s_file_ex(out, stream, &io);
+}
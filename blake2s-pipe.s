@@ -0,0 +1,5554 @@
+	.file	"blake2s-pipe.c"
+# GNU C99 (Debian 12.2.0-14+deb12u1) version 12.2.0 (x86_64-linux-gnu)
+#	compiled by GNU C version 12.2.0, GMP version 6.2.1, MPFR version 4.2.0, MPC version 1.3.1, isl version isl-0.25-GMP
+
+# GGC heuristics: --param ggc-min-expand=100 --param ggc-min-heapsize=131072
+# options passed: -mtune=generic -march=x86-64 -g -O3 -std=c99 -fasynchronous-unwind-tables
+	.text
+.Ltext0:
+	.file 0 "/root/repo" "blake2s-pipe.c"
+	.p2align 4
+	.type	bpipe_reader, @function
+bpipe_reader:
+.LVL0:
+.LFB25:
+	.file 1 "blake2s-pipe.c"
+	.loc 1 67 1 view -0
+	.cfi_startproc
+	.loc 1 68 5 view .LVU1
+	.loc 1 70 5 view .LVU2
+.LBB16:
+	.loc 1 70 10 view .LVU3
+	.loc 1 70 10 is_stmt 0 view .LVU4
+.LBE16:
+# blake2s-pipe.c:67: {
+	.loc 1 67 1 view .LVU5
+	pushq	%r15	#
+	.cfi_def_cfa_offset 16
+	.cfi_offset 15, -16
+.LBB52:
+.LBB17:
+# blake2s-pipe.c:93:         bpipe_post(Q, &Q->head, head + 1);
+	.loc 1 93 9 view .LVU6
+	leaq	104(%rdi), %rax	#, pretmp_122
+.LBE17:
+.LBE52:
+# blake2s-pipe.c:67: {
+	.loc 1 67 1 view .LVU7
+	pushq	%r14	#
+	.cfi_def_cfa_offset 24
+	.cfi_offset 14, -24
+.LBB53:
+.LBB47:
+.LBB18:
+.LBB19:
+.LBB20:
+# blake2s-pipe.c:48:     __atomic_store_n(&Q->sleepers, Q->sleepers + 1, __ATOMIC_SEQ_CST);
+	.loc 1 48 22 view .LVU8
+	movq	$-4, %r14	#, ivtmp.23
+.LBE20:
+.LBE19:
+.LBE18:
+.LBE47:
+.LBE53:
+# blake2s-pipe.c:67: {
+	.loc 1 67 1 view .LVU9
+	pushq	%r13	#
+	.cfi_def_cfa_offset 32
+	.cfi_offset 13, -32
+.LBB54:
+.LBB48:
+.LBB27:
+.LBB24:
+.LBB21:
+# blake2s-pipe.c:48:     __atomic_store_n(&Q->sleepers, Q->sleepers + 1, __ATOMIC_SEQ_CST);
+	.loc 1 48 22 view .LVU10
+	leaq	124(%rdi), %r13	#, pretmp_124
+.LBE21:
+.LBE24:
+.LBE27:
+.LBE48:
+.LBE54:
+# blake2s-pipe.c:67: {
+	.loc 1 67 1 view .LVU11
+	pushq	%r12	#
+	.cfi_def_cfa_offset 40
+	.cfi_offset 12, -40
+.LBB55:
+.LBB49:
+# blake2s-pipe.c:74:         if (head - __atomic_load_n(&Q->tail, __ATOMIC_ACQUIRE) == B2S_PIPE_SLOTS)
+	.loc 1 74 36 view .LVU12
+	leaq	112(%rdi), %r12	#, pretmp_104
+.LBE49:
+.LBE55:
+# blake2s-pipe.c:67: {
+	.loc 1 67 1 view .LVU13
+	pushq	%rbp	#
+	.cfi_def_cfa_offset 48
+	.cfi_offset 6, -48
+	movq	%rdi, %rbp	# tmp178, arg
+	pushq	%rbx	#
+	.cfi_def_cfa_offset 56
+	.cfi_offset 3, -56
+	subq	$40, %rsp	#,
+	.cfi_def_cfa_offset 96
+.LBB56:
+.LBB50:
+# blake2s-pipe.c:93:         bpipe_post(Q, &Q->head, head + 1);
+	.loc 1 93 9 view .LVU14
+	movq	%rax, 8(%rsp)	# pretmp_122, %sfp
+.LBB28:
+.LBB29:
+.LBB30:
+.LBB31:
+# blake2s-pipe.c:60:         pthread_mutex_lock(&Q->lock);
+	.loc 1 60 9 view .LVU15
+	leaq	128(%rdi), %rax	#, _72
+	movq	%rax, 24(%rsp)	# _72, %sfp
+.LVL1:
+	.p2align 4,,10
+	.p2align 3
+.L17:
+	.loc 1 60 9 view .LVU16
+.LBE31:
+.LBE30:
+.LBE29:
+.LBE28:
+	.loc 1 71 9 is_stmt 1 view .LVU17
+# blake2s-pipe.c:74:         if (head - __atomic_load_n(&Q->tail, __ATOMIC_ACQUIRE) == B2S_PIPE_SLOTS)
+	.loc 1 74 20 is_stmt 0 view .LVU18
+	movq	(%r12), %rax	#* pretmp_104, _3
+	movl	%r14d, %r10d	# ivtmp.23, _36
+	andl	$3, %r10d	#, _36
+.LVL2:
+	.loc 1 72 9 is_stmt 1 view .LVU19
+	.loc 1 74 9 view .LVU20
+# blake2s-pipe.c:74:         if (head - __atomic_load_n(&Q->tail, __ATOMIC_ACQUIRE) == B2S_PIPE_SLOTS)
+	.loc 1 74 12 is_stmt 0 view .LVU21
+	cmpq	%rax, %r14	# _3, ivtmp.23
+	je	.L42	#,
+.LVL3:
+.L3:
+	.loc 1 76 9 is_stmt 1 view .LVU22
+# blake2s-pipe.c:76:         if (Q->fd < 0) {
+	.loc 1 76 14 is_stmt 0 view .LVU23
+	movl	8(%rbp), %edi	# MEM[(struct bpipe *)arg_37(D)].fd, _6
+# blake2s-pipe.c:77:             len = fread(Q->buf[s], 1, Q->chunk, Q->stream);
+	.loc 1 77 19 view .LVU24
+	movq	32(%rbp), %rdx	# MEM[(struct bpipe *)arg_37(D)].chunk, pretmp_126
+# blake2s-pipe.c:76:         if (Q->fd < 0) {
+	.loc 1 76 12 view .LVU25
+	testl	%edi, %edi	# _6
+	js	.L43	#,
+.LBB39:
+	.loc 1 81 13 is_stmt 1 view .LVU26
+.LVL4:
+	.loc 1 82 13 view .LVU27
+# blake2s-pipe.c:82:             len = Q->size - Q->off < Q->chunk ? Q->size - Q->off : Q->chunk;
+	.loc 1 82 30 is_stmt 0 view .LVU28
+	movq	16(%rbp), %rcx	# MEM[(struct bpipe *)arg_37(D)].off, _16
+# blake2s-pipe.c:82:             len = Q->size - Q->off < Q->chunk ? Q->size - Q->off : Q->chunk;
+	.loc 1 82 27 view .LVU29
+	movq	24(%rbp), %rbx	# MEM[(struct bpipe *)arg_37(D)].size, tmp147
+	movl	%r10d, %r15d	# _36, _36
+	subq	%rcx, %rbx	# _16, tmp147
+# blake2s-pipe.c:82:             len = Q->size - Q->off < Q->chunk ? Q->size - Q->off : Q->chunk;
+	.loc 1 82 17 view .LVU30
+	cmpq	%rdx, %rbx	# pretmp_126, tmp147
+	cmova	%rdx, %rbx	# tmp147,, pretmp_126, len
+.LVL5:
+	.loc 1 83 13 is_stmt 1 view .LVU31
+# blake2s-pipe.c:83:             if (len)
+	.loc 1 83 16 is_stmt 0 view .LVU32
+	testq	%rbx, %rbx	# len
+	je	.L11	#,
+	.loc 1 84 17 is_stmt 1 view .LVU33
+# blake2s-pipe.c:84:                 got = blake2s_pread(Q->fd, Q->buf[s], Q->direct
+	.loc 1 84 23 is_stmt 0 view .LVU34
+	movl	12(%rbp), %eax	# MEM[(struct bpipe *)arg_37(D)].direct,
+	movq	%rbx, %rdx	# len, iftmp.3_31
+	testl	%eax, %eax	#
+	je	.L12	#,
+# blake2s-pipe.c:85:                                     ? B2S_IO_ROUND(len) : len, Q->off);
+	.loc 1 85 54 discriminator 1 view .LVU35
+	leaq	4095(%rbx), %rdx	#, tmp149
+# blake2s-pipe.c:84:                 got = blake2s_pread(Q->fd, Q->buf[s], Q->direct
+	.loc 1 84 23 discriminator 1 view .LVU36
+	andq	$-4096, %rdx	#, iftmp.3_31
+.L12:
+# blake2s-pipe.c:84:                 got = blake2s_pread(Q->fd, Q->buf[s], Q->direct
+	.loc 1 84 50 discriminator 4 view .LVU37
+	movl	%r10d, %r15d	# _36, _36
+# blake2s-pipe.c:84:                 got = blake2s_pread(Q->fd, Q->buf[s], Q->direct
+	.loc 1 84 23 discriminator 4 view .LVU38
+	movq	40(%rbp,%r15,8), %rsi	# MEM[(struct bpipe *)arg_37(D)].buf[_36], MEM[(struct bpipe *)arg_37(D)].buf[_36]
+	call	blake2s_pread@PLT	#
+.LVL6:
+	.loc 1 86 13 is_stmt 1 discriminator 4 view .LVU39
+# blake2s-pipe.c:86:             if (got < (ssize_t)len) {
+	.loc 1 86 16 is_stmt 0 discriminator 4 view .LVU40
+	cmpq	%rax, %rbx	# got, len
+	jg	.L13	#,
+# blake2s-pipe.c:90:             Q->off += len;
+	.loc 1 90 20 view .LVU41
+	movq	16(%rbp), %rcx	# MEM[(struct bpipe *)arg_37(D)].off, _16
+	addq	%rbx, %rcx	# len, _16
+.LVL7:
+.L11:
+	.loc 1 90 13 is_stmt 1 view .LVU42
+# blake2s-pipe.c:90:             Q->off += len;
+	.loc 1 90 20 is_stmt 0 view .LVU43
+	movq	%rcx, 16(%rbp)	# _16, MEM[(struct bpipe *)arg_37(D)].off
+	.loc 1 90 20 view .LVU44
+.LBE39:
+	.loc 1 92 9 is_stmt 1 view .LVU45
+# blake2s-pipe.c:93:         bpipe_post(Q, &Q->head, head + 1);
+	.loc 1 93 9 is_stmt 0 view .LVU46
+	leaq	5(%r14), %rax	#, tmp156
+# blake2s-pipe.c:92:         Q->len[s] = len;
+	.loc 1 92 19 view .LVU47
+	movq	%rbx, 72(%rbp,%r15,8)	# len, MEM[(struct bpipe *)arg_37(D)].len[_36]
+	.loc 1 93 9 is_stmt 1 view .LVU48
+.LVL8:
+.LBB40:
+.LBI28:
+	.loc 1 56 13 view .LVU49
+.LBB34:
+	.loc 1 58 5 view .LVU50
+	movq	8(%rsp), %rsi	# %sfp, pretmp_122
+	xchgq	(%rsi), %rax	#,* pretmp_122, tmp157
+.LVL9:
+	.loc 1 58 5 is_stmt 0 view .LVU51
+	.loc 1 59 5 is_stmt 1 view .LVU52
+# blake2s-pipe.c:59:     if (__atomic_load_n(&Q->sleepers, __ATOMIC_SEQ_CST)) {
+	.loc 1 59 9 is_stmt 0 view .LVU53
+	movl	0(%r13), %eax	#* pretmp_124, _71
+# blake2s-pipe.c:59:     if (__atomic_load_n(&Q->sleepers, __ATOMIC_SEQ_CST)) {
+	.loc 1 59 8 view .LVU54
+	testl	%eax, %eax	# _71
+	jne	.L18	#,
+.LVL10:
+.L15:
+	.loc 1 59 8 view .LVU55
+.LBE34:
+.LBE40:
+	.loc 1 94 9 is_stmt 1 view .LVU56
+# blake2s-pipe.c:94:         if (!len)
+	.loc 1 94 12 is_stmt 0 view .LVU57
+	addq	$1, %r14	#, ivtmp.23
+	testq	%rbx, %rbx	# len
+	jne	.L17	#,
+.L29:
+.LBE50:
+.LBE56:
+# blake2s-pipe.c:98: }
+	.loc 1 98 1 view .LVU58
+	addq	$40, %rsp	#,
+	.cfi_remember_state
+	.cfi_def_cfa_offset 56
+	xorl	%eax, %eax	#
+	popq	%rbx	#
+	.cfi_def_cfa_offset 48
+	popq	%rbp	#
+	.cfi_def_cfa_offset 40
+.LVL11:
+	.loc 1 98 1 view .LVU59
+	popq	%r12	#
+	.cfi_def_cfa_offset 32
+.LVL12:
+	.loc 1 98 1 view .LVU60
+	popq	%r13	#
+	.cfi_def_cfa_offset 24
+.LVL13:
+	.loc 1 98 1 view .LVU61
+	popq	%r14	#
+	.cfi_def_cfa_offset 16
+	popq	%r15	#
+	.cfi_def_cfa_offset 8
+	ret	
+.LVL14:
+	.p2align 4,,10
+	.p2align 3
+.L45:
+	.cfi_restore_state
+.LBB57:
+.LBB51:
+# blake2s-pipe.c:78:             if (!len && ferror(Q->stream))
+	.loc 1 78 25 discriminator 1 view .LVU62
+	movq	0(%rbp), %rdi	# MEM[(struct bpipe *)arg_37(D)].stream, MEM[(struct bpipe *)arg_37(D)].stream
+	call	ferror@PLT	#
+.LVL15:
+# blake2s-pipe.c:78:             if (!len && ferror(Q->stream))
+	.loc 1 78 22 discriminator 1 view .LVU63
+	testl	%eax, %eax	# tmp180
+	jne	.L44	#,
+.L9:
+.LVL16:
+	.loc 1 92 9 is_stmt 1 view .LVU64
+# blake2s-pipe.c:92:         Q->len[s] = len;
+	.loc 1 92 19 is_stmt 0 view .LVU65
+	movq	$0, 72(%rbp,%r15,8)	#, MEM[(struct bpipe *)arg_37(D)].len[_36]
+	.loc 1 93 9 is_stmt 1 view .LVU66
+.LVL17:
+.LBB41:
+	.loc 1 56 13 view .LVU67
+.LBB35:
+	.loc 1 58 5 view .LVU68
+.LBE35:
+.LBE41:
+# blake2s-pipe.c:93:         bpipe_post(Q, &Q->head, head + 1);
+	.loc 1 93 9 is_stmt 0 view .LVU69
+	leaq	5(%r14), %rax	#, tmp162
+.LVL18:
+.LBB42:
+.LBB36:
+# blake2s-pipe.c:58:     __atomic_store_n(pos, v, __ATOMIC_SEQ_CST);
+	.loc 1 58 5 view .LVU70
+	movq	8(%rsp), %rsi	# %sfp, pretmp_122
+	xchgq	(%rsi), %rax	#,* pretmp_122, tmp163
+.LVL19:
+	.loc 1 58 5 view .LVU71
+	.loc 1 59 5 is_stmt 1 view .LVU72
+# blake2s-pipe.c:59:     if (__atomic_load_n(&Q->sleepers, __ATOMIC_SEQ_CST)) {
+	.loc 1 59 9 is_stmt 0 view .LVU73
+	movl	0(%r13), %eax	#* pretmp_124, _97
+# blake2s-pipe.c:59:     if (__atomic_load_n(&Q->sleepers, __ATOMIC_SEQ_CST)) {
+	.loc 1 59 8 view .LVU74
+	testl	%eax, %eax	# _97
+	je	.L29	#,
+.LVL20:
+	.p2align 4,,10
+	.p2align 3
+.L18:
+.LBB33:
+.LBI30:
+	.loc 1 56 13 is_stmt 1 view .LVU75
+.LBB32:
+	.loc 1 60 9 view .LVU76
+	movq	24(%rsp), %r15	# %sfp, _72
+	movq	%r15, %rdi	# _72,
+	call	pthread_mutex_lock@PLT	#
+.LVL21:
+	.loc 1 61 9 view .LVU77
+	leaq	168(%rbp), %rdi	#, tmp158
+	call	pthread_cond_broadcast@PLT	#
+.LVL22:
+	.loc 1 62 9 view .LVU78
+	movq	%r15, %rdi	# _72,
+	call	pthread_mutex_unlock@PLT	#
+.LVL23:
+# blake2s-pipe.c:64: }
+	.loc 1 64 1 is_stmt 0 view .LVU79
+	jmp	.L15	#
+.LVL24:
+	.p2align 4,,10
+	.p2align 3
+.L43:
+	.loc 1 64 1 view .LVU80
+.LBE32:
+.LBE33:
+.LBE36:
+.LBE42:
+	.loc 1 77 13 is_stmt 1 view .LVU81
+# blake2s-pipe.c:77:             len = fread(Q->buf[s], 1, Q->chunk, Q->stream);
+	.loc 1 77 31 is_stmt 0 view .LVU82
+	movl	%r10d, %r15d	# _36, _36
+# blake2s-pipe.c:77:             len = fread(Q->buf[s], 1, Q->chunk, Q->stream);
+	.loc 1 77 19 view .LVU83
+	movq	0(%rbp), %rcx	# MEM[(struct bpipe *)arg_37(D)].stream, MEM[(struct bpipe *)arg_37(D)].stream
+	movl	$1, %esi	#,
+	movq	40(%rbp,%r15,8), %rdi	# MEM[(struct bpipe *)arg_37(D)].buf[_36], MEM[(struct bpipe *)arg_37(D)].buf[_36]
+	call	fread@PLT	#
+.LVL25:
+	movq	%rax, %rbx	# tmp179, len
+.LVL26:
+	.loc 1 78 13 is_stmt 1 view .LVU84
+# blake2s-pipe.c:78:             if (!len && ferror(Q->stream))
+	.loc 1 78 16 is_stmt 0 view .LVU85
+	testq	%rax, %rax	# len
+	je	.L45	#,
+	.loc 1 92 9 is_stmt 1 view .LVU86
+# blake2s-pipe.c:92:         Q->len[s] = len;
+	.loc 1 92 19 is_stmt 0 view .LVU87
+	movq	%rax, 72(%rbp,%r15,8)	# len, MEM[(struct bpipe *)arg_37(D)].len[_36]
+	.loc 1 93 9 is_stmt 1 view .LVU88
+.LVL27:
+.LBB43:
+	.loc 1 56 13 view .LVU89
+.LBB37:
+	.loc 1 58 5 view .LVU90
+.LBE37:
+.LBE43:
+# blake2s-pipe.c:93:         bpipe_post(Q, &Q->head, head + 1);
+	.loc 1 93 9 is_stmt 0 view .LVU91
+	leaq	5(%r14), %rax	#, tmp166
+.LVL28:
+.LBB44:
+.LBB38:
+# blake2s-pipe.c:58:     __atomic_store_n(pos, v, __ATOMIC_SEQ_CST);
+	.loc 1 58 5 view .LVU92
+	movq	8(%rsp), %rsi	# %sfp, pretmp_122
+	xchgq	(%rsi), %rax	#,* pretmp_122, tmp167
+.LVL29:
+	.loc 1 58 5 view .LVU93
+	.loc 1 59 5 is_stmt 1 view .LVU94
+# blake2s-pipe.c:59:     if (__atomic_load_n(&Q->sleepers, __ATOMIC_SEQ_CST)) {
+	.loc 1 59 9 is_stmt 0 view .LVU95
+	movl	0(%r13), %eax	#* pretmp_124, _105
+# blake2s-pipe.c:59:     if (__atomic_load_n(&Q->sleepers, __ATOMIC_SEQ_CST)) {
+	.loc 1 59 8 view .LVU96
+	testl	%eax, %eax	# _105
+	jne	.L18	#,
+.LVL30:
+	.loc 1 59 8 view .LVU97
+.LBE38:
+.LBE44:
+	.loc 1 94 9 is_stmt 1 view .LVU98
+# blake2s-pipe.c:74:         if (head - __atomic_load_n(&Q->tail, __ATOMIC_ACQUIRE) == B2S_PIPE_SLOTS)
+	.loc 1 74 20 is_stmt 0 view .LVU99
+	movq	(%r12), %rax	#* pretmp_104, _3
+# blake2s-pipe.c:94:         if (!len)
+	.loc 1 94 12 view .LVU100
+	addq	$1, %r14	#, ivtmp.23
+.LVL31:
+	.loc 1 71 9 is_stmt 1 view .LVU101
+# blake2s-pipe.c:74:         if (head - __atomic_load_n(&Q->tail, __ATOMIC_ACQUIRE) == B2S_PIPE_SLOTS)
+	.loc 1 74 20 is_stmt 0 view .LVU102
+	movl	%r14d, %r10d	# ivtmp.23, _36
+	andl	$3, %r10d	#, _36
+.LVL32:
+	.loc 1 72 9 is_stmt 1 view .LVU103
+	.loc 1 74 9 view .LVU104
+# blake2s-pipe.c:74:         if (head - __atomic_load_n(&Q->tail, __ATOMIC_ACQUIRE) == B2S_PIPE_SLOTS)
+	.loc 1 74 12 is_stmt 0 view .LVU105
+	cmpq	%rax, %r14	# _3, ivtmp.23
+	jne	.L3	#,
+.LVL33:
+	.p2align 4,,10
+	.p2align 3
+.L42:
+	.loc 1 74 12 view .LVU106
+	movl	$1000, %eax	#, ivtmp_98
+	.p2align 4,,10
+	.p2align 3
+.L2:
+.LBB45:
+.LBB25:
+	.loc 1 44 9 is_stmt 1 view .LVU107
+# blake2s-pipe.c:44:         if (__atomic_load_n(pos, __ATOMIC_ACQUIRE) != seen)
+	.loc 1 44 13 is_stmt 0 view .LVU108
+	movq	(%r12), %rdx	#* pretmp_104, _57
+# blake2s-pipe.c:44:         if (__atomic_load_n(pos, __ATOMIC_ACQUIRE) != seen)
+	.loc 1 44 12 view .LVU109
+	cmpq	%r14, %rdx	# ivtmp.23, _57
+	jne	.L3	#,
+	.loc 1 43 37 is_stmt 1 view .LVU110
+	.loc 1 43 28 view .LVU111
+	subl	$1, %eax	#, ivtmp_98
+	jne	.L2	#,
+.LBE25:
+.LBB26:
+.LBB22:
+# blake2s-pipe.c:47:     pthread_mutex_lock(&Q->lock);
+	.loc 1 47 5 is_stmt 0 view .LVU112
+	leaq	128(%rbp), %rbx	#, _60
+	movl	%r10d, 20(%rsp)	# _36, %sfp
+.LVL34:
+	.loc 1 47 5 view .LVU113
+.LBE22:
+.LBI19:
+	.loc 1 41 13 is_stmt 1 view .LVU114
+.LBB23:
+	.loc 1 47 5 view .LVU115
+	movq	%rbx, %rdi	# _60,
+	call	pthread_mutex_lock@PLT	#
+.LVL35:
+	.loc 1 48 5 view .LVU116
+# blake2s-pipe.c:48:     __atomic_store_n(&Q->sleepers, Q->sleepers + 1, __ATOMIC_SEQ_CST);
+	.loc 1 48 48 is_stmt 0 view .LVU117
+	movl	124(%rbp), %eax	# MEM[(struct bpipe *)arg_37(D)].sleepers, tmp192
+# blake2s-pipe.c:48:     __atomic_store_n(&Q->sleepers, Q->sleepers + 1, __ATOMIC_SEQ_CST);
+	.loc 1 48 5 view .LVU118
+# blake2s-pipe.c:48:     __atomic_store_n(&Q->sleepers, Q->sleepers + 1, __ATOMIC_SEQ_CST);
+	.loc 1 48 48 view .LVU119
+	addl	$1, %eax	#, tmp135
+# blake2s-pipe.c:48:     __atomic_store_n(&Q->sleepers, Q->sleepers + 1, __ATOMIC_SEQ_CST);
+	.loc 1 48 5 view .LVU120
+	xchgl	0(%r13), %eax	#,* pretmp_124, tmp137
+.LVL36:
+	.loc 1 48 5 view .LVU121
+	.loc 1 49 5 is_stmt 1 view .LVU122
+# blake2s-pipe.c:49:     while (__atomic_load_n(pos, __ATOMIC_SEQ_CST) == seen)
+	.loc 1 49 11 is_stmt 0 view .LVU123
+	movl	20(%rsp), %r10d	# %sfp, _36
+# blake2s-pipe.c:50:         pthread_cond_wait(&Q->wake, &Q->lock);
+	.loc 1 50 9 view .LVU124
+	leaq	168(%rbp), %r15	#, tmp176
+# blake2s-pipe.c:49:     while (__atomic_load_n(pos, __ATOMIC_SEQ_CST) == seen)
+	.loc 1 49 11 view .LVU125
+	jmp	.L5	#
+	.p2align 4,,10
+	.p2align 3
+.L6:
+	.loc 1 50 9 is_stmt 1 view .LVU126
+	movq	%rbx, %rsi	# _60,
+	movq	%r15, %rdi	# tmp176,
+	call	pthread_cond_wait@PLT	#
+.LVL37:
+	movl	20(%rsp), %r10d	# %sfp, _36
+.L5:
+	.loc 1 49 36 view .LVU127
+# blake2s-pipe.c:49:     while (__atomic_load_n(pos, __ATOMIC_SEQ_CST) == seen)
+	.loc 1 49 12 is_stmt 0 view .LVU128
+	movq	(%r12), %rax	#* pretmp_104, _66
+	movl	%r10d, 20(%rsp)	# _36, %sfp
+# blake2s-pipe.c:49:     while (__atomic_load_n(pos, __ATOMIC_SEQ_CST) == seen)
+	.loc 1 49 36 view .LVU129
+	cmpq	%r14, %rax	# ivtmp.23, _66
+	je	.L6	#,
+	.loc 1 51 5 is_stmt 1 view .LVU130
+# blake2s-pipe.c:51:     __atomic_store_n(&Q->sleepers, Q->sleepers - 1, __ATOMIC_SEQ_CST);
+	.loc 1 51 48 is_stmt 0 view .LVU131
+	movl	124(%rbp), %eax	# MEM[(struct bpipe *)arg_37(D)].sleepers, tmp193
+# blake2s-pipe.c:51:     __atomic_store_n(&Q->sleepers, Q->sleepers - 1, __ATOMIC_SEQ_CST);
+	.loc 1 51 5 view .LVU132
+# blake2s-pipe.c:51:     __atomic_store_n(&Q->sleepers, Q->sleepers - 1, __ATOMIC_SEQ_CST);
+	.loc 1 51 48 view .LVU133
+	subl	$1, %eax	#, tmp139
+# blake2s-pipe.c:51:     __atomic_store_n(&Q->sleepers, Q->sleepers - 1, __ATOMIC_SEQ_CST);
+	.loc 1 51 5 view .LVU134
+	xchgl	0(%r13), %eax	#,* pretmp_124, tmp141
+	.loc 1 52 5 is_stmt 1 view .LVU135
+	movq	%rbx, %rdi	# _60,
+	call	pthread_mutex_unlock@PLT	#
+.LVL38:
+	movl	20(%rsp), %r10d	# %sfp, _36
+	jmp	.L3	#
+.LVL39:
+	.p2align 4,,10
+	.p2align 3
+.L13:
+	.loc 1 52 5 is_stmt 0 view .LVU136
+.LBE23:
+.LBE26:
+.LBE45:
+.LBB46:
+	.loc 1 87 17 is_stmt 1 view .LVU137
+# blake2s-pipe.c:87:                 Q->err = got < 0 ? errno : EIO; /* EIO: the file shrank */
+	.loc 1 87 41 is_stmt 0 view .LVU138
+	movl	$5, %edx	#, iftmp.5_32
+	testq	%rax, %rax	# got
+	jns	.L14	#,
+# blake2s-pipe.c:87:                 Q->err = got < 0 ? errno : EIO; /* EIO: the file shrank */
+	.loc 1 87 37 discriminator 1 view .LVU139
+	call	__errno_location@PLT	#
+.LVL40:
+# blake2s-pipe.c:87:                 Q->err = got < 0 ? errno : EIO; /* EIO: the file shrank */
+	.loc 1 87 41 discriminator 1 view .LVU140
+	movl	(%rax), %edx	# *_22, iftmp.5_32
+.L14:
+# blake2s-pipe.c:87:                 Q->err = got < 0 ? errno : EIO; /* EIO: the file shrank */
+	.loc 1 87 24 discriminator 4 view .LVU141
+	movl	%edx, 120(%rbp)	# iftmp.5_32, MEM[(struct bpipe *)arg_37(D)].err
+	.loc 1 88 17 is_stmt 1 discriminator 4 view .LVU142
+.LVL41:
+# blake2s-pipe.c:90:             Q->off += len;
+	.loc 1 90 14 is_stmt 0 discriminator 4 view .LVU143
+	movq	16(%rbp), %rcx	# MEM[(struct bpipe *)arg_37(D)].off, _16
+# blake2s-pipe.c:88:                 len = 0;
+	.loc 1 88 21 discriminator 4 view .LVU144
+	xorl	%ebx, %ebx	# len
+	jmp	.L11	#
+.LVL42:
+	.p2align 4,,10
+	.p2align 3
+.L44:
+	.loc 1 88 21 discriminator 4 view .LVU145
+.LBE46:
+	.loc 1 79 17 is_stmt 1 view .LVU146
+# blake2s-pipe.c:79:                 Q->err = errno ? errno : EIO;
+	.loc 1 79 27 is_stmt 0 view .LVU147
+	call	__errno_location@PLT	#
+.LVL43:
+# blake2s-pipe.c:79:                 Q->err = errno ? errno : EIO;
+	.loc 1 79 39 view .LVU148
+	movl	$5, %edx	#, tmp169
+# blake2s-pipe.c:79:                 Q->err = errno ? errno : EIO;
+	.loc 1 79 26 view .LVU149
+	movl	(%rax), %eax	# *_12, _13
+# blake2s-pipe.c:79:                 Q->err = errno ? errno : EIO;
+	.loc 1 79 39 view .LVU150
+	testl	%eax, %eax	# _13
+	cmove	%edx, %eax	# _13,, tmp169, _13
+# blake2s-pipe.c:79:                 Q->err = errno ? errno : EIO;
+	.loc 1 79 24 view .LVU151
+	movl	%eax, 120(%rbp)	# _13, MEM[(struct bpipe *)arg_37(D)].err
+	jmp	.L9	#
+.LBE51:
+.LBE57:
+	.cfi_endproc
+.LFE25:
+	.size	bpipe_reader, .-bpipe_reader
+	.p2align 4
+	.globl	blake2s_pipe_run
+	.type	blake2s_pipe_run, @function
+blake2s_pipe_run:
+.LVL44:
+.LFB26:
+	.loc 1 102 1 is_stmt 1 view -0
+	.cfi_startproc
+	.loc 1 103 5 view .LVU153
+	.loc 1 104 5 view .LVU154
+	.loc 1 105 5 view .LVU155
+	.loc 1 106 5 view .LVU156
+	.loc 1 108 5 view .LVU157
+# blake2s-pipe.c:102: {
+	.loc 1 102 1 is_stmt 0 view .LVU158
+	pushq	%r15	#
+	.cfi_def_cfa_offset 16
+	.cfi_offset 15, -16
+# blake2s-pipe.c:114:     Q.head = Q.tail = 0;
+	.loc 1 114 12 view .LVU159
+	pxor	%xmm0, %xmm0	# tmp127
+# blake2s-pipe.c:102: {
+	.loc 1 102 1 view .LVU160
+	pushq	%r14	#
+	.cfi_def_cfa_offset 24
+	.cfi_offset 14, -24
+	movq	%r9, %r14	# tmp182, chunk
+	pushq	%r13	#
+	.cfi_def_cfa_offset 32
+	.cfi_offset 13, -32
+	pushq	%r12	#
+	.cfi_def_cfa_offset 40
+	.cfi_offset 12, -40
+	movq	%rdi, %r12	# tmp177, ctx
+	pushq	%rbp	#
+	.cfi_def_cfa_offset 48
+	.cfi_offset 6, -48
+# blake2s-pipe.c:117:     for (i = 0; i < B2S_PIPE_SLOTS; i++)
+	.loc 1 117 12 view .LVU161
+	xorl	%ebp, %ebp	# i
+# blake2s-pipe.c:102: {
+	.loc 1 102 1 view .LVU162
+	pushq	%rbx	#
+	.cfi_def_cfa_offset 56
+	.cfi_offset 3, -56
+	subq	$248, %rsp	#,
+	.cfi_def_cfa_offset 304
+# blake2s-pipe.c:110:     Q.direct = direct;
+	.loc 1 110 14 view .LVU163
+	movl	304(%rsp), %eax	# direct, direct
+# blake2s-pipe.c:108:     Q.stream = stream;
+	.loc 1 108 14 view .LVU164
+	movq	%rsi, 16(%rsp)	# tmp178, Q.stream
+	.loc 1 109 5 is_stmt 1 view .LVU165
+	leaq	56(%rsp), %r13	#, ivtmp.66
+# blake2s-pipe.c:109:     Q.fd = fd;
+	.loc 1 109 10 is_stmt 0 view .LVU166
+	movl	%edx, 24(%rsp)	# tmp179, Q.fd
+	.loc 1 110 5 is_stmt 1 view .LVU167
+# blake2s-pipe.c:110:     Q.direct = direct;
+	.loc 1 110 14 is_stmt 0 view .LVU168
+	movl	%eax, 28(%rsp)	# direct, Q.direct
+	.loc 1 111 5 is_stmt 1 view .LVU169
+# blake2s-pipe.c:111:     Q.off = off;
+	.loc 1 111 11 is_stmt 0 view .LVU170
+	movq	%rcx, 32(%rsp)	# tmp180, Q.off
+	.loc 1 112 5 is_stmt 1 view .LVU171
+# blake2s-pipe.c:112:     Q.size = size;
+	.loc 1 112 12 is_stmt 0 view .LVU172
+	movq	%r8, 40(%rsp)	# tmp181, Q.size
+	.loc 1 113 5 is_stmt 1 view .LVU173
+# blake2s-pipe.c:113:     Q.chunk = chunk;
+	.loc 1 113 13 is_stmt 0 view .LVU174
+	movq	%r9, 48(%rsp)	# chunk, Q.chunk
+	.loc 1 114 5 is_stmt 1 view .LVU175
+# blake2s-pipe.c:115:     Q.err = 0;
+	.loc 1 115 11 is_stmt 0 view .LVU176
+	movq	$0, 136(%rsp)	#, MEM <vector(2) int> [(int *)&Q + 120B]
+# blake2s-pipe.c:114:     Q.head = Q.tail = 0;
+	.loc 1 114 12 view .LVU177
+	movups	%xmm0, 120(%rsp)	# tmp127, MEM <vector(2) long unsigned int> [(long unsigned int *)&Q + 104B]
+	.loc 1 115 5 is_stmt 1 view .LVU178
+	.loc 1 116 5 view .LVU179
+	.loc 1 117 5 view .LVU180
+.LVL45:
+	.loc 1 117 19 view .LVU181
+.L48:
+	.loc 1 118 9 view .LVU182
+# blake2s-pipe.c:118:         if (posix_memalign((void **)&Q.buf[i], BLAKE2S_IO_ALIGN, chunk))
+	.loc 1 118 13 is_stmt 0 view .LVU183
+	movq	%r14, %rdx	# chunk,
+	movl	$4096, %esi	#,
+	movq	%r13, %rdi	# ivtmp.66,
+	call	posix_memalign@PLT	#
+.LVL46:
+	movl	%eax, %ebx	# tmp183, <retval>
+# blake2s-pipe.c:118:         if (posix_memalign((void **)&Q.buf[i], BLAKE2S_IO_ALIGN, chunk))
+	.loc 1 118 12 view .LVU184
+	testl	%eax, %eax	# <retval>
+	jne	.L47	#,
+	.loc 1 117 25 is_stmt 1 discriminator 2 view .LVU185
+	addl	$1, %ebp	#, i
+.LVL47:
+	.loc 1 117 19 discriminator 2 view .LVU186
+	addq	$8, %r13	#, ivtmp.66
+	cmpl	$4, %ebp	#, i
+	jne	.L48	#,
+	.loc 1 120 5 view .LVU187
+	.loc 1 126 5 view .LVU188
+	leaq	144(%rsp), %r13	#, tmp175
+	xorl	%esi, %esi	#
+	leaq	16(%rsp), %rbp	#, tmp174
+.LVL48:
+	.loc 1 126 5 is_stmt 0 view .LVU189
+	movq	%r13, %rdi	# tmp175,
+# blake2s-pipe.c:127:     pthread_cond_init(&Q.wake, NULL);
+	.loc 1 127 5 view .LVU190
+	leaq	184(%rsp), %r14	#, tmp176
+.LVL49:
+# blake2s-pipe.c:126:     pthread_mutex_init(&Q.lock, NULL);
+	.loc 1 126 5 view .LVU191
+	call	pthread_mutex_init@PLT	#
+.LVL50:
+	.loc 1 127 5 is_stmt 1 view .LVU192
+	xorl	%esi, %esi	#
+	movq	%r14, %rdi	# tmp176,
+	call	pthread_cond_init@PLT	#
+.LVL51:
+	.loc 1 128 5 view .LVU193
+# blake2s-pipe.c:128:     if (pthread_create(&reader, NULL, bpipe_reader, &Q))
+	.loc 1 128 9 is_stmt 0 view .LVU194
+	xorl	%esi, %esi	#
+	leaq	8(%rsp), %rdi	#, tmp139
+	movq	%rbp, %rcx	# tmp174,
+	leaq	bpipe_reader(%rip), %rdx	#, tmp140
+	call	pthread_create@PLT	#
+.LVL52:
+# blake2s-pipe.c:128:     if (pthread_create(&reader, NULL, bpipe_reader, &Q))
+	.loc 1 128 8 view .LVU195
+	testl	%eax, %eax	# tmp185
+	jne	.L53	#,
+.LBB70:
+# blake2s-pipe.c:131:     for (unsigned long tail = 0;; tail++) {
+	.loc 1 131 24 view .LVU196
+	xorl	%ebx, %ebx	# tail
+.LVL53:
+	.p2align 4,,10
+	.p2align 3
+.L54:
+.LBB71:
+	.loc 1 132 9 is_stmt 1 view .LVU197
+# blake2s-pipe.c:134:         if (__atomic_load_n(&Q.head, __ATOMIC_ACQUIRE) == tail)
+	.loc 1 134 13 is_stmt 0 view .LVU198
+	movq	120(%rsp), %rax	#, _8
+# blake2s-pipe.c:132:         unsigned s = tail % B2S_PIPE_SLOTS;
+	.loc 1 132 18 view .LVU199
+	movl	%ebx, %r15d	# tail, s
+# blake2s-pipe.c:134:         if (__atomic_load_n(&Q.head, __ATOMIC_ACQUIRE) == tail)
+	.loc 1 134 13 view .LVU200
+# blake2s-pipe.c:132:         unsigned s = tail % B2S_PIPE_SLOTS;
+	.loc 1 132 18 view .LVU201
+	andl	$3, %r15d	#, s
+.LVL54:
+	.loc 1 134 9 is_stmt 1 view .LVU202
+# blake2s-pipe.c:134:         if (__atomic_load_n(&Q.head, __ATOMIC_ACQUIRE) == tail)
+	.loc 1 134 12 is_stmt 0 view .LVU203
+	cmpq	%rbx, %rax	# tail, _8
+	je	.L78	#,
+.L56:
+	.loc 1 136 9 is_stmt 1 view .LVU204
+# blake2s-pipe.c:136:         if (!Q.len[s])
+	.loc 1 136 19 is_stmt 0 view .LVU205
+	movl	%r15d, %eax	# s, s
+	movq	88(%rsp,%rax,8), %rdx	# Q.len[s_52], _9
+# blake2s-pipe.c:136:         if (!Q.len[s])
+	.loc 1 136 12 view .LVU206
+	testq	%rdx, %rdx	# _9
+	je	.L60	#,
+	.loc 1 138 9 is_stmt 1 view .LVU207
+	movq	56(%rsp,%rax,8), %rsi	# Q.buf[s_52], Q.buf[s_52]
+	movq	%r12, %rdi	# ctx,
+# blake2s-pipe.c:139:         bpipe_post(&Q, &Q.tail, tail + 1);
+	.loc 1 139 9 is_stmt 0 view .LVU208
+	addq	$1, %rbx	#, tail
+.LVL55:
+# blake2s-pipe.c:138:         blake2s_update(ctx, Q.buf[s], Q.len[s]);
+	.loc 1 138 9 view .LVU209
+	call	blake2s_update@PLT	#
+.LVL56:
+	.loc 1 139 9 is_stmt 1 view .LVU210
+.LBB72:
+.LBI72:
+	.loc 1 56 13 view .LVU211
+.LBB73:
+	.loc 1 58 5 view .LVU212
+	movq	%rbx, %rax	# tail, tmp160
+	xchgq	128(%rsp), %rax	#,, tmp160
+	.loc 1 59 5 view .LVU213
+# blake2s-pipe.c:59:     if (__atomic_load_n(&Q->sleepers, __ATOMIC_SEQ_CST)) {
+	.loc 1 59 9 is_stmt 0 view .LVU214
+	movl	140(%rsp), %eax	#, _83
+# blake2s-pipe.c:59:     if (__atomic_load_n(&Q->sleepers, __ATOMIC_SEQ_CST)) {
+	.loc 1 59 8 view .LVU215
+	testl	%eax, %eax	# _83
+	je	.L54	#,
+.LVL57:
+.LBB74:
+.LBI74:
+	.loc 1 56 13 is_stmt 1 view .LVU216
+.LBB75:
+	.loc 1 60 9 view .LVU217
+	movq	%r13, %rdi	# tmp175,
+	call	pthread_mutex_lock@PLT	#
+.LVL58:
+	.loc 1 61 9 view .LVU218
+	movq	%r14, %rdi	# tmp176,
+	call	pthread_cond_broadcast@PLT	#
+.LVL59:
+	.loc 1 62 9 view .LVU219
+	movq	%r13, %rdi	# tmp175,
+	call	pthread_mutex_unlock@PLT	#
+.LVL60:
+# blake2s-pipe.c:64: }
+	.loc 1 64 1 is_stmt 0 view .LVU220
+	jmp	.L54	#
+.LVL61:
+	.p2align 4,,10
+	.p2align 3
+.L47:
+	.loc 1 64 1 view .LVU221
+.LBE75:
+.LBE74:
+.LBE73:
+.LBE72:
+.LBE71:
+.LBE70:
+	.loc 1 120 5 is_stmt 1 view .LVU222
+	.loc 1 121 16 view .LVU223
+# blake2s-pipe.c:121:         while (i--)
+	.loc 1 121 17 is_stmt 0 view .LVU224
+	leal	-1(%rbp), %eax	#,
+.LVL62:
+# blake2s-pipe.c:121:         while (i--)
+	.loc 1 121 16 view .LVU225
+	testl	%ebp, %ebp	# i
+	je	.L50	#,
+	leaq	16(%rsp), %rbp	#, tmp130
+	leaq	0(%rbp,%rax,8), %rbx	#, ivtmp.41
+.LVL63:
+.L51:
+	.loc 1 122 13 is_stmt 1 view .LVU226
+	movq	40(%rbx), %rdi	# MEM[(unsigned char * *)_18 + 40B], MEM[(unsigned char * *)_18 + 40B]
+	call	free@PLT	#
+.LVL64:
+	.loc 1 121 16 view .LVU227
+	movq	%rbx, %rax	# ivtmp.41, ivtmp.41
+	subq	$8, %rbx	#, ivtmp.41
+	cmpq	%rax, %rbp	# ivtmp.41, tmp130
+	jne	.L51	#,
+.L50:
+	.loc 1 123 8 view .LVU228
+# blake2s-pipe.c:123:         errno = ENOMEM;
+	.loc 1 123 10 is_stmt 0 view .LVU229
+	call	__errno_location@PLT	#
+.LVL65:
+# blake2s-pipe.c:124:         return -1;
+	.loc 1 124 16 view .LVU230
+	movl	$-1, %ebx	#, <retval>
+# blake2s-pipe.c:123:         errno = ENOMEM;
+	.loc 1 123 14 view .LVU231
+	movl	$12, (%rax)	#, *_5
+	.loc 1 124 9 is_stmt 1 view .LVU232
+.LVL66:
+.L46:
+# blake2s-pipe.c:153: }
+	.loc 1 153 1 is_stmt 0 view .LVU233
+	addq	$248, %rsp	#,
+	.cfi_remember_state
+	.cfi_def_cfa_offset 56
+	movl	%ebx, %eax	# <retval>,
+	popq	%rbx	#
+	.cfi_def_cfa_offset 48
+	popq	%rbp	#
+	.cfi_def_cfa_offset 40
+	popq	%r12	#
+	.cfi_def_cfa_offset 32
+	popq	%r13	#
+	.cfi_def_cfa_offset 24
+	popq	%r14	#
+	.cfi_def_cfa_offset 16
+	popq	%r15	#
+	.cfi_def_cfa_offset 8
+	ret	
+.LVL67:
+	.p2align 4,,10
+	.p2align 3
+.L78:
+	.cfi_restore_state
+.LBB81:
+.LBB80:
+	.loc 1 153 1 view .LVU234
+	movl	$1000, %eax	#, ivtmp_70
+	.p2align 4,,10
+	.p2align 3
+.L55:
+.LBB76:
+.LBB77:
+	.loc 1 44 9 is_stmt 1 view .LVU235
+# blake2s-pipe.c:44:         if (__atomic_load_n(pos, __ATOMIC_ACQUIRE) != seen)
+	.loc 1 44 13 is_stmt 0 view .LVU236
+	movq	120(%rsp), %rdx	#, _69
+# blake2s-pipe.c:44:         if (__atomic_load_n(pos, __ATOMIC_ACQUIRE) != seen)
+	.loc 1 44 12 view .LVU237
+	cmpq	%rdx, %rbx	# _69, tail
+	jne	.L56	#,
+	.loc 1 43 37 is_stmt 1 view .LVU238
+	.loc 1 43 28 view .LVU239
+	subl	$1, %eax	#, ivtmp_70
+	jne	.L55	#,
+.LVL68:
+	.loc 1 43 28 is_stmt 0 view .LVU240
+.LBE77:
+.LBB78:
+.LBI78:
+	.loc 1 41 13 is_stmt 1 view .LVU241
+.LBB79:
+	.loc 1 47 5 view .LVU242
+	movq	%r13, %rdi	# tmp175,
+	call	pthread_mutex_lock@PLT	#
+.LVL69:
+	.loc 1 48 5 view .LVU243
+# blake2s-pipe.c:48:     __atomic_store_n(&Q->sleepers, Q->sleepers + 1, __ATOMIC_SEQ_CST);
+	.loc 1 48 48 is_stmt 0 view .LVU244
+	movl	140(%rsp), %eax	# Q.sleepers, tmp189
+# blake2s-pipe.c:48:     __atomic_store_n(&Q->sleepers, Q->sleepers + 1, __ATOMIC_SEQ_CST);
+	.loc 1 48 5 view .LVU245
+# blake2s-pipe.c:48:     __atomic_store_n(&Q->sleepers, Q->sleepers + 1, __ATOMIC_SEQ_CST);
+	.loc 1 48 48 view .LVU246
+	addl	$1, %eax	#, tmp143
+# blake2s-pipe.c:48:     __atomic_store_n(&Q->sleepers, Q->sleepers + 1, __ATOMIC_SEQ_CST);
+	.loc 1 48 5 view .LVU247
+	xchgl	140(%rsp), %eax	#,, tmp145
+	.loc 1 49 5 is_stmt 1 view .LVU248
+# blake2s-pipe.c:49:     while (__atomic_load_n(pos, __ATOMIC_SEQ_CST) == seen)
+	.loc 1 49 11 is_stmt 0 view .LVU249
+	jmp	.L58	#
+	.p2align 4,,10
+	.p2align 3
+.L59:
+	.loc 1 50 9 is_stmt 1 view .LVU250
+	movq	%r13, %rsi	# tmp175,
+	movq	%r14, %rdi	# tmp176,
+	call	pthread_cond_wait@PLT	#
+.LVL70:
+.L58:
+	.loc 1 49 36 view .LVU251
+# blake2s-pipe.c:49:     while (__atomic_load_n(pos, __ATOMIC_SEQ_CST) == seen)
+	.loc 1 49 12 is_stmt 0 view .LVU252
+	movq	120(%rsp), %rax	#, _78
+# blake2s-pipe.c:49:     while (__atomic_load_n(pos, __ATOMIC_SEQ_CST) == seen)
+	.loc 1 49 36 view .LVU253
+	cmpq	%rax, %rbx	# _78, tail
+	je	.L59	#,
+	.loc 1 51 5 is_stmt 1 view .LVU254
+# blake2s-pipe.c:51:     __atomic_store_n(&Q->sleepers, Q->sleepers - 1, __ATOMIC_SEQ_CST);
+	.loc 1 51 48 is_stmt 0 view .LVU255
+	movl	140(%rsp), %eax	# Q.sleepers, tmp190
+# blake2s-pipe.c:51:     __atomic_store_n(&Q->sleepers, Q->sleepers - 1, __ATOMIC_SEQ_CST);
+	.loc 1 51 5 view .LVU256
+# blake2s-pipe.c:51:     __atomic_store_n(&Q->sleepers, Q->sleepers - 1, __ATOMIC_SEQ_CST);
+	.loc 1 51 48 view .LVU257
+	subl	$1, %eax	#, tmp150
+# blake2s-pipe.c:51:     __atomic_store_n(&Q->sleepers, Q->sleepers - 1, __ATOMIC_SEQ_CST);
+	.loc 1 51 5 view .LVU258
+	xchgl	140(%rsp), %eax	#,, tmp152
+	.loc 1 52 5 is_stmt 1 view .LVU259
+	movq	%r13, %rdi	# tmp175,
+	call	pthread_mutex_unlock@PLT	#
+.LVL71:
+	jmp	.L56	#
+.LVL72:
+	.p2align 4,,10
+	.p2align 3
+.L60:
+	.loc 1 52 5 is_stmt 0 view .LVU260
+.LBE79:
+.LBE78:
+.LBE76:
+.LBE80:
+.LBE81:
+	.loc 1 141 5 is_stmt 1 view .LVU261
+	movq	8(%rsp), %rdi	# reader,
+	xorl	%esi, %esi	#
+# blake2s-pipe.c:142:     ret = 1;
+	.loc 1 142 9 is_stmt 0 view .LVU262
+	movl	$1, %ebx	#, <retval>
+.LVL73:
+# blake2s-pipe.c:141:     pthread_join(reader, NULL);
+	.loc 1 141 5 view .LVU263
+	call	pthread_join@PLT	#
+.LVL74:
+	.loc 1 142 5 is_stmt 1 view .LVU264
+	.loc 1 143 5 view .LVU265
+# blake2s-pipe.c:143:     if (Q.err) {
+	.loc 1 143 10 is_stmt 0 view .LVU266
+	movl	136(%rsp), %r12d	# Q.err, _13
+.LVL75:
+# blake2s-pipe.c:143:     if (Q.err) {
+	.loc 1 143 8 view .LVU267
+	testl	%r12d, %r12d	# _13
+	je	.L53	#,
+	.loc 1 144 8 is_stmt 1 view .LVU268
+# blake2s-pipe.c:144:         errno = Q.err;
+	.loc 1 144 10 is_stmt 0 view .LVU269
+	call	__errno_location@PLT	#
+.LVL76:
+# blake2s-pipe.c:145:         ret = -1;
+	.loc 1 145 13 view .LVU270
+	movl	$-1, %ebx	#, <retval>
+# blake2s-pipe.c:144:         errno = Q.err;
+	.loc 1 144 14 view .LVU271
+	movl	%r12d, (%rax)	# _13, *_14
+	.loc 1 145 9 is_stmt 1 view .LVU272
+.LVL77:
+.L53:
+	.loc 1 148 5 view .LVU273
+	movq	%r14, %rdi	# tmp176,
+	leaq	48(%rsp), %r12	#, _115
+	call	pthread_cond_destroy@PLT	#
+.LVL78:
+	.loc 1 149 5 view .LVU274
+	movq	%r13, %rdi	# tmp175,
+	call	pthread_mutex_destroy@PLT	#
+.LVL79:
+	.loc 1 150 5 view .LVU275
+	.loc 1 150 19 view .LVU276
+.L62:
+	.loc 1 151 9 discriminator 3 view .LVU277
+	movq	40(%rbp), %rdi	# MEM[(unsigned char * *)_113 + 40B], MEM[(unsigned char * *)_113 + 40B]
+# blake2s-pipe.c:150:     for (i = 0; i < B2S_PIPE_SLOTS; i++)
+	.loc 1 150 19 is_stmt 0 discriminator 3 view .LVU278
+	addq	$8, %rbp	#, ivtmp.50
+.LVL80:
+# blake2s-pipe.c:151:         free(Q.buf[i]);
+	.loc 1 151 9 discriminator 3 view .LVU279
+	call	free@PLT	#
+.LVL81:
+	.loc 1 150 25 is_stmt 1 discriminator 3 view .LVU280
+	.loc 1 150 19 discriminator 3 view .LVU281
+	cmpq	%r12, %rbp	# _115, ivtmp.50
+	jne	.L62	#,
+	jmp	.L46	#
+	.cfi_endproc
+.LFE26:
+	.size	blake2s_pipe_run, .-blake2s_pipe_run
+	.p2align 4
+	.globl	blake2s_file_pipelined
+	.type	blake2s_file_pipelined, @function
+blake2s_file_pipelined:
+.LVL82:
+.LFB27:
+	.loc 1 156 1 view -0
+	.cfi_startproc
+	.loc 1 157 5 view .LVU283
+# blake2s-pipe.c:156: {
+	.loc 1 156 1 is_stmt 0 view .LVU284
+	subq	$24, %rsp	#,
+	.cfi_def_cfa_offset 32
+# blake2s-pipe.c:157:     struct blake2s_io io = { BLAKE2S_IO_PIPE, 0, 0 };
+	.loc 1 157 23 view .LVU285
+	movq	.LC0(%rip), %rax	#, tmp85
+	movq	$0, 8(%rsp)	#, io.chunk
+	.loc 1 158 5 is_stmt 1 view .LVU286
+# blake2s-pipe.c:158:     return blake2s_file_ex(out, stream, &io);
+	.loc 1 158 12 is_stmt 0 view .LVU287
+	movq	%rsp, %rdx	#, tmp86
+# blake2s-pipe.c:157:     struct blake2s_io io = { BLAKE2S_IO_PIPE, 0, 0 };
+	.loc 1 157 23 view .LVU288
+	movq	%rax, (%rsp)	# tmp85, MEM <vector(2) unsigned int> [(unsigned int *)&io]
+# blake2s-pipe.c:158:     return blake2s_file_ex(out, stream, &io);
+	.loc 1 158 12 view .LVU289
+	call	blake2s_file_ex@PLT	#
+.LVL83:
+# blake2s-pipe.c:159: }
+	.loc 1 159 1 view .LVU290
+	addq	$24, %rsp	#,
+	.cfi_def_cfa_offset 8
+	ret	
+	.cfi_endproc
+.LFE27:
+	.size	blake2s_file_pipelined, .-blake2s_file_pipelined
+	.section	.rodata.cst8,"aM",@progbits,8
+	.align 8
+.LC0:
+	.long	1
+	.long	0
+	.text
+.Letext0:
+	.file 2 "/usr/include/x86_64-linux-gnu/bits/types.h"
+	.file 3 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stddef.h"
+	.file 4 "/usr/include/x86_64-linux-gnu/bits/atomic_wide_counter.h"
+	.file 5 "/usr/include/x86_64-linux-gnu/bits/thread-shared-types.h"
+	.file 6 "/usr/include/x86_64-linux-gnu/bits/struct_mutex.h"
+	.file 7 "/usr/include/x86_64-linux-gnu/bits/pthreadtypes.h"
+	.file 8 "/usr/include/x86_64-linux-gnu/sys/types.h"
+	.file 9 "/usr/include/x86_64-linux-gnu/bits/stdint-uintn.h"
+	.file 10 "/usr/include/x86_64-linux-gnu/bits/types/struct_FILE.h"
+	.file 11 "/usr/include/x86_64-linux-gnu/bits/types/FILE.h"
+	.file 12 "blake2s.h"
+	.file 13 "blake2s-internal.h"
+	.file 14 "/usr/include/pthread.h"
+	.file 15 "/usr/include/stdio.h"
+	.file 16 "/usr/include/stdlib.h"
+	.file 17 "/usr/include/errno.h"
+	.section	.debug_info,"",@progbits
+.Ldebug_info0:
+	.long	0x1223
+	.value	0x5
+	.byte	0x1
+	.byte	0x8
+	.long	.Ldebug_abbrev0
+	.uleb128 0x25
+	.long	.LASF131
+	.byte	0xc
+	.long	.LASF0
+	.long	.LASF1
+	.quad	.Ltext0
+	.quad	.Letext0-.Ltext0
+	.long	.Ldebug_line0
+	.uleb128 0xc
+	.byte	0x1
+	.byte	0x8
+	.long	.LASF2
+	.uleb128 0xc
+	.byte	0x2
+	.byte	0x7
+	.long	.LASF3
+	.uleb128 0xc
+	.byte	0x4
+	.byte	0x7
+	.long	.LASF4
+	.uleb128 0xc
+	.byte	0x8
+	.byte	0x7
+	.long	.LASF5
+	.uleb128 0xc
+	.byte	0x1
+	.byte	0x6
+	.long	.LASF6
+	.uleb128 0x5
+	.long	.LASF8
+	.byte	0x2
+	.byte	0x26
+	.byte	0x17
+	.long	0x2e
+	.uleb128 0xc
+	.byte	0x2
+	.byte	0x5
+	.long	.LASF7
+	.uleb128 0x26
+	.byte	0x4
+	.byte	0x5
+	.string	"int"
+	.uleb128 0x5
+	.long	.LASF9
+	.byte	0x2
+	.byte	0x2a
+	.byte	0x16
+	.long	0x3c
+	.uleb128 0xc
+	.byte	0x8
+	.byte	0x5
+	.long	.LASF10
+	.uleb128 0x5
+	.long	.LASF11
+	.byte	0x2
+	.byte	0x2d
+	.byte	0x1b
+	.long	0x43
+	.uleb128 0x5
+	.long	.LASF12
+	.byte	0x2
+	.byte	0x98
+	.byte	0x12
+	.long	0x77
+	.uleb128 0x5
+	.long	.LASF13
+	.byte	0x2
+	.byte	0x99
+	.byte	0x12
+	.long	0x77
+	.uleb128 0x27
+	.byte	0x8
+	.uleb128 0x11
+	.long	0xa2
+	.uleb128 0x5
+	.long	.LASF14
+	.byte	0x2
+	.byte	0xc2
+	.byte	0x12
+	.long	0x77
+	.uleb128 0x4
+	.long	0xba
+	.uleb128 0xc
+	.byte	0x1
+	.byte	0x6
+	.long	.LASF15
+	.uleb128 0x5
+	.long	.LASF16
+	.byte	0x3
+	.byte	0xd6
+	.byte	0x1b
+	.long	0x43
+	.uleb128 0x28
+	.byte	0x8
+	.byte	0x4
+	.byte	0x1c
+	.byte	0x3
+	.long	0xf1
+	.uleb128 0x1
+	.long	.LASF17
+	.byte	0x4
+	.byte	0x1e
+	.byte	0x12
+	.long	0x3c
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF18
+	.byte	0x4
+	.byte	0x1f
+	.byte	0x12
+	.long	0x3c
+	.byte	0x4
+	.byte	0
+	.uleb128 0x15
+	.byte	0x8
+	.byte	0x4
+	.byte	0x19
+	.long	0x112
+	.uleb128 0x8
+	.long	.LASF19
+	.byte	0x4
+	.byte	0x1b
+	.byte	0x28
+	.long	0x112
+	.uleb128 0x8
+	.long	.LASF20
+	.byte	0x4
+	.byte	0x20
+	.byte	0x5
+	.long	0xcd
+	.byte	0
+	.uleb128 0xc
+	.byte	0x8
+	.byte	0x7
+	.long	.LASF21
+	.uleb128 0x5
+	.long	.LASF22
+	.byte	0x4
+	.byte	0x21
+	.byte	0x3
+	.long	0xf1
+	.uleb128 0x13
+	.long	.LASF26
+	.byte	0x10
+	.byte	0x5
+	.byte	0x33
+	.byte	0x10
+	.long	0x14d
+	.uleb128 0x1
+	.long	.LASF23
+	.byte	0x5
+	.byte	0x35
+	.byte	0x23
+	.long	0x14d
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF24
+	.byte	0x5
+	.byte	0x36
+	.byte	0x23
+	.long	0x14d
+	.byte	0x8
+	.byte	0
+	.uleb128 0x4
+	.long	0x125
+	.uleb128 0x5
+	.long	.LASF25
+	.byte	0x5
+	.byte	0x37
+	.byte	0x3
+	.long	0x125
+	.uleb128 0x13
+	.long	.LASF27
+	.byte	0x28
+	.byte	0x6
+	.byte	0x16
+	.byte	0x8
+	.long	0x1d4
+	.uleb128 0x1
+	.long	.LASF28
+	.byte	0x6
+	.byte	0x18
+	.byte	0x7
+	.long	0x64
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF29
+	.byte	0x6
+	.byte	0x19
+	.byte	0x10
+	.long	0x3c
+	.byte	0x4
+	.uleb128 0x1
+	.long	.LASF30
+	.byte	0x6
+	.byte	0x1a
+	.byte	0x7
+	.long	0x64
+	.byte	0x8
+	.uleb128 0x1
+	.long	.LASF31
+	.byte	0x6
+	.byte	0x1c
+	.byte	0x10
+	.long	0x3c
+	.byte	0xc
+	.uleb128 0x1
+	.long	.LASF32
+	.byte	0x6
+	.byte	0x20
+	.byte	0x7
+	.long	0x64
+	.byte	0x10
+	.uleb128 0x1
+	.long	.LASF33
+	.byte	0x6
+	.byte	0x22
+	.byte	0x9
+	.long	0x5d
+	.byte	0x14
+	.uleb128 0x1
+	.long	.LASF34
+	.byte	0x6
+	.byte	0x23
+	.byte	0x9
+	.long	0x5d
+	.byte	0x16
+	.uleb128 0x1
+	.long	.LASF35
+	.byte	0x6
+	.byte	0x24
+	.byte	0x14
+	.long	0x152
+	.byte	0x18
+	.byte	0
+	.uleb128 0x13
+	.long	.LASF36
+	.byte	0x30
+	.byte	0x5
+	.byte	0x5e
+	.byte	0x8
+	.long	0x23d
+	.uleb128 0x1
+	.long	.LASF37
+	.byte	0x5
+	.byte	0x60
+	.byte	0x19
+	.long	0x119
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF38
+	.byte	0x5
+	.byte	0x61
+	.byte	0x19
+	.long	0x119
+	.byte	0x8
+	.uleb128 0x1
+	.long	.LASF39
+	.byte	0x5
+	.byte	0x62
+	.byte	0x10
+	.long	0x23d
+	.byte	0x10
+	.uleb128 0x1
+	.long	.LASF40
+	.byte	0x5
+	.byte	0x63
+	.byte	0x10
+	.long	0x23d
+	.byte	0x18
+	.uleb128 0x1
+	.long	.LASF41
+	.byte	0x5
+	.byte	0x64
+	.byte	0x10
+	.long	0x3c
+	.byte	0x20
+	.uleb128 0x1
+	.long	.LASF42
+	.byte	0x5
+	.byte	0x65
+	.byte	0x10
+	.long	0x3c
+	.byte	0x24
+	.uleb128 0x1
+	.long	.LASF43
+	.byte	0x5
+	.byte	0x66
+	.byte	0x10
+	.long	0x23d
+	.byte	0x28
+	.byte	0
+	.uleb128 0x9
+	.long	0x3c
+	.long	0x24d
+	.uleb128 0x7
+	.long	0x43
+	.byte	0x1
+	.byte	0
+	.uleb128 0x5
+	.long	.LASF44
+	.byte	0x7
+	.byte	0x1b
+	.byte	0x1b
+	.long	0x43
+	.uleb128 0x15
+	.byte	0x4
+	.byte	0x7
+	.byte	0x20
+	.long	0x27a
+	.uleb128 0x8
+	.long	.LASF45
+	.byte	0x7
+	.byte	0x22
+	.byte	0x8
+	.long	0x27a
+	.uleb128 0x8
+	.long	.LASF46
+	.byte	0x7
+	.byte	0x23
+	.byte	0x7
+	.long	0x64
+	.byte	0
+	.uleb128 0x9
+	.long	0xba
+	.long	0x28a
+	.uleb128 0x7
+	.long	0x43
+	.byte	0x3
+	.byte	0
+	.uleb128 0x5
+	.long	.LASF47
+	.byte	0x7
+	.byte	0x24
+	.byte	0x3
+	.long	0x259
+	.uleb128 0xf
+	.long	0x28a
+	.uleb128 0x15
+	.byte	0x4
+	.byte	0x7
+	.byte	0x29
+	.long	0x2bc
+	.uleb128 0x8
+	.long	.LASF45
+	.byte	0x7
+	.byte	0x2b
+	.byte	0x8
+	.long	0x27a
+	.uleb128 0x8
+	.long	.LASF46
+	.byte	0x7
+	.byte	0x2c
+	.byte	0x7
+	.long	0x64
+	.byte	0
+	.uleb128 0x5
+	.long	.LASF48
+	.byte	0x7
+	.byte	0x2d
+	.byte	0x3
+	.long	0x29b
+	.uleb128 0xf
+	.long	0x2bc
+	.uleb128 0x29
+	.long	.LASF49
+	.byte	0x38
+	.byte	0x7
+	.byte	0x38
+	.byte	0x7
+	.long	0x2f3
+	.uleb128 0x8
+	.long	.LASF45
+	.byte	0x7
+	.byte	0x3a
+	.byte	0x8
+	.long	0x2f3
+	.uleb128 0x8
+	.long	.LASF46
+	.byte	0x7
+	.byte	0x3b
+	.byte	0xc
+	.long	0x77
+	.byte	0
+	.uleb128 0x9
+	.long	0xba
+	.long	0x303
+	.uleb128 0x7
+	.long	0x43
+	.byte	0x37
+	.byte	0
+	.uleb128 0x5
+	.long	.LASF49
+	.byte	0x7
+	.byte	0x3e
+	.byte	0x1e
+	.long	0x2cd
+	.uleb128 0xf
+	.long	0x303
+	.uleb128 0x15
+	.byte	0x28
+	.byte	0x7
+	.byte	0x43
+	.long	0x341
+	.uleb128 0x8
+	.long	.LASF50
+	.byte	0x7
+	.byte	0x45
+	.byte	0x1c
+	.long	0x15e
+	.uleb128 0x8
+	.long	.LASF45
+	.byte	0x7
+	.byte	0x46
+	.byte	0x8
+	.long	0x341
+	.uleb128 0x8
+	.long	.LASF46
+	.byte	0x7
+	.byte	0x47
+	.byte	0xc
+	.long	0x77
+	.byte	0
+	.uleb128 0x9
+	.long	0xba
+	.long	0x351
+	.uleb128 0x7
+	.long	0x43
+	.byte	0x27
+	.byte	0
+	.uleb128 0x5
+	.long	.LASF51
+	.byte	0x7
+	.byte	0x48
+	.byte	0x3
+	.long	0x314
+	.uleb128 0x15
+	.byte	0x30
+	.byte	0x7
+	.byte	0x4b
+	.long	0x38a
+	.uleb128 0x8
+	.long	.LASF50
+	.byte	0x7
+	.byte	0x4d
+	.byte	0x1b
+	.long	0x1d4
+	.uleb128 0x8
+	.long	.LASF45
+	.byte	0x7
+	.byte	0x4e
+	.byte	0x8
+	.long	0x38a
+	.uleb128 0x8
+	.long	.LASF46
+	.byte	0x7
+	.byte	0x4f
+	.byte	0x1f
+	.long	0x39a
+	.byte	0
+	.uleb128 0x9
+	.long	0xba
+	.long	0x39a
+	.uleb128 0x7
+	.long	0x43
+	.byte	0x2f
+	.byte	0
+	.uleb128 0xc
+	.byte	0x8
+	.byte	0x5
+	.long	.LASF52
+	.uleb128 0x5
+	.long	.LASF53
+	.byte	0x7
+	.byte	0x50
+	.byte	0x3
+	.long	0x35d
+	.uleb128 0x5
+	.long	.LASF54
+	.byte	0x8
+	.byte	0x6c
+	.byte	0x13
+	.long	0xa9
+	.uleb128 0x4
+	.long	0x3be
+	.uleb128 0x2a
+	.uleb128 0x5
+	.long	.LASF55
+	.byte	0x9
+	.byte	0x18
+	.byte	0x13
+	.long	0x51
+	.uleb128 0x5
+	.long	.LASF56
+	.byte	0x9
+	.byte	0x1a
+	.byte	0x14
+	.long	0x6b
+	.uleb128 0x5
+	.long	.LASF57
+	.byte	0x9
+	.byte	0x1b
+	.byte	0x14
+	.long	0x7e
+	.uleb128 0x13
+	.long	.LASF58
+	.byte	0xd8
+	.byte	0xa
+	.byte	0x31
+	.byte	0x8
+	.long	0x56a
+	.uleb128 0x1
+	.long	.LASF59
+	.byte	0xa
+	.byte	0x33
+	.byte	0x7
+	.long	0x64
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF60
+	.byte	0xa
+	.byte	0x36
+	.byte	0x9
+	.long	0xb5
+	.byte	0x8
+	.uleb128 0x1
+	.long	.LASF61
+	.byte	0xa
+	.byte	0x37
+	.byte	0x9
+	.long	0xb5
+	.byte	0x10
+	.uleb128 0x1
+	.long	.LASF62
+	.byte	0xa
+	.byte	0x38
+	.byte	0x9
+	.long	0xb5
+	.byte	0x18
+	.uleb128 0x1
+	.long	.LASF63
+	.byte	0xa
+	.byte	0x39
+	.byte	0x9
+	.long	0xb5
+	.byte	0x20
+	.uleb128 0x1
+	.long	.LASF64
+	.byte	0xa
+	.byte	0x3a
+	.byte	0x9
+	.long	0xb5
+	.byte	0x28
+	.uleb128 0x1
+	.long	.LASF65
+	.byte	0xa
+	.byte	0x3b
+	.byte	0x9
+	.long	0xb5
+	.byte	0x30
+	.uleb128 0x1
+	.long	.LASF66
+	.byte	0xa
+	.byte	0x3c
+	.byte	0x9
+	.long	0xb5
+	.byte	0x38
+	.uleb128 0x1
+	.long	.LASF67
+	.byte	0xa
+	.byte	0x3d
+	.byte	0x9
+	.long	0xb5
+	.byte	0x40
+	.uleb128 0x1
+	.long	.LASF68
+	.byte	0xa
+	.byte	0x40
+	.byte	0x9
+	.long	0xb5
+	.byte	0x48
+	.uleb128 0x1
+	.long	.LASF69
+	.byte	0xa
+	.byte	0x41
+	.byte	0x9
+	.long	0xb5
+	.byte	0x50
+	.uleb128 0x1
+	.long	.LASF70
+	.byte	0xa
+	.byte	0x42
+	.byte	0x9
+	.long	0xb5
+	.byte	0x58
+	.uleb128 0x1
+	.long	.LASF71
+	.byte	0xa
+	.byte	0x44
+	.byte	0x16
+	.long	0x583
+	.byte	0x60
+	.uleb128 0x1
+	.long	.LASF72
+	.byte	0xa
+	.byte	0x46
+	.byte	0x14
+	.long	0x588
+	.byte	0x68
+	.uleb128 0x1
+	.long	.LASF73
+	.byte	0xa
+	.byte	0x48
+	.byte	0x7
+	.long	0x64
+	.byte	0x70
+	.uleb128 0x1
+	.long	.LASF74
+	.byte	0xa
+	.byte	0x49
+	.byte	0x7
+	.long	0x64
+	.byte	0x74
+	.uleb128 0x1
+	.long	.LASF75
+	.byte	0xa
+	.byte	0x4a
+	.byte	0xb
+	.long	0x8a
+	.byte	0x78
+	.uleb128 0x1
+	.long	.LASF76
+	.byte	0xa
+	.byte	0x4d
+	.byte	0x12
+	.long	0x35
+	.byte	0x80
+	.uleb128 0x1
+	.long	.LASF77
+	.byte	0xa
+	.byte	0x4e
+	.byte	0xf
+	.long	0x4a
+	.byte	0x82
+	.uleb128 0x1
+	.long	.LASF78
+	.byte	0xa
+	.byte	0x4f
+	.byte	0x8
+	.long	0x58d
+	.byte	0x83
+	.uleb128 0x1
+	.long	.LASF79
+	.byte	0xa
+	.byte	0x51
+	.byte	0xf
+	.long	0x59d
+	.byte	0x88
+	.uleb128 0x1
+	.long	.LASF80
+	.byte	0xa
+	.byte	0x59
+	.byte	0xd
+	.long	0x96
+	.byte	0x90
+	.uleb128 0x1
+	.long	.LASF81
+	.byte	0xa
+	.byte	0x5b
+	.byte	0x17
+	.long	0x5a7
+	.byte	0x98
+	.uleb128 0x1
+	.long	.LASF82
+	.byte	0xa
+	.byte	0x5c
+	.byte	0x19
+	.long	0x5b1
+	.byte	0xa0
+	.uleb128 0x1
+	.long	.LASF83
+	.byte	0xa
+	.byte	0x5d
+	.byte	0x14
+	.long	0x588
+	.byte	0xa8
+	.uleb128 0x1
+	.long	.LASF84
+	.byte	0xa
+	.byte	0x5e
+	.byte	0x9
+	.long	0xa2
+	.byte	0xb0
+	.uleb128 0x1
+	.long	.LASF85
+	.byte	0xa
+	.byte	0x5f
+	.byte	0xa
+	.long	0xc1
+	.byte	0xb8
+	.uleb128 0x1
+	.long	.LASF86
+	.byte	0xa
+	.byte	0x60
+	.byte	0x7
+	.long	0x64
+	.byte	0xc0
+	.uleb128 0x1
+	.long	.LASF87
+	.byte	0xa
+	.byte	0x62
+	.byte	0x8
+	.long	0x5b6
+	.byte	0xc4
+	.byte	0
+	.uleb128 0x5
+	.long	.LASF88
+	.byte	0xb
+	.byte	0x7
+	.byte	0x19
+	.long	0x3e3
+	.uleb128 0x2b
+	.long	.LASF132
+	.byte	0xa
+	.byte	0x2b
+	.byte	0xe
+	.uleb128 0x1a
+	.long	.LASF89
+	.uleb128 0x4
+	.long	0x57e
+	.uleb128 0x4
+	.long	0x3e3
+	.uleb128 0x9
+	.long	0xba
+	.long	0x59d
+	.uleb128 0x7
+	.long	0x43
+	.byte	0
+	.byte	0
+	.uleb128 0x4
+	.long	0x576
+	.uleb128 0x1a
+	.long	.LASF90
+	.uleb128 0x4
+	.long	0x5a2
+	.uleb128 0x1a
+	.long	.LASF91
+	.uleb128 0x4
+	.long	0x5ac
+	.uleb128 0x9
+	.long	0xba
+	.long	0x5c6
+	.uleb128 0x7
+	.long	0x43
+	.byte	0x13
+	.byte	0
+	.uleb128 0x4
+	.long	0x56a
+	.uleb128 0x11
+	.long	0x5c6
+	.uleb128 0x13
+	.long	.LASF92
+	.byte	0x10
+	.byte	0xc
+	.byte	0xa8
+	.byte	0x8
+	.long	0x605
+	.uleb128 0x1
+	.long	.LASF93
+	.byte	0xc
+	.byte	0xa9
+	.byte	0xe
+	.long	0x3c
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF94
+	.byte	0xc
+	.byte	0xaa
+	.byte	0xe
+	.long	0x3c
+	.byte	0x4
+	.uleb128 0x1
+	.long	.LASF95
+	.byte	0xc
+	.byte	0xab
+	.byte	0xc
+	.long	0xc1
+	.byte	0x8
+	.byte	0
+	.uleb128 0xf
+	.long	0x5d0
+	.uleb128 0x2c
+	.long	.LASF133
+	.byte	0x80
+	.byte	0x10
+	.byte	0xc
+	.byte	0xf7
+	.byte	0x8
+	.long	0x66e
+	.uleb128 0xe
+	.string	"H"
+	.byte	0xc
+	.byte	0xf8
+	.byte	0xe
+	.long	0x66e
+	.byte	0
+	.uleb128 0xe
+	.string	"buf"
+	.byte	0xc
+	.byte	0xf9
+	.byte	0x13
+	.long	0x67e
+	.byte	0x20
+	.uleb128 0xe
+	.string	"t"
+	.byte	0xc
+	.byte	0xfa
+	.byte	0xe
+	.long	0x68e
+	.byte	0x60
+	.uleb128 0xe
+	.string	"f"
+	.byte	0xc
+	.byte	0xfb
+	.byte	0xe
+	.long	0x68e
+	.byte	0x68
+	.uleb128 0x1
+	.long	.LASF96
+	.byte	0xc
+	.byte	0xfc
+	.byte	0xe
+	.long	0x3c
+	.byte	0x70
+	.uleb128 0x1
+	.long	.LASF97
+	.byte	0xc
+	.byte	0xfd
+	.byte	0xe
+	.long	0x3c
+	.byte	0x74
+	.uleb128 0x1
+	.long	.LASF98
+	.byte	0xc
+	.byte	0xfe
+	.byte	0xe
+	.long	0x3c
+	.byte	0x78
+	.byte	0
+	.uleb128 0x9
+	.long	0x3cb
+	.long	0x67e
+	.uleb128 0x7
+	.long	0x43
+	.byte	0x7
+	.byte	0
+	.uleb128 0x9
+	.long	0x2e
+	.long	0x68e
+	.uleb128 0x7
+	.long	0x43
+	.byte	0x3f
+	.byte	0
+	.uleb128 0x9
+	.long	0x3cb
+	.long	0x69e
+	.uleb128 0x7
+	.long	0x43
+	.byte	0x1
+	.byte	0
+	.uleb128 0x4
+	.long	0x60a
+	.uleb128 0x4
+	.long	0x2e
+	.uleb128 0x1c
+	.string	"u8"
+	.byte	0x7
+	.byte	0x11
+	.long	0x3bf
+	.uleb128 0xf
+	.long	0x6a8
+	.uleb128 0x1c
+	.string	"u32"
+	.byte	0x8
+	.byte	0x12
+	.long	0x3cb
+	.uleb128 0xf
+	.long	0x6b7
+	.uleb128 0x9
+	.long	0x6c2
+	.long	0x6d7
+	.uleb128 0x7
+	.long	0x43
+	.byte	0x7
+	.byte	0
+	.uleb128 0xf
+	.long	0x6c7
+	.uleb128 0x1d
+	.long	.LASF99
+	.byte	0xa
+	.byte	0x12
+	.long	0x6d7
+	.byte	0x20
+	.byte	0x67
+	.byte	0xe6
+	.byte	0x9
+	.byte	0x6a
+	.byte	0x85
+	.byte	0xae
+	.byte	0x67
+	.byte	0xbb
+	.byte	0x72
+	.byte	0xf3
+	.byte	0x6e
+	.byte	0x3c
+	.byte	0x3a
+	.byte	0xf5
+	.byte	0x4f
+	.byte	0xa5
+	.byte	0x7f
+	.byte	0x52
+	.byte	0xe
+	.byte	0x51
+	.byte	0x8c
+	.byte	0x68
+	.byte	0x5
+	.byte	0x9b
+	.byte	0xab
+	.byte	0xd9
+	.byte	0x83
+	.byte	0x1f
+	.byte	0x19
+	.byte	0xcd
+	.byte	0xe0
+	.byte	0x5b
+	.uleb128 0x9
+	.long	0x6b2
+	.long	0x71e
+	.uleb128 0x7
+	.long	0x43
+	.byte	0x9
+	.uleb128 0x7
+	.long	0x43
+	.byte	0xf
+	.byte	0
+	.uleb128 0xf
+	.long	0x708
+	.uleb128 0x1d
+	.long	.LASF100
+	.byte	0xf
+	.byte	0x11
+	.long	0x71e
+	.byte	0xa0
+	.byte	0
+	.byte	0x1
+	.byte	0x2
+	.byte	0x3
+	.byte	0x4
+	.byte	0x5
+	.byte	0x6
+	.byte	0x7
+	.byte	0x8
+	.byte	0x9
+	.byte	0xa
+	.byte	0xb
+	.byte	0xc
+	.byte	0xd
+	.byte	0xe
+	.byte	0xf
+	.byte	0xe
+	.byte	0xa
+	.byte	0x4
+	.byte	0x8
+	.byte	0x9
+	.byte	0xf
+	.byte	0xd
+	.byte	0x6
+	.byte	0x1
+	.byte	0xc
+	.byte	0
+	.byte	0x2
+	.byte	0xb
+	.byte	0x7
+	.byte	0x5
+	.byte	0x3
+	.byte	0xb
+	.byte	0x8
+	.byte	0xc
+	.byte	0
+	.byte	0x5
+	.byte	0x2
+	.byte	0xf
+	.byte	0xd
+	.byte	0xa
+	.byte	0xe
+	.byte	0x3
+	.byte	0x6
+	.byte	0x7
+	.byte	0x1
+	.byte	0x9
+	.byte	0x4
+	.byte	0x7
+	.byte	0x9
+	.byte	0x3
+	.byte	0x1
+	.byte	0xd
+	.byte	0xc
+	.byte	0xb
+	.byte	0xe
+	.byte	0x2
+	.byte	0x6
+	.byte	0x5
+	.byte	0xa
+	.byte	0x4
+	.byte	0
+	.byte	0xf
+	.byte	0x8
+	.byte	0x9
+	.byte	0
+	.byte	0x5
+	.byte	0x7
+	.byte	0x2
+	.byte	0x4
+	.byte	0xa
+	.byte	0xf
+	.byte	0xe
+	.byte	0x1
+	.byte	0xb
+	.byte	0xc
+	.byte	0x6
+	.byte	0x8
+	.byte	0x3
+	.byte	0xd
+	.byte	0x2
+	.byte	0xc
+	.byte	0x6
+	.byte	0xa
+	.byte	0
+	.byte	0xb
+	.byte	0x8
+	.byte	0x3
+	.byte	0x4
+	.byte	0xd
+	.byte	0x7
+	.byte	0x5
+	.byte	0xf
+	.byte	0xe
+	.byte	0x1
+	.byte	0x9
+	.byte	0xc
+	.byte	0x5
+	.byte	0x1
+	.byte	0xf
+	.byte	0xe
+	.byte	0xd
+	.byte	0x4
+	.byte	0xa
+	.byte	0
+	.byte	0x7
+	.byte	0x6
+	.byte	0x3
+	.byte	0x9
+	.byte	0x2
+	.byte	0x8
+	.byte	0xb
+	.byte	0xd
+	.byte	0xb
+	.byte	0x7
+	.byte	0xe
+	.byte	0xc
+	.byte	0x1
+	.byte	0x3
+	.byte	0x9
+	.byte	0x5
+	.byte	0
+	.byte	0xf
+	.byte	0x4
+	.byte	0x8
+	.byte	0x6
+	.byte	0x2
+	.byte	0xa
+	.byte	0x6
+	.byte	0xf
+	.byte	0xe
+	.byte	0x9
+	.byte	0xb
+	.byte	0x3
+	.byte	0
+	.byte	0x8
+	.byte	0xc
+	.byte	0x2
+	.byte	0xd
+	.byte	0x7
+	.byte	0x1
+	.byte	0x4
+	.byte	0xa
+	.byte	0x5
+	.byte	0xa
+	.byte	0x2
+	.byte	0x8
+	.byte	0x4
+	.byte	0x7
+	.byte	0x6
+	.byte	0x1
+	.byte	0x5
+	.byte	0xf
+	.byte	0xb
+	.byte	0x9
+	.byte	0xe
+	.byte	0x3
+	.byte	0xc
+	.byte	0xd
+	.byte	0
+	.uleb128 0x13
+	.long	.LASF101
+	.byte	0xd8
+	.byte	0x1
+	.byte	0x18
+	.byte	0x8
+	.long	0x892
+	.uleb128 0x1
+	.long	.LASF102
+	.byte	0x1
+	.byte	0x19
+	.byte	0xb
+	.long	0x5c6
+	.byte	0
+	.uleb128 0xe
+	.string	"fd"
+	.byte	0x1
+	.byte	0x1a
+	.byte	0x9
+	.long	0x64
+	.byte	0x8
+	.uleb128 0x1
+	.long	.LASF103
+	.byte	0x1
+	.byte	0x1b
+	.byte	0x9
+	.long	0x64
+	.byte	0xc
+	.uleb128 0xe
+	.string	"off"
+	.byte	0x1
+	.byte	0x1c
+	.byte	0xe
+	.long	0x3d7
+	.byte	0x10
+	.uleb128 0x1
+	.long	.LASF104
+	.byte	0x1
+	.byte	0x1c
+	.byte	0x13
+	.long	0x3d7
+	.byte	0x18
+	.uleb128 0x1
+	.long	.LASF95
+	.byte	0x1
+	.byte	0x1d
+	.byte	0xc
+	.long	0xc1
+	.byte	0x20
+	.uleb128 0xe
+	.string	"buf"
+	.byte	0x1
+	.byte	0x1e
+	.byte	0x14
+	.long	0x892
+	.byte	0x28
+	.uleb128 0xe
+	.string	"len"
+	.byte	0x1
+	.byte	0x1f
+	.byte	0xc
+	.long	0x8a2
+	.byte	0x48
+	.uleb128 0x1
+	.long	.LASF105
+	.byte	0x1
+	.byte	0x20
+	.byte	0x13
+	.long	0x43
+	.byte	0x68
+	.uleb128 0x1
+	.long	.LASF106
+	.byte	0x1
+	.byte	0x21
+	.byte	0x13
+	.long	0x43
+	.byte	0x70
+	.uleb128 0xe
+	.string	"err"
+	.byte	0x1
+	.byte	0x22
+	.byte	0x9
+	.long	0x64
+	.byte	0x78
+	.uleb128 0x1
+	.long	.LASF107
+	.byte	0x1
+	.byte	0x23
+	.byte	0x9
+	.long	0x64
+	.byte	0x7c
+	.uleb128 0x1
+	.long	.LASF108
+	.byte	0x1
+	.byte	0x24
+	.byte	0x15
+	.long	0x351
+	.byte	0x80
+	.uleb128 0x1
+	.long	.LASF109
+	.byte	0x1
+	.byte	0x25
+	.byte	0x14
+	.long	0x3a1
+	.byte	0xa8
+	.byte	0
+	.uleb128 0x9
+	.long	0x6a3
+	.long	0x8a2
+	.uleb128 0x7
+	.long	0x43
+	.byte	0x3
+	.byte	0
+	.uleb128 0x9
+	.long	0xc1
+	.long	0x8b2
+	.uleb128 0x7
+	.long	0x43
+	.byte	0x3
+	.byte	0
+	.uleb128 0x19
+	.long	.LASF110
+	.byte	0xc
+	.byte	0xb3
+	.byte	0x6
+	.long	0x64
+	.long	0x8d2
+	.uleb128 0x2
+	.long	0x6a3
+	.uleb128 0x2
+	.long	0x5c6
+	.uleb128 0x2
+	.long	0x8d2
+	.byte	0
+	.uleb128 0x4
+	.long	0x605
+	.uleb128 0xb
+	.long	.LASF111
+	.byte	0xe
+	.value	0x465
+	.byte	0xc
+	.long	0x64
+	.long	0x8ee
+	.uleb128 0x2
+	.long	0x8ee
+	.byte	0
+	.uleb128 0x4
+	.long	0x3a1
+	.uleb128 0x11
+	.long	0x8ee
+	.uleb128 0xb
+	.long	.LASF112
+	.byte	0xe
+	.value	0x343
+	.byte	0xc
+	.long	0x64
+	.long	0x90f
+	.uleb128 0x2
+	.long	0x90f
+	.byte	0
+	.uleb128 0x4
+	.long	0x351
+	.uleb128 0x11
+	.long	0x90f
+	.uleb128 0xb
+	.long	.LASF113
+	.byte	0xe
+	.value	0x46d
+	.byte	0xc
+	.long	0x64
+	.long	0x935
+	.uleb128 0x2
+	.long	0x8f3
+	.uleb128 0x2
+	.long	0x914
+	.byte	0
+	.uleb128 0xb
+	.long	.LASF114
+	.byte	0xe
+	.value	0x31a
+	.byte	0xc
+	.long	0x64
+	.long	0x94c
+	.uleb128 0x2
+	.long	0x90f
+	.byte	0
+	.uleb128 0x19
+	.long	.LASF115
+	.byte	0xd
+	.byte	0xae
+	.byte	0x9
+	.long	0x3ad
+	.long	0x971
+	.uleb128 0x2
+	.long	0x64
+	.uleb128 0x2
+	.long	0xa2
+	.uleb128 0x2
+	.long	0xc1
+	.uleb128 0x2
+	.long	0x3d7
+	.byte	0
+	.uleb128 0xb
+	.long	.LASF116
+	.byte	0xf
+	.value	0x316
+	.byte	0xc
+	.long	0x64
+	.long	0x988
+	.uleb128 0x2
+	.long	0x5c6
+	.byte	0
+	.uleb128 0xb
+	.long	.LASF117
+	.byte	0xf
+	.value	0x2a3
+	.byte	0xf
+	.long	0xc1
+	.long	0x9ae
+	.uleb128 0x2
+	.long	0xa4
+	.uleb128 0x2
+	.long	0xc1
+	.uleb128 0x2
+	.long	0xc1
+	.uleb128 0x2
+	.long	0x5cb
+	.byte	0
+	.uleb128 0xb
+	.long	.LASF118
+	.byte	0xe
+	.value	0x312
+	.byte	0xc
+	.long	0x64
+	.long	0x9c5
+	.uleb128 0x2
+	.long	0x90f
+	.byte	0
+	.uleb128 0xb
+	.long	.LASF119
+	.byte	0xe
+	.value	0x45d
+	.byte	0xc
+	.long	0x64
+	.long	0x9dc
+	.uleb128 0x2
+	.long	0x8ee
+	.byte	0
+	.uleb128 0x19
+	.long	.LASF120
+	.byte	0xe
+	.byte	0xdb
+	.byte	0xc
+	.long	0x64
+	.long	0x9f7
+	.uleb128 0x2
+	.long	0x24d
+	.uleb128 0x2
+	.long	0x9f7
+	.byte	0
+	.uleb128 0x4
+	.long	0xa2
+	.uleb128 0x2d
+	.long	.LASF124
+	.byte	0xc
+	.byte	0x46
+	.byte	0x6
+	.long	0xa18
+	.uleb128 0x2
+	.long	0x69e
+	.uleb128 0x2
+	.long	0x3b9
+	.uleb128 0x2
+	.long	0xc1
+	.byte	0
+	.uleb128 0x19
+	.long	.LASF121
+	.byte	0xe
+	.byte	0xca
+	.byte	0xc
+	.long	0x64
+	.long	0xa3d
+	.uleb128 0x2
+	.long	0xa42
+	.uleb128 0x2
+	.long	0xa4c
+	.uleb128 0x2
+	.long	0xa51
+	.uleb128 0x2
+	.long	0xa4
+	.byte	0
+	.uleb128 0x4
+	.long	0x24d
+	.uleb128 0x11
+	.long	0xa3d
+	.uleb128 0x4
+	.long	0x30f
+	.uleb128 0x11
+	.long	0xa47
+	.uleb128 0x4
+	.long	0xa56
+	.uleb128 0x2e
+	.long	0xa2
+	.long	0xa65
+	.uleb128 0x2
+	.long	0xa2
+	.byte	0
+	.uleb128 0xb
+	.long	.LASF122
+	.byte	0xe
+	.value	0x458
+	.byte	0xc
+	.long	0x64
+	.long	0xa81
+	.uleb128 0x2
+	.long	0x8f3
+	.uleb128 0x2
+	.long	0xa86
+	.byte	0
+	.uleb128 0x4
+	.long	0x2c8
+	.uleb128 0x11
+	.long	0xa81
+	.uleb128 0xb
+	.long	.LASF123
+	.byte	0xe
+	.value	0x30d
+	.byte	0xc
+	.long	0x64
+	.long	0xaa7
+	.uleb128 0x2
+	.long	0x90f
+	.uleb128 0x2
+	.long	0xaa7
+	.byte	0
+	.uleb128 0x4
+	.long	0x296
+	.uleb128 0x2f
+	.long	.LASF134
+	.byte	0x11
+	.byte	0x25
+	.byte	0xd
+	.long	0xab8
+	.uleb128 0x4
+	.long	0x64
+	.uleb128 0x30
+	.long	.LASF125
+	.byte	0x10
+	.value	0x238
+	.byte	0xd
+	.long	0xad0
+	.uleb128 0x2
+	.long	0xa2
+	.byte	0
+	.uleb128 0xb
+	.long	.LASF126
+	.byte	0x10
+	.value	0x257
+	.byte	0xc
+	.long	0x64
+	.long	0xaf1
+	.uleb128 0x2
+	.long	0x9f7
+	.uleb128 0x2
+	.long	0xc1
+	.uleb128 0x2
+	.long	0xc1
+	.byte	0
+	.uleb128 0x1e
+	.long	.LASF127
+	.byte	0x9b
+	.long	0x64
+	.quad	.LFB27
+	.quad	.LFE27-.LFB27
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0xb67
+	.uleb128 0x16
+	.string	"out"
+	.byte	0x9b
+	.byte	0x2b
+	.long	0x6a3
+	.long	.LLST40
+	.long	.LVUS40
+	.uleb128 0x17
+	.long	.LASF102
+	.byte	0x9b
+	.byte	0x36
+	.long	0x5c6
+	.long	.LLST41
+	.long	.LVUS41
+	.uleb128 0x1f
+	.string	"io"
+	.byte	0x9d
+	.byte	0x17
+	.long	0x5d0
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -32
+	.uleb128 0x14
+	.quad	.LVL83
+	.long	0x8b2
+	.uleb128 0x3
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x3
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x3
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x3
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x3
+	.uleb128 0x1
+	.byte	0x51
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -32
+	.byte	0
+	.byte	0
+	.uleb128 0x1e
+	.long	.LASF128
+	.byte	0x64
+	.long	0x64
+	.quad	.LFB26
+	.quad	.LFE26-.LFB26
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0xf63
+	.uleb128 0x16
+	.string	"ctx"
+	.byte	0x64
+	.byte	0x2a
+	.long	0x69e
+	.long	.LLST18
+	.long	.LVUS18
+	.uleb128 0x17
+	.long	.LASF102
+	.byte	0x64
+	.byte	0x35
+	.long	0x5c6
+	.long	.LLST19
+	.long	.LVUS19
+	.uleb128 0x16
+	.string	"fd"
+	.byte	0x64
+	.byte	0x41
+	.long	0x64
+	.long	.LLST20
+	.long	.LVUS20
+	.uleb128 0x16
+	.string	"off"
+	.byte	0x65
+	.byte	0x1f
+	.long	0x3d7
+	.long	.LLST21
+	.long	.LVUS21
+	.uleb128 0x17
+	.long	.LASF104
+	.byte	0x65
+	.byte	0x2d
+	.long	0x3d7
+	.long	.LLST22
+	.long	.LVUS22
+	.uleb128 0x17
+	.long	.LASF95
+	.byte	0x65
+	.byte	0x3a
+	.long	0xc1
+	.long	.LLST23
+	.long	.LVUS23
+	.uleb128 0x17
+	.long	.LASF103
+	.byte	0x65
+	.byte	0x45
+	.long	0x64
+	.long	.LLST24
+	.long	.LVUS24
+	.uleb128 0x1f
+	.string	"Q"
+	.byte	0x67
+	.byte	0x12
+	.long	0x7cf
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -288
+	.uleb128 0x31
+	.long	.LASF129
+	.byte	0x1
+	.byte	0x68
+	.byte	0xf
+	.long	0x24d
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -296
+	.uleb128 0x12
+	.string	"i"
+	.byte	0x69
+	.byte	0xe
+	.long	0x3c
+	.long	.LLST25
+	.long	.LVUS25
+	.uleb128 0x12
+	.string	"ret"
+	.byte	0x6a
+	.byte	0x9
+	.long	0x64
+	.long	.LLST26
+	.long	.LVUS26
+	.uleb128 0x32
+	.long	.LASF135
+	.byte	0x1
+	.byte	0x93
+	.byte	0x1
+	.quad	.L53
+	.uleb128 0x20
+	.long	.LLRL27
+	.long	0xe57
+	.uleb128 0x21
+	.long	.LASF106
+	.byte	0x83
+	.long	0x43
+	.long	.LLST28
+	.long	.LVUS28
+	.uleb128 0x1b
+	.long	.LLRL29
+	.uleb128 0x12
+	.string	"s"
+	.byte	0x84
+	.byte	0x12
+	.long	0x3c
+	.long	.LLST30
+	.long	.LVUS30
+	.uleb128 0x33
+	.long	0x11c0
+	.quad	.LBI72
+	.byte	.LVU211
+	.quad	.LBB72
+	.quad	.LBE72-.LBB72
+	.byte	0x1
+	.byte	0x8b
+	.byte	0x9
+	.long	0xd65
+	.uleb128 0xa
+	.long	0x11e1
+	.long	.LLST31
+	.long	.LVUS31
+	.uleb128 0xa
+	.long	0x11d6
+	.long	.LLST32
+	.long	.LVUS32
+	.uleb128 0xa
+	.long	0x11cd
+	.long	.LLST33
+	.long	.LVUS33
+	.uleb128 0x22
+	.long	0x11c0
+	.quad	.LBI74
+	.byte	.LVU216
+	.quad	.LBB74
+	.quad	.LBE74-.LBB74
+	.byte	0x38
+	.uleb128 0xa
+	.long	0x11d6
+	.long	.LLST34
+	.long	.LVUS34
+	.uleb128 0xa
+	.long	0x11e1
+	.long	.LLST35
+	.long	.LVUS35
+	.uleb128 0xa
+	.long	0x11cd
+	.long	.LLST36
+	.long	.LVUS36
+	.uleb128 0x6
+	.quad	.LVL58
+	.long	0x935
+	.long	0xd37
+	.uleb128 0x3
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x7d
+	.sleb128 0
+	.byte	0
+	.uleb128 0x6
+	.quad	.LVL59
+	.long	0x8d7
+	.long	0xd4f
+	.uleb128 0x3
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x7e
+	.sleb128 0
+	.byte	0
+	.uleb128 0x14
+	.quad	.LVL60
+	.long	0x8f8
+	.uleb128 0x3
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x7d
+	.sleb128 0
+	.byte	0
+	.byte	0
+	.byte	0
+	.uleb128 0x34
+	.long	0x11f0
+	.quad	.LBB76
+	.quad	.LBE76-.LBB76
+	.byte	0x1
+	.byte	0x87
+	.byte	0xd
+	.long	0xe41
+	.uleb128 0xd
+	.long	0x120d
+	.uleb128 0xd
+	.long	0x1202
+	.uleb128 0xd
+	.long	0x11f9
+	.uleb128 0x35
+	.long	0x1219
+	.quad	.LBB77
+	.quad	.LBE77-.LBB77
+	.long	0xdaf
+	.uleb128 0x23
+	.long	0x121a
+	.byte	0
+	.uleb128 0x22
+	.long	0x11f0
+	.quad	.LBI78
+	.byte	.LVU241
+	.quad	.LBB78
+	.quad	.LBE78-.LBB78
+	.byte	0x29
+	.uleb128 0xa
+	.long	0x120d
+	.long	.LLST37
+	.long	.LVUS37
+	.uleb128 0xa
+	.long	0x1202
+	.long	.LLST38
+	.long	.LVUS38
+	.uleb128 0xa
+	.long	0x11f9
+	.long	.LLST39
+	.long	.LVUS39
+	.uleb128 0x6
+	.quad	.LVL69
+	.long	0x935
+	.long	0xe0d
+	.uleb128 0x3
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x7d
+	.sleb128 0
+	.byte	0
+	.uleb128 0x6
+	.quad	.LVL70
+	.long	0x919
+	.long	0xe2b
+	.uleb128 0x3
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x7e
+	.sleb128 0
+	.uleb128 0x3
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x2
+	.byte	0x7d
+	.sleb128 0
+	.byte	0
+	.uleb128 0x14
+	.quad	.LVL71
+	.long	0x8f8
+	.uleb128 0x3
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x7d
+	.sleb128 0
+	.byte	0
+	.byte	0
+	.byte	0
+	.uleb128 0x14
+	.quad	.LVL56
+	.long	0x9fc
+	.uleb128 0x3
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x7c
+	.sleb128 0
+	.byte	0
+	.byte	0
+	.byte	0
+	.uleb128 0x6
+	.quad	.LVL46
+	.long	0xad0
+	.long	0xe7c
+	.uleb128 0x3
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x7d
+	.sleb128 0
+	.uleb128 0x3
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x3
+	.byte	0xa
+	.value	0x1000
+	.uleb128 0x3
+	.uleb128 0x1
+	.byte	0x51
+	.uleb128 0x2
+	.byte	0x7e
+	.sleb128 0
+	.byte	0
+	.uleb128 0x6
+	.quad	.LVL50
+	.long	0xa8b
+	.long	0xe99
+	.uleb128 0x3
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x7d
+	.sleb128 0
+	.uleb128 0x3
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x1
+	.byte	0x30
+	.byte	0
+	.uleb128 0x6
+	.quad	.LVL51
+	.long	0xa65
+	.long	0xeb6
+	.uleb128 0x3
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x7e
+	.sleb128 0
+	.uleb128 0x3
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x1
+	.byte	0x30
+	.byte	0
+	.uleb128 0x6
+	.quad	.LVL52
+	.long	0xa18
+	.long	0xee7
+	.uleb128 0x3
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -296
+	.uleb128 0x3
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x1
+	.byte	0x30
+	.uleb128 0x3
+	.uleb128 0x1
+	.byte	0x51
+	.uleb128 0x9
+	.byte	0x3
+	.quad	bpipe_reader
+	.uleb128 0x3
+	.uleb128 0x1
+	.byte	0x52
+	.uleb128 0x2
+	.byte	0x76
+	.sleb128 0
+	.byte	0
+	.uleb128 0x10
+	.quad	.LVL64
+	.long	0xabd
+	.uleb128 0x10
+	.quad	.LVL65
+	.long	0xaac
+	.uleb128 0x6
+	.quad	.LVL74
+	.long	0x9dc
+	.long	0xf18
+	.uleb128 0x3
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x1
+	.byte	0x30
+	.byte	0
+	.uleb128 0x10
+	.quad	.LVL76
+	.long	0xaac
+	.uleb128 0x6
+	.quad	.LVL78
+	.long	0x9c5
+	.long	0xf3d
+	.uleb128 0x3
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x7e
+	.sleb128 0
+	.byte	0
+	.uleb128 0x6
+	.quad	.LVL79
+	.long	0x9ae
+	.long	0xf55
+	.uleb128 0x3
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x7d
+	.sleb128 0
+	.byte	0
+	.uleb128 0x10
+	.quad	.LVL81
+	.long	0xabd
+	.byte	0
+	.uleb128 0x36
+	.long	.LASF136
+	.byte	0x1
+	.byte	0x42
+	.byte	0xe
+	.long	0xa2
+	.quad	.LFB25
+	.quad	.LFE25-.LFB25
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0x11bb
+	.uleb128 0x16
+	.string	"arg"
+	.byte	0x42
+	.byte	0x21
+	.long	0xa2
+	.long	.LLST0
+	.long	.LVUS0
+	.uleb128 0x12
+	.string	"Q"
+	.byte	0x44
+	.byte	0x13
+	.long	0x11bb
+	.long	.LLST1
+	.long	.LVUS1
+	.uleb128 0x1b
+	.long	.LLRL2
+	.uleb128 0x21
+	.long	.LASF105
+	.byte	0x46
+	.long	0x43
+	.long	.LLST3
+	.long	.LVUS3
+	.uleb128 0x1b
+	.long	.LLRL4
+	.uleb128 0x12
+	.string	"s"
+	.byte	0x47
+	.byte	0x12
+	.long	0x3c
+	.long	.LLST5
+	.long	.LVUS5
+	.uleb128 0x12
+	.string	"len"
+	.byte	0x48
+	.byte	0x10
+	.long	0xc1
+	.long	.LLST6
+	.long	.LVUS6
+	.uleb128 0x20
+	.long	.LLRL16
+	.long	0x1020
+	.uleb128 0x12
+	.string	"got"
+	.byte	0x51
+	.byte	0x15
+	.long	0x3ad
+	.long	.LLST17
+	.long	.LVUS17
+	.uleb128 0x10
+	.quad	.LVL6
+	.long	0x94c
+	.uleb128 0x10
+	.quad	.LVL40
+	.long	0xaac
+	.byte	0
+	.uleb128 0x37
+	.long	0x11f0
+	.long	.LLRL7
+	.byte	0x1
+	.byte	0x4b
+	.byte	0xd
+	.long	0x10d5
+	.uleb128 0xd
+	.long	0x120d
+	.uleb128 0xd
+	.long	0x1202
+	.uleb128 0xd
+	.long	0x11f9
+	.uleb128 0x24
+	.long	0x11f0
+	.quad	.LBI19
+	.byte	.LVU114
+	.long	.LLRL8
+	.byte	0x29
+	.byte	0xd
+	.long	0x10b9
+	.uleb128 0xd
+	.long	0x120d
+	.uleb128 0xd
+	.long	0x1202
+	.uleb128 0xa
+	.long	0x11f9
+	.long	.LLST9
+	.long	.LVUS9
+	.uleb128 0x6
+	.quad	.LVL35
+	.long	0x935
+	.long	0x1086
+	.uleb128 0x3
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x73
+	.sleb128 0
+	.byte	0
+	.uleb128 0x6
+	.quad	.LVL37
+	.long	0x919
+	.long	0x10a4
+	.uleb128 0x3
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x7f
+	.sleb128 0
+	.uleb128 0x3
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x2
+	.byte	0x73
+	.sleb128 0
+	.byte	0
+	.uleb128 0x14
+	.quad	.LVL38
+	.long	0x8f8
+	.uleb128 0x3
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x73
+	.sleb128 0
+	.byte	0
+	.byte	0
+	.uleb128 0x38
+	.long	0x1219
+	.quad	.LBB25
+	.quad	.LBE25-.LBB25
+	.uleb128 0x23
+	.long	0x121a
+	.byte	0
+	.byte	0
+	.uleb128 0x24
+	.long	0x11c0
+	.quad	.LBI28
+	.byte	.LVU49
+	.long	.LLRL10
+	.byte	0x5d
+	.byte	0x9
+	.long	0x1187
+	.uleb128 0xa
+	.long	0x11e1
+	.long	.LLST11
+	.long	.LVUS11
+	.uleb128 0xa
+	.long	0x11d6
+	.long	.LLST12
+	.long	.LVUS12
+	.uleb128 0xa
+	.long	0x11cd
+	.long	.LLST13
+	.long	.LVUS13
+	.uleb128 0x39
+	.long	0x11c0
+	.quad	.LBI30
+	.byte	.LVU75
+	.long	.LLRL14
+	.byte	0x1
+	.byte	0x38
+	.byte	0xd
+	.uleb128 0xd
+	.long	0x11d6
+	.uleb128 0xd
+	.long	0x11e1
+	.uleb128 0xa
+	.long	0x11cd
+	.long	.LLST15
+	.long	.LVUS15
+	.uleb128 0x6
+	.quad	.LVL21
+	.long	0x935
+	.long	0x1158
+	.uleb128 0x3
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x7f
+	.sleb128 0
+	.byte	0
+	.uleb128 0x6
+	.quad	.LVL22
+	.long	0x8d7
+	.long	0x1171
+	.uleb128 0x3
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x3
+	.byte	0x76
+	.sleb128 168
+	.byte	0
+	.uleb128 0x14
+	.quad	.LVL23
+	.long	0x8f8
+	.uleb128 0x3
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x7f
+	.sleb128 0
+	.byte	0
+	.byte	0
+	.byte	0
+	.uleb128 0x10
+	.quad	.LVL15
+	.long	0x971
+	.uleb128 0x6
+	.quad	.LVL25
+	.long	0x988
+	.long	0x11ab
+	.uleb128 0x3
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x1
+	.byte	0x31
+	.byte	0
+	.uleb128 0x10
+	.quad	.LVL43
+	.long	0xaac
+	.byte	0
+	.byte	0
+	.byte	0
+	.uleb128 0x4
+	.long	0x7cf
+	.uleb128 0x3a
+	.long	.LASF137
+	.byte	0x1
+	.byte	0x38
+	.byte	0xd
+	.byte	0x1
+	.long	0x11eb
+	.uleb128 0x18
+	.string	"Q"
+	.byte	0x38
+	.byte	0x26
+	.long	0x11bb
+	.uleb128 0x18
+	.string	"pos"
+	.byte	0x38
+	.byte	0x38
+	.long	0x11eb
+	.uleb128 0x18
+	.string	"v"
+	.byte	0x38
+	.byte	0x4b
+	.long	0x43
+	.byte	0
+	.uleb128 0x4
+	.long	0x43
+	.uleb128 0x3b
+	.long	.LASF138
+	.byte	0x1
+	.byte	0x29
+	.byte	0xd
+	.byte	0x1
+	.uleb128 0x18
+	.string	"Q"
+	.byte	0x29
+	.byte	0x26
+	.long	0x11bb
+	.uleb128 0x18
+	.string	"pos"
+	.byte	0x29
+	.byte	0x38
+	.long	0x11eb
+	.uleb128 0x3c
+	.long	.LASF130
+	.byte	0x1
+	.byte	0x29
+	.byte	0x4b
+	.long	0x43
+	.uleb128 0x3d
+	.uleb128 0x3e
+	.string	"i"
+	.byte	0x1
+	.byte	0x2b
+	.byte	0x13
+	.long	0x3c
+	.byte	0
+	.byte	0
+	.byte	0
+	.section	.debug_abbrev,"",@progbits
+.Ldebug_abbrev0:
+	.uleb128 0x1
+	.uleb128 0xd
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x38
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x2
+	.uleb128 0x5
+	.byte	0
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x49
+	.byte	0
+	.uleb128 0x2
+	.uleb128 0x18
+	.uleb128 0x7e
+	.uleb128 0x18
+	.byte	0
+	.byte	0
+	.uleb128 0x4
+	.uleb128 0xf
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0x21
+	.sleb128 8
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x5
+	.uleb128 0x16
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x6
+	.uleb128 0x48
+	.byte	0x1
+	.uleb128 0x7d
+	.uleb128 0x1
+	.uleb128 0x7f
+	.uleb128 0x13
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x7
+	.uleb128 0x21
+	.byte	0
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x2f
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x8
+	.uleb128 0xd
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x9
+	.uleb128 0x1
+	.byte	0x1
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0xa
+	.uleb128 0x5
+	.byte	0
+	.uleb128 0x31
+	.uleb128 0x13
+	.uleb128 0x2
+	.uleb128 0x17
+	.uleb128 0x2137
+	.uleb128 0x17
+	.byte	0
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x3c
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0xc
+	.uleb128 0x24
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x3e
+	.uleb128 0xb
+	.uleb128 0x3
+	.uleb128 0xe
+	.byte	0
+	.byte	0
+	.uleb128 0xd
+	.uleb128 0x5
+	.byte	0
+	.uleb128 0x31
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0xe
+	.uleb128 0xd
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x8
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x38
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0xf
+	.uleb128 0x26
+	.byte	0
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x10
+	.uleb128 0x48
+	.byte	0
+	.uleb128 0x7d
+	.uleb128 0x1
+	.uleb128 0x7f
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x11
+	.uleb128 0x37
+	.byte	0
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x12
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x8
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x2
+	.uleb128 0x17
+	.uleb128 0x2137
+	.uleb128 0x17
+	.byte	0
+	.byte	0
+	.uleb128 0x13
+	.uleb128 0x13
+	.byte	0x1
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x14
+	.uleb128 0x48
+	.byte	0x1
+	.uleb128 0x7d
+	.uleb128 0x1
+	.uleb128 0x7f
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x15
+	.uleb128 0x17
+	.byte	0x1
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 9
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x16
+	.uleb128 0x5
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x8
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x2
+	.uleb128 0x17
+	.uleb128 0x2137
+	.uleb128 0x17
+	.byte	0
+	.byte	0
+	.uleb128 0x17
+	.uleb128 0x5
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x2
+	.uleb128 0x17
+	.uleb128 0x2137
+	.uleb128 0x17
+	.byte	0
+	.byte	0
+	.uleb128 0x18
+	.uleb128 0x5
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x8
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x19
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x3c
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x1a
+	.uleb128 0x13
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3c
+	.uleb128 0x19
+	.byte	0
+	.byte	0
+	.uleb128 0x1b
+	.uleb128 0xb
+	.byte	0x1
+	.uleb128 0x55
+	.uleb128 0x17
+	.byte	0
+	.byte	0
+	.uleb128 0x1c
+	.uleb128 0x16
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x8
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 13
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x1d
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 13
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x1c
+	.uleb128 0xa
+	.byte	0
+	.byte	0
+	.uleb128 0x1e
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 5
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x11
+	.uleb128 0x1
+	.uleb128 0x12
+	.uleb128 0x7
+	.uleb128 0x40
+	.uleb128 0x18
+	.uleb128 0x7a
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x1f
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x8
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x2
+	.uleb128 0x18
+	.byte	0
+	.byte	0
+	.uleb128 0x20
+	.uleb128 0xb
+	.byte	0x1
+	.uleb128 0x55
+	.uleb128 0x17
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x21
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 24
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x2
+	.uleb128 0x17
+	.uleb128 0x2137
+	.uleb128 0x17
+	.byte	0
+	.byte	0
+	.uleb128 0x22
+	.uleb128 0x1d
+	.byte	0x1
+	.uleb128 0x31
+	.uleb128 0x13
+	.uleb128 0x52
+	.uleb128 0x1
+	.uleb128 0x2138
+	.uleb128 0xb
+	.uleb128 0x11
+	.uleb128 0x1
+	.uleb128 0x12
+	.uleb128 0x7
+	.uleb128 0x58
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x59
+	.uleb128 0xb
+	.uleb128 0x57
+	.uleb128 0x21
+	.sleb128 13
+	.byte	0
+	.byte	0
+	.uleb128 0x23
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x31
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x24
+	.uleb128 0x1d
+	.byte	0x1
+	.uleb128 0x31
+	.uleb128 0x13
+	.uleb128 0x52
+	.uleb128 0x1
+	.uleb128 0x2138
+	.uleb128 0xb
+	.uleb128 0x55
+	.uleb128 0x17
+	.uleb128 0x58
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x59
+	.uleb128 0xb
+	.uleb128 0x57
+	.uleb128 0xb
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x25
+	.uleb128 0x11
+	.byte	0x1
+	.uleb128 0x25
+	.uleb128 0xe
+	.uleb128 0x13
+	.uleb128 0xb
+	.uleb128 0x3
+	.uleb128 0x1f
+	.uleb128 0x1b
+	.uleb128 0x1f
+	.uleb128 0x11
+	.uleb128 0x1
+	.uleb128 0x12
+	.uleb128 0x7
+	.uleb128 0x10
+	.uleb128 0x17
+	.byte	0
+	.byte	0
+	.uleb128 0x26
+	.uleb128 0x24
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x3e
+	.uleb128 0xb
+	.uleb128 0x3
+	.uleb128 0x8
+	.byte	0
+	.byte	0
+	.uleb128 0x27
+	.uleb128 0xf
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x28
+	.uleb128 0x13
+	.byte	0x1
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x29
+	.uleb128 0x17
+	.byte	0x1
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x2a
+	.uleb128 0x26
+	.byte	0
+	.byte	0
+	.byte	0
+	.uleb128 0x2b
+	.uleb128 0x16
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x2c
+	.uleb128 0x13
+	.byte	0x1
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x88
+	.uleb128 0xb
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x2d
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x3c
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x2e
+	.uleb128 0x15
+	.byte	0x1
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x2f
+	.uleb128 0x2e
+	.byte	0
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x3c
+	.uleb128 0x19
+	.byte	0
+	.byte	0
+	.uleb128 0x30
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x3c
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x31
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x2
+	.uleb128 0x18
+	.byte	0
+	.byte	0
+	.uleb128 0x32
+	.uleb128 0xa
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x11
+	.uleb128 0x1
+	.byte	0
+	.byte	0
+	.uleb128 0x33
+	.uleb128 0x1d
+	.byte	0x1
+	.uleb128 0x31
+	.uleb128 0x13
+	.uleb128 0x52
+	.uleb128 0x1
+	.uleb128 0x2138
+	.uleb128 0xb
+	.uleb128 0x11
+	.uleb128 0x1
+	.uleb128 0x12
+	.uleb128 0x7
+	.uleb128 0x58
+	.uleb128 0xb
+	.uleb128 0x59
+	.uleb128 0xb
+	.uleb128 0x57
+	.uleb128 0xb
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x34
+	.uleb128 0x1d
+	.byte	0x1
+	.uleb128 0x31
+	.uleb128 0x13
+	.uleb128 0x11
+	.uleb128 0x1
+	.uleb128 0x12
+	.uleb128 0x7
+	.uleb128 0x58
+	.uleb128 0xb
+	.uleb128 0x59
+	.uleb128 0xb
+	.uleb128 0x57
+	.uleb128 0xb
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x35
+	.uleb128 0xb
+	.byte	0x1
+	.uleb128 0x31
+	.uleb128 0x13
+	.uleb128 0x11
+	.uleb128 0x1
+	.uleb128 0x12
+	.uleb128 0x7
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x36
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x11
+	.uleb128 0x1
+	.uleb128 0x12
+	.uleb128 0x7
+	.uleb128 0x40
+	.uleb128 0x18
+	.uleb128 0x7a
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x37
+	.uleb128 0x1d
+	.byte	0x1
+	.uleb128 0x31
+	.uleb128 0x13
+	.uleb128 0x55
+	.uleb128 0x17
+	.uleb128 0x58
+	.uleb128 0xb
+	.uleb128 0x59
+	.uleb128 0xb
+	.uleb128 0x57
+	.uleb128 0xb
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x38
+	.uleb128 0xb
+	.byte	0x1
+	.uleb128 0x31
+	.uleb128 0x13
+	.uleb128 0x11
+	.uleb128 0x1
+	.uleb128 0x12
+	.uleb128 0x7
+	.byte	0
+	.byte	0
+	.uleb128 0x39
+	.uleb128 0x1d
+	.byte	0x1
+	.uleb128 0x31
+	.uleb128 0x13
+	.uleb128 0x52
+	.uleb128 0x1
+	.uleb128 0x2138
+	.uleb128 0xb
+	.uleb128 0x55
+	.uleb128 0x17
+	.uleb128 0x58
+	.uleb128 0xb
+	.uleb128 0x59
+	.uleb128 0xb
+	.uleb128 0x57
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x3a
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x20
+	.uleb128 0xb
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x3b
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x20
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x3c
+	.uleb128 0x5
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x3d
+	.uleb128 0xb
+	.byte	0x1
+	.byte	0
+	.byte	0
+	.uleb128 0x3e
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x8
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.byte	0
+	.section	.debug_loclists,"",@progbits
+	.long	.Ldebug_loc3-.Ldebug_loc2
+.Ldebug_loc2:
+	.value	0x5
+	.byte	0x8
+	.byte	0
+	.long	0
+.Ldebug_loc0:
+.LVUS40:
+	.uleb128 0
+	.uleb128 .LVU290
+	.uleb128 .LVU290
+	.uleb128 0
+.LLST40:
+	.byte	0x4
+	.uleb128 .LVL82-.Ltext0
+	.uleb128 .LVL83-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL83-1-.Ltext0
+	.uleb128 .LFE27-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x9f
+	.byte	0
+.LVUS41:
+	.uleb128 0
+	.uleb128 .LVU290
+	.uleb128 .LVU290
+	.uleb128 0
+.LLST41:
+	.byte	0x4
+	.uleb128 .LVL82-.Ltext0
+	.uleb128 .LVL83-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x4
+	.uleb128 .LVL83-1-.Ltext0
+	.uleb128 .LFE27-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x9f
+	.byte	0
+.LVUS18:
+	.uleb128 0
+	.uleb128 .LVU182
+	.uleb128 .LVU182
+	.uleb128 .LVU233
+	.uleb128 .LVU233
+	.uleb128 .LVU234
+	.uleb128 .LVU234
+	.uleb128 .LVU267
+	.uleb128 .LVU267
+	.uleb128 0
+.LLST18:
+	.byte	0x4
+	.uleb128 .LVL44-.Ltext0
+	.uleb128 .LVL45-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL45-.Ltext0
+	.uleb128 .LVL66-.Ltext0
+	.uleb128 0x1
+	.byte	0x5c
+	.byte	0x4
+	.uleb128 .LVL66-.Ltext0
+	.uleb128 .LVL67-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL67-.Ltext0
+	.uleb128 .LVL75-.Ltext0
+	.uleb128 0x1
+	.byte	0x5c
+	.byte	0x4
+	.uleb128 .LVL75-.Ltext0
+	.uleb128 .LFE26-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x9f
+	.byte	0
+.LVUS19:
+	.uleb128 0
+	.uleb128 .LVU182
+	.uleb128 .LVU182
+	.uleb128 0
+.LLST19:
+	.byte	0x4
+	.uleb128 .LVL44-.Ltext0
+	.uleb128 .LVL45-.Ltext0
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x4
+	.uleb128 .LVL45-.Ltext0
+	.uleb128 .LFE26-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x9f
+	.byte	0
+.LVUS20:
+	.uleb128 0
+	.uleb128 .LVU182
+	.uleb128 .LVU182
+	.uleb128 0
+.LLST20:
+	.byte	0x4
+	.uleb128 .LVL44-.Ltext0
+	.uleb128 .LVL45-.Ltext0
+	.uleb128 0x1
+	.byte	0x51
+	.byte	0x4
+	.uleb128 .LVL45-.Ltext0
+	.uleb128 .LFE26-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x51
+	.byte	0x9f
+	.byte	0
+.LVUS21:
+	.uleb128 0
+	.uleb128 .LVU182
+	.uleb128 .LVU182
+	.uleb128 0
+.LLST21:
+	.byte	0x4
+	.uleb128 .LVL44-.Ltext0
+	.uleb128 .LVL45-.Ltext0
+	.uleb128 0x1
+	.byte	0x52
+	.byte	0x4
+	.uleb128 .LVL45-.Ltext0
+	.uleb128 .LFE26-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x52
+	.byte	0x9f
+	.byte	0
+.LVUS22:
+	.uleb128 0
+	.uleb128 .LVU182
+	.uleb128 .LVU182
+	.uleb128 0
+.LLST22:
+	.byte	0x4
+	.uleb128 .LVL44-.Ltext0
+	.uleb128 .LVL45-.Ltext0
+	.uleb128 0x1
+	.byte	0x58
+	.byte	0x4
+	.uleb128 .LVL45-.Ltext0
+	.uleb128 .LFE26-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x58
+	.byte	0x9f
+	.byte	0
+.LVUS23:
+	.uleb128 0
+	.uleb128 .LVU182
+	.uleb128 .LVU182
+	.uleb128 .LVU191
+	.uleb128 .LVU191
+	.uleb128 .LVU221
+	.uleb128 .LVU221
+	.uleb128 .LVU233
+	.uleb128 .LVU233
+	.uleb128 0
+.LLST23:
+	.byte	0x4
+	.uleb128 .LVL44-.Ltext0
+	.uleb128 .LVL45-.Ltext0
+	.uleb128 0x1
+	.byte	0x59
+	.byte	0x4
+	.uleb128 .LVL45-.Ltext0
+	.uleb128 .LVL49-.Ltext0
+	.uleb128 0x1
+	.byte	0x5e
+	.byte	0x4
+	.uleb128 .LVL49-.Ltext0
+	.uleb128 .LVL61-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x59
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL61-.Ltext0
+	.uleb128 .LVL66-.Ltext0
+	.uleb128 0x1
+	.byte	0x5e
+	.byte	0x4
+	.uleb128 .LVL66-.Ltext0
+	.uleb128 .LFE26-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x59
+	.byte	0x9f
+	.byte	0
+.LVUS24:
+	.uleb128 0
+	.uleb128 .LVU197
+	.uleb128 .LVU221
+	.uleb128 .LVU233
+.LLST24:
+	.byte	0x4
+	.uleb128 .LVL44-.Ltext0
+	.uleb128 .LVL53-.Ltext0
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 0
+	.byte	0x4
+	.uleb128 .LVL61-.Ltext0
+	.uleb128 .LVL66-.Ltext0
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 0
+	.byte	0
+.LVUS25:
+	.uleb128 .LVU181
+	.uleb128 .LVU182
+	.uleb128 .LVU182
+	.uleb128 .LVU189
+	.uleb128 .LVU221
+	.uleb128 .LVU225
+	.uleb128 .LVU225
+	.uleb128 .LVU226
+	.uleb128 .LVU276
+	.uleb128 .LVU277
+	.uleb128 .LVU277
+	.uleb128 .LVU279
+	.uleb128 .LVU279
+	.uleb128 .LVU281
+.LLST25:
+	.byte	0x4
+	.uleb128 .LVL45-.Ltext0
+	.uleb128 .LVL45-.Ltext0
+	.uleb128 0x2
+	.byte	0x30
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL45-.Ltext0
+	.uleb128 .LVL48-.Ltext0
+	.uleb128 0x1
+	.byte	0x56
+	.byte	0x4
+	.uleb128 .LVL61-.Ltext0
+	.uleb128 .LVL62-.Ltext0
+	.uleb128 0x1
+	.byte	0x56
+	.byte	0x4
+	.uleb128 .LVL62-.Ltext0
+	.uleb128 .LVL63-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL79-.Ltext0
+	.uleb128 .LVL79-.Ltext0
+	.uleb128 0x2
+	.byte	0x30
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL79-.Ltext0
+	.uleb128 .LVL80-.Ltext0
+	.uleb128 0xb
+	.byte	0x76
+	.sleb128 0
+	.byte	0x91
+	.sleb128 0
+	.byte	0x1c
+	.byte	0x23
+	.uleb128 0x120
+	.byte	0x33
+	.byte	0x25
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL80-.Ltext0
+	.uleb128 .LVL81-.Ltext0
+	.uleb128 0xb
+	.byte	0x76
+	.sleb128 0
+	.byte	0x91
+	.sleb128 0
+	.byte	0x1c
+	.byte	0x23
+	.uleb128 0x118
+	.byte	0x33
+	.byte	0x25
+	.byte	0x9f
+	.byte	0
+.LVUS26:
+	.uleb128 .LVU157
+	.uleb128 .LVU233
+	.uleb128 .LVU234
+	.uleb128 .LVU265
+	.uleb128 .LVU265
+	.uleb128 .LVU273
+	.uleb128 .LVU273
+	.uleb128 0
+.LLST26:
+	.byte	0x4
+	.uleb128 .LVL44-.Ltext0
+	.uleb128 .LVL66-.Ltext0
+	.uleb128 0x2
+	.byte	0x30
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL67-.Ltext0
+	.uleb128 .LVL74-.Ltext0
+	.uleb128 0x2
+	.byte	0x30
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL74-.Ltext0
+	.uleb128 .LVL77-.Ltext0
+	.uleb128 0x2
+	.byte	0x31
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL77-.Ltext0
+	.uleb128 .LFE26-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0
+.LVUS28:
+	.uleb128 .LVU197
+	.uleb128 .LVU209
+	.uleb128 .LVU209
+	.uleb128 .LVU221
+	.uleb128 .LVU234
+	.uleb128 .LVU263
+.LLST28:
+	.byte	0x4
+	.uleb128 .LVL53-.Ltext0
+	.uleb128 .LVL55-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0x4
+	.uleb128 .LVL55-.Ltext0
+	.uleb128 .LVL61-.Ltext0
+	.uleb128 0x3
+	.byte	0x73
+	.sleb128 -1
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL67-.Ltext0
+	.uleb128 .LVL73-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0
+.LVUS30:
+	.uleb128 .LVU202
+	.uleb128 .LVU221
+	.uleb128 .LVU234
+	.uleb128 .LVU273
+.LLST30:
+	.byte	0x4
+	.uleb128 .LVL54-.Ltext0
+	.uleb128 .LVL61-.Ltext0
+	.uleb128 0x1
+	.byte	0x5f
+	.byte	0x4
+	.uleb128 .LVL67-.Ltext0
+	.uleb128 .LVL77-.Ltext0
+	.uleb128 0x1
+	.byte	0x5f
+	.byte	0
+.LVUS31:
+	.uleb128 .LVU211
+	.uleb128 .LVU221
+.LLST31:
+	.byte	0x4
+	.uleb128 .LVL56-.Ltext0
+	.uleb128 .LVL61-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0
+.LVUS32:
+	.uleb128 .LVU211
+	.uleb128 .LVU221
+.LLST32:
+	.byte	0x4
+	.uleb128 .LVL56-.Ltext0
+	.uleb128 .LVL61-.Ltext0
+	.uleb128 0x4
+	.byte	0x91
+	.sleb128 -176
+	.byte	0x9f
+	.byte	0
+.LVUS33:
+	.uleb128 .LVU211
+	.uleb128 .LVU221
+.LLST33:
+	.byte	0x4
+	.uleb128 .LVL56-.Ltext0
+	.uleb128 .LVL61-.Ltext0
+	.uleb128 0x1
+	.byte	0x56
+	.byte	0
+.LVUS34:
+	.uleb128 .LVU217
+	.uleb128 .LVU221
+.LLST34:
+	.byte	0x4
+	.uleb128 .LVL57-.Ltext0
+	.uleb128 .LVL61-.Ltext0
+	.uleb128 0x4
+	.byte	0x91
+	.sleb128 -176
+	.byte	0x9f
+	.byte	0
+.LVUS35:
+	.uleb128 .LVU217
+	.uleb128 .LVU221
+.LLST35:
+	.byte	0x4
+	.uleb128 .LVL57-.Ltext0
+	.uleb128 .LVL61-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0
+.LVUS36:
+	.uleb128 .LVU216
+	.uleb128 .LVU221
+.LLST36:
+	.byte	0x4
+	.uleb128 .LVL57-.Ltext0
+	.uleb128 .LVL61-.Ltext0
+	.uleb128 0x1
+	.byte	0x56
+	.byte	0
+.LVUS37:
+	.uleb128 .LVU240
+	.uleb128 .LVU260
+.LLST37:
+	.byte	0x4
+	.uleb128 .LVL68-.Ltext0
+	.uleb128 .LVL72-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0
+.LVUS38:
+	.uleb128 .LVU240
+	.uleb128 .LVU260
+.LLST38:
+	.byte	0x4
+	.uleb128 .LVL68-.Ltext0
+	.uleb128 .LVL72-.Ltext0
+	.uleb128 0x4
+	.byte	0x91
+	.sleb128 -184
+	.byte	0x9f
+	.byte	0
+.LVUS39:
+	.uleb128 .LVU240
+	.uleb128 .LVU260
+.LLST39:
+	.byte	0x4
+	.uleb128 .LVL68-.Ltext0
+	.uleb128 .LVL72-.Ltext0
+	.uleb128 0x1
+	.byte	0x56
+	.byte	0
+.LVUS0:
+	.uleb128 0
+	.uleb128 .LVU16
+	.uleb128 .LVU16
+	.uleb128 .LVU59
+	.uleb128 .LVU59
+	.uleb128 .LVU60
+	.uleb128 .LVU60
+	.uleb128 .LVU61
+	.uleb128 .LVU61
+	.uleb128 .LVU62
+	.uleb128 .LVU62
+	.uleb128 0
+.LLST0:
+	.byte	0x4
+	.uleb128 .LVL0-.Ltext0
+	.uleb128 .LVL1-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL1-.Ltext0
+	.uleb128 .LVL11-.Ltext0
+	.uleb128 0x1
+	.byte	0x56
+	.byte	0x4
+	.uleb128 .LVL11-.Ltext0
+	.uleb128 .LVL12-.Ltext0
+	.uleb128 0x4
+	.byte	0x7c
+	.sleb128 -112
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL12-.Ltext0
+	.uleb128 .LVL13-.Ltext0
+	.uleb128 0x4
+	.byte	0x7d
+	.sleb128 -124
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL13-.Ltext0
+	.uleb128 .LVL14-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL14-.Ltext0
+	.uleb128 .LFE25-.Ltext0
+	.uleb128 0x1
+	.byte	0x56
+	.byte	0
+.LVUS1:
+	.uleb128 .LVU2
+	.uleb128 .LVU16
+	.uleb128 .LVU16
+	.uleb128 .LVU59
+	.uleb128 .LVU59
+	.uleb128 .LVU60
+	.uleb128 .LVU60
+	.uleb128 .LVU61
+	.uleb128 .LVU61
+	.uleb128 .LVU62
+	.uleb128 .LVU62
+	.uleb128 0
+.LLST1:
+	.byte	0x4
+	.uleb128 .LVL0-.Ltext0
+	.uleb128 .LVL1-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL1-.Ltext0
+	.uleb128 .LVL11-.Ltext0
+	.uleb128 0x1
+	.byte	0x56
+	.byte	0x4
+	.uleb128 .LVL11-.Ltext0
+	.uleb128 .LVL12-.Ltext0
+	.uleb128 0x4
+	.byte	0x7c
+	.sleb128 -112
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL12-.Ltext0
+	.uleb128 .LVL13-.Ltext0
+	.uleb128 0x4
+	.byte	0x7d
+	.sleb128 -124
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL13-.Ltext0
+	.uleb128 .LVL14-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL14-.Ltext0
+	.uleb128 .LFE25-.Ltext0
+	.uleb128 0x1
+	.byte	0x56
+	.byte	0
+.LVUS3:
+	.uleb128 .LVU4
+	.uleb128 .LVU16
+	.uleb128 .LVU16
+	.uleb128 .LVU22
+	.uleb128 .LVU101
+	.uleb128 .LVU106
+.LLST3:
+	.byte	0x4
+	.uleb128 .LVL0-.Ltext0
+	.uleb128 .LVL1-.Ltext0
+	.uleb128 0x2
+	.byte	0x30
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL1-.Ltext0
+	.uleb128 .LVL3-.Ltext0
+	.uleb128 0x3
+	.byte	0x7e
+	.sleb128 4
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL31-.Ltext0
+	.uleb128 .LVL33-.Ltext0
+	.uleb128 0x3
+	.byte	0x7e
+	.sleb128 4
+	.byte	0x9f
+	.byte	0
+.LVUS5:
+	.uleb128 .LVU19
+	.uleb128 .LVU22
+	.uleb128 .LVU103
+	.uleb128 .LVU116
+	.uleb128 .LVU116
+	.uleb128 .LVU121
+.LLST5:
+	.byte	0x4
+	.uleb128 .LVL2-.Ltext0
+	.uleb128 .LVL3-.Ltext0
+	.uleb128 0x1
+	.byte	0x5a
+	.byte	0x4
+	.uleb128 .LVL32-.Ltext0
+	.uleb128 .LVL35-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x5a
+	.byte	0x4
+	.uleb128 .LVL35-1-.Ltext0
+	.uleb128 .LVL36-.Ltext0
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -76
+	.byte	0
+.LVUS6:
+	.uleb128 .LVU31
+	.uleb128 .LVU55
+	.uleb128 .LVU62
+	.uleb128 .LVU63
+	.uleb128 .LVU63
+	.uleb128 .LVU64
+	.uleb128 .LVU64
+	.uleb128 .LVU75
+	.uleb128 .LVU84
+	.uleb128 .LVU92
+	.uleb128 .LVU92
+	.uleb128 .LVU106
+	.uleb128 .LVU136
+	.uleb128 .LVU143
+	.uleb128 .LVU143
+	.uleb128 .LVU145
+	.uleb128 .LVU145
+	.uleb128 0
+.LLST6:
+	.byte	0x4
+	.uleb128 .LVL5-.Ltext0
+	.uleb128 .LVL10-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0x4
+	.uleb128 .LVL14-.Ltext0
+	.uleb128 .LVL15-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL15-1-.Ltext0
+	.uleb128 .LVL16-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0x4
+	.uleb128 .LVL16-.Ltext0
+	.uleb128 .LVL20-.Ltext0
+	.uleb128 0x2
+	.byte	0x30
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL26-.Ltext0
+	.uleb128 .LVL28-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL28-.Ltext0
+	.uleb128 .LVL33-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0x4
+	.uleb128 .LVL39-.Ltext0
+	.uleb128 .LVL41-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0x4
+	.uleb128 .LVL41-.Ltext0
+	.uleb128 .LVL42-.Ltext0
+	.uleb128 0x2
+	.byte	0x30
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL42-.Ltext0
+	.uleb128 .LFE25-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0
+.LVUS17:
+	.uleb128 .LVU27
+	.uleb128 .LVU39
+	.uleb128 .LVU39
+	.uleb128 .LVU42
+	.uleb128 .LVU136
+	.uleb128 .LVU140
+.LLST17:
+	.byte	0x4
+	.uleb128 .LVL4-.Ltext0
+	.uleb128 .LVL6-.Ltext0
+	.uleb128 0x2
+	.byte	0x30
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL6-.Ltext0
+	.uleb128 .LVL7-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL39-.Ltext0
+	.uleb128 .LVL40-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0
+.LVUS9:
+	.uleb128 .LVU113
+	.uleb128 .LVU136
+.LLST9:
+	.byte	0x4
+	.uleb128 .LVL34-.Ltext0
+	.uleb128 .LVL39-.Ltext0
+	.uleb128 0x1
+	.byte	0x56
+	.byte	0
+.LVUS11:
+	.uleb128 .LVU49
+	.uleb128 .LVU51
+	.uleb128 .LVU51
+	.uleb128 .LVU55
+	.uleb128 .LVU67
+	.uleb128 .LVU70
+	.uleb128 .LVU70
+	.uleb128 .LVU71
+	.uleb128 .LVU71
+	.uleb128 .LVU75
+	.uleb128 .LVU89
+	.uleb128 .LVU92
+	.uleb128 .LVU92
+	.uleb128 .LVU93
+	.uleb128 .LVU93
+	.uleb128 .LVU97
+.LLST11:
+	.byte	0x4
+	.uleb128 .LVL8-.Ltext0
+	.uleb128 .LVL9-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL9-.Ltext0
+	.uleb128 .LVL10-.Ltext0
+	.uleb128 0x2
+	.byte	0x74
+	.sleb128 0
+	.byte	0x4
+	.uleb128 .LVL17-.Ltext0
+	.uleb128 .LVL18-.Ltext0
+	.uleb128 0x3
+	.byte	0x7e
+	.sleb128 5
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL18-.Ltext0
+	.uleb128 .LVL19-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL19-.Ltext0
+	.uleb128 .LVL20-.Ltext0
+	.uleb128 0x2
+	.byte	0x74
+	.sleb128 0
+	.byte	0x4
+	.uleb128 .LVL27-.Ltext0
+	.uleb128 .LVL28-.Ltext0
+	.uleb128 0x3
+	.byte	0x7e
+	.sleb128 5
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL28-.Ltext0
+	.uleb128 .LVL29-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL29-.Ltext0
+	.uleb128 .LVL30-.Ltext0
+	.uleb128 0x2
+	.byte	0x74
+	.sleb128 0
+	.byte	0
+.LVUS12:
+	.uleb128 .LVU49
+	.uleb128 .LVU55
+	.uleb128 .LVU67
+	.uleb128 .LVU75
+	.uleb128 .LVU89
+	.uleb128 .LVU97
+.LLST12:
+	.byte	0x4
+	.uleb128 .LVL8-.Ltext0
+	.uleb128 .LVL10-.Ltext0
+	.uleb128 0x4
+	.byte	0x76
+	.sleb128 104
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL17-.Ltext0
+	.uleb128 .LVL20-.Ltext0
+	.uleb128 0x4
+	.byte	0x76
+	.sleb128 104
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL27-.Ltext0
+	.uleb128 .LVL30-.Ltext0
+	.uleb128 0x4
+	.byte	0x76
+	.sleb128 104
+	.byte	0x9f
+	.byte	0
+.LVUS13:
+	.uleb128 .LVU49
+	.uleb128 .LVU55
+	.uleb128 .LVU67
+	.uleb128 .LVU80
+	.uleb128 .LVU89
+	.uleb128 .LVU97
+.LLST13:
+	.byte	0x4
+	.uleb128 .LVL8-.Ltext0
+	.uleb128 .LVL10-.Ltext0
+	.uleb128 0x1
+	.byte	0x56
+	.byte	0x4
+	.uleb128 .LVL17-.Ltext0
+	.uleb128 .LVL24-.Ltext0
+	.uleb128 0x1
+	.byte	0x56
+	.byte	0x4
+	.uleb128 .LVL27-.Ltext0
+	.uleb128 .LVL30-.Ltext0
+	.uleb128 0x1
+	.byte	0x56
+	.byte	0
+.LVUS15:
+	.uleb128 .LVU75
+	.uleb128 .LVU80
+.LLST15:
+	.byte	0x4
+	.uleb128 .LVL20-.Ltext0
+	.uleb128 .LVL24-.Ltext0
+	.uleb128 0x1
+	.byte	0x56
+	.byte	0
+.Ldebug_loc3:
+	.section	.debug_aranges,"",@progbits
+	.long	0x2c
+	.value	0x2
+	.long	.Ldebug_info0
+	.byte	0x8
+	.byte	0
+	.value	0
+	.value	0
+	.quad	.Ltext0
+	.quad	.Letext0-.Ltext0
+	.quad	0
+	.quad	0
+	.section	.debug_rnglists,"",@progbits
+.Ldebug_ranges0:
+	.long	.Ldebug_ranges3-.Ldebug_ranges2
+.Ldebug_ranges2:
+	.value	0x5
+	.byte	0x8
+	.byte	0
+	.long	0
+.LLRL2:
+	.byte	0x4
+	.uleb128 .LBB16-.Ltext0
+	.uleb128 .LBE16-.Ltext0
+.LLRL4:
+	.byte	0x4
+	.uleb128 .LBB52-.Ltext0
+	.uleb128 .LBE52-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB53-.Ltext0
+	.uleb128 .LBE53-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB54-.Ltext0
+	.uleb128 .LBE54-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB55-.Ltext0
+	.uleb128 .LBE55-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB56-.Ltext0
+	.uleb128 .LBE56-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB57-.Ltext0
+	.uleb128 .LBE57-.Ltext0
+	.byte	0
+.LLRL7:
+	.byte	0x4
+	.uleb128 .LBB18-.Ltext0
+	.uleb128 .LBE18-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB27-.Ltext0
+	.uleb128 .LBE27-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB45-.Ltext0
+	.uleb128 .LBE45-.Ltext0
+	.byte	0
+.LLRL8:
+	.byte	0x4
+	.uleb128 .LBB19-.Ltext0
+	.uleb128 .LBE19-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB24-.Ltext0
+	.uleb128 .LBE24-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB26-.Ltext0
+	.uleb128 .LBE26-.Ltext0
+	.byte	0
+.LLRL10:
+	.byte	0x4
+	.uleb128 .LBB28-.Ltext0
+	.uleb128 .LBE28-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB40-.Ltext0
+	.uleb128 .LBE40-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB41-.Ltext0
+	.uleb128 .LBE41-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB42-.Ltext0
+	.uleb128 .LBE42-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB43-.Ltext0
+	.uleb128 .LBE43-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB44-.Ltext0
+	.uleb128 .LBE44-.Ltext0
+	.byte	0
+.LLRL14:
+	.byte	0x4
+	.uleb128 .LBB30-.Ltext0
+	.uleb128 .LBE30-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB33-.Ltext0
+	.uleb128 .LBE33-.Ltext0
+	.byte	0
+.LLRL16:
+	.byte	0x4
+	.uleb128 .LBB39-.Ltext0
+	.uleb128 .LBE39-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB46-.Ltext0
+	.uleb128 .LBE46-.Ltext0
+	.byte	0
+.LLRL27:
+	.byte	0x4
+	.uleb128 .LBB70-.Ltext0
+	.uleb128 .LBE70-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB81-.Ltext0
+	.uleb128 .LBE81-.Ltext0
+	.byte	0
+.LLRL29:
+	.byte	0x4
+	.uleb128 .LBB71-.Ltext0
+	.uleb128 .LBE71-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB80-.Ltext0
+	.uleb128 .LBE80-.Ltext0
+	.byte	0
+.Ldebug_ranges3:
+	.section	.debug_line,"",@progbits
+.Ldebug_line0:
+	.section	.debug_str,"MS",@progbits,1
+.LASF44:
+	.string	"pthread_t"
+.LASF78:
+	.string	"_shortbuf"
+.LASF132:
+	.string	"_IO_lock_t"
+.LASF67:
+	.string	"_IO_buf_end"
+.LASF94:
+	.string	"flags"
+.LASF47:
+	.string	"pthread_mutexattr_t"
+.LASF65:
+	.string	"_IO_write_end"
+.LASF4:
+	.string	"unsigned int"
+.LASF83:
+	.string	"_freeres_list"
+.LASF59:
+	.string	"_flags"
+.LASF105:
+	.string	"head"
+.LASF42:
+	.string	"__wrefs"
+.LASF124:
+	.string	"blake2s_update"
+.LASF120:
+	.string	"pthread_join"
+.LASF71:
+	.string	"_markers"
+.LASF121:
+	.string	"pthread_create"
+.LASF128:
+	.string	"blake2s_pipe_run"
+.LASF113:
+	.string	"pthread_cond_wait"
+.LASF111:
+	.string	"pthread_cond_broadcast"
+.LASF127:
+	.string	"blake2s_file_pipelined"
+.LASF54:
+	.string	"ssize_t"
+.LASF112:
+	.string	"pthread_mutex_unlock"
+.LASF114:
+	.string	"pthread_mutex_lock"
+.LASF134:
+	.string	"__errno_location"
+.LASF95:
+	.string	"chunk"
+.LASF53:
+	.string	"pthread_cond_t"
+.LASF26:
+	.string	"__pthread_internal_list"
+.LASF110:
+	.string	"blake2s_file_ex"
+.LASF135:
+	.string	"_out"
+.LASF92:
+	.string	"blake2s_io"
+.LASF56:
+	.string	"uint32_t"
+.LASF118:
+	.string	"pthread_mutex_destroy"
+.LASF99:
+	.string	"blake2s_iv"
+.LASF38:
+	.string	"__g1_start"
+.LASF70:
+	.string	"_IO_save_end"
+.LASF122:
+	.string	"pthread_cond_init"
+.LASF29:
+	.string	"__count"
+.LASF90:
+	.string	"_IO_codecvt"
+.LASF21:
+	.string	"long long unsigned int"
+.LASF30:
+	.string	"__owner"
+.LASF80:
+	.string	"_offset"
+.LASF40:
+	.string	"__g_size"
+.LASF34:
+	.string	"__elision"
+.LASF115:
+	.string	"blake2s_pread"
+.LASF73:
+	.string	"_fileno"
+.LASF16:
+	.string	"size_t"
+.LASF62:
+	.string	"_IO_read_base"
+.LASF125:
+	.string	"free"
+.LASF11:
+	.string	"__uint64_t"
+.LASF138:
+	.string	"bpipe_wait"
+.LASF18:
+	.string	"__high"
+.LASF24:
+	.string	"__next"
+.LASF97:
+	.string	"digest_len"
+.LASF15:
+	.string	"char"
+.LASF86:
+	.string	"_mode"
+.LASF55:
+	.string	"uint8_t"
+.LASF116:
+	.string	"ferror"
+.LASF89:
+	.string	"_IO_marker"
+.LASF60:
+	.string	"_IO_read_ptr"
+.LASF123:
+	.string	"pthread_mutex_init"
+.LASF33:
+	.string	"__spins"
+.LASF23:
+	.string	"__prev"
+.LASF133:
+	.string	"blake2s_ctx"
+.LASF49:
+	.string	"pthread_attr_t"
+.LASF63:
+	.string	"_IO_write_base"
+.LASF35:
+	.string	"__list"
+.LASF52:
+	.string	"long long int"
+.LASF108:
+	.string	"lock"
+.LASF68:
+	.string	"_IO_save_base"
+.LASF101:
+	.string	"bpipe"
+.LASF137:
+	.string	"bpipe_post"
+.LASF104:
+	.string	"size"
+.LASF84:
+	.string	"_freeres_buf"
+.LASF69:
+	.string	"_IO_backup_base"
+.LASF32:
+	.string	"__kind"
+.LASF85:
+	.string	"__pad5"
+.LASF20:
+	.string	"__value32"
+.LASF98:
+	.string	"last_node"
+.LASF77:
+	.string	"_vtable_offset"
+.LASF130:
+	.string	"seen"
+.LASF107:
+	.string	"sleepers"
+.LASF25:
+	.string	"__pthread_list_t"
+.LASF100:
+	.string	"blake2s_sigma"
+.LASF48:
+	.string	"pthread_condattr_t"
+.LASF129:
+	.string	"reader"
+.LASF93:
+	.string	"engine"
+.LASF61:
+	.string	"_IO_read_end"
+.LASF7:
+	.string	"short int"
+.LASF10:
+	.string	"long int"
+.LASF117:
+	.string	"fread"
+.LASF109:
+	.string	"wake"
+.LASF91:
+	.string	"_IO_wide_data"
+.LASF57:
+	.string	"uint64_t"
+.LASF14:
+	.string	"__ssize_t"
+.LASF8:
+	.string	"__uint8_t"
+.LASF50:
+	.string	"__data"
+.LASF22:
+	.string	"__atomic_wide_counter"
+.LASF96:
+	.string	"buf_len"
+.LASF31:
+	.string	"__nusers"
+.LASF82:
+	.string	"_wide_data"
+.LASF79:
+	.string	"_lock"
+.LASF19:
+	.string	"__value64"
+.LASF5:
+	.string	"long unsigned int"
+.LASF81:
+	.string	"_codecvt"
+.LASF75:
+	.string	"_old_offset"
+.LASF58:
+	.string	"_IO_FILE"
+.LASF51:
+	.string	"pthread_mutex_t"
+.LASF28:
+	.string	"__lock"
+.LASF39:
+	.string	"__g_refs"
+.LASF2:
+	.string	"unsigned char"
+.LASF9:
+	.string	"__uint32_t"
+.LASF64:
+	.string	"_IO_write_ptr"
+.LASF106:
+	.string	"tail"
+.LASF36:
+	.string	"__pthread_cond_s"
+.LASF43:
+	.string	"__g_signals"
+.LASF37:
+	.string	"__wseq"
+.LASF17:
+	.string	"__low"
+.LASF119:
+	.string	"pthread_cond_destroy"
+.LASF12:
+	.string	"__off_t"
+.LASF6:
+	.string	"signed char"
+.LASF3:
+	.string	"short unsigned int"
+.LASF103:
+	.string	"direct"
+.LASF41:
+	.string	"__g1_orig_size"
+.LASF46:
+	.string	"__align"
+.LASF72:
+	.string	"_chain"
+.LASF88:
+	.string	"FILE"
+.LASF74:
+	.string	"_flags2"
+.LASF126:
+	.string	"posix_memalign"
+.LASF45:
+	.string	"__size"
+.LASF76:
+	.string	"_cur_column"
+.LASF131:
+	.string	"GNU C99 12.2.0 -mtune=generic -march=x86-64 -g -O3 -std=c99 -fasynchronous-unwind-tables"
+.LASF136:
+	.string	"bpipe_reader"
+.LASF13:
+	.string	"__off64_t"
+.LASF87:
+	.string	"_unused2"
+.LASF66:
+	.string	"_IO_buf_base"
+.LASF27:
+	.string	"__pthread_mutex_s"
+.LASF102:
+	.string	"stream"
+	.section	.debug_line_str,"MS",@progbits,1
+.LASF1:
+	.string	"/root/repo"
+.LASF0:
+	.string	"blake2s-pipe.c"
+	.ident	"GCC: (Debian 12.2.0-14+deb12u1) 12.2.0"
+	.section	.note.GNU-stack,"",@progbits
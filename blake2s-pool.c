@@ -0,0 +1,173 @@
+#define _XOPEN_SOURCE 700
+
+#include <pthread.h>
+#include <stdint.h>
+
+#include "blake2s.h"
+#include "blake2s-internal.h"
+
+/* Worker pool
+ *
+ * Worker threads are started on demand and then stay, waiting for the
+ * next job. A job is the tasks [0, n) of one blake2s_pool_run() call,
+ * on the caller's stack, and is queued for as long as the call runs,
+ * so that calls from several threads share the pool. Each participant
+ * of a job, its caller being participant 0, starts with an equal range
+ * of the tasks and takes tasks from its front. One that runs dry
+ * steals the upper half of the largest range left, including those of
+ * participants that never joined, so a job finishes even when every
+ * worker is busy with others, and uneven tasks still keep every thread
+ * busy.
+ *
+ * Tasks are coarse (whole leaves or segments), so a single lock for
+ * all jobs is cheap enough.
+ */
+#define B2S_POOL_MAX 64
+
+struct bpool_range {
+    size_t lo, hi;
+};
+
+struct bpool_job {
+    struct bpool_job *next;
+    void (*fn)(void *arg, size_t i);
+    void *arg;
+    unsigned width;         /* participants it is split for */
+    unsigned joined;        /* participants so far */
+    unsigned active;        /* workers not yet out of the job */
+    size_t queued;          /* tasks not taken */
+    size_t left;            /* tasks not finished */
+    struct bpool_range r[B2S_POOL_MAX];
+};
+
+static struct {
+    pthread_mutex_t lock;   /* guards everything, and all queued jobs */
+    pthread_cond_t work;    /* a new job is queued */
+    pthread_cond_t done;    /* a job may be finished */
+    unsigned nworkers;
+    unsigned wanted;        /* workers the queued jobs could use */
+    struct bpool_job *jobs;
+} bpool = {
+    PTHREAD_MUTEX_INITIALIZER, PTHREAD_COND_INITIALIZER,
+    PTHREAD_COND_INITIALIZER, 0, 0, NULL,
+};
+
+/* bpool_take: next task of participant p; called with the lock held */
+static int bpool_take(struct bpool_job *J, unsigned p, size_t *i)
+{
+    struct bpool_range *r = &J->r[p];
+    if (r->lo == r->hi) {
+        struct bpool_range *v = NULL;
+        size_t most = 0;
+        for (unsigned q = 0; q < J->width; q++) {
+            size_t k = J->r[q].hi - J->r[q].lo;
+            if (k > most) {
+                most = k;
+                v = &J->r[q];
+            }
+        }
+        if (!v)
+            return 0;
+        r->hi = v->hi;
+        v->hi -= (most + 1) / 2;
+        r->lo = v->hi;
+    }
+    *i = r->lo++;
+    J->queued--;
+    return 1;
+}
+
+/* bpool_participate: run tasks of `J` as participant p; called with
+ * the lock held */
+static void bpool_participate(struct bpool_job *J, unsigned p)
+{
+    size_t i;
+    while (bpool_take(J, p, &i)) {
+        pthread_mutex_unlock(&bpool.lock);
+        J->fn(J->arg, i);
+        pthread_mutex_lock(&bpool.lock);
+        if (!--J->left)
+            pthread_cond_broadcast(&bpool.done);
+    }
+}
+
+/* bpool_open: the oldest job with tasks left to take and room for
+ * another participant */
+static struct bpool_job *bpool_open(void)
+{
+    struct bpool_job *J = bpool.jobs;
+    while (J && (J->joined == J->width || !J->queued))
+        J = J->next;
+    return J;
+}
+
+static void *bpool_worker(void *arg)
+{
+    (void)arg;
+    pthread_mutex_lock(&bpool.lock);
+    while (1) {
+        struct bpool_job *J = bpool_open();
+        if (!J) {
+            pthread_cond_wait(&bpool.work, &bpool.lock);
+            continue;
+        }
+        J->active++;
+        bpool_participate(J, J->joined++);
+        if (!--J->active)
+            pthread_cond_broadcast(&bpool.done);
+    }
+    return NULL;
+}
+
+void blake2s_pool_run(unsigned nthreads, size_t n,
+                      void (*fn)(void *arg, size_t i), void *arg)
+{
+    struct bpool_job J, **link;
+
+    if (nthreads > B2S_POOL_MAX)
+        nthreads = B2S_POOL_MAX;
+    if (nthreads > n)
+        nthreads = n;
+    if (nthreads <= 1) {
+        for (size_t i = 0; i < n; i++)
+            fn(arg, i);
+        return;
+    }
+
+    J.fn = fn;
+    J.arg = arg;
+    J.width = nthreads;
+    J.joined = 1;
+    J.active = 0;
+    J.queued = n;
+    J.left = n;
+    for (unsigned p = 0; p < nthreads; p++) {
+        J.r[p].lo = n * p / nthreads;
+        J.r[p].hi = n * (p + 1) / nthreads;
+    }
+
+    pthread_mutex_lock(&bpool.lock);
+    for (link = &bpool.jobs; *link; link = &(*link)->next)
+        ;
+    J.next = NULL;
+    *link = &J;
+    bpool.wanted += nthreads - 1;
+    while (bpool.nworkers < bpool.wanted && bpool.nworkers < B2S_POOL_MAX) {
+        pthread_t t;
+        if (pthread_create(&t, NULL, bpool_worker, NULL))
+            break;
+        pthread_detach(t);
+        bpool.nworkers++;
+    }
+    pthread_cond_broadcast(&bpool.work);
+
+    bpool_participate(&J, 0);
+    while (J.left || J.active)
+        pthread_cond_wait(&bpool.done, &bpool.lock);
+
+    for (link = &bpool.jobs; *link != &J; link = &(*link)->next)
+        ;
+    *link = J.next;
+    bpool.wanted -= nthreads - 1;
+    pthread_mutex_unlock(&bpool.lock);
+}
@@ -0,0 +1,4476 @@
+	.file	"blake2s-pool.c"
+# GNU C99 (Debian 12.2.0-14+deb12u1) version 12.2.0 (x86_64-linux-gnu)
+#	compiled by GNU C version 12.2.0, GMP version 6.2.1, MPFR version 4.2.0, MPC version 1.3.1, isl version isl-0.25-GMP
+
+# GGC heuristics: --param ggc-min-expand=100 --param ggc-min-heapsize=131072
+# options passed: -mtune=generic -march=x86-64 -g -O3 -std=c99 -fasynchronous-unwind-tables
+	.text
+.Ltext0:
+	.file 0 "/root/repo" "blake2s-pool.c"
+	.p2align 4
+	.type	bpool_worker, @function
+bpool_worker:
+.LVL0:
+.LFB21:
+	.file 1 "blake2s-pool.c"
+	.loc 1 105 1 view -0
+	.cfi_startproc
+	.loc 1 106 5 view .LVU1
+	.loc 1 107 5 view .LVU2
+# blake2s-pool.c:105: {
+	.loc 1 105 1 is_stmt 0 view .LVU3
+	pushq	%r15	#
+	.cfi_def_cfa_offset 16
+	.cfi_offset 15, -16
+	pushq	%r14	#
+	.cfi_def_cfa_offset 24
+	.cfi_offset 14, -24
+	pushq	%r13	#
+	.cfi_def_cfa_offset 32
+	.cfi_offset 13, -32
+	pushq	%r12	#
+	.cfi_def_cfa_offset 40
+	.cfi_offset 12, -40
+	pushq	%rbp	#
+	.cfi_def_cfa_offset 48
+	.cfi_offset 6, -48
+# blake2s-pool.c:107:     pthread_mutex_lock(&bpool.lock);
+	.loc 1 107 5 view .LVU4
+	leaq	bpool(%rip), %rbp	#, tmp150
+# blake2s-pool.c:105: {
+	.loc 1 105 1 view .LVU5
+	pushq	%rbx	#
+	.cfi_def_cfa_offset 56
+	.cfi_offset 3, -56
+# blake2s-pool.c:107:     pthread_mutex_lock(&bpool.lock);
+	.loc 1 107 5 view .LVU6
+	movq	%rbp, %rdi	# tmp150,
+.LVL1:
+	.loc 1 107 5 view .LVU7
+	leaq	40(%rbp), %r13	#, tmp151
+	leaq	88(%rbp), %r12	#, tmp148
+# blake2s-pool.c:105: {
+	.loc 1 105 1 view .LVU8
+	subq	$8, %rsp	#,
+	.cfi_def_cfa_offset 64
+# blake2s-pool.c:107:     pthread_mutex_lock(&bpool.lock);
+	.loc 1 107 5 view .LVU9
+	call	pthread_mutex_lock@PLT	#
+.LVL2:
+	.p2align 4,,10
+	.p2align 3
+.L2:
+	.loc 1 108 5 is_stmt 1 view .LVU10
+.LBB15:
+	.loc 1 109 9 view .LVU11
+.LBB16:
+.LBI16:
+	.loc 1 96 26 view .LVU12
+.LBB17:
+	.loc 1 98 5 view .LVU13
+# blake2s-pool.c:98:     struct bpool_job *J = bpool.jobs;
+	.loc 1 98 23 is_stmt 0 view .LVU14
+	movq	144+bpool(%rip), %rbx	# bpool.jobs, J
+.LVL3:
+	.loc 1 99 5 is_stmt 1 view .LVU15
+	.loc 1 99 14 view .LVU16
+	testq	%rbx, %rbx	# J
+	je	.L4	#,
+	.p2align 4,,10
+	.p2align 3
+.L3:
+	.loc 1 99 14 is_stmt 0 view .LVU17
+	movl	24(%rbx), %eax	# J_73->width, tmp156
+	cmpl	%eax, 28(%rbx)	# tmp156, J_73->joined
+	je	.L5	#,
+# blake2s-pool.c:99:     while (J && (J->joined == J->width || !J->queued))
+	.loc 1 99 40 view .LVU18
+	cmpq	$0, 40(%rbx)	#, J_73->queued
+	jne	.L28	#,
+.L5:
+	.loc 1 100 9 is_stmt 1 view .LVU19
+# blake2s-pool.c:100:         J = J->next;
+	.loc 1 100 11 is_stmt 0 view .LVU20
+	movq	(%rbx), %rbx	# J_73->next, J
+.LVL4:
+	.loc 1 99 14 is_stmt 1 view .LVU21
+	testq	%rbx, %rbx	# J
+	jne	.L3	#,
+.L4:
+.LVL5:
+	.loc 1 99 14 is_stmt 0 view .LVU22
+.LBE17:
+.LBE16:
+	.loc 1 111 13 is_stmt 1 discriminator 1 view .LVU23
+	movq	%rbp, %rsi	# tmp150,
+	movq	%r13, %rdi	# tmp151,
+	call	pthread_cond_wait@PLT	#
+.LVL6:
+	.loc 1 112 13 discriminator 1 view .LVU24
+	jmp	.L2	#
+.LVL7:
+	.p2align 4,,10
+	.p2align 3
+.L28:
+.LBB19:
+.LBB18:
+	.loc 1 101 5 view .LVU25
+	.loc 1 101 5 is_stmt 0 view .LVU26
+.LBE18:
+.LBE19:
+	.loc 1 110 9 is_stmt 1 view .LVU27
+	.loc 1 114 9 view .LVU28
+	.loc 1 115 9 view .LVU29
+	movq	.LC0(%rip), %xmm1	#, vect__4.15
+# blake2s-pool.c:115:         bpool_participate(J, J->joined++);
+	.loc 1 115 31 is_stmt 0 view .LVU30
+	movq	28(%rbx), %xmm0	# MEM <vector(2) unsigned int> [(unsigned int *)J_73 + 28B], MEM <vector(2) unsigned int> [(unsigned int *)J_73 + 28B]
+# blake2s-pool.c:115:         bpool_participate(J, J->joined++);
+	.loc 1 115 9 view .LVU31
+	paddd	%xmm0, %xmm1	# MEM <vector(2) unsigned int> [(unsigned int *)J_73 + 28B], vect__4.15
+	movd	%xmm0, %r14d	# MEM <vector(2) unsigned int> [(unsigned int *)J_73 + 28B], _40
+	salq	$4, %r14	#, tmp129
+	addq	%rbx, %r14	# J, _60
+	movq	%xmm1, 28(%rbx)	# vect__4.15, MEM <vector(2) unsigned int> [(unsigned int *)J_73 + 28B]
+.LVL8:
+.LBB20:
+.LBI20:
+	.loc 1 82 13 is_stmt 1 view .LVU32
+.LBB21:
+	.loc 1 84 5 view .LVU33
+	.loc 1 85 5 view .LVU34
+# blake2s-pool.c:85:     while (bpool_take(J, p, &i)) {
+	.loc 1 85 11 is_stmt 0 view .LVU35
+	jmp	.L15	#
+.LVL9:
+	.p2align 4,,10
+	.p2align 3
+.L8:
+.LBB22:
+.LBB23:
+	.loc 1 75 5 is_stmt 1 view .LVU36
+# blake2s-pool.c:75:     *i = r->lo++;
+	.loc 1 75 15 is_stmt 0 view .LVU37
+	leaq	1(%r15), %rax	#, tmp137
+.LBE23:
+.LBE22:
+# blake2s-pool.c:86:         pthread_mutex_unlock(&bpool.lock);
+	.loc 1 86 9 view .LVU38
+	movq	%rbp, %rdi	# tmp150,
+.LBB30:
+.LBB28:
+# blake2s-pool.c:75:     *i = r->lo++;
+	.loc 1 75 15 view .LVU39
+	movq	%rax, 56(%r14)	# tmp137, MEM <size_t> [(struct bpool_range *)_60 + 56B]
+.LVL10:
+	.loc 1 76 5 is_stmt 1 view .LVU40
+# blake2s-pool.c:76:     J->queued--;
+	.loc 1 76 14 is_stmt 0 view .LVU41
+	subq	$1, 40(%rbx)	#, J_73->queued
+	.loc 1 77 5 is_stmt 1 view .LVU42
+.LVL11:
+	.loc 1 77 5 is_stmt 0 view .LVU43
+.LBE28:
+.LBE30:
+	.loc 1 86 9 is_stmt 1 view .LVU44
+	call	pthread_mutex_unlock@PLT	#
+.LVL12:
+	.loc 1 87 9 view .LVU45
+	movq	16(%rbx), %rdi	# J_73->arg, J_73->arg
+	movq	%r15, %rsi	# _30,
+	call	*8(%rbx)	# J_73->fn
+.LVL13:
+	.loc 1 88 9 view .LVU46
+	movq	%rbp, %rdi	# tmp150,
+	call	pthread_mutex_lock@PLT	#
+.LVL14:
+	.loc 1 89 9 view .LVU47
+# blake2s-pool.c:89:         if (!--J->left)
+	.loc 1 89 12 is_stmt 0 view .LVU48
+	subq	$1, 48(%rbx)	#, J_73->left
+	je	.L29	#,
+.LVL15:
+.L15:
+	.loc 1 85 12 is_stmt 1 view .LVU49
+.LBB31:
+.LBI22:
+	.loc 1 56 12 view .LVU50
+.LBB29:
+	.loc 1 58 5 view .LVU51
+	.loc 1 59 5 view .LVU52
+# blake2s-pool.c:59:     if (r->lo == r->hi) {
+	.loc 1 59 10 is_stmt 0 view .LVU53
+	movq	56(%r14), %r15	# MEM <size_t> [(struct bpool_range *)_60 + 56B], _30
+# blake2s-pool.c:59:     if (r->lo == r->hi) {
+	.loc 1 59 8 view .LVU54
+	cmpq	64(%r14), %r15	# MEM <size_t> [(struct bpool_range *)_60 + 64B], _30
+	jne	.L8	#,
+.LVL16:
+.LBB24:
+.LBB25:
+	.loc 1 62 32 is_stmt 1 view .LVU55
+# blake2s-pool.c:62:         for (unsigned q = 0; q < J->width; q++) {
+	.loc 1 62 35 is_stmt 0 view .LVU56
+	movl	24(%rbx), %edi	# J_73->width,
+# blake2s-pool.c:62:         for (unsigned q = 0; q < J->width; q++) {
+	.loc 1 62 32 view .LVU57
+	testl	%edi, %edi	# _64
+	je	.L9	#,
+	leaq	56(%rbx), %rax	#, ivtmp.21
+	salq	$4, %rdi	#, tmp131
+.LBE25:
+# blake2s-pool.c:60:         struct bpool_range *v = NULL;
+	.loc 1 60 29 view .LVU58
+	xorl	%esi, %esi	# v
+# blake2s-pool.c:61:         size_t most = 0;
+	.loc 1 61 16 view .LVU59
+	xorl	%ecx, %ecx	# most
+	addq	%rax, %rdi	# ivtmp.21, _51
+.LVL17:
+	.p2align 4,,10
+	.p2align 3
+.L11:
+.LBB27:
+.LBB26:
+	.loc 1 63 13 is_stmt 1 view .LVU60
+# blake2s-pool.c:63:             size_t k = J->r[q].hi - J->r[q].lo;
+	.loc 1 63 20 is_stmt 0 view .LVU61
+	movq	8(%rax), %rdx	# MEM[(long unsigned int *)_53 + 8B], MEM[(long unsigned int *)_53 + 8B]
+	subq	(%rax), %rdx	# MEM[(long unsigned int *)_53], k
+.LVL18:
+	.loc 1 64 13 is_stmt 1 view .LVU62
+# blake2s-pool.c:64:             if (k > most) {
+	.loc 1 64 16 is_stmt 0 view .LVU63
+	cmpq	%rdx, %rcx	# k, most
+	jnb	.L10	#,
+# blake2s-pool.c:63:             size_t k = J->r[q].hi - J->r[q].lo;
+	.loc 1 63 20 view .LVU64
+	movq	%rdx, %rcx	# k, most
+.LVL19:
+# blake2s-pool.c:66:                 v = &J->r[q];
+	.loc 1 66 19 view .LVU65
+	movq	%rax, %rsi	# ivtmp.21, v
+.LVL20:
+.L10:
+	.loc 1 66 19 view .LVU66
+.LBE26:
+	.loc 1 62 45 is_stmt 1 view .LVU67
+	.loc 1 62 32 view .LVU68
+	addq	$16, %rax	#, ivtmp.21
+.LVL21:
+	.loc 1 62 32 is_stmt 0 view .LVU69
+	cmpq	%rdi, %rax	# _51, ivtmp.21
+	jne	.L11	#,
+.LBE27:
+	.loc 1 69 9 is_stmt 1 view .LVU70
+# blake2s-pool.c:69:         if (!v)
+	.loc 1 69 12 is_stmt 0 view .LVU71
+	testq	%rsi, %rsi	# v
+	je	.L9	#,
+	.loc 1 71 9 is_stmt 1 view .LVU72
+# blake2s-pool.c:71:         r->hi = v->hi;
+	.loc 1 71 18 is_stmt 0 view .LVU73
+	movq	8(%rsi), %r15	# v_89->hi, _41
+# blake2s-pool.c:72:         v->hi -= (most + 1) / 2;
+	.loc 1 72 24 view .LVU74
+	addq	$1, %rcx	#, tmp135
+.LVL22:
+# blake2s-pool.c:72:         v->hi -= (most + 1) / 2;
+	.loc 1 72 29 view .LVU75
+	shrq	%rcx	# tmp136
+.LVL23:
+# blake2s-pool.c:71:         r->hi = v->hi;
+	.loc 1 71 15 view .LVU76
+	movq	%r15, 64(%r14)	# _41, MEM <size_t> [(struct bpool_range *)_60 + 64B]
+	.loc 1 72 9 is_stmt 1 view .LVU77
+# blake2s-pool.c:72:         v->hi -= (most + 1) / 2;
+	.loc 1 72 15 is_stmt 0 view .LVU78
+	subq	%rcx, %r15	# tmp136, _30
+	movq	%r15, 8(%rsi)	# _30, v_89->hi
+	.loc 1 73 9 is_stmt 1 view .LVU79
+	jmp	.L8	#
+.LVL24:
+	.p2align 4,,10
+	.p2align 3
+.L9:
+	.loc 1 73 9 is_stmt 0 view .LVU80
+.LBE24:
+.LBE29:
+.LBE31:
+.LBE21:
+.LBE20:
+	.loc 1 116 9 is_stmt 1 view .LVU81
+# blake2s-pool.c:116:         if (!--J->active)
+	.loc 1 116 12 is_stmt 0 view .LVU82
+	subl	$1, 32(%rbx)	#, J_73->active
+	jne	.L2	#,
+	.loc 1 117 13 is_stmt 1 view .LVU83
+	movq	%r12, %rdi	# tmp148,
+	call	pthread_cond_broadcast@PLT	#
+.LVL25:
+	jmp	.L2	#
+.LVL26:
+	.p2align 4,,10
+	.p2align 3
+.L29:
+.LBB33:
+.LBB32:
+	.loc 1 90 13 view .LVU84
+	movq	%r12, %rdi	# tmp148,
+	call	pthread_cond_broadcast@PLT	#
+.LVL27:
+	jmp	.L15	#
+.LBE32:
+.LBE33:
+.LBE15:
+	.cfi_endproc
+.LFE21:
+	.size	bpool_worker, .-bpool_worker
+	.p2align 4
+	.globl	blake2s_pool_run
+	.type	blake2s_pool_run, @function
+blake2s_pool_run:
+.LVL28:
+.LFB22:
+	.loc 1 124 1 view -0
+	.cfi_startproc
+	.loc 1 125 5 view .LVU86
+	.loc 1 127 5 view .LVU87
+# blake2s-pool.c:124: {
+	.loc 1 124 1 is_stmt 0 view .LVU88
+	pushq	%r15	#
+	.cfi_def_cfa_offset 16
+	.cfi_offset 15, -16
+# blake2s-pool.c:127:     if (nthreads > B2S_POOL_MAX)
+	.loc 1 127 8 view .LVU89
+	movl	$64, %eax	#, tmp223
+# blake2s-pool.c:124: {
+	.loc 1 124 1 view .LVU90
+	pushq	%r14	#
+	.cfi_def_cfa_offset 24
+	.cfi_offset 14, -24
+	pushq	%r13	#
+	.cfi_def_cfa_offset 32
+	.cfi_offset 13, -32
+	movq	%rdx, %r13	# tmp219, fn
+	pushq	%r12	#
+	.cfi_def_cfa_offset 40
+	.cfi_offset 12, -40
+	movq	%rcx, %r12	# tmp220, arg
+	pushq	%rbp	#
+	.cfi_def_cfa_offset 48
+	.cfi_offset 6, -48
+	pushq	%rbx	#
+	.cfi_def_cfa_offset 56
+	.cfi_offset 3, -56
+	movq	%rsi, %rbx	# tmp218, n
+	subq	$1112, %rsp	#,
+	.cfi_def_cfa_offset 1168
+# blake2s-pool.c:127:     if (nthreads > B2S_POOL_MAX)
+	.loc 1 127 8 view .LVU91
+	cmpl	%eax, %edi	# tmp223, tmp217
+	cmovbe	%edi, %eax	# tmp217,, tmp223
+	movl	%eax, %ebp	# tmp223, _10
+.LVL29:
+	.loc 1 129 5 is_stmt 1 view .LVU92
+# blake2s-pool.c:129:     if (nthreads > n)
+	.loc 1 129 18 is_stmt 0 view .LVU93
+	movl	%eax, %eax	# _10, _10
+.LVL30:
+# blake2s-pool.c:130:         nthreads = n;
+	.loc 1 130 18 view .LVU94
+	cmpq	%rax, %rsi	# _10, n
+	cmovb	%esi, %ebp	# n,, _10
+.LVL31:
+	.loc 1 131 5 is_stmt 1 view .LVU95
+# blake2s-pool.c:131:     if (nthreads <= 1) {
+	.loc 1 131 8 is_stmt 0 view .LVU96
+	cmpl	$1, %ebp	#, _10
+	jbe	.L83	#,
+	.loc 1 137 5 is_stmt 1 view .LVU97
+.LBB47:
+# blake2s-pool.c:145:         J.r[p].lo = n * p / nthreads;
+	.loc 1 145 27 is_stmt 0 view .LVU98
+	movl	%ebp, %edi	# _10, _169
+.LBE47:
+# blake2s-pool.c:142:     J.queued = n;
+	.loc 1 142 14 view .LVU99
+	movq	%rsi, %xmm0	# n, tmp152
+# blake2s-pool.c:139:     J.width = nthreads;
+	.loc 1 139 13 view .LVU100
+	movl	%ebp, 40(%rsp)	# _10, J.width
+	leaq	72(%rsp), %r12	#, ivtmp.55
+	movq	%rdi, %r8	# _169, tmp155
+# blake2s-pool.c:137:     J.fn = fn;
+	.loc 1 137 10 view .LVU101
+	movq	%rdx, 24(%rsp)	# fn, J.fn
+	.loc 1 138 5 is_stmt 1 view .LVU102
+# blake2s-pool.c:142:     J.queued = n;
+	.loc 1 142 14 is_stmt 0 view .LVU103
+	punpcklqdq	%xmm0, %xmm0	# tmp152
+.LBB48:
+# blake2s-pool.c:145:         J.r[p].lo = n * p / nthreads;
+	.loc 1 145 27 view .LVU104
+	movq	%r12, %rsi	# ivtmp.55, ivtmp.55
+.LVL32:
+	.loc 1 145 27 view .LVU105
+.LBE48:
+# blake2s-pool.c:140:     J.joined = 1;
+	.loc 1 140 14 view .LVU106
+	movq	$1, 44(%rsp)	#, MEM <unsigned long> [(unsigned int *)&J + 28B]
+	salq	$4, %r8	#, tmp155
+# blake2s-pool.c:138:     J.arg = arg;
+	.loc 1 138 11 view .LVU107
+	movq	%rcx, 32(%rsp)	# arg, J.arg
+	.loc 1 139 5 is_stmt 1 view .LVU108
+	.loc 1 140 5 view .LVU109
+	.loc 1 141 5 view .LVU110
+	.loc 1 142 5 view .LVU111
+	.loc 1 143 5 view .LVU112
+	addq	%r12, %r8	# ivtmp.55, _171
+.LBB49:
+# blake2s-pool.c:145:         J.r[p].lo = n * p / nthreads;
+	.loc 1 145 27 is_stmt 0 view .LVU113
+	xorl	%ecx, %ecx	# ivtmp.54
+.LVL33:
+	.loc 1 145 27 view .LVU114
+.LBE49:
+# blake2s-pool.c:142:     J.queued = n;
+	.loc 1 142 14 view .LVU115
+	movups	%xmm0, 56(%rsp)	# tmp152, MEM <vector(2) long unsigned int> [(long unsigned int *)&J + 40B]
+	.loc 1 144 5 is_stmt 1 view .LVU116
+.LBB50:
+	.loc 1 144 10 view .LVU117
+.LVL34:
+	.loc 1 144 28 view .LVU118
+	.p2align 4,,10
+	.p2align 3
+.L36:
+	.loc 1 145 9 discriminator 3 view .LVU119
+# blake2s-pool.c:145:         J.r[p].lo = n * p / nthreads;
+	.loc 1 145 27 is_stmt 0 discriminator 3 view .LVU120
+	movq	%rcx, %rax	# ivtmp.54, tmp156
+	xorl	%edx, %edx	# tmp157
+# blake2s-pool.c:146:         J.r[p].hi = n * (p + 1) / nthreads;
+	.loc 1 146 23 discriminator 3 view .LVU121
+	addq	%rbx, %rcx	# n, ivtmp.54
+# blake2s-pool.c:144:     for (unsigned p = 0; p < nthreads; p++) {
+	.loc 1 144 28 discriminator 3 view .LVU122
+	addq	$16, %rsi	#, ivtmp.55
+.LVL35:
+# blake2s-pool.c:145:         J.r[p].lo = n * p / nthreads;
+	.loc 1 145 27 discriminator 3 view .LVU123
+	divq	%rdi	# _169
+# blake2s-pool.c:146:         J.r[p].hi = n * (p + 1) / nthreads;
+	.loc 1 146 33 discriminator 3 view .LVU124
+	xorl	%edx, %edx	# tmp159
+# blake2s-pool.c:145:         J.r[p].lo = n * p / nthreads;
+	.loc 1 145 19 discriminator 3 view .LVU125
+	movq	%rax, -16(%rsi)	# tmp156, MEM[(long unsigned int *)_176]
+	.loc 1 146 9 is_stmt 1 discriminator 3 view .LVU126
+# blake2s-pool.c:146:         J.r[p].hi = n * (p + 1) / nthreads;
+	.loc 1 146 33 is_stmt 0 discriminator 3 view .LVU127
+	movq	%rcx, %rax	# ivtmp.54, tmp158
+	divq	%rdi	# _169
+# blake2s-pool.c:146:         J.r[p].hi = n * (p + 1) / nthreads;
+	.loc 1 146 19 discriminator 3 view .LVU128
+	movq	%rax, -8(%rsi)	# tmp158, MEM[(long unsigned int *)_176 + 8B]
+	.loc 1 144 41 is_stmt 1 discriminator 3 view .LVU129
+.LVL36:
+	.loc 1 144 28 discriminator 3 view .LVU130
+	cmpq	%r8, %rsi	# _171, ivtmp.55
+	jne	.L36	#,
+.LBE50:
+	.loc 1 149 5 view .LVU131
+	leaq	bpool(%rip), %rbx	#, tmp210
+.LVL37:
+	.loc 1 149 5 is_stmt 0 view .LVU132
+	movq	%rbx, %rdi	# tmp210,
+	call	pthread_mutex_lock@PLT	#
+.LVL38:
+	.loc 1 150 5 is_stmt 1 view .LVU133
+# blake2s-pool.c:150:     for (link = &bpool.jobs; *link; link = &(*link)->next)
+	.loc 1 150 15 is_stmt 0 view .LVU134
+	movq	144+bpool(%rip), %rax	# MEM[(struct bpool_job * *)&bpool + 144B], _78
+	.loc 1 150 30 is_stmt 1 view .LVU135
+# blake2s-pool.c:150:     for (link = &bpool.jobs; *link; link = &(*link)->next)
+	.loc 1 150 15 is_stmt 0 view .LVU136
+	leaq	144(%rbx), %rdx	#, link
+# blake2s-pool.c:150:     for (link = &bpool.jobs; *link; link = &(*link)->next)
+	.loc 1 150 30 view .LVU137
+	testq	%rax, %rax	# _78
+	je	.L37	#,
+.LVL39:
+	.p2align 4,,10
+	.p2align 3
+.L38:
+	.loc 1 150 42 is_stmt 1 discriminator 3 view .LVU138
+	.loc 1 150 42 is_stmt 0 discriminator 3 view .LVU139
+	movq	%rax, %rdx	# _78, _85
+	movq	(%rax), %rax	# MEM[(struct bpool_job * *)_131], _78
+.LVL40:
+	.loc 1 150 30 is_stmt 1 discriminator 3 view .LVU140
+	testq	%rax, %rax	# _78
+	jne	.L38	#,
+.LVL41:
+.L37:
+	.loc 1 152 5 view .LVU141
+# blake2s-pool.c:154:     bpool.wanted += nthreads - 1;
+	.loc 1 154 18 is_stmt 0 view .LVU142
+	movl	140+bpool(%rip), %eax	# bpool.wanted, bpool.wanted
+# blake2s-pool.c:153:     *link = &J;
+	.loc 1 153 11 view .LVU143
+	leaq	16(%rsp), %r13	#, tmp209
+.LVL42:
+# blake2s-pool.c:152:     J.next = NULL;
+	.loc 1 152 12 view .LVU144
+	movq	$0, 16(%rsp)	#, J.next
+	.loc 1 153 5 is_stmt 1 view .LVU145
+# blake2s-pool.c:153:     *link = &J;
+	.loc 1 153 11 is_stmt 0 view .LVU146
+	movq	%r13, (%rdx)	# tmp209, *link_133
+	.loc 1 154 5 is_stmt 1 view .LVU147
+# blake2s-pool.c:154:     bpool.wanted += nthreads - 1;
+	.loc 1 154 18 is_stmt 0 view .LVU148
+	leal	-1(%rbp,%rax), %edx	#, _14
+# blake2s-pool.c:155:     while (bpool.nworkers < bpool.wanted && bpool.nworkers < B2S_POOL_MAX) {
+	.loc 1 155 17 view .LVU149
+	movl	136+bpool(%rip), %eax	# bpool.nworkers, _140
+# blake2s-pool.c:154:     bpool.wanted += nthreads - 1;
+	.loc 1 154 18 view .LVU150
+	movl	%edx, 140+bpool(%rip)	# _14, bpool.wanted
+	.loc 1 155 5 is_stmt 1 view .LVU151
+	.loc 1 155 42 view .LVU152
+	cmpl	%edx, %eax	# _14, _140
+	jnb	.L41	#,
+	leaq	8(%rsp), %r15	#, tmp208
+	leaq	bpool_worker(%rip), %r14	#, tmp207
+	jmp	.L82	#
+	.p2align 4,,10
+	.p2align 3
+.L84:
+.LBB51:
+	.loc 1 156 9 view .LVU153
+	.loc 1 157 9 view .LVU154
+# blake2s-pool.c:157:         if (pthread_create(&t, NULL, bpool_worker, NULL))
+	.loc 1 157 13 is_stmt 0 view .LVU155
+	xorl	%ecx, %ecx	#
+	xorl	%esi, %esi	#
+	movq	%r14, %rdx	# tmp207,
+	movq	%r15, %rdi	# tmp208,
+	call	pthread_create@PLT	#
+.LVL43:
+# blake2s-pool.c:157:         if (pthread_create(&t, NULL, bpool_worker, NULL))
+	.loc 1 157 12 view .LVU156
+	testl	%eax, %eax	# tmp221
+	jne	.L41	#,
+	.loc 1 159 9 is_stmt 1 view .LVU157
+	movq	8(%rsp), %rdi	# t,
+	call	pthread_detach@PLT	#
+.LVL44:
+	.loc 1 160 9 view .LVU158
+# blake2s-pool.c:160:         bpool.nworkers++;
+	.loc 1 160 23 is_stmt 0 view .LVU159
+	movl	136+bpool(%rip), %eax	# bpool.nworkers, tmp230
+	addl	$1, %eax	#, _18
+.LBE51:
+# blake2s-pool.c:155:     while (bpool.nworkers < bpool.wanted && bpool.nworkers < B2S_POOL_MAX) {
+	.loc 1 155 42 view .LVU160
+	cmpl	140+bpool(%rip), %eax	# bpool.wanted, _18
+.LBB52:
+# blake2s-pool.c:160:         bpool.nworkers++;
+	.loc 1 160 23 view .LVU161
+	movl	%eax, 136+bpool(%rip)	# _18, bpool.nworkers
+.LBE52:
+	.loc 1 155 42 is_stmt 1 view .LVU162
+	jnb	.L41	#,
+.L82:
+	cmpl	$63, %eax	#, _140
+	jbe	.L84	#,
+.L41:
+	.loc 1 162 5 view .LVU163
+	leaq	40+bpool(%rip), %rdi	#, tmp183
+	call	pthread_cond_broadcast@PLT	#
+.LVL45:
+	.loc 1 164 5 view .LVU164
+.LBB53:
+.LBI53:
+	.loc 1 82 13 view .LVU165
+	.loc 1 82 13 is_stmt 0 view .LVU166
+	jmp	.L51	#
+.LVL46:
+	.p2align 4,,10
+	.p2align 3
+.L46:
+.LBB54:
+.LBB55:
+.LBB56:
+	.loc 1 75 5 is_stmt 1 view .LVU167
+# blake2s-pool.c:75:     *i = r->lo++;
+	.loc 1 75 15 is_stmt 0 view .LVU168
+	leaq	1(%r14), %rax	#, tmp190
+.LBE56:
+.LBE55:
+# blake2s-pool.c:86:         pthread_mutex_unlock(&bpool.lock);
+	.loc 1 86 9 view .LVU169
+	movq	%rbx, %rdi	# tmp210,
+.LBB63:
+.LBB61:
+# blake2s-pool.c:76:     J->queued--;
+	.loc 1 76 14 view .LVU170
+	subq	$1, 56(%rsp)	#, J.queued
+# blake2s-pool.c:75:     *i = r->lo++;
+	.loc 1 75 15 view .LVU171
+	movq	%rax, 72(%rsp)	# tmp190, MEM <struct bpool_job> [(struct bpool_range *)&J].r[0].lo
+.LVL47:
+	.loc 1 76 5 is_stmt 1 view .LVU172
+	.loc 1 77 5 view .LVU173
+	.loc 1 77 5 is_stmt 0 view .LVU174
+.LBE61:
+.LBE63:
+	.loc 1 86 9 is_stmt 1 view .LVU175
+	call	pthread_mutex_unlock@PLT	#
+.LVL48:
+	.loc 1 87 9 view .LVU176
+	movq	32(%rsp), %rdi	# J.arg,
+	movq	%r14, %rsi	# _83,
+	call	*24(%rsp)	# J.fn
+.LVL49:
+	.loc 1 88 9 view .LVU177
+	movq	%rbx, %rdi	# tmp210,
+	call	pthread_mutex_lock@PLT	#
+.LVL50:
+	.loc 1 89 9 view .LVU178
+# blake2s-pool.c:89:         if (!--J->left)
+	.loc 1 89 12 is_stmt 0 view .LVU179
+	subq	$1, 64(%rsp)	#, J.left
+	je	.L85	#,
+.LVL51:
+.L51:
+	.loc 1 85 12 is_stmt 1 view .LVU180
+.LBB64:
+.LBI55:
+	.loc 1 56 12 view .LVU181
+.LBB62:
+	.loc 1 58 5 view .LVU182
+	.loc 1 59 5 view .LVU183
+# blake2s-pool.c:59:     if (r->lo == r->hi) {
+	.loc 1 59 10 is_stmt 0 view .LVU184
+	movq	72(%rsp), %r14	# MEM <struct bpool_job> [(struct bpool_range *)&J].r[0].lo, _83
+# blake2s-pool.c:59:     if (r->lo == r->hi) {
+	.loc 1 59 8 view .LVU185
+	cmpq	80(%rsp), %r14	# MEM <struct bpool_job> [(struct bpool_range *)&J].r[0].hi, _83
+	jne	.L46	#,
+.LVL52:
+.LBB57:
+.LBB58:
+	.loc 1 62 32 is_stmt 1 view .LVU186
+# blake2s-pool.c:62:         for (unsigned q = 0; q < J->width; q++) {
+	.loc 1 62 35 is_stmt 0 view .LVU187
+	movl	40(%rsp), %esi	# J.width,
+# blake2s-pool.c:62:         for (unsigned q = 0; q < J->width; q++) {
+	.loc 1 62 32 view .LVU188
+	testl	%esi, %esi	# _129
+	je	.L47	#,
+	salq	$4, %rsi	#, tmp186
+	movq	%r12, %rax	# ivtmp.55, ivtmp.45
+.LBE58:
+# blake2s-pool.c:60:         struct bpool_range *v = NULL;
+	.loc 1 60 29 view .LVU189
+	xorl	%edi, %edi	# v
+# blake2s-pool.c:61:         size_t most = 0;
+	.loc 1 61 16 view .LVU190
+	xorl	%ecx, %ecx	# most
+	addq	%r12, %rsi	# ivtmp.55, _28
+.LVL53:
+	.p2align 4,,10
+	.p2align 3
+.L49:
+.LBB60:
+.LBB59:
+	.loc 1 63 13 is_stmt 1 view .LVU191
+# blake2s-pool.c:63:             size_t k = J->r[q].hi - J->r[q].lo;
+	.loc 1 63 20 is_stmt 0 view .LVU192
+	movq	8(%rax), %rdx	# MEM[(long unsigned int *)_11 + 8B], MEM[(long unsigned int *)_11 + 8B]
+	subq	(%rax), %rdx	# MEM[(long unsigned int *)_11], k
+.LVL54:
+	.loc 1 64 13 is_stmt 1 view .LVU193
+# blake2s-pool.c:64:             if (k > most) {
+	.loc 1 64 16 is_stmt 0 view .LVU194
+	cmpq	%rdx, %rcx	# k, most
+	jnb	.L48	#,
+# blake2s-pool.c:63:             size_t k = J->r[q].hi - J->r[q].lo;
+	.loc 1 63 20 view .LVU195
+	movq	%rdx, %rcx	# k, most
+.LVL55:
+# blake2s-pool.c:66:                 v = &J->r[q];
+	.loc 1 66 19 view .LVU196
+	movq	%rax, %rdi	# ivtmp.45, v
+.LVL56:
+.L48:
+	.loc 1 66 19 view .LVU197
+.LBE59:
+	.loc 1 62 45 is_stmt 1 view .LVU198
+	.loc 1 62 32 view .LVU199
+	addq	$16, %rax	#, ivtmp.45
+.LVL57:
+	.loc 1 62 32 is_stmt 0 view .LVU200
+	cmpq	%rax, %rsi	# ivtmp.45, _28
+	jne	.L49	#,
+.LBE60:
+	.loc 1 69 9 is_stmt 1 view .LVU201
+# blake2s-pool.c:69:         if (!v)
+	.loc 1 69 12 is_stmt 0 view .LVU202
+	testq	%rdi, %rdi	# v
+	je	.L47	#,
+	.loc 1 71 9 is_stmt 1 view .LVU203
+# blake2s-pool.c:71:         r->hi = v->hi;
+	.loc 1 71 18 is_stmt 0 view .LVU204
+	movq	8(%rdi), %r14	# v_185->hi, _94
+# blake2s-pool.c:72:         v->hi -= (most + 1) / 2;
+	.loc 1 72 24 view .LVU205
+	addq	$1, %rcx	#, tmp188
+.LVL58:
+# blake2s-pool.c:72:         v->hi -= (most + 1) / 2;
+	.loc 1 72 29 view .LVU206
+	shrq	%rcx	# tmp189
+.LVL59:
+# blake2s-pool.c:71:         r->hi = v->hi;
+	.loc 1 71 15 view .LVU207
+	movq	%r14, 80(%rsp)	# _94, MEM <struct bpool_job> [(struct bpool_range *)&J].r[0].hi
+	.loc 1 72 9 is_stmt 1 view .LVU208
+# blake2s-pool.c:72:         v->hi -= (most + 1) / 2;
+	.loc 1 72 15 is_stmt 0 view .LVU209
+	subq	%rcx, %r14	# tmp189, _83
+	movq	%r14, 8(%rdi)	# _83, v_185->hi
+	.loc 1 73 9 is_stmt 1 view .LVU210
+	jmp	.L46	#
+.LVL60:
+	.p2align 4,,10
+	.p2align 3
+.L47:
+	.loc 1 73 9 is_stmt 0 view .LVU211
+.LBE57:
+.LBE62:
+.LBE64:
+.LBE54:
+.LBE53:
+# blake2s-pool.c:166:         pthread_cond_wait(&bpool.done, &bpool.lock);
+	.loc 1 166 9 view .LVU212
+	leaq	88+bpool(%rip), %r12	#, tmp215
+.LVL61:
+	.loc 1 166 9 view .LVU213
+	jmp	.L52	#
+.LVL62:
+	.p2align 4,,10
+	.p2align 3
+.L53:
+	.loc 1 166 9 is_stmt 1 view .LVU214
+	movq	%rbx, %rsi	# tmp210,
+	movq	%r12, %rdi	# tmp215,
+	call	pthread_cond_wait@PLT	#
+.LVL63:
+.L52:
+	.loc 1 165 19 view .LVU215
+	cmpq	$0, 64(%rsp)	#, J.left
+	jne	.L53	#,
+# blake2s-pool.c:165:     while (J.left || J.active)
+	.loc 1 165 19 is_stmt 0 discriminator 1 view .LVU216
+	movl	48(%rsp), %eax	# J.active,
+	testl	%eax, %eax	#
+	jne	.L53	#,
+# blake2s-pool.c:168:     for (link = &bpool.jobs; *link != &J; link = &(*link)->next)
+	.loc 1 168 15 view .LVU217
+	movq	144+bpool(%rip), %rax	# MEM[(struct bpool_job * *)&bpool + 144B], _115
+.LVL64:
+	.loc 1 168 36 is_stmt 1 view .LVU218
+# blake2s-pool.c:168:     for (link = &bpool.jobs; *link != &J; link = &(*link)->next)
+	.loc 1 168 15 is_stmt 0 view .LVU219
+	leaq	144+bpool(%rip), %rdx	#, link
+.LVL65:
+# blake2s-pool.c:168:     for (link = &bpool.jobs; *link != &J; link = &(*link)->next)
+	.loc 1 168 36 view .LVU220
+	cmpq	%r13, %rax	# tmp209, _115
+	je	.L54	#,
+.LVL66:
+	.p2align 4,,10
+	.p2align 3
+.L55:
+	.loc 1 168 48 is_stmt 1 discriminator 3 view .LVU221
+	.loc 1 168 48 is_stmt 0 discriminator 3 view .LVU222
+	movq	%rax, %rdx	# _115, _198
+	movq	(%rax), %rax	# MEM[(struct bpool_job * *)_130], _115
+.LVL67:
+	.loc 1 168 36 is_stmt 1 discriminator 3 view .LVU223
+	cmpq	%r13, %rax	# tmp209, _115
+	jne	.L55	#,
+.LVL68:
+.L54:
+	.loc 1 170 5 view .LVU224
+# blake2s-pool.c:170:     *link = J.next;
+	.loc 1 170 14 is_stmt 0 view .LVU225
+	movq	16(%rsp), %rax	# J.next, _26
+# blake2s-pool.c:172:     pthread_mutex_unlock(&bpool.lock);
+	.loc 1 172 5 view .LVU226
+	movq	%rbx, %rdi	# tmp210,
+# blake2s-pool.c:170:     *link = J.next;
+	.loc 1 170 11 view .LVU227
+	movq	%rax, (%rdx)	# _26, *link_135
+	.loc 1 171 5 is_stmt 1 view .LVU228
+# blake2s-pool.c:171:     bpool.wanted -= nthreads - 1;
+	.loc 1 171 18 is_stmt 0 view .LVU229
+	movl	140+bpool(%rip), %eax	# bpool.wanted, tmp232
+	addl	$1, %eax	#, tmp203
+	subl	%ebp, %eax	# _10, tmp205
+	movl	%eax, 140+bpool(%rip)	# tmp205, bpool.wanted
+	.loc 1 172 5 is_stmt 1 view .LVU230
+	call	pthread_mutex_unlock@PLT	#
+.LVL69:
+.L30:
+# blake2s-pool.c:173: }
+	.loc 1 173 1 is_stmt 0 view .LVU231
+	addq	$1112, %rsp	#,
+	.cfi_remember_state
+	.cfi_def_cfa_offset 56
+	popq	%rbx	#
+	.cfi_def_cfa_offset 48
+	popq	%rbp	#
+	.cfi_def_cfa_offset 40
+	popq	%r12	#
+	.cfi_def_cfa_offset 32
+	popq	%r13	#
+	.cfi_def_cfa_offset 24
+	popq	%r14	#
+	.cfi_def_cfa_offset 16
+	popq	%r15	#
+	.cfi_def_cfa_offset 8
+	ret	
+.LVL70:
+	.p2align 4,,10
+	.p2align 3
+.L85:
+	.cfi_restore_state
+.LBB66:
+.LBB65:
+	.loc 1 90 13 is_stmt 1 view .LVU232
+	leaq	88+bpool(%rip), %rdi	#, tmp184
+	call	pthread_cond_broadcast@PLT	#
+.LVL71:
+	.loc 1 90 13 is_stmt 0 view .LVU233
+	jmp	.L51	#
+.LVL72:
+.L83:
+	.loc 1 90 13 view .LVU234
+.LBE65:
+.LBE66:
+.LBB67:
+	.loc 1 132 30 is_stmt 1 view .LVU235
+# blake2s-pool.c:132:         for (size_t i = 0; i < n; i++)
+	.loc 1 132 21 is_stmt 0 view .LVU236
+	xorl	%ebp, %ebp	# i
+.LVL73:
+# blake2s-pool.c:132:         for (size_t i = 0; i < n; i++)
+	.loc 1 132 30 view .LVU237
+	testq	%rsi, %rsi	# n
+	je	.L30	#,
+.LVL74:
+	.p2align 4,,10
+	.p2align 3
+.L33:
+	.loc 1 133 13 is_stmt 1 discriminator 3 view .LVU238
+	movq	%rbp, %rsi	# i,
+# blake2s-pool.c:132:         for (size_t i = 0; i < n; i++)
+	.loc 1 132 36 is_stmt 0 discriminator 3 view .LVU239
+	addq	$1, %rbp	#, i
+.LVL75:
+# blake2s-pool.c:133:             fn(arg, i);
+	.loc 1 133 13 discriminator 3 view .LVU240
+	movq	%r12, %rdi	# arg,
+	call	*%r13	# fn
+.LVL76:
+	.loc 1 132 36 is_stmt 1 discriminator 3 view .LVU241
+	.loc 1 132 30 discriminator 3 view .LVU242
+	cmpq	%rbp, %rbx	# i, n
+	jne	.L33	#,
+	jmp	.L30	#
+.LBE67:
+	.cfi_endproc
+.LFE22:
+	.size	blake2s_pool_run, .-blake2s_pool_run
+	.local	bpool
+	.comm	bpool,152,32
+	.section	.rodata.cst8,"aM",@progbits,8
+	.align 8
+.LC0:
+	.long	1
+	.long	1
+	.text
+.Letext0:
+	.file 2 "/usr/include/x86_64-linux-gnu/bits/types.h"
+	.file 3 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stddef.h"
+	.file 4 "/usr/include/x86_64-linux-gnu/bits/atomic_wide_counter.h"
+	.file 5 "/usr/include/x86_64-linux-gnu/bits/thread-shared-types.h"
+	.file 6 "/usr/include/x86_64-linux-gnu/bits/struct_mutex.h"
+	.file 7 "/usr/include/x86_64-linux-gnu/bits/pthreadtypes.h"
+	.file 8 "/usr/include/x86_64-linux-gnu/bits/stdint-uintn.h"
+	.file 9 "blake2s-internal.h"
+	.file 10 "/usr/include/pthread.h"
+	.section	.debug_info,"",@progbits
+.Ldebug_info0:
+	.long	0xc35
+	.value	0x5
+	.byte	0x1
+	.byte	0x8
+	.long	.Ldebug_abbrev0
+	.uleb128 0x28
+	.long	.LASF86
+	.byte	0xc
+	.long	.LASF0
+	.long	.LASF1
+	.quad	.Ltext0
+	.quad	.Letext0-.Ltext0
+	.long	.Ldebug_line0
+	.uleb128 0x6
+	.byte	0x1
+	.byte	0x8
+	.long	.LASF2
+	.uleb128 0x6
+	.byte	0x2
+	.byte	0x7
+	.long	.LASF3
+	.uleb128 0x6
+	.byte	0x4
+	.byte	0x7
+	.long	.LASF4
+	.uleb128 0x6
+	.byte	0x8
+	.byte	0x7
+	.long	.LASF5
+	.uleb128 0x6
+	.byte	0x1
+	.byte	0x6
+	.long	.LASF6
+	.uleb128 0x4
+	.long	.LASF8
+	.byte	0x2
+	.byte	0x26
+	.byte	0x17
+	.long	0x2e
+	.uleb128 0x6
+	.byte	0x2
+	.byte	0x5
+	.long	.LASF7
+	.uleb128 0x29
+	.byte	0x4
+	.byte	0x5
+	.string	"int"
+	.uleb128 0x4
+	.long	.LASF9
+	.byte	0x2
+	.byte	0x2a
+	.byte	0x16
+	.long	0x3c
+	.uleb128 0x6
+	.byte	0x8
+	.byte	0x5
+	.long	.LASF10
+	.uleb128 0x2a
+	.byte	0x8
+	.uleb128 0xf
+	.long	0x7e
+	.uleb128 0x6
+	.byte	0x1
+	.byte	0x6
+	.long	.LASF11
+	.uleb128 0x4
+	.long	.LASF12
+	.byte	0x3
+	.byte	0xd6
+	.byte	0x1b
+	.long	0x43
+	.uleb128 0x1e
+	.byte	0x8
+	.byte	0x4
+	.byte	0x1c
+	.byte	0x3
+	.long	0xbc
+	.uleb128 0x1
+	.long	.LASF13
+	.byte	0x4
+	.byte	0x1e
+	.byte	0x12
+	.long	0x3c
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF14
+	.byte	0x4
+	.byte	0x1f
+	.byte	0x12
+	.long	0x3c
+	.byte	0x4
+	.byte	0
+	.uleb128 0x1a
+	.byte	0x8
+	.byte	0x4
+	.byte	0x19
+	.long	0xdd
+	.uleb128 0x7
+	.long	.LASF15
+	.byte	0x4
+	.byte	0x1b
+	.byte	0x28
+	.long	0xdd
+	.uleb128 0x7
+	.long	.LASF16
+	.byte	0x4
+	.byte	0x20
+	.byte	0x5
+	.long	0x98
+	.byte	0
+	.uleb128 0x6
+	.byte	0x8
+	.byte	0x7
+	.long	.LASF17
+	.uleb128 0x4
+	.long	.LASF18
+	.byte	0x4
+	.byte	0x21
+	.byte	0x3
+	.long	0xbc
+	.uleb128 0x17
+	.long	.LASF22
+	.byte	0x10
+	.byte	0x5
+	.byte	0x33
+	.byte	0x10
+	.long	0x118
+	.uleb128 0x1
+	.long	.LASF19
+	.byte	0x5
+	.byte	0x35
+	.byte	0x23
+	.long	0x118
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF20
+	.byte	0x5
+	.byte	0x36
+	.byte	0x23
+	.long	0x118
+	.byte	0x8
+	.byte	0
+	.uleb128 0x5
+	.long	0xf0
+	.uleb128 0x4
+	.long	.LASF21
+	.byte	0x5
+	.byte	0x37
+	.byte	0x3
+	.long	0xf0
+	.uleb128 0x17
+	.long	.LASF23
+	.byte	0x28
+	.byte	0x6
+	.byte	0x16
+	.byte	0x8
+	.long	0x19f
+	.uleb128 0x1
+	.long	.LASF24
+	.byte	0x6
+	.byte	0x18
+	.byte	0x7
+	.long	0x64
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF25
+	.byte	0x6
+	.byte	0x19
+	.byte	0x10
+	.long	0x3c
+	.byte	0x4
+	.uleb128 0x1
+	.long	.LASF26
+	.byte	0x6
+	.byte	0x1a
+	.byte	0x7
+	.long	0x64
+	.byte	0x8
+	.uleb128 0x1
+	.long	.LASF27
+	.byte	0x6
+	.byte	0x1c
+	.byte	0x10
+	.long	0x3c
+	.byte	0xc
+	.uleb128 0x1
+	.long	.LASF28
+	.byte	0x6
+	.byte	0x20
+	.byte	0x7
+	.long	0x64
+	.byte	0x10
+	.uleb128 0x1
+	.long	.LASF29
+	.byte	0x6
+	.byte	0x22
+	.byte	0x9
+	.long	0x5d
+	.byte	0x14
+	.uleb128 0x1
+	.long	.LASF30
+	.byte	0x6
+	.byte	0x23
+	.byte	0x9
+	.long	0x5d
+	.byte	0x16
+	.uleb128 0x1
+	.long	.LASF31
+	.byte	0x6
+	.byte	0x24
+	.byte	0x14
+	.long	0x11d
+	.byte	0x18
+	.byte	0
+	.uleb128 0x17
+	.long	.LASF32
+	.byte	0x30
+	.byte	0x5
+	.byte	0x5e
+	.byte	0x8
+	.long	0x208
+	.uleb128 0x1
+	.long	.LASF33
+	.byte	0x5
+	.byte	0x60
+	.byte	0x19
+	.long	0xe4
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF34
+	.byte	0x5
+	.byte	0x61
+	.byte	0x19
+	.long	0xe4
+	.byte	0x8
+	.uleb128 0x1
+	.long	.LASF35
+	.byte	0x5
+	.byte	0x62
+	.byte	0x10
+	.long	0x208
+	.byte	0x10
+	.uleb128 0x1
+	.long	.LASF36
+	.byte	0x5
+	.byte	0x63
+	.byte	0x10
+	.long	0x208
+	.byte	0x18
+	.uleb128 0x1
+	.long	.LASF37
+	.byte	0x5
+	.byte	0x64
+	.byte	0x10
+	.long	0x3c
+	.byte	0x20
+	.uleb128 0x1
+	.long	.LASF38
+	.byte	0x5
+	.byte	0x65
+	.byte	0x10
+	.long	0x3c
+	.byte	0x24
+	.uleb128 0x1
+	.long	.LASF39
+	.byte	0x5
+	.byte	0x66
+	.byte	0x10
+	.long	0x208
+	.byte	0x28
+	.byte	0
+	.uleb128 0xd
+	.long	0x3c
+	.long	0x218
+	.uleb128 0xa
+	.long	0x43
+	.byte	0x1
+	.byte	0
+	.uleb128 0x4
+	.long	.LASF40
+	.byte	0x7
+	.byte	0x1b
+	.byte	0x1b
+	.long	0x43
+	.uleb128 0x2b
+	.long	.LASF43
+	.byte	0x38
+	.byte	0x7
+	.byte	0x38
+	.byte	0x7
+	.long	0x24a
+	.uleb128 0x7
+	.long	.LASF41
+	.byte	0x7
+	.byte	0x3a
+	.byte	0x8
+	.long	0x24a
+	.uleb128 0x7
+	.long	.LASF42
+	.byte	0x7
+	.byte	0x3b
+	.byte	0xc
+	.long	0x77
+	.byte	0
+	.uleb128 0xd
+	.long	0x85
+	.long	0x25a
+	.uleb128 0xa
+	.long	0x43
+	.byte	0x37
+	.byte	0
+	.uleb128 0x4
+	.long	.LASF43
+	.byte	0x7
+	.byte	0x3e
+	.byte	0x1e
+	.long	0x224
+	.uleb128 0x10
+	.long	0x25a
+	.uleb128 0x1a
+	.byte	0x28
+	.byte	0x7
+	.byte	0x43
+	.long	0x298
+	.uleb128 0x7
+	.long	.LASF44
+	.byte	0x7
+	.byte	0x45
+	.byte	0x1c
+	.long	0x129
+	.uleb128 0x7
+	.long	.LASF41
+	.byte	0x7
+	.byte	0x46
+	.byte	0x8
+	.long	0x298
+	.uleb128 0x7
+	.long	.LASF42
+	.byte	0x7
+	.byte	0x47
+	.byte	0xc
+	.long	0x77
+	.byte	0
+	.uleb128 0xd
+	.long	0x85
+	.long	0x2a8
+	.uleb128 0xa
+	.long	0x43
+	.byte	0x27
+	.byte	0
+	.uleb128 0x4
+	.long	.LASF45
+	.byte	0x7
+	.byte	0x48
+	.byte	0x3
+	.long	0x26b
+	.uleb128 0x1a
+	.byte	0x30
+	.byte	0x7
+	.byte	0x4b
+	.long	0x2e1
+	.uleb128 0x7
+	.long	.LASF44
+	.byte	0x7
+	.byte	0x4d
+	.byte	0x1b
+	.long	0x19f
+	.uleb128 0x7
+	.long	.LASF41
+	.byte	0x7
+	.byte	0x4e
+	.byte	0x8
+	.long	0x2e1
+	.uleb128 0x7
+	.long	.LASF42
+	.byte	0x7
+	.byte	0x4f
+	.byte	0x1f
+	.long	0x2f1
+	.byte	0
+	.uleb128 0xd
+	.long	0x85
+	.long	0x2f1
+	.uleb128 0xa
+	.long	0x43
+	.byte	0x2f
+	.byte	0
+	.uleb128 0x6
+	.byte	0x8
+	.byte	0x5
+	.long	.LASF46
+	.uleb128 0x4
+	.long	.LASF47
+	.byte	0x7
+	.byte	0x50
+	.byte	0x3
+	.long	0x2b4
+	.uleb128 0x2c
+	.byte	0x7
+	.byte	0x4
+	.long	0x3c
+	.byte	0xa
+	.byte	0x30
+	.byte	0x1
+	.long	0x343
+	.uleb128 0xb
+	.long	.LASF48
+	.byte	0
+	.uleb128 0xb
+	.long	.LASF49
+	.byte	0x1
+	.uleb128 0xb
+	.long	.LASF50
+	.byte	0x2
+	.uleb128 0xb
+	.long	.LASF51
+	.byte	0x3
+	.uleb128 0xb
+	.long	.LASF52
+	.byte	0
+	.uleb128 0xb
+	.long	.LASF53
+	.byte	0x1
+	.uleb128 0xb
+	.long	.LASF54
+	.byte	0x2
+	.uleb128 0xb
+	.long	.LASF55
+	.byte	0
+	.byte	0
+	.uleb128 0x4
+	.long	.LASF56
+	.byte	0x8
+	.byte	0x18
+	.byte	0x13
+	.long	0x51
+	.uleb128 0x4
+	.long	.LASF57
+	.byte	0x8
+	.byte	0x1a
+	.byte	0x14
+	.long	0x6b
+	.uleb128 0x1f
+	.string	"u8"
+	.byte	0x7
+	.byte	0x11
+	.long	0x343
+	.uleb128 0x10
+	.long	0x35b
+	.uleb128 0x1f
+	.string	"u32"
+	.byte	0x8
+	.byte	0x12
+	.long	0x34f
+	.uleb128 0x10
+	.long	0x36a
+	.uleb128 0xd
+	.long	0x375
+	.long	0x38a
+	.uleb128 0xa
+	.long	0x43
+	.byte	0x7
+	.byte	0
+	.uleb128 0x10
+	.long	0x37a
+	.uleb128 0x20
+	.long	.LASF58
+	.byte	0xa
+	.byte	0x12
+	.long	0x38a
+	.byte	0x20
+	.byte	0x67
+	.byte	0xe6
+	.byte	0x9
+	.byte	0x6a
+	.byte	0x85
+	.byte	0xae
+	.byte	0x67
+	.byte	0xbb
+	.byte	0x72
+	.byte	0xf3
+	.byte	0x6e
+	.byte	0x3c
+	.byte	0x3a
+	.byte	0xf5
+	.byte	0x4f
+	.byte	0xa5
+	.byte	0x7f
+	.byte	0x52
+	.byte	0xe
+	.byte	0x51
+	.byte	0x8c
+	.byte	0x68
+	.byte	0x5
+	.byte	0x9b
+	.byte	0xab
+	.byte	0xd9
+	.byte	0x83
+	.byte	0x1f
+	.byte	0x19
+	.byte	0xcd
+	.byte	0xe0
+	.byte	0x5b
+	.uleb128 0xd
+	.long	0x365
+	.long	0x3d1
+	.uleb128 0xa
+	.long	0x43
+	.byte	0x9
+	.uleb128 0xa
+	.long	0x43
+	.byte	0xf
+	.byte	0
+	.uleb128 0x10
+	.long	0x3bb
+	.uleb128 0x20
+	.long	.LASF59
+	.byte	0xf
+	.byte	0x11
+	.long	0x3d1
+	.byte	0xa0
+	.byte	0
+	.byte	0x1
+	.byte	0x2
+	.byte	0x3
+	.byte	0x4
+	.byte	0x5
+	.byte	0x6
+	.byte	0x7
+	.byte	0x8
+	.byte	0x9
+	.byte	0xa
+	.byte	0xb
+	.byte	0xc
+	.byte	0xd
+	.byte	0xe
+	.byte	0xf
+	.byte	0xe
+	.byte	0xa
+	.byte	0x4
+	.byte	0x8
+	.byte	0x9
+	.byte	0xf
+	.byte	0xd
+	.byte	0x6
+	.byte	0x1
+	.byte	0xc
+	.byte	0
+	.byte	0x2
+	.byte	0xb
+	.byte	0x7
+	.byte	0x5
+	.byte	0x3
+	.byte	0xb
+	.byte	0x8
+	.byte	0xc
+	.byte	0
+	.byte	0x5
+	.byte	0x2
+	.byte	0xf
+	.byte	0xd
+	.byte	0xa
+	.byte	0xe
+	.byte	0x3
+	.byte	0x6
+	.byte	0x7
+	.byte	0x1
+	.byte	0x9
+	.byte	0x4
+	.byte	0x7
+	.byte	0x9
+	.byte	0x3
+	.byte	0x1
+	.byte	0xd
+	.byte	0xc
+	.byte	0xb
+	.byte	0xe
+	.byte	0x2
+	.byte	0x6
+	.byte	0x5
+	.byte	0xa
+	.byte	0x4
+	.byte	0
+	.byte	0xf
+	.byte	0x8
+	.byte	0x9
+	.byte	0
+	.byte	0x5
+	.byte	0x7
+	.byte	0x2
+	.byte	0x4
+	.byte	0xa
+	.byte	0xf
+	.byte	0xe
+	.byte	0x1
+	.byte	0xb
+	.byte	0xc
+	.byte	0x6
+	.byte	0x8
+	.byte	0x3
+	.byte	0xd
+	.byte	0x2
+	.byte	0xc
+	.byte	0x6
+	.byte	0xa
+	.byte	0
+	.byte	0xb
+	.byte	0x8
+	.byte	0x3
+	.byte	0x4
+	.byte	0xd
+	.byte	0x7
+	.byte	0x5
+	.byte	0xf
+	.byte	0xe
+	.byte	0x1
+	.byte	0x9
+	.byte	0xc
+	.byte	0x5
+	.byte	0x1
+	.byte	0xf
+	.byte	0xe
+	.byte	0xd
+	.byte	0x4
+	.byte	0xa
+	.byte	0
+	.byte	0x7
+	.byte	0x6
+	.byte	0x3
+	.byte	0x9
+	.byte	0x2
+	.byte	0x8
+	.byte	0xb
+	.byte	0xd
+	.byte	0xb
+	.byte	0x7
+	.byte	0xe
+	.byte	0xc
+	.byte	0x1
+	.byte	0x3
+	.byte	0x9
+	.byte	0x5
+	.byte	0
+	.byte	0xf
+	.byte	0x4
+	.byte	0x8
+	.byte	0x6
+	.byte	0x2
+	.byte	0xa
+	.byte	0x6
+	.byte	0xf
+	.byte	0xe
+	.byte	0x9
+	.byte	0xb
+	.byte	0x3
+	.byte	0
+	.byte	0x8
+	.byte	0xc
+	.byte	0x2
+	.byte	0xd
+	.byte	0x7
+	.byte	0x1
+	.byte	0x4
+	.byte	0xa
+	.byte	0x5
+	.byte	0xa
+	.byte	0x2
+	.byte	0x8
+	.byte	0x4
+	.byte	0x7
+	.byte	0x6
+	.byte	0x1
+	.byte	0x5
+	.byte	0xf
+	.byte	0xb
+	.byte	0x9
+	.byte	0xe
+	.byte	0x3
+	.byte	0xc
+	.byte	0xd
+	.byte	0
+	.uleb128 0x17
+	.long	.LASF60
+	.byte	0x10
+	.byte	0x1
+	.byte	0x1b
+	.byte	0x8
+	.long	0x4a6
+	.uleb128 0x11
+	.string	"lo"
+	.byte	0x1c
+	.byte	0xc
+	.long	0x8c
+	.byte	0
+	.uleb128 0x11
+	.string	"hi"
+	.byte	0x1c
+	.byte	0x10
+	.long	0x8c
+	.byte	0x8
+	.byte	0
+	.uleb128 0x2d
+	.long	.LASF61
+	.value	0x438
+	.byte	0x1
+	.byte	0x1f
+	.byte	0x8
+	.long	0x524
+	.uleb128 0x1
+	.long	.LASF62
+	.byte	0x1
+	.byte	0x20
+	.byte	0x17
+	.long	0x524
+	.byte	0
+	.uleb128 0x11
+	.string	"fn"
+	.byte	0x21
+	.byte	0xc
+	.long	0x539
+	.byte	0x8
+	.uleb128 0x11
+	.string	"arg"
+	.byte	0x22
+	.byte	0xb
+	.long	0x7e
+	.byte	0x10
+	.uleb128 0x1
+	.long	.LASF63
+	.byte	0x1
+	.byte	0x23
+	.byte	0xe
+	.long	0x3c
+	.byte	0x18
+	.uleb128 0x1
+	.long	.LASF64
+	.byte	0x1
+	.byte	0x24
+	.byte	0xe
+	.long	0x3c
+	.byte	0x1c
+	.uleb128 0x1
+	.long	.LASF65
+	.byte	0x1
+	.byte	0x25
+	.byte	0xe
+	.long	0x3c
+	.byte	0x20
+	.uleb128 0x1
+	.long	.LASF66
+	.byte	0x1
+	.byte	0x26
+	.byte	0xc
+	.long	0x8c
+	.byte	0x28
+	.uleb128 0x1
+	.long	.LASF67
+	.byte	0x1
+	.byte	0x27
+	.byte	0xc
+	.long	0x8c
+	.byte	0x30
+	.uleb128 0x11
+	.string	"r"
+	.byte	0x28
+	.byte	0x18
+	.long	0x53e
+	.byte	0x38
+	.byte	0
+	.uleb128 0x5
+	.long	0x4a6
+	.uleb128 0x2e
+	.long	0x539
+	.uleb128 0x3
+	.long	0x7e
+	.uleb128 0x3
+	.long	0x8c
+	.byte	0
+	.uleb128 0x5
+	.long	0x529
+	.uleb128 0xd
+	.long	0x482
+	.long	0x54e
+	.uleb128 0xa
+	.long	0x43
+	.byte	0x3f
+	.byte	0
+	.uleb128 0x1e
+	.byte	0x98
+	.byte	0x1
+	.byte	0x2b
+	.byte	0x8
+	.long	0x5a6
+	.uleb128 0x1
+	.long	.LASF68
+	.byte	0x1
+	.byte	0x2c
+	.byte	0x15
+	.long	0x2a8
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF69
+	.byte	0x1
+	.byte	0x2d
+	.byte	0x14
+	.long	0x2f8
+	.byte	0x28
+	.uleb128 0x1
+	.long	.LASF70
+	.byte	0x1
+	.byte	0x2e
+	.byte	0x14
+	.long	0x2f8
+	.byte	0x58
+	.uleb128 0x1
+	.long	.LASF71
+	.byte	0x1
+	.byte	0x2f
+	.byte	0xe
+	.long	0x3c
+	.byte	0x88
+	.uleb128 0x1
+	.long	.LASF72
+	.byte	0x1
+	.byte	0x30
+	.byte	0xe
+	.long	0x3c
+	.byte	0x8c
+	.uleb128 0x1
+	.long	.LASF73
+	.byte	0x1
+	.byte	0x31
+	.byte	0x17
+	.long	0x524
+	.byte	0x90
+	.byte	0
+	.uleb128 0x2f
+	.long	.LASF74
+	.byte	0x1
+	.byte	0x32
+	.byte	0x3
+	.long	0x54e
+	.uleb128 0x9
+	.byte	0x3
+	.quad	bpool
+	.uleb128 0x12
+	.long	.LASF75
+	.value	0x343
+	.long	0x64
+	.long	0x5d1
+	.uleb128 0x3
+	.long	0x5d1
+	.byte	0
+	.uleb128 0x5
+	.long	0x2a8
+	.uleb128 0xf
+	.long	0x5d1
+	.uleb128 0x12
+	.long	.LASF76
+	.value	0x46d
+	.long	0x64
+	.long	0x5f5
+	.uleb128 0x3
+	.long	0x5fa
+	.uleb128 0x3
+	.long	0x5d6
+	.byte	0
+	.uleb128 0x5
+	.long	0x2f8
+	.uleb128 0xf
+	.long	0x5f5
+	.uleb128 0x12
+	.long	.LASF77
+	.value	0x465
+	.long	0x64
+	.long	0x614
+	.uleb128 0x3
+	.long	0x5f5
+	.byte	0
+	.uleb128 0x12
+	.long	.LASF78
+	.value	0x10d
+	.long	0x64
+	.long	0x629
+	.uleb128 0x3
+	.long	0x218
+	.byte	0
+	.uleb128 0x30
+	.long	.LASF79
+	.byte	0xa
+	.byte	0xca
+	.byte	0xc
+	.long	0x64
+	.long	0x64e
+	.uleb128 0x3
+	.long	0x653
+	.uleb128 0x3
+	.long	0x65d
+	.uleb128 0x3
+	.long	0x662
+	.uleb128 0x3
+	.long	0x80
+	.byte	0
+	.uleb128 0x5
+	.long	0x218
+	.uleb128 0xf
+	.long	0x64e
+	.uleb128 0x5
+	.long	0x266
+	.uleb128 0xf
+	.long	0x658
+	.uleb128 0x5
+	.long	0x667
+	.uleb128 0x31
+	.long	0x7e
+	.long	0x676
+	.uleb128 0x3
+	.long	0x7e
+	.byte	0
+	.uleb128 0x12
+	.long	.LASF80
+	.value	0x31a
+	.long	0x64
+	.long	0x68b
+	.uleb128 0x3
+	.long	0x5d1
+	.byte	0
+	.uleb128 0x32
+	.long	.LASF87
+	.byte	0x1
+	.byte	0x7a
+	.byte	0x6
+	.quad	.LFB22
+	.quad	.LFE22-.LFB22
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0x97c
+	.uleb128 0x33
+	.long	.LASF81
+	.byte	0x1
+	.byte	0x7a
+	.byte	0x20
+	.long	0x3c
+	.long	.LLST14
+	.long	.LVUS14
+	.uleb128 0x18
+	.string	"n"
+	.byte	0x7a
+	.byte	0x31
+	.long	0x8c
+	.long	.LLST15
+	.long	.LVUS15
+	.uleb128 0x18
+	.string	"fn"
+	.byte	0x7b
+	.byte	0x1e
+	.long	0x539
+	.long	.LLST16
+	.long	.LVUS16
+	.uleb128 0x18
+	.string	"arg"
+	.byte	0x7b
+	.byte	0x3e
+	.long	0x7e
+	.long	.LLST17
+	.long	.LVUS17
+	.uleb128 0x21
+	.string	"J"
+	.byte	0x7d
+	.byte	0x16
+	.long	0x4a6
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -1152
+	.uleb128 0x34
+	.long	.LASF82
+	.byte	0x1
+	.byte	0x7d
+	.byte	0x1b
+	.long	0x97c
+	.long	.LLST18
+	.long	.LVUS18
+	.uleb128 0x22
+	.quad	.LBB67
+	.quad	.LBE67-.LBB67
+	.long	0x751
+	.uleb128 0x1b
+	.string	"i"
+	.byte	0x84
+	.byte	0x15
+	.long	0x8c
+	.long	.LLST36
+	.long	.LVUS36
+	.uleb128 0x35
+	.quad	.LVL76
+	.uleb128 0x2
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x7c
+	.sleb128 0
+	.uleb128 0x2
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x2
+	.byte	0x76
+	.sleb128 -1
+	.byte	0
+	.byte	0
+	.uleb128 0x23
+	.long	.LLRL19
+	.long	0x76c
+	.uleb128 0x1b
+	.string	"p"
+	.byte	0x90
+	.byte	0x13
+	.long	0x3c
+	.long	.LLST20
+	.long	.LVUS20
+	.byte	0
+	.uleb128 0x23
+	.long	.LLRL21
+	.long	0x7b8
+	.uleb128 0x21
+	.string	"t"
+	.byte	0x9c
+	.byte	0x13
+	.long	0x218
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -1160
+	.uleb128 0x9
+	.quad	.LVL43
+	.long	0x629
+	.long	0x7aa
+	.uleb128 0x2
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x7f
+	.sleb128 0
+	.uleb128 0x2
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x1
+	.byte	0x30
+	.uleb128 0x2
+	.uleb128 0x1
+	.byte	0x51
+	.uleb128 0x2
+	.byte	0x7e
+	.sleb128 0
+	.uleb128 0x2
+	.uleb128 0x1
+	.byte	0x52
+	.uleb128 0x1
+	.byte	0x30
+	.byte	0
+	.uleb128 0x36
+	.quad	.LVL44
+	.long	0x614
+	.byte	0
+	.uleb128 0x13
+	.long	0xba4
+	.quad	.LBI53
+	.byte	.LVU165
+	.long	.LLRL22
+	.byte	0xa4
+	.byte	0x5
+	.long	0x912
+	.uleb128 0xc
+	.long	0xbba
+	.long	.LLST23
+	.long	.LVUS23
+	.uleb128 0xc
+	.long	0xbb1
+	.long	.LLST24
+	.long	.LVUS24
+	.uleb128 0x14
+	.long	.LLRL25
+	.uleb128 0x1c
+	.long	0xbc3
+	.uleb128 0x13
+	.long	0xbcd
+	.quad	.LBI55
+	.byte	.LVU181
+	.long	.LLRL26
+	.byte	0x55
+	.byte	0xc
+	.long	0x8b1
+	.uleb128 0xc
+	.long	0xbe5
+	.long	.LLST27
+	.long	.LVUS27
+	.uleb128 0xc
+	.long	0xbee
+	.long	.LLST28
+	.long	.LVUS28
+	.uleb128 0xc
+	.long	0xbdc
+	.long	.LLST29
+	.long	.LVUS29
+	.uleb128 0x14
+	.long	.LLRL26
+	.uleb128 0x8
+	.long	0xbf7
+	.long	.LLST30
+	.long	.LVUS30
+	.uleb128 0x19
+	.long	0xc00
+	.quad	.LBB57
+	.quad	.LBE57-.LBB57
+	.uleb128 0x8
+	.long	0xc01
+	.long	.LLST31
+	.long	.LVUS31
+	.uleb128 0x8
+	.long	0xc0a
+	.long	.LLST32
+	.long	.LVUS32
+	.uleb128 0x24
+	.long	0xc16
+	.long	.LLRL33
+	.uleb128 0x8
+	.long	0xc17
+	.long	.LLST34
+	.long	.LVUS34
+	.uleb128 0x19
+	.long	0xc20
+	.quad	.LBB59
+	.quad	.LBE59-.LBB59
+	.uleb128 0x8
+	.long	0xc21
+	.long	.LLST35
+	.long	.LVUS35
+	.byte	0
+	.byte	0
+	.byte	0
+	.byte	0
+	.byte	0
+	.uleb128 0x9
+	.quad	.LVL48
+	.long	0x5bc
+	.long	0x8c9
+	.uleb128 0x2
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x73
+	.sleb128 0
+	.byte	0
+	.uleb128 0x25
+	.quad	.LVL49
+	.long	0x8dd
+	.uleb128 0x2
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x2
+	.byte	0x7e
+	.sleb128 0
+	.byte	0
+	.uleb128 0x9
+	.quad	.LVL50
+	.long	0x676
+	.long	0x8f5
+	.uleb128 0x2
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x73
+	.sleb128 0
+	.byte	0
+	.uleb128 0x15
+	.quad	.LVL71
+	.long	0x5ff
+	.uleb128 0x2
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x9
+	.byte	0x3
+	.quad	bpool+88
+	.byte	0
+	.byte	0
+	.byte	0
+	.uleb128 0x9
+	.quad	.LVL38
+	.long	0x676
+	.long	0x92a
+	.uleb128 0x2
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x73
+	.sleb128 0
+	.byte	0
+	.uleb128 0x9
+	.quad	.LVL45
+	.long	0x5ff
+	.long	0x949
+	.uleb128 0x2
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x9
+	.byte	0x3
+	.quad	bpool+40
+	.byte	0
+	.uleb128 0x9
+	.quad	.LVL63
+	.long	0x5db
+	.long	0x967
+	.uleb128 0x2
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x7c
+	.sleb128 0
+	.uleb128 0x2
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x2
+	.byte	0x73
+	.sleb128 0
+	.byte	0
+	.uleb128 0x15
+	.quad	.LVL69
+	.long	0x5bc
+	.uleb128 0x2
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x73
+	.sleb128 0
+	.byte	0
+	.byte	0
+	.uleb128 0x5
+	.long	0x524
+	.uleb128 0x37
+	.long	.LASF88
+	.byte	0x1
+	.byte	0x68
+	.byte	0xe
+	.long	0x7e
+	.quad	.LFB21
+	.quad	.LFE21-.LFB21
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0xb8b
+	.uleb128 0x18
+	.string	"arg"
+	.byte	0x68
+	.byte	0x21
+	.long	0x7e
+	.long	.LLST0
+	.long	.LVUS0
+	.uleb128 0x22
+	.quad	.LBB15
+	.quad	.LBE15-.LBB15
+	.long	0xb76
+	.uleb128 0x1b
+	.string	"J"
+	.byte	0x6d
+	.byte	0x1b
+	.long	0x524
+	.long	.LLST1
+	.long	.LVUS1
+	.uleb128 0x13
+	.long	0xb8b
+	.quad	.LBI16
+	.byte	.LVU12
+	.long	.LLRL2
+	.byte	0x6d
+	.byte	0x1f
+	.long	0xa08
+	.uleb128 0x14
+	.long	.LLRL2
+	.uleb128 0x8
+	.long	0xb9a
+	.long	.LLST3
+	.long	.LVUS3
+	.byte	0
+	.byte	0
+	.uleb128 0x13
+	.long	0xba4
+	.quad	.LBI20
+	.byte	.LVU32
+	.long	.LLRL4
+	.byte	0x73
+	.byte	0x9
+	.long	0xb43
+	.uleb128 0x26
+	.long	0xbba
+	.uleb128 0xc
+	.long	0xbb1
+	.long	.LLST5
+	.long	.LVUS5
+	.uleb128 0x14
+	.long	.LLRL4
+	.uleb128 0x1c
+	.long	0xbc3
+	.uleb128 0x13
+	.long	0xbcd
+	.quad	.LBI22
+	.byte	.LVU50
+	.long	.LLRL6
+	.byte	0x55
+	.byte	0xc
+	.long	0xae9
+	.uleb128 0xc
+	.long	0xbee
+	.long	.LLST7
+	.long	.LVUS7
+	.uleb128 0x26
+	.long	0xbe5
+	.uleb128 0xc
+	.long	0xbdc
+	.long	.LLST8
+	.long	.LVUS8
+	.uleb128 0x14
+	.long	.LLRL6
+	.uleb128 0x1c
+	.long	0xbf7
+	.uleb128 0x19
+	.long	0xc00
+	.quad	.LBB24
+	.quad	.LBE24-.LBB24
+	.uleb128 0x8
+	.long	0xc01
+	.long	.LLST9
+	.long	.LVUS9
+	.uleb128 0x8
+	.long	0xc0a
+	.long	.LLST10
+	.long	.LVUS10
+	.uleb128 0x24
+	.long	0xc16
+	.long	.LLRL11
+	.uleb128 0x8
+	.long	0xc17
+	.long	.LLST12
+	.long	.LVUS12
+	.uleb128 0x19
+	.long	0xc20
+	.quad	.LBB26
+	.quad	.LBE26-.LBB26
+	.uleb128 0x8
+	.long	0xc21
+	.long	.LLST13
+	.long	.LVUS13
+	.byte	0
+	.byte	0
+	.byte	0
+	.byte	0
+	.byte	0
+	.uleb128 0x9
+	.quad	.LVL12
+	.long	0x5bc
+	.long	0xb01
+	.uleb128 0x2
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x76
+	.sleb128 0
+	.byte	0
+	.uleb128 0x25
+	.quad	.LVL13
+	.long	0xb15
+	.uleb128 0x2
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x2
+	.byte	0x7f
+	.sleb128 0
+	.byte	0
+	.uleb128 0x9
+	.quad	.LVL14
+	.long	0x676
+	.long	0xb2d
+	.uleb128 0x2
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x76
+	.sleb128 0
+	.byte	0
+	.uleb128 0x15
+	.quad	.LVL27
+	.long	0x5ff
+	.uleb128 0x2
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x7c
+	.sleb128 0
+	.byte	0
+	.byte	0
+	.byte	0
+	.uleb128 0x9
+	.quad	.LVL6
+	.long	0x5db
+	.long	0xb61
+	.uleb128 0x2
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x7d
+	.sleb128 0
+	.uleb128 0x2
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x2
+	.byte	0x76
+	.sleb128 0
+	.byte	0
+	.uleb128 0x15
+	.quad	.LVL25
+	.long	0x5ff
+	.uleb128 0x2
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x7c
+	.sleb128 0
+	.byte	0
+	.byte	0
+	.uleb128 0x15
+	.quad	.LVL2
+	.long	0x676
+	.uleb128 0x2
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x76
+	.sleb128 0
+	.byte	0
+	.byte	0
+	.uleb128 0x27
+	.long	.LASF83
+	.byte	0x60
+	.byte	0x1a
+	.long	0x524
+	.long	0xba4
+	.uleb128 0xe
+	.string	"J"
+	.byte	0x62
+	.byte	0x17
+	.long	0x524
+	.byte	0
+	.uleb128 0x38
+	.long	.LASF89
+	.byte	0x1
+	.byte	0x52
+	.byte	0xd
+	.byte	0x1
+	.long	0xbcd
+	.uleb128 0x16
+	.string	"J"
+	.byte	0x52
+	.byte	0x31
+	.long	0x524
+	.uleb128 0x16
+	.string	"p"
+	.byte	0x52
+	.byte	0x3d
+	.long	0x3c
+	.uleb128 0xe
+	.string	"i"
+	.byte	0x54
+	.byte	0xc
+	.long	0x8c
+	.byte	0
+	.uleb128 0x27
+	.long	.LASF84
+	.byte	0x38
+	.byte	0xc
+	.long	0x64
+	.long	0xc2e
+	.uleb128 0x16
+	.string	"J"
+	.byte	0x38
+	.byte	0x29
+	.long	0x524
+	.uleb128 0x16
+	.string	"p"
+	.byte	0x38
+	.byte	0x35
+	.long	0x3c
+	.uleb128 0x16
+	.string	"i"
+	.byte	0x38
+	.byte	0x40
+	.long	0xc2e
+	.uleb128 0xe
+	.string	"r"
+	.byte	0x3a
+	.byte	0x19
+	.long	0xc33
+	.uleb128 0x1d
+	.uleb128 0xe
+	.string	"v"
+	.byte	0x3c
+	.byte	0x1d
+	.long	0xc33
+	.uleb128 0x39
+	.long	.LASF85
+	.byte	0x1
+	.byte	0x3d
+	.byte	0x10
+	.long	0x8c
+	.uleb128 0x1d
+	.uleb128 0xe
+	.string	"q"
+	.byte	0x3e
+	.byte	0x17
+	.long	0x3c
+	.uleb128 0x1d
+	.uleb128 0xe
+	.string	"k"
+	.byte	0x3f
+	.byte	0x14
+	.long	0x8c
+	.byte	0
+	.byte	0
+	.byte	0
+	.byte	0
+	.uleb128 0x5
+	.long	0x8c
+	.uleb128 0x5
+	.long	0x482
+	.byte	0
+	.section	.debug_abbrev,"",@progbits
+.Ldebug_abbrev0:
+	.uleb128 0x1
+	.uleb128 0xd
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x38
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x2
+	.uleb128 0x49
+	.byte	0
+	.uleb128 0x2
+	.uleb128 0x18
+	.uleb128 0x7e
+	.uleb128 0x18
+	.byte	0
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x5
+	.byte	0
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x4
+	.uleb128 0x16
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x5
+	.uleb128 0xf
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0x21
+	.sleb128 8
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x6
+	.uleb128 0x24
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x3e
+	.uleb128 0xb
+	.uleb128 0x3
+	.uleb128 0xe
+	.byte	0
+	.byte	0
+	.uleb128 0x7
+	.uleb128 0xd
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x8
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x31
+	.uleb128 0x13
+	.uleb128 0x2
+	.uleb128 0x17
+	.uleb128 0x2137
+	.uleb128 0x17
+	.byte	0
+	.byte	0
+	.uleb128 0x9
+	.uleb128 0x48
+	.byte	0x1
+	.uleb128 0x7d
+	.uleb128 0x1
+	.uleb128 0x7f
+	.uleb128 0x13
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0xa
+	.uleb128 0x21
+	.byte	0
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x2f
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0x28
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x1c
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0xc
+	.uleb128 0x5
+	.byte	0
+	.uleb128 0x31
+	.uleb128 0x13
+	.uleb128 0x2
+	.uleb128 0x17
+	.uleb128 0x2137
+	.uleb128 0x17
+	.byte	0
+	.byte	0
+	.uleb128 0xd
+	.uleb128 0x1
+	.byte	0x1
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0xe
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x8
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0xf
+	.uleb128 0x37
+	.byte	0
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x10
+	.uleb128 0x26
+	.byte	0
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x11
+	.uleb128 0xd
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x8
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x38
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x12
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 10
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 12
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x3c
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x13
+	.uleb128 0x1d
+	.byte	0x1
+	.uleb128 0x31
+	.uleb128 0x13
+	.uleb128 0x52
+	.uleb128 0x1
+	.uleb128 0x2138
+	.uleb128 0xb
+	.uleb128 0x55
+	.uleb128 0x17
+	.uleb128 0x58
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x59
+	.uleb128 0xb
+	.uleb128 0x57
+	.uleb128 0xb
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x14
+	.uleb128 0xb
+	.byte	0x1
+	.uleb128 0x55
+	.uleb128 0x17
+	.byte	0
+	.byte	0
+	.uleb128 0x15
+	.uleb128 0x48
+	.byte	0x1
+	.uleb128 0x7d
+	.uleb128 0x1
+	.uleb128 0x7f
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x16
+	.uleb128 0x5
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x8
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x17
+	.uleb128 0x13
+	.byte	0x1
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x18
+	.uleb128 0x5
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x8
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x2
+	.uleb128 0x17
+	.uleb128 0x2137
+	.uleb128 0x17
+	.byte	0
+	.byte	0
+	.uleb128 0x19
+	.uleb128 0xb
+	.byte	0x1
+	.uleb128 0x31
+	.uleb128 0x13
+	.uleb128 0x11
+	.uleb128 0x1
+	.uleb128 0x12
+	.uleb128 0x7
+	.byte	0
+	.byte	0
+	.uleb128 0x1a
+	.uleb128 0x17
+	.byte	0x1
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 9
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x1b
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x8
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x2
+	.uleb128 0x17
+	.uleb128 0x2137
+	.uleb128 0x17
+	.byte	0
+	.byte	0
+	.uleb128 0x1c
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x31
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x1d
+	.uleb128 0xb
+	.byte	0x1
+	.byte	0
+	.byte	0
+	.uleb128 0x1e
+	.uleb128 0x13
+	.byte	0x1
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x1f
+	.uleb128 0x16
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x8
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 9
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x20
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 9
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x1c
+	.uleb128 0xa
+	.byte	0
+	.byte	0
+	.uleb128 0x21
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x8
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x2
+	.uleb128 0x18
+	.byte	0
+	.byte	0
+	.uleb128 0x22
+	.uleb128 0xb
+	.byte	0x1
+	.uleb128 0x11
+	.uleb128 0x1
+	.uleb128 0x12
+	.uleb128 0x7
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x23
+	.uleb128 0xb
+	.byte	0x1
+	.uleb128 0x55
+	.uleb128 0x17
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x24
+	.uleb128 0xb
+	.byte	0x1
+	.uleb128 0x31
+	.uleb128 0x13
+	.uleb128 0x55
+	.uleb128 0x17
+	.byte	0
+	.byte	0
+	.uleb128 0x25
+	.uleb128 0x48
+	.byte	0x1
+	.uleb128 0x7d
+	.uleb128 0x1
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x26
+	.uleb128 0x5
+	.byte	0
+	.uleb128 0x31
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x27
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x20
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x28
+	.uleb128 0x11
+	.byte	0x1
+	.uleb128 0x25
+	.uleb128 0xe
+	.uleb128 0x13
+	.uleb128 0xb
+	.uleb128 0x3
+	.uleb128 0x1f
+	.uleb128 0x1b
+	.uleb128 0x1f
+	.uleb128 0x11
+	.uleb128 0x1
+	.uleb128 0x12
+	.uleb128 0x7
+	.uleb128 0x10
+	.uleb128 0x17
+	.byte	0
+	.byte	0
+	.uleb128 0x29
+	.uleb128 0x24
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x3e
+	.uleb128 0xb
+	.uleb128 0x3
+	.uleb128 0x8
+	.byte	0
+	.byte	0
+	.uleb128 0x2a
+	.uleb128 0xf
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x2b
+	.uleb128 0x17
+	.byte	0x1
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x2c
+	.uleb128 0x4
+	.byte	0x1
+	.uleb128 0x3e
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x2d
+	.uleb128 0x13
+	.byte	0x1
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0xb
+	.uleb128 0x5
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x2e
+	.uleb128 0x15
+	.byte	0x1
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x2f
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x2
+	.uleb128 0x18
+	.byte	0
+	.byte	0
+	.uleb128 0x30
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x3c
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x31
+	.uleb128 0x15
+	.byte	0x1
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x32
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x11
+	.uleb128 0x1
+	.uleb128 0x12
+	.uleb128 0x7
+	.uleb128 0x40
+	.uleb128 0x18
+	.uleb128 0x7a
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x33
+	.uleb128 0x5
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x2
+	.uleb128 0x17
+	.uleb128 0x2137
+	.uleb128 0x17
+	.byte	0
+	.byte	0
+	.uleb128 0x34
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x2
+	.uleb128 0x17
+	.uleb128 0x2137
+	.uleb128 0x17
+	.byte	0
+	.byte	0
+	.uleb128 0x35
+	.uleb128 0x48
+	.byte	0x1
+	.uleb128 0x7d
+	.uleb128 0x1
+	.byte	0
+	.byte	0
+	.uleb128 0x36
+	.uleb128 0x48
+	.byte	0
+	.uleb128 0x7d
+	.uleb128 0x1
+	.uleb128 0x7f
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x37
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x11
+	.uleb128 0x1
+	.uleb128 0x12
+	.uleb128 0x7
+	.uleb128 0x40
+	.uleb128 0x18
+	.uleb128 0x7a
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x38
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x20
+	.uleb128 0xb
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x39
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.byte	0
+	.section	.debug_loclists,"",@progbits
+	.long	.Ldebug_loc3-.Ldebug_loc2
+.Ldebug_loc2:
+	.value	0x5
+	.byte	0x8
+	.byte	0
+	.long	0
+.Ldebug_loc0:
+.LVUS14:
+	.uleb128 0
+	.uleb128 .LVU92
+	.uleb128 .LVU92
+	.uleb128 .LVU94
+	.uleb128 .LVU94
+	.uleb128 .LVU231
+	.uleb128 .LVU231
+	.uleb128 .LVU232
+	.uleb128 .LVU232
+	.uleb128 .LVU237
+	.uleb128 .LVU237
+	.uleb128 .LVU238
+	.uleb128 .LVU238
+	.uleb128 0
+.LLST14:
+	.byte	0x4
+	.uleb128 .LVL28-.Ltext0
+	.uleb128 .LVL29-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL29-.Ltext0
+	.uleb128 .LVL30-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL30-.Ltext0
+	.uleb128 .LVL69-.Ltext0
+	.uleb128 0x1
+	.byte	0x56
+	.byte	0x4
+	.uleb128 .LVL69-.Ltext0
+	.uleb128 .LVL70-.Ltext0
+	.uleb128 0x55
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x8
+	.byte	0x40
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0xc
+	.long	0xffffffff
+	.byte	0x1a
+	.byte	0x8
+	.byte	0x40
+	.byte	0x2c
+	.byte	0x28
+	.value	0x1
+	.byte	0x16
+	.byte	0x13
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x23
+	.uleb128 0x8000000000000000
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x8
+	.byte	0x40
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0xc
+	.long	0xffffffff
+	.byte	0x1a
+	.byte	0x8
+	.byte	0x40
+	.byte	0x2c
+	.byte	0x28
+	.value	0x1
+	.byte	0x16
+	.byte	0x13
+	.byte	0xc
+	.long	0xffffffff
+	.byte	0x1a
+	.byte	0x23
+	.uleb128 0x8000000000000000
+	.byte	0x2d
+	.byte	0x28
+	.value	0x1
+	.byte	0x16
+	.byte	0x13
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL70-.Ltext0
+	.uleb128 .LVL73-.Ltext0
+	.uleb128 0x1
+	.byte	0x56
+	.byte	0x4
+	.uleb128 .LVL73-.Ltext0
+	.uleb128 .LVL74-.Ltext0
+	.uleb128 0x25
+	.byte	0x74
+	.sleb128 0
+	.byte	0x70
+	.sleb128 0
+	.byte	0x73
+	.sleb128 0
+	.byte	0x23
+	.uleb128 0x8000000000000000
+	.byte	0x70
+	.sleb128 0
+	.byte	0x23
+	.uleb128 0x8000000000000000
+	.byte	0x2d
+	.byte	0x28
+	.value	0x1
+	.byte	0x16
+	.byte	0x13
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL74-.Ltext0
+	.uleb128 .LFE22-.Ltext0
+	.uleb128 0x53
+	.byte	0x73
+	.sleb128 0
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x8
+	.byte	0x40
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0xc
+	.long	0xffffffff
+	.byte	0x1a
+	.byte	0x8
+	.byte	0x40
+	.byte	0x2c
+	.byte	0x28
+	.value	0x1
+	.byte	0x16
+	.byte	0x13
+	.byte	0x73
+	.sleb128 0
+	.byte	0x23
+	.uleb128 0x8000000000000000
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x8
+	.byte	0x40
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0xc
+	.long	0xffffffff
+	.byte	0x1a
+	.byte	0x8
+	.byte	0x40
+	.byte	0x2c
+	.byte	0x28
+	.value	0x1
+	.byte	0x16
+	.byte	0x13
+	.byte	0xc
+	.long	0xffffffff
+	.byte	0x1a
+	.byte	0x23
+	.uleb128 0x8000000000000000
+	.byte	0x2d
+	.byte	0x28
+	.value	0x1
+	.byte	0x16
+	.byte	0x13
+	.byte	0x9f
+	.byte	0
+.LVUS15:
+	.uleb128 0
+	.uleb128 .LVU105
+	.uleb128 .LVU105
+	.uleb128 .LVU132
+	.uleb128 .LVU132
+	.uleb128 .LVU234
+	.uleb128 .LVU234
+	.uleb128 0
+.LLST15:
+	.byte	0x4
+	.uleb128 .LVL28-.Ltext0
+	.uleb128 .LVL32-.Ltext0
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x4
+	.uleb128 .LVL32-.Ltext0
+	.uleb128 .LVL37-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0x4
+	.uleb128 .LVL37-.Ltext0
+	.uleb128 .LVL72-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL72-.Ltext0
+	.uleb128 .LFE22-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0
+.LVUS16:
+	.uleb128 0
+	.uleb128 .LVU119
+	.uleb128 .LVU119
+	.uleb128 .LVU144
+	.uleb128 .LVU144
+	.uleb128 .LVU234
+	.uleb128 .LVU234
+	.uleb128 .LVU238
+	.uleb128 .LVU238
+	.uleb128 0
+.LLST16:
+	.byte	0x4
+	.uleb128 .LVL28-.Ltext0
+	.uleb128 .LVL34-.Ltext0
+	.uleb128 0x1
+	.byte	0x51
+	.byte	0x4
+	.uleb128 .LVL34-.Ltext0
+	.uleb128 .LVL42-.Ltext0
+	.uleb128 0x1
+	.byte	0x5d
+	.byte	0x4
+	.uleb128 .LVL42-.Ltext0
+	.uleb128 .LVL72-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x51
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL72-.Ltext0
+	.uleb128 .LVL74-.Ltext0
+	.uleb128 0x1
+	.byte	0x51
+	.byte	0x4
+	.uleb128 .LVL74-.Ltext0
+	.uleb128 .LFE22-.Ltext0
+	.uleb128 0x1
+	.byte	0x5d
+	.byte	0
+.LVUS17:
+	.uleb128 0
+	.uleb128 .LVU114
+	.uleb128 .LVU114
+	.uleb128 .LVU133
+	.uleb128 .LVU133
+	.uleb128 .LVU234
+	.uleb128 .LVU234
+	.uleb128 .LVU238
+	.uleb128 .LVU238
+	.uleb128 0
+.LLST17:
+	.byte	0x4
+	.uleb128 .LVL28-.Ltext0
+	.uleb128 .LVL33-.Ltext0
+	.uleb128 0x1
+	.byte	0x52
+	.byte	0x4
+	.uleb128 .LVL33-.Ltext0
+	.uleb128 .LVL38-1-.Ltext0
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -1136
+	.byte	0x4
+	.uleb128 .LVL38-1-.Ltext0
+	.uleb128 .LVL72-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x52
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL72-.Ltext0
+	.uleb128 .LVL74-.Ltext0
+	.uleb128 0x1
+	.byte	0x52
+	.byte	0x4
+	.uleb128 .LVL74-.Ltext0
+	.uleb128 .LFE22-.Ltext0
+	.uleb128 0x1
+	.byte	0x5c
+	.byte	0
+.LVUS18:
+	.uleb128 .LVU134
+	.uleb128 .LVU139
+	.uleb128 .LVU139
+	.uleb128 .LVU140
+	.uleb128 .LVU140
+	.uleb128 .LVU141
+	.uleb128 .LVU218
+	.uleb128 .LVU220
+	.uleb128 .LVU220
+	.uleb128 .LVU221
+	.uleb128 .LVU221
+	.uleb128 .LVU222
+	.uleb128 .LVU222
+	.uleb128 .LVU223
+	.uleb128 .LVU223
+	.uleb128 .LVU224
+.LLST18:
+	.byte	0x4
+	.uleb128 .LVL38-.Ltext0
+	.uleb128 .LVL39-.Ltext0
+	.uleb128 0xa
+	.byte	0x3
+	.quad	bpool+144
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL39-.Ltext0
+	.uleb128 .LVL40-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL40-.Ltext0
+	.uleb128 .LVL41-.Ltext0
+	.uleb128 0x1
+	.byte	0x51
+	.byte	0x4
+	.uleb128 .LVL64-.Ltext0
+	.uleb128 .LVL65-.Ltext0
+	.uleb128 0xa
+	.byte	0x3
+	.quad	bpool+144
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL65-.Ltext0
+	.uleb128 .LVL66-.Ltext0
+	.uleb128 0x1
+	.byte	0x51
+	.byte	0x4
+	.uleb128 .LVL66-.Ltext0
+	.uleb128 .LVL66-.Ltext0
+	.uleb128 0xa
+	.byte	0x3
+	.quad	bpool+144
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL66-.Ltext0
+	.uleb128 .LVL67-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL67-.Ltext0
+	.uleb128 .LVL68-.Ltext0
+	.uleb128 0x1
+	.byte	0x51
+	.byte	0
+.LVUS36:
+	.uleb128 .LVU234
+	.uleb128 .LVU238
+	.uleb128 .LVU238
+	.uleb128 .LVU240
+	.uleb128 .LVU240
+	.uleb128 .LVU241
+	.uleb128 .LVU241
+	.uleb128 .LVU242
+	.uleb128 .LVU242
+	.uleb128 0
+.LLST36:
+	.byte	0x4
+	.uleb128 .LVL72-.Ltext0
+	.uleb128 .LVL74-.Ltext0
+	.uleb128 0x2
+	.byte	0x30
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL74-.Ltext0
+	.uleb128 .LVL75-.Ltext0
+	.uleb128 0x1
+	.byte	0x56
+	.byte	0x4
+	.uleb128 .LVL75-.Ltext0
+	.uleb128 .LVL76-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x4
+	.uleb128 .LVL76-1-.Ltext0
+	.uleb128 .LVL76-.Ltext0
+	.uleb128 0x3
+	.byte	0x76
+	.sleb128 -1
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL76-.Ltext0
+	.uleb128 .LFE22-.Ltext0
+	.uleb128 0x1
+	.byte	0x56
+	.byte	0
+.LVUS20:
+	.uleb128 .LVU118
+	.uleb128 .LVU119
+	.uleb128 .LVU119
+	.uleb128 .LVU123
+	.uleb128 .LVU123
+	.uleb128 .LVU130
+.LLST20:
+	.byte	0x4
+	.uleb128 .LVL34-.Ltext0
+	.uleb128 .LVL34-.Ltext0
+	.uleb128 0x2
+	.byte	0x30
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL34-.Ltext0
+	.uleb128 .LVL35-.Ltext0
+	.uleb128 0xb
+	.byte	0x74
+	.sleb128 0
+	.byte	0x91
+	.sleb128 0
+	.byte	0x1c
+	.byte	0x23
+	.uleb128 0x448
+	.byte	0x34
+	.byte	0x25
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL35-.Ltext0
+	.uleb128 .LVL36-.Ltext0
+	.uleb128 0xb
+	.byte	0x74
+	.sleb128 0
+	.byte	0x91
+	.sleb128 0
+	.byte	0x1c
+	.byte	0x23
+	.uleb128 0x438
+	.byte	0x34
+	.byte	0x25
+	.byte	0x9f
+	.byte	0
+.LVUS23:
+	.uleb128 .LVU166
+	.uleb128 .LVU214
+	.uleb128 .LVU232
+	.uleb128 .LVU234
+.LLST23:
+	.byte	0x4
+	.uleb128 .LVL45-.Ltext0
+	.uleb128 .LVL62-.Ltext0
+	.uleb128 0x2
+	.byte	0x30
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL70-.Ltext0
+	.uleb128 .LVL72-.Ltext0
+	.uleb128 0x2
+	.byte	0x30
+	.byte	0x9f
+	.byte	0
+.LVUS24:
+	.uleb128 .LVU165
+	.uleb128 .LVU214
+	.uleb128 .LVU232
+	.uleb128 .LVU234
+.LLST24:
+	.byte	0x4
+	.uleb128 .LVL45-.Ltext0
+	.uleb128 .LVL62-.Ltext0
+	.uleb128 0x1
+	.byte	0x5d
+	.byte	0x4
+	.uleb128 .LVL70-.Ltext0
+	.uleb128 .LVL72-.Ltext0
+	.uleb128 0x1
+	.byte	0x5d
+	.byte	0
+.LVUS27:
+	.uleb128 .LVU167
+	.uleb128 .LVU174
+	.uleb128 .LVU182
+	.uleb128 .LVU214
+.LLST27:
+	.byte	0x4
+	.uleb128 .LVL46-.Ltext0
+	.uleb128 .LVL47-.Ltext0
+	.uleb128 0x2
+	.byte	0x30
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL51-.Ltext0
+	.uleb128 .LVL62-.Ltext0
+	.uleb128 0x2
+	.byte	0x30
+	.byte	0x9f
+	.byte	0
+.LVUS28:
+	.uleb128 .LVU167
+	.uleb128 .LVU174
+	.uleb128 .LVU181
+	.uleb128 .LVU214
+.LLST28:
+	.byte	0x4
+	.uleb128 .LVL46-.Ltext0
+	.uleb128 .LVL47-.Ltext0
+	.uleb128 0x6
+	.byte	0xa0
+	.long	.Ldebug_info0+2031
+	.sleb128 0
+	.byte	0x4
+	.uleb128 .LVL51-.Ltext0
+	.uleb128 .LVL62-.Ltext0
+	.uleb128 0x6
+	.byte	0xa0
+	.long	.Ldebug_info0+2031
+	.sleb128 0
+	.byte	0
+.LVUS29:
+	.uleb128 .LVU167
+	.uleb128 .LVU174
+	.uleb128 .LVU181
+	.uleb128 .LVU214
+.LLST29:
+	.byte	0x4
+	.uleb128 .LVL46-.Ltext0
+	.uleb128 .LVL47-.Ltext0
+	.uleb128 0x1
+	.byte	0x5d
+	.byte	0x4
+	.uleb128 .LVL51-.Ltext0
+	.uleb128 .LVL62-.Ltext0
+	.uleb128 0x1
+	.byte	0x5d
+	.byte	0
+.LVUS30:
+	.uleb128 .LVU167
+	.uleb128 .LVU180
+	.uleb128 .LVU183
+	.uleb128 .LVU213
+	.uleb128 .LVU213
+	.uleb128 .LVU231
+	.uleb128 .LVU232
+	.uleb128 .LVU234
+.LLST30:
+	.byte	0x4
+	.uleb128 .LVL46-.Ltext0
+	.uleb128 .LVL51-.Ltext0
+	.uleb128 0x1
+	.byte	0x5c
+	.byte	0x4
+	.uleb128 .LVL51-.Ltext0
+	.uleb128 .LVL61-.Ltext0
+	.uleb128 0x1
+	.byte	0x5c
+	.byte	0x4
+	.uleb128 .LVL61-.Ltext0
+	.uleb128 .LVL69-.Ltext0
+	.uleb128 0x4
+	.byte	0x91
+	.sleb128 -1096
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL70-.Ltext0
+	.uleb128 .LVL72-.Ltext0
+	.uleb128 0x1
+	.byte	0x5c
+	.byte	0
+.LVUS31:
+	.uleb128 .LVU186
+	.uleb128 .LVU191
+	.uleb128 .LVU191
+	.uleb128 .LVU211
+.LLST31:
+	.byte	0x4
+	.uleb128 .LVL52-.Ltext0
+	.uleb128 .LVL53-.Ltext0
+	.uleb128 0x2
+	.byte	0x30
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL53-.Ltext0
+	.uleb128 .LVL60-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0
+.LVUS32:
+	.uleb128 .LVU186
+	.uleb128 .LVU191
+	.uleb128 .LVU191
+	.uleb128 .LVU196
+	.uleb128 .LVU197
+	.uleb128 .LVU206
+	.uleb128 .LVU206
+	.uleb128 .LVU207
+.LLST32:
+	.byte	0x4
+	.uleb128 .LVL52-.Ltext0
+	.uleb128 .LVL53-.Ltext0
+	.uleb128 0x2
+	.byte	0x30
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL53-.Ltext0
+	.uleb128 .LVL55-.Ltext0
+	.uleb128 0x1
+	.byte	0x52
+	.byte	0x4
+	.uleb128 .LVL56-.Ltext0
+	.uleb128 .LVL58-.Ltext0
+	.uleb128 0x1
+	.byte	0x52
+	.byte	0x4
+	.uleb128 .LVL58-.Ltext0
+	.uleb128 .LVL59-.Ltext0
+	.uleb128 0x3
+	.byte	0x72
+	.sleb128 -1
+	.byte	0x9f
+	.byte	0
+.LVUS34:
+	.uleb128 .LVU186
+	.uleb128 .LVU191
+	.uleb128 .LVU191
+	.uleb128 .LVU199
+	.uleb128 .LVU199
+	.uleb128 .LVU200
+	.uleb128 .LVU200
+	.uleb128 .LVU211
+.LLST34:
+	.byte	0x4
+	.uleb128 .LVL52-.Ltext0
+	.uleb128 .LVL53-.Ltext0
+	.uleb128 0x2
+	.byte	0x30
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL53-.Ltext0
+	.uleb128 .LVL56-.Ltext0
+	.uleb128 0xb
+	.byte	0x70
+	.sleb128 0
+	.byte	0x91
+	.sleb128 0
+	.byte	0x1c
+	.byte	0x23
+	.uleb128 0x448
+	.byte	0x34
+	.byte	0x25
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL56-.Ltext0
+	.uleb128 .LVL57-.Ltext0
+	.uleb128 0xd
+	.byte	0x70
+	.sleb128 0
+	.byte	0x91
+	.sleb128 0
+	.byte	0x1c
+	.byte	0x23
+	.uleb128 0x448
+	.byte	0x34
+	.byte	0x25
+	.byte	0x23
+	.uleb128 0x1
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL57-.Ltext0
+	.uleb128 .LVL60-.Ltext0
+	.uleb128 0xd
+	.byte	0x70
+	.sleb128 0
+	.byte	0x91
+	.sleb128 0
+	.byte	0x1c
+	.byte	0x23
+	.uleb128 0x438
+	.byte	0x34
+	.byte	0x25
+	.byte	0x23
+	.uleb128 0x1
+	.byte	0x9f
+	.byte	0
+.LVUS35:
+	.uleb128 .LVU193
+	.uleb128 .LVU211
+.LLST35:
+	.byte	0x4
+	.uleb128 .LVL54-.Ltext0
+	.uleb128 .LVL60-.Ltext0
+	.uleb128 0x1
+	.byte	0x51
+	.byte	0
+.LVUS0:
+	.uleb128 0
+	.uleb128 .LVU7
+	.uleb128 .LVU7
+	.uleb128 0
+.LLST0:
+	.byte	0x4
+	.uleb128 .LVL0-.Ltext0
+	.uleb128 .LVL1-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL1-.Ltext0
+	.uleb128 .LFE21-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x9f
+	.byte	0
+.LVUS1:
+	.uleb128 .LVU26
+	.uleb128 0
+.LLST1:
+	.byte	0x4
+	.uleb128 .LVL7-.Ltext0
+	.uleb128 .LFE21-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0
+.LVUS3:
+	.uleb128 .LVU15
+	.uleb128 .LVU22
+	.uleb128 .LVU25
+	.uleb128 .LVU26
+.LLST3:
+	.byte	0x4
+	.uleb128 .LVL3-.Ltext0
+	.uleb128 .LVL5-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0x4
+	.uleb128 .LVL7-.Ltext0
+	.uleb128 .LVL7-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0
+.LVUS5:
+	.uleb128 .LVU32
+	.uleb128 .LVU80
+	.uleb128 .LVU84
+	.uleb128 0
+.LLST5:
+	.byte	0x4
+	.uleb128 .LVL8-.Ltext0
+	.uleb128 .LVL24-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0x4
+	.uleb128 .LVL26-.Ltext0
+	.uleb128 .LFE21-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0
+.LVUS7:
+	.uleb128 .LVU36
+	.uleb128 .LVU43
+	.uleb128 .LVU50
+	.uleb128 .LVU80
+.LLST7:
+	.byte	0x4
+	.uleb128 .LVL9-.Ltext0
+	.uleb128 .LVL11-.Ltext0
+	.uleb128 0x6
+	.byte	0xa0
+	.long	.Ldebug_info0+2615
+	.sleb128 0
+	.byte	0x4
+	.uleb128 .LVL15-.Ltext0
+	.uleb128 .LVL24-.Ltext0
+	.uleb128 0x6
+	.byte	0xa0
+	.long	.Ldebug_info0+2615
+	.sleb128 0
+	.byte	0
+.LVUS8:
+	.uleb128 .LVU36
+	.uleb128 .LVU43
+	.uleb128 .LVU50
+	.uleb128 .LVU80
+.LLST8:
+	.byte	0x4
+	.uleb128 .LVL9-.Ltext0
+	.uleb128 .LVL11-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0x4
+	.uleb128 .LVL15-.Ltext0
+	.uleb128 .LVL24-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0
+.LVUS9:
+	.uleb128 .LVU55
+	.uleb128 .LVU60
+	.uleb128 .LVU60
+	.uleb128 .LVU80
+.LLST9:
+	.byte	0x4
+	.uleb128 .LVL16-.Ltext0
+	.uleb128 .LVL17-.Ltext0
+	.uleb128 0x2
+	.byte	0x30
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL17-.Ltext0
+	.uleb128 .LVL24-.Ltext0
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0
+.LVUS10:
+	.uleb128 .LVU55
+	.uleb128 .LVU60
+	.uleb128 .LVU60
+	.uleb128 .LVU65
+	.uleb128 .LVU66
+	.uleb128 .LVU75
+	.uleb128 .LVU75
+	.uleb128 .LVU76
+.LLST10:
+	.byte	0x4
+	.uleb128 .LVL16-.Ltext0
+	.uleb128 .LVL17-.Ltext0
+	.uleb128 0x2
+	.byte	0x30
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL17-.Ltext0
+	.uleb128 .LVL19-.Ltext0
+	.uleb128 0x1
+	.byte	0x52
+	.byte	0x4
+	.uleb128 .LVL20-.Ltext0
+	.uleb128 .LVL22-.Ltext0
+	.uleb128 0x1
+	.byte	0x52
+	.byte	0x4
+	.uleb128 .LVL22-.Ltext0
+	.uleb128 .LVL23-.Ltext0
+	.uleb128 0x3
+	.byte	0x72
+	.sleb128 -1
+	.byte	0x9f
+	.byte	0
+.LVUS12:
+	.uleb128 .LVU55
+	.uleb128 .LVU60
+	.uleb128 .LVU60
+	.uleb128 .LVU68
+	.uleb128 .LVU68
+	.uleb128 .LVU69
+	.uleb128 .LVU69
+	.uleb128 .LVU80
+.LLST12:
+	.byte	0x4
+	.uleb128 .LVL16-.Ltext0
+	.uleb128 .LVL17-.Ltext0
+	.uleb128 0x2
+	.byte	0x30
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL17-.Ltext0
+	.uleb128 .LVL20-.Ltext0
+	.uleb128 0xb
+	.byte	0x70
+	.sleb128 0
+	.byte	0x73
+	.sleb128 0
+	.byte	0x1c
+	.byte	0x8
+	.byte	0x38
+	.byte	0x1c
+	.byte	0x34
+	.byte	0x25
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL20-.Ltext0
+	.uleb128 .LVL21-.Ltext0
+	.uleb128 0xd
+	.byte	0x70
+	.sleb128 0
+	.byte	0x73
+	.sleb128 0
+	.byte	0x1c
+	.byte	0x8
+	.byte	0x38
+	.byte	0x1c
+	.byte	0x34
+	.byte	0x25
+	.byte	0x23
+	.uleb128 0x1
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL21-.Ltext0
+	.uleb128 .LVL24-.Ltext0
+	.uleb128 0xd
+	.byte	0x70
+	.sleb128 0
+	.byte	0x73
+	.sleb128 0
+	.byte	0x1c
+	.byte	0x8
+	.byte	0x48
+	.byte	0x1c
+	.byte	0x34
+	.byte	0x25
+	.byte	0x23
+	.uleb128 0x1
+	.byte	0x9f
+	.byte	0
+.LVUS13:
+	.uleb128 .LVU62
+	.uleb128 .LVU80
+.LLST13:
+	.byte	0x4
+	.uleb128 .LVL18-.Ltext0
+	.uleb128 .LVL24-.Ltext0
+	.uleb128 0x1
+	.byte	0x51
+	.byte	0
+.Ldebug_loc3:
+	.section	.debug_aranges,"",@progbits
+	.long	0x2c
+	.value	0x2
+	.long	.Ldebug_info0
+	.byte	0x8
+	.byte	0
+	.value	0
+	.value	0
+	.quad	.Ltext0
+	.quad	.Letext0-.Ltext0
+	.quad	0
+	.quad	0
+	.section	.debug_rnglists,"",@progbits
+.Ldebug_ranges0:
+	.long	.Ldebug_ranges3-.Ldebug_ranges2
+.Ldebug_ranges2:
+	.value	0x5
+	.byte	0x8
+	.byte	0
+	.long	0
+.LLRL2:
+	.byte	0x4
+	.uleb128 .LBB16-.Ltext0
+	.uleb128 .LBE16-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB19-.Ltext0
+	.uleb128 .LBE19-.Ltext0
+	.byte	0
+.LLRL4:
+	.byte	0x4
+	.uleb128 .LBB20-.Ltext0
+	.uleb128 .LBE20-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB33-.Ltext0
+	.uleb128 .LBE33-.Ltext0
+	.byte	0
+.LLRL6:
+	.byte	0x4
+	.uleb128 .LBB22-.Ltext0
+	.uleb128 .LBE22-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB30-.Ltext0
+	.uleb128 .LBE30-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB31-.Ltext0
+	.uleb128 .LBE31-.Ltext0
+	.byte	0
+.LLRL11:
+	.byte	0x4
+	.uleb128 .LBB25-.Ltext0
+	.uleb128 .LBE25-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB27-.Ltext0
+	.uleb128 .LBE27-.Ltext0
+	.byte	0
+.LLRL19:
+	.byte	0x4
+	.uleb128 .LBB47-.Ltext0
+	.uleb128 .LBE47-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB48-.Ltext0
+	.uleb128 .LBE48-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB49-.Ltext0
+	.uleb128 .LBE49-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB50-.Ltext0
+	.uleb128 .LBE50-.Ltext0
+	.byte	0
+.LLRL21:
+	.byte	0x4
+	.uleb128 .LBB51-.Ltext0
+	.uleb128 .LBE51-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB52-.Ltext0
+	.uleb128 .LBE52-.Ltext0
+	.byte	0
+.LLRL22:
+	.byte	0x4
+	.uleb128 .LBB53-.Ltext0
+	.uleb128 .LBE53-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB66-.Ltext0
+	.uleb128 .LBE66-.Ltext0
+	.byte	0
+.LLRL25:
+	.byte	0x4
+	.uleb128 .LBB54-.Ltext0
+	.uleb128 .LBE54-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB65-.Ltext0
+	.uleb128 .LBE65-.Ltext0
+	.byte	0
+.LLRL26:
+	.byte	0x4
+	.uleb128 .LBB55-.Ltext0
+	.uleb128 .LBE55-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB63-.Ltext0
+	.uleb128 .LBE63-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB64-.Ltext0
+	.uleb128 .LBE64-.Ltext0
+	.byte	0
+.LLRL33:
+	.byte	0x4
+	.uleb128 .LBB58-.Ltext0
+	.uleb128 .LBE58-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB60-.Ltext0
+	.uleb128 .LBE60-.Ltext0
+	.byte	0
+.Ldebug_ranges3:
+	.section	.debug_line,"",@progbits
+.Ldebug_line0:
+	.section	.debug_str,"MS",@progbits,1
+.LASF35:
+	.string	"__g_refs"
+.LASF69:
+	.string	"work"
+.LASF60:
+	.string	"bpool_range"
+.LASF36:
+	.string	"__g_size"
+.LASF12:
+	.string	"size_t"
+.LASF89:
+	.string	"bpool_participate"
+.LASF55:
+	.string	"PTHREAD_MUTEX_DEFAULT"
+.LASF22:
+	.string	"__pthread_internal_list"
+.LASF77:
+	.string	"pthread_cond_broadcast"
+.LASF9:
+	.string	"__uint32_t"
+.LASF15:
+	.string	"__value64"
+.LASF45:
+	.string	"pthread_mutex_t"
+.LASF65:
+	.string	"active"
+.LASF20:
+	.string	"__next"
+.LASF16:
+	.string	"__value32"
+.LASF85:
+	.string	"most"
+.LASF56:
+	.string	"uint8_t"
+.LASF25:
+	.string	"__count"
+.LASF19:
+	.string	"__prev"
+.LASF83:
+	.string	"bpool_open"
+.LASF80:
+	.string	"pthread_mutex_lock"
+.LASF81:
+	.string	"nthreads"
+.LASF7:
+	.string	"short int"
+.LASF63:
+	.string	"width"
+.LASF75:
+	.string	"pthread_mutex_unlock"
+.LASF28:
+	.string	"__kind"
+.LASF46:
+	.string	"long long int"
+.LASF61:
+	.string	"bpool_job"
+.LASF79:
+	.string	"pthread_create"
+.LASF64:
+	.string	"joined"
+.LASF10:
+	.string	"long int"
+.LASF8:
+	.string	"__uint8_t"
+.LASF52:
+	.string	"PTHREAD_MUTEX_NORMAL"
+.LASF37:
+	.string	"__g1_orig_size"
+.LASF29:
+	.string	"__spins"
+.LASF50:
+	.string	"PTHREAD_MUTEX_ERRORCHECK_NP"
+.LASF2:
+	.string	"unsigned char"
+.LASF86:
+	.string	"GNU C99 12.2.0 -mtune=generic -march=x86-64 -g -O3 -std=c99 -fasynchronous-unwind-tables"
+.LASF23:
+	.string	"__pthread_mutex_s"
+.LASF49:
+	.string	"PTHREAD_MUTEX_RECURSIVE_NP"
+.LASF51:
+	.string	"PTHREAD_MUTEX_ADAPTIVE_NP"
+.LASF58:
+	.string	"blake2s_iv"
+.LASF32:
+	.string	"__pthread_cond_s"
+.LASF6:
+	.string	"signed char"
+.LASF17:
+	.string	"long long unsigned int"
+.LASF57:
+	.string	"uint32_t"
+.LASF87:
+	.string	"blake2s_pool_run"
+.LASF4:
+	.string	"unsigned int"
+.LASF5:
+	.string	"long unsigned int"
+.LASF66:
+	.string	"queued"
+.LASF13:
+	.string	"__low"
+.LASF18:
+	.string	"__atomic_wide_counter"
+.LASF41:
+	.string	"__size"
+.LASF3:
+	.string	"short unsigned int"
+.LASF44:
+	.string	"__data"
+.LASF11:
+	.string	"char"
+.LASF27:
+	.string	"__nusers"
+.LASF78:
+	.string	"pthread_detach"
+.LASF74:
+	.string	"bpool"
+.LASF67:
+	.string	"left"
+.LASF68:
+	.string	"lock"
+.LASF38:
+	.string	"__wrefs"
+.LASF21:
+	.string	"__pthread_list_t"
+.LASF34:
+	.string	"__g1_start"
+.LASF14:
+	.string	"__high"
+.LASF24:
+	.string	"__lock"
+.LASF71:
+	.string	"nworkers"
+.LASF59:
+	.string	"blake2s_sigma"
+.LASF47:
+	.string	"pthread_cond_t"
+.LASF70:
+	.string	"done"
+.LASF88:
+	.string	"bpool_worker"
+.LASF30:
+	.string	"__elision"
+.LASF76:
+	.string	"pthread_cond_wait"
+.LASF82:
+	.string	"link"
+.LASF54:
+	.string	"PTHREAD_MUTEX_ERRORCHECK"
+.LASF48:
+	.string	"PTHREAD_MUTEX_TIMED_NP"
+.LASF39:
+	.string	"__g_signals"
+.LASF26:
+	.string	"__owner"
+.LASF84:
+	.string	"bpool_take"
+.LASF53:
+	.string	"PTHREAD_MUTEX_RECURSIVE"
+.LASF73:
+	.string	"jobs"
+.LASF33:
+	.string	"__wseq"
+.LASF72:
+	.string	"wanted"
+.LASF43:
+	.string	"pthread_attr_t"
+.LASF40:
+	.string	"pthread_t"
+.LASF42:
+	.string	"__align"
+.LASF62:
+	.string	"next"
+.LASF31:
+	.string	"__list"
+	.section	.debug_line_str,"MS",@progbits,1
+.LASF1:
+	.string	"/root/repo"
+.LASF0:
+	.string	"blake2s-pool.c"
+	.ident	"GCC: (Debian 12.2.0-14+deb12u1) 12.2.0"
+	.section	.note.GNU-stack,"",@progbits
@@ -0,0 +1,378 @@
+#include "blake2s.h"
+#include "blake2s-internal.h"
+#include <immintrin.h>
+
+/* x86 SSE4.1 kernel: the same row layout as blake2s-altivec.c,
+ * with pshufb for the byte-sized rotations and a pshufd/pblendw
+ * message schedule per round. */
+
+static const u32 blake2s_viv[2][4] ALIGN(16) = {
+    { 0x6a09e667, 0xbb67ae85, 0x3c6ef372, 0xa54ff53a },
+    { 0x510e527f, 0x9b05688c, 0x1f83d9ab, 0x5be0cd19 },
+};
+
+/* pshufb masks rotating every 32-bit word right by 16 and 8 bits */
+static const u8 blake2s_vr16[16] ALIGN(16) =
+    { 2, 3, 0, 1,  6, 7, 4, 5, 10, 11,  8,  9, 14, 15, 12, 13 };
+static const u8 blake2s_vr8[16] ALIGN(16) =
+    { 1, 2, 3, 0,  5, 6, 7, 4,  9, 10, 11,  8, 13, 14, 15, 12 };
+
+/* Message schedule
+ *
+ * m0-m3 hold message words 0-3, 4-7, 8-11 and 12-15. For round r,
+ * b0 and b1 get the sigma(r) words for the first and second message
+ * input of G() on the columns, b2 and b3 the same for the diagonals.
+ * Each is assembled with pshufd (word moves within one source vector)
+ * and pblendw (merging words from different source vectors).
+ */
+#define B2S_LOAD_MSG_0(b0,b1,b2,b3) \
+    do { \
+        b0 = _mm_shuffle_epi32(m0, _MM_SHUFFLE(3,2,2,0)); \
+        t = _mm_shuffle_epi32(m1, _MM_SHUFFLE(2,0,1,0));  \
+        b0 = _mm_blend_epi16(b0, t, 0xF0);                \
+        b1 = _mm_shuffle_epi32(m0, _MM_SHUFFLE(3,2,3,1)); \
+        t = _mm_shuffle_epi32(m1, _MM_SHUFFLE(3,1,1,0));  \
+        b1 = _mm_blend_epi16(b1, t, 0xF0);                \
+        b2 = _mm_shuffle_epi32(m2, _MM_SHUFFLE(3,2,2,0)); \
+        t = _mm_shuffle_epi32(m3, _MM_SHUFFLE(2,0,1,0));  \
+        b2 = _mm_blend_epi16(b2, t, 0xF0);                \
+        b3 = _mm_shuffle_epi32(m2, _MM_SHUFFLE(3,2,3,1)); \
+        t = _mm_shuffle_epi32(m3, _MM_SHUFFLE(3,1,1,0));  \
+        b3 = _mm_blend_epi16(b3, t, 0xF0);                \
+    } while (0)
+
+#define B2S_LOAD_MSG_1(b0,b1,b2,b3) \
+    do { \
+        b0 = _mm_shuffle_epi32(m3, _MM_SHUFFLE(1,2,1,2)); \
+        t = _mm_shuffle_epi32(m1, _MM_SHUFFLE(3,2,0,0));  \
+        b0 = _mm_blend_epi16(b0, t, 0x0C);                \
+        t = _mm_shuffle_epi32(m2, _MM_SHUFFLE(3,1,1,0));  \
+        b0 = _mm_blend_epi16(b0, t, 0x30);                \
+        b1 = _mm_shuffle_epi32(m2, _MM_SHUFFLE(3,2,0,2)); \
+        t = _mm_shuffle_epi32(m3, _MM_SHUFFLE(3,3,1,0));  \
+        b1 = _mm_blend_epi16(b1, t, 0x30);                \
+        t = _mm_shuffle_epi32(m1, _MM_SHUFFLE(2,2,1,0));  \
+        b1 = _mm_blend_epi16(b1, t, 0xC0);                \
+        b2 = _mm_shuffle_epi32(m0, _MM_SHUFFLE(3,2,0,1)); \
+        t = _mm_shuffle_epi32(m2, _MM_SHUFFLE(3,3,1,0));  \
+        b2 = _mm_blend_epi16(b2, t, 0x30);                \
+        t = _mm_shuffle_epi32(m1, _MM_SHUFFLE(1,2,1,0));  \
+        b2 = _mm_blend_epi16(b2, t, 0xC0);                \
+        b3 = m3;                                          \
+        t = _mm_shuffle_epi32(m0, _MM_SHUFFLE(3,2,2,0));  \
+        b3 = _mm_blend_epi16(b3, t, 0xCC);                \
+        t = _mm_shuffle_epi32(m1, _MM_SHUFFLE(3,3,1,0));  \
+        b3 = _mm_blend_epi16(b3, t, 0x30);                \
+    } while (0)
+
+#define B2S_LOAD_MSG_2(b0,b1,b2,b3) \
+    do { \
+        b0 = _mm_shuffle_epi32(m2, _MM_SHUFFLE(3,2,1,3)); \
+        t = _mm_shuffle_epi32(m3, _MM_SHUFFLE(3,2,0,0));  \
+        b0 = _mm_blend_epi16(b0, t, 0xCC);                \
+        t = _mm_shuffle_epi32(m1, _MM_SHUFFLE(3,1,1,0));  \
+        b0 = _mm_blend_epi16(b0, t, 0x30);                \
+        b1 = m2;                                          \
+        t = _mm_shuffle_epi32(m0, _MM_SHUFFLE(3,2,0,0));  \
+        b1 = _mm_blend_epi16(b1, t, 0x3C);                \
+        t = _mm_shuffle_epi32(m3, _MM_SHUFFLE(1,2,1,0));  \
+        b1 = _mm_blend_epi16(b1, t, 0xC0);                \
+        b2 = _mm_shuffle_epi32(m2, _MM_SHUFFLE(1,2,1,2)); \
+        t = _mm_shuffle_epi32(m0, _MM_SHUFFLE(3,2,3,0));  \
+        b2 = _mm_blend_epi16(b2, t, 0x0C);                \
+        t = _mm_shuffle_epi32(m1, _MM_SHUFFLE(3,3,1,0));  \
+        b2 = _mm_blend_epi16(b2, t, 0x30);                \
+        b3 = _mm_shuffle_epi32(m3, _MM_SHUFFLE(3,2,1,2)); \
+        t = _mm_shuffle_epi32(m1, _MM_SHUFFLE(0,2,2,0));  \
+        b3 = _mm_blend_epi16(b3, t, 0xCC);                \
+        t = _mm_shuffle_epi32(m0, _MM_SHUFFLE(3,1,1,0));  \
+        b3 = _mm_blend_epi16(b3, t, 0x30);                \
+    } while (0)
+
+#define B2S_LOAD_MSG_3(b0,b1,b2,b3) \
+    do { \
+        b0 = _mm_shuffle_epi32(m1, _MM_SHUFFLE(3,2,1,3)); \
+        t = _mm_shuffle_epi32(m0, _MM_SHUFFLE(3,2,3,0));  \
+        b0 = _mm_blend_epi16(b0, t, 0x0C);                \
+        t = _mm_shuffle_epi32(m3, _MM_SHUFFLE(3,1,1,0));  \
+        b0 = _mm_blend_epi16(b0, t, 0x30);                \
+        t = m2;                                           \
+        b0 = _mm_blend_epi16(b0, t, 0xC0);                \
+        b1 = _mm_shuffle_epi32(m2, _MM_SHUFFLE(3,2,1,1)); \
+        t = m0;                                           \
+        b1 = _mm_blend_epi16(b1, t, 0x0C);                \
+        t = _mm_shuffle_epi32(m3, _MM_SHUFFLE(2,0,1,0));  \
+        b1 = _mm_blend_epi16(b1, t, 0xF0);                \
+        b2 = _mm_blend_epi16(m0, m1, 0x0F);               \
+        b2 = _mm_blend_epi16(b2, m3, 0xC0);               \
+        b2 = _mm_shuffle_epi32(b2, _MM_SHUFFLE(3,0,1,2)); \
+        b3 = _mm_shuffle_epi32(m1, _MM_SHUFFLE(3,2,1,2)); \
+        t = _mm_shuffle_epi32(m2, _MM_SHUFFLE(0,2,2,0));  \
+        b3 = _mm_blend_epi16(b3, t, 0xCC);                \
+        t = _mm_shuffle_epi32(m0, _MM_SHUFFLE(3,0,1,0));  \
+        b3 = _mm_blend_epi16(b3, t, 0x30);                \
+    } while (0)
+
+#define B2S_LOAD_MSG_4(b0,b1,b2,b3) \
+    do { \
+        b0 = _mm_shuffle_epi32(m2, _MM_SHUFFLE(2,2,1,1)); \
+        t = m1;                                           \
+        b0 = _mm_blend_epi16(b0, t, 0x0C);                \
+        t = m0;                                           \
+        b0 = _mm_blend_epi16(b0, t, 0x30);                \
+        b1 = m0;                                          \
+        t = _mm_shuffle_epi32(m1, _MM_SHUFFLE(3,0,3,0));  \
+        b1 = _mm_blend_epi16(b1, t, 0x3C);                \
+        t = m3;                                           \
+        b1 = _mm_blend_epi16(b1, t, 0xC0);                \
+        b2 = _mm_shuffle_epi32(m3, _MM_SHUFFLE(3,2,1,2)); \
+        t = _mm_shuffle_epi32(m2, _MM_SHUFFLE(3,2,3,0));  \
+        b2 = _mm_blend_epi16(b2, t, 0x0C);                \
+        t = m1;                                           \
+        b2 = _mm_blend_epi16(b2, t, 0x30);                \
+        t = m0;                                           \
+        b2 = _mm_blend_epi16(b2, t, 0xC0);                \
+        b3 = _mm_shuffle_epi32(m0, _MM_SHUFFLE(3,2,1,1)); \
+        t = _mm_shuffle_epi32(m3, _MM_SHUFFLE(1,2,0,0));  \
+        b3 = _mm_blend_epi16(b3, t, 0xCC);                \
+        t = _mm_shuffle_epi32(m2, _MM_SHUFFLE(3,0,1,0));  \
+        b3 = _mm_blend_epi16(b3, t, 0x30);                \
+    } while (0)
+
+#define B2S_LOAD_MSG_5(b0,b1,b2,b3) \
+    do { \
+        b0 = _mm_shuffle_epi32(m0, _MM_SHUFFLE(3,0,1,2)); \
+        t = _mm_shuffle_epi32(m1, _MM_SHUFFLE(3,2,2,0));  \
+        b0 = _mm_blend_epi16(b0, t, 0x0C);                \
+        t = _mm_shuffle_epi32(m2, _MM_SHUFFLE(0,2,1,0));  \
+        b0 = _mm_blend_epi16(b0, t, 0xC0);                \
+        b1 = m3;                                          \
+        t = _mm_shuffle_epi32(m2, _MM_SHUFFLE(3,3,2,0));  \
+        b1 = _mm_blend_epi16(b1, t, 0x3C);                \
+        t = m0;                                           \
+        b1 = _mm_blend_epi16(b1, t, 0xC0);                \
+        b2 = _mm_shuffle_epi32(m1, _MM_SHUFFLE(3,2,3,0)); \
+        t = _mm_shuffle_epi32(m3, _MM_SHUFFLE(3,3,1,0));  \
+        b2 = _mm_blend_epi16(b2, t, 0x30);                \
+        t = _mm_shuffle_epi32(m0, _MM_SHUFFLE(1,2,1,0));  \
+        b2 = _mm_blend_epi16(b2, t, 0xC0);                \
+        b3 = _mm_shuffle_epi32(m3, _MM_SHUFFLE(3,2,1,1)); \
+        t = m1;                                           \
+        b3 = _mm_blend_epi16(b3, t, 0x0C);                \
+        t = _mm_shuffle_epi32(m2, _MM_SHUFFLE(1,2,1,0));  \
+        b3 = _mm_blend_epi16(b3, t, 0xC0);                \
+    } while (0)
+
+#define B2S_LOAD_MSG_6(b0,b1,b2,b3) \
+    do { \
+        b0 = m3;                                          \
+        t = m0;                                           \
+        b0 = _mm_blend_epi16(b0, t, 0x0C);                \
+        t = _mm_shuffle_epi32(m1, _MM_SHUFFLE(0,2,1,0));  \
+        b0 = _mm_blend_epi16(b0, t, 0xC0);                \
+        b1 = _mm_shuffle_epi32(m1, _MM_SHUFFLE(3,2,1,1)); \
+        t = _mm_shuffle_epi32(m3, _MM_SHUFFLE(3,1,3,0));  \
+        b1 = _mm_blend_epi16(b1, t, 0x3C);                \
+        t = _mm_shuffle_epi32(m2, _MM_SHUFFLE(2,2,1,0));  \
+        b1 = _mm_blend_epi16(b1, t, 0xC0);                \
+        b2 = m0;                                          \
+        t = _mm_shuffle_epi32(m1, _MM_SHUFFLE(3,2,2,0));  \
+        b2 = _mm_blend_epi16(b2, t, 0x0C);                \
+        t = _mm_shuffle_epi32(m2, _MM_SHUFFLE(0,1,1,0));  \
+        b2 = _mm_blend_epi16(b2, t, 0xF0);                \
+        b3 = _mm_shuffle_epi32(m1, _MM_SHUFFLE(3,2,1,3)); \
+        t = _mm_shuffle_epi32(m0, _MM_SHUFFLE(3,2,3,0));  \
+        b3 = _mm_blend_epi16(b3, t, 0x3C);                \
+        t = m2;                                           \
+        b3 = _mm_blend_epi16(b3, t, 0xC0);                \
+    } while (0)
+
+#define B2S_LOAD_MSG_7(b0,b1,b2,b3) \
+    do { \
+        b0 = _mm_shuffle_epi32(m3, _MM_SHUFFLE(3,0,1,1)); \
+        t = _mm_shuffle_epi32(m1, _MM_SHUFFLE(3,2,3,0));  \
+        b0 = _mm_blend_epi16(b0, t, 0x0C);                \
+        t = m0;                                           \
+        b0 = _mm_blend_epi16(b0, t, 0xC0);                \
+        b1 = _mm_shuffle_epi32(m2, _MM_SHUFFLE(1,2,1,3)); \
+        t = _mm_shuffle_epi32(m3, _MM_SHUFFLE(3,2,2,0));  \
+        b1 = _mm_blend_epi16(b1, t, 0x0C);                \
+        t = _mm_shuffle_epi32(m0, _MM_SHUFFLE(3,1,1,0));  \
+        b1 = _mm_blend_epi16(b1, t, 0x30);                \
+        b2 = _mm_blend_epi16(m1, m3, 0xC0);               \
+        b2 = _mm_blend_epi16(b2, m2, 0x03);               \
+        b2 = _mm_blend_epi16(b2, m0, 0x30);               \
+        b2 = _mm_shuffle_epi32(b2, _MM_SHUFFLE(2,0,3,1)); \
+        b3 = m0;                                          \
+        t = _mm_shuffle_epi32(m1, _MM_SHUFFLE(3,2,0,0));  \
+        b3 = _mm_blend_epi16(b3, t, 0x3C);                \
+        t = _mm_shuffle_epi32(m2, _MM_SHUFFLE(2,2,1,0));  \
+        b3 = _mm_blend_epi16(b3, t, 0xC0);                \
+    } while (0)
+
+#define B2S_LOAD_MSG_8(b0,b1,b2,b3) \
+    do { \
+        b0 = _mm_shuffle_epi32(m1, _MM_SHUFFLE(3,2,1,2)); \
+        t = _mm_shuffle_epi32(m3, _MM_SHUFFLE(3,2,2,0));  \
+        b0 = _mm_blend_epi16(b0, t, 0x0C);                \
+        t = _mm_shuffle_epi32(m2, _MM_SHUFFLE(3,3,1,0));  \
+        b0 = _mm_blend_epi16(b0, t, 0x30);                \
+        t = _mm_shuffle_epi32(m0, _MM_SHUFFLE(0,2,1,0));  \
+        b0 = _mm_blend_epi16(b0, t, 0xC0);                \
+        b1 = _mm_shuffle_epi32(m3, _MM_SHUFFLE(3,2,1,3)); \
+        t = _mm_shuffle_epi32(m2, _MM_SHUFFLE(0,2,1,0));  \
+        b1 = _mm_blend_epi16(b1, t, 0xCC);                \
+        t = _mm_shuffle_epi32(m0, _MM_SHUFFLE(3,3,1,0));  \
+        b1 = _mm_blend_epi16(b1, t, 0x30);                \
+        b2 = m3;                                          \
+        t = _mm_shuffle_epi32(m0, _MM_SHUFFLE(3,1,1,0));  \
+        b2 = _mm_blend_epi16(b2, t, 0x30);                \
+        t = _mm_shuffle_epi32(m2, _MM_SHUFFLE(2,2,1,0));  \
+        b2 = _mm_blend_epi16(b2, t, 0xC0);                \
+        b3 = _mm_blend_epi16(m0, m1, 0xCF);               \
+        b3 = _mm_shuffle_epi32(b3, _MM_SHUFFLE(1,0,3,2)); \
+    } while (0)
+
+#define B2S_LOAD_MSG_9(b0,b1,b2,b3) \
+    do { \
+        b0 = _mm_blend_epi16(m2, m1, 0xC0);               \
+        b0 = _mm_blend_epi16(b0, m0, 0x0C);               \
+        b0 = _mm_shuffle_epi32(b0, _MM_SHUFFLE(1,3,0,2)); \
+        b1 = _mm_shuffle_epi32(m0, _MM_SHUFFLE(3,2,1,2)); \
+        t = _mm_shuffle_epi32(m1, _MM_SHUFFLE(1,2,0,0));  \
+        b1 = _mm_blend_epi16(b1, t, 0xFC);                \
+        b2 = _mm_shuffle_epi32(m3, _MM_SHUFFLE(1,2,1,3)); \
+        t = m2;                                           \
+        b2 = _mm_blend_epi16(b2, t, 0x0C);                \
+        t = _mm_shuffle_epi32(m0, _MM_SHUFFLE(3,3,1,0));  \
+        b2 = _mm_blend_epi16(b2, t, 0x30);                \
+        b3 = _mm_shuffle_epi32(m2, _MM_SHUFFLE(3,2,1,3)); \
+        t = _mm_shuffle_epi32(m3, _MM_SHUFFLE(3,0,2,0));  \
+        b3 = _mm_blend_epi16(b3, t, 0x3C);                \
+        t = _mm_shuffle_epi32(m0, _MM_SHUFFLE(0,2,1,0));  \
+        b3 = _mm_blend_epi16(b3, t, 0xC0);                \
+    } while (0)
+
+static inline void blake2s_10rounds(__m128i va, __m128i vb, __m128i vc,
+                                    __m128i vd, __m128i H[2],
+                                    __m128i m0, __m128i m1,
+                                    __m128i m2, __m128i m3)
+{
+    const __m128i vr16 = _mm_load_si128((const __m128i *)blake2s_vr16);
+    const __m128i vr8  = _mm_load_si128((const __m128i *)blake2s_vr8);
+    __m128i b0, b1, b2, b3, t;
+
+#define ror16(v) _mm_shuffle_epi8(v, vr16)
+#define ror12(v) _mm_or_si128(_mm_srli_epi32(v, 12), _mm_slli_epi32(v, 20))
+#define ror8(v)  _mm_shuffle_epi8(v, vr8)
+#define ror7(v)  _mm_or_si128(_mm_srli_epi32(v,  7), _mm_slli_epi32(v, 25))
+#define add(x,y) _mm_add_epi32(x, y)
+#define xor(x,y) _mm_xor_si128(x, y)
+
+#define BLAKE2S_VG(M,N,a,b,c,d) \
+    do { \
+        (a) = add(add(a, b), M);     \
+        (d) = ror16(xor(d, a));      \
+        (c) = add(c, d);             \
+        (b) = ror12(xor(b, c));      \
+        (a) = add(add(a, b), N);     \
+        (d) = ror8(xor(d, a));       \
+        (c) = add(c, d);             \
+        (b) = ror7(xor(b, c));       \
+    } while (0)
+
+    /* _mm_shuffle_epi32(x, _MM_SHUFFLE(0,3,2,1)) is vec_sld(x, x, 4) */
+#define FULLROUND(r) \
+    do { \
+        B2S_LOAD_MSG_ ## r(b0, b1, b2, b3); \
+        \
+        /* First half:  apply G() on rows */ \
+        BLAKE2S_VG(b0,b1,va,vb,vc,vd); \
+        \
+        /* Second half: apply G() on diagonals */ \
+        vb = _mm_shuffle_epi32(vb, _MM_SHUFFLE(0,3,2,1)); \
+        vc = _mm_shuffle_epi32(vc, _MM_SHUFFLE(1,0,3,2)); \
+        vd = _mm_shuffle_epi32(vd, _MM_SHUFFLE(2,1,0,3)); \
+        BLAKE2S_VG(b2,b3,va,vb,vc,vd); \
+        vb = _mm_shuffle_epi32(vb, _MM_SHUFFLE(2,1,0,3)); \
+        vc = _mm_shuffle_epi32(vc, _MM_SHUFFLE(1,0,3,2)); \
+        vd = _mm_shuffle_epi32(vd, _MM_SHUFFLE(0,3,2,1)); \
+    } while (0)
+
+    /* 10 rounds times 2 applications of G */
+    FULLROUND(0);
+    FULLROUND(1);
+    FULLROUND(2);
+    FULLROUND(3);
+    FULLROUND(4);
+    FULLROUND(5);
+    FULLROUND(6);
+    FULLROUND(7);
+    FULLROUND(8);
+    FULLROUND(9);
+
+    H[0] = xor(H[0], xor(va, vc));
+    H[1] = xor(H[1], xor(vb, vd));
+}
+
+void blake2s_compress_sse(struct blake2s_ctx *ctx, const void *m)
+{
+    const __m128i *p = m;
+    __m128i H[2];
+    __m128i va, vb, vc, vd;
+    __m128i vpr;
+    va = H[0] = _mm_load_si128((const __m128i *)ctx->H + 0);
+    vb = H[1] = _mm_load_si128((const __m128i *)ctx->H + 1);
+          vpr = _mm_load_si128((const __m128i *)ctx->t); /* t[0], t[1], f[0], f[1] */
+    vc = _mm_load_si128((const __m128i *)blake2s_viv[0]);
+    vd = _mm_xor_si128(_mm_load_si128((const __m128i *)blake2s_viv[1]), vpr);
+
+    blake2s_10rounds(va,vb,vc,vd, H, _mm_loadu_si128(p + 0),
+                     _mm_loadu_si128(p + 1), _mm_loadu_si128(p + 2),
+                     _mm_loadu_si128(p + 3));
+
+    _mm_store_si128((__m128i *)ctx->H + 0, H[0]);
+    _mm_store_si128((__m128i *)ctx->H + 1, H[1]);
+}
+
+void blake2s_compress_blocks_sse(struct blake2s_ctx *ctx, const void *m,
+                                 size_t nblocks)
+{
+    /* t[0], t[1] read as one little endian 64-bit counter */
+    const __m128i vinc = _mm_set_epi64x(0, BLAKE2S_BLOCK);
+    const __m128i *p = m;
+    __m128i H[2];
+    __m128i vpr;
+    __m128i m0, m1, m2, m3;
+
+    if (!nblocks)
+        return;
+    H[0] = _mm_load_si128((const __m128i *)ctx->H + 0);
+    H[1] = _mm_load_si128((const __m128i *)ctx->H + 1);
+    vpr  = _mm_load_si128((const __m128i *)ctx->t);
+
+    m0 = _mm_loadu_si128(p + 0);
+    m1 = _mm_loadu_si128(p + 1);
+    m2 = _mm_loadu_si128(p + 2);
+    m3 = _mm_loadu_si128(p + 3);
+    while (nblocks--) {
+        __m128i b0 = m0, b1 = m1, b2 = m2, b3 = m3;
+        /* load the next block before compressing this one */
+        p += 4;
+        if (nblocks) {
+            m0 = _mm_loadu_si128(p + 0);
+            m1 = _mm_loadu_si128(p + 1);
+            m2 = _mm_loadu_si128(p + 2);
+            m3 = _mm_loadu_si128(p + 3);
+        }
+        vpr = _mm_add_epi64(vpr, vinc);
+        blake2s_10rounds(H[0], H[1],
+                         _mm_load_si128((const __m128i *)blake2s_viv[0]),
+                         _mm_xor_si128(_mm_load_si128((const __m128i *)blake2s_viv[1]), vpr),
+                         H, b0, b1, b2, b3);
+    }
+
+    _mm_store_si128((__m128i *)ctx->H + 0, H[0]);
+    _mm_store_si128((__m128i *)ctx->H + 1, H[1]);
+    _mm_store_si128((__m128i *)ctx->t, vpr);
+}
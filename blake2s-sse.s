@@ -0,0 +1,39189 @@
+	.file	"blake2s-sse.c"
+# GNU C99 (Debian 12.2.0-14+deb12u1) version 12.2.0 (x86_64-linux-gnu)
+#	compiled by GNU C version 12.2.0, GMP version 6.2.1, MPFR version 4.2.0, MPC version 1.3.1, isl version isl-0.25-GMP
+
+# GGC heuristics: --param ggc-min-expand=100 --param ggc-min-heapsize=131072
+# options passed: -msse4.1 -mtune=generic -march=x86-64 -g -O3 -std=c99 -fasynchronous-unwind-tables
+	.text
+.Ltext0:
+	.file 0 "/root/repo" "blake2s-sse.c"
+	.p2align 4
+	.type	blake2s_10rounds.constprop.0, @function
+blake2s_10rounds.constprop.0:
+.LVL0:
+.LFB6406:
+	.file 1 "blake2s-sse.c"
+	.loc 1 256 20 view -0
+	.cfi_startproc
+	.loc 1 261 5 view .LVU1
+	.loc 1 262 5 view .LVU2
+	.loc 1 263 5 view .LVU3
+	.loc 1 303 5 view .LVU4
+	.loc 1 303 10 view .LVU5
+	.loc 1 303 15 view .LVU6
+.LBB2465:
+.LBI2465:
+	.file 2 "/usr/lib/gcc/x86_64-linux-gnu/12/include/emmintrin.h"
+	.loc 2 1456 1 view .LVU7
+.LBB2466:
+	.loc 2 1458 3 view .LVU8
+# /usr/lib/gcc/x86_64-linux-gnu/12/include/emmintrin.h:1458:   return (__m128i)__builtin_ia32_pshufd ((__v4si)__A, __mask);
+	.loc 2 1458 19 is_stmt 0 view .LVU9
+	pshufd	$232, %xmm3, %xmm12	#, m0, tmp1239
+.LVL1:
+	.loc 2 1458 19 view .LVU10
+.LBE2466:
+.LBE2465:
+	.loc 1 303 7 is_stmt 1 view .LVU11
+.LBB2467:
+.LBI2467:
+	.loc 2 1456 1 view .LVU12
+.LBB2468:
+	.loc 2 1458 3 view .LVU13
+# /usr/lib/gcc/x86_64-linux-gnu/12/include/emmintrin.h:1458:   return (__m128i)__builtin_ia32_pshufd ((__v4si)__A, __mask);
+	.loc 2 1458 19 is_stmt 0 view .LVU14
+	pshufd	$132, %xmm4, %xmm7	#, m1, tmp1241
+.LVL2:
+	.loc 2 1458 19 view .LVU15
+.LBE2468:
+.LBE2467:
+	.loc 1 303 7 is_stmt 1 view .LVU16
+.LBB2469:
+.LBI2469:
+	.file 3 "/usr/lib/gcc/x86_64-linux-gnu/12/include/smmintrin.h"
+	.loc 3 166 1 view .LVU17
+.LBB2470:
+	.loc 3 168 3 view .LVU18
+.LBE2470:
+.LBE2469:
+.LBB2473:
+.LBB2474:
+# /usr/lib/gcc/x86_64-linux-gnu/12/include/emmintrin.h:1066:   return (__m128i) ((__v4su)__A + (__v4su)__B);
+	.loc 2 1066 33 is_stmt 0 view .LVU19
+	paddd	%xmm1, %xmm0	# vb, tmp1267
+.LVL3:
+	.loc 2 1066 33 view .LVU20
+.LBE2474:
+.LBE2473:
+# blake2s-sse.c:256: static inline void blake2s_10rounds(__m128i va, __m128i vb, __m128i vc,
+	.loc 1 256 20 view .LVU21
+	subq	$32, %rsp	#,
+	.cfi_def_cfa_offset 40
+.LBB2476:
+.LBB2471:
+# /usr/lib/gcc/x86_64-linux-gnu/12/include/smmintrin.h:168:   return (__m128i) __builtin_ia32_pblendw128 ((__v8hi)__X,
+	.loc 3 168 20 view .LVU22
+	movdqa	%xmm12, %xmm8	# tmp1239, tmp1243
+.LBE2471:
+.LBE2476:
+.LBB2477:
+.LBB2478:
+# /usr/lib/gcc/x86_64-linux-gnu/12/include/emmintrin.h:1458:   return (__m128i)__builtin_ia32_pshufd ((__v4si)__A, __mask);
+	.loc 2 1458 19 view .LVU23
+	pshufd	$212, %xmm4, %xmm13	#, m1, tmp1248
+.LBE2478:
+.LBE2477:
+.LBB2480:
+.LBB2481:
+	pshufd	$237, %xmm3, %xmm9	#, m0, tmp1246
+.LBE2481:
+.LBE2480:
+.LBB2483:
+.LBB2472:
+# /usr/lib/gcc/x86_64-linux-gnu/12/include/smmintrin.h:168:   return (__m128i) __builtin_ia32_pblendw128 ((__v8hi)__X,
+	.loc 3 168 20 view .LVU24
+	pblendw	$240, %xmm7, %xmm8	#, tmp1241, tmp1243
+.LVL4:
+	.loc 3 168 20 view .LVU25
+.LBE2472:
+.LBE2483:
+	.loc 1 303 42 is_stmt 1 view .LVU26
+.LBB2484:
+.LBI2480:
+	.loc 2 1456 1 view .LVU27
+.LBB2482:
+	.loc 2 1458 3 view .LVU28
+	.loc 2 1458 3 is_stmt 0 view .LVU29
+.LBE2482:
+.LBE2484:
+	.loc 1 303 7 is_stmt 1 view .LVU30
+.LBB2485:
+.LBI2477:
+	.loc 2 1456 1 view .LVU31
+.LBB2479:
+	.loc 2 1458 3 view .LVU32
+	.loc 2 1458 3 is_stmt 0 view .LVU33
+.LBE2479:
+.LBE2485:
+	.loc 1 303 7 is_stmt 1 view .LVU34
+.LBB2486:
+.LBI2486:
+	.loc 3 166 1 view .LVU35
+.LBB2487:
+	.loc 3 168 3 view .LVU36
+# /usr/lib/gcc/x86_64-linux-gnu/12/include/smmintrin.h:168:   return (__m128i) __builtin_ia32_pblendw128 ((__v8hi)__X,
+	.loc 3 168 20 is_stmt 0 view .LVU37
+	pblendw	$240, %xmm13, %xmm9	#, tmp1248, tmp1250
+.LVL5:
+	.loc 3 168 20 view .LVU38
+.LBE2487:
+.LBE2486:
+	.loc 1 303 42 is_stmt 1 view .LVU39
+.LBB2488:
+.LBI2488:
+	.loc 2 1456 1 view .LVU40
+.LBB2489:
+	.loc 2 1458 3 view .LVU41
+.LBE2489:
+.LBE2488:
+.LBB2491:
+.LBB2492:
+# /usr/lib/gcc/x86_64-linux-gnu/12/include/emmintrin.h:1458:   return (__m128i)__builtin_ia32_pshufd ((__v4si)__A, __mask);
+	.loc 2 1458 19 is_stmt 0 view .LVU42
+	pshufd	$132, %xmm6, %xmm10	#, m3, tmp1255
+.LBE2492:
+.LBE2491:
+.LBB2494:
+.LBB2495:
+# /usr/lib/gcc/x86_64-linux-gnu/12/include/emmintrin.h:1066:   return (__m128i) ((__v4su)__A + (__v4su)__B);
+	.loc 2 1066 33 view .LVU43
+	paddd	%xmm8, %xmm0	# tmp1243, _35
+.LBE2495:
+.LBE2494:
+.LBB2497:
+.LBB2490:
+# /usr/lib/gcc/x86_64-linux-gnu/12/include/emmintrin.h:1458:   return (__m128i)__builtin_ia32_pshufd ((__v4si)__A, __mask);
+	.loc 2 1458 19 view .LVU44
+	pshufd	$232, %xmm5, %xmm7	#, m2, tmp1253
+.LVL6:
+	.loc 2 1458 19 view .LVU45
+.LBE2490:
+.LBE2497:
+	.loc 1 303 7 is_stmt 1 view .LVU46
+.LBB2498:
+.LBI2491:
+	.loc 2 1456 1 view .LVU47
+.LBB2493:
+	.loc 2 1458 3 view .LVU48
+	.loc 2 1458 3 is_stmt 0 view .LVU49
+.LBE2493:
+.LBE2498:
+	.loc 1 303 7 is_stmt 1 view .LVU50
+.LBB2499:
+.LBI2499:
+	.loc 3 166 1 view .LVU51
+.LBB2500:
+	.loc 3 168 3 view .LVU52
+.LBE2500:
+.LBE2499:
+.LBB2502:
+.LBB2503:
+# /usr/lib/gcc/x86_64-linux-gnu/12/include/emmintrin.h:1066:   return (__m128i) ((__v4su)__A + (__v4su)__B);
+	.loc 2 1066 33 is_stmt 0 view .LVU53
+	movdqa	.LC1(%rip), %xmm8	#, _44
+.LVL7:
+	.loc 2 1066 33 view .LVU54
+.LBE2503:
+.LBE2502:
+.LBB2506:
+.LBB2507:
+# /usr/lib/gcc/x86_64-linux-gnu/12/include/emmintrin.h:1458:   return (__m128i)__builtin_ia32_pshufd ((__v4si)__A, __mask);
+	.loc 2 1458 19 view .LVU55
+	pshufd	$212, %xmm6, %xmm11	#, m3, tmp1262
+.LBE2507:
+.LBE2506:
+.LBB2509:
+.LBB2510:
+# /usr/lib/gcc/x86_64-linux-gnu/12/include/emmintrin.h:1329:   return (__m128i) ((__v2du)__A ^ (__v2du)__B);
+	.loc 2 1329 33 view .LVU56
+	pxor	%xmm0, %xmm2	# _35, tmp1268
+.LVL8:
+	.loc 2 1329 33 view .LVU57
+.LBE2510:
+.LBE2509:
+.LBB2512:
+.LBB2513:
+# /usr/lib/gcc/x86_64-linux-gnu/12/include/emmintrin.h:1066:   return (__m128i) ((__v4su)__A + (__v4su)__B);
+	.loc 2 1066 33 view .LVU58
+	paddd	%xmm9, %xmm0	# tmp1250, tmp1277
+.LBE2513:
+.LBE2512:
+.LBB2515:
+.LBB2501:
+# /usr/lib/gcc/x86_64-linux-gnu/12/include/smmintrin.h:168:   return (__m128i) __builtin_ia32_pblendw128 ((__v8hi)__X,
+	.loc 3 168 20 view .LVU59
+	pblendw	$240, %xmm10, %xmm7	#, tmp1255, tmp1257
+.LVL9:
+	.loc 3 168 20 view .LVU60
+.LBE2501:
+.LBE2515:
+	.loc 1 303 42 is_stmt 1 view .LVU61
+.LBB2516:
+.LBI2516:
+	.loc 2 1456 1 view .LVU62
+.LBB2517:
+	.loc 2 1458 3 view .LVU63
+.LBE2517:
+.LBE2516:
+.LBB2519:
+.LBB2520:
+# /usr/lib/gcc/x86_64-linux-gnu/12/include/tmmintrin.h:138:   return (__m128i) __builtin_ia32_pshufb128 ((__v16qi)__X, (__v16qi)__Y);
+	.file 4 "/usr/lib/gcc/x86_64-linux-gnu/12/include/tmmintrin.h"
+	.loc 4 138 20 is_stmt 0 view .LVU64
+	pshufb	.LC0(%rip), %xmm2	#, tmp1269
+.LBE2520:
+.LBE2519:
+.LBB2522:
+.LBB2518:
+# /usr/lib/gcc/x86_64-linux-gnu/12/include/emmintrin.h:1458:   return (__m128i)__builtin_ia32_pshufd ((__v4si)__A, __mask);
+	.loc 2 1458 19 view .LVU65
+	pshufd	$237, %xmm5, %xmm15	#, m2, tmp1260
+.LVL10:
+	.loc 2 1458 19 view .LVU66
+.LBE2518:
+.LBE2522:
+	.loc 1 303 7 is_stmt 1 view .LVU67
+.LBB2523:
+.LBI2506:
+	.loc 2 1456 1 view .LVU68
+.LBB2508:
+	.loc 2 1458 3 view .LVU69
+	.loc 2 1458 3 is_stmt 0 view .LVU70
+.LBE2508:
+.LBE2523:
+	.loc 1 303 7 is_stmt 1 view .LVU71
+.LBB2524:
+.LBI2524:
+	.loc 3 166 1 view .LVU72
+.LBB2525:
+	.loc 3 168 3 view .LVU73
+.LBE2525:
+.LBE2524:
+.LBB2527:
+.LBB2504:
+# /usr/lib/gcc/x86_64-linux-gnu/12/include/emmintrin.h:1066:   return (__m128i) ((__v4su)__A + (__v4su)__B);
+	.loc 2 1066 33 is_stmt 0 view .LVU74
+	paddd	%xmm2, %xmm8	# tmp1269, _44
+.LBE2504:
+.LBE2527:
+.LBB2528:
+.LBB2526:
+# /usr/lib/gcc/x86_64-linux-gnu/12/include/smmintrin.h:168:   return (__m128i) __builtin_ia32_pblendw128 ((__v8hi)__X,
+	.loc 3 168 20 view .LVU75
+	pblendw	$240, %xmm11, %xmm15	#, tmp1262, tmp1264
+.LVL11:
+	.loc 3 168 20 view .LVU76
+.LBE2526:
+.LBE2528:
+	.loc 1 303 13 is_stmt 1 view .LVU77
+	.loc 1 303 55 view .LVU78
+	.loc 1 303 60 view .LVU79
+.LBB2529:
+.LBI2473:
+	.loc 2 1064 1 view .LVU80
+.LBB2475:
+	.loc 2 1066 3 view .LVU81
+	.loc 2 1066 3 is_stmt 0 view .LVU82
+.LBE2475:
+.LBE2529:
+.LBB2530:
+.LBI2494:
+	.loc 2 1064 1 is_stmt 1 view .LVU83
+.LBB2496:
+	.loc 2 1066 3 view .LVU84
+	.loc 2 1066 3 is_stmt 0 view .LVU85
+.LBE2496:
+.LBE2530:
+	.loc 1 303 109 is_stmt 1 view .LVU86
+.LBB2531:
+.LBI2509:
+	.loc 2 1327 1 view .LVU87
+.LBB2511:
+	.loc 2 1329 3 view .LVU88
+	.loc 2 1329 3 is_stmt 0 view .LVU89
+.LBE2511:
+.LBE2531:
+.LBB2532:
+.LBI2519:
+	.loc 4 136 1 is_stmt 1 view .LVU90
+.LBB2521:
+	.loc 4 138 3 view .LVU91
+	.loc 4 138 3 is_stmt 0 view .LVU92
+.LBE2521:
+.LBE2532:
+	.loc 1 303 163 is_stmt 1 view .LVU93
+.LBB2533:
+.LBI2502:
+	.loc 2 1064 1 view .LVU94
+.LBB2505:
+	.loc 2 1066 3 view .LVU95
+	.loc 2 1066 3 is_stmt 0 view .LVU96
+.LBE2505:
+.LBE2533:
+	.loc 1 303 193 is_stmt 1 view .LVU97
+.LBB2534:
+.LBI2534:
+	.loc 2 1327 1 view .LVU98
+.LBB2535:
+	.loc 2 1329 3 view .LVU99
+	.loc 2 1329 3 is_stmt 0 view .LVU100
+.LBE2535:
+.LBE2534:
+.LBB2537:
+.LBI2537:
+	.loc 2 1184 1 is_stmt 1 view .LVU101
+.LBB2538:
+	.loc 2 1186 3 view .LVU102
+.LBE2538:
+.LBE2537:
+.LBB2541:
+.LBB2536:
+# /usr/lib/gcc/x86_64-linux-gnu/12/include/emmintrin.h:1329:   return (__m128i) ((__v2du)__A ^ (__v2du)__B);
+	.loc 2 1329 33 is_stmt 0 view .LVU103
+	pxor	%xmm8, %xmm1	# _44, tmp1272
+.LVL12:
+	.loc 2 1329 33 view .LVU104
+.LBE2536:
+.LBE2541:
+.LBB2542:
+.LBB2539:
+# /usr/lib/gcc/x86_64-linux-gnu/12/include/emmintrin.h:1186:   return (__m128i)__builtin_ia32_pslldi128 ((__v4si)__A, __B);
+	.loc 2 1186 19 view .LVU105
+	movdqa	%xmm1, %xmm14	# tmp1272, tmp1273
+.LBE2539:
+.LBE2542:
+.LBB2543:
+.LBB2544:
+# /usr/lib/gcc/x86_64-linux-gnu/12/include/emmintrin.h:1251:   return (__m128i)__builtin_ia32_psrldi128 ((__v4si)__A, __B);
+	.loc 2 1251 19 view .LVU106
+	psrld	$12, %xmm1	#, tmp1275
+.LVL13:
+	.loc 2 1251 19 view .LVU107
+.LBE2544:
+.LBE2543:
+.LBB2546:
+.LBB2540:
+# /usr/lib/gcc/x86_64-linux-gnu/12/include/emmintrin.h:1186:   return (__m128i)__builtin_ia32_pslldi128 ((__v4si)__A, __B);
+	.loc 2 1186 19 view .LVU108
+	pslld	$20, %xmm14	#, tmp1273
+.LVL14:
+	.loc 2 1186 19 view .LVU109
+.LBE2540:
+.LBE2546:
+.LBB2547:
+.LBI2543:
+	.loc 2 1249 1 is_stmt 1 view .LVU110
+.LBB2545:
+	.loc 2 1251 3 view .LVU111
+	.loc 2 1251 3 is_stmt 0 view .LVU112
+.LBE2545:
+.LBE2547:
+.LBB2548:
+.LBI2548:
+	.loc 2 1321 1 is_stmt 1 view .LVU113
+.LBB2549:
+	.loc 2 1323 3 view .LVU114
+# /usr/lib/gcc/x86_64-linux-gnu/12/include/emmintrin.h:1323:   return (__m128i) ((__v2du)__A | (__v2du)__B);
+	.loc 2 1323 33 is_stmt 0 view .LVU115
+	por	%xmm14, %xmm1	# tmp1273, _53
+.LVL15:
+	.loc 2 1323 33 view .LVU116
+.LBE2549:
+.LBE2548:
+	.loc 1 303 300 is_stmt 1 view .LVU117
+.LBB2550:
+.LBI2550:
+	.loc 2 1064 1 view .LVU118
+.LBB2551:
+	.loc 2 1066 3 view .LVU119
+	.loc 2 1066 3 is_stmt 0 view .LVU120
+.LBE2551:
+.LBE2550:
+.LBB2552:
+.LBI2512:
+	.loc 2 1064 1 is_stmt 1 view .LVU121
+.LBB2514:
+	.loc 2 1066 3 view .LVU122
+# /usr/lib/gcc/x86_64-linux-gnu/12/include/emmintrin.h:1066:   return (__m128i) ((__v4su)__A + (__v4su)__B);
+	.loc 2 1066 33 is_stmt 0 view .LVU123
+	paddd	%xmm1, %xmm0	# _53, _57
+.LVL16:
+	.loc 2 1066 33 view .LVU124
+.LBE2514:
+.LBE2552:
+	.loc 1 303 349 is_stmt 1 view .LVU125
+.LBB2553:
+.LBI2553:
+	.loc 2 1327 1 view .LVU126
+.LBB2554:
+	.loc 2 1329 3 view .LVU127
+	.loc 2 1329 3 is_stmt 0 view .LVU128
+.LBE2554:
+.LBE2553:
+.LBB2556:
+.LBI2556:
+	.loc 4 136 1 is_stmt 1 view .LVU129
+.LBB2557:
+	.loc 4 138 3 view .LVU130
+.LBE2557:
+.LBE2556:
+.LBB2559:
+.LBB2555:
+# /usr/lib/gcc/x86_64-linux-gnu/12/include/emmintrin.h:1329:   return (__m128i) ((__v2du)__A ^ (__v2du)__B);
+	.loc 2 1329 33 is_stmt 0 view .LVU131
+	pxor	%xmm0, %xmm2	# _57, tmp1278
+.LVL17:
+	.loc 2 1329 33 view .LVU132
+.LBE2555:
+.LBE2559:
+.LBB2560:
+.LBB2558:
+# /usr/lib/gcc/x86_64-linux-gnu/12/include/tmmintrin.h:138:   return (__m128i) __builtin_ia32_pshufb128 ((__v16qi)__X, (__v16qi)__Y);
+	.loc 4 138 20 view .LVU133
+	pshufb	.LC2(%rip), %xmm2	#, tmp1279
+.LVL18:
+	.loc 4 138 20 view .LVU134
+.LBE2558:
+.LBE2560:
+	.loc 1 303 402 is_stmt 1 view .LVU135
+.LBB2561:
+.LBI2561:
+	.loc 2 1064 1 view .LVU136
+.LBB2562:
+	.loc 2 1066 3 view .LVU137
+# /usr/lib/gcc/x86_64-linux-gnu/12/include/emmintrin.h:1066:   return (__m128i) ((__v4su)__A + (__v4su)__B);
+	.loc 2 1066 33 is_stmt 0 view .LVU138
+	paddd	%xmm2, %xmm8	# tmp1279, _64
+.LVL19:
+	.loc 2 1066 33 view .LVU139
+.LBE2562:
+.LBE2561:
+	.loc 1 303 432 is_stmt 1 view .LVU140
+.LBB2563:
+.LBI2563:
+	.loc 2 1327 1 view .LVU141
+.LBB2564:
+	.loc 2 1329 3 view .LVU142
+	.loc 2 1329 3 is_stmt 0 view .LVU143
+.LBE2564:
+.LBE2563:
+.LBB2566:
+.LBI2566:
+	.loc 2 1184 1 is_stmt 1 view .LVU144
+.LBB2567:
+	.loc 2 1186 3 view .LVU145
+.LBE2567:
+.LBE2566:
+.LBB2570:
+.LBB2571:
+# /usr/lib/gcc/x86_64-linux-gnu/12/include/emmintrin.h:1458:   return (__m128i)__builtin_ia32_pshufd ((__v4si)__A, __mask);
+	.loc 2 1458 19 is_stmt 0 view .LVU146
+	pshufd	$147, %xmm2, %xmm14	#, tmp1279, tmp1291
+.LBE2571:
+.LBE2570:
+.LBB2573:
+.LBB2565:
+# /usr/lib/gcc/x86_64-linux-gnu/12/include/emmintrin.h:1329:   return (__m128i) ((__v2du)__A ^ (__v2du)__B);
+	.loc 2 1329 33 view .LVU147
+	pxor	%xmm8, %xmm1	# _64, tmp1281
+.LVL20:
+	.loc 2 1329 33 view .LVU148
+.LBE2565:
+.LBE2573:
+.LBB2574:
+.LBB2575:
+# /usr/lib/gcc/x86_64-linux-gnu/12/include/emmintrin.h:1458:   return (__m128i)__builtin_ia32_pshufd ((__v4si)__A, __mask);
+	.loc 2 1458 19 view .LVU149
+	pshufd	$78, %xmm8, %xmm8	#, _64, tmp1289
+.LVL21:
+	.loc 2 1458 19 view .LVU150
+.LBE2575:
+.LBE2574:
+.LBB2577:
+.LBB2568:
+# /usr/lib/gcc/x86_64-linux-gnu/12/include/emmintrin.h:1186:   return (__m128i)__builtin_ia32_pslldi128 ((__v4si)__A, __B);
+	.loc 2 1186 19 view .LVU151
+	movdqa	%xmm1, %xmm9	# tmp1281, tmp1282
+.LVL22:
+	.loc 2 1186 19 view .LVU152
+.LBE2568:
+.LBE2577:
+.LBB2578:
+.LBB2579:
+# /usr/lib/gcc/x86_64-linux-gnu/12/include/emmintrin.h:1251:   return (__m128i)__builtin_ia32_psrldi128 ((__v4si)__A, __B);
+	.loc 2 1251 19 view .LVU153
+	psrld	$7, %xmm1	#, tmp1284
+.LVL23:
+	.loc 2 1251 19 view .LVU154
+.LBE2579:
+.LBE2578:
+.LBB2581:
+.LBB2569:
+# /usr/lib/gcc/x86_64-linux-gnu/12/include/emmintrin.h:1186:   return (__m128i)__builtin_ia32_pslldi128 ((__v4si)__A, __B);
+	.loc 2 1186 19 view .LVU155
+	pslld	$25, %xmm9	#, tmp1282
+.LVL24:
+	.loc 2 1186 19 view .LVU156
+.LBE2569:
+.LBE2581:
+.LBB2582:
+.LBI2578:
+	.loc 2 1249 1 is_stmt 1 view .LVU157
+.LBB2580:
+	.loc 2 1251 3 view .LVU158
+	.loc 2 1251 3 is_stmt 0 view .LVU159
+.LBE2580:
+.LBE2582:
+.LBB2583:
+.LBI2583:
+	.loc 2 1321 1 is_stmt 1 view .LVU160
+.LBB2584:
+	.loc 2 1323 3 view .LVU161
+	.loc 2 1323 3 is_stmt 0 view .LVU162
+.LBE2584:
+.LBE2583:
+	.loc 1 303 58 is_stmt 1 view .LVU163
+	.loc 1 303 551 view .LVU164
+.LBB2586:
+.LBI2586:
+	.loc 2 1456 1 view .LVU165
+.LBB2587:
+	.loc 2 1458 3 view .LVU166
+.LBE2587:
+.LBE2586:
+.LBB2589:
+.LBB2585:
+# /usr/lib/gcc/x86_64-linux-gnu/12/include/emmintrin.h:1323:   return (__m128i) ((__v2du)__A | (__v2du)__B);
+	.loc 2 1323 33 is_stmt 0 view .LVU167
+	por	%xmm9, %xmm1	# tmp1282, tmp1287
+.LVL25:
+	.loc 2 1323 33 view .LVU168
+.LBE2585:
+.LBE2589:
+.LBB2590:
+.LBB2588:
+# /usr/lib/gcc/x86_64-linux-gnu/12/include/emmintrin.h:1458:   return (__m128i)__builtin_ia32_pshufd ((__v4si)__A, __mask);
+	.loc 2 1458 19 view .LVU169
+	pshufd	$57, %xmm1, %xmm9	#, tmp1287, tmp1286
+.LVL26:
+	.loc 2 1458 19 view .LVU170
+.LBE2588:
+.LBE2590:
+	.loc 1 303 7 is_stmt 1 view .LVU171
+.LBB2591:
+.LBI2574:
+	.loc 2 1456 1 view .LVU172
+.LBB2576:
+	.loc 2 1458 3 view .LVU173
+	.loc 2 1458 3 is_stmt 0 view .LVU174
+.LBE2576:
+.LBE2591:
+	.loc 1 303 7 is_stmt 1 view .LVU175
+.LBB2592:
+.LBI2570:
+	.loc 2 1456 1 view .LVU176
+.LBB2572:
+	.loc 2 1458 3 view .LVU177
+	.loc 2 1458 3 is_stmt 0 view .LVU178
+.LBE2572:
+.LBE2592:
+	.loc 1 303 7 is_stmt 1 view .LVU179
+	.loc 1 303 12 view .LVU180
+.LBB2593:
+.LBI2593:
+	.loc 2 1064 1 view .LVU181
+.LBB2594:
+	.loc 2 1066 3 view .LVU182
+	.loc 2 1066 3 is_stmt 0 view .LVU183
+.LBE2594:
+.LBE2593:
+.LBB2595:
+.LBI2595:
+	.loc 2 1064 1 is_stmt 1 view .LVU184
+.LBB2596:
+	.loc 2 1066 3 view .LVU185
+# /usr/lib/gcc/x86_64-linux-gnu/12/include/emmintrin.h:1066:   return (__m128i) ((__v4su)__A + (__v4su)__B);
+	.loc 2 1066 33 is_stmt 0 view .LVU186
+	paddd	%xmm9, %xmm7	# tmp1286, tmp1293
+.LVL27:
+	.loc 2 1066 33 view .LVU187
+	paddd	%xmm0, %xmm7	# _57, _82
+.LVL28:
+	.loc 2 1066 33 view .LVU188
+.LBE2596:
+.LBE2595:
+	.loc 1 303 61 is_stmt 1 view .LVU189
+.LBB2597:
+.LBI2597:
+	.loc 2 1327 1 view .LVU190
+.LBB2598:
+	.loc 2 1329 3 view .LVU191
+	.loc 2 1329 3 is_stmt 0 view .LVU192
+.LBE2598:
+.LBE2597:
+.LBB2600:
+.LBI2600:
+	.loc 4 136 1 is_stmt 1 view .LVU193
+.LBB2601:
+	.loc 4 138 3 view .LVU194
+.LBE2601:
+.LBE2600:
+.LBB2603:
+.LBB2599:
+# /usr/lib/gcc/x86_64-linux-gnu/12/include/emmintrin.h:1329:   return (__m128i) ((__v2du)__A ^ (__v2du)__B);
+	.loc 2 1329 33 is_stmt 0 view .LVU195
+	pxor	%xmm7, %xmm14	# _82, tmp1294
+.LVL29:
+	.loc 2 1329 33 view .LVU196
+.LBE2599:
+.LBE2603:
+.LBB2604:
+.LBB2602:
+# /usr/lib/gcc/x86_64-linux-gnu/12/include/tmmintrin.h:138:   return (__m128i) __builtin_ia32_pshufb128 ((__v16qi)__X, (__v16qi)__Y);
+	.loc 4 138 20 view .LVU197
+	pshufb	.LC0(%rip), %xmm14	#, tmp1295
+.LVL30:
+	.loc 4 138 20 view .LVU198
+.LBE2602:
+.LBE2604:
+	.loc 1 303 115 is_stmt 1 view .LVU199
+.LBB2605:
+.LBI2605:
+	.loc 2 1064 1 view .LVU200
+.LBB2606:
+	.loc 2 1066 3 view .LVU201
+# /usr/lib/gcc/x86_64-linux-gnu/12/include/emmintrin.h:1066:   return (__m128i) ((__v4su)__A + (__v4su)__B);
+	.loc 2 1066 33 is_stmt 0 view .LVU202
+	paddd	%xmm14, %xmm8	# tmp1295, _90
+.LVL31:
+	.loc 2 1066 33 view .LVU203
+.LBE2606:
+.LBE2605:
+	.loc 1 303 145 is_stmt 1 view .LVU204
+.LBB2607:
+.LBI2607:
+	.loc 2 1327 1 view .LVU205
+.LBB2608:
+	.loc 2 1329 3 view .LVU206
+	.loc 2 1329 3 is_stmt 0 view .LVU207
+.LBE2608:
+.LBE2607:
+.LBB2610:
+.LBI2610:
+	.loc 2 1184 1 is_stmt 1 view .LVU208
+.LBB2611:
+	.loc 2 1186 3 view .LVU209
+.LBE2611:
+.LBE2610:
+.LBB2614:
+.LBB2609:
+# /usr/lib/gcc/x86_64-linux-gnu/12/include/emmintrin.h:1329:   return (__m128i) ((__v2du)__A ^ (__v2du)__B);
+	.loc 2 1329 33 is_stmt 0 view .LVU210
+	pxor	%xmm8, %xmm9	# _90, tmp1297
+.LVL32:
+	.loc 2 1329 33 view .LVU211
+.LBE2609:
+.LBE2614:
+.LBB2615:
+.LBB2612:
+# /usr/lib/gcc/x86_64-linux-gnu/12/include/emmintrin.h:1186:   return (__m128i)__builtin_ia32_pslldi128 ((__v4si)__A, __B);
+	.loc 2 1186 19 view .LVU212
+	movdqa	%xmm9, %xmm2	# tmp1297, tmp1298
+.LBE2612:
+.LBE2615:
+.LBB2616:
+.LBB2617:
+# /usr/lib/gcc/x86_64-linux-gnu/12/include/emmintrin.h:1251:   return (__m128i)__builtin_ia32_psrldi128 ((__v4si)__A, __B);
+	.loc 2 1251 19 view .LVU213
+	psrld	$12, %xmm9	#, tmp1300
+.LVL33:
+	.loc 2 1251 19 view .LVU214
+.LBE2617:
+.LBE2616:
+.LBB2619:
+.LBB2613:
+# /usr/lib/gcc/x86_64-linux-gnu/12/include/emmintrin.h:1186:   return (__m128i)__builtin_ia32_pslldi128 ((__v4si)__A, __B);
+	.loc 2 1186 19 view .LVU215
+	pslld	$20, %xmm2	#, tmp1298
+.LVL34:
+	.loc 2 1186 19 view .LVU216
+.LBE2613:
+.LBE2619:
+.LBB2620:
+.LBI2616:
+	.loc 2 1249 1 is_stmt 1 view .LVU217
+.LBB2618:
+	.loc 2 1251 3 view .LVU218
+	.loc 2 1251 3 is_stmt 0 view .LVU219
+.LBE2618:
+.LBE2620:
+.LBB2621:
+.LBI2621:
+	.loc 2 1321 1 is_stmt 1 view .LVU220
+.LBB2622:
+	.loc 2 1323 3 view .LVU221
+# /usr/lib/gcc/x86_64-linux-gnu/12/include/emmintrin.h:1323:   return (__m128i) ((__v2du)__A | (__v2du)__B);
+	.loc 2 1323 33 is_stmt 0 view .LVU222
+	por	%xmm2, %xmm9	# tmp1298, _99
+.LVL35:
+	.loc 2 1323 33 view .LVU223
+.LBE2622:
+.LBE2621:
+	.loc 1 303 252 is_stmt 1 view .LVU224
+.LBB2623:
+.LBI2623:
+	.loc 2 1064 1 view .LVU225
+.LBB2624:
+	.loc 2 1066 3 view .LVU226
+	.loc 2 1066 3 is_stmt 0 view .LVU227
+.LBE2624:
+.LBE2623:
+.LBB2625:
+.LBI2625:
+	.loc 2 1064 1 is_stmt 1 view .LVU228
+.LBB2626:
+	.loc 2 1066 3 view .LVU229
+# /usr/lib/gcc/x86_64-linux-gnu/12/include/emmintrin.h:1066:   return (__m128i) ((__v4su)__A + (__v4su)__B);
+	.loc 2 1066 33 is_stmt 0 view .LVU230
+	paddd	%xmm9, %xmm15	# _99, tmp1302
+.LVL36:
+	.loc 2 1066 33 view .LVU231
+	paddd	%xmm7, %xmm15	# _82, _103
+.LVL37:
+	.loc 2 1066 33 view .LVU232
+.LBE2626:
+.LBE2625:
+	.loc 1 303 301 is_stmt 1 view .LVU233
+.LBB2627:
+.LBI2627:
+	.loc 2 1327 1 view .LVU234
+.LBB2628:
+	.loc 2 1329 3 view .LVU235
+	.loc 2 1329 3 is_stmt 0 view .LVU236
+.LBE2628:
+.LBE2627:
+.LBB2630:
+.LBI2630:
+	.loc 4 136 1 is_stmt 1 view .LVU237
+.LBB2631:
+	.loc 4 138 3 view .LVU238
+.LBE2631:
+.LBE2630:
+.LBB2633:
+.LBB2634:
+# /usr/lib/gcc/x86_64-linux-gnu/12/include/emmintrin.h:1458:   return (__m128i)__builtin_ia32_pshufd ((__v4si)__A, __mask);
+	.loc 2 1458 19 is_stmt 0 view .LVU239
+	pshufd	$224, %xmm4, %xmm7	#, m1, tmp1320
+.LBE2634:
+.LBE2633:
+.LBB2636:
+.LBB2629:
+# /usr/lib/gcc/x86_64-linux-gnu/12/include/emmintrin.h:1329:   return (__m128i) ((__v2du)__A ^ (__v2du)__B);
+	.loc 2 1329 33 view .LVU240
+	pxor	%xmm15, %xmm14	# _103, tmp1303
+.LVL38:
+	.loc 2 1329 33 view .LVU241
+.LBE2629:
+.LBE2636:
+.LBB2637:
+.LBB2638:
+# /usr/lib/gcc/x86_64-linux-gnu/12/include/smmintrin.h:168:   return (__m128i) __builtin_ia32_pblendw128 ((__v8hi)__X,
+	.loc 3 168 20 view .LVU242
+	movaps	%xmm7, -104(%rsp)	# tmp1320, %sfp
+.LBE2638:
+.LBE2637:
+.LBB2640:
+.LBB2641:
+# /usr/lib/gcc/x86_64-linux-gnu/12/include/emmintrin.h:1458:   return (__m128i)__builtin_ia32_pshufd ((__v4si)__A, __mask);
+	.loc 2 1458 19 view .LVU243
+	pshufd	$212, %xmm5, %xmm7	#, m2, tmp1325
+.LBE2641:
+.LBE2640:
+.LBB2643:
+.LBB2632:
+# /usr/lib/gcc/x86_64-linux-gnu/12/include/tmmintrin.h:138:   return (__m128i) __builtin_ia32_pshufb128 ((__v16qi)__X, (__v16qi)__Y);
+	.loc 4 138 20 view .LVU244
+	pshufb	.LC2(%rip), %xmm14	#, tmp1304
+.LVL39:
+	.loc 4 138 20 view .LVU245
+.LBE2632:
+.LBE2643:
+	.loc 1 303 354 is_stmt 1 view .LVU246
+.LBB2644:
+.LBI2644:
+	.loc 2 1064 1 view .LVU247
+.LBB2645:
+	.loc 2 1066 3 view .LVU248
+# /usr/lib/gcc/x86_64-linux-gnu/12/include/emmintrin.h:1066:   return (__m128i) ((__v4su)__A + (__v4su)__B);
+	.loc 2 1066 33 is_stmt 0 view .LVU249
+	paddd	%xmm14, %xmm8	# tmp1304, _110
+.LVL40:
+	.loc 2 1066 33 view .LVU250
+.LBE2645:
+.LBE2644:
+	.loc 1 303 384 is_stmt 1 view .LVU251
+.LBB2646:
+.LBI2646:
+	.loc 2 1327 1 view .LVU252
+.LBB2647:
+	.loc 2 1329 3 view .LVU253
+	.loc 2 1329 3 is_stmt 0 view .LVU254
+.LBE2647:
+.LBE2646:
+.LBB2649:
+.LBI2649:
+	.loc 2 1184 1 is_stmt 1 view .LVU255
+.LBB2650:
+	.loc 2 1186 3 view .LVU256
+.LBE2650:
+.LBE2649:
+.LBB2653:
+.LBB2654:
+# /usr/lib/gcc/x86_64-linux-gnu/12/include/emmintrin.h:1458:   return (__m128i)__builtin_ia32_pshufd ((__v4si)__A, __mask);
+	.loc 2 1458 19 is_stmt 0 view .LVU257
+	pshufd	$57, %xmm14, %xmm1	#, tmp1304, tmp1316
+.LBE2654:
+.LBE2653:
+.LBB2656:
+.LBB2657:
+	pshufd	$244, %xmm6, %xmm14	#, m3, tmp1332
+.LVL41:
+	.loc 2 1458 19 view .LVU258
+.LBE2657:
+.LBE2656:
+.LBB2659:
+.LBB2648:
+# /usr/lib/gcc/x86_64-linux-gnu/12/include/emmintrin.h:1329:   return (__m128i) ((__v2du)__A ^ (__v2du)__B);
+	.loc 2 1329 33 view .LVU259
+	pxor	%xmm8, %xmm9	# _110, tmp1306
+.LVL42:
+	.loc 2 1329 33 view .LVU260
+.LBE2648:
+.LBE2659:
+.LBB2660:
+.LBB2661:
+# /usr/lib/gcc/x86_64-linux-gnu/12/include/emmintrin.h:1458:   return (__m128i)__builtin_ia32_pshufd ((__v4si)__A, __mask);
+	.loc 2 1458 19 view .LVU261
+	pshufd	$78, %xmm8, %xmm2	#, _110, tmp1314
+.LBE2661:
+.LBE2660:
+.LBB2663:
+.LBB2664:
+# /usr/lib/gcc/x86_64-linux-gnu/12/include/smmintrin.h:168:   return (__m128i) __builtin_ia32_pblendw128 ((__v8hi)__X,
+	.loc 3 168 20 view .LVU262
+	movaps	%xmm14, -88(%rsp)	# tmp1332, %sfp
+.LBE2664:
+.LBE2663:
+.LBB2667:
+.LBB2668:
+# /usr/lib/gcc/x86_64-linux-gnu/12/include/emmintrin.h:1458:   return (__m128i)__builtin_ia32_pshufd ((__v4si)__A, __mask);
+	.loc 2 1458 19 view .LVU263
+	pshufd	$226, %xmm5, %xmm8	#, m2, tmp1330
+.LVL43:
+	.loc 2 1458 19 view .LVU264
+.LBE2668:
+.LBE2667:
+.LBB2670:
+.LBB2651:
+# /usr/lib/gcc/x86_64-linux-gnu/12/include/emmintrin.h:1186:   return (__m128i)__builtin_ia32_pslldi128 ((__v4si)__A, __B);
+	.loc 2 1186 19 view .LVU265
+	movdqa	%xmm9, %xmm0	# tmp1306, tmp1307
+.LBE2651:
+.LBE2670:
+.LBB2671:
+.LBB2672:
+# /usr/lib/gcc/x86_64-linux-gnu/12/include/emmintrin.h:1251:   return (__m128i)__builtin_ia32_psrldi128 ((__v4si)__A, __B);
+	.loc 2 1251 19 view .LVU266
+	psrld	$7, %xmm9	#, tmp1309
+.LVL44:
+	.loc 2 1251 19 view .LVU267
+.LBE2672:
+.LBE2671:
+.LBB2674:
+.LBB2665:
+# /usr/lib/gcc/x86_64-linux-gnu/12/include/smmintrin.h:168:   return (__m128i) __builtin_ia32_pblendw128 ((__v8hi)__X,
+	.loc 3 168 20 view .LVU268
+	pblendw	$48, -88(%rsp), %xmm8	#, %sfp, tmp1334
+.LBE2665:
+.LBE2674:
+.LBB2675:
+.LBB2652:
+# /usr/lib/gcc/x86_64-linux-gnu/12/include/emmintrin.h:1186:   return (__m128i)__builtin_ia32_pslldi128 ((__v4si)__A, __B);
+	.loc 2 1186 19 view .LVU269
+	pslld	$25, %xmm0	#, tmp1307
+.LVL45:
+	.loc 2 1186 19 view .LVU270
+.LBE2652:
+.LBE2675:
+.LBB2676:
+.LBI2671:
+	.loc 2 1249 1 is_stmt 1 view .LVU271
+.LBB2673:
+	.loc 2 1251 3 view .LVU272
+	.loc 2 1251 3 is_stmt 0 view .LVU273
+.LBE2673:
+.LBE2676:
+.LBB2677:
+.LBI2677:
+	.loc 2 1321 1 is_stmt 1 view .LVU274
+.LBB2678:
+	.loc 2 1323 3 view .LVU275
+	.loc 2 1323 3 is_stmt 0 view .LVU276
+.LBE2678:
+.LBE2677:
+	.loc 1 303 10 is_stmt 1 view .LVU277
+	.loc 1 303 503 view .LVU278
+.LBB2680:
+.LBI2680:
+	.loc 2 1456 1 view .LVU279
+.LBB2681:
+	.loc 2 1458 3 view .LVU280
+.LBE2681:
+.LBE2680:
+.LBB2683:
+.LBB2684:
+# /usr/lib/gcc/x86_64-linux-gnu/12/include/emmintrin.h:1458:   return (__m128i)__builtin_ia32_pshufd ((__v4si)__A, __mask);
+	.loc 2 1458 19 is_stmt 0 view .LVU281
+	pshufd	$244, %xmm5, %xmm14	#, m2, tmp1344
+.LBE2684:
+.LBE2683:
+.LBB2686:
+.LBB2679:
+# /usr/lib/gcc/x86_64-linux-gnu/12/include/emmintrin.h:1323:   return (__m128i) ((__v2du)__A | (__v2du)__B);
+	.loc 2 1323 33 view .LVU282
+	por	%xmm0, %xmm9	# tmp1307, tmp1312
+.LVL46:
+	.loc 2 1323 33 view .LVU283
+.LBE2679:
+.LBE2686:
+.LBB2687:
+.LBB2688:
+# /usr/lib/gcc/x86_64-linux-gnu/12/include/smmintrin.h:168:   return (__m128i) __builtin_ia32_pblendw128 ((__v8hi)__X,
+	.loc 3 168 20 view .LVU284
+	movaps	%xmm14, -72(%rsp)	# tmp1344, %sfp
+.LBE2688:
+.LBE2687:
+.LBB2691:
+.LBB2692:
+# /usr/lib/gcc/x86_64-linux-gnu/12/include/emmintrin.h:1458:   return (__m128i)__builtin_ia32_pshufd ((__v4si)__A, __mask);
+	.loc 2 1458 19 view .LVU285
+	pshufd	$100, %xmm4, %xmm14	#, m1, tmp1349
+.LBE2692:
+.LBE2691:
+.LBB2694:
+.LBB2682:
+	pshufd	$147, %xmm9, %xmm0	#, tmp1312, tmp1311
+.LVL47:
+	.loc 2 1458 19 view .LVU286
+.LBE2682:
+.LBE2694:
+	.loc 1 303 7 is_stmt 1 view .LVU287
+.LBB2695:
+.LBI2660:
+	.loc 2 1456 1 view .LVU288
+.LBB2662:
+	.loc 2 1458 3 view .LVU289
+	.loc 2 1458 3 is_stmt 0 view .LVU290
+.LBE2662:
+.LBE2695:
+	.loc 1 303 7 is_stmt 1 view .LVU291
+.LBB2696:
+.LBI2653:
+	.loc 2 1456 1 view .LVU292
+.LBB2655:
+	.loc 2 1458 3 view .LVU293
+	.loc 2 1458 3 is_stmt 0 view .LVU294
+.LBE2655:
+.LBE2696:
+	.loc 1 303 8 is_stmt 1 view .LVU295
+	.loc 1 304 5 view .LVU296
+	.loc 1 304 10 view .LVU297
+	.loc 1 304 15 view .LVU298
+.LBB2697:
+.LBI2697:
+	.loc 2 1456 1 view .LVU299
+.LBB2698:
+	.loc 2 1458 3 view .LVU300
+# /usr/lib/gcc/x86_64-linux-gnu/12/include/emmintrin.h:1458:   return (__m128i)__builtin_ia32_pshufd ((__v4si)__A, __mask);
+	.loc 2 1458 19 is_stmt 0 view .LVU301
+	pshufd	$102, %xmm6, %xmm9	#, m3, tmp1318
+.LVL48:
+	.loc 2 1458 19 view .LVU302
+.LBE2698:
+.LBE2697:
+	.loc 1 304 7 is_stmt 1 view .LVU303
+.LBB2699:
+.LBI2633:
+	.loc 2 1456 1 view .LVU304
+.LBB2635:
+	.loc 2 1458 3 view .LVU305
+	.loc 2 1458 3 is_stmt 0 view .LVU306
+.LBE2635:
+.LBE2699:
+	.loc 1 304 7 is_stmt 1 view .LVU307
+.LBB2700:
+.LBI2637:
+	.loc 3 166 1 view .LVU308
+.LBB2639:
+	.loc 3 168 3 view .LVU309
+# /usr/lib/gcc/x86_64-linux-gnu/12/include/smmintrin.h:168:   return (__m128i) __builtin_ia32_pblendw128 ((__v8hi)__X,
+	.loc 3 168 20 is_stmt 0 view .LVU310
+	pblendw	$12, -104(%rsp), %xmm9	#, %sfp, tmp1322
+.LVL49:
+	.loc 3 168 20 view .LVU311
+.LBE2639:
+.LBE2700:
+	.loc 1 304 42 is_stmt 1 view .LVU312
+.LBB2701:
+.LBI2640:
+	.loc 2 1456 1 view .LVU313
+.LBB2642:
+	.loc 2 1458 3 view .LVU314
+	.loc 2 1458 3 is_stmt 0 view .LVU315
+.LBE2642:
+.LBE2701:
+	.loc 1 304 7 is_stmt 1 view .LVU316
+.LBB2702:
+.LBI2702:
+	.loc 3 166 1 view .LVU317
+.LBB2703:
+	.loc 3 168 3 view .LVU318
+# /usr/lib/gcc/x86_64-linux-gnu/12/include/smmintrin.h:168:   return (__m128i) __builtin_ia32_pblendw128 ((__v8hi)__X,
+	.loc 3 168 20 is_stmt 0 view .LVU319
+	pblendw	$48, %xmm7, %xmm9	#, tmp1325, tmp1327
+.LVL50:
+	.loc 3 168 20 view .LVU320
+.LBE2703:
+.LBE2702:
+	.loc 1 304 42 is_stmt 1 view .LVU321
+.LBB2704:
+.LBI2667:
+	.loc 2 1456 1 view .LVU322
+.LBB2669:
+	.loc 2 1458 3 view .LVU323
+	.loc 2 1458 3 is_stmt 0 view .LVU324
+.LBE2669:
+.LBE2704:
+	.loc 1 304 7 is_stmt 1 view .LVU325
+.LBB2705:
+.LBI2656:
+	.loc 2 1456 1 view .LVU326
+.LBB2658:
+	.loc 2 1458 3 view .LVU327
+	.loc 2 1458 3 is_stmt 0 view .LVU328
+.LBE2658:
+.LBE2705:
+	.loc 1 304 7 is_stmt 1 view .LVU329
+.LBB2706:
+.LBI2663:
+	.loc 3 166 1 view .LVU330
+.LBB2666:
+	.loc 3 168 3 view .LVU331
+	.loc 3 168 3 is_stmt 0 view .LVU332
+.LBE2666:
+.LBE2706:
+	.loc 1 304 42 is_stmt 1 view .LVU333
+.LBB2707:
+.LBI2707:
+	.loc 2 1456 1 view .LVU334
+.LBB2708:
+	.loc 2 1458 3 view .LVU335
+# /usr/lib/gcc/x86_64-linux-gnu/12/include/emmintrin.h:1458:   return (__m128i)__builtin_ia32_pshufd ((__v4si)__A, __mask);
+	.loc 2 1458 19 is_stmt 0 view .LVU336
+	pshufd	$164, %xmm4, %xmm7	#, m1, tmp1337
+.LVL51:
+	.loc 2 1458 19 view .LVU337
+.LBE2708:
+.LBE2707:
+	.loc 1 304 7 is_stmt 1 view .LVU338
+.LBB2709:
+.LBI2709:
+	.loc 3 166 1 view .LVU339
+.LBB2710:
+	.loc 3 168 3 view .LVU340
+.LBE2710:
+.LBE2709:
+.LBB2712:
+.LBB2713:
+# /usr/lib/gcc/x86_64-linux-gnu/12/include/emmintrin.h:1066:   return (__m128i) ((__v4su)__A + (__v4su)__B);
+	.loc 2 1066 33 is_stmt 0 view .LVU341
+	paddd	%xmm0, %xmm9	# tmp1311, tmp1362
+.LVL52:
+	.loc 2 1066 33 view .LVU342
+.LBE2713:
+.LBE2712:
+.LBB2716:
+.LBB2711:
+# /usr/lib/gcc/x86_64-linux-gnu/12/include/smmintrin.h:168:   return (__m128i) __builtin_ia32_pblendw128 ((__v8hi)__X,
+	.loc 3 168 20 view .LVU343
+	pblendw	$192, %xmm7, %xmm8	#, tmp1337, tmp1339
+.LVL53:
+	.loc 3 168 20 view .LVU344
+.LBE2711:
+.LBE2716:
+	.loc 1 304 42 is_stmt 1 view .LVU345
+.LBB2717:
+.LBI2717:
+	.loc 2 1456 1 view .LVU346
+.LBB2718:
+	.loc 2 1458 3 view .LVU347
+# /usr/lib/gcc/x86_64-linux-gnu/12/include/emmintrin.h:1458:   return (__m128i)__builtin_ia32_pshufd ((__v4si)__A, __mask);
+	.loc 2 1458 19 is_stmt 0 view .LVU348
+	pshufd	$225, %xmm3, %xmm7	#, m0, tmp1342
+.LVL54:
+	.loc 2 1458 19 view .LVU349
+.LBE2718:
+.LBE2717:
+	.loc 1 304 7 is_stmt 1 view .LVU350
+.LBB2719:
+.LBI2683:
+	.loc 2 1456 1 view .LVU351
+.LBB2685:
+	.loc 2 1458 3 view .LVU352
+	.loc 2 1458 3 is_stmt 0 view .LVU353
+.LBE2685:
+.LBE2719:
+	.loc 1 304 7 is_stmt 1 view .LVU354
+.LBB2720:
+.LBI2687:
+	.loc 3 166 1 view .LVU355
+.LBB2689:
+	.loc 3 168 3 view .LVU356
+.LBE2689:
+.LBE2720:
+.LBB2721:
+.LBB2714:
+# /usr/lib/gcc/x86_64-linux-gnu/12/include/emmintrin.h:1066:   return (__m128i) ((__v4su)__A + (__v4su)__B);
+	.loc 2 1066 33 is_stmt 0 view .LVU357
+	paddd	%xmm15, %xmm9	# _103, _157
+.LBE2714:
+.LBE2721:
+.LBB2722:
+.LBB2690:
+# /usr/lib/gcc/x86_64-linux-gnu/12/include/smmintrin.h:168:   return (__m128i) __builtin_ia32_pblendw128 ((__v8hi)__X,
+	.loc 3 168 20 view .LVU358
+	pblendw	$48, -72(%rsp), %xmm7	#, %sfp, tmp1346
+.LVL55:
+	.loc 3 168 20 view .LVU359
+.LBE2690:
+.LBE2722:
+	.loc 1 304 42 is_stmt 1 view .LVU360
+.LBB2723:
+.LBI2691:
+	.loc 2 1456 1 view .LVU361
+.LBB2693:
+	.loc 2 1458 3 view .LVU362
+	.loc 2 1458 3 is_stmt 0 view .LVU363
+.LBE2693:
+.LBE2723:
+	.loc 1 304 7 is_stmt 1 view .LVU364
+.LBB2724:
+.LBI2724:
+	.loc 3 166 1 view .LVU365
+.LBB2725:
+	.loc 3 168 3 view .LVU366
+.LBE2725:
+.LBE2724:
+.LBB2727:
+.LBB2728:
+# /usr/lib/gcc/x86_64-linux-gnu/12/include/emmintrin.h:1329:   return (__m128i) ((__v2du)__A ^ (__v2du)__B);
+	.loc 2 1329 33 is_stmt 0 view .LVU367
+	pxor	%xmm9, %xmm1	# _157, tmp1363
+.LVL56:
+	.loc 2 1329 33 view .LVU368
+.LBE2728:
+.LBE2727:
+.LBB2730:
+.LBB2726:
+# /usr/lib/gcc/x86_64-linux-gnu/12/include/smmintrin.h:168:   return (__m128i) __builtin_ia32_pblendw128 ((__v8hi)__X,
+	.loc 3 168 20 view .LVU369
+	pblendw	$192, %xmm14, %xmm7	#, tmp1349, tmp1351
+.LVL57:
+	.loc 3 168 20 view .LVU370
+.LBE2726:
+.LBE2730:
+	.loc 1 304 42 is_stmt 1 view .LVU371
+	.loc 1 304 51 view .LVU372
+	.loc 1 304 7 view .LVU373
+.LBB2731:
+.LBI2731:
+	.loc 3 166 1 view .LVU374
+.LBB2732:
+	.loc 3 168 3 view .LVU375
+# /usr/lib/gcc/x86_64-linux-gnu/12/include/smmintrin.h:168:   return (__m128i) __builtin_ia32_pblendw128 ((__v8hi)__X,
+	.loc 3 168 20 is_stmt 0 view .LVU376
+	movdqa	%xmm6, %xmm14	# m3, tmp1354
+.LBE2732:
+.LBE2731:
+.LBB2734:
+.LBB2735:
+# /usr/lib/gcc/x86_64-linux-gnu/12/include/tmmintrin.h:138:   return (__m128i) __builtin_ia32_pshufb128 ((__v16qi)__X, (__v16qi)__Y);
+	.loc 4 138 20 view .LVU377
+	pshufb	.LC0(%rip), %xmm1	#, tmp1364
+.LBE2735:
+.LBE2734:
+.LBB2737:
+.LBB2733:
+# /usr/lib/gcc/x86_64-linux-gnu/12/include/smmintrin.h:168:   return (__m128i) __builtin_ia32_pblendw128 ((__v8hi)__X,
+	.loc 3 168 20 view .LVU378
+	pblendw	$204, %xmm12, %xmm14	#, tmp1239, tmp1354
+.LVL58:
+	.loc 3 168 20 view .LVU379
+.LBE2733:
+.LBE2737:
+	.loc 1 304 42 is_stmt 1 view .LVU380
+.LBB2738:
+.LBI2738:
+	.loc 2 1456 1 view .LVU381
+.LBB2739:
+	.loc 2 1458 3 view .LVU382
+# /usr/lib/gcc/x86_64-linux-gnu/12/include/emmintrin.h:1458:   return (__m128i)__builtin_ia32_pshufd ((__v4si)__A, __mask);
+	.loc 2 1458 19 is_stmt 0 view .LVU383
+	pshufd	$244, %xmm4, %xmm12	#, m1, tmp1357
+.LVL59:
+	.loc 2 1458 19 view .LVU384
+.LBE2739:
+.LBE2738:
+	.loc 1 304 7 is_stmt 1 view .LVU385
+.LBB2740:
+.LBI2740:
+	.loc 3 166 1 view .LVU386
+.LBB2741:
+	.loc 3 168 3 view .LVU387
+.LBE2741:
+.LBE2740:
+.LBB2743:
+.LBB2744:
+# /usr/lib/gcc/x86_64-linux-gnu/12/include/emmintrin.h:1066:   return (__m128i) ((__v4su)__A + (__v4su)__B);
+	.loc 2 1066 33 is_stmt 0 view .LVU388
+	paddd	%xmm1, %xmm2	# tmp1364, _165
+.LVL60:
+	.loc 2 1066 33 view .LVU389
+.LBE2744:
+.LBE2743:
+.LBB2746:
+.LBB2742:
+# /usr/lib/gcc/x86_64-linux-gnu/12/include/smmintrin.h:168:   return (__m128i) __builtin_ia32_pblendw128 ((__v8hi)__X,
+	.loc 3 168 20 view .LVU390
+	pblendw	$48, %xmm12, %xmm14	#, tmp1357, tmp1359
+.LVL61:
+	.loc 3 168 20 view .LVU391
+.LBE2742:
+.LBE2746:
+	.loc 1 304 13 is_stmt 1 view .LVU392
+	.loc 1 304 55 view .LVU393
+	.loc 1 304 60 view .LVU394
+.LBB2747:
+.LBI2747:
+	.loc 2 1064 1 view .LVU395
+.LBB2748:
+	.loc 2 1066 3 view .LVU396
+	.loc 2 1066 3 is_stmt 0 view .LVU397
+.LBE2748:
+.LBE2747:
+.LBB2749:
+.LBI2712:
+	.loc 2 1064 1 is_stmt 1 view .LVU398
+.LBB2715:
+	.loc 2 1066 3 view .LVU399
+	.loc 2 1066 3 is_stmt 0 view .LVU400
+.LBE2715:
+.LBE2749:
+	.loc 1 304 109 is_stmt 1 view .LVU401
+.LBB2750:
+.LBI2727:
+	.loc 2 1327 1 view .LVU402
+.LBB2729:
+	.loc 2 1329 3 view .LVU403
+	.loc 2 1329 3 is_stmt 0 view .LVU404
+.LBE2729:
+.LBE2750:
+.LBB2751:
+.LBI2734:
+	.loc 4 136 1 is_stmt 1 view .LVU405
+.LBB2736:
+	.loc 4 138 3 view .LVU406
+	.loc 4 138 3 is_stmt 0 view .LVU407
+.LBE2736:
+.LBE2751:
+	.loc 1 304 163 is_stmt 1 view .LVU408
+.LBB2752:
+.LBI2743:
+	.loc 2 1064 1 view .LVU409
+.LBB2745:
+	.loc 2 1066 3 view .LVU410
+	.loc 2 1066 3 is_stmt 0 view .LVU411
+.LBE2745:
+.LBE2752:
+	.loc 1 304 193 is_stmt 1 view .LVU412
+.LBB2753:
+.LBI2753:
+	.loc 2 1327 1 view .LVU413
+.LBB2754:
+	.loc 2 1329 3 view .LVU414
+	.loc 2 1329 3 is_stmt 0 view .LVU415
+.LBE2754:
+.LBE2753:
+.LBB2756:
+.LBI2756:
+	.loc 2 1184 1 is_stmt 1 view .LVU416
+.LBB2757:
+	.loc 2 1186 3 view .LVU417
+.LBE2757:
+.LBE2756:
+.LBB2760:
+.LBB2755:
+# /usr/lib/gcc/x86_64-linux-gnu/12/include/emmintrin.h:1329:   return (__m128i) ((__v2du)__A ^ (__v2du)__B);
+	.loc 2 1329 33 is_stmt 0 view .LVU418
+	pxor	%xmm2, %xmm0	# _165, tmp1366
+.LVL62:
+	.loc 2 1329 33 view .LVU419
+.LBE2755:
+.LBE2760:
+.LBB2761:
+.LBB2758:
+# /usr/lib/gcc/x86_64-linux-gnu/12/include/emmintrin.h:1186:   return (__m128i)__builtin_ia32_pslldi128 ((__v4si)__A, __B);
+	.loc 2 1186 19 view .LVU420
+	movdqa	%xmm0, %xmm15	# tmp1366, tmp1367
+.LBE2758:
+.LBE2761:
+.LBB2762:
+.LBB2763:
+# /usr/lib/gcc/x86_64-linux-gnu/12/include/emmintrin.h:1251:   return (__m128i)__builtin_ia32_psrldi128 ((__v4si)__A, __B);
+	.loc 2 1251 19 view .LVU421
+	psrld	$12, %xmm0	#, tmp1369
+.LVL63:
+	.loc 2 1251 19 view .LVU422
+.LBE2763:
+.LBE2762:
+.LBB2765:
+.LBB2759:
+# /usr/lib/gcc/x86_64-linux-gnu/12/include/emmintrin.h:1186:   return (__m128i)__builtin_ia32_pslldi128 ((__v4si)__A, __B);
+	.loc 2 1186 19 view .LVU423
+	pslld	$20, %xmm15	#, tmp1367
+.LVL64:
+	.loc 2 1186 19 view .LVU424
+.LBE2759:
+.LBE2765:
+.LBB2766:
+.LBI2762:
+	.loc 2 1249 1 is_stmt 1 view .LVU425
+.LBB2764:
+	.loc 2 1251 3 view .LVU426
+	.loc 2 1251 3 is_stmt 0 view .LVU427
+.LBE2764:
+.LBE2766:
+.LBB2767:
+.LBI2767:
+	.loc 2 1321 1 is_stmt 1 view .LVU428
+.LBB2768:
+	.loc 2 1323 3 view .LVU429
+# /usr/lib/gcc/x86_64-linux-gnu/12/include/emmintrin.h:1323:   return (__m128i) ((__v2du)__A | (__v2du)__B);
+	.loc 2 1323 33 is_stmt 0 view .LVU430
+	por	%xmm15, %xmm0	# tmp1367, _174
+.LVL65:
+	.loc 2 1323 33 view .LVU431
+.LBE2768:
+.LBE2767:
+	.loc 1 304 300 is_stmt 1 view .LVU432
+.LBB2769:
+.LBI2769:
+	.loc 2 1064 1 view .LVU433
+.LBB2770:
+	.loc 2 1066 3 view .LVU434
+	.loc 2 1066 3 is_stmt 0 view .LVU435
+.LBE2770:
+.LBE2769:
+.LBB2771:
+.LBI2771:
+	.loc 2 1064 1 is_stmt 1 view .LVU436
+.LBB2772:
+	.loc 2 1066 3 view .LVU437
+# /usr/lib/gcc/x86_64-linux-gnu/12/include/emmintrin.h:1066:   return (__m128i) ((__v4su)__A + (__v4su)__B);
+	.loc 2 1066 33 is_stmt 0 view .LVU438
+	paddd	%xmm0, %xmm8	# _174, tmp1371
+.LVL66:
+	.loc 2 1066 33 view .LVU439
+	paddd	%xmm9, %xmm8	# _157, _178
+.LVL67:
+	.loc 2 1066 33 view .LVU440
+.LBE2772:
+.LBE2771:
+	.loc 1 304 349 is_stmt 1 view .LVU441
+.LBB2773:
+.LBI2773:
+	.loc 2 1327 1 view .LVU442
+.LBB2774:
+	.loc 2 1329 3 view .LVU443
+	.loc 2 1329 3 is_stmt 0 view .LVU444
+.LBE2774:
+.LBE2773:
+.LBB2776:
+.LBI2776:
+	.loc 4 136 1 is_stmt 1 view .LVU445
+.LBB2777:
+	.loc 4 138 3 view .LVU446
+.LBE2777:
+.LBE2776:
+.LBB2779:
+.LBB2775:
+# /usr/lib/gcc/x86_64-linux-gnu/12/include/emmintrin.h:1329:   return (__m128i) ((__v2du)__A ^ (__v2du)__B);
+	.loc 2 1329 33 is_stmt 0 view .LVU447
+	pxor	%xmm8, %xmm1	# _178, tmp1372
+.LVL68:
+	.loc 2 1329 33 view .LVU448
+.LBE2775:
+.LBE2779:
+.LBB2780:
+.LBB2778:
+# /usr/lib/gcc/x86_64-linux-gnu/12/include/tmmintrin.h:138:   return (__m128i) __builtin_ia32_pshufb128 ((__v16qi)__X, (__v16qi)__Y);
+	.loc 4 138 20 view .LVU449
+	pshufb	.LC2(%rip), %xmm1	#, tmp1373
+.LVL69:
+	.loc 4 138 20 view .LVU450
+.LBE2778:
+.LBE2780:
+	.loc 1 304 402 is_stmt 1 view .LVU451
+.LBB2781:
+.LBI2781:
+	.loc 2 1064 1 view .LVU452
+.LBB2782:
+	.loc 2 1066 3 view .LVU453
+# /usr/lib/gcc/x86_64-linux-gnu/12/include/emmintrin.h:1066:   return (__m128i) ((__v4su)__A + (__v4su)__B);
+	.loc 2 1066 33 is_stmt 0 view .LVU454
+	paddd	%xmm1, %xmm2	# tmp1373, _185
+.LVL70:
+	.loc 2 1066 33 view .LVU455
+.LBE2782:
+.LBE2781:
+	.loc 1 304 432 is_stmt 1 view .LVU456
+.LBB2783:
+.LBI2783:
+	.loc 2 1327 1 view .LVU457
+.LBB2784:
+	.loc 2 1329 3 view .LVU458
+	.loc 2 1329 3 is_stmt 0 view .LVU459
+.LBE2784:
+.LBE2783:
+.LBB2786:
+.LBI2786:
+	.loc 2 1184 1 is_stmt 1 view .LVU460
+.LBB2787:
+	.loc 2 1186 3 view .LVU461
+.LBE2787:
+.LBE2786:
+.LBB2790:
+.LBB2791:
+# /usr/lib/gcc/x86_64-linux-gnu/12/include/emmintrin.h:1458:   return (__m128i)__builtin_ia32_pshufd ((__v4si)__A, __mask);
+	.loc 2 1458 19 is_stmt 0 view .LVU462
+	pshufd	$147, %xmm1, %xmm1	#, tmp1373, tmp1385
+.LVL71:
+	.loc 2 1458 19 view .LVU463
+.LBE2791:
+.LBE2790:
+.LBB2793:
+.LBB2785:
+# /usr/lib/gcc/x86_64-linux-gnu/12/include/emmintrin.h:1329:   return (__m128i) ((__v2du)__A ^ (__v2du)__B);
+	.loc 2 1329 33 view .LVU464
+	pxor	%xmm2, %xmm0	# _185, tmp1375
+.LVL72:
+	.loc 2 1329 33 view .LVU465
+.LBE2785:
+.LBE2793:
+.LBB2794:
+.LBB2795:
+# /usr/lib/gcc/x86_64-linux-gnu/12/include/emmintrin.h:1458:   return (__m128i)__builtin_ia32_pshufd ((__v4si)__A, __mask);
+	.loc 2 1458 19 view .LVU466
+	pshufd	$78, %xmm2, %xmm2	#, _185, tmp1383
+.LVL73:
+	.loc 2 1458 19 view .LVU467
+.LBE2795:
+.LBE2794:
+.LBB2797:
+.LBB2788:
+# /usr/lib/gcc/x86_64-linux-gnu/12/include/emmintrin.h:1186:   return (__m128i)__builtin_ia32_pslldi128 ((__v4si)__A, __B);
+	.loc 2 1186 19 view .LVU468
+	movdqa	%xmm0, %xmm9	# tmp1375, tmp1376
+.LBE2788:
+.LBE2797:
+.LBB2798:
+.LBB2799:
+# /usr/lib/gcc/x86_64-linux-gnu/12/include/emmintrin.h:1251:   return (__m128i)__builtin_ia32_psrldi128 ((__v4si)__A, __B);
+	.loc 2 1251 19 view .LVU469
+	psrld	$7, %xmm0	#, tmp1378
+.LVL74:
+	.loc 2 1251 19 view .LVU470
+.LBE2799:
+.LBE2798:
+.LBB2801:
+.LBB2789:
+# /usr/lib/gcc/x86_64-linux-gnu/12/include/emmintrin.h:1186:   return (__m128i)__builtin_ia32_pslldi128 ((__v4si)__A, __B);
+	.loc 2 1186 19 view .LVU471
+	pslld	$25, %xmm9	#, tmp1376
+.LVL75:
+	.loc 2 1186 19 view .LVU472
+.LBE2789:
+.LBE2801:
+.LBB2802:
+.LBI2798:
+	.loc 2 1249 1 is_stmt 1 view .LVU473
+.LBB2800:
+	.loc 2 1251 3 view .LVU474
+	.loc 2 1251 3 is_stmt 0 view .LVU475
+.LBE2800:
+.LBE2802:
+.LBB2803:
+.LBI2803:
+	.loc 2 1321 1 is_stmt 1 view .LVU476
+.LBB2804:
+	.loc 2 1323 3 view .LVU477
+	.loc 2 1323 3 is_stmt 0 view .LVU478
+.LBE2804:
+.LBE2803:
+	.loc 1 304 58 is_stmt 1 view .LVU479
+	.loc 1 304 551 view .LVU480
+.LBB2806:
+.LBI2806:
+	.loc 2 1456 1 view .LVU481
+.LBB2807:
+	.loc 2 1458 3 view .LVU482
+.LBE2807:
+.LBE2806:
+.LBB2809:
+.LBB2805:
+# /usr/lib/gcc/x86_64-linux-gnu/12/include/emmintrin.h:1323:   return (__m128i) ((__v2du)__A | (__v2du)__B);
+	.loc 2 1323 33 is_stmt 0 view .LVU483
+	por	%xmm9, %xmm0	# tmp1376, tmp1381
+.LVL76:
+	.loc 2 1323 33 view .LVU484
+.LBE2805:
+.LBE2809:
+.LBB2810:
+.LBB2808:
+# /usr/lib/gcc/x86_64-linux-gnu/12/include/emmintrin.h:1458:   return (__m128i)__builtin_ia32_pshufd ((__v4si)__A, __mask);
+	.loc 2 1458 19 view .LVU485
+	pshufd	$57, %xmm0, %xmm0	#, tmp1381, tmp1380
+.LVL77:
+	.loc 2 1458 19 view .LVU486
+.LBE2808:
+.LBE2810:
+	.loc 1 304 7 is_stmt 1 view .LVU487
+.LBB2811:
+.LBI2794:
+	.loc 2 1456 1 view .LVU488
+.LBB2796:
+	.loc 2 1458 3 view .LVU489
+	.loc 2 1458 3 is_stmt 0 view .LVU490
+.LBE2796:
+.LBE2811:
+	.loc 1 304 7 is_stmt 1 view .LVU491
+.LBB2812:
+.LBI2790:
+	.loc 2 1456 1 view .LVU492
+.LBB2792:
+	.loc 2 1458 3 view .LVU493
+	.loc 2 1458 3 is_stmt 0 view .LVU494
+.LBE2792:
+.LBE2812:
+	.loc 1 304 7 is_stmt 1 view .LVU495
+	.loc 1 304 12 view .LVU496
+.LBB2813:
+.LBI2813:
+	.loc 2 1064 1 view .LVU497
+.LBB2814:
+	.loc 2 1066 3 view .LVU498
+	.loc 2 1066 3 is_stmt 0 view .LVU499
+.LBE2814:
+.LBE2813:
+.LBB2815:
+.LBI2815:
+	.loc 2 1064 1 is_stmt 1 view .LVU500
+.LBB2816:
+	.loc 2 1066 3 view .LVU501
+# /usr/lib/gcc/x86_64-linux-gnu/12/include/emmintrin.h:1066:   return (__m128i) ((__v4su)__A + (__v4su)__B);
+	.loc 2 1066 33 is_stmt 0 view .LVU502
+	paddd	%xmm0, %xmm7	# tmp1380, tmp1387
+.LVL78:
+	.loc 2 1066 33 view .LVU503
+	paddd	%xmm8, %xmm7	# _178, _203
+.LVL79:
+	.loc 2 1066 33 view .LVU504
+.LBE2816:
+.LBE2815:
+	.loc 1 304 61 is_stmt 1 view .LVU505
+.LBB2817:
+.LBI2817:
+	.loc 2 1327 1 view .LVU506
+.LBB2818:
+	.loc 2 1329 3 view .LVU507
+	.loc 2 1329 3 is_stmt 0 view .LVU508
+.LBE2818:
+.LBE2817:
+.LBB2820:
+.LBI2820:
+	.loc 4 136 1 is_stmt 1 view .LVU509
+.LBB2821:
+	.loc 4 138 3 view .LVU510
+.LBE2821:
+.LBE2820:
+.LBB2823:
+.LBB2819:
+# /usr/lib/gcc/x86_64-linux-gnu/12/include/emmintrin.h:1329:   return (__m128i) ((__v2du)__A ^ (__v2du)__B);
+	.loc 2 1329 33 is_stmt 0 view .LVU511
+	pxor	%xmm7, %xmm1	# _203, tmp1388
+.LVL80:
+	.loc 2 1329 33 view .LVU512
+.LBE2819:
+.LBE2823:
+.LBB2824:
+.LBB2822:
+# /usr/lib/gcc/x86_64-linux-gnu/12/include/tmmintrin.h:138:   return (__m128i) __builtin_ia32_pshufb128 ((__v16qi)__X, (__v16qi)__Y);
+	.loc 4 138 20 view .LVU513
+	pshufb	.LC0(%rip), %xmm1	#, tmp1389
+.LVL81:
+	.loc 4 138 20 view .LVU514
+.LBE2822:
+.LBE2824:
+	.loc 1 304 115 is_stmt 1 view .LVU515
+.LBB2825:
+.LBI2825:
+	.loc 2 1064 1 view .LVU516
+.LBB2826:
+	.loc 2 1066 3 view .LVU517
+# /usr/lib/gcc/x86_64-linux-gnu/12/include/emmintrin.h:1066:   return (__m128i) ((__v4su)__A + (__v4su)__B);
+	.loc 2 1066 33 is_stmt 0 view .LVU518
+	paddd	%xmm1, %xmm2	# tmp1389, _211
+.LVL82:
+	.loc 2 1066 33 view .LVU519
+.LBE2826:
+.LBE2825:
+	.loc 1 304 145 is_stmt 1 view .LVU520
+.LBB2827:
+.LBI2827:
+	.loc 2 1327 1 view .LVU521
+.LBB2828:
+	.loc 2 1329 3 view .LVU522
+	.loc 2 1329 3 is_stmt 0 view .LVU523
+.LBE2828:
+.LBE2827:
+.LBB2830:
+.LBI2830:
+	.loc 2 1184 1 is_stmt 1 view .LVU524
+.LBB2831:
+	.loc 2 1186 3 view .LVU525
+.LBE2831:
+.LBE2830:
+.LBB2834:
+.LBB2829:
+# /usr/lib/gcc/x86_64-linux-gnu/12/include/emmintrin.h:1329:   return (__m128i) ((__v2du)__A ^ (__v2du)__B);
+	.loc 2 1329 33 is_stmt 0 view .LVU526
+	pxor	%xmm2, %xmm0	# _211, tmp1391
+.LVL83:
+	.loc 2 1329 33 view .LVU527
+.LBE2829:
+.LBE2834:
+.LBB2835:
+.LBB2832:
+# /usr/lib/gcc/x86_64-linux-gnu/12/include/emmintrin.h:1186:   return (__m128i)__builtin_ia32_pslldi128 ((__v4si)__A, __B);
+	.loc 2 1186 19 view .LVU528
+	movdqa	%xmm0, %xmm8	# tmp1391, tmp1392
+.LBE2832:
+.LBE2835:
+.LBB2836:
+.LBB2837:
+# /usr/lib/gcc/x86_64-linux-gnu/12/include/emmintrin.h:1251:   return (__m128i)__builtin_ia32_psrldi128 ((__v4si)__A, __B);
+	.loc 2 1251 19 view .LVU529
+	psrld	$12, %xmm0	#, tmp1394
+.LVL84:
+	.loc 2 1251 19 view .LVU530
+.LBE2837:
+.LBE2836:
+.LBB2839:
+.LBB2833:
+# /usr/lib/gcc/x86_64-linux-gnu/12/include/emmintrin.h:1186:   return (__m128i)__builtin_ia32_pslldi128 ((__v4si)__A, __B);
+	.loc 2 1186 19 view .LVU531
+	pslld	$20, %xmm8	#, tmp1392
+.LVL85:
+	.loc 2 1186 19 view .LVU532
+.LBE2833:
+.LBE2839:
+.LBB2840:
+.LBI2836:
+	.loc 2 1249 1 is_stmt 1 view .LVU533
+.LBB2838:
+	.loc 2 1251 3 view .LVU534
+	.loc 2 1251 3 is_stmt 0 view .LVU535
+.LBE2838:
+.LBE2840:
+.LBB2841:
+.LBI2841:
+	.loc 2 1321 1 is_stmt 1 view .LVU536
+.LBB2842:
+	.loc 2 1323 3 view .LVU537
+# /usr/lib/gcc/x86_64-linux-gnu/12/include/emmintrin.h:1323:   return (__m128i) ((__v2du)__A | (__v2du)__B);
+	.loc 2 1323 33 is_stmt 0 view .LVU538
+	por	%xmm8, %xmm0	# tmp1392, _220
+.LVL86:
+	.loc 2 1323 33 view .LVU539
+.LBE2842:
+.LBE2841:
+	.loc 1 304 252 is_stmt 1 view .LVU540
+.LBB2843:
+.LBI2843:
+	.loc 2 1064 1 view .LVU541
+.LBB2844:
+	.loc 2 1066 3 view .LVU542
+	.loc 2 1066 3 is_stmt 0 view .LVU543
+.LBE2844:
+.LBE2843:
+.LBB2845:
+.LBI2845:
+	.loc 2 1064 1 is_stmt 1 view .LVU544
+.LBB2846:
+	.loc 2 1066 3 view .LVU545
+.LBE2846:
+.LBE2845:
+.LBB2848:
+.LBB2849:
+# /usr/lib/gcc/x86_64-linux-gnu/12/include/emmintrin.h:1458:   return (__m128i)__builtin_ia32_pshufd ((__v4si)__A, __mask);
+	.loc 2 1458 19 is_stmt 0 view .LVU546
+	pshufd	$224, %xmm3, %xmm8	#, m0, tmp1422
+.LBE2849:
+.LBE2848:
+.LBB2851:
+.LBB2847:
+# /usr/lib/gcc/x86_64-linux-gnu/12/include/emmintrin.h:1066:   return (__m128i) ((__v4su)__A + (__v4su)__B);
+	.loc 2 1066 33 view .LVU547
+	paddd	%xmm0, %xmm14	# _220, tmp1396
+.LVL87:
+	.loc 2 1066 33 view .LVU548
+	paddd	%xmm7, %xmm14	# _203, _224
+.LVL88:
+	.loc 2 1066 33 view .LVU549
+.LBE2847:
+.LBE2851:
+	.loc 1 304 301 is_stmt 1 view .LVU550
+.LBB2852:
+.LBI2852:
+	.loc 2 1327 1 view .LVU551
+.LBB2853:
+	.loc 2 1329 3 view .LVU552
+	.loc 2 1329 3 is_stmt 0 view .LVU553
+.LBE2853:
+.LBE2852:
+.LBB2855:
+.LBI2855:
+	.loc 4 136 1 is_stmt 1 view .LVU554
+.LBB2856:
+	.loc 4 138 3 view .LVU555
+.LBE2856:
+.LBE2855:
+.LBB2858:
+.LBB2859:
+# /usr/lib/gcc/x86_64-linux-gnu/12/include/emmintrin.h:1458:   return (__m128i)__builtin_ia32_pshufd ((__v4si)__A, __mask);
+	.loc 2 1458 19 is_stmt 0 view .LVU556
+	pshufd	$224, %xmm6, %xmm7	#, m3, tmp1414
+.LBE2859:
+.LBE2858:
+.LBB2861:
+.LBB2854:
+# /usr/lib/gcc/x86_64-linux-gnu/12/include/emmintrin.h:1329:   return (__m128i) ((__v2du)__A ^ (__v2du)__B);
+	.loc 2 1329 33 view .LVU557
+	pxor	%xmm14, %xmm1	# _224, tmp1397
+.LVL89:
+	.loc 2 1329 33 view .LVU558
+.LBE2854:
+.LBE2861:
+.LBB2862:
+.LBB2857:
+# /usr/lib/gcc/x86_64-linux-gnu/12/include/tmmintrin.h:138:   return (__m128i) __builtin_ia32_pshufb128 ((__v16qi)__X, (__v16qi)__Y);
+	.loc 4 138 20 view .LVU559
+	pshufb	.LC2(%rip), %xmm1	#, tmp1398
+.LVL90:
+	.loc 4 138 20 view .LVU560
+.LBE2857:
+.LBE2862:
+	.loc 1 304 354 is_stmt 1 view .LVU561
+.LBB2863:
+.LBI2863:
+	.loc 2 1064 1 view .LVU562
+.LBB2864:
+	.loc 2 1066 3 view .LVU563
+# /usr/lib/gcc/x86_64-linux-gnu/12/include/emmintrin.h:1066:   return (__m128i) ((__v4su)__A + (__v4su)__B);
+	.loc 2 1066 33 is_stmt 0 view .LVU564
+	paddd	%xmm1, %xmm2	# tmp1398, _231
+.LVL91:
+	.loc 2 1066 33 view .LVU565
+.LBE2864:
+.LBE2863:
+	.loc 1 304 384 is_stmt 1 view .LVU566
+.LBB2865:
+.LBI2865:
+	.loc 2 1327 1 view .LVU567
+.LBB2866:
+	.loc 2 1329 3 view .LVU568
+	.loc 2 1329 3 is_stmt 0 view .LVU569
+.LBE2866:
+.LBE2865:
+.LBB2868:
+.LBI2868:
+	.loc 2 1184 1 is_stmt 1 view .LVU570
+.LBB2869:
+	.loc 2 1186 3 view .LVU571
+.LBE2869:
+.LBE2868:
+.LBB2872:
+.LBB2873:
+# /usr/lib/gcc/x86_64-linux-gnu/12/include/emmintrin.h:1458:   return (__m128i)__builtin_ia32_pshufd ((__v4si)__A, __mask);
+	.loc 2 1458 19 is_stmt 0 view .LVU572
+	pshufd	$57, %xmm1, %xmm1	#, tmp1398, tmp1410
+.LVL92:
+	.loc 2 1458 19 view .LVU573
+.LBE2873:
+.LBE2872:
+.LBB2875:
+.LBB2867:
+# /usr/lib/gcc/x86_64-linux-gnu/12/include/emmintrin.h:1329:   return (__m128i) ((__v2du)__A ^ (__v2du)__B);
+	.loc 2 1329 33 view .LVU574
+	pxor	%xmm2, %xmm0	# _231, tmp1400
+.LVL93:
+	.loc 2 1329 33 view .LVU575
+.LBE2867:
+.LBE2875:
+.LBB2876:
+.LBB2877:
+# /usr/lib/gcc/x86_64-linux-gnu/12/include/emmintrin.h:1458:   return (__m128i)__builtin_ia32_pshufd ((__v4si)__A, __mask);
+	.loc 2 1458 19 view .LVU576
+	pshufd	$78, %xmm2, %xmm2	#, _231, tmp1408
+.LVL94:
+	.loc 2 1458 19 view .LVU577
+.LBE2877:
+.LBE2876:
+.LBB2879:
+.LBB2870:
+# /usr/lib/gcc/x86_64-linux-gnu/12/include/emmintrin.h:1186:   return (__m128i)__builtin_ia32_pslldi128 ((__v4si)__A, __B);
+	.loc 2 1186 19 view .LVU578
+	movdqa	%xmm0, %xmm15	# tmp1400, tmp1401
+.LBE2870:
+.LBE2879:
+.LBB2880:
+.LBB2881:
+# /usr/lib/gcc/x86_64-linux-gnu/12/include/emmintrin.h:1251:   return (__m128i)__builtin_ia32_psrldi128 ((__v4si)__A, __B);
+	.loc 2 1251 19 view .LVU579
+	psrld	$7, %xmm0	#, tmp1403
+.LVL95:
+	.loc 2 1251 19 view .LVU580
+.LBE2881:
+.LBE2880:
+.LBB2883:
+.LBB2871:
+# /usr/lib/gcc/x86_64-linux-gnu/12/include/emmintrin.h:1186:   return (__m128i)__builtin_ia32_pslldi128 ((__v4si)__A, __B);
+	.loc 2 1186 19 view .LVU581
+	pslld	$25, %xmm15	#, tmp1401
+.LVL96:
+	.loc 2 1186 19 view .LVU582
+.LBE2871:
+.LBE2883:
+.LBB2884:
+.LBI2880:
+	.loc 2 1249 1 is_stmt 1 view .LVU583
+.LBB2882:
+	.loc 2 1251 3 view .LVU584
+	.loc 2 1251 3 is_stmt 0 view .LVU585
+.LBE2882:
+.LBE2884:
+.LBB2885:
+.LBI2885:
+	.loc 2 1321 1 is_stmt 1 view .LVU586
+.LBB2886:
+	.loc 2 1323 3 view .LVU587
+	.loc 2 1323 3 is_stmt 0 view .LVU588
+.LBE2886:
+.LBE2885:
+	.loc 1 304 10 is_stmt 1 view .LVU589
+	.loc 1 304 503 view .LVU590
+.LBB2888:
+.LBI2888:
+	.loc 2 1456 1 view .LVU591
+.LBB2889:
+	.loc 2 1458 3 view .LVU592
+.LBE2889:
+.LBE2888:
+.LBB2891:
+.LBB2887:
+# /usr/lib/gcc/x86_64-linux-gnu/12/include/emmintrin.h:1323:   return (__m128i) ((__v2du)__A | (__v2du)__B);
+	.loc 2 1323 33 is_stmt 0 view .LVU593
+	por	%xmm15, %xmm0	# tmp1401, tmp1406
+.LVL97:
+	.loc 2 1323 33 view .LVU594
+.LBE2887:
+.LBE2891:
+.LBB2892:
+.LBB2893:
+# /usr/lib/gcc/x86_64-linux-gnu/12/include/emmintrin.h:1458:   return (__m128i)__builtin_ia32_pshufd ((__v4si)__A, __mask);
+	.loc 2 1458 19 view .LVU595
+	pshufd	$231, %xmm5, %xmm15	#, m2, tmp1412
+.LBE2893:
+.LBE2892:
+.LBB2895:
+.LBB2896:
+# /usr/lib/gcc/x86_64-linux-gnu/12/include/smmintrin.h:168:   return (__m128i) __builtin_ia32_pblendw128 ((__v8hi)__X,
+	.loc 3 168 20 view .LVU596
+	movdqa	%xmm15, %xmm9	# tmp1412, tmp1416
+	movaps	%xmm15, -8(%rsp)	# tmp1412, %sfp
+.LBE2896:
+.LBE2895:
+.LBB2898:
+.LBB2890:
+# /usr/lib/gcc/x86_64-linux-gnu/12/include/emmintrin.h:1458:   return (__m128i)__builtin_ia32_pshufd ((__v4si)__A, __mask);
+	.loc 2 1458 19 view .LVU597
+	pshufd	$147, %xmm0, %xmm0	#, tmp1406, tmp1405
+.LVL98:
+	.loc 2 1458 19 view .LVU598
+.LBE2890:
+.LBE2898:
+	.loc 1 304 7 is_stmt 1 view .LVU599
+.LBB2899:
+.LBI2876:
+	.loc 2 1456 1 view .LVU600
+.LBB2878:
+	.loc 2 1458 3 view .LVU601
+	.loc 2 1458 3 is_stmt 0 view .LVU602
+.LBE2878:
+.LBE2899:
+	.loc 1 304 7 is_stmt 1 view .LVU603
+.LBB2900:
+.LBI2872:
+	.loc 2 1456 1 view .LVU604
+.LBB2874:
+	.loc 2 1458 3 view .LVU605
+	.loc 2 1458 3 is_stmt 0 view .LVU606
+.LBE2874:
+.LBE2900:
+	.loc 1 304 8 is_stmt 1 view .LVU607
+	.loc 1 305 5 view .LVU608
+	.loc 1 305 10 view .LVU609
+	.loc 1 305 15 view .LVU610
+.LBB2901:
+.LBI2892:
+	.loc 2 1456 1 view .LVU611
+.LBB2894:
+	.loc 2 1458 3 view .LVU612
+	.loc 2 1458 3 is_stmt 0 view .LVU613
+.LBE2894:
+.LBE2901:
+	.loc 1 305 7 is_stmt 1 view .LVU614
+.LBB2902:
+.LBI2858:
+	.loc 2 1456 1 view .LVU615
+.LBB2860:
+	.loc 2 1458 3 view .LVU616
+	.loc 2 1458 3 is_stmt 0 view .LVU617
+.LBE2860:
+.LBE2902:
+	.loc 1 305 7 is_stmt 1 view .LVU618
+.LBB2903:
+.LBI2895:
+	.loc 3 166 1 view .LVU619
+.LBB2897:
+	.loc 3 168 3 view .LVU620
+# /usr/lib/gcc/x86_64-linux-gnu/12/include/smmintrin.h:168:   return (__m128i) __builtin_ia32_pblendw128 ((__v8hi)__X,
+	.loc 3 168 20 is_stmt 0 view .LVU621
+	pblendw	$204, %xmm7, %xmm9	#, tmp1414, tmp1416
+	movdqa	%xmm9, %xmm15	# tmp1416, tmp1416
+.LVL99:
+	.loc 3 168 20 view .LVU622
+.LBE2897:
+.LBE2903:
+	.loc 1 305 42 is_stmt 1 view .LVU623
+	.loc 1 305 7 view .LVU624
+.LBB2904:
+.LBI2904:
+	.loc 3 166 1 view .LVU625
+.LBB2905:
+	.loc 3 168 3 view .LVU626
+.LBE2905:
+.LBE2904:
+.LBB2907:
+.LBB2908:
+# /usr/lib/gcc/x86_64-linux-gnu/12/include/emmintrin.h:1458:   return (__m128i)__builtin_ia32_pshufd ((__v4si)__A, __mask);
+	.loc 2 1458 19 is_stmt 0 view .LVU627
+	pshufd	$230, %xmm6, %xmm9	#, m3, tmp1442
+.LBE2908:
+.LBE2907:
+.LBB2910:
+.LBB2906:
+# /usr/lib/gcc/x86_64-linux-gnu/12/include/smmintrin.h:168:   return (__m128i) __builtin_ia32_pblendw128 ((__v8hi)__X,
+	.loc 3 168 20 view .LVU628
+	pblendw	$48, %xmm13, %xmm15	#, tmp1248, tmp1419
+.LVL100:
+	.loc 3 168 20 view .LVU629
+.LBE2906:
+.LBE2910:
+	.loc 1 305 42 is_stmt 1 view .LVU630
+	.loc 1 305 51 view .LVU631
+.LBB2911:
+.LBI2848:
+	.loc 2 1456 1 view .LVU632
+.LBB2850:
+	.loc 2 1458 3 view .LVU633
+	.loc 2 1458 3 is_stmt 0 view .LVU634
+.LBE2850:
+.LBE2911:
+	.loc 1 305 7 is_stmt 1 view .LVU635
+.LBB2912:
+.LBI2912:
+	.loc 3 166 1 view .LVU636
+.LBB2913:
+	.loc 3 168 3 view .LVU637
+# /usr/lib/gcc/x86_64-linux-gnu/12/include/smmintrin.h:168:   return (__m128i) __builtin_ia32_pblendw128 ((__v8hi)__X,
+	.loc 3 168 20 is_stmt 0 view .LVU638
+	movdqa	%xmm5, %xmm13	# m2, tmp1424
+	pblendw	$60, %xmm8, %xmm13	#, tmp1422, tmp1424
+.LBE2913:
+.LBE2912:
+.LBB2915:
+.LBB2916:
+# /usr/lib/gcc/x86_64-linux-gnu/12/include/emmintrin.h:1066:   return (__m128i) ((__v4su)__A + (__v4su)__B);
+	.loc 2 1066 33 view .LVU639
+	paddd	%xmm0, %xmm15	# tmp1405, tmp1454
+.LVL101:
+	.loc 2 1066 33 view .LVU640
+.LBE2916:
+.LBE2915:
+.LBB2919:
+.LBB2920:
+# /usr/lib/gcc/x86_64-linux-gnu/12/include/emmintrin.h:1458:   return (__m128i)__builtin_ia32_pshufd ((__v4si)__A, __mask);
+	.loc 2 1458 19 view .LVU641
+	pshufd	$100, %xmm6, %xmm8	#, m3, tmp1427
+.LVL102:
+	.loc 2 1458 19 view .LVU642
+.LBE2920:
+.LBE2919:
+.LBB2922:
+.LBB2914:
+# /usr/lib/gcc/x86_64-linux-gnu/12/include/smmintrin.h:168:   return (__m128i) __builtin_ia32_pblendw128 ((__v8hi)__X,
+	.loc 3 168 20 view .LVU643
+	movdqa	%xmm13, %xmm7	# tmp1424, tmp1424
+.LVL103:
+	.loc 3 168 20 view .LVU644
+.LBE2914:
+.LBE2922:
+	.loc 1 305 42 is_stmt 1 view .LVU645
+.LBB2923:
+.LBI2919:
+	.loc 2 1456 1 view .LVU646
+.LBB2921:
+	.loc 2 1458 3 view .LVU647
+	.loc 2 1458 3 is_stmt 0 view .LVU648
+.LBE2921:
+.LBE2923:
+	.loc 1 305 7 is_stmt 1 view .LVU649
+.LBB2924:
+.LBI2924:
+	.loc 3 166 1 view .LVU650
+.LBB2925:
+	.loc 3 168 3 view .LVU651
+.LBE2925:
+.LBE2924:
+.LBB2927:
+.LBB2917:
+# /usr/lib/gcc/x86_64-linux-gnu/12/include/emmintrin.h:1066:   return (__m128i) ((__v4su)__A + (__v4su)__B);
+	.loc 2 1066 33 is_stmt 0 view .LVU652
+	paddd	%xmm14, %xmm15	# _224, _276
+.LBE2917:
+.LBE2927:
+.LBB2928:
+.LBB2929:
+# /usr/lib/gcc/x86_64-linux-gnu/12/include/emmintrin.h:1458:   return (__m128i)__builtin_ia32_pshufd ((__v4si)__A, __mask);
+	.loc 2 1458 19 view .LVU653
+	pshufd	$102, %xmm5, %xmm13	#, m2, tmp1432
+.LBE2929:
+.LBE2928:
+.LBB2931:
+.LBB2926:
+# /usr/lib/gcc/x86_64-linux-gnu/12/include/smmintrin.h:168:   return (__m128i) __builtin_ia32_pblendw128 ((__v8hi)__X,
+	.loc 3 168 20 view .LVU654
+	pblendw	$192, %xmm8, %xmm7	#, tmp1427, tmp1429
+.LVL104:
+	.loc 3 168 20 view .LVU655
+.LBE2926:
+.LBE2931:
+	.loc 1 305 42 is_stmt 1 view .LVU656
+.LBB2932:
+.LBI2928:
+	.loc 2 1456 1 view .LVU657
+.LBB2930:
+	.loc 2 1458 3 view .LVU658
+	.loc 2 1458 3 is_stmt 0 view .LVU659
+.LBE2930:
+.LBE2932:
+	.loc 1 305 7 is_stmt 1 view .LVU660
+.LBB2933:
+.LBI2933:
+	.loc 2 1456 1 view .LVU661
+.LBB2934:
+	.loc 2 1458 3 view .LVU662
+# /usr/lib/gcc/x86_64-linux-gnu/12/include/emmintrin.h:1458:   return (__m128i)__builtin_ia32_pshufd ((__v4si)__A, __mask);
+	.loc 2 1458 19 is_stmt 0 view .LVU663
+	pshufd	$236, %xmm3, %xmm8	#, m0, tmp1434
+.LVL105:
+	.loc 2 1458 19 view .LVU664
+.LBE2934:
+.LBE2933:
+	.loc 1 305 7 is_stmt 1 view .LVU665
+.LBB2935:
+.LBI2935:
+	.loc 3 166 1 view .LVU666
+.LBB2936:
+	.loc 3 168 3 view .LVU667
+.LBE2936:
+.LBE2935:
+.LBB2939:
+.LBB2940:
+# /usr/lib/gcc/x86_64-linux-gnu/12/include/emmintrin.h:1329:   return (__m128i) ((__v2du)__A ^ (__v2du)__B);
+	.loc 2 1329 33 is_stmt 0 view .LVU668
+	pxor	%xmm15, %xmm1	# _276, tmp1455
+.LVL106:
+	.loc 2 1329 33 view .LVU669
+.LBE2940:
+.LBE2939:
+.LBB2942:
+.LBB2943:
+# /usr/lib/gcc/x86_64-linux-gnu/12/include/tmmintrin.h:138:   return (__m128i) __builtin_ia32_pshufb128 ((__v16qi)__X, (__v16qi)__Y);
+	.loc 4 138 20 view .LVU670
+	pshufb	.LC0(%rip), %xmm1	#, tmp1456
+.LBE2943:
+.LBE2942:
+.LBB2945:
+.LBB2937:
+# /usr/lib/gcc/x86_64-linux-gnu/12/include/smmintrin.h:168:   return (__m128i) __builtin_ia32_pblendw128 ((__v8hi)__X,
+	.loc 3 168 20 view .LVU671
+	movaps	%xmm8, -120(%rsp)	# tmp1434, %sfp
+.LBE2937:
+.LBE2945:
+.LBB2946:
+.LBB2947:
+# /usr/lib/gcc/x86_64-linux-gnu/12/include/emmintrin.h:1458:   return (__m128i)__builtin_ia32_pshufd ((__v4si)__A, __mask);
+	.loc 2 1458 19 view .LVU672
+	pshufd	$40, %xmm4, %xmm8	#, m1, tmp1444
+.LVL107:
+	.loc 2 1458 19 view .LVU673
+.LBE2947:
+.LBE2946:
+.LBB2949:
+.LBB2938:
+# /usr/lib/gcc/x86_64-linux-gnu/12/include/smmintrin.h:168:   return (__m128i) __builtin_ia32_pblendw128 ((__v8hi)__X,
+	.loc 3 168 20 view .LVU674
+	pblendw	$12, -120(%rsp), %xmm13	#, %sfp, tmp1436
+.LVL108:
+	.loc 3 168 20 view .LVU675
+.LBE2938:
+.LBE2949:
+	.loc 1 305 42 is_stmt 1 view .LVU676
+	.loc 1 305 7 view .LVU677
+.LBB2950:
+.LBI2950:
+	.loc 3 166 1 view .LVU678
+.LBB2951:
+	.loc 3 168 3 view .LVU679
+.LBE2951:
+.LBE2950:
+.LBB2953:
+.LBB2954:
+# /usr/lib/gcc/x86_64-linux-gnu/12/include/emmintrin.h:1066:   return (__m128i) ((__v4su)__A + (__v4su)__B);
+	.loc 2 1066 33 is_stmt 0 view .LVU680
+	paddd	%xmm1, %xmm2	# tmp1456, _284
+.LVL109:
+	.loc 2 1066 33 view .LVU681
+.LBE2954:
+.LBE2953:
+.LBB2956:
+.LBB2952:
+# /usr/lib/gcc/x86_64-linux-gnu/12/include/smmintrin.h:168:   return (__m128i) __builtin_ia32_pblendw128 ((__v8hi)__X,
+	.loc 3 168 20 view .LVU682
+	pblendw	$48, %xmm12, %xmm13	#, tmp1357, tmp1439
+.LVL110:
+	.loc 3 168 20 view .LVU683
+.LBE2952:
+.LBE2956:
+	.loc 1 305 42 is_stmt 1 view .LVU684
+.LBB2957:
+.LBI2907:
+	.loc 2 1456 1 view .LVU685
+.LBB2909:
+	.loc 2 1458 3 view .LVU686
+	.loc 2 1458 3 is_stmt 0 view .LVU687
+.LBE2909:
+.LBE2957:
+	.loc 1 305 7 is_stmt 1 view .LVU688
+.LBB2958:
+.LBI2946:
+	.loc 2 1456 1 view .LVU689
+.LBB2948:
+	.loc 2 1458 3 view .LVU690
+	.loc 2 1458 3 is_stmt 0 view .LVU691
+.LBE2948:
+.LBE2958:
+	.loc 1 305 7 is_stmt 1 view .LVU692
+.LBB2959:
+.LBI2959:
+	.loc 3 166 1 view .LVU693
+.LBB2960:
+	.loc 3 168 3 view .LVU694
+# /usr/lib/gcc/x86_64-linux-gnu/12/include/smmintrin.h:168:   return (__m128i) __builtin_ia32_pblendw128 ((__v8hi)__X,
+	.loc 3 168 20 is_stmt 0 view .LVU695
+	movdqa	%xmm9, %xmm12	# tmp1442, tmp1446
+.LBE2960:
+.LBE2959:
+.LBB2962:
+.LBB2963:
+# /usr/lib/gcc/x86_64-linux-gnu/12/include/emmintrin.h:1329:   return (__m128i) ((__v2du)__A ^ (__v2du)__B);
+	.loc 2 1329 33 view .LVU696
+	pxor	%xmm2, %xmm0	# _284, tmp1458
+.LVL111:
+	.loc 2 1329 33 view .LVU697
+.LBE2963:
+.LBE2962:
+.LBB2965:
+.LBB2961:
+# /usr/lib/gcc/x86_64-linux-gnu/12/include/smmintrin.h:168:   return (__m128i) __builtin_ia32_pblendw128 ((__v8hi)__X,
+	.loc 3 168 20 view .LVU698
+	pblendw	$204, %xmm8, %xmm12	#, tmp1444, tmp1446
+.LVL112:
+	.loc 3 168 20 view .LVU699
+.LBE2961:
+.LBE2965:
+	.loc 1 305 42 is_stmt 1 view .LVU700
+.LBB2966:
+.LBI2966:
+	.loc 2 1456 1 view .LVU701
+.LBB2967:
+	.loc 2 1458 3 view .LVU702
+# /usr/lib/gcc/x86_64-linux-gnu/12/include/emmintrin.h:1458:   return (__m128i)__builtin_ia32_pshufd ((__v4si)__A, __mask);
+	.loc 2 1458 19 is_stmt 0 view .LVU703
+	pshufd	$212, %xmm3, %xmm8	#, m0, tmp1449
+.LVL113:
+	.loc 2 1458 19 view .LVU704
+.LBE2967:
+.LBE2966:
+	.loc 1 305 7 is_stmt 1 view .LVU705
+.LBB2968:
+.LBI2968:
+	.loc 3 166 1 view .LVU706
+.LBB2969:
+	.loc 3 168 3 view .LVU707
+# /usr/lib/gcc/x86_64-linux-gnu/12/include/smmintrin.h:168:   return (__m128i) __builtin_ia32_pblendw128 ((__v8hi)__X,
+	.loc 3 168 20 is_stmt 0 view .LVU708
+	movaps	%xmm8, -56(%rsp)	# tmp1449, %sfp
+.LBE2969:
+.LBE2968:
+.LBB2971:
+.LBB2972:
+# /usr/lib/gcc/x86_64-linux-gnu/12/include/emmintrin.h:1186:   return (__m128i)__builtin_ia32_pslldi128 ((__v4si)__A, __B);
+	.loc 2 1186 19 view .LVU709
+	movdqa	%xmm0, %xmm8	# tmp1458, tmp1459
+.LVL114:
+	.loc 2 1186 19 view .LVU710
+.LBE2972:
+.LBE2971:
+.LBB2974:
+.LBB2975:
+# /usr/lib/gcc/x86_64-linux-gnu/12/include/emmintrin.h:1251:   return (__m128i)__builtin_ia32_psrldi128 ((__v4si)__A, __B);
+	.loc 2 1251 19 view .LVU711
+	psrld	$12, %xmm0	#, tmp1461
+.LBE2975:
+.LBE2974:
+.LBB2977:
+.LBB2970:
+# /usr/lib/gcc/x86_64-linux-gnu/12/include/smmintrin.h:168:   return (__m128i) __builtin_ia32_pblendw128 ((__v8hi)__X,
+	.loc 3 168 20 view .LVU712
+	pblendw	$48, -56(%rsp), %xmm12	#, %sfp, tmp1451
+.LVL115:
+	.loc 3 168 20 view .LVU713
+.LBE2970:
+.LBE2977:
+	.loc 1 305 13 is_stmt 1 view .LVU714
+	.loc 1 305 55 view .LVU715
+	.loc 1 305 60 view .LVU716
+.LBB2978:
+.LBI2978:
+	.loc 2 1064 1 view .LVU717
+.LBB2979:
+	.loc 2 1066 3 view .LVU718
+	.loc 2 1066 3 is_stmt 0 view .LVU719
+.LBE2979:
+.LBE2978:
+.LBB2980:
+.LBI2915:
+	.loc 2 1064 1 is_stmt 1 view .LVU720
+.LBB2918:
+	.loc 2 1066 3 view .LVU721
+	.loc 2 1066 3 is_stmt 0 view .LVU722
+.LBE2918:
+.LBE2980:
+	.loc 1 305 109 is_stmt 1 view .LVU723
+.LBB2981:
+.LBI2939:
+	.loc 2 1327 1 view .LVU724
+.LBB2941:
+	.loc 2 1329 3 view .LVU725
+	.loc 2 1329 3 is_stmt 0 view .LVU726
+.LBE2941:
+.LBE2981:
+.LBB2982:
+.LBI2942:
+	.loc 4 136 1 is_stmt 1 view .LVU727
+.LBB2944:
+	.loc 4 138 3 view .LVU728
+	.loc 4 138 3 is_stmt 0 view .LVU729
+.LBE2944:
+.LBE2982:
+	.loc 1 305 163 is_stmt 1 view .LVU730
+.LBB2983:
+.LBI2953:
+	.loc 2 1064 1 view .LVU731
+.LBB2955:
+	.loc 2 1066 3 view .LVU732
+	.loc 2 1066 3 is_stmt 0 view .LVU733
+.LBE2955:
+.LBE2983:
+	.loc 1 305 193 is_stmt 1 view .LVU734
+.LBB2984:
+.LBI2962:
+	.loc 2 1327 1 view .LVU735
+.LBB2964:
+	.loc 2 1329 3 view .LVU736
+	.loc 2 1329 3 is_stmt 0 view .LVU737
+.LBE2964:
+.LBE2984:
+.LBB2985:
+.LBI2971:
+	.loc 2 1184 1 is_stmt 1 view .LVU738
+.LBB2973:
+	.loc 2 1186 3 view .LVU739
+# /usr/lib/gcc/x86_64-linux-gnu/12/include/emmintrin.h:1186:   return (__m128i)__builtin_ia32_pslldi128 ((__v4si)__A, __B);
+	.loc 2 1186 19 is_stmt 0 view .LVU740
+	pslld	$20, %xmm8	#, tmp1459
+.LVL116:
+	.loc 2 1186 19 view .LVU741
+.LBE2973:
+.LBE2985:
+.LBB2986:
+.LBI2974:
+	.loc 2 1249 1 is_stmt 1 view .LVU742
+.LBB2976:
+	.loc 2 1251 3 view .LVU743
+	.loc 2 1251 3 is_stmt 0 view .LVU744
+.LBE2976:
+.LBE2986:
+.LBB2987:
+.LBI2987:
+	.loc 2 1321 1 is_stmt 1 view .LVU745
+.LBB2988:
+	.loc 2 1323 3 view .LVU746
+# /usr/lib/gcc/x86_64-linux-gnu/12/include/emmintrin.h:1323:   return (__m128i) ((__v2du)__A | (__v2du)__B);
+	.loc 2 1323 33 is_stmt 0 view .LVU747
+	por	%xmm8, %xmm0	# tmp1459, _293
+.LVL117:
+	.loc 2 1323 33 view .LVU748
+.LBE2988:
+.LBE2987:
+	.loc 1 305 300 is_stmt 1 view .LVU749
+.LBB2989:
+.LBI2989:
+	.loc 2 1064 1 view .LVU750
+.LBB2990:
+	.loc 2 1066 3 view .LVU751
+	.loc 2 1066 3 is_stmt 0 view .LVU752
+.LBE2990:
+.LBE2989:
+.LBB2991:
+.LBI2991:
+	.loc 2 1064 1 is_stmt 1 view .LVU753
+.LBB2992:
+	.loc 2 1066 3 view .LVU754
+# /usr/lib/gcc/x86_64-linux-gnu/12/include/emmintrin.h:1066:   return (__m128i) ((__v4su)__A + (__v4su)__B);
+	.loc 2 1066 33 is_stmt 0 view .LVU755
+	paddd	%xmm0, %xmm7	# _293, tmp1463
+.LVL118:
+	.loc 2 1066 33 view .LVU756
+	paddd	%xmm15, %xmm7	# _276, _297
+.LVL119:
+	.loc 2 1066 33 view .LVU757
+.LBE2992:
+.LBE2991:
+	.loc 1 305 349 is_stmt 1 view .LVU758
+.LBB2993:
+.LBI2993:
+	.loc 2 1327 1 view .LVU759
+.LBB2994:
+	.loc 2 1329 3 view .LVU760
+	.loc 2 1329 3 is_stmt 0 view .LVU761
+.LBE2994:
+.LBE2993:
+.LBB2996:
+.LBI2996:
+	.loc 4 136 1 is_stmt 1 view .LVU762
+.LBB2997:
+	.loc 4 138 3 view .LVU763
+.LBE2997:
+.LBE2996:
+.LBB2999:
+.LBB2995:
+# /usr/lib/gcc/x86_64-linux-gnu/12/include/emmintrin.h:1329:   return (__m128i) ((__v2du)__A ^ (__v2du)__B);
+	.loc 2 1329 33 is_stmt 0 view .LVU764
+	pxor	%xmm7, %xmm1	# _297, tmp1464
+.LVL120:
+	.loc 2 1329 33 view .LVU765
+.LBE2995:
+.LBE2999:
+.LBB3000:
+.LBB2998:
+# /usr/lib/gcc/x86_64-linux-gnu/12/include/tmmintrin.h:138:   return (__m128i) __builtin_ia32_pshufb128 ((__v16qi)__X, (__v16qi)__Y);
+	.loc 4 138 20 view .LVU766
+	pshufb	.LC2(%rip), %xmm1	#, tmp1465
+.LVL121:
+	.loc 4 138 20 view .LVU767
+.LBE2998:
+.LBE3000:
+	.loc 1 305 402 is_stmt 1 view .LVU768
+.LBB3001:
+.LBI3001:
+	.loc 2 1064 1 view .LVU769
+.LBB3002:
+	.loc 2 1066 3 view .LVU770
+# /usr/lib/gcc/x86_64-linux-gnu/12/include/emmintrin.h:1066:   return (__m128i) ((__v4su)__A + (__v4su)__B);
+	.loc 2 1066 33 is_stmt 0 view .LVU771
+	paddd	%xmm1, %xmm2	# tmp1465, _304
+.LVL122:
+	.loc 2 1066 33 view .LVU772
+.LBE3002:
+.LBE3001:
+	.loc 1 305 432 is_stmt 1 view .LVU773
+.LBB3003:
+.LBI3003:
+	.loc 2 1327 1 view .LVU774
+.LBB3004:
+	.loc 2 1329 3 view .LVU775
+	.loc 2 1329 3 is_stmt 0 view .LVU776
+.LBE3004:
+.LBE3003:
+.LBB3006:
+.LBI3006:
+	.loc 2 1184 1 is_stmt 1 view .LVU777
+.LBB3007:
+	.loc 2 1186 3 view .LVU778
+.LBE3007:
+.LBE3006:
+.LBB3010:
+.LBB3011:
+# /usr/lib/gcc/x86_64-linux-gnu/12/include/emmintrin.h:1458:   return (__m128i)__builtin_ia32_pshufd ((__v4si)__A, __mask);
+	.loc 2 1458 19 is_stmt 0 view .LVU779
+	pshufd	$147, %xmm1, %xmm1	#, tmp1465, tmp1477
+.LVL123:
+	.loc 2 1458 19 view .LVU780
+.LBE3011:
+.LBE3010:
+.LBB3013:
+.LBB3005:
+# /usr/lib/gcc/x86_64-linux-gnu/12/include/emmintrin.h:1329:   return (__m128i) ((__v2du)__A ^ (__v2du)__B);
+	.loc 2 1329 33 view .LVU781
+	pxor	%xmm2, %xmm0	# _304, tmp1467
+.LVL124:
+	.loc 2 1329 33 view .LVU782
+.LBE3005:
+.LBE3013:
+.LBB3014:
+.LBB3015:
+# /usr/lib/gcc/x86_64-linux-gnu/12/include/emmintrin.h:1458:   return (__m128i)__builtin_ia32_pshufd ((__v4si)__A, __mask);
+	.loc 2 1458 19 view .LVU783
+	pshufd	$78, %xmm2, %xmm2	#, _304, tmp1475
+.LVL125:
+	.loc 2 1458 19 view .LVU784
+.LBE3015:
+.LBE3014:
+.LBB3017:
+.LBB3008:
+# /usr/lib/gcc/x86_64-linux-gnu/12/include/emmintrin.h:1186:   return (__m128i)__builtin_ia32_pslldi128 ((__v4si)__A, __B);
+	.loc 2 1186 19 view .LVU785
+	movdqa	%xmm0, %xmm15	# tmp1467, tmp1468
+.LBE3008:
+.LBE3017:
+.LBB3018:
+.LBB3019:
+# /usr/lib/gcc/x86_64-linux-gnu/12/include/emmintrin.h:1251:   return (__m128i)__builtin_ia32_psrldi128 ((__v4si)__A, __B);
+	.loc 2 1251 19 view .LVU786
+	psrld	$7, %xmm0	#, tmp1470
+.LVL126:
+	.loc 2 1251 19 view .LVU787
+.LBE3019:
+.LBE3018:
+.LBB3021:
+.LBB3009:
+# /usr/lib/gcc/x86_64-linux-gnu/12/include/emmintrin.h:1186:   return (__m128i)__builtin_ia32_pslldi128 ((__v4si)__A, __B);
+	.loc 2 1186 19 view .LVU788
+	pslld	$25, %xmm15	#, tmp1468
+.LVL127:
+	.loc 2 1186 19 view .LVU789
+.LBE3009:
+.LBE3021:
+.LBB3022:
+.LBI3018:
+	.loc 2 1249 1 is_stmt 1 view .LVU790
+.LBB3020:
+	.loc 2 1251 3 view .LVU791
+	.loc 2 1251 3 is_stmt 0 view .LVU792
+.LBE3020:
+.LBE3022:
+.LBB3023:
+.LBI3023:
+	.loc 2 1321 1 is_stmt 1 view .LVU793
+.LBB3024:
+	.loc 2 1323 3 view .LVU794
+	.loc 2 1323 3 is_stmt 0 view .LVU795
+.LBE3024:
+.LBE3023:
+	.loc 1 305 58 is_stmt 1 view .LVU796
+	.loc 1 305 551 view .LVU797
+.LBB3026:
+.LBI3026:
+	.loc 2 1456 1 view .LVU798
+.LBB3027:
+	.loc 2 1458 3 view .LVU799
+.LBE3027:
+.LBE3026:
+.LBB3029:
+.LBB3025:
+# /usr/lib/gcc/x86_64-linux-gnu/12/include/emmintrin.h:1323:   return (__m128i) ((__v2du)__A | (__v2du)__B);
+	.loc 2 1323 33 is_stmt 0 view .LVU800
+	por	%xmm15, %xmm0	# tmp1468, tmp1473
+.LVL128:
+	.loc 2 1323 33 view .LVU801
+.LBE3025:
+.LBE3029:
+.LBB3030:
+.LBB3031:
+# /usr/lib/gcc/x86_64-linux-gnu/12/include/emmintrin.h:1458:   return (__m128i)__builtin_ia32_pshufd ((__v4si)__A, __mask);
+	.loc 2 1458 19 view .LVU802
+	pshufd	$231, %xmm4, %xmm15	#, m1, tmp1504
+.LBE3031:
+.LBE3030:
+.LBB3033:
+.LBB3028:
+	pshufd	$57, %xmm0, %xmm0	#, tmp1473, tmp1472
+.LVL129:
+	.loc 2 1458 19 view .LVU803
+.LBE3028:
+.LBE3033:
+	.loc 1 305 7 is_stmt 1 view .LVU804
+.LBB3034:
+.LBI3014:
+	.loc 2 1456 1 view .LVU805
+.LBB3016:
+	.loc 2 1458 3 view .LVU806
+	.loc 2 1458 3 is_stmt 0 view .LVU807
+.LBE3016:
+.LBE3034:
+	.loc 1 305 7 is_stmt 1 view .LVU808
+.LBB3035:
+.LBI3010:
+	.loc 2 1456 1 view .LVU809
+.LBB3012:
+	.loc 2 1458 3 view .LVU810
+	.loc 2 1458 3 is_stmt 0 view .LVU811
+.LBE3012:
+.LBE3035:
+	.loc 1 305 7 is_stmt 1 view .LVU812
+	.loc 1 305 12 view .LVU813
+.LBB3036:
+.LBI3036:
+	.loc 2 1064 1 view .LVU814
+.LBB3037:
+	.loc 2 1066 3 view .LVU815
+	.loc 2 1066 3 is_stmt 0 view .LVU816
+.LBE3037:
+.LBE3036:
+.LBB3038:
+.LBI3038:
+	.loc 2 1064 1 is_stmt 1 view .LVU817
+.LBB3039:
+	.loc 2 1066 3 view .LVU818
+# /usr/lib/gcc/x86_64-linux-gnu/12/include/emmintrin.h:1066:   return (__m128i) ((__v4su)__A + (__v4su)__B);
+	.loc 2 1066 33 is_stmt 0 view .LVU819
+	paddd	%xmm0, %xmm13	# tmp1472, tmp1479
+.LVL130:
+	.loc 2 1066 33 view .LVU820
+	paddd	%xmm7, %xmm13	# _297, _322
+.LVL131:
+	.loc 2 1066 33 view .LVU821
+.LBE3039:
+.LBE3038:
+	.loc 1 305 61 is_stmt 1 view .LVU822
+.LBB3040:
+.LBI3040:
+	.loc 2 1327 1 view .LVU823
+.LBB3041:
+	.loc 2 1329 3 view .LVU824
+	.loc 2 1329 3 is_stmt 0 view .LVU825
+.LBE3041:
+.LBE3040:
+.LBB3043:
+.LBI3043:
+	.loc 4 136 1 is_stmt 1 view .LVU826
+.LBB3044:
+	.loc 4 138 3 view .LVU827
+.LBE3044:
+.LBE3043:
+.LBB3046:
+.LBB3042:
+# /usr/lib/gcc/x86_64-linux-gnu/12/include/emmintrin.h:1329:   return (__m128i) ((__v2du)__A ^ (__v2du)__B);
+	.loc 2 1329 33 is_stmt 0 view .LVU828
+	pxor	%xmm13, %xmm1	# _322, tmp1480
+.LVL132:
+	.loc 2 1329 33 view .LVU829
+.LBE3042:
+.LBE3046:
+.LBB3047:
+.LBB3045:
+# /usr/lib/gcc/x86_64-linux-gnu/12/include/tmmintrin.h:138:   return (__m128i) __builtin_ia32_pshufb128 ((__v16qi)__X, (__v16qi)__Y);
+	.loc 4 138 20 view .LVU830
+	pshufb	.LC0(%rip), %xmm1	#, tmp1481
+.LVL133:
+	.loc 4 138 20 view .LVU831
+.LBE3045:
+.LBE3047:
+	.loc 1 305 115 is_stmt 1 view .LVU832
+.LBB3048:
+.LBI3048:
+	.loc 2 1064 1 view .LVU833
+.LBB3049:
+	.loc 2 1066 3 view .LVU834
+# /usr/lib/gcc/x86_64-linux-gnu/12/include/emmintrin.h:1066:   return (__m128i) ((__v4su)__A + (__v4su)__B);
+	.loc 2 1066 33 is_stmt 0 view .LVU835
+	paddd	%xmm1, %xmm2	# tmp1481, _330
+.LVL134:
+	.loc 2 1066 33 view .LVU836
+.LBE3049:
+.LBE3048:
+	.loc 1 305 145 is_stmt 1 view .LVU837
+.LBB3050:
+.LBI3050:
+	.loc 2 1327 1 view .LVU838
+.LBB3051:
+	.loc 2 1329 3 view .LVU839
+	.loc 2 1329 3 is_stmt 0 view .LVU840
+.LBE3051:
+.LBE3050:
+.LBB3053:
+.LBI3053:
+	.loc 2 1184 1 is_stmt 1 view .LVU841
+.LBB3054:
+	.loc 2 1186 3 view .LVU842
+.LBE3054:
+.LBE3053:
+.LBB3057:
+.LBB3052:
+# /usr/lib/gcc/x86_64-linux-gnu/12/include/emmintrin.h:1329:   return (__m128i) ((__v2du)__A ^ (__v2du)__B);
+	.loc 2 1329 33 is_stmt 0 view .LVU843
+	pxor	%xmm2, %xmm0	# _330, tmp1483
+.LVL135:
+	.loc 2 1329 33 view .LVU844
+.LBE3052:
+.LBE3057:
+.LBB3058:
+.LBB3055:
+# /usr/lib/gcc/x86_64-linux-gnu/12/include/emmintrin.h:1186:   return (__m128i)__builtin_ia32_pslldi128 ((__v4si)__A, __B);
+	.loc 2 1186 19 view .LVU845
+	movdqa	%xmm0, %xmm7	# tmp1483, tmp1484
+.LBE3055:
+.LBE3058:
+.LBB3059:
+.LBB3060:
+# /usr/lib/gcc/x86_64-linux-gnu/12/include/emmintrin.h:1251:   return (__m128i)__builtin_ia32_psrldi128 ((__v4si)__A, __B);
+	.loc 2 1251 19 view .LVU846
+	psrld	$12, %xmm0	#, tmp1486
+.LVL136:
+	.loc 2 1251 19 view .LVU847
+.LBE3060:
+.LBE3059:
+.LBB3062:
+.LBB3056:
+# /usr/lib/gcc/x86_64-linux-gnu/12/include/emmintrin.h:1186:   return (__m128i)__builtin_ia32_pslldi128 ((__v4si)__A, __B);
+	.loc 2 1186 19 view .LVU848
+	pslld	$20, %xmm7	#, tmp1484
+.LVL137:
+	.loc 2 1186 19 view .LVU849
+.LBE3056:
+.LBE3062:
+.LBB3063:
+.LBI3059:
+	.loc 2 1249 1 is_stmt 1 view .LVU850
+.LBB3061:
+	.loc 2 1251 3 view .LVU851
+	.loc 2 1251 3 is_stmt 0 view .LVU852
+.LBE3061:
+.LBE3063:
+.LBB3064:
+.LBI3064:
+	.loc 2 1321 1 is_stmt 1 view .LVU853
+.LBB3065:
+	.loc 2 1323 3 view .LVU854
+# /usr/lib/gcc/x86_64-linux-gnu/12/include/emmintrin.h:1323:   return (__m128i) ((__v2du)__A | (__v2du)__B);
+	.loc 2 1323 33 is_stmt 0 view .LVU855
+	por	%xmm7, %xmm0	# tmp1484, _339
+.LVL138:
+	.loc 2 1323 33 view .LVU856
+.LBE3065:
+.LBE3064:
+	.loc 1 305 252 is_stmt 1 view .LVU857
+.LBB3066:
+.LBI3066:
+	.loc 2 1064 1 view .LVU858
+.LBB3067:
+	.loc 2 1066 3 view .LVU859
+	.loc 2 1066 3 is_stmt 0 view .LVU860
+.LBE3067:
+.LBE3066:
+.LBB3068:
+.LBI3068:
+	.loc 2 1064 1 is_stmt 1 view .LVU861
+.LBB3069:
+	.loc 2 1066 3 view .LVU862
+# /usr/lib/gcc/x86_64-linux-gnu/12/include/emmintrin.h:1066:   return (__m128i) ((__v4su)__A + (__v4su)__B);
+	.loc 2 1066 33 is_stmt 0 view .LVU863
+	paddd	%xmm0, %xmm12	# _339, tmp1488
+.LVL139:
+	.loc 2 1066 33 view .LVU864
+	paddd	%xmm13, %xmm12	# _322, _343
+.LVL140:
+	.loc 2 1066 33 view .LVU865
+.LBE3069:
+.LBE3068:
+	.loc 1 305 301 is_stmt 1 view .LVU866
+.LBB3070:
+.LBI3070:
+	.loc 2 1327 1 view .LVU867
+.LBB3071:
+	.loc 2 1329 3 view .LVU868
+	.loc 2 1329 3 is_stmt 0 view .LVU869
+.LBE3071:
+.LBE3070:
+.LBB3073:
+.LBI3073:
+	.loc 4 136 1 is_stmt 1 view .LVU870
+.LBB3074:
+	.loc 4 138 3 view .LVU871
+.LBE3074:
+.LBE3073:
+.LBB3076:
+.LBB3072:
+# /usr/lib/gcc/x86_64-linux-gnu/12/include/emmintrin.h:1329:   return (__m128i) ((__v2du)__A ^ (__v2du)__B);
+	.loc 2 1329 33 is_stmt 0 view .LVU872
+	pxor	%xmm12, %xmm1	# _343, tmp1489
+.LVL141:
+	.loc 2 1329 33 view .LVU873
+.LBE3072:
+.LBE3076:
+.LBB3077:
+.LBB3075:
+# /usr/lib/gcc/x86_64-linux-gnu/12/include/tmmintrin.h:138:   return (__m128i) __builtin_ia32_pshufb128 ((__v16qi)__X, (__v16qi)__Y);
+	.loc 4 138 20 view .LVU874
+	pshufb	.LC2(%rip), %xmm1	#, tmp1490
+.LVL142:
+	.loc 4 138 20 view .LVU875
+.LBE3075:
+.LBE3077:
+	.loc 1 305 354 is_stmt 1 view .LVU876
+.LBB3078:
+.LBI3078:
+	.loc 2 1064 1 view .LVU877
+.LBB3079:
+	.loc 2 1066 3 view .LVU878
+# /usr/lib/gcc/x86_64-linux-gnu/12/include/emmintrin.h:1066:   return (__m128i) ((__v4su)__A + (__v4su)__B);
+	.loc 2 1066 33 is_stmt 0 view .LVU879
+	paddd	%xmm1, %xmm2	# tmp1490, _350
+.LVL143:
+	.loc 2 1066 33 view .LVU880
+.LBE3079:
+.LBE3078:
+	.loc 1 305 384 is_stmt 1 view .LVU881
+.LBB3080:
+.LBI3080:
+	.loc 2 1327 1 view .LVU882
+.LBB3081:
+	.loc 2 1329 3 view .LVU883
+	.loc 2 1329 3 is_stmt 0 view .LVU884
+.LBE3081:
+.LBE3080:
+.LBB3083:
+.LBI3083:
+	.loc 2 1184 1 is_stmt 1 view .LVU885
+.LBB3084:
+	.loc 2 1186 3 view .LVU886
+.LBE3084:
+.LBE3083:
+.LBB3087:
+.LBB3088:
+# /usr/lib/gcc/x86_64-linux-gnu/12/include/emmintrin.h:1458:   return (__m128i)__builtin_ia32_pshufd ((__v4si)__A, __mask);
+	.loc 2 1458 19 is_stmt 0 view .LVU887
+	pshufd	$57, %xmm1, %xmm1	#, tmp1490, tmp1502
+.LVL144:
+	.loc 2 1458 19 view .LVU888
+.LBE3088:
+.LBE3087:
+.LBB3090:
+.LBB3082:
+# /usr/lib/gcc/x86_64-linux-gnu/12/include/emmintrin.h:1329:   return (__m128i) ((__v2du)__A ^ (__v2du)__B);
+	.loc 2 1329 33 view .LVU889
+	pxor	%xmm2, %xmm0	# _350, tmp1492
+.LVL145:
+	.loc 2 1329 33 view .LVU890
+.LBE3082:
+.LBE3090:
+.LBB3091:
+.LBB3092:
+# /usr/lib/gcc/x86_64-linux-gnu/12/include/emmintrin.h:1458:   return (__m128i)__builtin_ia32_pshufd ((__v4si)__A, __mask);
+	.loc 2 1458 19 view .LVU891
+	pshufd	$78, %xmm2, %xmm2	#, _350, tmp1500
+.LVL146:
+	.loc 2 1458 19 view .LVU892
+.LBE3092:
+.LBE3091:
+.LBB3094:
+.LBB3085:
+# /usr/lib/gcc/x86_64-linux-gnu/12/include/emmintrin.h:1186:   return (__m128i)__builtin_ia32_pslldi128 ((__v4si)__A, __B);
+	.loc 2 1186 19 view .LVU893
+	movdqa	%xmm0, %xmm13	# tmp1492, tmp1493
+.LBE3085:
+.LBE3094:
+.LBB3095:
+.LBB3096:
+# /usr/lib/gcc/x86_64-linux-gnu/12/include/emmintrin.h:1251:   return (__m128i)__builtin_ia32_psrldi128 ((__v4si)__A, __B);
+	.loc 2 1251 19 view .LVU894
+	psrld	$7, %xmm0	#, tmp1495
+.LVL147:
+	.loc 2 1251 19 view .LVU895
+.LBE3096:
+.LBE3095:
+.LBB3098:
+.LBB3086:
+# /usr/lib/gcc/x86_64-linux-gnu/12/include/emmintrin.h:1186:   return (__m128i)__builtin_ia32_pslldi128 ((__v4si)__A, __B);
+	.loc 2 1186 19 view .LVU896
+	pslld	$25, %xmm13	#, tmp1493
+.LVL148:
+	.loc 2 1186 19 view .LVU897
+.LBE3086:
+.LBE3098:
+.LBB3099:
+.LBI3095:
+	.loc 2 1249 1 is_stmt 1 view .LVU898
+.LBB3097:
+	.loc 2 1251 3 view .LVU899
+	.loc 2 1251 3 is_stmt 0 view .LVU900
+.LBE3097:
+.LBE3099:
+.LBB3100:
+.LBI3100:
+	.loc 2 1321 1 is_stmt 1 view .LVU901
+.LBB3101:
+	.loc 2 1323 3 view .LVU902
+	.loc 2 1323 3 is_stmt 0 view .LVU903
+.LBE3101:
+.LBE3100:
+	.loc 1 305 10 is_stmt 1 view .LVU904
+	.loc 1 305 503 view .LVU905
+.LBB3103:
+.LBI3103:
+	.loc 2 1456 1 view .LVU906
+.LBB3104:
+	.loc 2 1458 3 view .LVU907
+.LBE3104:
+.LBE3103:
+.LBB3106:
+.LBB3102:
+# /usr/lib/gcc/x86_64-linux-gnu/12/include/emmintrin.h:1323:   return (__m128i) ((__v2du)__A | (__v2du)__B);
+	.loc 2 1323 33 is_stmt 0 view .LVU908
+	por	%xmm13, %xmm0	# tmp1493, tmp1498
+.LVL149:
+	.loc 2 1323 33 view .LVU909
+.LBE3102:
+.LBE3106:
+.LBB3107:
+.LBB3108:
+# /usr/lib/gcc/x86_64-linux-gnu/12/include/smmintrin.h:168:   return (__m128i) __builtin_ia32_pblendw128 ((__v8hi)__X,
+	.loc 3 168 20 view .LVU910
+	movdqa	%xmm15, %xmm13	# tmp1504, tmp1506
+	pblendw	$12, -120(%rsp), %xmm13	#, %sfp, tmp1506
+.LBE3108:
+.LBE3107:
+.LBB3110:
+.LBB3105:
+# /usr/lib/gcc/x86_64-linux-gnu/12/include/emmintrin.h:1458:   return (__m128i)__builtin_ia32_pshufd ((__v4si)__A, __mask);
+	.loc 2 1458 19 view .LVU911
+	pshufd	$147, %xmm0, %xmm0	#, tmp1498, tmp1497
+.LVL150:
+	.loc 2 1458 19 view .LVU912
+.LBE3105:
+.LBE3110:
+	.loc 1 305 7 is_stmt 1 view .LVU913
+.LBB3111:
+.LBI3091:
+	.loc 2 1456 1 view .LVU914
+.LBB3093:
+	.loc 2 1458 3 view .LVU915
+	.loc 2 1458 3 is_stmt 0 view .LVU916
+.LBE3093:
+.LBE3111:
+	.loc 1 305 7 is_stmt 1 view .LVU917
+.LBB3112:
+.LBI3087:
+	.loc 2 1456 1 view .LVU918
+.LBB3089:
+	.loc 2 1458 3 view .LVU919
+	.loc 2 1458 3 is_stmt 0 view .LVU920
+.LBE3089:
+.LBE3112:
+	.loc 1 305 8 is_stmt 1 view .LVU921
+	.loc 1 306 5 view .LVU922
+	.loc 1 306 10 view .LVU923
+	.loc 1 306 15 view .LVU924
+.LBB3113:
+.LBI3030:
+	.loc 2 1456 1 view .LVU925
+.LBB3032:
+	.loc 2 1458 3 view .LVU926
+	.loc 2 1458 3 is_stmt 0 view .LVU927
+.LBE3032:
+.LBE3113:
+	.loc 1 306 7 is_stmt 1 view .LVU928
+	.loc 1 306 7 view .LVU929
+.LBB3114:
+.LBI3107:
+	.loc 3 166 1 view .LVU930
+.LBB3109:
+	.loc 3 168 3 view .LVU931
+# /usr/lib/gcc/x86_64-linux-gnu/12/include/smmintrin.h:168:   return (__m128i) __builtin_ia32_pblendw128 ((__v8hi)__X,
+	.loc 3 168 20 is_stmt 0 view .LVU932
+	movdqa	%xmm13, %xmm14	# tmp1506, tmp1506
+.LVL151:
+	.loc 3 168 20 view .LVU933
+.LBE3109:
+.LBE3114:
+	.loc 1 306 42 is_stmt 1 view .LVU934
+	.loc 1 306 7 view .LVU935
+.LBB3115:
+.LBI3115:
+	.loc 3 166 1 view .LVU936
+.LBB3116:
+	.loc 3 168 3 view .LVU937
+# /usr/lib/gcc/x86_64-linux-gnu/12/include/smmintrin.h:168:   return (__m128i) __builtin_ia32_pblendw128 ((__v8hi)__X,
+	.loc 3 168 20 is_stmt 0 view .LVU938
+	pblendw	$48, %xmm11, %xmm14	#, tmp1262, tmp1509
+.LVL152:
+	.loc 3 168 20 view .LVU939
+.LBE3116:
+.LBE3115:
+	.loc 1 306 42 is_stmt 1 view .LVU940
+	.loc 1 306 50 view .LVU941
+.LBB3117:
+.LBI3117:
+	.loc 3 166 1 view .LVU942
+.LBB3118:
+	.loc 3 168 3 view .LVU943
+.LBE3118:
+.LBE3117:
+.LBB3120:
+.LBB3121:
+# /usr/lib/gcc/x86_64-linux-gnu/12/include/emmintrin.h:1458:   return (__m128i)__builtin_ia32_pshufd ((__v4si)__A, __mask);
+	.loc 2 1458 19 is_stmt 0 view .LVU944
+	pshufd	$229, %xmm5, %xmm11	#, m2, tmp1515
+.LBE3121:
+.LBE3120:
+.LBB3123:
+.LBB3119:
+# /usr/lib/gcc/x86_64-linux-gnu/12/include/smmintrin.h:168:   return (__m128i) __builtin_ia32_pblendw128 ((__v8hi)__X,
+	.loc 3 168 20 view .LVU945
+	pblendw	$192, %xmm5, %xmm14	#, m2, tmp1512
+.LVL153:
+	.loc 3 168 20 view .LVU946
+.LBE3119:
+.LBE3123:
+	.loc 1 306 85 is_stmt 1 view .LVU947
+.LBB3124:
+.LBI3120:
+	.loc 2 1456 1 view .LVU948
+.LBB3122:
+	.loc 2 1458 3 view .LVU949
+	.loc 2 1458 3 is_stmt 0 view .LVU950
+.LBE3122:
+.LBE3124:
+	.loc 1 306 7 is_stmt 1 view .LVU951
+	.loc 1 306 15 view .LVU952
+.LBB3125:
+.LBI3125:
+	.loc 3 166 1 view .LVU953
+.LBB3126:
+	.loc 3 168 3 view .LVU954
+# /usr/lib/gcc/x86_64-linux-gnu/12/include/smmintrin.h:168:   return (__m128i) __builtin_ia32_pblendw128 ((__v8hi)__X,
+	.loc 3 168 20 is_stmt 0 view .LVU955
+	pblendw	$12, %xmm3, %xmm11	#, m0, tmp1517
+.LVL154:
+	.loc 3 168 20 view .LVU956
+.LBE3126:
+.LBE3125:
+	.loc 1 306 50 is_stmt 1 view .LVU957
+	.loc 1 306 7 view .LVU958
+.LBB3127:
+.LBI3127:
+	.loc 3 166 1 view .LVU959
+.LBB3128:
+	.loc 3 168 3 view .LVU960
+# /usr/lib/gcc/x86_64-linux-gnu/12/include/smmintrin.h:168:   return (__m128i) __builtin_ia32_pblendw128 ((__v8hi)__X,
+	.loc 3 168 20 is_stmt 0 view .LVU961
+	pblendw	$240, %xmm10, %xmm11	#, tmp1255, tmp1520
+.LVL155:
+	.loc 3 168 20 view .LVU962
+.LBE3128:
+.LBE3127:
+	.loc 1 306 42 is_stmt 1 view .LVU963
+.LBB3129:
+.LBI3129:
+	.loc 3 166 1 view .LVU964
+.LBB3130:
+	.loc 3 168 3 view .LVU965
+.LBE3130:
+.LBE3129:
+.LBB3134:
+.LBB3135:
+# /usr/lib/gcc/x86_64-linux-gnu/12/include/emmintrin.h:1066:   return (__m128i) ((__v4su)__A + (__v4su)__B);
+	.loc 2 1066 33 is_stmt 0 view .LVU966
+	paddd	%xmm0, %xmm14	# tmp1497, tmp1543
+.LVL156:
+	.loc 2 1066 33 view .LVU967
+.LBE3135:
+.LBE3134:
+.LBB3138:
+.LBB3131:
+# /usr/lib/gcc/x86_64-linux-gnu/12/include/smmintrin.h:168:   return (__m128i) __builtin_ia32_pblendw128 ((__v8hi)__X,
+	.loc 3 168 20 view .LVU968
+	movdqa	%xmm3, %xmm10	# m0, tmp1523
+.LVL157:
+	.loc 3 168 20 view .LVU969
+.LBE3131:
+.LBE3138:
+.LBB3139:
+.LBB3136:
+# /usr/lib/gcc/x86_64-linux-gnu/12/include/emmintrin.h:1066:   return (__m128i) ((__v4su)__A + (__v4su)__B);
+	.loc 2 1066 33 view .LVU970
+	paddd	%xmm12, %xmm14	# _343, _391
+.LBE3136:
+.LBE3139:
+.LBB3140:
+.LBB3132:
+# /usr/lib/gcc/x86_64-linux-gnu/12/include/smmintrin.h:168:   return (__m128i) __builtin_ia32_pblendw128 ((__v8hi)__X,
+	.loc 3 168 20 view .LVU971
+	pblendw	$15, %xmm4, %xmm10	#, m1, tmp1523
+.LBE3132:
+.LBE3140:
+.LBB3141:
+.LBB3142:
+# /usr/lib/gcc/x86_64-linux-gnu/12/include/emmintrin.h:1458:   return (__m128i)__builtin_ia32_pshufd ((__v4si)__A, __mask);
+	.loc 2 1458 19 view .LVU972
+	pshufd	$165, %xmm5, %xmm12	#, m2, tmp1593
+.LVL158:
+	.loc 2 1458 19 view .LVU973
+.LBE3142:
+.LBE3141:
+.LBB3144:
+.LBB3133:
+# /usr/lib/gcc/x86_64-linux-gnu/12/include/smmintrin.h:168:   return (__m128i) __builtin_ia32_pblendw128 ((__v8hi)__X,
+	.loc 3 168 20 view .LVU974
+	movdqa	%xmm10, %xmm8	# tmp1523, tmp1523
+.LVL159:
+	.loc 3 168 20 view .LVU975
+.LBE3133:
+.LBE3144:
+	.loc 1 306 78 is_stmt 1 view .LVU976
+.LBB3145:
+.LBI3145:
+	.loc 3 166 1 view .LVU977
+.LBB3146:
+	.loc 3 168 3 view .LVU978
+.LBE3146:
+.LBE3145:
+.LBB3148:
+.LBB3149:
+# /usr/lib/gcc/x86_64-linux-gnu/12/include/emmintrin.h:1329:   return (__m128i) ((__v2du)__A ^ (__v2du)__B);
+	.loc 2 1329 33 is_stmt 0 view .LVU979
+	pxor	%xmm14, %xmm1	# _391, tmp1544
+.LVL160:
+	.loc 2 1329 33 view .LVU980
+.LBE3149:
+.LBE3148:
+.LBB3151:
+.LBB3152:
+# /usr/lib/gcc/x86_64-linux-gnu/12/include/emmintrin.h:1458:   return (__m128i)__builtin_ia32_pshufd ((__v4si)__A, __mask);
+	.loc 2 1458 19 view .LVU981
+	pshufd	$230, %xmm4, %xmm10	#, m1, tmp1531
+	movdqa	%xmm10, %xmm13	# tmp1531, tmp1531
+.LBE3152:
+.LBE3151:
+.LBB3154:
+.LBB3155:
+	pshufd	$40, %xmm5, %xmm10	#, m2, tmp1533
+.LBE3155:
+.LBE3154:
+.LBB3157:
+.LBB3158:
+# /usr/lib/gcc/x86_64-linux-gnu/12/include/tmmintrin.h:138:   return (__m128i) __builtin_ia32_pshufb128 ((__v16qi)__X, (__v16qi)__Y);
+	.loc 4 138 20 view .LVU982
+	pshufb	.LC0(%rip), %xmm1	#, tmp1545
+.LBE3158:
+.LBE3157:
+.LBB3160:
+.LBB3161:
+# /usr/lib/gcc/x86_64-linux-gnu/12/include/emmintrin.h:1066:   return (__m128i) ((__v4su)__A + (__v4su)__B);
+	.loc 2 1066 33 view .LVU983
+	paddd	%xmm1, %xmm2	# tmp1545, _399
+.LVL161:
+	.loc 2 1066 33 view .LVU984
+.LBE3161:
+.LBE3160:
+.LBB3163:
+.LBB3164:
+# /usr/lib/gcc/x86_64-linux-gnu/12/include/smmintrin.h:168:   return (__m128i) __builtin_ia32_pblendw128 ((__v8hi)__X,
+	.loc 3 168 20 view .LVU985
+	movdqa	%xmm13, %xmm7	# tmp1531, tmp1535
+.LBE3164:
+.LBE3163:
+.LBB3168:
+.LBB3147:
+	pblendw	$192, %xmm6, %xmm8	#, m3, tmp1526
+.LVL162:
+	.loc 3 168 20 view .LVU986
+.LBE3147:
+.LBE3168:
+	.loc 1 306 114 is_stmt 1 view .LVU987
+.LBB3169:
+.LBI3169:
+	.loc 2 1456 1 view .LVU988
+.LBB3170:
+	.loc 2 1458 3 view .LVU989
+.LBE3170:
+.LBE3169:
+.LBB3172:
+.LBB3165:
+# /usr/lib/gcc/x86_64-linux-gnu/12/include/smmintrin.h:168:   return (__m128i) __builtin_ia32_pblendw128 ((__v8hi)__X,
+	.loc 3 168 20 is_stmt 0 view .LVU990
+	movaps	%xmm13, 8(%rsp)	# tmp1531, %sfp
+.LBE3165:
+.LBE3172:
+.LBB3173:
+.LBB3174:
+# /usr/lib/gcc/x86_64-linux-gnu/12/include/emmintrin.h:1329:   return (__m128i) ((__v2du)__A ^ (__v2du)__B);
+	.loc 2 1329 33 view .LVU991
+	pxor	%xmm2, %xmm0	# _399, tmp1547
+.LVL163:
+	.loc 2 1329 33 view .LVU992
+.LBE3174:
+.LBE3173:
+.LBB3176:
+.LBB3166:
+# /usr/lib/gcc/x86_64-linux-gnu/12/include/smmintrin.h:168:   return (__m128i) __builtin_ia32_pblendw128 ((__v8hi)__X,
+	.loc 3 168 20 view .LVU993
+	pblendw	$204, %xmm10, %xmm7	#, tmp1533, tmp1535
+.LBE3166:
+.LBE3176:
+.LBB3177:
+.LBB3178:
+# /usr/lib/gcc/x86_64-linux-gnu/12/include/emmintrin.h:1458:   return (__m128i)__builtin_ia32_pshufd ((__v4si)__A, __mask);
+	.loc 2 1458 19 view .LVU994
+	pshufd	$196, %xmm3, %xmm10	#, m0, tmp1538
+.LBE3178:
+.LBE3177:
+.LBB3180:
+.LBB3181:
+# /usr/lib/gcc/x86_64-linux-gnu/12/include/smmintrin.h:168:   return (__m128i) __builtin_ia32_pblendw128 ((__v8hi)__X,
+	.loc 3 168 20 view .LVU995
+	pblendw	$48, %xmm10, %xmm7	#, tmp1538, tmp1540
+.LBE3181:
+.LBE3180:
+.LBB3183:
+.LBB3184:
+# /usr/lib/gcc/x86_64-linux-gnu/12/include/emmintrin.h:1186:   return (__m128i)__builtin_ia32_pslldi128 ((__v4si)__A, __B);
+	.loc 2 1186 19 view .LVU996
+	movdqa	%xmm0, %xmm10	# tmp1547, tmp1548
+.LBE3184:
+.LBE3183:
+.LBB3186:
+.LBB3171:
+# /usr/lib/gcc/x86_64-linux-gnu/12/include/emmintrin.h:1458:   return (__m128i)__builtin_ia32_pshufd ((__v4si)__A, __mask);
+	.loc 2 1458 19 view .LVU997
+	pshufd	$198, %xmm8, %xmm8	#, tmp1526, tmp1529
+.LVL164:
+	.loc 2 1458 19 view .LVU998
+.LBE3171:
+.LBE3186:
+	.loc 1 306 7 is_stmt 1 view .LVU999
+.LBB3187:
+.LBI3151:
+	.loc 2 1456 1 view .LVU1000
+.LBB3153:
+	.loc 2 1458 3 view .LVU1001
+	.loc 2 1458 3 is_stmt 0 view .LVU1002
+.LBE3153:
+.LBE3187:
+	.loc 1 306 7 is_stmt 1 view .LVU1003
+.LBB3188:
+.LBI3154:
+	.loc 2 1456 1 view .LVU1004
+.LBB3156:
+	.loc 2 1458 3 view .LVU1005
+	.loc 2 1458 3 is_stmt 0 view .LVU1006
+.LBE3156:
+.LBE3188:
+	.loc 1 306 7 is_stmt 1 view .LVU1007
+.LBB3189:
+.LBI3163:
+	.loc 3 166 1 view .LVU1008
+.LBB3167:
+	.loc 3 168 3 view .LVU1009
+	.loc 3 168 3 is_stmt 0 view .LVU1010
+.LBE3167:
+.LBE3189:
+	.loc 1 306 42 is_stmt 1 view .LVU1011
+.LBB3190:
+.LBI3177:
+	.loc 2 1456 1 view .LVU1012
+.LBB3179:
+	.loc 2 1458 3 view .LVU1013
+	.loc 2 1458 3 is_stmt 0 view .LVU1014
+.LBE3179:
+.LBE3190:
+	.loc 1 306 7 is_stmt 1 view .LVU1015
+.LBB3191:
+.LBI3180:
+	.loc 3 166 1 view .LVU1016
+.LBB3182:
+	.loc 3 168 3 view .LVU1017
+	.loc 3 168 3 is_stmt 0 view .LVU1018
+.LBE3182:
+.LBE3191:
+	.loc 1 306 13 is_stmt 1 view .LVU1019
+	.loc 1 306 55 view .LVU1020
+	.loc 1 306 60 view .LVU1021
+.LBB3192:
+.LBI3192:
+	.loc 2 1064 1 view .LVU1022
+.LBB3193:
+	.loc 2 1066 3 view .LVU1023
+	.loc 2 1066 3 is_stmt 0 view .LVU1024
+.LBE3193:
+.LBE3192:
+.LBB3194:
+.LBI3134:
+	.loc 2 1064 1 is_stmt 1 view .LVU1025
+.LBB3137:
+	.loc 2 1066 3 view .LVU1026
+	.loc 2 1066 3 is_stmt 0 view .LVU1027
+.LBE3137:
+.LBE3194:
+	.loc 1 306 109 is_stmt 1 view .LVU1028
+.LBB3195:
+.LBI3148:
+	.loc 2 1327 1 view .LVU1029
+.LBB3150:
+	.loc 2 1329 3 view .LVU1030
+	.loc 2 1329 3 is_stmt 0 view .LVU1031
+.LBE3150:
+.LBE3195:
+.LBB3196:
+.LBI3157:
+	.loc 4 136 1 is_stmt 1 view .LVU1032
+.LBB3159:
+	.loc 4 138 3 view .LVU1033
+	.loc 4 138 3 is_stmt 0 view .LVU1034
+.LBE3159:
+.LBE3196:
+	.loc 1 306 163 is_stmt 1 view .LVU1035
+.LBB3197:
+.LBI3160:
+	.loc 2 1064 1 view .LVU1036
+.LBB3162:
+	.loc 2 1066 3 view .LVU1037
+	.loc 2 1066 3 is_stmt 0 view .LVU1038
+.LBE3162:
+.LBE3197:
+	.loc 1 306 193 is_stmt 1 view .LVU1039
+.LBB3198:
+.LBI3173:
+	.loc 2 1327 1 view .LVU1040
+.LBB3175:
+	.loc 2 1329 3 view .LVU1041
+	.loc 2 1329 3 is_stmt 0 view .LVU1042
+.LBE3175:
+.LBE3198:
+.LBB3199:
+.LBI3183:
+	.loc 2 1184 1 is_stmt 1 view .LVU1043
+.LBB3185:
+	.loc 2 1186 3 view .LVU1044
+# /usr/lib/gcc/x86_64-linux-gnu/12/include/emmintrin.h:1186:   return (__m128i)__builtin_ia32_pslldi128 ((__v4si)__A, __B);
+	.loc 2 1186 19 is_stmt 0 view .LVU1045
+	pslld	$20, %xmm10	#, tmp1548
+.LVL165:
+	.loc 2 1186 19 view .LVU1046
+.LBE3185:
+.LBE3199:
+.LBB3200:
+.LBI3200:
+	.loc 2 1249 1 is_stmt 1 view .LVU1047
+.LBB3201:
+	.loc 2 1251 3 view .LVU1048
+# /usr/lib/gcc/x86_64-linux-gnu/12/include/emmintrin.h:1251:   return (__m128i)__builtin_ia32_psrldi128 ((__v4si)__A, __B);
+	.loc 2 1251 19 is_stmt 0 view .LVU1049
+	psrld	$12, %xmm0	#, tmp1550
+.LVL166:
+	.loc 2 1251 19 view .LVU1050
+.LBE3201:
+.LBE3200:
+.LBB3202:
+.LBI3202:
+	.loc 2 1321 1 is_stmt 1 view .LVU1051
+.LBB3203:
+	.loc 2 1323 3 view .LVU1052
+.LBE3203:
+.LBE3202:
+.LBB3205:
+.LBB3206:
+# /usr/lib/gcc/x86_64-linux-gnu/12/include/smmintrin.h:168:   return (__m128i) __builtin_ia32_pblendw128 ((__v8hi)__X,
+	.loc 3 168 20 is_stmt 0 view .LVU1053
+	pblendw	$12, %xmm4, %xmm12	#, m1, tmp1595
+.LBE3206:
+.LBE3205:
+.LBB3208:
+.LBB3204:
+# /usr/lib/gcc/x86_64-linux-gnu/12/include/emmintrin.h:1323:   return (__m128i) ((__v2du)__A | (__v2du)__B);
+	.loc 2 1323 33 view .LVU1054
+	por	%xmm10, %xmm0	# tmp1548, _408
+.LVL167:
+	.loc 2 1323 33 view .LVU1055
+.LBE3204:
+.LBE3208:
+	.loc 1 306 300 is_stmt 1 view .LVU1056
+.LBB3209:
+.LBI3209:
+	.loc 2 1064 1 view .LVU1057
+.LBB3210:
+	.loc 2 1066 3 view .LVU1058
+	.loc 2 1066 3 is_stmt 0 view .LVU1059
+.LBE3210:
+.LBE3209:
+.LBB3211:
+.LBI3211:
+	.loc 2 1064 1 is_stmt 1 view .LVU1060
+.LBB3212:
+	.loc 2 1066 3 view .LVU1061
+.LBE3212:
+.LBE3211:
+.LBB3214:
+.LBB3215:
+# /usr/lib/gcc/x86_64-linux-gnu/12/include/smmintrin.h:168:   return (__m128i) __builtin_ia32_pblendw128 ((__v8hi)__X,
+	.loc 3 168 20 is_stmt 0 view .LVU1062
+	pblendw	$48, %xmm3, %xmm12	#, m0, tmp1598
+.LBE3215:
+.LBE3214:
+.LBB3217:
+.LBB3213:
+# /usr/lib/gcc/x86_64-linux-gnu/12/include/emmintrin.h:1066:   return (__m128i) ((__v4su)__A + (__v4su)__B);
+	.loc 2 1066 33 view .LVU1063
+	paddd	%xmm0, %xmm11	# _408, tmp1552
+.LVL168:
+	.loc 2 1066 33 view .LVU1064
+	paddd	%xmm14, %xmm11	# _391, _412
+.LVL169:
+	.loc 2 1066 33 view .LVU1065
+.LBE3213:
+.LBE3217:
+	.loc 1 306 349 is_stmt 1 view .LVU1066
+.LBB3218:
+.LBI3218:
+	.loc 2 1327 1 view .LVU1067
+.LBB3219:
+	.loc 2 1329 3 view .LVU1068
+	.loc 2 1329 3 is_stmt 0 view .LVU1069
+.LBE3219:
+.LBE3218:
+.LBB3221:
+.LBI3221:
+	.loc 4 136 1 is_stmt 1 view .LVU1070
+.LBB3222:
+	.loc 4 138 3 view .LVU1071
+.LBE3222:
+.LBE3221:
+.LBB3224:
+.LBB3220:
+# /usr/lib/gcc/x86_64-linux-gnu/12/include/emmintrin.h:1329:   return (__m128i) ((__v2du)__A ^ (__v2du)__B);
+	.loc 2 1329 33 is_stmt 0 view .LVU1072
+	pxor	%xmm11, %xmm1	# _412, tmp1553
+.LVL170:
+	.loc 2 1329 33 view .LVU1073
+.LBE3220:
+.LBE3224:
+.LBB3225:
+.LBB3223:
+# /usr/lib/gcc/x86_64-linux-gnu/12/include/tmmintrin.h:138:   return (__m128i) __builtin_ia32_pshufb128 ((__v16qi)__X, (__v16qi)__Y);
+	.loc 4 138 20 view .LVU1074
+	pshufb	.LC2(%rip), %xmm1	#, tmp1554
+.LVL171:
+	.loc 4 138 20 view .LVU1075
+.LBE3223:
+.LBE3225:
+	.loc 1 306 402 is_stmt 1 view .LVU1076
+.LBB3226:
+.LBI3226:
+	.loc 2 1064 1 view .LVU1077
+.LBB3227:
+	.loc 2 1066 3 view .LVU1078
+# /usr/lib/gcc/x86_64-linux-gnu/12/include/emmintrin.h:1066:   return (__m128i) ((__v4su)__A + (__v4su)__B);
+	.loc 2 1066 33 is_stmt 0 view .LVU1079
+	paddd	%xmm1, %xmm2	# tmp1554, _419
+.LVL172:
+	.loc 2 1066 33 view .LVU1080
+.LBE3227:
+.LBE3226:
+	.loc 1 306 432 is_stmt 1 view .LVU1081
+.LBB3228:
+.LBI3228:
+	.loc 2 1327 1 view .LVU1082
+.LBB3229:
+	.loc 2 1329 3 view .LVU1083
+	.loc 2 1329 3 is_stmt 0 view .LVU1084
+.LBE3229:
+.LBE3228:
+.LBB3231:
+.LBI3231:
+	.loc 2 1184 1 is_stmt 1 view .LVU1085
+.LBB3232:
+	.loc 2 1186 3 view .LVU1086
+.LBE3232:
+.LBE3231:
+.LBB3235:
+.LBB3236:
+# /usr/lib/gcc/x86_64-linux-gnu/12/include/emmintrin.h:1458:   return (__m128i)__builtin_ia32_pshufd ((__v4si)__A, __mask);
+	.loc 2 1458 19 is_stmt 0 view .LVU1087
+	pshufd	$147, %xmm1, %xmm1	#, tmp1554, tmp1566
+.LVL173:
+	.loc 2 1458 19 view .LVU1088
+.LBE3236:
+.LBE3235:
+.LBB3238:
+.LBB3230:
+# /usr/lib/gcc/x86_64-linux-gnu/12/include/emmintrin.h:1329:   return (__m128i) ((__v2du)__A ^ (__v2du)__B);
+	.loc 2 1329 33 view .LVU1089
+	pxor	%xmm2, %xmm0	# _419, tmp1556
+.LVL174:
+	.loc 2 1329 33 view .LVU1090
+.LBE3230:
+.LBE3238:
+.LBB3239:
+.LBB3240:
+# /usr/lib/gcc/x86_64-linux-gnu/12/include/emmintrin.h:1458:   return (__m128i)__builtin_ia32_pshufd ((__v4si)__A, __mask);
+	.loc 2 1458 19 view .LVU1091
+	pshufd	$78, %xmm2, %xmm2	#, _419, tmp1564
+.LVL175:
+	.loc 2 1458 19 view .LVU1092
+.LBE3240:
+.LBE3239:
+.LBB3242:
+.LBB3233:
+# /usr/lib/gcc/x86_64-linux-gnu/12/include/emmintrin.h:1186:   return (__m128i)__builtin_ia32_pslldi128 ((__v4si)__A, __B);
+	.loc 2 1186 19 view .LVU1093
+	movdqa	%xmm0, %xmm10	# tmp1556, tmp1557
+.LBE3233:
+.LBE3242:
+.LBB3243:
+.LBB3244:
+# /usr/lib/gcc/x86_64-linux-gnu/12/include/emmintrin.h:1251:   return (__m128i)__builtin_ia32_psrldi128 ((__v4si)__A, __B);
+	.loc 2 1251 19 view .LVU1094
+	psrld	$7, %xmm0	#, tmp1559
+.LVL176:
+	.loc 2 1251 19 view .LVU1095
+.LBE3244:
+.LBE3243:
+.LBB3246:
+.LBB3234:
+# /usr/lib/gcc/x86_64-linux-gnu/12/include/emmintrin.h:1186:   return (__m128i)__builtin_ia32_pslldi128 ((__v4si)__A, __B);
+	.loc 2 1186 19 view .LVU1096
+	pslld	$25, %xmm10	#, tmp1557
+.LVL177:
+	.loc 2 1186 19 view .LVU1097
+.LBE3234:
+.LBE3246:
+.LBB3247:
+.LBI3243:
+	.loc 2 1249 1 is_stmt 1 view .LVU1098
+.LBB3245:
+	.loc 2 1251 3 view .LVU1099
+	.loc 2 1251 3 is_stmt 0 view .LVU1100
+.LBE3245:
+.LBE3247:
+.LBB3248:
+.LBI3248:
+	.loc 2 1321 1 is_stmt 1 view .LVU1101
+.LBB3249:
+	.loc 2 1323 3 view .LVU1102
+	.loc 2 1323 3 is_stmt 0 view .LVU1103
+.LBE3249:
+.LBE3248:
+	.loc 1 306 58 is_stmt 1 view .LVU1104
+	.loc 1 306 551 view .LVU1105
+.LBB3251:
+.LBI3251:
+	.loc 2 1456 1 view .LVU1106
+.LBB3252:
+	.loc 2 1458 3 view .LVU1107
+.LBE3252:
+.LBE3251:
+.LBB3254:
+.LBB3250:
+# /usr/lib/gcc/x86_64-linux-gnu/12/include/emmintrin.h:1323:   return (__m128i) ((__v2du)__A | (__v2du)__B);
+	.loc 2 1323 33 is_stmt 0 view .LVU1108
+	por	%xmm10, %xmm0	# tmp1557, tmp1562
+.LVL178:
+	.loc 2 1323 33 view .LVU1109
+.LBE3250:
+.LBE3254:
+.LBB3255:
+.LBB3253:
+# /usr/lib/gcc/x86_64-linux-gnu/12/include/emmintrin.h:1458:   return (__m128i)__builtin_ia32_pshufd ((__v4si)__A, __mask);
+	.loc 2 1458 19 view .LVU1110
+	pshufd	$57, %xmm0, %xmm0	#, tmp1562, tmp1561
+.LVL179:
+	.loc 2 1458 19 view .LVU1111
+.LBE3253:
+.LBE3255:
+	.loc 1 306 7 is_stmt 1 view .LVU1112
+.LBB3256:
+.LBI3239:
+	.loc 2 1456 1 view .LVU1113
+.LBB3241:
+	.loc 2 1458 3 view .LVU1114
+	.loc 2 1458 3 is_stmt 0 view .LVU1115
+.LBE3241:
+.LBE3256:
+	.loc 1 306 7 is_stmt 1 view .LVU1116
+.LBB3257:
+.LBI3235:
+	.loc 2 1456 1 view .LVU1117
+.LBB3237:
+	.loc 2 1458 3 view .LVU1118
+	.loc 2 1458 3 is_stmt 0 view .LVU1119
+.LBE3237:
+.LBE3257:
+	.loc 1 306 7 is_stmt 1 view .LVU1120
+	.loc 1 306 12 view .LVU1121
+.LBB3258:
+.LBI3258:
+	.loc 2 1064 1 view .LVU1122
+.LBB3259:
+	.loc 2 1066 3 view .LVU1123
+	.loc 2 1066 3 is_stmt 0 view .LVU1124
+.LBE3259:
+.LBE3258:
+.LBB3260:
+.LBI3260:
+	.loc 2 1064 1 is_stmt 1 view .LVU1125
+.LBB3261:
+	.loc 2 1066 3 view .LVU1126
+# /usr/lib/gcc/x86_64-linux-gnu/12/include/emmintrin.h:1066:   return (__m128i) ((__v4su)__A + (__v4su)__B);
+	.loc 2 1066 33 is_stmt 0 view .LVU1127
+	paddd	%xmm0, %xmm8	# tmp1561, tmp1568
+.LVL180:
+	.loc 2 1066 33 view .LVU1128
+	paddd	%xmm11, %xmm8	# _412, _437
+.LVL181:
+	.loc 2 1066 33 view .LVU1129
+.LBE3261:
+.LBE3260:
+	.loc 1 306 61 is_stmt 1 view .LVU1130
+.LBB3262:
+.LBI3262:
+	.loc 2 1327 1 view .LVU1131
+.LBB3263:
+	.loc 2 1329 3 view .LVU1132
+	.loc 2 1329 3 is_stmt 0 view .LVU1133
+.LBE3263:
+.LBE3262:
+.LBB3265:
+.LBI3265:
+	.loc 4 136 1 is_stmt 1 view .LVU1134
+.LBB3266:
+	.loc 4 138 3 view .LVU1135
+.LBE3266:
+.LBE3265:
+.LBB3268:
+.LBB3264:
+# /usr/lib/gcc/x86_64-linux-gnu/12/include/emmintrin.h:1329:   return (__m128i) ((__v2du)__A ^ (__v2du)__B);
+	.loc 2 1329 33 is_stmt 0 view .LVU1136
+	pxor	%xmm8, %xmm1	# _437, tmp1569
+.LVL182:
+	.loc 2 1329 33 view .LVU1137
+.LBE3264:
+.LBE3268:
+.LBB3269:
+.LBB3267:
+# /usr/lib/gcc/x86_64-linux-gnu/12/include/tmmintrin.h:138:   return (__m128i) __builtin_ia32_pshufb128 ((__v16qi)__X, (__v16qi)__Y);
+	.loc 4 138 20 view .LVU1138
+	pshufb	.LC0(%rip), %xmm1	#, tmp1570
+.LVL183:
+	.loc 4 138 20 view .LVU1139
+.LBE3267:
+.LBE3269:
+	.loc 1 306 115 is_stmt 1 view .LVU1140
+.LBB3270:
+.LBI3270:
+	.loc 2 1064 1 view .LVU1141
+.LBB3271:
+	.loc 2 1066 3 view .LVU1142
+# /usr/lib/gcc/x86_64-linux-gnu/12/include/emmintrin.h:1066:   return (__m128i) ((__v4su)__A + (__v4su)__B);
+	.loc 2 1066 33 is_stmt 0 view .LVU1143
+	paddd	%xmm1, %xmm2	# tmp1570, _445
+.LVL184:
+	.loc 2 1066 33 view .LVU1144
+.LBE3271:
+.LBE3270:
+	.loc 1 306 145 is_stmt 1 view .LVU1145
+.LBB3272:
+.LBI3272:
+	.loc 2 1327 1 view .LVU1146
+.LBB3273:
+	.loc 2 1329 3 view .LVU1147
+	.loc 2 1329 3 is_stmt 0 view .LVU1148
+.LBE3273:
+.LBE3272:
+.LBB3275:
+.LBI3275:
+	.loc 2 1184 1 is_stmt 1 view .LVU1149
+.LBB3276:
+	.loc 2 1186 3 view .LVU1150
+.LBE3276:
+.LBE3275:
+.LBB3279:
+.LBB3274:
+# /usr/lib/gcc/x86_64-linux-gnu/12/include/emmintrin.h:1329:   return (__m128i) ((__v2du)__A ^ (__v2du)__B);
+	.loc 2 1329 33 is_stmt 0 view .LVU1151
+	pxor	%xmm2, %xmm0	# _445, tmp1572
+.LVL185:
+	.loc 2 1329 33 view .LVU1152
+.LBE3274:
+.LBE3279:
+.LBB3280:
+.LBB3277:
+# /usr/lib/gcc/x86_64-linux-gnu/12/include/emmintrin.h:1186:   return (__m128i)__builtin_ia32_pslldi128 ((__v4si)__A, __B);
+	.loc 2 1186 19 view .LVU1153
+	movdqa	%xmm0, %xmm10	# tmp1572, tmp1573
+.LBE3277:
+.LBE3280:
+.LBB3281:
+.LBB3282:
+# /usr/lib/gcc/x86_64-linux-gnu/12/include/emmintrin.h:1251:   return (__m128i)__builtin_ia32_psrldi128 ((__v4si)__A, __B);
+	.loc 2 1251 19 view .LVU1154
+	psrld	$12, %xmm0	#, tmp1575
+.LVL186:
+	.loc 2 1251 19 view .LVU1155
+.LBE3282:
+.LBE3281:
+.LBB3284:
+.LBB3278:
+# /usr/lib/gcc/x86_64-linux-gnu/12/include/emmintrin.h:1186:   return (__m128i)__builtin_ia32_pslldi128 ((__v4si)__A, __B);
+	.loc 2 1186 19 view .LVU1156
+	pslld	$20, %xmm10	#, tmp1573
+.LVL187:
+	.loc 2 1186 19 view .LVU1157
+.LBE3278:
+.LBE3284:
+.LBB3285:
+.LBI3281:
+	.loc 2 1249 1 is_stmt 1 view .LVU1158
+.LBB3283:
+	.loc 2 1251 3 view .LVU1159
+	.loc 2 1251 3 is_stmt 0 view .LVU1160
+.LBE3283:
+.LBE3285:
+.LBB3286:
+.LBI3286:
+	.loc 2 1321 1 is_stmt 1 view .LVU1161
+.LBB3287:
+	.loc 2 1323 3 view .LVU1162
+# /usr/lib/gcc/x86_64-linux-gnu/12/include/emmintrin.h:1323:   return (__m128i) ((__v2du)__A | (__v2du)__B);
+	.loc 2 1323 33 is_stmt 0 view .LVU1163
+	por	%xmm10, %xmm0	# tmp1573, _454
+.LVL188:
+	.loc 2 1323 33 view .LVU1164
+.LBE3287:
+.LBE3286:
+	.loc 1 306 252 is_stmt 1 view .LVU1165
+.LBB3288:
+.LBI3288:
+	.loc 2 1064 1 view .LVU1166
+.LBB3289:
+	.loc 2 1066 3 view .LVU1167
+	.loc 2 1066 3 is_stmt 0 view .LVU1168
+.LBE3289:
+.LBE3288:
+.LBB3290:
+.LBI3290:
+	.loc 2 1064 1 is_stmt 1 view .LVU1169
+.LBB3291:
+	.loc 2 1066 3 view .LVU1170
+# /usr/lib/gcc/x86_64-linux-gnu/12/include/emmintrin.h:1066:   return (__m128i) ((__v4su)__A + (__v4su)__B);
+	.loc 2 1066 33 is_stmt 0 view .LVU1171
+	paddd	%xmm0, %xmm7	# _454, tmp1577
+.LVL189:
+	.loc 2 1066 33 view .LVU1172
+	paddd	%xmm8, %xmm7	# _437, _458
+.LVL190:
+	.loc 2 1066 33 view .LVU1173
+.LBE3291:
+.LBE3290:
+	.loc 1 306 301 is_stmt 1 view .LVU1174
+.LBB3292:
+.LBI3292:
+	.loc 2 1327 1 view .LVU1175
+.LBB3293:
+	.loc 2 1329 3 view .LVU1176
+	.loc 2 1329 3 is_stmt 0 view .LVU1177
+.LBE3293:
+.LBE3292:
+.LBB3295:
+.LBI3295:
+	.loc 4 136 1 is_stmt 1 view .LVU1178
+.LBB3296:
+	.loc 4 138 3 view .LVU1179
+.LBE3296:
+.LBE3295:
+.LBB3298:
+.LBB3299:
+# /usr/lib/gcc/x86_64-linux-gnu/12/include/emmintrin.h:1458:   return (__m128i)__builtin_ia32_pshufd ((__v4si)__A, __mask);
+	.loc 2 1458 19 is_stmt 0 view .LVU1180
+	pshufd	$204, %xmm4, %xmm8	#, m1, tmp1601
+.LBE3299:
+.LBE3298:
+.LBB3301:
+.LBB3294:
+# /usr/lib/gcc/x86_64-linux-gnu/12/include/emmintrin.h:1329:   return (__m128i) ((__v2du)__A ^ (__v2du)__B);
+	.loc 2 1329 33 view .LVU1181
+	pxor	%xmm7, %xmm1	# _458, tmp1578
+.LVL191:
+	.loc 2 1329 33 view .LVU1182
+.LBE3294:
+.LBE3301:
+.LBB3302:
+.LBB3297:
+# /usr/lib/gcc/x86_64-linux-gnu/12/include/tmmintrin.h:138:   return (__m128i) __builtin_ia32_pshufb128 ((__v16qi)__X, (__v16qi)__Y);
+	.loc 4 138 20 view .LVU1183
+	pshufb	.LC2(%rip), %xmm1	#, tmp1579
+.LVL192:
+	.loc 4 138 20 view .LVU1184
+.LBE3297:
+.LBE3302:
+	.loc 1 306 354 is_stmt 1 view .LVU1185
+.LBB3303:
+.LBI3303:
+	.loc 2 1064 1 view .LVU1186
+.LBB3304:
+	.loc 2 1066 3 view .LVU1187
+# /usr/lib/gcc/x86_64-linux-gnu/12/include/emmintrin.h:1066:   return (__m128i) ((__v4su)__A + (__v4su)__B);
+	.loc 2 1066 33 is_stmt 0 view .LVU1188
+	paddd	%xmm1, %xmm2	# tmp1579, _465
+.LVL193:
+	.loc 2 1066 33 view .LVU1189
+.LBE3304:
+.LBE3303:
+	.loc 1 306 384 is_stmt 1 view .LVU1190
+.LBB3305:
+.LBI3305:
+	.loc 2 1327 1 view .LVU1191
+.LBB3306:
+	.loc 2 1329 3 view .LVU1192
+	.loc 2 1329 3 is_stmt 0 view .LVU1193
+.LBE3306:
+.LBE3305:
+.LBB3308:
+.LBI3308:
+	.loc 2 1184 1 is_stmt 1 view .LVU1194
+.LBB3309:
+	.loc 2 1186 3 view .LVU1195
+.LBE3309:
+.LBE3308:
+.LBB3312:
+.LBB3313:
+# /usr/lib/gcc/x86_64-linux-gnu/12/include/emmintrin.h:1458:   return (__m128i)__builtin_ia32_pshufd ((__v4si)__A, __mask);
+	.loc 2 1458 19 is_stmt 0 view .LVU1196
+	pshufd	$57, %xmm1, %xmm1	#, tmp1579, tmp1591
+.LVL194:
+	.loc 2 1458 19 view .LVU1197
+.LBE3313:
+.LBE3312:
+.LBB3315:
+.LBB3307:
+# /usr/lib/gcc/x86_64-linux-gnu/12/include/emmintrin.h:1329:   return (__m128i) ((__v2du)__A ^ (__v2du)__B);
+	.loc 2 1329 33 view .LVU1198
+	pxor	%xmm2, %xmm0	# _465, tmp1581
+.LVL195:
+	.loc 2 1329 33 view .LVU1199
+.LBE3307:
+.LBE3315:
+.LBB3316:
+.LBB3317:
+# /usr/lib/gcc/x86_64-linux-gnu/12/include/emmintrin.h:1458:   return (__m128i)__builtin_ia32_pshufd ((__v4si)__A, __mask);
+	.loc 2 1458 19 view .LVU1200
+	pshufd	$78, %xmm2, %xmm2	#, _465, tmp1589
+.LVL196:
+	.loc 2 1458 19 view .LVU1201
+.LBE3317:
+.LBE3316:
+.LBB3319:
+.LBB3310:
+# /usr/lib/gcc/x86_64-linux-gnu/12/include/emmintrin.h:1186:   return (__m128i)__builtin_ia32_pslldi128 ((__v4si)__A, __B);
+	.loc 2 1186 19 view .LVU1202
+	movdqa	%xmm0, %xmm11	# tmp1581, tmp1582
+.LBE3310:
+.LBE3319:
+.LBB3320:
+.LBB3321:
+# /usr/lib/gcc/x86_64-linux-gnu/12/include/emmintrin.h:1251:   return (__m128i)__builtin_ia32_psrldi128 ((__v4si)__A, __B);
+	.loc 2 1251 19 view .LVU1203
+	psrld	$7, %xmm0	#, tmp1584
+.LVL197:
+	.loc 2 1251 19 view .LVU1204
+.LBE3321:
+.LBE3320:
+.LBB3323:
+.LBB3311:
+# /usr/lib/gcc/x86_64-linux-gnu/12/include/emmintrin.h:1186:   return (__m128i)__builtin_ia32_pslldi128 ((__v4si)__A, __B);
+	.loc 2 1186 19 view .LVU1205
+	pslld	$25, %xmm11	#, tmp1582
+.LVL198:
+	.loc 2 1186 19 view .LVU1206
+.LBE3311:
+.LBE3323:
+.LBB3324:
+.LBI3320:
+	.loc 2 1249 1 is_stmt 1 view .LVU1207
+.LBB3322:
+	.loc 2 1251 3 view .LVU1208
+	.loc 2 1251 3 is_stmt 0 view .LVU1209
+.LBE3322:
+.LBE3324:
+.LBB3325:
+.LBI3325:
+	.loc 2 1321 1 is_stmt 1 view .LVU1210
+.LBB3326:
+	.loc 2 1323 3 view .LVU1211
+	.loc 2 1323 3 is_stmt 0 view .LVU1212
+.LBE3326:
+.LBE3325:
+	.loc 1 306 10 is_stmt 1 view .LVU1213
+	.loc 1 306 503 view .LVU1214
+.LBB3328:
+.LBI3328:
+	.loc 2 1456 1 view .LVU1215
+.LBB3329:
+	.loc 2 1458 3 view .LVU1216
+.LBE3329:
+.LBE3328:
+.LBB3331:
+.LBB3327:
+# /usr/lib/gcc/x86_64-linux-gnu/12/include/emmintrin.h:1323:   return (__m128i) ((__v2du)__A | (__v2du)__B);
+	.loc 2 1323 33 is_stmt 0 view .LVU1217
+	por	%xmm11, %xmm0	# tmp1582, tmp1587
+.LVL199:
+	.loc 2 1323 33 view .LVU1218
+.LBE3327:
+.LBE3331:
+.LBB3332:
+.LBB3333:
+# /usr/lib/gcc/x86_64-linux-gnu/12/include/smmintrin.h:168:   return (__m128i) __builtin_ia32_pblendw128 ((__v8hi)__X,
+	.loc 3 168 20 view .LVU1219
+	movdqa	%xmm3, %xmm11	# m0, tmp1603
+.LBE3333:
+.LBE3332:
+.LBB3336:
+.LBB3330:
+# /usr/lib/gcc/x86_64-linux-gnu/12/include/emmintrin.h:1458:   return (__m128i)__builtin_ia32_pshufd ((__v4si)__A, __mask);
+	.loc 2 1458 19 view .LVU1220
+	pshufd	$147, %xmm0, %xmm0	#, tmp1587, tmp1586
+.LVL200:
+	.loc 2 1458 19 view .LVU1221
+.LBE3330:
+.LBE3336:
+	.loc 1 306 7 is_stmt 1 view .LVU1222
+.LBB3337:
+.LBI3316:
+	.loc 2 1456 1 view .LVU1223
+.LBB3318:
+	.loc 2 1458 3 view .LVU1224
+	.loc 2 1458 3 is_stmt 0 view .LVU1225
+.LBE3318:
+.LBE3337:
+	.loc 1 306 7 is_stmt 1 view .LVU1226
+.LBB3338:
+.LBI3312:
+	.loc 2 1456 1 view .LVU1227
+.LBB3314:
+	.loc 2 1458 3 view .LVU1228
+	.loc 2 1458 3 is_stmt 0 view .LVU1229
+.LBE3314:
+.LBE3338:
+	.loc 1 306 8 is_stmt 1 view .LVU1230
+	.loc 1 307 5 view .LVU1231
+	.loc 1 307 10 view .LVU1232
+	.loc 1 307 15 view .LVU1233
+.LBB3339:
+.LBI3141:
+	.loc 2 1456 1 view .LVU1234
+.LBB3143:
+	.loc 2 1458 3 view .LVU1235
+	.loc 2 1458 3 is_stmt 0 view .LVU1236
+.LBE3143:
+.LBE3339:
+	.loc 1 307 7 is_stmt 1 view .LVU1237
+	.loc 1 307 15 view .LVU1238
+.LBB3340:
+.LBI3205:
+	.loc 3 166 1 view .LVU1239
+.LBB3207:
+	.loc 3 168 3 view .LVU1240
+	.loc 3 168 3 is_stmt 0 view .LVU1241
+.LBE3207:
+.LBE3340:
+	.loc 1 307 50 is_stmt 1 view .LVU1242
+	.loc 1 307 58 view .LVU1243
+.LBB3341:
+.LBI3214:
+	.loc 3 166 1 view .LVU1244
+.LBB3216:
+	.loc 3 168 3 view .LVU1245
+	.loc 3 168 3 is_stmt 0 view .LVU1246
+.LBE3216:
+.LBE3341:
+	.loc 1 307 93 is_stmt 1 view .LVU1247
+	.loc 1 307 102 view .LVU1248
+.LBB3342:
+.LBI3298:
+	.loc 2 1456 1 view .LVU1249
+.LBB3300:
+	.loc 2 1458 3 view .LVU1250
+	.loc 2 1458 3 is_stmt 0 view .LVU1251
+.LBE3300:
+.LBE3342:
+	.loc 1 307 7 is_stmt 1 view .LVU1252
+.LBB3343:
+.LBI3332:
+	.loc 3 166 1 view .LVU1253
+.LBB3334:
+	.loc 3 168 3 view .LVU1254
+# /usr/lib/gcc/x86_64-linux-gnu/12/include/smmintrin.h:168:   return (__m128i) __builtin_ia32_pblendw128 ((__v8hi)__X,
+	.loc 3 168 20 is_stmt 0 view .LVU1255
+	pblendw	$60, %xmm8, %xmm11	#, tmp1601, tmp1603
+.LBE3334:
+.LBE3343:
+.LBB3344:
+.LBB3345:
+# /usr/lib/gcc/x86_64-linux-gnu/12/include/emmintrin.h:1458:   return (__m128i)__builtin_ia32_pshufd ((__v4si)__A, __mask);
+	.loc 2 1458 19 view .LVU1256
+	pshufd	$236, %xmm5, %xmm8	#, m2, tmp1609
+.LVL201:
+	.loc 2 1458 19 view .LVU1257
+.LBE3345:
+.LBE3344:
+.LBB3347:
+.LBB3348:
+# /usr/lib/gcc/x86_64-linux-gnu/12/include/emmintrin.h:1066:   return (__m128i) ((__v4su)__A + (__v4su)__B);
+	.loc 2 1066 33 view .LVU1258
+	paddd	%xmm0, %xmm12	# tmp1586, tmp1632
+.LVL202:
+	.loc 2 1066 33 view .LVU1259
+.LBE3348:
+.LBE3347:
+.LBB3351:
+.LBB3335:
+# /usr/lib/gcc/x86_64-linux-gnu/12/include/smmintrin.h:168:   return (__m128i) __builtin_ia32_pblendw128 ((__v8hi)__X,
+	.loc 3 168 20 view .LVU1260
+	movdqa	%xmm11, %xmm13	# tmp1603, tmp1603
+.LVL203:
+	.loc 3 168 20 view .LVU1261
+.LBE3335:
+.LBE3351:
+	.loc 1 307 42 is_stmt 1 view .LVU1262
+	.loc 1 307 50 view .LVU1263
+.LBB3352:
+.LBI3352:
+	.loc 3 166 1 view .LVU1264
+.LBB3353:
+	.loc 3 168 3 view .LVU1265
+.LBE3353:
+.LBE3352:
+.LBB3355:
+.LBB3356:
+# /usr/lib/gcc/x86_64-linux-gnu/12/include/smmintrin.h:168:   return (__m128i) __builtin_ia32_pblendw128 ((__v8hi)__X,
+	.loc 3 168 20 is_stmt 0 view .LVU1266
+	pblendw	$12, %xmm8, %xmm9	#, tmp1609, tmp1611
+.LBE3356:
+.LBE3355:
+.LBB3358:
+.LBB3349:
+# /usr/lib/gcc/x86_64-linux-gnu/12/include/emmintrin.h:1066:   return (__m128i) ((__v4su)__A + (__v4su)__B);
+	.loc 2 1066 33 view .LVU1267
+	paddd	%xmm7, %xmm12	# _458, _504
+.LBE3349:
+.LBE3358:
+.LBB3359:
+.LBB3354:
+# /usr/lib/gcc/x86_64-linux-gnu/12/include/smmintrin.h:168:   return (__m128i) __builtin_ia32_pblendw128 ((__v8hi)__X,
+	.loc 3 168 20 view .LVU1268
+	pblendw	$192, %xmm6, %xmm13	#, m3, tmp1606
+.LVL204:
+	.loc 3 168 20 view .LVU1269
+.LBE3354:
+.LBE3359:
+	.loc 1 307 85 is_stmt 1 view .LVU1270
+	.loc 1 307 7 view .LVU1271
+.LBB3360:
+.LBI3344:
+	.loc 2 1456 1 view .LVU1272
+.LBB3346:
+	.loc 2 1458 3 view .LVU1273
+	.loc 2 1458 3 is_stmt 0 view .LVU1274
+.LBE3346:
+.LBE3360:
+	.loc 1 307 7 is_stmt 1 view .LVU1275
+.LBB3361:
+.LBI3355:
+	.loc 3 166 1 view .LVU1276
+.LBB3357:
+	.loc 3 168 3 view .LVU1277
+	.loc 3 168 3 is_stmt 0 view .LVU1278
+.LBE3357:
+.LBE3361:
+	.loc 1 307 42 is_stmt 1 view .LVU1279
+	.loc 1 307 50 view .LVU1280
+.LBB3362:
+.LBI3362:
+	.loc 3 166 1 view .LVU1281
+.LBB3363:
+	.loc 3 168 3 view .LVU1282
+.LBE3363:
+.LBE3362:
+.LBB3365:
+.LBB3366:
+# /usr/lib/gcc/x86_64-linux-gnu/12/include/emmintrin.h:1458:   return (__m128i)__builtin_ia32_pshufd ((__v4si)__A, __mask);
+	.loc 2 1458 19 is_stmt 0 view .LVU1283
+	pshufd	$248, %xmm5, %xmm7	#, m2, tmp1694
+.LVL205:
+	.loc 2 1458 19 view .LVU1284
+.LBE3366:
+.LBE3365:
+.LBB3368:
+.LBB3369:
+# /usr/lib/gcc/x86_64-linux-gnu/12/include/emmintrin.h:1329:   return (__m128i) ((__v2du)__A ^ (__v2du)__B);
+	.loc 2 1329 33 view .LVU1285
+	pxor	%xmm12, %xmm1	# _504, tmp1633
+.LVL206:
+	.loc 2 1329 33 view .LVU1286
+.LBE3369:
+.LBE3368:
+.LBB3371:
+.LBB3364:
+# /usr/lib/gcc/x86_64-linux-gnu/12/include/smmintrin.h:168:   return (__m128i) __builtin_ia32_pblendw128 ((__v8hi)__X,
+	.loc 3 168 20 view .LVU1287
+	pblendw	$48, %xmm4, %xmm9	#, m1, tmp1614
+.LVL207:
+	.loc 3 168 20 view .LVU1288
+.LBE3364:
+.LBE3371:
+	.loc 1 307 85 is_stmt 1 view .LVU1289
+	.loc 1 307 93 view .LVU1290
+.LBB3372:
+.LBI3372:
+	.loc 3 166 1 view .LVU1291
+.LBB3373:
+	.loc 3 168 3 view .LVU1292
+.LBE3373:
+.LBE3372:
+.LBB3376:
+.LBB3377:
+# /usr/lib/gcc/x86_64-linux-gnu/12/include/emmintrin.h:1458:   return (__m128i)__builtin_ia32_pshufd ((__v4si)__A, __mask);
+	.loc 2 1458 19 is_stmt 0 view .LVU1293
+	pshufd	$96, %xmm6, %xmm8	#, m3, tmp1622
+.LBE3377:
+.LBE3376:
+.LBB3379:
+.LBB3380:
+# /usr/lib/gcc/x86_64-linux-gnu/12/include/tmmintrin.h:138:   return (__m128i) __builtin_ia32_pshufb128 ((__v16qi)__X, (__v16qi)__Y);
+	.loc 4 138 20 view .LVU1294
+	pshufb	.LC0(%rip), %xmm1	#, tmp1634
+.LBE3380:
+.LBE3379:
+.LBB3382:
+.LBB3374:
+# /usr/lib/gcc/x86_64-linux-gnu/12/include/smmintrin.h:168:   return (__m128i) __builtin_ia32_pblendw128 ((__v8hi)__X,
+	.loc 3 168 20 view .LVU1295
+	pblendw	$192, %xmm3, %xmm9	#, m0, tmp1614
+.LVL208:
+	.loc 3 168 20 view .LVU1296
+.LBE3374:
+.LBE3382:
+.LBB3383:
+.LBB3384:
+# /usr/lib/gcc/x86_64-linux-gnu/12/include/emmintrin.h:1066:   return (__m128i) ((__v4su)__A + (__v4su)__B);
+	.loc 2 1066 33 view .LVU1297
+	paddd	%xmm1, %xmm2	# tmp1634, _512
+.LVL209:
+	.loc 2 1066 33 view .LVU1298
+.LBE3384:
+.LBE3383:
+.LBB3386:
+.LBB3375:
+# /usr/lib/gcc/x86_64-linux-gnu/12/include/smmintrin.h:168:   return (__m128i) __builtin_ia32_pblendw128 ((__v8hi)__X,
+	.loc 3 168 20 view .LVU1299
+	movdqa	%xmm9, %xmm10	# tmp1614, tmp1617
+.LVL210:
+	.loc 3 168 20 view .LVU1300
+.LBE3375:
+.LBE3386:
+	.loc 1 307 128 is_stmt 1 view .LVU1301
+.LBB3387:
+.LBI3387:
+	.loc 2 1456 1 view .LVU1302
+.LBB3388:
+	.loc 2 1458 3 view .LVU1303
+# /usr/lib/gcc/x86_64-linux-gnu/12/include/emmintrin.h:1458:   return (__m128i)__builtin_ia32_pshufd ((__v4si)__A, __mask);
+	.loc 2 1458 19 is_stmt 0 view .LVU1304
+	pshufd	$229, %xmm3, %xmm9	#, m0, tmp1620
+.LVL211:
+	.loc 2 1458 19 view .LVU1305
+.LBE3388:
+.LBE3387:
+	.loc 1 307 7 is_stmt 1 view .LVU1306
+.LBB3389:
+.LBI3376:
+	.loc 2 1456 1 view .LVU1307
+.LBB3378:
+	.loc 2 1458 3 view .LVU1308
+	.loc 2 1458 3 is_stmt 0 view .LVU1309
+.LBE3378:
+.LBE3389:
+	.loc 1 307 7 is_stmt 1 view .LVU1310
+.LBB3390:
+.LBI3390:
+	.loc 3 166 1 view .LVU1311
+.LBB3391:
+	.loc 3 168 3 view .LVU1312
+.LBE3391:
+.LBE3390:
+.LBB3393:
+.LBB3394:
+# /usr/lib/gcc/x86_64-linux-gnu/12/include/emmintrin.h:1329:   return (__m128i) ((__v2du)__A ^ (__v2du)__B);
+	.loc 2 1329 33 is_stmt 0 view .LVU1313
+	pxor	%xmm2, %xmm0	# _512, tmp1636
+.LVL212:
+	.loc 2 1329 33 view .LVU1314
+.LBE3394:
+.LBE3393:
+.LBB3396:
+.LBB3392:
+# /usr/lib/gcc/x86_64-linux-gnu/12/include/smmintrin.h:168:   return (__m128i) __builtin_ia32_pblendw128 ((__v8hi)__X,
+	.loc 3 168 20 view .LVU1315
+	pblendw	$204, %xmm8, %xmm9	#, tmp1622, tmp1624
+.LVL213:
+	.loc 3 168 20 view .LVU1316
+.LBE3392:
+.LBE3396:
+	.loc 1 307 42 is_stmt 1 view .LVU1317
+.LBB3397:
+.LBI3397:
+	.loc 2 1456 1 view .LVU1318
+.LBB3398:
+	.loc 2 1458 3 view .LVU1319
+# /usr/lib/gcc/x86_64-linux-gnu/12/include/emmintrin.h:1458:   return (__m128i)__builtin_ia32_pshufd ((__v4si)__A, __mask);
+	.loc 2 1458 19 is_stmt 0 view .LVU1320
+	pshufd	$196, %xmm5, %xmm8	#, m2, tmp1627
+.LVL214:
+	.loc 2 1458 19 view .LVU1321
+.LBE3398:
+.LBE3397:
+	.loc 1 307 7 is_stmt 1 view .LVU1322
+.LBB3399:
+.LBI3399:
+	.loc 3 166 1 view .LVU1323
+.LBB3400:
+	.loc 3 168 3 view .LVU1324
+.LBE3400:
+.LBE3399:
+.LBB3402:
+.LBB3403:
+# /usr/lib/gcc/x86_64-linux-gnu/12/include/emmintrin.h:1186:   return (__m128i)__builtin_ia32_pslldi128 ((__v4si)__A, __B);
+	.loc 2 1186 19 is_stmt 0 view .LVU1325
+	movdqa	%xmm0, %xmm11	# tmp1636, tmp1637
+.LBE3403:
+.LBE3402:
+.LBB3405:
+.LBB3406:
+# /usr/lib/gcc/x86_64-linux-gnu/12/include/emmintrin.h:1251:   return (__m128i)__builtin_ia32_psrldi128 ((__v4si)__A, __B);
+	.loc 2 1251 19 view .LVU1326
+	psrld	$12, %xmm0	#, tmp1639
+.LBE3406:
+.LBE3405:
+.LBB3408:
+.LBB3401:
+# /usr/lib/gcc/x86_64-linux-gnu/12/include/smmintrin.h:168:   return (__m128i) __builtin_ia32_pblendw128 ((__v8hi)__X,
+	.loc 3 168 20 view .LVU1327
+	pblendw	$48, %xmm8, %xmm9	#, tmp1627, tmp1629
+.LVL215:
+	.loc 3 168 20 view .LVU1328
+.LBE3401:
+.LBE3408:
+	.loc 1 307 13 is_stmt 1 view .LVU1329
+	.loc 1 307 55 view .LVU1330
+	.loc 1 307 60 view .LVU1331
+.LBB3409:
+.LBI3409:
+	.loc 2 1064 1 view .LVU1332
+.LBB3410:
+	.loc 2 1066 3 view .LVU1333
+	.loc 2 1066 3 is_stmt 0 view .LVU1334
+.LBE3410:
+.LBE3409:
+.LBB3411:
+.LBI3347:
+	.loc 2 1064 1 is_stmt 1 view .LVU1335
+.LBB3350:
+	.loc 2 1066 3 view .LVU1336
+	.loc 2 1066 3 is_stmt 0 view .LVU1337
+.LBE3350:
+.LBE3411:
+	.loc 1 307 109 is_stmt 1 view .LVU1338
+.LBB3412:
+.LBI3368:
+	.loc 2 1327 1 view .LVU1339
+.LBB3370:
+	.loc 2 1329 3 view .LVU1340
+	.loc 2 1329 3 is_stmt 0 view .LVU1341
+.LBE3370:
+.LBE3412:
+.LBB3413:
+.LBI3379:
+	.loc 4 136 1 is_stmt 1 view .LVU1342
+.LBB3381:
+	.loc 4 138 3 view .LVU1343
+	.loc 4 138 3 is_stmt 0 view .LVU1344
+.LBE3381:
+.LBE3413:
+	.loc 1 307 163 is_stmt 1 view .LVU1345
+.LBB3414:
+.LBI3383:
+	.loc 2 1064 1 view .LVU1346
+.LBB3385:
+	.loc 2 1066 3 view .LVU1347
+	.loc 2 1066 3 is_stmt 0 view .LVU1348
+.LBE3385:
+.LBE3414:
+	.loc 1 307 193 is_stmt 1 view .LVU1349
+.LBB3415:
+.LBI3393:
+	.loc 2 1327 1 view .LVU1350
+.LBB3395:
+	.loc 2 1329 3 view .LVU1351
+	.loc 2 1329 3 is_stmt 0 view .LVU1352
+.LBE3395:
+.LBE3415:
+.LBB3416:
+.LBI3402:
+	.loc 2 1184 1 is_stmt 1 view .LVU1353
+.LBB3404:
+	.loc 2 1186 3 view .LVU1354
+# /usr/lib/gcc/x86_64-linux-gnu/12/include/emmintrin.h:1186:   return (__m128i)__builtin_ia32_pslldi128 ((__v4si)__A, __B);
+	.loc 2 1186 19 is_stmt 0 view .LVU1355
+	pslld	$20, %xmm11	#, tmp1637
+.LVL216:
+	.loc 2 1186 19 view .LVU1356
+.LBE3404:
+.LBE3416:
+.LBB3417:
+.LBI3405:
+	.loc 2 1249 1 is_stmt 1 view .LVU1357
+.LBB3407:
+	.loc 2 1251 3 view .LVU1358
+	.loc 2 1251 3 is_stmt 0 view .LVU1359
+.LBE3407:
+.LBE3417:
+.LBB3418:
+.LBI3418:
+	.loc 2 1321 1 is_stmt 1 view .LVU1360
+.LBB3419:
+	.loc 2 1323 3 view .LVU1361
+.LBE3419:
+.LBE3418:
+.LBB3421:
+.LBB3422:
+# /usr/lib/gcc/x86_64-linux-gnu/12/include/emmintrin.h:1458:   return (__m128i)__builtin_ia32_pshufd ((__v4si)__A, __mask);
+	.loc 2 1458 19 is_stmt 0 view .LVU1362
+	pshufd	$198, %xmm3, %xmm8	#, m0, tmp1682
+.LVL217:
+	.loc 2 1458 19 view .LVU1363
+.LBE3422:
+.LBE3421:
+.LBB3424:
+.LBB3420:
+# /usr/lib/gcc/x86_64-linux-gnu/12/include/emmintrin.h:1323:   return (__m128i) ((__v2du)__A | (__v2du)__B);
+	.loc 2 1323 33 view .LVU1364
+	por	%xmm11, %xmm0	# tmp1637, _521
+.LVL218:
+	.loc 2 1323 33 view .LVU1365
+.LBE3420:
+.LBE3424:
+	.loc 1 307 300 is_stmt 1 view .LVU1366
+.LBB3425:
+.LBI3425:
+	.loc 2 1064 1 view .LVU1367
+.LBB3426:
+	.loc 2 1066 3 view .LVU1368
+	.loc 2 1066 3 is_stmt 0 view .LVU1369
+.LBE3426:
+.LBE3425:
+.LBB3427:
+.LBI3427:
+	.loc 2 1064 1 is_stmt 1 view .LVU1370
+.LBB3428:
+	.loc 2 1066 3 view .LVU1371
+# /usr/lib/gcc/x86_64-linux-gnu/12/include/emmintrin.h:1066:   return (__m128i) ((__v4su)__A + (__v4su)__B);
+	.loc 2 1066 33 is_stmt 0 view .LVU1372
+	paddd	%xmm0, %xmm13	# _521, tmp1641
+.LVL219:
+	.loc 2 1066 33 view .LVU1373
+	paddd	%xmm12, %xmm13	# _504, _525
+.LVL220:
+	.loc 2 1066 33 view .LVU1374
+.LBE3428:
+.LBE3427:
+	.loc 1 307 349 is_stmt 1 view .LVU1375
+.LBB3429:
+.LBI3429:
+	.loc 2 1327 1 view .LVU1376
+.LBB3430:
+	.loc 2 1329 3 view .LVU1377
+	.loc 2 1329 3 is_stmt 0 view .LVU1378
+.LBE3430:
+.LBE3429:
+.LBB3432:
+.LBI3432:
+	.loc 4 136 1 is_stmt 1 view .LVU1379
+.LBB3433:
+	.loc 4 138 3 view .LVU1380
+.LBE3433:
+.LBE3432:
+.LBB3435:
+.LBB3431:
+# /usr/lib/gcc/x86_64-linux-gnu/12/include/emmintrin.h:1329:   return (__m128i) ((__v2du)__A ^ (__v2du)__B);
+	.loc 2 1329 33 is_stmt 0 view .LVU1381
+	pxor	%xmm13, %xmm1	# _525, tmp1642
+.LVL221:
+	.loc 2 1329 33 view .LVU1382
+.LBE3431:
+.LBE3435:
+.LBB3436:
+.LBB3434:
+# /usr/lib/gcc/x86_64-linux-gnu/12/include/tmmintrin.h:138:   return (__m128i) __builtin_ia32_pshufb128 ((__v16qi)__X, (__v16qi)__Y);
+	.loc 4 138 20 view .LVU1383
+	pshufb	.LC2(%rip), %xmm1	#, tmp1643
+.LVL222:
+	.loc 4 138 20 view .LVU1384
+.LBE3434:
+.LBE3436:
+	.loc 1 307 402 is_stmt 1 view .LVU1385
+.LBB3437:
+.LBI3437:
+	.loc 2 1064 1 view .LVU1386
+.LBB3438:
+	.loc 2 1066 3 view .LVU1387
+.LBE3438:
+.LBE3437:
+.LBB3440:
+.LBB3441:
+# /usr/lib/gcc/x86_64-linux-gnu/12/include/smmintrin.h:168:   return (__m128i) __builtin_ia32_pblendw128 ((__v8hi)__X,
+	.loc 3 168 20 is_stmt 0 view .LVU1388
+	pblendw	$60, -120(%rsp), %xmm15	#, %sfp, tmp1800
+.LBE3441:
+.LBE3440:
+.LBB3443:
+.LBB3439:
+# /usr/lib/gcc/x86_64-linux-gnu/12/include/emmintrin.h:1066:   return (__m128i) ((__v4su)__A + (__v4su)__B);
+	.loc 2 1066 33 view .LVU1389
+	paddd	%xmm1, %xmm2	# tmp1643, _532
+.LVL223:
+	.loc 2 1066 33 view .LVU1390
+.LBE3439:
+.LBE3443:
+	.loc 1 307 432 is_stmt 1 view .LVU1391
+.LBB3444:
+.LBI3444:
+	.loc 2 1327 1 view .LVU1392
+.LBB3445:
+	.loc 2 1329 3 view .LVU1393
+	.loc 2 1329 3 is_stmt 0 view .LVU1394
+.LBE3445:
+.LBE3444:
+.LBB3447:
+.LBI3447:
+	.loc 2 1184 1 is_stmt 1 view .LVU1395
+.LBB3448:
+	.loc 2 1186 3 view .LVU1396
+.LBE3448:
+.LBE3447:
+.LBB3451:
+.LBB3452:
+# /usr/lib/gcc/x86_64-linux-gnu/12/include/emmintrin.h:1458:   return (__m128i)__builtin_ia32_pshufd ((__v4si)__A, __mask);
+	.loc 2 1458 19 is_stmt 0 view .LVU1397
+	pshufd	$147, %xmm1, %xmm1	#, tmp1643, tmp1655
+.LVL224:
+	.loc 2 1458 19 view .LVU1398
+.LBE3452:
+.LBE3451:
+.LBB3454:
+.LBB3455:
+# /usr/lib/gcc/x86_64-linux-gnu/12/include/smmintrin.h:168:   return (__m128i) __builtin_ia32_pblendw128 ((__v8hi)__X,
+	.loc 3 168 20 view .LVU1399
+	pblendw	$192, %xmm5, %xmm15	#, m2, tmp1803
+.LBE3455:
+.LBE3454:
+.LBB3457:
+.LBB3446:
+# /usr/lib/gcc/x86_64-linux-gnu/12/include/emmintrin.h:1329:   return (__m128i) ((__v2du)__A ^ (__v2du)__B);
+	.loc 2 1329 33 view .LVU1400
+	pxor	%xmm2, %xmm0	# _532, tmp1645
+.LVL225:
+	.loc 2 1329 33 view .LVU1401
+.LBE3446:
+.LBE3457:
+.LBB3458:
+.LBB3459:
+# /usr/lib/gcc/x86_64-linux-gnu/12/include/emmintrin.h:1458:   return (__m128i)__builtin_ia32_pshufd ((__v4si)__A, __mask);
+	.loc 2 1458 19 view .LVU1402
+	pshufd	$78, %xmm2, %xmm2	#, _532, tmp1653
+.LVL226:
+	.loc 2 1458 19 view .LVU1403
+.LBE3459:
+.LBE3458:
+.LBB3461:
+.LBB3449:
+# /usr/lib/gcc/x86_64-linux-gnu/12/include/emmintrin.h:1186:   return (__m128i)__builtin_ia32_pslldi128 ((__v4si)__A, __B);
+	.loc 2 1186 19 view .LVU1404
+	movdqa	%xmm0, %xmm11	# tmp1645, tmp1646
+.LBE3449:
+.LBE3461:
+.LBB3462:
+.LBB3463:
+# /usr/lib/gcc/x86_64-linux-gnu/12/include/emmintrin.h:1251:   return (__m128i)__builtin_ia32_psrldi128 ((__v4si)__A, __B);
+	.loc 2 1251 19 view .LVU1405
+	psrld	$7, %xmm0	#, tmp1648
+.LVL227:
+	.loc 2 1251 19 view .LVU1406
+.LBE3463:
+.LBE3462:
+.LBB3465:
+.LBB3450:
+# /usr/lib/gcc/x86_64-linux-gnu/12/include/emmintrin.h:1186:   return (__m128i)__builtin_ia32_pslldi128 ((__v4si)__A, __B);
+	.loc 2 1186 19 view .LVU1407
+	pslld	$25, %xmm11	#, tmp1646
+.LVL228:
+	.loc 2 1186 19 view .LVU1408
+.LBE3450:
+.LBE3465:
+.LBB3466:
+.LBI3462:
+	.loc 2 1249 1 is_stmt 1 view .LVU1409
+.LBB3464:
+	.loc 2 1251 3 view .LVU1410
+	.loc 2 1251 3 is_stmt 0 view .LVU1411
+.LBE3464:
+.LBE3466:
+.LBB3467:
+.LBI3467:
+	.loc 2 1321 1 is_stmt 1 view .LVU1412
+.LBB3468:
+	.loc 2 1323 3 view .LVU1413
+	.loc 2 1323 3 is_stmt 0 view .LVU1414
+.LBE3468:
+.LBE3467:
+	.loc 1 307 58 is_stmt 1 view .LVU1415
+	.loc 1 307 551 view .LVU1416
+.LBB3470:
+.LBI3470:
+	.loc 2 1456 1 view .LVU1417
+.LBB3471:
+	.loc 2 1458 3 view .LVU1418
+.LBE3471:
+.LBE3470:
+.LBB3473:
+.LBB3469:
+# /usr/lib/gcc/x86_64-linux-gnu/12/include/emmintrin.h:1323:   return (__m128i) ((__v2du)__A | (__v2du)__B);
+	.loc 2 1323 33 is_stmt 0 view .LVU1419
+	por	%xmm11, %xmm0	# tmp1646, tmp1651
+.LVL229:
+	.loc 2 1323 33 view .LVU1420
+.LBE3469:
+.LBE3473:
+.LBB3474:
+.LBB3472:
+# /usr/lib/gcc/x86_64-linux-gnu/12/include/emmintrin.h:1458:   return (__m128i)__builtin_ia32_pshufd ((__v4si)__A, __mask);
+	.loc 2 1458 19 view .LVU1421
+	pshufd	$57, %xmm0, %xmm0	#, tmp1651, tmp1650
+.LVL230:
+	.loc 2 1458 19 view .LVU1422
+.LBE3472:
+.LBE3474:
+	.loc 1 307 7 is_stmt 1 view .LVU1423
+.LBB3475:
+.LBI3458:
+	.loc 2 1456 1 view .LVU1424
+.LBB3460:
+	.loc 2 1458 3 view .LVU1425
+	.loc 2 1458 3 is_stmt 0 view .LVU1426
+.LBE3460:
+.LBE3475:
+	.loc 1 307 7 is_stmt 1 view .LVU1427
+.LBB3476:
+.LBI3451:
+	.loc 2 1456 1 view .LVU1428
+.LBB3453:
+	.loc 2 1458 3 view .LVU1429
+	.loc 2 1458 3 is_stmt 0 view .LVU1430
+.LBE3453:
+.LBE3476:
+	.loc 1 307 7 is_stmt 1 view .LVU1431
+	.loc 1 307 12 view .LVU1432
+.LBB3477:
+.LBI3477:
+	.loc 2 1064 1 view .LVU1433
+.LBB3478:
+	.loc 2 1066 3 view .LVU1434
+	.loc 2 1066 3 is_stmt 0 view .LVU1435
+.LBE3478:
+.LBE3477:
+.LBB3479:
+.LBI3479:
+	.loc 2 1064 1 is_stmt 1 view .LVU1436
+.LBB3480:
+	.loc 2 1066 3 view .LVU1437
+# /usr/lib/gcc/x86_64-linux-gnu/12/include/emmintrin.h:1066:   return (__m128i) ((__v4su)__A + (__v4su)__B);
+	.loc 2 1066 33 is_stmt 0 view .LVU1438
+	paddd	%xmm0, %xmm10	# tmp1650, tmp1657
+.LVL231:
+	.loc 2 1066 33 view .LVU1439
+	paddd	%xmm13, %xmm10	# _525, _550
+.LVL232:
+	.loc 2 1066 33 view .LVU1440
+.LBE3480:
+.LBE3479:
+	.loc 1 307 61 is_stmt 1 view .LVU1441
+.LBB3481:
+.LBI3481:
+	.loc 2 1327 1 view .LVU1442
+.LBB3482:
+	.loc 2 1329 3 view .LVU1443
+	.loc 2 1329 3 is_stmt 0 view .LVU1444
+.LBE3482:
+.LBE3481:
+.LBB3484:
+.LBI3484:
+	.loc 4 136 1 is_stmt 1 view .LVU1445
+.LBB3485:
+	.loc 4 138 3 view .LVU1446
+.LBE3485:
+.LBE3484:
+.LBB3487:
+.LBB3488:
+# /usr/lib/gcc/x86_64-linux-gnu/12/include/emmintrin.h:1458:   return (__m128i)__builtin_ia32_pshufd ((__v4si)__A, __mask);
+	.loc 2 1458 19 is_stmt 0 view .LVU1447
+	pshufd	$100, %xmm5, %xmm13	#, m2, tmp1717
+.LBE3488:
+.LBE3487:
+.LBB3490:
+.LBB3483:
+# /usr/lib/gcc/x86_64-linux-gnu/12/include/emmintrin.h:1329:   return (__m128i) ((__v2du)__A ^ (__v2du)__B);
+	.loc 2 1329 33 view .LVU1448
+	pxor	%xmm10, %xmm1	# _550, tmp1658
+.LVL233:
+	.loc 2 1329 33 view .LVU1449
+.LBE3483:
+.LBE3490:
+.LBB3491:
+.LBB3486:
+# /usr/lib/gcc/x86_64-linux-gnu/12/include/tmmintrin.h:138:   return (__m128i) __builtin_ia32_pshufb128 ((__v16qi)__X, (__v16qi)__Y);
+	.loc 4 138 20 view .LVU1450
+	pshufb	.LC0(%rip), %xmm1	#, tmp1659
+.LVL234:
+	.loc 4 138 20 view .LVU1451
+.LBE3486:
+.LBE3491:
+	.loc 1 307 115 is_stmt 1 view .LVU1452
+.LBB3492:
+.LBI3492:
+	.loc 2 1064 1 view .LVU1453
+.LBB3493:
+	.loc 2 1066 3 view .LVU1454
+# /usr/lib/gcc/x86_64-linux-gnu/12/include/emmintrin.h:1066:   return (__m128i) ((__v4su)__A + (__v4su)__B);
+	.loc 2 1066 33 is_stmt 0 view .LVU1455
+	paddd	%xmm1, %xmm2	# tmp1659, _558
+.LVL235:
+	.loc 2 1066 33 view .LVU1456
+.LBE3493:
+.LBE3492:
+	.loc 1 307 145 is_stmt 1 view .LVU1457
+.LBB3494:
+.LBI3494:
+	.loc 2 1327 1 view .LVU1458
+.LBB3495:
+	.loc 2 1329 3 view .LVU1459
+	.loc 2 1329 3 is_stmt 0 view .LVU1460
+.LBE3495:
+.LBE3494:
+.LBB3497:
+.LBI3497:
+	.loc 2 1184 1 is_stmt 1 view .LVU1461
+.LBB3498:
+	.loc 2 1186 3 view .LVU1462
+.LBE3498:
+.LBE3497:
+.LBB3501:
+.LBB3496:
+# /usr/lib/gcc/x86_64-linux-gnu/12/include/emmintrin.h:1329:   return (__m128i) ((__v2du)__A ^ (__v2du)__B);
+	.loc 2 1329 33 is_stmt 0 view .LVU1463
+	pxor	%xmm2, %xmm0	# _558, tmp1661
+.LVL236:
+	.loc 2 1329 33 view .LVU1464
+.LBE3496:
+.LBE3501:
+.LBB3502:
+.LBB3499:
+# /usr/lib/gcc/x86_64-linux-gnu/12/include/emmintrin.h:1186:   return (__m128i)__builtin_ia32_pslldi128 ((__v4si)__A, __B);
+	.loc 2 1186 19 view .LVU1465
+	movdqa	%xmm0, %xmm11	# tmp1661, tmp1662
+.LBE3499:
+.LBE3502:
+.LBB3503:
+.LBB3504:
+# /usr/lib/gcc/x86_64-linux-gnu/12/include/emmintrin.h:1251:   return (__m128i)__builtin_ia32_psrldi128 ((__v4si)__A, __B);
+	.loc 2 1251 19 view .LVU1466
+	psrld	$12, %xmm0	#, tmp1664
+.LVL237:
+	.loc 2 1251 19 view .LVU1467
+.LBE3504:
+.LBE3503:
+.LBB3506:
+.LBB3500:
+# /usr/lib/gcc/x86_64-linux-gnu/12/include/emmintrin.h:1186:   return (__m128i)__builtin_ia32_pslldi128 ((__v4si)__A, __B);
+	.loc 2 1186 19 view .LVU1468
+	pslld	$20, %xmm11	#, tmp1662
+.LVL238:
+	.loc 2 1186 19 view .LVU1469
+.LBE3500:
+.LBE3506:
+.LBB3507:
+.LBI3503:
+	.loc 2 1249 1 is_stmt 1 view .LVU1470
+.LBB3505:
+	.loc 2 1251 3 view .LVU1471
+	.loc 2 1251 3 is_stmt 0 view .LVU1472
+.LBE3505:
+.LBE3507:
+.LBB3508:
+.LBI3508:
+	.loc 2 1321 1 is_stmt 1 view .LVU1473
+.LBB3509:
+	.loc 2 1323 3 view .LVU1474
+# /usr/lib/gcc/x86_64-linux-gnu/12/include/emmintrin.h:1323:   return (__m128i) ((__v2du)__A | (__v2du)__B);
+	.loc 2 1323 33 is_stmt 0 view .LVU1475
+	por	%xmm11, %xmm0	# tmp1662, _567
+.LVL239:
+	.loc 2 1323 33 view .LVU1476
+.LBE3509:
+.LBE3508:
+	.loc 1 307 252 is_stmt 1 view .LVU1477
+.LBB3510:
+.LBI3510:
+	.loc 2 1064 1 view .LVU1478
+.LBB3511:
+	.loc 2 1066 3 view .LVU1479
+	.loc 2 1066 3 is_stmt 0 view .LVU1480
+.LBE3511:
+.LBE3510:
+.LBB3512:
+.LBI3512:
+	.loc 2 1064 1 is_stmt 1 view .LVU1481
+.LBB3513:
+	.loc 2 1066 3 view .LVU1482
+.LBE3513:
+.LBE3512:
+.LBB3516:
+.LBB3517:
+# /usr/lib/gcc/x86_64-linux-gnu/12/include/emmintrin.h:1458:   return (__m128i)__builtin_ia32_pshufd ((__v4si)__A, __mask);
+	.loc 2 1458 19 is_stmt 0 view .LVU1483
+	pshufd	$232, %xmm4, %xmm11	#, m1, tmp1684
+.LBE3517:
+.LBE3516:
+.LBB3519:
+.LBB3514:
+# /usr/lib/gcc/x86_64-linux-gnu/12/include/emmintrin.h:1066:   return (__m128i) ((__v4su)__A + (__v4su)__B);
+	.loc 2 1066 33 view .LVU1484
+	paddd	%xmm0, %xmm9	# _567, tmp1666
+.LVL240:
+	.loc 2 1066 33 view .LVU1485
+.LBE3514:
+.LBE3519:
+.LBB3520:
+.LBB3521:
+# /usr/lib/gcc/x86_64-linux-gnu/12/include/smmintrin.h:168:   return (__m128i) __builtin_ia32_pblendw128 ((__v8hi)__X,
+	.loc 3 168 20 view .LVU1486
+	movaps	%xmm11, -40(%rsp)	# tmp1684, %sfp
+.LBE3521:
+.LBE3520:
+.LBB3524:
+.LBB3525:
+	movdqa	%xmm6, %xmm11	# m3, tmp1696
+.LBE3525:
+.LBE3524:
+.LBB3528:
+.LBB3515:
+# /usr/lib/gcc/x86_64-linux-gnu/12/include/emmintrin.h:1066:   return (__m128i) ((__v4su)__A + (__v4su)__B);
+	.loc 2 1066 33 view .LVU1487
+	paddd	%xmm10, %xmm9	# _550, _571
+.LVL241:
+	.loc 2 1066 33 view .LVU1488
+.LBE3515:
+.LBE3528:
+	.loc 1 307 301 is_stmt 1 view .LVU1489
+.LBB3529:
+.LBI3529:
+	.loc 2 1327 1 view .LVU1490
+.LBB3530:
+	.loc 2 1329 3 view .LVU1491
+	.loc 2 1329 3 is_stmt 0 view .LVU1492
+.LBE3530:
+.LBE3529:
+.LBB3532:
+.LBI3532:
+	.loc 4 136 1 is_stmt 1 view .LVU1493
+.LBB3533:
+	.loc 4 138 3 view .LVU1494
+.LBE3533:
+.LBE3532:
+.LBB3535:
+.LBB3526:
+# /usr/lib/gcc/x86_64-linux-gnu/12/include/smmintrin.h:168:   return (__m128i) __builtin_ia32_pblendw128 ((__v8hi)__X,
+	.loc 3 168 20 is_stmt 0 view .LVU1495
+	pblendw	$60, %xmm7, %xmm11	#, tmp1694, tmp1696
+.LBE3526:
+.LBE3535:
+.LBB3536:
+.LBB3522:
+	pblendw	$12, -40(%rsp), %xmm8	#, %sfp, tmp1686
+.LBE3522:
+.LBE3536:
+.LBB3537:
+.LBB3531:
+# /usr/lib/gcc/x86_64-linux-gnu/12/include/emmintrin.h:1329:   return (__m128i) ((__v2du)__A ^ (__v2du)__B);
+	.loc 2 1329 33 view .LVU1496
+	pxor	%xmm9, %xmm1	# _571, tmp1667
+.LVL242:
+	.loc 2 1329 33 view .LVU1497
+.LBE3531:
+.LBE3537:
+.LBB3538:
+.LBB3539:
+# /usr/lib/gcc/x86_64-linux-gnu/12/include/smmintrin.h:168:   return (__m128i) __builtin_ia32_pblendw128 ((__v8hi)__X,
+	.loc 3 168 20 view .LVU1498
+	pblendw	$192, %xmm3, %xmm11	#, m0, tmp1699
+.LBE3539:
+.LBE3538:
+.LBB3541:
+.LBB3542:
+# /usr/lib/gcc/x86_64-linux-gnu/12/include/emmintrin.h:1458:   return (__m128i)__builtin_ia32_pshufd ((__v4si)__A, __mask);
+	.loc 2 1458 19 view .LVU1499
+	pshufd	$100, %xmm3, %xmm7	#, m0, tmp1707
+.LBE3542:
+.LBE3541:
+.LBB3544:
+.LBB3534:
+# /usr/lib/gcc/x86_64-linux-gnu/12/include/tmmintrin.h:138:   return (__m128i) __builtin_ia32_pshufb128 ((__v16qi)__X, (__v16qi)__Y);
+	.loc 4 138 20 view .LVU1500
+	pshufb	.LC2(%rip), %xmm1	#, tmp1668
+.LVL243:
+	.loc 4 138 20 view .LVU1501
+.LBE3534:
+.LBE3544:
+	.loc 1 307 354 is_stmt 1 view .LVU1502
+.LBB3545:
+.LBI3545:
+	.loc 2 1064 1 view .LVU1503
+.LBB3546:
+	.loc 2 1066 3 view .LVU1504
+# /usr/lib/gcc/x86_64-linux-gnu/12/include/emmintrin.h:1066:   return (__m128i) ((__v4su)__A + (__v4su)__B);
+	.loc 2 1066 33 is_stmt 0 view .LVU1505
+	paddd	%xmm1, %xmm2	# tmp1668, _578
+.LVL244:
+	.loc 2 1066 33 view .LVU1506
+.LBE3546:
+.LBE3545:
+	.loc 1 307 384 is_stmt 1 view .LVU1507
+.LBB3547:
+.LBI3547:
+	.loc 2 1327 1 view .LVU1508
+.LBB3548:
+	.loc 2 1329 3 view .LVU1509
+	.loc 2 1329 3 is_stmt 0 view .LVU1510
+.LBE3548:
+.LBE3547:
+.LBB3550:
+.LBI3550:
+	.loc 2 1184 1 is_stmt 1 view .LVU1511
+.LBB3551:
+	.loc 2 1186 3 view .LVU1512
+.LBE3551:
+.LBE3550:
+.LBB3554:
+.LBB3555:
+# /usr/lib/gcc/x86_64-linux-gnu/12/include/emmintrin.h:1458:   return (__m128i)__builtin_ia32_pshufd ((__v4si)__A, __mask);
+	.loc 2 1458 19 is_stmt 0 view .LVU1513
+	pshufd	$57, %xmm1, %xmm1	#, tmp1668, tmp1680
+.LVL245:
+	.loc 2 1458 19 view .LVU1514
+.LBE3555:
+.LBE3554:
+.LBB3557:
+.LBB3549:
+# /usr/lib/gcc/x86_64-linux-gnu/12/include/emmintrin.h:1329:   return (__m128i) ((__v2du)__A ^ (__v2du)__B);
+	.loc 2 1329 33 view .LVU1515
+	pxor	%xmm2, %xmm0	# _578, tmp1670
+.LVL246:
+	.loc 2 1329 33 view .LVU1516
+.LBE3549:
+.LBE3557:
+.LBB3558:
+.LBB3559:
+# /usr/lib/gcc/x86_64-linux-gnu/12/include/emmintrin.h:1458:   return (__m128i)__builtin_ia32_pshufd ((__v4si)__A, __mask);
+	.loc 2 1458 19 view .LVU1517
+	pshufd	$78, %xmm2, %xmm2	#, _578, tmp1678
+.LVL247:
+	.loc 2 1458 19 view .LVU1518
+.LBE3559:
+.LBE3558:
+.LBB3561:
+.LBB3552:
+# /usr/lib/gcc/x86_64-linux-gnu/12/include/emmintrin.h:1186:   return (__m128i)__builtin_ia32_pslldi128 ((__v4si)__A, __B);
+	.loc 2 1186 19 view .LVU1519
+	movdqa	%xmm0, %xmm12	# tmp1670, tmp1671
+.LBE3552:
+.LBE3561:
+.LBB3562:
+.LBB3563:
+# /usr/lib/gcc/x86_64-linux-gnu/12/include/emmintrin.h:1251:   return (__m128i)__builtin_ia32_psrldi128 ((__v4si)__A, __B);
+	.loc 2 1251 19 view .LVU1520
+	psrld	$7, %xmm0	#, tmp1673
+.LVL248:
+	.loc 2 1251 19 view .LVU1521
+.LBE3563:
+.LBE3562:
+.LBB3565:
+.LBB3553:
+# /usr/lib/gcc/x86_64-linux-gnu/12/include/emmintrin.h:1186:   return (__m128i)__builtin_ia32_pslldi128 ((__v4si)__A, __B);
+	.loc 2 1186 19 view .LVU1522
+	pslld	$25, %xmm12	#, tmp1671
+.LVL249:
+	.loc 2 1186 19 view .LVU1523
+.LBE3553:
+.LBE3565:
+.LBB3566:
+.LBI3562:
+	.loc 2 1249 1 is_stmt 1 view .LVU1524
+.LBB3564:
+	.loc 2 1251 3 view .LVU1525
+	.loc 2 1251 3 is_stmt 0 view .LVU1526
+.LBE3564:
+.LBE3566:
+.LBB3567:
+.LBI3567:
+	.loc 2 1321 1 is_stmt 1 view .LVU1527
+.LBB3568:
+	.loc 2 1323 3 view .LVU1528
+	.loc 2 1323 3 is_stmt 0 view .LVU1529
+.LBE3568:
+.LBE3567:
+	.loc 1 307 10 is_stmt 1 view .LVU1530
+	.loc 1 307 503 view .LVU1531
+.LBB3570:
+.LBI3570:
+	.loc 2 1456 1 view .LVU1532
+.LBB3571:
+	.loc 2 1458 3 view .LVU1533
+.LBE3571:
+.LBE3570:
+.LBB3573:
+.LBB3569:
+# /usr/lib/gcc/x86_64-linux-gnu/12/include/emmintrin.h:1323:   return (__m128i) ((__v2du)__A | (__v2du)__B);
+	.loc 2 1323 33 is_stmt 0 view .LVU1534
+	por	%xmm12, %xmm0	# tmp1671, tmp1676
+.LVL250:
+	.loc 2 1323 33 view .LVU1535
+.LBE3569:
+.LBE3573:
+.LBB3574:
+.LBB3575:
+# /usr/lib/gcc/x86_64-linux-gnu/12/include/emmintrin.h:1458:   return (__m128i)__builtin_ia32_pshufd ((__v4si)__A, __mask);
+	.loc 2 1458 19 view .LVU1536
+	pshufd	$36, %xmm5, %xmm12	#, m2, tmp1689
+.LBE3575:
+.LBE3574:
+.LBB3577:
+.LBB3578:
+# /usr/lib/gcc/x86_64-linux-gnu/12/include/smmintrin.h:168:   return (__m128i) __builtin_ia32_pblendw128 ((__v8hi)__X,
+	.loc 3 168 20 view .LVU1537
+	movaps	%xmm12, -24(%rsp)	# tmp1689, %sfp
+.LBE3578:
+.LBE3577:
+.LBB3581:
+.LBB3572:
+# /usr/lib/gcc/x86_64-linux-gnu/12/include/emmintrin.h:1458:   return (__m128i)__builtin_ia32_pshufd ((__v4si)__A, __mask);
+	.loc 2 1458 19 view .LVU1538
+	pshufd	$147, %xmm0, %xmm0	#, tmp1676, tmp1675
+.LVL251:
+	.loc 2 1458 19 view .LVU1539
+.LBE3572:
+.LBE3581:
+	.loc 1 307 7 is_stmt 1 view .LVU1540
+.LBB3582:
+.LBI3558:
+	.loc 2 1456 1 view .LVU1541
+.LBB3560:
+	.loc 2 1458 3 view .LVU1542
+	.loc 2 1458 3 is_stmt 0 view .LVU1543
+.LBE3560:
+.LBE3582:
+	.loc 1 307 7 is_stmt 1 view .LVU1544
+.LBB3583:
+.LBI3554:
+	.loc 2 1456 1 view .LVU1545
+.LBB3556:
+	.loc 2 1458 3 view .LVU1546
+	.loc 2 1458 3 is_stmt 0 view .LVU1547
+.LBE3556:
+.LBE3583:
+	.loc 1 307 8 is_stmt 1 view .LVU1548
+	.loc 1 308 5 view .LVU1549
+	.loc 1 308 10 view .LVU1550
+	.loc 1 308 15 view .LVU1551
+.LBB3584:
+.LBI3421:
+	.loc 2 1456 1 view .LVU1552
+.LBB3423:
+	.loc 2 1458 3 view .LVU1553
+	.loc 2 1458 3 is_stmt 0 view .LVU1554
+.LBE3423:
+.LBE3584:
+	.loc 1 308 7 is_stmt 1 view .LVU1555
+.LBB3585:
+.LBI3516:
+	.loc 2 1456 1 view .LVU1556
+.LBB3518:
+	.loc 2 1458 3 view .LVU1557
+	.loc 2 1458 3 is_stmt 0 view .LVU1558
+.LBE3518:
+.LBE3585:
+	.loc 1 308 7 is_stmt 1 view .LVU1559
+.LBB3586:
+.LBI3520:
+	.loc 3 166 1 view .LVU1560
+.LBB3523:
+	.loc 3 168 3 view .LVU1561
+	.loc 3 168 3 is_stmt 0 view .LVU1562
+.LBE3523:
+.LBE3586:
+	.loc 1 308 42 is_stmt 1 view .LVU1563
+.LBB3587:
+.LBI3574:
+	.loc 2 1456 1 view .LVU1564
+.LBB3576:
+	.loc 2 1458 3 view .LVU1565
+	.loc 2 1458 3 is_stmt 0 view .LVU1566
+.LBE3576:
+.LBE3587:
+	.loc 1 308 7 is_stmt 1 view .LVU1567
+.LBB3588:
+.LBI3577:
+	.loc 3 166 1 view .LVU1568
+.LBB3579:
+	.loc 3 168 3 view .LVU1569
+.LBE3579:
+.LBE3588:
+.LBB3589:
+.LBB3590:
+# /usr/lib/gcc/x86_64-linux-gnu/12/include/emmintrin.h:1458:   return (__m128i)__builtin_ia32_pshufd ((__v4si)__A, __mask);
+	.loc 2 1458 19 is_stmt 0 view .LVU1570
+	pshufd	$236, %xmm4, %xmm12	#, m1, tmp1702
+.LVL252:
+	.loc 2 1458 19 view .LVU1571
+.LBE3590:
+.LBE3589:
+.LBB3592:
+.LBB3580:
+# /usr/lib/gcc/x86_64-linux-gnu/12/include/smmintrin.h:168:   return (__m128i) __builtin_ia32_pblendw128 ((__v8hi)__X,
+	.loc 3 168 20 view .LVU1572
+	pblendw	$192, -24(%rsp), %xmm8	#, %sfp, tmp1691
+.LVL253:
+	.loc 3 168 20 view .LVU1573
+.LBE3580:
+.LBE3592:
+	.loc 1 308 42 is_stmt 1 view .LVU1574
+	.loc 1 308 51 view .LVU1575
+.LBB3593:
+.LBI3365:
+	.loc 2 1456 1 view .LVU1576
+.LBB3367:
+	.loc 2 1458 3 view .LVU1577
+	.loc 2 1458 3 is_stmt 0 view .LVU1578
+.LBE3367:
+.LBE3593:
+	.loc 1 308 7 is_stmt 1 view .LVU1579
+.LBB3594:
+.LBI3524:
+	.loc 3 166 1 view .LVU1580
+.LBB3527:
+	.loc 3 168 3 view .LVU1581
+	.loc 3 168 3 is_stmt 0 view .LVU1582
+.LBE3527:
+.LBE3594:
+	.loc 1 308 42 is_stmt 1 view .LVU1583
+	.loc 1 308 50 view .LVU1584
+.LBB3595:
+.LBI3538:
+	.loc 3 166 1 view .LVU1585
+.LBB3540:
+	.loc 3 168 3 view .LVU1586
+	.loc 3 168 3 is_stmt 0 view .LVU1587
+.LBE3540:
+.LBE3595:
+	.loc 1 308 85 is_stmt 1 view .LVU1588
+.LBB3596:
+.LBI3589:
+	.loc 2 1456 1 view .LVU1589
+.LBB3591:
+	.loc 2 1458 3 view .LVU1590
+	.loc 2 1458 3 is_stmt 0 view .LVU1591
+.LBE3591:
+.LBE3596:
+	.loc 1 308 7 is_stmt 1 view .LVU1592
+	.loc 1 308 7 view .LVU1593
+.LBB3597:
+.LBI3597:
+	.loc 3 166 1 view .LVU1594
+.LBB3598:
+	.loc 3 168 3 view .LVU1595
+# /usr/lib/gcc/x86_64-linux-gnu/12/include/smmintrin.h:168:   return (__m128i) __builtin_ia32_pblendw128 ((__v8hi)__X,
+	.loc 3 168 20 is_stmt 0 view .LVU1596
+	movdqa	%xmm12, %xmm10	# tmp1702, tmp1704
+	pblendw	$48, -88(%rsp), %xmm10	#, %sfp, tmp1704
+.LVL254:
+	.loc 3 168 20 view .LVU1597
+.LBE3598:
+.LBE3597:
+	.loc 1 308 42 is_stmt 1 view .LVU1598
+.LBB3599:
+.LBI3541:
+	.loc 2 1456 1 view .LVU1599
+.LBB3543:
+	.loc 2 1458 3 view .LVU1600
+	.loc 2 1458 3 is_stmt 0 view .LVU1601
+.LBE3543:
+.LBE3599:
+	.loc 1 308 7 is_stmt 1 view .LVU1602
+.LBB3600:
+.LBI3600:
+	.loc 3 166 1 view .LVU1603
+.LBB3601:
+	.loc 3 168 3 view .LVU1604
+.LBE3601:
+.LBE3600:
+.LBB3603:
+.LBB3604:
+# /usr/lib/gcc/x86_64-linux-gnu/12/include/emmintrin.h:1066:   return (__m128i) ((__v4su)__A + (__v4su)__B);
+	.loc 2 1066 33 is_stmt 0 view .LVU1605
+	paddd	%xmm0, %xmm8	# tmp1675, tmp1722
+.LVL255:
+	.loc 2 1066 33 view .LVU1606
+	paddd	%xmm9, %xmm8	# _571, _620
+.LBE3604:
+.LBE3603:
+.LBB3606:
+.LBB3602:
+# /usr/lib/gcc/x86_64-linux-gnu/12/include/smmintrin.h:168:   return (__m128i) __builtin_ia32_pblendw128 ((__v8hi)__X,
+	.loc 3 168 20 view .LVU1607
+	pblendw	$192, %xmm7, %xmm10	#, tmp1707, tmp1709
+.LVL256:
+	.loc 3 168 20 view .LVU1608
+.LBE3602:
+.LBE3606:
+	.loc 1 308 42 is_stmt 1 view .LVU1609
+.LBB3607:
+.LBI3607:
+	.loc 2 1456 1 view .LVU1610
+.LBB3608:
+	.loc 2 1458 3 view .LVU1611
+# /usr/lib/gcc/x86_64-linux-gnu/12/include/emmintrin.h:1458:   return (__m128i)__builtin_ia32_pshufd ((__v4si)__A, __mask);
+	.loc 2 1458 19 is_stmt 0 view .LVU1612
+	pshufd	$229, %xmm6, %xmm7	#, m3, tmp1712
+.LVL257:
+	.loc 2 1458 19 view .LVU1613
+.LBE3608:
+.LBE3607:
+	.loc 1 308 7 is_stmt 1 view .LVU1614
+	.loc 1 308 15 view .LVU1615
+.LBB3609:
+.LBI3609:
+	.loc 3 166 1 view .LVU1616
+.LBB3610:
+	.loc 3 168 3 view .LVU1617
+.LBE3610:
+.LBE3609:
+.LBB3612:
+.LBB3613:
+# /usr/lib/gcc/x86_64-linux-gnu/12/include/emmintrin.h:1329:   return (__m128i) ((__v2du)__A ^ (__v2du)__B);
+	.loc 2 1329 33 is_stmt 0 view .LVU1618
+	pxor	%xmm8, %xmm1	# _620, tmp1723
+.LVL258:
+	.loc 2 1329 33 view .LVU1619
+.LBE3613:
+.LBE3612:
+.LBB3615:
+.LBB3611:
+# /usr/lib/gcc/x86_64-linux-gnu/12/include/smmintrin.h:168:   return (__m128i) __builtin_ia32_pblendw128 ((__v8hi)__X,
+	.loc 3 168 20 view .LVU1620
+	pblendw	$12, %xmm4, %xmm7	#, m1, tmp1714
+.LVL259:
+	.loc 3 168 20 view .LVU1621
+.LBE3611:
+.LBE3615:
+	.loc 1 308 50 is_stmt 1 view .LVU1622
+.LBB3616:
+.LBI3487:
+	.loc 2 1456 1 view .LVU1623
+.LBB3489:
+	.loc 2 1458 3 view .LVU1624
+	.loc 2 1458 3 is_stmt 0 view .LVU1625
+.LBE3489:
+.LBE3616:
+	.loc 1 308 7 is_stmt 1 view .LVU1626
+.LBB3617:
+.LBI3617:
+	.loc 3 166 1 view .LVU1627
+.LBB3618:
+	.loc 3 168 3 view .LVU1628
+.LBE3618:
+.LBE3617:
+.LBB3620:
+.LBB3621:
+# /usr/lib/gcc/x86_64-linux-gnu/12/include/tmmintrin.h:138:   return (__m128i) __builtin_ia32_pshufb128 ((__v16qi)__X, (__v16qi)__Y);
+	.loc 4 138 20 is_stmt 0 view .LVU1629
+	pshufb	.LC0(%rip), %xmm1	#, tmp1724
+.LBE3621:
+.LBE3620:
+.LBB3623:
+.LBB3619:
+# /usr/lib/gcc/x86_64-linux-gnu/12/include/smmintrin.h:168:   return (__m128i) __builtin_ia32_pblendw128 ((__v8hi)__X,
+	.loc 3 168 20 view .LVU1630
+	pblendw	$192, %xmm13, %xmm7	#, tmp1717, tmp1719
+.LVL260:
+	.loc 3 168 20 view .LVU1631
+.LBE3619:
+.LBE3623:
+	.loc 1 308 13 is_stmt 1 view .LVU1632
+	.loc 1 308 55 view .LVU1633
+	.loc 1 308 60 view .LVU1634
+.LBB3624:
+.LBI3624:
+	.loc 2 1064 1 view .LVU1635
+.LBB3625:
+	.loc 2 1066 3 view .LVU1636
+	.loc 2 1066 3 is_stmt 0 view .LVU1637
+.LBE3625:
+.LBE3624:
+.LBB3626:
+.LBI3603:
+	.loc 2 1064 1 is_stmt 1 view .LVU1638
+.LBB3605:
+	.loc 2 1066 3 view .LVU1639
+	.loc 2 1066 3 is_stmt 0 view .LVU1640
+.LBE3605:
+.LBE3626:
+	.loc 1 308 109 is_stmt 1 view .LVU1641
+.LBB3627:
+.LBI3612:
+	.loc 2 1327 1 view .LVU1642
+.LBB3614:
+	.loc 2 1329 3 view .LVU1643
+	.loc 2 1329 3 is_stmt 0 view .LVU1644
+.LBE3614:
+.LBE3627:
+.LBB3628:
+.LBI3620:
+	.loc 4 136 1 is_stmt 1 view .LVU1645
+.LBB3622:
+	.loc 4 138 3 view .LVU1646
+	.loc 4 138 3 is_stmt 0 view .LVU1647
+.LBE3622:
+.LBE3628:
+	.loc 1 308 163 is_stmt 1 view .LVU1648
+.LBB3629:
+.LBI3629:
+	.loc 2 1064 1 view .LVU1649
+.LBB3630:
+	.loc 2 1066 3 view .LVU1650
+.LBE3630:
+.LBE3629:
+.LBB3632:
+.LBB3633:
+# /usr/lib/gcc/x86_64-linux-gnu/12/include/smmintrin.h:168:   return (__m128i) __builtin_ia32_pblendw128 ((__v8hi)__X,
+	.loc 3 168 20 is_stmt 0 view .LVU1651
+	movdqa	%xmm3, %xmm13	# m0, tmp1792
+.LVL261:
+	.loc 3 168 20 view .LVU1652
+	pblendw	$12, -40(%rsp), %xmm13	#, %sfp, tmp1792
+.LBE3633:
+.LBE3632:
+.LBB3635:
+.LBB3631:
+# /usr/lib/gcc/x86_64-linux-gnu/12/include/emmintrin.h:1066:   return (__m128i) ((__v4su)__A + (__v4su)__B);
+	.loc 2 1066 33 view .LVU1653
+	paddd	%xmm1, %xmm2	# tmp1724, _628
+.LVL262:
+	.loc 2 1066 33 view .LVU1654
+.LBE3631:
+.LBE3635:
+	.loc 1 308 193 is_stmt 1 view .LVU1655
+.LBB3636:
+.LBI3636:
+	.loc 2 1327 1 view .LVU1656
+.LBB3637:
+	.loc 2 1329 3 view .LVU1657
+	.loc 2 1329 3 is_stmt 0 view .LVU1658
+.LBE3637:
+.LBE3636:
+.LBB3639:
+.LBI3639:
+	.loc 2 1184 1 is_stmt 1 view .LVU1659
+.LBB3640:
+	.loc 2 1186 3 view .LVU1660
+.LBE3640:
+.LBE3639:
+.LBB3643:
+.LBB3638:
+# /usr/lib/gcc/x86_64-linux-gnu/12/include/emmintrin.h:1329:   return (__m128i) ((__v2du)__A ^ (__v2du)__B);
+	.loc 2 1329 33 is_stmt 0 view .LVU1661
+	pxor	%xmm2, %xmm0	# _628, tmp1726
+.LVL263:
+	.loc 2 1329 33 view .LVU1662
+.LBE3638:
+.LBE3643:
+.LBB3644:
+.LBB3641:
+# /usr/lib/gcc/x86_64-linux-gnu/12/include/emmintrin.h:1186:   return (__m128i)__builtin_ia32_pslldi128 ((__v4si)__A, __B);
+	.loc 2 1186 19 view .LVU1663
+	movdqa	%xmm0, %xmm9	# tmp1726, tmp1727
+.LBE3641:
+.LBE3644:
+.LBB3645:
+.LBB3646:
+# /usr/lib/gcc/x86_64-linux-gnu/12/include/emmintrin.h:1251:   return (__m128i)__builtin_ia32_psrldi128 ((__v4si)__A, __B);
+	.loc 2 1251 19 view .LVU1664
+	psrld	$12, %xmm0	#, tmp1729
+.LVL264:
+	.loc 2 1251 19 view .LVU1665
+.LBE3646:
+.LBE3645:
+.LBB3648:
+.LBB3642:
+# /usr/lib/gcc/x86_64-linux-gnu/12/include/emmintrin.h:1186:   return (__m128i)__builtin_ia32_pslldi128 ((__v4si)__A, __B);
+	.loc 2 1186 19 view .LVU1666
+	pslld	$20, %xmm9	#, tmp1727
+.LVL265:
+	.loc 2 1186 19 view .LVU1667
+.LBE3642:
+.LBE3648:
+.LBB3649:
+.LBI3645:
+	.loc 2 1249 1 is_stmt 1 view .LVU1668
+.LBB3647:
+	.loc 2 1251 3 view .LVU1669
+	.loc 2 1251 3 is_stmt 0 view .LVU1670
+.LBE3647:
+.LBE3649:
+.LBB3650:
+.LBI3650:
+	.loc 2 1321 1 is_stmt 1 view .LVU1671
+.LBB3651:
+	.loc 2 1323 3 view .LVU1672
+# /usr/lib/gcc/x86_64-linux-gnu/12/include/emmintrin.h:1323:   return (__m128i) ((__v2du)__A | (__v2du)__B);
+	.loc 2 1323 33 is_stmt 0 view .LVU1673
+	por	%xmm9, %xmm0	# tmp1727, _637
+.LVL266:
+	.loc 2 1323 33 view .LVU1674
+.LBE3651:
+.LBE3650:
+	.loc 1 308 300 is_stmt 1 view .LVU1675
+.LBB3652:
+.LBI3652:
+	.loc 2 1064 1 view .LVU1676
+.LBB3653:
+	.loc 2 1066 3 view .LVU1677
+	.loc 2 1066 3 is_stmt 0 view .LVU1678
+.LBE3653:
+.LBE3652:
+.LBB3654:
+.LBI3654:
+	.loc 2 1064 1 is_stmt 1 view .LVU1679
+.LBB3655:
+	.loc 2 1066 3 view .LVU1680
+# /usr/lib/gcc/x86_64-linux-gnu/12/include/emmintrin.h:1066:   return (__m128i) ((__v4su)__A + (__v4su)__B);
+	.loc 2 1066 33 is_stmt 0 view .LVU1681
+	paddd	%xmm0, %xmm11	# _637, tmp1731
+.LVL267:
+	.loc 2 1066 33 view .LVU1682
+	paddd	%xmm8, %xmm11	# _620, _641
+.LVL268:
+	.loc 2 1066 33 view .LVU1683
+.LBE3655:
+.LBE3654:
+	.loc 1 308 349 is_stmt 1 view .LVU1684
+.LBB3656:
+.LBI3656:
+	.loc 2 1327 1 view .LVU1685
+.LBB3657:
+	.loc 2 1329 3 view .LVU1686
+	.loc 2 1329 3 is_stmt 0 view .LVU1687
+.LBE3657:
+.LBE3656:
+.LBB3659:
+.LBI3659:
+	.loc 4 136 1 is_stmt 1 view .LVU1688
+.LBB3660:
+	.loc 4 138 3 view .LVU1689
+.LBE3660:
+.LBE3659:
+.LBB3662:
+.LBB3663:
+# /usr/lib/gcc/x86_64-linux-gnu/12/include/emmintrin.h:1458:   return (__m128i)__builtin_ia32_pshufd ((__v4si)__A, __mask);
+	.loc 2 1458 19 is_stmt 0 view .LVU1690
+	pshufd	$36, %xmm4, %xmm8	#, m1, tmp1775
+.LBE3663:
+.LBE3662:
+.LBB3665:
+.LBB3658:
+# /usr/lib/gcc/x86_64-linux-gnu/12/include/emmintrin.h:1329:   return (__m128i) ((__v2du)__A ^ (__v2du)__B);
+	.loc 2 1329 33 view .LVU1691
+	pxor	%xmm11, %xmm1	# _641, tmp1732
+.LVL269:
+	.loc 2 1329 33 view .LVU1692
+.LBE3658:
+.LBE3665:
+.LBB3666:
+.LBB3661:
+# /usr/lib/gcc/x86_64-linux-gnu/12/include/tmmintrin.h:138:   return (__m128i) __builtin_ia32_pshufb128 ((__v16qi)__X, (__v16qi)__Y);
+	.loc 4 138 20 view .LVU1693
+	pshufb	.LC2(%rip), %xmm1	#, tmp1733
+.LVL270:
+	.loc 4 138 20 view .LVU1694
+.LBE3661:
+.LBE3666:
+	.loc 1 308 402 is_stmt 1 view .LVU1695
+.LBB3667:
+.LBI3667:
+	.loc 2 1064 1 view .LVU1696
+.LBB3668:
+	.loc 2 1066 3 view .LVU1697
+# /usr/lib/gcc/x86_64-linux-gnu/12/include/emmintrin.h:1066:   return (__m128i) ((__v4su)__A + (__v4su)__B);
+	.loc 2 1066 33 is_stmt 0 view .LVU1698
+	paddd	%xmm1, %xmm2	# tmp1733, _648
+.LVL271:
+	.loc 2 1066 33 view .LVU1699
+.LBE3668:
+.LBE3667:
+	.loc 1 308 432 is_stmt 1 view .LVU1700
+.LBB3669:
+.LBI3669:
+	.loc 2 1327 1 view .LVU1701
+.LBB3670:
+	.loc 2 1329 3 view .LVU1702
+	.loc 2 1329 3 is_stmt 0 view .LVU1703
+.LBE3670:
+.LBE3669:
+.LBB3672:
+.LBI3672:
+	.loc 2 1184 1 is_stmt 1 view .LVU1704
+.LBB3673:
+	.loc 2 1186 3 view .LVU1705
+.LBE3673:
+.LBE3672:
+.LBB3676:
+.LBB3677:
+# /usr/lib/gcc/x86_64-linux-gnu/12/include/emmintrin.h:1458:   return (__m128i)__builtin_ia32_pshufd ((__v4si)__A, __mask);
+	.loc 2 1458 19 is_stmt 0 view .LVU1706
+	pshufd	$147, %xmm1, %xmm1	#, tmp1733, tmp1745
+.LVL272:
+	.loc 2 1458 19 view .LVU1707
+.LBE3677:
+.LBE3676:
+.LBB3679:
+.LBB3671:
+# /usr/lib/gcc/x86_64-linux-gnu/12/include/emmintrin.h:1329:   return (__m128i) ((__v2du)__A ^ (__v2du)__B);
+	.loc 2 1329 33 view .LVU1708
+	pxor	%xmm2, %xmm0	# _648, tmp1735
+.LVL273:
+	.loc 2 1329 33 view .LVU1709
+.LBE3671:
+.LBE3679:
+.LBB3680:
+.LBB3681:
+# /usr/lib/gcc/x86_64-linux-gnu/12/include/emmintrin.h:1458:   return (__m128i)__builtin_ia32_pshufd ((__v4si)__A, __mask);
+	.loc 2 1458 19 view .LVU1710
+	pshufd	$78, %xmm2, %xmm2	#, _648, tmp1743
+.LVL274:
+	.loc 2 1458 19 view .LVU1711
+.LBE3681:
+.LBE3680:
+.LBB3683:
+.LBB3674:
+# /usr/lib/gcc/x86_64-linux-gnu/12/include/emmintrin.h:1186:   return (__m128i)__builtin_ia32_pslldi128 ((__v4si)__A, __B);
+	.loc 2 1186 19 view .LVU1712
+	movdqa	%xmm0, %xmm9	# tmp1735, tmp1736
+.LBE3674:
+.LBE3683:
+.LBB3684:
+.LBB3685:
+# /usr/lib/gcc/x86_64-linux-gnu/12/include/emmintrin.h:1251:   return (__m128i)__builtin_ia32_psrldi128 ((__v4si)__A, __B);
+	.loc 2 1251 19 view .LVU1713
+	psrld	$7, %xmm0	#, tmp1738
+.LVL275:
+	.loc 2 1251 19 view .LVU1714
+.LBE3685:
+.LBE3684:
+.LBB3687:
+.LBB3675:
+# /usr/lib/gcc/x86_64-linux-gnu/12/include/emmintrin.h:1186:   return (__m128i)__builtin_ia32_pslldi128 ((__v4si)__A, __B);
+	.loc 2 1186 19 view .LVU1715
+	pslld	$25, %xmm9	#, tmp1736
+.LVL276:
+	.loc 2 1186 19 view .LVU1716
+.LBE3675:
+.LBE3687:
+.LBB3688:
+.LBI3684:
+	.loc 2 1249 1 is_stmt 1 view .LVU1717
+.LBB3686:
+	.loc 2 1251 3 view .LVU1718
+	.loc 2 1251 3 is_stmt 0 view .LVU1719
+.LBE3686:
+.LBE3688:
+.LBB3689:
+.LBI3689:
+	.loc 2 1321 1 is_stmt 1 view .LVU1720
+.LBB3690:
+	.loc 2 1323 3 view .LVU1721
+	.loc 2 1323 3 is_stmt 0 view .LVU1722
+.LBE3690:
+.LBE3689:
+	.loc 1 308 58 is_stmt 1 view .LVU1723
+	.loc 1 308 551 view .LVU1724
+.LBB3692:
+.LBI3692:
+	.loc 2 1456 1 view .LVU1725
+.LBB3693:
+	.loc 2 1458 3 view .LVU1726
+.LBE3693:
+.LBE3692:
+.LBB3695:
+.LBB3691:
+# /usr/lib/gcc/x86_64-linux-gnu/12/include/emmintrin.h:1323:   return (__m128i) ((__v2du)__A | (__v2du)__B);
+	.loc 2 1323 33 is_stmt 0 view .LVU1727
+	por	%xmm9, %xmm0	# tmp1736, tmp1741
+.LVL277:
+	.loc 2 1323 33 view .LVU1728
+.LBE3691:
+.LBE3695:
+.LBB3696:
+.LBB3694:
+# /usr/lib/gcc/x86_64-linux-gnu/12/include/emmintrin.h:1458:   return (__m128i)__builtin_ia32_pshufd ((__v4si)__A, __mask);
+	.loc 2 1458 19 view .LVU1729
+	pshufd	$57, %xmm0, %xmm0	#, tmp1741, tmp1740
+.LVL278:
+	.loc 2 1458 19 view .LVU1730
+.LBE3694:
+.LBE3696:
+	.loc 1 308 7 is_stmt 1 view .LVU1731
+.LBB3697:
+.LBI3680:
+	.loc 2 1456 1 view .LVU1732
+.LBB3682:
+	.loc 2 1458 3 view .LVU1733
+	.loc 2 1458 3 is_stmt 0 view .LVU1734
+.LBE3682:
+.LBE3697:
+	.loc 1 308 7 is_stmt 1 view .LVU1735
+.LBB3698:
+.LBI3676:
+	.loc 2 1456 1 view .LVU1736
+.LBB3678:
+	.loc 2 1458 3 view .LVU1737
+	.loc 2 1458 3 is_stmt 0 view .LVU1738
+.LBE3678:
+.LBE3698:
+	.loc 1 308 7 is_stmt 1 view .LVU1739
+	.loc 1 308 12 view .LVU1740
+.LBB3699:
+.LBI3699:
+	.loc 2 1064 1 view .LVU1741
+.LBB3700:
+	.loc 2 1066 3 view .LVU1742
+	.loc 2 1066 3 is_stmt 0 view .LVU1743
+.LBE3700:
+.LBE3699:
+.LBB3701:
+.LBI3701:
+	.loc 2 1064 1 is_stmt 1 view .LVU1744
+.LBB3702:
+	.loc 2 1066 3 view .LVU1745
+# /usr/lib/gcc/x86_64-linux-gnu/12/include/emmintrin.h:1066:   return (__m128i) ((__v4su)__A + (__v4su)__B);
+	.loc 2 1066 33 is_stmt 0 view .LVU1746
+	paddd	%xmm0, %xmm10	# tmp1740, tmp1747
+.LVL279:
+	.loc 2 1066 33 view .LVU1747
+	paddd	%xmm11, %xmm10	# _641, _666
+.LVL280:
+	.loc 2 1066 33 view .LVU1748
+.LBE3702:
+.LBE3701:
+	.loc 1 308 61 is_stmt 1 view .LVU1749
+.LBB3703:
+.LBI3703:
+	.loc 2 1327 1 view .LVU1750
+.LBB3704:
+	.loc 2 1329 3 view .LVU1751
+	.loc 2 1329 3 is_stmt 0 view .LVU1752
+.LBE3704:
+.LBE3703:
+.LBB3706:
+.LBI3706:
+	.loc 4 136 1 is_stmt 1 view .LVU1753
+.LBB3707:
+	.loc 4 138 3 view .LVU1754
+.LBE3707:
+.LBE3706:
+.LBB3709:
+.LBB3705:
+# /usr/lib/gcc/x86_64-linux-gnu/12/include/emmintrin.h:1329:   return (__m128i) ((__v2du)__A ^ (__v2du)__B);
+	.loc 2 1329 33 is_stmt 0 view .LVU1755
+	pxor	%xmm10, %xmm1	# _666, tmp1748
+.LVL281:
+	.loc 2 1329 33 view .LVU1756
+.LBE3705:
+.LBE3709:
+.LBB3710:
+.LBB3708:
+# /usr/lib/gcc/x86_64-linux-gnu/12/include/tmmintrin.h:138:   return (__m128i) __builtin_ia32_pshufb128 ((__v16qi)__X, (__v16qi)__Y);
+	.loc 4 138 20 view .LVU1757
+	pshufb	.LC0(%rip), %xmm1	#, tmp1749
+.LVL282:
+	.loc 4 138 20 view .LVU1758
+.LBE3708:
+.LBE3710:
+	.loc 1 308 115 is_stmt 1 view .LVU1759
+.LBB3711:
+.LBI3711:
+	.loc 2 1064 1 view .LVU1760
+.LBB3712:
+	.loc 2 1066 3 view .LVU1761
+# /usr/lib/gcc/x86_64-linux-gnu/12/include/emmintrin.h:1066:   return (__m128i) ((__v4su)__A + (__v4su)__B);
+	.loc 2 1066 33 is_stmt 0 view .LVU1762
+	paddd	%xmm1, %xmm2	# tmp1749, _674
+.LVL283:
+	.loc 2 1066 33 view .LVU1763
+.LBE3712:
+.LBE3711:
+	.loc 1 308 145 is_stmt 1 view .LVU1764
+.LBB3713:
+.LBI3713:
+	.loc 2 1327 1 view .LVU1765
+.LBB3714:
+	.loc 2 1329 3 view .LVU1766
+	.loc 2 1329 3 is_stmt 0 view .LVU1767
+.LBE3714:
+.LBE3713:
+.LBB3716:
+.LBI3716:
+	.loc 2 1184 1 is_stmt 1 view .LVU1768
+.LBB3717:
+	.loc 2 1186 3 view .LVU1769
+.LBE3717:
+.LBE3716:
+.LBB3720:
+.LBB3715:
+# /usr/lib/gcc/x86_64-linux-gnu/12/include/emmintrin.h:1329:   return (__m128i) ((__v2du)__A ^ (__v2du)__B);
+	.loc 2 1329 33 is_stmt 0 view .LVU1770
+	pxor	%xmm2, %xmm0	# _674, tmp1751
+.LVL284:
+	.loc 2 1329 33 view .LVU1771
+.LBE3715:
+.LBE3720:
+.LBB3721:
+.LBB3718:
+# /usr/lib/gcc/x86_64-linux-gnu/12/include/emmintrin.h:1186:   return (__m128i)__builtin_ia32_pslldi128 ((__v4si)__A, __B);
+	.loc 2 1186 19 view .LVU1772
+	movdqa	%xmm0, %xmm9	# tmp1751, tmp1752
+.LBE3718:
+.LBE3721:
+.LBB3722:
+.LBB3723:
+# /usr/lib/gcc/x86_64-linux-gnu/12/include/emmintrin.h:1251:   return (__m128i)__builtin_ia32_psrldi128 ((__v4si)__A, __B);
+	.loc 2 1251 19 view .LVU1773
+	psrld	$12, %xmm0	#, tmp1754
+.LVL285:
+	.loc 2 1251 19 view .LVU1774
+.LBE3723:
+.LBE3722:
+.LBB3725:
+.LBB3719:
+# /usr/lib/gcc/x86_64-linux-gnu/12/include/emmintrin.h:1186:   return (__m128i)__builtin_ia32_pslldi128 ((__v4si)__A, __B);
+	.loc 2 1186 19 view .LVU1775
+	pslld	$20, %xmm9	#, tmp1752
+.LVL286:
+	.loc 2 1186 19 view .LVU1776
+.LBE3719:
+.LBE3725:
+.LBB3726:
+.LBI3722:
+	.loc 2 1249 1 is_stmt 1 view .LVU1777
+.LBB3724:
+	.loc 2 1251 3 view .LVU1778
+	.loc 2 1251 3 is_stmt 0 view .LVU1779
+.LBE3724:
+.LBE3726:
+.LBB3727:
+.LBI3727:
+	.loc 2 1321 1 is_stmt 1 view .LVU1780
+.LBB3728:
+	.loc 2 1323 3 view .LVU1781
+# /usr/lib/gcc/x86_64-linux-gnu/12/include/emmintrin.h:1323:   return (__m128i) ((__v2du)__A | (__v2du)__B);
+	.loc 2 1323 33 is_stmt 0 view .LVU1782
+	por	%xmm9, %xmm0	# tmp1752, _683
+.LVL287:
+	.loc 2 1323 33 view .LVU1783
+.LBE3728:
+.LBE3727:
+	.loc 1 308 252 is_stmt 1 view .LVU1784
+.LBB3729:
+.LBI3729:
+	.loc 2 1064 1 view .LVU1785
+.LBB3730:
+	.loc 2 1066 3 view .LVU1786
+	.loc 2 1066 3 is_stmt 0 view .LVU1787
+.LBE3730:
+.LBE3729:
+.LBB3731:
+.LBI3731:
+	.loc 2 1064 1 is_stmt 1 view .LVU1788
+.LBB3732:
+	.loc 2 1066 3 view .LVU1789
+# /usr/lib/gcc/x86_64-linux-gnu/12/include/emmintrin.h:1066:   return (__m128i) ((__v4su)__A + (__v4su)__B);
+	.loc 2 1066 33 is_stmt 0 view .LVU1790
+	paddd	%xmm0, %xmm7	# _683, tmp1756
+.LVL288:
+	.loc 2 1066 33 view .LVU1791
+	paddd	%xmm10, %xmm7	# _666, _687
+.LVL289:
+	.loc 2 1066 33 view .LVU1792
+.LBE3732:
+.LBE3731:
+	.loc 1 308 301 is_stmt 1 view .LVU1793
+.LBB3733:
+.LBI3733:
+	.loc 2 1327 1 view .LVU1794
+.LBB3734:
+	.loc 2 1329 3 view .LVU1795
+	.loc 2 1329 3 is_stmt 0 view .LVU1796
+.LBE3734:
+.LBE3733:
+.LBB3736:
+.LBI3736:
+	.loc 4 136 1 is_stmt 1 view .LVU1797
+.LBB3737:
+	.loc 4 138 3 view .LVU1798
+.LBE3737:
+.LBE3736:
+.LBB3739:
+.LBB3740:
+# /usr/lib/gcc/x86_64-linux-gnu/12/include/emmintrin.h:1458:   return (__m128i)__builtin_ia32_pshufd ((__v4si)__A, __mask);
+	.loc 2 1458 19 is_stmt 0 view .LVU1799
+	pshufd	$164, %xmm5, %xmm10	#, m2, tmp1787
+.LBE3740:
+.LBE3739:
+.LBB3742:
+.LBB3735:
+# /usr/lib/gcc/x86_64-linux-gnu/12/include/emmintrin.h:1329:   return (__m128i) ((__v2du)__A ^ (__v2du)__B);
+	.loc 2 1329 33 view .LVU1800
+	pxor	%xmm7, %xmm1	# _687, tmp1757
+.LVL290:
+	.loc 2 1329 33 view .LVU1801
+.LBE3735:
+.LBE3742:
+.LBB3743:
+.LBB3738:
+# /usr/lib/gcc/x86_64-linux-gnu/12/include/tmmintrin.h:138:   return (__m128i) __builtin_ia32_pshufb128 ((__v16qi)__X, (__v16qi)__Y);
+	.loc 4 138 20 view .LVU1802
+	pshufb	.LC2(%rip), %xmm1	#, tmp1758
+.LVL291:
+	.loc 4 138 20 view .LVU1803
+.LBE3738:
+.LBE3743:
+	.loc 1 308 354 is_stmt 1 view .LVU1804
+.LBB3744:
+.LBI3744:
+	.loc 2 1064 1 view .LVU1805
+.LBB3745:
+	.loc 2 1066 3 view .LVU1806
+# /usr/lib/gcc/x86_64-linux-gnu/12/include/emmintrin.h:1066:   return (__m128i) ((__v4su)__A + (__v4su)__B);
+	.loc 2 1066 33 is_stmt 0 view .LVU1807
+	paddd	%xmm1, %xmm2	# tmp1758, _694
+.LVL292:
+	.loc 2 1066 33 view .LVU1808
+.LBE3745:
+.LBE3744:
+	.loc 1 308 384 is_stmt 1 view .LVU1809
+.LBB3746:
+.LBI3746:
+	.loc 2 1327 1 view .LVU1810
+.LBB3747:
+	.loc 2 1329 3 view .LVU1811
+	.loc 2 1329 3 is_stmt 0 view .LVU1812
+.LBE3747:
+.LBE3746:
+.LBB3749:
+.LBI3749:
+	.loc 2 1184 1 is_stmt 1 view .LVU1813
+.LBB3750:
+	.loc 2 1186 3 view .LVU1814
+.LBE3750:
+.LBE3749:
+.LBB3753:
+.LBB3754:
+# /usr/lib/gcc/x86_64-linux-gnu/12/include/emmintrin.h:1458:   return (__m128i)__builtin_ia32_pshufd ((__v4si)__A, __mask);
+	.loc 2 1458 19 is_stmt 0 view .LVU1815
+	pshufd	$57, %xmm1, %xmm1	#, tmp1758, tmp1770
+.LVL293:
+	.loc 2 1458 19 view .LVU1816
+.LBE3754:
+.LBE3753:
+.LBB3756:
+.LBB3748:
+# /usr/lib/gcc/x86_64-linux-gnu/12/include/emmintrin.h:1329:   return (__m128i) ((__v2du)__A ^ (__v2du)__B);
+	.loc 2 1329 33 view .LVU1817
+	pxor	%xmm2, %xmm0	# _694, tmp1760
+.LVL294:
+	.loc 2 1329 33 view .LVU1818
+.LBE3748:
+.LBE3756:
+.LBB3757:
+.LBB3758:
+# /usr/lib/gcc/x86_64-linux-gnu/12/include/emmintrin.h:1458:   return (__m128i)__builtin_ia32_pshufd ((__v4si)__A, __mask);
+	.loc 2 1458 19 view .LVU1819
+	pshufd	$78, %xmm2, %xmm2	#, _694, tmp1768
+.LVL295:
+	.loc 2 1458 19 view .LVU1820
+.LBE3758:
+.LBE3757:
+.LBB3760:
+.LBB3751:
+# /usr/lib/gcc/x86_64-linux-gnu/12/include/emmintrin.h:1186:   return (__m128i)__builtin_ia32_pslldi128 ((__v4si)__A, __B);
+	.loc 2 1186 19 view .LVU1821
+	movdqa	%xmm0, %xmm9	# tmp1760, tmp1761
+.LBE3751:
+.LBE3760:
+.LBB3761:
+.LBB3762:
+# /usr/lib/gcc/x86_64-linux-gnu/12/include/emmintrin.h:1251:   return (__m128i)__builtin_ia32_psrldi128 ((__v4si)__A, __B);
+	.loc 2 1251 19 view .LVU1822
+	psrld	$7, %xmm0	#, tmp1763
+.LVL296:
+	.loc 2 1251 19 view .LVU1823
+.LBE3762:
+.LBE3761:
+.LBB3764:
+.LBB3752:
+# /usr/lib/gcc/x86_64-linux-gnu/12/include/emmintrin.h:1186:   return (__m128i)__builtin_ia32_pslldi128 ((__v4si)__A, __B);
+	.loc 2 1186 19 view .LVU1824
+	pslld	$25, %xmm9	#, tmp1761
+.LVL297:
+	.loc 2 1186 19 view .LVU1825
+.LBE3752:
+.LBE3764:
+.LBB3765:
+.LBI3761:
+	.loc 2 1249 1 is_stmt 1 view .LVU1826
+.LBB3763:
+	.loc 2 1251 3 view .LVU1827
+	.loc 2 1251 3 is_stmt 0 view .LVU1828
+.LBE3763:
+.LBE3765:
+.LBB3766:
+.LBI3766:
+	.loc 2 1321 1 is_stmt 1 view .LVU1829
+.LBB3767:
+	.loc 2 1323 3 view .LVU1830
+	.loc 2 1323 3 is_stmt 0 view .LVU1831
+.LBE3767:
+.LBE3766:
+	.loc 1 308 10 is_stmt 1 view .LVU1832
+	.loc 1 308 503 view .LVU1833
+.LBB3769:
+.LBI3769:
+	.loc 2 1456 1 view .LVU1834
+.LBB3770:
+	.loc 2 1458 3 view .LVU1835
+.LBE3770:
+.LBE3769:
+.LBB3772:
+.LBB3768:
+# /usr/lib/gcc/x86_64-linux-gnu/12/include/emmintrin.h:1323:   return (__m128i) ((__v2du)__A | (__v2du)__B);
+	.loc 2 1323 33 is_stmt 0 view .LVU1836
+	por	%xmm9, %xmm0	# tmp1761, tmp1766
+.LVL298:
+	.loc 2 1323 33 view .LVU1837
+.LBE3768:
+.LBE3772:
+.LBB3773:
+.LBB3774:
+# /usr/lib/gcc/x86_64-linux-gnu/12/include/smmintrin.h:168:   return (__m128i) __builtin_ia32_pblendw128 ((__v8hi)__X,
+	.loc 3 168 20 view .LVU1838
+	movdqa	%xmm6, %xmm9	# m3, tmp1772
+	pblendw	$12, %xmm3, %xmm9	#, m0, tmp1772
+.LBE3774:
+.LBE3773:
+.LBB3776:
+.LBB3771:
+# /usr/lib/gcc/x86_64-linux-gnu/12/include/emmintrin.h:1458:   return (__m128i)__builtin_ia32_pshufd ((__v4si)__A, __mask);
+	.loc 2 1458 19 view .LVU1839
+	pshufd	$147, %xmm0, %xmm0	#, tmp1766, tmp1765
+.LVL299:
+	.loc 2 1458 19 view .LVU1840
+.LBE3771:
+.LBE3776:
+	.loc 1 308 7 is_stmt 1 view .LVU1841
+.LBB3777:
+.LBI3757:
+	.loc 2 1456 1 view .LVU1842
+.LBB3759:
+	.loc 2 1458 3 view .LVU1843
+	.loc 2 1458 3 is_stmt 0 view .LVU1844
+.LBE3759:
+.LBE3777:
+	.loc 1 308 7 is_stmt 1 view .LVU1845
+.LBB3778:
+.LBI3753:
+	.loc 2 1456 1 view .LVU1846
+.LBB3755:
+	.loc 2 1458 3 view .LVU1847
+	.loc 2 1458 3 is_stmt 0 view .LVU1848
+.LBE3755:
+.LBE3778:
+	.loc 1 308 8 is_stmt 1 view .LVU1849
+	.loc 1 309 5 view .LVU1850
+	.loc 1 309 10 view .LVU1851
+	.loc 1 309 15 view .LVU1852
+	.loc 1 309 24 view .LVU1853
+	.loc 1 309 32 view .LVU1854
+.LBB3779:
+.LBI3773:
+	.loc 3 166 1 view .LVU1855
+.LBB3775:
+	.loc 3 168 3 view .LVU1856
+# /usr/lib/gcc/x86_64-linux-gnu/12/include/smmintrin.h:168:   return (__m128i) __builtin_ia32_pblendw128 ((__v8hi)__X,
+	.loc 3 168 20 is_stmt 0 view .LVU1857
+	movdqa	%xmm9, %xmm14	# tmp1772, tmp1772
+.LVL300:
+	.loc 3 168 20 view .LVU1858
+.LBE3775:
+.LBE3779:
+	.loc 1 309 67 is_stmt 1 view .LVU1859
+.LBB3780:
+.LBI3662:
+	.loc 2 1456 1 view .LVU1860
+.LBB3664:
+	.loc 2 1458 3 view .LVU1861
+	.loc 2 1458 3 is_stmt 0 view .LVU1862
+.LBE3664:
+.LBE3780:
+	.loc 1 309 7 is_stmt 1 view .LVU1863
+.LBB3781:
+.LBI3781:
+	.loc 3 166 1 view .LVU1864
+.LBB3782:
+	.loc 3 168 3 view .LVU1865
+.LBE3782:
+.LBE3781:
+.LBB3784:
+.LBB3785:
+# /usr/lib/gcc/x86_64-linux-gnu/12/include/emmintrin.h:1458:   return (__m128i)__builtin_ia32_pshufd ((__v4si)__A, __mask);
+	.loc 2 1458 19 is_stmt 0 view .LVU1866
+	pshufd	$229, %xmm4, %xmm9	#, m1, tmp1780
+.LBE3785:
+.LBE3784:
+.LBB3787:
+.LBB3783:
+# /usr/lib/gcc/x86_64-linux-gnu/12/include/smmintrin.h:168:   return (__m128i) __builtin_ia32_pblendw128 ((__v8hi)__X,
+	.loc 3 168 20 view .LVU1867
+	pblendw	$192, %xmm8, %xmm14	#, tmp1775, tmp1777
+.LVL301:
+	.loc 3 168 20 view .LVU1868
+.LBE3783:
+.LBE3787:
+	.loc 1 309 42 is_stmt 1 view .LVU1869
+.LBB3788:
+.LBI3784:
+	.loc 2 1456 1 view .LVU1870
+.LBB3786:
+	.loc 2 1458 3 view .LVU1871
+	.loc 2 1458 3 is_stmt 0 view .LVU1872
+.LBE3786:
+.LBE3788:
+	.loc 1 309 7 is_stmt 1 view .LVU1873
+.LBB3789:
+.LBI3789:
+	.loc 2 1456 1 view .LVU1874
+.LBB3790:
+	.loc 2 1458 3 view .LVU1875
+# /usr/lib/gcc/x86_64-linux-gnu/12/include/emmintrin.h:1458:   return (__m128i)__builtin_ia32_pshufd ((__v4si)__A, __mask);
+	.loc 2 1458 19 is_stmt 0 view .LVU1876
+	pshufd	$220, %xmm6, %xmm8	#, m3, tmp1782
+.LVL302:
+	.loc 2 1458 19 view .LVU1877
+.LBE3790:
+.LBE3789:
+	.loc 1 309 7 is_stmt 1 view .LVU1878
+.LBB3791:
+.LBI3791:
+	.loc 3 166 1 view .LVU1879
+.LBB3792:
+	.loc 3 168 3 view .LVU1880
+.LBE3792:
+.LBE3791:
+.LBB3794:
+.LBB3795:
+# /usr/lib/gcc/x86_64-linux-gnu/12/include/emmintrin.h:1066:   return (__m128i) ((__v4su)__A + (__v4su)__B);
+	.loc 2 1066 33 is_stmt 0 view .LVU1881
+	paddd	%xmm0, %xmm14	# tmp1765, tmp1806
+.LVL303:
+	.loc 2 1066 33 view .LVU1882
+.LBE3795:
+.LBE3794:
+.LBB3798:
+.LBB3793:
+# /usr/lib/gcc/x86_64-linux-gnu/12/include/smmintrin.h:168:   return (__m128i) __builtin_ia32_pblendw128 ((__v8hi)__X,
+	.loc 3 168 20 view .LVU1883
+	pblendw	$60, %xmm8, %xmm9	#, tmp1782, tmp1784
+.LVL304:
+	.loc 3 168 20 view .LVU1884
+.LBE3793:
+.LBE3798:
+	.loc 1 309 42 is_stmt 1 view .LVU1885
+.LBB3799:
+.LBI3739:
+	.loc 2 1456 1 view .LVU1886
+.LBB3741:
+	.loc 2 1458 3 view .LVU1887
+	.loc 2 1458 3 is_stmt 0 view .LVU1888
+.LBE3741:
+.LBE3799:
+	.loc 1 309 7 is_stmt 1 view .LVU1889
+.LBB3800:
+.LBI3800:
+	.loc 3 166 1 view .LVU1890
+.LBB3801:
+	.loc 3 168 3 view .LVU1891
+.LBE3801:
+.LBE3800:
+.LBB3803:
+.LBB3804:
+# /usr/lib/gcc/x86_64-linux-gnu/12/include/emmintrin.h:1458:   return (__m128i)__builtin_ia32_pshufd ((__v4si)__A, __mask);
+	.loc 2 1458 19 is_stmt 0 view .LVU1892
+	pshufd	$20, %xmm5, %xmm8	#, m2, tmp1795
+.LBE3804:
+.LBE3803:
+.LBB3806:
+.LBB3796:
+# /usr/lib/gcc/x86_64-linux-gnu/12/include/emmintrin.h:1066:   return (__m128i) ((__v4su)__A + (__v4su)__B);
+	.loc 2 1066 33 view .LVU1893
+	paddd	%xmm7, %xmm14	# _687, _730
+.LBE3796:
+.LBE3806:
+.LBB3807:
+.LBB3802:
+# /usr/lib/gcc/x86_64-linux-gnu/12/include/smmintrin.h:168:   return (__m128i) __builtin_ia32_pblendw128 ((__v8hi)__X,
+	.loc 3 168 20 view .LVU1894
+	pblendw	$192, %xmm10, %xmm9	#, tmp1787, tmp1789
+.LVL305:
+	.loc 3 168 20 view .LVU1895
+.LBE3802:
+.LBE3807:
+	.loc 1 309 42 is_stmt 1 view .LVU1896
+	.loc 1 309 51 view .LVU1897
+	.loc 1 309 7 view .LVU1898
+.LBB3808:
+.LBI3632:
+	.loc 3 166 1 view .LVU1899
+.LBB3634:
+	.loc 3 168 3 view .LVU1900
+	.loc 3 168 3 is_stmt 0 view .LVU1901
+.LBE3634:
+.LBE3808:
+	.loc 1 309 42 is_stmt 1 view .LVU1902
+.LBB3809:
+.LBI3803:
+	.loc 2 1456 1 view .LVU1903
+.LBB3805:
+	.loc 2 1458 3 view .LVU1904
+	.loc 2 1458 3 is_stmt 0 view .LVU1905
+.LBE3805:
+.LBE3809:
+	.loc 1 309 7 is_stmt 1 view .LVU1906
+.LBB3810:
+.LBI3810:
+	.loc 3 166 1 view .LVU1907
+.LBB3811:
+	.loc 3 168 3 view .LVU1908
+# /usr/lib/gcc/x86_64-linux-gnu/12/include/smmintrin.h:168:   return (__m128i) __builtin_ia32_pblendw128 ((__v8hi)__X,
+	.loc 3 168 20 is_stmt 0 view .LVU1909
+	pblendw	$240, %xmm8, %xmm13	#, tmp1795, tmp1797
+.LVL306:
+	.loc 3 168 20 view .LVU1910
+.LBE3811:
+.LBE3810:
+	.loc 1 309 42 is_stmt 1 view .LVU1911
+	.loc 1 309 7 view .LVU1912
+	.loc 1 309 7 view .LVU1913
+.LBB3812:
+.LBI3440:
+	.loc 3 166 1 view .LVU1914
+.LBB3442:
+	.loc 3 168 3 view .LVU1915
+	.loc 3 168 3 is_stmt 0 view .LVU1916
+.LBE3442:
+.LBE3812:
+	.loc 1 309 42 is_stmt 1 view .LVU1917
+	.loc 1 309 50 view .LVU1918
+.LBB3813:
+.LBI3454:
+	.loc 3 166 1 view .LVU1919
+.LBB3456:
+	.loc 3 168 3 view .LVU1920
+	.loc 3 168 3 is_stmt 0 view .LVU1921
+.LBE3456:
+.LBE3813:
+	.loc 1 309 13 is_stmt 1 view .LVU1922
+	.loc 1 309 98 view .LVU1923
+	.loc 1 309 103 view .LVU1924
+.LBB3814:
+.LBI3814:
+	.loc 2 1064 1 view .LVU1925
+.LBB3815:
+	.loc 2 1066 3 view .LVU1926
+	.loc 2 1066 3 is_stmt 0 view .LVU1927
+.LBE3815:
+.LBE3814:
+.LBB3816:
+.LBI3794:
+	.loc 2 1064 1 is_stmt 1 view .LVU1928
+.LBB3797:
+	.loc 2 1066 3 view .LVU1929
+	.loc 2 1066 3 is_stmt 0 view .LVU1930
+.LBE3797:
+.LBE3816:
+	.loc 1 309 152 is_stmt 1 view .LVU1931
+.LBB3817:
+.LBI3817:
+	.loc 2 1327 1 view .LVU1932
+.LBB3818:
+	.loc 2 1329 3 view .LVU1933
+	.loc 2 1329 3 is_stmt 0 view .LVU1934
+.LBE3818:
+.LBE3817:
+.LBB3820:
+.LBI3820:
+	.loc 4 136 1 is_stmt 1 view .LVU1935
+.LBB3821:
+	.loc 4 138 3 view .LVU1936
+.LBE3821:
+.LBE3820:
+.LBB3823:
+.LBB3819:
+# /usr/lib/gcc/x86_64-linux-gnu/12/include/emmintrin.h:1329:   return (__m128i) ((__v2du)__A ^ (__v2du)__B);
+	.loc 2 1329 33 is_stmt 0 view .LVU1937
+	pxor	%xmm14, %xmm1	# _730, tmp1807
+.LVL307:
+	.loc 2 1329 33 view .LVU1938
+.LBE3819:
+.LBE3823:
+.LBB3824:
+.LBB3825:
+# /usr/lib/gcc/x86_64-linux-gnu/12/include/emmintrin.h:1458:   return (__m128i)__builtin_ia32_pshufd ((__v4si)__A, __mask);
+	.loc 2 1458 19 view .LVU1939
+	pshufd	$103, %xmm5, %xmm8	#, m2, tmp1864
+.LBE3825:
+.LBE3824:
+.LBB3827:
+.LBB3822:
+# /usr/lib/gcc/x86_64-linux-gnu/12/include/tmmintrin.h:138:   return (__m128i) __builtin_ia32_pshufb128 ((__v16qi)__X, (__v16qi)__Y);
+	.loc 4 138 20 view .LVU1940
+	pshufb	.LC0(%rip), %xmm1	#, tmp1808
+.LVL308:
+	.loc 4 138 20 view .LVU1941
+.LBE3822:
+.LBE3827:
+	.loc 1 309 206 is_stmt 1 view .LVU1942
+.LBB3828:
+.LBI3828:
+	.loc 2 1064 1 view .LVU1943
+.LBB3829:
+	.loc 2 1066 3 view .LVU1944
+# /usr/lib/gcc/x86_64-linux-gnu/12/include/emmintrin.h:1066:   return (__m128i) ((__v4su)__A + (__v4su)__B);
+	.loc 2 1066 33 is_stmt 0 view .LVU1945
+	paddd	%xmm1, %xmm2	# tmp1808, _738
+.LVL309:
+	.loc 2 1066 33 view .LVU1946
+.LBE3829:
+.LBE3828:
+	.loc 1 309 236 is_stmt 1 view .LVU1947
+.LBB3830:
+.LBI3830:
+	.loc 2 1327 1 view .LVU1948
+.LBB3831:
+	.loc 2 1329 3 view .LVU1949
+	.loc 2 1329 3 is_stmt 0 view .LVU1950
+.LBE3831:
+.LBE3830:
+.LBB3833:
+.LBI3833:
+	.loc 2 1184 1 is_stmt 1 view .LVU1951
+.LBB3834:
+	.loc 2 1186 3 view .LVU1952
+.LBE3834:
+.LBE3833:
+.LBB3837:
+.LBB3832:
+# /usr/lib/gcc/x86_64-linux-gnu/12/include/emmintrin.h:1329:   return (__m128i) ((__v2du)__A ^ (__v2du)__B);
+	.loc 2 1329 33 is_stmt 0 view .LVU1953
+	pxor	%xmm2, %xmm0	# _738, tmp1810
+.LVL310:
+	.loc 2 1329 33 view .LVU1954
+.LBE3832:
+.LBE3837:
+.LBB3838:
+.LBB3835:
+# /usr/lib/gcc/x86_64-linux-gnu/12/include/emmintrin.h:1186:   return (__m128i)__builtin_ia32_pslldi128 ((__v4si)__A, __B);
+	.loc 2 1186 19 view .LVU1955
+	movdqa	%xmm0, %xmm11	# tmp1810, tmp1811
+.LBE3835:
+.LBE3838:
+.LBB3839:
+.LBB3840:
+# /usr/lib/gcc/x86_64-linux-gnu/12/include/emmintrin.h:1251:   return (__m128i)__builtin_ia32_psrldi128 ((__v4si)__A, __B);
+	.loc 2 1251 19 view .LVU1956
+	psrld	$12, %xmm0	#, tmp1813
+.LVL311:
+	.loc 2 1251 19 view .LVU1957
+.LBE3840:
+.LBE3839:
+.LBB3842:
+.LBB3836:
+# /usr/lib/gcc/x86_64-linux-gnu/12/include/emmintrin.h:1186:   return (__m128i)__builtin_ia32_pslldi128 ((__v4si)__A, __B);
+	.loc 2 1186 19 view .LVU1958
+	pslld	$20, %xmm11	#, tmp1811
+.LVL312:
+	.loc 2 1186 19 view .LVU1959
+.LBE3836:
+.LBE3842:
+.LBB3843:
+.LBI3839:
+	.loc 2 1249 1 is_stmt 1 view .LVU1960
+.LBB3841:
+	.loc 2 1251 3 view .LVU1961
+	.loc 2 1251 3 is_stmt 0 view .LVU1962
+.LBE3841:
+.LBE3843:
+.LBB3844:
+.LBI3844:
+	.loc 2 1321 1 is_stmt 1 view .LVU1963
+.LBB3845:
+	.loc 2 1323 3 view .LVU1964
+# /usr/lib/gcc/x86_64-linux-gnu/12/include/emmintrin.h:1323:   return (__m128i) ((__v2du)__A | (__v2du)__B);
+	.loc 2 1323 33 is_stmt 0 view .LVU1965
+	por	%xmm11, %xmm0	# tmp1811, _747
+.LVL313:
+	.loc 2 1323 33 view .LVU1966
+.LBE3845:
+.LBE3844:
+	.loc 1 309 343 is_stmt 1 view .LVU1967
+.LBB3846:
+.LBI3846:
+	.loc 2 1064 1 view .LVU1968
+.LBB3847:
+	.loc 2 1066 3 view .LVU1969
+	.loc 2 1066 3 is_stmt 0 view .LVU1970
+.LBE3847:
+.LBE3846:
+.LBB3848:
+.LBI3848:
+	.loc 2 1064 1 is_stmt 1 view .LVU1971
+.LBB3849:
+	.loc 2 1066 3 view .LVU1972
+# /usr/lib/gcc/x86_64-linux-gnu/12/include/emmintrin.h:1066:   return (__m128i) ((__v4su)__A + (__v4su)__B);
+	.loc 2 1066 33 is_stmt 0 view .LVU1973
+	paddd	%xmm0, %xmm9	# _747, tmp1815
+.LVL314:
+	.loc 2 1066 33 view .LVU1974
+	paddd	%xmm14, %xmm9	# _730, _751
+.LVL315:
+	.loc 2 1066 33 view .LVU1975
+.LBE3849:
+.LBE3848:
+	.loc 1 309 392 is_stmt 1 view .LVU1976
+.LBB3850:
+.LBI3850:
+	.loc 2 1327 1 view .LVU1977
+.LBB3851:
+	.loc 2 1329 3 view .LVU1978
+	.loc 2 1329 3 is_stmt 0 view .LVU1979
+.LBE3851:
+.LBE3850:
+.LBB3853:
+.LBI3853:
+	.loc 4 136 1 is_stmt 1 view .LVU1980
+.LBB3854:
+	.loc 4 138 3 view .LVU1981
+.LBE3854:
+.LBE3853:
+.LBB3856:
+.LBB3857:
+# /usr/lib/gcc/x86_64-linux-gnu/12/include/smmintrin.h:168:   return (__m128i) __builtin_ia32_pblendw128 ((__v8hi)__X,
+	.loc 3 168 20 is_stmt 0 view .LVU1982
+	movdqa	-56(%rsp), %xmm14	# %sfp, tmp1449
+.LBE3857:
+.LBE3856:
+.LBB3860:
+.LBB3852:
+# /usr/lib/gcc/x86_64-linux-gnu/12/include/emmintrin.h:1329:   return (__m128i) ((__v2du)__A ^ (__v2du)__B);
+	.loc 2 1329 33 view .LVU1983
+	pxor	%xmm9, %xmm1	# _751, tmp1816
+.LVL316:
+	.loc 2 1329 33 view .LVU1984
+.LBE3852:
+.LBE3860:
+.LBB3861:
+.LBB3855:
+# /usr/lib/gcc/x86_64-linux-gnu/12/include/tmmintrin.h:138:   return (__m128i) __builtin_ia32_pshufb128 ((__v16qi)__X, (__v16qi)__Y);
+	.loc 4 138 20 view .LVU1985
+	pshufb	.LC2(%rip), %xmm1	#, tmp1817
+.LVL317:
+	.loc 4 138 20 view .LVU1986
+.LBE3855:
+.LBE3861:
+	.loc 1 309 445 is_stmt 1 view .LVU1987
+.LBB3862:
+.LBI3862:
+	.loc 2 1064 1 view .LVU1988
+.LBB3863:
+	.loc 2 1066 3 view .LVU1989
+# /usr/lib/gcc/x86_64-linux-gnu/12/include/emmintrin.h:1066:   return (__m128i) ((__v4su)__A + (__v4su)__B);
+	.loc 2 1066 33 is_stmt 0 view .LVU1990
+	paddd	%xmm1, %xmm2	# tmp1817, _758
+.LVL318:
+	.loc 2 1066 33 view .LVU1991
+.LBE3863:
+.LBE3862:
+	.loc 1 309 475 is_stmt 1 view .LVU1992
+.LBB3864:
+.LBI3864:
+	.loc 2 1327 1 view .LVU1993
+.LBB3865:
+	.loc 2 1329 3 view .LVU1994
+	.loc 2 1329 3 is_stmt 0 view .LVU1995
+.LBE3865:
+.LBE3864:
+.LBB3867:
+.LBI3867:
+	.loc 2 1184 1 is_stmt 1 view .LVU1996
+.LBB3868:
+	.loc 2 1186 3 view .LVU1997
+.LBE3868:
+.LBE3867:
+.LBB3871:
+.LBB3872:
+# /usr/lib/gcc/x86_64-linux-gnu/12/include/emmintrin.h:1458:   return (__m128i)__builtin_ia32_pshufd ((__v4si)__A, __mask);
+	.loc 2 1458 19 is_stmt 0 view .LVU1998
+	pshufd	$147, %xmm1, %xmm1	#, tmp1817, tmp1829
+.LVL319:
+	.loc 2 1458 19 view .LVU1999
+.LBE3872:
+.LBE3871:
+.LBB3874:
+.LBB3866:
+# /usr/lib/gcc/x86_64-linux-gnu/12/include/emmintrin.h:1329:   return (__m128i) ((__v2du)__A ^ (__v2du)__B);
+	.loc 2 1329 33 view .LVU2000
+	pxor	%xmm2, %xmm0	# _758, tmp1819
+.LVL320:
+	.loc 2 1329 33 view .LVU2001
+.LBE3866:
+.LBE3874:
+.LBB3875:
+.LBB3876:
+# /usr/lib/gcc/x86_64-linux-gnu/12/include/emmintrin.h:1458:   return (__m128i)__builtin_ia32_pshufd ((__v4si)__A, __mask);
+	.loc 2 1458 19 view .LVU2002
+	pshufd	$78, %xmm2, %xmm2	#, _758, tmp1827
+.LVL321:
+	.loc 2 1458 19 view .LVU2003
+.LBE3876:
+.LBE3875:
+.LBB3878:
+.LBB3869:
+# /usr/lib/gcc/x86_64-linux-gnu/12/include/emmintrin.h:1186:   return (__m128i)__builtin_ia32_pslldi128 ((__v4si)__A, __B);
+	.loc 2 1186 19 view .LVU2004
+	movdqa	%xmm0, %xmm11	# tmp1819, tmp1820
+.LBE3869:
+.LBE3878:
+.LBB3879:
+.LBB3880:
+# /usr/lib/gcc/x86_64-linux-gnu/12/include/emmintrin.h:1251:   return (__m128i)__builtin_ia32_psrldi128 ((__v4si)__A, __B);
+	.loc 2 1251 19 view .LVU2005
+	psrld	$7, %xmm0	#, tmp1822
+.LVL322:
+	.loc 2 1251 19 view .LVU2006
+.LBE3880:
+.LBE3879:
+.LBB3882:
+.LBB3870:
+# /usr/lib/gcc/x86_64-linux-gnu/12/include/emmintrin.h:1186:   return (__m128i)__builtin_ia32_pslldi128 ((__v4si)__A, __B);
+	.loc 2 1186 19 view .LVU2007
+	pslld	$25, %xmm11	#, tmp1820
+.LVL323:
+	.loc 2 1186 19 view .LVU2008
+.LBE3870:
+.LBE3882:
+.LBB3883:
+.LBI3879:
+	.loc 2 1249 1 is_stmt 1 view .LVU2009
+.LBB3881:
+	.loc 2 1251 3 view .LVU2010
+	.loc 2 1251 3 is_stmt 0 view .LVU2011
+.LBE3881:
+.LBE3883:
+.LBB3884:
+.LBI3884:
+	.loc 2 1321 1 is_stmt 1 view .LVU2012
+.LBB3885:
+	.loc 2 1323 3 view .LVU2013
+	.loc 2 1323 3 is_stmt 0 view .LVU2014
+.LBE3885:
+.LBE3884:
+	.loc 1 309 101 is_stmt 1 view .LVU2015
+	.loc 1 309 594 view .LVU2016
+.LBB3887:
+.LBI3887:
+	.loc 2 1456 1 view .LVU2017
+.LBB3888:
+	.loc 2 1458 3 view .LVU2018
+.LBE3888:
+.LBE3887:
+.LBB3890:
+.LBB3886:
+# /usr/lib/gcc/x86_64-linux-gnu/12/include/emmintrin.h:1323:   return (__m128i) ((__v2du)__A | (__v2du)__B);
+	.loc 2 1323 33 is_stmt 0 view .LVU2019
+	por	%xmm11, %xmm0	# tmp1820, tmp1825
+.LVL324:
+	.loc 2 1323 33 view .LVU2020
+.LBE3886:
+.LBE3890:
+.LBB3891:
+.LBB3889:
+# /usr/lib/gcc/x86_64-linux-gnu/12/include/emmintrin.h:1458:   return (__m128i)__builtin_ia32_pshufd ((__v4si)__A, __mask);
+	.loc 2 1458 19 view .LVU2021
+	pshufd	$57, %xmm0, %xmm0	#, tmp1825, tmp1824
+.LVL325:
+	.loc 2 1458 19 view .LVU2022
+.LBE3889:
+.LBE3891:
+	.loc 1 309 7 is_stmt 1 view .LVU2023
+.LBB3892:
+.LBI3875:
+	.loc 2 1456 1 view .LVU2024
+.LBB3877:
+	.loc 2 1458 3 view .LVU2025
+	.loc 2 1458 3 is_stmt 0 view .LVU2026
+.LBE3877:
+.LBE3892:
+	.loc 1 309 7 is_stmt 1 view .LVU2027
+.LBB3893:
+.LBI3871:
+	.loc 2 1456 1 view .LVU2028
+.LBB3873:
+	.loc 2 1458 3 view .LVU2029
+	.loc 2 1458 3 is_stmt 0 view .LVU2030
+.LBE3873:
+.LBE3893:
+	.loc 1 309 7 is_stmt 1 view .LVU2031
+	.loc 1 309 12 view .LVU2032
+.LBB3894:
+.LBI3894:
+	.loc 2 1064 1 view .LVU2033
+.LBB3895:
+	.loc 2 1066 3 view .LVU2034
+	.loc 2 1066 3 is_stmt 0 view .LVU2035
+.LBE3895:
+.LBE3894:
+.LBB3896:
+.LBI3896:
+	.loc 2 1064 1 is_stmt 1 view .LVU2036
+.LBB3897:
+	.loc 2 1066 3 view .LVU2037
+# /usr/lib/gcc/x86_64-linux-gnu/12/include/emmintrin.h:1066:   return (__m128i) ((__v4su)__A + (__v4su)__B);
+	.loc 2 1066 33 is_stmt 0 view .LVU2038
+	paddd	%xmm0, %xmm13	# tmp1824, tmp1831
+.LVL326:
+	.loc 2 1066 33 view .LVU2039
+	paddd	%xmm9, %xmm13	# _751, _776
+.LVL327:
+	.loc 2 1066 33 view .LVU2040
+.LBE3897:
+.LBE3896:
+	.loc 1 309 61 is_stmt 1 view .LVU2041
+.LBB3898:
+.LBI3898:
+	.loc 2 1327 1 view .LVU2042
+.LBB3899:
+	.loc 2 1329 3 view .LVU2043
+	.loc 2 1329 3 is_stmt 0 view .LVU2044
+.LBE3899:
+.LBE3898:
+.LBB3901:
+.LBI3901:
+	.loc 4 136 1 is_stmt 1 view .LVU2045
+.LBB3902:
+	.loc 4 138 3 view .LVU2046
+.LBE3902:
+.LBE3901:
+.LBB3904:
+.LBB3900:
+# /usr/lib/gcc/x86_64-linux-gnu/12/include/emmintrin.h:1329:   return (__m128i) ((__v2du)__A ^ (__v2du)__B);
+	.loc 2 1329 33 is_stmt 0 view .LVU2047
+	pxor	%xmm13, %xmm1	# _776, tmp1832
+.LVL328:
+	.loc 2 1329 33 view .LVU2048
+.LBE3900:
+.LBE3904:
+.LBB3905:
+.LBB3903:
+# /usr/lib/gcc/x86_64-linux-gnu/12/include/tmmintrin.h:138:   return (__m128i) __builtin_ia32_pshufb128 ((__v16qi)__X, (__v16qi)__Y);
+	.loc 4 138 20 view .LVU2049
+	pshufb	.LC0(%rip), %xmm1	#, tmp1833
+.LVL329:
+	.loc 4 138 20 view .LVU2050
+.LBE3903:
+.LBE3905:
+	.loc 1 309 115 is_stmt 1 view .LVU2051
+.LBB3906:
+.LBI3906:
+	.loc 2 1064 1 view .LVU2052
+.LBB3907:
+	.loc 2 1066 3 view .LVU2053
+# /usr/lib/gcc/x86_64-linux-gnu/12/include/emmintrin.h:1066:   return (__m128i) ((__v4su)__A + (__v4su)__B);
+	.loc 2 1066 33 is_stmt 0 view .LVU2054
+	paddd	%xmm1, %xmm2	# tmp1833, _784
+.LVL330:
+	.loc 2 1066 33 view .LVU2055
+.LBE3907:
+.LBE3906:
+	.loc 1 309 145 is_stmt 1 view .LVU2056
+.LBB3908:
+.LBI3908:
+	.loc 2 1327 1 view .LVU2057
+.LBB3909:
+	.loc 2 1329 3 view .LVU2058
+	.loc 2 1329 3 is_stmt 0 view .LVU2059
+.LBE3909:
+.LBE3908:
+.LBB3911:
+.LBI3911:
+	.loc 2 1184 1 is_stmt 1 view .LVU2060
+.LBB3912:
+	.loc 2 1186 3 view .LVU2061
+.LBE3912:
+.LBE3911:
+.LBB3915:
+.LBB3910:
+# /usr/lib/gcc/x86_64-linux-gnu/12/include/emmintrin.h:1329:   return (__m128i) ((__v2du)__A ^ (__v2du)__B);
+	.loc 2 1329 33 is_stmt 0 view .LVU2062
+	pxor	%xmm2, %xmm0	# _784, tmp1835
+.LVL331:
+	.loc 2 1329 33 view .LVU2063
+.LBE3910:
+.LBE3915:
+.LBB3916:
+.LBB3913:
+# /usr/lib/gcc/x86_64-linux-gnu/12/include/emmintrin.h:1186:   return (__m128i)__builtin_ia32_pslldi128 ((__v4si)__A, __B);
+	.loc 2 1186 19 view .LVU2064
+	movdqa	%xmm0, %xmm11	# tmp1835, tmp1836
+.LBE3913:
+.LBE3916:
+.LBB3917:
+.LBB3918:
+# /usr/lib/gcc/x86_64-linux-gnu/12/include/emmintrin.h:1251:   return (__m128i)__builtin_ia32_psrldi128 ((__v4si)__A, __B);
+	.loc 2 1251 19 view .LVU2065
+	psrld	$12, %xmm0	#, tmp1838
+.LVL332:
+	.loc 2 1251 19 view .LVU2066
+.LBE3918:
+.LBE3917:
+.LBB3920:
+.LBB3914:
+# /usr/lib/gcc/x86_64-linux-gnu/12/include/emmintrin.h:1186:   return (__m128i)__builtin_ia32_pslldi128 ((__v4si)__A, __B);
+	.loc 2 1186 19 view .LVU2067
+	pslld	$20, %xmm11	#, tmp1836
+.LVL333:
+	.loc 2 1186 19 view .LVU2068
+.LBE3914:
+.LBE3920:
+.LBB3921:
+.LBI3917:
+	.loc 2 1249 1 is_stmt 1 view .LVU2069
+.LBB3919:
+	.loc 2 1251 3 view .LVU2070
+	.loc 2 1251 3 is_stmt 0 view .LVU2071
+.LBE3919:
+.LBE3921:
+.LBB3922:
+.LBI3922:
+	.loc 2 1321 1 is_stmt 1 view .LVU2072
+.LBB3923:
+	.loc 2 1323 3 view .LVU2073
+# /usr/lib/gcc/x86_64-linux-gnu/12/include/emmintrin.h:1323:   return (__m128i) ((__v2du)__A | (__v2du)__B);
+	.loc 2 1323 33 is_stmt 0 view .LVU2074
+	por	%xmm11, %xmm0	# tmp1836, _793
+.LVL334:
+	.loc 2 1323 33 view .LVU2075
+.LBE3923:
+.LBE3922:
+	.loc 1 309 252 is_stmt 1 view .LVU2076
+.LBB3924:
+.LBI3924:
+	.loc 2 1064 1 view .LVU2077
+.LBB3925:
+	.loc 2 1066 3 view .LVU2078
+	.loc 2 1066 3 is_stmt 0 view .LVU2079
+.LBE3925:
+.LBE3924:
+.LBB3926:
+.LBI3926:
+	.loc 2 1064 1 is_stmt 1 view .LVU2080
+.LBB3927:
+	.loc 2 1066 3 view .LVU2081
+# /usr/lib/gcc/x86_64-linux-gnu/12/include/emmintrin.h:1066:   return (__m128i) ((__v4su)__A + (__v4su)__B);
+	.loc 2 1066 33 is_stmt 0 view .LVU2082
+	paddd	%xmm0, %xmm15	# _793, tmp1840
+.LVL335:
+	.loc 2 1066 33 view .LVU2083
+	paddd	%xmm13, %xmm15	# _776, _797
+.LVL336:
+	.loc 2 1066 33 view .LVU2084
+.LBE3927:
+.LBE3926:
+	.loc 1 309 301 is_stmt 1 view .LVU2085
+.LBB3928:
+.LBI3928:
+	.loc 2 1327 1 view .LVU2086
+.LBB3929:
+	.loc 2 1329 3 view .LVU2087
+	.loc 2 1329 3 is_stmt 0 view .LVU2088
+.LBE3929:
+.LBE3928:
+.LBB3931:
+.LBI3931:
+	.loc 4 136 1 is_stmt 1 view .LVU2089
+.LBB3932:
+	.loc 4 138 3 view .LVU2090
+.LBE3932:
+.LBE3931:
+.LBB3934:
+.LBB3935:
+# /usr/lib/gcc/x86_64-linux-gnu/12/include/emmintrin.h:1458:   return (__m128i)__builtin_ia32_pshufd ((__v4si)__A, __mask);
+	.loc 2 1458 19 is_stmt 0 view .LVU2091
+	pshufd	$197, %xmm6, %xmm13	#, m3, tmp1856
+.LBE3935:
+.LBE3934:
+.LBB3937:
+.LBB3930:
+# /usr/lib/gcc/x86_64-linux-gnu/12/include/emmintrin.h:1329:   return (__m128i) ((__v2du)__A ^ (__v2du)__B);
+	.loc 2 1329 33 view .LVU2092
+	pxor	%xmm15, %xmm1	# _797, tmp1841
+.LVL337:
+	.loc 2 1329 33 view .LVU2093
+.LBE3930:
+.LBE3937:
+.LBB3938:
+.LBB3939:
+# /usr/lib/gcc/x86_64-linux-gnu/12/include/smmintrin.h:168:   return (__m128i) __builtin_ia32_pblendw128 ((__v8hi)__X,
+	.loc 3 168 20 view .LVU2094
+	pblendw	$12, %xmm12, %xmm13	#, tmp1702, tmp1858
+.LBE3939:
+.LBE3938:
+.LBB3941:
+.LBB3942:
+# /usr/lib/gcc/x86_64-linux-gnu/12/include/emmintrin.h:1458:   return (__m128i)__builtin_ia32_pshufd ((__v4si)__A, __mask);
+	.loc 2 1458 19 view .LVU2095
+	pshufd	$232, %xmm6, %xmm12	#, m3, tmp1866
+.LBE3942:
+.LBE3941:
+.LBB3944:
+.LBB3933:
+# /usr/lib/gcc/x86_64-linux-gnu/12/include/tmmintrin.h:138:   return (__m128i) __builtin_ia32_pshufb128 ((__v16qi)__X, (__v16qi)__Y);
+	.loc 4 138 20 view .LVU2096
+	pshufb	.LC2(%rip), %xmm1	#, tmp1842
+.LVL338:
+	.loc 4 138 20 view .LVU2097
+.LBE3933:
+.LBE3944:
+	.loc 1 309 354 is_stmt 1 view .LVU2098
+.LBB3945:
+.LBI3945:
+	.loc 2 1064 1 view .LVU2099
+.LBB3946:
+	.loc 2 1066 3 view .LVU2100
+.LBE3946:
+.LBE3945:
+.LBB3948:
+.LBB3949:
+# /usr/lib/gcc/x86_64-linux-gnu/12/include/smmintrin.h:168:   return (__m128i) __builtin_ia32_pblendw128 ((__v8hi)__X,
+	.loc 3 168 20 is_stmt 0 view .LVU2101
+	pblendw	$192, %xmm3, %xmm13	#, m0, tmp1861
+.LBE3949:
+.LBE3948:
+.LBB3951:
+.LBB3952:
+	pblendw	$12, %xmm12, %xmm8	#, tmp1866, tmp1868
+.LBE3952:
+.LBE3951:
+.LBB3954:
+.LBB3947:
+# /usr/lib/gcc/x86_64-linux-gnu/12/include/emmintrin.h:1066:   return (__m128i) ((__v4su)__A + (__v4su)__B);
+	.loc 2 1066 33 view .LVU2102
+	paddd	%xmm1, %xmm2	# tmp1842, _804
+.LVL339:
+	.loc 2 1066 33 view .LVU2103
+.LBE3947:
+.LBE3954:
+	.loc 1 309 384 is_stmt 1 view .LVU2104
+.LBB3955:
+.LBI3955:
+	.loc 2 1327 1 view .LVU2105
+.LBB3956:
+	.loc 2 1329 3 view .LVU2106
+	.loc 2 1329 3 is_stmt 0 view .LVU2107
+.LBE3956:
+.LBE3955:
+.LBB3958:
+.LBI3958:
+	.loc 2 1184 1 is_stmt 1 view .LVU2108
+.LBB3959:
+	.loc 2 1186 3 view .LVU2109
+.LBE3959:
+.LBE3958:
+.LBB3962:
+.LBB3963:
+# /usr/lib/gcc/x86_64-linux-gnu/12/include/emmintrin.h:1458:   return (__m128i)__builtin_ia32_pshufd ((__v4si)__A, __mask);
+	.loc 2 1458 19 is_stmt 0 view .LVU2110
+	pshufd	$57, %xmm1, %xmm1	#, tmp1842, tmp1854
+.LVL340:
+	.loc 2 1458 19 view .LVU2111
+.LBE3963:
+.LBE3962:
+.LBB3965:
+.LBB3858:
+# /usr/lib/gcc/x86_64-linux-gnu/12/include/smmintrin.h:168:   return (__m128i) __builtin_ia32_pblendw128 ((__v8hi)__X,
+	.loc 3 168 20 view .LVU2112
+	pblendw	$48, %xmm14, %xmm8	#, tmp1449, tmp1871
+.LBE3858:
+.LBE3965:
+.LBB3966:
+.LBB3957:
+# /usr/lib/gcc/x86_64-linux-gnu/12/include/emmintrin.h:1329:   return (__m128i) ((__v2du)__A ^ (__v2du)__B);
+	.loc 2 1329 33 view .LVU2113
+	pxor	%xmm2, %xmm0	# _804, tmp1844
+.LVL341:
+	.loc 2 1329 33 view .LVU2114
+.LBE3957:
+.LBE3966:
+.LBB3967:
+.LBB3968:
+# /usr/lib/gcc/x86_64-linux-gnu/12/include/emmintrin.h:1458:   return (__m128i)__builtin_ia32_pshufd ((__v4si)__A, __mask);
+	.loc 2 1458 19 view .LVU2115
+	pshufd	$78, %xmm2, %xmm2	#, _804, tmp1852
+.LVL342:
+	.loc 2 1458 19 view .LVU2116
+.LBE3968:
+.LBE3967:
+.LBB3970:
+.LBB3960:
+# /usr/lib/gcc/x86_64-linux-gnu/12/include/emmintrin.h:1186:   return (__m128i)__builtin_ia32_pslldi128 ((__v4si)__A, __B);
+	.loc 2 1186 19 view .LVU2117
+	movdqa	%xmm0, %xmm11	# tmp1844, tmp1845
+.LBE3960:
+.LBE3970:
+.LBB3971:
+.LBB3972:
+# /usr/lib/gcc/x86_64-linux-gnu/12/include/emmintrin.h:1251:   return (__m128i)__builtin_ia32_psrldi128 ((__v4si)__A, __B);
+	.loc 2 1251 19 view .LVU2118
+	psrld	$7, %xmm0	#, tmp1847
+.LVL343:
+	.loc 2 1251 19 view .LVU2119
+.LBE3972:
+.LBE3971:
+.LBB3974:
+.LBB3961:
+# /usr/lib/gcc/x86_64-linux-gnu/12/include/emmintrin.h:1186:   return (__m128i)__builtin_ia32_pslldi128 ((__v4si)__A, __B);
+	.loc 2 1186 19 view .LVU2120
+	pslld	$25, %xmm11	#, tmp1845
+.LVL344:
+	.loc 2 1186 19 view .LVU2121
+.LBE3961:
+.LBE3974:
+.LBB3975:
+.LBI3971:
+	.loc 2 1249 1 is_stmt 1 view .LVU2122
+.LBB3973:
+	.loc 2 1251 3 view .LVU2123
+	.loc 2 1251 3 is_stmt 0 view .LVU2124
+.LBE3973:
+.LBE3975:
+.LBB3976:
+.LBI3976:
+	.loc 2 1321 1 is_stmt 1 view .LVU2125
+.LBB3977:
+	.loc 2 1323 3 view .LVU2126
+	.loc 2 1323 3 is_stmt 0 view .LVU2127
+.LBE3977:
+.LBE3976:
+	.loc 1 309 10 is_stmt 1 view .LVU2128
+	.loc 1 309 503 view .LVU2129
+.LBB3979:
+.LBI3979:
+	.loc 2 1456 1 view .LVU2130
+.LBB3980:
+	.loc 2 1458 3 view .LVU2131
+.LBE3980:
+.LBE3979:
+.LBB3982:
+.LBB3978:
+# /usr/lib/gcc/x86_64-linux-gnu/12/include/emmintrin.h:1323:   return (__m128i) ((__v2du)__A | (__v2du)__B);
+	.loc 2 1323 33 is_stmt 0 view .LVU2132
+	por	%xmm11, %xmm0	# tmp1845, tmp1850
+.LVL345:
+	.loc 2 1323 33 view .LVU2133
+.LBE3978:
+.LBE3982:
+.LBB3983:
+.LBB3984:
+# /usr/lib/gcc/x86_64-linux-gnu/12/include/smmintrin.h:168:   return (__m128i) __builtin_ia32_pblendw128 ((__v8hi)__X,
+	.loc 3 168 20 view .LVU2134
+	movdqa	%xmm4, %xmm11	# m1, tmp1874
+.LBE3984:
+.LBE3983:
+.LBB3987:
+.LBB3981:
+# /usr/lib/gcc/x86_64-linux-gnu/12/include/emmintrin.h:1458:   return (__m128i)__builtin_ia32_pshufd ((__v4si)__A, __mask);
+	.loc 2 1458 19 view .LVU2135
+	pshufd	$147, %xmm0, %xmm0	#, tmp1850, tmp1849
+.LVL346:
+	.loc 2 1458 19 view .LVU2136
+.LBE3981:
+.LBE3987:
+	.loc 1 309 7 is_stmt 1 view .LVU2137
+.LBB3988:
+.LBI3967:
+	.loc 2 1456 1 view .LVU2138
+.LBB3969:
+	.loc 2 1458 3 view .LVU2139
+	.loc 2 1458 3 is_stmt 0 view .LVU2140
+.LBE3969:
+.LBE3988:
+	.loc 1 309 7 is_stmt 1 view .LVU2141
+.LBB3989:
+.LBI3962:
+	.loc 2 1456 1 view .LVU2142
+.LBB3964:
+	.loc 2 1458 3 view .LVU2143
+	.loc 2 1458 3 is_stmt 0 view .LVU2144
+.LBE3964:
+.LBE3989:
+	.loc 1 309 8 is_stmt 1 view .LVU2145
+	.loc 1 310 5 view .LVU2146
+	.loc 1 310 10 view .LVU2147
+	.loc 1 310 15 view .LVU2148
+.LBB3990:
+.LBI3934:
+	.loc 2 1456 1 view .LVU2149
+.LBB3936:
+	.loc 2 1458 3 view .LVU2150
+	.loc 2 1458 3 is_stmt 0 view .LVU2151
+.LBE3936:
+.LBE3990:
+	.loc 1 310 7 is_stmt 1 view .LVU2152
+	.loc 1 310 7 view .LVU2153
+.LBB3991:
+.LBI3938:
+	.loc 3 166 1 view .LVU2154
+.LBB3940:
+	.loc 3 168 3 view .LVU2155
+	.loc 3 168 3 is_stmt 0 view .LVU2156
+.LBE3940:
+.LBE3991:
+	.loc 1 310 42 is_stmt 1 view .LVU2157
+	.loc 1 310 50 view .LVU2158
+.LBB3992:
+.LBI3948:
+	.loc 3 166 1 view .LVU2159
+.LBB3950:
+	.loc 3 168 3 view .LVU2160
+	.loc 3 168 3 is_stmt 0 view .LVU2161
+.LBE3950:
+.LBE3992:
+	.loc 1 310 85 is_stmt 1 view .LVU2162
+.LBB3993:
+.LBI3824:
+	.loc 2 1456 1 view .LVU2163
+.LBB3826:
+	.loc 2 1458 3 view .LVU2164
+	.loc 2 1458 3 is_stmt 0 view .LVU2165
+.LBE3826:
+.LBE3993:
+	.loc 1 310 7 is_stmt 1 view .LVU2166
+.LBB3994:
+.LBI3941:
+	.loc 2 1456 1 view .LVU2167
+.LBB3943:
+	.loc 2 1458 3 view .LVU2168
+	.loc 2 1458 3 is_stmt 0 view .LVU2169
+.LBE3943:
+.LBE3994:
+	.loc 1 310 7 is_stmt 1 view .LVU2170
+.LBB3995:
+.LBI3951:
+	.loc 3 166 1 view .LVU2171
+.LBB3953:
+	.loc 3 168 3 view .LVU2172
+	.loc 3 168 3 is_stmt 0 view .LVU2173
+.LBE3953:
+.LBE3995:
+	.loc 1 310 42 is_stmt 1 view .LVU2174
+	.loc 1 310 7 view .LVU2175
+.LBB3996:
+.LBI3856:
+	.loc 3 166 1 view .LVU2176
+.LBB3859:
+	.loc 3 168 3 view .LVU2177
+	.loc 3 168 3 is_stmt 0 view .LVU2178
+.LBE3859:
+.LBE3996:
+	.loc 1 310 42 is_stmt 1 view .LVU2179
+.LBB3997:
+.LBI3983:
+	.loc 3 166 1 view .LVU2180
+.LBB3985:
+	.loc 3 168 3 view .LVU2181
+# /usr/lib/gcc/x86_64-linux-gnu/12/include/smmintrin.h:168:   return (__m128i) __builtin_ia32_pblendw128 ((__v8hi)__X,
+	.loc 3 168 20 is_stmt 0 view .LVU2182
+	pblendw	$192, %xmm6, %xmm11	#, m3, tmp1874
+.LBE3985:
+.LBE3997:
+.LBB3998:
+.LBB3999:
+# /usr/lib/gcc/x86_64-linux-gnu/12/include/emmintrin.h:1066:   return (__m128i) ((__v4su)__A + (__v4su)__B);
+	.loc 2 1066 33 view .LVU2183
+	paddd	%xmm0, %xmm13	# tmp1849, tmp1891
+.LVL347:
+	.loc 2 1066 33 view .LVU2184
+.LBE3999:
+.LBE3998:
+.LBB4002:
+.LBB3986:
+# /usr/lib/gcc/x86_64-linux-gnu/12/include/smmintrin.h:168:   return (__m128i) __builtin_ia32_pblendw128 ((__v8hi)__X,
+	.loc 3 168 20 view .LVU2185
+	movdqa	%xmm11, %xmm7	# tmp1874, tmp1874
+.LVL348:
+	.loc 3 168 20 view .LVU2186
+.LBE3986:
+.LBE4002:
+	.loc 1 310 78 is_stmt 1 view .LVU2187
+.LBB4003:
+.LBI4003:
+	.loc 3 166 1 view .LVU2188
+.LBB4004:
+	.loc 3 168 3 view .LVU2189
+.LBE4004:
+.LBE4003:
+.LBB4006:
+.LBB4007:
+# /usr/lib/gcc/x86_64-linux-gnu/12/include/smmintrin.h:168:   return (__m128i) __builtin_ia32_pblendw128 ((__v8hi)__X,
+	.loc 3 168 20 is_stmt 0 view .LVU2190
+	movdqa	%xmm3, %xmm11	# m0, tmp1885
+.LBE4007:
+.LBE4006:
+.LBB4010:
+.LBB4000:
+# /usr/lib/gcc/x86_64-linux-gnu/12/include/emmintrin.h:1066:   return (__m128i) ((__v4su)__A + (__v4su)__B);
+	.loc 2 1066 33 view .LVU2191
+	paddd	%xmm15, %xmm13	# _797, _839
+.LBE4000:
+.LBE4010:
+.LBB4011:
+.LBB4005:
+# /usr/lib/gcc/x86_64-linux-gnu/12/include/smmintrin.h:168:   return (__m128i) __builtin_ia32_pblendw128 ((__v8hi)__X,
+	.loc 3 168 20 view .LVU2192
+	pblendw	$3, %xmm5, %xmm7	#, m2, tmp1877
+.LVL349:
+	.loc 3 168 20 view .LVU2193
+.LBE4005:
+.LBE4011:
+	.loc 1 310 114 is_stmt 1 view .LVU2194
+.LBB4012:
+.LBI4012:
+	.loc 3 166 1 view .LVU2195
+.LBB4013:
+	.loc 3 168 3 view .LVU2196
+.LBE4013:
+.LBE4012:
+.LBB4015:
+.LBB4008:
+# /usr/lib/gcc/x86_64-linux-gnu/12/include/smmintrin.h:168:   return (__m128i) __builtin_ia32_pblendw128 ((__v8hi)__X,
+	.loc 3 168 20 is_stmt 0 view .LVU2197
+	pblendw	$60, -104(%rsp), %xmm11	#, %sfp, tmp1885
+.LBE4008:
+.LBE4015:
+.LBB4016:
+.LBB4017:
+# /usr/lib/gcc/x86_64-linux-gnu/12/include/emmintrin.h:1329:   return (__m128i) ((__v2du)__A ^ (__v2du)__B);
+	.loc 2 1329 33 view .LVU2198
+	pxor	%xmm13, %xmm1	# _839, tmp1892
+.LVL350:
+	.loc 2 1329 33 view .LVU2199
+.LBE4017:
+.LBE4016:
+.LBB4019:
+.LBB4014:
+# /usr/lib/gcc/x86_64-linux-gnu/12/include/smmintrin.h:168:   return (__m128i) __builtin_ia32_pblendw128 ((__v8hi)__X,
+	.loc 3 168 20 view .LVU2200
+	pblendw	$48, %xmm3, %xmm7	#, m0, tmp1880
+.LVL351:
+	.loc 3 168 20 view .LVU2201
+.LBE4014:
+.LBE4019:
+	.loc 1 310 150 is_stmt 1 view .LVU2202
+.LBB4020:
+.LBI4020:
+	.loc 2 1456 1 view .LVU2203
+.LBB4021:
+	.loc 2 1458 3 view .LVU2204
+.LBE4021:
+.LBE4020:
+.LBB4023:
+.LBB4024:
+# /usr/lib/gcc/x86_64-linux-gnu/12/include/smmintrin.h:168:   return (__m128i) __builtin_ia32_pblendw128 ((__v8hi)__X,
+	.loc 3 168 20 is_stmt 0 view .LVU2205
+	pblendw	$192, %xmm10, %xmm11	#, tmp1787, tmp1888
+.LBE4024:
+.LBE4023:
+.LBB4026:
+.LBB4027:
+# /usr/lib/gcc/x86_64-linux-gnu/12/include/tmmintrin.h:138:   return (__m128i) __builtin_ia32_pshufb128 ((__v16qi)__X, (__v16qi)__Y);
+	.loc 4 138 20 view .LVU2206
+	pshufb	.LC0(%rip), %xmm1	#, tmp1893
+.LBE4027:
+.LBE4026:
+.LBB4029:
+.LBB4022:
+# /usr/lib/gcc/x86_64-linux-gnu/12/include/emmintrin.h:1458:   return (__m128i)__builtin_ia32_pshufd ((__v4si)__A, __mask);
+	.loc 2 1458 19 view .LVU2207
+	pshufd	$141, %xmm7, %xmm7	#, tmp1880, tmp1883
+.LVL352:
+	.loc 2 1458 19 view .LVU2208
+.LBE4022:
+.LBE4029:
+	.loc 1 310 7 is_stmt 1 view .LVU2209
+	.loc 1 310 16 view .LVU2210
+	.loc 1 310 7 view .LVU2211
+.LBB4030:
+.LBI4006:
+	.loc 3 166 1 view .LVU2212
+.LBB4009:
+	.loc 3 168 3 view .LVU2213
+	.loc 3 168 3 is_stmt 0 view .LVU2214
+.LBE4009:
+.LBE4030:
+	.loc 1 310 42 is_stmt 1 view .LVU2215
+	.loc 1 310 7 view .LVU2216
+.LBB4031:
+.LBI4023:
+	.loc 3 166 1 view .LVU2217
+.LBB4025:
+	.loc 3 168 3 view .LVU2218
+	.loc 3 168 3 is_stmt 0 view .LVU2219
+.LBE4025:
+.LBE4031:
+	.loc 1 310 13 is_stmt 1 view .LVU2220
+	.loc 1 310 55 view .LVU2221
+	.loc 1 310 60 view .LVU2222
+.LBB4032:
+.LBI4032:
+	.loc 2 1064 1 view .LVU2223
+.LBB4033:
+	.loc 2 1066 3 view .LVU2224
+	.loc 2 1066 3 is_stmt 0 view .LVU2225
+.LBE4033:
+.LBE4032:
+.LBB4034:
+.LBI3998:
+	.loc 2 1064 1 is_stmt 1 view .LVU2226
+.LBB4001:
+	.loc 2 1066 3 view .LVU2227
+	.loc 2 1066 3 is_stmt 0 view .LVU2228
+.LBE4001:
+.LBE4034:
+	.loc 1 310 109 is_stmt 1 view .LVU2229
+.LBB4035:
+.LBI4016:
+	.loc 2 1327 1 view .LVU2230
+.LBB4018:
+	.loc 2 1329 3 view .LVU2231
+	.loc 2 1329 3 is_stmt 0 view .LVU2232
+.LBE4018:
+.LBE4035:
+.LBB4036:
+.LBI4026:
+	.loc 4 136 1 is_stmt 1 view .LVU2233
+.LBB4028:
+	.loc 4 138 3 view .LVU2234
+	.loc 4 138 3 is_stmt 0 view .LVU2235
+.LBE4028:
+.LBE4036:
+	.loc 1 310 163 is_stmt 1 view .LVU2236
+.LBB4037:
+.LBI4037:
+	.loc 2 1064 1 view .LVU2237
+.LBB4038:
+	.loc 2 1066 3 view .LVU2238
+# /usr/lib/gcc/x86_64-linux-gnu/12/include/emmintrin.h:1066:   return (__m128i) ((__v4su)__A + (__v4su)__B);
+	.loc 2 1066 33 is_stmt 0 view .LVU2239
+	paddd	%xmm1, %xmm2	# tmp1893, _847
+.LVL353:
+	.loc 2 1066 33 view .LVU2240
+.LBE4038:
+.LBE4037:
+	.loc 1 310 193 is_stmt 1 view .LVU2241
+.LBB4039:
+.LBI4039:
+	.loc 2 1327 1 view .LVU2242
+.LBB4040:
+	.loc 2 1329 3 view .LVU2243
+	.loc 2 1329 3 is_stmt 0 view .LVU2244
+.LBE4040:
+.LBE4039:
+.LBB4042:
+.LBI4042:
+	.loc 2 1184 1 is_stmt 1 view .LVU2245
+.LBB4043:
+	.loc 2 1186 3 view .LVU2246
+.LBE4043:
+.LBE4042:
+.LBB4046:
+.LBB4041:
+# /usr/lib/gcc/x86_64-linux-gnu/12/include/emmintrin.h:1329:   return (__m128i) ((__v2du)__A ^ (__v2du)__B);
+	.loc 2 1329 33 is_stmt 0 view .LVU2247
+	pxor	%xmm2, %xmm0	# _847, tmp1895
+.LVL354:
+	.loc 2 1329 33 view .LVU2248
+.LBE4041:
+.LBE4046:
+.LBB4047:
+.LBB4044:
+# /usr/lib/gcc/x86_64-linux-gnu/12/include/emmintrin.h:1186:   return (__m128i)__builtin_ia32_pslldi128 ((__v4si)__A, __B);
+	.loc 2 1186 19 view .LVU2249
+	movdqa	%xmm0, %xmm9	# tmp1895, tmp1896
+.LBE4044:
+.LBE4047:
+.LBB4048:
+.LBB4049:
+# /usr/lib/gcc/x86_64-linux-gnu/12/include/emmintrin.h:1251:   return (__m128i)__builtin_ia32_psrldi128 ((__v4si)__A, __B);
+	.loc 2 1251 19 view .LVU2250
+	psrld	$12, %xmm0	#, tmp1898
+.LVL355:
+	.loc 2 1251 19 view .LVU2251
+.LBE4049:
+.LBE4048:
+.LBB4051:
+.LBB4045:
+# /usr/lib/gcc/x86_64-linux-gnu/12/include/emmintrin.h:1186:   return (__m128i)__builtin_ia32_pslldi128 ((__v4si)__A, __B);
+	.loc 2 1186 19 view .LVU2252
+	pslld	$20, %xmm9	#, tmp1896
+.LVL356:
+	.loc 2 1186 19 view .LVU2253
+.LBE4045:
+.LBE4051:
+.LBB4052:
+.LBI4048:
+	.loc 2 1249 1 is_stmt 1 view .LVU2254
+.LBB4050:
+	.loc 2 1251 3 view .LVU2255
+	.loc 2 1251 3 is_stmt 0 view .LVU2256
+.LBE4050:
+.LBE4052:
+.LBB4053:
+.LBI4053:
+	.loc 2 1321 1 is_stmt 1 view .LVU2257
+.LBB4054:
+	.loc 2 1323 3 view .LVU2258
+# /usr/lib/gcc/x86_64-linux-gnu/12/include/emmintrin.h:1323:   return (__m128i) ((__v2du)__A | (__v2du)__B);
+	.loc 2 1323 33 is_stmt 0 view .LVU2259
+	por	%xmm9, %xmm0	# tmp1896, _856
+.LVL357:
+	.loc 2 1323 33 view .LVU2260
+.LBE4054:
+.LBE4053:
+	.loc 1 310 300 is_stmt 1 view .LVU2261
+.LBB4055:
+.LBI4055:
+	.loc 2 1064 1 view .LVU2262
+.LBB4056:
+	.loc 2 1066 3 view .LVU2263
+	.loc 2 1066 3 is_stmt 0 view .LVU2264
+.LBE4056:
+.LBE4055:
+.LBB4057:
+.LBI4057:
+	.loc 2 1064 1 is_stmt 1 view .LVU2265
+.LBB4058:
+	.loc 2 1066 3 view .LVU2266
+# /usr/lib/gcc/x86_64-linux-gnu/12/include/emmintrin.h:1066:   return (__m128i) ((__v4su)__A + (__v4su)__B);
+	.loc 2 1066 33 is_stmt 0 view .LVU2267
+	paddd	%xmm0, %xmm8	# _856, tmp1900
+.LVL358:
+	.loc 2 1066 33 view .LVU2268
+	paddd	%xmm13, %xmm8	# _839, _860
+.LVL359:
+	.loc 2 1066 33 view .LVU2269
+.LBE4058:
+.LBE4057:
+	.loc 1 310 349 is_stmt 1 view .LVU2270
+.LBB4059:
+.LBI4059:
+	.loc 2 1327 1 view .LVU2271
+.LBB4060:
+	.loc 2 1329 3 view .LVU2272
+	.loc 2 1329 3 is_stmt 0 view .LVU2273
+.LBE4060:
+.LBE4059:
+.LBB4062:
+.LBI4062:
+	.loc 4 136 1 is_stmt 1 view .LVU2274
+.LBB4063:
+	.loc 4 138 3 view .LVU2275
+.LBE4063:
+.LBE4062:
+.LBB4065:
+.LBB4066:
+# /usr/lib/gcc/x86_64-linux-gnu/12/include/smmintrin.h:168:   return (__m128i) __builtin_ia32_pblendw128 ((__v8hi)__X,
+	.loc 3 168 20 is_stmt 0 view .LVU2276
+	movdqa	%xmm6, %xmm13	# m3, tmp1962
+.LBE4066:
+.LBE4065:
+.LBB4069:
+.LBB4061:
+# /usr/lib/gcc/x86_64-linux-gnu/12/include/emmintrin.h:1329:   return (__m128i) ((__v2du)__A ^ (__v2du)__B);
+	.loc 2 1329 33 view .LVU2277
+	pxor	%xmm8, %xmm1	# _860, tmp1901
+.LVL360:
+	.loc 2 1329 33 view .LVU2278
+.LBE4061:
+.LBE4069:
+.LBB4070:
+.LBB4067:
+# /usr/lib/gcc/x86_64-linux-gnu/12/include/smmintrin.h:168:   return (__m128i) __builtin_ia32_pblendw128 ((__v8hi)__X,
+	.loc 3 168 20 view .LVU2279
+	pblendw	$48, %xmm14, %xmm13	#, tmp1449, tmp1962
+.LBE4067:
+.LBE4070:
+.LBB4071:
+.LBB4064:
+# /usr/lib/gcc/x86_64-linux-gnu/12/include/tmmintrin.h:138:   return (__m128i) __builtin_ia32_pshufb128 ((__v16qi)__X, (__v16qi)__Y);
+	.loc 4 138 20 view .LVU2280
+	pshufb	.LC2(%rip), %xmm1	#, tmp1902
+.LVL361:
+	.loc 4 138 20 view .LVU2281
+.LBE4064:
+.LBE4071:
+	.loc 1 310 402 is_stmt 1 view .LVU2282
+.LBB4072:
+.LBI4072:
+	.loc 2 1064 1 view .LVU2283
+.LBB4073:
+	.loc 2 1066 3 view .LVU2284
+.LBE4073:
+.LBE4072:
+.LBB4075:
+.LBB4076:
+# /usr/lib/gcc/x86_64-linux-gnu/12/include/smmintrin.h:168:   return (__m128i) __builtin_ia32_pblendw128 ((__v8hi)__X,
+	.loc 3 168 20 is_stmt 0 view .LVU2285
+	pblendw	$192, %xmm10, %xmm13	#, tmp1787, tmp1965
+.LBE4076:
+.LBE4075:
+.LBB4078:
+.LBB4079:
+	movdqa	%xmm3, %xmm10	# m0, tmp1968
+.LVL362:
+	.loc 3 168 20 view .LVU2286
+.LBE4079:
+.LBE4078:
+.LBB4082:
+.LBB4074:
+# /usr/lib/gcc/x86_64-linux-gnu/12/include/emmintrin.h:1066:   return (__m128i) ((__v4su)__A + (__v4su)__B);
+	.loc 2 1066 33 view .LVU2287
+	paddd	%xmm1, %xmm2	# tmp1902, _867
+.LVL363:
+	.loc 2 1066 33 view .LVU2288
+.LBE4074:
+.LBE4082:
+	.loc 1 310 432 is_stmt 1 view .LVU2289
+.LBB4083:
+.LBI4083:
+	.loc 2 1327 1 view .LVU2290
+.LBB4084:
+	.loc 2 1329 3 view .LVU2291
+	.loc 2 1329 3 is_stmt 0 view .LVU2292
+.LBE4084:
+.LBE4083:
+.LBB4086:
+.LBI4086:
+	.loc 2 1184 1 is_stmt 1 view .LVU2293
+.LBB4087:
+	.loc 2 1186 3 view .LVU2294
+.LBE4087:
+.LBE4086:
+.LBB4090:
+.LBB4091:
+# /usr/lib/gcc/x86_64-linux-gnu/12/include/emmintrin.h:1458:   return (__m128i)__builtin_ia32_pshufd ((__v4si)__A, __mask);
+	.loc 2 1458 19 is_stmt 0 view .LVU2295
+	pshufd	$147, %xmm1, %xmm1	#, tmp1902, tmp1914
+.LVL364:
+	.loc 2 1458 19 view .LVU2296
+.LBE4091:
+.LBE4090:
+.LBB4093:
+.LBB4080:
+# /usr/lib/gcc/x86_64-linux-gnu/12/include/smmintrin.h:168:   return (__m128i) __builtin_ia32_pblendw128 ((__v8hi)__X,
+	.loc 3 168 20 view .LVU2297
+	pblendw	$207, %xmm4, %xmm10	#, m1, tmp1968
+.LBE4080:
+.LBE4093:
+.LBB4094:
+.LBB4085:
+# /usr/lib/gcc/x86_64-linux-gnu/12/include/emmintrin.h:1329:   return (__m128i) ((__v2du)__A ^ (__v2du)__B);
+	.loc 2 1329 33 view .LVU2298
+	pxor	%xmm2, %xmm0	# _867, tmp1904
+.LVL365:
+	.loc 2 1329 33 view .LVU2299
+.LBE4085:
+.LBE4094:
+.LBB4095:
+.LBB4096:
+# /usr/lib/gcc/x86_64-linux-gnu/12/include/emmintrin.h:1458:   return (__m128i)__builtin_ia32_pshufd ((__v4si)__A, __mask);
+	.loc 2 1458 19 view .LVU2300
+	pshufd	$78, %xmm2, %xmm2	#, _867, tmp1912
+.LVL366:
+	.loc 2 1458 19 view .LVU2301
+.LBE4096:
+.LBE4095:
+.LBB4098:
+.LBB4099:
+	pshufd	$78, %xmm10, %xmm10	#, tmp1968, tmp1971
+.LBE4099:
+.LBE4098:
+.LBB4101:
+.LBB4088:
+# /usr/lib/gcc/x86_64-linux-gnu/12/include/emmintrin.h:1186:   return (__m128i)__builtin_ia32_pslldi128 ((__v4si)__A, __B);
+	.loc 2 1186 19 view .LVU2302
+	movdqa	%xmm0, %xmm9	# tmp1904, tmp1905
+.LBE4088:
+.LBE4101:
+.LBB4102:
+.LBB4103:
+# /usr/lib/gcc/x86_64-linux-gnu/12/include/emmintrin.h:1251:   return (__m128i)__builtin_ia32_psrldi128 ((__v4si)__A, __B);
+	.loc 2 1251 19 view .LVU2303
+	psrld	$7, %xmm0	#, tmp1907
+.LVL367:
+	.loc 2 1251 19 view .LVU2304
+.LBE4103:
+.LBE4102:
+.LBB4105:
+.LBB4089:
+# /usr/lib/gcc/x86_64-linux-gnu/12/include/emmintrin.h:1186:   return (__m128i)__builtin_ia32_pslldi128 ((__v4si)__A, __B);
+	.loc 2 1186 19 view .LVU2305
+	pslld	$25, %xmm9	#, tmp1905
+.LVL368:
+	.loc 2 1186 19 view .LVU2306
+.LBE4089:
+.LBE4105:
+.LBB4106:
+.LBI4102:
+	.loc 2 1249 1 is_stmt 1 view .LVU2307
+.LBB4104:
+	.loc 2 1251 3 view .LVU2308
+	.loc 2 1251 3 is_stmt 0 view .LVU2309
+.LBE4104:
+.LBE4106:
+.LBB4107:
+.LBI4107:
+	.loc 2 1321 1 is_stmt 1 view .LVU2310
+.LBB4108:
+	.loc 2 1323 3 view .LVU2311
+	.loc 2 1323 3 is_stmt 0 view .LVU2312
+.LBE4108:
+.LBE4107:
+	.loc 1 310 58 is_stmt 1 view .LVU2313
+	.loc 1 310 551 view .LVU2314
+.LBB4110:
+.LBI4110:
+	.loc 2 1456 1 view .LVU2315
+.LBB4111:
+	.loc 2 1458 3 view .LVU2316
+.LBE4111:
+.LBE4110:
+.LBB4113:
+.LBB4109:
+# /usr/lib/gcc/x86_64-linux-gnu/12/include/emmintrin.h:1323:   return (__m128i) ((__v2du)__A | (__v2du)__B);
+	.loc 2 1323 33 is_stmt 0 view .LVU2317
+	por	%xmm9, %xmm0	# tmp1905, tmp1910
+.LVL369:
+	.loc 2 1323 33 view .LVU2318
+.LBE4109:
+.LBE4113:
+.LBB4114:
+.LBB4115:
+# /usr/lib/gcc/x86_64-linux-gnu/12/include/smmintrin.h:168:   return (__m128i) __builtin_ia32_pblendw128 ((__v8hi)__X,
+	.loc 3 168 20 view .LVU2319
+	movdqa	8(%rsp), %xmm9	# %sfp, tmp1941
+.LBE4115:
+.LBE4114:
+.LBB4118:
+.LBB4112:
+# /usr/lib/gcc/x86_64-linux-gnu/12/include/emmintrin.h:1458:   return (__m128i)__builtin_ia32_pshufd ((__v4si)__A, __mask);
+	.loc 2 1458 19 view .LVU2320
+	pshufd	$57, %xmm0, %xmm0	#, tmp1910, tmp1909
+.LVL370:
+	.loc 2 1458 19 view .LVU2321
+.LBE4112:
+.LBE4118:
+	.loc 1 310 7 is_stmt 1 view .LVU2322
+.LBB4119:
+.LBI4095:
+	.loc 2 1456 1 view .LVU2323
+.LBB4097:
+	.loc 2 1458 3 view .LVU2324
+	.loc 2 1458 3 is_stmt 0 view .LVU2325
+.LBE4097:
+.LBE4119:
+	.loc 1 310 7 is_stmt 1 view .LVU2326
+.LBB4120:
+.LBI4090:
+	.loc 2 1456 1 view .LVU2327
+.LBB4092:
+	.loc 2 1458 3 view .LVU2328
+	.loc 2 1458 3 is_stmt 0 view .LVU2329
+.LBE4092:
+.LBE4120:
+	.loc 1 310 7 is_stmt 1 view .LVU2330
+	.loc 1 310 12 view .LVU2331
+.LBB4121:
+.LBI4121:
+	.loc 2 1064 1 view .LVU2332
+.LBB4122:
+	.loc 2 1066 3 view .LVU2333
+	.loc 2 1066 3 is_stmt 0 view .LVU2334
+.LBE4122:
+.LBE4121:
+.LBB4123:
+.LBI4123:
+	.loc 2 1064 1 is_stmt 1 view .LVU2335
+.LBB4124:
+	.loc 2 1066 3 view .LVU2336
+# /usr/lib/gcc/x86_64-linux-gnu/12/include/emmintrin.h:1066:   return (__m128i) ((__v4su)__A + (__v4su)__B);
+	.loc 2 1066 33 is_stmt 0 view .LVU2337
+	paddd	%xmm0, %xmm7	# tmp1909, tmp1916
+.LVL371:
+	.loc 2 1066 33 view .LVU2338
+.LBE4124:
+.LBE4123:
+.LBB4126:
+.LBB4116:
+# /usr/lib/gcc/x86_64-linux-gnu/12/include/smmintrin.h:168:   return (__m128i) __builtin_ia32_pblendw128 ((__v8hi)__X,
+	.loc 3 168 20 view .LVU2339
+	pblendw	$12, %xmm12, %xmm9	#, tmp1866, tmp1941
+.LBE4116:
+.LBE4126:
+.LBB4127:
+.LBB4128:
+# /usr/lib/gcc/x86_64-linux-gnu/12/include/emmintrin.h:1458:   return (__m128i)__builtin_ia32_pshufd ((__v4si)__A, __mask);
+	.loc 2 1458 19 view .LVU2340
+	pshufd	$231, %xmm6, %xmm12	#, m3, tmp1952
+.LBE4128:
+.LBE4127:
+.LBB4130:
+.LBB4131:
+# /usr/lib/gcc/x86_64-linux-gnu/12/include/smmintrin.h:168:   return (__m128i) __builtin_ia32_pblendw128 ((__v8hi)__X,
+	.loc 3 168 20 view .LVU2341
+	pblendw	$48, -72(%rsp), %xmm9	#, %sfp, tmp1944
+.LBE4131:
+.LBE4130:
+.LBB4133:
+.LBB4125:
+# /usr/lib/gcc/x86_64-linux-gnu/12/include/emmintrin.h:1066:   return (__m128i) ((__v4su)__A + (__v4su)__B);
+	.loc 2 1066 33 view .LVU2342
+	paddd	%xmm8, %xmm7	# _860, _885
+.LVL372:
+	.loc 2 1066 33 view .LVU2343
+.LBE4125:
+.LBE4133:
+	.loc 1 310 61 is_stmt 1 view .LVU2344
+.LBB4134:
+.LBI4134:
+	.loc 2 1327 1 view .LVU2345
+.LBB4135:
+	.loc 2 1329 3 view .LVU2346
+	.loc 2 1329 3 is_stmt 0 view .LVU2347
+.LBE4135:
+.LBE4134:
+.LBB4137:
+.LBI4137:
+	.loc 4 136 1 is_stmt 1 view .LVU2348
+.LBB4138:
+	.loc 4 138 3 view .LVU2349
+.LBE4138:
+.LBE4137:
+.LBB4140:
+.LBB4141:
+# /usr/lib/gcc/x86_64-linux-gnu/12/include/smmintrin.h:168:   return (__m128i) __builtin_ia32_pblendw128 ((__v8hi)__X,
+	.loc 3 168 20 is_stmt 0 view .LVU2350
+	pblendw	$204, -24(%rsp), %xmm12	#, %sfp, tmp1954
+.LBE4141:
+.LBE4140:
+.LBB4143:
+.LBB4136:
+# /usr/lib/gcc/x86_64-linux-gnu/12/include/emmintrin.h:1329:   return (__m128i) ((__v2du)__A ^ (__v2du)__B);
+	.loc 2 1329 33 view .LVU2351
+	pxor	%xmm7, %xmm1	# _885, tmp1917
+.LVL373:
+	.loc 2 1329 33 view .LVU2352
+.LBE4136:
+.LBE4143:
+.LBB4144:
+.LBB4139:
+# /usr/lib/gcc/x86_64-linux-gnu/12/include/tmmintrin.h:138:   return (__m128i) __builtin_ia32_pshufb128 ((__v16qi)__X, (__v16qi)__Y);
+	.loc 4 138 20 view .LVU2353
+	pshufb	.LC0(%rip), %xmm1	#, tmp1918
+.LVL374:
+	.loc 4 138 20 view .LVU2354
+.LBE4139:
+.LBE4144:
+	.loc 1 310 115 is_stmt 1 view .LVU2355
+.LBB4145:
+.LBI4145:
+	.loc 2 1064 1 view .LVU2356
+.LBB4146:
+	.loc 2 1066 3 view .LVU2357
+# /usr/lib/gcc/x86_64-linux-gnu/12/include/emmintrin.h:1066:   return (__m128i) ((__v4su)__A + (__v4su)__B);
+	.loc 2 1066 33 is_stmt 0 view .LVU2358
+	paddd	%xmm1, %xmm2	# tmp1918, _893
+.LVL375:
+	.loc 2 1066 33 view .LVU2359
+.LBE4146:
+.LBE4145:
+	.loc 1 310 145 is_stmt 1 view .LVU2360
+.LBB4147:
+.LBI4147:
+	.loc 2 1327 1 view .LVU2361
+.LBB4148:
+	.loc 2 1329 3 view .LVU2362
+	.loc 2 1329 3 is_stmt 0 view .LVU2363
+.LBE4148:
+.LBE4147:
+.LBB4150:
+.LBI4150:
+	.loc 2 1184 1 is_stmt 1 view .LVU2364
+.LBB4151:
+	.loc 2 1186 3 view .LVU2365
+.LBE4151:
+.LBE4150:
+.LBB4154:
+.LBB4149:
+# /usr/lib/gcc/x86_64-linux-gnu/12/include/emmintrin.h:1329:   return (__m128i) ((__v2du)__A ^ (__v2du)__B);
+	.loc 2 1329 33 is_stmt 0 view .LVU2366
+	pxor	%xmm2, %xmm0	# _893, tmp1920
+.LVL376:
+	.loc 2 1329 33 view .LVU2367
+.LBE4149:
+.LBE4154:
+.LBB4155:
+.LBB4152:
+# /usr/lib/gcc/x86_64-linux-gnu/12/include/emmintrin.h:1186:   return (__m128i)__builtin_ia32_pslldi128 ((__v4si)__A, __B);
+	.loc 2 1186 19 view .LVU2368
+	movdqa	%xmm0, %xmm8	# tmp1920, tmp1921
+.LBE4152:
+.LBE4155:
+.LBB4156:
+.LBB4157:
+# /usr/lib/gcc/x86_64-linux-gnu/12/include/emmintrin.h:1251:   return (__m128i)__builtin_ia32_psrldi128 ((__v4si)__A, __B);
+	.loc 2 1251 19 view .LVU2369
+	psrld	$12, %xmm0	#, tmp1923
+.LVL377:
+	.loc 2 1251 19 view .LVU2370
+.LBE4157:
+.LBE4156:
+.LBB4159:
+.LBB4153:
+# /usr/lib/gcc/x86_64-linux-gnu/12/include/emmintrin.h:1186:   return (__m128i)__builtin_ia32_pslldi128 ((__v4si)__A, __B);
+	.loc 2 1186 19 view .LVU2371
+	pslld	$20, %xmm8	#, tmp1921
+.LVL378:
+	.loc 2 1186 19 view .LVU2372
+.LBE4153:
+.LBE4159:
+.LBB4160:
+.LBI4156:
+	.loc 2 1249 1 is_stmt 1 view .LVU2373
+.LBB4158:
+	.loc 2 1251 3 view .LVU2374
+	.loc 2 1251 3 is_stmt 0 view .LVU2375
+.LBE4158:
+.LBE4160:
+.LBB4161:
+.LBI4161:
+	.loc 2 1321 1 is_stmt 1 view .LVU2376
+.LBB4162:
+	.loc 2 1323 3 view .LVU2377
+# /usr/lib/gcc/x86_64-linux-gnu/12/include/emmintrin.h:1323:   return (__m128i) ((__v2du)__A | (__v2du)__B);
+	.loc 2 1323 33 is_stmt 0 view .LVU2378
+	por	%xmm8, %xmm0	# tmp1921, _902
+.LVL379:
+	.loc 2 1323 33 view .LVU2379
+.LBE4162:
+.LBE4161:
+	.loc 1 310 252 is_stmt 1 view .LVU2380
+.LBB4163:
+.LBI4163:
+	.loc 2 1064 1 view .LVU2381
+.LBB4164:
+	.loc 2 1066 3 view .LVU2382
+	.loc 2 1066 3 is_stmt 0 view .LVU2383
+.LBE4164:
+.LBE4163:
+.LBB4165:
+.LBI4165:
+	.loc 2 1064 1 is_stmt 1 view .LVU2384
+.LBB4166:
+	.loc 2 1066 3 view .LVU2385
+.LBE4166:
+.LBE4165:
+.LBB4169:
+.LBB4170:
+# /usr/lib/gcc/x86_64-linux-gnu/12/include/emmintrin.h:1458:   return (__m128i)__builtin_ia32_pshufd ((__v4si)__A, __mask);
+	.loc 2 1458 19 is_stmt 0 view .LVU2386
+	pshufd	$244, %xmm3, %xmm8	#, m0, tmp1957
+.LBE4170:
+.LBE4169:
+.LBB4172:
+.LBB4167:
+# /usr/lib/gcc/x86_64-linux-gnu/12/include/emmintrin.h:1066:   return (__m128i) ((__v4su)__A + (__v4su)__B);
+	.loc 2 1066 33 view .LVU2387
+	paddd	%xmm0, %xmm11	# _902, tmp1925
+.LVL380:
+	.loc 2 1066 33 view .LVU2388
+.LBE4167:
+.LBE4172:
+.LBB4173:
+.LBB4174:
+# /usr/lib/gcc/x86_64-linux-gnu/12/include/smmintrin.h:168:   return (__m128i) __builtin_ia32_pblendw128 ((__v8hi)__X,
+	.loc 3 168 20 view .LVU2389
+	pblendw	$48, %xmm8, %xmm12	#, tmp1957, tmp1959
+.LBE4174:
+.LBE4173:
+.LBB4176:
+.LBB4168:
+# /usr/lib/gcc/x86_64-linux-gnu/12/include/emmintrin.h:1066:   return (__m128i) ((__v4su)__A + (__v4su)__B);
+	.loc 2 1066 33 view .LVU2390
+	paddd	%xmm7, %xmm11	# _885, _906
+.LVL381:
+	.loc 2 1066 33 view .LVU2391
+.LBE4168:
+.LBE4176:
+	.loc 1 310 301 is_stmt 1 view .LVU2392
+.LBB4177:
+.LBI4177:
+	.loc 2 1327 1 view .LVU2393
+.LBB4178:
+	.loc 2 1329 3 view .LVU2394
+	.loc 2 1329 3 is_stmt 0 view .LVU2395
+.LBE4178:
+.LBE4177:
+.LBB4180:
+.LBI4180:
+	.loc 4 136 1 is_stmt 1 view .LVU2396
+.LBB4181:
+	.loc 4 138 3 view .LVU2397
+.LBE4181:
+.LBE4180:
+.LBB4183:
+.LBB4179:
+# /usr/lib/gcc/x86_64-linux-gnu/12/include/emmintrin.h:1329:   return (__m128i) ((__v2du)__A ^ (__v2du)__B);
+	.loc 2 1329 33 is_stmt 0 view .LVU2398
+	pxor	%xmm11, %xmm1	# _906, tmp1926
+.LVL382:
+	.loc 2 1329 33 view .LVU2399
+.LBE4179:
+.LBE4183:
+.LBB4184:
+.LBB4182:
+# /usr/lib/gcc/x86_64-linux-gnu/12/include/tmmintrin.h:138:   return (__m128i) __builtin_ia32_pshufb128 ((__v16qi)__X, (__v16qi)__Y);
+	.loc 4 138 20 view .LVU2400
+	pshufb	.LC2(%rip), %xmm1	#, tmp1927
+.LVL383:
+	.loc 4 138 20 view .LVU2401
+.LBE4182:
+.LBE4184:
+	.loc 1 310 354 is_stmt 1 view .LVU2402
+.LBB4185:
+.LBI4185:
+	.loc 2 1064 1 view .LVU2403
+.LBB4186:
+	.loc 2 1066 3 view .LVU2404
+# /usr/lib/gcc/x86_64-linux-gnu/12/include/emmintrin.h:1066:   return (__m128i) ((__v4su)__A + (__v4su)__B);
+	.loc 2 1066 33 is_stmt 0 view .LVU2405
+	paddd	%xmm1, %xmm2	# tmp1927, _913
+.LVL384:
+	.loc 2 1066 33 view .LVU2406
+.LBE4186:
+.LBE4185:
+	.loc 1 310 384 is_stmt 1 view .LVU2407
+.LBB4187:
+.LBI4187:
+	.loc 2 1327 1 view .LVU2408
+.LBB4188:
+	.loc 2 1329 3 view .LVU2409
+	.loc 2 1329 3 is_stmt 0 view .LVU2410
+.LBE4188:
+.LBE4187:
+.LBB4190:
+.LBI4190:
+	.loc 2 1184 1 is_stmt 1 view .LVU2411
+.LBB4191:
+	.loc 2 1186 3 view .LVU2412
+.LBE4191:
+.LBE4190:
+.LBB4194:
+.LBB4195:
+# /usr/lib/gcc/x86_64-linux-gnu/12/include/emmintrin.h:1458:   return (__m128i)__builtin_ia32_pshufd ((__v4si)__A, __mask);
+	.loc 2 1458 19 is_stmt 0 view .LVU2413
+	pshufd	$57, %xmm1, %xmm1	#, tmp1927, tmp1939
+.LVL385:
+	.loc 2 1458 19 view .LVU2414
+.LBE4195:
+.LBE4194:
+.LBB4197:
+.LBB4189:
+# /usr/lib/gcc/x86_64-linux-gnu/12/include/emmintrin.h:1329:   return (__m128i) ((__v2du)__A ^ (__v2du)__B);
+	.loc 2 1329 33 view .LVU2415
+	pxor	%xmm2, %xmm0	# _913, tmp1929
+.LVL386:
+	.loc 2 1329 33 view .LVU2416
+.LBE4189:
+.LBE4197:
+.LBB4198:
+.LBB4199:
+# /usr/lib/gcc/x86_64-linux-gnu/12/include/emmintrin.h:1458:   return (__m128i)__builtin_ia32_pshufd ((__v4si)__A, __mask);
+	.loc 2 1458 19 view .LVU2417
+	pshufd	$78, %xmm2, %xmm2	#, _913, tmp1937
+.LVL387:
+	.loc 2 1458 19 view .LVU2418
+.LBE4199:
+.LBE4198:
+.LBB4201:
+.LBB4192:
+# /usr/lib/gcc/x86_64-linux-gnu/12/include/emmintrin.h:1186:   return (__m128i)__builtin_ia32_pslldi128 ((__v4si)__A, __B);
+	.loc 2 1186 19 view .LVU2419
+	movdqa	%xmm0, %xmm7	# tmp1929, tmp1930
+.LBE4192:
+.LBE4201:
+.LBB4202:
+.LBB4203:
+# /usr/lib/gcc/x86_64-linux-gnu/12/include/emmintrin.h:1251:   return (__m128i)__builtin_ia32_psrldi128 ((__v4si)__A, __B);
+	.loc 2 1251 19 view .LVU2420
+	psrld	$7, %xmm0	#, tmp1932
+.LVL388:
+	.loc 2 1251 19 view .LVU2421
+.LBE4203:
+.LBE4202:
+.LBB4205:
+.LBB4193:
+# /usr/lib/gcc/x86_64-linux-gnu/12/include/emmintrin.h:1186:   return (__m128i)__builtin_ia32_pslldi128 ((__v4si)__A, __B);
+	.loc 2 1186 19 view .LVU2422
+	pslld	$25, %xmm7	#, tmp1930
+.LVL389:
+	.loc 2 1186 19 view .LVU2423
+.LBE4193:
+.LBE4205:
+.LBB4206:
+.LBI4202:
+	.loc 2 1249 1 is_stmt 1 view .LVU2424
+.LBB4204:
+	.loc 2 1251 3 view .LVU2425
+	.loc 2 1251 3 is_stmt 0 view .LVU2426
+.LBE4204:
+.LBE4206:
+.LBB4207:
+.LBI4207:
+	.loc 2 1321 1 is_stmt 1 view .LVU2427
+.LBB4208:
+	.loc 2 1323 3 view .LVU2428
+	.loc 2 1323 3 is_stmt 0 view .LVU2429
+.LBE4208:
+.LBE4207:
+	.loc 1 310 10 is_stmt 1 view .LVU2430
+	.loc 1 310 503 view .LVU2431
+.LBB4210:
+.LBI4210:
+	.loc 2 1456 1 view .LVU2432
+.LBB4211:
+	.loc 2 1458 3 view .LVU2433
+.LBE4211:
+.LBE4210:
+.LBB4213:
+.LBB4209:
+# /usr/lib/gcc/x86_64-linux-gnu/12/include/emmintrin.h:1323:   return (__m128i) ((__v2du)__A | (__v2du)__B);
+	.loc 2 1323 33 is_stmt 0 view .LVU2434
+	por	%xmm7, %xmm0	# tmp1930, tmp1935
+.LVL390:
+	.loc 2 1323 33 view .LVU2435
+.LBE4209:
+.LBE4213:
+.LBB4214:
+.LBB4215:
+# /usr/lib/gcc/x86_64-linux-gnu/12/include/emmintrin.h:1458:   return (__m128i)__builtin_ia32_pshufd ((__v4si)__A, __mask);
+	.loc 2 1458 19 view .LVU2436
+	pshufd	$36, %xmm3, %xmm7	#, m0, tmp1947
+.LBE4215:
+.LBE4214:
+.LBB4217:
+.LBB4212:
+	pshufd	$147, %xmm0, %xmm0	#, tmp1935, tmp1934
+.LVL391:
+	.loc 2 1458 19 view .LVU2437
+.LBE4212:
+.LBE4217:
+	.loc 1 310 7 is_stmt 1 view .LVU2438
+.LBB4218:
+.LBI4198:
+	.loc 2 1456 1 view .LVU2439
+.LBB4200:
+	.loc 2 1458 3 view .LVU2440
+	.loc 2 1458 3 is_stmt 0 view .LVU2441
+.LBE4200:
+.LBE4218:
+	.loc 1 310 7 is_stmt 1 view .LVU2442
+.LBB4219:
+.LBI4194:
+	.loc 2 1456 1 view .LVU2443
+.LBB4196:
+	.loc 2 1458 3 view .LVU2444
+	.loc 2 1458 3 is_stmt 0 view .LVU2445
+.LBE4196:
+.LBE4219:
+	.loc 1 310 8 is_stmt 1 view .LVU2446
+	.loc 1 311 5 view .LVU2447
+	.loc 1 311 10 view .LVU2448
+	.loc 1 311 15 view .LVU2449
+	.loc 1 311 7 view .LVU2450
+	.loc 1 311 7 view .LVU2451
+.LBB4220:
+.LBI4114:
+	.loc 3 166 1 view .LVU2452
+.LBB4117:
+	.loc 3 168 3 view .LVU2453
+	.loc 3 168 3 is_stmt 0 view .LVU2454
+.LBE4117:
+.LBE4220:
+	.loc 1 311 42 is_stmt 1 view .LVU2455
+	.loc 1 311 7 view .LVU2456
+.LBB4221:
+.LBI4130:
+	.loc 3 166 1 view .LVU2457
+.LBB4132:
+	.loc 3 168 3 view .LVU2458
+	.loc 3 168 3 is_stmt 0 view .LVU2459
+.LBE4132:
+.LBE4221:
+	.loc 1 311 42 is_stmt 1 view .LVU2460
+.LBB4222:
+.LBI4214:
+	.loc 2 1456 1 view .LVU2461
+.LBB4216:
+	.loc 2 1458 3 view .LVU2462
+	.loc 2 1458 3 is_stmt 0 view .LVU2463
+.LBE4216:
+.LBE4222:
+	.loc 1 311 7 is_stmt 1 view .LVU2464
+.LBB4223:
+.LBI4223:
+	.loc 3 166 1 view .LVU2465
+.LBB4224:
+	.loc 3 168 3 view .LVU2466
+# /usr/lib/gcc/x86_64-linux-gnu/12/include/smmintrin.h:168:   return (__m128i) __builtin_ia32_pblendw128 ((__v8hi)__X,
+	.loc 3 168 20 is_stmt 0 view .LVU2467
+	pblendw	$192, %xmm7, %xmm9	#, tmp1947, tmp1949
+.LVL392:
+	.loc 3 168 20 view .LVU2468
+.LBE4224:
+.LBE4223:
+	.loc 1 311 42 is_stmt 1 view .LVU2469
+.LBB4225:
+.LBI4127:
+	.loc 2 1456 1 view .LVU2470
+.LBB4129:
+	.loc 2 1458 3 view .LVU2471
+	.loc 2 1458 3 is_stmt 0 view .LVU2472
+.LBE4129:
+.LBE4225:
+	.loc 1 311 7 is_stmt 1 view .LVU2473
+	.loc 1 311 7 view .LVU2474
+.LBB4226:
+.LBI4140:
+	.loc 3 166 1 view .LVU2475
+.LBB4142:
+	.loc 3 168 3 view .LVU2476
+	.loc 3 168 3 is_stmt 0 view .LVU2477
+.LBE4142:
+.LBE4226:
+	.loc 1 311 42 is_stmt 1 view .LVU2478
+.LBB4227:
+.LBI4169:
+	.loc 2 1456 1 view .LVU2479
+.LBB4171:
+	.loc 2 1458 3 view .LVU2480
+	.loc 2 1458 3 is_stmt 0 view .LVU2481
+.LBE4171:
+.LBE4227:
+	.loc 1 311 7 is_stmt 1 view .LVU2482
+.LBB4228:
+.LBI4173:
+	.loc 3 166 1 view .LVU2483
+.LBB4175:
+	.loc 3 168 3 view .LVU2484
+	.loc 3 168 3 is_stmt 0 view .LVU2485
+.LBE4175:
+.LBE4228:
+	.loc 1 311 42 is_stmt 1 view .LVU2486
+	.loc 1 311 51 view .LVU2487
+	.loc 1 311 7 view .LVU2488
+.LBB4229:
+.LBI4065:
+	.loc 3 166 1 view .LVU2489
+.LBB4068:
+	.loc 3 168 3 view .LVU2490
+	.loc 3 168 3 is_stmt 0 view .LVU2491
+.LBE4068:
+.LBE4229:
+	.loc 1 311 42 is_stmt 1 view .LVU2492
+	.loc 1 311 7 view .LVU2493
+.LBB4230:
+.LBI4075:
+	.loc 3 166 1 view .LVU2494
+.LBB4077:
+	.loc 3 168 3 view .LVU2495
+	.loc 3 168 3 is_stmt 0 view .LVU2496
+.LBE4077:
+.LBE4230:
+	.loc 1 311 42 is_stmt 1 view .LVU2497
+.LBB4231:
+.LBI4078:
+	.loc 3 166 1 view .LVU2498
+.LBB4081:
+	.loc 3 168 3 view .LVU2499
+	.loc 3 168 3 is_stmt 0 view .LVU2500
+.LBE4081:
+.LBE4231:
+	.loc 1 311 78 is_stmt 1 view .LVU2501
+.LBB4232:
+.LBI4098:
+	.loc 2 1456 1 view .LVU2502
+.LBB4100:
+	.loc 2 1458 3 view .LVU2503
+	.loc 2 1458 3 is_stmt 0 view .LVU2504
+.LBE4100:
+.LBE4232:
+	.loc 1 311 13 is_stmt 1 view .LVU2505
+	.loc 1 311 20 view .LVU2506
+	.loc 1 311 25 view .LVU2507
+.LBB4233:
+.LBI4233:
+	.loc 2 1064 1 view .LVU2508
+.LBB4234:
+	.loc 2 1066 3 view .LVU2509
+	.loc 2 1066 3 is_stmt 0 view .LVU2510
+.LBE4234:
+.LBE4233:
+.LBB4235:
+.LBI4235:
+	.loc 2 1064 1 is_stmt 1 view .LVU2511
+.LBB4236:
+	.loc 2 1066 3 view .LVU2512
+# /usr/lib/gcc/x86_64-linux-gnu/12/include/emmintrin.h:1066:   return (__m128i) ((__v4su)__A + (__v4su)__B);
+	.loc 2 1066 33 is_stmt 0 view .LVU2513
+	paddd	%xmm0, %xmm9	# tmp1934, tmp1973
+.LVL393:
+	.loc 2 1066 33 view .LVU2514
+	paddd	%xmm11, %xmm9	# _906, _947
+.LVL394:
+	.loc 2 1066 33 view .LVU2515
+.LBE4236:
+.LBE4235:
+	.loc 1 311 74 is_stmt 1 view .LVU2516
+.LBB4237:
+.LBI4237:
+	.loc 2 1327 1 view .LVU2517
+.LBB4238:
+	.loc 2 1329 3 view .LVU2518
+	.loc 2 1329 3 is_stmt 0 view .LVU2519
+.LBE4238:
+.LBE4237:
+.LBB4240:
+.LBI4240:
+	.loc 4 136 1 is_stmt 1 view .LVU2520
+.LBB4241:
+	.loc 4 138 3 view .LVU2521
+.LBE4241:
+.LBE4240:
+.LBB4243:
+.LBB4239:
+# /usr/lib/gcc/x86_64-linux-gnu/12/include/emmintrin.h:1329:   return (__m128i) ((__v2du)__A ^ (__v2du)__B);
+	.loc 2 1329 33 is_stmt 0 view .LVU2522
+	pxor	%xmm9, %xmm1	# _947, tmp1974
+.LVL395:
+	.loc 2 1329 33 view .LVU2523
+.LBE4239:
+.LBE4243:
+.LBB4244:
+.LBB4242:
+# /usr/lib/gcc/x86_64-linux-gnu/12/include/tmmintrin.h:138:   return (__m128i) __builtin_ia32_pshufb128 ((__v16qi)__X, (__v16qi)__Y);
+	.loc 4 138 20 view .LVU2524
+	pshufb	.LC0(%rip), %xmm1	#, tmp1975
+.LVL396:
+	.loc 4 138 20 view .LVU2525
+.LBE4242:
+.LBE4244:
+	.loc 1 311 128 is_stmt 1 view .LVU2526
+.LBB4245:
+.LBI4245:
+	.loc 2 1064 1 view .LVU2527
+.LBB4246:
+	.loc 2 1066 3 view .LVU2528
+# /usr/lib/gcc/x86_64-linux-gnu/12/include/emmintrin.h:1066:   return (__m128i) ((__v4su)__A + (__v4su)__B);
+	.loc 2 1066 33 is_stmt 0 view .LVU2529
+	paddd	%xmm1, %xmm2	# tmp1975, _955
+.LVL397:
+	.loc 2 1066 33 view .LVU2530
+.LBE4246:
+.LBE4245:
+	.loc 1 311 158 is_stmt 1 view .LVU2531
+.LBB4247:
+.LBI4247:
+	.loc 2 1327 1 view .LVU2532
+.LBB4248:
+	.loc 2 1329 3 view .LVU2533
+	.loc 2 1329 3 is_stmt 0 view .LVU2534
+.LBE4248:
+.LBE4247:
+.LBB4250:
+.LBI4250:
+	.loc 2 1184 1 is_stmt 1 view .LVU2535
+.LBB4251:
+	.loc 2 1186 3 view .LVU2536
+.LBE4251:
+.LBE4250:
+.LBB4254:
+.LBB4249:
+# /usr/lib/gcc/x86_64-linux-gnu/12/include/emmintrin.h:1329:   return (__m128i) ((__v2du)__A ^ (__v2du)__B);
+	.loc 2 1329 33 is_stmt 0 view .LVU2537
+	pxor	%xmm2, %xmm0	# _955, tmp1977
+.LVL398:
+	.loc 2 1329 33 view .LVU2538
+.LBE4249:
+.LBE4254:
+.LBB4255:
+.LBB4252:
+# /usr/lib/gcc/x86_64-linux-gnu/12/include/emmintrin.h:1186:   return (__m128i)__builtin_ia32_pslldi128 ((__v4si)__A, __B);
+	.loc 2 1186 19 view .LVU2539
+	movdqa	%xmm0, %xmm11	# tmp1977, tmp1978
+.LBE4252:
+.LBE4255:
+.LBB4256:
+.LBB4257:
+# /usr/lib/gcc/x86_64-linux-gnu/12/include/emmintrin.h:1251:   return (__m128i)__builtin_ia32_psrldi128 ((__v4si)__A, __B);
+	.loc 2 1251 19 view .LVU2540
+	psrld	$12, %xmm0	#, tmp1980
+.LVL399:
+	.loc 2 1251 19 view .LVU2541
+.LBE4257:
+.LBE4256:
+.LBB4259:
+.LBB4253:
+# /usr/lib/gcc/x86_64-linux-gnu/12/include/emmintrin.h:1186:   return (__m128i)__builtin_ia32_pslldi128 ((__v4si)__A, __B);
+	.loc 2 1186 19 view .LVU2542
+	pslld	$20, %xmm11	#, tmp1978
+.LVL400:
+	.loc 2 1186 19 view .LVU2543
+.LBE4253:
+.LBE4259:
+.LBB4260:
+.LBI4256:
+	.loc 2 1249 1 is_stmt 1 view .LVU2544
+.LBB4258:
+	.loc 2 1251 3 view .LVU2545
+	.loc 2 1251 3 is_stmt 0 view .LVU2546
+.LBE4258:
+.LBE4260:
+.LBB4261:
+.LBI4261:
+	.loc 2 1321 1 is_stmt 1 view .LVU2547
+.LBB4262:
+	.loc 2 1323 3 view .LVU2548
+# /usr/lib/gcc/x86_64-linux-gnu/12/include/emmintrin.h:1323:   return (__m128i) ((__v2du)__A | (__v2du)__B);
+	.loc 2 1323 33 is_stmt 0 view .LVU2549
+	por	%xmm11, %xmm0	# tmp1978, _964
+.LVL401:
+	.loc 2 1323 33 view .LVU2550
+.LBE4262:
+.LBE4261:
+	.loc 1 311 265 is_stmt 1 view .LVU2551
+.LBB4263:
+.LBI4263:
+	.loc 2 1064 1 view .LVU2552
+.LBB4264:
+	.loc 2 1066 3 view .LVU2553
+	.loc 2 1066 3 is_stmt 0 view .LVU2554
+.LBE4264:
+.LBE4263:
+.LBB4265:
+.LBI4265:
+	.loc 2 1064 1 is_stmt 1 view .LVU2555
+.LBB4266:
+	.loc 2 1066 3 view .LVU2556
+# /usr/lib/gcc/x86_64-linux-gnu/12/include/emmintrin.h:1066:   return (__m128i) ((__v4su)__A + (__v4su)__B);
+	.loc 2 1066 33 is_stmt 0 view .LVU2557
+	paddd	%xmm0, %xmm12	# _964, tmp1982
+.LVL402:
+	.loc 2 1066 33 view .LVU2558
+	paddd	%xmm9, %xmm12	# _947, _968
+.LVL403:
+	.loc 2 1066 33 view .LVU2559
+.LBE4266:
+.LBE4265:
+	.loc 1 311 314 is_stmt 1 view .LVU2560
+.LBB4267:
+.LBI4267:
+	.loc 2 1327 1 view .LVU2561
+.LBB4268:
+	.loc 2 1329 3 view .LVU2562
+	.loc 2 1329 3 is_stmt 0 view .LVU2563
+.LBE4268:
+.LBE4267:
+.LBB4270:
+.LBI4270:
+	.loc 4 136 1 is_stmt 1 view .LVU2564
+.LBB4271:
+	.loc 4 138 3 view .LVU2565
+.LBE4271:
+.LBE4270:
+.LBB4273:
+.LBB4269:
+# /usr/lib/gcc/x86_64-linux-gnu/12/include/emmintrin.h:1329:   return (__m128i) ((__v2du)__A ^ (__v2du)__B);
+	.loc 2 1329 33 is_stmt 0 view .LVU2566
+	pxor	%xmm12, %xmm1	# _968, tmp1983
+.LVL404:
+	.loc 2 1329 33 view .LVU2567
+.LBE4269:
+.LBE4273:
+.LBB4274:
+.LBB4272:
+# /usr/lib/gcc/x86_64-linux-gnu/12/include/tmmintrin.h:138:   return (__m128i) __builtin_ia32_pshufb128 ((__v16qi)__X, (__v16qi)__Y);
+	.loc 4 138 20 view .LVU2568
+	pshufb	.LC2(%rip), %xmm1	#, tmp1984
+.LVL405:
+	.loc 4 138 20 view .LVU2569
+.LBE4272:
+.LBE4274:
+	.loc 1 311 367 is_stmt 1 view .LVU2570
+.LBB4275:
+.LBI4275:
+	.loc 2 1064 1 view .LVU2571
+.LBB4276:
+	.loc 2 1066 3 view .LVU2572
+# /usr/lib/gcc/x86_64-linux-gnu/12/include/emmintrin.h:1066:   return (__m128i) ((__v4su)__A + (__v4su)__B);
+	.loc 2 1066 33 is_stmt 0 view .LVU2573
+	paddd	%xmm1, %xmm2	# tmp1984, _975
+.LVL406:
+	.loc 2 1066 33 view .LVU2574
+.LBE4276:
+.LBE4275:
+	.loc 1 311 397 is_stmt 1 view .LVU2575
+.LBB4277:
+.LBI4277:
+	.loc 2 1327 1 view .LVU2576
+.LBB4278:
+	.loc 2 1329 3 view .LVU2577
+	.loc 2 1329 3 is_stmt 0 view .LVU2578
+.LBE4278:
+.LBE4277:
+.LBB4280:
+.LBI4280:
+	.loc 2 1184 1 is_stmt 1 view .LVU2579
+.LBB4281:
+	.loc 2 1186 3 view .LVU2580
+.LBE4281:
+.LBE4280:
+.LBB4284:
+.LBB4285:
+# /usr/lib/gcc/x86_64-linux-gnu/12/include/emmintrin.h:1458:   return (__m128i)__builtin_ia32_pshufd ((__v4si)__A, __mask);
+	.loc 2 1458 19 is_stmt 0 view .LVU2581
+	pshufd	$147, %xmm1, %xmm1	#, tmp1984, tmp1996
+.LVL407:
+	.loc 2 1458 19 view .LVU2582
+.LBE4285:
+.LBE4284:
+.LBB4287:
+.LBB4279:
+# /usr/lib/gcc/x86_64-linux-gnu/12/include/emmintrin.h:1329:   return (__m128i) ((__v2du)__A ^ (__v2du)__B);
+	.loc 2 1329 33 view .LVU2583
+	pxor	%xmm2, %xmm0	# _975, tmp1986
+.LVL408:
+	.loc 2 1329 33 view .LVU2584
+.LBE4279:
+.LBE4287:
+.LBB4288:
+.LBB4289:
+# /usr/lib/gcc/x86_64-linux-gnu/12/include/emmintrin.h:1458:   return (__m128i)__builtin_ia32_pshufd ((__v4si)__A, __mask);
+	.loc 2 1458 19 view .LVU2585
+	pshufd	$78, %xmm2, %xmm2	#, _975, tmp1994
+.LVL409:
+	.loc 2 1458 19 view .LVU2586
+.LBE4289:
+.LBE4288:
+.LBB4291:
+.LBB4282:
+# /usr/lib/gcc/x86_64-linux-gnu/12/include/emmintrin.h:1186:   return (__m128i)__builtin_ia32_pslldi128 ((__v4si)__A, __B);
+	.loc 2 1186 19 view .LVU2587
+	movdqa	%xmm0, %xmm9	# tmp1986, tmp1987
+.LBE4282:
+.LBE4291:
+.LBB4292:
+.LBB4293:
+# /usr/lib/gcc/x86_64-linux-gnu/12/include/emmintrin.h:1251:   return (__m128i)__builtin_ia32_psrldi128 ((__v4si)__A, __B);
+	.loc 2 1251 19 view .LVU2588
+	psrld	$7, %xmm0	#, tmp1989
+.LVL410:
+	.loc 2 1251 19 view .LVU2589
+.LBE4293:
+.LBE4292:
+.LBB4295:
+.LBB4283:
+# /usr/lib/gcc/x86_64-linux-gnu/12/include/emmintrin.h:1186:   return (__m128i)__builtin_ia32_pslldi128 ((__v4si)__A, __B);
+	.loc 2 1186 19 view .LVU2590
+	pslld	$25, %xmm9	#, tmp1987
+.LVL411:
+	.loc 2 1186 19 view .LVU2591
+.LBE4283:
+.LBE4295:
+.LBB4296:
+.LBI4292:
+	.loc 2 1249 1 is_stmt 1 view .LVU2592
+.LBB4294:
+	.loc 2 1251 3 view .LVU2593
+	.loc 2 1251 3 is_stmt 0 view .LVU2594
+.LBE4294:
+.LBE4296:
+.LBB4297:
+.LBI4297:
+	.loc 2 1321 1 is_stmt 1 view .LVU2595
+.LBB4298:
+	.loc 2 1323 3 view .LVU2596
+	.loc 2 1323 3 is_stmt 0 view .LVU2597
+.LBE4298:
+.LBE4297:
+	.loc 1 311 23 is_stmt 1 view .LVU2598
+	.loc 1 311 516 view .LVU2599
+.LBB4300:
+.LBI4300:
+	.loc 2 1456 1 view .LVU2600
+.LBB4301:
+	.loc 2 1458 3 view .LVU2601
+.LBE4301:
+.LBE4300:
+.LBB4303:
+.LBB4299:
+# /usr/lib/gcc/x86_64-linux-gnu/12/include/emmintrin.h:1323:   return (__m128i) ((__v2du)__A | (__v2du)__B);
+	.loc 2 1323 33 is_stmt 0 view .LVU2602
+	por	%xmm9, %xmm0	# tmp1987, tmp1992
+.LVL412:
+	.loc 2 1323 33 view .LVU2603
+.LBE4299:
+.LBE4303:
+.LBB4304:
+.LBB4302:
+# /usr/lib/gcc/x86_64-linux-gnu/12/include/emmintrin.h:1458:   return (__m128i)__builtin_ia32_pshufd ((__v4si)__A, __mask);
+	.loc 2 1458 19 view .LVU2604
+	pshufd	$57, %xmm0, %xmm0	#, tmp1992, tmp1991
+.LVL413:
+	.loc 2 1458 19 view .LVU2605
+.LBE4302:
+.LBE4304:
+	.loc 1 311 7 is_stmt 1 view .LVU2606
+.LBB4305:
+.LBI4288:
+	.loc 2 1456 1 view .LVU2607
+.LBB4290:
+	.loc 2 1458 3 view .LVU2608
+	.loc 2 1458 3 is_stmt 0 view .LVU2609
+.LBE4290:
+.LBE4305:
+	.loc 1 311 7 is_stmt 1 view .LVU2610
+.LBB4306:
+.LBI4284:
+	.loc 2 1456 1 view .LVU2611
+.LBB4286:
+	.loc 2 1458 3 view .LVU2612
+	.loc 2 1458 3 is_stmt 0 view .LVU2613
+.LBE4286:
+.LBE4306:
+	.loc 1 311 7 is_stmt 1 view .LVU2614
+	.loc 1 311 12 view .LVU2615
+.LBB4307:
+.LBI4307:
+	.loc 2 1064 1 view .LVU2616
+.LBB4308:
+	.loc 2 1066 3 view .LVU2617
+	.loc 2 1066 3 is_stmt 0 view .LVU2618
+.LBE4308:
+.LBE4307:
+.LBB4309:
+.LBI4309:
+	.loc 2 1064 1 is_stmt 1 view .LVU2619
+.LBB4310:
+	.loc 2 1066 3 view .LVU2620
+# /usr/lib/gcc/x86_64-linux-gnu/12/include/emmintrin.h:1066:   return (__m128i) ((__v4su)__A + (__v4su)__B);
+	.loc 2 1066 33 is_stmt 0 view .LVU2621
+	paddd	%xmm0, %xmm13	# tmp1991, tmp1998
+.LVL414:
+	.loc 2 1066 33 view .LVU2622
+	paddd	%xmm12, %xmm13	# _968, _993
+.LVL415:
+	.loc 2 1066 33 view .LVU2623
+.LBE4310:
+.LBE4309:
+	.loc 1 311 61 is_stmt 1 view .LVU2624
+.LBB4311:
+.LBI4311:
+	.loc 2 1327 1 view .LVU2625
+.LBB4312:
+	.loc 2 1329 3 view .LVU2626
+	.loc 2 1329 3 is_stmt 0 view .LVU2627
+.LBE4312:
+.LBE4311:
+.LBB4314:
+.LBI4314:
+	.loc 4 136 1 is_stmt 1 view .LVU2628
+.LBB4315:
+	.loc 4 138 3 view .LVU2629
+.LBE4315:
+.LBE4314:
+.LBB4317:
+.LBB4313:
+# /usr/lib/gcc/x86_64-linux-gnu/12/include/emmintrin.h:1329:   return (__m128i) ((__v2du)__A ^ (__v2du)__B);
+	.loc 2 1329 33 is_stmt 0 view .LVU2630
+	pxor	%xmm13, %xmm1	# _993, tmp1999
+.LVL416:
+	.loc 2 1329 33 view .LVU2631
+.LBE4313:
+.LBE4317:
+.LBB4318:
+.LBB4316:
+# /usr/lib/gcc/x86_64-linux-gnu/12/include/tmmintrin.h:138:   return (__m128i) __builtin_ia32_pshufb128 ((__v16qi)__X, (__v16qi)__Y);
+	.loc 4 138 20 view .LVU2632
+	pshufb	.LC0(%rip), %xmm1	#, tmp2000
+.LVL417:
+	.loc 4 138 20 view .LVU2633
+.LBE4316:
+.LBE4318:
+	.loc 1 311 115 is_stmt 1 view .LVU2634
+.LBB4319:
+.LBI4319:
+	.loc 2 1064 1 view .LVU2635
+.LBB4320:
+	.loc 2 1066 3 view .LVU2636
+# /usr/lib/gcc/x86_64-linux-gnu/12/include/emmintrin.h:1066:   return (__m128i) ((__v4su)__A + (__v4su)__B);
+	.loc 2 1066 33 is_stmt 0 view .LVU2637
+	paddd	%xmm1, %xmm2	# tmp2000, _1001
+.LVL418:
+	.loc 2 1066 33 view .LVU2638
+.LBE4320:
+.LBE4319:
+	.loc 1 311 145 is_stmt 1 view .LVU2639
+.LBB4321:
+.LBI4321:
+	.loc 2 1327 1 view .LVU2640
+.LBB4322:
+	.loc 2 1329 3 view .LVU2641
+	.loc 2 1329 3 is_stmt 0 view .LVU2642
+.LBE4322:
+.LBE4321:
+.LBB4324:
+.LBI4324:
+	.loc 2 1184 1 is_stmt 1 view .LVU2643
+.LBB4325:
+	.loc 2 1186 3 view .LVU2644
+.LBE4325:
+.LBE4324:
+.LBB4328:
+.LBB4323:
+# /usr/lib/gcc/x86_64-linux-gnu/12/include/emmintrin.h:1329:   return (__m128i) ((__v2du)__A ^ (__v2du)__B);
+	.loc 2 1329 33 is_stmt 0 view .LVU2645
+	pxor	%xmm2, %xmm0	# _1001, tmp2002
+.LVL419:
+	.loc 2 1329 33 view .LVU2646
+.LBE4323:
+.LBE4328:
+.LBB4329:
+.LBB4326:
+# /usr/lib/gcc/x86_64-linux-gnu/12/include/emmintrin.h:1186:   return (__m128i)__builtin_ia32_pslldi128 ((__v4si)__A, __B);
+	.loc 2 1186 19 view .LVU2647
+	movdqa	%xmm0, %xmm9	# tmp2002, tmp2003
+.LBE4326:
+.LBE4329:
+.LBB4330:
+.LBB4331:
+# /usr/lib/gcc/x86_64-linux-gnu/12/include/emmintrin.h:1251:   return (__m128i)__builtin_ia32_psrldi128 ((__v4si)__A, __B);
+	.loc 2 1251 19 view .LVU2648
+	psrld	$12, %xmm0	#, tmp2005
+.LVL420:
+	.loc 2 1251 19 view .LVU2649
+.LBE4331:
+.LBE4330:
+.LBB4333:
+.LBB4327:
+# /usr/lib/gcc/x86_64-linux-gnu/12/include/emmintrin.h:1186:   return (__m128i)__builtin_ia32_pslldi128 ((__v4si)__A, __B);
+	.loc 2 1186 19 view .LVU2650
+	pslld	$20, %xmm9	#, tmp2003
+.LVL421:
+	.loc 2 1186 19 view .LVU2651
+.LBE4327:
+.LBE4333:
+.LBB4334:
+.LBI4330:
+	.loc 2 1249 1 is_stmt 1 view .LVU2652
+.LBB4332:
+	.loc 2 1251 3 view .LVU2653
+	.loc 2 1251 3 is_stmt 0 view .LVU2654
+.LBE4332:
+.LBE4334:
+.LBB4335:
+.LBI4335:
+	.loc 2 1321 1 is_stmt 1 view .LVU2655
+.LBB4336:
+	.loc 2 1323 3 view .LVU2656
+# /usr/lib/gcc/x86_64-linux-gnu/12/include/emmintrin.h:1323:   return (__m128i) ((__v2du)__A | (__v2du)__B);
+	.loc 2 1323 33 is_stmt 0 view .LVU2657
+	por	%xmm9, %xmm0	# tmp2003, _1010
+.LVL422:
+	.loc 2 1323 33 view .LVU2658
+.LBE4336:
+.LBE4335:
+	.loc 1 311 252 is_stmt 1 view .LVU2659
+.LBB4337:
+.LBI4337:
+	.loc 2 1064 1 view .LVU2660
+.LBB4338:
+	.loc 2 1066 3 view .LVU2661
+	.loc 2 1066 3 is_stmt 0 view .LVU2662
+.LBE4338:
+.LBE4337:
+.LBB4339:
+.LBI4339:
+	.loc 2 1064 1 is_stmt 1 view .LVU2663
+.LBB4340:
+	.loc 2 1066 3 view .LVU2664
+# /usr/lib/gcc/x86_64-linux-gnu/12/include/emmintrin.h:1066:   return (__m128i) ((__v4su)__A + (__v4su)__B);
+	.loc 2 1066 33 is_stmt 0 view .LVU2665
+	paddd	%xmm0, %xmm10	# _1010, tmp2007
+.LVL423:
+	.loc 2 1066 33 view .LVU2666
+	paddd	%xmm13, %xmm10	# _993, _1014
+.LVL424:
+	.loc 2 1066 33 view .LVU2667
+.LBE4340:
+.LBE4339:
+	.loc 1 311 301 is_stmt 1 view .LVU2668
+.LBB4341:
+.LBI4341:
+	.loc 2 1327 1 view .LVU2669
+.LBB4342:
+	.loc 2 1329 3 view .LVU2670
+	.loc 2 1329 3 is_stmt 0 view .LVU2671
+.LBE4342:
+.LBE4341:
+.LBB4344:
+.LBI4344:
+	.loc 4 136 1 is_stmt 1 view .LVU2672
+.LBB4345:
+	.loc 4 138 3 view .LVU2673
+.LBE4345:
+.LBE4344:
+.LBB4347:
+.LBB4343:
+# /usr/lib/gcc/x86_64-linux-gnu/12/include/emmintrin.h:1329:   return (__m128i) ((__v2du)__A ^ (__v2du)__B);
+	.loc 2 1329 33 is_stmt 0 view .LVU2674
+	pxor	%xmm10, %xmm1	# _1014, tmp2008
+.LVL425:
+	.loc 2 1329 33 view .LVU2675
+.LBE4343:
+.LBE4347:
+.LBB4348:
+.LBB4346:
+# /usr/lib/gcc/x86_64-linux-gnu/12/include/tmmintrin.h:138:   return (__m128i) __builtin_ia32_pshufb128 ((__v16qi)__X, (__v16qi)__Y);
+	.loc 4 138 20 view .LVU2676
+	pshufb	.LC2(%rip), %xmm1	#, tmp2009
+.LVL426:
+	.loc 4 138 20 view .LVU2677
+.LBE4346:
+.LBE4348:
+	.loc 1 311 354 is_stmt 1 view .LVU2678
+.LBB4349:
+.LBI4349:
+	.loc 2 1064 1 view .LVU2679
+.LBB4350:
+	.loc 2 1066 3 view .LVU2680
+# /usr/lib/gcc/x86_64-linux-gnu/12/include/emmintrin.h:1066:   return (__m128i) ((__v4su)__A + (__v4su)__B);
+	.loc 2 1066 33 is_stmt 0 view .LVU2681
+	paddd	%xmm1, %xmm2	# tmp2009, _1021
+.LVL427:
+	.loc 2 1066 33 view .LVU2682
+.LBE4350:
+.LBE4349:
+	.loc 1 311 384 is_stmt 1 view .LVU2683
+.LBB4351:
+.LBI4351:
+	.loc 2 1327 1 view .LVU2684
+.LBB4352:
+	.loc 2 1329 3 view .LVU2685
+	.loc 2 1329 3 is_stmt 0 view .LVU2686
+.LBE4352:
+.LBE4351:
+.LBB4354:
+.LBI4354:
+	.loc 2 1184 1 is_stmt 1 view .LVU2687
+.LBB4355:
+	.loc 2 1186 3 view .LVU2688
+.LBE4355:
+.LBE4354:
+.LBB4358:
+.LBB4359:
+# /usr/lib/gcc/x86_64-linux-gnu/12/include/emmintrin.h:1458:   return (__m128i)__builtin_ia32_pshufd ((__v4si)__A, __mask);
+	.loc 2 1458 19 is_stmt 0 view .LVU2689
+	pshufd	$57, %xmm1, %xmm1	#, tmp2009, tmp2021
+.LVL428:
+	.loc 2 1458 19 view .LVU2690
+.LBE4359:
+.LBE4358:
+.LBB4361:
+.LBB4353:
+# /usr/lib/gcc/x86_64-linux-gnu/12/include/emmintrin.h:1329:   return (__m128i) ((__v2du)__A ^ (__v2du)__B);
+	.loc 2 1329 33 view .LVU2691
+	pxor	%xmm2, %xmm0	# _1021, tmp2011
+.LVL429:
+	.loc 2 1329 33 view .LVU2692
+.LBE4353:
+.LBE4361:
+.LBB4362:
+.LBB4363:
+# /usr/lib/gcc/x86_64-linux-gnu/12/include/emmintrin.h:1458:   return (__m128i)__builtin_ia32_pshufd ((__v4si)__A, __mask);
+	.loc 2 1458 19 view .LVU2693
+	pshufd	$78, %xmm2, %xmm2	#, _1021, tmp2019
+.LVL430:
+	.loc 2 1458 19 view .LVU2694
+.LBE4363:
+.LBE4362:
+.LBB4365:
+.LBB4356:
+# /usr/lib/gcc/x86_64-linux-gnu/12/include/emmintrin.h:1186:   return (__m128i)__builtin_ia32_pslldi128 ((__v4si)__A, __B);
+	.loc 2 1186 19 view .LVU2695
+	movdqa	%xmm0, %xmm9	# tmp2011, tmp2012
+.LBE4356:
+.LBE4365:
+.LBB4366:
+.LBB4367:
+# /usr/lib/gcc/x86_64-linux-gnu/12/include/emmintrin.h:1251:   return (__m128i)__builtin_ia32_psrldi128 ((__v4si)__A, __B);
+	.loc 2 1251 19 view .LVU2696
+	psrld	$7, %xmm0	#, tmp2014
+.LVL431:
+	.loc 2 1251 19 view .LVU2697
+.LBE4367:
+.LBE4366:
+.LBB4369:
+.LBB4357:
+# /usr/lib/gcc/x86_64-linux-gnu/12/include/emmintrin.h:1186:   return (__m128i)__builtin_ia32_pslldi128 ((__v4si)__A, __B);
+	.loc 2 1186 19 view .LVU2698
+	pslld	$25, %xmm9	#, tmp2012
+.LVL432:
+	.loc 2 1186 19 view .LVU2699
+.LBE4357:
+.LBE4369:
+.LBB4370:
+.LBI4366:
+	.loc 2 1249 1 is_stmt 1 view .LVU2700
+.LBB4368:
+	.loc 2 1251 3 view .LVU2701
+	.loc 2 1251 3 is_stmt 0 view .LVU2702
+.LBE4368:
+.LBE4370:
+.LBB4371:
+.LBI4371:
+	.loc 2 1321 1 is_stmt 1 view .LVU2703
+.LBB4372:
+	.loc 2 1323 3 view .LVU2704
+	.loc 2 1323 3 is_stmt 0 view .LVU2705
+.LBE4372:
+.LBE4371:
+	.loc 1 311 10 is_stmt 1 view .LVU2706
+	.loc 1 311 503 view .LVU2707
+.LBB4374:
+.LBI4374:
+	.loc 2 1456 1 view .LVU2708
+.LBB4375:
+	.loc 2 1458 3 view .LVU2709
+.LBE4375:
+.LBE4374:
+.LBB4377:
+.LBB4373:
+# /usr/lib/gcc/x86_64-linux-gnu/12/include/emmintrin.h:1323:   return (__m128i) ((__v2du)__A | (__v2du)__B);
+	.loc 2 1323 33 is_stmt 0 view .LVU2710
+	por	%xmm9, %xmm0	# tmp2012, tmp2017
+.LVL433:
+	.loc 2 1323 33 view .LVU2711
+.LBE4373:
+.LBE4377:
+.LBB4378:
+.LBB4379:
+# /usr/lib/gcc/x86_64-linux-gnu/12/include/smmintrin.h:168:   return (__m128i) __builtin_ia32_pblendw128 ((__v8hi)__X,
+	.loc 3 168 20 view .LVU2712
+	movdqa	%xmm5, %xmm9	# m2, tmp2023
+	pblendw	$192, %xmm4, %xmm9	#, m1, tmp2023
+.LBE4379:
+.LBE4378:
+.LBB4381:
+.LBB4376:
+# /usr/lib/gcc/x86_64-linux-gnu/12/include/emmintrin.h:1458:   return (__m128i)__builtin_ia32_pshufd ((__v4si)__A, __mask);
+	.loc 2 1458 19 view .LVU2713
+	pshufd	$147, %xmm0, %xmm0	#, tmp2017, tmp2016
+.LVL434:
+	.loc 2 1458 19 view .LVU2714
+.LBE4376:
+.LBE4381:
+	.loc 1 311 7 is_stmt 1 view .LVU2715
+.LBB4382:
+.LBI4362:
+	.loc 2 1456 1 view .LVU2716
+.LBB4364:
+	.loc 2 1458 3 view .LVU2717
+	.loc 2 1458 3 is_stmt 0 view .LVU2718
+.LBE4364:
+.LBE4382:
+	.loc 1 311 7 is_stmt 1 view .LVU2719
+.LBB4383:
+.LBI4358:
+	.loc 2 1456 1 view .LVU2720
+.LBB4360:
+	.loc 2 1458 3 view .LVU2721
+	.loc 2 1458 3 is_stmt 0 view .LVU2722
+.LBE4360:
+.LBE4383:
+	.loc 1 311 8 is_stmt 1 view .LVU2723
+	.loc 1 312 5 view .LVU2724
+	.loc 1 312 10 view .LVU2725
+	.loc 1 312 15 view .LVU2726
+.LBB4384:
+.LBI4378:
+	.loc 3 166 1 view .LVU2727
+.LBB4380:
+	.loc 3 168 3 view .LVU2728
+	.loc 3 168 3 is_stmt 0 view .LVU2729
+.LBE4380:
+.LBE4384:
+	.loc 1 312 51 is_stmt 1 view .LVU2730
+.LBB4385:
+.LBI4385:
+	.loc 3 166 1 view .LVU2731
+.LBB4386:
+	.loc 3 168 3 view .LVU2732
+.LBE4386:
+.LBE4385:
+.LBB4388:
+.LBB4389:
+# /usr/lib/gcc/x86_64-linux-gnu/12/include/emmintrin.h:1458:   return (__m128i)__builtin_ia32_pshufd ((__v4si)__A, __mask);
+	.loc 2 1458 19 is_stmt 0 view .LVU2733
+	pshufd	$96, %xmm4, %xmm4	#, m1, tmp2033
+.LVL435:
+	.loc 2 1458 19 view .LVU2734
+.LBE4389:
+.LBE4388:
+.LBB4391:
+.LBB4387:
+# /usr/lib/gcc/x86_64-linux-gnu/12/include/smmintrin.h:168:   return (__m128i) __builtin_ia32_pblendw128 ((__v8hi)__X,
+	.loc 3 168 20 view .LVU2735
+	pblendw	$12, %xmm3, %xmm9	#, m0, tmp2026
+.LVL436:
+	.loc 3 168 20 view .LVU2736
+.LBE4387:
+.LBE4391:
+	.loc 1 312 87 is_stmt 1 view .LVU2737
+.LBB4392:
+.LBI4392:
+	.loc 2 1456 1 view .LVU2738
+.LBB4393:
+	.loc 2 1458 3 view .LVU2739
+.LBE4393:
+.LBE4392:
+.LBB4395:
+.LBB4396:
+# /usr/lib/gcc/x86_64-linux-gnu/12/include/emmintrin.h:1458:   return (__m128i)__builtin_ia32_pshufd ((__v4si)__A, __mask);
+	.loc 2 1458 19 is_stmt 0 view .LVU2740
+	pshufd	$230, %xmm3, %xmm3	#, m0, tmp2031
+.LVL437:
+	.loc 2 1458 19 view .LVU2741
+.LBE4396:
+.LBE4395:
+.LBB4398:
+.LBB4394:
+	pshufd	$114, %xmm9, %xmm9	#, tmp2026, tmp2029
+.LVL438:
+	.loc 2 1458 19 view .LVU2742
+.LBE4394:
+.LBE4398:
+	.loc 1 312 7 is_stmt 1 view .LVU2743
+.LBB4399:
+.LBI4395:
+	.loc 2 1456 1 view .LVU2744
+.LBB4397:
+	.loc 2 1458 3 view .LVU2745
+	.loc 2 1458 3 is_stmt 0 view .LVU2746
+.LBE4397:
+.LBE4399:
+	.loc 1 312 7 is_stmt 1 view .LVU2747
+.LBB4400:
+.LBI4388:
+	.loc 2 1456 1 view .LVU2748
+.LBB4390:
+	.loc 2 1458 3 view .LVU2749
+	.loc 2 1458 3 is_stmt 0 view .LVU2750
+.LBE4390:
+.LBE4400:
+	.loc 1 312 7 is_stmt 1 view .LVU2751
+.LBB4401:
+.LBI4401:
+	.loc 3 166 1 view .LVU2752
+.LBB4402:
+	.loc 3 168 3 view .LVU2753
+# /usr/lib/gcc/x86_64-linux-gnu/12/include/smmintrin.h:168:   return (__m128i) __builtin_ia32_pblendw128 ((__v8hi)__X,
+	.loc 3 168 20 is_stmt 0 view .LVU2754
+	pblendw	$252, %xmm4, %xmm3	#, tmp2033, tmp2035
+.LVL439:
+	.loc 3 168 20 view .LVU2755
+.LBE4402:
+.LBE4401:
+	.loc 1 312 42 is_stmt 1 view .LVU2756
+.LBB4403:
+.LBI4403:
+	.loc 2 1456 1 view .LVU2757
+.LBB4404:
+	.loc 2 1458 3 view .LVU2758
+# /usr/lib/gcc/x86_64-linux-gnu/12/include/emmintrin.h:1458:   return (__m128i)__builtin_ia32_pshufd ((__v4si)__A, __mask);
+	.loc 2 1458 19 is_stmt 0 view .LVU2759
+	pshufd	$103, %xmm6, %xmm4	#, m3, tmp2038
+.LVL440:
+	.loc 2 1458 19 view .LVU2760
+.LBE4404:
+.LBE4403:
+	.loc 1 312 7 is_stmt 1 view .LVU2761
+	.loc 1 312 15 view .LVU2762
+.LBB4405:
+.LBI4405:
+	.loc 3 166 1 view .LVU2763
+.LBB4406:
+	.loc 3 168 3 view .LVU2764
+.LBE4406:
+.LBE4405:
+.LBB4408:
+.LBB4409:
+# /usr/lib/gcc/x86_64-linux-gnu/12/include/emmintrin.h:1066:   return (__m128i) ((__v4su)__A + (__v4su)__B);
+	.loc 2 1066 33 is_stmt 0 view .LVU2765
+	paddd	%xmm0, %xmm9	# tmp2016, tmp2054
+.LVL441:
+	.loc 2 1066 33 view .LVU2766
+.LBE4409:
+.LBE4408:
+.LBB4412:
+.LBB4407:
+# /usr/lib/gcc/x86_64-linux-gnu/12/include/smmintrin.h:168:   return (__m128i) __builtin_ia32_pblendw128 ((__v8hi)__X,
+	.loc 3 168 20 view .LVU2767
+	pblendw	$12, %xmm5, %xmm4	#, m2, tmp2040
+.LVL442:
+	.loc 3 168 20 view .LVU2768
+.LBE4407:
+.LBE4412:
+	.loc 1 312 50 is_stmt 1 view .LVU2769
+	.loc 1 312 7 view .LVU2770
+.LBB4413:
+.LBI4413:
+	.loc 3 166 1 view .LVU2771
+.LBB4414:
+	.loc 3 168 3 view .LVU2772
+.LBE4414:
+.LBE4413:
+.LBB4416:
+.LBB4417:
+# /usr/lib/gcc/x86_64-linux-gnu/12/include/emmintrin.h:1458:   return (__m128i)__builtin_ia32_pshufd ((__v4si)__A, __mask);
+	.loc 2 1458 19 is_stmt 0 view .LVU2773
+	pshufd	$200, %xmm6, %xmm6	#, m3, tmp2046
+.LVL443:
+	.loc 2 1458 19 view .LVU2774
+.LBE4417:
+.LBE4416:
+.LBB4419:
+.LBB4420:
+# /usr/lib/gcc/x86_64-linux-gnu/12/include/smmintrin.h:168:   return (__m128i) __builtin_ia32_pblendw128 ((__v8hi)__X,
+	.loc 3 168 20 view .LVU2775
+	movdqa	-8(%rsp), %xmm5	# %sfp, tmp2048
+.LVL444:
+	.loc 3 168 20 view .LVU2776
+.LBE4420:
+.LBE4419:
+.LBB4423:
+.LBB4410:
+# /usr/lib/gcc/x86_64-linux-gnu/12/include/emmintrin.h:1066:   return (__m128i) ((__v4su)__A + (__v4su)__B);
+	.loc 2 1066 33 view .LVU2777
+	paddd	%xmm10, %xmm9	# _1014, _1056
+.LBE4410:
+.LBE4423:
+.LBB4424:
+.LBB4415:
+# /usr/lib/gcc/x86_64-linux-gnu/12/include/smmintrin.h:168:   return (__m128i) __builtin_ia32_pblendw128 ((__v8hi)__X,
+	.loc 3 168 20 view .LVU2778
+	pblendw	$48, %xmm8, %xmm4	#, tmp1957, tmp2043
+.LVL445:
+	.loc 3 168 20 view .LVU2779
+.LBE4415:
+.LBE4424:
+	.loc 1 312 42 is_stmt 1 view .LVU2780
+	.loc 1 312 7 view .LVU2781
+.LBB4425:
+.LBI4416:
+	.loc 2 1456 1 view .LVU2782
+.LBB4418:
+	.loc 2 1458 3 view .LVU2783
+	.loc 2 1458 3 is_stmt 0 view .LVU2784
+.LBE4418:
+.LBE4425:
+	.loc 1 312 7 is_stmt 1 view .LVU2785
+.LBB4426:
+.LBI4419:
+	.loc 3 166 1 view .LVU2786
+.LBB4421:
+	.loc 3 168 3 view .LVU2787
+.LBE4421:
+.LBE4426:
+.LBB4427:
+.LBB4428:
+# /usr/lib/gcc/x86_64-linux-gnu/12/include/emmintrin.h:1329:   return (__m128i) ((__v2du)__A ^ (__v2du)__B);
+	.loc 2 1329 33 is_stmt 0 view .LVU2788
+	pxor	%xmm9, %xmm1	# _1056, tmp2055
+.LVL446:
+	.loc 2 1329 33 view .LVU2789
+.LBE4428:
+.LBE4427:
+.LBB4430:
+.LBB4422:
+# /usr/lib/gcc/x86_64-linux-gnu/12/include/smmintrin.h:168:   return (__m128i) __builtin_ia32_pblendw128 ((__v8hi)__X,
+	.loc 3 168 20 view .LVU2790
+	pblendw	$60, %xmm6, %xmm5	#, tmp2046, tmp2048
+.LVL447:
+	.loc 3 168 20 view .LVU2791
+.LBE4422:
+.LBE4430:
+	.loc 1 312 42 is_stmt 1 view .LVU2792
+	.loc 1 312 7 view .LVU2793
+.LBB4431:
+.LBI4431:
+	.loc 3 166 1 view .LVU2794
+.LBB4432:
+	.loc 3 168 3 view .LVU2795
+.LBE4432:
+.LBE4431:
+.LBB4434:
+.LBB4435:
+# /usr/lib/gcc/x86_64-linux-gnu/12/include/tmmintrin.h:138:   return (__m128i) __builtin_ia32_pshufb128 ((__v16qi)__X, (__v16qi)__Y);
+	.loc 4 138 20 is_stmt 0 view .LVU2796
+	pshufb	.LC0(%rip), %xmm1	#, tmp2056
+.LBE4435:
+.LBE4434:
+.LBB4437:
+.LBB4433:
+# /usr/lib/gcc/x86_64-linux-gnu/12/include/smmintrin.h:168:   return (__m128i) __builtin_ia32_pblendw128 ((__v8hi)__X,
+	.loc 3 168 20 view .LVU2797
+	pblendw	$192, %xmm7, %xmm5	#, tmp1947, tmp2051
+.LVL448:
+	.loc 3 168 20 view .LVU2798
+.LBE4433:
+.LBE4437:
+	.loc 1 312 13 is_stmt 1 view .LVU2799
+	.loc 1 312 55 view .LVU2800
+	.loc 1 312 60 view .LVU2801
+.LBB4438:
+.LBI4438:
+	.loc 2 1064 1 view .LVU2802
+.LBB4439:
+	.loc 2 1066 3 view .LVU2803
+	.loc 2 1066 3 is_stmt 0 view .LVU2804
+.LBE4439:
+.LBE4438:
+.LBB4440:
+.LBI4408:
+	.loc 2 1064 1 is_stmt 1 view .LVU2805
+.LBB4411:
+	.loc 2 1066 3 view .LVU2806
+	.loc 2 1066 3 is_stmt 0 view .LVU2807
+.LBE4411:
+.LBE4440:
+	.loc 1 312 109 is_stmt 1 view .LVU2808
+.LBB4441:
+.LBI4427:
+	.loc 2 1327 1 view .LVU2809
+.LBB4429:
+	.loc 2 1329 3 view .LVU2810
+	.loc 2 1329 3 is_stmt 0 view .LVU2811
+.LBE4429:
+.LBE4441:
+.LBB4442:
+.LBI4434:
+	.loc 4 136 1 is_stmt 1 view .LVU2812
+.LBB4436:
+	.loc 4 138 3 view .LVU2813
+	.loc 4 138 3 is_stmt 0 view .LVU2814
+.LBE4436:
+.LBE4442:
+	.loc 1 312 163 is_stmt 1 view .LVU2815
+.LBB4443:
+.LBI4443:
+	.loc 2 1064 1 view .LVU2816
+.LBB4444:
+	.loc 2 1066 3 view .LVU2817
+# /usr/lib/gcc/x86_64-linux-gnu/12/include/emmintrin.h:1066:   return (__m128i) ((__v4su)__A + (__v4su)__B);
+	.loc 2 1066 33 is_stmt 0 view .LVU2818
+	paddd	%xmm1, %xmm2	# tmp2056, _1064
+.LVL449:
+	.loc 2 1066 33 view .LVU2819
+.LBE4444:
+.LBE4443:
+	.loc 1 312 193 is_stmt 1 view .LVU2820
+.LBB4445:
+.LBI4445:
+	.loc 2 1327 1 view .LVU2821
+.LBB4446:
+	.loc 2 1329 3 view .LVU2822
+	.loc 2 1329 3 is_stmt 0 view .LVU2823
+.LBE4446:
+.LBE4445:
+.LBB4448:
+.LBI4448:
+	.loc 2 1184 1 is_stmt 1 view .LVU2824
+.LBB4449:
+	.loc 2 1186 3 view .LVU2825
+.LBE4449:
+.LBE4448:
+.LBB4452:
+.LBB4447:
+# /usr/lib/gcc/x86_64-linux-gnu/12/include/emmintrin.h:1329:   return (__m128i) ((__v2du)__A ^ (__v2du)__B);
+	.loc 2 1329 33 is_stmt 0 view .LVU2826
+	pxor	%xmm2, %xmm0	# _1064, tmp2058
+.LVL450:
+	.loc 2 1329 33 view .LVU2827
+.LBE4447:
+.LBE4452:
+.LBB4453:
+.LBB4450:
+# /usr/lib/gcc/x86_64-linux-gnu/12/include/emmintrin.h:1186:   return (__m128i)__builtin_ia32_pslldi128 ((__v4si)__A, __B);
+	.loc 2 1186 19 view .LVU2828
+	movdqa	%xmm0, %xmm6	# tmp2058, tmp2059
+.LBE4450:
+.LBE4453:
+.LBB4454:
+.LBB4455:
+# /usr/lib/gcc/x86_64-linux-gnu/12/include/emmintrin.h:1251:   return (__m128i)__builtin_ia32_psrldi128 ((__v4si)__A, __B);
+	.loc 2 1251 19 view .LVU2829
+	psrld	$12, %xmm0	#, tmp2061
+.LVL451:
+	.loc 2 1251 19 view .LVU2830
+.LBE4455:
+.LBE4454:
+.LBB4457:
+.LBB4451:
+# /usr/lib/gcc/x86_64-linux-gnu/12/include/emmintrin.h:1186:   return (__m128i)__builtin_ia32_pslldi128 ((__v4si)__A, __B);
+	.loc 2 1186 19 view .LVU2831
+	pslld	$20, %xmm6	#, tmp2059
+.LVL452:
+	.loc 2 1186 19 view .LVU2832
+.LBE4451:
+.LBE4457:
+.LBB4458:
+.LBI4454:
+	.loc 2 1249 1 is_stmt 1 view .LVU2833
+.LBB4456:
+	.loc 2 1251 3 view .LVU2834
+	.loc 2 1251 3 is_stmt 0 view .LVU2835
+.LBE4456:
+.LBE4458:
+.LBB4459:
+.LBI4459:
+	.loc 2 1321 1 is_stmt 1 view .LVU2836
+.LBB4460:
+	.loc 2 1323 3 view .LVU2837
+# /usr/lib/gcc/x86_64-linux-gnu/12/include/emmintrin.h:1323:   return (__m128i) ((__v2du)__A | (__v2du)__B);
+	.loc 2 1323 33 is_stmt 0 view .LVU2838
+	por	%xmm6, %xmm0	# tmp2059, _1073
+.LVL453:
+	.loc 2 1323 33 view .LVU2839
+.LBE4460:
+.LBE4459:
+	.loc 1 312 300 is_stmt 1 view .LVU2840
+.LBB4461:
+.LBI4461:
+	.loc 2 1064 1 view .LVU2841
+.LBB4462:
+	.loc 2 1066 3 view .LVU2842
+	.loc 2 1066 3 is_stmt 0 view .LVU2843
+.LBE4462:
+.LBE4461:
+.LBB4463:
+.LBI4463:
+	.loc 2 1064 1 is_stmt 1 view .LVU2844
+.LBB4464:
+	.loc 2 1066 3 view .LVU2845
+# /usr/lib/gcc/x86_64-linux-gnu/12/include/emmintrin.h:1066:   return (__m128i) ((__v4su)__A + (__v4su)__B);
+	.loc 2 1066 33 is_stmt 0 view .LVU2846
+	paddd	%xmm0, %xmm3	# _1073, tmp2063
+.LVL454:
+	.loc 2 1066 33 view .LVU2847
+	paddd	%xmm9, %xmm3	# _1056, _1077
+.LVL455:
+	.loc 2 1066 33 view .LVU2848
+.LBE4464:
+.LBE4463:
+	.loc 1 312 349 is_stmt 1 view .LVU2849
+.LBB4465:
+.LBI4465:
+	.loc 2 1327 1 view .LVU2850
+.LBB4466:
+	.loc 2 1329 3 view .LVU2851
+	.loc 2 1329 3 is_stmt 0 view .LVU2852
+.LBE4466:
+.LBE4465:
+.LBB4468:
+.LBI4468:
+	.loc 4 136 1 is_stmt 1 view .LVU2853
+.LBB4469:
+	.loc 4 138 3 view .LVU2854
+.LBE4469:
+.LBE4468:
+.LBB4471:
+.LBB4467:
+# /usr/lib/gcc/x86_64-linux-gnu/12/include/emmintrin.h:1329:   return (__m128i) ((__v2du)__A ^ (__v2du)__B);
+	.loc 2 1329 33 is_stmt 0 view .LVU2855
+	pxor	%xmm3, %xmm1	# _1077, tmp2064
+.LVL456:
+	.loc 2 1329 33 view .LVU2856
+.LBE4467:
+.LBE4471:
+.LBB4472:
+.LBB4470:
+# /usr/lib/gcc/x86_64-linux-gnu/12/include/tmmintrin.h:138:   return (__m128i) __builtin_ia32_pshufb128 ((__v16qi)__X, (__v16qi)__Y);
+	.loc 4 138 20 view .LVU2857
+	pshufb	.LC2(%rip), %xmm1	#, tmp2065
+.LVL457:
+	.loc 4 138 20 view .LVU2858
+.LBE4470:
+.LBE4472:
+	.loc 1 312 402 is_stmt 1 view .LVU2859
+.LBB4473:
+.LBI4473:
+	.loc 2 1064 1 view .LVU2860
+.LBB4474:
+	.loc 2 1066 3 view .LVU2861
+# /usr/lib/gcc/x86_64-linux-gnu/12/include/emmintrin.h:1066:   return (__m128i) ((__v4su)__A + (__v4su)__B);
+	.loc 2 1066 33 is_stmt 0 view .LVU2862
+	paddd	%xmm1, %xmm2	# tmp2065, _1084
+.LVL458:
+	.loc 2 1066 33 view .LVU2863
+.LBE4474:
+.LBE4473:
+	.loc 1 312 432 is_stmt 1 view .LVU2864
+.LBB4475:
+.LBI4475:
+	.loc 2 1327 1 view .LVU2865
+.LBB4476:
+	.loc 2 1329 3 view .LVU2866
+	.loc 2 1329 3 is_stmt 0 view .LVU2867
+.LBE4476:
+.LBE4475:
+.LBB4478:
+.LBI4478:
+	.loc 2 1184 1 is_stmt 1 view .LVU2868
+.LBB4479:
+	.loc 2 1186 3 view .LVU2869
+.LBE4479:
+.LBE4478:
+.LBB4482:
+.LBB4483:
+# /usr/lib/gcc/x86_64-linux-gnu/12/include/emmintrin.h:1458:   return (__m128i)__builtin_ia32_pshufd ((__v4si)__A, __mask);
+	.loc 2 1458 19 is_stmt 0 view .LVU2870
+	pshufd	$147, %xmm1, %xmm1	#, tmp2065, tmp2077
+.LVL459:
+	.loc 2 1458 19 view .LVU2871
+.LBE4483:
+.LBE4482:
+.LBB4485:
+.LBB4477:
+# /usr/lib/gcc/x86_64-linux-gnu/12/include/emmintrin.h:1329:   return (__m128i) ((__v2du)__A ^ (__v2du)__B);
+	.loc 2 1329 33 view .LVU2872
+	pxor	%xmm2, %xmm0	# _1084, tmp2067
+.LVL460:
+	.loc 2 1329 33 view .LVU2873
+.LBE4477:
+.LBE4485:
+.LBB4486:
+.LBB4487:
+# /usr/lib/gcc/x86_64-linux-gnu/12/include/emmintrin.h:1458:   return (__m128i)__builtin_ia32_pshufd ((__v4si)__A, __mask);
+	.loc 2 1458 19 view .LVU2874
+	pshufd	$78, %xmm2, %xmm2	#, _1084, tmp2075
+.LVL461:
+	.loc 2 1458 19 view .LVU2875
+.LBE4487:
+.LBE4486:
+.LBB4489:
+.LBB4480:
+# /usr/lib/gcc/x86_64-linux-gnu/12/include/emmintrin.h:1186:   return (__m128i)__builtin_ia32_pslldi128 ((__v4si)__A, __B);
+	.loc 2 1186 19 view .LVU2876
+	movdqa	%xmm0, %xmm6	# tmp2067, tmp2068
+.LBE4480:
+.LBE4489:
+.LBB4490:
+.LBB4491:
+# /usr/lib/gcc/x86_64-linux-gnu/12/include/emmintrin.h:1251:   return (__m128i)__builtin_ia32_psrldi128 ((__v4si)__A, __B);
+	.loc 2 1251 19 view .LVU2877
+	psrld	$7, %xmm0	#, tmp2070
+.LVL462:
+	.loc 2 1251 19 view .LVU2878
+.LBE4491:
+.LBE4490:
+.LBB4493:
+.LBB4481:
+# /usr/lib/gcc/x86_64-linux-gnu/12/include/emmintrin.h:1186:   return (__m128i)__builtin_ia32_pslldi128 ((__v4si)__A, __B);
+	.loc 2 1186 19 view .LVU2879
+	pslld	$25, %xmm6	#, tmp2068
+.LVL463:
+	.loc 2 1186 19 view .LVU2880
+.LBE4481:
+.LBE4493:
+.LBB4494:
+.LBI4490:
+	.loc 2 1249 1 is_stmt 1 view .LVU2881
+.LBB4492:
+	.loc 2 1251 3 view .LVU2882
+	.loc 2 1251 3 is_stmt 0 view .LVU2883
+.LBE4492:
+.LBE4494:
+.LBB4495:
+.LBI4495:
+	.loc 2 1321 1 is_stmt 1 view .LVU2884
+.LBB4496:
+	.loc 2 1323 3 view .LVU2885
+	.loc 2 1323 3 is_stmt 0 view .LVU2886
+.LBE4496:
+.LBE4495:
+	.loc 1 312 58 is_stmt 1 view .LVU2887
+	.loc 1 312 551 view .LVU2888
+.LBB4498:
+.LBI4498:
+	.loc 2 1456 1 view .LVU2889
+.LBB4499:
+	.loc 2 1458 3 view .LVU2890
+.LBE4499:
+.LBE4498:
+.LBB4501:
+.LBB4497:
+# /usr/lib/gcc/x86_64-linux-gnu/12/include/emmintrin.h:1323:   return (__m128i) ((__v2du)__A | (__v2du)__B);
+	.loc 2 1323 33 is_stmt 0 view .LVU2891
+	por	%xmm6, %xmm0	# tmp2068, tmp2073
+.LVL464:
+	.loc 2 1323 33 view .LVU2892
+.LBE4497:
+.LBE4501:
+.LBB4502:
+.LBB4500:
+# /usr/lib/gcc/x86_64-linux-gnu/12/include/emmintrin.h:1458:   return (__m128i)__builtin_ia32_pshufd ((__v4si)__A, __mask);
+	.loc 2 1458 19 view .LVU2893
+	pshufd	$57, %xmm0, %xmm0	#, tmp2073, tmp2072
+.LVL465:
+	.loc 2 1458 19 view .LVU2894
+.LBE4500:
+.LBE4502:
+	.loc 1 312 7 is_stmt 1 view .LVU2895
+.LBB4503:
+.LBI4486:
+	.loc 2 1456 1 view .LVU2896
+.LBB4488:
+	.loc 2 1458 3 view .LVU2897
+	.loc 2 1458 3 is_stmt 0 view .LVU2898
+.LBE4488:
+.LBE4503:
+	.loc 1 312 7 is_stmt 1 view .LVU2899
+.LBB4504:
+.LBI4482:
+	.loc 2 1456 1 view .LVU2900
+.LBB4484:
+	.loc 2 1458 3 view .LVU2901
+	.loc 2 1458 3 is_stmt 0 view .LVU2902
+.LBE4484:
+.LBE4504:
+	.loc 1 312 7 is_stmt 1 view .LVU2903
+	.loc 1 312 12 view .LVU2904
+.LBB4505:
+.LBI4505:
+	.loc 2 1064 1 view .LVU2905
+.LBB4506:
+	.loc 2 1066 3 view .LVU2906
+	.loc 2 1066 3 is_stmt 0 view .LVU2907
+.LBE4506:
+.LBE4505:
+.LBB4507:
+.LBI4507:
+	.loc 2 1064 1 is_stmt 1 view .LVU2908
+.LBB4508:
+	.loc 2 1066 3 view .LVU2909
+# /usr/lib/gcc/x86_64-linux-gnu/12/include/emmintrin.h:1066:   return (__m128i) ((__v4su)__A + (__v4su)__B);
+	.loc 2 1066 33 is_stmt 0 view .LVU2910
+	paddd	%xmm0, %xmm4	# tmp2072, tmp2079
+.LVL466:
+	.loc 2 1066 33 view .LVU2911
+	paddd	%xmm3, %xmm4	# _1077, _1102
+.LVL467:
+	.loc 2 1066 33 view .LVU2912
+.LBE4508:
+.LBE4507:
+	.loc 1 312 61 is_stmt 1 view .LVU2913
+.LBB4509:
+.LBI4509:
+	.loc 2 1327 1 view .LVU2914
+.LBB4510:
+	.loc 2 1329 3 view .LVU2915
+	.loc 2 1329 3 is_stmt 0 view .LVU2916
+.LBE4510:
+.LBE4509:
+.LBB4512:
+.LBI4512:
+	.loc 4 136 1 is_stmt 1 view .LVU2917
+.LBB4513:
+	.loc 4 138 3 view .LVU2918
+.LBE4513:
+.LBE4512:
+.LBB4515:
+.LBB4511:
+# /usr/lib/gcc/x86_64-linux-gnu/12/include/emmintrin.h:1329:   return (__m128i) ((__v2du)__A ^ (__v2du)__B);
+	.loc 2 1329 33 is_stmt 0 view .LVU2919
+	pxor	%xmm4, %xmm1	# _1102, tmp2080
+.LVL468:
+	.loc 2 1329 33 view .LVU2920
+.LBE4511:
+.LBE4515:
+.LBB4516:
+.LBB4514:
+# /usr/lib/gcc/x86_64-linux-gnu/12/include/tmmintrin.h:138:   return (__m128i) __builtin_ia32_pshufb128 ((__v16qi)__X, (__v16qi)__Y);
+	.loc 4 138 20 view .LVU2921
+	pshufb	.LC0(%rip), %xmm1	#, tmp2081
+.LVL469:
+	.loc 4 138 20 view .LVU2922
+.LBE4514:
+.LBE4516:
+	.loc 1 312 115 is_stmt 1 view .LVU2923
+.LBB4517:
+.LBI4517:
+	.loc 2 1064 1 view .LVU2924
+.LBB4518:
+	.loc 2 1066 3 view .LVU2925
+# /usr/lib/gcc/x86_64-linux-gnu/12/include/emmintrin.h:1066:   return (__m128i) ((__v4su)__A + (__v4su)__B);
+	.loc 2 1066 33 is_stmt 0 view .LVU2926
+	paddd	%xmm1, %xmm2	# tmp2081, _1110
+.LVL470:
+	.loc 2 1066 33 view .LVU2927
+.LBE4518:
+.LBE4517:
+	.loc 1 312 145 is_stmt 1 view .LVU2928
+.LBB4519:
+.LBI4519:
+	.loc 2 1327 1 view .LVU2929
+.LBB4520:
+	.loc 2 1329 3 view .LVU2930
+	.loc 2 1329 3 is_stmt 0 view .LVU2931
+.LBE4520:
+.LBE4519:
+.LBB4522:
+.LBI4522:
+	.loc 2 1184 1 is_stmt 1 view .LVU2932
+.LBB4523:
+	.loc 2 1186 3 view .LVU2933
+.LBE4523:
+.LBE4522:
+.LBB4526:
+.LBB4521:
+# /usr/lib/gcc/x86_64-linux-gnu/12/include/emmintrin.h:1329:   return (__m128i) ((__v2du)__A ^ (__v2du)__B);
+	.loc 2 1329 33 is_stmt 0 view .LVU2934
+	pxor	%xmm2, %xmm0	# _1110, tmp2083
+.LVL471:
+	.loc 2 1329 33 view .LVU2935
+.LBE4521:
+.LBE4526:
+.LBB4527:
+.LBB4524:
+# /usr/lib/gcc/x86_64-linux-gnu/12/include/emmintrin.h:1186:   return (__m128i)__builtin_ia32_pslldi128 ((__v4si)__A, __B);
+	.loc 2 1186 19 view .LVU2936
+	movdqa	%xmm0, %xmm3	# tmp2083, tmp2084
+.LBE4524:
+.LBE4527:
+.LBB4528:
+.LBB4529:
+# /usr/lib/gcc/x86_64-linux-gnu/12/include/emmintrin.h:1251:   return (__m128i)__builtin_ia32_psrldi128 ((__v4si)__A, __B);
+	.loc 2 1251 19 view .LVU2937
+	psrld	$12, %xmm0	#, tmp2086
+.LVL472:
+	.loc 2 1251 19 view .LVU2938
+.LBE4529:
+.LBE4528:
+.LBB4531:
+.LBB4525:
+# /usr/lib/gcc/x86_64-linux-gnu/12/include/emmintrin.h:1186:   return (__m128i)__builtin_ia32_pslldi128 ((__v4si)__A, __B);
+	.loc 2 1186 19 view .LVU2939
+	pslld	$20, %xmm3	#, tmp2084
+.LVL473:
+	.loc 2 1186 19 view .LVU2940
+.LBE4525:
+.LBE4531:
+.LBB4532:
+.LBI4528:
+	.loc 2 1249 1 is_stmt 1 view .LVU2941
+.LBB4530:
+	.loc 2 1251 3 view .LVU2942
+	.loc 2 1251 3 is_stmt 0 view .LVU2943
+.LBE4530:
+.LBE4532:
+.LBB4533:
+.LBI4533:
+	.loc 2 1321 1 is_stmt 1 view .LVU2944
+.LBB4534:
+	.loc 2 1323 3 view .LVU2945
+# /usr/lib/gcc/x86_64-linux-gnu/12/include/emmintrin.h:1323:   return (__m128i) ((__v2du)__A | (__v2du)__B);
+	.loc 2 1323 33 is_stmt 0 view .LVU2946
+	por	%xmm3, %xmm0	# tmp2084, _1119
+.LVL474:
+	.loc 2 1323 33 view .LVU2947
+.LBE4534:
+.LBE4533:
+	.loc 1 312 252 is_stmt 1 view .LVU2948
+.LBB4535:
+.LBI4535:
+	.loc 2 1064 1 view .LVU2949
+.LBB4536:
+	.loc 2 1066 3 view .LVU2950
+	.loc 2 1066 3 is_stmt 0 view .LVU2951
+.LBE4536:
+.LBE4535:
+.LBB4537:
+.LBI4537:
+	.loc 2 1064 1 is_stmt 1 view .LVU2952
+.LBB4538:
+	.loc 2 1066 3 view .LVU2953
+	.loc 2 1066 3 is_stmt 0 view .LVU2954
+.LBE4538:
+.LBE4537:
+	.loc 1 312 301 is_stmt 1 view .LVU2955
+.LBB4540:
+.LBI4540:
+	.loc 2 1327 1 view .LVU2956
+.LBB4541:
+	.loc 2 1329 3 view .LVU2957
+.LBE4541:
+.LBE4540:
+.LBB4543:
+.LBB4539:
+# /usr/lib/gcc/x86_64-linux-gnu/12/include/emmintrin.h:1066:   return (__m128i) ((__v4su)__A + (__v4su)__B);
+	.loc 2 1066 33 is_stmt 0 view .LVU2958
+	paddd	%xmm0, %xmm5	# _1119, tmp2088
+.LVL475:
+	.loc 2 1066 33 view .LVU2959
+	paddd	%xmm4, %xmm5	# _1102, tmp2089
+.LVL476:
+	.loc 2 1066 33 view .LVU2960
+.LBE4539:
+.LBE4543:
+.LBB4544:
+.LBI4544:
+	.loc 4 136 1 is_stmt 1 view .LVU2961
+.LBB4545:
+	.loc 4 138 3 view .LVU2962
+.LBE4545:
+.LBE4544:
+.LBB4547:
+.LBB4542:
+# /usr/lib/gcc/x86_64-linux-gnu/12/include/emmintrin.h:1329:   return (__m128i) ((__v2du)__A ^ (__v2du)__B);
+	.loc 2 1329 33 is_stmt 0 view .LVU2963
+	pxor	%xmm5, %xmm1	# tmp2089, tmp2090
+.LVL477:
+	.loc 2 1329 33 view .LVU2964
+.LBE4542:
+.LBE4547:
+.LBB4548:
+.LBB4546:
+# /usr/lib/gcc/x86_64-linux-gnu/12/include/tmmintrin.h:138:   return (__m128i) __builtin_ia32_pshufb128 ((__v16qi)__X, (__v16qi)__Y);
+	.loc 4 138 20 view .LVU2965
+	pshufb	.LC2(%rip), %xmm1	#, tmp2091
+.LVL478:
+	.loc 4 138 20 view .LVU2966
+.LBE4546:
+.LBE4548:
+	.loc 1 312 354 is_stmt 1 view .LVU2967
+.LBB4549:
+.LBI4549:
+	.loc 2 1064 1 view .LVU2968
+.LBB4550:
+	.loc 2 1066 3 view .LVU2969
+# /usr/lib/gcc/x86_64-linux-gnu/12/include/emmintrin.h:1066:   return (__m128i) ((__v4su)__A + (__v4su)__B);
+	.loc 2 1066 33 is_stmt 0 view .LVU2970
+	paddd	%xmm1, %xmm2	# tmp2091, _1130
+.LVL479:
+	.loc 2 1066 33 view .LVU2971
+.LBE4550:
+.LBE4549:
+	.loc 1 312 384 is_stmt 1 view .LVU2972
+.LBB4551:
+.LBI4551:
+	.loc 2 1327 1 view .LVU2973
+.LBB4552:
+	.loc 2 1329 3 view .LVU2974
+	.loc 2 1329 3 is_stmt 0 view .LVU2975
+.LBE4552:
+.LBE4551:
+.LBB4554:
+.LBI4554:
+	.loc 2 1184 1 is_stmt 1 view .LVU2976
+.LBB4555:
+	.loc 2 1186 3 view .LVU2977
+.LBE4555:
+.LBE4554:
+.LBB4558:
+.LBB4559:
+# /usr/lib/gcc/x86_64-linux-gnu/12/include/emmintrin.h:1458:   return (__m128i)__builtin_ia32_pshufd ((__v4si)__A, __mask);
+	.loc 2 1458 19 is_stmt 0 view .LVU2978
+	pshufd	$57, %xmm1, %xmm1	#, tmp2091, tmp2103
+.LVL480:
+	.loc 2 1458 19 view .LVU2979
+.LBE4559:
+.LBE4558:
+.LBB4561:
+.LBB4553:
+# /usr/lib/gcc/x86_64-linux-gnu/12/include/emmintrin.h:1329:   return (__m128i) ((__v2du)__A ^ (__v2du)__B);
+	.loc 2 1329 33 view .LVU2980
+	pxor	%xmm2, %xmm0	# _1130, tmp2093
+.LVL481:
+	.loc 2 1329 33 view .LVU2981
+.LBE4553:
+.LBE4561:
+.LBB4562:
+.LBB4563:
+# /usr/lib/gcc/x86_64-linux-gnu/12/include/emmintrin.h:1458:   return (__m128i)__builtin_ia32_pshufd ((__v4si)__A, __mask);
+	.loc 2 1458 19 view .LVU2982
+	pshufd	$78, %xmm2, %xmm2	#, _1130, tmp2101
+.LVL482:
+	.loc 2 1458 19 view .LVU2983
+.LBE4563:
+.LBE4562:
+.LBB4565:
+.LBB4566:
+# /usr/lib/gcc/x86_64-linux-gnu/12/include/emmintrin.h:1329:   return (__m128i) ((__v2du)__A ^ (__v2du)__B);
+	.loc 2 1329 33 view .LVU2984
+	pxor	(%rdi), %xmm2	# *H_1147(D), tmp2105
+.LBE4566:
+.LBE4565:
+.LBB4569:
+.LBB4556:
+# /usr/lib/gcc/x86_64-linux-gnu/12/include/emmintrin.h:1186:   return (__m128i)__builtin_ia32_pslldi128 ((__v4si)__A, __B);
+	.loc 2 1186 19 view .LVU2985
+	movdqa	%xmm0, %xmm3	# tmp2093, tmp2094
+.LBE4556:
+.LBE4569:
+.LBB4570:
+.LBB4571:
+# /usr/lib/gcc/x86_64-linux-gnu/12/include/emmintrin.h:1251:   return (__m128i)__builtin_ia32_psrldi128 ((__v4si)__A, __B);
+	.loc 2 1251 19 view .LVU2986
+	psrld	$7, %xmm0	#, tmp2096
+.LVL483:
+	.loc 2 1251 19 view .LVU2987
+.LBE4571:
+.LBE4570:
+.LBB4573:
+.LBB4557:
+# /usr/lib/gcc/x86_64-linux-gnu/12/include/emmintrin.h:1186:   return (__m128i)__builtin_ia32_pslldi128 ((__v4si)__A, __B);
+	.loc 2 1186 19 view .LVU2988
+	pslld	$25, %xmm3	#, tmp2094
+.LVL484:
+	.loc 2 1186 19 view .LVU2989
+.LBE4557:
+.LBE4573:
+.LBB4574:
+.LBI4570:
+	.loc 2 1249 1 is_stmt 1 view .LVU2990
+.LBB4572:
+	.loc 2 1251 3 view .LVU2991
+	.loc 2 1251 3 is_stmt 0 view .LVU2992
+.LBE4572:
+.LBE4574:
+.LBB4575:
+.LBI4575:
+	.loc 2 1321 1 is_stmt 1 view .LVU2993
+.LBB4576:
+	.loc 2 1323 3 view .LVU2994
+	.loc 2 1323 3 is_stmt 0 view .LVU2995
+.LBE4576:
+.LBE4575:
+	.loc 1 312 10 is_stmt 1 view .LVU2996
+	.loc 1 312 503 view .LVU2997
+.LBB4578:
+.LBI4578:
+	.loc 2 1456 1 view .LVU2998
+.LBB4579:
+	.loc 2 1458 3 view .LVU2999
+.LBE4579:
+.LBE4578:
+.LBB4581:
+.LBB4567:
+# /usr/lib/gcc/x86_64-linux-gnu/12/include/emmintrin.h:1329:   return (__m128i) ((__v2du)__A ^ (__v2du)__B);
+	.loc 2 1329 33 is_stmt 0 view .LVU3000
+	pxor	%xmm5, %xmm2	# tmp2089, tmp2106
+.LBE4567:
+.LBE4581:
+.LBB4582:
+.LBB4577:
+# /usr/lib/gcc/x86_64-linux-gnu/12/include/emmintrin.h:1323:   return (__m128i) ((__v2du)__A | (__v2du)__B);
+	.loc 2 1323 33 view .LVU3001
+	por	%xmm3, %xmm0	# tmp2094, tmp2099
+.LVL485:
+	.loc 2 1323 33 view .LVU3002
+.LBE4577:
+.LBE4582:
+# blake2s-sse.c:314:     H[0] = xor(H[0], xor(va, vc));
+	.loc 1 314 10 view .LVU3003
+	movaps	%xmm2, (%rdi)	# tmp2106, *H_1147(D)
+.LBB4583:
+.LBB4580:
+# /usr/lib/gcc/x86_64-linux-gnu/12/include/emmintrin.h:1458:   return (__m128i)__builtin_ia32_pshufd ((__v4si)__A, __mask);
+	.loc 2 1458 19 view .LVU3004
+	pshufd	$147, %xmm0, %xmm0	#, tmp2099, tmp2098
+.LVL486:
+	.loc 2 1458 19 view .LVU3005
+.LBE4580:
+.LBE4583:
+	.loc 1 312 7 is_stmt 1 view .LVU3006
+.LBB4584:
+.LBI4562:
+	.loc 2 1456 1 view .LVU3007
+.LBB4564:
+	.loc 2 1458 3 view .LVU3008
+	.loc 2 1458 3 is_stmt 0 view .LVU3009
+.LBE4564:
+.LBE4584:
+	.loc 1 312 7 is_stmt 1 view .LVU3010
+.LBB4585:
+.LBI4558:
+	.loc 2 1456 1 view .LVU3011
+.LBB4560:
+	.loc 2 1458 3 view .LVU3012
+	.loc 2 1458 3 is_stmt 0 view .LVU3013
+.LBE4560:
+.LBE4585:
+	.loc 1 312 8 is_stmt 1 view .LVU3014
+	.loc 1 314 5 view .LVU3015
+.LBB4586:
+.LBI4586:
+	.loc 2 1327 1 view .LVU3016
+.LBB4587:
+	.loc 2 1329 3 view .LVU3017
+	.loc 2 1329 3 is_stmt 0 view .LVU3018
+.LBE4587:
+.LBE4586:
+.LBB4588:
+.LBI4565:
+	.loc 2 1327 1 is_stmt 1 view .LVU3019
+.LBB4568:
+	.loc 2 1329 3 view .LVU3020
+	.loc 2 1329 3 is_stmt 0 view .LVU3021
+.LBE4568:
+.LBE4588:
+	.loc 1 315 5 is_stmt 1 view .LVU3022
+.LBB4589:
+.LBI4589:
+	.loc 2 1327 1 view .LVU3023
+.LBB4590:
+	.loc 2 1329 3 view .LVU3024
+	.loc 2 1329 3 is_stmt 0 view .LVU3025
+.LBE4590:
+.LBE4589:
+.LBB4592:
+.LBI4592:
+	.loc 2 1327 1 is_stmt 1 view .LVU3026
+.LBB4593:
+	.loc 2 1329 3 view .LVU3027
+	.loc 2 1329 3 is_stmt 0 view .LVU3028
+.LBE4593:
+.LBE4592:
+.LBB4595:
+.LBB4591:
+# /usr/lib/gcc/x86_64-linux-gnu/12/include/emmintrin.h:1329:   return (__m128i) ((__v2du)__A ^ (__v2du)__B);
+	.loc 2 1329 33 view .LVU3029
+	pxor	%xmm1, %xmm0	# tmp2103, tmp2107
+.LVL487:
+	.loc 2 1329 33 view .LVU3030
+.LBE4591:
+.LBE4595:
+.LBB4596:
+.LBB4594:
+	pxor	16(%rdi), %xmm0	# MEM[(__m128i * {ref-all})H_1147(D) + 16B], tmp2108
+.LBE4594:
+.LBE4596:
+# blake2s-sse.c:315:     H[1] = xor(H[1], xor(vb, vd));
+	.loc 1 315 10 view .LVU3031
+	movaps	%xmm0, 16(%rdi)	# tmp2108, MEM[(__m128i * {ref-all})H_1147(D) + 16B]
+# blake2s-sse.c:316: }
+	.loc 1 316 1 view .LVU3032
+	addq	$32, %rsp	#,
+	.cfi_def_cfa_offset 8
+	ret	
+	.cfi_endproc
+.LFE6406:
+	.size	blake2s_10rounds.constprop.0, .-blake2s_10rounds.constprop.0
+	.p2align 4
+	.globl	blake2s_compress_sse
+	.type	blake2s_compress_sse, @function
+blake2s_compress_sse:
+.LVL488:
+.LFB6404:
+	.loc 1 319 1 is_stmt 1 view -0
+	.cfi_startproc
+	.loc 1 320 5 view .LVU3034
+	.loc 1 321 5 view .LVU3035
+	.loc 1 322 5 view .LVU3036
+	.loc 1 323 5 view .LVU3037
+	.loc 1 324 5 view .LVU3038
+.LBB4597:
+.LBI4597:
+	.loc 2 695 1 view .LVU3039
+.LBB4598:
+	.loc 2 697 3 view .LVU3040
+.LBE4598:
+.LBE4597:
+# blake2s-sse.c:319: {
+	.loc 1 319 1 is_stmt 0 view .LVU3041
+	subq	$40, %rsp	#,
+	.cfi_def_cfa_offset 48
+# blake2s-sse.c:319: {
+	.loc 1 319 1 view .LVU3042
+	movq	%rdi, %rax	# tmp105, ctx
+# blake2s-sse.c:325:     vb = H[1] = _mm_load_si128((const __m128i *)ctx->H + 1);
+	.loc 1 325 15 view .LVU3043
+	movdqa	16(%rdi), %xmm7	# MEM[(const __m128i * {ref-all})ctx_4(D) + 16B], tmp108
+.LBB4600:
+.LBB4599:
+# /usr/lib/gcc/x86_64-linux-gnu/12/include/emmintrin.h:697:   return *__P;
+	.loc 2 697 10 view .LVU3044
+	movdqa	(%rdi), %xmm0	# MEM[(const __m128i * {ref-all})ctx_4(D)], _19
+.LVL489:
+	.loc 2 697 10 view .LVU3045
+.LBE4599:
+.LBE4600:
+# blake2s-sse.c:330:     blake2s_10rounds(va,vb,vc,vd, H, _mm_loadu_si128(p + 0),
+	.loc 1 330 5 view .LVU3046
+	movdqu	(%rsi), %xmm3	# MEM[(const __m128i_u * {ref-all})m_3(D)],
+	movdqa	.LC3(%rip), %xmm2	#, tmp102
+	movq	%rsp, %rdi	#, tmp100
+.LVL490:
+	.loc 1 330 5 view .LVU3047
+	movdqu	48(%rsi), %xmm6	# MEM[(const __m128i_u * {ref-all})m_3(D) + 48B],
+	movdqu	32(%rsi), %xmm5	# MEM[(const __m128i_u * {ref-all})m_3(D) + 32B],
+	movdqa	%xmm7, %xmm1	# tmp108,
+# blake2s-sse.c:324:     va = H[0] = _mm_load_si128((const __m128i *)ctx->H + 0);
+	.loc 1 324 15 view .LVU3048
+	movaps	%xmm0, (%rsp)	# _19, H[0]
+.LVL491:
+	.loc 1 325 5 is_stmt 1 view .LVU3049
+.LBB4601:
+.LBI4601:
+	.loc 2 695 1 view .LVU3050
+.LBB4602:
+	.loc 2 697 3 view .LVU3051
+	.loc 2 697 3 is_stmt 0 view .LVU3052
+.LBE4602:
+.LBE4601:
+# blake2s-sse.c:330:     blake2s_10rounds(va,vb,vc,vd, H, _mm_loadu_si128(p + 0),
+	.loc 1 330 5 view .LVU3053
+	movdqu	16(%rsi), %xmm4	# MEM[(const __m128i_u * {ref-all})m_3(D) + 16B],
+	pxor	96(%rax), %xmm2	# MEM[(const __m128i * {ref-all})ctx_4(D) + 96B],
+# blake2s-sse.c:325:     vb = H[1] = _mm_load_si128((const __m128i *)ctx->H + 1);
+	.loc 1 325 15 view .LVU3054
+	movaps	%xmm7, 16(%rsp)	# tmp108, H[1]
+.LVL492:
+	.loc 1 326 11 is_stmt 1 view .LVU3055
+.LBB4603:
+.LBI4603:
+	.loc 2 695 1 view .LVU3056
+.LBB4604:
+	.loc 2 697 3 view .LVU3057
+	.loc 2 697 3 is_stmt 0 view .LVU3058
+.LBE4604:
+.LBE4603:
+	.loc 1 327 5 is_stmt 1 view .LVU3059
+	.loc 1 328 5 view .LVU3060
+.LBB4605:
+.LBI4605:
+	.loc 2 1327 1 view .LVU3061
+.LBB4606:
+	.loc 2 1329 3 view .LVU3062
+	.loc 2 1329 3 is_stmt 0 view .LVU3063
+.LBE4606:
+.LBE4605:
+	.loc 1 330 5 is_stmt 1 view .LVU3064
+.LBB4607:
+.LBI4607:
+	.loc 2 701 1 view .LVU3065
+.LBB4608:
+	.loc 2 703 3 view .LVU3066
+	.loc 2 703 3 is_stmt 0 view .LVU3067
+.LBE4608:
+.LBE4607:
+.LBB4609:
+.LBI4609:
+	.loc 2 701 1 is_stmt 1 view .LVU3068
+.LBB4610:
+	.loc 2 703 3 view .LVU3069
+	.loc 2 703 3 is_stmt 0 view .LVU3070
+.LBE4610:
+.LBE4609:
+.LBB4611:
+.LBI4611:
+	.loc 2 701 1 is_stmt 1 view .LVU3071
+.LBB4612:
+	.loc 2 703 3 view .LVU3072
+	.loc 2 703 3 is_stmt 0 view .LVU3073
+.LBE4612:
+.LBE4611:
+.LBB4613:
+.LBI4613:
+	.loc 2 701 1 is_stmt 1 view .LVU3074
+.LBB4614:
+	.loc 2 703 3 view .LVU3075
+	.loc 2 703 3 is_stmt 0 view .LVU3076
+.LBE4614:
+.LBE4613:
+# blake2s-sse.c:330:     blake2s_10rounds(va,vb,vc,vd, H, _mm_loadu_si128(p + 0),
+	.loc 1 330 5 view .LVU3077
+	call	blake2s_10rounds.constprop.0	#
+.LVL493:
+	.loc 1 334 5 is_stmt 1 view .LVU3078
+.LBB4615:
+.LBI4615:
+	.loc 2 731 1 view .LVU3079
+.LBB4616:
+	.loc 2 733 3 view .LVU3080
+# /usr/lib/gcc/x86_64-linux-gnu/12/include/emmintrin.h:733:   *__P = __B;
+	.loc 2 733 8 is_stmt 0 view .LVU3081
+	movdqa	(%rsp), %xmm1	# H[0], tmp109
+.LBE4616:
+.LBE4615:
+.LBB4618:
+.LBB4619:
+	movdqa	16(%rsp), %xmm3	# H[1], tmp110
+.LBE4619:
+.LBE4618:
+.LBB4621:
+.LBB4617:
+	movaps	%xmm1, (%rax)	# tmp109, MEM[(__m128i * {ref-all})ctx_4(D)]
+.LVL494:
+	.loc 2 733 8 view .LVU3082
+.LBE4617:
+.LBE4621:
+	.loc 1 335 5 is_stmt 1 view .LVU3083
+.LBB4622:
+.LBI4618:
+	.loc 2 731 1 view .LVU3084
+.LBB4620:
+	.loc 2 733 3 view .LVU3085
+# /usr/lib/gcc/x86_64-linux-gnu/12/include/emmintrin.h:733:   *__P = __B;
+	.loc 2 733 8 is_stmt 0 view .LVU3086
+	movaps	%xmm3, 16(%rax)	# tmp110, MEM[(__m128i * {ref-all})ctx_4(D) + 16B]
+.LVL495:
+	.loc 2 733 8 view .LVU3087
+.LBE4620:
+.LBE4622:
+# blake2s-sse.c:336: }
+	.loc 1 336 1 view .LVU3088
+	addq	$40, %rsp	#,
+	.cfi_def_cfa_offset 8
+	ret	
+	.cfi_endproc
+.LFE6404:
+	.size	blake2s_compress_sse, .-blake2s_compress_sse
+	.p2align 4
+	.globl	blake2s_compress_blocks_sse
+	.type	blake2s_compress_blocks_sse, @function
+blake2s_compress_blocks_sse:
+.LVL496:
+.LFB6405:
+	.loc 1 340 1 is_stmt 1 view -0
+	.cfi_startproc
+	.loc 1 342 5 view .LVU3090
+	.loc 1 343 5 view .LVU3091
+	.loc 1 344 5 view .LVU3092
+	.loc 1 345 5 view .LVU3093
+	.loc 1 346 5 view .LVU3094
+	.loc 1 348 5 view .LVU3095
+# blake2s-sse.c:348:     if (!nblocks)
+	.loc 1 348 8 is_stmt 0 view .LVU3096
+	testq	%rdx, %rdx	# nblocks
+	je	.L18	#,
+# blake2s-sse.c:340: {
+	.loc 1 340 1 view .LVU3097
+	subq	$184, %rsp	#,
+	.cfi_def_cfa_offset 192
+.LBB4623:
+.LBB4624:
+# /usr/lib/gcc/x86_64-linux-gnu/12/include/emmintrin.h:697:   return *__P;
+	.loc 2 697 10 view .LVU3098
+	movdqa	(%rdi), %xmm12	# MEM[(const __m128i * {ref-all})ctx_23(D)], pretmp_11
+.LBE4624:
+.LBE4623:
+.LBB4626:
+.LBB4627:
+# /usr/lib/gcc/x86_64-linux-gnu/12/include/emmintrin.h:703:   return *__P;
+	.loc 2 703 10 view .LVU3099
+	movdqu	(%rsi), %xmm3	# MEM[(const __m128i_u * {ref-all})m_21(D)], MEM[(const __m128i_u * {ref-all})m_21(D)]
+	movq	%rdi, %rcx	# tmp129, ctx
+.LBE4627:
+.LBE4626:
+	.loc 1 350 5 is_stmt 1 view .LVU3100
+.LVL497:
+.LBB4630:
+.LBI4623:
+	.loc 2 695 1 view .LVU3101
+.LBB4625:
+	.loc 2 697 3 view .LVU3102
+	.loc 2 697 3 is_stmt 0 view .LVU3103
+.LBE4625:
+.LBE4630:
+.LBB4631:
+.LBB4632:
+# /usr/lib/gcc/x86_64-linux-gnu/12/include/emmintrin.h:697:   return *__P;
+	.loc 2 697 10 view .LVU3104
+	movdqa	16(%rdi), %xmm1	# MEM[(const __m128i * {ref-all})ctx_23(D) + 16B], prephitmp_1
+.LBE4632:
+.LBE4631:
+.LBB4634:
+.LBB4635:
+# /usr/lib/gcc/x86_64-linux-gnu/12/include/emmintrin.h:703:   return *__P;
+	.loc 2 703 10 view .LVU3105
+	movdqu	16(%rsi), %xmm4	# MEM[(const __m128i_u * {ref-all})m_21(D) + 16B], MEM[(const __m128i_u * {ref-all})m_21(D) + 16B]
+.LBE4635:
+.LBE4634:
+.LBB4637:
+.LBB4638:
+	movdqu	32(%rsi), %xmm5	# MEM[(const __m128i_u * {ref-all})m_21(D) + 32B], MEM[(const __m128i_u * {ref-all})m_21(D) + 32B]
+.LBE4638:
+.LBE4637:
+.LBB4641:
+.LBB4642:
+	movdqu	48(%rsi), %xmm6	# MEM[(const __m128i_u * {ref-all})m_21(D) + 48B], MEM[(const __m128i_u * {ref-all})m_21(D) + 48B]
+.LBE4642:
+.LBE4641:
+# blake2s-sse.c:350:     H[0] = _mm_load_si128((const __m128i *)ctx->H + 0);
+	.loc 1 350 10 view .LVU3106
+	movaps	%xmm12, 144(%rsp)	# pretmp_11, H[0]
+	.loc 1 351 5 is_stmt 1 view .LVU3107
+.LVL498:
+.LBB4645:
+.LBI4631:
+	.loc 2 695 1 view .LVU3108
+.LBB4633:
+	.loc 2 697 3 view .LVU3109
+	.loc 2 697 3 is_stmt 0 view .LVU3110
+.LBE4633:
+.LBE4645:
+.LBB4646:
+.LBB4647:
+.LBB4648:
+# /usr/lib/gcc/x86_64-linux-gnu/12/include/emmintrin.h:1072:   return (__m128i) ((__v2du)__A + (__v2du)__B);
+	.loc 2 1072 33 view .LVU3111
+	movdqa	.LC4(%rip), %xmm0	#, _43
+	paddq	96(%rdi), %xmm0	# MEM[(const __m128i * {ref-all})ctx_23(D) + 96B], _43
+.LBE4648:
+.LBE4647:
+.LBE4646:
+.LBB4689:
+.LBB4628:
+# /usr/lib/gcc/x86_64-linux-gnu/12/include/emmintrin.h:703:   return *__P;
+	.loc 2 703 10 view .LVU3112
+	movaps	%xmm3, 80(%rsp)	# MEM[(const __m128i_u * {ref-all})m_21(D)], %sfp
+	leaq	144(%rsp), %rdi	#, tmp128
+.LVL499:
+	.loc 2 703 10 view .LVU3113
+.LBE4628:
+.LBE4689:
+.LBB4690:
+.LBB4654:
+.LBB4655:
+# /usr/lib/gcc/x86_64-linux-gnu/12/include/emmintrin.h:1329:   return (__m128i) ((__v2du)__A ^ (__v2du)__B);
+	.loc 2 1329 33 view .LVU3114
+	movdqa	.LC3(%rip), %xmm2	#, _73
+.LBE4655:
+.LBE4654:
+.LBE4690:
+# blake2s-sse.c:351:     H[1] = _mm_load_si128((const __m128i *)ctx->H + 1);
+	.loc 1 351 10 view .LVU3115
+	movaps	%xmm1, 160(%rsp)	# prephitmp_1, H[1]
+	.loc 1 352 5 is_stmt 1 view .LVU3116
+.LVL500:
+.LBB4691:
+.LBI4691:
+	.loc 2 695 1 view .LVU3117
+.LBB4692:
+	.loc 2 697 3 view .LVU3118
+	.loc 2 697 3 is_stmt 0 view .LVU3119
+.LBE4692:
+.LBE4691:
+	.loc 1 354 5 is_stmt 1 view .LVU3120
+.LBB4693:
+.LBI4626:
+	.loc 2 701 1 view .LVU3121
+.LBB4629:
+	.loc 2 703 3 view .LVU3122
+	.loc 2 703 3 is_stmt 0 view .LVU3123
+.LBE4629:
+.LBE4693:
+	.loc 1 355 5 is_stmt 1 view .LVU3124
+.LBB4694:
+.LBI4634:
+	.loc 2 701 1 view .LVU3125
+.LBB4636:
+	.loc 2 703 3 view .LVU3126
+# /usr/lib/gcc/x86_64-linux-gnu/12/include/emmintrin.h:703:   return *__P;
+	.loc 2 703 10 is_stmt 0 view .LVU3127
+	movaps	%xmm4, 96(%rsp)	# MEM[(const __m128i_u * {ref-all})m_21(D) + 16B], %sfp
+.LVL501:
+	.loc 2 703 10 view .LVU3128
+.LBE4636:
+.LBE4694:
+	.loc 1 356 5 is_stmt 1 view .LVU3129
+.LBB4695:
+.LBI4637:
+	.loc 2 701 1 view .LVU3130
+.LBB4639:
+	.loc 2 703 3 view .LVU3131
+.LBE4639:
+.LBE4695:
+.LBB4696:
+.LBB4661:
+.LBB4649:
+# /usr/lib/gcc/x86_64-linux-gnu/12/include/emmintrin.h:1072:   return (__m128i) ((__v2du)__A + (__v2du)__B);
+	.loc 2 1072 10 is_stmt 0 view .LVU3132
+	movdqa	%xmm0, %xmm7	# _43, _74
+.LBE4649:
+.LBE4661:
+.LBE4696:
+.LBB4697:
+.LBB4640:
+# /usr/lib/gcc/x86_64-linux-gnu/12/include/emmintrin.h:703:   return *__P;
+	.loc 2 703 10 view .LVU3133
+	movaps	%xmm5, 112(%rsp)	# MEM[(const __m128i_u * {ref-all})m_21(D) + 32B], %sfp
+.LVL502:
+	.loc 2 703 10 view .LVU3134
+.LBE4640:
+.LBE4697:
+	.loc 1 357 5 is_stmt 1 view .LVU3135
+.LBB4698:
+.LBI4641:
+	.loc 2 701 1 view .LVU3136
+.LBB4643:
+	.loc 2 703 3 view .LVU3137
+.LBE4643:
+.LBE4698:
+.LBB4699:
+.LBB4662:
+.LBB4656:
+# /usr/lib/gcc/x86_64-linux-gnu/12/include/emmintrin.h:1329:   return (__m128i) ((__v2du)__A ^ (__v2du)__B);
+	.loc 2 1329 33 is_stmt 0 view .LVU3138
+	pxor	%xmm0, %xmm2	# _43, _73
+.LBE4656:
+.LBE4662:
+.LBE4699:
+.LBB4700:
+.LBB4644:
+# /usr/lib/gcc/x86_64-linux-gnu/12/include/emmintrin.h:703:   return *__P;
+	.loc 2 703 10 view .LVU3139
+	movaps	%xmm6, 128(%rsp)	# MEM[(const __m128i_u * {ref-all})m_21(D) + 48B], %sfp
+.LVL503:
+	.loc 2 703 10 view .LVU3140
+.LBE4644:
+.LBE4700:
+	.loc 1 358 5 is_stmt 1 view .LVU3141
+	.loc 1 358 12 view .LVU3142
+.LBB4701:
+	.loc 1 359 9 view .LVU3143
+	.loc 1 361 9 view .LVU3144
+	.loc 1 362 9 view .LVU3145
+# blake2s-sse.c:362:         if (nblocks) {
+	.loc 1 362 12 is_stmt 0 view .LVU3146
+	subq	$1, %rdx	#, nblocks
+.LVL504:
+	.loc 1 362 12 view .LVU3147
+	je	.L8	#,
+# blake2s-sse.c:361:         p += 4;
+	.loc 1 361 11 view .LVU3148
+	addq	$64, %rsi	#, p
+.LVL505:
+	.loc 1 361 11 view .LVU3149
+	movdqa	%xmm12, %xmm0	# pretmp_11, pretmp_11
+.LVL506:
+	.p2align 4,,10
+	.p2align 3
+.L9:
+.LBB4663:
+.LBB4664:
+# /usr/lib/gcc/x86_64-linux-gnu/12/include/emmintrin.h:703:   return *__P;
+	.loc 2 703 10 view .LVU3150
+	movdqu	(%rsi), %xmm11	# MEM[(const __m128i_u * {ref-all})p_2], MEM[(const __m128i_u * {ref-all})p_2]
+.LBE4664:
+.LBE4663:
+.LBB4667:
+.LBB4668:
+	movdqu	16(%rsi), %xmm10	# MEM[(const __m128i_u * {ref-all})p_2 + 16B], MEM[(const __m128i_u * {ref-all})p_2 + 16B]
+	movaps	%xmm7, 64(%rsp)	# _74, %sfp
+.LVL507:
+	.loc 2 703 10 view .LVU3151
+.LBE4668:
+.LBE4667:
+	.loc 1 363 13 is_stmt 1 view .LVU3152
+.LBB4670:
+.LBI4663:
+	.loc 2 701 1 view .LVU3153
+.LBB4665:
+	.loc 2 703 3 view .LVU3154
+.LBE4665:
+.LBE4670:
+# blake2s-sse.c:361:         p += 4;
+	.loc 1 361 11 is_stmt 0 view .LVU3155
+	addq	$64, %rsi	#, p
+.LVL508:
+.LBB4671:
+.LBB4672:
+# /usr/lib/gcc/x86_64-linux-gnu/12/include/emmintrin.h:703:   return *__P;
+	.loc 2 703 10 view .LVU3156
+	movdqu	-32(%rsi), %xmm9	# MEM[(const __m128i_u * {ref-all})p_2 + 32B], MEM[(const __m128i_u * {ref-all})p_2 + 32B]
+.LBE4672:
+.LBE4671:
+.LBB4674:
+.LBB4675:
+	movdqu	-16(%rsi), %xmm8	# MEM[(const __m128i_u * {ref-all})p_2 + 48B], MEM[(const __m128i_u * {ref-all})p_2 + 48B]
+.LBE4675:
+.LBE4674:
+.LBB4677:
+.LBB4666:
+	movaps	%xmm11, 80(%rsp)	# MEM[(const __m128i_u * {ref-all})p_2], %sfp
+	movaps	%xmm11, 48(%rsp)	# MEM[(const __m128i_u * {ref-all})p_2], %sfp
+.LVL509:
+	.loc 2 703 10 view .LVU3157
+.LBE4666:
+.LBE4677:
+	.loc 1 364 13 is_stmt 1 view .LVU3158
+.LBB4678:
+.LBI4667:
+	.loc 2 701 1 view .LVU3159
+.LBB4669:
+	.loc 2 703 3 view .LVU3160
+# /usr/lib/gcc/x86_64-linux-gnu/12/include/emmintrin.h:703:   return *__P;
+	.loc 2 703 10 is_stmt 0 view .LVU3161
+	movaps	%xmm10, 96(%rsp)	# MEM[(const __m128i_u * {ref-all})p_2 + 16B], %sfp
+	movaps	%xmm10, 32(%rsp)	# MEM[(const __m128i_u * {ref-all})p_2 + 16B], %sfp
+.LVL510:
+	.loc 2 703 10 view .LVU3162
+.LBE4669:
+.LBE4678:
+	.loc 1 365 13 is_stmt 1 view .LVU3163
+.LBB4679:
+.LBI4671:
+	.loc 2 701 1 view .LVU3164
+.LBB4673:
+	.loc 2 703 3 view .LVU3165
+# /usr/lib/gcc/x86_64-linux-gnu/12/include/emmintrin.h:703:   return *__P;
+	.loc 2 703 10 is_stmt 0 view .LVU3166
+	movaps	%xmm9, 112(%rsp)	# MEM[(const __m128i_u * {ref-all})p_2 + 32B], %sfp
+	movaps	%xmm9, 16(%rsp)	# MEM[(const __m128i_u * {ref-all})p_2 + 32B], %sfp
+.LVL511:
+	.loc 2 703 10 view .LVU3167
+.LBE4673:
+.LBE4679:
+	.loc 1 366 13 is_stmt 1 view .LVU3168
+.LBB4680:
+.LBI4674:
+	.loc 2 701 1 view .LVU3169
+.LBB4676:
+	.loc 2 703 3 view .LVU3170
+# /usr/lib/gcc/x86_64-linux-gnu/12/include/emmintrin.h:703:   return *__P;
+	.loc 2 703 10 is_stmt 0 view .LVU3171
+	movaps	%xmm8, 128(%rsp)	# MEM[(const __m128i_u * {ref-all})p_2 + 48B], %sfp
+	movaps	%xmm8, (%rsp)	# MEM[(const __m128i_u * {ref-all})p_2 + 48B], %sfp
+.LVL512:
+	.loc 2 703 10 view .LVU3172
+.LBE4676:
+.LBE4680:
+	.loc 1 368 9 is_stmt 1 view .LVU3173
+.LBB4681:
+.LBI4647:
+	.loc 2 1070 1 view .LVU3174
+.LBB4650:
+	.loc 2 1072 3 view .LVU3175
+	.loc 2 1072 3 is_stmt 0 view .LVU3176
+.LBE4650:
+.LBE4681:
+	.loc 1 369 9 is_stmt 1 view .LVU3177
+.LBB4682:
+.LBI4654:
+	.loc 2 1327 1 view .LVU3178
+.LBB4657:
+	.loc 2 1329 3 view .LVU3179
+	.loc 2 1329 3 is_stmt 0 view .LVU3180
+.LBE4657:
+.LBE4682:
+# blake2s-sse.c:369:         blake2s_10rounds(H[0], H[1],
+	.loc 1 369 9 view .LVU3181
+	call	blake2s_10rounds.constprop.0	#
+.LVL513:
+	.loc 1 369 9 view .LVU3182
+.LBE4701:
+	.loc 1 358 12 is_stmt 1 view .LVU3183
+.LBB4702:
+.LBB4683:
+.LBB4651:
+# /usr/lib/gcc/x86_64-linux-gnu/12/include/emmintrin.h:1072:   return (__m128i) ((__v2du)__A + (__v2du)__B);
+	.loc 2 1072 33 is_stmt 0 view .LVU3184
+	movdqa	64(%rsp), %xmm7	# %sfp, _74
+.LBE4651:
+.LBE4683:
+# blake2s-sse.c:362:         if (nblocks) {
+	.loc 1 362 12 view .LVU3185
+	subq	$1, %rdx	#, nblocks
+.LVL514:
+.LBB4684:
+.LBB4652:
+# /usr/lib/gcc/x86_64-linux-gnu/12/include/emmintrin.h:1072:   return (__m128i) ((__v2du)__A + (__v2du)__B);
+	.loc 2 1072 33 view .LVU3186
+	paddq	.LC4(%rip), %xmm7	#, _71
+.LBE4652:
+.LBE4684:
+.LBB4685:
+.LBB4658:
+# /usr/lib/gcc/x86_64-linux-gnu/12/include/emmintrin.h:1329:   return (__m128i) ((__v2du)__A ^ (__v2du)__B);
+	.loc 2 1329 33 view .LVU3187
+	movdqa	.LC3(%rip), %xmm2	#, _73
+.LBE4658:
+.LBE4685:
+# blake2s-sse.c:362:         if (nblocks) {
+	.loc 1 362 12 view .LVU3188
+	movdqa	(%rsp), %xmm8	# %sfp, MEM[(const __m128i_u * {ref-all})p_2 + 48B]
+.LBE4702:
+# blake2s-sse.c:376:     _mm_store_si128((__m128i *)ctx->H + 1, H[1]);
+	.loc 1 376 5 view .LVU3189
+	movdqa	160(%rsp), %xmm1	# H[1], prephitmp_1
+.LBB4703:
+# blake2s-sse.c:362:         if (nblocks) {
+	.loc 1 362 12 view .LVU3190
+	movdqa	16(%rsp), %xmm9	# %sfp, MEM[(const __m128i_u * {ref-all})p_2 + 32B]
+.LBE4703:
+# blake2s-sse.c:375:     _mm_store_si128((__m128i *)ctx->H + 0, H[0]);
+	.loc 1 375 5 view .LVU3191
+	movdqa	144(%rsp), %xmm0	# H[0], pretmp_11
+.LVL515:
+.LBB4704:
+	.loc 1 359 9 is_stmt 1 view .LVU3192
+	.loc 1 361 9 view .LVU3193
+	.loc 1 362 9 view .LVU3194
+# blake2s-sse.c:362:         if (nblocks) {
+	.loc 1 362 12 is_stmt 0 view .LVU3195
+	movdqa	32(%rsp), %xmm10	# %sfp, MEM[(const __m128i_u * {ref-all})p_2 + 16B]
+.LBB4686:
+.LBB4659:
+# /usr/lib/gcc/x86_64-linux-gnu/12/include/emmintrin.h:1329:   return (__m128i) ((__v2du)__A ^ (__v2du)__B);
+	.loc 2 1329 33 view .LVU3196
+	pxor	%xmm7, %xmm2	# _71, _73
+.LBE4659:
+.LBE4686:
+# blake2s-sse.c:362:         if (nblocks) {
+	.loc 1 362 12 view .LVU3197
+	movdqa	48(%rsp), %xmm11	# %sfp, MEM[(const __m128i_u * {ref-all})p_2]
+	jne	.L10	#,
+	movdqa	%xmm0, %xmm12	# pretmp_11, pretmp_11
+.LVL516:
+.L8:
+# blake2s-sse.c:369:         blake2s_10rounds(H[0], H[1],
+	.loc 1 369 9 view .LVU3198
+	movdqa	96(%rsp), %xmm4	# %sfp,
+	movdqa	80(%rsp), %xmm3	# %sfp,
+	movdqa	%xmm12, %xmm0	# pretmp_11,
+	movaps	%xmm7, (%rsp)	# _74, %sfp
+	.loc 1 368 9 is_stmt 1 view .LVU3199
+.LVL517:
+.LBB4687:
+	.loc 2 1070 1 view .LVU3200
+.LBB4653:
+	.loc 2 1072 3 view .LVU3201
+	.loc 2 1072 3 is_stmt 0 view .LVU3202
+.LBE4653:
+.LBE4687:
+	.loc 1 369 9 is_stmt 1 view .LVU3203
+.LBB4688:
+	.loc 2 1327 1 view .LVU3204
+.LBB4660:
+	.loc 2 1329 3 view .LVU3205
+	.loc 2 1329 3 is_stmt 0 view .LVU3206
+.LBE4660:
+.LBE4688:
+# blake2s-sse.c:369:         blake2s_10rounds(H[0], H[1],
+	.loc 1 369 9 view .LVU3207
+	movdqa	128(%rsp), %xmm6	# %sfp,
+	movdqa	112(%rsp), %xmm5	# %sfp,
+	call	blake2s_10rounds.constprop.0	#
+.LVL518:
+	.loc 1 369 9 view .LVU3208
+.LBE4704:
+	.loc 1 358 12 is_stmt 1 view .LVU3209
+	.loc 1 375 5 view .LVU3210
+.LBB4705:
+.LBI4705:
+	.loc 2 731 1 view .LVU3211
+.LBB4706:
+	.loc 2 733 3 view .LVU3212
+.LBE4706:
+.LBE4705:
+.LBB4709:
+.LBB4710:
+# /usr/lib/gcc/x86_64-linux-gnu/12/include/emmintrin.h:733:   *__P = __B;
+	.loc 2 733 8 is_stmt 0 view .LVU3213
+	movdqa	(%rsp), %xmm7	# %sfp, _74
+.LBE4710:
+.LBE4709:
+.LBB4712:
+.LBB4707:
+	movdqa	144(%rsp), %xmm3	# H[0], tmp144
+.LBE4707:
+.LBE4712:
+.LBB4713:
+.LBB4714:
+	movdqa	160(%rsp), %xmm4	# H[1], tmp145
+.LBE4714:
+.LBE4713:
+.LBB4716:
+.LBB4708:
+	movaps	%xmm3, (%rcx)	# tmp144, MEM[(__m128i * {ref-all})ctx_23(D)]
+.LVL519:
+	.loc 2 733 8 view .LVU3214
+.LBE4708:
+.LBE4716:
+	.loc 1 376 5 is_stmt 1 view .LVU3215
+.LBB4717:
+.LBI4713:
+	.loc 2 731 1 view .LVU3216
+.LBB4715:
+	.loc 2 733 3 view .LVU3217
+# /usr/lib/gcc/x86_64-linux-gnu/12/include/emmintrin.h:733:   *__P = __B;
+	.loc 2 733 8 is_stmt 0 view .LVU3218
+	movaps	%xmm4, 16(%rcx)	# tmp145, MEM[(__m128i * {ref-all})ctx_23(D) + 16B]
+.LVL520:
+	.loc 2 733 8 view .LVU3219
+.LBE4715:
+.LBE4717:
+	.loc 1 377 5 is_stmt 1 view .LVU3220
+.LBB4718:
+.LBI4709:
+	.loc 2 731 1 view .LVU3221
+.LBB4711:
+	.loc 2 733 3 view .LVU3222
+# /usr/lib/gcc/x86_64-linux-gnu/12/include/emmintrin.h:733:   *__P = __B;
+	.loc 2 733 8 is_stmt 0 view .LVU3223
+	movaps	%xmm7, 96(%rcx)	# _74, MEM[(__m128i * {ref-all})ctx_23(D) + 96B]
+.LVL521:
+	.loc 2 733 8 view .LVU3224
+.LBE4711:
+.LBE4718:
+# blake2s-sse.c:378: }
+	.loc 1 378 1 view .LVU3225
+	addq	$184, %rsp	#,
+	.cfi_remember_state
+	.cfi_def_cfa_offset 8
+	ret	
+.LVL522:
+	.p2align 4,,10
+	.p2align 3
+.L10:
+	.cfi_restore_state
+.LBB4719:
+# blake2s-sse.c:366:             m3 = _mm_loadu_si128(p + 3);
+	.loc 1 366 18 view .LVU3226
+	movdqa	%xmm8, %xmm6	# MEM[(const __m128i_u * {ref-all})p_2 + 48B], m3
+# blake2s-sse.c:365:             m2 = _mm_loadu_si128(p + 2);
+	.loc 1 365 18 view .LVU3227
+	movdqa	%xmm9, %xmm5	# MEM[(const __m128i_u * {ref-all})p_2 + 32B], m2
+# blake2s-sse.c:364:             m1 = _mm_loadu_si128(p + 1);
+	.loc 1 364 18 view .LVU3228
+	movdqa	%xmm10, %xmm4	# MEM[(const __m128i_u * {ref-all})p_2 + 16B], m1
+# blake2s-sse.c:363:             m0 = _mm_loadu_si128(p + 0);
+	.loc 1 363 18 view .LVU3229
+	movdqa	%xmm11, %xmm3	# MEM[(const __m128i_u * {ref-all})p_2], m0
+	jmp	.L9	#
+.LVL523:
+	.p2align 4,,10
+	.p2align 3
+.L18:
+	.cfi_def_cfa_offset 8
+	.loc 1 363 18 view .LVU3230
+	ret	
+.LBE4719:
+	.cfi_endproc
+.LFE6405:
+	.size	blake2s_compress_blocks_sse, .-blake2s_compress_blocks_sse
+	.section	.rodata.cst16,"aM",@progbits,16
+	.align 16
+.LC0:
+	.byte	2
+	.byte	3
+	.byte	0
+	.byte	1
+	.byte	6
+	.byte	7
+	.byte	4
+	.byte	5
+	.byte	10
+	.byte	11
+	.byte	8
+	.byte	9
+	.byte	14
+	.byte	15
+	.byte	12
+	.byte	13
+	.align 16
+.LC1:
+	.long	1779033703
+	.long	-1150833019
+	.long	1013904242
+	.long	-1521486534
+	.align 16
+.LC2:
+	.byte	1
+	.byte	2
+	.byte	3
+	.byte	0
+	.byte	5
+	.byte	6
+	.byte	7
+	.byte	4
+	.byte	9
+	.byte	10
+	.byte	11
+	.byte	8
+	.byte	13
+	.byte	14
+	.byte	15
+	.byte	12
+	.align 16
+.LC3:
+	.quad	-7276294671082564993
+	.quad	6620516960021240235
+	.align 16
+.LC4:
+	.quad	64
+	.quad	0
+	.text
+.Letext0:
+	.file 5 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stddef.h"
+	.file 6 "/usr/include/x86_64-linux-gnu/bits/types.h"
+	.file 7 "/usr/include/x86_64-linux-gnu/bits/stdint-uintn.h"
+	.file 8 "blake2s.h"
+	.file 9 "blake2s-internal.h"
+	.section	.debug_info,"",@progbits
+.Ldebug_info0:
+	.long	0x86cd
+	.value	0x5
+	.byte	0x1
+	.byte	0x8
+	.long	.Ldebug_abbrev0
+	.uleb128 0x23
+	.long	.LASF55
+	.byte	0xc
+	.long	.LASF0
+	.long	.LASF1
+	.quad	.Ltext0
+	.quad	.Letext0-.Ltext0
+	.long	.Ldebug_line0
+	.uleb128 0x9
+	.byte	0x8
+	.byte	0x5
+	.long	.LASF2
+	.uleb128 0xa
+	.long	.LASF8
+	.byte	0x5
+	.byte	0xd6
+	.byte	0x1b
+	.long	0x41
+	.uleb128 0x9
+	.byte	0x8
+	.byte	0x7
+	.long	.LASF3
+	.uleb128 0x24
+	.byte	0x4
+	.byte	0x5
+	.string	"int"
+	.uleb128 0xd
+	.long	0x48
+	.uleb128 0x9
+	.byte	0x1
+	.byte	0x8
+	.long	.LASF4
+	.uleb128 0x9
+	.byte	0x2
+	.byte	0x7
+	.long	.LASF5
+	.uleb128 0x9
+	.byte	0x4
+	.byte	0x7
+	.long	.LASF6
+	.uleb128 0x9
+	.byte	0x1
+	.byte	0x6
+	.long	.LASF7
+	.uleb128 0xa
+	.long	.LASF9
+	.byte	0x6
+	.byte	0x26
+	.byte	0x17
+	.long	0x54
+	.uleb128 0x9
+	.byte	0x2
+	.byte	0x5
+	.long	.LASF10
+	.uleb128 0xa
+	.long	.LASF11
+	.byte	0x6
+	.byte	0x2a
+	.byte	0x16
+	.long	0x62
+	.uleb128 0x9
+	.byte	0x1
+	.byte	0x6
+	.long	.LASF12
+	.uleb128 0xa
+	.long	.LASF13
+	.byte	0x7
+	.byte	0x18
+	.byte	0x13
+	.long	0x70
+	.uleb128 0xa
+	.long	.LASF14
+	.byte	0x7
+	.byte	0x1a
+	.byte	0x14
+	.long	0x83
+	.uleb128 0x25
+	.long	.LASF56
+	.byte	0x80
+	.byte	0x10
+	.byte	0x8
+	.byte	0xf7
+	.byte	0x8
+	.long	0x108
+	.uleb128 0x15
+	.string	"H"
+	.byte	0xf8
+	.byte	0xe
+	.long	0x108
+	.byte	0
+	.uleb128 0x15
+	.string	"buf"
+	.byte	0xf9
+	.byte	0x13
+	.long	0x118
+	.byte	0x20
+	.uleb128 0x15
+	.string	"t"
+	.byte	0xfa
+	.byte	0xe
+	.long	0x128
+	.byte	0x60
+	.uleb128 0x15
+	.string	"f"
+	.byte	0xfb
+	.byte	0xe
+	.long	0x128
+	.byte	0x68
+	.uleb128 0x16
+	.long	.LASF15
+	.byte	0xfc
+	.long	0x62
+	.byte	0x70
+	.uleb128 0x16
+	.long	.LASF16
+	.byte	0xfd
+	.long	0x62
+	.byte	0x74
+	.uleb128 0x16
+	.long	.LASF17
+	.byte	0xfe
+	.long	0x62
+	.byte	0x78
+	.byte	0
+	.uleb128 0xe
+	.long	0xa2
+	.long	0x118
+	.uleb128 0xb
+	.long	0x41
+	.byte	0x7
+	.byte	0
+	.uleb128 0xe
+	.long	0x54
+	.long	0x128
+	.uleb128 0xb
+	.long	0x41
+	.byte	0x3f
+	.byte	0
+	.uleb128 0xe
+	.long	0xa2
+	.long	0x138
+	.uleb128 0xb
+	.long	0x41
+	.byte	0x1
+	.byte	0
+	.uleb128 0x12
+	.long	0xae
+	.uleb128 0x12
+	.long	0x142
+	.uleb128 0x26
+	.uleb128 0x9
+	.byte	0x8
+	.byte	0x7
+	.long	.LASF18
+	.uleb128 0x9
+	.byte	0x8
+	.byte	0x5
+	.long	.LASF19
+	.uleb128 0x1a
+	.string	"u8"
+	.byte	0x7
+	.byte	0x11
+	.long	0x96
+	.uleb128 0xd
+	.long	0x151
+	.uleb128 0x1a
+	.string	"u32"
+	.byte	0x8
+	.byte	0x12
+	.long	0xa2
+	.uleb128 0xd
+	.long	0x160
+	.uleb128 0xe
+	.long	0x16b
+	.long	0x180
+	.uleb128 0xb
+	.long	0x41
+	.byte	0x7
+	.byte	0
+	.uleb128 0xd
+	.long	0x170
+	.uleb128 0x1b
+	.long	.LASF20
+	.byte	0xa
+	.byte	0x12
+	.long	0x180
+	.byte	0x20
+	.byte	0x67
+	.byte	0xe6
+	.byte	0x9
+	.byte	0x6a
+	.byte	0x85
+	.byte	0xae
+	.byte	0x67
+	.byte	0xbb
+	.byte	0x72
+	.byte	0xf3
+	.byte	0x6e
+	.byte	0x3c
+	.byte	0x3a
+	.byte	0xf5
+	.byte	0x4f
+	.byte	0xa5
+	.byte	0x7f
+	.byte	0x52
+	.byte	0xe
+	.byte	0x51
+	.byte	0x8c
+	.byte	0x68
+	.byte	0x5
+	.byte	0x9b
+	.byte	0xab
+	.byte	0xd9
+	.byte	0x83
+	.byte	0x1f
+	.byte	0x19
+	.byte	0xcd
+	.byte	0xe0
+	.byte	0x5b
+	.uleb128 0xe
+	.long	0x15b
+	.long	0x1c7
+	.uleb128 0xb
+	.long	0x41
+	.byte	0x9
+	.uleb128 0xb
+	.long	0x41
+	.byte	0xf
+	.byte	0
+	.uleb128 0xd
+	.long	0x1b1
+	.uleb128 0x1b
+	.long	.LASF21
+	.byte	0xf
+	.byte	0x11
+	.long	0x1c7
+	.byte	0xa0
+	.byte	0
+	.byte	0x1
+	.byte	0x2
+	.byte	0x3
+	.byte	0x4
+	.byte	0x5
+	.byte	0x6
+	.byte	0x7
+	.byte	0x8
+	.byte	0x9
+	.byte	0xa
+	.byte	0xb
+	.byte	0xc
+	.byte	0xd
+	.byte	0xe
+	.byte	0xf
+	.byte	0xe
+	.byte	0xa
+	.byte	0x4
+	.byte	0x8
+	.byte	0x9
+	.byte	0xf
+	.byte	0xd
+	.byte	0x6
+	.byte	0x1
+	.byte	0xc
+	.byte	0
+	.byte	0x2
+	.byte	0xb
+	.byte	0x7
+	.byte	0x5
+	.byte	0x3
+	.byte	0xb
+	.byte	0x8
+	.byte	0xc
+	.byte	0
+	.byte	0x5
+	.byte	0x2
+	.byte	0xf
+	.byte	0xd
+	.byte	0xa
+	.byte	0xe
+	.byte	0x3
+	.byte	0x6
+	.byte	0x7
+	.byte	0x1
+	.byte	0x9
+	.byte	0x4
+	.byte	0x7
+	.byte	0x9
+	.byte	0x3
+	.byte	0x1
+	.byte	0xd
+	.byte	0xc
+	.byte	0xb
+	.byte	0xe
+	.byte	0x2
+	.byte	0x6
+	.byte	0x5
+	.byte	0xa
+	.byte	0x4
+	.byte	0
+	.byte	0xf
+	.byte	0x8
+	.byte	0x9
+	.byte	0
+	.byte	0x5
+	.byte	0x7
+	.byte	0x2
+	.byte	0x4
+	.byte	0xa
+	.byte	0xf
+	.byte	0xe
+	.byte	0x1
+	.byte	0xb
+	.byte	0xc
+	.byte	0x6
+	.byte	0x8
+	.byte	0x3
+	.byte	0xd
+	.byte	0x2
+	.byte	0xc
+	.byte	0x6
+	.byte	0xa
+	.byte	0
+	.byte	0xb
+	.byte	0x8
+	.byte	0x3
+	.byte	0x4
+	.byte	0xd
+	.byte	0x7
+	.byte	0x5
+	.byte	0xf
+	.byte	0xe
+	.byte	0x1
+	.byte	0x9
+	.byte	0xc
+	.byte	0x5
+	.byte	0x1
+	.byte	0xf
+	.byte	0xe
+	.byte	0xd
+	.byte	0x4
+	.byte	0xa
+	.byte	0
+	.byte	0x7
+	.byte	0x6
+	.byte	0x3
+	.byte	0x9
+	.byte	0x2
+	.byte	0x8
+	.byte	0xb
+	.byte	0xd
+	.byte	0xb
+	.byte	0x7
+	.byte	0xe
+	.byte	0xc
+	.byte	0x1
+	.byte	0x3
+	.byte	0x9
+	.byte	0x5
+	.byte	0
+	.byte	0xf
+	.byte	0x4
+	.byte	0x8
+	.byte	0x6
+	.byte	0x2
+	.byte	0xa
+	.byte	0x6
+	.byte	0xf
+	.byte	0xe
+	.byte	0x9
+	.byte	0xb
+	.byte	0x3
+	.byte	0
+	.byte	0x8
+	.byte	0xc
+	.byte	0x2
+	.byte	0xd
+	.byte	0x7
+	.byte	0x1
+	.byte	0x4
+	.byte	0xa
+	.byte	0x5
+	.byte	0xa
+	.byte	0x2
+	.byte	0x8
+	.byte	0x4
+	.byte	0x7
+	.byte	0x6
+	.byte	0x1
+	.byte	0x5
+	.byte	0xf
+	.byte	0xb
+	.byte	0x9
+	.byte	0xe
+	.byte	0x3
+	.byte	0xc
+	.byte	0xd
+	.byte	0
+	.uleb128 0x9
+	.byte	0x4
+	.byte	0x4
+	.long	.LASF22
+	.uleb128 0x9
+	.byte	0x8
+	.byte	0x4
+	.long	.LASF23
+	.uleb128 0xa
+	.long	.LASF24
+	.byte	0x2
+	.byte	0x29
+	.byte	0x13
+	.long	0x292
+	.uleb128 0x10
+	.long	0x14a
+	.long	0x29e
+	.uleb128 0x11
+	.byte	0x1
+	.byte	0
+	.uleb128 0xa
+	.long	.LASF25
+	.byte	0x2
+	.byte	0x2a
+	.byte	0x1c
+	.long	0x2aa
+	.uleb128 0x10
+	.long	0x143
+	.long	0x2b6
+	.uleb128 0x11
+	.byte	0x1
+	.byte	0
+	.uleb128 0xa
+	.long	.LASF26
+	.byte	0x2
+	.byte	0x2b
+	.byte	0xd
+	.long	0x2c2
+	.uleb128 0x10
+	.long	0x48
+	.long	0x2ce
+	.uleb128 0x11
+	.byte	0x3
+	.byte	0
+	.uleb128 0xa
+	.long	.LASF27
+	.byte	0x2
+	.byte	0x2c
+	.byte	0x16
+	.long	0x2da
+	.uleb128 0x10
+	.long	0x62
+	.long	0x2e6
+	.uleb128 0x11
+	.byte	0x3
+	.byte	0
+	.uleb128 0xa
+	.long	.LASF28
+	.byte	0x2
+	.byte	0x2d
+	.byte	0xf
+	.long	0x2f2
+	.uleb128 0x10
+	.long	0x7c
+	.long	0x2fe
+	.uleb128 0x11
+	.byte	0x7
+	.byte	0
+	.uleb128 0xa
+	.long	.LASF29
+	.byte	0x2
+	.byte	0x2f
+	.byte	0xe
+	.long	0x30a
+	.uleb128 0x10
+	.long	0x8f
+	.long	0x316
+	.uleb128 0x11
+	.byte	0xf
+	.byte	0
+	.uleb128 0xa
+	.long	.LASF30
+	.byte	0x2
+	.byte	0x35
+	.byte	0x13
+	.long	0x327
+	.uleb128 0xd
+	.long	0x316
+	.uleb128 0x10
+	.long	0x14a
+	.long	0x333
+	.uleb128 0x11
+	.byte	0x1
+	.byte	0
+	.uleb128 0x27
+	.long	.LASF57
+	.byte	0x2
+	.byte	0x39
+	.byte	0x13
+	.long	0x327
+	.byte	0x1
+	.uleb128 0xd
+	.long	0x333
+	.uleb128 0x9
+	.byte	0x2
+	.byte	0x4
+	.long	.LASF31
+	.uleb128 0xe
+	.long	0x16b
+	.long	0x362
+	.uleb128 0xb
+	.long	0x41
+	.byte	0x1
+	.uleb128 0xb
+	.long	0x41
+	.byte	0x3
+	.byte	0
+	.uleb128 0xd
+	.long	0x34c
+	.uleb128 0x17
+	.long	.LASF32
+	.byte	0x9
+	.byte	0x12
+	.long	0x362
+	.byte	0x20
+	.byte	0x67
+	.byte	0xe6
+	.byte	0x9
+	.byte	0x6a
+	.byte	0x85
+	.byte	0xae
+	.byte	0x67
+	.byte	0xbb
+	.byte	0x72
+	.byte	0xf3
+	.byte	0x6e
+	.byte	0x3c
+	.byte	0x3a
+	.byte	0xf5
+	.byte	0x4f
+	.byte	0xa5
+	.byte	0x7f
+	.byte	0x52
+	.byte	0xe
+	.byte	0x51
+	.byte	0x8c
+	.byte	0x68
+	.byte	0x5
+	.byte	0x9b
+	.byte	0xab
+	.byte	0xd9
+	.byte	0x83
+	.byte	0x1f
+	.byte	0x19
+	.byte	0xcd
+	.byte	0xe0
+	.byte	0x5b
+	.uleb128 0xe
+	.long	0x15b
+	.long	0x3a3
+	.uleb128 0xb
+	.long	0x41
+	.byte	0xf
+	.byte	0
+	.uleb128 0xd
+	.long	0x393
+	.uleb128 0x17
+	.long	.LASF33
+	.byte	0xf
+	.byte	0x11
+	.long	0x3a3
+	.byte	0x10
+	.byte	0x2
+	.byte	0x3
+	.byte	0
+	.byte	0x1
+	.byte	0x6
+	.byte	0x7
+	.byte	0x4
+	.byte	0x5
+	.byte	0xa
+	.byte	0xb
+	.byte	0x8
+	.byte	0x9
+	.byte	0xe
+	.byte	0xf
+	.byte	0xc
+	.byte	0xd
+	.uleb128 0x17
+	.long	.LASF34
+	.byte	0x11
+	.byte	0x11
+	.long	0x3a3
+	.byte	0x10
+	.byte	0x1
+	.byte	0x2
+	.byte	0x3
+	.byte	0
+	.byte	0x5
+	.byte	0x6
+	.byte	0x7
+	.byte	0x4
+	.byte	0x9
+	.byte	0xa
+	.byte	0xb
+	.byte	0x8
+	.byte	0xd
+	.byte	0xe
+	.byte	0xf
+	.byte	0xc
+	.uleb128 0x1c
+	.long	.LASF36
+	.value	0x152
+	.quad	.LFB6405
+	.quad	.LFE6405-.LFB6405
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0x7b3
+	.uleb128 0x18
+	.string	"ctx"
+	.value	0x152
+	.byte	0x36
+	.long	0x138
+	.long	.LLST1423
+	.long	.LVUS1423
+	.uleb128 0x18
+	.string	"m"
+	.value	0x152
+	.byte	0x47
+	.long	0x13d
+	.long	.LLST1424
+	.long	.LVUS1424
+	.uleb128 0x28
+	.long	.LASF35
+	.byte	0x1
+	.value	0x153
+	.byte	0x29
+	.long	0x35
+	.long	.LLST1425
+	.long	.LVUS1425
+	.uleb128 0x1d
+	.long	.LASF38
+	.value	0x156
+	.long	0x322
+	.uleb128 0x8
+	.string	"p"
+	.value	0x157
+	.byte	0x14
+	.long	0x7b3
+	.long	.LLST1426
+	.long	.LVUS1426
+	.uleb128 0x1e
+	.string	"H"
+	.value	0x158
+	.long	0x7b8
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -48
+	.uleb128 0x8
+	.string	"vpr"
+	.value	0x159
+	.byte	0xd
+	.long	0x316
+	.long	.LLST1427
+	.long	.LVUS1427
+	.uleb128 0x8
+	.string	"m0"
+	.value	0x15a
+	.byte	0xd
+	.long	0x316
+	.long	.LLST1428
+	.long	.LVUS1428
+	.uleb128 0x8
+	.string	"m1"
+	.value	0x15a
+	.byte	0x11
+	.long	0x316
+	.long	.LLST1429
+	.long	.LVUS1429
+	.uleb128 0x8
+	.string	"m2"
+	.value	0x15a
+	.byte	0x15
+	.long	0x316
+	.long	.LLST1430
+	.long	.LVUS1430
+	.uleb128 0x8
+	.string	"m3"
+	.value	0x15a
+	.byte	0x19
+	.long	0x316
+	.long	.LLST1431
+	.long	.LVUS1431
+	.uleb128 0x29
+	.long	.LLRL1444
+	.long	0x603
+	.uleb128 0x8
+	.string	"b0"
+	.value	0x167
+	.byte	0x11
+	.long	0x316
+	.long	.LLST1445
+	.long	.LVUS1445
+	.uleb128 0x8
+	.string	"b1"
+	.value	0x167
+	.byte	0x1a
+	.long	0x316
+	.long	.LLST1446
+	.long	.LVUS1446
+	.uleb128 0x8
+	.string	"b2"
+	.value	0x167
+	.byte	0x23
+	.long	0x316
+	.long	.LLST1447
+	.long	.LVUS1447
+	.uleb128 0x8
+	.string	"b3"
+	.value	0x167
+	.byte	0x2c
+	.long	0x316
+	.long	.LLST1448
+	.long	.LVUS1448
+	.uleb128 0x2
+	.long	0xc7d
+	.quad	.LBI4647
+	.value	.LVU3174
+	.long	.LLRL1449
+	.value	0x170
+	.byte	0xf
+	.long	0x53b
+	.uleb128 0x3
+	.long	0xc99
+	.uleb128 0x3
+	.long	0xc8c
+	.byte	0
+	.uleb128 0x2
+	.long	0xbd5
+	.quad	.LBI4654
+	.value	.LVU3178
+	.long	.LLRL1450
+	.value	0x171
+	.byte	0x9
+	.long	0x560
+	.uleb128 0x3
+	.long	0xbf1
+	.uleb128 0x3
+	.long	0xbe4
+	.byte	0
+	.uleb128 0x2
+	.long	0xcfa
+	.quad	.LBI4663
+	.value	.LVU3153
+	.long	.LLRL1451
+	.value	0x16b
+	.byte	0x12
+	.long	0x588
+	.uleb128 0x1
+	.long	0xd09
+	.long	.LLST1452
+	.long	.LVUS1452
+	.byte	0
+	.uleb128 0x2
+	.long	0xcfa
+	.quad	.LBI4667
+	.value	.LVU3159
+	.long	.LLRL1453
+	.value	0x16c
+	.byte	0x12
+	.long	0x5a8
+	.uleb128 0x3
+	.long	0xd09
+	.byte	0
+	.uleb128 0x2
+	.long	0xcfa
+	.quad	.LBI4671
+	.value	.LVU3164
+	.long	.LLRL1454
+	.value	0x16d
+	.byte	0x12
+	.long	0x5c8
+	.uleb128 0x3
+	.long	0xd09
+	.byte	0
+	.uleb128 0x2
+	.long	0xcfa
+	.quad	.LBI4674
+	.value	.LVU3169
+	.long	.LLRL1455
+	.value	0x16e
+	.byte	0x12
+	.long	0x5e8
+	.uleb128 0x3
+	.long	0xd09
+	.byte	0
+	.uleb128 0x1f
+	.quad	.LVL513
+	.long	0xd61
+	.uleb128 0x1f
+	.quad	.LVL518
+	.long	0xd61
+	.byte	0
+	.uleb128 0x2
+	.long	0xd1c
+	.quad	.LBI4623
+	.value	.LVU3101
+	.long	.LLRL1432
+	.value	0x15e
+	.byte	0xc
+	.long	0x62b
+	.uleb128 0x1
+	.long	0xd2b
+	.long	.LLST1433
+	.long	.LVUS1433
+	.byte	0
+	.uleb128 0x2
+	.long	0xcfa
+	.quad	.LBI4626
+	.value	.LVU3121
+	.long	.LLRL1434
+	.value	0x162
+	.byte	0xa
+	.long	0x653
+	.uleb128 0x1
+	.long	0xd09
+	.long	.LLST1435
+	.long	.LVUS1435
+	.byte	0
+	.uleb128 0x2
+	.long	0xd1c
+	.quad	.LBI4631
+	.value	.LVU3108
+	.long	.LLRL1436
+	.value	0x15f
+	.byte	0xc
+	.long	0x67b
+	.uleb128 0x1
+	.long	0xd2b
+	.long	.LLST1437
+	.long	.LVUS1437
+	.byte	0
+	.uleb128 0x2
+	.long	0xcfa
+	.quad	.LBI4634
+	.value	.LVU3125
+	.long	.LLRL1438
+	.value	0x163
+	.byte	0xa
+	.long	0x6a3
+	.uleb128 0x1
+	.long	0xd09
+	.long	.LLST1439
+	.long	.LVUS1439
+	.byte	0
+	.uleb128 0x2
+	.long	0xcfa
+	.quad	.LBI4637
+	.value	.LVU3130
+	.long	.LLRL1440
+	.value	0x164
+	.byte	0xa
+	.long	0x6cb
+	.uleb128 0x1
+	.long	0xd09
+	.long	.LLST1441
+	.long	.LVUS1441
+	.byte	0
+	.uleb128 0x2
+	.long	0xcfa
+	.quad	.LBI4641
+	.value	.LVU3136
+	.long	.LLRL1442
+	.value	0x165
+	.byte	0xa
+	.long	0x6f3
+	.uleb128 0x1
+	.long	0xd09
+	.long	.LLST1443
+	.long	.LVUS1443
+	.byte	0
+	.uleb128 0x5
+	.long	0xd1c
+	.quad	.LBI4691
+	.value	.LVU3117
+	.quad	.LBB4691
+	.quad	.LBE4691-.LBB4691
+	.value	0x160
+	.byte	0xb
+	.long	0x71f
+	.uleb128 0x3
+	.long	0xd2b
+	.byte	0
+	.uleb128 0x2
+	.long	0xcd1
+	.quad	.LBI4705
+	.value	.LVU3211
+	.long	.LLRL1456
+	.value	0x177
+	.byte	0x5
+	.long	0x754
+	.uleb128 0x1
+	.long	0xcec
+	.long	.LLST1457
+	.long	.LVUS1457
+	.uleb128 0x1
+	.long	0xcdf
+	.long	.LLST1458
+	.long	.LVUS1458
+	.byte	0
+	.uleb128 0x2
+	.long	0xcd1
+	.quad	.LBI4709
+	.value	.LVU3221
+	.long	.LLRL1459
+	.value	0x179
+	.byte	0x5
+	.long	0x781
+	.uleb128 0x3
+	.long	0xcec
+	.uleb128 0x1
+	.long	0xcdf
+	.long	.LLST1460
+	.long	.LVUS1460
+	.byte	0
+	.uleb128 0x20
+	.long	0xcd1
+	.quad	.LBI4713
+	.value	.LVU3216
+	.long	.LLRL1461
+	.value	0x178
+	.byte	0x5
+	.uleb128 0x1
+	.long	0xcec
+	.long	.LLST1462
+	.long	.LVUS1462
+	.uleb128 0x1
+	.long	0xcdf
+	.long	.LLST1463
+	.long	.LVUS1463
+	.byte	0
+	.byte	0
+	.uleb128 0x12
+	.long	0x322
+	.uleb128 0xe
+	.long	0x316
+	.long	0x7c8
+	.uleb128 0xb
+	.long	0x41
+	.byte	0x1
+	.byte	0
+	.uleb128 0x1c
+	.long	.LASF37
+	.value	0x13e
+	.quad	.LFB6404
+	.quad	.LFE6404-.LFB6404
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0xa84
+	.uleb128 0x18
+	.string	"ctx"
+	.value	0x13e
+	.byte	0x2f
+	.long	0x138
+	.long	.LLST1404
+	.long	.LVUS1404
+	.uleb128 0x2a
+	.string	"m"
+	.byte	0x1
+	.value	0x13e
+	.byte	0x40
+	.long	0x13d
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x8
+	.string	"p"
+	.value	0x140
+	.byte	0x14
+	.long	0x7b3
+	.long	.LLST1405
+	.long	.LVUS1405
+	.uleb128 0x1e
+	.string	"H"
+	.value	0x141
+	.long	0x7b8
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -48
+	.uleb128 0x8
+	.string	"va"
+	.value	0x142
+	.byte	0xd
+	.long	0x316
+	.long	.LLST1406
+	.long	.LVUS1406
+	.uleb128 0x8
+	.string	"vb"
+	.value	0x142
+	.byte	0x11
+	.long	0x316
+	.long	.LLST1407
+	.long	.LVUS1407
+	.uleb128 0xf
+	.string	"vc"
+	.value	0x142
+	.byte	0x15
+	.long	0x316
+	.uleb128 0xf
+	.string	"vd"
+	.value	0x142
+	.byte	0x19
+	.long	0x316
+	.uleb128 0x8
+	.string	"vpr"
+	.value	0x143
+	.byte	0xd
+	.long	0x316
+	.long	.LLST1408
+	.long	.LVUS1408
+	.uleb128 0x2
+	.long	0xd1c
+	.quad	.LBI4597
+	.value	.LVU3039
+	.long	.LLRL1409
+	.value	0x144
+	.byte	0x11
+	.long	0x89c
+	.uleb128 0x1
+	.long	0xd2b
+	.long	.LLST1410
+	.long	.LVUS1410
+	.byte	0
+	.uleb128 0x5
+	.long	0xd1c
+	.quad	.LBI4601
+	.value	.LVU3050
+	.quad	.LBB4601
+	.quad	.LBE4601-.LBB4601
+	.value	0x145
+	.byte	0x11
+	.long	0x8c8
+	.uleb128 0x3
+	.long	0xd2b
+	.byte	0
+	.uleb128 0x5
+	.long	0xd1c
+	.quad	.LBI4603
+	.value	.LVU3056
+	.quad	.LBB4603
+	.quad	.LBE4603-.LBB4603
+	.value	0x146
+	.byte	0x11
+	.long	0x8fc
+	.uleb128 0x1
+	.long	0xd2b
+	.long	.LLST1411
+	.long	.LVUS1411
+	.byte	0
+	.uleb128 0x5
+	.long	0xbd5
+	.quad	.LBI4605
+	.value	.LVU3061
+	.quad	.LBB4605
+	.quad	.LBE4605-.LBB4605
+	.value	0x148
+	.byte	0xa
+	.long	0x935
+	.uleb128 0x1
+	.long	0xbf1
+	.long	.LLST1412
+	.long	.LVUS1412
+	.uleb128 0x3
+	.long	0xbe4
+	.byte	0
+	.uleb128 0x5
+	.long	0xcfa
+	.quad	.LBI4607
+	.value	.LVU3065
+	.quad	.LBB4607
+	.quad	.LBE4607-.LBB4607
+	.value	0x14a
+	.byte	0x5
+	.long	0x969
+	.uleb128 0x1
+	.long	0xd09
+	.long	.LLST1413
+	.long	.LVUS1413
+	.byte	0
+	.uleb128 0x5
+	.long	0xcfa
+	.quad	.LBI4609
+	.value	.LVU3068
+	.quad	.LBB4609
+	.quad	.LBE4609-.LBB4609
+	.value	0x14a
+	.byte	0x5
+	.long	0x99d
+	.uleb128 0x1
+	.long	0xd09
+	.long	.LLST1414
+	.long	.LVUS1414
+	.byte	0
+	.uleb128 0x5
+	.long	0xcfa
+	.quad	.LBI4611
+	.value	.LVU3071
+	.quad	.LBB4611
+	.quad	.LBE4611-.LBB4611
+	.value	0x14a
+	.byte	0x5
+	.long	0x9d1
+	.uleb128 0x1
+	.long	0xd09
+	.long	.LLST1415
+	.long	.LVUS1415
+	.byte	0
+	.uleb128 0x5
+	.long	0xcfa
+	.quad	.LBI4613
+	.value	.LVU3074
+	.quad	.LBB4613
+	.quad	.LBE4613-.LBB4613
+	.value	0x14a
+	.byte	0x5
+	.long	0xa05
+	.uleb128 0x1
+	.long	0xd09
+	.long	.LLST1416
+	.long	.LVUS1416
+	.byte	0
+	.uleb128 0x2
+	.long	0xcd1
+	.quad	.LBI4615
+	.value	.LVU3079
+	.long	.LLRL1417
+	.value	0x14e
+	.byte	0x5
+	.long	0xa3a
+	.uleb128 0x1
+	.long	0xcec
+	.long	.LLST1418
+	.long	.LVUS1418
+	.uleb128 0x1
+	.long	0xcdf
+	.long	.LLST1419
+	.long	.LVUS1419
+	.byte	0
+	.uleb128 0x2
+	.long	0xcd1
+	.quad	.LBI4618
+	.value	.LVU3084
+	.long	.LLRL1420
+	.value	0x14f
+	.byte	0x5
+	.long	0xa6f
+	.uleb128 0x1
+	.long	0xcec
+	.long	.LLST1421
+	.long	.LVUS1421
+	.uleb128 0x1
+	.long	0xcdf
+	.long	.LLST1422
+	.long	.LVUS1422
+	.byte	0
+	.uleb128 0x2b
+	.quad	.LVL493
+	.long	0xd61
+	.uleb128 0x2c
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x75
+	.sleb128 0
+	.byte	0
+	.byte	0
+	.uleb128 0x2d
+	.long	.LASF58
+	.byte	0x1
+	.value	0x100
+	.byte	0x14
+	.byte	0x3
+	.long	0xb4b
+	.uleb128 0x7
+	.string	"va"
+	.byte	0x1
+	.value	0x100
+	.byte	0x2d
+	.long	0x316
+	.uleb128 0x7
+	.string	"vb"
+	.byte	0x1
+	.value	0x100
+	.byte	0x39
+	.long	0x316
+	.uleb128 0x7
+	.string	"vc"
+	.byte	0x1
+	.value	0x100
+	.byte	0x45
+	.long	0x316
+	.uleb128 0x7
+	.string	"vd"
+	.byte	0x1
+	.value	0x101
+	.byte	0x2d
+	.long	0x316
+	.uleb128 0x7
+	.string	"H"
+	.byte	0x1
+	.value	0x101
+	.byte	0x39
+	.long	0xb4b
+	.uleb128 0x7
+	.string	"m0"
+	.byte	0x1
+	.value	0x102
+	.byte	0x2d
+	.long	0x316
+	.uleb128 0x7
+	.string	"m1"
+	.byte	0x1
+	.value	0x102
+	.byte	0x39
+	.long	0x316
+	.uleb128 0x7
+	.string	"m2"
+	.byte	0x1
+	.value	0x103
+	.byte	0x2d
+	.long	0x316
+	.uleb128 0x7
+	.string	"m3"
+	.byte	0x1
+	.value	0x103
+	.byte	0x39
+	.long	0x316
+	.uleb128 0x1d
+	.long	.LASF39
+	.value	0x105
+	.long	0x322
+	.uleb128 0xf
+	.string	"vr8"
+	.value	0x106
+	.byte	0x13
+	.long	0x322
+	.uleb128 0xf
+	.string	"b0"
+	.value	0x107
+	.byte	0xd
+	.long	0x316
+	.uleb128 0xf
+	.string	"b1"
+	.value	0x107
+	.byte	0x11
+	.long	0x316
+	.uleb128 0xf
+	.string	"b2"
+	.value	0x107
+	.byte	0x15
+	.long	0x316
+	.uleb128 0xf
+	.string	"b3"
+	.value	0x107
+	.byte	0x19
+	.long	0x316
+	.uleb128 0xf
+	.string	"t"
+	.value	0x107
+	.byte	0x1d
+	.long	0x316
+	.byte	0
+	.uleb128 0x12
+	.long	0x316
+	.uleb128 0x21
+	.long	.LASF40
+	.byte	0x3
+	.byte	0xa6
+	.long	0x316
+	.long	0xb84
+	.uleb128 0x13
+	.string	"__X"
+	.byte	0x3
+	.byte	0xa6
+	.byte	0x1a
+	.long	0x316
+	.uleb128 0x13
+	.string	"__Y"
+	.byte	0x3
+	.byte	0xa6
+	.byte	0x27
+	.long	0x316
+	.uleb128 0x13
+	.string	"__M"
+	.byte	0x3
+	.byte	0xa6
+	.byte	0x36
+	.long	0x4f
+	.byte	0
+	.uleb128 0x21
+	.long	.LASF41
+	.byte	0x4
+	.byte	0x88
+	.long	0x316
+	.long	0xbac
+	.uleb128 0x13
+	.string	"__X"
+	.byte	0x4
+	.byte	0x88
+	.byte	0x1b
+	.long	0x316
+	.uleb128 0x13
+	.string	"__Y"
+	.byte	0x4
+	.byte	0x88
+	.byte	0x28
+	.long	0x316
+	.byte	0
+	.uleb128 0xc
+	.long	.LASF42
+	.value	0x5b0
+	.long	0x316
+	.long	0xbd5
+	.uleb128 0x7
+	.string	"__A"
+	.byte	0x2
+	.value	0x5b0
+	.byte	0x1c
+	.long	0x316
+	.uleb128 0x19
+	.long	.LASF43
+	.value	0x5b0
+	.byte	0x2b
+	.long	0x4f
+	.byte	0
+	.uleb128 0xc
+	.long	.LASF44
+	.value	0x52f
+	.long	0x316
+	.long	0xbff
+	.uleb128 0x7
+	.string	"__A"
+	.byte	0x2
+	.value	0x52f
+	.byte	0x18
+	.long	0x316
+	.uleb128 0x7
+	.string	"__B"
+	.byte	0x2
+	.value	0x52f
+	.byte	0x25
+	.long	0x316
+	.byte	0
+	.uleb128 0xc
+	.long	.LASF45
+	.value	0x529
+	.long	0x316
+	.long	0xc29
+	.uleb128 0x7
+	.string	"__A"
+	.byte	0x2
+	.value	0x529
+	.byte	0x17
+	.long	0x316
+	.uleb128 0x7
+	.string	"__B"
+	.byte	0x2
+	.value	0x529
+	.byte	0x24
+	.long	0x316
+	.byte	0
+	.uleb128 0xc
+	.long	.LASF46
+	.value	0x4e1
+	.long	0x316
+	.long	0xc53
+	.uleb128 0x7
+	.string	"__A"
+	.byte	0x2
+	.value	0x4e1
+	.byte	0x19
+	.long	0x316
+	.uleb128 0x7
+	.string	"__B"
+	.byte	0x2
+	.value	0x4e1
+	.byte	0x22
+	.long	0x48
+	.byte	0
+	.uleb128 0xc
+	.long	.LASF47
+	.value	0x4a0
+	.long	0x316
+	.long	0xc7d
+	.uleb128 0x7
+	.string	"__A"
+	.byte	0x2
+	.value	0x4a0
+	.byte	0x19
+	.long	0x316
+	.uleb128 0x7
+	.string	"__B"
+	.byte	0x2
+	.value	0x4a0
+	.byte	0x22
+	.long	0x48
+	.byte	0
+	.uleb128 0xc
+	.long	.LASF48
+	.value	0x42e
+	.long	0x316
+	.long	0xca7
+	.uleb128 0x7
+	.string	"__A"
+	.byte	0x2
+	.value	0x42e
+	.byte	0x18
+	.long	0x316
+	.uleb128 0x7
+	.string	"__B"
+	.byte	0x2
+	.value	0x42e
+	.byte	0x25
+	.long	0x316
+	.byte	0
+	.uleb128 0xc
+	.long	.LASF49
+	.value	0x428
+	.long	0x316
+	.long	0xcd1
+	.uleb128 0x7
+	.string	"__A"
+	.byte	0x2
+	.value	0x428
+	.byte	0x18
+	.long	0x316
+	.uleb128 0x7
+	.string	"__B"
+	.byte	0x2
+	.value	0x428
+	.byte	0x25
+	.long	0x316
+	.byte	0
+	.uleb128 0x2e
+	.long	.LASF59
+	.byte	0x2
+	.value	0x2db
+	.byte	0x1
+	.byte	0x3
+	.long	0xcfa
+	.uleb128 0x7
+	.string	"__P"
+	.byte	0x2
+	.value	0x2db
+	.byte	0x1b
+	.long	0xb4b
+	.uleb128 0x7
+	.string	"__B"
+	.byte	0x2
+	.value	0x2db
+	.byte	0x28
+	.long	0x316
+	.byte	0
+	.uleb128 0xc
+	.long	.LASF50
+	.value	0x2bd
+	.long	0x316
+	.long	0xd17
+	.uleb128 0x7
+	.string	"__P"
+	.byte	0x2
+	.value	0x2bd
+	.byte	0x23
+	.long	0xd17
+	.byte	0
+	.uleb128 0x12
+	.long	0x340
+	.uleb128 0xc
+	.long	.LASF51
+	.value	0x2b7
+	.long	0x316
+	.long	0xd39
+	.uleb128 0x7
+	.string	"__P"
+	.byte	0x2
+	.value	0x2b7
+	.byte	0x20
+	.long	0x7b3
+	.byte	0
+	.uleb128 0xc
+	.long	.LASF52
+	.value	0x24e
+	.long	0x316
+	.long	0xd61
+	.uleb128 0x19
+	.long	.LASF53
+	.value	0x24e
+	.byte	0x1b
+	.long	0x14a
+	.uleb128 0x19
+	.long	.LASF54
+	.value	0x24e
+	.byte	0x2b
+	.long	0x14a
+	.byte	0
+	.uleb128 0x2f
+	.long	0xa84
+	.quad	.LFB6406
+	.quad	.LFE6406-.LFB6406
+	.uleb128 0x1
+	.byte	0x9c
+	.uleb128 0x1
+	.long	0xa92
+	.long	.LLST0
+	.long	.LVUS0
+	.uleb128 0x1
+	.long	0xa9e
+	.long	.LLST1
+	.long	.LVUS1
+	.uleb128 0x1
+	.long	0xab6
+	.long	.LLST2
+	.long	.LVUS2
+	.uleb128 0x30
+	.long	0xac2
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x1
+	.long	0xacd
+	.long	.LLST3
+	.long	.LVUS3
+	.uleb128 0x1
+	.long	0xad9
+	.long	.LLST4
+	.long	.LVUS4
+	.uleb128 0x1
+	.long	0xae5
+	.long	.LLST5
+	.long	.LVUS5
+	.uleb128 0x1
+	.long	0xaf1
+	.long	.LLST6
+	.long	.LVUS6
+	.uleb128 0x22
+	.long	0xafd
+	.uleb128 0x22
+	.long	0xb08
+	.uleb128 0x14
+	.long	0xb14
+	.long	.LLST7
+	.long	.LVUS7
+	.uleb128 0x14
+	.long	0xb1f
+	.long	.LLST8
+	.long	.LVUS8
+	.uleb128 0x14
+	.long	0xb2a
+	.long	.LLST9
+	.long	.LVUS9
+	.uleb128 0x14
+	.long	0xb35
+	.long	.LLST10
+	.long	.LVUS10
+	.uleb128 0x14
+	.long	0xb40
+	.long	.LLST11
+	.long	.LVUS11
+	.uleb128 0x1
+	.long	0xaaa
+	.long	.LLST12
+	.long	.LVUS12
+	.uleb128 0x5
+	.long	0xbac
+	.quad	.LBI2465
+	.value	.LVU7
+	.quad	.LBB2465
+	.quad	.LBE2465-.LBB2465
+	.value	0x12f
+	.byte	0x14
+	.long	0xe73
+	.uleb128 0x1
+	.long	0xbc8
+	.long	.LLST13
+	.long	.LVUS13
+	.uleb128 0x1
+	.long	0xbbb
+	.long	.LLST14
+	.long	.LVUS14
+	.byte	0
+	.uleb128 0x5
+	.long	0xbac
+	.quad	.LBI2467
+	.value	.LVU12
+	.quad	.LBB2467
+	.quad	.LBE2467-.LBB2467
+	.value	0x12f
+	.byte	0xb
+	.long	0xeb4
+	.uleb128 0x1
+	.long	0xbc8
+	.long	.LLST15
+	.long	.LVUS15
+	.uleb128 0x1
+	.long	0xbbb
+	.long	.LLST16
+	.long	.LVUS16
+	.byte	0
+	.uleb128 0x2
+	.long	0xb50
+	.quad	.LBI2469
+	.value	.LVU17
+	.long	.LLRL17
+	.value	0x12f
+	.byte	0xc
+	.long	0xef6
+	.uleb128 0x1
+	.long	0xb77
+	.long	.LLST18
+	.long	.LVUS18
+	.uleb128 0x1
+	.long	0xb6b
+	.long	.LLST19
+	.long	.LVUS19
+	.uleb128 0x1
+	.long	0xb5f
+	.long	.LLST20
+	.long	.LVUS20
+	.byte	0
+	.uleb128 0x2
+	.long	0xca7
+	.quad	.LBI2473
+	.value	.LVU80
+	.long	.LLRL21
+	.value	0x12f
+	.byte	0x43
+	.long	0xf23
+	.uleb128 0x1
+	.long	0xcc3
+	.long	.LLST22
+	.long	.LVUS22
+	.uleb128 0x3
+	.long	0xcb6
+	.byte	0
+	.uleb128 0x2
+	.long	0xbac
+	.quad	.LBI2477
+	.value	.LVU31
+	.long	.LLRL23
+	.value	0x12f
+	.byte	0xb
+	.long	0xf58
+	.uleb128 0x1
+	.long	0xbc8
+	.long	.LLST24
+	.long	.LVUS24
+	.uleb128 0x1
+	.long	0xbbb
+	.long	.LLST25
+	.long	.LVUS25
+	.byte	0
+	.uleb128 0x2
+	.long	0xbac
+	.quad	.LBI2480
+	.value	.LVU27
+	.long	.LLRL26
+	.value	0x12f
+	.byte	0x2f
+	.long	0xf8d
+	.uleb128 0x1
+	.long	0xbc8
+	.long	.LLST27
+	.long	.LVUS27
+	.uleb128 0x1
+	.long	0xbbb
+	.long	.LLST28
+	.long	.LVUS28
+	.byte	0
+	.uleb128 0x5
+	.long	0xb50
+	.quad	.LBI2486
+	.value	.LVU35
+	.quad	.LBB2486
+	.quad	.LBE2486-.LBB2486
+	.value	0x12f
+	.byte	0xc
+	.long	0xfdb
+	.uleb128 0x1
+	.long	0xb77
+	.long	.LLST29
+	.long	.LVUS29
+	.uleb128 0x1
+	.long	0xb6b
+	.long	.LLST30
+	.long	.LVUS30
+	.uleb128 0x1
+	.long	0xb5f
+	.long	.LLST31
+	.long	.LVUS31
+	.byte	0
+	.uleb128 0x2
+	.long	0xbac
+	.quad	.LBI2488
+	.value	.LVU40
+	.long	.LLRL32
+	.value	0x12f
+	.byte	0x2f
+	.long	0x1010
+	.uleb128 0x1
+	.long	0xbc8
+	.long	.LLST33
+	.long	.LVUS33
+	.uleb128 0x1
+	.long	0xbbb
+	.long	.LLST34
+	.long	.LVUS34
+	.byte	0
+	.uleb128 0x2
+	.long	0xbac
+	.quad	.LBI2491
+	.value	.LVU47
+	.long	.LLRL35
+	.value	0x12f
+	.byte	0xb
+	.long	0x1045
+	.uleb128 0x1
+	.long	0xbc8
+	.long	.LLST36
+	.long	.LVUS36
+	.uleb128 0x1
+	.long	0xbbb
+	.long	.LLST37
+	.long	.LVUS37
+	.byte	0
+	.uleb128 0x2
+	.long	0xca7
+	.quad	.LBI2494
+	.value	.LVU83
+	.long	.LLRL38
+	.value	0x12f
+	.byte	0x43
+	.long	0x106a
+	.uleb128 0x3
+	.long	0xcc3
+	.uleb128 0x3
+	.long	0xcb6
+	.byte	0
+	.uleb128 0x2
+	.long	0xb50
+	.quad	.LBI2499
+	.value	.LVU51
+	.long	.LLRL39
+	.value	0x12f
+	.byte	0xc
+	.long	0x10ac
+	.uleb128 0x1
+	.long	0xb77
+	.long	.LLST40
+	.long	.LVUS40
+	.uleb128 0x1
+	.long	0xb6b
+	.long	.LLST41
+	.long	.LVUS41
+	.uleb128 0x1
+	.long	0xb5f
+	.long	.LLST42
+	.long	.LVUS42
+	.byte	0
+	.uleb128 0x2
+	.long	0xca7
+	.quad	.LBI2502
+	.value	.LVU94
+	.long	.LLRL43
+	.value	0x12f
+	.byte	0xaa
+	.long	0x10d9
+	.uleb128 0x1
+	.long	0xcc3
+	.long	.LLST44
+	.long	.LVUS44
+	.uleb128 0x3
+	.long	0xcb6
+	.byte	0
+	.uleb128 0x2
+	.long	0xbac
+	.quad	.LBI2506
+	.value	.LVU68
+	.long	.LLRL45
+	.value	0x12f
+	.byte	0xb
+	.long	0x110e
+	.uleb128 0x1
+	.long	0xbc8
+	.long	.LLST46
+	.long	.LVUS46
+	.uleb128 0x1
+	.long	0xbbb
+	.long	.LLST47
+	.long	.LVUS47
+	.byte	0
+	.uleb128 0x2
+	.long	0xbd5
+	.quad	.LBI2509
+	.value	.LVU87
+	.long	.LLRL48
+	.value	0x12f
+	.byte	0x74
+	.long	0x1133
+	.uleb128 0x3
+	.long	0xbf1
+	.uleb128 0x3
+	.long	0xbe4
+	.byte	0
+	.uleb128 0x4
+	.long	0xca7
+	.quad	.LBI2512
+	.value	.LVU121
+	.long	.LLRL49
+	.value	0x12f
+	.value	0x133
+	.long	0x1161
+	.uleb128 0x1
+	.long	0xcc3
+	.long	.LLST50
+	.long	.LVUS50
+	.uleb128 0x3
+	.long	0xcb6
+	.byte	0
+	.uleb128 0x2
+	.long	0xbac
+	.quad	.LBI2516
+	.value	.LVU62
+	.long	.LLRL51
+	.value	0x12f
+	.byte	0x2f
+	.long	0x1196
+	.uleb128 0x1
+	.long	0xbc8
+	.long	.LLST52
+	.long	.LVUS52
+	.uleb128 0x1
+	.long	0xbbb
+	.long	.LLST53
+	.long	.LVUS53
+	.byte	0
+	.uleb128 0x2
+	.long	0xb84
+	.quad	.LBI2519
+	.value	.LVU90
+	.long	.LLRL54
+	.value	0x12f
+	.byte	0x74
+	.long	0x11bb
+	.uleb128 0x3
+	.long	0xb9f
+	.uleb128 0x3
+	.long	0xb93
+	.byte	0
+	.uleb128 0x2
+	.long	0xb50
+	.quad	.LBI2524
+	.value	.LVU72
+	.long	.LLRL55
+	.value	0x12f
+	.byte	0xc
+	.long	0x11fd
+	.uleb128 0x1
+	.long	0xb77
+	.long	.LLST56
+	.long	.LVUS56
+	.uleb128 0x1
+	.long	0xb6b
+	.long	.LLST57
+	.long	.LVUS57
+	.uleb128 0x1
+	.long	0xb5f
+	.long	.LLST58
+	.long	.LVUS58
+	.byte	0
+	.uleb128 0x2
+	.long	0xbd5
+	.quad	.LBI2534
+	.value	.LVU98
+	.long	.LLRL59
+	.value	0x12f
+	.byte	0xc8
+	.long	0x1232
+	.uleb128 0x1
+	.long	0xbf1
+	.long	.LLST60
+	.long	.LVUS60
+	.uleb128 0x1
+	.long	0xbe4
+	.long	.LLST61
+	.long	.LVUS61
+	.byte	0
+	.uleb128 0x2
+	.long	0xc53
+	.quad	.LBI2537
+	.value	.LVU101
+	.long	.LLRL62
+	.value	0x12f
+	.byte	0xc8
+	.long	0x1267
+	.uleb128 0x1
+	.long	0xc6f
+	.long	.LLST63
+	.long	.LVUS63
+	.uleb128 0x1
+	.long	0xc62
+	.long	.LLST64
+	.long	.LVUS64
+	.byte	0
+	.uleb128 0x2
+	.long	0xc29
+	.quad	.LBI2543
+	.value	.LVU110
+	.long	.LLRL65
+	.value	0x12f
+	.byte	0xc8
+	.long	0x1294
+	.uleb128 0x1
+	.long	0xc45
+	.long	.LLST66
+	.long	.LVUS66
+	.uleb128 0x3
+	.long	0xc38
+	.byte	0
+	.uleb128 0x5
+	.long	0xbff
+	.quad	.LBI2548
+	.value	.LVU113
+	.quad	.LBB2548
+	.quad	.LBE2548-.LBB2548
+	.value	0x12f
+	.byte	0xc8
+	.long	0x12d5
+	.uleb128 0x1
+	.long	0xc1b
+	.long	.LLST67
+	.long	.LVUS67
+	.uleb128 0x1
+	.long	0xc0e
+	.long	.LLST68
+	.long	.LVUS68
+	.byte	0
+	.uleb128 0x6
+	.long	0xca7
+	.quad	.LBI2550
+	.value	.LVU118
+	.quad	.LBB2550
+	.quad	.LBE2550-.LBB2550
+	.value	0x12f
+	.value	0x133
+	.long	0x130f
+	.uleb128 0x1
+	.long	0xcc3
+	.long	.LLST69
+	.long	.LVUS69
+	.uleb128 0x3
+	.long	0xcb6
+	.byte	0
+	.uleb128 0x4
+	.long	0xbd5
+	.quad	.LBI2553
+	.value	.LVU126
+	.long	.LLRL70
+	.value	0x12f
+	.value	0x164
+	.long	0x1345
+	.uleb128 0x1
+	.long	0xbf1
+	.long	.LLST71
+	.long	.LVUS71
+	.uleb128 0x1
+	.long	0xbe4
+	.long	.LLST72
+	.long	.LVUS72
+	.byte	0
+	.uleb128 0x4
+	.long	0xb84
+	.quad	.LBI2556
+	.value	.LVU129
+	.long	.LLRL73
+	.value	0x12f
+	.value	0x164
+	.long	0x1373
+	.uleb128 0x3
+	.long	0xb9f
+	.uleb128 0x1
+	.long	0xb93
+	.long	.LLST74
+	.long	.LVUS74
+	.byte	0
+	.uleb128 0x6
+	.long	0xca7
+	.quad	.LBI2561
+	.value	.LVU136
+	.quad	.LBB2561
+	.quad	.LBE2561-.LBB2561
+	.value	0x12f
+	.value	0x199
+	.long	0x13b5
+	.uleb128 0x1
+	.long	0xcc3
+	.long	.LLST75
+	.long	.LVUS75
+	.uleb128 0x1
+	.long	0xcb6
+	.long	.LLST76
+	.long	.LVUS76
+	.byte	0
+	.uleb128 0x4
+	.long	0xbd5
+	.quad	.LBI2563
+	.value	.LVU141
+	.long	.LLRL77
+	.value	0x12f
+	.value	0x1b7
+	.long	0x13eb
+	.uleb128 0x1
+	.long	0xbf1
+	.long	.LLST78
+	.long	.LVUS78
+	.uleb128 0x1
+	.long	0xbe4
+	.long	.LLST79
+	.long	.LVUS79
+	.byte	0
+	.uleb128 0x4
+	.long	0xc53
+	.quad	.LBI2566
+	.value	.LVU144
+	.long	.LLRL80
+	.value	0x12f
+	.value	0x1b7
+	.long	0x1421
+	.uleb128 0x1
+	.long	0xc6f
+	.long	.LLST81
+	.long	.LVUS81
+	.uleb128 0x1
+	.long	0xc62
+	.long	.LLST82
+	.long	.LVUS82
+	.byte	0
+	.uleb128 0x2
+	.long	0xbac
+	.quad	.LBI2570
+	.value	.LVU176
+	.long	.LLRL83
+	.value	0x12f
+	.byte	0xc
+	.long	0x1456
+	.uleb128 0x1
+	.long	0xbc8
+	.long	.LLST84
+	.long	.LVUS84
+	.uleb128 0x1
+	.long	0xbbb
+	.long	.LLST85
+	.long	.LVUS85
+	.byte	0
+	.uleb128 0x2
+	.long	0xbac
+	.quad	.LBI2574
+	.value	.LVU172
+	.long	.LLRL86
+	.value	0x12f
+	.byte	0xc
+	.long	0x1483
+	.uleb128 0x1
+	.long	0xbc8
+	.long	.LLST87
+	.long	.LVUS87
+	.uleb128 0x3
+	.long	0xbbb
+	.byte	0
+	.uleb128 0x4
+	.long	0xc29
+	.quad	.LBI2578
+	.value	.LVU157
+	.long	.LLRL88
+	.value	0x12f
+	.value	0x1b7
+	.long	0x14b1
+	.uleb128 0x1
+	.long	0xc45
+	.long	.LLST89
+	.long	.LVUS89
+	.uleb128 0x3
+	.long	0xc38
+	.byte	0
+	.uleb128 0x4
+	.long	0xbff
+	.quad	.LBI2583
+	.value	.LVU160
+	.long	.LLRL90
+	.value	0x12f
+	.value	0x1b7
+	.long	0x14e7
+	.uleb128 0x1
+	.long	0xc1b
+	.long	.LLST91
+	.long	.LVUS91
+	.uleb128 0x1
+	.long	0xc0e
+	.long	.LLST92
+	.long	.LVUS92
+	.byte	0
+	.uleb128 0x4
+	.long	0xbac
+	.quad	.LBI2586
+	.value	.LVU165
+	.long	.LLRL93
+	.value	0x12f
+	.value	0x22c
+	.long	0x151d
+	.uleb128 0x1
+	.long	0xbc8
+	.long	.LLST94
+	.long	.LVUS94
+	.uleb128 0x1
+	.long	0xbbb
+	.long	.LLST95
+	.long	.LVUS95
+	.byte	0
+	.uleb128 0x5
+	.long	0xca7
+	.quad	.LBI2593
+	.value	.LVU181
+	.quad	.LBB2593
+	.quad	.LBE2593-.LBB2593
+	.value	0x12f
+	.byte	0x13
+	.long	0x155e
+	.uleb128 0x1
+	.long	0xcc3
+	.long	.LLST96
+	.long	.LVUS96
+	.uleb128 0x1
+	.long	0xcb6
+	.long	.LLST97
+	.long	.LVUS97
+	.byte	0
+	.uleb128 0x5
+	.long	0xca7
+	.quad	.LBI2595
+	.value	.LVU184
+	.quad	.LBB2595
+	.quad	.LBE2595-.LBB2595
+	.value	0x12f
+	.byte	0x13
+	.long	0x1597
+	.uleb128 0x1
+	.long	0xcc3
+	.long	.LLST98
+	.long	.LVUS98
+	.uleb128 0x3
+	.long	0xcb6
+	.byte	0
+	.uleb128 0x2
+	.long	0xbd5
+	.quad	.LBI2597
+	.value	.LVU190
+	.long	.LLRL99
+	.value	0x12f
+	.byte	0x44
+	.long	0x15cc
+	.uleb128 0x1
+	.long	0xbf1
+	.long	.LLST100
+	.long	.LVUS100
+	.uleb128 0x1
+	.long	0xbe4
+	.long	.LLST101
+	.long	.LVUS101
+	.byte	0
+	.uleb128 0x2
+	.long	0xb84
+	.quad	.LBI2600
+	.value	.LVU193
+	.long	.LLRL102
+	.value	0x12f
+	.byte	0x44
+	.long	0x15f9
+	.uleb128 0x3
+	.long	0xb9f
+	.uleb128 0x1
+	.long	0xb93
+	.long	.LLST103
+	.long	.LVUS103
+	.byte	0
+	.uleb128 0x5
+	.long	0xca7
+	.quad	.LBI2605
+	.value	.LVU200
+	.quad	.LBB2605
+	.quad	.LBE2605-.LBB2605
+	.value	0x12f
+	.byte	0x7a
+	.long	0x163a
+	.uleb128 0x1
+	.long	0xcc3
+	.long	.LLST104
+	.long	.LVUS104
+	.uleb128 0x1
+	.long	0xcb6
+	.long	.LLST105
+	.long	.LVUS105
+	.byte	0
+	.uleb128 0x2
+	.long	0xbd5
+	.quad	.LBI2607
+	.value	.LVU205
+	.long	.LLRL106
+	.value	0x12f
+	.byte	0x98
+	.long	0x166f
+	.uleb128 0x1
+	.long	0xbf1
+	.long	.LLST107
+	.long	.LVUS107
+	.uleb128 0x1
+	.long	0xbe4
+	.long	.LLST108
+	.long	.LVUS108
+	.byte	0
+	.uleb128 0x2
+	.long	0xc53
+	.quad	.LBI2610
+	.value	.LVU208
+	.long	.LLRL109
+	.value	0x12f
+	.byte	0x98
+	.long	0x16a4
+	.uleb128 0x1
+	.long	0xc6f
+	.long	.LLST110
+	.long	.LVUS110
+	.uleb128 0x1
+	.long	0xc62
+	.long	.LLST111
+	.long	.LVUS111
+	.byte	0
+	.uleb128 0x2
+	.long	0xc29
+	.quad	.LBI2616
+	.value	.LVU217
+	.long	.LLRL112
+	.value	0x12f
+	.byte	0x98
+	.long	0x16d1
+	.uleb128 0x1
+	.long	0xc45
+	.long	.LLST113
+	.long	.LVUS113
+	.uleb128 0x3
+	.long	0xc38
+	.byte	0
+	.uleb128 0x5
+	.long	0xbff
+	.quad	.LBI2621
+	.value	.LVU220
+	.quad	.LBB2621
+	.quad	.LBE2621-.LBB2621
+	.value	0x12f
+	.byte	0x98
+	.long	0x1712
+	.uleb128 0x1
+	.long	0xc1b
+	.long	.LLST114
+	.long	.LVUS114
+	.uleb128 0x1
+	.long	0xc0e
+	.long	.LLST115
+	.long	.LVUS115
+	.byte	0
+	.uleb128 0x6
+	.long	0xca7
+	.quad	.LBI2623
+	.value	.LVU225
+	.quad	.LBB2623
+	.quad	.LBE2623-.LBB2623
+	.value	0x12f
+	.value	0x103
+	.long	0x1754
+	.uleb128 0x1
+	.long	0xcc3
+	.long	.LLST116
+	.long	.LVUS116
+	.uleb128 0x1
+	.long	0xcb6
+	.long	.LLST117
+	.long	.LVUS117
+	.byte	0
+	.uleb128 0x6
+	.long	0xca7
+	.quad	.LBI2625
+	.value	.LVU228
+	.quad	.LBB2625
+	.quad	.LBE2625-.LBB2625
+	.value	0x12f
+	.value	0x103
+	.long	0x178e
+	.uleb128 0x1
+	.long	0xcc3
+	.long	.LLST118
+	.long	.LVUS118
+	.uleb128 0x3
+	.long	0xcb6
+	.byte	0
+	.uleb128 0x4
+	.long	0xbd5
+	.quad	.LBI2627
+	.value	.LVU234
+	.long	.LLRL119
+	.value	0x12f
+	.value	0x134
+	.long	0x17c4
+	.uleb128 0x1
+	.long	0xbf1
+	.long	.LLST120
+	.long	.LVUS120
+	.uleb128 0x1
+	.long	0xbe4
+	.long	.LLST121
+	.long	.LVUS121
+	.byte	0
+	.uleb128 0x4
+	.long	0xb84
+	.quad	.LBI2630
+	.value	.LVU237
+	.long	.LLRL122
+	.value	0x12f
+	.value	0x134
+	.long	0x17f2
+	.uleb128 0x3
+	.long	0xb9f
+	.uleb128 0x1
+	.long	0xb93
+	.long	.LLST123
+	.long	.LVUS123
+	.byte	0
+	.uleb128 0x2
+	.long	0xbac
+	.quad	.LBI2633
+	.value	.LVU304
+	.long	.LLRL124
+	.value	0x130
+	.byte	0xb
+	.long	0x1827
+	.uleb128 0x1
+	.long	0xbc8
+	.long	.LLST125
+	.long	.LVUS125
+	.uleb128 0x1
+	.long	0xbbb
+	.long	.LLST126
+	.long	.LVUS126
+	.byte	0
+	.uleb128 0x2
+	.long	0xb50
+	.quad	.LBI2637
+	.value	.LVU308
+	.long	.LLRL127
+	.value	0x130
+	.byte	0xc
+	.long	0x1861
+	.uleb128 0x1
+	.long	0xb77
+	.long	.LLST128
+	.long	.LVUS128
+	.uleb128 0x3
+	.long	0xb6b
+	.uleb128 0x1
+	.long	0xb5f
+	.long	.LLST129
+	.long	.LVUS129
+	.byte	0
+	.uleb128 0x2
+	.long	0xbac
+	.quad	.LBI2640
+	.value	.LVU313
+	.long	.LLRL130
+	.value	0x130
+	.byte	0x2e
+	.long	0x1896
+	.uleb128 0x1
+	.long	0xbc8
+	.long	.LLST131
+	.long	.LVUS131
+	.uleb128 0x1
+	.long	0xbbb
+	.long	.LLST132
+	.long	.LVUS132
+	.byte	0
+	.uleb128 0x6
+	.long	0xca7
+	.quad	.LBI2644
+	.value	.LVU247
+	.quad	.LBB2644
+	.quad	.LBE2644-.LBB2644
+	.value	0x12f
+	.value	0x169
+	.long	0x18d8
+	.uleb128 0x1
+	.long	0xcc3
+	.long	.LLST133
+	.long	.LVUS133
+	.uleb128 0x1
+	.long	0xcb6
+	.long	.LLST134
+	.long	.LVUS134
+	.byte	0
+	.uleb128 0x4
+	.long	0xbd5
+	.quad	.LBI2646
+	.value	.LVU252
+	.long	.LLRL135
+	.value	0x12f
+	.value	0x187
+	.long	0x190e
+	.uleb128 0x1
+	.long	0xbf1
+	.long	.LLST136
+	.long	.LVUS136
+	.uleb128 0x1
+	.long	0xbe4
+	.long	.LLST137
+	.long	.LVUS137
+	.byte	0
+	.uleb128 0x4
+	.long	0xc53
+	.quad	.LBI2649
+	.value	.LVU255
+	.long	.LLRL138
+	.value	0x12f
+	.value	0x187
+	.long	0x1944
+	.uleb128 0x1
+	.long	0xc6f
+	.long	.LLST139
+	.long	.LVUS139
+	.uleb128 0x1
+	.long	0xc62
+	.long	.LLST140
+	.long	.LVUS140
+	.byte	0
+	.uleb128 0x2
+	.long	0xbac
+	.quad	.LBI2653
+	.value	.LVU292
+	.long	.LLRL141
+	.value	0x12f
+	.byte	0xc
+	.long	0x1971
+	.uleb128 0x1
+	.long	0xbc8
+	.long	.LLST142
+	.long	.LVUS142
+	.uleb128 0x3
+	.long	0xbbb
+	.byte	0
+	.uleb128 0x2
+	.long	0xbac
+	.quad	.LBI2656
+	.value	.LVU326
+	.long	.LLRL143
+	.value	0x130
+	.byte	0xb
+	.long	0x19a6
+	.uleb128 0x1
+	.long	0xbc8
+	.long	.LLST144
+	.long	.LVUS144
+	.uleb128 0x1
+	.long	0xbbb
+	.long	.LLST145
+	.long	.LVUS145
+	.byte	0
+	.uleb128 0x2
+	.long	0xbac
+	.quad	.LBI2660
+	.value	.LVU288
+	.long	.LLRL146
+	.value	0x12f
+	.byte	0xc
+	.long	0x19d3
+	.uleb128 0x1
+	.long	0xbc8
+	.long	.LLST147
+	.long	.LVUS147
+	.uleb128 0x3
+	.long	0xbbb
+	.byte	0
+	.uleb128 0x2
+	.long	0xb50
+	.quad	.LBI2663
+	.value	.LVU330
+	.long	.LLRL148
+	.value	0x130
+	.byte	0xc
+	.long	0x1a05
+	.uleb128 0x1
+	.long	0xb77
+	.long	.LLST149
+	.long	.LVUS149
+	.uleb128 0x3
+	.long	0xb6b
+	.uleb128 0x3
+	.long	0xb5f
+	.byte	0
+	.uleb128 0x2
+	.long	0xbac
+	.quad	.LBI2667
+	.value	.LVU322
+	.long	.LLRL150
+	.value	0x130
+	.byte	0x2f
+	.long	0x1a3a
+	.uleb128 0x1
+	.long	0xbc8
+	.long	.LLST151
+	.long	.LVUS151
+	.uleb128 0x1
+	.long	0xbbb
+	.long	.LLST152
+	.long	.LVUS152
+	.byte	0
+	.uleb128 0x4
+	.long	0xc29
+	.quad	.LBI2671
+	.value	.LVU271
+	.long	.LLRL153
+	.value	0x12f
+	.value	0x187
+	.long	0x1a68
+	.uleb128 0x1
+	.long	0xc45
+	.long	.LLST154
+	.long	.LVUS154
+	.uleb128 0x3
+	.long	0xc38
+	.byte	0
+	.uleb128 0x4
+	.long	0xbff
+	.quad	.LBI2677
+	.value	.LVU274
+	.long	.LLRL155
+	.value	0x12f
+	.value	0x187
+	.long	0x1a9e
+	.uleb128 0x1
+	.long	0xc1b
+	.long	.LLST156
+	.long	.LVUS156
+	.uleb128 0x1
+	.long	0xc0e
+	.long	.LLST157
+	.long	.LVUS157
+	.byte	0
+	.uleb128 0x4
+	.long	0xbac
+	.quad	.LBI2680
+	.value	.LVU279
+	.long	.LLRL158
+	.value	0x12f
+	.value	0x1fc
+	.long	0x1ad4
+	.uleb128 0x1
+	.long	0xbc8
+	.long	.LLST159
+	.long	.LVUS159
+	.uleb128 0x1
+	.long	0xbbb
+	.long	.LLST160
+	.long	.LVUS160
+	.byte	0
+	.uleb128 0x2
+	.long	0xbac
+	.quad	.LBI2683
+	.value	.LVU351
+	.long	.LLRL161
+	.value	0x130
+	.byte	0xb
+	.long	0x1b09
+	.uleb128 0x1
+	.long	0xbc8
+	.long	.LLST162
+	.long	.LVUS162
+	.uleb128 0x1
+	.long	0xbbb
+	.long	.LLST163
+	.long	.LVUS163
+	.byte	0
+	.uleb128 0x2
+	.long	0xb50
+	.quad	.LBI2687
+	.value	.LVU355
+	.long	.LLRL164
+	.value	0x130
+	.byte	0xc
+	.long	0x1b43
+	.uleb128 0x1
+	.long	0xb77
+	.long	.LLST165
+	.long	.LVUS165
+	.uleb128 0x3
+	.long	0xb6b
+	.uleb128 0x1
+	.long	0xb5f
+	.long	.LLST166
+	.long	.LVUS166
+	.byte	0
+	.uleb128 0x2
+	.long	0xbac
+	.quad	.LBI2691
+	.value	.LVU361
+	.long	.LLRL167
+	.value	0x130
+	.byte	0x2e
+	.long	0x1b78
+	.uleb128 0x1
+	.long	0xbc8
+	.long	.LLST168
+	.long	.LVUS168
+	.uleb128 0x1
+	.long	0xbbb
+	.long	.LLST169
+	.long	.LVUS169
+	.byte	0
+	.uleb128 0x5
+	.long	0xbac
+	.quad	.LBI2697
+	.value	.LVU299
+	.quad	.LBB2697
+	.quad	.LBE2697-.LBB2697
+	.value	0x130
+	.byte	0x14
+	.long	0x1bb9
+	.uleb128 0x1
+	.long	0xbc8
+	.long	.LLST170
+	.long	.LVUS170
+	.uleb128 0x1
+	.long	0xbbb
+	.long	.LLST171
+	.long	.LVUS171
+	.byte	0
+	.uleb128 0x5
+	.long	0xb50
+	.quad	.LBI2702
+	.value	.LVU317
+	.quad	.LBB2702
+	.quad	.LBE2702-.LBB2702
+	.value	0x130
+	.byte	0xc
+	.long	0x1c07
+	.uleb128 0x1
+	.long	0xb77
+	.long	.LLST172
+	.long	.LVUS172
+	.uleb128 0x1
+	.long	0xb6b
+	.long	.LLST173
+	.long	.LVUS173
+	.uleb128 0x1
+	.long	0xb5f
+	.long	.LLST174
+	.long	.LVUS174
+	.byte	0
+	.uleb128 0x5
+	.long	0xbac
+	.quad	.LBI2707
+	.value	.LVU334
+	.quad	.LBB2707
+	.quad	.LBE2707-.LBB2707
+	.value	0x130
+	.byte	0x2e
+	.long	0x1c48
+	.uleb128 0x1
+	.long	0xbc8
+	.long	.LLST175
+	.long	.LVUS175
+	.uleb128 0x1
+	.long	0xbbb
+	.long	.LLST176
+	.long	.LVUS176
+	.byte	0
+	.uleb128 0x2
+	.long	0xb50
+	.quad	.LBI2709
+	.value	.LVU339
+	.long	.LLRL177
+	.value	0x130
+	.byte	0xc
+	.long	0x1c8a
+	.uleb128 0x1
+	.long	0xb77
+	.long	.LLST178
+	.long	.LVUS178
+	.uleb128 0x1
+	.long	0xb6b
+	.long	.LLST179
+	.long	.LVUS179
+	.uleb128 0x1
+	.long	0xb5f
+	.long	.LLST180
+	.long	.LVUS180
+	.byte	0
+	.uleb128 0x2
+	.long	0xca7
+	.quad	.LBI2712
+	.value	.LVU398
+	.long	.LLRL181
+	.value	0x130
+	.byte	0x43
+	.long	0x1caf
+	.uleb128 0x3
+	.long	0xcc3
+	.uleb128 0x3
+	.long	0xcb6
+	.byte	0
+	.uleb128 0x5
+	.long	0xbac
+	.quad	.LBI2717
+	.value	.LVU346
+	.quad	.LBB2717
+	.quad	.LBE2717-.LBB2717
+	.value	0x130
+	.byte	0x2f
+	.long	0x1cf0
+	.uleb128 0x1
+	.long	0xbc8
+	.long	.LLST182
+	.long	.LVUS182
+	.uleb128 0x1
+	.long	0xbbb
+	.long	.LLST183
+	.long	.LVUS183
+	.byte	0
+	.uleb128 0x2
+	.long	0xb50
+	.quad	.LBI2724
+	.value	.LVU365
+	.long	.LLRL184
+	.value	0x130
+	.byte	0xc
+	.long	0x1d32
+	.uleb128 0x1
+	.long	0xb77
+	.long	.LLST185
+	.long	.LVUS185
+	.uleb128 0x1
+	.long	0xb6b
+	.long	.LLST186
+	.long	.LVUS186
+	.uleb128 0x1
+	.long	0xb5f
+	.long	.LLST187
+	.long	.LVUS187
+	.byte	0
+	.uleb128 0x2
+	.long	0xbd5
+	.quad	.LBI2727
+	.value	.LVU402
+	.long	.LLRL188
+	.value	0x130
+	.byte	0x74
+	.long	0x1d5f
+	.uleb128 0x1
+	.long	0xbf1
+	.long	.LLST189
+	.long	.LVUS189
+	.uleb128 0x3
+	.long	0xbe4
+	.byte	0
+	.uleb128 0x2
+	.long	0xb50
+	.quad	.LBI2731
+	.value	.LVU374
+	.long	.LLRL190
+	.value	0x130
+	.byte	0xc
+	.long	0x1da1
+	.uleb128 0x1
+	.long	0xb77
+	.long	.LLST191
+	.long	.LVUS191
+	.uleb128 0x1
+	.long	0xb6b
+	.long	.LLST192
+	.long	.LVUS192
+	.uleb128 0x1
+	.long	0xb5f
+	.long	.LLST193
+	.long	.LVUS193
+	.byte	0
+	.uleb128 0x2
+	.long	0xb84
+	.quad	.LBI2734
+	.value	.LVU405
+	.long	.LLRL194
+	.value	0x130
+	.byte	0x74
+	.long	0x1dc6
+	.uleb128 0x3
+	.long	0xb9f
+	.uleb128 0x3
+	.long	0xb93
+	.byte	0
+	.uleb128 0x5
+	.long	0xbac
+	.quad	.LBI2738
+	.value	.LVU381
+	.quad	.LBB2738
+	.quad	.LBE2738-.LBB2738
+	.value	0x130
+	.byte	0x2e
+	.long	0x1e07
+	.uleb128 0x1
+	.long	0xbc8
+	.long	.LLST195
+	.long	.LVUS195
+	.uleb128 0x1
+	.long	0xbbb
+	.long	.LLST196
+	.long	.LVUS196
+	.byte	0
+	.uleb128 0x2
+	.long	0xb50
+	.quad	.LBI2740
+	.value	.LVU386
+	.long	.LLRL197
+	.value	0x130
+	.byte	0xc
+	.long	0x1e49
+	.uleb128 0x1
+	.long	0xb77
+	.long	.LLST198
+	.long	.LVUS198
+	.uleb128 0x1
+	.long	0xb6b
+	.long	.LLST199
+	.long	.LVUS199
+	.uleb128 0x1
+	.long	0xb5f
+	.long	.LLST200
+	.long	.LVUS200
+	.byte	0
+	.uleb128 0x2
+	.long	0xca7
+	.quad	.LBI2743
+	.value	.LVU409
+	.long	.LLRL201
+	.value	0x130
+	.byte	0xaa
+	.long	0x1e76
+	.uleb128 0x1
+	.long	0xcc3
+	.long	.LLST202
+	.long	.LVUS202
+	.uleb128 0x3
+	.long	0xcb6
+	.byte	0
+	.uleb128 0x5
+	.long	0xca7
+	.quad	.LBI2747
+	.value	.LVU395
+	.quad	.LBB2747
+	.quad	.LBE2747-.LBB2747
+	.value	0x130
+	.byte	0x43
+	.long	0x1eb7
+	.uleb128 0x1
+	.long	0xcc3
+	.long	.LLST203
+	.long	.LVUS203
+	.uleb128 0x1
+	.long	0xcb6
+	.long	.LLST204
+	.long	.LVUS204
+	.byte	0
+	.uleb128 0x2
+	.long	0xbd5
+	.quad	.LBI2753
+	.value	.LVU413
+	.long	.LLRL205
+	.value	0x130
+	.byte	0xc8
+	.long	0x1eec
+	.uleb128 0x1
+	.long	0xbf1
+	.long	.LLST206
+	.long	.LVUS206
+	.uleb128 0x1
+	.long	0xbe4
+	.long	.LLST207
+	.long	.LVUS207
+	.byte	0
+	.uleb128 0x2
+	.long	0xc53
+	.quad	.LBI2756
+	.value	.LVU416
+	.long	.LLRL208
+	.value	0x130
+	.byte	0xc8
+	.long	0x1f21
+	.uleb128 0x1
+	.long	0xc6f
+	.long	.LLST209
+	.long	.LVUS209
+	.uleb128 0x1
+	.long	0xc62
+	.long	.LLST210
+	.long	.LVUS210
+	.byte	0
+	.uleb128 0x2
+	.long	0xc29
+	.quad	.LBI2762
+	.value	.LVU425
+	.long	.LLRL211
+	.value	0x130
+	.byte	0xc8
+	.long	0x1f4e
+	.uleb128 0x1
+	.long	0xc45
+	.long	.LLST212
+	.long	.LVUS212
+	.uleb128 0x3
+	.long	0xc38
+	.byte	0
+	.uleb128 0x5
+	.long	0xbff
+	.quad	.LBI2767
+	.value	.LVU428
+	.quad	.LBB2767
+	.quad	.LBE2767-.LBB2767
+	.value	0x130
+	.byte	0xc8
+	.long	0x1f8f
+	.uleb128 0x1
+	.long	0xc1b
+	.long	.LLST213
+	.long	.LVUS213
+	.uleb128 0x1
+	.long	0xc0e
+	.long	.LLST214
+	.long	.LVUS214
+	.byte	0
+	.uleb128 0x6
+	.long	0xca7
+	.quad	.LBI2769
+	.value	.LVU433
+	.quad	.LBB2769
+	.quad	.LBE2769-.LBB2769
+	.value	0x130
+	.value	0x133
+	.long	0x1fd1
+	.uleb128 0x1
+	.long	0xcc3
+	.long	.LLST215
+	.long	.LVUS215
+	.uleb128 0x1
+	.long	0xcb6
+	.long	.LLST216
+	.long	.LVUS216
+	.byte	0
+	.uleb128 0x6
+	.long	0xca7
+	.quad	.LBI2771
+	.value	.LVU436
+	.quad	.LBB2771
+	.quad	.LBE2771-.LBB2771
+	.value	0x130
+	.value	0x133
+	.long	0x200b
+	.uleb128 0x1
+	.long	0xcc3
+	.long	.LLST217
+	.long	.LVUS217
+	.uleb128 0x3
+	.long	0xcb6
+	.byte	0
+	.uleb128 0x4
+	.long	0xbd5
+	.quad	.LBI2773
+	.value	.LVU442
+	.long	.LLRL218
+	.value	0x130
+	.value	0x164
+	.long	0x2041
+	.uleb128 0x1
+	.long	0xbf1
+	.long	.LLST219
+	.long	.LVUS219
+	.uleb128 0x1
+	.long	0xbe4
+	.long	.LLST220
+	.long	.LVUS220
+	.byte	0
+	.uleb128 0x4
+	.long	0xb84
+	.quad	.LBI2776
+	.value	.LVU445
+	.long	.LLRL221
+	.value	0x130
+	.value	0x164
+	.long	0x206f
+	.uleb128 0x3
+	.long	0xb9f
+	.uleb128 0x1
+	.long	0xb93
+	.long	.LLST222
+	.long	.LVUS222
+	.byte	0
+	.uleb128 0x6
+	.long	0xca7
+	.quad	.LBI2781
+	.value	.LVU452
+	.quad	.LBB2781
+	.quad	.LBE2781-.LBB2781
+	.value	0x130
+	.value	0x199
+	.long	0x20b1
+	.uleb128 0x1
+	.long	0xcc3
+	.long	.LLST223
+	.long	.LVUS223
+	.uleb128 0x1
+	.long	0xcb6
+	.long	.LLST224
+	.long	.LVUS224
+	.byte	0
+	.uleb128 0x4
+	.long	0xbd5
+	.quad	.LBI2783
+	.value	.LVU457
+	.long	.LLRL225
+	.value	0x130
+	.value	0x1b7
+	.long	0x20e7
+	.uleb128 0x1
+	.long	0xbf1
+	.long	.LLST226
+	.long	.LVUS226
+	.uleb128 0x1
+	.long	0xbe4
+	.long	.LLST227
+	.long	.LVUS227
+	.byte	0
+	.uleb128 0x4
+	.long	0xc53
+	.quad	.LBI2786
+	.value	.LVU460
+	.long	.LLRL228
+	.value	0x130
+	.value	0x1b7
+	.long	0x211d
+	.uleb128 0x1
+	.long	0xc6f
+	.long	.LLST229
+	.long	.LVUS229
+	.uleb128 0x1
+	.long	0xc62
+	.long	.LLST230
+	.long	.LVUS230
+	.byte	0
+	.uleb128 0x2
+	.long	0xbac
+	.quad	.LBI2790
+	.value	.LVU492
+	.long	.LLRL231
+	.value	0x130
+	.byte	0xc
+	.long	0x214a
+	.uleb128 0x1
+	.long	0xbc8
+	.long	.LLST232
+	.long	.LVUS232
+	.uleb128 0x3
+	.long	0xbbb
+	.byte	0
+	.uleb128 0x2
+	.long	0xbac
+	.quad	.LBI2794
+	.value	.LVU488
+	.long	.LLRL233
+	.value	0x130
+	.byte	0xc
+	.long	0x2177
+	.uleb128 0x1
+	.long	0xbc8
+	.long	.LLST234
+	.long	.LVUS234
+	.uleb128 0x3
+	.long	0xbbb
+	.byte	0
+	.uleb128 0x4
+	.long	0xc29
+	.quad	.LBI2798
+	.value	.LVU473
+	.long	.LLRL235
+	.value	0x130
+	.value	0x1b7
+	.long	0x21a5
+	.uleb128 0x1
+	.long	0xc45
+	.long	.LLST236
+	.long	.LVUS236
+	.uleb128 0x3
+	.long	0xc38
+	.byte	0
+	.uleb128 0x4
+	.long	0xbff
+	.quad	.LBI2803
+	.value	.LVU476
+	.long	.LLRL237
+	.value	0x130
+	.value	0x1b7
+	.long	0x21db
+	.uleb128 0x1
+	.long	0xc1b
+	.long	.LLST238
+	.long	.LVUS238
+	.uleb128 0x1
+	.long	0xc0e
+	.long	.LLST239
+	.long	.LVUS239
+	.byte	0
+	.uleb128 0x4
+	.long	0xbac
+	.quad	.LBI2806
+	.value	.LVU481
+	.long	.LLRL240
+	.value	0x130
+	.value	0x22c
+	.long	0x2211
+	.uleb128 0x1
+	.long	0xbc8
+	.long	.LLST241
+	.long	.LVUS241
+	.uleb128 0x1
+	.long	0xbbb
+	.long	.LLST242
+	.long	.LVUS242
+	.byte	0
+	.uleb128 0x5
+	.long	0xca7
+	.quad	.LBI2813
+	.value	.LVU497
+	.quad	.LBB2813
+	.quad	.LBE2813-.LBB2813
+	.value	0x130
+	.byte	0x13
+	.long	0x2252
+	.uleb128 0x1
+	.long	0xcc3
+	.long	.LLST243
+	.long	.LVUS243
+	.uleb128 0x1
+	.long	0xcb6
+	.long	.LLST244
+	.long	.LVUS244
+	.byte	0
+	.uleb128 0x5
+	.long	0xca7
+	.quad	.LBI2815
+	.value	.LVU500
+	.quad	.LBB2815
+	.quad	.LBE2815-.LBB2815
+	.value	0x130
+	.byte	0x13
+	.long	0x228b
+	.uleb128 0x1
+	.long	0xcc3
+	.long	.LLST245
+	.long	.LVUS245
+	.uleb128 0x3
+	.long	0xcb6
+	.byte	0
+	.uleb128 0x2
+	.long	0xbd5
+	.quad	.LBI2817
+	.value	.LVU506
+	.long	.LLRL246
+	.value	0x130
+	.byte	0x44
+	.long	0x22c0
+	.uleb128 0x1
+	.long	0xbf1
+	.long	.LLST247
+	.long	.LVUS247
+	.uleb128 0x1
+	.long	0xbe4
+	.long	.LLST248
+	.long	.LVUS248
+	.byte	0
+	.uleb128 0x2
+	.long	0xb84
+	.quad	.LBI2820
+	.value	.LVU509
+	.long	.LLRL249
+	.value	0x130
+	.byte	0x44
+	.long	0x22ed
+	.uleb128 0x3
+	.long	0xb9f
+	.uleb128 0x1
+	.long	0xb93
+	.long	.LLST250
+	.long	.LVUS250
+	.byte	0
+	.uleb128 0x5
+	.long	0xca7
+	.quad	.LBI2825
+	.value	.LVU516
+	.quad	.LBB2825
+	.quad	.LBE2825-.LBB2825
+	.value	0x130
+	.byte	0x7a
+	.long	0x232e
+	.uleb128 0x1
+	.long	0xcc3
+	.long	.LLST251
+	.long	.LVUS251
+	.uleb128 0x1
+	.long	0xcb6
+	.long	.LLST252
+	.long	.LVUS252
+	.byte	0
+	.uleb128 0x2
+	.long	0xbd5
+	.quad	.LBI2827
+	.value	.LVU521
+	.long	.LLRL253
+	.value	0x130
+	.byte	0x98
+	.long	0x2363
+	.uleb128 0x1
+	.long	0xbf1
+	.long	.LLST254
+	.long	.LVUS254
+	.uleb128 0x1
+	.long	0xbe4
+	.long	.LLST255
+	.long	.LVUS255
+	.byte	0
+	.uleb128 0x2
+	.long	0xc53
+	.quad	.LBI2830
+	.value	.LVU524
+	.long	.LLRL256
+	.value	0x130
+	.byte	0x98
+	.long	0x2398
+	.uleb128 0x1
+	.long	0xc6f
+	.long	.LLST257
+	.long	.LVUS257
+	.uleb128 0x1
+	.long	0xc62
+	.long	.LLST258
+	.long	.LVUS258
+	.byte	0
+	.uleb128 0x2
+	.long	0xc29
+	.quad	.LBI2836
+	.value	.LVU533
+	.long	.LLRL259
+	.value	0x130
+	.byte	0x98
+	.long	0x23c5
+	.uleb128 0x1
+	.long	0xc45
+	.long	.LLST260
+	.long	.LVUS260
+	.uleb128 0x3
+	.long	0xc38
+	.byte	0
+	.uleb128 0x5
+	.long	0xbff
+	.quad	.LBI2841
+	.value	.LVU536
+	.quad	.LBB2841
+	.quad	.LBE2841-.LBB2841
+	.value	0x130
+	.byte	0x98
+	.long	0x2406
+	.uleb128 0x1
+	.long	0xc1b
+	.long	.LLST261
+	.long	.LVUS261
+	.uleb128 0x1
+	.long	0xc0e
+	.long	.LLST262
+	.long	.LVUS262
+	.byte	0
+	.uleb128 0x6
+	.long	0xca7
+	.quad	.LBI2843
+	.value	.LVU541
+	.quad	.LBB2843
+	.quad	.LBE2843-.LBB2843
+	.value	0x130
+	.value	0x103
+	.long	0x2448
+	.uleb128 0x1
+	.long	0xcc3
+	.long	.LLST263
+	.long	.LVUS263
+	.uleb128 0x1
+	.long	0xcb6
+	.long	.LLST264
+	.long	.LVUS264
+	.byte	0
+	.uleb128 0x4
+	.long	0xca7
+	.quad	.LBI2845
+	.value	.LVU544
+	.long	.LLRL265
+	.value	0x130
+	.value	0x103
+	.long	0x2476
+	.uleb128 0x1
+	.long	0xcc3
+	.long	.LLST266
+	.long	.LVUS266
+	.uleb128 0x3
+	.long	0xcb6
+	.byte	0
+	.uleb128 0x2
+	.long	0xbac
+	.quad	.LBI2848
+	.value	.LVU632
+	.long	.LLRL267
+	.value	0x131
+	.byte	0x37
+	.long	0x24ab
+	.uleb128 0x1
+	.long	0xbc8
+	.long	.LLST268
+	.long	.LVUS268
+	.uleb128 0x1
+	.long	0xbbb
+	.long	.LLST269
+	.long	.LVUS269
+	.byte	0
+	.uleb128 0x4
+	.long	0xbd5
+	.quad	.LBI2852
+	.value	.LVU551
+	.long	.LLRL270
+	.value	0x130
+	.value	0x134
+	.long	0x24e1
+	.uleb128 0x1
+	.long	0xbf1
+	.long	.LLST271
+	.long	.LVUS271
+	.uleb128 0x1
+	.long	0xbe4
+	.long	.LLST272
+	.long	.LVUS272
+	.byte	0
+	.uleb128 0x4
+	.long	0xb84
+	.quad	.LBI2855
+	.value	.LVU554
+	.long	.LLRL273
+	.value	0x130
+	.value	0x134
+	.long	0x250f
+	.uleb128 0x3
+	.long	0xb9f
+	.uleb128 0x1
+	.long	0xb93
+	.long	.LLST274
+	.long	.LVUS274
+	.byte	0
+	.uleb128 0x2
+	.long	0xbac
+	.quad	.LBI2858
+	.value	.LVU615
+	.long	.LLRL275
+	.value	0x131
+	.byte	0xb
+	.long	0x2544
+	.uleb128 0x1
+	.long	0xbc8
+	.long	.LLST276
+	.long	.LVUS276
+	.uleb128 0x1
+	.long	0xbbb
+	.long	.LLST277
+	.long	.LVUS277
+	.byte	0
+	.uleb128 0x6
+	.long	0xca7
+	.quad	.LBI2863
+	.value	.LVU562
+	.quad	.LBB2863
+	.quad	.LBE2863-.LBB2863
+	.value	0x130
+	.value	0x169
+	.long	0x2586
+	.uleb128 0x1
+	.long	0xcc3
+	.long	.LLST278
+	.long	.LVUS278
+	.uleb128 0x1
+	.long	0xcb6
+	.long	.LLST279
+	.long	.LVUS279
+	.byte	0
+	.uleb128 0x4
+	.long	0xbd5
+	.quad	.LBI2865
+	.value	.LVU567
+	.long	.LLRL280
+	.value	0x130
+	.value	0x187
+	.long	0x25bc
+	.uleb128 0x1
+	.long	0xbf1
+	.long	.LLST281
+	.long	.LVUS281
+	.uleb128 0x1
+	.long	0xbe4
+	.long	.LLST282
+	.long	.LVUS282
+	.byte	0
+	.uleb128 0x4
+	.long	0xc53
+	.quad	.LBI2868
+	.value	.LVU570
+	.long	.LLRL283
+	.value	0x130
+	.value	0x187
+	.long	0x25f2
+	.uleb128 0x1
+	.long	0xc6f
+	.long	.LLST284
+	.long	.LVUS284
+	.uleb128 0x1
+	.long	0xc62
+	.long	.LLST285
+	.long	.LVUS285
+	.byte	0
+	.uleb128 0x2
+	.long	0xbac
+	.quad	.LBI2872
+	.value	.LVU604
+	.long	.LLRL286
+	.value	0x130
+	.byte	0xc
+	.long	0x261f
+	.uleb128 0x1
+	.long	0xbc8
+	.long	.LLST287
+	.long	.LVUS287
+	.uleb128 0x3
+	.long	0xbbb
+	.byte	0
+	.uleb128 0x2
+	.long	0xbac
+	.quad	.LBI2876
+	.value	.LVU600
+	.long	.LLRL288
+	.value	0x130
+	.byte	0xc
+	.long	0x264c
+	.uleb128 0x1
+	.long	0xbc8
+	.long	.LLST289
+	.long	.LVUS289
+	.uleb128 0x3
+	.long	0xbbb
+	.byte	0
+	.uleb128 0x4
+	.long	0xc29
+	.quad	.LBI2880
+	.value	.LVU583
+	.long	.LLRL290
+	.value	0x130
+	.value	0x187
+	.long	0x267a
+	.uleb128 0x1
+	.long	0xc45
+	.long	.LLST291
+	.long	.LVUS291
+	.uleb128 0x3
+	.long	0xc38
+	.byte	0
+	.uleb128 0x4
+	.long	0xbff
+	.quad	.LBI2885
+	.value	.LVU586
+	.long	.LLRL292
+	.value	0x130
+	.value	0x187
+	.long	0x26b0
+	.uleb128 0x1
+	.long	0xc1b
+	.long	.LLST293
+	.long	.LVUS293
+	.uleb128 0x1
+	.long	0xc0e
+	.long	.LLST294
+	.long	.LVUS294
+	.byte	0
+	.uleb128 0x4
+	.long	0xbac
+	.quad	.LBI2888
+	.value	.LVU591
+	.long	.LLRL295
+	.value	0x130
+	.value	0x1fc
+	.long	0x26e6
+	.uleb128 0x1
+	.long	0xbc8
+	.long	.LLST296
+	.long	.LVUS296
+	.uleb128 0x1
+	.long	0xbbb
+	.long	.LLST297
+	.long	.LVUS297
+	.byte	0
+	.uleb128 0x2
+	.long	0xbac
+	.quad	.LBI2892
+	.value	.LVU611
+	.long	.LLRL298
+	.value	0x131
+	.byte	0x14
+	.long	0x271b
+	.uleb128 0x1
+	.long	0xbc8
+	.long	.LLST299
+	.long	.LVUS299
+	.uleb128 0x1
+	.long	0xbbb
+	.long	.LLST300
+	.long	.LVUS300
+	.byte	0
+	.uleb128 0x2
+	.long	0xb50
+	.quad	.LBI2895
+	.value	.LVU619
+	.long	.LLRL301
+	.value	0x131
+	.byte	0xc
+	.long	0x275d
+	.uleb128 0x1
+	.long	0xb77
+	.long	.LLST302
+	.long	.LVUS302
+	.uleb128 0x1
+	.long	0xb6b
+	.long	.LLST303
+	.long	.LVUS303
+	.uleb128 0x1
+	.long	0xb5f
+	.long	.LLST304
+	.long	.LVUS304
+	.byte	0
+	.uleb128 0x2
+	.long	0xb50
+	.quad	.LBI2904
+	.value	.LVU625
+	.long	.LLRL305
+	.value	0x131
+	.byte	0xc
+	.long	0x279f
+	.uleb128 0x1
+	.long	0xb77
+	.long	.LLST306
+	.long	.LVUS306
+	.uleb128 0x1
+	.long	0xb6b
+	.long	.LLST307
+	.long	.LVUS307
+	.uleb128 0x1
+	.long	0xb5f
+	.long	.LLST308
+	.long	.LVUS308
+	.byte	0
+	.uleb128 0x2
+	.long	0xbac
+	.quad	.LBI2907
+	.value	.LVU685
+	.long	.LLRL309
+	.value	0x131
+	.byte	0x2f
+	.long	0x27d4
+	.uleb128 0x1
+	.long	0xbc8
+	.long	.LLST310
+	.long	.LVUS310
+	.uleb128 0x1
+	.long	0xbbb
+	.long	.LLST311
+	.long	.LVUS311
+	.byte	0
+	.uleb128 0x2
+	.long	0xb50
+	.quad	.LBI2912
+	.value	.LVU636
+	.long	.LLRL312
+	.value	0x131
+	.byte	0xc
+	.long	0x2816
+	.uleb128 0x1
+	.long	0xb77
+	.long	.LLST313
+	.long	.LVUS313
+	.uleb128 0x1
+	.long	0xb6b
+	.long	.LLST314
+	.long	.LVUS314
+	.uleb128 0x1
+	.long	0xb5f
+	.long	.LLST315
+	.long	.LVUS315
+	.byte	0
+	.uleb128 0x2
+	.long	0xca7
+	.quad	.LBI2915
+	.value	.LVU720
+	.long	.LLRL316
+	.value	0x131
+	.byte	0x43
+	.long	0x283b
+	.uleb128 0x3
+	.long	0xcc3
+	.uleb128 0x3
+	.long	0xcb6
+	.byte	0
+	.uleb128 0x2
+	.long	0xbac
+	.quad	.LBI2919
+	.value	.LVU646
+	.long	.LLRL317
+	.value	0x131
+	.byte	0x2e
+	.long	0x2870
+	.uleb128 0x1
+	.long	0xbc8
+	.long	.LLST318
+	.long	.LVUS318
+	.uleb128 0x1
+	.long	0xbbb
+	.long	.LLST319
+	.long	.LVUS319
+	.byte	0
+	.uleb128 0x2
+	.long	0xb50
+	.quad	.LBI2924
+	.value	.LVU650
+	.long	.LLRL320
+	.value	0x131
+	.byte	0xc
+	.long	0x28b2
+	.uleb128 0x1
+	.long	0xb77
+	.long	.LLST321
+	.long	.LVUS321
+	.uleb128 0x1
+	.long	0xb6b
+	.long	.LLST322
+	.long	.LVUS322
+	.uleb128 0x1
+	.long	0xb5f
+	.long	.LLST323
+	.long	.LVUS323
+	.byte	0
+	.uleb128 0x2
+	.long	0xbac
+	.quad	.LBI2928
+	.value	.LVU657
+	.long	.LLRL324
+	.value	0x131
+	.byte	0x2f
+	.long	0x28e7
+	.uleb128 0x1
+	.long	0xbc8
+	.long	.LLST325
+	.long	.LVUS325
+	.uleb128 0x1
+	.long	0xbbb
+	.long	.LLST326
+	.long	.LVUS326
+	.byte	0
+	.uleb128 0x5
+	.long	0xbac
+	.quad	.LBI2933
+	.value	.LVU661
+	.quad	.LBB2933
+	.quad	.LBE2933-.LBB2933
+	.value	0x131
+	.byte	0xb
+	.long	0x2928
+	.uleb128 0x1
+	.long	0xbc8
+	.long	.LLST327
+	.long	.LVUS327
+	.uleb128 0x1
+	.long	0xbbb
+	.long	.LLST328
+	.long	.LVUS328
+	.byte	0
+	.uleb128 0x2
+	.long	0xb50
+	.quad	.LBI2935
+	.value	.LVU666
+	.long	.LLRL329
+	.value	0x131
+	.byte	0xc
+	.long	0x296a
+	.uleb128 0x1
+	.long	0xb77
+	.long	.LLST330
+	.long	.LVUS330
+	.uleb128 0x1
+	.long	0xb6b
+	.long	.LLST331
+	.long	.LVUS331
+	.uleb128 0x1
+	.long	0xb5f
+	.long	.LLST332
+	.long	.LVUS332
+	.byte	0
+	.uleb128 0x2
+	.long	0xbd5
+	.quad	.LBI2939
+	.value	.LVU724
+	.long	.LLRL333
+	.value	0x131
+	.byte	0x74
+	.long	0x2997
+	.uleb128 0x1
+	.long	0xbf1
+	.long	.LLST334
+	.long	.LVUS334
+	.uleb128 0x3
+	.long	0xbe4
+	.byte	0
+	.uleb128 0x2
+	.long	0xb84
+	.quad	.LBI2942
+	.value	.LVU727
+	.long	.LLRL335
+	.value	0x131
+	.byte	0x74
+	.long	0x29bc
+	.uleb128 0x3
+	.long	0xb9f
+	.uleb128 0x3
+	.long	0xb93
+	.byte	0
+	.uleb128 0x2
+	.long	0xbac
+	.quad	.LBI2946
+	.value	.LVU689
+	.long	.LLRL336
+	.value	0x131
+	.byte	0xb
+	.long	0x29f1
+	.uleb128 0x1
+	.long	0xbc8
+	.long	.LLST337
+	.long	.LVUS337
+	.uleb128 0x1
+	.long	0xbbb
+	.long	.LLST338
+	.long	.LVUS338
+	.byte	0
+	.uleb128 0x2
+	.long	0xb50
+	.quad	.LBI2950
+	.value	.LVU678
+	.long	.LLRL339
+	.value	0x131
+	.byte	0xc
+	.long	0x2a33
+	.uleb128 0x1
+	.long	0xb77
+	.long	.LLST340
+	.long	.LVUS340
+	.uleb128 0x1
+	.long	0xb6b
+	.long	.LLST341
+	.long	.LVUS341
+	.uleb128 0x1
+	.long	0xb5f
+	.long	.LLST342
+	.long	.LVUS342
+	.byte	0
+	.uleb128 0x2
+	.long	0xca7
+	.quad	.LBI2953
+	.value	.LVU731
+	.long	.LLRL343
+	.value	0x131
+	.byte	0xaa
+	.long	0x2a60
+	.uleb128 0x1
+	.long	0xcc3
+	.long	.LLST344
+	.long	.LVUS344
+	.uleb128 0x3
+	.long	0xcb6
+	.byte	0
+	.uleb128 0x2
+	.long	0xb50
+	.quad	.LBI2959
+	.value	.LVU693
+	.long	.LLRL345
+	.value	0x131
+	.byte	0xc
+	.long	0x2aa2
+	.uleb128 0x1
+	.long	0xb77
+	.long	.LLST346
+	.long	.LVUS346
+	.uleb128 0x1
+	.long	0xb6b
+	.long	.LLST347
+	.long	.LVUS347
+	.uleb128 0x1
+	.long	0xb5f
+	.long	.LLST348
+	.long	.LVUS348
+	.byte	0
+	.uleb128 0x2
+	.long	0xbd5
+	.quad	.LBI2962
+	.value	.LVU735
+	.long	.LLRL349
+	.value	0x131
+	.byte	0xc8
+	.long	0x2acf
+	.uleb128 0x1
+	.long	0xbf1
+	.long	.LLST350
+	.long	.LVUS350
+	.uleb128 0x3
+	.long	0xbe4
+	.byte	0
+	.uleb128 0x5
+	.long	0xbac
+	.quad	.LBI2966
+	.value	.LVU701
+	.quad	.LBB2966
+	.quad	.LBE2966-.LBB2966
+	.value	0x131
+	.byte	0x2e
+	.long	0x2b10
+	.uleb128 0x1
+	.long	0xbc8
+	.long	.LLST351
+	.long	.LVUS351
+	.uleb128 0x1
+	.long	0xbbb
+	.long	.LLST352
+	.long	.LVUS352
+	.byte	0
+	.uleb128 0x2
+	.long	0xb50
+	.quad	.LBI2968
+	.value	.LVU706
+	.long	.LLRL353
+	.value	0x131
+	.byte	0xc
+	.long	0x2b52
+	.uleb128 0x1
+	.long	0xb77
+	.long	.LLST354
+	.long	.LVUS354
+	.uleb128 0x1
+	.long	0xb6b
+	.long	.LLST355
+	.long	.LVUS355
+	.uleb128 0x1
+	.long	0xb5f
+	.long	.LLST356
+	.long	.LVUS356
+	.byte	0
+	.uleb128 0x2
+	.long	0xc53
+	.quad	.LBI2971
+	.value	.LVU738
+	.long	.LLRL357
+	.value	0x131
+	.byte	0xc8
+	.long	0x2b7f
+	.uleb128 0x1
+	.long	0xc6f
+	.long	.LLST358
+	.long	.LVUS358
+	.uleb128 0x3
+	.long	0xc62
+	.byte	0
+	.uleb128 0x2
+	.long	0xc29
+	.quad	.LBI2974
+	.value	.LVU742
+	.long	.LLRL359
+	.value	0x131
+	.byte	0xc8
+	.long	0x2bac
+	.uleb128 0x1
+	.long	0xc45
+	.long	.LLST360
+	.long	.LVUS360
+	.uleb128 0x3
+	.long	0xc38
+	.byte	0
+	.uleb128 0x5
+	.long	0xca7
+	.quad	.LBI2978
+	.value	.LVU717
+	.quad	.LBB2978
+	.quad	.LBE2978-.LBB2978
+	.value	0x131
+	.byte	0x43
+	.long	0x2be5
+	.uleb128 0x3
+	.long	0xcc3
+	.uleb128 0x1
+	.long	0xcb6
+	.long	.LLST361
+	.long	.LVUS361
+	.byte	0
+	.uleb128 0x5
+	.long	0xbff
+	.quad	.LBI2987
+	.value	.LVU745
+	.quad	.LBB2987
+	.quad	.LBE2987-.LBB2987
+	.value	0x131
+	.byte	0xc8
+	.long	0x2c26
+	.uleb128 0x1
+	.long	0xc1b
+	.long	.LLST362
+	.long	.LVUS362
+	.uleb128 0x1
+	.long	0xc0e
+	.long	.LLST363
+	.long	.LVUS363
+	.byte	0
+	.uleb128 0x6
+	.long	0xca7
+	.quad	.LBI2989
+	.value	.LVU750
+	.quad	.LBB2989
+	.quad	.LBE2989-.LBB2989
+	.value	0x131
+	.value	0x133
+	.long	0x2c68
+	.uleb128 0x1
+	.long	0xcc3
+	.long	.LLST364
+	.long	.LVUS364
+	.uleb128 0x1
+	.long	0xcb6
+	.long	.LLST365
+	.long	.LVUS365
+	.byte	0
+	.uleb128 0x6
+	.long	0xca7
+	.quad	.LBI2991
+	.value	.LVU753
+	.quad	.LBB2991
+	.quad	.LBE2991-.LBB2991
+	.value	0x131
+	.value	0x133
+	.long	0x2ca2
+	.uleb128 0x1
+	.long	0xcc3
+	.long	.LLST366
+	.long	.LVUS366
+	.uleb128 0x3
+	.long	0xcb6
+	.byte	0
+	.uleb128 0x4
+	.long	0xbd5
+	.quad	.LBI2993
+	.value	.LVU759
+	.long	.LLRL367
+	.value	0x131
+	.value	0x164
+	.long	0x2cd8
+	.uleb128 0x1
+	.long	0xbf1
+	.long	.LLST368
+	.long	.LVUS368
+	.uleb128 0x1
+	.long	0xbe4
+	.long	.LLST369
+	.long	.LVUS369
+	.byte	0
+	.uleb128 0x4
+	.long	0xb84
+	.quad	.LBI2996
+	.value	.LVU762
+	.long	.LLRL370
+	.value	0x131
+	.value	0x164
+	.long	0x2d06
+	.uleb128 0x3
+	.long	0xb9f
+	.uleb128 0x1
+	.long	0xb93
+	.long	.LLST371
+	.long	.LVUS371
+	.byte	0
+	.uleb128 0x6
+	.long	0xca7
+	.quad	.LBI3001
+	.value	.LVU769
+	.quad	.LBB3001
+	.quad	.LBE3001-.LBB3001
+	.value	0x131
+	.value	0x199
+	.long	0x2d48
+	.uleb128 0x1
+	.long	0xcc3
+	.long	.LLST372
+	.long	.LVUS372
+	.uleb128 0x1
+	.long	0xcb6
+	.long	.LLST373
+	.long	.LVUS373
+	.byte	0
+	.uleb128 0x4
+	.long	0xbd5
+	.quad	.LBI3003
+	.value	.LVU774
+	.long	.LLRL374
+	.value	0x131
+	.value	0x1b7
+	.long	0x2d7e
+	.uleb128 0x1
+	.long	0xbf1
+	.long	.LLST375
+	.long	.LVUS375
+	.uleb128 0x1
+	.long	0xbe4
+	.long	.LLST376
+	.long	.LVUS376
+	.byte	0
+	.uleb128 0x4
+	.long	0xc53
+	.quad	.LBI3006
+	.value	.LVU777
+	.long	.LLRL377
+	.value	0x131
+	.value	0x1b7
+	.long	0x2db4
+	.uleb128 0x1
+	.long	0xc6f
+	.long	.LLST378
+	.long	.LVUS378
+	.uleb128 0x1
+	.long	0xc62
+	.long	.LLST379
+	.long	.LVUS379
+	.byte	0
+	.uleb128 0x2
+	.long	0xbac
+	.quad	.LBI3010
+	.value	.LVU809
+	.long	.LLRL380
+	.value	0x131
+	.byte	0xc
+	.long	0x2de1
+	.uleb128 0x1
+	.long	0xbc8
+	.long	.LLST381
+	.long	.LVUS381
+	.uleb128 0x3
+	.long	0xbbb
+	.byte	0
+	.uleb128 0x2
+	.long	0xbac
+	.quad	.LBI3014
+	.value	.LVU805
+	.long	.LLRL382
+	.value	0x131
+	.byte	0xc
+	.long	0x2e0e
+	.uleb128 0x1
+	.long	0xbc8
+	.long	.LLST383
+	.long	.LVUS383
+	.uleb128 0x3
+	.long	0xbbb
+	.byte	0
+	.uleb128 0x4
+	.long	0xc29
+	.quad	.LBI3018
+	.value	.LVU790
+	.long	.LLRL384
+	.value	0x131
+	.value	0x1b7
+	.long	0x2e3c
+	.uleb128 0x1
+	.long	0xc45
+	.long	.LLST385
+	.long	.LVUS385
+	.uleb128 0x3
+	.long	0xc38
+	.byte	0
+	.uleb128 0x4
+	.long	0xbff
+	.quad	.LBI3023
+	.value	.LVU793
+	.long	.LLRL386
+	.value	0x131
+	.value	0x1b7
+	.long	0x2e72
+	.uleb128 0x1
+	.long	0xc1b
+	.long	.LLST387
+	.long	.LVUS387
+	.uleb128 0x1
+	.long	0xc0e
+	.long	.LLST388
+	.long	.LVUS388
+	.byte	0
+	.uleb128 0x4
+	.long	0xbac
+	.quad	.LBI3026
+	.value	.LVU798
+	.long	.LLRL389
+	.value	0x131
+	.value	0x22c
+	.long	0x2ea8
+	.uleb128 0x1
+	.long	0xbc8
+	.long	.LLST390
+	.long	.LVUS390
+	.uleb128 0x1
+	.long	0xbbb
+	.long	.LLST391
+	.long	.LVUS391
+	.byte	0
+	.uleb128 0x2
+	.long	0xbac
+	.quad	.LBI3030
+	.value	.LVU925
+	.long	.LLRL392
+	.value	0x132
+	.byte	0x14
+	.long	0x2edd
+	.uleb128 0x1
+	.long	0xbc8
+	.long	.LLST393
+	.long	.LVUS393
+	.uleb128 0x1
+	.long	0xbbb
+	.long	.LLST394
+	.long	.LVUS394
+	.byte	0
+	.uleb128 0x5
+	.long	0xca7
+	.quad	.LBI3036
+	.value	.LVU814
+	.quad	.LBB3036
+	.quad	.LBE3036-.LBB3036
+	.value	0x131
+	.byte	0x13
+	.long	0x2f1e
+	.uleb128 0x1
+	.long	0xcc3
+	.long	.LLST395
+	.long	.LVUS395
+	.uleb128 0x1
+	.long	0xcb6
+	.long	.LLST396
+	.long	.LVUS396
+	.byte	0
+	.uleb128 0x5
+	.long	0xca7
+	.quad	.LBI3038
+	.value	.LVU817
+	.quad	.LBB3038
+	.quad	.LBE3038-.LBB3038
+	.value	0x131
+	.byte	0x13
+	.long	0x2f57
+	.uleb128 0x1
+	.long	0xcc3
+	.long	.LLST397
+	.long	.LVUS397
+	.uleb128 0x3
+	.long	0xcb6
+	.byte	0
+	.uleb128 0x2
+	.long	0xbd5
+	.quad	.LBI3040
+	.value	.LVU823
+	.long	.LLRL398
+	.value	0x131
+	.byte	0x44
+	.long	0x2f8c
+	.uleb128 0x1
+	.long	0xbf1
+	.long	.LLST399
+	.long	.LVUS399
+	.uleb128 0x1
+	.long	0xbe4
+	.long	.LLST400
+	.long	.LVUS400
+	.byte	0
+	.uleb128 0x2
+	.long	0xb84
+	.quad	.LBI3043
+	.value	.LVU826
+	.long	.LLRL401
+	.value	0x131
+	.byte	0x44
+	.long	0x2fb9
+	.uleb128 0x3
+	.long	0xb9f
+	.uleb128 0x1
+	.long	0xb93
+	.long	.LLST402
+	.long	.LVUS402
+	.byte	0
+	.uleb128 0x5
+	.long	0xca7
+	.quad	.LBI3048
+	.value	.LVU833
+	.quad	.LBB3048
+	.quad	.LBE3048-.LBB3048
+	.value	0x131
+	.byte	0x7a
+	.long	0x2ffa
+	.uleb128 0x1
+	.long	0xcc3
+	.long	.LLST403
+	.long	.LVUS403
+	.uleb128 0x1
+	.long	0xcb6
+	.long	.LLST404
+	.long	.LVUS404
+	.byte	0
+	.uleb128 0x2
+	.long	0xbd5
+	.quad	.LBI3050
+	.value	.LVU838
+	.long	.LLRL405
+	.value	0x131
+	.byte	0x98
+	.long	0x302f
+	.uleb128 0x1
+	.long	0xbf1
+	.long	.LLST406
+	.long	.LVUS406
+	.uleb128 0x1
+	.long	0xbe4
+	.long	.LLST407
+	.long	.LVUS407
+	.byte	0
+	.uleb128 0x2
+	.long	0xc53
+	.quad	.LBI3053
+	.value	.LVU841
+	.long	.LLRL408
+	.value	0x131
+	.byte	0x98
+	.long	0x3064
+	.uleb128 0x1
+	.long	0xc6f
+	.long	.LLST409
+	.long	.LVUS409
+	.uleb128 0x1
+	.long	0xc62
+	.long	.LLST410
+	.long	.LVUS410
+	.byte	0
+	.uleb128 0x2
+	.long	0xc29
+	.quad	.LBI3059
+	.value	.LVU850
+	.long	.LLRL411
+	.value	0x131
+	.byte	0x98
+	.long	0x3091
+	.uleb128 0x1
+	.long	0xc45
+	.long	.LLST412
+	.long	.LVUS412
+	.uleb128 0x3
+	.long	0xc38
+	.byte	0
+	.uleb128 0x5
+	.long	0xbff
+	.quad	.LBI3064
+	.value	.LVU853
+	.quad	.LBB3064
+	.quad	.LBE3064-.LBB3064
+	.value	0x131
+	.byte	0x98
+	.long	0x30d2
+	.uleb128 0x1
+	.long	0xc1b
+	.long	.LLST413
+	.long	.LVUS413
+	.uleb128 0x1
+	.long	0xc0e
+	.long	.LLST414
+	.long	.LVUS414
+	.byte	0
+	.uleb128 0x6
+	.long	0xca7
+	.quad	.LBI3066
+	.value	.LVU858
+	.quad	.LBB3066
+	.quad	.LBE3066-.LBB3066
+	.value	0x131
+	.value	0x103
+	.long	0x3114
+	.uleb128 0x1
+	.long	0xcc3
+	.long	.LLST415
+	.long	.LVUS415
+	.uleb128 0x1
+	.long	0xcb6
+	.long	.LLST416
+	.long	.LVUS416
+	.byte	0
+	.uleb128 0x6
+	.long	0xca7
+	.quad	.LBI3068
+	.value	.LVU861
+	.quad	.LBB3068
+	.quad	.LBE3068-.LBB3068
+	.value	0x131
+	.value	0x103
+	.long	0x314e
+	.uleb128 0x1
+	.long	0xcc3
+	.long	.LLST417
+	.long	.LVUS417
+	.uleb128 0x3
+	.long	0xcb6
+	.byte	0
+	.uleb128 0x4
+	.long	0xbd5
+	.quad	.LBI3070
+	.value	.LVU867
+	.long	.LLRL418
+	.value	0x131
+	.value	0x134
+	.long	0x3184
+	.uleb128 0x1
+	.long	0xbf1
+	.long	.LLST419
+	.long	.LVUS419
+	.uleb128 0x1
+	.long	0xbe4
+	.long	.LLST420
+	.long	.LVUS420
+	.byte	0
+	.uleb128 0x4
+	.long	0xb84
+	.quad	.LBI3073
+	.value	.LVU870
+	.long	.LLRL421
+	.value	0x131
+	.value	0x134
+	.long	0x31b2
+	.uleb128 0x3
+	.long	0xb9f
+	.uleb128 0x1
+	.long	0xb93
+	.long	.LLST422
+	.long	.LVUS422
+	.byte	0
+	.uleb128 0x6
+	.long	0xca7
+	.quad	.LBI3078
+	.value	.LVU877
+	.quad	.LBB3078
+	.quad	.LBE3078-.LBB3078
+	.value	0x131
+	.value	0x169
+	.long	0x31f4
+	.uleb128 0x1
+	.long	0xcc3
+	.long	.LLST423
+	.long	.LVUS423
+	.uleb128 0x1
+	.long	0xcb6
+	.long	.LLST424
+	.long	.LVUS424
+	.byte	0
+	.uleb128 0x4
+	.long	0xbd5
+	.quad	.LBI3080
+	.value	.LVU882
+	.long	.LLRL425
+	.value	0x131
+	.value	0x187
+	.long	0x322a
+	.uleb128 0x1
+	.long	0xbf1
+	.long	.LLST426
+	.long	.LVUS426
+	.uleb128 0x1
+	.long	0xbe4
+	.long	.LLST427
+	.long	.LVUS427
+	.byte	0
+	.uleb128 0x4
+	.long	0xc53
+	.quad	.LBI3083
+	.value	.LVU885
+	.long	.LLRL428
+	.value	0x131
+	.value	0x187
+	.long	0x3260
+	.uleb128 0x1
+	.long	0xc6f
+	.long	.LLST429
+	.long	.LVUS429
+	.uleb128 0x1
+	.long	0xc62
+	.long	.LLST430
+	.long	.LVUS430
+	.byte	0
+	.uleb128 0x2
+	.long	0xbac
+	.quad	.LBI3087
+	.value	.LVU918
+	.long	.LLRL431
+	.value	0x131
+	.byte	0xc
+	.long	0x328d
+	.uleb128 0x1
+	.long	0xbc8
+	.long	.LLST432
+	.long	.LVUS432
+	.uleb128 0x3
+	.long	0xbbb
+	.byte	0
+	.uleb128 0x2
+	.long	0xbac
+	.quad	.LBI3091
+	.value	.LVU914
+	.long	.LLRL433
+	.value	0x131
+	.byte	0xc
+	.long	0x32ba
+	.uleb128 0x1
+	.long	0xbc8
+	.long	.LLST434
+	.long	.LVUS434
+	.uleb128 0x3
+	.long	0xbbb
+	.byte	0
+	.uleb128 0x4
+	.long	0xc29
+	.quad	.LBI3095
+	.value	.LVU898
+	.long	.LLRL435
+	.value	0x131
+	.value	0x187
+	.long	0x32e8
+	.uleb128 0x1
+	.long	0xc45
+	.long	.LLST436
+	.long	.LVUS436
+	.uleb128 0x3
+	.long	0xc38
+	.byte	0
+	.uleb128 0x4
+	.long	0xbff
+	.quad	.LBI3100
+	.value	.LVU901
+	.long	.LLRL437
+	.value	0x131
+	.value	0x187
+	.long	0x331e
+	.uleb128 0x1
+	.long	0xc1b
+	.long	.LLST438
+	.long	.LVUS438
+	.uleb128 0x1
+	.long	0xc0e
+	.long	.LLST439
+	.long	.LVUS439
+	.byte	0
+	.uleb128 0x4
+	.long	0xbac
+	.quad	.LBI3103
+	.value	.LVU906
+	.long	.LLRL440
+	.value	0x131
+	.value	0x1fc
+	.long	0x3354
+	.uleb128 0x1
+	.long	0xbc8
+	.long	.LLST441
+	.long	.LVUS441
+	.uleb128 0x1
+	.long	0xbbb
+	.long	.LLST442
+	.long	.LVUS442
+	.byte	0
+	.uleb128 0x2
+	.long	0xb50
+	.quad	.LBI3107
+	.value	.LVU930
+	.long	.LLRL443
+	.value	0x132
+	.byte	0xc
+	.long	0x338e
+	.uleb128 0x1
+	.long	0xb77
+	.long	.LLST444
+	.long	.LVUS444
+	.uleb128 0x3
+	.long	0xb6b
+	.uleb128 0x1
+	.long	0xb5f
+	.long	.LLST445
+	.long	.LVUS445
+	.byte	0
+	.uleb128 0x5
+	.long	0xb50
+	.quad	.LBI3115
+	.value	.LVU936
+	.quad	.LBB3115
+	.quad	.LBE3115-.LBB3115
+	.value	0x132
+	.byte	0xc
+	.long	0x33dc
+	.uleb128 0x1
+	.long	0xb77
+	.long	.LLST446
+	.long	.LVUS446
+	.uleb128 0x1
+	.long	0xb6b
+	.long	.LLST447
+	.long	.LVUS447
+	.uleb128 0x1
+	.long	0xb5f
+	.long	.LLST448
+	.long	.LVUS448
+	.byte	0
+	.uleb128 0x2
+	.long	0xb50
+	.quad	.LBI3117
+	.value	.LVU942
+	.long	.LLRL449
+	.value	0x132
+	.byte	0x37
+	.long	0x341e
+	.uleb128 0x1
+	.long	0xb77
+	.long	.LLST450
+	.long	.LVUS450
+	.uleb128 0x1
+	.long	0xb6b
+	.long	.LLST451
+	.long	.LVUS451
+	.uleb128 0x1
+	.long	0xb5f
+	.long	.LLST452
+	.long	.LVUS452
+	.byte	0
+	.uleb128 0x2
+	.long	0xbac
+	.quad	.LBI3120
+	.value	.LVU948
+	.long	.LLRL453
+	.value	0x132
+	.byte	0x5a
+	.long	0x3453
+	.uleb128 0x1
+	.long	0xbc8
+	.long	.LLST454
+	.long	.LVUS454
+	.uleb128 0x1
+	.long	0xbbb
+	.long	.LLST455
+	.long	.LVUS455
+	.byte	0
+	.uleb128 0x5
+	.long	0xb50
+	.quad	.LBI3125
+	.value	.LVU953
+	.quad	.LBB3125
+	.quad	.LBE3125-.LBB3125
+	.value	0x132
+	.byte	0x14
+	.long	0x34a1
+	.uleb128 0x1
+	.long	0xb77
+	.long	.LLST456
+	.long	.LVUS456
+	.uleb128 0x1
+	.long	0xb6b
+	.long	.LLST457
+	.long	.LVUS457
+	.uleb128 0x1
+	.long	0xb5f
+	.long	.LLST458
+	.long	.LVUS458
+	.byte	0
+	.uleb128 0x5
+	.long	0xb50
+	.quad	.LBI3127
+	.value	.LVU959
+	.quad	.LBB3127
+	.quad	.LBE3127-.LBB3127
+	.value	0x132
+	.byte	0xc
+	.long	0x34ef
+	.uleb128 0x1
+	.long	0xb77
+	.long	.LLST459
+	.long	.LVUS459
+	.uleb128 0x1
+	.long	0xb6b
+	.long	.LLST460
+	.long	.LVUS460
+	.uleb128 0x1
+	.long	0xb5f
+	.long	.LLST461
+	.long	.LVUS461
+	.byte	0
+	.uleb128 0x2
+	.long	0xb50
+	.quad	.LBI3129
+	.value	.LVU964
+	.long	.LLRL462
+	.value	0x132
+	.byte	0x2f
+	.long	0x3531
+	.uleb128 0x1
+	.long	0xb77
+	.long	.LLST463
+	.long	.LVUS463
+	.uleb128 0x1
+	.long	0xb6b
+	.long	.LLST464
+	.long	.LVUS464
+	.uleb128 0x1
+	.long	0xb5f
+	.long	.LLST465
+	.long	.LVUS465
+	.byte	0
+	.uleb128 0x2
+	.long	0xca7
+	.quad	.LBI3134
+	.value	.LVU1025
+	.long	.LLRL466
+	.value	0x132
+	.byte	0x43
+	.long	0x3556
+	.uleb128 0x3
+	.long	0xcc3
+	.uleb128 0x3
+	.long	0xcb6
+	.byte	0
+	.uleb128 0x2
+	.long	0xbac
+	.quad	.LBI3141
+	.value	.LVU1234
+	.long	.LLRL467
+	.value	0x133
+	.byte	0x14
+	.long	0x358b
+	.uleb128 0x1
+	.long	0xbc8
+	.long	.LLST468
+	.long	.LVUS468
+	.uleb128 0x1
+	.long	0xbbb
+	.long	.LLST469
+	.long	.LVUS469
+	.byte	0
+	.uleb128 0x2
+	.long	0xb50
+	.quad	.LBI3145
+	.value	.LVU977
+	.long	.LLRL470
+	.value	0x132
+	.byte	0x53
+	.long	0x35cd
+	.uleb128 0x1
+	.long	0xb77
+	.long	.LLST471
+	.long	.LVUS471
+	.uleb128 0x1
+	.long	0xb6b
+	.long	.LLST472
+	.long	.LVUS472
+	.uleb128 0x1
+	.long	0xb5f
+	.long	.LLST473
+	.long	.LVUS473
+	.byte	0
+	.uleb128 0x2
+	.long	0xbd5
+	.quad	.LBI3148
+	.value	.LVU1029
+	.long	.LLRL474
+	.value	0x132
+	.byte	0x74
+	.long	0x35fa
+	.uleb128 0x1
+	.long	0xbf1
+	.long	.LLST475
+	.long	.LVUS475
+	.uleb128 0x3
+	.long	0xbe4
+	.byte	0
+	.uleb128 0x2
+	.long	0xbac
+	.quad	.LBI3151
+	.value	.LVU1000
+	.long	.LLRL476
+	.value	0x132
+	.byte	0xc
+	.long	0x362f
+	.uleb128 0x1
+	.long	0xbc8
+	.long	.LLST477
+	.long	.LVUS477
+	.uleb128 0x1
+	.long	0xbbb
+	.long	.LLST478
+	.long	.LVUS478
+	.byte	0
+	.uleb128 0x2
+	.long	0xbac
+	.quad	.LBI3154
+	.value	.LVU1004
+	.long	.LLRL479
+	.value	0x132
+	.byte	0xb
+	.long	0x3664
+	.uleb128 0x1
+	.long	0xbc8
+	.long	.LLST480
+	.long	.LVUS480
+	.uleb128 0x1
+	.long	0xbbb
+	.long	.LLST481
+	.long	.LVUS481
+	.byte	0
+	.uleb128 0x2
+	.long	0xb84
+	.quad	.LBI3157
+	.value	.LVU1032
+	.long	.LLRL482
+	.value	0x132
+	.byte	0x74
+	.long	0x3689
+	.uleb128 0x3
+	.long	0xb9f
+	.uleb128 0x3
+	.long	0xb93
+	.byte	0
+	.uleb128 0x2
+	.long	0xca7
+	.quad	.LBI3160
+	.value	.LVU1036
+	.long	.LLRL483
+	.value	0x132
+	.byte	0xaa
+	.long	0x36b6
+	.uleb128 0x1
+	.long	0xcc3
+	.long	.LLST484
+	.long	.LVUS484
+	.uleb128 0x3
+	.long	0xcb6
+	.byte	0
+	.uleb128 0x2
+	.long	0xb50
+	.quad	.LBI3163
+	.value	.LVU1008
+	.long	.LLRL485
+	.value	0x132
+	.byte	0xc
+	.long	0x36f0
+	.uleb128 0x1
+	.long	0xb77
+	.long	.LLST486
+	.long	.LVUS486
+	.uleb128 0x3
+	.long	0xb6b
+	.uleb128 0x1
+	.long	0xb5f
+	.long	.LLST487
+	.long	.LVUS487
+	.byte	0
+	.uleb128 0x2
+	.long	0xbac
+	.quad	.LBI3169
+	.value	.LVU988
+	.long	.LLRL488
+	.value	0x132
+	.byte	0x77
+	.long	0x3725
+	.uleb128 0x1
+	.long	0xbc8
+	.long	.LLST489
+	.long	.LVUS489
+	.uleb128 0x1
+	.long	0xbbb
+	.long	.LLST490
+	.long	.LVUS490
+	.byte	0
+	.uleb128 0x2
+	.long	0xbd5
+	.quad	.LBI3173
+	.value	.LVU1040
+	.long	.LLRL491
+	.value	0x132
+	.byte	0xc8
+	.long	0x3752
+	.uleb128 0x1
+	.long	0xbf1
+	.long	.LLST492
+	.long	.LVUS492
+	.uleb128 0x3
+	.long	0xbe4
+	.byte	0
+	.uleb128 0x2
+	.long	0xbac
+	.quad	.LBI3177
+	.value	.LVU1012
+	.long	.LLRL493
+	.value	0x132
+	.byte	0x2e
+	.long	0x3787
+	.uleb128 0x1
+	.long	0xbc8
+	.long	.LLST494
+	.long	.LVUS494
+	.uleb128 0x1
+	.long	0xbbb
+	.long	.LLST495
+	.long	.LVUS495
+	.byte	0
+	.uleb128 0x2
+	.long	0xb50
+	.quad	.LBI3180
+	.value	.LVU1016
+	.long	.LLRL496
+	.value	0x132
+	.byte	0xc
+	.long	0x37b9
+	.uleb128 0x1
+	.long	0xb77
+	.long	.LLST497
+	.long	.LVUS497
+	.uleb128 0x3
+	.long	0xb6b
+	.uleb128 0x3
+	.long	0xb5f
+	.byte	0
+	.uleb128 0x2
+	.long	0xc53
+	.quad	.LBI3183
+	.value	.LVU1043
+	.long	.LLRL498
+	.value	0x132
+	.byte	0xc8
+	.long	0x37e6
+	.uleb128 0x1
+	.long	0xc6f
+	.long	.LLST499
+	.long	.LVUS499
+	.uleb128 0x3
+	.long	0xc62
+	.byte	0
+	.uleb128 0x5
+	.long	0xca7
+	.quad	.LBI3192
+	.value	.LVU1022
+	.quad	.LBB3192
+	.quad	.LBE3192-.LBB3192
+	.value	0x132
+	.byte	0x43
+	.long	0x3817
+	.uleb128 0x3
+	.long	0xcc3
+	.uleb128 0x3
+	.long	0xcb6
+	.byte	0
+	.uleb128 0x5
+	.long	0xc29
+	.quad	.LBI3200
+	.value	.LVU1047
+	.quad	.LBB3200
+	.quad	.LBE3200-.LBB3200
+	.value	0x132
+	.byte	0xc8
+	.long	0x3850
+	.uleb128 0x1
+	.long	0xc45
+	.long	.LLST500
+	.long	.LVUS500
+	.uleb128 0x3
+	.long	0xc38
+	.byte	0
+	.uleb128 0x2
+	.long	0xbff
+	.quad	.LBI3202
+	.value	.LVU1051
+	.long	.LLRL501
+	.value	0x132
+	.byte	0xc8
+	.long	0x3885
+	.uleb128 0x1
+	.long	0xc1b
+	.long	.LLST502
+	.long	.LVUS502
+	.uleb128 0x1
+	.long	0xc0e
+	.long	.LLST503
+	.long	.LVUS503
+	.byte	0
+	.uleb128 0x2
+	.long	0xb50
+	.quad	.LBI3205
+	.value	.LVU1239
+	.long	.LLRL504
+	.value	0x133
+	.byte	0x14
+	.long	0x38bf
+	.uleb128 0x1
+	.long	0xb77
+	.long	.LLST505
+	.long	.LVUS505
+	.uleb128 0x1
+	.long	0xb6b
+	.long	.LLST506
+	.long	.LVUS506
+	.uleb128 0x3
+	.long	0xb5f
+	.byte	0
+	.uleb128 0x6
+	.long	0xca7
+	.quad	.LBI3209
+	.value	.LVU1057
+	.quad	.LBB3209
+	.quad	.LBE3209-.LBB3209
+	.value	0x132
+	.value	0x133
+	.long	0x3901
+	.uleb128 0x1
+	.long	0xcc3
+	.long	.LLST507
+	.long	.LVUS507
+	.uleb128 0x1
+	.long	0xcb6
+	.long	.LLST508
+	.long	.LVUS508
+	.byte	0
+	.uleb128 0x4
+	.long	0xca7
+	.quad	.LBI3211
+	.value	.LVU1060
+	.long	.LLRL509
+	.value	0x132
+	.value	0x133
+	.long	0x392f
+	.uleb128 0x1
+	.long	0xcc3
+	.long	.LLST510
+	.long	.LVUS510
+	.uleb128 0x3
+	.long	0xcb6
+	.byte	0
+	.uleb128 0x2
+	.long	0xb50
+	.quad	.LBI3214
+	.value	.LVU1244
+	.long	.LLRL511
+	.value	0x133
+	.byte	0x3f
+	.long	0x3969
+	.uleb128 0x1
+	.long	0xb77
+	.long	.LLST512
+	.long	.LVUS512
+	.uleb128 0x1
+	.long	0xb6b
+	.long	.LLST513
+	.long	.LVUS513
+	.uleb128 0x3
+	.long	0xb5f
+	.byte	0
+	.uleb128 0x4
+	.long	0xbd5
+	.quad	.LBI3218
+	.value	.LVU1067
+	.long	.LLRL514
+	.value	0x132
+	.value	0x164
+	.long	0x399f
+	.uleb128 0x1
+	.long	0xbf1
+	.long	.LLST515
+	.long	.LVUS515
+	.uleb128 0x1
+	.long	0xbe4
+	.long	.LLST516
+	.long	.LVUS516
+	.byte	0
+	.uleb128 0x4
+	.long	0xb84
+	.quad	.LBI3221
+	.value	.LVU1070
+	.long	.LLRL517
+	.value	0x132
+	.value	0x164
+	.long	0x39cd
+	.uleb128 0x3
+	.long	0xb9f
+	.uleb128 0x1
+	.long	0xb93
+	.long	.LLST518
+	.long	.LVUS518
+	.byte	0
+	.uleb128 0x6
+	.long	0xca7
+	.quad	.LBI3226
+	.value	.LVU1077
+	.quad	.LBB3226
+	.quad	.LBE3226-.LBB3226
+	.value	0x132
+	.value	0x199
+	.long	0x3a0f
+	.uleb128 0x1
+	.long	0xcc3
+	.long	.LLST519
+	.long	.LVUS519
+	.uleb128 0x1
+	.long	0xcb6
+	.long	.LLST520
+	.long	.LVUS520
+	.byte	0
+	.uleb128 0x4
+	.long	0xbd5
+	.quad	.LBI3228
+	.value	.LVU1082
+	.long	.LLRL521
+	.value	0x132
+	.value	0x1b7
+	.long	0x3a45
+	.uleb128 0x1
+	.long	0xbf1
+	.long	.LLST522
+	.long	.LVUS522
+	.uleb128 0x1
+	.long	0xbe4
+	.long	.LLST523
+	.long	.LVUS523
+	.byte	0
+	.uleb128 0x4
+	.long	0xc53
+	.quad	.LBI3231
+	.value	.LVU1085
+	.long	.LLRL524
+	.value	0x132
+	.value	0x1b7
+	.long	0x3a7b
+	.uleb128 0x1
+	.long	0xc6f
+	.long	.LLST525
+	.long	.LVUS525
+	.uleb128 0x1
+	.long	0xc62
+	.long	.LLST526
+	.long	.LVUS526
+	.byte	0
+	.uleb128 0x2
+	.long	0xbac
+	.quad	.LBI3235
+	.value	.LVU1117
+	.long	.LLRL527
+	.value	0x132
+	.byte	0xc
+	.long	0x3aa8
+	.uleb128 0x1
+	.long	0xbc8
+	.long	.LLST528
+	.long	.LVUS528
+	.uleb128 0x3
+	.long	0xbbb
+	.byte	0
+	.uleb128 0x2
+	.long	0xbac
+	.quad	.LBI3239
+	.value	.LVU1113
+	.long	.LLRL529
+	.value	0x132
+	.byte	0xc
+	.long	0x3ad5
+	.uleb128 0x1
+	.long	0xbc8
+	.long	.LLST530
+	.long	.LVUS530
+	.uleb128 0x3
+	.long	0xbbb
+	.byte	0
+	.uleb128 0x4
+	.long	0xc29
+	.quad	.LBI3243
+	.value	.LVU1098
+	.long	.LLRL531
+	.value	0x132
+	.value	0x1b7
+	.long	0x3b03
+	.uleb128 0x1
+	.long	0xc45
+	.long	.LLST532
+	.long	.LVUS532
+	.uleb128 0x3
+	.long	0xc38
+	.byte	0
+	.uleb128 0x4
+	.long	0xbff
+	.quad	.LBI3248
+	.value	.LVU1101
+	.long	.LLRL533
+	.value	0x132
+	.value	0x1b7
+	.long	0x3b39
+	.uleb128 0x1
+	.long	0xc1b
+	.long	.LLST534
+	.long	.LVUS534
+	.uleb128 0x1
+	.long	0xc0e
+	.long	.LLST535
+	.long	.LVUS535
+	.byte	0
+	.uleb128 0x4
+	.long	0xbac
+	.quad	.LBI3251
+	.value	.LVU1106
+	.long	.LLRL536
+	.value	0x132
+	.value	0x22c
+	.long	0x3b6f
+	.uleb128 0x1
+	.long	0xbc8
+	.long	.LLST537
+	.long	.LVUS537
+	.uleb128 0x1
+	.long	0xbbb
+	.long	.LLST538
+	.long	.LVUS538
+	.byte	0
+	.uleb128 0x5
+	.long	0xca7
+	.quad	.LBI3258
+	.value	.LVU1122
+	.quad	.LBB3258
+	.quad	.LBE3258-.LBB3258
+	.value	0x132
+	.byte	0x13
+	.long	0x3bb0
+	.uleb128 0x1
+	.long	0xcc3
+	.long	.LLST539
+	.long	.LVUS539
+	.uleb128 0x1
+	.long	0xcb6
+	.long	.LLST540
+	.long	.LVUS540
+	.byte	0
+	.uleb128 0x5
+	.long	0xca7
+	.quad	.LBI3260
+	.value	.LVU1125
+	.quad	.LBB3260
+	.quad	.LBE3260-.LBB3260
+	.value	0x132
+	.byte	0x13
+	.long	0x3be9
+	.uleb128 0x1
+	.long	0xcc3
+	.long	.LLST541
+	.long	.LVUS541
+	.uleb128 0x3
+	.long	0xcb6
+	.byte	0
+	.uleb128 0x2
+	.long	0xbd5
+	.quad	.LBI3262
+	.value	.LVU1131
+	.long	.LLRL542
+	.value	0x132
+	.byte	0x44
+	.long	0x3c1e
+	.uleb128 0x1
+	.long	0xbf1
+	.long	.LLST543
+	.long	.LVUS543
+	.uleb128 0x1
+	.long	0xbe4
+	.long	.LLST544
+	.long	.LVUS544
+	.byte	0
+	.uleb128 0x2
+	.long	0xb84
+	.quad	.LBI3265
+	.value	.LVU1134
+	.long	.LLRL545
+	.value	0x132
+	.byte	0x44
+	.long	0x3c4b
+	.uleb128 0x3
+	.long	0xb9f
+	.uleb128 0x1
+	.long	0xb93
+	.long	.LLST546
+	.long	.LVUS546
+	.byte	0
+	.uleb128 0x5
+	.long	0xca7
+	.quad	.LBI3270
+	.value	.LVU1141
+	.quad	.LBB3270
+	.quad	.LBE3270-.LBB3270
+	.value	0x132
+	.byte	0x7a
+	.long	0x3c8c
+	.uleb128 0x1
+	.long	0xcc3
+	.long	.LLST547
+	.long	.LVUS547
+	.uleb128 0x1
+	.long	0xcb6
+	.long	.LLST548
+	.long	.LVUS548
+	.byte	0
+	.uleb128 0x2
+	.long	0xbd5
+	.quad	.LBI3272
+	.value	.LVU1146
+	.long	.LLRL549
+	.value	0x132
+	.byte	0x98
+	.long	0x3cc1
+	.uleb128 0x1
+	.long	0xbf1
+	.long	.LLST550
+	.long	.LVUS550
+	.uleb128 0x1
+	.long	0xbe4
+	.long	.LLST551
+	.long	.LVUS551
+	.byte	0
+	.uleb128 0x2
+	.long	0xc53
+	.quad	.LBI3275
+	.value	.LVU1149
+	.long	.LLRL552
+	.value	0x132
+	.byte	0x98
+	.long	0x3cf6
+	.uleb128 0x1
+	.long	0xc6f
+	.long	.LLST553
+	.long	.LVUS553
+	.uleb128 0x1
+	.long	0xc62
+	.long	.LLST554
+	.long	.LVUS554
+	.byte	0
+	.uleb128 0x2
+	.long	0xc29
+	.quad	.LBI3281
+	.value	.LVU1158
+	.long	.LLRL555
+	.value	0x132
+	.byte	0x98
+	.long	0x3d23
+	.uleb128 0x1
+	.long	0xc45
+	.long	.LLST556
+	.long	.LVUS556
+	.uleb128 0x3
+	.long	0xc38
+	.byte	0
+	.uleb128 0x5
+	.long	0xbff
+	.quad	.LBI3286
+	.value	.LVU1161
+	.quad	.LBB3286
+	.quad	.LBE3286-.LBB3286
+	.value	0x132
+	.byte	0x98
+	.long	0x3d64
+	.uleb128 0x1
+	.long	0xc1b
+	.long	.LLST557
+	.long	.LVUS557
+	.uleb128 0x1
+	.long	0xc0e
+	.long	.LLST558
+	.long	.LVUS558
+	.byte	0
+	.uleb128 0x6
+	.long	0xca7
+	.quad	.LBI3288
+	.value	.LVU1166
+	.quad	.LBB3288
+	.quad	.LBE3288-.LBB3288
+	.value	0x132
+	.value	0x103
+	.long	0x3da6
+	.uleb128 0x1
+	.long	0xcc3
+	.long	.LLST559
+	.long	.LVUS559
+	.uleb128 0x1
+	.long	0xcb6
+	.long	.LLST560
+	.long	.LVUS560
+	.byte	0
+	.uleb128 0x6
+	.long	0xca7
+	.quad	.LBI3290
+	.value	.LVU1169
+	.quad	.LBB3290
+	.quad	.LBE3290-.LBB3290
+	.value	0x132
+	.value	0x103
+	.long	0x3de0
+	.uleb128 0x1
+	.long	0xcc3
+	.long	.LLST561
+	.long	.LVUS561
+	.uleb128 0x3
+	.long	0xcb6
+	.byte	0
+	.uleb128 0x4
+	.long	0xbd5
+	.quad	.LBI3292
+	.value	.LVU1175
+	.long	.LLRL562
+	.value	0x132
+	.value	0x134
+	.long	0x3e16
+	.uleb128 0x1
+	.long	0xbf1
+	.long	.LLST563
+	.long	.LVUS563
+	.uleb128 0x1
+	.long	0xbe4
+	.long	.LLST564
+	.long	.LVUS564
+	.byte	0
+	.uleb128 0x4
+	.long	0xb84
+	.quad	.LBI3295
+	.value	.LVU1178
+	.long	.LLRL565
+	.value	0x132
+	.value	0x134
+	.long	0x3e44
+	.uleb128 0x3
+	.long	0xb9f
+	.uleb128 0x1
+	.long	0xb93
+	.long	.LLST566
+	.long	.LVUS566
+	.byte	0
+	.uleb128 0x2
+	.long	0xbac
+	.quad	.LBI3298
+	.value	.LVU1249
+	.long	.LLRL567
+	.value	0x133
+	.byte	0x6a
+	.long	0x3e79
+	.uleb128 0x1
+	.long	0xbc8
+	.long	.LLST568
+	.long	.LVUS568
+	.uleb128 0x1
+	.long	0xbbb
+	.long	.LLST569
+	.long	.LVUS569
+	.byte	0
+	.uleb128 0x6
+	.long	0xca7
+	.quad	.LBI3303
+	.value	.LVU1186
+	.quad	.LBB3303
+	.quad	.LBE3303-.LBB3303
+	.value	0x132
+	.value	0x169
+	.long	0x3ebb
+	.uleb128 0x1
+	.long	0xcc3
+	.long	.LLST570
+	.long	.LVUS570
+	.uleb128 0x1
+	.long	0xcb6
+	.long	.LLST571
+	.long	.LVUS571
+	.byte	0
+	.uleb128 0x4
+	.long	0xbd5
+	.quad	.LBI3305
+	.value	.LVU1191
+	.long	.LLRL572
+	.value	0x132
+	.value	0x187
+	.long	0x3ef1
+	.uleb128 0x1
+	.long	0xbf1
+	.long	.LLST573
+	.long	.LVUS573
+	.uleb128 0x1
+	.long	0xbe4
+	.long	.LLST574
+	.long	.LVUS574
+	.byte	0
+	.uleb128 0x4
+	.long	0xc53
+	.quad	.LBI3308
+	.value	.LVU1194
+	.long	.LLRL575
+	.value	0x132
+	.value	0x187
+	.long	0x3f27
+	.uleb128 0x1
+	.long	0xc6f
+	.long	.LLST576
+	.long	.LVUS576
+	.uleb128 0x1
+	.long	0xc62
+	.long	.LLST577
+	.long	.LVUS577
+	.byte	0
+	.uleb128 0x2
+	.long	0xbac
+	.quad	.LBI3312
+	.value	.LVU1227
+	.long	.LLRL578
+	.value	0x132
+	.byte	0xc
+	.long	0x3f54
+	.uleb128 0x1
+	.long	0xbc8
+	.long	.LLST579
+	.long	.LVUS579
+	.uleb128 0x3
+	.long	0xbbb
+	.byte	0
+	.uleb128 0x2
+	.long	0xbac
+	.quad	.LBI3316
+	.value	.LVU1223
+	.long	.LLRL580
+	.value	0x132
+	.byte	0xc
+	.long	0x3f81
+	.uleb128 0x1
+	.long	0xbc8
+	.long	.LLST581
+	.long	.LVUS581
+	.uleb128 0x3
+	.long	0xbbb
+	.byte	0
+	.uleb128 0x4
+	.long	0xc29
+	.quad	.LBI3320
+	.value	.LVU1207
+	.long	.LLRL582
+	.value	0x132
+	.value	0x187
+	.long	0x3faf
+	.uleb128 0x1
+	.long	0xc45
+	.long	.LLST583
+	.long	.LVUS583
+	.uleb128 0x3
+	.long	0xc38
+	.byte	0
+	.uleb128 0x4
+	.long	0xbff
+	.quad	.LBI3325
+	.value	.LVU1210
+	.long	.LLRL584
+	.value	0x132
+	.value	0x187
+	.long	0x3fe5
+	.uleb128 0x1
+	.long	0xc1b
+	.long	.LLST585
+	.long	.LVUS585
+	.uleb128 0x1
+	.long	0xc0e
+	.long	.LLST586
+	.long	.LVUS586
+	.byte	0
+	.uleb128 0x4
+	.long	0xbac
+	.quad	.LBI3328
+	.value	.LVU1215
+	.long	.LLRL587
+	.value	0x132
+	.value	0x1fc
+	.long	0x401b
+	.uleb128 0x1
+	.long	0xbc8
+	.long	.LLST588
+	.long	.LVUS588
+	.uleb128 0x1
+	.long	0xbbb
+	.long	.LLST589
+	.long	.LVUS589
+	.byte	0
+	.uleb128 0x2
+	.long	0xb50
+	.quad	.LBI3332
+	.value	.LVU1253
+	.long	.LLRL590
+	.value	0x133
+	.byte	0xc
+	.long	0x405d
+	.uleb128 0x1
+	.long	0xb77
+	.long	.LLST591
+	.long	.LVUS591
+	.uleb128 0x1
+	.long	0xb6b
+	.long	.LLST592
+	.long	.LVUS592
+	.uleb128 0x1
+	.long	0xb5f
+	.long	.LLST593
+	.long	.LVUS593
+	.byte	0
+	.uleb128 0x2
+	.long	0xbac
+	.quad	.LBI3344
+	.value	.LVU1272
+	.long	.LLRL594
+	.value	0x133
+	.byte	0xb
+	.long	0x4092
+	.uleb128 0x1
+	.long	0xbc8
+	.long	.LLST595
+	.long	.LVUS595
+	.uleb128 0x1
+	.long	0xbbb
+	.long	.LLST596
+	.long	.LVUS596
+	.byte	0
+	.uleb128 0x2
+	.long	0xca7
+	.quad	.LBI3347
+	.value	.LVU1335
+	.long	.LLRL597
+	.value	0x133
+	.byte	0x43
+	.long	0x40b7
+	.uleb128 0x3
+	.long	0xcc3
+	.uleb128 0x3
+	.long	0xcb6
+	.byte	0
+	.uleb128 0x2
+	.long	0xb50
+	.quad	.LBI3352
+	.value	.LVU1264
+	.long	.LLRL598
+	.value	0x133
+	.byte	0x37
+	.long	0x40f9
+	.uleb128 0x1
+	.long	0xb77
+	.long	.LLST599
+	.long	.LVUS599
+	.uleb128 0x1
+	.long	0xb6b
+	.long	.LLST600
+	.long	.LVUS600
+	.uleb128 0x1
+	.long	0xb5f
+	.long	.LLST601
+	.long	.LVUS601
+	.byte	0
+	.uleb128 0x2
+	.long	0xb50
+	.quad	.LBI3355
+	.value	.LVU1276
+	.long	.LLRL602
+	.value	0x133
+	.byte	0xc
+	.long	0x4133
+	.uleb128 0x1
+	.long	0xb77
+	.long	.LLST603
+	.long	.LVUS603
+	.uleb128 0x1
+	.long	0xb6b
+	.long	.LLST604
+	.long	.LVUS604
+	.uleb128 0x3
+	.long	0xb5f
+	.byte	0
+	.uleb128 0x2
+	.long	0xb50
+	.quad	.LBI3362
+	.value	.LVU1281
+	.long	.LLRL605
+	.value	0x133
+	.byte	0x37
+	.long	0x4175
+	.uleb128 0x1
+	.long	0xb77
+	.long	.LLST606
+	.long	.LVUS606
+	.uleb128 0x1
+	.long	0xb6b
+	.long	.LLST607
+	.long	.LVUS607
+	.uleb128 0x1
+	.long	0xb5f
+	.long	.LLST608
+	.long	.LVUS608
+	.byte	0
+	.uleb128 0x2
+	.long	0xbac
+	.quad	.LBI3365
+	.value	.LVU1576
+	.long	.LLRL609
+	.value	0x134
+	.byte	0x37
+	.long	0x41aa
+	.uleb128 0x1
+	.long	0xbc8
+	.long	.LLST610
+	.long	.LVUS610
+	.uleb128 0x1
+	.long	0xbbb
+	.long	.LLST611
+	.long	.LVUS611
+	.byte	0
+	.uleb128 0x2
+	.long	0xbd5
+	.quad	.LBI3368
+	.value	.LVU1339
+	.long	.LLRL612
+	.value	0x133
+	.byte	0x74
+	.long	0x41d7
+	.uleb128 0x1
+	.long	0xbf1
+	.long	.LLST613
+	.long	.LVUS613
+	.uleb128 0x3
+	.long	0xbe4
+	.byte	0
+	.uleb128 0x2
+	.long	0xb50
+	.quad	.LBI3372
+	.value	.LVU1291
+	.long	.LLRL614
+	.value	0x133
+	.byte	0x62
+	.long	0x4219
+	.uleb128 0x1
+	.long	0xb77
+	.long	.LLST615
+	.long	.LVUS615
+	.uleb128 0x1
+	.long	0xb6b
+	.long	.LLST616
+	.long	.LVUS616
+	.uleb128 0x1
+	.long	0xb5f
+	.long	.LLST617
+	.long	.LVUS617
+	.byte	0
+	.uleb128 0x2
+	.long	0xbac
+	.quad	.LBI3376
+	.value	.LVU1307
+	.long	.LLRL618
+	.value	0x133
+	.byte	0xb
+	.long	0x424e
+	.uleb128 0x1
+	.long	0xbc8
+	.long	.LLST619
+	.long	.LVUS619
+	.uleb128 0x1
+	.long	0xbbb
+	.long	.LLST620
+	.long	.LVUS620
+	.byte	0
+	.uleb128 0x2
+	.long	0xb84
+	.quad	.LBI3379
+	.value	.LVU1342
+	.long	.LLRL621
+	.value	0x133
+	.byte	0x74
+	.long	0x4273
+	.uleb128 0x3
+	.long	0xb9f
+	.uleb128 0x3
+	.long	0xb93
+	.byte	0
+	.uleb128 0x2
+	.long	0xca7
+	.quad	.LBI3383
+	.value	.LVU1346
+	.long	.LLRL622
+	.value	0x133
+	.byte	0xaa
+	.long	0x42a0
+	.uleb128 0x1
+	.long	0xcc3
+	.long	.LLST623
+	.long	.LVUS623
+	.uleb128 0x3
+	.long	0xcb6
+	.byte	0
+	.uleb128 0x5
+	.long	0xbac
+	.quad	.LBI3387
+	.value	.LVU1302
+	.quad	.LBB3387
+	.quad	.LBE3387-.LBB3387
+	.value	0x133
+	.byte	0x85
+	.long	0x42e1
+	.uleb128 0x1
+	.long	0xbc8
+	.long	.LLST624
+	.long	.LVUS624
+	.uleb128 0x1
+	.long	0xbbb
+	.long	.LLST625
+	.long	.LVUS625
+	.byte	0
+	.uleb128 0x2
+	.long	0xb50
+	.quad	.LBI3390
+	.value	.LVU1311
+	.long	.LLRL626
+	.value	0x133
+	.byte	0xc
+	.long	0x4323
+	.uleb128 0x1
+	.long	0xb77
+	.long	.LLST627
+	.long	.LVUS627
+	.uleb128 0x1
+	.long	0xb6b
+	.long	.LLST628
+	.long	.LVUS628
+	.uleb128 0x1
+	.long	0xb5f
+	.long	.LLST629
+	.long	.LVUS629
+	.byte	0
+	.uleb128 0x2
+	.long	0xbd5
+	.quad	.LBI3393
+	.value	.LVU1350
+	.long	.LLRL630
+	.value	0x133
+	.byte	0xc8
+	.long	0x4350
+	.uleb128 0x1
+	.long	0xbf1
+	.long	.LLST631
+	.long	.LVUS631
+	.uleb128 0x3
+	.long	0xbe4
+	.byte	0
+	.uleb128 0x5
+	.long	0xbac
+	.quad	.LBI3397
+	.value	.LVU1318
+	.quad	.LBB3397
+	.quad	.LBE3397-.LBB3397
+	.value	0x133
+	.byte	0x2e
+	.long	0x4391
+	.uleb128 0x1
+	.long	0xbc8
+	.long	.LLST632
+	.long	.LVUS632
+	.uleb128 0x1
+	.long	0xbbb
+	.long	.LLST633
+	.long	.LVUS633
+	.byte	0
+	.uleb128 0x2
+	.long	0xb50
+	.quad	.LBI3399
+	.value	.LVU1323
+	.long	.LLRL634
+	.value	0x133
+	.byte	0xc
+	.long	0x43d3
+	.uleb128 0x1
+	.long	0xb77
+	.long	.LLST635
+	.long	.LVUS635
+	.uleb128 0x1
+	.long	0xb6b
+	.long	.LLST636
+	.long	.LVUS636
+	.uleb128 0x1
+	.long	0xb5f
+	.long	.LLST637
+	.long	.LVUS637
+	.byte	0
+	.uleb128 0x2
+	.long	0xc53
+	.quad	.LBI3402
+	.value	.LVU1353
+	.long	.LLRL638
+	.value	0x133
+	.byte	0xc8
+	.long	0x4400
+	.uleb128 0x1
+	.long	0xc6f
+	.long	.LLST639
+	.long	.LVUS639
+	.uleb128 0x3
+	.long	0xc62
+	.byte	0
+	.uleb128 0x2
+	.long	0xc29
+	.quad	.LBI3405
+	.value	.LVU1357
+	.long	.LLRL640
+	.value	0x133
+	.byte	0xc8
+	.long	0x442d
+	.uleb128 0x1
+	.long	0xc45
+	.long	.LLST641
+	.long	.LVUS641
+	.uleb128 0x3
+	.long	0xc38
+	.byte	0
+	.uleb128 0x5
+	.long	0xca7
+	.quad	.LBI3409
+	.value	.LVU1332
+	.quad	.LBB3409
+	.quad	.LBE3409-.LBB3409
+	.value	0x133
+	.byte	0x43
+	.long	0x445e
+	.uleb128 0x3
+	.long	0xcc3
+	.uleb128 0x3
+	.long	0xcb6
+	.byte	0
+	.uleb128 0x2
+	.long	0xbff
+	.quad	.LBI3418
+	.value	.LVU1360
+	.long	.LLRL642
+	.value	0x133
+	.byte	0xc8
+	.long	0x4493
+	.uleb128 0x1
+	.long	0xc1b
+	.long	.LLST643
+	.long	.LVUS643
+	.uleb128 0x1
+	.long	0xc0e
+	.long	.LLST644
+	.long	.LVUS644
+	.byte	0
+	.uleb128 0x2
+	.long	0xbac
+	.quad	.LBI3421
+	.value	.LVU1552
+	.long	.LLRL645
+	.value	0x134
+	.byte	0x14
+	.long	0x44c8
+	.uleb128 0x1
+	.long	0xbc8
+	.long	.LLST646
+	.long	.LVUS646
+	.uleb128 0x1
+	.long	0xbbb
+	.long	.LLST647
+	.long	.LVUS647
+	.byte	0
+	.uleb128 0x6
+	.long	0xca7
+	.quad	.LBI3425
+	.value	.LVU1367
+	.quad	.LBB3425
+	.quad	.LBE3425-.LBB3425
+	.value	0x133
+	.value	0x133
+	.long	0x450a
+	.uleb128 0x1
+	.long	0xcc3
+	.long	.LLST648
+	.long	.LVUS648
+	.uleb128 0x1
+	.long	0xcb6
+	.long	.LLST649
+	.long	.LVUS649
+	.byte	0
+	.uleb128 0x6
+	.long	0xca7
+	.quad	.LBI3427
+	.value	.LVU1370
+	.quad	.LBB3427
+	.quad	.LBE3427-.LBB3427
+	.value	0x133
+	.value	0x133
+	.long	0x4544
+	.uleb128 0x1
+	.long	0xcc3
+	.long	.LLST650
+	.long	.LVUS650
+	.uleb128 0x3
+	.long	0xcb6
+	.byte	0
+	.uleb128 0x4
+	.long	0xbd5
+	.quad	.LBI3429
+	.value	.LVU1376
+	.long	.LLRL651
+	.value	0x133
+	.value	0x164
+	.long	0x457a
+	.uleb128 0x1
+	.long	0xbf1
+	.long	.LLST652
+	.long	.LVUS652
+	.uleb128 0x1
+	.long	0xbe4
+	.long	.LLST653
+	.long	.LVUS653
+	.byte	0
+	.uleb128 0x4
+	.long	0xb84
+	.quad	.LBI3432
+	.value	.LVU1379
+	.long	.LLRL654
+	.value	0x133
+	.value	0x164
+	.long	0x45a8
+	.uleb128 0x3
+	.long	0xb9f
+	.uleb128 0x1
+	.long	0xb93
+	.long	.LLST655
+	.long	.LVUS655
+	.byte	0
+	.uleb128 0x4
+	.long	0xca7
+	.quad	.LBI3437
+	.value	.LVU1386
+	.long	.LLRL656
+	.value	0x133
+	.value	0x199
+	.long	0x45de
+	.uleb128 0x1
+	.long	0xcc3
+	.long	.LLST657
+	.long	.LVUS657
+	.uleb128 0x1
+	.long	0xcb6
+	.long	.LLST658
+	.long	.LVUS658
+	.byte	0
+	.uleb128 0x2
+	.long	0xb50
+	.quad	.LBI3440
+	.value	.LVU1914
+	.long	.LLRL659
+	.value	0x135
+	.byte	0xc
+	.long	0x4610
+	.uleb128 0x1
+	.long	0xb77
+	.long	.LLST660
+	.long	.LVUS660
+	.uleb128 0x3
+	.long	0xb6b
+	.uleb128 0x3
+	.long	0xb5f
+	.byte	0
+	.uleb128 0x4
+	.long	0xbd5
+	.quad	.LBI3444
+	.value	.LVU1392
+	.long	.LLRL661
+	.value	0x133
+	.value	0x1b7
+	.long	0x4646
+	.uleb128 0x1
+	.long	0xbf1
+	.long	.LLST662
+	.long	.LVUS662
+	.uleb128 0x1
+	.long	0xbe4
+	.long	.LLST663
+	.long	.LVUS663
+	.byte	0
+	.uleb128 0x4
+	.long	0xc53
+	.quad	.LBI3447
+	.value	.LVU1395
+	.long	.LLRL664
+	.value	0x133
+	.value	0x1b7
+	.long	0x467c
+	.uleb128 0x1
+	.long	0xc6f
+	.long	.LLST665
+	.long	.LVUS665
+	.uleb128 0x1
+	.long	0xc62
+	.long	.LLST666
+	.long	.LVUS666
+	.byte	0
+	.uleb128 0x2
+	.long	0xbac
+	.quad	.LBI3451
+	.value	.LVU1428
+	.long	.LLRL667
+	.value	0x133
+	.byte	0xc
+	.long	0x46a9
+	.uleb128 0x1
+	.long	0xbc8
+	.long	.LLST668
+	.long	.LVUS668
+	.uleb128 0x3
+	.long	0xbbb
+	.byte	0
+	.uleb128 0x2
+	.long	0xb50
+	.quad	.LBI3454
+	.value	.LVU1919
+	.long	.LLRL669
+	.value	0x135
+	.byte	0x37
+	.long	0x46e3
+	.uleb128 0x1
+	.long	0xb77
+	.long	.LLST670
+	.long	.LVUS670
+	.uleb128 0x1
+	.long	0xb6b
+	.long	.LLST671
+	.long	.LVUS671
+	.uleb128 0x3
+	.long	0xb5f
+	.byte	0
+	.uleb128 0x2
+	.long	0xbac
+	.quad	.LBI3458
+	.value	.LVU1424
+	.long	.LLRL672
+	.value	0x133
+	.byte	0xc
+	.long	0x4710
+	.uleb128 0x1
+	.long	0xbc8
+	.long	.LLST673
+	.long	.LVUS673
+	.uleb128 0x3
+	.long	0xbbb
+	.byte	0
+	.uleb128 0x4
+	.long	0xc29
+	.quad	.LBI3462
+	.value	.LVU1409
+	.long	.LLRL674
+	.value	0x133
+	.value	0x1b7
+	.long	0x473e
+	.uleb128 0x1
+	.long	0xc45
+	.long	.LLST675
+	.long	.LVUS675
+	.uleb128 0x3
+	.long	0xc38
+	.byte	0
+	.uleb128 0x4
+	.long	0xbff
+	.quad	.LBI3467
+	.value	.LVU1412
+	.long	.LLRL676
+	.value	0x133
+	.value	0x1b7
+	.long	0x4774
+	.uleb128 0x1
+	.long	0xc1b
+	.long	.LLST677
+	.long	.LVUS677
+	.uleb128 0x1
+	.long	0xc0e
+	.long	.LLST678
+	.long	.LVUS678
+	.byte	0
+	.uleb128 0x4
+	.long	0xbac
+	.quad	.LBI3470
+	.value	.LVU1417
+	.long	.LLRL679
+	.value	0x133
+	.value	0x22c
+	.long	0x47aa
+	.uleb128 0x1
+	.long	0xbc8
+	.long	.LLST680
+	.long	.LVUS680
+	.uleb128 0x1
+	.long	0xbbb
+	.long	.LLST681
+	.long	.LVUS681
+	.byte	0
+	.uleb128 0x5
+	.long	0xca7
+	.quad	.LBI3477
+	.value	.LVU1433
+	.quad	.LBB3477
+	.quad	.LBE3477-.LBB3477
+	.value	0x133
+	.byte	0x13
+	.long	0x47eb
+	.uleb128 0x1
+	.long	0xcc3
+	.long	.LLST682
+	.long	.LVUS682
+	.uleb128 0x1
+	.long	0xcb6
+	.long	.LLST683
+	.long	.LVUS683
+	.byte	0
+	.uleb128 0x5
+	.long	0xca7
+	.quad	.LBI3479
+	.value	.LVU1436
+	.quad	.LBB3479
+	.quad	.LBE3479-.LBB3479
+	.value	0x133
+	.byte	0x13
+	.long	0x4824
+	.uleb128 0x1
+	.long	0xcc3
+	.long	.LLST684
+	.long	.LVUS684
+	.uleb128 0x3
+	.long	0xcb6
+	.byte	0
+	.uleb128 0x2
+	.long	0xbd5
+	.quad	.LBI3481
+	.value	.LVU1442
+	.long	.LLRL685
+	.value	0x133
+	.byte	0x44
+	.long	0x4859
+	.uleb128 0x1
+	.long	0xbf1
+	.long	.LLST686
+	.long	.LVUS686
+	.uleb128 0x1
+	.long	0xbe4
+	.long	.LLST687
+	.long	.LVUS687
+	.byte	0
+	.uleb128 0x2
+	.long	0xb84
+	.quad	.LBI3484
+	.value	.LVU1445
+	.long	.LLRL688
+	.value	0x133
+	.byte	0x44
+	.long	0x4886
+	.uleb128 0x3
+	.long	0xb9f
+	.uleb128 0x1
+	.long	0xb93
+	.long	.LLST689
+	.long	.LVUS689
+	.byte	0
+	.uleb128 0x2
+	.long	0xbac
+	.quad	.LBI3487
+	.value	.LVU1623
+	.long	.LLRL690
+	.value	0x134
+	.byte	0x36
+	.long	0x48bb
+	.uleb128 0x1
+	.long	0xbc8
+	.long	.LLST691
+	.long	.LVUS691
+	.uleb128 0x1
+	.long	0xbbb
+	.long	.LLST692
+	.long	.LVUS692
+	.byte	0
+	.uleb128 0x5
+	.long	0xca7
+	.quad	.LBI3492
+	.value	.LVU1453
+	.quad	.LBB3492
+	.quad	.LBE3492-.LBB3492
+	.value	0x133
+	.byte	0x7a
+	.long	0x48fc
+	.uleb128 0x1
+	.long	0xcc3
+	.long	.LLST693
+	.long	.LVUS693
+	.uleb128 0x1
+	.long	0xcb6
+	.long	.LLST694
+	.long	.LVUS694
+	.byte	0
+	.uleb128 0x2
+	.long	0xbd5
+	.quad	.LBI3494
+	.value	.LVU1458
+	.long	.LLRL695
+	.value	0x133
+	.byte	0x98
+	.long	0x4931
+	.uleb128 0x1
+	.long	0xbf1
+	.long	.LLST696
+	.long	.LVUS696
+	.uleb128 0x1
+	.long	0xbe4
+	.long	.LLST697
+	.long	.LVUS697
+	.byte	0
+	.uleb128 0x2
+	.long	0xc53
+	.quad	.LBI3497
+	.value	.LVU1461
+	.long	.LLRL698
+	.value	0x133
+	.byte	0x98
+	.long	0x4966
+	.uleb128 0x1
+	.long	0xc6f
+	.long	.LLST699
+	.long	.LVUS699
+	.uleb128 0x1
+	.long	0xc62
+	.long	.LLST700
+	.long	.LVUS700
+	.byte	0
+	.uleb128 0x2
+	.long	0xc29
+	.quad	.LBI3503
+	.value	.LVU1470
+	.long	.LLRL701
+	.value	0x133
+	.byte	0x98
+	.long	0x4993
+	.uleb128 0x1
+	.long	0xc45
+	.long	.LLST702
+	.long	.LVUS702
+	.uleb128 0x3
+	.long	0xc38
+	.byte	0
+	.uleb128 0x5
+	.long	0xbff
+	.quad	.LBI3508
+	.value	.LVU1473
+	.quad	.LBB3508
+	.quad	.LBE3508-.LBB3508
+	.value	0x133
+	.byte	0x98
+	.long	0x49d4
+	.uleb128 0x1
+	.long	0xc1b
+	.long	.LLST703
+	.long	.LVUS703
+	.uleb128 0x1
+	.long	0xc0e
+	.long	.LLST704
+	.long	.LVUS704
+	.byte	0
+	.uleb128 0x6
+	.long	0xca7
+	.quad	.LBI3510
+	.value	.LVU1478
+	.quad	.LBB3510
+	.quad	.LBE3510-.LBB3510
+	.value	0x133
+	.value	0x103
+	.long	0x4a16
+	.uleb128 0x1
+	.long	0xcc3
+	.long	.LLST705
+	.long	.LVUS705
+	.uleb128 0x1
+	.long	0xcb6
+	.long	.LLST706
+	.long	.LVUS706
+	.byte	0
+	.uleb128 0x4
+	.long	0xca7
+	.quad	.LBI3512
+	.value	.LVU1481
+	.long	.LLRL707
+	.value	0x133
+	.value	0x103
+	.long	0x4a44
+	.uleb128 0x1
+	.long	0xcc3
+	.long	.LLST708
+	.long	.LVUS708
+	.uleb128 0x3
+	.long	0xcb6
+	.byte	0
+	.uleb128 0x2
+	.long	0xbac
+	.quad	.LBI3516
+	.value	.LVU1556
+	.long	.LLRL709
+	.value	0x134
+	.byte	0xb
+	.long	0x4a79
+	.uleb128 0x1
+	.long	0xbc8
+	.long	.LLST710
+	.long	.LVUS710
+	.uleb128 0x1
+	.long	0xbbb
+	.long	.LLST711
+	.long	.LVUS711
+	.byte	0
+	.uleb128 0x2
+	.long	0xb50
+	.quad	.LBI3520
+	.value	.LVU1560
+	.long	.LLRL712
+	.value	0x134
+	.byte	0xc
+	.long	0x4aab
+	.uleb128 0x1
+	.long	0xb77
+	.long	.LLST713
+	.long	.LVUS713
+	.uleb128 0x3
+	.long	0xb6b
+	.uleb128 0x3
+	.long	0xb5f
+	.byte	0
+	.uleb128 0x2
+	.long	0xb50
+	.quad	.LBI3524
+	.value	.LVU1580
+	.long	.LLRL714
+	.value	0x134
+	.byte	0xc
+	.long	0x4ae5
+	.uleb128 0x1
+	.long	0xb77
+	.long	.LLST715
+	.long	.LVUS715
+	.uleb128 0x3
+	.long	0xb6b
+	.uleb128 0x1
+	.long	0xb5f
+	.long	.LLST716
+	.long	.LVUS716
+	.byte	0
+	.uleb128 0x4
+	.long	0xbd5
+	.quad	.LBI3529
+	.value	.LVU1490
+	.long	.LLRL717
+	.value	0x133
+	.value	0x134
+	.long	0x4b1b
+	.uleb128 0x1
+	.long	0xbf1
+	.long	.LLST718
+	.long	.LVUS718
+	.uleb128 0x1
+	.long	0xbe4
+	.long	.LLST719
+	.long	.LVUS719
+	.byte	0
+	.uleb128 0x4
+	.long	0xb84
+	.quad	.LBI3532
+	.value	.LVU1493
+	.long	.LLRL720
+	.value	0x133
+	.value	0x134
+	.long	0x4b49
+	.uleb128 0x3
+	.long	0xb9f
+	.uleb128 0x1
+	.long	0xb93
+	.long	.LLST721
+	.long	.LVUS721
+	.byte	0
+	.uleb128 0x2
+	.long	0xb50
+	.quad	.LBI3538
+	.value	.LVU1585
+	.long	.LLRL722
+	.value	0x134
+	.byte	0x37
+	.long	0x4b83
+	.uleb128 0x1
+	.long	0xb77
+	.long	.LLST723
+	.long	.LVUS723
+	.uleb128 0x1
+	.long	0xb6b
+	.long	.LLST724
+	.long	.LVUS724
+	.uleb128 0x3
+	.long	0xb5f
+	.byte	0
+	.uleb128 0x2
+	.long	0xbac
+	.quad	.LBI3541
+	.value	.LVU1599
+	.long	.LLRL725
+	.value	0x134
+	.byte	0x2e
+	.long	0x4bb8
+	.uleb128 0x1
+	.long	0xbc8
+	.long	.LLST726
+	.long	.LVUS726
+	.uleb128 0x1
+	.long	0xbbb
+	.long	.LLST727
+	.long	.LVUS727
+	.byte	0
+	.uleb128 0x6
+	.long	0xca7
+	.quad	.LBI3545
+	.value	.LVU1503
+	.quad	.LBB3545
+	.quad	.LBE3545-.LBB3545
+	.value	0x133
+	.value	0x169
+	.long	0x4bfa
+	.uleb128 0x1
+	.long	0xcc3
+	.long	.LLST728
+	.long	.LVUS728
+	.uleb128 0x1
+	.long	0xcb6
+	.long	.LLST729
+	.long	.LVUS729
+	.byte	0
+	.uleb128 0x4
+	.long	0xbd5
+	.quad	.LBI3547
+	.value	.LVU1508
+	.long	.LLRL730
+	.value	0x133
+	.value	0x187
+	.long	0x4c30
+	.uleb128 0x1
+	.long	0xbf1
+	.long	.LLST731
+	.long	.LVUS731
+	.uleb128 0x1
+	.long	0xbe4
+	.long	.LLST732
+	.long	.LVUS732
+	.byte	0
+	.uleb128 0x4
+	.long	0xc53
+	.quad	.LBI3550
+	.value	.LVU1511
+	.long	.LLRL733
+	.value	0x133
+	.value	0x187
+	.long	0x4c66
+	.uleb128 0x1
+	.long	0xc6f
+	.long	.LLST734
+	.long	.LVUS734
+	.uleb128 0x1
+	.long	0xc62
+	.long	.LLST735
+	.long	.LVUS735
+	.byte	0
+	.uleb128 0x2
+	.long	0xbac
+	.quad	.LBI3554
+	.value	.LVU1545
+	.long	.LLRL736
+	.value	0x133
+	.byte	0xc
+	.long	0x4c93
+	.uleb128 0x1
+	.long	0xbc8
+	.long	.LLST737
+	.long	.LVUS737
+	.uleb128 0x3
+	.long	0xbbb
+	.byte	0
+	.uleb128 0x2
+	.long	0xbac
+	.quad	.LBI3558
+	.value	.LVU1541
+	.long	.LLRL738
+	.value	0x133
+	.byte	0xc
+	.long	0x4cc0
+	.uleb128 0x1
+	.long	0xbc8
+	.long	.LLST739
+	.long	.LVUS739
+	.uleb128 0x3
+	.long	0xbbb
+	.byte	0
+	.uleb128 0x4
+	.long	0xc29
+	.quad	.LBI3562
+	.value	.LVU1524
+	.long	.LLRL740
+	.value	0x133
+	.value	0x187
+	.long	0x4cee
+	.uleb128 0x1
+	.long	0xc45
+	.long	.LLST741
+	.long	.LVUS741
+	.uleb128 0x3
+	.long	0xc38
+	.byte	0
+	.uleb128 0x4
+	.long	0xbff
+	.quad	.LBI3567
+	.value	.LVU1527
+	.long	.LLRL742
+	.value	0x133
+	.value	0x187
+	.long	0x4d24
+	.uleb128 0x1
+	.long	0xc1b
+	.long	.LLST743
+	.long	.LVUS743
+	.uleb128 0x1
+	.long	0xc0e
+	.long	.LLST744
+	.long	.LVUS744
+	.byte	0
+	.uleb128 0x4
+	.long	0xbac
+	.quad	.LBI3570
+	.value	.LVU1532
+	.long	.LLRL745
+	.value	0x133
+	.value	0x1fc
+	.long	0x4d5a
+	.uleb128 0x1
+	.long	0xbc8
+	.long	.LLST746
+	.long	.LVUS746
+	.uleb128 0x1
+	.long	0xbbb
+	.long	.LLST747
+	.long	.LVUS747
+	.byte	0
+	.uleb128 0x2
+	.long	0xbac
+	.quad	.LBI3574
+	.value	.LVU1564
+	.long	.LLRL748
+	.value	0x134
+	.byte	0x2e
+	.long	0x4d8f
+	.uleb128 0x1
+	.long	0xbc8
+	.long	.LLST749
+	.long	.LVUS749
+	.uleb128 0x1
+	.long	0xbbb
+	.long	.LLST750
+	.long	.LVUS750
+	.byte	0
+	.uleb128 0x2
+	.long	0xb50
+	.quad	.LBI3577
+	.value	.LVU1568
+	.long	.LLRL751
+	.value	0x134
+	.byte	0xc
+	.long	0x4dd1
+	.uleb128 0x1
+	.long	0xb77
+	.long	.LLST752
+	.long	.LVUS752
+	.uleb128 0x1
+	.long	0xb6b
+	.long	.LLST753
+	.long	.LVUS753
+	.uleb128 0x1
+	.long	0xb5f
+	.long	.LLST754
+	.long	.LVUS754
+	.byte	0
+	.uleb128 0x2
+	.long	0xbac
+	.quad	.LBI3589
+	.value	.LVU1589
+	.long	.LLRL755
+	.value	0x134
+	.byte	0x5a
+	.long	0x4e06
+	.uleb128 0x1
+	.long	0xbc8
+	.long	.LLST756
+	.long	.LVUS756
+	.uleb128 0x1
+	.long	0xbbb
+	.long	.LLST757
+	.long	.LVUS757
+	.byte	0
+	.uleb128 0x5
+	.long	0xb50
+	.quad	.LBI3597
+	.value	.LVU1594
+	.quad	.LBB3597
+	.quad	.LBE3597-.LBB3597
+	.value	0x134
+	.byte	0xc
+	.long	0x4e4c
+	.uleb128 0x1
+	.long	0xb77
+	.long	.LLST758
+	.long	.LVUS758
+	.uleb128 0x3
+	.long	0xb6b
+	.uleb128 0x1
+	.long	0xb5f
+	.long	.LLST759
+	.long	.LVUS759
+	.byte	0
+	.uleb128 0x2
+	.long	0xb50
+	.quad	.LBI3600
+	.value	.LVU1603
+	.long	.LLRL760
+	.value	0x134
+	.byte	0xc
+	.long	0x4e8e
+	.uleb128 0x1
+	.long	0xb77
+	.long	.LLST761
+	.long	.LVUS761
+	.uleb128 0x1
+	.long	0xb6b
+	.long	.LLST762
+	.long	.LVUS762
+	.uleb128 0x1
+	.long	0xb5f
+	.long	.LLST763
+	.long	.LVUS763
+	.byte	0
+	.uleb128 0x2
+	.long	0xca7
+	.quad	.LBI3603
+	.value	.LVU1638
+	.long	.LLRL764
+	.value	0x134
+	.byte	0x43
+	.long	0x4eb3
+	.uleb128 0x3
+	.long	0xcc3
+	.uleb128 0x3
+	.long	0xcb6
+	.byte	0
+	.uleb128 0x5
+	.long	0xbac
+	.quad	.LBI3607
+	.value	.LVU1610
+	.quad	.LBB3607
+	.quad	.LBE3607-.LBB3607
+	.value	0x134
+	.byte	0x2f
+	.long	0x4ef4
+	.uleb128 0x1
+	.long	0xbc8
+	.long	.LLST765
+	.long	.LVUS765
+	.uleb128 0x1
+	.long	0xbbb
+	.long	.LLST766
+	.long	.LVUS766
+	.byte	0
+	.uleb128 0x2
+	.long	0xb50
+	.quad	.LBI3609
+	.value	.LVU1616
+	.long	.LLRL767
+	.value	0x134
+	.byte	0x14
+	.long	0x4f36
+	.uleb128 0x1
+	.long	0xb77
+	.long	.LLST768
+	.long	.LVUS768
+	.uleb128 0x1
+	.long	0xb6b
+	.long	.LLST769
+	.long	.LVUS769
+	.uleb128 0x1
+	.long	0xb5f
+	.long	.LLST770
+	.long	.LVUS770
+	.byte	0
+	.uleb128 0x2
+	.long	0xbd5
+	.quad	.LBI3612
+	.value	.LVU1642
+	.long	.LLRL771
+	.value	0x134
+	.byte	0x74
+	.long	0x4f63
+	.uleb128 0x1
+	.long	0xbf1
+	.long	.LLST772
+	.long	.LVUS772
+	.uleb128 0x3
+	.long	0xbe4
+	.byte	0
+	.uleb128 0x2
+	.long	0xb50
+	.quad	.LBI3617
+	.value	.LVU1627
+	.long	.LLRL773
+	.value	0x134
+	.byte	0xc
+	.long	0x4fa5
+	.uleb128 0x1
+	.long	0xb77
+	.long	.LLST774
+	.long	.LVUS774
+	.uleb128 0x1
+	.long	0xb6b
+	.long	.LLST775
+	.long	.LVUS775
+	.uleb128 0x1
+	.long	0xb5f
+	.long	.LLST776
+	.long	.LVUS776
+	.byte	0
+	.uleb128 0x2
+	.long	0xb84
+	.quad	.LBI3620
+	.value	.LVU1645
+	.long	.LLRL777
+	.value	0x134
+	.byte	0x74
+	.long	0x4fca
+	.uleb128 0x3
+	.long	0xb9f
+	.uleb128 0x3
+	.long	0xb93
+	.byte	0
+	.uleb128 0x5
+	.long	0xca7
+	.quad	.LBI3624
+	.value	.LVU1635
+	.quad	.LBB3624
+	.quad	.LBE3624-.LBB3624
+	.value	0x134
+	.byte	0x43
+	.long	0x500b
+	.uleb128 0x1
+	.long	0xcc3
+	.long	.LLST778
+	.long	.LVUS778
+	.uleb128 0x1
+	.long	0xcb6
+	.long	.LLST779
+	.long	.LVUS779
+	.byte	0
+	.uleb128 0x2
+	.long	0xca7
+	.quad	.LBI3629
+	.value	.LVU1649
+	.long	.LLRL780
+	.value	0x134
+	.byte	0xaa
+	.long	0x5040
+	.uleb128 0x1
+	.long	0xcc3
+	.long	.LLST781
+	.long	.LVUS781
+	.uleb128 0x1
+	.long	0xcb6
+	.long	.LLST782
+	.long	.LVUS782
+	.byte	0
+	.uleb128 0x2
+	.long	0xb50
+	.quad	.LBI3632
+	.value	.LVU1899
+	.long	.LLRL783
+	.value	0x135
+	.byte	0xc
+	.long	0x507a
+	.uleb128 0x1
+	.long	0xb77
+	.long	.LLST784
+	.long	.LVUS784
+	.uleb128 0x3
+	.long	0xb6b
+	.uleb128 0x1
+	.long	0xb5f
+	.long	.LLST785
+	.long	.LVUS785
+	.byte	0
+	.uleb128 0x2
+	.long	0xbd5
+	.quad	.LBI3636
+	.value	.LVU1656
+	.long	.LLRL786
+	.value	0x134
+	.byte	0xc8
+	.long	0x50af
+	.uleb128 0x1
+	.long	0xbf1
+	.long	.LLST787
+	.long	.LVUS787
+	.uleb128 0x1
+	.long	0xbe4
+	.long	.LLST788
+	.long	.LVUS788
+	.byte	0
+	.uleb128 0x2
+	.long	0xc53
+	.quad	.LBI3639
+	.value	.LVU1659
+	.long	.LLRL789
+	.value	0x134
+	.byte	0xc8
+	.long	0x50e4
+	.uleb128 0x1
+	.long	0xc6f
+	.long	.LLST790
+	.long	.LVUS790
+	.uleb128 0x1
+	.long	0xc62
+	.long	.LLST791
+	.long	.LVUS791
+	.byte	0
+	.uleb128 0x2
+	.long	0xc29
+	.quad	.LBI3645
+	.value	.LVU1668
+	.long	.LLRL792
+	.value	0x134
+	.byte	0xc8
+	.long	0x5111
+	.uleb128 0x1
+	.long	0xc45
+	.long	.LLST793
+	.long	.LVUS793
+	.uleb128 0x3
+	.long	0xc38
+	.byte	0
+	.uleb128 0x5
+	.long	0xbff
+	.quad	.LBI3650
+	.value	.LVU1671
+	.quad	.LBB3650
+	.quad	.LBE3650-.LBB3650
+	.value	0x134
+	.byte	0xc8
+	.long	0x5152
+	.uleb128 0x1
+	.long	0xc1b
+	.long	.LLST794
+	.long	.LVUS794
+	.uleb128 0x1
+	.long	0xc0e
+	.long	.LLST795
+	.long	.LVUS795
+	.byte	0
+	.uleb128 0x6
+	.long	0xca7
+	.quad	.LBI3652
+	.value	.LVU1676
+	.quad	.LBB3652
+	.quad	.LBE3652-.LBB3652
+	.value	0x134
+	.value	0x133
+	.long	0x5194
+	.uleb128 0x1
+	.long	0xcc3
+	.long	.LLST796
+	.long	.LVUS796
+	.uleb128 0x1
+	.long	0xcb6
+	.long	.LLST797
+	.long	.LVUS797
+	.byte	0
+	.uleb128 0x6
+	.long	0xca7
+	.quad	.LBI3654
+	.value	.LVU1679
+	.quad	.LBB3654
+	.quad	.LBE3654-.LBB3654
+	.value	0x134
+	.value	0x133
+	.long	0x51ce
+	.uleb128 0x1
+	.long	0xcc3
+	.long	.LLST798
+	.long	.LVUS798
+	.uleb128 0x3
+	.long	0xcb6
+	.byte	0
+	.uleb128 0x4
+	.long	0xbd5
+	.quad	.LBI3656
+	.value	.LVU1685
+	.long	.LLRL799
+	.value	0x134
+	.value	0x164
+	.long	0x5204
+	.uleb128 0x1
+	.long	0xbf1
+	.long	.LLST800
+	.long	.LVUS800
+	.uleb128 0x1
+	.long	0xbe4
+	.long	.LLST801
+	.long	.LVUS801
+	.byte	0
+	.uleb128 0x4
+	.long	0xb84
+	.quad	.LBI3659
+	.value	.LVU1688
+	.long	.LLRL802
+	.value	0x134
+	.value	0x164
+	.long	0x5232
+	.uleb128 0x3
+	.long	0xb9f
+	.uleb128 0x1
+	.long	0xb93
+	.long	.LLST803
+	.long	.LVUS803
+	.byte	0
+	.uleb128 0x2
+	.long	0xbac
+	.quad	.LBI3662
+	.value	.LVU1860
+	.long	.LLRL804
+	.value	0x135
+	.byte	0x47
+	.long	0x5267
+	.uleb128 0x1
+	.long	0xbc8
+	.long	.LLST805
+	.long	.LVUS805
+	.uleb128 0x1
+	.long	0xbbb
+	.long	.LLST806
+	.long	.LVUS806
+	.byte	0
+	.uleb128 0x6
+	.long	0xca7
+	.quad	.LBI3667
+	.value	.LVU1696
+	.quad	.LBB3667
+	.quad	.LBE3667-.LBB3667
+	.value	0x134
+	.value	0x199
+	.long	0x52a9
+	.uleb128 0x1
+	.long	0xcc3
+	.long	.LLST807
+	.long	.LVUS807
+	.uleb128 0x1
+	.long	0xcb6
+	.long	.LLST808
+	.long	.LVUS808
+	.byte	0
+	.uleb128 0x4
+	.long	0xbd5
+	.quad	.LBI3669
+	.value	.LVU1701
+	.long	.LLRL809
+	.value	0x134
+	.value	0x1b7
+	.long	0x52df
+	.uleb128 0x1
+	.long	0xbf1
+	.long	.LLST810
+	.long	.LVUS810
+	.uleb128 0x1
+	.long	0xbe4
+	.long	.LLST811
+	.long	.LVUS811
+	.byte	0
+	.uleb128 0x4
+	.long	0xc53
+	.quad	.LBI3672
+	.value	.LVU1704
+	.long	.LLRL812
+	.value	0x134
+	.value	0x1b7
+	.long	0x5315
+	.uleb128 0x1
+	.long	0xc6f
+	.long	.LLST813
+	.long	.LVUS813
+	.uleb128 0x1
+	.long	0xc62
+	.long	.LLST814
+	.long	.LVUS814
+	.byte	0
+	.uleb128 0x2
+	.long	0xbac
+	.quad	.LBI3676
+	.value	.LVU1736
+	.long	.LLRL815
+	.value	0x134
+	.byte	0xc
+	.long	0x5342
+	.uleb128 0x1
+	.long	0xbc8
+	.long	.LLST816
+	.long	.LVUS816
+	.uleb128 0x3
+	.long	0xbbb
+	.byte	0
+	.uleb128 0x2
+	.long	0xbac
+	.quad	.LBI3680
+	.value	.LVU1732
+	.long	.LLRL817
+	.value	0x134
+	.byte	0xc
+	.long	0x536f
+	.uleb128 0x1
+	.long	0xbc8
+	.long	.LLST818
+	.long	.LVUS818
+	.uleb128 0x3
+	.long	0xbbb
+	.byte	0
+	.uleb128 0x4
+	.long	0xc29
+	.quad	.LBI3684
+	.value	.LVU1717
+	.long	.LLRL819
+	.value	0x134
+	.value	0x1b7
+	.long	0x539d
+	.uleb128 0x1
+	.long	0xc45
+	.long	.LLST820
+	.long	.LVUS820
+	.uleb128 0x3
+	.long	0xc38
+	.byte	0
+	.uleb128 0x4
+	.long	0xbff
+	.quad	.LBI3689
+	.value	.LVU1720
+	.long	.LLRL821
+	.value	0x134
+	.value	0x1b7
+	.long	0x53d3
+	.uleb128 0x1
+	.long	0xc1b
+	.long	.LLST822
+	.long	.LVUS822
+	.uleb128 0x1
+	.long	0xc0e
+	.long	.LLST823
+	.long	.LVUS823
+	.byte	0
+	.uleb128 0x4
+	.long	0xbac
+	.quad	.LBI3692
+	.value	.LVU1725
+	.long	.LLRL824
+	.value	0x134
+	.value	0x22c
+	.long	0x5409
+	.uleb128 0x1
+	.long	0xbc8
+	.long	.LLST825
+	.long	.LVUS825
+	.uleb128 0x1
+	.long	0xbbb
+	.long	.LLST826
+	.long	.LVUS826
+	.byte	0
+	.uleb128 0x5
+	.long	0xca7
+	.quad	.LBI3699
+	.value	.LVU1741
+	.quad	.LBB3699
+	.quad	.LBE3699-.LBB3699
+	.value	0x134
+	.byte	0x13
+	.long	0x544a
+	.uleb128 0x1
+	.long	0xcc3
+	.long	.LLST827
+	.long	.LVUS827
+	.uleb128 0x1
+	.long	0xcb6
+	.long	.LLST828
+	.long	.LVUS828
+	.byte	0
+	.uleb128 0x5
+	.long	0xca7
+	.quad	.LBI3701
+	.value	.LVU1744
+	.quad	.LBB3701
+	.quad	.LBE3701-.LBB3701
+	.value	0x134
+	.byte	0x13
+	.long	0x5483
+	.uleb128 0x1
+	.long	0xcc3
+	.long	.LLST829
+	.long	.LVUS829
+	.uleb128 0x3
+	.long	0xcb6
+	.byte	0
+	.uleb128 0x2
+	.long	0xbd5
+	.quad	.LBI3703
+	.value	.LVU1750
+	.long	.LLRL830
+	.value	0x134
+	.byte	0x44
+	.long	0x54b8
+	.uleb128 0x1
+	.long	0xbf1
+	.long	.LLST831
+	.long	.LVUS831
+	.uleb128 0x1
+	.long	0xbe4
+	.long	.LLST832
+	.long	.LVUS832
+	.byte	0
+	.uleb128 0x2
+	.long	0xb84
+	.quad	.LBI3706
+	.value	.LVU1753
+	.long	.LLRL833
+	.value	0x134
+	.byte	0x44
+	.long	0x54e5
+	.uleb128 0x3
+	.long	0xb9f
+	.uleb128 0x1
+	.long	0xb93
+	.long	.LLST834
+	.long	.LVUS834
+	.byte	0
+	.uleb128 0x5
+	.long	0xca7
+	.quad	.LBI3711
+	.value	.LVU1760
+	.quad	.LBB3711
+	.quad	.LBE3711-.LBB3711
+	.value	0x134
+	.byte	0x7a
+	.long	0x5526
+	.uleb128 0x1
+	.long	0xcc3
+	.long	.LLST835
+	.long	.LVUS835
+	.uleb128 0x1
+	.long	0xcb6
+	.long	.LLST836
+	.long	.LVUS836
+	.byte	0
+	.uleb128 0x2
+	.long	0xbd5
+	.quad	.LBI3713
+	.value	.LVU1765
+	.long	.LLRL837
+	.value	0x134
+	.byte	0x98
+	.long	0x555b
+	.uleb128 0x1
+	.long	0xbf1
+	.long	.LLST838
+	.long	.LVUS838
+	.uleb128 0x1
+	.long	0xbe4
+	.long	.LLST839
+	.long	.LVUS839
+	.byte	0
+	.uleb128 0x2
+	.long	0xc53
+	.quad	.LBI3716
+	.value	.LVU1768
+	.long	.LLRL840
+	.value	0x134
+	.byte	0x98
+	.long	0x5590
+	.uleb128 0x1
+	.long	0xc6f
+	.long	.LLST841
+	.long	.LVUS841
+	.uleb128 0x1
+	.long	0xc62
+	.long	.LLST842
+	.long	.LVUS842
+	.byte	0
+	.uleb128 0x2
+	.long	0xc29
+	.quad	.LBI3722
+	.value	.LVU1777
+	.long	.LLRL843
+	.value	0x134
+	.byte	0x98
+	.long	0x55bd
+	.uleb128 0x1
+	.long	0xc45
+	.long	.LLST844
+	.long	.LVUS844
+	.uleb128 0x3
+	.long	0xc38
+	.byte	0
+	.uleb128 0x5
+	.long	0xbff
+	.quad	.LBI3727
+	.value	.LVU1780
+	.quad	.LBB3727
+	.quad	.LBE3727-.LBB3727
+	.value	0x134
+	.byte	0x98
+	.long	0x55fe
+	.uleb128 0x1
+	.long	0xc1b
+	.long	.LLST845
+	.long	.LVUS845
+	.uleb128 0x1
+	.long	0xc0e
+	.long	.LLST846
+	.long	.LVUS846
+	.byte	0
+	.uleb128 0x6
+	.long	0xca7
+	.quad	.LBI3729
+	.value	.LVU1785
+	.quad	.LBB3729
+	.quad	.LBE3729-.LBB3729
+	.value	0x134
+	.value	0x103
+	.long	0x5640
+	.uleb128 0x1
+	.long	0xcc3
+	.long	.LLST847
+	.long	.LVUS847
+	.uleb128 0x1
+	.long	0xcb6
+	.long	.LLST848
+	.long	.LVUS848
+	.byte	0
+	.uleb128 0x6
+	.long	0xca7
+	.quad	.LBI3731
+	.value	.LVU1788
+	.quad	.LBB3731
+	.quad	.LBE3731-.LBB3731
+	.value	0x134
+	.value	0x103
+	.long	0x567a
+	.uleb128 0x1
+	.long	0xcc3
+	.long	.LLST849
+	.long	.LVUS849
+	.uleb128 0x3
+	.long	0xcb6
+	.byte	0
+	.uleb128 0x4
+	.long	0xbd5
+	.quad	.LBI3733
+	.value	.LVU1794
+	.long	.LLRL850
+	.value	0x134
+	.value	0x134
+	.long	0x56b0
+	.uleb128 0x1
+	.long	0xbf1
+	.long	.LLST851
+	.long	.LVUS851
+	.uleb128 0x1
+	.long	0xbe4
+	.long	.LLST852
+	.long	.LVUS852
+	.byte	0
+	.uleb128 0x4
+	.long	0xb84
+	.quad	.LBI3736
+	.value	.LVU1797
+	.long	.LLRL853
+	.value	0x134
+	.value	0x134
+	.long	0x56de
+	.uleb128 0x3
+	.long	0xb9f
+	.uleb128 0x1
+	.long	0xb93
+	.long	.LLST854
+	.long	.LVUS854
+	.byte	0
+	.uleb128 0x2
+	.long	0xbac
+	.quad	.LBI3739
+	.value	.LVU1886
+	.long	.LLRL855
+	.value	0x135
+	.byte	0x2e
+	.long	0x5713
+	.uleb128 0x1
+	.long	0xbc8
+	.long	.LLST856
+	.long	.LVUS856
+	.uleb128 0x1
+	.long	0xbbb
+	.long	.LLST857
+	.long	.LVUS857
+	.byte	0
+	.uleb128 0x6
+	.long	0xca7
+	.quad	.LBI3744
+	.value	.LVU1805
+	.quad	.LBB3744
+	.quad	.LBE3744-.LBB3744
+	.value	0x134
+	.value	0x169
+	.long	0x5755
+	.uleb128 0x1
+	.long	0xcc3
+	.long	.LLST858
+	.long	.LVUS858
+	.uleb128 0x1
+	.long	0xcb6
+	.long	.LLST859
+	.long	.LVUS859
+	.byte	0
+	.uleb128 0x4
+	.long	0xbd5
+	.quad	.LBI3746
+	.value	.LVU1810
+	.long	.LLRL860
+	.value	0x134
+	.value	0x187
+	.long	0x578b
+	.uleb128 0x1
+	.long	0xbf1
+	.long	.LLST861
+	.long	.LVUS861
+	.uleb128 0x1
+	.long	0xbe4
+	.long	.LLST862
+	.long	.LVUS862
+	.byte	0
+	.uleb128 0x4
+	.long	0xc53
+	.quad	.LBI3749
+	.value	.LVU1813
+	.long	.LLRL863
+	.value	0x134
+	.value	0x187
+	.long	0x57c1
+	.uleb128 0x1
+	.long	0xc6f
+	.long	.LLST864
+	.long	.LVUS864
+	.uleb128 0x1
+	.long	0xc62
+	.long	.LLST865
+	.long	.LVUS865
+	.byte	0
+	.uleb128 0x2
+	.long	0xbac
+	.quad	.LBI3753
+	.value	.LVU1846
+	.long	.LLRL866
+	.value	0x134
+	.byte	0xc
+	.long	0x57ee
+	.uleb128 0x1
+	.long	0xbc8
+	.long	.LLST867
+	.long	.LVUS867
+	.uleb128 0x3
+	.long	0xbbb
+	.byte	0
+	.uleb128 0x2
+	.long	0xbac
+	.quad	.LBI3757
+	.value	.LVU1842
+	.long	.LLRL868
+	.value	0x134
+	.byte	0xc
+	.long	0x581b
+	.uleb128 0x1
+	.long	0xbc8
+	.long	.LLST869
+	.long	.LVUS869
+	.uleb128 0x3
+	.long	0xbbb
+	.byte	0
+	.uleb128 0x4
+	.long	0xc29
+	.quad	.LBI3761
+	.value	.LVU1826
+	.long	.LLRL870
+	.value	0x134
+	.value	0x187
+	.long	0x5849
+	.uleb128 0x1
+	.long	0xc45
+	.long	.LLST871
+	.long	.LVUS871
+	.uleb128 0x3
+	.long	0xc38
+	.byte	0
+	.uleb128 0x4
+	.long	0xbff
+	.quad	.LBI3766
+	.value	.LVU1829
+	.long	.LLRL872
+	.value	0x134
+	.value	0x187
+	.long	0x587f
+	.uleb128 0x1
+	.long	0xc1b
+	.long	.LLST873
+	.long	.LVUS873
+	.uleb128 0x1
+	.long	0xc0e
+	.long	.LLST874
+	.long	.LVUS874
+	.byte	0
+	.uleb128 0x4
+	.long	0xbac
+	.quad	.LBI3769
+	.value	.LVU1834
+	.long	.LLRL875
+	.value	0x134
+	.value	0x1fc
+	.long	0x58b5
+	.uleb128 0x1
+	.long	0xbc8
+	.long	.LLST876
+	.long	.LVUS876
+	.uleb128 0x1
+	.long	0xbbb
+	.long	.LLST877
+	.long	.LVUS877
+	.byte	0
+	.uleb128 0x2
+	.long	0xb50
+	.quad	.LBI3773
+	.value	.LVU1855
+	.long	.LLRL878
+	.value	0x135
+	.byte	0x25
+	.long	0x58f7
+	.uleb128 0x1
+	.long	0xb77
+	.long	.LLST879
+	.long	.LVUS879
+	.uleb128 0x1
+	.long	0xb6b
+	.long	.LLST880
+	.long	.LVUS880
+	.uleb128 0x1
+	.long	0xb5f
+	.long	.LLST881
+	.long	.LVUS881
+	.byte	0
+	.uleb128 0x2
+	.long	0xb50
+	.quad	.LBI3781
+	.value	.LVU1864
+	.long	.LLRL882
+	.value	0x135
+	.byte	0xc
+	.long	0x5939
+	.uleb128 0x1
+	.long	0xb77
+	.long	.LLST883
+	.long	.LVUS883
+	.uleb128 0x1
+	.long	0xb6b
+	.long	.LLST884
+	.long	.LVUS884
+	.uleb128 0x1
+	.long	0xb5f
+	.long	.LLST885
+	.long	.LVUS885
+	.byte	0
+	.uleb128 0x2
+	.long	0xbac
+	.quad	.LBI3784
+	.value	.LVU1870
+	.long	.LLRL886
+	.value	0x135
+	.byte	0x2f
+	.long	0x596e
+	.uleb128 0x1
+	.long	0xbc8
+	.long	.LLST887
+	.long	.LVUS887
+	.uleb128 0x1
+	.long	0xbbb
+	.long	.LLST888
+	.long	.LVUS888
+	.byte	0
+	.uleb128 0x5
+	.long	0xbac
+	.quad	.LBI3789
+	.value	.LVU1874
+	.quad	.LBB3789
+	.quad	.LBE3789-.LBB3789
+	.value	0x135
+	.byte	0xb
+	.long	0x59af
+	.uleb128 0x1
+	.long	0xbc8
+	.long	.LLST889
+	.long	.LVUS889
+	.uleb128 0x1
+	.long	0xbbb
+	.long	.LLST890
+	.long	.LVUS890
+	.byte	0
+	.uleb128 0x2
+	.long	0xb50
+	.quad	.LBI3791
+	.value	.LVU1879
+	.long	.LLRL891
+	.value	0x135
+	.byte	0xc
+	.long	0x59f1
+	.uleb128 0x1
+	.long	0xb77
+	.long	.LLST892
+	.long	.LVUS892
+	.uleb128 0x1
+	.long	0xb6b
+	.long	.LLST893
+	.long	.LVUS893
+	.uleb128 0x1
+	.long	0xb5f
+	.long	.LLST894
+	.long	.LVUS894
+	.byte	0
+	.uleb128 0x2
+	.long	0xca7
+	.quad	.LBI3794
+	.value	.LVU1928
+	.long	.LLRL895
+	.value	0x135
+	.byte	0x6e
+	.long	0x5a16
+	.uleb128 0x3
+	.long	0xcc3
+	.uleb128 0x3
+	.long	0xcb6
+	.byte	0
+	.uleb128 0x2
+	.long	0xb50
+	.quad	.LBI3800
+	.value	.LVU1890
+	.long	.LLRL896
+	.value	0x135
+	.byte	0xc
+	.long	0x5a58
+	.uleb128 0x1
+	.long	0xb77
+	.long	.LLST897
+	.long	.LVUS897
+	.uleb128 0x1
+	.long	0xb6b
+	.long	.LLST898
+	.long	.LVUS898
+	.uleb128 0x1
+	.long	0xb5f
+	.long	.LLST899
+	.long	.LVUS899
+	.byte	0
+	.uleb128 0x2
+	.long	0xbac
+	.quad	.LBI3803
+	.value	.LVU1903
+	.long	.LLRL900
+	.value	0x135
+	.byte	0x2e
+	.long	0x5a8d
+	.uleb128 0x1
+	.long	0xbc8
+	.long	.LLST901
+	.long	.LVUS901
+	.uleb128 0x1
+	.long	0xbbb
+	.long	.LLST902
+	.long	.LVUS902
+	.byte	0
+	.uleb128 0x5
+	.long	0xb50
+	.quad	.LBI3810
+	.value	.LVU1907
+	.quad	.LBB3810
+	.quad	.LBE3810-.LBB3810
+	.value	0x135
+	.byte	0xc
+	.long	0x5adb
+	.uleb128 0x1
+	.long	0xb77
+	.long	.LLST903
+	.long	.LVUS903
+	.uleb128 0x1
+	.long	0xb6b
+	.long	.LLST904
+	.long	.LVUS904
+	.uleb128 0x1
+	.long	0xb5f
+	.long	.LLST905
+	.long	.LVUS905
+	.byte	0
+	.uleb128 0x5
+	.long	0xca7
+	.quad	.LBI3814
+	.value	.LVU1925
+	.quad	.LBB3814
+	.quad	.LBE3814-.LBB3814
+	.value	0x135
+	.byte	0x6e
+	.long	0x5b1c
+	.uleb128 0x1
+	.long	0xcc3
+	.long	.LLST906
+	.long	.LVUS906
+	.uleb128 0x1
+	.long	0xcb6
+	.long	.LLST907
+	.long	.LVUS907
+	.byte	0
+	.uleb128 0x2
+	.long	0xbd5
+	.quad	.LBI3817
+	.value	.LVU1932
+	.long	.LLRL908
+	.value	0x135
+	.byte	0x9f
+	.long	0x5b51
+	.uleb128 0x1
+	.long	0xbf1
+	.long	.LLST909
+	.long	.LVUS909
+	.uleb128 0x1
+	.long	0xbe4
+	.long	.LLST910
+	.long	.LVUS910
+	.byte	0
+	.uleb128 0x2
+	.long	0xb84
+	.quad	.LBI3820
+	.value	.LVU1935
+	.long	.LLRL911
+	.value	0x135
+	.byte	0x9f
+	.long	0x5b7e
+	.uleb128 0x3
+	.long	0xb9f
+	.uleb128 0x1
+	.long	0xb93
+	.long	.LLST912
+	.long	.LVUS912
+	.byte	0
+	.uleb128 0x2
+	.long	0xbac
+	.quad	.LBI3824
+	.value	.LVU2163
+	.long	.LLRL913
+	.value	0x136
+	.byte	0x5a
+	.long	0x5bb3
+	.uleb128 0x1
+	.long	0xbc8
+	.long	.LLST914
+	.long	.LVUS914
+	.uleb128 0x1
+	.long	0xbbb
+	.long	.LLST915
+	.long	.LVUS915
+	.byte	0
+	.uleb128 0x5
+	.long	0xca7
+	.quad	.LBI3828
+	.value	.LVU1943
+	.quad	.LBB3828
+	.quad	.LBE3828-.LBB3828
+	.value	0x135
+	.byte	0xd5
+	.long	0x5bf4
+	.uleb128 0x1
+	.long	0xcc3
+	.long	.LLST916
+	.long	.LVUS916
+	.uleb128 0x1
+	.long	0xcb6
+	.long	.LLST917
+	.long	.LVUS917
+	.byte	0
+	.uleb128 0x2
+	.long	0xbd5
+	.quad	.LBI3830
+	.value	.LVU1948
+	.long	.LLRL918
+	.value	0x135
+	.byte	0xf3
+	.long	0x5c29
+	.uleb128 0x1
+	.long	0xbf1
+	.long	.LLST919
+	.long	.LVUS919
+	.uleb128 0x1
+	.long	0xbe4
+	.long	.LLST920
+	.long	.LVUS920
+	.byte	0
+	.uleb128 0x2
+	.long	0xc53
+	.quad	.LBI3833
+	.value	.LVU1951
+	.long	.LLRL921
+	.value	0x135
+	.byte	0xf3
+	.long	0x5c5e
+	.uleb128 0x1
+	.long	0xc6f
+	.long	.LLST922
+	.long	.LVUS922
+	.uleb128 0x1
+	.long	0xc62
+	.long	.LLST923
+	.long	.LVUS923
+	.byte	0
+	.uleb128 0x2
+	.long	0xc29
+	.quad	.LBI3839
+	.value	.LVU1960
+	.long	.LLRL924
+	.value	0x135
+	.byte	0xf3
+	.long	0x5c8b
+	.uleb128 0x1
+	.long	0xc45
+	.long	.LLST925
+	.long	.LVUS925
+	.uleb128 0x3
+	.long	0xc38
+	.byte	0
+	.uleb128 0x5
+	.long	0xbff
+	.quad	.LBI3844
+	.value	.LVU1963
+	.quad	.LBB3844
+	.quad	.LBE3844-.LBB3844
+	.value	0x135
+	.byte	0xf3
+	.long	0x5ccc
+	.uleb128 0x1
+	.long	0xc1b
+	.long	.LLST926
+	.long	.LVUS926
+	.uleb128 0x1
+	.long	0xc0e
+	.long	.LLST927
+	.long	.LVUS927
+	.byte	0
+	.uleb128 0x6
+	.long	0xca7
+	.quad	.LBI3846
+	.value	.LVU1968
+	.quad	.LBB3846
+	.quad	.LBE3846-.LBB3846
+	.value	0x135
+	.value	0x15e
+	.long	0x5d0e
+	.uleb128 0x1
+	.long	0xcc3
+	.long	.LLST928
+	.long	.LVUS928
+	.uleb128 0x1
+	.long	0xcb6
+	.long	.LLST929
+	.long	.LVUS929
+	.byte	0
+	.uleb128 0x6
+	.long	0xca7
+	.quad	.LBI3848
+	.value	.LVU1971
+	.quad	.LBB3848
+	.quad	.LBE3848-.LBB3848
+	.value	0x135
+	.value	0x15e
+	.long	0x5d48
+	.uleb128 0x1
+	.long	0xcc3
+	.long	.LLST930
+	.long	.LVUS930
+	.uleb128 0x3
+	.long	0xcb6
+	.byte	0
+	.uleb128 0x4
+	.long	0xbd5
+	.quad	.LBI3850
+	.value	.LVU1977
+	.long	.LLRL931
+	.value	0x135
+	.value	0x18f
+	.long	0x5d7e
+	.uleb128 0x1
+	.long	0xbf1
+	.long	.LLST932
+	.long	.LVUS932
+	.uleb128 0x1
+	.long	0xbe4
+	.long	.LLST933
+	.long	.LVUS933
+	.byte	0
+	.uleb128 0x4
+	.long	0xb84
+	.quad	.LBI3853
+	.value	.LVU1980
+	.long	.LLRL934
+	.value	0x135
+	.value	0x18f
+	.long	0x5dac
+	.uleb128 0x3
+	.long	0xb9f
+	.uleb128 0x1
+	.long	0xb93
+	.long	.LLST935
+	.long	.LVUS935
+	.byte	0
+	.uleb128 0x2
+	.long	0xb50
+	.quad	.LBI3856
+	.value	.LVU2176
+	.long	.LLRL936
+	.value	0x136
+	.byte	0xc
+	.long	0x5dde
+	.uleb128 0x1
+	.long	0xb77
+	.long	.LLST937
+	.long	.LVUS937
+	.uleb128 0x3
+	.long	0xb6b
+	.uleb128 0x3
+	.long	0xb5f
+	.byte	0
+	.uleb128 0x6
+	.long	0xca7
+	.quad	.LBI3862
+	.value	.LVU1988
+	.quad	.LBB3862
+	.quad	.LBE3862-.LBB3862
+	.value	0x135
+	.value	0x1c4
+	.long	0x5e20
+	.uleb128 0x1
+	.long	0xcc3
+	.long	.LLST938
+	.long	.LVUS938
+	.uleb128 0x1
+	.long	0xcb6
+	.long	.LLST939
+	.long	.LVUS939
+	.byte	0
+	.uleb128 0x4
+	.long	0xbd5
+	.quad	.LBI3864
+	.value	.LVU1993
+	.long	.LLRL940
+	.value	0x135
+	.value	0x1e2
+	.long	0x5e56
+	.uleb128 0x1
+	.long	0xbf1
+	.long	.LLST941
+	.long	.LVUS941
+	.uleb128 0x1
+	.long	0xbe4
+	.long	.LLST942
+	.long	.LVUS942
+	.byte	0
+	.uleb128 0x4
+	.long	0xc53
+	.quad	.LBI3867
+	.value	.LVU1996
+	.long	.LLRL943
+	.value	0x135
+	.value	0x1e2
+	.long	0x5e8c
+	.uleb128 0x1
+	.long	0xc6f
+	.long	.LLST944
+	.long	.LVUS944
+	.uleb128 0x1
+	.long	0xc62
+	.long	.LLST945
+	.long	.LVUS945
+	.byte	0
+	.uleb128 0x2
+	.long	0xbac
+	.quad	.LBI3871
+	.value	.LVU2028
+	.long	.LLRL946
+	.value	0x135
+	.byte	0xc
+	.long	0x5eb9
+	.uleb128 0x1
+	.long	0xbc8
+	.long	.LLST947
+	.long	.LVUS947
+	.uleb128 0x3
+	.long	0xbbb
+	.byte	0
+	.uleb128 0x2
+	.long	0xbac
+	.quad	.LBI3875
+	.value	.LVU2024
+	.long	.LLRL948
+	.value	0x135
+	.byte	0xc
+	.long	0x5ee6
+	.uleb128 0x1
+	.long	0xbc8
+	.long	.LLST949
+	.long	.LVUS949
+	.uleb128 0x3
+	.long	0xbbb
+	.byte	0
+	.uleb128 0x4
+	.long	0xc29
+	.quad	.LBI3879
+	.value	.LVU2009
+	.long	.LLRL950
+	.value	0x135
+	.value	0x1e2
+	.long	0x5f14
+	.uleb128 0x1
+	.long	0xc45
+	.long	.LLST951
+	.long	.LVUS951
+	.uleb128 0x3
+	.long	0xc38
+	.byte	0
+	.uleb128 0x4
+	.long	0xbff
+	.quad	.LBI3884
+	.value	.LVU2012
+	.long	.LLRL952
+	.value	0x135
+	.value	0x1e2
+	.long	0x5f4a
+	.uleb128 0x1
+	.long	0xc1b
+	.long	.LLST953
+	.long	.LVUS953
+	.uleb128 0x1
+	.long	0xc0e
+	.long	.LLST954
+	.long	.LVUS954
+	.byte	0
+	.uleb128 0x4
+	.long	0xbac
+	.quad	.LBI3887
+	.value	.LVU2017
+	.long	.LLRL955
+	.value	0x135
+	.value	0x257
+	.long	0x5f80
+	.uleb128 0x1
+	.long	0xbc8
+	.long	.LLST956
+	.long	.LVUS956
+	.uleb128 0x1
+	.long	0xbbb
+	.long	.LLST957
+	.long	.LVUS957
+	.byte	0
+	.uleb128 0x5
+	.long	0xca7
+	.quad	.LBI3894
+	.value	.LVU2033
+	.quad	.LBB3894
+	.quad	.LBE3894-.LBB3894
+	.value	0x135
+	.byte	0x13
+	.long	0x5fc1
+	.uleb128 0x1
+	.long	0xcc3
+	.long	.LLST958
+	.long	.LVUS958
+	.uleb128 0x1
+	.long	0xcb6
+	.long	.LLST959
+	.long	.LVUS959
+	.byte	0
+	.uleb128 0x5
+	.long	0xca7
+	.quad	.LBI3896
+	.value	.LVU2036
+	.quad	.LBB3896
+	.quad	.LBE3896-.LBB3896
+	.value	0x135
+	.byte	0x13
+	.long	0x5ffa
+	.uleb128 0x1
+	.long	0xcc3
+	.long	.LLST960
+	.long	.LVUS960
+	.uleb128 0x3
+	.long	0xcb6
+	.byte	0
+	.uleb128 0x2
+	.long	0xbd5
+	.quad	.LBI3898
+	.value	.LVU2042
+	.long	.LLRL961
+	.value	0x135
+	.byte	0x44
+	.long	0x602f
+	.uleb128 0x1
+	.long	0xbf1
+	.long	.LLST962
+	.long	.LVUS962
+	.uleb128 0x1
+	.long	0xbe4
+	.long	.LLST963
+	.long	.LVUS963
+	.byte	0
+	.uleb128 0x2
+	.long	0xb84
+	.quad	.LBI3901
+	.value	.LVU2045
+	.long	.LLRL964
+	.value	0x135
+	.byte	0x44
+	.long	0x605c
+	.uleb128 0x3
+	.long	0xb9f
+	.uleb128 0x1
+	.long	0xb93
+	.long	.LLST965
+	.long	.LVUS965
+	.byte	0
+	.uleb128 0x5
+	.long	0xca7
+	.quad	.LBI3906
+	.value	.LVU2052
+	.quad	.LBB3906
+	.quad	.LBE3906-.LBB3906
+	.value	0x135
+	.byte	0x7a
+	.long	0x609d
+	.uleb128 0x1
+	.long	0xcc3
+	.long	.LLST966
+	.long	.LVUS966
+	.uleb128 0x1
+	.long	0xcb6
+	.long	.LLST967
+	.long	.LVUS967
+	.byte	0
+	.uleb128 0x2
+	.long	0xbd5
+	.quad	.LBI3908
+	.value	.LVU2057
+	.long	.LLRL968
+	.value	0x135
+	.byte	0x98
+	.long	0x60d2
+	.uleb128 0x1
+	.long	0xbf1
+	.long	.LLST969
+	.long	.LVUS969
+	.uleb128 0x1
+	.long	0xbe4
+	.long	.LLST970
+	.long	.LVUS970
+	.byte	0
+	.uleb128 0x2
+	.long	0xc53
+	.quad	.LBI3911
+	.value	.LVU2060
+	.long	.LLRL971
+	.value	0x135
+	.byte	0x98
+	.long	0x6107
+	.uleb128 0x1
+	.long	0xc6f
+	.long	.LLST972
+	.long	.LVUS972
+	.uleb128 0x1
+	.long	0xc62
+	.long	.LLST973
+	.long	.LVUS973
+	.byte	0
+	.uleb128 0x2
+	.long	0xc29
+	.quad	.LBI3917
+	.value	.LVU2069
+	.long	.LLRL974
+	.value	0x135
+	.byte	0x98
+	.long	0x6134
+	.uleb128 0x1
+	.long	0xc45
+	.long	.LLST975
+	.long	.LVUS975
+	.uleb128 0x3
+	.long	0xc38
+	.byte	0
+	.uleb128 0x5
+	.long	0xbff
+	.quad	.LBI3922
+	.value	.LVU2072
+	.quad	.LBB3922
+	.quad	.LBE3922-.LBB3922
+	.value	0x135
+	.byte	0x98
+	.long	0x6175
+	.uleb128 0x1
+	.long	0xc1b
+	.long	.LLST976
+	.long	.LVUS976
+	.uleb128 0x1
+	.long	0xc0e
+	.long	.LLST977
+	.long	.LVUS977
+	.byte	0
+	.uleb128 0x6
+	.long	0xca7
+	.quad	.LBI3924
+	.value	.LVU2077
+	.quad	.LBB3924
+	.quad	.LBE3924-.LBB3924
+	.value	0x135
+	.value	0x103
+	.long	0x61b7
+	.uleb128 0x1
+	.long	0xcc3
+	.long	.LLST978
+	.long	.LVUS978
+	.uleb128 0x1
+	.long	0xcb6
+	.long	.LLST979
+	.long	.LVUS979
+	.byte	0
+	.uleb128 0x6
+	.long	0xca7
+	.quad	.LBI3926
+	.value	.LVU2080
+	.quad	.LBB3926
+	.quad	.LBE3926-.LBB3926
+	.value	0x135
+	.value	0x103
+	.long	0x61f1
+	.uleb128 0x1
+	.long	0xcc3
+	.long	.LLST980
+	.long	.LVUS980
+	.uleb128 0x3
+	.long	0xcb6
+	.byte	0
+	.uleb128 0x4
+	.long	0xbd5
+	.quad	.LBI3928
+	.value	.LVU2086
+	.long	.LLRL981
+	.value	0x135
+	.value	0x134
+	.long	0x6227
+	.uleb128 0x1
+	.long	0xbf1
+	.long	.LLST982
+	.long	.LVUS982
+	.uleb128 0x1
+	.long	0xbe4
+	.long	.LLST983
+	.long	.LVUS983
+	.byte	0
+	.uleb128 0x4
+	.long	0xb84
+	.quad	.LBI3931
+	.value	.LVU2089
+	.long	.LLRL984
+	.value	0x135
+	.value	0x134
+	.long	0x6255
+	.uleb128 0x3
+	.long	0xb9f
+	.uleb128 0x1
+	.long	0xb93
+	.long	.LLST985
+	.long	.LVUS985
+	.byte	0
+	.uleb128 0x2
+	.long	0xbac
+	.quad	.LBI3934
+	.value	.LVU2149
+	.long	.LLRL986
+	.value	0x136
+	.byte	0x14
+	.long	0x628a
+	.uleb128 0x1
+	.long	0xbc8
+	.long	.LLST987
+	.long	.LVUS987
+	.uleb128 0x1
+	.long	0xbbb
+	.long	.LLST988
+	.long	.LVUS988
+	.byte	0
+	.uleb128 0x2
+	.long	0xb50
+	.quad	.LBI3938
+	.value	.LVU2154
+	.long	.LLRL989
+	.value	0x136
+	.byte	0xc
+	.long	0x62bc
+	.uleb128 0x1
+	.long	0xb77
+	.long	.LLST990
+	.long	.LVUS990
+	.uleb128 0x3
+	.long	0xb6b
+	.uleb128 0x3
+	.long	0xb5f
+	.byte	0
+	.uleb128 0x2
+	.long	0xbac
+	.quad	.LBI3941
+	.value	.LVU2167
+	.long	.LLRL991
+	.value	0x136
+	.byte	0xb
+	.long	0x62f1
+	.uleb128 0x1
+	.long	0xbc8
+	.long	.LLST992
+	.long	.LVUS992
+	.uleb128 0x1
+	.long	0xbbb
+	.long	.LLST993
+	.long	.LVUS993
+	.byte	0
+	.uleb128 0x4
+	.long	0xca7
+	.quad	.LBI3945
+	.value	.LVU2099
+	.long	.LLRL994
+	.value	0x135
+	.value	0x169
+	.long	0x6327
+	.uleb128 0x1
+	.long	0xcc3
+	.long	.LLST995
+	.long	.LVUS995
+	.uleb128 0x1
+	.long	0xcb6
+	.long	.LLST996
+	.long	.LVUS996
+	.byte	0
+	.uleb128 0x2
+	.long	0xb50
+	.quad	.LBI3948
+	.value	.LVU2159
+	.long	.LLRL997
+	.value	0x136
+	.byte	0x37
+	.long	0x6361
+	.uleb128 0x1
+	.long	0xb77
+	.long	.LLST998
+	.long	.LVUS998
+	.uleb128 0x1
+	.long	0xb6b
+	.long	.LLST999
+	.long	.LVUS999
+	.uleb128 0x3
+	.long	0xb5f
+	.byte	0
+	.uleb128 0x2
+	.long	0xb50
+	.quad	.LBI3951
+	.value	.LVU2171
+	.long	.LLRL1000
+	.value	0x136
+	.byte	0xc
+	.long	0x639b
+	.uleb128 0x1
+	.long	0xb77
+	.long	.LLST1001
+	.long	.LVUS1001
+	.uleb128 0x1
+	.long	0xb6b
+	.long	.LLST1002
+	.long	.LVUS1002
+	.uleb128 0x3
+	.long	0xb5f
+	.byte	0
+	.uleb128 0x4
+	.long	0xbd5
+	.quad	.LBI3955
+	.value	.LVU2105
+	.long	.LLRL1003
+	.value	0x135
+	.value	0x187
+	.long	0x63d1
+	.uleb128 0x1
+	.long	0xbf1
+	.long	.LLST1004
+	.long	.LVUS1004
+	.uleb128 0x1
+	.long	0xbe4
+	.long	.LLST1005
+	.long	.LVUS1005
+	.byte	0
+	.uleb128 0x4
+	.long	0xc53
+	.quad	.LBI3958
+	.value	.LVU2108
+	.long	.LLRL1006
+	.value	0x135
+	.value	0x187
+	.long	0x6407
+	.uleb128 0x1
+	.long	0xc6f
+	.long	.LLST1007
+	.long	.LVUS1007
+	.uleb128 0x1
+	.long	0xc62
+	.long	.LLST1008
+	.long	.LVUS1008
+	.byte	0
+	.uleb128 0x2
+	.long	0xbac
+	.quad	.LBI3962
+	.value	.LVU2142
+	.long	.LLRL1009
+	.value	0x135
+	.byte	0xc
+	.long	0x6434
+	.uleb128 0x1
+	.long	0xbc8
+	.long	.LLST1010
+	.long	.LVUS1010
+	.uleb128 0x3
+	.long	0xbbb
+	.byte	0
+	.uleb128 0x2
+	.long	0xbac
+	.quad	.LBI3967
+	.value	.LVU2138
+	.long	.LLRL1011
+	.value	0x135
+	.byte	0xc
+	.long	0x6461
+	.uleb128 0x1
+	.long	0xbc8
+	.long	.LLST1012
+	.long	.LVUS1012
+	.uleb128 0x3
+	.long	0xbbb
+	.byte	0
+	.uleb128 0x4
+	.long	0xc29
+	.quad	.LBI3971
+	.value	.LVU2122
+	.long	.LLRL1013
+	.value	0x135
+	.value	0x187
+	.long	0x648f
+	.uleb128 0x1
+	.long	0xc45
+	.long	.LLST1014
+	.long	.LVUS1014
+	.uleb128 0x3
+	.long	0xc38
+	.byte	0
+	.uleb128 0x4
+	.long	0xbff
+	.quad	.LBI3976
+	.value	.LVU2125
+	.long	.LLRL1015
+	.value	0x135
+	.value	0x187
+	.long	0x64c5
+	.uleb128 0x1
+	.long	0xc1b
+	.long	.LLST1016
+	.long	.LVUS1016
+	.uleb128 0x1
+	.long	0xc0e
+	.long	.LLST1017
+	.long	.LVUS1017
+	.byte	0
+	.uleb128 0x4
+	.long	0xbac
+	.quad	.LBI3979
+	.value	.LVU2130
+	.long	.LLRL1018
+	.value	0x135
+	.value	0x1fc
+	.long	0x64fb
+	.uleb128 0x1
+	.long	0xbc8
+	.long	.LLST1019
+	.long	.LVUS1019
+	.uleb128 0x1
+	.long	0xbbb
+	.long	.LLST1020
+	.long	.LVUS1020
+	.byte	0
+	.uleb128 0x2
+	.long	0xb50
+	.quad	.LBI3983
+	.value	.LVU2180
+	.long	.LLRL1021
+	.value	0x136
+	.byte	0x2f
+	.long	0x653d
+	.uleb128 0x1
+	.long	0xb77
+	.long	.LLST1022
+	.long	.LVUS1022
+	.uleb128 0x1
+	.long	0xb6b
+	.long	.LLST1023
+	.long	.LVUS1023
+	.uleb128 0x1
+	.long	0xb5f
+	.long	.LLST1024
+	.long	.LVUS1024
+	.byte	0
+	.uleb128 0x2
+	.long	0xca7
+	.quad	.LBI3998
+	.value	.LVU2226
+	.long	.LLRL1025
+	.value	0x136
+	.byte	0x43
+	.long	0x6562
+	.uleb128 0x3
+	.long	0xcc3
+	.uleb128 0x3
+	.long	0xcb6
+	.byte	0
+	.uleb128 0x2
+	.long	0xb50
+	.quad	.LBI4003
+	.value	.LVU2188
+	.long	.LLRL1026
+	.value	0x136
+	.byte	0x53
+	.long	0x65a4
+	.uleb128 0x1
+	.long	0xb77
+	.long	.LLST1027
+	.long	.LVUS1027
+	.uleb128 0x1
+	.long	0xb6b
+	.long	.LLST1028
+	.long	.LVUS1028
+	.uleb128 0x1
+	.long	0xb5f
+	.long	.LLST1029
+	.long	.LVUS1029
+	.byte	0
+	.uleb128 0x2
+	.long	0xb50
+	.quad	.LBI4006
+	.value	.LVU2212
+	.long	.LLRL1030
+	.value	0x136
+	.byte	0xc
+	.long	0x65de
+	.uleb128 0x1
+	.long	0xb77
+	.long	.LLST1031
+	.long	.LVUS1031
+	.uleb128 0x3
+	.long	0xb6b
+	.uleb128 0x1
+	.long	0xb5f
+	.long	.LLST1032
+	.long	.LVUS1032
+	.byte	0
+	.uleb128 0x2
+	.long	0xb50
+	.quad	.LBI4012
+	.value	.LVU2195
+	.long	.LLRL1033
+	.value	0x136
+	.byte	0x77
+	.long	0x6620
+	.uleb128 0x1
+	.long	0xb77
+	.long	.LLST1034
+	.long	.LVUS1034
+	.uleb128 0x1
+	.long	0xb6b
+	.long	.LLST1035
+	.long	.LVUS1035
+	.uleb128 0x1
+	.long	0xb5f
+	.long	.LLST1036
+	.long	.LVUS1036
+	.byte	0
+	.uleb128 0x2
+	.long	0xbd5
+	.quad	.LBI4016
+	.value	.LVU2230
+	.long	.LLRL1037
+	.value	0x136
+	.byte	0x74
+	.long	0x664d
+	.uleb128 0x1
+	.long	0xbf1
+	.long	.LLST1038
+	.long	.LVUS1038
+	.uleb128 0x3
+	.long	0xbe4
+	.byte	0
+	.uleb128 0x2
+	.long	0xbac
+	.quad	.LBI4020
+	.value	.LVU2203
+	.long	.LLRL1039
+	.value	0x136
+	.byte	0x9b
+	.long	0x6682
+	.uleb128 0x1
+	.long	0xbc8
+	.long	.LLST1040
+	.long	.LVUS1040
+	.uleb128 0x1
+	.long	0xbbb
+	.long	.LLST1041
+	.long	.LVUS1041
+	.byte	0
+	.uleb128 0x2
+	.long	0xb50
+	.quad	.LBI4023
+	.value	.LVU2217
+	.long	.LLRL1042
+	.value	0x136
+	.byte	0xc
+	.long	0x66bc
+	.uleb128 0x1
+	.long	0xb77
+	.long	.LLST1043
+	.long	.LVUS1043
+	.uleb128 0x1
+	.long	0xb6b
+	.long	.LLST1044
+	.long	.LVUS1044
+	.uleb128 0x3
+	.long	0xb5f
+	.byte	0
+	.uleb128 0x2
+	.long	0xb84
+	.quad	.LBI4026
+	.value	.LVU2233
+	.long	.LLRL1045
+	.value	0x136
+	.byte	0x74
+	.long	0x66e1
+	.uleb128 0x3
+	.long	0xb9f
+	.uleb128 0x3
+	.long	0xb93
+	.byte	0
+	.uleb128 0x5
+	.long	0xca7
+	.quad	.LBI4032
+	.value	.LVU2223
+	.quad	.LBB4032
+	.quad	.LBE4032-.LBB4032
+	.value	0x136
+	.byte	0x43
+	.long	0x6722
+	.uleb128 0x1
+	.long	0xcc3
+	.long	.LLST1046
+	.long	.LVUS1046
+	.uleb128 0x1
+	.long	0xcb6
+	.long	.LLST1047
+	.long	.LVUS1047
+	.byte	0
+	.uleb128 0x5
+	.long	0xca7
+	.quad	.LBI4037
+	.value	.LVU2237
+	.quad	.LBB4037
+	.quad	.LBE4037-.LBB4037
+	.value	0x136
+	.byte	0xaa
+	.long	0x6763
+	.uleb128 0x1
+	.long	0xcc3
+	.long	.LLST1048
+	.long	.LVUS1048
+	.uleb128 0x1
+	.long	0xcb6
+	.long	.LLST1049
+	.long	.LVUS1049
+	.byte	0
+	.uleb128 0x2
+	.long	0xbd5
+	.quad	.LBI4039
+	.value	.LVU2242
+	.long	.LLRL1050
+	.value	0x136
+	.byte	0xc8
+	.long	0x6798
+	.uleb128 0x1
+	.long	0xbf1
+	.long	.LLST1051
+	.long	.LVUS1051
+	.uleb128 0x1
+	.long	0xbe4
+	.long	.LLST1052
+	.long	.LVUS1052
+	.byte	0
+	.uleb128 0x2
+	.long	0xc53
+	.quad	.LBI4042
+	.value	.LVU2245
+	.long	.LLRL1053
+	.value	0x136
+	.byte	0xc8
+	.long	0x67cd
+	.uleb128 0x1
+	.long	0xc6f
+	.long	.LLST1054
+	.long	.LVUS1054
+	.uleb128 0x1
+	.long	0xc62
+	.long	.LLST1055
+	.long	.LVUS1055
+	.byte	0
+	.uleb128 0x2
+	.long	0xc29
+	.quad	.LBI4048
+	.value	.LVU2254
+	.long	.LLRL1056
+	.value	0x136
+	.byte	0xc8
+	.long	0x67fa
+	.uleb128 0x1
+	.long	0xc45
+	.long	.LLST1057
+	.long	.LVUS1057
+	.uleb128 0x3
+	.long	0xc38
+	.byte	0
+	.uleb128 0x5
+	.long	0xbff
+	.quad	.LBI4053
+	.value	.LVU2257
+	.quad	.LBB4053
+	.quad	.LBE4053-.LBB4053
+	.value	0x136
+	.byte	0xc8
+	.long	0x683b
+	.uleb128 0x1
+	.long	0xc1b
+	.long	.LLST1058
+	.long	.LVUS1058
+	.uleb128 0x1
+	.long	0xc0e
+	.long	.LLST1059
+	.long	.LVUS1059
+	.byte	0
+	.uleb128 0x6
+	.long	0xca7
+	.quad	.LBI4055
+	.value	.LVU2262
+	.quad	.LBB4055
+	.quad	.LBE4055-.LBB4055
+	.value	0x136
+	.value	0x133
+	.long	0x687d
+	.uleb128 0x1
+	.long	0xcc3
+	.long	.LLST1060
+	.long	.LVUS1060
+	.uleb128 0x1
+	.long	0xcb6
+	.long	.LLST1061
+	.long	.LVUS1061
+	.byte	0
+	.uleb128 0x6
+	.long	0xca7
+	.quad	.LBI4057
+	.value	.LVU2265
+	.quad	.LBB4057
+	.quad	.LBE4057-.LBB4057
+	.value	0x136
+	.value	0x133
+	.long	0x68b7
+	.uleb128 0x1
+	.long	0xcc3
+	.long	.LLST1062
+	.long	.LVUS1062
+	.uleb128 0x3
+	.long	0xcb6
+	.byte	0
+	.uleb128 0x4
+	.long	0xbd5
+	.quad	.LBI4059
+	.value	.LVU2271
+	.long	.LLRL1063
+	.value	0x136
+	.value	0x164
+	.long	0x68ed
+	.uleb128 0x1
+	.long	0xbf1
+	.long	.LLST1064
+	.long	.LVUS1064
+	.uleb128 0x1
+	.long	0xbe4
+	.long	.LLST1065
+	.long	.LVUS1065
+	.byte	0
+	.uleb128 0x4
+	.long	0xb84
+	.quad	.LBI4062
+	.value	.LVU2274
+	.long	.LLRL1066
+	.value	0x136
+	.value	0x164
+	.long	0x691b
+	.uleb128 0x3
+	.long	0xb9f
+	.uleb128 0x1
+	.long	0xb93
+	.long	.LLST1067
+	.long	.LVUS1067
+	.byte	0
+	.uleb128 0x2
+	.long	0xb50
+	.quad	.LBI4065
+	.value	.LVU2489
+	.long	.LLRL1068
+	.value	0x137
+	.byte	0xc
+	.long	0x6955
+	.uleb128 0x1
+	.long	0xb77
+	.long	.LLST1069
+	.long	.LVUS1069
+	.uleb128 0x3
+	.long	0xb6b
+	.uleb128 0x1
+	.long	0xb5f
+	.long	.LLST1070
+	.long	.LVUS1070
+	.byte	0
+	.uleb128 0x4
+	.long	0xca7
+	.quad	.LBI4072
+	.value	.LVU2283
+	.long	.LLRL1071
+	.value	0x136
+	.value	0x199
+	.long	0x698b
+	.uleb128 0x1
+	.long	0xcc3
+	.long	.LLST1072
+	.long	.LVUS1072
+	.uleb128 0x1
+	.long	0xcb6
+	.long	.LLST1073
+	.long	.LVUS1073
+	.byte	0
+	.uleb128 0x2
+	.long	0xb50
+	.quad	.LBI4075
+	.value	.LVU2494
+	.long	.LLRL1074
+	.value	0x137
+	.byte	0xc
+	.long	0x69bd
+	.uleb128 0x1
+	.long	0xb77
+	.long	.LLST1075
+	.long	.LVUS1075
+	.uleb128 0x3
+	.long	0xb6b
+	.uleb128 0x3
+	.long	0xb5f
+	.byte	0
+	.uleb128 0x2
+	.long	0xb50
+	.quad	.LBI4078
+	.value	.LVU2498
+	.long	.LLRL1076
+	.value	0x137
+	.byte	0x2f
+	.long	0x69ff
+	.uleb128 0x1
+	.long	0xb77
+	.long	.LLST1077
+	.long	.LVUS1077
+	.uleb128 0x1
+	.long	0xb6b
+	.long	.LLST1078
+	.long	.LVUS1078
+	.uleb128 0x1
+	.long	0xb5f
+	.long	.LLST1079
+	.long	.LVUS1079
+	.byte	0
+	.uleb128 0x4
+	.long	0xbd5
+	.quad	.LBI4083
+	.value	.LVU2290
+	.long	.LLRL1080
+	.value	0x136
+	.value	0x1b7
+	.long	0x6a35
+	.uleb128 0x1
+	.long	0xbf1
+	.long	.LLST1081
+	.long	.LVUS1081
+	.uleb128 0x1
+	.long	0xbe4
+	.long	.LLST1082
+	.long	.LVUS1082
+	.byte	0
+	.uleb128 0x4
+	.long	0xc53
+	.quad	.LBI4086
+	.value	.LVU2293
+	.long	.LLRL1083
+	.value	0x136
+	.value	0x1b7
+	.long	0x6a6b
+	.uleb128 0x1
+	.long	0xc6f
+	.long	.LLST1084
+	.long	.LVUS1084
+	.uleb128 0x1
+	.long	0xc62
+	.long	.LLST1085
+	.long	.LVUS1085
+	.byte	0
+	.uleb128 0x2
+	.long	0xbac
+	.quad	.LBI4090
+	.value	.LVU2327
+	.long	.LLRL1086
+	.value	0x136
+	.byte	0xc
+	.long	0x6a98
+	.uleb128 0x1
+	.long	0xbc8
+	.long	.LLST1087
+	.long	.LVUS1087
+	.uleb128 0x3
+	.long	0xbbb
+	.byte	0
+	.uleb128 0x2
+	.long	0xbac
+	.quad	.LBI4095
+	.value	.LVU2323
+	.long	.LLRL1088
+	.value	0x136
+	.byte	0xc
+	.long	0x6ac5
+	.uleb128 0x1
+	.long	0xbc8
+	.long	.LLST1089
+	.long	.LVUS1089
+	.uleb128 0x3
+	.long	0xbbb
+	.byte	0
+	.uleb128 0x2
+	.long	0xbac
+	.quad	.LBI4098
+	.value	.LVU2502
+	.long	.LLRL1090
+	.value	0x137
+	.byte	0x53
+	.long	0x6af2
+	.uleb128 0x1
+	.long	0xbc8
+	.long	.LLST1091
+	.long	.LVUS1091
+	.uleb128 0x3
+	.long	0xbbb
+	.byte	0
+	.uleb128 0x4
+	.long	0xc29
+	.quad	.LBI4102
+	.value	.LVU2307
+	.long	.LLRL1092
+	.value	0x136
+	.value	0x1b7
+	.long	0x6b20
+	.uleb128 0x1
+	.long	0xc45
+	.long	.LLST1093
+	.long	.LVUS1093
+	.uleb128 0x3
+	.long	0xc38
+	.byte	0
+	.uleb128 0x4
+	.long	0xbff
+	.quad	.LBI4107
+	.value	.LVU2310
+	.long	.LLRL1094
+	.value	0x136
+	.value	0x1b7
+	.long	0x6b56
+	.uleb128 0x1
+	.long	0xc1b
+	.long	.LLST1095
+	.long	.LVUS1095
+	.uleb128 0x1
+	.long	0xc0e
+	.long	.LLST1096
+	.long	.LVUS1096
+	.byte	0
+	.uleb128 0x4
+	.long	0xbac
+	.quad	.LBI4110
+	.value	.LVU2315
+	.long	.LLRL1097
+	.value	0x136
+	.value	0x22c
+	.long	0x6b8c
+	.uleb128 0x1
+	.long	0xbc8
+	.long	.LLST1098
+	.long	.LVUS1098
+	.uleb128 0x1
+	.long	0xbbb
+	.long	.LLST1099
+	.long	.LVUS1099
+	.byte	0
+	.uleb128 0x2
+	.long	0xb50
+	.quad	.LBI4114
+	.value	.LVU2452
+	.long	.LLRL1100
+	.value	0x137
+	.byte	0xc
+	.long	0x6bbe
+	.uleb128 0x1
+	.long	0xb77
+	.long	.LLST1101
+	.long	.LVUS1101
+	.uleb128 0x3
+	.long	0xb6b
+	.uleb128 0x3
+	.long	0xb5f
+	.byte	0
+	.uleb128 0x5
+	.long	0xca7
+	.quad	.LBI4121
+	.value	.LVU2332
+	.quad	.LBB4121
+	.quad	.LBE4121-.LBB4121
+	.value	0x136
+	.byte	0x13
+	.long	0x6bff
+	.uleb128 0x1
+	.long	0xcc3
+	.long	.LLST1102
+	.long	.LVUS1102
+	.uleb128 0x1
+	.long	0xcb6
+	.long	.LLST1103
+	.long	.LVUS1103
+	.byte	0
+	.uleb128 0x2
+	.long	0xca7
+	.quad	.LBI4123
+	.value	.LVU2335
+	.long	.LLRL1104
+	.value	0x136
+	.byte	0x13
+	.long	0x6c2c
+	.uleb128 0x1
+	.long	0xcc3
+	.long	.LLST1105
+	.long	.LVUS1105
+	.uleb128 0x3
+	.long	0xcb6
+	.byte	0
+	.uleb128 0x2
+	.long	0xbac
+	.quad	.LBI4127
+	.value	.LVU2470
+	.long	.LLRL1106
+	.value	0x137
+	.byte	0x2f
+	.long	0x6c61
+	.uleb128 0x1
+	.long	0xbc8
+	.long	.LLST1107
+	.long	.LVUS1107
+	.uleb128 0x1
+	.long	0xbbb
+	.long	.LLST1108
+	.long	.LVUS1108
+	.byte	0
+	.uleb128 0x2
+	.long	0xb50
+	.quad	.LBI4130
+	.value	.LVU2457
+	.long	.LLRL1109
+	.value	0x137
+	.byte	0xc
+	.long	0x6c93
+	.uleb128 0x1
+	.long	0xb77
+	.long	.LLST1110
+	.long	.LVUS1110
+	.uleb128 0x3
+	.long	0xb6b
+	.uleb128 0x3
+	.long	0xb5f
+	.byte	0
+	.uleb128 0x2
+	.long	0xbd5
+	.quad	.LBI4134
+	.value	.LVU2345
+	.long	.LLRL1111
+	.value	0x136
+	.byte	0x44
+	.long	0x6cc8
+	.uleb128 0x1
+	.long	0xbf1
+	.long	.LLST1112
+	.long	.LVUS1112
+	.uleb128 0x1
+	.long	0xbe4
+	.long	.LLST1113
+	.long	.LVUS1113
+	.byte	0
+	.uleb128 0x2
+	.long	0xb84
+	.quad	.LBI4137
+	.value	.LVU2348
+	.long	.LLRL1114
+	.value	0x136
+	.byte	0x44
+	.long	0x6cf5
+	.uleb128 0x3
+	.long	0xb9f
+	.uleb128 0x1
+	.long	0xb93
+	.long	.LLST1115
+	.long	.LVUS1115
+	.byte	0
+	.uleb128 0x2
+	.long	0xb50
+	.quad	.LBI4140
+	.value	.LVU2475
+	.long	.LLRL1116
+	.value	0x137
+	.byte	0xc
+	.long	0x6d27
+	.uleb128 0x1
+	.long	0xb77
+	.long	.LLST1117
+	.long	.LVUS1117
+	.uleb128 0x3
+	.long	0xb6b
+	.uleb128 0x3
+	.long	0xb5f
+	.byte	0
+	.uleb128 0x5
+	.long	0xca7
+	.quad	.LBI4145
+	.value	.LVU2356
+	.quad	.LBB4145
+	.quad	.LBE4145-.LBB4145
+	.value	0x136
+	.byte	0x7a
+	.long	0x6d68
+	.uleb128 0x1
+	.long	0xcc3
+	.long	.LLST1118
+	.long	.LVUS1118
+	.uleb128 0x1
+	.long	0xcb6
+	.long	.LLST1119
+	.long	.LVUS1119
+	.byte	0
+	.uleb128 0x2
+	.long	0xbd5
+	.quad	.LBI4147
+	.value	.LVU2361
+	.long	.LLRL1120
+	.value	0x136
+	.byte	0x98
+	.long	0x6d9d
+	.uleb128 0x1
+	.long	0xbf1
+	.long	.LLST1121
+	.long	.LVUS1121
+	.uleb128 0x1
+	.long	0xbe4
+	.long	.LLST1122
+	.long	.LVUS1122
+	.byte	0
+	.uleb128 0x2
+	.long	0xc53
+	.quad	.LBI4150
+	.value	.LVU2364
+	.long	.LLRL1123
+	.value	0x136
+	.byte	0x98
+	.long	0x6dd2
+	.uleb128 0x1
+	.long	0xc6f
+	.long	.LLST1124
+	.long	.LVUS1124
+	.uleb128 0x1
+	.long	0xc62
+	.long	.LLST1125
+	.long	.LVUS1125
+	.byte	0
+	.uleb128 0x2
+	.long	0xc29
+	.quad	.LBI4156
+	.value	.LVU2373
+	.long	.LLRL1126
+	.value	0x136
+	.byte	0x98
+	.long	0x6dff
+	.uleb128 0x1
+	.long	0xc45
+	.long	.LLST1127
+	.long	.LVUS1127
+	.uleb128 0x3
+	.long	0xc38
+	.byte	0
+	.uleb128 0x5
+	.long	0xbff
+	.quad	.LBI4161
+	.value	.LVU2376
+	.quad	.LBB4161
+	.quad	.LBE4161-.LBB4161
+	.value	0x136
+	.byte	0x98
+	.long	0x6e40
+	.uleb128 0x1
+	.long	0xc1b
+	.long	.LLST1128
+	.long	.LVUS1128
+	.uleb128 0x1
+	.long	0xc0e
+	.long	.LLST1129
+	.long	.LVUS1129
+	.byte	0
+	.uleb128 0x6
+	.long	0xca7
+	.quad	.LBI4163
+	.value	.LVU2381
+	.quad	.LBB4163
+	.quad	.LBE4163-.LBB4163
+	.value	0x136
+	.value	0x103
+	.long	0x6e82
+	.uleb128 0x1
+	.long	0xcc3
+	.long	.LLST1130
+	.long	.LVUS1130
+	.uleb128 0x1
+	.long	0xcb6
+	.long	.LLST1131
+	.long	.LVUS1131
+	.byte	0
+	.uleb128 0x4
+	.long	0xca7
+	.quad	.LBI4165
+	.value	.LVU2384
+	.long	.LLRL1132
+	.value	0x136
+	.value	0x103
+	.long	0x6eb0
+	.uleb128 0x1
+	.long	0xcc3
+	.long	.LLST1133
+	.long	.LVUS1133
+	.uleb128 0x3
+	.long	0xcb6
+	.byte	0
+	.uleb128 0x2
+	.long	0xbac
+	.quad	.LBI4169
+	.value	.LVU2479
+	.long	.LLRL1134
+	.value	0x137
+	.byte	0x2e
+	.long	0x6ee5
+	.uleb128 0x1
+	.long	0xbc8
+	.long	.LLST1135
+	.long	.LVUS1135
+	.uleb128 0x1
+	.long	0xbbb
+	.long	.LLST1136
+	.long	.LVUS1136
+	.byte	0
+	.uleb128 0x2
+	.long	0xb50
+	.quad	.LBI4173
+	.value	.LVU2483
+	.long	.LLRL1137
+	.value	0x137
+	.byte	0xc
+	.long	0x6f1f
+	.uleb128 0x1
+	.long	0xb77
+	.long	.LLST1138
+	.long	.LVUS1138
+	.uleb128 0x1
+	.long	0xb6b
+	.long	.LLST1139
+	.long	.LVUS1139
+	.uleb128 0x3
+	.long	0xb5f
+	.byte	0
+	.uleb128 0x4
+	.long	0xbd5
+	.quad	.LBI4177
+	.value	.LVU2393
+	.long	.LLRL1140
+	.value	0x136
+	.value	0x134
+	.long	0x6f55
+	.uleb128 0x1
+	.long	0xbf1
+	.long	.LLST1141
+	.long	.LVUS1141
+	.uleb128 0x1
+	.long	0xbe4
+	.long	.LLST1142
+	.long	.LVUS1142
+	.byte	0
+	.uleb128 0x4
+	.long	0xb84
+	.quad	.LBI4180
+	.value	.LVU2396
+	.long	.LLRL1143
+	.value	0x136
+	.value	0x134
+	.long	0x6f83
+	.uleb128 0x3
+	.long	0xb9f
+	.uleb128 0x1
+	.long	0xb93
+	.long	.LLST1144
+	.long	.LVUS1144
+	.byte	0
+	.uleb128 0x6
+	.long	0xca7
+	.quad	.LBI4185
+	.value	.LVU2403
+	.quad	.LBB4185
+	.quad	.LBE4185-.LBB4185
+	.value	0x136
+	.value	0x169
+	.long	0x6fc5
+	.uleb128 0x1
+	.long	0xcc3
+	.long	.LLST1145
+	.long	.LVUS1145
+	.uleb128 0x1
+	.long	0xcb6
+	.long	.LLST1146
+	.long	.LVUS1146
+	.byte	0
+	.uleb128 0x4
+	.long	0xbd5
+	.quad	.LBI4187
+	.value	.LVU2408
+	.long	.LLRL1147
+	.value	0x136
+	.value	0x187
+	.long	0x6ffb
+	.uleb128 0x1
+	.long	0xbf1
+	.long	.LLST1148
+	.long	.LVUS1148
+	.uleb128 0x1
+	.long	0xbe4
+	.long	.LLST1149
+	.long	.LVUS1149
+	.byte	0
+	.uleb128 0x4
+	.long	0xc53
+	.quad	.LBI4190
+	.value	.LVU2411
+	.long	.LLRL1150
+	.value	0x136
+	.value	0x187
+	.long	0x7031
+	.uleb128 0x1
+	.long	0xc6f
+	.long	.LLST1151
+	.long	.LVUS1151
+	.uleb128 0x1
+	.long	0xc62
+	.long	.LLST1152
+	.long	.LVUS1152
+	.byte	0
+	.uleb128 0x2
+	.long	0xbac
+	.quad	.LBI4194
+	.value	.LVU2443
+	.long	.LLRL1153
+	.value	0x136
+	.byte	0xc
+	.long	0x705e
+	.uleb128 0x1
+	.long	0xbc8
+	.long	.LLST1154
+	.long	.LVUS1154
+	.uleb128 0x3
+	.long	0xbbb
+	.byte	0
+	.uleb128 0x2
+	.long	0xbac
+	.quad	.LBI4198
+	.value	.LVU2439
+	.long	.LLRL1155
+	.value	0x136
+	.byte	0xc
+	.long	0x708b
+	.uleb128 0x1
+	.long	0xbc8
+	.long	.LLST1156
+	.long	.LVUS1156
+	.uleb128 0x3
+	.long	0xbbb
+	.byte	0
+	.uleb128 0x4
+	.long	0xc29
+	.quad	.LBI4202
+	.value	.LVU2424
+	.long	.LLRL1157
+	.value	0x136
+	.value	0x187
+	.long	0x70b9
+	.uleb128 0x1
+	.long	0xc45
+	.long	.LLST1158
+	.long	.LVUS1158
+	.uleb128 0x3
+	.long	0xc38
+	.byte	0
+	.uleb128 0x4
+	.long	0xbff
+	.quad	.LBI4207
+	.value	.LVU2427
+	.long	.LLRL1159
+	.value	0x136
+	.value	0x187
+	.long	0x70ef
+	.uleb128 0x1
+	.long	0xc1b
+	.long	.LLST1160
+	.long	.LVUS1160
+	.uleb128 0x1
+	.long	0xc0e
+	.long	.LLST1161
+	.long	.LVUS1161
+	.byte	0
+	.uleb128 0x4
+	.long	0xbac
+	.quad	.LBI4210
+	.value	.LVU2432
+	.long	.LLRL1162
+	.value	0x136
+	.value	0x1fc
+	.long	0x7125
+	.uleb128 0x1
+	.long	0xbc8
+	.long	.LLST1163
+	.long	.LVUS1163
+	.uleb128 0x1
+	.long	0xbbb
+	.long	.LLST1164
+	.long	.LVUS1164
+	.byte	0
+	.uleb128 0x2
+	.long	0xbac
+	.quad	.LBI4214
+	.value	.LVU2461
+	.long	.LLRL1165
+	.value	0x137
+	.byte	0x2e
+	.long	0x715a
+	.uleb128 0x1
+	.long	0xbc8
+	.long	.LLST1166
+	.long	.LVUS1166
+	.uleb128 0x1
+	.long	0xbbb
+	.long	.LLST1167
+	.long	.LVUS1167
+	.byte	0
+	.uleb128 0x5
+	.long	0xb50
+	.quad	.LBI4223
+	.value	.LVU2465
+	.quad	.LBB4223
+	.quad	.LBE4223-.LBB4223
+	.value	0x137
+	.byte	0xc
+	.long	0x71a8
+	.uleb128 0x1
+	.long	0xb77
+	.long	.LLST1168
+	.long	.LVUS1168
+	.uleb128 0x1
+	.long	0xb6b
+	.long	.LLST1169
+	.long	.LVUS1169
+	.uleb128 0x1
+	.long	0xb5f
+	.long	.LLST1170
+	.long	.LVUS1170
+	.byte	0
+	.uleb128 0x5
+	.long	0xca7
+	.quad	.LBI4233
+	.value	.LVU2508
+	.quad	.LBB4233
+	.quad	.LBE4233-.LBB4233
+	.value	0x137
+	.byte	0x20
+	.long	0x71e9
+	.uleb128 0x1
+	.long	0xcc3
+	.long	.LLST1171
+	.long	.LVUS1171
+	.uleb128 0x1
+	.long	0xcb6
+	.long	.LLST1172
+	.long	.LVUS1172
+	.byte	0
+	.uleb128 0x5
+	.long	0xca7
+	.quad	.LBI4235
+	.value	.LVU2511
+	.quad	.LBB4235
+	.quad	.LBE4235-.LBB4235
+	.value	0x137
+	.byte	0x20
+	.long	0x7222
+	.uleb128 0x1
+	.long	0xcc3
+	.long	.LLST1173
+	.long	.LVUS1173
+	.uleb128 0x3
+	.long	0xcb6
+	.byte	0
+	.uleb128 0x2
+	.long	0xbd5
+	.quad	.LBI4237
+	.value	.LVU2517
+	.long	.LLRL1174
+	.value	0x137
+	.byte	0x51
+	.long	0x7257
+	.uleb128 0x1
+	.long	0xbf1
+	.long	.LLST1175
+	.long	.LVUS1175
+	.uleb128 0x1
+	.long	0xbe4
+	.long	.LLST1176
+	.long	.LVUS1176
+	.byte	0
+	.uleb128 0x2
+	.long	0xb84
+	.quad	.LBI4240
+	.value	.LVU2520
+	.long	.LLRL1177
+	.value	0x137
+	.byte	0x51
+	.long	0x7284
+	.uleb128 0x3
+	.long	0xb9f
+	.uleb128 0x1
+	.long	0xb93
+	.long	.LLST1178
+	.long	.LVUS1178
+	.byte	0
+	.uleb128 0x5
+	.long	0xca7
+	.quad	.LBI4245
+	.value	.LVU2527
+	.quad	.LBB4245
+	.quad	.LBE4245-.LBB4245
+	.value	0x137
+	.byte	0x87
+	.long	0x72c5
+	.uleb128 0x1
+	.long	0xcc3
+	.long	.LLST1179
+	.long	.LVUS1179
+	.uleb128 0x1
+	.long	0xcb6
+	.long	.LLST1180
+	.long	.LVUS1180
+	.byte	0
+	.uleb128 0x2
+	.long	0xbd5
+	.quad	.LBI4247
+	.value	.LVU2532
+	.long	.LLRL1181
+	.value	0x137
+	.byte	0xa5
+	.long	0x72fa
+	.uleb128 0x1
+	.long	0xbf1
+	.long	.LLST1182
+	.long	.LVUS1182
+	.uleb128 0x1
+	.long	0xbe4
+	.long	.LLST1183
+	.long	.LVUS1183
+	.byte	0
+	.uleb128 0x2
+	.long	0xc53
+	.quad	.LBI4250
+	.value	.LVU2535
+	.long	.LLRL1184
+	.value	0x137
+	.byte	0xa5
+	.long	0x732f
+	.uleb128 0x1
+	.long	0xc6f
+	.long	.LLST1185
+	.long	.LVUS1185
+	.uleb128 0x1
+	.long	0xc62
+	.long	.LLST1186
+	.long	.LVUS1186
+	.byte	0
+	.uleb128 0x2
+	.long	0xc29
+	.quad	.LBI4256
+	.value	.LVU2544
+	.long	.LLRL1187
+	.value	0x137
+	.byte	0xa5
+	.long	0x735c
+	.uleb128 0x1
+	.long	0xc45
+	.long	.LLST1188
+	.long	.LVUS1188
+	.uleb128 0x3
+	.long	0xc38
+	.byte	0
+	.uleb128 0x5
+	.long	0xbff
+	.quad	.LBI4261
+	.value	.LVU2547
+	.quad	.LBB4261
+	.quad	.LBE4261-.LBB4261
+	.value	0x137
+	.byte	0xa5
+	.long	0x739d
+	.uleb128 0x1
+	.long	0xc1b
+	.long	.LLST1189
+	.long	.LVUS1189
+	.uleb128 0x1
+	.long	0xc0e
+	.long	.LLST1190
+	.long	.LVUS1190
+	.byte	0
+	.uleb128 0x6
+	.long	0xca7
+	.quad	.LBI4263
+	.value	.LVU2552
+	.quad	.LBB4263
+	.quad	.LBE4263-.LBB4263
+	.value	0x137
+	.value	0x110
+	.long	0x73df
+	.uleb128 0x1
+	.long	0xcc3
+	.long	.LLST1191
+	.long	.LVUS1191
+	.uleb128 0x1
+	.long	0xcb6
+	.long	.LLST1192
+	.long	.LVUS1192
+	.byte	0
+	.uleb128 0x6
+	.long	0xca7
+	.quad	.LBI4265
+	.value	.LVU2555
+	.quad	.LBB4265
+	.quad	.LBE4265-.LBB4265
+	.value	0x137
+	.value	0x110
+	.long	0x7419
+	.uleb128 0x1
+	.long	0xcc3
+	.long	.LLST1193
+	.long	.LVUS1193
+	.uleb128 0x3
+	.long	0xcb6
+	.byte	0
+	.uleb128 0x4
+	.long	0xbd5
+	.quad	.LBI4267
+	.value	.LVU2561
+	.long	.LLRL1194
+	.value	0x137
+	.value	0x141
+	.long	0x744f
+	.uleb128 0x1
+	.long	0xbf1
+	.long	.LLST1195
+	.long	.LVUS1195
+	.uleb128 0x1
+	.long	0xbe4
+	.long	.LLST1196
+	.long	.LVUS1196
+	.byte	0
+	.uleb128 0x4
+	.long	0xb84
+	.quad	.LBI4270
+	.value	.LVU2564
+	.long	.LLRL1197
+	.value	0x137
+	.value	0x141
+	.long	0x747d
+	.uleb128 0x3
+	.long	0xb9f
+	.uleb128 0x1
+	.long	0xb93
+	.long	.LLST1198
+	.long	.LVUS1198
+	.byte	0
+	.uleb128 0x6
+	.long	0xca7
+	.quad	.LBI4275
+	.value	.LVU2571
+	.quad	.LBB4275
+	.quad	.LBE4275-.LBB4275
+	.value	0x137
+	.value	0x176
+	.long	0x74bf
+	.uleb128 0x1
+	.long	0xcc3
+	.long	.LLST1199
+	.long	.LVUS1199
+	.uleb128 0x1
+	.long	0xcb6
+	.long	.LLST1200
+	.long	.LVUS1200
+	.byte	0
+	.uleb128 0x4
+	.long	0xbd5
+	.quad	.LBI4277
+	.value	.LVU2576
+	.long	.LLRL1201
+	.value	0x137
+	.value	0x194
+	.long	0x74f5
+	.uleb128 0x1
+	.long	0xbf1
+	.long	.LLST1202
+	.long	.LVUS1202
+	.uleb128 0x1
+	.long	0xbe4
+	.long	.LLST1203
+	.long	.LVUS1203
+	.byte	0
+	.uleb128 0x4
+	.long	0xc53
+	.quad	.LBI4280
+	.value	.LVU2579
+	.long	.LLRL1204
+	.value	0x137
+	.value	0x194
+	.long	0x752b
+	.uleb128 0x1
+	.long	0xc6f
+	.long	.LLST1205
+	.long	.LVUS1205
+	.uleb128 0x1
+	.long	0xc62
+	.long	.LLST1206
+	.long	.LVUS1206
+	.byte	0
+	.uleb128 0x2
+	.long	0xbac
+	.quad	.LBI4284
+	.value	.LVU2611
+	.long	.LLRL1207
+	.value	0x137
+	.byte	0xc
+	.long	0x7558
+	.uleb128 0x1
+	.long	0xbc8
+	.long	.LLST1208
+	.long	.LVUS1208
+	.uleb128 0x3
+	.long	0xbbb
+	.byte	0
+	.uleb128 0x2
+	.long	0xbac
+	.quad	.LBI4288
+	.value	.LVU2607
+	.long	.LLRL1209
+	.value	0x137
+	.byte	0xc
+	.long	0x7585
+	.uleb128 0x1
+	.long	0xbc8
+	.long	.LLST1210
+	.long	.LVUS1210
+	.uleb128 0x3
+	.long	0xbbb
+	.byte	0
+	.uleb128 0x4
+	.long	0xc29
+	.quad	.LBI4292
+	.value	.LVU2592
+	.long	.LLRL1211
+	.value	0x137
+	.value	0x194
+	.long	0x75b3
+	.uleb128 0x1
+	.long	0xc45
+	.long	.LLST1212
+	.long	.LVUS1212
+	.uleb128 0x3
+	.long	0xc38
+	.byte	0
+	.uleb128 0x4
+	.long	0xbff
+	.quad	.LBI4297
+	.value	.LVU2595
+	.long	.LLRL1213
+	.value	0x137
+	.value	0x194
+	.long	0x75e9
+	.uleb128 0x1
+	.long	0xc1b
+	.long	.LLST1214
+	.long	.LVUS1214
+	.uleb128 0x1
+	.long	0xc0e
+	.long	.LLST1215
+	.long	.LVUS1215
+	.byte	0
+	.uleb128 0x4
+	.long	0xbac
+	.quad	.LBI4300
+	.value	.LVU2600
+	.long	.LLRL1216
+	.value	0x137
+	.value	0x209
+	.long	0x761f
+	.uleb128 0x1
+	.long	0xbc8
+	.long	.LLST1217
+	.long	.LVUS1217
+	.uleb128 0x1
+	.long	0xbbb
+	.long	.LLST1218
+	.long	.LVUS1218
+	.byte	0
+	.uleb128 0x5
+	.long	0xca7
+	.quad	.LBI4307
+	.value	.LVU2616
+	.quad	.LBB4307
+	.quad	.LBE4307-.LBB4307
+	.value	0x137
+	.byte	0x13
+	.long	0x7660
+	.uleb128 0x1
+	.long	0xcc3
+	.long	.LLST1219
+	.long	.LVUS1219
+	.uleb128 0x1
+	.long	0xcb6
+	.long	.LLST1220
+	.long	.LVUS1220
+	.byte	0
+	.uleb128 0x5
+	.long	0xca7
+	.quad	.LBI4309
+	.value	.LVU2619
+	.quad	.LBB4309
+	.quad	.LBE4309-.LBB4309
+	.value	0x137
+	.byte	0x13
+	.long	0x7699
+	.uleb128 0x1
+	.long	0xcc3
+	.long	.LLST1221
+	.long	.LVUS1221
+	.uleb128 0x3
+	.long	0xcb6
+	.byte	0
+	.uleb128 0x2
+	.long	0xbd5
+	.quad	.LBI4311
+	.value	.LVU2625
+	.long	.LLRL1222
+	.value	0x137
+	.byte	0x44
+	.long	0x76ce
+	.uleb128 0x1
+	.long	0xbf1
+	.long	.LLST1223
+	.long	.LVUS1223
+	.uleb128 0x1
+	.long	0xbe4
+	.long	.LLST1224
+	.long	.LVUS1224
+	.byte	0
+	.uleb128 0x2
+	.long	0xb84
+	.quad	.LBI4314
+	.value	.LVU2628
+	.long	.LLRL1225
+	.value	0x137
+	.byte	0x44
+	.long	0x76fb
+	.uleb128 0x3
+	.long	0xb9f
+	.uleb128 0x1
+	.long	0xb93
+	.long	.LLST1226
+	.long	.LVUS1226
+	.byte	0
+	.uleb128 0x5
+	.long	0xca7
+	.quad	.LBI4319
+	.value	.LVU2635
+	.quad	.LBB4319
+	.quad	.LBE4319-.LBB4319
+	.value	0x137
+	.byte	0x7a
+	.long	0x773c
+	.uleb128 0x1
+	.long	0xcc3
+	.long	.LLST1227
+	.long	.LVUS1227
+	.uleb128 0x1
+	.long	0xcb6
+	.long	.LLST1228
+	.long	.LVUS1228
+	.byte	0
+	.uleb128 0x2
+	.long	0xbd5
+	.quad	.LBI4321
+	.value	.LVU2640
+	.long	.LLRL1229
+	.value	0x137
+	.byte	0x98
+	.long	0x7771
+	.uleb128 0x1
+	.long	0xbf1
+	.long	.LLST1230
+	.long	.LVUS1230
+	.uleb128 0x1
+	.long	0xbe4
+	.long	.LLST1231
+	.long	.LVUS1231
+	.byte	0
+	.uleb128 0x2
+	.long	0xc53
+	.quad	.LBI4324
+	.value	.LVU2643
+	.long	.LLRL1232
+	.value	0x137
+	.byte	0x98
+	.long	0x77a6
+	.uleb128 0x1
+	.long	0xc6f
+	.long	.LLST1233
+	.long	.LVUS1233
+	.uleb128 0x1
+	.long	0xc62
+	.long	.LLST1234
+	.long	.LVUS1234
+	.byte	0
+	.uleb128 0x2
+	.long	0xc29
+	.quad	.LBI4330
+	.value	.LVU2652
+	.long	.LLRL1235
+	.value	0x137
+	.byte	0x98
+	.long	0x77d3
+	.uleb128 0x1
+	.long	0xc45
+	.long	.LLST1236
+	.long	.LVUS1236
+	.uleb128 0x3
+	.long	0xc38
+	.byte	0
+	.uleb128 0x5
+	.long	0xbff
+	.quad	.LBI4335
+	.value	.LVU2655
+	.quad	.LBB4335
+	.quad	.LBE4335-.LBB4335
+	.value	0x137
+	.byte	0x98
+	.long	0x7814
+	.uleb128 0x1
+	.long	0xc1b
+	.long	.LLST1237
+	.long	.LVUS1237
+	.uleb128 0x1
+	.long	0xc0e
+	.long	.LLST1238
+	.long	.LVUS1238
+	.byte	0
+	.uleb128 0x6
+	.long	0xca7
+	.quad	.LBI4337
+	.value	.LVU2660
+	.quad	.LBB4337
+	.quad	.LBE4337-.LBB4337
+	.value	0x137
+	.value	0x103
+	.long	0x7856
+	.uleb128 0x1
+	.long	0xcc3
+	.long	.LLST1239
+	.long	.LVUS1239
+	.uleb128 0x1
+	.long	0xcb6
+	.long	.LLST1240
+	.long	.LVUS1240
+	.byte	0
+	.uleb128 0x6
+	.long	0xca7
+	.quad	.LBI4339
+	.value	.LVU2663
+	.quad	.LBB4339
+	.quad	.LBE4339-.LBB4339
+	.value	0x137
+	.value	0x103
+	.long	0x7890
+	.uleb128 0x1
+	.long	0xcc3
+	.long	.LLST1241
+	.long	.LVUS1241
+	.uleb128 0x3
+	.long	0xcb6
+	.byte	0
+	.uleb128 0x4
+	.long	0xbd5
+	.quad	.LBI4341
+	.value	.LVU2669
+	.long	.LLRL1242
+	.value	0x137
+	.value	0x134
+	.long	0x78c6
+	.uleb128 0x1
+	.long	0xbf1
+	.long	.LLST1243
+	.long	.LVUS1243
+	.uleb128 0x1
+	.long	0xbe4
+	.long	.LLST1244
+	.long	.LVUS1244
+	.byte	0
+	.uleb128 0x4
+	.long	0xb84
+	.quad	.LBI4344
+	.value	.LVU2672
+	.long	.LLRL1245
+	.value	0x137
+	.value	0x134
+	.long	0x78f4
+	.uleb128 0x3
+	.long	0xb9f
+	.uleb128 0x1
+	.long	0xb93
+	.long	.LLST1246
+	.long	.LVUS1246
+	.byte	0
+	.uleb128 0x6
+	.long	0xca7
+	.quad	.LBI4349
+	.value	.LVU2679
+	.quad	.LBB4349
+	.quad	.LBE4349-.LBB4349
+	.value	0x137
+	.value	0x169
+	.long	0x7936
+	.uleb128 0x1
+	.long	0xcc3
+	.long	.LLST1247
+	.long	.LVUS1247
+	.uleb128 0x1
+	.long	0xcb6
+	.long	.LLST1248
+	.long	.LVUS1248
+	.byte	0
+	.uleb128 0x4
+	.long	0xbd5
+	.quad	.LBI4351
+	.value	.LVU2684
+	.long	.LLRL1249
+	.value	0x137
+	.value	0x187
+	.long	0x796c
+	.uleb128 0x1
+	.long	0xbf1
+	.long	.LLST1250
+	.long	.LVUS1250
+	.uleb128 0x1
+	.long	0xbe4
+	.long	.LLST1251
+	.long	.LVUS1251
+	.byte	0
+	.uleb128 0x4
+	.long	0xc53
+	.quad	.LBI4354
+	.value	.LVU2687
+	.long	.LLRL1252
+	.value	0x137
+	.value	0x187
+	.long	0x79a2
+	.uleb128 0x1
+	.long	0xc6f
+	.long	.LLST1253
+	.long	.LVUS1253
+	.uleb128 0x1
+	.long	0xc62
+	.long	.LLST1254
+	.long	.LVUS1254
+	.byte	0
+	.uleb128 0x2
+	.long	0xbac
+	.quad	.LBI4358
+	.value	.LVU2720
+	.long	.LLRL1255
+	.value	0x137
+	.byte	0xc
+	.long	0x79cf
+	.uleb128 0x1
+	.long	0xbc8
+	.long	.LLST1256
+	.long	.LVUS1256
+	.uleb128 0x3
+	.long	0xbbb
+	.byte	0
+	.uleb128 0x2
+	.long	0xbac
+	.quad	.LBI4362
+	.value	.LVU2716
+	.long	.LLRL1257
+	.value	0x137
+	.byte	0xc
+	.long	0x79fc
+	.uleb128 0x1
+	.long	0xbc8
+	.long	.LLST1258
+	.long	.LVUS1258
+	.uleb128 0x3
+	.long	0xbbb
+	.byte	0
+	.uleb128 0x4
+	.long	0xc29
+	.quad	.LBI4366
+	.value	.LVU2700
+	.long	.LLRL1259
+	.value	0x137
+	.value	0x187
+	.long	0x7a2a
+	.uleb128 0x1
+	.long	0xc45
+	.long	.LLST1260
+	.long	.LVUS1260
+	.uleb128 0x3
+	.long	0xc38
+	.byte	0
+	.uleb128 0x4
+	.long	0xbff
+	.quad	.LBI4371
+	.value	.LVU2703
+	.long	.LLRL1261
+	.value	0x137
+	.value	0x187
+	.long	0x7a60
+	.uleb128 0x1
+	.long	0xc1b
+	.long	.LLST1262
+	.long	.LVUS1262
+	.uleb128 0x1
+	.long	0xc0e
+	.long	.LLST1263
+	.long	.LVUS1263
+	.byte	0
+	.uleb128 0x4
+	.long	0xbac
+	.quad	.LBI4374
+	.value	.LVU2708
+	.long	.LLRL1264
+	.value	0x137
+	.value	0x1fc
+	.long	0x7a96
+	.uleb128 0x1
+	.long	0xbc8
+	.long	.LLST1265
+	.long	.LVUS1265
+	.uleb128 0x1
+	.long	0xbbb
+	.long	.LLST1266
+	.long	.LVUS1266
+	.byte	0
+	.uleb128 0x2
+	.long	0xb50
+	.quad	.LBI4378
+	.value	.LVU2727
+	.long	.LLRL1267
+	.value	0x138
+	.byte	0x14
+	.long	0x7ad8
+	.uleb128 0x1
+	.long	0xb77
+	.long	.LLST1268
+	.long	.LVUS1268
+	.uleb128 0x1
+	.long	0xb6b
+	.long	.LLST1269
+	.long	.LVUS1269
+	.uleb128 0x1
+	.long	0xb5f
+	.long	.LLST1270
+	.long	.LVUS1270
+	.byte	0
+	.uleb128 0x2
+	.long	0xb50
+	.quad	.LBI4385
+	.value	.LVU2731
+	.long	.LLRL1271
+	.value	0x138
+	.byte	0x38
+	.long	0x7b1a
+	.uleb128 0x1
+	.long	0xb77
+	.long	.LLST1272
+	.long	.LVUS1272
+	.uleb128 0x1
+	.long	0xb6b
+	.long	.LLST1273
+	.long	.LVUS1273
+	.uleb128 0x1
+	.long	0xb5f
+	.long	.LLST1274
+	.long	.LVUS1274
+	.byte	0
+	.uleb128 0x2
+	.long	0xbac
+	.quad	.LBI4388
+	.value	.LVU2748
+	.long	.LLRL1275
+	.value	0x138
+	.byte	0xb
+	.long	0x7b47
+	.uleb128 0x1
+	.long	0xbc8
+	.long	.LLST1276
+	.long	.LVUS1276
+	.uleb128 0x3
+	.long	0xbbb
+	.byte	0
+	.uleb128 0x2
+	.long	0xbac
+	.quad	.LBI4392
+	.value	.LVU2738
+	.long	.LLRL1277
+	.value	0x138
+	.byte	0x5c
+	.long	0x7b7c
+	.uleb128 0x1
+	.long	0xbc8
+	.long	.LLST1278
+	.long	.LVUS1278
+	.uleb128 0x1
+	.long	0xbbb
+	.long	.LLST1279
+	.long	.LVUS1279
+	.byte	0
+	.uleb128 0x2
+	.long	0xbac
+	.quad	.LBI4395
+	.value	.LVU2744
+	.long	.LLRL1280
+	.value	0x138
+	.byte	0xc
+	.long	0x7ba9
+	.uleb128 0x1
+	.long	0xbc8
+	.long	.LLST1281
+	.long	.LVUS1281
+	.uleb128 0x3
+	.long	0xbbb
+	.byte	0
+	.uleb128 0x5
+	.long	0xb50
+	.quad	.LBI4401
+	.value	.LVU2752
+	.quad	.LBB4401
+	.quad	.LBE4401-.LBB4401
+	.value	0x138
+	.byte	0xc
+	.long	0x7bf7
+	.uleb128 0x1
+	.long	0xb77
+	.long	.LLST1282
+	.long	.LVUS1282
+	.uleb128 0x1
+	.long	0xb6b
+	.long	.LLST1283
+	.long	.LVUS1283
+	.uleb128 0x1
+	.long	0xb5f
+	.long	.LLST1284
+	.long	.LVUS1284
+	.byte	0
+	.uleb128 0x5
+	.long	0xbac
+	.quad	.LBI4403
+	.value	.LVU2757
+	.quad	.LBB4403
+	.quad	.LBE4403-.LBB4403
+	.value	0x138
+	.byte	0x2f
+	.long	0x7c38
+	.uleb128 0x1
+	.long	0xbc8
+	.long	.LLST1285
+	.long	.LVUS1285
+	.uleb128 0x1
+	.long	0xbbb
+	.long	.LLST1286
+	.long	.LVUS1286
+	.byte	0
+	.uleb128 0x2
+	.long	0xb50
+	.quad	.LBI4405
+	.value	.LVU2763
+	.long	.LLRL1287
+	.value	0x138
+	.byte	0x14
+	.long	0x7c7a
+	.uleb128 0x1
+	.long	0xb77
+	.long	.LLST1288
+	.long	.LVUS1288
+	.uleb128 0x1
+	.long	0xb6b
+	.long	.LLST1289
+	.long	.LVUS1289
+	.uleb128 0x1
+	.long	0xb5f
+	.long	.LLST1290
+	.long	.LVUS1290
+	.byte	0
+	.uleb128 0x2
+	.long	0xca7
+	.quad	.LBI4408
+	.value	.LVU2805
+	.long	.LLRL1291
+	.value	0x138
+	.byte	0x43
+	.long	0x7c9f
+	.uleb128 0x3
+	.long	0xcc3
+	.uleb128 0x3
+	.long	0xcb6
+	.byte	0
+	.uleb128 0x2
+	.long	0xb50
+	.quad	.LBI4413
+	.value	.LVU2771
+	.long	.LLRL1292
+	.value	0x138
+	.byte	0xc
+	.long	0x7ce1
+	.uleb128 0x1
+	.long	0xb77
+	.long	.LLST1293
+	.long	.LVUS1293
+	.uleb128 0x1
+	.long	0xb6b
+	.long	.LLST1294
+	.long	.LVUS1294
+	.uleb128 0x1
+	.long	0xb5f
+	.long	.LLST1295
+	.long	.LVUS1295
+	.byte	0
+	.uleb128 0x2
+	.long	0xbac
+	.quad	.LBI4416
+	.value	.LVU2782
+	.long	.LLRL1296
+	.value	0x138
+	.byte	0xb
+	.long	0x7d0e
+	.uleb128 0x1
+	.long	0xbc8
+	.long	.LLST1297
+	.long	.LVUS1297
+	.uleb128 0x3
+	.long	0xbbb
+	.byte	0
+	.uleb128 0x2
+	.long	0xb50
+	.quad	.LBI4419
+	.value	.LVU2786
+	.long	.LLRL1298
+	.value	0x138
+	.byte	0xc
+	.long	0x7d48
+	.uleb128 0x1
+	.long	0xb77
+	.long	.LLST1299
+	.long	.LVUS1299
+	.uleb128 0x1
+	.long	0xb6b
+	.long	.LLST1300
+	.long	.LVUS1300
+	.uleb128 0x3
+	.long	0xb5f
+	.byte	0
+	.uleb128 0x2
+	.long	0xbd5
+	.quad	.LBI4427
+	.value	.LVU2809
+	.long	.LLRL1301
+	.value	0x138
+	.byte	0x74
+	.long	0x7d75
+	.uleb128 0x1
+	.long	0xbf1
+	.long	.LLST1302
+	.long	.LVUS1302
+	.uleb128 0x3
+	.long	0xbe4
+	.byte	0
+	.uleb128 0x2
+	.long	0xb50
+	.quad	.LBI4431
+	.value	.LVU2794
+	.long	.LLRL1303
+	.value	0x138
+	.byte	0xc
+	.long	0x7db7
+	.uleb128 0x1
+	.long	0xb77
+	.long	.LLST1304
+	.long	.LVUS1304
+	.uleb128 0x1
+	.long	0xb6b
+	.long	.LLST1305
+	.long	.LVUS1305
+	.uleb128 0x1
+	.long	0xb5f
+	.long	.LLST1306
+	.long	.LVUS1306
+	.byte	0
+	.uleb128 0x2
+	.long	0xb84
+	.quad	.LBI4434
+	.value	.LVU2812
+	.long	.LLRL1307
+	.value	0x138
+	.byte	0x74
+	.long	0x7ddc
+	.uleb128 0x3
+	.long	0xb9f
+	.uleb128 0x3
+	.long	0xb93
+	.byte	0
+	.uleb128 0x5
+	.long	0xca7
+	.quad	.LBI4438
+	.value	.LVU2802
+	.quad	.LBB4438
+	.quad	.LBE4438-.LBB4438
+	.value	0x138
+	.byte	0x43
+	.long	0x7e1d
+	.uleb128 0x1
+	.long	0xcc3
+	.long	.LLST1308
+	.long	.LVUS1308
+	.uleb128 0x1
+	.long	0xcb6
+	.long	.LLST1309
+	.long	.LVUS1309
+	.byte	0
+	.uleb128 0x5
+	.long	0xca7
+	.quad	.LBI4443
+	.value	.LVU2816
+	.quad	.LBB4443
+	.quad	.LBE4443-.LBB4443
+	.value	0x138
+	.byte	0xaa
+	.long	0x7e5e
+	.uleb128 0x1
+	.long	0xcc3
+	.long	.LLST1310
+	.long	.LVUS1310
+	.uleb128 0x1
+	.long	0xcb6
+	.long	.LLST1311
+	.long	.LVUS1311
+	.byte	0
+	.uleb128 0x2
+	.long	0xbd5
+	.quad	.LBI4445
+	.value	.LVU2821
+	.long	.LLRL1312
+	.value	0x138
+	.byte	0xc8
+	.long	0x7e93
+	.uleb128 0x1
+	.long	0xbf1
+	.long	.LLST1313
+	.long	.LVUS1313
+	.uleb128 0x1
+	.long	0xbe4
+	.long	.LLST1314
+	.long	.LVUS1314
+	.byte	0
+	.uleb128 0x2
+	.long	0xc53
+	.quad	.LBI4448
+	.value	.LVU2824
+	.long	.LLRL1315
+	.value	0x138
+	.byte	0xc8
+	.long	0x7ec8
+	.uleb128 0x1
+	.long	0xc6f
+	.long	.LLST1316
+	.long	.LVUS1316
+	.uleb128 0x1
+	.long	0xc62
+	.long	.LLST1317
+	.long	.LVUS1317
+	.byte	0
+	.uleb128 0x2
+	.long	0xc29
+	.quad	.LBI4454
+	.value	.LVU2833
+	.long	.LLRL1318
+	.value	0x138
+	.byte	0xc8
+	.long	0x7ef5
+	.uleb128 0x1
+	.long	0xc45
+	.long	.LLST1319
+	.long	.LVUS1319
+	.uleb128 0x3
+	.long	0xc38
+	.byte	0
+	.uleb128 0x5
+	.long	0xbff
+	.quad	.LBI4459
+	.value	.LVU2836
+	.quad	.LBB4459
+	.quad	.LBE4459-.LBB4459
+	.value	0x138
+	.byte	0xc8
+	.long	0x7f36
+	.uleb128 0x1
+	.long	0xc1b
+	.long	.LLST1320
+	.long	.LVUS1320
+	.uleb128 0x1
+	.long	0xc0e
+	.long	.LLST1321
+	.long	.LVUS1321
+	.byte	0
+	.uleb128 0x6
+	.long	0xca7
+	.quad	.LBI4461
+	.value	.LVU2841
+	.quad	.LBB4461
+	.quad	.LBE4461-.LBB4461
+	.value	0x138
+	.value	0x133
+	.long	0x7f78
+	.uleb128 0x1
+	.long	0xcc3
+	.long	.LLST1322
+	.long	.LVUS1322
+	.uleb128 0x1
+	.long	0xcb6
+	.long	.LLST1323
+	.long	.LVUS1323
+	.byte	0
+	.uleb128 0x6
+	.long	0xca7
+	.quad	.LBI4463
+	.value	.LVU2844
+	.quad	.LBB4463
+	.quad	.LBE4463-.LBB4463
+	.value	0x138
+	.value	0x133
+	.long	0x7fb2
+	.uleb128 0x1
+	.long	0xcc3
+	.long	.LLST1324
+	.long	.LVUS1324
+	.uleb128 0x3
+	.long	0xcb6
+	.byte	0
+	.uleb128 0x4
+	.long	0xbd5
+	.quad	.LBI4465
+	.value	.LVU2850
+	.long	.LLRL1325
+	.value	0x138
+	.value	0x164
+	.long	0x7fe8
+	.uleb128 0x1
+	.long	0xbf1
+	.long	.LLST1326
+	.long	.LVUS1326
+	.uleb128 0x1
+	.long	0xbe4
+	.long	.LLST1327
+	.long	.LVUS1327
+	.byte	0
+	.uleb128 0x4
+	.long	0xb84
+	.quad	.LBI4468
+	.value	.LVU2853
+	.long	.LLRL1328
+	.value	0x138
+	.value	0x164
+	.long	0x8016
+	.uleb128 0x3
+	.long	0xb9f
+	.uleb128 0x1
+	.long	0xb93
+	.long	.LLST1329
+	.long	.LVUS1329
+	.byte	0
+	.uleb128 0x6
+	.long	0xca7
+	.quad	.LBI4473
+	.value	.LVU2860
+	.quad	.LBB4473
+	.quad	.LBE4473-.LBB4473
+	.value	0x138
+	.value	0x199
+	.long	0x8058
+	.uleb128 0x1
+	.long	0xcc3
+	.long	.LLST1330
+	.long	.LVUS1330
+	.uleb128 0x1
+	.long	0xcb6
+	.long	.LLST1331
+	.long	.LVUS1331
+	.byte	0
+	.uleb128 0x4
+	.long	0xbd5
+	.quad	.LBI4475
+	.value	.LVU2865
+	.long	.LLRL1332
+	.value	0x138
+	.value	0x1b7
+	.long	0x808e
+	.uleb128 0x1
+	.long	0xbf1
+	.long	.LLST1333
+	.long	.LVUS1333
+	.uleb128 0x1
+	.long	0xbe4
+	.long	.LLST1334
+	.long	.LVUS1334
+	.byte	0
+	.uleb128 0x4
+	.long	0xc53
+	.quad	.LBI4478
+	.value	.LVU2868
+	.long	.LLRL1335
+	.value	0x138
+	.value	0x1b7
+	.long	0x80c4
+	.uleb128 0x1
+	.long	0xc6f
+	.long	.LLST1336
+	.long	.LVUS1336
+	.uleb128 0x1
+	.long	0xc62
+	.long	.LLST1337
+	.long	.LVUS1337
+	.byte	0
+	.uleb128 0x2
+	.long	0xbac
+	.quad	.LBI4482
+	.value	.LVU2900
+	.long	.LLRL1338
+	.value	0x138
+	.byte	0xc
+	.long	0x80f1
+	.uleb128 0x1
+	.long	0xbc8
+	.long	.LLST1339
+	.long	.LVUS1339
+	.uleb128 0x3
+	.long	0xbbb
+	.byte	0
+	.uleb128 0x2
+	.long	0xbac
+	.quad	.LBI4486
+	.value	.LVU2896
+	.long	.LLRL1340
+	.value	0x138
+	.byte	0xc
+	.long	0x811e
+	.uleb128 0x1
+	.long	0xbc8
+	.long	.LLST1341
+	.long	.LVUS1341
+	.uleb128 0x3
+	.long	0xbbb
+	.byte	0
+	.uleb128 0x4
+	.long	0xc29
+	.quad	.LBI4490
+	.value	.LVU2881
+	.long	.LLRL1342
+	.value	0x138
+	.value	0x1b7
+	.long	0x814c
+	.uleb128 0x1
+	.long	0xc45
+	.long	.LLST1343
+	.long	.LVUS1343
+	.uleb128 0x3
+	.long	0xc38
+	.byte	0
+	.uleb128 0x4
+	.long	0xbff
+	.quad	.LBI4495
+	.value	.LVU2884
+	.long	.LLRL1344
+	.value	0x138
+	.value	0x1b7
+	.long	0x8182
+	.uleb128 0x1
+	.long	0xc1b
+	.long	.LLST1345
+	.long	.LVUS1345
+	.uleb128 0x1
+	.long	0xc0e
+	.long	.LLST1346
+	.long	.LVUS1346
+	.byte	0
+	.uleb128 0x4
+	.long	0xbac
+	.quad	.LBI4498
+	.value	.LVU2889
+	.long	.LLRL1347
+	.value	0x138
+	.value	0x22c
+	.long	0x81b8
+	.uleb128 0x1
+	.long	0xbc8
+	.long	.LLST1348
+	.long	.LVUS1348
+	.uleb128 0x1
+	.long	0xbbb
+	.long	.LLST1349
+	.long	.LVUS1349
+	.byte	0
+	.uleb128 0x5
+	.long	0xca7
+	.quad	.LBI4505
+	.value	.LVU2905
+	.quad	.LBB4505
+	.quad	.LBE4505-.LBB4505
+	.value	0x138
+	.byte	0x13
+	.long	0x81f9
+	.uleb128 0x1
+	.long	0xcc3
+	.long	.LLST1350
+	.long	.LVUS1350
+	.uleb128 0x1
+	.long	0xcb6
+	.long	.LLST1351
+	.long	.LVUS1351
+	.byte	0
+	.uleb128 0x5
+	.long	0xca7
+	.quad	.LBI4507
+	.value	.LVU2908
+	.quad	.LBB4507
+	.quad	.LBE4507-.LBB4507
+	.value	0x138
+	.byte	0x13
+	.long	0x8232
+	.uleb128 0x1
+	.long	0xcc3
+	.long	.LLST1352
+	.long	.LVUS1352
+	.uleb128 0x3
+	.long	0xcb6
+	.byte	0
+	.uleb128 0x2
+	.long	0xbd5
+	.quad	.LBI4509
+	.value	.LVU2914
+	.long	.LLRL1353
+	.value	0x138
+	.byte	0x44
+	.long	0x8267
+	.uleb128 0x1
+	.long	0xbf1
+	.long	.LLST1354
+	.long	.LVUS1354
+	.uleb128 0x1
+	.long	0xbe4
+	.long	.LLST1355
+	.long	.LVUS1355
+	.byte	0
+	.uleb128 0x2
+	.long	0xb84
+	.quad	.LBI4512
+	.value	.LVU2917
+	.long	.LLRL1356
+	.value	0x138
+	.byte	0x44
+	.long	0x8294
+	.uleb128 0x3
+	.long	0xb9f
+	.uleb128 0x1
+	.long	0xb93
+	.long	.LLST1357
+	.long	.LVUS1357
+	.byte	0
+	.uleb128 0x5
+	.long	0xca7
+	.quad	.LBI4517
+	.value	.LVU2924
+	.quad	.LBB4517
+	.quad	.LBE4517-.LBB4517
+	.value	0x138
+	.byte	0x7a
+	.long	0x82d5
+	.uleb128 0x1
+	.long	0xcc3
+	.long	.LLST1358
+	.long	.LVUS1358
+	.uleb128 0x1
+	.long	0xcb6
+	.long	.LLST1359
+	.long	.LVUS1359
+	.byte	0
+	.uleb128 0x2
+	.long	0xbd5
+	.quad	.LBI4519
+	.value	.LVU2929
+	.long	.LLRL1360
+	.value	0x138
+	.byte	0x98
+	.long	0x830a
+	.uleb128 0x1
+	.long	0xbf1
+	.long	.LLST1361
+	.long	.LVUS1361
+	.uleb128 0x1
+	.long	0xbe4
+	.long	.LLST1362
+	.long	.LVUS1362
+	.byte	0
+	.uleb128 0x2
+	.long	0xc53
+	.quad	.LBI4522
+	.value	.LVU2932
+	.long	.LLRL1363
+	.value	0x138
+	.byte	0x98
+	.long	0x833f
+	.uleb128 0x1
+	.long	0xc6f
+	.long	.LLST1364
+	.long	.LVUS1364
+	.uleb128 0x1
+	.long	0xc62
+	.long	.LLST1365
+	.long	.LVUS1365
+	.byte	0
+	.uleb128 0x2
+	.long	0xc29
+	.quad	.LBI4528
+	.value	.LVU2941
+	.long	.LLRL1366
+	.value	0x138
+	.byte	0x98
+	.long	0x836c
+	.uleb128 0x1
+	.long	0xc45
+	.long	.LLST1367
+	.long	.LVUS1367
+	.uleb128 0x3
+	.long	0xc38
+	.byte	0
+	.uleb128 0x5
+	.long	0xbff
+	.quad	.LBI4533
+	.value	.LVU2944
+	.quad	.LBB4533
+	.quad	.LBE4533-.LBB4533
+	.value	0x138
+	.byte	0x98
+	.long	0x83ad
+	.uleb128 0x1
+	.long	0xc1b
+	.long	.LLST1368
+	.long	.LVUS1368
+	.uleb128 0x1
+	.long	0xc0e
+	.long	.LLST1369
+	.long	.LVUS1369
+	.byte	0
+	.uleb128 0x6
+	.long	0xca7
+	.quad	.LBI4535
+	.value	.LVU2949
+	.quad	.LBB4535
+	.quad	.LBE4535-.LBB4535
+	.value	0x138
+	.value	0x103
+	.long	0x83ef
+	.uleb128 0x1
+	.long	0xcc3
+	.long	.LLST1370
+	.long	.LVUS1370
+	.uleb128 0x1
+	.long	0xcb6
+	.long	.LLST1371
+	.long	.LVUS1371
+	.byte	0
+	.uleb128 0x4
+	.long	0xca7
+	.quad	.LBI4537
+	.value	.LVU2952
+	.long	.LLRL1372
+	.value	0x138
+	.value	0x103
+	.long	0x841d
+	.uleb128 0x1
+	.long	0xcc3
+	.long	.LLST1373
+	.long	.LVUS1373
+	.uleb128 0x3
+	.long	0xcb6
+	.byte	0
+	.uleb128 0x4
+	.long	0xbd5
+	.quad	.LBI4540
+	.value	.LVU2956
+	.long	.LLRL1374
+	.value	0x138
+	.value	0x134
+	.long	0x844b
+	.uleb128 0x3
+	.long	0xbf1
+	.uleb128 0x1
+	.long	0xbe4
+	.long	.LLST1375
+	.long	.LVUS1375
+	.byte	0
+	.uleb128 0x4
+	.long	0xb84
+	.quad	.LBI4544
+	.value	.LVU2961
+	.long	.LLRL1376
+	.value	0x138
+	.value	0x134
+	.long	0x8479
+	.uleb128 0x3
+	.long	0xb9f
+	.uleb128 0x1
+	.long	0xb93
+	.long	.LLST1377
+	.long	.LVUS1377
+	.byte	0
+	.uleb128 0x6
+	.long	0xca7
+	.quad	.LBI4549
+	.value	.LVU2968
+	.quad	.LBB4549
+	.quad	.LBE4549-.LBB4549
+	.value	0x138
+	.value	0x169
+	.long	0x84bb
+	.uleb128 0x1
+	.long	0xcc3
+	.long	.LLST1378
+	.long	.LVUS1378
+	.uleb128 0x1
+	.long	0xcb6
+	.long	.LLST1379
+	.long	.LVUS1379
+	.byte	0
+	.uleb128 0x4
+	.long	0xbd5
+	.quad	.LBI4551
+	.value	.LVU2973
+	.long	.LLRL1380
+	.value	0x138
+	.value	0x187
+	.long	0x84f1
+	.uleb128 0x1
+	.long	0xbf1
+	.long	.LLST1381
+	.long	.LVUS1381
+	.uleb128 0x1
+	.long	0xbe4
+	.long	.LLST1382
+	.long	.LVUS1382
+	.byte	0
+	.uleb128 0x4
+	.long	0xc53
+	.quad	.LBI4554
+	.value	.LVU2976
+	.long	.LLRL1383
+	.value	0x138
+	.value	0x187
+	.long	0x8527
+	.uleb128 0x1
+	.long	0xc6f
+	.long	.LLST1384
+	.long	.LVUS1384
+	.uleb128 0x1
+	.long	0xc62
+	.long	.LLST1385
+	.long	.LVUS1385
+	.byte	0
+	.uleb128 0x2
+	.long	0xbac
+	.quad	.LBI4558
+	.value	.LVU3011
+	.long	.LLRL1386
+	.value	0x138
+	.byte	0xc
+	.long	0x8554
+	.uleb128 0x1
+	.long	0xbc8
+	.long	.LLST1387
+	.long	.LVUS1387
+	.uleb128 0x3
+	.long	0xbbb
+	.byte	0
+	.uleb128 0x2
+	.long	0xbac
+	.quad	.LBI4562
+	.value	.LVU3007
+	.long	.LLRL1388
+	.value	0x138
+	.byte	0xc
+	.long	0x8581
+	.uleb128 0x1
+	.long	0xbc8
+	.long	.LLST1389
+	.long	.LVUS1389
+	.uleb128 0x3
+	.long	0xbbb
+	.byte	0
+	.uleb128 0x2
+	.long	0xbd5
+	.quad	.LBI4565
+	.value	.LVU3019
+	.long	.LLRL1390
+	.value	0x13a
+	.byte	0xc
+	.long	0x85a6
+	.uleb128 0x3
+	.long	0xbf1
+	.uleb128 0x3
+	.long	0xbe4
+	.byte	0
+	.uleb128 0x4
+	.long	0xc29
+	.quad	.LBI4570
+	.value	.LVU2990
+	.long	.LLRL1391
+	.value	0x138
+	.value	0x187
+	.long	0x85d4
+	.uleb128 0x1
+	.long	0xc45
+	.long	.LLST1392
+	.long	.LVUS1392
+	.uleb128 0x3
+	.long	0xc38
+	.byte	0
+	.uleb128 0x4
+	.long	0xbff
+	.quad	.LBI4575
+	.value	.LVU2993
+	.long	.LLRL1393
+	.value	0x138
+	.value	0x187
+	.long	0x860a
+	.uleb128 0x1
+	.long	0xc1b
+	.long	.LLST1394
+	.long	.LVUS1394
+	.uleb128 0x1
+	.long	0xc0e
+	.long	.LLST1395
+	.long	.LVUS1395
+	.byte	0
+	.uleb128 0x4
+	.long	0xbac
+	.quad	.LBI4578
+	.value	.LVU2998
+	.long	.LLRL1396
+	.value	0x138
+	.value	0x1fc
+	.long	0x8640
+	.uleb128 0x1
+	.long	0xbc8
+	.long	.LLST1397
+	.long	.LVUS1397
+	.uleb128 0x1
+	.long	0xbbb
+	.long	.LLST1398
+	.long	.LVUS1398
+	.byte	0
+	.uleb128 0x5
+	.long	0xbd5
+	.quad	.LBI4586
+	.value	.LVU3016
+	.quad	.LBB4586
+	.quad	.LBE4586-.LBB4586
+	.value	0x13a
+	.byte	0xc
+	.long	0x8671
+	.uleb128 0x3
+	.long	0xbf1
+	.uleb128 0x3
+	.long	0xbe4
+	.byte	0
+	.uleb128 0x2
+	.long	0xbd5
+	.quad	.LBI4589
+	.value	.LVU3023
+	.long	.LLRL1399
+	.value	0x13b
+	.byte	0xc
+	.long	0x86a6
+	.uleb128 0x1
+	.long	0xbf1
+	.long	.LLST1400
+	.long	.LVUS1400
+	.uleb128 0x1
+	.long	0xbe4
+	.long	.LLST1401
+	.long	.LVUS1401
+	.byte	0
+	.uleb128 0x20
+	.long	0xbd5
+	.quad	.LBI4592
+	.value	.LVU3026
+	.long	.LLRL1402
+	.value	0x13b
+	.byte	0xc
+	.uleb128 0x3
+	.long	0xbf1
+	.uleb128 0x1
+	.long	0xbe4
+	.long	.LLST1403
+	.long	.LVUS1403
+	.byte	0
+	.byte	0
+	.byte	0
+	.section	.debug_abbrev,"",@progbits
+.Ldebug_abbrev0:
+	.uleb128 0x1
+	.uleb128 0x5
+	.byte	0
+	.uleb128 0x31
+	.uleb128 0x13
+	.uleb128 0x2
+	.uleb128 0x17
+	.uleb128 0x2137
+	.uleb128 0x17
+	.byte	0
+	.byte	0
+	.uleb128 0x2
+	.uleb128 0x1d
+	.byte	0x1
+	.uleb128 0x31
+	.uleb128 0x13
+	.uleb128 0x52
+	.uleb128 0x1
+	.uleb128 0x2138
+	.uleb128 0x5
+	.uleb128 0x55
+	.uleb128 0x17
+	.uleb128 0x58
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x59
+	.uleb128 0x5
+	.uleb128 0x57
+	.uleb128 0xb
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x5
+	.byte	0
+	.uleb128 0x31
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x4
+	.uleb128 0x1d
+	.byte	0x1
+	.uleb128 0x31
+	.uleb128 0x13
+	.uleb128 0x52
+	.uleb128 0x1
+	.uleb128 0x2138
+	.uleb128 0x5
+	.uleb128 0x55
+	.uleb128 0x17
+	.uleb128 0x58
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x59
+	.uleb128 0x5
+	.uleb128 0x57
+	.uleb128 0x5
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x5
+	.uleb128 0x1d
+	.byte	0x1
+	.uleb128 0x31
+	.uleb128 0x13
+	.uleb128 0x52
+	.uleb128 0x1
+	.uleb128 0x2138
+	.uleb128 0x5
+	.uleb128 0x11
+	.uleb128 0x1
+	.uleb128 0x12
+	.uleb128 0x7
+	.uleb128 0x58
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x59
+	.uleb128 0x5
+	.uleb128 0x57
+	.uleb128 0xb
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x6
+	.uleb128 0x1d
+	.byte	0x1
+	.uleb128 0x31
+	.uleb128 0x13
+	.uleb128 0x52
+	.uleb128 0x1
+	.uleb128 0x2138
+	.uleb128 0x5
+	.uleb128 0x11
+	.uleb128 0x1
+	.uleb128 0x12
+	.uleb128 0x7
+	.uleb128 0x58
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x59
+	.uleb128 0x5
+	.uleb128 0x57
+	.uleb128 0x5
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x7
+	.uleb128 0x5
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x8
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x8
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x8
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x2
+	.uleb128 0x17
+	.uleb128 0x2137
+	.uleb128 0x17
+	.byte	0
+	.byte	0
+	.uleb128 0x9
+	.uleb128 0x24
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x3e
+	.uleb128 0xb
+	.uleb128 0x3
+	.uleb128 0xe
+	.byte	0
+	.byte	0
+	.uleb128 0xa
+	.uleb128 0x16
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0x21
+	.byte	0
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x2f
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0xc
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 2
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x20
+	.uleb128 0x21
+	.sleb128 3
+	.uleb128 0x34
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0xd
+	.uleb128 0x26
+	.byte	0
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0xe
+	.uleb128 0x1
+	.byte	0x1
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0xf
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x8
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x10
+	.uleb128 0x1
+	.byte	0x1
+	.uleb128 0x2107
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x11
+	.uleb128 0x21
+	.byte	0
+	.uleb128 0x2f
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x12
+	.uleb128 0xf
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0x21
+	.sleb128 8
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x13
+	.uleb128 0x5
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x8
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x14
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x31
+	.uleb128 0x13
+	.uleb128 0x2
+	.uleb128 0x17
+	.uleb128 0x2137
+	.uleb128 0x17
+	.byte	0
+	.byte	0
+	.uleb128 0x15
+	.uleb128 0xd
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x8
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 8
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x38
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x16
+	.uleb128 0xd
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 8
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 14
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x38
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x17
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x88
+	.uleb128 0x21
+	.sleb128 16
+	.uleb128 0x1c
+	.uleb128 0xa
+	.byte	0
+	.byte	0
+	.uleb128 0x18
+	.uleb128 0x5
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x8
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x2
+	.uleb128 0x17
+	.uleb128 0x2137
+	.uleb128 0x17
+	.byte	0
+	.byte	0
+	.uleb128 0x19
+	.uleb128 0x5
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 2
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x1a
+	.uleb128 0x16
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x8
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 9
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x1b
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 9
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x1c
+	.uleb128 0xa
+	.byte	0
+	.byte	0
+	.uleb128 0x1c
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 6
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x11
+	.uleb128 0x1
+	.uleb128 0x12
+	.uleb128 0x7
+	.uleb128 0x40
+	.uleb128 0x18
+	.uleb128 0x7a
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x1d
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 19
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x1e
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x8
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 13
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x2
+	.uleb128 0x18
+	.byte	0
+	.byte	0
+	.uleb128 0x1f
+	.uleb128 0x48
+	.byte	0
+	.uleb128 0x7d
+	.uleb128 0x1
+	.uleb128 0x7f
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x20
+	.uleb128 0x1d
+	.byte	0x1
+	.uleb128 0x31
+	.uleb128 0x13
+	.uleb128 0x52
+	.uleb128 0x1
+	.uleb128 0x2138
+	.uleb128 0x5
+	.uleb128 0x55
+	.uleb128 0x17
+	.uleb128 0x58
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x59
+	.uleb128 0x5
+	.uleb128 0x57
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x21
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x20
+	.uleb128 0x21
+	.sleb128 3
+	.uleb128 0x34
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x22
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x31
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x23
+	.uleb128 0x11
+	.byte	0x1
+	.uleb128 0x25
+	.uleb128 0xe
+	.uleb128 0x13
+	.uleb128 0xb
+	.uleb128 0x3
+	.uleb128 0x1f
+	.uleb128 0x1b
+	.uleb128 0x1f
+	.uleb128 0x11
+	.uleb128 0x1
+	.uleb128 0x12
+	.uleb128 0x7
+	.uleb128 0x10
+	.uleb128 0x17
+	.byte	0
+	.byte	0
+	.uleb128 0x24
+	.uleb128 0x24
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x3e
+	.uleb128 0xb
+	.uleb128 0x3
+	.uleb128 0x8
+	.byte	0
+	.byte	0
+	.uleb128 0x25
+	.uleb128 0x13
+	.byte	0x1
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x88
+	.uleb128 0xb
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x26
+	.uleb128 0x26
+	.byte	0
+	.byte	0
+	.byte	0
+	.uleb128 0x27
+	.uleb128 0x16
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x88
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x28
+	.uleb128 0x5
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x2
+	.uleb128 0x17
+	.uleb128 0x2137
+	.uleb128 0x17
+	.byte	0
+	.byte	0
+	.uleb128 0x29
+	.uleb128 0xb
+	.byte	0x1
+	.uleb128 0x55
+	.uleb128 0x17
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x2a
+	.uleb128 0x5
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x8
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x2
+	.uleb128 0x18
+	.byte	0
+	.byte	0
+	.uleb128 0x2b
+	.uleb128 0x48
+	.byte	0x1
+	.uleb128 0x7d
+	.uleb128 0x1
+	.uleb128 0x7f
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x2c
+	.uleb128 0x49
+	.byte	0
+	.uleb128 0x2
+	.uleb128 0x18
+	.uleb128 0x7e
+	.uleb128 0x18
+	.byte	0
+	.byte	0
+	.uleb128 0x2d
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x20
+	.uleb128 0xb
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x2e
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x20
+	.uleb128 0xb
+	.uleb128 0x34
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x2f
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x31
+	.uleb128 0x13
+	.uleb128 0x11
+	.uleb128 0x1
+	.uleb128 0x12
+	.uleb128 0x7
+	.uleb128 0x40
+	.uleb128 0x18
+	.uleb128 0x7a
+	.uleb128 0x19
+	.byte	0
+	.byte	0
+	.uleb128 0x30
+	.uleb128 0x5
+	.byte	0
+	.uleb128 0x31
+	.uleb128 0x13
+	.uleb128 0x2
+	.uleb128 0x18
+	.byte	0
+	.byte	0
+	.byte	0
+	.section	.debug_loclists,"",@progbits
+	.long	.Ldebug_loc3-.Ldebug_loc2
+.Ldebug_loc2:
+	.value	0x5
+	.byte	0x8
+	.byte	0
+	.long	0
+.Ldebug_loc0:
+.LVUS1423:
+	.uleb128 0
+	.uleb128 .LVU3113
+	.uleb128 .LVU3113
+	.uleb128 .LVU3230
+	.uleb128 .LVU3230
+	.uleb128 0
+.LLST1423:
+	.byte	0x4
+	.uleb128 .LVL496-.Ltext0
+	.uleb128 .LVL499-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL499-.Ltext0
+	.uleb128 .LVL523-.Ltext0
+	.uleb128 0x1
+	.byte	0x52
+	.byte	0x4
+	.uleb128 .LVL523-.Ltext0
+	.uleb128 .LFE6405-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0
+.LVUS1424:
+	.uleb128 0
+	.uleb128 .LVU3149
+	.uleb128 .LVU3149
+	.uleb128 .LVU3150
+	.uleb128 .LVU3150
+	.uleb128 .LVU3230
+	.uleb128 .LVU3230
+	.uleb128 0
+.LLST1424:
+	.byte	0x4
+	.uleb128 .LVL496-.Ltext0
+	.uleb128 .LVL505-.Ltext0
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x4
+	.uleb128 .LVL505-.Ltext0
+	.uleb128 .LVL506-.Ltext0
+	.uleb128 0x3
+	.byte	0x74
+	.sleb128 -64
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL506-.Ltext0
+	.uleb128 .LVL523-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL523-.Ltext0
+	.uleb128 .LFE6405-.Ltext0
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0
+.LVUS1425:
+	.uleb128 0
+	.uleb128 .LVU3143
+	.uleb128 .LVU3143
+	.uleb128 .LVU3147
+	.uleb128 .LVU3147
+	.uleb128 .LVU3184
+	.uleb128 .LVU3184
+	.uleb128 .LVU3186
+	.uleb128 .LVU3186
+	.uleb128 .LVU3210
+	.uleb128 .LVU3210
+	.uleb128 .LVU3226
+	.uleb128 .LVU3226
+	.uleb128 0
+.LLST1425:
+	.byte	0x4
+	.uleb128 .LVL496-.Ltext0
+	.uleb128 .LVL503-.Ltext0
+	.uleb128 0x1
+	.byte	0x51
+	.byte	0x4
+	.uleb128 .LVL503-.Ltext0
+	.uleb128 .LVL504-.Ltext0
+	.uleb128 0x3
+	.byte	0x71
+	.sleb128 -1
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL504-.Ltext0
+	.uleb128 .LVL513-.Ltext0
+	.uleb128 0x1
+	.byte	0x51
+	.byte	0x4
+	.uleb128 .LVL513-.Ltext0
+	.uleb128 .LVL514-.Ltext0
+	.uleb128 0x3
+	.byte	0x71
+	.sleb128 -1
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL514-.Ltext0
+	.uleb128 .LVL518-.Ltext0
+	.uleb128 0x1
+	.byte	0x51
+	.byte	0x4
+	.uleb128 .LVL518-.Ltext0
+	.uleb128 .LVL522-.Ltext0
+	.uleb128 0x3
+	.byte	0x71
+	.sleb128 -1
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL522-.Ltext0
+	.uleb128 .LFE6405-.Ltext0
+	.uleb128 0x1
+	.byte	0x51
+	.byte	0
+.LVUS1426:
+	.uleb128 .LVU3092
+	.uleb128 .LVU3145
+	.uleb128 .LVU3145
+	.uleb128 .LVU3149
+	.uleb128 .LVU3149
+	.uleb128 .LVU3150
+	.uleb128 .LVU3151
+	.uleb128 .LVU3156
+	.uleb128 .LVU3156
+	.uleb128 .LVU3182
+	.uleb128 .LVU3194
+	.uleb128 .LVU3198
+	.uleb128 .LVU3208
+	.uleb128 .LVU3226
+	.uleb128 .LVU3226
+	.uleb128 0
+.LLST1426:
+	.byte	0x4
+	.uleb128 .LVL496-.Ltext0
+	.uleb128 .LVL503-.Ltext0
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x4
+	.uleb128 .LVL503-.Ltext0
+	.uleb128 .LVL505-.Ltext0
+	.uleb128 0x4
+	.byte	0x74
+	.sleb128 64
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL505-.Ltext0
+	.uleb128 .LVL506-.Ltext0
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x4
+	.uleb128 .LVL507-.Ltext0
+	.uleb128 .LVL508-.Ltext0
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x4
+	.uleb128 .LVL508-.Ltext0
+	.uleb128 .LVL513-.Ltext0
+	.uleb128 0x3
+	.byte	0x74
+	.sleb128 -64
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL515-.Ltext0
+	.uleb128 .LVL516-.Ltext0
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x4
+	.uleb128 .LVL518-.Ltext0
+	.uleb128 .LVL522-.Ltext0
+	.uleb128 0x6
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x23
+	.uleb128 0x40
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL522-.Ltext0
+	.uleb128 .LFE6405-.Ltext0
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0
+.LVUS1427:
+	.uleb128 .LVU3192
+	.uleb128 .LVU3198
+	.uleb128 .LVU3226
+	.uleb128 .LVU3230
+.LLST1427:
+	.byte	0x4
+	.uleb128 .LVL515-.Ltext0
+	.uleb128 .LVL516-.Ltext0
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -128
+	.byte	0x4
+	.uleb128 .LVL522-.Ltext0
+	.uleb128 .LVL523-.Ltext0
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -128
+	.byte	0
+.LVUS1428:
+	.uleb128 .LVU3123
+	.uleb128 .LVU3150
+	.uleb128 .LVU3150
+	.uleb128 .LVU3151
+	.uleb128 .LVU3151
+	.uleb128 .LVU3157
+	.uleb128 .LVU3157
+	.uleb128 .LVU3182
+	.uleb128 .LVU3182
+	.uleb128 .LVU3230
+.LLST1428:
+	.byte	0x4
+	.uleb128 .LVL500-.Ltext0
+	.uleb128 .LVL506-.Ltext0
+	.uleb128 0x1
+	.byte	0x64
+	.byte	0x4
+	.uleb128 .LVL506-.Ltext0
+	.uleb128 .LVL507-.Ltext0
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -112
+	.byte	0x4
+	.uleb128 .LVL507-.Ltext0
+	.uleb128 .LVL509-.Ltext0
+	.uleb128 0x1
+	.byte	0x64
+	.byte	0x4
+	.uleb128 .LVL509-.Ltext0
+	.uleb128 .LVL513-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x6c
+	.byte	0x4
+	.uleb128 .LVL513-1-.Ltext0
+	.uleb128 .LVL523-.Ltext0
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -112
+	.byte	0
+.LVUS1429:
+	.uleb128 .LVU3128
+	.uleb128 .LVU3150
+	.uleb128 .LVU3150
+	.uleb128 .LVU3151
+	.uleb128 .LVU3151
+	.uleb128 .LVU3162
+	.uleb128 .LVU3162
+	.uleb128 .LVU3182
+	.uleb128 .LVU3182
+	.uleb128 .LVU3230
+.LLST1429:
+	.byte	0x4
+	.uleb128 .LVL501-.Ltext0
+	.uleb128 .LVL506-.Ltext0
+	.uleb128 0x1
+	.byte	0x65
+	.byte	0x4
+	.uleb128 .LVL506-.Ltext0
+	.uleb128 .LVL507-.Ltext0
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -96
+	.byte	0x4
+	.uleb128 .LVL507-.Ltext0
+	.uleb128 .LVL510-.Ltext0
+	.uleb128 0x1
+	.byte	0x65
+	.byte	0x4
+	.uleb128 .LVL510-.Ltext0
+	.uleb128 .LVL513-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x6b
+	.byte	0x4
+	.uleb128 .LVL513-1-.Ltext0
+	.uleb128 .LVL523-.Ltext0
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -96
+	.byte	0
+.LVUS1430:
+	.uleb128 .LVU3134
+	.uleb128 .LVU3150
+	.uleb128 .LVU3150
+	.uleb128 .LVU3151
+	.uleb128 .LVU3151
+	.uleb128 .LVU3167
+	.uleb128 .LVU3167
+	.uleb128 .LVU3182
+	.uleb128 .LVU3182
+	.uleb128 .LVU3230
+.LLST1430:
+	.byte	0x4
+	.uleb128 .LVL502-.Ltext0
+	.uleb128 .LVL506-.Ltext0
+	.uleb128 0x1
+	.byte	0x66
+	.byte	0x4
+	.uleb128 .LVL506-.Ltext0
+	.uleb128 .LVL507-.Ltext0
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -80
+	.byte	0x4
+	.uleb128 .LVL507-.Ltext0
+	.uleb128 .LVL511-.Ltext0
+	.uleb128 0x1
+	.byte	0x66
+	.byte	0x4
+	.uleb128 .LVL511-.Ltext0
+	.uleb128 .LVL513-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x6a
+	.byte	0x4
+	.uleb128 .LVL513-1-.Ltext0
+	.uleb128 .LVL523-.Ltext0
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -80
+	.byte	0
+.LVUS1431:
+	.uleb128 .LVU3140
+	.uleb128 .LVU3150
+	.uleb128 .LVU3150
+	.uleb128 .LVU3151
+	.uleb128 .LVU3151
+	.uleb128 .LVU3172
+	.uleb128 .LVU3172
+	.uleb128 .LVU3182
+	.uleb128 .LVU3182
+	.uleb128 .LVU3198
+	.uleb128 .LVU3198
+	.uleb128 .LVU3226
+	.uleb128 .LVU3226
+	.uleb128 .LVU3230
+.LLST1431:
+	.byte	0x4
+	.uleb128 .LVL503-.Ltext0
+	.uleb128 .LVL506-.Ltext0
+	.uleb128 0x1
+	.byte	0x67
+	.byte	0x4
+	.uleb128 .LVL506-.Ltext0
+	.uleb128 .LVL507-.Ltext0
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -64
+	.byte	0x4
+	.uleb128 .LVL507-.Ltext0
+	.uleb128 .LVL512-.Ltext0
+	.uleb128 0x1
+	.byte	0x67
+	.byte	0x4
+	.uleb128 .LVL512-.Ltext0
+	.uleb128 .LVL513-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x69
+	.byte	0x4
+	.uleb128 .LVL513-1-.Ltext0
+	.uleb128 .LVL516-.Ltext0
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -192
+	.byte	0x4
+	.uleb128 .LVL516-.Ltext0
+	.uleb128 .LVL522-.Ltext0
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -64
+	.byte	0x4
+	.uleb128 .LVL522-.Ltext0
+	.uleb128 .LVL523-.Ltext0
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -192
+	.byte	0
+.LVUS1445:
+	.uleb128 .LVU3144
+	.uleb128 .LVU3150
+	.uleb128 .LVU3150
+	.uleb128 .LVU3151
+	.uleb128 .LVU3151
+	.uleb128 .LVU3182
+	.uleb128 .LVU3193
+	.uleb128 .LVU3230
+.LLST1445:
+	.byte	0x4
+	.uleb128 .LVL503-.Ltext0
+	.uleb128 .LVL506-.Ltext0
+	.uleb128 0x1
+	.byte	0x64
+	.byte	0x4
+	.uleb128 .LVL506-.Ltext0
+	.uleb128 .LVL507-.Ltext0
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -112
+	.byte	0x4
+	.uleb128 .LVL507-.Ltext0
+	.uleb128 .LVL513-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x64
+	.byte	0x4
+	.uleb128 .LVL515-.Ltext0
+	.uleb128 .LVL523-.Ltext0
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -112
+	.byte	0
+.LVUS1446:
+	.uleb128 .LVU3144
+	.uleb128 .LVU3150
+	.uleb128 .LVU3150
+	.uleb128 .LVU3151
+	.uleb128 .LVU3151
+	.uleb128 .LVU3182
+	.uleb128 .LVU3193
+	.uleb128 .LVU3230
+.LLST1446:
+	.byte	0x4
+	.uleb128 .LVL503-.Ltext0
+	.uleb128 .LVL506-.Ltext0
+	.uleb128 0x1
+	.byte	0x65
+	.byte	0x4
+	.uleb128 .LVL506-.Ltext0
+	.uleb128 .LVL507-.Ltext0
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -96
+	.byte	0x4
+	.uleb128 .LVL507-.Ltext0
+	.uleb128 .LVL513-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x65
+	.byte	0x4
+	.uleb128 .LVL515-.Ltext0
+	.uleb128 .LVL523-.Ltext0
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -96
+	.byte	0
+.LVUS1447:
+	.uleb128 .LVU3144
+	.uleb128 .LVU3150
+	.uleb128 .LVU3150
+	.uleb128 .LVU3151
+	.uleb128 .LVU3151
+	.uleb128 .LVU3182
+	.uleb128 .LVU3193
+	.uleb128 .LVU3230
+.LLST1447:
+	.byte	0x4
+	.uleb128 .LVL503-.Ltext0
+	.uleb128 .LVL506-.Ltext0
+	.uleb128 0x1
+	.byte	0x66
+	.byte	0x4
+	.uleb128 .LVL506-.Ltext0
+	.uleb128 .LVL507-.Ltext0
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -80
+	.byte	0x4
+	.uleb128 .LVL507-.Ltext0
+	.uleb128 .LVL513-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x66
+	.byte	0x4
+	.uleb128 .LVL515-.Ltext0
+	.uleb128 .LVL523-.Ltext0
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -80
+	.byte	0
+.LVUS1448:
+	.uleb128 .LVU3144
+	.uleb128 .LVU3150
+	.uleb128 .LVU3150
+	.uleb128 .LVU3151
+	.uleb128 .LVU3151
+	.uleb128 .LVU3182
+	.uleb128 .LVU3193
+	.uleb128 .LVU3198
+	.uleb128 .LVU3198
+	.uleb128 .LVU3226
+	.uleb128 .LVU3226
+	.uleb128 .LVU3230
+.LLST1448:
+	.byte	0x4
+	.uleb128 .LVL503-.Ltext0
+	.uleb128 .LVL506-.Ltext0
+	.uleb128 0x1
+	.byte	0x67
+	.byte	0x4
+	.uleb128 .LVL506-.Ltext0
+	.uleb128 .LVL507-.Ltext0
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -64
+	.byte	0x4
+	.uleb128 .LVL507-.Ltext0
+	.uleb128 .LVL513-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x67
+	.byte	0x4
+	.uleb128 .LVL515-.Ltext0
+	.uleb128 .LVL516-.Ltext0
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -192
+	.byte	0x4
+	.uleb128 .LVL516-.Ltext0
+	.uleb128 .LVL522-.Ltext0
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -64
+	.byte	0x4
+	.uleb128 .LVL522-.Ltext0
+	.uleb128 .LVL523-.Ltext0
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -192
+	.byte	0
+.LVUS1452:
+	.uleb128 .LVU3153
+	.uleb128 .LVU3156
+	.uleb128 .LVU3156
+	.uleb128 .LVU3157
+.LLST1452:
+	.byte	0x4
+	.uleb128 .LVL507-.Ltext0
+	.uleb128 .LVL508-.Ltext0
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x4
+	.uleb128 .LVL508-.Ltext0
+	.uleb128 .LVL509-.Ltext0
+	.uleb128 0x3
+	.byte	0x74
+	.sleb128 -64
+	.byte	0x9f
+	.byte	0
+.LVUS1433:
+	.uleb128 .LVU3101
+	.uleb128 .LVU3103
+.LLST1433:
+	.byte	0x4
+	.uleb128 .LVL497-.Ltext0
+	.uleb128 .LVL497-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0
+.LVUS1435:
+	.uleb128 .LVU3121
+	.uleb128 .LVU3123
+.LLST1435:
+	.byte	0x4
+	.uleb128 .LVL500-.Ltext0
+	.uleb128 .LVL500-.Ltext0
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0
+.LVUS1437:
+	.uleb128 .LVU3108
+	.uleb128 .LVU3110
+.LLST1437:
+	.byte	0x4
+	.uleb128 .LVL498-.Ltext0
+	.uleb128 .LVL498-.Ltext0
+	.uleb128 0x3
+	.byte	0x75
+	.sleb128 16
+	.byte	0x9f
+	.byte	0
+.LVUS1439:
+	.uleb128 .LVU3125
+	.uleb128 .LVU3128
+.LLST1439:
+	.byte	0x4
+	.uleb128 .LVL500-.Ltext0
+	.uleb128 .LVL501-.Ltext0
+	.uleb128 0x3
+	.byte	0x74
+	.sleb128 16
+	.byte	0x9f
+	.byte	0
+.LVUS1441:
+	.uleb128 .LVU3130
+	.uleb128 .LVU3134
+.LLST1441:
+	.byte	0x4
+	.uleb128 .LVL501-.Ltext0
+	.uleb128 .LVL502-.Ltext0
+	.uleb128 0x3
+	.byte	0x74
+	.sleb128 32
+	.byte	0x9f
+	.byte	0
+.LVUS1443:
+	.uleb128 .LVU3136
+	.uleb128 .LVU3140
+.LLST1443:
+	.byte	0x4
+	.uleb128 .LVL502-.Ltext0
+	.uleb128 .LVL503-.Ltext0
+	.uleb128 0x3
+	.byte	0x74
+	.sleb128 48
+	.byte	0x9f
+	.byte	0
+.LVUS1457:
+	.uleb128 .LVU3211
+	.uleb128 .LVU3214
+.LLST1457:
+	.byte	0x4
+	.uleb128 .LVL518-.Ltext0
+	.uleb128 .LVL519-.Ltext0
+	.uleb128 0x2
+	.byte	0x75
+	.sleb128 0
+	.byte	0
+.LVUS1458:
+	.uleb128 .LVU3211
+	.uleb128 .LVU3214
+.LLST1458:
+	.byte	0x4
+	.uleb128 .LVL518-.Ltext0
+	.uleb128 .LVL519-.Ltext0
+	.uleb128 0x1
+	.byte	0x52
+	.byte	0
+.LVUS1460:
+	.uleb128 .LVU3221
+	.uleb128 .LVU3224
+.LLST1460:
+	.byte	0x4
+	.uleb128 .LVL520-.Ltext0
+	.uleb128 .LVL521-.Ltext0
+	.uleb128 0x4
+	.byte	0x72
+	.sleb128 96
+	.byte	0x9f
+	.byte	0
+.LVUS1462:
+	.uleb128 .LVU3216
+	.uleb128 .LVU3219
+.LLST1462:
+	.byte	0x4
+	.uleb128 .LVL519-.Ltext0
+	.uleb128 .LVL520-.Ltext0
+	.uleb128 0x1
+	.byte	0x65
+	.byte	0
+.LVUS1463:
+	.uleb128 .LVU3216
+	.uleb128 .LVU3219
+.LLST1463:
+	.byte	0x4
+	.uleb128 .LVL519-.Ltext0
+	.uleb128 .LVL520-.Ltext0
+	.uleb128 0x3
+	.byte	0x72
+	.sleb128 16
+	.byte	0x9f
+	.byte	0
+.LVUS1404:
+	.uleb128 0
+	.uleb128 .LVU3047
+	.uleb128 .LVU3047
+	.uleb128 0
+.LLST1404:
+	.byte	0x4
+	.uleb128 .LVL488-.Ltext0
+	.uleb128 .LVL490-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL490-.Ltext0
+	.uleb128 .LFE6404-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0
+.LVUS1405:
+	.uleb128 .LVU3035
+	.uleb128 0
+.LLST1405:
+	.byte	0x4
+	.uleb128 .LVL488-.Ltext0
+	.uleb128 .LFE6404-.Ltext0
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0
+.LVUS1406:
+	.uleb128 .LVU3049
+	.uleb128 .LVU3078
+.LLST1406:
+	.byte	0x4
+	.uleb128 .LVL491-.Ltext0
+	.uleb128 .LVL493-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x61
+	.byte	0
+.LVUS1407:
+	.uleb128 .LVU3055
+	.uleb128 .LVU3078
+.LLST1407:
+	.byte	0x4
+	.uleb128 .LVL492-.Ltext0
+	.uleb128 .LVL493-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x62
+	.byte	0
+.LVUS1408:
+	.uleb128 .LVU3058
+	.uleb128 .LVU3078
+.LLST1408:
+	.byte	0x4
+	.uleb128 .LVL492-.Ltext0
+	.uleb128 .LVL493-1-.Ltext0
+	.uleb128 0x3
+	.byte	0x70
+	.sleb128 96
+	.byte	0
+.LVUS1410:
+	.uleb128 .LVU3039
+	.uleb128 .LVU3045
+.LLST1410:
+	.byte	0x4
+	.uleb128 .LVL488-.Ltext0
+	.uleb128 .LVL489-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0
+.LVUS1411:
+	.uleb128 .LVU3056
+	.uleb128 .LVU3058
+.LLST1411:
+	.byte	0x4
+	.uleb128 .LVL492-.Ltext0
+	.uleb128 .LVL492-.Ltext0
+	.uleb128 0x4
+	.byte	0x70
+	.sleb128 96
+	.byte	0x9f
+	.byte	0
+.LVUS1412:
+	.uleb128 .LVU3061
+	.uleb128 .LVU3063
+.LLST1412:
+	.byte	0x4
+	.uleb128 .LVL492-.Ltext0
+	.uleb128 .LVL492-.Ltext0
+	.uleb128 0x3
+	.byte	0x70
+	.sleb128 96
+	.byte	0
+.LVUS1413:
+	.uleb128 .LVU3065
+	.uleb128 .LVU3067
+.LLST1413:
+	.byte	0x4
+	.uleb128 .LVL492-.Ltext0
+	.uleb128 .LVL492-.Ltext0
+	.uleb128 0x3
+	.byte	0x74
+	.sleb128 48
+	.byte	0x9f
+	.byte	0
+.LVUS1414:
+	.uleb128 .LVU3067
+	.uleb128 .LVU3070
+.LLST1414:
+	.byte	0x4
+	.uleb128 .LVL492-.Ltext0
+	.uleb128 .LVL492-.Ltext0
+	.uleb128 0x3
+	.byte	0x74
+	.sleb128 32
+	.byte	0x9f
+	.byte	0
+.LVUS1415:
+	.uleb128 .LVU3070
+	.uleb128 .LVU3073
+.LLST1415:
+	.byte	0x4
+	.uleb128 .LVL492-.Ltext0
+	.uleb128 .LVL492-.Ltext0
+	.uleb128 0x3
+	.byte	0x74
+	.sleb128 16
+	.byte	0x9f
+	.byte	0
+.LVUS1416:
+	.uleb128 .LVU3073
+	.uleb128 .LVU3076
+.LLST1416:
+	.byte	0x4
+	.uleb128 .LVL492-.Ltext0
+	.uleb128 .LVL492-.Ltext0
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0
+.LVUS1418:
+	.uleb128 .LVU3079
+	.uleb128 .LVU3082
+.LLST1418:
+	.byte	0x4
+	.uleb128 .LVL493-.Ltext0
+	.uleb128 .LVL494-.Ltext0
+	.uleb128 0x2
+	.byte	0x75
+	.sleb128 0
+	.byte	0
+.LVUS1419:
+	.uleb128 .LVU3079
+	.uleb128 .LVU3082
+.LLST1419:
+	.byte	0x4
+	.uleb128 .LVL493-.Ltext0
+	.uleb128 .LVL494-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0
+.LVUS1421:
+	.uleb128 .LVU3084
+	.uleb128 .LVU3087
+.LLST1421:
+	.byte	0x4
+	.uleb128 .LVL494-.Ltext0
+	.uleb128 .LVL495-.Ltext0
+	.uleb128 0x1
+	.byte	0x64
+	.byte	0
+.LVUS1422:
+	.uleb128 .LVU3084
+	.uleb128 .LVU3087
+.LLST1422:
+	.byte	0x4
+	.uleb128 .LVL494-.Ltext0
+	.uleb128 .LVL495-.Ltext0
+	.uleb128 0x3
+	.byte	0x70
+	.sleb128 16
+	.byte	0x9f
+	.byte	0
+.LVUS0:
+	.uleb128 0
+	.uleb128 .LVU20
+	.uleb128 .LVU124
+	.uleb128 .LVU188
+	.uleb128 .LVU188
+	.uleb128 .LVU232
+	.uleb128 .LVU232
+	.uleb128 .LVU400
+	.uleb128 .LVU400
+	.uleb128 .LVU440
+	.uleb128 .LVU440
+	.uleb128 .LVU504
+	.uleb128 .LVU504
+	.uleb128 .LVU549
+	.uleb128 .LVU549
+	.uleb128 .LVU722
+	.uleb128 .LVU722
+	.uleb128 .LVU757
+	.uleb128 .LVU757
+	.uleb128 .LVU821
+	.uleb128 .LVU821
+	.uleb128 .LVU865
+	.uleb128 .LVU865
+	.uleb128 .LVU973
+	.uleb128 .LVU1027
+	.uleb128 .LVU1065
+	.uleb128 .LVU1065
+	.uleb128 .LVU1129
+	.uleb128 .LVU1129
+	.uleb128 .LVU1173
+	.uleb128 .LVU1173
+	.uleb128 .LVU1284
+	.uleb128 .LVU1337
+	.uleb128 .LVU1374
+	.uleb128 .LVU1374
+	.uleb128 .LVU1440
+	.uleb128 .LVU1440
+	.uleb128 .LVU1488
+	.uleb128 .LVU1488
+	.uleb128 .LVU1640
+	.uleb128 .LVU1640
+	.uleb128 .LVU1683
+	.uleb128 .LVU1683
+	.uleb128 .LVU1748
+	.uleb128 .LVU1748
+	.uleb128 .LVU1792
+	.uleb128 .LVU1792
+	.uleb128 .LVU1930
+	.uleb128 .LVU1930
+	.uleb128 .LVU1975
+	.uleb128 .LVU1975
+	.uleb128 .LVU2040
+	.uleb128 .LVU2040
+	.uleb128 .LVU2084
+	.uleb128 .LVU2084
+	.uleb128 .LVU2228
+	.uleb128 .LVU2228
+	.uleb128 .LVU2269
+	.uleb128 .LVU2269
+	.uleb128 .LVU2343
+	.uleb128 .LVU2343
+	.uleb128 .LVU2391
+	.uleb128 .LVU2391
+	.uleb128 .LVU2515
+	.uleb128 .LVU2515
+	.uleb128 .LVU2559
+	.uleb128 .LVU2559
+	.uleb128 .LVU2623
+	.uleb128 .LVU2623
+	.uleb128 .LVU2667
+	.uleb128 .LVU2667
+	.uleb128 .LVU2807
+	.uleb128 .LVU2807
+	.uleb128 .LVU2848
+	.uleb128 .LVU2848
+	.uleb128 .LVU2912
+	.uleb128 .LVU2912
+	.uleb128 .LVU2954
+.LLST0:
+	.byte	0x4
+	.uleb128 .LVL0-.Ltext0
+	.uleb128 .LVL3-.Ltext0
+	.uleb128 0x1
+	.byte	0x61
+	.byte	0x4
+	.uleb128 .LVL16-.Ltext0
+	.uleb128 .LVL28-.Ltext0
+	.uleb128 0x1
+	.byte	0x61
+	.byte	0x4
+	.uleb128 .LVL28-.Ltext0
+	.uleb128 .LVL37-.Ltext0
+	.uleb128 0x1
+	.byte	0x68
+	.byte	0x4
+	.uleb128 .LVL37-.Ltext0
+	.uleb128 .LVL61-.Ltext0
+	.uleb128 0x2
+	.byte	0x90
+	.uleb128 0x20
+	.byte	0x4
+	.uleb128 .LVL61-.Ltext0
+	.uleb128 .LVL67-.Ltext0
+	.uleb128 0x1
+	.byte	0x6a
+	.byte	0x4
+	.uleb128 .LVL67-.Ltext0
+	.uleb128 .LVL79-.Ltext0
+	.uleb128 0x1
+	.byte	0x69
+	.byte	0x4
+	.uleb128 .LVL79-.Ltext0
+	.uleb128 .LVL88-.Ltext0
+	.uleb128 0x1
+	.byte	0x68
+	.byte	0x4
+	.uleb128 .LVL88-.Ltext0
+	.uleb128 .LVL115-.Ltext0
+	.uleb128 0x1
+	.byte	0x6f
+	.byte	0x4
+	.uleb128 .LVL115-.Ltext0
+	.uleb128 .LVL119-.Ltext0
+	.uleb128 0x2
+	.byte	0x90
+	.uleb128 0x20
+	.byte	0x4
+	.uleb128 .LVL119-.Ltext0
+	.uleb128 .LVL131-.Ltext0
+	.uleb128 0x1
+	.byte	0x68
+	.byte	0x4
+	.uleb128 .LVL131-.Ltext0
+	.uleb128 .LVL140-.Ltext0
+	.uleb128 0x1
+	.byte	0x6e
+	.byte	0x4
+	.uleb128 .LVL140-.Ltext0
+	.uleb128 .LVL158-.Ltext0
+	.uleb128 0x1
+	.byte	0x6d
+	.byte	0x4
+	.uleb128 .LVL164-.Ltext0
+	.uleb128 .LVL169-.Ltext0
+	.uleb128 0x1
+	.byte	0x6f
+	.byte	0x4
+	.uleb128 .LVL169-.Ltext0
+	.uleb128 .LVL181-.Ltext0
+	.uleb128 0x1
+	.byte	0x6c
+	.byte	0x4
+	.uleb128 .LVL181-.Ltext0
+	.uleb128 .LVL190-.Ltext0
+	.uleb128 0x1
+	.byte	0x69
+	.byte	0x4
+	.uleb128 .LVL190-.Ltext0
+	.uleb128 .LVL205-.Ltext0
+	.uleb128 0x1
+	.byte	0x68
+	.byte	0x4
+	.uleb128 .LVL215-.Ltext0
+	.uleb128 .LVL220-.Ltext0
+	.uleb128 0x1
+	.byte	0x6d
+	.byte	0x4
+	.uleb128 .LVL220-.Ltext0
+	.uleb128 .LVL232-.Ltext0
+	.uleb128 0x1
+	.byte	0x6e
+	.byte	0x4
+	.uleb128 .LVL232-.Ltext0
+	.uleb128 .LVL241-.Ltext0
+	.uleb128 0x1
+	.byte	0x6b
+	.byte	0x4
+	.uleb128 .LVL241-.Ltext0
+	.uleb128 .LVL260-.Ltext0
+	.uleb128 0x1
+	.byte	0x6a
+	.byte	0x4
+	.uleb128 .LVL260-.Ltext0
+	.uleb128 .LVL268-.Ltext0
+	.uleb128 0x1
+	.byte	0x69
+	.byte	0x4
+	.uleb128 .LVL268-.Ltext0
+	.uleb128 .LVL280-.Ltext0
+	.uleb128 0x1
+	.byte	0x6c
+	.byte	0x4
+	.uleb128 .LVL280-.Ltext0
+	.uleb128 .LVL289-.Ltext0
+	.uleb128 0x1
+	.byte	0x6b
+	.byte	0x4
+	.uleb128 .LVL289-.Ltext0
+	.uleb128 .LVL306-.Ltext0
+	.uleb128 0x1
+	.byte	0x68
+	.byte	0x4
+	.uleb128 .LVL306-.Ltext0
+	.uleb128 .LVL315-.Ltext0
+	.uleb128 0x1
+	.byte	0x6f
+	.byte	0x4
+	.uleb128 .LVL315-.Ltext0
+	.uleb128 .LVL327-.Ltext0
+	.uleb128 0x1
+	.byte	0x6a
+	.byte	0x4
+	.uleb128 .LVL327-.Ltext0
+	.uleb128 .LVL336-.Ltext0
+	.uleb128 0x1
+	.byte	0x6e
+	.byte	0x4
+	.uleb128 .LVL336-.Ltext0
+	.uleb128 .LVL352-.Ltext0
+	.uleb128 0x2
+	.byte	0x90
+	.uleb128 0x20
+	.byte	0x4
+	.uleb128 .LVL352-.Ltext0
+	.uleb128 .LVL359-.Ltext0
+	.uleb128 0x1
+	.byte	0x6e
+	.byte	0x4
+	.uleb128 .LVL359-.Ltext0
+	.uleb128 .LVL372-.Ltext0
+	.uleb128 0x1
+	.byte	0x69
+	.byte	0x4
+	.uleb128 .LVL372-.Ltext0
+	.uleb128 .LVL381-.Ltext0
+	.uleb128 0x1
+	.byte	0x68
+	.byte	0x4
+	.uleb128 .LVL381-.Ltext0
+	.uleb128 .LVL394-.Ltext0
+	.uleb128 0x1
+	.byte	0x6c
+	.byte	0x4
+	.uleb128 .LVL394-.Ltext0
+	.uleb128 .LVL403-.Ltext0
+	.uleb128 0x1
+	.byte	0x6a
+	.byte	0x4
+	.uleb128 .LVL403-.Ltext0
+	.uleb128 .LVL415-.Ltext0
+	.uleb128 0x1
+	.byte	0x6d
+	.byte	0x4
+	.uleb128 .LVL415-.Ltext0
+	.uleb128 .LVL424-.Ltext0
+	.uleb128 0x1
+	.byte	0x6e
+	.byte	0x4
+	.uleb128 .LVL424-.Ltext0
+	.uleb128 .LVL448-.Ltext0
+	.uleb128 0x1
+	.byte	0x6b
+	.byte	0x4
+	.uleb128 .LVL448-.Ltext0
+	.uleb128 .LVL455-.Ltext0
+	.uleb128 0x1
+	.byte	0x6a
+	.byte	0x4
+	.uleb128 .LVL455-.Ltext0
+	.uleb128 .LVL467-.Ltext0
+	.uleb128 0x1
+	.byte	0x64
+	.byte	0x4
+	.uleb128 .LVL467-.Ltext0
+	.uleb128 .LVL474-.Ltext0
+	.uleb128 0x1
+	.byte	0x65
+	.byte	0
+.LVUS1:
+	.uleb128 0
+	.uleb128 .LVU104
+	.uleb128 .LVU116
+	.uleb128 .LVU148
+	.uleb128 .LVU168
+	.uleb128 .LVU170
+	.uleb128 .LVU170
+	.uleb128 .LVU211
+	.uleb128 .LVU223
+	.uleb128 .LVU260
+	.uleb128 .LVU283
+	.uleb128 .LVU286
+	.uleb128 .LVU286
+	.uleb128 .LVU419
+	.uleb128 .LVU431
+	.uleb128 .LVU465
+	.uleb128 .LVU484
+	.uleb128 .LVU527
+	.uleb128 .LVU539
+	.uleb128 .LVU575
+	.uleb128 .LVU594
+	.uleb128 .LVU697
+	.uleb128 .LVU748
+	.uleb128 .LVU782
+	.uleb128 .LVU801
+	.uleb128 .LVU844
+	.uleb128 .LVU856
+	.uleb128 .LVU890
+	.uleb128 .LVU909
+	.uleb128 .LVU992
+	.uleb128 .LVU1055
+	.uleb128 .LVU1090
+	.uleb128 .LVU1109
+	.uleb128 .LVU1152
+	.uleb128 .LVU1164
+	.uleb128 .LVU1199
+	.uleb128 .LVU1218
+	.uleb128 .LVU1314
+	.uleb128 .LVU1365
+	.uleb128 .LVU1401
+	.uleb128 .LVU1420
+	.uleb128 .LVU1464
+	.uleb128 .LVU1476
+	.uleb128 .LVU1516
+	.uleb128 .LVU1535
+	.uleb128 .LVU1662
+	.uleb128 .LVU1674
+	.uleb128 .LVU1709
+	.uleb128 .LVU1728
+	.uleb128 .LVU1771
+	.uleb128 .LVU1783
+	.uleb128 .LVU1818
+	.uleb128 .LVU1837
+	.uleb128 .LVU1954
+	.uleb128 .LVU1966
+	.uleb128 .LVU2001
+	.uleb128 .LVU2020
+	.uleb128 .LVU2063
+	.uleb128 .LVU2075
+	.uleb128 .LVU2114
+	.uleb128 .LVU2133
+	.uleb128 .LVU2248
+	.uleb128 .LVU2260
+	.uleb128 .LVU2299
+	.uleb128 .LVU2318
+	.uleb128 .LVU2367
+	.uleb128 .LVU2379
+	.uleb128 .LVU2416
+	.uleb128 .LVU2435
+	.uleb128 .LVU2538
+	.uleb128 .LVU2550
+	.uleb128 .LVU2584
+	.uleb128 .LVU2603
+	.uleb128 .LVU2646
+	.uleb128 .LVU2658
+	.uleb128 .LVU2692
+	.uleb128 .LVU2711
+	.uleb128 .LVU2827
+	.uleb128 .LVU2839
+	.uleb128 .LVU2873
+	.uleb128 .LVU2892
+	.uleb128 .LVU2935
+	.uleb128 .LVU2947
+	.uleb128 .LVU2981
+	.uleb128 .LVU3002
+	.uleb128 .LVU3030
+.LLST1:
+	.byte	0x4
+	.uleb128 .LVL0-.Ltext0
+	.uleb128 .LVL12-.Ltext0
+	.uleb128 0x1
+	.byte	0x62
+	.byte	0x4
+	.uleb128 .LVL15-.Ltext0
+	.uleb128 .LVL20-.Ltext0
+	.uleb128 0x1
+	.byte	0x62
+	.byte	0x4
+	.uleb128 .LVL25-.Ltext0
+	.uleb128 .LVL26-.Ltext0
+	.uleb128 0x1
+	.byte	0x62
+	.byte	0x4
+	.uleb128 .LVL26-.Ltext0
+	.uleb128 .LVL32-.Ltext0
+	.uleb128 0x1
+	.byte	0x6a
+	.byte	0x4
+	.uleb128 .LVL35-.Ltext0
+	.uleb128 .LVL42-.Ltext0
+	.uleb128 0x1
+	.byte	0x6a
+	.byte	0x4
+	.uleb128 .LVL46-.Ltext0
+	.uleb128 .LVL47-.Ltext0
+	.uleb128 0x1
+	.byte	0x6a
+	.byte	0x4
+	.uleb128 .LVL47-.Ltext0
+	.uleb128 .LVL62-.Ltext0
+	.uleb128 0x1
+	.byte	0x61
+	.byte	0x4
+	.uleb128 .LVL65-.Ltext0
+	.uleb128 .LVL72-.Ltext0
+	.uleb128 0x1
+	.byte	0x61
+	.byte	0x4
+	.uleb128 .LVL76-.Ltext0
+	.uleb128 .LVL83-.Ltext0
+	.uleb128 0x1
+	.byte	0x61
+	.byte	0x4
+	.uleb128 .LVL86-.Ltext0
+	.uleb128 .LVL93-.Ltext0
+	.uleb128 0x1
+	.byte	0x61
+	.byte	0x4
+	.uleb128 .LVL97-.Ltext0
+	.uleb128 .LVL111-.Ltext0
+	.uleb128 0x1
+	.byte	0x61
+	.byte	0x4
+	.uleb128 .LVL117-.Ltext0
+	.uleb128 .LVL124-.Ltext0
+	.uleb128 0x1
+	.byte	0x61
+	.byte	0x4
+	.uleb128 .LVL128-.Ltext0
+	.uleb128 .LVL135-.Ltext0
+	.uleb128 0x1
+	.byte	0x61
+	.byte	0x4
+	.uleb128 .LVL138-.Ltext0
+	.uleb128 .LVL145-.Ltext0
+	.uleb128 0x1
+	.byte	0x61
+	.byte	0x4
+	.uleb128 .LVL149-.Ltext0
+	.uleb128 .LVL163-.Ltext0
+	.uleb128 0x1
+	.byte	0x61
+	.byte	0x4
+	.uleb128 .LVL167-.Ltext0
+	.uleb128 .LVL174-.Ltext0
+	.uleb128 0x1
+	.byte	0x61
+	.byte	0x4
+	.uleb128 .LVL178-.Ltext0
+	.uleb128 .LVL185-.Ltext0
+	.uleb128 0x1
+	.byte	0x61
+	.byte	0x4
+	.uleb128 .LVL188-.Ltext0
+	.uleb128 .LVL195-.Ltext0
+	.uleb128 0x1
+	.byte	0x61
+	.byte	0x4
+	.uleb128 .LVL199-.Ltext0
+	.uleb128 .LVL212-.Ltext0
+	.uleb128 0x1
+	.byte	0x61
+	.byte	0x4
+	.uleb128 .LVL218-.Ltext0
+	.uleb128 .LVL225-.Ltext0
+	.uleb128 0x1
+	.byte	0x61
+	.byte	0x4
+	.uleb128 .LVL229-.Ltext0
+	.uleb128 .LVL236-.Ltext0
+	.uleb128 0x1
+	.byte	0x61
+	.byte	0x4
+	.uleb128 .LVL239-.Ltext0
+	.uleb128 .LVL246-.Ltext0
+	.uleb128 0x1
+	.byte	0x61
+	.byte	0x4
+	.uleb128 .LVL250-.Ltext0
+	.uleb128 .LVL263-.Ltext0
+	.uleb128 0x1
+	.byte	0x61
+	.byte	0x4
+	.uleb128 .LVL266-.Ltext0
+	.uleb128 .LVL273-.Ltext0
+	.uleb128 0x1
+	.byte	0x61
+	.byte	0x4
+	.uleb128 .LVL277-.Ltext0
+	.uleb128 .LVL284-.Ltext0
+	.uleb128 0x1
+	.byte	0x61
+	.byte	0x4
+	.uleb128 .LVL287-.Ltext0
+	.uleb128 .LVL294-.Ltext0
+	.uleb128 0x1
+	.byte	0x61
+	.byte	0x4
+	.uleb128 .LVL298-.Ltext0
+	.uleb128 .LVL310-.Ltext0
+	.uleb128 0x1
+	.byte	0x61
+	.byte	0x4
+	.uleb128 .LVL313-.Ltext0
+	.uleb128 .LVL320-.Ltext0
+	.uleb128 0x1
+	.byte	0x61
+	.byte	0x4
+	.uleb128 .LVL324-.Ltext0
+	.uleb128 .LVL331-.Ltext0
+	.uleb128 0x1
+	.byte	0x61
+	.byte	0x4
+	.uleb128 .LVL334-.Ltext0
+	.uleb128 .LVL341-.Ltext0
+	.uleb128 0x1
+	.byte	0x61
+	.byte	0x4
+	.uleb128 .LVL345-.Ltext0
+	.uleb128 .LVL354-.Ltext0
+	.uleb128 0x1
+	.byte	0x61
+	.byte	0x4
+	.uleb128 .LVL357-.Ltext0
+	.uleb128 .LVL365-.Ltext0
+	.uleb128 0x1
+	.byte	0x61
+	.byte	0x4
+	.uleb128 .LVL369-.Ltext0
+	.uleb128 .LVL376-.Ltext0
+	.uleb128 0x1
+	.byte	0x61
+	.byte	0x4
+	.uleb128 .LVL379-.Ltext0
+	.uleb128 .LVL386-.Ltext0
+	.uleb128 0x1
+	.byte	0x61
+	.byte	0x4
+	.uleb128 .LVL390-.Ltext0
+	.uleb128 .LVL398-.Ltext0
+	.uleb128 0x1
+	.byte	0x61
+	.byte	0x4
+	.uleb128 .LVL401-.Ltext0
+	.uleb128 .LVL408-.Ltext0
+	.uleb128 0x1
+	.byte	0x61
+	.byte	0x4
+	.uleb128 .LVL412-.Ltext0
+	.uleb128 .LVL419-.Ltext0
+	.uleb128 0x1
+	.byte	0x61
+	.byte	0x4
+	.uleb128 .LVL422-.Ltext0
+	.uleb128 .LVL429-.Ltext0
+	.uleb128 0x1
+	.byte	0x61
+	.byte	0x4
+	.uleb128 .LVL433-.Ltext0
+	.uleb128 .LVL450-.Ltext0
+	.uleb128 0x1
+	.byte	0x61
+	.byte	0x4
+	.uleb128 .LVL453-.Ltext0
+	.uleb128 .LVL460-.Ltext0
+	.uleb128 0x1
+	.byte	0x61
+	.byte	0x4
+	.uleb128 .LVL464-.Ltext0
+	.uleb128 .LVL471-.Ltext0
+	.uleb128 0x1
+	.byte	0x61
+	.byte	0x4
+	.uleb128 .LVL474-.Ltext0
+	.uleb128 .LVL481-.Ltext0
+	.uleb128 0x1
+	.byte	0x61
+	.byte	0x4
+	.uleb128 .LVL485-.Ltext0
+	.uleb128 .LVL487-.Ltext0
+	.uleb128 0x1
+	.byte	0x61
+	.byte	0
+.LVUS2:
+	.uleb128 0
+	.uleb128 .LVU57
+	.uleb128 .LVU92
+	.uleb128 .LVU132
+	.uleb128 .LVU134
+	.uleb128 .LVU178
+	.uleb128 .LVU178
+	.uleb128 .LVU196
+	.uleb128 .LVU198
+	.uleb128 .LVU241
+	.uleb128 .LVU245
+	.uleb128 .LVU258
+	.uleb128 .LVU294
+	.uleb128 .LVU368
+	.uleb128 .LVU407
+	.uleb128 .LVU448
+	.uleb128 .LVU450
+	.uleb128 .LVU463
+	.uleb128 .LVU494
+	.uleb128 .LVU512
+	.uleb128 .LVU514
+	.uleb128 .LVU558
+	.uleb128 .LVU560
+	.uleb128 .LVU573
+	.uleb128 .LVU606
+	.uleb128 .LVU669
+	.uleb128 .LVU729
+	.uleb128 .LVU765
+	.uleb128 .LVU767
+	.uleb128 .LVU780
+	.uleb128 .LVU811
+	.uleb128 .LVU829
+	.uleb128 .LVU831
+	.uleb128 .LVU873
+	.uleb128 .LVU875
+	.uleb128 .LVU888
+	.uleb128 .LVU920
+	.uleb128 .LVU980
+	.uleb128 .LVU1034
+	.uleb128 .LVU1073
+	.uleb128 .LVU1075
+	.uleb128 .LVU1088
+	.uleb128 .LVU1119
+	.uleb128 .LVU1137
+	.uleb128 .LVU1139
+	.uleb128 .LVU1182
+	.uleb128 .LVU1184
+	.uleb128 .LVU1197
+	.uleb128 .LVU1229
+	.uleb128 .LVU1286
+	.uleb128 .LVU1344
+	.uleb128 .LVU1382
+	.uleb128 .LVU1384
+	.uleb128 .LVU1398
+	.uleb128 .LVU1430
+	.uleb128 .LVU1449
+	.uleb128 .LVU1451
+	.uleb128 .LVU1497
+	.uleb128 .LVU1501
+	.uleb128 .LVU1514
+	.uleb128 .LVU1547
+	.uleb128 .LVU1619
+	.uleb128 .LVU1647
+	.uleb128 .LVU1692
+	.uleb128 .LVU1694
+	.uleb128 .LVU1707
+	.uleb128 .LVU1738
+	.uleb128 .LVU1756
+	.uleb128 .LVU1758
+	.uleb128 .LVU1801
+	.uleb128 .LVU1803
+	.uleb128 .LVU1816
+	.uleb128 .LVU1848
+	.uleb128 .LVU1938
+	.uleb128 .LVU1941
+	.uleb128 .LVU1984
+	.uleb128 .LVU1986
+	.uleb128 .LVU1999
+	.uleb128 .LVU2030
+	.uleb128 .LVU2048
+	.uleb128 .LVU2050
+	.uleb128 .LVU2093
+	.uleb128 .LVU2097
+	.uleb128 .LVU2111
+	.uleb128 .LVU2144
+	.uleb128 .LVU2199
+	.uleb128 .LVU2235
+	.uleb128 .LVU2278
+	.uleb128 .LVU2281
+	.uleb128 .LVU2296
+	.uleb128 .LVU2329
+	.uleb128 .LVU2352
+	.uleb128 .LVU2354
+	.uleb128 .LVU2399
+	.uleb128 .LVU2401
+	.uleb128 .LVU2414
+	.uleb128 .LVU2445
+	.uleb128 .LVU2523
+	.uleb128 .LVU2525
+	.uleb128 .LVU2567
+	.uleb128 .LVU2569
+	.uleb128 .LVU2582
+	.uleb128 .LVU2613
+	.uleb128 .LVU2631
+	.uleb128 .LVU2633
+	.uleb128 .LVU2675
+	.uleb128 .LVU2677
+	.uleb128 .LVU2690
+	.uleb128 .LVU2722
+	.uleb128 .LVU2789
+	.uleb128 .LVU2814
+	.uleb128 .LVU2856
+	.uleb128 .LVU2858
+	.uleb128 .LVU2871
+	.uleb128 .LVU2902
+	.uleb128 .LVU2920
+	.uleb128 .LVU2922
+	.uleb128 .LVU2964
+	.uleb128 .LVU2966
+	.uleb128 .LVU2979
+	.uleb128 .LVU3013
+	.uleb128 0
+.LLST2:
+	.byte	0x4
+	.uleb128 .LVL0-.Ltext0
+	.uleb128 .LVL8-.Ltext0
+	.uleb128 0x1
+	.byte	0x63
+	.byte	0x4
+	.uleb128 .LVL11-.Ltext0
+	.uleb128 .LVL17-.Ltext0
+	.uleb128 0x1
+	.byte	0x63
+	.byte	0x4
+	.uleb128 .LVL18-.Ltext0
+	.uleb128 .LVL26-.Ltext0
+	.uleb128 0x1
+	.byte	0x63
+	.byte	0x4
+	.uleb128 .LVL26-.Ltext0
+	.uleb128 .LVL29-.Ltext0
+	.uleb128 0x1
+	.byte	0x6f
+	.byte	0x4
+	.uleb128 .LVL30-.Ltext0
+	.uleb128 .LVL38-.Ltext0
+	.uleb128 0x1
+	.byte	0x6f
+	.byte	0x4
+	.uleb128 .LVL39-.Ltext0
+	.uleb128 .LVL41-.Ltext0
+	.uleb128 0x1
+	.byte	0x6f
+	.byte	0x4
+	.uleb128 .LVL47-.Ltext0
+	.uleb128 .LVL56-.Ltext0
+	.uleb128 0x1
+	.byte	0x62
+	.byte	0x4
+	.uleb128 .LVL61-.Ltext0
+	.uleb128 .LVL68-.Ltext0
+	.uleb128 0x1
+	.byte	0x62
+	.byte	0x4
+	.uleb128 .LVL69-.Ltext0
+	.uleb128 .LVL71-.Ltext0
+	.uleb128 0x1
+	.byte	0x62
+	.byte	0x4
+	.uleb128 .LVL77-.Ltext0
+	.uleb128 .LVL80-.Ltext0
+	.uleb128 0x1
+	.byte	0x62
+	.byte	0x4
+	.uleb128 .LVL81-.Ltext0
+	.uleb128 .LVL89-.Ltext0
+	.uleb128 0x1
+	.byte	0x62
+	.byte	0x4
+	.uleb128 .LVL90-.Ltext0
+	.uleb128 .LVL92-.Ltext0
+	.uleb128 0x1
+	.byte	0x62
+	.byte	0x4
+	.uleb128 .LVL98-.Ltext0
+	.uleb128 .LVL106-.Ltext0
+	.uleb128 0x1
+	.byte	0x62
+	.byte	0x4
+	.uleb128 .LVL115-.Ltext0
+	.uleb128 .LVL120-.Ltext0
+	.uleb128 0x1
+	.byte	0x62
+	.byte	0x4
+	.uleb128 .LVL121-.Ltext0
+	.uleb128 .LVL123-.Ltext0
+	.uleb128 0x1
+	.byte	0x62
+	.byte	0x4
+	.uleb128 .LVL129-.Ltext0
+	.uleb128 .LVL132-.Ltext0
+	.uleb128 0x1
+	.byte	0x62
+	.byte	0x4
+	.uleb128 .LVL133-.Ltext0
+	.uleb128 .LVL141-.Ltext0
+	.uleb128 0x1
+	.byte	0x62
+	.byte	0x4
+	.uleb128 .LVL142-.Ltext0
+	.uleb128 .LVL144-.Ltext0
+	.uleb128 0x1
+	.byte	0x62
+	.byte	0x4
+	.uleb128 .LVL150-.Ltext0
+	.uleb128 .LVL160-.Ltext0
+	.uleb128 0x1
+	.byte	0x62
+	.byte	0x4
+	.uleb128 .LVL164-.Ltext0
+	.uleb128 .LVL170-.Ltext0
+	.uleb128 0x1
+	.byte	0x62
+	.byte	0x4
+	.uleb128 .LVL171-.Ltext0
+	.uleb128 .LVL173-.Ltext0
+	.uleb128 0x1
+	.byte	0x62
+	.byte	0x4
+	.uleb128 .LVL179-.Ltext0
+	.uleb128 .LVL182-.Ltext0
+	.uleb128 0x1
+	.byte	0x62
+	.byte	0x4
+	.uleb128 .LVL183-.Ltext0
+	.uleb128 .LVL191-.Ltext0
+	.uleb128 0x1
+	.byte	0x62
+	.byte	0x4
+	.uleb128 .LVL192-.Ltext0
+	.uleb128 .LVL194-.Ltext0
+	.uleb128 0x1
+	.byte	0x62
+	.byte	0x4
+	.uleb128 .LVL200-.Ltext0
+	.uleb128 .LVL206-.Ltext0
+	.uleb128 0x1
+	.byte	0x62
+	.byte	0x4
+	.uleb128 .LVL215-.Ltext0
+	.uleb128 .LVL221-.Ltext0
+	.uleb128 0x1
+	.byte	0x62
+	.byte	0x4
+	.uleb128 .LVL222-.Ltext0
+	.uleb128 .LVL224-.Ltext0
+	.uleb128 0x1
+	.byte	0x62
+	.byte	0x4
+	.uleb128 .LVL230-.Ltext0
+	.uleb128 .LVL233-.Ltext0
+	.uleb128 0x1
+	.byte	0x62
+	.byte	0x4
+	.uleb128 .LVL234-.Ltext0
+	.uleb128 .LVL242-.Ltext0
+	.uleb128 0x1
+	.byte	0x62
+	.byte	0x4
+	.uleb128 .LVL243-.Ltext0
+	.uleb128 .LVL245-.Ltext0
+	.uleb128 0x1
+	.byte	0x62
+	.byte	0x4
+	.uleb128 .LVL251-.Ltext0
+	.uleb128 .LVL258-.Ltext0
+	.uleb128 0x1
+	.byte	0x62
+	.byte	0x4
+	.uleb128 .LVL260-.Ltext0
+	.uleb128 .LVL269-.Ltext0
+	.uleb128 0x1
+	.byte	0x62
+	.byte	0x4
+	.uleb128 .LVL270-.Ltext0
+	.uleb128 .LVL272-.Ltext0
+	.uleb128 0x1
+	.byte	0x62
+	.byte	0x4
+	.uleb128 .LVL278-.Ltext0
+	.uleb128 .LVL281-.Ltext0
+	.uleb128 0x1
+	.byte	0x62
+	.byte	0x4
+	.uleb128 .LVL282-.Ltext0
+	.uleb128 .LVL290-.Ltext0
+	.uleb128 0x1
+	.byte	0x62
+	.byte	0x4
+	.uleb128 .LVL291-.Ltext0
+	.uleb128 .LVL293-.Ltext0
+	.uleb128 0x1
+	.byte	0x62
+	.byte	0x4
+	.uleb128 .LVL299-.Ltext0
+	.uleb128 .LVL307-.Ltext0
+	.uleb128 0x1
+	.byte	0x62
+	.byte	0x4
+	.uleb128 .LVL308-.Ltext0
+	.uleb128 .LVL316-.Ltext0
+	.uleb128 0x1
+	.byte	0x62
+	.byte	0x4
+	.uleb128 .LVL317-.Ltext0
+	.uleb128 .LVL319-.Ltext0
+	.uleb128 0x1
+	.byte	0x62
+	.byte	0x4
+	.uleb128 .LVL325-.Ltext0
+	.uleb128 .LVL328-.Ltext0
+	.uleb128 0x1
+	.byte	0x62
+	.byte	0x4
+	.uleb128 .LVL329-.Ltext0
+	.uleb128 .LVL337-.Ltext0
+	.uleb128 0x1
+	.byte	0x62
+	.byte	0x4
+	.uleb128 .LVL338-.Ltext0
+	.uleb128 .LVL340-.Ltext0
+	.uleb128 0x1
+	.byte	0x62
+	.byte	0x4
+	.uleb128 .LVL346-.Ltext0
+	.uleb128 .LVL350-.Ltext0
+	.uleb128 0x1
+	.byte	0x62
+	.byte	0x4
+	.uleb128 .LVL352-.Ltext0
+	.uleb128 .LVL360-.Ltext0
+	.uleb128 0x1
+	.byte	0x62
+	.byte	0x4
+	.uleb128 .LVL361-.Ltext0
+	.uleb128 .LVL364-.Ltext0
+	.uleb128 0x1
+	.byte	0x62
+	.byte	0x4
+	.uleb128 .LVL370-.Ltext0
+	.uleb128 .LVL373-.Ltext0
+	.uleb128 0x1
+	.byte	0x62
+	.byte	0x4
+	.uleb128 .LVL374-.Ltext0
+	.uleb128 .LVL382-.Ltext0
+	.uleb128 0x1
+	.byte	0x62
+	.byte	0x4
+	.uleb128 .LVL383-.Ltext0
+	.uleb128 .LVL385-.Ltext0
+	.uleb128 0x1
+	.byte	0x62
+	.byte	0x4
+	.uleb128 .LVL391-.Ltext0
+	.uleb128 .LVL395-.Ltext0
+	.uleb128 0x1
+	.byte	0x62
+	.byte	0x4
+	.uleb128 .LVL396-.Ltext0
+	.uleb128 .LVL404-.Ltext0
+	.uleb128 0x1
+	.byte	0x62
+	.byte	0x4
+	.uleb128 .LVL405-.Ltext0
+	.uleb128 .LVL407-.Ltext0
+	.uleb128 0x1
+	.byte	0x62
+	.byte	0x4
+	.uleb128 .LVL413-.Ltext0
+	.uleb128 .LVL416-.Ltext0
+	.uleb128 0x1
+	.byte	0x62
+	.byte	0x4
+	.uleb128 .LVL417-.Ltext0
+	.uleb128 .LVL425-.Ltext0
+	.uleb128 0x1
+	.byte	0x62
+	.byte	0x4
+	.uleb128 .LVL426-.Ltext0
+	.uleb128 .LVL428-.Ltext0
+	.uleb128 0x1
+	.byte	0x62
+	.byte	0x4
+	.uleb128 .LVL434-.Ltext0
+	.uleb128 .LVL446-.Ltext0
+	.uleb128 0x1
+	.byte	0x62
+	.byte	0x4
+	.uleb128 .LVL448-.Ltext0
+	.uleb128 .LVL456-.Ltext0
+	.uleb128 0x1
+	.byte	0x62
+	.byte	0x4
+	.uleb128 .LVL457-.Ltext0
+	.uleb128 .LVL459-.Ltext0
+	.uleb128 0x1
+	.byte	0x62
+	.byte	0x4
+	.uleb128 .LVL465-.Ltext0
+	.uleb128 .LVL468-.Ltext0
+	.uleb128 0x1
+	.byte	0x62
+	.byte	0x4
+	.uleb128 .LVL469-.Ltext0
+	.uleb128 .LVL477-.Ltext0
+	.uleb128 0x1
+	.byte	0x62
+	.byte	0x4
+	.uleb128 .LVL478-.Ltext0
+	.uleb128 .LVL480-.Ltext0
+	.uleb128 0x1
+	.byte	0x62
+	.byte	0x4
+	.uleb128 .LVL486-.Ltext0
+	.uleb128 .LFE6406-.Ltext0
+	.uleb128 0x1
+	.byte	0x62
+	.byte	0
+.LVUS3:
+	.uleb128 0
+	.uleb128 .LVU2741
+.LLST3:
+	.byte	0x4
+	.uleb128 .LVL0-.Ltext0
+	.uleb128 .LVL437-.Ltext0
+	.uleb128 0x1
+	.byte	0x64
+	.byte	0
+.LVUS4:
+	.uleb128 0
+	.uleb128 .LVU2734
+.LLST4:
+	.byte	0x4
+	.uleb128 .LVL0-.Ltext0
+	.uleb128 .LVL435-.Ltext0
+	.uleb128 0x1
+	.byte	0x65
+	.byte	0
+.LVUS5:
+	.uleb128 0
+	.uleb128 .LVU2776
+.LLST5:
+	.byte	0x4
+	.uleb128 .LVL0-.Ltext0
+	.uleb128 .LVL444-.Ltext0
+	.uleb128 0x1
+	.byte	0x66
+	.byte	0
+.LVUS6:
+	.uleb128 0
+	.uleb128 .LVU2774
+.LLST6:
+	.byte	0x4
+	.uleb128 .LVL0-.Ltext0
+	.uleb128 .LVL443-.Ltext0
+	.uleb128 0x1
+	.byte	0x67
+	.byte	0
+.LVUS7:
+	.uleb128 .LVU10
+	.uleb128 .LVU25
+	.uleb128 .LVU25
+	.uleb128 .LVU54
+	.uleb128 .LVU302
+	.uleb128 .LVU342
+	.uleb128 .LVU613
+	.uleb128 .LVU640
+	.uleb128 .LVU927
+	.uleb128 .LVU933
+	.uleb128 .LVU933
+	.uleb128 .LVU967
+	.uleb128 .LVU1246
+	.uleb128 .LVU1259
+	.uleb128 .LVU1562
+	.uleb128 .LVU1606
+	.uleb128 .LVU1853
+	.uleb128 .LVU1858
+	.uleb128 .LVU1858
+	.uleb128 .LVU1882
+	.uleb128 .LVU2161
+	.uleb128 .LVU2184
+	.uleb128 .LVU2459
+	.uleb128 .LVU2514
+	.uleb128 .LVU2729
+	.uleb128 .LVU2766
+.LLST7:
+	.byte	0x4
+	.uleb128 .LVL1-.Ltext0
+	.uleb128 .LVL4-.Ltext0
+	.uleb128 0x1
+	.byte	0x6d
+	.byte	0x4
+	.uleb128 .LVL4-.Ltext0
+	.uleb128 .LVL7-.Ltext0
+	.uleb128 0x1
+	.byte	0x69
+	.byte	0x4
+	.uleb128 .LVL48-.Ltext0
+	.uleb128 .LVL52-.Ltext0
+	.uleb128 0x1
+	.byte	0x6a
+	.byte	0x4
+	.uleb128 .LVL98-.Ltext0
+	.uleb128 .LVL101-.Ltext0
+	.uleb128 0x2
+	.byte	0x90
+	.uleb128 0x20
+	.byte	0x4
+	.uleb128 .LVL150-.Ltext0
+	.uleb128 .LVL151-.Ltext0
+	.uleb128 0x2
+	.byte	0x90
+	.uleb128 0x20
+	.byte	0x4
+	.uleb128 .LVL151-.Ltext0
+	.uleb128 .LVL156-.Ltext0
+	.uleb128 0x1
+	.byte	0x6f
+	.byte	0x4
+	.uleb128 .LVL200-.Ltext0
+	.uleb128 .LVL202-.Ltext0
+	.uleb128 0x1
+	.byte	0x6d
+	.byte	0x4
+	.uleb128 .LVL251-.Ltext0
+	.uleb128 .LVL255-.Ltext0
+	.uleb128 0x1
+	.byte	0x69
+	.byte	0x4
+	.uleb128 .LVL299-.Ltext0
+	.uleb128 .LVL300-.Ltext0
+	.uleb128 0x1
+	.byte	0x67
+	.byte	0x4
+	.uleb128 .LVL300-.Ltext0
+	.uleb128 .LVL303-.Ltext0
+	.uleb128 0x1
+	.byte	0x6f
+	.byte	0x4
+	.uleb128 .LVL346-.Ltext0
+	.uleb128 .LVL347-.Ltext0
+	.uleb128 0x1
+	.byte	0x6e
+	.byte	0x4
+	.uleb128 .LVL391-.Ltext0
+	.uleb128 .LVL393-.Ltext0
+	.uleb128 0x1
+	.byte	0x6a
+	.byte	0x4
+	.uleb128 .LVL434-.Ltext0
+	.uleb128 .LVL441-.Ltext0
+	.uleb128 0x1
+	.byte	0x6a
+	.byte	0
+.LVUS8:
+	.uleb128 .LVU29
+	.uleb128 .LVU152
+	.uleb128 .LVU332
+	.uleb128 .LVU439
+	.uleb128 .LVU631
+	.uleb128 .LVU644
+	.uleb128 .LVU644
+	.uleb128 .LVU756
+	.uleb128 .LVU950
+	.uleb128 .LVU1064
+	.uleb128 .LVU1248
+	.uleb128 .LVU1261
+	.uleb128 .LVU1261
+	.uleb128 .LVU1373
+	.uleb128 .LVU1575
+	.uleb128 .LVU1582
+	.uleb128 .LVU1587
+	.uleb128 .LVU1682
+	.uleb128 .LVU1872
+	.uleb128 .LVU1974
+	.uleb128 .LVU2178
+	.uleb128 .LVU2268
+	.uleb128 .LVU2485
+	.uleb128 .LVU2558
+	.uleb128 .LVU2746
+	.uleb128 .LVU2847
+.LLST8:
+	.byte	0x4
+	.uleb128 .LVL4-.Ltext0
+	.uleb128 .LVL22-.Ltext0
+	.uleb128 0x1
+	.byte	0x6a
+	.byte	0x4
+	.uleb128 .LVL50-.Ltext0
+	.uleb128 .LVL66-.Ltext0
+	.uleb128 0x1
+	.byte	0x69
+	.byte	0x4
+	.uleb128 .LVL100-.Ltext0
+	.uleb128 .LVL103-.Ltext0
+	.uleb128 0x1
+	.byte	0x66
+	.byte	0x4
+	.uleb128 .LVL103-.Ltext0
+	.uleb128 .LVL118-.Ltext0
+	.uleb128 0x1
+	.byte	0x68
+	.byte	0x4
+	.uleb128 .LVL153-.Ltext0
+	.uleb128 .LVL168-.Ltext0
+	.uleb128 0x1
+	.byte	0x6c
+	.byte	0x4
+	.uleb128 .LVL200-.Ltext0
+	.uleb128 .LVL203-.Ltext0
+	.uleb128 0x1
+	.byte	0x64
+	.byte	0x4
+	.uleb128 .LVL203-.Ltext0
+	.uleb128 .LVL219-.Ltext0
+	.uleb128 0x1
+	.byte	0x6e
+	.byte	0x4
+	.uleb128 .LVL253-.Ltext0
+	.uleb128 .LVL253-.Ltext0
+	.uleb128 0x1
+	.byte	0x67
+	.byte	0x4
+	.uleb128 .LVL253-.Ltext0
+	.uleb128 .LVL267-.Ltext0
+	.uleb128 0x1
+	.byte	0x6c
+	.byte	0x4
+	.uleb128 .LVL301-.Ltext0
+	.uleb128 .LVL314-.Ltext0
+	.uleb128 0x1
+	.byte	0x6a
+	.byte	0x4
+	.uleb128 .LVL346-.Ltext0
+	.uleb128 .LVL358-.Ltext0
+	.uleb128 0x1
+	.byte	0x69
+	.byte	0x4
+	.uleb128 .LVL392-.Ltext0
+	.uleb128 .LVL402-.Ltext0
+	.uleb128 0x1
+	.byte	0x6d
+	.byte	0x4
+	.uleb128 .LVL438-.Ltext0
+	.uleb128 .LVL454-.Ltext0
+	.uleb128 0x1
+	.byte	0x64
+	.byte	0
+.LVUS9:
+	.uleb128 .LVU45
+	.uleb128 .LVU187
+	.uleb128 .LVU349
+	.uleb128 .LVU503
+	.uleb128 .LVU659
+	.uleb128 .LVU820
+	.uleb128 .LVU975
+	.uleb128 .LVU1128
+	.uleb128 .LVU1278
+	.uleb128 .LVU1296
+	.uleb128 .LVU1300
+	.uleb128 .LVU1439
+	.uleb128 .LVU1591
+	.uleb128 .LVU1597
+	.uleb128 .LVU1597
+	.uleb128 .LVU1747
+	.uleb128 .LVU1897
+	.uleb128 .LVU1901
+	.uleb128 .LVU1901
+	.uleb128 .LVU2039
+	.uleb128 .LVU2186
+	.uleb128 .LVU2338
+	.uleb128 .LVU2487
+	.uleb128 .LVU2491
+	.uleb128 .LVU2496
+	.uleb128 .LVU2622
+	.uleb128 .LVU2760
+	.uleb128 .LVU2911
+.LLST9:
+	.byte	0x4
+	.uleb128 .LVL6-.Ltext0
+	.uleb128 .LVL27-.Ltext0
+	.uleb128 0x1
+	.byte	0x68
+	.byte	0x4
+	.uleb128 .LVL54-.Ltext0
+	.uleb128 .LVL78-.Ltext0
+	.uleb128 0x1
+	.byte	0x68
+	.byte	0x4
+	.uleb128 .LVL104-.Ltext0
+	.uleb128 .LVL130-.Ltext0
+	.uleb128 0x1
+	.byte	0x6e
+	.byte	0x4
+	.uleb128 .LVL159-.Ltext0
+	.uleb128 .LVL180-.Ltext0
+	.uleb128 0x1
+	.byte	0x69
+	.byte	0x4
+	.uleb128 .LVL204-.Ltext0
+	.uleb128 .LVL208-.Ltext0
+	.uleb128 0x1
+	.byte	0x6a
+	.byte	0x4
+	.uleb128 .LVL210-.Ltext0
+	.uleb128 .LVL231-.Ltext0
+	.uleb128 0x1
+	.byte	0x6b
+	.byte	0x4
+	.uleb128 .LVL253-.Ltext0
+	.uleb128 .LVL254-.Ltext0
+	.uleb128 0x1
+	.byte	0x6d
+	.byte	0x4
+	.uleb128 .LVL254-.Ltext0
+	.uleb128 .LVL279-.Ltext0
+	.uleb128 0x1
+	.byte	0x6b
+	.byte	0x4
+	.uleb128 .LVL305-.Ltext0
+	.uleb128 .LVL305-.Ltext0
+	.uleb128 0x1
+	.byte	0x64
+	.byte	0x4
+	.uleb128 .LVL305-.Ltext0
+	.uleb128 .LVL326-.Ltext0
+	.uleb128 0x1
+	.byte	0x6e
+	.byte	0x4
+	.uleb128 .LVL348-.Ltext0
+	.uleb128 .LVL371-.Ltext0
+	.uleb128 0x1
+	.byte	0x68
+	.byte	0x4
+	.uleb128 .LVL392-.Ltext0
+	.uleb128 .LVL392-.Ltext0
+	.uleb128 0x1
+	.byte	0x67
+	.byte	0x4
+	.uleb128 .LVL392-.Ltext0
+	.uleb128 .LVL414-.Ltext0
+	.uleb128 0x1
+	.byte	0x6e
+	.byte	0x4
+	.uleb128 .LVL440-.Ltext0
+	.uleb128 .LVL466-.Ltext0
+	.uleb128 0x1
+	.byte	0x65
+	.byte	0
+.LVUS10:
+	.uleb128 .LVU66
+	.uleb128 .LVU231
+	.uleb128 .LVU372
+	.uleb128 .LVU379
+	.uleb128 .LVU379
+	.uleb128 .LVU548
+	.uleb128 .LVU687
+	.uleb128 .LVU699
+	.uleb128 .LVU699
+	.uleb128 .LVU864
+	.uleb128 .LVU1002
+	.uleb128 .LVU1010
+	.uleb128 .LVU1018
+	.uleb128 .LVU1172
+	.uleb128 .LVU1305
+	.uleb128 .LVU1485
+	.uleb128 .LVU1613
+	.uleb128 .LVU1791
+	.uleb128 .LVU1921
+	.uleb128 .LVU2083
+	.uleb128 .LVU2210
+	.uleb128 .LVU2214
+	.uleb128 .LVU2219
+	.uleb128 .LVU2388
+	.uleb128 .LVU2504
+	.uleb128 .LVU2666
+	.uleb128 .LVU2791
+	.uleb128 .LVU2959
+.LLST10:
+	.byte	0x4
+	.uleb128 .LVL10-.Ltext0
+	.uleb128 .LVL36-.Ltext0
+	.uleb128 0x2
+	.byte	0x90
+	.uleb128 0x20
+	.byte	0x4
+	.uleb128 .LVL57-.Ltext0
+	.uleb128 .LVL58-.Ltext0
+	.uleb128 0x1
+	.byte	0x67
+	.byte	0x4
+	.uleb128 .LVL58-.Ltext0
+	.uleb128 .LVL87-.Ltext0
+	.uleb128 0x1
+	.byte	0x6f
+	.byte	0x4
+	.uleb128 .LVL110-.Ltext0
+	.uleb128 .LVL112-.Ltext0
+	.uleb128 0x1
+	.byte	0x6a
+	.byte	0x4
+	.uleb128 .LVL112-.Ltext0
+	.uleb128 .LVL139-.Ltext0
+	.uleb128 0x1
+	.byte	0x6d
+	.byte	0x4
+	.uleb128 .LVL164-.Ltext0
+	.uleb128 .LVL164-.Ltext0
+	.uleb128 0x1
+	.byte	0x6e
+	.byte	0x4
+	.uleb128 .LVL164-.Ltext0
+	.uleb128 .LVL189-.Ltext0
+	.uleb128 0x1
+	.byte	0x68
+	.byte	0x4
+	.uleb128 .LVL211-.Ltext0
+	.uleb128 .LVL240-.Ltext0
+	.uleb128 0x1
+	.byte	0x6a
+	.byte	0x4
+	.uleb128 .LVL257-.Ltext0
+	.uleb128 .LVL288-.Ltext0
+	.uleb128 0x1
+	.byte	0x68
+	.byte	0x4
+	.uleb128 .LVL306-.Ltext0
+	.uleb128 .LVL335-.Ltext0
+	.uleb128 0x2
+	.byte	0x90
+	.uleb128 0x20
+	.byte	0x4
+	.uleb128 .LVL352-.Ltext0
+	.uleb128 .LVL352-.Ltext0
+	.uleb128 0x1
+	.byte	0x64
+	.byte	0x4
+	.uleb128 .LVL352-.Ltext0
+	.uleb128 .LVL380-.Ltext0
+	.uleb128 0x1
+	.byte	0x6c
+	.byte	0x4
+	.uleb128 .LVL392-.Ltext0
+	.uleb128 .LVL423-.Ltext0
+	.uleb128 0x1
+	.byte	0x6b
+	.byte	0x4
+	.uleb128 .LVL447-.Ltext0
+	.uleb128 .LVL475-.Ltext0
+	.uleb128 0x1
+	.byte	0x66
+	.byte	0
+.LVUS11:
+	.uleb128 .LVU15
+	.uleb128 .LVU33
+	.uleb128 .LVU33
+	.uleb128 .LVU49
+	.uleb128 .LVU49
+	.uleb128 .LVU70
+	.uleb128 .LVU70
+	.uleb128 .LVU306
+	.uleb128 .LVU315
+	.uleb128 .LVU328
+	.uleb128 .LVU337
+	.uleb128 .LVU349
+	.uleb128 .LVU363
+	.uleb128 .LVU373
+	.uleb128 .LVU373
+	.uleb128 .LVU617
+	.uleb128 .LVU617
+	.uleb128 .LVU624
+	.uleb128 .LVU624
+	.uleb128 .LVU634
+	.uleb128 .LVU634
+	.uleb128 .LVU642
+	.uleb128 .LVU648
+	.uleb128 .LVU673
+	.uleb128 .LVU677
+	.uleb128 .LVU691
+	.uleb128 .LVU691
+	.uleb128 .LVU710
+	.uleb128 .LVU935
+	.uleb128 .LVU941
+	.uleb128 .LVU941
+	.uleb128 .LVU952
+	.uleb128 .LVU952
+	.uleb128 .LVU958
+	.uleb128 .LVU958
+	.uleb128 .LVU969
+	.uleb128 .LVU1238
+	.uleb128 .LVU1243
+	.uleb128 .LVU1243
+	.uleb128 .LVU1251
+	.uleb128 .LVU1251
+	.uleb128 .LVU1257
+	.uleb128 .LVU1263
+	.uleb128 .LVU1274
+	.uleb128 .LVU1274
+	.uleb128 .LVU1280
+	.uleb128 .LVU1280
+	.uleb128 .LVU1290
+	.uleb128 .LVU1290
+	.uleb128 .LVU1309
+	.uleb128 .LVU1309
+	.uleb128 .LVU1363
+	.uleb128 .LVU1566
+	.uleb128 .LVU1571
+	.uleb128 .LVU1584
+	.uleb128 .LVU1593
+	.uleb128 .LVU1601
+	.uleb128 .LVU1613
+	.uleb128 .LVU1615
+	.uleb128 .LVU1625
+	.uleb128 .LVU1625
+	.uleb128 .LVU1652
+	.uleb128 .LVU1854
+	.uleb128 .LVU1862
+	.uleb128 .LVU1862
+	.uleb128 .LVU1888
+	.uleb128 .LVU1888
+	.uleb128 .LVU1898
+	.uleb128 .LVU1905
+	.uleb128 .LVU1913
+	.uleb128 .LVU1918
+	.uleb128 .LVU2153
+	.uleb128 .LVU2158
+	.uleb128 .LVU2169
+	.uleb128 .LVU2169
+	.uleb128 .LVU2175
+	.uleb128 .LVU2216
+	.uleb128 .LVU2286
+	.uleb128 .LVU2463
+	.uleb128 .LVU2474
+	.uleb128 .LVU2481
+	.uleb128 .LVU2488
+	.uleb128 .LVU2750
+	.uleb128 .LVU2760
+	.uleb128 .LVU2762
+	.uleb128 .LVU2770
+	.uleb128 .LVU2770
+	.uleb128 .LVU2784
+	.uleb128 .LVU2784
+	.uleb128 .LVU2793
+	.uleb128 .LVU2793
+	.uleb128 0
+.LLST11:
+	.byte	0x4
+	.uleb128 .LVL2-.Ltext0
+	.uleb128 .LVL4-.Ltext0
+	.uleb128 0x1
+	.byte	0x68
+	.byte	0x4
+	.uleb128 .LVL4-.Ltext0
+	.uleb128 .LVL6-.Ltext0
+	.uleb128 0x1
+	.byte	0x6e
+	.byte	0x4
+	.uleb128 .LVL6-.Ltext0
+	.uleb128 .LVL10-.Ltext0
+	.uleb128 0x1
+	.byte	0x6b
+	.byte	0x4
+	.uleb128 .LVL10-.Ltext0
+	.uleb128 .LVL48-.Ltext0
+	.uleb128 0x1
+	.byte	0x6c
+	.byte	0x4
+	.uleb128 .LVL49-.Ltext0
+	.uleb128 .LVL50-.Ltext0
+	.uleb128 0x1
+	.byte	0x68
+	.byte	0x4
+	.uleb128 .LVL51-.Ltext0
+	.uleb128 .LVL54-.Ltext0
+	.uleb128 0x1
+	.byte	0x68
+	.byte	0x4
+	.uleb128 .LVL55-.Ltext0
+	.uleb128 .LVL57-.Ltext0
+	.uleb128 0x1
+	.byte	0x6f
+	.byte	0x4
+	.uleb128 .LVL57-.Ltext0
+	.uleb128 .LVL98-.Ltext0
+	.uleb128 0x1
+	.byte	0x6d
+	.byte	0x4
+	.uleb128 .LVL98-.Ltext0
+	.uleb128 .LVL99-.Ltext0
+	.uleb128 0x1
+	.byte	0x68
+	.byte	0x4
+	.uleb128 .LVL99-.Ltext0
+	.uleb128 .LVL100-.Ltext0
+	.uleb128 0x1
+	.byte	0x6e
+	.byte	0x4
+	.uleb128 .LVL100-.Ltext0
+	.uleb128 .LVL102-.Ltext0
+	.uleb128 0x1
+	.byte	0x69
+	.byte	0x4
+	.uleb128 .LVL103-.Ltext0
+	.uleb128 .LVL107-.Ltext0
+	.uleb128 0x1
+	.byte	0x69
+	.byte	0x4
+	.uleb128 .LVL108-.Ltext0
+	.uleb128 .LVL110-.Ltext0
+	.uleb128 0x1
+	.byte	0x6d
+	.byte	0x4
+	.uleb128 .LVL110-.Ltext0
+	.uleb128 .LVL114-.Ltext0
+	.uleb128 0x1
+	.byte	0x69
+	.byte	0x4
+	.uleb128 .LVL151-.Ltext0
+	.uleb128 .LVL152-.Ltext0
+	.uleb128 0x1
+	.byte	0x6c
+	.byte	0x4
+	.uleb128 .LVL152-.Ltext0
+	.uleb128 .LVL153-.Ltext0
+	.uleb128 0x1
+	.byte	0x66
+	.byte	0x4
+	.uleb128 .LVL153-.Ltext0
+	.uleb128 .LVL154-.Ltext0
+	.uleb128 0x1
+	.byte	0x64
+	.byte	0x4
+	.uleb128 .LVL154-.Ltext0
+	.uleb128 .LVL157-.Ltext0
+	.uleb128 0x1
+	.byte	0x6b
+	.byte	0x4
+	.uleb128 .LVL200-.Ltext0
+	.uleb128 .LVL200-.Ltext0
+	.uleb128 0x1
+	.byte	0x65
+	.byte	0x4
+	.uleb128 .LVL200-.Ltext0
+	.uleb128 .LVL200-.Ltext0
+	.uleb128 0x1
+	.byte	0x64
+	.byte	0x4
+	.uleb128 .LVL200-.Ltext0
+	.uleb128 .LVL201-.Ltext0
+	.uleb128 0x1
+	.byte	0x69
+	.byte	0x4
+	.uleb128 .LVL203-.Ltext0
+	.uleb128 .LVL204-.Ltext0
+	.uleb128 0x1
+	.byte	0x67
+	.byte	0x4
+	.uleb128 .LVL204-.Ltext0
+	.uleb128 .LVL204-.Ltext0
+	.uleb128 0x1
+	.byte	0x69
+	.byte	0x4
+	.uleb128 .LVL204-.Ltext0
+	.uleb128 .LVL207-.Ltext0
+	.uleb128 0x1
+	.byte	0x65
+	.byte	0x4
+	.uleb128 .LVL207-.Ltext0
+	.uleb128 .LVL211-.Ltext0
+	.uleb128 0x1
+	.byte	0x64
+	.byte	0x4
+	.uleb128 .LVL211-.Ltext0
+	.uleb128 .LVL217-.Ltext0
+	.uleb128 0x1
+	.byte	0x69
+	.byte	0x4
+	.uleb128 .LVL251-.Ltext0
+	.uleb128 .LVL252-.Ltext0
+	.uleb128 0x1
+	.byte	0x6d
+	.byte	0x4
+	.uleb128 .LVL253-.Ltext0
+	.uleb128 .LVL253-.Ltext0
+	.uleb128 0x1
+	.byte	0x64
+	.byte	0x4
+	.uleb128 .LVL254-.Ltext0
+	.uleb128 .LVL257-.Ltext0
+	.uleb128 0x1
+	.byte	0x68
+	.byte	0x4
+	.uleb128 .LVL257-.Ltext0
+	.uleb128 .LVL259-.Ltext0
+	.uleb128 0x1
+	.byte	0x65
+	.byte	0x4
+	.uleb128 .LVL259-.Ltext0
+	.uleb128 .LVL261-.Ltext0
+	.uleb128 0x1
+	.byte	0x6e
+	.byte	0x4
+	.uleb128 .LVL299-.Ltext0
+	.uleb128 .LVL300-.Ltext0
+	.uleb128 0x1
+	.byte	0x64
+	.byte	0x4
+	.uleb128 .LVL300-.Ltext0
+	.uleb128 .LVL304-.Ltext0
+	.uleb128 0x1
+	.byte	0x69
+	.byte	0x4
+	.uleb128 .LVL304-.Ltext0
+	.uleb128 .LVL305-.Ltext0
+	.uleb128 0x1
+	.byte	0x6b
+	.byte	0x4
+	.uleb128 .LVL305-.Ltext0
+	.uleb128 .LVL306-.Ltext0
+	.uleb128 0x1
+	.byte	0x69
+	.byte	0x4
+	.uleb128 .LVL306-.Ltext0
+	.uleb128 .LVL346-.Ltext0
+	.uleb128 0x1
+	.byte	0x66
+	.byte	0x4
+	.uleb128 .LVL346-.Ltext0
+	.uleb128 .LVL346-.Ltext0
+	.uleb128 0x1
+	.byte	0x64
+	.byte	0x4
+	.uleb128 .LVL346-.Ltext0
+	.uleb128 .LVL346-.Ltext0
+	.uleb128 0x1
+	.byte	0x6d
+	.byte	0x4
+	.uleb128 .LVL352-.Ltext0
+	.uleb128 .LVL362-.Ltext0
+	.uleb128 0x1
+	.byte	0x6b
+	.byte	0x4
+	.uleb128 .LVL391-.Ltext0
+	.uleb128 .LVL392-.Ltext0
+	.uleb128 0x1
+	.byte	0x68
+	.byte	0x4
+	.uleb128 .LVL392-.Ltext0
+	.uleb128 .LVL392-.Ltext0
+	.uleb128 0x1
+	.byte	0x69
+	.byte	0x4
+	.uleb128 .LVL438-.Ltext0
+	.uleb128 .LVL440-.Ltext0
+	.uleb128 0x1
+	.byte	0x65
+	.byte	0x4
+	.uleb128 .LVL440-.Ltext0
+	.uleb128 .LVL442-.Ltext0
+	.uleb128 0x1
+	.byte	0x66
+	.byte	0x4
+	.uleb128 .LVL442-.Ltext0
+	.uleb128 .LVL445-.Ltext0
+	.uleb128 0x1
+	.byte	0x69
+	.byte	0x4
+	.uleb128 .LVL445-.Ltext0
+	.uleb128 .LVL447-.Ltext0
+	.uleb128 0x1
+	.byte	0x67
+	.byte	0x4
+	.uleb128 .LVL447-.Ltext0
+	.uleb128 .LFE6406-.Ltext0
+	.uleb128 0x1
+	.byte	0x68
+	.byte	0
+.LVUS12:
+	.uleb128 .LVU96
+	.uleb128 .LVU150
+	.uleb128 .LVU174
+	.uleb128 .LVU264
+	.uleb128 .LVU290
+	.uleb128 .LVU389
+	.uleb128 .LVU411
+	.uleb128 .LVU467
+	.uleb128 .LVU490
+	.uleb128 .LVU577
+	.uleb128 .LVU602
+	.uleb128 .LVU681
+	.uleb128 .LVU733
+	.uleb128 .LVU784
+	.uleb128 .LVU807
+	.uleb128 .LVU892
+	.uleb128 .LVU916
+	.uleb128 .LVU984
+	.uleb128 .LVU1038
+	.uleb128 .LVU1092
+	.uleb128 .LVU1115
+	.uleb128 .LVU1201
+	.uleb128 .LVU1225
+	.uleb128 .LVU1298
+	.uleb128 .LVU1348
+	.uleb128 .LVU1403
+	.uleb128 .LVU1426
+	.uleb128 .LVU1518
+	.uleb128 .LVU1543
+	.uleb128 .LVU1711
+	.uleb128 .LVU1734
+	.uleb128 .LVU1820
+	.uleb128 .LVU1844
+	.uleb128 .LVU2003
+	.uleb128 .LVU2026
+	.uleb128 .LVU2116
+	.uleb128 .LVU2140
+	.uleb128 .LVU2301
+	.uleb128 .LVU2325
+	.uleb128 .LVU2418
+	.uleb128 .LVU2441
+	.uleb128 .LVU2586
+	.uleb128 .LVU2609
+	.uleb128 .LVU2694
+	.uleb128 .LVU2718
+	.uleb128 .LVU2875
+	.uleb128 .LVU2898
+	.uleb128 .LVU2983
+.LLST12:
+	.byte	0x4
+	.uleb128 .LVL11-.Ltext0
+	.uleb128 .LVL21-.Ltext0
+	.uleb128 0x1
+	.byte	0x69
+	.byte	0x4
+	.uleb128 .LVL26-.Ltext0
+	.uleb128 .LVL43-.Ltext0
+	.uleb128 0x1
+	.byte	0x69
+	.byte	0x4
+	.uleb128 .LVL47-.Ltext0
+	.uleb128 .LVL60-.Ltext0
+	.uleb128 0x1
+	.byte	0x63
+	.byte	0x4
+	.uleb128 .LVL61-.Ltext0
+	.uleb128 .LVL73-.Ltext0
+	.uleb128 0x1
+	.byte	0x63
+	.byte	0x4
+	.uleb128 .LVL77-.Ltext0
+	.uleb128 .LVL94-.Ltext0
+	.uleb128 0x1
+	.byte	0x63
+	.byte	0x4
+	.uleb128 .LVL98-.Ltext0
+	.uleb128 .LVL109-.Ltext0
+	.uleb128 0x1
+	.byte	0x63
+	.byte	0x4
+	.uleb128 .LVL115-.Ltext0
+	.uleb128 .LVL125-.Ltext0
+	.uleb128 0x1
+	.byte	0x63
+	.byte	0x4
+	.uleb128 .LVL129-.Ltext0
+	.uleb128 .LVL146-.Ltext0
+	.uleb128 0x1
+	.byte	0x63
+	.byte	0x4
+	.uleb128 .LVL150-.Ltext0
+	.uleb128 .LVL161-.Ltext0
+	.uleb128 0x1
+	.byte	0x63
+	.byte	0x4
+	.uleb128 .LVL164-.Ltext0
+	.uleb128 .LVL175-.Ltext0
+	.uleb128 0x1
+	.byte	0x63
+	.byte	0x4
+	.uleb128 .LVL179-.Ltext0
+	.uleb128 .LVL196-.Ltext0
+	.uleb128 0x1
+	.byte	0x63
+	.byte	0x4
+	.uleb128 .LVL200-.Ltext0
+	.uleb128 .LVL209-.Ltext0
+	.uleb128 0x1
+	.byte	0x63
+	.byte	0x4
+	.uleb128 .LVL215-.Ltext0
+	.uleb128 .LVL226-.Ltext0
+	.uleb128 0x1
+	.byte	0x63
+	.byte	0x4
+	.uleb128 .LVL230-.Ltext0
+	.uleb128 .LVL247-.Ltext0
+	.uleb128 0x1
+	.byte	0x63
+	.byte	0x4
+	.uleb128 .LVL251-.Ltext0
+	.uleb128 .LVL274-.Ltext0
+	.uleb128 0x1
+	.byte	0x63
+	.byte	0x4
+	.uleb128 .LVL278-.Ltext0
+	.uleb128 .LVL295-.Ltext0
+	.uleb128 0x1
+	.byte	0x63
+	.byte	0x4
+	.uleb128 .LVL299-.Ltext0
+	.uleb128 .LVL321-.Ltext0
+	.uleb128 0x1
+	.byte	0x63
+	.byte	0x4
+	.uleb128 .LVL325-.Ltext0
+	.uleb128 .LVL342-.Ltext0
+	.uleb128 0x1
+	.byte	0x63
+	.byte	0x4
+	.uleb128 .LVL346-.Ltext0
+	.uleb128 .LVL366-.Ltext0
+	.uleb128 0x1
+	.byte	0x63
+	.byte	0x4
+	.uleb128 .LVL370-.Ltext0
+	.uleb128 .LVL387-.Ltext0
+	.uleb128 0x1
+	.byte	0x63
+	.byte	0x4
+	.uleb128 .LVL391-.Ltext0
+	.uleb128 .LVL409-.Ltext0
+	.uleb128 0x1
+	.byte	0x63
+	.byte	0x4
+	.uleb128 .LVL413-.Ltext0
+	.uleb128 .LVL430-.Ltext0
+	.uleb128 0x1
+	.byte	0x63
+	.byte	0x4
+	.uleb128 .LVL434-.Ltext0
+	.uleb128 .LVL461-.Ltext0
+	.uleb128 0x1
+	.byte	0x63
+	.byte	0x4
+	.uleb128 .LVL465-.Ltext0
+	.uleb128 .LVL482-.Ltext0
+	.uleb128 0x1
+	.byte	0x63
+	.byte	0
+.LVUS13:
+	.uleb128 .LVU7
+	.uleb128 .LVU10
+.LLST13:
+	.byte	0x4
+	.uleb128 .LVL0-.Ltext0
+	.uleb128 .LVL1-.Ltext0
+	.uleb128 0x3
+	.byte	0x8
+	.byte	0xe8
+	.byte	0x9f
+	.byte	0
+.LVUS14:
+	.uleb128 .LVU7
+	.uleb128 .LVU10
+.LLST14:
+	.byte	0x4
+	.uleb128 .LVL0-.Ltext0
+	.uleb128 .LVL1-.Ltext0
+	.uleb128 0x1
+	.byte	0x64
+	.byte	0
+.LVUS15:
+	.uleb128 .LVU12
+	.uleb128 .LVU15
+.LLST15:
+	.byte	0x4
+	.uleb128 .LVL1-.Ltext0
+	.uleb128 .LVL2-.Ltext0
+	.uleb128 0x3
+	.byte	0x8
+	.byte	0x84
+	.byte	0x9f
+	.byte	0
+.LVUS16:
+	.uleb128 .LVU12
+	.uleb128 .LVU15
+.LLST16:
+	.byte	0x4
+	.uleb128 .LVL1-.Ltext0
+	.uleb128 .LVL2-.Ltext0
+	.uleb128 0x1
+	.byte	0x65
+	.byte	0
+.LVUS18:
+	.uleb128 .LVU17
+	.uleb128 .LVU25
+.LLST18:
+	.byte	0x4
+	.uleb128 .LVL2-.Ltext0
+	.uleb128 .LVL4-.Ltext0
+	.uleb128 0x3
+	.byte	0x8
+	.byte	0xf0
+	.byte	0x9f
+	.byte	0
+.LVUS19:
+	.uleb128 .LVU17
+	.uleb128 .LVU25
+.LLST19:
+	.byte	0x4
+	.uleb128 .LVL2-.Ltext0
+	.uleb128 .LVL4-.Ltext0
+	.uleb128 0x1
+	.byte	0x68
+	.byte	0
+.LVUS20:
+	.uleb128 .LVU17
+	.uleb128 .LVU25
+.LLST20:
+	.byte	0x4
+	.uleb128 .LVL2-.Ltext0
+	.uleb128 .LVL4-.Ltext0
+	.uleb128 0x1
+	.byte	0x6d
+	.byte	0
+.LVUS22:
+	.uleb128 .LVU80
+	.uleb128 .LVU82
+.LLST22:
+	.byte	0x4
+	.uleb128 .LVL11-.Ltext0
+	.uleb128 .LVL11-.Ltext0
+	.uleb128 0x1
+	.byte	0x62
+	.byte	0
+.LVUS24:
+	.uleb128 .LVU31
+	.uleb128 .LVU33
+.LLST24:
+	.byte	0x4
+	.uleb128 .LVL4-.Ltext0
+	.uleb128 .LVL4-.Ltext0
+	.uleb128 0x3
+	.byte	0x8
+	.byte	0xd4
+	.byte	0x9f
+	.byte	0
+.LVUS25:
+	.uleb128 .LVU31
+	.uleb128 .LVU33
+.LLST25:
+	.byte	0x4
+	.uleb128 .LVL4-.Ltext0
+	.uleb128 .LVL4-.Ltext0
+	.uleb128 0x1
+	.byte	0x65
+	.byte	0
+.LVUS27:
+	.uleb128 .LVU27
+	.uleb128 .LVU29
+.LLST27:
+	.byte	0x4
+	.uleb128 .LVL4-.Ltext0
+	.uleb128 .LVL4-.Ltext0
+	.uleb128 0x3
+	.byte	0x8
+	.byte	0xed
+	.byte	0x9f
+	.byte	0
+.LVUS28:
+	.uleb128 .LVU27
+	.uleb128 .LVU29
+.LLST28:
+	.byte	0x4
+	.uleb128 .LVL4-.Ltext0
+	.uleb128 .LVL4-.Ltext0
+	.uleb128 0x1
+	.byte	0x64
+	.byte	0
+.LVUS29:
+	.uleb128 .LVU35
+	.uleb128 .LVU38
+.LLST29:
+	.byte	0x4
+	.uleb128 .LVL4-.Ltext0
+	.uleb128 .LVL5-.Ltext0
+	.uleb128 0x3
+	.byte	0x8
+	.byte	0xf0
+	.byte	0x9f
+	.byte	0
+.LVUS30:
+	.uleb128 .LVU35
+	.uleb128 .LVU38
+.LLST30:
+	.byte	0x4
+	.uleb128 .LVL4-.Ltext0
+	.uleb128 .LVL5-.Ltext0
+	.uleb128 0x1
+	.byte	0x6e
+	.byte	0
+.LVUS31:
+	.uleb128 .LVU35
+	.uleb128 .LVU38
+.LLST31:
+	.byte	0x4
+	.uleb128 .LVL4-.Ltext0
+	.uleb128 .LVL5-.Ltext0
+	.uleb128 0x1
+	.byte	0x6a
+	.byte	0
+.LVUS33:
+	.uleb128 .LVU40
+	.uleb128 .LVU45
+.LLST33:
+	.byte	0x4
+	.uleb128 .LVL5-.Ltext0
+	.uleb128 .LVL6-.Ltext0
+	.uleb128 0x3
+	.byte	0x8
+	.byte	0xe8
+	.byte	0x9f
+	.byte	0
+.LVUS34:
+	.uleb128 .LVU40
+	.uleb128 .LVU45
+.LLST34:
+	.byte	0x4
+	.uleb128 .LVL5-.Ltext0
+	.uleb128 .LVL6-.Ltext0
+	.uleb128 0x1
+	.byte	0x66
+	.byte	0
+.LVUS36:
+	.uleb128 .LVU47
+	.uleb128 .LVU49
+.LLST36:
+	.byte	0x4
+	.uleb128 .LVL6-.Ltext0
+	.uleb128 .LVL6-.Ltext0
+	.uleb128 0x3
+	.byte	0x8
+	.byte	0x84
+	.byte	0x9f
+	.byte	0
+.LVUS37:
+	.uleb128 .LVU47
+	.uleb128 .LVU49
+.LLST37:
+	.byte	0x4
+	.uleb128 .LVL6-.Ltext0
+	.uleb128 .LVL6-.Ltext0
+	.uleb128 0x1
+	.byte	0x67
+	.byte	0
+.LVUS40:
+	.uleb128 .LVU51
+	.uleb128 .LVU60
+.LLST40:
+	.byte	0x4
+	.uleb128 .LVL6-.Ltext0
+	.uleb128 .LVL9-.Ltext0
+	.uleb128 0x3
+	.byte	0x8
+	.byte	0xf0
+	.byte	0x9f
+	.byte	0
+.LVUS41:
+	.uleb128 .LVU51
+	.uleb128 .LVU60
+.LLST41:
+	.byte	0x4
+	.uleb128 .LVL6-.Ltext0
+	.uleb128 .LVL9-.Ltext0
+	.uleb128 0x1
+	.byte	0x6b
+	.byte	0
+.LVUS42:
+	.uleb128 .LVU51
+	.uleb128 .LVU60
+.LLST42:
+	.byte	0x4
+	.uleb128 .LVL6-.Ltext0
+	.uleb128 .LVL9-.Ltext0
+	.uleb128 0x1
+	.byte	0x68
+	.byte	0
+.LVUS44:
+	.uleb128 .LVU94
+	.uleb128 .LVU96
+.LLST44:
+	.byte	0x4
+	.uleb128 .LVL11-.Ltext0
+	.uleb128 .LVL11-.Ltext0
+	.uleb128 0x1
+	.byte	0x63
+	.byte	0
+.LVUS46:
+	.uleb128 .LVU68
+	.uleb128 .LVU70
+.LLST46:
+	.byte	0x4
+	.uleb128 .LVL10-.Ltext0
+	.uleb128 .LVL10-.Ltext0
+	.uleb128 0x3
+	.byte	0x8
+	.byte	0xd4
+	.byte	0x9f
+	.byte	0
+.LVUS47:
+	.uleb128 .LVU68
+	.uleb128 .LVU70
+.LLST47:
+	.byte	0x4
+	.uleb128 .LVL10-.Ltext0
+	.uleb128 .LVL10-.Ltext0
+	.uleb128 0x1
+	.byte	0x67
+	.byte	0
+.LVUS50:
+	.uleb128 .LVU120
+	.uleb128 .LVU124
+.LLST50:
+	.byte	0x4
+	.uleb128 .LVL15-.Ltext0
+	.uleb128 .LVL16-.Ltext0
+	.uleb128 0x1
+	.byte	0x6a
+	.byte	0
+.LVUS52:
+	.uleb128 .LVU62
+	.uleb128 .LVU66
+.LLST52:
+	.byte	0x4
+	.uleb128 .LVL9-.Ltext0
+	.uleb128 .LVL10-.Ltext0
+	.uleb128 0x3
+	.byte	0x8
+	.byte	0xed
+	.byte	0x9f
+	.byte	0
+.LVUS53:
+	.uleb128 .LVU62
+	.uleb128 .LVU66
+.LLST53:
+	.byte	0x4
+	.uleb128 .LVL9-.Ltext0
+	.uleb128 .LVL10-.Ltext0
+	.uleb128 0x1
+	.byte	0x66
+	.byte	0
+.LVUS56:
+	.uleb128 .LVU72
+	.uleb128 .LVU76
+.LLST56:
+	.byte	0x4
+	.uleb128 .LVL10-.Ltext0
+	.uleb128 .LVL11-.Ltext0
+	.uleb128 0x3
+	.byte	0x8
+	.byte	0xf0
+	.byte	0x9f
+	.byte	0
+.LVUS57:
+	.uleb128 .LVU72
+	.uleb128 .LVU76
+.LLST57:
+	.byte	0x4
+	.uleb128 .LVL10-.Ltext0
+	.uleb128 .LVL11-.Ltext0
+	.uleb128 0x1
+	.byte	0x6c
+	.byte	0
+.LVUS58:
+	.uleb128 .LVU72
+	.uleb128 .LVU76
+.LLST58:
+	.byte	0x4
+	.uleb128 .LVL10-.Ltext0
+	.uleb128 .LVL11-.Ltext0
+	.uleb128 0x2
+	.byte	0x90
+	.uleb128 0x20
+	.byte	0
+.LVUS60:
+	.uleb128 .LVU98
+	.uleb128 .LVU100
+.LLST60:
+	.byte	0x4
+	.uleb128 .LVL11-.Ltext0
+	.uleb128 .LVL11-.Ltext0
+	.uleb128 0x1
+	.byte	0x69
+	.byte	0
+.LVUS61:
+	.uleb128 .LVU98
+	.uleb128 .LVU100
+.LLST61:
+	.byte	0x4
+	.uleb128 .LVL11-.Ltext0
+	.uleb128 .LVL11-.Ltext0
+	.uleb128 0x1
+	.byte	0x62
+	.byte	0
+.LVUS63:
+	.uleb128 .LVU100
+	.uleb128 .LVU109
+.LLST63:
+	.byte	0x4
+	.uleb128 .LVL11-.Ltext0
+	.uleb128 .LVL14-.Ltext0
+	.uleb128 0x2
+	.byte	0x44
+	.byte	0x9f
+	.byte	0
+.LVUS64:
+	.uleb128 .LVU104
+	.uleb128 .LVU107
+.LLST64:
+	.byte	0x4
+	.uleb128 .LVL12-.Ltext0
+	.uleb128 .LVL13-.Ltext0
+	.uleb128 0x1
+	.byte	0x62
+	.byte	0
+.LVUS66:
+	.uleb128 .LVU109
+	.uleb128 .LVU112
+.LLST66:
+	.byte	0x4
+	.uleb128 .LVL14-.Ltext0
+	.uleb128 .LVL14-.Ltext0
+	.uleb128 0x2
+	.byte	0x3c
+	.byte	0x9f
+	.byte	0
+.LVUS67:
+	.uleb128 .LVU112
+	.uleb128 .LVU116
+.LLST67:
+	.byte	0x4
+	.uleb128 .LVL14-.Ltext0
+	.uleb128 .LVL15-.Ltext0
+	.uleb128 0x1
+	.byte	0x6f
+	.byte	0
+.LVUS68:
+	.uleb128 .LVU112
+	.uleb128 .LVU116
+.LLST68:
+	.byte	0x4
+	.uleb128 .LVL14-.Ltext0
+	.uleb128 .LVL15-.Ltext0
+	.uleb128 0x1
+	.byte	0x62
+	.byte	0
+.LVUS69:
+	.uleb128 .LVU118
+	.uleb128 .LVU120
+.LLST69:
+	.byte	0x4
+	.uleb128 .LVL15-.Ltext0
+	.uleb128 .LVL15-.Ltext0
+	.uleb128 0x1
+	.byte	0x62
+	.byte	0
+.LVUS71:
+	.uleb128 .LVU126
+	.uleb128 .LVU128
+.LLST71:
+	.byte	0x4
+	.uleb128 .LVL16-.Ltext0
+	.uleb128 .LVL16-.Ltext0
+	.uleb128 0x1
+	.byte	0x61
+	.byte	0
+.LVUS72:
+	.uleb128 .LVU126
+	.uleb128 .LVU128
+.LLST72:
+	.byte	0x4
+	.uleb128 .LVL16-.Ltext0
+	.uleb128 .LVL16-.Ltext0
+	.uleb128 0x1
+	.byte	0x63
+	.byte	0
+.LVUS74:
+	.uleb128 .LVU132
+	.uleb128 .LVU134
+.LLST74:
+	.byte	0x4
+	.uleb128 .LVL17-.Ltext0
+	.uleb128 .LVL18-.Ltext0
+	.uleb128 0x1
+	.byte	0x63
+	.byte	0
+.LVUS75:
+	.uleb128 .LVU136
+	.uleb128 .LVU139
+.LLST75:
+	.byte	0x4
+	.uleb128 .LVL18-.Ltext0
+	.uleb128 .LVL19-.Ltext0
+	.uleb128 0x1
+	.byte	0x63
+	.byte	0
+.LVUS76:
+	.uleb128 .LVU136
+	.uleb128 .LVU139
+.LLST76:
+	.byte	0x4
+	.uleb128 .LVL18-.Ltext0
+	.uleb128 .LVL19-.Ltext0
+	.uleb128 0x1
+	.byte	0x69
+	.byte	0
+.LVUS78:
+	.uleb128 .LVU141
+	.uleb128 .LVU143
+.LLST78:
+	.byte	0x4
+	.uleb128 .LVL19-.Ltext0
+	.uleb128 .LVL19-.Ltext0
+	.uleb128 0x1
+	.byte	0x69
+	.byte	0
+.LVUS79:
+	.uleb128 .LVU141
+	.uleb128 .LVU143
+.LLST79:
+	.byte	0x4
+	.uleb128 .LVL19-.Ltext0
+	.uleb128 .LVL19-.Ltext0
+	.uleb128 0x1
+	.byte	0x62
+	.byte	0
+.LVUS81:
+	.uleb128 .LVU143
+	.uleb128 .LVU156
+.LLST81:
+	.byte	0x4
+	.uleb128 .LVL19-.Ltext0
+	.uleb128 .LVL24-.Ltext0
+	.uleb128 0x2
+	.byte	0x49
+	.byte	0x9f
+	.byte	0
+.LVUS82:
+	.uleb128 .LVU148
+	.uleb128 .LVU154
+.LLST82:
+	.byte	0x4
+	.uleb128 .LVL20-.Ltext0
+	.uleb128 .LVL23-.Ltext0
+	.uleb128 0x1
+	.byte	0x62
+	.byte	0
+.LVUS84:
+	.uleb128 .LVU176
+	.uleb128 .LVU178
+.LLST84:
+	.byte	0x4
+	.uleb128 .LVL26-.Ltext0
+	.uleb128 .LVL26-.Ltext0
+	.uleb128 0x3
+	.byte	0x8
+	.byte	0x93
+	.byte	0x9f
+	.byte	0
+.LVUS85:
+	.uleb128 .LVU176
+	.uleb128 .LVU178
+.LLST85:
+	.byte	0x4
+	.uleb128 .LVL26-.Ltext0
+	.uleb128 .LVL26-.Ltext0
+	.uleb128 0x1
+	.byte	0x63
+	.byte	0
+.LVUS87:
+	.uleb128 .LVU172
+	.uleb128 .LVU174
+.LLST87:
+	.byte	0x4
+	.uleb128 .LVL26-.Ltext0
+	.uleb128 .LVL26-.Ltext0
+	.uleb128 0x3
+	.byte	0x8
+	.byte	0x4e
+	.byte	0x9f
+	.byte	0
+.LVUS89:
+	.uleb128 .LVU156
+	.uleb128 .LVU159
+.LLST89:
+	.byte	0x4
+	.uleb128 .LVL24-.Ltext0
+	.uleb128 .LVL24-.Ltext0
+	.uleb128 0x2
+	.byte	0x37
+	.byte	0x9f
+	.byte	0
+.LVUS91:
+	.uleb128 .LVU159
+	.uleb128 .LVU162
+.LLST91:
+	.byte	0x4
+	.uleb128 .LVL24-.Ltext0
+	.uleb128 .LVL24-.Ltext0
+	.uleb128 0x1
+	.byte	0x6a
+	.byte	0
+.LVUS92:
+	.uleb128 .LVU159
+	.uleb128 .LVU162
+.LLST92:
+	.byte	0x4
+	.uleb128 .LVL24-.Ltext0
+	.uleb128 .LVL24-.Ltext0
+	.uleb128 0x1
+	.byte	0x62
+	.byte	0
+.LVUS94:
+	.uleb128 .LVU165
+	.uleb128 .LVU170
+.LLST94:
+	.byte	0x4
+	.uleb128 .LVL24-.Ltext0
+	.uleb128 .LVL26-.Ltext0
+	.uleb128 0x3
+	.byte	0x8
+	.byte	0x39
+	.byte	0x9f
+	.byte	0
+.LVUS95:
+	.uleb128 .LVU168
+	.uleb128 .LVU170
+.LLST95:
+	.byte	0x4
+	.uleb128 .LVL25-.Ltext0
+	.uleb128 .LVL26-.Ltext0
+	.uleb128 0x1
+	.byte	0x62
+	.byte	0
+.LVUS96:
+	.uleb128 .LVU181
+	.uleb128 .LVU183
+.LLST96:
+	.byte	0x4
+	.uleb128 .LVL26-.Ltext0
+	.uleb128 .LVL26-.Ltext0
+	.uleb128 0x1
+	.byte	0x6a
+	.byte	0
+.LVUS97:
+	.uleb128 .LVU181
+	.uleb128 .LVU183
+.LLST97:
+	.byte	0x4
+	.uleb128 .LVL26-.Ltext0
+	.uleb128 .LVL26-.Ltext0
+	.uleb128 0x1
+	.byte	0x61
+	.byte	0
+.LVUS98:
+	.uleb128 .LVU183
+	.uleb128 .LVU187
+.LLST98:
+	.byte	0x4
+	.uleb128 .LVL26-.Ltext0
+	.uleb128 .LVL27-.Ltext0
+	.uleb128 0x1
+	.byte	0x68
+	.byte	0
+.LVUS100:
+	.uleb128 .LVU190
+	.uleb128 .LVU192
+.LLST100:
+	.byte	0x4
+	.uleb128 .LVL28-.Ltext0
+	.uleb128 .LVL28-.Ltext0
+	.uleb128 0x1
+	.byte	0x68
+	.byte	0
+.LVUS101:
+	.uleb128 .LVU190
+	.uleb128 .LVU192
+.LLST101:
+	.byte	0x4
+	.uleb128 .LVL28-.Ltext0
+	.uleb128 .LVL28-.Ltext0
+	.uleb128 0x1
+	.byte	0x6f
+	.byte	0
+.LVUS103:
+	.uleb128 .LVU196
+	.uleb128 .LVU198
+.LLST103:
+	.byte	0x4
+	.uleb128 .LVL29-.Ltext0
+	.uleb128 .LVL30-.Ltext0
+	.uleb128 0x1
+	.byte	0x6f
+	.byte	0
+.LVUS104:
+	.uleb128 .LVU200
+	.uleb128 .LVU203
+.LLST104:
+	.byte	0x4
+	.uleb128 .LVL30-.Ltext0
+	.uleb128 .LVL31-.Ltext0
+	.uleb128 0x1
+	.byte	0x6f
+	.byte	0
+.LVUS105:
+	.uleb128 .LVU200
+	.uleb128 .LVU203
+.LLST105:
+	.byte	0x4
+	.uleb128 .LVL30-.Ltext0
+	.uleb128 .LVL31-.Ltext0
+	.uleb128 0x1
+	.byte	0x69
+	.byte	0
+.LVUS107:
+	.uleb128 .LVU205
+	.uleb128 .LVU207
+.LLST107:
+	.byte	0x4
+	.uleb128 .LVL31-.Ltext0
+	.uleb128 .LVL31-.Ltext0
+	.uleb128 0x1
+	.byte	0x69
+	.byte	0
+.LVUS108:
+	.uleb128 .LVU205
+	.uleb128 .LVU207
+.LLST108:
+	.byte	0x4
+	.uleb128 .LVL31-.Ltext0
+	.uleb128 .LVL31-.Ltext0
+	.uleb128 0x1
+	.byte	0x6a
+	.byte	0
+.LVUS110:
+	.uleb128 .LVU207
+	.uleb128 .LVU216
+.LLST110:
+	.byte	0x4
+	.uleb128 .LVL31-.Ltext0
+	.uleb128 .LVL34-.Ltext0
+	.uleb128 0x2
+	.byte	0x44
+	.byte	0x9f
+	.byte	0
+.LVUS111:
+	.uleb128 .LVU211
+	.uleb128 .LVU214
+.LLST111:
+	.byte	0x4
+	.uleb128 .LVL32-.Ltext0
+	.uleb128 .LVL33-.Ltext0
+	.uleb128 0x1
+	.byte	0x6a
+	.byte	0
+.LVUS113:
+	.uleb128 .LVU216
+	.uleb128 .LVU219
+.LLST113:
+	.byte	0x4
+	.uleb128 .LVL34-.Ltext0
+	.uleb128 .LVL34-.Ltext0
+	.uleb128 0x2
+	.byte	0x3c
+	.byte	0x9f
+	.byte	0
+.LVUS114:
+	.uleb128 .LVU219
+	.uleb128 .LVU223
+.LLST114:
+	.byte	0x4
+	.uleb128 .LVL34-.Ltext0
+	.uleb128 .LVL35-.Ltext0
+	.uleb128 0x1
+	.byte	0x63
+	.byte	0
+.LVUS115:
+	.uleb128 .LVU219
+	.uleb128 .LVU223
+.LLST115:
+	.byte	0x4
+	.uleb128 .LVL34-.Ltext0
+	.uleb128 .LVL35-.Ltext0
+	.uleb128 0x1
+	.byte	0x6a
+	.byte	0
+.LVUS116:
+	.uleb128 .LVU225
+	.uleb128 .LVU227
+.LLST116:
+	.byte	0x4
+	.uleb128 .LVL35-.Ltext0
+	.uleb128 .LVL35-.Ltext0
+	.uleb128 0x1
+	.byte	0x6a
+	.byte	0
+.LVUS117:
+	.uleb128 .LVU225
+	.uleb128 .LVU227
+.LLST117:
+	.byte	0x4
+	.uleb128 .LVL35-.Ltext0
+	.uleb128 .LVL35-.Ltext0
+	.uleb128 0x1
+	.byte	0x68
+	.byte	0
+.LVUS118:
+	.uleb128 .LVU227
+	.uleb128 .LVU231
+.LLST118:
+	.byte	0x4
+	.uleb128 .LVL35-.Ltext0
+	.uleb128 .LVL36-.Ltext0
+	.uleb128 0x2
+	.byte	0x90
+	.uleb128 0x20
+	.byte	0
+.LVUS120:
+	.uleb128 .LVU234
+	.uleb128 .LVU236
+.LLST120:
+	.byte	0x4
+	.uleb128 .LVL37-.Ltext0
+	.uleb128 .LVL37-.Ltext0
+	.uleb128 0x2
+	.byte	0x90
+	.uleb128 0x20
+	.byte	0
+.LVUS121:
+	.uleb128 .LVU234
+	.uleb128 .LVU236
+.LLST121:
+	.byte	0x4
+	.uleb128 .LVL37-.Ltext0
+	.uleb128 .LVL37-.Ltext0
+	.uleb128 0x1
+	.byte	0x6f
+	.byte	0
+.LVUS123:
+	.uleb128 .LVU241
+	.uleb128 .LVU245
+.LLST123:
+	.byte	0x4
+	.uleb128 .LVL38-.Ltext0
+	.uleb128 .LVL39-.Ltext0
+	.uleb128 0x1
+	.byte	0x6f
+	.byte	0
+.LVUS125:
+	.uleb128 .LVU304
+	.uleb128 .LVU306
+.LLST125:
+	.byte	0x4
+	.uleb128 .LVL48-.Ltext0
+	.uleb128 .LVL48-.Ltext0
+	.uleb128 0x3
+	.byte	0x8
+	.byte	0xe0
+	.byte	0x9f
+	.byte	0
+.LVUS126:
+	.uleb128 .LVU304
+	.uleb128 .LVU306
+.LLST126:
+	.byte	0x4
+	.uleb128 .LVL48-.Ltext0
+	.uleb128 .LVL48-.Ltext0
+	.uleb128 0x1
+	.byte	0x65
+	.byte	0
+.LVUS128:
+	.uleb128 .LVU308
+	.uleb128 .LVU311
+.LLST128:
+	.byte	0x4
+	.uleb128 .LVL48-.Ltext0
+	.uleb128 .LVL49-.Ltext0
+	.uleb128 0x2
+	.byte	0x3c
+	.byte	0x9f
+	.byte	0
+.LVUS129:
+	.uleb128 .LVU308
+	.uleb128 .LVU311
+.LLST129:
+	.byte	0x4
+	.uleb128 .LVL48-.Ltext0
+	.uleb128 .LVL49-.Ltext0
+	.uleb128 0x1
+	.byte	0x6a
+	.byte	0
+.LVUS131:
+	.uleb128 .LVU313
+	.uleb128 .LVU315
+.LLST131:
+	.byte	0x4
+	.uleb128 .LVL49-.Ltext0
+	.uleb128 .LVL49-.Ltext0
+	.uleb128 0x3
+	.byte	0x8
+	.byte	0xd4
+	.byte	0x9f
+	.byte	0
+.LVUS132:
+	.uleb128 .LVU313
+	.uleb128 .LVU315
+.LLST132:
+	.byte	0x4
+	.uleb128 .LVL49-.Ltext0
+	.uleb128 .LVL49-.Ltext0
+	.uleb128 0x1
+	.byte	0x66
+	.byte	0
+.LVUS133:
+	.uleb128 .LVU247
+	.uleb128 .LVU250
+.LLST133:
+	.byte	0x4
+	.uleb128 .LVL39-.Ltext0
+	.uleb128 .LVL40-.Ltext0
+	.uleb128 0x1
+	.byte	0x6f
+	.byte	0
+.LVUS134:
+	.uleb128 .LVU247
+	.uleb128 .LVU250
+.LLST134:
+	.byte	0x4
+	.uleb128 .LVL39-.Ltext0
+	.uleb128 .LVL40-.Ltext0
+	.uleb128 0x1
+	.byte	0x69
+	.byte	0
+.LVUS136:
+	.uleb128 .LVU252
+	.uleb128 .LVU254
+.LLST136:
+	.byte	0x4
+	.uleb128 .LVL40-.Ltext0
+	.uleb128 .LVL40-.Ltext0
+	.uleb128 0x1
+	.byte	0x69
+	.byte	0
+.LVUS137:
+	.uleb128 .LVU252
+	.uleb128 .LVU254
+.LLST137:
+	.byte	0x4
+	.uleb128 .LVL40-.Ltext0
+	.uleb128 .LVL40-.Ltext0
+	.uleb128 0x1
+	.byte	0x6a
+	.byte	0
+.LVUS139:
+	.uleb128 .LVU254
+	.uleb128 .LVU270
+.LLST139:
+	.byte	0x4
+	.uleb128 .LVL40-.Ltext0
+	.uleb128 .LVL45-.Ltext0
+	.uleb128 0x2
+	.byte	0x49
+	.byte	0x9f
+	.byte	0
+.LVUS140:
+	.uleb128 .LVU260
+	.uleb128 .LVU267
+.LLST140:
+	.byte	0x4
+	.uleb128 .LVL42-.Ltext0
+	.uleb128 .LVL44-.Ltext0
+	.uleb128 0x1
+	.byte	0x6a
+	.byte	0
+.LVUS142:
+	.uleb128 .LVU292
+	.uleb128 .LVU294
+.LLST142:
+	.byte	0x4
+	.uleb128 .LVL47-.Ltext0
+	.uleb128 .LVL47-.Ltext0
+	.uleb128 0x3
+	.byte	0x8
+	.byte	0x39
+	.byte	0x9f
+	.byte	0
+.LVUS144:
+	.uleb128 .LVU326
+	.uleb128 .LVU328
+.LLST144:
+	.byte	0x4
+	.uleb128 .LVL50-.Ltext0
+	.uleb128 .LVL50-.Ltext0
+	.uleb128 0x3
+	.byte	0x8
+	.byte	0xf4
+	.byte	0x9f
+	.byte	0
+.LVUS145:
+	.uleb128 .LVU326
+	.uleb128 .LVU328
+.LLST145:
+	.byte	0x4
+	.uleb128 .LVL50-.Ltext0
+	.uleb128 .LVL50-.Ltext0
+	.uleb128 0x1
+	.byte	0x67
+	.byte	0
+.LVUS147:
+	.uleb128 .LVU288
+	.uleb128 .LVU290
+.LLST147:
+	.byte	0x4
+	.uleb128 .LVL47-.Ltext0
+	.uleb128 .LVL47-.Ltext0
+	.uleb128 0x3
+	.byte	0x8
+	.byte	0x4e
+	.byte	0x9f
+	.byte	0
+.LVUS149:
+	.uleb128 .LVU330
+	.uleb128 .LVU332
+.LLST149:
+	.byte	0x4
+	.uleb128 .LVL50-.Ltext0
+	.uleb128 .LVL50-.Ltext0
+	.uleb128 0x3
+	.byte	0x8
+	.byte	0x30
+	.byte	0x9f
+	.byte	0
+.LVUS151:
+	.uleb128 .LVU322
+	.uleb128 .LVU324
+.LLST151:
+	.byte	0x4
+	.uleb128 .LVL50-.Ltext0
+	.uleb128 .LVL50-.Ltext0
+	.uleb128 0x3
+	.byte	0x8
+	.byte	0xe2
+	.byte	0x9f
+	.byte	0
+.LVUS152:
+	.uleb128 .LVU322
+	.uleb128 .LVU324
+.LLST152:
+	.byte	0x4
+	.uleb128 .LVL50-.Ltext0
+	.uleb128 .LVL50-.Ltext0
+	.uleb128 0x1
+	.byte	0x66
+	.byte	0
+.LVUS154:
+	.uleb128 .LVU270
+	.uleb128 .LVU273
+.LLST154:
+	.byte	0x4
+	.uleb128 .LVL45-.Ltext0
+	.uleb128 .LVL45-.Ltext0
+	.uleb128 0x2
+	.byte	0x37
+	.byte	0x9f
+	.byte	0
+.LVUS156:
+	.uleb128 .LVU273
+	.uleb128 .LVU276
+.LLST156:
+	.byte	0x4
+	.uleb128 .LVL45-.Ltext0
+	.uleb128 .LVL45-.Ltext0
+	.uleb128 0x1
+	.byte	0x61
+	.byte	0
+.LVUS157:
+	.uleb128 .LVU273
+	.uleb128 .LVU276
+.LLST157:
+	.byte	0x4
+	.uleb128 .LVL45-.Ltext0
+	.uleb128 .LVL45-.Ltext0
+	.uleb128 0x1
+	.byte	0x6a
+	.byte	0
+.LVUS159:
+	.uleb128 .LVU279
+	.uleb128 .LVU286
+.LLST159:
+	.byte	0x4
+	.uleb128 .LVL45-.Ltext0
+	.uleb128 .LVL47-.Ltext0
+	.uleb128 0x3
+	.byte	0x8
+	.byte	0x93
+	.byte	0x9f
+	.byte	0
+.LVUS160:
+	.uleb128 .LVU283
+	.uleb128 .LVU286
+.LLST160:
+	.byte	0x4
+	.uleb128 .LVL46-.Ltext0
+	.uleb128 .LVL47-.Ltext0
+	.uleb128 0x1
+	.byte	0x6a
+	.byte	0
+.LVUS162:
+	.uleb128 .LVU351
+	.uleb128 .LVU353
+.LLST162:
+	.byte	0x4
+	.uleb128 .LVL54-.Ltext0
+	.uleb128 .LVL54-.Ltext0
+	.uleb128 0x3
+	.byte	0x8
+	.byte	0xf4
+	.byte	0x9f
+	.byte	0
+.LVUS163:
+	.uleb128 .LVU351
+	.uleb128 .LVU353
+.LLST163:
+	.byte	0x4
+	.uleb128 .LVL54-.Ltext0
+	.uleb128 .LVL54-.Ltext0
+	.uleb128 0x1
+	.byte	0x66
+	.byte	0
+.LVUS165:
+	.uleb128 .LVU355
+	.uleb128 .LVU359
+.LLST165:
+	.byte	0x4
+	.uleb128 .LVL54-.Ltext0
+	.uleb128 .LVL55-.Ltext0
+	.uleb128 0x3
+	.byte	0x8
+	.byte	0x30
+	.byte	0x9f
+	.byte	0
+.LVUS166:
+	.uleb128 .LVU355
+	.uleb128 .LVU359
+.LLST166:
+	.byte	0x4
+	.uleb128 .LVL54-.Ltext0
+	.uleb128 .LVL55-.Ltext0
+	.uleb128 0x1
+	.byte	0x68
+	.byte	0
+.LVUS168:
+	.uleb128 .LVU361
+	.uleb128 .LVU363
+.LLST168:
+	.byte	0x4
+	.uleb128 .LVL55-.Ltext0
+	.uleb128 .LVL55-.Ltext0
+	.uleb128 0x3
+	.byte	0x8
+	.byte	0x64
+	.byte	0x9f
+	.byte	0
+.LVUS169:
+	.uleb128 .LVU361
+	.uleb128 .LVU363
+.LLST169:
+	.byte	0x4
+	.uleb128 .LVL55-.Ltext0
+	.uleb128 .LVL55-.Ltext0
+	.uleb128 0x1
+	.byte	0x65
+	.byte	0
+.LVUS170:
+	.uleb128 .LVU299
+	.uleb128 .LVU302
+.LLST170:
+	.byte	0x4
+	.uleb128 .LVL47-.Ltext0
+	.uleb128 .LVL48-.Ltext0
+	.uleb128 0x3
+	.byte	0x8
+	.byte	0x66
+	.byte	0x9f
+	.byte	0
+.LVUS171:
+	.uleb128 .LVU299
+	.uleb128 .LVU302
+.LLST171:
+	.byte	0x4
+	.uleb128 .LVL47-.Ltext0
+	.uleb128 .LVL48-.Ltext0
+	.uleb128 0x1
+	.byte	0x67
+	.byte	0
+.LVUS172:
+	.uleb128 .LVU317
+	.uleb128 .LVU320
+.LLST172:
+	.byte	0x4
+	.uleb128 .LVL49-.Ltext0
+	.uleb128 .LVL50-.Ltext0
+	.uleb128 0x3
+	.byte	0x8
+	.byte	0x30
+	.byte	0x9f
+	.byte	0
+.LVUS173:
+	.uleb128 .LVU317
+	.uleb128 .LVU320
+.LLST173:
+	.byte	0x4
+	.uleb128 .LVL49-.Ltext0
+	.uleb128 .LVL50-.Ltext0
+	.uleb128 0x1
+	.byte	0x68
+	.byte	0
+.LVUS174:
+	.uleb128 .LVU317
+	.uleb128 .LVU320
+.LLST174:
+	.byte	0x4
+	.uleb128 .LVL49-.Ltext0
+	.uleb128 .LVL50-.Ltext0
+	.uleb128 0x1
+	.byte	0x6a
+	.byte	0
+.LVUS175:
+	.uleb128 .LVU334
+	.uleb128 .LVU337
+.LLST175:
+	.byte	0x4
+	.uleb128 .LVL50-.Ltext0
+	.uleb128 .LVL51-.Ltext0
+	.uleb128 0x3
+	.byte	0x8
+	.byte	0xa4
+	.byte	0x9f
+	.byte	0
+.LVUS176:
+	.uleb128 .LVU334
+	.uleb128 .LVU337
+.LLST176:
+	.byte	0x4
+	.uleb128 .LVL50-.Ltext0
+	.uleb128 .LVL51-.Ltext0
+	.uleb128 0x1
+	.byte	0x65
+	.byte	0
+.LVUS178:
+	.uleb128 .LVU339
+	.uleb128 .LVU344
+.LLST178:
+	.byte	0x4
+	.uleb128 .LVL51-.Ltext0
+	.uleb128 .LVL53-.Ltext0
+	.uleb128 0x3
+	.byte	0x8
+	.byte	0xc0
+	.byte	0x9f
+	.byte	0
+.LVUS179:
+	.uleb128 .LVU339
+	.uleb128 .LVU344
+.LLST179:
+	.byte	0x4
+	.uleb128 .LVL51-.Ltext0
+	.uleb128 .LVL53-.Ltext0
+	.uleb128 0x1
+	.byte	0x68
+	.byte	0
+.LVUS180:
+	.uleb128 .LVU339
+	.uleb128 .LVU344
+.LLST180:
+	.byte	0x4
+	.uleb128 .LVL51-.Ltext0
+	.uleb128 .LVL53-.Ltext0
+	.uleb128 0x1
+	.byte	0x69
+	.byte	0
+.LVUS182:
+	.uleb128 .LVU346
+	.uleb128 .LVU349
+.LLST182:
+	.byte	0x4
+	.uleb128 .LVL53-.Ltext0
+	.uleb128 .LVL54-.Ltext0
+	.uleb128 0x3
+	.byte	0x8
+	.byte	0xe1
+	.byte	0x9f
+	.byte	0
+.LVUS183:
+	.uleb128 .LVU346
+	.uleb128 .LVU349
+.LLST183:
+	.byte	0x4
+	.uleb128 .LVL53-.Ltext0
+	.uleb128 .LVL54-.Ltext0
+	.uleb128 0x1
+	.byte	0x64
+	.byte	0
+.LVUS185:
+	.uleb128 .LVU365
+	.uleb128 .LVU370
+.LLST185:
+	.byte	0x4
+	.uleb128 .LVL55-.Ltext0
+	.uleb128 .LVL57-.Ltext0
+	.uleb128 0x3
+	.byte	0x8
+	.byte	0xc0
+	.byte	0x9f
+	.byte	0
+.LVUS186:
+	.uleb128 .LVU365
+	.uleb128 .LVU370
+.LLST186:
+	.byte	0x4
+	.uleb128 .LVL55-.Ltext0
+	.uleb128 .LVL57-.Ltext0
+	.uleb128 0x1
+	.byte	0x6f
+	.byte	0
+.LVUS187:
+	.uleb128 .LVU365
+	.uleb128 .LVU370
+.LLST187:
+	.byte	0x4
+	.uleb128 .LVL55-.Ltext0
+	.uleb128 .LVL57-.Ltext0
+	.uleb128 0x1
+	.byte	0x68
+	.byte	0
+.LVUS189:
+	.uleb128 .LVU402
+	.uleb128 .LVU404
+.LLST189:
+	.byte	0x4
+	.uleb128 .LVL61-.Ltext0
+	.uleb128 .LVL61-.Ltext0
+	.uleb128 0x1
+	.byte	0x6a
+	.byte	0
+.LVUS191:
+	.uleb128 .LVU374
+	.uleb128 .LVU379
+.LLST191:
+	.byte	0x4
+	.uleb128 .LVL57-.Ltext0
+	.uleb128 .LVL58-.Ltext0
+	.uleb128 0x3
+	.byte	0x8
+	.byte	0xcc
+	.byte	0x9f
+	.byte	0
+.LVUS192:
+	.uleb128 .LVU374
+	.uleb128 .LVU379
+.LLST192:
+	.byte	0x4
+	.uleb128 .LVL57-.Ltext0
+	.uleb128 .LVL58-.Ltext0
+	.uleb128 0x1
+	.byte	0x6d
+	.byte	0
+.LVUS193:
+	.uleb128 .LVU374
+	.uleb128 .LVU379
+.LLST193:
+	.byte	0x4
+	.uleb128 .LVL57-.Ltext0
+	.uleb128 .LVL58-.Ltext0
+	.uleb128 0x1
+	.byte	0x67
+	.byte	0
+.LVUS195:
+	.uleb128 .LVU381
+	.uleb128 .LVU384
+.LLST195:
+	.byte	0x4
+	.uleb128 .LVL58-.Ltext0
+	.uleb128 .LVL59-.Ltext0
+	.uleb128 0x3
+	.byte	0x8
+	.byte	0xf4
+	.byte	0x9f
+	.byte	0
+.LVUS196:
+	.uleb128 .LVU381
+	.uleb128 .LVU384
+.LLST196:
+	.byte	0x4
+	.uleb128 .LVL58-.Ltext0
+	.uleb128 .LVL59-.Ltext0
+	.uleb128 0x1
+	.byte	0x65
+	.byte	0
+.LVUS198:
+	.uleb128 .LVU386
+	.uleb128 .LVU391
+.LLST198:
+	.byte	0x4
+	.uleb128 .LVL59-.Ltext0
+	.uleb128 .LVL61-.Ltext0
+	.uleb128 0x3
+	.byte	0x8
+	.byte	0x30
+	.byte	0x9f
+	.byte	0
+.LVUS199:
+	.uleb128 .LVU386
+	.uleb128 .LVU391
+.LLST199:
+	.byte	0x4
+	.uleb128 .LVL59-.Ltext0
+	.uleb128 .LVL61-.Ltext0
+	.uleb128 0x1
+	.byte	0x6d
+	.byte	0
+.LVUS200:
+	.uleb128 .LVU386
+	.uleb128 .LVU391
+.LLST200:
+	.byte	0x4
+	.uleb128 .LVL59-.Ltext0
+	.uleb128 .LVL61-.Ltext0
+	.uleb128 0x1
+	.byte	0x6f
+	.byte	0
+.LVUS202:
+	.uleb128 .LVU409
+	.uleb128 .LVU411
+.LLST202:
+	.byte	0x4
+	.uleb128 .LVL61-.Ltext0
+	.uleb128 .LVL61-.Ltext0
+	.uleb128 0x1
+	.byte	0x62
+	.byte	0
+.LVUS203:
+	.uleb128 .LVU395
+	.uleb128 .LVU397
+.LLST203:
+	.byte	0x4
+	.uleb128 .LVL61-.Ltext0
+	.uleb128 .LVL61-.Ltext0
+	.uleb128 0x1
+	.byte	0x61
+	.byte	0
+.LVUS204:
+	.uleb128 .LVU395
+	.uleb128 .LVU397
+.LLST204:
+	.byte	0x4
+	.uleb128 .LVL61-.Ltext0
+	.uleb128 .LVL61-.Ltext0
+	.uleb128 0x2
+	.byte	0x90
+	.uleb128 0x20
+	.byte	0
+.LVUS206:
+	.uleb128 .LVU413
+	.uleb128 .LVU415
+.LLST206:
+	.byte	0x4
+	.uleb128 .LVL61-.Ltext0
+	.uleb128 .LVL61-.Ltext0
+	.uleb128 0x1
+	.byte	0x63
+	.byte	0
+.LVUS207:
+	.uleb128 .LVU413
+	.uleb128 .LVU415
+.LLST207:
+	.byte	0x4
+	.uleb128 .LVL61-.Ltext0
+	.uleb128 .LVL61-.Ltext0
+	.uleb128 0x1
+	.byte	0x61
+	.byte	0
+.LVUS209:
+	.uleb128 .LVU415
+	.uleb128 .LVU424
+.LLST209:
+	.byte	0x4
+	.uleb128 .LVL61-.Ltext0
+	.uleb128 .LVL64-.Ltext0
+	.uleb128 0x2
+	.byte	0x44
+	.byte	0x9f
+	.byte	0
+.LVUS210:
+	.uleb128 .LVU419
+	.uleb128 .LVU422
+.LLST210:
+	.byte	0x4
+	.uleb128 .LVL62-.Ltext0
+	.uleb128 .LVL63-.Ltext0
+	.uleb128 0x1
+	.byte	0x61
+	.byte	0
+.LVUS212:
+	.uleb128 .LVU424
+	.uleb128 .LVU427
+.LLST212:
+	.byte	0x4
+	.uleb128 .LVL64-.Ltext0
+	.uleb128 .LVL64-.Ltext0
+	.uleb128 0x2
+	.byte	0x3c
+	.byte	0x9f
+	.byte	0
+.LVUS213:
+	.uleb128 .LVU427
+	.uleb128 .LVU431
+.LLST213:
+	.byte	0x4
+	.uleb128 .LVL64-.Ltext0
+	.uleb128 .LVL65-.Ltext0
+	.uleb128 0x2
+	.byte	0x90
+	.uleb128 0x20
+	.byte	0
+.LVUS214:
+	.uleb128 .LVU427
+	.uleb128 .LVU431
+.LLST214:
+	.byte	0x4
+	.uleb128 .LVL64-.Ltext0
+	.uleb128 .LVL65-.Ltext0
+	.uleb128 0x1
+	.byte	0x61
+	.byte	0
+.LVUS215:
+	.uleb128 .LVU433
+	.uleb128 .LVU435
+.LLST215:
+	.byte	0x4
+	.uleb128 .LVL65-.Ltext0
+	.uleb128 .LVL65-.Ltext0
+	.uleb128 0x1
+	.byte	0x61
+	.byte	0
+.LVUS216:
+	.uleb128 .LVU433
+	.uleb128 .LVU435
+.LLST216:
+	.byte	0x4
+	.uleb128 .LVL65-.Ltext0
+	.uleb128 .LVL65-.Ltext0
+	.uleb128 0x1
+	.byte	0x6a
+	.byte	0
+.LVUS217:
+	.uleb128 .LVU435
+	.uleb128 .LVU439
+.LLST217:
+	.byte	0x4
+	.uleb128 .LVL65-.Ltext0
+	.uleb128 .LVL66-.Ltext0
+	.uleb128 0x1
+	.byte	0x69
+	.byte	0
+.LVUS219:
+	.uleb128 .LVU442
+	.uleb128 .LVU444
+.LLST219:
+	.byte	0x4
+	.uleb128 .LVL67-.Ltext0
+	.uleb128 .LVL67-.Ltext0
+	.uleb128 0x1
+	.byte	0x69
+	.byte	0
+.LVUS220:
+	.uleb128 .LVU442
+	.uleb128 .LVU444
+.LLST220:
+	.byte	0x4
+	.uleb128 .LVL67-.Ltext0
+	.uleb128 .LVL67-.Ltext0
+	.uleb128 0x1
+	.byte	0x62
+	.byte	0
+.LVUS222:
+	.uleb128 .LVU448
+	.uleb128 .LVU450
+.LLST222:
+	.byte	0x4
+	.uleb128 .LVL68-.Ltext0
+	.uleb128 .LVL69-.Ltext0
+	.uleb128 0x1
+	.byte	0x62
+	.byte	0
+.LVUS223:
+	.uleb128 .LVU452
+	.uleb128 .LVU455
+.LLST223:
+	.byte	0x4
+	.uleb128 .LVL69-.Ltext0
+	.uleb128 .LVL70-.Ltext0
+	.uleb128 0x1
+	.byte	0x62
+	.byte	0
+.LVUS224:
+	.uleb128 .LVU452
+	.uleb128 .LVU455
+.LLST224:
+	.byte	0x4
+	.uleb128 .LVL69-.Ltext0
+	.uleb128 .LVL70-.Ltext0
+	.uleb128 0x1
+	.byte	0x63
+	.byte	0
+.LVUS226:
+	.uleb128 .LVU457
+	.uleb128 .LVU459
+.LLST226:
+	.byte	0x4
+	.uleb128 .LVL70-.Ltext0
+	.uleb128 .LVL70-.Ltext0
+	.uleb128 0x1
+	.byte	0x63
+	.byte	0
+.LVUS227:
+	.uleb128 .LVU457
+	.uleb128 .LVU459
+.LLST227:
+	.byte	0x4
+	.uleb128 .LVL70-.Ltext0
+	.uleb128 .LVL70-.Ltext0
+	.uleb128 0x1
+	.byte	0x61
+	.byte	0
+.LVUS229:
+	.uleb128 .LVU459
+	.uleb128 .LVU472
+.LLST229:
+	.byte	0x4
+	.uleb128 .LVL70-.Ltext0
+	.uleb128 .LVL75-.Ltext0
+	.uleb128 0x2
+	.byte	0x49
+	.byte	0x9f
+	.byte	0
+.LVUS230:
+	.uleb128 .LVU465
+	.uleb128 .LVU470
+.LLST230:
+	.byte	0x4
+	.uleb128 .LVL72-.Ltext0
+	.uleb128 .LVL74-.Ltext0
+	.uleb128 0x1
+	.byte	0x61
+	.byte	0
+.LVUS232:
+	.uleb128 .LVU492
+	.uleb128 .LVU494
+.LLST232:
+	.byte	0x4
+	.uleb128 .LVL77-.Ltext0
+	.uleb128 .LVL77-.Ltext0
+	.uleb128 0x3
+	.byte	0x8
+	.byte	0x93
+	.byte	0x9f
+	.byte	0
+.LVUS234:
+	.uleb128 .LVU488
+	.uleb128 .LVU490
+.LLST234:
+	.byte	0x4
+	.uleb128 .LVL77-.Ltext0
+	.uleb128 .LVL77-.Ltext0
+	.uleb128 0x3
+	.byte	0x8
+	.byte	0x4e
+	.byte	0x9f
+	.byte	0
+.LVUS236:
+	.uleb128 .LVU472
+	.uleb128 .LVU475
+.LLST236:
+	.byte	0x4
+	.uleb128 .LVL75-.Ltext0
+	.uleb128 .LVL75-.Ltext0
+	.uleb128 0x2
+	.byte	0x37
+	.byte	0x9f
+	.byte	0
+.LVUS238:
+	.uleb128 .LVU475
+	.uleb128 .LVU478
+.LLST238:
+	.byte	0x4
+	.uleb128 .LVL75-.Ltext0
+	.uleb128 .LVL75-.Ltext0
+	.uleb128 0x1
+	.byte	0x6a
+	.byte	0
+.LVUS239:
+	.uleb128 .LVU475
+	.uleb128 .LVU478
+.LLST239:
+	.byte	0x4
+	.uleb128 .LVL75-.Ltext0
+	.uleb128 .LVL75-.Ltext0
+	.uleb128 0x1
+	.byte	0x61
+	.byte	0
+.LVUS241:
+	.uleb128 .LVU481
+	.uleb128 .LVU486
+.LLST241:
+	.byte	0x4
+	.uleb128 .LVL75-.Ltext0
+	.uleb128 .LVL77-.Ltext0
+	.uleb128 0x3
+	.byte	0x8
+	.byte	0x39
+	.byte	0x9f
+	.byte	0
+.LVUS242:
+	.uleb128 .LVU484
+	.uleb128 .LVU486
+.LLST242:
+	.byte	0x4
+	.uleb128 .LVL76-.Ltext0
+	.uleb128 .LVL77-.Ltext0
+	.uleb128 0x1
+	.byte	0x61
+	.byte	0
+.LVUS243:
+	.uleb128 .LVU497
+	.uleb128 .LVU499
+.LLST243:
+	.byte	0x4
+	.uleb128 .LVL77-.Ltext0
+	.uleb128 .LVL77-.Ltext0
+	.uleb128 0x1
+	.byte	0x61
+	.byte	0
+.LVUS244:
+	.uleb128 .LVU497
+	.uleb128 .LVU499
+.LLST244:
+	.byte	0x4
+	.uleb128 .LVL77-.Ltext0
+	.uleb128 .LVL77-.Ltext0
+	.uleb128 0x1
+	.byte	0x69
+	.byte	0
+.LVUS245:
+	.uleb128 .LVU499
+	.uleb128 .LVU503
+.LLST245:
+	.byte	0x4
+	.uleb128 .LVL77-.Ltext0
+	.uleb128 .LVL78-.Ltext0
+	.uleb128 0x1
+	.byte	0x68
+	.byte	0
+.LVUS247:
+	.uleb128 .LVU506
+	.uleb128 .LVU508
+.LLST247:
+	.byte	0x4
+	.uleb128 .LVL79-.Ltext0
+	.uleb128 .LVL79-.Ltext0
+	.uleb128 0x1
+	.byte	0x68
+	.byte	0
+.LVUS248:
+	.uleb128 .LVU506
+	.uleb128 .LVU508
+.LLST248:
+	.byte	0x4
+	.uleb128 .LVL79-.Ltext0
+	.uleb128 .LVL79-.Ltext0
+	.uleb128 0x1
+	.byte	0x62
+	.byte	0
+.LVUS250:
+	.uleb128 .LVU512
+	.uleb128 .LVU514
+.LLST250:
+	.byte	0x4
+	.uleb128 .LVL80-.Ltext0
+	.uleb128 .LVL81-.Ltext0
+	.uleb128 0x1
+	.byte	0x62
+	.byte	0
+.LVUS251:
+	.uleb128 .LVU516
+	.uleb128 .LVU519
+.LLST251:
+	.byte	0x4
+	.uleb128 .LVL81-.Ltext0
+	.uleb128 .LVL82-.Ltext0
+	.uleb128 0x1
+	.byte	0x62
+	.byte	0
+.LVUS252:
+	.uleb128 .LVU516
+	.uleb128 .LVU519
+.LLST252:
+	.byte	0x4
+	.uleb128 .LVL81-.Ltext0
+	.uleb128 .LVL82-.Ltext0
+	.uleb128 0x1
+	.byte	0x63
+	.byte	0
+.LVUS254:
+	.uleb128 .LVU521
+	.uleb128 .LVU523
+.LLST254:
+	.byte	0x4
+	.uleb128 .LVL82-.Ltext0
+	.uleb128 .LVL82-.Ltext0
+	.uleb128 0x1
+	.byte	0x63
+	.byte	0
+.LVUS255:
+	.uleb128 .LVU521
+	.uleb128 .LVU523
+.LLST255:
+	.byte	0x4
+	.uleb128 .LVL82-.Ltext0
+	.uleb128 .LVL82-.Ltext0
+	.uleb128 0x1
+	.byte	0x61
+	.byte	0
+.LVUS257:
+	.uleb128 .LVU523
+	.uleb128 .LVU532
+.LLST257:
+	.byte	0x4
+	.uleb128 .LVL82-.Ltext0
+	.uleb128 .LVL85-.Ltext0
+	.uleb128 0x2
+	.byte	0x44
+	.byte	0x9f
+	.byte	0
+.LVUS258:
+	.uleb128 .LVU527
+	.uleb128 .LVU530
+.LLST258:
+	.byte	0x4
+	.uleb128 .LVL83-.Ltext0
+	.uleb128 .LVL84-.Ltext0
+	.uleb128 0x1
+	.byte	0x61
+	.byte	0
+.LVUS260:
+	.uleb128 .LVU532
+	.uleb128 .LVU535
+.LLST260:
+	.byte	0x4
+	.uleb128 .LVL85-.Ltext0
+	.uleb128 .LVL85-.Ltext0
+	.uleb128 0x2
+	.byte	0x3c
+	.byte	0x9f
+	.byte	0
+.LVUS261:
+	.uleb128 .LVU535
+	.uleb128 .LVU539
+.LLST261:
+	.byte	0x4
+	.uleb128 .LVL85-.Ltext0
+	.uleb128 .LVL86-.Ltext0
+	.uleb128 0x1
+	.byte	0x69
+	.byte	0
+.LVUS262:
+	.uleb128 .LVU535
+	.uleb128 .LVU539
+.LLST262:
+	.byte	0x4
+	.uleb128 .LVL85-.Ltext0
+	.uleb128 .LVL86-.Ltext0
+	.uleb128 0x1
+	.byte	0x61
+	.byte	0
+.LVUS263:
+	.uleb128 .LVU541
+	.uleb128 .LVU543
+.LLST263:
+	.byte	0x4
+	.uleb128 .LVL86-.Ltext0
+	.uleb128 .LVL86-.Ltext0
+	.uleb128 0x1
+	.byte	0x61
+	.byte	0
+.LVUS264:
+	.uleb128 .LVU541
+	.uleb128 .LVU543
+.LLST264:
+	.byte	0x4
+	.uleb128 .LVL86-.Ltext0
+	.uleb128 .LVL86-.Ltext0
+	.uleb128 0x1
+	.byte	0x68
+	.byte	0
+.LVUS266:
+	.uleb128 .LVU543
+	.uleb128 .LVU548
+.LLST266:
+	.byte	0x4
+	.uleb128 .LVL86-.Ltext0
+	.uleb128 .LVL87-.Ltext0
+	.uleb128 0x1
+	.byte	0x6f
+	.byte	0
+.LVUS268:
+	.uleb128 .LVU632
+	.uleb128 .LVU634
+.LLST268:
+	.byte	0x4
+	.uleb128 .LVL100-.Ltext0
+	.uleb128 .LVL100-.Ltext0
+	.uleb128 0x3
+	.byte	0x8
+	.byte	0xe0
+	.byte	0x9f
+	.byte	0
+.LVUS269:
+	.uleb128 .LVU632
+	.uleb128 .LVU634
+.LLST269:
+	.byte	0x4
+	.uleb128 .LVL100-.Ltext0
+	.uleb128 .LVL100-.Ltext0
+	.uleb128 0x1
+	.byte	0x64
+	.byte	0
+.LVUS271:
+	.uleb128 .LVU551
+	.uleb128 .LVU553
+.LLST271:
+	.byte	0x4
+	.uleb128 .LVL88-.Ltext0
+	.uleb128 .LVL88-.Ltext0
+	.uleb128 0x1
+	.byte	0x6f
+	.byte	0
+.LVUS272:
+	.uleb128 .LVU551
+	.uleb128 .LVU553
+.LLST272:
+	.byte	0x4
+	.uleb128 .LVL88-.Ltext0
+	.uleb128 .LVL88-.Ltext0
+	.uleb128 0x1
+	.byte	0x62
+	.byte	0
+.LVUS274:
+	.uleb128 .LVU558
+	.uleb128 .LVU560
+.LLST274:
+	.byte	0x4
+	.uleb128 .LVL89-.Ltext0
+	.uleb128 .LVL90-.Ltext0
+	.uleb128 0x1
+	.byte	0x62
+	.byte	0
+.LVUS276:
+	.uleb128 .LVU615
+	.uleb128 .LVU617
+.LLST276:
+	.byte	0x4
+	.uleb128 .LVL98-.Ltext0
+	.uleb128 .LVL98-.Ltext0
+	.uleb128 0x3
+	.byte	0x8
+	.byte	0xe0
+	.byte	0x9f
+	.byte	0
+.LVUS277:
+	.uleb128 .LVU615
+	.uleb128 .LVU617
+.LLST277:
+	.byte	0x4
+	.uleb128 .LVL98-.Ltext0
+	.uleb128 .LVL98-.Ltext0
+	.uleb128 0x1
+	.byte	0x67
+	.byte	0
+.LVUS278:
+	.uleb128 .LVU562
+	.uleb128 .LVU565
+.LLST278:
+	.byte	0x4
+	.uleb128 .LVL90-.Ltext0
+	.uleb128 .LVL91-.Ltext0
+	.uleb128 0x1
+	.byte	0x62
+	.byte	0
+.LVUS279:
+	.uleb128 .LVU562
+	.uleb128 .LVU565
+.LLST279:
+	.byte	0x4
+	.uleb128 .LVL90-.Ltext0
+	.uleb128 .LVL91-.Ltext0
+	.uleb128 0x1
+	.byte	0x63
+	.byte	0
+.LVUS281:
+	.uleb128 .LVU567
+	.uleb128 .LVU569
+.LLST281:
+	.byte	0x4
+	.uleb128 .LVL91-.Ltext0
+	.uleb128 .LVL91-.Ltext0
+	.uleb128 0x1
+	.byte	0x63
+	.byte	0
+.LVUS282:
+	.uleb128 .LVU567
+	.uleb128 .LVU569
+.LLST282:
+	.byte	0x4
+	.uleb128 .LVL91-.Ltext0
+	.uleb128 .LVL91-.Ltext0
+	.uleb128 0x1
+	.byte	0x61
+	.byte	0
+.LVUS284:
+	.uleb128 .LVU569
+	.uleb128 .LVU582
+.LLST284:
+	.byte	0x4
+	.uleb128 .LVL91-.Ltext0
+	.uleb128 .LVL96-.Ltext0
+	.uleb128 0x2
+	.byte	0x49
+	.byte	0x9f
+	.byte	0
+.LVUS285:
+	.uleb128 .LVU575
+	.uleb128 .LVU580
+.LLST285:
+	.byte	0x4
+	.uleb128 .LVL93-.Ltext0
+	.uleb128 .LVL95-.Ltext0
+	.uleb128 0x1
+	.byte	0x61
+	.byte	0
+.LVUS287:
+	.uleb128 .LVU604
+	.uleb128 .LVU606
+.LLST287:
+	.byte	0x4
+	.uleb128 .LVL98-.Ltext0
+	.uleb128 .LVL98-.Ltext0
+	.uleb128 0x3
+	.byte	0x8
+	.byte	0x39
+	.byte	0x9f
+	.byte	0
+.LVUS289:
+	.uleb128 .LVU600
+	.uleb128 .LVU602
+.LLST289:
+	.byte	0x4
+	.uleb128 .LVL98-.Ltext0
+	.uleb128 .LVL98-.Ltext0
+	.uleb128 0x3
+	.byte	0x8
+	.byte	0x4e
+	.byte	0x9f
+	.byte	0
+.LVUS291:
+	.uleb128 .LVU582
+	.uleb128 .LVU585
+.LLST291:
+	.byte	0x4
+	.uleb128 .LVL96-.Ltext0
+	.uleb128 .LVL96-.Ltext0
+	.uleb128 0x2
+	.byte	0x37
+	.byte	0x9f
+	.byte	0
+.LVUS293:
+	.uleb128 .LVU585
+	.uleb128 .LVU588
+.LLST293:
+	.byte	0x4
+	.uleb128 .LVL96-.Ltext0
+	.uleb128 .LVL96-.Ltext0
+	.uleb128 0x2
+	.byte	0x90
+	.uleb128 0x20
+	.byte	0
+.LVUS294:
+	.uleb128 .LVU585
+	.uleb128 .LVU588
+.LLST294:
+	.byte	0x4
+	.uleb128 .LVL96-.Ltext0
+	.uleb128 .LVL96-.Ltext0
+	.uleb128 0x1
+	.byte	0x61
+	.byte	0
+.LVUS296:
+	.uleb128 .LVU591
+	.uleb128 .LVU598
+.LLST296:
+	.byte	0x4
+	.uleb128 .LVL96-.Ltext0
+	.uleb128 .LVL98-.Ltext0
+	.uleb128 0x3
+	.byte	0x8
+	.byte	0x93
+	.byte	0x9f
+	.byte	0
+.LVUS297:
+	.uleb128 .LVU594
+	.uleb128 .LVU598
+.LLST297:
+	.byte	0x4
+	.uleb128 .LVL97-.Ltext0
+	.uleb128 .LVL98-.Ltext0
+	.uleb128 0x1
+	.byte	0x61
+	.byte	0
+.LVUS299:
+	.uleb128 .LVU611
+	.uleb128 .LVU613
+.LLST299:
+	.byte	0x4
+	.uleb128 .LVL98-.Ltext0
+	.uleb128 .LVL98-.Ltext0
+	.uleb128 0x3
+	.byte	0x8
+	.byte	0xe7
+	.byte	0x9f
+	.byte	0
+.LVUS300:
+	.uleb128 .LVU611
+	.uleb128 .LVU613
+.LLST300:
+	.byte	0x4
+	.uleb128 .LVL98-.Ltext0
+	.uleb128 .LVL98-.Ltext0
+	.uleb128 0x1
+	.byte	0x66
+	.byte	0
+.LVUS302:
+	.uleb128 .LVU619
+	.uleb128 .LVU622
+.LLST302:
+	.byte	0x4
+	.uleb128 .LVL98-.Ltext0
+	.uleb128 .LVL99-.Ltext0
+	.uleb128 0x3
+	.byte	0x8
+	.byte	0xcc
+	.byte	0x9f
+	.byte	0
+.LVUS303:
+	.uleb128 .LVU619
+	.uleb128 .LVU622
+.LLST303:
+	.byte	0x4
+	.uleb128 .LVL98-.Ltext0
+	.uleb128 .LVL99-.Ltext0
+	.uleb128 0x1
+	.byte	0x68
+	.byte	0
+.LVUS304:
+	.uleb128 .LVU619
+	.uleb128 .LVU622
+.LLST304:
+	.byte	0x4
+	.uleb128 .LVL98-.Ltext0
+	.uleb128 .LVL99-.Ltext0
+	.uleb128 0x2
+	.byte	0x90
+	.uleb128 0x20
+	.byte	0
+.LVUS306:
+	.uleb128 .LVU625
+	.uleb128 .LVU629
+.LLST306:
+	.byte	0x4
+	.uleb128 .LVL99-.Ltext0
+	.uleb128 .LVL100-.Ltext0
+	.uleb128 0x3
+	.byte	0x8
+	.byte	0x30
+	.byte	0x9f
+	.byte	0
+.LVUS307:
+	.uleb128 .LVU625
+	.uleb128 .LVU629
+.LLST307:
+	.byte	0x4
+	.uleb128 .LVL99-.Ltext0
+	.uleb128 .LVL100-.Ltext0
+	.uleb128 0x1
+	.byte	0x6e
+	.byte	0
+.LVUS308:
+	.uleb128 .LVU625
+	.uleb128 .LVU629
+.LLST308:
+	.byte	0x4
+	.uleb128 .LVL99-.Ltext0
+	.uleb128 .LVL100-.Ltext0
+	.uleb128 0x2
+	.byte	0x90
+	.uleb128 0x20
+	.byte	0
+.LVUS310:
+	.uleb128 .LVU685
+	.uleb128 .LVU687
+.LLST310:
+	.byte	0x4
+	.uleb128 .LVL110-.Ltext0
+	.uleb128 .LVL110-.Ltext0
+	.uleb128 0x3
+	.byte	0x8
+	.byte	0xe6
+	.byte	0x9f
+	.byte	0
+.LVUS311:
+	.uleb128 .LVU685
+	.uleb128 .LVU687
+.LLST311:
+	.byte	0x4
+	.uleb128 .LVL110-.Ltext0
+	.uleb128 .LVL110-.Ltext0
+	.uleb128 0x1
+	.byte	0x67
+	.byte	0
+.LVUS313:
+	.uleb128 .LVU636
+	.uleb128 .LVU644
+.LLST313:
+	.byte	0x4
+	.uleb128 .LVL100-.Ltext0
+	.uleb128 .LVL103-.Ltext0
+	.uleb128 0x3
+	.byte	0x8
+	.byte	0x3c
+	.byte	0x9f
+	.byte	0
+.LVUS314:
+	.uleb128 .LVU636
+	.uleb128 .LVU642
+.LLST314:
+	.byte	0x4
+	.uleb128 .LVL100-.Ltext0
+	.uleb128 .LVL102-.Ltext0
+	.uleb128 0x1
+	.byte	0x69
+	.byte	0
+.LVUS315:
+	.uleb128 .LVU636
+	.uleb128 .LVU644
+.LLST315:
+	.byte	0x4
+	.uleb128 .LVL100-.Ltext0
+	.uleb128 .LVL103-.Ltext0
+	.uleb128 0x1
+	.byte	0x66
+	.byte	0
+.LVUS318:
+	.uleb128 .LVU646
+	.uleb128 .LVU648
+.LLST318:
+	.byte	0x4
+	.uleb128 .LVL103-.Ltext0
+	.uleb128 .LVL103-.Ltext0
+	.uleb128 0x3
+	.byte	0x8
+	.byte	0x64
+	.byte	0x9f
+	.byte	0
+.LVUS319:
+	.uleb128 .LVU646
+	.uleb128 .LVU648
+.LLST319:
+	.byte	0x4
+	.uleb128 .LVL103-.Ltext0
+	.uleb128 .LVL103-.Ltext0
+	.uleb128 0x1
+	.byte	0x67
+	.byte	0
+.LVUS321:
+	.uleb128 .LVU650
+	.uleb128 .LVU655
+.LLST321:
+	.byte	0x4
+	.uleb128 .LVL103-.Ltext0
+	.uleb128 .LVL104-.Ltext0
+	.uleb128 0x3
+	.byte	0x8
+	.byte	0xc0
+	.byte	0x9f
+	.byte	0
+.LVUS322:
+	.uleb128 .LVU650
+	.uleb128 .LVU655
+.LLST322:
+	.byte	0x4
+	.uleb128 .LVL103-.Ltext0
+	.uleb128 .LVL104-.Ltext0
+	.uleb128 0x1
+	.byte	0x69
+	.byte	0
+.LVUS323:
+	.uleb128 .LVU650
+	.uleb128 .LVU655
+.LLST323:
+	.byte	0x4
+	.uleb128 .LVL103-.Ltext0
+	.uleb128 .LVL104-.Ltext0
+	.uleb128 0x1
+	.byte	0x68
+	.byte	0
+.LVUS325:
+	.uleb128 .LVU657
+	.uleb128 .LVU659
+.LLST325:
+	.byte	0x4
+	.uleb128 .LVL104-.Ltext0
+	.uleb128 .LVL104-.Ltext0
+	.uleb128 0x3
+	.byte	0x8
+	.byte	0x66
+	.byte	0x9f
+	.byte	0
+.LVUS326:
+	.uleb128 .LVU657
+	.uleb128 .LVU659
+.LLST326:
+	.byte	0x4
+	.uleb128 .LVL104-.Ltext0
+	.uleb128 .LVL104-.Ltext0
+	.uleb128 0x1
+	.byte	0x66
+	.byte	0
+.LVUS327:
+	.uleb128 .LVU661
+	.uleb128 .LVU664
+.LLST327:
+	.byte	0x4
+	.uleb128 .LVL104-.Ltext0
+	.uleb128 .LVL105-.Ltext0
+	.uleb128 0x3
+	.byte	0x8
+	.byte	0xec
+	.byte	0x9f
+	.byte	0
+.LVUS328:
+	.uleb128 .LVU661
+	.uleb128 .LVU664
+.LLST328:
+	.byte	0x4
+	.uleb128 .LVL104-.Ltext0
+	.uleb128 .LVL105-.Ltext0
+	.uleb128 0x1
+	.byte	0x64
+	.byte	0
+.LVUS330:
+	.uleb128 .LVU666
+	.uleb128 .LVU675
+.LLST330:
+	.byte	0x4
+	.uleb128 .LVL105-.Ltext0
+	.uleb128 .LVL108-.Ltext0
+	.uleb128 0x2
+	.byte	0x3c
+	.byte	0x9f
+	.byte	0
+.LVUS331:
+	.uleb128 .LVU666
+	.uleb128 .LVU673
+.LLST331:
+	.byte	0x4
+	.uleb128 .LVL105-.Ltext0
+	.uleb128 .LVL107-.Ltext0
+	.uleb128 0x1
+	.byte	0x69
+	.byte	0
+.LVUS332:
+	.uleb128 .LVU666
+	.uleb128 .LVU675
+.LLST332:
+	.byte	0x4
+	.uleb128 .LVL105-.Ltext0
+	.uleb128 .LVL108-.Ltext0
+	.uleb128 0x1
+	.byte	0x6e
+	.byte	0
+.LVUS334:
+	.uleb128 .LVU724
+	.uleb128 .LVU726
+.LLST334:
+	.byte	0x4
+	.uleb128 .LVL115-.Ltext0
+	.uleb128 .LVL115-.Ltext0
+	.uleb128 0x2
+	.byte	0x90
+	.uleb128 0x20
+	.byte	0
+.LVUS337:
+	.uleb128 .LVU689
+	.uleb128 .LVU691
+.LLST337:
+	.byte	0x4
+	.uleb128 .LVL110-.Ltext0
+	.uleb128 .LVL110-.Ltext0
+	.uleb128 0x3
+	.byte	0x8
+	.byte	0x28
+	.byte	0x9f
+	.byte	0
+.LVUS338:
+	.uleb128 .LVU689
+	.uleb128 .LVU691
+.LLST338:
+	.byte	0x4
+	.uleb128 .LVL110-.Ltext0
+	.uleb128 .LVL110-.Ltext0
+	.uleb128 0x1
+	.byte	0x65
+	.byte	0
+.LVUS340:
+	.uleb128 .LVU678
+	.uleb128 .LVU683
+.LLST340:
+	.byte	0x4
+	.uleb128 .LVL108-.Ltext0
+	.uleb128 .LVL110-.Ltext0
+	.uleb128 0x3
+	.byte	0x8
+	.byte	0x30
+	.byte	0x9f
+	.byte	0
+.LVUS341:
+	.uleb128 .LVU678
+	.uleb128 .LVU683
+.LLST341:
+	.byte	0x4
+	.uleb128 .LVL108-.Ltext0
+	.uleb128 .LVL110-.Ltext0
+	.uleb128 0x1
+	.byte	0x6d
+	.byte	0
+.LVUS342:
+	.uleb128 .LVU678
+	.uleb128 .LVU683
+.LLST342:
+	.byte	0x4
+	.uleb128 .LVL108-.Ltext0
+	.uleb128 .LVL110-.Ltext0
+	.uleb128 0x1
+	.byte	0x6e
+	.byte	0
+.LVUS344:
+	.uleb128 .LVU731
+	.uleb128 .LVU733
+.LLST344:
+	.byte	0x4
+	.uleb128 .LVL115-.Ltext0
+	.uleb128 .LVL115-.Ltext0
+	.uleb128 0x1
+	.byte	0x62
+	.byte	0
+.LVUS346:
+	.uleb128 .LVU693
+	.uleb128 .LVU699
+.LLST346:
+	.byte	0x4
+	.uleb128 .LVL110-.Ltext0
+	.uleb128 .LVL112-.Ltext0
+	.uleb128 0x3
+	.byte	0x8
+	.byte	0xcc
+	.byte	0x9f
+	.byte	0
+.LVUS347:
+	.uleb128 .LVU693
+	.uleb128 .LVU699
+.LLST347:
+	.byte	0x4
+	.uleb128 .LVL110-.Ltext0
+	.uleb128 .LVL112-.Ltext0
+	.uleb128 0x1
+	.byte	0x69
+	.byte	0
+.LVUS348:
+	.uleb128 .LVU693
+	.uleb128 .LVU699
+.LLST348:
+	.byte	0x4
+	.uleb128 .LVL110-.Ltext0
+	.uleb128 .LVL112-.Ltext0
+	.uleb128 0x1
+	.byte	0x6a
+	.byte	0
+.LVUS350:
+	.uleb128 .LVU735
+	.uleb128 .LVU737
+.LLST350:
+	.byte	0x4
+	.uleb128 .LVL115-.Ltext0
+	.uleb128 .LVL115-.Ltext0
+	.uleb128 0x1
+	.byte	0x63
+	.byte	0
+.LVUS351:
+	.uleb128 .LVU701
+	.uleb128 .LVU704
+.LLST351:
+	.byte	0x4
+	.uleb128 .LVL112-.Ltext0
+	.uleb128 .LVL113-.Ltext0
+	.uleb128 0x3
+	.byte	0x8
+	.byte	0xd4
+	.byte	0x9f
+	.byte	0
+.LVUS352:
+	.uleb128 .LVU701
+	.uleb128 .LVU704
+.LLST352:
+	.byte	0x4
+	.uleb128 .LVL112-.Ltext0
+	.uleb128 .LVL113-.Ltext0
+	.uleb128 0x1
+	.byte	0x64
+	.byte	0
+.LVUS354:
+	.uleb128 .LVU706
+	.uleb128 .LVU713
+.LLST354:
+	.byte	0x4
+	.uleb128 .LVL113-.Ltext0
+	.uleb128 .LVL115-.Ltext0
+	.uleb128 0x3
+	.byte	0x8
+	.byte	0x30
+	.byte	0x9f
+	.byte	0
+.LVUS355:
+	.uleb128 .LVU706
+	.uleb128 .LVU710
+.LLST355:
+	.byte	0x4
+	.uleb128 .LVL113-.Ltext0
+	.uleb128 .LVL114-.Ltext0
+	.uleb128 0x1
+	.byte	0x69
+	.byte	0
+.LVUS356:
+	.uleb128 .LVU706
+	.uleb128 .LVU713
+.LLST356:
+	.byte	0x4
+	.uleb128 .LVL113-.Ltext0
+	.uleb128 .LVL115-.Ltext0
+	.uleb128 0x1
+	.byte	0x6d
+	.byte	0
+.LVUS358:
+	.uleb128 .LVU737
+	.uleb128 .LVU741
+.LLST358:
+	.byte	0x4
+	.uleb128 .LVL115-.Ltext0
+	.uleb128 .LVL116-.Ltext0
+	.uleb128 0x2
+	.byte	0x44
+	.byte	0x9f
+	.byte	0
+.LVUS360:
+	.uleb128 .LVU741
+	.uleb128 .LVU744
+.LLST360:
+	.byte	0x4
+	.uleb128 .LVL116-.Ltext0
+	.uleb128 .LVL116-.Ltext0
+	.uleb128 0x2
+	.byte	0x3c
+	.byte	0x9f
+	.byte	0
+.LVUS361:
+	.uleb128 .LVU717
+	.uleb128 .LVU719
+.LLST361:
+	.byte	0x4
+	.uleb128 .LVL115-.Ltext0
+	.uleb128 .LVL115-.Ltext0
+	.uleb128 0x1
+	.byte	0x6f
+	.byte	0
+.LVUS362:
+	.uleb128 .LVU744
+	.uleb128 .LVU748
+.LLST362:
+	.byte	0x4
+	.uleb128 .LVL116-.Ltext0
+	.uleb128 .LVL117-.Ltext0
+	.uleb128 0x1
+	.byte	0x69
+	.byte	0
+.LVUS363:
+	.uleb128 .LVU744
+	.uleb128 .LVU748
+.LLST363:
+	.byte	0x4
+	.uleb128 .LVL116-.Ltext0
+	.uleb128 .LVL117-.Ltext0
+	.uleb128 0x1
+	.byte	0x61
+	.byte	0
+.LVUS364:
+	.uleb128 .LVU750
+	.uleb128 .LVU752
+.LLST364:
+	.byte	0x4
+	.uleb128 .LVL117-.Ltext0
+	.uleb128 .LVL117-.Ltext0
+	.uleb128 0x1
+	.byte	0x61
+	.byte	0
+.LVUS365:
+	.uleb128 .LVU750
+	.uleb128 .LVU752
+.LLST365:
+	.byte	0x4
+	.uleb128 .LVL117-.Ltext0
+	.uleb128 .LVL117-.Ltext0
+	.uleb128 0x2
+	.byte	0x90
+	.uleb128 0x20
+	.byte	0
+.LVUS366:
+	.uleb128 .LVU752
+	.uleb128 .LVU756
+.LLST366:
+	.byte	0x4
+	.uleb128 .LVL117-.Ltext0
+	.uleb128 .LVL118-.Ltext0
+	.uleb128 0x1
+	.byte	0x68
+	.byte	0
+.LVUS368:
+	.uleb128 .LVU759
+	.uleb128 .LVU761
+.LLST368:
+	.byte	0x4
+	.uleb128 .LVL119-.Ltext0
+	.uleb128 .LVL119-.Ltext0
+	.uleb128 0x1
+	.byte	0x68
+	.byte	0
+.LVUS369:
+	.uleb128 .LVU759
+	.uleb128 .LVU761
+.LLST369:
+	.byte	0x4
+	.uleb128 .LVL119-.Ltext0
+	.uleb128 .LVL119-.Ltext0
+	.uleb128 0x1
+	.byte	0x62
+	.byte	0
+.LVUS371:
+	.uleb128 .LVU765
+	.uleb128 .LVU767
+.LLST371:
+	.byte	0x4
+	.uleb128 .LVL120-.Ltext0
+	.uleb128 .LVL121-.Ltext0
+	.uleb128 0x1
+	.byte	0x62
+	.byte	0
+.LVUS372:
+	.uleb128 .LVU769
+	.uleb128 .LVU772
+.LLST372:
+	.byte	0x4
+	.uleb128 .LVL121-.Ltext0
+	.uleb128 .LVL122-.Ltext0
+	.uleb128 0x1
+	.byte	0x62
+	.byte	0
+.LVUS373:
+	.uleb128 .LVU769
+	.uleb128 .LVU772
+.LLST373:
+	.byte	0x4
+	.uleb128 .LVL121-.Ltext0
+	.uleb128 .LVL122-.Ltext0
+	.uleb128 0x1
+	.byte	0x63
+	.byte	0
+.LVUS375:
+	.uleb128 .LVU774
+	.uleb128 .LVU776
+.LLST375:
+	.byte	0x4
+	.uleb128 .LVL122-.Ltext0
+	.uleb128 .LVL122-.Ltext0
+	.uleb128 0x1
+	.byte	0x63
+	.byte	0
+.LVUS376:
+	.uleb128 .LVU774
+	.uleb128 .LVU776
+.LLST376:
+	.byte	0x4
+	.uleb128 .LVL122-.Ltext0
+	.uleb128 .LVL122-.Ltext0
+	.uleb128 0x1
+	.byte	0x61
+	.byte	0
+.LVUS378:
+	.uleb128 .LVU776
+	.uleb128 .LVU789
+.LLST378:
+	.byte	0x4
+	.uleb128 .LVL122-.Ltext0
+	.uleb128 .LVL127-.Ltext0
+	.uleb128 0x2
+	.byte	0x49
+	.byte	0x9f
+	.byte	0
+.LVUS379:
+	.uleb128 .LVU782
+	.uleb128 .LVU787
+.LLST379:
+	.byte	0x4
+	.uleb128 .LVL124-.Ltext0
+	.uleb128 .LVL126-.Ltext0
+	.uleb128 0x1
+	.byte	0x61
+	.byte	0
+.LVUS381:
+	.uleb128 .LVU809
+	.uleb128 .LVU811
+.LLST381:
+	.byte	0x4
+	.uleb128 .LVL129-.Ltext0
+	.uleb128 .LVL129-.Ltext0
+	.uleb128 0x3
+	.byte	0x8
+	.byte	0x93
+	.byte	0x9f
+	.byte	0
+.LVUS383:
+	.uleb128 .LVU805
+	.uleb128 .LVU807
+.LLST383:
+	.byte	0x4
+	.uleb128 .LVL129-.Ltext0
+	.uleb128 .LVL129-.Ltext0
+	.uleb128 0x3
+	.byte	0x8
+	.byte	0x4e
+	.byte	0x9f
+	.byte	0
+.LVUS385:
+	.uleb128 .LVU789
+	.uleb128 .LVU792
+.LLST385:
+	.byte	0x4
+	.uleb128 .LVL127-.Ltext0
+	.uleb128 .LVL127-.Ltext0
+	.uleb128 0x2
+	.byte	0x37
+	.byte	0x9f
+	.byte	0
+.LVUS387:
+	.uleb128 .LVU792
+	.uleb128 .LVU795
+.LLST387:
+	.byte	0x4
+	.uleb128 .LVL127-.Ltext0
+	.uleb128 .LVL127-.Ltext0
+	.uleb128 0x2
+	.byte	0x90
+	.uleb128 0x20
+	.byte	0
+.LVUS388:
+	.uleb128 .LVU792
+	.uleb128 .LVU795
+.LLST388:
+	.byte	0x4
+	.uleb128 .LVL127-.Ltext0
+	.uleb128 .LVL127-.Ltext0
+	.uleb128 0x1
+	.byte	0x61
+	.byte	0
+.LVUS390:
+	.uleb128 .LVU798
+	.uleb128 .LVU803
+.LLST390:
+	.byte	0x4
+	.uleb128 .LVL127-.Ltext0
+	.uleb128 .LVL129-.Ltext0
+	.uleb128 0x3
+	.byte	0x8
+	.byte	0x39
+	.byte	0x9f
+	.byte	0
+.LVUS391:
+	.uleb128 .LVU801
+	.uleb128 .LVU803
+.LLST391:
+	.byte	0x4
+	.uleb128 .LVL128-.Ltext0
+	.uleb128 .LVL129-.Ltext0
+	.uleb128 0x1
+	.byte	0x61
+	.byte	0
+.LVUS393:
+	.uleb128 .LVU925
+	.uleb128 .LVU927
+.LLST393:
+	.byte	0x4
+	.uleb128 .LVL150-.Ltext0
+	.uleb128 .LVL150-.Ltext0
+	.uleb128 0x3
+	.byte	0x8
+	.byte	0xe7
+	.byte	0x9f
+	.byte	0
+.LVUS394:
+	.uleb128 .LVU925
+	.uleb128 .LVU927
+.LLST394:
+	.byte	0x4
+	.uleb128 .LVL150-.Ltext0
+	.uleb128 .LVL150-.Ltext0
+	.uleb128 0x1
+	.byte	0x65
+	.byte	0
+.LVUS395:
+	.uleb128 .LVU814
+	.uleb128 .LVU816
+.LLST395:
+	.byte	0x4
+	.uleb128 .LVL129-.Ltext0
+	.uleb128 .LVL129-.Ltext0
+	.uleb128 0x1
+	.byte	0x61
+	.byte	0
+.LVUS396:
+	.uleb128 .LVU814
+	.uleb128 .LVU816
+.LLST396:
+	.byte	0x4
+	.uleb128 .LVL129-.Ltext0
+	.uleb128 .LVL129-.Ltext0
+	.uleb128 0x1
+	.byte	0x68
+	.byte	0
+.LVUS397:
+	.uleb128 .LVU816
+	.uleb128 .LVU820
+.LLST397:
+	.byte	0x4
+	.uleb128 .LVL129-.Ltext0
+	.uleb128 .LVL130-.Ltext0
+	.uleb128 0x1
+	.byte	0x6e
+	.byte	0
+.LVUS399:
+	.uleb128 .LVU823
+	.uleb128 .LVU825
+.LLST399:
+	.byte	0x4
+	.uleb128 .LVL131-.Ltext0
+	.uleb128 .LVL131-.Ltext0
+	.uleb128 0x1
+	.byte	0x6e
+	.byte	0
+.LVUS400:
+	.uleb128 .LVU823
+	.uleb128 .LVU825
+.LLST400:
+	.byte	0x4
+	.uleb128 .LVL131-.Ltext0
+	.uleb128 .LVL131-.Ltext0
+	.uleb128 0x1
+	.byte	0x62
+	.byte	0
+.LVUS402:
+	.uleb128 .LVU829
+	.uleb128 .LVU831
+.LLST402:
+	.byte	0x4
+	.uleb128 .LVL132-.Ltext0
+	.uleb128 .LVL133-.Ltext0
+	.uleb128 0x1
+	.byte	0x62
+	.byte	0
+.LVUS403:
+	.uleb128 .LVU833
+	.uleb128 .LVU836
+.LLST403:
+	.byte	0x4
+	.uleb128 .LVL133-.Ltext0
+	.uleb128 .LVL134-.Ltext0
+	.uleb128 0x1
+	.byte	0x62
+	.byte	0
+.LVUS404:
+	.uleb128 .LVU833
+	.uleb128 .LVU836
+.LLST404:
+	.byte	0x4
+	.uleb128 .LVL133-.Ltext0
+	.uleb128 .LVL134-.Ltext0
+	.uleb128 0x1
+	.byte	0x63
+	.byte	0
+.LVUS406:
+	.uleb128 .LVU838
+	.uleb128 .LVU840
+.LLST406:
+	.byte	0x4
+	.uleb128 .LVL134-.Ltext0
+	.uleb128 .LVL134-.Ltext0
+	.uleb128 0x1
+	.byte	0x63
+	.byte	0
+.LVUS407:
+	.uleb128 .LVU838
+	.uleb128 .LVU840
+.LLST407:
+	.byte	0x4
+	.uleb128 .LVL134-.Ltext0
+	.uleb128 .LVL134-.Ltext0
+	.uleb128 0x1
+	.byte	0x61
+	.byte	0
+.LVUS409:
+	.uleb128 .LVU840
+	.uleb128 .LVU849
+.LLST409:
+	.byte	0x4
+	.uleb128 .LVL134-.Ltext0
+	.uleb128 .LVL137-.Ltext0
+	.uleb128 0x2
+	.byte	0x44
+	.byte	0x9f
+	.byte	0
+.LVUS410:
+	.uleb128 .LVU844
+	.uleb128 .LVU847
+.LLST410:
+	.byte	0x4
+	.uleb128 .LVL135-.Ltext0
+	.uleb128 .LVL136-.Ltext0
+	.uleb128 0x1
+	.byte	0x61
+	.byte	0
+.LVUS412:
+	.uleb128 .LVU849
+	.uleb128 .LVU852
+.LLST412:
+	.byte	0x4
+	.uleb128 .LVL137-.Ltext0
+	.uleb128 .LVL137-.Ltext0
+	.uleb128 0x2
+	.byte	0x3c
+	.byte	0x9f
+	.byte	0
+.LVUS413:
+	.uleb128 .LVU852
+	.uleb128 .LVU856
+.LLST413:
+	.byte	0x4
+	.uleb128 .LVL137-.Ltext0
+	.uleb128 .LVL138-.Ltext0
+	.uleb128 0x1
+	.byte	0x68
+	.byte	0
+.LVUS414:
+	.uleb128 .LVU852
+	.uleb128 .LVU856
+.LLST414:
+	.byte	0x4
+	.uleb128 .LVL137-.Ltext0
+	.uleb128 .LVL138-.Ltext0
+	.uleb128 0x1
+	.byte	0x61
+	.byte	0
+.LVUS415:
+	.uleb128 .LVU858
+	.uleb128 .LVU860
+.LLST415:
+	.byte	0x4
+	.uleb128 .LVL138-.Ltext0
+	.uleb128 .LVL138-.Ltext0
+	.uleb128 0x1
+	.byte	0x61
+	.byte	0
+.LVUS416:
+	.uleb128 .LVU858
+	.uleb128 .LVU860
+.LLST416:
+	.byte	0x4
+	.uleb128 .LVL138-.Ltext0
+	.uleb128 .LVL138-.Ltext0
+	.uleb128 0x1
+	.byte	0x6e
+	.byte	0
+.LVUS417:
+	.uleb128 .LVU860
+	.uleb128 .LVU864
+.LLST417:
+	.byte	0x4
+	.uleb128 .LVL138-.Ltext0
+	.uleb128 .LVL139-.Ltext0
+	.uleb128 0x1
+	.byte	0x6d
+	.byte	0
+.LVUS419:
+	.uleb128 .LVU867
+	.uleb128 .LVU869
+.LLST419:
+	.byte	0x4
+	.uleb128 .LVL140-.Ltext0
+	.uleb128 .LVL140-.Ltext0
+	.uleb128 0x1
+	.byte	0x6d
+	.byte	0
+.LVUS420:
+	.uleb128 .LVU867
+	.uleb128 .LVU869
+.LLST420:
+	.byte	0x4
+	.uleb128 .LVL140-.Ltext0
+	.uleb128 .LVL140-.Ltext0
+	.uleb128 0x1
+	.byte	0x62
+	.byte	0
+.LVUS422:
+	.uleb128 .LVU873
+	.uleb128 .LVU875
+.LLST422:
+	.byte	0x4
+	.uleb128 .LVL141-.Ltext0
+	.uleb128 .LVL142-.Ltext0
+	.uleb128 0x1
+	.byte	0x62
+	.byte	0
+.LVUS423:
+	.uleb128 .LVU877
+	.uleb128 .LVU880
+.LLST423:
+	.byte	0x4
+	.uleb128 .LVL142-.Ltext0
+	.uleb128 .LVL143-.Ltext0
+	.uleb128 0x1
+	.byte	0x62
+	.byte	0
+.LVUS424:
+	.uleb128 .LVU877
+	.uleb128 .LVU880
+.LLST424:
+	.byte	0x4
+	.uleb128 .LVL142-.Ltext0
+	.uleb128 .LVL143-.Ltext0
+	.uleb128 0x1
+	.byte	0x63
+	.byte	0
+.LVUS426:
+	.uleb128 .LVU882
+	.uleb128 .LVU884
+.LLST426:
+	.byte	0x4
+	.uleb128 .LVL143-.Ltext0
+	.uleb128 .LVL143-.Ltext0
+	.uleb128 0x1
+	.byte	0x63
+	.byte	0
+.LVUS427:
+	.uleb128 .LVU882
+	.uleb128 .LVU884
+.LLST427:
+	.byte	0x4
+	.uleb128 .LVL143-.Ltext0
+	.uleb128 .LVL143-.Ltext0
+	.uleb128 0x1
+	.byte	0x61
+	.byte	0
+.LVUS429:
+	.uleb128 .LVU884
+	.uleb128 .LVU897
+.LLST429:
+	.byte	0x4
+	.uleb128 .LVL143-.Ltext0
+	.uleb128 .LVL148-.Ltext0
+	.uleb128 0x2
+	.byte	0x49
+	.byte	0x9f
+	.byte	0
+.LVUS430:
+	.uleb128 .LVU890
+	.uleb128 .LVU895
+.LLST430:
+	.byte	0x4
+	.uleb128 .LVL145-.Ltext0
+	.uleb128 .LVL147-.Ltext0
+	.uleb128 0x1
+	.byte	0x61
+	.byte	0
+.LVUS432:
+	.uleb128 .LVU918
+	.uleb128 .LVU920
+.LLST432:
+	.byte	0x4
+	.uleb128 .LVL150-.Ltext0
+	.uleb128 .LVL150-.Ltext0
+	.uleb128 0x3
+	.byte	0x8
+	.byte	0x39
+	.byte	0x9f
+	.byte	0
+.LVUS434:
+	.uleb128 .LVU914
+	.uleb128 .LVU916
+.LLST434:
+	.byte	0x4
+	.uleb128 .LVL150-.Ltext0
+	.uleb128 .LVL150-.Ltext0
+	.uleb128 0x3
+	.byte	0x8
+	.byte	0x4e
+	.byte	0x9f
+	.byte	0
+.LVUS436:
+	.uleb128 .LVU897
+	.uleb128 .LVU900
+.LLST436:
+	.byte	0x4
+	.uleb128 .LVL148-.Ltext0
+	.uleb128 .LVL148-.Ltext0
+	.uleb128 0x2
+	.byte	0x37
+	.byte	0x9f
+	.byte	0
+.LVUS438:
+	.uleb128 .LVU900
+	.uleb128 .LVU903
+.LLST438:
+	.byte	0x4
+	.uleb128 .LVL148-.Ltext0
+	.uleb128 .LVL148-.Ltext0
+	.uleb128 0x1
+	.byte	0x6e
+	.byte	0
+.LVUS439:
+	.uleb128 .LVU900
+	.uleb128 .LVU903
+.LLST439:
+	.byte	0x4
+	.uleb128 .LVL148-.Ltext0
+	.uleb128 .LVL148-.Ltext0
+	.uleb128 0x1
+	.byte	0x61
+	.byte	0
+.LVUS441:
+	.uleb128 .LVU906
+	.uleb128 .LVU912
+.LLST441:
+	.byte	0x4
+	.uleb128 .LVL148-.Ltext0
+	.uleb128 .LVL150-.Ltext0
+	.uleb128 0x3
+	.byte	0x8
+	.byte	0x93
+	.byte	0x9f
+	.byte	0
+.LVUS442:
+	.uleb128 .LVU909
+	.uleb128 .LVU912
+.LLST442:
+	.byte	0x4
+	.uleb128 .LVL149-.Ltext0
+	.uleb128 .LVL150-.Ltext0
+	.uleb128 0x1
+	.byte	0x61
+	.byte	0
+.LVUS444:
+	.uleb128 .LVU930
+	.uleb128 .LVU933
+.LLST444:
+	.byte	0x4
+	.uleb128 .LVL150-.Ltext0
+	.uleb128 .LVL151-.Ltext0
+	.uleb128 0x2
+	.byte	0x3c
+	.byte	0x9f
+	.byte	0
+.LVUS445:
+	.uleb128 .LVU930
+	.uleb128 .LVU933
+.LLST445:
+	.byte	0x4
+	.uleb128 .LVL150-.Ltext0
+	.uleb128 .LVL151-.Ltext0
+	.uleb128 0x2
+	.byte	0x90
+	.uleb128 0x20
+	.byte	0
+.LVUS446:
+	.uleb128 .LVU936
+	.uleb128 .LVU939
+.LLST446:
+	.byte	0x4
+	.uleb128 .LVL151-.Ltext0
+	.uleb128 .LVL152-.Ltext0
+	.uleb128 0x3
+	.byte	0x8
+	.byte	0x30
+	.byte	0x9f
+	.byte	0
+.LVUS447:
+	.uleb128 .LVU936
+	.uleb128 .LVU939
+.LLST447:
+	.byte	0x4
+	.uleb128 .LVL151-.Ltext0
+	.uleb128 .LVL152-.Ltext0
+	.uleb128 0x1
+	.byte	0x6c
+	.byte	0
+.LVUS448:
+	.uleb128 .LVU936
+	.uleb128 .LVU939
+.LLST448:
+	.byte	0x4
+	.uleb128 .LVL151-.Ltext0
+	.uleb128 .LVL152-.Ltext0
+	.uleb128 0x1
+	.byte	0x6f
+	.byte	0
+.LVUS450:
+	.uleb128 .LVU942
+	.uleb128 .LVU946
+.LLST450:
+	.byte	0x4
+	.uleb128 .LVL152-.Ltext0
+	.uleb128 .LVL153-.Ltext0
+	.uleb128 0x3
+	.byte	0x8
+	.byte	0xc0
+	.byte	0x9f
+	.byte	0
+.LVUS451:
+	.uleb128 .LVU942
+	.uleb128 .LVU946
+.LLST451:
+	.byte	0x4
+	.uleb128 .LVL152-.Ltext0
+	.uleb128 .LVL153-.Ltext0
+	.uleb128 0x1
+	.byte	0x66
+	.byte	0
+.LVUS452:
+	.uleb128 .LVU942
+	.uleb128 .LVU946
+.LLST452:
+	.byte	0x4
+	.uleb128 .LVL152-.Ltext0
+	.uleb128 .LVL153-.Ltext0
+	.uleb128 0x1
+	.byte	0x6f
+	.byte	0
+.LVUS454:
+	.uleb128 .LVU948
+	.uleb128 .LVU950
+.LLST454:
+	.byte	0x4
+	.uleb128 .LVL153-.Ltext0
+	.uleb128 .LVL153-.Ltext0
+	.uleb128 0x3
+	.byte	0x8
+	.byte	0xe5
+	.byte	0x9f
+	.byte	0
+.LVUS455:
+	.uleb128 .LVU948
+	.uleb128 .LVU950
+.LLST455:
+	.byte	0x4
+	.uleb128 .LVL153-.Ltext0
+	.uleb128 .LVL153-.Ltext0
+	.uleb128 0x1
+	.byte	0x66
+	.byte	0
+.LVUS456:
+	.uleb128 .LVU953
+	.uleb128 .LVU956
+.LLST456:
+	.byte	0x4
+	.uleb128 .LVL153-.Ltext0
+	.uleb128 .LVL154-.Ltext0
+	.uleb128 0x2
+	.byte	0x3c
+	.byte	0x9f
+	.byte	0
+.LVUS457:
+	.uleb128 .LVU953
+	.uleb128 .LVU956
+.LLST457:
+	.byte	0x4
+	.uleb128 .LVL153-.Ltext0
+	.uleb128 .LVL154-.Ltext0
+	.uleb128 0x1
+	.byte	0x64
+	.byte	0
+.LVUS458:
+	.uleb128 .LVU953
+	.uleb128 .LVU956
+.LLST458:
+	.byte	0x4
+	.uleb128 .LVL153-.Ltext0
+	.uleb128 .LVL154-.Ltext0
+	.uleb128 0x1
+	.byte	0x6c
+	.byte	0
+.LVUS459:
+	.uleb128 .LVU959
+	.uleb128 .LVU962
+.LLST459:
+	.byte	0x4
+	.uleb128 .LVL154-.Ltext0
+	.uleb128 .LVL155-.Ltext0
+	.uleb128 0x3
+	.byte	0x8
+	.byte	0xf0
+	.byte	0x9f
+	.byte	0
+.LVUS460:
+	.uleb128 .LVU959
+	.uleb128 .LVU962
+.LLST460:
+	.byte	0x4
+	.uleb128 .LVL154-.Ltext0
+	.uleb128 .LVL155-.Ltext0
+	.uleb128 0x1
+	.byte	0x6b
+	.byte	0
+.LVUS461:
+	.uleb128 .LVU959
+	.uleb128 .LVU962
+.LLST461:
+	.byte	0x4
+	.uleb128 .LVL154-.Ltext0
+	.uleb128 .LVL155-.Ltext0
+	.uleb128 0x1
+	.byte	0x6c
+	.byte	0
+.LVUS463:
+	.uleb128 .LVU964
+	.uleb128 .LVU975
+.LLST463:
+	.byte	0x4
+	.uleb128 .LVL155-.Ltext0
+	.uleb128 .LVL159-.Ltext0
+	.uleb128 0x2
+	.byte	0x3f
+	.byte	0x9f
+	.byte	0
+.LVUS464:
+	.uleb128 .LVU964
+	.uleb128 .LVU975
+.LLST464:
+	.byte	0x4
+	.uleb128 .LVL155-.Ltext0
+	.uleb128 .LVL159-.Ltext0
+	.uleb128 0x1
+	.byte	0x65
+	.byte	0
+.LVUS465:
+	.uleb128 .LVU964
+	.uleb128 .LVU975
+.LLST465:
+	.byte	0x4
+	.uleb128 .LVL155-.Ltext0
+	.uleb128 .LVL159-.Ltext0
+	.uleb128 0x1
+	.byte	0x64
+	.byte	0
+.LVUS468:
+	.uleb128 .LVU1234
+	.uleb128 .LVU1236
+.LLST468:
+	.byte	0x4
+	.uleb128 .LVL200-.Ltext0
+	.uleb128 .LVL200-.Ltext0
+	.uleb128 0x3
+	.byte	0x8
+	.byte	0xa5
+	.byte	0x9f
+	.byte	0
+.LVUS469:
+	.uleb128 .LVU1234
+	.uleb128 .LVU1236
+.LLST469:
+	.byte	0x4
+	.uleb128 .LVL200-.Ltext0
+	.uleb128 .LVL200-.Ltext0
+	.uleb128 0x1
+	.byte	0x66
+	.byte	0
+.LVUS471:
+	.uleb128 .LVU977
+	.uleb128 .LVU986
+.LLST471:
+	.byte	0x4
+	.uleb128 .LVL159-.Ltext0
+	.uleb128 .LVL162-.Ltext0
+	.uleb128 0x3
+	.byte	0x8
+	.byte	0xc0
+	.byte	0x9f
+	.byte	0
+.LVUS472:
+	.uleb128 .LVU977
+	.uleb128 .LVU986
+.LLST472:
+	.byte	0x4
+	.uleb128 .LVL159-.Ltext0
+	.uleb128 .LVL162-.Ltext0
+	.uleb128 0x1
+	.byte	0x67
+	.byte	0
+.LVUS473:
+	.uleb128 .LVU977
+	.uleb128 .LVU986
+.LLST473:
+	.byte	0x4
+	.uleb128 .LVL159-.Ltext0
+	.uleb128 .LVL162-.Ltext0
+	.uleb128 0x1
+	.byte	0x69
+	.byte	0
+.LVUS475:
+	.uleb128 .LVU1029
+	.uleb128 .LVU1031
+.LLST475:
+	.byte	0x4
+	.uleb128 .LVL164-.Ltext0
+	.uleb128 .LVL164-.Ltext0
+	.uleb128 0x1
+	.byte	0x6f
+	.byte	0
+.LVUS477:
+	.uleb128 .LVU1000
+	.uleb128 .LVU1002
+.LLST477:
+	.byte	0x4
+	.uleb128 .LVL164-.Ltext0
+	.uleb128 .LVL164-.Ltext0
+	.uleb128 0x3
+	.byte	0x8
+	.byte	0xe6
+	.byte	0x9f
+	.byte	0
+.LVUS478:
+	.uleb128 .LVU1000
+	.uleb128 .LVU1002
+.LLST478:
+	.byte	0x4
+	.uleb128 .LVL164-.Ltext0
+	.uleb128 .LVL164-.Ltext0
+	.uleb128 0x1
+	.byte	0x65
+	.byte	0
+.LVUS480:
+	.uleb128 .LVU1004
+	.uleb128 .LVU1006
+.LLST480:
+	.byte	0x4
+	.uleb128 .LVL164-.Ltext0
+	.uleb128 .LVL164-.Ltext0
+	.uleb128 0x3
+	.byte	0x8
+	.byte	0x28
+	.byte	0x9f
+	.byte	0
+.LVUS481:
+	.uleb128 .LVU1004
+	.uleb128 .LVU1006
+.LLST481:
+	.byte	0x4
+	.uleb128 .LVL164-.Ltext0
+	.uleb128 .LVL164-.Ltext0
+	.uleb128 0x1
+	.byte	0x66
+	.byte	0
+.LVUS484:
+	.uleb128 .LVU1036
+	.uleb128 .LVU1038
+.LLST484:
+	.byte	0x4
+	.uleb128 .LVL164-.Ltext0
+	.uleb128 .LVL164-.Ltext0
+	.uleb128 0x1
+	.byte	0x62
+	.byte	0
+.LVUS486:
+	.uleb128 .LVU1008
+	.uleb128 .LVU1010
+.LLST486:
+	.byte	0x4
+	.uleb128 .LVL164-.Ltext0
+	.uleb128 .LVL164-.Ltext0
+	.uleb128 0x3
+	.byte	0x8
+	.byte	0xcc
+	.byte	0x9f
+	.byte	0
+.LVUS487:
+	.uleb128 .LVU1008
+	.uleb128 .LVU1010
+.LLST487:
+	.byte	0x4
+	.uleb128 .LVL164-.Ltext0
+	.uleb128 .LVL164-.Ltext0
+	.uleb128 0x1
+	.byte	0x6e
+	.byte	0
+.LVUS489:
+	.uleb128 .LVU988
+	.uleb128 .LVU998
+.LLST489:
+	.byte	0x4
+	.uleb128 .LVL162-.Ltext0
+	.uleb128 .LVL164-.Ltext0
+	.uleb128 0x3
+	.byte	0x8
+	.byte	0xc6
+	.byte	0x9f
+	.byte	0
+.LVUS490:
+	.uleb128 .LVU988
+	.uleb128 .LVU998
+.LLST490:
+	.byte	0x4
+	.uleb128 .LVL162-.Ltext0
+	.uleb128 .LVL164-.Ltext0
+	.uleb128 0x1
+	.byte	0x69
+	.byte	0
+.LVUS492:
+	.uleb128 .LVU1040
+	.uleb128 .LVU1042
+.LLST492:
+	.byte	0x4
+	.uleb128 .LVL164-.Ltext0
+	.uleb128 .LVL164-.Ltext0
+	.uleb128 0x1
+	.byte	0x63
+	.byte	0
+.LVUS494:
+	.uleb128 .LVU1012
+	.uleb128 .LVU1014
+.LLST494:
+	.byte	0x4
+	.uleb128 .LVL164-.Ltext0
+	.uleb128 .LVL164-.Ltext0
+	.uleb128 0x3
+	.byte	0x8
+	.byte	0xc4
+	.byte	0x9f
+	.byte	0
+.LVUS495:
+	.uleb128 .LVU1012
+	.uleb128 .LVU1014
+.LLST495:
+	.byte	0x4
+	.uleb128 .LVL164-.Ltext0
+	.uleb128 .LVL164-.Ltext0
+	.uleb128 0x1
+	.byte	0x64
+	.byte	0
+.LVUS497:
+	.uleb128 .LVU1016
+	.uleb128 .LVU1018
+.LLST497:
+	.byte	0x4
+	.uleb128 .LVL164-.Ltext0
+	.uleb128 .LVL164-.Ltext0
+	.uleb128 0x3
+	.byte	0x8
+	.byte	0x30
+	.byte	0x9f
+	.byte	0
+.LVUS499:
+	.uleb128 .LVU1042
+	.uleb128 .LVU1046
+.LLST499:
+	.byte	0x4
+	.uleb128 .LVL164-.Ltext0
+	.uleb128 .LVL165-.Ltext0
+	.uleb128 0x2
+	.byte	0x44
+	.byte	0x9f
+	.byte	0
+.LVUS500:
+	.uleb128 .LVU1046
+	.uleb128 .LVU1050
+.LLST500:
+	.byte	0x4
+	.uleb128 .LVL165-.Ltext0
+	.uleb128 .LVL166-.Ltext0
+	.uleb128 0x2
+	.byte	0x3c
+	.byte	0x9f
+	.byte	0
+.LVUS502:
+	.uleb128 .LVU1050
+	.uleb128 .LVU1055
+.LLST502:
+	.byte	0x4
+	.uleb128 .LVL166-.Ltext0
+	.uleb128 .LVL167-.Ltext0
+	.uleb128 0x1
+	.byte	0x6b
+	.byte	0
+.LVUS503:
+	.uleb128 .LVU1050
+	.uleb128 .LVU1055
+.LLST503:
+	.byte	0x4
+	.uleb128 .LVL166-.Ltext0
+	.uleb128 .LVL167-.Ltext0
+	.uleb128 0x1
+	.byte	0x61
+	.byte	0
+.LVUS505:
+	.uleb128 .LVU1239
+	.uleb128 .LVU1241
+.LLST505:
+	.byte	0x4
+	.uleb128 .LVL200-.Ltext0
+	.uleb128 .LVL200-.Ltext0
+	.uleb128 0x2
+	.byte	0x3c
+	.byte	0x9f
+	.byte	0
+.LVUS506:
+	.uleb128 .LVU1239
+	.uleb128 .LVU1241
+.LLST506:
+	.byte	0x4
+	.uleb128 .LVL200-.Ltext0
+	.uleb128 .LVL200-.Ltext0
+	.uleb128 0x1
+	.byte	0x65
+	.byte	0
+.LVUS507:
+	.uleb128 .LVU1057
+	.uleb128 .LVU1059
+.LLST507:
+	.byte	0x4
+	.uleb128 .LVL167-.Ltext0
+	.uleb128 .LVL167-.Ltext0
+	.uleb128 0x1
+	.byte	0x61
+	.byte	0
+.LVUS508:
+	.uleb128 .LVU1057
+	.uleb128 .LVU1059
+.LLST508:
+	.byte	0x4
+	.uleb128 .LVL167-.Ltext0
+	.uleb128 .LVL167-.Ltext0
+	.uleb128 0x1
+	.byte	0x6f
+	.byte	0
+.LVUS510:
+	.uleb128 .LVU1059
+	.uleb128 .LVU1064
+.LLST510:
+	.byte	0x4
+	.uleb128 .LVL167-.Ltext0
+	.uleb128 .LVL168-.Ltext0
+	.uleb128 0x1
+	.byte	0x6c
+	.byte	0
+.LVUS512:
+	.uleb128 .LVU1244
+	.uleb128 .LVU1246
+.LLST512:
+	.byte	0x4
+	.uleb128 .LVL200-.Ltext0
+	.uleb128 .LVL200-.Ltext0
+	.uleb128 0x3
+	.byte	0x8
+	.byte	0x30
+	.byte	0x9f
+	.byte	0
+.LVUS513:
+	.uleb128 .LVU1244
+	.uleb128 .LVU1246
+.LLST513:
+	.byte	0x4
+	.uleb128 .LVL200-.Ltext0
+	.uleb128 .LVL200-.Ltext0
+	.uleb128 0x1
+	.byte	0x64
+	.byte	0
+.LVUS515:
+	.uleb128 .LVU1067
+	.uleb128 .LVU1069
+.LLST515:
+	.byte	0x4
+	.uleb128 .LVL169-.Ltext0
+	.uleb128 .LVL169-.Ltext0
+	.uleb128 0x1
+	.byte	0x6c
+	.byte	0
+.LVUS516:
+	.uleb128 .LVU1067
+	.uleb128 .LVU1069
+.LLST516:
+	.byte	0x4
+	.uleb128 .LVL169-.Ltext0
+	.uleb128 .LVL169-.Ltext0
+	.uleb128 0x1
+	.byte	0x62
+	.byte	0
+.LVUS518:
+	.uleb128 .LVU1073
+	.uleb128 .LVU1075
+.LLST518:
+	.byte	0x4
+	.uleb128 .LVL170-.Ltext0
+	.uleb128 .LVL171-.Ltext0
+	.uleb128 0x1
+	.byte	0x62
+	.byte	0
+.LVUS519:
+	.uleb128 .LVU1077
+	.uleb128 .LVU1080
+.LLST519:
+	.byte	0x4
+	.uleb128 .LVL171-.Ltext0
+	.uleb128 .LVL172-.Ltext0
+	.uleb128 0x1
+	.byte	0x62
+	.byte	0
+.LVUS520:
+	.uleb128 .LVU1077
+	.uleb128 .LVU1080
+.LLST520:
+	.byte	0x4
+	.uleb128 .LVL171-.Ltext0
+	.uleb128 .LVL172-.Ltext0
+	.uleb128 0x1
+	.byte	0x63
+	.byte	0
+.LVUS522:
+	.uleb128 .LVU1082
+	.uleb128 .LVU1084
+.LLST522:
+	.byte	0x4
+	.uleb128 .LVL172-.Ltext0
+	.uleb128 .LVL172-.Ltext0
+	.uleb128 0x1
+	.byte	0x63
+	.byte	0
+.LVUS523:
+	.uleb128 .LVU1082
+	.uleb128 .LVU1084
+.LLST523:
+	.byte	0x4
+	.uleb128 .LVL172-.Ltext0
+	.uleb128 .LVL172-.Ltext0
+	.uleb128 0x1
+	.byte	0x61
+	.byte	0
+.LVUS525:
+	.uleb128 .LVU1084
+	.uleb128 .LVU1097
+.LLST525:
+	.byte	0x4
+	.uleb128 .LVL172-.Ltext0
+	.uleb128 .LVL177-.Ltext0
+	.uleb128 0x2
+	.byte	0x49
+	.byte	0x9f
+	.byte	0
+.LVUS526:
+	.uleb128 .LVU1090
+	.uleb128 .LVU1095
+.LLST526:
+	.byte	0x4
+	.uleb128 .LVL174-.Ltext0
+	.uleb128 .LVL176-.Ltext0
+	.uleb128 0x1
+	.byte	0x61
+	.byte	0
+.LVUS528:
+	.uleb128 .LVU1117
+	.uleb128 .LVU1119
+.LLST528:
+	.byte	0x4
+	.uleb128 .LVL179-.Ltext0
+	.uleb128 .LVL179-.Ltext0
+	.uleb128 0x3
+	.byte	0x8
+	.byte	0x93
+	.byte	0x9f
+	.byte	0
+.LVUS530:
+	.uleb128 .LVU1113
+	.uleb128 .LVU1115
+.LLST530:
+	.byte	0x4
+	.uleb128 .LVL179-.Ltext0
+	.uleb128 .LVL179-.Ltext0
+	.uleb128 0x3
+	.byte	0x8
+	.byte	0x4e
+	.byte	0x9f
+	.byte	0
+.LVUS532:
+	.uleb128 .LVU1097
+	.uleb128 .LVU1100
+.LLST532:
+	.byte	0x4
+	.uleb128 .LVL177-.Ltext0
+	.uleb128 .LVL177-.Ltext0
+	.uleb128 0x2
+	.byte	0x37
+	.byte	0x9f
+	.byte	0
+.LVUS534:
+	.uleb128 .LVU1100
+	.uleb128 .LVU1103
+.LLST534:
+	.byte	0x4
+	.uleb128 .LVL177-.Ltext0
+	.uleb128 .LVL177-.Ltext0
+	.uleb128 0x1
+	.byte	0x6b
+	.byte	0
+.LVUS535:
+	.uleb128 .LVU1100
+	.uleb128 .LVU1103
+.LLST535:
+	.byte	0x4
+	.uleb128 .LVL177-.Ltext0
+	.uleb128 .LVL177-.Ltext0
+	.uleb128 0x1
+	.byte	0x61
+	.byte	0
+.LVUS537:
+	.uleb128 .LVU1106
+	.uleb128 .LVU1111
+.LLST537:
+	.byte	0x4
+	.uleb128 .LVL177-.Ltext0
+	.uleb128 .LVL179-.Ltext0
+	.uleb128 0x3
+	.byte	0x8
+	.byte	0x39
+	.byte	0x9f
+	.byte	0
+.LVUS538:
+	.uleb128 .LVU1109
+	.uleb128 .LVU1111
+.LLST538:
+	.byte	0x4
+	.uleb128 .LVL178-.Ltext0
+	.uleb128 .LVL179-.Ltext0
+	.uleb128 0x1
+	.byte	0x61
+	.byte	0
+.LVUS539:
+	.uleb128 .LVU1122
+	.uleb128 .LVU1124
+.LLST539:
+	.byte	0x4
+	.uleb128 .LVL179-.Ltext0
+	.uleb128 .LVL179-.Ltext0
+	.uleb128 0x1
+	.byte	0x61
+	.byte	0
+.LVUS540:
+	.uleb128 .LVU1122
+	.uleb128 .LVU1124
+.LLST540:
+	.byte	0x4
+	.uleb128 .LVL179-.Ltext0
+	.uleb128 .LVL179-.Ltext0
+	.uleb128 0x1
+	.byte	0x6c
+	.byte	0
+.LVUS541:
+	.uleb128 .LVU1124
+	.uleb128 .LVU1128
+.LLST541:
+	.byte	0x4
+	.uleb128 .LVL179-.Ltext0
+	.uleb128 .LVL180-.Ltext0
+	.uleb128 0x1
+	.byte	0x69
+	.byte	0
+.LVUS543:
+	.uleb128 .LVU1131
+	.uleb128 .LVU1133
+.LLST543:
+	.byte	0x4
+	.uleb128 .LVL181-.Ltext0
+	.uleb128 .LVL181-.Ltext0
+	.uleb128 0x1
+	.byte	0x69
+	.byte	0
+.LVUS544:
+	.uleb128 .LVU1131
+	.uleb128 .LVU1133
+.LLST544:
+	.byte	0x4
+	.uleb128 .LVL181-.Ltext0
+	.uleb128 .LVL181-.Ltext0
+	.uleb128 0x1
+	.byte	0x62
+	.byte	0
+.LVUS546:
+	.uleb128 .LVU1137
+	.uleb128 .LVU1139
+.LLST546:
+	.byte	0x4
+	.uleb128 .LVL182-.Ltext0
+	.uleb128 .LVL183-.Ltext0
+	.uleb128 0x1
+	.byte	0x62
+	.byte	0
+.LVUS547:
+	.uleb128 .LVU1141
+	.uleb128 .LVU1144
+.LLST547:
+	.byte	0x4
+	.uleb128 .LVL183-.Ltext0
+	.uleb128 .LVL184-.Ltext0
+	.uleb128 0x1
+	.byte	0x62
+	.byte	0
+.LVUS548:
+	.uleb128 .LVU1141
+	.uleb128 .LVU1144
+.LLST548:
+	.byte	0x4
+	.uleb128 .LVL183-.Ltext0
+	.uleb128 .LVL184-.Ltext0
+	.uleb128 0x1
+	.byte	0x63
+	.byte	0
+.LVUS550:
+	.uleb128 .LVU1146
+	.uleb128 .LVU1148
+.LLST550:
+	.byte	0x4
+	.uleb128 .LVL184-.Ltext0
+	.uleb128 .LVL184-.Ltext0
+	.uleb128 0x1
+	.byte	0x63
+	.byte	0
+.LVUS551:
+	.uleb128 .LVU1146
+	.uleb128 .LVU1148
+.LLST551:
+	.byte	0x4
+	.uleb128 .LVL184-.Ltext0
+	.uleb128 .LVL184-.Ltext0
+	.uleb128 0x1
+	.byte	0x61
+	.byte	0
+.LVUS553:
+	.uleb128 .LVU1148
+	.uleb128 .LVU1157
+.LLST553:
+	.byte	0x4
+	.uleb128 .LVL184-.Ltext0
+	.uleb128 .LVL187-.Ltext0
+	.uleb128 0x2
+	.byte	0x44
+	.byte	0x9f
+	.byte	0
+.LVUS554:
+	.uleb128 .LVU1152
+	.uleb128 .LVU1155
+.LLST554:
+	.byte	0x4
+	.uleb128 .LVL185-.Ltext0
+	.uleb128 .LVL186-.Ltext0
+	.uleb128 0x1
+	.byte	0x61
+	.byte	0
+.LVUS556:
+	.uleb128 .LVU1157
+	.uleb128 .LVU1160
+.LLST556:
+	.byte	0x4
+	.uleb128 .LVL187-.Ltext0
+	.uleb128 .LVL187-.Ltext0
+	.uleb128 0x2
+	.byte	0x3c
+	.byte	0x9f
+	.byte	0
+.LVUS557:
+	.uleb128 .LVU1160
+	.uleb128 .LVU1164
+.LLST557:
+	.byte	0x4
+	.uleb128 .LVL187-.Ltext0
+	.uleb128 .LVL188-.Ltext0
+	.uleb128 0x1
+	.byte	0x6b
+	.byte	0
+.LVUS558:
+	.uleb128 .LVU1160
+	.uleb128 .LVU1164
+.LLST558:
+	.byte	0x4
+	.uleb128 .LVL187-.Ltext0
+	.uleb128 .LVL188-.Ltext0
+	.uleb128 0x1
+	.byte	0x61
+	.byte	0
+.LVUS559:
+	.uleb128 .LVU1166
+	.uleb128 .LVU1168
+.LLST559:
+	.byte	0x4
+	.uleb128 .LVL188-.Ltext0
+	.uleb128 .LVL188-.Ltext0
+	.uleb128 0x1
+	.byte	0x61
+	.byte	0
+.LVUS560:
+	.uleb128 .LVU1166
+	.uleb128 .LVU1168
+.LLST560:
+	.byte	0x4
+	.uleb128 .LVL188-.Ltext0
+	.uleb128 .LVL188-.Ltext0
+	.uleb128 0x1
+	.byte	0x69
+	.byte	0
+.LVUS561:
+	.uleb128 .LVU1168
+	.uleb128 .LVU1172
+.LLST561:
+	.byte	0x4
+	.uleb128 .LVL188-.Ltext0
+	.uleb128 .LVL189-.Ltext0
+	.uleb128 0x1
+	.byte	0x68
+	.byte	0
+.LVUS563:
+	.uleb128 .LVU1175
+	.uleb128 .LVU1177
+.LLST563:
+	.byte	0x4
+	.uleb128 .LVL190-.Ltext0
+	.uleb128 .LVL190-.Ltext0
+	.uleb128 0x1
+	.byte	0x68
+	.byte	0
+.LVUS564:
+	.uleb128 .LVU1175
+	.uleb128 .LVU1177
+.LLST564:
+	.byte	0x4
+	.uleb128 .LVL190-.Ltext0
+	.uleb128 .LVL190-.Ltext0
+	.uleb128 0x1
+	.byte	0x62
+	.byte	0
+.LVUS566:
+	.uleb128 .LVU1182
+	.uleb128 .LVU1184
+.LLST566:
+	.byte	0x4
+	.uleb128 .LVL191-.Ltext0
+	.uleb128 .LVL192-.Ltext0
+	.uleb128 0x1
+	.byte	0x62
+	.byte	0
+.LVUS568:
+	.uleb128 .LVU1249
+	.uleb128 .LVU1251
+.LLST568:
+	.byte	0x4
+	.uleb128 .LVL200-.Ltext0
+	.uleb128 .LVL200-.Ltext0
+	.uleb128 0x3
+	.byte	0x8
+	.byte	0xcc
+	.byte	0x9f
+	.byte	0
+.LVUS569:
+	.uleb128 .LVU1249
+	.uleb128 .LVU1251
+.LLST569:
+	.byte	0x4
+	.uleb128 .LVL200-.Ltext0
+	.uleb128 .LVL200-.Ltext0
+	.uleb128 0x1
+	.byte	0x65
+	.byte	0
+.LVUS570:
+	.uleb128 .LVU1186
+	.uleb128 .LVU1189
+.LLST570:
+	.byte	0x4
+	.uleb128 .LVL192-.Ltext0
+	.uleb128 .LVL193-.Ltext0
+	.uleb128 0x1
+	.byte	0x62
+	.byte	0
+.LVUS571:
+	.uleb128 .LVU1186
+	.uleb128 .LVU1189
+.LLST571:
+	.byte	0x4
+	.uleb128 .LVL192-.Ltext0
+	.uleb128 .LVL193-.Ltext0
+	.uleb128 0x1
+	.byte	0x63
+	.byte	0
+.LVUS573:
+	.uleb128 .LVU1191
+	.uleb128 .LVU1193
+.LLST573:
+	.byte	0x4
+	.uleb128 .LVL193-.Ltext0
+	.uleb128 .LVL193-.Ltext0
+	.uleb128 0x1
+	.byte	0x63
+	.byte	0
+.LVUS574:
+	.uleb128 .LVU1191
+	.uleb128 .LVU1193
+.LLST574:
+	.byte	0x4
+	.uleb128 .LVL193-.Ltext0
+	.uleb128 .LVL193-.Ltext0
+	.uleb128 0x1
+	.byte	0x61
+	.byte	0
+.LVUS576:
+	.uleb128 .LVU1193
+	.uleb128 .LVU1206
+.LLST576:
+	.byte	0x4
+	.uleb128 .LVL193-.Ltext0
+	.uleb128 .LVL198-.Ltext0
+	.uleb128 0x2
+	.byte	0x49
+	.byte	0x9f
+	.byte	0
+.LVUS577:
+	.uleb128 .LVU1199
+	.uleb128 .LVU1204
+.LLST577:
+	.byte	0x4
+	.uleb128 .LVL195-.Ltext0
+	.uleb128 .LVL197-.Ltext0
+	.uleb128 0x1
+	.byte	0x61
+	.byte	0
+.LVUS579:
+	.uleb128 .LVU1227
+	.uleb128 .LVU1229
+.LLST579:
+	.byte	0x4
+	.uleb128 .LVL200-.Ltext0
+	.uleb128 .LVL200-.Ltext0
+	.uleb128 0x3
+	.byte	0x8
+	.byte	0x39
+	.byte	0x9f
+	.byte	0
+.LVUS581:
+	.uleb128 .LVU1223
+	.uleb128 .LVU1225
+.LLST581:
+	.byte	0x4
+	.uleb128 .LVL200-.Ltext0
+	.uleb128 .LVL200-.Ltext0
+	.uleb128 0x3
+	.byte	0x8
+	.byte	0x4e
+	.byte	0x9f
+	.byte	0
+.LVUS583:
+	.uleb128 .LVU1206
+	.uleb128 .LVU1209
+.LLST583:
+	.byte	0x4
+	.uleb128 .LVL198-.Ltext0
+	.uleb128 .LVL198-.Ltext0
+	.uleb128 0x2
+	.byte	0x37
+	.byte	0x9f
+	.byte	0
+.LVUS585:
+	.uleb128 .LVU1209
+	.uleb128 .LVU1212
+.LLST585:
+	.byte	0x4
+	.uleb128 .LVL198-.Ltext0
+	.uleb128 .LVL198-.Ltext0
+	.uleb128 0x1
+	.byte	0x6c
+	.byte	0
+.LVUS586:
+	.uleb128 .LVU1209
+	.uleb128 .LVU1212
+.LLST586:
+	.byte	0x4
+	.uleb128 .LVL198-.Ltext0
+	.uleb128 .LVL198-.Ltext0
+	.uleb128 0x1
+	.byte	0x61
+	.byte	0
+.LVUS588:
+	.uleb128 .LVU1215
+	.uleb128 .LVU1221
+.LLST588:
+	.byte	0x4
+	.uleb128 .LVL198-.Ltext0
+	.uleb128 .LVL200-.Ltext0
+	.uleb128 0x3
+	.byte	0x8
+	.byte	0x93
+	.byte	0x9f
+	.byte	0
+.LVUS589:
+	.uleb128 .LVU1218
+	.uleb128 .LVU1221
+.LLST589:
+	.byte	0x4
+	.uleb128 .LVL199-.Ltext0
+	.uleb128 .LVL200-.Ltext0
+	.uleb128 0x1
+	.byte	0x61
+	.byte	0
+.LVUS591:
+	.uleb128 .LVU1253
+	.uleb128 .LVU1261
+.LLST591:
+	.byte	0x4
+	.uleb128 .LVL200-.Ltext0
+	.uleb128 .LVL203-.Ltext0
+	.uleb128 0x3
+	.byte	0x8
+	.byte	0x3c
+	.byte	0x9f
+	.byte	0
+.LVUS592:
+	.uleb128 .LVU1253
+	.uleb128 .LVU1257
+.LLST592:
+	.byte	0x4
+	.uleb128 .LVL200-.Ltext0
+	.uleb128 .LVL201-.Ltext0
+	.uleb128 0x1
+	.byte	0x69
+	.byte	0
+.LVUS593:
+	.uleb128 .LVU1253
+	.uleb128 .LVU1261
+.LLST593:
+	.byte	0x4
+	.uleb128 .LVL200-.Ltext0
+	.uleb128 .LVL203-.Ltext0
+	.uleb128 0x1
+	.byte	0x64
+	.byte	0
+.LVUS595:
+	.uleb128 .LVU1272
+	.uleb128 .LVU1274
+.LLST595:
+	.byte	0x4
+	.uleb128 .LVL204-.Ltext0
+	.uleb128 .LVL204-.Ltext0
+	.uleb128 0x3
+	.byte	0x8
+	.byte	0xec
+	.byte	0x9f
+	.byte	0
+.LVUS596:
+	.uleb128 .LVU1272
+	.uleb128 .LVU1274
+.LLST596:
+	.byte	0x4
+	.uleb128 .LVL204-.Ltext0
+	.uleb128 .LVL204-.Ltext0
+	.uleb128 0x1
+	.byte	0x66
+	.byte	0
+.LVUS599:
+	.uleb128 .LVU1264
+	.uleb128 .LVU1269
+.LLST599:
+	.byte	0x4
+	.uleb128 .LVL203-.Ltext0
+	.uleb128 .LVL204-.Ltext0
+	.uleb128 0x3
+	.byte	0x8
+	.byte	0xc0
+	.byte	0x9f
+	.byte	0
+.LVUS600:
+	.uleb128 .LVU1264
+	.uleb128 .LVU1269
+.LLST600:
+	.byte	0x4
+	.uleb128 .LVL203-.Ltext0
+	.uleb128 .LVL204-.Ltext0
+	.uleb128 0x1
+	.byte	0x67
+	.byte	0
+.LVUS601:
+	.uleb128 .LVU1264
+	.uleb128 .LVU1269
+.LLST601:
+	.byte	0x4
+	.uleb128 .LVL203-.Ltext0
+	.uleb128 .LVL204-.Ltext0
+	.uleb128 0x1
+	.byte	0x6e
+	.byte	0
+.LVUS603:
+	.uleb128 .LVU1276
+	.uleb128 .LVU1278
+.LLST603:
+	.byte	0x4
+	.uleb128 .LVL204-.Ltext0
+	.uleb128 .LVL204-.Ltext0
+	.uleb128 0x2
+	.byte	0x3c
+	.byte	0x9f
+	.byte	0
+.LVUS604:
+	.uleb128 .LVU1276
+	.uleb128 .LVU1278
+.LLST604:
+	.byte	0x4
+	.uleb128 .LVL204-.Ltext0
+	.uleb128 .LVL204-.Ltext0
+	.uleb128 0x1
+	.byte	0x69
+	.byte	0
+.LVUS606:
+	.uleb128 .LVU1281
+	.uleb128 .LVU1288
+.LLST606:
+	.byte	0x4
+	.uleb128 .LVL204-.Ltext0
+	.uleb128 .LVL207-.Ltext0
+	.uleb128 0x3
+	.byte	0x8
+	.byte	0x30
+	.byte	0x9f
+	.byte	0
+.LVUS607:
+	.uleb128 .LVU1281
+	.uleb128 .LVU1288
+.LLST607:
+	.byte	0x4
+	.uleb128 .LVL204-.Ltext0
+	.uleb128 .LVL207-.Ltext0
+	.uleb128 0x1
+	.byte	0x65
+	.byte	0
+.LVUS608:
+	.uleb128 .LVU1281
+	.uleb128 .LVU1288
+.LLST608:
+	.byte	0x4
+	.uleb128 .LVL204-.Ltext0
+	.uleb128 .LVL207-.Ltext0
+	.uleb128 0x1
+	.byte	0x6a
+	.byte	0
+.LVUS610:
+	.uleb128 .LVU1576
+	.uleb128 .LVU1578
+.LLST610:
+	.byte	0x4
+	.uleb128 .LVL253-.Ltext0
+	.uleb128 .LVL253-.Ltext0
+	.uleb128 0x3
+	.byte	0x8
+	.byte	0xf8
+	.byte	0x9f
+	.byte	0
+.LVUS611:
+	.uleb128 .LVU1576
+	.uleb128 .LVU1578
+.LLST611:
+	.byte	0x4
+	.uleb128 .LVL253-.Ltext0
+	.uleb128 .LVL253-.Ltext0
+	.uleb128 0x1
+	.byte	0x66
+	.byte	0
+.LVUS613:
+	.uleb128 .LVU1339
+	.uleb128 .LVU1341
+.LLST613:
+	.byte	0x4
+	.uleb128 .LVL215-.Ltext0
+	.uleb128 .LVL215-.Ltext0
+	.uleb128 0x1
+	.byte	0x6d
+	.byte	0
+.LVUS615:
+	.uleb128 .LVU1291
+	.uleb128 .LVU1300
+.LLST615:
+	.byte	0x4
+	.uleb128 .LVL207-.Ltext0
+	.uleb128 .LVL210-.Ltext0
+	.uleb128 0x3
+	.byte	0x8
+	.byte	0xc0
+	.byte	0x9f
+	.byte	0
+.LVUS616:
+	.uleb128 .LVU1291
+	.uleb128 .LVU1300
+.LLST616:
+	.byte	0x4
+	.uleb128 .LVL207-.Ltext0
+	.uleb128 .LVL210-.Ltext0
+	.uleb128 0x1
+	.byte	0x64
+	.byte	0
+.LVUS617:
+	.uleb128 .LVU1291
+	.uleb128 .LVU1296
+.LLST617:
+	.byte	0x4
+	.uleb128 .LVL207-.Ltext0
+	.uleb128 .LVL208-.Ltext0
+	.uleb128 0x1
+	.byte	0x6a
+	.byte	0
+.LVUS619:
+	.uleb128 .LVU1307
+	.uleb128 .LVU1309
+.LLST619:
+	.byte	0x4
+	.uleb128 .LVL211-.Ltext0
+	.uleb128 .LVL211-.Ltext0
+	.uleb128 0x3
+	.byte	0x8
+	.byte	0x60
+	.byte	0x9f
+	.byte	0
+.LVUS620:
+	.uleb128 .LVU1307
+	.uleb128 .LVU1309
+.LLST620:
+	.byte	0x4
+	.uleb128 .LVL211-.Ltext0
+	.uleb128 .LVL211-.Ltext0
+	.uleb128 0x1
+	.byte	0x67
+	.byte	0
+.LVUS623:
+	.uleb128 .LVU1346
+	.uleb128 .LVU1348
+.LLST623:
+	.byte	0x4
+	.uleb128 .LVL215-.Ltext0
+	.uleb128 .LVL215-.Ltext0
+	.uleb128 0x1
+	.byte	0x62
+	.byte	0
+.LVUS624:
+	.uleb128 .LVU1302
+	.uleb128 .LVU1305
+.LLST624:
+	.byte	0x4
+	.uleb128 .LVL210-.Ltext0
+	.uleb128 .LVL211-.Ltext0
+	.uleb128 0x3
+	.byte	0x8
+	.byte	0xe5
+	.byte	0x9f
+	.byte	0
+.LVUS625:
+	.uleb128 .LVU1302
+	.uleb128 .LVU1305
+.LLST625:
+	.byte	0x4
+	.uleb128 .LVL210-.Ltext0
+	.uleb128 .LVL211-.Ltext0
+	.uleb128 0x1
+	.byte	0x64
+	.byte	0
+.LVUS627:
+	.uleb128 .LVU1311
+	.uleb128 .LVU1316
+.LLST627:
+	.byte	0x4
+	.uleb128 .LVL211-.Ltext0
+	.uleb128 .LVL213-.Ltext0
+	.uleb128 0x3
+	.byte	0x8
+	.byte	0xcc
+	.byte	0x9f
+	.byte	0
+.LVUS628:
+	.uleb128 .LVU1311
+	.uleb128 .LVU1316
+.LLST628:
+	.byte	0x4
+	.uleb128 .LVL211-.Ltext0
+	.uleb128 .LVL213-.Ltext0
+	.uleb128 0x1
+	.byte	0x69
+	.byte	0
+.LVUS629:
+	.uleb128 .LVU1311
+	.uleb128 .LVU1316
+.LLST629:
+	.byte	0x4
+	.uleb128 .LVL211-.Ltext0
+	.uleb128 .LVL213-.Ltext0
+	.uleb128 0x1
+	.byte	0x6a
+	.byte	0
+.LVUS631:
+	.uleb128 .LVU1350
+	.uleb128 .LVU1352
+.LLST631:
+	.byte	0x4
+	.uleb128 .LVL215-.Ltext0
+	.uleb128 .LVL215-.Ltext0
+	.uleb128 0x1
+	.byte	0x63
+	.byte	0
+.LVUS632:
+	.uleb128 .LVU1318
+	.uleb128 .LVU1321
+.LLST632:
+	.byte	0x4
+	.uleb128 .LVL213-.Ltext0
+	.uleb128 .LVL214-.Ltext0
+	.uleb128 0x3
+	.byte	0x8
+	.byte	0xc4
+	.byte	0x9f
+	.byte	0
+.LVUS633:
+	.uleb128 .LVU1318
+	.uleb128 .LVU1321
+.LLST633:
+	.byte	0x4
+	.uleb128 .LVL213-.Ltext0
+	.uleb128 .LVL214-.Ltext0
+	.uleb128 0x1
+	.byte	0x66
+	.byte	0
+.LVUS635:
+	.uleb128 .LVU1323
+	.uleb128 .LVU1328
+.LLST635:
+	.byte	0x4
+	.uleb128 .LVL214-.Ltext0
+	.uleb128 .LVL215-.Ltext0
+	.uleb128 0x3
+	.byte	0x8
+	.byte	0x30
+	.byte	0x9f
+	.byte	0
+.LVUS636:
+	.uleb128 .LVU1323
+	.uleb128 .LVU1328
+.LLST636:
+	.byte	0x4
+	.uleb128 .LVL214-.Ltext0
+	.uleb128 .LVL215-.Ltext0
+	.uleb128 0x1
+	.byte	0x69
+	.byte	0
+.LVUS637:
+	.uleb128 .LVU1323
+	.uleb128 .LVU1328
+.LLST637:
+	.byte	0x4
+	.uleb128 .LVL214-.Ltext0
+	.uleb128 .LVL215-.Ltext0
+	.uleb128 0x1
+	.byte	0x6a
+	.byte	0
+.LVUS639:
+	.uleb128 .LVU1352
+	.uleb128 .LVU1356
+.LLST639:
+	.byte	0x4
+	.uleb128 .LVL215-.Ltext0
+	.uleb128 .LVL216-.Ltext0
+	.uleb128 0x2
+	.byte	0x44
+	.byte	0x9f
+	.byte	0
+.LVUS641:
+	.uleb128 .LVU1356
+	.uleb128 .LVU1359
+.LLST641:
+	.byte	0x4
+	.uleb128 .LVL216-.Ltext0
+	.uleb128 .LVL216-.Ltext0
+	.uleb128 0x2
+	.byte	0x3c
+	.byte	0x9f
+	.byte	0
+.LVUS643:
+	.uleb128 .LVU1359
+	.uleb128 .LVU1365
+.LLST643:
+	.byte	0x4
+	.uleb128 .LVL216-.Ltext0
+	.uleb128 .LVL218-.Ltext0
+	.uleb128 0x1
+	.byte	0x6c
+	.byte	0
+.LVUS644:
+	.uleb128 .LVU1359
+	.uleb128 .LVU1365
+.LLST644:
+	.byte	0x4
+	.uleb128 .LVL216-.Ltext0
+	.uleb128 .LVL218-.Ltext0
+	.uleb128 0x1
+	.byte	0x61
+	.byte	0
+.LVUS646:
+	.uleb128 .LVU1552
+	.uleb128 .LVU1554
+.LLST646:
+	.byte	0x4
+	.uleb128 .LVL251-.Ltext0
+	.uleb128 .LVL251-.Ltext0
+	.uleb128 0x3
+	.byte	0x8
+	.byte	0xc6
+	.byte	0x9f
+	.byte	0
+.LVUS647:
+	.uleb128 .LVU1552
+	.uleb128 .LVU1554
+.LLST647:
+	.byte	0x4
+	.uleb128 .LVL251-.Ltext0
+	.uleb128 .LVL251-.Ltext0
+	.uleb128 0x1
+	.byte	0x64
+	.byte	0
+.LVUS648:
+	.uleb128 .LVU1367
+	.uleb128 .LVU1369
+.LLST648:
+	.byte	0x4
+	.uleb128 .LVL218-.Ltext0
+	.uleb128 .LVL218-.Ltext0
+	.uleb128 0x1
+	.byte	0x61
+	.byte	0
+.LVUS649:
+	.uleb128 .LVU1367
+	.uleb128 .LVU1369
+.LLST649:
+	.byte	0x4
+	.uleb128 .LVL218-.Ltext0
+	.uleb128 .LVL218-.Ltext0
+	.uleb128 0x1
+	.byte	0x6d
+	.byte	0
+.LVUS650:
+	.uleb128 .LVU1369
+	.uleb128 .LVU1373
+.LLST650:
+	.byte	0x4
+	.uleb128 .LVL218-.Ltext0
+	.uleb128 .LVL219-.Ltext0
+	.uleb128 0x1
+	.byte	0x6e
+	.byte	0
+.LVUS652:
+	.uleb128 .LVU1376
+	.uleb128 .LVU1378
+.LLST652:
+	.byte	0x4
+	.uleb128 .LVL220-.Ltext0
+	.uleb128 .LVL220-.Ltext0
+	.uleb128 0x1
+	.byte	0x6e
+	.byte	0
+.LVUS653:
+	.uleb128 .LVU1376
+	.uleb128 .LVU1378
+.LLST653:
+	.byte	0x4
+	.uleb128 .LVL220-.Ltext0
+	.uleb128 .LVL220-.Ltext0
+	.uleb128 0x1
+	.byte	0x62
+	.byte	0
+.LVUS655:
+	.uleb128 .LVU1382
+	.uleb128 .LVU1384
+.LLST655:
+	.byte	0x4
+	.uleb128 .LVL221-.Ltext0
+	.uleb128 .LVL222-.Ltext0
+	.uleb128 0x1
+	.byte	0x62
+	.byte	0
+.LVUS657:
+	.uleb128 .LVU1386
+	.uleb128 .LVU1390
+.LLST657:
+	.byte	0x4
+	.uleb128 .LVL222-.Ltext0
+	.uleb128 .LVL223-.Ltext0
+	.uleb128 0x1
+	.byte	0x62
+	.byte	0
+.LVUS658:
+	.uleb128 .LVU1386
+	.uleb128 .LVU1390
+.LLST658:
+	.byte	0x4
+	.uleb128 .LVL222-.Ltext0
+	.uleb128 .LVL223-.Ltext0
+	.uleb128 0x1
+	.byte	0x63
+	.byte	0
+.LVUS660:
+	.uleb128 .LVU1914
+	.uleb128 .LVU1916
+.LLST660:
+	.byte	0x4
+	.uleb128 .LVL306-.Ltext0
+	.uleb128 .LVL306-.Ltext0
+	.uleb128 0x3
+	.byte	0x8
+	.byte	0x3c
+	.byte	0x9f
+	.byte	0
+.LVUS662:
+	.uleb128 .LVU1392
+	.uleb128 .LVU1394
+.LLST662:
+	.byte	0x4
+	.uleb128 .LVL223-.Ltext0
+	.uleb128 .LVL223-.Ltext0
+	.uleb128 0x1
+	.byte	0x63
+	.byte	0
+.LVUS663:
+	.uleb128 .LVU1392
+	.uleb128 .LVU1394
+.LLST663:
+	.byte	0x4
+	.uleb128 .LVL223-.Ltext0
+	.uleb128 .LVL223-.Ltext0
+	.uleb128 0x1
+	.byte	0x61
+	.byte	0
+.LVUS665:
+	.uleb128 .LVU1394
+	.uleb128 .LVU1408
+.LLST665:
+	.byte	0x4
+	.uleb128 .LVL223-.Ltext0
+	.uleb128 .LVL228-.Ltext0
+	.uleb128 0x2
+	.byte	0x49
+	.byte	0x9f
+	.byte	0
+.LVUS666:
+	.uleb128 .LVU1401
+	.uleb128 .LVU1406
+.LLST666:
+	.byte	0x4
+	.uleb128 .LVL225-.Ltext0
+	.uleb128 .LVL227-.Ltext0
+	.uleb128 0x1
+	.byte	0x61
+	.byte	0
+.LVUS668:
+	.uleb128 .LVU1428
+	.uleb128 .LVU1430
+.LLST668:
+	.byte	0x4
+	.uleb128 .LVL230-.Ltext0
+	.uleb128 .LVL230-.Ltext0
+	.uleb128 0x3
+	.byte	0x8
+	.byte	0x93
+	.byte	0x9f
+	.byte	0
+.LVUS670:
+	.uleb128 .LVU1919
+	.uleb128 .LVU1921
+.LLST670:
+	.byte	0x4
+	.uleb128 .LVL306-.Ltext0
+	.uleb128 .LVL306-.Ltext0
+	.uleb128 0x3
+	.byte	0x8
+	.byte	0xc0
+	.byte	0x9f
+	.byte	0
+.LVUS671:
+	.uleb128 .LVU1919
+	.uleb128 .LVU1921
+.LLST671:
+	.byte	0x4
+	.uleb128 .LVL306-.Ltext0
+	.uleb128 .LVL306-.Ltext0
+	.uleb128 0x1
+	.byte	0x66
+	.byte	0
+.LVUS673:
+	.uleb128 .LVU1424
+	.uleb128 .LVU1426
+.LLST673:
+	.byte	0x4
+	.uleb128 .LVL230-.Ltext0
+	.uleb128 .LVL230-.Ltext0
+	.uleb128 0x3
+	.byte	0x8
+	.byte	0x4e
+	.byte	0x9f
+	.byte	0
+.LVUS675:
+	.uleb128 .LVU1408
+	.uleb128 .LVU1411
+.LLST675:
+	.byte	0x4
+	.uleb128 .LVL228-.Ltext0
+	.uleb128 .LVL228-.Ltext0
+	.uleb128 0x2
+	.byte	0x37
+	.byte	0x9f
+	.byte	0
+.LVUS677:
+	.uleb128 .LVU1411
+	.uleb128 .LVU1414
+.LLST677:
+	.byte	0x4
+	.uleb128 .LVL228-.Ltext0
+	.uleb128 .LVL228-.Ltext0
+	.uleb128 0x1
+	.byte	0x6c
+	.byte	0
+.LVUS678:
+	.uleb128 .LVU1411
+	.uleb128 .LVU1414
+.LLST678:
+	.byte	0x4
+	.uleb128 .LVL228-.Ltext0
+	.uleb128 .LVL228-.Ltext0
+	.uleb128 0x1
+	.byte	0x61
+	.byte	0
+.LVUS680:
+	.uleb128 .LVU1417
+	.uleb128 .LVU1422
+.LLST680:
+	.byte	0x4
+	.uleb128 .LVL228-.Ltext0
+	.uleb128 .LVL230-.Ltext0
+	.uleb128 0x3
+	.byte	0x8
+	.byte	0x39
+	.byte	0x9f
+	.byte	0
+.LVUS681:
+	.uleb128 .LVU1420
+	.uleb128 .LVU1422
+.LLST681:
+	.byte	0x4
+	.uleb128 .LVL229-.Ltext0
+	.uleb128 .LVL230-.Ltext0
+	.uleb128 0x1
+	.byte	0x61
+	.byte	0
+.LVUS682:
+	.uleb128 .LVU1433
+	.uleb128 .LVU1435
+.LLST682:
+	.byte	0x4
+	.uleb128 .LVL230-.Ltext0
+	.uleb128 .LVL230-.Ltext0
+	.uleb128 0x1
+	.byte	0x61
+	.byte	0
+.LVUS683:
+	.uleb128 .LVU1433
+	.uleb128 .LVU1435
+.LLST683:
+	.byte	0x4
+	.uleb128 .LVL230-.Ltext0
+	.uleb128 .LVL230-.Ltext0
+	.uleb128 0x1
+	.byte	0x6e
+	.byte	0
+.LVUS684:
+	.uleb128 .LVU1435
+	.uleb128 .LVU1439
+.LLST684:
+	.byte	0x4
+	.uleb128 .LVL230-.Ltext0
+	.uleb128 .LVL231-.Ltext0
+	.uleb128 0x1
+	.byte	0x6b
+	.byte	0
+.LVUS686:
+	.uleb128 .LVU1442
+	.uleb128 .LVU1444
+.LLST686:
+	.byte	0x4
+	.uleb128 .LVL232-.Ltext0
+	.uleb128 .LVL232-.Ltext0
+	.uleb128 0x1
+	.byte	0x6b
+	.byte	0
+.LVUS687:
+	.uleb128 .LVU1442
+	.uleb128 .LVU1444
+.LLST687:
+	.byte	0x4
+	.uleb128 .LVL232-.Ltext0
+	.uleb128 .LVL232-.Ltext0
+	.uleb128 0x1
+	.byte	0x62
+	.byte	0
+.LVUS689:
+	.uleb128 .LVU1449
+	.uleb128 .LVU1451
+.LLST689:
+	.byte	0x4
+	.uleb128 .LVL233-.Ltext0
+	.uleb128 .LVL234-.Ltext0
+	.uleb128 0x1
+	.byte	0x62
+	.byte	0
+.LVUS691:
+	.uleb128 .LVU1623
+	.uleb128 .LVU1625
+.LLST691:
+	.byte	0x4
+	.uleb128 .LVL259-.Ltext0
+	.uleb128 .LVL259-.Ltext0
+	.uleb128 0x3
+	.byte	0x8
+	.byte	0x64
+	.byte	0x9f
+	.byte	0
+.LVUS692:
+	.uleb128 .LVU1623
+	.uleb128 .LVU1625
+.LLST692:
+	.byte	0x4
+	.uleb128 .LVL259-.Ltext0
+	.uleb128 .LVL259-.Ltext0
+	.uleb128 0x1
+	.byte	0x66
+	.byte	0
+.LVUS693:
+	.uleb128 .LVU1453
+	.uleb128 .LVU1456
+.LLST693:
+	.byte	0x4
+	.uleb128 .LVL234-.Ltext0
+	.uleb128 .LVL235-.Ltext0
+	.uleb128 0x1
+	.byte	0x62
+	.byte	0
+.LVUS694:
+	.uleb128 .LVU1453
+	.uleb128 .LVU1456
+.LLST694:
+	.byte	0x4
+	.uleb128 .LVL234-.Ltext0
+	.uleb128 .LVL235-.Ltext0
+	.uleb128 0x1
+	.byte	0x63
+	.byte	0
+.LVUS696:
+	.uleb128 .LVU1458
+	.uleb128 .LVU1460
+.LLST696:
+	.byte	0x4
+	.uleb128 .LVL235-.Ltext0
+	.uleb128 .LVL235-.Ltext0
+	.uleb128 0x1
+	.byte	0x63
+	.byte	0
+.LVUS697:
+	.uleb128 .LVU1458
+	.uleb128 .LVU1460
+.LLST697:
+	.byte	0x4
+	.uleb128 .LVL235-.Ltext0
+	.uleb128 .LVL235-.Ltext0
+	.uleb128 0x1
+	.byte	0x61
+	.byte	0
+.LVUS699:
+	.uleb128 .LVU1460
+	.uleb128 .LVU1469
+.LLST699:
+	.byte	0x4
+	.uleb128 .LVL235-.Ltext0
+	.uleb128 .LVL238-.Ltext0
+	.uleb128 0x2
+	.byte	0x44
+	.byte	0x9f
+	.byte	0
+.LVUS700:
+	.uleb128 .LVU1464
+	.uleb128 .LVU1467
+.LLST700:
+	.byte	0x4
+	.uleb128 .LVL236-.Ltext0
+	.uleb128 .LVL237-.Ltext0
+	.uleb128 0x1
+	.byte	0x61
+	.byte	0
+.LVUS702:
+	.uleb128 .LVU1469
+	.uleb128 .LVU1472
+.LLST702:
+	.byte	0x4
+	.uleb128 .LVL238-.Ltext0
+	.uleb128 .LVL238-.Ltext0
+	.uleb128 0x2
+	.byte	0x3c
+	.byte	0x9f
+	.byte	0
+.LVUS703:
+	.uleb128 .LVU1472
+	.uleb128 .LVU1476
+.LLST703:
+	.byte	0x4
+	.uleb128 .LVL238-.Ltext0
+	.uleb128 .LVL239-.Ltext0
+	.uleb128 0x1
+	.byte	0x6c
+	.byte	0
+.LVUS704:
+	.uleb128 .LVU1472
+	.uleb128 .LVU1476
+.LLST704:
+	.byte	0x4
+	.uleb128 .LVL238-.Ltext0
+	.uleb128 .LVL239-.Ltext0
+	.uleb128 0x1
+	.byte	0x61
+	.byte	0
+.LVUS705:
+	.uleb128 .LVU1478
+	.uleb128 .LVU1480
+.LLST705:
+	.byte	0x4
+	.uleb128 .LVL239-.Ltext0
+	.uleb128 .LVL239-.Ltext0
+	.uleb128 0x1
+	.byte	0x61
+	.byte	0
+.LVUS706:
+	.uleb128 .LVU1478
+	.uleb128 .LVU1480
+.LLST706:
+	.byte	0x4
+	.uleb128 .LVL239-.Ltext0
+	.uleb128 .LVL239-.Ltext0
+	.uleb128 0x1
+	.byte	0x6b
+	.byte	0
+.LVUS708:
+	.uleb128 .LVU1480
+	.uleb128 .LVU1485
+.LLST708:
+	.byte	0x4
+	.uleb128 .LVL239-.Ltext0
+	.uleb128 .LVL240-.Ltext0
+	.uleb128 0x1
+	.byte	0x6a
+	.byte	0
+.LVUS710:
+	.uleb128 .LVU1556
+	.uleb128 .LVU1558
+.LLST710:
+	.byte	0x4
+	.uleb128 .LVL251-.Ltext0
+	.uleb128 .LVL251-.Ltext0
+	.uleb128 0x3
+	.byte	0x8
+	.byte	0xe8
+	.byte	0x9f
+	.byte	0
+.LVUS711:
+	.uleb128 .LVU1556
+	.uleb128 .LVU1558
+.LLST711:
+	.byte	0x4
+	.uleb128 .LVL251-.Ltext0
+	.uleb128 .LVL251-.Ltext0
+	.uleb128 0x1
+	.byte	0x65
+	.byte	0
+.LVUS713:
+	.uleb128 .LVU1560
+	.uleb128 .LVU1562
+.LLST713:
+	.byte	0x4
+	.uleb128 .LVL251-.Ltext0
+	.uleb128 .LVL251-.Ltext0
+	.uleb128 0x2
+	.byte	0x3c
+	.byte	0x9f
+	.byte	0
+.LVUS715:
+	.uleb128 .LVU1580
+	.uleb128 .LVU1582
+.LLST715:
+	.byte	0x4
+	.uleb128 .LVL253-.Ltext0
+	.uleb128 .LVL253-.Ltext0
+	.uleb128 0x3
+	.byte	0x8
+	.byte	0x3c
+	.byte	0x9f
+	.byte	0
+.LVUS716:
+	.uleb128 .LVU1580
+	.uleb128 .LVU1582
+.LLST716:
+	.byte	0x4
+	.uleb128 .LVL253-.Ltext0
+	.uleb128 .LVL253-.Ltext0
+	.uleb128 0x1
+	.byte	0x67
+	.byte	0
+.LVUS718:
+	.uleb128 .LVU1490
+	.uleb128 .LVU1492
+.LLST718:
+	.byte	0x4
+	.uleb128 .LVL241-.Ltext0
+	.uleb128 .LVL241-.Ltext0
+	.uleb128 0x1
+	.byte	0x6a
+	.byte	0
+.LVUS719:
+	.uleb128 .LVU1490
+	.uleb128 .LVU1492
+.LLST719:
+	.byte	0x4
+	.uleb128 .LVL241-.Ltext0
+	.uleb128 .LVL241-.Ltext0
+	.uleb128 0x1
+	.byte	0x62
+	.byte	0
+.LVUS721:
+	.uleb128 .LVU1497
+	.uleb128 .LVU1501
+.LLST721:
+	.byte	0x4
+	.uleb128 .LVL242-.Ltext0
+	.uleb128 .LVL243-.Ltext0
+	.uleb128 0x1
+	.byte	0x62
+	.byte	0
+.LVUS723:
+	.uleb128 .LVU1585
+	.uleb128 .LVU1587
+.LLST723:
+	.byte	0x4
+	.uleb128 .LVL253-.Ltext0
+	.uleb128 .LVL253-.Ltext0
+	.uleb128 0x3
+	.byte	0x8
+	.byte	0xc0
+	.byte	0x9f
+	.byte	0
+.LVUS724:
+	.uleb128 .LVU1585
+	.uleb128 .LVU1587
+.LLST724:
+	.byte	0x4
+	.uleb128 .LVL253-.Ltext0
+	.uleb128 .LVL253-.Ltext0
+	.uleb128 0x1
+	.byte	0x64
+	.byte	0
+.LVUS726:
+	.uleb128 .LVU1599
+	.uleb128 .LVU1601
+.LLST726:
+	.byte	0x4
+	.uleb128 .LVL254-.Ltext0
+	.uleb128 .LVL254-.Ltext0
+	.uleb128 0x3
+	.byte	0x8
+	.byte	0x64
+	.byte	0x9f
+	.byte	0
+.LVUS727:
+	.uleb128 .LVU1599
+	.uleb128 .LVU1601
+.LLST727:
+	.byte	0x4
+	.uleb128 .LVL254-.Ltext0
+	.uleb128 .LVL254-.Ltext0
+	.uleb128 0x1
+	.byte	0x64
+	.byte	0
+.LVUS728:
+	.uleb128 .LVU1503
+	.uleb128 .LVU1506
+.LLST728:
+	.byte	0x4
+	.uleb128 .LVL243-.Ltext0
+	.uleb128 .LVL244-.Ltext0
+	.uleb128 0x1
+	.byte	0x62
+	.byte	0
+.LVUS729:
+	.uleb128 .LVU1503
+	.uleb128 .LVU1506
+.LLST729:
+	.byte	0x4
+	.uleb128 .LVL243-.Ltext0
+	.uleb128 .LVL244-.Ltext0
+	.uleb128 0x1
+	.byte	0x63
+	.byte	0
+.LVUS731:
+	.uleb128 .LVU1508
+	.uleb128 .LVU1510
+.LLST731:
+	.byte	0x4
+	.uleb128 .LVL244-.Ltext0
+	.uleb128 .LVL244-.Ltext0
+	.uleb128 0x1
+	.byte	0x63
+	.byte	0
+.LVUS732:
+	.uleb128 .LVU1508
+	.uleb128 .LVU1510
+.LLST732:
+	.byte	0x4
+	.uleb128 .LVL244-.Ltext0
+	.uleb128 .LVL244-.Ltext0
+	.uleb128 0x1
+	.byte	0x61
+	.byte	0
+.LVUS734:
+	.uleb128 .LVU1510
+	.uleb128 .LVU1523
+.LLST734:
+	.byte	0x4
+	.uleb128 .LVL244-.Ltext0
+	.uleb128 .LVL249-.Ltext0
+	.uleb128 0x2
+	.byte	0x49
+	.byte	0x9f
+	.byte	0
+.LVUS735:
+	.uleb128 .LVU1516
+	.uleb128 .LVU1521
+.LLST735:
+	.byte	0x4
+	.uleb128 .LVL246-.Ltext0
+	.uleb128 .LVL248-.Ltext0
+	.uleb128 0x1
+	.byte	0x61
+	.byte	0
+.LVUS737:
+	.uleb128 .LVU1545
+	.uleb128 .LVU1547
+.LLST737:
+	.byte	0x4
+	.uleb128 .LVL251-.Ltext0
+	.uleb128 .LVL251-.Ltext0
+	.uleb128 0x3
+	.byte	0x8
+	.byte	0x39
+	.byte	0x9f
+	.byte	0
+.LVUS739:
+	.uleb128 .LVU1541
+	.uleb128 .LVU1543
+.LLST739:
+	.byte	0x4
+	.uleb128 .LVL251-.Ltext0
+	.uleb128 .LVL251-.Ltext0
+	.uleb128 0x3
+	.byte	0x8
+	.byte	0x4e
+	.byte	0x9f
+	.byte	0
+.LVUS741:
+	.uleb128 .LVU1523
+	.uleb128 .LVU1526
+.LLST741:
+	.byte	0x4
+	.uleb128 .LVL249-.Ltext0
+	.uleb128 .LVL249-.Ltext0
+	.uleb128 0x2
+	.byte	0x37
+	.byte	0x9f
+	.byte	0
+.LVUS743:
+	.uleb128 .LVU1526
+	.uleb128 .LVU1529
+.LLST743:
+	.byte	0x4
+	.uleb128 .LVL249-.Ltext0
+	.uleb128 .LVL249-.Ltext0
+	.uleb128 0x1
+	.byte	0x6d
+	.byte	0
+.LVUS744:
+	.uleb128 .LVU1526
+	.uleb128 .LVU1529
+.LLST744:
+	.byte	0x4
+	.uleb128 .LVL249-.Ltext0
+	.uleb128 .LVL249-.Ltext0
+	.uleb128 0x1
+	.byte	0x61
+	.byte	0
+.LVUS746:
+	.uleb128 .LVU1532
+	.uleb128 .LVU1539
+.LLST746:
+	.byte	0x4
+	.uleb128 .LVL249-.Ltext0
+	.uleb128 .LVL251-.Ltext0
+	.uleb128 0x3
+	.byte	0x8
+	.byte	0x93
+	.byte	0x9f
+	.byte	0
+.LVUS747:
+	.uleb128 .LVU1535
+	.uleb128 .LVU1539
+.LLST747:
+	.byte	0x4
+	.uleb128 .LVL250-.Ltext0
+	.uleb128 .LVL251-.Ltext0
+	.uleb128 0x1
+	.byte	0x61
+	.byte	0
+.LVUS749:
+	.uleb128 .LVU1564
+	.uleb128 .LVU1566
+.LLST749:
+	.byte	0x4
+	.uleb128 .LVL251-.Ltext0
+	.uleb128 .LVL251-.Ltext0
+	.uleb128 0x3
+	.byte	0x8
+	.byte	0x24
+	.byte	0x9f
+	.byte	0
+.LVUS750:
+	.uleb128 .LVU1564
+	.uleb128 .LVU1566
+.LLST750:
+	.byte	0x4
+	.uleb128 .LVL251-.Ltext0
+	.uleb128 .LVL251-.Ltext0
+	.uleb128 0x1
+	.byte	0x66
+	.byte	0
+.LVUS752:
+	.uleb128 .LVU1568
+	.uleb128 .LVU1573
+.LLST752:
+	.byte	0x4
+	.uleb128 .LVL251-.Ltext0
+	.uleb128 .LVL253-.Ltext0
+	.uleb128 0x3
+	.byte	0x8
+	.byte	0xc0
+	.byte	0x9f
+	.byte	0
+.LVUS753:
+	.uleb128 .LVU1568
+	.uleb128 .LVU1571
+.LLST753:
+	.byte	0x4
+	.uleb128 .LVL251-.Ltext0
+	.uleb128 .LVL252-.Ltext0
+	.uleb128 0x1
+	.byte	0x6d
+	.byte	0
+.LVUS754:
+	.uleb128 .LVU1568
+	.uleb128 .LVU1573
+.LLST754:
+	.byte	0x4
+	.uleb128 .LVL251-.Ltext0
+	.uleb128 .LVL253-.Ltext0
+	.uleb128 0x1
+	.byte	0x69
+	.byte	0
+.LVUS756:
+	.uleb128 .LVU1589
+	.uleb128 .LVU1591
+.LLST756:
+	.byte	0x4
+	.uleb128 .LVL253-.Ltext0
+	.uleb128 .LVL253-.Ltext0
+	.uleb128 0x3
+	.byte	0x8
+	.byte	0xec
+	.byte	0x9f
+	.byte	0
+.LVUS757:
+	.uleb128 .LVU1589
+	.uleb128 .LVU1591
+.LLST757:
+	.byte	0x4
+	.uleb128 .LVL253-.Ltext0
+	.uleb128 .LVL253-.Ltext0
+	.uleb128 0x1
+	.byte	0x65
+	.byte	0
+.LVUS758:
+	.uleb128 .LVU1594
+	.uleb128 .LVU1597
+.LLST758:
+	.byte	0x4
+	.uleb128 .LVL253-.Ltext0
+	.uleb128 .LVL254-.Ltext0
+	.uleb128 0x3
+	.byte	0x8
+	.byte	0x30
+	.byte	0x9f
+	.byte	0
+.LVUS759:
+	.uleb128 .LVU1594
+	.uleb128 .LVU1597
+.LLST759:
+	.byte	0x4
+	.uleb128 .LVL253-.Ltext0
+	.uleb128 .LVL254-.Ltext0
+	.uleb128 0x1
+	.byte	0x6d
+	.byte	0
+.LVUS761:
+	.uleb128 .LVU1603
+	.uleb128 .LVU1608
+.LLST761:
+	.byte	0x4
+	.uleb128 .LVL254-.Ltext0
+	.uleb128 .LVL256-.Ltext0
+	.uleb128 0x3
+	.byte	0x8
+	.byte	0xc0
+	.byte	0x9f
+	.byte	0
+.LVUS762:
+	.uleb128 .LVU1603
+	.uleb128 .LVU1608
+.LLST762:
+	.byte	0x4
+	.uleb128 .LVL254-.Ltext0
+	.uleb128 .LVL256-.Ltext0
+	.uleb128 0x1
+	.byte	0x68
+	.byte	0
+.LVUS763:
+	.uleb128 .LVU1603
+	.uleb128 .LVU1608
+.LLST763:
+	.byte	0x4
+	.uleb128 .LVL254-.Ltext0
+	.uleb128 .LVL256-.Ltext0
+	.uleb128 0x1
+	.byte	0x6b
+	.byte	0
+.LVUS765:
+	.uleb128 .LVU1610
+	.uleb128 .LVU1613
+.LLST765:
+	.byte	0x4
+	.uleb128 .LVL256-.Ltext0
+	.uleb128 .LVL257-.Ltext0
+	.uleb128 0x3
+	.byte	0x8
+	.byte	0xe5
+	.byte	0x9f
+	.byte	0
+.LVUS766:
+	.uleb128 .LVU1610
+	.uleb128 .LVU1613
+.LLST766:
+	.byte	0x4
+	.uleb128 .LVL256-.Ltext0
+	.uleb128 .LVL257-.Ltext0
+	.uleb128 0x1
+	.byte	0x67
+	.byte	0
+.LVUS768:
+	.uleb128 .LVU1616
+	.uleb128 .LVU1621
+.LLST768:
+	.byte	0x4
+	.uleb128 .LVL257-.Ltext0
+	.uleb128 .LVL259-.Ltext0
+	.uleb128 0x2
+	.byte	0x3c
+	.byte	0x9f
+	.byte	0
+.LVUS769:
+	.uleb128 .LVU1616
+	.uleb128 .LVU1621
+.LLST769:
+	.byte	0x4
+	.uleb128 .LVL257-.Ltext0
+	.uleb128 .LVL259-.Ltext0
+	.uleb128 0x1
+	.byte	0x65
+	.byte	0
+.LVUS770:
+	.uleb128 .LVU1616
+	.uleb128 .LVU1621
+.LLST770:
+	.byte	0x4
+	.uleb128 .LVL257-.Ltext0
+	.uleb128 .LVL259-.Ltext0
+	.uleb128 0x1
+	.byte	0x68
+	.byte	0
+.LVUS772:
+	.uleb128 .LVU1642
+	.uleb128 .LVU1644
+.LLST772:
+	.byte	0x4
+	.uleb128 .LVL260-.Ltext0
+	.uleb128 .LVL260-.Ltext0
+	.uleb128 0x1
+	.byte	0x69
+	.byte	0
+.LVUS774:
+	.uleb128 .LVU1627
+	.uleb128 .LVU1631
+.LLST774:
+	.byte	0x4
+	.uleb128 .LVL259-.Ltext0
+	.uleb128 .LVL260-.Ltext0
+	.uleb128 0x3
+	.byte	0x8
+	.byte	0xc0
+	.byte	0x9f
+	.byte	0
+.LVUS775:
+	.uleb128 .LVU1627
+	.uleb128 .LVU1631
+.LLST775:
+	.byte	0x4
+	.uleb128 .LVL259-.Ltext0
+	.uleb128 .LVL260-.Ltext0
+	.uleb128 0x1
+	.byte	0x6e
+	.byte	0
+.LVUS776:
+	.uleb128 .LVU1627
+	.uleb128 .LVU1631
+.LLST776:
+	.byte	0x4
+	.uleb128 .LVL259-.Ltext0
+	.uleb128 .LVL260-.Ltext0
+	.uleb128 0x1
+	.byte	0x68
+	.byte	0
+.LVUS778:
+	.uleb128 .LVU1635
+	.uleb128 .LVU1637
+.LLST778:
+	.byte	0x4
+	.uleb128 .LVL260-.Ltext0
+	.uleb128 .LVL260-.Ltext0
+	.uleb128 0x1
+	.byte	0x61
+	.byte	0
+.LVUS779:
+	.uleb128 .LVU1635
+	.uleb128 .LVU1637
+.LLST779:
+	.byte	0x4
+	.uleb128 .LVL260-.Ltext0
+	.uleb128 .LVL260-.Ltext0
+	.uleb128 0x1
+	.byte	0x6a
+	.byte	0
+.LVUS781:
+	.uleb128 .LVU1649
+	.uleb128 .LVU1654
+.LLST781:
+	.byte	0x4
+	.uleb128 .LVL260-.Ltext0
+	.uleb128 .LVL262-.Ltext0
+	.uleb128 0x1
+	.byte	0x62
+	.byte	0
+.LVUS782:
+	.uleb128 .LVU1649
+	.uleb128 .LVU1654
+.LLST782:
+	.byte	0x4
+	.uleb128 .LVL260-.Ltext0
+	.uleb128 .LVL262-.Ltext0
+	.uleb128 0x1
+	.byte	0x63
+	.byte	0
+.LVUS784:
+	.uleb128 .LVU1899
+	.uleb128 .LVU1901
+.LLST784:
+	.byte	0x4
+	.uleb128 .LVL305-.Ltext0
+	.uleb128 .LVL305-.Ltext0
+	.uleb128 0x2
+	.byte	0x3c
+	.byte	0x9f
+	.byte	0
+.LVUS785:
+	.uleb128 .LVU1899
+	.uleb128 .LVU1901
+.LLST785:
+	.byte	0x4
+	.uleb128 .LVL305-.Ltext0
+	.uleb128 .LVL305-.Ltext0
+	.uleb128 0x1
+	.byte	0x64
+	.byte	0
+.LVUS787:
+	.uleb128 .LVU1656
+	.uleb128 .LVU1658
+.LLST787:
+	.byte	0x4
+	.uleb128 .LVL262-.Ltext0
+	.uleb128 .LVL262-.Ltext0
+	.uleb128 0x1
+	.byte	0x63
+	.byte	0
+.LVUS788:
+	.uleb128 .LVU1656
+	.uleb128 .LVU1658
+.LLST788:
+	.byte	0x4
+	.uleb128 .LVL262-.Ltext0
+	.uleb128 .LVL262-.Ltext0
+	.uleb128 0x1
+	.byte	0x61
+	.byte	0
+.LVUS790:
+	.uleb128 .LVU1658
+	.uleb128 .LVU1667
+.LLST790:
+	.byte	0x4
+	.uleb128 .LVL262-.Ltext0
+	.uleb128 .LVL265-.Ltext0
+	.uleb128 0x2
+	.byte	0x44
+	.byte	0x9f
+	.byte	0
+.LVUS791:
+	.uleb128 .LVU1662
+	.uleb128 .LVU1665
+.LLST791:
+	.byte	0x4
+	.uleb128 .LVL263-.Ltext0
+	.uleb128 .LVL264-.Ltext0
+	.uleb128 0x1
+	.byte	0x61
+	.byte	0
+.LVUS793:
+	.uleb128 .LVU1667
+	.uleb128 .LVU1670
+.LLST793:
+	.byte	0x4
+	.uleb128 .LVL265-.Ltext0
+	.uleb128 .LVL265-.Ltext0
+	.uleb128 0x2
+	.byte	0x3c
+	.byte	0x9f
+	.byte	0
+.LVUS794:
+	.uleb128 .LVU1670
+	.uleb128 .LVU1674
+.LLST794:
+	.byte	0x4
+	.uleb128 .LVL265-.Ltext0
+	.uleb128 .LVL266-.Ltext0
+	.uleb128 0x1
+	.byte	0x6a
+	.byte	0
+.LVUS795:
+	.uleb128 .LVU1670
+	.uleb128 .LVU1674
+.LLST795:
+	.byte	0x4
+	.uleb128 .LVL265-.Ltext0
+	.uleb128 .LVL266-.Ltext0
+	.uleb128 0x1
+	.byte	0x61
+	.byte	0
+.LVUS796:
+	.uleb128 .LVU1676
+	.uleb128 .LVU1678
+.LLST796:
+	.byte	0x4
+	.uleb128 .LVL266-.Ltext0
+	.uleb128 .LVL266-.Ltext0
+	.uleb128 0x1
+	.byte	0x61
+	.byte	0
+.LVUS797:
+	.uleb128 .LVU1676
+	.uleb128 .LVU1678
+.LLST797:
+	.byte	0x4
+	.uleb128 .LVL266-.Ltext0
+	.uleb128 .LVL266-.Ltext0
+	.uleb128 0x1
+	.byte	0x69
+	.byte	0
+.LVUS798:
+	.uleb128 .LVU1678
+	.uleb128 .LVU1682
+.LLST798:
+	.byte	0x4
+	.uleb128 .LVL266-.Ltext0
+	.uleb128 .LVL267-.Ltext0
+	.uleb128 0x1
+	.byte	0x6c
+	.byte	0
+.LVUS800:
+	.uleb128 .LVU1685
+	.uleb128 .LVU1687
+.LLST800:
+	.byte	0x4
+	.uleb128 .LVL268-.Ltext0
+	.uleb128 .LVL268-.Ltext0
+	.uleb128 0x1
+	.byte	0x6c
+	.byte	0
+.LVUS801:
+	.uleb128 .LVU1685
+	.uleb128 .LVU1687
+.LLST801:
+	.byte	0x4
+	.uleb128 .LVL268-.Ltext0
+	.uleb128 .LVL268-.Ltext0
+	.uleb128 0x1
+	.byte	0x62
+	.byte	0
+.LVUS803:
+	.uleb128 .LVU1692
+	.uleb128 .LVU1694
+.LLST803:
+	.byte	0x4
+	.uleb128 .LVL269-.Ltext0
+	.uleb128 .LVL270-.Ltext0
+	.uleb128 0x1
+	.byte	0x62
+	.byte	0
+.LVUS805:
+	.uleb128 .LVU1860
+	.uleb128 .LVU1862
+.LLST805:
+	.byte	0x4
+	.uleb128 .LVL300-.Ltext0
+	.uleb128 .LVL300-.Ltext0
+	.uleb128 0x3
+	.byte	0x8
+	.byte	0x24
+	.byte	0x9f
+	.byte	0
+.LVUS806:
+	.uleb128 .LVU1860
+	.uleb128 .LVU1862
+.LLST806:
+	.byte	0x4
+	.uleb128 .LVL300-.Ltext0
+	.uleb128 .LVL300-.Ltext0
+	.uleb128 0x1
+	.byte	0x65
+	.byte	0
+.LVUS807:
+	.uleb128 .LVU1696
+	.uleb128 .LVU1699
+.LLST807:
+	.byte	0x4
+	.uleb128 .LVL270-.Ltext0
+	.uleb128 .LVL271-.Ltext0
+	.uleb128 0x1
+	.byte	0x62
+	.byte	0
+.LVUS808:
+	.uleb128 .LVU1696
+	.uleb128 .LVU1699
+.LLST808:
+	.byte	0x4
+	.uleb128 .LVL270-.Ltext0
+	.uleb128 .LVL271-.Ltext0
+	.uleb128 0x1
+	.byte	0x63
+	.byte	0
+.LVUS810:
+	.uleb128 .LVU1701
+	.uleb128 .LVU1703
+.LLST810:
+	.byte	0x4
+	.uleb128 .LVL271-.Ltext0
+	.uleb128 .LVL271-.Ltext0
+	.uleb128 0x1
+	.byte	0x63
+	.byte	0
+.LVUS811:
+	.uleb128 .LVU1701
+	.uleb128 .LVU1703
+.LLST811:
+	.byte	0x4
+	.uleb128 .LVL271-.Ltext0
+	.uleb128 .LVL271-.Ltext0
+	.uleb128 0x1
+	.byte	0x61
+	.byte	0
+.LVUS813:
+	.uleb128 .LVU1703
+	.uleb128 .LVU1716
+.LLST813:
+	.byte	0x4
+	.uleb128 .LVL271-.Ltext0
+	.uleb128 .LVL276-.Ltext0
+	.uleb128 0x2
+	.byte	0x49
+	.byte	0x9f
+	.byte	0
+.LVUS814:
+	.uleb128 .LVU1709
+	.uleb128 .LVU1714
+.LLST814:
+	.byte	0x4
+	.uleb128 .LVL273-.Ltext0
+	.uleb128 .LVL275-.Ltext0
+	.uleb128 0x1
+	.byte	0x61
+	.byte	0
+.LVUS816:
+	.uleb128 .LVU1736
+	.uleb128 .LVU1738
+.LLST816:
+	.byte	0x4
+	.uleb128 .LVL278-.Ltext0
+	.uleb128 .LVL278-.Ltext0
+	.uleb128 0x3
+	.byte	0x8
+	.byte	0x93
+	.byte	0x9f
+	.byte	0
+.LVUS818:
+	.uleb128 .LVU1732
+	.uleb128 .LVU1734
+.LLST818:
+	.byte	0x4
+	.uleb128 .LVL278-.Ltext0
+	.uleb128 .LVL278-.Ltext0
+	.uleb128 0x3
+	.byte	0x8
+	.byte	0x4e
+	.byte	0x9f
+	.byte	0
+.LVUS820:
+	.uleb128 .LVU1716
+	.uleb128 .LVU1719
+.LLST820:
+	.byte	0x4
+	.uleb128 .LVL276-.Ltext0
+	.uleb128 .LVL276-.Ltext0
+	.uleb128 0x2
+	.byte	0x37
+	.byte	0x9f
+	.byte	0
+.LVUS822:
+	.uleb128 .LVU1719
+	.uleb128 .LVU1722
+.LLST822:
+	.byte	0x4
+	.uleb128 .LVL276-.Ltext0
+	.uleb128 .LVL276-.Ltext0
+	.uleb128 0x1
+	.byte	0x6a
+	.byte	0
+.LVUS823:
+	.uleb128 .LVU1719
+	.uleb128 .LVU1722
+.LLST823:
+	.byte	0x4
+	.uleb128 .LVL276-.Ltext0
+	.uleb128 .LVL276-.Ltext0
+	.uleb128 0x1
+	.byte	0x61
+	.byte	0
+.LVUS825:
+	.uleb128 .LVU1725
+	.uleb128 .LVU1730
+.LLST825:
+	.byte	0x4
+	.uleb128 .LVL276-.Ltext0
+	.uleb128 .LVL278-.Ltext0
+	.uleb128 0x3
+	.byte	0x8
+	.byte	0x39
+	.byte	0x9f
+	.byte	0
+.LVUS826:
+	.uleb128 .LVU1728
+	.uleb128 .LVU1730
+.LLST826:
+	.byte	0x4
+	.uleb128 .LVL277-.Ltext0
+	.uleb128 .LVL278-.Ltext0
+	.uleb128 0x1
+	.byte	0x61
+	.byte	0
+.LVUS827:
+	.uleb128 .LVU1741
+	.uleb128 .LVU1743
+.LLST827:
+	.byte	0x4
+	.uleb128 .LVL278-.Ltext0
+	.uleb128 .LVL278-.Ltext0
+	.uleb128 0x1
+	.byte	0x61
+	.byte	0
+.LVUS828:
+	.uleb128 .LVU1741
+	.uleb128 .LVU1743
+.LLST828:
+	.byte	0x4
+	.uleb128 .LVL278-.Ltext0
+	.uleb128 .LVL278-.Ltext0
+	.uleb128 0x1
+	.byte	0x6c
+	.byte	0
+.LVUS829:
+	.uleb128 .LVU1743
+	.uleb128 .LVU1747
+.LLST829:
+	.byte	0x4
+	.uleb128 .LVL278-.Ltext0
+	.uleb128 .LVL279-.Ltext0
+	.uleb128 0x1
+	.byte	0x6b
+	.byte	0
+.LVUS831:
+	.uleb128 .LVU1750
+	.uleb128 .LVU1752
+.LLST831:
+	.byte	0x4
+	.uleb128 .LVL280-.Ltext0
+	.uleb128 .LVL280-.Ltext0
+	.uleb128 0x1
+	.byte	0x6b
+	.byte	0
+.LVUS832:
+	.uleb128 .LVU1750
+	.uleb128 .LVU1752
+.LLST832:
+	.byte	0x4
+	.uleb128 .LVL280-.Ltext0
+	.uleb128 .LVL280-.Ltext0
+	.uleb128 0x1
+	.byte	0x62
+	.byte	0
+.LVUS834:
+	.uleb128 .LVU1756
+	.uleb128 .LVU1758
+.LLST834:
+	.byte	0x4
+	.uleb128 .LVL281-.Ltext0
+	.uleb128 .LVL282-.Ltext0
+	.uleb128 0x1
+	.byte	0x62
+	.byte	0
+.LVUS835:
+	.uleb128 .LVU1760
+	.uleb128 .LVU1763
+.LLST835:
+	.byte	0x4
+	.uleb128 .LVL282-.Ltext0
+	.uleb128 .LVL283-.Ltext0
+	.uleb128 0x1
+	.byte	0x62
+	.byte	0
+.LVUS836:
+	.uleb128 .LVU1760
+	.uleb128 .LVU1763
+.LLST836:
+	.byte	0x4
+	.uleb128 .LVL282-.Ltext0
+	.uleb128 .LVL283-.Ltext0
+	.uleb128 0x1
+	.byte	0x63
+	.byte	0
+.LVUS838:
+	.uleb128 .LVU1765
+	.uleb128 .LVU1767
+.LLST838:
+	.byte	0x4
+	.uleb128 .LVL283-.Ltext0
+	.uleb128 .LVL283-.Ltext0
+	.uleb128 0x1
+	.byte	0x63
+	.byte	0
+.LVUS839:
+	.uleb128 .LVU1765
+	.uleb128 .LVU1767
+.LLST839:
+	.byte	0x4
+	.uleb128 .LVL283-.Ltext0
+	.uleb128 .LVL283-.Ltext0
+	.uleb128 0x1
+	.byte	0x61
+	.byte	0
+.LVUS841:
+	.uleb128 .LVU1767
+	.uleb128 .LVU1776
+.LLST841:
+	.byte	0x4
+	.uleb128 .LVL283-.Ltext0
+	.uleb128 .LVL286-.Ltext0
+	.uleb128 0x2
+	.byte	0x44
+	.byte	0x9f
+	.byte	0
+.LVUS842:
+	.uleb128 .LVU1771
+	.uleb128 .LVU1774
+.LLST842:
+	.byte	0x4
+	.uleb128 .LVL284-.Ltext0
+	.uleb128 .LVL285-.Ltext0
+	.uleb128 0x1
+	.byte	0x61
+	.byte	0
+.LVUS844:
+	.uleb128 .LVU1776
+	.uleb128 .LVU1779
+.LLST844:
+	.byte	0x4
+	.uleb128 .LVL286-.Ltext0
+	.uleb128 .LVL286-.Ltext0
+	.uleb128 0x2
+	.byte	0x3c
+	.byte	0x9f
+	.byte	0
+.LVUS845:
+	.uleb128 .LVU1779
+	.uleb128 .LVU1783
+.LLST845:
+	.byte	0x4
+	.uleb128 .LVL286-.Ltext0
+	.uleb128 .LVL287-.Ltext0
+	.uleb128 0x1
+	.byte	0x6a
+	.byte	0
+.LVUS846:
+	.uleb128 .LVU1779
+	.uleb128 .LVU1783
+.LLST846:
+	.byte	0x4
+	.uleb128 .LVL286-.Ltext0
+	.uleb128 .LVL287-.Ltext0
+	.uleb128 0x1
+	.byte	0x61
+	.byte	0
+.LVUS847:
+	.uleb128 .LVU1785
+	.uleb128 .LVU1787
+.LLST847:
+	.byte	0x4
+	.uleb128 .LVL287-.Ltext0
+	.uleb128 .LVL287-.Ltext0
+	.uleb128 0x1
+	.byte	0x61
+	.byte	0
+.LVUS848:
+	.uleb128 .LVU1785
+	.uleb128 .LVU1787
+.LLST848:
+	.byte	0x4
+	.uleb128 .LVL287-.Ltext0
+	.uleb128 .LVL287-.Ltext0
+	.uleb128 0x1
+	.byte	0x6b
+	.byte	0
+.LVUS849:
+	.uleb128 .LVU1787
+	.uleb128 .LVU1791
+.LLST849:
+	.byte	0x4
+	.uleb128 .LVL287-.Ltext0
+	.uleb128 .LVL288-.Ltext0
+	.uleb128 0x1
+	.byte	0x68
+	.byte	0
+.LVUS851:
+	.uleb128 .LVU1794
+	.uleb128 .LVU1796
+.LLST851:
+	.byte	0x4
+	.uleb128 .LVL289-.Ltext0
+	.uleb128 .LVL289-.Ltext0
+	.uleb128 0x1
+	.byte	0x68
+	.byte	0
+.LVUS852:
+	.uleb128 .LVU1794
+	.uleb128 .LVU1796
+.LLST852:
+	.byte	0x4
+	.uleb128 .LVL289-.Ltext0
+	.uleb128 .LVL289-.Ltext0
+	.uleb128 0x1
+	.byte	0x62
+	.byte	0
+.LVUS854:
+	.uleb128 .LVU1801
+	.uleb128 .LVU1803
+.LLST854:
+	.byte	0x4
+	.uleb128 .LVL290-.Ltext0
+	.uleb128 .LVL291-.Ltext0
+	.uleb128 0x1
+	.byte	0x62
+	.byte	0
+.LVUS856:
+	.uleb128 .LVU1886
+	.uleb128 .LVU1888
+.LLST856:
+	.byte	0x4
+	.uleb128 .LVL304-.Ltext0
+	.uleb128 .LVL304-.Ltext0
+	.uleb128 0x3
+	.byte	0x8
+	.byte	0xa4
+	.byte	0x9f
+	.byte	0
+.LVUS857:
+	.uleb128 .LVU1886
+	.uleb128 .LVU1888
+.LLST857:
+	.byte	0x4
+	.uleb128 .LVL304-.Ltext0
+	.uleb128 .LVL304-.Ltext0
+	.uleb128 0x1
+	.byte	0x66
+	.byte	0
+.LVUS858:
+	.uleb128 .LVU1805
+	.uleb128 .LVU1808
+.LLST858:
+	.byte	0x4
+	.uleb128 .LVL291-.Ltext0
+	.uleb128 .LVL292-.Ltext0
+	.uleb128 0x1
+	.byte	0x62
+	.byte	0
+.LVUS859:
+	.uleb128 .LVU1805
+	.uleb128 .LVU1808
+.LLST859:
+	.byte	0x4
+	.uleb128 .LVL291-.Ltext0
+	.uleb128 .LVL292-.Ltext0
+	.uleb128 0x1
+	.byte	0x63
+	.byte	0
+.LVUS861:
+	.uleb128 .LVU1810
+	.uleb128 .LVU1812
+.LLST861:
+	.byte	0x4
+	.uleb128 .LVL292-.Ltext0
+	.uleb128 .LVL292-.Ltext0
+	.uleb128 0x1
+	.byte	0x63
+	.byte	0
+.LVUS862:
+	.uleb128 .LVU1810
+	.uleb128 .LVU1812
+.LLST862:
+	.byte	0x4
+	.uleb128 .LVL292-.Ltext0
+	.uleb128 .LVL292-.Ltext0
+	.uleb128 0x1
+	.byte	0x61
+	.byte	0
+.LVUS864:
+	.uleb128 .LVU1812
+	.uleb128 .LVU1825
+.LLST864:
+	.byte	0x4
+	.uleb128 .LVL292-.Ltext0
+	.uleb128 .LVL297-.Ltext0
+	.uleb128 0x2
+	.byte	0x49
+	.byte	0x9f
+	.byte	0
+.LVUS865:
+	.uleb128 .LVU1818
+	.uleb128 .LVU1823
+.LLST865:
+	.byte	0x4
+	.uleb128 .LVL294-.Ltext0
+	.uleb128 .LVL296-.Ltext0
+	.uleb128 0x1
+	.byte	0x61
+	.byte	0
+.LVUS867:
+	.uleb128 .LVU1846
+	.uleb128 .LVU1848
+.LLST867:
+	.byte	0x4
+	.uleb128 .LVL299-.Ltext0
+	.uleb128 .LVL299-.Ltext0
+	.uleb128 0x3
+	.byte	0x8
+	.byte	0x39
+	.byte	0x9f
+	.byte	0
+.LVUS869:
+	.uleb128 .LVU1842
+	.uleb128 .LVU1844
+.LLST869:
+	.byte	0x4
+	.uleb128 .LVL299-.Ltext0
+	.uleb128 .LVL299-.Ltext0
+	.uleb128 0x3
+	.byte	0x8
+	.byte	0x4e
+	.byte	0x9f
+	.byte	0
+.LVUS871:
+	.uleb128 .LVU1825
+	.uleb128 .LVU1828
+.LLST871:
+	.byte	0x4
+	.uleb128 .LVL297-.Ltext0
+	.uleb128 .LVL297-.Ltext0
+	.uleb128 0x2
+	.byte	0x37
+	.byte	0x9f
+	.byte	0
+.LVUS873:
+	.uleb128 .LVU1828
+	.uleb128 .LVU1831
+.LLST873:
+	.byte	0x4
+	.uleb128 .LVL297-.Ltext0
+	.uleb128 .LVL297-.Ltext0
+	.uleb128 0x1
+	.byte	0x6a
+	.byte	0
+.LVUS874:
+	.uleb128 .LVU1828
+	.uleb128 .LVU1831
+.LLST874:
+	.byte	0x4
+	.uleb128 .LVL297-.Ltext0
+	.uleb128 .LVL297-.Ltext0
+	.uleb128 0x1
+	.byte	0x61
+	.byte	0
+.LVUS876:
+	.uleb128 .LVU1834
+	.uleb128 .LVU1840
+.LLST876:
+	.byte	0x4
+	.uleb128 .LVL297-.Ltext0
+	.uleb128 .LVL299-.Ltext0
+	.uleb128 0x3
+	.byte	0x8
+	.byte	0x93
+	.byte	0x9f
+	.byte	0
+.LVUS877:
+	.uleb128 .LVU1837
+	.uleb128 .LVU1840
+.LLST877:
+	.byte	0x4
+	.uleb128 .LVL298-.Ltext0
+	.uleb128 .LVL299-.Ltext0
+	.uleb128 0x1
+	.byte	0x61
+	.byte	0
+.LVUS879:
+	.uleb128 .LVU1855
+	.uleb128 .LVU1858
+.LLST879:
+	.byte	0x4
+	.uleb128 .LVL299-.Ltext0
+	.uleb128 .LVL300-.Ltext0
+	.uleb128 0x2
+	.byte	0x3c
+	.byte	0x9f
+	.byte	0
+.LVUS880:
+	.uleb128 .LVU1855
+	.uleb128 .LVU1858
+.LLST880:
+	.byte	0x4
+	.uleb128 .LVL299-.Ltext0
+	.uleb128 .LVL300-.Ltext0
+	.uleb128 0x1
+	.byte	0x64
+	.byte	0
+.LVUS881:
+	.uleb128 .LVU1855
+	.uleb128 .LVU1858
+.LLST881:
+	.byte	0x4
+	.uleb128 .LVL299-.Ltext0
+	.uleb128 .LVL300-.Ltext0
+	.uleb128 0x1
+	.byte	0x67
+	.byte	0
+.LVUS883:
+	.uleb128 .LVU1864
+	.uleb128 .LVU1868
+.LLST883:
+	.byte	0x4
+	.uleb128 .LVL300-.Ltext0
+	.uleb128 .LVL301-.Ltext0
+	.uleb128 0x3
+	.byte	0x8
+	.byte	0xc0
+	.byte	0x9f
+	.byte	0
+.LVUS884:
+	.uleb128 .LVU1864
+	.uleb128 .LVU1868
+.LLST884:
+	.byte	0x4
+	.uleb128 .LVL300-.Ltext0
+	.uleb128 .LVL301-.Ltext0
+	.uleb128 0x1
+	.byte	0x69
+	.byte	0
+.LVUS885:
+	.uleb128 .LVU1864
+	.uleb128 .LVU1868
+.LLST885:
+	.byte	0x4
+	.uleb128 .LVL300-.Ltext0
+	.uleb128 .LVL301-.Ltext0
+	.uleb128 0x1
+	.byte	0x6f
+	.byte	0
+.LVUS887:
+	.uleb128 .LVU1870
+	.uleb128 .LVU1872
+.LLST887:
+	.byte	0x4
+	.uleb128 .LVL301-.Ltext0
+	.uleb128 .LVL301-.Ltext0
+	.uleb128 0x3
+	.byte	0x8
+	.byte	0xe5
+	.byte	0x9f
+	.byte	0
+.LVUS888:
+	.uleb128 .LVU1870
+	.uleb128 .LVU1872
+.LLST888:
+	.byte	0x4
+	.uleb128 .LVL301-.Ltext0
+	.uleb128 .LVL301-.Ltext0
+	.uleb128 0x1
+	.byte	0x65
+	.byte	0
+.LVUS889:
+	.uleb128 .LVU1874
+	.uleb128 .LVU1877
+.LLST889:
+	.byte	0x4
+	.uleb128 .LVL301-.Ltext0
+	.uleb128 .LVL302-.Ltext0
+	.uleb128 0x3
+	.byte	0x8
+	.byte	0xdc
+	.byte	0x9f
+	.byte	0
+.LVUS890:
+	.uleb128 .LVU1874
+	.uleb128 .LVU1877
+.LLST890:
+	.byte	0x4
+	.uleb128 .LVL301-.Ltext0
+	.uleb128 .LVL302-.Ltext0
+	.uleb128 0x1
+	.byte	0x67
+	.byte	0
+.LVUS892:
+	.uleb128 .LVU1879
+	.uleb128 .LVU1884
+.LLST892:
+	.byte	0x4
+	.uleb128 .LVL302-.Ltext0
+	.uleb128 .LVL304-.Ltext0
+	.uleb128 0x3
+	.byte	0x8
+	.byte	0x3c
+	.byte	0x9f
+	.byte	0
+.LVUS893:
+	.uleb128 .LVU1879
+	.uleb128 .LVU1884
+.LLST893:
+	.byte	0x4
+	.uleb128 .LVL302-.Ltext0
+	.uleb128 .LVL304-.Ltext0
+	.uleb128 0x1
+	.byte	0x69
+	.byte	0
+.LVUS894:
+	.uleb128 .LVU1879
+	.uleb128 .LVU1884
+.LLST894:
+	.byte	0x4
+	.uleb128 .LVL302-.Ltext0
+	.uleb128 .LVL304-.Ltext0
+	.uleb128 0x1
+	.byte	0x6a
+	.byte	0
+.LVUS897:
+	.uleb128 .LVU1890
+	.uleb128 .LVU1895
+.LLST897:
+	.byte	0x4
+	.uleb128 .LVL304-.Ltext0
+	.uleb128 .LVL305-.Ltext0
+	.uleb128 0x3
+	.byte	0x8
+	.byte	0xc0
+	.byte	0x9f
+	.byte	0
+.LVUS898:
+	.uleb128 .LVU1890
+	.uleb128 .LVU1895
+.LLST898:
+	.byte	0x4
+	.uleb128 .LVL304-.Ltext0
+	.uleb128 .LVL305-.Ltext0
+	.uleb128 0x1
+	.byte	0x6b
+	.byte	0
+.LVUS899:
+	.uleb128 .LVU1890
+	.uleb128 .LVU1895
+.LLST899:
+	.byte	0x4
+	.uleb128 .LVL304-.Ltext0
+	.uleb128 .LVL305-.Ltext0
+	.uleb128 0x1
+	.byte	0x6a
+	.byte	0
+.LVUS901:
+	.uleb128 .LVU1903
+	.uleb128 .LVU1905
+.LLST901:
+	.byte	0x4
+	.uleb128 .LVL305-.Ltext0
+	.uleb128 .LVL305-.Ltext0
+	.uleb128 0x2
+	.byte	0x44
+	.byte	0x9f
+	.byte	0
+.LVUS902:
+	.uleb128 .LVU1903
+	.uleb128 .LVU1905
+.LLST902:
+	.byte	0x4
+	.uleb128 .LVL305-.Ltext0
+	.uleb128 .LVL305-.Ltext0
+	.uleb128 0x1
+	.byte	0x66
+	.byte	0
+.LVUS903:
+	.uleb128 .LVU1907
+	.uleb128 .LVU1910
+.LLST903:
+	.byte	0x4
+	.uleb128 .LVL305-.Ltext0
+	.uleb128 .LVL306-.Ltext0
+	.uleb128 0x3
+	.byte	0x8
+	.byte	0xf0
+	.byte	0x9f
+	.byte	0
+.LVUS904:
+	.uleb128 .LVU1907
+	.uleb128 .LVU1910
+.LLST904:
+	.byte	0x4
+	.uleb128 .LVL305-.Ltext0
+	.uleb128 .LVL306-.Ltext0
+	.uleb128 0x1
+	.byte	0x69
+	.byte	0
+.LVUS905:
+	.uleb128 .LVU1907
+	.uleb128 .LVU1910
+.LLST905:
+	.byte	0x4
+	.uleb128 .LVL305-.Ltext0
+	.uleb128 .LVL306-.Ltext0
+	.uleb128 0x1
+	.byte	0x6e
+	.byte	0
+.LVUS906:
+	.uleb128 .LVU1925
+	.uleb128 .LVU1927
+.LLST906:
+	.byte	0x4
+	.uleb128 .LVL306-.Ltext0
+	.uleb128 .LVL306-.Ltext0
+	.uleb128 0x1
+	.byte	0x61
+	.byte	0
+.LVUS907:
+	.uleb128 .LVU1925
+	.uleb128 .LVU1927
+.LLST907:
+	.byte	0x4
+	.uleb128 .LVL306-.Ltext0
+	.uleb128 .LVL306-.Ltext0
+	.uleb128 0x1
+	.byte	0x68
+	.byte	0
+.LVUS909:
+	.uleb128 .LVU1932
+	.uleb128 .LVU1934
+.LLST909:
+	.byte	0x4
+	.uleb128 .LVL306-.Ltext0
+	.uleb128 .LVL306-.Ltext0
+	.uleb128 0x1
+	.byte	0x6f
+	.byte	0
+.LVUS910:
+	.uleb128 .LVU1932
+	.uleb128 .LVU1934
+.LLST910:
+	.byte	0x4
+	.uleb128 .LVL306-.Ltext0
+	.uleb128 .LVL306-.Ltext0
+	.uleb128 0x1
+	.byte	0x62
+	.byte	0
+.LVUS912:
+	.uleb128 .LVU1938
+	.uleb128 .LVU1941
+.LLST912:
+	.byte	0x4
+	.uleb128 .LVL307-.Ltext0
+	.uleb128 .LVL308-.Ltext0
+	.uleb128 0x1
+	.byte	0x62
+	.byte	0
+.LVUS914:
+	.uleb128 .LVU2163
+	.uleb128 .LVU2165
+.LLST914:
+	.byte	0x4
+	.uleb128 .LVL346-.Ltext0
+	.uleb128 .LVL346-.Ltext0
+	.uleb128 0x3
+	.byte	0x8
+	.byte	0x67
+	.byte	0x9f
+	.byte	0
+.LVUS915:
+	.uleb128 .LVU2163
+	.uleb128 .LVU2165
+.LLST915:
+	.byte	0x4
+	.uleb128 .LVL346-.Ltext0
+	.uleb128 .LVL346-.Ltext0
+	.uleb128 0x1
+	.byte	0x66
+	.byte	0
+.LVUS916:
+	.uleb128 .LVU1943
+	.uleb128 .LVU1946
+.LLST916:
+	.byte	0x4
+	.uleb128 .LVL308-.Ltext0
+	.uleb128 .LVL309-.Ltext0
+	.uleb128 0x1
+	.byte	0x62
+	.byte	0
+.LVUS917:
+	.uleb128 .LVU1943
+	.uleb128 .LVU1946
+.LLST917:
+	.byte	0x4
+	.uleb128 .LVL308-.Ltext0
+	.uleb128 .LVL309-.Ltext0
+	.uleb128 0x1
+	.byte	0x63
+	.byte	0
+.LVUS919:
+	.uleb128 .LVU1948
+	.uleb128 .LVU1950
+.LLST919:
+	.byte	0x4
+	.uleb128 .LVL309-.Ltext0
+	.uleb128 .LVL309-.Ltext0
+	.uleb128 0x1
+	.byte	0x63
+	.byte	0
+.LVUS920:
+	.uleb128 .LVU1948
+	.uleb128 .LVU1950
+.LLST920:
+	.byte	0x4
+	.uleb128 .LVL309-.Ltext0
+	.uleb128 .LVL309-.Ltext0
+	.uleb128 0x1
+	.byte	0x61
+	.byte	0
+.LVUS922:
+	.uleb128 .LVU1950
+	.uleb128 .LVU1959
+.LLST922:
+	.byte	0x4
+	.uleb128 .LVL309-.Ltext0
+	.uleb128 .LVL312-.Ltext0
+	.uleb128 0x2
+	.byte	0x44
+	.byte	0x9f
+	.byte	0
+.LVUS923:
+	.uleb128 .LVU1954
+	.uleb128 .LVU1957
+.LLST923:
+	.byte	0x4
+	.uleb128 .LVL310-.Ltext0
+	.uleb128 .LVL311-.Ltext0
+	.uleb128 0x1
+	.byte	0x61
+	.byte	0
+.LVUS925:
+	.uleb128 .LVU1959
+	.uleb128 .LVU1962
+.LLST925:
+	.byte	0x4
+	.uleb128 .LVL312-.Ltext0
+	.uleb128 .LVL312-.Ltext0
+	.uleb128 0x2
+	.byte	0x3c
+	.byte	0x9f
+	.byte	0
+.LVUS926:
+	.uleb128 .LVU1962
+	.uleb128 .LVU1966
+.LLST926:
+	.byte	0x4
+	.uleb128 .LVL312-.Ltext0
+	.uleb128 .LVL313-.Ltext0
+	.uleb128 0x1
+	.byte	0x6c
+	.byte	0
+.LVUS927:
+	.uleb128 .LVU1962
+	.uleb128 .LVU1966
+.LLST927:
+	.byte	0x4
+	.uleb128 .LVL312-.Ltext0
+	.uleb128 .LVL313-.Ltext0
+	.uleb128 0x1
+	.byte	0x61
+	.byte	0
+.LVUS928:
+	.uleb128 .LVU1968
+	.uleb128 .LVU1970
+.LLST928:
+	.byte	0x4
+	.uleb128 .LVL313-.Ltext0
+	.uleb128 .LVL313-.Ltext0
+	.uleb128 0x1
+	.byte	0x61
+	.byte	0
+.LVUS929:
+	.uleb128 .LVU1968
+	.uleb128 .LVU1970
+.LLST929:
+	.byte	0x4
+	.uleb128 .LVL313-.Ltext0
+	.uleb128 .LVL313-.Ltext0
+	.uleb128 0x1
+	.byte	0x6f
+	.byte	0
+.LVUS930:
+	.uleb128 .LVU1970
+	.uleb128 .LVU1974
+.LLST930:
+	.byte	0x4
+	.uleb128 .LVL313-.Ltext0
+	.uleb128 .LVL314-.Ltext0
+	.uleb128 0x1
+	.byte	0x6a
+	.byte	0
+.LVUS932:
+	.uleb128 .LVU1977
+	.uleb128 .LVU1979
+.LLST932:
+	.byte	0x4
+	.uleb128 .LVL315-.Ltext0
+	.uleb128 .LVL315-.Ltext0
+	.uleb128 0x1
+	.byte	0x6a
+	.byte	0
+.LVUS933:
+	.uleb128 .LVU1977
+	.uleb128 .LVU1979
+.LLST933:
+	.byte	0x4
+	.uleb128 .LVL315-.Ltext0
+	.uleb128 .LVL315-.Ltext0
+	.uleb128 0x1
+	.byte	0x62
+	.byte	0
+.LVUS935:
+	.uleb128 .LVU1984
+	.uleb128 .LVU1986
+.LLST935:
+	.byte	0x4
+	.uleb128 .LVL316-.Ltext0
+	.uleb128 .LVL317-.Ltext0
+	.uleb128 0x1
+	.byte	0x62
+	.byte	0
+.LVUS937:
+	.uleb128 .LVU2176
+	.uleb128 .LVU2178
+.LLST937:
+	.byte	0x4
+	.uleb128 .LVL346-.Ltext0
+	.uleb128 .LVL346-.Ltext0
+	.uleb128 0x3
+	.byte	0x8
+	.byte	0x30
+	.byte	0x9f
+	.byte	0
+.LVUS938:
+	.uleb128 .LVU1988
+	.uleb128 .LVU1991
+.LLST938:
+	.byte	0x4
+	.uleb128 .LVL317-.Ltext0
+	.uleb128 .LVL318-.Ltext0
+	.uleb128 0x1
+	.byte	0x62
+	.byte	0
+.LVUS939:
+	.uleb128 .LVU1988
+	.uleb128 .LVU1991
+.LLST939:
+	.byte	0x4
+	.uleb128 .LVL317-.Ltext0
+	.uleb128 .LVL318-.Ltext0
+	.uleb128 0x1
+	.byte	0x63
+	.byte	0
+.LVUS941:
+	.uleb128 .LVU1993
+	.uleb128 .LVU1995
+.LLST941:
+	.byte	0x4
+	.uleb128 .LVL318-.Ltext0
+	.uleb128 .LVL318-.Ltext0
+	.uleb128 0x1
+	.byte	0x63
+	.byte	0
+.LVUS942:
+	.uleb128 .LVU1993
+	.uleb128 .LVU1995
+.LLST942:
+	.byte	0x4
+	.uleb128 .LVL318-.Ltext0
+	.uleb128 .LVL318-.Ltext0
+	.uleb128 0x1
+	.byte	0x61
+	.byte	0
+.LVUS944:
+	.uleb128 .LVU1995
+	.uleb128 .LVU2008
+.LLST944:
+	.byte	0x4
+	.uleb128 .LVL318-.Ltext0
+	.uleb128 .LVL323-.Ltext0
+	.uleb128 0x2
+	.byte	0x49
+	.byte	0x9f
+	.byte	0
+.LVUS945:
+	.uleb128 .LVU2001
+	.uleb128 .LVU2006
+.LLST945:
+	.byte	0x4
+	.uleb128 .LVL320-.Ltext0
+	.uleb128 .LVL322-.Ltext0
+	.uleb128 0x1
+	.byte	0x61
+	.byte	0
+.LVUS947:
+	.uleb128 .LVU2028
+	.uleb128 .LVU2030
+.LLST947:
+	.byte	0x4
+	.uleb128 .LVL325-.Ltext0
+	.uleb128 .LVL325-.Ltext0
+	.uleb128 0x3
+	.byte	0x8
+	.byte	0x93
+	.byte	0x9f
+	.byte	0
+.LVUS949:
+	.uleb128 .LVU2024
+	.uleb128 .LVU2026
+.LLST949:
+	.byte	0x4
+	.uleb128 .LVL325-.Ltext0
+	.uleb128 .LVL325-.Ltext0
+	.uleb128 0x3
+	.byte	0x8
+	.byte	0x4e
+	.byte	0x9f
+	.byte	0
+.LVUS951:
+	.uleb128 .LVU2008
+	.uleb128 .LVU2011
+.LLST951:
+	.byte	0x4
+	.uleb128 .LVL323-.Ltext0
+	.uleb128 .LVL323-.Ltext0
+	.uleb128 0x2
+	.byte	0x37
+	.byte	0x9f
+	.byte	0
+.LVUS953:
+	.uleb128 .LVU2011
+	.uleb128 .LVU2014
+.LLST953:
+	.byte	0x4
+	.uleb128 .LVL323-.Ltext0
+	.uleb128 .LVL323-.Ltext0
+	.uleb128 0x1
+	.byte	0x6c
+	.byte	0
+.LVUS954:
+	.uleb128 .LVU2011
+	.uleb128 .LVU2014
+.LLST954:
+	.byte	0x4
+	.uleb128 .LVL323-.Ltext0
+	.uleb128 .LVL323-.Ltext0
+	.uleb128 0x1
+	.byte	0x61
+	.byte	0
+.LVUS956:
+	.uleb128 .LVU2017
+	.uleb128 .LVU2022
+.LLST956:
+	.byte	0x4
+	.uleb128 .LVL323-.Ltext0
+	.uleb128 .LVL325-.Ltext0
+	.uleb128 0x3
+	.byte	0x8
+	.byte	0x39
+	.byte	0x9f
+	.byte	0
+.LVUS957:
+	.uleb128 .LVU2020
+	.uleb128 .LVU2022
+.LLST957:
+	.byte	0x4
+	.uleb128 .LVL324-.Ltext0
+	.uleb128 .LVL325-.Ltext0
+	.uleb128 0x1
+	.byte	0x61
+	.byte	0
+.LVUS958:
+	.uleb128 .LVU2033
+	.uleb128 .LVU2035
+.LLST958:
+	.byte	0x4
+	.uleb128 .LVL325-.Ltext0
+	.uleb128 .LVL325-.Ltext0
+	.uleb128 0x1
+	.byte	0x61
+	.byte	0
+.LVUS959:
+	.uleb128 .LVU2033
+	.uleb128 .LVU2035
+.LLST959:
+	.byte	0x4
+	.uleb128 .LVL325-.Ltext0
+	.uleb128 .LVL325-.Ltext0
+	.uleb128 0x1
+	.byte	0x6a
+	.byte	0
+.LVUS960:
+	.uleb128 .LVU2035
+	.uleb128 .LVU2039
+.LLST960:
+	.byte	0x4
+	.uleb128 .LVL325-.Ltext0
+	.uleb128 .LVL326-.Ltext0
+	.uleb128 0x1
+	.byte	0x6e
+	.byte	0
+.LVUS962:
+	.uleb128 .LVU2042
+	.uleb128 .LVU2044
+.LLST962:
+	.byte	0x4
+	.uleb128 .LVL327-.Ltext0
+	.uleb128 .LVL327-.Ltext0
+	.uleb128 0x1
+	.byte	0x6e
+	.byte	0
+.LVUS963:
+	.uleb128 .LVU2042
+	.uleb128 .LVU2044
+.LLST963:
+	.byte	0x4
+	.uleb128 .LVL327-.Ltext0
+	.uleb128 .LVL327-.Ltext0
+	.uleb128 0x1
+	.byte	0x62
+	.byte	0
+.LVUS965:
+	.uleb128 .LVU2048
+	.uleb128 .LVU2050
+.LLST965:
+	.byte	0x4
+	.uleb128 .LVL328-.Ltext0
+	.uleb128 .LVL329-.Ltext0
+	.uleb128 0x1
+	.byte	0x62
+	.byte	0
+.LVUS966:
+	.uleb128 .LVU2052
+	.uleb128 .LVU2055
+.LLST966:
+	.byte	0x4
+	.uleb128 .LVL329-.Ltext0
+	.uleb128 .LVL330-.Ltext0
+	.uleb128 0x1
+	.byte	0x62
+	.byte	0
+.LVUS967:
+	.uleb128 .LVU2052
+	.uleb128 .LVU2055
+.LLST967:
+	.byte	0x4
+	.uleb128 .LVL329-.Ltext0
+	.uleb128 .LVL330-.Ltext0
+	.uleb128 0x1
+	.byte	0x63
+	.byte	0
+.LVUS969:
+	.uleb128 .LVU2057
+	.uleb128 .LVU2059
+.LLST969:
+	.byte	0x4
+	.uleb128 .LVL330-.Ltext0
+	.uleb128 .LVL330-.Ltext0
+	.uleb128 0x1
+	.byte	0x63
+	.byte	0
+.LVUS970:
+	.uleb128 .LVU2057
+	.uleb128 .LVU2059
+.LLST970:
+	.byte	0x4
+	.uleb128 .LVL330-.Ltext0
+	.uleb128 .LVL330-.Ltext0
+	.uleb128 0x1
+	.byte	0x61
+	.byte	0
+.LVUS972:
+	.uleb128 .LVU2059
+	.uleb128 .LVU2068
+.LLST972:
+	.byte	0x4
+	.uleb128 .LVL330-.Ltext0
+	.uleb128 .LVL333-.Ltext0
+	.uleb128 0x2
+	.byte	0x44
+	.byte	0x9f
+	.byte	0
+.LVUS973:
+	.uleb128 .LVU2063
+	.uleb128 .LVU2066
+.LLST973:
+	.byte	0x4
+	.uleb128 .LVL331-.Ltext0
+	.uleb128 .LVL332-.Ltext0
+	.uleb128 0x1
+	.byte	0x61
+	.byte	0
+.LVUS975:
+	.uleb128 .LVU2068
+	.uleb128 .LVU2071
+.LLST975:
+	.byte	0x4
+	.uleb128 .LVL333-.Ltext0
+	.uleb128 .LVL333-.Ltext0
+	.uleb128 0x2
+	.byte	0x3c
+	.byte	0x9f
+	.byte	0
+.LVUS976:
+	.uleb128 .LVU2071
+	.uleb128 .LVU2075
+.LLST976:
+	.byte	0x4
+	.uleb128 .LVL333-.Ltext0
+	.uleb128 .LVL334-.Ltext0
+	.uleb128 0x1
+	.byte	0x6c
+	.byte	0
+.LVUS977:
+	.uleb128 .LVU2071
+	.uleb128 .LVU2075
+.LLST977:
+	.byte	0x4
+	.uleb128 .LVL333-.Ltext0
+	.uleb128 .LVL334-.Ltext0
+	.uleb128 0x1
+	.byte	0x61
+	.byte	0
+.LVUS978:
+	.uleb128 .LVU2077
+	.uleb128 .LVU2079
+.LLST978:
+	.byte	0x4
+	.uleb128 .LVL334-.Ltext0
+	.uleb128 .LVL334-.Ltext0
+	.uleb128 0x1
+	.byte	0x61
+	.byte	0
+.LVUS979:
+	.uleb128 .LVU2077
+	.uleb128 .LVU2079
+.LLST979:
+	.byte	0x4
+	.uleb128 .LVL334-.Ltext0
+	.uleb128 .LVL334-.Ltext0
+	.uleb128 0x1
+	.byte	0x6e
+	.byte	0
+.LVUS980:
+	.uleb128 .LVU2079
+	.uleb128 .LVU2083
+.LLST980:
+	.byte	0x4
+	.uleb128 .LVL334-.Ltext0
+	.uleb128 .LVL335-.Ltext0
+	.uleb128 0x2
+	.byte	0x90
+	.uleb128 0x20
+	.byte	0
+.LVUS982:
+	.uleb128 .LVU2086
+	.uleb128 .LVU2088
+.LLST982:
+	.byte	0x4
+	.uleb128 .LVL336-.Ltext0
+	.uleb128 .LVL336-.Ltext0
+	.uleb128 0x2
+	.byte	0x90
+	.uleb128 0x20
+	.byte	0
+.LVUS983:
+	.uleb128 .LVU2086
+	.uleb128 .LVU2088
+.LLST983:
+	.byte	0x4
+	.uleb128 .LVL336-.Ltext0
+	.uleb128 .LVL336-.Ltext0
+	.uleb128 0x1
+	.byte	0x62
+	.byte	0
+.LVUS985:
+	.uleb128 .LVU2093
+	.uleb128 .LVU2097
+.LLST985:
+	.byte	0x4
+	.uleb128 .LVL337-.Ltext0
+	.uleb128 .LVL338-.Ltext0
+	.uleb128 0x1
+	.byte	0x62
+	.byte	0
+.LVUS987:
+	.uleb128 .LVU2149
+	.uleb128 .LVU2151
+.LLST987:
+	.byte	0x4
+	.uleb128 .LVL346-.Ltext0
+	.uleb128 .LVL346-.Ltext0
+	.uleb128 0x3
+	.byte	0x8
+	.byte	0xc5
+	.byte	0x9f
+	.byte	0
+.LVUS988:
+	.uleb128 .LVU2149
+	.uleb128 .LVU2151
+.LLST988:
+	.byte	0x4
+	.uleb128 .LVL346-.Ltext0
+	.uleb128 .LVL346-.Ltext0
+	.uleb128 0x1
+	.byte	0x67
+	.byte	0
+.LVUS990:
+	.uleb128 .LVU2154
+	.uleb128 .LVU2156
+.LLST990:
+	.byte	0x4
+	.uleb128 .LVL346-.Ltext0
+	.uleb128 .LVL346-.Ltext0
+	.uleb128 0x2
+	.byte	0x3c
+	.byte	0x9f
+	.byte	0
+.LVUS992:
+	.uleb128 .LVU2167
+	.uleb128 .LVU2169
+.LLST992:
+	.byte	0x4
+	.uleb128 .LVL346-.Ltext0
+	.uleb128 .LVL346-.Ltext0
+	.uleb128 0x3
+	.byte	0x8
+	.byte	0xe8
+	.byte	0x9f
+	.byte	0
+.LVUS993:
+	.uleb128 .LVU2167
+	.uleb128 .LVU2169
+.LLST993:
+	.byte	0x4
+	.uleb128 .LVL346-.Ltext0
+	.uleb128 .LVL346-.Ltext0
+	.uleb128 0x1
+	.byte	0x67
+	.byte	0
+.LVUS995:
+	.uleb128 .LVU2099
+	.uleb128 .LVU2103
+.LLST995:
+	.byte	0x4
+	.uleb128 .LVL338-.Ltext0
+	.uleb128 .LVL339-.Ltext0
+	.uleb128 0x1
+	.byte	0x62
+	.byte	0
+.LVUS996:
+	.uleb128 .LVU2099
+	.uleb128 .LVU2103
+.LLST996:
+	.byte	0x4
+	.uleb128 .LVL338-.Ltext0
+	.uleb128 .LVL339-.Ltext0
+	.uleb128 0x1
+	.byte	0x63
+	.byte	0
+.LVUS998:
+	.uleb128 .LVU2159
+	.uleb128 .LVU2161
+.LLST998:
+	.byte	0x4
+	.uleb128 .LVL346-.Ltext0
+	.uleb128 .LVL346-.Ltext0
+	.uleb128 0x3
+	.byte	0x8
+	.byte	0xc0
+	.byte	0x9f
+	.byte	0
+.LVUS999:
+	.uleb128 .LVU2159
+	.uleb128 .LVU2161
+.LLST999:
+	.byte	0x4
+	.uleb128 .LVL346-.Ltext0
+	.uleb128 .LVL346-.Ltext0
+	.uleb128 0x1
+	.byte	0x64
+	.byte	0
+.LVUS1001:
+	.uleb128 .LVU2171
+	.uleb128 .LVU2173
+.LLST1001:
+	.byte	0x4
+	.uleb128 .LVL346-.Ltext0
+	.uleb128 .LVL346-.Ltext0
+	.uleb128 0x2
+	.byte	0x3c
+	.byte	0x9f
+	.byte	0
+.LVUS1002:
+	.uleb128 .LVU2171
+	.uleb128 .LVU2173
+.LLST1002:
+	.byte	0x4
+	.uleb128 .LVL346-.Ltext0
+	.uleb128 .LVL346-.Ltext0
+	.uleb128 0x1
+	.byte	0x6d
+	.byte	0
+.LVUS1004:
+	.uleb128 .LVU2105
+	.uleb128 .LVU2107
+.LLST1004:
+	.byte	0x4
+	.uleb128 .LVL339-.Ltext0
+	.uleb128 .LVL339-.Ltext0
+	.uleb128 0x1
+	.byte	0x63
+	.byte	0
+.LVUS1005:
+	.uleb128 .LVU2105
+	.uleb128 .LVU2107
+.LLST1005:
+	.byte	0x4
+	.uleb128 .LVL339-.Ltext0
+	.uleb128 .LVL339-.Ltext0
+	.uleb128 0x1
+	.byte	0x61
+	.byte	0
+.LVUS1007:
+	.uleb128 .LVU2107
+	.uleb128 .LVU2121
+.LLST1007:
+	.byte	0x4
+	.uleb128 .LVL339-.Ltext0
+	.uleb128 .LVL344-.Ltext0
+	.uleb128 0x2
+	.byte	0x49
+	.byte	0x9f
+	.byte	0
+.LVUS1008:
+	.uleb128 .LVU2114
+	.uleb128 .LVU2119
+.LLST1008:
+	.byte	0x4
+	.uleb128 .LVL341-.Ltext0
+	.uleb128 .LVL343-.Ltext0
+	.uleb128 0x1
+	.byte	0x61
+	.byte	0
+.LVUS1010:
+	.uleb128 .LVU2142
+	.uleb128 .LVU2144
+.LLST1010:
+	.byte	0x4
+	.uleb128 .LVL346-.Ltext0
+	.uleb128 .LVL346-.Ltext0
+	.uleb128 0x3
+	.byte	0x8
+	.byte	0x39
+	.byte	0x9f
+	.byte	0
+.LVUS1012:
+	.uleb128 .LVU2138
+	.uleb128 .LVU2140
+.LLST1012:
+	.byte	0x4
+	.uleb128 .LVL346-.Ltext0
+	.uleb128 .LVL346-.Ltext0
+	.uleb128 0x3
+	.byte	0x8
+	.byte	0x4e
+	.byte	0x9f
+	.byte	0
+.LVUS1014:
+	.uleb128 .LVU2121
+	.uleb128 .LVU2124
+.LLST1014:
+	.byte	0x4
+	.uleb128 .LVL344-.Ltext0
+	.uleb128 .LVL344-.Ltext0
+	.uleb128 0x2
+	.byte	0x37
+	.byte	0x9f
+	.byte	0
+.LVUS1016:
+	.uleb128 .LVU2124
+	.uleb128 .LVU2127
+.LLST1016:
+	.byte	0x4
+	.uleb128 .LVL344-.Ltext0
+	.uleb128 .LVL344-.Ltext0
+	.uleb128 0x1
+	.byte	0x6c
+	.byte	0
+.LVUS1017:
+	.uleb128 .LVU2124
+	.uleb128 .LVU2127
+.LLST1017:
+	.byte	0x4
+	.uleb128 .LVL344-.Ltext0
+	.uleb128 .LVL344-.Ltext0
+	.uleb128 0x1
+	.byte	0x61
+	.byte	0
+.LVUS1019:
+	.uleb128 .LVU2130
+	.uleb128 .LVU2136
+.LLST1019:
+	.byte	0x4
+	.uleb128 .LVL344-.Ltext0
+	.uleb128 .LVL346-.Ltext0
+	.uleb128 0x3
+	.byte	0x8
+	.byte	0x93
+	.byte	0x9f
+	.byte	0
+.LVUS1020:
+	.uleb128 .LVU2133
+	.uleb128 .LVU2136
+.LLST1020:
+	.byte	0x4
+	.uleb128 .LVL345-.Ltext0
+	.uleb128 .LVL346-.Ltext0
+	.uleb128 0x1
+	.byte	0x61
+	.byte	0
+.LVUS1022:
+	.uleb128 .LVU2180
+	.uleb128 .LVU2186
+.LLST1022:
+	.byte	0x4
+	.uleb128 .LVL346-.Ltext0
+	.uleb128 .LVL348-.Ltext0
+	.uleb128 0x3
+	.byte	0x8
+	.byte	0xc0
+	.byte	0x9f
+	.byte	0
+.LVUS1023:
+	.uleb128 .LVU2180
+	.uleb128 .LVU2186
+.LLST1023:
+	.byte	0x4
+	.uleb128 .LVL346-.Ltext0
+	.uleb128 .LVL348-.Ltext0
+	.uleb128 0x1
+	.byte	0x67
+	.byte	0
+.LVUS1024:
+	.uleb128 .LVU2180
+	.uleb128 .LVU2186
+.LLST1024:
+	.byte	0x4
+	.uleb128 .LVL346-.Ltext0
+	.uleb128 .LVL348-.Ltext0
+	.uleb128 0x1
+	.byte	0x65
+	.byte	0
+.LVUS1027:
+	.uleb128 .LVU2188
+	.uleb128 .LVU2193
+.LLST1027:
+	.byte	0x4
+	.uleb128 .LVL348-.Ltext0
+	.uleb128 .LVL349-.Ltext0
+	.uleb128 0x2
+	.byte	0x33
+	.byte	0x9f
+	.byte	0
+.LVUS1028:
+	.uleb128 .LVU2188
+	.uleb128 .LVU2193
+.LLST1028:
+	.byte	0x4
+	.uleb128 .LVL348-.Ltext0
+	.uleb128 .LVL349-.Ltext0
+	.uleb128 0x1
+	.byte	0x66
+	.byte	0
+.LVUS1029:
+	.uleb128 .LVU2188
+	.uleb128 .LVU2193
+.LLST1029:
+	.byte	0x4
+	.uleb128 .LVL348-.Ltext0
+	.uleb128 .LVL349-.Ltext0
+	.uleb128 0x1
+	.byte	0x68
+	.byte	0
+.LVUS1031:
+	.uleb128 .LVU2212
+	.uleb128 .LVU2214
+.LLST1031:
+	.byte	0x4
+	.uleb128 .LVL352-.Ltext0
+	.uleb128 .LVL352-.Ltext0
+	.uleb128 0x3
+	.byte	0x8
+	.byte	0x3c
+	.byte	0x9f
+	.byte	0
+.LVUS1032:
+	.uleb128 .LVU2212
+	.uleb128 .LVU2214
+.LLST1032:
+	.byte	0x4
+	.uleb128 .LVL352-.Ltext0
+	.uleb128 .LVL352-.Ltext0
+	.uleb128 0x1
+	.byte	0x64
+	.byte	0
+.LVUS1034:
+	.uleb128 .LVU2195
+	.uleb128 .LVU2201
+.LLST1034:
+	.byte	0x4
+	.uleb128 .LVL349-.Ltext0
+	.uleb128 .LVL351-.Ltext0
+	.uleb128 0x3
+	.byte	0x8
+	.byte	0x30
+	.byte	0x9f
+	.byte	0
+.LVUS1035:
+	.uleb128 .LVU2195
+	.uleb128 .LVU2201
+.LLST1035:
+	.byte	0x4
+	.uleb128 .LVL349-.Ltext0
+	.uleb128 .LVL351-.Ltext0
+	.uleb128 0x1
+	.byte	0x64
+	.byte	0
+.LVUS1036:
+	.uleb128 .LVU2195
+	.uleb128 .LVU2201
+.LLST1036:
+	.byte	0x4
+	.uleb128 .LVL349-.Ltext0
+	.uleb128 .LVL351-.Ltext0
+	.uleb128 0x1
+	.byte	0x68
+	.byte	0
+.LVUS1038:
+	.uleb128 .LVU2230
+	.uleb128 .LVU2232
+.LLST1038:
+	.byte	0x4
+	.uleb128 .LVL352-.Ltext0
+	.uleb128 .LVL352-.Ltext0
+	.uleb128 0x1
+	.byte	0x6e
+	.byte	0
+.LVUS1040:
+	.uleb128 .LVU2203
+	.uleb128 .LVU2208
+.LLST1040:
+	.byte	0x4
+	.uleb128 .LVL351-.Ltext0
+	.uleb128 .LVL352-.Ltext0
+	.uleb128 0x3
+	.byte	0x8
+	.byte	0x8d
+	.byte	0x9f
+	.byte	0
+.LVUS1041:
+	.uleb128 .LVU2203
+	.uleb128 .LVU2208
+.LLST1041:
+	.byte	0x4
+	.uleb128 .LVL351-.Ltext0
+	.uleb128 .LVL352-.Ltext0
+	.uleb128 0x1
+	.byte	0x68
+	.byte	0
+.LVUS1043:
+	.uleb128 .LVU2217
+	.uleb128 .LVU2219
+.LLST1043:
+	.byte	0x4
+	.uleb128 .LVL352-.Ltext0
+	.uleb128 .LVL352-.Ltext0
+	.uleb128 0x3
+	.byte	0x8
+	.byte	0xc0
+	.byte	0x9f
+	.byte	0
+.LVUS1044:
+	.uleb128 .LVU2217
+	.uleb128 .LVU2219
+.LLST1044:
+	.byte	0x4
+	.uleb128 .LVL352-.Ltext0
+	.uleb128 .LVL352-.Ltext0
+	.uleb128 0x1
+	.byte	0x6b
+	.byte	0
+.LVUS1046:
+	.uleb128 .LVU2223
+	.uleb128 .LVU2225
+.LLST1046:
+	.byte	0x4
+	.uleb128 .LVL352-.Ltext0
+	.uleb128 .LVL352-.Ltext0
+	.uleb128 0x1
+	.byte	0x61
+	.byte	0
+.LVUS1047:
+	.uleb128 .LVU2223
+	.uleb128 .LVU2225
+.LLST1047:
+	.byte	0x4
+	.uleb128 .LVL352-.Ltext0
+	.uleb128 .LVL352-.Ltext0
+	.uleb128 0x2
+	.byte	0x90
+	.uleb128 0x20
+	.byte	0
+.LVUS1048:
+	.uleb128 .LVU2237
+	.uleb128 .LVU2240
+.LLST1048:
+	.byte	0x4
+	.uleb128 .LVL352-.Ltext0
+	.uleb128 .LVL353-.Ltext0
+	.uleb128 0x1
+	.byte	0x62
+	.byte	0
+.LVUS1049:
+	.uleb128 .LVU2237
+	.uleb128 .LVU2240
+.LLST1049:
+	.byte	0x4
+	.uleb128 .LVL352-.Ltext0
+	.uleb128 .LVL353-.Ltext0
+	.uleb128 0x1
+	.byte	0x63
+	.byte	0
+.LVUS1051:
+	.uleb128 .LVU2242
+	.uleb128 .LVU2244
+.LLST1051:
+	.byte	0x4
+	.uleb128 .LVL353-.Ltext0
+	.uleb128 .LVL353-.Ltext0
+	.uleb128 0x1
+	.byte	0x63
+	.byte	0
+.LVUS1052:
+	.uleb128 .LVU2242
+	.uleb128 .LVU2244
+.LLST1052:
+	.byte	0x4
+	.uleb128 .LVL353-.Ltext0
+	.uleb128 .LVL353-.Ltext0
+	.uleb128 0x1
+	.byte	0x61
+	.byte	0
+.LVUS1054:
+	.uleb128 .LVU2244
+	.uleb128 .LVU2253
+.LLST1054:
+	.byte	0x4
+	.uleb128 .LVL353-.Ltext0
+	.uleb128 .LVL356-.Ltext0
+	.uleb128 0x2
+	.byte	0x44
+	.byte	0x9f
+	.byte	0
+.LVUS1055:
+	.uleb128 .LVU2248
+	.uleb128 .LVU2251
+.LLST1055:
+	.byte	0x4
+	.uleb128 .LVL354-.Ltext0
+	.uleb128 .LVL355-.Ltext0
+	.uleb128 0x1
+	.byte	0x61
+	.byte	0
+.LVUS1057:
+	.uleb128 .LVU2253
+	.uleb128 .LVU2256
+.LLST1057:
+	.byte	0x4
+	.uleb128 .LVL356-.Ltext0
+	.uleb128 .LVL356-.Ltext0
+	.uleb128 0x2
+	.byte	0x3c
+	.byte	0x9f
+	.byte	0
+.LVUS1058:
+	.uleb128 .LVU2256
+	.uleb128 .LVU2260
+.LLST1058:
+	.byte	0x4
+	.uleb128 .LVL356-.Ltext0
+	.uleb128 .LVL357-.Ltext0
+	.uleb128 0x1
+	.byte	0x6a
+	.byte	0
+.LVUS1059:
+	.uleb128 .LVU2256
+	.uleb128 .LVU2260
+.LLST1059:
+	.byte	0x4
+	.uleb128 .LVL356-.Ltext0
+	.uleb128 .LVL357-.Ltext0
+	.uleb128 0x1
+	.byte	0x61
+	.byte	0
+.LVUS1060:
+	.uleb128 .LVU2262
+	.uleb128 .LVU2264
+.LLST1060:
+	.byte	0x4
+	.uleb128 .LVL357-.Ltext0
+	.uleb128 .LVL357-.Ltext0
+	.uleb128 0x1
+	.byte	0x61
+	.byte	0
+.LVUS1061:
+	.uleb128 .LVU2262
+	.uleb128 .LVU2264
+.LLST1061:
+	.byte	0x4
+	.uleb128 .LVL357-.Ltext0
+	.uleb128 .LVL357-.Ltext0
+	.uleb128 0x1
+	.byte	0x6e
+	.byte	0
+.LVUS1062:
+	.uleb128 .LVU2264
+	.uleb128 .LVU2268
+.LLST1062:
+	.byte	0x4
+	.uleb128 .LVL357-.Ltext0
+	.uleb128 .LVL358-.Ltext0
+	.uleb128 0x1
+	.byte	0x69
+	.byte	0
+.LVUS1064:
+	.uleb128 .LVU2271
+	.uleb128 .LVU2273
+.LLST1064:
+	.byte	0x4
+	.uleb128 .LVL359-.Ltext0
+	.uleb128 .LVL359-.Ltext0
+	.uleb128 0x1
+	.byte	0x69
+	.byte	0
+.LVUS1065:
+	.uleb128 .LVU2271
+	.uleb128 .LVU2273
+.LLST1065:
+	.byte	0x4
+	.uleb128 .LVL359-.Ltext0
+	.uleb128 .LVL359-.Ltext0
+	.uleb128 0x1
+	.byte	0x62
+	.byte	0
+.LVUS1067:
+	.uleb128 .LVU2278
+	.uleb128 .LVU2281
+.LLST1067:
+	.byte	0x4
+	.uleb128 .LVL360-.Ltext0
+	.uleb128 .LVL361-.Ltext0
+	.uleb128 0x1
+	.byte	0x62
+	.byte	0
+.LVUS1069:
+	.uleb128 .LVU2489
+	.uleb128 .LVU2491
+.LLST1069:
+	.byte	0x4
+	.uleb128 .LVL392-.Ltext0
+	.uleb128 .LVL392-.Ltext0
+	.uleb128 0x3
+	.byte	0x8
+	.byte	0x30
+	.byte	0x9f
+	.byte	0
+.LVUS1070:
+	.uleb128 .LVU2489
+	.uleb128 .LVU2491
+.LLST1070:
+	.byte	0x4
+	.uleb128 .LVL392-.Ltext0
+	.uleb128 .LVL392-.Ltext0
+	.uleb128 0x1
+	.byte	0x67
+	.byte	0
+.LVUS1072:
+	.uleb128 .LVU2283
+	.uleb128 .LVU2288
+.LLST1072:
+	.byte	0x4
+	.uleb128 .LVL361-.Ltext0
+	.uleb128 .LVL363-.Ltext0
+	.uleb128 0x1
+	.byte	0x62
+	.byte	0
+.LVUS1073:
+	.uleb128 .LVU2283
+	.uleb128 .LVU2288
+.LLST1073:
+	.byte	0x4
+	.uleb128 .LVL361-.Ltext0
+	.uleb128 .LVL363-.Ltext0
+	.uleb128 0x1
+	.byte	0x63
+	.byte	0
+.LVUS1075:
+	.uleb128 .LVU2494
+	.uleb128 .LVU2496
+.LLST1075:
+	.byte	0x4
+	.uleb128 .LVL392-.Ltext0
+	.uleb128 .LVL392-.Ltext0
+	.uleb128 0x3
+	.byte	0x8
+	.byte	0xc0
+	.byte	0x9f
+	.byte	0
+.LVUS1077:
+	.uleb128 .LVU2498
+	.uleb128 .LVU2500
+.LLST1077:
+	.byte	0x4
+	.uleb128 .LVL392-.Ltext0
+	.uleb128 .LVL392-.Ltext0
+	.uleb128 0x3
+	.byte	0x8
+	.byte	0xcf
+	.byte	0x9f
+	.byte	0
+.LVUS1078:
+	.uleb128 .LVU2498
+	.uleb128 .LVU2500
+.LLST1078:
+	.byte	0x4
+	.uleb128 .LVL392-.Ltext0
+	.uleb128 .LVL392-.Ltext0
+	.uleb128 0x1
+	.byte	0x65
+	.byte	0
+.LVUS1079:
+	.uleb128 .LVU2498
+	.uleb128 .LVU2500
+.LLST1079:
+	.byte	0x4
+	.uleb128 .LVL392-.Ltext0
+	.uleb128 .LVL392-.Ltext0
+	.uleb128 0x1
+	.byte	0x64
+	.byte	0
+.LVUS1081:
+	.uleb128 .LVU2290
+	.uleb128 .LVU2292
+.LLST1081:
+	.byte	0x4
+	.uleb128 .LVL363-.Ltext0
+	.uleb128 .LVL363-.Ltext0
+	.uleb128 0x1
+	.byte	0x63
+	.byte	0
+.LVUS1082:
+	.uleb128 .LVU2290
+	.uleb128 .LVU2292
+.LLST1082:
+	.byte	0x4
+	.uleb128 .LVL363-.Ltext0
+	.uleb128 .LVL363-.Ltext0
+	.uleb128 0x1
+	.byte	0x61
+	.byte	0
+.LVUS1084:
+	.uleb128 .LVU2292
+	.uleb128 .LVU2306
+.LLST1084:
+	.byte	0x4
+	.uleb128 .LVL363-.Ltext0
+	.uleb128 .LVL368-.Ltext0
+	.uleb128 0x2
+	.byte	0x49
+	.byte	0x9f
+	.byte	0
+.LVUS1085:
+	.uleb128 .LVU2299
+	.uleb128 .LVU2304
+.LLST1085:
+	.byte	0x4
+	.uleb128 .LVL365-.Ltext0
+	.uleb128 .LVL367-.Ltext0
+	.uleb128 0x1
+	.byte	0x61
+	.byte	0
+.LVUS1087:
+	.uleb128 .LVU2327
+	.uleb128 .LVU2329
+.LLST1087:
+	.byte	0x4
+	.uleb128 .LVL370-.Ltext0
+	.uleb128 .LVL370-.Ltext0
+	.uleb128 0x3
+	.byte	0x8
+	.byte	0x93
+	.byte	0x9f
+	.byte	0
+.LVUS1089:
+	.uleb128 .LVU2323
+	.uleb128 .LVU2325
+.LLST1089:
+	.byte	0x4
+	.uleb128 .LVL370-.Ltext0
+	.uleb128 .LVL370-.Ltext0
+	.uleb128 0x3
+	.byte	0x8
+	.byte	0x4e
+	.byte	0x9f
+	.byte	0
+.LVUS1091:
+	.uleb128 .LVU2502
+	.uleb128 .LVU2504
+.LLST1091:
+	.byte	0x4
+	.uleb128 .LVL392-.Ltext0
+	.uleb128 .LVL392-.Ltext0
+	.uleb128 0x3
+	.byte	0x8
+	.byte	0x4e
+	.byte	0x9f
+	.byte	0
+.LVUS1093:
+	.uleb128 .LVU2306
+	.uleb128 .LVU2309
+.LLST1093:
+	.byte	0x4
+	.uleb128 .LVL368-.Ltext0
+	.uleb128 .LVL368-.Ltext0
+	.uleb128 0x2
+	.byte	0x37
+	.byte	0x9f
+	.byte	0
+.LVUS1095:
+	.uleb128 .LVU2309
+	.uleb128 .LVU2312
+.LLST1095:
+	.byte	0x4
+	.uleb128 .LVL368-.Ltext0
+	.uleb128 .LVL368-.Ltext0
+	.uleb128 0x1
+	.byte	0x6a
+	.byte	0
+.LVUS1096:
+	.uleb128 .LVU2309
+	.uleb128 .LVU2312
+.LLST1096:
+	.byte	0x4
+	.uleb128 .LVL368-.Ltext0
+	.uleb128 .LVL368-.Ltext0
+	.uleb128 0x1
+	.byte	0x61
+	.byte	0
+.LVUS1098:
+	.uleb128 .LVU2315
+	.uleb128 .LVU2321
+.LLST1098:
+	.byte	0x4
+	.uleb128 .LVL368-.Ltext0
+	.uleb128 .LVL370-.Ltext0
+	.uleb128 0x3
+	.byte	0x8
+	.byte	0x39
+	.byte	0x9f
+	.byte	0
+.LVUS1099:
+	.uleb128 .LVU2318
+	.uleb128 .LVU2321
+.LLST1099:
+	.byte	0x4
+	.uleb128 .LVL369-.Ltext0
+	.uleb128 .LVL370-.Ltext0
+	.uleb128 0x1
+	.byte	0x61
+	.byte	0
+.LVUS1101:
+	.uleb128 .LVU2452
+	.uleb128 .LVU2454
+.LLST1101:
+	.byte	0x4
+	.uleb128 .LVL391-.Ltext0
+	.uleb128 .LVL391-.Ltext0
+	.uleb128 0x2
+	.byte	0x3c
+	.byte	0x9f
+	.byte	0
+.LVUS1102:
+	.uleb128 .LVU2332
+	.uleb128 .LVU2334
+.LLST1102:
+	.byte	0x4
+	.uleb128 .LVL370-.Ltext0
+	.uleb128 .LVL370-.Ltext0
+	.uleb128 0x1
+	.byte	0x61
+	.byte	0
+.LVUS1103:
+	.uleb128 .LVU2332
+	.uleb128 .LVU2334
+.LLST1103:
+	.byte	0x4
+	.uleb128 .LVL370-.Ltext0
+	.uleb128 .LVL370-.Ltext0
+	.uleb128 0x1
+	.byte	0x69
+	.byte	0
+.LVUS1105:
+	.uleb128 .LVU2334
+	.uleb128 .LVU2338
+.LLST1105:
+	.byte	0x4
+	.uleb128 .LVL370-.Ltext0
+	.uleb128 .LVL371-.Ltext0
+	.uleb128 0x1
+	.byte	0x68
+	.byte	0
+.LVUS1107:
+	.uleb128 .LVU2470
+	.uleb128 .LVU2472
+.LLST1107:
+	.byte	0x4
+	.uleb128 .LVL392-.Ltext0
+	.uleb128 .LVL392-.Ltext0
+	.uleb128 0x3
+	.byte	0x8
+	.byte	0xe7
+	.byte	0x9f
+	.byte	0
+.LVUS1108:
+	.uleb128 .LVU2470
+	.uleb128 .LVU2472
+.LLST1108:
+	.byte	0x4
+	.uleb128 .LVL392-.Ltext0
+	.uleb128 .LVL392-.Ltext0
+	.uleb128 0x1
+	.byte	0x67
+	.byte	0
+.LVUS1110:
+	.uleb128 .LVU2457
+	.uleb128 .LVU2459
+.LLST1110:
+	.byte	0x4
+	.uleb128 .LVL391-.Ltext0
+	.uleb128 .LVL391-.Ltext0
+	.uleb128 0x3
+	.byte	0x8
+	.byte	0x30
+	.byte	0x9f
+	.byte	0
+.LVUS1112:
+	.uleb128 .LVU2345
+	.uleb128 .LVU2347
+.LLST1112:
+	.byte	0x4
+	.uleb128 .LVL372-.Ltext0
+	.uleb128 .LVL372-.Ltext0
+	.uleb128 0x1
+	.byte	0x68
+	.byte	0
+.LVUS1113:
+	.uleb128 .LVU2345
+	.uleb128 .LVU2347
+.LLST1113:
+	.byte	0x4
+	.uleb128 .LVL372-.Ltext0
+	.uleb128 .LVL372-.Ltext0
+	.uleb128 0x1
+	.byte	0x62
+	.byte	0
+.LVUS1115:
+	.uleb128 .LVU2352
+	.uleb128 .LVU2354
+.LLST1115:
+	.byte	0x4
+	.uleb128 .LVL373-.Ltext0
+	.uleb128 .LVL374-.Ltext0
+	.uleb128 0x1
+	.byte	0x62
+	.byte	0
+.LVUS1117:
+	.uleb128 .LVU2475
+	.uleb128 .LVU2477
+.LLST1117:
+	.byte	0x4
+	.uleb128 .LVL392-.Ltext0
+	.uleb128 .LVL392-.Ltext0
+	.uleb128 0x3
+	.byte	0x8
+	.byte	0xcc
+	.byte	0x9f
+	.byte	0
+.LVUS1118:
+	.uleb128 .LVU2356
+	.uleb128 .LVU2359
+.LLST1118:
+	.byte	0x4
+	.uleb128 .LVL374-.Ltext0
+	.uleb128 .LVL375-.Ltext0
+	.uleb128 0x1
+	.byte	0x62
+	.byte	0
+.LVUS1119:
+	.uleb128 .LVU2356
+	.uleb128 .LVU2359
+.LLST1119:
+	.byte	0x4
+	.uleb128 .LVL374-.Ltext0
+	.uleb128 .LVL375-.Ltext0
+	.uleb128 0x1
+	.byte	0x63
+	.byte	0
+.LVUS1121:
+	.uleb128 .LVU2361
+	.uleb128 .LVU2363
+.LLST1121:
+	.byte	0x4
+	.uleb128 .LVL375-.Ltext0
+	.uleb128 .LVL375-.Ltext0
+	.uleb128 0x1
+	.byte	0x63
+	.byte	0
+.LVUS1122:
+	.uleb128 .LVU2361
+	.uleb128 .LVU2363
+.LLST1122:
+	.byte	0x4
+	.uleb128 .LVL375-.Ltext0
+	.uleb128 .LVL375-.Ltext0
+	.uleb128 0x1
+	.byte	0x61
+	.byte	0
+.LVUS1124:
+	.uleb128 .LVU2363
+	.uleb128 .LVU2372
+.LLST1124:
+	.byte	0x4
+	.uleb128 .LVL375-.Ltext0
+	.uleb128 .LVL378-.Ltext0
+	.uleb128 0x2
+	.byte	0x44
+	.byte	0x9f
+	.byte	0
+.LVUS1125:
+	.uleb128 .LVU2367
+	.uleb128 .LVU2370
+.LLST1125:
+	.byte	0x4
+	.uleb128 .LVL376-.Ltext0
+	.uleb128 .LVL377-.Ltext0
+	.uleb128 0x1
+	.byte	0x61
+	.byte	0
+.LVUS1127:
+	.uleb128 .LVU2372
+	.uleb128 .LVU2375
+.LLST1127:
+	.byte	0x4
+	.uleb128 .LVL378-.Ltext0
+	.uleb128 .LVL378-.Ltext0
+	.uleb128 0x2
+	.byte	0x3c
+	.byte	0x9f
+	.byte	0
+.LVUS1128:
+	.uleb128 .LVU2375
+	.uleb128 .LVU2379
+.LLST1128:
+	.byte	0x4
+	.uleb128 .LVL378-.Ltext0
+	.uleb128 .LVL379-.Ltext0
+	.uleb128 0x1
+	.byte	0x69
+	.byte	0
+.LVUS1129:
+	.uleb128 .LVU2375
+	.uleb128 .LVU2379
+.LLST1129:
+	.byte	0x4
+	.uleb128 .LVL378-.Ltext0
+	.uleb128 .LVL379-.Ltext0
+	.uleb128 0x1
+	.byte	0x61
+	.byte	0
+.LVUS1130:
+	.uleb128 .LVU2381
+	.uleb128 .LVU2383
+.LLST1130:
+	.byte	0x4
+	.uleb128 .LVL379-.Ltext0
+	.uleb128 .LVL379-.Ltext0
+	.uleb128 0x1
+	.byte	0x61
+	.byte	0
+.LVUS1131:
+	.uleb128 .LVU2381
+	.uleb128 .LVU2383
+.LLST1131:
+	.byte	0x4
+	.uleb128 .LVL379-.Ltext0
+	.uleb128 .LVL379-.Ltext0
+	.uleb128 0x1
+	.byte	0x68
+	.byte	0
+.LVUS1133:
+	.uleb128 .LVU2383
+	.uleb128 .LVU2388
+.LLST1133:
+	.byte	0x4
+	.uleb128 .LVL379-.Ltext0
+	.uleb128 .LVL380-.Ltext0
+	.uleb128 0x1
+	.byte	0x6c
+	.byte	0
+.LVUS1135:
+	.uleb128 .LVU2479
+	.uleb128 .LVU2481
+.LLST1135:
+	.byte	0x4
+	.uleb128 .LVL392-.Ltext0
+	.uleb128 .LVL392-.Ltext0
+	.uleb128 0x3
+	.byte	0x8
+	.byte	0xf4
+	.byte	0x9f
+	.byte	0
+.LVUS1136:
+	.uleb128 .LVU2479
+	.uleb128 .LVU2481
+.LLST1136:
+	.byte	0x4
+	.uleb128 .LVL392-.Ltext0
+	.uleb128 .LVL392-.Ltext0
+	.uleb128 0x1
+	.byte	0x64
+	.byte	0
+.LVUS1138:
+	.uleb128 .LVU2483
+	.uleb128 .LVU2485
+.LLST1138:
+	.byte	0x4
+	.uleb128 .LVL392-.Ltext0
+	.uleb128 .LVL392-.Ltext0
+	.uleb128 0x3
+	.byte	0x8
+	.byte	0x30
+	.byte	0x9f
+	.byte	0
+.LVUS1139:
+	.uleb128 .LVU2483
+	.uleb128 .LVU2485
+.LLST1139:
+	.byte	0x4
+	.uleb128 .LVL392-.Ltext0
+	.uleb128 .LVL392-.Ltext0
+	.uleb128 0x1
+	.byte	0x69
+	.byte	0
+.LVUS1141:
+	.uleb128 .LVU2393
+	.uleb128 .LVU2395
+.LLST1141:
+	.byte	0x4
+	.uleb128 .LVL381-.Ltext0
+	.uleb128 .LVL381-.Ltext0
+	.uleb128 0x1
+	.byte	0x6c
+	.byte	0
+.LVUS1142:
+	.uleb128 .LVU2393
+	.uleb128 .LVU2395
+.LLST1142:
+	.byte	0x4
+	.uleb128 .LVL381-.Ltext0
+	.uleb128 .LVL381-.Ltext0
+	.uleb128 0x1
+	.byte	0x62
+	.byte	0
+.LVUS1144:
+	.uleb128 .LVU2399
+	.uleb128 .LVU2401
+.LLST1144:
+	.byte	0x4
+	.uleb128 .LVL382-.Ltext0
+	.uleb128 .LVL383-.Ltext0
+	.uleb128 0x1
+	.byte	0x62
+	.byte	0
+.LVUS1145:
+	.uleb128 .LVU2403
+	.uleb128 .LVU2406
+.LLST1145:
+	.byte	0x4
+	.uleb128 .LVL383-.Ltext0
+	.uleb128 .LVL384-.Ltext0
+	.uleb128 0x1
+	.byte	0x62
+	.byte	0
+.LVUS1146:
+	.uleb128 .LVU2403
+	.uleb128 .LVU2406
+.LLST1146:
+	.byte	0x4
+	.uleb128 .LVL383-.Ltext0
+	.uleb128 .LVL384-.Ltext0
+	.uleb128 0x1
+	.byte	0x63
+	.byte	0
+.LVUS1148:
+	.uleb128 .LVU2408
+	.uleb128 .LVU2410
+.LLST1148:
+	.byte	0x4
+	.uleb128 .LVL384-.Ltext0
+	.uleb128 .LVL384-.Ltext0
+	.uleb128 0x1
+	.byte	0x63
+	.byte	0
+.LVUS1149:
+	.uleb128 .LVU2408
+	.uleb128 .LVU2410
+.LLST1149:
+	.byte	0x4
+	.uleb128 .LVL384-.Ltext0
+	.uleb128 .LVL384-.Ltext0
+	.uleb128 0x1
+	.byte	0x61
+	.byte	0
+.LVUS1151:
+	.uleb128 .LVU2410
+	.uleb128 .LVU2423
+.LLST1151:
+	.byte	0x4
+	.uleb128 .LVL384-.Ltext0
+	.uleb128 .LVL389-.Ltext0
+	.uleb128 0x2
+	.byte	0x49
+	.byte	0x9f
+	.byte	0
+.LVUS1152:
+	.uleb128 .LVU2416
+	.uleb128 .LVU2421
+.LLST1152:
+	.byte	0x4
+	.uleb128 .LVL386-.Ltext0
+	.uleb128 .LVL388-.Ltext0
+	.uleb128 0x1
+	.byte	0x61
+	.byte	0
+.LVUS1154:
+	.uleb128 .LVU2443
+	.uleb128 .LVU2445
+.LLST1154:
+	.byte	0x4
+	.uleb128 .LVL391-.Ltext0
+	.uleb128 .LVL391-.Ltext0
+	.uleb128 0x3
+	.byte	0x8
+	.byte	0x39
+	.byte	0x9f
+	.byte	0
+.LVUS1156:
+	.uleb128 .LVU2439
+	.uleb128 .LVU2441
+.LLST1156:
+	.byte	0x4
+	.uleb128 .LVL391-.Ltext0
+	.uleb128 .LVL391-.Ltext0
+	.uleb128 0x3
+	.byte	0x8
+	.byte	0x4e
+	.byte	0x9f
+	.byte	0
+.LVUS1158:
+	.uleb128 .LVU2423
+	.uleb128 .LVU2426
+.LLST1158:
+	.byte	0x4
+	.uleb128 .LVL389-.Ltext0
+	.uleb128 .LVL389-.Ltext0
+	.uleb128 0x2
+	.byte	0x37
+	.byte	0x9f
+	.byte	0
+.LVUS1160:
+	.uleb128 .LVU2426
+	.uleb128 .LVU2429
+.LLST1160:
+	.byte	0x4
+	.uleb128 .LVL389-.Ltext0
+	.uleb128 .LVL389-.Ltext0
+	.uleb128 0x1
+	.byte	0x68
+	.byte	0
+.LVUS1161:
+	.uleb128 .LVU2426
+	.uleb128 .LVU2429
+.LLST1161:
+	.byte	0x4
+	.uleb128 .LVL389-.Ltext0
+	.uleb128 .LVL389-.Ltext0
+	.uleb128 0x1
+	.byte	0x61
+	.byte	0
+.LVUS1163:
+	.uleb128 .LVU2432
+	.uleb128 .LVU2437
+.LLST1163:
+	.byte	0x4
+	.uleb128 .LVL389-.Ltext0
+	.uleb128 .LVL391-.Ltext0
+	.uleb128 0x3
+	.byte	0x8
+	.byte	0x93
+	.byte	0x9f
+	.byte	0
+.LVUS1164:
+	.uleb128 .LVU2435
+	.uleb128 .LVU2437
+.LLST1164:
+	.byte	0x4
+	.uleb128 .LVL390-.Ltext0
+	.uleb128 .LVL391-.Ltext0
+	.uleb128 0x1
+	.byte	0x61
+	.byte	0
+.LVUS1166:
+	.uleb128 .LVU2461
+	.uleb128 .LVU2463
+.LLST1166:
+	.byte	0x4
+	.uleb128 .LVL391-.Ltext0
+	.uleb128 .LVL391-.Ltext0
+	.uleb128 0x3
+	.byte	0x8
+	.byte	0x24
+	.byte	0x9f
+	.byte	0
+.LVUS1167:
+	.uleb128 .LVU2461
+	.uleb128 .LVU2463
+.LLST1167:
+	.byte	0x4
+	.uleb128 .LVL391-.Ltext0
+	.uleb128 .LVL391-.Ltext0
+	.uleb128 0x1
+	.byte	0x64
+	.byte	0
+.LVUS1168:
+	.uleb128 .LVU2465
+	.uleb128 .LVU2468
+.LLST1168:
+	.byte	0x4
+	.uleb128 .LVL391-.Ltext0
+	.uleb128 .LVL392-.Ltext0
+	.uleb128 0x3
+	.byte	0x8
+	.byte	0xc0
+	.byte	0x9f
+	.byte	0
+.LVUS1169:
+	.uleb128 .LVU2465
+	.uleb128 .LVU2468
+.LLST1169:
+	.byte	0x4
+	.uleb128 .LVL391-.Ltext0
+	.uleb128 .LVL392-.Ltext0
+	.uleb128 0x1
+	.byte	0x68
+	.byte	0
+.LVUS1170:
+	.uleb128 .LVU2465
+	.uleb128 .LVU2468
+.LLST1170:
+	.byte	0x4
+	.uleb128 .LVL391-.Ltext0
+	.uleb128 .LVL392-.Ltext0
+	.uleb128 0x1
+	.byte	0x6a
+	.byte	0
+.LVUS1171:
+	.uleb128 .LVU2508
+	.uleb128 .LVU2510
+.LLST1171:
+	.byte	0x4
+	.uleb128 .LVL392-.Ltext0
+	.uleb128 .LVL392-.Ltext0
+	.uleb128 0x1
+	.byte	0x61
+	.byte	0
+.LVUS1172:
+	.uleb128 .LVU2508
+	.uleb128 .LVU2510
+.LLST1172:
+	.byte	0x4
+	.uleb128 .LVL392-.Ltext0
+	.uleb128 .LVL392-.Ltext0
+	.uleb128 0x1
+	.byte	0x6c
+	.byte	0
+.LVUS1173:
+	.uleb128 .LVU2510
+	.uleb128 .LVU2514
+.LLST1173:
+	.byte	0x4
+	.uleb128 .LVL392-.Ltext0
+	.uleb128 .LVL393-.Ltext0
+	.uleb128 0x1
+	.byte	0x6a
+	.byte	0
+.LVUS1175:
+	.uleb128 .LVU2517
+	.uleb128 .LVU2519
+.LLST1175:
+	.byte	0x4
+	.uleb128 .LVL394-.Ltext0
+	.uleb128 .LVL394-.Ltext0
+	.uleb128 0x1
+	.byte	0x6a
+	.byte	0
+.LVUS1176:
+	.uleb128 .LVU2517
+	.uleb128 .LVU2519
+.LLST1176:
+	.byte	0x4
+	.uleb128 .LVL394-.Ltext0
+	.uleb128 .LVL394-.Ltext0
+	.uleb128 0x1
+	.byte	0x62
+	.byte	0
+.LVUS1178:
+	.uleb128 .LVU2523
+	.uleb128 .LVU2525
+.LLST1178:
+	.byte	0x4
+	.uleb128 .LVL395-.Ltext0
+	.uleb128 .LVL396-.Ltext0
+	.uleb128 0x1
+	.byte	0x62
+	.byte	0
+.LVUS1179:
+	.uleb128 .LVU2527
+	.uleb128 .LVU2530
+.LLST1179:
+	.byte	0x4
+	.uleb128 .LVL396-.Ltext0
+	.uleb128 .LVL397-.Ltext0
+	.uleb128 0x1
+	.byte	0x62
+	.byte	0
+.LVUS1180:
+	.uleb128 .LVU2527
+	.uleb128 .LVU2530
+.LLST1180:
+	.byte	0x4
+	.uleb128 .LVL396-.Ltext0
+	.uleb128 .LVL397-.Ltext0
+	.uleb128 0x1
+	.byte	0x63
+	.byte	0
+.LVUS1182:
+	.uleb128 .LVU2532
+	.uleb128 .LVU2534
+.LLST1182:
+	.byte	0x4
+	.uleb128 .LVL397-.Ltext0
+	.uleb128 .LVL397-.Ltext0
+	.uleb128 0x1
+	.byte	0x63
+	.byte	0
+.LVUS1183:
+	.uleb128 .LVU2532
+	.uleb128 .LVU2534
+.LLST1183:
+	.byte	0x4
+	.uleb128 .LVL397-.Ltext0
+	.uleb128 .LVL397-.Ltext0
+	.uleb128 0x1
+	.byte	0x61
+	.byte	0
+.LVUS1185:
+	.uleb128 .LVU2534
+	.uleb128 .LVU2543
+.LLST1185:
+	.byte	0x4
+	.uleb128 .LVL397-.Ltext0
+	.uleb128 .LVL400-.Ltext0
+	.uleb128 0x2
+	.byte	0x44
+	.byte	0x9f
+	.byte	0
+.LVUS1186:
+	.uleb128 .LVU2538
+	.uleb128 .LVU2541
+.LLST1186:
+	.byte	0x4
+	.uleb128 .LVL398-.Ltext0
+	.uleb128 .LVL399-.Ltext0
+	.uleb128 0x1
+	.byte	0x61
+	.byte	0
+.LVUS1188:
+	.uleb128 .LVU2543
+	.uleb128 .LVU2546
+.LLST1188:
+	.byte	0x4
+	.uleb128 .LVL400-.Ltext0
+	.uleb128 .LVL400-.Ltext0
+	.uleb128 0x2
+	.byte	0x3c
+	.byte	0x9f
+	.byte	0
+.LVUS1189:
+	.uleb128 .LVU2546
+	.uleb128 .LVU2550
+.LLST1189:
+	.byte	0x4
+	.uleb128 .LVL400-.Ltext0
+	.uleb128 .LVL401-.Ltext0
+	.uleb128 0x1
+	.byte	0x6c
+	.byte	0
+.LVUS1190:
+	.uleb128 .LVU2546
+	.uleb128 .LVU2550
+.LLST1190:
+	.byte	0x4
+	.uleb128 .LVL400-.Ltext0
+	.uleb128 .LVL401-.Ltext0
+	.uleb128 0x1
+	.byte	0x61
+	.byte	0
+.LVUS1191:
+	.uleb128 .LVU2552
+	.uleb128 .LVU2554
+.LLST1191:
+	.byte	0x4
+	.uleb128 .LVL401-.Ltext0
+	.uleb128 .LVL401-.Ltext0
+	.uleb128 0x1
+	.byte	0x61
+	.byte	0
+.LVUS1192:
+	.uleb128 .LVU2552
+	.uleb128 .LVU2554
+.LLST1192:
+	.byte	0x4
+	.uleb128 .LVL401-.Ltext0
+	.uleb128 .LVL401-.Ltext0
+	.uleb128 0x1
+	.byte	0x6a
+	.byte	0
+.LVUS1193:
+	.uleb128 .LVU2554
+	.uleb128 .LVU2558
+.LLST1193:
+	.byte	0x4
+	.uleb128 .LVL401-.Ltext0
+	.uleb128 .LVL402-.Ltext0
+	.uleb128 0x1
+	.byte	0x6d
+	.byte	0
+.LVUS1195:
+	.uleb128 .LVU2561
+	.uleb128 .LVU2563
+.LLST1195:
+	.byte	0x4
+	.uleb128 .LVL403-.Ltext0
+	.uleb128 .LVL403-.Ltext0
+	.uleb128 0x1
+	.byte	0x6d
+	.byte	0
+.LVUS1196:
+	.uleb128 .LVU2561
+	.uleb128 .LVU2563
+.LLST1196:
+	.byte	0x4
+	.uleb128 .LVL403-.Ltext0
+	.uleb128 .LVL403-.Ltext0
+	.uleb128 0x1
+	.byte	0x62
+	.byte	0
+.LVUS1198:
+	.uleb128 .LVU2567
+	.uleb128 .LVU2569
+.LLST1198:
+	.byte	0x4
+	.uleb128 .LVL404-.Ltext0
+	.uleb128 .LVL405-.Ltext0
+	.uleb128 0x1
+	.byte	0x62
+	.byte	0
+.LVUS1199:
+	.uleb128 .LVU2571
+	.uleb128 .LVU2574
+.LLST1199:
+	.byte	0x4
+	.uleb128 .LVL405-.Ltext0
+	.uleb128 .LVL406-.Ltext0
+	.uleb128 0x1
+	.byte	0x62
+	.byte	0
+.LVUS1200:
+	.uleb128 .LVU2571
+	.uleb128 .LVU2574
+.LLST1200:
+	.byte	0x4
+	.uleb128 .LVL405-.Ltext0
+	.uleb128 .LVL406-.Ltext0
+	.uleb128 0x1
+	.byte	0x63
+	.byte	0
+.LVUS1202:
+	.uleb128 .LVU2576
+	.uleb128 .LVU2578
+.LLST1202:
+	.byte	0x4
+	.uleb128 .LVL406-.Ltext0
+	.uleb128 .LVL406-.Ltext0
+	.uleb128 0x1
+	.byte	0x63
+	.byte	0
+.LVUS1203:
+	.uleb128 .LVU2576
+	.uleb128 .LVU2578
+.LLST1203:
+	.byte	0x4
+	.uleb128 .LVL406-.Ltext0
+	.uleb128 .LVL406-.Ltext0
+	.uleb128 0x1
+	.byte	0x61
+	.byte	0
+.LVUS1205:
+	.uleb128 .LVU2578
+	.uleb128 .LVU2591
+.LLST1205:
+	.byte	0x4
+	.uleb128 .LVL406-.Ltext0
+	.uleb128 .LVL411-.Ltext0
+	.uleb128 0x2
+	.byte	0x49
+	.byte	0x9f
+	.byte	0
+.LVUS1206:
+	.uleb128 .LVU2584
+	.uleb128 .LVU2589
+.LLST1206:
+	.byte	0x4
+	.uleb128 .LVL408-.Ltext0
+	.uleb128 .LVL410-.Ltext0
+	.uleb128 0x1
+	.byte	0x61
+	.byte	0
+.LVUS1208:
+	.uleb128 .LVU2611
+	.uleb128 .LVU2613
+.LLST1208:
+	.byte	0x4
+	.uleb128 .LVL413-.Ltext0
+	.uleb128 .LVL413-.Ltext0
+	.uleb128 0x3
+	.byte	0x8
+	.byte	0x93
+	.byte	0x9f
+	.byte	0
+.LVUS1210:
+	.uleb128 .LVU2607
+	.uleb128 .LVU2609
+.LLST1210:
+	.byte	0x4
+	.uleb128 .LVL413-.Ltext0
+	.uleb128 .LVL413-.Ltext0
+	.uleb128 0x3
+	.byte	0x8
+	.byte	0x4e
+	.byte	0x9f
+	.byte	0
+.LVUS1212:
+	.uleb128 .LVU2591
+	.uleb128 .LVU2594
+.LLST1212:
+	.byte	0x4
+	.uleb128 .LVL411-.Ltext0
+	.uleb128 .LVL411-.Ltext0
+	.uleb128 0x2
+	.byte	0x37
+	.byte	0x9f
+	.byte	0
+.LVUS1214:
+	.uleb128 .LVU2594
+	.uleb128 .LVU2597
+.LLST1214:
+	.byte	0x4
+	.uleb128 .LVL411-.Ltext0
+	.uleb128 .LVL411-.Ltext0
+	.uleb128 0x1
+	.byte	0x6a
+	.byte	0
+.LVUS1215:
+	.uleb128 .LVU2594
+	.uleb128 .LVU2597
+.LLST1215:
+	.byte	0x4
+	.uleb128 .LVL411-.Ltext0
+	.uleb128 .LVL411-.Ltext0
+	.uleb128 0x1
+	.byte	0x61
+	.byte	0
+.LVUS1217:
+	.uleb128 .LVU2600
+	.uleb128 .LVU2605
+.LLST1217:
+	.byte	0x4
+	.uleb128 .LVL411-.Ltext0
+	.uleb128 .LVL413-.Ltext0
+	.uleb128 0x3
+	.byte	0x8
+	.byte	0x39
+	.byte	0x9f
+	.byte	0
+.LVUS1218:
+	.uleb128 .LVU2603
+	.uleb128 .LVU2605
+.LLST1218:
+	.byte	0x4
+	.uleb128 .LVL412-.Ltext0
+	.uleb128 .LVL413-.Ltext0
+	.uleb128 0x1
+	.byte	0x61
+	.byte	0
+.LVUS1219:
+	.uleb128 .LVU2616
+	.uleb128 .LVU2618
+.LLST1219:
+	.byte	0x4
+	.uleb128 .LVL413-.Ltext0
+	.uleb128 .LVL413-.Ltext0
+	.uleb128 0x1
+	.byte	0x61
+	.byte	0
+.LVUS1220:
+	.uleb128 .LVU2616
+	.uleb128 .LVU2618
+.LLST1220:
+	.byte	0x4
+	.uleb128 .LVL413-.Ltext0
+	.uleb128 .LVL413-.Ltext0
+	.uleb128 0x1
+	.byte	0x6d
+	.byte	0
+.LVUS1221:
+	.uleb128 .LVU2618
+	.uleb128 .LVU2622
+.LLST1221:
+	.byte	0x4
+	.uleb128 .LVL413-.Ltext0
+	.uleb128 .LVL414-.Ltext0
+	.uleb128 0x1
+	.byte	0x6e
+	.byte	0
+.LVUS1223:
+	.uleb128 .LVU2625
+	.uleb128 .LVU2627
+.LLST1223:
+	.byte	0x4
+	.uleb128 .LVL415-.Ltext0
+	.uleb128 .LVL415-.Ltext0
+	.uleb128 0x1
+	.byte	0x6e
+	.byte	0
+.LVUS1224:
+	.uleb128 .LVU2625
+	.uleb128 .LVU2627
+.LLST1224:
+	.byte	0x4
+	.uleb128 .LVL415-.Ltext0
+	.uleb128 .LVL415-.Ltext0
+	.uleb128 0x1
+	.byte	0x62
+	.byte	0
+.LVUS1226:
+	.uleb128 .LVU2631
+	.uleb128 .LVU2633
+.LLST1226:
+	.byte	0x4
+	.uleb128 .LVL416-.Ltext0
+	.uleb128 .LVL417-.Ltext0
+	.uleb128 0x1
+	.byte	0x62
+	.byte	0
+.LVUS1227:
+	.uleb128 .LVU2635
+	.uleb128 .LVU2638
+.LLST1227:
+	.byte	0x4
+	.uleb128 .LVL417-.Ltext0
+	.uleb128 .LVL418-.Ltext0
+	.uleb128 0x1
+	.byte	0x62
+	.byte	0
+.LVUS1228:
+	.uleb128 .LVU2635
+	.uleb128 .LVU2638
+.LLST1228:
+	.byte	0x4
+	.uleb128 .LVL417-.Ltext0
+	.uleb128 .LVL418-.Ltext0
+	.uleb128 0x1
+	.byte	0x63
+	.byte	0
+.LVUS1230:
+	.uleb128 .LVU2640
+	.uleb128 .LVU2642
+.LLST1230:
+	.byte	0x4
+	.uleb128 .LVL418-.Ltext0
+	.uleb128 .LVL418-.Ltext0
+	.uleb128 0x1
+	.byte	0x63
+	.byte	0
+.LVUS1231:
+	.uleb128 .LVU2640
+	.uleb128 .LVU2642
+.LLST1231:
+	.byte	0x4
+	.uleb128 .LVL418-.Ltext0
+	.uleb128 .LVL418-.Ltext0
+	.uleb128 0x1
+	.byte	0x61
+	.byte	0
+.LVUS1233:
+	.uleb128 .LVU2642
+	.uleb128 .LVU2651
+.LLST1233:
+	.byte	0x4
+	.uleb128 .LVL418-.Ltext0
+	.uleb128 .LVL421-.Ltext0
+	.uleb128 0x2
+	.byte	0x44
+	.byte	0x9f
+	.byte	0
+.LVUS1234:
+	.uleb128 .LVU2646
+	.uleb128 .LVU2649
+.LLST1234:
+	.byte	0x4
+	.uleb128 .LVL419-.Ltext0
+	.uleb128 .LVL420-.Ltext0
+	.uleb128 0x1
+	.byte	0x61
+	.byte	0
+.LVUS1236:
+	.uleb128 .LVU2651
+	.uleb128 .LVU2654
+.LLST1236:
+	.byte	0x4
+	.uleb128 .LVL421-.Ltext0
+	.uleb128 .LVL421-.Ltext0
+	.uleb128 0x2
+	.byte	0x3c
+	.byte	0x9f
+	.byte	0
+.LVUS1237:
+	.uleb128 .LVU2654
+	.uleb128 .LVU2658
+.LLST1237:
+	.byte	0x4
+	.uleb128 .LVL421-.Ltext0
+	.uleb128 .LVL422-.Ltext0
+	.uleb128 0x1
+	.byte	0x6a
+	.byte	0
+.LVUS1238:
+	.uleb128 .LVU2654
+	.uleb128 .LVU2658
+.LLST1238:
+	.byte	0x4
+	.uleb128 .LVL421-.Ltext0
+	.uleb128 .LVL422-.Ltext0
+	.uleb128 0x1
+	.byte	0x61
+	.byte	0
+.LVUS1239:
+	.uleb128 .LVU2660
+	.uleb128 .LVU2662
+.LLST1239:
+	.byte	0x4
+	.uleb128 .LVL422-.Ltext0
+	.uleb128 .LVL422-.Ltext0
+	.uleb128 0x1
+	.byte	0x61
+	.byte	0
+.LVUS1240:
+	.uleb128 .LVU2660
+	.uleb128 .LVU2662
+.LLST1240:
+	.byte	0x4
+	.uleb128 .LVL422-.Ltext0
+	.uleb128 .LVL422-.Ltext0
+	.uleb128 0x1
+	.byte	0x6e
+	.byte	0
+.LVUS1241:
+	.uleb128 .LVU2662
+	.uleb128 .LVU2666
+.LLST1241:
+	.byte	0x4
+	.uleb128 .LVL422-.Ltext0
+	.uleb128 .LVL423-.Ltext0
+	.uleb128 0x1
+	.byte	0x6b
+	.byte	0
+.LVUS1243:
+	.uleb128 .LVU2669
+	.uleb128 .LVU2671
+.LLST1243:
+	.byte	0x4
+	.uleb128 .LVL424-.Ltext0
+	.uleb128 .LVL424-.Ltext0
+	.uleb128 0x1
+	.byte	0x6b
+	.byte	0
+.LVUS1244:
+	.uleb128 .LVU2669
+	.uleb128 .LVU2671
+.LLST1244:
+	.byte	0x4
+	.uleb128 .LVL424-.Ltext0
+	.uleb128 .LVL424-.Ltext0
+	.uleb128 0x1
+	.byte	0x62
+	.byte	0
+.LVUS1246:
+	.uleb128 .LVU2675
+	.uleb128 .LVU2677
+.LLST1246:
+	.byte	0x4
+	.uleb128 .LVL425-.Ltext0
+	.uleb128 .LVL426-.Ltext0
+	.uleb128 0x1
+	.byte	0x62
+	.byte	0
+.LVUS1247:
+	.uleb128 .LVU2679
+	.uleb128 .LVU2682
+.LLST1247:
+	.byte	0x4
+	.uleb128 .LVL426-.Ltext0
+	.uleb128 .LVL427-.Ltext0
+	.uleb128 0x1
+	.byte	0x62
+	.byte	0
+.LVUS1248:
+	.uleb128 .LVU2679
+	.uleb128 .LVU2682
+.LLST1248:
+	.byte	0x4
+	.uleb128 .LVL426-.Ltext0
+	.uleb128 .LVL427-.Ltext0
+	.uleb128 0x1
+	.byte	0x63
+	.byte	0
+.LVUS1250:
+	.uleb128 .LVU2684
+	.uleb128 .LVU2686
+.LLST1250:
+	.byte	0x4
+	.uleb128 .LVL427-.Ltext0
+	.uleb128 .LVL427-.Ltext0
+	.uleb128 0x1
+	.byte	0x63
+	.byte	0
+.LVUS1251:
+	.uleb128 .LVU2684
+	.uleb128 .LVU2686
+.LLST1251:
+	.byte	0x4
+	.uleb128 .LVL427-.Ltext0
+	.uleb128 .LVL427-.Ltext0
+	.uleb128 0x1
+	.byte	0x61
+	.byte	0
+.LVUS1253:
+	.uleb128 .LVU2686
+	.uleb128 .LVU2699
+.LLST1253:
+	.byte	0x4
+	.uleb128 .LVL427-.Ltext0
+	.uleb128 .LVL432-.Ltext0
+	.uleb128 0x2
+	.byte	0x49
+	.byte	0x9f
+	.byte	0
+.LVUS1254:
+	.uleb128 .LVU2692
+	.uleb128 .LVU2697
+.LLST1254:
+	.byte	0x4
+	.uleb128 .LVL429-.Ltext0
+	.uleb128 .LVL431-.Ltext0
+	.uleb128 0x1
+	.byte	0x61
+	.byte	0
+.LVUS1256:
+	.uleb128 .LVU2720
+	.uleb128 .LVU2722
+.LLST1256:
+	.byte	0x4
+	.uleb128 .LVL434-.Ltext0
+	.uleb128 .LVL434-.Ltext0
+	.uleb128 0x3
+	.byte	0x8
+	.byte	0x39
+	.byte	0x9f
+	.byte	0
+.LVUS1258:
+	.uleb128 .LVU2716
+	.uleb128 .LVU2718
+.LLST1258:
+	.byte	0x4
+	.uleb128 .LVL434-.Ltext0
+	.uleb128 .LVL434-.Ltext0
+	.uleb128 0x3
+	.byte	0x8
+	.byte	0x4e
+	.byte	0x9f
+	.byte	0
+.LVUS1260:
+	.uleb128 .LVU2699
+	.uleb128 .LVU2702
+.LLST1260:
+	.byte	0x4
+	.uleb128 .LVL432-.Ltext0
+	.uleb128 .LVL432-.Ltext0
+	.uleb128 0x2
+	.byte	0x37
+	.byte	0x9f
+	.byte	0
+.LVUS1262:
+	.uleb128 .LVU2702
+	.uleb128 .LVU2705
+.LLST1262:
+	.byte	0x4
+	.uleb128 .LVL432-.Ltext0
+	.uleb128 .LVL432-.Ltext0
+	.uleb128 0x1
+	.byte	0x6a
+	.byte	0
+.LVUS1263:
+	.uleb128 .LVU2702
+	.uleb128 .LVU2705
+.LLST1263:
+	.byte	0x4
+	.uleb128 .LVL432-.Ltext0
+	.uleb128 .LVL432-.Ltext0
+	.uleb128 0x1
+	.byte	0x61
+	.byte	0
+.LVUS1265:
+	.uleb128 .LVU2708
+	.uleb128 .LVU2714
+.LLST1265:
+	.byte	0x4
+	.uleb128 .LVL432-.Ltext0
+	.uleb128 .LVL434-.Ltext0
+	.uleb128 0x3
+	.byte	0x8
+	.byte	0x93
+	.byte	0x9f
+	.byte	0
+.LVUS1266:
+	.uleb128 .LVU2711
+	.uleb128 .LVU2714
+.LLST1266:
+	.byte	0x4
+	.uleb128 .LVL433-.Ltext0
+	.uleb128 .LVL434-.Ltext0
+	.uleb128 0x1
+	.byte	0x61
+	.byte	0
+.LVUS1268:
+	.uleb128 .LVU2727
+	.uleb128 .LVU2729
+.LLST1268:
+	.byte	0x4
+	.uleb128 .LVL434-.Ltext0
+	.uleb128 .LVL434-.Ltext0
+	.uleb128 0x3
+	.byte	0x8
+	.byte	0xc0
+	.byte	0x9f
+	.byte	0
+.LVUS1269:
+	.uleb128 .LVU2727
+	.uleb128 .LVU2729
+.LLST1269:
+	.byte	0x4
+	.uleb128 .LVL434-.Ltext0
+	.uleb128 .LVL434-.Ltext0
+	.uleb128 0x1
+	.byte	0x65
+	.byte	0
+.LVUS1270:
+	.uleb128 .LVU2727
+	.uleb128 .LVU2729
+.LLST1270:
+	.byte	0x4
+	.uleb128 .LVL434-.Ltext0
+	.uleb128 .LVL434-.Ltext0
+	.uleb128 0x1
+	.byte	0x66
+	.byte	0
+.LVUS1272:
+	.uleb128 .LVU2731
+	.uleb128 .LVU2736
+.LLST1272:
+	.byte	0x4
+	.uleb128 .LVL434-.Ltext0
+	.uleb128 .LVL436-.Ltext0
+	.uleb128 0x2
+	.byte	0x3c
+	.byte	0x9f
+	.byte	0
+.LVUS1273:
+	.uleb128 .LVU2731
+	.uleb128 .LVU2736
+.LLST1273:
+	.byte	0x4
+	.uleb128 .LVL434-.Ltext0
+	.uleb128 .LVL436-.Ltext0
+	.uleb128 0x1
+	.byte	0x64
+	.byte	0
+.LVUS1274:
+	.uleb128 .LVU2731
+	.uleb128 .LVU2736
+.LLST1274:
+	.byte	0x4
+	.uleb128 .LVL434-.Ltext0
+	.uleb128 .LVL436-.Ltext0
+	.uleb128 0x1
+	.byte	0x6a
+	.byte	0
+.LVUS1276:
+	.uleb128 .LVU2748
+	.uleb128 .LVU2750
+.LLST1276:
+	.byte	0x4
+	.uleb128 .LVL438-.Ltext0
+	.uleb128 .LVL438-.Ltext0
+	.uleb128 0x3
+	.byte	0x8
+	.byte	0x60
+	.byte	0x9f
+	.byte	0
+.LVUS1278:
+	.uleb128 .LVU2738
+	.uleb128 .LVU2742
+.LLST1278:
+	.byte	0x4
+	.uleb128 .LVL436-.Ltext0
+	.uleb128 .LVL438-.Ltext0
+	.uleb128 0x3
+	.byte	0x8
+	.byte	0x72
+	.byte	0x9f
+	.byte	0
+.LVUS1279:
+	.uleb128 .LVU2738
+	.uleb128 .LVU2742
+.LLST1279:
+	.byte	0x4
+	.uleb128 .LVL436-.Ltext0
+	.uleb128 .LVL438-.Ltext0
+	.uleb128 0x1
+	.byte	0x6a
+	.byte	0
+.LVUS1281:
+	.uleb128 .LVU2744
+	.uleb128 .LVU2746
+.LLST1281:
+	.byte	0x4
+	.uleb128 .LVL438-.Ltext0
+	.uleb128 .LVL438-.Ltext0
+	.uleb128 0x3
+	.byte	0x8
+	.byte	0xe6
+	.byte	0x9f
+	.byte	0
+.LVUS1282:
+	.uleb128 .LVU2752
+	.uleb128 .LVU2755
+.LLST1282:
+	.byte	0x4
+	.uleb128 .LVL438-.Ltext0
+	.uleb128 .LVL439-.Ltext0
+	.uleb128 0x3
+	.byte	0x8
+	.byte	0xfc
+	.byte	0x9f
+	.byte	0
+.LVUS1283:
+	.uleb128 .LVU2752
+	.uleb128 .LVU2755
+.LLST1283:
+	.byte	0x4
+	.uleb128 .LVL438-.Ltext0
+	.uleb128 .LVL439-.Ltext0
+	.uleb128 0x1
+	.byte	0x65
+	.byte	0
+.LVUS1284:
+	.uleb128 .LVU2752
+	.uleb128 .LVU2755
+.LLST1284:
+	.byte	0x4
+	.uleb128 .LVL438-.Ltext0
+	.uleb128 .LVL439-.Ltext0
+	.uleb128 0x1
+	.byte	0x64
+	.byte	0
+.LVUS1285:
+	.uleb128 .LVU2757
+	.uleb128 .LVU2760
+.LLST1285:
+	.byte	0x4
+	.uleb128 .LVL439-.Ltext0
+	.uleb128 .LVL440-.Ltext0
+	.uleb128 0x3
+	.byte	0x8
+	.byte	0x67
+	.byte	0x9f
+	.byte	0
+.LVUS1286:
+	.uleb128 .LVU2757
+	.uleb128 .LVU2760
+.LLST1286:
+	.byte	0x4
+	.uleb128 .LVL439-.Ltext0
+	.uleb128 .LVL440-.Ltext0
+	.uleb128 0x1
+	.byte	0x67
+	.byte	0
+.LVUS1288:
+	.uleb128 .LVU2763
+	.uleb128 .LVU2768
+.LLST1288:
+	.byte	0x4
+	.uleb128 .LVL440-.Ltext0
+	.uleb128 .LVL442-.Ltext0
+	.uleb128 0x2
+	.byte	0x3c
+	.byte	0x9f
+	.byte	0
+.LVUS1289:
+	.uleb128 .LVU2763
+	.uleb128 .LVU2768
+.LLST1289:
+	.byte	0x4
+	.uleb128 .LVL440-.Ltext0
+	.uleb128 .LVL442-.Ltext0
+	.uleb128 0x1
+	.byte	0x66
+	.byte	0
+.LVUS1290:
+	.uleb128 .LVU2763
+	.uleb128 .LVU2768
+.LLST1290:
+	.byte	0x4
+	.uleb128 .LVL440-.Ltext0
+	.uleb128 .LVL442-.Ltext0
+	.uleb128 0x1
+	.byte	0x65
+	.byte	0
+.LVUS1293:
+	.uleb128 .LVU2771
+	.uleb128 .LVU2779
+.LLST1293:
+	.byte	0x4
+	.uleb128 .LVL442-.Ltext0
+	.uleb128 .LVL445-.Ltext0
+	.uleb128 0x3
+	.byte	0x8
+	.byte	0x30
+	.byte	0x9f
+	.byte	0
+.LVUS1294:
+	.uleb128 .LVU2771
+	.uleb128 .LVU2779
+.LLST1294:
+	.byte	0x4
+	.uleb128 .LVL442-.Ltext0
+	.uleb128 .LVL445-.Ltext0
+	.uleb128 0x1
+	.byte	0x69
+	.byte	0
+.LVUS1295:
+	.uleb128 .LVU2771
+	.uleb128 .LVU2779
+.LLST1295:
+	.byte	0x4
+	.uleb128 .LVL442-.Ltext0
+	.uleb128 .LVL445-.Ltext0
+	.uleb128 0x1
+	.byte	0x65
+	.byte	0
+.LVUS1297:
+	.uleb128 .LVU2782
+	.uleb128 .LVU2784
+.LLST1297:
+	.byte	0x4
+	.uleb128 .LVL445-.Ltext0
+	.uleb128 .LVL445-.Ltext0
+	.uleb128 0x3
+	.byte	0x8
+	.byte	0xc8
+	.byte	0x9f
+	.byte	0
+.LVUS1299:
+	.uleb128 .LVU2786
+	.uleb128 .LVU2791
+.LLST1299:
+	.byte	0x4
+	.uleb128 .LVL445-.Ltext0
+	.uleb128 .LVL447-.Ltext0
+	.uleb128 0x3
+	.byte	0x8
+	.byte	0x3c
+	.byte	0x9f
+	.byte	0
+.LVUS1300:
+	.uleb128 .LVU2786
+	.uleb128 .LVU2791
+.LLST1300:
+	.byte	0x4
+	.uleb128 .LVL445-.Ltext0
+	.uleb128 .LVL447-.Ltext0
+	.uleb128 0x1
+	.byte	0x67
+	.byte	0
+.LVUS1302:
+	.uleb128 .LVU2809
+	.uleb128 .LVU2811
+.LLST1302:
+	.byte	0x4
+	.uleb128 .LVL448-.Ltext0
+	.uleb128 .LVL448-.Ltext0
+	.uleb128 0x1
+	.byte	0x6a
+	.byte	0
+.LVUS1304:
+	.uleb128 .LVU2794
+	.uleb128 .LVU2798
+.LLST1304:
+	.byte	0x4
+	.uleb128 .LVL447-.Ltext0
+	.uleb128 .LVL448-.Ltext0
+	.uleb128 0x3
+	.byte	0x8
+	.byte	0xc0
+	.byte	0x9f
+	.byte	0
+.LVUS1305:
+	.uleb128 .LVU2794
+	.uleb128 .LVU2798
+.LLST1305:
+	.byte	0x4
+	.uleb128 .LVL447-.Ltext0
+	.uleb128 .LVL448-.Ltext0
+	.uleb128 0x1
+	.byte	0x68
+	.byte	0
+.LVUS1306:
+	.uleb128 .LVU2794
+	.uleb128 .LVU2798
+.LLST1306:
+	.byte	0x4
+	.uleb128 .LVL447-.Ltext0
+	.uleb128 .LVL448-.Ltext0
+	.uleb128 0x1
+	.byte	0x66
+	.byte	0
+.LVUS1308:
+	.uleb128 .LVU2802
+	.uleb128 .LVU2804
+.LLST1308:
+	.byte	0x4
+	.uleb128 .LVL448-.Ltext0
+	.uleb128 .LVL448-.Ltext0
+	.uleb128 0x1
+	.byte	0x61
+	.byte	0
+.LVUS1309:
+	.uleb128 .LVU2802
+	.uleb128 .LVU2804
+.LLST1309:
+	.byte	0x4
+	.uleb128 .LVL448-.Ltext0
+	.uleb128 .LVL448-.Ltext0
+	.uleb128 0x1
+	.byte	0x6b
+	.byte	0
+.LVUS1310:
+	.uleb128 .LVU2816
+	.uleb128 .LVU2819
+.LLST1310:
+	.byte	0x4
+	.uleb128 .LVL448-.Ltext0
+	.uleb128 .LVL449-.Ltext0
+	.uleb128 0x1
+	.byte	0x62
+	.byte	0
+.LVUS1311:
+	.uleb128 .LVU2816
+	.uleb128 .LVU2819
+.LLST1311:
+	.byte	0x4
+	.uleb128 .LVL448-.Ltext0
+	.uleb128 .LVL449-.Ltext0
+	.uleb128 0x1
+	.byte	0x63
+	.byte	0
+.LVUS1313:
+	.uleb128 .LVU2821
+	.uleb128 .LVU2823
+.LLST1313:
+	.byte	0x4
+	.uleb128 .LVL449-.Ltext0
+	.uleb128 .LVL449-.Ltext0
+	.uleb128 0x1
+	.byte	0x63
+	.byte	0
+.LVUS1314:
+	.uleb128 .LVU2821
+	.uleb128 .LVU2823
+.LLST1314:
+	.byte	0x4
+	.uleb128 .LVL449-.Ltext0
+	.uleb128 .LVL449-.Ltext0
+	.uleb128 0x1
+	.byte	0x61
+	.byte	0
+.LVUS1316:
+	.uleb128 .LVU2823
+	.uleb128 .LVU2832
+.LLST1316:
+	.byte	0x4
+	.uleb128 .LVL449-.Ltext0
+	.uleb128 .LVL452-.Ltext0
+	.uleb128 0x2
+	.byte	0x44
+	.byte	0x9f
+	.byte	0
+.LVUS1317:
+	.uleb128 .LVU2827
+	.uleb128 .LVU2830
+.LLST1317:
+	.byte	0x4
+	.uleb128 .LVL450-.Ltext0
+	.uleb128 .LVL451-.Ltext0
+	.uleb128 0x1
+	.byte	0x61
+	.byte	0
+.LVUS1319:
+	.uleb128 .LVU2832
+	.uleb128 .LVU2835
+.LLST1319:
+	.byte	0x4
+	.uleb128 .LVL452-.Ltext0
+	.uleb128 .LVL452-.Ltext0
+	.uleb128 0x2
+	.byte	0x3c
+	.byte	0x9f
+	.byte	0
+.LVUS1320:
+	.uleb128 .LVU2835
+	.uleb128 .LVU2839
+.LLST1320:
+	.byte	0x4
+	.uleb128 .LVL452-.Ltext0
+	.uleb128 .LVL453-.Ltext0
+	.uleb128 0x1
+	.byte	0x67
+	.byte	0
+.LVUS1321:
+	.uleb128 .LVU2835
+	.uleb128 .LVU2839
+.LLST1321:
+	.byte	0x4
+	.uleb128 .LVL452-.Ltext0
+	.uleb128 .LVL453-.Ltext0
+	.uleb128 0x1
+	.byte	0x61
+	.byte	0
+.LVUS1322:
+	.uleb128 .LVU2841
+	.uleb128 .LVU2843
+.LLST1322:
+	.byte	0x4
+	.uleb128 .LVL453-.Ltext0
+	.uleb128 .LVL453-.Ltext0
+	.uleb128 0x1
+	.byte	0x61
+	.byte	0
+.LVUS1323:
+	.uleb128 .LVU2841
+	.uleb128 .LVU2843
+.LLST1323:
+	.byte	0x4
+	.uleb128 .LVL453-.Ltext0
+	.uleb128 .LVL453-.Ltext0
+	.uleb128 0x1
+	.byte	0x6a
+	.byte	0
+.LVUS1324:
+	.uleb128 .LVU2843
+	.uleb128 .LVU2847
+.LLST1324:
+	.byte	0x4
+	.uleb128 .LVL453-.Ltext0
+	.uleb128 .LVL454-.Ltext0
+	.uleb128 0x1
+	.byte	0x64
+	.byte	0
+.LVUS1326:
+	.uleb128 .LVU2850
+	.uleb128 .LVU2852
+.LLST1326:
+	.byte	0x4
+	.uleb128 .LVL455-.Ltext0
+	.uleb128 .LVL455-.Ltext0
+	.uleb128 0x1
+	.byte	0x64
+	.byte	0
+.LVUS1327:
+	.uleb128 .LVU2850
+	.uleb128 .LVU2852
+.LLST1327:
+	.byte	0x4
+	.uleb128 .LVL455-.Ltext0
+	.uleb128 .LVL455-.Ltext0
+	.uleb128 0x1
+	.byte	0x62
+	.byte	0
+.LVUS1329:
+	.uleb128 .LVU2856
+	.uleb128 .LVU2858
+.LLST1329:
+	.byte	0x4
+	.uleb128 .LVL456-.Ltext0
+	.uleb128 .LVL457-.Ltext0
+	.uleb128 0x1
+	.byte	0x62
+	.byte	0
+.LVUS1330:
+	.uleb128 .LVU2860
+	.uleb128 .LVU2863
+.LLST1330:
+	.byte	0x4
+	.uleb128 .LVL457-.Ltext0
+	.uleb128 .LVL458-.Ltext0
+	.uleb128 0x1
+	.byte	0x62
+	.byte	0
+.LVUS1331:
+	.uleb128 .LVU2860
+	.uleb128 .LVU2863
+.LLST1331:
+	.byte	0x4
+	.uleb128 .LVL457-.Ltext0
+	.uleb128 .LVL458-.Ltext0
+	.uleb128 0x1
+	.byte	0x63
+	.byte	0
+.LVUS1333:
+	.uleb128 .LVU2865
+	.uleb128 .LVU2867
+.LLST1333:
+	.byte	0x4
+	.uleb128 .LVL458-.Ltext0
+	.uleb128 .LVL458-.Ltext0
+	.uleb128 0x1
+	.byte	0x63
+	.byte	0
+.LVUS1334:
+	.uleb128 .LVU2865
+	.uleb128 .LVU2867
+.LLST1334:
+	.byte	0x4
+	.uleb128 .LVL458-.Ltext0
+	.uleb128 .LVL458-.Ltext0
+	.uleb128 0x1
+	.byte	0x61
+	.byte	0
+.LVUS1336:
+	.uleb128 .LVU2867
+	.uleb128 .LVU2880
+.LLST1336:
+	.byte	0x4
+	.uleb128 .LVL458-.Ltext0
+	.uleb128 .LVL463-.Ltext0
+	.uleb128 0x2
+	.byte	0x49
+	.byte	0x9f
+	.byte	0
+.LVUS1337:
+	.uleb128 .LVU2873
+	.uleb128 .LVU2878
+.LLST1337:
+	.byte	0x4
+	.uleb128 .LVL460-.Ltext0
+	.uleb128 .LVL462-.Ltext0
+	.uleb128 0x1
+	.byte	0x61
+	.byte	0
+.LVUS1339:
+	.uleb128 .LVU2900
+	.uleb128 .LVU2902
+.LLST1339:
+	.byte	0x4
+	.uleb128 .LVL465-.Ltext0
+	.uleb128 .LVL465-.Ltext0
+	.uleb128 0x3
+	.byte	0x8
+	.byte	0x93
+	.byte	0x9f
+	.byte	0
+.LVUS1341:
+	.uleb128 .LVU2896
+	.uleb128 .LVU2898
+.LLST1341:
+	.byte	0x4
+	.uleb128 .LVL465-.Ltext0
+	.uleb128 .LVL465-.Ltext0
+	.uleb128 0x3
+	.byte	0x8
+	.byte	0x4e
+	.byte	0x9f
+	.byte	0
+.LVUS1343:
+	.uleb128 .LVU2880
+	.uleb128 .LVU2883
+.LLST1343:
+	.byte	0x4
+	.uleb128 .LVL463-.Ltext0
+	.uleb128 .LVL463-.Ltext0
+	.uleb128 0x2
+	.byte	0x37
+	.byte	0x9f
+	.byte	0
+.LVUS1345:
+	.uleb128 .LVU2883
+	.uleb128 .LVU2886
+.LLST1345:
+	.byte	0x4
+	.uleb128 .LVL463-.Ltext0
+	.uleb128 .LVL463-.Ltext0
+	.uleb128 0x1
+	.byte	0x67
+	.byte	0
+.LVUS1346:
+	.uleb128 .LVU2883
+	.uleb128 .LVU2886
+.LLST1346:
+	.byte	0x4
+	.uleb128 .LVL463-.Ltext0
+	.uleb128 .LVL463-.Ltext0
+	.uleb128 0x1
+	.byte	0x61
+	.byte	0
+.LVUS1348:
+	.uleb128 .LVU2889
+	.uleb128 .LVU2894
+.LLST1348:
+	.byte	0x4
+	.uleb128 .LVL463-.Ltext0
+	.uleb128 .LVL465-.Ltext0
+	.uleb128 0x3
+	.byte	0x8
+	.byte	0x39
+	.byte	0x9f
+	.byte	0
+.LVUS1349:
+	.uleb128 .LVU2892
+	.uleb128 .LVU2894
+.LLST1349:
+	.byte	0x4
+	.uleb128 .LVL464-.Ltext0
+	.uleb128 .LVL465-.Ltext0
+	.uleb128 0x1
+	.byte	0x61
+	.byte	0
+.LVUS1350:
+	.uleb128 .LVU2905
+	.uleb128 .LVU2907
+.LLST1350:
+	.byte	0x4
+	.uleb128 .LVL465-.Ltext0
+	.uleb128 .LVL465-.Ltext0
+	.uleb128 0x1
+	.byte	0x61
+	.byte	0
+.LVUS1351:
+	.uleb128 .LVU2905
+	.uleb128 .LVU2907
+.LLST1351:
+	.byte	0x4
+	.uleb128 .LVL465-.Ltext0
+	.uleb128 .LVL465-.Ltext0
+	.uleb128 0x1
+	.byte	0x64
+	.byte	0
+.LVUS1352:
+	.uleb128 .LVU2907
+	.uleb128 .LVU2911
+.LLST1352:
+	.byte	0x4
+	.uleb128 .LVL465-.Ltext0
+	.uleb128 .LVL466-.Ltext0
+	.uleb128 0x1
+	.byte	0x65
+	.byte	0
+.LVUS1354:
+	.uleb128 .LVU2914
+	.uleb128 .LVU2916
+.LLST1354:
+	.byte	0x4
+	.uleb128 .LVL467-.Ltext0
+	.uleb128 .LVL467-.Ltext0
+	.uleb128 0x1
+	.byte	0x65
+	.byte	0
+.LVUS1355:
+	.uleb128 .LVU2914
+	.uleb128 .LVU2916
+.LLST1355:
+	.byte	0x4
+	.uleb128 .LVL467-.Ltext0
+	.uleb128 .LVL467-.Ltext0
+	.uleb128 0x1
+	.byte	0x62
+	.byte	0
+.LVUS1357:
+	.uleb128 .LVU2920
+	.uleb128 .LVU2922
+.LLST1357:
+	.byte	0x4
+	.uleb128 .LVL468-.Ltext0
+	.uleb128 .LVL469-.Ltext0
+	.uleb128 0x1
+	.byte	0x62
+	.byte	0
+.LVUS1358:
+	.uleb128 .LVU2924
+	.uleb128 .LVU2927
+.LLST1358:
+	.byte	0x4
+	.uleb128 .LVL469-.Ltext0
+	.uleb128 .LVL470-.Ltext0
+	.uleb128 0x1
+	.byte	0x62
+	.byte	0
+.LVUS1359:
+	.uleb128 .LVU2924
+	.uleb128 .LVU2927
+.LLST1359:
+	.byte	0x4
+	.uleb128 .LVL469-.Ltext0
+	.uleb128 .LVL470-.Ltext0
+	.uleb128 0x1
+	.byte	0x63
+	.byte	0
+.LVUS1361:
+	.uleb128 .LVU2929
+	.uleb128 .LVU2931
+.LLST1361:
+	.byte	0x4
+	.uleb128 .LVL470-.Ltext0
+	.uleb128 .LVL470-.Ltext0
+	.uleb128 0x1
+	.byte	0x63
+	.byte	0
+.LVUS1362:
+	.uleb128 .LVU2929
+	.uleb128 .LVU2931
+.LLST1362:
+	.byte	0x4
+	.uleb128 .LVL470-.Ltext0
+	.uleb128 .LVL470-.Ltext0
+	.uleb128 0x1
+	.byte	0x61
+	.byte	0
+.LVUS1364:
+	.uleb128 .LVU2931
+	.uleb128 .LVU2940
+.LLST1364:
+	.byte	0x4
+	.uleb128 .LVL470-.Ltext0
+	.uleb128 .LVL473-.Ltext0
+	.uleb128 0x2
+	.byte	0x44
+	.byte	0x9f
+	.byte	0
+.LVUS1365:
+	.uleb128 .LVU2935
+	.uleb128 .LVU2938
+.LLST1365:
+	.byte	0x4
+	.uleb128 .LVL471-.Ltext0
+	.uleb128 .LVL472-.Ltext0
+	.uleb128 0x1
+	.byte	0x61
+	.byte	0
+.LVUS1367:
+	.uleb128 .LVU2940
+	.uleb128 .LVU2943
+.LLST1367:
+	.byte	0x4
+	.uleb128 .LVL473-.Ltext0
+	.uleb128 .LVL473-.Ltext0
+	.uleb128 0x2
+	.byte	0x3c
+	.byte	0x9f
+	.byte	0
+.LVUS1368:
+	.uleb128 .LVU2943
+	.uleb128 .LVU2947
+.LLST1368:
+	.byte	0x4
+	.uleb128 .LVL473-.Ltext0
+	.uleb128 .LVL474-.Ltext0
+	.uleb128 0x1
+	.byte	0x64
+	.byte	0
+.LVUS1369:
+	.uleb128 .LVU2943
+	.uleb128 .LVU2947
+.LLST1369:
+	.byte	0x4
+	.uleb128 .LVL473-.Ltext0
+	.uleb128 .LVL474-.Ltext0
+	.uleb128 0x1
+	.byte	0x61
+	.byte	0
+.LVUS1370:
+	.uleb128 .LVU2949
+	.uleb128 .LVU2951
+.LLST1370:
+	.byte	0x4
+	.uleb128 .LVL474-.Ltext0
+	.uleb128 .LVL474-.Ltext0
+	.uleb128 0x1
+	.byte	0x61
+	.byte	0
+.LVUS1371:
+	.uleb128 .LVU2949
+	.uleb128 .LVU2951
+.LLST1371:
+	.byte	0x4
+	.uleb128 .LVL474-.Ltext0
+	.uleb128 .LVL474-.Ltext0
+	.uleb128 0x1
+	.byte	0x65
+	.byte	0
+.LVUS1373:
+	.uleb128 .LVU2951
+	.uleb128 .LVU2954
+.LLST1373:
+	.byte	0x4
+	.uleb128 .LVL474-.Ltext0
+	.uleb128 .LVL474-.Ltext0
+	.uleb128 0x1
+	.byte	0x66
+	.byte	0
+.LVUS1375:
+	.uleb128 .LVU2956
+	.uleb128 .LVU2960
+.LLST1375:
+	.byte	0x4
+	.uleb128 .LVL474-.Ltext0
+	.uleb128 .LVL476-.Ltext0
+	.uleb128 0x1
+	.byte	0x62
+	.byte	0
+.LVUS1377:
+	.uleb128 .LVU2964
+	.uleb128 .LVU2966
+.LLST1377:
+	.byte	0x4
+	.uleb128 .LVL477-.Ltext0
+	.uleb128 .LVL478-.Ltext0
+	.uleb128 0x1
+	.byte	0x62
+	.byte	0
+.LVUS1378:
+	.uleb128 .LVU2968
+	.uleb128 .LVU2971
+.LLST1378:
+	.byte	0x4
+	.uleb128 .LVL478-.Ltext0
+	.uleb128 .LVL479-.Ltext0
+	.uleb128 0x1
+	.byte	0x62
+	.byte	0
+.LVUS1379:
+	.uleb128 .LVU2968
+	.uleb128 .LVU2971
+.LLST1379:
+	.byte	0x4
+	.uleb128 .LVL478-.Ltext0
+	.uleb128 .LVL479-.Ltext0
+	.uleb128 0x1
+	.byte	0x63
+	.byte	0
+.LVUS1381:
+	.uleb128 .LVU2973
+	.uleb128 .LVU2975
+.LLST1381:
+	.byte	0x4
+	.uleb128 .LVL479-.Ltext0
+	.uleb128 .LVL479-.Ltext0
+	.uleb128 0x1
+	.byte	0x63
+	.byte	0
+.LVUS1382:
+	.uleb128 .LVU2973
+	.uleb128 .LVU2975
+.LLST1382:
+	.byte	0x4
+	.uleb128 .LVL479-.Ltext0
+	.uleb128 .LVL479-.Ltext0
+	.uleb128 0x1
+	.byte	0x61
+	.byte	0
+.LVUS1384:
+	.uleb128 .LVU2975
+	.uleb128 .LVU2989
+.LLST1384:
+	.byte	0x4
+	.uleb128 .LVL479-.Ltext0
+	.uleb128 .LVL484-.Ltext0
+	.uleb128 0x2
+	.byte	0x49
+	.byte	0x9f
+	.byte	0
+.LVUS1385:
+	.uleb128 .LVU2981
+	.uleb128 .LVU2987
+.LLST1385:
+	.byte	0x4
+	.uleb128 .LVL481-.Ltext0
+	.uleb128 .LVL483-.Ltext0
+	.uleb128 0x1
+	.byte	0x61
+	.byte	0
+.LVUS1387:
+	.uleb128 .LVU3011
+	.uleb128 .LVU3013
+.LLST1387:
+	.byte	0x4
+	.uleb128 .LVL486-.Ltext0
+	.uleb128 .LVL486-.Ltext0
+	.uleb128 0x3
+	.byte	0x8
+	.byte	0x39
+	.byte	0x9f
+	.byte	0
+.LVUS1389:
+	.uleb128 .LVU3007
+	.uleb128 .LVU3009
+.LLST1389:
+	.byte	0x4
+	.uleb128 .LVL486-.Ltext0
+	.uleb128 .LVL486-.Ltext0
+	.uleb128 0x3
+	.byte	0x8
+	.byte	0x4e
+	.byte	0x9f
+	.byte	0
+.LVUS1392:
+	.uleb128 .LVU2989
+	.uleb128 .LVU2992
+.LLST1392:
+	.byte	0x4
+	.uleb128 .LVL484-.Ltext0
+	.uleb128 .LVL484-.Ltext0
+	.uleb128 0x2
+	.byte	0x37
+	.byte	0x9f
+	.byte	0
+.LVUS1394:
+	.uleb128 .LVU2992
+	.uleb128 .LVU2995
+.LLST1394:
+	.byte	0x4
+	.uleb128 .LVL484-.Ltext0
+	.uleb128 .LVL484-.Ltext0
+	.uleb128 0x1
+	.byte	0x64
+	.byte	0
+.LVUS1395:
+	.uleb128 .LVU2992
+	.uleb128 .LVU2995
+.LLST1395:
+	.byte	0x4
+	.uleb128 .LVL484-.Ltext0
+	.uleb128 .LVL484-.Ltext0
+	.uleb128 0x1
+	.byte	0x61
+	.byte	0
+.LVUS1397:
+	.uleb128 .LVU2998
+	.uleb128 .LVU3005
+.LLST1397:
+	.byte	0x4
+	.uleb128 .LVL484-.Ltext0
+	.uleb128 .LVL486-.Ltext0
+	.uleb128 0x3
+	.byte	0x8
+	.byte	0x93
+	.byte	0x9f
+	.byte	0
+.LVUS1398:
+	.uleb128 .LVU3002
+	.uleb128 .LVU3005
+.LLST1398:
+	.byte	0x4
+	.uleb128 .LVL485-.Ltext0
+	.uleb128 .LVL486-.Ltext0
+	.uleb128 0x1
+	.byte	0x61
+	.byte	0
+.LVUS1400:
+	.uleb128 .LVU3023
+	.uleb128 .LVU3025
+.LLST1400:
+	.byte	0x4
+	.uleb128 .LVL486-.Ltext0
+	.uleb128 .LVL486-.Ltext0
+	.uleb128 0x1
+	.byte	0x62
+	.byte	0
+.LVUS1401:
+	.uleb128 .LVU3023
+	.uleb128 .LVU3025
+.LLST1401:
+	.byte	0x4
+	.uleb128 .LVL486-.Ltext0
+	.uleb128 .LVL486-.Ltext0
+	.uleb128 0x1
+	.byte	0x61
+	.byte	0
+.LVUS1403:
+	.uleb128 .LVU3025
+	.uleb128 .LVU3028
+.LLST1403:
+	.byte	0x4
+	.uleb128 .LVL486-.Ltext0
+	.uleb128 .LVL486-.Ltext0
+	.uleb128 0x2
+	.byte	0x75
+	.sleb128 16
+	.byte	0
+.Ldebug_loc3:
+	.section	.debug_aranges,"",@progbits
+	.long	0x2c
+	.value	0x2
+	.long	.Ldebug_info0
+	.byte	0x8
+	.byte	0
+	.value	0
+	.value	0
+	.quad	.Ltext0
+	.quad	.Letext0-.Ltext0
+	.quad	0
+	.quad	0
+	.section	.debug_rnglists,"",@progbits
+.Ldebug_ranges0:
+	.long	.Ldebug_ranges3-.Ldebug_ranges2
+.Ldebug_ranges2:
+	.value	0x5
+	.byte	0x8
+	.byte	0
+	.long	0
+.LLRL17:
+	.byte	0x4
+	.uleb128 .LBB2469-.Ltext0
+	.uleb128 .LBE2469-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB2476-.Ltext0
+	.uleb128 .LBE2476-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB2483-.Ltext0
+	.uleb128 .LBE2483-.Ltext0
+	.byte	0
+.LLRL21:
+	.byte	0x4
+	.uleb128 .LBB2473-.Ltext0
+	.uleb128 .LBE2473-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB2529-.Ltext0
+	.uleb128 .LBE2529-.Ltext0
+	.byte	0
+.LLRL23:
+	.byte	0x4
+	.uleb128 .LBB2477-.Ltext0
+	.uleb128 .LBE2477-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB2485-.Ltext0
+	.uleb128 .LBE2485-.Ltext0
+	.byte	0
+.LLRL26:
+	.byte	0x4
+	.uleb128 .LBB2480-.Ltext0
+	.uleb128 .LBE2480-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB2484-.Ltext0
+	.uleb128 .LBE2484-.Ltext0
+	.byte	0
+.LLRL32:
+	.byte	0x4
+	.uleb128 .LBB2488-.Ltext0
+	.uleb128 .LBE2488-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB2497-.Ltext0
+	.uleb128 .LBE2497-.Ltext0
+	.byte	0
+.LLRL35:
+	.byte	0x4
+	.uleb128 .LBB2491-.Ltext0
+	.uleb128 .LBE2491-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB2498-.Ltext0
+	.uleb128 .LBE2498-.Ltext0
+	.byte	0
+.LLRL38:
+	.byte	0x4
+	.uleb128 .LBB2494-.Ltext0
+	.uleb128 .LBE2494-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB2530-.Ltext0
+	.uleb128 .LBE2530-.Ltext0
+	.byte	0
+.LLRL39:
+	.byte	0x4
+	.uleb128 .LBB2499-.Ltext0
+	.uleb128 .LBE2499-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB2515-.Ltext0
+	.uleb128 .LBE2515-.Ltext0
+	.byte	0
+.LLRL43:
+	.byte	0x4
+	.uleb128 .LBB2502-.Ltext0
+	.uleb128 .LBE2502-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB2527-.Ltext0
+	.uleb128 .LBE2527-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB2533-.Ltext0
+	.uleb128 .LBE2533-.Ltext0
+	.byte	0
+.LLRL45:
+	.byte	0x4
+	.uleb128 .LBB2506-.Ltext0
+	.uleb128 .LBE2506-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB2523-.Ltext0
+	.uleb128 .LBE2523-.Ltext0
+	.byte	0
+.LLRL48:
+	.byte	0x4
+	.uleb128 .LBB2509-.Ltext0
+	.uleb128 .LBE2509-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB2531-.Ltext0
+	.uleb128 .LBE2531-.Ltext0
+	.byte	0
+.LLRL49:
+	.byte	0x4
+	.uleb128 .LBB2512-.Ltext0
+	.uleb128 .LBE2512-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB2552-.Ltext0
+	.uleb128 .LBE2552-.Ltext0
+	.byte	0
+.LLRL51:
+	.byte	0x4
+	.uleb128 .LBB2516-.Ltext0
+	.uleb128 .LBE2516-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB2522-.Ltext0
+	.uleb128 .LBE2522-.Ltext0
+	.byte	0
+.LLRL54:
+	.byte	0x4
+	.uleb128 .LBB2519-.Ltext0
+	.uleb128 .LBE2519-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB2532-.Ltext0
+	.uleb128 .LBE2532-.Ltext0
+	.byte	0
+.LLRL55:
+	.byte	0x4
+	.uleb128 .LBB2524-.Ltext0
+	.uleb128 .LBE2524-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB2528-.Ltext0
+	.uleb128 .LBE2528-.Ltext0
+	.byte	0
+.LLRL59:
+	.byte	0x4
+	.uleb128 .LBB2534-.Ltext0
+	.uleb128 .LBE2534-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB2541-.Ltext0
+	.uleb128 .LBE2541-.Ltext0
+	.byte	0
+.LLRL62:
+	.byte	0x4
+	.uleb128 .LBB2537-.Ltext0
+	.uleb128 .LBE2537-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB2542-.Ltext0
+	.uleb128 .LBE2542-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB2546-.Ltext0
+	.uleb128 .LBE2546-.Ltext0
+	.byte	0
+.LLRL65:
+	.byte	0x4
+	.uleb128 .LBB2543-.Ltext0
+	.uleb128 .LBE2543-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB2547-.Ltext0
+	.uleb128 .LBE2547-.Ltext0
+	.byte	0
+.LLRL70:
+	.byte	0x4
+	.uleb128 .LBB2553-.Ltext0
+	.uleb128 .LBE2553-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB2559-.Ltext0
+	.uleb128 .LBE2559-.Ltext0
+	.byte	0
+.LLRL73:
+	.byte	0x4
+	.uleb128 .LBB2556-.Ltext0
+	.uleb128 .LBE2556-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB2560-.Ltext0
+	.uleb128 .LBE2560-.Ltext0
+	.byte	0
+.LLRL77:
+	.byte	0x4
+	.uleb128 .LBB2563-.Ltext0
+	.uleb128 .LBE2563-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB2573-.Ltext0
+	.uleb128 .LBE2573-.Ltext0
+	.byte	0
+.LLRL80:
+	.byte	0x4
+	.uleb128 .LBB2566-.Ltext0
+	.uleb128 .LBE2566-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB2577-.Ltext0
+	.uleb128 .LBE2577-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB2581-.Ltext0
+	.uleb128 .LBE2581-.Ltext0
+	.byte	0
+.LLRL83:
+	.byte	0x4
+	.uleb128 .LBB2570-.Ltext0
+	.uleb128 .LBE2570-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB2592-.Ltext0
+	.uleb128 .LBE2592-.Ltext0
+	.byte	0
+.LLRL86:
+	.byte	0x4
+	.uleb128 .LBB2574-.Ltext0
+	.uleb128 .LBE2574-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB2591-.Ltext0
+	.uleb128 .LBE2591-.Ltext0
+	.byte	0
+.LLRL88:
+	.byte	0x4
+	.uleb128 .LBB2578-.Ltext0
+	.uleb128 .LBE2578-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB2582-.Ltext0
+	.uleb128 .LBE2582-.Ltext0
+	.byte	0
+.LLRL90:
+	.byte	0x4
+	.uleb128 .LBB2583-.Ltext0
+	.uleb128 .LBE2583-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB2589-.Ltext0
+	.uleb128 .LBE2589-.Ltext0
+	.byte	0
+.LLRL93:
+	.byte	0x4
+	.uleb128 .LBB2586-.Ltext0
+	.uleb128 .LBE2586-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB2590-.Ltext0
+	.uleb128 .LBE2590-.Ltext0
+	.byte	0
+.LLRL99:
+	.byte	0x4
+	.uleb128 .LBB2597-.Ltext0
+	.uleb128 .LBE2597-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB2603-.Ltext0
+	.uleb128 .LBE2603-.Ltext0
+	.byte	0
+.LLRL102:
+	.byte	0x4
+	.uleb128 .LBB2600-.Ltext0
+	.uleb128 .LBE2600-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB2604-.Ltext0
+	.uleb128 .LBE2604-.Ltext0
+	.byte	0
+.LLRL106:
+	.byte	0x4
+	.uleb128 .LBB2607-.Ltext0
+	.uleb128 .LBE2607-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB2614-.Ltext0
+	.uleb128 .LBE2614-.Ltext0
+	.byte	0
+.LLRL109:
+	.byte	0x4
+	.uleb128 .LBB2610-.Ltext0
+	.uleb128 .LBE2610-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB2615-.Ltext0
+	.uleb128 .LBE2615-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB2619-.Ltext0
+	.uleb128 .LBE2619-.Ltext0
+	.byte	0
+.LLRL112:
+	.byte	0x4
+	.uleb128 .LBB2616-.Ltext0
+	.uleb128 .LBE2616-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB2620-.Ltext0
+	.uleb128 .LBE2620-.Ltext0
+	.byte	0
+.LLRL119:
+	.byte	0x4
+	.uleb128 .LBB2627-.Ltext0
+	.uleb128 .LBE2627-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB2636-.Ltext0
+	.uleb128 .LBE2636-.Ltext0
+	.byte	0
+.LLRL122:
+	.byte	0x4
+	.uleb128 .LBB2630-.Ltext0
+	.uleb128 .LBE2630-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB2643-.Ltext0
+	.uleb128 .LBE2643-.Ltext0
+	.byte	0
+.LLRL124:
+	.byte	0x4
+	.uleb128 .LBB2633-.Ltext0
+	.uleb128 .LBE2633-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB2699-.Ltext0
+	.uleb128 .LBE2699-.Ltext0
+	.byte	0
+.LLRL127:
+	.byte	0x4
+	.uleb128 .LBB2637-.Ltext0
+	.uleb128 .LBE2637-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB2700-.Ltext0
+	.uleb128 .LBE2700-.Ltext0
+	.byte	0
+.LLRL130:
+	.byte	0x4
+	.uleb128 .LBB2640-.Ltext0
+	.uleb128 .LBE2640-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB2701-.Ltext0
+	.uleb128 .LBE2701-.Ltext0
+	.byte	0
+.LLRL135:
+	.byte	0x4
+	.uleb128 .LBB2646-.Ltext0
+	.uleb128 .LBE2646-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB2659-.Ltext0
+	.uleb128 .LBE2659-.Ltext0
+	.byte	0
+.LLRL138:
+	.byte	0x4
+	.uleb128 .LBB2649-.Ltext0
+	.uleb128 .LBE2649-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB2670-.Ltext0
+	.uleb128 .LBE2670-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB2675-.Ltext0
+	.uleb128 .LBE2675-.Ltext0
+	.byte	0
+.LLRL141:
+	.byte	0x4
+	.uleb128 .LBB2653-.Ltext0
+	.uleb128 .LBE2653-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB2696-.Ltext0
+	.uleb128 .LBE2696-.Ltext0
+	.byte	0
+.LLRL143:
+	.byte	0x4
+	.uleb128 .LBB2656-.Ltext0
+	.uleb128 .LBE2656-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB2705-.Ltext0
+	.uleb128 .LBE2705-.Ltext0
+	.byte	0
+.LLRL146:
+	.byte	0x4
+	.uleb128 .LBB2660-.Ltext0
+	.uleb128 .LBE2660-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB2695-.Ltext0
+	.uleb128 .LBE2695-.Ltext0
+	.byte	0
+.LLRL148:
+	.byte	0x4
+	.uleb128 .LBB2663-.Ltext0
+	.uleb128 .LBE2663-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB2674-.Ltext0
+	.uleb128 .LBE2674-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB2706-.Ltext0
+	.uleb128 .LBE2706-.Ltext0
+	.byte	0
+.LLRL150:
+	.byte	0x4
+	.uleb128 .LBB2667-.Ltext0
+	.uleb128 .LBE2667-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB2704-.Ltext0
+	.uleb128 .LBE2704-.Ltext0
+	.byte	0
+.LLRL153:
+	.byte	0x4
+	.uleb128 .LBB2671-.Ltext0
+	.uleb128 .LBE2671-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB2676-.Ltext0
+	.uleb128 .LBE2676-.Ltext0
+	.byte	0
+.LLRL155:
+	.byte	0x4
+	.uleb128 .LBB2677-.Ltext0
+	.uleb128 .LBE2677-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB2686-.Ltext0
+	.uleb128 .LBE2686-.Ltext0
+	.byte	0
+.LLRL158:
+	.byte	0x4
+	.uleb128 .LBB2680-.Ltext0
+	.uleb128 .LBE2680-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB2694-.Ltext0
+	.uleb128 .LBE2694-.Ltext0
+	.byte	0
+.LLRL161:
+	.byte	0x4
+	.uleb128 .LBB2683-.Ltext0
+	.uleb128 .LBE2683-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB2719-.Ltext0
+	.uleb128 .LBE2719-.Ltext0
+	.byte	0
+.LLRL164:
+	.byte	0x4
+	.uleb128 .LBB2687-.Ltext0
+	.uleb128 .LBE2687-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB2720-.Ltext0
+	.uleb128 .LBE2720-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB2722-.Ltext0
+	.uleb128 .LBE2722-.Ltext0
+	.byte	0
+.LLRL167:
+	.byte	0x4
+	.uleb128 .LBB2691-.Ltext0
+	.uleb128 .LBE2691-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB2723-.Ltext0
+	.uleb128 .LBE2723-.Ltext0
+	.byte	0
+.LLRL177:
+	.byte	0x4
+	.uleb128 .LBB2709-.Ltext0
+	.uleb128 .LBE2709-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB2716-.Ltext0
+	.uleb128 .LBE2716-.Ltext0
+	.byte	0
+.LLRL181:
+	.byte	0x4
+	.uleb128 .LBB2712-.Ltext0
+	.uleb128 .LBE2712-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB2721-.Ltext0
+	.uleb128 .LBE2721-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB2749-.Ltext0
+	.uleb128 .LBE2749-.Ltext0
+	.byte	0
+.LLRL184:
+	.byte	0x4
+	.uleb128 .LBB2724-.Ltext0
+	.uleb128 .LBE2724-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB2730-.Ltext0
+	.uleb128 .LBE2730-.Ltext0
+	.byte	0
+.LLRL188:
+	.byte	0x4
+	.uleb128 .LBB2727-.Ltext0
+	.uleb128 .LBE2727-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB2750-.Ltext0
+	.uleb128 .LBE2750-.Ltext0
+	.byte	0
+.LLRL190:
+	.byte	0x4
+	.uleb128 .LBB2731-.Ltext0
+	.uleb128 .LBE2731-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB2737-.Ltext0
+	.uleb128 .LBE2737-.Ltext0
+	.byte	0
+.LLRL194:
+	.byte	0x4
+	.uleb128 .LBB2734-.Ltext0
+	.uleb128 .LBE2734-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB2751-.Ltext0
+	.uleb128 .LBE2751-.Ltext0
+	.byte	0
+.LLRL197:
+	.byte	0x4
+	.uleb128 .LBB2740-.Ltext0
+	.uleb128 .LBE2740-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB2746-.Ltext0
+	.uleb128 .LBE2746-.Ltext0
+	.byte	0
+.LLRL201:
+	.byte	0x4
+	.uleb128 .LBB2743-.Ltext0
+	.uleb128 .LBE2743-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB2752-.Ltext0
+	.uleb128 .LBE2752-.Ltext0
+	.byte	0
+.LLRL205:
+	.byte	0x4
+	.uleb128 .LBB2753-.Ltext0
+	.uleb128 .LBE2753-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB2760-.Ltext0
+	.uleb128 .LBE2760-.Ltext0
+	.byte	0
+.LLRL208:
+	.byte	0x4
+	.uleb128 .LBB2756-.Ltext0
+	.uleb128 .LBE2756-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB2761-.Ltext0
+	.uleb128 .LBE2761-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB2765-.Ltext0
+	.uleb128 .LBE2765-.Ltext0
+	.byte	0
+.LLRL211:
+	.byte	0x4
+	.uleb128 .LBB2762-.Ltext0
+	.uleb128 .LBE2762-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB2766-.Ltext0
+	.uleb128 .LBE2766-.Ltext0
+	.byte	0
+.LLRL218:
+	.byte	0x4
+	.uleb128 .LBB2773-.Ltext0
+	.uleb128 .LBE2773-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB2779-.Ltext0
+	.uleb128 .LBE2779-.Ltext0
+	.byte	0
+.LLRL221:
+	.byte	0x4
+	.uleb128 .LBB2776-.Ltext0
+	.uleb128 .LBE2776-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB2780-.Ltext0
+	.uleb128 .LBE2780-.Ltext0
+	.byte	0
+.LLRL225:
+	.byte	0x4
+	.uleb128 .LBB2783-.Ltext0
+	.uleb128 .LBE2783-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB2793-.Ltext0
+	.uleb128 .LBE2793-.Ltext0
+	.byte	0
+.LLRL228:
+	.byte	0x4
+	.uleb128 .LBB2786-.Ltext0
+	.uleb128 .LBE2786-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB2797-.Ltext0
+	.uleb128 .LBE2797-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB2801-.Ltext0
+	.uleb128 .LBE2801-.Ltext0
+	.byte	0
+.LLRL231:
+	.byte	0x4
+	.uleb128 .LBB2790-.Ltext0
+	.uleb128 .LBE2790-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB2812-.Ltext0
+	.uleb128 .LBE2812-.Ltext0
+	.byte	0
+.LLRL233:
+	.byte	0x4
+	.uleb128 .LBB2794-.Ltext0
+	.uleb128 .LBE2794-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB2811-.Ltext0
+	.uleb128 .LBE2811-.Ltext0
+	.byte	0
+.LLRL235:
+	.byte	0x4
+	.uleb128 .LBB2798-.Ltext0
+	.uleb128 .LBE2798-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB2802-.Ltext0
+	.uleb128 .LBE2802-.Ltext0
+	.byte	0
+.LLRL237:
+	.byte	0x4
+	.uleb128 .LBB2803-.Ltext0
+	.uleb128 .LBE2803-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB2809-.Ltext0
+	.uleb128 .LBE2809-.Ltext0
+	.byte	0
+.LLRL240:
+	.byte	0x4
+	.uleb128 .LBB2806-.Ltext0
+	.uleb128 .LBE2806-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB2810-.Ltext0
+	.uleb128 .LBE2810-.Ltext0
+	.byte	0
+.LLRL246:
+	.byte	0x4
+	.uleb128 .LBB2817-.Ltext0
+	.uleb128 .LBE2817-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB2823-.Ltext0
+	.uleb128 .LBE2823-.Ltext0
+	.byte	0
+.LLRL249:
+	.byte	0x4
+	.uleb128 .LBB2820-.Ltext0
+	.uleb128 .LBE2820-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB2824-.Ltext0
+	.uleb128 .LBE2824-.Ltext0
+	.byte	0
+.LLRL253:
+	.byte	0x4
+	.uleb128 .LBB2827-.Ltext0
+	.uleb128 .LBE2827-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB2834-.Ltext0
+	.uleb128 .LBE2834-.Ltext0
+	.byte	0
+.LLRL256:
+	.byte	0x4
+	.uleb128 .LBB2830-.Ltext0
+	.uleb128 .LBE2830-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB2835-.Ltext0
+	.uleb128 .LBE2835-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB2839-.Ltext0
+	.uleb128 .LBE2839-.Ltext0
+	.byte	0
+.LLRL259:
+	.byte	0x4
+	.uleb128 .LBB2836-.Ltext0
+	.uleb128 .LBE2836-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB2840-.Ltext0
+	.uleb128 .LBE2840-.Ltext0
+	.byte	0
+.LLRL265:
+	.byte	0x4
+	.uleb128 .LBB2845-.Ltext0
+	.uleb128 .LBE2845-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB2851-.Ltext0
+	.uleb128 .LBE2851-.Ltext0
+	.byte	0
+.LLRL267:
+	.byte	0x4
+	.uleb128 .LBB2848-.Ltext0
+	.uleb128 .LBE2848-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB2911-.Ltext0
+	.uleb128 .LBE2911-.Ltext0
+	.byte	0
+.LLRL270:
+	.byte	0x4
+	.uleb128 .LBB2852-.Ltext0
+	.uleb128 .LBE2852-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB2861-.Ltext0
+	.uleb128 .LBE2861-.Ltext0
+	.byte	0
+.LLRL273:
+	.byte	0x4
+	.uleb128 .LBB2855-.Ltext0
+	.uleb128 .LBE2855-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB2862-.Ltext0
+	.uleb128 .LBE2862-.Ltext0
+	.byte	0
+.LLRL275:
+	.byte	0x4
+	.uleb128 .LBB2858-.Ltext0
+	.uleb128 .LBE2858-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB2902-.Ltext0
+	.uleb128 .LBE2902-.Ltext0
+	.byte	0
+.LLRL280:
+	.byte	0x4
+	.uleb128 .LBB2865-.Ltext0
+	.uleb128 .LBE2865-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB2875-.Ltext0
+	.uleb128 .LBE2875-.Ltext0
+	.byte	0
+.LLRL283:
+	.byte	0x4
+	.uleb128 .LBB2868-.Ltext0
+	.uleb128 .LBE2868-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB2879-.Ltext0
+	.uleb128 .LBE2879-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB2883-.Ltext0
+	.uleb128 .LBE2883-.Ltext0
+	.byte	0
+.LLRL286:
+	.byte	0x4
+	.uleb128 .LBB2872-.Ltext0
+	.uleb128 .LBE2872-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB2900-.Ltext0
+	.uleb128 .LBE2900-.Ltext0
+	.byte	0
+.LLRL288:
+	.byte	0x4
+	.uleb128 .LBB2876-.Ltext0
+	.uleb128 .LBE2876-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB2899-.Ltext0
+	.uleb128 .LBE2899-.Ltext0
+	.byte	0
+.LLRL290:
+	.byte	0x4
+	.uleb128 .LBB2880-.Ltext0
+	.uleb128 .LBE2880-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB2884-.Ltext0
+	.uleb128 .LBE2884-.Ltext0
+	.byte	0
+.LLRL292:
+	.byte	0x4
+	.uleb128 .LBB2885-.Ltext0
+	.uleb128 .LBE2885-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB2891-.Ltext0
+	.uleb128 .LBE2891-.Ltext0
+	.byte	0
+.LLRL295:
+	.byte	0x4
+	.uleb128 .LBB2888-.Ltext0
+	.uleb128 .LBE2888-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB2898-.Ltext0
+	.uleb128 .LBE2898-.Ltext0
+	.byte	0
+.LLRL298:
+	.byte	0x4
+	.uleb128 .LBB2892-.Ltext0
+	.uleb128 .LBE2892-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB2901-.Ltext0
+	.uleb128 .LBE2901-.Ltext0
+	.byte	0
+.LLRL301:
+	.byte	0x4
+	.uleb128 .LBB2895-.Ltext0
+	.uleb128 .LBE2895-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB2903-.Ltext0
+	.uleb128 .LBE2903-.Ltext0
+	.byte	0
+.LLRL305:
+	.byte	0x4
+	.uleb128 .LBB2904-.Ltext0
+	.uleb128 .LBE2904-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB2910-.Ltext0
+	.uleb128 .LBE2910-.Ltext0
+	.byte	0
+.LLRL309:
+	.byte	0x4
+	.uleb128 .LBB2907-.Ltext0
+	.uleb128 .LBE2907-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB2957-.Ltext0
+	.uleb128 .LBE2957-.Ltext0
+	.byte	0
+.LLRL312:
+	.byte	0x4
+	.uleb128 .LBB2912-.Ltext0
+	.uleb128 .LBE2912-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB2922-.Ltext0
+	.uleb128 .LBE2922-.Ltext0
+	.byte	0
+.LLRL316:
+	.byte	0x4
+	.uleb128 .LBB2915-.Ltext0
+	.uleb128 .LBE2915-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB2927-.Ltext0
+	.uleb128 .LBE2927-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB2980-.Ltext0
+	.uleb128 .LBE2980-.Ltext0
+	.byte	0
+.LLRL317:
+	.byte	0x4
+	.uleb128 .LBB2919-.Ltext0
+	.uleb128 .LBE2919-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB2923-.Ltext0
+	.uleb128 .LBE2923-.Ltext0
+	.byte	0
+.LLRL320:
+	.byte	0x4
+	.uleb128 .LBB2924-.Ltext0
+	.uleb128 .LBE2924-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB2931-.Ltext0
+	.uleb128 .LBE2931-.Ltext0
+	.byte	0
+.LLRL324:
+	.byte	0x4
+	.uleb128 .LBB2928-.Ltext0
+	.uleb128 .LBE2928-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB2932-.Ltext0
+	.uleb128 .LBE2932-.Ltext0
+	.byte	0
+.LLRL329:
+	.byte	0x4
+	.uleb128 .LBB2935-.Ltext0
+	.uleb128 .LBE2935-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB2945-.Ltext0
+	.uleb128 .LBE2945-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB2949-.Ltext0
+	.uleb128 .LBE2949-.Ltext0
+	.byte	0
+.LLRL333:
+	.byte	0x4
+	.uleb128 .LBB2939-.Ltext0
+	.uleb128 .LBE2939-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB2981-.Ltext0
+	.uleb128 .LBE2981-.Ltext0
+	.byte	0
+.LLRL335:
+	.byte	0x4
+	.uleb128 .LBB2942-.Ltext0
+	.uleb128 .LBE2942-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB2982-.Ltext0
+	.uleb128 .LBE2982-.Ltext0
+	.byte	0
+.LLRL336:
+	.byte	0x4
+	.uleb128 .LBB2946-.Ltext0
+	.uleb128 .LBE2946-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB2958-.Ltext0
+	.uleb128 .LBE2958-.Ltext0
+	.byte	0
+.LLRL339:
+	.byte	0x4
+	.uleb128 .LBB2950-.Ltext0
+	.uleb128 .LBE2950-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB2956-.Ltext0
+	.uleb128 .LBE2956-.Ltext0
+	.byte	0
+.LLRL343:
+	.byte	0x4
+	.uleb128 .LBB2953-.Ltext0
+	.uleb128 .LBE2953-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB2983-.Ltext0
+	.uleb128 .LBE2983-.Ltext0
+	.byte	0
+.LLRL345:
+	.byte	0x4
+	.uleb128 .LBB2959-.Ltext0
+	.uleb128 .LBE2959-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB2965-.Ltext0
+	.uleb128 .LBE2965-.Ltext0
+	.byte	0
+.LLRL349:
+	.byte	0x4
+	.uleb128 .LBB2962-.Ltext0
+	.uleb128 .LBE2962-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB2984-.Ltext0
+	.uleb128 .LBE2984-.Ltext0
+	.byte	0
+.LLRL353:
+	.byte	0x4
+	.uleb128 .LBB2968-.Ltext0
+	.uleb128 .LBE2968-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB2977-.Ltext0
+	.uleb128 .LBE2977-.Ltext0
+	.byte	0
+.LLRL357:
+	.byte	0x4
+	.uleb128 .LBB2971-.Ltext0
+	.uleb128 .LBE2971-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB2985-.Ltext0
+	.uleb128 .LBE2985-.Ltext0
+	.byte	0
+.LLRL359:
+	.byte	0x4
+	.uleb128 .LBB2974-.Ltext0
+	.uleb128 .LBE2974-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB2986-.Ltext0
+	.uleb128 .LBE2986-.Ltext0
+	.byte	0
+.LLRL367:
+	.byte	0x4
+	.uleb128 .LBB2993-.Ltext0
+	.uleb128 .LBE2993-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB2999-.Ltext0
+	.uleb128 .LBE2999-.Ltext0
+	.byte	0
+.LLRL370:
+	.byte	0x4
+	.uleb128 .LBB2996-.Ltext0
+	.uleb128 .LBE2996-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB3000-.Ltext0
+	.uleb128 .LBE3000-.Ltext0
+	.byte	0
+.LLRL374:
+	.byte	0x4
+	.uleb128 .LBB3003-.Ltext0
+	.uleb128 .LBE3003-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB3013-.Ltext0
+	.uleb128 .LBE3013-.Ltext0
+	.byte	0
+.LLRL377:
+	.byte	0x4
+	.uleb128 .LBB3006-.Ltext0
+	.uleb128 .LBE3006-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB3017-.Ltext0
+	.uleb128 .LBE3017-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB3021-.Ltext0
+	.uleb128 .LBE3021-.Ltext0
+	.byte	0
+.LLRL380:
+	.byte	0x4
+	.uleb128 .LBB3010-.Ltext0
+	.uleb128 .LBE3010-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB3035-.Ltext0
+	.uleb128 .LBE3035-.Ltext0
+	.byte	0
+.LLRL382:
+	.byte	0x4
+	.uleb128 .LBB3014-.Ltext0
+	.uleb128 .LBE3014-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB3034-.Ltext0
+	.uleb128 .LBE3034-.Ltext0
+	.byte	0
+.LLRL384:
+	.byte	0x4
+	.uleb128 .LBB3018-.Ltext0
+	.uleb128 .LBE3018-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB3022-.Ltext0
+	.uleb128 .LBE3022-.Ltext0
+	.byte	0
+.LLRL386:
+	.byte	0x4
+	.uleb128 .LBB3023-.Ltext0
+	.uleb128 .LBE3023-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB3029-.Ltext0
+	.uleb128 .LBE3029-.Ltext0
+	.byte	0
+.LLRL389:
+	.byte	0x4
+	.uleb128 .LBB3026-.Ltext0
+	.uleb128 .LBE3026-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB3033-.Ltext0
+	.uleb128 .LBE3033-.Ltext0
+	.byte	0
+.LLRL392:
+	.byte	0x4
+	.uleb128 .LBB3030-.Ltext0
+	.uleb128 .LBE3030-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB3113-.Ltext0
+	.uleb128 .LBE3113-.Ltext0
+	.byte	0
+.LLRL398:
+	.byte	0x4
+	.uleb128 .LBB3040-.Ltext0
+	.uleb128 .LBE3040-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB3046-.Ltext0
+	.uleb128 .LBE3046-.Ltext0
+	.byte	0
+.LLRL401:
+	.byte	0x4
+	.uleb128 .LBB3043-.Ltext0
+	.uleb128 .LBE3043-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB3047-.Ltext0
+	.uleb128 .LBE3047-.Ltext0
+	.byte	0
+.LLRL405:
+	.byte	0x4
+	.uleb128 .LBB3050-.Ltext0
+	.uleb128 .LBE3050-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB3057-.Ltext0
+	.uleb128 .LBE3057-.Ltext0
+	.byte	0
+.LLRL408:
+	.byte	0x4
+	.uleb128 .LBB3053-.Ltext0
+	.uleb128 .LBE3053-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB3058-.Ltext0
+	.uleb128 .LBE3058-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB3062-.Ltext0
+	.uleb128 .LBE3062-.Ltext0
+	.byte	0
+.LLRL411:
+	.byte	0x4
+	.uleb128 .LBB3059-.Ltext0
+	.uleb128 .LBE3059-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB3063-.Ltext0
+	.uleb128 .LBE3063-.Ltext0
+	.byte	0
+.LLRL418:
+	.byte	0x4
+	.uleb128 .LBB3070-.Ltext0
+	.uleb128 .LBE3070-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB3076-.Ltext0
+	.uleb128 .LBE3076-.Ltext0
+	.byte	0
+.LLRL421:
+	.byte	0x4
+	.uleb128 .LBB3073-.Ltext0
+	.uleb128 .LBE3073-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB3077-.Ltext0
+	.uleb128 .LBE3077-.Ltext0
+	.byte	0
+.LLRL425:
+	.byte	0x4
+	.uleb128 .LBB3080-.Ltext0
+	.uleb128 .LBE3080-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB3090-.Ltext0
+	.uleb128 .LBE3090-.Ltext0
+	.byte	0
+.LLRL428:
+	.byte	0x4
+	.uleb128 .LBB3083-.Ltext0
+	.uleb128 .LBE3083-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB3094-.Ltext0
+	.uleb128 .LBE3094-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB3098-.Ltext0
+	.uleb128 .LBE3098-.Ltext0
+	.byte	0
+.LLRL431:
+	.byte	0x4
+	.uleb128 .LBB3087-.Ltext0
+	.uleb128 .LBE3087-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB3112-.Ltext0
+	.uleb128 .LBE3112-.Ltext0
+	.byte	0
+.LLRL433:
+	.byte	0x4
+	.uleb128 .LBB3091-.Ltext0
+	.uleb128 .LBE3091-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB3111-.Ltext0
+	.uleb128 .LBE3111-.Ltext0
+	.byte	0
+.LLRL435:
+	.byte	0x4
+	.uleb128 .LBB3095-.Ltext0
+	.uleb128 .LBE3095-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB3099-.Ltext0
+	.uleb128 .LBE3099-.Ltext0
+	.byte	0
+.LLRL437:
+	.byte	0x4
+	.uleb128 .LBB3100-.Ltext0
+	.uleb128 .LBE3100-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB3106-.Ltext0
+	.uleb128 .LBE3106-.Ltext0
+	.byte	0
+.LLRL440:
+	.byte	0x4
+	.uleb128 .LBB3103-.Ltext0
+	.uleb128 .LBE3103-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB3110-.Ltext0
+	.uleb128 .LBE3110-.Ltext0
+	.byte	0
+.LLRL443:
+	.byte	0x4
+	.uleb128 .LBB3107-.Ltext0
+	.uleb128 .LBE3107-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB3114-.Ltext0
+	.uleb128 .LBE3114-.Ltext0
+	.byte	0
+.LLRL449:
+	.byte	0x4
+	.uleb128 .LBB3117-.Ltext0
+	.uleb128 .LBE3117-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB3123-.Ltext0
+	.uleb128 .LBE3123-.Ltext0
+	.byte	0
+.LLRL453:
+	.byte	0x4
+	.uleb128 .LBB3120-.Ltext0
+	.uleb128 .LBE3120-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB3124-.Ltext0
+	.uleb128 .LBE3124-.Ltext0
+	.byte	0
+.LLRL462:
+	.byte	0x4
+	.uleb128 .LBB3129-.Ltext0
+	.uleb128 .LBE3129-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB3138-.Ltext0
+	.uleb128 .LBE3138-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB3140-.Ltext0
+	.uleb128 .LBE3140-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB3144-.Ltext0
+	.uleb128 .LBE3144-.Ltext0
+	.byte	0
+.LLRL466:
+	.byte	0x4
+	.uleb128 .LBB3134-.Ltext0
+	.uleb128 .LBE3134-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB3139-.Ltext0
+	.uleb128 .LBE3139-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB3194-.Ltext0
+	.uleb128 .LBE3194-.Ltext0
+	.byte	0
+.LLRL467:
+	.byte	0x4
+	.uleb128 .LBB3141-.Ltext0
+	.uleb128 .LBE3141-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB3339-.Ltext0
+	.uleb128 .LBE3339-.Ltext0
+	.byte	0
+.LLRL470:
+	.byte	0x4
+	.uleb128 .LBB3145-.Ltext0
+	.uleb128 .LBE3145-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB3168-.Ltext0
+	.uleb128 .LBE3168-.Ltext0
+	.byte	0
+.LLRL474:
+	.byte	0x4
+	.uleb128 .LBB3148-.Ltext0
+	.uleb128 .LBE3148-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB3195-.Ltext0
+	.uleb128 .LBE3195-.Ltext0
+	.byte	0
+.LLRL476:
+	.byte	0x4
+	.uleb128 .LBB3151-.Ltext0
+	.uleb128 .LBE3151-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB3187-.Ltext0
+	.uleb128 .LBE3187-.Ltext0
+	.byte	0
+.LLRL479:
+	.byte	0x4
+	.uleb128 .LBB3154-.Ltext0
+	.uleb128 .LBE3154-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB3188-.Ltext0
+	.uleb128 .LBE3188-.Ltext0
+	.byte	0
+.LLRL482:
+	.byte	0x4
+	.uleb128 .LBB3157-.Ltext0
+	.uleb128 .LBE3157-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB3196-.Ltext0
+	.uleb128 .LBE3196-.Ltext0
+	.byte	0
+.LLRL483:
+	.byte	0x4
+	.uleb128 .LBB3160-.Ltext0
+	.uleb128 .LBE3160-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB3197-.Ltext0
+	.uleb128 .LBE3197-.Ltext0
+	.byte	0
+.LLRL485:
+	.byte	0x4
+	.uleb128 .LBB3163-.Ltext0
+	.uleb128 .LBE3163-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB3172-.Ltext0
+	.uleb128 .LBE3172-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB3176-.Ltext0
+	.uleb128 .LBE3176-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB3189-.Ltext0
+	.uleb128 .LBE3189-.Ltext0
+	.byte	0
+.LLRL488:
+	.byte	0x4
+	.uleb128 .LBB3169-.Ltext0
+	.uleb128 .LBE3169-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB3186-.Ltext0
+	.uleb128 .LBE3186-.Ltext0
+	.byte	0
+.LLRL491:
+	.byte	0x4
+	.uleb128 .LBB3173-.Ltext0
+	.uleb128 .LBE3173-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB3198-.Ltext0
+	.uleb128 .LBE3198-.Ltext0
+	.byte	0
+.LLRL493:
+	.byte	0x4
+	.uleb128 .LBB3177-.Ltext0
+	.uleb128 .LBE3177-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB3190-.Ltext0
+	.uleb128 .LBE3190-.Ltext0
+	.byte	0
+.LLRL496:
+	.byte	0x4
+	.uleb128 .LBB3180-.Ltext0
+	.uleb128 .LBE3180-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB3191-.Ltext0
+	.uleb128 .LBE3191-.Ltext0
+	.byte	0
+.LLRL498:
+	.byte	0x4
+	.uleb128 .LBB3183-.Ltext0
+	.uleb128 .LBE3183-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB3199-.Ltext0
+	.uleb128 .LBE3199-.Ltext0
+	.byte	0
+.LLRL501:
+	.byte	0x4
+	.uleb128 .LBB3202-.Ltext0
+	.uleb128 .LBE3202-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB3208-.Ltext0
+	.uleb128 .LBE3208-.Ltext0
+	.byte	0
+.LLRL504:
+	.byte	0x4
+	.uleb128 .LBB3205-.Ltext0
+	.uleb128 .LBE3205-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB3340-.Ltext0
+	.uleb128 .LBE3340-.Ltext0
+	.byte	0
+.LLRL509:
+	.byte	0x4
+	.uleb128 .LBB3211-.Ltext0
+	.uleb128 .LBE3211-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB3217-.Ltext0
+	.uleb128 .LBE3217-.Ltext0
+	.byte	0
+.LLRL511:
+	.byte	0x4
+	.uleb128 .LBB3214-.Ltext0
+	.uleb128 .LBE3214-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB3341-.Ltext0
+	.uleb128 .LBE3341-.Ltext0
+	.byte	0
+.LLRL514:
+	.byte	0x4
+	.uleb128 .LBB3218-.Ltext0
+	.uleb128 .LBE3218-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB3224-.Ltext0
+	.uleb128 .LBE3224-.Ltext0
+	.byte	0
+.LLRL517:
+	.byte	0x4
+	.uleb128 .LBB3221-.Ltext0
+	.uleb128 .LBE3221-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB3225-.Ltext0
+	.uleb128 .LBE3225-.Ltext0
+	.byte	0
+.LLRL521:
+	.byte	0x4
+	.uleb128 .LBB3228-.Ltext0
+	.uleb128 .LBE3228-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB3238-.Ltext0
+	.uleb128 .LBE3238-.Ltext0
+	.byte	0
+.LLRL524:
+	.byte	0x4
+	.uleb128 .LBB3231-.Ltext0
+	.uleb128 .LBE3231-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB3242-.Ltext0
+	.uleb128 .LBE3242-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB3246-.Ltext0
+	.uleb128 .LBE3246-.Ltext0
+	.byte	0
+.LLRL527:
+	.byte	0x4
+	.uleb128 .LBB3235-.Ltext0
+	.uleb128 .LBE3235-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB3257-.Ltext0
+	.uleb128 .LBE3257-.Ltext0
+	.byte	0
+.LLRL529:
+	.byte	0x4
+	.uleb128 .LBB3239-.Ltext0
+	.uleb128 .LBE3239-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB3256-.Ltext0
+	.uleb128 .LBE3256-.Ltext0
+	.byte	0
+.LLRL531:
+	.byte	0x4
+	.uleb128 .LBB3243-.Ltext0
+	.uleb128 .LBE3243-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB3247-.Ltext0
+	.uleb128 .LBE3247-.Ltext0
+	.byte	0
+.LLRL533:
+	.byte	0x4
+	.uleb128 .LBB3248-.Ltext0
+	.uleb128 .LBE3248-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB3254-.Ltext0
+	.uleb128 .LBE3254-.Ltext0
+	.byte	0
+.LLRL536:
+	.byte	0x4
+	.uleb128 .LBB3251-.Ltext0
+	.uleb128 .LBE3251-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB3255-.Ltext0
+	.uleb128 .LBE3255-.Ltext0
+	.byte	0
+.LLRL542:
+	.byte	0x4
+	.uleb128 .LBB3262-.Ltext0
+	.uleb128 .LBE3262-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB3268-.Ltext0
+	.uleb128 .LBE3268-.Ltext0
+	.byte	0
+.LLRL545:
+	.byte	0x4
+	.uleb128 .LBB3265-.Ltext0
+	.uleb128 .LBE3265-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB3269-.Ltext0
+	.uleb128 .LBE3269-.Ltext0
+	.byte	0
+.LLRL549:
+	.byte	0x4
+	.uleb128 .LBB3272-.Ltext0
+	.uleb128 .LBE3272-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB3279-.Ltext0
+	.uleb128 .LBE3279-.Ltext0
+	.byte	0
+.LLRL552:
+	.byte	0x4
+	.uleb128 .LBB3275-.Ltext0
+	.uleb128 .LBE3275-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB3280-.Ltext0
+	.uleb128 .LBE3280-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB3284-.Ltext0
+	.uleb128 .LBE3284-.Ltext0
+	.byte	0
+.LLRL555:
+	.byte	0x4
+	.uleb128 .LBB3281-.Ltext0
+	.uleb128 .LBE3281-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB3285-.Ltext0
+	.uleb128 .LBE3285-.Ltext0
+	.byte	0
+.LLRL562:
+	.byte	0x4
+	.uleb128 .LBB3292-.Ltext0
+	.uleb128 .LBE3292-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB3301-.Ltext0
+	.uleb128 .LBE3301-.Ltext0
+	.byte	0
+.LLRL565:
+	.byte	0x4
+	.uleb128 .LBB3295-.Ltext0
+	.uleb128 .LBE3295-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB3302-.Ltext0
+	.uleb128 .LBE3302-.Ltext0
+	.byte	0
+.LLRL567:
+	.byte	0x4
+	.uleb128 .LBB3298-.Ltext0
+	.uleb128 .LBE3298-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB3342-.Ltext0
+	.uleb128 .LBE3342-.Ltext0
+	.byte	0
+.LLRL572:
+	.byte	0x4
+	.uleb128 .LBB3305-.Ltext0
+	.uleb128 .LBE3305-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB3315-.Ltext0
+	.uleb128 .LBE3315-.Ltext0
+	.byte	0
+.LLRL575:
+	.byte	0x4
+	.uleb128 .LBB3308-.Ltext0
+	.uleb128 .LBE3308-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB3319-.Ltext0
+	.uleb128 .LBE3319-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB3323-.Ltext0
+	.uleb128 .LBE3323-.Ltext0
+	.byte	0
+.LLRL578:
+	.byte	0x4
+	.uleb128 .LBB3312-.Ltext0
+	.uleb128 .LBE3312-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB3338-.Ltext0
+	.uleb128 .LBE3338-.Ltext0
+	.byte	0
+.LLRL580:
+	.byte	0x4
+	.uleb128 .LBB3316-.Ltext0
+	.uleb128 .LBE3316-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB3337-.Ltext0
+	.uleb128 .LBE3337-.Ltext0
+	.byte	0
+.LLRL582:
+	.byte	0x4
+	.uleb128 .LBB3320-.Ltext0
+	.uleb128 .LBE3320-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB3324-.Ltext0
+	.uleb128 .LBE3324-.Ltext0
+	.byte	0
+.LLRL584:
+	.byte	0x4
+	.uleb128 .LBB3325-.Ltext0
+	.uleb128 .LBE3325-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB3331-.Ltext0
+	.uleb128 .LBE3331-.Ltext0
+	.byte	0
+.LLRL587:
+	.byte	0x4
+	.uleb128 .LBB3328-.Ltext0
+	.uleb128 .LBE3328-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB3336-.Ltext0
+	.uleb128 .LBE3336-.Ltext0
+	.byte	0
+.LLRL590:
+	.byte	0x4
+	.uleb128 .LBB3332-.Ltext0
+	.uleb128 .LBE3332-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB3343-.Ltext0
+	.uleb128 .LBE3343-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB3351-.Ltext0
+	.uleb128 .LBE3351-.Ltext0
+	.byte	0
+.LLRL594:
+	.byte	0x4
+	.uleb128 .LBB3344-.Ltext0
+	.uleb128 .LBE3344-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB3360-.Ltext0
+	.uleb128 .LBE3360-.Ltext0
+	.byte	0
+.LLRL597:
+	.byte	0x4
+	.uleb128 .LBB3347-.Ltext0
+	.uleb128 .LBE3347-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB3358-.Ltext0
+	.uleb128 .LBE3358-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB3411-.Ltext0
+	.uleb128 .LBE3411-.Ltext0
+	.byte	0
+.LLRL598:
+	.byte	0x4
+	.uleb128 .LBB3352-.Ltext0
+	.uleb128 .LBE3352-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB3359-.Ltext0
+	.uleb128 .LBE3359-.Ltext0
+	.byte	0
+.LLRL602:
+	.byte	0x4
+	.uleb128 .LBB3355-.Ltext0
+	.uleb128 .LBE3355-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB3361-.Ltext0
+	.uleb128 .LBE3361-.Ltext0
+	.byte	0
+.LLRL605:
+	.byte	0x4
+	.uleb128 .LBB3362-.Ltext0
+	.uleb128 .LBE3362-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB3371-.Ltext0
+	.uleb128 .LBE3371-.Ltext0
+	.byte	0
+.LLRL609:
+	.byte	0x4
+	.uleb128 .LBB3365-.Ltext0
+	.uleb128 .LBE3365-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB3593-.Ltext0
+	.uleb128 .LBE3593-.Ltext0
+	.byte	0
+.LLRL612:
+	.byte	0x4
+	.uleb128 .LBB3368-.Ltext0
+	.uleb128 .LBE3368-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB3412-.Ltext0
+	.uleb128 .LBE3412-.Ltext0
+	.byte	0
+.LLRL614:
+	.byte	0x4
+	.uleb128 .LBB3372-.Ltext0
+	.uleb128 .LBE3372-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB3382-.Ltext0
+	.uleb128 .LBE3382-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB3386-.Ltext0
+	.uleb128 .LBE3386-.Ltext0
+	.byte	0
+.LLRL618:
+	.byte	0x4
+	.uleb128 .LBB3376-.Ltext0
+	.uleb128 .LBE3376-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB3389-.Ltext0
+	.uleb128 .LBE3389-.Ltext0
+	.byte	0
+.LLRL621:
+	.byte	0x4
+	.uleb128 .LBB3379-.Ltext0
+	.uleb128 .LBE3379-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB3413-.Ltext0
+	.uleb128 .LBE3413-.Ltext0
+	.byte	0
+.LLRL622:
+	.byte	0x4
+	.uleb128 .LBB3383-.Ltext0
+	.uleb128 .LBE3383-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB3414-.Ltext0
+	.uleb128 .LBE3414-.Ltext0
+	.byte	0
+.LLRL626:
+	.byte	0x4
+	.uleb128 .LBB3390-.Ltext0
+	.uleb128 .LBE3390-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB3396-.Ltext0
+	.uleb128 .LBE3396-.Ltext0
+	.byte	0
+.LLRL630:
+	.byte	0x4
+	.uleb128 .LBB3393-.Ltext0
+	.uleb128 .LBE3393-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB3415-.Ltext0
+	.uleb128 .LBE3415-.Ltext0
+	.byte	0
+.LLRL634:
+	.byte	0x4
+	.uleb128 .LBB3399-.Ltext0
+	.uleb128 .LBE3399-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB3408-.Ltext0
+	.uleb128 .LBE3408-.Ltext0
+	.byte	0
+.LLRL638:
+	.byte	0x4
+	.uleb128 .LBB3402-.Ltext0
+	.uleb128 .LBE3402-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB3416-.Ltext0
+	.uleb128 .LBE3416-.Ltext0
+	.byte	0
+.LLRL640:
+	.byte	0x4
+	.uleb128 .LBB3405-.Ltext0
+	.uleb128 .LBE3405-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB3417-.Ltext0
+	.uleb128 .LBE3417-.Ltext0
+	.byte	0
+.LLRL642:
+	.byte	0x4
+	.uleb128 .LBB3418-.Ltext0
+	.uleb128 .LBE3418-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB3424-.Ltext0
+	.uleb128 .LBE3424-.Ltext0
+	.byte	0
+.LLRL645:
+	.byte	0x4
+	.uleb128 .LBB3421-.Ltext0
+	.uleb128 .LBE3421-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB3584-.Ltext0
+	.uleb128 .LBE3584-.Ltext0
+	.byte	0
+.LLRL651:
+	.byte	0x4
+	.uleb128 .LBB3429-.Ltext0
+	.uleb128 .LBE3429-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB3435-.Ltext0
+	.uleb128 .LBE3435-.Ltext0
+	.byte	0
+.LLRL654:
+	.byte	0x4
+	.uleb128 .LBB3432-.Ltext0
+	.uleb128 .LBE3432-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB3436-.Ltext0
+	.uleb128 .LBE3436-.Ltext0
+	.byte	0
+.LLRL656:
+	.byte	0x4
+	.uleb128 .LBB3437-.Ltext0
+	.uleb128 .LBE3437-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB3443-.Ltext0
+	.uleb128 .LBE3443-.Ltext0
+	.byte	0
+.LLRL659:
+	.byte	0x4
+	.uleb128 .LBB3440-.Ltext0
+	.uleb128 .LBE3440-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB3812-.Ltext0
+	.uleb128 .LBE3812-.Ltext0
+	.byte	0
+.LLRL661:
+	.byte	0x4
+	.uleb128 .LBB3444-.Ltext0
+	.uleb128 .LBE3444-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB3457-.Ltext0
+	.uleb128 .LBE3457-.Ltext0
+	.byte	0
+.LLRL664:
+	.byte	0x4
+	.uleb128 .LBB3447-.Ltext0
+	.uleb128 .LBE3447-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB3461-.Ltext0
+	.uleb128 .LBE3461-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB3465-.Ltext0
+	.uleb128 .LBE3465-.Ltext0
+	.byte	0
+.LLRL667:
+	.byte	0x4
+	.uleb128 .LBB3451-.Ltext0
+	.uleb128 .LBE3451-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB3476-.Ltext0
+	.uleb128 .LBE3476-.Ltext0
+	.byte	0
+.LLRL669:
+	.byte	0x4
+	.uleb128 .LBB3454-.Ltext0
+	.uleb128 .LBE3454-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB3813-.Ltext0
+	.uleb128 .LBE3813-.Ltext0
+	.byte	0
+.LLRL672:
+	.byte	0x4
+	.uleb128 .LBB3458-.Ltext0
+	.uleb128 .LBE3458-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB3475-.Ltext0
+	.uleb128 .LBE3475-.Ltext0
+	.byte	0
+.LLRL674:
+	.byte	0x4
+	.uleb128 .LBB3462-.Ltext0
+	.uleb128 .LBE3462-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB3466-.Ltext0
+	.uleb128 .LBE3466-.Ltext0
+	.byte	0
+.LLRL676:
+	.byte	0x4
+	.uleb128 .LBB3467-.Ltext0
+	.uleb128 .LBE3467-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB3473-.Ltext0
+	.uleb128 .LBE3473-.Ltext0
+	.byte	0
+.LLRL679:
+	.byte	0x4
+	.uleb128 .LBB3470-.Ltext0
+	.uleb128 .LBE3470-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB3474-.Ltext0
+	.uleb128 .LBE3474-.Ltext0
+	.byte	0
+.LLRL685:
+	.byte	0x4
+	.uleb128 .LBB3481-.Ltext0
+	.uleb128 .LBE3481-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB3490-.Ltext0
+	.uleb128 .LBE3490-.Ltext0
+	.byte	0
+.LLRL688:
+	.byte	0x4
+	.uleb128 .LBB3484-.Ltext0
+	.uleb128 .LBE3484-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB3491-.Ltext0
+	.uleb128 .LBE3491-.Ltext0
+	.byte	0
+.LLRL690:
+	.byte	0x4
+	.uleb128 .LBB3487-.Ltext0
+	.uleb128 .LBE3487-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB3616-.Ltext0
+	.uleb128 .LBE3616-.Ltext0
+	.byte	0
+.LLRL695:
+	.byte	0x4
+	.uleb128 .LBB3494-.Ltext0
+	.uleb128 .LBE3494-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB3501-.Ltext0
+	.uleb128 .LBE3501-.Ltext0
+	.byte	0
+.LLRL698:
+	.byte	0x4
+	.uleb128 .LBB3497-.Ltext0
+	.uleb128 .LBE3497-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB3502-.Ltext0
+	.uleb128 .LBE3502-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB3506-.Ltext0
+	.uleb128 .LBE3506-.Ltext0
+	.byte	0
+.LLRL701:
+	.byte	0x4
+	.uleb128 .LBB3503-.Ltext0
+	.uleb128 .LBE3503-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB3507-.Ltext0
+	.uleb128 .LBE3507-.Ltext0
+	.byte	0
+.LLRL707:
+	.byte	0x4
+	.uleb128 .LBB3512-.Ltext0
+	.uleb128 .LBE3512-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB3519-.Ltext0
+	.uleb128 .LBE3519-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB3528-.Ltext0
+	.uleb128 .LBE3528-.Ltext0
+	.byte	0
+.LLRL709:
+	.byte	0x4
+	.uleb128 .LBB3516-.Ltext0
+	.uleb128 .LBE3516-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB3585-.Ltext0
+	.uleb128 .LBE3585-.Ltext0
+	.byte	0
+.LLRL712:
+	.byte	0x4
+	.uleb128 .LBB3520-.Ltext0
+	.uleb128 .LBE3520-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB3536-.Ltext0
+	.uleb128 .LBE3536-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB3586-.Ltext0
+	.uleb128 .LBE3586-.Ltext0
+	.byte	0
+.LLRL714:
+	.byte	0x4
+	.uleb128 .LBB3524-.Ltext0
+	.uleb128 .LBE3524-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB3535-.Ltext0
+	.uleb128 .LBE3535-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB3594-.Ltext0
+	.uleb128 .LBE3594-.Ltext0
+	.byte	0
+.LLRL717:
+	.byte	0x4
+	.uleb128 .LBB3529-.Ltext0
+	.uleb128 .LBE3529-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB3537-.Ltext0
+	.uleb128 .LBE3537-.Ltext0
+	.byte	0
+.LLRL720:
+	.byte	0x4
+	.uleb128 .LBB3532-.Ltext0
+	.uleb128 .LBE3532-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB3544-.Ltext0
+	.uleb128 .LBE3544-.Ltext0
+	.byte	0
+.LLRL722:
+	.byte	0x4
+	.uleb128 .LBB3538-.Ltext0
+	.uleb128 .LBE3538-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB3595-.Ltext0
+	.uleb128 .LBE3595-.Ltext0
+	.byte	0
+.LLRL725:
+	.byte	0x4
+	.uleb128 .LBB3541-.Ltext0
+	.uleb128 .LBE3541-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB3599-.Ltext0
+	.uleb128 .LBE3599-.Ltext0
+	.byte	0
+.LLRL730:
+	.byte	0x4
+	.uleb128 .LBB3547-.Ltext0
+	.uleb128 .LBE3547-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB3557-.Ltext0
+	.uleb128 .LBE3557-.Ltext0
+	.byte	0
+.LLRL733:
+	.byte	0x4
+	.uleb128 .LBB3550-.Ltext0
+	.uleb128 .LBE3550-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB3561-.Ltext0
+	.uleb128 .LBE3561-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB3565-.Ltext0
+	.uleb128 .LBE3565-.Ltext0
+	.byte	0
+.LLRL736:
+	.byte	0x4
+	.uleb128 .LBB3554-.Ltext0
+	.uleb128 .LBE3554-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB3583-.Ltext0
+	.uleb128 .LBE3583-.Ltext0
+	.byte	0
+.LLRL738:
+	.byte	0x4
+	.uleb128 .LBB3558-.Ltext0
+	.uleb128 .LBE3558-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB3582-.Ltext0
+	.uleb128 .LBE3582-.Ltext0
+	.byte	0
+.LLRL740:
+	.byte	0x4
+	.uleb128 .LBB3562-.Ltext0
+	.uleb128 .LBE3562-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB3566-.Ltext0
+	.uleb128 .LBE3566-.Ltext0
+	.byte	0
+.LLRL742:
+	.byte	0x4
+	.uleb128 .LBB3567-.Ltext0
+	.uleb128 .LBE3567-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB3573-.Ltext0
+	.uleb128 .LBE3573-.Ltext0
+	.byte	0
+.LLRL745:
+	.byte	0x4
+	.uleb128 .LBB3570-.Ltext0
+	.uleb128 .LBE3570-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB3581-.Ltext0
+	.uleb128 .LBE3581-.Ltext0
+	.byte	0
+.LLRL748:
+	.byte	0x4
+	.uleb128 .LBB3574-.Ltext0
+	.uleb128 .LBE3574-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB3587-.Ltext0
+	.uleb128 .LBE3587-.Ltext0
+	.byte	0
+.LLRL751:
+	.byte	0x4
+	.uleb128 .LBB3577-.Ltext0
+	.uleb128 .LBE3577-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB3588-.Ltext0
+	.uleb128 .LBE3588-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB3592-.Ltext0
+	.uleb128 .LBE3592-.Ltext0
+	.byte	0
+.LLRL755:
+	.byte	0x4
+	.uleb128 .LBB3589-.Ltext0
+	.uleb128 .LBE3589-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB3596-.Ltext0
+	.uleb128 .LBE3596-.Ltext0
+	.byte	0
+.LLRL760:
+	.byte	0x4
+	.uleb128 .LBB3600-.Ltext0
+	.uleb128 .LBE3600-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB3606-.Ltext0
+	.uleb128 .LBE3606-.Ltext0
+	.byte	0
+.LLRL764:
+	.byte	0x4
+	.uleb128 .LBB3603-.Ltext0
+	.uleb128 .LBE3603-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB3626-.Ltext0
+	.uleb128 .LBE3626-.Ltext0
+	.byte	0
+.LLRL767:
+	.byte	0x4
+	.uleb128 .LBB3609-.Ltext0
+	.uleb128 .LBE3609-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB3615-.Ltext0
+	.uleb128 .LBE3615-.Ltext0
+	.byte	0
+.LLRL771:
+	.byte	0x4
+	.uleb128 .LBB3612-.Ltext0
+	.uleb128 .LBE3612-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB3627-.Ltext0
+	.uleb128 .LBE3627-.Ltext0
+	.byte	0
+.LLRL773:
+	.byte	0x4
+	.uleb128 .LBB3617-.Ltext0
+	.uleb128 .LBE3617-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB3623-.Ltext0
+	.uleb128 .LBE3623-.Ltext0
+	.byte	0
+.LLRL777:
+	.byte	0x4
+	.uleb128 .LBB3620-.Ltext0
+	.uleb128 .LBE3620-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB3628-.Ltext0
+	.uleb128 .LBE3628-.Ltext0
+	.byte	0
+.LLRL780:
+	.byte	0x4
+	.uleb128 .LBB3629-.Ltext0
+	.uleb128 .LBE3629-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB3635-.Ltext0
+	.uleb128 .LBE3635-.Ltext0
+	.byte	0
+.LLRL783:
+	.byte	0x4
+	.uleb128 .LBB3632-.Ltext0
+	.uleb128 .LBE3632-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB3808-.Ltext0
+	.uleb128 .LBE3808-.Ltext0
+	.byte	0
+.LLRL786:
+	.byte	0x4
+	.uleb128 .LBB3636-.Ltext0
+	.uleb128 .LBE3636-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB3643-.Ltext0
+	.uleb128 .LBE3643-.Ltext0
+	.byte	0
+.LLRL789:
+	.byte	0x4
+	.uleb128 .LBB3639-.Ltext0
+	.uleb128 .LBE3639-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB3644-.Ltext0
+	.uleb128 .LBE3644-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB3648-.Ltext0
+	.uleb128 .LBE3648-.Ltext0
+	.byte	0
+.LLRL792:
+	.byte	0x4
+	.uleb128 .LBB3645-.Ltext0
+	.uleb128 .LBE3645-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB3649-.Ltext0
+	.uleb128 .LBE3649-.Ltext0
+	.byte	0
+.LLRL799:
+	.byte	0x4
+	.uleb128 .LBB3656-.Ltext0
+	.uleb128 .LBE3656-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB3665-.Ltext0
+	.uleb128 .LBE3665-.Ltext0
+	.byte	0
+.LLRL802:
+	.byte	0x4
+	.uleb128 .LBB3659-.Ltext0
+	.uleb128 .LBE3659-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB3666-.Ltext0
+	.uleb128 .LBE3666-.Ltext0
+	.byte	0
+.LLRL804:
+	.byte	0x4
+	.uleb128 .LBB3662-.Ltext0
+	.uleb128 .LBE3662-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB3780-.Ltext0
+	.uleb128 .LBE3780-.Ltext0
+	.byte	0
+.LLRL809:
+	.byte	0x4
+	.uleb128 .LBB3669-.Ltext0
+	.uleb128 .LBE3669-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB3679-.Ltext0
+	.uleb128 .LBE3679-.Ltext0
+	.byte	0
+.LLRL812:
+	.byte	0x4
+	.uleb128 .LBB3672-.Ltext0
+	.uleb128 .LBE3672-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB3683-.Ltext0
+	.uleb128 .LBE3683-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB3687-.Ltext0
+	.uleb128 .LBE3687-.Ltext0
+	.byte	0
+.LLRL815:
+	.byte	0x4
+	.uleb128 .LBB3676-.Ltext0
+	.uleb128 .LBE3676-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB3698-.Ltext0
+	.uleb128 .LBE3698-.Ltext0
+	.byte	0
+.LLRL817:
+	.byte	0x4
+	.uleb128 .LBB3680-.Ltext0
+	.uleb128 .LBE3680-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB3697-.Ltext0
+	.uleb128 .LBE3697-.Ltext0
+	.byte	0
+.LLRL819:
+	.byte	0x4
+	.uleb128 .LBB3684-.Ltext0
+	.uleb128 .LBE3684-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB3688-.Ltext0
+	.uleb128 .LBE3688-.Ltext0
+	.byte	0
+.LLRL821:
+	.byte	0x4
+	.uleb128 .LBB3689-.Ltext0
+	.uleb128 .LBE3689-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB3695-.Ltext0
+	.uleb128 .LBE3695-.Ltext0
+	.byte	0
+.LLRL824:
+	.byte	0x4
+	.uleb128 .LBB3692-.Ltext0
+	.uleb128 .LBE3692-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB3696-.Ltext0
+	.uleb128 .LBE3696-.Ltext0
+	.byte	0
+.LLRL830:
+	.byte	0x4
+	.uleb128 .LBB3703-.Ltext0
+	.uleb128 .LBE3703-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB3709-.Ltext0
+	.uleb128 .LBE3709-.Ltext0
+	.byte	0
+.LLRL833:
+	.byte	0x4
+	.uleb128 .LBB3706-.Ltext0
+	.uleb128 .LBE3706-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB3710-.Ltext0
+	.uleb128 .LBE3710-.Ltext0
+	.byte	0
+.LLRL837:
+	.byte	0x4
+	.uleb128 .LBB3713-.Ltext0
+	.uleb128 .LBE3713-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB3720-.Ltext0
+	.uleb128 .LBE3720-.Ltext0
+	.byte	0
+.LLRL840:
+	.byte	0x4
+	.uleb128 .LBB3716-.Ltext0
+	.uleb128 .LBE3716-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB3721-.Ltext0
+	.uleb128 .LBE3721-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB3725-.Ltext0
+	.uleb128 .LBE3725-.Ltext0
+	.byte	0
+.LLRL843:
+	.byte	0x4
+	.uleb128 .LBB3722-.Ltext0
+	.uleb128 .LBE3722-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB3726-.Ltext0
+	.uleb128 .LBE3726-.Ltext0
+	.byte	0
+.LLRL850:
+	.byte	0x4
+	.uleb128 .LBB3733-.Ltext0
+	.uleb128 .LBE3733-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB3742-.Ltext0
+	.uleb128 .LBE3742-.Ltext0
+	.byte	0
+.LLRL853:
+	.byte	0x4
+	.uleb128 .LBB3736-.Ltext0
+	.uleb128 .LBE3736-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB3743-.Ltext0
+	.uleb128 .LBE3743-.Ltext0
+	.byte	0
+.LLRL855:
+	.byte	0x4
+	.uleb128 .LBB3739-.Ltext0
+	.uleb128 .LBE3739-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB3799-.Ltext0
+	.uleb128 .LBE3799-.Ltext0
+	.byte	0
+.LLRL860:
+	.byte	0x4
+	.uleb128 .LBB3746-.Ltext0
+	.uleb128 .LBE3746-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB3756-.Ltext0
+	.uleb128 .LBE3756-.Ltext0
+	.byte	0
+.LLRL863:
+	.byte	0x4
+	.uleb128 .LBB3749-.Ltext0
+	.uleb128 .LBE3749-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB3760-.Ltext0
+	.uleb128 .LBE3760-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB3764-.Ltext0
+	.uleb128 .LBE3764-.Ltext0
+	.byte	0
+.LLRL866:
+	.byte	0x4
+	.uleb128 .LBB3753-.Ltext0
+	.uleb128 .LBE3753-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB3778-.Ltext0
+	.uleb128 .LBE3778-.Ltext0
+	.byte	0
+.LLRL868:
+	.byte	0x4
+	.uleb128 .LBB3757-.Ltext0
+	.uleb128 .LBE3757-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB3777-.Ltext0
+	.uleb128 .LBE3777-.Ltext0
+	.byte	0
+.LLRL870:
+	.byte	0x4
+	.uleb128 .LBB3761-.Ltext0
+	.uleb128 .LBE3761-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB3765-.Ltext0
+	.uleb128 .LBE3765-.Ltext0
+	.byte	0
+.LLRL872:
+	.byte	0x4
+	.uleb128 .LBB3766-.Ltext0
+	.uleb128 .LBE3766-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB3772-.Ltext0
+	.uleb128 .LBE3772-.Ltext0
+	.byte	0
+.LLRL875:
+	.byte	0x4
+	.uleb128 .LBB3769-.Ltext0
+	.uleb128 .LBE3769-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB3776-.Ltext0
+	.uleb128 .LBE3776-.Ltext0
+	.byte	0
+.LLRL878:
+	.byte	0x4
+	.uleb128 .LBB3773-.Ltext0
+	.uleb128 .LBE3773-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB3779-.Ltext0
+	.uleb128 .LBE3779-.Ltext0
+	.byte	0
+.LLRL882:
+	.byte	0x4
+	.uleb128 .LBB3781-.Ltext0
+	.uleb128 .LBE3781-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB3787-.Ltext0
+	.uleb128 .LBE3787-.Ltext0
+	.byte	0
+.LLRL886:
+	.byte	0x4
+	.uleb128 .LBB3784-.Ltext0
+	.uleb128 .LBE3784-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB3788-.Ltext0
+	.uleb128 .LBE3788-.Ltext0
+	.byte	0
+.LLRL891:
+	.byte	0x4
+	.uleb128 .LBB3791-.Ltext0
+	.uleb128 .LBE3791-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB3798-.Ltext0
+	.uleb128 .LBE3798-.Ltext0
+	.byte	0
+.LLRL895:
+	.byte	0x4
+	.uleb128 .LBB3794-.Ltext0
+	.uleb128 .LBE3794-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB3806-.Ltext0
+	.uleb128 .LBE3806-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB3816-.Ltext0
+	.uleb128 .LBE3816-.Ltext0
+	.byte	0
+.LLRL896:
+	.byte	0x4
+	.uleb128 .LBB3800-.Ltext0
+	.uleb128 .LBE3800-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB3807-.Ltext0
+	.uleb128 .LBE3807-.Ltext0
+	.byte	0
+.LLRL900:
+	.byte	0x4
+	.uleb128 .LBB3803-.Ltext0
+	.uleb128 .LBE3803-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB3809-.Ltext0
+	.uleb128 .LBE3809-.Ltext0
+	.byte	0
+.LLRL908:
+	.byte	0x4
+	.uleb128 .LBB3817-.Ltext0
+	.uleb128 .LBE3817-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB3823-.Ltext0
+	.uleb128 .LBE3823-.Ltext0
+	.byte	0
+.LLRL911:
+	.byte	0x4
+	.uleb128 .LBB3820-.Ltext0
+	.uleb128 .LBE3820-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB3827-.Ltext0
+	.uleb128 .LBE3827-.Ltext0
+	.byte	0
+.LLRL913:
+	.byte	0x4
+	.uleb128 .LBB3824-.Ltext0
+	.uleb128 .LBE3824-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB3993-.Ltext0
+	.uleb128 .LBE3993-.Ltext0
+	.byte	0
+.LLRL918:
+	.byte	0x4
+	.uleb128 .LBB3830-.Ltext0
+	.uleb128 .LBE3830-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB3837-.Ltext0
+	.uleb128 .LBE3837-.Ltext0
+	.byte	0
+.LLRL921:
+	.byte	0x4
+	.uleb128 .LBB3833-.Ltext0
+	.uleb128 .LBE3833-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB3838-.Ltext0
+	.uleb128 .LBE3838-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB3842-.Ltext0
+	.uleb128 .LBE3842-.Ltext0
+	.byte	0
+.LLRL924:
+	.byte	0x4
+	.uleb128 .LBB3839-.Ltext0
+	.uleb128 .LBE3839-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB3843-.Ltext0
+	.uleb128 .LBE3843-.Ltext0
+	.byte	0
+.LLRL931:
+	.byte	0x4
+	.uleb128 .LBB3850-.Ltext0
+	.uleb128 .LBE3850-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB3860-.Ltext0
+	.uleb128 .LBE3860-.Ltext0
+	.byte	0
+.LLRL934:
+	.byte	0x4
+	.uleb128 .LBB3853-.Ltext0
+	.uleb128 .LBE3853-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB3861-.Ltext0
+	.uleb128 .LBE3861-.Ltext0
+	.byte	0
+.LLRL936:
+	.byte	0x4
+	.uleb128 .LBB3856-.Ltext0
+	.uleb128 .LBE3856-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB3965-.Ltext0
+	.uleb128 .LBE3965-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB3996-.Ltext0
+	.uleb128 .LBE3996-.Ltext0
+	.byte	0
+.LLRL940:
+	.byte	0x4
+	.uleb128 .LBB3864-.Ltext0
+	.uleb128 .LBE3864-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB3874-.Ltext0
+	.uleb128 .LBE3874-.Ltext0
+	.byte	0
+.LLRL943:
+	.byte	0x4
+	.uleb128 .LBB3867-.Ltext0
+	.uleb128 .LBE3867-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB3878-.Ltext0
+	.uleb128 .LBE3878-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB3882-.Ltext0
+	.uleb128 .LBE3882-.Ltext0
+	.byte	0
+.LLRL946:
+	.byte	0x4
+	.uleb128 .LBB3871-.Ltext0
+	.uleb128 .LBE3871-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB3893-.Ltext0
+	.uleb128 .LBE3893-.Ltext0
+	.byte	0
+.LLRL948:
+	.byte	0x4
+	.uleb128 .LBB3875-.Ltext0
+	.uleb128 .LBE3875-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB3892-.Ltext0
+	.uleb128 .LBE3892-.Ltext0
+	.byte	0
+.LLRL950:
+	.byte	0x4
+	.uleb128 .LBB3879-.Ltext0
+	.uleb128 .LBE3879-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB3883-.Ltext0
+	.uleb128 .LBE3883-.Ltext0
+	.byte	0
+.LLRL952:
+	.byte	0x4
+	.uleb128 .LBB3884-.Ltext0
+	.uleb128 .LBE3884-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB3890-.Ltext0
+	.uleb128 .LBE3890-.Ltext0
+	.byte	0
+.LLRL955:
+	.byte	0x4
+	.uleb128 .LBB3887-.Ltext0
+	.uleb128 .LBE3887-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB3891-.Ltext0
+	.uleb128 .LBE3891-.Ltext0
+	.byte	0
+.LLRL961:
+	.byte	0x4
+	.uleb128 .LBB3898-.Ltext0
+	.uleb128 .LBE3898-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB3904-.Ltext0
+	.uleb128 .LBE3904-.Ltext0
+	.byte	0
+.LLRL964:
+	.byte	0x4
+	.uleb128 .LBB3901-.Ltext0
+	.uleb128 .LBE3901-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB3905-.Ltext0
+	.uleb128 .LBE3905-.Ltext0
+	.byte	0
+.LLRL968:
+	.byte	0x4
+	.uleb128 .LBB3908-.Ltext0
+	.uleb128 .LBE3908-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB3915-.Ltext0
+	.uleb128 .LBE3915-.Ltext0
+	.byte	0
+.LLRL971:
+	.byte	0x4
+	.uleb128 .LBB3911-.Ltext0
+	.uleb128 .LBE3911-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB3916-.Ltext0
+	.uleb128 .LBE3916-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB3920-.Ltext0
+	.uleb128 .LBE3920-.Ltext0
+	.byte	0
+.LLRL974:
+	.byte	0x4
+	.uleb128 .LBB3917-.Ltext0
+	.uleb128 .LBE3917-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB3921-.Ltext0
+	.uleb128 .LBE3921-.Ltext0
+	.byte	0
+.LLRL981:
+	.byte	0x4
+	.uleb128 .LBB3928-.Ltext0
+	.uleb128 .LBE3928-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB3937-.Ltext0
+	.uleb128 .LBE3937-.Ltext0
+	.byte	0
+.LLRL984:
+	.byte	0x4
+	.uleb128 .LBB3931-.Ltext0
+	.uleb128 .LBE3931-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB3944-.Ltext0
+	.uleb128 .LBE3944-.Ltext0
+	.byte	0
+.LLRL986:
+	.byte	0x4
+	.uleb128 .LBB3934-.Ltext0
+	.uleb128 .LBE3934-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB3990-.Ltext0
+	.uleb128 .LBE3990-.Ltext0
+	.byte	0
+.LLRL989:
+	.byte	0x4
+	.uleb128 .LBB3938-.Ltext0
+	.uleb128 .LBE3938-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB3991-.Ltext0
+	.uleb128 .LBE3991-.Ltext0
+	.byte	0
+.LLRL991:
+	.byte	0x4
+	.uleb128 .LBB3941-.Ltext0
+	.uleb128 .LBE3941-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB3994-.Ltext0
+	.uleb128 .LBE3994-.Ltext0
+	.byte	0
+.LLRL994:
+	.byte	0x4
+	.uleb128 .LBB3945-.Ltext0
+	.uleb128 .LBE3945-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB3954-.Ltext0
+	.uleb128 .LBE3954-.Ltext0
+	.byte	0
+.LLRL997:
+	.byte	0x4
+	.uleb128 .LBB3948-.Ltext0
+	.uleb128 .LBE3948-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB3992-.Ltext0
+	.uleb128 .LBE3992-.Ltext0
+	.byte	0
+.LLRL1000:
+	.byte	0x4
+	.uleb128 .LBB3951-.Ltext0
+	.uleb128 .LBE3951-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB3995-.Ltext0
+	.uleb128 .LBE3995-.Ltext0
+	.byte	0
+.LLRL1003:
+	.byte	0x4
+	.uleb128 .LBB3955-.Ltext0
+	.uleb128 .LBE3955-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB3966-.Ltext0
+	.uleb128 .LBE3966-.Ltext0
+	.byte	0
+.LLRL1006:
+	.byte	0x4
+	.uleb128 .LBB3958-.Ltext0
+	.uleb128 .LBE3958-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB3970-.Ltext0
+	.uleb128 .LBE3970-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB3974-.Ltext0
+	.uleb128 .LBE3974-.Ltext0
+	.byte	0
+.LLRL1009:
+	.byte	0x4
+	.uleb128 .LBB3962-.Ltext0
+	.uleb128 .LBE3962-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB3989-.Ltext0
+	.uleb128 .LBE3989-.Ltext0
+	.byte	0
+.LLRL1011:
+	.byte	0x4
+	.uleb128 .LBB3967-.Ltext0
+	.uleb128 .LBE3967-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB3988-.Ltext0
+	.uleb128 .LBE3988-.Ltext0
+	.byte	0
+.LLRL1013:
+	.byte	0x4
+	.uleb128 .LBB3971-.Ltext0
+	.uleb128 .LBE3971-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB3975-.Ltext0
+	.uleb128 .LBE3975-.Ltext0
+	.byte	0
+.LLRL1015:
+	.byte	0x4
+	.uleb128 .LBB3976-.Ltext0
+	.uleb128 .LBE3976-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB3982-.Ltext0
+	.uleb128 .LBE3982-.Ltext0
+	.byte	0
+.LLRL1018:
+	.byte	0x4
+	.uleb128 .LBB3979-.Ltext0
+	.uleb128 .LBE3979-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB3987-.Ltext0
+	.uleb128 .LBE3987-.Ltext0
+	.byte	0
+.LLRL1021:
+	.byte	0x4
+	.uleb128 .LBB3983-.Ltext0
+	.uleb128 .LBE3983-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB3997-.Ltext0
+	.uleb128 .LBE3997-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB4002-.Ltext0
+	.uleb128 .LBE4002-.Ltext0
+	.byte	0
+.LLRL1025:
+	.byte	0x4
+	.uleb128 .LBB3998-.Ltext0
+	.uleb128 .LBE3998-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB4010-.Ltext0
+	.uleb128 .LBE4010-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB4034-.Ltext0
+	.uleb128 .LBE4034-.Ltext0
+	.byte	0
+.LLRL1026:
+	.byte	0x4
+	.uleb128 .LBB4003-.Ltext0
+	.uleb128 .LBE4003-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB4011-.Ltext0
+	.uleb128 .LBE4011-.Ltext0
+	.byte	0
+.LLRL1030:
+	.byte	0x4
+	.uleb128 .LBB4006-.Ltext0
+	.uleb128 .LBE4006-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB4015-.Ltext0
+	.uleb128 .LBE4015-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB4030-.Ltext0
+	.uleb128 .LBE4030-.Ltext0
+	.byte	0
+.LLRL1033:
+	.byte	0x4
+	.uleb128 .LBB4012-.Ltext0
+	.uleb128 .LBE4012-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB4019-.Ltext0
+	.uleb128 .LBE4019-.Ltext0
+	.byte	0
+.LLRL1037:
+	.byte	0x4
+	.uleb128 .LBB4016-.Ltext0
+	.uleb128 .LBE4016-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB4035-.Ltext0
+	.uleb128 .LBE4035-.Ltext0
+	.byte	0
+.LLRL1039:
+	.byte	0x4
+	.uleb128 .LBB4020-.Ltext0
+	.uleb128 .LBE4020-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB4029-.Ltext0
+	.uleb128 .LBE4029-.Ltext0
+	.byte	0
+.LLRL1042:
+	.byte	0x4
+	.uleb128 .LBB4023-.Ltext0
+	.uleb128 .LBE4023-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB4031-.Ltext0
+	.uleb128 .LBE4031-.Ltext0
+	.byte	0
+.LLRL1045:
+	.byte	0x4
+	.uleb128 .LBB4026-.Ltext0
+	.uleb128 .LBE4026-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB4036-.Ltext0
+	.uleb128 .LBE4036-.Ltext0
+	.byte	0
+.LLRL1050:
+	.byte	0x4
+	.uleb128 .LBB4039-.Ltext0
+	.uleb128 .LBE4039-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB4046-.Ltext0
+	.uleb128 .LBE4046-.Ltext0
+	.byte	0
+.LLRL1053:
+	.byte	0x4
+	.uleb128 .LBB4042-.Ltext0
+	.uleb128 .LBE4042-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB4047-.Ltext0
+	.uleb128 .LBE4047-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB4051-.Ltext0
+	.uleb128 .LBE4051-.Ltext0
+	.byte	0
+.LLRL1056:
+	.byte	0x4
+	.uleb128 .LBB4048-.Ltext0
+	.uleb128 .LBE4048-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB4052-.Ltext0
+	.uleb128 .LBE4052-.Ltext0
+	.byte	0
+.LLRL1063:
+	.byte	0x4
+	.uleb128 .LBB4059-.Ltext0
+	.uleb128 .LBE4059-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB4069-.Ltext0
+	.uleb128 .LBE4069-.Ltext0
+	.byte	0
+.LLRL1066:
+	.byte	0x4
+	.uleb128 .LBB4062-.Ltext0
+	.uleb128 .LBE4062-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB4071-.Ltext0
+	.uleb128 .LBE4071-.Ltext0
+	.byte	0
+.LLRL1068:
+	.byte	0x4
+	.uleb128 .LBB4065-.Ltext0
+	.uleb128 .LBE4065-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB4070-.Ltext0
+	.uleb128 .LBE4070-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB4229-.Ltext0
+	.uleb128 .LBE4229-.Ltext0
+	.byte	0
+.LLRL1071:
+	.byte	0x4
+	.uleb128 .LBB4072-.Ltext0
+	.uleb128 .LBE4072-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB4082-.Ltext0
+	.uleb128 .LBE4082-.Ltext0
+	.byte	0
+.LLRL1074:
+	.byte	0x4
+	.uleb128 .LBB4075-.Ltext0
+	.uleb128 .LBE4075-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB4230-.Ltext0
+	.uleb128 .LBE4230-.Ltext0
+	.byte	0
+.LLRL1076:
+	.byte	0x4
+	.uleb128 .LBB4078-.Ltext0
+	.uleb128 .LBE4078-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB4093-.Ltext0
+	.uleb128 .LBE4093-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB4231-.Ltext0
+	.uleb128 .LBE4231-.Ltext0
+	.byte	0
+.LLRL1080:
+	.byte	0x4
+	.uleb128 .LBB4083-.Ltext0
+	.uleb128 .LBE4083-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB4094-.Ltext0
+	.uleb128 .LBE4094-.Ltext0
+	.byte	0
+.LLRL1083:
+	.byte	0x4
+	.uleb128 .LBB4086-.Ltext0
+	.uleb128 .LBE4086-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB4101-.Ltext0
+	.uleb128 .LBE4101-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB4105-.Ltext0
+	.uleb128 .LBE4105-.Ltext0
+	.byte	0
+.LLRL1086:
+	.byte	0x4
+	.uleb128 .LBB4090-.Ltext0
+	.uleb128 .LBE4090-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB4120-.Ltext0
+	.uleb128 .LBE4120-.Ltext0
+	.byte	0
+.LLRL1088:
+	.byte	0x4
+	.uleb128 .LBB4095-.Ltext0
+	.uleb128 .LBE4095-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB4119-.Ltext0
+	.uleb128 .LBE4119-.Ltext0
+	.byte	0
+.LLRL1090:
+	.byte	0x4
+	.uleb128 .LBB4098-.Ltext0
+	.uleb128 .LBE4098-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB4232-.Ltext0
+	.uleb128 .LBE4232-.Ltext0
+	.byte	0
+.LLRL1092:
+	.byte	0x4
+	.uleb128 .LBB4102-.Ltext0
+	.uleb128 .LBE4102-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB4106-.Ltext0
+	.uleb128 .LBE4106-.Ltext0
+	.byte	0
+.LLRL1094:
+	.byte	0x4
+	.uleb128 .LBB4107-.Ltext0
+	.uleb128 .LBE4107-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB4113-.Ltext0
+	.uleb128 .LBE4113-.Ltext0
+	.byte	0
+.LLRL1097:
+	.byte	0x4
+	.uleb128 .LBB4110-.Ltext0
+	.uleb128 .LBE4110-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB4118-.Ltext0
+	.uleb128 .LBE4118-.Ltext0
+	.byte	0
+.LLRL1100:
+	.byte	0x4
+	.uleb128 .LBB4114-.Ltext0
+	.uleb128 .LBE4114-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB4126-.Ltext0
+	.uleb128 .LBE4126-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB4220-.Ltext0
+	.uleb128 .LBE4220-.Ltext0
+	.byte	0
+.LLRL1104:
+	.byte	0x4
+	.uleb128 .LBB4123-.Ltext0
+	.uleb128 .LBE4123-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB4133-.Ltext0
+	.uleb128 .LBE4133-.Ltext0
+	.byte	0
+.LLRL1106:
+	.byte	0x4
+	.uleb128 .LBB4127-.Ltext0
+	.uleb128 .LBE4127-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB4225-.Ltext0
+	.uleb128 .LBE4225-.Ltext0
+	.byte	0
+.LLRL1109:
+	.byte	0x4
+	.uleb128 .LBB4130-.Ltext0
+	.uleb128 .LBE4130-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB4221-.Ltext0
+	.uleb128 .LBE4221-.Ltext0
+	.byte	0
+.LLRL1111:
+	.byte	0x4
+	.uleb128 .LBB4134-.Ltext0
+	.uleb128 .LBE4134-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB4143-.Ltext0
+	.uleb128 .LBE4143-.Ltext0
+	.byte	0
+.LLRL1114:
+	.byte	0x4
+	.uleb128 .LBB4137-.Ltext0
+	.uleb128 .LBE4137-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB4144-.Ltext0
+	.uleb128 .LBE4144-.Ltext0
+	.byte	0
+.LLRL1116:
+	.byte	0x4
+	.uleb128 .LBB4140-.Ltext0
+	.uleb128 .LBE4140-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB4226-.Ltext0
+	.uleb128 .LBE4226-.Ltext0
+	.byte	0
+.LLRL1120:
+	.byte	0x4
+	.uleb128 .LBB4147-.Ltext0
+	.uleb128 .LBE4147-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB4154-.Ltext0
+	.uleb128 .LBE4154-.Ltext0
+	.byte	0
+.LLRL1123:
+	.byte	0x4
+	.uleb128 .LBB4150-.Ltext0
+	.uleb128 .LBE4150-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB4155-.Ltext0
+	.uleb128 .LBE4155-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB4159-.Ltext0
+	.uleb128 .LBE4159-.Ltext0
+	.byte	0
+.LLRL1126:
+	.byte	0x4
+	.uleb128 .LBB4156-.Ltext0
+	.uleb128 .LBE4156-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB4160-.Ltext0
+	.uleb128 .LBE4160-.Ltext0
+	.byte	0
+.LLRL1132:
+	.byte	0x4
+	.uleb128 .LBB4165-.Ltext0
+	.uleb128 .LBE4165-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB4172-.Ltext0
+	.uleb128 .LBE4172-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB4176-.Ltext0
+	.uleb128 .LBE4176-.Ltext0
+	.byte	0
+.LLRL1134:
+	.byte	0x4
+	.uleb128 .LBB4169-.Ltext0
+	.uleb128 .LBE4169-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB4227-.Ltext0
+	.uleb128 .LBE4227-.Ltext0
+	.byte	0
+.LLRL1137:
+	.byte	0x4
+	.uleb128 .LBB4173-.Ltext0
+	.uleb128 .LBE4173-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB4228-.Ltext0
+	.uleb128 .LBE4228-.Ltext0
+	.byte	0
+.LLRL1140:
+	.byte	0x4
+	.uleb128 .LBB4177-.Ltext0
+	.uleb128 .LBE4177-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB4183-.Ltext0
+	.uleb128 .LBE4183-.Ltext0
+	.byte	0
+.LLRL1143:
+	.byte	0x4
+	.uleb128 .LBB4180-.Ltext0
+	.uleb128 .LBE4180-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB4184-.Ltext0
+	.uleb128 .LBE4184-.Ltext0
+	.byte	0
+.LLRL1147:
+	.byte	0x4
+	.uleb128 .LBB4187-.Ltext0
+	.uleb128 .LBE4187-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB4197-.Ltext0
+	.uleb128 .LBE4197-.Ltext0
+	.byte	0
+.LLRL1150:
+	.byte	0x4
+	.uleb128 .LBB4190-.Ltext0
+	.uleb128 .LBE4190-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB4201-.Ltext0
+	.uleb128 .LBE4201-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB4205-.Ltext0
+	.uleb128 .LBE4205-.Ltext0
+	.byte	0
+.LLRL1153:
+	.byte	0x4
+	.uleb128 .LBB4194-.Ltext0
+	.uleb128 .LBE4194-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB4219-.Ltext0
+	.uleb128 .LBE4219-.Ltext0
+	.byte	0
+.LLRL1155:
+	.byte	0x4
+	.uleb128 .LBB4198-.Ltext0
+	.uleb128 .LBE4198-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB4218-.Ltext0
+	.uleb128 .LBE4218-.Ltext0
+	.byte	0
+.LLRL1157:
+	.byte	0x4
+	.uleb128 .LBB4202-.Ltext0
+	.uleb128 .LBE4202-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB4206-.Ltext0
+	.uleb128 .LBE4206-.Ltext0
+	.byte	0
+.LLRL1159:
+	.byte	0x4
+	.uleb128 .LBB4207-.Ltext0
+	.uleb128 .LBE4207-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB4213-.Ltext0
+	.uleb128 .LBE4213-.Ltext0
+	.byte	0
+.LLRL1162:
+	.byte	0x4
+	.uleb128 .LBB4210-.Ltext0
+	.uleb128 .LBE4210-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB4217-.Ltext0
+	.uleb128 .LBE4217-.Ltext0
+	.byte	0
+.LLRL1165:
+	.byte	0x4
+	.uleb128 .LBB4214-.Ltext0
+	.uleb128 .LBE4214-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB4222-.Ltext0
+	.uleb128 .LBE4222-.Ltext0
+	.byte	0
+.LLRL1174:
+	.byte	0x4
+	.uleb128 .LBB4237-.Ltext0
+	.uleb128 .LBE4237-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB4243-.Ltext0
+	.uleb128 .LBE4243-.Ltext0
+	.byte	0
+.LLRL1177:
+	.byte	0x4
+	.uleb128 .LBB4240-.Ltext0
+	.uleb128 .LBE4240-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB4244-.Ltext0
+	.uleb128 .LBE4244-.Ltext0
+	.byte	0
+.LLRL1181:
+	.byte	0x4
+	.uleb128 .LBB4247-.Ltext0
+	.uleb128 .LBE4247-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB4254-.Ltext0
+	.uleb128 .LBE4254-.Ltext0
+	.byte	0
+.LLRL1184:
+	.byte	0x4
+	.uleb128 .LBB4250-.Ltext0
+	.uleb128 .LBE4250-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB4255-.Ltext0
+	.uleb128 .LBE4255-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB4259-.Ltext0
+	.uleb128 .LBE4259-.Ltext0
+	.byte	0
+.LLRL1187:
+	.byte	0x4
+	.uleb128 .LBB4256-.Ltext0
+	.uleb128 .LBE4256-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB4260-.Ltext0
+	.uleb128 .LBE4260-.Ltext0
+	.byte	0
+.LLRL1194:
+	.byte	0x4
+	.uleb128 .LBB4267-.Ltext0
+	.uleb128 .LBE4267-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB4273-.Ltext0
+	.uleb128 .LBE4273-.Ltext0
+	.byte	0
+.LLRL1197:
+	.byte	0x4
+	.uleb128 .LBB4270-.Ltext0
+	.uleb128 .LBE4270-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB4274-.Ltext0
+	.uleb128 .LBE4274-.Ltext0
+	.byte	0
+.LLRL1201:
+	.byte	0x4
+	.uleb128 .LBB4277-.Ltext0
+	.uleb128 .LBE4277-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB4287-.Ltext0
+	.uleb128 .LBE4287-.Ltext0
+	.byte	0
+.LLRL1204:
+	.byte	0x4
+	.uleb128 .LBB4280-.Ltext0
+	.uleb128 .LBE4280-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB4291-.Ltext0
+	.uleb128 .LBE4291-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB4295-.Ltext0
+	.uleb128 .LBE4295-.Ltext0
+	.byte	0
+.LLRL1207:
+	.byte	0x4
+	.uleb128 .LBB4284-.Ltext0
+	.uleb128 .LBE4284-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB4306-.Ltext0
+	.uleb128 .LBE4306-.Ltext0
+	.byte	0
+.LLRL1209:
+	.byte	0x4
+	.uleb128 .LBB4288-.Ltext0
+	.uleb128 .LBE4288-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB4305-.Ltext0
+	.uleb128 .LBE4305-.Ltext0
+	.byte	0
+.LLRL1211:
+	.byte	0x4
+	.uleb128 .LBB4292-.Ltext0
+	.uleb128 .LBE4292-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB4296-.Ltext0
+	.uleb128 .LBE4296-.Ltext0
+	.byte	0
+.LLRL1213:
+	.byte	0x4
+	.uleb128 .LBB4297-.Ltext0
+	.uleb128 .LBE4297-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB4303-.Ltext0
+	.uleb128 .LBE4303-.Ltext0
+	.byte	0
+.LLRL1216:
+	.byte	0x4
+	.uleb128 .LBB4300-.Ltext0
+	.uleb128 .LBE4300-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB4304-.Ltext0
+	.uleb128 .LBE4304-.Ltext0
+	.byte	0
+.LLRL1222:
+	.byte	0x4
+	.uleb128 .LBB4311-.Ltext0
+	.uleb128 .LBE4311-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB4317-.Ltext0
+	.uleb128 .LBE4317-.Ltext0
+	.byte	0
+.LLRL1225:
+	.byte	0x4
+	.uleb128 .LBB4314-.Ltext0
+	.uleb128 .LBE4314-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB4318-.Ltext0
+	.uleb128 .LBE4318-.Ltext0
+	.byte	0
+.LLRL1229:
+	.byte	0x4
+	.uleb128 .LBB4321-.Ltext0
+	.uleb128 .LBE4321-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB4328-.Ltext0
+	.uleb128 .LBE4328-.Ltext0
+	.byte	0
+.LLRL1232:
+	.byte	0x4
+	.uleb128 .LBB4324-.Ltext0
+	.uleb128 .LBE4324-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB4329-.Ltext0
+	.uleb128 .LBE4329-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB4333-.Ltext0
+	.uleb128 .LBE4333-.Ltext0
+	.byte	0
+.LLRL1235:
+	.byte	0x4
+	.uleb128 .LBB4330-.Ltext0
+	.uleb128 .LBE4330-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB4334-.Ltext0
+	.uleb128 .LBE4334-.Ltext0
+	.byte	0
+.LLRL1242:
+	.byte	0x4
+	.uleb128 .LBB4341-.Ltext0
+	.uleb128 .LBE4341-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB4347-.Ltext0
+	.uleb128 .LBE4347-.Ltext0
+	.byte	0
+.LLRL1245:
+	.byte	0x4
+	.uleb128 .LBB4344-.Ltext0
+	.uleb128 .LBE4344-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB4348-.Ltext0
+	.uleb128 .LBE4348-.Ltext0
+	.byte	0
+.LLRL1249:
+	.byte	0x4
+	.uleb128 .LBB4351-.Ltext0
+	.uleb128 .LBE4351-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB4361-.Ltext0
+	.uleb128 .LBE4361-.Ltext0
+	.byte	0
+.LLRL1252:
+	.byte	0x4
+	.uleb128 .LBB4354-.Ltext0
+	.uleb128 .LBE4354-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB4365-.Ltext0
+	.uleb128 .LBE4365-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB4369-.Ltext0
+	.uleb128 .LBE4369-.Ltext0
+	.byte	0
+.LLRL1255:
+	.byte	0x4
+	.uleb128 .LBB4358-.Ltext0
+	.uleb128 .LBE4358-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB4383-.Ltext0
+	.uleb128 .LBE4383-.Ltext0
+	.byte	0
+.LLRL1257:
+	.byte	0x4
+	.uleb128 .LBB4362-.Ltext0
+	.uleb128 .LBE4362-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB4382-.Ltext0
+	.uleb128 .LBE4382-.Ltext0
+	.byte	0
+.LLRL1259:
+	.byte	0x4
+	.uleb128 .LBB4366-.Ltext0
+	.uleb128 .LBE4366-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB4370-.Ltext0
+	.uleb128 .LBE4370-.Ltext0
+	.byte	0
+.LLRL1261:
+	.byte	0x4
+	.uleb128 .LBB4371-.Ltext0
+	.uleb128 .LBE4371-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB4377-.Ltext0
+	.uleb128 .LBE4377-.Ltext0
+	.byte	0
+.LLRL1264:
+	.byte	0x4
+	.uleb128 .LBB4374-.Ltext0
+	.uleb128 .LBE4374-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB4381-.Ltext0
+	.uleb128 .LBE4381-.Ltext0
+	.byte	0
+.LLRL1267:
+	.byte	0x4
+	.uleb128 .LBB4378-.Ltext0
+	.uleb128 .LBE4378-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB4384-.Ltext0
+	.uleb128 .LBE4384-.Ltext0
+	.byte	0
+.LLRL1271:
+	.byte	0x4
+	.uleb128 .LBB4385-.Ltext0
+	.uleb128 .LBE4385-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB4391-.Ltext0
+	.uleb128 .LBE4391-.Ltext0
+	.byte	0
+.LLRL1275:
+	.byte	0x4
+	.uleb128 .LBB4388-.Ltext0
+	.uleb128 .LBE4388-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB4400-.Ltext0
+	.uleb128 .LBE4400-.Ltext0
+	.byte	0
+.LLRL1277:
+	.byte	0x4
+	.uleb128 .LBB4392-.Ltext0
+	.uleb128 .LBE4392-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB4398-.Ltext0
+	.uleb128 .LBE4398-.Ltext0
+	.byte	0
+.LLRL1280:
+	.byte	0x4
+	.uleb128 .LBB4395-.Ltext0
+	.uleb128 .LBE4395-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB4399-.Ltext0
+	.uleb128 .LBE4399-.Ltext0
+	.byte	0
+.LLRL1287:
+	.byte	0x4
+	.uleb128 .LBB4405-.Ltext0
+	.uleb128 .LBE4405-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB4412-.Ltext0
+	.uleb128 .LBE4412-.Ltext0
+	.byte	0
+.LLRL1291:
+	.byte	0x4
+	.uleb128 .LBB4408-.Ltext0
+	.uleb128 .LBE4408-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB4423-.Ltext0
+	.uleb128 .LBE4423-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB4440-.Ltext0
+	.uleb128 .LBE4440-.Ltext0
+	.byte	0
+.LLRL1292:
+	.byte	0x4
+	.uleb128 .LBB4413-.Ltext0
+	.uleb128 .LBE4413-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB4424-.Ltext0
+	.uleb128 .LBE4424-.Ltext0
+	.byte	0
+.LLRL1296:
+	.byte	0x4
+	.uleb128 .LBB4416-.Ltext0
+	.uleb128 .LBE4416-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB4425-.Ltext0
+	.uleb128 .LBE4425-.Ltext0
+	.byte	0
+.LLRL1298:
+	.byte	0x4
+	.uleb128 .LBB4419-.Ltext0
+	.uleb128 .LBE4419-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB4426-.Ltext0
+	.uleb128 .LBE4426-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB4430-.Ltext0
+	.uleb128 .LBE4430-.Ltext0
+	.byte	0
+.LLRL1301:
+	.byte	0x4
+	.uleb128 .LBB4427-.Ltext0
+	.uleb128 .LBE4427-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB4441-.Ltext0
+	.uleb128 .LBE4441-.Ltext0
+	.byte	0
+.LLRL1303:
+	.byte	0x4
+	.uleb128 .LBB4431-.Ltext0
+	.uleb128 .LBE4431-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB4437-.Ltext0
+	.uleb128 .LBE4437-.Ltext0
+	.byte	0
+.LLRL1307:
+	.byte	0x4
+	.uleb128 .LBB4434-.Ltext0
+	.uleb128 .LBE4434-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB4442-.Ltext0
+	.uleb128 .LBE4442-.Ltext0
+	.byte	0
+.LLRL1312:
+	.byte	0x4
+	.uleb128 .LBB4445-.Ltext0
+	.uleb128 .LBE4445-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB4452-.Ltext0
+	.uleb128 .LBE4452-.Ltext0
+	.byte	0
+.LLRL1315:
+	.byte	0x4
+	.uleb128 .LBB4448-.Ltext0
+	.uleb128 .LBE4448-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB4453-.Ltext0
+	.uleb128 .LBE4453-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB4457-.Ltext0
+	.uleb128 .LBE4457-.Ltext0
+	.byte	0
+.LLRL1318:
+	.byte	0x4
+	.uleb128 .LBB4454-.Ltext0
+	.uleb128 .LBE4454-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB4458-.Ltext0
+	.uleb128 .LBE4458-.Ltext0
+	.byte	0
+.LLRL1325:
+	.byte	0x4
+	.uleb128 .LBB4465-.Ltext0
+	.uleb128 .LBE4465-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB4471-.Ltext0
+	.uleb128 .LBE4471-.Ltext0
+	.byte	0
+.LLRL1328:
+	.byte	0x4
+	.uleb128 .LBB4468-.Ltext0
+	.uleb128 .LBE4468-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB4472-.Ltext0
+	.uleb128 .LBE4472-.Ltext0
+	.byte	0
+.LLRL1332:
+	.byte	0x4
+	.uleb128 .LBB4475-.Ltext0
+	.uleb128 .LBE4475-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB4485-.Ltext0
+	.uleb128 .LBE4485-.Ltext0
+	.byte	0
+.LLRL1335:
+	.byte	0x4
+	.uleb128 .LBB4478-.Ltext0
+	.uleb128 .LBE4478-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB4489-.Ltext0
+	.uleb128 .LBE4489-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB4493-.Ltext0
+	.uleb128 .LBE4493-.Ltext0
+	.byte	0
+.LLRL1338:
+	.byte	0x4
+	.uleb128 .LBB4482-.Ltext0
+	.uleb128 .LBE4482-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB4504-.Ltext0
+	.uleb128 .LBE4504-.Ltext0
+	.byte	0
+.LLRL1340:
+	.byte	0x4
+	.uleb128 .LBB4486-.Ltext0
+	.uleb128 .LBE4486-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB4503-.Ltext0
+	.uleb128 .LBE4503-.Ltext0
+	.byte	0
+.LLRL1342:
+	.byte	0x4
+	.uleb128 .LBB4490-.Ltext0
+	.uleb128 .LBE4490-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB4494-.Ltext0
+	.uleb128 .LBE4494-.Ltext0
+	.byte	0
+.LLRL1344:
+	.byte	0x4
+	.uleb128 .LBB4495-.Ltext0
+	.uleb128 .LBE4495-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB4501-.Ltext0
+	.uleb128 .LBE4501-.Ltext0
+	.byte	0
+.LLRL1347:
+	.byte	0x4
+	.uleb128 .LBB4498-.Ltext0
+	.uleb128 .LBE4498-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB4502-.Ltext0
+	.uleb128 .LBE4502-.Ltext0
+	.byte	0
+.LLRL1353:
+	.byte	0x4
+	.uleb128 .LBB4509-.Ltext0
+	.uleb128 .LBE4509-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB4515-.Ltext0
+	.uleb128 .LBE4515-.Ltext0
+	.byte	0
+.LLRL1356:
+	.byte	0x4
+	.uleb128 .LBB4512-.Ltext0
+	.uleb128 .LBE4512-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB4516-.Ltext0
+	.uleb128 .LBE4516-.Ltext0
+	.byte	0
+.LLRL1360:
+	.byte	0x4
+	.uleb128 .LBB4519-.Ltext0
+	.uleb128 .LBE4519-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB4526-.Ltext0
+	.uleb128 .LBE4526-.Ltext0
+	.byte	0
+.LLRL1363:
+	.byte	0x4
+	.uleb128 .LBB4522-.Ltext0
+	.uleb128 .LBE4522-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB4527-.Ltext0
+	.uleb128 .LBE4527-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB4531-.Ltext0
+	.uleb128 .LBE4531-.Ltext0
+	.byte	0
+.LLRL1366:
+	.byte	0x4
+	.uleb128 .LBB4528-.Ltext0
+	.uleb128 .LBE4528-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB4532-.Ltext0
+	.uleb128 .LBE4532-.Ltext0
+	.byte	0
+.LLRL1372:
+	.byte	0x4
+	.uleb128 .LBB4537-.Ltext0
+	.uleb128 .LBE4537-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB4543-.Ltext0
+	.uleb128 .LBE4543-.Ltext0
+	.byte	0
+.LLRL1374:
+	.byte	0x4
+	.uleb128 .LBB4540-.Ltext0
+	.uleb128 .LBE4540-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB4547-.Ltext0
+	.uleb128 .LBE4547-.Ltext0
+	.byte	0
+.LLRL1376:
+	.byte	0x4
+	.uleb128 .LBB4544-.Ltext0
+	.uleb128 .LBE4544-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB4548-.Ltext0
+	.uleb128 .LBE4548-.Ltext0
+	.byte	0
+.LLRL1380:
+	.byte	0x4
+	.uleb128 .LBB4551-.Ltext0
+	.uleb128 .LBE4551-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB4561-.Ltext0
+	.uleb128 .LBE4561-.Ltext0
+	.byte	0
+.LLRL1383:
+	.byte	0x4
+	.uleb128 .LBB4554-.Ltext0
+	.uleb128 .LBE4554-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB4569-.Ltext0
+	.uleb128 .LBE4569-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB4573-.Ltext0
+	.uleb128 .LBE4573-.Ltext0
+	.byte	0
+.LLRL1386:
+	.byte	0x4
+	.uleb128 .LBB4558-.Ltext0
+	.uleb128 .LBE4558-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB4585-.Ltext0
+	.uleb128 .LBE4585-.Ltext0
+	.byte	0
+.LLRL1388:
+	.byte	0x4
+	.uleb128 .LBB4562-.Ltext0
+	.uleb128 .LBE4562-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB4584-.Ltext0
+	.uleb128 .LBE4584-.Ltext0
+	.byte	0
+.LLRL1390:
+	.byte	0x4
+	.uleb128 .LBB4565-.Ltext0
+	.uleb128 .LBE4565-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB4581-.Ltext0
+	.uleb128 .LBE4581-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB4588-.Ltext0
+	.uleb128 .LBE4588-.Ltext0
+	.byte	0
+.LLRL1391:
+	.byte	0x4
+	.uleb128 .LBB4570-.Ltext0
+	.uleb128 .LBE4570-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB4574-.Ltext0
+	.uleb128 .LBE4574-.Ltext0
+	.byte	0
+.LLRL1393:
+	.byte	0x4
+	.uleb128 .LBB4575-.Ltext0
+	.uleb128 .LBE4575-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB4582-.Ltext0
+	.uleb128 .LBE4582-.Ltext0
+	.byte	0
+.LLRL1396:
+	.byte	0x4
+	.uleb128 .LBB4578-.Ltext0
+	.uleb128 .LBE4578-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB4583-.Ltext0
+	.uleb128 .LBE4583-.Ltext0
+	.byte	0
+.LLRL1399:
+	.byte	0x4
+	.uleb128 .LBB4589-.Ltext0
+	.uleb128 .LBE4589-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB4595-.Ltext0
+	.uleb128 .LBE4595-.Ltext0
+	.byte	0
+.LLRL1402:
+	.byte	0x4
+	.uleb128 .LBB4592-.Ltext0
+	.uleb128 .LBE4592-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB4596-.Ltext0
+	.uleb128 .LBE4596-.Ltext0
+	.byte	0
+.LLRL1409:
+	.byte	0x4
+	.uleb128 .LBB4597-.Ltext0
+	.uleb128 .LBE4597-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB4600-.Ltext0
+	.uleb128 .LBE4600-.Ltext0
+	.byte	0
+.LLRL1417:
+	.byte	0x4
+	.uleb128 .LBB4615-.Ltext0
+	.uleb128 .LBE4615-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB4621-.Ltext0
+	.uleb128 .LBE4621-.Ltext0
+	.byte	0
+.LLRL1420:
+	.byte	0x4
+	.uleb128 .LBB4618-.Ltext0
+	.uleb128 .LBE4618-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB4622-.Ltext0
+	.uleb128 .LBE4622-.Ltext0
+	.byte	0
+.LLRL1432:
+	.byte	0x4
+	.uleb128 .LBB4623-.Ltext0
+	.uleb128 .LBE4623-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB4630-.Ltext0
+	.uleb128 .LBE4630-.Ltext0
+	.byte	0
+.LLRL1434:
+	.byte	0x4
+	.uleb128 .LBB4626-.Ltext0
+	.uleb128 .LBE4626-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB4689-.Ltext0
+	.uleb128 .LBE4689-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB4693-.Ltext0
+	.uleb128 .LBE4693-.Ltext0
+	.byte	0
+.LLRL1436:
+	.byte	0x4
+	.uleb128 .LBB4631-.Ltext0
+	.uleb128 .LBE4631-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB4645-.Ltext0
+	.uleb128 .LBE4645-.Ltext0
+	.byte	0
+.LLRL1438:
+	.byte	0x4
+	.uleb128 .LBB4634-.Ltext0
+	.uleb128 .LBE4634-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB4694-.Ltext0
+	.uleb128 .LBE4694-.Ltext0
+	.byte	0
+.LLRL1440:
+	.byte	0x4
+	.uleb128 .LBB4637-.Ltext0
+	.uleb128 .LBE4637-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB4695-.Ltext0
+	.uleb128 .LBE4695-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB4697-.Ltext0
+	.uleb128 .LBE4697-.Ltext0
+	.byte	0
+.LLRL1442:
+	.byte	0x4
+	.uleb128 .LBB4641-.Ltext0
+	.uleb128 .LBE4641-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB4698-.Ltext0
+	.uleb128 .LBE4698-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB4700-.Ltext0
+	.uleb128 .LBE4700-.Ltext0
+	.byte	0
+.LLRL1444:
+	.byte	0x4
+	.uleb128 .LBB4646-.Ltext0
+	.uleb128 .LBE4646-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB4690-.Ltext0
+	.uleb128 .LBE4690-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB4696-.Ltext0
+	.uleb128 .LBE4696-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB4699-.Ltext0
+	.uleb128 .LBE4699-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB4701-.Ltext0
+	.uleb128 .LBE4701-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB4702-.Ltext0
+	.uleb128 .LBE4702-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB4703-.Ltext0
+	.uleb128 .LBE4703-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB4704-.Ltext0
+	.uleb128 .LBE4704-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB4719-.Ltext0
+	.uleb128 .LBE4719-.Ltext0
+	.byte	0
+.LLRL1449:
+	.byte	0x4
+	.uleb128 .LBB4647-.Ltext0
+	.uleb128 .LBE4647-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB4661-.Ltext0
+	.uleb128 .LBE4661-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB4681-.Ltext0
+	.uleb128 .LBE4681-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB4683-.Ltext0
+	.uleb128 .LBE4683-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB4684-.Ltext0
+	.uleb128 .LBE4684-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB4687-.Ltext0
+	.uleb128 .LBE4687-.Ltext0
+	.byte	0
+.LLRL1450:
+	.byte	0x4
+	.uleb128 .LBB4654-.Ltext0
+	.uleb128 .LBE4654-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB4662-.Ltext0
+	.uleb128 .LBE4662-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB4682-.Ltext0
+	.uleb128 .LBE4682-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB4685-.Ltext0
+	.uleb128 .LBE4685-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB4686-.Ltext0
+	.uleb128 .LBE4686-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB4688-.Ltext0
+	.uleb128 .LBE4688-.Ltext0
+	.byte	0
+.LLRL1451:
+	.byte	0x4
+	.uleb128 .LBB4663-.Ltext0
+	.uleb128 .LBE4663-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB4670-.Ltext0
+	.uleb128 .LBE4670-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB4677-.Ltext0
+	.uleb128 .LBE4677-.Ltext0
+	.byte	0
+.LLRL1453:
+	.byte	0x4
+	.uleb128 .LBB4667-.Ltext0
+	.uleb128 .LBE4667-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB4678-.Ltext0
+	.uleb128 .LBE4678-.Ltext0
+	.byte	0
+.LLRL1454:
+	.byte	0x4
+	.uleb128 .LBB4671-.Ltext0
+	.uleb128 .LBE4671-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB4679-.Ltext0
+	.uleb128 .LBE4679-.Ltext0
+	.byte	0
+.LLRL1455:
+	.byte	0x4
+	.uleb128 .LBB4674-.Ltext0
+	.uleb128 .LBE4674-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB4680-.Ltext0
+	.uleb128 .LBE4680-.Ltext0
+	.byte	0
+.LLRL1456:
+	.byte	0x4
+	.uleb128 .LBB4705-.Ltext0
+	.uleb128 .LBE4705-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB4712-.Ltext0
+	.uleb128 .LBE4712-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB4716-.Ltext0
+	.uleb128 .LBE4716-.Ltext0
+	.byte	0
+.LLRL1459:
+	.byte	0x4
+	.uleb128 .LBB4709-.Ltext0
+	.uleb128 .LBE4709-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB4718-.Ltext0
+	.uleb128 .LBE4718-.Ltext0
+	.byte	0
+.LLRL1461:
+	.byte	0x4
+	.uleb128 .LBB4713-.Ltext0
+	.uleb128 .LBE4713-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB4717-.Ltext0
+	.uleb128 .LBE4717-.Ltext0
+	.byte	0
+.Ldebug_ranges3:
+	.section	.debug_line,"",@progbits
+.Ldebug_line0:
+	.section	.debug_str,"MS",@progbits,1
+.LASF31:
+	.string	"_Float16"
+.LASF52:
+	.string	"_mm_set_epi64x"
+.LASF42:
+	.string	"_mm_shuffle_epi32"
+.LASF37:
+	.string	"blake2s_compress_sse"
+.LASF45:
+	.string	"_mm_or_si128"
+.LASF10:
+	.string	"short int"
+.LASF8:
+	.string	"size_t"
+.LASF51:
+	.string	"_mm_load_si128"
+.LASF43:
+	.string	"__mask"
+.LASF11:
+	.string	"__uint32_t"
+.LASF57:
+	.string	"__m128i_u"
+.LASF28:
+	.string	"__v8hi"
+.LASF22:
+	.string	"float"
+.LASF35:
+	.string	"nblocks"
+.LASF19:
+	.string	"long long int"
+.LASF34:
+	.string	"blake2s_vr8"
+.LASF38:
+	.string	"vinc"
+.LASF2:
+	.string	"long int"
+.LASF58:
+	.string	"blake2s_10rounds"
+.LASF9:
+	.string	"__uint8_t"
+.LASF21:
+	.string	"blake2s_sigma"
+.LASF44:
+	.string	"_mm_xor_si128"
+.LASF4:
+	.string	"unsigned char"
+.LASF47:
+	.string	"_mm_slli_epi32"
+.LASF40:
+	.string	"_mm_blend_epi16"
+.LASF20:
+	.string	"blake2s_iv"
+.LASF7:
+	.string	"signed char"
+.LASF18:
+	.string	"long long unsigned int"
+.LASF14:
+	.string	"uint32_t"
+.LASF6:
+	.string	"unsigned int"
+.LASF32:
+	.string	"blake2s_viv"
+.LASF33:
+	.string	"blake2s_vr16"
+.LASF55:
+	.string	"GNU C99 12.2.0 -msse4.1 -mtune=generic -march=x86-64 -g -O3 -std=c99 -fasynchronous-unwind-tables"
+.LASF5:
+	.string	"short unsigned int"
+.LASF41:
+	.string	"_mm_shuffle_epi8"
+.LASF53:
+	.string	"__q1"
+.LASF12:
+	.string	"char"
+.LASF54:
+	.string	"__q0"
+.LASF26:
+	.string	"__v4si"
+.LASF15:
+	.string	"buf_len"
+.LASF59:
+	.string	"_mm_store_si128"
+.LASF27:
+	.string	"__v4su"
+.LASF56:
+	.string	"blake2s_ctx"
+.LASF46:
+	.string	"_mm_srli_epi32"
+.LASF48:
+	.string	"_mm_add_epi64"
+.LASF50:
+	.string	"_mm_loadu_si128"
+.LASF3:
+	.string	"long unsigned int"
+.LASF23:
+	.string	"double"
+.LASF16:
+	.string	"digest_len"
+.LASF29:
+	.string	"__v16qi"
+.LASF13:
+	.string	"uint8_t"
+.LASF39:
+	.string	"vr16"
+.LASF24:
+	.string	"__v2di"
+.LASF49:
+	.string	"_mm_add_epi32"
+.LASF30:
+	.string	"__m128i"
+.LASF25:
+	.string	"__v2du"
+.LASF36:
+	.string	"blake2s_compress_blocks_sse"
+.LASF17:
+	.string	"last_node"
+	.section	.debug_line_str,"MS",@progbits,1
+.LASF1:
+	.string	"/root/repo"
+.LASF0:
+	.string	"blake2s-sse.c"
+	.ident	"GCC: (Debian 12.2.0-14+deb12u1) 12.2.0"
+	.section	.note.GNU-stack,"",@progbits
@@ -0,0 +1,159 @@
+#include <stdlib.h>
+#include <string.h>
+
+#include "blake2s.h"
+#include "blake2s-internal.h"
+
+/* Tree hashing, see blake2s.h for the shape of the tree.
+ *
+ * All nodes of a level are independent, so they go through the
+ * multi-buffer kernel together, B2S_TREE_BATCH contexts at a time.
+ * With several threads, a level is cut into tasks of at least
+ * B2S_TREE_TASK input bytes for the worker pool.
+ */
+#define B2S_TREE_BATCH 64
+#define B2S_TREE_TASK  (256 << 10)
+
+struct btree_level {
+    unsigned char *out;
+    const u8 *src;
+    size_t len;
+    const struct blake2s_param *P;
+    const void *key;
+    size_t span;    /* input bytes per node */
+    size_t n;       /* nodes in the level */
+    size_t per;     /* nodes per task */
+};
+
+static int btree_check(const struct blake2s_param *P)
+{
+    if (P->fanout < 2 || P->depth < 2)
+        return -1;
+    if (!P->leaf_len || !P->inner_len)
+        return -1;
+    return 0;
+}
+
+/* btree_span: input bytes per node of level `node_depth` */
+static size_t btree_span(const struct blake2s_param *P, unsigned node_depth)
+{
+    return node_depth ? (size_t)P->fanout * P->inner_len : P->leaf_len;
+}
+
+size_t blake2s_tree_nodes(unsigned char *out, const void *src, size_t len,
+                          const struct blake2s_param *P, const void *key)
+{
+    struct blake2s_ctx ctx[B2S_TREE_BATCH];
+    struct blake2s_job job[B2S_TREE_BATCH];
+    struct blake2s_param Q = *P;
+    size_t span = btree_span(P, P->node_depth);
+    size_t n = len ? (len - 1) / span + 1 : 1;
+
+    if (btree_check(P) < 0)
+        return 0;
+    for (size_t i = 0; i < n; i += B2S_TREE_BATCH) {
+        size_t k = n - i < B2S_TREE_BATCH ? n - i : B2S_TREE_BATCH;
+        for (size_t j = 0; j < k; j++) {
+            size_t at = (i + j) * span;
+            Q.node_offset = P->node_offset + i + j;
+            Q.last_node = P->last_node && i + j == n - 1;
+            if (blake2s_init_param(&ctx[j], &Q, key) < 0)
+                return 0;
+            ctx[j].digest_len = P->inner_len;
+            job[j].ctx = &ctx[j];
+            job[j].src = (const u8 *)src + at;
+            job[j].len = len - at < span ? len - at : span;
+            job[j].out = out + (i + j) * P->inner_len;
+        }
+        blake2s_lanes_run(job, k);
+    }
+    return n;
+}
+
+static void btree_task(void *arg, size_t i)
+{
+    struct btree_level *J = arg;
+    struct blake2s_param Q = *J->P;
+    size_t first = i * J->per;
+    size_t k = J->n - first < J->per ? J->n - first : J->per;
+    size_t at = first * J->span;
+
+    Q.node_offset += first;
+    Q.last_node = Q.last_node && first + k == J->n;
+    blake2s_tree_nodes(J->out + first * Q.inner_len, J->src + at,
+                       J->len - at < k * J->span ? J->len - at : k * J->span,
+                       &Q, J->key);
+}
+
+/* btree_level: blake2s_tree_nodes() on up to `nthreads` threads */
+static size_t btree_level(unsigned char *out, const void *src, size_t len,
+                          const struct blake2s_param *P, const void *key,
+                          unsigned nthreads)
+{
+    struct btree_level J;
+    struct blake2s_ctx ctx;
+
+    J.span = btree_span(P, P->node_depth);
+    J.n = len ? (len - 1) / J.span + 1 : 1;
+    J.per = (B2S_TREE_TASK - 1) / J.span + 1;
+    if (J.per < B2S_TREE_BATCH)
+        J.per = B2S_TREE_BATCH;
+    if (nthreads <= 1 || J.n <= J.per)
+        return blake2s_tree_nodes(out, src, len, P, key);
+    /* tasks cannot fail, so check the parameters here */
+    if (blake2s_init_param(&ctx, P, key) < 0)
+        return 0;
+
+    J.out = out;
+    J.src = src;
+    J.len = len;
+    J.P = P;
+    J.key = key;
+    blake2s_pool_run(nthreads, (J.n - 1) / J.per + 1, btree_task, &J);
+    return J.n;
+}
+
+int blake2s_tree(unsigned char *out, const void *src, size_t len,
+                 const struct blake2s_param *P, const void *key)
+{
+    return blake2s_tree_parallel(out, src, len, P, key, 1);
+}
+
+int blake2s_tree_parallel(unsigned char *out, const void *src, size_t len,
+                          const struct blake2s_param *P, const void *key,
+                          unsigned nthreads)
+{
+    struct blake2s_param Q = *P;
+    struct blake2s_ctx root;
+    size_t n = len ? (len - 1) / P->leaf_len + 1 : 1;
+    unsigned char *a, *b;
+    int ret = -1;
+
+    if (btree_check(P) < 0)
+        return -1;
+    a = malloc(n * P->inner_len);
+    b = malloc(((n - 1) / P->fanout + 1) * P->inner_len);
+    if (!a || !b)
+        goto _out;
+
+    Q.node_offset = 0;
+    Q.last_node = 1;
+    /* levels alternate between `a`, sized for the leaves, and `b` */
+    for (Q.node_depth = 0; Q.node_depth < P->depth - 1; Q.node_depth++) {
+        unsigned char *dst = (Q.node_depth & 1) ? b : a;
+        n = btree_level(dst, src, len, &Q, key, nthreads);
+        if (!n)
+            goto _out;
+        src = dst;
+        len = n * P->inner_len;
+    }
+    if (blake2s_init_param(&root, &Q, key) < 0)
+        goto _out;
+    blake2s_update(&root, src, len);
+    blake2s_final(&root, out);
+    ret = 0;
+_out:
+    free(a);
+    free(b);
+    return ret;
+}
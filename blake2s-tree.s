@@ -0,0 +1,4992 @@
+	.file	"blake2s-tree.c"
+# GNU C99 (Debian 12.2.0-14+deb12u1) version 12.2.0 (x86_64-linux-gnu)
+#	compiled by GNU C version 12.2.0, GMP version 6.2.1, MPFR version 4.2.0, MPC version 1.3.1, isl version isl-0.25-GMP
+
+# GGC heuristics: --param ggc-min-expand=100 --param ggc-min-heapsize=131072
+# options passed: -mtune=generic -march=x86-64 -g -O3 -std=c99 -fasynchronous-unwind-tables
+	.text
+.Ltext0:
+	.file 0 "/root/repo" "blake2s-tree.c"
+	.p2align 4
+	.globl	blake2s_tree_nodes
+	.type	blake2s_tree_nodes, @function
+blake2s_tree_nodes:
+.LVL0:
+.LFB24:
+	.file 1 "blake2s-tree.c"
+	.loc 1 45 1 view -0
+	.cfi_startproc
+	.loc 1 45 1 is_stmt 0 view .LVU1
+	pushq	%r15	#
+	.cfi_def_cfa_offset 16
+	.cfi_offset 15, -16
+	movq	%rcx, %r15	# tmp158, P
+	movq	%rdx, %r10	# tmp157, len
+	pushq	%r14	#
+	.cfi_def_cfa_offset 24
+	.cfi_offset 14, -24
+	pushq	%r13	#
+	.cfi_def_cfa_offset 32
+	.cfi_offset 13, -32
+	pushq	%r12	#
+	.cfi_def_cfa_offset 40
+	.cfi_offset 12, -40
+	pushq	%rbp	#
+	.cfi_def_cfa_offset 48
+	.cfi_offset 6, -48
+	pushq	%rbx	#
+	.cfi_def_cfa_offset 56
+	.cfi_offset 3, -56
+	subq	$10424, %rsp	#,
+	.cfi_def_cfa_offset 10480
+# blake2s-tree.c:48:     struct blake2s_param Q = *P;
+	.loc 1 48 26 view .LVU2
+	movdqu	(%rcx), %xmm0	# *P_29(D), tmp181
+	movdqu	16(%rcx), %xmm1	# *P_29(D), tmp182
+	movdqu	32(%rcx), %xmm2	# *P_29(D), tmp183
+	movdqu	48(%rcx), %xmm3	# *P_29(D), tmp184
+# blake2s-tree.c:45: {
+	.loc 1 45 1 view .LVU3
+	movq	%rdi, 56(%rsp)	# tmp155, %sfp
+	.loc 1 46 5 is_stmt 1 view .LVU4
+	.loc 1 47 5 view .LVU5
+	.loc 1 48 5 view .LVU6
+.LBB15:
+.LBB16:
+# blake2s-tree.c:40:     return node_depth ? (size_t)P->fanout * P->inner_len : P->leaf_len;
+	.loc 1 40 58 is_stmt 0 view .LVU7
+	movl	32(%r15), %edi	# P_29(D)->node_depth,
+.LVL1:
+# blake2s-tree.c:40:     return node_depth ? (size_t)P->fanout * P->inner_len : P->leaf_len;
+	.loc 1 40 34 view .LVU8
+	movl	8(%rcx), %ecx	# P_29(D)->fanout, pretmp_84
+.LVL2:
+	.loc 1 40 34 view .LVU9
+.LBE16:
+.LBE15:
+# blake2s-tree.c:45: {
+	.loc 1 45 1 view .LVU10
+	movq	%r8, 40(%rsp)	# tmp159, %sfp
+# blake2s-tree.c:48:     struct blake2s_param Q = *P;
+	.loc 1 48 26 view .LVU11
+	movaps	%xmm0, 112(%rsp)	# tmp181, Q
+	movaps	%xmm1, 128(%rsp)	# tmp182, Q
+	movaps	%xmm2, 144(%rsp)	# tmp183, Q
+	movaps	%xmm3, 160(%rsp)	# tmp184, Q
+	.loc 1 49 5 is_stmt 1 view .LVU12
+.LBB19:
+.LBI15:
+	.loc 1 38 15 view .LVU13
+.LBB17:
+	.loc 1 40 5 view .LVU14
+# blake2s-tree.c:40:     return node_depth ? (size_t)P->fanout * P->inner_len : P->leaf_len;
+	.loc 1 40 58 is_stmt 0 view .LVU15
+	testl	%edi, %edi	#
+	je	.L2	#,
+# blake2s-tree.c:40:     return node_depth ? (size_t)P->fanout * P->inner_len : P->leaf_len;
+	.loc 1 40 46 view .LVU16
+	movl	36(%r15), %r12d	# P_29(D)->inner_len, P_29(D)->inner_len
+# blake2s-tree.c:40:     return node_depth ? (size_t)P->fanout * P->inner_len : P->leaf_len;
+	.loc 1 40 25 view .LVU17
+	movl	%ecx, %eax	# pretmp_84, pretmp_84
+# blake2s-tree.c:40:     return node_depth ? (size_t)P->fanout * P->inner_len : P->leaf_len;
+	.loc 1 40 58 view .LVU18
+	imulq	%rax, %r12	# pretmp_84, iftmp.2_56
+.L3:
+.LVL3:
+	.loc 1 40 58 view .LVU19
+.LBE17:
+.LBE19:
+	.loc 1 50 5 is_stmt 1 view .LVU20
+# blake2s-tree.c:50:     size_t n = len ? (len - 1) / span + 1 : 1;
+	.loc 1 50 43 is_stmt 0 view .LVU21
+	movl	$1, %edx	#, <retval>
+.LVL4:
+	.loc 1 50 43 view .LVU22
+	testq	%r10, %r10	# len
+	je	.L4	#,
+# blake2s-tree.c:50:     size_t n = len ? (len - 1) / span + 1 : 1;
+	.loc 1 50 27 discriminator 1 view .LVU23
+	leaq	-1(%r10), %rax	#, tmp132
+# blake2s-tree.c:50:     size_t n = len ? (len - 1) / span + 1 : 1;
+	.loc 1 50 32 discriminator 1 view .LVU24
+	xorl	%edx, %edx	# tmp135
+	divq	%r12	# iftmp.2_56
+# blake2s-tree.c:50:     size_t n = len ? (len - 1) / span + 1 : 1;
+	.loc 1 50 43 discriminator 1 view .LVU25
+	leaq	1(%rax), %rdx	#, <retval>
+.L4:
+.LVL5:
+	.loc 1 52 5 is_stmt 1 discriminator 4 view .LVU26
+.LBB20:
+.LBI20:
+	.loc 1 28 12 discriminator 4 view .LVU27
+.LBB21:
+	.loc 1 30 5 discriminator 4 view .LVU28
+# blake2s-tree.c:30:     if (P->fanout < 2 || P->depth < 2)
+	.loc 1 30 8 is_stmt 0 discriminator 4 view .LVU29
+	cmpl	$1, %ecx	#, pretmp_84
+	jbe	.L7	#,
+# blake2s-tree.c:30:     if (P->fanout < 2 || P->depth < 2)
+	.loc 1 30 23 view .LVU30
+	cmpl	$1, 12(%r15)	#, P_29(D)->depth
+	jbe	.L7	#,
+	.loc 1 32 5 is_stmt 1 view .LVU31
+# blake2s-tree.c:32:     if (!P->leaf_len || !P->inner_len)
+	.loc 1 32 8 is_stmt 0 view .LVU32
+	movl	16(%r15), %ecx	# P_29(D)->leaf_len,
+	testl	%ecx, %ecx	#
+	je	.L7	#,
+# blake2s-tree.c:32:     if (!P->leaf_len || !P->inner_len)
+	.loc 1 32 22 view .LVU33
+	movl	36(%r15), %eax	# P_29(D)->inner_len,
+	testl	%eax, %eax	#
+	je	.L7	#,
+	movq	%r12, %rax	# iftmp.2_56, _92
+	movq	%rsi, 72(%rsp)	# src, %sfp
+.LBE21:
+.LBE20:
+.LBB22:
+# blake2s-tree.c:54:     for (size_t i = 0; i < n; i += B2S_TREE_BATCH) {
+	.loc 1 54 17 view .LVU34
+	xorl	%r14d, %r14d	# i
+	salq	$6, %rax	#, _92
+.LBB23:
+.LBB24:
+.LBB25:
+# blake2s-tree.c:59:             Q.last_node = P->last_node && i + j == n - 1;
+	.loc 1 59 54 view .LVU35
+	movq	%r10, 88(%rsp)	# len, %sfp
+	movq	%rax, 104(%rsp)	# _92, %sfp
+	leaq	176(%rsp), %rax	#, ivtmp.23
+	movq	%rax, 80(%rsp)	# ivtmp.23, %sfp
+	leaq	112(%rsp), %rax	#, tmp210
+	movq	%rax, 48(%rsp)	# tmp210, %sfp
+	leaq	-1(%rdx), %rax	#, tmp153
+	movq	%rax, 64(%rsp)	# tmp153, %sfp
+	movq	%r15, %rax	# P, P
+	movq	%r14, %r15	# i, i
+.LVL6:
+	.loc 1 59 54 view .LVU36
+	movq	%rax, %r14	# P, P
+.LVL7:
+.L9:
+	.loc 1 59 54 view .LVU37
+.LBE25:
+.LBE24:
+	.loc 1 55 9 is_stmt 1 view .LVU38
+# blake2s-tree.c:55:         size_t k = n - i < B2S_TREE_BATCH ? n - i : B2S_TREE_BATCH;
+	.loc 1 55 22 is_stmt 0 view .LVU39
+	movq	%rdx, %rsi	# <retval>, k
+# blake2s-tree.c:55:         size_t k = n - i < B2S_TREE_BATCH ? n - i : B2S_TREE_BATCH;
+	.loc 1 55 16 view .LVU40
+	movl	$64, %eax	#, tmp161
+# blake2s-tree.c:55:         size_t k = n - i < B2S_TREE_BATCH ? n - i : B2S_TREE_BATCH;
+	.loc 1 55 22 view .LVU41
+	subq	%r15, %rsi	# i, k
+# blake2s-tree.c:55:         size_t k = n - i < B2S_TREE_BATCH ? n - i : B2S_TREE_BATCH;
+	.loc 1 55 16 view .LVU42
+	cmpq	%rax, %rsi	# tmp161, k
+	cmova	%rax, %rsi	# k,, tmp161, k
+.LVL8:
+	.loc 1 56 9 is_stmt 1 view .LVU43
+.LBB31:
+	.loc 1 56 14 view .LVU44
+	.loc 1 56 30 view .LVU45
+	cmpq	%r15, %rdx	# i, <retval>
+	je	.L12	#,
+	.loc 1 56 30 is_stmt 0 view .LVU46
+	movq	72(%rsp), %r9	# %sfp, ivtmp.24
+# blake2s-tree.c:56:         for (size_t j = 0; j < k; j++) {
+	.loc 1 56 21 view .LVU47
+	movq	%r12, %rax	# iftmp.2_56, iftmp.2_56
+	movq	%r14, %r8	# P, P
+	movq	%r15, %r12	# i, i
+.LVL9:
+	.loc 1 56 21 view .LVU48
+	movq	%rsi, 32(%rsp)	# k, %sfp
+	movq	80(%rsp), %rbx	# %sfp, ivtmp.23
+	xorl	%ebp, %ebp	# j
+	movq	%rax, %r15	# iftmp.2_56, iftmp.2_56
+.LVL10:
+	.loc 1 56 21 view .LVU49
+	movq	%rdx, 96(%rsp)	# <retval>, %sfp
+# blake2s-tree.c:56:         for (size_t j = 0; j < k; j++) {
+	.loc 1 56 30 view .LVU50
+	movq	88(%rsp), %r13	# %sfp, ivtmp.25
+	leaq	2224(%rsp), %rdi	#, ivtmp.22
+# blake2s-tree.c:56:         for (size_t j = 0; j < k; j++) {
+	.loc 1 56 21 view .LVU51
+	movq	%r9, %r14	# ivtmp.24, ivtmp.24
+	jmp	.L11	#
+.LVL11:
+	.p2align 4,,10
+	.p2align 3
+.L23:
+.LBB26:
+	.loc 1 62 13 is_stmt 1 discriminator 2 view .LVU52
+# blake2s-tree.c:62:             ctx[j].digest_len = P->inner_len;
+	.loc 1 62 34 is_stmt 0 discriminator 2 view .LVU53
+	movq	24(%rsp), %r8	# %sfp, P
+# blake2s-tree.c:62:             ctx[j].digest_len = P->inner_len;
+	.loc 1 62 31 discriminator 2 view .LVU54
+	movq	8(%rsp), %rdi	# %sfp, ivtmp.22
+# blake2s-tree.c:65:             job[j].len = len - at < span ? len - at : span;
+	.loc 1 65 53 discriminator 2 view .LVU55
+	cmpq	%r15, %r13	# iftmp.2_56, ivtmp.25
+	movq	%r15, %rdx	# iftmp.2_56, tmp144
+# blake2s-tree.c:66:             job[j].out = out + (i + j) * P->inner_len;
+	.loc 1 66 40 discriminator 2 view .LVU56
+	movq	16(%rsp), %r10	# %sfp, _5
+# blake2s-tree.c:65:             job[j].len = len - at < span ? len - at : span;
+	.loc 1 65 53 discriminator 2 view .LVU57
+	cmovbe	%r13, %rdx	# ivtmp.25,, tmp144
+# blake2s-tree.c:66:             job[j].out = out + (i + j) * P->inner_len;
+	.loc 1 66 30 discriminator 2 view .LVU58
+	movq	56(%rsp), %rcx	# %sfp, out
+.LBE26:
+# blake2s-tree.c:56:         for (size_t j = 0; j < k; j++) {
+	.loc 1 56 30 discriminator 2 view .LVU59
+	subq	%r15, %r13	# iftmp.2_56, ivtmp.25
+.LBB27:
+# blake2s-tree.c:62:             ctx[j].digest_len = P->inner_len;
+	.loc 1 62 34 discriminator 2 view .LVU60
+	movl	36(%r8), %eax	# P_29(D)->inner_len,
+# blake2s-tree.c:63:             job[j].ctx = &ctx[j];
+	.loc 1 63 24 discriminator 2 view .LVU61
+	movq	%rdi, (%rbx)	# ivtmp.22, MEM[(struct blake2s_ctx * *)_78]
+.LBE27:
+# blake2s-tree.c:56:         for (size_t j = 0; j < k; j++) {
+	.loc 1 56 36 discriminator 2 view .LVU62
+	addq	$1, %rbp	#, j
+.LVL12:
+# blake2s-tree.c:56:         for (size_t j = 0; j < k; j++) {
+	.loc 1 56 30 discriminator 2 view .LVU63
+	subq	$-128, %rdi	#, ivtmp.22
+.LBB28:
+# blake2s-tree.c:64:             job[j].src = (const u8 *)src + at;
+	.loc 1 64 24 discriminator 2 view .LVU64
+	movq	%r14, 8(%rbx)	# ivtmp.24, MEM[(const u8 * *)_78 + 8B]
+.LBE28:
+# blake2s-tree.c:56:         for (size_t j = 0; j < k; j++) {
+	.loc 1 56 30 discriminator 2 view .LVU65
+	addq	$32, %rbx	#, ivtmp.23
+	addq	%r15, %r14	# iftmp.2_56, ivtmp.24
+.LVL13:
+.LBB29:
+# blake2s-tree.c:62:             ctx[j].digest_len = P->inner_len;
+	.loc 1 62 31 discriminator 2 view .LVU66
+	movl	%eax, -12(%rdi)	# _13, MEM[(unsigned int *)_11 + 116B]
+	.loc 1 63 13 is_stmt 1 discriminator 2 view .LVU67
+	.loc 1 64 13 discriminator 2 view .LVU68
+	.loc 1 65 13 discriminator 2 view .LVU69
+# blake2s-tree.c:66:             job[j].out = out + (i + j) * P->inner_len;
+	.loc 1 66 40 is_stmt 0 discriminator 2 view .LVU70
+	imulq	%r10, %rax	# _5, tmp146
+# blake2s-tree.c:65:             job[j].len = len - at < span ? len - at : span;
+	.loc 1 65 24 discriminator 2 view .LVU71
+	movq	%rdx, -16(%rbx)	# tmp144, MEM[(long unsigned int *)_78 + 16B]
+	.loc 1 66 13 is_stmt 1 discriminator 2 view .LVU72
+# blake2s-tree.c:66:             job[j].out = out + (i + j) * P->inner_len;
+	.loc 1 66 30 is_stmt 0 discriminator 2 view .LVU73
+	addq	%rcx, %rax	# out, tmp147
+	movq	%rax, -8(%rbx)	# tmp147, MEM[(unsigned char * *)_78 + 24B]
+.LBE29:
+	.loc 1 56 36 is_stmt 1 discriminator 2 view .LVU74
+.LVL14:
+	.loc 1 56 30 discriminator 2 view .LVU75
+	cmpq	%rbp, 32(%rsp)	# j, %sfp
+	je	.L22	#,
+.LVL15:
+.L11:
+.LBB30:
+	.loc 1 57 13 view .LVU76
+# blake2s-tree.c:58:             Q.node_offset = P->node_offset + i + j;
+	.loc 1 58 44 is_stmt 0 view .LVU77
+	movq	24(%r8), %rax	# P_29(D)->node_offset, tmp137
+# blake2s-tree.c:57:             size_t at = (i + j) * span;
+	.loc 1 57 28 view .LVU78
+	leaq	(%r12,%rbp), %r10	#, _5
+.LVL16:
+	.loc 1 58 13 is_stmt 1 view .LVU79
+# blake2s-tree.c:58:             Q.node_offset = P->node_offset + i + j;
+	.loc 1 58 44 is_stmt 0 view .LVU80
+	addq	%r12, %rax	# i, tmp137
+# blake2s-tree.c:58:             Q.node_offset = P->node_offset + i + j;
+	.loc 1 58 48 view .LVU81
+	addq	%rbp, %rax	# j, tmp139
+	movq	%rax, 136(%rsp)	# tmp139, Q.node_offset
+	.loc 1 59 13 is_stmt 1 view .LVU82
+# blake2s-tree.c:59:             Q.last_node = P->last_node && i + j == n - 1;
+	.loc 1 59 28 is_stmt 0 view .LVU83
+	movl	56(%r8), %eax	# P_29(D)->last_node, _9
+# blake2s-tree.c:59:             Q.last_node = P->last_node && i + j == n - 1;
+	.loc 1 59 40 view .LVU84
+	testl	%eax, %eax	# _9
+	je	.L10	#,
+# blake2s-tree.c:59:             Q.last_node = P->last_node && i + j == n - 1;
+	.loc 1 59 40 discriminator 1 view .LVU85
+	xorl	%eax, %eax	# _9
+	cmpq	%r10, 64(%rsp)	# _5, %sfp
+	sete	%al	#, _9
+.L10:
+# blake2s-tree.c:60:             if (blake2s_init_param(&ctx[j], &Q, key) < 0)
+	.loc 1 60 17 discriminator 6 view .LVU86
+	movq	40(%rsp), %rdx	# %sfp,
+	movq	48(%rsp), %rsi	# %sfp,
+	movq	%r8, 24(%rsp)	# P, %sfp
+	movq	%r10, 16(%rsp)	# _5, %sfp
+# blake2s-tree.c:59:             Q.last_node = P->last_node && i + j == n - 1;
+	.loc 1 59 25 discriminator 6 view .LVU87
+	movl	%eax, 168(%rsp)	# _9, Q.last_node
+	.loc 1 60 13 is_stmt 1 discriminator 6 view .LVU88
+# blake2s-tree.c:60:             if (blake2s_init_param(&ctx[j], &Q, key) < 0)
+	.loc 1 60 17 is_stmt 0 discriminator 6 view .LVU89
+	movq	%rdi, 8(%rsp)	# ivtmp.22, %sfp
+	call	blake2s_init_param@PLT	#
+.LVL17:
+# blake2s-tree.c:60:             if (blake2s_init_param(&ctx[j], &Q, key) < 0)
+	.loc 1 60 16 discriminator 6 view .LVU90
+	testl	%eax, %eax	# tmp160
+	jns	.L23	#,
+.LVL18:
+.L7:
+	.loc 1 60 16 discriminator 6 view .LVU91
+.LBE30:
+.LBE31:
+.LBE23:
+.LBE22:
+# blake2s-tree.c:53:         return 0;
+	.loc 1 53 16 view .LVU92
+	xorl	%edx, %edx	# <retval>
+.L1:
+# blake2s-tree.c:71: }
+	.loc 1 71 1 view .LVU93
+	addq	$10424, %rsp	#,
+	.cfi_remember_state
+	.cfi_def_cfa_offset 56
+	movq	%rdx, %rax	# <retval>,
+	popq	%rbx	#
+	.cfi_def_cfa_offset 48
+	popq	%rbp	#
+	.cfi_def_cfa_offset 40
+	popq	%r12	#
+	.cfi_def_cfa_offset 32
+	popq	%r13	#
+	.cfi_def_cfa_offset 24
+	popq	%r14	#
+	.cfi_def_cfa_offset 16
+	popq	%r15	#
+	.cfi_def_cfa_offset 8
+	ret	
+.LVL19:
+	.p2align 4,,10
+	.p2align 3
+.L22:
+	.cfi_restore_state
+.LBB35:
+.LBB33:
+.LBB32:
+	.loc 1 71 1 view .LVU94
+	movq	%r15, %rax	# iftmp.2_56, iftmp.2_56
+	movq	32(%rsp), %rsi	# %sfp, k
+	movq	96(%rsp), %rdx	# %sfp, <retval>
+	movq	%r12, %r15	# i, i
+.LVL20:
+	.loc 1 71 1 view .LVU95
+	movq	%r8, %r14	# P, P
+	movq	%rax, %r12	# iftmp.2_56, iftmp.2_56
+.LVL21:
+.L12:
+	.loc 1 71 1 view .LVU96
+.LBE32:
+# blake2s-tree.c:68:         blake2s_lanes_run(job, k);
+	.loc 1 68 9 view .LVU97
+	movq	80(%rsp), %rdi	# %sfp,
+	movq	%rdx, 8(%rsp)	# <retval>, %sfp
+	.loc 1 68 9 is_stmt 1 view .LVU98
+.LBE33:
+# blake2s-tree.c:54:     for (size_t i = 0; i < n; i += B2S_TREE_BATCH) {
+	.loc 1 54 33 is_stmt 0 view .LVU99
+	addq	$64, %r15	#, i
+.LVL22:
+.LBB34:
+# blake2s-tree.c:68:         blake2s_lanes_run(job, k);
+	.loc 1 68 9 view .LVU100
+	call	blake2s_lanes_run@PLT	#
+.LVL23:
+.LBE34:
+	.loc 1 54 33 is_stmt 1 view .LVU101
+	.loc 1 54 26 view .LVU102
+	movq	8(%rsp), %rdx	# %sfp, <retval>
+	movq	104(%rsp), %rcx	# %sfp, _92
+	addq	%rcx, 72(%rsp)	# _92, %sfp
+	subq	%rcx, 88(%rsp)	# _92, %sfp
+	cmpq	%rdx, %r15	# <retval>, i
+	jb	.L9	#,
+	jmp	.L1	#
+.LVL24:
+	.p2align 4,,10
+	.p2align 3
+.L2:
+	.loc 1 54 26 is_stmt 0 view .LVU103
+.LBE35:
+.LBB36:
+.LBB18:
+# blake2s-tree.c:40:     return node_depth ? (size_t)P->fanout * P->inner_len : P->leaf_len;
+	.loc 1 40 58 view .LVU104
+	movl	16(%r15), %r12d	# P_29(D)->leaf_len, iftmp.2_56
+	jmp	.L3	#
+.LBE18:
+.LBE36:
+	.cfi_endproc
+.LFE24:
+	.size	blake2s_tree_nodes, .-blake2s_tree_nodes
+	.p2align 4
+	.type	btree_task, @function
+btree_task:
+.LVL25:
+.LFB25:
+	.loc 1 74 1 is_stmt 1 view -0
+	.cfi_startproc
+	.loc 1 75 5 view .LVU106
+	.loc 1 76 5 view .LVU107
+	.loc 1 77 5 view .LVU108
+# blake2s-tree.c:74: {
+	.loc 1 74 1 is_stmt 0 view .LVU109
+	subq	$72, %rsp	#,
+	.cfi_def_cfa_offset 80
+# blake2s-tree.c:74: {
+	.loc 1 74 1 view .LVU110
+	movq	%rsi, %rcx	# i, tmp131
+# blake2s-tree.c:77:     size_t first = i * J->per;
+	.loc 1 77 25 view .LVU111
+	movq	56(%rdi), %rsi	# MEM[(struct btree_level *)arg_23(D)].per, _2
+.LVL26:
+# blake2s-tree.c:76:     struct blake2s_param Q = *J->P;
+	.loc 1 76 26 view .LVU112
+	movq	24(%rdi), %rdx	# MEM[(struct btree_level *)arg_23(D)].P, MEM[(struct btree_level *)arg_23(D)].P
+# blake2s-tree.c:78:     size_t k = J->n - first < J->per ? J->n - first : J->per;
+	.loc 1 78 17 view .LVU113
+	movq	48(%rdi), %r9	# MEM[(struct btree_level *)arg_23(D)].n, _3
+# blake2s-tree.c:74: {
+	.loc 1 74 1 view .LVU114
+	movq	%rdi, %rax	# tmp130, arg
+# blake2s-tree.c:79:     size_t at = first * J->span;
+	.loc 1 79 26 view .LVU115
+	movq	40(%rdi), %rdi	# MEM[(struct btree_level *)arg_23(D)].span, _5
+.LVL27:
+# blake2s-tree.c:77:     size_t first = i * J->per;
+	.loc 1 77 12 view .LVU116
+	imulq	%rsi, %rcx	# _2, first
+.LVL28:
+	.loc 1 78 5 is_stmt 1 view .LVU117
+# blake2s-tree.c:76:     struct blake2s_param Q = *J->P;
+	.loc 1 76 26 is_stmt 0 view .LVU118
+	movdqu	(%rdx), %xmm0	# *_1, tmp133
+	movdqu	16(%rdx), %xmm1	# *_1, tmp134
+	movdqu	32(%rdx), %xmm2	# *_1, tmp135
+	movdqu	48(%rdx), %xmm3	# *_1, tmp136
+# blake2s-tree.c:78:     size_t k = J->n - first < J->per ? J->n - first : J->per;
+	.loc 1 78 21 view .LVU119
+	movq	%r9, %rdx	# _3, tmp114
+# blake2s-tree.c:76:     struct blake2s_param Q = *J->P;
+	.loc 1 76 26 view .LVU120
+	movaps	%xmm1, 16(%rsp)	# tmp134, Q
+# blake2s-tree.c:78:     size_t k = J->n - first < J->per ? J->n - first : J->per;
+	.loc 1 78 21 view .LVU121
+	subq	%rcx, %rdx	# first, tmp114
+# blake2s-tree.c:76:     struct blake2s_param Q = *J->P;
+	.loc 1 76 26 view .LVU122
+	movaps	%xmm3, 48(%rsp)	# tmp136, Q
+# blake2s-tree.c:78:     size_t k = J->n - first < J->per ? J->n - first : J->per;
+	.loc 1 78 12 view .LVU123
+	cmpq	%rsi, %rdx	# _2, tmp114
+# blake2s-tree.c:76:     struct blake2s_param Q = *J->P;
+	.loc 1 76 26 view .LVU124
+	movaps	%xmm0, (%rsp)	# tmp133, Q
+# blake2s-tree.c:78:     size_t k = J->n - first < J->per ? J->n - first : J->per;
+	.loc 1 78 12 view .LVU125
+	cmovbe	%rdx, %rsi	# tmp114,, _2
+# blake2s-tree.c:82:     Q.last_node = Q.last_node && first + k == J->n;
+	.loc 1 82 20 view .LVU126
+	movl	56(%rsp), %edx	# Q.last_node, _8
+# blake2s-tree.c:81:     Q.node_offset += first;
+	.loc 1 81 19 view .LVU127
+	addq	%rcx, 24(%rsp)	# first, Q.node_offset
+# blake2s-tree.c:76:     struct blake2s_param Q = *J->P;
+	.loc 1 76 26 view .LVU128
+	movaps	%xmm2, 32(%rsp)	# tmp135, Q
+# blake2s-tree.c:78:     size_t k = J->n - first < J->per ? J->n - first : J->per;
+	.loc 1 78 12 view .LVU129
+	movq	%rsi, %r8	# _2, k
+.LVL29:
+	.loc 1 79 5 is_stmt 1 view .LVU130
+# blake2s-tree.c:79:     size_t at = first * J->span;
+	.loc 1 79 12 is_stmt 0 view .LVU131
+	movq	%rdi, %rsi	# _5, at
+.LVL30:
+	.loc 1 79 12 view .LVU132
+	imulq	%rcx, %rsi	# first, at
+.LVL31:
+	.loc 1 81 5 is_stmt 1 view .LVU133
+	.loc 1 82 5 view .LVU134
+# blake2s-tree.c:82:     Q.last_node = Q.last_node && first + k == J->n;
+	.loc 1 82 31 is_stmt 0 view .LVU135
+	testl	%edx, %edx	# _8
+	je	.L25	#,
+# blake2s-tree.c:82:     Q.last_node = Q.last_node && first + k == J->n;
+	.loc 1 82 40 discriminator 1 view .LVU136
+	leaq	(%rcx,%r8), %rdx	#, tmp115
+# blake2s-tree.c:82:     Q.last_node = Q.last_node && first + k == J->n;
+	.loc 1 82 31 discriminator 1 view .LVU137
+	cmpq	%r9, %rdx	# _3, tmp115
+	sete	%dl	#, _8
+	movzbl	%dl, %edx	# _8, _8
+.L25:
+# blake2s-tree.c:84:                        J->len - at < k * J->span ? J->len - at : k * J->span,
+	.loc 1 84 40 discriminator 6 view .LVU138
+	imulq	%r8, %rdi	# k, tmp123
+# blake2s-tree.c:82:     Q.last_node = Q.last_node && first + k == J->n;
+	.loc 1 82 17 discriminator 6 view .LVU139
+	movl	%edx, 56(%rsp)	# _8, Q.last_node
+	.loc 1 83 5 is_stmt 1 discriminator 6 view .LVU140
+# blake2s-tree.c:84:                        J->len - at < k * J->span ? J->len - at : k * J->span,
+	.loc 1 84 31 is_stmt 0 discriminator 6 view .LVU141
+	movq	16(%rax), %rdx	# MEM[(struct btree_level *)arg_23(D)].len, tmp121
+# blake2s-tree.c:83:     blake2s_tree_nodes(J->out + first * Q.inner_len, J->src + at,
+	.loc 1 83 5 discriminator 6 view .LVU142
+	movq	%rsp, %r9	#, tmp119
+	movq	32(%rax), %r8	# MEM[(struct btree_level *)arg_23(D)].key,
+.LVL32:
+# blake2s-tree.c:84:                        J->len - at < k * J->span ? J->len - at : k * J->span,
+	.loc 1 84 31 discriminator 6 view .LVU143
+	subq	%rsi, %rdx	# at, tmp121
+# blake2s-tree.c:83:     blake2s_tree_nodes(J->out + first * Q.inner_len, J->src + at,
+	.loc 1 83 5 discriminator 6 view .LVU144
+	cmpq	%rdi, %rdx	# tmp123, tmp121
+	cmova	%rdi, %rdx	# tmp121,, tmp123, tmp120
+# blake2s-tree.c:83:     blake2s_tree_nodes(J->out + first * Q.inner_len, J->src + at,
+	.loc 1 83 42 discriminator 6 view .LVU145
+	movl	36(%rsp), %edi	# Q.inner_len, Q.inner_len
+# blake2s-tree.c:83:     blake2s_tree_nodes(J->out + first * Q.inner_len, J->src + at,
+	.loc 1 83 61 discriminator 6 view .LVU146
+	addq	8(%rax), %rsi	# MEM[(struct btree_level *)arg_23(D)].src, tmp124
+.LVL33:
+# blake2s-tree.c:83:     blake2s_tree_nodes(J->out + first * Q.inner_len, J->src + at,
+	.loc 1 83 39 discriminator 6 view .LVU147
+	imulq	%rcx, %rdi	# first, tmp127
+# blake2s-tree.c:83:     blake2s_tree_nodes(J->out + first * Q.inner_len, J->src + at,
+	.loc 1 83 5 discriminator 6 view .LVU148
+	movq	%r9, %rcx	# tmp119,
+.LVL34:
+	.loc 1 83 5 discriminator 6 view .LVU149
+	addq	(%rax), %rdi	# MEM[(struct btree_level *)arg_23(D)].out, tmp128
+	call	blake2s_tree_nodes	#
+.LVL35:
+# blake2s-tree.c:86: }
+	.loc 1 86 1 discriminator 6 view .LVU150
+	addq	$72, %rsp	#,
+	.cfi_def_cfa_offset 8
+	ret	
+	.cfi_endproc
+.LFE25:
+	.size	btree_task, .-btree_task
+	.p2align 4
+	.globl	blake2s_tree_parallel
+	.type	blake2s_tree_parallel, @function
+blake2s_tree_parallel:
+.LVL36:
+.LFB28:
+	.loc 1 125 1 is_stmt 1 view -0
+	.cfi_startproc
+	.loc 1 126 5 view .LVU152
+# blake2s-tree.c:125: {
+	.loc 1 125 1 is_stmt 0 view .LVU153
+	pushq	%r15	#
+	.cfi_def_cfa_offset 16
+	.cfi_offset 15, -16
+	pushq	%r14	#
+	.cfi_def_cfa_offset 24
+	.cfi_offset 14, -24
+	movq	%rsi, %r14	# tmp203, src
+	pushq	%r13	#
+	.cfi_def_cfa_offset 32
+	.cfi_offset 13, -32
+	movq	%rcx, %r13	# tmp205, P
+	pushq	%r12	#
+	.cfi_def_cfa_offset 40
+	.cfi_offset 12, -40
+	pushq	%rbp	#
+	.cfi_def_cfa_offset 48
+	.cfi_offset 6, -48
+	movq	%r8, %rbp	# tmp206, key
+	pushq	%rbx	#
+	.cfi_def_cfa_offset 56
+	.cfi_offset 3, -56
+	movq	%rdx, %rbx	# tmp204, len
+	subq	$296, %rsp	#,
+	.cfi_def_cfa_offset 352
+# blake2s-tree.c:126:     struct blake2s_param Q = *P;
+	.loc 1 126 26 view .LVU154
+	movdqu	(%rcx), %xmm0	# *P_36(D), tmp216
+	movdqu	16(%rcx), %xmm1	# *P_36(D), tmp217
+	movdqu	32(%rcx), %xmm2	# *P_36(D), tmp218
+	movdqu	48(%rcx), %xmm3	# *P_36(D), tmp219
+# blake2s-tree.c:125: {
+	.loc 1 125 1 view .LVU155
+	movq	%rdi, 24(%rsp)	# tmp202, %sfp
+	movl	%r9d, 12(%rsp)	# tmp207, %sfp
+# blake2s-tree.c:126:     struct blake2s_param Q = *P;
+	.loc 1 126 26 view .LVU156
+	movaps	%xmm0, 32(%rsp)	# tmp216, Q
+	movaps	%xmm1, 48(%rsp)	# tmp217, Q
+	movaps	%xmm2, 64(%rsp)	# tmp218, Q
+	movaps	%xmm3, 80(%rsp)	# tmp219, Q
+	.loc 1 127 5 is_stmt 1 view .LVU157
+	.loc 1 128 5 view .LVU158
+# blake2s-tree.c:128:     size_t n = len ? (len - 1) / P->leaf_len + 1 : 1;
+	.loc 1 128 50 is_stmt 0 view .LVU159
+	testq	%rdx, %rdx	# len
+	je	.L47	#,
+# blake2s-tree.c:128:     size_t n = len ? (len - 1) / P->leaf_len + 1 : 1;
+	.loc 1 128 35 discriminator 1 view .LVU160
+	movl	16(%rcx), %ecx	# P_36(D)->leaf_len, P_36(D)->leaf_len
+.LVL37:
+# blake2s-tree.c:128:     size_t n = len ? (len - 1) / P->leaf_len + 1 : 1;
+	.loc 1 128 27 discriminator 1 view .LVU161
+	leaq	-1(%rdx), %rax	#, tmp144
+# blake2s-tree.c:128:     size_t n = len ? (len - 1) / P->leaf_len + 1 : 1;
+	.loc 1 128 32 discriminator 1 view .LVU162
+	xorl	%edx, %edx	# tmp147
+.LVL38:
+	.loc 1 128 32 discriminator 1 view .LVU163
+	divq	%rcx	# P_36(D)->leaf_len
+	movq	%rax, %r12	# tmp144, _4
+# blake2s-tree.c:128:     size_t n = len ? (len - 1) / P->leaf_len + 1 : 1;
+	.loc 1 128 50 discriminator 1 view .LVU164
+	leaq	1(%rax), %rdi	#, iftmp.3_29
+.LVL39:
+.L31:
+	.loc 1 129 5 is_stmt 1 discriminator 4 view .LVU165
+	.loc 1 130 5 discriminator 4 view .LVU166
+	.loc 1 132 5 discriminator 4 view .LVU167
+.LBB44:
+.LBI44:
+	.loc 1 28 12 discriminator 4 view .LVU168
+.LBB45:
+	.loc 1 30 5 discriminator 4 view .LVU169
+# blake2s-tree.c:30:     if (P->fanout < 2 || P->depth < 2)
+	.loc 1 30 10 is_stmt 0 discriminator 4 view .LVU170
+	movl	8(%r13), %r15d	# P_36(D)->fanout,
+# blake2s-tree.c:30:     if (P->fanout < 2 || P->depth < 2)
+	.loc 1 30 8 discriminator 4 view .LVU171
+	cmpl	$1, %r15d	#, _40
+	jbe	.L51	#,
+# blake2s-tree.c:30:     if (P->fanout < 2 || P->depth < 2)
+	.loc 1 30 23 view .LVU172
+	cmpl	$1, 12(%r13)	#, P_36(D)->depth
+	jbe	.L51	#,
+	.loc 1 32 5 is_stmt 1 view .LVU173
+# blake2s-tree.c:32:     if (!P->leaf_len || !P->inner_len)
+	.loc 1 32 8 is_stmt 0 view .LVU174
+	movl	16(%r13), %eax	# P_36(D)->leaf_len,
+	testl	%eax, %eax	#
+	je	.L51	#,
+# blake2s-tree.c:32:     if (!P->leaf_len || !P->inner_len)
+	.loc 1 32 27 view .LVU175
+	movl	36(%r13), %ecx	# P_36(D)->inner_len,
+# blake2s-tree.c:32:     if (!P->leaf_len || !P->inner_len)
+	.loc 1 32 22 view .LVU176
+	testl	%ecx, %ecx	# _66
+	je	.L51	#,
+.LVL40:
+	.loc 1 32 22 view .LVU177
+.LBE45:
+.LBE44:
+	.loc 1 134 5 is_stmt 1 view .LVU178
+# blake2s-tree.c:134:     a = malloc(n * P->inner_len);
+	.loc 1 134 9 is_stmt 0 view .LVU179
+	imulq	%rcx, %rdi	# _6, tmp148
+.LVL41:
+	.loc 1 134 9 view .LVU180
+	movq	%rcx, 16(%rsp)	# _6, %sfp
+	call	malloc@PLT	#
+.LVL42:
+	.loc 1 135 5 is_stmt 1 view .LVU181
+# blake2s-tree.c:135:     b = malloc(((n - 1) / P->fanout + 1) * P->inner_len);
+	.loc 1 135 25 is_stmt 0 view .LVU182
+	xorl	%edx, %edx	# tmp153
+# blake2s-tree.c:135:     b = malloc(((n - 1) / P->fanout + 1) * P->inner_len);
+	.loc 1 135 9 view .LVU183
+	movq	16(%rsp), %rcx	# %sfp, _6
+# blake2s-tree.c:134:     a = malloc(n * P->inner_len);
+	.loc 1 134 9 view .LVU184
+	movq	%rax, (%rsp)	# tmp208, %sfp
+.LVL43:
+# blake2s-tree.c:135:     b = malloc(((n - 1) / P->fanout + 1) * P->inner_len);
+	.loc 1 135 25 view .LVU185
+	movq	%r12, %rax	# _4, _4
+	divq	%r15	# _40
+# blake2s-tree.c:135:     b = malloc(((n - 1) / P->fanout + 1) * P->inner_len);
+	.loc 1 135 37 view .LVU186
+	leaq	1(%rax), %rdi	#, tmp154
+# blake2s-tree.c:135:     b = malloc(((n - 1) / P->fanout + 1) * P->inner_len);
+	.loc 1 135 9 view .LVU187
+	imulq	%rcx, %rdi	# _6, tmp155
+	call	malloc@PLT	#
+.LVL44:
+# blake2s-tree.c:136:     if (!a || !b)
+	.loc 1 136 8 view .LVU188
+	cmpq	$0, (%rsp)	#, %sfp
+# blake2s-tree.c:135:     b = malloc(((n - 1) / P->fanout + 1) * P->inner_len);
+	.loc 1 135 9 view .LVU189
+	movq	%rax, 16(%rsp)	# b, %sfp
+.LVL45:
+	.loc 1 136 5 is_stmt 1 view .LVU190
+# blake2s-tree.c:136:     if (!a || !b)
+	.loc 1 136 8 is_stmt 0 view .LVU191
+	je	.L35	#,
+	testq	%rax, %rax	# b
+	je	.L35	#,
+	.loc 1 139 5 is_stmt 1 view .LVU192
+# blake2s-tree.c:139:     Q.node_offset = 0;
+	.loc 1 139 19 is_stmt 0 view .LVU193
+	movq	$0, 56(%rsp)	#, Q.node_offset
+	.loc 1 140 5 is_stmt 1 view .LVU194
+# blake2s-tree.c:142:     for (Q.node_depth = 0; Q.node_depth < P->depth - 1; Q.node_depth++) {
+	.loc 1 142 29 is_stmt 0 view .LVU195
+	xorl	%eax, %eax	# _21
+.LVL46:
+	.loc 1 142 29 view .LVU196
+	leaq	32(%rsp), %r12	#, tmp200
+# blake2s-tree.c:140:     Q.last_node = 1;
+	.loc 1 140 17 view .LVU197
+	movl	$1, 88(%rsp)	#, Q.last_node
+	.loc 1 142 5 is_stmt 1 view .LVU198
+# blake2s-tree.c:142:     for (Q.node_depth = 0; Q.node_depth < P->depth - 1; Q.node_depth++) {
+	.loc 1 142 23 is_stmt 0 view .LVU199
+	movl	$0, 64(%rsp)	#, Q.node_depth
+	.loc 1 142 41 is_stmt 1 view .LVU200
+	jmp	.L46	#
+.LVL47:
+	.p2align 4,,10
+	.p2align 3
+.L59:
+.LBB46:
+	.loc 1 144 9 discriminator 4 view .LVU201
+.LBB47:
+.LBI47:
+	.loc 1 89 15 discriminator 4 view .LVU202
+.LBB48:
+	.loc 1 93 5 discriminator 4 view .LVU203
+	.loc 1 94 5 discriminator 4 view .LVU204
+	.loc 1 96 5 discriminator 4 view .LVU205
+.LBB49:
+.LBI49:
+	.loc 1 38 15 discriminator 4 view .LVU206
+.LBB50:
+	.loc 1 40 5 discriminator 4 view .LVU207
+.LBE50:
+.LBE49:
+.LBE48:
+.LBE47:
+# blake2s-tree.c:143:         unsigned char *dst = (Q.node_depth & 1) ? b : a;
+	.loc 1 143 53 is_stmt 0 discriminator 4 view .LVU208
+	movq	(%rsp), %r15	# %sfp, iftmp.4_56
+.LBB58:
+.LBB55:
+.LBB53:
+.LBB51:
+# blake2s-tree.c:40:     return node_depth ? (size_t)P->fanout * P->inner_len : P->leaf_len;
+	.loc 1 40 58 discriminator 4 view .LVU209
+	testl	%eax, %eax	# _21
+	jne	.L36	#,
+.LVL48:
+# blake2s-tree.c:40:     return node_depth ? (size_t)P->fanout * P->inner_len : P->leaf_len;
+	.loc 1 40 58 view .LVU210
+	movl	48(%rsp), %ecx	# Q.leaf_len, iftmp.2_72
+.LBE51:
+.LBE53:
+.LBE55:
+.LBE58:
+# blake2s-tree.c:143:         unsigned char *dst = (Q.node_depth & 1) ? b : a;
+	.loc 1 143 53 view .LVU211
+	movq	(%rsp), %r15	# %sfp, iftmp.4_56
+.LVL49:
+.LBB59:
+.LBB56:
+# blake2s-tree.c:96:     J.span = btree_span(P, P->node_depth);
+	.loc 1 96 12 view .LVU212
+	movq	%rcx, 136(%rsp)	# iftmp.2_72, J.span
+	.loc 1 97 5 is_stmt 1 view .LVU213
+# blake2s-tree.c:97:     J.n = len ? (len - 1) / J.span + 1 : 1;
+	.loc 1 97 40 is_stmt 0 view .LVU214
+	testq	%rbx, %rbx	# len
+	je	.L39	#,
+.LVL50:
+.L60:
+# blake2s-tree.c:97:     J.n = len ? (len - 1) / J.span + 1 : 1;
+	.loc 1 97 27 view .LVU215
+	xorl	%edx, %edx	# tmp167
+# blake2s-tree.c:97:     J.n = len ? (len - 1) / J.span + 1 : 1;
+	.loc 1 97 22 view .LVU216
+	leaq	-1(%rbx), %rax	#, tmp164
+# blake2s-tree.c:97:     J.n = len ? (len - 1) / J.span + 1 : 1;
+	.loc 1 97 27 view .LVU217
+	divq	%rcx	# iftmp.2_72
+# blake2s-tree.c:98:     J.per = (B2S_TREE_TASK - 1) / J.span + 1;
+	.loc 1 98 31 view .LVU218
+	xorl	%edx, %edx	# tmp170
+# blake2s-tree.c:97:     J.n = len ? (len - 1) / J.span + 1 : 1;
+	.loc 1 97 40 view .LVU219
+	leaq	1(%rax), %rsi	#, iftmp.5_78
+# blake2s-tree.c:98:     J.per = (B2S_TREE_TASK - 1) / J.span + 1;
+	.loc 1 98 31 view .LVU220
+	movl	$262143, %eax	#, tmp171
+	divq	%rcx	# iftmp.2_72
+# blake2s-tree.c:97:     J.n = len ? (len - 1) / J.span + 1 : 1;
+	.loc 1 97 9 view .LVU221
+	movq	%rsi, 144(%rsp)	# iftmp.5_78, J.n
+	.loc 1 98 5 is_stmt 1 view .LVU222
+	.loc 1 99 5 view .LVU223
+# blake2s-tree.c:99:     if (J.per < B2S_TREE_BATCH)
+	.loc 1 99 8 is_stmt 0 view .LVU224
+	movl	$64, %edx	#, tmp214
+# blake2s-tree.c:98:     J.per = (B2S_TREE_TASK - 1) / J.span + 1;
+	.loc 1 98 40 view .LVU225
+	addq	$1, %rax	#, _9
+# blake2s-tree.c:99:     if (J.per < B2S_TREE_BATCH)
+	.loc 1 99 8 view .LVU226
+	cmpq	%rdx, %rax	# tmp214, _9
+	cmovb	%rdx, %rax	# _9,, tmp214, _9
+# blake2s-tree.c:101:     if (nthreads <= 1 || J.n <= J.per)
+	.loc 1 101 8 view .LVU227
+	cmpl	$1, 12(%rsp)	#, %sfp
+	movq	%rax, 152(%rsp)	# _9, MEM <struct btree_level> [(void *)&J].per
+	.loc 1 101 5 is_stmt 1 view .LVU228
+# blake2s-tree.c:101:     if (nthreads <= 1 || J.n <= J.per)
+	.loc 1 101 8 is_stmt 0 view .LVU229
+	jbe	.L40	#,
+# blake2s-tree.c:101:     if (nthreads <= 1 || J.n <= J.per)
+	.loc 1 101 23 view .LVU230
+	cmpq	%rsi, %rax	# iftmp.5_78, _9
+	jnb	.L40	#,
+	.loc 1 104 5 is_stmt 1 view .LVU231
+# blake2s-tree.c:104:     if (blake2s_init_param(&ctx, P, key) < 0)
+	.loc 1 104 9 is_stmt 0 view .LVU232
+	leaq	160(%rsp), %rdi	#, tmp174
+	movq	%rbp, %rdx	# key,
+	movq	%r12, %rsi	# tmp200,
+	call	blake2s_init_param@PLT	#
+.LVL51:
+# blake2s-tree.c:104:     if (blake2s_init_param(&ctx, P, key) < 0)
+	.loc 1 104 8 view .LVU233
+	testl	%eax, %eax	# tmp211
+	js	.L35	#,
+	.loc 1 107 5 is_stmt 1 view .LVU234
+# blake2s-tree.c:112:     blake2s_pool_run(nthreads, (J.n - 1) / J.per + 1, btree_task, &J);
+	.loc 1 112 42 is_stmt 0 view .LVU235
+	xorl	%edx, %edx	# tmp181
+# blake2s-tree.c:112:     blake2s_pool_run(nthreads, (J.n - 1) / J.per + 1, btree_task, &J);
+	.loc 1 112 5 view .LVU236
+	movl	12(%rsp), %edi	# %sfp,
+	leaq	96(%rsp), %rcx	#, tmp176
+# blake2s-tree.c:107:     J.out = out;
+	.loc 1 107 11 view .LVU237
+	movq	%r15, 96(%rsp)	# iftmp.4_56, J.out
+	.loc 1 108 5 is_stmt 1 view .LVU238
+# blake2s-tree.c:112:     blake2s_pool_run(nthreads, (J.n - 1) / J.per + 1, btree_task, &J);
+	.loc 1 112 37 is_stmt 0 view .LVU239
+	movq	144(%rsp), %rax	# J.n, tmp225
+# blake2s-tree.c:108:     J.src = src;
+	.loc 1 108 11 view .LVU240
+	movq	%r14, 104(%rsp)	# src, J.src
+	.loc 1 109 5 is_stmt 1 view .LVU241
+# blake2s-tree.c:109:     J.len = len;
+	.loc 1 109 11 is_stmt 0 view .LVU242
+	movq	%rbx, 112(%rsp)	# len, J.len
+	.loc 1 110 5 is_stmt 1 view .LVU243
+# blake2s-tree.c:112:     blake2s_pool_run(nthreads, (J.n - 1) / J.per + 1, btree_task, &J);
+	.loc 1 112 37 is_stmt 0 view .LVU244
+	subq	$1, %rax	#, tmp177
+# blake2s-tree.c:110:     J.P = P;
+	.loc 1 110 9 view .LVU245
+	movq	%r12, 120(%rsp)	# tmp200, J.P
+	.loc 1 111 5 is_stmt 1 view .LVU246
+# blake2s-tree.c:112:     blake2s_pool_run(nthreads, (J.n - 1) / J.per + 1, btree_task, &J);
+	.loc 1 112 42 is_stmt 0 view .LVU247
+	divq	152(%rsp)	# J.per
+# blake2s-tree.c:111:     J.key = key;
+	.loc 1 111 11 view .LVU248
+	movq	%rbp, 128(%rsp)	# key, J.key
+	.loc 1 112 5 is_stmt 1 view .LVU249
+	leaq	btree_task(%rip), %rdx	#,
+	leaq	1(%rax), %rsi	#, tmp182
+	call	blake2s_pool_run@PLT	#
+.LVL52:
+	.loc 1 113 5 view .LVU250
+# blake2s-tree.c:113:     return J.n;
+	.loc 1 113 13 is_stmt 0 view .LVU251
+	movq	144(%rsp), %rax	# J.n, _83
+.LVL53:
+	.loc 1 113 13 view .LVU252
+.LBE56:
+.LBE59:
+	.loc 1 145 9 is_stmt 1 view .LVU253
+# blake2s-tree.c:145:         if (!n)
+	.loc 1 145 12 is_stmt 0 view .LVU254
+	testq	%rax, %rax	# _83
+	je	.L35	#,
+.L61:
+	.loc 1 147 9 is_stmt 1 discriminator 2 view .LVU255
+.LVL54:
+	.loc 1 148 9 discriminator 2 view .LVU256
+# blake2s-tree.c:148:         len = n * P->inner_len;
+	.loc 1 148 20 is_stmt 0 discriminator 2 view .LVU257
+	movl	36(%r13), %ebx	# P_36(D)->inner_len, P_36(D)->inner_len
+.LVL55:
+	.loc 1 148 20 discriminator 2 view .LVU258
+.LBE46:
+# blake2s-tree.c:142:     for (Q.node_depth = 0; Q.node_depth < P->depth - 1; Q.node_depth++) {
+	.loc 1 142 52 discriminator 2 view .LVU259
+	movl	12(%r13), %esi	# P_36(D)->depth, tmp227
+.LBB61:
+# blake2s-tree.c:148:         len = n * P->inner_len;
+	.loc 1 148 13 discriminator 2 view .LVU260
+	imulq	%rax, %rbx	# _83, len
+.LVL56:
+	.loc 1 148 13 discriminator 2 view .LVU261
+.LBE61:
+	.loc 1 142 69 is_stmt 1 discriminator 2 view .LVU262
+	movl	64(%rsp), %eax	# Q.node_depth, tmp226
+.LVL57:
+# blake2s-tree.c:142:     for (Q.node_depth = 0; Q.node_depth < P->depth - 1; Q.node_depth++) {
+	.loc 1 142 52 is_stmt 0 discriminator 2 view .LVU263
+	leal	-1(%rsi), %edx	#, tmp186
+# blake2s-tree.c:142:     for (Q.node_depth = 0; Q.node_depth < P->depth - 1; Q.node_depth++) {
+	.loc 1 142 69 discriminator 2 view .LVU264
+	addl	$1, %eax	#, _21
+	movl	%eax, 64(%rsp)	# _21, Q.node_depth
+	.loc 1 142 41 is_stmt 1 discriminator 2 view .LVU265
+	cmpl	%edx, %eax	# tmp186, _21
+	jnb	.L58	#,
+	movq	%r15, %r14	# iftmp.4_56, src
+.LVL58:
+.L46:
+.LBB62:
+	.loc 1 143 9 view .LVU266
+# blake2s-tree.c:143:         unsigned char *dst = (Q.node_depth & 1) ? b : a;
+	.loc 1 143 53 is_stmt 0 view .LVU267
+	testb	$1, %al	#, _21
+	je	.L59	#,
+	.loc 1 143 53 view .LVU268
+	movq	16(%rsp), %r15	# %sfp, iftmp.4_56
+.L36:
+.LBB60:
+.LBB57:
+.LBB54:
+.LBB52:
+# blake2s-tree.c:40:     return node_depth ? (size_t)P->fanout * P->inner_len : P->leaf_len;
+	.loc 1 40 25 view .LVU269
+	movl	40(%rsp), %ecx	# Q.fanout, Q.fanout
+# blake2s-tree.c:40:     return node_depth ? (size_t)P->fanout * P->inner_len : P->leaf_len;
+	.loc 1 40 46 view .LVU270
+	movl	68(%rsp), %eax	# Q.inner_len, Q.inner_len
+# blake2s-tree.c:40:     return node_depth ? (size_t)P->fanout * P->inner_len : P->leaf_len;
+	.loc 1 40 58 view .LVU271
+	imulq	%rax, %rcx	# Q.inner_len, iftmp.2_72
+.LBE52:
+.LBE54:
+# blake2s-tree.c:96:     J.span = btree_span(P, P->node_depth);
+	.loc 1 96 12 view .LVU272
+	movq	%rcx, 136(%rsp)	# iftmp.2_72, J.span
+	.loc 1 97 5 is_stmt 1 view .LVU273
+# blake2s-tree.c:97:     J.n = len ? (len - 1) / J.span + 1 : 1;
+	.loc 1 97 40 is_stmt 0 view .LVU274
+	testq	%rbx, %rbx	# len
+	jne	.L60	#,
+.L39:
+# blake2s-tree.c:98:     J.per = (B2S_TREE_TASK - 1) / J.span + 1;
+	.loc 1 98 31 view .LVU275
+	xorl	%edx, %edx	# tmp195
+	movl	$262143, %eax	#, tmp196
+# blake2s-tree.c:97:     J.n = len ? (len - 1) / J.span + 1 : 1;
+	.loc 1 97 9 view .LVU276
+	movq	$1, 144(%rsp)	#, J.n
+	.loc 1 98 5 is_stmt 1 view .LVU277
+	.loc 1 99 5 view .LVU278
+# blake2s-tree.c:98:     J.per = (B2S_TREE_TASK - 1) / J.span + 1;
+	.loc 1 98 31 is_stmt 0 view .LVU279
+	divq	%rcx	# iftmp.2_72
+# blake2s-tree.c:99:     if (J.per < B2S_TREE_BATCH)
+	.loc 1 99 8 view .LVU280
+	movl	$64, %edx	#, tmp213
+# blake2s-tree.c:98:     J.per = (B2S_TREE_TASK - 1) / J.span + 1;
+	.loc 1 98 40 view .LVU281
+	addq	$1, %rax	#, tmp197
+# blake2s-tree.c:99:     if (J.per < B2S_TREE_BATCH)
+	.loc 1 99 8 view .LVU282
+	cmpq	%rdx, %rax	# tmp213, tmp197
+	cmovb	%rdx, %rax	# tmp197,, tmp213, tmp198
+	movq	%rax, 152(%rsp)	# tmp198, MEM <struct btree_level> [(void *)&J].per
+	.loc 1 101 5 is_stmt 1 view .LVU283
+.L40:
+	.loc 1 102 9 view .LVU284
+# blake2s-tree.c:102:         return blake2s_tree_nodes(out, src, len, P, key);
+	.loc 1 102 16 is_stmt 0 view .LVU285
+	movq	%rbp, %r8	# key,
+	movq	%r12, %rcx	# tmp200,
+	movq	%rbx, %rdx	# len,
+	movq	%r14, %rsi	# src,
+	movq	%r15, %rdi	# iftmp.4_56,
+	call	blake2s_tree_nodes	#
+.LVL59:
+	.loc 1 102 16 view .LVU286
+.LBE57:
+.LBE60:
+	.loc 1 145 9 is_stmt 1 view .LVU287
+# blake2s-tree.c:145:         if (!n)
+	.loc 1 145 12 is_stmt 0 view .LVU288
+	testq	%rax, %rax	# _83
+	jne	.L61	#,
+.LVL60:
+	.p2align 4,,10
+	.p2align 3
+.L35:
+	.loc 1 145 12 view .LVU289
+.LBE62:
+# blake2s-tree.c:130:     int ret = -1;
+	.loc 1 130 9 view .LVU290
+	movl	$-1, %ebx	#, <retval>
+.LVL61:
+.L44:
+	.loc 1 156 5 is_stmt 1 view .LVU291
+	movq	(%rsp), %rdi	# %sfp,
+	call	free@PLT	#
+.LVL62:
+	.loc 1 157 5 view .LVU292
+	movq	16(%rsp), %rdi	# %sfp,
+	call	free@PLT	#
+.LVL63:
+	.loc 1 158 5 view .LVU293
+.L30:
+# blake2s-tree.c:159: }
+	.loc 1 159 1 is_stmt 0 view .LVU294
+	addq	$296, %rsp	#,
+	.cfi_remember_state
+	.cfi_def_cfa_offset 56
+	movl	%ebx, %eax	# <retval>,
+	popq	%rbx	#
+	.cfi_def_cfa_offset 48
+	popq	%rbp	#
+	.cfi_def_cfa_offset 40
+.LVL64:
+	.loc 1 159 1 view .LVU295
+	popq	%r12	#
+	.cfi_def_cfa_offset 32
+	popq	%r13	#
+	.cfi_def_cfa_offset 24
+.LVL65:
+	.loc 1 159 1 view .LVU296
+	popq	%r14	#
+	.cfi_def_cfa_offset 16
+	popq	%r15	#
+	.cfi_def_cfa_offset 8
+	ret	
+.LVL66:
+	.p2align 4,,10
+	.p2align 3
+.L47:
+	.cfi_restore_state
+	.loc 1 159 1 view .LVU297
+	xorl	%r12d, %r12d	# _4
+# blake2s-tree.c:128:     size_t n = len ? (len - 1) / P->leaf_len + 1 : 1;
+	.loc 1 128 50 view .LVU298
+	movl	$1, %edi	#, iftmp.3_29
+.LVL67:
+	.loc 1 128 50 view .LVU299
+	jmp	.L31	#
+.LVL68:
+	.p2align 4,,10
+	.p2align 3
+.L58:
+	.loc 1 150 5 is_stmt 1 view .LVU300
+# blake2s-tree.c:150:     if (blake2s_init_param(&root, &Q, key) < 0)
+	.loc 1 150 9 is_stmt 0 view .LVU301
+	leaq	160(%rsp), %r14	#, tmp189
+	movq	%rbp, %rdx	# key,
+	movq	%r12, %rsi	# tmp200,
+	movq	%r14, %rdi	# tmp189,
+	call	blake2s_init_param@PLT	#
+.LVL69:
+# blake2s-tree.c:150:     if (blake2s_init_param(&root, &Q, key) < 0)
+	.loc 1 150 8 view .LVU302
+	testl	%eax, %eax	# tmp212
+	js	.L35	#,
+	.loc 1 152 5 is_stmt 1 view .LVU303
+	movq	%rbx, %rdx	# len,
+	movq	%r15, %rsi	# iftmp.4_56,
+	movq	%r14, %rdi	# tmp189,
+# blake2s-tree.c:154:     ret = 0;
+	.loc 1 154 9 is_stmt 0 view .LVU304
+	xorl	%ebx, %ebx	# <retval>
+.LVL70:
+# blake2s-tree.c:152:     blake2s_update(&root, src, len);
+	.loc 1 152 5 view .LVU305
+	call	blake2s_update@PLT	#
+.LVL71:
+	.loc 1 153 5 is_stmt 1 view .LVU306
+	movq	24(%rsp), %rsi	# %sfp,
+	movq	%r14, %rdi	# tmp189,
+	call	blake2s_final@PLT	#
+.LVL72:
+	.loc 1 154 5 view .LVU307
+	.loc 1 154 5 is_stmt 0 view .LVU308
+	jmp	.L44	#
+.LVL73:
+.L51:
+# blake2s-tree.c:133:         return -1;
+	.loc 1 133 16 view .LVU309
+	movl	$-1, %ebx	#, <retval>
+.LVL74:
+	.loc 1 133 16 view .LVU310
+	jmp	.L30	#
+	.cfi_endproc
+.LFE28:
+	.size	blake2s_tree_parallel, .-blake2s_tree_parallel
+	.p2align 4
+	.globl	blake2s_tree
+	.type	blake2s_tree, @function
+blake2s_tree:
+.LVL75:
+.LFB27:
+	.loc 1 118 1 is_stmt 1 view -0
+	.cfi_startproc
+	.loc 1 119 5 view .LVU312
+# blake2s-tree.c:119:     return blake2s_tree_parallel(out, src, len, P, key, 1);
+	.loc 1 119 12 is_stmt 0 view .LVU313
+	movl	$1, %r9d	#,
+	jmp	blake2s_tree_parallel	#
+.LVL76:
+	.loc 1 119 12 view .LVU314
+	.cfi_endproc
+.LFE27:
+	.size	blake2s_tree, .-blake2s_tree
+.Letext0:
+	.file 2 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stddef.h"
+	.file 3 "/usr/include/x86_64-linux-gnu/bits/types.h"
+	.file 4 "/usr/include/x86_64-linux-gnu/bits/stdint-uintn.h"
+	.file 5 "blake2s.h"
+	.file 6 "blake2s-internal.h"
+	.file 7 "/usr/include/stdlib.h"
+	.section	.debug_info,"",@progbits
+.Ldebug_info0:
+	.long	0xc05
+	.value	0x5
+	.byte	0x1
+	.byte	0x8
+	.long	.Ldebug_abbrev0
+	.uleb128 0x20
+	.long	.LASF51
+	.byte	0xc
+	.long	.LASF0
+	.long	.LASF1
+	.quad	.Ltext0
+	.quad	.Letext0-.Ltext0
+	.long	.Ldebug_line0
+	.uleb128 0x7
+	.byte	0x8
+	.byte	0x7
+	.long	.LASF2
+	.uleb128 0xb
+	.long	.LASF9
+	.byte	0x2
+	.byte	0xd6
+	.byte	0x1b
+	.long	0x2e
+	.uleb128 0x21
+	.byte	0x4
+	.byte	0x5
+	.string	"int"
+	.uleb128 0x7
+	.byte	0x8
+	.byte	0x5
+	.long	.LASF3
+	.uleb128 0x7
+	.byte	0x8
+	.byte	0x5
+	.long	.LASF4
+	.uleb128 0xa
+	.long	0x5b
+	.uleb128 0x22
+	.uleb128 0x7
+	.byte	0x1
+	.byte	0x8
+	.long	.LASF5
+	.uleb128 0x7
+	.byte	0x2
+	.byte	0x7
+	.long	.LASF6
+	.uleb128 0x7
+	.byte	0x4
+	.byte	0x7
+	.long	.LASF7
+	.uleb128 0x7
+	.byte	0x1
+	.byte	0x6
+	.long	.LASF8
+	.uleb128 0xb
+	.long	.LASF10
+	.byte	0x3
+	.byte	0x26
+	.byte	0x17
+	.long	0x5c
+	.uleb128 0x7
+	.byte	0x2
+	.byte	0x5
+	.long	.LASF11
+	.uleb128 0xb
+	.long	.LASF12
+	.byte	0x3
+	.byte	0x2a
+	.byte	0x16
+	.long	0x6a
+	.uleb128 0xb
+	.long	.LASF13
+	.byte	0x3
+	.byte	0x2d
+	.byte	0x1b
+	.long	0x2e
+	.uleb128 0x23
+	.byte	0x8
+	.uleb128 0x7
+	.byte	0x1
+	.byte	0x6
+	.long	.LASF14
+	.uleb128 0xb
+	.long	.LASF15
+	.byte	0x4
+	.byte	0x18
+	.byte	0x13
+	.long	0x78
+	.uleb128 0xb
+	.long	.LASF16
+	.byte	0x4
+	.byte	0x1a
+	.byte	0x14
+	.long	0x8b
+	.uleb128 0xb
+	.long	.LASF17
+	.byte	0x4
+	.byte	0x1b
+	.byte	0x14
+	.long	0x97
+	.uleb128 0x13
+	.long	.LASF33
+	.byte	0x40
+	.byte	0x5
+	.byte	0x30
+	.long	0x16c
+	.uleb128 0x4
+	.long	.LASF18
+	.byte	0x5
+	.byte	0x31
+	.byte	0xe
+	.long	0x6a
+	.byte	0
+	.uleb128 0x4
+	.long	.LASF19
+	.byte	0x5
+	.byte	0x32
+	.byte	0xe
+	.long	0x6a
+	.byte	0x4
+	.uleb128 0x4
+	.long	.LASF20
+	.byte	0x5
+	.byte	0x33
+	.byte	0xe
+	.long	0x6a
+	.byte	0x8
+	.uleb128 0x4
+	.long	.LASF21
+	.byte	0x5
+	.byte	0x34
+	.byte	0xe
+	.long	0x6a
+	.byte	0xc
+	.uleb128 0x4
+	.long	.LASF22
+	.byte	0x5
+	.byte	0x35
+	.byte	0xe
+	.long	0xb8
+	.byte	0x10
+	.uleb128 0x4
+	.long	.LASF23
+	.byte	0x5
+	.byte	0x36
+	.byte	0xe
+	.long	0xc4
+	.byte	0x18
+	.uleb128 0x4
+	.long	.LASF24
+	.byte	0x5
+	.byte	0x37
+	.byte	0xe
+	.long	0x6a
+	.byte	0x20
+	.uleb128 0x4
+	.long	.LASF25
+	.byte	0x5
+	.byte	0x38
+	.byte	0xe
+	.long	0x6a
+	.byte	0x24
+	.uleb128 0x4
+	.long	.LASF26
+	.byte	0x5
+	.byte	0x39
+	.byte	0x13
+	.long	0x171
+	.byte	0x28
+	.uleb128 0x4
+	.long	.LASF27
+	.byte	0x5
+	.byte	0x3a
+	.byte	0x13
+	.long	0x171
+	.byte	0x30
+	.uleb128 0x4
+	.long	.LASF28
+	.byte	0x5
+	.byte	0x3b
+	.byte	0x9
+	.long	0x41
+	.byte	0x38
+	.byte	0
+	.uleb128 0xf
+	.long	0xd0
+	.uleb128 0xc
+	.long	0x5c
+	.long	0x181
+	.uleb128 0x9
+	.long	0x2e
+	.byte	0x7
+	.byte	0
+	.uleb128 0x24
+	.long	.LASF52
+	.byte	0x80
+	.byte	0x10
+	.byte	0x5
+	.byte	0xf7
+	.byte	0x8
+	.long	0x1e5
+	.uleb128 0x5
+	.string	"H"
+	.byte	0x5
+	.byte	0xf8
+	.byte	0xe
+	.long	0x1e5
+	.byte	0
+	.uleb128 0x5
+	.string	"buf"
+	.byte	0x5
+	.byte	0xf9
+	.byte	0x13
+	.long	0x1f5
+	.byte	0x20
+	.uleb128 0x5
+	.string	"t"
+	.byte	0x5
+	.byte	0xfa
+	.byte	0xe
+	.long	0x205
+	.byte	0x60
+	.uleb128 0x5
+	.string	"f"
+	.byte	0x5
+	.byte	0xfb
+	.byte	0xe
+	.long	0x205
+	.byte	0x68
+	.uleb128 0x4
+	.long	.LASF29
+	.byte	0x5
+	.byte	0xfc
+	.byte	0xe
+	.long	0x6a
+	.byte	0x70
+	.uleb128 0x4
+	.long	.LASF18
+	.byte	0x5
+	.byte	0xfd
+	.byte	0xe
+	.long	0x6a
+	.byte	0x74
+	.uleb128 0x4
+	.long	.LASF28
+	.byte	0x5
+	.byte	0xfe
+	.byte	0xe
+	.long	0x6a
+	.byte	0x78
+	.byte	0
+	.uleb128 0xc
+	.long	0xb8
+	.long	0x1f5
+	.uleb128 0x9
+	.long	0x2e
+	.byte	0x7
+	.byte	0
+	.uleb128 0xc
+	.long	0x5c
+	.long	0x205
+	.uleb128 0x9
+	.long	0x2e
+	.byte	0x3f
+	.byte	0
+	.uleb128 0xc
+	.long	0xb8
+	.long	0x215
+	.uleb128 0x9
+	.long	0x2e
+	.byte	0x1
+	.byte	0
+	.uleb128 0xa
+	.long	0x181
+	.uleb128 0xa
+	.long	0x5c
+	.uleb128 0x7
+	.byte	0x8
+	.byte	0x7
+	.long	.LASF30
+	.uleb128 0x17
+	.string	"u8"
+	.byte	0x7
+	.byte	0x11
+	.long	0xac
+	.uleb128 0xf
+	.long	0x226
+	.uleb128 0x17
+	.string	"u32"
+	.byte	0x8
+	.byte	0x12
+	.long	0xb8
+	.uleb128 0xf
+	.long	0x235
+	.uleb128 0xc
+	.long	0x240
+	.long	0x255
+	.uleb128 0x9
+	.long	0x2e
+	.byte	0x7
+	.byte	0
+	.uleb128 0xf
+	.long	0x245
+	.uleb128 0x18
+	.long	.LASF31
+	.byte	0xa
+	.byte	0x12
+	.long	0x255
+	.byte	0x20
+	.byte	0x67
+	.byte	0xe6
+	.byte	0x9
+	.byte	0x6a
+	.byte	0x85
+	.byte	0xae
+	.byte	0x67
+	.byte	0xbb
+	.byte	0x72
+	.byte	0xf3
+	.byte	0x6e
+	.byte	0x3c
+	.byte	0x3a
+	.byte	0xf5
+	.byte	0x4f
+	.byte	0xa5
+	.byte	0x7f
+	.byte	0x52
+	.byte	0xe
+	.byte	0x51
+	.byte	0x8c
+	.byte	0x68
+	.byte	0x5
+	.byte	0x9b
+	.byte	0xab
+	.byte	0xd9
+	.byte	0x83
+	.byte	0x1f
+	.byte	0x19
+	.byte	0xcd
+	.byte	0xe0
+	.byte	0x5b
+	.uleb128 0xc
+	.long	0x230
+	.long	0x29c
+	.uleb128 0x9
+	.long	0x2e
+	.byte	0x9
+	.uleb128 0x9
+	.long	0x2e
+	.byte	0xf
+	.byte	0
+	.uleb128 0xf
+	.long	0x286
+	.uleb128 0x18
+	.long	.LASF32
+	.byte	0xf
+	.byte	0x11
+	.long	0x29c
+	.byte	0xa0
+	.byte	0
+	.byte	0x1
+	.byte	0x2
+	.byte	0x3
+	.byte	0x4
+	.byte	0x5
+	.byte	0x6
+	.byte	0x7
+	.byte	0x8
+	.byte	0x9
+	.byte	0xa
+	.byte	0xb
+	.byte	0xc
+	.byte	0xd
+	.byte	0xe
+	.byte	0xf
+	.byte	0xe
+	.byte	0xa
+	.byte	0x4
+	.byte	0x8
+	.byte	0x9
+	.byte	0xf
+	.byte	0xd
+	.byte	0x6
+	.byte	0x1
+	.byte	0xc
+	.byte	0
+	.byte	0x2
+	.byte	0xb
+	.byte	0x7
+	.byte	0x5
+	.byte	0x3
+	.byte	0xb
+	.byte	0x8
+	.byte	0xc
+	.byte	0
+	.byte	0x5
+	.byte	0x2
+	.byte	0xf
+	.byte	0xd
+	.byte	0xa
+	.byte	0xe
+	.byte	0x3
+	.byte	0x6
+	.byte	0x7
+	.byte	0x1
+	.byte	0x9
+	.byte	0x4
+	.byte	0x7
+	.byte	0x9
+	.byte	0x3
+	.byte	0x1
+	.byte	0xd
+	.byte	0xc
+	.byte	0xb
+	.byte	0xe
+	.byte	0x2
+	.byte	0x6
+	.byte	0x5
+	.byte	0xa
+	.byte	0x4
+	.byte	0
+	.byte	0xf
+	.byte	0x8
+	.byte	0x9
+	.byte	0
+	.byte	0x5
+	.byte	0x7
+	.byte	0x2
+	.byte	0x4
+	.byte	0xa
+	.byte	0xf
+	.byte	0xe
+	.byte	0x1
+	.byte	0xb
+	.byte	0xc
+	.byte	0x6
+	.byte	0x8
+	.byte	0x3
+	.byte	0xd
+	.byte	0x2
+	.byte	0xc
+	.byte	0x6
+	.byte	0xa
+	.byte	0
+	.byte	0xb
+	.byte	0x8
+	.byte	0x3
+	.byte	0x4
+	.byte	0xd
+	.byte	0x7
+	.byte	0x5
+	.byte	0xf
+	.byte	0xe
+	.byte	0x1
+	.byte	0x9
+	.byte	0xc
+	.byte	0x5
+	.byte	0x1
+	.byte	0xf
+	.byte	0xe
+	.byte	0xd
+	.byte	0x4
+	.byte	0xa
+	.byte	0
+	.byte	0x7
+	.byte	0x6
+	.byte	0x3
+	.byte	0x9
+	.byte	0x2
+	.byte	0x8
+	.byte	0xb
+	.byte	0xd
+	.byte	0xb
+	.byte	0x7
+	.byte	0xe
+	.byte	0xc
+	.byte	0x1
+	.byte	0x3
+	.byte	0x9
+	.byte	0x5
+	.byte	0
+	.byte	0xf
+	.byte	0x4
+	.byte	0x8
+	.byte	0x6
+	.byte	0x2
+	.byte	0xa
+	.byte	0x6
+	.byte	0xf
+	.byte	0xe
+	.byte	0x9
+	.byte	0xb
+	.byte	0x3
+	.byte	0
+	.byte	0x8
+	.byte	0xc
+	.byte	0x2
+	.byte	0xd
+	.byte	0x7
+	.byte	0x1
+	.byte	0x4
+	.byte	0xa
+	.byte	0x5
+	.byte	0xa
+	.byte	0x2
+	.byte	0x8
+	.byte	0x4
+	.byte	0x7
+	.byte	0x6
+	.byte	0x1
+	.byte	0x5
+	.byte	0xf
+	.byte	0xb
+	.byte	0x9
+	.byte	0xe
+	.byte	0x3
+	.byte	0xc
+	.byte	0xd
+	.byte	0
+	.uleb128 0x13
+	.long	.LASF34
+	.byte	0x20
+	.byte	0x6
+	.byte	0x80
+	.long	0x38e
+	.uleb128 0x5
+	.string	"ctx"
+	.byte	0x6
+	.byte	0x81
+	.byte	0x19
+	.long	0x215
+	.byte	0
+	.uleb128 0x5
+	.string	"src"
+	.byte	0x6
+	.byte	0x82
+	.byte	0xf
+	.long	0x38e
+	.byte	0x8
+	.uleb128 0x5
+	.string	"len"
+	.byte	0x6
+	.byte	0x83
+	.byte	0xc
+	.long	0x35
+	.byte	0x10
+	.uleb128 0x5
+	.string	"out"
+	.byte	0x6
+	.byte	0x84
+	.byte	0x14
+	.long	0x21a
+	.byte	0x18
+	.byte	0
+	.uleb128 0xa
+	.long	0x230
+	.uleb128 0x13
+	.long	.LASF35
+	.byte	0x40
+	.byte	0x1
+	.byte	0x11
+	.long	0x404
+	.uleb128 0x5
+	.string	"out"
+	.byte	0x1
+	.byte	0x12
+	.byte	0x14
+	.long	0x21a
+	.byte	0
+	.uleb128 0x5
+	.string	"src"
+	.byte	0x1
+	.byte	0x13
+	.byte	0xf
+	.long	0x38e
+	.byte	0x8
+	.uleb128 0x5
+	.string	"len"
+	.byte	0x1
+	.byte	0x14
+	.byte	0xc
+	.long	0x35
+	.byte	0x10
+	.uleb128 0x5
+	.string	"P"
+	.byte	0x1
+	.byte	0x15
+	.byte	0x21
+	.long	0x404
+	.byte	0x18
+	.uleb128 0x5
+	.string	"key"
+	.byte	0x1
+	.byte	0x16
+	.byte	0x11
+	.long	0x56
+	.byte	0x20
+	.uleb128 0x4
+	.long	.LASF36
+	.byte	0x1
+	.byte	0x17
+	.byte	0xc
+	.long	0x35
+	.byte	0x28
+	.uleb128 0x5
+	.string	"n"
+	.byte	0x1
+	.byte	0x18
+	.byte	0xc
+	.long	0x35
+	.byte	0x30
+	.uleb128 0x5
+	.string	"per"
+	.byte	0x1
+	.byte	0x19
+	.byte	0xc
+	.long	0x35
+	.byte	0x38
+	.byte	0
+	.uleb128 0xa
+	.long	0x16c
+	.uleb128 0x12
+	.long	.LASF37
+	.byte	0x6
+	.byte	0xb3
+	.long	0x429
+	.uleb128 0x2
+	.long	0x6a
+	.uleb128 0x2
+	.long	0x35
+	.uleb128 0x2
+	.long	0x429
+	.uleb128 0x2
+	.long	0xa3
+	.byte	0
+	.uleb128 0xa
+	.long	0x42e
+	.uleb128 0x25
+	.long	0x43e
+	.uleb128 0x2
+	.long	0xa3
+	.uleb128 0x2
+	.long	0x35
+	.byte	0
+	.uleb128 0x26
+	.long	.LASF38
+	.byte	0x7
+	.value	0x238
+	.byte	0xd
+	.long	0x451
+	.uleb128 0x2
+	.long	0xa3
+	.byte	0
+	.uleb128 0x12
+	.long	.LASF39
+	.byte	0x5
+	.byte	0x47
+	.long	0x467
+	.uleb128 0x2
+	.long	0x215
+	.uleb128 0x2
+	.long	0x21a
+	.byte	0
+	.uleb128 0x12
+	.long	.LASF40
+	.byte	0x5
+	.byte	0x46
+	.long	0x482
+	.uleb128 0x2
+	.long	0x215
+	.uleb128 0x2
+	.long	0x56
+	.uleb128 0x2
+	.long	0x35
+	.byte	0
+	.uleb128 0x27
+	.long	.LASF42
+	.byte	0x7
+	.value	0x229
+	.byte	0xe
+	.long	0xa3
+	.long	0x499
+	.uleb128 0x2
+	.long	0x35
+	.byte	0
+	.uleb128 0x12
+	.long	.LASF41
+	.byte	0x6
+	.byte	0x87
+	.long	0x4af
+	.uleb128 0x2
+	.long	0x4af
+	.uleb128 0x2
+	.long	0x35
+	.byte	0
+	.uleb128 0xa
+	.long	0x34d
+	.uleb128 0x28
+	.long	.LASF43
+	.byte	0x5
+	.byte	0x43
+	.byte	0x6
+	.long	0x41
+	.long	0x4d4
+	.uleb128 0x2
+	.long	0x215
+	.uleb128 0x2
+	.long	0x404
+	.uleb128 0x2
+	.long	0x56
+	.byte	0
+	.uleb128 0x14
+	.long	.LASF46
+	.byte	0x7a
+	.byte	0x5
+	.long	0x41
+	.quad	.LFB28
+	.quad	.LFE28-.LFB28
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0x820
+	.uleb128 0x3
+	.string	"out"
+	.byte	0x7a
+	.byte	0x2a
+	.long	0x21a
+	.long	.LLST23
+	.long	.LVUS23
+	.uleb128 0x3
+	.string	"src"
+	.byte	0x7a
+	.byte	0x3b
+	.long	0x56
+	.long	.LLST24
+	.long	.LVUS24
+	.uleb128 0x3
+	.string	"len"
+	.byte	0x7a
+	.byte	0x47
+	.long	0x35
+	.long	.LLST25
+	.long	.LVUS25
+	.uleb128 0x3
+	.string	"P"
+	.byte	0x7b
+	.byte	0x37
+	.long	0x404
+	.long	.LLST26
+	.long	.LVUS26
+	.uleb128 0x3
+	.string	"key"
+	.byte	0x7b
+	.byte	0x46
+	.long	0x56
+	.long	.LLST27
+	.long	.LVUS27
+	.uleb128 0x29
+	.long	.LASF44
+	.byte	0x1
+	.byte	0x7c
+	.byte	0x24
+	.long	0x6a
+	.long	.LLST28
+	.long	.LVUS28
+	.uleb128 0x10
+	.string	"Q"
+	.byte	0x7e
+	.byte	0x1a
+	.long	0xd0
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -320
+	.uleb128 0x2a
+	.long	.LASF45
+	.byte	0x1
+	.byte	0x7f
+	.byte	0x18
+	.long	0x181
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -192
+	.uleb128 0x6
+	.string	"n"
+	.byte	0x80
+	.byte	0xc
+	.long	0x35
+	.long	.LLST29
+	.long	.LVUS29
+	.uleb128 0x6
+	.string	"a"
+	.byte	0x81
+	.byte	0x14
+	.long	0x21a
+	.long	.LLST30
+	.long	.LVUS30
+	.uleb128 0x6
+	.string	"b"
+	.byte	0x81
+	.byte	0x18
+	.long	0x21a
+	.long	.LLST31
+	.long	.LVUS31
+	.uleb128 0x6
+	.string	"ret"
+	.byte	0x82
+	.byte	0x9
+	.long	0x41
+	.long	.LLST32
+	.long	.LVUS32
+	.uleb128 0x2b
+	.long	.LASF53
+	.byte	0x1
+	.byte	0x9b
+	.byte	0x1
+	.quad	.L44
+	.uleb128 0x15
+	.long	.LLRL34
+	.long	0x725
+	.uleb128 0x6
+	.string	"dst"
+	.byte	0x8f
+	.byte	0x18
+	.long	0x21a
+	.long	.LLST35
+	.long	.LVUS35
+	.uleb128 0x2c
+	.long	0x8d5
+	.quad	.LBI47
+	.byte	.LVU202
+	.long	.LLRL36
+	.byte	0x1
+	.byte	0x90
+	.byte	0xd
+	.uleb128 0x8
+	.long	0x918
+	.long	.LLST37
+	.long	.LVUS37
+	.uleb128 0x8
+	.long	0x90d
+	.long	.LLST38
+	.long	.LVUS38
+	.uleb128 0x8
+	.long	0x904
+	.long	.LLST39
+	.long	.LVUS39
+	.uleb128 0x8
+	.long	0x8f9
+	.long	.LLST40
+	.long	.LVUS40
+	.uleb128 0x8
+	.long	0x8ee
+	.long	.LLST41
+	.long	.LVUS41
+	.uleb128 0x8
+	.long	0x8e3
+	.long	.LLST42
+	.long	.LVUS42
+	.uleb128 0x16
+	.long	.LLRL36
+	.uleb128 0x19
+	.long	0x923
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -256
+	.uleb128 0x19
+	.long	0x92b
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -192
+	.uleb128 0x1a
+	.long	0xbce
+	.quad	.LBI49
+	.byte	.LVU206
+	.long	.LLRL43
+	.byte	0x60
+	.byte	0xe
+	.long	0x6a2
+	.uleb128 0x8
+	.long	0xbe5
+	.long	.LLST44
+	.long	.LVUS44
+	.uleb128 0x8
+	.long	0xbdc
+	.long	.LLST45
+	.long	.LVUS45
+	.byte	0
+	.uleb128 0xd
+	.quad	.LVL51
+	.long	0x4b4
+	.long	0x6c7
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -192
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x2
+	.byte	0x7c
+	.sleb128 0
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x51
+	.uleb128 0x2
+	.byte	0x76
+	.sleb128 0
+	.byte	0
+	.uleb128 0xd
+	.quad	.LVL52
+	.long	0x409
+	.long	0x6f6
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x5
+	.byte	0x91
+	.sleb128 -340
+	.byte	0x94
+	.byte	0x4
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x51
+	.uleb128 0x9
+	.byte	0x3
+	.quad	btree_task
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x52
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -256
+	.byte	0
+	.uleb128 0x11
+	.quad	.LVL59
+	.long	0x9e6
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x7f
+	.sleb128 0
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x2
+	.byte	0x7e
+	.sleb128 0
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x51
+	.uleb128 0x2
+	.byte	0x73
+	.sleb128 0
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x52
+	.uleb128 0x2
+	.byte	0x7c
+	.sleb128 0
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x58
+	.uleb128 0x2
+	.byte	0x76
+	.sleb128 0
+	.byte	0
+	.byte	0
+	.byte	0
+	.byte	0
+	.uleb128 0x2d
+	.long	0xbf1
+	.quad	.LBI44
+	.byte	.LVU168
+	.quad	.LBB44
+	.quad	.LBE44-.LBB44
+	.byte	0x1
+	.byte	0x84
+	.byte	0x9
+	.long	0x758
+	.uleb128 0x8
+	.long	0xbfe
+	.long	.LLST33
+	.long	.LVUS33
+	.byte	0
+	.uleb128 0x2e
+	.quad	.LVL42
+	.long	0x482
+	.uleb128 0xd
+	.quad	.LVL44
+	.long	0x482
+	.long	0x78d
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x12
+	.byte	0x7c
+	.sleb128 0
+	.byte	0xa8
+	.uleb128 0x2e
+	.byte	0x7f
+	.sleb128 0
+	.byte	0xa8
+	.uleb128 0x2e
+	.byte	0x1b
+	.byte	0xa8
+	.uleb128 0
+	.byte	0x23
+	.uleb128 0x1
+	.byte	0x91
+	.sleb128 -336
+	.byte	0x6
+	.byte	0x1e
+	.byte	0
+	.uleb128 0xd
+	.quad	.LVL62
+	.long	0x43e
+	.long	0x7a7
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x4
+	.byte	0x91
+	.sleb128 -352
+	.byte	0x6
+	.byte	0
+	.uleb128 0xd
+	.quad	.LVL63
+	.long	0x43e
+	.long	0x7c1
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x4
+	.byte	0x91
+	.sleb128 -336
+	.byte	0x6
+	.byte	0
+	.uleb128 0xd
+	.quad	.LVL69
+	.long	0x4b4
+	.long	0x7e5
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x7e
+	.sleb128 0
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x2
+	.byte	0x7c
+	.sleb128 0
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x51
+	.uleb128 0x2
+	.byte	0x76
+	.sleb128 0
+	.byte	0
+	.uleb128 0xd
+	.quad	.LVL71
+	.long	0x467
+	.long	0x803
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x7e
+	.sleb128 0
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x2
+	.byte	0x7f
+	.sleb128 0
+	.byte	0
+	.uleb128 0x11
+	.quad	.LVL72
+	.long	0x451
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x7e
+	.sleb128 0
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x4
+	.byte	0x91
+	.sleb128 -328
+	.byte	0x6
+	.byte	0
+	.byte	0
+	.uleb128 0x14
+	.long	.LASF47
+	.byte	0x74
+	.byte	0x5
+	.long	0x41
+	.quad	.LFB27
+	.quad	.LFE27-.LFB27
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0x8d5
+	.uleb128 0x3
+	.string	"out"
+	.byte	0x74
+	.byte	0x21
+	.long	0x21a
+	.long	.LLST46
+	.long	.LVUS46
+	.uleb128 0x3
+	.string	"src"
+	.byte	0x74
+	.byte	0x32
+	.long	0x56
+	.long	.LLST47
+	.long	.LVUS47
+	.uleb128 0x3
+	.string	"len"
+	.byte	0x74
+	.byte	0x3e
+	.long	0x35
+	.long	.LLST48
+	.long	.LVUS48
+	.uleb128 0x3
+	.string	"P"
+	.byte	0x75
+	.byte	0x2e
+	.long	0x404
+	.long	.LLST49
+	.long	.LVUS49
+	.uleb128 0x3
+	.string	"key"
+	.byte	0x75
+	.byte	0x3d
+	.long	0x56
+	.long	.LLST50
+	.long	.LVUS50
+	.uleb128 0x2f
+	.quad	.LVL76
+	.long	0x4d4
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x3
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x3
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x51
+	.uleb128 0x3
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x51
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x52
+	.uleb128 0x3
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x52
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x58
+	.uleb128 0x3
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x58
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x59
+	.uleb128 0x1
+	.byte	0x31
+	.byte	0
+	.byte	0
+	.uleb128 0x1b
+	.long	.LASF35
+	.byte	0x59
+	.long	0x35
+	.long	0x936
+	.uleb128 0xe
+	.string	"out"
+	.byte	0x59
+	.byte	0x2a
+	.long	0x21a
+	.uleb128 0xe
+	.string	"src"
+	.byte	0x59
+	.byte	0x3b
+	.long	0x56
+	.uleb128 0xe
+	.string	"len"
+	.byte	0x59
+	.byte	0x47
+	.long	0x35
+	.uleb128 0xe
+	.string	"P"
+	.byte	0x5a
+	.byte	0x37
+	.long	0x404
+	.uleb128 0xe
+	.string	"key"
+	.byte	0x5a
+	.byte	0x46
+	.long	0x56
+	.uleb128 0x1c
+	.long	.LASF44
+	.byte	0x5b
+	.byte	0x24
+	.long	0x6a
+	.uleb128 0x1d
+	.string	"J"
+	.byte	0x5d
+	.long	0x393
+	.uleb128 0x1d
+	.string	"ctx"
+	.byte	0x5e
+	.long	0x181
+	.byte	0
+	.uleb128 0x30
+	.long	.LASF54
+	.byte	0x1
+	.byte	0x49
+	.byte	0xd
+	.quad	.LFB25
+	.quad	.LFE25-.LFB25
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0x9e1
+	.uleb128 0x3
+	.string	"arg"
+	.byte	0x49
+	.byte	0x1e
+	.long	0xa3
+	.long	.LLST17
+	.long	.LVUS17
+	.uleb128 0x3
+	.string	"i"
+	.byte	0x49
+	.byte	0x2a
+	.long	0x35
+	.long	.LLST18
+	.long	.LVUS18
+	.uleb128 0x6
+	.string	"J"
+	.byte	0x4b
+	.byte	0x19
+	.long	0x9e1
+	.long	.LLST19
+	.long	.LVUS19
+	.uleb128 0x10
+	.string	"Q"
+	.byte	0x4c
+	.byte	0x1a
+	.long	0xd0
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -80
+	.uleb128 0x1e
+	.long	.LASF48
+	.byte	0x4d
+	.long	0x35
+	.long	.LLST20
+	.long	.LVUS20
+	.uleb128 0x6
+	.string	"k"
+	.byte	0x4e
+	.byte	0xc
+	.long	0x35
+	.long	.LLST21
+	.long	.LVUS21
+	.uleb128 0x6
+	.string	"at"
+	.byte	0x4f
+	.byte	0xc
+	.long	0x35
+	.long	.LLST22
+	.long	.LVUS22
+	.uleb128 0x11
+	.quad	.LVL35
+	.long	0x9e6
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x52
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -80
+	.byte	0
+	.byte	0
+	.uleb128 0xa
+	.long	0x393
+	.uleb128 0x14
+	.long	.LASF49
+	.byte	0x2b
+	.byte	0x8
+	.long	0x35
+	.quad	.LFB24
+	.quad	.LFE24-.LFB24
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0xbad
+	.uleb128 0x3
+	.string	"out"
+	.byte	0x2b
+	.byte	0x2a
+	.long	0x21a
+	.long	.LLST0
+	.long	.LVUS0
+	.uleb128 0x3
+	.string	"src"
+	.byte	0x2b
+	.byte	0x3b
+	.long	0x56
+	.long	.LLST1
+	.long	.LVUS1
+	.uleb128 0x3
+	.string	"len"
+	.byte	0x2b
+	.byte	0x47
+	.long	0x35
+	.long	.LLST2
+	.long	.LVUS2
+	.uleb128 0x3
+	.string	"P"
+	.byte	0x2c
+	.byte	0x37
+	.long	0x404
+	.long	.LLST3
+	.long	.LVUS3
+	.uleb128 0x3
+	.string	"key"
+	.byte	0x2c
+	.byte	0x46
+	.long	0x56
+	.long	.LLST4
+	.long	.LVUS4
+	.uleb128 0x10
+	.string	"ctx"
+	.byte	0x2e
+	.byte	0x18
+	.long	0xbad
+	.uleb128 0x4
+	.byte	0x91
+	.sleb128 -8256
+	.uleb128 0x10
+	.string	"job"
+	.byte	0x2f
+	.byte	0x18
+	.long	0xbbe
+	.uleb128 0x4
+	.byte	0x91
+	.sleb128 -10304
+	.uleb128 0x10
+	.string	"Q"
+	.byte	0x30
+	.byte	0x1a
+	.long	0xd0
+	.uleb128 0x4
+	.byte	0x91
+	.sleb128 -10368
+	.uleb128 0x1e
+	.long	.LASF36
+	.byte	0x31
+	.long	0x35
+	.long	.LLST5
+	.long	.LVUS5
+	.uleb128 0x6
+	.string	"n"
+	.byte	0x32
+	.byte	0xc
+	.long	0x35
+	.long	.LLST6
+	.long	.LVUS6
+	.uleb128 0x15
+	.long	.LLRL9
+	.long	0xb5a
+	.uleb128 0x6
+	.string	"i"
+	.byte	0x36
+	.byte	0x11
+	.long	0x35
+	.long	.LLST10
+	.long	.LVUS10
+	.uleb128 0x16
+	.long	.LLRL11
+	.uleb128 0x6
+	.string	"k"
+	.byte	0x37
+	.byte	0x10
+	.long	0x35
+	.long	.LLST12
+	.long	.LVUS12
+	.uleb128 0x15
+	.long	.LLRL13
+	.long	0xb41
+	.uleb128 0x6
+	.string	"j"
+	.byte	0x38
+	.byte	0x15
+	.long	0x35
+	.long	.LLST14
+	.long	.LVUS14
+	.uleb128 0x16
+	.long	.LLRL15
+	.uleb128 0x6
+	.string	"at"
+	.byte	0x39
+	.byte	0x14
+	.long	0x35
+	.long	.LLST16
+	.long	.LVUS16
+	.uleb128 0x11
+	.quad	.LVL17
+	.long	0x4b4
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x5
+	.byte	0x91
+	.sleb128 -10472
+	.byte	0x6
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x5
+	.byte	0x91
+	.sleb128 -10432
+	.byte	0x6
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x51
+	.uleb128 0x5
+	.byte	0x91
+	.sleb128 -10440
+	.byte	0x6
+	.byte	0
+	.byte	0
+	.byte	0
+	.uleb128 0x11
+	.quad	.LVL23
+	.long	0x499
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x5
+	.byte	0x91
+	.sleb128 -10400
+	.byte	0x6
+	.byte	0
+	.byte	0
+	.byte	0
+	.uleb128 0x1a
+	.long	0xbce
+	.quad	.LBI15
+	.byte	.LVU13
+	.long	.LLRL7
+	.byte	0x31
+	.byte	0x13
+	.long	0xb7d
+	.uleb128 0x1f
+	.long	0xbe5
+	.uleb128 0x1f
+	.long	0xbdc
+	.byte	0
+	.uleb128 0x31
+	.long	0xbf1
+	.quad	.LBI20
+	.byte	.LVU27
+	.quad	.LBB20
+	.quad	.LBE20-.LBB20
+	.byte	0x1
+	.byte	0x34
+	.byte	0x9
+	.uleb128 0x8
+	.long	0xbfe
+	.long	.LLST8
+	.long	.LVUS8
+	.byte	0
+	.byte	0
+	.uleb128 0x32
+	.long	0x181
+	.byte	0x10
+	.long	0xbbe
+	.uleb128 0x9
+	.long	0x2e
+	.byte	0x3f
+	.byte	0
+	.uleb128 0xc
+	.long	0x34d
+	.long	0xbce
+	.uleb128 0x9
+	.long	0x2e
+	.byte	0x3f
+	.byte	0
+	.uleb128 0x1b
+	.long	.LASF50
+	.byte	0x26
+	.long	0x35
+	.long	0xbf1
+	.uleb128 0xe
+	.string	"P"
+	.byte	0x26
+	.byte	0x36
+	.long	0x404
+	.uleb128 0x1c
+	.long	.LASF24
+	.byte	0x26
+	.byte	0x42
+	.long	0x6a
+	.byte	0
+	.uleb128 0x33
+	.long	.LASF55
+	.byte	0x1
+	.byte	0x1c
+	.byte	0xc
+	.long	0x41
+	.byte	0x1
+	.uleb128 0xe
+	.string	"P"
+	.byte	0x1c
+	.byte	0x34
+	.long	0x404
+	.byte	0
+	.byte	0
+	.section	.debug_abbrev,"",@progbits
+.Ldebug_abbrev0:
+	.uleb128 0x1
+	.uleb128 0x49
+	.byte	0
+	.uleb128 0x2
+	.uleb128 0x18
+	.uleb128 0x7e
+	.uleb128 0x18
+	.byte	0
+	.byte	0
+	.uleb128 0x2
+	.uleb128 0x5
+	.byte	0
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x5
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x8
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x2
+	.uleb128 0x17
+	.uleb128 0x2137
+	.uleb128 0x17
+	.byte	0
+	.byte	0
+	.uleb128 0x4
+	.uleb128 0xd
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x38
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x5
+	.uleb128 0xd
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x8
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x38
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x6
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x8
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x2
+	.uleb128 0x17
+	.uleb128 0x2137
+	.uleb128 0x17
+	.byte	0
+	.byte	0
+	.uleb128 0x7
+	.uleb128 0x24
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x3e
+	.uleb128 0xb
+	.uleb128 0x3
+	.uleb128 0xe
+	.byte	0
+	.byte	0
+	.uleb128 0x8
+	.uleb128 0x5
+	.byte	0
+	.uleb128 0x31
+	.uleb128 0x13
+	.uleb128 0x2
+	.uleb128 0x17
+	.uleb128 0x2137
+	.uleb128 0x17
+	.byte	0
+	.byte	0
+	.uleb128 0x9
+	.uleb128 0x21
+	.byte	0
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x2f
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0xa
+	.uleb128 0xf
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0x21
+	.sleb128 8
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0x16
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0xc
+	.uleb128 0x1
+	.byte	0x1
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0xd
+	.uleb128 0x48
+	.byte	0x1
+	.uleb128 0x7d
+	.uleb128 0x1
+	.uleb128 0x7f
+	.uleb128 0x13
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0xe
+	.uleb128 0x5
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x8
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0xf
+	.uleb128 0x26
+	.byte	0
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x10
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x8
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x2
+	.uleb128 0x18
+	.byte	0
+	.byte	0
+	.uleb128 0x11
+	.uleb128 0x48
+	.byte	0x1
+	.uleb128 0x7d
+	.uleb128 0x1
+	.uleb128 0x7f
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x12
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 6
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x3c
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x13
+	.uleb128 0x13
+	.byte	0x1
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 8
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x14
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x11
+	.uleb128 0x1
+	.uleb128 0x12
+	.uleb128 0x7
+	.uleb128 0x40
+	.uleb128 0x18
+	.uleb128 0x7a
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x15
+	.uleb128 0xb
+	.byte	0x1
+	.uleb128 0x55
+	.uleb128 0x17
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x16
+	.uleb128 0xb
+	.byte	0x1
+	.uleb128 0x55
+	.uleb128 0x17
+	.byte	0
+	.byte	0
+	.uleb128 0x17
+	.uleb128 0x16
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x8
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 6
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x18
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 6
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x1c
+	.uleb128 0xa
+	.byte	0
+	.byte	0
+	.uleb128 0x19
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x31
+	.uleb128 0x13
+	.uleb128 0x2
+	.uleb128 0x18
+	.byte	0
+	.byte	0
+	.uleb128 0x1a
+	.uleb128 0x1d
+	.byte	0x1
+	.uleb128 0x31
+	.uleb128 0x13
+	.uleb128 0x52
+	.uleb128 0x1
+	.uleb128 0x2138
+	.uleb128 0xb
+	.uleb128 0x55
+	.uleb128 0x17
+	.uleb128 0x58
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x59
+	.uleb128 0xb
+	.uleb128 0x57
+	.uleb128 0xb
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x1b
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 15
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x20
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x1c
+	.uleb128 0x5
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x1d
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x8
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 24
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x1e
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 12
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x2
+	.uleb128 0x17
+	.uleb128 0x2137
+	.uleb128 0x17
+	.byte	0
+	.byte	0
+	.uleb128 0x1f
+	.uleb128 0x5
+	.byte	0
+	.uleb128 0x31
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x20
+	.uleb128 0x11
+	.byte	0x1
+	.uleb128 0x25
+	.uleb128 0xe
+	.uleb128 0x13
+	.uleb128 0xb
+	.uleb128 0x3
+	.uleb128 0x1f
+	.uleb128 0x1b
+	.uleb128 0x1f
+	.uleb128 0x11
+	.uleb128 0x1
+	.uleb128 0x12
+	.uleb128 0x7
+	.uleb128 0x10
+	.uleb128 0x17
+	.byte	0
+	.byte	0
+	.uleb128 0x21
+	.uleb128 0x24
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x3e
+	.uleb128 0xb
+	.uleb128 0x3
+	.uleb128 0x8
+	.byte	0
+	.byte	0
+	.uleb128 0x22
+	.uleb128 0x26
+	.byte	0
+	.byte	0
+	.byte	0
+	.uleb128 0x23
+	.uleb128 0xf
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x24
+	.uleb128 0x13
+	.byte	0x1
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x88
+	.uleb128 0xb
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x25
+	.uleb128 0x15
+	.byte	0x1
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x26
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x3c
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x27
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x3c
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x28
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x3c
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x29
+	.uleb128 0x5
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x2
+	.uleb128 0x17
+	.uleb128 0x2137
+	.uleb128 0x17
+	.byte	0
+	.byte	0
+	.uleb128 0x2a
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x2
+	.uleb128 0x18
+	.byte	0
+	.byte	0
+	.uleb128 0x2b
+	.uleb128 0xa
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x11
+	.uleb128 0x1
+	.byte	0
+	.byte	0
+	.uleb128 0x2c
+	.uleb128 0x1d
+	.byte	0x1
+	.uleb128 0x31
+	.uleb128 0x13
+	.uleb128 0x52
+	.uleb128 0x1
+	.uleb128 0x2138
+	.uleb128 0xb
+	.uleb128 0x55
+	.uleb128 0x17
+	.uleb128 0x58
+	.uleb128 0xb
+	.uleb128 0x59
+	.uleb128 0xb
+	.uleb128 0x57
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x2d
+	.uleb128 0x1d
+	.byte	0x1
+	.uleb128 0x31
+	.uleb128 0x13
+	.uleb128 0x52
+	.uleb128 0x1
+	.uleb128 0x2138
+	.uleb128 0xb
+	.uleb128 0x11
+	.uleb128 0x1
+	.uleb128 0x12
+	.uleb128 0x7
+	.uleb128 0x58
+	.uleb128 0xb
+	.uleb128 0x59
+	.uleb128 0xb
+	.uleb128 0x57
+	.uleb128 0xb
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x2e
+	.uleb128 0x48
+	.byte	0
+	.uleb128 0x7d
+	.uleb128 0x1
+	.uleb128 0x7f
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x2f
+	.uleb128 0x48
+	.byte	0x1
+	.uleb128 0x7d
+	.uleb128 0x1
+	.uleb128 0x82
+	.uleb128 0x19
+	.uleb128 0x7f
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x30
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x11
+	.uleb128 0x1
+	.uleb128 0x12
+	.uleb128 0x7
+	.uleb128 0x40
+	.uleb128 0x18
+	.uleb128 0x7a
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x31
+	.uleb128 0x1d
+	.byte	0x1
+	.uleb128 0x31
+	.uleb128 0x13
+	.uleb128 0x52
+	.uleb128 0x1
+	.uleb128 0x2138
+	.uleb128 0xb
+	.uleb128 0x11
+	.uleb128 0x1
+	.uleb128 0x12
+	.uleb128 0x7
+	.uleb128 0x58
+	.uleb128 0xb
+	.uleb128 0x59
+	.uleb128 0xb
+	.uleb128 0x57
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x32
+	.uleb128 0x1
+	.byte	0x1
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x88
+	.uleb128 0xb
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x33
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x20
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.byte	0
+	.section	.debug_loclists,"",@progbits
+	.long	.Ldebug_loc3-.Ldebug_loc2
+.Ldebug_loc2:
+	.value	0x5
+	.byte	0x8
+	.byte	0
+	.long	0
+.Ldebug_loc0:
+.LVUS23:
+	.uleb128 0
+	.uleb128 .LVU165
+	.uleb128 .LVU165
+	.uleb128 .LVU297
+	.uleb128 .LVU297
+	.uleb128 .LVU299
+	.uleb128 .LVU299
+	.uleb128 0
+.LLST23:
+	.byte	0x4
+	.uleb128 .LVL36-.Ltext0
+	.uleb128 .LVL39-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL39-.Ltext0
+	.uleb128 .LVL66-.Ltext0
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -328
+	.byte	0x4
+	.uleb128 .LVL66-.Ltext0
+	.uleb128 .LVL67-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL67-.Ltext0
+	.uleb128 .LFE28-.Ltext0
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -328
+	.byte	0
+.LVUS24:
+	.uleb128 0
+	.uleb128 .LVU181
+	.uleb128 .LVU181
+	.uleb128 .LVU256
+	.uleb128 .LVU256
+	.uleb128 .LVU266
+	.uleb128 .LVU266
+	.uleb128 .LVU289
+	.uleb128 .LVU297
+	.uleb128 .LVU300
+	.uleb128 .LVU300
+	.uleb128 .LVU309
+	.uleb128 .LVU309
+	.uleb128 0
+.LLST24:
+	.byte	0x4
+	.uleb128 .LVL36-.Ltext0
+	.uleb128 .LVL42-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x4
+	.uleb128 .LVL42-1-.Ltext0
+	.uleb128 .LVL54-.Ltext0
+	.uleb128 0x1
+	.byte	0x5e
+	.byte	0x4
+	.uleb128 .LVL54-.Ltext0
+	.uleb128 .LVL58-.Ltext0
+	.uleb128 0x1
+	.byte	0x5f
+	.byte	0x4
+	.uleb128 .LVL58-.Ltext0
+	.uleb128 .LVL60-.Ltext0
+	.uleb128 0x1
+	.byte	0x5e
+	.byte	0x4
+	.uleb128 .LVL66-.Ltext0
+	.uleb128 .LVL68-.Ltext0
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x4
+	.uleb128 .LVL68-.Ltext0
+	.uleb128 .LVL73-.Ltext0
+	.uleb128 0x1
+	.byte	0x5f
+	.byte	0x4
+	.uleb128 .LVL73-.Ltext0
+	.uleb128 .LFE28-.Ltext0
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0
+.LVUS25:
+	.uleb128 0
+	.uleb128 .LVU163
+	.uleb128 .LVU163
+	.uleb128 .LVU258
+	.uleb128 .LVU261
+	.uleb128 .LVU291
+	.uleb128 .LVU297
+	.uleb128 .LVU300
+	.uleb128 .LVU300
+	.uleb128 .LVU305
+	.uleb128 .LVU305
+	.uleb128 .LVU306
+	.uleb128 .LVU309
+	.uleb128 .LVU310
+	.uleb128 .LVU310
+	.uleb128 0
+.LLST25:
+	.byte	0x4
+	.uleb128 .LVL36-.Ltext0
+	.uleb128 .LVL38-.Ltext0
+	.uleb128 0x1
+	.byte	0x51
+	.byte	0x4
+	.uleb128 .LVL38-.Ltext0
+	.uleb128 .LVL55-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0x4
+	.uleb128 .LVL56-.Ltext0
+	.uleb128 .LVL61-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0x4
+	.uleb128 .LVL66-.Ltext0
+	.uleb128 .LVL68-.Ltext0
+	.uleb128 0x1
+	.byte	0x51
+	.byte	0x4
+	.uleb128 .LVL68-.Ltext0
+	.uleb128 .LVL70-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0x4
+	.uleb128 .LVL70-.Ltext0
+	.uleb128 .LVL71-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x51
+	.byte	0x4
+	.uleb128 .LVL73-.Ltext0
+	.uleb128 .LVL74-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0x4
+	.uleb128 .LVL74-.Ltext0
+	.uleb128 .LFE28-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x51
+	.byte	0x9f
+	.byte	0
+.LVUS26:
+	.uleb128 0
+	.uleb128 .LVU161
+	.uleb128 .LVU161
+	.uleb128 .LVU296
+	.uleb128 .LVU296
+	.uleb128 .LVU297
+	.uleb128 .LVU297
+	.uleb128 .LVU300
+	.uleb128 .LVU300
+	.uleb128 0
+.LLST26:
+	.byte	0x4
+	.uleb128 .LVL36-.Ltext0
+	.uleb128 .LVL37-.Ltext0
+	.uleb128 0x1
+	.byte	0x52
+	.byte	0x4
+	.uleb128 .LVL37-.Ltext0
+	.uleb128 .LVL65-.Ltext0
+	.uleb128 0x1
+	.byte	0x5d
+	.byte	0x4
+	.uleb128 .LVL65-.Ltext0
+	.uleb128 .LVL66-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x52
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL66-.Ltext0
+	.uleb128 .LVL68-.Ltext0
+	.uleb128 0x1
+	.byte	0x52
+	.byte	0x4
+	.uleb128 .LVL68-.Ltext0
+	.uleb128 .LFE28-.Ltext0
+	.uleb128 0x1
+	.byte	0x5d
+	.byte	0
+.LVUS27:
+	.uleb128 0
+	.uleb128 .LVU181
+	.uleb128 .LVU181
+	.uleb128 .LVU295
+	.uleb128 .LVU295
+	.uleb128 .LVU297
+	.uleb128 .LVU297
+	.uleb128 0
+.LLST27:
+	.byte	0x4
+	.uleb128 .LVL36-.Ltext0
+	.uleb128 .LVL42-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x58
+	.byte	0x4
+	.uleb128 .LVL42-1-.Ltext0
+	.uleb128 .LVL64-.Ltext0
+	.uleb128 0x1
+	.byte	0x56
+	.byte	0x4
+	.uleb128 .LVL64-.Ltext0
+	.uleb128 .LVL66-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x58
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL66-.Ltext0
+	.uleb128 .LFE28-.Ltext0
+	.uleb128 0x1
+	.byte	0x56
+	.byte	0
+.LVUS28:
+	.uleb128 0
+	.uleb128 .LVU181
+	.uleb128 .LVU181
+	.uleb128 .LVU297
+	.uleb128 .LVU297
+	.uleb128 .LVU300
+	.uleb128 .LVU300
+	.uleb128 .LVU309
+	.uleb128 .LVU309
+	.uleb128 0
+.LLST28:
+	.byte	0x4
+	.uleb128 .LVL36-.Ltext0
+	.uleb128 .LVL42-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x59
+	.byte	0x4
+	.uleb128 .LVL42-1-.Ltext0
+	.uleb128 .LVL66-.Ltext0
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -340
+	.byte	0x4
+	.uleb128 .LVL66-.Ltext0
+	.uleb128 .LVL68-.Ltext0
+	.uleb128 0x1
+	.byte	0x59
+	.byte	0x4
+	.uleb128 .LVL68-.Ltext0
+	.uleb128 .LVL73-.Ltext0
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -340
+	.byte	0x4
+	.uleb128 .LVL73-.Ltext0
+	.uleb128 .LFE28-.Ltext0
+	.uleb128 0x1
+	.byte	0x59
+	.byte	0
+.LVUS29:
+	.uleb128 .LVU165
+	.uleb128 .LVU180
+	.uleb128 .LVU252
+	.uleb128 .LVU263
+	.uleb128 .LVU286
+	.uleb128 .LVU289
+	.uleb128 .LVU309
+	.uleb128 0
+.LLST29:
+	.byte	0x4
+	.uleb128 .LVL39-.Ltext0
+	.uleb128 .LVL41-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL53-.Ltext0
+	.uleb128 .LVL57-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL59-.Ltext0
+	.uleb128 .LVL60-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL73-.Ltext0
+	.uleb128 .LFE28-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0
+.LVUS30:
+	.uleb128 .LVU181
+	.uleb128 .LVU185
+.LLST30:
+	.byte	0x4
+	.uleb128 .LVL42-.Ltext0
+	.uleb128 .LVL43-.Ltext0
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -352
+	.byte	0
+.LVUS31:
+	.uleb128 .LVU190
+	.uleb128 .LVU196
+	.uleb128 .LVU196
+	.uleb128 .LVU294
+	.uleb128 .LVU300
+	.uleb128 .LVU309
+.LLST31:
+	.byte	0x4
+	.uleb128 .LVL45-.Ltext0
+	.uleb128 .LVL46-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL46-.Ltext0
+	.uleb128 .LVL63-.Ltext0
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -336
+	.byte	0x4
+	.uleb128 .LVL68-.Ltext0
+	.uleb128 .LVL73-.Ltext0
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -336
+	.byte	0
+.LVUS32:
+	.uleb128 .LVU167
+	.uleb128 .LVU291
+	.uleb128 .LVU291
+	.uleb128 .LVU294
+	.uleb128 .LVU300
+	.uleb128 .LVU308
+	.uleb128 .LVU308
+	.uleb128 .LVU309
+	.uleb128 .LVU309
+	.uleb128 0
+.LLST32:
+	.byte	0x4
+	.uleb128 .LVL39-.Ltext0
+	.uleb128 .LVL61-.Ltext0
+	.uleb128 0x3
+	.byte	0x9
+	.byte	0xff
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL61-.Ltext0
+	.uleb128 .LVL63-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0x4
+	.uleb128 .LVL68-.Ltext0
+	.uleb128 .LVL72-.Ltext0
+	.uleb128 0x3
+	.byte	0x9
+	.byte	0xff
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL72-.Ltext0
+	.uleb128 .LVL73-.Ltext0
+	.uleb128 0x2
+	.byte	0x30
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL73-.Ltext0
+	.uleb128 .LFE28-.Ltext0
+	.uleb128 0x3
+	.byte	0x9
+	.byte	0xff
+	.byte	0x9f
+	.byte	0
+.LVUS35:
+	.uleb128 .LVU201
+	.uleb128 .LVU215
+.LLST35:
+	.byte	0x4
+	.uleb128 .LVL47-.Ltext0
+	.uleb128 .LVL50-.Ltext0
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -352
+	.byte	0
+.LVUS37:
+	.uleb128 .LVU202
+	.uleb128 .LVU215
+.LLST37:
+	.byte	0x4
+	.uleb128 .LVL47-.Ltext0
+	.uleb128 .LVL50-.Ltext0
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -340
+	.byte	0
+.LVUS38:
+	.uleb128 .LVU202
+	.uleb128 .LVU215
+.LLST38:
+	.byte	0x4
+	.uleb128 .LVL47-.Ltext0
+	.uleb128 .LVL50-.Ltext0
+	.uleb128 0x1
+	.byte	0x56
+	.byte	0
+.LVUS39:
+	.uleb128 .LVU202
+	.uleb128 .LVU215
+.LLST39:
+	.byte	0x4
+	.uleb128 .LVL47-.Ltext0
+	.uleb128 .LVL50-.Ltext0
+	.uleb128 0x1
+	.byte	0x5c
+	.byte	0
+.LVUS40:
+	.uleb128 .LVU202
+	.uleb128 .LVU215
+.LLST40:
+	.byte	0x4
+	.uleb128 .LVL47-.Ltext0
+	.uleb128 .LVL50-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0
+.LVUS41:
+	.uleb128 .LVU202
+	.uleb128 .LVU215
+.LLST41:
+	.byte	0x4
+	.uleb128 .LVL47-.Ltext0
+	.uleb128 .LVL50-.Ltext0
+	.uleb128 0x1
+	.byte	0x5e
+	.byte	0
+.LVUS42:
+	.uleb128 .LVU202
+	.uleb128 .LVU215
+.LLST42:
+	.byte	0x4
+	.uleb128 .LVL47-.Ltext0
+	.uleb128 .LVL50-.Ltext0
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -352
+	.byte	0
+.LVUS44:
+	.uleb128 .LVU206
+	.uleb128 .LVU210
+	.uleb128 .LVU210
+	.uleb128 .LVU212
+.LLST44:
+	.byte	0x4
+	.uleb128 .LVL47-.Ltext0
+	.uleb128 .LVL48-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL48-.Ltext0
+	.uleb128 .LVL49-.Ltext0
+	.uleb128 0x2
+	.byte	0x30
+	.byte	0x9f
+	.byte	0
+.LVUS45:
+	.uleb128 .LVU206
+	.uleb128 .LVU212
+.LLST45:
+	.byte	0x4
+	.uleb128 .LVL47-.Ltext0
+	.uleb128 .LVL49-.Ltext0
+	.uleb128 0x1
+	.byte	0x5c
+	.byte	0
+.LVUS33:
+	.uleb128 .LVU168
+	.uleb128 .LVU177
+	.uleb128 .LVU309
+	.uleb128 .LVU310
+.LLST33:
+	.byte	0x4
+	.uleb128 .LVL39-.Ltext0
+	.uleb128 .LVL40-.Ltext0
+	.uleb128 0x1
+	.byte	0x5d
+	.byte	0x4
+	.uleb128 .LVL73-.Ltext0
+	.uleb128 .LVL74-.Ltext0
+	.uleb128 0x1
+	.byte	0x5d
+	.byte	0
+.LVUS46:
+	.uleb128 0
+	.uleb128 .LVU314
+	.uleb128 .LVU314
+	.uleb128 0
+.LLST46:
+	.byte	0x4
+	.uleb128 .LVL75-.Ltext0
+	.uleb128 .LVL76-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL76-1-.Ltext0
+	.uleb128 .LFE27-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x9f
+	.byte	0
+.LVUS47:
+	.uleb128 0
+	.uleb128 .LVU314
+	.uleb128 .LVU314
+	.uleb128 0
+.LLST47:
+	.byte	0x4
+	.uleb128 .LVL75-.Ltext0
+	.uleb128 .LVL76-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x4
+	.uleb128 .LVL76-1-.Ltext0
+	.uleb128 .LFE27-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x9f
+	.byte	0
+.LVUS48:
+	.uleb128 0
+	.uleb128 .LVU314
+	.uleb128 .LVU314
+	.uleb128 0
+.LLST48:
+	.byte	0x4
+	.uleb128 .LVL75-.Ltext0
+	.uleb128 .LVL76-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x51
+	.byte	0x4
+	.uleb128 .LVL76-1-.Ltext0
+	.uleb128 .LFE27-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x51
+	.byte	0x9f
+	.byte	0
+.LVUS49:
+	.uleb128 0
+	.uleb128 .LVU314
+	.uleb128 .LVU314
+	.uleb128 0
+.LLST49:
+	.byte	0x4
+	.uleb128 .LVL75-.Ltext0
+	.uleb128 .LVL76-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x52
+	.byte	0x4
+	.uleb128 .LVL76-1-.Ltext0
+	.uleb128 .LFE27-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x52
+	.byte	0x9f
+	.byte	0
+.LVUS50:
+	.uleb128 0
+	.uleb128 .LVU314
+	.uleb128 .LVU314
+	.uleb128 0
+.LLST50:
+	.byte	0x4
+	.uleb128 .LVL75-.Ltext0
+	.uleb128 .LVL76-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x58
+	.byte	0x4
+	.uleb128 .LVL76-1-.Ltext0
+	.uleb128 .LFE27-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x58
+	.byte	0x9f
+	.byte	0
+.LVUS17:
+	.uleb128 0
+	.uleb128 .LVU116
+	.uleb128 .LVU116
+	.uleb128 .LVU150
+	.uleb128 .LVU150
+	.uleb128 0
+.LLST17:
+	.byte	0x4
+	.uleb128 .LVL25-.Ltext0
+	.uleb128 .LVL27-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL27-.Ltext0
+	.uleb128 .LVL35-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL35-1-.Ltext0
+	.uleb128 .LFE25-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x9f
+	.byte	0
+.LVUS18:
+	.uleb128 0
+	.uleb128 .LVU112
+	.uleb128 .LVU112
+	.uleb128 .LVU117
+	.uleb128 .LVU117
+	.uleb128 0
+.LLST18:
+	.byte	0x4
+	.uleb128 .LVL25-.Ltext0
+	.uleb128 .LVL26-.Ltext0
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x4
+	.uleb128 .LVL26-.Ltext0
+	.uleb128 .LVL28-.Ltext0
+	.uleb128 0x1
+	.byte	0x52
+	.byte	0x4
+	.uleb128 .LVL28-.Ltext0
+	.uleb128 .LFE25-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x9f
+	.byte	0
+.LVUS19:
+	.uleb128 .LVU107
+	.uleb128 .LVU116
+	.uleb128 .LVU116
+	.uleb128 .LVU150
+	.uleb128 .LVU150
+	.uleb128 0
+.LLST19:
+	.byte	0x4
+	.uleb128 .LVL25-.Ltext0
+	.uleb128 .LVL27-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL27-.Ltext0
+	.uleb128 .LVL35-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL35-1-.Ltext0
+	.uleb128 .LFE25-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x9f
+	.byte	0
+.LVUS20:
+	.uleb128 .LVU117
+	.uleb128 .LVU149
+	.uleb128 .LVU149
+	.uleb128 .LVU150
+.LLST20:
+	.byte	0x4
+	.uleb128 .LVL28-.Ltext0
+	.uleb128 .LVL34-.Ltext0
+	.uleb128 0x1
+	.byte	0x52
+	.byte	0x4
+	.uleb128 .LVL34-.Ltext0
+	.uleb128 .LVL35-1-.Ltext0
+	.uleb128 0x8
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x70
+	.sleb128 56
+	.byte	0x6
+	.byte	0x1e
+	.byte	0x9f
+	.byte	0
+.LVUS21:
+	.uleb128 .LVU130
+	.uleb128 .LVU132
+	.uleb128 .LVU132
+	.uleb128 .LVU143
+	.uleb128 .LVU143
+	.uleb128 .LVU149
+	.uleb128 .LVU149
+	.uleb128 .LVU150
+.LLST21:
+	.byte	0x4
+	.uleb128 .LVL29-.Ltext0
+	.uleb128 .LVL30-.Ltext0
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x4
+	.uleb128 .LVL30-.Ltext0
+	.uleb128 .LVL32-.Ltext0
+	.uleb128 0x1
+	.byte	0x58
+	.byte	0x4
+	.uleb128 .LVL32-.Ltext0
+	.uleb128 .LVL34-.Ltext0
+	.uleb128 0x2f
+	.byte	0x70
+	.sleb128 48
+	.byte	0x6
+	.byte	0x72
+	.sleb128 0
+	.byte	0x1c
+	.byte	0x70
+	.sleb128 56
+	.byte	0x6
+	.byte	0x70
+	.sleb128 48
+	.byte	0x6
+	.byte	0x72
+	.sleb128 0
+	.byte	0x1c
+	.byte	0x23
+	.uleb128 0x8000000000000000
+	.byte	0x70
+	.sleb128 56
+	.byte	0x6
+	.byte	0x23
+	.uleb128 0x8000000000000000
+	.byte	0x2c
+	.byte	0x28
+	.value	0x1
+	.byte	0x16
+	.byte	0x13
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL34-.Ltext0
+	.uleb128 .LVL35-1-.Ltext0
+	.uleb128 0x39
+	.byte	0x70
+	.sleb128 48
+	.byte	0x6
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x70
+	.sleb128 56
+	.byte	0x6
+	.byte	0x1e
+	.byte	0x1c
+	.byte	0x70
+	.sleb128 56
+	.byte	0x6
+	.byte	0x70
+	.sleb128 48
+	.byte	0x6
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x70
+	.sleb128 56
+	.byte	0x6
+	.byte	0x1e
+	.byte	0x1c
+	.byte	0x23
+	.uleb128 0x8000000000000000
+	.byte	0x70
+	.sleb128 56
+	.byte	0x6
+	.byte	0x23
+	.uleb128 0x8000000000000000
+	.byte	0x2c
+	.byte	0x28
+	.value	0x1
+	.byte	0x16
+	.byte	0x13
+	.byte	0x9f
+	.byte	0
+.LVUS22:
+	.uleb128 .LVU133
+	.uleb128 .LVU147
+	.uleb128 .LVU147
+	.uleb128 .LVU149
+	.uleb128 .LVU149
+	.uleb128 .LVU150
+.LLST22:
+	.byte	0x4
+	.uleb128 .LVL31-.Ltext0
+	.uleb128 .LVL33-.Ltext0
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x4
+	.uleb128 .LVL33-.Ltext0
+	.uleb128 .LVL34-.Ltext0
+	.uleb128 0x7
+	.byte	0x70
+	.sleb128 40
+	.byte	0x6
+	.byte	0x72
+	.sleb128 0
+	.byte	0x1e
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL34-.Ltext0
+	.uleb128 .LVL35-1-.Ltext0
+	.uleb128 0xc
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x70
+	.sleb128 56
+	.byte	0x6
+	.byte	0x1e
+	.byte	0x70
+	.sleb128 40
+	.byte	0x6
+	.byte	0x1e
+	.byte	0x9f
+	.byte	0
+.LVUS0:
+	.uleb128 0
+	.uleb128 .LVU8
+	.uleb128 .LVU8
+	.uleb128 0
+.LLST0:
+	.byte	0x4
+	.uleb128 .LVL0-.Ltext0
+	.uleb128 .LVL1-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL1-.Ltext0
+	.uleb128 .LFE24-.Ltext0
+	.uleb128 0x4
+	.byte	0x91
+	.sleb128 -10424
+	.byte	0
+.LVUS1:
+	.uleb128 0
+	.uleb128 .LVU37
+	.uleb128 .LVU37
+	.uleb128 .LVU103
+	.uleb128 .LVU103
+	.uleb128 0
+.LLST1:
+	.byte	0x4
+	.uleb128 .LVL0-.Ltext0
+	.uleb128 .LVL7-.Ltext0
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x4
+	.uleb128 .LVL7-.Ltext0
+	.uleb128 .LVL24-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL24-.Ltext0
+	.uleb128 .LFE24-.Ltext0
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0
+.LVUS2:
+	.uleb128 0
+	.uleb128 .LVU22
+	.uleb128 .LVU22
+	.uleb128 .LVU37
+	.uleb128 .LVU37
+	.uleb128 .LVU103
+	.uleb128 .LVU103
+	.uleb128 0
+.LLST2:
+	.byte	0x4
+	.uleb128 .LVL0-.Ltext0
+	.uleb128 .LVL4-.Ltext0
+	.uleb128 0x1
+	.byte	0x51
+	.byte	0x4
+	.uleb128 .LVL4-.Ltext0
+	.uleb128 .LVL7-.Ltext0
+	.uleb128 0x1
+	.byte	0x5a
+	.byte	0x4
+	.uleb128 .LVL7-.Ltext0
+	.uleb128 .LVL24-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x51
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL24-.Ltext0
+	.uleb128 .LFE24-.Ltext0
+	.uleb128 0x1
+	.byte	0x51
+	.byte	0
+.LVUS3:
+	.uleb128 0
+	.uleb128 .LVU9
+	.uleb128 .LVU9
+	.uleb128 .LVU36
+	.uleb128 .LVU36
+	.uleb128 .LVU37
+	.uleb128 .LVU37
+	.uleb128 .LVU103
+	.uleb128 .LVU103
+	.uleb128 0
+.LLST3:
+	.byte	0x4
+	.uleb128 .LVL0-.Ltext0
+	.uleb128 .LVL2-.Ltext0
+	.uleb128 0x1
+	.byte	0x52
+	.byte	0x4
+	.uleb128 .LVL2-.Ltext0
+	.uleb128 .LVL6-.Ltext0
+	.uleb128 0x1
+	.byte	0x5f
+	.byte	0x4
+	.uleb128 .LVL6-.Ltext0
+	.uleb128 .LVL7-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL7-.Ltext0
+	.uleb128 .LVL24-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x52
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL24-.Ltext0
+	.uleb128 .LFE24-.Ltext0
+	.uleb128 0x1
+	.byte	0x5f
+	.byte	0
+.LVUS4:
+	.uleb128 0
+	.uleb128 .LVU37
+	.uleb128 .LVU37
+	.uleb128 .LVU103
+	.uleb128 .LVU103
+	.uleb128 0
+.LLST4:
+	.byte	0x4
+	.uleb128 .LVL0-.Ltext0
+	.uleb128 .LVL7-.Ltext0
+	.uleb128 0x1
+	.byte	0x58
+	.byte	0x4
+	.uleb128 .LVL7-.Ltext0
+	.uleb128 .LVL24-.Ltext0
+	.uleb128 0x4
+	.byte	0x91
+	.sleb128 -10440
+	.byte	0x4
+	.uleb128 .LVL24-.Ltext0
+	.uleb128 .LFE24-.Ltext0
+	.uleb128 0x1
+	.byte	0x58
+	.byte	0
+.LVUS5:
+	.uleb128 .LVU19
+	.uleb128 .LVU48
+	.uleb128 .LVU48
+	.uleb128 .LVU52
+	.uleb128 .LVU52
+	.uleb128 .LVU91
+	.uleb128 .LVU94
+	.uleb128 .LVU95
+	.uleb128 .LVU95
+	.uleb128 .LVU96
+	.uleb128 .LVU96
+	.uleb128 .LVU103
+.LLST5:
+	.byte	0x4
+	.uleb128 .LVL3-.Ltext0
+	.uleb128 .LVL9-.Ltext0
+	.uleb128 0x1
+	.byte	0x5c
+	.byte	0x4
+	.uleb128 .LVL9-.Ltext0
+	.uleb128 .LVL11-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL11-.Ltext0
+	.uleb128 .LVL18-.Ltext0
+	.uleb128 0x1
+	.byte	0x5f
+	.byte	0x4
+	.uleb128 .LVL19-.Ltext0
+	.uleb128 .LVL20-.Ltext0
+	.uleb128 0x1
+	.byte	0x5f
+	.byte	0x4
+	.uleb128 .LVL20-.Ltext0
+	.uleb128 .LVL21-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL21-.Ltext0
+	.uleb128 .LVL24-.Ltext0
+	.uleb128 0x1
+	.byte	0x5c
+	.byte	0
+.LVUS6:
+	.uleb128 .LVU26
+	.uleb128 .LVU37
+	.uleb128 .LVU37
+	.uleb128 .LVU91
+	.uleb128 .LVU94
+	.uleb128 .LVU103
+.LLST6:
+	.byte	0x4
+	.uleb128 .LVL5-.Ltext0
+	.uleb128 .LVL7-.Ltext0
+	.uleb128 0x1
+	.byte	0x51
+	.byte	0x4
+	.uleb128 .LVL7-.Ltext0
+	.uleb128 .LVL18-.Ltext0
+	.uleb128 0x8
+	.byte	0x91
+	.sleb128 -10416
+	.byte	0x6
+	.byte	0x23
+	.uleb128 0x1
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL19-.Ltext0
+	.uleb128 .LVL24-.Ltext0
+	.uleb128 0x8
+	.byte	0x91
+	.sleb128 -10416
+	.byte	0x6
+	.byte	0x23
+	.uleb128 0x1
+	.byte	0x9f
+	.byte	0
+.LVUS10:
+	.uleb128 .LVU37
+	.uleb128 .LVU49
+	.uleb128 .LVU49
+	.uleb128 .LVU91
+	.uleb128 .LVU94
+	.uleb128 .LVU96
+	.uleb128 .LVU96
+	.uleb128 .LVU100
+	.uleb128 .LVU100
+	.uleb128 .LVU102
+	.uleb128 .LVU102
+	.uleb128 .LVU103
+.LLST10:
+	.byte	0x4
+	.uleb128 .LVL7-.Ltext0
+	.uleb128 .LVL10-.Ltext0
+	.uleb128 0x1
+	.byte	0x5f
+	.byte	0x4
+	.uleb128 .LVL10-.Ltext0
+	.uleb128 .LVL18-.Ltext0
+	.uleb128 0x1
+	.byte	0x5c
+	.byte	0x4
+	.uleb128 .LVL19-.Ltext0
+	.uleb128 .LVL21-.Ltext0
+	.uleb128 0x1
+	.byte	0x5c
+	.byte	0x4
+	.uleb128 .LVL21-.Ltext0
+	.uleb128 .LVL22-.Ltext0
+	.uleb128 0x1
+	.byte	0x5f
+	.byte	0x4
+	.uleb128 .LVL22-.Ltext0
+	.uleb128 .LVL23-.Ltext0
+	.uleb128 0x3
+	.byte	0x7f
+	.sleb128 -64
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL23-.Ltext0
+	.uleb128 .LVL24-.Ltext0
+	.uleb128 0x1
+	.byte	0x5f
+	.byte	0
+.LVUS12:
+	.uleb128 .LVU43
+	.uleb128 .LVU52
+	.uleb128 .LVU52
+	.uleb128 .LVU91
+	.uleb128 .LVU94
+	.uleb128 .LVU96
+.LLST12:
+	.byte	0x4
+	.uleb128 .LVL8-.Ltext0
+	.uleb128 .LVL11-.Ltext0
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x4
+	.uleb128 .LVL11-.Ltext0
+	.uleb128 .LVL18-.Ltext0
+	.uleb128 0x4
+	.byte	0x91
+	.sleb128 -10448
+	.byte	0x4
+	.uleb128 .LVL19-.Ltext0
+	.uleb128 .LVL21-.Ltext0
+	.uleb128 0x4
+	.byte	0x91
+	.sleb128 -10448
+	.byte	0
+.LVUS14:
+	.uleb128 .LVU45
+	.uleb128 .LVU52
+	.uleb128 .LVU52
+	.uleb128 .LVU63
+	.uleb128 .LVU63
+	.uleb128 .LVU75
+	.uleb128 .LVU75
+	.uleb128 .LVU91
+	.uleb128 .LVU94
+	.uleb128 .LVU96
+.LLST14:
+	.byte	0x4
+	.uleb128 .LVL8-.Ltext0
+	.uleb128 .LVL11-.Ltext0
+	.uleb128 0x2
+	.byte	0x30
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL11-.Ltext0
+	.uleb128 .LVL12-.Ltext0
+	.uleb128 0x1
+	.byte	0x56
+	.byte	0x4
+	.uleb128 .LVL12-.Ltext0
+	.uleb128 .LVL14-.Ltext0
+	.uleb128 0x3
+	.byte	0x76
+	.sleb128 -1
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL14-.Ltext0
+	.uleb128 .LVL18-.Ltext0
+	.uleb128 0x1
+	.byte	0x56
+	.byte	0x4
+	.uleb128 .LVL19-.Ltext0
+	.uleb128 .LVL21-.Ltext0
+	.uleb128 0x1
+	.byte	0x56
+	.byte	0
+.LVUS16:
+	.uleb128 .LVU52
+	.uleb128 .LVU66
+	.uleb128 .LVU66
+	.uleb128 .LVU76
+	.uleb128 .LVU79
+	.uleb128 .LVU91
+	.uleb128 .LVU94
+	.uleb128 .LVU96
+.LLST16:
+	.byte	0x4
+	.uleb128 .LVL11-.Ltext0
+	.uleb128 .LVL13-.Ltext0
+	.uleb128 0x7
+	.byte	0x7e
+	.sleb128 0
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x1c
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL13-.Ltext0
+	.uleb128 .LVL15-.Ltext0
+	.uleb128 0x8
+	.byte	0x73
+	.sleb128 -24
+	.byte	0x6
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x1c
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL16-.Ltext0
+	.uleb128 .LVL18-.Ltext0
+	.uleb128 0x7
+	.byte	0x7e
+	.sleb128 0
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x1c
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL19-.Ltext0
+	.uleb128 .LVL21-.Ltext0
+	.uleb128 0x8
+	.byte	0x73
+	.sleb128 -24
+	.byte	0x6
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x1c
+	.byte	0x9f
+	.byte	0
+.LVUS8:
+	.uleb128 .LVU27
+	.uleb128 .LVU36
+	.uleb128 .LVU36
+	.uleb128 .LVU37
+.LLST8:
+	.byte	0x4
+	.uleb128 .LVL5-.Ltext0
+	.uleb128 .LVL6-.Ltext0
+	.uleb128 0x1
+	.byte	0x5f
+	.byte	0x4
+	.uleb128 .LVL6-.Ltext0
+	.uleb128 .LVL7-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0
+.Ldebug_loc3:
+	.section	.debug_aranges,"",@progbits
+	.long	0x2c
+	.value	0x2
+	.long	.Ldebug_info0
+	.byte	0x8
+	.byte	0
+	.value	0
+	.value	0
+	.quad	.Ltext0
+	.quad	.Letext0-.Ltext0
+	.quad	0
+	.quad	0
+	.section	.debug_rnglists,"",@progbits
+.Ldebug_ranges0:
+	.long	.Ldebug_ranges3-.Ldebug_ranges2
+.Ldebug_ranges2:
+	.value	0x5
+	.byte	0x8
+	.byte	0
+	.long	0
+.LLRL7:
+	.byte	0x4
+	.uleb128 .LBB15-.Ltext0
+	.uleb128 .LBE15-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB19-.Ltext0
+	.uleb128 .LBE19-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB36-.Ltext0
+	.uleb128 .LBE36-.Ltext0
+	.byte	0
+.LLRL9:
+	.byte	0x4
+	.uleb128 .LBB22-.Ltext0
+	.uleb128 .LBE22-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB35-.Ltext0
+	.uleb128 .LBE35-.Ltext0
+	.byte	0
+.LLRL11:
+	.byte	0x4
+	.uleb128 .LBB23-.Ltext0
+	.uleb128 .LBE23-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB33-.Ltext0
+	.uleb128 .LBE33-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB34-.Ltext0
+	.uleb128 .LBE34-.Ltext0
+	.byte	0
+.LLRL13:
+	.byte	0x4
+	.uleb128 .LBB24-.Ltext0
+	.uleb128 .LBE24-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB31-.Ltext0
+	.uleb128 .LBE31-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB32-.Ltext0
+	.uleb128 .LBE32-.Ltext0
+	.byte	0
+.LLRL15:
+	.byte	0x4
+	.uleb128 .LBB25-.Ltext0
+	.uleb128 .LBE25-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB26-.Ltext0
+	.uleb128 .LBE26-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB27-.Ltext0
+	.uleb128 .LBE27-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB28-.Ltext0
+	.uleb128 .LBE28-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB29-.Ltext0
+	.uleb128 .LBE29-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB30-.Ltext0
+	.uleb128 .LBE30-.Ltext0
+	.byte	0
+.LLRL34:
+	.byte	0x4
+	.uleb128 .LBB46-.Ltext0
+	.uleb128 .LBE46-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB61-.Ltext0
+	.uleb128 .LBE61-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB62-.Ltext0
+	.uleb128 .LBE62-.Ltext0
+	.byte	0
+.LLRL36:
+	.byte	0x4
+	.uleb128 .LBB47-.Ltext0
+	.uleb128 .LBE47-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB58-.Ltext0
+	.uleb128 .LBE58-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB59-.Ltext0
+	.uleb128 .LBE59-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB60-.Ltext0
+	.uleb128 .LBE60-.Ltext0
+	.byte	0
+.LLRL43:
+	.byte	0x4
+	.uleb128 .LBB49-.Ltext0
+	.uleb128 .LBE49-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB53-.Ltext0
+	.uleb128 .LBE53-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB54-.Ltext0
+	.uleb128 .LBE54-.Ltext0
+	.byte	0
+.Ldebug_ranges3:
+	.section	.debug_line,"",@progbits
+.Ldebug_line0:
+	.section	.debug_str,"MS",@progbits,1
+.LASF42:
+	.string	"malloc"
+.LASF26:
+	.string	"salt"
+.LASF9:
+	.string	"size_t"
+.LASF17:
+	.string	"uint64_t"
+.LASF10:
+	.string	"__uint8_t"
+.LASF30:
+	.string	"long long unsigned int"
+.LASF32:
+	.string	"blake2s_sigma"
+.LASF39:
+	.string	"blake2s_final"
+.LASF25:
+	.string	"inner_len"
+.LASF38:
+	.string	"free"
+.LASF4:
+	.string	"long long int"
+.LASF8:
+	.string	"signed char"
+.LASF52:
+	.string	"blake2s_ctx"
+.LASF29:
+	.string	"buf_len"
+.LASF41:
+	.string	"blake2s_lanes_run"
+.LASF34:
+	.string	"blake2s_job"
+.LASF3:
+	.string	"long int"
+.LASF19:
+	.string	"key_len"
+.LASF55:
+	.string	"btree_check"
+.LASF12:
+	.string	"__uint32_t"
+.LASF36:
+	.string	"span"
+.LASF7:
+	.string	"unsigned int"
+.LASF2:
+	.string	"long unsigned int"
+.LASF6:
+	.string	"short unsigned int"
+.LASF21:
+	.string	"depth"
+.LASF35:
+	.string	"btree_level"
+.LASF51:
+	.string	"GNU C99 12.2.0 -mtune=generic -march=x86-64 -g -O3 -std=c99 -fasynchronous-unwind-tables"
+.LASF46:
+	.string	"blake2s_tree_parallel"
+.LASF24:
+	.string	"node_depth"
+.LASF49:
+	.string	"blake2s_tree_nodes"
+.LASF33:
+	.string	"blake2s_param"
+.LASF53:
+	.string	"_out"
+.LASF44:
+	.string	"nthreads"
+.LASF13:
+	.string	"__uint64_t"
+.LASF20:
+	.string	"fanout"
+.LASF54:
+	.string	"btree_task"
+.LASF5:
+	.string	"unsigned char"
+.LASF22:
+	.string	"leaf_len"
+.LASF11:
+	.string	"short int"
+.LASF18:
+	.string	"digest_len"
+.LASF47:
+	.string	"blake2s_tree"
+.LASF16:
+	.string	"uint32_t"
+.LASF48:
+	.string	"first"
+.LASF43:
+	.string	"blake2s_init_param"
+.LASF14:
+	.string	"char"
+.LASF50:
+	.string	"btree_span"
+.LASF28:
+	.string	"last_node"
+.LASF27:
+	.string	"personal"
+.LASF37:
+	.string	"blake2s_pool_run"
+.LASF15:
+	.string	"uint8_t"
+.LASF40:
+	.string	"blake2s_update"
+.LASF23:
+	.string	"node_offset"
+.LASF31:
+	.string	"blake2s_iv"
+.LASF45:
+	.string	"root"
+	.section	.debug_line_str,"MS",@progbits,1
+.LASF1:
+	.string	"/root/repo"
+.LASF0:
+	.string	"blake2s-tree.c"
+	.ident	"GCC: (Debian 12.2.0-14+deb12u1) 12.2.0"
+	.section	.note.GNU-stack,"",@progbits
@@ -0,0 +1,294 @@
+#define _XOPEN_SOURCE 700
+#define _DEFAULT_SOURCE /* syscall() */
+
+#include <errno.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+
+#include "blake2s.h"
+#include "blake2s-internal.h"
+
+/* Asynchronous file hashing with io_uring
+ *
+ * B2S_URING_DEPTH reads of B2S_URING_CHUNK bytes are kept in flight
+ * against a regular file, into buffers registered with the ring when
+ * the memlock limit allows. Reads complete in any order; chunk k lives
+ * in slot k % B2S_URING_DEPTH and is hashed once every chunk before it
+ * has been, then its slot is reused for chunk k + B2S_URING_DEPTH.
+ *
+ * The ring is driven with raw system calls, so no liburing is needed.
+ * Without io_uring (other systems, old kernels, seccomp filters), and
+ * for files that are not regular, this is blake2s_file_pipelined().
+ */
+#ifdef __linux__
+
+#include <linux/io_uring.h>
+#include <sys/mman.h>
+#include <sys/syscall.h>
+#include <sys/uio.h>
+
+#define B2S_URING_DEPTH    8
+#define B2S_URING_INFLIGHT (8 << 20)
+
+struct bring {
+    int fd;
+    unsigned *sq_tail, *sq_mask, *sq_array;
+    unsigned *cq_head, *cq_tail, *cq_mask;
+    struct io_uring_sqe *sqes;
+    struct io_uring_cqe *cqes;
+    void *sq_map, *cq_map;
+    size_t sq_len, cq_len, sqe_len;
+    unsigned queued;        /* prepared, not yet submitted */
+    int direct;             /* round reads up to BLAKE2S_IO_ALIGN */
+};
+
+struct bring_slot {
+    uint64_t off;
+    size_t want, got;
+};
+
+static int bring_setup(struct bring *R, unsigned entries)
+{
+    struct io_uring_params p;
+    unsigned char *sq, *cq;
+
+    memset(&p, 0, sizeof(p));
+    R->fd = syscall(__NR_io_uring_setup, entries, &p);
+    if (R->fd < 0)
+        return -1;
+
+    R->sq_len = p.sq_off.array + p.sq_entries * sizeof(unsigned);
+    R->cq_len = p.cq_off.cqes + p.cq_entries * sizeof(struct io_uring_cqe);
+    if (p.features & IORING_FEAT_SINGLE_MMAP && R->cq_len > R->sq_len)
+        R->sq_len = R->cq_len;
+    R->sqe_len = p.sq_entries * sizeof(struct io_uring_sqe);
+
+    R->sq_map = mmap(NULL, R->sq_len, PROT_READ | PROT_WRITE,
+                     MAP_SHARED | MAP_POPULATE, R->fd, IORING_OFF_SQ_RING);
+    R->cq_map = R->sq_map;
+    if (R->sq_map != MAP_FAILED && !(p.features & IORING_FEAT_SINGLE_MMAP))
+        R->cq_map = mmap(NULL, R->cq_len, PROT_READ | PROT_WRITE,
+                         MAP_SHARED | MAP_POPULATE, R->fd, IORING_OFF_CQ_RING);
+    R->sqes = mmap(NULL, R->sqe_len, PROT_READ | PROT_WRITE,
+                   MAP_SHARED | MAP_POPULATE, R->fd, IORING_OFF_SQES);
+    if (R->sq_map == MAP_FAILED || R->cq_map == MAP_FAILED
+        || R->sqes == MAP_FAILED) {
+        if (R->sqes != MAP_FAILED)
+            munmap(R->sqes, R->sqe_len);
+        if (R->cq_map != MAP_FAILED && R->cq_map != R->sq_map)
+            munmap(R->cq_map, R->cq_len);
+        if (R->sq_map != MAP_FAILED)
+            munmap(R->sq_map, R->sq_len);
+        close(R->fd);
+        return -1;
+    }
+
+    sq = R->sq_map;
+    cq = R->cq_map;
+    R->sq_tail  = (unsigned *)(sq + p.sq_off.tail);
+    R->sq_mask  = (unsigned *)(sq + p.sq_off.ring_mask);
+    R->sq_array = (unsigned *)(sq + p.sq_off.array);
+    R->cq_head  = (unsigned *)(cq + p.cq_off.head);
+    R->cq_tail  = (unsigned *)(cq + p.cq_off.tail);
+    R->cq_mask  = (unsigned *)(cq + p.cq_off.ring_mask);
+    R->cqes     = (struct io_uring_cqe *)(cq + p.cq_off.cqes);
+    R->queued = 0;
+    return 0;
+}
+
+static void bring_close(struct bring *R)
+{
+    munmap(R->sqes, R->sqe_len);
+    if (R->cq_map != R->sq_map)
+        munmap(R->cq_map, R->cq_len);
+    munmap(R->sq_map, R->sq_len);
+    close(R->fd);
+}
+
+/* bring_read: queue the read of what slot `S` still misses into `buf`,
+ * registered as buffer `fixed` unless that is negative; with O_DIRECT,
+ * only ever the whole slot */
+static void bring_read(struct bring *R, int fd, const struct bring_slot *S,
+                       unsigned char *buf, int fixed, unsigned long long tag)
+{
+    unsigned tail = *R->sq_tail;
+    unsigned i = tail & *R->sq_mask;
+    struct io_uring_sqe *sqe = &R->sqes[i];
+    size_t len = S->want - S->got;
+
+    memset(sqe, 0, sizeof(*sqe));
+    sqe->opcode = fixed < 0 ? IORING_OP_READ : IORING_OP_READ_FIXED;
+    sqe->fd = fd;
+    sqe->addr = (unsigned long)(buf + S->got);
+    sqe->len = R->direct ? B2S_IO_ROUND(len) : len;
+    sqe->off = S->off + S->got;
+    sqe->buf_index = fixed < 0 ? 0 : fixed;
+    sqe->user_data = tag;
+    R->sq_array[i] = i;
+    __atomic_store_n(R->sq_tail, tail + 1, __ATOMIC_RELEASE);
+    R->queued++;
+}
+
+/* bring_enter: submit what is queued and wait for a completion */
+static int bring_enter(struct bring *R)
+{
+    while (1) {
+        int n = syscall(__NR_io_uring_enter, R->fd, R->queued, 1,
+                        IORING_ENTER_GETEVENTS, NULL, 0);
+        if (n >= 0) {
+            R->queued -= n;
+            return 0;
+        }
+        if (errno != EINTR && errno != EAGAIN && errno != EBUSY)
+            return -1;
+    }
+}
+
+/* bring_reap: take one completion, if there is any */
+static int bring_reap(struct bring *R, struct io_uring_cqe *cqe)
+{
+    unsigned head = *R->cq_head;
+
+    if (head == __atomic_load_n(R->cq_tail, __ATOMIC_ACQUIRE))
+        return 0;
+    *cqe = R->cqes[head & *R->cq_mask];
+    __atomic_store_n(R->cq_head, head + 1, __ATOMIC_RELEASE);
+    return 1;
+}
+
+/* bring_next: set up slot `S` for chunk `k` */
+static void bring_next(struct bring_slot *S, size_t k, uint64_t off,
+                       uint64_t size, size_t chunk)
+{
+    S->off = off + (uint64_t)k * chunk;
+    S->want = size - S->off < chunk ? size - S->off : chunk;
+    S->got = 0;
+}
+
+int blake2s_uring_run(struct blake2s_ctx *ctx, int fd, uint64_t off,
+                      uint64_t size, size_t chunk, int direct)
+{
+    struct bring R;
+    struct bring_slot slot[B2S_URING_DEPTH];
+    struct iovec iov[B2S_URING_DEPTH];
+    unsigned char *buf;
+    size_t nchunks = (size - off + chunk - 1) / chunk;
+    size_t next = 0, done = 0;
+    unsigned depth = B2S_URING_INFLIGHT / chunk;
+    unsigned inflight = 0;
+    int fixed, err = 0;
+
+    if (depth > B2S_URING_DEPTH)
+        depth = B2S_URING_DEPTH;
+    if (depth < 2)
+        depth = 2;
+    if (bring_setup(&R, depth) < 0)
+        return 0;
+    R.direct = direct;
+    if (posix_memalign((void **)&buf, BLAKE2S_IO_ALIGN, depth * chunk)) {
+        bring_close(&R);
+        errno = ENOMEM;
+        return -1;
+    }
+    for (unsigned i = 0; i < depth; i++) {
+        iov[i].iov_base = buf + i * chunk;
+        iov[i].iov_len = chunk;
+    }
+    fixed = !syscall(__NR_io_uring_register, R.fd, IORING_REGISTER_BUFFERS,
+                     iov, depth);
+
+    for (; next < nchunks && next < depth; next++) {
+        bring_next(&slot[next], next, off, size, chunk);
+        bring_read(&R, fd, &slot[next], iov[next].iov_base,
+                   fixed ? (int)next : -1, next);
+        inflight++;
+    }
+
+    /* on error, stop submitting but wait for the reads in flight */
+    while (inflight) {
+        struct io_uring_cqe cqe;
+
+        if (bring_enter(&R) < 0) {
+            /* cannot wait for them: leak the buffers rather than
+             * let the kernel write into freed memory */
+            err = errno;
+            bring_close(&R);
+            errno = err;
+            return -1;
+        }
+        while (bring_reap(&R, &cqe)) {
+            size_t k = cqe.user_data;
+            unsigned s = k % depth;
+            struct bring_slot *S = &slot[s];
+            int again = 0;
+
+            inflight--;
+            if (err)
+                continue;
+            if (cqe.res == -EINTR || cqe.res == -EAGAIN) {
+                again = 1;
+            } else if (cqe.res < 0) {
+                err = -cqe.res;
+            } else if (!cqe.res) {
+                err = EIO; /* the file shrank */
+            } else {
+                S->got += cqe.res;
+                if (S->got > S->want) /* O_DIRECT, rounded up past EOF */
+                    S->got = S->want;
+                again = S->got < S->want;
+                /* an O_DIRECT read cannot go on from an unaligned
+                 * offset, and only stops short at EOF: the file shrank */
+                if (again && direct) {
+                    err = EIO;
+                    again = 0;
+                }
+            }
+            if (again) {
+                bring_read(&R, fd, S, iov[s].iov_base, fixed ? (int)s : -1, k);
+                inflight++;
+            }
+        }
+
+        /* hash completed chunks in order, and read ahead into their slots */
+        while (!err && done < nchunks) {
+            unsigned s = done % depth;
+            struct bring_slot *S = &slot[s];
+            if (S->got < S->want)
+                break;
+            blake2s_update(ctx, iov[s].iov_base, S->got);
+            done++;
+            if (next < nchunks) {
+                bring_next(S, next, off, size, chunk);
+                bring_read(&R, fd, S, iov[s].iov_base, fixed ? (int)s : -1,
+                           next);
+                inflight++;
+                next++;
+            }
+        }
+    }
+    bring_close(&R);
+    free(buf);
+    if (err) {
+        errno = err;
+        return -1;
+    }
+    return 1;
+}
+
+#else
+
+int blake2s_uring_run(struct blake2s_ctx *ctx, int fd, uint64_t off,
+                      uint64_t size, size_t chunk, int direct)
+{
+    (void)ctx; (void)fd; (void)off; (void)size; (void)chunk; (void)direct;
+    return 0;
+}
+
+#endif /* __linux__ */
+
+int blake2s_file_async(unsigned char *out, FILE *stream)
+{
+    struct blake2s_io io = { BLAKE2S_IO_URING, 0, 0 };
+    return blake2s_file_ex(out, stream, &io);
+}
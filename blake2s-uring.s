@@ -0,0 +1,9720 @@
+	.file	"blake2s-uring.c"
+# GNU C99 (Debian 12.2.0-14+deb12u1) version 12.2.0 (x86_64-linux-gnu)
+#	compiled by GNU C version 12.2.0, GMP version 6.2.1, MPFR version 4.2.0, MPC version 1.3.1, isl version isl-0.25-GMP
+
+# GGC heuristics: --param ggc-min-expand=100 --param ggc-min-heapsize=131072
+# options passed: -mtune=generic -march=x86-64 -g -O3 -std=c99 -fasynchronous-unwind-tables
+	.text
+.Ltext0:
+	.file 0 "/root/repo" "blake2s-uring.c"
+	.p2align 4
+	.type	bring_read, @function
+bring_read:
+.LVL0:
+.LFB34:
+	.file 1 "blake2s-uring.c"
+	.loc 1 114 1 view -0
+	.cfi_startproc
+	.loc 1 115 5 view .LVU1
+# blake2s-uring.c:115:     unsigned tail = *R->sq_tail;
+	.loc 1 115 14 is_stmt 0 view .LVU2
+	movq	8(%rdi), %rax	# R_30(D)->sq_tail, R_30(D)->sq_tail
+# blake2s-uring.c:114: {
+	.loc 1 114 1 view .LVU3
+	pushq	%r13	#
+	.cfi_def_cfa_offset 16
+	.cfi_offset 13, -16
+	movq	%rcx, %r11	# buf, tmp145
+# blake2s-uring.c:121:     sqe->opcode = fixed < 0 ? IORING_OP_READ : IORING_OP_READ_FIXED;
+	.loc 1 121 17 view .LVU4
+	movl	$4, %r13d	#, tmp137
+# blake2s-uring.c:114: {
+	.loc 1 114 1 view .LVU5
+	pushq	%r12	#
+	.cfi_def_cfa_offset 24
+	.cfi_offset 12, -24
+# blake2s-uring.c:121:     sqe->opcode = fixed < 0 ? IORING_OP_READ : IORING_OP_READ_FIXED;
+	.loc 1 121 17 view .LVU6
+	movl	$22, %r12d	#, tmp136
+# blake2s-uring.c:120:     memset(sqe, 0, sizeof(*sqe));
+	.loc 1 120 5 view .LVU7
+	pxor	%xmm0, %xmm0	# tmp125
+# blake2s-uring.c:114: {
+	.loc 1 114 1 view .LVU8
+	pushq	%rbp	#
+	.cfi_def_cfa_offset 32
+	.cfi_offset 6, -32
+	pushq	%rbx	#
+	.cfi_def_cfa_offset 40
+	.cfi_offset 3, -40
+# blake2s-uring.c:115:     unsigned tail = *R->sq_tail;
+	.loc 1 115 14 view .LVU9
+	movl	(%rax), %ecx	# *_1, tail
+.LVL1:
+	.loc 1 116 5 is_stmt 1 view .LVU10
+# blake2s-uring.c:116:     unsigned i = tail & *R->sq_mask;
+	.loc 1 116 25 is_stmt 0 view .LVU11
+	movq	16(%rdi), %rax	# R_30(D)->sq_mask, R_30(D)->sq_mask
+# blake2s-uring.c:118:     size_t len = S->want - S->got;
+	.loc 1 118 12 view .LVU12
+	movq	8(%rdx), %r10	# S_34(D)->want, S_34(D)->want
+	subq	16(%rdx), %r10	# S_34(D)->got, len
+# blake2s-uring.c:116:     unsigned i = tail & *R->sq_mask;
+	.loc 1 116 14 view .LVU13
+	movl	(%rax), %ebp	# *_2, i
+	andl	%ecx, %ebp	# tail, i
+.LVL2:
+	.loc 1 117 5 is_stmt 1 view .LVU14
+# blake2s-uring.c:117:     struct io_uring_sqe *sqe = &R->sqes[i];
+	.loc 1 117 40 is_stmt 0 view .LVU15
+	movl	%ebp, %ebx	# i, _5
+	movq	%rbx, %rax	# _5, tmp121
+	salq	$6, %rax	#, tmp121
+# blake2s-uring.c:117:     struct io_uring_sqe *sqe = &R->sqes[i];
+	.loc 1 117 26 view .LVU16
+	addq	56(%rdi), %rax	# R_30(D)->sqes, sqe
+.LVL3:
+	.loc 1 118 5 is_stmt 1 view .LVU17
+	.loc 1 120 5 view .LVU18
+# blake2s-uring.c:121:     sqe->opcode = fixed < 0 ? IORING_OP_READ : IORING_OP_READ_FIXED;
+	.loc 1 121 17 is_stmt 0 view .LVU19
+	cmpl	$-1, %r8d	#, fixed
+	cmovne	%r13d, %r12d	# tmp136,, tmp137, iftmp.6_27
+# blake2s-uring.c:120:     memset(sqe, 0, sizeof(*sqe));
+	.loc 1 120 5 view .LVU20
+	movups	%xmm0, 1(%rax)	# tmp125, MEM <char[1:63]> [(void *)_16]
+	movups	%xmm0, 17(%rax)	# tmp125, MEM <char[1:63]> [(void *)_16]
+	movups	%xmm0, 33(%rax)	# tmp125, MEM <char[1:63]> [(void *)_16]
+# blake2s-uring.c:121:     sqe->opcode = fixed < 0 ? IORING_OP_READ : IORING_OP_READ_FIXED;
+	.loc 1 121 17 view .LVU21
+	movb	%r12b, (%rax)	# iftmp.6_27, sqe_33->opcode
+# blake2s-uring.c:120:     memset(sqe, 0, sizeof(*sqe));
+	.loc 1 120 5 view .LVU22
+	movups	%xmm0, 48(%rax)	# tmp125, MEM <char[1:63]> [(void *)_16]
+	.loc 1 121 5 is_stmt 1 view .LVU23
+	.loc 1 122 5 view .LVU24
+# blake2s-uring.c:122:     sqe->fd = fd;
+	.loc 1 122 13 is_stmt 0 view .LVU25
+	movl	%esi, 4(%rax)	# tmp143, sqe_33->fd
+	.loc 1 123 5 is_stmt 1 view .LVU26
+# blake2s-uring.c:123:     sqe->addr = (unsigned long)(buf + S->got);
+	.loc 1 123 40 is_stmt 0 view .LVU27
+	movq	16(%rdx), %rsi	# S_34(D)->got, _9
+.LVL4:
+# blake2s-uring.c:123:     sqe->addr = (unsigned long)(buf + S->got);
+	.loc 1 123 37 view .LVU28
+	addq	%rsi, %r11	# _9, tmp126
+.LVL5:
+	.loc 1 123 37 view .LVU29
+	movq	%r11, 16(%rax)	# tmp126, sqe_33->D.4109.addr
+	.loc 1 124 5 is_stmt 1 view .LVU30
+# blake2s-uring.c:124:     sqe->len = R->direct ? B2S_IO_ROUND(len) : len;
+	.loc 1 124 14 is_stmt 0 view .LVU31
+	movl	116(%rdi), %r11d	# R_30(D)->direct,
+	testl	%r11d, %r11d	#
+	je	.L5	#,
+# blake2s-uring.c:124:     sqe->len = R->direct ? B2S_IO_ROUND(len) : len;
+	.loc 1 124 43 discriminator 1 view .LVU32
+	leal	4095(%r10), %r11d	#, tmp127
+# blake2s-uring.c:124:     sqe->len = R->direct ? B2S_IO_ROUND(len) : len;
+	.loc 1 124 14 discriminator 1 view .LVU33
+	andl	$-4096, %r11d	#, iftmp.7_28
+.L3:
+# blake2s-uring.c:125:     sqe->off = S->off + S->got;
+	.loc 1 125 23 discriminator 4 view .LVU34
+	addq	(%rdx), %rsi	# S_34(D)->off, tmp130
+# blake2s-uring.c:126:     sqe->buf_index = fixed < 0 ? 0 : fixed;
+	.loc 1 126 36 discriminator 4 view .LVU35
+	xorl	%edx, %edx	# tmp152
+.LVL6:
+	.loc 1 126 36 discriminator 4 view .LVU36
+	testl	%r8d, %r8d	# fixed
+# blake2s-uring.c:124:     sqe->len = R->direct ? B2S_IO_ROUND(len) : len;
+	.loc 1 124 14 discriminator 4 view .LVU37
+	movl	%r11d, 24(%rax)	# iftmp.7_28, sqe_33->len
+	.loc 1 125 5 is_stmt 1 discriminator 4 view .LVU38
+# blake2s-uring.c:126:     sqe->buf_index = fixed < 0 ? 0 : fixed;
+	.loc 1 126 36 is_stmt 0 discriminator 4 view .LVU39
+	cmovs	%edx, %r8d	# fixed,, tmp152, tmp132
+.LVL7:
+# blake2s-uring.c:125:     sqe->off = S->off + S->got;
+	.loc 1 125 14 discriminator 4 view .LVU40
+	movq	%rsi, 8(%rax)	# tmp130, sqe_33->D.4105.off
+	.loc 1 126 5 is_stmt 1 discriminator 4 view .LVU41
+# blake2s-uring.c:129:     __atomic_store_n(R->sq_tail, tail + 1, __ATOMIC_RELEASE);
+	.loc 1 129 5 is_stmt 0 discriminator 4 view .LVU42
+	addl	$1, %ecx	#, tmp135
+.LVL8:
+# blake2s-uring.c:127:     sqe->user_data = tag;
+	.loc 1 127 20 discriminator 4 view .LVU43
+	movq	%r9, 32(%rax)	# tag, sqe_33->user_data
+# blake2s-uring.c:126:     sqe->buf_index = fixed < 0 ? 0 : fixed;
+	.loc 1 126 20 discriminator 4 view .LVU44
+	movw	%r8w, 40(%rax)	# tmp132, sqe_33->D.4136.buf_index
+	.loc 1 127 5 is_stmt 1 discriminator 4 view .LVU45
+	.loc 1 128 5 discriminator 4 view .LVU46
+# blake2s-uring.c:128:     R->sq_array[i] = i;
+	.loc 1 128 20 is_stmt 0 discriminator 4 view .LVU47
+	movq	24(%rdi), %rax	# R_30(D)->sq_array, R_30(D)->sq_array
+.LVL9:
+	.loc 1 128 20 discriminator 4 view .LVU48
+	movl	%ebp, (%rax,%rbx,4)	# i, *_22
+	.loc 1 129 5 is_stmt 1 discriminator 4 view .LVU49
+	movq	8(%rdi), %rax	# R_30(D)->sq_tail, R_30(D)->sq_tail
+	movl	%ecx, (%rax)	#, tmp135,* R_30(D)->sq_tail
+	.loc 1 130 5 discriminator 4 view .LVU50
+# blake2s-uring.c:131: }
+	.loc 1 131 1 is_stmt 0 discriminator 4 view .LVU51
+	popq	%rbx	#
+	.cfi_remember_state
+	.cfi_def_cfa_offset 32
+# blake2s-uring.c:130:     R->queued++;
+	.loc 1 130 14 discriminator 4 view .LVU52
+	addl	$1, 112(%rdi)	#, R_30(D)->queued
+# blake2s-uring.c:131: }
+	.loc 1 131 1 discriminator 4 view .LVU53
+	popq	%rbp	#
+	.cfi_def_cfa_offset 24
+.LVL10:
+	.loc 1 131 1 discriminator 4 view .LVU54
+	popq	%r12	#
+	.cfi_def_cfa_offset 16
+	popq	%r13	#
+	.cfi_def_cfa_offset 8
+	ret	
+.LVL11:
+	.p2align 4,,10
+	.p2align 3
+.L5:
+	.cfi_restore_state
+	.loc 1 131 1 discriminator 4 view .LVU55
+	movl	%r10d, %r11d	# len, iftmp.7_28
+	jmp	.L3	#
+	.cfi_endproc
+.LFE34:
+	.size	bring_read, .-bring_read
+	.p2align 4
+	.globl	blake2s_uring_run
+	.type	blake2s_uring_run, @function
+blake2s_uring_run:
+.LVL12:
+.LFB38:
+	.loc 1 171 1 is_stmt 1 view -0
+	.cfi_startproc
+	.loc 1 172 5 view .LVU57
+	.loc 1 173 5 view .LVU58
+	.loc 1 174 5 view .LVU59
+	.loc 1 175 5 view .LVU60
+	.loc 1 176 5 view .LVU61
+# blake2s-uring.c:171: {
+	.loc 1 171 1 is_stmt 0 view .LVU62
+	pushq	%r15	#
+	.cfi_def_cfa_offset 16
+	.cfi_offset 15, -16
+# blake2s-uring.c:178:     unsigned depth = B2S_URING_INFLIGHT / chunk;
+	.loc 1 178 32 view .LVU63
+	movl	$8388608, %eax	#, tmp266
+# blake2s-uring.c:171: {
+	.loc 1 171 1 view .LVU64
+	pushq	%r14	#
+	.cfi_def_cfa_offset 24
+	.cfi_offset 14, -24
+	pushq	%r13	#
+	.cfi_def_cfa_offset 32
+	.cfi_offset 13, -32
+	pushq	%r12	#
+	.cfi_def_cfa_offset 40
+	.cfi_offset 12, -40
+	pushq	%rbp	#
+	.cfi_def_cfa_offset 48
+	.cfi_offset 6, -48
+	pushq	%rbx	#
+	.cfi_def_cfa_offset 56
+	.cfi_offset 3, -56
+	subq	$616, %rsp	#,
+	.cfi_def_cfa_offset 672
+.LVL13:
+	.loc 1 177 5 is_stmt 1 view .LVU65
+	.loc 1 178 5 view .LVU66
+# blake2s-uring.c:171: {
+	.loc 1 171 1 is_stmt 0 view .LVU67
+	movq	%rdx, 80(%rsp)	# tmp546, %sfp
+.LVL14:
+# blake2s-uring.c:178:     unsigned depth = B2S_URING_INFLIGHT / chunk;
+	.loc 1 178 32 view .LVU68
+	xorl	%edx, %edx	# tmp265
+.LVL15:
+	.loc 1 178 32 view .LVU69
+	divq	%r8	# chunk
+.LVL16:
+	.loc 1 179 5 is_stmt 1 view .LVU70
+	.loc 1 180 5 view .LVU71
+	.loc 1 182 5 view .LVU72
+# blake2s-uring.c:171: {
+	.loc 1 171 1 is_stmt 0 view .LVU73
+	movq	%rdi, 24(%rsp)	# tmp544, %sfp
+	movl	%esi, 16(%rsp)	# tmp545, %sfp
+	movq	%rcx, 88(%rsp)	# tmp547, %sfp
+	.loc 1 171 1 view .LVU74
+	movq	%r8, 72(%rsp)	# chunk, %sfp
+	movl	%r9d, 104(%rsp)	# tmp549, %sfp
+# blake2s-uring.c:182:     if (depth > B2S_URING_DEPTH)
+	.loc 1 182 8 view .LVU75
+	cmpq	$8, %rax	#, tmp264
+	ja	.L60	#,
+	.loc 1 184 5 is_stmt 1 view .LVU76
+# blake2s-uring.c:178:     unsigned depth = B2S_URING_INFLIGHT / chunk;
+	.loc 1 178 14 is_stmt 0 view .LVU77
+	cmpq	$2, %rax	#, tmp264
+	movl	$2, %edx	#, tmp537
+	movl	$2, %ebx	#, tmp536
+	cmovnb	%rax, %rdx	# tmp264,, tmp537
+	cmovnb	%eax, %ebx	# tmp264,, tmp536
+	movq	%rdx, 40(%rsp)	# tmp537, %sfp
+.L9:
+.LVL17:
+	.loc 1 186 5 is_stmt 1 view .LVU78
+.LBB31:
+.LBI31:
+	.loc 1 51 12 view .LVU79
+.LBB32:
+	.loc 1 53 5 view .LVU80
+	.loc 1 54 5 view .LVU81
+	.loc 1 56 5 view .LVU82
+	leaq	416(%rsp), %rdi	#, tmp530
+.LVL18:
+	.loc 1 56 5 is_stmt 0 view .LVU83
+	xorl	%eax, %eax	# tmp269
+	movl	$15, %ecx	#, tmp270
+.LVL19:
+# blake2s-uring.c:57:     R->fd = syscall(__NR_io_uring_setup, entries, &p);
+	.loc 1 57 13 view .LVU84
+	movl	%ebx, %esi	# depth,
+.LVL20:
+# blake2s-uring.c:56:     memset(&p, 0, sizeof(p));
+	.loc 1 56 5 view .LVU85
+	movq	%rdi, 32(%rsp)	# tmp530, %sfp
+	movq	%rdi, %rdx	# tmp530, tmp530
+	rep stosq
+	.loc 1 57 5 is_stmt 1 view .LVU86
+# blake2s-uring.c:57:     R->fd = syscall(__NR_io_uring_setup, entries, &p);
+	.loc 1 57 13 is_stmt 0 view .LVU87
+	movl	$425, %edi	#,
+	call	syscall@PLT	#
+.LVL21:
+# blake2s-uring.c:57:     R->fd = syscall(__NR_io_uring_setup, entries, &p);
+	.loc 1 57 11 view .LVU88
+	movl	%eax, 108(%rsp)	# _161, %sfp
+# blake2s-uring.c:57:     R->fd = syscall(__NR_io_uring_setup, entries, &p);
+	.loc 1 57 13 view .LVU89
+	movq	%rax, %r14	# tmp550, _161
+# blake2s-uring.c:57:     R->fd = syscall(__NR_io_uring_setup, entries, &p);
+	.loc 1 57 11 view .LVU90
+	movl	%eax, 160(%rsp)	# _161, R.fd
+	.loc 1 58 5 is_stmt 1 view .LVU91
+# blake2s-uring.c:58:     if (R->fd < 0)
+	.loc 1 58 8 is_stmt 0 view .LVU92
+	testl	%eax, %eax	# _161
+	js	.L10	#,
+	.loc 1 61 5 is_stmt 1 view .LVU93
+# blake2s-uring.c:61:     R->sq_len = p.sq_off.array + p.sq_entries * sizeof(unsigned);
+	.loc 1 61 25 is_stmt 0 view .LVU94
+	movl	480(%rsp), %eax	# MEM[(struct io_uring_params *)_28].sq_off.array, MEM[(struct io_uring_params *)_28].sq_off.array
+# blake2s-uring.c:61:     R->sq_len = p.sq_off.array + p.sq_entries * sizeof(unsigned);
+	.loc 1 61 35 view .LVU95
+	movl	416(%rsp), %edx	# MEM[(struct io_uring_params *)_28].sq_entries, _166
+# blake2s-uring.c:62:     R->cq_len = p.cq_off.cqes + p.cq_entries * sizeof(struct io_uring_cqe);
+	.loc 1 62 25 view .LVU96
+	movl	516(%rsp), %ecx	# MEM[(struct io_uring_params *)_28].cq_off.cqes, MEM[(struct io_uring_params *)_28].cq_off.cqes
+# blake2s-uring.c:61:     R->sq_len = p.sq_off.array + p.sq_entries * sizeof(unsigned);
+	.loc 1 61 32 view .LVU97
+	leaq	(%rax,%rdx,4), %rbp	#, pretmp_186
+# blake2s-uring.c:62:     R->cq_len = p.cq_off.cqes + p.cq_entries * sizeof(struct io_uring_cqe);
+	.loc 1 62 34 view .LVU98
+	movl	420(%rsp), %eax	# MEM[(struct io_uring_params *)_28].cq_entries, MEM[(struct io_uring_params *)_28].cq_entries
+# blake2s-uring.c:61:     R->sq_len = p.sq_off.array + p.sq_entries * sizeof(unsigned);
+	.loc 1 61 15 view .LVU99
+	movq	%rbp, 248(%rsp)	# pretmp_186, R.sq_len
+	.loc 1 62 5 is_stmt 1 view .LVU100
+# blake2s-uring.c:62:     R->cq_len = p.cq_off.cqes + p.cq_entries * sizeof(struct io_uring_cqe);
+	.loc 1 62 46 is_stmt 0 view .LVU101
+	salq	$4, %rax	#, tmp275
+# blake2s-uring.c:62:     R->cq_len = p.cq_off.cqes + p.cq_entries * sizeof(struct io_uring_cqe);
+	.loc 1 62 31 view .LVU102
+	leaq	(%rax,%rcx), %r15	#, prephitmp_44
+# blake2s-uring.c:62:     R->cq_len = p.cq_off.cqes + p.cq_entries * sizeof(struct io_uring_cqe);
+	.loc 1 62 15 view .LVU103
+	movq	%r15, 256(%rsp)	# prephitmp_44, R.cq_len
+	.loc 1 63 5 is_stmt 1 view .LVU104
+# blake2s-uring.c:63:     if (p.features & IORING_FEAT_SINGLE_MMAP && R->cq_len > R->sq_len)
+	.loc 1 63 45 is_stmt 0 view .LVU105
+	cmpq	%r15, %rbp	# prephitmp_44, pretmp_186
+	jnb	.L11	#,
+	testb	$1, 436(%rsp)	#, MEM[(struct io_uring_params *)_28].features
+	jne	.L123	#,
+.L11:
+	.loc 1 65 5 is_stmt 1 view .LVU106
+# blake2s-uring.c:65:     R->sqe_len = p.sq_entries * sizeof(struct io_uring_sqe);
+	.loc 1 65 31 is_stmt 0 view .LVU107
+	salq	$6, %rdx	#, _166
+# blake2s-uring.c:67:     R->sq_map = mmap(NULL, R->sq_len, PROT_READ | PROT_WRITE,
+	.loc 1 67 17 view .LVU108
+	xorl	%r9d, %r9d	#
+	movl	%r14d, %r8d	# _161,
+	movl	$32769, %ecx	#,
+# blake2s-uring.c:65:     R->sqe_len = p.sq_entries * sizeof(struct io_uring_sqe);
+	.loc 1 65 31 view .LVU109
+	movq	%rdx, 96(%rsp)	# _177, %sfp
+# blake2s-uring.c:67:     R->sq_map = mmap(NULL, R->sq_len, PROT_READ | PROT_WRITE,
+	.loc 1 67 17 view .LVU110
+	movq	%rbp, %rsi	# pretmp_186,
+	xorl	%edi, %edi	#
+# blake2s-uring.c:65:     R->sqe_len = p.sq_entries * sizeof(struct io_uring_sqe);
+	.loc 1 65 16 view .LVU111
+	movq	%rdx, 264(%rsp)	# _177, R.sqe_len
+	.loc 1 67 5 is_stmt 1 view .LVU112
+# blake2s-uring.c:67:     R->sq_map = mmap(NULL, R->sq_len, PROT_READ | PROT_WRITE,
+	.loc 1 67 17 is_stmt 0 view .LVU113
+	movl	$3, %edx	#,
+	call	mmap@PLT	#
+.LVL22:
+	movq	%rax, %xmm1	# _266, _21
+	movq	%rax, 64(%rsp)	# _266, %sfp
+	punpcklqdq	%xmm1, %xmm1	# _21
+	.loc 1 69 5 is_stmt 1 view .LVU114
+# blake2s-uring.c:67:     R->sq_map = mmap(NULL, R->sq_len, PROT_READ | PROT_WRITE,
+	.loc 1 67 15 is_stmt 0 view .LVU115
+	movups	%xmm1, 232(%rsp)	# _21, MEM <vector(2) long unsigned int> [(void * *)&R + 72B]
+	.loc 1 70 5 is_stmt 1 view .LVU116
+# blake2s-uring.c:70:     if (R->sq_map != MAP_FAILED && !(p.features & IORING_FEAT_SINGLE_MMAP))
+	.loc 1 70 8 is_stmt 0 view .LVU117
+	cmpq	$-1, %rax	#, _266
+	je	.L12	#,
+# blake2s-uring.c:70:     if (R->sq_map != MAP_FAILED && !(p.features & IORING_FEAT_SINGLE_MMAP))
+	.loc 1 70 32 view .LVU118
+	testb	$1, 436(%rsp)	#, MEM[(struct io_uring_params *)_28].features
+	je	.L124	#,
+	movq	%rax, %xmm6	# _266, _11
+# blake2s-uring.c:73:     R->sqes = mmap(NULL, R->sqe_len, PROT_READ | PROT_WRITE,
+	.loc 1 73 15 view .LVU119
+	movq	96(%rsp), %rsi	# %sfp,
+	movl	%r14d, %r8d	# _161,
+	xorl	%edi, %edi	#
+	punpcklqdq	%xmm6, %xmm6	# _266, _11
+	movl	$268435456, %r9d	#,
+	movl	$32769, %ecx	#,
+	movq	%rax, %r12	# _266, _266
+	movl	$3, %edx	#,
+	movaps	%xmm1, 48(%rsp)	# _21, %sfp
+	movaps	%xmm6, (%rsp)	# _11, %sfp
+	.loc 1 73 5 is_stmt 1 view .LVU120
+# blake2s-uring.c:73:     R->sqes = mmap(NULL, R->sqe_len, PROT_READ | PROT_WRITE,
+	.loc 1 73 15 is_stmt 0 view .LVU121
+	call	mmap@PLT	#
+.LVL23:
+# blake2s-uring.c:73:     R->sqes = mmap(NULL, R->sqe_len, PROT_READ | PROT_WRITE,
+	.loc 1 73 13 view .LVU122
+	movq	%rax, 216(%rsp)	# _342, R.sqes
+	.loc 1 75 5 is_stmt 1 view .LVU123
+# blake2s-uring.c:73:     R->sqes = mmap(NULL, R->sqe_len, PROT_READ | PROT_WRITE,
+	.loc 1 73 15 is_stmt 0 view .LVU124
+	movq	%rax, %r9	# tmp561, _342
+# blake2s-uring.c:76:         || R->sqes == MAP_FAILED) {
+	.loc 1 76 8 view .LVU125
+	cmpq	$-1, %rax	#, _342
+	je	.L17	#,
+	movdqa	48(%rsp), %xmm1	# %sfp, _21
+	jmp	.L16	#
+.L124:
+# blake2s-uring.c:71:         R->cq_map = mmap(NULL, R->cq_len, PROT_READ | PROT_WRITE,
+	.loc 1 71 21 view .LVU126
+	movl	$134217728, %r9d	#,
+	movl	%r14d, %r8d	# _161,
+	movl	$32769, %ecx	#,
+	xorl	%edi, %edi	#
+	movl	$3, %edx	#,
+	movq	%r15, %rsi	# prephitmp_44,
+	movaps	%xmm1, 48(%rsp)	# _21, %sfp
+	.loc 1 71 9 is_stmt 1 view .LVU127
+# blake2s-uring.c:71:         R->cq_map = mmap(NULL, R->cq_len, PROT_READ | PROT_WRITE,
+	.loc 1 71 21 is_stmt 0 view .LVU128
+	call	mmap@PLT	#
+.LVL24:
+# blake2s-uring.c:73:     R->sqes = mmap(NULL, R->sqe_len, PROT_READ | PROT_WRITE,
+	.loc 1 73 15 view .LVU129
+	movq	96(%rsp), %rsi	# %sfp,
+	movl	%r14d, %r8d	# _161,
+	xorl	%edi, %edi	#
+	movq	64(%rsp), %xmm5	# %sfp, _11
+	movq	%rax, %xmm7	# _265, _265
+	movl	$268435456, %r9d	#,
+# blake2s-uring.c:71:         R->cq_map = mmap(NULL, R->cq_len, PROT_READ | PROT_WRITE,
+	.loc 1 71 21 view .LVU130
+	movq	%rax, %r12	# tmp552, _265
+# blake2s-uring.c:73:     R->sqes = mmap(NULL, R->sqe_len, PROT_READ | PROT_WRITE,
+	.loc 1 73 15 view .LVU131
+	movl	$32769, %ecx	#,
+	movl	$3, %edx	#,
+# blake2s-uring.c:71:         R->cq_map = mmap(NULL, R->cq_len, PROT_READ | PROT_WRITE,
+	.loc 1 71 19 view .LVU132
+	movq	%rax, 240(%rsp)	# _265, R.cq_map
+	punpcklqdq	%xmm7, %xmm5	# _265, _11
+	movaps	%xmm5, (%rsp)	# _11, %sfp
+	.loc 1 73 5 is_stmt 1 view .LVU133
+# blake2s-uring.c:73:     R->sqes = mmap(NULL, R->sqe_len, PROT_READ | PROT_WRITE,
+	.loc 1 73 15 is_stmt 0 view .LVU134
+	call	mmap@PLT	#
+.LVL25:
+# blake2s-uring.c:73:     R->sqes = mmap(NULL, R->sqe_len, PROT_READ | PROT_WRITE,
+	.loc 1 73 13 view .LVU135
+	movq	%rax, 216(%rsp)	# _342, R.sqes
+	.loc 1 75 5 is_stmt 1 view .LVU136
+# blake2s-uring.c:73:     R->sqes = mmap(NULL, R->sqe_len, PROT_READ | PROT_WRITE,
+	.loc 1 73 15 is_stmt 0 view .LVU137
+	movq	%rax, %r9	# tmp553, _342
+# blake2s-uring.c:75:     if (R->sq_map == MAP_FAILED || R->cq_map == MAP_FAILED
+	.loc 1 75 32 view .LVU138
+	cmpq	$-1, %r12	#, _265
+	je	.L14	#,
+# blake2s-uring.c:76:         || R->sqes == MAP_FAILED) {
+	.loc 1 76 8 view .LVU139
+	cmpq	$-1, %rax	#, _342
+	movdqa	48(%rsp), %xmm1	# %sfp, _21
+	je	.L125	#,
+.L16:
+# blake2s-uring.c:93:     R->cq_tail  = (unsigned *)(cq + p.cq_off.tail);
+	.loc 1 93 44 view .LVU140
+	movl	500(%rsp), %eax	# MEM[(struct io_uring_params *)_28].cq_off.tail, MEM[(struct io_uring_params *)_28].cq_off.tail
+.LBE32:
+.LBE31:
+# blake2s-uring.c:189:     if (posix_memalign((void **)&buf, BLAKE2S_IO_ALIGN, depth * chunk)) {
+	.loc 1 189 9 view .LVU141
+	movq	72(%rsp), %rdx	# %sfp, tmp306
+	leaq	136(%rsp), %rdi	#, tmp307
+	movl	$4096, %esi	#,
+	movd	496(%rsp), %xmm7	# MEM[(struct io_uring_params *)_28].cq_off.head, tmp634
+	movq	%r9, 48(%rsp)	# _342, %sfp
+.LBB40:
+.LBB33:
+	.loc 1 87 5 is_stmt 1 view .LVU142
+.LVL26:
+	.loc 1 88 5 view .LVU143
+	.loc 1 89 5 view .LVU144
+	.loc 1 90 5 view .LVU145
+	.loc 1 91 5 view .LVU146
+	.loc 1 92 5 view .LVU147
+	movd	480(%rsp), %xmm2	# MEM[(struct io_uring_params *)_28].sq_off.array, tmp286
+# blake2s-uring.c:93:     R->cq_tail  = (unsigned *)(cq + p.cq_off.tail);
+	.loc 1 93 34 is_stmt 0 view .LVU148
+	addq	%r12, %rax	# _265, tmp301
+	movd	460(%rsp), %xmm0	# MEM[(struct io_uring_params *)_28].sq_off.tail, tmp289
+# blake2s-uring.c:96:     R->queued = 0;
+	.loc 1 96 15 view .LVU149
+	movl	$0, 272(%rsp)	#, R.queued
+# blake2s-uring.c:93:     R->cq_tail  = (unsigned *)(cq + p.cq_off.tail);
+	.loc 1 93 34 view .LVU150
+	movq	%rax, 200(%rsp)	# tmp301, R.cq_tail
+# blake2s-uring.c:94:     R->cq_mask  = (unsigned *)(cq + p.cq_off.ring_mask);
+	.loc 1 94 44 view .LVU151
+	movl	504(%rsp), %eax	# MEM[(struct io_uring_params *)_28].cq_off.ring_mask, MEM[(struct io_uring_params *)_28].cq_off.ring_mask
+	punpckldq	%xmm7, %xmm2	# tmp634, tmp286
+	movd	464(%rsp), %xmm7	# MEM[(struct io_uring_params *)_28].sq_off.ring_mask, tmp636
+# blake2s-uring.c:94:     R->cq_mask  = (unsigned *)(cq + p.cq_off.ring_mask);
+	.loc 1 94 34 view .LVU152
+	addq	%r12, %rax	# _265, tmp303
+	movq	%rax, 208(%rsp)	# tmp303, R.cq_mask
+# blake2s-uring.c:95:     R->cqes     = (struct io_uring_cqe *)(cq + p.cq_off.cqes);
+	.loc 1 95 52 view .LVU153
+	movl	516(%rsp), %eax	# MEM[(struct io_uring_params *)_28].cq_off.cqes, MEM[(struct io_uring_params *)_28].cq_off.cqes
+	punpckldq	%xmm7, %xmm0	# tmp636, tmp289
+	punpcklqdq	%xmm2, %xmm0	# tmp286, tmp285
+# blake2s-uring.c:89:     R->sq_tail  = (unsigned *)(sq + p.sq_off.tail);
+	.loc 1 89 44 view .LVU154
+	pxor	%xmm2, %xmm2	# tmp293
+# blake2s-uring.c:95:     R->cqes     = (struct io_uring_cqe *)(cq + p.cq_off.cqes);
+	.loc 1 95 42 view .LVU155
+	addq	%r12, %rax	# _265, tmp305
+# blake2s-uring.c:89:     R->sq_tail  = (unsigned *)(sq + p.sq_off.tail);
+	.loc 1 89 44 view .LVU156
+	movdqa	%xmm0, %xmm3	# tmp285, tmp294
+	punpckhdq	%xmm2, %xmm0	# tmp293, tmp298
+# blake2s-uring.c:95:     R->cqes     = (struct io_uring_cqe *)(cq + p.cq_off.cqes);
+	.loc 1 95 42 view .LVU157
+	movq	%rax, 224(%rsp)	# tmp305, R.cqes
+.LBE33:
+.LBE40:
+# blake2s-uring.c:188:     R.direct = direct;
+	.loc 1 188 14 view .LVU158
+	movl	104(%rsp), %eax	# %sfp, direct
+.LBB41:
+.LBB34:
+# blake2s-uring.c:89:     R->sq_tail  = (unsigned *)(sq + p.sq_off.tail);
+	.loc 1 89 44 view .LVU159
+	punpckldq	%xmm2, %xmm3	# tmp293, tmp294
+# blake2s-uring.c:89:     R->sq_tail  = (unsigned *)(sq + p.sq_off.tail);
+	.loc 1 89 34 view .LVU160
+	paddq	(%rsp), %xmm0	# %sfp, vect__199.29
+	paddq	%xmm3, %xmm1	# tmp294, vect__199.29
+.LBE34:
+.LBE41:
+# blake2s-uring.c:188:     R.direct = direct;
+	.loc 1 188 14 view .LVU161
+	movl	%eax, 276(%rsp)	# direct, R.direct
+# blake2s-uring.c:189:     if (posix_memalign((void **)&buf, BLAKE2S_IO_ALIGN, depth * chunk)) {
+	.loc 1 189 9 view .LVU162
+	movq	40(%rsp), %rax	# %sfp, _4
+.LBB42:
+.LBB35:
+# blake2s-uring.c:89:     R->sq_tail  = (unsigned *)(sq + p.sq_off.tail);
+	.loc 1 89 16 view .LVU163
+	movups	%xmm1, 168(%rsp)	# vect__199.29, MEM <vector(2) long unsigned int> [(unsigned int * *)&R + 8B]
+.LBE35:
+.LBE42:
+# blake2s-uring.c:189:     if (posix_memalign((void **)&buf, BLAKE2S_IO_ALIGN, depth * chunk)) {
+	.loc 1 189 9 view .LVU164
+	imulq	%rax, %rdx	# _4, tmp306
+.LBB43:
+.LBB36:
+# blake2s-uring.c:89:     R->sq_tail  = (unsigned *)(sq + p.sq_off.tail);
+	.loc 1 89 16 view .LVU165
+	movups	%xmm0, 184(%rsp)	# vect__199.29, MEM <vector(2) long unsigned int> [(unsigned int * *)&R + 24B]
+	.loc 1 93 5 is_stmt 1 view .LVU166
+	.loc 1 94 5 view .LVU167
+	.loc 1 95 5 view .LVU168
+	.loc 1 96 5 view .LVU169
+	.loc 1 97 5 view .LVU170
+.LVL27:
+	.loc 1 97 5 is_stmt 0 view .LVU171
+.LBE36:
+.LBE43:
+	.loc 1 188 5 is_stmt 1 view .LVU172
+	.loc 1 189 5 view .LVU173
+# blake2s-uring.c:189:     if (posix_memalign((void **)&buf, BLAKE2S_IO_ALIGN, depth * chunk)) {
+	.loc 1 189 9 is_stmt 0 view .LVU174
+	call	posix_memalign@PLT	#
+.LVL28:
+# blake2s-uring.c:189:     if (posix_memalign((void **)&buf, BLAKE2S_IO_ALIGN, depth * chunk)) {
+	.loc 1 189 8 view .LVU175
+	movq	48(%rsp), %r9	# %sfp, _342
+	testl	%eax, %eax	# err
+# blake2s-uring.c:189:     if (posix_memalign((void **)&buf, BLAKE2S_IO_ALIGN, depth * chunk)) {
+	.loc 1 189 9 view .LVU176
+	movl	%eax, (%rsp)	# err, %sfp
+# blake2s-uring.c:189:     if (posix_memalign((void **)&buf, BLAKE2S_IO_ALIGN, depth * chunk)) {
+	.loc 1 189 8 view .LVU177
+	jne	.L126	#,
+.LVL29:
+.LBB44:
+	.loc 1 194 28 is_stmt 1 view .LVU178
+# blake2s-uring.c:196:         iov[i].iov_len = chunk;
+	.loc 1 196 24 is_stmt 0 view .LVU179
+	movq	72(%rsp), %rdi	# %sfp, chunk
+# blake2s-uring.c:195:         iov[i].iov_base = buf + i * chunk;
+	.loc 1 195 31 view .LVU180
+	movq	136(%rsp), %rax	# buf, buf.0_10
+	.loc 1 195 9 is_stmt 1 view .LVU181
+# blake2s-uring.c:195:         iov[i].iov_base = buf + i * chunk;
+	.loc 1 195 25 is_stmt 0 view .LVU182
+	movq	%rax, 288(%rsp)	# buf.0_10, iov[0].iov_base
+	.loc 1 196 9 is_stmt 1 view .LVU183
+# blake2s-uring.c:195:         iov[i].iov_base = buf + i * chunk;
+	.loc 1 195 31 is_stmt 0 view .LVU184
+	addq	%rdi, %rax	# chunk, _70
+# blake2s-uring.c:196:         iov[i].iov_len = chunk;
+	.loc 1 196 24 view .LVU185
+	movq	%rdi, 296(%rsp)	# chunk, iov[0].iov_len
+	.loc 1 194 38 is_stmt 1 view .LVU186
+.LVL30:
+	.loc 1 194 28 view .LVU187
+	.loc 1 195 9 view .LVU188
+# blake2s-uring.c:195:         iov[i].iov_base = buf + i * chunk;
+	.loc 1 195 25 is_stmt 0 view .LVU189
+	movq	%rax, 304(%rsp)	# _70, iov[1].iov_base
+	.loc 1 196 9 is_stmt 1 view .LVU190
+# blake2s-uring.c:196:         iov[i].iov_len = chunk;
+	.loc 1 196 24 is_stmt 0 view .LVU191
+	movq	%rdi, 312(%rsp)	# chunk, iov[1].iov_len
+	.loc 1 194 38 is_stmt 1 view .LVU192
+.LVL31:
+	.loc 1 194 28 view .LVU193
+	cmpl	$2, %ebx	#, depth
+	je	.L24	#,
+	.loc 1 195 9 view .LVU194
+# blake2s-uring.c:195:         iov[i].iov_base = buf + i * chunk;
+	.loc 1 195 31 is_stmt 0 view .LVU195
+	addq	%rdi, %rax	# chunk, _390
+# blake2s-uring.c:196:         iov[i].iov_len = chunk;
+	.loc 1 196 24 view .LVU196
+	movq	%rdi, 328(%rsp)	# chunk, iov[2].iov_len
+# blake2s-uring.c:195:         iov[i].iov_base = buf + i * chunk;
+	.loc 1 195 25 view .LVU197
+	movq	%rax, 320(%rsp)	# _390, iov[2].iov_base
+	.loc 1 196 9 is_stmt 1 view .LVU198
+	.loc 1 194 38 view .LVU199
+.LVL32:
+	.loc 1 194 28 view .LVU200
+	cmpl	$3, %ebx	#, depth
+	je	.L24	#,
+	.loc 1 195 9 view .LVU201
+# blake2s-uring.c:195:         iov[i].iov_base = buf + i * chunk;
+	.loc 1 195 31 is_stmt 0 view .LVU202
+	addq	%rdi, %rax	# chunk, _398
+# blake2s-uring.c:196:         iov[i].iov_len = chunk;
+	.loc 1 196 24 view .LVU203
+	movq	%rdi, 344(%rsp)	# chunk, iov[3].iov_len
+# blake2s-uring.c:195:         iov[i].iov_base = buf + i * chunk;
+	.loc 1 195 25 view .LVU204
+	movq	%rax, 336(%rsp)	# _398, iov[3].iov_base
+	.loc 1 196 9 is_stmt 1 view .LVU205
+	.loc 1 194 38 view .LVU206
+.LVL33:
+	.loc 1 194 28 view .LVU207
+	cmpl	$4, %ebx	#, depth
+	je	.L24	#,
+	.loc 1 195 9 view .LVU208
+# blake2s-uring.c:195:         iov[i].iov_base = buf + i * chunk;
+	.loc 1 195 31 is_stmt 0 view .LVU209
+	addq	%rdi, %rax	# chunk, _406
+# blake2s-uring.c:196:         iov[i].iov_len = chunk;
+	.loc 1 196 24 view .LVU210
+	movq	%rdi, 360(%rsp)	# chunk, iov[4].iov_len
+# blake2s-uring.c:195:         iov[i].iov_base = buf + i * chunk;
+	.loc 1 195 25 view .LVU211
+	movq	%rax, 352(%rsp)	# _406, iov[4].iov_base
+	.loc 1 196 9 is_stmt 1 view .LVU212
+	.loc 1 194 38 view .LVU213
+.LVL34:
+	.loc 1 194 28 view .LVU214
+	cmpl	$5, %ebx	#, depth
+	je	.L24	#,
+	.loc 1 195 9 view .LVU215
+# blake2s-uring.c:195:         iov[i].iov_base = buf + i * chunk;
+	.loc 1 195 31 is_stmt 0 view .LVU216
+	addq	%rdi, %rax	# chunk, _414
+# blake2s-uring.c:196:         iov[i].iov_len = chunk;
+	.loc 1 196 24 view .LVU217
+	movq	%rdi, 376(%rsp)	# chunk, iov[5].iov_len
+# blake2s-uring.c:195:         iov[i].iov_base = buf + i * chunk;
+	.loc 1 195 25 view .LVU218
+	movq	%rax, 368(%rsp)	# _414, iov[5].iov_base
+	.loc 1 196 9 is_stmt 1 view .LVU219
+	.loc 1 194 38 view .LVU220
+.LVL35:
+	.loc 1 194 28 view .LVU221
+	cmpl	$6, %ebx	#, depth
+	je	.L24	#,
+	.loc 1 195 9 view .LVU222
+# blake2s-uring.c:195:         iov[i].iov_base = buf + i * chunk;
+	.loc 1 195 31 is_stmt 0 view .LVU223
+	addq	%rdi, %rax	# chunk, _422
+# blake2s-uring.c:196:         iov[i].iov_len = chunk;
+	.loc 1 196 24 view .LVU224
+	movq	%rdi, 392(%rsp)	# chunk, iov[6].iov_len
+# blake2s-uring.c:195:         iov[i].iov_base = buf + i * chunk;
+	.loc 1 195 25 view .LVU225
+	movq	%rax, 384(%rsp)	# _422, iov[6].iov_base
+	.loc 1 196 9 is_stmt 1 view .LVU226
+	.loc 1 194 38 view .LVU227
+.LVL36:
+	.loc 1 194 28 view .LVU228
+	cmpl	$8, %ebx	#, depth
+	jne	.L24	#,
+	.loc 1 195 9 discriminator 3 view .LVU229
+# blake2s-uring.c:195:         iov[i].iov_base = buf + i * chunk;
+	.loc 1 195 31 is_stmt 0 discriminator 3 view .LVU230
+	addq	%rdi, %rax	# chunk, tmp308
+# blake2s-uring.c:196:         iov[i].iov_len = chunk;
+	.loc 1 196 24 discriminator 3 view .LVU231
+	movq	%rdi, 408(%rsp)	# chunk, iov[7].iov_len
+# blake2s-uring.c:195:         iov[i].iov_base = buf + i * chunk;
+	.loc 1 195 31 discriminator 3 view .LVU232
+	movq	%rax, 400(%rsp)	# tmp308, iov[7].iov_base
+	.loc 1 196 9 is_stmt 1 discriminator 3 view .LVU233
+	.loc 1 194 38 discriminator 3 view .LVU234
+.LVL37:
+	.loc 1 194 28 discriminator 3 view .LVU235
+.L24:
+	.loc 1 194 28 is_stmt 0 discriminator 3 view .LVU236
+.LBE44:
+# blake2s-uring.c:176:     size_t nchunks = (size - off + chunk - 1) / chunk;
+	.loc 1 176 42 view .LVU237
+	movq	72(%rsp), %r14	# %sfp, chunk
+	movq	88(%rsp), %rax	# %sfp, size
+# blake2s-uring.c:198:     fixed = !syscall(__NR_io_uring_register, R.fd, IORING_REGISTER_BUFFERS,
+	.loc 1 198 14 view .LVU238
+	xorl	%edx, %edx	#
+	movl	%ebx, %r8d	# depth,
+# blake2s-uring.c:176:     size_t nchunks = (size - off + chunk - 1) / chunk;
+	.loc 1 176 42 view .LVU239
+	movq	80(%rsp), %rsi	# %sfp, off
+# blake2s-uring.c:198:     fixed = !syscall(__NR_io_uring_register, R.fd, IORING_REGISTER_BUFFERS,
+	.loc 1 198 14 view .LVU240
+	movl	$427, %edi	#,
+	movq	%r9, 120(%rsp)	# _342, %sfp
+	leaq	288(%rsp), %r13	#, tmp534
+# blake2s-uring.c:176:     size_t nchunks = (size - off + chunk - 1) / chunk;
+	.loc 1 176 42 view .LVU241
+	leaq	-1(%rax,%r14), %r11	#, tmp310
+# blake2s-uring.c:198:     fixed = !syscall(__NR_io_uring_register, R.fd, IORING_REGISTER_BUFFERS,
+	.loc 1 198 14 view .LVU242
+	movq	%r13, %rcx	# tmp534,
+	xorl	%eax, %eax	#
+# blake2s-uring.c:176:     size_t nchunks = (size - off + chunk - 1) / chunk;
+	.loc 1 176 42 view .LVU243
+	subq	%rsi, %r11	# off, _3
+# blake2s-uring.c:198:     fixed = !syscall(__NR_io_uring_register, R.fd, IORING_REGISTER_BUFFERS,
+	.loc 1 198 14 view .LVU244
+	movl	108(%rsp), %esi	# %sfp,
+# blake2s-uring.c:176:     size_t nchunks = (size - off + chunk - 1) / chunk;
+	.loc 1 176 42 view .LVU245
+	movq	%r11, 112(%rsp)	# _3, %sfp
+	.loc 1 198 5 is_stmt 1 view .LVU246
+# blake2s-uring.c:198:     fixed = !syscall(__NR_io_uring_register, R.fd, IORING_REGISTER_BUFFERS,
+	.loc 1 198 14 is_stmt 0 view .LVU247
+	call	syscall@PLT	#
+.LVL38:
+# blake2s-uring.c:201:     for (; next < nchunks && next < depth; next++) {
+	.loc 1 201 27 view .LVU248
+	movq	112(%rsp), %r11	# %sfp, _3
+	movq	120(%rsp), %r9	# %sfp, _342
+	movq	%r14, %rsi	# chunk, chunk
+# blake2s-uring.c:198:     fixed = !syscall(__NR_io_uring_register, R.fd, IORING_REGISTER_BUFFERS,
+	.loc 1 198 14 view .LVU249
+	movq	%rax, 48(%rsp)	# _15, %sfp
+	movq	%rax, %rcx	# tmp556, _15
+.LVL39:
+	.loc 1 201 5 is_stmt 1 view .LVU250
+	.loc 1 201 27 view .LVU251
+	cmpq	%r14, %r11	# chunk, _3
+	jb	.L25	#,
+# blake2s-uring.c:176:     size_t nchunks = (size - off + chunk - 1) / chunk;
+	.loc 1 176 12 is_stmt 0 view .LVU252
+	xorl	%edx, %edx	# tmp313
+	movq	%r11, %rax	# _3, _3
+.LVL40:
+	.loc 1 176 12 view .LVU253
+	movq	40(%rsp), %rbx	# %sfp, _4
+.LVL41:
+	.loc 1 176 12 view .LVU254
+	divq	%r14	# chunk
+	cmpq	%rbx, %rax	# _4, tmp312
+	movq	%rax, %r12	# _3, tmp312
+	cmovbe	%rax, %rbx	# tmp312,, _296
+	movq	%rbx, %rax	# _296, _296
+	testq	%rcx, %rcx	# _15
+	je	.L26	#,
+	movq	80(%rsp), %r15	# %sfp, off
+	movq	88(%rsp), %rbp	# %sfp, ivtmp.46
+# blake2s-uring.c:177:     size_t next = 0, done = 0;
+	.loc 1 177 12 view .LVU255
+	xorl	%r9d, %r9d	# next
+	movq	%rax, %r14	# _296, _296
+	movq	32(%rsp), %rbx	# %sfp, ivtmp.45
+	movq	%r12, 64(%rsp)	# tmp312, %sfp
+.LVL42:
+	.loc 1 177 12 view .LVU256
+	leaq	160(%rsp), %rdi	#, tmp529
+	subq	%r15, %rbp	# off, ivtmp.46
+	movq	%r15, %r12	# ivtmp.44, ivtmp.44
+	movq	%r13, %r15	# tmp534, tmp534
+	movq	%rsi, %r13	# chunk, chunk
+.LVL43:
+	.p2align 4,,10
+	.p2align 3
+.L27:
+	.loc 1 202 9 is_stmt 1 view .LVU257
+.LBB45:
+.LBI45:
+	.loc 1 161 13 view .LVU258
+.LBB46:
+	.loc 1 164 5 view .LVU259
+# blake2s-uring.c:165:     S->want = size - S->off < chunk ? size - S->off : chunk;
+	.loc 1 165 53 is_stmt 0 view .LVU260
+	cmpq	%rbp, %r13	# ivtmp.46, chunk
+	movq	%rbp, %rdx	# ivtmp.46, tmp314
+# blake2s-uring.c:164:     S->off = off + (uint64_t)k * chunk;
+	.loc 1 164 12 view .LVU261
+	movq	%r12, (%rbx)	# ivtmp.44, MEM <uint64_t> [(struct bring_slot *)_339]
+	.loc 1 165 5 is_stmt 1 view .LVU262
+.LBE46:
+.LBE45:
+# blake2s-uring.c:203:         bring_read(&R, fd, &slot[next], iov[next].iov_base,
+	.loc 1 203 9 is_stmt 0 view .LVU263
+	movl	16(%rsp), %esi	# %sfp,
+.LBB52:
+.LBB47:
+# blake2s-uring.c:165:     S->want = size - S->off < chunk ? size - S->off : chunk;
+	.loc 1 165 53 view .LVU264
+	cmovbe	%r13, %rdx	# chunk,, tmp314
+.LBE47:
+.LBE52:
+# blake2s-uring.c:203:         bring_read(&R, fd, &slot[next], iov[next].iov_base,
+	.loc 1 203 9 view .LVU265
+	movl	$-1, %r8d	#,
+# blake2s-uring.c:201:     for (; next < nchunks && next < depth; next++) {
+	.loc 1 201 27 view .LVU266
+	addq	%r13, %r12	# chunk, ivtmp.44
+	subq	%r13, %rbp	# chunk, ivtmp.46
+.LBB53:
+.LBB48:
+# blake2s-uring.c:166:     S->got = 0;
+	.loc 1 166 12 view .LVU267
+	movq	$0, 16(%rbx)	#, MEM <size_t> [(struct bring_slot *)_339 + 16B]
+# blake2s-uring.c:165:     S->want = size - S->off < chunk ? size - S->off : chunk;
+	.loc 1 165 13 view .LVU268
+	movq	%rdx, 8(%rbx)	# tmp314, MEM <size_t> [(struct bring_slot *)_339 + 8B]
+	.loc 1 166 5 is_stmt 1 view .LVU269
+.LVL44:
+	.loc 1 166 5 is_stmt 0 view .LVU270
+.LBE48:
+.LBE53:
+	.loc 1 203 9 is_stmt 1 view .LVU271
+# blake2s-uring.c:203:         bring_read(&R, fd, &slot[next], iov[next].iov_base,
+	.loc 1 203 50 is_stmt 0 view .LVU272
+	movq	%r9, %rdx	# next, tmp316
+	salq	$4, %rdx	#, tmp316
+# blake2s-uring.c:203:         bring_read(&R, fd, &slot[next], iov[next].iov_base,
+	.loc 1 203 9 view .LVU273
+	movq	(%r15,%rdx), %rcx	# MEM[(void * *)&iov + _268 * 1], MEM[(void * *)&iov + _268 * 1]
+	movq	%rbx, %rdx	# ivtmp.45,
+# blake2s-uring.c:201:     for (; next < nchunks && next < depth; next++) {
+	.loc 1 201 27 view .LVU274
+	addq	$24, %rbx	#, ivtmp.45
+# blake2s-uring.c:203:         bring_read(&R, fd, &slot[next], iov[next].iov_base,
+	.loc 1 203 9 view .LVU275
+	call	bring_read	#
+.LVL45:
+	.loc 1 205 9 is_stmt 1 view .LVU276
+	.loc 1 201 48 view .LVU277
+	addq	$1, %r9	#, next
+.LVL46:
+	.loc 1 201 27 view .LVU278
+	cmpq	%r14, %r9	# _296, next
+	jb	.L27	#,
+.LVL47:
+.L120:
+# blake2s-uring.c:205:         inflight++;
+	.loc 1 205 17 is_stmt 0 view .LVU279
+	testq	%r14, %r14	# _296
+	movl	$1, %r10d	#, tmp331
+# blake2s-uring.c:201:     for (; next < nchunks && next < depth; next++) {
+	.loc 1 201 48 view .LVU280
+	movl	$1, %ebp	#, tmp333
+	movq	64(%rsp), %r12	# %sfp, tmp312
+# blake2s-uring.c:205:         inflight++;
+	.loc 1 205 17 view .LVU281
+	cmovne	%r14d, %r10d	# _296,, tmp331
+# blake2s-uring.c:201:     for (; next < nchunks && next < depth; next++) {
+	.loc 1 201 48 view .LVU282
+	cmovne	%r14, %rbp	# _296,, next
+.LBB54:
+.LBB55:
+# blake2s-uring.c:248:                 bring_read(&R, fd, S, iov[s].iov_base, fixed ? (int)s : -1, k);
+	.loc 1 248 17 view .LVU283
+	movq	40(%rsp), %r14	# %sfp, _4
+.LBE55:
+.LBE54:
+# blake2s-uring.c:177:     size_t next = 0, done = 0;
+	.loc 1 177 12 view .LVU284
+	xorl	%ebx, %ebx	# done
+.LBB99:
+.LBB56:
+# blake2s-uring.c:248:                 bring_read(&R, fd, S, iov[s].iov_base, fixed ? (int)s : -1, k);
+	.loc 1 248 17 view .LVU285
+	movq	%rdi, 40(%rsp)	# tmp529, %sfp
+	movl	%r10d, %r15d	# inflight, inflight
+.LVL48:
+	.p2align 4,,10
+	.p2align 3
+.L56:
+	.loc 1 248 17 view .LVU286
+.LBE56:
+.LBB57:
+.LBB58:
+# blake2s-uring.c:137:         int n = syscall(__NR_io_uring_enter, R->fd, R->queued, 1,
+	.loc 1 137 17 view .LVU287
+	movl	272(%rsp), %esi	# R.queued, pretmp_273
+	movl	160(%rsp), %r13d	# R.fd, pretmp_104
+	movq	%r14, 64(%rsp)	# _4, %sfp
+	movl	%esi, %r14d	# pretmp_273, pretmp_273
+	.p2align 4,,10
+	.p2align 3
+.L36:
+.LBE58:
+	.loc 1 136 5 is_stmt 1 view .LVU288
+.LBB59:
+	.loc 1 137 9 view .LVU289
+# blake2s-uring.c:137:         int n = syscall(__NR_io_uring_enter, R->fd, R->queued, 1,
+	.loc 1 137 17 is_stmt 0 view .LVU290
+	subq	$8, %rsp	#,
+	.cfi_def_cfa_offset 680
+	xorl	%r9d, %r9d	#
+	movl	$1, %r8d	#,
+	movl	%r14d, %edx	# pretmp_273,
+	pushq	$0	#
+	.cfi_def_cfa_offset 688
+	movl	$1, %ecx	#,
+	movl	%r13d, %esi	# pretmp_104,
+	movl	$426, %edi	#,
+	xorl	%eax, %eax	#
+	call	syscall@PLT	#
+.LVL49:
+	.loc 1 139 9 is_stmt 1 view .LVU291
+# blake2s-uring.c:139:         if (n >= 0) {
+	.loc 1 139 12 is_stmt 0 view .LVU292
+	popq	%r9	#
+	.cfi_def_cfa_offset 680
+	popq	%r10	#
+	.cfi_def_cfa_offset 672
+	testl	%eax, %eax	# _229
+	jns	.L127	#,
+	.loc 1 143 9 is_stmt 1 view .LVU293
+# blake2s-uring.c:143:         if (errno != EINTR && errno != EAGAIN && errno != EBUSY)
+	.loc 1 143 14 is_stmt 0 view .LVU294
+	call	__errno_location@PLT	#
+.LVL50:
+# blake2s-uring.c:143:         if (errno != EINTR && errno != EAGAIN && errno != EBUSY)
+	.loc 1 143 13 view .LVU295
+	movl	(%rax), %ecx	# *_235, _236
+# blake2s-uring.c:143:         if (errno != EINTR && errno != EAGAIN && errno != EBUSY)
+	.loc 1 143 14 view .LVU296
+	movq	%rax, %rdx	# tmp558, _235
+# blake2s-uring.c:143:         if (errno != EINTR && errno != EAGAIN && errno != EBUSY)
+	.loc 1 143 27 view .LVU297
+	cmpl	$16, %ecx	#, _236
+	jbe	.L128	#,
+.L35:
+.LBE59:
+.LBE57:
+.LBB61:
+.LBB62:
+# blake2s-uring.c:102:     munmap(R->sqes, R->sqe_len);
+	.loc 1 102 5 view .LVU298
+	movq	216(%rsp), %rdi	# R.sqes,
+	movq	264(%rsp), %rsi	# R.sqe_len,
+	movq	%rdx, 16(%rsp)	# _235, %sfp
+	movl	%r13d, %r15d	# pretmp_104, pretmp_104
+.LVL51:
+	.loc 1 102 5 view .LVU299
+	movl	%ecx, (%rsp)	# _236, %sfp
+.LVL52:
+	.loc 1 102 5 view .LVU300
+.LBE62:
+.LBE61:
+	.loc 1 215 13 is_stmt 1 view .LVU301
+	.loc 1 216 13 view .LVU302
+.LBB64:
+.LBI61:
+	.loc 1 100 13 view .LVU303
+.LBB63:
+	.loc 1 102 5 view .LVU304
+	call	munmap@PLT	#
+.LVL53:
+	.loc 1 103 5 view .LVU305
+# blake2s-uring.c:103:     if (R->cq_map != R->sq_map)
+	.loc 1 103 10 is_stmt 0 view .LVU306
+	movq	240(%rsp), %rdi	# R.cq_map, _243
+# blake2s-uring.c:103:     if (R->cq_map != R->sq_map)
+	.loc 1 103 8 view .LVU307
+	movl	(%rsp), %ecx	# %sfp, _236
+# blake2s-uring.c:103:     if (R->cq_map != R->sq_map)
+	.loc 1 103 23 view .LVU308
+	movq	232(%rsp), %rbx	# R.sq_map, _244
+.LVL54:
+# blake2s-uring.c:103:     if (R->cq_map != R->sq_map)
+	.loc 1 103 8 view .LVU309
+	movq	16(%rsp), %rdx	# %sfp, _235
+	cmpq	%rbx, %rdi	# _244, _243
+	je	.L37	#,
+# blake2s-uring.c:104:         munmap(R->cq_map, R->cq_len);
+	.loc 1 104 9 view .LVU310
+	movq	256(%rsp), %rsi	# R.cq_len,
+	movl	%ecx, 16(%rsp)	# _236, %sfp
+	movq	%rdx, (%rsp)	# _235, %sfp
+.LVL55:
+	.loc 1 104 9 is_stmt 1 view .LVU311
+	call	munmap@PLT	#
+.LVL56:
+	movl	16(%rsp), %ecx	# %sfp, _236
+	movq	(%rsp), %rdx	# %sfp, _235
+	.p2align 4,,10
+	.p2align 3
+.L37:
+# blake2s-uring.c:105:     munmap(R->sq_map, R->sq_len);
+	.loc 1 105 5 is_stmt 0 view .LVU312
+	movq	248(%rsp), %rsi	# R.sq_len,
+	movq	%rbx, %rdi	# _244,
+	movl	%ecx, 16(%rsp)	# _236, %sfp
+	movq	%rdx, (%rsp)	# _235, %sfp
+	.loc 1 105 5 is_stmt 1 view .LVU313
+	call	munmap@PLT	#
+.LVL57:
+	.loc 1 106 5 view .LVU314
+	movl	%r15d, %edi	# pretmp_104,
+	call	close@PLT	#
+.LVL58:
+	.loc 1 106 5 is_stmt 0 view .LVU315
+.LBE63:
+.LBE64:
+	.loc 1 217 12 is_stmt 1 view .LVU316
+# blake2s-uring.c:217:             errno = err;
+	.loc 1 217 18 is_stmt 0 view .LVU317
+	movq	(%rsp), %rdx	# %sfp, _235
+	movl	16(%rsp), %ecx	# %sfp, _236
+	movl	%ecx, (%rdx)	# _236, *_235
+	.loc 1 218 13 is_stmt 1 view .LVU318
+.LVL59:
+.L23:
+	.loc 1 218 13 is_stmt 0 view .LVU319
+.LBE99:
+# blake2s-uring.c:192:         return -1;
+	.loc 1 192 16 view .LVU320
+	movl	$-1, %eax	#, <retval>
+.LVL60:
+.L8:
+# blake2s-uring.c:277: }
+	.loc 1 277 1 view .LVU321
+	addq	$616, %rsp	#,
+	.cfi_remember_state
+	.cfi_def_cfa_offset 56
+	popq	%rbx	#
+	.cfi_def_cfa_offset 48
+	popq	%rbp	#
+	.cfi_def_cfa_offset 40
+	popq	%r12	#
+	.cfi_def_cfa_offset 32
+	popq	%r13	#
+	.cfi_def_cfa_offset 24
+	popq	%r14	#
+	.cfi_def_cfa_offset 16
+	popq	%r15	#
+	.cfi_def_cfa_offset 8
+	ret	
+.LVL61:
+.L60:
+	.cfi_restore_state
+	.loc 1 277 1 view .LVU322
+	movq	$8, 40(%rsp)	#, %sfp
+# blake2s-uring.c:183:         depth = B2S_URING_DEPTH;
+	.loc 1 183 15 view .LVU323
+	movl	$8, %ebx	#, depth
+	jmp	.L9	#
+.LVL62:
+.L123:
+.LBB100:
+.LBB37:
+	.loc 1 64 9 is_stmt 1 view .LVU324
+# blake2s-uring.c:64:         R->sq_len = R->cq_len;
+	.loc 1 64 19 is_stmt 0 view .LVU325
+	movq	%r15, 248(%rsp)	# prephitmp_44, R.sq_len
+	movq	%r15, %rbp	# prephitmp_44, pretmp_186
+	jmp	.L11	#
+.LVL63:
+	.p2align 4,,10
+	.p2align 3
+.L128:
+	.loc 1 64 19 view .LVU326
+.LBE37:
+.LBE100:
+.LBB101:
+.LBB65:
+.LBB60:
+# blake2s-uring.c:143:         if (errno != EINTR && errno != EAGAIN && errno != EBUSY)
+	.loc 1 143 46 view .LVU327
+	movq	$-67601, %rax	#, tmp679
+	btq	%rcx, %rax	# _236, tmp679
+	jnc	.L36	#,
+	jmp	.L35	#
+.LVL64:
+	.p2align 4,,10
+	.p2align 3
+.L127:
+# blake2s-uring.c:140:             R->queued -= n;
+	.loc 1 140 23 view .LVU328
+	movl	%r14d, %esi	# pretmp_273, pretmp_273
+	movq	64(%rsp), %r14	# %sfp, _4
+	.loc 1 140 13 is_stmt 1 view .LVU329
+# blake2s-uring.c:140:             R->queued -= n;
+	.loc 1 140 23 is_stmt 0 view .LVU330
+	subl	%eax, %esi	# _229, tmp334
+	movl	%esi, 272(%rsp)	# tmp334, R.queued
+	.loc 1 141 13 is_stmt 1 view .LVU331
+.LVL65:
+	.p2align 4,,10
+	.p2align 3
+.L34:
+	.loc 1 141 13 is_stmt 0 view .LVU332
+.LBE60:
+.LBE65:
+	.loc 1 220 16 is_stmt 1 view .LVU333
+.LBB66:
+.LBI66:
+	.loc 1 149 12 view .LVU334
+.LBB67:
+	.loc 1 151 5 view .LVU335
+# blake2s-uring.c:151:     unsigned head = *R->cq_head;
+	.loc 1 151 14 is_stmt 0 view .LVU336
+	movq	192(%rsp), %rax	# R.cq_head, R.cq_head
+# blake2s-uring.c:153:     if (head == __atomic_load_n(R->cq_tail, __ATOMIC_ACQUIRE))
+	.loc 1 153 17 view .LVU337
+	movq	200(%rsp), %rdx	# R.cq_tail, R.cq_tail
+# blake2s-uring.c:151:     unsigned head = *R->cq_head;
+	.loc 1 151 14 view .LVU338
+	movl	(%rax), %eax	# *_249, head
+.LVL66:
+	.loc 1 153 5 is_stmt 1 view .LVU339
+# blake2s-uring.c:153:     if (head == __atomic_load_n(R->cq_tail, __ATOMIC_ACQUIRE))
+	.loc 1 153 17 is_stmt 0 view .LVU340
+	movl	(%rdx), %edx	#* R.cq_tail, _252
+# blake2s-uring.c:153:     if (head == __atomic_load_n(R->cq_tail, __ATOMIC_ACQUIRE))
+	.loc 1 153 8 view .LVU341
+	cmpl	%edx, %eax	# _252, head
+	je	.L129	#,
+	.loc 1 155 5 is_stmt 1 view .LVU342
+	.loc 1 156 5 view .LVU343
+# blake2s-uring.c:155:     *cqe = R->cqes[head & *R->cq_mask];
+	.loc 1 155 25 is_stmt 0 view .LVU344
+	movq	208(%rsp), %rdx	# R.cq_mask, R.cq_mask
+	movl	%eax, %edi	# head, tmp402
+# blake2s-uring.c:156:     __atomic_store_n(R->cq_head, head + 1, __ATOMIC_RELEASE);
+	.loc 1 156 5 view .LVU345
+	addl	$1, %eax	#, tmp408
+.LVL67:
+	.loc 1 156 5 view .LVU346
+.LBE67:
+.LBE66:
+.LBB69:
+# blake2s-uring.c:226:             inflight--;
+	.loc 1 226 21 view .LVU347
+	leal	-1(%r15), %esi	#, inflight
+.LBE69:
+.LBB70:
+.LBB68:
+# blake2s-uring.c:155:     *cqe = R->cqes[head & *R->cq_mask];
+	.loc 1 155 25 view .LVU348
+	andl	(%rdx), %edi	# *_254, tmp402
+.LVL68:
+	.loc 1 155 25 view .LVU349
+	movq	%rdi, %rdx	# tmp402, tmp402
+# blake2s-uring.c:155:     *cqe = R->cqes[head & *R->cq_mask];
+	.loc 1 155 10 view .LVU350
+	salq	$4, %rdx	#, tmp404
+	addq	224(%rsp), %rdx	# R.cqes, tmp405
+	movdqu	(%rdx), %xmm4	# *_259, tmp689
+# blake2s-uring.c:156:     __atomic_store_n(R->cq_head, head + 1, __ATOMIC_RELEASE);
+	.loc 1 156 5 view .LVU351
+	movq	192(%rsp), %rdx	# R.cq_head, R.cq_head
+# blake2s-uring.c:155:     *cqe = R->cqes[head & *R->cq_mask];
+	.loc 1 155 10 view .LVU352
+	movaps	%xmm4, 144(%rsp)	# tmp689, cqe
+# blake2s-uring.c:156:     __atomic_store_n(R->cq_head, head + 1, __ATOMIC_RELEASE);
+	.loc 1 156 5 view .LVU353
+	movl	%eax, (%rdx)	#, tmp408,* R.cq_head
+.LVL69:
+	.loc 1 157 5 is_stmt 1 view .LVU354
+	.loc 1 157 5 is_stmt 0 view .LVU355
+.LBE68:
+.LBE70:
+.LBB71:
+	.loc 1 221 13 is_stmt 1 view .LVU356
+	.loc 1 222 13 view .LVU357
+	.loc 1 223 13 view .LVU358
+	.loc 1 224 13 view .LVU359
+	.loc 1 226 13 view .LVU360
+	.loc 1 227 13 view .LVU361
+# blake2s-uring.c:227:             if (err)
+	.loc 1 227 16 is_stmt 0 view .LVU362
+	movl	(%rsp), %edx	# %sfp,
+	testl	%edx, %edx	#
+	jne	.L64	#,
+# blake2s-uring.c:221:             size_t k = cqe.user_data;
+	.loc 1 221 20 view .LVU363
+	movq	144(%rsp), %r9	# cqe.user_data, k
+# blake2s-uring.c:222:             unsigned s = k % depth;
+	.loc 1 222 28 view .LVU364
+	xorl	%edx, %edx	# tmp342
+	movq	%r9, %rax	# k, tmp343
+	divq	%r14	# _4
+	.loc 1 229 13 is_stmt 1 view .LVU365
+# blake2s-uring.c:229:             if (cqe.res == -EINTR || cqe.res == -EAGAIN) {
+	.loc 1 229 20 is_stmt 0 view .LVU366
+	movslq	152(%rsp), %rax	# cqe.res,
+# blake2s-uring.c:229:             if (cqe.res == -EINTR || cqe.res == -EAGAIN) {
+	.loc 1 229 16 view .LVU367
+	cmpl	$-4, %eax	#, _123
+	je	.L122	#,
+	cmpl	$-11, %eax	#, _123
+	je	.L122	#,
+	.loc 1 231 20 is_stmt 1 view .LVU368
+# blake2s-uring.c:231:             } else if (cqe.res < 0) {
+	.loc 1 231 23 is_stmt 0 view .LVU369
+	testl	%eax, %eax	# _123
+	js	.L130	#,
+	.loc 1 233 20 is_stmt 1 view .LVU370
+# blake2s-uring.c:233:             } else if (!cqe.res) {
+	.loc 1 233 23 is_stmt 0 view .LVU371
+	je	.L63	#,
+	.loc 1 236 17 is_stmt 1 view .LVU372
+# blake2s-uring.c:236:                 S->got += cqe.res;
+	.loc 1 236 18 is_stmt 0 view .LVU373
+	leaq	(%rdx,%rdx,2), %rdi	#, tmp532
+	movl	%edx, %ecx	# tmp342, s
+	leaq	0(,%rdi,8), %r8	#, tmp352
+# blake2s-uring.c:236:                 S->got += cqe.res;
+	.loc 1 236 24 view .LVU374
+	addq	432(%rsp,%rdi,8), %rax	# MEM <struct bring_slot[8]> [(struct bring_slot *)_28][s_120].got, _33
+	.loc 1 237 17 is_stmt 1 view .LVU375
+# blake2s-uring.c:237:                 if (S->got > S->want) /* O_DIRECT, rounded up past EOF */
+	.loc 1 237 31 is_stmt 0 view .LVU376
+	movq	424(%rsp,%r8), %rdi	# MEM <struct bring_slot[8]> [(struct bring_slot *)_28][s_120].want, _35
+# blake2s-uring.c:237:                 if (S->got > S->want) /* O_DIRECT, rounded up past EOF */
+	.loc 1 237 20 view .LVU377
+	cmpq	%rax, %rdi	# _33, _35
+	jnb	.L44	#,
+	movq	%rdi, 432(%rsp,%r8)	# _35, MEM <struct bring_slot[8]> [(void *)_28][s_120].got
+	.loc 1 239 17 is_stmt 1 view .LVU378
+.LVL70:
+	.loc 1 242 17 view .LVU379
+	.loc 1 247 13 view .LVU380
+# blake2s-uring.c:226:             inflight--;
+	.loc 1 226 21 is_stmt 0 view .LVU381
+	movl	%esi, %r15d	# inflight, inflight
+	jmp	.L34	#
+.LVL71:
+	.p2align 4,,10
+	.p2align 3
+.L129:
+	.loc 1 226 21 view .LVU382
+.LBE71:
+	.loc 1 254 21 is_stmt 1 view .LVU383
+	movl	(%rsp), %ecx	# %sfp,
+	testl	%ecx, %ecx	#
+	jne	.L50	#,
+	cmpq	%r12, %rbx	# tmp312, done
+	jnb	.L50	#,
+	movq	%rbp, %rax	# next, next
+	cmpq	$0, 48(%rsp)	#, %sfp
+	movq	%rbx, %rbp	# done, done
+.LVL72:
+	.loc 1 254 21 is_stmt 0 view .LVU384
+	movq	%r14, 64(%rsp)	# _4, %sfp
+	movl	%r15d, 96(%rsp)	# inflight, %sfp
+	movq	%rax, %rbx	# next, next
+.LVL73:
+	.loc 1 254 21 view .LVU385
+	je	.L52	#,
+	.loc 1 254 21 view .LVU386
+	jmp	.L54	#
+.LVL74:
+	.p2align 4,,10
+	.p2align 3
+.L131:
+.LBB72:
+	.loc 1 259 13 is_stmt 1 view .LVU387
+# blake2s-uring.c:259:             blake2s_update(ctx, iov[s].iov_base, S->got);
+	.loc 1 259 39 is_stmt 0 view .LVU388
+	salq	$4, %r8	#, s
+.LVL75:
+# blake2s-uring.c:259:             blake2s_update(ctx, iov[s].iov_base, S->got);
+	.loc 1 259 13 view .LVU389
+	movq	24(%rsp), %rdi	# %sfp,
+# blake2s-uring.c:260:             done++;
+	.loc 1 260 17 view .LVU390
+	addq	$1, %rbp	#, done
+.LVL76:
+# blake2s-uring.c:259:             blake2s_update(ctx, iov[s].iov_base, S->got);
+	.loc 1 259 13 view .LVU391
+	movq	288(%rsp,%r8), %rsi	# iov[s_239].iov_base, iov[s_239].iov_base
+# blake2s-uring.c:259:             blake2s_update(ctx, iov[s].iov_base, S->got);
+	.loc 1 259 39 view .LVU392
+	movq	%r8, %r15	# s, tmp426
+# blake2s-uring.c:259:             blake2s_update(ctx, iov[s].iov_base, S->got);
+	.loc 1 259 13 view .LVU393
+	call	blake2s_update@PLT	#
+.LVL77:
+	.loc 1 260 13 is_stmt 1 view .LVU394
+	.loc 1 261 13 view .LVU395
+# blake2s-uring.c:261:             if (next < nchunks) {
+	.loc 1 261 16 is_stmt 0 view .LVU396
+	cmpq	%r12, %rbx	# tmp312, next
+	jnb	.L53	#,
+	.loc 1 262 17 is_stmt 1 view .LVU397
+.LVL78:
+.LBB73:
+.LBI73:
+	.loc 1 161 13 view .LVU398
+.LBB74:
+	.loc 1 164 5 view .LVU399
+# blake2s-uring.c:164:     S->off = off + (uint64_t)k * chunk;
+	.loc 1 164 32 is_stmt 0 view .LVU400
+	movq	72(%rsp), %rax	# %sfp, chunk
+# blake2s-uring.c:164:     S->off = off + (uint64_t)k * chunk;
+	.loc 1 164 18 view .LVU401
+	movq	80(%rsp), %rcx	# %sfp, off
+.LBE74:
+.LBE73:
+# blake2s-uring.c:263:                 bring_read(&R, fd, S, iov[s].iov_base, fixed ? (int)s : -1,
+	.loc 1 263 17 view .LVU402
+	movq	%rbx, %r9	# next,
+	movl	$-1, %r8d	#,
+.LBB85:
+.LBB75:
+# blake2s-uring.c:165:     S->want = size - S->off < chunk ? size - S->off : chunk;
+	.loc 1 165 20 view .LVU403
+	movq	88(%rsp), %rdx	# %sfp, tmp445
+.LBE75:
+.LBE85:
+# blake2s-uring.c:256:             struct bring_slot *S = &slot[s];
+	.loc 1 256 32 view .LVU404
+	movq	32(%rsp), %rdi	# %sfp, tmp530
+.LBB86:
+.LBB76:
+# blake2s-uring.c:166:     S->got = 0;
+	.loc 1 166 12 view .LVU405
+	movq	$0, 432(%rsp,%r14)	#, MEM <struct bring_slot[8]> [(struct bring_slot *)_28][s_239].got
+# blake2s-uring.c:164:     S->off = off + (uint64_t)k * chunk;
+	.loc 1 164 32 view .LVU406
+	movq	%rax, %rsi	# chunk, tmp430
+	imulq	%rbx, %rsi	# next, tmp430
+# blake2s-uring.c:164:     S->off = off + (uint64_t)k * chunk;
+	.loc 1 164 18 view .LVU407
+	addq	%rcx, %rsi	# off, _220
+# blake2s-uring.c:165:     S->want = size - S->off < chunk ? size - S->off : chunk;
+	.loc 1 165 20 view .LVU408
+	subq	%rsi, %rdx	# _220, tmp445
+# blake2s-uring.c:164:     S->off = off + (uint64_t)k * chunk;
+	.loc 1 164 12 view .LVU409
+	movq	%rsi, 416(%rsp,%r14)	# _220, MEM <struct bring_slot[8]> [(struct bring_slot *)_28][s_239].off
+	.loc 1 165 5 is_stmt 1 view .LVU410
+.LBE76:
+.LBE86:
+# blake2s-uring.c:263:                 bring_read(&R, fd, S, iov[s].iov_base, fixed ? (int)s : -1,
+	.loc 1 263 17 is_stmt 0 view .LVU411
+	movl	16(%rsp), %esi	# %sfp,
+.LBB87:
+.LBB77:
+# blake2s-uring.c:165:     S->want = size - S->off < chunk ? size - S->off : chunk;
+	.loc 1 165 53 view .LVU412
+	cmpq	%rax, %rdx	# chunk, tmp445
+	cmova	%rax, %rdx	# tmp445,, chunk, tmp446
+.LBE77:
+.LBE87:
+# blake2s-uring.c:263:                 bring_read(&R, fd, S, iov[s].iov_base, fixed ? (int)s : -1,
+	.loc 1 263 17 view .LVU413
+	movq	288(%rsp,%r15), %rax	# iov[s_239].iov_base, iov[s_239].iov_base
+# blake2s-uring.c:266:                 next++;
+	.loc 1 266 21 view .LVU414
+	addq	$1, %rbx	#, next
+.LVL79:
+.LBB88:
+.LBB78:
+# blake2s-uring.c:165:     S->want = size - S->off < chunk ? size - S->off : chunk;
+	.loc 1 165 13 view .LVU415
+	movq	%rdx, 424(%rsp,%r14)	# tmp446, MEM <struct bring_slot[8]> [(struct bring_slot *)_28][s_239].want
+	.loc 1 166 5 is_stmt 1 view .LVU416
+.LVL80:
+	.loc 1 166 5 is_stmt 0 view .LVU417
+.LBE78:
+.LBE88:
+	.loc 1 263 17 is_stmt 1 view .LVU418
+# blake2s-uring.c:256:             struct bring_slot *S = &slot[s];
+	.loc 1 256 32 is_stmt 0 view .LVU419
+	leaq	0(%r13,%r13,2), %rdx	#, tmp462
+# blake2s-uring.c:263:                 bring_read(&R, fd, S, iov[s].iov_base, fixed ? (int)s : -1,
+	.loc 1 263 17 view .LVU420
+	movq	%rax, %rcx	# iov[s_239].iov_base,
+# blake2s-uring.c:256:             struct bring_slot *S = &slot[s];
+	.loc 1 256 32 view .LVU421
+	leaq	(%rdi,%rdx,8), %rdx	#, S
+# blake2s-uring.c:263:                 bring_read(&R, fd, S, iov[s].iov_base, fixed ? (int)s : -1,
+	.loc 1 263 17 view .LVU422
+	movq	40(%rsp), %rdi	# %sfp,
+	call	bring_read	#
+.LVL81:
+	.loc 1 265 17 is_stmt 1 view .LVU423
+	.loc 1 266 17 view .LVU424
+# blake2s-uring.c:265:                 inflight++;
+	.loc 1 265 25 is_stmt 0 view .LVU425
+	addl	$1, 96(%rsp)	#, %sfp
+.LVL82:
+.L53:
+	.loc 1 265 25 view .LVU426
+.LBE72:
+	.loc 1 254 21 is_stmt 1 view .LVU427
+	cmpq	%r12, %rbp	# tmp312, done
+	jnb	.L119	#,
+.LVL83:
+.L54:
+.LBB95:
+	.loc 1 255 13 view .LVU428
+# blake2s-uring.c:255:             unsigned s = done % depth;
+	.loc 1 255 31 is_stmt 0 view .LVU429
+	movq	%rbp, %rax	# done, tmp410
+	xorl	%edx, %edx	# tmp409
+	divq	64(%rsp)	# %sfp
+# blake2s-uring.c:257:             if (S->got < S->want)
+	.loc 1 257 18 view .LVU430
+	leaq	(%rdx,%rdx,2), %rax	#, tmp535
+# blake2s-uring.c:255:             unsigned s = done % depth;
+	.loc 1 255 31 view .LVU431
+	movq	%rdx, %r13	# tmp409, tmp409
+.LVL84:
+	.loc 1 256 13 is_stmt 1 view .LVU432
+	.loc 1 257 13 view .LVU433
+# blake2s-uring.c:257:             if (S->got < S->want)
+	.loc 1 257 18 is_stmt 0 view .LVU434
+	movl	%edx, %r8d	# tmp409, s
+	leaq	0(,%rax,8), %r14	#, tmp415
+	movq	432(%rsp,%r14), %rdx	# MEM <struct bring_slot[8]> [(struct bring_slot *)_28][s_239].got, _238
+.LVL85:
+# blake2s-uring.c:257:             if (S->got < S->want)
+	.loc 1 257 16 view .LVU435
+	cmpq	424(%rsp,%r14), %rdx	# MEM <struct bring_slot[8]> [(struct bring_slot *)_28][s_239].want, _238
+	jnb	.L131	#,
+.LVL86:
+.L119:
+	.loc 1 257 16 view .LVU436
+	movq	%rbx, %rax	# next, next
+	movq	64(%rsp), %r14	# %sfp, _4
+	movl	96(%rsp), %r15d	# %sfp, inflight
+	movq	%rbp, %rbx	# done, done
+.LVL87:
+	.loc 1 257 16 view .LVU437
+	movq	%rax, %rbp	# next, next
+.LVL88:
+.L50:
+	.loc 1 257 16 view .LVU438
+.LBE95:
+.LBE101:
+	.loc 1 209 12 is_stmt 1 view .LVU439
+	testl	%r15d, %r15d	# inflight
+	jne	.L56	#,
+	.loc 1 270 5 view .LVU440
+.LVL89:
+.LBB102:
+.LBI102:
+	.loc 1 100 13 view .LVU441
+.LBB103:
+	.loc 1 102 5 view .LVU442
+	movq	264(%rsp), %rsi	# R.sqe_len,
+	movq	216(%rsp), %rdi	# R.sqes,
+	call	munmap@PLT	#
+.LVL90:
+	.loc 1 103 5 view .LVU443
+# blake2s-uring.c:103:     if (R->cq_map != R->sq_map)
+	.loc 1 103 23 is_stmt 0 view .LVU444
+	movq	232(%rsp), %rax	# R.sq_map, _266
+# blake2s-uring.c:106:     close(R->fd);
+	.loc 1 106 5 view .LVU445
+	movl	160(%rsp), %ebx	# R.fd, pretmp_225
+.LVL91:
+# blake2s-uring.c:103:     if (R->cq_map != R->sq_map)
+	.loc 1 103 10 view .LVU446
+	movq	240(%rsp), %r12	# R.cq_map, _265
+# blake2s-uring.c:105:     munmap(R->sq_map, R->sq_len);
+	.loc 1 105 5 view .LVU447
+	movq	248(%rsp), %rbp	# R.sq_len, pretmp_186
+.LVL92:
+# blake2s-uring.c:103:     if (R->cq_map != R->sq_map)
+	.loc 1 103 23 view .LVU448
+	movq	%rax, 64(%rsp)	# _266, %sfp
+# blake2s-uring.c:106:     close(R->fd);
+	.loc 1 106 5 view .LVU449
+	movl	%ebx, 108(%rsp)	# pretmp_225, %sfp
+# blake2s-uring.c:103:     if (R->cq_map != R->sq_map)
+	.loc 1 103 8 view .LVU450
+	cmpq	%rax, %r12	# _266, _265
+	je	.L57	#,
+# blake2s-uring.c:104:         munmap(R->cq_map, R->cq_len);
+	.loc 1 104 9 view .LVU451
+	movq	256(%rsp), %r15	# R.cq_len, prephitmp_44
+.LVL93:
+.L31:
+	.loc 1 104 9 is_stmt 1 view .LVU452
+	movq	%r15, %rsi	# prephitmp_44,
+	movq	%r12, %rdi	# _265,
+	call	munmap@PLT	#
+.LVL94:
+.L57:
+	.loc 1 105 5 view .LVU453
+	movq	64(%rsp), %rdi	# %sfp,
+	movq	%rbp, %rsi	# pretmp_186,
+	call	munmap@PLT	#
+.LVL95:
+	.loc 1 106 5 view .LVU454
+	movl	108(%rsp), %edi	# %sfp,
+	call	close@PLT	#
+.LVL96:
+	.loc 1 106 5 is_stmt 0 view .LVU455
+.LBE103:
+.LBE102:
+	.loc 1 271 5 is_stmt 1 view .LVU456
+	movq	136(%rsp), %rdi	# buf,
+	call	free@PLT	#
+.LVL97:
+	.loc 1 272 5 view .LVU457
+# blake2s-uring.c:272:     if (err) {
+	.loc 1 272 8 is_stmt 0 view .LVU458
+	movl	(%rsp), %eax	# %sfp,
+	testl	%eax, %eax	#
+	jne	.L132	#,
+.L58:
+# blake2s-uring.c:276:     return 1;
+	.loc 1 276 12 view .LVU459
+	movl	$1, %eax	#, <retval>
+	jmp	.L8	#
+.LVL98:
+	.p2align 4,,10
+	.p2align 3
+.L133:
+.LBB105:
+.LBB96:
+	.loc 1 259 13 is_stmt 1 view .LVU460
+# blake2s-uring.c:259:             blake2s_update(ctx, iov[s].iov_base, S->got);
+	.loc 1 259 39 is_stmt 0 view .LVU461
+	salq	$4, %rcx	#, s
+.LVL99:
+# blake2s-uring.c:259:             blake2s_update(ctx, iov[s].iov_base, S->got);
+	.loc 1 259 13 view .LVU462
+	movq	24(%rsp), %rdi	# %sfp,
+# blake2s-uring.c:260:             done++;
+	.loc 1 260 17 view .LVU463
+	addq	$1, %rbp	#, done
+.LVL100:
+# blake2s-uring.c:259:             blake2s_update(ctx, iov[s].iov_base, S->got);
+	.loc 1 259 13 view .LVU464
+	movq	288(%rsp,%rcx), %rsi	# iov[s_109].iov_base, iov[s_109].iov_base
+# blake2s-uring.c:259:             blake2s_update(ctx, iov[s].iov_base, S->got);
+	.loc 1 259 39 view .LVU465
+	movq	%rcx, %r15	# s, tmp483
+# blake2s-uring.c:259:             blake2s_update(ctx, iov[s].iov_base, S->got);
+	.loc 1 259 13 view .LVU466
+	call	blake2s_update@PLT	#
+.LVL101:
+	.loc 1 260 13 is_stmt 1 view .LVU467
+	.loc 1 261 13 view .LVU468
+# blake2s-uring.c:261:             if (next < nchunks) {
+	.loc 1 261 16 is_stmt 0 view .LVU469
+	cmpq	%r12, %rbx	# tmp312, next
+	jnb	.L55	#,
+	.loc 1 262 17 is_stmt 1 view .LVU470
+.LVL102:
+.LBB89:
+	.loc 1 161 13 view .LVU471
+.LBB79:
+	.loc 1 164 5 view .LVU472
+# blake2s-uring.c:164:     S->off = off + (uint64_t)k * chunk;
+	.loc 1 164 32 is_stmt 0 view .LVU473
+	movq	72(%rsp), %rax	# %sfp, chunk
+# blake2s-uring.c:164:     S->off = off + (uint64_t)k * chunk;
+	.loc 1 164 18 view .LVU474
+	movq	80(%rsp), %rcx	# %sfp, off
+.LBE79:
+.LBE89:
+# blake2s-uring.c:263:                 bring_read(&R, fd, S, iov[s].iov_base, fixed ? (int)s : -1,
+	.loc 1 263 17 view .LVU475
+	movq	%rbx, %r9	# next,
+	movl	%r13d, %r8d	# tmp466,
+.LBB90:
+.LBB80:
+# blake2s-uring.c:165:     S->want = size - S->off < chunk ? size - S->off : chunk;
+	.loc 1 165 20 view .LVU476
+	movq	88(%rsp), %rdx	# %sfp, tmp502
+.LBE80:
+.LBE90:
+# blake2s-uring.c:263:                 bring_read(&R, fd, S, iov[s].iov_base, fixed ? (int)s : -1,
+	.loc 1 263 17 view .LVU477
+	movq	40(%rsp), %rdi	# %sfp,
+.LBB91:
+.LBB81:
+# blake2s-uring.c:166:     S->got = 0;
+	.loc 1 166 12 view .LVU478
+	movq	$0, 432(%rsp,%r14)	#, MEM <struct bring_slot[8]> [(struct bring_slot *)_28][s_109].got
+# blake2s-uring.c:164:     S->off = off + (uint64_t)k * chunk;
+	.loc 1 164 32 view .LVU479
+	movq	%rax, %rsi	# chunk, tmp487
+	imulq	%rbx, %rsi	# next, tmp487
+# blake2s-uring.c:164:     S->off = off + (uint64_t)k * chunk;
+	.loc 1 164 18 view .LVU480
+	addq	%rcx, %rsi	# off, _152
+.LBE81:
+.LBE91:
+# blake2s-uring.c:263:                 bring_read(&R, fd, S, iov[s].iov_base, fixed ? (int)s : -1,
+	.loc 1 263 17 view .LVU481
+	movq	288(%rsp,%r15), %rcx	# iov[s_109].iov_base, iov[s_109].iov_base
+.LBB92:
+.LBB82:
+# blake2s-uring.c:165:     S->want = size - S->off < chunk ? size - S->off : chunk;
+	.loc 1 165 20 view .LVU482
+	subq	%rsi, %rdx	# _152, tmp502
+# blake2s-uring.c:164:     S->off = off + (uint64_t)k * chunk;
+	.loc 1 164 12 view .LVU483
+	movq	%rsi, 416(%rsp,%r14)	# _152, MEM <struct bring_slot[8]> [(struct bring_slot *)_28][s_109].off
+	.loc 1 165 5 is_stmt 1 view .LVU484
+.LBE82:
+.LBE92:
+# blake2s-uring.c:256:             struct bring_slot *S = &slot[s];
+	.loc 1 256 32 is_stmt 0 view .LVU485
+	movq	32(%rsp), %rsi	# %sfp, tmp530
+.LBB93:
+.LBB83:
+# blake2s-uring.c:165:     S->want = size - S->off < chunk ? size - S->off : chunk;
+	.loc 1 165 53 view .LVU486
+	cmpq	%rax, %rdx	# chunk, tmp502
+	cmova	%rax, %rdx	# tmp502,, chunk, tmp503
+.LBE83:
+.LBE93:
+# blake2s-uring.c:256:             struct bring_slot *S = &slot[s];
+	.loc 1 256 32 view .LVU487
+	leaq	0(%r13,%r13,2), %rax	#, tmp519
+# blake2s-uring.c:266:                 next++;
+	.loc 1 266 21 view .LVU488
+	addq	$1, %rbx	#, next
+.LVL103:
+.LBB94:
+.LBB84:
+# blake2s-uring.c:165:     S->want = size - S->off < chunk ? size - S->off : chunk;
+	.loc 1 165 13 view .LVU489
+	movq	%rdx, 424(%rsp,%r14)	# tmp503, MEM <struct bring_slot[8]> [(struct bring_slot *)_28][s_109].want
+	.loc 1 166 5 is_stmt 1 view .LVU490
+.LVL104:
+	.loc 1 166 5 is_stmt 0 view .LVU491
+.LBE84:
+.LBE94:
+	.loc 1 263 17 is_stmt 1 view .LVU492
+# blake2s-uring.c:256:             struct bring_slot *S = &slot[s];
+	.loc 1 256 32 is_stmt 0 view .LVU493
+	leaq	(%rsi,%rax,8), %rdx	#, S
+# blake2s-uring.c:263:                 bring_read(&R, fd, S, iov[s].iov_base, fixed ? (int)s : -1,
+	.loc 1 263 17 view .LVU494
+	movl	16(%rsp), %esi	# %sfp,
+	call	bring_read	#
+.LVL105:
+	.loc 1 265 17 is_stmt 1 view .LVU495
+	.loc 1 266 17 view .LVU496
+# blake2s-uring.c:265:                 inflight++;
+	.loc 1 265 25 is_stmt 0 view .LVU497
+	addl	$1, 96(%rsp)	#, %sfp
+.LVL106:
+.L55:
+	.loc 1 265 25 view .LVU498
+.LBE96:
+	.loc 1 254 21 is_stmt 1 view .LVU499
+	cmpq	%r12, %rbp	# tmp312, done
+	jnb	.L119	#,
+.LVL107:
+.L52:
+.LBB97:
+	.loc 1 255 13 view .LVU500
+# blake2s-uring.c:255:             unsigned s = done % depth;
+	.loc 1 255 31 is_stmt 0 view .LVU501
+	movq	%rbp, %rax	# done, tmp467
+	xorl	%edx, %edx	# tmp466
+	divq	64(%rsp)	# %sfp
+# blake2s-uring.c:257:             if (S->got < S->want)
+	.loc 1 257 18 view .LVU502
+	leaq	(%rdx,%rdx,2), %rax	#, tmp531
+# blake2s-uring.c:255:             unsigned s = done % depth;
+	.loc 1 255 31 view .LVU503
+	movq	%rdx, %r13	# tmp466, tmp466
+.LVL108:
+	.loc 1 256 13 is_stmt 1 view .LVU504
+	.loc 1 257 13 view .LVU505
+# blake2s-uring.c:257:             if (S->got < S->want)
+	.loc 1 257 18 is_stmt 0 view .LVU506
+	movl	%edx, %ecx	# tmp466, s
+	leaq	0(,%rax,8), %r14	#, tmp472
+	movq	432(%rsp,%r14), %rdx	# MEM <struct bring_slot[8]> [(struct bring_slot *)_28][s_109].got, _47
+.LVL109:
+# blake2s-uring.c:257:             if (S->got < S->want)
+	.loc 1 257 16 view .LVU507
+	cmpq	424(%rsp,%r14), %rdx	# MEM <struct bring_slot[8]> [(struct bring_slot *)_28][s_109].want, _47
+	jnb	.L133	#,
+	.loc 1 257 16 view .LVU508
+.LBE97:
+	jmp	.L119	#
+.LVL110:
+	.p2align 4,,10
+	.p2align 3
+.L122:
+	.loc 1 257 16 view .LVU509
+	movl	%edx, %ecx	# tmp342, s
+.LVL111:
+.L46:
+.LBB98:
+	.loc 1 248 17 is_stmt 1 view .LVU510
+	cmpq	$0, 48(%rsp)	#, %sfp
+# blake2s-uring.c:248:                 bring_read(&R, fd, S, iov[s].iov_base, fixed ? (int)s : -1, k);
+	.loc 1 248 45 is_stmt 0 view .LVU511
+	movq	%rcx, %rax	# s, s
+# blake2s-uring.c:248:                 bring_read(&R, fd, S, iov[s].iov_base, fixed ? (int)s : -1, k);
+	.loc 1 248 17 view .LVU512
+	movl	$-1, %r8d	#, iftmp.2_75
+# blake2s-uring.c:223:             struct bring_slot *S = &slot[s];
+	.loc 1 223 32 view .LVU513
+	movq	32(%rsp), %rdi	# %sfp, tmp530
+# blake2s-uring.c:248:                 bring_read(&R, fd, S, iov[s].iov_base, fixed ? (int)s : -1, k);
+	.loc 1 248 17 view .LVU514
+	cmove	%edx, %r8d	# tmp342,, iftmp.2_75
+# blake2s-uring.c:248:                 bring_read(&R, fd, S, iov[s].iov_base, fixed ? (int)s : -1, k);
+	.loc 1 248 45 view .LVU515
+	salq	$4, %rax	#, s
+# blake2s-uring.c:248:                 bring_read(&R, fd, S, iov[s].iov_base, fixed ? (int)s : -1, k);
+	.loc 1 248 17 view .LVU516
+	movl	16(%rsp), %esi	# %sfp,
+.LVL112:
+	.loc 1 248 17 view .LVU517
+	movq	288(%rsp,%rax), %rcx	# iov[s_120].iov_base, iov[s_120].iov_base
+# blake2s-uring.c:223:             struct bring_slot *S = &slot[s];
+	.loc 1 223 32 view .LVU518
+	leaq	(%rdx,%rdx,2), %rax	#, tmp390
+	leaq	(%rdi,%rax,8), %rdx	#, S
+# blake2s-uring.c:248:                 bring_read(&R, fd, S, iov[s].iov_base, fixed ? (int)s : -1, k);
+	.loc 1 248 17 view .LVU519
+	movq	40(%rsp), %rdi	# %sfp,
+	call	bring_read	#
+.LVL113:
+	.loc 1 249 17 is_stmt 1 view .LVU520
+	.loc 1 249 17 is_stmt 0 view .LVU521
+	jmp	.L34	#
+.LVL114:
+	.p2align 4,,10
+	.p2align 3
+.L44:
+	.loc 1 249 17 view .LVU522
+	movq	%rax, 432(%rsp,%r8)	# _33, MEM <struct bring_slot[8]> [(void *)_28][s_120].got
+	.loc 1 239 17 is_stmt 1 view .LVU523
+.LVL115:
+	.loc 1 242 17 view .LVU524
+# blake2s-uring.c:242:                 if (again && direct) {
+	.loc 1 242 20 is_stmt 0 view .LVU525
+	cmpq	%rdi, %rax	# _35, _33
+	jnb	.L64	#,
+	movl	104(%rsp), %r8d	# %sfp,
+	testl	%r8d, %r8d	#
+	jne	.L63	#,
+.LVL116:
+	.loc 1 247 13 is_stmt 1 view .LVU526
+# blake2s-uring.c:247:             if (again) {
+	.loc 1 247 16 is_stmt 0 view .LVU527
+	cmpq	%rdi, %rax	# _35, _33
+	jb	.L46	#,
+.LVL117:
+	.p2align 4,,10
+	.p2align 3
+.L64:
+# blake2s-uring.c:226:             inflight--;
+	.loc 1 226 21 view .LVU528
+	movl	%esi, %r15d	# inflight, inflight
+	jmp	.L34	#
+.LVL118:
+	.p2align 4,,10
+	.p2align 3
+.L63:
+# blake2s-uring.c:243:                     err = EIO;
+	.loc 1 243 25 view .LVU529
+	movl	$5, (%rsp)	#, %sfp
+# blake2s-uring.c:226:             inflight--;
+	.loc 1 226 21 view .LVU530
+	movl	%esi, %r15d	# inflight, inflight
+	jmp	.L34	#
+.LVL119:
+	.p2align 4,,10
+	.p2align 3
+.L130:
+	.loc 1 232 17 is_stmt 1 view .LVU531
+# blake2s-uring.c:232:                 err = -cqe.res;
+	.loc 1 232 21 is_stmt 0 view .LVU532
+	negl	%eax	# _123
+# blake2s-uring.c:226:             inflight--;
+	.loc 1 226 21 view .LVU533
+	movl	%esi, %r15d	# inflight, inflight
+# blake2s-uring.c:232:                 err = -cqe.res;
+	.loc 1 232 21 view .LVU534
+	movl	%eax, (%rsp)	# _123, %sfp
+.LVL120:
+	.loc 1 247 13 is_stmt 1 view .LVU535
+	jmp	.L34	#
+.LVL121:
+.L26:
+	.loc 1 247 13 is_stmt 0 view .LVU536
+	movq	80(%rsp), %rbp	# %sfp, off
+	movq	88(%rsp), %rbx	# %sfp, ivtmp.54
+.LBE98:
+.LBE105:
+# blake2s-uring.c:177:     size_t next = 0, done = 0;
+	.loc 1 177 12 view .LVU537
+	xorl	%r9d, %r9d	# next
+	movq	%rax, %r14	# _296, _296
+	movq	%r12, 64(%rsp)	# tmp312, %sfp
+.LVL122:
+	.loc 1 177 12 view .LVU538
+	movq	32(%rsp), %r15	# %sfp, ivtmp.53
+	leaq	160(%rsp), %rdi	#, tmp529
+	subq	%rbp, %rbx	# off, ivtmp.54
+	movq	%rbp, %r12	# ivtmp.52, ivtmp.52
+	movq	72(%rsp), %rbp	# %sfp, chunk
+.LVL123:
+	.p2align 4,,10
+	.p2align 3
+.L29:
+	.loc 1 202 9 is_stmt 1 view .LVU539
+.LBB106:
+	.loc 1 161 13 view .LVU540
+.LBB49:
+	.loc 1 164 5 view .LVU541
+# blake2s-uring.c:165:     S->want = size - S->off < chunk ? size - S->off : chunk;
+	.loc 1 165 53 is_stmt 0 view .LVU542
+	cmpq	%rbx, %rbp	# ivtmp.54, chunk
+	movq	%rbx, %rdx	# ivtmp.54, tmp319
+# blake2s-uring.c:164:     S->off = off + (uint64_t)k * chunk;
+	.loc 1 164 12 view .LVU543
+	movq	%r12, (%r15)	# ivtmp.52, MEM <uint64_t> [(struct bring_slot *)_17]
+	.loc 1 165 5 is_stmt 1 view .LVU544
+.LBE49:
+.LBE106:
+# blake2s-uring.c:203:         bring_read(&R, fd, &slot[next], iov[next].iov_base,
+	.loc 1 203 9 is_stmt 0 view .LVU545
+	movl	16(%rsp), %esi	# %sfp,
+.LBB107:
+.LBB50:
+# blake2s-uring.c:165:     S->want = size - S->off < chunk ? size - S->off : chunk;
+	.loc 1 165 53 view .LVU546
+	cmovbe	%rbp, %rdx	# chunk,, tmp319
+.LBE50:
+.LBE107:
+# blake2s-uring.c:203:         bring_read(&R, fd, &slot[next], iov[next].iov_base,
+	.loc 1 203 9 view .LVU547
+	movl	%r9d, %r8d	# next,
+# blake2s-uring.c:201:     for (; next < nchunks && next < depth; next++) {
+	.loc 1 201 27 view .LVU548
+	addq	%rbp, %r12	# chunk, ivtmp.52
+	subq	%rbp, %rbx	# chunk, ivtmp.54
+.LBB108:
+.LBB51:
+# blake2s-uring.c:166:     S->got = 0;
+	.loc 1 166 12 view .LVU549
+	movq	$0, 16(%r15)	#, MEM <size_t> [(struct bring_slot *)_17 + 16B]
+# blake2s-uring.c:165:     S->want = size - S->off < chunk ? size - S->off : chunk;
+	.loc 1 165 13 view .LVU550
+	movq	%rdx, 8(%r15)	# tmp319, MEM <size_t> [(struct bring_slot *)_17 + 8B]
+	.loc 1 166 5 is_stmt 1 view .LVU551
+.LVL124:
+	.loc 1 166 5 is_stmt 0 view .LVU552
+.LBE51:
+.LBE108:
+	.loc 1 203 9 is_stmt 1 view .LVU553
+# blake2s-uring.c:203:         bring_read(&R, fd, &slot[next], iov[next].iov_base,
+	.loc 1 203 50 is_stmt 0 view .LVU554
+	movq	%r9, %rdx	# next, tmp321
+	salq	$4, %rdx	#, tmp321
+# blake2s-uring.c:203:         bring_read(&R, fd, &slot[next], iov[next].iov_base,
+	.loc 1 203 9 view .LVU555
+	movq	0(%r13,%rdx), %rcx	# MEM[(void * *)&iov + _436 * 1], MEM[(void * *)&iov + _436 * 1]
+	movq	%r15, %rdx	# ivtmp.53,
+# blake2s-uring.c:201:     for (; next < nchunks && next < depth; next++) {
+	.loc 1 201 27 view .LVU556
+	addq	$24, %r15	#, ivtmp.53
+# blake2s-uring.c:203:         bring_read(&R, fd, &slot[next], iov[next].iov_base,
+	.loc 1 203 9 view .LVU557
+	call	bring_read	#
+.LVL125:
+	.loc 1 205 9 is_stmt 1 view .LVU558
+	.loc 1 201 48 view .LVU559
+	addq	$1, %r9	#, next
+.LVL126:
+	.loc 1 201 27 view .LVU560
+	cmpq	%r14, %r9	# _296, next
+	jb	.L29	#,
+	jmp	.L120	#
+.LVL127:
+.L126:
+	.loc 1 190 9 view .LVU561
+.LBB109:
+.LBI109:
+	.loc 1 100 13 view .LVU562
+.LBB110:
+	.loc 1 102 5 view .LVU563
+	movq	96(%rsp), %rsi	# %sfp,
+	movq	%r9, %rdi	# _342,
+	call	munmap@PLT	#
+.LVL128:
+	.loc 1 103 5 view .LVU564
+# blake2s-uring.c:103:     if (R->cq_map != R->sq_map)
+	.loc 1 103 8 is_stmt 0 view .LVU565
+	cmpq	%r12, 64(%rsp)	# _265, %sfp
+	je	.L22	#,
+	.loc 1 104 9 is_stmt 1 view .LVU566
+	movq	%r15, %rsi	# prephitmp_44,
+	movq	%r12, %rdi	# _265,
+	call	munmap@PLT	#
+.LVL129:
+.L22:
+	.loc 1 105 5 view .LVU567
+	movq	64(%rsp), %rdi	# %sfp,
+	movq	%rbp, %rsi	# pretmp_186,
+	call	munmap@PLT	#
+.LVL130:
+	.loc 1 106 5 view .LVU568
+	movl	108(%rsp), %edi	# %sfp,
+	call	close@PLT	#
+.LVL131:
+	.loc 1 106 5 is_stmt 0 view .LVU569
+.LBE110:
+.LBE109:
+	.loc 1 191 8 is_stmt 1 view .LVU570
+# blake2s-uring.c:191:         errno = ENOMEM;
+	.loc 1 191 10 is_stmt 0 view .LVU571
+	call	__errno_location@PLT	#
+.LVL132:
+# blake2s-uring.c:191:         errno = ENOMEM;
+	.loc 1 191 14 view .LVU572
+	movl	$12, (%rax)	#, *_9
+	.loc 1 192 9 is_stmt 1 view .LVU573
+# blake2s-uring.c:192:         return -1;
+	.loc 1 192 16 is_stmt 0 view .LVU574
+	jmp	.L23	#
+.LVL133:
+.L132:
+	.loc 1 273 8 is_stmt 1 view .LVU575
+# blake2s-uring.c:273:         errno = err;
+	.loc 1 273 10 is_stmt 0 view .LVU576
+	call	__errno_location@PLT	#
+.LVL134:
+# blake2s-uring.c:273:         errno = err;
+	.loc 1 273 14 view .LVU577
+	movl	(%rsp), %ebx	# %sfp, err
+	movl	%ebx, (%rax)	# err, *_56
+	.loc 1 274 9 is_stmt 1 view .LVU578
+# blake2s-uring.c:274:         return -1;
+	.loc 1 274 16 is_stmt 0 view .LVU579
+	jmp	.L23	#
+.LVL135:
+.L25:
+	.loc 1 209 12 is_stmt 1 view .LVU580
+	.loc 1 270 5 view .LVU581
+.LBB111:
+	.loc 1 100 13 view .LVU582
+.LBB104:
+	.loc 1 102 5 view .LVU583
+	movq	96(%rsp), %rsi	# %sfp,
+	movq	%r9, %rdi	# _342,
+	call	munmap@PLT	#
+.LVL136:
+	.loc 1 103 5 view .LVU584
+# blake2s-uring.c:103:     if (R->cq_map != R->sq_map)
+	.loc 1 103 8 is_stmt 0 view .LVU585
+	cmpq	%r12, 64(%rsp)	# _265, %sfp
+	jne	.L31	#,
+	.loc 1 105 5 is_stmt 1 view .LVU586
+	movq	64(%rsp), %rdi	# %sfp,
+	movq	%rbp, %rsi	# pretmp_186,
+	call	munmap@PLT	#
+.LVL137:
+	.loc 1 106 5 view .LVU587
+	movl	108(%rsp), %edi	# %sfp,
+	call	close@PLT	#
+.LVL138:
+	.loc 1 106 5 is_stmt 0 view .LVU588
+.LBE104:
+.LBE111:
+	.loc 1 271 5 is_stmt 1 view .LVU589
+	movq	136(%rsp), %rdi	# buf,
+	call	free@PLT	#
+.LVL139:
+	.loc 1 272 5 view .LVU590
+	jmp	.L58	#
+.LVL140:
+.L12:
+.LBB112:
+.LBB38:
+	.loc 1 73 5 view .LVU591
+# blake2s-uring.c:73:     R->sqes = mmap(NULL, R->sqe_len, PROT_READ | PROT_WRITE,
+	.loc 1 73 15 is_stmt 0 view .LVU592
+	movq	96(%rsp), %rsi	# %sfp,
+	xorl	%edi, %edi	#
+	movl	$268435456, %r9d	#,
+	movl	%r14d, %r8d	# _161,
+	movl	$32769, %ecx	#,
+	movl	$3, %edx	#,
+	call	mmap@PLT	#
+.LVL141:
+	movq	%rax, %rdi	# tmp560, _344
+	.loc 1 75 5 is_stmt 1 view .LVU593
+	.loc 1 77 9 view .LVU594
+# blake2s-uring.c:77:         if (R->sqes != MAP_FAILED)
+	.loc 1 77 12 is_stmt 0 view .LVU595
+	cmpq	$-1, %rax	#, _344
+	je	.L18	#,
+	.loc 1 78 13 is_stmt 1 view .LVU596
+	movq	96(%rsp), %rsi	# %sfp,
+	call	munmap@PLT	#
+.LVL142:
+	.loc 1 79 9 view .LVU597
+	.loc 1 81 9 view .LVU598
+.L18:
+	.loc 1 83 9 view .LVU599
+	movl	108(%rsp), %edi	# %sfp,
+	call	close@PLT	#
+.LVL143:
+	.loc 1 84 9 view .LVU600
+.L10:
+	.loc 1 84 9 is_stmt 0 view .LVU601
+.LBE38:
+.LBE112:
+# blake2s-uring.c:187:         return 0;
+	.loc 1 187 16 view .LVU602
+	xorl	%eax, %eax	# <retval>
+	jmp	.L8	#
+.LVL144:
+.L14:
+.LBB113:
+.LBB39:
+	.loc 1 77 9 is_stmt 1 view .LVU603
+# blake2s-uring.c:77:         if (R->sqes != MAP_FAILED)
+	.loc 1 77 12 is_stmt 0 view .LVU604
+	cmpq	$-1, %rax	#, _342
+	je	.L17	#,
+	.loc 1 78 13 is_stmt 1 view .LVU605
+	movq	96(%rsp), %rsi	# %sfp,
+	movq	%rax, %rdi	# _342,
+	call	munmap@PLT	#
+.LVL145:
+	.loc 1 79 9 view .LVU606
+	.loc 1 81 9 view .LVU607
+.L17:
+	.loc 1 82 13 view .LVU608
+	movq	64(%rsp), %rdi	# %sfp,
+	movq	%rbp, %rsi	# pretmp_186,
+	call	munmap@PLT	#
+.LVL146:
+	jmp	.L18	#
+.L125:
+# blake2s-uring.c:79:         if (R->cq_map != MAP_FAILED && R->cq_map != R->sq_map)
+	.loc 1 79 36 is_stmt 0 view .LVU609
+	cmpq	%r12, 64(%rsp)	# _265, %sfp
+	je	.L17	#,
+	.loc 1 80 13 is_stmt 1 view .LVU610
+	movq	%r15, %rsi	# prephitmp_44,
+	movq	%r12, %rdi	# _265,
+	call	munmap@PLT	#
+.LVL147:
+	.loc 1 81 9 view .LVU611
+	jmp	.L17	#
+.LBE39:
+.LBE113:
+	.cfi_endproc
+.LFE38:
+	.size	blake2s_uring_run, .-blake2s_uring_run
+	.p2align 4
+	.globl	blake2s_file_async
+	.type	blake2s_file_async, @function
+blake2s_file_async:
+.LVL148:
+.LFB39:
+	.loc 1 291 1 view -0
+	.cfi_startproc
+	.loc 1 292 5 view .LVU613
+# blake2s-uring.c:291: {
+	.loc 1 291 1 is_stmt 0 view .LVU614
+	subq	$24, %rsp	#,
+	.cfi_def_cfa_offset 32
+# blake2s-uring.c:292:     struct blake2s_io io = { BLAKE2S_IO_URING, 0, 0 };
+	.loc 1 292 23 view .LVU615
+	movq	.LC0(%rip), %rax	#, tmp85
+	movq	$0, 8(%rsp)	#, io.chunk
+	.loc 1 293 5 is_stmt 1 view .LVU616
+# blake2s-uring.c:293:     return blake2s_file_ex(out, stream, &io);
+	.loc 1 293 12 is_stmt 0 view .LVU617
+	movq	%rsp, %rdx	#, tmp86
+# blake2s-uring.c:292:     struct blake2s_io io = { BLAKE2S_IO_URING, 0, 0 };
+	.loc 1 292 23 view .LVU618
+	movq	%rax, (%rsp)	# tmp85, MEM <vector(2) unsigned int> [(unsigned int *)&io]
+# blake2s-uring.c:293:     return blake2s_file_ex(out, stream, &io);
+	.loc 1 293 12 view .LVU619
+	call	blake2s_file_ex@PLT	#
+.LVL149:
+# blake2s-uring.c:294: }
+	.loc 1 294 1 view .LVU620
+	addq	$24, %rsp	#,
+	.cfi_def_cfa_offset 8
+	ret	
+	.cfi_endproc
+.LFE39:
+	.size	blake2s_file_async, .-blake2s_file_async
+	.section	.rodata.cst8,"aM",@progbits,8
+	.align 8
+.LC0:
+	.long	2
+	.long	0
+	.text
+.Letext0:
+	.file 2 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stddef.h"
+	.file 3 "/usr/include/x86_64-linux-gnu/bits/types.h"
+	.file 4 "/usr/include/x86_64-linux-gnu/bits/stdint-uintn.h"
+	.file 5 "/usr/include/x86_64-linux-gnu/bits/types/struct_FILE.h"
+	.file 6 "/usr/include/x86_64-linux-gnu/bits/types/FILE.h"
+	.file 7 "blake2s.h"
+	.file 8 "blake2s-internal.h"
+	.file 9 "/usr/include/asm-generic/int-ll64.h"
+	.file 10 "/usr/include/linux/io_uring.h"
+	.file 11 "/usr/include/x86_64-linux-gnu/bits/types/struct_iovec.h"
+	.file 12 "/usr/include/unistd.h"
+	.file 13 "/usr/include/x86_64-linux-gnu/sys/mman.h"
+	.file 14 "/usr/include/string.h"
+	.file 15 "/usr/include/stdlib.h"
+	.file 16 "/usr/include/errno.h"
+	.section	.debug_info,"",@progbits
+.Ldebug_info0:
+	.long	0x199f
+	.value	0x5
+	.byte	0x1
+	.byte	0x8
+	.long	.Ldebug_abbrev0
+	.uleb128 0x2e
+	.long	.LASF254
+	.byte	0xc
+	.long	.LASF0
+	.long	.LASF1
+	.quad	.Ltext0
+	.quad	.Letext0-.Ltext0
+	.long	.Ldebug_line0
+	.uleb128 0xd
+	.byte	0x8
+	.byte	0x7
+	.long	.LASF2
+	.uleb128 0xa
+	.long	.LASF9
+	.byte	0x2
+	.byte	0xd6
+	.byte	0x1b
+	.long	0x2e
+	.uleb128 0x2f
+	.byte	0x4
+	.byte	0x5
+	.string	"int"
+	.uleb128 0xd
+	.byte	0x8
+	.byte	0x5
+	.long	.LASF3
+	.uleb128 0xd
+	.byte	0x8
+	.byte	0x5
+	.long	.LASF4
+	.uleb128 0xd
+	.byte	0x1
+	.byte	0x8
+	.long	.LASF5
+	.uleb128 0xd
+	.byte	0x2
+	.byte	0x7
+	.long	.LASF6
+	.uleb128 0xd
+	.byte	0x4
+	.byte	0x7
+	.long	.LASF7
+	.uleb128 0xd
+	.byte	0x1
+	.byte	0x6
+	.long	.LASF8
+	.uleb128 0xa
+	.long	.LASF10
+	.byte	0x3
+	.byte	0x26
+	.byte	0x17
+	.long	0x56
+	.uleb128 0xd
+	.byte	0x2
+	.byte	0x5
+	.long	.LASF11
+	.uleb128 0xa
+	.long	.LASF12
+	.byte	0x3
+	.byte	0x2a
+	.byte	0x16
+	.long	0x64
+	.uleb128 0xa
+	.long	.LASF13
+	.byte	0x3
+	.byte	0x2d
+	.byte	0x1b
+	.long	0x2e
+	.uleb128 0xa
+	.long	.LASF14
+	.byte	0x3
+	.byte	0x98
+	.byte	0x12
+	.long	0x48
+	.uleb128 0xa
+	.long	.LASF15
+	.byte	0x3
+	.byte	0x99
+	.byte	0x12
+	.long	0x48
+	.uleb128 0x30
+	.byte	0x8
+	.uleb128 0x8
+	.long	0xbc
+	.uleb128 0xd
+	.byte	0x1
+	.byte	0x6
+	.long	.LASF16
+	.uleb128 0xd
+	.byte	0x8
+	.byte	0x7
+	.long	.LASF17
+	.uleb128 0x8
+	.long	0xcf
+	.uleb128 0x31
+	.uleb128 0xa
+	.long	.LASF18
+	.byte	0x4
+	.byte	0x18
+	.byte	0x13
+	.long	0x72
+	.uleb128 0xa
+	.long	.LASF19
+	.byte	0x4
+	.byte	0x1a
+	.byte	0x14
+	.long	0x85
+	.uleb128 0xa
+	.long	.LASF20
+	.byte	0x4
+	.byte	0x1b
+	.byte	0x14
+	.long	0x91
+	.uleb128 0x14
+	.long	.LASF54
+	.byte	0xd8
+	.byte	0x5
+	.byte	0x31
+	.long	0x27a
+	.uleb128 0x3
+	.long	.LASF21
+	.byte	0x5
+	.byte	0x33
+	.byte	0x7
+	.long	0x41
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF22
+	.byte	0x5
+	.byte	0x36
+	.byte	0x9
+	.long	0xb7
+	.byte	0x8
+	.uleb128 0x3
+	.long	.LASF23
+	.byte	0x5
+	.byte	0x37
+	.byte	0x9
+	.long	0xb7
+	.byte	0x10
+	.uleb128 0x3
+	.long	.LASF24
+	.byte	0x5
+	.byte	0x38
+	.byte	0x9
+	.long	0xb7
+	.byte	0x18
+	.uleb128 0x3
+	.long	.LASF25
+	.byte	0x5
+	.byte	0x39
+	.byte	0x9
+	.long	0xb7
+	.byte	0x20
+	.uleb128 0x3
+	.long	.LASF26
+	.byte	0x5
+	.byte	0x3a
+	.byte	0x9
+	.long	0xb7
+	.byte	0x28
+	.uleb128 0x3
+	.long	.LASF27
+	.byte	0x5
+	.byte	0x3b
+	.byte	0x9
+	.long	0xb7
+	.byte	0x30
+	.uleb128 0x3
+	.long	.LASF28
+	.byte	0x5
+	.byte	0x3c
+	.byte	0x9
+	.long	0xb7
+	.byte	0x38
+	.uleb128 0x3
+	.long	.LASF29
+	.byte	0x5
+	.byte	0x3d
+	.byte	0x9
+	.long	0xb7
+	.byte	0x40
+	.uleb128 0x3
+	.long	.LASF30
+	.byte	0x5
+	.byte	0x40
+	.byte	0x9
+	.long	0xb7
+	.byte	0x48
+	.uleb128 0x3
+	.long	.LASF31
+	.byte	0x5
+	.byte	0x41
+	.byte	0x9
+	.long	0xb7
+	.byte	0x50
+	.uleb128 0x3
+	.long	.LASF32
+	.byte	0x5
+	.byte	0x42
+	.byte	0x9
+	.long	0xb7
+	.byte	0x58
+	.uleb128 0x3
+	.long	.LASF33
+	.byte	0x5
+	.byte	0x44
+	.byte	0x16
+	.long	0x293
+	.byte	0x60
+	.uleb128 0x3
+	.long	.LASF34
+	.byte	0x5
+	.byte	0x46
+	.byte	0x14
+	.long	0x298
+	.byte	0x68
+	.uleb128 0x3
+	.long	.LASF35
+	.byte	0x5
+	.byte	0x48
+	.byte	0x7
+	.long	0x41
+	.byte	0x70
+	.uleb128 0x3
+	.long	.LASF36
+	.byte	0x5
+	.byte	0x49
+	.byte	0x7
+	.long	0x41
+	.byte	0x74
+	.uleb128 0x3
+	.long	.LASF37
+	.byte	0x5
+	.byte	0x4a
+	.byte	0xb
+	.long	0x9d
+	.byte	0x78
+	.uleb128 0x3
+	.long	.LASF38
+	.byte	0x5
+	.byte	0x4d
+	.byte	0x12
+	.long	0x5d
+	.byte	0x80
+	.uleb128 0x3
+	.long	.LASF39
+	.byte	0x5
+	.byte	0x4e
+	.byte	0xf
+	.long	0x6b
+	.byte	0x82
+	.uleb128 0x3
+	.long	.LASF40
+	.byte	0x5
+	.byte	0x4f
+	.byte	0x8
+	.long	0x29d
+	.byte	0x83
+	.uleb128 0x3
+	.long	.LASF41
+	.byte	0x5
+	.byte	0x51
+	.byte	0xf
+	.long	0x2ad
+	.byte	0x88
+	.uleb128 0x3
+	.long	.LASF42
+	.byte	0x5
+	.byte	0x59
+	.byte	0xd
+	.long	0xa9
+	.byte	0x90
+	.uleb128 0x3
+	.long	.LASF43
+	.byte	0x5
+	.byte	0x5b
+	.byte	0x17
+	.long	0x2b7
+	.byte	0x98
+	.uleb128 0x3
+	.long	.LASF44
+	.byte	0x5
+	.byte	0x5c
+	.byte	0x19
+	.long	0x2c1
+	.byte	0xa0
+	.uleb128 0x3
+	.long	.LASF45
+	.byte	0x5
+	.byte	0x5d
+	.byte	0x14
+	.long	0x298
+	.byte	0xa8
+	.uleb128 0x3
+	.long	.LASF46
+	.byte	0x5
+	.byte	0x5e
+	.byte	0x9
+	.long	0xb5
+	.byte	0xb0
+	.uleb128 0x3
+	.long	.LASF47
+	.byte	0x5
+	.byte	0x5f
+	.byte	0xa
+	.long	0x35
+	.byte	0xb8
+	.uleb128 0x3
+	.long	.LASF48
+	.byte	0x5
+	.byte	0x60
+	.byte	0x7
+	.long	0x41
+	.byte	0xc0
+	.uleb128 0x3
+	.long	.LASF49
+	.byte	0x5
+	.byte	0x62
+	.byte	0x8
+	.long	0x2c6
+	.byte	0xc4
+	.byte	0
+	.uleb128 0xa
+	.long	.LASF50
+	.byte	0x6
+	.byte	0x7
+	.byte	0x19
+	.long	0xf4
+	.uleb128 0x32
+	.long	.LASF255
+	.byte	0x5
+	.byte	0x2b
+	.byte	0xe
+	.uleb128 0x1f
+	.long	.LASF51
+	.uleb128 0x8
+	.long	0x28e
+	.uleb128 0x8
+	.long	0xf4
+	.uleb128 0xb
+	.long	0xbc
+	.long	0x2ad
+	.uleb128 0xc
+	.long	0x2e
+	.byte	0
+	.byte	0
+	.uleb128 0x8
+	.long	0x286
+	.uleb128 0x1f
+	.long	.LASF52
+	.uleb128 0x8
+	.long	0x2b2
+	.uleb128 0x1f
+	.long	.LASF53
+	.uleb128 0x8
+	.long	0x2bc
+	.uleb128 0xb
+	.long	0xbc
+	.long	0x2d6
+	.uleb128 0xc
+	.long	0x2e
+	.byte	0x13
+	.byte	0
+	.uleb128 0x8
+	.long	0x27a
+	.uleb128 0x14
+	.long	.LASF55
+	.byte	0x10
+	.byte	0x7
+	.byte	0xa8
+	.long	0x30f
+	.uleb128 0x3
+	.long	.LASF56
+	.byte	0x7
+	.byte	0xa9
+	.byte	0xe
+	.long	0x64
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF57
+	.byte	0x7
+	.byte	0xaa
+	.byte	0xe
+	.long	0x64
+	.byte	0x4
+	.uleb128 0x3
+	.long	.LASF58
+	.byte	0x7
+	.byte	0xab
+	.byte	0xc
+	.long	0x35
+	.byte	0x8
+	.byte	0
+	.uleb128 0x15
+	.long	0x2db
+	.uleb128 0x33
+	.long	.LASF256
+	.byte	0x80
+	.byte	0x10
+	.byte	0x7
+	.byte	0xf7
+	.byte	0x8
+	.long	0x378
+	.uleb128 0xe
+	.string	"H"
+	.byte	0x7
+	.byte	0xf8
+	.byte	0xe
+	.long	0x378
+	.byte	0
+	.uleb128 0xe
+	.string	"buf"
+	.byte	0x7
+	.byte	0xf9
+	.byte	0x13
+	.long	0x388
+	.byte	0x20
+	.uleb128 0xe
+	.string	"t"
+	.byte	0x7
+	.byte	0xfa
+	.byte	0xe
+	.long	0x398
+	.byte	0x60
+	.uleb128 0xe
+	.string	"f"
+	.byte	0x7
+	.byte	0xfb
+	.byte	0xe
+	.long	0x398
+	.byte	0x68
+	.uleb128 0x3
+	.long	.LASF59
+	.byte	0x7
+	.byte	0xfc
+	.byte	0xe
+	.long	0x64
+	.byte	0x70
+	.uleb128 0x3
+	.long	.LASF60
+	.byte	0x7
+	.byte	0xfd
+	.byte	0xe
+	.long	0x64
+	.byte	0x74
+	.uleb128 0x3
+	.long	.LASF61
+	.byte	0x7
+	.byte	0xfe
+	.byte	0xe
+	.long	0x64
+	.byte	0x78
+	.byte	0
+	.uleb128 0xb
+	.long	0xdc
+	.long	0x388
+	.uleb128 0xc
+	.long	0x2e
+	.byte	0x7
+	.byte	0
+	.uleb128 0xb
+	.long	0x56
+	.long	0x398
+	.uleb128 0xc
+	.long	0x2e
+	.byte	0x3f
+	.byte	0
+	.uleb128 0xb
+	.long	0xdc
+	.long	0x3a8
+	.uleb128 0xc
+	.long	0x2e
+	.byte	0x1
+	.byte	0
+	.uleb128 0x8
+	.long	0x314
+	.uleb128 0x8
+	.long	0x56
+	.uleb128 0x26
+	.string	"u8"
+	.byte	0x7
+	.byte	0x11
+	.long	0xd0
+	.uleb128 0x15
+	.long	0x3b2
+	.uleb128 0x26
+	.string	"u32"
+	.byte	0x8
+	.byte	0x12
+	.long	0xdc
+	.uleb128 0x15
+	.long	0x3c1
+	.uleb128 0xb
+	.long	0x3cc
+	.long	0x3e1
+	.uleb128 0xc
+	.long	0x2e
+	.byte	0x7
+	.byte	0
+	.uleb128 0x15
+	.long	0x3d1
+	.uleb128 0x27
+	.long	.LASF62
+	.byte	0xa
+	.byte	0x12
+	.long	0x3e1
+	.byte	0x20
+	.byte	0x67
+	.byte	0xe6
+	.byte	0x9
+	.byte	0x6a
+	.byte	0x85
+	.byte	0xae
+	.byte	0x67
+	.byte	0xbb
+	.byte	0x72
+	.byte	0xf3
+	.byte	0x6e
+	.byte	0x3c
+	.byte	0x3a
+	.byte	0xf5
+	.byte	0x4f
+	.byte	0xa5
+	.byte	0x7f
+	.byte	0x52
+	.byte	0xe
+	.byte	0x51
+	.byte	0x8c
+	.byte	0x68
+	.byte	0x5
+	.byte	0x9b
+	.byte	0xab
+	.byte	0xd9
+	.byte	0x83
+	.byte	0x1f
+	.byte	0x19
+	.byte	0xcd
+	.byte	0xe0
+	.byte	0x5b
+	.uleb128 0xb
+	.long	0x3bc
+	.long	0x428
+	.uleb128 0xc
+	.long	0x2e
+	.byte	0x9
+	.uleb128 0xc
+	.long	0x2e
+	.byte	0xf
+	.byte	0
+	.uleb128 0x15
+	.long	0x412
+	.uleb128 0x27
+	.long	.LASF63
+	.byte	0xf
+	.byte	0x11
+	.long	0x428
+	.byte	0xa0
+	.byte	0
+	.byte	0x1
+	.byte	0x2
+	.byte	0x3
+	.byte	0x4
+	.byte	0x5
+	.byte	0x6
+	.byte	0x7
+	.byte	0x8
+	.byte	0x9
+	.byte	0xa
+	.byte	0xb
+	.byte	0xc
+	.byte	0xd
+	.byte	0xe
+	.byte	0xf
+	.byte	0xe
+	.byte	0xa
+	.byte	0x4
+	.byte	0x8
+	.byte	0x9
+	.byte	0xf
+	.byte	0xd
+	.byte	0x6
+	.byte	0x1
+	.byte	0xc
+	.byte	0
+	.byte	0x2
+	.byte	0xb
+	.byte	0x7
+	.byte	0x5
+	.byte	0x3
+	.byte	0xb
+	.byte	0x8
+	.byte	0xc
+	.byte	0
+	.byte	0x5
+	.byte	0x2
+	.byte	0xf
+	.byte	0xd
+	.byte	0xa
+	.byte	0xe
+	.byte	0x3
+	.byte	0x6
+	.byte	0x7
+	.byte	0x1
+	.byte	0x9
+	.byte	0x4
+	.byte	0x7
+	.byte	0x9
+	.byte	0x3
+	.byte	0x1
+	.byte	0xd
+	.byte	0xc
+	.byte	0xb
+	.byte	0xe
+	.byte	0x2
+	.byte	0x6
+	.byte	0x5
+	.byte	0xa
+	.byte	0x4
+	.byte	0
+	.byte	0xf
+	.byte	0x8
+	.byte	0x9
+	.byte	0
+	.byte	0x5
+	.byte	0x7
+	.byte	0x2
+	.byte	0x4
+	.byte	0xa
+	.byte	0xf
+	.byte	0xe
+	.byte	0x1
+	.byte	0xb
+	.byte	0xc
+	.byte	0x6
+	.byte	0x8
+	.byte	0x3
+	.byte	0xd
+	.byte	0x2
+	.byte	0xc
+	.byte	0x6
+	.byte	0xa
+	.byte	0
+	.byte	0xb
+	.byte	0x8
+	.byte	0x3
+	.byte	0x4
+	.byte	0xd
+	.byte	0x7
+	.byte	0x5
+	.byte	0xf
+	.byte	0xe
+	.byte	0x1
+	.byte	0x9
+	.byte	0xc
+	.byte	0x5
+	.byte	0x1
+	.byte	0xf
+	.byte	0xe
+	.byte	0xd
+	.byte	0x4
+	.byte	0xa
+	.byte	0
+	.byte	0x7
+	.byte	0x6
+	.byte	0x3
+	.byte	0x9
+	.byte	0x2
+	.byte	0x8
+	.byte	0xb
+	.byte	0xd
+	.byte	0xb
+	.byte	0x7
+	.byte	0xe
+	.byte	0xc
+	.byte	0x1
+	.byte	0x3
+	.byte	0x9
+	.byte	0x5
+	.byte	0
+	.byte	0xf
+	.byte	0x4
+	.byte	0x8
+	.byte	0x6
+	.byte	0x2
+	.byte	0xa
+	.byte	0x6
+	.byte	0xf
+	.byte	0xe
+	.byte	0x9
+	.byte	0xb
+	.byte	0x3
+	.byte	0
+	.byte	0x8
+	.byte	0xc
+	.byte	0x2
+	.byte	0xd
+	.byte	0x7
+	.byte	0x1
+	.byte	0x4
+	.byte	0xa
+	.byte	0x5
+	.byte	0xa
+	.byte	0x2
+	.byte	0x8
+	.byte	0x4
+	.byte	0x7
+	.byte	0x6
+	.byte	0x1
+	.byte	0x5
+	.byte	0xf
+	.byte	0xb
+	.byte	0x9
+	.byte	0xe
+	.byte	0x3
+	.byte	0xc
+	.byte	0xd
+	.byte	0
+	.uleb128 0xa
+	.long	.LASF64
+	.byte	0x9
+	.byte	0x15
+	.byte	0x17
+	.long	0x56
+	.uleb128 0xa
+	.long	.LASF65
+	.byte	0x9
+	.byte	0x18
+	.byte	0x18
+	.long	0x5d
+	.uleb128 0xa
+	.long	.LASF66
+	.byte	0x9
+	.byte	0x1a
+	.byte	0x18
+	.long	0x41
+	.uleb128 0xa
+	.long	.LASF67
+	.byte	0x9
+	.byte	0x1b
+	.byte	0x16
+	.long	0x64
+	.uleb128 0xa
+	.long	.LASF68
+	.byte	0x9
+	.byte	0x1f
+	.byte	0x2a
+	.long	0xc3
+	.uleb128 0x20
+	.byte	0x8
+	.byte	0x1e
+	.long	0x537
+	.uleb128 0x3
+	.long	.LASF69
+	.byte	0xa
+	.byte	0x1f
+	.byte	0xa
+	.long	0x4fd
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF70
+	.byte	0xa
+	.byte	0x20
+	.byte	0xa
+	.long	0x4fd
+	.byte	0x4
+	.byte	0
+	.uleb128 0x16
+	.byte	0x8
+	.byte	0x1b
+	.long	0x559
+	.uleb128 0x28
+	.string	"off"
+	.byte	0x1c
+	.byte	0x9
+	.long	0x509
+	.uleb128 0x6
+	.long	.LASF71
+	.byte	0x1d
+	.long	0x509
+	.uleb128 0x21
+	.long	0x515
+	.byte	0
+	.uleb128 0x16
+	.byte	0x8
+	.byte	0x23
+	.long	0x575
+	.uleb128 0x6
+	.long	.LASF72
+	.byte	0x24
+	.long	0x509
+	.uleb128 0x6
+	.long	.LASF73
+	.byte	0x25
+	.long	0x509
+	.byte	0
+	.uleb128 0x16
+	.byte	0x4
+	.byte	0x28
+	.long	0x63b
+	.uleb128 0x6
+	.long	.LASF74
+	.byte	0x29
+	.long	0x4fd
+	.uleb128 0x6
+	.long	.LASF75
+	.byte	0x2a
+	.long	0x4fd
+	.uleb128 0x6
+	.long	.LASF76
+	.byte	0x2b
+	.long	0x4e5
+	.uleb128 0x6
+	.long	.LASF77
+	.byte	0x2c
+	.long	0x4fd
+	.uleb128 0x6
+	.long	.LASF78
+	.byte	0x2d
+	.long	0x4fd
+	.uleb128 0x6
+	.long	.LASF79
+	.byte	0x2e
+	.long	0x4fd
+	.uleb128 0x6
+	.long	.LASF80
+	.byte	0x2f
+	.long	0x4fd
+	.uleb128 0x6
+	.long	.LASF81
+	.byte	0x30
+	.long	0x4fd
+	.uleb128 0x6
+	.long	.LASF82
+	.byte	0x31
+	.long	0x4fd
+	.uleb128 0x6
+	.long	.LASF83
+	.byte	0x32
+	.long	0x4fd
+	.uleb128 0x6
+	.long	.LASF84
+	.byte	0x33
+	.long	0x4fd
+	.uleb128 0x6
+	.long	.LASF85
+	.byte	0x34
+	.long	0x4fd
+	.uleb128 0x6
+	.long	.LASF86
+	.byte	0x35
+	.long	0x4fd
+	.uleb128 0x6
+	.long	.LASF87
+	.byte	0x36
+	.long	0x4fd
+	.uleb128 0x6
+	.long	.LASF88
+	.byte	0x37
+	.long	0x4fd
+	.uleb128 0x6
+	.long	.LASF89
+	.byte	0x38
+	.long	0x4fd
+	.uleb128 0x6
+	.long	.LASF90
+	.byte	0x39
+	.long	0x4fd
+	.uleb128 0x6
+	.long	.LASF91
+	.byte	0x3a
+	.long	0x4fd
+	.uleb128 0x6
+	.long	.LASF92
+	.byte	0x3b
+	.long	0x4fd
+	.byte	0
+	.uleb128 0x16
+	.byte	0x2
+	.byte	0x3f
+	.long	0x657
+	.uleb128 0x6
+	.long	.LASF93
+	.byte	0x41
+	.long	0x4e5
+	.uleb128 0x6
+	.long	.LASF94
+	.byte	0x43
+	.long	0x4e5
+	.byte	0
+	.uleb128 0x20
+	.byte	0x4
+	.byte	0x4a
+	.long	0x679
+	.uleb128 0x3
+	.long	.LASF95
+	.byte	0xa
+	.byte	0x4b
+	.byte	0xa
+	.long	0x4e5
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF96
+	.byte	0xa
+	.byte	0x4c
+	.byte	0xa
+	.long	0x679
+	.byte	0x2
+	.byte	0
+	.uleb128 0xb
+	.long	0x4e5
+	.long	0x689
+	.uleb128 0xc
+	.long	0x2e
+	.byte	0
+	.byte	0
+	.uleb128 0x16
+	.byte	0x4
+	.byte	0x47
+	.long	0x6aa
+	.uleb128 0x6
+	.long	.LASF97
+	.byte	0x48
+	.long	0x4f1
+	.uleb128 0x6
+	.long	.LASF98
+	.byte	0x49
+	.long	0x4fd
+	.uleb128 0x21
+	.long	0x657
+	.byte	0
+	.uleb128 0x20
+	.byte	0x10
+	.byte	0x50
+	.long	0x6cc
+	.uleb128 0x3
+	.long	.LASF99
+	.byte	0xa
+	.byte	0x51
+	.byte	0xa
+	.long	0x509
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF100
+	.byte	0xa
+	.byte	0x52
+	.byte	0xa
+	.long	0x6cc
+	.byte	0x8
+	.byte	0
+	.uleb128 0xb
+	.long	0x509
+	.long	0x6dc
+	.uleb128 0xc
+	.long	0x2e
+	.byte	0
+	.byte	0
+	.uleb128 0x16
+	.byte	0x10
+	.byte	0x4f
+	.long	0x6f4
+	.uleb128 0x21
+	.long	0x6aa
+	.uleb128 0x28
+	.string	"cmd"
+	.byte	0x58
+	.byte	0x8
+	.long	0x6f4
+	.byte	0
+	.uleb128 0xb
+	.long	0x4d9
+	.long	0x704
+	.uleb128 0x34
+	.long	0x2e
+	.byte	0
+	.byte	0
+	.uleb128 0x14
+	.long	.LASF101
+	.byte	0x40
+	.byte	0xa
+	.byte	0x16
+	.long	0x78f
+	.uleb128 0x3
+	.long	.LASF102
+	.byte	0xa
+	.byte	0x17
+	.byte	0x7
+	.long	0x4d9
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF57
+	.byte	0xa
+	.byte	0x18
+	.byte	0x7
+	.long	0x4d9
+	.byte	0x1
+	.uleb128 0x3
+	.long	.LASF103
+	.byte	0xa
+	.byte	0x19
+	.byte	0x8
+	.long	0x4e5
+	.byte	0x2
+	.uleb128 0xe
+	.string	"fd"
+	.byte	0xa
+	.byte	0x1a
+	.byte	0x8
+	.long	0x4f1
+	.byte	0x4
+	.uleb128 0x17
+	.long	0x537
+	.byte	0x8
+	.uleb128 0x17
+	.long	0x559
+	.byte	0x10
+	.uleb128 0xe
+	.string	"len"
+	.byte	0xa
+	.byte	0x27
+	.byte	0x8
+	.long	0x4fd
+	.byte	0x18
+	.uleb128 0x17
+	.long	0x575
+	.byte	0x1c
+	.uleb128 0x3
+	.long	.LASF104
+	.byte	0xa
+	.byte	0x3d
+	.byte	0x8
+	.long	0x509
+	.byte	0x20
+	.uleb128 0x17
+	.long	0x63b
+	.byte	0x28
+	.uleb128 0x3
+	.long	.LASF105
+	.byte	0xa
+	.byte	0x46
+	.byte	0x8
+	.long	0x4e5
+	.byte	0x2a
+	.uleb128 0x17
+	.long	0x689
+	.byte	0x2c
+	.uleb128 0x17
+	.long	0x6dc
+	.byte	0x30
+	.byte	0
+	.uleb128 0x35
+	.long	.LASF257
+	.byte	0x7
+	.byte	0x4
+	.long	0x64
+	.byte	0xa
+	.byte	0xa8
+	.byte	0x6
+	.long	0x8ce
+	.uleb128 0x2
+	.long	.LASF106
+	.byte	0
+	.uleb128 0x2
+	.long	.LASF107
+	.byte	0x1
+	.uleb128 0x2
+	.long	.LASF108
+	.byte	0x2
+	.uleb128 0x2
+	.long	.LASF109
+	.byte	0x3
+	.uleb128 0x2
+	.long	.LASF110
+	.byte	0x4
+	.uleb128 0x2
+	.long	.LASF111
+	.byte	0x5
+	.uleb128 0x2
+	.long	.LASF112
+	.byte	0x6
+	.uleb128 0x2
+	.long	.LASF113
+	.byte	0x7
+	.uleb128 0x2
+	.long	.LASF114
+	.byte	0x8
+	.uleb128 0x2
+	.long	.LASF115
+	.byte	0x9
+	.uleb128 0x2
+	.long	.LASF116
+	.byte	0xa
+	.uleb128 0x2
+	.long	.LASF117
+	.byte	0xb
+	.uleb128 0x2
+	.long	.LASF118
+	.byte	0xc
+	.uleb128 0x2
+	.long	.LASF119
+	.byte	0xd
+	.uleb128 0x2
+	.long	.LASF120
+	.byte	0xe
+	.uleb128 0x2
+	.long	.LASF121
+	.byte	0xf
+	.uleb128 0x2
+	.long	.LASF122
+	.byte	0x10
+	.uleb128 0x2
+	.long	.LASF123
+	.byte	0x11
+	.uleb128 0x2
+	.long	.LASF124
+	.byte	0x12
+	.uleb128 0x2
+	.long	.LASF125
+	.byte	0x13
+	.uleb128 0x2
+	.long	.LASF126
+	.byte	0x14
+	.uleb128 0x2
+	.long	.LASF127
+	.byte	0x15
+	.uleb128 0x2
+	.long	.LASF128
+	.byte	0x16
+	.uleb128 0x2
+	.long	.LASF129
+	.byte	0x17
+	.uleb128 0x2
+	.long	.LASF130
+	.byte	0x18
+	.uleb128 0x2
+	.long	.LASF131
+	.byte	0x19
+	.uleb128 0x2
+	.long	.LASF132
+	.byte	0x1a
+	.uleb128 0x2
+	.long	.LASF133
+	.byte	0x1b
+	.uleb128 0x2
+	.long	.LASF134
+	.byte	0x1c
+	.uleb128 0x2
+	.long	.LASF135
+	.byte	0x1d
+	.uleb128 0x2
+	.long	.LASF136
+	.byte	0x1e
+	.uleb128 0x2
+	.long	.LASF137
+	.byte	0x1f
+	.uleb128 0x2
+	.long	.LASF138
+	.byte	0x20
+	.uleb128 0x2
+	.long	.LASF139
+	.byte	0x21
+	.uleb128 0x2
+	.long	.LASF140
+	.byte	0x22
+	.uleb128 0x2
+	.long	.LASF141
+	.byte	0x23
+	.uleb128 0x2
+	.long	.LASF142
+	.byte	0x24
+	.uleb128 0x2
+	.long	.LASF143
+	.byte	0x25
+	.uleb128 0x2
+	.long	.LASF144
+	.byte	0x26
+	.uleb128 0x2
+	.long	.LASF145
+	.byte	0x27
+	.uleb128 0x2
+	.long	.LASF146
+	.byte	0x28
+	.uleb128 0x2
+	.long	.LASF147
+	.byte	0x29
+	.uleb128 0x2
+	.long	.LASF148
+	.byte	0x2a
+	.uleb128 0x2
+	.long	.LASF149
+	.byte	0x2b
+	.uleb128 0x2
+	.long	.LASF150
+	.byte	0x2c
+	.uleb128 0x2
+	.long	.LASF151
+	.byte	0x2d
+	.uleb128 0x2
+	.long	.LASF152
+	.byte	0x2e
+	.uleb128 0x2
+	.long	.LASF153
+	.byte	0x2f
+	.uleb128 0x2
+	.long	.LASF154
+	.byte	0x30
+	.uleb128 0x2
+	.long	.LASF155
+	.byte	0x31
+	.byte	0
+	.uleb128 0x19
+	.long	.LASF156
+	.byte	0x10
+	.value	0x15a
+	.long	0x910
+	.uleb128 0x4
+	.long	.LASF104
+	.value	0x15b
+	.byte	0x8
+	.long	0x509
+	.byte	0
+	.uleb128 0x36
+	.string	"res"
+	.byte	0xa
+	.value	0x15c
+	.byte	0x8
+	.long	0x4f1
+	.byte	0x8
+	.uleb128 0x4
+	.long	.LASF57
+	.value	0x15d
+	.byte	0x8
+	.long	0x4fd
+	.byte	0xc
+	.uleb128 0x4
+	.long	.LASF157
+	.value	0x163
+	.byte	0x8
+	.long	0x910
+	.byte	0x10
+	.byte	0
+	.uleb128 0xb
+	.long	0x509
+	.long	0x91f
+	.uleb128 0x37
+	.long	0x2e
+	.byte	0
+	.uleb128 0x19
+	.long	.LASF158
+	.byte	0x28
+	.value	0x183
+	.long	0x9a1
+	.uleb128 0x4
+	.long	.LASF159
+	.value	0x184
+	.byte	0x8
+	.long	0x4fd
+	.byte	0
+	.uleb128 0x4
+	.long	.LASF160
+	.value	0x185
+	.byte	0x8
+	.long	0x4fd
+	.byte	0x4
+	.uleb128 0x4
+	.long	.LASF161
+	.value	0x186
+	.byte	0x8
+	.long	0x4fd
+	.byte	0x8
+	.uleb128 0x4
+	.long	.LASF162
+	.value	0x187
+	.byte	0x8
+	.long	0x4fd
+	.byte	0xc
+	.uleb128 0x4
+	.long	.LASF57
+	.value	0x188
+	.byte	0x8
+	.long	0x4fd
+	.byte	0x10
+	.uleb128 0x4
+	.long	.LASF163
+	.value	0x189
+	.byte	0x8
+	.long	0x4fd
+	.byte	0x14
+	.uleb128 0x4
+	.long	.LASF164
+	.value	0x18a
+	.byte	0x8
+	.long	0x4fd
+	.byte	0x18
+	.uleb128 0x4
+	.long	.LASF165
+	.value	0x18b
+	.byte	0x8
+	.long	0x4fd
+	.byte	0x1c
+	.uleb128 0x4
+	.long	.LASF166
+	.value	0x18c
+	.byte	0x8
+	.long	0x509
+	.byte	0x20
+	.byte	0
+	.uleb128 0x19
+	.long	.LASF167
+	.byte	0x28
+	.value	0x196
+	.long	0xa23
+	.uleb128 0x4
+	.long	.LASF159
+	.value	0x197
+	.byte	0x8
+	.long	0x4fd
+	.byte	0
+	.uleb128 0x4
+	.long	.LASF160
+	.value	0x198
+	.byte	0x8
+	.long	0x4fd
+	.byte	0x4
+	.uleb128 0x4
+	.long	.LASF161
+	.value	0x199
+	.byte	0x8
+	.long	0x4fd
+	.byte	0x8
+	.uleb128 0x4
+	.long	.LASF162
+	.value	0x19a
+	.byte	0x8
+	.long	0x4fd
+	.byte	0xc
+	.uleb128 0x4
+	.long	.LASF168
+	.value	0x19b
+	.byte	0x8
+	.long	0x4fd
+	.byte	0x10
+	.uleb128 0x4
+	.long	.LASF169
+	.value	0x19c
+	.byte	0x8
+	.long	0x4fd
+	.byte	0x14
+	.uleb128 0x4
+	.long	.LASF57
+	.value	0x19d
+	.byte	0x8
+	.long	0x4fd
+	.byte	0x18
+	.uleb128 0x4
+	.long	.LASF165
+	.value	0x19e
+	.byte	0x8
+	.long	0x4fd
+	.byte	0x1c
+	.uleb128 0x4
+	.long	.LASF166
+	.value	0x19f
+	.byte	0x8
+	.long	0x509
+	.byte	0x20
+	.byte	0
+	.uleb128 0x19
+	.long	.LASF170
+	.byte	0x78
+	.value	0x1b5
+	.long	0xab2
+	.uleb128 0x4
+	.long	.LASF171
+	.value	0x1b6
+	.byte	0x8
+	.long	0x4fd
+	.byte	0
+	.uleb128 0x4
+	.long	.LASF172
+	.value	0x1b7
+	.byte	0x8
+	.long	0x4fd
+	.byte	0x4
+	.uleb128 0x4
+	.long	.LASF57
+	.value	0x1b8
+	.byte	0x8
+	.long	0x4fd
+	.byte	0x8
+	.uleb128 0x4
+	.long	.LASF173
+	.value	0x1b9
+	.byte	0x8
+	.long	0x4fd
+	.byte	0xc
+	.uleb128 0x4
+	.long	.LASF174
+	.value	0x1ba
+	.byte	0x8
+	.long	0x4fd
+	.byte	0x10
+	.uleb128 0x4
+	.long	.LASF175
+	.value	0x1bb
+	.byte	0x8
+	.long	0x4fd
+	.byte	0x14
+	.uleb128 0x4
+	.long	.LASF176
+	.value	0x1bc
+	.byte	0x8
+	.long	0x4fd
+	.byte	0x18
+	.uleb128 0x4
+	.long	.LASF177
+	.value	0x1bd
+	.byte	0x8
+	.long	0xab2
+	.byte	0x1c
+	.uleb128 0x4
+	.long	.LASF178
+	.value	0x1be
+	.byte	0x1b
+	.long	0x91f
+	.byte	0x28
+	.uleb128 0x4
+	.long	.LASF179
+	.value	0x1bf
+	.byte	0x1b
+	.long	0x9a1
+	.byte	0x50
+	.byte	0
+	.uleb128 0xb
+	.long	0x4fd
+	.long	0xac2
+	.uleb128 0xc
+	.long	0x2e
+	.byte	0x2
+	.byte	0
+	.uleb128 0x38
+	.byte	0x7
+	.byte	0x4
+	.long	0x64
+	.byte	0xa
+	.value	0x1d6
+	.byte	0x6
+	.long	0xb74
+	.uleb128 0x2
+	.long	.LASF180
+	.byte	0
+	.uleb128 0x2
+	.long	.LASF181
+	.byte	0x1
+	.uleb128 0x2
+	.long	.LASF182
+	.byte	0x2
+	.uleb128 0x2
+	.long	.LASF183
+	.byte	0x3
+	.uleb128 0x2
+	.long	.LASF184
+	.byte	0x4
+	.uleb128 0x2
+	.long	.LASF185
+	.byte	0x5
+	.uleb128 0x2
+	.long	.LASF186
+	.byte	0x6
+	.uleb128 0x2
+	.long	.LASF187
+	.byte	0x7
+	.uleb128 0x2
+	.long	.LASF188
+	.byte	0x8
+	.uleb128 0x2
+	.long	.LASF189
+	.byte	0x9
+	.uleb128 0x2
+	.long	.LASF190
+	.byte	0xa
+	.uleb128 0x2
+	.long	.LASF191
+	.byte	0xb
+	.uleb128 0x2
+	.long	.LASF192
+	.byte	0xc
+	.uleb128 0x2
+	.long	.LASF193
+	.byte	0xd
+	.uleb128 0x2
+	.long	.LASF194
+	.byte	0xe
+	.uleb128 0x2
+	.long	.LASF195
+	.byte	0xf
+	.uleb128 0x2
+	.long	.LASF196
+	.byte	0x10
+	.uleb128 0x2
+	.long	.LASF197
+	.byte	0x11
+	.uleb128 0x2
+	.long	.LASF198
+	.byte	0x12
+	.uleb128 0x2
+	.long	.LASF199
+	.byte	0x13
+	.uleb128 0x2
+	.long	.LASF200
+	.byte	0x14
+	.uleb128 0x2
+	.long	.LASF201
+	.byte	0x15
+	.uleb128 0x2
+	.long	.LASF202
+	.byte	0x16
+	.uleb128 0x2
+	.long	.LASF203
+	.byte	0x17
+	.uleb128 0x2
+	.long	.LASF204
+	.byte	0x18
+	.uleb128 0x2
+	.long	.LASF205
+	.byte	0x19
+	.uleb128 0x2
+	.long	.LASF206
+	.byte	0x1a
+	.byte	0
+	.uleb128 0x14
+	.long	.LASF207
+	.byte	0x10
+	.byte	0xb
+	.byte	0x1a
+	.long	0xb9b
+	.uleb128 0x3
+	.long	.LASF208
+	.byte	0xb
+	.byte	0x1c
+	.byte	0xb
+	.long	0xb5
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF209
+	.byte	0xb
+	.byte	0x1d
+	.byte	0xc
+	.long	0x35
+	.byte	0x8
+	.byte	0
+	.uleb128 0x14
+	.long	.LASF210
+	.byte	0x78
+	.byte	0x1
+	.byte	0x22
+	.long	0xc77
+	.uleb128 0xe
+	.string	"fd"
+	.byte	0x1
+	.byte	0x23
+	.byte	0x9
+	.long	0x41
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF211
+	.byte	0x1
+	.byte	0x24
+	.byte	0xf
+	.long	0xc77
+	.byte	0x8
+	.uleb128 0x3
+	.long	.LASF212
+	.byte	0x1
+	.byte	0x24
+	.byte	0x19
+	.long	0xc77
+	.byte	0x10
+	.uleb128 0x3
+	.long	.LASF213
+	.byte	0x1
+	.byte	0x24
+	.byte	0x23
+	.long	0xc77
+	.byte	0x18
+	.uleb128 0x3
+	.long	.LASF214
+	.byte	0x1
+	.byte	0x25
+	.byte	0xf
+	.long	0xc77
+	.byte	0x20
+	.uleb128 0x3
+	.long	.LASF215
+	.byte	0x1
+	.byte	0x25
+	.byte	0x19
+	.long	0xc77
+	.byte	0x28
+	.uleb128 0x3
+	.long	.LASF216
+	.byte	0x1
+	.byte	0x25
+	.byte	0x23
+	.long	0xc77
+	.byte	0x30
+	.uleb128 0x3
+	.long	.LASF217
+	.byte	0x1
+	.byte	0x26
+	.byte	0x1a
+	.long	0xc7c
+	.byte	0x38
+	.uleb128 0x3
+	.long	.LASF169
+	.byte	0x1
+	.byte	0x27
+	.byte	0x1a
+	.long	0xc81
+	.byte	0x40
+	.uleb128 0x3
+	.long	.LASF218
+	.byte	0x1
+	.byte	0x28
+	.byte	0xb
+	.long	0xb5
+	.byte	0x48
+	.uleb128 0x3
+	.long	.LASF219
+	.byte	0x1
+	.byte	0x28
+	.byte	0x14
+	.long	0xb5
+	.byte	0x50
+	.uleb128 0x3
+	.long	.LASF220
+	.byte	0x1
+	.byte	0x29
+	.byte	0xc
+	.long	0x35
+	.byte	0x58
+	.uleb128 0x3
+	.long	.LASF221
+	.byte	0x1
+	.byte	0x29
+	.byte	0x14
+	.long	0x35
+	.byte	0x60
+	.uleb128 0x3
+	.long	.LASF222
+	.byte	0x1
+	.byte	0x29
+	.byte	0x1c
+	.long	0x35
+	.byte	0x68
+	.uleb128 0x3
+	.long	.LASF223
+	.byte	0x1
+	.byte	0x2a
+	.byte	0xe
+	.long	0x64
+	.byte	0x70
+	.uleb128 0x3
+	.long	.LASF224
+	.byte	0x1
+	.byte	0x2b
+	.byte	0x9
+	.long	0x41
+	.byte	0x74
+	.byte	0
+	.uleb128 0x8
+	.long	0x64
+	.uleb128 0x8
+	.long	0x704
+	.uleb128 0x8
+	.long	0x8ce
+	.uleb128 0x14
+	.long	.LASF225
+	.byte	0x18
+	.byte	0x1
+	.byte	0x2e
+	.long	0xcba
+	.uleb128 0xe
+	.string	"off"
+	.byte	0x1
+	.byte	0x2f
+	.byte	0xe
+	.long	0xe8
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF226
+	.byte	0x1
+	.byte	0x30
+	.byte	0xc
+	.long	0x35
+	.byte	0x8
+	.uleb128 0xe
+	.string	"got"
+	.byte	0x1
+	.byte	0x30
+	.byte	0x12
+	.long	0x35
+	.byte	0x10
+	.byte	0
+	.uleb128 0x15
+	.long	0xc86
+	.uleb128 0x1a
+	.long	.LASF227
+	.byte	0x7
+	.byte	0xb3
+	.byte	0x6
+	.long	0x41
+	.long	0xcdf
+	.uleb128 0x7
+	.long	0x3ad
+	.uleb128 0x7
+	.long	0x2d6
+	.uleb128 0x7
+	.long	0xcdf
+	.byte	0
+	.uleb128 0x8
+	.long	0x30f
+	.uleb128 0x22
+	.long	.LASF228
+	.byte	0xc
+	.value	0x166
+	.byte	0xc
+	.long	0x41
+	.long	0xcfb
+	.uleb128 0x7
+	.long	0x41
+	.byte	0
+	.uleb128 0x1a
+	.long	.LASF229
+	.byte	0xd
+	.byte	0x4c
+	.byte	0xc
+	.long	0x41
+	.long	0xd16
+	.uleb128 0x7
+	.long	0xb5
+	.uleb128 0x7
+	.long	0x35
+	.byte	0
+	.uleb128 0x1a
+	.long	.LASF230
+	.byte	0xd
+	.byte	0x39
+	.byte	0xe
+	.long	0xb5
+	.long	0xd45
+	.uleb128 0x7
+	.long	0xb5
+	.uleb128 0x7
+	.long	0x35
+	.uleb128 0x7
+	.long	0x41
+	.uleb128 0x7
+	.long	0x41
+	.uleb128 0x7
+	.long	0x41
+	.uleb128 0x7
+	.long	0x9d
+	.byte	0
+	.uleb128 0x1a
+	.long	.LASF231
+	.byte	0xe
+	.byte	0x3d
+	.byte	0xe
+	.long	0xb5
+	.long	0xd65
+	.uleb128 0x7
+	.long	0xb5
+	.uleb128 0x7
+	.long	0x41
+	.uleb128 0x7
+	.long	0x35
+	.byte	0
+	.uleb128 0x39
+	.long	.LASF232
+	.byte	0xf
+	.value	0x238
+	.byte	0xd
+	.long	0xd78
+	.uleb128 0x7
+	.long	0xb5
+	.byte	0
+	.uleb128 0x3a
+	.long	.LASF233
+	.byte	0x7
+	.byte	0x46
+	.byte	0x6
+	.long	0xd94
+	.uleb128 0x7
+	.long	0x3a8
+	.uleb128 0x7
+	.long	0xca
+	.uleb128 0x7
+	.long	0x35
+	.byte	0
+	.uleb128 0x22
+	.long	.LASF234
+	.byte	0xc
+	.value	0x443
+	.byte	0x11
+	.long	0x48
+	.long	0xdac
+	.uleb128 0x7
+	.long	0x48
+	.uleb128 0x3b
+	.byte	0
+	.uleb128 0x3c
+	.long	.LASF258
+	.byte	0x10
+	.byte	0x25
+	.byte	0xd
+	.long	0xdb8
+	.uleb128 0x8
+	.long	0x41
+	.uleb128 0x22
+	.long	.LASF235
+	.byte	0xf
+	.value	0x257
+	.byte	0xc
+	.long	0x41
+	.long	0xdde
+	.uleb128 0x7
+	.long	0xdde
+	.uleb128 0x7
+	.long	0x35
+	.uleb128 0x7
+	.long	0x35
+	.byte	0
+	.uleb128 0x8
+	.long	0xb5
+	.uleb128 0x3d
+	.long	.LASF237
+	.byte	0x1
+	.value	0x122
+	.byte	0x5
+	.long	0x41
+	.quad	.LFB39
+	.quad	.LFE39-.LFB39
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0xe62
+	.uleb128 0x3e
+	.string	"out"
+	.byte	0x1
+	.value	0x122
+	.byte	0x27
+	.long	0x3ad
+	.long	.LLST60
+	.long	.LVUS60
+	.uleb128 0x3f
+	.long	.LASF236
+	.byte	0x1
+	.value	0x122
+	.byte	0x32
+	.long	0x2d6
+	.long	.LLST61
+	.long	.LVUS61
+	.uleb128 0x40
+	.string	"io"
+	.byte	0x1
+	.value	0x124
+	.byte	0x17
+	.long	0x2db
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -32
+	.uleb128 0x13
+	.quad	.LVL149
+	.long	0xcbf
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x3
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x3
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x51
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -32
+	.byte	0
+	.byte	0
+	.uleb128 0x41
+	.long	.LASF238
+	.byte	0x1
+	.byte	0xa9
+	.byte	0x5
+	.long	0x41
+	.quad	.LFB38
+	.quad	.LFE38-.LFB38
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0x17c6
+	.uleb128 0x18
+	.string	"ctx"
+	.byte	0xa9
+	.byte	0x2b
+	.long	0x3a8
+	.long	.LLST8
+	.long	.LVUS8
+	.uleb128 0x18
+	.string	"fd"
+	.byte	0xa9
+	.byte	0x34
+	.long	0x41
+	.long	.LLST9
+	.long	.LVUS9
+	.uleb128 0x18
+	.string	"off"
+	.byte	0xa9
+	.byte	0x41
+	.long	0xe8
+	.long	.LLST10
+	.long	.LVUS10
+	.uleb128 0x1b
+	.long	.LASF239
+	.byte	0xaa
+	.byte	0x20
+	.long	0xe8
+	.long	.LLST11
+	.long	.LVUS11
+	.uleb128 0x1b
+	.long	.LASF58
+	.byte	0xaa
+	.byte	0x2d
+	.long	0x35
+	.long	.LLST12
+	.long	.LVUS12
+	.uleb128 0x1b
+	.long	.LASF224
+	.byte	0xaa
+	.byte	0x38
+	.long	0x41
+	.long	.LLST13
+	.long	.LVUS13
+	.uleb128 0x1c
+	.string	"R"
+	.byte	0xac
+	.byte	0x12
+	.long	0xb9b
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -512
+	.uleb128 0x42
+	.long	.LASF240
+	.byte	0x1
+	.byte	0xad
+	.byte	0x17
+	.long	0x17c6
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -256
+	.uleb128 0x1c
+	.string	"iov"
+	.byte	0xae
+	.byte	0x12
+	.long	0x17d6
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -384
+	.uleb128 0x1c
+	.string	"buf"
+	.byte	0xaf
+	.byte	0x14
+	.long	0x3ad
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -536
+	.uleb128 0x10
+	.long	.LASF241
+	.byte	0xb0
+	.byte	0xc
+	.long	0x35
+	.long	.LLST14
+	.long	.LVUS14
+	.uleb128 0x10
+	.long	.LASF242
+	.byte	0xb1
+	.byte	0xc
+	.long	0x35
+	.long	.LLST15
+	.long	.LVUS15
+	.uleb128 0x10
+	.long	.LASF243
+	.byte	0xb1
+	.byte	0x16
+	.long	0x35
+	.long	.LLST16
+	.long	.LVUS16
+	.uleb128 0x10
+	.long	.LASF244
+	.byte	0xb2
+	.byte	0xe
+	.long	0x64
+	.long	.LLST17
+	.long	.LVUS17
+	.uleb128 0x10
+	.long	.LASF245
+	.byte	0xb3
+	.byte	0xe
+	.long	0x64
+	.long	.LLST18
+	.long	.LVUS18
+	.uleb128 0x10
+	.long	.LASF246
+	.byte	0xb4
+	.byte	0x9
+	.long	0x41
+	.long	.LLST19
+	.long	.LVUS19
+	.uleb128 0xf
+	.string	"err"
+	.byte	0xb4
+	.byte	0x10
+	.long	0x41
+	.long	.LLST20
+	.long	.LVUS20
+	.uleb128 0x43
+	.quad	.LBB44
+	.quad	.LBE44-.LBB44
+	.long	0xfdc
+	.uleb128 0xf
+	.string	"i"
+	.byte	0xc2
+	.byte	0x13
+	.long	0x64
+	.long	.LLST26
+	.long	.LVUS26
+	.byte	0
+	.uleb128 0x23
+	.long	.LLRL33
+	.long	0x12cb
+	.uleb128 0x1c
+	.string	"cqe"
+	.byte	0xd2
+	.byte	0x1d
+	.long	0x8ce
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -528
+	.uleb128 0x23
+	.long	.LLRL34
+	.long	0x1073
+	.uleb128 0xf
+	.string	"k"
+	.byte	0xdd
+	.byte	0x14
+	.long	0x35
+	.long	.LLST35
+	.long	.LVUS35
+	.uleb128 0xf
+	.string	"s"
+	.byte	0xde
+	.byte	0x16
+	.long	0x64
+	.long	.LLST36
+	.long	.LVUS36
+	.uleb128 0xf
+	.string	"S"
+	.byte	0xdf
+	.byte	0x20
+	.long	0x17e6
+	.long	.LLST37
+	.long	.LVUS37
+	.uleb128 0x10
+	.long	.LASF247
+	.byte	0xe0
+	.byte	0x11
+	.long	0x41
+	.long	.LLST38
+	.long	.LVUS38
+	.uleb128 0x13
+	.quad	.LVL113
+	.long	0x1880
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x75
+	.sleb128 0
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x5
+	.byte	0x91
+	.sleb128 -656
+	.byte	0x94
+	.byte	0x4
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x51
+	.uleb128 0xe
+	.byte	0x79
+	.sleb128 0
+	.byte	0x7e
+	.sleb128 0
+	.byte	0x1d
+	.byte	0x33
+	.byte	0x1e
+	.byte	0x33
+	.byte	0x24
+	.byte	0x91
+	.sleb128 -640
+	.byte	0x6
+	.byte	0x22
+	.byte	0
+	.byte	0
+	.uleb128 0x23
+	.long	.LLRL48
+	.long	0x11ab
+	.uleb128 0xf
+	.string	"s"
+	.byte	0xff
+	.byte	0x16
+	.long	0x64
+	.long	.LLST49
+	.long	.LVUS49
+	.uleb128 0x44
+	.string	"S"
+	.byte	0x1
+	.value	0x100
+	.byte	0x20
+	.long	0x17e6
+	.long	.LLST50
+	.long	.LVUS50
+	.uleb128 0x29
+	.long	0x17eb
+	.quad	.LBI73
+	.value	.LVU398
+	.long	.LLRL51
+	.value	0x106
+	.byte	0x11
+	.long	0x10fc
+	.uleb128 0x9
+	.long	0x181d
+	.long	.LLST52
+	.long	.LVUS52
+	.uleb128 0x9
+	.long	0x1812
+	.long	.LLST53
+	.long	.LVUS53
+	.uleb128 0x9
+	.long	0x1807
+	.long	.LLST54
+	.long	.LVUS54
+	.uleb128 0x9
+	.long	0x17fe
+	.long	.LLST55
+	.long	.LVUS55
+	.uleb128 0x9
+	.long	0x17f5
+	.long	.LLST56
+	.long	.LVUS56
+	.byte	0
+	.uleb128 0x5
+	.quad	.LVL77
+	.long	0xd78
+	.long	0x1116
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x4
+	.byte	0x91
+	.sleb128 -648
+	.byte	0x6
+	.byte	0
+	.uleb128 0x5
+	.quad	.LVL81
+	.long	0x1880
+	.long	0x1155
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x75
+	.sleb128 0
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x5
+	.byte	0x91
+	.sleb128 -656
+	.byte	0x94
+	.byte	0x4
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x51
+	.uleb128 0xe
+	.byte	0x7d
+	.sleb128 0
+	.byte	0x31
+	.byte	0x24
+	.byte	0x7d
+	.sleb128 0
+	.byte	0x22
+	.byte	0x33
+	.byte	0x24
+	.byte	0x91
+	.sleb128 -640
+	.byte	0x6
+	.byte	0x22
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x58
+	.uleb128 0x2
+	.byte	0x9
+	.byte	0xff
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x59
+	.uleb128 0x2
+	.byte	0x79
+	.sleb128 0
+	.byte	0
+	.uleb128 0x5
+	.quad	.LVL101
+	.long	0xd78
+	.long	0x116f
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x4
+	.byte	0x91
+	.sleb128 -648
+	.byte	0x6
+	.byte	0
+	.uleb128 0x13
+	.quad	.LVL105
+	.long	0x1880
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x75
+	.sleb128 0
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x5
+	.byte	0x91
+	.sleb128 -656
+	.byte	0x94
+	.byte	0x4
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x51
+	.uleb128 0xe
+	.byte	0x7d
+	.sleb128 0
+	.byte	0x31
+	.byte	0x24
+	.byte	0x7d
+	.sleb128 0
+	.byte	0x22
+	.byte	0x33
+	.byte	0x24
+	.byte	0x91
+	.sleb128 -640
+	.byte	0x6
+	.byte	0x22
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x58
+	.uleb128 0x2
+	.byte	0x7d
+	.sleb128 0
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x59
+	.uleb128 0x2
+	.byte	0x79
+	.sleb128 0
+	.byte	0
+	.byte	0
+	.uleb128 0x45
+	.long	0x185d
+	.long	.LLRL39
+	.byte	0x1
+	.byte	0xd4
+	.byte	0xd
+	.long	0x1219
+	.uleb128 0x46
+	.long	0x186b
+	.uleb128 0x47
+	.long	0x1874
+	.long	.LLRL40
+	.uleb128 0x1d
+	.long	0x1875
+	.long	.LLST41
+	.long	.LVUS41
+	.uleb128 0x5
+	.quad	.LVL49
+	.long	0xd94
+	.long	0x120a
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x3
+	.byte	0xa
+	.value	0x1aa
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x2
+	.byte	0x7d
+	.sleb128 0
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x51
+	.uleb128 0x2
+	.byte	0x7e
+	.sleb128 0
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x52
+	.uleb128 0x1
+	.byte	0x31
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x58
+	.uleb128 0x1
+	.byte	0x31
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x59
+	.uleb128 0x1
+	.byte	0x30
+	.byte	0
+	.uleb128 0x11
+	.quad	.LVL50
+	.long	0xdac
+	.byte	0
+	.byte	0
+	.uleb128 0x24
+	.long	0x194f
+	.quad	.LBI61
+	.value	.LVU303
+	.long	.LLRL42
+	.byte	0xd8
+	.byte	0xd
+	.long	0x1286
+	.uleb128 0x9
+	.long	0x1959
+	.long	.LLST43
+	.long	.LVUS43
+	.uleb128 0x11
+	.quad	.LVL53
+	.long	0xcfb
+	.uleb128 0x11
+	.quad	.LVL56
+	.long	0xcfb
+	.uleb128 0x5
+	.quad	.LVL57
+	.long	0xcfb
+	.long	0x1271
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x73
+	.sleb128 0
+	.byte	0
+	.uleb128 0x13
+	.quad	.LVL58
+	.long	0xce4
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x7d
+	.sleb128 0
+	.byte	0
+	.byte	0
+	.uleb128 0x48
+	.long	0x1829
+	.quad	.LBI66
+	.value	.LVU334
+	.long	.LLRL44
+	.byte	0x1
+	.byte	0xdc
+	.byte	0x10
+	.uleb128 0x9
+	.long	0x1840
+	.long	.LLST45
+	.long	.LVUS45
+	.uleb128 0x9
+	.long	0x1837
+	.long	.LLST46
+	.long	.LVUS46
+	.uleb128 0x2a
+	.long	.LLRL44
+	.uleb128 0x1d
+	.long	0x184b
+	.long	.LLST47
+	.long	.LVUS47
+	.byte	0
+	.byte	0
+	.byte	0
+	.uleb128 0x24
+	.long	0x1963
+	.quad	.LBI31
+	.value	.LVU79
+	.long	.LLRL21
+	.byte	0xba
+	.byte	0x9
+	.long	0x14ea
+	.uleb128 0x9
+	.long	0x1979
+	.long	.LLST22
+	.long	.LVUS22
+	.uleb128 0x9
+	.long	0x1970
+	.long	.LLST23
+	.long	.LVUS23
+	.uleb128 0x2a
+	.long	.LLRL21
+	.uleb128 0x49
+	.long	0x1984
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -256
+	.uleb128 0x1d
+	.long	0x198d
+	.long	.LLST24
+	.long	.LVUS24
+	.uleb128 0x1d
+	.long	0x1997
+	.long	.LLST25
+	.long	.LVUS25
+	.uleb128 0x5
+	.quad	.LVL21
+	.long	0xd94
+	.long	0x134d
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x3
+	.byte	0xa
+	.value	0x1a9
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x2
+	.byte	0x73
+	.sleb128 0
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x51
+	.uleb128 0x4
+	.byte	0x91
+	.sleb128 -640
+	.byte	0x6
+	.byte	0
+	.uleb128 0x5
+	.quad	.LVL22
+	.long	0xd16
+	.long	0x1381
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x1
+	.byte	0x30
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x2
+	.byte	0x76
+	.sleb128 0
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x51
+	.uleb128 0x1
+	.byte	0x33
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x52
+	.uleb128 0x3
+	.byte	0xa
+	.value	0x8001
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x58
+	.uleb128 0x2
+	.byte	0x7e
+	.sleb128 0
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x59
+	.uleb128 0x1
+	.byte	0x30
+	.byte	0
+	.uleb128 0x5
+	.quad	.LVL23
+	.long	0xd16
+	.long	0x13b9
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x1
+	.byte	0x30
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x4
+	.byte	0x91
+	.sleb128 -576
+	.byte	0x6
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x51
+	.uleb128 0x1
+	.byte	0x33
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x52
+	.uleb128 0x3
+	.byte	0xa
+	.value	0x8001
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x58
+	.uleb128 0x2
+	.byte	0x7e
+	.sleb128 0
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x59
+	.uleb128 0x3
+	.byte	0x40
+	.byte	0x48
+	.byte	0x24
+	.byte	0
+	.uleb128 0x5
+	.quad	.LVL24
+	.long	0xd16
+	.long	0x13ef
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x1
+	.byte	0x30
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x2
+	.byte	0x7f
+	.sleb128 0
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x51
+	.uleb128 0x1
+	.byte	0x33
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x52
+	.uleb128 0x3
+	.byte	0xa
+	.value	0x8001
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x58
+	.uleb128 0x2
+	.byte	0x7e
+	.sleb128 0
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x59
+	.uleb128 0x3
+	.byte	0x40
+	.byte	0x47
+	.byte	0x24
+	.byte	0
+	.uleb128 0x5
+	.quad	.LVL25
+	.long	0xd16
+	.long	0x1427
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x1
+	.byte	0x30
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x4
+	.byte	0x91
+	.sleb128 -576
+	.byte	0x6
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x51
+	.uleb128 0x1
+	.byte	0x33
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x52
+	.uleb128 0x3
+	.byte	0xa
+	.value	0x8001
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x58
+	.uleb128 0x2
+	.byte	0x7e
+	.sleb128 0
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x59
+	.uleb128 0x3
+	.byte	0x40
+	.byte	0x48
+	.byte	0x24
+	.byte	0
+	.uleb128 0x5
+	.quad	.LVL141
+	.long	0xd16
+	.long	0x145f
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x1
+	.byte	0x30
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x4
+	.byte	0x91
+	.sleb128 -576
+	.byte	0x6
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x51
+	.uleb128 0x1
+	.byte	0x33
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x52
+	.uleb128 0x3
+	.byte	0xa
+	.value	0x8001
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x58
+	.uleb128 0x2
+	.byte	0x7e
+	.sleb128 0
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x59
+	.uleb128 0x3
+	.byte	0x40
+	.byte	0x48
+	.byte	0x24
+	.byte	0
+	.uleb128 0x5
+	.quad	.LVL142
+	.long	0xcfb
+	.long	0x1479
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x4
+	.byte	0x91
+	.sleb128 -576
+	.byte	0x6
+	.byte	0
+	.uleb128 0x5
+	.quad	.LVL143
+	.long	0xce4
+	.long	0x1494
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x5
+	.byte	0x91
+	.sleb128 -564
+	.byte	0x94
+	.byte	0x4
+	.byte	0
+	.uleb128 0x5
+	.quad	.LVL145
+	.long	0xcfb
+	.long	0x14ae
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x4
+	.byte	0x91
+	.sleb128 -576
+	.byte	0x6
+	.byte	0
+	.uleb128 0x5
+	.quad	.LVL146
+	.long	0xcfb
+	.long	0x14ce
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x4
+	.byte	0x91
+	.sleb128 -608
+	.byte	0x6
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x2
+	.byte	0x76
+	.sleb128 0
+	.byte	0
+	.uleb128 0x13
+	.quad	.LVL147
+	.long	0xcfb
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x7c
+	.sleb128 0
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x2
+	.byte	0x7f
+	.sleb128 0
+	.byte	0
+	.byte	0
+	.byte	0
+	.uleb128 0x24
+	.long	0x17eb
+	.quad	.LBI45
+	.value	.LVU258
+	.long	.LLRL27
+	.byte	0xca
+	.byte	0x9
+	.long	0x1545
+	.uleb128 0x9
+	.long	0x181d
+	.long	.LLST28
+	.long	.LVUS28
+	.uleb128 0x9
+	.long	0x1812
+	.long	.LLST29
+	.long	.LVUS29
+	.uleb128 0x9
+	.long	0x1807
+	.long	.LLST30
+	.long	.LVUS30
+	.uleb128 0x9
+	.long	0x17fe
+	.long	.LLST31
+	.long	.LVUS31
+	.uleb128 0x9
+	.long	0x17f5
+	.long	.LLST32
+	.long	.LVUS32
+	.byte	0
+	.uleb128 0x29
+	.long	0x194f
+	.quad	.LBI102
+	.value	.LVU441
+	.long	.LLRL57
+	.value	0x10e
+	.byte	0x5
+	.long	0x162c
+	.uleb128 0x9
+	.long	0x1959
+	.long	.LLST58
+	.long	.LVUS58
+	.uleb128 0x11
+	.quad	.LVL90
+	.long	0xcfb
+	.uleb128 0x5
+	.quad	.LVL94
+	.long	0xcfb
+	.long	0x1597
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x7c
+	.sleb128 0
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x2
+	.byte	0x7f
+	.sleb128 0
+	.byte	0
+	.uleb128 0x5
+	.quad	.LVL95
+	.long	0xcfb
+	.long	0x15b7
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x4
+	.byte	0x91
+	.sleb128 -608
+	.byte	0x6
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x2
+	.byte	0x76
+	.sleb128 0
+	.byte	0
+	.uleb128 0x5
+	.quad	.LVL96
+	.long	0xce4
+	.long	0x15d2
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x5
+	.byte	0x91
+	.sleb128 -564
+	.byte	0x94
+	.byte	0x4
+	.byte	0
+	.uleb128 0x5
+	.quad	.LVL136
+	.long	0xcfb
+	.long	0x15f4
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x4
+	.byte	0x91
+	.sleb128 -552
+	.byte	0x6
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x4
+	.byte	0x91
+	.sleb128 -576
+	.byte	0x6
+	.byte	0
+	.uleb128 0x5
+	.quad	.LVL137
+	.long	0xcfb
+	.long	0x1614
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x4
+	.byte	0x91
+	.sleb128 -608
+	.byte	0x6
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x2
+	.byte	0x76
+	.sleb128 0
+	.byte	0
+	.uleb128 0x13
+	.quad	.LVL138
+	.long	0xce4
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x5
+	.byte	0x91
+	.sleb128 -564
+	.byte	0x94
+	.byte	0x4
+	.byte	0
+	.byte	0
+	.uleb128 0x4a
+	.long	0x194f
+	.quad	.LBI109
+	.value	.LVU562
+	.quad	.LBB109
+	.quad	.LBE109-.LBB109
+	.byte	0x1
+	.byte	0xbe
+	.byte	0x9
+	.long	0x16d7
+	.uleb128 0x9
+	.long	0x1959
+	.long	.LLST59
+	.long	.LVUS59
+	.uleb128 0x5
+	.quad	.LVL128
+	.long	0xcfb
+	.long	0x1681
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x4
+	.byte	0x91
+	.sleb128 -624
+	.byte	0x6
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x4
+	.byte	0x91
+	.sleb128 -576
+	.byte	0x6
+	.byte	0
+	.uleb128 0x5
+	.quad	.LVL129
+	.long	0xcfb
+	.long	0x169f
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x7c
+	.sleb128 0
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x2
+	.byte	0x7f
+	.sleb128 0
+	.byte	0
+	.uleb128 0x5
+	.quad	.LVL130
+	.long	0xcfb
+	.long	0x16bf
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x4
+	.byte	0x91
+	.sleb128 -608
+	.byte	0x6
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x2
+	.byte	0x76
+	.sleb128 0
+	.byte	0
+	.uleb128 0x13
+	.quad	.LVL131
+	.long	0xce4
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x5
+	.byte	0x91
+	.sleb128 -564
+	.byte	0x94
+	.byte	0x4
+	.byte	0
+	.byte	0
+	.uleb128 0x5
+	.quad	.LVL28
+	.long	0xdbd
+	.long	0x1704
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -536
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x3
+	.byte	0xa
+	.value	0x1000
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x51
+	.uleb128 0x9
+	.byte	0x91
+	.sleb128 -600
+	.byte	0x6
+	.byte	0x91
+	.sleb128 -632
+	.byte	0x6
+	.byte	0x1e
+	.byte	0
+	.uleb128 0x5
+	.quad	.LVL38
+	.long	0xd94
+	.long	0x1737
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x3
+	.byte	0xa
+	.value	0x1ab
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x5
+	.byte	0x91
+	.sleb128 -564
+	.byte	0x94
+	.byte	0x4
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x51
+	.uleb128 0x1
+	.byte	0x30
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x52
+	.uleb128 0x2
+	.byte	0x7d
+	.sleb128 0
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x58
+	.uleb128 0x2
+	.byte	0x73
+	.sleb128 0
+	.byte	0
+	.uleb128 0x5
+	.quad	.LVL45
+	.long	0x1880
+	.long	0x1764
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x5
+	.byte	0x91
+	.sleb128 -656
+	.byte	0x94
+	.byte	0x4
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x51
+	.uleb128 0x2
+	.byte	0x73
+	.sleb128 -24
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x58
+	.uleb128 0x2
+	.byte	0x9
+	.byte	0xff
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x59
+	.uleb128 0x2
+	.byte	0x79
+	.sleb128 0
+	.byte	0
+	.uleb128 0x11
+	.quad	.LVL97
+	.long	0xd65
+	.uleb128 0x5
+	.quad	.LVL125
+	.long	0x1880
+	.long	0x179e
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x5
+	.byte	0x91
+	.sleb128 -656
+	.byte	0x94
+	.byte	0x4
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x51
+	.uleb128 0x2
+	.byte	0x7f
+	.sleb128 -24
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x58
+	.uleb128 0x2
+	.byte	0x79
+	.sleb128 0
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x59
+	.uleb128 0x2
+	.byte	0x79
+	.sleb128 0
+	.byte	0
+	.uleb128 0x11
+	.quad	.LVL132
+	.long	0xdac
+	.uleb128 0x11
+	.quad	.LVL134
+	.long	0xdac
+	.uleb128 0x11
+	.quad	.LVL139
+	.long	0xd65
+	.byte	0
+	.uleb128 0xb
+	.long	0xc86
+	.long	0x17d6
+	.uleb128 0xc
+	.long	0x2e
+	.byte	0x7
+	.byte	0
+	.uleb128 0xb
+	.long	0xb74
+	.long	0x17e6
+	.uleb128 0xc
+	.long	0x2e
+	.byte	0x7
+	.byte	0
+	.uleb128 0x8
+	.long	0xc86
+	.uleb128 0x2b
+	.long	.LASF250
+	.byte	0xa1
+	.long	0x1829
+	.uleb128 0x12
+	.string	"S"
+	.byte	0xa1
+	.byte	0x2b
+	.long	0x17e6
+	.uleb128 0x12
+	.string	"k"
+	.byte	0xa1
+	.byte	0x35
+	.long	0x35
+	.uleb128 0x12
+	.string	"off"
+	.byte	0xa1
+	.byte	0x41
+	.long	0xe8
+	.uleb128 0x25
+	.long	.LASF239
+	.byte	0xa2
+	.byte	0x21
+	.long	0xe8
+	.uleb128 0x25
+	.long	.LASF58
+	.byte	0xa2
+	.byte	0x2e
+	.long	0x35
+	.byte	0
+	.uleb128 0x2c
+	.long	.LASF248
+	.byte	0x95
+	.long	0x41
+	.long	0x1858
+	.uleb128 0x12
+	.string	"R"
+	.byte	0x95
+	.byte	0x25
+	.long	0x1858
+	.uleb128 0x12
+	.string	"cqe"
+	.byte	0x95
+	.byte	0x3d
+	.long	0xc81
+	.uleb128 0x4b
+	.long	.LASF159
+	.byte	0x1
+	.byte	0x97
+	.byte	0xe
+	.long	0x64
+	.byte	0
+	.uleb128 0x8
+	.long	0xb9b
+	.uleb128 0x2c
+	.long	.LASF249
+	.byte	0x86
+	.long	0x41
+	.long	0x1880
+	.uleb128 0x12
+	.string	"R"
+	.byte	0x86
+	.byte	0x26
+	.long	0x1858
+	.uleb128 0x4c
+	.uleb128 0x1e
+	.string	"n"
+	.byte	0x89
+	.byte	0xd
+	.long	0x41
+	.byte	0
+	.byte	0
+	.uleb128 0x4d
+	.long	.LASF259
+	.byte	0x1
+	.byte	0x70
+	.byte	0xd
+	.quad	.LFB34
+	.quad	.LFE34-.LFB34
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0x194a
+	.uleb128 0x2d
+	.string	"R"
+	.byte	0x70
+	.byte	0x26
+	.long	0x1858
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x18
+	.string	"fd"
+	.byte	0x70
+	.byte	0x2d
+	.long	0x41
+	.long	.LLST0
+	.long	.LVUS0
+	.uleb128 0x18
+	.string	"S"
+	.byte	0x70
+	.byte	0x4a
+	.long	0x194a
+	.long	.LLST1
+	.long	.LVUS1
+	.uleb128 0x18
+	.string	"buf"
+	.byte	0x71
+	.byte	0x27
+	.long	0x3ad
+	.long	.LLST2
+	.long	.LVUS2
+	.uleb128 0x1b
+	.long	.LASF246
+	.byte	0x71
+	.byte	0x30
+	.long	0x41
+	.long	.LLST3
+	.long	.LVUS3
+	.uleb128 0x2d
+	.string	"tag"
+	.byte	0x71
+	.byte	0x4a
+	.long	0xc3
+	.uleb128 0x1
+	.byte	0x59
+	.uleb128 0x10
+	.long	.LASF160
+	.byte	0x73
+	.byte	0xe
+	.long	0x64
+	.long	.LLST4
+	.long	.LVUS4
+	.uleb128 0xf
+	.string	"i"
+	.byte	0x74
+	.byte	0xe
+	.long	0x64
+	.long	.LLST5
+	.long	.LVUS5
+	.uleb128 0xf
+	.string	"sqe"
+	.byte	0x75
+	.byte	0x1a
+	.long	0xc7c
+	.long	.LLST6
+	.long	.LVUS6
+	.uleb128 0xf
+	.string	"len"
+	.byte	0x76
+	.byte	0xc
+	.long	0x35
+	.long	.LLST7
+	.long	.LVUS7
+	.byte	0
+	.uleb128 0x8
+	.long	0xcba
+	.uleb128 0x2b
+	.long	.LASF251
+	.byte	0x64
+	.long	0x1963
+	.uleb128 0x12
+	.string	"R"
+	.byte	0x64
+	.byte	0x27
+	.long	0x1858
+	.byte	0
+	.uleb128 0x4e
+	.long	.LASF252
+	.byte	0x1
+	.byte	0x33
+	.byte	0xc
+	.long	0x41
+	.byte	0x1
+	.uleb128 0x12
+	.string	"R"
+	.byte	0x33
+	.byte	0x26
+	.long	0x1858
+	.uleb128 0x25
+	.long	.LASF253
+	.byte	0x33
+	.byte	0x32
+	.long	0x64
+	.uleb128 0x1e
+	.string	"p"
+	.byte	0x35
+	.byte	0x1c
+	.long	0xa23
+	.uleb128 0x1e
+	.string	"sq"
+	.byte	0x36
+	.byte	0x14
+	.long	0x3ad
+	.uleb128 0x1e
+	.string	"cq"
+	.byte	0x36
+	.byte	0x19
+	.long	0x3ad
+	.byte	0
+	.byte	0
+	.section	.debug_abbrev,"",@progbits
+.Ldebug_abbrev0:
+	.uleb128 0x1
+	.uleb128 0x49
+	.byte	0
+	.uleb128 0x2
+	.uleb128 0x18
+	.uleb128 0x7e
+	.uleb128 0x18
+	.byte	0
+	.byte	0
+	.uleb128 0x2
+	.uleb128 0x28
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x1c
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xd
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x38
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x4
+	.uleb128 0xd
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 10
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x38
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x5
+	.uleb128 0x48
+	.byte	0x1
+	.uleb128 0x7d
+	.uleb128 0x1
+	.uleb128 0x7f
+	.uleb128 0x13
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x6
+	.uleb128 0xd
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 10
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 9
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x7
+	.uleb128 0x5
+	.byte	0
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x8
+	.uleb128 0xf
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0x21
+	.sleb128 8
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x9
+	.uleb128 0x5
+	.byte	0
+	.uleb128 0x31
+	.uleb128 0x13
+	.uleb128 0x2
+	.uleb128 0x17
+	.uleb128 0x2137
+	.uleb128 0x17
+	.byte	0
+	.byte	0
+	.uleb128 0xa
+	.uleb128 0x16
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0x1
+	.byte	0x1
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0xc
+	.uleb128 0x21
+	.byte	0
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x2f
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0xd
+	.uleb128 0x24
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x3e
+	.uleb128 0xb
+	.uleb128 0x3
+	.uleb128 0xe
+	.byte	0
+	.byte	0
+	.uleb128 0xe
+	.uleb128 0xd
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x8
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x38
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0xf
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x8
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x2
+	.uleb128 0x17
+	.uleb128 0x2137
+	.uleb128 0x17
+	.byte	0
+	.byte	0
+	.uleb128 0x10
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x2
+	.uleb128 0x17
+	.uleb128 0x2137
+	.uleb128 0x17
+	.byte	0
+	.byte	0
+	.uleb128 0x11
+	.uleb128 0x48
+	.byte	0
+	.uleb128 0x7d
+	.uleb128 0x1
+	.uleb128 0x7f
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x12
+	.uleb128 0x5
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x8
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x13
+	.uleb128 0x48
+	.byte	0x1
+	.uleb128 0x7d
+	.uleb128 0x1
+	.uleb128 0x7f
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x14
+	.uleb128 0x13
+	.byte	0x1
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 8
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x15
+	.uleb128 0x26
+	.byte	0
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x16
+	.uleb128 0x17
+	.byte	0x1
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 10
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 2
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x17
+	.uleb128 0xd
+	.byte	0
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x38
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x18
+	.uleb128 0x5
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x8
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x2
+	.uleb128 0x17
+	.uleb128 0x2137
+	.uleb128 0x17
+	.byte	0
+	.byte	0
+	.uleb128 0x19
+	.uleb128 0x13
+	.byte	0x1
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 10
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 8
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x1a
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x3c
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x1b
+	.uleb128 0x5
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x2
+	.uleb128 0x17
+	.uleb128 0x2137
+	.uleb128 0x17
+	.byte	0
+	.byte	0
+	.uleb128 0x1c
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x8
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x2
+	.uleb128 0x18
+	.byte	0
+	.byte	0
+	.uleb128 0x1d
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x31
+	.uleb128 0x13
+	.uleb128 0x2
+	.uleb128 0x17
+	.uleb128 0x2137
+	.uleb128 0x17
+	.byte	0
+	.byte	0
+	.uleb128 0x1e
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x8
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x1f
+	.uleb128 0x13
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3c
+	.uleb128 0x19
+	.byte	0
+	.byte	0
+	.uleb128 0x20
+	.uleb128 0x13
+	.byte	0x1
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 10
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 3
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x21
+	.uleb128 0xd
+	.byte	0
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x22
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x3c
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x23
+	.uleb128 0xb
+	.byte	0x1
+	.uleb128 0x55
+	.uleb128 0x17
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x24
+	.uleb128 0x1d
+	.byte	0x1
+	.uleb128 0x31
+	.uleb128 0x13
+	.uleb128 0x52
+	.uleb128 0x1
+	.uleb128 0x2138
+	.uleb128 0x5
+	.uleb128 0x55
+	.uleb128 0x17
+	.uleb128 0x58
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x59
+	.uleb128 0xb
+	.uleb128 0x57
+	.uleb128 0xb
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x25
+	.uleb128 0x5
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x26
+	.uleb128 0x16
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x8
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 8
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x27
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 8
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x1c
+	.uleb128 0xa
+	.byte	0
+	.byte	0
+	.uleb128 0x28
+	.uleb128 0xd
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x8
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 10
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x29
+	.uleb128 0x1d
+	.byte	0x1
+	.uleb128 0x31
+	.uleb128 0x13
+	.uleb128 0x52
+	.uleb128 0x1
+	.uleb128 0x2138
+	.uleb128 0x5
+	.uleb128 0x55
+	.uleb128 0x17
+	.uleb128 0x58
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x59
+	.uleb128 0x5
+	.uleb128 0x57
+	.uleb128 0xb
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x2a
+	.uleb128 0xb
+	.byte	0x1
+	.uleb128 0x55
+	.uleb128 0x17
+	.byte	0
+	.byte	0
+	.uleb128 0x2b
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 13
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x20
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x2c
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 12
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x20
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x2d
+	.uleb128 0x5
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x8
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x2
+	.uleb128 0x18
+	.byte	0
+	.byte	0
+	.uleb128 0x2e
+	.uleb128 0x11
+	.byte	0x1
+	.uleb128 0x25
+	.uleb128 0xe
+	.uleb128 0x13
+	.uleb128 0xb
+	.uleb128 0x3
+	.uleb128 0x1f
+	.uleb128 0x1b
+	.uleb128 0x1f
+	.uleb128 0x11
+	.uleb128 0x1
+	.uleb128 0x12
+	.uleb128 0x7
+	.uleb128 0x10
+	.uleb128 0x17
+	.byte	0
+	.byte	0
+	.uleb128 0x2f
+	.uleb128 0x24
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x3e
+	.uleb128 0xb
+	.uleb128 0x3
+	.uleb128 0x8
+	.byte	0
+	.byte	0
+	.uleb128 0x30
+	.uleb128 0xf
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x31
+	.uleb128 0x26
+	.byte	0
+	.byte	0
+	.byte	0
+	.uleb128 0x32
+	.uleb128 0x16
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x33
+	.uleb128 0x13
+	.byte	0x1
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x88
+	.uleb128 0xb
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x34
+	.uleb128 0x21
+	.byte	0
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x37
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x35
+	.uleb128 0x4
+	.byte	0x1
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3e
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x36
+	.uleb128 0xd
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x8
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x38
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x37
+	.uleb128 0x21
+	.byte	0
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x38
+	.uleb128 0x4
+	.byte	0x1
+	.uleb128 0x3e
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x39
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x3c
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x3a
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x3c
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x3b
+	.uleb128 0x18
+	.byte	0
+	.byte	0
+	.byte	0
+	.uleb128 0x3c
+	.uleb128 0x2e
+	.byte	0
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x3c
+	.uleb128 0x19
+	.byte	0
+	.byte	0
+	.uleb128 0x3d
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x11
+	.uleb128 0x1
+	.uleb128 0x12
+	.uleb128 0x7
+	.uleb128 0x40
+	.uleb128 0x18
+	.uleb128 0x7a
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x3e
+	.uleb128 0x5
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x8
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x2
+	.uleb128 0x17
+	.uleb128 0x2137
+	.uleb128 0x17
+	.byte	0
+	.byte	0
+	.uleb128 0x3f
+	.uleb128 0x5
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x2
+	.uleb128 0x17
+	.uleb128 0x2137
+	.uleb128 0x17
+	.byte	0
+	.byte	0
+	.uleb128 0x40
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x8
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x2
+	.uleb128 0x18
+	.byte	0
+	.byte	0
+	.uleb128 0x41
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x11
+	.uleb128 0x1
+	.uleb128 0x12
+	.uleb128 0x7
+	.uleb128 0x40
+	.uleb128 0x18
+	.uleb128 0x7a
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x42
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x2
+	.uleb128 0x18
+	.byte	0
+	.byte	0
+	.uleb128 0x43
+	.uleb128 0xb
+	.byte	0x1
+	.uleb128 0x11
+	.uleb128 0x1
+	.uleb128 0x12
+	.uleb128 0x7
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x44
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x8
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x2
+	.uleb128 0x17
+	.uleb128 0x2137
+	.uleb128 0x17
+	.byte	0
+	.byte	0
+	.uleb128 0x45
+	.uleb128 0x1d
+	.byte	0x1
+	.uleb128 0x31
+	.uleb128 0x13
+	.uleb128 0x55
+	.uleb128 0x17
+	.uleb128 0x58
+	.uleb128 0xb
+	.uleb128 0x59
+	.uleb128 0xb
+	.uleb128 0x57
+	.uleb128 0xb
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x46
+	.uleb128 0x5
+	.byte	0
+	.uleb128 0x31
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x47
+	.uleb128 0xb
+	.byte	0x1
+	.uleb128 0x31
+	.uleb128 0x13
+	.uleb128 0x55
+	.uleb128 0x17
+	.byte	0
+	.byte	0
+	.uleb128 0x48
+	.uleb128 0x1d
+	.byte	0x1
+	.uleb128 0x31
+	.uleb128 0x13
+	.uleb128 0x52
+	.uleb128 0x1
+	.uleb128 0x2138
+	.uleb128 0x5
+	.uleb128 0x55
+	.uleb128 0x17
+	.uleb128 0x58
+	.uleb128 0xb
+	.uleb128 0x59
+	.uleb128 0xb
+	.uleb128 0x57
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x49
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x31
+	.uleb128 0x13
+	.uleb128 0x2
+	.uleb128 0x18
+	.byte	0
+	.byte	0
+	.uleb128 0x4a
+	.uleb128 0x1d
+	.byte	0x1
+	.uleb128 0x31
+	.uleb128 0x13
+	.uleb128 0x52
+	.uleb128 0x1
+	.uleb128 0x2138
+	.uleb128 0x5
+	.uleb128 0x11
+	.uleb128 0x1
+	.uleb128 0x12
+	.uleb128 0x7
+	.uleb128 0x58
+	.uleb128 0xb
+	.uleb128 0x59
+	.uleb128 0xb
+	.uleb128 0x57
+	.uleb128 0xb
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x4b
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x4c
+	.uleb128 0xb
+	.byte	0x1
+	.byte	0
+	.byte	0
+	.uleb128 0x4d
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x11
+	.uleb128 0x1
+	.uleb128 0x12
+	.uleb128 0x7
+	.uleb128 0x40
+	.uleb128 0x18
+	.uleb128 0x7a
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x4e
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x20
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.byte	0
+	.section	.debug_loclists,"",@progbits
+	.long	.Ldebug_loc3-.Ldebug_loc2
+.Ldebug_loc2:
+	.value	0x5
+	.byte	0x8
+	.byte	0
+	.long	0
+.Ldebug_loc0:
+.LVUS60:
+	.uleb128 0
+	.uleb128 .LVU620
+	.uleb128 .LVU620
+	.uleb128 0
+.LLST60:
+	.byte	0x4
+	.uleb128 .LVL148-.Ltext0
+	.uleb128 .LVL149-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL149-1-.Ltext0
+	.uleb128 .LFE39-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x9f
+	.byte	0
+.LVUS61:
+	.uleb128 0
+	.uleb128 .LVU620
+	.uleb128 .LVU620
+	.uleb128 0
+.LLST61:
+	.byte	0x4
+	.uleb128 .LVL148-.Ltext0
+	.uleb128 .LVL149-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x4
+	.uleb128 .LVL149-1-.Ltext0
+	.uleb128 .LFE39-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x9f
+	.byte	0
+.LVUS8:
+	.uleb128 0
+	.uleb128 .LVU83
+	.uleb128 .LVU83
+	.uleb128 .LVU286
+	.uleb128 .LVU286
+	.uleb128 .LVU322
+	.uleb128 .LVU322
+	.uleb128 .LVU324
+	.uleb128 .LVU324
+	.uleb128 .LVU326
+	.uleb128 .LVU326
+	.uleb128 .LVU536
+	.uleb128 .LVU536
+	.uleb128 .LVU575
+	.uleb128 .LVU575
+	.uleb128 .LVU580
+	.uleb128 .LVU580
+	.uleb128 0
+.LLST8:
+	.byte	0x4
+	.uleb128 .LVL12-.Ltext0
+	.uleb128 .LVL18-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL18-.Ltext0
+	.uleb128 .LVL48-.Ltext0
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -648
+	.byte	0x4
+	.uleb128 .LVL48-.Ltext0
+	.uleb128 .LVL61-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL61-.Ltext0
+	.uleb128 .LVL62-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL62-.Ltext0
+	.uleb128 .LVL63-.Ltext0
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -648
+	.byte	0x4
+	.uleb128 .LVL63-.Ltext0
+	.uleb128 .LVL121-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL121-.Ltext0
+	.uleb128 .LVL133-.Ltext0
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -648
+	.byte	0x4
+	.uleb128 .LVL133-.Ltext0
+	.uleb128 .LVL135-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL135-.Ltext0
+	.uleb128 .LFE38-.Ltext0
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -648
+	.byte	0
+.LVUS9:
+	.uleb128 0
+	.uleb128 .LVU85
+	.uleb128 .LVU85
+	.uleb128 .LVU286
+	.uleb128 .LVU286
+	.uleb128 .LVU322
+	.uleb128 .LVU322
+	.uleb128 .LVU324
+	.uleb128 .LVU324
+	.uleb128 .LVU326
+	.uleb128 .LVU326
+	.uleb128 .LVU536
+	.uleb128 .LVU536
+	.uleb128 .LVU575
+	.uleb128 .LVU575
+	.uleb128 .LVU580
+	.uleb128 .LVU580
+	.uleb128 0
+.LLST9:
+	.byte	0x4
+	.uleb128 .LVL12-.Ltext0
+	.uleb128 .LVL20-.Ltext0
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x4
+	.uleb128 .LVL20-.Ltext0
+	.uleb128 .LVL48-.Ltext0
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -656
+	.byte	0x4
+	.uleb128 .LVL48-.Ltext0
+	.uleb128 .LVL61-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL61-.Ltext0
+	.uleb128 .LVL62-.Ltext0
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x4
+	.uleb128 .LVL62-.Ltext0
+	.uleb128 .LVL63-.Ltext0
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -656
+	.byte	0x4
+	.uleb128 .LVL63-.Ltext0
+	.uleb128 .LVL121-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL121-.Ltext0
+	.uleb128 .LVL133-.Ltext0
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -656
+	.byte	0x4
+	.uleb128 .LVL133-.Ltext0
+	.uleb128 .LVL135-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL135-.Ltext0
+	.uleb128 .LFE38-.Ltext0
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -656
+	.byte	0
+.LVUS10:
+	.uleb128 0
+	.uleb128 .LVU69
+	.uleb128 .LVU69
+	.uleb128 .LVU286
+	.uleb128 .LVU286
+	.uleb128 .LVU322
+	.uleb128 .LVU322
+	.uleb128 .LVU326
+	.uleb128 .LVU326
+	.uleb128 .LVU536
+	.uleb128 .LVU536
+	.uleb128 .LVU575
+	.uleb128 .LVU575
+	.uleb128 .LVU580
+	.uleb128 .LVU580
+	.uleb128 0
+.LLST10:
+	.byte	0x4
+	.uleb128 .LVL12-.Ltext0
+	.uleb128 .LVL15-.Ltext0
+	.uleb128 0x1
+	.byte	0x51
+	.byte	0x4
+	.uleb128 .LVL15-.Ltext0
+	.uleb128 .LVL48-.Ltext0
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -592
+	.byte	0x4
+	.uleb128 .LVL48-.Ltext0
+	.uleb128 .LVL61-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x51
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL61-.Ltext0
+	.uleb128 .LVL63-.Ltext0
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -592
+	.byte	0x4
+	.uleb128 .LVL63-.Ltext0
+	.uleb128 .LVL121-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x51
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL121-.Ltext0
+	.uleb128 .LVL133-.Ltext0
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -592
+	.byte	0x4
+	.uleb128 .LVL133-.Ltext0
+	.uleb128 .LVL135-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x51
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL135-.Ltext0
+	.uleb128 .LFE38-.Ltext0
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -592
+	.byte	0
+.LVUS11:
+	.uleb128 0
+	.uleb128 .LVU84
+	.uleb128 .LVU84
+	.uleb128 .LVU286
+	.uleb128 .LVU286
+	.uleb128 .LVU322
+	.uleb128 .LVU322
+	.uleb128 .LVU324
+	.uleb128 .LVU324
+	.uleb128 .LVU326
+	.uleb128 .LVU326
+	.uleb128 .LVU536
+	.uleb128 .LVU536
+	.uleb128 .LVU575
+	.uleb128 .LVU575
+	.uleb128 .LVU580
+	.uleb128 .LVU580
+	.uleb128 0
+.LLST11:
+	.byte	0x4
+	.uleb128 .LVL12-.Ltext0
+	.uleb128 .LVL19-.Ltext0
+	.uleb128 0x1
+	.byte	0x52
+	.byte	0x4
+	.uleb128 .LVL19-.Ltext0
+	.uleb128 .LVL48-.Ltext0
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -584
+	.byte	0x4
+	.uleb128 .LVL48-.Ltext0
+	.uleb128 .LVL61-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x52
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL61-.Ltext0
+	.uleb128 .LVL62-.Ltext0
+	.uleb128 0x1
+	.byte	0x52
+	.byte	0x4
+	.uleb128 .LVL62-.Ltext0
+	.uleb128 .LVL63-.Ltext0
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -584
+	.byte	0x4
+	.uleb128 .LVL63-.Ltext0
+	.uleb128 .LVL121-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x52
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL121-.Ltext0
+	.uleb128 .LVL133-.Ltext0
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -584
+	.byte	0x4
+	.uleb128 .LVL133-.Ltext0
+	.uleb128 .LVL135-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x52
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL135-.Ltext0
+	.uleb128 .LFE38-.Ltext0
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -584
+	.byte	0
+.LVUS12:
+	.uleb128 0
+	.uleb128 .LVU88
+	.uleb128 .LVU88
+	.uleb128 .LVU286
+	.uleb128 .LVU286
+	.uleb128 .LVU322
+	.uleb128 .LVU322
+	.uleb128 .LVU324
+	.uleb128 .LVU324
+	.uleb128 .LVU326
+	.uleb128 .LVU326
+	.uleb128 .LVU536
+	.uleb128 .LVU536
+	.uleb128 .LVU575
+	.uleb128 .LVU575
+	.uleb128 .LVU580
+	.uleb128 .LVU580
+	.uleb128 0
+.LLST12:
+	.byte	0x4
+	.uleb128 .LVL12-.Ltext0
+	.uleb128 .LVL21-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x58
+	.byte	0x4
+	.uleb128 .LVL21-1-.Ltext0
+	.uleb128 .LVL48-.Ltext0
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -600
+	.byte	0x4
+	.uleb128 .LVL48-.Ltext0
+	.uleb128 .LVL61-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x58
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL61-.Ltext0
+	.uleb128 .LVL62-.Ltext0
+	.uleb128 0x1
+	.byte	0x58
+	.byte	0x4
+	.uleb128 .LVL62-.Ltext0
+	.uleb128 .LVL63-.Ltext0
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -600
+	.byte	0x4
+	.uleb128 .LVL63-.Ltext0
+	.uleb128 .LVL121-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x58
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL121-.Ltext0
+	.uleb128 .LVL133-.Ltext0
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -600
+	.byte	0x4
+	.uleb128 .LVL133-.Ltext0
+	.uleb128 .LVL135-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x58
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL135-.Ltext0
+	.uleb128 .LFE38-.Ltext0
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -600
+	.byte	0
+.LVUS13:
+	.uleb128 0
+	.uleb128 .LVU88
+	.uleb128 .LVU88
+	.uleb128 .LVU286
+	.uleb128 .LVU286
+	.uleb128 .LVU322
+	.uleb128 .LVU322
+	.uleb128 .LVU324
+	.uleb128 .LVU324
+	.uleb128 .LVU326
+	.uleb128 .LVU326
+	.uleb128 .LVU536
+	.uleb128 .LVU536
+	.uleb128 .LVU575
+	.uleb128 .LVU575
+	.uleb128 .LVU580
+	.uleb128 .LVU580
+	.uleb128 0
+.LLST13:
+	.byte	0x4
+	.uleb128 .LVL12-.Ltext0
+	.uleb128 .LVL21-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x59
+	.byte	0x4
+	.uleb128 .LVL21-1-.Ltext0
+	.uleb128 .LVL48-.Ltext0
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -568
+	.byte	0x4
+	.uleb128 .LVL48-.Ltext0
+	.uleb128 .LVL61-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x59
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL61-.Ltext0
+	.uleb128 .LVL62-.Ltext0
+	.uleb128 0x1
+	.byte	0x59
+	.byte	0x4
+	.uleb128 .LVL62-.Ltext0
+	.uleb128 .LVL63-.Ltext0
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -568
+	.byte	0x4
+	.uleb128 .LVL63-.Ltext0
+	.uleb128 .LVL121-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x59
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL121-.Ltext0
+	.uleb128 .LVL133-.Ltext0
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -568
+	.byte	0x4
+	.uleb128 .LVL133-.Ltext0
+	.uleb128 .LVL135-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x59
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL135-.Ltext0
+	.uleb128 .LFE38-.Ltext0
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -568
+	.byte	0
+.LVUS14:
+	.uleb128 .LVU65
+	.uleb128 .LVU68
+.LLST14:
+	.byte	0x4
+	.uleb128 .LVL13-.Ltext0
+	.uleb128 .LVL14-.Ltext0
+	.uleb128 0x17
+	.byte	0x91
+	.sleb128 -592
+	.byte	0x6
+	.byte	0x20
+	.byte	0x78
+	.sleb128 0
+	.byte	0x22
+	.byte	0x91
+	.sleb128 -584
+	.byte	0x6
+	.byte	0x22
+	.byte	0xa8
+	.uleb128 0x2e
+	.byte	0x78
+	.sleb128 0
+	.byte	0xa8
+	.uleb128 0x2e
+	.byte	0x1b
+	.byte	0xa8
+	.uleb128 0
+	.byte	0x9f
+	.byte	0
+.LVUS15:
+	.uleb128 .LVU66
+	.uleb128 .LVU257
+	.uleb128 .LVU257
+	.uleb128 .LVU286
+	.uleb128 .LVU286
+	.uleb128 .LVU319
+	.uleb128 .LVU322
+	.uleb128 .LVU326
+	.uleb128 .LVU326
+	.uleb128 .LVU384
+	.uleb128 .LVU384
+	.uleb128 .LVU387
+	.uleb128 .LVU387
+	.uleb128 .LVU415
+	.uleb128 .LVU415
+	.uleb128 .LVU425
+	.uleb128 .LVU425
+	.uleb128 .LVU437
+	.uleb128 .LVU437
+	.uleb128 .LVU438
+	.uleb128 .LVU438
+	.uleb128 .LVU448
+	.uleb128 .LVU460
+	.uleb128 .LVU489
+	.uleb128 .LVU489
+	.uleb128 .LVU497
+	.uleb128 .LVU497
+	.uleb128 .LVU509
+	.uleb128 .LVU509
+	.uleb128 .LVU536
+	.uleb128 .LVU536
+	.uleb128 .LVU539
+	.uleb128 .LVU539
+	.uleb128 .LVU561
+	.uleb128 .LVU561
+	.uleb128 .LVU575
+	.uleb128 .LVU580
+	.uleb128 0
+.LLST15:
+	.byte	0x4
+	.uleb128 .LVL13-.Ltext0
+	.uleb128 .LVL43-.Ltext0
+	.uleb128 0x2
+	.byte	0x30
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL43-.Ltext0
+	.uleb128 .LVL48-.Ltext0
+	.uleb128 0x1
+	.byte	0x59
+	.byte	0x4
+	.uleb128 .LVL48-.Ltext0
+	.uleb128 .LVL59-.Ltext0
+	.uleb128 0x1
+	.byte	0x56
+	.byte	0x4
+	.uleb128 .LVL61-.Ltext0
+	.uleb128 .LVL63-.Ltext0
+	.uleb128 0x2
+	.byte	0x30
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL63-.Ltext0
+	.uleb128 .LVL72-.Ltext0
+	.uleb128 0x1
+	.byte	0x56
+	.byte	0x4
+	.uleb128 .LVL72-.Ltext0
+	.uleb128 .LVL74-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL74-.Ltext0
+	.uleb128 .LVL79-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0x4
+	.uleb128 .LVL79-.Ltext0
+	.uleb128 .LVL81-.Ltext0
+	.uleb128 0x1
+	.byte	0x59
+	.byte	0x4
+	.uleb128 .LVL81-.Ltext0
+	.uleb128 .LVL87-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0x4
+	.uleb128 .LVL87-.Ltext0
+	.uleb128 .LVL88-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL88-.Ltext0
+	.uleb128 .LVL92-.Ltext0
+	.uleb128 0x1
+	.byte	0x56
+	.byte	0x4
+	.uleb128 .LVL98-.Ltext0
+	.uleb128 .LVL103-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0x4
+	.uleb128 .LVL103-.Ltext0
+	.uleb128 .LVL105-.Ltext0
+	.uleb128 0x1
+	.byte	0x59
+	.byte	0x4
+	.uleb128 .LVL105-.Ltext0
+	.uleb128 .LVL110-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0x4
+	.uleb128 .LVL110-.Ltext0
+	.uleb128 .LVL121-.Ltext0
+	.uleb128 0x1
+	.byte	0x56
+	.byte	0x4
+	.uleb128 .LVL121-.Ltext0
+	.uleb128 .LVL123-.Ltext0
+	.uleb128 0x2
+	.byte	0x30
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL123-.Ltext0
+	.uleb128 .LVL127-.Ltext0
+	.uleb128 0x1
+	.byte	0x59
+	.byte	0x4
+	.uleb128 .LVL127-.Ltext0
+	.uleb128 .LVL133-.Ltext0
+	.uleb128 0x2
+	.byte	0x30
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL135-.Ltext0
+	.uleb128 .LFE38-.Ltext0
+	.uleb128 0x2
+	.byte	0x30
+	.byte	0x9f
+	.byte	0
+.LVUS16:
+	.uleb128 .LVU66
+	.uleb128 .LVU286
+	.uleb128 .LVU286
+	.uleb128 .LVU309
+	.uleb128 .LVU322
+	.uleb128 .LVU326
+	.uleb128 .LVU326
+	.uleb128 .LVU385
+	.uleb128 .LVU385
+	.uleb128 .LVU391
+	.uleb128 .LVU391
+	.uleb128 .LVU395
+	.uleb128 .LVU395
+	.uleb128 .LVU438
+	.uleb128 .LVU438
+	.uleb128 .LVU446
+	.uleb128 .LVU460
+	.uleb128 .LVU464
+	.uleb128 .LVU464
+	.uleb128 .LVU468
+	.uleb128 .LVU468
+	.uleb128 .LVU509
+	.uleb128 .LVU509
+	.uleb128 .LVU536
+	.uleb128 .LVU536
+	.uleb128 .LVU575
+	.uleb128 .LVU580
+	.uleb128 0
+.LLST16:
+	.byte	0x4
+	.uleb128 .LVL13-.Ltext0
+	.uleb128 .LVL48-.Ltext0
+	.uleb128 0x2
+	.byte	0x30
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL48-.Ltext0
+	.uleb128 .LVL54-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0x4
+	.uleb128 .LVL61-.Ltext0
+	.uleb128 .LVL63-.Ltext0
+	.uleb128 0x2
+	.byte	0x30
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL63-.Ltext0
+	.uleb128 .LVL73-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0x4
+	.uleb128 .LVL73-.Ltext0
+	.uleb128 .LVL76-.Ltext0
+	.uleb128 0x1
+	.byte	0x56
+	.byte	0x4
+	.uleb128 .LVL76-.Ltext0
+	.uleb128 .LVL77-.Ltext0
+	.uleb128 0x3
+	.byte	0x76
+	.sleb128 -1
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL77-.Ltext0
+	.uleb128 .LVL88-.Ltext0
+	.uleb128 0x1
+	.byte	0x56
+	.byte	0x4
+	.uleb128 .LVL88-.Ltext0
+	.uleb128 .LVL91-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0x4
+	.uleb128 .LVL98-.Ltext0
+	.uleb128 .LVL100-.Ltext0
+	.uleb128 0x1
+	.byte	0x56
+	.byte	0x4
+	.uleb128 .LVL100-.Ltext0
+	.uleb128 .LVL101-.Ltext0
+	.uleb128 0x3
+	.byte	0x76
+	.sleb128 -1
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL101-.Ltext0
+	.uleb128 .LVL110-.Ltext0
+	.uleb128 0x1
+	.byte	0x56
+	.byte	0x4
+	.uleb128 .LVL110-.Ltext0
+	.uleb128 .LVL121-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0x4
+	.uleb128 .LVL121-.Ltext0
+	.uleb128 .LVL133-.Ltext0
+	.uleb128 0x2
+	.byte	0x30
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL135-.Ltext0
+	.uleb128 .LFE38-.Ltext0
+	.uleb128 0x2
+	.byte	0x30
+	.byte	0x9f
+	.byte	0
+.LVUS17:
+	.uleb128 .LVU70
+	.uleb128 .LVU78
+	.uleb128 .LVU78
+	.uleb128 .LVU254
+	.uleb128 .LVU322
+	.uleb128 .LVU324
+	.uleb128 .LVU324
+	.uleb128 .LVU326
+	.uleb128 .LVU561
+	.uleb128 .LVU575
+	.uleb128 .LVU580
+	.uleb128 0
+.LLST17:
+	.byte	0x4
+	.uleb128 .LVL16-.Ltext0
+	.uleb128 .LVL17-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL17-.Ltext0
+	.uleb128 .LVL41-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0x4
+	.uleb128 .LVL61-.Ltext0
+	.uleb128 .LVL62-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL62-.Ltext0
+	.uleb128 .LVL63-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0x4
+	.uleb128 .LVL127-.Ltext0
+	.uleb128 .LVL133-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0x4
+	.uleb128 .LVL135-.Ltext0
+	.uleb128 .LFE38-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0
+.LVUS18:
+	.uleb128 .LVU71
+	.uleb128 .LVU257
+	.uleb128 .LVU286
+	.uleb128 .LVU299
+	.uleb128 .LVU322
+	.uleb128 .LVU326
+	.uleb128 .LVU326
+	.uleb128 .LVU361
+	.uleb128 .LVU361
+	.uleb128 .LVU382
+	.uleb128 .LVU382
+	.uleb128 .LVU387
+	.uleb128 .LVU387
+	.uleb128 .LVU438
+	.uleb128 .LVU438
+	.uleb128 .LVU452
+	.uleb128 .LVU460
+	.uleb128 .LVU509
+	.uleb128 .LVU509
+	.uleb128 .LVU517
+	.uleb128 .LVU517
+	.uleb128 .LVU521
+	.uleb128 .LVU521
+	.uleb128 .LVU522
+	.uleb128 .LVU522
+	.uleb128 .LVU536
+	.uleb128 .LVU536
+	.uleb128 .LVU539
+	.uleb128 .LVU561
+	.uleb128 .LVU575
+	.uleb128 .LVU580
+	.uleb128 0
+.LLST18:
+	.byte	0x4
+	.uleb128 .LVL16-.Ltext0
+	.uleb128 .LVL43-.Ltext0
+	.uleb128 0x2
+	.byte	0x30
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL48-.Ltext0
+	.uleb128 .LVL51-.Ltext0
+	.uleb128 0x1
+	.byte	0x5f
+	.byte	0x4
+	.uleb128 .LVL61-.Ltext0
+	.uleb128 .LVL63-.Ltext0
+	.uleb128 0x2
+	.byte	0x30
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL63-.Ltext0
+	.uleb128 .LVL69-.Ltext0
+	.uleb128 0x1
+	.byte	0x5f
+	.byte	0x4
+	.uleb128 .LVL69-.Ltext0
+	.uleb128 .LVL71-.Ltext0
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x4
+	.uleb128 .LVL71-.Ltext0
+	.uleb128 .LVL74-.Ltext0
+	.uleb128 0x1
+	.byte	0x5f
+	.byte	0x4
+	.uleb128 .LVL74-.Ltext0
+	.uleb128 .LVL88-.Ltext0
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -576
+	.byte	0x4
+	.uleb128 .LVL88-.Ltext0
+	.uleb128 .LVL93-.Ltext0
+	.uleb128 0x1
+	.byte	0x5f
+	.byte	0x4
+	.uleb128 .LVL98-.Ltext0
+	.uleb128 .LVL110-.Ltext0
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -576
+	.byte	0x4
+	.uleb128 .LVL110-.Ltext0
+	.uleb128 .LVL112-.Ltext0
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x4
+	.uleb128 .LVL112-.Ltext0
+	.uleb128 .LVL113-.Ltext0
+	.uleb128 0x3
+	.byte	0x7f
+	.sleb128 -1
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL113-.Ltext0
+	.uleb128 .LVL114-.Ltext0
+	.uleb128 0x1
+	.byte	0x5f
+	.byte	0x4
+	.uleb128 .LVL114-.Ltext0
+	.uleb128 .LVL121-.Ltext0
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x4
+	.uleb128 .LVL121-.Ltext0
+	.uleb128 .LVL123-.Ltext0
+	.uleb128 0x2
+	.byte	0x30
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL127-.Ltext0
+	.uleb128 .LVL133-.Ltext0
+	.uleb128 0x2
+	.byte	0x30
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL135-.Ltext0
+	.uleb128 .LFE38-.Ltext0
+	.uleb128 0x2
+	.byte	0x30
+	.byte	0x9f
+	.byte	0
+.LVUS19:
+	.uleb128 .LVU250
+	.uleb128 .LVU253
+	.uleb128 .LVU253
+	.uleb128 .LVU257
+	.uleb128 .LVU257
+	.uleb128 .LVU286
+	.uleb128 .LVU536
+	.uleb128 .LVU539
+	.uleb128 .LVU539
+	.uleb128 .LVU561
+	.uleb128 .LVU580
+	.uleb128 .LVU584
+	.uleb128 .LVU584
+	.uleb128 .LVU591
+.LLST19:
+	.byte	0x4
+	.uleb128 .LVL39-.Ltext0
+	.uleb128 .LVL40-.Ltext0
+	.uleb128 0x8
+	.byte	0x70
+	.sleb128 0
+	.byte	0x30
+	.byte	0x29
+	.byte	0x8
+	.byte	0xff
+	.byte	0x1a
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL40-.Ltext0
+	.uleb128 .LVL43-.Ltext0
+	.uleb128 0x8
+	.byte	0x72
+	.sleb128 0
+	.byte	0x30
+	.byte	0x29
+	.byte	0x8
+	.byte	0xff
+	.byte	0x1a
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL43-.Ltext0
+	.uleb128 .LVL48-.Ltext0
+	.uleb128 0xa
+	.byte	0x91
+	.sleb128 -624
+	.byte	0x6
+	.byte	0x30
+	.byte	0x29
+	.byte	0x8
+	.byte	0xff
+	.byte	0x1a
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL121-.Ltext0
+	.uleb128 .LVL123-.Ltext0
+	.uleb128 0x8
+	.byte	0x72
+	.sleb128 0
+	.byte	0x30
+	.byte	0x29
+	.byte	0x8
+	.byte	0xff
+	.byte	0x1a
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL123-.Ltext0
+	.uleb128 .LVL127-.Ltext0
+	.uleb128 0xa
+	.byte	0x91
+	.sleb128 -624
+	.byte	0x6
+	.byte	0x30
+	.byte	0x29
+	.byte	0x8
+	.byte	0xff
+	.byte	0x1a
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL135-.Ltext0
+	.uleb128 .LVL136-1-.Ltext0
+	.uleb128 0x8
+	.byte	0x70
+	.sleb128 0
+	.byte	0x30
+	.byte	0x29
+	.byte	0x8
+	.byte	0xff
+	.byte	0x1a
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL136-1-.Ltext0
+	.uleb128 .LVL140-.Ltext0
+	.uleb128 0xa
+	.byte	0x91
+	.sleb128 -624
+	.byte	0x6
+	.byte	0x30
+	.byte	0x29
+	.byte	0x8
+	.byte	0xff
+	.byte	0x1a
+	.byte	0x9f
+	.byte	0
+.LVUS20:
+	.uleb128 .LVU72
+	.uleb128 .LVU286
+	.uleb128 .LVU286
+	.uleb128 .LVU300
+	.uleb128 .LVU302
+	.uleb128 .LVU311
+	.uleb128 .LVU322
+	.uleb128 .LVU326
+	.uleb128 .LVU326
+	.uleb128 .LVU354
+	.uleb128 .LVU380
+	.uleb128 .LVU382
+	.uleb128 .LVU382
+	.uleb128 .LVU452
+	.uleb128 .LVU460
+	.uleb128 .LVU509
+	.uleb128 .LVU526
+	.uleb128 .LVU528
+	.uleb128 .LVU535
+	.uleb128 .LVU536
+	.uleb128 .LVU536
+	.uleb128 .LVU575
+	.uleb128 .LVU580
+	.uleb128 0
+.LLST20:
+	.byte	0x4
+	.uleb128 .LVL16-.Ltext0
+	.uleb128 .LVL48-.Ltext0
+	.uleb128 0x2
+	.byte	0x30
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL48-.Ltext0
+	.uleb128 .LVL52-.Ltext0
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -672
+	.byte	0x4
+	.uleb128 .LVL52-.Ltext0
+	.uleb128 .LVL55-.Ltext0
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -672
+	.byte	0x4
+	.uleb128 .LVL61-.Ltext0
+	.uleb128 .LVL63-.Ltext0
+	.uleb128 0x2
+	.byte	0x30
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL63-.Ltext0
+	.uleb128 .LVL69-.Ltext0
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -672
+	.byte	0x4
+	.uleb128 .LVL70-.Ltext0
+	.uleb128 .LVL71-.Ltext0
+	.uleb128 0x2
+	.byte	0x30
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL71-.Ltext0
+	.uleb128 .LVL93-.Ltext0
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -672
+	.byte	0x4
+	.uleb128 .LVL98-.Ltext0
+	.uleb128 .LVL110-.Ltext0
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -672
+	.byte	0x4
+	.uleb128 .LVL116-.Ltext0
+	.uleb128 .LVL117-.Ltext0
+	.uleb128 0x2
+	.byte	0x30
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL120-.Ltext0
+	.uleb128 .LVL121-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL121-.Ltext0
+	.uleb128 .LVL133-.Ltext0
+	.uleb128 0x2
+	.byte	0x30
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL135-.Ltext0
+	.uleb128 .LFE38-.Ltext0
+	.uleb128 0x2
+	.byte	0x30
+	.byte	0x9f
+	.byte	0
+.LVUS26:
+	.uleb128 .LVU178
+	.uleb128 .LVU187
+	.uleb128 .LVU187
+	.uleb128 .LVU193
+	.uleb128 .LVU193
+	.uleb128 .LVU200
+	.uleb128 .LVU200
+	.uleb128 .LVU207
+	.uleb128 .LVU207
+	.uleb128 .LVU214
+	.uleb128 .LVU214
+	.uleb128 .LVU221
+	.uleb128 .LVU221
+	.uleb128 .LVU228
+	.uleb128 .LVU228
+	.uleb128 .LVU235
+	.uleb128 .LVU235
+	.uleb128 .LVU236
+.LLST26:
+	.byte	0x4
+	.uleb128 .LVL29-.Ltext0
+	.uleb128 .LVL30-.Ltext0
+	.uleb128 0x2
+	.byte	0x30
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL30-.Ltext0
+	.uleb128 .LVL31-.Ltext0
+	.uleb128 0x2
+	.byte	0x31
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL31-.Ltext0
+	.uleb128 .LVL32-.Ltext0
+	.uleb128 0x2
+	.byte	0x32
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL32-.Ltext0
+	.uleb128 .LVL33-.Ltext0
+	.uleb128 0x2
+	.byte	0x33
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL33-.Ltext0
+	.uleb128 .LVL34-.Ltext0
+	.uleb128 0x2
+	.byte	0x34
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL34-.Ltext0
+	.uleb128 .LVL35-.Ltext0
+	.uleb128 0x2
+	.byte	0x35
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL35-.Ltext0
+	.uleb128 .LVL36-.Ltext0
+	.uleb128 0x2
+	.byte	0x36
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL36-.Ltext0
+	.uleb128 .LVL37-.Ltext0
+	.uleb128 0x2
+	.byte	0x37
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL37-.Ltext0
+	.uleb128 .LVL37-.Ltext0
+	.uleb128 0x2
+	.byte	0x38
+	.byte	0x9f
+	.byte	0
+.LVUS35:
+	.uleb128 .LVU357
+	.uleb128 .LVU382
+	.uleb128 .LVU509
+	.uleb128 .LVU528
+	.uleb128 .LVU528
+	.uleb128 .LVU529
+	.uleb128 .LVU529
+	.uleb128 .LVU536
+.LLST35:
+	.byte	0x4
+	.uleb128 .LVL69-.Ltext0
+	.uleb128 .LVL71-.Ltext0
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -528
+	.byte	0x4
+	.uleb128 .LVL110-.Ltext0
+	.uleb128 .LVL117-.Ltext0
+	.uleb128 0x1
+	.byte	0x59
+	.byte	0x4
+	.uleb128 .LVL117-.Ltext0
+	.uleb128 .LVL118-.Ltext0
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -528
+	.byte	0x4
+	.uleb128 .LVL118-.Ltext0
+	.uleb128 .LVL121-.Ltext0
+	.uleb128 0x1
+	.byte	0x59
+	.byte	0
+.LVUS36:
+	.uleb128 .LVU358
+	.uleb128 .LVU382
+	.uleb128 .LVU509
+	.uleb128 .LVU528
+	.uleb128 .LVU528
+	.uleb128 .LVU529
+	.uleb128 .LVU529
+	.uleb128 .LVU536
+.LLST36:
+	.byte	0x4
+	.uleb128 .LVL69-.Ltext0
+	.uleb128 .LVL71-.Ltext0
+	.uleb128 0x8
+	.byte	0x91
+	.sleb128 -528
+	.byte	0x6
+	.byte	0x7e
+	.sleb128 0
+	.byte	0x1d
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL110-.Ltext0
+	.uleb128 .LVL117-.Ltext0
+	.uleb128 0x6
+	.byte	0x79
+	.sleb128 0
+	.byte	0x7e
+	.sleb128 0
+	.byte	0x1d
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL117-.Ltext0
+	.uleb128 .LVL118-.Ltext0
+	.uleb128 0x8
+	.byte	0x91
+	.sleb128 -528
+	.byte	0x6
+	.byte	0x7e
+	.sleb128 0
+	.byte	0x1d
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL118-.Ltext0
+	.uleb128 .LVL121-.Ltext0
+	.uleb128 0x6
+	.byte	0x79
+	.sleb128 0
+	.byte	0x7e
+	.sleb128 0
+	.byte	0x1d
+	.byte	0x9f
+	.byte	0
+.LVUS37:
+	.uleb128 .LVU359
+	.uleb128 .LVU382
+	.uleb128 .LVU509
+	.uleb128 .LVU528
+	.uleb128 .LVU528
+	.uleb128 .LVU529
+	.uleb128 .LVU529
+	.uleb128 .LVU536
+.LLST37:
+	.byte	0x4
+	.uleb128 .LVL69-.Ltext0
+	.uleb128 .LVL71-.Ltext0
+	.uleb128 0x11
+	.byte	0x91
+	.sleb128 -528
+	.byte	0x6
+	.byte	0x7e
+	.sleb128 0
+	.byte	0x1d
+	.byte	0x48
+	.byte	0x1e
+	.byte	0x91
+	.sleb128 0
+	.byte	0x22
+	.byte	0xa
+	.value	0x100
+	.byte	0x1c
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL110-.Ltext0
+	.uleb128 .LVL117-.Ltext0
+	.uleb128 0xf
+	.byte	0x79
+	.sleb128 0
+	.byte	0x7e
+	.sleb128 0
+	.byte	0x1d
+	.byte	0x48
+	.byte	0x1e
+	.byte	0x91
+	.sleb128 0
+	.byte	0x22
+	.byte	0xa
+	.value	0x100
+	.byte	0x1c
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL117-.Ltext0
+	.uleb128 .LVL118-.Ltext0
+	.uleb128 0x11
+	.byte	0x91
+	.sleb128 -528
+	.byte	0x6
+	.byte	0x7e
+	.sleb128 0
+	.byte	0x1d
+	.byte	0x48
+	.byte	0x1e
+	.byte	0x91
+	.sleb128 0
+	.byte	0x22
+	.byte	0xa
+	.value	0x100
+	.byte	0x1c
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL118-.Ltext0
+	.uleb128 .LVL121-.Ltext0
+	.uleb128 0xf
+	.byte	0x79
+	.sleb128 0
+	.byte	0x7e
+	.sleb128 0
+	.byte	0x1d
+	.byte	0x48
+	.byte	0x1e
+	.byte	0x91
+	.sleb128 0
+	.byte	0x22
+	.byte	0xa
+	.value	0x100
+	.byte	0x1c
+	.byte	0x9f
+	.byte	0
+.LVUS38:
+	.uleb128 .LVU360
+	.uleb128 .LVU379
+	.uleb128 .LVU379
+	.uleb128 .LVU382
+	.uleb128 .LVU509
+	.uleb128 .LVU510
+	.uleb128 .LVU522
+	.uleb128 .LVU524
+	.uleb128 .LVU524
+	.uleb128 .LVU528
+	.uleb128 .LVU531
+	.uleb128 .LVU536
+.LLST38:
+	.byte	0x4
+	.uleb128 .LVL69-.Ltext0
+	.uleb128 .LVL70-.Ltext0
+	.uleb128 0x2
+	.byte	0x30
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL70-.Ltext0
+	.uleb128 .LVL71-.Ltext0
+	.uleb128 0x33
+	.byte	0x75
+	.sleb128 0
+	.byte	0x23
+	.uleb128 0x8000000000000000
+	.byte	0x91
+	.sleb128 -528
+	.byte	0x6
+	.byte	0x7e
+	.sleb128 0
+	.byte	0x1d
+	.byte	0xc
+	.long	0xffffffff
+	.byte	0x1a
+	.byte	0x48
+	.byte	0x1e
+	.byte	0x91
+	.sleb128 0
+	.byte	0x22
+	.byte	0x8
+	.byte	0xf0
+	.byte	0x1c
+	.byte	0x6
+	.byte	0x23
+	.uleb128 0x8000000000000000
+	.byte	0x2b
+	.byte	0x8
+	.byte	0xff
+	.byte	0x1a
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL110-.Ltext0
+	.uleb128 .LVL111-.Ltext0
+	.uleb128 0x2
+	.byte	0x30
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL114-.Ltext0
+	.uleb128 .LVL115-.Ltext0
+	.uleb128 0x2
+	.byte	0x30
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL115-.Ltext0
+	.uleb128 .LVL117-.Ltext0
+	.uleb128 0x31
+	.byte	0x75
+	.sleb128 0
+	.byte	0x23
+	.uleb128 0x8000000000000000
+	.byte	0x79
+	.sleb128 0
+	.byte	0x7e
+	.sleb128 0
+	.byte	0x1d
+	.byte	0xc
+	.long	0xffffffff
+	.byte	0x1a
+	.byte	0x48
+	.byte	0x1e
+	.byte	0x91
+	.sleb128 0
+	.byte	0x22
+	.byte	0x8
+	.byte	0xf0
+	.byte	0x1c
+	.byte	0x6
+	.byte	0x23
+	.uleb128 0x8000000000000000
+	.byte	0x2b
+	.byte	0x8
+	.byte	0xff
+	.byte	0x1a
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL119-.Ltext0
+	.uleb128 .LVL121-.Ltext0
+	.uleb128 0x2
+	.byte	0x30
+	.byte	0x9f
+	.byte	0
+.LVUS49:
+	.uleb128 .LVU387
+	.uleb128 .LVU389
+	.uleb128 .LVU389
+	.uleb128 .LVU428
+	.uleb128 .LVU432
+	.uleb128 .LVU435
+	.uleb128 .LVU435
+	.uleb128 .LVU436
+	.uleb128 .LVU460
+	.uleb128 .LVU462
+	.uleb128 .LVU462
+	.uleb128 .LVU500
+	.uleb128 .LVU504
+	.uleb128 .LVU507
+	.uleb128 .LVU507
+	.uleb128 .LVU509
+.LLST49:
+	.byte	0x4
+	.uleb128 .LVL74-.Ltext0
+	.uleb128 .LVL75-.Ltext0
+	.uleb128 0x1
+	.byte	0x58
+	.byte	0x4
+	.uleb128 .LVL75-.Ltext0
+	.uleb128 .LVL83-.Ltext0
+	.uleb128 0x1
+	.byte	0x5d
+	.byte	0x4
+	.uleb128 .LVL84-.Ltext0
+	.uleb128 .LVL85-.Ltext0
+	.uleb128 0x1
+	.byte	0x51
+	.byte	0x4
+	.uleb128 .LVL85-.Ltext0
+	.uleb128 .LVL86-.Ltext0
+	.uleb128 0x1
+	.byte	0x58
+	.byte	0x4
+	.uleb128 .LVL98-.Ltext0
+	.uleb128 .LVL99-.Ltext0
+	.uleb128 0x1
+	.byte	0x52
+	.byte	0x4
+	.uleb128 .LVL99-.Ltext0
+	.uleb128 .LVL107-.Ltext0
+	.uleb128 0x1
+	.byte	0x5d
+	.byte	0x4
+	.uleb128 .LVL108-.Ltext0
+	.uleb128 .LVL109-.Ltext0
+	.uleb128 0x1
+	.byte	0x51
+	.byte	0x4
+	.uleb128 .LVL109-.Ltext0
+	.uleb128 .LVL110-.Ltext0
+	.uleb128 0x1
+	.byte	0x52
+	.byte	0
+.LVUS50:
+	.uleb128 .LVU387
+	.uleb128 .LVU428
+	.uleb128 .LVU433
+	.uleb128 .LVU435
+	.uleb128 .LVU435
+	.uleb128 .LVU436
+	.uleb128 .LVU460
+	.uleb128 .LVU500
+	.uleb128 .LVU505
+	.uleb128 .LVU507
+	.uleb128 .LVU507
+	.uleb128 .LVU509
+.LLST50:
+	.byte	0x4
+	.uleb128 .LVL74-.Ltext0
+	.uleb128 .LVL83-.Ltext0
+	.uleb128 0xc
+	.byte	0x7d
+	.sleb128 0
+	.byte	0x48
+	.byte	0x1e
+	.byte	0x91
+	.sleb128 0
+	.byte	0x22
+	.byte	0xa
+	.value	0x100
+	.byte	0x1c
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL84-.Ltext0
+	.uleb128 .LVL85-.Ltext0
+	.uleb128 0xc
+	.byte	0x71
+	.sleb128 0
+	.byte	0x48
+	.byte	0x1e
+	.byte	0x91
+	.sleb128 0
+	.byte	0x22
+	.byte	0xa
+	.value	0x100
+	.byte	0x1c
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL85-.Ltext0
+	.uleb128 .LVL86-.Ltext0
+	.uleb128 0xc
+	.byte	0x7d
+	.sleb128 0
+	.byte	0x48
+	.byte	0x1e
+	.byte	0x91
+	.sleb128 0
+	.byte	0x22
+	.byte	0xa
+	.value	0x100
+	.byte	0x1c
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL98-.Ltext0
+	.uleb128 .LVL107-.Ltext0
+	.uleb128 0xc
+	.byte	0x7d
+	.sleb128 0
+	.byte	0x48
+	.byte	0x1e
+	.byte	0x91
+	.sleb128 0
+	.byte	0x22
+	.byte	0xa
+	.value	0x100
+	.byte	0x1c
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL108-.Ltext0
+	.uleb128 .LVL109-.Ltext0
+	.uleb128 0xc
+	.byte	0x71
+	.sleb128 0
+	.byte	0x48
+	.byte	0x1e
+	.byte	0x91
+	.sleb128 0
+	.byte	0x22
+	.byte	0xa
+	.value	0x100
+	.byte	0x1c
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL109-.Ltext0
+	.uleb128 .LVL110-.Ltext0
+	.uleb128 0xc
+	.byte	0x7d
+	.sleb128 0
+	.byte	0x48
+	.byte	0x1e
+	.byte	0x91
+	.sleb128 0
+	.byte	0x22
+	.byte	0xa
+	.value	0x100
+	.byte	0x1c
+	.byte	0x9f
+	.byte	0
+.LVUS52:
+	.uleb128 .LVU398
+	.uleb128 .LVU417
+	.uleb128 .LVU471
+	.uleb128 .LVU491
+.LLST52:
+	.byte	0x4
+	.uleb128 .LVL78-.Ltext0
+	.uleb128 .LVL80-.Ltext0
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -600
+	.byte	0x4
+	.uleb128 .LVL102-.Ltext0
+	.uleb128 .LVL104-.Ltext0
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -600
+	.byte	0
+.LVUS53:
+	.uleb128 .LVU398
+	.uleb128 .LVU417
+	.uleb128 .LVU471
+	.uleb128 .LVU491
+.LLST53:
+	.byte	0x4
+	.uleb128 .LVL78-.Ltext0
+	.uleb128 .LVL80-.Ltext0
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -584
+	.byte	0x4
+	.uleb128 .LVL102-.Ltext0
+	.uleb128 .LVL104-.Ltext0
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -584
+	.byte	0
+.LVUS54:
+	.uleb128 .LVU398
+	.uleb128 .LVU417
+	.uleb128 .LVU471
+	.uleb128 .LVU491
+.LLST54:
+	.byte	0x4
+	.uleb128 .LVL78-.Ltext0
+	.uleb128 .LVL80-.Ltext0
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -592
+	.byte	0x4
+	.uleb128 .LVL102-.Ltext0
+	.uleb128 .LVL104-.Ltext0
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -592
+	.byte	0
+.LVUS55:
+	.uleb128 .LVU398
+	.uleb128 .LVU415
+	.uleb128 .LVU415
+	.uleb128 .LVU417
+	.uleb128 .LVU471
+	.uleb128 .LVU489
+	.uleb128 .LVU489
+	.uleb128 .LVU491
+.LLST55:
+	.byte	0x4
+	.uleb128 .LVL78-.Ltext0
+	.uleb128 .LVL79-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0x4
+	.uleb128 .LVL79-.Ltext0
+	.uleb128 .LVL80-.Ltext0
+	.uleb128 0x1
+	.byte	0x59
+	.byte	0x4
+	.uleb128 .LVL102-.Ltext0
+	.uleb128 .LVL103-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0x4
+	.uleb128 .LVL103-.Ltext0
+	.uleb128 .LVL104-.Ltext0
+	.uleb128 0x1
+	.byte	0x59
+	.byte	0
+.LVUS56:
+	.uleb128 .LVU398
+	.uleb128 .LVU417
+	.uleb128 .LVU471
+	.uleb128 .LVU491
+.LLST56:
+	.byte	0x4
+	.uleb128 .LVL78-.Ltext0
+	.uleb128 .LVL80-.Ltext0
+	.uleb128 0xc
+	.byte	0x7d
+	.sleb128 0
+	.byte	0x48
+	.byte	0x1e
+	.byte	0x91
+	.sleb128 0
+	.byte	0x22
+	.byte	0xa
+	.value	0x100
+	.byte	0x1c
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL102-.Ltext0
+	.uleb128 .LVL104-.Ltext0
+	.uleb128 0xc
+	.byte	0x7d
+	.sleb128 0
+	.byte	0x48
+	.byte	0x1e
+	.byte	0x91
+	.sleb128 0
+	.byte	0x22
+	.byte	0xa
+	.value	0x100
+	.byte	0x1c
+	.byte	0x9f
+	.byte	0
+.LVUS41:
+	.uleb128 .LVU291
+	.uleb128 .LVU295
+	.uleb128 .LVU328
+	.uleb128 .LVU332
+.LLST41:
+	.byte	0x4
+	.uleb128 .LVL49-.Ltext0
+	.uleb128 .LVL50-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL64-.Ltext0
+	.uleb128 .LVL65-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0
+.LVUS43:
+	.uleb128 .LVU303
+	.uleb128 .LVU315
+.LLST43:
+	.byte	0x4
+	.uleb128 .LVL52-.Ltext0
+	.uleb128 .LVL58-.Ltext0
+	.uleb128 0x4
+	.byte	0x91
+	.sleb128 -512
+	.byte	0x9f
+	.byte	0
+.LVUS45:
+	.uleb128 .LVU334
+	.uleb128 .LVU355
+.LLST45:
+	.byte	0x4
+	.uleb128 .LVL65-.Ltext0
+	.uleb128 .LVL69-.Ltext0
+	.uleb128 0x4
+	.byte	0x91
+	.sleb128 -528
+	.byte	0x9f
+	.byte	0
+.LVUS46:
+	.uleb128 .LVU334
+	.uleb128 .LVU355
+.LLST46:
+	.byte	0x4
+	.uleb128 .LVL65-.Ltext0
+	.uleb128 .LVL69-.Ltext0
+	.uleb128 0x4
+	.byte	0x91
+	.sleb128 -512
+	.byte	0x9f
+	.byte	0
+.LVUS47:
+	.uleb128 .LVU339
+	.uleb128 .LVU346
+	.uleb128 .LVU346
+	.uleb128 .LVU349
+	.uleb128 .LVU349
+	.uleb128 .LVU354
+	.uleb128 .LVU354
+	.uleb128 .LVU355
+.LLST47:
+	.byte	0x4
+	.uleb128 .LVL66-.Ltext0
+	.uleb128 .LVL67-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL67-.Ltext0
+	.uleb128 .LVL68-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL68-.Ltext0
+	.uleb128 .LVL69-.Ltext0
+	.uleb128 0x4
+	.byte	0x91
+	.sleb128 -480
+	.byte	0x6
+	.byte	0x4
+	.uleb128 .LVL69-.Ltext0
+	.uleb128 .LVL69-.Ltext0
+	.uleb128 0x3
+	.byte	0x70
+	.sleb128 -1
+	.byte	0x9f
+	.byte	0
+.LVUS22:
+	.uleb128 .LVU79
+	.uleb128 .LVU171
+	.uleb128 .LVU324
+	.uleb128 .LVU326
+	.uleb128 .LVU591
+	.uleb128 .LVU601
+	.uleb128 .LVU603
+	.uleb128 0
+.LLST22:
+	.byte	0x4
+	.uleb128 .LVL17-.Ltext0
+	.uleb128 .LVL27-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0x4
+	.uleb128 .LVL62-.Ltext0
+	.uleb128 .LVL63-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0x4
+	.uleb128 .LVL140-.Ltext0
+	.uleb128 .LVL143-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0x4
+	.uleb128 .LVL144-.Ltext0
+	.uleb128 .LFE38-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0
+.LVUS23:
+	.uleb128 .LVU79
+	.uleb128 .LVU171
+	.uleb128 .LVU324
+	.uleb128 .LVU326
+	.uleb128 .LVU591
+	.uleb128 .LVU601
+	.uleb128 .LVU603
+	.uleb128 0
+.LLST23:
+	.byte	0x4
+	.uleb128 .LVL17-.Ltext0
+	.uleb128 .LVL27-.Ltext0
+	.uleb128 0x4
+	.byte	0x91
+	.sleb128 -512
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL62-.Ltext0
+	.uleb128 .LVL63-.Ltext0
+	.uleb128 0x4
+	.byte	0x91
+	.sleb128 -512
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL140-.Ltext0
+	.uleb128 .LVL143-.Ltext0
+	.uleb128 0x4
+	.byte	0x91
+	.sleb128 -512
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL144-.Ltext0
+	.uleb128 .LFE38-.Ltext0
+	.uleb128 0x4
+	.byte	0x91
+	.sleb128 -512
+	.byte	0x9f
+	.byte	0
+.LVUS24:
+	.uleb128 .LVU143
+	.uleb128 .LVU256
+	.uleb128 .LVU536
+	.uleb128 .LVU538
+	.uleb128 .LVU561
+	.uleb128 .LVU575
+	.uleb128 .LVU580
+	.uleb128 .LVU591
+.LLST24:
+	.byte	0x4
+	.uleb128 .LVL26-.Ltext0
+	.uleb128 .LVL42-.Ltext0
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -608
+	.byte	0x4
+	.uleb128 .LVL121-.Ltext0
+	.uleb128 .LVL122-.Ltext0
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -608
+	.byte	0x4
+	.uleb128 .LVL127-.Ltext0
+	.uleb128 .LVL133-.Ltext0
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -608
+	.byte	0x4
+	.uleb128 .LVL135-.Ltext0
+	.uleb128 .LVL140-.Ltext0
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -608
+	.byte	0
+.LVUS25:
+	.uleb128 .LVU144
+	.uleb128 .LVU175
+.LLST25:
+	.byte	0x4
+	.uleb128 .LVL26-.Ltext0
+	.uleb128 .LVL28-1-.Ltext0
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -432
+	.byte	0
+.LVUS28:
+	.uleb128 .LVU258
+	.uleb128 .LVU270
+	.uleb128 .LVU540
+	.uleb128 .LVU552
+.LLST28:
+	.byte	0x4
+	.uleb128 .LVL43-.Ltext0
+	.uleb128 .LVL44-.Ltext0
+	.uleb128 0x1
+	.byte	0x5d
+	.byte	0x4
+	.uleb128 .LVL123-.Ltext0
+	.uleb128 .LVL124-.Ltext0
+	.uleb128 0x1
+	.byte	0x56
+	.byte	0
+.LVUS29:
+	.uleb128 .LVU258
+	.uleb128 .LVU270
+	.uleb128 .LVU540
+	.uleb128 .LVU552
+.LLST29:
+	.byte	0x4
+	.uleb128 .LVL43-.Ltext0
+	.uleb128 .LVL44-.Ltext0
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -584
+	.byte	0x4
+	.uleb128 .LVL123-.Ltext0
+	.uleb128 .LVL124-.Ltext0
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -584
+	.byte	0
+.LVUS30:
+	.uleb128 .LVU258
+	.uleb128 .LVU270
+	.uleb128 .LVU540
+	.uleb128 .LVU552
+.LLST30:
+	.byte	0x4
+	.uleb128 .LVL43-.Ltext0
+	.uleb128 .LVL44-.Ltext0
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -592
+	.byte	0x4
+	.uleb128 .LVL123-.Ltext0
+	.uleb128 .LVL124-.Ltext0
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -592
+	.byte	0
+.LVUS31:
+	.uleb128 .LVU258
+	.uleb128 .LVU270
+	.uleb128 .LVU540
+	.uleb128 .LVU552
+.LLST31:
+	.byte	0x4
+	.uleb128 .LVL43-.Ltext0
+	.uleb128 .LVL44-.Ltext0
+	.uleb128 0x1
+	.byte	0x59
+	.byte	0x4
+	.uleb128 .LVL123-.Ltext0
+	.uleb128 .LVL124-.Ltext0
+	.uleb128 0x1
+	.byte	0x59
+	.byte	0
+.LVUS32:
+	.uleb128 .LVU258
+	.uleb128 .LVU270
+	.uleb128 .LVU540
+	.uleb128 .LVU552
+.LLST32:
+	.byte	0x4
+	.uleb128 .LVL43-.Ltext0
+	.uleb128 .LVL44-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0x4
+	.uleb128 .LVL123-.Ltext0
+	.uleb128 .LVL124-.Ltext0
+	.uleb128 0x1
+	.byte	0x5f
+	.byte	0
+.LVUS58:
+	.uleb128 .LVU441
+	.uleb128 .LVU455
+	.uleb128 .LVU582
+	.uleb128 .LVU588
+.LLST58:
+	.byte	0x4
+	.uleb128 .LVL89-.Ltext0
+	.uleb128 .LVL96-.Ltext0
+	.uleb128 0x4
+	.byte	0x91
+	.sleb128 -512
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL135-.Ltext0
+	.uleb128 .LVL138-.Ltext0
+	.uleb128 0x4
+	.byte	0x91
+	.sleb128 -512
+	.byte	0x9f
+	.byte	0
+.LVUS59:
+	.uleb128 .LVU562
+	.uleb128 .LVU569
+.LLST59:
+	.byte	0x4
+	.uleb128 .LVL127-.Ltext0
+	.uleb128 .LVL131-.Ltext0
+	.uleb128 0x4
+	.byte	0x91
+	.sleb128 -512
+	.byte	0x9f
+	.byte	0
+.LVUS0:
+	.uleb128 0
+	.uleb128 .LVU28
+	.uleb128 .LVU28
+	.uleb128 .LVU48
+	.uleb128 .LVU48
+	.uleb128 .LVU55
+	.uleb128 .LVU55
+	.uleb128 0
+.LLST0:
+	.byte	0x4
+	.uleb128 .LVL0-.Ltext0
+	.uleb128 .LVL4-.Ltext0
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x4
+	.uleb128 .LVL4-.Ltext0
+	.uleb128 .LVL9-.Ltext0
+	.uleb128 0x2
+	.byte	0x70
+	.sleb128 4
+	.byte	0x4
+	.uleb128 .LVL9-.Ltext0
+	.uleb128 .LVL11-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL11-.Ltext0
+	.uleb128 .LFE34-.Ltext0
+	.uleb128 0x2
+	.byte	0x70
+	.sleb128 4
+	.byte	0
+.LVUS1:
+	.uleb128 0
+	.uleb128 .LVU36
+	.uleb128 .LVU36
+	.uleb128 .LVU55
+	.uleb128 .LVU55
+	.uleb128 0
+.LLST1:
+	.byte	0x4
+	.uleb128 .LVL0-.Ltext0
+	.uleb128 .LVL6-.Ltext0
+	.uleb128 0x1
+	.byte	0x51
+	.byte	0x4
+	.uleb128 .LVL6-.Ltext0
+	.uleb128 .LVL11-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x51
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL11-.Ltext0
+	.uleb128 .LFE34-.Ltext0
+	.uleb128 0x1
+	.byte	0x51
+	.byte	0
+.LVUS2:
+	.uleb128 0
+	.uleb128 .LVU10
+	.uleb128 .LVU10
+	.uleb128 .LVU29
+	.uleb128 .LVU29
+	.uleb128 0
+.LLST2:
+	.byte	0x4
+	.uleb128 .LVL0-.Ltext0
+	.uleb128 .LVL1-.Ltext0
+	.uleb128 0x1
+	.byte	0x52
+	.byte	0x4
+	.uleb128 .LVL1-.Ltext0
+	.uleb128 .LVL5-.Ltext0
+	.uleb128 0x1
+	.byte	0x5b
+	.byte	0x4
+	.uleb128 .LVL5-.Ltext0
+	.uleb128 .LFE34-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x52
+	.byte	0x9f
+	.byte	0
+.LVUS3:
+	.uleb128 0
+	.uleb128 .LVU40
+	.uleb128 .LVU40
+	.uleb128 .LVU55
+	.uleb128 .LVU55
+	.uleb128 0
+.LLST3:
+	.byte	0x4
+	.uleb128 .LVL0-.Ltext0
+	.uleb128 .LVL7-.Ltext0
+	.uleb128 0x1
+	.byte	0x58
+	.byte	0x4
+	.uleb128 .LVL7-.Ltext0
+	.uleb128 .LVL11-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x58
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL11-.Ltext0
+	.uleb128 .LFE34-.Ltext0
+	.uleb128 0x1
+	.byte	0x58
+	.byte	0
+.LVUS4:
+	.uleb128 .LVU10
+	.uleb128 .LVU43
+	.uleb128 .LVU43
+	.uleb128 .LVU55
+	.uleb128 .LVU55
+	.uleb128 0
+.LLST4:
+	.byte	0x4
+	.uleb128 .LVL1-.Ltext0
+	.uleb128 .LVL8-.Ltext0
+	.uleb128 0x1
+	.byte	0x52
+	.byte	0x4
+	.uleb128 .LVL8-.Ltext0
+	.uleb128 .LVL11-.Ltext0
+	.uleb128 0x3
+	.byte	0x72
+	.sleb128 -1
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL11-.Ltext0
+	.uleb128 .LFE34-.Ltext0
+	.uleb128 0x1
+	.byte	0x52
+	.byte	0
+.LVUS5:
+	.uleb128 .LVU14
+	.uleb128 .LVU54
+	.uleb128 .LVU55
+	.uleb128 0
+.LLST5:
+	.byte	0x4
+	.uleb128 .LVL2-.Ltext0
+	.uleb128 .LVL10-.Ltext0
+	.uleb128 0x1
+	.byte	0x56
+	.byte	0x4
+	.uleb128 .LVL11-.Ltext0
+	.uleb128 .LFE34-.Ltext0
+	.uleb128 0x1
+	.byte	0x56
+	.byte	0
+.LVUS6:
+	.uleb128 .LVU17
+	.uleb128 .LVU48
+	.uleb128 .LVU55
+	.uleb128 0
+.LLST6:
+	.byte	0x4
+	.uleb128 .LVL3-.Ltext0
+	.uleb128 .LVL9-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL11-.Ltext0
+	.uleb128 .LFE34-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0
+.LVUS7:
+	.uleb128 .LVU18
+	.uleb128 0
+.LLST7:
+	.byte	0x4
+	.uleb128 .LVL3-.Ltext0
+	.uleb128 .LFE34-.Ltext0
+	.uleb128 0x1
+	.byte	0x5a
+	.byte	0
+.Ldebug_loc3:
+	.section	.debug_aranges,"",@progbits
+	.long	0x2c
+	.value	0x2
+	.long	.Ldebug_info0
+	.byte	0x8
+	.byte	0
+	.value	0
+	.value	0
+	.quad	.Ltext0
+	.quad	.Letext0-.Ltext0
+	.quad	0
+	.quad	0
+	.section	.debug_rnglists,"",@progbits
+.Ldebug_ranges0:
+	.long	.Ldebug_ranges3-.Ldebug_ranges2
+.Ldebug_ranges2:
+	.value	0x5
+	.byte	0x8
+	.byte	0
+	.long	0
+.LLRL21:
+	.byte	0x4
+	.uleb128 .LBB31-.Ltext0
+	.uleb128 .LBE31-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB40-.Ltext0
+	.uleb128 .LBE40-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB41-.Ltext0
+	.uleb128 .LBE41-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB42-.Ltext0
+	.uleb128 .LBE42-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB43-.Ltext0
+	.uleb128 .LBE43-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB100-.Ltext0
+	.uleb128 .LBE100-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB112-.Ltext0
+	.uleb128 .LBE112-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB113-.Ltext0
+	.uleb128 .LBE113-.Ltext0
+	.byte	0
+.LLRL27:
+	.byte	0x4
+	.uleb128 .LBB45-.Ltext0
+	.uleb128 .LBE45-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB52-.Ltext0
+	.uleb128 .LBE52-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB53-.Ltext0
+	.uleb128 .LBE53-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB106-.Ltext0
+	.uleb128 .LBE106-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB107-.Ltext0
+	.uleb128 .LBE107-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB108-.Ltext0
+	.uleb128 .LBE108-.Ltext0
+	.byte	0
+.LLRL33:
+	.byte	0x4
+	.uleb128 .LBB54-.Ltext0
+	.uleb128 .LBE54-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB99-.Ltext0
+	.uleb128 .LBE99-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB101-.Ltext0
+	.uleb128 .LBE101-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB105-.Ltext0
+	.uleb128 .LBE105-.Ltext0
+	.byte	0
+.LLRL34:
+	.byte	0x4
+	.uleb128 .LBB55-.Ltext0
+	.uleb128 .LBE55-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB56-.Ltext0
+	.uleb128 .LBE56-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB69-.Ltext0
+	.uleb128 .LBE69-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB71-.Ltext0
+	.uleb128 .LBE71-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB98-.Ltext0
+	.uleb128 .LBE98-.Ltext0
+	.byte	0
+.LLRL39:
+	.byte	0x4
+	.uleb128 .LBB57-.Ltext0
+	.uleb128 .LBE57-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB65-.Ltext0
+	.uleb128 .LBE65-.Ltext0
+	.byte	0
+.LLRL40:
+	.byte	0x4
+	.uleb128 .LBB58-.Ltext0
+	.uleb128 .LBE58-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB59-.Ltext0
+	.uleb128 .LBE59-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB60-.Ltext0
+	.uleb128 .LBE60-.Ltext0
+	.byte	0
+.LLRL42:
+	.byte	0x4
+	.uleb128 .LBB61-.Ltext0
+	.uleb128 .LBE61-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB64-.Ltext0
+	.uleb128 .LBE64-.Ltext0
+	.byte	0
+.LLRL44:
+	.byte	0x4
+	.uleb128 .LBB66-.Ltext0
+	.uleb128 .LBE66-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB70-.Ltext0
+	.uleb128 .LBE70-.Ltext0
+	.byte	0
+.LLRL48:
+	.byte	0x4
+	.uleb128 .LBB72-.Ltext0
+	.uleb128 .LBE72-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB95-.Ltext0
+	.uleb128 .LBE95-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB96-.Ltext0
+	.uleb128 .LBE96-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB97-.Ltext0
+	.uleb128 .LBE97-.Ltext0
+	.byte	0
+.LLRL51:
+	.byte	0x4
+	.uleb128 .LBB73-.Ltext0
+	.uleb128 .LBE73-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB85-.Ltext0
+	.uleb128 .LBE85-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB86-.Ltext0
+	.uleb128 .LBE86-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB87-.Ltext0
+	.uleb128 .LBE87-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB88-.Ltext0
+	.uleb128 .LBE88-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB89-.Ltext0
+	.uleb128 .LBE89-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB90-.Ltext0
+	.uleb128 .LBE90-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB91-.Ltext0
+	.uleb128 .LBE91-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB92-.Ltext0
+	.uleb128 .LBE92-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB93-.Ltext0
+	.uleb128 .LBE93-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB94-.Ltext0
+	.uleb128 .LBE94-.Ltext0
+	.byte	0
+.LLRL57:
+	.byte	0x4
+	.uleb128 .LBB102-.Ltext0
+	.uleb128 .LBE102-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB111-.Ltext0
+	.uleb128 .LBE111-.Ltext0
+	.byte	0
+.Ldebug_ranges3:
+	.section	.debug_line,"",@progbits
+.Ldebug_line0:
+	.section	.debug_str,"MS",@progbits,1
+.LASF187:
+	.string	"IORING_REGISTER_EVENTFD_ASYNC"
+.LASF58:
+	.string	"chunk"
+.LASF9:
+	.string	"size_t"
+.LASF56:
+	.string	"engine"
+.LASF229:
+	.string	"munmap"
+.LASF160:
+	.string	"tail"
+.LASF109:
+	.string	"IORING_OP_FSYNC"
+.LASF52:
+	.string	"_IO_codecvt"
+.LASF145:
+	.string	"IORING_OP_LINKAT"
+.LASF32:
+	.string	"_IO_save_end"
+.LASF73:
+	.string	"splice_off_in"
+.LASF65:
+	.string	"__u16"
+.LASF237:
+	.string	"blake2s_file_async"
+.LASF193:
+	.string	"IORING_REGISTER_FILES2"
+.LASF156:
+	.string	"io_uring_cqe"
+.LASF64:
+	.string	"__u8"
+.LASF140:
+	.string	"IORING_OP_SHUTDOWN"
+.LASF84:
+	.string	"statx_flags"
+.LASF25:
+	.string	"_IO_write_base"
+.LASF91:
+	.string	"msg_ring_flags"
+.LASF148:
+	.string	"IORING_OP_SETXATTR"
+.LASF195:
+	.string	"IORING_REGISTER_BUFFERS2"
+.LASF141:
+	.string	"IORING_OP_RENAMEAT"
+.LASF176:
+	.string	"wq_fd"
+.LASF41:
+	.string	"_lock"
+.LASF208:
+	.string	"iov_base"
+.LASF131:
+	.string	"IORING_OP_MADVISE"
+.LASF30:
+	.string	"_IO_save_base"
+.LASF144:
+	.string	"IORING_OP_SYMLINKAT"
+.LASF220:
+	.string	"sq_len"
+.LASF125:
+	.string	"IORING_OP_CLOSE"
+.LASF167:
+	.string	"io_cqring_offsets"
+.LASF34:
+	.string	"_chain"
+.LASF67:
+	.string	"__u32"
+.LASF38:
+	.string	"_cur_column"
+.LASF69:
+	.string	"cmd_op"
+.LASF198:
+	.string	"IORING_UNREGISTER_IOWQ_AFF"
+.LASF10:
+	.string	"__uint8_t"
+.LASF108:
+	.string	"IORING_OP_WRITEV"
+.LASF199:
+	.string	"IORING_REGISTER_IOWQ_MAX_WORKERS"
+.LASF132:
+	.string	"IORING_OP_SEND"
+.LASF86:
+	.string	"splice_flags"
+.LASF82:
+	.string	"cancel_flags"
+.LASF3:
+	.string	"long int"
+.LASF234:
+	.string	"syscall"
+.LASF177:
+	.string	"resv"
+.LASF51:
+	.string	"_IO_marker"
+.LASF253:
+	.string	"entries"
+.LASF79:
+	.string	"msg_flags"
+.LASF124:
+	.string	"IORING_OP_OPENAT"
+.LASF190:
+	.string	"IORING_UNREGISTER_PERSONALITY"
+.LASF159:
+	.string	"head"
+.LASF113:
+	.string	"IORING_OP_POLL_REMOVE"
+.LASF155:
+	.string	"IORING_OP_LAST"
+.LASF143:
+	.string	"IORING_OP_MKDIRAT"
+.LASF8:
+	.string	"signed char"
+.LASF18:
+	.string	"uint8_t"
+.LASF54:
+	.string	"_IO_FILE"
+.LASF53:
+	.string	"_IO_wide_data"
+.LASF68:
+	.string	"__u64"
+.LASF197:
+	.string	"IORING_REGISTER_IOWQ_AFF"
+.LASF78:
+	.string	"sync_range_flags"
+.LASF5:
+	.string	"unsigned char"
+.LASF241:
+	.string	"nchunks"
+.LASF45:
+	.string	"_freeres_list"
+.LASF224:
+	.string	"direct"
+.LASF126:
+	.string	"IORING_OP_FILES_UPDATE"
+.LASF95:
+	.string	"addr_len"
+.LASF134:
+	.string	"IORING_OP_OPENAT2"
+.LASF90:
+	.string	"xattr_flags"
+.LASF221:
+	.string	"cq_len"
+.LASF16:
+	.string	"char"
+.LASF214:
+	.string	"cq_head"
+.LASF101:
+	.string	"io_uring_sqe"
+.LASF251:
+	.string	"bring_close"
+.LASF255:
+	.string	"_IO_lock_t"
+.LASF137:
+	.string	"IORING_OP_PROVIDE_BUFFERS"
+.LASF182:
+	.string	"IORING_REGISTER_FILES"
+.LASF258:
+	.string	"__errno_location"
+.LASF227:
+	.string	"blake2s_file_ex"
+.LASF57:
+	.string	"flags"
+.LASF22:
+	.string	"_IO_read_ptr"
+.LASF83:
+	.string	"open_flags"
+.LASF244:
+	.string	"depth"
+.LASF257:
+	.string	"io_uring_op"
+.LASF203:
+	.string	"IORING_UNREGISTER_PBUF_RING"
+.LASF235:
+	.string	"posix_memalign"
+.LASF165:
+	.string	"resv1"
+.LASF166:
+	.string	"resv2"
+.LASF250:
+	.string	"bring_next"
+.LASF181:
+	.string	"IORING_UNREGISTER_BUFFERS"
+.LASF230:
+	.string	"mmap"
+.LASF236:
+	.string	"stream"
+.LASF175:
+	.string	"features"
+.LASF111:
+	.string	"IORING_OP_WRITE_FIXED"
+.LASF194:
+	.string	"IORING_REGISTER_FILES_UPDATE2"
+.LASF33:
+	.string	"_markers"
+.LASF219:
+	.string	"cq_map"
+.LASF164:
+	.string	"array"
+.LASF252:
+	.string	"bring_setup"
+.LASF205:
+	.string	"IORING_REGISTER_FILE_ALLOC_RANGE"
+.LASF246:
+	.string	"fixed"
+.LASF92:
+	.string	"uring_cmd_flags"
+.LASF233:
+	.string	"blake2s_update"
+.LASF81:
+	.string	"accept_flags"
+.LASF153:
+	.string	"IORING_OP_SEND_ZC"
+.LASF173:
+	.string	"sq_thread_cpu"
+.LASF93:
+	.string	"buf_index"
+.LASF178:
+	.string	"sq_off"
+.LASF42:
+	.string	"_offset"
+.LASF191:
+	.string	"IORING_REGISTER_RESTRICTIONS"
+.LASF238:
+	.string	"blake2s_uring_run"
+.LASF13:
+	.string	"__uint64_t"
+.LASF116:
+	.string	"IORING_OP_RECVMSG"
+.LASF2:
+	.string	"long unsigned int"
+.LASF112:
+	.string	"IORING_OP_POLL_ADD"
+.LASF174:
+	.string	"sq_thread_idle"
+.LASF36:
+	.string	"_flags2"
+.LASF183:
+	.string	"IORING_UNREGISTER_FILES"
+.LASF128:
+	.string	"IORING_OP_READ"
+.LASF120:
+	.string	"IORING_OP_ASYNC_CANCEL"
+.LASF24:
+	.string	"_IO_read_base"
+.LASF94:
+	.string	"buf_group"
+.LASF49:
+	.string	"_unused2"
+.LASF152:
+	.string	"IORING_OP_URING_CMD"
+.LASF222:
+	.string	"sqe_len"
+.LASF37:
+	.string	"_old_offset"
+.LASF184:
+	.string	"IORING_REGISTER_EVENTFD"
+.LASF75:
+	.string	"fsync_flags"
+.LASF171:
+	.string	"sq_entries"
+.LASF158:
+	.string	"io_sqring_offsets"
+.LASF12:
+	.string	"__uint32_t"
+.LASF4:
+	.string	"long long int"
+.LASF133:
+	.string	"IORING_OP_RECV"
+.LASF149:
+	.string	"IORING_OP_FGETXATTR"
+.LASF168:
+	.string	"overflow"
+.LASF207:
+	.string	"iovec"
+.LASF87:
+	.string	"rename_flags"
+.LASF27:
+	.string	"_IO_write_end"
+.LASF76:
+	.string	"poll_events"
+.LASF228:
+	.string	"close"
+.LASF249:
+	.string	"bring_enter"
+.LASF74:
+	.string	"rw_flags"
+.LASF169:
+	.string	"cqes"
+.LASF114:
+	.string	"IORING_OP_SYNC_FILE_RANGE"
+.LASF72:
+	.string	"addr"
+.LASF136:
+	.string	"IORING_OP_SPLICE"
+.LASF28:
+	.string	"_IO_buf_base"
+.LASF7:
+	.string	"unsigned int"
+.LASF60:
+	.string	"digest_len"
+.LASF70:
+	.string	"__pad1"
+.LASF100:
+	.string	"__pad2"
+.LASF96:
+	.string	"__pad3"
+.LASF47:
+	.string	"__pad5"
+.LASF259:
+	.string	"bring_read"
+.LASF216:
+	.string	"cq_mask"
+.LASF248:
+	.string	"bring_reap"
+.LASF122:
+	.string	"IORING_OP_CONNECT"
+.LASF196:
+	.string	"IORING_REGISTER_BUFFERS_UPDATE"
+.LASF209:
+	.string	"iov_len"
+.LASF21:
+	.string	"_flags"
+.LASF243:
+	.string	"done"
+.LASF48:
+	.string	"_mode"
+.LASF217:
+	.string	"sqes"
+.LASF247:
+	.string	"again"
+.LASF43:
+	.string	"_codecvt"
+.LASF63:
+	.string	"blake2s_sigma"
+.LASF151:
+	.string	"IORING_OP_SOCKET"
+.LASF117:
+	.string	"IORING_OP_TIMEOUT"
+.LASF200:
+	.string	"IORING_REGISTER_RING_FDS"
+.LASF202:
+	.string	"IORING_REGISTER_PBUF_RING"
+.LASF50:
+	.string	"FILE"
+.LASF157:
+	.string	"big_cqe"
+.LASF115:
+	.string	"IORING_OP_SENDMSG"
+.LASF206:
+	.string	"IORING_REGISTER_LAST"
+.LASF88:
+	.string	"unlink_flags"
+.LASF55:
+	.string	"blake2s_io"
+.LASF142:
+	.string	"IORING_OP_UNLINKAT"
+.LASF62:
+	.string	"blake2s_iv"
+.LASF89:
+	.string	"hardlink_flags"
+.LASF239:
+	.string	"size"
+.LASF172:
+	.string	"cq_entries"
+.LASF17:
+	.string	"long long unsigned int"
+.LASF102:
+	.string	"opcode"
+.LASF14:
+	.string	"__off_t"
+.LASF212:
+	.string	"sq_mask"
+.LASF226:
+	.string	"want"
+.LASF123:
+	.string	"IORING_OP_FALLOCATE"
+.LASF66:
+	.string	"__s32"
+.LASF46:
+	.string	"_freeres_buf"
+.LASF121:
+	.string	"IORING_OP_LINK_TIMEOUT"
+.LASF223:
+	.string	"queued"
+.LASF146:
+	.string	"IORING_OP_MSG_RING"
+.LASF130:
+	.string	"IORING_OP_FADVISE"
+.LASF231:
+	.string	"memset"
+.LASF31:
+	.string	"_IO_backup_base"
+.LASF40:
+	.string	"_shortbuf"
+.LASF154:
+	.string	"IORING_OP_SENDMSG_ZC"
+.LASF97:
+	.string	"splice_fd_in"
+.LASF77:
+	.string	"poll32_events"
+.LASF15:
+	.string	"__off64_t"
+.LASF170:
+	.string	"io_uring_params"
+.LASF61:
+	.string	"last_node"
+.LASF98:
+	.string	"file_index"
+.LASF188:
+	.string	"IORING_REGISTER_PROBE"
+.LASF147:
+	.string	"IORING_OP_FSETXATTR"
+.LASF150:
+	.string	"IORING_OP_GETXATTR"
+.LASF29:
+	.string	"_IO_buf_end"
+.LASF210:
+	.string	"bring"
+.LASF215:
+	.string	"cq_tail"
+.LASF245:
+	.string	"inflight"
+.LASF162:
+	.string	"ring_entries"
+.LASF85:
+	.string	"fadvise_advice"
+.LASF218:
+	.string	"sq_map"
+.LASF139:
+	.string	"IORING_OP_TEE"
+.LASF192:
+	.string	"IORING_REGISTER_ENABLE_RINGS"
+.LASF161:
+	.string	"ring_mask"
+.LASF11:
+	.string	"short int"
+.LASF20:
+	.string	"uint64_t"
+.LASF39:
+	.string	"_vtable_offset"
+.LASF135:
+	.string	"IORING_OP_EPOLL_CTL"
+.LASF103:
+	.string	"ioprio"
+.LASF163:
+	.string	"dropped"
+.LASF105:
+	.string	"personality"
+.LASF129:
+	.string	"IORING_OP_WRITE"
+.LASF201:
+	.string	"IORING_UNREGISTER_RING_FDS"
+.LASF80:
+	.string	"timeout_flags"
+.LASF127:
+	.string	"IORING_OP_STATX"
+.LASF138:
+	.string	"IORING_OP_REMOVE_BUFFERS"
+.LASF118:
+	.string	"IORING_OP_TIMEOUT_REMOVE"
+.LASF23:
+	.string	"_IO_read_end"
+.LASF180:
+	.string	"IORING_REGISTER_BUFFERS"
+.LASF179:
+	.string	"cq_off"
+.LASF19:
+	.string	"uint32_t"
+.LASF35:
+	.string	"_fileno"
+.LASF186:
+	.string	"IORING_REGISTER_FILES_UPDATE"
+.LASF254:
+	.string	"GNU C99 12.2.0 -mtune=generic -march=x86-64 -g -O3 -std=c99 -fasynchronous-unwind-tables"
+.LASF213:
+	.string	"sq_array"
+.LASF211:
+	.string	"sq_tail"
+.LASF44:
+	.string	"_wide_data"
+.LASF232:
+	.string	"free"
+.LASF59:
+	.string	"buf_len"
+.LASF256:
+	.string	"blake2s_ctx"
+.LASF185:
+	.string	"IORING_UNREGISTER_EVENTFD"
+.LASF6:
+	.string	"short unsigned int"
+.LASF106:
+	.string	"IORING_OP_NOP"
+.LASF107:
+	.string	"IORING_OP_READV"
+.LASF240:
+	.string	"slot"
+.LASF104:
+	.string	"user_data"
+.LASF26:
+	.string	"_IO_write_ptr"
+.LASF119:
+	.string	"IORING_OP_ACCEPT"
+.LASF204:
+	.string	"IORING_REGISTER_SYNC_CANCEL"
+.LASF225:
+	.string	"bring_slot"
+.LASF110:
+	.string	"IORING_OP_READ_FIXED"
+.LASF71:
+	.string	"addr2"
+.LASF99:
+	.string	"addr3"
+.LASF242:
+	.string	"next"
+.LASF189:
+	.string	"IORING_REGISTER_PERSONALITY"
+	.section	.debug_line_str,"MS",@progbits,1
+.LASF1:
+	.string	"/root/repo"
+.LASF0:
+	.string	"blake2s-uring.c"
+	.ident	"GCC: (Debian 12.2.0-14+deb12u1) 12.2.0"
+	.section	.note.GNU-stack,"",@progbits
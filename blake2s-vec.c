@@ -0,0 +1,136 @@
+#include "blake2s.h"
+#include "blake2s-internal.h"
+
+/* Portable vector kernel: the row layout of blake2s-altivec.c written
+ * with GCC/Clang generic vector types, for the compiler to lower to
+ * whatever SIMD the target has (SSE2, NEON, VSX, ...).
+ */
+#ifdef __GNUC__
+
+typedef u32 vu32 __attribute__((vector_size(16)));
+
+/* vshuf(x, a,b,c,d): pick words (x[a] x[b] x[c] x[d]) */
+#if defined(__clang__)
+#define vshuf(x,a,b,c,d) __builtin_shufflevector(x, x, a, b, c, d)
+#else
+#define vshuf(x,a,b,c,d) __builtin_shuffle(x, (vu32){a, b, c, d})
+#endif
+
+static const vu32 blake2s_viv[2] = {
+    { 0x6a09e667, 0xbb67ae85, 0x3c6ef372, 0xa54ff53a },
+    { 0x510e527f, 0x9b05688c, 0x1f83d9ab, 0x5be0cd19 },
+};
+
+static inline vu32 vload(const u32 *p)
+{
+    vu32 v;
+    memcpy(&v, p, sizeof(v));
+    return v;
+}
+
+static inline void vstore(u32 *p, vu32 v)
+{
+    memcpy(p, &v, sizeof(v));
+}
+
+static inline void blake2s_10rounds(vu32 va, vu32 vb, vu32 vc, vu32 vd,
+                                    vu32 H[2], const void *msg)
+{
+    u32 m[16];
+    vu32 m1, m2, m3, m4;
+    for (unsigned i = 0; i < 16; i++)
+        m[i] = read_le32((const u8 *)msg + i*4);
+
+#define ror(l,v) (((v) >> (l)) | ((v) << (32 - (l))))
+
+#define BLAKE2S_VG(M,N,a,b,c,d) \
+    do { \
+        (a) += (b) + (M);           \
+        (d)  = ror(16, (d) ^ (a));  \
+        (c) += (d);                 \
+        (b)  = ror(12, (b) ^ (c));  \
+        (a) += (b) + (N);           \
+        (d)  = ror( 8, (d) ^ (a));  \
+        (c) += (d);                 \
+        (b)  = ror( 7, (b) ^ (c));  \
+    } while (0)
+
+#define Si(i,j) blake2s_sigma[(i)][(j)]
+#define MSG(r,a,b,c,d) (vu32){ m[Si(r,a)], m[Si(r,b)], m[Si(r,c)], m[Si(r,d)] }
+
+    /* vshuf(x, 1,2,3,0) is vec_sld(x, x, 4) */
+#define FULLROUND(r) \
+    do { \
+        m1 = MSG(r,  0,  2,  4,  6); \
+        m2 = MSG(r,  1,  3,  5,  7); \
+        m3 = MSG(r,  8, 10, 12, 14); \
+        m4 = MSG(r,  9, 11, 13, 15); \
+        \
+        /* First half:  apply G() on rows */ \
+        BLAKE2S_VG(m1,m2,va,vb,vc,vd); \
+        \
+        /* Second half: apply G() on diagonals */ \
+        vb = vshuf(vb, 1, 2, 3, 0); \
+        vc = vshuf(vc, 2, 3, 0, 1); \
+        vd = vshuf(vd, 3, 0, 1, 2); \
+        BLAKE2S_VG(m3,m4,va,vb,vc,vd); \
+        vb = vshuf(vb, 3, 0, 1, 2); \
+        vc = vshuf(vc, 2, 3, 0, 1); \
+        vd = vshuf(vd, 1, 2, 3, 0); \
+    } while (0)
+
+    /* 10 rounds times 2 applications of G */
+    FULLROUND(0);
+    FULLROUND(1);
+    FULLROUND(2);
+    FULLROUND(3);
+    FULLROUND(4);
+    FULLROUND(5);
+    FULLROUND(6);
+    FULLROUND(7);
+    FULLROUND(8);
+    FULLROUND(9);
+
+    H[0] ^= va ^ vc;
+    H[1] ^= vb ^ vd;
+}
+
+void blake2s_compress_vec(struct blake2s_ctx *ctx, const void *m)
+{
+    vu32 H[2];
+    vu32 vpr;
+    H[0] = vload(ctx->H + 0);
+    H[1] = vload(ctx->H + 4);
+    vpr  = (vu32){ ctx->t[0], ctx->t[1], ctx->f[0], ctx->f[1] };
+
+    blake2s_10rounds(H[0], H[1], blake2s_viv[0], blake2s_viv[1] ^ vpr,
+                     H, m);
+
+    vstore(ctx->H + 0, H[0]);
+    vstore(ctx->H + 4, H[1]);
+}
+
+void blake2s_compress_blocks_vec(struct blake2s_ctx *ctx, const void *m,
+                                 size_t nblocks)
+{
+    const u8 *msg = m;
+    vu32 H[2];
+    u32 t0 = ctx->t[0], t1 = ctx->t[1];
+    H[0] = vload(ctx->H + 0);
+    H[1] = vload(ctx->H + 4);
+
+    for (; nblocks; nblocks--, msg += BLAKE2S_BLOCK) {
+        t0 += BLAKE2S_BLOCK;
+        t1 += (t0 < BLAKE2S_BLOCK);
+        blake2s_10rounds(H[0], H[1], blake2s_viv[0],
+                         blake2s_viv[1] ^ (vu32){ t0, t1, ctx->f[0], ctx->f[1] },
+                         H, msg);
+    }
+
+    vstore(ctx->H + 0, H[0]);
+    vstore(ctx->H + 4, H[1]);
+    ctx->t[0] = t0;
+    ctx->t[1] = t1;
+}
+
+#endif /* __GNUC__ */
@@ -0,0 +1,7116 @@
+	.file	"blake2s-vec.c"
+# GNU C99 (Debian 12.2.0-14+deb12u1) version 12.2.0 (x86_64-linux-gnu)
+#	compiled by GNU C version 12.2.0, GMP version 6.2.1, MPFR version 4.2.0, MPC version 1.3.1, isl version isl-0.25-GMP
+
+# GGC heuristics: --param ggc-min-expand=100 --param ggc-min-heapsize=131072
+# options passed: -mtune=generic -march=x86-64 -g -O3 -std=c99 -fasynchronous-unwind-tables
+	.text
+.Ltext0:
+	.file 0 "/root/repo" "blake2s-vec.c"
+	.p2align 4
+	.type	blake2s_10rounds.constprop.0, @function
+blake2s_10rounds.constprop.0:
+.LVL0:
+.LFB22:
+	.file 1 "blake2s-vec.c"
+	.loc 1 36 20 view -0
+	.cfi_startproc
+.LBB47:
+	.loc 1 41 28 view .LVU1
+	.loc 1 41 28 is_stmt 0 view .LVU2
+.LBE47:
+	.loc 1 83 5 is_stmt 1 view .LVU3
+.LBB48:
+	.loc 1 83 10 view .LVU4
+.LBE48:
+.LBB49:
+# blake2s-vec.c:42:         m[i] = read_le32((const u8 *)msg + i*4);
+	.loc 1 42 14 is_stmt 0 view .LVU5
+	movdqu	(%rsi), %xmm7	# MEM <char[1:64]> [(void *)msg_4(D)], tmp735
+	movd	(%rsi), %xmm11	# MEM <char[1:64]> [(void *)msg_4(D)], tmp721
+.LBE49:
+# blake2s-vec.c:36: static inline void blake2s_10rounds(vu32 va, vu32 vb, vu32 vc, vu32 vd,
+	.loc 1 36 20 view .LVU6
+	movq	%rdi, %r9	# tmp732, H
+.LBB50:
+# blake2s-vec.c:42:         m[i] = read_le32((const u8 *)msg + i*4);
+	.loc 1 42 14 view .LVU7
+	movd	16(%rsi), %xmm6	# MEM <char[1:64]> [(void *)msg_4(D)], tmp723
+	movd	32(%rsi), %xmm12	# MEM <char[1:64]> [(void *)msg_4(D)], tmp725
+	movaps	%xmm7, -72(%rsp)	# tmp735, MEM <char[1:64]> [(void *)&m]
+	movdqu	16(%rsi), %xmm7	# MEM <char[1:64]> [(void *)msg_4(D)], tmp736
+.LBE50:
+.LBB51:
+# blake2s-vec.c:83:     FULLROUND(0);
+	.loc 1 83 52 view .LVU8
+	movd	-64(%rsp), %xmm3	# m[2], _9
+# blake2s-vec.c:83:     FULLROUND(0);
+	.loc 1 83 13 view .LVU9
+	movdqa	%xmm11, %xmm14	# tmp721, tmp496
+	movdqa	%xmm6, %xmm15	# tmp723, tmp495
+# blake2s-vec.c:83:     FULLROUND(0);
+	.loc 1 83 151 view .LVU10
+	movd	-68(%rsp), %xmm9	# m[1], _13
+.LBE51:
+.LBB52:
+# blake2s-vec.c:42:         m[i] = read_le32((const u8 *)msg + i*4);
+	.loc 1 42 14 view .LVU11
+	movaps	%xmm7, -56(%rsp)	# tmp736, MEM <char[1:64]> [(void *)&m]
+.LBE52:
+.LBB53:
+# blake2s-vec.c:83:     FULLROUND(0);
+	.loc 1 83 108 view .LVU12
+	movd	-48(%rsp), %xmm4	# m[6], _11
+.LVL1:
+	.loc 1 83 137 is_stmt 1 view .LVU13
+	.loc 1 83 264 view .LVU14
+# blake2s-vec.c:83:     FULLROUND(0);
+	.loc 1 83 13 is_stmt 0 view .LVU15
+	punpckldq	%xmm3, %xmm14	# _9, tmp496
+# blake2s-vec.c:83:     FULLROUND(0);
+	.loc 1 83 140 view .LVU16
+	movd	-44(%rsp), %xmm8	# m[7], tmp999
+	movd	-52(%rsp), %xmm13	# m[5], tmp501
+.LBE53:
+.LBB54:
+# blake2s-vec.c:42:         m[i] = read_le32((const u8 *)msg + i*4);
+	.loc 1 42 14 view .LVU17
+	movdqu	32(%rsi), %xmm7	# MEM <char[1:64]> [(void *)msg_4(D)], tmp737
+.LBE54:
+.LBB55:
+# blake2s-vec.c:83:     FULLROUND(0);
+	.loc 1 83 13 view .LVU18
+	punpckldq	%xmm4, %xmm15	# _11, tmp495
+	punpcklqdq	%xmm15, %xmm14	# tmp495, m1
+# blake2s-vec.c:83:     FULLROUND(0);
+	.loc 1 83 140 view .LVU19
+	punpckldq	%xmm8, %xmm13	# tmp999, tmp501
+.LBE55:
+.LBB56:
+# blake2s-vec.c:42:         m[i] = read_le32((const u8 *)msg + i*4);
+	.loc 1 42 14 view .LVU20
+	movaps	%xmm7, -40(%rsp)	# tmp737, MEM <char[1:64]> [(void *)&m]
+	movdqu	48(%rsi), %xmm7	# MEM <char[1:64]> [(void *)msg_4(D)], tmp738
+	paddd	%xmm14, %xmm0	# m1, _461
+.LVL2:
+	.loc 1 42 14 view .LVU21
+.LBE56:
+.LBB57:
+# blake2s-vec.c:83:     FULLROUND(0);
+	.loc 1 83 140 view .LVU22
+	movq	%xmm13, %rax	# tmp501, tmp501
+	movd	-60(%rsp), %xmm13	# m[3], tmp746
+# blake2s-vec.c:83:     FULLROUND(0);
+	.loc 1 83 408 view .LVU23
+	movd	-36(%rsp), %xmm10	# m[9], _23
+# blake2s-vec.c:83:     FULLROUND(0);
+	.loc 1 83 534 view .LVU24
+	paddd	%xmm1, %xmm0	# vb, va
+.LBE57:
+.LBB58:
+# blake2s-vec.c:42:         m[i] = read_le32((const u8 *)msg + i*4);
+	.loc 1 42 14 view .LVU25
+	movaps	%xmm7, -24(%rsp)	# tmp738, MEM <char[1:64]> [(void *)&m]
+	movd	-24(%rsp), %xmm7	# MEM <char[1:64]> [(void *)&m], tmp727
+.LVL3:
+	.loc 1 42 14 view .LVU26
+.LBE58:
+.LBB59:
+	.loc 1 83 394 is_stmt 1 view .LVU27
+# blake2s-vec.c:83:     FULLROUND(0);
+	.loc 1 83 267 is_stmt 0 view .LVU28
+	movd	-16(%rsp), %xmm8	# m[14], tmp998
+# blake2s-vec.c:83:     FULLROUND(0);
+	.loc 1 83 565 view .LVU29
+	pxor	%xmm0, %xmm2	# va, _33
+.LVL4:
+# blake2s-vec.c:83:     FULLROUND(0);
+	.loc 1 83 436 view .LVU30
+	movd	-28(%rsp), %xmm5	# m[11], _24
+.LVL5:
+	.loc 1 83 524 is_stmt 1 view .LVU31
+	.loc 1 83 529 view .LVU32
+	.loc 1 83 550 view .LVU33
+# blake2s-vec.c:83:     FULLROUND(0);
+	.loc 1 83 555 is_stmt 0 view .LVU34
+	movdqa	%xmm2, %xmm14	# _33, tmp497
+	psrld	$16, %xmm2	#, vd
+	pslld	$16, %xmm14	#, tmp497
+	por	%xmm14, %xmm2	# tmp497, vd
+.LVL6:
+	.loc 1 83 617 is_stmt 1 view .LVU35
+# blake2s-vec.c:83:     FULLROUND(0);
+	.loc 1 83 622 is_stmt 0 view .LVU36
+	movdqa	.LC0(%rip), %xmm14	#, vc
+	paddd	%xmm2, %xmm14	# vd, vc
+.LVL7:
+	.loc 1 83 631 is_stmt 1 view .LVU37
+# blake2s-vec.c:83:     FULLROUND(0);
+	.loc 1 83 646 is_stmt 0 view .LVU38
+	pxor	%xmm14, %xmm1	# vc, _36
+.LVL8:
+# blake2s-vec.c:83:     FULLROUND(0);
+	.loc 1 83 636 view .LVU39
+	movdqa	%xmm1, %xmm15	# _36, tmp499
+	pslld	$20, %xmm1	#, vb
+	psrld	$12, %xmm15	#, tmp499
+	por	%xmm15, %xmm1	# tmp499, vb
+.LVL9:
+	.loc 1 83 698 is_stmt 1 view .LVU40
+# blake2s-vec.c:83:     FULLROUND(0);
+	.loc 1 83 140 is_stmt 0 view .LVU41
+	movdqa	%xmm9, %xmm15	# _13, tmp502
+	punpckldq	%xmm13, %xmm15	# tmp746, tmp502
+	movq	%rax, %xmm13	# tmp501, tmp501
+	punpcklqdq	%xmm13, %xmm15	# tmp501, m2
+# blake2s-vec.c:83:     FULLROUND(0);
+	.loc 1 83 267 view .LVU42
+	movd	-32(%rsp), %xmm13	# m[10], tmp752
+	paddd	%xmm0, %xmm15	# va, _460
+# blake2s-vec.c:83:     FULLROUND(0);
+	.loc 1 83 703 view .LVU43
+	paddd	%xmm1, %xmm15	# vb, va
+.LVL10:
+	.loc 1 83 719 is_stmt 1 view .LVU44
+# blake2s-vec.c:83:     FULLROUND(0);
+	.loc 1 83 734 is_stmt 0 view .LVU45
+	pxor	%xmm15, %xmm2	# va, _40
+.LVL11:
+# blake2s-vec.c:83:     FULLROUND(0);
+	.loc 1 83 724 view .LVU46
+	movdqa	%xmm2, %xmm0	# _40, tmp503
+.LVL12:
+	.loc 1 83 724 view .LVU47
+	pslld	$24, %xmm2	#, vd
+	psrld	$8, %xmm0	#, tmp503
+	por	%xmm0, %xmm2	# tmp503, vd
+.LVL13:
+	.loc 1 83 784 is_stmt 1 view .LVU48
+# blake2s-vec.c:83:     FULLROUND(0);
+	.loc 1 83 789 is_stmt 0 view .LVU49
+	paddd	%xmm2, %xmm14	# vd, vc
+.LVL14:
+	.loc 1 83 798 is_stmt 1 view .LVU50
+# blake2s-vec.c:83:     FULLROUND(0);
+	.loc 1 83 813 is_stmt 0 view .LVU51
+	pxor	%xmm14, %xmm1	# vc, _43
+.LVL15:
+# blake2s-vec.c:83:     FULLROUND(0);
+	.loc 1 83 927 view .LVU52
+	pshufd	$78, %xmm14, %xmm14	#, vc, vc
+.LVL16:
+# blake2s-vec.c:83:     FULLROUND(0);
+	.loc 1 83 803 view .LVU53
+	movdqa	%xmm1, %xmm0	# _43, tmp504
+	pslld	$25, %xmm1	#, vb
+	psrld	$7, %xmm0	#, tmp504
+	por	%xmm0, %xmm1	# tmp504, vb
+.LVL17:
+	.loc 1 83 527 is_stmt 1 view .LVU54
+	.loc 1 83 876 view .LVU55
+# blake2s-vec.c:83:     FULLROUND(0);
+	.loc 1 83 879 is_stmt 0 view .LVU56
+	pshufd	$57, %xmm1, %xmm0	#, vb, vb
+.LVL18:
+	.loc 1 83 924 is_stmt 1 view .LVU57
+	.loc 1 83 972 view .LVU58
+	.loc 1 83 1020 view .LVU59
+	.loc 1 83 1025 view .LVU60
+# blake2s-vec.c:83:     FULLROUND(0);
+	.loc 1 83 267 is_stmt 0 view .LVU61
+	movdqa	%xmm7, %xmm1	# tmp727, tmp506
+	punpckldq	%xmm8, %xmm1	# tmp998, tmp506
+	movq	%xmm1, %r11	# tmp506, tmp506
+	movdqa	%xmm12, %xmm1	# tmp725, tmp507
+	punpckldq	%xmm13, %xmm1	# tmp752, tmp507
+	movq	%r11, %xmm13	# tmp506, tmp506
+	punpcklqdq	%xmm13, %xmm1	# tmp506, m3
+# blake2s-vec.c:83:     FULLROUND(0);
+	.loc 1 83 397 view .LVU62
+	movd	-12(%rsp), %xmm13	# m[15], tmp757
+	paddd	%xmm1, %xmm15	# m3, _459
+.LVL19:
+# blake2s-vec.c:83:     FULLROUND(0);
+	.loc 1 83 975 view .LVU63
+	pshufd	$147, %xmm2, %xmm1	#, vd, vd
+# blake2s-vec.c:83:     FULLROUND(0);
+	.loc 1 83 1030 view .LVU64
+	paddd	%xmm0, %xmm15	# vb, va
+.LVL20:
+	.loc 1 83 1046 is_stmt 1 view .LVU65
+# blake2s-vec.c:83:     FULLROUND(0);
+	.loc 1 83 1061 is_stmt 0 view .LVU66
+	pxor	%xmm15, %xmm1	# va, _50
+# blake2s-vec.c:83:     FULLROUND(0);
+	.loc 1 83 1051 view .LVU67
+	movdqa	%xmm1, %xmm2	# _50, tmp509
+	psrld	$16, %xmm1	#, vd
+	pslld	$16, %xmm2	#, tmp509
+	por	%xmm2, %xmm1	# tmp509, vd
+.LVL21:
+	.loc 1 83 1113 is_stmt 1 view .LVU68
+# blake2s-vec.c:83:     FULLROUND(0);
+	.loc 1 83 1118 is_stmt 0 view .LVU69
+	paddd	%xmm1, %xmm14	# vd, vc
+.LVL22:
+	.loc 1 83 1127 is_stmt 1 view .LVU70
+# blake2s-vec.c:83:     FULLROUND(0);
+	.loc 1 83 1142 is_stmt 0 view .LVU71
+	pxor	%xmm14, %xmm0	# vc, _53
+.LVL23:
+# blake2s-vec.c:83:     FULLROUND(0);
+	.loc 1 83 1132 view .LVU72
+	movdqa	%xmm0, %xmm2	# _53, tmp510
+	pslld	$20, %xmm0	#, vb
+	psrld	$12, %xmm2	#, tmp510
+	por	%xmm2, %xmm0	# tmp510, vb
+.LVL24:
+	.loc 1 83 1194 is_stmt 1 view .LVU73
+# blake2s-vec.c:83:     FULLROUND(0);
+	.loc 1 83 397 is_stmt 0 view .LVU74
+	movd	-20(%rsp), %xmm2	# m[13], tmp512
+	punpckldq	%xmm13, %xmm2	# tmp757, tmp512
+	movq	%xmm2, %rax	# tmp512, tmp512
+	movdqa	%xmm10, %xmm2	# _23, tmp513
+	movq	%rax, %xmm13	# tmp512, tmp512
+	punpckldq	%xmm5, %xmm2	# _24, tmp513
+	punpcklqdq	%xmm13, %xmm2	# tmp512, m4
+.LBE59:
+.LBB60:
+# blake2s-vec.c:84:     FULLROUND(1);
+	.loc 1 84 13 view .LVU75
+	movd	-20(%rsp), %xmm13	# m[13], tmp763
+	paddd	%xmm2, %xmm15	# m4, _458
+.LVL25:
+	.loc 1 84 13 view .LVU76
+.LBE60:
+.LBB61:
+# blake2s-vec.c:83:     FULLROUND(0);
+	.loc 1 83 1199 view .LVU77
+	paddd	%xmm0, %xmm15	# vb, va
+.LVL26:
+	.loc 1 83 1215 is_stmt 1 view .LVU78
+# blake2s-vec.c:83:     FULLROUND(0);
+	.loc 1 83 1230 is_stmt 0 view .LVU79
+	pxor	%xmm15, %xmm1	# va, _57
+.LVL27:
+# blake2s-vec.c:83:     FULLROUND(0);
+	.loc 1 83 1220 view .LVU80
+	movdqa	%xmm1, %xmm2	# _57, tmp514
+	pslld	$24, %xmm1	#, vd
+	psrld	$8, %xmm2	#, tmp514
+	por	%xmm2, %xmm1	# tmp514, vd
+.LVL28:
+	.loc 1 83 1280 is_stmt 1 view .LVU81
+# blake2s-vec.c:83:     FULLROUND(0);
+	.loc 1 83 1285 is_stmt 0 view .LVU82
+	paddd	%xmm1, %xmm14	# vd, vc
+.LVL29:
+	.loc 1 83 1294 is_stmt 1 view .LVU83
+# blake2s-vec.c:83:     FULLROUND(0);
+	.loc 1 83 1471 is_stmt 0 view .LVU84
+	pshufd	$57, %xmm1, %xmm1	#, vd, vd
+.LVL30:
+# blake2s-vec.c:83:     FULLROUND(0);
+	.loc 1 83 1309 view .LVU85
+	pxor	%xmm14, %xmm0	# vc, _60
+.LVL31:
+# blake2s-vec.c:83:     FULLROUND(0);
+	.loc 1 83 1423 view .LVU86
+	pshufd	$78, %xmm14, %xmm14	#, vc, vc
+.LVL32:
+# blake2s-vec.c:83:     FULLROUND(0);
+	.loc 1 83 1299 view .LVU87
+	movdqa	%xmm0, %xmm2	# _60, tmp515
+	pslld	$25, %xmm0	#, vb
+	psrld	$7, %xmm2	#, tmp515
+	por	%xmm2, %xmm0	# tmp515, vb
+.LVL33:
+	.loc 1 83 1023 is_stmt 1 view .LVU88
+	.loc 1 83 1372 view .LVU89
+.LBE61:
+.LBB62:
+# blake2s-vec.c:84:     FULLROUND(1);
+	.loc 1 84 13 is_stmt 0 view .LVU90
+	movdqa	%xmm10, %xmm2	# _23, tmp517
+	punpckldq	%xmm13, %xmm2	# tmp763, tmp517
+.LBE62:
+.LBB63:
+# blake2s-vec.c:83:     FULLROUND(0);
+	.loc 1 83 1375 view .LVU91
+	pshufd	$147, %xmm0, %xmm0	#, vb, vb
+.LVL34:
+	.loc 1 83 1420 is_stmt 1 view .LVU92
+	.loc 1 83 1468 view .LVU93
+	.loc 1 83 1468 is_stmt 0 view .LVU94
+.LBE63:
+	.loc 1 83 8 is_stmt 1 view .LVU95
+	.loc 1 84 5 view .LVU96
+.LBB64:
+	.loc 1 84 10 view .LVU97
+	.loc 1 84 137 view .LVU98
+	.loc 1 84 264 view .LVU99
+	.loc 1 84 394 view .LVU100
+	.loc 1 84 524 view .LVU101
+	.loc 1 84 529 view .LVU102
+# blake2s-vec.c:84:     FULLROUND(1);
+	.loc 1 84 13 is_stmt 0 view .LVU103
+	movq	%xmm2, %rax	# tmp517, tmp517
+	movdqa	%xmm8, %xmm2	# tmp998, tmp518
+	punpckldq	%xmm6, %xmm2	# tmp723, tmp518
+	movq	%xmm2, %rdx	# tmp518, tmp518
+	movdqa	%xmm2, %xmm13	# tmp518, m1
+	movq	%rax, %xmm2	# tmp517, tmp517
+	punpcklqdq	%xmm2, %xmm13	# tmp517, m1
+	movdqa	%xmm13, %xmm2	# m1, m1
+# blake2s-vec.c:84:     FULLROUND(1);
+	.loc 1 84 140 view .LVU104
+	movd	-12(%rsp), %xmm13	# m[15], tmp523
+	paddd	%xmm15, %xmm2	# va, _457
+# blake2s-vec.c:84:     FULLROUND(1);
+	.loc 1 84 534 view .LVU105
+	paddd	%xmm0, %xmm2	# vb, va
+.LVL35:
+	.loc 1 84 550 is_stmt 1 view .LVU106
+# blake2s-vec.c:84:     FULLROUND(1);
+	.loc 1 84 140 is_stmt 0 view .LVU107
+	punpckldq	%xmm4, %xmm13	# _11, tmp523
+# blake2s-vec.c:84:     FULLROUND(1);
+	.loc 1 84 565 view .LVU108
+	pxor	%xmm2, %xmm1	# va, _71
+# blake2s-vec.c:84:     FULLROUND(1);
+	.loc 1 84 140 view .LVU109
+	movq	%xmm13, %rax	# tmp523, tmp523
+	movd	-32(%rsp), %xmm13	# m[10], tmp524
+# blake2s-vec.c:84:     FULLROUND(1);
+	.loc 1 84 555 view .LVU110
+	movdqa	%xmm1, %xmm15	# _71, tmp520
+	psrld	$16, %xmm1	#, vd
+	pslld	$16, %xmm15	#, tmp520
+# blake2s-vec.c:84:     FULLROUND(1);
+	.loc 1 84 140 view .LVU111
+	punpckldq	%xmm12, %xmm13	# tmp725, tmp524
+# blake2s-vec.c:84:     FULLROUND(1);
+	.loc 1 84 555 view .LVU112
+	por	%xmm15, %xmm1	# tmp520, vd
+.LVL36:
+	.loc 1 84 617 is_stmt 1 view .LVU113
+# blake2s-vec.c:84:     FULLROUND(1);
+	.loc 1 84 140 is_stmt 0 view .LVU114
+	movq	%xmm13, %rsi	# tmp524, tmp524
+.LVL37:
+# blake2s-vec.c:84:     FULLROUND(1);
+	.loc 1 84 622 view .LVU115
+	paddd	%xmm1, %xmm14	# vd, vc
+.LVL38:
+	.loc 1 84 631 is_stmt 1 view .LVU116
+# blake2s-vec.c:84:     FULLROUND(1);
+	.loc 1 84 646 is_stmt 0 view .LVU117
+	pxor	%xmm14, %xmm0	# vc, _74
+.LVL39:
+# blake2s-vec.c:84:     FULLROUND(1);
+	.loc 1 84 636 view .LVU118
+	movdqa	%xmm0, %xmm15	# _74, tmp521
+	pslld	$20, %xmm0	#, vb
+	psrld	$12, %xmm15	#, tmp521
+	por	%xmm15, %xmm0	# tmp521, vb
+.LVL40:
+	.loc 1 84 698 is_stmt 1 view .LVU119
+# blake2s-vec.c:84:     FULLROUND(1);
+	.loc 1 84 140 is_stmt 0 view .LVU120
+	movdqa	%xmm13, %xmm15	# tmp524, m2
+	movq	%rax, %xmm13	# tmp523, tmp523
+	punpcklqdq	%xmm13, %xmm15	# tmp523, m2
+# blake2s-vec.c:84:     FULLROUND(1);
+	.loc 1 84 267 view .LVU121
+	movd	-52(%rsp), %xmm13	# m[5], tmp776
+	paddd	%xmm2, %xmm15	# va, _456
+# blake2s-vec.c:84:     FULLROUND(1);
+	.loc 1 84 703 view .LVU122
+	paddd	%xmm0, %xmm15	# vb, va
+.LVL41:
+	.loc 1 84 719 is_stmt 1 view .LVU123
+# blake2s-vec.c:84:     FULLROUND(1);
+	.loc 1 84 734 is_stmt 0 view .LVU124
+	pxor	%xmm15, %xmm1	# va, _78
+.LVL42:
+# blake2s-vec.c:84:     FULLROUND(1);
+	.loc 1 84 724 view .LVU125
+	movdqa	%xmm1, %xmm2	# _78, tmp525
+	pslld	$24, %xmm1	#, vd
+	psrld	$8, %xmm2	#, tmp525
+	por	%xmm2, %xmm1	# tmp525, vd
+.LVL43:
+	.loc 1 84 784 is_stmt 1 view .LVU126
+# blake2s-vec.c:84:     FULLROUND(1);
+	.loc 1 84 789 is_stmt 0 view .LVU127
+	paddd	%xmm1, %xmm14	# vd, vc
+.LVL44:
+	.loc 1 84 798 is_stmt 1 view .LVU128
+# blake2s-vec.c:84:     FULLROUND(1);
+	.loc 1 84 975 is_stmt 0 view .LVU129
+	pshufd	$147, %xmm1, %xmm1	#, vd, vd
+.LVL45:
+# blake2s-vec.c:84:     FULLROUND(1);
+	.loc 1 84 813 view .LVU130
+	pxor	%xmm14, %xmm0	# vc, _81
+.LVL46:
+# blake2s-vec.c:84:     FULLROUND(1);
+	.loc 1 84 927 view .LVU131
+	pshufd	$78, %xmm14, %xmm14	#, vc, vc
+.LVL47:
+# blake2s-vec.c:84:     FULLROUND(1);
+	.loc 1 84 803 view .LVU132
+	movdqa	%xmm0, %xmm2	# _81, tmp526
+	pslld	$25, %xmm0	#, vb
+	psrld	$7, %xmm2	#, tmp526
+	por	%xmm2, %xmm0	# tmp526, vb
+.LVL48:
+	.loc 1 84 527 is_stmt 1 view .LVU133
+	.loc 1 84 876 view .LVU134
+# blake2s-vec.c:84:     FULLROUND(1);
+	.loc 1 84 267 is_stmt 0 view .LVU135
+	movdqa	%xmm5, %xmm2	# _24, tmp528
+	punpckldq	%xmm13, %xmm2	# tmp776, tmp528
+# blake2s-vec.c:84:     FULLROUND(1);
+	.loc 1 84 879 view .LVU136
+	pshufd	$57, %xmm0, %xmm0	#, vb, vb
+.LVL49:
+	.loc 1 84 924 is_stmt 1 view .LVU137
+	.loc 1 84 972 view .LVU138
+	.loc 1 84 1020 view .LVU139
+	.loc 1 84 1025 view .LVU140
+# blake2s-vec.c:84:     FULLROUND(1);
+	.loc 1 84 267 is_stmt 0 view .LVU141
+	movq	%xmm2, %rax	# tmp528, tmp528
+	movdqa	%xmm9, %xmm2	# _13, tmp529
+	movq	%rax, %xmm13	# tmp528, tmp528
+	punpckldq	%xmm11, %xmm2	# tmp721, tmp529
+	punpcklqdq	%xmm13, %xmm2	# tmp528, m3
+# blake2s-vec.c:84:     FULLROUND(1);
+	.loc 1 84 397 view .LVU142
+	movd	-44(%rsp), %xmm13	# m[7], tmp534
+	paddd	%xmm15, %xmm2	# va, _455
+# blake2s-vec.c:84:     FULLROUND(1);
+	.loc 1 84 1030 view .LVU143
+	paddd	%xmm0, %xmm2	# vb, va
+.LVL50:
+	.loc 1 84 1046 is_stmt 1 view .LVU144
+# blake2s-vec.c:84:     FULLROUND(1);
+	.loc 1 84 1061 is_stmt 0 view .LVU145
+	pxor	%xmm2, %xmm1	# va, _88
+# blake2s-vec.c:84:     FULLROUND(1);
+	.loc 1 84 1051 view .LVU146
+	movdqa	%xmm1, %xmm15	# _88, tmp531
+	psrld	$16, %xmm1	#, vd
+	pslld	$16, %xmm15	#, tmp531
+	por	%xmm15, %xmm1	# tmp531, vd
+.LVL51:
+	.loc 1 84 1113 is_stmt 1 view .LVU147
+# blake2s-vec.c:84:     FULLROUND(1);
+	.loc 1 84 1118 is_stmt 0 view .LVU148
+	paddd	%xmm1, %xmm14	# vd, vc
+.LVL52:
+	.loc 1 84 1127 is_stmt 1 view .LVU149
+# blake2s-vec.c:84:     FULLROUND(1);
+	.loc 1 84 1142 is_stmt 0 view .LVU150
+	pxor	%xmm14, %xmm0	# vc, _91
+.LVL53:
+# blake2s-vec.c:84:     FULLROUND(1);
+	.loc 1 84 1132 view .LVU151
+	movdqa	%xmm0, %xmm15	# _91, tmp532
+	pslld	$20, %xmm0	#, vb
+	psrld	$12, %xmm15	#, tmp532
+	por	%xmm15, %xmm0	# tmp532, vb
+.LVL54:
+	.loc 1 84 1194 is_stmt 1 view .LVU152
+# blake2s-vec.c:84:     FULLROUND(1);
+	.loc 1 84 397 is_stmt 0 view .LVU153
+	movd	-60(%rsp), %xmm15	# m[3], tmp782
+	punpckldq	%xmm15, %xmm13	# tmp782, tmp534
+	movdqa	%xmm7, %xmm15	# tmp727, tmp535
+	punpckldq	%xmm3, %xmm15	# _9, tmp535
+	movq	%xmm13, %rax	# tmp534, tmp534
+	punpcklqdq	%xmm13, %xmm15	# tmp534, m4
+	paddd	%xmm2, %xmm15	# va, _454
+# blake2s-vec.c:84:     FULLROUND(1);
+	.loc 1 84 1199 view .LVU154
+	paddd	%xmm0, %xmm15	# vb, va
+.LVL55:
+	.loc 1 84 1215 is_stmt 1 view .LVU155
+# blake2s-vec.c:84:     FULLROUND(1);
+	.loc 1 84 1230 is_stmt 0 view .LVU156
+	pxor	%xmm15, %xmm1	# va, _95
+.LVL56:
+# blake2s-vec.c:84:     FULLROUND(1);
+	.loc 1 84 1220 view .LVU157
+	movdqa	%xmm1, %xmm2	# _95, tmp536
+	pslld	$24, %xmm1	#, vd
+	psrld	$8, %xmm2	#, tmp536
+	por	%xmm2, %xmm1	# tmp536, vd
+.LVL57:
+	.loc 1 84 1280 is_stmt 1 view .LVU158
+# blake2s-vec.c:84:     FULLROUND(1);
+	.loc 1 84 1285 is_stmt 0 view .LVU159
+	paddd	%xmm1, %xmm14	# vd, vc
+.LVL58:
+	.loc 1 84 1294 is_stmt 1 view .LVU160
+# blake2s-vec.c:84:     FULLROUND(1);
+	.loc 1 84 1471 is_stmt 0 view .LVU161
+	pshufd	$57, %xmm1, %xmm1	#, vd, vd
+.LVL59:
+# blake2s-vec.c:84:     FULLROUND(1);
+	.loc 1 84 1309 view .LVU162
+	pxor	%xmm14, %xmm0	# vc, _98
+.LVL60:
+# blake2s-vec.c:84:     FULLROUND(1);
+	.loc 1 84 1423 view .LVU163
+	pshufd	$78, %xmm14, %xmm14	#, vc, vc
+.LVL61:
+# blake2s-vec.c:84:     FULLROUND(1);
+	.loc 1 84 1299 view .LVU164
+	movdqa	%xmm0, %xmm2	# _98, tmp537
+	pslld	$25, %xmm0	#, vb
+	psrld	$7, %xmm2	#, tmp537
+	por	%xmm2, %xmm0	# tmp537, vb
+.LVL62:
+	.loc 1 84 1023 is_stmt 1 view .LVU165
+	.loc 1 84 1372 view .LVU166
+.LBE64:
+.LBB65:
+# blake2s-vec.c:85:     FULLROUND(2);
+	.loc 1 85 13 is_stmt 0 view .LVU167
+	movd	-52(%rsp), %xmm2	# m[5], tmp539
+	movd	-12(%rsp), %xmm13	# m[15], tmp788
+.LBE65:
+.LBB66:
+# blake2s-vec.c:84:     FULLROUND(1);
+	.loc 1 84 1375 view .LVU168
+	pshufd	$147, %xmm0, %xmm0	#, vb, vb
+.LVL63:
+	.loc 1 84 1420 is_stmt 1 view .LVU169
+	.loc 1 84 1468 view .LVU170
+	.loc 1 84 1468 is_stmt 0 view .LVU171
+.LBE66:
+	.loc 1 84 8 is_stmt 1 view .LVU172
+	.loc 1 85 5 view .LVU173
+.LBB67:
+	.loc 1 85 10 view .LVU174
+	.loc 1 85 137 view .LVU175
+	.loc 1 85 264 view .LVU176
+	.loc 1 85 394 view .LVU177
+	.loc 1 85 524 view .LVU178
+	.loc 1 85 529 view .LVU179
+# blake2s-vec.c:85:     FULLROUND(2);
+	.loc 1 85 267 is_stmt 0 view .LVU180
+	movd	-60(%rsp), %xmm8	# m[3], tmp802
+# blake2s-vec.c:85:     FULLROUND(2);
+	.loc 1 85 13 view .LVU181
+	punpckldq	%xmm13, %xmm2	# tmp788, tmp539
+	movq	%xmm2, %r10	# tmp539, tmp539
+	movdqa	%xmm5, %xmm2	# _24, tmp540
+	movq	%r10, %xmm13	# tmp539, tmp539
+	punpckldq	%xmm7, %xmm2	# tmp727, tmp540
+	punpcklqdq	%xmm13, %xmm2	# tmp539, m1
+# blake2s-vec.c:85:     FULLROUND(2);
+	.loc 1 85 140 view .LVU182
+	movdqa	%xmm3, %xmm13	# _9, tmp545
+	paddd	%xmm15, %xmm2	# va, _453
+# blake2s-vec.c:85:     FULLROUND(2);
+	.loc 1 85 534 view .LVU183
+	paddd	%xmm0, %xmm2	# vb, _453
+# blake2s-vec.c:85:     FULLROUND(2);
+	.loc 1 85 565 view .LVU184
+	pxor	%xmm2, %xmm1	# va, _109
+# blake2s-vec.c:85:     FULLROUND(2);
+	.loc 1 85 534 view .LVU185
+	movdqa	%xmm2, %xmm15	# _453, va
+.LVL64:
+	.loc 1 85 550 is_stmt 1 view .LVU186
+# blake2s-vec.c:85:     FULLROUND(2);
+	.loc 1 85 555 is_stmt 0 view .LVU187
+	movdqa	%xmm1, %xmm2	# _109, tmp542
+.LVL65:
+	.loc 1 85 555 view .LVU188
+	psrld	$16, %xmm1	#, vd
+	pslld	$16, %xmm2	#, tmp542
+	por	%xmm2, %xmm1	# tmp542, vd
+.LVL66:
+	.loc 1 85 617 is_stmt 1 view .LVU189
+# blake2s-vec.c:85:     FULLROUND(2);
+	.loc 1 85 622 is_stmt 0 view .LVU190
+	paddd	%xmm1, %xmm14	# vd, vc
+.LVL67:
+	.loc 1 85 631 is_stmt 1 view .LVU191
+# blake2s-vec.c:85:     FULLROUND(2);
+	.loc 1 85 646 is_stmt 0 view .LVU192
+	pxor	%xmm14, %xmm0	# vc, _112
+.LVL68:
+# blake2s-vec.c:85:     FULLROUND(2);
+	.loc 1 85 636 view .LVU193
+	movdqa	%xmm0, %xmm2	# _112, tmp543
+	pslld	$20, %xmm0	#, vb
+	psrld	$12, %xmm2	#, tmp543
+	por	%xmm2, %xmm0	# tmp543, vb
+.LVL69:
+	.loc 1 85 698 is_stmt 1 view .LVU194
+# blake2s-vec.c:85:     FULLROUND(2);
+	.loc 1 85 140 is_stmt 0 view .LVU195
+	movd	-20(%rsp), %xmm2	# m[13], tmp795
+	punpckldq	%xmm2, %xmm13	# tmp795, tmp545
+	movdqa	%xmm12, %xmm2	# tmp725, tmp546
+	punpckldq	%xmm11, %xmm2	# tmp721, tmp546
+	punpcklqdq	%xmm13, %xmm2	# tmp545, m2
+# blake2s-vec.c:85:     FULLROUND(2);
+	.loc 1 85 267 view .LVU196
+	movd	-44(%rsp), %xmm13	# m[7], tmp550
+	paddd	%xmm15, %xmm2	# va, _452
+# blake2s-vec.c:85:     FULLROUND(2);
+	.loc 1 85 703 view .LVU197
+	paddd	%xmm0, %xmm2	# vb, _452
+# blake2s-vec.c:85:     FULLROUND(2);
+	.loc 1 85 267 view .LVU198
+	punpckldq	%xmm10, %xmm13	# _23, tmp550
+# blake2s-vec.c:85:     FULLROUND(2);
+	.loc 1 85 734 view .LVU199
+	pxor	%xmm2, %xmm1	# va, _116
+.LVL70:
+# blake2s-vec.c:85:     FULLROUND(2);
+	.loc 1 85 703 view .LVU200
+	movdqa	%xmm2, %xmm15	# _452, va
+.LVL71:
+	.loc 1 85 719 is_stmt 1 view .LVU201
+# blake2s-vec.c:85:     FULLROUND(2);
+	.loc 1 85 724 is_stmt 0 view .LVU202
+	movdqa	%xmm1, %xmm2	# _116, tmp547
+.LVL72:
+	.loc 1 85 724 view .LVU203
+	pslld	$24, %xmm1	#, vd
+	psrld	$8, %xmm2	#, tmp547
+	por	%xmm2, %xmm1	# tmp547, vd
+.LVL73:
+	.loc 1 85 784 is_stmt 1 view .LVU204
+# blake2s-vec.c:85:     FULLROUND(2);
+	.loc 1 85 789 is_stmt 0 view .LVU205
+	paddd	%xmm1, %xmm14	# vd, vc
+.LVL74:
+	.loc 1 85 798 is_stmt 1 view .LVU206
+# blake2s-vec.c:85:     FULLROUND(2);
+	.loc 1 85 975 is_stmt 0 view .LVU207
+	pshufd	$147, %xmm1, %xmm1	#, vd, vd
+.LVL75:
+# blake2s-vec.c:85:     FULLROUND(2);
+	.loc 1 85 813 view .LVU208
+	pxor	%xmm14, %xmm0	# vc, _119
+.LVL76:
+# blake2s-vec.c:85:     FULLROUND(2);
+	.loc 1 85 927 view .LVU209
+	pshufd	$78, %xmm14, %xmm14	#, vc, vc
+.LVL77:
+# blake2s-vec.c:85:     FULLROUND(2);
+	.loc 1 85 803 view .LVU210
+	movdqa	%xmm0, %xmm2	# _119, tmp548
+	pslld	$25, %xmm0	#, vb
+	psrld	$7, %xmm2	#, tmp548
+	por	%xmm2, %xmm0	# tmp548, vb
+.LVL78:
+	.loc 1 85 527 is_stmt 1 view .LVU211
+	.loc 1 85 876 view .LVU212
+# blake2s-vec.c:85:     FULLROUND(2);
+	.loc 1 85 267 is_stmt 0 view .LVU213
+	movd	-32(%rsp), %xmm2	# m[10], tmp551
+# blake2s-vec.c:85:     FULLROUND(2);
+	.loc 1 85 879 view .LVU214
+	pshufd	$57, %xmm0, %xmm0	#, vb, vb
+.LVL79:
+	.loc 1 85 924 is_stmt 1 view .LVU215
+	.loc 1 85 972 view .LVU216
+	.loc 1 85 1020 view .LVU217
+	.loc 1 85 1025 view .LVU218
+# blake2s-vec.c:85:     FULLROUND(2);
+	.loc 1 85 267 is_stmt 0 view .LVU219
+	punpckldq	%xmm8, %xmm2	# tmp802, tmp551
+.LBE67:
+.LBB68:
+# blake2s-vec.c:86:     FULLROUND(3);
+	.loc 1 86 140 view .LVU220
+	movq	%r11, %xmm8	# tmp506, tmp506
+.LBE68:
+.LBB69:
+# blake2s-vec.c:85:     FULLROUND(2);
+	.loc 1 85 267 view .LVU221
+	punpcklqdq	%xmm13, %xmm2	# tmp550, m3
+# blake2s-vec.c:85:     FULLROUND(2);
+	.loc 1 85 397 view .LVU222
+	movd	-16(%rsp), %xmm13	# m[14], tmp557
+	paddd	%xmm15, %xmm2	# va, _451
+# blake2s-vec.c:85:     FULLROUND(2);
+	.loc 1 85 1030 view .LVU223
+	paddd	%xmm0, %xmm2	# vb, va
+.LVL80:
+	.loc 1 85 1046 is_stmt 1 view .LVU224
+# blake2s-vec.c:85:     FULLROUND(2);
+	.loc 1 85 397 is_stmt 0 view .LVU225
+	punpckldq	%xmm4, %xmm13	# _11, tmp557
+# blake2s-vec.c:85:     FULLROUND(2);
+	.loc 1 85 1061 view .LVU226
+	pxor	%xmm2, %xmm1	# va, _126
+# blake2s-vec.c:85:     FULLROUND(2);
+	.loc 1 85 1051 view .LVU227
+	movdqa	%xmm1, %xmm15	# _126, tmp553
+	psrld	$16, %xmm1	#, vd
+	pslld	$16, %xmm15	#, tmp553
+	por	%xmm15, %xmm1	# tmp553, vd
+.LVL81:
+	.loc 1 85 1113 is_stmt 1 view .LVU228
+# blake2s-vec.c:85:     FULLROUND(2);
+	.loc 1 85 1118 is_stmt 0 view .LVU229
+	paddd	%xmm1, %xmm14	# vd, vc
+.LVL82:
+	.loc 1 85 1127 is_stmt 1 view .LVU230
+# blake2s-vec.c:85:     FULLROUND(2);
+	.loc 1 85 1142 is_stmt 0 view .LVU231
+	pxor	%xmm14, %xmm0	# vc, _129
+.LVL83:
+# blake2s-vec.c:85:     FULLROUND(2);
+	.loc 1 85 1132 view .LVU232
+	movdqa	%xmm0, %xmm15	# _129, tmp554
+	pslld	$20, %xmm0	#, vb
+	psrld	$12, %xmm15	#, tmp554
+	por	%xmm15, %xmm0	# tmp554, vb
+.LVL84:
+	.loc 1 85 1194 is_stmt 1 view .LVU233
+# blake2s-vec.c:85:     FULLROUND(2);
+	.loc 1 85 397 is_stmt 0 view .LVU234
+	movdqa	%xmm9, %xmm15	# _13, tmp556
+	punpckldq	%xmm6, %xmm15	# tmp723, tmp556
+	punpcklqdq	%xmm15, %xmm13	# tmp556, m4
+	paddd	%xmm13, %xmm2	# m4, _450
+.LVL85:
+	.loc 1 85 397 view .LVU235
+.LBE69:
+.LBB70:
+# blake2s-vec.c:86:     FULLROUND(3);
+	.loc 1 86 13 view .LVU236
+	movq	%rax, %xmm13	# tmp534, m1
+.LBE70:
+.LBB71:
+# blake2s-vec.c:85:     FULLROUND(2);
+	.loc 1 85 1199 view .LVU237
+	paddd	%xmm0, %xmm2	# vb, va
+.LVL86:
+	.loc 1 85 1215 is_stmt 1 view .LVU238
+# blake2s-vec.c:85:     FULLROUND(2);
+	.loc 1 85 1230 is_stmt 0 view .LVU239
+	pxor	%xmm2, %xmm1	# va, _133
+.LVL87:
+# blake2s-vec.c:85:     FULLROUND(2);
+	.loc 1 85 1220 view .LVU240
+	movdqa	%xmm1, %xmm15	# _133, tmp558
+	pslld	$24, %xmm1	#, vd
+	psrld	$8, %xmm15	#, tmp558
+	por	%xmm15, %xmm1	# tmp558, vd
+.LVL88:
+	.loc 1 85 1280 is_stmt 1 view .LVU241
+# blake2s-vec.c:85:     FULLROUND(2);
+	.loc 1 85 1285 is_stmt 0 view .LVU242
+	paddd	%xmm1, %xmm14	# vd, vc
+.LVL89:
+	.loc 1 85 1294 is_stmt 1 view .LVU243
+# blake2s-vec.c:85:     FULLROUND(2);
+	.loc 1 85 1471 is_stmt 0 view .LVU244
+	pshufd	$57, %xmm1, %xmm1	#, vd, vd
+.LVL90:
+# blake2s-vec.c:85:     FULLROUND(2);
+	.loc 1 85 1309 view .LVU245
+	pxor	%xmm14, %xmm0	# vc, _136
+.LVL91:
+# blake2s-vec.c:85:     FULLROUND(2);
+	.loc 1 85 1423 view .LVU246
+	pshufd	$78, %xmm14, %xmm14	#, vc, vc
+.LVL92:
+# blake2s-vec.c:85:     FULLROUND(2);
+	.loc 1 85 1299 view .LVU247
+	movdqa	%xmm0, %xmm15	# _136, tmp559
+	pslld	$25, %xmm0	#, vb
+	psrld	$7, %xmm15	#, tmp559
+	por	%xmm15, %xmm0	# tmp559, vb
+.LVL93:
+	.loc 1 85 1023 is_stmt 1 view .LVU248
+	.loc 1 85 1372 view .LVU249
+.LBE71:
+.LBB72:
+# blake2s-vec.c:86:     FULLROUND(3);
+	.loc 1 86 13 is_stmt 0 view .LVU250
+	movd	-20(%rsp), %xmm15	# m[13], tmp561
+.LBE72:
+.LBB73:
+# blake2s-vec.c:85:     FULLROUND(2);
+	.loc 1 85 1375 view .LVU251
+	pshufd	$147, %xmm0, %xmm0	#, vb, vb
+.LVL94:
+	.loc 1 85 1420 is_stmt 1 view .LVU252
+	.loc 1 85 1468 view .LVU253
+	.loc 1 85 1468 is_stmt 0 view .LVU254
+.LBE73:
+	.loc 1 85 8 is_stmt 1 view .LVU255
+	.loc 1 86 5 view .LVU256
+.LBB74:
+	.loc 1 86 10 view .LVU257
+	.loc 1 86 137 view .LVU258
+	.loc 1 86 264 view .LVU259
+	.loc 1 86 394 view .LVU260
+	.loc 1 86 524 view .LVU261
+	.loc 1 86 529 view .LVU262
+# blake2s-vec.c:86:     FULLROUND(3);
+	.loc 1 86 13 is_stmt 0 view .LVU263
+	punpckldq	%xmm5, %xmm15	# _24, tmp561
+	punpcklqdq	%xmm15, %xmm13	# tmp561, m1
+	paddd	%xmm13, %xmm2	# m1, _449
+.LVL95:
+# blake2s-vec.c:86:     FULLROUND(3);
+	.loc 1 86 267 view .LVU264
+	movdqa	%xmm6, %xmm13	# tmp723, tmp572
+# blake2s-vec.c:86:     FULLROUND(3);
+	.loc 1 86 534 view .LVU265
+	paddd	%xmm0, %xmm2	# vb, va
+.LVL96:
+	.loc 1 86 550 is_stmt 1 view .LVU266
+# blake2s-vec.c:86:     FULLROUND(3);
+	.loc 1 86 565 is_stmt 0 view .LVU267
+	pxor	%xmm2, %xmm1	# va, _147
+# blake2s-vec.c:86:     FULLROUND(3);
+	.loc 1 86 555 view .LVU268
+	movdqa	%xmm1, %xmm15	# _147, tmp564
+	psrld	$16, %xmm1	#, vd
+	pslld	$16, %xmm15	#, tmp564
+	por	%xmm15, %xmm1	# tmp564, vd
+.LVL97:
+	.loc 1 86 617 is_stmt 1 view .LVU269
+# blake2s-vec.c:86:     FULLROUND(3);
+	.loc 1 86 622 is_stmt 0 view .LVU270
+	paddd	%xmm1, %xmm14	# vd, vc
+.LVL98:
+	.loc 1 86 631 is_stmt 1 view .LVU271
+# blake2s-vec.c:86:     FULLROUND(3);
+	.loc 1 86 646 is_stmt 0 view .LVU272
+	pxor	%xmm14, %xmm0	# vc, _150
+.LVL99:
+# blake2s-vec.c:86:     FULLROUND(3);
+	.loc 1 86 636 view .LVU273
+	movdqa	%xmm0, %xmm15	# _150, tmp565
+	pslld	$20, %xmm0	#, vb
+	psrld	$12, %xmm15	#, tmp565
+	por	%xmm15, %xmm0	# tmp565, vb
+.LVL100:
+	.loc 1 86 698 is_stmt 1 view .LVU274
+# blake2s-vec.c:86:     FULLROUND(3);
+	.loc 1 86 140 is_stmt 0 view .LVU275
+	movdqa	%xmm10, %xmm15	# _23, tmp568
+	punpckldq	%xmm9, %xmm15	# _13, tmp568
+	punpcklqdq	%xmm8, %xmm15	# tmp506, m2
+# blake2s-vec.c:86:     FULLROUND(3);
+	.loc 1 86 267 view .LVU276
+	movd	-12(%rsp), %xmm8	# m[15], tmp821
+	paddd	%xmm15, %xmm2	# m2, _448
+.LVL101:
+# blake2s-vec.c:86:     FULLROUND(3);
+	.loc 1 86 703 view .LVU277
+	paddd	%xmm0, %xmm2	# vb, va
+.LVL102:
+	.loc 1 86 719 is_stmt 1 view .LVU278
+# blake2s-vec.c:86:     FULLROUND(3);
+	.loc 1 86 267 is_stmt 0 view .LVU279
+	punpckldq	%xmm8, %xmm13	# tmp821, tmp572
+	movd	-52(%rsp), %xmm8	# m[5], tmp823
+# blake2s-vec.c:86:     FULLROUND(3);
+	.loc 1 86 734 view .LVU280
+	pxor	%xmm2, %xmm1	# va, _154
+.LVL103:
+# blake2s-vec.c:86:     FULLROUND(3);
+	.loc 1 86 267 view .LVU281
+	movq	%xmm13, %rcx	# tmp572, tmp572
+# blake2s-vec.c:86:     FULLROUND(3);
+	.loc 1 86 724 view .LVU282
+	movdqa	%xmm1, %xmm15	# _154, tmp569
+	pslld	$24, %xmm1	#, vd
+	psrld	$8, %xmm15	#, tmp569
+	por	%xmm15, %xmm1	# tmp569, vd
+.LVL104:
+	.loc 1 86 784 is_stmt 1 view .LVU283
+# blake2s-vec.c:86:     FULLROUND(3);
+	.loc 1 86 789 is_stmt 0 view .LVU284
+	paddd	%xmm1, %xmm14	# vd, vc
+.LVL105:
+	.loc 1 86 798 is_stmt 1 view .LVU285
+# blake2s-vec.c:86:     FULLROUND(3);
+	.loc 1 86 975 is_stmt 0 view .LVU286
+	pshufd	$147, %xmm1, %xmm1	#, vd, vd
+.LVL106:
+# blake2s-vec.c:86:     FULLROUND(3);
+	.loc 1 86 813 view .LVU287
+	pxor	%xmm14, %xmm0	# vc, _157
+.LVL107:
+# blake2s-vec.c:86:     FULLROUND(3);
+	.loc 1 86 927 view .LVU288
+	pshufd	$78, %xmm14, %xmm14	#, vc, vc
+.LVL108:
+# blake2s-vec.c:86:     FULLROUND(3);
+	.loc 1 86 803 view .LVU289
+	movdqa	%xmm0, %xmm15	# _157, tmp570
+	pslld	$25, %xmm0	#, vb
+	psrld	$7, %xmm15	#, tmp570
+	por	%xmm15, %xmm0	# tmp570, vb
+.LVL109:
+	.loc 1 86 527 is_stmt 1 view .LVU290
+	.loc 1 86 876 view .LVU291
+# blake2s-vec.c:86:     FULLROUND(3);
+	.loc 1 86 267 is_stmt 0 view .LVU292
+	movdqa	%xmm3, %xmm15	# _9, tmp573
+	punpckldq	%xmm8, %xmm15	# tmp823, tmp573
+# blake2s-vec.c:86:     FULLROUND(3);
+	.loc 1 86 879 view .LVU293
+	pshufd	$57, %xmm0, %xmm0	#, vb, vb
+.LVL110:
+	.loc 1 86 924 is_stmt 1 view .LVU294
+	.loc 1 86 972 view .LVU295
+	.loc 1 86 1020 view .LVU296
+	.loc 1 86 1025 view .LVU297
+# blake2s-vec.c:86:     FULLROUND(3);
+	.loc 1 86 397 is_stmt 0 view .LVU298
+	movd	-32(%rsp), %xmm8	# m[10], tmp828
+# blake2s-vec.c:86:     FULLROUND(3);
+	.loc 1 86 267 view .LVU299
+	punpcklqdq	%xmm13, %xmm15	# tmp572, m3
+# blake2s-vec.c:86:     FULLROUND(3);
+	.loc 1 86 397 view .LVU300
+	movdqa	%xmm11, %xmm13	# tmp721, tmp578
+	paddd	%xmm15, %xmm2	# m3, _447
+.LVL111:
+	.loc 1 86 397 view .LVU301
+	punpckldq	%xmm12, %xmm13	# tmp725, tmp578
+# blake2s-vec.c:86:     FULLROUND(3);
+	.loc 1 86 1030 view .LVU302
+	paddd	%xmm0, %xmm2	# vb, va
+.LVL112:
+	.loc 1 86 1046 is_stmt 1 view .LVU303
+# blake2s-vec.c:86:     FULLROUND(3);
+	.loc 1 86 397 is_stmt 0 view .LVU304
+	movq	%xmm13, %rdi	# tmp578, tmp578
+.LVL113:
+# blake2s-vec.c:86:     FULLROUND(3);
+	.loc 1 86 1061 view .LVU305
+	pxor	%xmm2, %xmm1	# va, _164
+# blake2s-vec.c:86:     FULLROUND(3);
+	.loc 1 86 1051 view .LVU306
+	movdqa	%xmm1, %xmm15	# _164, tmp575
+	psrld	$16, %xmm1	#, vd
+	pslld	$16, %xmm15	#, tmp575
+	por	%xmm15, %xmm1	# tmp575, vd
+.LVL114:
+	.loc 1 86 1113 is_stmt 1 view .LVU307
+# blake2s-vec.c:86:     FULLROUND(3);
+	.loc 1 86 1118 is_stmt 0 view .LVU308
+	paddd	%xmm1, %xmm14	# vd, vc
+.LVL115:
+	.loc 1 86 1127 is_stmt 1 view .LVU309
+# blake2s-vec.c:86:     FULLROUND(3);
+	.loc 1 86 1142 is_stmt 0 view .LVU310
+	pxor	%xmm14, %xmm0	# vc, _167
+.LVL116:
+# blake2s-vec.c:86:     FULLROUND(3);
+	.loc 1 86 1132 view .LVU311
+	movdqa	%xmm0, %xmm15	# _167, tmp576
+	pslld	$20, %xmm0	#, vb
+	psrld	$12, %xmm15	#, tmp576
+	por	%xmm15, %xmm0	# tmp576, vb
+.LVL117:
+	.loc 1 86 1194 is_stmt 1 view .LVU312
+# blake2s-vec.c:86:     FULLROUND(3);
+	.loc 1 86 397 is_stmt 0 view .LVU313
+	movdqa	%xmm4, %xmm15	# _11, tmp579
+	punpckldq	%xmm8, %xmm15	# tmp828, tmp579
+	movq	%xmm15, %r11	# tmp579, tmp579
+	punpcklqdq	%xmm13, %xmm15	# tmp578, m4
+.LBE74:
+.LBB75:
+# blake2s-vec.c:87:     FULLROUND(4);
+	.loc 1 87 13 view .LVU314
+	movdqa	%xmm10, %xmm13	# _23, tmp584
+	paddd	%xmm15, %xmm2	# m4, _446
+.LVL118:
+	.loc 1 87 13 view .LVU315
+.LBE75:
+.LBB76:
+# blake2s-vec.c:86:     FULLROUND(3);
+	.loc 1 86 1199 view .LVU316
+	paddd	%xmm0, %xmm2	# vb, va
+.LVL119:
+	.loc 1 86 1215 is_stmt 1 view .LVU317
+# blake2s-vec.c:86:     FULLROUND(3);
+	.loc 1 86 1230 is_stmt 0 view .LVU318
+	pxor	%xmm2, %xmm1	# va, _171
+.LVL120:
+# blake2s-vec.c:86:     FULLROUND(3);
+	.loc 1 86 1220 view .LVU319
+	movdqa	%xmm1, %xmm15	# _171, tmp580
+	pslld	$24, %xmm1	#, vd
+	psrld	$8, %xmm15	#, tmp580
+	por	%xmm15, %xmm1	# tmp580, vd
+.LVL121:
+	.loc 1 86 1280 is_stmt 1 view .LVU320
+# blake2s-vec.c:86:     FULLROUND(3);
+	.loc 1 86 1285 is_stmt 0 view .LVU321
+	paddd	%xmm1, %xmm14	# vd, vc
+.LVL122:
+	.loc 1 86 1294 is_stmt 1 view .LVU322
+# blake2s-vec.c:86:     FULLROUND(3);
+	.loc 1 86 1471 is_stmt 0 view .LVU323
+	pshufd	$57, %xmm1, %xmm1	#, vd, vd
+.LVL123:
+# blake2s-vec.c:86:     FULLROUND(3);
+	.loc 1 86 1309 view .LVU324
+	pxor	%xmm14, %xmm0	# vc, _174
+.LVL124:
+# blake2s-vec.c:86:     FULLROUND(3);
+	.loc 1 86 1423 view .LVU325
+	pshufd	$78, %xmm14, %xmm14	#, vc, vc
+.LVL125:
+# blake2s-vec.c:86:     FULLROUND(3);
+	.loc 1 86 1299 view .LVU326
+	movdqa	%xmm0, %xmm15	# _174, tmp581
+	pslld	$25, %xmm0	#, vb
+	psrld	$7, %xmm15	#, tmp581
+	por	%xmm15, %xmm0	# tmp581, vb
+.LVL126:
+	.loc 1 86 1023 is_stmt 1 view .LVU327
+	.loc 1 86 1372 view .LVU328
+.LBE76:
+.LBB77:
+# blake2s-vec.c:87:     FULLROUND(4);
+	.loc 1 87 13 is_stmt 0 view .LVU329
+	movdqa	%xmm3, %xmm15	# _9, tmp583
+	punpckldq	%xmm8, %xmm15	# tmp833, tmp583
+	movd	-52(%rsp), %xmm8	# m[5], tmp835
+.LBE77:
+.LBB78:
+# blake2s-vec.c:86:     FULLROUND(3);
+	.loc 1 86 1375 view .LVU330
+	pshufd	$147, %xmm0, %xmm0	#, vb, vb
+.LVL127:
+	.loc 1 86 1420 is_stmt 1 view .LVU331
+	.loc 1 86 1468 view .LVU332
+	.loc 1 86 1468 is_stmt 0 view .LVU333
+.LBE78:
+	.loc 1 86 8 is_stmt 1 view .LVU334
+	.loc 1 87 5 view .LVU335
+.LBB79:
+	.loc 1 87 10 view .LVU336
+	.loc 1 87 137 view .LVU337
+	.loc 1 87 264 view .LVU338
+	.loc 1 87 394 view .LVU339
+	.loc 1 87 524 view .LVU340
+	.loc 1 87 529 view .LVU341
+# blake2s-vec.c:87:     FULLROUND(4);
+	.loc 1 87 13 is_stmt 0 view .LVU342
+	punpckldq	%xmm8, %xmm13	# tmp835, tmp584
+# blake2s-vec.c:87:     FULLROUND(4);
+	.loc 1 87 140 view .LVU343
+	movd	-44(%rsp), %xmm8	# m[7], tmp997
+# blake2s-vec.c:87:     FULLROUND(4);
+	.loc 1 87 13 view .LVU344
+	punpcklqdq	%xmm15, %xmm13	# tmp583, m1
+	paddd	%xmm13, %xmm2	# m1, _445
+.LVL128:
+# blake2s-vec.c:87:     FULLROUND(4);
+	.loc 1 87 267 view .LVU345
+	movd	-16(%rsp), %xmm13	# m[14], tmp595
+# blake2s-vec.c:87:     FULLROUND(4);
+	.loc 1 87 534 view .LVU346
+	paddd	%xmm0, %xmm2	# vb, va
+.LVL129:
+	.loc 1 87 550 is_stmt 1 view .LVU347
+# blake2s-vec.c:87:     FULLROUND(4);
+	.loc 1 87 565 is_stmt 0 view .LVU348
+	pxor	%xmm2, %xmm1	# va, _185
+# blake2s-vec.c:87:     FULLROUND(4);
+	.loc 1 87 267 view .LVU349
+	punpckldq	%xmm5, %xmm13	# _24, tmp595
+# blake2s-vec.c:87:     FULLROUND(4);
+	.loc 1 87 555 view .LVU350
+	movdqa	%xmm1, %xmm15	# _185, tmp586
+	psrld	$16, %xmm1	#, vd
+	pslld	$16, %xmm15	#, tmp586
+	por	%xmm15, %xmm1	# tmp586, vd
+.LVL130:
+	.loc 1 87 617 is_stmt 1 view .LVU351
+# blake2s-vec.c:87:     FULLROUND(4);
+	.loc 1 87 622 is_stmt 0 view .LVU352
+	paddd	%xmm1, %xmm14	# vd, vc
+.LVL131:
+	.loc 1 87 631 is_stmt 1 view .LVU353
+# blake2s-vec.c:87:     FULLROUND(4);
+	.loc 1 87 646 is_stmt 0 view .LVU354
+	pxor	%xmm14, %xmm0	# vc, _188
+.LVL132:
+# blake2s-vec.c:87:     FULLROUND(4);
+	.loc 1 87 636 view .LVU355
+	movdqa	%xmm0, %xmm15	# _188, tmp587
+	pslld	$20, %xmm0	#, vb
+	psrld	$12, %xmm15	#, tmp587
+	por	%xmm15, %xmm0	# tmp587, vb
+.LVL133:
+	.loc 1 87 698 is_stmt 1 view .LVU356
+# blake2s-vec.c:87:     FULLROUND(4);
+	.loc 1 87 140 is_stmt 0 view .LVU357
+	movdqa	%xmm11, %xmm15	# tmp721, tmp590
+	punpckldq	%xmm8, %xmm15	# tmp997, tmp590
+	movq	%rcx, %xmm8	# tmp572, tmp572
+	punpcklqdq	%xmm8, %xmm15	# tmp572, m2
+# blake2s-vec.c:87:     FULLROUND(4);
+	.loc 1 87 267 view .LVU358
+	movd	-60(%rsp), %xmm8	# m[3], tmp844
+	paddd	%xmm15, %xmm2	# m2, _444
+.LVL134:
+# blake2s-vec.c:87:     FULLROUND(4);
+	.loc 1 87 703 view .LVU359
+	paddd	%xmm0, %xmm2	# vb, va
+.LVL135:
+	.loc 1 87 719 is_stmt 1 view .LVU360
+# blake2s-vec.c:87:     FULLROUND(4);
+	.loc 1 87 734 is_stmt 0 view .LVU361
+	pxor	%xmm2, %xmm1	# va, _192
+.LVL136:
+# blake2s-vec.c:87:     FULLROUND(4);
+	.loc 1 87 724 view .LVU362
+	movdqa	%xmm1, %xmm15	# _192, tmp591
+	pslld	$24, %xmm1	#, vd
+	psrld	$8, %xmm15	#, tmp591
+	por	%xmm15, %xmm1	# tmp591, vd
+.LVL137:
+	.loc 1 87 784 is_stmt 1 view .LVU363
+# blake2s-vec.c:87:     FULLROUND(4);
+	.loc 1 87 789 is_stmt 0 view .LVU364
+	paddd	%xmm1, %xmm14	# vd, vc
+.LVL138:
+	.loc 1 87 798 is_stmt 1 view .LVU365
+# blake2s-vec.c:87:     FULLROUND(4);
+	.loc 1 87 975 is_stmt 0 view .LVU366
+	pshufd	$147, %xmm1, %xmm1	#, vd, vd
+.LVL139:
+# blake2s-vec.c:87:     FULLROUND(4);
+	.loc 1 87 813 view .LVU367
+	pxor	%xmm14, %xmm0	# vc, _195
+.LVL140:
+# blake2s-vec.c:87:     FULLROUND(4);
+	.loc 1 87 927 view .LVU368
+	pshufd	$78, %xmm14, %xmm14	#, vc, vc
+.LVL141:
+# blake2s-vec.c:87:     FULLROUND(4);
+	.loc 1 87 803 view .LVU369
+	movdqa	%xmm0, %xmm15	# _195, tmp592
+	pslld	$25, %xmm0	#, vb
+	psrld	$7, %xmm15	#, tmp592
+	por	%xmm15, %xmm0	# tmp592, vb
+.LVL142:
+	.loc 1 87 527 is_stmt 1 view .LVU370
+	.loc 1 87 876 view .LVU371
+# blake2s-vec.c:87:     FULLROUND(4);
+	.loc 1 87 267 is_stmt 0 view .LVU372
+	movdqa	%xmm4, %xmm15	# _11, tmp594
+	punpckldq	%xmm8, %xmm15	# tmp844, tmp594
+# blake2s-vec.c:87:     FULLROUND(4);
+	.loc 1 87 879 view .LVU373
+	pshufd	$57, %xmm0, %xmm0	#, vb, vb
+.LVL143:
+	.loc 1 87 924 is_stmt 1 view .LVU374
+	.loc 1 87 972 view .LVU375
+	.loc 1 87 1020 view .LVU376
+	.loc 1 87 1025 view .LVU377
+# blake2s-vec.c:87:     FULLROUND(4);
+	.loc 1 87 397 is_stmt 0 view .LVU378
+	movd	-20(%rsp), %xmm8	# m[13], tmp851
+# blake2s-vec.c:87:     FULLROUND(4);
+	.loc 1 87 267 view .LVU379
+	punpcklqdq	%xmm15, %xmm13	# tmp594, m3
+	paddd	%xmm13, %xmm2	# m3, _443
+.LVL144:
+# blake2s-vec.c:87:     FULLROUND(4);
+	.loc 1 87 397 view .LVU380
+	movdqa	%xmm9, %xmm13	# _13, tmp601
+# blake2s-vec.c:87:     FULLROUND(4);
+	.loc 1 87 1030 view .LVU381
+	paddd	%xmm0, %xmm2	# vb, va
+.LVL145:
+	.loc 1 87 1046 is_stmt 1 view .LVU382
+# blake2s-vec.c:87:     FULLROUND(4);
+	.loc 1 87 397 is_stmt 0 view .LVU383
+	punpckldq	%xmm7, %xmm13	# tmp727, tmp601
+# blake2s-vec.c:87:     FULLROUND(4);
+	.loc 1 87 1061 view .LVU384
+	pxor	%xmm2, %xmm1	# va, _202
+# blake2s-vec.c:87:     FULLROUND(4);
+	.loc 1 87 1051 view .LVU385
+	movdqa	%xmm1, %xmm15	# _202, tmp597
+	psrld	$16, %xmm1	#, vd
+	pslld	$16, %xmm15	#, tmp597
+	por	%xmm15, %xmm1	# tmp597, vd
+.LVL146:
+	.loc 1 87 1113 is_stmt 1 view .LVU386
+# blake2s-vec.c:87:     FULLROUND(4);
+	.loc 1 87 1118 is_stmt 0 view .LVU387
+	paddd	%xmm1, %xmm14	# vd, vc
+.LVL147:
+	.loc 1 87 1127 is_stmt 1 view .LVU388
+# blake2s-vec.c:87:     FULLROUND(4);
+	.loc 1 87 1142 is_stmt 0 view .LVU389
+	pxor	%xmm14, %xmm0	# vc, _205
+.LVL148:
+# blake2s-vec.c:87:     FULLROUND(4);
+	.loc 1 87 1132 view .LVU390
+	movdqa	%xmm0, %xmm15	# _205, tmp598
+	pslld	$20, %xmm0	#, vb
+	psrld	$12, %xmm15	#, tmp598
+	por	%xmm15, %xmm0	# tmp598, vb
+.LVL149:
+	.loc 1 87 1194 is_stmt 1 view .LVU391
+# blake2s-vec.c:87:     FULLROUND(4);
+	.loc 1 87 397 is_stmt 0 view .LVU392
+	movdqa	%xmm12, %xmm15	# tmp725, tmp600
+	punpckldq	%xmm8, %xmm15	# tmp851, tmp600
+.LBE79:
+.LBB80:
+# blake2s-vec.c:88:     FULLROUND(5);
+	.loc 1 88 13 view .LVU393
+	movq	%rdi, %xmm8	# tmp578, tmp578
+.LBE80:
+.LBB81:
+# blake2s-vec.c:87:     FULLROUND(4);
+	.loc 1 87 397 view .LVU394
+	punpcklqdq	%xmm15, %xmm13	# tmp600, m4
+	paddd	%xmm13, %xmm2	# m4, _442
+.LVL150:
+	.loc 1 87 397 view .LVU395
+.LBE81:
+.LBB82:
+# blake2s-vec.c:88:     FULLROUND(5);
+	.loc 1 88 140 view .LVU396
+	movdqa	%xmm7, %xmm13	# tmp727, tmp612
+.LBE82:
+.LBB83:
+# blake2s-vec.c:87:     FULLROUND(4);
+	.loc 1 87 1199 view .LVU397
+	paddd	%xmm0, %xmm2	# vb, va
+.LVL151:
+	.loc 1 87 1215 is_stmt 1 view .LVU398
+# blake2s-vec.c:87:     FULLROUND(4);
+	.loc 1 87 1230 is_stmt 0 view .LVU399
+	pxor	%xmm2, %xmm1	# va, _209
+.LVL152:
+# blake2s-vec.c:87:     FULLROUND(4);
+	.loc 1 87 1220 view .LVU400
+	movdqa	%xmm1, %xmm15	# _209, tmp602
+	pslld	$24, %xmm1	#, vd
+	psrld	$8, %xmm15	#, tmp602
+	por	%xmm15, %xmm1	# tmp602, vd
+.LVL153:
+	.loc 1 87 1280 is_stmt 1 view .LVU401
+# blake2s-vec.c:87:     FULLROUND(4);
+	.loc 1 87 1285 is_stmt 0 view .LVU402
+	paddd	%xmm1, %xmm14	# vd, vc
+.LVL154:
+	.loc 1 87 1294 is_stmt 1 view .LVU403
+# blake2s-vec.c:87:     FULLROUND(4);
+	.loc 1 87 1471 is_stmt 0 view .LVU404
+	pshufd	$57, %xmm1, %xmm1	#, vd, vd
+.LVL155:
+# blake2s-vec.c:87:     FULLROUND(4);
+	.loc 1 87 1309 view .LVU405
+	pxor	%xmm14, %xmm0	# vc, _212
+.LVL156:
+# blake2s-vec.c:87:     FULLROUND(4);
+	.loc 1 87 1423 view .LVU406
+	pshufd	$78, %xmm14, %xmm14	#, vc, vc
+.LVL157:
+# blake2s-vec.c:87:     FULLROUND(4);
+	.loc 1 87 1299 view .LVU407
+	movdqa	%xmm0, %xmm15	# _212, tmp603
+	pslld	$25, %xmm0	#, vb
+	psrld	$7, %xmm15	#, tmp603
+	por	%xmm15, %xmm0	# tmp603, vb
+.LVL158:
+	.loc 1 87 1023 is_stmt 1 view .LVU408
+	.loc 1 87 1372 view .LVU409
+.LBE83:
+.LBB84:
+# blake2s-vec.c:88:     FULLROUND(5);
+	.loc 1 88 13 is_stmt 0 view .LVU410
+	movdqa	%xmm3, %xmm15	# _9, tmp606
+	punpckldq	%xmm4, %xmm15	# _11, tmp606
+.LBE84:
+.LBB85:
+# blake2s-vec.c:87:     FULLROUND(4);
+	.loc 1 87 1375 view .LVU411
+	pshufd	$147, %xmm0, %xmm0	#, vb, vb
+.LVL159:
+	.loc 1 87 1420 is_stmt 1 view .LVU412
+	.loc 1 87 1468 view .LVU413
+	.loc 1 87 1468 is_stmt 0 view .LVU414
+.LBE85:
+	.loc 1 87 8 is_stmt 1 view .LVU415
+	.loc 1 88 5 view .LVU416
+.LBB86:
+	.loc 1 88 10 view .LVU417
+	.loc 1 88 137 view .LVU418
+	.loc 1 88 264 view .LVU419
+	.loc 1 88 394 view .LVU420
+	.loc 1 88 524 view .LVU421
+	.loc 1 88 529 view .LVU422
+# blake2s-vec.c:88:     FULLROUND(5);
+	.loc 1 88 13 is_stmt 0 view .LVU423
+	punpcklqdq	%xmm8, %xmm15	# tmp578, m1
+# blake2s-vec.c:88:     FULLROUND(5);
+	.loc 1 88 140 view .LVU424
+	movd	-60(%rsp), %xmm8	# m[3], tmp861
+	paddd	%xmm15, %xmm2	# m1, _441
+.LVL160:
+# blake2s-vec.c:88:     FULLROUND(5);
+	.loc 1 88 534 view .LVU425
+	paddd	%xmm0, %xmm2	# vb, va
+.LVL161:
+	.loc 1 88 550 is_stmt 1 view .LVU426
+# blake2s-vec.c:88:     FULLROUND(5);
+	.loc 1 88 565 is_stmt 0 view .LVU427
+	pxor	%xmm2, %xmm1	# va, _223
+# blake2s-vec.c:88:     FULLROUND(5);
+	.loc 1 88 555 view .LVU428
+	movdqa	%xmm1, %xmm15	# _223, tmp608
+	psrld	$16, %xmm1	#, vd
+	pslld	$16, %xmm15	#, tmp608
+	por	%xmm15, %xmm1	# tmp608, vd
+.LVL162:
+	.loc 1 88 617 is_stmt 1 view .LVU429
+# blake2s-vec.c:88:     FULLROUND(5);
+	.loc 1 88 622 is_stmt 0 view .LVU430
+	paddd	%xmm1, %xmm14	# vd, vc
+.LVL163:
+	.loc 1 88 631 is_stmt 1 view .LVU431
+# blake2s-vec.c:88:     FULLROUND(5);
+	.loc 1 88 646 is_stmt 0 view .LVU432
+	pxor	%xmm14, %xmm0	# vc, _226
+.LVL164:
+# blake2s-vec.c:88:     FULLROUND(5);
+	.loc 1 88 636 view .LVU433
+	movdqa	%xmm0, %xmm15	# _226, tmp609
+	pslld	$20, %xmm0	#, vb
+	psrld	$12, %xmm15	#, tmp609
+	por	%xmm15, %xmm0	# tmp609, vb
+.LVL165:
+	.loc 1 88 698 is_stmt 1 view .LVU434
+# blake2s-vec.c:88:     FULLROUND(5);
+	.loc 1 88 140 is_stmt 0 view .LVU435
+	movdqa	%xmm5, %xmm15	# _24, tmp611
+	punpckldq	%xmm8, %xmm15	# tmp861, tmp611
+	movd	-32(%rsp), %xmm8	# m[10], tmp863
+	punpckldq	%xmm8, %xmm13	# tmp863, tmp612
+# blake2s-vec.c:88:     FULLROUND(5);
+	.loc 1 88 267 view .LVU436
+	movd	-44(%rsp), %xmm8	# m[7], tmp994
+# blake2s-vec.c:88:     FULLROUND(5);
+	.loc 1 88 140 view .LVU437
+	punpcklqdq	%xmm15, %xmm13	# tmp611, m2
+	paddd	%xmm13, %xmm2	# m2, _440
+.LVL166:
+# blake2s-vec.c:88:     FULLROUND(5);
+	.loc 1 88 267 view .LVU438
+	movdqa	%xmm6, %xmm13	# tmp723, tmp617
+# blake2s-vec.c:88:     FULLROUND(5);
+	.loc 1 88 703 view .LVU439
+	paddd	%xmm0, %xmm2	# vb, va
+.LVL167:
+	.loc 1 88 719 is_stmt 1 view .LVU440
+# blake2s-vec.c:88:     FULLROUND(5);
+	.loc 1 88 267 is_stmt 0 view .LVU441
+	punpckldq	%xmm8, %xmm13	# tmp994, tmp617
+# blake2s-vec.c:88:     FULLROUND(5);
+	.loc 1 88 397 view .LVU442
+	movd	-52(%rsp), %xmm8	# m[5], tmp876
+# blake2s-vec.c:88:     FULLROUND(5);
+	.loc 1 88 734 view .LVU443
+	pxor	%xmm2, %xmm1	# va, _230
+.LVL168:
+# blake2s-vec.c:88:     FULLROUND(5);
+	.loc 1 88 724 view .LVU444
+	movdqa	%xmm1, %xmm15	# _230, tmp613
+	pslld	$24, %xmm1	#, vd
+	psrld	$8, %xmm15	#, tmp613
+	por	%xmm15, %xmm1	# tmp613, vd
+.LVL169:
+	.loc 1 88 784 is_stmt 1 view .LVU445
+# blake2s-vec.c:88:     FULLROUND(5);
+	.loc 1 88 789 is_stmt 0 view .LVU446
+	paddd	%xmm1, %xmm14	# vd, vc
+.LVL170:
+	.loc 1 88 798 is_stmt 1 view .LVU447
+# blake2s-vec.c:88:     FULLROUND(5);
+	.loc 1 88 975 is_stmt 0 view .LVU448
+	pshufd	$147, %xmm1, %xmm1	#, vd, vd
+.LVL171:
+# blake2s-vec.c:88:     FULLROUND(5);
+	.loc 1 88 813 view .LVU449
+	pxor	%xmm14, %xmm0	# vc, _233
+.LVL172:
+# blake2s-vec.c:88:     FULLROUND(5);
+	.loc 1 88 927 view .LVU450
+	pshufd	$78, %xmm14, %xmm14	#, vc, vc
+.LVL173:
+# blake2s-vec.c:88:     FULLROUND(5);
+	.loc 1 88 803 view .LVU451
+	movdqa	%xmm0, %xmm15	# _233, tmp614
+	pslld	$25, %xmm0	#, vb
+	psrld	$7, %xmm15	#, tmp614
+	por	%xmm15, %xmm0	# tmp614, vb
+.LVL174:
+	.loc 1 88 527 is_stmt 1 view .LVU452
+	.loc 1 88 876 view .LVU453
+# blake2s-vec.c:88:     FULLROUND(5);
+	.loc 1 88 267 is_stmt 0 view .LVU454
+	movd	-12(%rsp), %xmm15	# m[15], tmp616
+# blake2s-vec.c:88:     FULLROUND(5);
+	.loc 1 88 879 view .LVU455
+	pshufd	$57, %xmm0, %xmm0	#, vb, vb
+.LVL175:
+	.loc 1 88 924 is_stmt 1 view .LVU456
+	.loc 1 88 972 view .LVU457
+	.loc 1 88 1020 view .LVU458
+	.loc 1 88 1025 view .LVU459
+# blake2s-vec.c:88:     FULLROUND(5);
+	.loc 1 88 267 is_stmt 0 view .LVU460
+	punpckldq	%xmm9, %xmm15	# _13, tmp616
+	punpcklqdq	%xmm15, %xmm13	# tmp616, m3
+	paddd	%xmm13, %xmm2	# m3, _439
+.LVL176:
+# blake2s-vec.c:88:     FULLROUND(5);
+	.loc 1 88 397 view .LVU461
+	movd	-20(%rsp), %xmm13	# m[13], tmp623
+# blake2s-vec.c:88:     FULLROUND(5);
+	.loc 1 88 1030 view .LVU462
+	paddd	%xmm0, %xmm2	# vb, va
+.LVL177:
+	.loc 1 88 1046 is_stmt 1 view .LVU463
+# blake2s-vec.c:88:     FULLROUND(5);
+	.loc 1 88 1061 is_stmt 0 view .LVU464
+	pxor	%xmm2, %xmm1	# va, _240
+# blake2s-vec.c:88:     FULLROUND(5);
+	.loc 1 88 397 view .LVU465
+	punpckldq	%xmm8, %xmm13	# tmp876, tmp623
+.LBE86:
+.LBB87:
+# blake2s-vec.c:89:     FULLROUND(6);
+	.loc 1 89 13 view .LVU466
+	movq	%rdx, %xmm8	# tmp518, tmp518
+.LBE87:
+.LBB88:
+# blake2s-vec.c:88:     FULLROUND(5);
+	.loc 1 88 1051 view .LVU467
+	movdqa	%xmm1, %xmm15	# _240, tmp619
+	psrld	$16, %xmm1	#, vd
+	pslld	$16, %xmm15	#, tmp619
+	por	%xmm15, %xmm1	# tmp619, vd
+.LVL178:
+	.loc 1 88 1113 is_stmt 1 view .LVU468
+# blake2s-vec.c:88:     FULLROUND(5);
+	.loc 1 88 1118 is_stmt 0 view .LVU469
+	paddd	%xmm1, %xmm14	# vd, vc
+.LVL179:
+	.loc 1 88 1127 is_stmt 1 view .LVU470
+# blake2s-vec.c:88:     FULLROUND(5);
+	.loc 1 88 1142 is_stmt 0 view .LVU471
+	pxor	%xmm14, %xmm0	# vc, _243
+.LVL180:
+# blake2s-vec.c:88:     FULLROUND(5);
+	.loc 1 88 1132 view .LVU472
+	movdqa	%xmm0, %xmm15	# _243, tmp620
+	pslld	$20, %xmm0	#, vb
+	psrld	$12, %xmm15	#, tmp620
+	por	%xmm15, %xmm0	# tmp620, vb
+.LVL181:
+	.loc 1 88 1194 is_stmt 1 view .LVU473
+# blake2s-vec.c:88:     FULLROUND(5);
+	.loc 1 88 397 is_stmt 0 view .LVU474
+	movd	-16(%rsp), %xmm15	# m[14], tmp622
+	punpckldq	%xmm10, %xmm15	# _23, tmp622
+	punpcklqdq	%xmm15, %xmm13	# tmp622, m4
+	paddd	%xmm13, %xmm2	# m4, _438
+.LVL182:
+	.loc 1 88 397 view .LVU475
+.LBE88:
+.LBB89:
+# blake2s-vec.c:89:     FULLROUND(6);
+	.loc 1 89 140 view .LVU476
+	movq	%r10, %xmm13	# tmp539, m2
+.LBE89:
+.LBB90:
+# blake2s-vec.c:88:     FULLROUND(5);
+	.loc 1 88 1199 view .LVU477
+	paddd	%xmm0, %xmm2	# vb, va
+.LVL183:
+	.loc 1 88 1215 is_stmt 1 view .LVU478
+# blake2s-vec.c:88:     FULLROUND(5);
+	.loc 1 88 1230 is_stmt 0 view .LVU479
+	pxor	%xmm2, %xmm1	# va, _247
+.LVL184:
+# blake2s-vec.c:88:     FULLROUND(5);
+	.loc 1 88 1220 view .LVU480
+	movdqa	%xmm1, %xmm15	# _247, tmp624
+	pslld	$24, %xmm1	#, vd
+	psrld	$8, %xmm15	#, tmp624
+	por	%xmm15, %xmm1	# tmp624, vd
+.LVL185:
+	.loc 1 88 1280 is_stmt 1 view .LVU481
+# blake2s-vec.c:88:     FULLROUND(5);
+	.loc 1 88 1285 is_stmt 0 view .LVU482
+	paddd	%xmm1, %xmm14	# vd, vc
+.LVL186:
+	.loc 1 88 1294 is_stmt 1 view .LVU483
+# blake2s-vec.c:88:     FULLROUND(5);
+	.loc 1 88 1471 is_stmt 0 view .LVU484
+	pshufd	$57, %xmm1, %xmm1	#, vd, vd
+.LVL187:
+# blake2s-vec.c:88:     FULLROUND(5);
+	.loc 1 88 1309 view .LVU485
+	pxor	%xmm14, %xmm0	# vc, _250
+.LVL188:
+# blake2s-vec.c:88:     FULLROUND(5);
+	.loc 1 88 1423 view .LVU486
+	pshufd	$78, %xmm14, %xmm14	#, vc, vc
+.LVL189:
+# blake2s-vec.c:88:     FULLROUND(5);
+	.loc 1 88 1299 view .LVU487
+	movdqa	%xmm0, %xmm15	# _250, tmp625
+	pslld	$25, %xmm0	#, vb
+	psrld	$7, %xmm15	#, tmp625
+	por	%xmm15, %xmm0	# tmp625, vb
+.LVL190:
+	.loc 1 88 1023 is_stmt 1 view .LVU488
+	.loc 1 88 1372 view .LVU489
+.LBE90:
+.LBB91:
+# blake2s-vec.c:89:     FULLROUND(6);
+	.loc 1 89 13 is_stmt 0 view .LVU490
+	movdqa	%xmm7, %xmm15	# tmp727, tmp628
+	punpckldq	%xmm9, %xmm15	# _13, tmp628
+.LBE91:
+.LBB92:
+# blake2s-vec.c:88:     FULLROUND(5);
+	.loc 1 88 1375 view .LVU491
+	pshufd	$147, %xmm0, %xmm0	#, vb, vb
+.LVL191:
+	.loc 1 88 1420 is_stmt 1 view .LVU492
+	.loc 1 88 1468 view .LVU493
+	.loc 1 88 1468 is_stmt 0 view .LVU494
+.LBE92:
+	.loc 1 88 8 is_stmt 1 view .LVU495
+	.loc 1 89 5 view .LVU496
+.LBB93:
+	.loc 1 89 10 view .LVU497
+	.loc 1 89 137 view .LVU498
+	.loc 1 89 264 view .LVU499
+	.loc 1 89 394 view .LVU500
+	.loc 1 89 524 view .LVU501
+	.loc 1 89 529 view .LVU502
+# blake2s-vec.c:89:     FULLROUND(6);
+	.loc 1 89 13 is_stmt 0 view .LVU503
+	punpcklqdq	%xmm8, %xmm15	# tmp518, m1
+# blake2s-vec.c:89:     FULLROUND(6);
+	.loc 1 89 140 view .LVU504
+	movd	-32(%rsp), %xmm8	# m[10], tmp885
+	paddd	%xmm15, %xmm2	# m1, _437
+.LVL192:
+# blake2s-vec.c:89:     FULLROUND(6);
+	.loc 1 89 534 view .LVU505
+	paddd	%xmm0, %xmm2	# vb, va
+.LVL193:
+	.loc 1 89 550 is_stmt 1 view .LVU506
+# blake2s-vec.c:89:     FULLROUND(6);
+	.loc 1 89 565 is_stmt 0 view .LVU507
+	pxor	%xmm2, %xmm1	# va, _261
+# blake2s-vec.c:89:     FULLROUND(6);
+	.loc 1 89 555 view .LVU508
+	movdqa	%xmm1, %xmm15	# _261, tmp630
+	psrld	$16, %xmm1	#, vd
+	pslld	$16, %xmm15	#, tmp630
+	por	%xmm15, %xmm1	# tmp630, vd
+.LVL194:
+	.loc 1 89 617 is_stmt 1 view .LVU509
+# blake2s-vec.c:89:     FULLROUND(6);
+	.loc 1 89 622 is_stmt 0 view .LVU510
+	paddd	%xmm1, %xmm14	# vd, vc
+.LVL195:
+	.loc 1 89 631 is_stmt 1 view .LVU511
+# blake2s-vec.c:89:     FULLROUND(6);
+	.loc 1 89 646 is_stmt 0 view .LVU512
+	pxor	%xmm14, %xmm0	# vc, _264
+.LVL196:
+# blake2s-vec.c:89:     FULLROUND(6);
+	.loc 1 89 636 view .LVU513
+	movdqa	%xmm0, %xmm15	# _264, tmp631
+	pslld	$20, %xmm0	#, vb
+	psrld	$12, %xmm15	#, tmp631
+	por	%xmm15, %xmm0	# tmp631, vb
+.LVL197:
+	.loc 1 89 698 is_stmt 1 view .LVU514
+# blake2s-vec.c:89:     FULLROUND(6);
+	.loc 1 89 140 is_stmt 0 view .LVU515
+	movd	-20(%rsp), %xmm15	# m[13], tmp633
+	punpckldq	%xmm8, %xmm15	# tmp885, tmp633
+.LBE93:
+.LBB94:
+# blake2s-vec.c:90:     FULLROUND(7);
+	.loc 1 90 13 view .LVU516
+	movd	-60(%rsp), %xmm8	# m[3], tmp902
+.LBE94:
+.LBB95:
+# blake2s-vec.c:89:     FULLROUND(6);
+	.loc 1 89 140 view .LVU517
+	punpcklqdq	%xmm15, %xmm13	# tmp633, m2
+	paddd	%xmm13, %xmm2	# m2, _436
+.LVL198:
+# blake2s-vec.c:89:     FULLROUND(6);
+	.loc 1 89 267 view .LVU518
+	movdqa	%xmm11, %xmm13	# tmp721, tmp639
+# blake2s-vec.c:89:     FULLROUND(6);
+	.loc 1 89 703 view .LVU519
+	paddd	%xmm0, %xmm2	# vb, va
+.LVL199:
+	.loc 1 89 719 is_stmt 1 view .LVU520
+# blake2s-vec.c:89:     FULLROUND(6);
+	.loc 1 89 267 is_stmt 0 view .LVU521
+	punpckldq	%xmm4, %xmm13	# _11, tmp639
+# blake2s-vec.c:89:     FULLROUND(6);
+	.loc 1 89 734 view .LVU522
+	pxor	%xmm2, %xmm1	# va, _268
+.LVL200:
+# blake2s-vec.c:89:     FULLROUND(6);
+	.loc 1 89 724 view .LVU523
+	movdqa	%xmm1, %xmm15	# _268, tmp635
+	pslld	$24, %xmm1	#, vd
+	psrld	$8, %xmm15	#, tmp635
+	por	%xmm15, %xmm1	# tmp635, vd
+.LVL201:
+	.loc 1 89 784 is_stmt 1 view .LVU524
+# blake2s-vec.c:89:     FULLROUND(6);
+	.loc 1 89 789 is_stmt 0 view .LVU525
+	paddd	%xmm1, %xmm14	# vd, vc
+.LVL202:
+	.loc 1 89 798 is_stmt 1 view .LVU526
+# blake2s-vec.c:89:     FULLROUND(6);
+	.loc 1 89 975 is_stmt 0 view .LVU527
+	pshufd	$147, %xmm1, %xmm1	#, vd, vd
+.LVL203:
+# blake2s-vec.c:89:     FULLROUND(6);
+	.loc 1 89 813 view .LVU528
+	pxor	%xmm14, %xmm0	# vc, _271
+.LVL204:
+# blake2s-vec.c:89:     FULLROUND(6);
+	.loc 1 89 927 view .LVU529
+	pshufd	$78, %xmm14, %xmm14	#, vc, vc
+.LVL205:
+# blake2s-vec.c:89:     FULLROUND(6);
+	.loc 1 89 803 view .LVU530
+	movdqa	%xmm0, %xmm15	# _271, tmp636
+	pslld	$25, %xmm0	#, vb
+	psrld	$7, %xmm15	#, tmp636
+	por	%xmm15, %xmm0	# tmp636, vb
+.LVL206:
+	.loc 1 89 527 is_stmt 1 view .LVU531
+	.loc 1 89 876 view .LVU532
+# blake2s-vec.c:89:     FULLROUND(6);
+	.loc 1 89 267 is_stmt 0 view .LVU533
+	movdqa	%xmm10, %xmm15	# _23, tmp638
+	punpckldq	%xmm12, %xmm15	# tmp725, tmp638
+# blake2s-vec.c:89:     FULLROUND(6);
+	.loc 1 89 879 view .LVU534
+	pshufd	$57, %xmm0, %xmm0	#, vb, vb
+.LVL207:
+	.loc 1 89 924 is_stmt 1 view .LVU535
+	.loc 1 89 972 view .LVU536
+	.loc 1 89 1020 view .LVU537
+	.loc 1 89 1025 view .LVU538
+# blake2s-vec.c:89:     FULLROUND(6);
+	.loc 1 89 267 is_stmt 0 view .LVU539
+	punpcklqdq	%xmm15, %xmm13	# tmp638, m3
+	paddd	%xmm13, %xmm2	# m3, _435
+.LVL208:
+# blake2s-vec.c:89:     FULLROUND(6);
+	.loc 1 89 397 view .LVU540
+	movq	%rax, %xmm13	# tmp534, m4
+# blake2s-vec.c:89:     FULLROUND(6);
+	.loc 1 89 1030 view .LVU541
+	paddd	%xmm0, %xmm2	# vb, va
+.LVL209:
+	.loc 1 89 1046 is_stmt 1 view .LVU542
+# blake2s-vec.c:89:     FULLROUND(6);
+	.loc 1 89 1061 is_stmt 0 view .LVU543
+	pxor	%xmm2, %xmm1	# va, _278
+# blake2s-vec.c:89:     FULLROUND(6);
+	.loc 1 89 1051 view .LVU544
+	movdqa	%xmm1, %xmm15	# _278, tmp641
+	psrld	$16, %xmm1	#, vd
+	pslld	$16, %xmm15	#, tmp641
+	por	%xmm15, %xmm1	# tmp641, vd
+.LVL210:
+	.loc 1 89 1113 is_stmt 1 view .LVU545
+# blake2s-vec.c:89:     FULLROUND(6);
+	.loc 1 89 1118 is_stmt 0 view .LVU546
+	paddd	%xmm1, %xmm14	# vd, vc
+.LVL211:
+	.loc 1 89 1127 is_stmt 1 view .LVU547
+# blake2s-vec.c:89:     FULLROUND(6);
+	.loc 1 89 1142 is_stmt 0 view .LVU548
+	pxor	%xmm14, %xmm0	# vc, _281
+.LVL212:
+# blake2s-vec.c:89:     FULLROUND(6);
+	.loc 1 89 1132 view .LVU549
+	movdqa	%xmm0, %xmm15	# _281, tmp642
+	pslld	$20, %xmm0	#, vb
+	psrld	$12, %xmm15	#, tmp642
+	por	%xmm15, %xmm0	# tmp642, vb
+.LVL213:
+	.loc 1 89 1194 is_stmt 1 view .LVU550
+# blake2s-vec.c:89:     FULLROUND(6);
+	.loc 1 89 397 is_stmt 0 view .LVU551
+	movdqa	%xmm3, %xmm15	# _9, tmp644
+	punpckldq	%xmm5, %xmm15	# _24, tmp644
+	punpcklqdq	%xmm15, %xmm13	# tmp644, m4
+	paddd	%xmm13, %xmm2	# m4, _434
+.LVL214:
+	.loc 1 89 397 view .LVU552
+.LBE95:
+.LBB96:
+# blake2s-vec.c:90:     FULLROUND(7);
+	.loc 1 90 13 view .LVU553
+	movd	-20(%rsp), %xmm13	# m[13], tmp650
+.LBE96:
+.LBB97:
+# blake2s-vec.c:89:     FULLROUND(6);
+	.loc 1 89 1199 view .LVU554
+	paddd	%xmm0, %xmm2	# vb, va
+.LVL215:
+	.loc 1 89 1215 is_stmt 1 view .LVU555
+# blake2s-vec.c:89:     FULLROUND(6);
+	.loc 1 89 1230 is_stmt 0 view .LVU556
+	pxor	%xmm2, %xmm1	# va, _285
+.LVL216:
+# blake2s-vec.c:89:     FULLROUND(6);
+	.loc 1 89 1220 view .LVU557
+	movdqa	%xmm1, %xmm15	# _285, tmp646
+	pslld	$24, %xmm1	#, vd
+	psrld	$8, %xmm15	#, tmp646
+	por	%xmm15, %xmm1	# tmp646, vd
+.LVL217:
+	.loc 1 89 1280 is_stmt 1 view .LVU558
+# blake2s-vec.c:89:     FULLROUND(6);
+	.loc 1 89 1285 is_stmt 0 view .LVU559
+	paddd	%xmm1, %xmm14	# vd, vc
+.LVL218:
+	.loc 1 89 1294 is_stmt 1 view .LVU560
+# blake2s-vec.c:89:     FULLROUND(6);
+	.loc 1 89 1471 is_stmt 0 view .LVU561
+	pshufd	$57, %xmm1, %xmm1	#, vd, vd
+.LVL219:
+# blake2s-vec.c:89:     FULLROUND(6);
+	.loc 1 89 1309 view .LVU562
+	pxor	%xmm14, %xmm0	# vc, _288
+.LVL220:
+# blake2s-vec.c:89:     FULLROUND(6);
+	.loc 1 89 1423 view .LVU563
+	pshufd	$78, %xmm14, %xmm14	#, vc, vc
+.LVL221:
+# blake2s-vec.c:89:     FULLROUND(6);
+	.loc 1 89 1299 view .LVU564
+	movdqa	%xmm0, %xmm15	# _288, tmp647
+	pslld	$25, %xmm0	#, vb
+	psrld	$7, %xmm15	#, tmp647
+	por	%xmm15, %xmm0	# tmp647, vb
+.LVL222:
+	.loc 1 89 1023 is_stmt 1 view .LVU565
+	.loc 1 89 1372 view .LVU566
+.LBE97:
+.LBB98:
+# blake2s-vec.c:90:     FULLROUND(7);
+	.loc 1 90 13 is_stmt 0 view .LVU567
+	movdqa	%xmm7, %xmm15	# tmp727, tmp649
+	punpckldq	%xmm8, %xmm15	# tmp902, tmp649
+	movd	-44(%rsp), %xmm8	# m[7], tmp992
+.LBE98:
+.LBB99:
+# blake2s-vec.c:89:     FULLROUND(6);
+	.loc 1 89 1375 view .LVU568
+	pshufd	$147, %xmm0, %xmm0	#, vb, vb
+.LVL223:
+	.loc 1 89 1420 is_stmt 1 view .LVU569
+	.loc 1 89 1468 view .LVU570
+	.loc 1 89 1468 is_stmt 0 view .LVU571
+.LBE99:
+	.loc 1 89 8 is_stmt 1 view .LVU572
+	.loc 1 90 5 view .LVU573
+.LBB100:
+	.loc 1 90 10 view .LVU574
+	.loc 1 90 137 view .LVU575
+	.loc 1 90 264 view .LVU576
+	.loc 1 90 394 view .LVU577
+	.loc 1 90 524 view .LVU578
+	.loc 1 90 529 view .LVU579
+# blake2s-vec.c:90:     FULLROUND(7);
+	.loc 1 90 13 is_stmt 0 view .LVU580
+	punpckldq	%xmm8, %xmm13	# tmp992, tmp650
+# blake2s-vec.c:90:     FULLROUND(7);
+	.loc 1 90 140 view .LVU581
+	movd	-16(%rsp), %xmm8	# m[14], tmp991
+# blake2s-vec.c:90:     FULLROUND(7);
+	.loc 1 90 13 view .LVU582
+	punpcklqdq	%xmm15, %xmm13	# tmp649, m1
+	paddd	%xmm13, %xmm2	# m1, _433
+.LVL224:
+# blake2s-vec.c:90:     FULLROUND(7);
+	.loc 1 90 140 view .LVU583
+	movdqa	%xmm5, %xmm13	# _24, tmp656
+.LBE100:
+.LBB101:
+# blake2s-vec.c:91:     FULLROUND(8);
+	.loc 1 91 13 view .LVU584
+	punpckldq	%xmm11, %xmm5	# tmp721, tmp671
+.LVL225:
+	.loc 1 91 13 view .LVU585
+.LBE101:
+.LBB102:
+# blake2s-vec.c:90:     FULLROUND(7);
+	.loc 1 90 534 view .LVU586
+	paddd	%xmm0, %xmm2	# vb, va
+.LVL226:
+	.loc 1 90 550 is_stmt 1 view .LVU587
+# blake2s-vec.c:90:     FULLROUND(7);
+	.loc 1 90 140 is_stmt 0 view .LVU588
+	punpckldq	%xmm8, %xmm13	# tmp991, tmp656
+.LVL227:
+# blake2s-vec.c:90:     FULLROUND(7);
+	.loc 1 90 397 view .LVU589
+	movq	%r11, %xmm8	# tmp579, tmp579
+# blake2s-vec.c:90:     FULLROUND(7);
+	.loc 1 90 565 view .LVU590
+	pxor	%xmm2, %xmm1	# va, _299
+# blake2s-vec.c:90:     FULLROUND(7);
+	.loc 1 90 140 view .LVU591
+	movq	%xmm13, %rax	# tmp656, tmp656
+# blake2s-vec.c:90:     FULLROUND(7);
+	.loc 1 90 555 view .LVU592
+	movdqa	%xmm1, %xmm15	# _299, tmp652
+	psrld	$16, %xmm1	#, vd
+	pslld	$16, %xmm15	#, tmp652
+	por	%xmm15, %xmm1	# tmp652, vd
+.LVL228:
+	.loc 1 90 617 is_stmt 1 view .LVU593
+# blake2s-vec.c:90:     FULLROUND(7);
+	.loc 1 90 622 is_stmt 0 view .LVU594
+	paddd	%xmm1, %xmm14	# vd, vc
+.LVL229:
+	.loc 1 90 631 is_stmt 1 view .LVU595
+# blake2s-vec.c:90:     FULLROUND(7);
+	.loc 1 90 646 is_stmt 0 view .LVU596
+	pxor	%xmm14, %xmm0	# vc, _302
+.LVL230:
+# blake2s-vec.c:90:     FULLROUND(7);
+	.loc 1 90 636 view .LVU597
+	movdqa	%xmm0, %xmm15	# _302, tmp653
+	pslld	$20, %xmm0	#, vb
+	psrld	$12, %xmm15	#, tmp653
+	por	%xmm15, %xmm0	# tmp653, vb
+.LVL231:
+	.loc 1 90 698 is_stmt 1 view .LVU598
+# blake2s-vec.c:90:     FULLROUND(7);
+	.loc 1 90 140 is_stmt 0 view .LVU599
+	movdqa	%xmm9, %xmm15	# _13, tmp655
+	punpckldq	%xmm10, %xmm15	# _23, tmp655
+	punpcklqdq	%xmm15, %xmm13	# tmp655, m2
+	paddd	%xmm13, %xmm2	# m2, _432
+.LVL232:
+# blake2s-vec.c:90:     FULLROUND(7);
+	.loc 1 90 267 view .LVU600
+	movdqa	%xmm12, %xmm13	# tmp725, tmp660
+# blake2s-vec.c:90:     FULLROUND(7);
+	.loc 1 90 703 view .LVU601
+	paddd	%xmm0, %xmm2	# vb, va
+.LVL233:
+	.loc 1 90 719 is_stmt 1 view .LVU602
+# blake2s-vec.c:90:     FULLROUND(7);
+	.loc 1 90 267 is_stmt 0 view .LVU603
+	punpckldq	%xmm3, %xmm13	# _9, tmp660
+# blake2s-vec.c:90:     FULLROUND(7);
+	.loc 1 90 734 view .LVU604
+	pxor	%xmm2, %xmm1	# va, _306
+.LVL234:
+# blake2s-vec.c:90:     FULLROUND(7);
+	.loc 1 90 724 view .LVU605
+	movdqa	%xmm1, %xmm15	# _306, tmp657
+	pslld	$24, %xmm1	#, vd
+	psrld	$8, %xmm15	#, tmp657
+	por	%xmm15, %xmm1	# tmp657, vd
+.LVL235:
+	.loc 1 90 784 is_stmt 1 view .LVU606
+# blake2s-vec.c:90:     FULLROUND(7);
+	.loc 1 90 789 is_stmt 0 view .LVU607
+	paddd	%xmm1, %xmm14	# vd, vc
+.LVL236:
+	.loc 1 90 798 is_stmt 1 view .LVU608
+# blake2s-vec.c:90:     FULLROUND(7);
+	.loc 1 90 975 is_stmt 0 view .LVU609
+	pshufd	$147, %xmm1, %xmm1	#, vd, vd
+.LVL237:
+# blake2s-vec.c:90:     FULLROUND(7);
+	.loc 1 90 813 view .LVU610
+	pxor	%xmm14, %xmm0	# vc, _309
+.LVL238:
+# blake2s-vec.c:90:     FULLROUND(7);
+	.loc 1 90 927 view .LVU611
+	pshufd	$78, %xmm14, %xmm14	#, vc, vc
+.LVL239:
+# blake2s-vec.c:90:     FULLROUND(7);
+	.loc 1 90 803 view .LVU612
+	movdqa	%xmm0, %xmm15	# _309, tmp658
+	pslld	$25, %xmm0	#, vb
+	psrld	$7, %xmm15	#, tmp658
+	por	%xmm15, %xmm0	# tmp658, vb
+.LVL240:
+	.loc 1 90 527 is_stmt 1 view .LVU613
+	.loc 1 90 876 view .LVU614
+# blake2s-vec.c:90:     FULLROUND(7);
+	.loc 1 90 267 is_stmt 0 view .LVU615
+	movq	%r10, %xmm15	# tmp539, m3
+	punpcklqdq	%xmm13, %xmm15	# tmp660, m3
+# blake2s-vec.c:90:     FULLROUND(7);
+	.loc 1 90 879 view .LVU616
+	pshufd	$57, %xmm0, %xmm0	#, vb, vb
+.LVL241:
+	.loc 1 90 924 is_stmt 1 view .LVU617
+	.loc 1 90 972 view .LVU618
+	.loc 1 90 1020 view .LVU619
+	.loc 1 90 1025 view .LVU620
+	paddd	%xmm2, %xmm15	# va, _431
+# blake2s-vec.c:90:     FULLROUND(7);
+	.loc 1 90 1030 is_stmt 0 view .LVU621
+	movdqa	%xmm15, %xmm2	# _431, _431
+.LVL242:
+	.loc 1 90 1030 view .LVU622
+	paddd	%xmm0, %xmm2	# vb, _431
+.LVL243:
+	.loc 1 90 1046 is_stmt 1 view .LVU623
+# blake2s-vec.c:90:     FULLROUND(7);
+	.loc 1 90 1061 is_stmt 0 view .LVU624
+	pxor	%xmm2, %xmm1	# va, _316
+# blake2s-vec.c:90:     FULLROUND(7);
+	.loc 1 90 1051 view .LVU625
+	movdqa	%xmm1, %xmm15	# _316, tmp663
+	psrld	$16, %xmm1	#, vd
+	pslld	$16, %xmm15	#, tmp663
+	por	%xmm15, %xmm1	# tmp663, vd
+.LVL244:
+	.loc 1 90 1113 is_stmt 1 view .LVU626
+# blake2s-vec.c:90:     FULLROUND(7);
+	.loc 1 90 1118 is_stmt 0 view .LVU627
+	paddd	%xmm1, %xmm14	# vd, vc
+.LVL245:
+	.loc 1 90 1127 is_stmt 1 view .LVU628
+# blake2s-vec.c:90:     FULLROUND(7);
+	.loc 1 90 1142 is_stmt 0 view .LVU629
+	pxor	%xmm14, %xmm0	# vc, _319
+.LVL246:
+# blake2s-vec.c:90:     FULLROUND(7);
+	.loc 1 90 1132 view .LVU630
+	movdqa	%xmm0, %xmm15	# _319, tmp664
+	pslld	$20, %xmm0	#, vb
+	psrld	$12, %xmm15	#, tmp664
+	por	%xmm15, %xmm0	# tmp664, vb
+.LVL247:
+	.loc 1 90 1194 is_stmt 1 view .LVU631
+# blake2s-vec.c:90:     FULLROUND(7);
+	.loc 1 90 397 is_stmt 0 view .LVU632
+	movdqa	%xmm11, %xmm15	# tmp721, tmp667
+	punpckldq	%xmm6, %xmm15	# tmp723, tmp667
+	punpcklqdq	%xmm8, %xmm15	# tmp579, m4
+.LBE102:
+.LBB103:
+# blake2s-vec.c:91:     FULLROUND(8);
+	.loc 1 91 13 view .LVU633
+	movd	-16(%rsp), %xmm8	# m[14], tmp990
+	paddd	%xmm2, %xmm15	# va, _430
+.LBE103:
+.LBB104:
+# blake2s-vec.c:90:     FULLROUND(7);
+	.loc 1 90 1199 view .LVU634
+	movdqa	%xmm15, %xmm2	# _430, _430
+.LVL248:
+	.loc 1 90 1199 view .LVU635
+	paddd	%xmm0, %xmm2	# vb, _430
+.LVL249:
+	.loc 1 90 1215 is_stmt 1 view .LVU636
+# blake2s-vec.c:90:     FULLROUND(7);
+	.loc 1 90 1230 is_stmt 0 view .LVU637
+	pxor	%xmm2, %xmm1	# va, _323
+.LVL250:
+# blake2s-vec.c:90:     FULLROUND(7);
+	.loc 1 90 1220 view .LVU638
+	movdqa	%xmm1, %xmm15	# _323, tmp668
+	pslld	$24, %xmm1	#, vd
+	psrld	$8, %xmm15	#, tmp668
+	por	%xmm15, %xmm1	# tmp668, vd
+.LVL251:
+	.loc 1 90 1280 is_stmt 1 view .LVU639
+# blake2s-vec.c:90:     FULLROUND(7);
+	.loc 1 90 1285 is_stmt 0 view .LVU640
+	paddd	%xmm1, %xmm14	# vd, vc
+.LVL252:
+	.loc 1 90 1294 is_stmt 1 view .LVU641
+# blake2s-vec.c:90:     FULLROUND(7);
+	.loc 1 90 1471 is_stmt 0 view .LVU642
+	pshufd	$57, %xmm1, %xmm1	#, vd, vd
+.LVL253:
+# blake2s-vec.c:90:     FULLROUND(7);
+	.loc 1 90 1309 view .LVU643
+	pxor	%xmm14, %xmm0	# vc, _326
+.LVL254:
+# blake2s-vec.c:90:     FULLROUND(7);
+	.loc 1 90 1423 view .LVU644
+	pshufd	$78, %xmm14, %xmm14	#, vc, vc
+.LVL255:
+# blake2s-vec.c:90:     FULLROUND(7);
+	.loc 1 90 1299 view .LVU645
+	movdqa	%xmm0, %xmm15	# _326, tmp669
+	pslld	$25, %xmm0	#, vb
+	psrld	$7, %xmm15	#, tmp669
+	por	%xmm15, %xmm0	# tmp669, vb
+.LVL256:
+	.loc 1 90 1023 is_stmt 1 view .LVU646
+	.loc 1 90 1372 view .LVU647
+.LBE104:
+.LBB105:
+# blake2s-vec.c:91:     FULLROUND(8);
+	.loc 1 91 13 is_stmt 0 view .LVU648
+	movdqa	%xmm4, %xmm15	# _11, tmp672
+	punpckldq	%xmm8, %xmm15	# tmp990, tmp672
+.LBE105:
+.LBB106:
+# blake2s-vec.c:90:     FULLROUND(7);
+	.loc 1 90 1375 view .LVU649
+	pshufd	$147, %xmm0, %xmm0	#, vb, vb
+.LVL257:
+	.loc 1 90 1420 is_stmt 1 view .LVU650
+	.loc 1 90 1468 view .LVU651
+	.loc 1 90 1468 is_stmt 0 view .LVU652
+.LBE106:
+	.loc 1 90 8 is_stmt 1 view .LVU653
+	.loc 1 91 5 view .LVU654
+.LBB107:
+	.loc 1 91 10 view .LVU655
+	.loc 1 91 137 view .LVU656
+	.loc 1 91 264 view .LVU657
+	.loc 1 91 394 view .LVU658
+	.loc 1 91 524 view .LVU659
+	.loc 1 91 529 view .LVU660
+# blake2s-vec.c:91:     FULLROUND(8);
+	.loc 1 91 13 is_stmt 0 view .LVU661
+	movdqa	%xmm15, %xmm13	# tmp672, m1
+# blake2s-vec.c:91:     FULLROUND(8);
+	.loc 1 91 140 view .LVU662
+	movd	-12(%rsp), %xmm15	# m[15], tmp678
+# blake2s-vec.c:91:     FULLROUND(8);
+	.loc 1 91 13 view .LVU663
+	punpcklqdq	%xmm5, %xmm13	# tmp671, m1
+	paddd	%xmm13, %xmm2	# m1, _429
+.LVL258:
+# blake2s-vec.c:91:     FULLROUND(8);
+	.loc 1 91 140 view .LVU664
+	punpckldq	%xmm10, %xmm15	# _23, tmp678
+# blake2s-vec.c:91:     FULLROUND(8);
+	.loc 1 91 534 view .LVU665
+	paddd	%xmm0, %xmm2	# vb, va
+.LVL259:
+	.loc 1 91 550 is_stmt 1 view .LVU666
+# blake2s-vec.c:91:     FULLROUND(8);
+	.loc 1 91 140 is_stmt 0 view .LVU667
+	movdqa	%xmm15, %xmm13	# tmp678, m2
+# blake2s-vec.c:91:     FULLROUND(8);
+	.loc 1 91 565 view .LVU668
+	pxor	%xmm2, %xmm1	# va, _337
+# blake2s-vec.c:91:     FULLROUND(8);
+	.loc 1 91 555 view .LVU669
+	movdqa	%xmm1, %xmm5	# _337, tmp674
+	psrld	$16, %xmm1	#, vd
+	pslld	$16, %xmm5	#, tmp674
+	por	%xmm5, %xmm1	# tmp674, vd
+.LVL260:
+	.loc 1 91 617 is_stmt 1 view .LVU670
+# blake2s-vec.c:91:     FULLROUND(8);
+	.loc 1 91 622 is_stmt 0 view .LVU671
+	paddd	%xmm1, %xmm14	# vd, vc
+.LVL261:
+	.loc 1 91 631 is_stmt 1 view .LVU672
+# blake2s-vec.c:91:     FULLROUND(8);
+	.loc 1 91 646 is_stmt 0 view .LVU673
+	pxor	%xmm14, %xmm0	# vc, _340
+.LVL262:
+# blake2s-vec.c:91:     FULLROUND(8);
+	.loc 1 91 636 view .LVU674
+	movdqa	%xmm0, %xmm5	# _340, tmp675
+	pslld	$20, %xmm0	#, vb
+	psrld	$12, %xmm5	#, tmp675
+	por	%xmm5, %xmm0	# tmp675, vb
+.LVL263:
+	.loc 1 91 698 is_stmt 1 view .LVU675
+# blake2s-vec.c:91:     FULLROUND(8);
+	.loc 1 91 140 is_stmt 0 view .LVU676
+	movd	-60(%rsp), %xmm5	# m[3], tmp677
+	punpckldq	%xmm12, %xmm5	# tmp725, tmp677
+# blake2s-vec.c:91:     FULLROUND(8);
+	.loc 1 91 267 view .LVU677
+	movdqa	%xmm7, %xmm12	# tmp727, tmp683
+.LVL264:
+# blake2s-vec.c:91:     FULLROUND(8);
+	.loc 1 91 140 view .LVU678
+	punpcklqdq	%xmm5, %xmm13	# tmp677, m2
+# blake2s-vec.c:91:     FULLROUND(8);
+	.loc 1 91 267 view .LVU679
+	movd	-32(%rsp), %xmm5	# m[10], tmp934
+	paddd	%xmm2, %xmm13	# va, _428
+# blake2s-vec.c:91:     FULLROUND(8);
+	.loc 1 91 703 view .LVU680
+	paddd	%xmm0, %xmm13	# vb, va
+.LVL265:
+	.loc 1 91 719 is_stmt 1 view .LVU681
+# blake2s-vec.c:91:     FULLROUND(8);
+	.loc 1 91 734 is_stmt 0 view .LVU682
+	pxor	%xmm13, %xmm1	# va, _344
+.LVL266:
+# blake2s-vec.c:91:     FULLROUND(8);
+	.loc 1 91 724 view .LVU683
+	movdqa	%xmm1, %xmm2	# _344, tmp679
+	pslld	$24, %xmm1	#, vd
+	psrld	$8, %xmm2	#, tmp679
+	por	%xmm2, %xmm1	# tmp679, vd
+.LVL267:
+	.loc 1 91 784 is_stmt 1 view .LVU684
+# blake2s-vec.c:91:     FULLROUND(8);
+	.loc 1 91 789 is_stmt 0 view .LVU685
+	paddd	%xmm1, %xmm14	# vd, vc
+.LVL268:
+	.loc 1 91 798 is_stmt 1 view .LVU686
+# blake2s-vec.c:91:     FULLROUND(8);
+	.loc 1 91 813 is_stmt 0 view .LVU687
+	pxor	%xmm14, %xmm0	# vc, _347
+.LVL269:
+# blake2s-vec.c:91:     FULLROUND(8);
+	.loc 1 91 803 view .LVU688
+	movdqa	%xmm0, %xmm2	# _347, tmp680
+	pslld	$25, %xmm0	#, vb
+	psrld	$7, %xmm2	#, tmp680
+	por	%xmm2, %xmm0	# tmp680, vb
+.LVL270:
+	.loc 1 91 527 is_stmt 1 view .LVU689
+	.loc 1 91 876 view .LVU690
+# blake2s-vec.c:91:     FULLROUND(8);
+	.loc 1 91 927 is_stmt 0 view .LVU691
+	pshufd	$78, %xmm14, %xmm2	#, vc, vc
+# blake2s-vec.c:91:     FULLROUND(8);
+	.loc 1 91 879 view .LVU692
+	pshufd	$57, %xmm0, %xmm10	#, vb, vb
+.LVL271:
+	.loc 1 91 924 is_stmt 1 view .LVU693
+	.loc 1 91 972 view .LVU694
+	.loc 1 91 1020 view .LVU695
+	.loc 1 91 1025 view .LVU696
+# blake2s-vec.c:91:     FULLROUND(8);
+	.loc 1 91 267 is_stmt 0 view .LVU697
+	movdqa	%xmm9, %xmm0	# _13, tmp682
+	punpckldq	%xmm5, %xmm0	# tmp934, tmp682
+	movd	-20(%rsp), %xmm5	# m[13], tmp936
+# blake2s-vec.c:91:     FULLROUND(8);
+	.loc 1 91 397 view .LVU698
+	movd	-44(%rsp), %xmm8	# m[7], tmp989
+# blake2s-vec.c:91:     FULLROUND(8);
+	.loc 1 91 267 view .LVU699
+	punpckldq	%xmm5, %xmm12	# tmp936, tmp683
+# blake2s-vec.c:91:     FULLROUND(8);
+	.loc 1 91 397 view .LVU700
+	movdqa	%xmm6, %xmm5	# tmp723, tmp688
+# blake2s-vec.c:91:     FULLROUND(8);
+	.loc 1 91 267 view .LVU701
+	punpcklqdq	%xmm0, %xmm12	# tmp682, m3
+# blake2s-vec.c:91:     FULLROUND(8);
+	.loc 1 91 975 view .LVU702
+	pshufd	$147, %xmm1, %xmm0	#, vd, vd
+# blake2s-vec.c:91:     FULLROUND(8);
+	.loc 1 91 1142 view .LVU703
+	movdqa	%xmm10, %xmm1	# vb, vb
+	paddd	%xmm13, %xmm12	# va, _427
+# blake2s-vec.c:91:     FULLROUND(8);
+	.loc 1 91 1030 view .LVU704
+	paddd	%xmm10, %xmm12	# vb, va
+.LVL272:
+	.loc 1 91 1046 is_stmt 1 view .LVU705
+# blake2s-vec.c:91:     FULLROUND(8);
+	.loc 1 91 397 is_stmt 0 view .LVU706
+	movd	-52(%rsp), %xmm10	# m[5], tmp941
+.LVL273:
+# blake2s-vec.c:91:     FULLROUND(8);
+	.loc 1 91 1061 view .LVU707
+	pxor	%xmm12, %xmm0	# va, _354
+# blake2s-vec.c:91:     FULLROUND(8);
+	.loc 1 91 1051 view .LVU708
+	movdqa	%xmm0, %xmm13	# _354, tmp685
+	psrld	$16, %xmm0	#, vd
+# blake2s-vec.c:91:     FULLROUND(8);
+	.loc 1 91 397 view .LVU709
+	punpckldq	%xmm10, %xmm5	# tmp941, tmp688
+# blake2s-vec.c:91:     FULLROUND(8);
+	.loc 1 91 1051 view .LVU710
+	pslld	$16, %xmm13	#, tmp685
+# blake2s-vec.c:91:     FULLROUND(8);
+	.loc 1 91 397 view .LVU711
+	movdqa	%xmm3, %xmm10	# _9, tmp689
+.LBE107:
+.LBB108:
+# blake2s-vec.c:92:     FULLROUND(9);
+	.loc 1 92 140 view .LVU712
+	punpckldq	%xmm6, %xmm3	# tmp723, tmp700
+.LVL274:
+# blake2s-vec.c:92:     FULLROUND(9);
+	.loc 1 92 267 view .LVU713
+	movd	-60(%rsp), %xmm6	# m[3], tmp704
+.LVL275:
+	.loc 1 92 267 view .LVU714
+.LBE108:
+.LBB109:
+# blake2s-vec.c:91:     FULLROUND(8);
+	.loc 1 91 1051 view .LVU715
+	por	%xmm13, %xmm0	# tmp685, vd
+.LVL276:
+	.loc 1 91 1113 is_stmt 1 view .LVU716
+# blake2s-vec.c:91:     FULLROUND(8);
+	.loc 1 91 397 is_stmt 0 view .LVU717
+	punpckldq	%xmm8, %xmm10	# tmp989, tmp689
+.LVL277:
+	.loc 1 91 397 view .LVU718
+.LBE109:
+.LBB110:
+# blake2s-vec.c:92:     FULLROUND(9);
+	.loc 1 92 13 view .LVU719
+	punpckldq	%xmm9, %xmm8	# _13, tmp693
+# blake2s-vec.c:92:     FULLROUND(9);
+	.loc 1 92 140 view .LVU720
+	movd	-52(%rsp), %xmm9	# m[5], tmp948
+.LVL278:
+	.loc 1 92 140 view .LVU721
+.LBE110:
+.LBB111:
+# blake2s-vec.c:91:     FULLROUND(8);
+	.loc 1 91 1118 view .LVU722
+	paddd	%xmm0, %xmm2	# vd, vc
+.LVL279:
+	.loc 1 91 1127 is_stmt 1 view .LVU723
+# blake2s-vec.c:91:     FULLROUND(8);
+	.loc 1 91 397 is_stmt 0 view .LVU724
+	punpcklqdq	%xmm5, %xmm10	# tmp688, m4
+.LBE111:
+.LBB112:
+# blake2s-vec.c:92:     FULLROUND(9);
+	.loc 1 92 13 view .LVU725
+	movq	%rsi, %xmm5	# tmp524, m1
+.LBE112:
+.LBB113:
+# blake2s-vec.c:91:     FULLROUND(8);
+	.loc 1 91 1142 view .LVU726
+	pxor	%xmm2, %xmm1	# vc, vb
+.LVL280:
+	.loc 1 91 1142 view .LVU727
+	paddd	%xmm12, %xmm10	# va, _426
+.LBE113:
+.LBB114:
+# blake2s-vec.c:92:     FULLROUND(9);
+	.loc 1 92 13 view .LVU728
+	punpcklqdq	%xmm8, %xmm5	# tmp693, m1
+.LBE114:
+.LBB115:
+# blake2s-vec.c:91:     FULLROUND(8);
+	.loc 1 91 1132 view .LVU729
+	movdqa	%xmm1, %xmm13	# _357, tmp686
+	pslld	$20, %xmm1	#, vb
+.LBE115:
+.LBB116:
+# blake2s-vec.c:92:     FULLROUND(9);
+	.loc 1 92 140 view .LVU730
+	punpckldq	%xmm9, %xmm4	# tmp948, tmp699
+	.loc 1 92 140 view .LVU731
+.LBE116:
+.LBB117:
+# blake2s-vec.c:91:     FULLROUND(8);
+	.loc 1 91 1132 view .LVU732
+	psrld	$12, %xmm13	#, tmp686
+.LBE117:
+.LBB118:
+# blake2s-vec.c:92:     FULLROUND(9);
+	.loc 1 92 140 view .LVU733
+	punpcklqdq	%xmm4, %xmm3	# tmp699, m2
+.LBE118:
+.LBB119:
+# blake2s-vec.c:91:     FULLROUND(8);
+	.loc 1 91 1132 view .LVU734
+	por	%xmm13, %xmm1	# tmp686, vb
+.LVL281:
+	.loc 1 91 1194 is_stmt 1 view .LVU735
+# blake2s-vec.c:91:     FULLROUND(8);
+	.loc 1 91 1199 is_stmt 0 view .LVU736
+	paddd	%xmm1, %xmm10	# vb, va
+.LVL282:
+	.loc 1 91 1215 is_stmt 1 view .LVU737
+# blake2s-vec.c:91:     FULLROUND(8);
+	.loc 1 91 1230 is_stmt 0 view .LVU738
+	pxor	%xmm10, %xmm0	# va, _361
+.LVL283:
+	.loc 1 91 1230 view .LVU739
+	paddd	%xmm10, %xmm5	# va, _425
+# blake2s-vec.c:91:     FULLROUND(8);
+	.loc 1 91 1220 view .LVU740
+	movdqa	%xmm0, %xmm12	# _361, tmp690
+	pslld	$24, %xmm0	#, vd
+	psrld	$8, %xmm12	#, tmp690
+	por	%xmm12, %xmm0	# tmp690, vd
+.LVL284:
+	.loc 1 91 1280 is_stmt 1 view .LVU741
+# blake2s-vec.c:91:     FULLROUND(8);
+	.loc 1 91 1285 is_stmt 0 view .LVU742
+	paddd	%xmm0, %xmm2	# vd, vc
+.LVL285:
+	.loc 1 91 1294 is_stmt 1 view .LVU743
+# blake2s-vec.c:91:     FULLROUND(8);
+	.loc 1 91 1471 is_stmt 0 view .LVU744
+	pshufd	$57, %xmm0, %xmm0	#, vd, vd
+.LVL286:
+# blake2s-vec.c:91:     FULLROUND(8);
+	.loc 1 91 1309 view .LVU745
+	pxor	%xmm2, %xmm1	# vc, _364
+.LVL287:
+# blake2s-vec.c:91:     FULLROUND(8);
+	.loc 1 91 1423 view .LVU746
+	pshufd	$78, %xmm2, %xmm2	#, vc, vc
+.LVL288:
+# blake2s-vec.c:91:     FULLROUND(8);
+	.loc 1 91 1299 view .LVU747
+	movdqa	%xmm1, %xmm12	# _364, tmp691
+	pslld	$25, %xmm1	#, vb
+	psrld	$7, %xmm12	#, tmp691
+	por	%xmm12, %xmm1	# tmp691, vb
+.LVL289:
+	.loc 1 91 1023 is_stmt 1 view .LVU748
+	.loc 1 91 1372 view .LVU749
+# blake2s-vec.c:91:     FULLROUND(8);
+	.loc 1 91 1375 is_stmt 0 view .LVU750
+	pshufd	$147, %xmm1, %xmm1	#, vb, vb
+.LVL290:
+	.loc 1 91 1420 is_stmt 1 view .LVU751
+	.loc 1 91 1468 view .LVU752
+	.loc 1 91 1468 is_stmt 0 view .LVU753
+.LBE119:
+	.loc 1 91 8 is_stmt 1 view .LVU754
+	.loc 1 92 5 view .LVU755
+.LBB120:
+	.loc 1 92 10 view .LVU756
+	.loc 1 92 137 view .LVU757
+	.loc 1 92 264 view .LVU758
+	.loc 1 92 394 view .LVU759
+	.loc 1 92 524 view .LVU760
+	.loc 1 92 529 view .LVU761
+# blake2s-vec.c:92:     FULLROUND(9);
+	.loc 1 92 534 is_stmt 0 view .LVU762
+	paddd	%xmm1, %xmm5	# vb, va
+.LVL291:
+	.loc 1 92 550 is_stmt 1 view .LVU763
+# blake2s-vec.c:92:     FULLROUND(9);
+	.loc 1 92 565 is_stmt 0 view .LVU764
+	pxor	%xmm5, %xmm0	# va, _375
+	paddd	%xmm5, %xmm3	# va, _421
+# blake2s-vec.c:92:     FULLROUND(9);
+	.loc 1 92 397 view .LVU765
+	movdqa	%xmm7, %xmm5	# tmp727, tmp710
+.LVL292:
+# blake2s-vec.c:92:     FULLROUND(9);
+	.loc 1 92 555 view .LVU766
+	movdqa	%xmm0, %xmm8	# _375, tmp696
+.LVL293:
+	.loc 1 92 555 view .LVU767
+	psrld	$16, %xmm0	#, vd
+# blake2s-vec.c:92:     FULLROUND(9);
+	.loc 1 92 397 view .LVU768
+	punpckldq	%xmm11, %xmm5	# tmp721, tmp710
+# blake2s-vec.c:92:     FULLROUND(9);
+	.loc 1 92 555 view .LVU769
+	pslld	$16, %xmm8	#, tmp696
+	por	%xmm8, %xmm0	# tmp696, vd
+.LVL294:
+	.loc 1 92 617 is_stmt 1 view .LVU770
+# blake2s-vec.c:92:     FULLROUND(9);
+	.loc 1 92 622 is_stmt 0 view .LVU771
+	paddd	%xmm0, %xmm2	# vd, vc
+.LVL295:
+	.loc 1 92 631 is_stmt 1 view .LVU772
+# blake2s-vec.c:92:     FULLROUND(9);
+	.loc 1 92 646 is_stmt 0 view .LVU773
+	pxor	%xmm2, %xmm1	# vc, _378
+.LVL296:
+# blake2s-vec.c:92:     FULLROUND(9);
+	.loc 1 92 636 view .LVU774
+	movdqa	%xmm1, %xmm8	# _378, tmp697
+	pslld	$20, %xmm1	#, vb
+	psrld	$12, %xmm8	#, tmp697
+	por	%xmm8, %xmm1	# tmp697, vb
+.LVL297:
+	.loc 1 92 698 is_stmt 1 view .LVU775
+# blake2s-vec.c:92:     FULLROUND(9);
+	.loc 1 92 703 is_stmt 0 view .LVU776
+	paddd	%xmm1, %xmm3	# vb, va
+.LVL298:
+	.loc 1 92 719 is_stmt 1 view .LVU777
+# blake2s-vec.c:92:     FULLROUND(9);
+	.loc 1 92 734 is_stmt 0 view .LVU778
+	pxor	%xmm3, %xmm0	# va, _382
+.LVL299:
+# blake2s-vec.c:92:     FULLROUND(9);
+	.loc 1 92 724 view .LVU779
+	movdqa	%xmm0, %xmm4	# _382, tmp701
+	pslld	$24, %xmm0	#, vd
+	psrld	$8, %xmm4	#, tmp701
+	por	%xmm4, %xmm0	# tmp701, vd
+.LVL300:
+	.loc 1 92 784 is_stmt 1 view .LVU780
+# blake2s-vec.c:92:     FULLROUND(9);
+	.loc 1 92 789 is_stmt 0 view .LVU781
+	paddd	%xmm0, %xmm2	# vd, vc
+.LVL301:
+	.loc 1 92 798 is_stmt 1 view .LVU782
+# blake2s-vec.c:92:     FULLROUND(9);
+	.loc 1 92 975 is_stmt 0 view .LVU783
+	pshufd	$147, %xmm0, %xmm0	#, vd, vd
+.LVL302:
+# blake2s-vec.c:92:     FULLROUND(9);
+	.loc 1 92 813 view .LVU784
+	pxor	%xmm2, %xmm1	# vc, _385
+.LVL303:
+# blake2s-vec.c:92:     FULLROUND(9);
+	.loc 1 92 927 view .LVU785
+	pshufd	$78, %xmm2, %xmm2	#, vc, vc
+.LVL304:
+# blake2s-vec.c:92:     FULLROUND(9);
+	.loc 1 92 803 view .LVU786
+	movdqa	%xmm1, %xmm4	# _385, tmp702
+	pslld	$25, %xmm1	#, vb
+	psrld	$7, %xmm4	#, tmp702
+	por	%xmm4, %xmm1	# tmp702, vb
+.LVL305:
+	.loc 1 92 527 is_stmt 1 view .LVU787
+	.loc 1 92 876 view .LVU788
+# blake2s-vec.c:92:     FULLROUND(9);
+	.loc 1 92 267 is_stmt 0 view .LVU789
+	movd	-20(%rsp), %xmm4	# m[13], tmp952
+# blake2s-vec.c:92:     FULLROUND(9);
+	.loc 1 92 879 view .LVU790
+	pshufd	$57, %xmm1, %xmm1	#, vb, vb
+.LVL306:
+	.loc 1 92 924 is_stmt 1 view .LVU791
+	.loc 1 92 972 view .LVU792
+	.loc 1 92 1020 view .LVU793
+	.loc 1 92 1025 view .LVU794
+# blake2s-vec.c:92:     FULLROUND(9);
+	.loc 1 92 267 is_stmt 0 view .LVU795
+	punpckldq	%xmm4, %xmm6	# tmp952, tmp704
+	punpcklqdq	%xmm6, %xmm15	# tmp704, m3
+	paddd	%xmm15, %xmm3	# m3, _420
+.LVL307:
+# blake2s-vec.c:92:     FULLROUND(9);
+	.loc 1 92 1030 view .LVU796
+	paddd	%xmm1, %xmm3	# vb, va
+.LVL308:
+	.loc 1 92 1046 is_stmt 1 view .LVU797
+# blake2s-vec.c:92:     FULLROUND(9);
+	.loc 1 92 1061 is_stmt 0 view .LVU798
+	pxor	%xmm3, %xmm0	# va, _392
+# blake2s-vec.c:92:     FULLROUND(9);
+	.loc 1 92 1051 view .LVU799
+	movdqa	%xmm0, %xmm4	# _392, tmp707
+	psrld	$16, %xmm0	#, vd
+	pslld	$16, %xmm4	#, tmp707
+	por	%xmm4, %xmm0	# tmp707, vd
+.LVL309:
+	.loc 1 92 1113 is_stmt 1 view .LVU800
+# blake2s-vec.c:92:     FULLROUND(9);
+	.loc 1 92 1118 is_stmt 0 view .LVU801
+	movdqa	%xmm2, %xmm4	# vc, vc
+	paddd	%xmm0, %xmm4	# vd, vc
+.LVL310:
+	.loc 1 92 1127 is_stmt 1 view .LVU802
+# blake2s-vec.c:92:     FULLROUND(9);
+	.loc 1 92 1142 is_stmt 0 view .LVU803
+	pxor	%xmm4, %xmm1	# vc, _395
+.LVL311:
+# blake2s-vec.c:92:     FULLROUND(9);
+	.loc 1 92 1132 view .LVU804
+	movdqa	%xmm1, %xmm2	# _395, tmp708
+	pslld	$20, %xmm1	#, vb
+	psrld	$12, %xmm2	#, tmp708
+	por	%xmm2, %xmm1	# tmp708, vb
+.LVL312:
+	.loc 1 92 1194 is_stmt 1 view .LVU805
+# blake2s-vec.c:92:     FULLROUND(9);
+	.loc 1 92 397 is_stmt 0 view .LVU806
+	movq	%rax, %xmm2	# tmp656, m4
+	punpcklqdq	%xmm5, %xmm2	# tmp710, m4
+	paddd	%xmm3, %xmm2	# va, _1
+# blake2s-vec.c:92:     FULLROUND(9);
+	.loc 1 92 1199 view .LVU807
+	paddd	%xmm1, %xmm2	# vb, va
+.LVL313:
+	.loc 1 92 1215 is_stmt 1 view .LVU808
+# blake2s-vec.c:92:     FULLROUND(9);
+	.loc 1 92 1230 is_stmt 0 view .LVU809
+	pxor	%xmm2, %xmm0	# va, _399
+.LVL314:
+	.loc 1 92 1230 view .LVU810
+.LBE120:
+# blake2s-vec.c:94:     H[0] ^= va ^ vc;
+	.loc 1 94 10 view .LVU811
+	pxor	(%r9), %xmm2	# *H_407(D), tmp714
+.LVL315:
+.LBB121:
+# blake2s-vec.c:92:     FULLROUND(9);
+	.loc 1 92 1220 view .LVU812
+	movdqa	%xmm0, %xmm3	# _399, tmp712
+.LVL316:
+	.loc 1 92 1220 view .LVU813
+	pslld	$24, %xmm0	#, vd
+	psrld	$8, %xmm3	#, tmp712
+	por	%xmm3, %xmm0	# tmp712, vd
+.LVL317:
+	.loc 1 92 1280 is_stmt 1 view .LVU814
+# blake2s-vec.c:92:     FULLROUND(9);
+	.loc 1 92 1285 is_stmt 0 view .LVU815
+	movdqa	%xmm4, %xmm3	# vc, vc
+	paddd	%xmm0, %xmm3	# vd, vc
+.LVL318:
+	.loc 1 92 1294 is_stmt 1 view .LVU816
+# blake2s-vec.c:92:     FULLROUND(9);
+	.loc 1 92 1471 is_stmt 0 view .LVU817
+	pshufd	$57, %xmm0, %xmm0	#, vd, vd
+.LVL319:
+	.loc 1 92 1471 view .LVU818
+.LBE121:
+# blake2s-vec.c:95:     H[1] ^= vb ^ vd;
+	.loc 1 95 10 view .LVU819
+	pxor	16(%r9), %xmm0	# MEM[(vu32 *)H_407(D) + 16B], tmp718
+.LBB122:
+# blake2s-vec.c:92:     FULLROUND(9);
+	.loc 1 92 1309 view .LVU820
+	pxor	%xmm3, %xmm1	# vc, _402
+.LVL320:
+# blake2s-vec.c:92:     FULLROUND(9);
+	.loc 1 92 1423 view .LVU821
+	pshufd	$78, %xmm3, %xmm3	#, vc, vc
+.LVL321:
+# blake2s-vec.c:92:     FULLROUND(9);
+	.loc 1 92 1299 view .LVU822
+	movdqa	%xmm1, %xmm4	# _402, tmp713
+	.loc 1 92 1299 view .LVU823
+	pslld	$25, %xmm1	#, vb
+.LBE122:
+# blake2s-vec.c:94:     H[0] ^= va ^ vc;
+	.loc 1 94 10 view .LVU824
+	pxor	%xmm3, %xmm2	# vc, tmp716
+.LBB123:
+# blake2s-vec.c:92:     FULLROUND(9);
+	.loc 1 92 1299 view .LVU825
+	psrld	$7, %xmm4	#, tmp713
+.LBE123:
+# blake2s-vec.c:94:     H[0] ^= va ^ vc;
+	.loc 1 94 10 view .LVU826
+	movaps	%xmm2, (%r9)	# tmp716, *H_407(D)
+.LBB124:
+# blake2s-vec.c:92:     FULLROUND(9);
+	.loc 1 92 1299 view .LVU827
+	por	%xmm4, %xmm1	# tmp713, vb
+.LVL322:
+	.loc 1 92 1023 is_stmt 1 view .LVU828
+	.loc 1 92 1372 view .LVU829
+	.loc 1 92 1420 view .LVU830
+	.loc 1 92 1468 view .LVU831
+	.loc 1 92 1468 is_stmt 0 view .LVU832
+.LBE124:
+	.loc 1 92 8 is_stmt 1 view .LVU833
+	.loc 1 94 5 view .LVU834
+	.loc 1 95 5 view .LVU835
+.LBB125:
+# blake2s-vec.c:92:     FULLROUND(9);
+	.loc 1 92 1375 is_stmt 0 view .LVU836
+	pshufd	$147, %xmm1, %xmm1	#, vb, vb
+.LBE125:
+# blake2s-vec.c:95:     H[1] ^= vb ^ vd;
+	.loc 1 95 10 view .LVU837
+	pxor	%xmm1, %xmm0	# vb, tmp720
+	movaps	%xmm0, 16(%r9)	# tmp720, MEM[(vu32 *)H_407(D) + 16B]
+# blake2s-vec.c:96: }
+	.loc 1 96 1 view .LVU838
+	ret	
+	.cfi_endproc
+.LFE22:
+	.size	blake2s_10rounds.constprop.0, .-blake2s_10rounds.constprop.0
+	.p2align 4
+	.globl	blake2s_compress_vec
+	.type	blake2s_compress_vec, @function
+blake2s_compress_vec:
+.LVL323:
+.LFB20:
+	.loc 1 99 1 is_stmt 1 view -0
+	.cfi_startproc
+	.loc 1 100 5 view .LVU840
+	.loc 1 101 5 view .LVU841
+	.loc 1 102 5 view .LVU842
+.LBB126:
+.LBI126:
+	.loc 1 24 20 view .LVU843
+.LBB127:
+	.loc 1 26 5 view .LVU844
+	.loc 1 27 5 view .LVU845
+.LBE127:
+.LBE126:
+# blake2s-vec.c:99: {
+	.loc 1 99 1 is_stmt 0 view .LVU846
+	subq	$40, %rsp	#,
+	.cfi_def_cfa_offset 48
+# blake2s-vec.c:99: {
+	.loc 1 99 1 view .LVU847
+	movq	%rdi, %r8	# tmp101, ctx
+# blake2s-vec.c:103:     H[1] = vload(ctx->H + 4);
+	.loc 1 103 10 view .LVU848
+	movdqu	16(%rdi), %xmm3	# MEM <uint128_t> [(char * {ref-all})ctx_8(D) + 16B], tmp104
+.LBB129:
+.LBB128:
+# blake2s-vec.c:27:     memcpy(&v, p, sizeof(v));
+	.loc 1 27 5 view .LVU849
+	movdqu	(%rdi), %xmm0	# MEM <uint128_t> [(char * {ref-all})ctx_8(D)], MEM <uint128_t> [(char * {ref-all})ctx_8(D)]
+.LVL324:
+	.loc 1 28 5 is_stmt 1 view .LVU850
+	.loc 1 28 5 is_stmt 0 view .LVU851
+.LBE128:
+.LBE129:
+# blake2s-vec.c:106:     blake2s_10rounds(H[0], H[1], blake2s_viv[0], blake2s_viv[1] ^ vpr,
+	.loc 1 106 5 view .LVU852
+	movdqa	.LC1(%rip), %xmm2	#, tmp98
+	pxor	96(%r8), %xmm2	# MEM <vector(4) unsigned int> [(unsigned int *)ctx_8(D) + 96B],
+	movq	%rsp, %rdi	#, tmp96
+.LVL325:
+	.loc 1 106 5 view .LVU853
+	movdqa	%xmm3, %xmm1	# tmp104,
+# blake2s-vec.c:102:     H[0] = vload(ctx->H + 0);
+	.loc 1 102 10 view .LVU854
+	movaps	%xmm0, (%rsp)	# MEM <uint128_t> [(char * {ref-all})ctx_8(D)], H[0]
+	.loc 1 103 5 is_stmt 1 view .LVU855
+.LVL326:
+.LBB130:
+.LBI130:
+	.loc 1 24 20 view .LVU856
+.LBB131:
+	.loc 1 26 5 view .LVU857
+	.loc 1 27 5 view .LVU858
+	.loc 1 28 5 view .LVU859
+	.loc 1 28 5 is_stmt 0 view .LVU860
+.LBE131:
+.LBE130:
+# blake2s-vec.c:103:     H[1] = vload(ctx->H + 4);
+	.loc 1 103 10 view .LVU861
+	movaps	%xmm3, 16(%rsp)	# tmp104, H[1]
+	.loc 1 104 5 is_stmt 1 view .LVU862
+.LVL327:
+	.loc 1 106 5 view .LVU863
+	call	blake2s_10rounds.constprop.0	#
+.LVL328:
+	.loc 1 109 5 view .LVU864
+.LBB132:
+.LBI132:
+	.loc 1 31 20 view .LVU865
+.LBB133:
+	.loc 1 33 5 view .LVU866
+	movdqa	(%rsp), %xmm4	# H[0], tmp105
+.LBE133:
+.LBE132:
+.LBB135:
+.LBB136:
+	movdqa	16(%rsp), %xmm5	# H[1], tmp106
+.LBE136:
+.LBE135:
+.LBB138:
+.LBB134:
+	movups	%xmm4, (%r8)	# tmp105, MEM <uint128_t> [(char * {ref-all})ctx_8(D)]
+.LVL329:
+	.loc 1 33 5 is_stmt 0 view .LVU867
+.LBE134:
+.LBE138:
+	.loc 1 110 5 is_stmt 1 view .LVU868
+.LBB139:
+.LBI135:
+	.loc 1 31 20 view .LVU869
+.LBB137:
+	.loc 1 33 5 view .LVU870
+	movups	%xmm5, 16(%r8)	# tmp106, MEM <uint128_t> [(char * {ref-all})ctx_8(D) + 16B]
+.LVL330:
+	.loc 1 33 5 is_stmt 0 view .LVU871
+.LBE137:
+.LBE139:
+# blake2s-vec.c:111: }
+	.loc 1 111 1 view .LVU872
+	addq	$40, %rsp	#,
+	.cfi_def_cfa_offset 8
+	ret	
+	.cfi_endproc
+.LFE20:
+	.size	blake2s_compress_vec, .-blake2s_compress_vec
+	.p2align 4
+	.globl	blake2s_compress_blocks_vec
+	.type	blake2s_compress_blocks_vec, @function
+blake2s_compress_blocks_vec:
+.LVL331:
+.LFB21:
+	.loc 1 115 1 is_stmt 1 view -0
+	.cfi_startproc
+	.loc 1 115 1 is_stmt 0 view .LVU874
+	pushq	%r15	#
+	.cfi_def_cfa_offset 16
+	.cfi_offset 15, -16
+	pushq	%r14	#
+	.cfi_def_cfa_offset 24
+	.cfi_offset 14, -24
+	pushq	%r13	#
+	.cfi_def_cfa_offset 32
+	.cfi_offset 13, -32
+	pushq	%r12	#
+	.cfi_def_cfa_offset 40
+	.cfi_offset 12, -40
+	pushq	%rbp	#
+	.cfi_def_cfa_offset 48
+	.cfi_offset 6, -48
+	movq	%rdi, %rbp	# tmp123, ctx
+	.loc 1 116 5 is_stmt 1 view .LVU875
+.LVL332:
+	.loc 1 117 5 view .LVU876
+	.loc 1 118 5 view .LVU877
+# blake2s-vec.c:115: {
+	.loc 1 115 1 is_stmt 0 view .LVU878
+	pushq	%rbx	#
+	.cfi_def_cfa_offset 56
+	.cfi_offset 3, -56
+	subq	$56, %rsp	#,
+	.cfi_def_cfa_offset 112
+# blake2s-vec.c:118:     u32 t0 = ctx->t[0], t1 = ctx->t[1];
+	.loc 1 118 9 view .LVU879
+	movq	96(%rdi), %xmm2	# MEM <vector(2) unsigned int> [(unsigned int *)ctx_19(D) + 96B], vect_t0_20.84
+.LBB140:
+.LBB141:
+# blake2s-vec.c:27:     memcpy(&v, p, sizeof(v));
+	.loc 1 27 5 view .LVU880
+	movdqu	(%rdi), %xmm4	# MEM <uint128_t> [(char * {ref-all})ctx_19(D)], _78
+.LBE141:
+.LBE140:
+.LBB143:
+.LBB144:
+	movdqu	16(%rdi), %xmm3	# MEM <uint128_t> [(char * {ref-all})ctx_19(D) + 16B], _76
+	movd	%xmm2, 12(%rsp)	# _16, %sfp
+.LVL333:
+	.loc 1 27 5 view .LVU881
+.LBE144:
+.LBE143:
+	.loc 1 119 5 is_stmt 1 view .LVU882
+.LBB146:
+.LBI140:
+	.loc 1 24 20 view .LVU883
+.LBB142:
+	.loc 1 26 5 view .LVU884
+	.loc 1 27 5 view .LVU885
+	.loc 1 28 5 view .LVU886
+	.loc 1 28 5 is_stmt 0 view .LVU887
+	pshufd	$0xe5, %xmm2, %xmm7	# vect_t0_20.84, t1
+.LBE142:
+.LBE146:
+# blake2s-vec.c:119:     H[0] = vload(ctx->H + 0);
+	.loc 1 119 10 view .LVU888
+	movaps	%xmm4, 16(%rsp)	# _78, H[0]
+	.loc 1 120 5 is_stmt 1 view .LVU889
+.LVL334:
+.LBB147:
+.LBI143:
+	.loc 1 24 20 view .LVU890
+.LBB145:
+	.loc 1 26 5 view .LVU891
+	.loc 1 27 5 view .LVU892
+	.loc 1 28 5 view .LVU893
+	.loc 1 28 5 is_stmt 0 view .LVU894
+.LBE145:
+.LBE147:
+# blake2s-vec.c:120:     H[1] = vload(ctx->H + 4);
+	.loc 1 120 10 view .LVU895
+	movaps	%xmm3, 32(%rsp)	# _76, H[1]
+	.loc 1 122 5 is_stmt 1 view .LVU896
+	.loc 1 122 12 view .LVU897
+	testq	%rdx, %rdx	# nblocks
+	je	.L6	#,
+	movd	104(%rdi), %xmm6	# ctx_19(D)->f[0], tmp121
+	movd	%xmm7, %r8d	# t1, t1
+	movq	%rsi, %r14	# tmp124, m
+	movq	%rdx, %r13	# tmp125, nblocks
+	movd	108(%rdi), %xmm7	# ctx_19(D)->f[1], tmp129
+	movdqa	%xmm4, %xmm0	# _78, v
+	movdqa	%xmm3, %xmm1	# _76, v
+.LBB148:
+# blake2s-vec.c:126:                          blake2s_viv[1] ^ (vu32){ t0, t1, ctx->f[0], ctx->f[1] },
+	.loc 1 126 76 is_stmt 0 view .LVU898
+	movq	%rdx, %rbx	# nblocks, nblocks
+	movd	%xmm2, %r15d	# vect_t0_20.84, _16
+	leaq	16(%rsp), %r12	#, tmp122
+	punpckldq	%xmm7, %xmm6	# tmp129, tmp121
+	movq	%xmm6, (%rsp)	# tmp121, %sfp
+	jmp	.L8	#
+.LVL335:
+	.p2align 4,,10
+	.p2align 3
+.L7:
+	.loc 1 126 76 view .LVU899
+.LBE148:
+# blake2s-vec.c:131:     vstore(ctx->H + 4, H[1]);
+	.loc 1 131 5 view .LVU900
+	movdqa	32(%rsp), %xmm1	# H[1], v
+# blake2s-vec.c:130:     vstore(ctx->H + 0, H[0]);
+	.loc 1 130 5 view .LVU901
+	movdqa	16(%rsp), %xmm0	# H[0], v
+.LVL336:
+.L8:
+.LBB149:
+	.loc 1 123 9 is_stmt 1 discriminator 2 view .LVU902
+# blake2s-vec.c:123:         t0 += BLAKE2S_BLOCK;
+	.loc 1 123 12 is_stmt 0 discriminator 2 view .LVU903
+	addl	$64, %r15d	#, t0
+.LVL337:
+	.loc 1 124 9 is_stmt 1 discriminator 2 view .LVU904
+# blake2s-vec.c:124:         t1 += (t0 < BLAKE2S_BLOCK);
+	.loc 1 124 19 is_stmt 0 discriminator 2 view .LVU905
+	xorl	%eax, %eax	# tmp107
+# blake2s-vec.c:125:         blake2s_10rounds(H[0], H[1], blake2s_viv[0],
+	.loc 1 125 9 discriminator 2 view .LVU906
+	movq	%r14, %rsi	# m,
+	movq	%r12, %rdi	# tmp122,
+# blake2s-vec.c:124:         t1 += (t0 < BLAKE2S_BLOCK);
+	.loc 1 124 19 discriminator 2 view .LVU907
+	cmpl	$63, %r15d	#, t0
+# blake2s-vec.c:126:                          blake2s_viv[1] ^ (vu32){ t0, t1, ctx->f[0], ctx->f[1] },
+	.loc 1 126 49 discriminator 2 view .LVU908
+	movd	%r15d, %xmm2	# t0, tmp112
+# blake2s-vec.c:124:         t1 += (t0 < BLAKE2S_BLOCK);
+	.loc 1 124 19 discriminator 2 view .LVU909
+	setbe	%al	#, tmp107
+.LBE149:
+# blake2s-vec.c:122:     for (; nblocks; nblocks--, msg += BLAKE2S_BLOCK) {
+	.loc 1 122 36 discriminator 2 view .LVU910
+	addq	$64, %r14	#, m
+.LVL338:
+.LBB150:
+# blake2s-vec.c:124:         t1 += (t0 < BLAKE2S_BLOCK);
+	.loc 1 124 12 discriminator 2 view .LVU911
+	addl	%eax, %r8d	# tmp107, t1
+.LVL339:
+	.loc 1 125 9 is_stmt 1 discriminator 2 view .LVU912
+# blake2s-vec.c:126:                          blake2s_viv[1] ^ (vu32){ t0, t1, ctx->f[0], ctx->f[1] },
+	.loc 1 126 49 is_stmt 0 discriminator 2 view .LVU913
+	movd	%r8d, %xmm5	# t1, t1
+	punpckldq	%xmm5, %xmm2	# t1, tmp112
+	movhps	(%rsp), %xmm2	# %sfp, tmp110
+# blake2s-vec.c:125:         blake2s_10rounds(H[0], H[1], blake2s_viv[0],
+	.loc 1 125 9 discriminator 2 view .LVU914
+	pxor	.LC1(%rip), %xmm2	#,
+	call	blake2s_10rounds.constprop.0	#
+.LVL340:
+	.loc 1 125 9 discriminator 2 view .LVU915
+.LBE150:
+	.loc 1 122 30 is_stmt 1 discriminator 2 view .LVU916
+	.loc 1 122 12 discriminator 2 view .LVU917
+	subq	$1, %rbx	#, nblocks
+.LVL341:
+	.loc 1 122 12 is_stmt 0 discriminator 2 view .LVU918
+	jne	.L7	#,
+.LBB151:
+# blake2s-vec.c:123:         t0 += BLAKE2S_BLOCK;
+	.loc 1 123 12 view .LVU919
+	movl	12(%rsp), %eax	# %sfp, _16
+	sall	$6, %r13d	#, tmp118
+	movd	%r8d, %xmm6	# t1, t1
+.LBE151:
+.LBB152:
+.LBB153:
+# blake2s-vec.c:33:     memcpy(p, &v, sizeof(v));
+	.loc 1 33 5 view .LVU920
+	movdqa	32(%rsp), %xmm3	# H[1], _76
+.LBE153:
+.LBE152:
+.LBB155:
+.LBB156:
+	movdqa	16(%rsp), %xmm4	# H[0], _78
+.LBE156:
+.LBE155:
+.LBB158:
+# blake2s-vec.c:123:         t0 += BLAKE2S_BLOCK;
+	.loc 1 123 12 view .LVU921
+	addl	%r13d, %eax	# tmp118, _16
+	movd	%eax, %xmm2	# _16, t0
+	punpckldq	%xmm6, %xmm2	# t1, vect_t0_20.84
+.LVL342:
+.L6:
+	.loc 1 123 12 view .LVU922
+.LBE158:
+	.loc 1 130 5 is_stmt 1 view .LVU923
+.LBB159:
+.LBI155:
+	.loc 1 31 20 view .LVU924
+.LBB157:
+	.loc 1 33 5 view .LVU925
+	movups	%xmm4, 0(%rbp)	# _78, MEM <uint128_t> [(char * {ref-all})ctx_19(D)]
+.LVL343:
+	.loc 1 33 5 is_stmt 0 view .LVU926
+.LBE157:
+.LBE159:
+	.loc 1 131 5 is_stmt 1 view .LVU927
+.LBB160:
+.LBI152:
+	.loc 1 31 20 view .LVU928
+.LBB154:
+	.loc 1 33 5 view .LVU929
+	movups	%xmm3, 16(%rbp)	# _76, MEM <uint128_t> [(char * {ref-all})ctx_19(D) + 16B]
+.LVL344:
+	.loc 1 33 5 is_stmt 0 view .LVU930
+.LBE154:
+.LBE160:
+	.loc 1 132 5 is_stmt 1 view .LVU931
+	.loc 1 133 5 view .LVU932
+# blake2s-vec.c:132:     ctx->t[0] = t0;
+	.loc 1 132 15 is_stmt 0 view .LVU933
+	movq	%xmm2, 96(%rbp)	# vect_t0_20.84, MEM <vector(2) unsigned int> [(unsigned int *)ctx_19(D) + 96B]
+# blake2s-vec.c:134: }
+	.loc 1 134 1 view .LVU934
+	addq	$56, %rsp	#,
+	.cfi_def_cfa_offset 56
+	popq	%rbx	#
+	.cfi_def_cfa_offset 48
+	popq	%rbp	#
+	.cfi_def_cfa_offset 40
+.LVL345:
+	.loc 1 134 1 view .LVU935
+	popq	%r12	#
+	.cfi_def_cfa_offset 32
+	popq	%r13	#
+	.cfi_def_cfa_offset 24
+	popq	%r14	#
+	.cfi_def_cfa_offset 16
+	popq	%r15	#
+	.cfi_def_cfa_offset 8
+	ret	
+	.cfi_endproc
+.LFE21:
+	.size	blake2s_compress_blocks_vec, .-blake2s_compress_blocks_vec
+	.section	.rodata.cst16,"aM",@progbits,16
+	.align 16
+.LC0:
+	.long	1779033703
+	.long	-1150833019
+	.long	1013904242
+	.long	-1521486534
+	.align 16
+.LC1:
+	.long	1359893119
+	.long	-1694144372
+	.long	528734635
+	.long	1541459225
+	.text
+.Letext0:
+	.file 2 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stddef.h"
+	.file 3 "/usr/include/x86_64-linux-gnu/bits/types.h"
+	.file 4 "/usr/include/x86_64-linux-gnu/bits/stdint-uintn.h"
+	.file 5 "blake2s.h"
+	.file 6 "blake2s-internal.h"
+	.section	.debug_info,"",@progbits
+.Ldebug_info0:
+	.long	0x7c4
+	.value	0x5
+	.byte	0x1
+	.byte	0x8
+	.long	.Ldebug_abbrev0
+	.uleb128 0x19
+	.long	.LASF33
+	.byte	0xc
+	.long	.LASF0
+	.long	.LASF1
+	.long	.LLRL42
+	.quad	0
+	.long	.Ldebug_line0
+	.uleb128 0x3
+	.byte	0x8
+	.byte	0x5
+	.long	.LASF2
+	.uleb128 0xb
+	.long	.LASF8
+	.byte	0x2
+	.byte	0xd6
+	.byte	0x1b
+	.long	0x3d
+	.uleb128 0x3
+	.byte	0x8
+	.byte	0x7
+	.long	.LASF3
+	.uleb128 0x1a
+	.byte	0x4
+	.byte	0x5
+	.string	"int"
+	.uleb128 0x5
+	.long	0x44
+	.uleb128 0x3
+	.byte	0x1
+	.byte	0x8
+	.long	.LASF4
+	.uleb128 0x5
+	.long	0x50
+	.uleb128 0x3
+	.byte	0x2
+	.byte	0x7
+	.long	.LASF5
+	.uleb128 0x3
+	.byte	0x4
+	.byte	0x7
+	.long	.LASF6
+	.uleb128 0x3
+	.byte	0x1
+	.byte	0x6
+	.long	.LASF7
+	.uleb128 0xb
+	.long	.LASF9
+	.byte	0x3
+	.byte	0x26
+	.byte	0x17
+	.long	0x50
+	.uleb128 0x3
+	.byte	0x2
+	.byte	0x5
+	.long	.LASF10
+	.uleb128 0xb
+	.long	.LASF11
+	.byte	0x3
+	.byte	0x2a
+	.byte	0x16
+	.long	0x63
+	.uleb128 0x3
+	.byte	0x1
+	.byte	0x6
+	.long	.LASF12
+	.uleb128 0xb
+	.long	.LASF13
+	.byte	0x4
+	.byte	0x18
+	.byte	0x13
+	.long	0x71
+	.uleb128 0xb
+	.long	.LASF14
+	.byte	0x4
+	.byte	0x1a
+	.byte	0x14
+	.long	0x84
+	.uleb128 0x1b
+	.long	.LASF34
+	.byte	0x80
+	.byte	0x10
+	.byte	0x5
+	.byte	0xf7
+	.byte	0x8
+	.long	0x109
+	.uleb128 0xc
+	.string	"H"
+	.byte	0xf8
+	.byte	0xe
+	.long	0x109
+	.byte	0
+	.uleb128 0xc
+	.string	"buf"
+	.byte	0xf9
+	.byte	0x13
+	.long	0x119
+	.byte	0x20
+	.uleb128 0xc
+	.string	"t"
+	.byte	0xfa
+	.byte	0xe
+	.long	0x129
+	.byte	0x60
+	.uleb128 0xc
+	.string	"f"
+	.byte	0xfb
+	.byte	0xe
+	.long	0x129
+	.byte	0x68
+	.uleb128 0x10
+	.long	.LASF15
+	.byte	0xfc
+	.long	0x63
+	.byte	0x70
+	.uleb128 0x10
+	.long	.LASF16
+	.byte	0xfd
+	.long	0x63
+	.byte	0x74
+	.uleb128 0x10
+	.long	.LASF17
+	.byte	0xfe
+	.long	0x63
+	.byte	0x78
+	.byte	0
+	.uleb128 0x6
+	.long	0xa3
+	.long	0x119
+	.uleb128 0x4
+	.long	0x3d
+	.byte	0x7
+	.byte	0
+	.uleb128 0x6
+	.long	0x50
+	.long	0x129
+	.uleb128 0x4
+	.long	0x3d
+	.byte	0x3f
+	.byte	0
+	.uleb128 0x6
+	.long	0xa3
+	.long	0x139
+	.uleb128 0x4
+	.long	0x3d
+	.byte	0x1
+	.byte	0
+	.uleb128 0x9
+	.long	0xaf
+	.uleb128 0x9
+	.long	0x143
+	.uleb128 0x1c
+	.uleb128 0x3
+	.byte	0x8
+	.byte	0x7
+	.long	.LASF18
+	.uleb128 0x3
+	.byte	0x8
+	.byte	0x5
+	.long	.LASF19
+	.uleb128 0x14
+	.string	"u8"
+	.byte	0x7
+	.byte	0x11
+	.long	0x97
+	.uleb128 0x5
+	.long	0x152
+	.uleb128 0x14
+	.string	"u32"
+	.byte	0x8
+	.byte	0x12
+	.long	0xa3
+	.uleb128 0x5
+	.long	0x161
+	.uleb128 0x6
+	.long	0x16c
+	.long	0x181
+	.uleb128 0x4
+	.long	0x3d
+	.byte	0x7
+	.byte	0
+	.uleb128 0x5
+	.long	0x171
+	.uleb128 0x11
+	.long	.LASF20
+	.byte	0x6
+	.byte	0xa
+	.byte	0x12
+	.long	0x181
+	.byte	0x20
+	.byte	0x67
+	.byte	0xe6
+	.byte	0x9
+	.byte	0x6a
+	.byte	0x85
+	.byte	0xae
+	.byte	0x67
+	.byte	0xbb
+	.byte	0x72
+	.byte	0xf3
+	.byte	0x6e
+	.byte	0x3c
+	.byte	0x3a
+	.byte	0xf5
+	.byte	0x4f
+	.byte	0xa5
+	.byte	0x7f
+	.byte	0x52
+	.byte	0xe
+	.byte	0x51
+	.byte	0x8c
+	.byte	0x68
+	.byte	0x5
+	.byte	0x9b
+	.byte	0xab
+	.byte	0xd9
+	.byte	0x83
+	.byte	0x1f
+	.byte	0x19
+	.byte	0xcd
+	.byte	0xe0
+	.byte	0x5b
+	.uleb128 0x6
+	.long	0x15c
+	.long	0x1c9
+	.uleb128 0x4
+	.long	0x3d
+	.byte	0x9
+	.uleb128 0x4
+	.long	0x3d
+	.byte	0xf
+	.byte	0
+	.uleb128 0x5
+	.long	0x1b3
+	.uleb128 0x11
+	.long	.LASF21
+	.byte	0x6
+	.byte	0xf
+	.byte	0x11
+	.long	0x1c9
+	.byte	0xa0
+	.byte	0
+	.byte	0x1
+	.byte	0x2
+	.byte	0x3
+	.byte	0x4
+	.byte	0x5
+	.byte	0x6
+	.byte	0x7
+	.byte	0x8
+	.byte	0x9
+	.byte	0xa
+	.byte	0xb
+	.byte	0xc
+	.byte	0xd
+	.byte	0xe
+	.byte	0xf
+	.byte	0xe
+	.byte	0xa
+	.byte	0x4
+	.byte	0x8
+	.byte	0x9
+	.byte	0xf
+	.byte	0xd
+	.byte	0x6
+	.byte	0x1
+	.byte	0xc
+	.byte	0
+	.byte	0x2
+	.byte	0xb
+	.byte	0x7
+	.byte	0x5
+	.byte	0x3
+	.byte	0xb
+	.byte	0x8
+	.byte	0xc
+	.byte	0
+	.byte	0x5
+	.byte	0x2
+	.byte	0xf
+	.byte	0xd
+	.byte	0xa
+	.byte	0xe
+	.byte	0x3
+	.byte	0x6
+	.byte	0x7
+	.byte	0x1
+	.byte	0x9
+	.byte	0x4
+	.byte	0x7
+	.byte	0x9
+	.byte	0x3
+	.byte	0x1
+	.byte	0xd
+	.byte	0xc
+	.byte	0xb
+	.byte	0xe
+	.byte	0x2
+	.byte	0x6
+	.byte	0x5
+	.byte	0xa
+	.byte	0x4
+	.byte	0
+	.byte	0xf
+	.byte	0x8
+	.byte	0x9
+	.byte	0
+	.byte	0x5
+	.byte	0x7
+	.byte	0x2
+	.byte	0x4
+	.byte	0xa
+	.byte	0xf
+	.byte	0xe
+	.byte	0x1
+	.byte	0xb
+	.byte	0xc
+	.byte	0x6
+	.byte	0x8
+	.byte	0x3
+	.byte	0xd
+	.byte	0x2
+	.byte	0xc
+	.byte	0x6
+	.byte	0xa
+	.byte	0
+	.byte	0xb
+	.byte	0x8
+	.byte	0x3
+	.byte	0x4
+	.byte	0xd
+	.byte	0x7
+	.byte	0x5
+	.byte	0xf
+	.byte	0xe
+	.byte	0x1
+	.byte	0x9
+	.byte	0xc
+	.byte	0x5
+	.byte	0x1
+	.byte	0xf
+	.byte	0xe
+	.byte	0xd
+	.byte	0x4
+	.byte	0xa
+	.byte	0
+	.byte	0x7
+	.byte	0x6
+	.byte	0x3
+	.byte	0x9
+	.byte	0x2
+	.byte	0x8
+	.byte	0xb
+	.byte	0xd
+	.byte	0xb
+	.byte	0x7
+	.byte	0xe
+	.byte	0xc
+	.byte	0x1
+	.byte	0x3
+	.byte	0x9
+	.byte	0x5
+	.byte	0
+	.byte	0xf
+	.byte	0x4
+	.byte	0x8
+	.byte	0x6
+	.byte	0x2
+	.byte	0xa
+	.byte	0x6
+	.byte	0xf
+	.byte	0xe
+	.byte	0x9
+	.byte	0xb
+	.byte	0x3
+	.byte	0
+	.byte	0x8
+	.byte	0xc
+	.byte	0x2
+	.byte	0xd
+	.byte	0x7
+	.byte	0x1
+	.byte	0x4
+	.byte	0xa
+	.byte	0x5
+	.byte	0xa
+	.byte	0x2
+	.byte	0x8
+	.byte	0x4
+	.byte	0x7
+	.byte	0x6
+	.byte	0x1
+	.byte	0x5
+	.byte	0xf
+	.byte	0xb
+	.byte	0x9
+	.byte	0xe
+	.byte	0x3
+	.byte	0xc
+	.byte	0xd
+	.byte	0
+	.uleb128 0x9
+	.long	0x15c
+	.uleb128 0xb
+	.long	.LASF22
+	.byte	0x1
+	.byte	0xa
+	.byte	0xd
+	.long	0x291
+	.uleb128 0x5
+	.long	0x280
+	.uleb128 0x1d
+	.long	0x63
+	.long	0x29d
+	.uleb128 0x1e
+	.byte	0x3
+	.byte	0
+	.uleb128 0x6
+	.long	0x28c
+	.long	0x2ad
+	.uleb128 0x4
+	.long	0x3d
+	.byte	0x1
+	.byte	0
+	.uleb128 0x5
+	.long	0x29d
+	.uleb128 0x11
+	.long	.LASF23
+	.byte	0x1
+	.byte	0x13
+	.byte	0x13
+	.long	0x2ad
+	.byte	0x20
+	.byte	0x67
+	.byte	0xe6
+	.byte	0x9
+	.byte	0x6a
+	.byte	0x85
+	.byte	0xae
+	.byte	0x67
+	.byte	0xbb
+	.byte	0x72
+	.byte	0xf3
+	.byte	0x6e
+	.byte	0x3c
+	.byte	0x3a
+	.byte	0xf5
+	.byte	0x4f
+	.byte	0xa5
+	.byte	0x7f
+	.byte	0x52
+	.byte	0xe
+	.byte	0x51
+	.byte	0x8c
+	.byte	0x68
+	.byte	0x5
+	.byte	0x9b
+	.byte	0xab
+	.byte	0xd9
+	.byte	0x83
+	.byte	0x1f
+	.byte	0x19
+	.byte	0xcd
+	.byte	0xe0
+	.byte	0x5b
+	.uleb128 0x15
+	.long	.LASF25
+	.byte	0x71
+	.quad	.LFB21
+	.quad	.LFE21-.LFB21
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0x46d
+	.uleb128 0xd
+	.string	"ctx"
+	.byte	0x71
+	.byte	0x36
+	.long	0x139
+	.long	.LLST24
+	.long	.LVUS24
+	.uleb128 0xd
+	.string	"m"
+	.byte	0x71
+	.byte	0x47
+	.long	0x13e
+	.long	.LLST25
+	.long	.LVUS25
+	.uleb128 0x1f
+	.long	.LASF24
+	.byte	0x1
+	.byte	0x72
+	.byte	0x29
+	.long	0x31
+	.long	.LLST26
+	.long	.LVUS26
+	.uleb128 0xe
+	.string	"msg"
+	.byte	0x74
+	.byte	0xf
+	.long	0x27b
+	.long	.LLST27
+	.long	.LVUS27
+	.uleb128 0x16
+	.string	"H"
+	.byte	0x75
+	.long	0x46d
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -96
+	.uleb128 0xe
+	.string	"t0"
+	.byte	0x76
+	.byte	0x9
+	.long	0x161
+	.long	.LLST28
+	.long	.LVUS28
+	.uleb128 0xe
+	.string	"t1"
+	.byte	0x76
+	.byte	0x19
+	.long	0x161
+	.long	.LLST29
+	.long	.LVUS29
+	.uleb128 0xa
+	.long	0x692
+	.quad	.LBI140
+	.value	.LVU883
+	.long	.LLRL30
+	.byte	0x77
+	.byte	0xc
+	.long	0x3b0
+	.uleb128 0x1
+	.long	0x6a2
+	.long	.LLST31
+	.long	.LVUS31
+	.uleb128 0x12
+	.long	.LLRL30
+	.uleb128 0x7
+	.long	0x6ac
+	.long	.LLST32
+	.long	.LVUS32
+	.byte	0
+	.byte	0
+	.uleb128 0xa
+	.long	0x692
+	.quad	.LBI143
+	.value	.LVU890
+	.long	.LLRL33
+	.byte	0x78
+	.byte	0xc
+	.long	0x3ea
+	.uleb128 0x1
+	.long	0x6a2
+	.long	.LLST34
+	.long	.LVUS34
+	.uleb128 0x12
+	.long	.LLRL33
+	.uleb128 0x7
+	.long	0x6ac
+	.long	.LLST35
+	.long	.LVUS35
+	.byte	0
+	.byte	0
+	.uleb128 0xa
+	.long	0x66e
+	.quad	.LBI152
+	.value	.LVU928
+	.long	.LLRL36
+	.byte	0x83
+	.byte	0x5
+	.long	0x41e
+	.uleb128 0x1
+	.long	0x682
+	.long	.LLST37
+	.long	.LVUS37
+	.uleb128 0x1
+	.long	0x678
+	.long	.LLST38
+	.long	.LVUS38
+	.byte	0
+	.uleb128 0xa
+	.long	0x66e
+	.quad	.LBI155
+	.value	.LVU924
+	.long	.LLRL39
+	.byte	0x82
+	.byte	0x5
+	.long	0x452
+	.uleb128 0x1
+	.long	0x682
+	.long	.LLST40
+	.long	.LVUS40
+	.uleb128 0x1
+	.long	0x678
+	.long	.LLST41
+	.long	.LVUS41
+	.byte	0
+	.uleb128 0x17
+	.quad	.LVL340
+	.long	0x70d
+	.uleb128 0xf
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x7c
+	.sleb128 0
+	.uleb128 0xf
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x2
+	.byte	0x7e
+	.sleb128 -64
+	.byte	0
+	.byte	0
+	.uleb128 0x6
+	.long	0x280
+	.long	0x47d
+	.uleb128 0x4
+	.long	0x3d
+	.byte	0x1
+	.byte	0
+	.uleb128 0x15
+	.long	.LASF26
+	.byte	0x62
+	.quad	.LFB20
+	.quad	.LFE20-.LFB20
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0x5ca
+	.uleb128 0xd
+	.string	"ctx"
+	.byte	0x62
+	.byte	0x2f
+	.long	0x139
+	.long	.LLST12
+	.long	.LVUS12
+	.uleb128 0xd
+	.string	"m"
+	.byte	0x62
+	.byte	0x40
+	.long	0x13e
+	.long	.LLST13
+	.long	.LVUS13
+	.uleb128 0x16
+	.string	"H"
+	.byte	0x64
+	.long	0x46d
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -48
+	.uleb128 0xe
+	.string	"vpr"
+	.byte	0x65
+	.byte	0xa
+	.long	0x280
+	.long	.LLST14
+	.long	.LVUS14
+	.uleb128 0xa
+	.long	0x692
+	.quad	.LBI126
+	.value	.LVU843
+	.long	.LLRL15
+	.byte	0x66
+	.byte	0xc
+	.long	0x515
+	.uleb128 0x1
+	.long	0x6a2
+	.long	.LLST16
+	.long	.LVUS16
+	.uleb128 0x12
+	.long	.LLRL15
+	.uleb128 0x7
+	.long	0x6ac
+	.long	.LLST17
+	.long	.LVUS17
+	.byte	0
+	.byte	0
+	.uleb128 0x20
+	.long	0x692
+	.quad	.LBI130
+	.value	.LVU856
+	.quad	.LBB130
+	.quad	.LBE130-.LBB130
+	.byte	0x1
+	.byte	0x67
+	.byte	0xc
+	.long	0x546
+	.uleb128 0x21
+	.long	0x6a2
+	.uleb128 0x22
+	.long	0x6ac
+	.byte	0
+	.uleb128 0xa
+	.long	0x66e
+	.quad	.LBI132
+	.value	.LVU865
+	.long	.LLRL18
+	.byte	0x6d
+	.byte	0x5
+	.long	0x57a
+	.uleb128 0x1
+	.long	0x682
+	.long	.LLST19
+	.long	.LVUS19
+	.uleb128 0x1
+	.long	0x678
+	.long	.LLST20
+	.long	.LVUS20
+	.byte	0
+	.uleb128 0xa
+	.long	0x66e
+	.quad	.LBI135
+	.value	.LVU869
+	.long	.LLRL21
+	.byte	0x6e
+	.byte	0x5
+	.long	0x5ae
+	.uleb128 0x1
+	.long	0x682
+	.long	.LLST22
+	.long	.LVUS22
+	.uleb128 0x1
+	.long	0x678
+	.long	.LLST23
+	.long	.LVUS23
+	.byte	0
+	.uleb128 0x17
+	.quad	.LVL328
+	.long	0x70d
+	.uleb128 0xf
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -48
+	.uleb128 0xf
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x3
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0
+	.byte	0
+	.uleb128 0x18
+	.long	.LASF27
+	.byte	0x24
+	.long	0x659
+	.uleb128 0x2
+	.string	"va"
+	.byte	0x1
+	.byte	0x24
+	.byte	0x2a
+	.long	0x280
+	.uleb128 0x2
+	.string	"vb"
+	.byte	0x1
+	.byte	0x24
+	.byte	0x33
+	.long	0x280
+	.uleb128 0x2
+	.string	"vc"
+	.byte	0x1
+	.byte	0x24
+	.byte	0x3c
+	.long	0x280
+	.uleb128 0x2
+	.string	"vd"
+	.byte	0x1
+	.byte	0x24
+	.byte	0x45
+	.long	0x280
+	.uleb128 0x2
+	.string	"H"
+	.byte	0x1
+	.byte	0x25
+	.byte	0x2a
+	.long	0x659
+	.uleb128 0x2
+	.string	"msg"
+	.byte	0x1
+	.byte	0x25
+	.byte	0x3c
+	.long	0x13e
+	.uleb128 0x8
+	.string	"m"
+	.byte	0x1
+	.byte	0x27
+	.byte	0x9
+	.long	0x65e
+	.uleb128 0x8
+	.string	"m1"
+	.byte	0x1
+	.byte	0x28
+	.byte	0xa
+	.long	0x280
+	.uleb128 0x8
+	.string	"m2"
+	.byte	0x1
+	.byte	0x28
+	.byte	0xe
+	.long	0x280
+	.uleb128 0x8
+	.string	"m3"
+	.byte	0x1
+	.byte	0x28
+	.byte	0x12
+	.long	0x280
+	.uleb128 0x8
+	.string	"m4"
+	.byte	0x1
+	.byte	0x28
+	.byte	0x16
+	.long	0x280
+	.uleb128 0x23
+	.uleb128 0x8
+	.string	"i"
+	.byte	0x1
+	.byte	0x29
+	.byte	0x13
+	.long	0x63
+	.byte	0
+	.byte	0
+	.uleb128 0x9
+	.long	0x280
+	.uleb128 0x6
+	.long	0x161
+	.long	0x66e
+	.uleb128 0x4
+	.long	0x3d
+	.byte	0xf
+	.byte	0
+	.uleb128 0x18
+	.long	.LASF28
+	.byte	0x1f
+	.long	0x68d
+	.uleb128 0x2
+	.string	"p"
+	.byte	0x1
+	.byte	0x1f
+	.byte	0x20
+	.long	0x68d
+	.uleb128 0x2
+	.string	"v"
+	.byte	0x1
+	.byte	0x1f
+	.byte	0x28
+	.long	0x280
+	.byte	0
+	.uleb128 0x9
+	.long	0x161
+	.uleb128 0x13
+	.long	.LASF29
+	.byte	0x1
+	.byte	0x18
+	.byte	0x14
+	.long	0x280
+	.long	0x6b7
+	.uleb128 0x2
+	.string	"p"
+	.byte	0x1
+	.byte	0x18
+	.byte	0x25
+	.long	0x6b7
+	.uleb128 0x8
+	.string	"v"
+	.byte	0x1
+	.byte	0x1a
+	.byte	0xa
+	.long	0x280
+	.byte	0
+	.uleb128 0x9
+	.long	0x16c
+	.uleb128 0x13
+	.long	.LASF30
+	.byte	0x6
+	.byte	0xd9
+	.byte	0x13
+	.long	0x161
+	.long	0x6e1
+	.uleb128 0x2
+	.string	"x"
+	.byte	0x6
+	.byte	0xd9
+	.byte	0x32
+	.long	0x6e1
+	.uleb128 0x8
+	.string	"w"
+	.byte	0x6
+	.byte	0xda
+	.byte	0x9
+	.long	0x161
+	.byte	0
+	.uleb128 0x9
+	.long	0x57
+	.uleb128 0x13
+	.long	.LASF31
+	.byte	0x6
+	.byte	0xd4
+	.byte	0x13
+	.long	0x161
+	.long	0x70d
+	.uleb128 0x2
+	.string	"x"
+	.byte	0x6
+	.byte	0xd4
+	.byte	0x1f
+	.long	0x161
+	.uleb128 0x24
+	.long	.LASF32
+	.byte	0x6
+	.byte	0xd5
+	.byte	0xf
+	.long	0x4b
+	.byte	0
+	.uleb128 0x25
+	.long	0x5ca
+	.quad	.LFB22
+	.quad	.LFE22-.LFB22
+	.uleb128 0x1
+	.byte	0x9c
+	.uleb128 0x1
+	.long	0x5d4
+	.long	.LLST0
+	.long	.LVUS0
+	.uleb128 0x1
+	.long	0x5df
+	.long	.LLST1
+	.long	.LVUS1
+	.uleb128 0x1
+	.long	0x5f5
+	.long	.LLST2
+	.long	.LVUS2
+	.uleb128 0x1
+	.long	0x600
+	.long	.LLST3
+	.long	.LVUS3
+	.uleb128 0x1
+	.long	0x60a
+	.long	.LLST4
+	.long	.LVUS4
+	.uleb128 0x26
+	.long	0x616
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -80
+	.uleb128 0x7
+	.long	0x620
+	.long	.LLST5
+	.long	.LVUS5
+	.uleb128 0x7
+	.long	0x62b
+	.long	.LLST6
+	.long	.LVUS6
+	.uleb128 0x7
+	.long	0x636
+	.long	.LLST7
+	.long	.LVUS7
+	.uleb128 0x7
+	.long	0x641
+	.long	.LLST8
+	.long	.LVUS8
+	.uleb128 0x1
+	.long	0x5ea
+	.long	.LLST9
+	.long	.LVUS9
+	.uleb128 0x27
+	.long	0x64c
+	.long	.LLRL10
+	.uleb128 0x7
+	.long	0x64d
+	.long	.LLST11
+	.long	.LVUS11
+	.byte	0
+	.byte	0
+	.byte	0
+	.section	.debug_abbrev,"",@progbits
+.Ldebug_abbrev0:
+	.uleb128 0x1
+	.uleb128 0x5
+	.byte	0
+	.uleb128 0x31
+	.uleb128 0x13
+	.uleb128 0x2
+	.uleb128 0x17
+	.uleb128 0x2137
+	.uleb128 0x17
+	.byte	0
+	.byte	0
+	.uleb128 0x2
+	.uleb128 0x5
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x8
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x24
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x3e
+	.uleb128 0xb
+	.uleb128 0x3
+	.uleb128 0xe
+	.byte	0
+	.byte	0
+	.uleb128 0x4
+	.uleb128 0x21
+	.byte	0
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x2f
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x5
+	.uleb128 0x26
+	.byte	0
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x6
+	.uleb128 0x1
+	.byte	0x1
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x7
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x31
+	.uleb128 0x13
+	.uleb128 0x2
+	.uleb128 0x17
+	.uleb128 0x2137
+	.uleb128 0x17
+	.byte	0
+	.byte	0
+	.uleb128 0x8
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x8
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x9
+	.uleb128 0xf
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0x21
+	.sleb128 8
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0xa
+	.uleb128 0x1d
+	.byte	0x1
+	.uleb128 0x31
+	.uleb128 0x13
+	.uleb128 0x52
+	.uleb128 0x1
+	.uleb128 0x2138
+	.uleb128 0x5
+	.uleb128 0x55
+	.uleb128 0x17
+	.uleb128 0x58
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x59
+	.uleb128 0xb
+	.uleb128 0x57
+	.uleb128 0xb
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0x16
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0xc
+	.uleb128 0xd
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x8
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 5
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x38
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0xd
+	.uleb128 0x5
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x8
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x2
+	.uleb128 0x17
+	.uleb128 0x2137
+	.uleb128 0x17
+	.byte	0
+	.byte	0
+	.uleb128 0xe
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x8
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x2
+	.uleb128 0x17
+	.uleb128 0x2137
+	.uleb128 0x17
+	.byte	0
+	.byte	0
+	.uleb128 0xf
+	.uleb128 0x49
+	.byte	0
+	.uleb128 0x2
+	.uleb128 0x18
+	.uleb128 0x7e
+	.uleb128 0x18
+	.byte	0
+	.byte	0
+	.uleb128 0x10
+	.uleb128 0xd
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 5
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 14
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x38
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x11
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x1c
+	.uleb128 0xa
+	.byte	0
+	.byte	0
+	.uleb128 0x12
+	.uleb128 0xb
+	.byte	0x1
+	.uleb128 0x55
+	.uleb128 0x17
+	.byte	0
+	.byte	0
+	.uleb128 0x13
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x20
+	.uleb128 0x21
+	.sleb128 3
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x14
+	.uleb128 0x16
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x8
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 6
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x15
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 6
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x11
+	.uleb128 0x1
+	.uleb128 0x12
+	.uleb128 0x7
+	.uleb128 0x40
+	.uleb128 0x18
+	.uleb128 0x7a
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x16
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x8
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 10
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x2
+	.uleb128 0x18
+	.byte	0
+	.byte	0
+	.uleb128 0x17
+	.uleb128 0x48
+	.byte	0x1
+	.uleb128 0x7d
+	.uleb128 0x1
+	.uleb128 0x7f
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x18
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 20
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x20
+	.uleb128 0x21
+	.sleb128 3
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x19
+	.uleb128 0x11
+	.byte	0x1
+	.uleb128 0x25
+	.uleb128 0xe
+	.uleb128 0x13
+	.uleb128 0xb
+	.uleb128 0x3
+	.uleb128 0x1f
+	.uleb128 0x1b
+	.uleb128 0x1f
+	.uleb128 0x55
+	.uleb128 0x17
+	.uleb128 0x11
+	.uleb128 0x1
+	.uleb128 0x10
+	.uleb128 0x17
+	.byte	0
+	.byte	0
+	.uleb128 0x1a
+	.uleb128 0x24
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x3e
+	.uleb128 0xb
+	.uleb128 0x3
+	.uleb128 0x8
+	.byte	0
+	.byte	0
+	.uleb128 0x1b
+	.uleb128 0x13
+	.byte	0x1
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x88
+	.uleb128 0xb
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x1c
+	.uleb128 0x26
+	.byte	0
+	.byte	0
+	.byte	0
+	.uleb128 0x1d
+	.uleb128 0x1
+	.byte	0x1
+	.uleb128 0x2107
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x1e
+	.uleb128 0x21
+	.byte	0
+	.uleb128 0x2f
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x1f
+	.uleb128 0x5
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x2
+	.uleb128 0x17
+	.uleb128 0x2137
+	.uleb128 0x17
+	.byte	0
+	.byte	0
+	.uleb128 0x20
+	.uleb128 0x1d
+	.byte	0x1
+	.uleb128 0x31
+	.uleb128 0x13
+	.uleb128 0x52
+	.uleb128 0x1
+	.uleb128 0x2138
+	.uleb128 0x5
+	.uleb128 0x11
+	.uleb128 0x1
+	.uleb128 0x12
+	.uleb128 0x7
+	.uleb128 0x58
+	.uleb128 0xb
+	.uleb128 0x59
+	.uleb128 0xb
+	.uleb128 0x57
+	.uleb128 0xb
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x21
+	.uleb128 0x5
+	.byte	0
+	.uleb128 0x31
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x22
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x31
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x23
+	.uleb128 0xb
+	.byte	0x1
+	.byte	0
+	.byte	0
+	.uleb128 0x24
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x25
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x31
+	.uleb128 0x13
+	.uleb128 0x11
+	.uleb128 0x1
+	.uleb128 0x12
+	.uleb128 0x7
+	.uleb128 0x40
+	.uleb128 0x18
+	.uleb128 0x7a
+	.uleb128 0x19
+	.byte	0
+	.byte	0
+	.uleb128 0x26
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x31
+	.uleb128 0x13
+	.uleb128 0x2
+	.uleb128 0x18
+	.byte	0
+	.byte	0
+	.uleb128 0x27
+	.uleb128 0xb
+	.byte	0x1
+	.uleb128 0x31
+	.uleb128 0x13
+	.uleb128 0x55
+	.uleb128 0x17
+	.byte	0
+	.byte	0
+	.byte	0
+	.section	.debug_loclists,"",@progbits
+	.long	.Ldebug_loc3-.Ldebug_loc2
+.Ldebug_loc2:
+	.value	0x5
+	.byte	0x8
+	.byte	0
+	.long	0
+.Ldebug_loc0:
+.LVUS24:
+	.uleb128 0
+	.uleb128 .LVU899
+	.uleb128 .LVU899
+	.uleb128 .LVU935
+	.uleb128 .LVU935
+	.uleb128 0
+.LLST24:
+	.byte	0x6
+	.quad	.LVL331
+	.byte	0x4
+	.uleb128 .LVL331-.LVL331
+	.uleb128 .LVL335-.LVL331
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL335-.LVL331
+	.uleb128 .LVL345-.LVL331
+	.uleb128 0x1
+	.byte	0x56
+	.byte	0x4
+	.uleb128 .LVL345-.LVL331
+	.uleb128 .LFE21-.LVL331
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x9f
+	.byte	0
+.LVUS25:
+	.uleb128 0
+	.uleb128 .LVU899
+	.uleb128 .LVU899
+	.uleb128 0
+.LLST25:
+	.byte	0x6
+	.quad	.LVL331
+	.byte	0x4
+	.uleb128 .LVL331-.LVL331
+	.uleb128 .LVL335-.LVL331
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x4
+	.uleb128 .LVL335-.LVL331
+	.uleb128 .LFE21-.LVL331
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x9f
+	.byte	0
+.LVUS26:
+	.uleb128 0
+	.uleb128 .LVU899
+	.uleb128 .LVU899
+	.uleb128 .LVU917
+	.uleb128 .LVU917
+	.uleb128 .LVU918
+	.uleb128 .LVU918
+	.uleb128 .LVU922
+.LLST26:
+	.byte	0x6
+	.quad	.LVL331
+	.byte	0x4
+	.uleb128 .LVL331-.LVL331
+	.uleb128 .LVL335-.LVL331
+	.uleb128 0x1
+	.byte	0x51
+	.byte	0x4
+	.uleb128 .LVL335-.LVL331
+	.uleb128 .LVL340-.LVL331
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0x4
+	.uleb128 .LVL340-.LVL331
+	.uleb128 .LVL341-.LVL331
+	.uleb128 0x3
+	.byte	0x73
+	.sleb128 -1
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL341-.LVL331
+	.uleb128 .LVL342-.LVL331
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0
+.LVUS27:
+	.uleb128 .LVU876
+	.uleb128 .LVU899
+	.uleb128 .LVU899
+	.uleb128 .LVU911
+	.uleb128 .LVU911
+	.uleb128 .LVU915
+	.uleb128 .LVU915
+	.uleb128 .LVU917
+	.uleb128 .LVU917
+	.uleb128 .LVU922
+.LLST27:
+	.byte	0x6
+	.quad	.LVL332
+	.byte	0x4
+	.uleb128 .LVL332-.LVL332
+	.uleb128 .LVL335-.LVL332
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x4
+	.uleb128 .LVL335-.LVL332
+	.uleb128 .LVL338-.LVL332
+	.uleb128 0x1
+	.byte	0x5e
+	.byte	0x4
+	.uleb128 .LVL338-.LVL332
+	.uleb128 .LVL340-1-.LVL332
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x4
+	.uleb128 .LVL340-1-.LVL332
+	.uleb128 .LVL340-.LVL332
+	.uleb128 0x3
+	.byte	0x7e
+	.sleb128 -64
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL340-.LVL332
+	.uleb128 .LVL342-.LVL332
+	.uleb128 0x1
+	.byte	0x5e
+	.byte	0
+.LVUS28:
+	.uleb128 .LVU881
+	.uleb128 .LVU899
+	.uleb128 .LVU899
+	.uleb128 .LVU922
+.LLST28:
+	.byte	0x6
+	.quad	.LVL333
+	.byte	0x4
+	.uleb128 .LVL333-.LVL333
+	.uleb128 .LVL335-.LVL333
+	.uleb128 0x3
+	.byte	0x75
+	.sleb128 96
+	.byte	0x4
+	.uleb128 .LVL335-.LVL333
+	.uleb128 .LVL342-.LVL333
+	.uleb128 0x1
+	.byte	0x5f
+	.byte	0
+.LVUS29:
+	.uleb128 .LVU881
+	.uleb128 .LVU899
+	.uleb128 .LVU899
+	.uleb128 .LVU922
+.LLST29:
+	.byte	0x6
+	.quad	.LVL333
+	.byte	0x4
+	.uleb128 .LVL333-.LVL333
+	.uleb128 .LVL335-.LVL333
+	.uleb128 0x3
+	.byte	0x75
+	.sleb128 100
+	.byte	0x4
+	.uleb128 .LVL335-.LVL333
+	.uleb128 .LVL342-.LVL333
+	.uleb128 0x1
+	.byte	0x58
+	.byte	0
+.LVUS31:
+	.uleb128 .LVU883
+	.uleb128 .LVU887
+.LLST31:
+	.byte	0x8
+	.quad	.LVL333
+	.uleb128 .LVL333-.LVL333
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0
+.LVUS32:
+	.uleb128 .LVU886
+	.uleb128 .LVU887
+.LLST32:
+	.byte	0x8
+	.quad	.LVL333
+	.uleb128 .LVL333-.LVL333
+	.uleb128 0x1
+	.byte	0x65
+	.byte	0
+.LVUS34:
+	.uleb128 .LVU890
+	.uleb128 .LVU894
+.LLST34:
+	.byte	0x8
+	.quad	.LVL334
+	.uleb128 .LVL334-.LVL334
+	.uleb128 0x3
+	.byte	0x75
+	.sleb128 16
+	.byte	0x9f
+	.byte	0
+.LVUS35:
+	.uleb128 .LVU893
+	.uleb128 .LVU894
+.LLST35:
+	.byte	0x8
+	.quad	.LVL334
+	.uleb128 .LVL334-.LVL334
+	.uleb128 0x1
+	.byte	0x64
+	.byte	0
+.LVUS37:
+	.uleb128 .LVU928
+	.uleb128 .LVU930
+.LLST37:
+	.byte	0x8
+	.quad	.LVL343
+	.uleb128 .LVL344-.LVL343
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -80
+	.byte	0
+.LVUS38:
+	.uleb128 .LVU928
+	.uleb128 .LVU930
+.LLST38:
+	.byte	0x8
+	.quad	.LVL343
+	.uleb128 .LVL344-.LVL343
+	.uleb128 0x3
+	.byte	0x76
+	.sleb128 16
+	.byte	0x9f
+	.byte	0
+.LVUS40:
+	.uleb128 .LVU924
+	.uleb128 .LVU926
+.LLST40:
+	.byte	0x8
+	.quad	.LVL342
+	.uleb128 .LVL343-.LVL342
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -96
+	.byte	0
+.LVUS41:
+	.uleb128 .LVU924
+	.uleb128 .LVU926
+.LLST41:
+	.byte	0x8
+	.quad	.LVL342
+	.uleb128 .LVL343-.LVL342
+	.uleb128 0x1
+	.byte	0x56
+	.byte	0
+.LVUS12:
+	.uleb128 0
+	.uleb128 .LVU853
+	.uleb128 .LVU853
+	.uleb128 0
+.LLST12:
+	.byte	0x6
+	.quad	.LVL323
+	.byte	0x4
+	.uleb128 .LVL323-.LVL323
+	.uleb128 .LVL325-.LVL323
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL325-.LVL323
+	.uleb128 .LFE20-.LVL323
+	.uleb128 0x1
+	.byte	0x58
+	.byte	0
+.LVUS13:
+	.uleb128 0
+	.uleb128 .LVU864
+	.uleb128 .LVU864
+	.uleb128 0
+.LLST13:
+	.byte	0x6
+	.quad	.LVL323
+	.byte	0x4
+	.uleb128 .LVL323-.LVL323
+	.uleb128 .LVL328-1-.LVL323
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x4
+	.uleb128 .LVL328-1-.LVL323
+	.uleb128 .LFE20-.LVL323
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x9f
+	.byte	0
+.LVUS14:
+	.uleb128 .LVU863
+	.uleb128 .LVU864
+.LLST14:
+	.byte	0x8
+	.quad	.LVL327
+	.uleb128 .LVL328-1-.LVL327
+	.uleb128 0x3
+	.byte	0x78
+	.sleb128 96
+	.byte	0
+.LVUS16:
+	.uleb128 .LVU843
+	.uleb128 .LVU851
+.LLST16:
+	.byte	0x8
+	.quad	.LVL323
+	.uleb128 .LVL324-.LVL323
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0
+.LVUS17:
+	.uleb128 .LVU850
+	.uleb128 .LVU851
+.LLST17:
+	.byte	0x8
+	.quad	.LVL324
+	.uleb128 .LVL324-.LVL324
+	.uleb128 0x1
+	.byte	0x61
+	.byte	0
+.LVUS19:
+	.uleb128 .LVU865
+	.uleb128 .LVU867
+.LLST19:
+	.byte	0x8
+	.quad	.LVL328
+	.uleb128 .LVL329-.LVL328
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -48
+	.byte	0
+.LVUS20:
+	.uleb128 .LVU865
+	.uleb128 .LVU867
+.LLST20:
+	.byte	0x8
+	.quad	.LVL328
+	.uleb128 .LVL329-.LVL328
+	.uleb128 0x1
+	.byte	0x58
+	.byte	0
+.LVUS22:
+	.uleb128 .LVU869
+	.uleb128 .LVU871
+.LLST22:
+	.byte	0x8
+	.quad	.LVL329
+	.uleb128 .LVL330-.LVL329
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -32
+	.byte	0
+.LVUS23:
+	.uleb128 .LVU869
+	.uleb128 .LVU871
+.LLST23:
+	.byte	0x8
+	.quad	.LVL329
+	.uleb128 .LVL330-.LVL329
+	.uleb128 0x3
+	.byte	0x78
+	.sleb128 16
+	.byte	0x9f
+	.byte	0
+.LVUS0:
+	.uleb128 0
+	.uleb128 .LVU21
+	.uleb128 .LVU33
+	.uleb128 .LVU44
+	.uleb128 .LVU44
+	.uleb128 .LVU63
+	.uleb128 .LVU65
+	.uleb128 .LVU76
+	.uleb128 .LVU78
+	.uleb128 .LVU106
+	.uleb128 .LVU106
+	.uleb128 .LVU123
+	.uleb128 .LVU123
+	.uleb128 .LVU144
+	.uleb128 .LVU144
+	.uleb128 .LVU155
+	.uleb128 .LVU155
+	.uleb128 .LVU186
+	.uleb128 .LVU186
+	.uleb128 .LVU188
+	.uleb128 .LVU188
+	.uleb128 .LVU201
+	.uleb128 .LVU201
+	.uleb128 .LVU203
+	.uleb128 .LVU203
+	.uleb128 .LVU224
+	.uleb128 .LVU224
+	.uleb128 .LVU235
+	.uleb128 .LVU238
+	.uleb128 .LVU264
+	.uleb128 .LVU266
+	.uleb128 .LVU277
+	.uleb128 .LVU278
+	.uleb128 .LVU301
+	.uleb128 .LVU303
+	.uleb128 .LVU315
+	.uleb128 .LVU317
+	.uleb128 .LVU345
+	.uleb128 .LVU347
+	.uleb128 .LVU359
+	.uleb128 .LVU360
+	.uleb128 .LVU380
+	.uleb128 .LVU382
+	.uleb128 .LVU395
+	.uleb128 .LVU398
+	.uleb128 .LVU425
+	.uleb128 .LVU426
+	.uleb128 .LVU438
+	.uleb128 .LVU440
+	.uleb128 .LVU461
+	.uleb128 .LVU463
+	.uleb128 .LVU475
+	.uleb128 .LVU478
+	.uleb128 .LVU505
+	.uleb128 .LVU506
+	.uleb128 .LVU518
+	.uleb128 .LVU520
+	.uleb128 .LVU540
+	.uleb128 .LVU542
+	.uleb128 .LVU552
+	.uleb128 .LVU555
+	.uleb128 .LVU583
+	.uleb128 .LVU587
+	.uleb128 .LVU600
+	.uleb128 .LVU602
+	.uleb128 .LVU622
+	.uleb128 .LVU623
+	.uleb128 .LVU635
+	.uleb128 .LVU636
+	.uleb128 .LVU664
+	.uleb128 .LVU666
+	.uleb128 .LVU681
+	.uleb128 .LVU681
+	.uleb128 .LVU705
+	.uleb128 .LVU705
+	.uleb128 .LVU737
+	.uleb128 .LVU737
+	.uleb128 .LVU763
+	.uleb128 .LVU763
+	.uleb128 .LVU766
+	.uleb128 .LVU777
+	.uleb128 .LVU796
+	.uleb128 .LVU797
+	.uleb128 .LVU808
+	.uleb128 .LVU808
+	.uleb128 .LVU812
+.LLST0:
+	.byte	0x6
+	.quad	.LVL0
+	.byte	0x4
+	.uleb128 .LVL0-.LVL0
+	.uleb128 .LVL2-.LVL0
+	.uleb128 0x1
+	.byte	0x61
+	.byte	0x4
+	.uleb128 .LVL5-.LVL0
+	.uleb128 .LVL10-.LVL0
+	.uleb128 0x1
+	.byte	0x61
+	.byte	0x4
+	.uleb128 .LVL10-.LVL0
+	.uleb128 .LVL19-.LVL0
+	.uleb128 0x2
+	.byte	0x90
+	.uleb128 0x20
+	.byte	0x4
+	.uleb128 .LVL20-.LVL0
+	.uleb128 .LVL25-.LVL0
+	.uleb128 0x2
+	.byte	0x90
+	.uleb128 0x20
+	.byte	0x4
+	.uleb128 .LVL26-.LVL0
+	.uleb128 .LVL35-.LVL0
+	.uleb128 0x2
+	.byte	0x90
+	.uleb128 0x20
+	.byte	0x4
+	.uleb128 .LVL35-.LVL0
+	.uleb128 .LVL41-.LVL0
+	.uleb128 0x1
+	.byte	0x63
+	.byte	0x4
+	.uleb128 .LVL41-.LVL0
+	.uleb128 .LVL50-.LVL0
+	.uleb128 0x2
+	.byte	0x90
+	.uleb128 0x20
+	.byte	0x4
+	.uleb128 .LVL50-.LVL0
+	.uleb128 .LVL55-.LVL0
+	.uleb128 0x1
+	.byte	0x63
+	.byte	0x4
+	.uleb128 .LVL55-.LVL0
+	.uleb128 .LVL64-.LVL0
+	.uleb128 0x2
+	.byte	0x90
+	.uleb128 0x20
+	.byte	0x4
+	.uleb128 .LVL64-.LVL0
+	.uleb128 .LVL65-.LVL0
+	.uleb128 0x1
+	.byte	0x63
+	.byte	0x4
+	.uleb128 .LVL65-.LVL0
+	.uleb128 .LVL71-.LVL0
+	.uleb128 0x2
+	.byte	0x90
+	.uleb128 0x20
+	.byte	0x4
+	.uleb128 .LVL71-.LVL0
+	.uleb128 .LVL72-.LVL0
+	.uleb128 0x1
+	.byte	0x63
+	.byte	0x4
+	.uleb128 .LVL72-.LVL0
+	.uleb128 .LVL80-.LVL0
+	.uleb128 0x2
+	.byte	0x90
+	.uleb128 0x20
+	.byte	0x4
+	.uleb128 .LVL80-.LVL0
+	.uleb128 .LVL85-.LVL0
+	.uleb128 0x1
+	.byte	0x63
+	.byte	0x4
+	.uleb128 .LVL86-.LVL0
+	.uleb128 .LVL95-.LVL0
+	.uleb128 0x1
+	.byte	0x63
+	.byte	0x4
+	.uleb128 .LVL96-.LVL0
+	.uleb128 .LVL101-.LVL0
+	.uleb128 0x1
+	.byte	0x63
+	.byte	0x4
+	.uleb128 .LVL102-.LVL0
+	.uleb128 .LVL111-.LVL0
+	.uleb128 0x1
+	.byte	0x63
+	.byte	0x4
+	.uleb128 .LVL112-.LVL0
+	.uleb128 .LVL118-.LVL0
+	.uleb128 0x1
+	.byte	0x63
+	.byte	0x4
+	.uleb128 .LVL119-.LVL0
+	.uleb128 .LVL128-.LVL0
+	.uleb128 0x1
+	.byte	0x63
+	.byte	0x4
+	.uleb128 .LVL129-.LVL0
+	.uleb128 .LVL134-.LVL0
+	.uleb128 0x1
+	.byte	0x63
+	.byte	0x4
+	.uleb128 .LVL135-.LVL0
+	.uleb128 .LVL144-.LVL0
+	.uleb128 0x1
+	.byte	0x63
+	.byte	0x4
+	.uleb128 .LVL145-.LVL0
+	.uleb128 .LVL150-.LVL0
+	.uleb128 0x1
+	.byte	0x63
+	.byte	0x4
+	.uleb128 .LVL151-.LVL0
+	.uleb128 .LVL160-.LVL0
+	.uleb128 0x1
+	.byte	0x63
+	.byte	0x4
+	.uleb128 .LVL161-.LVL0
+	.uleb128 .LVL166-.LVL0
+	.uleb128 0x1
+	.byte	0x63
+	.byte	0x4
+	.uleb128 .LVL167-.LVL0
+	.uleb128 .LVL176-.LVL0
+	.uleb128 0x1
+	.byte	0x63
+	.byte	0x4
+	.uleb128 .LVL177-.LVL0
+	.uleb128 .LVL182-.LVL0
+	.uleb128 0x1
+	.byte	0x63
+	.byte	0x4
+	.uleb128 .LVL183-.LVL0
+	.uleb128 .LVL192-.LVL0
+	.uleb128 0x1
+	.byte	0x63
+	.byte	0x4
+	.uleb128 .LVL193-.LVL0
+	.uleb128 .LVL198-.LVL0
+	.uleb128 0x1
+	.byte	0x63
+	.byte	0x4
+	.uleb128 .LVL199-.LVL0
+	.uleb128 .LVL208-.LVL0
+	.uleb128 0x1
+	.byte	0x63
+	.byte	0x4
+	.uleb128 .LVL209-.LVL0
+	.uleb128 .LVL214-.LVL0
+	.uleb128 0x1
+	.byte	0x63
+	.byte	0x4
+	.uleb128 .LVL215-.LVL0
+	.uleb128 .LVL224-.LVL0
+	.uleb128 0x1
+	.byte	0x63
+	.byte	0x4
+	.uleb128 .LVL226-.LVL0
+	.uleb128 .LVL232-.LVL0
+	.uleb128 0x1
+	.byte	0x63
+	.byte	0x4
+	.uleb128 .LVL233-.LVL0
+	.uleb128 .LVL242-.LVL0
+	.uleb128 0x1
+	.byte	0x63
+	.byte	0x4
+	.uleb128 .LVL243-.LVL0
+	.uleb128 .LVL248-.LVL0
+	.uleb128 0x1
+	.byte	0x63
+	.byte	0x4
+	.uleb128 .LVL249-.LVL0
+	.uleb128 .LVL258-.LVL0
+	.uleb128 0x1
+	.byte	0x63
+	.byte	0x4
+	.uleb128 .LVL259-.LVL0
+	.uleb128 .LVL265-.LVL0
+	.uleb128 0x1
+	.byte	0x63
+	.byte	0x4
+	.uleb128 .LVL265-.LVL0
+	.uleb128 .LVL272-.LVL0
+	.uleb128 0x1
+	.byte	0x6e
+	.byte	0x4
+	.uleb128 .LVL272-.LVL0
+	.uleb128 .LVL282-.LVL0
+	.uleb128 0x1
+	.byte	0x6d
+	.byte	0x4
+	.uleb128 .LVL282-.LVL0
+	.uleb128 .LVL291-.LVL0
+	.uleb128 0x1
+	.byte	0x6b
+	.byte	0x4
+	.uleb128 .LVL291-.LVL0
+	.uleb128 .LVL292-.LVL0
+	.uleb128 0x1
+	.byte	0x66
+	.byte	0x4
+	.uleb128 .LVL298-.LVL0
+	.uleb128 .LVL307-.LVL0
+	.uleb128 0x1
+	.byte	0x64
+	.byte	0x4
+	.uleb128 .LVL308-.LVL0
+	.uleb128 .LVL313-.LVL0
+	.uleb128 0x1
+	.byte	0x64
+	.byte	0x4
+	.uleb128 .LVL313-.LVL0
+	.uleb128 .LVL315-.LVL0
+	.uleb128 0x1
+	.byte	0x63
+	.byte	0
+.LVUS1:
+	.uleb128 0
+	.uleb128 .LVU39
+	.uleb128 .LVU40
+	.uleb128 .LVU52
+	.uleb128 .LVU54
+	.uleb128 .LVU57
+	.uleb128 .LVU57
+	.uleb128 .LVU72
+	.uleb128 .LVU73
+	.uleb128 .LVU86
+	.uleb128 .LVU88
+	.uleb128 .LVU118
+	.uleb128 .LVU119
+	.uleb128 .LVU131
+	.uleb128 .LVU133
+	.uleb128 .LVU151
+	.uleb128 .LVU152
+	.uleb128 .LVU163
+	.uleb128 .LVU165
+	.uleb128 .LVU193
+	.uleb128 .LVU194
+	.uleb128 .LVU209
+	.uleb128 .LVU211
+	.uleb128 .LVU232
+	.uleb128 .LVU233
+	.uleb128 .LVU246
+	.uleb128 .LVU248
+	.uleb128 .LVU273
+	.uleb128 .LVU274
+	.uleb128 .LVU288
+	.uleb128 .LVU290
+	.uleb128 .LVU311
+	.uleb128 .LVU312
+	.uleb128 .LVU325
+	.uleb128 .LVU327
+	.uleb128 .LVU355
+	.uleb128 .LVU356
+	.uleb128 .LVU368
+	.uleb128 .LVU370
+	.uleb128 .LVU390
+	.uleb128 .LVU391
+	.uleb128 .LVU406
+	.uleb128 .LVU408
+	.uleb128 .LVU433
+	.uleb128 .LVU434
+	.uleb128 .LVU450
+	.uleb128 .LVU452
+	.uleb128 .LVU472
+	.uleb128 .LVU473
+	.uleb128 .LVU486
+	.uleb128 .LVU488
+	.uleb128 .LVU513
+	.uleb128 .LVU514
+	.uleb128 .LVU529
+	.uleb128 .LVU531
+	.uleb128 .LVU549
+	.uleb128 .LVU550
+	.uleb128 .LVU563
+	.uleb128 .LVU565
+	.uleb128 .LVU597
+	.uleb128 .LVU598
+	.uleb128 .LVU611
+	.uleb128 .LVU613
+	.uleb128 .LVU630
+	.uleb128 .LVU631
+	.uleb128 .LVU644
+	.uleb128 .LVU646
+	.uleb128 .LVU674
+	.uleb128 .LVU675
+	.uleb128 .LVU688
+	.uleb128 .LVU689
+	.uleb128 .LVU693
+	.uleb128 .LVU693
+	.uleb128 .LVU707
+	.uleb128 .LVU707
+	.uleb128 .LVU727
+	.uleb128 .LVU735
+	.uleb128 .LVU746
+	.uleb128 .LVU748
+	.uleb128 .LVU774
+	.uleb128 .LVU775
+	.uleb128 .LVU785
+	.uleb128 .LVU787
+	.uleb128 .LVU804
+	.uleb128 .LVU805
+	.uleb128 .LVU821
+	.uleb128 .LVU828
+	.uleb128 .LVU830
+.LLST1:
+	.byte	0x6
+	.quad	.LVL0
+	.byte	0x4
+	.uleb128 .LVL0-.LVL0
+	.uleb128 .LVL8-.LVL0
+	.uleb128 0x1
+	.byte	0x62
+	.byte	0x4
+	.uleb128 .LVL9-.LVL0
+	.uleb128 .LVL15-.LVL0
+	.uleb128 0x1
+	.byte	0x62
+	.byte	0x4
+	.uleb128 .LVL17-.LVL0
+	.uleb128 .LVL18-.LVL0
+	.uleb128 0x1
+	.byte	0x62
+	.byte	0x4
+	.uleb128 .LVL18-.LVL0
+	.uleb128 .LVL23-.LVL0
+	.uleb128 0x1
+	.byte	0x61
+	.byte	0x4
+	.uleb128 .LVL24-.LVL0
+	.uleb128 .LVL31-.LVL0
+	.uleb128 0x1
+	.byte	0x61
+	.byte	0x4
+	.uleb128 .LVL33-.LVL0
+	.uleb128 .LVL39-.LVL0
+	.uleb128 0x1
+	.byte	0x61
+	.byte	0x4
+	.uleb128 .LVL40-.LVL0
+	.uleb128 .LVL46-.LVL0
+	.uleb128 0x1
+	.byte	0x61
+	.byte	0x4
+	.uleb128 .LVL48-.LVL0
+	.uleb128 .LVL53-.LVL0
+	.uleb128 0x1
+	.byte	0x61
+	.byte	0x4
+	.uleb128 .LVL54-.LVL0
+	.uleb128 .LVL60-.LVL0
+	.uleb128 0x1
+	.byte	0x61
+	.byte	0x4
+	.uleb128 .LVL62-.LVL0
+	.uleb128 .LVL68-.LVL0
+	.uleb128 0x1
+	.byte	0x61
+	.byte	0x4
+	.uleb128 .LVL69-.LVL0
+	.uleb128 .LVL76-.LVL0
+	.uleb128 0x1
+	.byte	0x61
+	.byte	0x4
+	.uleb128 .LVL78-.LVL0
+	.uleb128 .LVL83-.LVL0
+	.uleb128 0x1
+	.byte	0x61
+	.byte	0x4
+	.uleb128 .LVL84-.LVL0
+	.uleb128 .LVL91-.LVL0
+	.uleb128 0x1
+	.byte	0x61
+	.byte	0x4
+	.uleb128 .LVL93-.LVL0
+	.uleb128 .LVL99-.LVL0
+	.uleb128 0x1
+	.byte	0x61
+	.byte	0x4
+	.uleb128 .LVL100-.LVL0
+	.uleb128 .LVL107-.LVL0
+	.uleb128 0x1
+	.byte	0x61
+	.byte	0x4
+	.uleb128 .LVL109-.LVL0
+	.uleb128 .LVL116-.LVL0
+	.uleb128 0x1
+	.byte	0x61
+	.byte	0x4
+	.uleb128 .LVL117-.LVL0
+	.uleb128 .LVL124-.LVL0
+	.uleb128 0x1
+	.byte	0x61
+	.byte	0x4
+	.uleb128 .LVL126-.LVL0
+	.uleb128 .LVL132-.LVL0
+	.uleb128 0x1
+	.byte	0x61
+	.byte	0x4
+	.uleb128 .LVL133-.LVL0
+	.uleb128 .LVL140-.LVL0
+	.uleb128 0x1
+	.byte	0x61
+	.byte	0x4
+	.uleb128 .LVL142-.LVL0
+	.uleb128 .LVL148-.LVL0
+	.uleb128 0x1
+	.byte	0x61
+	.byte	0x4
+	.uleb128 .LVL149-.LVL0
+	.uleb128 .LVL156-.LVL0
+	.uleb128 0x1
+	.byte	0x61
+	.byte	0x4
+	.uleb128 .LVL158-.LVL0
+	.uleb128 .LVL164-.LVL0
+	.uleb128 0x1
+	.byte	0x61
+	.byte	0x4
+	.uleb128 .LVL165-.LVL0
+	.uleb128 .LVL172-.LVL0
+	.uleb128 0x1
+	.byte	0x61
+	.byte	0x4
+	.uleb128 .LVL174-.LVL0
+	.uleb128 .LVL180-.LVL0
+	.uleb128 0x1
+	.byte	0x61
+	.byte	0x4
+	.uleb128 .LVL181-.LVL0
+	.uleb128 .LVL188-.LVL0
+	.uleb128 0x1
+	.byte	0x61
+	.byte	0x4
+	.uleb128 .LVL190-.LVL0
+	.uleb128 .LVL196-.LVL0
+	.uleb128 0x1
+	.byte	0x61
+	.byte	0x4
+	.uleb128 .LVL197-.LVL0
+	.uleb128 .LVL204-.LVL0
+	.uleb128 0x1
+	.byte	0x61
+	.byte	0x4
+	.uleb128 .LVL206-.LVL0
+	.uleb128 .LVL212-.LVL0
+	.uleb128 0x1
+	.byte	0x61
+	.byte	0x4
+	.uleb128 .LVL213-.LVL0
+	.uleb128 .LVL220-.LVL0
+	.uleb128 0x1
+	.byte	0x61
+	.byte	0x4
+	.uleb128 .LVL222-.LVL0
+	.uleb128 .LVL230-.LVL0
+	.uleb128 0x1
+	.byte	0x61
+	.byte	0x4
+	.uleb128 .LVL231-.LVL0
+	.uleb128 .LVL238-.LVL0
+	.uleb128 0x1
+	.byte	0x61
+	.byte	0x4
+	.uleb128 .LVL240-.LVL0
+	.uleb128 .LVL246-.LVL0
+	.uleb128 0x1
+	.byte	0x61
+	.byte	0x4
+	.uleb128 .LVL247-.LVL0
+	.uleb128 .LVL254-.LVL0
+	.uleb128 0x1
+	.byte	0x61
+	.byte	0x4
+	.uleb128 .LVL256-.LVL0
+	.uleb128 .LVL262-.LVL0
+	.uleb128 0x1
+	.byte	0x61
+	.byte	0x4
+	.uleb128 .LVL263-.LVL0
+	.uleb128 .LVL269-.LVL0
+	.uleb128 0x1
+	.byte	0x61
+	.byte	0x4
+	.uleb128 .LVL270-.LVL0
+	.uleb128 .LVL271-.LVL0
+	.uleb128 0x1
+	.byte	0x61
+	.byte	0x4
+	.uleb128 .LVL271-.LVL0
+	.uleb128 .LVL273-.LVL0
+	.uleb128 0x1
+	.byte	0x6b
+	.byte	0x4
+	.uleb128 .LVL273-.LVL0
+	.uleb128 .LVL280-.LVL0
+	.uleb128 0x1
+	.byte	0x62
+	.byte	0x4
+	.uleb128 .LVL281-.LVL0
+	.uleb128 .LVL287-.LVL0
+	.uleb128 0x1
+	.byte	0x62
+	.byte	0x4
+	.uleb128 .LVL289-.LVL0
+	.uleb128 .LVL296-.LVL0
+	.uleb128 0x1
+	.byte	0x62
+	.byte	0x4
+	.uleb128 .LVL297-.LVL0
+	.uleb128 .LVL303-.LVL0
+	.uleb128 0x1
+	.byte	0x62
+	.byte	0x4
+	.uleb128 .LVL305-.LVL0
+	.uleb128 .LVL311-.LVL0
+	.uleb128 0x1
+	.byte	0x62
+	.byte	0x4
+	.uleb128 .LVL312-.LVL0
+	.uleb128 .LVL320-.LVL0
+	.uleb128 0x1
+	.byte	0x62
+	.byte	0x4
+	.uleb128 .LVL322-.LVL0
+	.uleb128 .LVL322-.LVL0
+	.uleb128 0x1
+	.byte	0x62
+	.byte	0
+.LVUS2:
+	.uleb128 0
+	.uleb128 .LVU30
+	.uleb128 .LVU35
+	.uleb128 .LVU46
+	.uleb128 .LVU48
+	.uleb128 .LVU59
+	.uleb128 .LVU68
+	.uleb128 .LVU80
+	.uleb128 .LVU81
+	.uleb128 .LVU85
+	.uleb128 .LVU113
+	.uleb128 .LVU125
+	.uleb128 .LVU126
+	.uleb128 .LVU130
+	.uleb128 .LVU147
+	.uleb128 .LVU157
+	.uleb128 .LVU158
+	.uleb128 .LVU162
+	.uleb128 .LVU189
+	.uleb128 .LVU200
+	.uleb128 .LVU204
+	.uleb128 .LVU208
+	.uleb128 .LVU228
+	.uleb128 .LVU240
+	.uleb128 .LVU241
+	.uleb128 .LVU245
+	.uleb128 .LVU269
+	.uleb128 .LVU281
+	.uleb128 .LVU283
+	.uleb128 .LVU287
+	.uleb128 .LVU307
+	.uleb128 .LVU319
+	.uleb128 .LVU320
+	.uleb128 .LVU324
+	.uleb128 .LVU351
+	.uleb128 .LVU362
+	.uleb128 .LVU363
+	.uleb128 .LVU367
+	.uleb128 .LVU386
+	.uleb128 .LVU400
+	.uleb128 .LVU401
+	.uleb128 .LVU405
+	.uleb128 .LVU429
+	.uleb128 .LVU444
+	.uleb128 .LVU445
+	.uleb128 .LVU449
+	.uleb128 .LVU468
+	.uleb128 .LVU480
+	.uleb128 .LVU481
+	.uleb128 .LVU485
+	.uleb128 .LVU509
+	.uleb128 .LVU523
+	.uleb128 .LVU524
+	.uleb128 .LVU528
+	.uleb128 .LVU545
+	.uleb128 .LVU557
+	.uleb128 .LVU558
+	.uleb128 .LVU562
+	.uleb128 .LVU593
+	.uleb128 .LVU605
+	.uleb128 .LVU606
+	.uleb128 .LVU610
+	.uleb128 .LVU626
+	.uleb128 .LVU638
+	.uleb128 .LVU639
+	.uleb128 .LVU643
+	.uleb128 .LVU670
+	.uleb128 .LVU683
+	.uleb128 .LVU684
+	.uleb128 .LVU695
+	.uleb128 .LVU716
+	.uleb128 .LVU739
+	.uleb128 .LVU741
+	.uleb128 .LVU745
+	.uleb128 .LVU770
+	.uleb128 .LVU779
+	.uleb128 .LVU780
+	.uleb128 .LVU784
+	.uleb128 .LVU800
+	.uleb128 .LVU810
+	.uleb128 .LVU814
+	.uleb128 .LVU818
+.LLST2:
+	.byte	0x6
+	.quad	.LVL0
+	.byte	0x4
+	.uleb128 .LVL0-.LVL0
+	.uleb128 .LVL4-.LVL0
+	.uleb128 0x1
+	.byte	0x63
+	.byte	0x4
+	.uleb128 .LVL6-.LVL0
+	.uleb128 .LVL11-.LVL0
+	.uleb128 0x1
+	.byte	0x63
+	.byte	0x4
+	.uleb128 .LVL13-.LVL0
+	.uleb128 .LVL18-.LVL0
+	.uleb128 0x1
+	.byte	0x63
+	.byte	0x4
+	.uleb128 .LVL21-.LVL0
+	.uleb128 .LVL27-.LVL0
+	.uleb128 0x1
+	.byte	0x62
+	.byte	0x4
+	.uleb128 .LVL28-.LVL0
+	.uleb128 .LVL30-.LVL0
+	.uleb128 0x1
+	.byte	0x62
+	.byte	0x4
+	.uleb128 .LVL36-.LVL0
+	.uleb128 .LVL42-.LVL0
+	.uleb128 0x1
+	.byte	0x62
+	.byte	0x4
+	.uleb128 .LVL43-.LVL0
+	.uleb128 .LVL45-.LVL0
+	.uleb128 0x1
+	.byte	0x62
+	.byte	0x4
+	.uleb128 .LVL51-.LVL0
+	.uleb128 .LVL56-.LVL0
+	.uleb128 0x1
+	.byte	0x62
+	.byte	0x4
+	.uleb128 .LVL57-.LVL0
+	.uleb128 .LVL59-.LVL0
+	.uleb128 0x1
+	.byte	0x62
+	.byte	0x4
+	.uleb128 .LVL66-.LVL0
+	.uleb128 .LVL70-.LVL0
+	.uleb128 0x1
+	.byte	0x62
+	.byte	0x4
+	.uleb128 .LVL73-.LVL0
+	.uleb128 .LVL75-.LVL0
+	.uleb128 0x1
+	.byte	0x62
+	.byte	0x4
+	.uleb128 .LVL81-.LVL0
+	.uleb128 .LVL87-.LVL0
+	.uleb128 0x1
+	.byte	0x62
+	.byte	0x4
+	.uleb128 .LVL88-.LVL0
+	.uleb128 .LVL90-.LVL0
+	.uleb128 0x1
+	.byte	0x62
+	.byte	0x4
+	.uleb128 .LVL97-.LVL0
+	.uleb128 .LVL103-.LVL0
+	.uleb128 0x1
+	.byte	0x62
+	.byte	0x4
+	.uleb128 .LVL104-.LVL0
+	.uleb128 .LVL106-.LVL0
+	.uleb128 0x1
+	.byte	0x62
+	.byte	0x4
+	.uleb128 .LVL114-.LVL0
+	.uleb128 .LVL120-.LVL0
+	.uleb128 0x1
+	.byte	0x62
+	.byte	0x4
+	.uleb128 .LVL121-.LVL0
+	.uleb128 .LVL123-.LVL0
+	.uleb128 0x1
+	.byte	0x62
+	.byte	0x4
+	.uleb128 .LVL130-.LVL0
+	.uleb128 .LVL136-.LVL0
+	.uleb128 0x1
+	.byte	0x62
+	.byte	0x4
+	.uleb128 .LVL137-.LVL0
+	.uleb128 .LVL139-.LVL0
+	.uleb128 0x1
+	.byte	0x62
+	.byte	0x4
+	.uleb128 .LVL146-.LVL0
+	.uleb128 .LVL152-.LVL0
+	.uleb128 0x1
+	.byte	0x62
+	.byte	0x4
+	.uleb128 .LVL153-.LVL0
+	.uleb128 .LVL155-.LVL0
+	.uleb128 0x1
+	.byte	0x62
+	.byte	0x4
+	.uleb128 .LVL162-.LVL0
+	.uleb128 .LVL168-.LVL0
+	.uleb128 0x1
+	.byte	0x62
+	.byte	0x4
+	.uleb128 .LVL169-.LVL0
+	.uleb128 .LVL171-.LVL0
+	.uleb128 0x1
+	.byte	0x62
+	.byte	0x4
+	.uleb128 .LVL178-.LVL0
+	.uleb128 .LVL184-.LVL0
+	.uleb128 0x1
+	.byte	0x62
+	.byte	0x4
+	.uleb128 .LVL185-.LVL0
+	.uleb128 .LVL187-.LVL0
+	.uleb128 0x1
+	.byte	0x62
+	.byte	0x4
+	.uleb128 .LVL194-.LVL0
+	.uleb128 .LVL200-.LVL0
+	.uleb128 0x1
+	.byte	0x62
+	.byte	0x4
+	.uleb128 .LVL201-.LVL0
+	.uleb128 .LVL203-.LVL0
+	.uleb128 0x1
+	.byte	0x62
+	.byte	0x4
+	.uleb128 .LVL210-.LVL0
+	.uleb128 .LVL216-.LVL0
+	.uleb128 0x1
+	.byte	0x62
+	.byte	0x4
+	.uleb128 .LVL217-.LVL0
+	.uleb128 .LVL219-.LVL0
+	.uleb128 0x1
+	.byte	0x62
+	.byte	0x4
+	.uleb128 .LVL228-.LVL0
+	.uleb128 .LVL234-.LVL0
+	.uleb128 0x1
+	.byte	0x62
+	.byte	0x4
+	.uleb128 .LVL235-.LVL0
+	.uleb128 .LVL237-.LVL0
+	.uleb128 0x1
+	.byte	0x62
+	.byte	0x4
+	.uleb128 .LVL244-.LVL0
+	.uleb128 .LVL250-.LVL0
+	.uleb128 0x1
+	.byte	0x62
+	.byte	0x4
+	.uleb128 .LVL251-.LVL0
+	.uleb128 .LVL253-.LVL0
+	.uleb128 0x1
+	.byte	0x62
+	.byte	0x4
+	.uleb128 .LVL260-.LVL0
+	.uleb128 .LVL266-.LVL0
+	.uleb128 0x1
+	.byte	0x62
+	.byte	0x4
+	.uleb128 .LVL267-.LVL0
+	.uleb128 .LVL271-.LVL0
+	.uleb128 0x1
+	.byte	0x62
+	.byte	0x4
+	.uleb128 .LVL276-.LVL0
+	.uleb128 .LVL283-.LVL0
+	.uleb128 0x1
+	.byte	0x61
+	.byte	0x4
+	.uleb128 .LVL284-.LVL0
+	.uleb128 .LVL286-.LVL0
+	.uleb128 0x1
+	.byte	0x61
+	.byte	0x4
+	.uleb128 .LVL294-.LVL0
+	.uleb128 .LVL299-.LVL0
+	.uleb128 0x1
+	.byte	0x61
+	.byte	0x4
+	.uleb128 .LVL300-.LVL0
+	.uleb128 .LVL302-.LVL0
+	.uleb128 0x1
+	.byte	0x61
+	.byte	0x4
+	.uleb128 .LVL309-.LVL0
+	.uleb128 .LVL314-.LVL0
+	.uleb128 0x1
+	.byte	0x61
+	.byte	0x4
+	.uleb128 .LVL317-.LVL0
+	.uleb128 .LVL319-.LVL0
+	.uleb128 0x1
+	.byte	0x61
+	.byte	0
+.LVUS3:
+	.uleb128 0
+	.uleb128 .LVU305
+	.uleb128 .LVU305
+	.uleb128 0
+.LLST3:
+	.byte	0x6
+	.quad	.LVL0
+	.byte	0x4
+	.uleb128 .LVL0-.LVL0
+	.uleb128 .LVL113-.LVL0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL113-.LVL0
+	.uleb128 .LFE22-.LVL0
+	.uleb128 0x1
+	.byte	0x59
+	.byte	0
+.LVUS4:
+	.uleb128 0
+	.uleb128 .LVU115
+	.uleb128 .LVU115
+	.uleb128 0
+.LLST4:
+	.byte	0x6
+	.quad	.LVL0
+	.byte	0x4
+	.uleb128 .LVL0-.LVL0
+	.uleb128 .LVL37-.LVL0
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x4
+	.uleb128 .LVL37-.LVL0
+	.uleb128 .LFE22-.LVL0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x9f
+	.byte	0
+.LVUS5:
+	.uleb128 .LVU13
+	.uleb128 .LVU98
+	.uleb128 .LVU98
+	.uleb128 .LVU175
+	.uleb128 .LVU258
+	.uleb128 .LVU337
+	.uleb128 .LVU337
+	.uleb128 .LVU418
+	.uleb128 .LVU418
+	.uleb128 .LVU498
+	.uleb128 .LVU498
+	.uleb128 .LVU575
+	.uleb128 .LVU575
+	.uleb128 .LVU656
+.LLST5:
+	.byte	0x6
+	.quad	.LVL1
+	.byte	0x4
+	.uleb128 .LVL1-.LVL1
+	.uleb128 .LVL34-.LVL1
+	.uleb128 0xc
+	.byte	0x6c
+	.byte	0x93
+	.uleb128 0x4
+	.byte	0x64
+	.byte	0x93
+	.uleb128 0x4
+	.byte	0x67
+	.byte	0x93
+	.uleb128 0x4
+	.byte	0x65
+	.byte	0x93
+	.uleb128 0x4
+	.byte	0x4
+	.uleb128 .LVL34-.LVL1
+	.uleb128 .LVL63-.LVL1
+	.uleb128 0xe
+	.byte	0x91
+	.sleb128 -24
+	.byte	0x93
+	.uleb128 0x4
+	.byte	0x67
+	.byte	0x93
+	.uleb128 0x4
+	.byte	0x6b
+	.byte	0x93
+	.uleb128 0x4
+	.byte	0x91
+	.sleb128 -28
+	.byte	0x93
+	.uleb128 0x4
+	.byte	0x4
+	.uleb128 .LVL94-.LVL1
+	.uleb128 .LVL127-.LVL1
+	.uleb128 0x10
+	.byte	0x91
+	.sleb128 -52
+	.byte	0x93
+	.uleb128 0x4
+	.byte	0x91
+	.sleb128 -68
+	.byte	0x93
+	.uleb128 0x4
+	.byte	0x91
+	.sleb128 -28
+	.byte	0x93
+	.uleb128 0x4
+	.byte	0x66
+	.byte	0x93
+	.uleb128 0x4
+	.byte	0x4
+	.uleb128 .LVL127-.LVL1
+	.uleb128 .LVL159-.LVL1
+	.uleb128 0xe
+	.byte	0x6b
+	.byte	0x93
+	.uleb128 0x4
+	.byte	0x91
+	.sleb128 -60
+	.byte	0x93
+	.uleb128 0x4
+	.byte	0x64
+	.byte	0x93
+	.uleb128 0x4
+	.byte	0x91
+	.sleb128 -40
+	.byte	0x93
+	.uleb128 0x4
+	.byte	0x4
+	.uleb128 .LVL159-.LVL1
+	.uleb128 .LVL191-.LVL1
+	.uleb128 0xc
+	.byte	0x64
+	.byte	0x93
+	.uleb128 0x4
+	.byte	0x65
+	.byte	0x93
+	.uleb128 0x4
+	.byte	0x6c
+	.byte	0x93
+	.uleb128 0x4
+	.byte	0x6d
+	.byte	0x93
+	.uleb128 0x4
+	.byte	0x4
+	.uleb128 .LVL191-.LVL1
+	.uleb128 .LVL223-.LVL1
+	.uleb128 0xd
+	.byte	0x68
+	.byte	0x93
+	.uleb128 0x4
+	.byte	0x6a
+	.byte	0x93
+	.uleb128 0x4
+	.byte	0x91
+	.sleb128 -24
+	.byte	0x93
+	.uleb128 0x4
+	.byte	0x67
+	.byte	0x93
+	.uleb128 0x4
+	.byte	0x4
+	.uleb128 .LVL223-.LVL1
+	.uleb128 .LVL257-.LVL1
+	.uleb128 0x10
+	.byte	0x91
+	.sleb128 -28
+	.byte	0x93
+	.uleb128 0x4
+	.byte	0x91
+	.sleb128 -52
+	.byte	0x93
+	.uleb128 0x4
+	.byte	0x68
+	.byte	0x93
+	.uleb128 0x4
+	.byte	0x91
+	.sleb128 -68
+	.byte	0x93
+	.uleb128 0x4
+	.byte	0
+.LVUS6:
+	.uleb128 .LVU14
+	.uleb128 .LVU99
+	.uleb128 .LVU99
+	.uleb128 .LVU176
+	.uleb128 .LVU259
+	.uleb128 .LVU338
+	.uleb128 .LVU338
+	.uleb128 .LVU419
+	.uleb128 .LVU419
+	.uleb128 .LVU499
+	.uleb128 .LVU499
+	.uleb128 .LVU576
+	.uleb128 .LVU576
+	.uleb128 .LVU585
+	.uleb128 .LVU585
+	.uleb128 .LVU589
+	.uleb128 .LVU589
+	.uleb128 .LVU657
+	.uleb128 .LVU657
+	.uleb128 .LVU678
+	.uleb128 .LVU678
+	.uleb128 .LVU693
+	.uleb128 .LVU693
+	.uleb128 .LVU758
+.LLST6:
+	.byte	0x6
+	.quad	.LVL1
+	.byte	0x4
+	.uleb128 .LVL1-.LVL1
+	.uleb128 .LVL34-.LVL1
+	.uleb128 0x10
+	.byte	0x6a
+	.byte	0x93
+	.uleb128 0x4
+	.byte	0x91
+	.sleb128 -68
+	.byte	0x93
+	.uleb128 0x4
+	.byte	0x91
+	.sleb128 -60
+	.byte	0x93
+	.uleb128 0x4
+	.byte	0x91
+	.sleb128 -52
+	.byte	0x93
+	.uleb128 0x4
+	.byte	0x4
+	.uleb128 .LVL34-.LVL1
+	.uleb128 .LVL63-.LVL1
+	.uleb128 0xe
+	.byte	0x91
+	.sleb128 -40
+	.byte	0x93
+	.uleb128 0x4
+	.byte	0x6d
+	.byte	0x93
+	.uleb128 0x4
+	.byte	0x91
+	.sleb128 -20
+	.byte	0x93
+	.uleb128 0x4
+	.byte	0x65
+	.byte	0x93
+	.uleb128 0x4
+	.byte	0x4
+	.uleb128 .LVL94-.LVL1
+	.uleb128 .LVL127-.LVL1
+	.uleb128 0xd
+	.byte	0x6b
+	.byte	0x93
+	.uleb128 0x4
+	.byte	0x6a
+	.byte	0x93
+	.uleb128 0x4
+	.byte	0x68
+	.byte	0x93
+	.uleb128 0x4
+	.byte	0x91
+	.sleb128 -24
+	.byte	0x93
+	.uleb128 0x4
+	.byte	0x4
+	.uleb128 .LVL127-.LVL1
+	.uleb128 .LVL159-.LVL1
+	.uleb128 0xe
+	.byte	0x6c
+	.byte	0x93
+	.uleb128 0x4
+	.byte	0x91
+	.sleb128 -52
+	.byte	0x93
+	.uleb128 0x4
+	.byte	0x67
+	.byte	0x93
+	.uleb128 0x4
+	.byte	0x91
+	.sleb128 -20
+	.byte	0x93
+	.uleb128 0x4
+	.byte	0x4
+	.uleb128 .LVL159-.LVL1
+	.uleb128 .LVL191-.LVL1
+	.uleb128 0xf
+	.byte	0x68
+	.byte	0x93
+	.uleb128 0x4
+	.byte	0x91
+	.sleb128 -40
+	.byte	0x93
+	.uleb128 0x4
+	.byte	0x66
+	.byte	0x93
+	.uleb128 0x4
+	.byte	0x91
+	.sleb128 -68
+	.byte	0x93
+	.uleb128 0x4
+	.byte	0x4
+	.uleb128 .LVL191-.LVL1
+	.uleb128 .LVL223-.LVL1
+	.uleb128 0x10
+	.byte	0x91
+	.sleb128 -60
+	.byte	0x93
+	.uleb128 0x4
+	.byte	0x91
+	.sleb128 -20
+	.byte	0x93
+	.uleb128 0x4
+	.byte	0x91
+	.sleb128 -28
+	.byte	0x93
+	.uleb128 0x4
+	.byte	0x91
+	.sleb128 -40
+	.byte	0x93
+	.uleb128 0x4
+	.byte	0x4
+	.uleb128 .LVL223-.LVL1
+	.uleb128 .LVL225-.LVL1
+	.uleb128 0xd
+	.byte	0x66
+	.byte	0x93
+	.uleb128 0x4
+	.byte	0x91
+	.sleb128 -24
+	.byte	0x93
+	.uleb128 0x4
+	.byte	0x6a
+	.byte	0x93
+	.uleb128 0x4
+	.byte	0x6b
+	.byte	0x93
+	.uleb128 0x4
+	.byte	0x4
+	.uleb128 .LVL225-.LVL1
+	.uleb128 .LVL227-.LVL1
+	.uleb128 0xd
+	.byte	0x6e
+	.byte	0x93
+	.uleb128 0x4
+	.byte	0x91
+	.sleb128 -24
+	.byte	0x93
+	.uleb128 0x4
+	.byte	0x6a
+	.byte	0x93
+	.uleb128 0x4
+	.byte	0x6b
+	.byte	0x93
+	.uleb128 0x4
+	.byte	0x4
+	.uleb128 .LVL227-.LVL1
+	.uleb128 .LVL257-.LVL1
+	.uleb128 0xe
+	.byte	0x91
+	.sleb128 -36
+	.byte	0x93
+	.uleb128 0x4
+	.byte	0x91
+	.sleb128 -24
+	.byte	0x93
+	.uleb128 0x4
+	.byte	0x6a
+	.byte	0x93
+	.uleb128 0x4
+	.byte	0x6b
+	.byte	0x93
+	.uleb128 0x4
+	.byte	0x4
+	.uleb128 .LVL257-.LVL1
+	.uleb128 .LVL264-.LVL1
+	.uleb128 0xf
+	.byte	0x91
+	.sleb128 -20
+	.byte	0x93
+	.uleb128 0x4
+	.byte	0x6b
+	.byte	0x93
+	.uleb128 0x4
+	.byte	0x91
+	.sleb128 -68
+	.byte	0x93
+	.uleb128 0x4
+	.byte	0x6d
+	.byte	0x93
+	.uleb128 0x4
+	.byte	0x4
+	.uleb128 .LVL264-.LVL1
+	.uleb128 .LVL271-.LVL1
+	.uleb128 0x13
+	.byte	0x91
+	.sleb128 -20
+	.byte	0x93
+	.uleb128 0x4
+	.byte	0x6b
+	.byte	0x93
+	.uleb128 0x4
+	.byte	0x91
+	.sleb128 -68
+	.byte	0x93
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x23
+	.uleb128 0x20
+	.byte	0x93
+	.uleb128 0x4
+	.byte	0x4
+	.uleb128 .LVL271-.LVL1
+	.uleb128 .LVL290-.LVL1
+	.uleb128 0x14
+	.byte	0x91
+	.sleb128 -20
+	.byte	0x93
+	.uleb128 0x4
+	.byte	0x91
+	.sleb128 -44
+	.byte	0x93
+	.uleb128 0x4
+	.byte	0x91
+	.sleb128 -68
+	.byte	0x93
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x23
+	.uleb128 0x20
+	.byte	0x93
+	.uleb128 0x4
+	.byte	0
+.LVUS7:
+	.uleb128 .LVU26
+	.uleb128 .LVU100
+	.uleb128 .LVU100
+	.uleb128 .LVU177
+	.uleb128 .LVU260
+	.uleb128 .LVU339
+	.uleb128 .LVU339
+	.uleb128 .LVU420
+	.uleb128 .LVU420
+	.uleb128 .LVU500
+	.uleb128 .LVU500
+	.uleb128 .LVU577
+	.uleb128 .LVU577
+	.uleb128 .LVU658
+	.uleb128 .LVU658
+	.uleb128 .LVU721
+	.uleb128 .LVU721
+	.uleb128 .LVU759
+	.uleb128 .LVU759
+	.uleb128 0
+.LLST7:
+	.byte	0x6
+	.quad	.LVL3
+	.byte	0x4
+	.uleb128 .LVL3-.LVL3
+	.uleb128 .LVL34-.LVL3
+	.uleb128 0xe
+	.byte	0x6d
+	.byte	0x93
+	.uleb128 0x4
+	.byte	0x91
+	.sleb128 -40
+	.byte	0x93
+	.uleb128 0x4
+	.byte	0x68
+	.byte	0x93
+	.uleb128 0x4
+	.byte	0x91
+	.sleb128 -24
+	.byte	0x93
+	.uleb128 0x4
+	.byte	0x4
+	.uleb128 .LVL34-.LVL3
+	.uleb128 .LVL63-.LVL3
+	.uleb128 0xd
+	.byte	0x6a
+	.byte	0x93
+	.uleb128 0x4
+	.byte	0x6c
+	.byte	0x93
+	.uleb128 0x4
+	.byte	0x66
+	.byte	0x93
+	.uleb128 0x4
+	.byte	0x91
+	.sleb128 -60
+	.byte	0x93
+	.uleb128 0x4
+	.byte	0x4
+	.uleb128 .LVL94-.LVL3
+	.uleb128 .LVL127-.LVL3
+	.uleb128 0xe
+	.byte	0x64
+	.byte	0x93
+	.uleb128 0x4
+	.byte	0x91
+	.sleb128 -60
+	.byte	0x93
+	.uleb128 0x4
+	.byte	0x67
+	.byte	0x93
+	.uleb128 0x4
+	.byte	0x91
+	.sleb128 -20
+	.byte	0x93
+	.uleb128 0x4
+	.byte	0x4
+	.uleb128 .LVL127-.LVL3
+	.uleb128 .LVL159-.LVL3
+	.uleb128 0xf
+	.byte	0x91
+	.sleb128 -24
+	.byte	0x93
+	.uleb128 0x4
+	.byte	0x66
+	.byte	0x93
+	.uleb128 0x4
+	.byte	0x65
+	.byte	0x93
+	.uleb128 0x4
+	.byte	0x91
+	.sleb128 -68
+	.byte	0x93
+	.uleb128 0x4
+	.byte	0x4
+	.uleb128 .LVL159-.LVL3
+	.uleb128 .LVL191-.LVL3
+	.uleb128 0xe
+	.byte	0x67
+	.byte	0x93
+	.uleb128 0x4
+	.byte	0x91
+	.sleb128 -52
+	.byte	0x93
+	.uleb128 0x4
+	.byte	0x91
+	.sleb128 -20
+	.byte	0x93
+	.uleb128 0x4
+	.byte	0x6a
+	.byte	0x93
+	.uleb128 0x4
+	.byte	0x4
+	.uleb128 .LVL191-.LVL3
+	.uleb128 .LVL223-.LVL3
+	.uleb128 0xc
+	.byte	0x6c
+	.byte	0x93
+	.uleb128 0x4
+	.byte	0x65
+	.byte	0x93
+	.uleb128 0x4
+	.byte	0x6b
+	.byte	0x93
+	.uleb128 0x4
+	.byte	0x6d
+	.byte	0x93
+	.uleb128 0x4
+	.byte	0x4
+	.uleb128 .LVL223-.LVL3
+	.uleb128 .LVL257-.LVL3
+	.uleb128 0xe
+	.byte	0x91
+	.sleb128 -60
+	.byte	0x93
+	.uleb128 0x4
+	.byte	0x91
+	.sleb128 -20
+	.byte	0x93
+	.uleb128 0x4
+	.byte	0x6d
+	.byte	0x93
+	.uleb128 0x4
+	.byte	0x64
+	.byte	0x93
+	.uleb128 0x4
+	.byte	0x4
+	.uleb128 .LVL257-.LVL3
+	.uleb128 .LVL278-.LVL3
+	.uleb128 0xe
+	.byte	0x68
+	.byte	0x93
+	.uleb128 0x4
+	.byte	0x91
+	.sleb128 -28
+	.byte	0x93
+	.uleb128 0x4
+	.byte	0x6a
+	.byte	0x93
+	.uleb128 0x4
+	.byte	0x91
+	.sleb128 -40
+	.byte	0x93
+	.uleb128 0x4
+	.byte	0x4
+	.uleb128 .LVL278-.LVL3
+	.uleb128 .LVL290-.LVL3
+	.uleb128 0x10
+	.byte	0x68
+	.byte	0x93
+	.uleb128 0x4
+	.byte	0x91
+	.sleb128 -28
+	.byte	0x93
+	.uleb128 0x4
+	.byte	0x91
+	.sleb128 -76
+	.byte	0x93
+	.uleb128 0x4
+	.byte	0x91
+	.sleb128 -40
+	.byte	0x93
+	.uleb128 0x4
+	.byte	0x4
+	.uleb128 .LVL290-.LVL3
+	.uleb128 .LFE22-.LVL3
+	.uleb128 0x11
+	.byte	0x91
+	.sleb128 -20
+	.byte	0x93
+	.uleb128 0x4
+	.byte	0x91
+	.sleb128 -44
+	.byte	0x93
+	.uleb128 0x4
+	.byte	0x91
+	.sleb128 -68
+	.byte	0x93
+	.uleb128 0x4
+	.byte	0x91
+	.sleb128 -28
+	.byte	0x93
+	.uleb128 0x4
+	.byte	0
+.LVUS8:
+	.uleb128 .LVU31
+	.uleb128 .LVU101
+	.uleb128 .LVU101
+	.uleb128 .LVU178
+	.uleb128 .LVU261
+	.uleb128 .LVU340
+	.uleb128 .LVU340
+	.uleb128 .LVU421
+	.uleb128 .LVU421
+	.uleb128 .LVU501
+	.uleb128 .LVU501
+	.uleb128 .LVU578
+	.uleb128 .LVU578
+	.uleb128 .LVU659
+	.uleb128 .LVU659
+	.uleb128 .LVU713
+	.uleb128 .LVU713
+	.uleb128 .LVU714
+	.uleb128 .LVU714
+	.uleb128 .LVU718
+	.uleb128 .LVU718
+	.uleb128 .LVU760
+.LLST8:
+	.byte	0x6
+	.quad	.LVL5
+	.byte	0x4
+	.uleb128 .LVL5-.LVL5
+	.uleb128 .LVL34-.LVL5
+	.uleb128 0xe
+	.byte	0x6b
+	.byte	0x93
+	.uleb128 0x4
+	.byte	0x66
+	.byte	0x93
+	.uleb128 0x4
+	.byte	0x91
+	.sleb128 -28
+	.byte	0x93
+	.uleb128 0x4
+	.byte	0x91
+	.sleb128 -20
+	.byte	0x93
+	.uleb128 0x4
+	.byte	0x4
+	.uleb128 .LVL34-.LVL5
+	.uleb128 .LVL63-.LVL5
+	.uleb128 0xf
+	.byte	0x68
+	.byte	0x93
+	.uleb128 0x4
+	.byte	0x64
+	.byte	0x93
+	.uleb128 0x4
+	.byte	0x91
+	.sleb128 -52
+	.byte	0x93
+	.uleb128 0x4
+	.byte	0x91
+	.sleb128 -68
+	.byte	0x93
+	.uleb128 0x4
+	.byte	0x4
+	.uleb128 .LVL94-.LVL5
+	.uleb128 .LVL127-.LVL5
+	.uleb128 0xd
+	.byte	0x65
+	.byte	0x93
+	.uleb128 0x4
+	.byte	0x91
+	.sleb128 -40
+	.byte	0x93
+	.uleb128 0x4
+	.byte	0x6c
+	.byte	0x93
+	.uleb128 0x4
+	.byte	0x6d
+	.byte	0x93
+	.uleb128 0x4
+	.byte	0x4
+	.uleb128 .LVL127-.LVL5
+	.uleb128 .LVL159-.LVL5
+	.uleb128 0xd
+	.byte	0x6a
+	.byte	0x93
+	.uleb128 0x4
+	.byte	0x68
+	.byte	0x93
+	.uleb128 0x4
+	.byte	0x6d
+	.byte	0x93
+	.uleb128 0x4
+	.byte	0x91
+	.sleb128 -28
+	.byte	0x93
+	.uleb128 0x4
+	.byte	0x4
+	.uleb128 .LVL159-.LVL5
+	.uleb128 .LVL191-.LVL5
+	.uleb128 0xf
+	.byte	0x91
+	.sleb128 -28
+	.byte	0x93
+	.uleb128 0x4
+	.byte	0x91
+	.sleb128 -60
+	.byte	0x93
+	.uleb128 0x4
+	.byte	0x91
+	.sleb128 -24
+	.byte	0x93
+	.uleb128 0x4
+	.byte	0x6b
+	.byte	0x93
+	.uleb128 0x4
+	.byte	0x4
+	.uleb128 .LVL191-.LVL5
+	.uleb128 .LVL223-.LVL5
+	.uleb128 0xf
+	.byte	0x91
+	.sleb128 -52
+	.byte	0x93
+	.uleb128 0x4
+	.byte	0x91
+	.sleb128 -68
+	.byte	0x93
+	.uleb128 0x4
+	.byte	0x64
+	.byte	0x93
+	.uleb128 0x4
+	.byte	0x66
+	.byte	0x93
+	.uleb128 0x4
+	.byte	0x4
+	.uleb128 .LVL223-.LVL5
+	.uleb128 .LVL257-.LVL5
+	.uleb128 0xd
+	.byte	0x6c
+	.byte	0x93
+	.uleb128 0x4
+	.byte	0x67
+	.byte	0x93
+	.uleb128 0x4
+	.byte	0x65
+	.byte	0x93
+	.uleb128 0x4
+	.byte	0x91
+	.sleb128 -40
+	.byte	0x93
+	.uleb128 0x4
+	.byte	0x4
+	.uleb128 .LVL257-.LVL5
+	.uleb128 .LVL274-.LVL5
+	.uleb128 0xe
+	.byte	0x64
+	.byte	0x93
+	.uleb128 0x4
+	.byte	0x91
+	.sleb128 -52
+	.byte	0x93
+	.uleb128 0x4
+	.byte	0x67
+	.byte	0x93
+	.uleb128 0x4
+	.byte	0x91
+	.sleb128 -60
+	.byte	0x93
+	.uleb128 0x4
+	.byte	0x4
+	.uleb128 .LVL274-.LVL5
+	.uleb128 .LVL275-.LVL5
+	.uleb128 0xe
+	.byte	0x6b
+	.byte	0x93
+	.uleb128 0x4
+	.byte	0x91
+	.sleb128 -52
+	.byte	0x93
+	.uleb128 0x4
+	.byte	0x67
+	.byte	0x93
+	.uleb128 0x4
+	.byte	0x91
+	.sleb128 -60
+	.byte	0x93
+	.uleb128 0x4
+	.byte	0x4
+	.uleb128 .LVL275-.LVL5
+	.uleb128 .LVL277-.LVL5
+	.uleb128 0x12
+	.byte	0x6b
+	.byte	0x93
+	.uleb128 0x4
+	.byte	0x91
+	.sleb128 -52
+	.byte	0x93
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x23
+	.uleb128 0x10
+	.byte	0x93
+	.uleb128 0x4
+	.byte	0x91
+	.sleb128 -60
+	.byte	0x93
+	.uleb128 0x4
+	.byte	0x4
+	.uleb128 .LVL277-.LVL5
+	.uleb128 .LVL290-.LVL5
+	.uleb128 0x14
+	.byte	0x91
+	.sleb128 -72
+	.byte	0x93
+	.uleb128 0x4
+	.byte	0x91
+	.sleb128 -52
+	.byte	0x93
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x23
+	.uleb128 0x10
+	.byte	0x93
+	.uleb128 0x4
+	.byte	0x91
+	.sleb128 -60
+	.byte	0x93
+	.uleb128 0x4
+	.byte	0
+.LVUS9:
+	.uleb128 .LVU37
+	.uleb128 .LVU53
+	.uleb128 .LVU58
+	.uleb128 .LVU87
+	.uleb128 .LVU93
+	.uleb128 .LVU132
+	.uleb128 .LVU138
+	.uleb128 .LVU164
+	.uleb128 .LVU170
+	.uleb128 .LVU210
+	.uleb128 .LVU216
+	.uleb128 .LVU247
+	.uleb128 .LVU253
+	.uleb128 .LVU289
+	.uleb128 .LVU295
+	.uleb128 .LVU326
+	.uleb128 .LVU332
+	.uleb128 .LVU369
+	.uleb128 .LVU375
+	.uleb128 .LVU407
+	.uleb128 .LVU413
+	.uleb128 .LVU451
+	.uleb128 .LVU457
+	.uleb128 .LVU487
+	.uleb128 .LVU493
+	.uleb128 .LVU530
+	.uleb128 .LVU536
+	.uleb128 .LVU564
+	.uleb128 .LVU570
+	.uleb128 .LVU612
+	.uleb128 .LVU618
+	.uleb128 .LVU645
+	.uleb128 .LVU651
+	.uleb128 .LVU694
+	.uleb128 .LVU694
+	.uleb128 .LVU747
+	.uleb128 .LVU752
+	.uleb128 .LVU786
+	.uleb128 .LVU792
+	.uleb128 .LVU802
+	.uleb128 .LVU802
+	.uleb128 .LVU816
+	.uleb128 .LVU816
+	.uleb128 .LVU822
+.LLST9:
+	.byte	0x6
+	.quad	.LVL7
+	.byte	0x4
+	.uleb128 .LVL7-.LVL7
+	.uleb128 .LVL16-.LVL7
+	.uleb128 0x1
+	.byte	0x6f
+	.byte	0x4
+	.uleb128 .LVL18-.LVL7
+	.uleb128 .LVL32-.LVL7
+	.uleb128 0x1
+	.byte	0x6f
+	.byte	0x4
+	.uleb128 .LVL34-.LVL7
+	.uleb128 .LVL47-.LVL7
+	.uleb128 0x1
+	.byte	0x6f
+	.byte	0x4
+	.uleb128 .LVL49-.LVL7
+	.uleb128 .LVL61-.LVL7
+	.uleb128 0x1
+	.byte	0x6f
+	.byte	0x4
+	.uleb128 .LVL63-.LVL7
+	.uleb128 .LVL77-.LVL7
+	.uleb128 0x1
+	.byte	0x6f
+	.byte	0x4
+	.uleb128 .LVL79-.LVL7
+	.uleb128 .LVL92-.LVL7
+	.uleb128 0x1
+	.byte	0x6f
+	.byte	0x4
+	.uleb128 .LVL94-.LVL7
+	.uleb128 .LVL108-.LVL7
+	.uleb128 0x1
+	.byte	0x6f
+	.byte	0x4
+	.uleb128 .LVL110-.LVL7
+	.uleb128 .LVL125-.LVL7
+	.uleb128 0x1
+	.byte	0x6f
+	.byte	0x4
+	.uleb128 .LVL127-.LVL7
+	.uleb128 .LVL141-.LVL7
+	.uleb128 0x1
+	.byte	0x6f
+	.byte	0x4
+	.uleb128 .LVL143-.LVL7
+	.uleb128 .LVL157-.LVL7
+	.uleb128 0x1
+	.byte	0x6f
+	.byte	0x4
+	.uleb128 .LVL159-.LVL7
+	.uleb128 .LVL173-.LVL7
+	.uleb128 0x1
+	.byte	0x6f
+	.byte	0x4
+	.uleb128 .LVL175-.LVL7
+	.uleb128 .LVL189-.LVL7
+	.uleb128 0x1
+	.byte	0x6f
+	.byte	0x4
+	.uleb128 .LVL191-.LVL7
+	.uleb128 .LVL205-.LVL7
+	.uleb128 0x1
+	.byte	0x6f
+	.byte	0x4
+	.uleb128 .LVL207-.LVL7
+	.uleb128 .LVL221-.LVL7
+	.uleb128 0x1
+	.byte	0x6f
+	.byte	0x4
+	.uleb128 .LVL223-.LVL7
+	.uleb128 .LVL239-.LVL7
+	.uleb128 0x1
+	.byte	0x6f
+	.byte	0x4
+	.uleb128 .LVL241-.LVL7
+	.uleb128 .LVL255-.LVL7
+	.uleb128 0x1
+	.byte	0x6f
+	.byte	0x4
+	.uleb128 .LVL257-.LVL7
+	.uleb128 .LVL271-.LVL7
+	.uleb128 0x1
+	.byte	0x6f
+	.byte	0x4
+	.uleb128 .LVL271-.LVL7
+	.uleb128 .LVL288-.LVL7
+	.uleb128 0x1
+	.byte	0x63
+	.byte	0x4
+	.uleb128 .LVL290-.LVL7
+	.uleb128 .LVL304-.LVL7
+	.uleb128 0x1
+	.byte	0x63
+	.byte	0x4
+	.uleb128 .LVL306-.LVL7
+	.uleb128 .LVL310-.LVL7
+	.uleb128 0x1
+	.byte	0x63
+	.byte	0x4
+	.uleb128 .LVL310-.LVL7
+	.uleb128 .LVL318-.LVL7
+	.uleb128 0x1
+	.byte	0x65
+	.byte	0x4
+	.uleb128 .LVL318-.LVL7
+	.uleb128 .LVL321-.LVL7
+	.uleb128 0x1
+	.byte	0x64
+	.byte	0
+.LVUS11:
+	.uleb128 .LVU1
+	.uleb128 .LVU2
+.LLST11:
+	.byte	0x8
+	.quad	.LVL0
+	.uleb128 .LVL0-.LVL0
+	.uleb128 0x2
+	.byte	0x30
+	.byte	0x9f
+	.byte	0
+.Ldebug_loc3:
+	.section	.debug_aranges,"",@progbits
+	.long	0x2c
+	.value	0x2
+	.long	.Ldebug_info0
+	.byte	0x8
+	.byte	0
+	.value	0
+	.value	0
+	.quad	.Ltext0
+	.quad	.Letext0-.Ltext0
+	.quad	0
+	.quad	0
+	.section	.debug_rnglists,"",@progbits
+.Ldebug_ranges0:
+	.long	.Ldebug_ranges3-.Ldebug_ranges2
+.Ldebug_ranges2:
+	.value	0x5
+	.byte	0x8
+	.byte	0
+	.long	0
+.LLRL10:
+	.byte	0x5
+	.quad	.LBB47
+	.byte	0x4
+	.uleb128 .LBB47-.LBB47
+	.uleb128 .LBE47-.LBB47
+	.byte	0x4
+	.uleb128 .LBB49-.LBB47
+	.uleb128 .LBE49-.LBB47
+	.byte	0x4
+	.uleb128 .LBB50-.LBB47
+	.uleb128 .LBE50-.LBB47
+	.byte	0x4
+	.uleb128 .LBB52-.LBB47
+	.uleb128 .LBE52-.LBB47
+	.byte	0x4
+	.uleb128 .LBB54-.LBB47
+	.uleb128 .LBE54-.LBB47
+	.byte	0x4
+	.uleb128 .LBB56-.LBB47
+	.uleb128 .LBE56-.LBB47
+	.byte	0x4
+	.uleb128 .LBB58-.LBB47
+	.uleb128 .LBE58-.LBB47
+	.byte	0
+.LLRL15:
+	.byte	0x5
+	.quad	.LBB126
+	.byte	0x4
+	.uleb128 .LBB126-.LBB126
+	.uleb128 .LBE126-.LBB126
+	.byte	0x4
+	.uleb128 .LBB129-.LBB126
+	.uleb128 .LBE129-.LBB126
+	.byte	0
+.LLRL18:
+	.byte	0x5
+	.quad	.LBB132
+	.byte	0x4
+	.uleb128 .LBB132-.LBB132
+	.uleb128 .LBE132-.LBB132
+	.byte	0x4
+	.uleb128 .LBB138-.LBB132
+	.uleb128 .LBE138-.LBB132
+	.byte	0
+.LLRL21:
+	.byte	0x5
+	.quad	.LBB135
+	.byte	0x4
+	.uleb128 .LBB135-.LBB135
+	.uleb128 .LBE135-.LBB135
+	.byte	0x4
+	.uleb128 .LBB139-.LBB135
+	.uleb128 .LBE139-.LBB135
+	.byte	0
+.LLRL30:
+	.byte	0x5
+	.quad	.LBB140
+	.byte	0x4
+	.uleb128 .LBB140-.LBB140
+	.uleb128 .LBE140-.LBB140
+	.byte	0x4
+	.uleb128 .LBB146-.LBB140
+	.uleb128 .LBE146-.LBB140
+	.byte	0
+.LLRL33:
+	.byte	0x5
+	.quad	.LBB143
+	.byte	0x4
+	.uleb128 .LBB143-.LBB143
+	.uleb128 .LBE143-.LBB143
+	.byte	0x4
+	.uleb128 .LBB147-.LBB143
+	.uleb128 .LBE147-.LBB143
+	.byte	0
+.LLRL36:
+	.byte	0x5
+	.quad	.LBB152
+	.byte	0x4
+	.uleb128 .LBB152-.LBB152
+	.uleb128 .LBE152-.LBB152
+	.byte	0x4
+	.uleb128 .LBB160-.LBB152
+	.uleb128 .LBE160-.LBB152
+	.byte	0
+.LLRL39:
+	.byte	0x5
+	.quad	.LBB155
+	.byte	0x4
+	.uleb128 .LBB155-.LBB155
+	.uleb128 .LBE155-.LBB155
+	.byte	0x4
+	.uleb128 .LBB159-.LBB155
+	.uleb128 .LBE159-.LBB155
+	.byte	0
+.LLRL42:
+	.byte	0x7
+	.quad	.Ltext0
+	.uleb128 .Letext0-.Ltext0
+	.byte	0
+.Ldebug_ranges3:
+	.section	.debug_line,"",@progbits
+.Ldebug_line0:
+	.section	.debug_str,"MS",@progbits,1
+.LASF16:
+	.string	"digest_len"
+.LASF9:
+	.string	"__uint8_t"
+.LASF26:
+	.string	"blake2s_compress_vec"
+.LASF25:
+	.string	"blake2s_compress_blocks_vec"
+.LASF2:
+	.string	"long int"
+.LASF10:
+	.string	"short int"
+.LASF21:
+	.string	"blake2s_sigma"
+.LASF22:
+	.string	"vu32"
+.LASF28:
+	.string	"vstore"
+.LASF4:
+	.string	"unsigned char"
+.LASF3:
+	.string	"long unsigned int"
+.LASF5:
+	.string	"short unsigned int"
+.LASF8:
+	.string	"size_t"
+.LASF24:
+	.string	"nblocks"
+.LASF15:
+	.string	"buf_len"
+.LASF30:
+	.string	"read_le32"
+.LASF11:
+	.string	"__uint32_t"
+.LASF17:
+	.string	"last_node"
+.LASF6:
+	.string	"unsigned int"
+.LASF18:
+	.string	"long long unsigned int"
+.LASF13:
+	.string	"uint8_t"
+.LASF20:
+	.string	"blake2s_iv"
+.LASF23:
+	.string	"blake2s_viv"
+.LASF19:
+	.string	"long long int"
+.LASF12:
+	.string	"char"
+.LASF33:
+	.string	"GNU C99 12.2.0 -mtune=generic -march=x86-64 -g -O3 -std=c99 -fasynchronous-unwind-tables"
+.LASF14:
+	.string	"uint32_t"
+.LASF27:
+	.string	"blake2s_10rounds"
+.LASF31:
+	.string	"to_le32"
+.LASF34:
+	.string	"blake2s_ctx"
+.LASF7:
+	.string	"signed char"
+.LASF29:
+	.string	"vload"
+.LASF32:
+	.string	"_one"
+	.section	.debug_line_str,"MS",@progbits,1
+.LASF1:
+	.string	"/root/repo"
+.LASF0:
+	.string	"blake2s-vec.c"
+	.ident	"GCC: (Debian 12.2.0-14+deb12u1) 12.2.0"
+	.section	.note.GNU-stack,"",@progbits
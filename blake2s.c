@@ -9,12 +9,18 @@
  this software. If not, see <http://creativecommons.org/publicdomain/zero/1.0/>.
 */
 
+#include <errno.h>
 #include <stdlib.h>
 #include <stdio.h>
 #include <string.h>
 
 #include "blake2s.h"
+#include "blake2sp.h"
+#include "blake2xs.h"
+#include "blake2b.h"
+#include "blake2bp.h"
 #include "blake2s-internal.h"
+#include "blake2b-internal.h"
 
 /* BLAKE2s: designed for 32-bit and smaller arches
  * + Message is interpreted in little endian
@@ -26,11 +32,14 @@
  * Key byte length (1, 1)    in [0,32]
  * Fanout         (1, 2)   = 1 for non-tree hashing style
  * Max depth      (1, 3)   = 1 for non-tree hashing style
+ * Leaf length    (4, 4-7)   = 0 for non-tree hashing style
+ * Node offset    (6, 8-13)  = 0 for non-tree hashing style
+ * Node depth     (1, 14)    = 0 for non-tree hashing style
+ * Inner length   (1, 15)    = 0 for non-tree hashing style
  * Salt (8, 16-23) default zeros
  * Personalization (8, 24-32) default zeros
  */
 #define B2S_BLOCK BLAKE2S_BLOCK
-#define B2S_PARAM_WORDS 4
 #define B2S_SALT_WORDS  2
 #define B2S_PERS_WORDS  2
 /*Require 8 = B2S_PARAM_WORDS + B2S_SALT_WORDS + B2S_PERS_WORDS*/
@@ -39,19 +48,14 @@ static const u8  blake2s_salt_def [4*B2S_SALT_WORDS]  = {0};
 static const u8  blake2s_pers_def [4*B2S_PERS_WORDS]  = {0};
 
 /* Param word 1: diglen,keylen,1,1 */
-#define LE32W(x,y,z,w) (u32)((x)|((y)<<8)|((z)<<16)|((w)<<24))
 #define B2S_FIRST_PARAM(dlen,klen) LE32W(dlen,klen,1,1)
 
 #define B2S_IO_CHUNKSIZ (8 << 10)
 
+/* any alignment of dst and src */
 static void butil_copy_fast(void *dst, const void *src, unsigned bytes)
 {
-    u8 *udst = dst;
-    const u8 *usrc = src;
-    unsigned off = bytes - (bytes & 3);
-    butil_copy_words(dst, src, bytes);
-    for (unsigned i = off; i < bytes; i++)
-        udst[i] = usrc[i];
+    memcpy(dst, src, bytes);
 }
 
 static void butil_overwrite_zeros(void *dst, size_t len)
@@ -96,30 +100,43 @@ void blake2s_update(struct blake2s_ctx *ctx, const void *src, size_t len)
         bstate_buf_append(ctx, src, len);
         return;
     }
-    /* first block */
-    bstate_buf_append(ctx, src, rest);
-    src_off += rest;
-    len -= rest;
-
-    /* full blocks */
-    while (1) {
+    /* complete the buffered block, if any */
+    if (ctx->buf_len) {
+        bstate_buf_append(ctx, src, rest);
+        src_off += rest;
+        len -= rest;
         bstate_inc_t(ctx, B2S_BLOCK);
         blake2s_compress(ctx, ctx->buf);
+        ctx->buf_len = 0;
+    }
 
-        if (len <= B2S_BLOCK) break;
-
-        butil_copy_words(ctx->buf, (char *)src + src_off, B2S_BLOCK);
-        len -= B2S_BLOCK;
-        src_off += B2S_BLOCK;
+    /* full blocks straight from `src`, in one run, except the last */
+    if (len > B2S_BLOCK) {
+        size_t nblocks = (len - 1) / B2S_BLOCK;
+        blake2s_compress_blocks(ctx, (char *)src + src_off, nblocks);
+        len -= nblocks * B2S_BLOCK;
+        src_off += nblocks * B2S_BLOCK;
     }
 
     bstate_buf_set(ctx, (char *)src + src_off, len);
 }
 
+/* bstate_mac_empty: a blake2s_mac_init() context that has absorbed
+ * nothing, with the MAC of the empty message in buf. No other context
+ * has counted bytes without holding some back in buf. */
+static int bstate_mac_empty(const struct blake2s_ctx *ctx)
+{
+    return !ctx->buf_len && (ctx->t[0] || ctx->t[1]);
+}
+
 static void bstate_output_digest(struct blake2s_ctx *ctx, unsigned char *out)
 {
     /* write digest in le32 to `out` */
     unsigned i = 0, off = 0;
+    if (bstate_mac_empty(ctx)) {
+        butil_copy_fast(out, ctx->buf, ctx->digest_len);
+        return;
+    }
     for (; i < ctx->digest_len/4; i++)
         write_le32(out+i*4, ctx->H[i]);
     while (i*4 + off < ctx->digest_len) {
@@ -131,66 +148,217 @@ static void bstate_output_digest(struct blake2s_ctx *ctx, unsigned char *out)
 
 void blake2s_final(struct blake2s_ctx *ctx, unsigned char *out)
 {
-    bstate_buf_zeropad(ctx);
-    bstate_set_final_block(ctx);
-    bstate_inc_t(ctx, ctx->buf_len);
-    blake2s_compress(ctx, ctx->buf);
+    if (!bstate_mac_empty(ctx)) {
+        bstate_buf_zeropad(ctx);
+        bstate_set_final_block(ctx);
+        if (ctx->last_node)
+            ctx->f[1] = ~0U;
+        bstate_inc_t(ctx, ctx->buf_len);
+        blake2s_compress(ctx, ctx->buf);
+    }
     bstate_output_digest(ctx, out);
     butil_overwrite_zeros(ctx, sizeof(*ctx));
 }
 
-static void blake2s_init_ex(struct blake2s_ctx *ctx, const void *salt,
-                            unsigned dig_len, unsigned key_len)
+/* Multi-buffer hashing
+ *
+ * While a context occupies a lane of the multi-buffer kernel, its
+ * H, t and f live in the transposed lane state; its buf stages the
+ * blocks that do not come straight from the input.
+ */
+
+const void *blake2s_lane_next(struct blake2s_lanes *L, unsigned l,
+                              struct blake2s_job *lane, int *last)
+{
+    struct blake2s_ctx *ctx = lane->ctx;
+    const void *m = ctx->buf;
+
+    *last = 0;
+    if (ctx->buf_len + lane->len > B2S_BLOCK) {
+        if (ctx->buf_len) {
+            size_t fill = B2S_BLOCK - ctx->buf_len;
+            bstate_buf_append(ctx, lane->src, fill);
+            ctx->buf_len = 0;
+            lane->src += fill;
+            lane->len -= fill;
+        } else {
+            m = lane->src;
+            lane->src += B2S_BLOCK;
+            lane->len -= B2S_BLOCK;
+        }
+        blane_inc_t(L, l, B2S_BLOCK);
+        return m;
+    }
+    bstate_buf_append(ctx, lane->src, lane->len);
+    lane->len = 0;
+    if (!lane->out)
+        return NULL;
+    if (bstate_mac_empty(ctx))
+        return NULL; /* nothing to compress: retiring outputs the MAC */
+    bstate_buf_zeropad(ctx);
+    L->f[0][l] = ~0U;
+    if (ctx->last_node)
+        L->f[1][l] = ~0U;
+    blane_inc_t(L, l, ctx->buf_len);
+    *last = 1;
+    return m;
+}
+
+void blake2s_lane_retire(struct blake2s_lanes *L, unsigned l,
+                         struct blake2s_job *lane)
+{
+    blane_store(L, l, lane->ctx);
+    if (lane->out) {
+        bstate_output_digest(lane->ctx, lane->out);
+        butil_overwrite_zeros(lane->ctx, sizeof(*lane->ctx));
+    }
+}
+
+/* blake2s_lanes_run: run up to blake2s_kern->lanes jobs through each
+ * kernel call. A lane whose job is done is retired, and the next job
+ * joins in its place before the following call.
+ */
+void blake2s_lanes_run(struct blake2s_job *job, size_t n)
+{
+    struct blake2s_lanes L;
+    struct blake2s_job lane[B2S_LANES_MAX];
+    const void *m[B2S_LANES_MAX];
+    unsigned width = blake2s_kern->lanes;
+    unsigned mask = 0, done;
+    size_t next = 0;
+
+    while (1) {
+        done = 0;
+        for (unsigned l = 0; l < width; l++) {
+            const void *p = NULL;
+            int last = 0;
+            if (mask & (1u << l)) {
+                p = blake2s_lane_next(&L, l, &lane[l], &last);
+                if (!p) {
+                    blake2s_lane_retire(&L, l, &lane[l]);
+                    mask &= ~(1u << l);
+                }
+            }
+            /* join: fill a free lane from the queue */
+            while (!p && next < n) {
+                lane[l] = job[next++];
+                blane_load(&L, l, lane[l].ctx);
+                p = blake2s_lane_next(&L, l, &lane[l], &last);
+                if (!p)
+                    blake2s_lane_retire(&L, l, &lane[l]);
+            }
+            if (!p)
+                continue;
+            m[l] = p;
+            mask |= 1u << l;
+            if (last)
+                done |= 1u << l;
+        }
+        if (!mask)
+            break;
+        blake2s_compress_lanes(&L, m, mask);
+        /* retire finished lanes */
+        for (unsigned l = 0; l < width; l++)
+            if (done & (1u << l))
+                blake2s_lane_retire(&L, l, &lane[l]);
+        mask &= ~done;
+    }
+    butil_overwrite_zeros(&L, sizeof(L));
+}
+
+static void blake2s_init_ex(struct blake2s_ctx *ctx,
+                            const u32 P[B2S_PARAM_WORDS], const void *salt,
+                            const void *personal)
 {
     unsigned i = 0;
-    ctx->H[i] = blake2s_iv[i] ^ B2S_FIRST_PARAM(dig_len,key_len); i++;
     for (; i < B2S_PARAM_WORDS; i++)
-        ctx->H[i] = blake2s_iv[i]; /* Param words 1-3 are 0 in sequential mode*/
+        ctx->H[i] = blake2s_iv[i] ^ P[i];
     for (unsigned j = 0; j < B2S_SALT_WORDS; j++, i++)
         ctx->H[i] = blake2s_iv[i] ^ read_le32((const u8 *)salt + j*4);
     for (unsigned j = 0; j < B2S_PERS_WORDS; j++, i++)
-        ctx->H[i] = blake2s_iv[i] ^ read_le32((const u8 *)blake2s_pers_def+j*4);
+        ctx->H[i] = blake2s_iv[i] ^ read_le32((const u8 *)personal + j*4);
     ctx->t[0] = 0;
     ctx->t[1] = 0;
     ctx->f[0] = 0;
     ctx->f[1] = 0;
-    ctx->digest_len = dig_len;
+    ctx->digest_len = P[0] & 0xff;
     ctx->buf_len = 0;
+    ctx->last_node = 0;
+}
+
+void blake2s_init_words(struct blake2s_ctx *ctx, const u32 P[B2S_PARAM_WORDS],
+                        const void *salt, const void *personal,
+                        const void *key, unsigned key_len)
+{
+    blake2s_init_ex(ctx, P, salt ? salt : blake2s_salt_def,
+                    personal ? personal : blake2s_pers_def);
+    if (key_len) {
+        u8 key_block[B2S_BLOCK] = {0};
+        memcpy(key_block, key, key_len);
+        blake2s_update(ctx, key_block, B2S_BLOCK);
+        butil_overwrite_zeros(key_block, sizeof(key_block));
+    }
 }
 
 int blake2s_init_salted(struct blake2s_ctx *ctx, const void *salt,
                         unsigned dig_len)
 {
-    if (!salt) salt = blake2s_salt_def;
+    const u32 P[B2S_PARAM_WORDS] = { B2S_FIRST_PARAM(dig_len,0) };
     if (dig_len < 1 || dig_len > BLAKE2S_LEN) return -1;
-    blake2s_init_ex(ctx, salt, dig_len, 0);
+    blake2s_init_words(ctx, P, salt, NULL, NULL, 0);
     return 0;
 }
 
 void blake2s_init(struct blake2s_ctx *ctx)
 {
-    blake2s_init_ex(ctx, blake2s_salt_def, BLAKE2S_LEN, 0);
+    const u32 P[B2S_PARAM_WORDS] = { B2S_FIRST_PARAM(BLAKE2S_LEN,0) };
+    blake2s_init_words(ctx, P, NULL, NULL, NULL, 0);
 }
 
 int blake2s_init_keyed(struct blake2s_ctx *ctx, const void *salt,
                         const void *key, unsigned key_len, unsigned dig_len)
 {
-    u8 key_block[B2S_BLOCK] = {0};
+    const u32 P[B2S_PARAM_WORDS] = { B2S_FIRST_PARAM(dig_len,key_len) };
 
     if (key_len < 1 || key_len > BLAKE2S_KEY_LEN)
         return -1;
     if (dig_len < 1 || dig_len > BLAKE2S_LEN)
         return -1;
-    if (!salt) salt = blake2s_salt_def;
-
-    blake2s_init_ex(ctx, salt, dig_len, key_len);
 
-    memcpy(key_block, key, key_len);
-    blake2s_update(ctx, key_block, B2S_BLOCK);
-    butil_overwrite_zeros(key_block, sizeof(key_block));
+    blake2s_init_words(ctx, P, salt, NULL, key, key_len);
     return 1;
 }
 
+int blake2s_init_param(struct blake2s_ctx *ctx,
+                       const struct blake2s_param *P, const void *key)
+{
+    u32 W[B2S_PARAM_WORDS];
+
+    if (P->digest_len < 1 || P->digest_len > BLAKE2S_LEN)
+        return -1;
+    if (P->key_len > BLAKE2S_KEY_LEN || (P->key_len && !key))
+        return -1;
+    if (P->fanout > 255 || P->depth < 1 || P->depth > 255)
+        return -1;
+    if ((P->node_offset >> 48) || P->node_depth > 255)
+        return -1;
+    if (P->inner_len > BLAKE2S_LEN)
+        return -1;
+
+    W[0] = LE32W(P->digest_len, P->key_len, P->fanout, P->depth);
+    W[1] = P->leaf_len;
+    W[2] = (u32)P->node_offset;
+    W[3] = B2S_PARAM3(P->node_offset >> 32, P->node_depth, P->inner_len);
+    blake2s_init_words(ctx, W, P->salt, P->personal, key, P->key_len);
+    ctx->last_node = !!P->last_node;
+    return 0;
+}
+
+void blake2s_clone(struct blake2s_ctx *dst, const struct blake2s_ctx *src)
+{
+    memcpy(dst, src, sizeof(*dst));
+}
+
 void blake2s(unsigned char *out, const void *src, size_t len)
 {
     struct blake2s_ctx ctx;
@@ -199,40 +367,56 @@ void blake2s(unsigned char *out, const void *src, size_t len)
     blake2s_final(&ctx, out);
 }
 
-int blake2s_file(unsigned char *out, FILE *stream)
+#define B2S_BENCH_BLOCKS (100*1024*1024/B2S_IO_CHUNKSIZ) /* 100 MiB */
+
+static void blake2s_bench(unsigned char *out)
 {
     struct blake2s_ctx ctx;
-    unsigned char buf[B2S_IO_CHUNKSIZ] ALIGN(64);
-    int ret = 1;
+    unsigned char buf[B2S_IO_CHUNKSIZ] ALIGN(64) = {0};
 
     blake2s_init(&ctx);
-    while (1) {
-        size_t read = fread(buf, 1, B2S_IO_CHUNKSIZ, stream);
-        if (!read && ferror(stream)) {
-            ret = -1;
-            goto _out;
-        }
-        if (!read)
-            break;
-        blake2s_update(&ctx, buf, read);
+    for (size_t i = 0; i < B2S_BENCH_BLOCKS; i++) {
+        blake2s_update(&ctx, buf, B2S_IO_CHUNKSIZ);
     }
     blake2s_final(&ctx, out);
-_out:
-    return ret;
 }
 
-#define B2S_BENCH_BLOCKS (100*1024*1024/B2S_IO_CHUNKSIZ) /* 100 MiB */
+static void blake2sp_bench(unsigned char *out)
+{
+    struct blake2sp_ctx ctx;
+    unsigned char buf[B2S_IO_CHUNKSIZ] ALIGN(64) = {0};
 
-static void blake2s_bench(unsigned char *out)
+    blake2sp_init(&ctx);
+    for (size_t i = 0; i < B2S_BENCH_BLOCKS; i++) {
+        blake2sp_update(&ctx, buf, B2S_IO_CHUNKSIZ);
+    }
+    blake2sp_final(&ctx, out);
+}
+
+
+static void blake2b_bench(unsigned char *out)
 {
-    struct blake2s_ctx ctx;
+    struct blake2b_ctx ctx;
     unsigned char buf[B2S_IO_CHUNKSIZ] ALIGN(64) = {0};
 
-    blake2s_init(&ctx);
+    blake2b_init(&ctx);
     for (size_t i = 0; i < B2S_BENCH_BLOCKS; i++) {
-        blake2s_update(&ctx, buf, B2S_IO_CHUNKSIZ);
+        blake2b_update(&ctx, buf, B2S_IO_CHUNKSIZ);
     }
-    blake2s_final(&ctx, out);
+    blake2b_final(&ctx, out);
+}
+
+
+static void blake2bp_bench(unsigned char *out)
+{
+    struct blake2bp_ctx ctx;
+    unsigned char buf[B2S_IO_CHUNKSIZ] ALIGN(64) = {0};
+
+    blake2bp_init(&ctx);
+    for (size_t i = 0; i < B2S_BENCH_BLOCKS; i++) {
+        blake2bp_update(&ctx, buf, B2S_IO_CHUNKSIZ);
+    }
+    blake2bp_final(&ctx, out);
 }
 
 
@@ -249,19 +433,25 @@ static char *hexdigest(char *buf, const u8 *digest, size_t len)
     return buf;
 }
 
-static int test_checkdigest(const void *digest, const void *exp, int verbose)
+static int test_checkdigest_len(const void *digest, const void *exp,
+                                size_t len, int verbose)
 {
-    char hex[BLAKE2S_LEN*2+1];
-    if (!memcmp(digest, exp, BLAKE2S_LEN)) {
+    char hex[BLAKE2B_LEN*2+1];
+    if (!memcmp(digest, exp, len)) {
         if (verbose)
-            printf("PASS %s\n", hexdigest(hex, digest, BLAKE2S_LEN));
+            printf("PASS %s\n", hexdigest(hex, digest, len));
         return 1;
     }
-    printf("FAIL. Got: %s\n", hexdigest(hex, digest, BLAKE2S_LEN));
-    printf("FAIL. Exp: %s\n", hexdigest(hex, exp, BLAKE2S_LEN));
+    printf("FAIL. Got: %s\n", hexdigest(hex, digest, len));
+    printf("FAIL. Exp: %s\n", hexdigest(hex, exp, len));
     return 0;
 }
 
+static int test_checkdigest(const void *digest, const void *exp, int verbose)
+{
+    return test_checkdigest_len(digest, exp, BLAKE2S_LEN, verbose);
+}
+
 static int test_one_vec(const void *input, size_t len, const void *exp, int verbose)
 {
     u8 digest[BLAKE2S_LEN];
@@ -282,11 +472,645 @@ static int test_keyed_vec(const void *input, size_t len, const void *exp,
 }
 #include "blake-kat.h"
 
-static int test_vectors(void)
+/* Hash all KAT lengths at once through the multi-buffer kernel */
+static int test_lanes_vectors(const void *input, const void *key, int verbose)
+{
+    struct blake2s_ctx ctx[KAT_LENGTH];
+    struct blake2s_job job[KAT_LENGTH];
+    u8 digest[KAT_LENGTH][BLAKE2S_LEN];
+    int ret = 1;
+
+    for (unsigned i = 0; i < KAT_LENGTH; i++) {
+        if (key)
+            blake2s_init_keyed(&ctx[i], NULL, key, BLAKE2S_KEY_LEN, BLAKE2S_LEN);
+        else
+            blake2s_init(&ctx[i]);
+        job[i].ctx = &ctx[i];
+        job[i].src = input;
+        job[i].len = i;
+        job[i].out = digest[i];
+    }
+    blake2s_lanes_run(job, KAT_LENGTH);
+    for (unsigned i = 0; i < KAT_LENGTH && ret; i++)
+        ret = test_checkdigest(digest[i], key ? blake2s_keyed_kat[i]
+                                              : blake2s_kat[i], verbose);
+    return ret;
+}
+
+/* blake2s_many over the KAT messages, longest first */
+static int test_many(const void *input, int verbose)
+{
+    unsigned char *outs[KAT_LENGTH];
+    const void *srcs[KAT_LENGTH];
+    size_t lens[KAT_LENGTH];
+    u8 digest[KAT_LENGTH][BLAKE2S_LEN];
+    int ret = 1;
+
+    for (unsigned i = 0; i < KAT_LENGTH; i++) {
+        outs[i] = digest[KAT_LENGTH - 1 - i];
+        srcs[i] = input;
+        lens[i] = KAT_LENGTH - 1 - i;
+    }
+    blake2s_many(outs, srcs, lens, KAT_LENGTH);
+    for (unsigned i = 0; i < KAT_LENGTH && ret; i++)
+        ret = test_checkdigest(digest[i], blake2s_kat[i], verbose);
+    return ret;
+}
+
+/* test_ctx_init: set up context `i` of test_many_ctx; returns its
+ * digest length */
+static unsigned test_ctx_init(struct blake2s_ctx *ctx, unsigned i,
+                              const void *key)
+{
+    unsigned len = i % BLAKE2S_LEN + 1;
+    u8 salt[BLAKE2S_SALT_LEN];
+
+    memset(salt, i, sizeof(salt));
+    switch (i % 4) {
+    case 0:
+        blake2s_init(ctx);
+        return BLAKE2S_LEN;
+    case 1:
+        blake2s_init_salted(ctx, salt, len);
+        return len;
+    case 2:
+        blake2s_init_keyed(ctx, NULL, key, len, BLAKE2S_LEN);
+        return BLAKE2S_LEN;
+    default:
+        blake2s_init_keyed(ctx, salt, (const u8 *)key + i % 7,
+                           BLAKE2S_KEY_LEN - i % 7, len);
+        return len;
+    }
+}
+
+/* blake2s_many_ctx over contexts with different keys, salts and digest
+ * lengths, against blake2s_update/final of the same contexts */
+static int test_many_ctx(const void *input, const void *key, int verbose)
+{
+    struct blake2s_ctx ctx[KAT_LENGTH], ref;
+    unsigned char *outs[KAT_LENGTH];
+    const void *srcs[KAT_LENGTH];
+    size_t lens[KAT_LENGTH];
+    u8 digest[KAT_LENGTH][BLAKE2S_LEN];
+    u8 exp[BLAKE2S_LEN];
+    int ret = 1;
+
+    for (unsigned i = 0; i < KAT_LENGTH; i++) {
+        test_ctx_init(&ctx[i], i, key);
+        outs[i] = digest[i];
+        srcs[i] = (const u8 *)input + i % 5;
+        lens[i] = KAT_LENGTH - 1 - i;
+    }
+    blake2s_many_ctx(ctx, outs, srcs, lens, KAT_LENGTH);
+    for (unsigned i = 0; i < KAT_LENGTH && ret; i++) {
+        unsigned len = test_ctx_init(&ref, i, key);
+        blake2s_update(&ref, srcs[i], lens[i]);
+        blake2s_final(&ref, exp);
+        ret = test_checkdigest_len(digest[i], exp, len, verbose);
+    }
+    return ret;
+}
+
+/* Keyed KATs through a precomputed MAC key, in one go and in two
+ * pieces, and a salted, truncated MAC against blake2s_init_keyed */
+/* MAC contexts of the empty and other messages, finished by
+ * blake2s_final and through the lanes */
+static int test_mac_many(const void *input, const void *key, int verbose)
+{
+    static const size_t lens[] = { 0, 1, 64, 65, 0, 200 };
+    struct blake2s_mac_key K;
+    struct blake2s_ctx ctx[6];
+    u8 digest[6][BLAKE2S_LEN];
+    unsigned char *outs[6];
+    const void *srcs[6];
+    int ret = blake2s_mac_key_init(&K, NULL, key, BLAKE2S_KEY_LEN,
+                                   BLAKE2S_LEN) == 0;
+
+    blake2s_mac_init(&ctx[0], &K);
+    blake2s_final(&ctx[0], digest[0]);
+    ret = ret && test_checkdigest(digest[0], blake2s_keyed_kat[0], verbose);
+    for (unsigned i = 0; i < 6; i++) {
+        blake2s_mac_init(&ctx[i], &K);
+        outs[i] = digest[i];
+        srcs[i] = input;
+    }
+    blake2s_many_ctx(ctx, outs, srcs, lens, 6);
+    for (unsigned i = 0; i < 6 && ret; i++)
+        ret = test_checkdigest(digest[i], blake2s_keyed_kat[lens[i]], verbose);
+    return ret;
+}
+
+static int test_mac(const void *input, const void *key, int verbose)
+{
+    struct blake2s_mac_key K;
+    struct blake2s_ctx ctx;
+    u8 digest[BLAKE2S_LEN], exp[BLAKE2S_LEN];
+    u8 salt[BLAKE2S_SALT_LEN] = "saltsalt";
+    int ret;
+
+    ret = blake2s_mac_key_init(&K, NULL, key, BLAKE2S_KEY_LEN,
+                               BLAKE2S_LEN) == 0;
+    for (unsigned i = 0; i < KAT_LENGTH && ret; i++) {
+        blake2s_mac(digest, &K, input, i);
+        ret = test_checkdigest(digest, blake2s_keyed_kat[i], verbose);
+        if (!ret)
+            break;
+        blake2s_mac_init(&ctx, &K);
+        blake2s_update(&ctx, input, i / 2);
+        blake2s_update(&ctx, (const u8 *)input + i / 2, i - i / 2);
+        blake2s_mac_final(&ctx, &K, digest);
+        ret = test_checkdigest(digest, blake2s_keyed_kat[i], verbose);
+    }
+    if (ret)
+        ret = blake2s_mac_key_init(&K, salt, key, 13, 20) == 0;
+    for (unsigned i = 0; i < KAT_LENGTH && ret; i += 31) {
+        blake2s_init_keyed(&ctx, salt, key, 13, 20);
+        blake2s_update(&ctx, input, i);
+        blake2s_final(&ctx, exp);
+        blake2s_mac(digest, &K, input, i);
+        ret = test_checkdigest_len(digest, exp, 20, verbose);
+    }
+    if (ret)
+        ret = test_mac_many(input, key, verbose);
+    return ret;
+}
+
+/* KAT messages as a shared prefix and their suffixes, with a partial
+ * and a full block held back, and keyed with only the key block */
+static int test_suffix(const void *input, const void *key, int verbose)
+{
+    static const unsigned prefix[] = { 0, 100, 128 };
+    struct blake2s_ctx P, Q;
+    unsigned char *outs[KAT_LENGTH];
+    const void *srcs[KAT_LENGTH];
+    size_t lens[KAT_LENGTH];
+    u8 digest[KAT_LENGTH][BLAKE2S_LEN];
+    int ret = 1;
+
+    for (unsigned p = 0; p < sizeof(prefix) / sizeof(prefix[0]) && ret; p++) {
+        unsigned n = KAT_LENGTH - prefix[p];
+        blake2s_init(&P);
+        blake2s_update(&P, input, prefix[p]);
+        for (unsigned i = 0; i < n; i++) {
+            outs[i] = digest[i];
+            srcs[i] = (const u8 *)input + prefix[p];
+            lens[i] = i;
+        }
+        blake2s_many_suffix(&P, outs, srcs, lens, n);
+        for (unsigned i = 0; i < n && ret; i++)
+            ret = test_checkdigest(digest[i], blake2s_kat[prefix[p] + i],
+                                   verbose);
+        /* a clone goes on from the same point */
+        blake2s_clone(&Q, &P);
+        blake2s_update(&Q, srcs[0], n - 1);
+        blake2s_final(&Q, digest[0]);
+        if (ret)
+            ret = test_checkdigest(digest[0], blake2s_kat[KAT_LENGTH - 1],
+                                   verbose);
+    }
+    blake2s_init_keyed(&P, NULL, key, BLAKE2S_KEY_LEN, BLAKE2S_LEN);
+    for (unsigned i = 0; i < KAT_LENGTH; i++) {
+        srcs[i] = input;
+        lens[i] = i;
+    }
+    blake2s_many_suffix(&P, outs, srcs, lens, KAT_LENGTH);
+    for (unsigned i = 0; i < KAT_LENGTH && ret; i++)
+        ret = test_checkdigest(digest[i], blake2s_keyed_kat[i], verbose);
+    return ret;
+}
+
+/* Every KAT message as a stream through the job manager: a third of it
+ * in an open job, the rest in a final job submitted once the first one
+ * comes back */
+static int test_mgr(const void *input, int verbose)
+{
+    struct blake2s_mgr *M = blake2s_mgr_new();
+    struct blake2s_ctx ctx[KAT_LENGTH];
+    struct blake2s_mgr_job job[KAT_LENGTH];
+    u8 digest[KAT_LENGTH][BLAKE2S_LEN];
+    struct blake2s_mgr_job *J;
+    size_t next = 0, finished = 0;
+    int ret = 1;
+
+    if (!M)
+        return 0;
+    for (unsigned i = 0; i < KAT_LENGTH; i++) {
+        blake2s_init(&ctx[i]);
+        job[i].ctx = &ctx[i];
+        job[i].src = input;
+        job[i].len = i / 3;
+        job[i].out = NULL;
+    }
+    while (finished < KAT_LENGTH && ret) {
+        if (next < KAT_LENGTH)
+            J = blake2s_mgr_submit(M, &job[next++]);
+        else if (!(J = blake2s_mgr_flush(M)))
+            ret = 0;
+        while (J && !J->out) {
+            size_t i = J - job;
+            J->src = (const u8 *)input + J->len;
+            J->len = i - J->len;
+            J->out = digest[i];
+            J = blake2s_mgr_submit(M, J);
+        }
+        if (J)
+            finished++;
+    }
+    blake2s_mgr_free(M);
+    for (unsigned i = 0; i < KAT_LENGTH && ret; i++)
+        ret = test_checkdigest(digest[i], blake2s_kat[i], verbose);
+    return ret;
+}
+
+static int test_sp_vec(const void *input, size_t len, const void *exp,
+                       const void *key, unsigned keylen, int verbose)
+{
+    u8 digest[BLAKE2S_LEN];
+    struct blake2sp_ctx ctx;
+    memset(digest, 0, BLAKE2S_LEN);
+    if (key)
+        blake2sp_init_keyed(&ctx, NULL, key, keylen, BLAKE2S_LEN);
+    else
+        blake2sp_init(&ctx);
+    blake2sp_update(&ctx, input, len);
+    blake2sp_final(&ctx, digest);
+    return test_checkdigest(digest, exp, verbose);
+}
+
+/* BLAKE2sp of B2SP_TEST_LONG bytes (i & 0xff), fed in uneven pieces so
+ * that strides run both from the buffer and from the input */
+#define B2SP_TEST_LONG 10000
+static const u8 blake2sp_long_exp[BLAKE2S_LEN] = {
+    0xb2, 0x9e, 0xfd, 0xd6, 0x15, 0x6f, 0xdf, 0xd9,
+    0x8e, 0x4e, 0xef, 0x8c, 0x9b, 0x09, 0xf0, 0x33,
+    0xad, 0x6f, 0xf2, 0x1f, 0x0e, 0xdf, 0x33, 0x9e,
+    0x3f, 0x78, 0xdd, 0x91, 0xc6, 0xa1, 0xd9, 0xcb,
+};
+
+static int test_sp_long(int verbose)
+{
+    static const size_t piece[] = { 1, 63, 513, 960, 961, 2047, B2SP_TEST_LONG };
+    u8 input[B2SP_TEST_LONG];
+    u8 digest[BLAKE2S_LEN];
+    int ret = 1;
+
+    for (unsigned i = 0; i < sizeof(input); i++)
+        input[i] = i;
+    for (unsigned k = 0; k < sizeof(piece)/sizeof(piece[0]) && ret; k++) {
+        struct blake2sp_ctx ctx;
+        size_t off = 0;
+        blake2sp_init(&ctx);
+        while (off < sizeof(input)) {
+            size_t n = sizeof(input) - off < piece[k] ? sizeof(input) - off
+                                                      : piece[k];
+            blake2sp_update(&ctx, input + off, n);
+            off += n;
+        }
+        blake2sp_final(&ctx, digest);
+        ret = test_checkdigest(digest, blake2sp_long_exp, verbose);
+    }
+    return ret;
+}
+
+/* Tree hashes of B2SP_TEST_LONG bytes (i & 0xff): fanout 4, depth 3,
+ * 256-byte leaves; and keyed, fanout 2, depth 4, 1000-byte leaves and
+ * 16-byte inner digests */
+static const u8 blake2s_tree_exp[2][BLAKE2S_LEN] = {
+  {
+    0xe9, 0x4a, 0x5a, 0x37, 0xd1, 0x15, 0xe0, 0x58,
+    0x87, 0x43, 0x63, 0x3f, 0xbd, 0x91, 0x0d, 0x47,
+    0xf1, 0x1a, 0x31, 0xa9, 0xa7, 0x01, 0x53, 0x48,
+    0xb0, 0x69, 0x85, 0x67, 0x23, 0xca, 0x2b, 0x6d,
+  },
+  {
+    0x61, 0xb8, 0x9d, 0x81, 0xb5, 0xb8, 0xc6, 0x9d,
+    0xf0, 0xd9, 0xc0, 0xaa, 0x45, 0xfa, 0x07, 0xb5,
+    0x31, 0x04, 0x60, 0xad, 0x8d, 0x8a, 0x23, 0xb3,
+    0xd5, 0x11, 0x4c, 0xdc, 0x51, 0xc4, 0x52, 0xd1,
+  },
+};
+
+static int test_tree(const void *key, int verbose)
+{
+    struct blake2s_param P = { BLAKE2S_LEN, 0, 4, 3, 256, 0, 0, BLAKE2S_LEN,
+                               {0}, {0}, 0 };
+    u8 input[B2SP_TEST_LONG];
+    u8 digest[BLAKE2S_LEN];
+
+    for (unsigned i = 0; i < sizeof(input); i++)
+        input[i] = i;
+    if (blake2s_tree(digest, input, sizeof(input), &P, NULL) < 0
+        || !test_checkdigest(digest, blake2s_tree_exp[0], verbose))
+        return 0;
+    P.key_len = BLAKE2S_KEY_LEN;
+    P.fanout = 2;
+    P.depth = 4;
+    P.leaf_len = 1000;
+    P.inner_len = 16;
+    if (blake2s_tree(digest, input, sizeof(input), &P, key) < 0)
+        return 0;
+    return test_checkdigest(digest, blake2s_tree_exp[1], verbose);
+}
+
+/* Parallel BLAKE2sp and tree hashes of B2S_TEST_PAR bytes (i & 0xff)
+ * must not depend on the number of threads */
+#define B2S_TEST_PAR ((1 << 20) + 1000)
+
+static int test_parallel(int verbose)
+{
+    static const unsigned threads[] = { 2, 3, 4, 8, 13 };
+    struct blake2s_param P = { BLAKE2S_LEN, 0, 4, 4, 64, 0, 0, BLAKE2S_LEN,
+                               {0}, {0}, 0 };
+    u8 exp_sp[BLAKE2S_LEN], exp_tree[BLAKE2S_LEN];
+    u8 digest[BLAKE2S_LEN];
+    u8 *input = malloc(B2S_TEST_PAR);
+    int ret = 1;
+
+    if (!input)
+        return 0;
+    for (unsigned i = 0; i < B2S_TEST_PAR; i++)
+        input[i] = i;
+    blake2sp(exp_sp, input, B2S_TEST_PAR);
+    ret = blake2s_tree(exp_tree, input, B2S_TEST_PAR, &P, NULL) == 0;
+    for (unsigned k = 0; k < sizeof(threads)/sizeof(threads[0]) && ret; k++) {
+        blake2sp_parallel(digest, input, B2S_TEST_PAR, threads[k]);
+        ret = test_checkdigest(digest, exp_sp, verbose);
+        if (ret && blake2s_tree_parallel(digest, input, B2S_TEST_PAR, &P,
+                                         NULL, threads[k]) < 0)
+            ret = 0;
+        if (ret)
+            ret = test_checkdigest(digest, exp_tree, verbose);
+    }
+    free(input);
+    return ret;
+}
+
+/* blake2s_file_ex() of a temporary file of each of these sizes, under
+ * every engine, with and without O_DIRECT, at a few chunk sizes and
+ * from an unaligned stream offset, against blake2s() of the same bytes.
+ * Without a writable temporary directory there is nothing to test, and
+ * O_DIRECT is left out where the file system does not have it.
+ */
+static const size_t test_file_sizes[] = { 0, 1, 4097, (1 << 20) + 12345 };
+#define B2S_TEST_FILE_SIZES (sizeof(test_file_sizes)/sizeof(test_file_sizes[0]))
+
+/* test_file_hash: blake2s_file_ex() of `f` from `off` */
+static int test_file_hash(u8 *out, FILE *f, long off,
+                          const struct blake2s_io *io)
+{
+    if (fseek(f, off, SEEK_SET) < 0)
+        return -1;
+    return blake2s_file_ex(out, f, io);
+}
+
+/* test_file_bad: settings that blake2s_file_ex() must refuse */
+static int test_file_bad(FILE *f)
+{
+    static const struct blake2s_io bad[] = {
+        { BLAKE2S_IO_URING + 1, 0, 0 },
+        { BLAKE2S_IO_AUTO, 0, BLAKE2S_IO_CHUNK_MAX + 1 },
+        { BLAKE2S_IO_PIPE, BLAKE2S_IO_DIRECT, BLAKE2S_IO_ALIGN + 1 },
+    };
+    u8 digest[BLAKE2S_LEN];
+
+    for (unsigned i = 0; i < sizeof(bad)/sizeof(bad[0]); i++) {
+        errno = 0;
+        if (test_file_hash(digest, f, 0, &bad[i]) >= 0 || errno != EINVAL)
+            return 0;
+    }
+    return 1;
+}
+
+static int test_file(int verbose)
+{
+    static const unsigned engines[] = {
+        BLAKE2S_IO_AUTO, BLAKE2S_IO_PIPE, BLAKE2S_IO_URING
+    };
+    static const size_t chunks[] = { 0, 1000, 3 * BLAKE2S_IO_ALIGN };
+    static const size_t offs[] = { 0, 1001 };
+    const struct blake2s_io probe = { BLAKE2S_IO_AUTO, BLAKE2S_IO_DIRECT, 0 };
+    size_t max = test_file_sizes[B2S_TEST_FILE_SIZES - 1];
+    u8 exp[BLAKE2S_LEN], digest[BLAKE2S_LEN];
+    u8 *data = malloc(max);
+    int ret = 1;
+
+    if (!data)
+        return 0;
+    for (size_t i = 0; i < max; i++)
+        data[i] = i * 7 + (i >> 12);
+    for (unsigned s = 0; s < B2S_TEST_FILE_SIZES && ret; s++) {
+        size_t size = test_file_sizes[s];
+        FILE *f = tmpfile();
+        int direct;
+
+        if (!f)
+            break;
+        ret = fwrite(data, 1, size, f) == size && !fflush(f);
+        direct = ret && (test_file_hash(digest, f, 0, &probe) >= 0
+                         || errno != EINVAL);
+        for (unsigned o = 0; o < sizeof(offs)/sizeof(offs[0]) && ret; o++) {
+            size_t off = offs[o] < size ? offs[o] : size;
+            blake2s(exp, data + off, size - off);
+            for (unsigned k = 0; k < 3 * 3 * 2 && ret; k++) {
+                struct blake2s_io io = { engines[k % 3], 0, chunks[k / 3 % 3] };
+                if (k / 9) {
+                    if (!direct || io.chunk % BLAKE2S_IO_ALIGN)
+                        continue;
+                    io.flags = BLAKE2S_IO_DIRECT;
+                }
+                ret = test_file_hash(digest, f, off, &io) >= 0
+                      && test_checkdigest(digest, exp, verbose);
+            }
+        }
+        if (ret)
+            ret = test_file_bad(f);
+        fclose(f);
+    }
+    free(data);
+    return ret;
+}
+
+/* blake2s_file_tree() of a temporary file of each of these sizes, at
+ * a few thread counts, against blake2s_tree() of the same bytes */
+static const size_t test_file_tree_sizes[] = {
+    0, 1, BLAKE2S_FILE_LEAF, 2 * BLAKE2S_FILE_FANOUT * BLAKE2S_FILE_LEAF + 4097
+};
+
+static int test_file_tree(int verbose)
+{
+    static const unsigned threads[] = { 1, 2, 5 };
+    struct blake2s_param P = { BLAKE2S_LEN, 0, BLAKE2S_FILE_FANOUT,
+                               BLAKE2S_FILE_DEPTH, BLAKE2S_FILE_LEAF, 0, 0,
+                               BLAKE2S_LEN, {0}, {0}, 0 };
+    size_t max = test_file_tree_sizes[sizeof(test_file_tree_sizes)
+                                      / sizeof(test_file_tree_sizes[0]) - 1];
+    u8 exp[BLAKE2S_LEN], digest[BLAKE2S_LEN];
+    u8 *data = malloc(max);
+    int ret = 1;
+
+    if (!data)
+        return 0;
+    for (size_t i = 0; i < max; i++)
+        data[i] = i * 7 + (i >> 12);
+    for (unsigned s = 0; s < sizeof(test_file_tree_sizes)
+                             / sizeof(test_file_tree_sizes[0]) && ret; s++) {
+        size_t size = test_file_tree_sizes[s];
+        FILE *f = tmpfile();
+
+        if (!f)
+            break;
+        ret = fwrite(data, 1, size, f) == size && !fflush(f)
+              && blake2s_tree(exp, data, size, &P, NULL) == 0;
+        for (unsigned k = 0; k < sizeof(threads)/sizeof(threads[0]) && ret; k++)
+            ret = blake2s_file_tree(digest, f, threads[k]) > 0
+                  && test_checkdigest(digest, exp, verbose);
+        fclose(f);
+    }
+    free(data);
+    return ret;
+}
+
+/* BLAKE2Xs of the 256 KAT input bytes with the KAT key: BLAKE2s digest
+ * of the output for each xof_len, the last with an unknown length */
+static const unsigned blake2xs_test_len[][2] = {
+    { 1, 1 }, { 32, 32 }, { 33, 33 }, { 255, 255 }, { 1000, 1000 },
+    { BLAKE2XS_UNKNOWN, 100 },
+};
+#define B2XS_TEST_MAX 1000
+static const u8 blake2xs_test_exp[][BLAKE2S_LEN] = {
+  {
+    0xd8, 0x71, 0xd3, 0x28, 0xca, 0x5d, 0xbf, 0xd4,
+    0x2d, 0x15, 0x70, 0x8d, 0x4e, 0x63, 0x95, 0x52,
+    0x77, 0x4d, 0x34, 0xff, 0x61, 0x90, 0x5b, 0x18,
+    0x5a, 0xc4, 0xaa, 0x0d, 0x4a, 0x24, 0x45, 0x64,
+  },
+  {
+    0x89, 0xd2, 0x68, 0x89, 0xd8, 0xaf, 0xc4, 0x28,
+    0x58, 0x99, 0xd1, 0x2a, 0xb6, 0x1a, 0x8e, 0xa6,
+    0xde, 0x9c, 0x2c, 0xe1, 0x6e, 0xbe, 0x62, 0x87,
+    0x32, 0x20, 0x53, 0x79, 0xb8, 0x46, 0xf3, 0xcb,
+  },
+  {
+    0x3d, 0x9c, 0x38, 0x81, 0x94, 0x45, 0xe5, 0x4e,
+    0xc4, 0xf3, 0x54, 0xa0, 0x9e, 0xc2, 0xf8, 0x47,
+    0x59, 0xd5, 0x12, 0xa2, 0xce, 0x3f, 0x6e, 0x57,
+    0x39, 0x9f, 0xf3, 0x81, 0x55, 0xe9, 0x53, 0x93,
+  },
+  {
+    0xfe, 0x24, 0xff, 0x75, 0x81, 0x28, 0x96, 0xc3,
+    0x0c, 0x51, 0x37, 0x59, 0x96, 0x94, 0x0c, 0x50,
+    0x25, 0x41, 0x07, 0x07, 0xa6, 0x0b, 0x55, 0xf8,
+    0x4e, 0x56, 0x6b, 0x98, 0xc3, 0x47, 0x30, 0x66,
+  },
+  {
+    0xd2, 0x1b, 0x1a, 0x1b, 0x1b, 0x45, 0xc5, 0xbd,
+    0x65, 0xfb, 0x01, 0xc3, 0x80, 0xa4, 0x79, 0x85,
+    0xcb, 0x9a, 0xff, 0x0e, 0xe6, 0xc6, 0x55, 0x43,
+    0x93, 0x52, 0xe9, 0x83, 0x1f, 0x68, 0xd6, 0xf9,
+  },
+  {
+    0x92, 0xc0, 0x19, 0x0d, 0xd2, 0xde, 0xc3, 0xb9,
+    0x32, 0x8b, 0x45, 0x54, 0xf3, 0xbe, 0x68, 0x4d,
+    0x7f, 0x61, 0xaf, 0xb1, 0xc1, 0x39, 0x69, 0xf1,
+    0xdc, 0x73, 0x18, 0x35, 0x8c, 0x73, 0x74, 0x41,
+  },
+};
+
+static int test_xof(const void *input, const void *key, int verbose)
+{
+    u8 out[B2XS_TEST_MAX];
+    u8 digest[BLAKE2S_LEN];
+    int ret = 1;
+
+    for (unsigned i = 0; i < sizeof(blake2xs_test_exp)/BLAKE2S_LEN && ret; i++) {
+        struct blake2xs_ctx ctx;
+        unsigned out_len = blake2xs_test_len[i][1];
+        blake2xs_init_keyed(&ctx, key, BLAKE2S_KEY_LEN, blake2xs_test_len[i][0]);
+        blake2xs_update(&ctx, input, KAT_LENGTH);
+        if (blake2xs_final(&ctx, out, out_len) < 0)
+            return 0;
+        blake2s(digest, out, out_len);
+        ret = test_checkdigest(digest, blake2xs_test_exp[i], verbose);
+    }
+    return ret;
+}
+
+static int test_b_vec(const void *input, size_t len, const void *exp,
+                      const void *key, unsigned keylen, int verbose)
+{
+    u8 digest[BLAKE2B_LEN];
+    struct blake2b_ctx ctx;
+    memset(digest, 0, BLAKE2B_LEN);
+    if (key)
+        blake2b_init_keyed(&ctx, NULL, key, keylen, BLAKE2B_LEN);
+    else
+        blake2b_init(&ctx);
+    blake2b_update(&ctx, input, len);
+    blake2b_final(&ctx, digest);
+    return test_checkdigest_len(digest, exp, BLAKE2B_LEN, verbose);
+}
+
+static int test_bp_vec(const void *input, size_t len, const void *exp,
+                       const void *key, unsigned keylen, int verbose)
+{
+    u8 digest[BLAKE2B_LEN];
+    struct blake2bp_ctx ctx;
+    memset(digest, 0, BLAKE2B_LEN);
+    if (key)
+        blake2bp_init_keyed(&ctx, NULL, key, keylen, BLAKE2B_LEN);
+    else
+        blake2bp_init(&ctx);
+    blake2bp_update(&ctx, input, len);
+    blake2bp_final(&ctx, digest);
+    return test_checkdigest_len(digest, exp, BLAKE2B_LEN, verbose);
+}
+
+/* BLAKE2bp of B2SP_TEST_LONG bytes (i & 0xff), fed in uneven pieces */
+static const u8 blake2bp_long_exp[BLAKE2B_LEN] = {
+    0xc8, 0x9f, 0x29, 0x3a, 0xa3, 0x0f, 0xa8, 0x10,
+    0x48, 0x80, 0x7b, 0xb9, 0xbe, 0x24, 0x6a, 0xef,
+    0x37, 0x52, 0xba, 0xea, 0xe1, 0x01, 0x95, 0x13,
+    0x69, 0xbc, 0x2f, 0xd9, 0x71, 0x96, 0xf4, 0xff,
+    0x78, 0x67, 0x34, 0x8c, 0xde, 0x4c, 0xf2, 0x5c,
+    0xd4, 0xc3, 0x8f, 0x32, 0xaf, 0x12, 0x74, 0x5b,
+    0x64, 0x59, 0x3a, 0x4b, 0x1a, 0x3d, 0xfc, 0xef,
+    0x64, 0x99, 0xd1, 0x84, 0x2c, 0xc6, 0xae, 0x80,
+};
+
+static int test_bp_long(int verbose)
+{
+    static const size_t piece[] = { 1, 127, 513, 896, 897, 2047, B2SP_TEST_LONG };
+    u8 input[B2SP_TEST_LONG];
+    u8 digest[BLAKE2B_LEN];
+    int ret = 1;
+
+    for (unsigned i = 0; i < sizeof(input); i++)
+        input[i] = i;
+    for (unsigned k = 0; k < sizeof(piece)/sizeof(piece[0]) && ret; k++) {
+        struct blake2bp_ctx ctx;
+        size_t off = 0;
+        blake2bp_init(&ctx);
+        while (off < sizeof(input)) {
+            size_t n = sizeof(input) - off < piece[k] ? sizeof(input) - off
+                                                      : piece[k];
+            blake2bp_update(&ctx, input + off, n);
+            off += n;
+        }
+        blake2bp_final(&ctx, digest);
+        ret = test_checkdigest_len(digest, blake2bp_long_exp, BLAKE2B_LEN,
+                                   verbose);
+    }
+    return ret;
+}
+
+/* test_vectors: the known-answer tests, and with `full` those of the
+ * thread pool and the file engines, which take longer and write
+ * temporary files */
+static int test_vectors(int full)
 {
     int ret = 1;
     char input[KAT_LENGTH] = {0};
-    unsigned char key[BLAKE2S_KEY_LEN];
+    unsigned char key[BLAKE2B_KEY_LEN];
     for (unsigned i = 0; i < sizeof(input); i++)
         input[i] = i;
     for (unsigned i = 0; i < sizeof(key); i++)
@@ -300,18 +1124,209 @@ static int test_vectors(void)
                              key, BLAKE2S_KEY_LEN, 0);
         if (!ret) break;
     }
+    if (ret)
+        ret = test_lanes_vectors(input, NULL, 0);
+    if (ret)
+        ret = test_lanes_vectors(input, key, 0);
+    if (ret)
+        ret = test_many(input, 0);
+    if (ret)
+        ret = test_many_ctx(input, key, 0);
+    if (ret)
+        ret = test_mgr(input, 0);
+    if (ret)
+        ret = test_mac(input, key, 0);
+    if (ret)
+        ret = test_suffix(input, key, 0);
+    for (unsigned i = 0; i < KAT_LENGTH && ret; i++)
+        ret = test_sp_vec(input, i, blake2sp_kat[i], NULL, 0, 0);
+    for (unsigned i = 0; i < KAT_LENGTH && ret; i++)
+        ret = test_sp_vec(input, i, blake2sp_keyed_kat[i],
+                          key, BLAKE2S_KEY_LEN, 0);
+    if (ret)
+        ret = test_sp_long(0);
+    if (ret)
+        ret = test_tree(key, 0);
+    if (ret && full)
+        ret = test_parallel(0);
+    if (ret && full)
+        ret = test_file(0);
+    if (ret && full)
+        ret = test_file_tree(0);
+    if (ret)
+        ret = test_xof(input, key, 0);
+    for (unsigned i = 0; i < KAT_LENGTH && ret; i++)
+        ret = test_b_vec(input, i, blake2b_kat[i], NULL, 0, 0);
+    for (unsigned i = 0; i < KAT_LENGTH && ret; i++)
+        ret = test_b_vec(input, i, blake2b_keyed_kat[i],
+                         key, BLAKE2B_KEY_LEN, 0);
+    for (unsigned i = 0; i < KAT_LENGTH && ret; i++)
+        ret = test_bp_vec(input, i, blake2bp_kat[i], NULL, 0, 0);
+    for (unsigned i = 0; i < KAT_LENGTH && ret; i++)
+        ret = test_bp_vec(input, i, blake2bp_keyed_kat[i],
+                          key, BLAKE2B_KEY_LEN, 0);
+    if (ret)
+        ret = test_bp_long(0);
     return ret;
 }
 
+/* hash_file: hash `f` the way the command line asked for */
+static int hash_file(unsigned char *out, FILE *f,
+                     const struct blake2s_io *io, unsigned jobs)
+{
+    if (jobs)
+        return blake2s_file_tree(out, f, jobs);
+    return blake2s_file_ex(out, f, io);
+}
+
+/* parse_size: a byte count with an optional k or m suffix, up to
+ * `max`; 0 if bad */
+static size_t parse_size(const char *arg, size_t max)
+{
+    char *end;
+    unsigned shift = 0;
+    unsigned long n;
+
+    if (*arg < '0' || *arg > '9')
+        return 0;
+    errno = 0;
+    n = strtoul(arg, &end, 10);
+    if (errno)
+        return 0;
+    if (*end == 'k' || *end == 'K')
+        shift = 10, end++;
+    else if (*end == 'm' || *end == 'M')
+        shift = 20, end++;
+    if (*end || n > (max >> shift))
+        return 0;
+    return n << shift;
+}
+
+static void list_kernels(void)
+{
+    const struct blake2s_kernel *k;
+    const struct blake2b_kernel *kb;
+    printf("BLAKE2s (--kernel):\n");
+    for (unsigned i = 0; (k = blake2s_kernel_get(i)); i++)
+        printf("%c %s%s\n", k == blake2s_kern ? '*' : ' ', k->name,
+               (!k->usable || k->usable()) ? "" : " (unsupported by cpu)");
+    printf("BLAKE2b (--kernel-b):\n");
+    for (unsigned i = 0; (kb = blake2b_kernel_get(i)); i++)
+        printf("%c %s%s\n", kb == blake2b_kern ? '*' : ' ', kb->name,
+               (!kb->usable || kb->usable()) ? "" : " (unsupported by cpu)");
+}
+
 int main(int bjorn, char *daehlie[])
 {
-    unsigned char buf[BLAKE2S_LEN];
-    char hex[BLAKE2S_LEN*2+1];
-    if (test_vectors()) printf("Self-test ok.\n");
-    if (bjorn > 1 && !strcmp(daehlie[1], "--bench")) {
-        blake2s_bench(buf);
-        printf("%s  %s\n", hexdigest(hex, buf, BLAKE2S_LEN), "(bench)");
-        bjorn--; daehlie++;
+    unsigned char buf[BLAKE2B_LEN];
+    char hex[BLAKE2B_LEN*2+1];
+    int bench = 0, list = 0, test = 0;
+    unsigned jobs = 0; /* threads for tree mode, 0 for sequential */
+    const char *mode = "s";
+    struct blake2s_io io = { BLAKE2S_IO_AUTO, 0, 0 };
+
+    /* options come first; "--" ends them, and "-" alone is a file */
+    for (; bjorn > 1 && daehlie[1][0] == '-' && daehlie[1][1];
+         bjorn--, daehlie++) {
+        const char *opt = daehlie[1];
+        if (!strcmp(opt, "--")) {
+            bjorn--; daehlie++;
+            break;
+        } else if (!strncmp(opt, "-j", 2)) {
+            const char *arg = opt + 2;
+            char *end;
+            long n;
+            if (!*arg && bjorn > 2) {
+                arg = daehlie[2];
+                bjorn--; daehlie++;
+            }
+            n = strtol(arg, &end, 10);
+            if (!*arg || *end || n < 1 || n > 1024) {
+                fprintf(stderr, "-j: need a thread count of 1 to 1024\n");
+                return 1;
+            }
+            jobs = n;
+        } else if (!strcmp(opt, "--bench")) {
+            bench = 1;
+        } else if (!strncmp(opt, "--bench=", 8)) {
+            bench = 1;
+            mode = opt + 8;
+            if (strcmp(mode, "s") && strcmp(mode, "sp") && strcmp(mode, "b")
+                && strcmp(mode, "bp")) {
+                fprintf(stderr, "unknown bench mode: %s\n", mode);
+                return 1;
+            }
+        } else if (!strncmp(opt, "--io=", 5)) {
+            if (!strcmp(opt + 5, "auto")) {
+                io.engine = BLAKE2S_IO_AUTO;
+            } else if (!strcmp(opt + 5, "pipe")) {
+                io.engine = BLAKE2S_IO_PIPE;
+            } else if (!strcmp(opt + 5, "uring")) {
+                io.engine = BLAKE2S_IO_URING;
+            } else {
+                fprintf(stderr, "unknown io mode: %s\n", opt + 5);
+                return 1;
+            }
+        } else if (!strcmp(opt, "--direct")) {
+            io.flags |= BLAKE2S_IO_DIRECT;
+        } else if (!strncmp(opt, "--chunk=", 8)) {
+            io.chunk = parse_size(opt + 8, BLAKE2S_IO_CHUNK_MAX);
+            if (!io.chunk) {
+                fprintf(stderr, "--chunk: need a size of 1 to %uM\n",
+                        BLAKE2S_IO_CHUNK_MAX >> 20);
+                return 1;
+            }
+        } else if (!strcmp(opt, "--test")) {
+            test = 1;
+        } else if (!strcmp(opt, "--list-kernels")) {
+            list = 1;
+        } else if (!strncmp(opt, "--kernel=", 9)) {
+            if (blake2s_set_kernel(opt + 9) < 0) {
+                fprintf(stderr, "kernel %s: unknown or unsupported\n", opt + 9);
+                return 1;
+            }
+        } else if (!strncmp(opt, "--kernel-b=", 11)) {
+            if (blake2b_set_kernel(opt + 11) < 0) {
+                fprintf(stderr, "BLAKE2b kernel %s: unknown or unsupported\n",
+                        opt + 11);
+                return 1;
+            }
+        } else {
+            fprintf(stderr, "unknown option: %s\n", opt);
+            return 1;
+        }
+    }
+    if ((io.flags & BLAKE2S_IO_DIRECT) && io.chunk % BLAKE2S_IO_ALIGN) {
+        fprintf(stderr, "--chunk: need a multiple of %u with --direct\n",
+                BLAKE2S_IO_ALIGN);
+        return 1;
+    }
+    if (jobs && (io.engine != BLAKE2S_IO_AUTO || io.flags || io.chunk)) {
+        fprintf(stderr, "-j: tree mode reads on its own, "
+                "without --io, --direct or --chunk\n");
+        return 1;
+    }
+    if (list) {
+        list_kernels();
+        return 0;
+    }
+    /* the full self-test on request, or when there is nothing else to do */
+    if (test_vectors(test || (!bench && bjorn <= 1)))
+        printf("Self-test ok.\n");
+    if (bench) {
+        size_t len = BLAKE2S_LEN;
+        if (!strcmp(mode, "sp")) {
+            blake2sp_bench(buf);
+        } else if (!strcmp(mode, "b")) {
+            blake2b_bench(buf);
+            len = BLAKE2B_LEN;
+        } else if (!strcmp(mode, "bp")) {
+            blake2bp_bench(buf);
+            len = BLAKE2B_LEN;
+        } else {
+            blake2s_bench(buf);
+        }
+        printf("%s  %s\n", hexdigest(hex, buf, len), "(bench)");
     }
     while (bjorn > 1) {
         FILE *f = fopen(daehlie[1], "r");
@@ -319,7 +1334,7 @@ int main(int bjorn, char *daehlie[])
             perror("open file:");
             break;
         }
-        if (blake2s_file(buf, f))
+        if (hash_file(buf, f, &io, jobs) > 0)
             printf("%s  %s\n", hexdigest(hex, buf, BLAKE2S_LEN), daehlie[1]);
         else
             perror("hashing file:");
@@ -19,6 +19,7 @@
 #define BLAKE2S_LEN 32      /* digest length */
 #define BLAKE2S_KEY_LEN 32  /* max key length */
 #define BLAKE2S_SALT_LEN 8  /* salt length */
+#define BLAKE2S_PERSONAL_LEN 8 /* personalization length */
 #define BLAKE2S_BLOCK 64
 
 struct blake2s_ctx;
@@ -40,12 +41,202 @@ struct blake2s_ctx;
                          unsigned dig_len);
 void blake2s_init(struct blake2s_ctx *ctx);
 
+/* The parameter block, for tree hashing and personalization.
+ * Fields are as in the BLAKE2 spec; zero means the sequential default
+ * for all of them but digest_len, fanout and depth (1, 1, 1).
+ */
+struct blake2s_param {
+    unsigned digest_len;  /* 1 to BLAKE2S_LEN */
+    unsigned key_len;     /* 0 to BLAKE2S_KEY_LEN */
+    unsigned fanout;      /* 0 (unlimited) to 255 */
+    unsigned depth;       /* 1 to 255 */
+    uint32_t leaf_len;    /* 0 (unlimited) or max bytes per leaf */
+    uint64_t node_offset; /* below 2^48 */
+    unsigned node_depth;  /* 0 for leaves, to 255 */
+    unsigned inner_len;   /* 0 to BLAKE2S_LEN */
+    unsigned char salt[BLAKE2S_SALT_LEN];
+    unsigned char personal[BLAKE2S_PERSONAL_LEN];
+    int last_node;        /* rightmost node of its level */
+};
+
+/* blake2s_init_param: initialize from a full parameter block
+ * `key` must hold P->key_len bytes
+ *
+ * returns < 0 on parameter error
+ */
+ int blake2s_init_param(struct blake2s_ctx *ctx,
+                        const struct blake2s_param *P, const void *key);
+
 void blake2s_update(struct blake2s_ctx *ctx, const void *src, size_t len);
 void blake2s_final(struct blake2s_ctx *ctx, unsigned char *out);
 
 void blake2s(unsigned char *out, const void *src, size_t len);
+/* blake2s_many: blake2s() of `n` independent messages, side by side in
+ * the lanes of the multi-buffer kernel */
+void blake2s_many(unsigned char *const *outs, const void *const *srcs,
+                  const size_t *lens, size_t n);
+/* blake2s_many_ctx: update and finalize each of the `n` contexts in
+ * `ctx` with its own message, side by side as in blake2s_many. Every
+ * context keeps its own key, salt, parameters and digest length, from
+ * whichever init function set it up; it may already hold data.
+ */
+void blake2s_many_ctx(struct blake2s_ctx *ctx, unsigned char *const *outs,
+                      const void *const *srcs, const size_t *lens, size_t n);
+
+/* blake2s_clone: copy `src` to `dst`, for both to go on independently.
+ * A context holds back the last bytes it absorbed, buf_len of them and
+ * 1 to BLAKE2S_BLOCK unless it absorbed nothing, in buf: they are not
+ * compressed until more data shows they are not the final block. A
+ * clone carries them along, and so do the contexts of blake2s_many_suffix.
+ */
+void blake2s_clone(struct blake2s_ctx *dst, const struct blake2s_ctx *src);
+/* blake2s_many_suffix: finalize a copy of `prefix` with each of the `n`
+ * messages, side by side as in blake2s_many; `prefix` is left as it is.
+ * What `prefix` already compressed is shared by all of them.
+ */
+void blake2s_many_suffix(const struct blake2s_ctx *prefix,
+                         unsigned char *const *outs, const void *const *srcs,
+                         const size_t *lens, size_t n);
+
+/* Multi-buffer job manager: many streams hashed incrementally, side by
+ * side in the lanes of the multi-buffer kernel. A job absorbs `len`
+ * bytes at `src` into `ctx`, then finishes into `out`, or leaves the
+ * context open for a later job if `out` is NULL. Until a job comes back,
+ * its context and data must be left alone, and the context must not be
+ * in another job.
+ *
+ * blake2s_mgr_submit: hand `job` over; returns a completed job, or NULL
+ * if none is. Lanes only run once they are all taken.
+ * blake2s_mgr_flush: run the lanes until a job completes and return it;
+ * returns NULL once the manager is empty.
+ * blake2s_mgr_new returns NULL when out of memory. A manager keeps the
+ * kernel selected when it was created.
+ */
+struct blake2s_mgr;
+struct blake2s_mgr_job;
+
+struct blake2s_mgr *blake2s_mgr_new(void);
+void blake2s_mgr_free(struct blake2s_mgr *M);
+struct blake2s_mgr_job *blake2s_mgr_submit(struct blake2s_mgr *M,
+                                           struct blake2s_mgr_job *job);
+struct blake2s_mgr_job *blake2s_mgr_flush(struct blake2s_mgr *M);
+
+/* Keyed MAC with the key block compressed once, ahead of time.
+ *
+ * blake2s_mac_key_init: set up `K` with the arguments of
+ * blake2s_init_keyed; it then holds no copy of the key itself.
+ * returns < 0 on parameter error
+ * blake2s_mac_init: start a MAC under `K`, to feed with blake2s_update
+ * and finish with blake2s_mac_final or blake2s_final, or to pass to
+ * blake2s_many_ctx or the job manager like any other context.
+ * blake2s_mac: the MAC of `len` bytes at `src` under `K`
+ */
+struct blake2s_mac_key;
+
+ int blake2s_mac_key_init(struct blake2s_mac_key *K, const void *salt,
+                          const void *key, unsigned key_len, unsigned dig_len);
+void blake2s_mac_init(struct blake2s_ctx *ctx, const struct blake2s_mac_key *K);
+void blake2s_mac_final(struct blake2s_ctx *ctx, const struct blake2s_mac_key *K,
+                       unsigned char *out);
+void blake2s_mac(unsigned char *out, const struct blake2s_mac_key *K,
+                 const void *src, size_t len);
+
  int blake2s_file(unsigned char *out, FILE *stream);
 
+/* File I/O settings for blake2s_file_ex()
+ *
+ * `engine` BLAKE2S_IO_AUTO maps regular files and reads others;
+ *          BLAKE2S_IO_PIPE reads ahead in another thread while the
+ *          caller hashes, to overlap slow disks or pipes with the
+ *          compression; BLAKE2S_IO_URING keeps several large reads of a
+ *          regular file in flight through io_uring, for fast storage,
+ *          and is BLAKE2S_IO_PIPE where that is not available
+ * `flags`  BLAKE2S_IO_DIRECT reads regular files with O_DIRECT, around
+ *          the page cache; AUTO then reads instead of mapping
+ * `chunk`  bytes per read, up to BLAKE2S_IO_CHUNK_MAX and a multiple of
+ *          BLAKE2S_IO_ALIGN with BLAKE2S_IO_DIRECT; 0 for the default
+ */
+#define BLAKE2S_IO_AUTO  0
+#define BLAKE2S_IO_PIPE  1
+#define BLAKE2S_IO_URING 2
+
+#define BLAKE2S_IO_DIRECT 1
+
+#define BLAKE2S_IO_ALIGN     4096
+#define BLAKE2S_IO_CHUNK_MAX (256 << 20)
+
+struct blake2s_io {
+    unsigned engine;
+    unsigned flags;
+    size_t chunk;
+};
+
+/* blake2s_file_ex: blake2s_file() with the I/O set up by `io`, or the
+ * defaults for NULL
+ * returns < 0 on error, with errno set: EINVAL for bad settings, or
+ * where the file system does not support O_DIRECT
+ */
+ int blake2s_file_ex(unsigned char *out, FILE *stream,
+                     const struct blake2s_io *io);
+/* blake2s_file_pipelined, blake2s_file_async: blake2s_file_ex() with
+ * BLAKE2S_IO_PIPE and BLAKE2S_IO_URING */
+ int blake2s_file_pipelined(unsigned char *out, FILE *stream);
+ int blake2s_file_async(unsigned char *out, FILE *stream);
+
+/* Tree hashing: level 0 cuts the input into leaves of P->leaf_len
+ * bytes, and each node above hashes the inner digests (P->inner_len
+ * bytes) of up to P->fanout consecutive nodes of the level below. The
+ * root, at node depth P->depth - 1, hashes all of the level below it.
+ * Node offsets count from 0 within each level, and the rightmost node
+ * of every level is a last node. Requires fanout >= 2, depth >= 2,
+ * leaf_len >= 1 and inner_len >= 1.
+ *
+ * blake2s_tree: hash `src` into P->digest_len bytes at `out`;
+ * P->node_offset, node_depth and last_node are ignored.
+ * returns < 0 on parameter or allocation error
+ */
+ int blake2s_tree(unsigned char *out, const void *src, size_t len,
+                  const struct blake2s_param *P, const void *key);
+/* blake2s_tree_parallel: blake2s_tree() with the nodes of each level
+ * shared out to `nthreads` threads of a worker pool that persists
+ * between calls. The digest does not depend on `nthreads`.
+ * returns < 0 on parameter or allocation error
+ */
+ int blake2s_tree_parallel(unsigned char *out, const void *src, size_t len,
+                           const struct blake2s_param *P, const void *key,
+                           unsigned nthreads);
+/* blake2s_tree_nodes: hash consecutive nodes of level P->node_depth,
+ * the first at P->node_offset, into inner digests at `out`. `src` is
+ * the input data for leaves, the child digests otherwise. The last of
+ * them is a last node if P->last_node is set. To rehash a changed
+ * subtree, run it on the nodes above the change only.
+ * returns the number of nodes hashed, 0 on parameter error
+ */
+size_t blake2s_tree_nodes(unsigned char *out, const void *src, size_t len,
+                          const struct blake2s_param *P, const void *key);
+
+/* blake2s_file_tree: hash a regular file with `nthreads` threads, as
+ * blake2s_tree() with BLAKE2S_FILE_LEAF-byte leaves, fanout
+ * BLAKE2S_FILE_FANOUT and depth BLAKE2S_FILE_DEPTH, or one more for
+ * each time the file is BLAKE2S_FILE_FANOUT times too large for the
+ * root to have at most BLAKE2S_FILE_FANOUT children (above 1 GiB, then
+ * 128 GiB, ...). The digest is the same for any number of threads.
+ * returns < 0 on error, with errno set
+ */
+#define BLAKE2S_FILE_LEAF   (64 << 10)
+#define BLAKE2S_FILE_FANOUT 128
+#define BLAKE2S_FILE_DEPTH  3
+ int blake2s_file_tree(unsigned char *out, FILE *stream, unsigned nthreads);
+
+/* blake2s_set_kernel: select the compression kernel by name
+ * ("generic", "sse", "avx2", ...), or the fastest usable one for NULL.
+ * The default is taken from the BLAKE2S_KERNEL environment variable.
+ *
+ * returns < 0 if the kernel is unknown or this CPU cannot run it
+ */
+ int blake2s_set_kernel(const char *name);
+const char *blake2s_get_kernel(void);
+
 
 #ifdef __GNUC__
 #define ALIGN(x) __attribute__((aligned(x)))
@@ -60,7 +251,23 @@ struct blake2s_ctx {
     uint32_t f[2];
     unsigned buf_len;
     unsigned digest_len;
+    unsigned last_node; /* tree hashing: set f[1] with the final block */
 } ALIGN(16);
 
+struct blake2s_mac_key {
+    uint32_t H[8];                      /* after the key block */
+    unsigned char empty[BLAKE2S_LEN];   /* MAC of the empty message */
+    unsigned digest_len;
+};
+
+struct blake2s_mgr_job {
+    struct blake2s_ctx *ctx;
+    const void *src;
+    size_t len;
+    unsigned char *out;
+    void *user;                     /* for the caller */
+    struct blake2s_mgr_job *next;   /* private */
+};
+
 #endif /* BLAKE2S_H_ */
 
@@ -0,0 +1,219 @@
+#include <string.h>
+
+#include "blake2s.h"
+#include "blake2sp.h"
+#include "blake2s-internal.h"
+
+/* BLAKE2sp
+ *
+ * Leaf i is a BLAKE2s node with fanout 8, depth 2, node offset i and
+ * node depth 0, and hashes blocks i, i+8, i+16, ... of the input. The
+ * root has node depth 1. The last leaf and the root are last nodes.
+ *
+ * Each stride compresses one block in every leaf with a single call
+ * to the multi-buffer kernel, straight from the input.
+ */
+#define BSP_LEAVES BLAKE2SP_LEAVES
+#define BSP_STRIDE BLAKE2SP_STRIDE
+#define BSP_HOLD   BLAKE2SP_BUF
+#define BSP_ALL    ((1u << BSP_LEAVES) - 1)
+
+#define BSP_PARAM0(dlen,klen) LE32W(dlen,klen,BSP_LEAVES,2)
+
+static int bsp_init(struct blake2sp_ctx *ctx, const void *salt,
+                    const void *key, unsigned key_len, unsigned dig_len)
+{
+    u32 P[B2S_PARAM_WORDS] = { BSP_PARAM0(dig_len,key_len), 0, 0,
+                               B2S_PARAM3(0, 1, BLAKE2S_LEN) };
+
+    if (key_len > BLAKE2S_KEY_LEN)
+        return -1;
+    if (dig_len < 1 || dig_len > BLAKE2S_LEN)
+        return -1;
+
+    /* only the leaves absorb the key; the root just has its length */
+    blake2s_init_words(&ctx->R, P, salt, NULL, NULL, 0);
+    ctx->R.last_node = 1;
+    P[3] = B2S_PARAM3(0, 0, BLAKE2S_LEN);
+    for (unsigned i = 0; i < BSP_LEAVES; i++) {
+        P[2] = i;
+        blake2s_init_words(&ctx->S[i], P, salt, NULL, key, key_len);
+        ctx->S[i].digest_len = BLAKE2S_LEN; /* inner length */
+    }
+    ctx->S[BSP_LEAVES-1].last_node = 1;
+    ctx->buf_len = 0;
+    return 0;
+}
+
+int blake2sp_init_keyed(struct blake2sp_ctx *ctx, const void *salt,
+                        const void *key, unsigned key_len, unsigned dig_len)
+{
+    if (key_len < 1)
+        return -1;
+    return bsp_init(ctx, salt, key, key_len, dig_len);
+}
+
+int blake2sp_init_salted(struct blake2sp_ctx *ctx, const void *salt,
+                         unsigned dig_len)
+{
+    return bsp_init(ctx, salt, NULL, 0, dig_len);
+}
+
+void blake2sp_init(struct blake2sp_ctx *ctx)
+{
+    bsp_init(ctx, NULL, NULL, 0, BLAKE2S_LEN);
+}
+
+/* bsp_strides: compress `n` strides at `src` into the leaves, none of
+ * them final */
+static void bsp_strides(struct blake2sp_ctx *ctx, const u8 *src, size_t n)
+{
+    struct blake2s_lanes L;
+    const void *m[BSP_LEAVES];
+
+    for (unsigned i = 0; i < BSP_LEAVES; i++)
+        blane_load(&L, i, &ctx->S[i]);
+    /* keyed leaves hold their key block until now */
+    if (ctx->S[0].buf_len) {
+        for (unsigned i = 0; i < BSP_LEAVES; i++) {
+            m[i] = ctx->S[i].buf;
+            ctx->S[i].buf_len = 0;
+            blane_inc_t(&L, i, BLAKE2S_BLOCK);
+        }
+        blake2s_compress_lanes(&L, m, BSP_ALL);
+    }
+    for (; n; n--, src += BSP_STRIDE) {
+        for (unsigned i = 0; i < BSP_LEAVES; i++) {
+            m[i] = src + i*BLAKE2S_BLOCK;
+            blane_inc_t(&L, i, BLAKE2S_BLOCK);
+        }
+        blake2s_compress_lanes(&L, m, BSP_ALL);
+    }
+    for (unsigned i = 0; i < BSP_LEAVES; i++)
+        blane_store(&L, i, &ctx->S[i]);
+    memset(&L, 0, sizeof(L));
+}
+
+void blake2sp_update(struct blake2sp_ctx *ctx, const void *src, size_t len)
+{
+    const u8 *in = src;
+
+    /* strides through the buffer, while it has any */
+    while (ctx->buf_len && ctx->buf_len + len > BSP_HOLD) {
+        if (ctx->buf_len < BSP_STRIDE) {
+            size_t fill = BSP_STRIDE - ctx->buf_len;
+            memcpy(ctx->buf + ctx->buf_len, in, fill);
+            ctx->buf_len = BSP_STRIDE;
+            in += fill;
+            len -= fill;
+        }
+        bsp_strides(ctx, ctx->buf, 1);
+        ctx->buf_len -= BSP_STRIDE;
+        memmove(ctx->buf, ctx->buf + BSP_STRIDE, ctx->buf_len);
+    }
+    /* then straight from `src`, in one run, holding back the tail */
+    if (!ctx->buf_len && len > BSP_HOLD) {
+        size_t n = (len - BSP_HOLD - 1) / BSP_STRIDE + 1;
+        bsp_strides(ctx, in, n);
+        in += n * BSP_STRIDE;
+        len -= n * BSP_STRIDE;
+    }
+    memcpy(ctx->buf + ctx->buf_len, in, len);
+    ctx->buf_len += len;
+}
+
+/* bsp_slice: length of block `j` of the `len` buffered bytes */
+static size_t bsp_slice(size_t len, unsigned j)
+{
+    if (len <= j*BLAKE2S_BLOCK)
+        return 0;
+    len -= j*BLAKE2S_BLOCK;
+    return len < BLAKE2S_BLOCK ? len : BLAKE2S_BLOCK;
+}
+
+void blake2sp_final(struct blake2sp_ctx *ctx, unsigned char *out)
+{
+    u8 hash[BSP_LEAVES][BLAKE2S_LEN];
+    struct blake2s_job job[BSP_LEAVES];
+
+    /* leaf i has up to two buffered blocks left: i and i+8 */
+    for (unsigned i = 0; i < BSP_LEAVES; i++) {
+        job[i].ctx = &ctx->S[i];
+        job[i].src = ctx->buf + i*BLAKE2S_BLOCK;
+        job[i].len = bsp_slice(ctx->buf_len, i);
+        job[i].out = NULL;
+    }
+    blake2s_lanes_run(job, BSP_LEAVES);
+    for (unsigned i = 0; i < BSP_LEAVES; i++) {
+        job[i].ctx = &ctx->S[i];
+        job[i].src = ctx->buf + (i + BSP_LEAVES)*BLAKE2S_BLOCK;
+        job[i].len = bsp_slice(ctx->buf_len, i + BSP_LEAVES);
+        job[i].out = hash[i];
+    }
+    blake2s_lanes_run(job, BSP_LEAVES);
+
+    blake2s_update(&ctx->R, hash, sizeof(hash));
+    blake2s_final(&ctx->R, out);
+    memset(hash, 0, sizeof(hash));
+    memset(ctx, 0, sizeof(*ctx));
+}
+
+/* Parallel BLAKE2sp
+ *
+ * A leaf is a chain through the whole input, so at most BSP_LEAVES
+ * threads can share the strides that blake2sp_update() would hash
+ * straight from the input: task k runs leaves k, k+g, ... through the
+ * single-block kernel, and the tail then goes through the buffer as
+ * usual. A multi-buffer kernel is far ahead of that: 256 MiB take
+ * 0.17 s through the AVX-512 lanes and 0.77 s leaf by leaf, so a
+ * leaf alone costs about 4.6 lane calls. With such a kernel, only a
+ * thread per leaf beats a single thread, and by less than 2x; fewer
+ * threads stay on the lanes. blake2s_tree_parallel() scales better.
+ */
+
+struct bsp_par {
+    struct blake2sp_ctx *ctx;
+    const u8 *src;
+    size_t n;       /* strides */
+    unsigned g;     /* tasks */
+};
+
+static void bsp_par_leaves(void *arg, size_t k)
+{
+    struct bsp_par *J = arg;
+    for (size_t i = k; i < BSP_LEAVES; i += J->g) {
+        const u8 *p = J->src + i*BLAKE2S_BLOCK;
+        for (size_t s = 0; s < J->n; s++, p += BSP_STRIDE)
+            blake2s_compress_blocks(&J->ctx->S[i], p, 1);
+    }
+}
+
+void blake2sp_parallel(unsigned char *out, const void *src, size_t len,
+                       unsigned nthreads)
+{
+    struct blake2sp_ctx ctx;
+    struct bsp_par J;
+
+    blake2sp_init(&ctx);
+    J.g = nthreads < BSP_LEAVES ? nthreads : BSP_LEAVES;
+    if (blake2s_kern->lanes > 1 && J.g < BSP_LEAVES)
+        J.g = 1;
+    if (J.g > 1 && len > BSP_HOLD) {
+        J.ctx = &ctx;
+        J.src = src;
+        J.n = (len - BSP_HOLD - 1) / BSP_STRIDE + 1;
+        blake2s_pool_run(J.g, J.g, bsp_par_leaves, &J);
+        src = J.src + J.n * BSP_STRIDE;
+        len -= J.n * BSP_STRIDE;
+    }
+    blake2sp_update(&ctx, src, len);
+    blake2sp_final(&ctx, out);
+}
+
+void blake2sp(unsigned char *out, const void *src, size_t len)
+{
+    struct blake2sp_ctx ctx;
+    blake2sp_init(&ctx);
+    blake2sp_update(&ctx, src, len);
+    blake2sp_final(&ctx, out);
+}
@@ -0,0 +1,58 @@
+#ifndef BLAKE2SP_H_
+#define BLAKE2SP_H_
+
+#include "blake2s.h"
+
+/* BLAKE2sp: the input is dealt out in 64-byte blocks, round-robin, to
+ * 8 BLAKE2s leaves hashed side by side; a root hashes their digests.
+ * Parameters are as for BLAKE2s, and so is the digest length.
+ */
+#define BLAKE2SP_LEAVES 8
+
+struct blake2sp_ctx;
+
+/* blake2sp_init_keyed: initialize BLAKE2sp with key
+ *
+ * `salt`    must be NULL or BLAKE2S_SALT_LEN bytes
+ * `key_len` must be 1 to BLAKE2S_KEY_LEN
+ * `dig_len` must be 1 to BLAKE2S_LEN
+ *
+ * returns < 0 on parameter error
+ */
+ int blake2sp_init_keyed(struct blake2sp_ctx *ctx, const void *salt,
+                         const void *key, unsigned key_len, unsigned dig_len);
+/* blake2sp_init_salted: like blake2sp_init_keyed
+ * returns < 0 on parameter error
+ */
+ int blake2sp_init_salted(struct blake2sp_ctx *ctx, const void *salt,
+                          unsigned dig_len);
+void blake2sp_init(struct blake2sp_ctx *ctx);
+
+void blake2sp_update(struct blake2sp_ctx *ctx, const void *src, size_t len);
+void blake2sp_final(struct blake2sp_ctx *ctx, unsigned char *out);
+
+void blake2sp(unsigned char *out, const void *src, size_t len);
+/* blake2sp_parallel: blake2sp() on up to `nthreads` threads of a
+ * worker pool that persists between calls; the digest is the same.
+ * With a multi-buffer kernel, it needs BLAKE2SP_LEAVES threads to go
+ * parallel at all; blake2s_tree_parallel() scales with any number.
+ */
+void blake2sp_parallel(unsigned char *out, const void *src, size_t len,
+                       unsigned nthreads);
+
+
+/* One stride deals a block to every leaf. A stride is only hashed once
+ * the input goes at least one byte into the next one for every leaf,
+ * so the buffer holds back up to a stride and all but one block.
+ */
+#define BLAKE2SP_STRIDE (BLAKE2SP_LEAVES * BLAKE2S_BLOCK)
+#define BLAKE2SP_BUF    (2 * BLAKE2SP_STRIDE - BLAKE2S_BLOCK)
+
+struct blake2sp_ctx {
+    struct blake2s_ctx S[BLAKE2SP_LEAVES];
+    struct blake2s_ctx R;
+    unsigned char buf[BLAKE2SP_BUF];
+    unsigned buf_len;
+} ALIGN(16);
+
+#endif /* BLAKE2SP_H_ */
@@ -0,0 +1,13229 @@
+	.file	"blake2sp.c"
+# GNU C99 (Debian 12.2.0-14+deb12u1) version 12.2.0 (x86_64-linux-gnu)
+#	compiled by GNU C version 12.2.0, GMP version 6.2.1, MPFR version 4.2.0, MPC version 1.3.1, isl version isl-0.25-GMP
+
+# GGC heuristics: --param ggc-min-expand=100 --param ggc-min-heapsize=131072
+# options passed: -mtune=generic -march=x86-64 -g -O3 -std=c99 -fasynchronous-unwind-tables
+	.text
+.Ltext0:
+	.file 0 "/root/repo" "blake2sp.c"
+	.p2align 4
+	.type	bsp_strides, @function
+bsp_strides:
+.LVL0:
+.LFB21:
+	.file 1 "blake2sp.c"
+	.loc 1 70 1 view -0
+	.cfi_startproc
+	.loc 1 71 5 view .LVU1
+	.loc 1 72 5 view .LVU2
+	.loc 1 74 5 view .LVU3
+.LBB35:
+	.loc 1 74 10 view .LVU4
+	.loc 1 74 28 view .LVU5
+.LBB36:
+.LBB37:
+.LBB38:
+	.file 2 "blake2s-internal.h"
+	.loc 2 186 28 view .LVU6
+	.loc 2 187 9 view .LVU7
+.LBE38:
+.LBE37:
+.LBE36:
+.LBE35:
+# blake2sp.c:70: {
+	.loc 1 70 1 is_stmt 0 view .LVU8
+	pushq	%rbp	#
+	.cfi_def_cfa_offset 16
+	.cfi_offset 6, -16
+	movq	%rsp, %rbp	#,
+	.cfi_def_cfa_register 6
+	pushq	%r15	#
+	pushq	%r14	#
+	pushq	%r13	#
+	.cfi_offset 15, -24
+	.cfi_offset 14, -32
+	.cfi_offset 13, -40
+	movq	%rdx, %r13	# tmp630, n
+	pushq	%r12	#
+	.cfi_offset 12, -48
+	movq	%rsi, %r12	# tmp629, src
+	pushq	%rbx	#
+	.cfi_offset 3, -56
+	movq	%rdi, %rbx	# tmp628, ctx
+	andq	$-64, %rsp	#,
+	subq	$1408, %rsp	#,
+.LBB61:
+.LBB55:
+.LBB49:
+.LBB39:
+# blake2s-internal.h:187:         L->H[i][l] = ctx->H[i];
+	.loc 2 187 28 view .LVU9
+	movdqa	96(%rdi), %xmm10	# MEM <const vector(4) unsigned int> [(const struct blake2s_ctx *)ctx_19(D) + 96B], vect__244.94
+	movdqa	(%rdi), %xmm0	# MEM <const vector(4) unsigned int> [(const struct blake2s_ctx *)ctx_19(D)], vect__244.88
+	movdqa	32(%rdi), %xmm9	# MEM <const vector(4) unsigned int> [(const struct blake2s_ctx *)ctx_19(D) + 32B], vect__244.90
+	movdqa	64(%rdi), %xmm8	# MEM <const vector(4) unsigned int> [(const struct blake2s_ctx *)ctx_19(D) + 64B], vect__244.92
+	movdqa	128(%rdi), %xmm6	# MEM <const vector(4) unsigned int> [(const struct blake2s_ctx *)ctx_19(D) + 128B], vect__244.96
+	movdqa	160(%rdi), %xmm5	# MEM <const vector(4) unsigned int> [(const struct blake2s_ctx *)ctx_19(D) + 160B], vect__244.98
+	movdqa	%xmm0, %xmm15	# vect__244.88, vect_perm_even_542
+	shufps	$221, 16(%rdi), %xmm0	#, MEM <const vector(4) unsigned int> [(const struct blake2s_ctx *)ctx_19(D) + 16B], vect_perm_odd_543
+	movdqa	192(%rdi), %xmm3	# MEM <const vector(4) unsigned int> [(const struct blake2s_ctx *)ctx_19(D) + 192B], vect__244.100
+	movdqa	224(%rdi), %xmm1	# MEM <const vector(4) unsigned int> [(const struct blake2s_ctx *)ctx_19(D) + 224B], vect__244.102
+	shufps	$136, 16(%rdi), %xmm15	#, MEM <const vector(4) unsigned int> [(const struct blake2s_ctx *)ctx_19(D) + 16B], vect_perm_even_542
+	movdqa	%xmm9, %xmm13	# vect__244.90, vect_perm_even_544
+	movdqa	256(%rdi), %xmm2	# MEM <const vector(4) unsigned int> [(const struct blake2s_ctx *)ctx_19(D) + 256B], vect__244.104
+	movdqa	288(%rdi), %xmm4	# MEM <const vector(4) unsigned int> [(const struct blake2s_ctx *)ctx_19(D) + 288B], vect__244.106
+	shufps	$136, 48(%rdi), %xmm13	#, MEM <const vector(4) unsigned int> [(const struct blake2s_ctx *)ctx_19(D) + 48B], vect_perm_even_544
+	shufps	$221, 48(%rdi), %xmm9	#, MEM <const vector(4) unsigned int> [(const struct blake2s_ctx *)ctx_19(D) + 48B], vect__244.90
+	movdqa	320(%rdi), %xmm11	# MEM <const vector(4) unsigned int> [(const struct blake2s_ctx *)ctx_19(D) + 320B], vect__244.108
+	movdqa	%xmm8, %xmm14	# vect__244.92, vect_perm_even_546
+	movdqa	384(%rdi), %xmm7	# MEM <const vector(4) unsigned int> [(const struct blake2s_ctx *)ctx_19(D) + 384B], vect__244.112
+	shufps	$136, 80(%rdi), %xmm14	#, MEM <const vector(4) unsigned int> [(const struct blake2s_ctx *)ctx_19(D) + 80B], vect_perm_even_546
+	shufps	$221, 80(%rdi), %xmm8	#, MEM <const vector(4) unsigned int> [(const struct blake2s_ctx *)ctx_19(D) + 80B], vect__244.92
+	movdqa	%xmm6, %xmm12	# vect__244.96, vect_perm_even_550
+	movaps	%xmm15, 560(%rsp)	# vect_perm_even_542, %sfp
+	movdqa	%xmm10, %xmm15	# vect__244.94, vect__244.94
+	movaps	%xmm13, 544(%rsp)	# vect_perm_even_544, %sfp
+	shufps	$221, 112(%rdi), %xmm15	#, MEM <const vector(4) unsigned int> [(const struct blake2s_ctx *)ctx_19(D) + 112B], vect__244.94
+	movdqa	%xmm10, %xmm13	# vect__244.94, vect_perm_even_548
+	shufps	$136, 112(%rdi), %xmm13	#, MEM <const vector(4) unsigned int> [(const struct blake2s_ctx *)ctx_19(D) + 112B], vect_perm_even_548
+	movaps	%xmm9, 368(%rsp)	# vect__244.90, %sfp
+	movdqa	%xmm1, %xmm9	# vect__244.102, vect_perm_even_556
+	movaps	%xmm8, 352(%rsp)	# vect__244.92, %sfp
+	movdqa	%xmm5, %xmm8	# vect__244.98, vect_perm_even_552
+	movaps	%xmm15, 336(%rsp)	# vect__244.94, %sfp
+	shufps	$136, 144(%rdi), %xmm12	#, MEM <const vector(4) unsigned int> [(const struct blake2s_ctx *)ctx_19(D) + 144B], vect_perm_even_550
+	shufps	$136, 240(%rdi), %xmm9	#, MEM <const vector(4) unsigned int> [(const struct blake2s_ctx *)ctx_19(D) + 240B], vect_perm_even_556
+	shufps	$221, 144(%rdi), %xmm6	#, MEM <const vector(4) unsigned int> [(const struct blake2s_ctx *)ctx_19(D) + 144B], vect_perm_odd_551
+	shufps	$221, 176(%rdi), %xmm5	#, MEM <const vector(4) unsigned int> [(const struct blake2s_ctx *)ctx_19(D) + 176B], vect__244.98
+	shufps	$136, 176(%rdi), %xmm8	#, MEM <const vector(4) unsigned int> [(const struct blake2s_ctx *)ctx_19(D) + 176B], vect_perm_even_552
+	shufps	$221, 240(%rdi), %xmm1	#, MEM <const vector(4) unsigned int> [(const struct blake2s_ctx *)ctx_19(D) + 240B], vect__244.102
+	movdqa	416(%rdi), %xmm15	# MEM <const vector(4) unsigned int> [(const struct blake2s_ctx *)ctx_19(D) + 416B], vect_perm_even_568
+	movaps	%xmm8, 496(%rsp)	# vect_perm_even_552, %sfp
+	shufps	$136, 432(%rdi), %xmm15	#, MEM <const vector(4) unsigned int> [(const struct blake2s_ctx *)ctx_19(D) + 432B], vect_perm_even_568
+	movaps	%xmm5, 320(%rsp)	# vect__244.98, %sfp
+	movdqa	%xmm3, %xmm5	# vect__244.100, vect_perm_even_554
+	shufps	$221, 208(%rdi), %xmm3	#, MEM <const vector(4) unsigned int> [(const struct blake2s_ctx *)ctx_19(D) + 208B], vect_perm_odd_555
+	shufps	$136, 208(%rdi), %xmm5	#, MEM <const vector(4) unsigned int> [(const struct blake2s_ctx *)ctx_19(D) + 208B], vect_perm_even_554
+	movaps	%xmm1, 304(%rsp)	# vect__244.102, %sfp
+	movdqa	%xmm5, %xmm10	# vect_perm_even_554, vect_perm_even_554
+	movdqa	352(%rdi), %xmm1	# MEM <const vector(4) unsigned int> [(const struct blake2s_ctx *)ctx_19(D) + 352B], vect_perm_odd_565
+	movdqa	%xmm2, %xmm5	# vect__244.104, vect_perm_even_558
+	shufps	$221, 368(%rdi), %xmm1	#, MEM <const vector(4) unsigned int> [(const struct blake2s_ctx *)ctx_19(D) + 368B], vect_perm_odd_565
+	shufps	$136, 272(%rdi), %xmm5	#, MEM <const vector(4) unsigned int> [(const struct blake2s_ctx *)ctx_19(D) + 272B], vect_perm_even_558
+	shufps	$221, 272(%rdi), %xmm2	#, MEM <const vector(4) unsigned int> [(const struct blake2s_ctx *)ctx_19(D) + 272B], vect_perm_odd_559
+	movdqa	%xmm5, %xmm8	# vect_perm_even_558, vect_perm_even_558
+	movaps	%xmm1, 272(%rsp)	# vect_perm_odd_565, %sfp
+	movdqa	%xmm4, %xmm5	# vect__244.106, vect_perm_even_560
+	movdqa	416(%rdi), %xmm1	# MEM <const vector(4) unsigned int> [(const struct blake2s_ctx *)ctx_19(D) + 416B], vect_perm_odd_569
+	shufps	$136, 304(%rdi), %xmm5	#, MEM <const vector(4) unsigned int> [(const struct blake2s_ctx *)ctx_19(D) + 304B], vect_perm_even_560
+	shufps	$221, 304(%rdi), %xmm4	#, MEM <const vector(4) unsigned int> [(const struct blake2s_ctx *)ctx_19(D) + 304B], vect__244.106
+	movaps	%xmm5, 448(%rsp)	# vect_perm_even_560, %sfp
+	shufps	$221, 432(%rdi), %xmm1	#, MEM <const vector(4) unsigned int> [(const struct blake2s_ctx *)ctx_19(D) + 432B], vect_perm_odd_569
+	movdqa	%xmm11, %xmm5	# vect__244.108, vect_perm_even_562
+	movaps	%xmm4, 288(%rsp)	# vect__244.106, %sfp
+	shufps	$136, 336(%rdi), %xmm5	#, MEM <const vector(4) unsigned int> [(const struct blake2s_ctx *)ctx_19(D) + 336B], vect_perm_even_562
+	shufps	$221, 336(%rdi), %xmm11	#, MEM <const vector(4) unsigned int> [(const struct blake2s_ctx *)ctx_19(D) + 336B], vect_perm_odd_563
+	movdqa	352(%rdi), %xmm4	# MEM <const vector(4) unsigned int> [(const struct blake2s_ctx *)ctx_19(D) + 352B], vect_perm_even_564
+	movaps	%xmm15, 416(%rsp)	# vect_perm_even_568, %sfp
+	shufps	$136, 368(%rdi), %xmm4	#, MEM <const vector(4) unsigned int> [(const struct blake2s_ctx *)ctx_19(D) + 368B], vect_perm_even_564
+	movaps	%xmm4, 432(%rsp)	# vect_perm_even_564, %sfp
+	movdqa	%xmm7, %xmm4	# vect__244.112, vect_perm_even_566
+	shufps	$221, 400(%rdi), %xmm7	#, MEM <const vector(4) unsigned int> [(const struct blake2s_ctx *)ctx_19(D) + 400B], vect_perm_odd_567
+	shufps	$136, 400(%rdi), %xmm4	#, MEM <const vector(4) unsigned int> [(const struct blake2s_ctx *)ctx_19(D) + 400B], vect_perm_even_566
+	movaps	%xmm1, 256(%rsp)	# vect_perm_odd_569, %sfp
+	movdqa	448(%rdi), %xmm1	# MEM <const vector(4) unsigned int> [(const struct blake2s_ctx *)ctx_19(D) + 448B], vect_perm_even_570
+	movdqa	448(%rdi), %xmm15	# MEM <const vector(4) unsigned int> [(const struct blake2s_ctx *)ctx_19(D) + 448B], vect_perm_odd_571
+	shufps	$221, 464(%rdi), %xmm15	#, MEM <const vector(4) unsigned int> [(const struct blake2s_ctx *)ctx_19(D) + 464B], vect_perm_odd_571
+	movaps	%xmm15, 240(%rsp)	# vect_perm_odd_571, %sfp
+	shufps	$136, 464(%rdi), %xmm1	#, MEM <const vector(4) unsigned int> [(const struct blake2s_ctx *)ctx_19(D) + 464B], vect_perm_even_570
+	movdqa	480(%rdi), %xmm15	# MEM <const vector(4) unsigned int> [(const struct blake2s_ctx *)ctx_19(D) + 480B], vect_perm_even_572
+	shufps	$136, 496(%rdi), %xmm15	#, MEM <const vector(4) unsigned int> [(const struct blake2s_ctx *)ctx_19(D) + 496B], vect_perm_even_572
+	movaps	%xmm15, 400(%rsp)	# vect_perm_even_572, %sfp
+	movdqa	480(%rdi), %xmm15	# MEM <const vector(4) unsigned int> [(const struct blake2s_ctx *)ctx_19(D) + 480B], vect_perm_odd_573
+	shufps	$221, 496(%rdi), %xmm15	#, MEM <const vector(4) unsigned int> [(const struct blake2s_ctx *)ctx_19(D) + 496B], vect_perm_odd_573
+	movaps	%xmm15, 224(%rsp)	# vect_perm_odd_573, %sfp
+	movdqa	560(%rsp), %xmm15	# %sfp, vect_perm_even_574
+	shufps	$136, 544(%rsp), %xmm15	#, %sfp, vect_perm_even_574
+	movaps	%xmm15, 528(%rsp)	# vect_perm_even_574, %sfp
+	movdqa	560(%rsp), %xmm15	# %sfp, vect_perm_even_542
+	shufps	$221, 544(%rsp), %xmm15	#, %sfp, vect_perm_even_542
+	movaps	%xmm15, 560(%rsp)	# vect_perm_even_542, %sfp
+	movdqa	%xmm14, %xmm15	# vect_perm_even_546, vect_perm_even_576
+	shufps	$221, %xmm13, %xmm14	#, vect_perm_even_548, vect_perm_even_546
+	movaps	%xmm14, 512(%rsp)	# vect_perm_even_546, %sfp
+	shufps	$136, %xmm13, %xmm15	#, vect_perm_even_548, vect_perm_even_576
+	movdqa	496(%rsp), %xmm14	# %sfp, vect_perm_even_552
+	movdqa	%xmm12, %xmm13	# vect_perm_even_550, vect_perm_even_578
+	movaps	%xmm15, 544(%rsp)	# vect_perm_even_576, %sfp
+	shufps	$136, %xmm14, %xmm13	#, vect_perm_even_552, vect_perm_even_578
+	shufps	$221, %xmm14, %xmm12	#, vect_perm_even_552, vect_perm_even_550
+	movdqa	%xmm10, %xmm14	# vect_perm_even_554, vect_perm_even_580
+	movaps	%xmm12, 496(%rsp)	# vect_perm_even_550, %sfp
+	movdqa	448(%rsp), %xmm12	# %sfp, vect_perm_even_560
+	shufps	$136, %xmm9, %xmm14	#, vect_perm_even_556, vect_perm_even_580
+	movaps	%xmm14, 480(%rsp)	# vect_perm_even_580, %sfp
+	movdqa	%xmm10, %xmm14	# vect_perm_even_554, vect_perm_even_554
+	shufps	$221, %xmm9, %xmm14	#, vect_perm_even_556, vect_perm_even_554
+	movdqa	%xmm8, %xmm9	# vect_perm_even_558, vect_perm_even_582
+	movaps	%xmm14, 464(%rsp)	# vect_perm_even_554, %sfp
+	movdqa	%xmm5, %xmm14	# vect_perm_even_562, vect_perm_even_584
+	shufps	$136, %xmm12, %xmm9	#, vect_perm_even_560, vect_perm_even_582
+	shufps	$221, %xmm12, %xmm8	#, vect_perm_even_560, vect_perm_odd_583
+	movdqa	432(%rsp), %xmm12	# %sfp, vect_perm_even_564
+	shufps	$136, %xmm12, %xmm14	#, vect_perm_even_564, vect_perm_even_584
+	shufps	$221, %xmm12, %xmm5	#, vect_perm_even_564, vect_perm_even_562
+	movdqa	416(%rsp), %xmm12	# %sfp, vect_perm_even_568
+	movaps	%xmm5, 432(%rsp)	# vect_perm_even_562, %sfp
+	movaps	%xmm14, 448(%rsp)	# vect_perm_even_584, %sfp
+	movdqa	%xmm4, %xmm5	# vect_perm_even_566, vect_perm_even_586
+	shufps	$136, %xmm12, %xmm5	#, vect_perm_even_568, vect_perm_even_586
+	shufps	$221, %xmm12, %xmm4	#, vect_perm_even_568, vect_perm_even_566
+	movdqa	400(%rsp), %xmm12	# %sfp, vect_perm_even_572
+	movaps	%xmm4, 416(%rsp)	# vect_perm_even_566, %sfp
+	movdqa	%xmm1, %xmm4	# vect_perm_even_570, vect_perm_even_588
+	shufps	$136, %xmm12, %xmm4	#, vect_perm_even_572, vect_perm_even_588
+	shufps	$221, %xmm12, %xmm1	#, vect_perm_even_572, vect_perm_even_570
+	movaps	%xmm4, 400(%rsp)	# vect_perm_even_588, %sfp
+	movdqa	%xmm0, %xmm12	# vect_perm_odd_543, vect_perm_even_590
+	movaps	%xmm1, 384(%rsp)	# vect_perm_even_570, %sfp
+	movdqa	368(%rsp), %xmm10	# %sfp, vect_perm_odd_545
+	movdqa	352(%rsp), %xmm14	# %sfp, vect_perm_odd_547
+	shufps	$136, %xmm10, %xmm12	#, vect_perm_odd_545, vect_perm_even_590
+	shufps	$221, %xmm10, %xmm0	#, vect_perm_odd_545, vect_perm_odd_543
+	movdqa	%xmm12, %xmm1	# vect_perm_even_590, vect_perm_even_590
+	movdqa	%xmm0, %xmm12	# vect_perm_odd_543, vect_perm_odd_591
+	movdqa	336(%rsp), %xmm0	# %sfp, vect_perm_odd_549
+	movdqa	%xmm14, %xmm4	# vect_perm_odd_547, vect_perm_even_592
+	movdqa	320(%rsp), %xmm10	# %sfp, vect_perm_odd_553
+	shufps	$136, %xmm0, %xmm4	#, vect_perm_odd_549, vect_perm_even_592
+	shufps	$221, %xmm0, %xmm14	#, vect_perm_odd_549, vect_perm_odd_547
+	movdqa	%xmm6, %xmm0	# vect_perm_odd_551, vect_perm_even_594
+	shufps	$221, %xmm10, %xmm6	#, vect_perm_odd_553, vect_perm_odd_551
+	shufps	$136, %xmm10, %xmm0	#, vect_perm_odd_553, vect_perm_even_594
+	movaps	%xmm6, 368(%rsp)	# vect_perm_odd_551, %sfp
+	movdqa	%xmm3, %xmm6	# vect_perm_odd_555, vect_perm_even_596
+	movdqa	304(%rsp), %xmm10	# %sfp, vect_perm_odd_557
+	movaps	%xmm4, 96(%rsp)	# vect_perm_even_592, %sfp
+	shufps	$136, %xmm10, %xmm6	#, vect_perm_odd_557, vect_perm_even_596
+	movaps	%xmm6, 352(%rsp)	# vect_perm_even_596, %sfp
+	movdqa	%xmm3, %xmm6	# vect_perm_odd_555, vect_perm_odd_555
+	movdqa	288(%rsp), %xmm3	# %sfp, vect_perm_odd_561
+	shufps	$221, %xmm10, %xmm6	#, vect_perm_odd_557, vect_perm_odd_555
+	movdqa	%xmm2, %xmm10	# vect_perm_odd_559, vect_perm_even_598
+	movaps	%xmm6, 336(%rsp)	# vect_perm_odd_555, %sfp
+	movdqa	240(%rsp), %xmm6	# %sfp, vect_perm_odd_571
+	shufps	$136, %xmm3, %xmm10	#, vect_perm_odd_561, vect_perm_even_598
+	shufps	$221, %xmm3, %xmm2	#, vect_perm_odd_561, vect_perm_odd_559
+	movdqa	272(%rsp), %xmm3	# %sfp, vect_perm_odd_565
+	movaps	%xmm2, 304(%rsp)	# vect_perm_odd_559, %sfp
+	movaps	%xmm10, 320(%rsp)	# vect_perm_even_598, %sfp
+	movdqa	%xmm11, %xmm2	# vect_perm_odd_563, vect_perm_even_600
+	movdqa	%xmm1, %xmm10	# vect_perm_even_590, vect_perm_even_614
+	shufps	$136, %xmm3, %xmm2	#, vect_perm_odd_565, vect_perm_even_600
+	shufps	$221, %xmm3, %xmm11	#, vect_perm_odd_565, vect_perm_odd_563
+	movdqa	%xmm2, %xmm15	# vect_perm_even_600, vect_perm_even_600
+	movdqa	256(%rsp), %xmm3	# %sfp, vect_perm_odd_569
+	shufps	$136, %xmm4, %xmm10	#, vect_perm_even_592, vect_perm_even_614
+	movdqa	%xmm13, %xmm2	# vect_perm_even_578, vect_perm_even_608
+	movdqa	%xmm0, %xmm4	# vect_perm_even_594, vect_perm_even_616
+	movaps	%xmm11, 288(%rsp)	# vect_perm_odd_563, %sfp
+	movdqa	%xmm7, %xmm11	# vect_perm_odd_567, vect_perm_even_602
+	shufps	$221, %xmm3, %xmm7	#, vect_perm_odd_569, vect_perm_odd_567
+	movaps	%xmm15, 64(%rsp)	# vect_perm_even_600, %sfp
+	shufps	$136, 480(%rsp), %xmm2	#, %sfp, vect_perm_even_608
+	shufps	$136, %xmm3, %xmm11	#, vect_perm_odd_569, vect_perm_even_602
+	movaps	%xmm7, 272(%rsp)	# vect_perm_odd_567, %sfp
+	movdqa	224(%rsp), %xmm3	# %sfp, vect_perm_odd_573
+	shufps	$136, 352(%rsp), %xmm4	#, %sfp, vect_perm_even_616
+	movdqa	%xmm6, %xmm7	# vect_perm_odd_571, vect_perm_even_604
+	movaps	%xmm2, 240(%rsp)	# vect_perm_even_608, %sfp
+	movdqa	%xmm5, %xmm2	# vect_perm_even_586, vect_perm_even_612
+	shufps	$136, 400(%rsp), %xmm2	#, %sfp, vect_perm_even_612
+	movaps	%xmm4, 208(%rsp)	# vect_perm_even_616, %sfp
+	shufps	$136, %xmm3, %xmm7	#, vect_perm_odd_573, vect_perm_even_604
+	shufps	$221, %xmm3, %xmm6	#, vect_perm_odd_573, vect_perm_odd_571
+	movdqa	320(%rsp), %xmm4	# %sfp, vect_perm_even_618
+	movdqa	528(%rsp), %xmm3	# %sfp, vect_perm_even_606
+	movaps	%xmm2, 224(%rsp)	# vect_perm_even_612, %sfp
+	movdqa	%xmm10, %xmm2	# vect_perm_even_614, vect_perm_even_614
+	movdqa	%xmm11, %xmm10	# vect_perm_even_602, vect_perm_even_620
+	shufps	$136, %xmm7, %xmm10	#, vect_perm_even_604, vect_perm_even_620
+	movaps	%xmm7, 32(%rsp)	# vect_perm_even_604, %sfp
+	shufps	$136, %xmm15, %xmm4	#, vect_perm_even_600, vect_perm_even_618
+	shufps	$136, 544(%rsp), %xmm3	#, %sfp, vect_perm_even_606
+	movaps	%xmm6, 256(%rsp)	# vect_perm_odd_571, %sfp
+	movdqa	%xmm9, %xmm6	# vect_perm_even_582, vect_perm_even_610
+	shufps	$136, 448(%rsp), %xmm6	#, %sfp, vect_perm_even_610
+	movdqa	%xmm6, %xmm15	# vect_perm_even_610, tmp454
+	movaps	%xmm11, 48(%rsp)	# vect_perm_even_602, %sfp
+	movaps	%xmm10, 192(%rsp)	# vect_perm_even_620, %sfp
+	movdqa	416(%rsp), %xmm7	# %sfp, vect_perm_even_628
+	shufps	$136, 384(%rsp), %xmm7	#, %sfp, vect_perm_even_628
+	shufps	$221, 224(%rsp), %xmm15	#, %sfp, tmp454
+	shufps	$136, 224(%rsp), %xmm6	#, %sfp, tmp458
+	movaps	%xmm14, 80(%rsp)	# vect_perm_odd_593, %sfp
+	movdqa	560(%rsp), %xmm11	# %sfp, vect_perm_even_622
+	movdqa	496(%rsp), %xmm10	# %sfp, vect_perm_even_624
+	shufps	$136, 512(%rsp), %xmm11	#, %sfp, vect_perm_even_622
+	movaps	%xmm12, 112(%rsp)	# vect_perm_odd_591, %sfp
+	shufps	$136, 464(%rsp), %xmm10	#, %sfp, vect_perm_even_624
+	movaps	%xmm7, 160(%rsp)	# vect_perm_even_628, %sfp
+	movdqa	%xmm12, %xmm7	# vect_perm_odd_591, vect_perm_even_630
+	movdqa	368(%rsp), %xmm12	# %sfp, vect_perm_even_632
+	shufps	$136, 336(%rsp), %xmm12	#, %sfp, vect_perm_even_632
+	movaps	%xmm10, 176(%rsp)	# vect_perm_even_624, %sfp
+	shufps	$136, %xmm14, %xmm7	#, vect_perm_odd_593, vect_perm_even_630
+	movdqa	304(%rsp), %xmm14	# %sfp, vect_perm_even_634
+	shufps	$136, 288(%rsp), %xmm14	#, %sfp, vect_perm_even_634
+	movaps	%xmm7, 16(%rsp)	# vect_perm_even_630, %sfp
+	movdqa	%xmm14, %xmm7	# vect_perm_even_634, vect_perm_even_634
+	movdqa	%xmm8, %xmm10	# vect_perm_odd_583, vect_perm_even_626
+	movdqa	272(%rsp), %xmm14	# %sfp, vect_perm_even_636
+	shufps	$136, 256(%rsp), %xmm14	#, %sfp, vect_perm_even_636
+	movaps	%xmm14, (%rsp)	# vect_perm_even_636, %sfp
+	movdqa	%xmm3, %xmm14	# vect_perm_even_606, tmp453
+	shufps	$221, 240(%rsp), %xmm14	#, %sfp, tmp453
+	shufps	$136, 432(%rsp), %xmm10	#, %sfp, vect_perm_even_626
+	shufps	$221, %xmm15, %xmm14	#, tmp454, tmp453
+	movdqa	%xmm2, %xmm15	# vect_perm_even_614, tmp455
+	movaps	%xmm14, 128(%rsp)	# tmp453, %sfp
+	shufps	$221, 208(%rsp), %xmm15	#, %sfp, tmp455
+	movdqa	%xmm15, %xmm14	# tmp455, tmp455
+	movaps	%xmm12, 144(%rsp)	# vect_perm_even_632, %sfp
+	movdqa	%xmm4, %xmm15	# vect_perm_even_618, tmp456
+	shufps	$136, 240(%rsp), %xmm3	#, %sfp, tmp457
+	shufps	$136, %xmm6, %xmm3	#, tmp458, tmp459
+	shufps	$221, 192(%rsp), %xmm15	#, %sfp, tmp456
+# blake2s-internal.h:187:         L->H[i][l] = ctx->H[i];
+	.loc 2 187 20 view .LVU10
+	movaps	%xmm3, 640(%rsp)	# tmp459, MEM <vector(4) unsigned int> [(unsigned int *)&L]
+	.loc 2 186 34 is_stmt 1 view .LVU11
+.LVL1:
+	.loc 2 186 28 view .LVU12
+	.loc 2 187 9 view .LVU13
+# blake2s-internal.h:187:         L->H[i][l] = ctx->H[i];
+	.loc 2 187 28 is_stmt 0 view .LVU14
+	shufps	$136, 208(%rsp), %xmm2	#, %sfp, tmp460
+	shufps	$221, %xmm15, %xmm14	#, tmp456, vect_perm_odd_689
+	shufps	$136, 192(%rsp), %xmm4	#, %sfp, tmp461
+	movdqa	%xmm11, %xmm15	# vect_perm_even_622, tmp463
+	shufps	$136, 176(%rsp), %xmm15	#, %sfp, tmp463
+	shufps	$136, %xmm4, %xmm2	#, tmp461, tmp462
+# blake2s-internal.h:187:         L->H[i][l] = ctx->H[i];
+	.loc 2 187 20 view .LVU15
+	movaps	%xmm2, 704(%rsp)	# tmp462, MEM <vector(4) unsigned int> [(unsigned int *)&L + 64B]
+	.loc 2 186 34 is_stmt 1 view .LVU16
+.LVL2:
+	.loc 2 186 28 view .LVU17
+	.loc 2 187 9 view .LVU18
+# blake2s-internal.h:187:         L->H[i][l] = ctx->H[i];
+	.loc 2 187 28 is_stmt 0 view .LVU19
+	movdqa	%xmm15, %xmm2	# tmp463, tmp463
+	movdqa	%xmm10, %xmm15	# vect_perm_even_626, tmp464
+	shufps	$136, 160(%rsp), %xmm15	#, %sfp, tmp464
+	movdqa	16(%rsp), %xmm6	# %sfp, vect_perm_even_630
+	shufps	$136, %xmm15, %xmm2	#, tmp464, tmp465
+	movdqa	(%rsp), %xmm12	# %sfp, vect_perm_even_636
+	movdqa	%xmm7, %xmm15	# vect_perm_even_634, tmp467
+# blake2s-internal.h:187:         L->H[i][l] = ctx->H[i];
+	.loc 2 187 20 view .LVU20
+	movaps	%xmm2, 768(%rsp)	# tmp465, MEM <vector(4) unsigned int> [(unsigned int *)&L + 128B]
+	.loc 2 186 34 is_stmt 1 view .LVU21
+.LVL3:
+	.loc 2 186 28 view .LVU22
+	.loc 2 187 9 view .LVU23
+# blake2s-internal.h:187:         L->H[i][l] = ctx->H[i];
+	.loc 2 187 28 is_stmt 0 view .LVU24
+	shufps	$221, 352(%rsp), %xmm0	#, %sfp, tmp477
+	movdqa	%xmm6, %xmm2	# vect_perm_even_630, tmp466
+	shufps	$221, 96(%rsp), %xmm1	#, %sfp, tmp476
+	shufps	$136, %xmm0, %xmm1	#, tmp477, tmp478
+	shufps	$136, 144(%rsp), %xmm2	#, %sfp, tmp466
+	shufps	$136, %xmm12, %xmm15	#, vect_perm_even_636, tmp467
+	shufps	$136, %xmm15, %xmm2	#, tmp467, tmp468
+	movdqa	%xmm13, %xmm15	# vect_perm_even_578, vect_perm_even_578
+# blake2s-internal.h:187:         L->H[i][l] = ctx->H[i];
+	.loc 2 187 20 view .LVU25
+	movaps	%xmm2, 832(%rsp)	# tmp468, MEM <vector(4) unsigned int> [(unsigned int *)&L + 192B]
+	.loc 2 186 34 is_stmt 1 view .LVU26
+.LVL4:
+	.loc 2 186 28 view .LVU27
+	.loc 2 187 9 view .LVU28
+# blake2s-internal.h:187:         L->H[i][l] = ctx->H[i];
+	.loc 2 187 28 is_stmt 0 view .LVU29
+	movdqa	48(%rsp), %xmm0	# %sfp, vect_perm_even_602
+	movdqa	%xmm8, %xmm13	# vect_perm_odd_583, vect_perm_odd_583
+	shufps	$221, 32(%rsp), %xmm0	#, %sfp, vect_perm_even_602
+	shufps	$221, 480(%rsp), %xmm15	#, %sfp, vect_perm_even_578
+	movdqa	528(%rsp), %xmm2	# %sfp, vect_perm_even_574
+	shufps	$221, %xmm12, %xmm7	#, vect_perm_even_636, vect_perm_even_634
+	shufps	$221, 544(%rsp), %xmm2	#, %sfp, vect_perm_even_574
+	shufps	$136, %xmm15, %xmm2	#, tmp470, tmp471
+	shufps	$221, 432(%rsp), %xmm13	#, %sfp, vect_perm_odd_583
+	movdqa	%xmm9, %xmm15	# vect_perm_even_582, vect_perm_even_582
+	shufps	$221, 448(%rsp), %xmm15	#, %sfp, vect_perm_even_582
+	movdqa	%xmm15, %xmm3	# vect_perm_even_582, tmp472
+	movdqa	%xmm5, %xmm15	# vect_perm_even_586, vect_perm_even_586
+	shufps	$221, 400(%rsp), %xmm15	#, %sfp, vect_perm_even_586
+	shufps	$136, %xmm15, %xmm3	#, tmp473, tmp474
+	shufps	$136, %xmm3, %xmm2	#, tmp474, tmp475
+	movdqa	320(%rsp), %xmm15	# %sfp, vect_perm_even_598
+	shufps	$221, 64(%rsp), %xmm15	#, %sfp, vect_perm_even_598
+	shufps	$136, %xmm0, %xmm15	#, tmp480, tmp481
+	movdqa	560(%rsp), %xmm0	# %sfp, vect_perm_odd_575
+	shufps	$136, %xmm15, %xmm1	#, tmp481, tmp482
+# blake2s-internal.h:187:         L->H[i][l] = ctx->H[i];
+	.loc 2 187 20 view .LVU30
+	movaps	%xmm1, 960(%rsp)	# tmp482, MEM <vector(4) unsigned int> [(unsigned int *)&L + 320B]
+# blake2s-internal.h:187:         L->H[i][l] = ctx->H[i];
+	.loc 2 187 28 view .LVU31
+	shufps	$221, 512(%rsp), %xmm0	#, %sfp, vect_perm_odd_575
+	movdqa	496(%rsp), %xmm1	# %sfp, vect_perm_odd_579
+	shufps	$221, 464(%rsp), %xmm1	#, %sfp, vect_perm_odd_579
+	shufps	$136, %xmm1, %xmm0	#, tmp484, tmp485
+	movdqa	%xmm13, %xmm1	# vect_perm_odd_583, tmp486
+# blake2s-internal.h:187:         L->H[i][l] = ctx->H[i];
+	.loc 2 187 20 view .LVU32
+	movaps	%xmm2, 896(%rsp)	# tmp475, MEM <vector(4) unsigned int> [(unsigned int *)&L + 256B]
+	.loc 2 186 34 is_stmt 1 view .LVU33
+.LVL5:
+	.loc 2 186 28 view .LVU34
+	.loc 2 187 9 view .LVU35
+	.loc 2 186 34 view .LVU36
+	.loc 2 186 28 view .LVU37
+	.loc 2 187 9 view .LVU38
+# blake2s-internal.h:187:         L->H[i][l] = ctx->H[i];
+	.loc 2 187 28 is_stmt 0 view .LVU39
+	movdqa	416(%rsp), %xmm2	# %sfp, vect_perm_odd_587
+	shufps	$221, 384(%rsp), %xmm2	#, %sfp, vect_perm_odd_587
+	shufps	$136, %xmm2, %xmm1	#, tmp487, tmp488
+	shufps	$136, %xmm1, %xmm0	#, tmp488, tmp489
+	movdqa	368(%rsp), %xmm1	# %sfp, vect_perm_odd_595
+# blake2s-internal.h:187:         L->H[i][l] = ctx->H[i];
+	.loc 2 187 20 view .LVU40
+	movaps	%xmm0, 1024(%rsp)	# tmp489, MEM <vector(4) unsigned int> [(unsigned int *)&L + 384B]
+	.loc 2 186 34 is_stmt 1 view .LVU41
+.LVL6:
+	.loc 2 186 28 view .LVU42
+	.loc 2 187 9 view .LVU43
+# blake2s-internal.h:187:         L->H[i][l] = ctx->H[i];
+	.loc 2 187 28 is_stmt 0 view .LVU44
+	shufps	$221, 336(%rsp), %xmm1	#, %sfp, vect_perm_odd_595
+	movdqa	112(%rsp), %xmm0	# %sfp, vect_perm_odd_591
+	shufps	$221, 80(%rsp), %xmm0	#, %sfp, vect_perm_odd_591
+	shufps	$136, %xmm1, %xmm0	#, tmp491, tmp492
+	movdqa	304(%rsp), %xmm1	# %sfp, vect_perm_odd_599
+	shufps	$221, 288(%rsp), %xmm1	#, %sfp, vect_perm_odd_599
+# blake2s-internal.h:187:         L->H[i][l] = ctx->H[i];
+	.loc 2 187 20 view .LVU45
+	movd	896(%rdi), %xmm5	# MEM <struct blake2sp_ctx> [(const struct blake2s_ctx *)ctx_19(D)].S[7].H[0], tmp810
+# blake2s-internal.h:187:         L->H[i][l] = ctx->H[i];
+	.loc 2 187 28 view .LVU46
+	movdqa	272(%rsp), %xmm2	# %sfp, vect_perm_odd_603
+	shufps	$221, 256(%rsp), %xmm2	#, %sfp, vect_perm_odd_603
+	shufps	$136, %xmm2, %xmm1	#, tmp494, tmp495
+	shufps	$221, 144(%rsp), %xmm6	#, %sfp, vect_perm_even_630
+	shufps	$136, %xmm1, %xmm0	#, tmp495, tmp496
+	movdqa	%xmm10, %xmm1	# vect_perm_even_626, vect_perm_even_626
+# blake2s-internal.h:187:         L->H[i][l] = ctx->H[i];
+	.loc 2 187 20 view .LVU47
+	movaps	%xmm0, 1088(%rsp)	# tmp496, MEM <vector(4) unsigned int> [(unsigned int *)&L + 448B]
+	.loc 2 186 34 is_stmt 1 view .LVU48
+.LVL7:
+	.loc 2 186 28 view .LVU49
+.LBE39:
+	.loc 2 188 5 view .LVU50
+.LBB40:
+# blake2s-internal.h:187:         L->H[i][l] = ctx->H[i];
+	.loc 2 187 28 is_stmt 0 view .LVU51
+	shufps	$221, 160(%rsp), %xmm1	#, %sfp, vect_perm_even_626
+	movdqa	%xmm11, %xmm0	# vect_perm_even_622, vect_perm_even_622
+	shufps	$221, 176(%rsp), %xmm0	#, %sfp, vect_perm_even_622
+	shufps	$221, %xmm1, %xmm0	#, tmp498, tmp499
+# blake2s-internal.h:187:         L->H[i][l] = ctx->H[i];
+	.loc 2 187 20 view .LVU52
+	movd	768(%rdi), %xmm1	# MEM <struct blake2sp_ctx> [(const struct blake2s_ctx *)ctx_19(D)].S[6].H[0], tmp504
+.LBE40:
+# blake2s-internal.h:190:     L->f[0][l] = ctx->f[0];
+	.loc 2 190 16 view .LVU53
+	movaps	%xmm0, 1280(%rsp)	# tmp499, MEM <vector(4) unsigned int> [(unsigned int *)&L + 640B]
+.LBB41:
+# blake2s-internal.h:187:         L->H[i][l] = ctx->H[i];
+	.loc 2 187 28 view .LVU54
+	movdqa	%xmm6, %xmm0	# vect_perm_even_630, tmp500
+.LBE41:
+# blake2s-internal.h:188:     L->t[0][l] = ctx->t[0];
+	.loc 2 188 16 view .LVU55
+	movdqa	128(%rsp), %xmm2	# %sfp, vect_perm_odd_687
+# blake2s-internal.h:189:     L->t[1][l] = ctx->t[1];
+	.loc 2 189 16 view .LVU56
+	movaps	%xmm14, 1216(%rsp)	# vect_perm_odd_689, MEM <vector(4) unsigned int> [(unsigned int *)&L + 576B]
+.LBB42:
+# blake2s-internal.h:187:         L->H[i][l] = ctx->H[i];
+	.loc 2 187 28 view .LVU57
+	shufps	$221, %xmm7, %xmm0	#, tmp501, tmp502
+# blake2s-internal.h:187:         L->H[i][l] = ctx->H[i];
+	.loc 2 187 20 view .LVU58
+	punpckldq	%xmm5, %xmm1	# tmp810, tmp504
+.LBE42:
+# blake2s-internal.h:191:     L->f[1][l] = ctx->f[1];
+	.loc 2 191 16 view .LVU59
+	movaps	%xmm0, 1344(%rsp)	# tmp502, MEM <vector(4) unsigned int> [(unsigned int *)&L + 704B]
+.LBB43:
+# blake2s-internal.h:187:         L->H[i][l] = ctx->H[i];
+	.loc 2 187 20 view .LVU60
+	movd	640(%rdi), %xmm5	# MEM <struct blake2sp_ctx> [(const struct blake2s_ctx *)ctx_19(D)].S[5].H[0], tmp812
+	movd	512(%rdi), %xmm0	# MEM <struct blake2sp_ctx> [(const struct blake2s_ctx *)ctx_19(D)].S[4].H[0], tmp507
+.LBE43:
+# blake2s-internal.h:188:     L->t[0][l] = ctx->t[0];
+	.loc 2 188 16 view .LVU61
+	movaps	%xmm2, 1152(%rsp)	# vect_perm_odd_687, MEM <vector(4) unsigned int> [(unsigned int *)&L + 512B]
+	.loc 2 189 5 is_stmt 1 view .LVU62
+	.loc 2 190 5 view .LVU63
+	.loc 2 191 5 view .LVU64
+.LVL8:
+	.loc 2 191 5 is_stmt 0 view .LVU65
+.LBE49:
+.LBE55:
+	.loc 1 74 34 is_stmt 1 view .LVU66
+	.loc 1 74 28 view .LVU67
+.LBB56:
+.LBB50:
+.LBB44:
+	.loc 2 186 28 view .LVU68
+	.loc 2 187 9 view .LVU69
+	.loc 2 186 34 view .LVU70
+	.loc 2 186 28 view .LVU71
+	.loc 2 187 9 view .LVU72
+	.loc 2 186 34 view .LVU73
+	.loc 2 186 28 view .LVU74
+	.loc 2 187 9 view .LVU75
+	.loc 2 186 34 view .LVU76
+	.loc 2 186 28 view .LVU77
+	.loc 2 187 9 view .LVU78
+	.loc 2 186 34 view .LVU79
+	.loc 2 186 28 view .LVU80
+	.loc 2 187 9 view .LVU81
+	.loc 2 186 34 view .LVU82
+	.loc 2 186 28 view .LVU83
+	.loc 2 187 9 view .LVU84
+	.loc 2 186 34 view .LVU85
+	.loc 2 186 28 view .LVU86
+	.loc 2 187 9 view .LVU87
+	.loc 2 186 34 view .LVU88
+	.loc 2 186 28 view .LVU89
+	.loc 2 187 9 view .LVU90
+	.loc 2 186 34 view .LVU91
+	.loc 2 186 28 view .LVU92
+.LBE44:
+	.loc 2 188 5 view .LVU93
+	.loc 2 189 5 view .LVU94
+	.loc 2 190 5 view .LVU95
+	.loc 2 191 5 view .LVU96
+	.loc 2 191 5 is_stmt 0 view .LVU97
+.LBE50:
+.LBE56:
+	.loc 1 74 34 is_stmt 1 view .LVU98
+	.loc 1 74 28 view .LVU99
+.LBB57:
+.LBB51:
+.LBB45:
+	.loc 2 186 28 view .LVU100
+	.loc 2 187 9 view .LVU101
+	.loc 2 186 34 view .LVU102
+	.loc 2 186 28 view .LVU103
+	.loc 2 187 9 view .LVU104
+	.loc 2 186 34 view .LVU105
+	.loc 2 186 28 view .LVU106
+	.loc 2 187 9 view .LVU107
+	.loc 2 186 34 view .LVU108
+	.loc 2 186 28 view .LVU109
+	.loc 2 187 9 view .LVU110
+	.loc 2 186 34 view .LVU111
+	.loc 2 186 28 view .LVU112
+	.loc 2 187 9 view .LVU113
+	.loc 2 186 34 view .LVU114
+	.loc 2 186 28 view .LVU115
+	.loc 2 187 9 view .LVU116
+	.loc 2 186 34 view .LVU117
+	.loc 2 186 28 view .LVU118
+	.loc 2 187 9 view .LVU119
+	.loc 2 186 34 view .LVU120
+	.loc 2 186 28 view .LVU121
+	.loc 2 187 9 view .LVU122
+	.loc 2 186 34 view .LVU123
+	.loc 2 186 28 view .LVU124
+.LBE45:
+	.loc 2 188 5 view .LVU125
+	.loc 2 189 5 view .LVU126
+	.loc 2 190 5 view .LVU127
+	.loc 2 191 5 view .LVU128
+	.loc 2 191 5 is_stmt 0 view .LVU129
+.LBE51:
+.LBE57:
+	.loc 1 74 34 is_stmt 1 view .LVU130
+	.loc 1 74 28 view .LVU131
+.LBB58:
+.LBB52:
+.LBB46:
+	.loc 2 186 28 view .LVU132
+	.loc 2 187 9 view .LVU133
+	.loc 2 186 34 view .LVU134
+	.loc 2 186 28 view .LVU135
+	.loc 2 187 9 view .LVU136
+	.loc 2 186 34 view .LVU137
+	.loc 2 186 28 view .LVU138
+	.loc 2 187 9 view .LVU139
+	.loc 2 186 34 view .LVU140
+	.loc 2 186 28 view .LVU141
+	.loc 2 187 9 view .LVU142
+	.loc 2 186 34 view .LVU143
+	.loc 2 186 28 view .LVU144
+	.loc 2 187 9 view .LVU145
+	.loc 2 186 34 view .LVU146
+	.loc 2 186 28 view .LVU147
+	.loc 2 187 9 view .LVU148
+	.loc 2 186 34 view .LVU149
+	.loc 2 186 28 view .LVU150
+	.loc 2 187 9 view .LVU151
+	.loc 2 186 34 view .LVU152
+	.loc 2 186 28 view .LVU153
+	.loc 2 187 9 view .LVU154
+	.loc 2 186 34 view .LVU155
+	.loc 2 186 28 view .LVU156
+.LBE46:
+	.loc 2 188 5 view .LVU157
+	.loc 2 189 5 view .LVU158
+	.loc 2 190 5 view .LVU159
+	.loc 2 191 5 view .LVU160
+	.loc 2 191 5 is_stmt 0 view .LVU161
+.LBE52:
+.LBE58:
+	.loc 1 74 34 is_stmt 1 view .LVU162
+	.loc 1 74 28 view .LVU163
+.LBB59:
+.LBB53:
+.LBB47:
+	.loc 2 186 28 view .LVU164
+	.loc 2 187 9 view .LVU165
+# blake2s-internal.h:187:         L->H[i][l] = ctx->H[i];
+	.loc 2 187 20 is_stmt 0 view .LVU166
+	punpckldq	%xmm5, %xmm0	# tmp812, tmp507
+	movd	900(%rdi), %xmm5	# MEM <struct blake2sp_ctx> [(const struct blake2s_ctx *)ctx_19(D)].S[7].H[1], tmp814
+	punpcklqdq	%xmm1, %xmm0	# tmp504, tmp503
+	movd	772(%rdi), %xmm1	# MEM <struct blake2sp_ctx> [(const struct blake2s_ctx *)ctx_19(D)].S[6].H[1], tmp511
+	movaps	%xmm0, 656(%rsp)	# tmp503, MEM <vector(4) unsigned int> [(unsigned int *)&L + 16B]
+	.loc 2 186 34 is_stmt 1 view .LVU167
+.LVL9:
+	.loc 2 186 28 view .LVU168
+	.loc 2 187 9 view .LVU169
+# blake2s-internal.h:187:         L->H[i][l] = ctx->H[i];
+	.loc 2 187 20 is_stmt 0 view .LVU170
+	movd	516(%rdi), %xmm0	# MEM <struct blake2sp_ctx> [(const struct blake2s_ctx *)ctx_19(D)].S[4].H[1], tmp513
+	punpckldq	%xmm5, %xmm1	# tmp814, tmp511
+	movd	644(%rdi), %xmm5	# MEM <struct blake2sp_ctx> [(const struct blake2s_ctx *)ctx_19(D)].S[5].H[1], tmp816
+	punpckldq	%xmm5, %xmm0	# tmp816, tmp513
+	movd	904(%rdi), %xmm5	# MEM <struct blake2sp_ctx> [(const struct blake2s_ctx *)ctx_19(D)].S[7].H[2], tmp818
+	punpcklqdq	%xmm1, %xmm0	# tmp511, tmp510
+	movd	776(%rdi), %xmm1	# MEM <struct blake2sp_ctx> [(const struct blake2s_ctx *)ctx_19(D)].S[6].H[2], tmp515
+	movaps	%xmm0, 720(%rsp)	# tmp510, MEM <vector(4) unsigned int> [(unsigned int *)&L + 80B]
+	.loc 2 186 34 is_stmt 1 view .LVU171
+.LVL10:
+	.loc 2 186 28 view .LVU172
+	.loc 2 187 9 view .LVU173
+# blake2s-internal.h:187:         L->H[i][l] = ctx->H[i];
+	.loc 2 187 20 is_stmt 0 view .LVU174
+	movd	520(%rdi), %xmm0	# MEM <struct blake2sp_ctx> [(const struct blake2s_ctx *)ctx_19(D)].S[4].H[2], tmp517
+	punpckldq	%xmm5, %xmm1	# tmp818, tmp515
+	movd	648(%rdi), %xmm5	# MEM <struct blake2sp_ctx> [(const struct blake2s_ctx *)ctx_19(D)].S[5].H[2], tmp820
+	punpckldq	%xmm5, %xmm0	# tmp820, tmp517
+	movd	908(%rdi), %xmm5	# MEM <struct blake2sp_ctx> [(const struct blake2s_ctx *)ctx_19(D)].S[7].H[3], tmp822
+	punpcklqdq	%xmm1, %xmm0	# tmp515, tmp514
+	movd	780(%rdi), %xmm1	# MEM <struct blake2sp_ctx> [(const struct blake2s_ctx *)ctx_19(D)].S[6].H[3], tmp519
+	movaps	%xmm0, 784(%rsp)	# tmp514, MEM <vector(4) unsigned int> [(unsigned int *)&L + 144B]
+	.loc 2 186 34 is_stmt 1 view .LVU175
+.LVL11:
+	.loc 2 186 28 view .LVU176
+	.loc 2 187 9 view .LVU177
+# blake2s-internal.h:187:         L->H[i][l] = ctx->H[i];
+	.loc 2 187 20 is_stmt 0 view .LVU178
+	movd	524(%rdi), %xmm0	# MEM <struct blake2sp_ctx> [(const struct blake2s_ctx *)ctx_19(D)].S[4].H[3], tmp521
+	punpckldq	%xmm5, %xmm1	# tmp822, tmp519
+	movd	652(%rdi), %xmm5	# MEM <struct blake2sp_ctx> [(const struct blake2s_ctx *)ctx_19(D)].S[5].H[3], tmp824
+	punpckldq	%xmm5, %xmm0	# tmp824, tmp521
+	punpcklqdq	%xmm1, %xmm0	# tmp519, tmp518
+	movaps	%xmm0, 848(%rsp)	# tmp518, MEM <vector(4) unsigned int> [(unsigned int *)&L + 208B]
+	.loc 2 186 34 is_stmt 1 view .LVU179
+.LVL12:
+	.loc 2 186 28 view .LVU180
+	.loc 2 187 9 view .LVU181
+# blake2s-internal.h:187:         L->H[i][l] = ctx->H[i];
+	.loc 2 187 20 is_stmt 0 view .LVU182
+	movd	784(%rdi), %xmm1	# MEM <struct blake2sp_ctx> [(const struct blake2s_ctx *)ctx_19(D)].S[6].H[4], tmp523
+	movd	912(%rdi), %xmm5	# MEM <struct blake2sp_ctx> [(const struct blake2s_ctx *)ctx_19(D)].S[7].H[4], tmp826
+	movd	528(%rdi), %xmm0	# MEM <struct blake2sp_ctx> [(const struct blake2s_ctx *)ctx_19(D)].S[4].H[4], tmp525
+	movd	920(%rdi), %xmm7	# MEM <struct blake2sp_ctx> [(const struct blake2s_ctx *)ctx_19(D)].S[7].H[6], tmp834
+	punpckldq	%xmm5, %xmm1	# tmp826, tmp523
+	movd	656(%rdi), %xmm5	# MEM <struct blake2sp_ctx> [(const struct blake2s_ctx *)ctx_19(D)].S[5].H[4], tmp828
+	movd	736(%rdi), %xmm6	# MEM <struct blake2sp_ctx> [(const struct blake2s_ctx *)ctx_19(D)].S[5].t[0], tmp844
+	movd	612(%rdi), %xmm2	# MEM <struct blake2sp_ctx> [(const struct blake2s_ctx *)ctx_19(D)].S[4].t[1], tmp545
+.LBE47:
+# blake2s-internal.h:190:     L->f[0][l] = ctx->f[0];
+	.loc 2 190 16 view .LVU183
+	movd	872(%rdi), %xmm3	# MEM <struct blake2sp_ctx> [(const struct blake2s_ctx *)ctx_19(D)].S[6].f[0], tmp547
+.LBB48:
+# blake2s-internal.h:187:         L->H[i][l] = ctx->H[i];
+	.loc 2 187 20 view .LVU184
+	punpckldq	%xmm5, %xmm0	# tmp828, tmp525
+	movd	916(%rdi), %xmm5	# MEM <struct blake2sp_ctx> [(const struct blake2s_ctx *)ctx_19(D)].S[7].H[5], tmp830
+	punpcklqdq	%xmm1, %xmm0	# tmp523, tmp522
+	movd	788(%rdi), %xmm1	# MEM <struct blake2sp_ctx> [(const struct blake2s_ctx *)ctx_19(D)].S[6].H[5], tmp527
+	movaps	%xmm0, 912(%rsp)	# tmp522, MEM <vector(4) unsigned int> [(unsigned int *)&L + 272B]
+	.loc 2 186 34 is_stmt 1 view .LVU185
+.LVL13:
+	.loc 2 186 28 view .LVU186
+	.loc 2 187 9 view .LVU187
+# blake2s-internal.h:187:         L->H[i][l] = ctx->H[i];
+	.loc 2 187 20 is_stmt 0 view .LVU188
+	movd	532(%rdi), %xmm0	# MEM <struct blake2sp_ctx> [(const struct blake2s_ctx *)ctx_19(D)].S[4].H[5], tmp529
+	punpckldq	%xmm5, %xmm1	# tmp830, tmp527
+	movd	660(%rdi), %xmm5	# MEM <struct blake2sp_ctx> [(const struct blake2s_ctx *)ctx_19(D)].S[5].H[5], tmp832
+	punpckldq	%xmm5, %xmm0	# tmp832, tmp529
+	movd	664(%rdi), %xmm5	# MEM <struct blake2sp_ctx> [(const struct blake2s_ctx *)ctx_19(D)].S[5].H[6], tmp836
+	punpcklqdq	%xmm1, %xmm0	# tmp527, tmp526
+	movd	792(%rdi), %xmm1	# MEM <struct blake2sp_ctx> [(const struct blake2s_ctx *)ctx_19(D)].S[6].H[6], tmp531
+	movaps	%xmm0, 976(%rsp)	# tmp526, MEM <vector(4) unsigned int> [(unsigned int *)&L + 336B]
+	.loc 2 186 34 is_stmt 1 view .LVU189
+.LVL14:
+	.loc 2 186 28 view .LVU190
+	.loc 2 187 9 view .LVU191
+# blake2s-internal.h:187:         L->H[i][l] = ctx->H[i];
+	.loc 2 187 20 is_stmt 0 view .LVU192
+	movd	536(%rdi), %xmm0	# MEM <struct blake2sp_ctx> [(const struct blake2s_ctx *)ctx_19(D)].S[4].H[6], tmp533
+	punpckldq	%xmm7, %xmm1	# tmp834, tmp531
+	movd	924(%rdi), %xmm7	# MEM <struct blake2sp_ctx> [(const struct blake2s_ctx *)ctx_19(D)].S[7].H[7], tmp838
+	punpckldq	%xmm5, %xmm0	# tmp836, tmp533
+	movd	668(%rdi), %xmm5	# MEM <struct blake2sp_ctx> [(const struct blake2s_ctx *)ctx_19(D)].S[5].H[7], tmp840
+	punpcklqdq	%xmm1, %xmm0	# tmp531, tmp530
+	movd	796(%rdi), %xmm1	# MEM <struct blake2sp_ctx> [(const struct blake2s_ctx *)ctx_19(D)].S[6].H[7], tmp535
+	movaps	%xmm0, 1040(%rsp)	# tmp530, MEM <vector(4) unsigned int> [(unsigned int *)&L + 400B]
+	.loc 2 186 34 is_stmt 1 view .LVU193
+.LVL15:
+	.loc 2 186 28 view .LVU194
+	.loc 2 187 9 view .LVU195
+# blake2s-internal.h:187:         L->H[i][l] = ctx->H[i];
+	.loc 2 187 20 is_stmt 0 view .LVU196
+	movd	540(%rdi), %xmm0	# MEM <struct blake2sp_ctx> [(const struct blake2s_ctx *)ctx_19(D)].S[4].H[7], tmp537
+	punpckldq	%xmm7, %xmm1	# tmp838, tmp535
+	movd	992(%rdi), %xmm7	# MEM <struct blake2sp_ctx> [(const struct blake2s_ctx *)ctx_19(D)].S[7].t[0], tmp842
+	punpckldq	%xmm5, %xmm0	# tmp840, tmp537
+	movd	996(%rdi), %xmm5	# MEM <struct blake2sp_ctx> [(const struct blake2s_ctx *)ctx_19(D)].S[7].t[1], tmp846
+	punpcklqdq	%xmm1, %xmm0	# tmp535, tmp534
+	movd	608(%rdi), %xmm1	# MEM <struct blake2sp_ctx> [(const struct blake2s_ctx *)ctx_19(D)].S[4].t[0], tmp541
+	movaps	%xmm0, 1104(%rsp)	# tmp534, MEM <vector(4) unsigned int> [(unsigned int *)&L + 464B]
+	.loc 2 186 34 is_stmt 1 view .LVU197
+.LVL16:
+	.loc 2 186 28 view .LVU198
+.LBE48:
+	.loc 2 188 5 view .LVU199
+	movd	864(%rdi), %xmm0	# MEM <struct blake2sp_ctx> [(const struct blake2s_ctx *)ctx_19(D)].S[6].t[0], tmp539
+	punpckldq	%xmm6, %xmm1	# tmp844, tmp541
+# blake2s-internal.h:190:     L->f[0][l] = ctx->f[0];
+	.loc 2 190 16 is_stmt 0 view .LVU200
+	movd	1000(%rdi), %xmm6	# MEM <struct blake2sp_ctx> [(const struct blake2s_ctx *)ctx_19(D)].S[7].f[0], tmp850
+	punpckldq	%xmm7, %xmm0	# tmp842, tmp539
+	movd	740(%rdi), %xmm7	# MEM <struct blake2sp_ctx> [(const struct blake2s_ctx *)ctx_19(D)].S[5].t[1], tmp848
+	punpcklqdq	%xmm0, %xmm1	# tmp539, tmp538
+	movd	868(%rdi), %xmm0	# MEM <struct blake2sp_ctx> [(const struct blake2s_ctx *)ctx_19(D)].S[6].t[1], tmp543
+	punpckldq	%xmm6, %xmm3	# tmp850, tmp547
+	punpckldq	%xmm7, %xmm2	# tmp848, tmp545
+# blake2s-internal.h:188:     L->t[0][l] = ctx->t[0];
+	.loc 2 188 16 view .LVU201
+	movaps	%xmm1, 1168(%rsp)	# tmp538, MEM <vector(4) unsigned int> [(unsigned int *)&L + 528B]
+	.loc 2 189 5 is_stmt 1 view .LVU202
+	punpckldq	%xmm5, %xmm0	# tmp846, tmp543
+	punpcklqdq	%xmm0, %xmm2	# tmp543, tmp542
+# blake2s-internal.h:189:     L->t[1][l] = ctx->t[1];
+	.loc 2 189 16 is_stmt 0 view .LVU203
+	movaps	%xmm2, 1232(%rsp)	# tmp542, MEM <vector(4) unsigned int> [(unsigned int *)&L + 592B]
+	.loc 2 190 5 is_stmt 1 view .LVU204
+# blake2s-internal.h:190:     L->f[0][l] = ctx->f[0];
+	.loc 2 190 16 is_stmt 0 view .LVU205
+	movd	616(%rdi), %xmm0	# MEM <struct blake2sp_ctx> [(const struct blake2s_ctx *)ctx_19(D)].S[4].f[0], tmp549
+	movd	744(%rdi), %xmm5	# MEM <struct blake2sp_ctx> [(const struct blake2s_ctx *)ctx_19(D)].S[5].f[0], tmp852
+# blake2s-internal.h:191:     L->f[1][l] = ctx->f[1];
+	.loc 2 191 16 view .LVU206
+	movd	1004(%rdi), %xmm7	# MEM <struct blake2sp_ctx> [(const struct blake2s_ctx *)ctx_19(D)].S[7].f[1], tmp854
+	movd	748(%rdi), %xmm6	# MEM <struct blake2sp_ctx> [(const struct blake2s_ctx *)ctx_19(D)].S[5].f[1], tmp856
+# blake2s-internal.h:190:     L->f[0][l] = ctx->f[0];
+	.loc 2 190 16 view .LVU207
+	punpckldq	%xmm5, %xmm0	# tmp852, tmp549
+.LBE53:
+.LBE59:
+.LBE61:
+# blake2sp.c:77:     if (ctx->S[0].buf_len) {
+	.loc 1 77 8 view .LVU208
+	movl	112(%rdi), %eax	# ctx_19(D)->S[0].buf_len,
+.LBB62:
+.LBB60:
+.LBB54:
+# blake2s-internal.h:190:     L->f[0][l] = ctx->f[0];
+	.loc 2 190 16 view .LVU209
+	punpcklqdq	%xmm3, %xmm0	# tmp547, tmp546
+# blake2s-internal.h:191:     L->f[1][l] = ctx->f[1];
+	.loc 2 191 16 view .LVU210
+	movd	876(%rdi), %xmm3	# MEM <struct blake2sp_ctx> [(const struct blake2s_ctx *)ctx_19(D)].S[6].f[1], tmp551
+# blake2s-internal.h:190:     L->f[0][l] = ctx->f[0];
+	.loc 2 190 16 view .LVU211
+	movaps	%xmm0, 1296(%rsp)	# tmp546, MEM <vector(4) unsigned int> [(unsigned int *)&L + 656B]
+	.loc 2 191 5 is_stmt 1 view .LVU212
+# blake2s-internal.h:191:     L->f[1][l] = ctx->f[1];
+	.loc 2 191 16 is_stmt 0 view .LVU213
+	movd	620(%rdi), %xmm0	# MEM <struct blake2sp_ctx> [(const struct blake2s_ctx *)ctx_19(D)].S[4].f[1], tmp553
+	punpckldq	%xmm7, %xmm3	# tmp854, tmp551
+	punpckldq	%xmm6, %xmm0	# tmp856, tmp553
+	punpcklqdq	%xmm3, %xmm0	# tmp551, tmp550
+	movaps	%xmm0, 1360(%rsp)	# tmp550, MEM <vector(4) unsigned int> [(unsigned int *)&L + 720B]
+.LVL17:
+	.loc 2 191 16 view .LVU214
+.LBE54:
+.LBE60:
+	.loc 1 74 34 is_stmt 1 view .LVU215
+	.loc 1 74 28 view .LVU216
+.LBE62:
+	.loc 1 77 5 view .LVU217
+# blake2sp.c:77:     if (ctx->S[0].buf_len) {
+	.loc 1 77 8 is_stmt 0 view .LVU218
+	testl	%eax, %eax	#
+	jne	.L6	#,
+	movdqa	.LC4(%rip), %xmm4	#, tmp626
+	movdqa	.LC2(%rip), %xmm5	#, tmp624
+	leaq	576(%rsp), %r14	#, tmp623
+	leaq	640(%rsp), %r15	#, tmp627
+	movdqa	.LC3(%rip), %xmm0	#, tmp625
+	movaps	%xmm4, 544(%rsp)	# tmp626, %sfp
+.LVL18:
+.L2:
+	.loc 1 85 12 is_stmt 1 discriminator 1 view .LVU219
+.LBB63:
+.LBB64:
+.LBB65:
+# blake2s-internal.h:208:     L->t[1][l] += (L->t[0][l] < inc);
+	.loc 2 208 31 is_stmt 0 discriminator 1 view .LVU220
+	psubd	544(%rsp), %xmm0	# %sfp, tmp625
+	salq	$9, %r13	#, tmp587
+.LVL19:
+	.loc 2 208 31 discriminator 1 view .LVU221
+	addq	%r12, %r13	# src, _135
+	movaps	%xmm0, 528(%rsp)	# tmp625, %sfp
+.LVL20:
+	.p2align 4,,10
+	.p2align 3
+.L3:
+	.loc 2 208 31 discriminator 1 view .LVU222
+.LBE65:
+.LBE64:
+	.loc 1 86 32 is_stmt 1 view .LVU223
+	.loc 1 87 13 view .LVU224
+.LBB83:
+.LBB66:
+# blake2s-internal.h:208:     L->t[1][l] += (L->t[0][l] < inc);
+	.loc 2 208 31 is_stmt 0 view .LVU225
+	pxor	%xmm1, %xmm1	# tmp596
+# blake2s-internal.h:207:     L->t[0][l] += inc;
+	.loc 2 207 16 view .LVU226
+	movdqa	%xmm5, %xmm3	# tmp624, vect__129.176
+.LBE66:
+.LBE83:
+# blake2sp.c:87:             m[i] = src + i*BLAKE2S_BLOCK;
+	.loc 1 87 24 view .LVU227
+	leaq	64(%r12), %rax	#, tmp608
+.LBE63:
+.LBB100:
+.LBB101:
+# blake2s-internal.h:100:     blake2s_kern->compress_lanes(L, m, mask);
+	.loc 2 100 5 view .LVU228
+	movq	%r14, %rsi	# tmp623,
+.LBE101:
+.LBE100:
+.LBB105:
+.LBB84:
+.LBB67:
+# blake2s-internal.h:207:     L->t[0][l] += inc;
+	.loc 2 207 16 view .LVU229
+	movdqa	1152(%rsp), %xmm4	# MEM <vector(4) unsigned int> [(unsigned int *)&L + 512B], vect__129.176
+.LBE67:
+.LBE84:
+.LBE105:
+.LBB106:
+.LBB102:
+# blake2s-internal.h:100:     blake2s_kern->compress_lanes(L, m, mask);
+	.loc 2 100 5 view .LVU230
+	movl	$255, %edx	#,
+	movq	%r15, %rdi	# tmp627,
+.LBE102:
+.LBE106:
+.LBB107:
+.LBB85:
+.LBB68:
+# blake2s-internal.h:208:     L->t[1][l] += (L->t[0][l] < inc);
+	.loc 2 208 31 view .LVU231
+	movdqa	544(%rsp), %xmm7	# %sfp, tmp626
+	movdqa	528(%rsp), %xmm6	# %sfp, tmp594
+.LBE68:
+.LBE85:
+# blake2sp.c:87:             m[i] = src + i*BLAKE2S_BLOCK;
+	.loc 1 87 24 view .LVU232
+	movq	%rax, 584(%rsp)	# tmp608, m[1]
+	leaq	128(%r12), %rax	#, tmp609
+.LBB86:
+.LBB69:
+# blake2s-internal.h:207:     L->t[0][l] += inc;
+	.loc 2 207 16 view .LVU233
+	paddd	%xmm5, %xmm4	# tmp624, vect__129.176
+.LBE69:
+.LBE86:
+# blake2sp.c:87:             m[i] = src + i*BLAKE2S_BLOCK;
+	.loc 1 87 24 view .LVU234
+	movq	%rax, 592(%rsp)	# tmp609, m[2]
+.LBB87:
+.LBB70:
+# blake2s-internal.h:207:     L->t[0][l] += inc;
+	.loc 2 207 16 view .LVU235
+	paddd	1168(%rsp), %xmm3	# MEM <vector(4) unsigned int> [(unsigned int *)&L + 528B], vect__129.176
+# blake2s-internal.h:208:     L->t[1][l] += (L->t[0][l] < inc);
+	.loc 2 208 31 view .LVU236
+	movdqa	%xmm4, %xmm0	# vect__129.176, tmp593
+.LBE70:
+.LBE87:
+# blake2sp.c:87:             m[i] = src + i*BLAKE2S_BLOCK;
+	.loc 1 87 24 view .LVU237
+	leaq	192(%r12), %rax	#, tmp610
+.LBB88:
+.LBB71:
+# blake2s-internal.h:208:     L->t[1][l] += (L->t[0][l] < inc);
+	.loc 2 208 16 view .LVU238
+	movdqa	1216(%rsp), %xmm2	# MEM <vector(4) unsigned int> [(unsigned int *)&L + 576B], vect__134.185
+.LBE71:
+.LBE88:
+# blake2sp.c:87:             m[i] = src + i*BLAKE2S_BLOCK;
+	.loc 1 87 18 view .LVU239
+	movq	%r12, 576(%rsp)	# src, m[0]
+	.loc 1 88 13 is_stmt 1 view .LVU240
+.LVL21:
+.LBB89:
+.LBI64:
+	.loc 2 205 20 view .LVU241
+.LBB72:
+	.loc 2 207 5 view .LVU242
+	.loc 2 208 5 view .LVU243
+# blake2s-internal.h:208:     L->t[1][l] += (L->t[0][l] < inc);
+	.loc 2 208 31 is_stmt 0 view .LVU244
+	psubd	%xmm7, %xmm0	# tmp626, tmp593
+.LBE72:
+.LBE89:
+# blake2sp.c:87:             m[i] = src + i*BLAKE2S_BLOCK;
+	.loc 1 87 24 view .LVU245
+	movq	%rax, 600(%rsp)	# tmp610, m[3]
+	leaq	256(%r12), %rax	#, tmp611
+.LBB90:
+.LBB73:
+# blake2s-internal.h:208:     L->t[1][l] += (L->t[0][l] < inc);
+	.loc 2 208 31 view .LVU246
+	pcmpgtd	%xmm6, %xmm0	# tmp594, tmp595
+.LBE73:
+.LBE90:
+# blake2sp.c:87:             m[i] = src + i*BLAKE2S_BLOCK;
+	.loc 1 87 24 view .LVU247
+	movq	%rax, 608(%rsp)	# tmp611, m[4]
+	leaq	320(%r12), %rax	#, tmp612
+	movq	%rax, 616(%rsp)	# tmp612, m[5]
+	leaq	384(%r12), %rax	#, tmp613
+	movq	%rax, 624(%rsp)	# tmp613, m[6]
+	leaq	448(%r12), %rax	#, tmp614
+.LBE107:
+# blake2sp.c:85:     for (; n; n--, src += BSP_STRIDE) {
+	.loc 1 85 24 view .LVU248
+	addq	$512, %r12	#, src
+.LVL22:
+.LBB108:
+.LBB91:
+.LBB74:
+# blake2s-internal.h:208:     L->t[1][l] += (L->t[0][l] < inc);
+	.loc 2 208 31 view .LVU249
+	pcmpeqd	%xmm1, %xmm0	# tmp596, tmp597
+.LBE74:
+.LBE91:
+# blake2sp.c:87:             m[i] = src + i*BLAKE2S_BLOCK;
+	.loc 1 87 24 view .LVU250
+	movq	%rax, 632(%rsp)	# tmp614, m[7]
+.LBE108:
+.LBB109:
+.LBB103:
+# blake2s-internal.h:100:     blake2s_kern->compress_lanes(L, m, mask);
+	.loc 2 100 5 view .LVU251
+	movq	blake2s_kern(%rip), %rax	# blake2s_kern, blake2s_kern
+.LBE103:
+.LBE109:
+.LBB110:
+.LBB92:
+.LBB75:
+# blake2s-internal.h:207:     L->t[0][l] += inc;
+	.loc 2 207 16 view .LVU252
+	movaps	%xmm5, 560(%rsp)	# tmp624, %sfp
+	movaps	%xmm4, 1152(%rsp)	# vect__129.176, MEM <vector(4) unsigned int> [(unsigned int *)&L + 512B]
+# blake2s-internal.h:208:     L->t[1][l] += (L->t[0][l] < inc);
+	.loc 2 208 16 view .LVU253
+	psubd	%xmm0, %xmm2	# tmp597, vect__134.185
+# blake2s-internal.h:208:     L->t[1][l] += (L->t[0][l] < inc);
+	.loc 2 208 31 view .LVU254
+	movdqa	%xmm3, %xmm0	# vect__129.176, tmp602
+# blake2s-internal.h:207:     L->t[0][l] += inc;
+	.loc 2 207 16 view .LVU255
+	movaps	%xmm3, 1168(%rsp)	# vect__129.176, MEM <vector(4) unsigned int> [(unsigned int *)&L + 528B]
+# blake2s-internal.h:208:     L->t[1][l] += (L->t[0][l] < inc);
+	.loc 2 208 31 view .LVU256
+	psubd	%xmm7, %xmm0	# tmp626, tmp602
+# blake2s-internal.h:208:     L->t[1][l] += (L->t[0][l] < inc);
+	.loc 2 208 16 view .LVU257
+	movaps	%xmm2, 1216(%rsp)	# vect__134.185, MEM <vector(4) unsigned int> [(unsigned int *)&L + 576B]
+# blake2s-internal.h:208:     L->t[1][l] += (L->t[0][l] < inc);
+	.loc 2 208 31 view .LVU258
+	pcmpgtd	%xmm6, %xmm0	# tmp594, tmp604
+	pcmpeqd	%xmm1, %xmm0	# tmp596, tmp606
+# blake2s-internal.h:208:     L->t[1][l] += (L->t[0][l] < inc);
+	.loc 2 208 16 view .LVU259
+	movdqa	1232(%rsp), %xmm1	# MEM <vector(4) unsigned int> [(unsigned int *)&L + 592B], vect__134.185
+	psubd	%xmm0, %xmm1	# tmp606, vect__134.185
+.LVL23:
+	.loc 2 208 16 view .LVU260
+.LBE75:
+.LBE92:
+	.loc 1 86 38 is_stmt 1 view .LVU261
+	.loc 1 86 32 view .LVU262
+	.loc 1 87 13 view .LVU263
+	.loc 1 88 13 view .LVU264
+.LBB93:
+	.loc 2 205 20 view .LVU265
+.LBB76:
+	.loc 2 207 5 view .LVU266
+	.loc 2 208 5 view .LVU267
+	.loc 2 208 5 is_stmt 0 view .LVU268
+.LBE76:
+.LBE93:
+	.loc 1 86 38 is_stmt 1 view .LVU269
+	.loc 1 86 32 view .LVU270
+	.loc 1 87 13 view .LVU271
+	.loc 1 88 13 view .LVU272
+.LBB94:
+	.loc 2 205 20 view .LVU273
+.LBB77:
+	.loc 2 207 5 view .LVU274
+	.loc 2 208 5 view .LVU275
+	.loc 2 208 5 is_stmt 0 view .LVU276
+.LBE77:
+.LBE94:
+	.loc 1 86 38 is_stmt 1 view .LVU277
+	.loc 1 86 32 view .LVU278
+	.loc 1 87 13 view .LVU279
+	.loc 1 88 13 view .LVU280
+.LBB95:
+	.loc 2 205 20 view .LVU281
+.LBB78:
+	.loc 2 207 5 view .LVU282
+	.loc 2 208 5 view .LVU283
+	.loc 2 208 5 is_stmt 0 view .LVU284
+.LBE78:
+.LBE95:
+	.loc 1 86 38 is_stmt 1 view .LVU285
+	.loc 1 86 32 view .LVU286
+	.loc 1 87 13 view .LVU287
+	.loc 1 88 13 view .LVU288
+.LBB96:
+	.loc 2 205 20 view .LVU289
+.LBB79:
+	.loc 2 207 5 view .LVU290
+	.loc 2 208 5 view .LVU291
+	.loc 2 208 5 is_stmt 0 view .LVU292
+.LBE79:
+.LBE96:
+	.loc 1 86 38 is_stmt 1 view .LVU293
+	.loc 1 86 32 view .LVU294
+	.loc 1 87 13 view .LVU295
+	.loc 1 88 13 view .LVU296
+.LBB97:
+	.loc 2 205 20 view .LVU297
+.LBB80:
+	.loc 2 207 5 view .LVU298
+	.loc 2 208 5 view .LVU299
+	.loc 2 208 5 is_stmt 0 view .LVU300
+.LBE80:
+.LBE97:
+	.loc 1 86 38 is_stmt 1 view .LVU301
+	.loc 1 86 32 view .LVU302
+	.loc 1 87 13 view .LVU303
+	.loc 1 88 13 view .LVU304
+.LBB98:
+	.loc 2 205 20 view .LVU305
+.LBB81:
+	.loc 2 207 5 view .LVU306
+	.loc 2 208 5 view .LVU307
+	.loc 2 208 5 is_stmt 0 view .LVU308
+.LBE81:
+.LBE98:
+	.loc 1 86 38 is_stmt 1 view .LVU309
+	.loc 1 86 32 view .LVU310
+	.loc 1 87 13 view .LVU311
+	.loc 1 88 13 view .LVU312
+.LBB99:
+	.loc 2 205 20 view .LVU313
+.LBB82:
+	.loc 2 207 5 view .LVU314
+	.loc 2 208 5 view .LVU315
+# blake2s-internal.h:208:     L->t[1][l] += (L->t[0][l] < inc);
+	.loc 2 208 16 is_stmt 0 view .LVU316
+	movaps	%xmm1, 1232(%rsp)	# vect__134.185, MEM <vector(4) unsigned int> [(unsigned int *)&L + 592B]
+.LVL24:
+	.loc 2 208 16 view .LVU317
+.LBE82:
+.LBE99:
+	.loc 1 86 38 is_stmt 1 view .LVU318
+	.loc 1 86 32 view .LVU319
+.LBE110:
+	.loc 1 90 9 view .LVU320
+.LBB111:
+.LBI100:
+	.loc 2 97 20 view .LVU321
+.LBB104:
+	.loc 2 100 5 view .LVU322
+	call	*40(%rax)	# blake2s_kern.0_56->compress_lanes
+.LVL25:
+	.loc 2 100 5 is_stmt 0 view .LVU323
+.LBE104:
+.LBE111:
+	.loc 1 85 18 is_stmt 1 view .LVU324
+	.loc 1 85 12 view .LVU325
+	cmpq	%r13, %r12	# _135, src
+	movdqa	560(%rsp), %xmm5	# %sfp, tmp624
+	jne	.L3	#,
+.LVL26:
+.LBB112:
+.LBB113:
+.LBB114:
+.LBB115:
+	.loc 2 197 28 view .LVU326
+	.loc 2 198 9 view .LVU327
+	.loc 2 197 34 view .LVU328
+	.loc 2 197 28 view .LVU329
+	.loc 2 198 9 view .LVU330
+	.loc 2 197 34 view .LVU331
+	.loc 2 197 28 view .LVU332
+	.loc 2 198 9 view .LVU333
+	.loc 2 197 34 view .LVU334
+	.loc 2 197 28 view .LVU335
+	.loc 2 198 9 view .LVU336
+	.loc 2 197 34 view .LVU337
+	.loc 2 197 28 view .LVU338
+	.loc 2 198 9 view .LVU339
+	.loc 2 197 34 view .LVU340
+	.loc 2 197 28 view .LVU341
+	.loc 2 198 9 view .LVU342
+	.loc 2 197 34 view .LVU343
+	.loc 2 197 28 view .LVU344
+	.loc 2 198 9 view .LVU345
+	.loc 2 197 34 view .LVU346
+	.loc 2 197 28 view .LVU347
+	.loc 2 198 9 view .LVU348
+# blake2s-internal.h:198:         ctx->H[i] = L->H[i][l];
+	.loc 2 198 19 is_stmt 0 view .LVU349
+	movl	640(%rsp), %eax	# BIT_FIELD_REF <MEM <const vector(4) unsigned int> [(unsigned int *)&L], 32, 0>, BIT_FIELD_REF <MEM <const vector(4) unsigned int> [(unsigned int *)&L], 32, 0>
+	movl	%eax, (%rbx)	# BIT_FIELD_REF <MEM <const vector(4) unsigned int> [(unsigned int *)&L], 32, 0>, MEM <unsigned int> [(struct blake2s_ctx *)ctx_19(D)]
+	movl	644(%rsp), %eax	# BIT_FIELD_REF <MEM <const vector(4) unsigned int> [(unsigned int *)&L], 32, 32>, _699
+	movl	%eax, 128(%rbx)	# _699, MEM <unsigned int> [(struct blake2s_ctx *)ctx_19(D) + 128B]
+	movl	648(%rsp), %eax	# BIT_FIELD_REF <MEM <const vector(4) unsigned int> [(unsigned int *)&L], 32, 64>, _244
+	movl	%eax, 256(%rbx)	# _244, MEM <unsigned int> [(struct blake2s_ctx *)ctx_19(D) + 256B]
+	movl	652(%rsp), %eax	# BIT_FIELD_REF <MEM <const vector(4) unsigned int> [(unsigned int *)&L], 32, 96>, _259
+	movl	%eax, 384(%rbx)	# _259, MEM <unsigned int> [(struct blake2s_ctx *)ctx_19(D) + 384B]
+	movl	704(%rsp), %eax	# BIT_FIELD_REF <MEM <const vector(4) unsigned int> [(unsigned int *)&L + 64B], 32, 0>, _274
+	movl	%eax, 4(%rbx)	# _274, MEM <unsigned int> [(struct blake2s_ctx *)ctx_19(D) + 4B]
+	movl	708(%rsp), %eax	# BIT_FIELD_REF <MEM <const vector(4) unsigned int> [(unsigned int *)&L + 64B], 32, 32>, _38
+	movl	%eax, 132(%rbx)	# _38, MEM <unsigned int> [(struct blake2s_ctx *)ctx_19(D) + 132B]
+	movl	712(%rsp), %eax	# BIT_FIELD_REF <MEM <const vector(4) unsigned int> [(unsigned int *)&L + 64B], 32, 64>, _33
+	movl	%eax, 260(%rbx)	# _33, MEM <unsigned int> [(struct blake2s_ctx *)ctx_19(D) + 260B]
+	movl	716(%rsp), %eax	# BIT_FIELD_REF <MEM <const vector(4) unsigned int> [(unsigned int *)&L + 64B], 32, 96>, _446
+	movl	%eax, 388(%rbx)	# _446, MEM <unsigned int> [(struct blake2s_ctx *)ctx_19(D) + 388B]
+	movl	768(%rsp), %eax	# BIT_FIELD_REF <MEM <const vector(4) unsigned int> [(unsigned int *)&L + 128B], 32, 0>, _58
+	movl	%eax, 8(%rbx)	# _58, MEM <unsigned int> [(struct blake2s_ctx *)ctx_19(D) + 8B]
+	movl	772(%rsp), %eax	# BIT_FIELD_REF <MEM <const vector(4) unsigned int> [(unsigned int *)&L + 128B], 32, 32>, _2
+	movl	%eax, 136(%rbx)	# _2, MEM <unsigned int> [(struct blake2s_ctx *)ctx_19(D) + 136B]
+	movl	776(%rsp), %eax	# BIT_FIELD_REF <MEM <const vector(4) unsigned int> [(unsigned int *)&L + 128B], 32, 64>, _42
+	movl	%eax, 264(%rbx)	# _42, MEM <unsigned int> [(struct blake2s_ctx *)ctx_19(D) + 264B]
+	movl	780(%rsp), %eax	# BIT_FIELD_REF <MEM <const vector(4) unsigned int> [(unsigned int *)&L + 128B], 32, 96>, _45
+	movl	%eax, 392(%rbx)	# _45, MEM <unsigned int> [(struct blake2s_ctx *)ctx_19(D) + 392B]
+	movl	832(%rsp), %eax	# BIT_FIELD_REF <MEM <const vector(4) unsigned int> [(unsigned int *)&L + 192B], 32, 0>, _345
+	movl	%eax, 12(%rbx)	# _345, MEM <unsigned int> [(struct blake2s_ctx *)ctx_19(D) + 12B]
+	movl	836(%rsp), %eax	# BIT_FIELD_REF <MEM <const vector(4) unsigned int> [(unsigned int *)&L + 192B], 32, 32>, _84
+	movl	%eax, 140(%rbx)	# _84, MEM <unsigned int> [(struct blake2s_ctx *)ctx_19(D) + 140B]
+	movl	840(%rsp), %eax	# BIT_FIELD_REF <MEM <const vector(4) unsigned int> [(unsigned int *)&L + 192B], 32, 64>, _99
+	movl	%eax, 268(%rbx)	# _99, MEM <unsigned int> [(struct blake2s_ctx *)ctx_19(D) + 268B]
+	movl	844(%rsp), %eax	# BIT_FIELD_REF <MEM <const vector(4) unsigned int> [(unsigned int *)&L + 192B], 32, 96>, _114
+	movl	%eax, 396(%rbx)	# _114, MEM <unsigned int> [(struct blake2s_ctx *)ctx_19(D) + 396B]
+	movl	896(%rsp), %eax	# BIT_FIELD_REF <MEM <const vector(4) unsigned int> [(unsigned int *)&L + 256B], 32, 0>, _285
+	movl	%eax, 16(%rbx)	# _285, MEM <unsigned int> [(struct blake2s_ctx *)ctx_19(D) + 16B]
+	movl	900(%rsp), %eax	# BIT_FIELD_REF <MEM <const vector(4) unsigned int> [(unsigned int *)&L + 256B], 32, 32>, _184
+	movl	%eax, 144(%rbx)	# _184, MEM <unsigned int> [(struct blake2s_ctx *)ctx_19(D) + 144B]
+	movl	904(%rsp), %eax	# BIT_FIELD_REF <MEM <const vector(4) unsigned int> [(unsigned int *)&L + 256B], 32, 64>, _92
+	movl	%eax, 272(%rbx)	# _92, MEM <unsigned int> [(struct blake2s_ctx *)ctx_19(D) + 272B]
+	movl	908(%rsp), %eax	# BIT_FIELD_REF <MEM <const vector(4) unsigned int> [(unsigned int *)&L + 256B], 32, 96>, _63
+	movl	%eax, 400(%rbx)	# _63, MEM <unsigned int> [(struct blake2s_ctx *)ctx_19(D) + 400B]
+	movl	960(%rsp), %eax	# BIT_FIELD_REF <MEM <const vector(4) unsigned int> [(unsigned int *)&L + 320B], 32, 0>, _355
+	movl	%eax, 20(%rbx)	# _355, MEM <unsigned int> [(struct blake2s_ctx *)ctx_19(D) + 20B]
+	movl	964(%rsp), %eax	# BIT_FIELD_REF <MEM <const vector(4) unsigned int> [(unsigned int *)&L + 320B], 32, 32>, _28
+	movl	%eax, 148(%rbx)	# _28, MEM <unsigned int> [(struct blake2s_ctx *)ctx_19(D) + 148B]
+	movl	968(%rsp), %eax	# BIT_FIELD_REF <MEM <const vector(4) unsigned int> [(unsigned int *)&L + 320B], 32, 64>, _335
+	movl	%eax, 276(%rbx)	# _335, MEM <unsigned int> [(struct blake2s_ctx *)ctx_19(D) + 276B]
+	movl	972(%rsp), %eax	# BIT_FIELD_REF <MEM <const vector(4) unsigned int> [(unsigned int *)&L + 320B], 32, 96>, _323
+	movl	%eax, 404(%rbx)	# _323, MEM <unsigned int> [(struct blake2s_ctx *)ctx_19(D) + 404B]
+	movl	1024(%rsp), %eax	# BIT_FIELD_REF <MEM <const vector(4) unsigned int> [(unsigned int *)&L + 384B], 32, 0>, _91
+	movl	%eax, 24(%rbx)	# _91, MEM <unsigned int> [(struct blake2s_ctx *)ctx_19(D) + 24B]
+	movl	1028(%rsp), %eax	# BIT_FIELD_REF <MEM <const vector(4) unsigned int> [(unsigned int *)&L + 384B], 32, 32>, _55
+	movl	%eax, 152(%rbx)	# _55, MEM <unsigned int> [(struct blake2s_ctx *)ctx_19(D) + 152B]
+	movl	1032(%rsp), %eax	# BIT_FIELD_REF <MEM <const vector(4) unsigned int> [(unsigned int *)&L + 384B], 32, 64>, _392
+	movl	%eax, 280(%rbx)	# _392, MEM <unsigned int> [(struct blake2s_ctx *)ctx_19(D) + 280B]
+	movl	1036(%rsp), %eax	# BIT_FIELD_REF <MEM <const vector(4) unsigned int> [(unsigned int *)&L + 384B], 32, 96>, _424
+	movl	%eax, 408(%rbx)	# _424, MEM <unsigned int> [(struct blake2s_ctx *)ctx_19(D) + 408B]
+	movl	1088(%rsp), %eax	# BIT_FIELD_REF <MEM <const vector(4) unsigned int> [(unsigned int *)&L + 448B], 32, 0>, _434
+	movl	%eax, 28(%rbx)	# _434, MEM <unsigned int> [(struct blake2s_ctx *)ctx_19(D) + 28B]
+	movl	1092(%rsp), %eax	# BIT_FIELD_REF <MEM <const vector(4) unsigned int> [(unsigned int *)&L + 448B], 32, 32>, _440
+	movl	%eax, 156(%rbx)	# _440, MEM <unsigned int> [(struct blake2s_ctx *)ctx_19(D) + 156B]
+	movl	1096(%rsp), %eax	# BIT_FIELD_REF <MEM <const vector(4) unsigned int> [(unsigned int *)&L + 448B], 32, 64>, _414
+	movl	%eax, 284(%rbx)	# _414, MEM <unsigned int> [(struct blake2s_ctx *)ctx_19(D) + 284B]
+	movl	1100(%rsp), %eax	# BIT_FIELD_REF <MEM <const vector(4) unsigned int> [(unsigned int *)&L + 448B], 32, 96>, _384
+	movl	%eax, 412(%rbx)	# _384, MEM <unsigned int> [(struct blake2s_ctx *)ctx_19(D) + 412B]
+	.loc 2 197 34 is_stmt 1 view .LVU350
+.LVL27:
+	.loc 2 197 28 view .LVU351
+.LBE115:
+	.loc 2 199 5 view .LVU352
+	.loc 2 200 5 view .LVU353
+	.loc 2 201 5 view .LVU354
+	.loc 2 202 5 view .LVU355
+# blake2s-internal.h:202:     ctx->f[1] = L->f[1][l];
+	.loc 2 202 15 is_stmt 0 view .LVU356
+	movl	1152(%rsp), %eax	# BIT_FIELD_REF <MEM <const vector(4) unsigned int> [(unsigned int *)&L + 512B], 32, 0>, BIT_FIELD_REF <MEM <const vector(4) unsigned int> [(unsigned int *)&L + 512B], 32, 0>
+	movl	%eax, 96(%rbx)	# BIT_FIELD_REF <MEM <const vector(4) unsigned int> [(unsigned int *)&L + 512B], 32, 0>, MEM <unsigned int> [(struct blake2s_ctx *)ctx_19(D) + 96B]
+	movl	1156(%rsp), %eax	# BIT_FIELD_REF <MEM <const vector(4) unsigned int> [(unsigned int *)&L + 512B], 32, 32>, _737
+	movl	%eax, 224(%rbx)	# _737, MEM <unsigned int> [(struct blake2s_ctx *)ctx_19(D) + 224B]
+	movl	1160(%rsp), %eax	# BIT_FIELD_REF <MEM <const vector(4) unsigned int> [(unsigned int *)&L + 512B], 32, 64>, _81
+	movl	%eax, 352(%rbx)	# _81, MEM <unsigned int> [(struct blake2s_ctx *)ctx_19(D) + 352B]
+	movl	1164(%rsp), %eax	# BIT_FIELD_REF <MEM <const vector(4) unsigned int> [(unsigned int *)&L + 512B], 32, 96>, _78
+	movl	%eax, 480(%rbx)	# _78, MEM <unsigned int> [(struct blake2s_ctx *)ctx_19(D) + 480B]
+	movl	1216(%rsp), %eax	# BIT_FIELD_REF <MEM <const vector(4) unsigned int> [(unsigned int *)&L + 576B], 32, 0>, _270
+	movl	%eax, 100(%rbx)	# _270, MEM <unsigned int> [(struct blake2s_ctx *)ctx_19(D) + 100B]
+	movl	1220(%rsp), %eax	# BIT_FIELD_REF <MEM <const vector(4) unsigned int> [(unsigned int *)&L + 576B], 32, 32>, _255
+	movl	%eax, 228(%rbx)	# _255, MEM <unsigned int> [(struct blake2s_ctx *)ctx_19(D) + 228B]
+	movl	1224(%rsp), %eax	# BIT_FIELD_REF <MEM <const vector(4) unsigned int> [(unsigned int *)&L + 576B], 32, 64>, _69
+	movl	%eax, 356(%rbx)	# _69, MEM <unsigned int> [(struct blake2s_ctx *)ctx_19(D) + 356B]
+	movl	1228(%rsp), %eax	# BIT_FIELD_REF <MEM <const vector(4) unsigned int> [(unsigned int *)&L + 576B], 32, 96>, _22
+	movl	%eax, 484(%rbx)	# _22, MEM <unsigned int> [(struct blake2s_ctx *)ctx_19(D) + 484B]
+	movl	1280(%rsp), %eax	# BIT_FIELD_REF <MEM <const vector(4) unsigned int> [(unsigned int *)&L + 640B], 32, 0>, _71
+	movl	%eax, 104(%rbx)	# _71, MEM <unsigned int> [(struct blake2s_ctx *)ctx_19(D) + 104B]
+	movl	1284(%rsp), %eax	# BIT_FIELD_REF <MEM <const vector(4) unsigned int> [(unsigned int *)&L + 640B], 32, 32>, _115
+	movl	%eax, 232(%rbx)	# _115, MEM <unsigned int> [(struct blake2s_ctx *)ctx_19(D) + 232B]
+	movl	1288(%rsp), %eax	# BIT_FIELD_REF <MEM <const vector(4) unsigned int> [(unsigned int *)&L + 640B], 32, 64>, _100
+	movl	%eax, 360(%rbx)	# _100, MEM <unsigned int> [(struct blake2s_ctx *)ctx_19(D) + 360B]
+	movl	1292(%rsp), %eax	# BIT_FIELD_REF <MEM <const vector(4) unsigned int> [(unsigned int *)&L + 640B], 32, 96>, _85
+	movl	%eax, 488(%rbx)	# _85, MEM <unsigned int> [(struct blake2s_ctx *)ctx_19(D) + 488B]
+	movl	1344(%rsp), %eax	# BIT_FIELD_REF <MEM <const vector(4) unsigned int> [(unsigned int *)&L + 704B], 32, 0>, _753
+	movl	%eax, 108(%rbx)	# _753, MEM <unsigned int> [(struct blake2s_ctx *)ctx_19(D) + 108B]
+	movl	1348(%rsp), %eax	# BIT_FIELD_REF <MEM <const vector(4) unsigned int> [(unsigned int *)&L + 704B], 32, 32>, _756
+	movl	%eax, 236(%rbx)	# _756, MEM <unsigned int> [(struct blake2s_ctx *)ctx_19(D) + 236B]
+	movl	1352(%rsp), %eax	# BIT_FIELD_REF <MEM <const vector(4) unsigned int> [(unsigned int *)&L + 704B], 32, 64>, _759
+	movl	%eax, 364(%rbx)	# _759, MEM <unsigned int> [(struct blake2s_ctx *)ctx_19(D) + 364B]
+	movl	1356(%rsp), %eax	# BIT_FIELD_REF <MEM <const vector(4) unsigned int> [(unsigned int *)&L + 704B], 32, 96>, _762
+	movl	%eax, 492(%rbx)	# _762, MEM <unsigned int> [(struct blake2s_ctx *)ctx_19(D) + 492B]
+.LVL28:
+	.loc 2 202 15 view .LVU357
+.LBE114:
+.LBE113:
+	.loc 1 92 34 is_stmt 1 view .LVU358
+	.loc 1 92 28 view .LVU359
+.LBB118:
+.LBB117:
+.LBB116:
+	.loc 2 197 28 view .LVU360
+	.loc 2 198 9 view .LVU361
+	.loc 2 197 34 view .LVU362
+	.loc 2 197 28 view .LVU363
+	.loc 2 198 9 view .LVU364
+	.loc 2 197 34 view .LVU365
+	.loc 2 197 28 view .LVU366
+	.loc 2 198 9 view .LVU367
+	.loc 2 197 34 view .LVU368
+	.loc 2 197 28 view .LVU369
+	.loc 2 198 9 view .LVU370
+	.loc 2 197 34 view .LVU371
+	.loc 2 197 28 view .LVU372
+	.loc 2 198 9 view .LVU373
+	.loc 2 197 34 view .LVU374
+	.loc 2 197 28 view .LVU375
+	.loc 2 198 9 view .LVU376
+	.loc 2 197 34 view .LVU377
+	.loc 2 197 28 view .LVU378
+	.loc 2 198 9 view .LVU379
+	.loc 2 197 34 view .LVU380
+	.loc 2 197 28 view .LVU381
+	.loc 2 198 9 view .LVU382
+# blake2s-internal.h:198:         ctx->H[i] = L->H[i][l];
+	.loc 2 198 19 is_stmt 0 view .LVU383
+	movl	656(%rsp), %eax	# BIT_FIELD_REF <MEM <const vector(4) unsigned int> [(unsigned int *)&L + 16B], 32, 0>, BIT_FIELD_REF <MEM <const vector(4) unsigned int> [(unsigned int *)&L + 16B], 32, 0>
+	movl	%eax, 512(%rbx)	# BIT_FIELD_REF <MEM <const vector(4) unsigned int> [(unsigned int *)&L + 16B], 32, 0>, MEM <unsigned int> [(struct blake2s_ctx *)ctx_19(D) + 512B]
+	movl	660(%rsp), %eax	# BIT_FIELD_REF <MEM <const vector(4) unsigned int> [(unsigned int *)&L + 16B], 32, 32>, _306
+	movl	%eax, 640(%rbx)	# _306, MEM <unsigned int> [(struct blake2s_ctx *)ctx_19(D) + 640B]
+	movl	664(%rsp), %eax	# BIT_FIELD_REF <MEM <const vector(4) unsigned int> [(unsigned int *)&L + 16B], 32, 64>, _303
+	movl	%eax, 768(%rbx)	# _303, MEM <unsigned int> [(struct blake2s_ctx *)ctx_19(D) + 768B]
+	movl	668(%rsp), %eax	# BIT_FIELD_REF <MEM <const vector(4) unsigned int> [(unsigned int *)&L + 16B], 32, 96>, _300
+	movl	%eax, 896(%rbx)	# _300, MEM <unsigned int> [(struct blake2s_ctx *)ctx_19(D) + 896B]
+	movl	720(%rsp), %eax	# BIT_FIELD_REF <MEM <const vector(4) unsigned int> [(unsigned int *)&L + 80B], 32, 0>, _296
+	movl	%eax, 516(%rbx)	# _296, MEM <unsigned int> [(struct blake2s_ctx *)ctx_19(D) + 516B]
+	movl	724(%rsp), %eax	# BIT_FIELD_REF <MEM <const vector(4) unsigned int> [(unsigned int *)&L + 80B], 32, 32>, _293
+	movl	%eax, 644(%rbx)	# _293, MEM <unsigned int> [(struct blake2s_ctx *)ctx_19(D) + 644B]
+	movl	728(%rsp), %eax	# BIT_FIELD_REF <MEM <const vector(4) unsigned int> [(unsigned int *)&L + 80B], 32, 64>, _290
+	movl	%eax, 772(%rbx)	# _290, MEM <unsigned int> [(struct blake2s_ctx *)ctx_19(D) + 772B]
+	movl	732(%rsp), %eax	# BIT_FIELD_REF <MEM <const vector(4) unsigned int> [(unsigned int *)&L + 80B], 32, 96>, _287
+	movl	%eax, 900(%rbx)	# _287, MEM <unsigned int> [(struct blake2s_ctx *)ctx_19(D) + 900B]
+	movl	784(%rsp), %eax	# BIT_FIELD_REF <MEM <const vector(4) unsigned int> [(unsigned int *)&L + 144B], 32, 0>, _283
+	movl	%eax, 520(%rbx)	# _283, MEM <unsigned int> [(struct blake2s_ctx *)ctx_19(D) + 520B]
+	movl	788(%rsp), %eax	# BIT_FIELD_REF <MEM <const vector(4) unsigned int> [(unsigned int *)&L + 144B], 32, 32>, _278
+	movl	%eax, 648(%rbx)	# _278, MEM <unsigned int> [(struct blake2s_ctx *)ctx_19(D) + 648B]
+	movl	792(%rsp), %eax	# BIT_FIELD_REF <MEM <const vector(4) unsigned int> [(unsigned int *)&L + 144B], 32, 64>, _273
+	movl	%eax, 776(%rbx)	# _273, MEM <unsigned int> [(struct blake2s_ctx *)ctx_19(D) + 776B]
+	movl	796(%rsp), %eax	# BIT_FIELD_REF <MEM <const vector(4) unsigned int> [(unsigned int *)&L + 144B], 32, 96>, _268
+	movl	%eax, 904(%rbx)	# _268, MEM <unsigned int> [(struct blake2s_ctx *)ctx_19(D) + 904B]
+	movl	848(%rsp), %eax	# BIT_FIELD_REF <MEM <const vector(4) unsigned int> [(unsigned int *)&L + 208B], 32, 0>, _261
+	movl	%eax, 524(%rbx)	# _261, MEM <unsigned int> [(struct blake2s_ctx *)ctx_19(D) + 524B]
+	movl	852(%rsp), %eax	# BIT_FIELD_REF <MEM <const vector(4) unsigned int> [(unsigned int *)&L + 208B], 32, 32>, _252
+	movl	%eax, 652(%rbx)	# _252, MEM <unsigned int> [(struct blake2s_ctx *)ctx_19(D) + 652B]
+	movl	856(%rsp), %eax	# BIT_FIELD_REF <MEM <const vector(4) unsigned int> [(unsigned int *)&L + 208B], 32, 64>, _246
+	movl	%eax, 780(%rbx)	# _246, MEM <unsigned int> [(struct blake2s_ctx *)ctx_19(D) + 780B]
+	movl	860(%rsp), %eax	# BIT_FIELD_REF <MEM <const vector(4) unsigned int> [(unsigned int *)&L + 208B], 32, 96>, _241
+	movl	%eax, 908(%rbx)	# _241, MEM <unsigned int> [(struct blake2s_ctx *)ctx_19(D) + 908B]
+	movl	912(%rsp), %eax	# BIT_FIELD_REF <MEM <const vector(4) unsigned int> [(unsigned int *)&L + 272B], 32, 0>, _226
+	movl	%eax, 528(%rbx)	# _226, MEM <unsigned int> [(struct blake2s_ctx *)ctx_19(D) + 528B]
+	movl	916(%rsp), %eax	# BIT_FIELD_REF <MEM <const vector(4) unsigned int> [(unsigned int *)&L + 272B], 32, 32>, _213
+	movl	%eax, 656(%rbx)	# _213, MEM <unsigned int> [(struct blake2s_ctx *)ctx_19(D) + 656B]
+	movl	920(%rsp), %eax	# BIT_FIELD_REF <MEM <const vector(4) unsigned int> [(unsigned int *)&L + 272B], 32, 64>, _200
+	movl	%eax, 784(%rbx)	# _200, MEM <unsigned int> [(struct blake2s_ctx *)ctx_19(D) + 784B]
+	movl	924(%rsp), %eax	# BIT_FIELD_REF <MEM <const vector(4) unsigned int> [(unsigned int *)&L + 272B], 32, 96>, _196
+	movl	%eax, 912(%rbx)	# _196, MEM <unsigned int> [(struct blake2s_ctx *)ctx_19(D) + 912B]
+	movl	976(%rsp), %eax	# BIT_FIELD_REF <MEM <const vector(4) unsigned int> [(unsigned int *)&L + 336B], 32, 0>, _182
+	movl	%eax, 532(%rbx)	# _182, MEM <unsigned int> [(struct blake2s_ctx *)ctx_19(D) + 532B]
+	movl	980(%rsp), %eax	# BIT_FIELD_REF <MEM <const vector(4) unsigned int> [(unsigned int *)&L + 336B], 32, 32>, _169
+	movl	%eax, 660(%rbx)	# _169, MEM <unsigned int> [(struct blake2s_ctx *)ctx_19(D) + 660B]
+	movl	984(%rsp), %eax	# BIT_FIELD_REF <MEM <const vector(4) unsigned int> [(unsigned int *)&L + 336B], 32, 64>, _155
+	movl	%eax, 788(%rbx)	# _155, MEM <unsigned int> [(struct blake2s_ctx *)ctx_19(D) + 788B]
+	movl	988(%rsp), %eax	# BIT_FIELD_REF <MEM <const vector(4) unsigned int> [(unsigned int *)&L + 336B], 32, 96>, _152
+	movl	%eax, 916(%rbx)	# _152, MEM <unsigned int> [(struct blake2s_ctx *)ctx_19(D) + 916B]
+	movl	1040(%rsp), %eax	# BIT_FIELD_REF <MEM <const vector(4) unsigned int> [(unsigned int *)&L + 400B], 32, 0>, _137
+	movl	%eax, 536(%rbx)	# _137, MEM <unsigned int> [(struct blake2s_ctx *)ctx_19(D) + 536B]
+	movl	1044(%rsp), %eax	# BIT_FIELD_REF <MEM <const vector(4) unsigned int> [(unsigned int *)&L + 400B], 32, 32>, _125
+	movl	%eax, 664(%rbx)	# _125, MEM <unsigned int> [(struct blake2s_ctx *)ctx_19(D) + 664B]
+	movl	1048(%rsp), %eax	# BIT_FIELD_REF <MEM <const vector(4) unsigned int> [(unsigned int *)&L + 400B], 32, 64>, _122
+	movl	%eax, 792(%rbx)	# _122, MEM <unsigned int> [(struct blake2s_ctx *)ctx_19(D) + 792B]
+	movl	1052(%rsp), %eax	# BIT_FIELD_REF <MEM <const vector(4) unsigned int> [(unsigned int *)&L + 400B], 32, 96>, _117
+	movl	%eax, 920(%rbx)	# _117, MEM <unsigned int> [(struct blake2s_ctx *)ctx_19(D) + 920B]
+	movl	1104(%rsp), %eax	# BIT_FIELD_REF <MEM <const vector(4) unsigned int> [(unsigned int *)&L + 464B], 32, 0>, _111
+	movl	%eax, 540(%rbx)	# _111, MEM <unsigned int> [(struct blake2s_ctx *)ctx_19(D) + 540B]
+	movl	1108(%rsp), %eax	# BIT_FIELD_REF <MEM <const vector(4) unsigned int> [(unsigned int *)&L + 464B], 32, 32>, _106
+	movl	%eax, 668(%rbx)	# _106, MEM <unsigned int> [(struct blake2s_ctx *)ctx_19(D) + 668B]
+	movl	1112(%rsp), %eax	# BIT_FIELD_REF <MEM <const vector(4) unsigned int> [(unsigned int *)&L + 464B], 32, 64>, _101
+	movl	%eax, 796(%rbx)	# _101, MEM <unsigned int> [(struct blake2s_ctx *)ctx_19(D) + 796B]
+	movl	1116(%rsp), %eax	# BIT_FIELD_REF <MEM <const vector(4) unsigned int> [(unsigned int *)&L + 464B], 32, 96>, _96
+	movl	%eax, 924(%rbx)	# _96, MEM <unsigned int> [(struct blake2s_ctx *)ctx_19(D) + 924B]
+	.loc 2 197 34 is_stmt 1 view .LVU384
+.LVL29:
+	.loc 2 197 28 view .LVU385
+.LBE116:
+	.loc 2 199 5 view .LVU386
+	.loc 2 200 5 view .LVU387
+	.loc 2 201 5 view .LVU388
+	.loc 2 202 5 view .LVU389
+# blake2s-internal.h:202:     ctx->f[1] = L->f[1][l];
+	.loc 2 202 15 is_stmt 0 view .LVU390
+	movl	1168(%rsp), %eax	# BIT_FIELD_REF <MEM <const vector(4) unsigned int> [(unsigned int *)&L + 528B], 32, 0>, BIT_FIELD_REF <MEM <const vector(4) unsigned int> [(unsigned int *)&L + 528B], 32, 0>
+	movl	%eax, 608(%rbx)	# BIT_FIELD_REF <MEM <const vector(4) unsigned int> [(unsigned int *)&L + 528B], 32, 0>, MEM <unsigned int> [(struct blake2s_ctx *)ctx_19(D) + 608B]
+	movl	1172(%rsp), %eax	# BIT_FIELD_REF <MEM <const vector(4) unsigned int> [(unsigned int *)&L + 528B], 32, 32>, _31
+	movl	%eax, 736(%rbx)	# _31, MEM <unsigned int> [(struct blake2s_ctx *)ctx_19(D) + 736B]
+	movl	1176(%rsp), %eax	# BIT_FIELD_REF <MEM <const vector(4) unsigned int> [(unsigned int *)&L + 528B], 32, 64>, _16
+	movl	%eax, 864(%rbx)	# _16, MEM <unsigned int> [(struct blake2s_ctx *)ctx_19(D) + 864B]
+	movl	1180(%rsp), %eax	# BIT_FIELD_REF <MEM <const vector(4) unsigned int> [(unsigned int *)&L + 528B], 32, 96>, _12
+	movl	%eax, 992(%rbx)	# _12, MEM <unsigned int> [(struct blake2s_ctx *)ctx_19(D) + 992B]
+	movl	1232(%rsp), %eax	# BIT_FIELD_REF <MEM <const vector(4) unsigned int> [(unsigned int *)&L + 592B], 32, 0>, _8
+	movl	%eax, 612(%rbx)	# _8, MEM <unsigned int> [(struct blake2s_ctx *)ctx_19(D) + 612B]
+	movl	1236(%rsp), %eax	# BIT_FIELD_REF <MEM <const vector(4) unsigned int> [(unsigned int *)&L + 592B], 32, 32>, _4
+	movl	%eax, 740(%rbx)	# _4, MEM <unsigned int> [(struct blake2s_ctx *)ctx_19(D) + 740B]
+	movl	1240(%rsp), %eax	# BIT_FIELD_REF <MEM <const vector(4) unsigned int> [(unsigned int *)&L + 592B], 32, 64>, _350
+	movl	%eax, 868(%rbx)	# _350, MEM <unsigned int> [(struct blake2s_ctx *)ctx_19(D) + 868B]
+	movl	1244(%rsp), %eax	# BIT_FIELD_REF <MEM <const vector(4) unsigned int> [(unsigned int *)&L + 592B], 32, 96>, _353
+	movl	%eax, 996(%rbx)	# _353, MEM <unsigned int> [(struct blake2s_ctx *)ctx_19(D) + 996B]
+	movl	1296(%rsp), %eax	# BIT_FIELD_REF <MEM <const vector(4) unsigned int> [(unsigned int *)&L + 656B], 32, 0>, _357
+	movl	%eax, 616(%rbx)	# _357, MEM <unsigned int> [(struct blake2s_ctx *)ctx_19(D) + 616B]
+	movl	1300(%rsp), %eax	# BIT_FIELD_REF <MEM <const vector(4) unsigned int> [(unsigned int *)&L + 656B], 32, 32>, _360
+	movl	%eax, 744(%rbx)	# _360, MEM <unsigned int> [(struct blake2s_ctx *)ctx_19(D) + 744B]
+	movl	1304(%rsp), %eax	# BIT_FIELD_REF <MEM <const vector(4) unsigned int> [(unsigned int *)&L + 656B], 32, 64>, _363
+	movl	%eax, 872(%rbx)	# _363, MEM <unsigned int> [(struct blake2s_ctx *)ctx_19(D) + 872B]
+	movl	1308(%rsp), %eax	# BIT_FIELD_REF <MEM <const vector(4) unsigned int> [(unsigned int *)&L + 656B], 32, 96>, _366
+	movl	%eax, 1000(%rbx)	# _366, MEM <unsigned int> [(struct blake2s_ctx *)ctx_19(D) + 1000B]
+	movl	1360(%rsp), %eax	# BIT_FIELD_REF <MEM <const vector(4) unsigned int> [(unsigned int *)&L + 720B], 32, 0>, _370
+	movl	%eax, 620(%rbx)	# _370, MEM <unsigned int> [(struct blake2s_ctx *)ctx_19(D) + 620B]
+	movl	1364(%rsp), %eax	# BIT_FIELD_REF <MEM <const vector(4) unsigned int> [(unsigned int *)&L + 720B], 32, 32>, _373
+	movl	%eax, 748(%rbx)	# _373, MEM <unsigned int> [(struct blake2s_ctx *)ctx_19(D) + 748B]
+	movl	1368(%rsp), %eax	# BIT_FIELD_REF <MEM <const vector(4) unsigned int> [(unsigned int *)&L + 720B], 32, 64>, _376
+	movl	%eax, 876(%rbx)	# _376, MEM <unsigned int> [(struct blake2s_ctx *)ctx_19(D) + 876B]
+	movl	1372(%rsp), %eax	# BIT_FIELD_REF <MEM <const vector(4) unsigned int> [(unsigned int *)&L + 720B], 32, 96>, _379
+	movl	%eax, 1004(%rbx)	# _379, MEM <unsigned int> [(struct blake2s_ctx *)ctx_19(D) + 1004B]
+.LVL30:
+	.loc 2 202 15 view .LVU391
+.LBE117:
+.LBE118:
+	.loc 1 92 34 is_stmt 1 view .LVU392
+	.loc 1 92 28 view .LVU393
+.LBE112:
+	.loc 1 94 5 view .LVU394
+# blake2sp.c:95: }
+	.loc 1 95 1 is_stmt 0 view .LVU395
+	leaq	-40(%rbp), %rsp	#,
+	popq	%rbx	#
+.LVL31:
+	.loc 1 95 1 view .LVU396
+	popq	%r12	#
+.LVL32:
+	.loc 1 95 1 view .LVU397
+	popq	%r13	#
+	popq	%r14	#
+	popq	%r15	#
+	popq	%rbp	#
+	.cfi_remember_state
+	.cfi_def_cfa 7, 8
+	ret	
+.LVL33:
+.L6:
+	.cfi_restore_state
+	.loc 1 95 1 view .LVU398
+	movq	%rdi, %xmm4	# ctx, tmp554
+.LBB119:
+.LBB120:
+.LBB121:
+# blake2s-internal.h:208:     L->t[1][l] += (L->t[0][l] < inc);
+	.loc 2 208 31 view .LVU399
+	pxor	%xmm6, %xmm6	# tmp566
+.LBE121:
+.LBE120:
+# blake2sp.c:79:             m[i] = ctx->S[i].buf;
+	.loc 1 79 20 view .LVU400
+	movdqa	.LC0(%rip), %xmm0	#, vect__2.67
+.LBB137:
+.LBB122:
+# blake2s-internal.h:207:     L->t[0][l] += inc;
+	.loc 2 207 16 view .LVU401
+	movdqa	.LC2(%rip), %xmm5	#, tmp624
+	punpcklqdq	%xmm4, %xmm4	# tmp554
+.LBE122:
+.LBE137:
+	.loc 1 79 13 is_stmt 1 view .LVU402
+.LBE119:
+.LBB152:
+.LBB153:
+# blake2s-internal.h:100:     blake2s_kern->compress_lanes(L, m, mask);
+	.loc 2 100 5 is_stmt 0 view .LVU403
+	movq	blake2s_kern(%rip), %rax	# blake2s_kern, blake2s_kern
+.LBE153:
+.LBE152:
+.LBB159:
+.LBB138:
+.LBB123:
+# blake2s-internal.h:207:     L->t[0][l] += inc;
+	.loc 2 207 16 view .LVU404
+	movdqa	128(%rsp), %xmm3	# %sfp, vect_perm_odd_687
+.LBE123:
+.LBE138:
+.LBE159:
+.LBB160:
+.LBB154:
+# blake2s-internal.h:100:     blake2s_kern->compress_lanes(L, m, mask);
+	.loc 2 100 5 view .LVU405
+	leaq	576(%rsp), %r14	#, tmp623
+.LBE154:
+.LBE160:
+.LBB161:
+# blake2sp.c:79:             m[i] = ctx->S[i].buf;
+	.loc 1 79 20 view .LVU406
+	paddq	%xmm4, %xmm0	# tmp554, vect__2.67
+.LBB139:
+.LBB124:
+# blake2s-internal.h:207:     L->t[0][l] += inc;
+	.loc 2 207 16 view .LVU407
+	paddd	%xmm5, %xmm1	# tmp624, vect__42.73
+.LBE124:
+.LBE139:
+.LBE161:
+.LBB162:
+.LBB155:
+# blake2s-internal.h:100:     blake2s_kern->compress_lanes(L, m, mask);
+	.loc 2 100 5 view .LVU408
+	movl	$255, %edx	#,
+.LVL34:
+	.loc 2 100 5 view .LVU409
+	movq	%r14, %rsi	# tmp623,
+.LVL35:
+	.loc 2 100 5 view .LVU410
+.LBE155:
+.LBE162:
+.LBB163:
+# blake2sp.c:79:             m[i] = ctx->S[i].buf;
+	.loc 1 79 18 view .LVU411
+	movaps	%xmm0, 576(%rsp)	# vect__2.67, MEM <vector(2) long unsigned int> [(const void * *)&m]
+# blake2sp.c:79:             m[i] = ctx->S[i].buf;
+	.loc 1 79 20 view .LVU412
+	movdqa	.LC1(%rip), %xmm0	#, vect__2.67
+.LBB140:
+.LBB125:
+# blake2s-internal.h:208:     L->t[1][l] += (L->t[0][l] < inc);
+	.loc 2 208 31 view .LVU413
+	movdqa	.LC4(%rip), %xmm8	#, tmp626
+# blake2s-internal.h:207:     L->t[0][l] += inc;
+	.loc 2 207 16 view .LVU414
+	paddd	%xmm5, %xmm3	# tmp624, vect_perm_odd_687
+	movaps	%xmm3, 1152(%rsp)	# vect__42.73, MEM <vector(4) unsigned int> [(unsigned int *)&L + 512B]
+.LBE125:
+.LBE140:
+.LBE163:
+.LBB164:
+.LBB156:
+# blake2s-internal.h:100:     blake2s_kern->compress_lanes(L, m, mask);
+	.loc 2 100 5 view .LVU415
+	leaq	640(%rsp), %r15	#, tmp627
+.LBE156:
+.LBE164:
+.LBB165:
+# blake2sp.c:79:             m[i] = ctx->S[i].buf;
+	.loc 1 79 20 view .LVU416
+	paddq	%xmm4, %xmm0	# tmp554, vect__2.67
+.LBB141:
+.LBB126:
+# blake2s-internal.h:208:     L->t[1][l] += (L->t[0][l] < inc);
+	.loc 2 208 31 view .LVU417
+	psubd	%xmm8, %xmm3	# tmp626, tmp563
+# blake2s-internal.h:207:     L->t[0][l] += inc;
+	.loc 2 207 16 view .LVU418
+	movaps	%xmm1, 1168(%rsp)	# vect__42.73, MEM <vector(4) unsigned int> [(unsigned int *)&L + 528B]
+.LBE126:
+.LBE141:
+# blake2sp.c:79:             m[i] = ctx->S[i].buf;
+	.loc 1 79 18 view .LVU419
+	movaps	%xmm0, 592(%rsp)	# vect__2.67, MEM <vector(2) long unsigned int> [(const void * *)&m + 16B]
+	.loc 1 80 13 is_stmt 1 view .LVU420
+.LBB142:
+.LBB127:
+# blake2s-internal.h:208:     L->t[1][l] += (L->t[0][l] < inc);
+	.loc 2 208 31 is_stmt 0 view .LVU421
+	psubd	%xmm8, %xmm1	# tmp626, tmp577
+	movdqa	.LC3(%rip), %xmm0	#, tmp625
+.LBE127:
+.LBE142:
+# blake2sp.c:80:             ctx->S[i].buf_len = 0;
+	.loc 1 80 31 view .LVU422
+	movl	$0, 112(%rdi)	#, MEM[(unsigned int *)ctx_19(D) + 112B]
+.LBB143:
+.LBB128:
+# blake2s-internal.h:208:     L->t[1][l] += (L->t[0][l] < inc);
+	.loc 2 208 31 view .LVU423
+	movdqa	%xmm0, %xmm7	# tmp625, tmp564
+.LBE128:
+.LBE143:
+# blake2sp.c:80:             ctx->S[i].buf_len = 0;
+	.loc 1 80 31 view .LVU424
+	movl	$0, 240(%rdi)	#, MEM[(unsigned int *)ctx_19(D) + 240B]
+.LBB144:
+.LBB129:
+# blake2s-internal.h:208:     L->t[1][l] += (L->t[0][l] < inc);
+	.loc 2 208 31 view .LVU425
+	psubd	%xmm8, %xmm7	# tmp626, tmp564
+.LBE129:
+.LBE144:
+# blake2sp.c:80:             ctx->S[i].buf_len = 0;
+	.loc 1 80 31 view .LVU426
+	movl	$0, 368(%rdi)	#, MEM[(unsigned int *)ctx_19(D) + 368B]
+.LBB145:
+.LBB130:
+# blake2s-internal.h:208:     L->t[1][l] += (L->t[0][l] < inc);
+	.loc 2 208 31 view .LVU427
+	pcmpgtd	%xmm7, %xmm3	# tmp564, tmp565
+	pcmpgtd	%xmm7, %xmm1	# tmp564, tmp579
+.LBE130:
+.LBE145:
+# blake2sp.c:80:             ctx->S[i].buf_len = 0;
+	.loc 1 80 31 view .LVU428
+	movl	$0, 496(%rdi)	#, MEM[(unsigned int *)ctx_19(D) + 496B]
+	.loc 1 81 13 is_stmt 1 view .LVU429
+.LVL36:
+.LBB146:
+.LBI120:
+	.loc 2 205 20 view .LVU430
+.LBB131:
+	.loc 2 207 5 view .LVU431
+	.loc 2 208 5 view .LVU432
+.LBE131:
+.LBE146:
+# blake2sp.c:80:             ctx->S[i].buf_len = 0;
+	.loc 1 80 31 is_stmt 0 view .LVU433
+	movl	$0, 624(%rdi)	#, MEM[(unsigned int *)ctx_19(D) + 624B]
+	movl	$0, 752(%rdi)	#, MEM[(unsigned int *)ctx_19(D) + 752B]
+.LBB147:
+.LBB132:
+# blake2s-internal.h:208:     L->t[1][l] += (L->t[0][l] < inc);
+	.loc 2 208 31 view .LVU434
+	pcmpeqd	%xmm6, %xmm3	# tmp566, tmp567
+	pcmpeqd	%xmm6, %xmm1	# tmp566, tmp581
+.LBE132:
+.LBE147:
+# blake2sp.c:80:             ctx->S[i].buf_len = 0;
+	.loc 1 80 31 view .LVU435
+	movl	$0, 880(%rdi)	#, MEM[(unsigned int *)ctx_19(D) + 880B]
+	movl	$0, 1008(%rdi)	#, MEM[(unsigned int *)ctx_19(D) + 1008B]
+.LBE165:
+.LBB166:
+.LBB157:
+# blake2s-internal.h:100:     blake2s_kern->compress_lanes(L, m, mask);
+	.loc 2 100 5 view .LVU436
+	movq	%r15, %rdi	# tmp627,
+.LBE157:
+.LBE166:
+.LBB167:
+.LBB148:
+.LBB133:
+# blake2s-internal.h:208:     L->t[1][l] += (L->t[0][l] < inc);
+	.loc 2 208 31 view .LVU437
+	movaps	%xmm0, 528(%rsp)	# tmp625, %sfp
+# blake2s-internal.h:208:     L->t[1][l] += (L->t[0][l] < inc);
+	.loc 2 208 16 view .LVU438
+	psubd	%xmm3, %xmm14	# tmp567, vect__46.81
+	psubd	%xmm1, %xmm2	# tmp581, vect__46.81
+.LBE133:
+.LBE148:
+# blake2sp.c:79:             m[i] = ctx->S[i].buf;
+	.loc 1 79 20 view .LVU439
+	movdqa	.LC5(%rip), %xmm3	#, vect__2.67
+.LBB149:
+.LBB134:
+# blake2s-internal.h:207:     L->t[0][l] += inc;
+	.loc 2 207 16 view .LVU440
+	movaps	%xmm5, 560(%rsp)	# tmp624, %sfp
+# blake2s-internal.h:208:     L->t[1][l] += (L->t[0][l] < inc);
+	.loc 2 208 31 view .LVU441
+	movaps	%xmm8, 544(%rsp)	# tmp626, %sfp
+.LBE134:
+.LBE149:
+# blake2sp.c:79:             m[i] = ctx->S[i].buf;
+	.loc 1 79 20 view .LVU442
+	paddq	%xmm4, %xmm3	# tmp554, vect__2.67
+	paddq	.LC6(%rip), %xmm4	#, vect__2.67
+.LBB150:
+.LBB135:
+# blake2s-internal.h:208:     L->t[1][l] += (L->t[0][l] < inc);
+	.loc 2 208 16 view .LVU443
+	movaps	%xmm14, 1216(%rsp)	# vect__46.81, MEM <vector(4) unsigned int> [(unsigned int *)&L + 576B]
+.LVL37:
+	.loc 2 208 16 view .LVU444
+.LBE135:
+.LBE150:
+	.loc 1 78 38 is_stmt 1 view .LVU445
+	.loc 1 78 32 view .LVU446
+	.loc 1 79 13 view .LVU447
+# blake2sp.c:79:             m[i] = ctx->S[i].buf;
+	.loc 1 79 18 is_stmt 0 view .LVU448
+	movaps	%xmm3, 608(%rsp)	# vect__2.67, MEM <vector(2) long unsigned int> [(const void * *)&m + 32B]
+	movaps	%xmm4, 624(%rsp)	# vect__2.67, MEM <vector(2) long unsigned int> [(const void * *)&m + 48B]
+	.loc 1 80 13 is_stmt 1 view .LVU449
+	.loc 1 81 13 view .LVU450
+.LVL38:
+.LBB151:
+	.loc 2 205 20 view .LVU451
+.LBB136:
+	.loc 2 207 5 view .LVU452
+	.loc 2 208 5 view .LVU453
+# blake2s-internal.h:208:     L->t[1][l] += (L->t[0][l] < inc);
+	.loc 2 208 16 is_stmt 0 view .LVU454
+	movaps	%xmm2, 1232(%rsp)	# vect__46.81, MEM <vector(4) unsigned int> [(unsigned int *)&L + 592B]
+.LVL39:
+	.loc 2 208 16 view .LVU455
+.LBE136:
+.LBE151:
+	.loc 1 78 38 is_stmt 1 view .LVU456
+	.loc 1 78 32 view .LVU457
+.LBE167:
+	.loc 1 83 9 view .LVU458
+.LBB168:
+.LBI152:
+	.loc 2 97 20 view .LVU459
+.LBB158:
+	.loc 2 100 5 view .LVU460
+	call	*40(%rax)	# blake2s_kern.0_47->compress_lanes
+.LVL40:
+	.loc 2 100 5 is_stmt 0 view .LVU461
+	movdqa	528(%rsp), %xmm0	# %sfp, tmp625
+	movdqa	560(%rsp), %xmm5	# %sfp, tmp624
+# blake2s-internal.h:101: }
+	.loc 2 101 1 view .LVU462
+	jmp	.L2	#
+.LBE158:
+.LBE168:
+	.cfi_endproc
+.LFE21:
+	.size	bsp_strides, .-bsp_strides
+	.p2align 4
+	.type	bsp_par_leaves, @function
+bsp_par_leaves:
+.LVL41:
+.LFB25:
+	.loc 1 182 1 is_stmt 1 view -0
+	.cfi_startproc
+	.loc 1 183 5 view .LVU464
+	.loc 1 184 5 view .LVU465
+.LBB169:
+	.loc 1 184 10 view .LVU466
+	.loc 1 184 26 view .LVU467
+	cmpq	$7, %rsi	#, k
+	ja	.L24	#,
+.LBE169:
+# blake2sp.c:182: {
+	.loc 1 182 1 is_stmt 0 view .LVU468
+	pushq	%r14	#
+	.cfi_def_cfa_offset 16
+	.cfi_offset 14, -16
+	pushq	%r13	#
+	.cfi_def_cfa_offset 24
+	.cfi_offset 13, -24
+	movq	%rsi, %r13	# tmp107, k
+	pushq	%r12	#
+	.cfi_def_cfa_offset 32
+	.cfi_offset 12, -32
+	movq	%rdi, %r12	# tmp106, arg
+	pushq	%rbp	#
+	.cfi_def_cfa_offset 40
+	.cfi_offset 6, -40
+	pushq	%rbx	#
+	.cfi_def_cfa_offset 48
+	.cfi_offset 3, -48
+.LBB183:
+.LBB170:
+.LBB171:
+# blake2sp.c:186:         for (size_t s = 0; s < J->n; s++, p += BSP_STRIDE)
+	.loc 1 186 33 view .LVU469
+	movq	16(%rdi), %rax	# MEM[(struct bsp_par *)arg_13(D)].n, _5
+.LVL42:
+	.p2align 4,,10
+	.p2align 3
+.L16:
+	.loc 1 186 33 view .LVU470
+.LBE171:
+	.loc 1 185 9 is_stmt 1 view .LVU471
+# blake2sp.c:185:         const u8 *p = J->src + i*BLAKE2S_BLOCK;
+	.loc 1 185 33 is_stmt 0 view .LVU472
+	movq	%r13, %rbx	# k, tmp99
+	salq	$6, %rbx	#, tmp99
+# blake2sp.c:185:         const u8 *p = J->src + i*BLAKE2S_BLOCK;
+	.loc 1 185 19 view .LVU473
+	addq	8(%r12), %rbx	# MEM[(struct bsp_par *)arg_13(D)].src, p
+.LVL43:
+	.loc 1 186 9 is_stmt 1 view .LVU474
+.LBB180:
+	.loc 1 186 14 view .LVU475
+	.loc 1 186 30 view .LVU476
+	testq	%rax, %rax	# _5
+	je	.L11	#,
+	movq	%r13, %r14	# k, _12
+# blake2sp.c:186:         for (size_t s = 0; s < J->n; s++, p += BSP_STRIDE)
+	.loc 1 186 21 is_stmt 0 view .LVU477
+	xorl	%ebp, %ebp	# s
+	salq	$7, %r14	#, _12
+.LVL44:
+	.p2align 4,,10
+	.p2align 3
+.L12:
+	.loc 1 187 13 is_stmt 1 discriminator 3 view .LVU478
+.LBB172:
+.LBI172:
+	.loc 2 91 20 discriminator 3 view .LVU479
+.LBB173:
+	.loc 2 94 5 discriminator 3 view .LVU480
+.LBE173:
+.LBE172:
+# blake2sp.c:187:             blake2s_compress_blocks(&J->ctx->S[i], p, 1);
+	.loc 1 187 13 is_stmt 0 discriminator 3 view .LVU481
+	movq	(%r12), %rdi	# MEM[(struct bsp_par *)arg_13(D)].ctx, tmp101
+.LBB177:
+.LBB174:
+# blake2s-internal.h:94:     blake2s_kern->compress_blocks(ctx, m, nblocks);
+	.loc 2 94 5 discriminator 3 view .LVU482
+	movq	%rbx, %rsi	# p,
+	movl	$1, %edx	#,
+.LBE174:
+.LBE177:
+# blake2sp.c:186:         for (size_t s = 0; s < J->n; s++, p += BSP_STRIDE)
+	.loc 1 186 39 discriminator 3 view .LVU483
+	addq	$1, %rbp	#, s
+.LVL45:
+.LBB178:
+.LBB175:
+# blake2s-internal.h:94:     blake2s_kern->compress_blocks(ctx, m, nblocks);
+	.loc 2 94 5 discriminator 3 view .LVU484
+	movq	blake2s_kern(%rip), %rax	# blake2s_kern, blake2s_kern
+.LBE175:
+.LBE178:
+# blake2sp.c:186:         for (size_t s = 0; s < J->n; s++, p += BSP_STRIDE)
+	.loc 1 186 45 discriminator 3 view .LVU485
+	addq	$512, %rbx	#, p
+.LVL46:
+# blake2sp.c:187:             blake2s_compress_blocks(&J->ctx->S[i], p, 1);
+	.loc 1 187 13 discriminator 3 view .LVU486
+	addq	%r14, %rdi	# _12, tmp101
+.LBB179:
+.LBB176:
+# blake2s-internal.h:94:     blake2s_kern->compress_blocks(ctx, m, nblocks);
+	.loc 2 94 5 discriminator 3 view .LVU487
+	call	*24(%rax)	# blake2s_kern.2_20->compress_blocks
+.LVL47:
+	.loc 2 94 5 discriminator 3 view .LVU488
+.LBE176:
+.LBE179:
+	.loc 1 186 41 is_stmt 1 discriminator 3 view .LVU489
+	.loc 1 186 30 discriminator 3 view .LVU490
+# blake2sp.c:186:         for (size_t s = 0; s < J->n; s++, p += BSP_STRIDE)
+	.loc 1 186 33 is_stmt 0 discriminator 3 view .LVU491
+	movq	16(%r12), %rax	# MEM[(struct bsp_par *)arg_13(D)].n, _5
+# blake2sp.c:186:         for (size_t s = 0; s < J->n; s++, p += BSP_STRIDE)
+	.loc 1 186 30 discriminator 3 view .LVU492
+	cmpq	%rax, %rbp	# _5, s
+	jb	.L12	#,
+.LBE180:
+.LBE170:
+	.loc 1 184 33 is_stmt 1 discriminator 2 view .LVU493
+# blake2sp.c:184:     for (size_t i = k; i < BSP_LEAVES; i += J->g) {
+	.loc 1 184 37 is_stmt 0 discriminator 2 view .LVU494
+	movl	24(%r12), %edx	# MEM[(struct bsp_par *)arg_13(D)].g, MEM[(struct bsp_par *)arg_13(D)].g
+# blake2sp.c:184:     for (size_t i = k; i < BSP_LEAVES; i += J->g) {
+	.loc 1 184 33 discriminator 2 view .LVU495
+	addq	%rdx, %r13	# MEM[(struct bsp_par *)arg_13(D)].g, k
+.LVL48:
+	.loc 1 184 26 is_stmt 1 discriminator 2 view .LVU496
+	cmpq	$7, %r13	#, k
+	jbe	.L16	#,
+.LVL49:
+.L9:
+	.loc 1 184 26 is_stmt 0 discriminator 2 view .LVU497
+.LBE183:
+# blake2sp.c:189: }
+	.loc 1 189 1 view .LVU498
+	popq	%rbx	#
+	.cfi_remember_state
+	.cfi_def_cfa_offset 40
+	popq	%rbp	#
+	.cfi_def_cfa_offset 32
+	popq	%r12	#
+	.cfi_def_cfa_offset 24
+.LVL50:
+	.loc 1 189 1 view .LVU499
+	popq	%r13	#
+	.cfi_def_cfa_offset 16
+.LVL51:
+	.loc 1 189 1 view .LVU500
+	popq	%r14	#
+	.cfi_def_cfa_offset 8
+	ret	
+.LVL52:
+	.p2align 4,,10
+	.p2align 3
+.L11:
+	.cfi_restore_state
+.LBB184:
+	.loc 1 184 33 is_stmt 1 view .LVU501
+# blake2sp.c:184:     for (size_t i = k; i < BSP_LEAVES; i += J->g) {
+	.loc 1 184 37 is_stmt 0 view .LVU502
+	movl	24(%r12), %eax	# MEM[(struct bsp_par *)arg_13(D)].g, _35
+# blake2sp.c:184:     for (size_t i = k; i < BSP_LEAVES; i += J->g) {
+	.loc 1 184 33 view .LVU503
+	addq	%rax, %r13	# _35, i
+.LVL53:
+	.loc 1 184 26 is_stmt 1 view .LVU504
+	cmpq	$7, %r13	#, i
+	ja	.L9	#,
+.LVL54:
+.L14:
+.LBB182:
+	.loc 1 185 9 view .LVU505
+	.loc 1 186 9 view .LVU506
+.LBB181:
+	.loc 1 186 14 view .LVU507
+	.loc 1 186 30 view .LVU508
+.LBE181:
+.LBE182:
+	.loc 1 184 33 view .LVU509
+	addq	%rax, %r13	# _35, i
+.LVL55:
+	.loc 1 184 26 view .LVU510
+	cmpq	$7, %r13	#, i
+	jbe	.L14	#,
+	jmp	.L9	#
+.LVL56:
+.L24:
+	.cfi_def_cfa_offset 8
+	.cfi_restore 3
+	.cfi_restore 6
+	.cfi_restore 12
+	.cfi_restore 13
+	.cfi_restore 14
+	.loc 1 184 26 is_stmt 0 view .LVU511
+	ret	
+.LBE184:
+	.cfi_endproc
+.LFE25:
+	.size	bsp_par_leaves, .-bsp_par_leaves
+	.p2align 4
+	.globl	blake2sp_init_keyed
+	.type	blake2sp_init_keyed, @function
+blake2sp_init_keyed:
+.LVL57:
+.LFB18:
+	.loc 1 50 1 is_stmt 1 view -0
+	.cfi_startproc
+	.loc 1 50 1 is_stmt 0 view .LVU513
+	pushq	%r15	#
+	.cfi_def_cfa_offset 16
+	.cfi_offset 15, -16
+	pushq	%r14	#
+	.cfi_def_cfa_offset 24
+	.cfi_offset 14, -24
+	pushq	%r13	#
+	.cfi_def_cfa_offset 32
+	.cfi_offset 13, -32
+	pushq	%r12	#
+	.cfi_def_cfa_offset 40
+	.cfi_offset 12, -40
+	pushq	%rbp	#
+	.cfi_def_cfa_offset 48
+	.cfi_offset 6, -48
+	pushq	%rbx	#
+	.cfi_def_cfa_offset 56
+	.cfi_offset 3, -56
+	subq	$40, %rsp	#,
+	.cfi_def_cfa_offset 96
+# blake2sp.c:50: {
+	.loc 1 50 1 view .LVU514
+	movq	%rdi, 8(%rsp)	# ctx, %sfp
+	.loc 1 51 5 is_stmt 1 view .LVU515
+# blake2sp.c:51:     if (key_len < 1)
+	.loc 1 51 8 is_stmt 0 view .LVU516
+	testl	%ecx, %ecx	# key_len
+	je	.L31	#,
+.LBB188:
+.LBB189:
+# blake2sp.c:26:     u32 P[B2S_PARAM_WORDS] = { BSP_PARAM0(dig_len,key_len), 0, 0,
+	.loc 1 26 44 view .LVU517
+	movl	%ecx, %eax	# key_len, tmp96
+# blake2sp.c:26:     u32 P[B2S_PARAM_WORDS] = { BSP_PARAM0(dig_len,key_len), 0, 0,
+	.loc 1 26 9 view .LVU518
+	movl	$0, 20(%rsp)	#, P[1]
+	movl	%ecx, %ebp	# tmp109, key_len
+.LBE189:
+.LBE188:
+	.loc 1 53 5 is_stmt 1 view .LVU519
+.LVL58:
+.LBB192:
+.LBI188:
+	.loc 1 23 12 view .LVU520
+.LBB191:
+	.loc 1 26 5 view .LVU521
+# blake2sp.c:26:     u32 P[B2S_PARAM_WORDS] = { BSP_PARAM0(dig_len,key_len), 0, 0,
+	.loc 1 26 44 is_stmt 0 view .LVU522
+	sall	$8, %eax	#, tmp96
+# blake2sp.c:26:     u32 P[B2S_PARAM_WORDS] = { BSP_PARAM0(dig_len,key_len), 0, 0,
+	.loc 1 26 33 view .LVU523
+	orl	%r8d, %eax	# dig_len, tmp97
+# blake2sp.c:26:     u32 P[B2S_PARAM_WORDS] = { BSP_PARAM0(dig_len,key_len), 0, 0,
+	.loc 1 26 18 view .LVU524
+	orl	$34078720, %eax	#, tmp98
+	movl	%eax, 16(%rsp)	# tmp98, P[0]
+# blake2sp.c:26:     u32 P[B2S_PARAM_WORDS] = { BSP_PARAM0(dig_len,key_len), 0, 0,
+	.loc 1 26 9 view .LVU525
+	movabsq	$2306124484190404608, %rax	#, tmp113
+	movq	%rax, 24(%rsp)	# tmp113, MEM <unsigned long> [(unsigned int *)&P + 8B]
+	.loc 1 29 5 is_stmt 1 view .LVU526
+# blake2sp.c:29:     if (key_len > BLAKE2S_KEY_LEN)
+	.loc 1 29 8 is_stmt 0 view .LVU527
+	cmpl	$32, %ecx	#, key_len
+	ja	.L31	#,
+	.loc 1 31 5 is_stmt 1 view .LVU528
+# blake2sp.c:31:     if (dig_len < 1 || dig_len > BLAKE2S_LEN)
+	.loc 1 31 21 is_stmt 0 view .LVU529
+	subl	$1, %r8d	#, tmp100
+.LVL59:
+# blake2sp.c:31:     if (dig_len < 1 || dig_len > BLAKE2S_LEN)
+	.loc 1 31 8 view .LVU530
+	cmpl	$31, %r8d	#, tmp100
+	ja	.L31	#,
+# blake2sp.c:35:     blake2s_init_words(&ctx->R, P, salt, NULL, NULL, 0);
+	.loc 1 35 5 view .LVU531
+	leaq	16(%rsp), %r14	#, tmp105
+	movq	%rdi, %rbx	# tmp106, ctx
+	movq	%rsi, %r12	# tmp107, salt
+	movq	%rdx, %r13	# tmp108, key
+	.loc 1 35 5 is_stmt 1 view .LVU532
+	leaq	1024(%rdi), %rdi	#, tmp102
+.LVL60:
+	.loc 1 35 5 is_stmt 0 view .LVU533
+	movq	%rsi, %rdx	# salt,
+.LVL61:
+	.loc 1 35 5 view .LVU534
+	xorl	%r9d, %r9d	#
+	xorl	%r8d, %r8d	#
+.LVL62:
+	.loc 1 35 5 view .LVU535
+	xorl	%ecx, %ecx	#
+.LVL63:
+	.loc 1 35 5 view .LVU536
+	movq	%r14, %rsi	# tmp105,
+.LVL64:
+	.loc 1 35 5 view .LVU537
+	movq	%rbx, %r15	# ctx, ivtmp.226
+	call	blake2s_init_words@PLT	#
+.LVL65:
+	.loc 1 36 5 is_stmt 1 view .LVU538
+# blake2sp.c:37:     P[3] = B2S_PARAM3(0, 0, BLAKE2S_LEN);
+	.loc 1 37 10 is_stmt 0 view .LVU539
+	movl	$536870912, 28(%rsp)	#, P[3]
+# blake2sp.c:36:     ctx->R.last_node = 1;
+	.loc 1 36 22 view .LVU540
+	movl	$1, 1144(%rbx)	#, ctx_5(D)->R.last_node
+	.loc 1 37 5 is_stmt 1 view .LVU541
+	.loc 1 38 5 view .LVU542
+.LBB190:
+	.loc 1 38 10 view .LVU543
+.LVL66:
+	.loc 1 38 28 view .LVU544
+# blake2sp.c:38:     for (unsigned i = 0; i < BSP_LEAVES; i++) {
+	.loc 1 38 19 is_stmt 0 view .LVU545
+	xorl	%ebx, %ebx	# i
+.LVL67:
+	.p2align 4,,10
+	.p2align 3
+.L30:
+	.loc 1 39 9 is_stmt 1 view .LVU546
+# blake2sp.c:39:         P[2] = i;
+	.loc 1 39 14 is_stmt 0 view .LVU547
+	movl	%ebx, 24(%rsp)	# i, P[2]
+	.loc 1 40 9 is_stmt 1 view .LVU548
+	movq	%r15, %rdi	# ivtmp.226,
+	movl	%ebp, %r9d	# key_len,
+	movq	%r13, %r8	# key,
+	xorl	%ecx, %ecx	#
+	movq	%r12, %rdx	# salt,
+	movq	%r14, %rsi	# tmp105,
+# blake2sp.c:38:     for (unsigned i = 0; i < BSP_LEAVES; i++) {
+	.loc 1 38 34 is_stmt 0 view .LVU549
+	addl	$1, %ebx	#, i
+.LVL68:
+# blake2sp.c:40:         blake2s_init_words(&ctx->S[i], P, salt, NULL, key, key_len);
+	.loc 1 40 9 view .LVU550
+	call	blake2s_init_words@PLT	#
+.LVL69:
+	.loc 1 41 9 is_stmt 1 view .LVU551
+# blake2sp.c:38:     for (unsigned i = 0; i < BSP_LEAVES; i++) {
+	.loc 1 38 28 is_stmt 0 view .LVU552
+	subq	$-128, %r15	#, ivtmp.226
+# blake2sp.c:41:         ctx->S[i].digest_len = BLAKE2S_LEN; /* inner length */
+	.loc 1 41 30 view .LVU553
+	movl	$32, -12(%r15)	#, MEM[(unsigned int *)_17 + 116B]
+	.loc 1 38 34 is_stmt 1 view .LVU554
+.LVL70:
+	.loc 1 38 28 view .LVU555
+	cmpl	$8, %ebx	#, i
+	jne	.L30	#,
+.LBE190:
+	.loc 1 43 5 view .LVU556
+# blake2sp.c:43:     ctx->S[BSP_LEAVES-1].last_node = 1;
+	.loc 1 43 28 is_stmt 0 view .LVU557
+	movq	8(%rsp), %rax	# %sfp, ctx
+	movl	$1, 1016(%rax)	#, ctx_5(D)->S[7].last_node
+	.loc 1 44 5 is_stmt 1 view .LVU558
+# blake2sp.c:44:     ctx->buf_len = 0;
+	.loc 1 44 18 is_stmt 0 view .LVU559
+	movl	$0, 2112(%rax)	#, ctx_5(D)->buf_len
+	.loc 1 45 5 is_stmt 1 view .LVU560
+# blake2sp.c:45:     return 0;
+	.loc 1 45 12 is_stmt 0 view .LVU561
+	xorl	%eax, %eax	# <retval>
+.LVL71:
+.L27:
+	.loc 1 45 12 view .LVU562
+.LBE191:
+.LBE192:
+# blake2sp.c:54: }
+	.loc 1 54 1 view .LVU563
+	addq	$40, %rsp	#,
+	.cfi_remember_state
+	.cfi_def_cfa_offset 56
+	popq	%rbx	#
+	.cfi_def_cfa_offset 48
+	popq	%rbp	#
+	.cfi_def_cfa_offset 40
+	popq	%r12	#
+	.cfi_def_cfa_offset 32
+	popq	%r13	#
+	.cfi_def_cfa_offset 24
+	popq	%r14	#
+	.cfi_def_cfa_offset 16
+	popq	%r15	#
+	.cfi_def_cfa_offset 8
+	ret	
+.LVL72:
+.L31:
+	.cfi_restore_state
+# blake2sp.c:52:         return -1;
+	.loc 1 52 16 view .LVU564
+	movl	$-1, %eax	#, <retval>
+	jmp	.L27	#
+	.cfi_endproc
+.LFE18:
+	.size	blake2sp_init_keyed, .-blake2sp_init_keyed
+	.p2align 4
+	.globl	blake2sp_init_salted
+	.type	blake2sp_init_salted, @function
+blake2sp_init_salted:
+.LVL73:
+.LFB19:
+	.loc 1 58 1 is_stmt 1 view -0
+	.cfi_startproc
+	.loc 1 59 5 view .LVU566
+.LBB196:
+.LBI196:
+	.loc 1 23 12 view .LVU567
+.LBB197:
+	.loc 1 26 5 view .LVU568
+.LBE197:
+.LBE196:
+# blake2sp.c:58: {
+	.loc 1 58 1 is_stmt 0 view .LVU569
+	pushq	%r14	#
+	.cfi_def_cfa_offset 16
+	.cfi_offset 14, -16
+.LBB204:
+.LBB200:
+# blake2sp.c:26:     u32 P[B2S_PARAM_WORDS] = { BSP_PARAM0(dig_len,key_len), 0, 0,
+	.loc 1 26 18 view .LVU570
+	movl	%edx, %eax	# dig_len, tmp92
+# blake2sp.c:31:     if (dig_len < 1 || dig_len > BLAKE2S_LEN)
+	.loc 1 31 21 view .LVU571
+	subl	$1, %edx	#, tmp94
+.LVL74:
+	.loc 1 31 21 view .LVU572
+.LBE200:
+.LBE204:
+# blake2sp.c:58: {
+	.loc 1 58 1 view .LVU573
+	pushq	%r13	#
+	.cfi_def_cfa_offset 24
+	.cfi_offset 13, -24
+.LBB205:
+.LBB201:
+# blake2sp.c:26:     u32 P[B2S_PARAM_WORDS] = { BSP_PARAM0(dig_len,key_len), 0, 0,
+	.loc 1 26 18 view .LVU574
+	orl	$34078720, %eax	#, tmp92
+.LVL75:
+	.loc 1 26 18 view .LVU575
+.LBE201:
+.LBE205:
+# blake2sp.c:58: {
+	.loc 1 58 1 view .LVU576
+	pushq	%r12	#
+	.cfi_def_cfa_offset 32
+	.cfi_offset 12, -32
+	pushq	%rbp	#
+	.cfi_def_cfa_offset 40
+	.cfi_offset 6, -40
+	pushq	%rbx	#
+	.cfi_def_cfa_offset 48
+	.cfi_offset 3, -48
+	subq	$16, %rsp	#,
+	.cfi_def_cfa_offset 64
+.LBB206:
+.LBB202:
+# blake2sp.c:26:     u32 P[B2S_PARAM_WORDS] = { BSP_PARAM0(dig_len,key_len), 0, 0,
+	.loc 1 26 18 view .LVU577
+	movl	%eax, (%rsp)	# tmp92, P[0]
+# blake2sp.c:26:     u32 P[B2S_PARAM_WORDS] = { BSP_PARAM0(dig_len,key_len), 0, 0,
+	.loc 1 26 9 view .LVU578
+	movabsq	$2306124484190404608, %rax	#, tmp105
+	movl	$0, 4(%rsp)	#, P[1]
+	movq	%rax, 8(%rsp)	# tmp105, MEM <unsigned long> [(unsigned int *)&P + 8B]
+	.loc 1 29 5 is_stmt 1 view .LVU579
+	.loc 1 31 5 view .LVU580
+# blake2sp.c:31:     if (dig_len < 1 || dig_len > BLAKE2S_LEN)
+	.loc 1 31 8 is_stmt 0 view .LVU581
+	cmpl	$31, %edx	#, tmp94
+	ja	.L39	#,
+# blake2sp.c:35:     blake2s_init_words(&ctx->R, P, salt, NULL, NULL, 0);
+	.loc 1 35 5 view .LVU582
+	movq	%rsp, %r13	#, tmp99
+	movq	%rdi, %r14	# tmp100, ctx
+	movq	%rsi, %rdx	# salt,
+.LVL76:
+	.loc 1 35 5 view .LVU583
+	movq	%rsi, %r12	# tmp101, salt
+	.loc 1 35 5 is_stmt 1 view .LVU584
+	leaq	1024(%rdi), %rdi	#, tmp96
+.LVL77:
+	.loc 1 35 5 is_stmt 0 view .LVU585
+	xorl	%r9d, %r9d	#
+	xorl	%r8d, %r8d	#
+	xorl	%ecx, %ecx	#
+	movq	%r13, %rsi	# tmp99,
+.LVL78:
+	.loc 1 35 5 view .LVU586
+	movq	%r14, %rbp	# ctx, ivtmp.239
+.LBB198:
+# blake2sp.c:38:     for (unsigned i = 0; i < BSP_LEAVES; i++) {
+	.loc 1 38 19 view .LVU587
+	xorl	%ebx, %ebx	# i
+.LBE198:
+# blake2sp.c:35:     blake2s_init_words(&ctx->R, P, salt, NULL, NULL, 0);
+	.loc 1 35 5 view .LVU588
+	call	blake2s_init_words@PLT	#
+.LVL79:
+	.loc 1 36 5 is_stmt 1 view .LVU589
+# blake2sp.c:37:     P[3] = B2S_PARAM3(0, 0, BLAKE2S_LEN);
+	.loc 1 37 10 is_stmt 0 view .LVU590
+	movl	$536870912, 12(%rsp)	#, P[3]
+# blake2sp.c:36:     ctx->R.last_node = 1;
+	.loc 1 36 22 view .LVU591
+	movl	$1, 1144(%r14)	#, ctx_2(D)->R.last_node
+	.loc 1 37 5 is_stmt 1 view .LVU592
+	.loc 1 38 5 view .LVU593
+.LBB199:
+	.loc 1 38 10 view .LVU594
+.LVL80:
+	.loc 1 38 28 view .LVU595
+	.p2align 4,,10
+	.p2align 3
+.L38:
+	.loc 1 39 9 view .LVU596
+# blake2sp.c:39:         P[2] = i;
+	.loc 1 39 14 is_stmt 0 view .LVU597
+	movl	%ebx, 8(%rsp)	# i, P[2]
+	.loc 1 40 9 is_stmt 1 view .LVU598
+	movq	%rbp, %rdi	# ivtmp.239,
+	xorl	%r9d, %r9d	#
+	xorl	%r8d, %r8d	#
+	xorl	%ecx, %ecx	#
+	movq	%r12, %rdx	# salt,
+	movq	%r13, %rsi	# tmp99,
+# blake2sp.c:38:     for (unsigned i = 0; i < BSP_LEAVES; i++) {
+	.loc 1 38 34 is_stmt 0 view .LVU599
+	addl	$1, %ebx	#, i
+.LVL81:
+# blake2sp.c:40:         blake2s_init_words(&ctx->S[i], P, salt, NULL, key, key_len);
+	.loc 1 40 9 view .LVU600
+	call	blake2s_init_words@PLT	#
+.LVL82:
+	.loc 1 41 9 is_stmt 1 view .LVU601
+# blake2sp.c:38:     for (unsigned i = 0; i < BSP_LEAVES; i++) {
+	.loc 1 38 28 is_stmt 0 view .LVU602
+	subq	$-128, %rbp	#, ivtmp.239
+# blake2sp.c:41:         ctx->S[i].digest_len = BLAKE2S_LEN; /* inner length */
+	.loc 1 41 30 view .LVU603
+	movl	$32, -12(%rbp)	#, MEM[(unsigned int *)_13 + 116B]
+	.loc 1 38 34 is_stmt 1 view .LVU604
+.LVL83:
+	.loc 1 38 28 view .LVU605
+	cmpl	$8, %ebx	#, i
+	jne	.L38	#,
+.LBE199:
+	.loc 1 43 5 view .LVU606
+# blake2sp.c:43:     ctx->S[BSP_LEAVES-1].last_node = 1;
+	.loc 1 43 28 is_stmt 0 view .LVU607
+	movl	$1, 1016(%r14)	#, ctx_2(D)->S[7].last_node
+	.loc 1 44 5 is_stmt 1 view .LVU608
+# blake2sp.c:45:     return 0;
+	.loc 1 45 12 is_stmt 0 view .LVU609
+	xorl	%eax, %eax	# <retval>
+# blake2sp.c:44:     ctx->buf_len = 0;
+	.loc 1 44 18 view .LVU610
+	movl	$0, 2112(%r14)	#, ctx_2(D)->buf_len
+	.loc 1 45 5 is_stmt 1 view .LVU611
+.LVL84:
+.L36:
+	.loc 1 45 5 is_stmt 0 view .LVU612
+.LBE202:
+.LBE206:
+# blake2sp.c:60: }
+	.loc 1 60 1 view .LVU613
+	addq	$16, %rsp	#,
+	.cfi_remember_state
+	.cfi_def_cfa_offset 48
+	popq	%rbx	#
+	.cfi_def_cfa_offset 40
+	popq	%rbp	#
+	.cfi_def_cfa_offset 32
+	popq	%r12	#
+	.cfi_def_cfa_offset 24
+	popq	%r13	#
+	.cfi_def_cfa_offset 16
+	popq	%r14	#
+	.cfi_def_cfa_offset 8
+	ret	
+.LVL85:
+.L39:
+	.cfi_restore_state
+.LBB207:
+.LBB203:
+# blake2sp.c:30:         return -1;
+	.loc 1 30 16 view .LVU614
+	movl	$-1, %eax	#, <retval>
+.LVL86:
+	.loc 1 30 16 view .LVU615
+.LBE203:
+.LBE207:
+# blake2sp.c:59:     return bsp_init(ctx, salt, NULL, 0, dig_len);
+	.loc 1 59 12 view .LVU616
+	jmp	.L36	#
+	.cfi_endproc
+.LFE19:
+	.size	blake2sp_init_salted, .-blake2sp_init_salted
+	.p2align 4
+	.globl	blake2sp_init
+	.type	blake2sp_init, @function
+blake2sp_init:
+.LVL87:
+.LFB20:
+	.loc 1 63 1 is_stmt 1 view -0
+	.cfi_startproc
+	.loc 1 64 5 view .LVU618
+.LBB211:
+.LBI211:
+	.loc 1 23 12 view .LVU619
+.LBB212:
+	.loc 1 26 5 view .LVU620
+.LBE212:
+.LBE211:
+# blake2sp.c:63: {
+	.loc 1 63 1 is_stmt 0 view .LVU621
+	pushq	%r13	#
+	.cfi_def_cfa_offset 16
+	.cfi_offset 13, -16
+.LBB220:
+.LBB215:
+# blake2sp.c:35:     blake2s_init_words(&ctx->R, P, salt, NULL, NULL, 0);
+	.loc 1 35 5 view .LVU622
+	xorl	%r9d, %r9d	#
+.LBE215:
+.LBE220:
+# blake2sp.c:63: {
+	.loc 1 63 1 view .LVU623
+	movq	%rdi, %r13	# tmp92, ctx
+.LBB221:
+.LBB216:
+# blake2sp.c:35:     blake2s_init_words(&ctx->R, P, salt, NULL, NULL, 0);
+	.loc 1 35 5 view .LVU624
+	xorl	%r8d, %r8d	#
+.LBE216:
+.LBE221:
+# blake2sp.c:63: {
+	.loc 1 63 1 view .LVU625
+	pushq	%r12	#
+	.cfi_def_cfa_offset 24
+	.cfi_offset 12, -24
+.LBB222:
+.LBB217:
+# blake2sp.c:35:     blake2s_init_words(&ctx->R, P, salt, NULL, NULL, 0);
+	.loc 1 35 5 view .LVU626
+	leaq	1024(%rdi), %rdi	#, tmp89
+.LVL88:
+	.loc 1 35 5 view .LVU627
+	xorl	%ecx, %ecx	#
+	xorl	%edx, %edx	#
+.LBE217:
+.LBE222:
+# blake2sp.c:63: {
+	.loc 1 63 1 view .LVU628
+	pushq	%rbp	#
+	.cfi_def_cfa_offset 32
+	.cfi_offset 6, -32
+	movq	%r13, %rbp	# ctx, ivtmp.254
+	pushq	%rbx	#
+	.cfi_def_cfa_offset 40
+	.cfi_offset 3, -40
+.LBB223:
+.LBB218:
+.LBB213:
+# blake2sp.c:38:     for (unsigned i = 0; i < BSP_LEAVES; i++) {
+	.loc 1 38 19 view .LVU629
+	xorl	%ebx, %ebx	# i
+.LBE213:
+.LBE218:
+.LBE223:
+# blake2sp.c:63: {
+	.loc 1 63 1 view .LVU630
+	subq	$24, %rsp	#,
+	.cfi_def_cfa_offset 64
+.LBB224:
+.LBB219:
+# blake2sp.c:26:     u32 P[B2S_PARAM_WORDS] = { BSP_PARAM0(dig_len,key_len), 0, 0,
+	.loc 1 26 9 view .LVU631
+	movdqa	.LC8(%rip), %xmm0	#, tmp87
+# blake2sp.c:35:     blake2s_init_words(&ctx->R, P, salt, NULL, NULL, 0);
+	.loc 1 35 5 view .LVU632
+	movq	%rsp, %r12	#, tmp91
+	movq	%r12, %rsi	# tmp91,
+# blake2sp.c:26:     u32 P[B2S_PARAM_WORDS] = { BSP_PARAM0(dig_len,key_len), 0, 0,
+	.loc 1 26 9 view .LVU633
+	movaps	%xmm0, (%rsp)	# tmp87, MEM <vector(4) unsigned int> [(unsigned int *)&P]
+	.loc 1 29 5 is_stmt 1 view .LVU634
+	.loc 1 31 5 view .LVU635
+	.loc 1 35 5 view .LVU636
+	call	blake2s_init_words@PLT	#
+.LVL89:
+	.loc 1 36 5 view .LVU637
+# blake2sp.c:37:     P[3] = B2S_PARAM3(0, 0, BLAKE2S_LEN);
+	.loc 1 37 10 is_stmt 0 view .LVU638
+	movl	$536870912, 12(%rsp)	#, P[3]
+# blake2sp.c:36:     ctx->R.last_node = 1;
+	.loc 1 36 22 view .LVU639
+	movl	$1, 1144(%r13)	#, ctx_2(D)->R.last_node
+	.loc 1 37 5 is_stmt 1 view .LVU640
+	.loc 1 38 5 view .LVU641
+.LBB214:
+	.loc 1 38 10 view .LVU642
+.LVL90:
+	.loc 1 38 28 view .LVU643
+	.p2align 4,,10
+	.p2align 3
+.L43:
+	.loc 1 39 9 view .LVU644
+# blake2sp.c:39:         P[2] = i;
+	.loc 1 39 14 is_stmt 0 view .LVU645
+	movl	%ebx, 8(%rsp)	# i, P[2]
+	.loc 1 40 9 is_stmt 1 view .LVU646
+	movq	%rbp, %rdi	# ivtmp.254,
+	xorl	%r9d, %r9d	#
+	xorl	%r8d, %r8d	#
+	xorl	%ecx, %ecx	#
+	xorl	%edx, %edx	#
+	movq	%r12, %rsi	# tmp91,
+# blake2sp.c:38:     for (unsigned i = 0; i < BSP_LEAVES; i++) {
+	.loc 1 38 34 is_stmt 0 view .LVU647
+	addl	$1, %ebx	#, i
+.LVL91:
+# blake2sp.c:40:         blake2s_init_words(&ctx->S[i], P, salt, NULL, key, key_len);
+	.loc 1 40 9 view .LVU648
+	call	blake2s_init_words@PLT	#
+.LVL92:
+	.loc 1 41 9 is_stmt 1 view .LVU649
+# blake2sp.c:38:     for (unsigned i = 0; i < BSP_LEAVES; i++) {
+	.loc 1 38 28 is_stmt 0 view .LVU650
+	subq	$-128, %rbp	#, ivtmp.254
+# blake2sp.c:41:         ctx->S[i].digest_len = BLAKE2S_LEN; /* inner length */
+	.loc 1 41 30 view .LVU651
+	movl	$32, -12(%rbp)	#, MEM[(unsigned int *)_10 + 116B]
+	.loc 1 38 34 is_stmt 1 view .LVU652
+.LVL93:
+	.loc 1 38 28 view .LVU653
+	cmpl	$8, %ebx	#, i
+	jne	.L43	#,
+.LBE214:
+	.loc 1 43 5 view .LVU654
+# blake2sp.c:43:     ctx->S[BSP_LEAVES-1].last_node = 1;
+	.loc 1 43 28 is_stmt 0 view .LVU655
+	movl	$1, 1016(%r13)	#, ctx_2(D)->S[7].last_node
+	.loc 1 44 5 is_stmt 1 view .LVU656
+# blake2sp.c:44:     ctx->buf_len = 0;
+	.loc 1 44 18 is_stmt 0 view .LVU657
+	movl	$0, 2112(%r13)	#, ctx_2(D)->buf_len
+	.loc 1 45 5 is_stmt 1 view .LVU658
+.LVL94:
+	.loc 1 45 5 is_stmt 0 view .LVU659
+.LBE219:
+.LBE224:
+# blake2sp.c:65: }
+	.loc 1 65 1 view .LVU660
+	addq	$24, %rsp	#,
+	.cfi_def_cfa_offset 40
+	popq	%rbx	#
+	.cfi_def_cfa_offset 32
+	popq	%rbp	#
+	.cfi_def_cfa_offset 24
+	popq	%r12	#
+	.cfi_def_cfa_offset 16
+	popq	%r13	#
+	.cfi_def_cfa_offset 8
+.LVL95:
+	.loc 1 65 1 view .LVU661
+	ret	
+	.cfi_endproc
+.LFE20:
+	.size	blake2sp_init, .-blake2sp_init
+	.p2align 4
+	.globl	blake2sp_update
+	.type	blake2sp_update, @function
+blake2sp_update:
+.LVL96:
+.LFB22:
+	.loc 1 98 1 is_stmt 1 view -0
+	.cfi_startproc
+	.loc 1 99 5 view .LVU663
+# blake2sp.c:98: {
+	.loc 1 98 1 is_stmt 0 view .LVU664
+	pushq	%r15	#
+	.cfi_def_cfa_offset 16
+	.cfi_offset 15, -16
+	movq	%rdi, %r15	# tmp157, ctx
+	pushq	%r14	#
+	.cfi_def_cfa_offset 24
+	.cfi_offset 14, -24
+	pushq	%r13	#
+	.cfi_def_cfa_offset 32
+	.cfi_offset 13, -32
+	pushq	%r12	#
+	.cfi_def_cfa_offset 40
+	.cfi_offset 12, -40
+	movq	%rsi, %r12	# tmp158, src
+.LVL97:
+	.loc 1 102 5 is_stmt 1 view .LVU665
+# blake2sp.c:98: {
+	.loc 1 98 1 is_stmt 0 view .LVU666
+	pushq	%rbp	#
+	.cfi_def_cfa_offset 48
+	.cfi_offset 6, -48
+	movq	%rdx, %rbp	# tmp159, len
+	.loc 1 102 25 is_stmt 1 view .LVU667
+# blake2sp.c:98: {
+	.loc 1 98 1 is_stmt 0 view .LVU668
+	pushq	%rbx	#
+	.cfi_def_cfa_offset 56
+	.cfi_offset 3, -56
+.LBB225:
+# blake2sp.c:105:             memcpy(ctx->buf + ctx->buf_len, in, fill);
+	.loc 1 105 20 view .LVU669
+	leaq	1152(%rdi), %rbx	#, pretmp_93
+.LBE225:
+# blake2sp.c:98: {
+	.loc 1 98 1 view .LVU670
+	subq	$8, %rsp	#,
+	.cfi_def_cfa_offset 64
+# blake2sp.c:102:     while (ctx->buf_len && ctx->buf_len + len > BSP_HOLD) {
+	.loc 1 102 15 view .LVU671
+	movl	2112(%rdi), %eax	# ctx_37(D)->buf_len, _11
+# blake2sp.c:102:     while (ctx->buf_len && ctx->buf_len + len > BSP_HOLD) {
+	.loc 1 102 25 view .LVU672
+	testl	%eax, %eax	# _11
+	je	.L47	#,
+# blake2sp.c:102:     while (ctx->buf_len && ctx->buf_len + len > BSP_HOLD) {
+	.loc 1 102 31 view .LVU673
+	movl	%eax, %edx	# _11, _13
+.LVL98:
+# blake2sp.c:102:     while (ctx->buf_len && ctx->buf_len + len > BSP_HOLD) {
+	.loc 1 102 41 view .LVU674
+	leaq	0(%rbp,%rdx), %rcx	#, tmp106
+# blake2sp.c:102:     while (ctx->buf_len && ctx->buf_len + len > BSP_HOLD) {
+	.loc 1 102 25 view .LVU675
+	cmpq	$960, %rcx	#, tmp106
+	jbe	.L48	#,
+# blake2sp.c:112:         memmove(ctx->buf, ctx->buf + BSP_STRIDE, ctx->buf_len);
+	.loc 1 112 9 view .LVU676
+	leaq	1664(%rdi), %r13	#, _70
+.LBB226:
+# blake2sp.c:104:             size_t fill = BSP_STRIDE - ctx->buf_len;
+	.loc 1 104 36 view .LVU677
+	movl	$512, %r14d	#, tmp156
+	jmp	.L54	#
+.LVL99:
+	.p2align 4,,10
+	.p2align 3
+.L49:
+	.loc 1 104 36 view .LVU678
+.LBE226:
+	.loc 1 110 9 is_stmt 1 view .LVU679
+	movl	$1, %edx	#,
+	movq	%rbx, %rsi	# pretmp_93,
+	movq	%r15, %rdi	# ctx,
+	call	bsp_strides	#
+.LVL100:
+	.loc 1 111 9 view .LVU680
+# blake2sp.c:111:         ctx->buf_len -= BSP_STRIDE;
+	.loc 1 111 22 is_stmt 0 view .LVU681
+	movl	2112(%r15), %eax	# ctx_37(D)->buf_len, tmp163
+# blake2sp.c:112:         memmove(ctx->buf, ctx->buf + BSP_STRIDE, ctx->buf_len);
+	.loc 1 112 9 view .LVU682
+	movq	%r13, %rsi	# _70,
+	movq	%rbx, %rdi	# pretmp_93,
+# blake2sp.c:111:         ctx->buf_len -= BSP_STRIDE;
+	.loc 1 111 22 view .LVU683
+	leal	-512(%rax), %edx	#,
+	movl	%edx, 2112(%r15)	# _8, ctx_37(D)->buf_len
+	.loc 1 112 9 is_stmt 1 view .LVU684
+	call	memmove@PLT	#
+.LVL101:
+	.loc 1 102 25 view .LVU685
+# blake2sp.c:102:     while (ctx->buf_len && ctx->buf_len + len > BSP_HOLD) {
+	.loc 1 102 15 is_stmt 0 view .LVU686
+	movl	2112(%r15), %eax	# ctx_37(D)->buf_len, _11
+# blake2sp.c:102:     while (ctx->buf_len && ctx->buf_len + len > BSP_HOLD) {
+	.loc 1 102 25 view .LVU687
+	testl	%eax, %eax	# _11
+	je	.L47	#,
+# blake2sp.c:102:     while (ctx->buf_len && ctx->buf_len + len > BSP_HOLD) {
+	.loc 1 102 31 discriminator 1 view .LVU688
+	movl	%eax, %ecx	# _11, _13
+# blake2sp.c:102:     while (ctx->buf_len && ctx->buf_len + len > BSP_HOLD) {
+	.loc 1 102 41 discriminator 1 view .LVU689
+	leaq	(%rcx,%rbp), %rsi	#, tmp145
+# blake2sp.c:102:     while (ctx->buf_len && ctx->buf_len + len > BSP_HOLD) {
+	.loc 1 102 31 discriminator 1 view .LVU690
+	movq	%rcx, %rdx	# _13, _13
+# blake2sp.c:102:     while (ctx->buf_len && ctx->buf_len + len > BSP_HOLD) {
+	.loc 1 102 25 discriminator 1 view .LVU691
+	cmpq	$960, %rsi	#, tmp145
+	jbe	.L55	#,
+.L54:
+	.loc 1 103 9 is_stmt 1 view .LVU692
+# blake2sp.c:103:         if (ctx->buf_len < BSP_STRIDE) {
+	.loc 1 103 12 is_stmt 0 view .LVU693
+	cmpl	$511, %eax	#, _11
+	ja	.L49	#,
+.LBB227:
+	.loc 1 104 13 is_stmt 1 view .LVU694
+# blake2sp.c:104:             size_t fill = BSP_STRIDE - ctx->buf_len;
+	.loc 1 104 36 is_stmt 0 view .LVU695
+	movl	%r14d, %ecx	# tmp156, tmp107
+# blake2sp.c:105:             memcpy(ctx->buf + ctx->buf_len, in, fill);
+	.loc 1 105 13 view .LVU696
+	addq	%rbx, %rdx	# pretmp_93, tmp109
+# blake2sp.c:104:             size_t fill = BSP_STRIDE - ctx->buf_len;
+	.loc 1 104 36 view .LVU697
+	subl	%eax, %ecx	# _11, tmp107
+# blake2sp.c:104:             size_t fill = BSP_STRIDE - ctx->buf_len;
+	.loc 1 104 20 view .LVU698
+	movl	%ecx, %eax	# tmp107, fill
+.LVL102:
+	.loc 1 105 13 is_stmt 1 view .LVU699
+	cmpl	$8, %ecx	#, tmp107
+	jnb	.L50	#,
+	testb	$4, %cl	#, tmp107
+	jne	.L71	#,
+	testl	%ecx, %ecx	# tmp107
+	je	.L51	#,
+	movzbl	(%r12), %esi	#* src, tmp122
+	andl	$2, %ecx	#, tmp107
+	movb	%sil, (%rdx)	# tmp122,
+	jne	.L72	#,
+.L51:
+	.loc 1 106 13 view .LVU700
+# blake2sp.c:106:             ctx->buf_len = BSP_STRIDE;
+	.loc 1 106 26 is_stmt 0 view .LVU701
+	movl	$512, 2112(%r15)	#, ctx_37(D)->buf_len
+	.loc 1 107 13 is_stmt 1 view .LVU702
+# blake2sp.c:107:             in += fill;
+	.loc 1 107 16 is_stmt 0 view .LVU703
+	addq	%rax, %r12	# fill, src
+.LVL103:
+	.loc 1 108 13 is_stmt 1 view .LVU704
+# blake2sp.c:108:             len -= fill;
+	.loc 1 108 17 is_stmt 0 view .LVU705
+	subq	%rax, %rbp	# fill, len
+.LVL104:
+	.loc 1 108 17 view .LVU706
+	jmp	.L49	#
+	.p2align 4,,10
+	.p2align 3
+.L50:
+# blake2sp.c:105:             memcpy(ctx->buf + ctx->buf_len, in, fill);
+	.loc 1 105 13 view .LVU707
+	movq	(%r12), %rsi	#* src, tmp131
+	leaq	8(%rdx), %rdi	#, tmp139
+	andq	$-8, %rdi	#, tmp139
+	movq	%rsi, (%rdx)	# tmp131,
+	movq	-8(%r12,%rax), %rsi	#, tmp138
+	movq	%rsi, -8(%rdx,%rax)	# tmp138,
+	subq	%rdi, %rdx	# tmp139, tmp111
+	movq	%r12, %rsi	# src, src
+	addl	%edx, %ecx	# tmp111, fill
+	subq	%rdx, %rsi	# tmp111, src
+	shrl	$3, %ecx	#,
+	rep movsq
+	jmp	.L51	#
+.LVL105:
+	.p2align 4,,10
+	.p2align 3
+.L47:
+	.loc 1 105 13 view .LVU708
+.LBE227:
+	.loc 1 115 5 is_stmt 1 view .LVU709
+# blake2sp.c:115:     if (!ctx->buf_len && len > BSP_HOLD) {
+	.loc 1 115 23 is_stmt 0 view .LVU710
+	cmpq	$960, %rbp	#, len
+	ja	.L56	#,
+	.loc 1 115 23 view .LVU711
+	xorl	%ecx, %ecx	# _13
+.L55:
+# blake2sp.c:121:     memcpy(ctx->buf + ctx->buf_len, in, len);
+	.loc 1 121 26 view .LVU712
+	movq	%rcx, %rdx	# _13, _13
+.L48:
+	.loc 1 121 5 is_stmt 1 view .LVU713
+	leaq	(%rbx,%rdx), %rdi	#, tmp148
+	movq	%r12, %rsi	# src,
+	movq	%rbp, %rdx	# len,
+	call	memcpy@PLT	#
+.LVL106:
+	.loc 1 122 5 view .LVU714
+# blake2sp.c:122:     ctx->buf_len += len;
+	.loc 1 122 18 is_stmt 0 view .LVU715
+	addl	%ebp, 2112(%r15)	# len, ctx_37(D)->buf_len
+# blake2sp.c:123: }
+	.loc 1 123 1 view .LVU716
+	addq	$8, %rsp	#,
+	.cfi_remember_state
+	.cfi_def_cfa_offset 56
+	popq	%rbx	#
+	.cfi_def_cfa_offset 48
+	popq	%rbp	#
+	.cfi_def_cfa_offset 40
+.LVL107:
+	.loc 1 123 1 view .LVU717
+	popq	%r12	#
+	.cfi_def_cfa_offset 32
+.LVL108:
+	.loc 1 123 1 view .LVU718
+	popq	%r13	#
+	.cfi_def_cfa_offset 24
+	popq	%r14	#
+	.cfi_def_cfa_offset 16
+	popq	%r15	#
+	.cfi_def_cfa_offset 8
+.LVL109:
+	.loc 1 123 1 view .LVU719
+	ret	
+.LVL110:
+	.p2align 4,,10
+	.p2align 3
+.L56:
+	.cfi_restore_state
+.LBB228:
+	.loc 1 116 9 is_stmt 1 view .LVU720
+# blake2sp.c:116:         size_t n = (len - BSP_HOLD - 1) / BSP_STRIDE + 1;
+	.loc 1 116 47 is_stmt 0 view .LVU721
+	leaq	-961(%rbp), %r13	#, tmp146
+# blake2sp.c:117:         bsp_strides(ctx, in, n);
+	.loc 1 117 9 view .LVU722
+	movq	%r12, %rsi	# src,
+	movq	%r15, %rdi	# ctx,
+# blake2sp.c:116:         size_t n = (len - BSP_HOLD - 1) / BSP_STRIDE + 1;
+	.loc 1 116 52 view .LVU723
+	shrq	$9, %r13	#, tmp147
+# blake2sp.c:116:         size_t n = (len - BSP_HOLD - 1) / BSP_STRIDE + 1;
+	.loc 1 116 16 view .LVU724
+	addq	$1, %r13	#, n
+.LVL111:
+	.loc 1 117 9 is_stmt 1 view .LVU725
+	movq	%r13, %rdx	# n,
+# blake2sp.c:118:         in += n * BSP_STRIDE;
+	.loc 1 118 17 is_stmt 0 view .LVU726
+	salq	$9, %r13	#, _17
+.LVL112:
+# blake2sp.c:117:         bsp_strides(ctx, in, n);
+	.loc 1 117 9 view .LVU727
+	call	bsp_strides	#
+.LVL113:
+	.loc 1 118 9 is_stmt 1 view .LVU728
+# blake2sp.c:118:         in += n * BSP_STRIDE;
+	.loc 1 118 12 is_stmt 0 view .LVU729
+	addq	%r13, %r12	# _17, src
+.LVL114:
+	.loc 1 119 9 is_stmt 1 view .LVU730
+# blake2sp.c:119:         len -= n * BSP_STRIDE;
+	.loc 1 119 13 is_stmt 0 view .LVU731
+	subq	%r13, %rbp	# _17, len
+.LVL115:
+	.loc 1 119 13 view .LVU732
+.LBE228:
+# blake2sp.c:121:     memcpy(ctx->buf + ctx->buf_len, in, len);
+	.loc 1 121 26 view .LVU733
+	movl	2112(%r15), %edx	# ctx_37(D)->buf_len, _13
+	jmp	.L48	#
+.LVL116:
+	.p2align 4,,10
+	.p2align 3
+.L71:
+.LBB229:
+# blake2sp.c:105:             memcpy(ctx->buf + ctx->buf_len, in, fill);
+	.loc 1 105 13 view .LVU734
+	movl	(%r12), %ecx	#* src, tmp114
+	movl	%ecx, (%rdx)	# tmp114,
+	movl	-4(%r12,%rax), %ecx	#, tmp121
+	movl	%ecx, -4(%rdx,%rax)	# tmp121,
+	jmp	.L51	#
+.L72:
+	.loc 1 105 13 view .LVU735
+	movzwl	-2(%r12,%rax), %ecx	#, tmp130
+	movw	%cx, -2(%rdx,%rax)	# tmp130,
+	jmp	.L51	#
+.LBE229:
+	.cfi_endproc
+.LFE22:
+	.size	blake2sp_update, .-blake2sp_update
+	.p2align 4
+	.globl	blake2sp_final
+	.type	blake2sp_final, @function
+blake2sp_final:
+.LVL117:
+.LFB24:
+	.loc 1 135 1 is_stmt 1 view -0
+	.cfi_startproc
+	.loc 1 136 5 view .LVU737
+	.loc 1 137 5 view .LVU738
+	.loc 1 140 5 view .LVU739
+.LBB230:
+	.loc 1 140 10 view .LVU740
+	.loc 1 140 28 view .LVU741
+.LBE230:
+# blake2sp.c:135: {
+	.loc 1 135 1 is_stmt 0 view .LVU742
+	pushq	%r15	#
+	.cfi_def_cfa_offset 16
+	.cfi_offset 15, -16
+.LBB289:
+# blake2sp.c:142:         job[i].src = ctx->buf + i*BLAKE2S_BLOCK;
+	.loc 1 142 22 view .LVU743
+	leaq	1152(%rdi), %rdx	#, tmp158
+.LBE289:
+# blake2sp.c:135: {
+	.loc 1 135 1 view .LVU744
+	pushq	%r14	#
+	.cfi_def_cfa_offset 24
+	.cfi_offset 14, -24
+	pushq	%r13	#
+	.cfi_def_cfa_offset 32
+	.cfi_offset 13, -32
+	pushq	%r12	#
+	.cfi_def_cfa_offset 40
+	.cfi_offset 12, -40
+	pushq	%rbp	#
+	.cfi_def_cfa_offset 48
+	.cfi_offset 6, -48
+	pushq	%rbx	#
+	.cfi_def_cfa_offset 56
+	.cfi_offset 3, -56
+	movq	%rdi, %rbx	# tmp266, ctx
+	subq	$568, %rsp	#,
+	.cfi_def_cfa_offset 624
+.LBB290:
+# blake2sp.c:143:         job[i].len = bsp_slice(ctx->buf_len, i);
+	.loc 1 143 22 view .LVU745
+	movl	2112(%rdi), %eax	# ctx_25(D)->buf_len, _7
+	.loc 1 141 9 is_stmt 1 view .LVU746
+.LBE290:
+# blake2sp.c:135: {
+	.loc 1 135 1 is_stmt 0 view .LVU747
+	movq	%rsi, 8(%rsp)	# tmp267, %sfp
+.LBB291:
+# blake2sp.c:141:         job[i].ctx = &ctx->S[i];
+	.loc 1 141 20 view .LVU748
+	movq	%rdi, 304(%rsp)	# ctx, job[0].ctx
+	.loc 1 142 9 is_stmt 1 view .LVU749
+# blake2sp.c:142:         job[i].src = ctx->buf + i*BLAKE2S_BLOCK;
+	.loc 1 142 22 is_stmt 0 view .LVU750
+	movq	%rdx, 312(%rsp)	# tmp158, job[0].src
+	.loc 1 143 9 is_stmt 1 view .LVU751
+.LVL118:
+.LBB231:
+.LBI231:
+	.loc 1 126 15 view .LVU752
+.LBB232:
+	.loc 1 128 5 view .LVU753
+# blake2sp.c:128:     if (len <= j*BLAKE2S_BLOCK)
+	.loc 1 128 8 is_stmt 0 view .LVU754
+	testq	%rax, %rax	# _7
+	je	.L106	#,
+	.loc 1 130 5 is_stmt 1 view .LVU755
+.LVL119:
+	.loc 1 131 5 view .LVU756
+# blake2sp.c:131:     return len < BLAKE2S_BLOCK ? len : BLAKE2S_BLOCK;
+	.loc 1 131 27 is_stmt 0 view .LVU757
+	movl	$64, %edx	#, tmp283
+.LBE232:
+.LBE231:
+# blake2sp.c:141:         job[i].ctx = &ctx->S[i];
+	.loc 1 141 22 view .LVU758
+	leaq	128(%rdi), %r9	#, _170
+# blake2sp.c:144:         job[i].out = NULL;
+	.loc 1 144 20 view .LVU759
+	movq	$0, 328(%rsp)	#, job[0].out
+.LBB261:
+.LBB233:
+# blake2sp.c:131:     return len < BLAKE2S_BLOCK ? len : BLAKE2S_BLOCK;
+	.loc 1 131 27 view .LVU760
+	cmpq	%rdx, %rax	# tmp283, _7
+.LBE233:
+.LBE261:
+# blake2sp.c:141:         job[i].ctx = &ctx->S[i];
+	.loc 1 141 20 view .LVU761
+	movq	%r9, 336(%rsp)	# _170, job[1].ctx
+.LBB262:
+.LBB234:
+# blake2sp.c:131:     return len < BLAKE2S_BLOCK ? len : BLAKE2S_BLOCK;
+	.loc 1 131 27 view .LVU762
+	cmovbe	%rax, %rdx	# _7,, tmp161
+.LBE234:
+.LBE262:
+# blake2sp.c:143:         job[i].len = bsp_slice(ctx->buf_len, i);
+	.loc 1 143 20 view .LVU763
+	movq	%rdx, 320(%rsp)	# tmp161, job[0].len
+	.loc 1 144 9 is_stmt 1 view .LVU764
+	.loc 1 140 34 view .LVU765
+.LVL120:
+	.loc 1 140 28 view .LVU766
+	.loc 1 141 9 view .LVU767
+	.loc 1 142 9 view .LVU768
+# blake2sp.c:142:         job[i].src = ctx->buf + i*BLAKE2S_BLOCK;
+	.loc 1 142 31 is_stmt 0 view .LVU769
+	leaq	1216(%rdi), %rdx	#, tmp162
+	movq	%rdx, 344(%rsp)	# tmp162, job[1].src
+	.loc 1 143 9 is_stmt 1 view .LVU770
+.LVL121:
+.LBB263:
+	.loc 1 126 15 view .LVU771
+.LBB235:
+	.loc 1 128 5 view .LVU772
+# blake2sp.c:128:     if (len <= j*BLAKE2S_BLOCK)
+	.loc 1 128 8 is_stmt 0 view .LVU773
+	cmpq	$64, %rax	#, _7
+	jbe	.L105	#,
+	.loc 1 130 5 is_stmt 1 view .LVU774
+.LVL122:
+	.loc 1 131 5 view .LVU775
+# blake2sp.c:130:     len -= j*BLAKE2S_BLOCK;
+	.loc 1 130 9 is_stmt 0 view .LVU776
+	leaq	-64(%rax), %rdx	#, tmp164
+# blake2sp.c:131:     return len < BLAKE2S_BLOCK ? len : BLAKE2S_BLOCK;
+	.loc 1 131 27 view .LVU777
+	movl	$64, %ecx	#, tmp282
+.LBE235:
+.LBE263:
+# blake2sp.c:141:         job[i].ctx = &ctx->S[i];
+	.loc 1 141 22 view .LVU778
+	leaq	256(%rdi), %r12	#, _38
+# blake2sp.c:144:         job[i].out = NULL;
+	.loc 1 144 20 view .LVU779
+	movq	$0, 360(%rsp)	#, job[1].out
+.LBB264:
+.LBB236:
+# blake2sp.c:131:     return len < BLAKE2S_BLOCK ? len : BLAKE2S_BLOCK;
+	.loc 1 131 27 view .LVU780
+	cmpq	%rcx, %rdx	# tmp282, tmp164
+.LBE236:
+.LBE264:
+# blake2sp.c:141:         job[i].ctx = &ctx->S[i];
+	.loc 1 141 20 view .LVU781
+	movq	%r12, 368(%rsp)	# _38, job[2].ctx
+.LBB265:
+.LBB237:
+# blake2sp.c:131:     return len < BLAKE2S_BLOCK ? len : BLAKE2S_BLOCK;
+	.loc 1 131 27 view .LVU782
+	cmova	%rcx, %rdx	# tmp164,, tmp282, tmp165
+.LBE237:
+.LBE265:
+# blake2sp.c:143:         job[i].len = bsp_slice(ctx->buf_len, i);
+	.loc 1 143 20 view .LVU783
+	movq	%rdx, 352(%rsp)	# tmp165, job[1].len
+	.loc 1 144 9 is_stmt 1 view .LVU784
+	.loc 1 140 34 view .LVU785
+.LVL123:
+	.loc 1 140 28 view .LVU786
+	.loc 1 141 9 view .LVU787
+	.loc 1 142 9 view .LVU788
+# blake2sp.c:142:         job[i].src = ctx->buf + i*BLAKE2S_BLOCK;
+	.loc 1 142 31 is_stmt 0 view .LVU789
+	leaq	1280(%rdi), %rdx	#, tmp167
+	movq	%rdx, 376(%rsp)	# tmp167, job[2].src
+	.loc 1 143 9 is_stmt 1 view .LVU790
+.LVL124:
+.LBB266:
+	.loc 1 126 15 view .LVU791
+.LBB238:
+	.loc 1 128 5 view .LVU792
+# blake2sp.c:128:     if (len <= j*BLAKE2S_BLOCK)
+	.loc 1 128 8 is_stmt 0 view .LVU793
+	cmpq	$128, %rax	#, _7
+	jbe	.L75	#,
+	.loc 1 130 5 is_stmt 1 view .LVU794
+.LVL125:
+	.loc 1 131 5 view .LVU795
+# blake2sp.c:130:     len -= j*BLAKE2S_BLOCK;
+	.loc 1 130 9 is_stmt 0 view .LVU796
+	leaq	-128(%rax), %rdx	#, tmp169
+# blake2sp.c:131:     return len < BLAKE2S_BLOCK ? len : BLAKE2S_BLOCK;
+	.loc 1 131 27 view .LVU797
+	movl	$64, %ecx	#, tmp281
+.LBE238:
+.LBE266:
+# blake2sp.c:141:         job[i].ctx = &ctx->S[i];
+	.loc 1 141 22 view .LVU798
+	leaq	384(%rdi), %r8	#, _118
+# blake2sp.c:144:         job[i].out = NULL;
+	.loc 1 144 20 view .LVU799
+	movq	$0, 392(%rsp)	#, job[2].out
+.LBB267:
+.LBB239:
+# blake2sp.c:131:     return len < BLAKE2S_BLOCK ? len : BLAKE2S_BLOCK;
+	.loc 1 131 27 view .LVU800
+	cmpq	%rcx, %rdx	# tmp281, tmp169
+.LBE239:
+.LBE267:
+# blake2sp.c:141:         job[i].ctx = &ctx->S[i];
+	.loc 1 141 20 view .LVU801
+	movq	%r8, 400(%rsp)	# _118, job[3].ctx
+.LBB268:
+.LBB240:
+# blake2sp.c:131:     return len < BLAKE2S_BLOCK ? len : BLAKE2S_BLOCK;
+	.loc 1 131 27 view .LVU802
+	cmova	%rcx, %rdx	# tmp169,, tmp281, tmp170
+.LBE240:
+.LBE268:
+# blake2sp.c:143:         job[i].len = bsp_slice(ctx->buf_len, i);
+	.loc 1 143 20 view .LVU803
+	movq	%rdx, 384(%rsp)	# tmp170, job[2].len
+	.loc 1 144 9 is_stmt 1 view .LVU804
+	.loc 1 140 34 view .LVU805
+.LVL126:
+	.loc 1 140 28 view .LVU806
+	.loc 1 141 9 view .LVU807
+	.loc 1 142 9 view .LVU808
+# blake2sp.c:142:         job[i].src = ctx->buf + i*BLAKE2S_BLOCK;
+	.loc 1 142 31 is_stmt 0 view .LVU809
+	leaq	1344(%rdi), %rdx	#, tmp172
+	movq	%rdx, 408(%rsp)	# tmp172, job[3].src
+	.loc 1 143 9 is_stmt 1 view .LVU810
+.LVL127:
+.LBB269:
+	.loc 1 126 15 view .LVU811
+.LBB241:
+	.loc 1 128 5 view .LVU812
+# blake2sp.c:128:     if (len <= j*BLAKE2S_BLOCK)
+	.loc 1 128 8 is_stmt 0 view .LVU813
+	cmpq	$192, %rax	#, _7
+	jbe	.L78	#,
+	.loc 1 130 5 is_stmt 1 view .LVU814
+.LVL128:
+	.loc 1 131 5 view .LVU815
+# blake2sp.c:131:     return len < BLAKE2S_BLOCK ? len : BLAKE2S_BLOCK;
+	.loc 1 131 27 is_stmt 0 view .LVU816
+	movl	$64, %ecx	#, tmp280
+# blake2sp.c:130:     len -= j*BLAKE2S_BLOCK;
+	.loc 1 130 9 view .LVU817
+	leaq	-192(%rax), %rdx	#, tmp174
+.LBE241:
+.LBE269:
+# blake2sp.c:144:         job[i].out = NULL;
+	.loc 1 144 20 view .LVU818
+	movq	$0, 424(%rsp)	#, job[3].out
+.LBB270:
+.LBB242:
+# blake2sp.c:131:     return len < BLAKE2S_BLOCK ? len : BLAKE2S_BLOCK;
+	.loc 1 131 27 view .LVU819
+	cmpq	%rcx, %rdx	# tmp280, tmp174
+	cmova	%rcx, %rdx	# tmp174,, tmp280, tmp175
+.LBE242:
+.LBE270:
+# blake2sp.c:141:         job[i].ctx = &ctx->S[i];
+	.loc 1 141 22 view .LVU820
+	leaq	512(%rdi), %rcx	#, _64
+# blake2sp.c:141:         job[i].ctx = &ctx->S[i];
+	.loc 1 141 20 view .LVU821
+	movq	%rcx, 432(%rsp)	# _64, job[4].ctx
+# blake2sp.c:143:         job[i].len = bsp_slice(ctx->buf_len, i);
+	.loc 1 143 20 view .LVU822
+	movq	%rdx, 416(%rsp)	# tmp175, job[3].len
+	.loc 1 144 9 is_stmt 1 view .LVU823
+	.loc 1 140 34 view .LVU824
+.LVL129:
+	.loc 1 140 28 view .LVU825
+	.loc 1 141 9 view .LVU826
+	.loc 1 142 9 view .LVU827
+# blake2sp.c:142:         job[i].src = ctx->buf + i*BLAKE2S_BLOCK;
+	.loc 1 142 31 is_stmt 0 view .LVU828
+	leaq	1408(%rdi), %rdx	#, tmp177
+	movq	%rdx, 440(%rsp)	# tmp177, job[4].src
+	.loc 1 143 9 is_stmt 1 view .LVU829
+.LVL130:
+.LBB271:
+	.loc 1 126 15 view .LVU830
+.LBB243:
+	.loc 1 128 5 view .LVU831
+# blake2sp.c:128:     if (len <= j*BLAKE2S_BLOCK)
+	.loc 1 128 8 is_stmt 0 view .LVU832
+	cmpq	$256, %rax	#, _7
+	jbe	.L80	#,
+	.loc 1 130 5 is_stmt 1 view .LVU833
+.LVL131:
+	.loc 1 131 5 view .LVU834
+# blake2sp.c:130:     len -= j*BLAKE2S_BLOCK;
+	.loc 1 130 9 is_stmt 0 view .LVU835
+	leaq	-256(%rax), %rdx	#, tmp179
+# blake2sp.c:131:     return len < BLAKE2S_BLOCK ? len : BLAKE2S_BLOCK;
+	.loc 1 131 27 view .LVU836
+	movl	$64, %esi	#, tmp279
+.LVL132:
+	.loc 1 131 27 view .LVU837
+.LBE243:
+.LBE271:
+# blake2sp.c:141:         job[i].ctx = &ctx->S[i];
+	.loc 1 141 22 view .LVU838
+	leaq	640(%rdi), %r15	#, _1
+# blake2sp.c:144:         job[i].out = NULL;
+	.loc 1 144 20 view .LVU839
+	movq	$0, 456(%rsp)	#, job[4].out
+.LBB272:
+.LBB244:
+# blake2sp.c:131:     return len < BLAKE2S_BLOCK ? len : BLAKE2S_BLOCK;
+	.loc 1 131 27 view .LVU840
+	cmpq	%rsi, %rdx	# tmp279, tmp179
+.LBE244:
+.LBE272:
+# blake2sp.c:141:         job[i].ctx = &ctx->S[i];
+	.loc 1 141 20 view .LVU841
+	movq	%r15, 464(%rsp)	# _1, job[5].ctx
+.LBB273:
+.LBB245:
+# blake2sp.c:131:     return len < BLAKE2S_BLOCK ? len : BLAKE2S_BLOCK;
+	.loc 1 131 27 view .LVU842
+	cmova	%rsi, %rdx	# tmp179,, tmp279, tmp180
+.LBE245:
+.LBE273:
+# blake2sp.c:143:         job[i].len = bsp_slice(ctx->buf_len, i);
+	.loc 1 143 20 view .LVU843
+	movq	%rdx, 448(%rsp)	# tmp180, job[4].len
+	.loc 1 144 9 is_stmt 1 view .LVU844
+	.loc 1 140 34 view .LVU845
+.LVL133:
+	.loc 1 140 28 view .LVU846
+	.loc 1 141 9 view .LVU847
+	.loc 1 142 9 view .LVU848
+# blake2sp.c:142:         job[i].src = ctx->buf + i*BLAKE2S_BLOCK;
+	.loc 1 142 31 is_stmt 0 view .LVU849
+	leaq	1472(%rdi), %rdx	#, tmp182
+	movq	%rdx, 472(%rsp)	# tmp182, job[5].src
+	.loc 1 143 9 is_stmt 1 view .LVU850
+.LVL134:
+.LBB274:
+	.loc 1 126 15 view .LVU851
+.LBB246:
+	.loc 1 128 5 view .LVU852
+# blake2sp.c:128:     if (len <= j*BLAKE2S_BLOCK)
+	.loc 1 128 8 is_stmt 0 view .LVU853
+	cmpq	$320, %rax	#, _7
+	jbe	.L82	#,
+	.loc 1 130 5 is_stmt 1 view .LVU854
+.LVL135:
+	.loc 1 131 5 view .LVU855
+# blake2sp.c:130:     len -= j*BLAKE2S_BLOCK;
+	.loc 1 130 9 is_stmt 0 view .LVU856
+	leaq	-320(%rax), %rdx	#, tmp184
+# blake2sp.c:131:     return len < BLAKE2S_BLOCK ? len : BLAKE2S_BLOCK;
+	.loc 1 131 27 view .LVU857
+	movl	$64, %esi	#, tmp278
+.LBE246:
+.LBE274:
+# blake2sp.c:141:         job[i].ctx = &ctx->S[i];
+	.loc 1 141 22 view .LVU858
+	leaq	768(%rdi), %r14	#, _77
+# blake2sp.c:144:         job[i].out = NULL;
+	.loc 1 144 20 view .LVU859
+	movq	$0, 488(%rsp)	#, job[5].out
+.LBB275:
+.LBB247:
+# blake2sp.c:131:     return len < BLAKE2S_BLOCK ? len : BLAKE2S_BLOCK;
+	.loc 1 131 27 view .LVU860
+	cmpq	%rsi, %rdx	# tmp278, tmp184
+.LBE247:
+.LBE275:
+# blake2sp.c:141:         job[i].ctx = &ctx->S[i];
+	.loc 1 141 20 view .LVU861
+	movq	%r14, 496(%rsp)	# _77, job[6].ctx
+.LBB276:
+.LBB248:
+# blake2sp.c:131:     return len < BLAKE2S_BLOCK ? len : BLAKE2S_BLOCK;
+	.loc 1 131 27 view .LVU862
+	cmova	%rsi, %rdx	# tmp184,, tmp278, tmp185
+.LBE248:
+.LBE276:
+# blake2sp.c:143:         job[i].len = bsp_slice(ctx->buf_len, i);
+	.loc 1 143 20 view .LVU863
+	movq	%rdx, 480(%rsp)	# tmp185, job[5].len
+	.loc 1 144 9 is_stmt 1 view .LVU864
+	.loc 1 140 34 view .LVU865
+.LVL136:
+	.loc 1 140 28 view .LVU866
+	.loc 1 141 9 view .LVU867
+	.loc 1 142 9 view .LVU868
+# blake2sp.c:142:         job[i].src = ctx->buf + i*BLAKE2S_BLOCK;
+	.loc 1 142 31 is_stmt 0 view .LVU869
+	leaq	1536(%rdi), %rdx	#, tmp187
+	movq	%rdx, 504(%rsp)	# tmp187, job[6].src
+	.loc 1 143 9 is_stmt 1 view .LVU870
+.LVL137:
+.LBB277:
+	.loc 1 126 15 view .LVU871
+.LBB249:
+	.loc 1 128 5 view .LVU872
+# blake2sp.c:128:     if (len <= j*BLAKE2S_BLOCK)
+	.loc 1 128 8 is_stmt 0 view .LVU873
+	cmpq	$384, %rax	#, _7
+	jbe	.L84	#,
+	.loc 1 130 5 is_stmt 1 view .LVU874
+.LVL138:
+	.loc 1 131 5 view .LVU875
+# blake2sp.c:131:     return len < BLAKE2S_BLOCK ? len : BLAKE2S_BLOCK;
+	.loc 1 131 27 is_stmt 0 view .LVU876
+	movl	$64, %esi	#, tmp277
+# blake2sp.c:130:     len -= j*BLAKE2S_BLOCK;
+	.loc 1 130 9 view .LVU877
+	leaq	-384(%rax), %rdx	#, _96
+.LVL139:
+	.loc 1 130 9 view .LVU878
+.LBE249:
+.LBE277:
+# blake2sp.c:141:         job[i].ctx = &ctx->S[i];
+	.loc 1 141 22 view .LVU879
+	leaq	896(%rdi), %r13	#, _85
+.LBB278:
+.LBB250:
+# blake2sp.c:131:     return len < BLAKE2S_BLOCK ? len : BLAKE2S_BLOCK;
+	.loc 1 131 27 view .LVU880
+	cmpq	%rsi, %rdx	# tmp277, _96
+	cmova	%rsi, %rdx	# _96,, tmp277, _96
+.LVL140:
+	.loc 1 131 27 view .LVU881
+.LBE250:
+.LBE278:
+	.loc 1 144 9 is_stmt 1 view .LVU882
+	.loc 1 140 34 view .LVU883
+	.loc 1 140 28 view .LVU884
+	.loc 1 141 9 view .LVU885
+	.loc 1 142 9 view .LVU886
+# blake2sp.c:142:         job[i].src = ctx->buf + i*BLAKE2S_BLOCK;
+	.loc 1 142 31 is_stmt 0 view .LVU887
+	leaq	1600(%rdi), %rsi	#, _89
+	.loc 1 143 9 is_stmt 1 view .LVU888
+.LVL141:
+.LBB279:
+	.loc 1 126 15 view .LVU889
+.LBB251:
+	.loc 1 128 5 view .LVU890
+# blake2sp.c:128:     if (len <= j*BLAKE2S_BLOCK)
+	.loc 1 128 8 is_stmt 0 view .LVU891
+	cmpq	$448, %rax	#, _7
+	jbe	.L103	#,
+	.loc 1 130 5 is_stmt 1 view .LVU892
+.LVL142:
+	.loc 1 131 5 view .LVU893
+# blake2sp.c:130:     len -= j*BLAKE2S_BLOCK;
+	.loc 1 130 9 is_stmt 0 view .LVU894
+	subq	$448, %rax	#, _92
+.LVL143:
+# blake2sp.c:131:     return len < BLAKE2S_BLOCK ? len : BLAKE2S_BLOCK;
+	.loc 1 131 27 view .LVU895
+	movl	$64, %edi	#, tmp276
+.LVL144:
+	.loc 1 131 27 view .LVU896
+	cmpq	%rdi, %rax	# tmp276, _92
+	cmova	%rdi, %rax	# _92,, tmp276, _92
+.LVL145:
+.L86:
+	.loc 1 131 27 view .LVU897
+.LBE251:
+.LBE279:
+.LBE291:
+# blake2sp.c:146:     blake2s_lanes_run(job, BSP_LEAVES);
+	.loc 1 146 5 view .LVU898
+	leaq	304(%rsp), %rdi	#, tmp264
+.LBB292:
+# blake2sp.c:142:         job[i].src = ctx->buf + i*BLAKE2S_BLOCK;
+	.loc 1 142 20 view .LVU899
+	movq	%rsi, 536(%rsp)	# _89, job[7].src
+.LVL146:
+	.loc 1 142 20 view .LVU900
+.LBE292:
+# blake2sp.c:146:     blake2s_lanes_run(job, BSP_LEAVES);
+	.loc 1 146 5 view .LVU901
+	movl	$8, %esi	#,
+	movq	%r9, 40(%rsp)	# _170, %sfp
+	movq	%r8, 32(%rsp)	# _118, %sfp
+	movq	%rcx, 24(%rsp)	# _64, %sfp
+.LBB293:
+# blake2sp.c:143:         job[i].len = bsp_slice(ctx->buf_len, i);
+	.loc 1 143 20 view .LVU902
+	movq	%rdx, 512(%rsp)	# _96, job[6].len
+	movq	%rax, 544(%rsp)	# _92, job[7].len
+	.loc 1 144 9 is_stmt 1 view .LVU903
+.LBE293:
+# blake2sp.c:146:     blake2s_lanes_run(job, BSP_LEAVES);
+	.loc 1 146 5 is_stmt 0 view .LVU904
+	movq	%rdi, 16(%rsp)	# tmp264, %sfp
+.LBB294:
+# blake2sp.c:144:         job[i].out = NULL;
+	.loc 1 144 20 view .LVU905
+	movq	$0, 520(%rsp)	#, job[6].out
+# blake2sp.c:141:         job[i].ctx = &ctx->S[i];
+	.loc 1 141 20 view .LVU906
+	movq	%r13, 528(%rsp)	# _85, job[7].ctx
+# blake2sp.c:144:         job[i].out = NULL;
+	.loc 1 144 20 view .LVU907
+	movq	$0, 552(%rsp)	#, job[7].out
+	.loc 1 140 34 is_stmt 1 view .LVU908
+.LVL147:
+	.loc 1 140 28 view .LVU909
+.LBE294:
+	.loc 1 146 5 view .LVU910
+	call	blake2s_lanes_run@PLT	#
+.LVL148:
+	.loc 1 147 5 view .LVU911
+.LBB295:
+	.loc 1 147 10 view .LVU912
+	.loc 1 147 28 view .LVU913
+# blake2sp.c:150:         job[i].len = bsp_slice(ctx->buf_len, i + BSP_LEAVES);
+	.loc 1 150 22 is_stmt 0 view .LVU914
+	movl	2112(%rbx), %eax	# ctx_25(D)->buf_len, _15
+	.loc 1 148 9 is_stmt 1 view .LVU915
+.LBB296:
+.LBB297:
+# blake2sp.c:128:     if (len <= j*BLAKE2S_BLOCK)
+	.loc 1 128 8 is_stmt 0 view .LVU916
+	movq	16(%rsp), %rdi	# %sfp, tmp264
+.LBE297:
+.LBE296:
+# blake2sp.c:149:         job[i].src = ctx->buf + (i + BSP_LEAVES)*BLAKE2S_BLOCK;
+	.loc 1 149 31 view .LVU917
+	leaq	1664(%rbx), %rdx	#, tmp189
+# blake2sp.c:148:         job[i].ctx = &ctx->S[i];
+	.loc 1 148 20 view .LVU918
+	movq	%rbx, 304(%rsp)	# ctx, job[0].ctx
+	.loc 1 149 9 is_stmt 1 view .LVU919
+.LBB322:
+.LBB298:
+# blake2sp.c:128:     if (len <= j*BLAKE2S_BLOCK)
+	.loc 1 128 8 is_stmt 0 view .LVU920
+	movq	24(%rsp), %rcx	# %sfp, _64
+	cmpq	$512, %rax	#, _15
+	movq	32(%rsp), %r8	# %sfp, _118
+	movq	40(%rsp), %r9	# %sfp, _170
+.LBE298:
+.LBE322:
+# blake2sp.c:149:         job[i].src = ctx->buf + (i + BSP_LEAVES)*BLAKE2S_BLOCK;
+	.loc 1 149 31 view .LVU921
+	movq	%rdx, 312(%rsp)	# tmp189, job[0].src
+	.loc 1 150 9 is_stmt 1 view .LVU922
+.LVL149:
+.LBB323:
+.LBI296:
+	.loc 1 126 15 view .LVU923
+.LBB299:
+	.loc 1 128 5 view .LVU924
+# blake2sp.c:128:     if (len <= j*BLAKE2S_BLOCK)
+	.loc 1 128 8 is_stmt 0 view .LVU925
+	jbe	.L107	#,
+.LVL150:
+	.loc 1 130 5 is_stmt 1 view .LVU926
+	.loc 1 131 5 view .LVU927
+# blake2sp.c:130:     len -= j*BLAKE2S_BLOCK;
+	.loc 1 130 9 is_stmt 0 view .LVU928
+	leaq	-512(%rax), %rdx	#, tmp192
+# blake2sp.c:131:     return len < BLAKE2S_BLOCK ? len : BLAKE2S_BLOCK;
+	.loc 1 131 27 view .LVU929
+	movl	$64, %esi	#, tmp275
+.LBE299:
+.LBE323:
+# blake2sp.c:151:         job[i].out = hash[i];
+	.loc 1 151 20 view .LVU930
+	leaq	48(%rsp), %rbp	#, tmp265
+# blake2sp.c:148:         job[i].ctx = &ctx->S[i];
+	.loc 1 148 20 view .LVU931
+	movq	%r9, 336(%rsp)	# _170, job[1].ctx
+.LBB324:
+.LBB300:
+# blake2sp.c:131:     return len < BLAKE2S_BLOCK ? len : BLAKE2S_BLOCK;
+	.loc 1 131 27 view .LVU932
+	cmpq	%rsi, %rdx	# tmp275, tmp192
+.LBE300:
+.LBE324:
+# blake2sp.c:151:         job[i].out = hash[i];
+	.loc 1 151 20 view .LVU933
+	movq	%rbp, 328(%rsp)	# tmp265, job[0].out
+.LBB325:
+.LBB301:
+# blake2sp.c:131:     return len < BLAKE2S_BLOCK ? len : BLAKE2S_BLOCK;
+	.loc 1 131 27 view .LVU934
+	cmova	%rsi, %rdx	# tmp192,, tmp275, tmp193
+.LBE301:
+.LBE325:
+# blake2sp.c:150:         job[i].len = bsp_slice(ctx->buf_len, i + BSP_LEAVES);
+	.loc 1 150 20 view .LVU935
+	movq	%rdx, 320(%rsp)	# tmp193, job[0].len
+	.loc 1 151 9 is_stmt 1 view .LVU936
+	.loc 1 147 34 view .LVU937
+.LVL151:
+	.loc 1 147 28 view .LVU938
+	.loc 1 148 9 view .LVU939
+	.loc 1 149 9 view .LVU940
+# blake2sp.c:149:         job[i].src = ctx->buf + (i + BSP_LEAVES)*BLAKE2S_BLOCK;
+	.loc 1 149 31 is_stmt 0 view .LVU941
+	leaq	1728(%rbx), %rdx	#, tmp196
+	movq	%rdx, 344(%rsp)	# tmp196, job[1].src
+	.loc 1 150 9 is_stmt 1 view .LVU942
+.LVL152:
+.LBB326:
+	.loc 1 126 15 view .LVU943
+.LBB302:
+	.loc 1 128 5 view .LVU944
+# blake2sp.c:128:     if (len <= j*BLAKE2S_BLOCK)
+	.loc 1 128 8 is_stmt 0 view .LVU945
+	cmpq	$576, %rax	#, _15
+	jbe	.L88	#,
+	.loc 1 130 5 is_stmt 1 view .LVU946
+.LVL153:
+	.loc 1 131 5 view .LVU947
+# blake2sp.c:130:     len -= j*BLAKE2S_BLOCK;
+	.loc 1 130 9 is_stmt 0 view .LVU948
+	leaq	-576(%rax), %rdx	#, tmp200
+# blake2sp.c:131:     return len < BLAKE2S_BLOCK ? len : BLAKE2S_BLOCK;
+	.loc 1 131 27 view .LVU949
+	movl	$64, %esi	#, tmp274
+.LBE302:
+.LBE326:
+# blake2sp.c:148:         job[i].ctx = &ctx->S[i];
+	.loc 1 148 20 view .LVU950
+	movq	%r12, 368(%rsp)	# _38, job[2].ctx
+.LBB327:
+.LBB303:
+# blake2sp.c:131:     return len < BLAKE2S_BLOCK ? len : BLAKE2S_BLOCK;
+	.loc 1 131 27 view .LVU951
+	cmpq	%rsi, %rdx	# tmp274, tmp200
+	cmova	%rsi, %rdx	# tmp200,, tmp274, tmp201
+.LBE303:
+.LBE327:
+# blake2sp.c:150:         job[i].len = bsp_slice(ctx->buf_len, i + BSP_LEAVES);
+	.loc 1 150 20 view .LVU952
+	movq	%rdx, 352(%rsp)	# tmp201, job[1].len
+	.loc 1 151 9 is_stmt 1 view .LVU953
+# blake2sp.c:151:         job[i].out = hash[i];
+	.loc 1 151 20 is_stmt 0 view .LVU954
+	leaq	80(%rsp), %rdx	#, tmp204
+	movq	%rdx, 360(%rsp)	# tmp204, job[1].out
+	.loc 1 147 34 is_stmt 1 view .LVU955
+.LVL154:
+	.loc 1 147 28 view .LVU956
+	.loc 1 148 9 view .LVU957
+	.loc 1 149 9 view .LVU958
+# blake2sp.c:149:         job[i].src = ctx->buf + (i + BSP_LEAVES)*BLAKE2S_BLOCK;
+	.loc 1 149 31 is_stmt 0 view .LVU959
+	leaq	1792(%rbx), %rdx	#, tmp205
+	movq	%rdx, 376(%rsp)	# tmp205, job[2].src
+	.loc 1 150 9 is_stmt 1 view .LVU960
+.LVL155:
+.LBB328:
+	.loc 1 126 15 view .LVU961
+.LBB304:
+	.loc 1 128 5 view .LVU962
+# blake2sp.c:128:     if (len <= j*BLAKE2S_BLOCK)
+	.loc 1 128 8 is_stmt 0 view .LVU963
+	cmpq	$640, %rax	#, _15
+	jbe	.L90	#,
+	.loc 1 130 5 is_stmt 1 view .LVU964
+.LVL156:
+	.loc 1 131 5 view .LVU965
+# blake2sp.c:130:     len -= j*BLAKE2S_BLOCK;
+	.loc 1 130 9 is_stmt 0 view .LVU966
+	leaq	-640(%rax), %rdx	#, tmp209
+# blake2sp.c:131:     return len < BLAKE2S_BLOCK ? len : BLAKE2S_BLOCK;
+	.loc 1 131 27 view .LVU967
+	movl	$64, %esi	#, tmp273
+.LBE304:
+.LBE328:
+# blake2sp.c:148:         job[i].ctx = &ctx->S[i];
+	.loc 1 148 20 view .LVU968
+	movq	%r8, 400(%rsp)	# _118, job[3].ctx
+.LBB329:
+.LBB305:
+# blake2sp.c:131:     return len < BLAKE2S_BLOCK ? len : BLAKE2S_BLOCK;
+	.loc 1 131 27 view .LVU969
+	cmpq	%rsi, %rdx	# tmp273, tmp209
+	cmova	%rsi, %rdx	# tmp209,, tmp273, tmp210
+.LBE305:
+.LBE329:
+# blake2sp.c:150:         job[i].len = bsp_slice(ctx->buf_len, i + BSP_LEAVES);
+	.loc 1 150 20 view .LVU970
+	movq	%rdx, 384(%rsp)	# tmp210, job[2].len
+	.loc 1 151 9 is_stmt 1 view .LVU971
+# blake2sp.c:151:         job[i].out = hash[i];
+	.loc 1 151 20 is_stmt 0 view .LVU972
+	leaq	112(%rsp), %rdx	#, tmp213
+	movq	%rdx, 392(%rsp)	# tmp213, job[2].out
+	.loc 1 147 34 is_stmt 1 view .LVU973
+.LVL157:
+	.loc 1 147 28 view .LVU974
+	.loc 1 148 9 view .LVU975
+	.loc 1 149 9 view .LVU976
+# blake2sp.c:149:         job[i].src = ctx->buf + (i + BSP_LEAVES)*BLAKE2S_BLOCK;
+	.loc 1 149 31 is_stmt 0 view .LVU977
+	leaq	1856(%rbx), %rdx	#, tmp214
+	movq	%rdx, 408(%rsp)	# tmp214, job[3].src
+	.loc 1 150 9 is_stmt 1 view .LVU978
+.LVL158:
+.LBB330:
+	.loc 1 126 15 view .LVU979
+.LBB306:
+	.loc 1 128 5 view .LVU980
+# blake2sp.c:128:     if (len <= j*BLAKE2S_BLOCK)
+	.loc 1 128 8 is_stmt 0 view .LVU981
+	cmpq	$704, %rax	#, _15
+	jbe	.L92	#,
+	.loc 1 130 5 is_stmt 1 view .LVU982
+.LVL159:
+	.loc 1 131 5 view .LVU983
+# blake2sp.c:130:     len -= j*BLAKE2S_BLOCK;
+	.loc 1 130 9 is_stmt 0 view .LVU984
+	leaq	-704(%rax), %rdx	#, tmp218
+# blake2sp.c:131:     return len < BLAKE2S_BLOCK ? len : BLAKE2S_BLOCK;
+	.loc 1 131 27 view .LVU985
+	movl	$64, %esi	#, tmp272
+.LBE306:
+.LBE330:
+# blake2sp.c:148:         job[i].ctx = &ctx->S[i];
+	.loc 1 148 20 view .LVU986
+	movq	%rcx, 432(%rsp)	# _64, job[4].ctx
+.LBB331:
+.LBB307:
+# blake2sp.c:131:     return len < BLAKE2S_BLOCK ? len : BLAKE2S_BLOCK;
+	.loc 1 131 27 view .LVU987
+	cmpq	%rsi, %rdx	# tmp272, tmp218
+	cmova	%rsi, %rdx	# tmp218,, tmp272, tmp219
+.LBE307:
+.LBE331:
+# blake2sp.c:150:         job[i].len = bsp_slice(ctx->buf_len, i + BSP_LEAVES);
+	.loc 1 150 20 view .LVU988
+	movq	%rdx, 416(%rsp)	# tmp219, job[3].len
+	.loc 1 151 9 is_stmt 1 view .LVU989
+# blake2sp.c:151:         job[i].out = hash[i];
+	.loc 1 151 20 is_stmt 0 view .LVU990
+	leaq	144(%rsp), %rdx	#, tmp222
+	movq	%rdx, 424(%rsp)	# tmp222, job[3].out
+	.loc 1 147 34 is_stmt 1 view .LVU991
+.LVL160:
+	.loc 1 147 28 view .LVU992
+	.loc 1 148 9 view .LVU993
+	.loc 1 149 9 view .LVU994
+# blake2sp.c:149:         job[i].src = ctx->buf + (i + BSP_LEAVES)*BLAKE2S_BLOCK;
+	.loc 1 149 31 is_stmt 0 view .LVU995
+	leaq	1920(%rbx), %rdx	#, tmp223
+	movq	%rdx, 440(%rsp)	# tmp223, job[4].src
+	.loc 1 150 9 is_stmt 1 view .LVU996
+.LVL161:
+.LBB332:
+	.loc 1 126 15 view .LVU997
+.LBB308:
+	.loc 1 128 5 view .LVU998
+# blake2sp.c:128:     if (len <= j*BLAKE2S_BLOCK)
+	.loc 1 128 8 is_stmt 0 view .LVU999
+	cmpq	$768, %rax	#, _15
+	jbe	.L94	#,
+	.loc 1 130 5 is_stmt 1 view .LVU1000
+.LVL162:
+	.loc 1 131 5 view .LVU1001
+# blake2sp.c:130:     len -= j*BLAKE2S_BLOCK;
+	.loc 1 130 9 is_stmt 0 view .LVU1002
+	leaq	-768(%rax), %rdx	#, tmp227
+# blake2sp.c:131:     return len < BLAKE2S_BLOCK ? len : BLAKE2S_BLOCK;
+	.loc 1 131 27 view .LVU1003
+	movl	$64, %ecx	#, tmp271
+.LBE308:
+.LBE332:
+# blake2sp.c:148:         job[i].ctx = &ctx->S[i];
+	.loc 1 148 20 view .LVU1004
+	movq	%r15, 464(%rsp)	# _1, job[5].ctx
+.LBB333:
+.LBB309:
+# blake2sp.c:131:     return len < BLAKE2S_BLOCK ? len : BLAKE2S_BLOCK;
+	.loc 1 131 27 view .LVU1005
+	cmpq	%rcx, %rdx	# tmp271, tmp227
+	cmova	%rcx, %rdx	# tmp227,, tmp271, tmp228
+.LBE309:
+.LBE333:
+# blake2sp.c:150:         job[i].len = bsp_slice(ctx->buf_len, i + BSP_LEAVES);
+	.loc 1 150 20 view .LVU1006
+	movq	%rdx, 448(%rsp)	# tmp228, job[4].len
+	.loc 1 151 9 is_stmt 1 view .LVU1007
+# blake2sp.c:151:         job[i].out = hash[i];
+	.loc 1 151 20 is_stmt 0 view .LVU1008
+	leaq	176(%rsp), %rdx	#, tmp231
+	movq	%rdx, 456(%rsp)	# tmp231, job[4].out
+	.loc 1 147 34 is_stmt 1 view .LVU1009
+.LVL163:
+	.loc 1 147 28 view .LVU1010
+	.loc 1 148 9 view .LVU1011
+	.loc 1 149 9 view .LVU1012
+# blake2sp.c:149:         job[i].src = ctx->buf + (i + BSP_LEAVES)*BLAKE2S_BLOCK;
+	.loc 1 149 31 is_stmt 0 view .LVU1013
+	leaq	1984(%rbx), %rdx	#, tmp232
+	movq	%rdx, 472(%rsp)	# tmp232, job[5].src
+	.loc 1 150 9 is_stmt 1 view .LVU1014
+.LVL164:
+.LBB334:
+	.loc 1 126 15 view .LVU1015
+.LBB310:
+	.loc 1 128 5 view .LVU1016
+# blake2sp.c:128:     if (len <= j*BLAKE2S_BLOCK)
+	.loc 1 128 8 is_stmt 0 view .LVU1017
+	cmpq	$832, %rax	#, _15
+	jbe	.L96	#,
+	.loc 1 130 5 is_stmt 1 view .LVU1018
+.LVL165:
+	.loc 1 131 5 view .LVU1019
+# blake2sp.c:130:     len -= j*BLAKE2S_BLOCK;
+	.loc 1 130 9 is_stmt 0 view .LVU1020
+	leaq	-832(%rax), %rdx	#, tmp236
+# blake2sp.c:131:     return len < BLAKE2S_BLOCK ? len : BLAKE2S_BLOCK;
+	.loc 1 131 27 view .LVU1021
+	movl	$64, %ecx	#, tmp270
+.LBE310:
+.LBE334:
+# blake2sp.c:148:         job[i].ctx = &ctx->S[i];
+	.loc 1 148 20 view .LVU1022
+	movq	%r14, 496(%rsp)	# _77, job[6].ctx
+.LBB335:
+.LBB311:
+# blake2sp.c:131:     return len < BLAKE2S_BLOCK ? len : BLAKE2S_BLOCK;
+	.loc 1 131 27 view .LVU1023
+	cmpq	%rcx, %rdx	# tmp270, tmp236
+	cmova	%rcx, %rdx	# tmp236,, tmp270, tmp237
+.LBE311:
+.LBE335:
+# blake2sp.c:150:         job[i].len = bsp_slice(ctx->buf_len, i + BSP_LEAVES);
+	.loc 1 150 20 view .LVU1024
+	movq	%rdx, 480(%rsp)	# tmp237, job[5].len
+	.loc 1 151 9 is_stmt 1 view .LVU1025
+# blake2sp.c:151:         job[i].out = hash[i];
+	.loc 1 151 20 is_stmt 0 view .LVU1026
+	leaq	208(%rsp), %rdx	#, tmp240
+	movq	%rdx, 488(%rsp)	# tmp240, job[5].out
+	.loc 1 147 34 is_stmt 1 view .LVU1027
+.LVL166:
+	.loc 1 147 28 view .LVU1028
+	.loc 1 148 9 view .LVU1029
+	.loc 1 149 9 view .LVU1030
+# blake2sp.c:149:         job[i].src = ctx->buf + (i + BSP_LEAVES)*BLAKE2S_BLOCK;
+	.loc 1 149 31 is_stmt 0 view .LVU1031
+	leaq	2048(%rbx), %rdx	#, tmp241
+	movq	%rdx, 504(%rsp)	# tmp241, job[6].src
+	.loc 1 150 9 is_stmt 1 view .LVU1032
+.LVL167:
+.LBB336:
+	.loc 1 126 15 view .LVU1033
+.LBB312:
+	.loc 1 128 5 view .LVU1034
+# blake2sp.c:128:     if (len <= j*BLAKE2S_BLOCK)
+	.loc 1 128 8 is_stmt 0 view .LVU1035
+	cmpq	$896, %rax	#, _15
+	jbe	.L98	#,
+	.loc 1 130 5 is_stmt 1 view .LVU1036
+.LVL168:
+	.loc 1 131 5 view .LVU1037
+# blake2sp.c:131:     return len < BLAKE2S_BLOCK ? len : BLAKE2S_BLOCK;
+	.loc 1 131 27 is_stmt 0 view .LVU1038
+	movl	$64, %ecx	#, tmp268
+# blake2sp.c:130:     len -= j*BLAKE2S_BLOCK;
+	.loc 1 130 9 view .LVU1039
+	leaq	-896(%rax), %rdx	#, tmp245
+.LBE312:
+.LBE336:
+# blake2sp.c:148:         job[i].ctx = &ctx->S[i];
+	.loc 1 148 20 view .LVU1040
+	movq	%r13, 528(%rsp)	# _85, job[7].ctx
+.LBB337:
+.LBB313:
+# blake2sp.c:131:     return len < BLAKE2S_BLOCK ? len : BLAKE2S_BLOCK;
+	.loc 1 131 27 view .LVU1041
+	cmpq	%rcx, %rdx	# tmp268, tmp245
+	cmova	%rcx, %rdx	# tmp245,, tmp268, tmp246
+.LBE313:
+.LBE337:
+# blake2sp.c:150:         job[i].len = bsp_slice(ctx->buf_len, i + BSP_LEAVES);
+	.loc 1 150 20 view .LVU1042
+	movq	%rdx, 512(%rsp)	# tmp246, job[6].len
+	.loc 1 151 9 is_stmt 1 view .LVU1043
+# blake2sp.c:151:         job[i].out = hash[i];
+	.loc 1 151 20 is_stmt 0 view .LVU1044
+	leaq	240(%rsp), %rdx	#, tmp249
+	movq	%rdx, 520(%rsp)	# tmp249, job[6].out
+	.loc 1 147 34 is_stmt 1 view .LVU1045
+.LVL169:
+	.loc 1 147 28 view .LVU1046
+	.loc 1 148 9 view .LVU1047
+	.loc 1 149 9 view .LVU1048
+# blake2sp.c:149:         job[i].src = ctx->buf + (i + BSP_LEAVES)*BLAKE2S_BLOCK;
+	.loc 1 149 31 is_stmt 0 view .LVU1049
+	leaq	2112(%rbx), %rdx	#, tmp250
+	movq	%rdx, 536(%rsp)	# tmp250, job[7].src
+	.loc 1 150 9 is_stmt 1 view .LVU1050
+.LVL170:
+.LBB338:
+	.loc 1 126 15 view .LVU1051
+.LBB314:
+	.loc 1 128 5 view .LVU1052
+# blake2sp.c:130:     len -= j*BLAKE2S_BLOCK;
+	.loc 1 130 9 is_stmt 0 view .LVU1053
+	leaq	-960(%rax), %rdx	#, _70
+.LVL171:
+# blake2sp.c:131:     return len < BLAKE2S_BLOCK ? len : BLAKE2S_BLOCK;
+	.loc 1 131 27 view .LVU1054
+	cmpq	%rcx, %rdx	# tmp269, _70
+	cmova	%rcx, %rdx	# _70,, tmp269, _70
+# blake2sp.c:128:     if (len <= j*BLAKE2S_BLOCK)
+	.loc 1 128 8 view .LVU1055
+	cmpq	$960, %rax	#, _15
+	jbe	.L100	#,
+.LVL172:
+.L102:
+	.loc 1 128 8 view .LVU1056
+.LBE314:
+.LBE338:
+# blake2sp.c:151:         job[i].out = hash[i];
+	.loc 1 151 20 view .LVU1057
+	leaq	272(%rsp), %rax	#, tmp252
+.LBE295:
+# blake2sp.c:155:     blake2s_update(&ctx->R, hash, sizeof(hash));
+	.loc 1 155 5 view .LVU1058
+	leaq	1024(%rbx), %r12	#, _17
+# blake2sp.c:153:     blake2s_lanes_run(job, BSP_LEAVES);
+	.loc 1 153 5 view .LVU1059
+	movl	$8, %esi	#,
+.LBB346:
+# blake2sp.c:150:         job[i].len = bsp_slice(ctx->buf_len, i + BSP_LEAVES);
+	.loc 1 150 20 view .LVU1060
+	movq	%rdx, 544(%rsp)	# _70, job[7].len
+	.loc 1 151 9 is_stmt 1 view .LVU1061
+# blake2sp.c:151:         job[i].out = hash[i];
+	.loc 1 151 20 is_stmt 0 view .LVU1062
+	movq	%rax, 552(%rsp)	# tmp252, job[7].out
+	.loc 1 147 34 is_stmt 1 view .LVU1063
+.LVL173:
+	.loc 1 147 28 view .LVU1064
+.LBE346:
+	.loc 1 153 5 view .LVU1065
+	call	blake2s_lanes_run@PLT	#
+.LVL174:
+	.loc 1 155 5 view .LVU1066
+	movq	%rbp, %rsi	# tmp265,
+	movq	%r12, %rdi	# _17,
+	movl	$256, %edx	#,
+	call	blake2s_update@PLT	#
+.LVL175:
+	.loc 1 156 5 view .LVU1067
+	movq	8(%rsp), %rsi	# %sfp,
+	movq	%r12, %rdi	# _17,
+	call	blake2s_final@PLT	#
+.LVL176:
+	.loc 1 157 5 view .LVU1068
+	.loc 1 158 5 view .LVU1069
+	leaq	8(%rbx), %rdi	#, tmp261
+	movq	$0, (%rbx)	#,* ctx
+.LVL177:
+	.loc 1 158 5 is_stmt 0 view .LVU1070
+	xorl	%eax, %eax	# tmp257
+	movq	$0, 2120(%rbx)	#,
+	andq	$-8, %rdi	#, tmp261
+	subq	%rdi, %rbx	# tmp261, ctx
+.LVL178:
+	.loc 1 158 5 view .LVU1071
+	leal	2128(%rbx), %ecx	#, tmp256
+	shrl	$3, %ecx	#,
+	rep stosq
+# blake2sp.c:159: }
+	.loc 1 159 1 view .LVU1072
+	addq	$568, %rsp	#,
+	.cfi_remember_state
+	.cfi_def_cfa_offset 56
+	popq	%rbx	#
+	.cfi_def_cfa_offset 48
+	popq	%rbp	#
+	.cfi_def_cfa_offset 40
+	popq	%r12	#
+	.cfi_def_cfa_offset 32
+.LVL179:
+	.loc 1 159 1 view .LVU1073
+	popq	%r13	#
+	.cfi_def_cfa_offset 24
+	popq	%r14	#
+	.cfi_def_cfa_offset 16
+	popq	%r15	#
+	.cfi_def_cfa_offset 8
+	ret	
+.LVL180:
+	.p2align 4,,10
+	.p2align 3
+.L106:
+	.cfi_restore_state
+.LBB347:
+# blake2sp.c:141:         job[i].ctx = &ctx->S[i];
+	.loc 1 141 22 view .LVU1074
+	leaq	128(%rdi), %r9	#, _170
+# blake2sp.c:142:         job[i].src = ctx->buf + i*BLAKE2S_BLOCK;
+	.loc 1 142 31 view .LVU1075
+	leaq	1216(%rdi), %rax	#, tmp159
+# blake2sp.c:143:         job[i].len = bsp_slice(ctx->buf_len, i);
+	.loc 1 143 20 view .LVU1076
+	movq	$0, 320(%rsp)	#, job[0].len
+	.loc 1 144 9 is_stmt 1 view .LVU1077
+# blake2sp.c:144:         job[i].out = NULL;
+	.loc 1 144 20 is_stmt 0 view .LVU1078
+	movq	$0, 328(%rsp)	#, job[0].out
+	.loc 1 140 34 is_stmt 1 view .LVU1079
+.LVL181:
+	.loc 1 140 28 view .LVU1080
+	.loc 1 141 9 view .LVU1081
+# blake2sp.c:141:         job[i].ctx = &ctx->S[i];
+	.loc 1 141 20 is_stmt 0 view .LVU1082
+	movq	%r9, 336(%rsp)	# _170, job[1].ctx
+	.loc 1 142 9 is_stmt 1 view .LVU1083
+# blake2sp.c:142:         job[i].src = ctx->buf + i*BLAKE2S_BLOCK;
+	.loc 1 142 31 is_stmt 0 view .LVU1084
+	movq	%rax, 344(%rsp)	# tmp159, job[1].src
+	.loc 1 143 9 is_stmt 1 view .LVU1085
+.LVL182:
+.LBB280:
+	.loc 1 126 15 view .LVU1086
+.LBB252:
+	.loc 1 128 5 view .LVU1087
+.L105:
+	.loc 1 128 5 is_stmt 0 view .LVU1088
+.LBE252:
+.LBE280:
+# blake2sp.c:141:         job[i].ctx = &ctx->S[i];
+	.loc 1 141 22 view .LVU1089
+	leaq	256(%rbx), %r12	#, _38
+# blake2sp.c:142:         job[i].src = ctx->buf + i*BLAKE2S_BLOCK;
+	.loc 1 142 31 view .LVU1090
+	leaq	1280(%rbx), %rax	#, tmp163
+# blake2sp.c:143:         job[i].len = bsp_slice(ctx->buf_len, i);
+	.loc 1 143 20 view .LVU1091
+	movq	$0, 352(%rsp)	#, job[1].len
+	.loc 1 144 9 is_stmt 1 view .LVU1092
+# blake2sp.c:144:         job[i].out = NULL;
+	.loc 1 144 20 is_stmt 0 view .LVU1093
+	movq	$0, 360(%rsp)	#, job[1].out
+	.loc 1 140 34 is_stmt 1 view .LVU1094
+.LVL183:
+	.loc 1 140 28 view .LVU1095
+	.loc 1 141 9 view .LVU1096
+# blake2sp.c:141:         job[i].ctx = &ctx->S[i];
+	.loc 1 141 20 is_stmt 0 view .LVU1097
+	movq	%r12, 368(%rsp)	# _38, job[2].ctx
+	.loc 1 142 9 is_stmt 1 view .LVU1098
+# blake2sp.c:142:         job[i].src = ctx->buf + i*BLAKE2S_BLOCK;
+	.loc 1 142 31 is_stmt 0 view .LVU1099
+	movq	%rax, 376(%rsp)	# tmp163, job[2].src
+	.loc 1 143 9 is_stmt 1 view .LVU1100
+.LVL184:
+.LBB281:
+	.loc 1 126 15 view .LVU1101
+.LBB253:
+	.loc 1 128 5 view .LVU1102
+.L75:
+	.loc 1 128 5 is_stmt 0 view .LVU1103
+.LBE253:
+.LBE281:
+# blake2sp.c:141:         job[i].ctx = &ctx->S[i];
+	.loc 1 141 22 view .LVU1104
+	leaq	384(%rbx), %r8	#, _118
+# blake2sp.c:142:         job[i].src = ctx->buf + i*BLAKE2S_BLOCK;
+	.loc 1 142 31 view .LVU1105
+	leaq	1344(%rbx), %rax	#, tmp168
+# blake2sp.c:143:         job[i].len = bsp_slice(ctx->buf_len, i);
+	.loc 1 143 20 view .LVU1106
+	movq	$0, 384(%rsp)	#, job[2].len
+	.loc 1 144 9 is_stmt 1 view .LVU1107
+# blake2sp.c:144:         job[i].out = NULL;
+	.loc 1 144 20 is_stmt 0 view .LVU1108
+	movq	$0, 392(%rsp)	#, job[2].out
+	.loc 1 140 34 is_stmt 1 view .LVU1109
+.LVL185:
+	.loc 1 140 28 view .LVU1110
+	.loc 1 141 9 view .LVU1111
+# blake2sp.c:141:         job[i].ctx = &ctx->S[i];
+	.loc 1 141 20 is_stmt 0 view .LVU1112
+	movq	%r8, 400(%rsp)	# _118, job[3].ctx
+	.loc 1 142 9 is_stmt 1 view .LVU1113
+# blake2sp.c:142:         job[i].src = ctx->buf + i*BLAKE2S_BLOCK;
+	.loc 1 142 31 is_stmt 0 view .LVU1114
+	movq	%rax, 408(%rsp)	# tmp168, job[3].src
+	.loc 1 143 9 is_stmt 1 view .LVU1115
+.LVL186:
+.LBB282:
+	.loc 1 126 15 view .LVU1116
+.LBB254:
+	.loc 1 128 5 view .LVU1117
+.L78:
+	.loc 1 128 5 is_stmt 0 view .LVU1118
+.LBE254:
+.LBE282:
+# blake2sp.c:141:         job[i].ctx = &ctx->S[i];
+	.loc 1 141 22 view .LVU1119
+	leaq	512(%rbx), %rcx	#, _64
+# blake2sp.c:142:         job[i].src = ctx->buf + i*BLAKE2S_BLOCK;
+	.loc 1 142 31 view .LVU1120
+	leaq	1408(%rbx), %rax	#, tmp173
+# blake2sp.c:143:         job[i].len = bsp_slice(ctx->buf_len, i);
+	.loc 1 143 20 view .LVU1121
+	movq	$0, 416(%rsp)	#, job[3].len
+	.loc 1 144 9 is_stmt 1 view .LVU1122
+# blake2sp.c:144:         job[i].out = NULL;
+	.loc 1 144 20 is_stmt 0 view .LVU1123
+	movq	$0, 424(%rsp)	#, job[3].out
+	.loc 1 140 34 is_stmt 1 view .LVU1124
+.LVL187:
+	.loc 1 140 28 view .LVU1125
+	.loc 1 141 9 view .LVU1126
+# blake2sp.c:141:         job[i].ctx = &ctx->S[i];
+	.loc 1 141 20 is_stmt 0 view .LVU1127
+	movq	%rcx, 432(%rsp)	# _64, job[4].ctx
+	.loc 1 142 9 is_stmt 1 view .LVU1128
+# blake2sp.c:142:         job[i].src = ctx->buf + i*BLAKE2S_BLOCK;
+	.loc 1 142 31 is_stmt 0 view .LVU1129
+	movq	%rax, 440(%rsp)	# tmp173, job[4].src
+	.loc 1 143 9 is_stmt 1 view .LVU1130
+.LVL188:
+.LBB283:
+	.loc 1 126 15 view .LVU1131
+.LBB255:
+	.loc 1 128 5 view .LVU1132
+.L80:
+	.loc 1 128 5 is_stmt 0 view .LVU1133
+.LBE255:
+.LBE283:
+# blake2sp.c:141:         job[i].ctx = &ctx->S[i];
+	.loc 1 141 22 view .LVU1134
+	leaq	640(%rbx), %r15	#, _1
+# blake2sp.c:142:         job[i].src = ctx->buf + i*BLAKE2S_BLOCK;
+	.loc 1 142 31 view .LVU1135
+	leaq	1472(%rbx), %rax	#, tmp178
+# blake2sp.c:143:         job[i].len = bsp_slice(ctx->buf_len, i);
+	.loc 1 143 20 view .LVU1136
+	movq	$0, 448(%rsp)	#, job[4].len
+	.loc 1 144 9 is_stmt 1 view .LVU1137
+# blake2sp.c:144:         job[i].out = NULL;
+	.loc 1 144 20 is_stmt 0 view .LVU1138
+	movq	$0, 456(%rsp)	#, job[4].out
+	.loc 1 140 34 is_stmt 1 view .LVU1139
+.LVL189:
+	.loc 1 140 28 view .LVU1140
+	.loc 1 141 9 view .LVU1141
+# blake2sp.c:141:         job[i].ctx = &ctx->S[i];
+	.loc 1 141 20 is_stmt 0 view .LVU1142
+	movq	%r15, 464(%rsp)	# _1, job[5].ctx
+	.loc 1 142 9 is_stmt 1 view .LVU1143
+# blake2sp.c:142:         job[i].src = ctx->buf + i*BLAKE2S_BLOCK;
+	.loc 1 142 31 is_stmt 0 view .LVU1144
+	movq	%rax, 472(%rsp)	# tmp178, job[5].src
+	.loc 1 143 9 is_stmt 1 view .LVU1145
+.LVL190:
+.LBB284:
+	.loc 1 126 15 view .LVU1146
+.LBB256:
+	.loc 1 128 5 view .LVU1147
+.L82:
+	.loc 1 128 5 is_stmt 0 view .LVU1148
+.LBE256:
+.LBE284:
+# blake2sp.c:141:         job[i].ctx = &ctx->S[i];
+	.loc 1 141 22 view .LVU1149
+	leaq	768(%rbx), %r14	#, _77
+# blake2sp.c:142:         job[i].src = ctx->buf + i*BLAKE2S_BLOCK;
+	.loc 1 142 31 view .LVU1150
+	leaq	1536(%rbx), %rax	#, tmp183
+# blake2sp.c:143:         job[i].len = bsp_slice(ctx->buf_len, i);
+	.loc 1 143 20 view .LVU1151
+	movq	$0, 480(%rsp)	#, job[5].len
+	.loc 1 144 9 is_stmt 1 view .LVU1152
+# blake2sp.c:144:         job[i].out = NULL;
+	.loc 1 144 20 is_stmt 0 view .LVU1153
+	movq	$0, 488(%rsp)	#, job[5].out
+	.loc 1 140 34 is_stmt 1 view .LVU1154
+.LVL191:
+	.loc 1 140 28 view .LVU1155
+	.loc 1 141 9 view .LVU1156
+# blake2sp.c:141:         job[i].ctx = &ctx->S[i];
+	.loc 1 141 20 is_stmt 0 view .LVU1157
+	movq	%r14, 496(%rsp)	# _77, job[6].ctx
+	.loc 1 142 9 is_stmt 1 view .LVU1158
+# blake2sp.c:142:         job[i].src = ctx->buf + i*BLAKE2S_BLOCK;
+	.loc 1 142 31 is_stmt 0 view .LVU1159
+	movq	%rax, 504(%rsp)	# tmp183, job[6].src
+	.loc 1 143 9 is_stmt 1 view .LVU1160
+.LVL192:
+.LBB285:
+	.loc 1 126 15 view .LVU1161
+.LBB257:
+	.loc 1 128 5 view .LVU1162
+.L84:
+	.loc 1 128 5 is_stmt 0 view .LVU1163
+.LBE257:
+.LBE285:
+	.loc 1 144 9 is_stmt 1 view .LVU1164
+	.loc 1 140 34 view .LVU1165
+	.loc 1 140 28 view .LVU1166
+	.loc 1 141 9 view .LVU1167
+# blake2sp.c:141:         job[i].ctx = &ctx->S[i];
+	.loc 1 141 22 is_stmt 0 view .LVU1168
+	leaq	896(%rbx), %r13	#, _85
+	.loc 1 142 9 is_stmt 1 view .LVU1169
+# blake2sp.c:142:         job[i].src = ctx->buf + i*BLAKE2S_BLOCK;
+	.loc 1 142 31 is_stmt 0 view .LVU1170
+	leaq	1600(%rbx), %rsi	#, _89
+	.loc 1 143 9 is_stmt 1 view .LVU1171
+.LVL193:
+.LBB286:
+	.loc 1 126 15 view .LVU1172
+.LBB258:
+	.loc 1 128 5 view .LVU1173
+.LBE258:
+.LBE286:
+# blake2sp.c:142:         job[i].src = ctx->buf + i*BLAKE2S_BLOCK;
+	.loc 1 142 31 is_stmt 0 view .LVU1174
+	xorl	%edx, %edx	# _96
+.LBB287:
+.LBB259:
+# blake2sp.c:129:         return 0;
+	.loc 1 129 16 view .LVU1175
+	xorl	%eax, %eax	# _92
+	jmp	.L86	#
+.LVL194:
+	.p2align 4,,10
+	.p2align 3
+.L107:
+	.loc 1 129 16 view .LVU1176
+.LBE259:
+.LBE287:
+.LBE347:
+.LBB348:
+# blake2sp.c:151:         job[i].out = hash[i];
+	.loc 1 151 20 view .LVU1177
+	leaq	48(%rsp), %rbp	#, tmp265
+# blake2sp.c:149:         job[i].src = ctx->buf + (i + BSP_LEAVES)*BLAKE2S_BLOCK;
+	.loc 1 149 31 view .LVU1178
+	leaq	1728(%rbx), %rax	#, tmp191
+# blake2sp.c:150:         job[i].len = bsp_slice(ctx->buf_len, i + BSP_LEAVES);
+	.loc 1 150 20 view .LVU1179
+	movq	$0, 320(%rsp)	#, job[0].len
+	.loc 1 151 9 is_stmt 1 view .LVU1180
+# blake2sp.c:151:         job[i].out = hash[i];
+	.loc 1 151 20 is_stmt 0 view .LVU1181
+	movq	%rbp, 328(%rsp)	# tmp265, job[0].out
+	.loc 1 147 34 is_stmt 1 view .LVU1182
+.LVL195:
+	.loc 1 147 28 view .LVU1183
+	.loc 1 148 9 view .LVU1184
+# blake2sp.c:148:         job[i].ctx = &ctx->S[i];
+	.loc 1 148 20 is_stmt 0 view .LVU1185
+	movq	%r9, 336(%rsp)	# _170, job[1].ctx
+	.loc 1 149 9 is_stmt 1 view .LVU1186
+# blake2sp.c:149:         job[i].src = ctx->buf + (i + BSP_LEAVES)*BLAKE2S_BLOCK;
+	.loc 1 149 31 is_stmt 0 view .LVU1187
+	movq	%rax, 344(%rsp)	# tmp191, job[1].src
+	.loc 1 150 9 is_stmt 1 view .LVU1188
+.LVL196:
+.LBB339:
+	.loc 1 126 15 view .LVU1189
+.LBB315:
+	.loc 1 128 5 view .LVU1190
+.L88:
+	.loc 1 128 5 is_stmt 0 view .LVU1191
+.LBE315:
+.LBE339:
+# blake2sp.c:151:         job[i].out = hash[i];
+	.loc 1 151 20 view .LVU1192
+	leaq	80(%rsp), %rax	#, tmp198
+# blake2sp.c:148:         job[i].ctx = &ctx->S[i];
+	.loc 1 148 20 view .LVU1193
+	movq	%r12, 368(%rsp)	# _38, job[2].ctx
+# blake2sp.c:151:         job[i].out = hash[i];
+	.loc 1 151 20 view .LVU1194
+	movq	%rax, 360(%rsp)	# tmp198, job[1].out
+# blake2sp.c:149:         job[i].src = ctx->buf + (i + BSP_LEAVES)*BLAKE2S_BLOCK;
+	.loc 1 149 31 view .LVU1195
+	leaq	1792(%rbx), %rax	#, tmp199
+# blake2sp.c:150:         job[i].len = bsp_slice(ctx->buf_len, i + BSP_LEAVES);
+	.loc 1 150 20 view .LVU1196
+	movq	$0, 352(%rsp)	#, job[1].len
+	.loc 1 151 9 is_stmt 1 view .LVU1197
+	.loc 1 147 34 view .LVU1198
+.LVL197:
+	.loc 1 147 28 view .LVU1199
+	.loc 1 148 9 view .LVU1200
+	.loc 1 149 9 view .LVU1201
+# blake2sp.c:149:         job[i].src = ctx->buf + (i + BSP_LEAVES)*BLAKE2S_BLOCK;
+	.loc 1 149 31 is_stmt 0 view .LVU1202
+	movq	%rax, 376(%rsp)	# tmp199, job[2].src
+	.loc 1 150 9 is_stmt 1 view .LVU1203
+.LVL198:
+.LBB340:
+	.loc 1 126 15 view .LVU1204
+.LBB316:
+	.loc 1 128 5 view .LVU1205
+.L90:
+	.loc 1 128 5 is_stmt 0 view .LVU1206
+.LBE316:
+.LBE340:
+# blake2sp.c:151:         job[i].out = hash[i];
+	.loc 1 151 20 view .LVU1207
+	leaq	112(%rsp), %rax	#, tmp207
+# blake2sp.c:148:         job[i].ctx = &ctx->S[i];
+	.loc 1 148 20 view .LVU1208
+	movq	%r8, 400(%rsp)	# _118, job[3].ctx
+# blake2sp.c:151:         job[i].out = hash[i];
+	.loc 1 151 20 view .LVU1209
+	movq	%rax, 392(%rsp)	# tmp207, job[2].out
+# blake2sp.c:149:         job[i].src = ctx->buf + (i + BSP_LEAVES)*BLAKE2S_BLOCK;
+	.loc 1 149 31 view .LVU1210
+	leaq	1856(%rbx), %rax	#, tmp208
+# blake2sp.c:150:         job[i].len = bsp_slice(ctx->buf_len, i + BSP_LEAVES);
+	.loc 1 150 20 view .LVU1211
+	movq	$0, 384(%rsp)	#, job[2].len
+	.loc 1 151 9 is_stmt 1 view .LVU1212
+	.loc 1 147 34 view .LVU1213
+.LVL199:
+	.loc 1 147 28 view .LVU1214
+	.loc 1 148 9 view .LVU1215
+	.loc 1 149 9 view .LVU1216
+# blake2sp.c:149:         job[i].src = ctx->buf + (i + BSP_LEAVES)*BLAKE2S_BLOCK;
+	.loc 1 149 31 is_stmt 0 view .LVU1217
+	movq	%rax, 408(%rsp)	# tmp208, job[3].src
+	.loc 1 150 9 is_stmt 1 view .LVU1218
+.LVL200:
+.LBB341:
+	.loc 1 126 15 view .LVU1219
+.LBB317:
+	.loc 1 128 5 view .LVU1220
+.L92:
+	.loc 1 128 5 is_stmt 0 view .LVU1221
+.LBE317:
+.LBE341:
+# blake2sp.c:151:         job[i].out = hash[i];
+	.loc 1 151 20 view .LVU1222
+	leaq	144(%rsp), %rax	#, tmp216
+# blake2sp.c:148:         job[i].ctx = &ctx->S[i];
+	.loc 1 148 20 view .LVU1223
+	movq	%rcx, 432(%rsp)	# _64, job[4].ctx
+# blake2sp.c:151:         job[i].out = hash[i];
+	.loc 1 151 20 view .LVU1224
+	movq	%rax, 424(%rsp)	# tmp216, job[3].out
+# blake2sp.c:149:         job[i].src = ctx->buf + (i + BSP_LEAVES)*BLAKE2S_BLOCK;
+	.loc 1 149 31 view .LVU1225
+	leaq	1920(%rbx), %rax	#, tmp217
+# blake2sp.c:150:         job[i].len = bsp_slice(ctx->buf_len, i + BSP_LEAVES);
+	.loc 1 150 20 view .LVU1226
+	movq	$0, 416(%rsp)	#, job[3].len
+	.loc 1 151 9 is_stmt 1 view .LVU1227
+	.loc 1 147 34 view .LVU1228
+.LVL201:
+	.loc 1 147 28 view .LVU1229
+	.loc 1 148 9 view .LVU1230
+	.loc 1 149 9 view .LVU1231
+# blake2sp.c:149:         job[i].src = ctx->buf + (i + BSP_LEAVES)*BLAKE2S_BLOCK;
+	.loc 1 149 31 is_stmt 0 view .LVU1232
+	movq	%rax, 440(%rsp)	# tmp217, job[4].src
+	.loc 1 150 9 is_stmt 1 view .LVU1233
+.LVL202:
+.LBB342:
+	.loc 1 126 15 view .LVU1234
+.LBB318:
+	.loc 1 128 5 view .LVU1235
+.L94:
+	.loc 1 128 5 is_stmt 0 view .LVU1236
+.LBE318:
+.LBE342:
+# blake2sp.c:151:         job[i].out = hash[i];
+	.loc 1 151 20 view .LVU1237
+	leaq	176(%rsp), %rax	#, tmp225
+# blake2sp.c:148:         job[i].ctx = &ctx->S[i];
+	.loc 1 148 20 view .LVU1238
+	movq	%r15, 464(%rsp)	# _1, job[5].ctx
+# blake2sp.c:151:         job[i].out = hash[i];
+	.loc 1 151 20 view .LVU1239
+	movq	%rax, 456(%rsp)	# tmp225, job[4].out
+# blake2sp.c:149:         job[i].src = ctx->buf + (i + BSP_LEAVES)*BLAKE2S_BLOCK;
+	.loc 1 149 31 view .LVU1240
+	leaq	1984(%rbx), %rax	#, tmp226
+# blake2sp.c:150:         job[i].len = bsp_slice(ctx->buf_len, i + BSP_LEAVES);
+	.loc 1 150 20 view .LVU1241
+	movq	$0, 448(%rsp)	#, job[4].len
+	.loc 1 151 9 is_stmt 1 view .LVU1242
+	.loc 1 147 34 view .LVU1243
+.LVL203:
+	.loc 1 147 28 view .LVU1244
+	.loc 1 148 9 view .LVU1245
+	.loc 1 149 9 view .LVU1246
+# blake2sp.c:149:         job[i].src = ctx->buf + (i + BSP_LEAVES)*BLAKE2S_BLOCK;
+	.loc 1 149 31 is_stmt 0 view .LVU1247
+	movq	%rax, 472(%rsp)	# tmp226, job[5].src
+	.loc 1 150 9 is_stmt 1 view .LVU1248
+.LVL204:
+.LBB343:
+	.loc 1 126 15 view .LVU1249
+.LBB319:
+	.loc 1 128 5 view .LVU1250
+.L96:
+	.loc 1 128 5 is_stmt 0 view .LVU1251
+.LBE319:
+.LBE343:
+# blake2sp.c:151:         job[i].out = hash[i];
+	.loc 1 151 20 view .LVU1252
+	leaq	208(%rsp), %rax	#, tmp234
+# blake2sp.c:148:         job[i].ctx = &ctx->S[i];
+	.loc 1 148 20 view .LVU1253
+	movq	%r14, 496(%rsp)	# _77, job[6].ctx
+# blake2sp.c:151:         job[i].out = hash[i];
+	.loc 1 151 20 view .LVU1254
+	movq	%rax, 488(%rsp)	# tmp234, job[5].out
+# blake2sp.c:149:         job[i].src = ctx->buf + (i + BSP_LEAVES)*BLAKE2S_BLOCK;
+	.loc 1 149 31 view .LVU1255
+	leaq	2048(%rbx), %rax	#, tmp235
+# blake2sp.c:150:         job[i].len = bsp_slice(ctx->buf_len, i + BSP_LEAVES);
+	.loc 1 150 20 view .LVU1256
+	movq	$0, 480(%rsp)	#, job[5].len
+	.loc 1 151 9 is_stmt 1 view .LVU1257
+	.loc 1 147 34 view .LVU1258
+.LVL205:
+	.loc 1 147 28 view .LVU1259
+	.loc 1 148 9 view .LVU1260
+	.loc 1 149 9 view .LVU1261
+# blake2sp.c:149:         job[i].src = ctx->buf + (i + BSP_LEAVES)*BLAKE2S_BLOCK;
+	.loc 1 149 31 is_stmt 0 view .LVU1262
+	movq	%rax, 504(%rsp)	# tmp235, job[6].src
+	.loc 1 150 9 is_stmt 1 view .LVU1263
+.LVL206:
+.LBB344:
+	.loc 1 126 15 view .LVU1264
+.LBB320:
+	.loc 1 128 5 view .LVU1265
+.L98:
+	.loc 1 128 5 is_stmt 0 view .LVU1266
+.LBE320:
+.LBE344:
+# blake2sp.c:151:         job[i].out = hash[i];
+	.loc 1 151 20 view .LVU1267
+	leaq	240(%rsp), %rax	#, tmp243
+# blake2sp.c:148:         job[i].ctx = &ctx->S[i];
+	.loc 1 148 20 view .LVU1268
+	movq	%r13, 528(%rsp)	# _85, job[7].ctx
+# blake2sp.c:151:         job[i].out = hash[i];
+	.loc 1 151 20 view .LVU1269
+	movq	%rax, 520(%rsp)	# tmp243, job[6].out
+# blake2sp.c:149:         job[i].src = ctx->buf + (i + BSP_LEAVES)*BLAKE2S_BLOCK;
+	.loc 1 149 31 view .LVU1270
+	leaq	2112(%rbx), %rax	#, tmp244
+# blake2sp.c:150:         job[i].len = bsp_slice(ctx->buf_len, i + BSP_LEAVES);
+	.loc 1 150 20 view .LVU1271
+	movq	$0, 512(%rsp)	#, job[6].len
+	.loc 1 151 9 is_stmt 1 view .LVU1272
+	.loc 1 147 34 view .LVU1273
+.LVL207:
+	.loc 1 147 28 view .LVU1274
+	.loc 1 148 9 view .LVU1275
+	.loc 1 149 9 view .LVU1276
+# blake2sp.c:149:         job[i].src = ctx->buf + (i + BSP_LEAVES)*BLAKE2S_BLOCK;
+	.loc 1 149 31 is_stmt 0 view .LVU1277
+	movq	%rax, 536(%rsp)	# tmp244, job[7].src
+	.loc 1 150 9 is_stmt 1 view .LVU1278
+.LVL208:
+.LBB345:
+	.loc 1 126 15 view .LVU1279
+.LBB321:
+	.loc 1 128 5 view .LVU1280
+.L100:
+# blake2sp.c:129:         return 0;
+	.loc 1 129 16 is_stmt 0 view .LVU1281
+	xorl	%edx, %edx	# _70
+	jmp	.L102	#
+.LVL209:
+.L103:
+	.loc 1 129 16 view .LVU1282
+.LBE321:
+.LBE345:
+.LBE348:
+.LBB349:
+.LBB288:
+.LBB260:
+	xorl	%eax, %eax	# _92
+	jmp	.L86	#
+.LBE260:
+.LBE288:
+.LBE349:
+	.cfi_endproc
+.LFE24:
+	.size	blake2sp_final, .-blake2sp_final
+	.p2align 4
+	.globl	blake2sp_parallel
+	.type	blake2sp_parallel, @function
+blake2sp_parallel:
+.LVL210:
+.LFB26:
+	.loc 1 193 1 is_stmt 1 view -0
+	.cfi_startproc
+	.loc 1 194 5 view .LVU1284
+	.loc 1 195 5 view .LVU1285
+	.loc 1 197 5 view .LVU1286
+# blake2sp.c:193: {
+	.loc 1 193 1 is_stmt 0 view .LVU1287
+	pushq	%r15	#
+	.cfi_def_cfa_offset 16
+	.cfi_offset 15, -16
+.LBB355:
+.LBB356:
+.LBB357:
+# blake2sp.c:35:     blake2s_init_words(&ctx->R, P, salt, NULL, NULL, 0);
+	.loc 1 35 5 view .LVU1288
+	xorl	%r9d, %r9d	#
+	xorl	%r8d, %r8d	#
+.LBB358:
+# blake2sp.c:38:     for (unsigned i = 0; i < BSP_LEAVES; i++) {
+	.loc 1 38 19 view .LVU1289
+	xorl	%r15d, %r15d	# i
+.LBE358:
+.LBE357:
+.LBE356:
+.LBE355:
+# blake2sp.c:193: {
+	.loc 1 193 1 view .LVU1290
+	pushq	%r14	#
+	.cfi_def_cfa_offset 24
+	.cfi_offset 14, -24
+	pushq	%r13	#
+	.cfi_def_cfa_offset 32
+	.cfi_offset 13, -32
+	pushq	%r12	#
+	.cfi_def_cfa_offset 40
+	.cfi_offset 12, -40
+	movq	%rdx, %r12	# tmp134, len
+.LBB372:
+.LBB366:
+.LBB360:
+# blake2sp.c:35:     blake2s_init_words(&ctx->R, P, salt, NULL, NULL, 0);
+	.loc 1 35 5 view .LVU1291
+	xorl	%edx, %edx	#
+.LVL211:
+	.loc 1 35 5 view .LVU1292
+.LBE360:
+.LBE366:
+.LBE372:
+# blake2sp.c:193: {
+	.loc 1 193 1 view .LVU1293
+	pushq	%rbp	#
+	.cfi_def_cfa_offset 48
+	.cfi_offset 6, -48
+	movl	%ecx, %ebp	# tmp135, nthreads
+.LBB373:
+.LBB367:
+.LBB361:
+# blake2sp.c:35:     blake2s_init_words(&ctx->R, P, salt, NULL, NULL, 0);
+	.loc 1 35 5 view .LVU1294
+	xorl	%ecx, %ecx	#
+.LVL212:
+	.loc 1 35 5 view .LVU1295
+.LBE361:
+.LBE367:
+.LBE373:
+# blake2sp.c:193: {
+	.loc 1 193 1 view .LVU1296
+	pushq	%rbx	#
+	.cfi_def_cfa_offset 56
+	.cfi_offset 3, -56
+	subq	$2184, %rsp	#,
+	.cfi_def_cfa_offset 2240
+.LVL213:
+.LBB374:
+.LBI355:
+	.loc 1 62 6 is_stmt 1 view .LVU1297
+	.loc 1 64 5 view .LVU1298
+.LBB368:
+.LBI356:
+	.loc 1 23 12 view .LVU1299
+.LBB362:
+	.loc 1 26 5 view .LVU1300
+# blake2sp.c:26:     u32 P[B2S_PARAM_WORDS] = { BSP_PARAM0(dig_len,key_len), 0, 0,
+	.loc 1 26 9 is_stmt 0 view .LVU1301
+	movdqa	.LC8(%rip), %xmm0	#, tmp105
+# blake2sp.c:35:     blake2s_init_words(&ctx->R, P, salt, NULL, NULL, 0);
+	.loc 1 35 5 view .LVU1302
+	leaq	16(%rsp), %rbx	#, tmp130
+.LBE362:
+.LBE368:
+.LBE374:
+# blake2sp.c:193: {
+	.loc 1 193 1 view .LVU1303
+	movq	%rdi, 8(%rsp)	# tmp132, %sfp
+.LBB375:
+.LBB369:
+.LBB363:
+# blake2sp.c:35:     blake2s_init_words(&ctx->R, P, salt, NULL, NULL, 0);
+	.loc 1 35 5 view .LVU1304
+	leaq	48(%rsp), %r14	#, tmp131
+.LVL214:
+	.loc 1 35 5 view .LVU1305
+.LBE363:
+.LBE369:
+.LBE375:
+# blake2sp.c:193: {
+	.loc 1 193 1 view .LVU1306
+	movq	%rsi, (%rsp)	# tmp133, %sfp
+.LBB376:
+.LBB370:
+.LBB364:
+# blake2sp.c:35:     blake2s_init_words(&ctx->R, P, salt, NULL, NULL, 0);
+	.loc 1 35 5 view .LVU1307
+	leaq	1072(%rsp), %rdi	#, tmp108
+.LVL215:
+	.loc 1 35 5 view .LVU1308
+	movq	%rbx, %rsi	# tmp130,
+.LVL216:
+	.loc 1 35 5 view .LVU1309
+	movq	%r14, %r13	# tmp131, ivtmp.281
+# blake2sp.c:26:     u32 P[B2S_PARAM_WORDS] = { BSP_PARAM0(dig_len,key_len), 0, 0,
+	.loc 1 26 9 view .LVU1310
+	movaps	%xmm0, 16(%rsp)	# tmp105, MEM <vector(4) unsigned int> [(unsigned int *)_47]
+	.loc 1 29 5 is_stmt 1 view .LVU1311
+	.loc 1 31 5 view .LVU1312
+	.loc 1 35 5 view .LVU1313
+	call	blake2s_init_words@PLT	#
+.LVL217:
+	.loc 1 36 5 view .LVU1314
+# blake2sp.c:37:     P[3] = B2S_PARAM3(0, 0, BLAKE2S_LEN);
+	.loc 1 37 10 is_stmt 0 view .LVU1315
+	movl	$536870912, 28(%rsp)	#, MEM[(u32[4] *)_47][3]
+# blake2sp.c:36:     ctx->R.last_node = 1;
+	.loc 1 36 22 view .LVU1316
+	movl	$1, 1192(%rsp)	#, ctx.R.last_node
+	.loc 1 37 5 is_stmt 1 view .LVU1317
+	.loc 1 38 5 view .LVU1318
+.LBB359:
+	.loc 1 38 10 view .LVU1319
+.LVL218:
+	.loc 1 38 28 view .LVU1320
+	.p2align 4,,10
+	.p2align 3
+.L109:
+	.loc 1 39 9 view .LVU1321
+# blake2sp.c:39:         P[2] = i;
+	.loc 1 39 14 is_stmt 0 view .LVU1322
+	movl	%r15d, 24(%rsp)	# i, MEM[(u32[4] *)_47][2]
+	.loc 1 40 9 is_stmt 1 view .LVU1323
+	movq	%r13, %rdi	# ivtmp.281,
+	xorl	%r9d, %r9d	#
+	xorl	%r8d, %r8d	#
+	xorl	%ecx, %ecx	#
+	xorl	%edx, %edx	#
+	movq	%rbx, %rsi	# tmp130,
+# blake2sp.c:38:     for (unsigned i = 0; i < BSP_LEAVES; i++) {
+	.loc 1 38 34 is_stmt 0 view .LVU1324
+	addl	$1, %r15d	#, i
+.LVL219:
+# blake2sp.c:40:         blake2s_init_words(&ctx->S[i], P, salt, NULL, key, key_len);
+	.loc 1 40 9 view .LVU1325
+	call	blake2s_init_words@PLT	#
+.LVL220:
+	.loc 1 41 9 is_stmt 1 view .LVU1326
+# blake2sp.c:38:     for (unsigned i = 0; i < BSP_LEAVES; i++) {
+	.loc 1 38 28 is_stmt 0 view .LVU1327
+	subq	$-128, %r13	#, ivtmp.281
+# blake2sp.c:41:         ctx->S[i].digest_len = BLAKE2S_LEN; /* inner length */
+	.loc 1 41 30 view .LVU1328
+	movl	$32, -12(%r13)	#, MEM[(unsigned int *)_41 + 116B]
+	.loc 1 38 34 is_stmt 1 view .LVU1329
+.LVL221:
+	.loc 1 38 28 view .LVU1330
+	cmpl	$8, %r15d	#, i
+	jne	.L109	#,
+.LBE359:
+	.loc 1 43 5 view .LVU1331
+# blake2sp.c:43:     ctx->S[BSP_LEAVES-1].last_node = 1;
+	.loc 1 43 28 is_stmt 0 view .LVU1332
+	movl	$1, 1064(%rsp)	#, ctx.S[7].last_node
+	.loc 1 44 5 is_stmt 1 view .LVU1333
+.LBE364:
+.LBE370:
+.LBE376:
+# blake2sp.c:198:     J.g = nthreads < BSP_LEAVES ? nthreads : BSP_LEAVES;
+	.loc 1 198 35 is_stmt 0 view .LVU1334
+	movl	$8, %eax	#, tmp136
+.LBB377:
+.LBB371:
+.LBB365:
+# blake2sp.c:44:     ctx->buf_len = 0;
+	.loc 1 44 18 view .LVU1335
+	movl	$0, 2160(%rsp)	#, ctx.buf_len
+	.loc 1 45 5 is_stmt 1 view .LVU1336
+.LVL222:
+	.loc 1 45 5 is_stmt 0 view .LVU1337
+.LBE365:
+.LBE371:
+.LBE377:
+	.loc 1 198 5 is_stmt 1 view .LVU1338
+# blake2sp.c:198:     J.g = nthreads < BSP_LEAVES ? nthreads : BSP_LEAVES;
+	.loc 1 198 35 is_stmt 0 view .LVU1339
+	cmpl	%eax, %ebp	# tmp136, nthreads
+	cmovbe	%ebp, %eax	# nthreads,, tmp136
+# blake2sp.c:198:     J.g = nthreads < BSP_LEAVES ? nthreads : BSP_LEAVES;
+	.loc 1 198 9 view .LVU1340
+	movl	%eax, 40(%rsp)	# _1, MEM[(struct bsp_par *)_47].g
+	.loc 1 199 5 is_stmt 1 view .LVU1341
+# blake2sp.c:198:     J.g = nthreads < BSP_LEAVES ? nthreads : BSP_LEAVES;
+	.loc 1 198 35 is_stmt 0 view .LVU1342
+	movl	%eax, %edi	# tmp136, _1
+# blake2sp.c:199:     if (blake2s_kern->lanes > 1 && J.g < BSP_LEAVES)
+	.loc 1 199 33 view .LVU1343
+	movq	blake2s_kern(%rip), %rax	# blake2s_kern, blake2s_kern
+	cmpl	$1, 32(%rax)	#, blake2s_kern.1_2->lanes
+	jbe	.L110	#,
+	cmpl	$7, %ebp	#, nthreads
+	jbe	.L126	#,
+.L110:
+	.loc 1 201 5 is_stmt 1 view .LVU1344
+# blake2sp.c:201:     if (J.g > 1 && len > BSP_HOLD) {
+	.loc 1 201 17 is_stmt 0 view .LVU1345
+	cmpq	$960, %r12	#, len
+	jbe	.L114	#,
+	cmpl	$1, %ebp	#, nthreads
+	ja	.L127	#,
+.L114:
+	.loc 1 209 5 is_stmt 1 view .LVU1346
+	movq	(%rsp), %rsi	# %sfp,
+	movq	%r12, %rdx	# len,
+	movq	%r14, %rdi	# tmp131,
+	call	blake2sp_update	#
+.LVL223:
+	.loc 1 210 5 view .LVU1347
+	movq	8(%rsp), %rsi	# %sfp,
+	movq	%r14, %rdi	# tmp131,
+	call	blake2sp_final	#
+.LVL224:
+# blake2sp.c:211: }
+	.loc 1 211 1 is_stmt 0 view .LVU1348
+	addq	$2184, %rsp	#,
+	.cfi_remember_state
+	.cfi_def_cfa_offset 56
+	popq	%rbx	#
+	.cfi_def_cfa_offset 48
+	popq	%rbp	#
+	.cfi_def_cfa_offset 40
+.LVL225:
+	.loc 1 211 1 view .LVU1349
+	popq	%r12	#
+	.cfi_def_cfa_offset 32
+.LVL226:
+	.loc 1 211 1 view .LVU1350
+	popq	%r13	#
+	.cfi_def_cfa_offset 24
+	popq	%r14	#
+	.cfi_def_cfa_offset 16
+	popq	%r15	#
+	.cfi_def_cfa_offset 8
+	ret	
+.LVL227:
+	.p2align 4,,10
+	.p2align 3
+.L126:
+	.cfi_restore_state
+	.loc 1 200 9 is_stmt 1 view .LVU1351
+# blake2sp.c:200:         J.g = 1;
+	.loc 1 200 13 is_stmt 0 view .LVU1352
+	movl	$1, 40(%rsp)	#, MEM[(struct bsp_par *)_47].g
+	.loc 1 201 5 is_stmt 1 view .LVU1353
+	jmp	.L114	#
+	.p2align 4,,10
+	.p2align 3
+.L127:
+	.loc 1 202 9 view .LVU1354
+# blake2sp.c:203:         J.src = src;
+	.loc 1 203 15 is_stmt 0 view .LVU1355
+	movq	(%rsp), %rax	# %sfp, src
+# blake2sp.c:205:         blake2s_pool_run(J.g, J.g, bsp_par_leaves, &J);
+	.loc 1 205 9 view .LVU1356
+	movq	%rbx, %rcx	# tmp130,
+	movl	%edi, %esi	# _1, _1
+	leaq	bsp_par_leaves(%rip), %rdx	#, tmp125
+# blake2sp.c:202:         J.ctx = &ctx;
+	.loc 1 202 15 view .LVU1357
+	movq	%r14, 16(%rsp)	# tmp131, MEM[(struct bsp_par *)_47].ctx
+	.loc 1 203 9 is_stmt 1 view .LVU1358
+# blake2sp.c:203:         J.src = src;
+	.loc 1 203 15 is_stmt 0 view .LVU1359
+	movq	%rax, 24(%rsp)	# src, MEM[(struct bsp_par *)_47].src
+	.loc 1 204 9 is_stmt 1 view .LVU1360
+# blake2sp.c:204:         J.n = (len - BSP_HOLD - 1) / BSP_STRIDE + 1;
+	.loc 1 204 42 is_stmt 0 view .LVU1361
+	leaq	-961(%r12), %rax	#, tmp120
+# blake2sp.c:204:         J.n = (len - BSP_HOLD - 1) / BSP_STRIDE + 1;
+	.loc 1 204 47 view .LVU1362
+	shrq	$9, %rax	#, tmp121
+# blake2sp.c:204:         J.n = (len - BSP_HOLD - 1) / BSP_STRIDE + 1;
+	.loc 1 204 58 view .LVU1363
+	addq	$1, %rax	#, tmp122
+	movq	%rax, 32(%rsp)	# tmp122, MEM[(struct bsp_par *)_47].n
+	.loc 1 205 9 is_stmt 1 view .LVU1364
+	call	blake2s_pool_run@PLT	#
+.LVL228:
+	.loc 1 206 9 view .LVU1365
+# blake2sp.c:206:         src = J.src + J.n * BSP_STRIDE;
+	.loc 1 206 27 is_stmt 0 view .LVU1366
+	movq	32(%rsp), %rax	# MEM[(struct bsp_par *)_47].n, _11
+# blake2sp.c:206:         src = J.src + J.n * BSP_STRIDE;
+	.loc 1 206 13 view .LVU1367
+	movq	24(%rsp), %rbx	# MEM[(struct bsp_par *)_47].src, src
+# blake2sp.c:206:         src = J.src + J.n * BSP_STRIDE;
+	.loc 1 206 27 view .LVU1368
+	salq	$9, %rax	#, _11
+# blake2sp.c:206:         src = J.src + J.n * BSP_STRIDE;
+	.loc 1 206 13 view .LVU1369
+	addq	%rax, %rbx	# _11, src
+# blake2sp.c:207:         len -= J.n * BSP_STRIDE;
+	.loc 1 207 13 view .LVU1370
+	subq	%rax, %r12	# _11, len
+.LVL229:
+# blake2sp.c:206:         src = J.src + J.n * BSP_STRIDE;
+	.loc 1 206 13 view .LVU1371
+	movq	%rbx, (%rsp)	# src, %sfp
+.LVL230:
+	.loc 1 207 9 is_stmt 1 view .LVU1372
+	.loc 1 207 9 is_stmt 0 view .LVU1373
+	jmp	.L114	#
+	.cfi_endproc
+.LFE26:
+	.size	blake2sp_parallel, .-blake2sp_parallel
+	.p2align 4
+	.globl	blake2sp
+	.type	blake2sp, @function
+blake2sp:
+.LVL231:
+.LFB27:
+	.loc 1 214 1 is_stmt 1 view -0
+	.cfi_startproc
+	.loc 1 215 5 view .LVU1375
+	.loc 1 216 5 view .LVU1376
+# blake2sp.c:214: {
+	.loc 1 214 1 is_stmt 0 view .LVU1377
+	pushq	%r15	#
+	.cfi_def_cfa_offset 16
+	.cfi_offset 15, -16
+.LBB383:
+.LBB384:
+.LBB385:
+# blake2sp.c:35:     blake2s_init_words(&ctx->R, P, salt, NULL, NULL, 0);
+	.loc 1 35 5 view .LVU1378
+	xorl	%r9d, %r9d	#
+.LBE385:
+.LBE384:
+.LBE383:
+# blake2sp.c:214: {
+	.loc 1 214 1 view .LVU1379
+	movq	%rdx, %r15	# tmp99, len
+.LBB402:
+.LBB395:
+.LBB388:
+# blake2sp.c:35:     blake2s_init_words(&ctx->R, P, salt, NULL, NULL, 0);
+	.loc 1 35 5 view .LVU1380
+	xorl	%r8d, %r8d	#
+.LBE388:
+.LBE395:
+.LBE402:
+# blake2sp.c:214: {
+	.loc 1 214 1 view .LVU1381
+	pushq	%r14	#
+	.cfi_def_cfa_offset 24
+	.cfi_offset 14, -24
+.LBB403:
+.LBB396:
+.LBB389:
+# blake2sp.c:35:     blake2s_init_words(&ctx->R, P, salt, NULL, NULL, 0);
+	.loc 1 35 5 view .LVU1382
+	xorl	%ecx, %ecx	#
+.LBE389:
+.LBE396:
+.LBE403:
+# blake2sp.c:214: {
+	.loc 1 214 1 view .LVU1383
+	movq	%rsi, %r14	# tmp98, src
+.LBB404:
+.LBB397:
+.LBB390:
+# blake2sp.c:35:     blake2s_init_words(&ctx->R, P, salt, NULL, NULL, 0);
+	.loc 1 35 5 view .LVU1384
+	xorl	%edx, %edx	#
+.LVL232:
+	.loc 1 35 5 view .LVU1385
+.LBE390:
+.LBE397:
+.LBE404:
+# blake2sp.c:214: {
+	.loc 1 214 1 view .LVU1386
+	pushq	%r13	#
+	.cfi_def_cfa_offset 32
+	.cfi_offset 13, -32
+	pushq	%r12	#
+	.cfi_def_cfa_offset 40
+	.cfi_offset 12, -40
+	pushq	%rbp	#
+	.cfi_def_cfa_offset 48
+	.cfi_offset 6, -48
+	pushq	%rbx	#
+	.cfi_def_cfa_offset 56
+	.cfi_offset 3, -56
+.LBB405:
+.LBB398:
+.LBB391:
+.LBB386:
+# blake2sp.c:38:     for (unsigned i = 0; i < BSP_LEAVES; i++) {
+	.loc 1 38 19 view .LVU1387
+	xorl	%ebx, %ebx	# i
+.LBE386:
+.LBE391:
+.LBE398:
+.LBE405:
+# blake2sp.c:214: {
+	.loc 1 214 1 view .LVU1388
+	subq	$2168, %rsp	#,
+	.cfi_def_cfa_offset 2224
+.LVL233:
+.LBB406:
+.LBI383:
+	.loc 1 62 6 is_stmt 1 view .LVU1389
+	.loc 1 64 5 view .LVU1390
+.LBB399:
+.LBI384:
+	.loc 1 23 12 view .LVU1391
+.LBB392:
+	.loc 1 26 5 view .LVU1392
+# blake2sp.c:26:     u32 P[B2S_PARAM_WORDS] = { BSP_PARAM0(dig_len,key_len), 0, 0,
+	.loc 1 26 9 is_stmt 0 view .LVU1393
+	movdqa	.LC8(%rip), %xmm0	#, tmp88
+# blake2sp.c:35:     blake2s_init_words(&ctx->R, P, salt, NULL, NULL, 0);
+	.loc 1 35 5 view .LVU1394
+	leaq	16(%rsp), %rbp	#, tmp95
+.LBE392:
+.LBE399:
+.LBE406:
+# blake2sp.c:214: {
+	.loc 1 214 1 view .LVU1395
+	movq	%rdi, 8(%rsp)	# tmp97, %sfp
+.LBB407:
+.LBB400:
+.LBB393:
+# blake2sp.c:35:     blake2s_init_words(&ctx->R, P, salt, NULL, NULL, 0);
+	.loc 1 35 5 view .LVU1396
+	leaq	32(%rsp), %r12	#, tmp96
+.LVL234:
+	.loc 1 35 5 view .LVU1397
+	leaq	1056(%rsp), %rdi	#, tmp91
+.LVL235:
+	.loc 1 35 5 view .LVU1398
+	movq	%rbp, %rsi	# tmp95,
+.LVL236:
+# blake2sp.c:26:     u32 P[B2S_PARAM_WORDS] = { BSP_PARAM0(dig_len,key_len), 0, 0,
+	.loc 1 26 9 view .LVU1399
+	movaps	%xmm0, 16(%rsp)	# tmp88, MEM <vector(4) unsigned int> [(unsigned int *)&P]
+	.loc 1 29 5 is_stmt 1 view .LVU1400
+	.loc 1 31 5 view .LVU1401
+	.loc 1 35 5 view .LVU1402
+	movq	%r12, %r13	# tmp96, ivtmp.296
+	call	blake2s_init_words@PLT	#
+.LVL237:
+	.loc 1 36 5 view .LVU1403
+# blake2sp.c:37:     P[3] = B2S_PARAM3(0, 0, BLAKE2S_LEN);
+	.loc 1 37 10 is_stmt 0 view .LVU1404
+	movl	$536870912, 28(%rsp)	#, P[3]
+# blake2sp.c:36:     ctx->R.last_node = 1;
+	.loc 1 36 22 view .LVU1405
+	movl	$1, 1176(%rsp)	#, ctx.R.last_node
+	.loc 1 37 5 is_stmt 1 view .LVU1406
+	.loc 1 38 5 view .LVU1407
+.LBB387:
+	.loc 1 38 10 view .LVU1408
+.LVL238:
+	.loc 1 38 28 view .LVU1409
+	.p2align 4,,10
+	.p2align 3
+.L129:
+	.loc 1 39 9 view .LVU1410
+# blake2sp.c:39:         P[2] = i;
+	.loc 1 39 14 is_stmt 0 view .LVU1411
+	movl	%ebx, 24(%rsp)	# i, P[2]
+	.loc 1 40 9 is_stmt 1 view .LVU1412
+	movq	%r13, %rdi	# ivtmp.296,
+	xorl	%r9d, %r9d	#
+	xorl	%r8d, %r8d	#
+	xorl	%ecx, %ecx	#
+	xorl	%edx, %edx	#
+	movq	%rbp, %rsi	# tmp95,
+# blake2sp.c:38:     for (unsigned i = 0; i < BSP_LEAVES; i++) {
+	.loc 1 38 34 is_stmt 0 view .LVU1413
+	addl	$1, %ebx	#, i
+.LVL239:
+# blake2sp.c:40:         blake2s_init_words(&ctx->S[i], P, salt, NULL, key, key_len);
+	.loc 1 40 9 view .LVU1414
+	call	blake2s_init_words@PLT	#
+.LVL240:
+	.loc 1 41 9 is_stmt 1 view .LVU1415
+# blake2sp.c:38:     for (unsigned i = 0; i < BSP_LEAVES; i++) {
+	.loc 1 38 28 is_stmt 0 view .LVU1416
+	subq	$-128, %r13	#, ivtmp.296
+# blake2sp.c:41:         ctx->S[i].digest_len = BLAKE2S_LEN; /* inner length */
+	.loc 1 41 30 view .LVU1417
+	movl	$32, -12(%r13)	#, MEM[(unsigned int *)_15 + 116B]
+	.loc 1 38 34 is_stmt 1 view .LVU1418
+.LVL241:
+	.loc 1 38 28 view .LVU1419
+	cmpl	$8, %ebx	#, i
+	jne	.L129	#,
+.LBE387:
+	.loc 1 43 5 view .LVU1420
+.LBE393:
+.LBE400:
+.LBE407:
+# blake2sp.c:217:     blake2sp_update(&ctx, src, len);
+	.loc 1 217 5 is_stmt 0 view .LVU1421
+	movq	%r15, %rdx	# len,
+	movq	%r14, %rsi	# src,
+	movq	%r12, %rdi	# tmp96,
+.LBB408:
+.LBB401:
+.LBB394:
+# blake2sp.c:43:     ctx->S[BSP_LEAVES-1].last_node = 1;
+	.loc 1 43 28 view .LVU1422
+	movl	$1, 1048(%rsp)	#, ctx.S[7].last_node
+	.loc 1 44 5 is_stmt 1 view .LVU1423
+# blake2sp.c:44:     ctx->buf_len = 0;
+	.loc 1 44 18 is_stmt 0 view .LVU1424
+	movl	$0, 2144(%rsp)	#, ctx.buf_len
+	.loc 1 45 5 is_stmt 1 view .LVU1425
+.LVL242:
+	.loc 1 45 5 is_stmt 0 view .LVU1426
+.LBE394:
+.LBE401:
+.LBE408:
+	.loc 1 217 5 is_stmt 1 view .LVU1427
+	call	blake2sp_update	#
+.LVL243:
+	.loc 1 218 5 view .LVU1428
+	movq	8(%rsp), %rsi	# %sfp,
+	movq	%r12, %rdi	# tmp96,
+	call	blake2sp_final	#
+.LVL244:
+# blake2sp.c:219: }
+	.loc 1 219 1 is_stmt 0 view .LVU1429
+	addq	$2168, %rsp	#,
+	.cfi_def_cfa_offset 56
+	popq	%rbx	#
+	.cfi_def_cfa_offset 48
+	popq	%rbp	#
+	.cfi_def_cfa_offset 40
+	popq	%r12	#
+	.cfi_def_cfa_offset 32
+	popq	%r13	#
+	.cfi_def_cfa_offset 24
+	popq	%r14	#
+	.cfi_def_cfa_offset 16
+.LVL245:
+	.loc 1 219 1 view .LVU1430
+	popq	%r15	#
+	.cfi_def_cfa_offset 8
+.LVL246:
+	.loc 1 219 1 view .LVU1431
+	ret	
+	.cfi_endproc
+.LFE27:
+	.size	blake2sp, .-blake2sp
+	.section	.rodata.cst16,"aM",@progbits,16
+	.align 16
+.LC0:
+	.quad	32
+	.quad	160
+	.align 16
+.LC1:
+	.quad	288
+	.quad	416
+	.align 16
+.LC2:
+	.long	64
+	.long	64
+	.long	64
+	.long	64
+	.align 16
+.LC3:
+	.long	63
+	.long	63
+	.long	63
+	.long	63
+	.align 16
+.LC4:
+	.long	-2147483648
+	.long	-2147483648
+	.long	-2147483648
+	.long	-2147483648
+	.align 16
+.LC5:
+	.quad	544
+	.quad	672
+	.align 16
+.LC6:
+	.quad	800
+	.quad	928
+	.align 16
+.LC8:
+	.long	34078752
+	.long	0
+	.long	0
+	.long	536936448
+	.text
+.Letext0:
+	.file 3 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stddef.h"
+	.file 4 "/usr/include/x86_64-linux-gnu/bits/types.h"
+	.file 5 "/usr/include/x86_64-linux-gnu/bits/stdint-uintn.h"
+	.file 6 "blake2s.h"
+	.file 7 "blake2sp.h"
+	.file 8 "/usr/include/string.h"
+	.file 9 "<built-in>"
+	.section	.debug_info,"",@progbits
+.Ldebug_info0:
+	.long	0x1512
+	.value	0x5
+	.byte	0x1
+	.byte	0x8
+	.long	.Ldebug_abbrev0
+	.uleb128 0x2f
+	.long	.LASF67
+	.byte	0xc
+	.long	.LASF0
+	.long	.LASF1
+	.long	.LLRL117
+	.quad	0
+	.long	.Ldebug_line0
+	.uleb128 0x18
+	.long	.LASF8
+	.byte	0x3
+	.byte	0xd6
+	.byte	0x1b
+	.long	0x36
+	.uleb128 0xc
+	.byte	0x8
+	.byte	0x7
+	.long	.LASF2
+	.uleb128 0xc
+	.byte	0x8
+	.byte	0x5
+	.long	.LASF3
+	.uleb128 0x30
+	.byte	0x4
+	.byte	0x5
+	.string	"int"
+	.uleb128 0xc
+	.byte	0x1
+	.byte	0x8
+	.long	.LASF4
+	.uleb128 0xc
+	.byte	0x2
+	.byte	0x7
+	.long	.LASF5
+	.uleb128 0xc
+	.byte	0x4
+	.byte	0x7
+	.long	.LASF6
+	.uleb128 0xc
+	.byte	0x1
+	.byte	0x6
+	.long	.LASF7
+	.uleb128 0x18
+	.long	.LASF9
+	.byte	0x4
+	.byte	0x26
+	.byte	0x17
+	.long	0x4b
+	.uleb128 0xc
+	.byte	0x2
+	.byte	0x5
+	.long	.LASF10
+	.uleb128 0x18
+	.long	.LASF11
+	.byte	0x4
+	.byte	0x2a
+	.byte	0x16
+	.long	0x59
+	.uleb128 0x31
+	.byte	0x8
+	.uleb128 0xc
+	.byte	0x1
+	.byte	0x6
+	.long	.LASF12
+	.uleb128 0xf
+	.long	0x88
+	.uleb128 0x18
+	.long	.LASF13
+	.byte	0x5
+	.byte	0x18
+	.byte	0x13
+	.long	0x67
+	.uleb128 0x18
+	.long	.LASF14
+	.byte	0x5
+	.byte	0x1a
+	.byte	0x14
+	.long	0x7a
+	.uleb128 0x32
+	.long	.LASF18
+	.byte	0x80
+	.byte	0x10
+	.byte	0x6
+	.byte	0xf7
+	.byte	0x8
+	.long	0x110
+	.uleb128 0x9
+	.string	"H"
+	.byte	0x6
+	.byte	0xf8
+	.byte	0xe
+	.long	0x115
+	.byte	0
+	.uleb128 0x9
+	.string	"buf"
+	.byte	0x6
+	.byte	0xf9
+	.byte	0x13
+	.long	0x125
+	.byte	0x20
+	.uleb128 0x9
+	.string	"t"
+	.byte	0x6
+	.byte	0xfa
+	.byte	0xe
+	.long	0x135
+	.byte	0x60
+	.uleb128 0x9
+	.string	"f"
+	.byte	0x6
+	.byte	0xfb
+	.byte	0xe
+	.long	0x135
+	.byte	0x68
+	.uleb128 0xe
+	.long	.LASF15
+	.byte	0x6
+	.byte	0xfc
+	.byte	0xe
+	.long	0x59
+	.byte	0x70
+	.uleb128 0xe
+	.long	.LASF16
+	.byte	0x6
+	.byte	0xfd
+	.byte	0xe
+	.long	0x59
+	.byte	0x74
+	.uleb128 0xe
+	.long	.LASF17
+	.byte	0x6
+	.byte	0xfe
+	.byte	0xe
+	.long	0x59
+	.byte	0x78
+	.byte	0
+	.uleb128 0xf
+	.long	0xac
+	.uleb128 0xa
+	.long	0xa0
+	.long	0x125
+	.uleb128 0x7
+	.long	0x36
+	.byte	0x7
+	.byte	0
+	.uleb128 0xa
+	.long	0x4b
+	.long	0x135
+	.uleb128 0x7
+	.long	0x36
+	.byte	0x3f
+	.byte	0
+	.uleb128 0xa
+	.long	0xa0
+	.long	0x145
+	.uleb128 0x7
+	.long	0x36
+	.byte	0x1
+	.byte	0
+	.uleb128 0x4
+	.long	0xac
+	.uleb128 0x4
+	.long	0x14f
+	.uleb128 0x33
+	.uleb128 0x4
+	.long	0x4b
+	.uleb128 0x26
+	.long	.LASF19
+	.value	0x850
+	.byte	0x10
+	.byte	0x7
+	.byte	0x33
+	.long	0x199
+	.uleb128 0x34
+	.string	"S"
+	.byte	0x7
+	.byte	0x34
+	.byte	0x18
+	.long	0x199
+	.byte	0x10
+	.byte	0
+	.uleb128 0x35
+	.string	"R"
+	.byte	0x7
+	.byte	0x35
+	.byte	0x18
+	.long	0xac
+	.byte	0x10
+	.value	0x400
+	.uleb128 0x20
+	.string	"buf"
+	.byte	0x7
+	.byte	0x36
+	.byte	0x13
+	.long	0x1aa
+	.value	0x480
+	.uleb128 0x36
+	.long	.LASF15
+	.byte	0x7
+	.byte	0x37
+	.byte	0xe
+	.long	0x59
+	.value	0x840
+	.byte	0
+	.uleb128 0x37
+	.long	0xac
+	.byte	0x10
+	.long	0x1aa
+	.uleb128 0x7
+	.long	0x36
+	.byte	0x7
+	.byte	0
+	.uleb128 0xa
+	.long	0x4b
+	.long	0x1bb
+	.uleb128 0x38
+	.long	0x36
+	.value	0x3bf
+	.byte	0
+	.uleb128 0xc
+	.byte	0x8
+	.byte	0x7
+	.long	.LASF20
+	.uleb128 0xc
+	.byte	0x8
+	.byte	0x5
+	.long	.LASF21
+	.uleb128 0x27
+	.string	"u8"
+	.byte	0x7
+	.byte	0x11
+	.long	0x94
+	.uleb128 0xf
+	.long	0x1c9
+	.uleb128 0x27
+	.string	"u32"
+	.byte	0x8
+	.byte	0x12
+	.long	0xa0
+	.uleb128 0xf
+	.long	0x1d8
+	.uleb128 0xa
+	.long	0x1e3
+	.long	0x1f8
+	.uleb128 0x7
+	.long	0x36
+	.byte	0x7
+	.byte	0
+	.uleb128 0xf
+	.long	0x1e8
+	.uleb128 0x28
+	.long	.LASF22
+	.byte	0xa
+	.byte	0x12
+	.long	0x1f8
+	.byte	0x20
+	.byte	0x67
+	.byte	0xe6
+	.byte	0x9
+	.byte	0x6a
+	.byte	0x85
+	.byte	0xae
+	.byte	0x67
+	.byte	0xbb
+	.byte	0x72
+	.byte	0xf3
+	.byte	0x6e
+	.byte	0x3c
+	.byte	0x3a
+	.byte	0xf5
+	.byte	0x4f
+	.byte	0xa5
+	.byte	0x7f
+	.byte	0x52
+	.byte	0xe
+	.byte	0x51
+	.byte	0x8c
+	.byte	0x68
+	.byte	0x5
+	.byte	0x9b
+	.byte	0xab
+	.byte	0xd9
+	.byte	0x83
+	.byte	0x1f
+	.byte	0x19
+	.byte	0xcd
+	.byte	0xe0
+	.byte	0x5b
+	.uleb128 0xa
+	.long	0x1d3
+	.long	0x23f
+	.uleb128 0x7
+	.long	0x36
+	.byte	0x9
+	.uleb128 0x7
+	.long	0x36
+	.byte	0xf
+	.byte	0
+	.uleb128 0xf
+	.long	0x229
+	.uleb128 0x28
+	.long	.LASF23
+	.byte	0xf
+	.byte	0x11
+	.long	0x23f
+	.byte	0xa0
+	.byte	0
+	.byte	0x1
+	.byte	0x2
+	.byte	0x3
+	.byte	0x4
+	.byte	0x5
+	.byte	0x6
+	.byte	0x7
+	.byte	0x8
+	.byte	0x9
+	.byte	0xa
+	.byte	0xb
+	.byte	0xc
+	.byte	0xd
+	.byte	0xe
+	.byte	0xf
+	.byte	0xe
+	.byte	0xa
+	.byte	0x4
+	.byte	0x8
+	.byte	0x9
+	.byte	0xf
+	.byte	0xd
+	.byte	0x6
+	.byte	0x1
+	.byte	0xc
+	.byte	0
+	.byte	0x2
+	.byte	0xb
+	.byte	0x7
+	.byte	0x5
+	.byte	0x3
+	.byte	0xb
+	.byte	0x8
+	.byte	0xc
+	.byte	0
+	.byte	0x5
+	.byte	0x2
+	.byte	0xf
+	.byte	0xd
+	.byte	0xa
+	.byte	0xe
+	.byte	0x3
+	.byte	0x6
+	.byte	0x7
+	.byte	0x1
+	.byte	0x9
+	.byte	0x4
+	.byte	0x7
+	.byte	0x9
+	.byte	0x3
+	.byte	0x1
+	.byte	0xd
+	.byte	0xc
+	.byte	0xb
+	.byte	0xe
+	.byte	0x2
+	.byte	0x6
+	.byte	0x5
+	.byte	0xa
+	.byte	0x4
+	.byte	0
+	.byte	0xf
+	.byte	0x8
+	.byte	0x9
+	.byte	0
+	.byte	0x5
+	.byte	0x7
+	.byte	0x2
+	.byte	0x4
+	.byte	0xa
+	.byte	0xf
+	.byte	0xe
+	.byte	0x1
+	.byte	0xb
+	.byte	0xc
+	.byte	0x6
+	.byte	0x8
+	.byte	0x3
+	.byte	0xd
+	.byte	0x2
+	.byte	0xc
+	.byte	0x6
+	.byte	0xa
+	.byte	0
+	.byte	0xb
+	.byte	0x8
+	.byte	0x3
+	.byte	0x4
+	.byte	0xd
+	.byte	0x7
+	.byte	0x5
+	.byte	0xf
+	.byte	0xe
+	.byte	0x1
+	.byte	0x9
+	.byte	0xc
+	.byte	0x5
+	.byte	0x1
+	.byte	0xf
+	.byte	0xe
+	.byte	0xd
+	.byte	0x4
+	.byte	0xa
+	.byte	0
+	.byte	0x7
+	.byte	0x6
+	.byte	0x3
+	.byte	0x9
+	.byte	0x2
+	.byte	0x8
+	.byte	0xb
+	.byte	0xd
+	.byte	0xb
+	.byte	0x7
+	.byte	0xe
+	.byte	0xc
+	.byte	0x1
+	.byte	0x3
+	.byte	0x9
+	.byte	0x5
+	.byte	0
+	.byte	0xf
+	.byte	0x4
+	.byte	0x8
+	.byte	0x6
+	.byte	0x2
+	.byte	0xa
+	.byte	0x6
+	.byte	0xf
+	.byte	0xe
+	.byte	0x9
+	.byte	0xb
+	.byte	0x3
+	.byte	0
+	.byte	0x8
+	.byte	0xc
+	.byte	0x2
+	.byte	0xd
+	.byte	0x7
+	.byte	0x1
+	.byte	0x4
+	.byte	0xa
+	.byte	0x5
+	.byte	0xa
+	.byte	0x2
+	.byte	0x8
+	.byte	0x4
+	.byte	0x7
+	.byte	0x6
+	.byte	0x1
+	.byte	0x5
+	.byte	0xf
+	.byte	0xb
+	.byte	0x9
+	.byte	0xe
+	.byte	0x3
+	.byte	0xc
+	.byte	0xd
+	.byte	0
+	.uleb128 0x26
+	.long	.LASF24
+	.value	0x300
+	.byte	0x40
+	.byte	0x2
+	.byte	0x25
+	.long	0x322
+	.uleb128 0x9
+	.string	"H"
+	.byte	0x2
+	.byte	0x26
+	.byte	0x9
+	.long	0x327
+	.byte	0
+	.uleb128 0x20
+	.string	"t"
+	.byte	0x2
+	.byte	0x27
+	.byte	0x9
+	.long	0x33d
+	.value	0x200
+	.uleb128 0x20
+	.string	"f"
+	.byte	0x2
+	.byte	0x28
+	.byte	0x9
+	.long	0x33d
+	.value	0x280
+	.byte	0
+	.uleb128 0xf
+	.long	0x2f0
+	.uleb128 0xa
+	.long	0x1d8
+	.long	0x33d
+	.uleb128 0x7
+	.long	0x36
+	.byte	0x7
+	.uleb128 0x7
+	.long	0x36
+	.byte	0xf
+	.byte	0
+	.uleb128 0xa
+	.long	0x1d8
+	.long	0x353
+	.uleb128 0x7
+	.long	0x36
+	.byte	0x1
+	.uleb128 0x7
+	.long	0x36
+	.byte	0xf
+	.byte	0
+	.uleb128 0x21
+	.long	.LASF31
+	.byte	0x30
+	.byte	0x2
+	.byte	0x31
+	.long	0x3ae
+	.uleb128 0xe
+	.long	.LASF25
+	.byte	0x2
+	.byte	0x32
+	.byte	0x11
+	.long	0x3b3
+	.byte	0
+	.uleb128 0xe
+	.long	.LASF26
+	.byte	0x2
+	.byte	0x33
+	.byte	0xb
+	.long	0x3bd
+	.byte	0x8
+	.uleb128 0xe
+	.long	.LASF27
+	.byte	0x2
+	.byte	0x34
+	.byte	0xc
+	.long	0x3d2
+	.byte	0x10
+	.uleb128 0xe
+	.long	.LASF28
+	.byte	0x2
+	.byte	0x35
+	.byte	0xc
+	.long	0x3ec
+	.byte	0x18
+	.uleb128 0xe
+	.long	.LASF29
+	.byte	0x2
+	.byte	0x37
+	.byte	0xe
+	.long	0x59
+	.byte	0x20
+	.uleb128 0xe
+	.long	.LASF30
+	.byte	0x2
+	.byte	0x38
+	.byte	0xc
+	.long	0x410
+	.byte	0x28
+	.byte	0
+	.uleb128 0xf
+	.long	0x353
+	.uleb128 0x4
+	.long	0x8f
+	.uleb128 0x39
+	.long	0x44
+	.uleb128 0x4
+	.long	0x3b8
+	.uleb128 0x1d
+	.long	0x3d2
+	.uleb128 0x3
+	.long	0x145
+	.uleb128 0x3
+	.long	0x14a
+	.byte	0
+	.uleb128 0x4
+	.long	0x3c2
+	.uleb128 0x1d
+	.long	0x3ec
+	.uleb128 0x3
+	.long	0x145
+	.uleb128 0x3
+	.long	0x14a
+	.uleb128 0x3
+	.long	0x2a
+	.byte	0
+	.uleb128 0x4
+	.long	0x3d7
+	.uleb128 0x1d
+	.long	0x406
+	.uleb128 0x3
+	.long	0x406
+	.uleb128 0x3
+	.long	0x40b
+	.uleb128 0x3
+	.long	0x59
+	.byte	0
+	.uleb128 0x4
+	.long	0x2f0
+	.uleb128 0x4
+	.long	0x14a
+	.uleb128 0x4
+	.long	0x3f1
+	.uleb128 0x3a
+	.long	.LASF45
+	.byte	0x2
+	.byte	0x3c
+	.byte	0x25
+	.long	0x421
+	.uleb128 0x4
+	.long	0x3ae
+	.uleb128 0x21
+	.long	.LASF32
+	.byte	0x20
+	.byte	0x2
+	.byte	0x80
+	.long	0x467
+	.uleb128 0x9
+	.string	"ctx"
+	.byte	0x2
+	.byte	0x81
+	.byte	0x19
+	.long	0x145
+	.byte	0
+	.uleb128 0x9
+	.string	"src"
+	.byte	0x2
+	.byte	0x82
+	.byte	0xf
+	.long	0x467
+	.byte	0x8
+	.uleb128 0x9
+	.string	"len"
+	.byte	0x2
+	.byte	0x83
+	.byte	0xc
+	.long	0x2a
+	.byte	0x10
+	.uleb128 0x9
+	.string	"out"
+	.byte	0x2
+	.byte	0x84
+	.byte	0x14
+	.long	0x150
+	.byte	0x18
+	.byte	0
+	.uleb128 0x4
+	.long	0x1d3
+	.uleb128 0x21
+	.long	.LASF33
+	.byte	0x20
+	.byte	0x1
+	.byte	0xae
+	.long	0x4a9
+	.uleb128 0x9
+	.string	"ctx"
+	.byte	0x1
+	.byte	0xaf
+	.byte	0x1a
+	.long	0x4a9
+	.byte	0
+	.uleb128 0x9
+	.string	"src"
+	.byte	0x1
+	.byte	0xb0
+	.byte	0xf
+	.long	0x467
+	.byte	0x8
+	.uleb128 0x9
+	.string	"n"
+	.byte	0x1
+	.byte	0xb1
+	.byte	0xc
+	.long	0x2a
+	.byte	0x10
+	.uleb128 0x9
+	.string	"g"
+	.byte	0x1
+	.byte	0xb2
+	.byte	0xe
+	.long	0x59
+	.byte	0x18
+	.byte	0
+	.uleb128 0x4
+	.long	0x155
+	.uleb128 0x19
+	.long	.LASF34
+	.byte	0x2
+	.byte	0xb3
+	.long	0x4ce
+	.uleb128 0x3
+	.long	0x59
+	.uleb128 0x3
+	.long	0x2a
+	.uleb128 0x3
+	.long	0x4ce
+	.uleb128 0x3
+	.long	0x86
+	.byte	0
+	.uleb128 0x4
+	.long	0x4d3
+	.uleb128 0x1d
+	.long	0x4e3
+	.uleb128 0x3
+	.long	0x86
+	.uleb128 0x3
+	.long	0x2a
+	.byte	0
+	.uleb128 0x19
+	.long	.LASF35
+	.byte	0x6
+	.byte	0x47
+	.long	0x4f9
+	.uleb128 0x3
+	.long	0x145
+	.uleb128 0x3
+	.long	0x150
+	.byte	0
+	.uleb128 0x19
+	.long	.LASF36
+	.byte	0x6
+	.byte	0x46
+	.long	0x514
+	.uleb128 0x3
+	.long	0x145
+	.uleb128 0x3
+	.long	0x14a
+	.uleb128 0x3
+	.long	0x2a
+	.byte	0
+	.uleb128 0x19
+	.long	.LASF37
+	.byte	0x2
+	.byte	0x87
+	.long	0x52a
+	.uleb128 0x3
+	.long	0x52a
+	.uleb128 0x3
+	.long	0x2a
+	.byte	0
+	.uleb128 0x4
+	.long	0x426
+	.uleb128 0x22
+	.long	.LASF38
+	.byte	0x3d
+	.long	0x86
+	.long	0x54d
+	.uleb128 0x3
+	.long	0x86
+	.uleb128 0x3
+	.long	0x44
+	.uleb128 0x3
+	.long	0x2a
+	.byte	0
+	.uleb128 0x22
+	.long	.LASF39
+	.byte	0x2f
+	.long	0x86
+	.long	0x56b
+	.uleb128 0x3
+	.long	0x86
+	.uleb128 0x3
+	.long	0x14a
+	.uleb128 0x3
+	.long	0x2a
+	.byte	0
+	.uleb128 0x22
+	.long	.LASF40
+	.byte	0x2b
+	.long	0x86
+	.long	0x589
+	.uleb128 0x3
+	.long	0x86
+	.uleb128 0x3
+	.long	0x14a
+	.uleb128 0x3
+	.long	0x2a
+	.byte	0
+	.uleb128 0x19
+	.long	.LASF41
+	.byte	0x2
+	.byte	0x77
+	.long	0x5b3
+	.uleb128 0x3
+	.long	0x145
+	.uleb128 0x3
+	.long	0x5b3
+	.uleb128 0x3
+	.long	0x14a
+	.uleb128 0x3
+	.long	0x14a
+	.uleb128 0x3
+	.long	0x14a
+	.uleb128 0x3
+	.long	0x59
+	.byte	0
+	.uleb128 0x4
+	.long	0x1e3
+	.uleb128 0x1e
+	.long	.LASF42
+	.byte	0xd5
+	.quad	.LFB27
+	.quad	.LFE27-.LFB27
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0x766
+	.uleb128 0x5
+	.string	"out"
+	.byte	0xd5
+	.byte	0x1e
+	.long	0x150
+	.long	.LLST105
+	.long	.LVUS105
+	.uleb128 0x5
+	.string	"src"
+	.byte	0xd5
+	.byte	0x2f
+	.long	0x14a
+	.long	.LLST106
+	.long	.LVUS106
+	.uleb128 0x5
+	.string	"len"
+	.byte	0xd5
+	.byte	0x3b
+	.long	0x2a
+	.long	.LLST107
+	.long	.LVUS107
+	.uleb128 0x14
+	.string	"ctx"
+	.byte	0xd7
+	.byte	0x19
+	.long	0x155
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -2192
+	.uleb128 0x23
+	.long	0xfcf
+	.quad	.LBI383
+	.value	.LVU1389
+	.long	.LLRL108
+	.byte	0xd8
+	.byte	0x5
+	.long	0x725
+	.uleb128 0x2
+	.long	0xfdc
+	.long	.LLST109
+	.long	.LVUS109
+	.uleb128 0xb
+	.long	0x1293
+	.quad	.LBI384
+	.value	.LVU1391
+	.long	.LLRL108
+	.byte	0x40
+	.byte	0x5
+	.uleb128 0x2
+	.long	0x12d2
+	.long	.LLST110
+	.long	.LVUS110
+	.uleb128 0x2
+	.long	0x12c6
+	.long	.LLST111
+	.long	.LVUS111
+	.uleb128 0x2
+	.long	0x12ba
+	.long	.LLST111
+	.long	.LVUS111
+	.uleb128 0x2
+	.long	0x12ae
+	.long	.LLST111
+	.long	.LVUS111
+	.uleb128 0x2
+	.long	0x12a2
+	.long	.LLST114
+	.long	.LVUS114
+	.uleb128 0x10
+	.long	.LLRL108
+	.uleb128 0x1a
+	.long	0x12de
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -2208
+	.uleb128 0x1f
+	.long	0x12e8
+	.long	.LLRL115
+	.long	0x6ef
+	.uleb128 0x12
+	.long	0x12e9
+	.long	.LLST116
+	.long	.LVUS116
+	.uleb128 0x8
+	.quad	.LVL240
+	.long	0x589
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x7d
+	.sleb128 0
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x2
+	.byte	0x76
+	.sleb128 0
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x51
+	.uleb128 0x1
+	.byte	0x30
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x52
+	.uleb128 0x1
+	.byte	0x30
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x58
+	.uleb128 0x1
+	.byte	0x30
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x59
+	.uleb128 0x1
+	.byte	0x30
+	.byte	0
+	.byte	0
+	.uleb128 0x8
+	.quad	.LVL237
+	.long	0x589
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -1168
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x2
+	.byte	0x76
+	.sleb128 0
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x51
+	.uleb128 0x2
+	.byte	0x73
+	.sleb128 0
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x52
+	.uleb128 0x2
+	.byte	0x73
+	.sleb128 0
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x58
+	.uleb128 0x2
+	.byte	0x73
+	.sleb128 0
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x59
+	.uleb128 0x2
+	.byte	0x73
+	.sleb128 0
+	.byte	0
+	.byte	0
+	.byte	0
+	.byte	0
+	.uleb128 0x11
+	.quad	.LVL243
+	.long	0xc37
+	.long	0x749
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x7c
+	.sleb128 0
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x2
+	.byte	0x7e
+	.sleb128 0
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x51
+	.uleb128 0x2
+	.byte	0x7f
+	.sleb128 0
+	.byte	0
+	.uleb128 0x8
+	.quad	.LVL244
+	.long	0xa7c
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x7c
+	.sleb128 0
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x4
+	.byte	0x91
+	.sleb128 -2216
+	.byte	0x6
+	.byte	0
+	.byte	0
+	.uleb128 0x1e
+	.long	.LASF43
+	.byte	0xbf
+	.quad	.LFB26
+	.quad	.LFE26-.LFB26
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0x98d
+	.uleb128 0x5
+	.string	"out"
+	.byte	0xbf
+	.byte	0x27
+	.long	0x150
+	.long	.LLST92
+	.long	.LVUS92
+	.uleb128 0x5
+	.string	"src"
+	.byte	0xbf
+	.byte	0x38
+	.long	0x14a
+	.long	.LLST93
+	.long	.LVUS93
+	.uleb128 0x5
+	.string	"len"
+	.byte	0xbf
+	.byte	0x44
+	.long	0x2a
+	.long	.LLST94
+	.long	.LVUS94
+	.uleb128 0x15
+	.long	.LASF44
+	.byte	0xc0
+	.byte	0x21
+	.long	0x59
+	.long	.LLST95
+	.long	.LVUS95
+	.uleb128 0x14
+	.string	"ctx"
+	.byte	0xc2
+	.byte	0x19
+	.long	0x155
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -2192
+	.uleb128 0x14
+	.string	"J"
+	.byte	0xc3
+	.byte	0x14
+	.long	0x46c
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -2224
+	.uleb128 0x23
+	.long	0xfcf
+	.quad	.LBI355
+	.value	.LVU1297
+	.long	.LLRL96
+	.byte	0xc5
+	.byte	0x5
+	.long	0x8f3
+	.uleb128 0x2
+	.long	0xfdc
+	.long	.LLST97
+	.long	.LVUS97
+	.uleb128 0xb
+	.long	0x1293
+	.quad	.LBI356
+	.value	.LVU1299
+	.long	.LLRL96
+	.byte	0x40
+	.byte	0x5
+	.uleb128 0x2
+	.long	0x12d2
+	.long	.LLST98
+	.long	.LVUS98
+	.uleb128 0x2
+	.long	0x12c6
+	.long	.LLST99
+	.long	.LVUS99
+	.uleb128 0x2
+	.long	0x12ba
+	.long	.LLST99
+	.long	.LVUS99
+	.uleb128 0x2
+	.long	0x12ae
+	.long	.LLST99
+	.long	.LVUS99
+	.uleb128 0x2
+	.long	0x12a2
+	.long	.LLST102
+	.long	.LVUS102
+	.uleb128 0x10
+	.long	.LLRL96
+	.uleb128 0x1a
+	.long	0x12de
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -2224
+	.uleb128 0x1f
+	.long	0x12e8
+	.long	.LLRL103
+	.long	0x8bd
+	.uleb128 0x12
+	.long	0x12e9
+	.long	.LLST104
+	.long	.LVUS104
+	.uleb128 0x8
+	.quad	.LVL220
+	.long	0x589
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x7d
+	.sleb128 0
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x2
+	.byte	0x73
+	.sleb128 0
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x51
+	.uleb128 0x1
+	.byte	0x30
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x52
+	.uleb128 0x1
+	.byte	0x30
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x58
+	.uleb128 0x1
+	.byte	0x30
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x59
+	.uleb128 0x1
+	.byte	0x30
+	.byte	0
+	.byte	0
+	.uleb128 0x8
+	.quad	.LVL217
+	.long	0x589
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -1168
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x2
+	.byte	0x73
+	.sleb128 0
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x51
+	.uleb128 0x2
+	.byte	0x7f
+	.sleb128 0
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x52
+	.uleb128 0x2
+	.byte	0x7f
+	.sleb128 0
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x58
+	.uleb128 0x2
+	.byte	0x7f
+	.sleb128 0
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x59
+	.uleb128 0x2
+	.byte	0x7f
+	.sleb128 0
+	.byte	0
+	.byte	0
+	.byte	0
+	.byte	0
+	.uleb128 0x11
+	.quad	.LVL223
+	.long	0xc37
+	.long	0x919
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x7e
+	.sleb128 0
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x4
+	.byte	0x91
+	.sleb128 -2240
+	.byte	0x6
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x51
+	.uleb128 0x2
+	.byte	0x7c
+	.sleb128 0
+	.byte	0
+	.uleb128 0x11
+	.quad	.LVL224
+	.long	0xa7c
+	.long	0x939
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x7e
+	.sleb128 0
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x4
+	.byte	0x91
+	.sleb128 -2232
+	.byte	0x6
+	.byte	0
+	.uleb128 0x8
+	.quad	.LVL228
+	.long	0x4ae
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x12
+	.byte	0x76
+	.sleb128 0
+	.byte	0x38
+	.byte	0x76
+	.sleb128 0
+	.byte	0xc
+	.long	0xffffffff
+	.byte	0x1a
+	.byte	0x38
+	.byte	0x2c
+	.byte	0x28
+	.value	0x1
+	.byte	0x16
+	.byte	0x13
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x18
+	.byte	0x76
+	.sleb128 0
+	.byte	0x38
+	.byte	0x76
+	.sleb128 0
+	.byte	0xc
+	.long	0xffffffff
+	.byte	0x1a
+	.byte	0x38
+	.byte	0x2c
+	.byte	0x28
+	.value	0x1
+	.byte	0x16
+	.byte	0x13
+	.byte	0xc
+	.long	0xffffffff
+	.byte	0x1a
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x51
+	.uleb128 0x9
+	.byte	0x3
+	.quad	bsp_par_leaves
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x52
+	.uleb128 0x2
+	.byte	0x73
+	.sleb128 0
+	.byte	0
+	.byte	0
+	.uleb128 0x29
+	.long	.LASF50
+	.byte	0xb5
+	.quad	.LFB25
+	.quad	.LFE25-.LFB25
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0xa77
+	.uleb128 0x5
+	.string	"arg"
+	.byte	0xb5
+	.byte	0x22
+	.long	0x86
+	.long	.LLST28
+	.long	.LVUS28
+	.uleb128 0x5
+	.string	"k"
+	.byte	0xb5
+	.byte	0x2e
+	.long	0x2a
+	.long	.LLST29
+	.long	.LVUS29
+	.uleb128 0xd
+	.string	"J"
+	.byte	0xb7
+	.byte	0x15
+	.long	0xa77
+	.long	.LLST30
+	.long	.LVUS30
+	.uleb128 0x10
+	.long	.LLRL31
+	.uleb128 0xd
+	.string	"i"
+	.byte	0xb8
+	.byte	0x11
+	.long	0x2a
+	.long	.LLST32
+	.long	.LVUS32
+	.uleb128 0x10
+	.long	.LLRL33
+	.uleb128 0xd
+	.string	"p"
+	.byte	0xb9
+	.byte	0x13
+	.long	0x467
+	.long	.LLST34
+	.long	.LVUS34
+	.uleb128 0x10
+	.long	.LLRL35
+	.uleb128 0xd
+	.string	"s"
+	.byte	0xba
+	.byte	0x15
+	.long	0x2a
+	.long	.LLST36
+	.long	.LVUS36
+	.uleb128 0xb
+	.long	0x13d3
+	.quad	.LBI172
+	.value	.LVU479
+	.long	.LLRL37
+	.byte	0xbb
+	.byte	0xd
+	.uleb128 0x2
+	.long	0x13f3
+	.long	.LLST38
+	.long	.LVUS38
+	.uleb128 0x2
+	.long	0x13e9
+	.long	.LLST39
+	.long	.LVUS39
+	.uleb128 0x2
+	.long	0x13dd
+	.long	.LLST40
+	.long	.LVUS40
+	.uleb128 0x24
+	.quad	.LVL47
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x3
+	.byte	0x73
+	.sleb128 -512
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x51
+	.uleb128 0x1
+	.byte	0x31
+	.byte	0
+	.byte	0
+	.byte	0
+	.byte	0
+	.byte	0
+	.byte	0
+	.uleb128 0x4
+	.long	0x46c
+	.uleb128 0x1e
+	.long	.LASF46
+	.byte	0x86
+	.quad	.LFB24
+	.quad	.LFE24-.LFB24
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0xbeb
+	.uleb128 0x5
+	.string	"ctx"
+	.byte	0x86
+	.byte	0x2a
+	.long	0x4a9
+	.long	.LLST80
+	.long	.LVUS80
+	.uleb128 0x5
+	.string	"out"
+	.byte	0x86
+	.byte	0x3e
+	.long	0x150
+	.long	.LLST81
+	.long	.LVUS81
+	.uleb128 0x3b
+	.long	.LASF47
+	.byte	0x1
+	.byte	0x88
+	.byte	0x8
+	.long	0xbeb
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -576
+	.uleb128 0x14
+	.string	"job"
+	.byte	0x89
+	.byte	0x18
+	.long	0xc01
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -320
+	.uleb128 0x16
+	.long	.LLRL82
+	.long	0xb28
+	.uleb128 0xd
+	.string	"i"
+	.byte	0x8c
+	.byte	0x13
+	.long	0x59
+	.long	.LLST83
+	.long	.LVUS83
+	.uleb128 0xb
+	.long	0xc11
+	.quad	.LBI231
+	.value	.LVU752
+	.long	.LLRL84
+	.byte	0x8f
+	.byte	0x16
+	.uleb128 0x2
+	.long	0xc2c
+	.long	.LLST85
+	.long	.LVUS85
+	.uleb128 0x2
+	.long	0xc20
+	.long	.LLST86
+	.long	.LVUS86
+	.byte	0
+	.byte	0
+	.uleb128 0x16
+	.long	.LLRL87
+	.long	0xb73
+	.uleb128 0xd
+	.string	"i"
+	.byte	0x93
+	.byte	0x13
+	.long	0x59
+	.long	.LLST88
+	.long	.LVUS88
+	.uleb128 0xb
+	.long	0xc11
+	.quad	.LBI296
+	.value	.LVU923
+	.long	.LLRL89
+	.byte	0x96
+	.byte	0x16
+	.uleb128 0x2
+	.long	0xc2c
+	.long	.LLST90
+	.long	.LVUS90
+	.uleb128 0x2
+	.long	0xc20
+	.long	.LLST91
+	.long	.LVUS91
+	.byte	0
+	.byte	0
+	.uleb128 0x11
+	.quad	.LVL148
+	.long	0x514
+	.long	0xb92
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x4
+	.byte	0x91
+	.sleb128 -608
+	.byte	0x6
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x1
+	.byte	0x38
+	.byte	0
+	.uleb128 0x11
+	.quad	.LVL174
+	.long	0x514
+	.long	0xba9
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x1
+	.byte	0x38
+	.byte	0
+	.uleb128 0x11
+	.quad	.LVL175
+	.long	0x4f9
+	.long	0xbce
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x7c
+	.sleb128 0
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x2
+	.byte	0x76
+	.sleb128 0
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x51
+	.uleb128 0x3
+	.byte	0xa
+	.value	0x100
+	.byte	0
+	.uleb128 0x8
+	.quad	.LVL176
+	.long	0x4e3
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x7c
+	.sleb128 0
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x4
+	.byte	0x91
+	.sleb128 -616
+	.byte	0x6
+	.byte	0
+	.byte	0
+	.uleb128 0xa
+	.long	0x1c9
+	.long	0xc01
+	.uleb128 0x7
+	.long	0x36
+	.byte	0x7
+	.uleb128 0x7
+	.long	0x36
+	.byte	0x1f
+	.byte	0
+	.uleb128 0xa
+	.long	0x426
+	.long	0xc11
+	.uleb128 0x7
+	.long	0x36
+	.byte	0x7
+	.byte	0
+	.uleb128 0x2a
+	.long	.LASF58
+	.byte	0x7e
+	.byte	0xf
+	.long	0x2a
+	.long	0xc37
+	.uleb128 0x6
+	.string	"len"
+	.byte	0x1
+	.byte	0x7e
+	.byte	0x20
+	.long	0x2a
+	.uleb128 0x6
+	.string	"j"
+	.byte	0x1
+	.byte	0x7e
+	.byte	0x2e
+	.long	0x59
+	.byte	0
+	.uleb128 0x1e
+	.long	.LASF48
+	.byte	0x61
+	.quad	.LFB22
+	.quad	.LFE22-.LFB22
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0xd64
+	.uleb128 0x5
+	.string	"ctx"
+	.byte	0x61
+	.byte	0x2b
+	.long	0x4a9
+	.long	.LLST73
+	.long	.LVUS73
+	.uleb128 0x5
+	.string	"src"
+	.byte	0x61
+	.byte	0x3c
+	.long	0x14a
+	.long	.LLST74
+	.long	.LVUS74
+	.uleb128 0x5
+	.string	"len"
+	.byte	0x61
+	.byte	0x48
+	.long	0x2a
+	.long	.LLST75
+	.long	.LVUS75
+	.uleb128 0xd
+	.string	"in"
+	.byte	0x63
+	.byte	0xf
+	.long	0x467
+	.long	.LLST76
+	.long	.LVUS76
+	.uleb128 0x16
+	.long	.LLRL77
+	.long	0xcbc
+	.uleb128 0x3c
+	.long	.LASF49
+	.byte	0x1
+	.byte	0x68
+	.byte	0x14
+	.long	0x2a
+	.long	.LLST78
+	.long	.LVUS78
+	.byte	0
+	.uleb128 0x2b
+	.quad	.LBB228
+	.quad	.LBE228-.LBB228
+	.long	0xd08
+	.uleb128 0xd
+	.string	"n"
+	.byte	0x74
+	.byte	0x10
+	.long	0x2a
+	.long	.LLST79
+	.long	.LVUS79
+	.uleb128 0x8
+	.quad	.LVL113
+	.long	0xd64
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x7f
+	.sleb128 0
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x2
+	.byte	0x7c
+	.sleb128 0
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x51
+	.uleb128 0x7
+	.byte	0x76
+	.sleb128 -961
+	.byte	0x39
+	.byte	0x25
+	.byte	0x23
+	.uleb128 0x1
+	.byte	0
+	.byte	0
+	.uleb128 0x11
+	.quad	.LVL100
+	.long	0xd64
+	.long	0xd2b
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x7f
+	.sleb128 0
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x2
+	.byte	0x73
+	.sleb128 0
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x51
+	.uleb128 0x1
+	.byte	0x31
+	.byte	0
+	.uleb128 0x11
+	.quad	.LVL101
+	.long	0x54d
+	.long	0xd49
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x73
+	.sleb128 0
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x2
+	.byte	0x7d
+	.sleb128 0
+	.byte	0
+	.uleb128 0x8
+	.quad	.LVL106
+	.long	0x150a
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x2
+	.byte	0x7c
+	.sleb128 0
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x51
+	.uleb128 0x2
+	.byte	0x76
+	.sleb128 0
+	.byte	0
+	.byte	0
+	.uleb128 0x29
+	.long	.LASF51
+	.byte	0x45
+	.quad	.LFB21
+	.quad	.LFE21-.LFB21
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0xfbf
+	.uleb128 0x5
+	.string	"ctx"
+	.byte	0x45
+	.byte	0x2e
+	.long	0x4a9
+	.long	.LLST0
+	.long	.LVUS0
+	.uleb128 0x5
+	.string	"src"
+	.byte	0x45
+	.byte	0x3d
+	.long	0x467
+	.long	.LLST1
+	.long	.LVUS1
+	.uleb128 0x5
+	.string	"n"
+	.byte	0x45
+	.byte	0x49
+	.long	0x2a
+	.long	.LLST2
+	.long	.LVUS2
+	.uleb128 0x14
+	.string	"L"
+	.byte	0x47
+	.byte	0x1a
+	.long	0x2f0
+	.uleb128 0x3
+	.byte	0x77
+	.sleb128 640
+	.uleb128 0x14
+	.string	"m"
+	.byte	0x48
+	.byte	0x11
+	.long	0xfbf
+	.uleb128 0x3
+	.byte	0x77
+	.sleb128 576
+	.uleb128 0x16
+	.long	.LLRL3
+	.long	0xe1d
+	.uleb128 0xd
+	.string	"i"
+	.byte	0x4a
+	.byte	0x13
+	.long	0x59
+	.long	.LLST4
+	.long	.LVUS4
+	.uleb128 0x2c
+	.long	0x136c
+	.long	.LLRL5
+	.byte	0x4b
+	.uleb128 0x13
+	.long	0x138a
+	.uleb128 0x13
+	.long	0x1380
+	.uleb128 0x13
+	.long	0x1376
+	.uleb128 0x2d
+	.long	0x1396
+	.long	.LLRL6
+	.uleb128 0x12
+	.long	0x1397
+	.long	.LLST7
+	.long	.LVUS7
+	.byte	0
+	.byte	0
+	.byte	0
+	.uleb128 0x16
+	.long	.LLRL21
+	.long	0xe66
+	.uleb128 0x17
+	.string	"i"
+	.byte	0x1
+	.byte	0x4e
+	.byte	0x17
+	.long	0x59
+	.uleb128 0xb
+	.long	0x1305
+	.quad	.LBI120
+	.value	.LVU430
+	.long	.LLRL22
+	.byte	0x51
+	.byte	0xd
+	.uleb128 0x2
+	.long	0x1323
+	.long	.LLST23
+	.long	.LVUS23
+	.uleb128 0x13
+	.long	0x1319
+	.uleb128 0x2
+	.long	0x130f
+	.long	.LLST24
+	.long	.LVUS24
+	.byte	0
+	.byte	0
+	.uleb128 0x16
+	.long	.LLRL8
+	.long	0xebe
+	.uleb128 0xd
+	.string	"i"
+	.byte	0x56
+	.byte	0x17
+	.long	0x59
+	.long	.LLST9
+	.long	.LVUS9
+	.uleb128 0xb
+	.long	0x1305
+	.quad	.LBI64
+	.value	.LVU241
+	.long	.LLRL10
+	.byte	0x58
+	.byte	0xd
+	.uleb128 0x2
+	.long	0x1323
+	.long	.LLST11
+	.long	.LVUS11
+	.uleb128 0x2
+	.long	0x1319
+	.long	.LLST12
+	.long	.LVUS12
+	.uleb128 0x2
+	.long	0x130f
+	.long	.LLST13
+	.long	.LVUS13
+	.byte	0
+	.byte	0
+	.uleb128 0x2b
+	.quad	.LBB112
+	.quad	.LBE112-.LBB112
+	.long	0xf0f
+	.uleb128 0x17
+	.string	"i"
+	.byte	0x1
+	.byte	0x5c
+	.byte	0x13
+	.long	0x59
+	.uleb128 0x2c
+	.long	0x1330
+	.long	.LLRL18
+	.byte	0x5d
+	.uleb128 0x13
+	.long	0x134e
+	.uleb128 0x13
+	.long	0x1344
+	.uleb128 0x13
+	.long	0x133a
+	.uleb128 0x2d
+	.long	0x135a
+	.long	.LLRL19
+	.uleb128 0x12
+	.long	0x135b
+	.long	.LLST20
+	.long	.LVUS20
+	.byte	0
+	.byte	0
+	.byte	0
+	.uleb128 0x23
+	.long	0x13a8
+	.quad	.LBI100
+	.value	.LVU321
+	.long	.LLRL14
+	.byte	0x5a
+	.byte	0x9
+	.long	0xf6c
+	.uleb128 0x2
+	.long	0x13c6
+	.long	.LLST15
+	.long	.LVUS15
+	.uleb128 0x2
+	.long	0x13bc
+	.long	.LLST16
+	.long	.LVUS16
+	.uleb128 0x2
+	.long	0x13b2
+	.long	.LLST17
+	.long	.LVUS17
+	.uleb128 0x24
+	.quad	.LVL25
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x7f
+	.sleb128 0
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x2
+	.byte	0x7e
+	.sleb128 0
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x51
+	.uleb128 0x2
+	.byte	0x8
+	.byte	0xff
+	.byte	0
+	.byte	0
+	.uleb128 0xb
+	.long	0x13a8
+	.quad	.LBI152
+	.value	.LVU459
+	.long	.LLRL25
+	.byte	0x53
+	.byte	0x9
+	.uleb128 0x3d
+	.long	0x13c6
+	.byte	0xff
+	.uleb128 0x2
+	.long	0x13bc
+	.long	.LLST26
+	.long	.LVUS26
+	.uleb128 0x2
+	.long	0x13b2
+	.long	.LLST27
+	.long	.LVUS27
+	.uleb128 0x24
+	.quad	.LVL40
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x7f
+	.sleb128 0
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x2
+	.byte	0x7e
+	.sleb128 0
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x51
+	.uleb128 0x2
+	.byte	0x8
+	.byte	0xff
+	.byte	0
+	.byte	0
+	.byte	0
+	.uleb128 0xa
+	.long	0x14a
+	.long	0xfcf
+	.uleb128 0x7
+	.long	0x36
+	.byte	0x7
+	.byte	0
+	.uleb128 0x3e
+	.long	.LASF52
+	.byte	0x1
+	.byte	0x3e
+	.byte	0x6
+	.byte	0x1
+	.long	0xfe9
+	.uleb128 0x6
+	.string	"ctx"
+	.byte	0x1
+	.byte	0x3e
+	.byte	0x29
+	.long	0x4a9
+	.byte	0
+	.uleb128 0x2e
+	.long	.LASF55
+	.byte	0x38
+	.long	0x44
+	.quad	.LFB19
+	.quad	.LFE19-.LFB19
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0x1125
+	.uleb128 0x5
+	.string	"ctx"
+	.byte	0x38
+	.byte	0x2f
+	.long	0x4a9
+	.long	.LLST53
+	.long	.LVUS53
+	.uleb128 0x15
+	.long	.LASF53
+	.byte	0x38
+	.byte	0x40
+	.long	0x14a
+	.long	.LLST54
+	.long	.LVUS54
+	.uleb128 0x15
+	.long	.LASF54
+	.byte	0x39
+	.byte	0x23
+	.long	0x59
+	.long	.LLST55
+	.long	.LVUS55
+	.uleb128 0xb
+	.long	0x1293
+	.quad	.LBI196
+	.value	.LVU567
+	.long	.LLRL56
+	.byte	0x3b
+	.byte	0xc
+	.uleb128 0x2
+	.long	0x12d2
+	.long	.LLST57
+	.long	.LVUS57
+	.uleb128 0x2
+	.long	0x12c6
+	.long	.LLST58
+	.long	.LVUS58
+	.uleb128 0x2
+	.long	0x12ba
+	.long	.LLST58
+	.long	.LVUS58
+	.uleb128 0x2
+	.long	0x12ae
+	.long	.LLST60
+	.long	.LVUS60
+	.uleb128 0x2
+	.long	0x12a2
+	.long	.LLST61
+	.long	.LVUS61
+	.uleb128 0x10
+	.long	.LLRL56
+	.uleb128 0x1a
+	.long	0x12de
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -64
+	.uleb128 0x1f
+	.long	0x12e8
+	.long	.LLRL62
+	.long	0x10ef
+	.uleb128 0x12
+	.long	0x12e9
+	.long	.LLST63
+	.long	.LVUS63
+	.uleb128 0x8
+	.quad	.LVL82
+	.long	0x589
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x76
+	.sleb128 0
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x2
+	.byte	0x7d
+	.sleb128 0
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x51
+	.uleb128 0x2
+	.byte	0x7c
+	.sleb128 0
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x52
+	.uleb128 0x1
+	.byte	0x30
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x58
+	.uleb128 0x1
+	.byte	0x30
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x59
+	.uleb128 0x1
+	.byte	0x30
+	.byte	0
+	.byte	0
+	.uleb128 0x8
+	.quad	.LVL79
+	.long	0x589
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x3
+	.byte	0x7e
+	.sleb128 1024
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x2
+	.byte	0x7d
+	.sleb128 0
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x51
+	.uleb128 0x2
+	.byte	0x7c
+	.sleb128 0
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x52
+	.uleb128 0x2
+	.byte	0x73
+	.sleb128 0
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x58
+	.uleb128 0x2
+	.byte	0x73
+	.sleb128 0
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x59
+	.uleb128 0x2
+	.byte	0x73
+	.sleb128 0
+	.byte	0
+	.byte	0
+	.byte	0
+	.byte	0
+	.uleb128 0x2e
+	.long	.LASF56
+	.byte	0x30
+	.long	0x44
+	.quad	.LFB18
+	.quad	.LFE18-.LFB18
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0x1293
+	.uleb128 0x5
+	.string	"ctx"
+	.byte	0x30
+	.byte	0x2e
+	.long	0x4a9
+	.long	.LLST41
+	.long	.LVUS41
+	.uleb128 0x15
+	.long	.LASF53
+	.byte	0x30
+	.byte	0x3f
+	.long	0x14a
+	.long	.LLST42
+	.long	.LVUS42
+	.uleb128 0x5
+	.string	"key"
+	.byte	0x31
+	.byte	0x25
+	.long	0x14a
+	.long	.LLST43
+	.long	.LVUS43
+	.uleb128 0x15
+	.long	.LASF57
+	.byte	0x31
+	.byte	0x33
+	.long	0x59
+	.long	.LLST44
+	.long	.LVUS44
+	.uleb128 0x15
+	.long	.LASF54
+	.byte	0x31
+	.byte	0x45
+	.long	0x59
+	.long	.LLST45
+	.long	.LVUS45
+	.uleb128 0xb
+	.long	0x1293
+	.quad	.LBI188
+	.value	.LVU520
+	.long	.LLRL46
+	.byte	0x35
+	.byte	0xc
+	.uleb128 0x2
+	.long	0x12d2
+	.long	.LLST47
+	.long	.LVUS47
+	.uleb128 0x2
+	.long	0x12c6
+	.long	.LLST48
+	.long	.LVUS48
+	.uleb128 0x2
+	.long	0x12ba
+	.long	.LLST49
+	.long	.LVUS49
+	.uleb128 0x2
+	.long	0x12ae
+	.long	.LLST50
+	.long	.LVUS50
+	.uleb128 0x2
+	.long	0x12a2
+	.long	.LLST51
+	.long	.LVUS51
+	.uleb128 0x10
+	.long	.LLRL46
+	.uleb128 0x1a
+	.long	0x12de
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -80
+	.uleb128 0x3f
+	.long	0x12e8
+	.quad	.LBB190
+	.quad	.LBE190-.LBB190
+	.long	0x1260
+	.uleb128 0x12
+	.long	0x12e9
+	.long	.LLST52
+	.long	.LVUS52
+	.uleb128 0x8
+	.quad	.LVL69
+	.long	0x589
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x7f
+	.sleb128 0
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x2
+	.byte	0x7e
+	.sleb128 0
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x51
+	.uleb128 0x2
+	.byte	0x7c
+	.sleb128 0
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x52
+	.uleb128 0x1
+	.byte	0x30
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x58
+	.uleb128 0x2
+	.byte	0x7d
+	.sleb128 0
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x59
+	.uleb128 0x2
+	.byte	0x76
+	.sleb128 0
+	.byte	0
+	.byte	0
+	.uleb128 0x8
+	.quad	.LVL65
+	.long	0x589
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x3
+	.byte	0x73
+	.sleb128 1024
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x2
+	.byte	0x7e
+	.sleb128 0
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x51
+	.uleb128 0x2
+	.byte	0x7c
+	.sleb128 0
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x52
+	.uleb128 0x1
+	.byte	0x30
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x58
+	.uleb128 0x1
+	.byte	0x30
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x59
+	.uleb128 0x1
+	.byte	0x30
+	.byte	0
+	.byte	0
+	.byte	0
+	.byte	0
+	.uleb128 0x2a
+	.long	.LASF59
+	.byte	0x17
+	.byte	0xc
+	.long	0x44
+	.long	0x12f5
+	.uleb128 0x6
+	.string	"ctx"
+	.byte	0x1
+	.byte	0x17
+	.byte	0x2a
+	.long	0x4a9
+	.uleb128 0x1b
+	.long	.LASF53
+	.byte	0x1
+	.byte	0x17
+	.byte	0x3b
+	.long	0x14a
+	.uleb128 0x6
+	.string	"key"
+	.byte	0x1
+	.byte	0x18
+	.byte	0x21
+	.long	0x14a
+	.uleb128 0x1b
+	.long	.LASF57
+	.byte	0x1
+	.byte	0x18
+	.byte	0x2f
+	.long	0x59
+	.uleb128 0x1b
+	.long	.LASF54
+	.byte	0x1
+	.byte	0x18
+	.byte	0x41
+	.long	0x59
+	.uleb128 0x17
+	.string	"P"
+	.byte	0x1
+	.byte	0x1a
+	.byte	0x9
+	.long	0x12f5
+	.uleb128 0x25
+	.uleb128 0x17
+	.string	"i"
+	.byte	0x1
+	.byte	0x26
+	.byte	0x13
+	.long	0x59
+	.byte	0
+	.byte	0
+	.uleb128 0xa
+	.long	0x1d8
+	.long	0x1305
+	.uleb128 0x7
+	.long	0x36
+	.byte	0x3
+	.byte	0
+	.uleb128 0x1c
+	.long	.LASF60
+	.byte	0xcd
+	.long	0x1330
+	.uleb128 0x6
+	.string	"L"
+	.byte	0x2
+	.byte	0xcd
+	.byte	0x36
+	.long	0x406
+	.uleb128 0x6
+	.string	"l"
+	.byte	0x2
+	.byte	0xcd
+	.byte	0x42
+	.long	0x59
+	.uleb128 0x6
+	.string	"inc"
+	.byte	0x2
+	.byte	0xcd
+	.byte	0x4c
+	.long	0x2a
+	.byte	0
+	.uleb128 0x1c
+	.long	.LASF61
+	.byte	0xc2
+	.long	0x1367
+	.uleb128 0x6
+	.string	"L"
+	.byte	0x2
+	.byte	0xc2
+	.byte	0x3c
+	.long	0x1367
+	.uleb128 0x6
+	.string	"l"
+	.byte	0x2
+	.byte	0xc2
+	.byte	0x48
+	.long	0x59
+	.uleb128 0x6
+	.string	"ctx"
+	.byte	0x2
+	.byte	0xc3
+	.byte	0x34
+	.long	0x145
+	.uleb128 0x25
+	.uleb128 0x17
+	.string	"i"
+	.byte	0x2
+	.byte	0xc5
+	.byte	0x13
+	.long	0x59
+	.byte	0
+	.byte	0
+	.uleb128 0x4
+	.long	0x322
+	.uleb128 0x1c
+	.long	.LASF62
+	.byte	0xb7
+	.long	0x13a3
+	.uleb128 0x6
+	.string	"L"
+	.byte	0x2
+	.byte	0xb7
+	.byte	0x35
+	.long	0x406
+	.uleb128 0x6
+	.string	"l"
+	.byte	0x2
+	.byte	0xb7
+	.byte	0x41
+	.long	0x59
+	.uleb128 0x6
+	.string	"ctx"
+	.byte	0x2
+	.byte	0xb8
+	.byte	0x39
+	.long	0x13a3
+	.uleb128 0x25
+	.uleb128 0x17
+	.string	"i"
+	.byte	0x2
+	.byte	0xba
+	.byte	0x13
+	.long	0x59
+	.byte	0
+	.byte	0
+	.uleb128 0x4
+	.long	0x110
+	.uleb128 0x1c
+	.long	.LASF63
+	.byte	0x61
+	.long	0x13d3
+	.uleb128 0x6
+	.string	"L"
+	.byte	0x2
+	.byte	0x61
+	.byte	0x41
+	.long	0x406
+	.uleb128 0x6
+	.string	"m"
+	.byte	0x2
+	.byte	0x62
+	.byte	0x37
+	.long	0x40b
+	.uleb128 0x1b
+	.long	.LASF64
+	.byte	0x2
+	.byte	0x62
+	.byte	0x45
+	.long	0x59
+	.byte	0
+	.uleb128 0x1c
+	.long	.LASF65
+	.byte	0x5b
+	.long	0x1400
+	.uleb128 0x6
+	.string	"ctx"
+	.byte	0x2
+	.byte	0x5b
+	.byte	0x40
+	.long	0x145
+	.uleb128 0x6
+	.string	"m"
+	.byte	0x2
+	.byte	0x5c
+	.byte	0x38
+	.long	0x14a
+	.uleb128 0x1b
+	.long	.LASF66
+	.byte	0x2
+	.byte	0x5c
+	.byte	0x42
+	.long	0x2a
+	.byte	0
+	.uleb128 0x40
+	.long	0xfcf
+	.quad	.LFB20
+	.quad	.LFE20-.LFB20
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0x150a
+	.uleb128 0x2
+	.long	0xfdc
+	.long	.LLST64
+	.long	.LVUS64
+	.uleb128 0xb
+	.long	0x1293
+	.quad	.LBI211
+	.value	.LVU619
+	.long	.LLRL65
+	.byte	0x40
+	.byte	0x5
+	.uleb128 0x2
+	.long	0x12d2
+	.long	.LLST66
+	.long	.LVUS66
+	.uleb128 0x2
+	.long	0x12c6
+	.long	.LLST67
+	.long	.LVUS67
+	.uleb128 0x2
+	.long	0x12ba
+	.long	.LLST67
+	.long	.LVUS67
+	.uleb128 0x2
+	.long	0x12ae
+	.long	.LLST67
+	.long	.LVUS67
+	.uleb128 0x2
+	.long	0x12a2
+	.long	.LLST70
+	.long	.LVUS70
+	.uleb128 0x10
+	.long	.LLRL65
+	.uleb128 0x1a
+	.long	0x12de
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -64
+	.uleb128 0x1f
+	.long	0x12e8
+	.long	.LLRL71
+	.long	0x14d4
+	.uleb128 0x12
+	.long	0x12e9
+	.long	.LLST72
+	.long	.LVUS72
+	.uleb128 0x8
+	.quad	.LVL92
+	.long	0x589
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x76
+	.sleb128 0
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x2
+	.byte	0x7c
+	.sleb128 0
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x51
+	.uleb128 0x1
+	.byte	0x30
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x52
+	.uleb128 0x1
+	.byte	0x30
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x58
+	.uleb128 0x1
+	.byte	0x30
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x59
+	.uleb128 0x1
+	.byte	0x30
+	.byte	0
+	.byte	0
+	.uleb128 0x8
+	.quad	.LVL89
+	.long	0x589
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x3
+	.byte	0x7d
+	.sleb128 1024
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x2
+	.byte	0x7c
+	.sleb128 0
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x51
+	.uleb128 0x2
+	.byte	0x73
+	.sleb128 0
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x52
+	.uleb128 0x2
+	.byte	0x73
+	.sleb128 0
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x58
+	.uleb128 0x2
+	.byte	0x73
+	.sleb128 0
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x59
+	.uleb128 0x2
+	.byte	0x73
+	.sleb128 0
+	.byte	0
+	.byte	0
+	.byte	0
+	.byte	0
+	.uleb128 0x41
+	.long	.LASF40
+	.long	.LASF68
+	.byte	0x9
+	.byte	0
+	.byte	0
+	.section	.debug_abbrev,"",@progbits
+.Ldebug_abbrev0:
+	.uleb128 0x1
+	.uleb128 0x49
+	.byte	0
+	.uleb128 0x2
+	.uleb128 0x18
+	.uleb128 0x7e
+	.uleb128 0x18
+	.byte	0
+	.byte	0
+	.uleb128 0x2
+	.uleb128 0x5
+	.byte	0
+	.uleb128 0x31
+	.uleb128 0x13
+	.uleb128 0x2
+	.uleb128 0x17
+	.uleb128 0x2137
+	.uleb128 0x17
+	.byte	0
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x5
+	.byte	0
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x4
+	.uleb128 0xf
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0x21
+	.sleb128 8
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x5
+	.uleb128 0x5
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x8
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x2
+	.uleb128 0x17
+	.uleb128 0x2137
+	.uleb128 0x17
+	.byte	0
+	.byte	0
+	.uleb128 0x6
+	.uleb128 0x5
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x8
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x7
+	.uleb128 0x21
+	.byte	0
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x2f
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x8
+	.uleb128 0x48
+	.byte	0x1
+	.uleb128 0x7d
+	.uleb128 0x1
+	.uleb128 0x7f
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x9
+	.uleb128 0xd
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x8
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x38
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0xa
+	.uleb128 0x1
+	.byte	0x1
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0x1d
+	.byte	0x1
+	.uleb128 0x31
+	.uleb128 0x13
+	.uleb128 0x52
+	.uleb128 0x1
+	.uleb128 0x2138
+	.uleb128 0x5
+	.uleb128 0x55
+	.uleb128 0x17
+	.uleb128 0x58
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x59
+	.uleb128 0xb
+	.uleb128 0x57
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0xc
+	.uleb128 0x24
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x3e
+	.uleb128 0xb
+	.uleb128 0x3
+	.uleb128 0xe
+	.byte	0
+	.byte	0
+	.uleb128 0xd
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x8
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x2
+	.uleb128 0x17
+	.uleb128 0x2137
+	.uleb128 0x17
+	.byte	0
+	.byte	0
+	.uleb128 0xe
+	.uleb128 0xd
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x38
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0xf
+	.uleb128 0x26
+	.byte	0
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x10
+	.uleb128 0xb
+	.byte	0x1
+	.uleb128 0x55
+	.uleb128 0x17
+	.byte	0
+	.byte	0
+	.uleb128 0x11
+	.uleb128 0x48
+	.byte	0x1
+	.uleb128 0x7d
+	.uleb128 0x1
+	.uleb128 0x7f
+	.uleb128 0x13
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x12
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x31
+	.uleb128 0x13
+	.uleb128 0x2
+	.uleb128 0x17
+	.uleb128 0x2137
+	.uleb128 0x17
+	.byte	0
+	.byte	0
+	.uleb128 0x13
+	.uleb128 0x5
+	.byte	0
+	.uleb128 0x31
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x14
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x8
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x2
+	.uleb128 0x18
+	.byte	0
+	.byte	0
+	.uleb128 0x15
+	.uleb128 0x5
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x2
+	.uleb128 0x17
+	.uleb128 0x2137
+	.uleb128 0x17
+	.byte	0
+	.byte	0
+	.uleb128 0x16
+	.uleb128 0xb
+	.byte	0x1
+	.uleb128 0x55
+	.uleb128 0x17
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x17
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x8
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x18
+	.uleb128 0x16
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x19
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 6
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x3c
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x1a
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x31
+	.uleb128 0x13
+	.uleb128 0x2
+	.uleb128 0x18
+	.byte	0
+	.byte	0
+	.uleb128 0x1b
+	.uleb128 0x5
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x1c
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 2
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 20
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x20
+	.uleb128 0x21
+	.sleb128 3
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x1d
+	.uleb128 0x15
+	.byte	0x1
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x1e
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 6
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x11
+	.uleb128 0x1
+	.uleb128 0x12
+	.uleb128 0x7
+	.uleb128 0x40
+	.uleb128 0x18
+	.uleb128 0x7a
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x1f
+	.uleb128 0xb
+	.byte	0x1
+	.uleb128 0x31
+	.uleb128 0x13
+	.uleb128 0x55
+	.uleb128 0x17
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x20
+	.uleb128 0xd
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x8
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x38
+	.uleb128 0x5
+	.byte	0
+	.byte	0
+	.uleb128 0x21
+	.uleb128 0x13
+	.byte	0x1
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 8
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x22
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 8
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 14
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x3c
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x23
+	.uleb128 0x1d
+	.byte	0x1
+	.uleb128 0x31
+	.uleb128 0x13
+	.uleb128 0x52
+	.uleb128 0x1
+	.uleb128 0x2138
+	.uleb128 0x5
+	.uleb128 0x55
+	.uleb128 0x17
+	.uleb128 0x58
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x59
+	.uleb128 0xb
+	.uleb128 0x57
+	.uleb128 0xb
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x24
+	.uleb128 0x48
+	.byte	0x1
+	.uleb128 0x7d
+	.uleb128 0x1
+	.byte	0
+	.byte	0
+	.uleb128 0x25
+	.uleb128 0xb
+	.byte	0x1
+	.byte	0
+	.byte	0
+	.uleb128 0x26
+	.uleb128 0x13
+	.byte	0x1
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0xb
+	.uleb128 0x5
+	.uleb128 0x88
+	.uleb128 0xb
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 8
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x27
+	.uleb128 0x16
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x8
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 2
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x28
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 2
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x1c
+	.uleb128 0xa
+	.byte	0
+	.byte	0
+	.uleb128 0x29
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 13
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x11
+	.uleb128 0x1
+	.uleb128 0x12
+	.uleb128 0x7
+	.uleb128 0x40
+	.uleb128 0x18
+	.uleb128 0x7a
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x2a
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x20
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x2b
+	.uleb128 0xb
+	.byte	0x1
+	.uleb128 0x11
+	.uleb128 0x1
+	.uleb128 0x12
+	.uleb128 0x7
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x2c
+	.uleb128 0x1d
+	.byte	0x1
+	.uleb128 0x31
+	.uleb128 0x13
+	.uleb128 0x55
+	.uleb128 0x17
+	.uleb128 0x58
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x59
+	.uleb128 0xb
+	.uleb128 0x57
+	.uleb128 0x21
+	.sleb128 9
+	.byte	0
+	.byte	0
+	.uleb128 0x2d
+	.uleb128 0xb
+	.byte	0x1
+	.uleb128 0x31
+	.uleb128 0x13
+	.uleb128 0x55
+	.uleb128 0x17
+	.byte	0
+	.byte	0
+	.uleb128 0x2e
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 5
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x11
+	.uleb128 0x1
+	.uleb128 0x12
+	.uleb128 0x7
+	.uleb128 0x40
+	.uleb128 0x18
+	.uleb128 0x7a
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x2f
+	.uleb128 0x11
+	.byte	0x1
+	.uleb128 0x25
+	.uleb128 0xe
+	.uleb128 0x13
+	.uleb128 0xb
+	.uleb128 0x3
+	.uleb128 0x1f
+	.uleb128 0x1b
+	.uleb128 0x1f
+	.uleb128 0x55
+	.uleb128 0x17
+	.uleb128 0x11
+	.uleb128 0x1
+	.uleb128 0x10
+	.uleb128 0x17
+	.byte	0
+	.byte	0
+	.uleb128 0x30
+	.uleb128 0x24
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x3e
+	.uleb128 0xb
+	.uleb128 0x3
+	.uleb128 0x8
+	.byte	0
+	.byte	0
+	.uleb128 0x31
+	.uleb128 0xf
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x32
+	.uleb128 0x13
+	.byte	0x1
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x88
+	.uleb128 0xb
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x33
+	.uleb128 0x26
+	.byte	0
+	.byte	0
+	.byte	0
+	.uleb128 0x34
+	.uleb128 0xd
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x8
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x88
+	.uleb128 0xb
+	.uleb128 0x38
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x35
+	.uleb128 0xd
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x8
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x88
+	.uleb128 0xb
+	.uleb128 0x38
+	.uleb128 0x5
+	.byte	0
+	.byte	0
+	.uleb128 0x36
+	.uleb128 0xd
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x38
+	.uleb128 0x5
+	.byte	0
+	.byte	0
+	.uleb128 0x37
+	.uleb128 0x1
+	.byte	0x1
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x88
+	.uleb128 0xb
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x38
+	.uleb128 0x21
+	.byte	0
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x2f
+	.uleb128 0x5
+	.byte	0
+	.byte	0
+	.uleb128 0x39
+	.uleb128 0x15
+	.byte	0
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x3a
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3c
+	.uleb128 0x19
+	.byte	0
+	.byte	0
+	.uleb128 0x3b
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x2
+	.uleb128 0x18
+	.byte	0
+	.byte	0
+	.uleb128 0x3c
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x2
+	.uleb128 0x17
+	.uleb128 0x2137
+	.uleb128 0x17
+	.byte	0
+	.byte	0
+	.uleb128 0x3d
+	.uleb128 0x5
+	.byte	0
+	.uleb128 0x31
+	.uleb128 0x13
+	.uleb128 0x1c
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x3e
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x20
+	.uleb128 0xb
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x3f
+	.uleb128 0xb
+	.byte	0x1
+	.uleb128 0x31
+	.uleb128 0x13
+	.uleb128 0x11
+	.uleb128 0x1
+	.uleb128 0x12
+	.uleb128 0x7
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x40
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x31
+	.uleb128 0x13
+	.uleb128 0x11
+	.uleb128 0x1
+	.uleb128 0x12
+	.uleb128 0x7
+	.uleb128 0x40
+	.uleb128 0x18
+	.uleb128 0x7a
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x41
+	.uleb128 0x2e
+	.byte	0
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3c
+	.uleb128 0x19
+	.uleb128 0x6e
+	.uleb128 0xe
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.byte	0
+	.section	.debug_loclists,"",@progbits
+	.long	.Ldebug_loc3-.Ldebug_loc2
+.Ldebug_loc2:
+	.value	0x5
+	.byte	0x8
+	.byte	0
+	.long	0
+.Ldebug_loc0:
+.LVUS105:
+	.uleb128 0
+	.uleb128 .LVU1398
+	.uleb128 .LVU1398
+	.uleb128 0
+.LLST105:
+	.byte	0x6
+	.quad	.LVL231
+	.byte	0x4
+	.uleb128 .LVL231-.LVL231
+	.uleb128 .LVL235-.LVL231
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL235-.LVL231
+	.uleb128 .LFE27-.LVL231
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -2216
+	.byte	0
+.LVUS106:
+	.uleb128 0
+	.uleb128 .LVU1399
+	.uleb128 .LVU1399
+	.uleb128 .LVU1430
+	.uleb128 .LVU1430
+	.uleb128 0
+.LLST106:
+	.byte	0x6
+	.quad	.LVL231
+	.byte	0x4
+	.uleb128 .LVL231-.LVL231
+	.uleb128 .LVL236-.LVL231
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x4
+	.uleb128 .LVL236-.LVL231
+	.uleb128 .LVL245-.LVL231
+	.uleb128 0x1
+	.byte	0x5e
+	.byte	0x4
+	.uleb128 .LVL245-.LVL231
+	.uleb128 .LFE27-.LVL231
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x9f
+	.byte	0
+.LVUS107:
+	.uleb128 0
+	.uleb128 .LVU1385
+	.uleb128 .LVU1385
+	.uleb128 .LVU1431
+	.uleb128 .LVU1431
+	.uleb128 0
+.LLST107:
+	.byte	0x6
+	.quad	.LVL231
+	.byte	0x4
+	.uleb128 .LVL231-.LVL231
+	.uleb128 .LVL232-.LVL231
+	.uleb128 0x1
+	.byte	0x51
+	.byte	0x4
+	.uleb128 .LVL232-.LVL231
+	.uleb128 .LVL246-.LVL231
+	.uleb128 0x1
+	.byte	0x5f
+	.byte	0x4
+	.uleb128 .LVL246-.LVL231
+	.uleb128 .LFE27-.LVL231
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x51
+	.byte	0x9f
+	.byte	0
+.LVUS109:
+	.uleb128 .LVU1389
+	.uleb128 .LVU1397
+	.uleb128 .LVU1397
+	.uleb128 .LVU1426
+.LLST109:
+	.byte	0x6
+	.quad	.LVL233
+	.byte	0x4
+	.uleb128 .LVL233-.LVL233
+	.uleb128 .LVL234-.LVL233
+	.uleb128 0x4
+	.byte	0x91
+	.sleb128 -2192
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL234-.LVL233
+	.uleb128 .LVL242-.LVL233
+	.uleb128 0x1
+	.byte	0x5c
+	.byte	0
+.LVUS110:
+	.uleb128 .LVU1391
+	.uleb128 .LVU1426
+.LLST110:
+	.byte	0x8
+	.quad	.LVL233
+	.uleb128 .LVL242-.LVL233
+	.uleb128 0x3
+	.byte	0x8
+	.byte	0x20
+	.byte	0x9f
+	.byte	0
+.LVUS111:
+	.uleb128 .LVU1391
+	.uleb128 .LVU1426
+.LLST111:
+	.byte	0x8
+	.quad	.LVL233
+	.uleb128 .LVL242-.LVL233
+	.uleb128 0x2
+	.byte	0x30
+	.byte	0x9f
+	.byte	0
+.LVUS114:
+	.uleb128 .LVU1391
+	.uleb128 .LVU1397
+	.uleb128 .LVU1397
+	.uleb128 .LVU1426
+.LLST114:
+	.byte	0x6
+	.quad	.LVL233
+	.byte	0x4
+	.uleb128 .LVL233-.LVL233
+	.uleb128 .LVL234-.LVL233
+	.uleb128 0x4
+	.byte	0x91
+	.sleb128 -2192
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL234-.LVL233
+	.uleb128 .LVL242-.LVL233
+	.uleb128 0x1
+	.byte	0x5c
+	.byte	0
+.LVUS116:
+	.uleb128 .LVU1409
+	.uleb128 .LVU1410
+	.uleb128 .LVU1410
+	.uleb128 .LVU1414
+	.uleb128 .LVU1414
+	.uleb128 .LVU1415
+	.uleb128 .LVU1415
+	.uleb128 .LVU1419
+	.uleb128 .LVU1419
+	.uleb128 .LVU1426
+.LLST116:
+	.byte	0x6
+	.quad	.LVL238
+	.byte	0x4
+	.uleb128 .LVL238-.LVL238
+	.uleb128 .LVL238-.LVL238
+	.uleb128 0x2
+	.byte	0x30
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL238-.LVL238
+	.uleb128 .LVL239-.LVL238
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0x4
+	.uleb128 .LVL239-.LVL238
+	.uleb128 .LVL240-1-.LVL238
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -2200
+	.byte	0x4
+	.uleb128 .LVL240-1-.LVL238
+	.uleb128 .LVL241-.LVL238
+	.uleb128 0x3
+	.byte	0x73
+	.sleb128 -1
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL241-.LVL238
+	.uleb128 .LVL242-.LVL238
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0
+.LVUS92:
+	.uleb128 0
+	.uleb128 .LVU1308
+	.uleb128 .LVU1308
+	.uleb128 0
+.LLST92:
+	.byte	0x6
+	.quad	.LVL210
+	.byte	0x4
+	.uleb128 .LVL210-.LVL210
+	.uleb128 .LVL215-.LVL210
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL215-.LVL210
+	.uleb128 .LFE26-.LVL210
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -2232
+	.byte	0
+.LVUS93:
+	.uleb128 0
+	.uleb128 .LVU1309
+	.uleb128 .LVU1309
+	.uleb128 .LVU1372
+	.uleb128 .LVU1372
+	.uleb128 0
+.LLST93:
+	.byte	0x6
+	.quad	.LVL210
+	.byte	0x4
+	.uleb128 .LVL210-.LVL210
+	.uleb128 .LVL216-.LVL210
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x4
+	.uleb128 .LVL216-.LVL210
+	.uleb128 .LVL230-.LVL210
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -2240
+	.byte	0x4
+	.uleb128 .LVL230-.LVL210
+	.uleb128 .LFE26-.LVL210
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0
+.LVUS94:
+	.uleb128 0
+	.uleb128 .LVU1292
+	.uleb128 .LVU1292
+	.uleb128 .LVU1350
+	.uleb128 .LVU1351
+	.uleb128 .LVU1371
+	.uleb128 .LVU1371
+	.uleb128 .LVU1373
+	.uleb128 .LVU1373
+	.uleb128 0
+.LLST94:
+	.byte	0x6
+	.quad	.LVL210
+	.byte	0x4
+	.uleb128 .LVL210-.LVL210
+	.uleb128 .LVL211-.LVL210
+	.uleb128 0x1
+	.byte	0x51
+	.byte	0x4
+	.uleb128 .LVL211-.LVL210
+	.uleb128 .LVL226-.LVL210
+	.uleb128 0x1
+	.byte	0x5c
+	.byte	0x4
+	.uleb128 .LVL227-.LVL210
+	.uleb128 .LVL229-.LVL210
+	.uleb128 0x1
+	.byte	0x5c
+	.byte	0x4
+	.uleb128 .LVL229-.LVL210
+	.uleb128 .LVL230-.LVL210
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x51
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL230-.LVL210
+	.uleb128 .LFE26-.LVL210
+	.uleb128 0x1
+	.byte	0x5c
+	.byte	0
+.LVUS95:
+	.uleb128 0
+	.uleb128 .LVU1295
+	.uleb128 .LVU1295
+	.uleb128 .LVU1349
+	.uleb128 .LVU1349
+	.uleb128 .LVU1351
+	.uleb128 .LVU1351
+	.uleb128 0
+.LLST95:
+	.byte	0x6
+	.quad	.LVL210
+	.byte	0x4
+	.uleb128 .LVL210-.LVL210
+	.uleb128 .LVL212-.LVL210
+	.uleb128 0x1
+	.byte	0x52
+	.byte	0x4
+	.uleb128 .LVL212-.LVL210
+	.uleb128 .LVL225-.LVL210
+	.uleb128 0x1
+	.byte	0x56
+	.byte	0x4
+	.uleb128 .LVL225-.LVL210
+	.uleb128 .LVL227-.LVL210
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x52
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL227-.LVL210
+	.uleb128 .LFE26-.LVL210
+	.uleb128 0x1
+	.byte	0x56
+	.byte	0
+.LVUS97:
+	.uleb128 .LVU1297
+	.uleb128 .LVU1305
+	.uleb128 .LVU1305
+	.uleb128 .LVU1337
+.LLST97:
+	.byte	0x6
+	.quad	.LVL213
+	.byte	0x4
+	.uleb128 .LVL213-.LVL213
+	.uleb128 .LVL214-.LVL213
+	.uleb128 0x4
+	.byte	0x91
+	.sleb128 -2192
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL214-.LVL213
+	.uleb128 .LVL222-.LVL213
+	.uleb128 0x1
+	.byte	0x5e
+	.byte	0
+.LVUS98:
+	.uleb128 .LVU1299
+	.uleb128 .LVU1337
+.LLST98:
+	.byte	0x8
+	.quad	.LVL213
+	.uleb128 .LVL222-.LVL213
+	.uleb128 0x3
+	.byte	0x8
+	.byte	0x20
+	.byte	0x9f
+	.byte	0
+.LVUS99:
+	.uleb128 .LVU1299
+	.uleb128 .LVU1337
+.LLST99:
+	.byte	0x8
+	.quad	.LVL213
+	.uleb128 .LVL222-.LVL213
+	.uleb128 0x2
+	.byte	0x30
+	.byte	0x9f
+	.byte	0
+.LVUS102:
+	.uleb128 .LVU1299
+	.uleb128 .LVU1305
+	.uleb128 .LVU1305
+	.uleb128 .LVU1337
+.LLST102:
+	.byte	0x6
+	.quad	.LVL213
+	.byte	0x4
+	.uleb128 .LVL213-.LVL213
+	.uleb128 .LVL214-.LVL213
+	.uleb128 0x4
+	.byte	0x91
+	.sleb128 -2192
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL214-.LVL213
+	.uleb128 .LVL222-.LVL213
+	.uleb128 0x1
+	.byte	0x5e
+	.byte	0
+.LVUS104:
+	.uleb128 .LVU1320
+	.uleb128 .LVU1321
+	.uleb128 .LVU1321
+	.uleb128 .LVU1325
+	.uleb128 .LVU1325
+	.uleb128 .LVU1326
+	.uleb128 .LVU1326
+	.uleb128 .LVU1330
+	.uleb128 .LVU1330
+	.uleb128 .LVU1337
+.LLST104:
+	.byte	0x6
+	.quad	.LVL218
+	.byte	0x4
+	.uleb128 .LVL218-.LVL218
+	.uleb128 .LVL218-.LVL218
+	.uleb128 0x2
+	.byte	0x30
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL218-.LVL218
+	.uleb128 .LVL219-.LVL218
+	.uleb128 0x1
+	.byte	0x5f
+	.byte	0x4
+	.uleb128 .LVL219-.LVL218
+	.uleb128 .LVL220-1-.LVL218
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -2216
+	.byte	0x4
+	.uleb128 .LVL220-1-.LVL218
+	.uleb128 .LVL221-.LVL218
+	.uleb128 0x3
+	.byte	0x7f
+	.sleb128 -1
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL221-.LVL218
+	.uleb128 .LVL222-.LVL218
+	.uleb128 0x1
+	.byte	0x5f
+	.byte	0
+.LVUS28:
+	.uleb128 0
+	.uleb128 .LVU470
+	.uleb128 .LVU470
+	.uleb128 .LVU499
+	.uleb128 .LVU499
+	.uleb128 .LVU501
+	.uleb128 .LVU501
+	.uleb128 .LVU511
+	.uleb128 .LVU511
+	.uleb128 0
+.LLST28:
+	.byte	0x6
+	.quad	.LVL41
+	.byte	0x4
+	.uleb128 .LVL41-.LVL41
+	.uleb128 .LVL42-.LVL41
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL42-.LVL41
+	.uleb128 .LVL50-.LVL41
+	.uleb128 0x1
+	.byte	0x5c
+	.byte	0x4
+	.uleb128 .LVL50-.LVL41
+	.uleb128 .LVL52-.LVL41
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL52-.LVL41
+	.uleb128 .LVL56-.LVL41
+	.uleb128 0x1
+	.byte	0x5c
+	.byte	0x4
+	.uleb128 .LVL56-.LVL41
+	.uleb128 .LFE25-.LVL41
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0
+.LVUS29:
+	.uleb128 0
+	.uleb128 .LVU470
+	.uleb128 .LVU470
+	.uleb128 .LVU511
+	.uleb128 .LVU511
+	.uleb128 0
+.LLST29:
+	.byte	0x6
+	.quad	.LVL41
+	.byte	0x4
+	.uleb128 .LVL41-.LVL41
+	.uleb128 .LVL42-.LVL41
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x4
+	.uleb128 .LVL42-.LVL41
+	.uleb128 .LVL56-.LVL41
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL56-.LVL41
+	.uleb128 .LFE25-.LVL41
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0
+.LVUS30:
+	.uleb128 .LVU465
+	.uleb128 .LVU470
+	.uleb128 .LVU470
+	.uleb128 .LVU499
+	.uleb128 .LVU499
+	.uleb128 .LVU501
+	.uleb128 .LVU501
+	.uleb128 .LVU511
+	.uleb128 .LVU511
+	.uleb128 0
+.LLST30:
+	.byte	0x6
+	.quad	.LVL41
+	.byte	0x4
+	.uleb128 .LVL41-.LVL41
+	.uleb128 .LVL42-.LVL41
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL42-.LVL41
+	.uleb128 .LVL50-.LVL41
+	.uleb128 0x1
+	.byte	0x5c
+	.byte	0x4
+	.uleb128 .LVL50-.LVL41
+	.uleb128 .LVL52-.LVL41
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL52-.LVL41
+	.uleb128 .LVL56-.LVL41
+	.uleb128 0x1
+	.byte	0x5c
+	.byte	0x4
+	.uleb128 .LVL56-.LVL41
+	.uleb128 .LFE25-.LVL41
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0
+.LVUS32:
+	.uleb128 .LVU467
+	.uleb128 .LVU470
+	.uleb128 .LVU470
+	.uleb128 .LVU500
+	.uleb128 .LVU501
+	.uleb128 .LVU511
+	.uleb128 .LVU511
+	.uleb128 0
+.LLST32:
+	.byte	0x6
+	.quad	.LVL41
+	.byte	0x4
+	.uleb128 .LVL41-.LVL41
+	.uleb128 .LVL42-.LVL41
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x4
+	.uleb128 .LVL42-.LVL41
+	.uleb128 .LVL51-.LVL41
+	.uleb128 0x1
+	.byte	0x5d
+	.byte	0x4
+	.uleb128 .LVL52-.LVL41
+	.uleb128 .LVL56-.LVL41
+	.uleb128 0x1
+	.byte	0x5d
+	.byte	0x4
+	.uleb128 .LVL56-.LVL41
+	.uleb128 .LFE25-.LVL41
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0
+.LVUS34:
+	.uleb128 .LVU474
+	.uleb128 .LVU486
+	.uleb128 .LVU486
+	.uleb128 .LVU488
+	.uleb128 .LVU488
+	.uleb128 .LVU490
+	.uleb128 .LVU490
+	.uleb128 .LVU497
+	.uleb128 .LVU501
+	.uleb128 .LVU505
+	.uleb128 .LVU506
+	.uleb128 .LVU510
+.LLST34:
+	.byte	0x6
+	.quad	.LVL43
+	.byte	0x4
+	.uleb128 .LVL43-.LVL43
+	.uleb128 .LVL46-.LVL43
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0x4
+	.uleb128 .LVL46-.LVL43
+	.uleb128 .LVL47-1-.LVL43
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x4
+	.uleb128 .LVL47-1-.LVL43
+	.uleb128 .LVL47-.LVL43
+	.uleb128 0x4
+	.byte	0x73
+	.sleb128 -512
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL47-.LVL43
+	.uleb128 .LVL49-.LVL43
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0x4
+	.uleb128 .LVL52-.LVL43
+	.uleb128 .LVL54-.LVL43
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0x4
+	.uleb128 .LVL54-.LVL43
+	.uleb128 .LVL55-.LVL43
+	.uleb128 0x9
+	.byte	0x7d
+	.sleb128 0
+	.byte	0x36
+	.byte	0x24
+	.byte	0x7c
+	.sleb128 8
+	.byte	0x6
+	.byte	0x22
+	.byte	0x9f
+	.byte	0
+.LVUS36:
+	.uleb128 .LVU476
+	.uleb128 .LVU478
+	.uleb128 .LVU478
+	.uleb128 .LVU484
+	.uleb128 .LVU484
+	.uleb128 .LVU490
+	.uleb128 .LVU490
+	.uleb128 .LVU497
+	.uleb128 .LVU501
+	.uleb128 .LVU511
+.LLST36:
+	.byte	0x6
+	.quad	.LVL43
+	.byte	0x4
+	.uleb128 .LVL43-.LVL43
+	.uleb128 .LVL44-.LVL43
+	.uleb128 0x2
+	.byte	0x30
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL44-.LVL43
+	.uleb128 .LVL45-.LVL43
+	.uleb128 0x1
+	.byte	0x56
+	.byte	0x4
+	.uleb128 .LVL45-.LVL43
+	.uleb128 .LVL47-.LVL43
+	.uleb128 0x3
+	.byte	0x76
+	.sleb128 -1
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL47-.LVL43
+	.uleb128 .LVL49-.LVL43
+	.uleb128 0x1
+	.byte	0x56
+	.byte	0x4
+	.uleb128 .LVL52-.LVL43
+	.uleb128 .LVL56-.LVL43
+	.uleb128 0x2
+	.byte	0x30
+	.byte	0x9f
+	.byte	0
+.LVUS38:
+	.uleb128 .LVU479
+	.uleb128 .LVU488
+.LLST38:
+	.byte	0x8
+	.quad	.LVL44
+	.uleb128 .LVL47-.LVL44
+	.uleb128 0x2
+	.byte	0x31
+	.byte	0x9f
+	.byte	0
+.LVUS39:
+	.uleb128 .LVU479
+	.uleb128 .LVU486
+	.uleb128 .LVU486
+	.uleb128 .LVU488
+	.uleb128 .LVU488
+	.uleb128 .LVU488
+.LLST39:
+	.byte	0x6
+	.quad	.LVL44
+	.byte	0x4
+	.uleb128 .LVL44-.LVL44
+	.uleb128 .LVL46-.LVL44
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0x4
+	.uleb128 .LVL46-.LVL44
+	.uleb128 .LVL47-1-.LVL44
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x4
+	.uleb128 .LVL47-1-.LVL44
+	.uleb128 .LVL47-.LVL44
+	.uleb128 0x4
+	.byte	0x73
+	.sleb128 -512
+	.byte	0x9f
+	.byte	0
+.LVUS40:
+	.uleb128 .LVU479
+	.uleb128 .LVU488
+.LLST40:
+	.byte	0x8
+	.quad	.LVL44
+	.uleb128 .LVL47-1-.LVL44
+	.uleb128 0x7
+	.byte	0x7c
+	.sleb128 0
+	.byte	0x6
+	.byte	0x7e
+	.sleb128 0
+	.byte	0x22
+	.byte	0x9f
+	.byte	0
+.LVUS80:
+	.uleb128 0
+	.uleb128 .LVU896
+	.uleb128 .LVU896
+	.uleb128 .LVU1071
+	.uleb128 .LVU1071
+	.uleb128 .LVU1073
+	.uleb128 .LVU1073
+	.uleb128 .LVU1074
+	.uleb128 .LVU1074
+	.uleb128 0
+.LLST80:
+	.byte	0x6
+	.quad	.LVL117
+	.byte	0x4
+	.uleb128 .LVL117-.LVL117
+	.uleb128 .LVL144-.LVL117
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL144-.LVL117
+	.uleb128 .LVL178-.LVL117
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0x4
+	.uleb128 .LVL178-.LVL117
+	.uleb128 .LVL179-.LVL117
+	.uleb128 0x4
+	.byte	0x7c
+	.sleb128 -1024
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL179-.LVL117
+	.uleb128 .LVL180-.LVL117
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL180-.LVL117
+	.uleb128 .LFE24-.LVL117
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0
+.LVUS81:
+	.uleb128 0
+	.uleb128 .LVU837
+	.uleb128 .LVU837
+	.uleb128 .LVU1070
+	.uleb128 .LVU1070
+	.uleb128 .LVU1074
+	.uleb128 .LVU1074
+	.uleb128 .LVU1148
+	.uleb128 .LVU1148
+	.uleb128 0
+.LLST81:
+	.byte	0x6
+	.quad	.LVL117
+	.byte	0x4
+	.uleb128 .LVL117-.LVL117
+	.uleb128 .LVL132-.LVL117
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x4
+	.uleb128 .LVL132-.LVL117
+	.uleb128 .LVL177-.LVL117
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -616
+	.byte	0x4
+	.uleb128 .LVL177-.LVL117
+	.uleb128 .LVL180-.LVL117
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL180-.LVL117
+	.uleb128 .LVL190-.LVL117
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x4
+	.uleb128 .LVL190-.LVL117
+	.uleb128 .LFE24-.LVL117
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -616
+	.byte	0
+.LVUS83:
+	.uleb128 .LVU741
+	.uleb128 .LVU766
+	.uleb128 .LVU766
+	.uleb128 .LVU786
+	.uleb128 .LVU786
+	.uleb128 .LVU806
+	.uleb128 .LVU806
+	.uleb128 .LVU825
+	.uleb128 .LVU825
+	.uleb128 .LVU846
+	.uleb128 .LVU846
+	.uleb128 .LVU866
+	.uleb128 .LVU866
+	.uleb128 .LVU884
+	.uleb128 .LVU884
+	.uleb128 .LVU909
+	.uleb128 .LVU909
+	.uleb128 .LVU1074
+	.uleb128 .LVU1074
+	.uleb128 .LVU1080
+	.uleb128 .LVU1080
+	.uleb128 .LVU1095
+	.uleb128 .LVU1095
+	.uleb128 .LVU1110
+	.uleb128 .LVU1110
+	.uleb128 .LVU1125
+	.uleb128 .LVU1125
+	.uleb128 .LVU1140
+	.uleb128 .LVU1140
+	.uleb128 .LVU1155
+	.uleb128 .LVU1155
+	.uleb128 .LVU1166
+	.uleb128 .LVU1166
+	.uleb128 .LVU1176
+	.uleb128 .LVU1176
+	.uleb128 .LVU1282
+	.uleb128 .LVU1282
+	.uleb128 0
+.LLST83:
+	.byte	0x6
+	.quad	.LVL117
+	.byte	0x4
+	.uleb128 .LVL117-.LVL117
+	.uleb128 .LVL120-.LVL117
+	.uleb128 0x2
+	.byte	0x30
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL120-.LVL117
+	.uleb128 .LVL123-.LVL117
+	.uleb128 0x2
+	.byte	0x31
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL123-.LVL117
+	.uleb128 .LVL126-.LVL117
+	.uleb128 0x2
+	.byte	0x32
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL126-.LVL117
+	.uleb128 .LVL129-.LVL117
+	.uleb128 0x2
+	.byte	0x33
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL129-.LVL117
+	.uleb128 .LVL133-.LVL117
+	.uleb128 0x2
+	.byte	0x34
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL133-.LVL117
+	.uleb128 .LVL136-.LVL117
+	.uleb128 0x2
+	.byte	0x35
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL136-.LVL117
+	.uleb128 .LVL140-.LVL117
+	.uleb128 0x2
+	.byte	0x36
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL140-.LVL117
+	.uleb128 .LVL147-.LVL117
+	.uleb128 0x2
+	.byte	0x37
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL147-.LVL117
+	.uleb128 .LVL180-.LVL117
+	.uleb128 0x2
+	.byte	0x38
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL180-.LVL117
+	.uleb128 .LVL181-.LVL117
+	.uleb128 0x2
+	.byte	0x30
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL181-.LVL117
+	.uleb128 .LVL183-.LVL117
+	.uleb128 0x2
+	.byte	0x31
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL183-.LVL117
+	.uleb128 .LVL185-.LVL117
+	.uleb128 0x2
+	.byte	0x32
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL185-.LVL117
+	.uleb128 .LVL187-.LVL117
+	.uleb128 0x2
+	.byte	0x33
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL187-.LVL117
+	.uleb128 .LVL189-.LVL117
+	.uleb128 0x2
+	.byte	0x34
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL189-.LVL117
+	.uleb128 .LVL191-.LVL117
+	.uleb128 0x2
+	.byte	0x35
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL191-.LVL117
+	.uleb128 .LVL192-.LVL117
+	.uleb128 0x2
+	.byte	0x36
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL192-.LVL117
+	.uleb128 .LVL194-.LVL117
+	.uleb128 0x2
+	.byte	0x37
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL194-.LVL117
+	.uleb128 .LVL209-.LVL117
+	.uleb128 0x2
+	.byte	0x38
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL209-.LVL117
+	.uleb128 .LFE24-.LVL117
+	.uleb128 0x2
+	.byte	0x37
+	.byte	0x9f
+	.byte	0
+.LVUS85:
+	.uleb128 .LVU752
+	.uleb128 .LVU757
+	.uleb128 .LVU771
+	.uleb128 .LVU776
+	.uleb128 .LVU791
+	.uleb128 .LVU796
+	.uleb128 .LVU811
+	.uleb128 .LVU816
+	.uleb128 .LVU830
+	.uleb128 .LVU835
+	.uleb128 .LVU851
+	.uleb128 .LVU856
+	.uleb128 .LVU871
+	.uleb128 .LVU881
+	.uleb128 .LVU889
+	.uleb128 .LVU900
+	.uleb128 .LVU1086
+	.uleb128 .LVU1088
+	.uleb128 .LVU1101
+	.uleb128 .LVU1103
+	.uleb128 .LVU1116
+	.uleb128 .LVU1118
+	.uleb128 .LVU1131
+	.uleb128 .LVU1133
+	.uleb128 .LVU1146
+	.uleb128 .LVU1148
+	.uleb128 .LVU1161
+	.uleb128 .LVU1163
+	.uleb128 .LVU1172
+	.uleb128 .LVU1176
+	.uleb128 .LVU1282
+	.uleb128 0
+.LLST85:
+	.byte	0x6
+	.quad	.LVL118
+	.byte	0x4
+	.uleb128 .LVL118-.LVL118
+	.uleb128 .LVL119-.LVL118
+	.uleb128 0x2
+	.byte	0x30
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL121-.LVL118
+	.uleb128 .LVL122-.LVL118
+	.uleb128 0x2
+	.byte	0x31
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL124-.LVL118
+	.uleb128 .LVL125-.LVL118
+	.uleb128 0x2
+	.byte	0x32
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL127-.LVL118
+	.uleb128 .LVL128-.LVL118
+	.uleb128 0x2
+	.byte	0x33
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL130-.LVL118
+	.uleb128 .LVL131-.LVL118
+	.uleb128 0x2
+	.byte	0x34
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL134-.LVL118
+	.uleb128 .LVL135-.LVL118
+	.uleb128 0x2
+	.byte	0x35
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL137-.LVL118
+	.uleb128 .LVL140-.LVL118
+	.uleb128 0x2
+	.byte	0x36
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL141-.LVL118
+	.uleb128 .LVL146-.LVL118
+	.uleb128 0x2
+	.byte	0x37
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL182-.LVL118
+	.uleb128 .LVL182-.LVL118
+	.uleb128 0x2
+	.byte	0x31
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL184-.LVL118
+	.uleb128 .LVL184-.LVL118
+	.uleb128 0x2
+	.byte	0x32
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL186-.LVL118
+	.uleb128 .LVL186-.LVL118
+	.uleb128 0x2
+	.byte	0x33
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL188-.LVL118
+	.uleb128 .LVL188-.LVL118
+	.uleb128 0x2
+	.byte	0x34
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL190-.LVL118
+	.uleb128 .LVL190-.LVL118
+	.uleb128 0x2
+	.byte	0x35
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL192-.LVL118
+	.uleb128 .LVL192-.LVL118
+	.uleb128 0x2
+	.byte	0x36
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL193-.LVL118
+	.uleb128 .LVL194-.LVL118
+	.uleb128 0x2
+	.byte	0x37
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL209-.LVL118
+	.uleb128 .LFE24-.LVL118
+	.uleb128 0x2
+	.byte	0x37
+	.byte	0x9f
+	.byte	0
+.LVUS86:
+	.uleb128 .LVU756
+	.uleb128 .LVU757
+	.uleb128 .LVU775
+	.uleb128 .LVU776
+	.uleb128 .LVU795
+	.uleb128 .LVU796
+	.uleb128 .LVU815
+	.uleb128 .LVU816
+	.uleb128 .LVU834
+	.uleb128 .LVU835
+	.uleb128 .LVU855
+	.uleb128 .LVU856
+	.uleb128 .LVU875
+	.uleb128 .LVU878
+	.uleb128 .LVU878
+	.uleb128 .LVU881
+	.uleb128 .LVU893
+	.uleb128 .LVU895
+	.uleb128 .LVU895
+	.uleb128 .LVU897
+	.uleb128 .LVU1086
+	.uleb128 .LVU1088
+.LLST86:
+	.byte	0x6
+	.quad	.LVL119
+	.byte	0x4
+	.uleb128 .LVL119-.LVL119
+	.uleb128 .LVL119-.LVL119
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL122-.LVL119
+	.uleb128 .LVL122-.LVL119
+	.uleb128 0x3
+	.byte	0x70
+	.sleb128 -64
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL125-.LVL119
+	.uleb128 .LVL125-.LVL119
+	.uleb128 0x4
+	.byte	0x70
+	.sleb128 -128
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL128-.LVL119
+	.uleb128 .LVL128-.LVL119
+	.uleb128 0x4
+	.byte	0x70
+	.sleb128 -192
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL131-.LVL119
+	.uleb128 .LVL131-.LVL119
+	.uleb128 0x4
+	.byte	0x70
+	.sleb128 -256
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL135-.LVL119
+	.uleb128 .LVL135-.LVL119
+	.uleb128 0x4
+	.byte	0x70
+	.sleb128 -320
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL138-.LVL119
+	.uleb128 .LVL139-.LVL119
+	.uleb128 0x4
+	.byte	0x70
+	.sleb128 -384
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL139-.LVL119
+	.uleb128 .LVL140-.LVL119
+	.uleb128 0x1
+	.byte	0x51
+	.byte	0x4
+	.uleb128 .LVL142-.LVL119
+	.uleb128 .LVL143-.LVL119
+	.uleb128 0x4
+	.byte	0x70
+	.sleb128 -448
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL143-.LVL119
+	.uleb128 .LVL145-.LVL119
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL182-.LVL119
+	.uleb128 .LVL182-.LVL119
+	.uleb128 0x2
+	.byte	0x30
+	.byte	0x9f
+	.byte	0
+.LVUS88:
+	.uleb128 .LVU913
+	.uleb128 .LVU938
+	.uleb128 .LVU938
+	.uleb128 .LVU956
+	.uleb128 .LVU956
+	.uleb128 .LVU974
+	.uleb128 .LVU974
+	.uleb128 .LVU992
+	.uleb128 .LVU992
+	.uleb128 .LVU1010
+	.uleb128 .LVU1010
+	.uleb128 .LVU1028
+	.uleb128 .LVU1028
+	.uleb128 .LVU1046
+	.uleb128 .LVU1046
+	.uleb128 .LVU1064
+	.uleb128 .LVU1064
+	.uleb128 .LVU1074
+	.uleb128 .LVU1176
+	.uleb128 .LVU1183
+	.uleb128 .LVU1183
+	.uleb128 .LVU1199
+	.uleb128 .LVU1199
+	.uleb128 .LVU1214
+	.uleb128 .LVU1214
+	.uleb128 .LVU1229
+	.uleb128 .LVU1229
+	.uleb128 .LVU1244
+	.uleb128 .LVU1244
+	.uleb128 .LVU1259
+	.uleb128 .LVU1259
+	.uleb128 .LVU1274
+	.uleb128 .LVU1274
+	.uleb128 .LVU1282
+.LLST88:
+	.byte	0x6
+	.quad	.LVL148
+	.byte	0x4
+	.uleb128 .LVL148-.LVL148
+	.uleb128 .LVL151-.LVL148
+	.uleb128 0x2
+	.byte	0x30
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL151-.LVL148
+	.uleb128 .LVL154-.LVL148
+	.uleb128 0x2
+	.byte	0x31
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL154-.LVL148
+	.uleb128 .LVL157-.LVL148
+	.uleb128 0x2
+	.byte	0x32
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL157-.LVL148
+	.uleb128 .LVL160-.LVL148
+	.uleb128 0x2
+	.byte	0x33
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL160-.LVL148
+	.uleb128 .LVL163-.LVL148
+	.uleb128 0x2
+	.byte	0x34
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL163-.LVL148
+	.uleb128 .LVL166-.LVL148
+	.uleb128 0x2
+	.byte	0x35
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL166-.LVL148
+	.uleb128 .LVL169-.LVL148
+	.uleb128 0x2
+	.byte	0x36
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL169-.LVL148
+	.uleb128 .LVL173-.LVL148
+	.uleb128 0x2
+	.byte	0x37
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL173-.LVL148
+	.uleb128 .LVL180-.LVL148
+	.uleb128 0x2
+	.byte	0x38
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL194-.LVL148
+	.uleb128 .LVL195-.LVL148
+	.uleb128 0x2
+	.byte	0x30
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL195-.LVL148
+	.uleb128 .LVL197-.LVL148
+	.uleb128 0x2
+	.byte	0x31
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL197-.LVL148
+	.uleb128 .LVL199-.LVL148
+	.uleb128 0x2
+	.byte	0x32
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL199-.LVL148
+	.uleb128 .LVL201-.LVL148
+	.uleb128 0x2
+	.byte	0x33
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL201-.LVL148
+	.uleb128 .LVL203-.LVL148
+	.uleb128 0x2
+	.byte	0x34
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL203-.LVL148
+	.uleb128 .LVL205-.LVL148
+	.uleb128 0x2
+	.byte	0x35
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL205-.LVL148
+	.uleb128 .LVL207-.LVL148
+	.uleb128 0x2
+	.byte	0x36
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL207-.LVL148
+	.uleb128 .LVL209-.LVL148
+	.uleb128 0x2
+	.byte	0x37
+	.byte	0x9f
+	.byte	0
+.LVUS90:
+	.uleb128 .LVU923
+	.uleb128 .LVU928
+	.uleb128 .LVU943
+	.uleb128 .LVU948
+	.uleb128 .LVU961
+	.uleb128 .LVU966
+	.uleb128 .LVU979
+	.uleb128 .LVU984
+	.uleb128 .LVU997
+	.uleb128 .LVU1002
+	.uleb128 .LVU1015
+	.uleb128 .LVU1020
+	.uleb128 .LVU1033
+	.uleb128 .LVU1038
+	.uleb128 .LVU1051
+	.uleb128 .LVU1056
+	.uleb128 .LVU1189
+	.uleb128 .LVU1191
+	.uleb128 .LVU1204
+	.uleb128 .LVU1206
+	.uleb128 .LVU1219
+	.uleb128 .LVU1221
+	.uleb128 .LVU1234
+	.uleb128 .LVU1236
+	.uleb128 .LVU1249
+	.uleb128 .LVU1251
+	.uleb128 .LVU1264
+	.uleb128 .LVU1266
+	.uleb128 .LVU1279
+	.uleb128 .LVU1282
+.LLST90:
+	.byte	0x6
+	.quad	.LVL149
+	.byte	0x4
+	.uleb128 .LVL149-.LVL149
+	.uleb128 .LVL150-.LVL149
+	.uleb128 0x2
+	.byte	0x38
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL152-.LVL149
+	.uleb128 .LVL153-.LVL149
+	.uleb128 0x2
+	.byte	0x39
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL155-.LVL149
+	.uleb128 .LVL156-.LVL149
+	.uleb128 0x2
+	.byte	0x3a
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL158-.LVL149
+	.uleb128 .LVL159-.LVL149
+	.uleb128 0x2
+	.byte	0x3b
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL161-.LVL149
+	.uleb128 .LVL162-.LVL149
+	.uleb128 0x2
+	.byte	0x3c
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL164-.LVL149
+	.uleb128 .LVL165-.LVL149
+	.uleb128 0x2
+	.byte	0x3d
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL167-.LVL149
+	.uleb128 .LVL168-.LVL149
+	.uleb128 0x2
+	.byte	0x3e
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL170-.LVL149
+	.uleb128 .LVL172-.LVL149
+	.uleb128 0x2
+	.byte	0x3f
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL196-.LVL149
+	.uleb128 .LVL196-.LVL149
+	.uleb128 0x2
+	.byte	0x39
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL198-.LVL149
+	.uleb128 .LVL198-.LVL149
+	.uleb128 0x2
+	.byte	0x3a
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL200-.LVL149
+	.uleb128 .LVL200-.LVL149
+	.uleb128 0x2
+	.byte	0x3b
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL202-.LVL149
+	.uleb128 .LVL202-.LVL149
+	.uleb128 0x2
+	.byte	0x3c
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL204-.LVL149
+	.uleb128 .LVL204-.LVL149
+	.uleb128 0x2
+	.byte	0x3d
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL206-.LVL149
+	.uleb128 .LVL206-.LVL149
+	.uleb128 0x2
+	.byte	0x3e
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL208-.LVL149
+	.uleb128 .LVL209-.LVL149
+	.uleb128 0x2
+	.byte	0x3f
+	.byte	0x9f
+	.byte	0
+.LVUS91:
+	.uleb128 .LVU923
+	.uleb128 .LVU926
+	.uleb128 .LVU926
+	.uleb128 .LVU927
+	.uleb128 .LVU927
+	.uleb128 .LVU928
+	.uleb128 .LVU943
+	.uleb128 .LVU947
+	.uleb128 .LVU947
+	.uleb128 .LVU948
+	.uleb128 .LVU961
+	.uleb128 .LVU965
+	.uleb128 .LVU965
+	.uleb128 .LVU966
+	.uleb128 .LVU979
+	.uleb128 .LVU983
+	.uleb128 .LVU983
+	.uleb128 .LVU984
+	.uleb128 .LVU997
+	.uleb128 .LVU1001
+	.uleb128 .LVU1001
+	.uleb128 .LVU1002
+	.uleb128 .LVU1015
+	.uleb128 .LVU1019
+	.uleb128 .LVU1019
+	.uleb128 .LVU1020
+	.uleb128 .LVU1033
+	.uleb128 .LVU1037
+	.uleb128 .LVU1037
+	.uleb128 .LVU1038
+	.uleb128 .LVU1051
+	.uleb128 .LVU1054
+	.uleb128 .LVU1054
+	.uleb128 .LVU1056
+	.uleb128 .LVU1189
+	.uleb128 .LVU1191
+	.uleb128 .LVU1204
+	.uleb128 .LVU1206
+	.uleb128 .LVU1219
+	.uleb128 .LVU1221
+	.uleb128 .LVU1234
+	.uleb128 .LVU1236
+	.uleb128 .LVU1249
+	.uleb128 .LVU1251
+	.uleb128 .LVU1264
+	.uleb128 .LVU1266
+	.uleb128 .LVU1279
+	.uleb128 .LVU1281
+.LLST91:
+	.byte	0x6
+	.quad	.LVL149
+	.byte	0x4
+	.uleb128 .LVL149-.LVL149
+	.uleb128 .LVL150-.LVL149
+	.uleb128 0x11
+	.byte	0x91
+	.sleb128 -608
+	.byte	0x6
+	.byte	0x6
+	.byte	0x23
+	.uleb128 0x840
+	.byte	0x94
+	.byte	0x4
+	.byte	0xc
+	.long	0xffffffff
+	.byte	0x1a
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL150-.LVL149
+	.uleb128 .LVL150-.LVL149
+	.uleb128 0xc
+	.byte	0x73
+	.sleb128 2112
+	.byte	0x94
+	.byte	0x4
+	.byte	0xc
+	.long	0xffffffff
+	.byte	0x1a
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL150-.LVL149
+	.uleb128 .LVL150-.LVL149
+	.uleb128 0x4
+	.byte	0x70
+	.sleb128 -512
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL152-.LVL149
+	.uleb128 .LVL153-.LVL149
+	.uleb128 0xc
+	.byte	0x73
+	.sleb128 2112
+	.byte	0x94
+	.byte	0x4
+	.byte	0xc
+	.long	0xffffffff
+	.byte	0x1a
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL153-.LVL149
+	.uleb128 .LVL153-.LVL149
+	.uleb128 0x4
+	.byte	0x70
+	.sleb128 -576
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL155-.LVL149
+	.uleb128 .LVL156-.LVL149
+	.uleb128 0xc
+	.byte	0x73
+	.sleb128 2112
+	.byte	0x94
+	.byte	0x4
+	.byte	0xc
+	.long	0xffffffff
+	.byte	0x1a
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL156-.LVL149
+	.uleb128 .LVL156-.LVL149
+	.uleb128 0x4
+	.byte	0x70
+	.sleb128 -640
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL158-.LVL149
+	.uleb128 .LVL159-.LVL149
+	.uleb128 0xc
+	.byte	0x73
+	.sleb128 2112
+	.byte	0x94
+	.byte	0x4
+	.byte	0xc
+	.long	0xffffffff
+	.byte	0x1a
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL159-.LVL149
+	.uleb128 .LVL159-.LVL149
+	.uleb128 0x4
+	.byte	0x70
+	.sleb128 -704
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL161-.LVL149
+	.uleb128 .LVL162-.LVL149
+	.uleb128 0xc
+	.byte	0x73
+	.sleb128 2112
+	.byte	0x94
+	.byte	0x4
+	.byte	0xc
+	.long	0xffffffff
+	.byte	0x1a
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL162-.LVL149
+	.uleb128 .LVL162-.LVL149
+	.uleb128 0x4
+	.byte	0x70
+	.sleb128 -768
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL164-.LVL149
+	.uleb128 .LVL165-.LVL149
+	.uleb128 0xc
+	.byte	0x73
+	.sleb128 2112
+	.byte	0x94
+	.byte	0x4
+	.byte	0xc
+	.long	0xffffffff
+	.byte	0x1a
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL165-.LVL149
+	.uleb128 .LVL165-.LVL149
+	.uleb128 0x4
+	.byte	0x70
+	.sleb128 -832
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL167-.LVL149
+	.uleb128 .LVL168-.LVL149
+	.uleb128 0xc
+	.byte	0x73
+	.sleb128 2112
+	.byte	0x94
+	.byte	0x4
+	.byte	0xc
+	.long	0xffffffff
+	.byte	0x1a
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL168-.LVL149
+	.uleb128 .LVL168-.LVL149
+	.uleb128 0x4
+	.byte	0x70
+	.sleb128 -896
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL170-.LVL149
+	.uleb128 .LVL171-.LVL149
+	.uleb128 0xb
+	.byte	0x71
+	.sleb128 0
+	.byte	0x94
+	.byte	0x4
+	.byte	0xc
+	.long	0xffffffff
+	.byte	0x1a
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL171-.LVL149
+	.uleb128 .LVL172-.LVL149
+	.uleb128 0xd
+	.byte	0x91
+	.sleb128 -88
+	.byte	0x6
+	.byte	0x94
+	.byte	0x4
+	.byte	0xc
+	.long	0xffffffff
+	.byte	0x1a
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL196-.LVL149
+	.uleb128 .LVL196-.LVL149
+	.uleb128 0xc
+	.byte	0x73
+	.sleb128 2112
+	.byte	0x94
+	.byte	0x4
+	.byte	0xc
+	.long	0xffffffff
+	.byte	0x1a
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL198-.LVL149
+	.uleb128 .LVL198-.LVL149
+	.uleb128 0xc
+	.byte	0x73
+	.sleb128 2112
+	.byte	0x94
+	.byte	0x4
+	.byte	0xc
+	.long	0xffffffff
+	.byte	0x1a
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL200-.LVL149
+	.uleb128 .LVL200-.LVL149
+	.uleb128 0xc
+	.byte	0x73
+	.sleb128 2112
+	.byte	0x94
+	.byte	0x4
+	.byte	0xc
+	.long	0xffffffff
+	.byte	0x1a
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL202-.LVL149
+	.uleb128 .LVL202-.LVL149
+	.uleb128 0xc
+	.byte	0x73
+	.sleb128 2112
+	.byte	0x94
+	.byte	0x4
+	.byte	0xc
+	.long	0xffffffff
+	.byte	0x1a
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL204-.LVL149
+	.uleb128 .LVL204-.LVL149
+	.uleb128 0xc
+	.byte	0x73
+	.sleb128 2112
+	.byte	0x94
+	.byte	0x4
+	.byte	0xc
+	.long	0xffffffff
+	.byte	0x1a
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL206-.LVL149
+	.uleb128 .LVL206-.LVL149
+	.uleb128 0xc
+	.byte	0x73
+	.sleb128 2112
+	.byte	0x94
+	.byte	0x4
+	.byte	0xc
+	.long	0xffffffff
+	.byte	0x1a
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL208-.LVL149
+	.uleb128 .LVL208-.LVL149
+	.uleb128 0xc
+	.byte	0x73
+	.sleb128 2112
+	.byte	0x94
+	.byte	0x4
+	.byte	0xc
+	.long	0xffffffff
+	.byte	0x1a
+	.byte	0x9f
+	.byte	0
+.LVUS73:
+	.uleb128 0
+	.uleb128 .LVU678
+	.uleb128 .LVU678
+	.uleb128 .LVU719
+	.uleb128 .LVU719
+	.uleb128 .LVU720
+	.uleb128 .LVU720
+	.uleb128 0
+.LLST73:
+	.byte	0x6
+	.quad	.LVL96
+	.byte	0x4
+	.uleb128 .LVL96-.LVL96
+	.uleb128 .LVL99-.LVL96
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL99-.LVL96
+	.uleb128 .LVL109-.LVL96
+	.uleb128 0x1
+	.byte	0x5f
+	.byte	0x4
+	.uleb128 .LVL109-.LVL96
+	.uleb128 .LVL110-.LVL96
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL110-.LVL96
+	.uleb128 .LFE22-.LVL96
+	.uleb128 0x1
+	.byte	0x5f
+	.byte	0
+.LVUS74:
+	.uleb128 0
+	.uleb128 .LVU678
+	.uleb128 .LVU678
+	.uleb128 0
+.LLST74:
+	.byte	0x6
+	.quad	.LVL96
+	.byte	0x4
+	.uleb128 .LVL96-.LVL96
+	.uleb128 .LVL99-.LVL96
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x4
+	.uleb128 .LVL99-.LVL96
+	.uleb128 .LFE22-.LVL96
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x9f
+	.byte	0
+.LVUS75:
+	.uleb128 0
+	.uleb128 .LVU674
+	.uleb128 .LVU674
+	.uleb128 .LVU717
+	.uleb128 .LVU720
+	.uleb128 0
+.LLST75:
+	.byte	0x6
+	.quad	.LVL96
+	.byte	0x4
+	.uleb128 .LVL96-.LVL96
+	.uleb128 .LVL98-.LVL96
+	.uleb128 0x1
+	.byte	0x51
+	.byte	0x4
+	.uleb128 .LVL98-.LVL96
+	.uleb128 .LVL107-.LVL96
+	.uleb128 0x1
+	.byte	0x56
+	.byte	0x4
+	.uleb128 .LVL110-.LVL96
+	.uleb128 .LFE22-.LVL96
+	.uleb128 0x1
+	.byte	0x56
+	.byte	0
+.LVUS76:
+	.uleb128 .LVU665
+	.uleb128 .LVU678
+	.uleb128 .LVU678
+	.uleb128 .LVU718
+	.uleb128 .LVU720
+	.uleb128 0
+.LLST76:
+	.byte	0x6
+	.quad	.LVL97
+	.byte	0x4
+	.uleb128 .LVL97-.LVL97
+	.uleb128 .LVL99-.LVL97
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x4
+	.uleb128 .LVL99-.LVL97
+	.uleb128 .LVL108-.LVL97
+	.uleb128 0x1
+	.byte	0x5c
+	.byte	0x4
+	.uleb128 .LVL110-.LVL97
+	.uleb128 .LFE22-.LVL97
+	.uleb128 0x1
+	.byte	0x5c
+	.byte	0
+.LVUS78:
+	.uleb128 .LVU699
+	.uleb128 .LVU708
+	.uleb128 .LVU734
+	.uleb128 0
+.LLST78:
+	.byte	0x6
+	.quad	.LVL102
+	.byte	0x4
+	.uleb128 .LVL102-.LVL102
+	.uleb128 .LVL105-.LVL102
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL116-.LVL102
+	.uleb128 .LFE22-.LVL102
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0
+.LVUS79:
+	.uleb128 .LVU725
+	.uleb128 .LVU727
+	.uleb128 .LVU727
+	.uleb128 .LVU728
+	.uleb128 .LVU728
+	.uleb128 .LVU732
+.LLST79:
+	.byte	0x6
+	.quad	.LVL111
+	.byte	0x4
+	.uleb128 .LVL111-.LVL111
+	.uleb128 .LVL112-.LVL111
+	.uleb128 0x1
+	.byte	0x5d
+	.byte	0x4
+	.uleb128 .LVL112-.LVL111
+	.uleb128 .LVL113-1-.LVL111
+	.uleb128 0x1
+	.byte	0x51
+	.byte	0x4
+	.uleb128 .LVL113-1-.LVL111
+	.uleb128 .LVL115-.LVL111
+	.uleb128 0x8
+	.byte	0x76
+	.sleb128 -961
+	.byte	0x39
+	.byte	0x25
+	.byte	0x23
+	.uleb128 0x1
+	.byte	0x9f
+	.byte	0
+.LVUS0:
+	.uleb128 0
+	.uleb128 .LVU219
+	.uleb128 .LVU219
+	.uleb128 .LVU396
+	.uleb128 .LVU396
+	.uleb128 .LVU398
+	.uleb128 .LVU398
+	.uleb128 0
+.LLST0:
+	.byte	0x6
+	.quad	.LVL0
+	.byte	0x4
+	.uleb128 .LVL0-.LVL0
+	.uleb128 .LVL18-.LVL0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL18-.LVL0
+	.uleb128 .LVL31-.LVL0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0x4
+	.uleb128 .LVL31-.LVL0
+	.uleb128 .LVL33-.LVL0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL33-.LVL0
+	.uleb128 .LFE21-.LVL0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0
+.LVUS1:
+	.uleb128 0
+	.uleb128 .LVU219
+	.uleb128 .LVU219
+	.uleb128 .LVU249
+	.uleb128 .LVU249
+	.uleb128 .LVU323
+	.uleb128 .LVU323
+	.uleb128 .LVU325
+	.uleb128 .LVU325
+	.uleb128 .LVU397
+	.uleb128 .LVU398
+	.uleb128 .LVU410
+	.uleb128 .LVU410
+	.uleb128 0
+.LLST1:
+	.byte	0x6
+	.quad	.LVL0
+	.byte	0x4
+	.uleb128 .LVL0-.LVL0
+	.uleb128 .LVL18-.LVL0
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x4
+	.uleb128 .LVL18-.LVL0
+	.uleb128 .LVL22-.LVL0
+	.uleb128 0x1
+	.byte	0x5c
+	.byte	0x4
+	.uleb128 .LVL22-.LVL0
+	.uleb128 .LVL25-1-.LVL0
+	.uleb128 0x3
+	.byte	0x77
+	.sleb128 576
+	.byte	0x4
+	.uleb128 .LVL25-1-.LVL0
+	.uleb128 .LVL25-.LVL0
+	.uleb128 0x4
+	.byte	0x7c
+	.sleb128 -512
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL25-.LVL0
+	.uleb128 .LVL32-.LVL0
+	.uleb128 0x1
+	.byte	0x5c
+	.byte	0x4
+	.uleb128 .LVL33-.LVL0
+	.uleb128 .LVL35-.LVL0
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x4
+	.uleb128 .LVL35-.LVL0
+	.uleb128 .LFE21-.LVL0
+	.uleb128 0x1
+	.byte	0x5c
+	.byte	0
+.LVUS2:
+	.uleb128 0
+	.uleb128 .LVU219
+	.uleb128 .LVU219
+	.uleb128 .LVU221
+	.uleb128 .LVU221
+	.uleb128 .LVU222
+	.uleb128 .LVU398
+	.uleb128 .LVU409
+	.uleb128 .LVU409
+	.uleb128 0
+.LLST2:
+	.byte	0x6
+	.quad	.LVL0
+	.byte	0x4
+	.uleb128 .LVL0-.LVL0
+	.uleb128 .LVL18-.LVL0
+	.uleb128 0x1
+	.byte	0x51
+	.byte	0x4
+	.uleb128 .LVL18-.LVL0
+	.uleb128 .LVL19-.LVL0
+	.uleb128 0x1
+	.byte	0x5d
+	.byte	0x4
+	.uleb128 .LVL19-.LVL0
+	.uleb128 .LVL20-.LVL0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x51
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL33-.LVL0
+	.uleb128 .LVL34-.LVL0
+	.uleb128 0x1
+	.byte	0x51
+	.byte	0x4
+	.uleb128 .LVL34-.LVL0
+	.uleb128 .LFE21-.LVL0
+	.uleb128 0x1
+	.byte	0x5d
+	.byte	0
+.LVUS4:
+	.uleb128 .LVU5
+	.uleb128 .LVU6
+	.uleb128 .LVU68
+	.uleb128 .LVU99
+	.uleb128 .LVU99
+	.uleb128 .LVU131
+	.uleb128 .LVU131
+	.uleb128 .LVU163
+	.uleb128 .LVU163
+	.uleb128 .LVU216
+	.uleb128 .LVU216
+	.uleb128 0
+.LLST4:
+	.byte	0x6
+	.quad	.LVL0
+	.byte	0x4
+	.uleb128 .LVL0-.LVL0
+	.uleb128 .LVL0-.LVL0
+	.uleb128 0x2
+	.byte	0x30
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL8-.LVL0
+	.uleb128 .LVL8-.LVL0
+	.uleb128 0x2
+	.byte	0x34
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL8-.LVL0
+	.uleb128 .LVL8-.LVL0
+	.uleb128 0x2
+	.byte	0x35
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL8-.LVL0
+	.uleb128 .LVL8-.LVL0
+	.uleb128 0x2
+	.byte	0x36
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL8-.LVL0
+	.uleb128 .LVL17-.LVL0
+	.uleb128 0x2
+	.byte	0x37
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL17-.LVL0
+	.uleb128 .LFE21-.LVL0
+	.uleb128 0x2
+	.byte	0x38
+	.byte	0x9f
+	.byte	0
+.LVUS7:
+	.uleb128 .LVU6
+	.uleb128 .LVU12
+	.uleb128 .LVU12
+	.uleb128 .LVU17
+	.uleb128 .LVU17
+	.uleb128 .LVU22
+	.uleb128 .LVU22
+	.uleb128 .LVU27
+	.uleb128 .LVU27
+	.uleb128 .LVU34
+	.uleb128 .LVU34
+	.uleb128 .LVU37
+	.uleb128 .LVU37
+	.uleb128 .LVU42
+	.uleb128 .LVU42
+	.uleb128 .LVU49
+	.uleb128 .LVU49
+	.uleb128 .LVU65
+	.uleb128 .LVU68
+	.uleb128 .LVU71
+	.uleb128 .LVU71
+	.uleb128 .LVU74
+	.uleb128 .LVU74
+	.uleb128 .LVU77
+	.uleb128 .LVU77
+	.uleb128 .LVU80
+	.uleb128 .LVU80
+	.uleb128 .LVU83
+	.uleb128 .LVU83
+	.uleb128 .LVU86
+	.uleb128 .LVU86
+	.uleb128 .LVU89
+	.uleb128 .LVU89
+	.uleb128 .LVU92
+	.uleb128 .LVU92
+	.uleb128 .LVU97
+	.uleb128 .LVU100
+	.uleb128 .LVU103
+	.uleb128 .LVU103
+	.uleb128 .LVU106
+	.uleb128 .LVU106
+	.uleb128 .LVU109
+	.uleb128 .LVU109
+	.uleb128 .LVU112
+	.uleb128 .LVU112
+	.uleb128 .LVU115
+	.uleb128 .LVU115
+	.uleb128 .LVU118
+	.uleb128 .LVU118
+	.uleb128 .LVU121
+	.uleb128 .LVU121
+	.uleb128 .LVU124
+	.uleb128 .LVU124
+	.uleb128 .LVU129
+	.uleb128 .LVU132
+	.uleb128 .LVU135
+	.uleb128 .LVU135
+	.uleb128 .LVU138
+	.uleb128 .LVU138
+	.uleb128 .LVU141
+	.uleb128 .LVU141
+	.uleb128 .LVU144
+	.uleb128 .LVU144
+	.uleb128 .LVU147
+	.uleb128 .LVU147
+	.uleb128 .LVU150
+	.uleb128 .LVU150
+	.uleb128 .LVU153
+	.uleb128 .LVU153
+	.uleb128 .LVU156
+	.uleb128 .LVU156
+	.uleb128 .LVU161
+	.uleb128 .LVU164
+	.uleb128 .LVU168
+	.uleb128 .LVU168
+	.uleb128 .LVU172
+	.uleb128 .LVU172
+	.uleb128 .LVU176
+	.uleb128 .LVU176
+	.uleb128 .LVU180
+	.uleb128 .LVU180
+	.uleb128 .LVU186
+	.uleb128 .LVU186
+	.uleb128 .LVU190
+	.uleb128 .LVU190
+	.uleb128 .LVU194
+	.uleb128 .LVU194
+	.uleb128 .LVU198
+	.uleb128 .LVU198
+	.uleb128 .LVU214
+.LLST7:
+	.byte	0x6
+	.quad	.LVL0
+	.byte	0x4
+	.uleb128 .LVL0-.LVL0
+	.uleb128 .LVL1-.LVL0
+	.uleb128 0x2
+	.byte	0x30
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL1-.LVL0
+	.uleb128 .LVL2-.LVL0
+	.uleb128 0x2
+	.byte	0x31
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL2-.LVL0
+	.uleb128 .LVL3-.LVL0
+	.uleb128 0x2
+	.byte	0x32
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL3-.LVL0
+	.uleb128 .LVL4-.LVL0
+	.uleb128 0x2
+	.byte	0x33
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL4-.LVL0
+	.uleb128 .LVL5-.LVL0
+	.uleb128 0x2
+	.byte	0x34
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL5-.LVL0
+	.uleb128 .LVL5-.LVL0
+	.uleb128 0x2
+	.byte	0x35
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL5-.LVL0
+	.uleb128 .LVL6-.LVL0
+	.uleb128 0x2
+	.byte	0x36
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL6-.LVL0
+	.uleb128 .LVL7-.LVL0
+	.uleb128 0x2
+	.byte	0x37
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL7-.LVL0
+	.uleb128 .LVL8-.LVL0
+	.uleb128 0x2
+	.byte	0x38
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL8-.LVL0
+	.uleb128 .LVL8-.LVL0
+	.uleb128 0x2
+	.byte	0x30
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL8-.LVL0
+	.uleb128 .LVL8-.LVL0
+	.uleb128 0x2
+	.byte	0x31
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL8-.LVL0
+	.uleb128 .LVL8-.LVL0
+	.uleb128 0x2
+	.byte	0x32
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL8-.LVL0
+	.uleb128 .LVL8-.LVL0
+	.uleb128 0x2
+	.byte	0x33
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL8-.LVL0
+	.uleb128 .LVL8-.LVL0
+	.uleb128 0x2
+	.byte	0x34
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL8-.LVL0
+	.uleb128 .LVL8-.LVL0
+	.uleb128 0x2
+	.byte	0x35
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL8-.LVL0
+	.uleb128 .LVL8-.LVL0
+	.uleb128 0x2
+	.byte	0x36
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL8-.LVL0
+	.uleb128 .LVL8-.LVL0
+	.uleb128 0x2
+	.byte	0x37
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL8-.LVL0
+	.uleb128 .LVL8-.LVL0
+	.uleb128 0x2
+	.byte	0x38
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL8-.LVL0
+	.uleb128 .LVL8-.LVL0
+	.uleb128 0x2
+	.byte	0x30
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL8-.LVL0
+	.uleb128 .LVL8-.LVL0
+	.uleb128 0x2
+	.byte	0x31
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL8-.LVL0
+	.uleb128 .LVL8-.LVL0
+	.uleb128 0x2
+	.byte	0x32
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL8-.LVL0
+	.uleb128 .LVL8-.LVL0
+	.uleb128 0x2
+	.byte	0x33
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL8-.LVL0
+	.uleb128 .LVL8-.LVL0
+	.uleb128 0x2
+	.byte	0x34
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL8-.LVL0
+	.uleb128 .LVL8-.LVL0
+	.uleb128 0x2
+	.byte	0x35
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL8-.LVL0
+	.uleb128 .LVL8-.LVL0
+	.uleb128 0x2
+	.byte	0x36
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL8-.LVL0
+	.uleb128 .LVL8-.LVL0
+	.uleb128 0x2
+	.byte	0x37
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL8-.LVL0
+	.uleb128 .LVL8-.LVL0
+	.uleb128 0x2
+	.byte	0x38
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL8-.LVL0
+	.uleb128 .LVL8-.LVL0
+	.uleb128 0x2
+	.byte	0x30
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL8-.LVL0
+	.uleb128 .LVL8-.LVL0
+	.uleb128 0x2
+	.byte	0x31
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL8-.LVL0
+	.uleb128 .LVL8-.LVL0
+	.uleb128 0x2
+	.byte	0x32
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL8-.LVL0
+	.uleb128 .LVL8-.LVL0
+	.uleb128 0x2
+	.byte	0x33
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL8-.LVL0
+	.uleb128 .LVL8-.LVL0
+	.uleb128 0x2
+	.byte	0x34
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL8-.LVL0
+	.uleb128 .LVL8-.LVL0
+	.uleb128 0x2
+	.byte	0x35
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL8-.LVL0
+	.uleb128 .LVL8-.LVL0
+	.uleb128 0x2
+	.byte	0x36
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL8-.LVL0
+	.uleb128 .LVL8-.LVL0
+	.uleb128 0x2
+	.byte	0x37
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL8-.LVL0
+	.uleb128 .LVL8-.LVL0
+	.uleb128 0x2
+	.byte	0x38
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL8-.LVL0
+	.uleb128 .LVL9-.LVL0
+	.uleb128 0x2
+	.byte	0x30
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL9-.LVL0
+	.uleb128 .LVL10-.LVL0
+	.uleb128 0x2
+	.byte	0x31
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL10-.LVL0
+	.uleb128 .LVL11-.LVL0
+	.uleb128 0x2
+	.byte	0x32
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL11-.LVL0
+	.uleb128 .LVL12-.LVL0
+	.uleb128 0x2
+	.byte	0x33
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL12-.LVL0
+	.uleb128 .LVL13-.LVL0
+	.uleb128 0x2
+	.byte	0x34
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL13-.LVL0
+	.uleb128 .LVL14-.LVL0
+	.uleb128 0x2
+	.byte	0x35
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL14-.LVL0
+	.uleb128 .LVL15-.LVL0
+	.uleb128 0x2
+	.byte	0x36
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL15-.LVL0
+	.uleb128 .LVL16-.LVL0
+	.uleb128 0x2
+	.byte	0x37
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL16-.LVL0
+	.uleb128 .LVL17-.LVL0
+	.uleb128 0x2
+	.byte	0x38
+	.byte	0x9f
+	.byte	0
+.LVUS23:
+	.uleb128 .LVU430
+	.uleb128 .LVU444
+	.uleb128 .LVU451
+	.uleb128 .LVU455
+.LLST23:
+	.byte	0x6
+	.quad	.LVL36
+	.byte	0x4
+	.uleb128 .LVL36-.LVL36
+	.uleb128 .LVL37-.LVL36
+	.uleb128 0x3
+	.byte	0x8
+	.byte	0x40
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL38-.LVL36
+	.uleb128 .LVL39-.LVL36
+	.uleb128 0x3
+	.byte	0x8
+	.byte	0x40
+	.byte	0x9f
+	.byte	0
+.LVUS24:
+	.uleb128 .LVU430
+	.uleb128 .LVU444
+	.uleb128 .LVU451
+	.uleb128 .LVU455
+.LLST24:
+	.byte	0x6
+	.quad	.LVL36
+	.byte	0x4
+	.uleb128 .LVL36-.LVL36
+	.uleb128 .LVL37-.LVL36
+	.uleb128 0x1
+	.byte	0x5f
+	.byte	0x4
+	.uleb128 .LVL38-.LVL36
+	.uleb128 .LVL39-.LVL36
+	.uleb128 0x1
+	.byte	0x5f
+	.byte	0
+.LVUS9:
+	.uleb128 .LVU222
+	.uleb128 .LVU262
+	.uleb128 .LVU262
+	.uleb128 .LVU270
+	.uleb128 .LVU270
+	.uleb128 .LVU278
+	.uleb128 .LVU278
+	.uleb128 .LVU286
+	.uleb128 .LVU286
+	.uleb128 .LVU294
+	.uleb128 .LVU294
+	.uleb128 .LVU302
+	.uleb128 .LVU302
+	.uleb128 .LVU310
+	.uleb128 .LVU310
+	.uleb128 .LVU319
+	.uleb128 .LVU319
+	.uleb128 .LVU398
+.LLST9:
+	.byte	0x6
+	.quad	.LVL20
+	.byte	0x4
+	.uleb128 .LVL20-.LVL20
+	.uleb128 .LVL23-.LVL20
+	.uleb128 0x2
+	.byte	0x30
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL23-.LVL20
+	.uleb128 .LVL23-.LVL20
+	.uleb128 0x2
+	.byte	0x31
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL23-.LVL20
+	.uleb128 .LVL23-.LVL20
+	.uleb128 0x2
+	.byte	0x32
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL23-.LVL20
+	.uleb128 .LVL23-.LVL20
+	.uleb128 0x2
+	.byte	0x33
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL23-.LVL20
+	.uleb128 .LVL23-.LVL20
+	.uleb128 0x2
+	.byte	0x34
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL23-.LVL20
+	.uleb128 .LVL23-.LVL20
+	.uleb128 0x2
+	.byte	0x35
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL23-.LVL20
+	.uleb128 .LVL23-.LVL20
+	.uleb128 0x2
+	.byte	0x36
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL23-.LVL20
+	.uleb128 .LVL24-.LVL20
+	.uleb128 0x2
+	.byte	0x37
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL24-.LVL20
+	.uleb128 .LVL33-.LVL20
+	.uleb128 0x2
+	.byte	0x38
+	.byte	0x9f
+	.byte	0
+.LVUS11:
+	.uleb128 .LVU241
+	.uleb128 .LVU260
+	.uleb128 .LVU265
+	.uleb128 .LVU268
+	.uleb128 .LVU273
+	.uleb128 .LVU276
+	.uleb128 .LVU281
+	.uleb128 .LVU284
+	.uleb128 .LVU289
+	.uleb128 .LVU292
+	.uleb128 .LVU297
+	.uleb128 .LVU300
+	.uleb128 .LVU305
+	.uleb128 .LVU308
+	.uleb128 .LVU313
+	.uleb128 .LVU317
+.LLST11:
+	.byte	0x6
+	.quad	.LVL21
+	.byte	0x4
+	.uleb128 .LVL21-.LVL21
+	.uleb128 .LVL23-.LVL21
+	.uleb128 0x3
+	.byte	0x8
+	.byte	0x40
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL23-.LVL21
+	.uleb128 .LVL23-.LVL21
+	.uleb128 0x3
+	.byte	0x8
+	.byte	0x40
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL23-.LVL21
+	.uleb128 .LVL23-.LVL21
+	.uleb128 0x3
+	.byte	0x8
+	.byte	0x40
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL23-.LVL21
+	.uleb128 .LVL23-.LVL21
+	.uleb128 0x3
+	.byte	0x8
+	.byte	0x40
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL23-.LVL21
+	.uleb128 .LVL23-.LVL21
+	.uleb128 0x3
+	.byte	0x8
+	.byte	0x40
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL23-.LVL21
+	.uleb128 .LVL23-.LVL21
+	.uleb128 0x3
+	.byte	0x8
+	.byte	0x40
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL23-.LVL21
+	.uleb128 .LVL23-.LVL21
+	.uleb128 0x3
+	.byte	0x8
+	.byte	0x40
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL23-.LVL21
+	.uleb128 .LVL24-.LVL21
+	.uleb128 0x3
+	.byte	0x8
+	.byte	0x40
+	.byte	0x9f
+	.byte	0
+.LVUS12:
+	.uleb128 .LVU241
+	.uleb128 .LVU260
+	.uleb128 .LVU265
+	.uleb128 .LVU268
+	.uleb128 .LVU273
+	.uleb128 .LVU276
+	.uleb128 .LVU281
+	.uleb128 .LVU284
+	.uleb128 .LVU289
+	.uleb128 .LVU292
+	.uleb128 .LVU297
+	.uleb128 .LVU300
+	.uleb128 .LVU305
+	.uleb128 .LVU308
+	.uleb128 .LVU313
+	.uleb128 .LVU317
+.LLST12:
+	.byte	0x6
+	.quad	.LVL21
+	.byte	0x4
+	.uleb128 .LVL21-.LVL21
+	.uleb128 .LVL23-.LVL21
+	.uleb128 0x2
+	.byte	0x30
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL23-.LVL21
+	.uleb128 .LVL23-.LVL21
+	.uleb128 0x2
+	.byte	0x31
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL23-.LVL21
+	.uleb128 .LVL23-.LVL21
+	.uleb128 0x2
+	.byte	0x32
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL23-.LVL21
+	.uleb128 .LVL23-.LVL21
+	.uleb128 0x2
+	.byte	0x33
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL23-.LVL21
+	.uleb128 .LVL23-.LVL21
+	.uleb128 0x2
+	.byte	0x34
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL23-.LVL21
+	.uleb128 .LVL23-.LVL21
+	.uleb128 0x2
+	.byte	0x35
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL23-.LVL21
+	.uleb128 .LVL23-.LVL21
+	.uleb128 0x2
+	.byte	0x36
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL23-.LVL21
+	.uleb128 .LVL24-.LVL21
+	.uleb128 0x2
+	.byte	0x37
+	.byte	0x9f
+	.byte	0
+.LVUS13:
+	.uleb128 .LVU241
+	.uleb128 .LVU260
+	.uleb128 .LVU265
+	.uleb128 .LVU268
+	.uleb128 .LVU273
+	.uleb128 .LVU276
+	.uleb128 .LVU281
+	.uleb128 .LVU284
+	.uleb128 .LVU289
+	.uleb128 .LVU292
+	.uleb128 .LVU297
+	.uleb128 .LVU300
+	.uleb128 .LVU305
+	.uleb128 .LVU308
+	.uleb128 .LVU313
+	.uleb128 .LVU317
+.LLST13:
+	.byte	0x6
+	.quad	.LVL21
+	.byte	0x4
+	.uleb128 .LVL21-.LVL21
+	.uleb128 .LVL23-.LVL21
+	.uleb128 0x4
+	.byte	0x77
+	.sleb128 640
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL23-.LVL21
+	.uleb128 .LVL23-.LVL21
+	.uleb128 0x4
+	.byte	0x77
+	.sleb128 640
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL23-.LVL21
+	.uleb128 .LVL23-.LVL21
+	.uleb128 0x4
+	.byte	0x77
+	.sleb128 640
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL23-.LVL21
+	.uleb128 .LVL23-.LVL21
+	.uleb128 0x4
+	.byte	0x77
+	.sleb128 640
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL23-.LVL21
+	.uleb128 .LVL23-.LVL21
+	.uleb128 0x4
+	.byte	0x77
+	.sleb128 640
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL23-.LVL21
+	.uleb128 .LVL23-.LVL21
+	.uleb128 0x4
+	.byte	0x77
+	.sleb128 640
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL23-.LVL21
+	.uleb128 .LVL23-.LVL21
+	.uleb128 0x4
+	.byte	0x77
+	.sleb128 640
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL23-.LVL21
+	.uleb128 .LVL24-.LVL21
+	.uleb128 0x4
+	.byte	0x77
+	.sleb128 640
+	.byte	0x9f
+	.byte	0
+.LVUS20:
+	.uleb128 .LVU326
+	.uleb128 .LVU329
+	.uleb128 .LVU329
+	.uleb128 .LVU332
+	.uleb128 .LVU332
+	.uleb128 .LVU335
+	.uleb128 .LVU335
+	.uleb128 .LVU338
+	.uleb128 .LVU338
+	.uleb128 .LVU341
+	.uleb128 .LVU341
+	.uleb128 .LVU344
+	.uleb128 .LVU344
+	.uleb128 .LVU347
+	.uleb128 .LVU347
+	.uleb128 .LVU351
+	.uleb128 .LVU351
+	.uleb128 .LVU357
+	.uleb128 .LVU360
+	.uleb128 .LVU363
+	.uleb128 .LVU363
+	.uleb128 .LVU366
+	.uleb128 .LVU366
+	.uleb128 .LVU369
+	.uleb128 .LVU369
+	.uleb128 .LVU372
+	.uleb128 .LVU372
+	.uleb128 .LVU375
+	.uleb128 .LVU375
+	.uleb128 .LVU378
+	.uleb128 .LVU378
+	.uleb128 .LVU381
+	.uleb128 .LVU381
+	.uleb128 .LVU385
+	.uleb128 .LVU385
+	.uleb128 .LVU391
+.LLST20:
+	.byte	0x6
+	.quad	.LVL26
+	.byte	0x4
+	.uleb128 .LVL26-.LVL26
+	.uleb128 .LVL26-.LVL26
+	.uleb128 0x2
+	.byte	0x30
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL26-.LVL26
+	.uleb128 .LVL26-.LVL26
+	.uleb128 0x2
+	.byte	0x31
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL26-.LVL26
+	.uleb128 .LVL26-.LVL26
+	.uleb128 0x2
+	.byte	0x32
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL26-.LVL26
+	.uleb128 .LVL26-.LVL26
+	.uleb128 0x2
+	.byte	0x33
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL26-.LVL26
+	.uleb128 .LVL26-.LVL26
+	.uleb128 0x2
+	.byte	0x34
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL26-.LVL26
+	.uleb128 .LVL26-.LVL26
+	.uleb128 0x2
+	.byte	0x35
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL26-.LVL26
+	.uleb128 .LVL26-.LVL26
+	.uleb128 0x2
+	.byte	0x36
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL26-.LVL26
+	.uleb128 .LVL27-.LVL26
+	.uleb128 0x2
+	.byte	0x37
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL27-.LVL26
+	.uleb128 .LVL28-.LVL26
+	.uleb128 0x2
+	.byte	0x38
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL28-.LVL26
+	.uleb128 .LVL28-.LVL26
+	.uleb128 0x2
+	.byte	0x30
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL28-.LVL26
+	.uleb128 .LVL28-.LVL26
+	.uleb128 0x2
+	.byte	0x31
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL28-.LVL26
+	.uleb128 .LVL28-.LVL26
+	.uleb128 0x2
+	.byte	0x32
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL28-.LVL26
+	.uleb128 .LVL28-.LVL26
+	.uleb128 0x2
+	.byte	0x33
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL28-.LVL26
+	.uleb128 .LVL28-.LVL26
+	.uleb128 0x2
+	.byte	0x34
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL28-.LVL26
+	.uleb128 .LVL28-.LVL26
+	.uleb128 0x2
+	.byte	0x35
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL28-.LVL26
+	.uleb128 .LVL28-.LVL26
+	.uleb128 0x2
+	.byte	0x36
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL28-.LVL26
+	.uleb128 .LVL29-.LVL26
+	.uleb128 0x2
+	.byte	0x37
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL29-.LVL26
+	.uleb128 .LVL30-.LVL26
+	.uleb128 0x2
+	.byte	0x38
+	.byte	0x9f
+	.byte	0
+.LVUS15:
+	.uleb128 .LVU321
+	.uleb128 .LVU323
+.LLST15:
+	.byte	0x8
+	.quad	.LVL24
+	.uleb128 .LVL25-.LVL24
+	.uleb128 0x3
+	.byte	0x8
+	.byte	0xff
+	.byte	0x9f
+	.byte	0
+.LVUS16:
+	.uleb128 .LVU321
+	.uleb128 .LVU323
+.LLST16:
+	.byte	0x8
+	.quad	.LVL24
+	.uleb128 .LVL25-.LVL24
+	.uleb128 0x4
+	.byte	0x77
+	.sleb128 576
+	.byte	0x9f
+	.byte	0
+.LVUS17:
+	.uleb128 .LVU321
+	.uleb128 .LVU323
+.LLST17:
+	.byte	0x8
+	.quad	.LVL24
+	.uleb128 .LVL25-.LVL24
+	.uleb128 0x4
+	.byte	0x77
+	.sleb128 640
+	.byte	0x9f
+	.byte	0
+.LVUS26:
+	.uleb128 .LVU459
+	.uleb128 .LVU461
+	.uleb128 .LVU461
+	.uleb128 0
+.LLST26:
+	.byte	0x6
+	.quad	.LVL39
+	.byte	0x4
+	.uleb128 .LVL39-.LVL39
+	.uleb128 .LVL40-1-.LVL39
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x4
+	.uleb128 .LVL40-1-.LVL39
+	.uleb128 .LFE21-.LVL39
+	.uleb128 0x1
+	.byte	0x5e
+	.byte	0
+.LVUS27:
+	.uleb128 .LVU459
+	.uleb128 0
+.LLST27:
+	.byte	0x8
+	.quad	.LVL39
+	.uleb128 .LFE21-.LVL39
+	.uleb128 0x1
+	.byte	0x5f
+	.byte	0
+.LVUS53:
+	.uleb128 0
+	.uleb128 .LVU585
+	.uleb128 .LVU585
+	.uleb128 .LVU612
+	.uleb128 .LVU612
+	.uleb128 .LVU614
+	.uleb128 .LVU614
+	.uleb128 0
+.LLST53:
+	.byte	0x6
+	.quad	.LVL73
+	.byte	0x4
+	.uleb128 .LVL73-.LVL73
+	.uleb128 .LVL77-.LVL73
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL77-.LVL73
+	.uleb128 .LVL84-.LVL73
+	.uleb128 0x1
+	.byte	0x5e
+	.byte	0x4
+	.uleb128 .LVL84-.LVL73
+	.uleb128 .LVL85-.LVL73
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL85-.LVL73
+	.uleb128 .LFE19-.LVL73
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0
+.LVUS54:
+	.uleb128 0
+	.uleb128 .LVU586
+	.uleb128 .LVU586
+	.uleb128 .LVU589
+	.uleb128 .LVU589
+	.uleb128 .LVU612
+	.uleb128 .LVU612
+	.uleb128 .LVU614
+	.uleb128 .LVU614
+	.uleb128 0
+.LLST54:
+	.byte	0x6
+	.quad	.LVL73
+	.byte	0x4
+	.uleb128 .LVL73-.LVL73
+	.uleb128 .LVL78-.LVL73
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x4
+	.uleb128 .LVL78-.LVL73
+	.uleb128 .LVL79-1-.LVL73
+	.uleb128 0x1
+	.byte	0x51
+	.byte	0x4
+	.uleb128 .LVL79-1-.LVL73
+	.uleb128 .LVL84-.LVL73
+	.uleb128 0x1
+	.byte	0x5c
+	.byte	0x4
+	.uleb128 .LVL84-.LVL73
+	.uleb128 .LVL85-.LVL73
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL85-.LVL73
+	.uleb128 .LFE19-.LVL73
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0
+.LVUS55:
+	.uleb128 0
+	.uleb128 .LVU572
+	.uleb128 .LVU572
+	.uleb128 .LVU575
+	.uleb128 .LVU575
+	.uleb128 .LVU583
+	.uleb128 .LVU583
+	.uleb128 0
+.LLST55:
+	.byte	0x6
+	.quad	.LVL73
+	.byte	0x4
+	.uleb128 .LVL73-.LVL73
+	.uleb128 .LVL74-.LVL73
+	.uleb128 0x1
+	.byte	0x51
+	.byte	0x4
+	.uleb128 .LVL74-.LVL73
+	.uleb128 .LVL75-.LVL73
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL75-.LVL73
+	.uleb128 .LVL76-.LVL73
+	.uleb128 0x3
+	.byte	0x71
+	.sleb128 1
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL76-.LVL73
+	.uleb128 .LFE19-.LVL73
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x51
+	.byte	0x9f
+	.byte	0
+.LVUS57:
+	.uleb128 .LVU567
+	.uleb128 .LVU572
+	.uleb128 .LVU572
+	.uleb128 .LVU575
+	.uleb128 .LVU575
+	.uleb128 .LVU583
+	.uleb128 .LVU583
+	.uleb128 .LVU612
+	.uleb128 .LVU614
+	.uleb128 .LVU615
+.LLST57:
+	.byte	0x6
+	.quad	.LVL73
+	.byte	0x4
+	.uleb128 .LVL73-.LVL73
+	.uleb128 .LVL74-.LVL73
+	.uleb128 0x1
+	.byte	0x51
+	.byte	0x4
+	.uleb128 .LVL74-.LVL73
+	.uleb128 .LVL75-.LVL73
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL75-.LVL73
+	.uleb128 .LVL76-.LVL73
+	.uleb128 0x3
+	.byte	0x71
+	.sleb128 1
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL76-.LVL73
+	.uleb128 .LVL84-.LVL73
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x51
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL85-.LVL73
+	.uleb128 .LVL86-.LVL73
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x51
+	.byte	0x9f
+	.byte	0
+.LVUS58:
+	.uleb128 .LVU567
+	.uleb128 .LVU612
+	.uleb128 .LVU614
+	.uleb128 .LVU615
+.LLST58:
+	.byte	0x6
+	.quad	.LVL73
+	.byte	0x4
+	.uleb128 .LVL73-.LVL73
+	.uleb128 .LVL84-.LVL73
+	.uleb128 0x2
+	.byte	0x30
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL85-.LVL73
+	.uleb128 .LVL86-.LVL73
+	.uleb128 0x2
+	.byte	0x30
+	.byte	0x9f
+	.byte	0
+.LVUS60:
+	.uleb128 .LVU567
+	.uleb128 .LVU586
+	.uleb128 .LVU586
+	.uleb128 .LVU589
+	.uleb128 .LVU589
+	.uleb128 .LVU612
+	.uleb128 .LVU614
+	.uleb128 .LVU615
+.LLST60:
+	.byte	0x6
+	.quad	.LVL73
+	.byte	0x4
+	.uleb128 .LVL73-.LVL73
+	.uleb128 .LVL78-.LVL73
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x4
+	.uleb128 .LVL78-.LVL73
+	.uleb128 .LVL79-1-.LVL73
+	.uleb128 0x1
+	.byte	0x51
+	.byte	0x4
+	.uleb128 .LVL79-1-.LVL73
+	.uleb128 .LVL84-.LVL73
+	.uleb128 0x1
+	.byte	0x5c
+	.byte	0x4
+	.uleb128 .LVL85-.LVL73
+	.uleb128 .LVL86-.LVL73
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0
+.LVUS61:
+	.uleb128 .LVU567
+	.uleb128 .LVU585
+	.uleb128 .LVU585
+	.uleb128 .LVU612
+	.uleb128 .LVU614
+	.uleb128 .LVU615
+.LLST61:
+	.byte	0x6
+	.quad	.LVL73
+	.byte	0x4
+	.uleb128 .LVL73-.LVL73
+	.uleb128 .LVL77-.LVL73
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL77-.LVL73
+	.uleb128 .LVL84-.LVL73
+	.uleb128 0x1
+	.byte	0x5e
+	.byte	0x4
+	.uleb128 .LVL85-.LVL73
+	.uleb128 .LVL86-.LVL73
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0
+.LVUS63:
+	.uleb128 .LVU595
+	.uleb128 .LVU596
+	.uleb128 .LVU596
+	.uleb128 .LVU600
+	.uleb128 .LVU600
+	.uleb128 .LVU601
+	.uleb128 .LVU601
+	.uleb128 .LVU605
+	.uleb128 .LVU605
+	.uleb128 .LVU612
+.LLST63:
+	.byte	0x6
+	.quad	.LVL80
+	.byte	0x4
+	.uleb128 .LVL80-.LVL80
+	.uleb128 .LVL80-.LVL80
+	.uleb128 0x2
+	.byte	0x30
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL80-.LVL80
+	.uleb128 .LVL81-.LVL80
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0x4
+	.uleb128 .LVL81-.LVL80
+	.uleb128 .LVL82-1-.LVL80
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -56
+	.byte	0x4
+	.uleb128 .LVL82-1-.LVL80
+	.uleb128 .LVL83-.LVL80
+	.uleb128 0x3
+	.byte	0x73
+	.sleb128 -1
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL83-.LVL80
+	.uleb128 .LVL84-.LVL80
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0
+.LVUS41:
+	.uleb128 0
+	.uleb128 .LVU533
+	.uleb128 .LVU533
+	.uleb128 .LVU546
+	.uleb128 .LVU546
+	.uleb128 .LVU564
+	.uleb128 .LVU564
+	.uleb128 0
+.LLST41:
+	.byte	0x6
+	.quad	.LVL57
+	.byte	0x4
+	.uleb128 .LVL57-.LVL57
+	.uleb128 .LVL60-.LVL57
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL60-.LVL57
+	.uleb128 .LVL67-.LVL57
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0x4
+	.uleb128 .LVL67-.LVL57
+	.uleb128 .LVL72-.LVL57
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -88
+	.byte	0x4
+	.uleb128 .LVL72-.LVL57
+	.uleb128 .LFE18-.LVL57
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0
+.LVUS42:
+	.uleb128 0
+	.uleb128 .LVU537
+	.uleb128 .LVU537
+	.uleb128 .LVU538
+	.uleb128 .LVU538
+	.uleb128 .LVU562
+	.uleb128 .LVU562
+	.uleb128 .LVU564
+	.uleb128 .LVU564
+	.uleb128 0
+.LLST42:
+	.byte	0x6
+	.quad	.LVL57
+	.byte	0x4
+	.uleb128 .LVL57-.LVL57
+	.uleb128 .LVL64-.LVL57
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x4
+	.uleb128 .LVL64-.LVL57
+	.uleb128 .LVL65-1-.LVL57
+	.uleb128 0x1
+	.byte	0x51
+	.byte	0x4
+	.uleb128 .LVL65-1-.LVL57
+	.uleb128 .LVL71-.LVL57
+	.uleb128 0x1
+	.byte	0x5c
+	.byte	0x4
+	.uleb128 .LVL71-.LVL57
+	.uleb128 .LVL72-.LVL57
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL72-.LVL57
+	.uleb128 .LFE18-.LVL57
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0
+.LVUS43:
+	.uleb128 0
+	.uleb128 .LVU534
+	.uleb128 .LVU534
+	.uleb128 .LVU562
+	.uleb128 .LVU562
+	.uleb128 .LVU564
+	.uleb128 .LVU564
+	.uleb128 0
+.LLST43:
+	.byte	0x6
+	.quad	.LVL57
+	.byte	0x4
+	.uleb128 .LVL57-.LVL57
+	.uleb128 .LVL61-.LVL57
+	.uleb128 0x1
+	.byte	0x51
+	.byte	0x4
+	.uleb128 .LVL61-.LVL57
+	.uleb128 .LVL71-.LVL57
+	.uleb128 0x1
+	.byte	0x5d
+	.byte	0x4
+	.uleb128 .LVL71-.LVL57
+	.uleb128 .LVL72-.LVL57
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x51
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL72-.LVL57
+	.uleb128 .LFE18-.LVL57
+	.uleb128 0x1
+	.byte	0x51
+	.byte	0
+.LVUS44:
+	.uleb128 0
+	.uleb128 .LVU536
+	.uleb128 .LVU536
+	.uleb128 .LVU562
+	.uleb128 .LVU562
+	.uleb128 .LVU564
+	.uleb128 .LVU564
+	.uleb128 0
+.LLST44:
+	.byte	0x6
+	.quad	.LVL57
+	.byte	0x4
+	.uleb128 .LVL57-.LVL57
+	.uleb128 .LVL63-.LVL57
+	.uleb128 0x1
+	.byte	0x52
+	.byte	0x4
+	.uleb128 .LVL63-.LVL57
+	.uleb128 .LVL71-.LVL57
+	.uleb128 0x1
+	.byte	0x56
+	.byte	0x4
+	.uleb128 .LVL71-.LVL57
+	.uleb128 .LVL72-.LVL57
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x52
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL72-.LVL57
+	.uleb128 .LFE18-.LVL57
+	.uleb128 0x1
+	.byte	0x52
+	.byte	0
+.LVUS45:
+	.uleb128 0
+	.uleb128 .LVU530
+	.uleb128 .LVU530
+	.uleb128 .LVU535
+	.uleb128 .LVU535
+	.uleb128 0
+.LLST45:
+	.byte	0x6
+	.quad	.LVL57
+	.byte	0x4
+	.uleb128 .LVL57-.LVL57
+	.uleb128 .LVL59-.LVL57
+	.uleb128 0x1
+	.byte	0x58
+	.byte	0x4
+	.uleb128 .LVL59-.LVL57
+	.uleb128 .LVL62-.LVL57
+	.uleb128 0x3
+	.byte	0x78
+	.sleb128 1
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL62-.LVL57
+	.uleb128 .LFE18-.LVL57
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x58
+	.byte	0x9f
+	.byte	0
+.LVUS47:
+	.uleb128 .LVU520
+	.uleb128 .LVU530
+	.uleb128 .LVU530
+	.uleb128 .LVU535
+	.uleb128 .LVU535
+	.uleb128 .LVU562
+.LLST47:
+	.byte	0x6
+	.quad	.LVL58
+	.byte	0x4
+	.uleb128 .LVL58-.LVL58
+	.uleb128 .LVL59-.LVL58
+	.uleb128 0x1
+	.byte	0x58
+	.byte	0x4
+	.uleb128 .LVL59-.LVL58
+	.uleb128 .LVL62-.LVL58
+	.uleb128 0x3
+	.byte	0x78
+	.sleb128 1
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL62-.LVL58
+	.uleb128 .LVL71-.LVL58
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x58
+	.byte	0x9f
+	.byte	0
+.LVUS48:
+	.uleb128 .LVU520
+	.uleb128 .LVU536
+	.uleb128 .LVU536
+	.uleb128 .LVU562
+.LLST48:
+	.byte	0x6
+	.quad	.LVL58
+	.byte	0x4
+	.uleb128 .LVL58-.LVL58
+	.uleb128 .LVL63-.LVL58
+	.uleb128 0x1
+	.byte	0x52
+	.byte	0x4
+	.uleb128 .LVL63-.LVL58
+	.uleb128 .LVL71-.LVL58
+	.uleb128 0x1
+	.byte	0x56
+	.byte	0
+.LVUS49:
+	.uleb128 .LVU520
+	.uleb128 .LVU534
+	.uleb128 .LVU534
+	.uleb128 .LVU562
+.LLST49:
+	.byte	0x6
+	.quad	.LVL58
+	.byte	0x4
+	.uleb128 .LVL58-.LVL58
+	.uleb128 .LVL61-.LVL58
+	.uleb128 0x1
+	.byte	0x51
+	.byte	0x4
+	.uleb128 .LVL61-.LVL58
+	.uleb128 .LVL71-.LVL58
+	.uleb128 0x1
+	.byte	0x5d
+	.byte	0
+.LVUS50:
+	.uleb128 .LVU520
+	.uleb128 .LVU537
+	.uleb128 .LVU537
+	.uleb128 .LVU538
+	.uleb128 .LVU538
+	.uleb128 .LVU562
+.LLST50:
+	.byte	0x6
+	.quad	.LVL58
+	.byte	0x4
+	.uleb128 .LVL58-.LVL58
+	.uleb128 .LVL64-.LVL58
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x4
+	.uleb128 .LVL64-.LVL58
+	.uleb128 .LVL65-1-.LVL58
+	.uleb128 0x1
+	.byte	0x51
+	.byte	0x4
+	.uleb128 .LVL65-1-.LVL58
+	.uleb128 .LVL71-.LVL58
+	.uleb128 0x1
+	.byte	0x5c
+	.byte	0
+.LVUS51:
+	.uleb128 .LVU520
+	.uleb128 .LVU533
+	.uleb128 .LVU533
+	.uleb128 .LVU546
+	.uleb128 .LVU546
+	.uleb128 .LVU562
+.LLST51:
+	.byte	0x6
+	.quad	.LVL58
+	.byte	0x4
+	.uleb128 .LVL58-.LVL58
+	.uleb128 .LVL60-.LVL58
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL60-.LVL58
+	.uleb128 .LVL67-.LVL58
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0x4
+	.uleb128 .LVL67-.LVL58
+	.uleb128 .LVL71-.LVL58
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -88
+	.byte	0
+.LVUS52:
+	.uleb128 .LVU544
+	.uleb128 .LVU546
+	.uleb128 .LVU546
+	.uleb128 .LVU550
+	.uleb128 .LVU550
+	.uleb128 .LVU551
+	.uleb128 .LVU551
+	.uleb128 .LVU555
+	.uleb128 .LVU555
+	.uleb128 .LVU562
+.LLST52:
+	.byte	0x6
+	.quad	.LVL66
+	.byte	0x4
+	.uleb128 .LVL66-.LVL66
+	.uleb128 .LVL67-.LVL66
+	.uleb128 0x2
+	.byte	0x30
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL67-.LVL66
+	.uleb128 .LVL68-.LVL66
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0x4
+	.uleb128 .LVL68-.LVL66
+	.uleb128 .LVL69-1-.LVL66
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -72
+	.byte	0x4
+	.uleb128 .LVL69-1-.LVL66
+	.uleb128 .LVL70-.LVL66
+	.uleb128 0x3
+	.byte	0x73
+	.sleb128 -1
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL70-.LVL66
+	.uleb128 .LVL71-.LVL66
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0
+.LVUS64:
+	.uleb128 0
+	.uleb128 .LVU627
+	.uleb128 .LVU627
+	.uleb128 .LVU661
+	.uleb128 .LVU661
+	.uleb128 0
+.LLST64:
+	.byte	0x6
+	.quad	.LVL87
+	.byte	0x4
+	.uleb128 .LVL87-.LVL87
+	.uleb128 .LVL88-.LVL87
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL88-.LVL87
+	.uleb128 .LVL95-.LVL87
+	.uleb128 0x1
+	.byte	0x5d
+	.byte	0x4
+	.uleb128 .LVL95-.LVL87
+	.uleb128 .LFE20-.LVL87
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x9f
+	.byte	0
+.LVUS66:
+	.uleb128 .LVU619
+	.uleb128 .LVU659
+.LLST66:
+	.byte	0x8
+	.quad	.LVL87
+	.uleb128 .LVL94-.LVL87
+	.uleb128 0x3
+	.byte	0x8
+	.byte	0x20
+	.byte	0x9f
+	.byte	0
+.LVUS67:
+	.uleb128 .LVU619
+	.uleb128 .LVU659
+.LLST67:
+	.byte	0x8
+	.quad	.LVL87
+	.uleb128 .LVL94-.LVL87
+	.uleb128 0x2
+	.byte	0x30
+	.byte	0x9f
+	.byte	0
+.LVUS70:
+	.uleb128 .LVU619
+	.uleb128 .LVU627
+	.uleb128 .LVU627
+	.uleb128 .LVU659
+.LLST70:
+	.byte	0x6
+	.quad	.LVL87
+	.byte	0x4
+	.uleb128 .LVL87-.LVL87
+	.uleb128 .LVL88-.LVL87
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL88-.LVL87
+	.uleb128 .LVL94-.LVL87
+	.uleb128 0x1
+	.byte	0x5d
+	.byte	0
+.LVUS72:
+	.uleb128 .LVU643
+	.uleb128 .LVU644
+	.uleb128 .LVU644
+	.uleb128 .LVU648
+	.uleb128 .LVU648
+	.uleb128 .LVU649
+	.uleb128 .LVU649
+	.uleb128 .LVU653
+	.uleb128 .LVU653
+	.uleb128 .LVU659
+.LLST72:
+	.byte	0x6
+	.quad	.LVL90
+	.byte	0x4
+	.uleb128 .LVL90-.LVL90
+	.uleb128 .LVL90-.LVL90
+	.uleb128 0x2
+	.byte	0x30
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL90-.LVL90
+	.uleb128 .LVL91-.LVL90
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0x4
+	.uleb128 .LVL91-.LVL90
+	.uleb128 .LVL92-1-.LVL90
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -56
+	.byte	0x4
+	.uleb128 .LVL92-1-.LVL90
+	.uleb128 .LVL93-.LVL90
+	.uleb128 0x3
+	.byte	0x73
+	.sleb128 -1
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL93-.LVL90
+	.uleb128 .LVL94-.LVL90
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0
+.Ldebug_loc3:
+	.section	.debug_aranges,"",@progbits
+	.long	0x2c
+	.value	0x2
+	.long	.Ldebug_info0
+	.byte	0x8
+	.byte	0
+	.value	0
+	.value	0
+	.quad	.Ltext0
+	.quad	.Letext0-.Ltext0
+	.quad	0
+	.quad	0
+	.section	.debug_rnglists,"",@progbits
+.Ldebug_ranges0:
+	.long	.Ldebug_ranges3-.Ldebug_ranges2
+.Ldebug_ranges2:
+	.value	0x5
+	.byte	0x8
+	.byte	0
+	.long	0
+.LLRL3:
+	.byte	0x5
+	.quad	.LBB35
+	.byte	0x4
+	.uleb128 .LBB35-.LBB35
+	.uleb128 .LBE35-.LBB35
+	.byte	0x4
+	.uleb128 .LBB61-.LBB35
+	.uleb128 .LBE61-.LBB35
+	.byte	0x4
+	.uleb128 .LBB62-.LBB35
+	.uleb128 .LBE62-.LBB35
+	.byte	0
+.LLRL5:
+	.byte	0x5
+	.quad	.LBB36
+	.byte	0x4
+	.uleb128 .LBB36-.LBB36
+	.uleb128 .LBE36-.LBB36
+	.byte	0x4
+	.uleb128 .LBB55-.LBB36
+	.uleb128 .LBE55-.LBB36
+	.byte	0x4
+	.uleb128 .LBB56-.LBB36
+	.uleb128 .LBE56-.LBB36
+	.byte	0x4
+	.uleb128 .LBB57-.LBB36
+	.uleb128 .LBE57-.LBB36
+	.byte	0x4
+	.uleb128 .LBB58-.LBB36
+	.uleb128 .LBE58-.LBB36
+	.byte	0x4
+	.uleb128 .LBB59-.LBB36
+	.uleb128 .LBE59-.LBB36
+	.byte	0x4
+	.uleb128 .LBB60-.LBB36
+	.uleb128 .LBE60-.LBB36
+	.byte	0
+.LLRL6:
+	.byte	0x5
+	.quad	.LBB38
+	.byte	0x4
+	.uleb128 .LBB38-.LBB38
+	.uleb128 .LBE38-.LBB38
+	.byte	0x4
+	.uleb128 .LBB39-.LBB38
+	.uleb128 .LBE39-.LBB38
+	.byte	0x4
+	.uleb128 .LBB40-.LBB38
+	.uleb128 .LBE40-.LBB38
+	.byte	0x4
+	.uleb128 .LBB41-.LBB38
+	.uleb128 .LBE41-.LBB38
+	.byte	0x4
+	.uleb128 .LBB42-.LBB38
+	.uleb128 .LBE42-.LBB38
+	.byte	0x4
+	.uleb128 .LBB43-.LBB38
+	.uleb128 .LBE43-.LBB38
+	.byte	0x4
+	.uleb128 .LBB44-.LBB38
+	.uleb128 .LBE44-.LBB38
+	.byte	0x4
+	.uleb128 .LBB45-.LBB38
+	.uleb128 .LBE45-.LBB38
+	.byte	0x4
+	.uleb128 .LBB46-.LBB38
+	.uleb128 .LBE46-.LBB38
+	.byte	0x4
+	.uleb128 .LBB47-.LBB38
+	.uleb128 .LBE47-.LBB38
+	.byte	0x4
+	.uleb128 .LBB48-.LBB38
+	.uleb128 .LBE48-.LBB38
+	.byte	0
+.LLRL8:
+	.byte	0x5
+	.quad	.LBB63
+	.byte	0x4
+	.uleb128 .LBB63-.LBB63
+	.uleb128 .LBE63-.LBB63
+	.byte	0x4
+	.uleb128 .LBB105-.LBB63
+	.uleb128 .LBE105-.LBB63
+	.byte	0x4
+	.uleb128 .LBB107-.LBB63
+	.uleb128 .LBE107-.LBB63
+	.byte	0x4
+	.uleb128 .LBB108-.LBB63
+	.uleb128 .LBE108-.LBB63
+	.byte	0x4
+	.uleb128 .LBB110-.LBB63
+	.uleb128 .LBE110-.LBB63
+	.byte	0
+.LLRL10:
+	.byte	0x5
+	.quad	.LBB64
+	.byte	0x4
+	.uleb128 .LBB64-.LBB64
+	.uleb128 .LBE64-.LBB64
+	.byte	0x4
+	.uleb128 .LBB83-.LBB64
+	.uleb128 .LBE83-.LBB64
+	.byte	0x4
+	.uleb128 .LBB84-.LBB64
+	.uleb128 .LBE84-.LBB64
+	.byte	0x4
+	.uleb128 .LBB85-.LBB64
+	.uleb128 .LBE85-.LBB64
+	.byte	0x4
+	.uleb128 .LBB86-.LBB64
+	.uleb128 .LBE86-.LBB64
+	.byte	0x4
+	.uleb128 .LBB87-.LBB64
+	.uleb128 .LBE87-.LBB64
+	.byte	0x4
+	.uleb128 .LBB88-.LBB64
+	.uleb128 .LBE88-.LBB64
+	.byte	0x4
+	.uleb128 .LBB89-.LBB64
+	.uleb128 .LBE89-.LBB64
+	.byte	0x4
+	.uleb128 .LBB90-.LBB64
+	.uleb128 .LBE90-.LBB64
+	.byte	0x4
+	.uleb128 .LBB91-.LBB64
+	.uleb128 .LBE91-.LBB64
+	.byte	0x4
+	.uleb128 .LBB92-.LBB64
+	.uleb128 .LBE92-.LBB64
+	.byte	0x4
+	.uleb128 .LBB93-.LBB64
+	.uleb128 .LBE93-.LBB64
+	.byte	0x4
+	.uleb128 .LBB94-.LBB64
+	.uleb128 .LBE94-.LBB64
+	.byte	0x4
+	.uleb128 .LBB95-.LBB64
+	.uleb128 .LBE95-.LBB64
+	.byte	0x4
+	.uleb128 .LBB96-.LBB64
+	.uleb128 .LBE96-.LBB64
+	.byte	0x4
+	.uleb128 .LBB97-.LBB64
+	.uleb128 .LBE97-.LBB64
+	.byte	0x4
+	.uleb128 .LBB98-.LBB64
+	.uleb128 .LBE98-.LBB64
+	.byte	0x4
+	.uleb128 .LBB99-.LBB64
+	.uleb128 .LBE99-.LBB64
+	.byte	0
+.LLRL14:
+	.byte	0x5
+	.quad	.LBB100
+	.byte	0x4
+	.uleb128 .LBB100-.LBB100
+	.uleb128 .LBE100-.LBB100
+	.byte	0x4
+	.uleb128 .LBB106-.LBB100
+	.uleb128 .LBE106-.LBB100
+	.byte	0x4
+	.uleb128 .LBB109-.LBB100
+	.uleb128 .LBE109-.LBB100
+	.byte	0x4
+	.uleb128 .LBB111-.LBB100
+	.uleb128 .LBE111-.LBB100
+	.byte	0
+.LLRL18:
+	.byte	0x5
+	.quad	.LBB113
+	.byte	0x4
+	.uleb128 .LBB113-.LBB113
+	.uleb128 .LBE113-.LBB113
+	.byte	0x4
+	.uleb128 .LBB118-.LBB113
+	.uleb128 .LBE118-.LBB113
+	.byte	0
+.LLRL19:
+	.byte	0x5
+	.quad	.LBB115
+	.byte	0x4
+	.uleb128 .LBB115-.LBB115
+	.uleb128 .LBE115-.LBB115
+	.byte	0x4
+	.uleb128 .LBB116-.LBB115
+	.uleb128 .LBE116-.LBB115
+	.byte	0
+.LLRL21:
+	.byte	0x5
+	.quad	.LBB119
+	.byte	0x4
+	.uleb128 .LBB119-.LBB119
+	.uleb128 .LBE119-.LBB119
+	.byte	0x4
+	.uleb128 .LBB159-.LBB119
+	.uleb128 .LBE159-.LBB119
+	.byte	0x4
+	.uleb128 .LBB161-.LBB119
+	.uleb128 .LBE161-.LBB119
+	.byte	0x4
+	.uleb128 .LBB163-.LBB119
+	.uleb128 .LBE163-.LBB119
+	.byte	0x4
+	.uleb128 .LBB165-.LBB119
+	.uleb128 .LBE165-.LBB119
+	.byte	0x4
+	.uleb128 .LBB167-.LBB119
+	.uleb128 .LBE167-.LBB119
+	.byte	0
+.LLRL22:
+	.byte	0x5
+	.quad	.LBB120
+	.byte	0x4
+	.uleb128 .LBB120-.LBB120
+	.uleb128 .LBE120-.LBB120
+	.byte	0x4
+	.uleb128 .LBB137-.LBB120
+	.uleb128 .LBE137-.LBB120
+	.byte	0x4
+	.uleb128 .LBB138-.LBB120
+	.uleb128 .LBE138-.LBB120
+	.byte	0x4
+	.uleb128 .LBB139-.LBB120
+	.uleb128 .LBE139-.LBB120
+	.byte	0x4
+	.uleb128 .LBB140-.LBB120
+	.uleb128 .LBE140-.LBB120
+	.byte	0x4
+	.uleb128 .LBB141-.LBB120
+	.uleb128 .LBE141-.LBB120
+	.byte	0x4
+	.uleb128 .LBB142-.LBB120
+	.uleb128 .LBE142-.LBB120
+	.byte	0x4
+	.uleb128 .LBB143-.LBB120
+	.uleb128 .LBE143-.LBB120
+	.byte	0x4
+	.uleb128 .LBB144-.LBB120
+	.uleb128 .LBE144-.LBB120
+	.byte	0x4
+	.uleb128 .LBB145-.LBB120
+	.uleb128 .LBE145-.LBB120
+	.byte	0x4
+	.uleb128 .LBB146-.LBB120
+	.uleb128 .LBE146-.LBB120
+	.byte	0x4
+	.uleb128 .LBB147-.LBB120
+	.uleb128 .LBE147-.LBB120
+	.byte	0x4
+	.uleb128 .LBB148-.LBB120
+	.uleb128 .LBE148-.LBB120
+	.byte	0x4
+	.uleb128 .LBB149-.LBB120
+	.uleb128 .LBE149-.LBB120
+	.byte	0x4
+	.uleb128 .LBB150-.LBB120
+	.uleb128 .LBE150-.LBB120
+	.byte	0x4
+	.uleb128 .LBB151-.LBB120
+	.uleb128 .LBE151-.LBB120
+	.byte	0
+.LLRL25:
+	.byte	0x5
+	.quad	.LBB152
+	.byte	0x4
+	.uleb128 .LBB152-.LBB152
+	.uleb128 .LBE152-.LBB152
+	.byte	0x4
+	.uleb128 .LBB160-.LBB152
+	.uleb128 .LBE160-.LBB152
+	.byte	0x4
+	.uleb128 .LBB162-.LBB152
+	.uleb128 .LBE162-.LBB152
+	.byte	0x4
+	.uleb128 .LBB164-.LBB152
+	.uleb128 .LBE164-.LBB152
+	.byte	0x4
+	.uleb128 .LBB166-.LBB152
+	.uleb128 .LBE166-.LBB152
+	.byte	0x4
+	.uleb128 .LBB168-.LBB152
+	.uleb128 .LBE168-.LBB152
+	.byte	0
+.LLRL31:
+	.byte	0x5
+	.quad	.LBB169
+	.byte	0x4
+	.uleb128 .LBB169-.LBB169
+	.uleb128 .LBE169-.LBB169
+	.byte	0x4
+	.uleb128 .LBB183-.LBB169
+	.uleb128 .LBE183-.LBB169
+	.byte	0x4
+	.uleb128 .LBB184-.LBB169
+	.uleb128 .LBE184-.LBB169
+	.byte	0
+.LLRL33:
+	.byte	0x5
+	.quad	.LBB170
+	.byte	0x4
+	.uleb128 .LBB170-.LBB170
+	.uleb128 .LBE170-.LBB170
+	.byte	0x4
+	.uleb128 .LBB182-.LBB170
+	.uleb128 .LBE182-.LBB170
+	.byte	0
+.LLRL35:
+	.byte	0x5
+	.quad	.LBB171
+	.byte	0x4
+	.uleb128 .LBB171-.LBB171
+	.uleb128 .LBE171-.LBB171
+	.byte	0x4
+	.uleb128 .LBB180-.LBB171
+	.uleb128 .LBE180-.LBB171
+	.byte	0x4
+	.uleb128 .LBB181-.LBB171
+	.uleb128 .LBE181-.LBB171
+	.byte	0
+.LLRL37:
+	.byte	0x5
+	.quad	.LBB172
+	.byte	0x4
+	.uleb128 .LBB172-.LBB172
+	.uleb128 .LBE172-.LBB172
+	.byte	0x4
+	.uleb128 .LBB177-.LBB172
+	.uleb128 .LBE177-.LBB172
+	.byte	0x4
+	.uleb128 .LBB178-.LBB172
+	.uleb128 .LBE178-.LBB172
+	.byte	0x4
+	.uleb128 .LBB179-.LBB172
+	.uleb128 .LBE179-.LBB172
+	.byte	0
+.LLRL46:
+	.byte	0x5
+	.quad	.LBB188
+	.byte	0x4
+	.uleb128 .LBB188-.LBB188
+	.uleb128 .LBE188-.LBB188
+	.byte	0x4
+	.uleb128 .LBB192-.LBB188
+	.uleb128 .LBE192-.LBB188
+	.byte	0
+.LLRL56:
+	.byte	0x5
+	.quad	.LBB196
+	.byte	0x4
+	.uleb128 .LBB196-.LBB196
+	.uleb128 .LBE196-.LBB196
+	.byte	0x4
+	.uleb128 .LBB204-.LBB196
+	.uleb128 .LBE204-.LBB196
+	.byte	0x4
+	.uleb128 .LBB205-.LBB196
+	.uleb128 .LBE205-.LBB196
+	.byte	0x4
+	.uleb128 .LBB206-.LBB196
+	.uleb128 .LBE206-.LBB196
+	.byte	0x4
+	.uleb128 .LBB207-.LBB196
+	.uleb128 .LBE207-.LBB196
+	.byte	0
+.LLRL62:
+	.byte	0x5
+	.quad	.LBB198
+	.byte	0x4
+	.uleb128 .LBB198-.LBB198
+	.uleb128 .LBE198-.LBB198
+	.byte	0x4
+	.uleb128 .LBB199-.LBB198
+	.uleb128 .LBE199-.LBB198
+	.byte	0
+.LLRL65:
+	.byte	0x5
+	.quad	.LBB211
+	.byte	0x4
+	.uleb128 .LBB211-.LBB211
+	.uleb128 .LBE211-.LBB211
+	.byte	0x4
+	.uleb128 .LBB220-.LBB211
+	.uleb128 .LBE220-.LBB211
+	.byte	0x4
+	.uleb128 .LBB221-.LBB211
+	.uleb128 .LBE221-.LBB211
+	.byte	0x4
+	.uleb128 .LBB222-.LBB211
+	.uleb128 .LBE222-.LBB211
+	.byte	0x4
+	.uleb128 .LBB223-.LBB211
+	.uleb128 .LBE223-.LBB211
+	.byte	0x4
+	.uleb128 .LBB224-.LBB211
+	.uleb128 .LBE224-.LBB211
+	.byte	0
+.LLRL71:
+	.byte	0x5
+	.quad	.LBB213
+	.byte	0x4
+	.uleb128 .LBB213-.LBB213
+	.uleb128 .LBE213-.LBB213
+	.byte	0x4
+	.uleb128 .LBB214-.LBB213
+	.uleb128 .LBE214-.LBB213
+	.byte	0
+.LLRL77:
+	.byte	0x5
+	.quad	.LBB225
+	.byte	0x4
+	.uleb128 .LBB225-.LBB225
+	.uleb128 .LBE225-.LBB225
+	.byte	0x4
+	.uleb128 .LBB226-.LBB225
+	.uleb128 .LBE226-.LBB225
+	.byte	0x4
+	.uleb128 .LBB227-.LBB225
+	.uleb128 .LBE227-.LBB225
+	.byte	0x4
+	.uleb128 .LBB229-.LBB225
+	.uleb128 .LBE229-.LBB225
+	.byte	0
+.LLRL82:
+	.byte	0x5
+	.quad	.LBB230
+	.byte	0x4
+	.uleb128 .LBB230-.LBB230
+	.uleb128 .LBE230-.LBB230
+	.byte	0x4
+	.uleb128 .LBB289-.LBB230
+	.uleb128 .LBE289-.LBB230
+	.byte	0x4
+	.uleb128 .LBB290-.LBB230
+	.uleb128 .LBE290-.LBB230
+	.byte	0x4
+	.uleb128 .LBB291-.LBB230
+	.uleb128 .LBE291-.LBB230
+	.byte	0x4
+	.uleb128 .LBB292-.LBB230
+	.uleb128 .LBE292-.LBB230
+	.byte	0x4
+	.uleb128 .LBB293-.LBB230
+	.uleb128 .LBE293-.LBB230
+	.byte	0x4
+	.uleb128 .LBB294-.LBB230
+	.uleb128 .LBE294-.LBB230
+	.byte	0x4
+	.uleb128 .LBB347-.LBB230
+	.uleb128 .LBE347-.LBB230
+	.byte	0x4
+	.uleb128 .LBB349-.LBB230
+	.uleb128 .LBE349-.LBB230
+	.byte	0
+.LLRL84:
+	.byte	0x5
+	.quad	.LBB231
+	.byte	0x4
+	.uleb128 .LBB231-.LBB231
+	.uleb128 .LBE231-.LBB231
+	.byte	0x4
+	.uleb128 .LBB261-.LBB231
+	.uleb128 .LBE261-.LBB231
+	.byte	0x4
+	.uleb128 .LBB262-.LBB231
+	.uleb128 .LBE262-.LBB231
+	.byte	0x4
+	.uleb128 .LBB263-.LBB231
+	.uleb128 .LBE263-.LBB231
+	.byte	0x4
+	.uleb128 .LBB264-.LBB231
+	.uleb128 .LBE264-.LBB231
+	.byte	0x4
+	.uleb128 .LBB265-.LBB231
+	.uleb128 .LBE265-.LBB231
+	.byte	0x4
+	.uleb128 .LBB266-.LBB231
+	.uleb128 .LBE266-.LBB231
+	.byte	0x4
+	.uleb128 .LBB267-.LBB231
+	.uleb128 .LBE267-.LBB231
+	.byte	0x4
+	.uleb128 .LBB268-.LBB231
+	.uleb128 .LBE268-.LBB231
+	.byte	0x4
+	.uleb128 .LBB269-.LBB231
+	.uleb128 .LBE269-.LBB231
+	.byte	0x4
+	.uleb128 .LBB270-.LBB231
+	.uleb128 .LBE270-.LBB231
+	.byte	0x4
+	.uleb128 .LBB271-.LBB231
+	.uleb128 .LBE271-.LBB231
+	.byte	0x4
+	.uleb128 .LBB272-.LBB231
+	.uleb128 .LBE272-.LBB231
+	.byte	0x4
+	.uleb128 .LBB273-.LBB231
+	.uleb128 .LBE273-.LBB231
+	.byte	0x4
+	.uleb128 .LBB274-.LBB231
+	.uleb128 .LBE274-.LBB231
+	.byte	0x4
+	.uleb128 .LBB275-.LBB231
+	.uleb128 .LBE275-.LBB231
+	.byte	0x4
+	.uleb128 .LBB276-.LBB231
+	.uleb128 .LBE276-.LBB231
+	.byte	0x4
+	.uleb128 .LBB277-.LBB231
+	.uleb128 .LBE277-.LBB231
+	.byte	0x4
+	.uleb128 .LBB278-.LBB231
+	.uleb128 .LBE278-.LBB231
+	.byte	0x4
+	.uleb128 .LBB279-.LBB231
+	.uleb128 .LBE279-.LBB231
+	.byte	0x4
+	.uleb128 .LBB280-.LBB231
+	.uleb128 .LBE280-.LBB231
+	.byte	0x4
+	.uleb128 .LBB281-.LBB231
+	.uleb128 .LBE281-.LBB231
+	.byte	0x4
+	.uleb128 .LBB282-.LBB231
+	.uleb128 .LBE282-.LBB231
+	.byte	0x4
+	.uleb128 .LBB283-.LBB231
+	.uleb128 .LBE283-.LBB231
+	.byte	0x4
+	.uleb128 .LBB284-.LBB231
+	.uleb128 .LBE284-.LBB231
+	.byte	0x4
+	.uleb128 .LBB285-.LBB231
+	.uleb128 .LBE285-.LBB231
+	.byte	0x4
+	.uleb128 .LBB286-.LBB231
+	.uleb128 .LBE286-.LBB231
+	.byte	0x4
+	.uleb128 .LBB287-.LBB231
+	.uleb128 .LBE287-.LBB231
+	.byte	0x4
+	.uleb128 .LBB288-.LBB231
+	.uleb128 .LBE288-.LBB231
+	.byte	0
+.LLRL87:
+	.byte	0x5
+	.quad	.LBB295
+	.byte	0x4
+	.uleb128 .LBB295-.LBB295
+	.uleb128 .LBE295-.LBB295
+	.byte	0x4
+	.uleb128 .LBB346-.LBB295
+	.uleb128 .LBE346-.LBB295
+	.byte	0x4
+	.uleb128 .LBB348-.LBB295
+	.uleb128 .LBE348-.LBB295
+	.byte	0
+.LLRL89:
+	.byte	0x5
+	.quad	.LBB296
+	.byte	0x4
+	.uleb128 .LBB296-.LBB296
+	.uleb128 .LBE296-.LBB296
+	.byte	0x4
+	.uleb128 .LBB322-.LBB296
+	.uleb128 .LBE322-.LBB296
+	.byte	0x4
+	.uleb128 .LBB323-.LBB296
+	.uleb128 .LBE323-.LBB296
+	.byte	0x4
+	.uleb128 .LBB324-.LBB296
+	.uleb128 .LBE324-.LBB296
+	.byte	0x4
+	.uleb128 .LBB325-.LBB296
+	.uleb128 .LBE325-.LBB296
+	.byte	0x4
+	.uleb128 .LBB326-.LBB296
+	.uleb128 .LBE326-.LBB296
+	.byte	0x4
+	.uleb128 .LBB327-.LBB296
+	.uleb128 .LBE327-.LBB296
+	.byte	0x4
+	.uleb128 .LBB328-.LBB296
+	.uleb128 .LBE328-.LBB296
+	.byte	0x4
+	.uleb128 .LBB329-.LBB296
+	.uleb128 .LBE329-.LBB296
+	.byte	0x4
+	.uleb128 .LBB330-.LBB296
+	.uleb128 .LBE330-.LBB296
+	.byte	0x4
+	.uleb128 .LBB331-.LBB296
+	.uleb128 .LBE331-.LBB296
+	.byte	0x4
+	.uleb128 .LBB332-.LBB296
+	.uleb128 .LBE332-.LBB296
+	.byte	0x4
+	.uleb128 .LBB333-.LBB296
+	.uleb128 .LBE333-.LBB296
+	.byte	0x4
+	.uleb128 .LBB334-.LBB296
+	.uleb128 .LBE334-.LBB296
+	.byte	0x4
+	.uleb128 .LBB335-.LBB296
+	.uleb128 .LBE335-.LBB296
+	.byte	0x4
+	.uleb128 .LBB336-.LBB296
+	.uleb128 .LBE336-.LBB296
+	.byte	0x4
+	.uleb128 .LBB337-.LBB296
+	.uleb128 .LBE337-.LBB296
+	.byte	0x4
+	.uleb128 .LBB338-.LBB296
+	.uleb128 .LBE338-.LBB296
+	.byte	0x4
+	.uleb128 .LBB339-.LBB296
+	.uleb128 .LBE339-.LBB296
+	.byte	0x4
+	.uleb128 .LBB340-.LBB296
+	.uleb128 .LBE340-.LBB296
+	.byte	0x4
+	.uleb128 .LBB341-.LBB296
+	.uleb128 .LBE341-.LBB296
+	.byte	0x4
+	.uleb128 .LBB342-.LBB296
+	.uleb128 .LBE342-.LBB296
+	.byte	0x4
+	.uleb128 .LBB343-.LBB296
+	.uleb128 .LBE343-.LBB296
+	.byte	0x4
+	.uleb128 .LBB344-.LBB296
+	.uleb128 .LBE344-.LBB296
+	.byte	0x4
+	.uleb128 .LBB345-.LBB296
+	.uleb128 .LBE345-.LBB296
+	.byte	0
+.LLRL96:
+	.byte	0x5
+	.quad	.LBB355
+	.byte	0x4
+	.uleb128 .LBB355-.LBB355
+	.uleb128 .LBE355-.LBB355
+	.byte	0x4
+	.uleb128 .LBB372-.LBB355
+	.uleb128 .LBE372-.LBB355
+	.byte	0x4
+	.uleb128 .LBB373-.LBB355
+	.uleb128 .LBE373-.LBB355
+	.byte	0x4
+	.uleb128 .LBB374-.LBB355
+	.uleb128 .LBE374-.LBB355
+	.byte	0x4
+	.uleb128 .LBB375-.LBB355
+	.uleb128 .LBE375-.LBB355
+	.byte	0x4
+	.uleb128 .LBB376-.LBB355
+	.uleb128 .LBE376-.LBB355
+	.byte	0x4
+	.uleb128 .LBB377-.LBB355
+	.uleb128 .LBE377-.LBB355
+	.byte	0
+.LLRL103:
+	.byte	0x5
+	.quad	.LBB358
+	.byte	0x4
+	.uleb128 .LBB358-.LBB358
+	.uleb128 .LBE358-.LBB358
+	.byte	0x4
+	.uleb128 .LBB359-.LBB358
+	.uleb128 .LBE359-.LBB358
+	.byte	0
+.LLRL108:
+	.byte	0x5
+	.quad	.LBB383
+	.byte	0x4
+	.uleb128 .LBB383-.LBB383
+	.uleb128 .LBE383-.LBB383
+	.byte	0x4
+	.uleb128 .LBB402-.LBB383
+	.uleb128 .LBE402-.LBB383
+	.byte	0x4
+	.uleb128 .LBB403-.LBB383
+	.uleb128 .LBE403-.LBB383
+	.byte	0x4
+	.uleb128 .LBB404-.LBB383
+	.uleb128 .LBE404-.LBB383
+	.byte	0x4
+	.uleb128 .LBB405-.LBB383
+	.uleb128 .LBE405-.LBB383
+	.byte	0x4
+	.uleb128 .LBB406-.LBB383
+	.uleb128 .LBE406-.LBB383
+	.byte	0x4
+	.uleb128 .LBB407-.LBB383
+	.uleb128 .LBE407-.LBB383
+	.byte	0x4
+	.uleb128 .LBB408-.LBB383
+	.uleb128 .LBE408-.LBB383
+	.byte	0
+.LLRL115:
+	.byte	0x5
+	.quad	.LBB386
+	.byte	0x4
+	.uleb128 .LBB386-.LBB386
+	.uleb128 .LBE386-.LBB386
+	.byte	0x4
+	.uleb128 .LBB387-.LBB386
+	.uleb128 .LBE387-.LBB386
+	.byte	0
+.LLRL117:
+	.byte	0x7
+	.quad	.Ltext0
+	.uleb128 .Letext0-.Ltext0
+	.byte	0
+.Ldebug_ranges3:
+	.section	.debug_line,"",@progbits
+.Ldebug_line0:
+	.section	.debug_str,"MS",@progbits,1
+.LASF58:
+	.string	"bsp_slice"
+.LASF41:
+	.string	"blake2s_init_words"
+.LASF8:
+	.string	"size_t"
+.LASF9:
+	.string	"__uint8_t"
+.LASF43:
+	.string	"blake2sp_parallel"
+.LASF20:
+	.string	"long long unsigned int"
+.LASF23:
+	.string	"blake2s_sigma"
+.LASF35:
+	.string	"blake2s_final"
+.LASF54:
+	.string	"dig_len"
+.LASF21:
+	.string	"long long int"
+.LASF7:
+	.string	"signed char"
+.LASF18:
+	.string	"blake2s_ctx"
+.LASF15:
+	.string	"buf_len"
+.LASF37:
+	.string	"blake2s_lanes_run"
+.LASF32:
+	.string	"blake2s_job"
+.LASF3:
+	.string	"long int"
+.LASF27:
+	.string	"compress"
+.LASF40:
+	.string	"memcpy"
+.LASF60:
+	.string	"blane_inc_t"
+.LASF57:
+	.string	"key_len"
+.LASF53:
+	.string	"salt"
+.LASF62:
+	.string	"blane_load"
+.LASF11:
+	.string	"__uint32_t"
+.LASF29:
+	.string	"lanes"
+.LASF24:
+	.string	"blake2s_lanes"
+.LASF56:
+	.string	"blake2sp_init_keyed"
+.LASF6:
+	.string	"unsigned int"
+.LASF63:
+	.string	"blake2s_compress_lanes"
+.LASF50:
+	.string	"bsp_par_leaves"
+.LASF2:
+	.string	"long unsigned int"
+.LASF55:
+	.string	"blake2sp_init_salted"
+.LASF52:
+	.string	"blake2sp_init"
+.LASF25:
+	.string	"name"
+.LASF5:
+	.string	"short unsigned int"
+.LASF68:
+	.string	"__builtin_memcpy"
+.LASF51:
+	.string	"bsp_strides"
+.LASF19:
+	.string	"blake2sp_ctx"
+.LASF67:
+	.string	"GNU C99 12.2.0 -mtune=generic -march=x86-64 -g -O3 -std=c99 -fasynchronous-unwind-tables"
+.LASF61:
+	.string	"blane_store"
+.LASF28:
+	.string	"compress_blocks"
+.LASF46:
+	.string	"blake2sp_final"
+.LASF65:
+	.string	"blake2s_compress_blocks"
+.LASF44:
+	.string	"nthreads"
+.LASF59:
+	.string	"bsp_init"
+.LASF49:
+	.string	"fill"
+.LASF4:
+	.string	"unsigned char"
+.LASF33:
+	.string	"bsp_par"
+.LASF10:
+	.string	"short int"
+.LASF16:
+	.string	"digest_len"
+.LASF14:
+	.string	"uint32_t"
+.LASF12:
+	.string	"char"
+.LASF31:
+	.string	"blake2s_kernel"
+.LASF42:
+	.string	"blake2sp"
+.LASF45:
+	.string	"blake2s_kern"
+.LASF47:
+	.string	"hash"
+.LASF17:
+	.string	"last_node"
+.LASF26:
+	.string	"usable"
+.LASF30:
+	.string	"compress_lanes"
+.LASF38:
+	.string	"memset"
+.LASF64:
+	.string	"mask"
+.LASF34:
+	.string	"blake2s_pool_run"
+.LASF39:
+	.string	"memmove"
+.LASF13:
+	.string	"uint8_t"
+.LASF66:
+	.string	"nblocks"
+.LASF48:
+	.string	"blake2sp_update"
+.LASF36:
+	.string	"blake2s_update"
+.LASF22:
+	.string	"blake2s_iv"
+	.section	.debug_line_str,"MS",@progbits,1
+.LASF1:
+	.string	"/root/repo"
+.LASF0:
+	.string	"blake2sp.c"
+	.ident	"GCC: (Debian 12.2.0-14+deb12u1) 12.2.0"
+	.section	.note.GNU-stack,"",@progbits
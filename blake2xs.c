@@ -0,0 +1,109 @@
+#include <string.h>
+
+#include "blake2s.h"
+#include "blake2xs.h"
+#include "blake2s-internal.h"
+
+/* BLAKE2Xs
+ *
+ * The root is sequential BLAKE2s with xof_len in the high 16 bits of
+ * the node offset. Output block i is unkeyed BLAKE2s of H0 with fanout
+ * and depth 0, leaf and inner length 32, node offset i and the same
+ * xof_len, cut to what is left of the output.
+ *
+ * Every output block is a single final block with the same message,
+ * so they are set up directly in the transposed lane state, and each
+ * multi-buffer kernel call produces a full set of lanes.
+ */
+#define BXS_PARAM3(xof_len,inner_len) B2S_PARAM3(xof_len, 0, inner_len)
+
+static int bxs_init(struct blake2xs_ctx *ctx, const void *key,
+                    unsigned key_len, unsigned xof_len)
+{
+    const u32 P[B2S_PARAM_WORDS] = { LE32W(BLAKE2S_LEN,key_len,1,1), 0, 0,
+                                     BXS_PARAM3(xof_len, 0) };
+
+    if (key_len > BLAKE2S_KEY_LEN)
+        return -1;
+    if (xof_len < 1 || xof_len > BLAKE2XS_UNKNOWN)
+        return -1;
+    blake2s_init_words(&ctx->S, P, NULL, NULL, key, key_len);
+    ctx->xof_len = xof_len;
+    return 0;
+}
+
+int blake2xs_init_keyed(struct blake2xs_ctx *ctx, const void *key,
+                        unsigned key_len, unsigned xof_len)
+{
+    if (key_len < 1)
+        return -1;
+    return bxs_init(ctx, key, key_len, xof_len);
+}
+
+int blake2xs_init(struct blake2xs_ctx *ctx, unsigned xof_len)
+{
+    return bxs_init(ctx, NULL, 0, xof_len);
+}
+
+void blake2xs_update(struct blake2xs_ctx *ctx, const void *src, size_t len)
+{
+    blake2s_update(&ctx->S, src, len);
+}
+
+/* bxs_output: write `len` bytes (up to 32) of lane `l`'s digest */
+static void bxs_output(const struct blake2s_lanes *L, unsigned l,
+                       unsigned char *out, size_t len)
+{
+    u8 digest[BLAKE2S_LEN];
+    for (unsigned i = 0; i < 8; i++)
+        write_le32(digest + i*4, L->H[i][l]);
+    memcpy(out, digest, len);
+}
+
+int blake2xs_final(struct blake2xs_ctx *ctx, unsigned char *out,
+                   size_t out_len)
+{
+    struct blake2s_lanes L;
+    const void *m[B2S_LANES_MAX];
+    u8 h0[BLAKE2S_BLOCK] = {0}; /* zero-padded message block */
+    unsigned width = blake2s_kern->lanes;
+    size_t nblocks = (out_len + BLAKE2S_LEN - 1) / BLAKE2S_LEN;
+
+    if (ctx->xof_len == BLAKE2XS_UNKNOWN) {
+        if (!out_len || (uint64_t)out_len > BLAKE2XS_MAX_UNKNOWN)
+            return -1;
+    } else if (out_len != ctx->xof_len) {
+        return -1;
+    }
+    blake2s_final(&ctx->S, h0);
+
+    for (unsigned l = 0; l < width; l++)
+        m[l] = h0;
+    for (size_t i = 0; i < nblocks; i += width) {
+        unsigned k = nblocks - i < width ? nblocks - i : width;
+        for (unsigned l = 0; l < k; l++) {
+            size_t left = out_len - (i + l) * BLAKE2S_LEN;
+            unsigned dig_len = left < BLAKE2S_LEN ? left : BLAKE2S_LEN;
+            L.H[0][l] = blake2s_iv[0] ^ LE32W(dig_len,0,0,0);
+            L.H[1][l] = blake2s_iv[1] ^ BLAKE2S_LEN; /* leaf length */
+            L.H[2][l] = blake2s_iv[2] ^ (u32)(i + l);
+            L.H[3][l] = blake2s_iv[3] ^ BXS_PARAM3(ctx->xof_len, BLAKE2S_LEN);
+            for (unsigned w = 4; w < 8; w++)
+                L.H[w][l] = blake2s_iv[w];
+            L.t[0][l] = BLAKE2S_LEN;
+            L.t[1][l] = 0;
+            L.f[0][l] = ~0U;
+            L.f[1][l] = 0;
+        }
+        blake2s_compress_lanes(&L, m, (1u << k) - 1);
+        for (unsigned l = 0; l < k; l++) {
+            size_t left = out_len - (i + l) * BLAKE2S_LEN;
+            bxs_output(&L, l, out + (i + l) * BLAKE2S_LEN,
+                       left < BLAKE2S_LEN ? left : BLAKE2S_LEN);
+        }
+    }
+    memset(h0, 0, sizeof(h0));
+    memset(&L, 0, sizeof(L));
+    memset(ctx, 0, sizeof(*ctx));
+    return 0;
+}
@@ -0,0 +1,44 @@
+#ifndef BLAKE2XS_H_
+#define BLAKE2XS_H_
+
+#include "blake2s.h"
+
+/* BLAKE2Xs: extendable output. The input is hashed into a 32-byte root
+ * digest H0, and output block i is BLAKE2s of H0 at node offset i, all
+ * of them independent. xof_len is the output length in bytes, part of
+ * every hash; BLAKE2XS_UNKNOWN lets the output length be chosen at the
+ * end, up to BLAKE2XS_MAX_UNKNOWN bytes.
+ */
+#define BLAKE2XS_UNKNOWN 0xffff
+#define BLAKE2XS_MAX_UNKNOWN ((uint64_t)BLAKE2S_LEN << 32)
+
+struct blake2xs_ctx;
+
+/* blake2xs_init_keyed: initialize BLAKE2Xs with key
+ *
+ * `key_len` must be 1 to BLAKE2S_KEY_LEN
+ * `xof_len` must be 1 to BLAKE2XS_UNKNOWN
+ *
+ * returns < 0 on parameter error
+ */
+ int blake2xs_init_keyed(struct blake2xs_ctx *ctx, const void *key,
+                         unsigned key_len, unsigned xof_len);
+/* blake2xs_init: like blake2xs_init_keyed
+ * returns < 0 on parameter error
+ */
+ int blake2xs_init(struct blake2xs_ctx *ctx, unsigned xof_len);
+
+void blake2xs_update(struct blake2xs_ctx *ctx, const void *src, size_t len);
+/* blake2xs_final: write `out_len` bytes of output; must be xof_len,
+ * unless that is BLAKE2XS_UNKNOWN
+ * returns < 0 on length error
+ */
+ int blake2xs_final(struct blake2xs_ctx *ctx, unsigned char *out,
+                    size_t out_len);
+
+struct blake2xs_ctx {
+    struct blake2s_ctx S;
+    unsigned xof_len;
+} ALIGN(16);
+
+#endif /* BLAKE2XS_H_ */
@@ -0,0 +1,5428 @@
+	.file	"blake2xs.c"
+# GNU C99 (Debian 12.2.0-14+deb12u1) version 12.2.0 (x86_64-linux-gnu)
+#	compiled by GNU C version 12.2.0, GMP version 6.2.1, MPFR version 4.2.0, MPC version 1.3.1, isl version isl-0.25-GMP
+
+# GGC heuristics: --param ggc-min-expand=100 --param ggc-min-heapsize=131072
+# options passed: -mtune=generic -march=x86-64 -g -O3 -std=c99 -fasynchronous-unwind-tables
+	.text
+.Ltext0:
+	.file 0 "/root/repo" "blake2xs.c"
+	.p2align 4
+	.globl	blake2xs_init_keyed
+	.type	blake2xs_init_keyed, @function
+blake2xs_init_keyed:
+.LVL0:
+.LFB18:
+	.file 1 "blake2xs.c"
+	.loc 1 37 1 view -0
+	.cfi_startproc
+	.loc 1 38 5 view .LVU1
+# blake2xs.c:38:     if (key_len < 1)
+	.loc 1 38 8 is_stmt 0 view .LVU2
+	testl	%edx, %edx	# key_len
+	je	.L4	#,
+# blake2xs.c:37: {
+	.loc 1 37 1 view .LVU3
+	pushq	%rbp	#
+	.cfi_def_cfa_offset 16
+	.cfi_offset 6, -16
+.LBB17:
+.LBB18:
+# blake2xs.c:23:     const u32 P[B2S_PARAM_WORDS] = { LE32W(BLAKE2S_LEN,key_len,1,1), 0, 0,
+	.loc 1 23 45 view .LVU4
+	movl	%edx, %eax	# key_len, tmp91
+	movl	%edx, %r9d	# tmp98, key_len
+.LBE18:
+.LBE17:
+# blake2xs.c:37: {
+	.loc 1 37 1 view .LVU5
+	pushq	%rbx	#
+	.cfi_def_cfa_offset 24
+	.cfi_offset 3, -24
+.LBB23:
+.LBB19:
+# blake2xs.c:23:     const u32 P[B2S_PARAM_WORDS] = { LE32W(BLAKE2S_LEN,key_len,1,1), 0, 0,
+	.loc 1 23 45 view .LVU6
+	sall	$8, %eax	#, tmp91
+	movl	%ecx, %ebx	# tmp99, xof_len
+.LBE19:
+.LBE23:
+	.loc 1 40 5 is_stmt 1 view .LVU7
+.LVL1:
+.LBB24:
+.LBI17:
+	.loc 1 20 12 view .LVU8
+.LBB20:
+	.loc 1 23 5 view .LVU9
+# blake2xs.c:23:     const u32 P[B2S_PARAM_WORDS] = { LE32W(BLAKE2S_LEN,key_len,1,1), 0, 0,
+	.loc 1 23 24 is_stmt 0 view .LVU10
+	orl	$16842784, %eax	#, tmp92
+.LBE20:
+.LBE24:
+# blake2xs.c:37: {
+	.loc 1 37 1 view .LVU11
+	subq	$24, %rsp	#,
+	.cfi_def_cfa_offset 48
+.LBB25:
+.LBB21:
+# blake2xs.c:23:     const u32 P[B2S_PARAM_WORDS] = { LE32W(BLAKE2S_LEN,key_len,1,1), 0, 0,
+	.loc 1 23 24 view .LVU12
+	movl	%eax, (%rsp)	# tmp92, P[0]
+# blake2xs.c:23:     const u32 P[B2S_PARAM_WORDS] = { LE32W(BLAKE2S_LEN,key_len,1,1), 0, 0,
+	.loc 1 23 15 view .LVU13
+	movq	$0, 4(%rsp)	#, MEM <unsigned long> [(unsigned int *)&P + 4B]
+	movl	%ecx, 12(%rsp)	# xof_len, P[3]
+	.loc 1 26 5 is_stmt 1 view .LVU14
+# blake2xs.c:26:     if (key_len > BLAKE2S_KEY_LEN)
+	.loc 1 26 8 is_stmt 0 view .LVU15
+	cmpl	$32, %edx	#, key_len
+	ja	.L6	#,
+	.loc 1 28 5 is_stmt 1 view .LVU16
+# blake2xs.c:28:     if (xof_len < 1 || xof_len > BLAKE2XS_UNKNOWN)
+	.loc 1 28 21 is_stmt 0 view .LVU17
+	leal	-1(%rcx), %eax	#, tmp93
+# blake2xs.c:28:     if (xof_len < 1 || xof_len > BLAKE2XS_UNKNOWN)
+	.loc 1 28 8 view .LVU18
+	cmpl	$65534, %eax	#, tmp93
+	ja	.L6	#,
+	movq	%rdi, %rbp	# tmp96, ctx
+	movq	%rsi, %r8	# tmp97, key
+	.loc 1 30 5 is_stmt 1 view .LVU19
+	xorl	%ecx, %ecx	#
+.LVL2:
+	.loc 1 30 5 is_stmt 0 view .LVU20
+	movq	%rsp, %rsi	#, tmp94
+.LVL3:
+	.loc 1 30 5 view .LVU21
+	xorl	%edx, %edx	#
+.LVL4:
+	.loc 1 30 5 view .LVU22
+	call	blake2s_init_words@PLT	#
+.LVL5:
+	.loc 1 31 5 is_stmt 1 view .LVU23
+# blake2xs.c:31:     ctx->xof_len = xof_len;
+	.loc 1 31 18 is_stmt 0 view .LVU24
+	movl	%ebx, 128(%rbp)	# xof_len, ctx_5(D)->xof_len
+	.loc 1 32 5 is_stmt 1 view .LVU25
+# blake2xs.c:32:     return 0;
+	.loc 1 32 12 is_stmt 0 view .LVU26
+	xorl	%eax, %eax	# <retval>
+.LVL6:
+.L1:
+	.loc 1 32 12 view .LVU27
+.LBE21:
+.LBE25:
+# blake2xs.c:41: }
+	.loc 1 41 1 view .LVU28
+	addq	$24, %rsp	#,
+	.cfi_remember_state
+	.cfi_def_cfa_offset 24
+	popq	%rbx	#
+	.cfi_def_cfa_offset 16
+.LVL7:
+	.loc 1 41 1 view .LVU29
+	popq	%rbp	#
+	.cfi_def_cfa_offset 8
+	ret	
+.LVL8:
+	.p2align 4,,10
+	.p2align 3
+.L6:
+	.cfi_restore_state
+.LBB26:
+.LBB22:
+# blake2xs.c:27:         return -1;
+	.loc 1 27 16 view .LVU30
+	movl	$-1, %eax	#, <retval>
+.LVL9:
+	.loc 1 27 16 view .LVU31
+.LBE22:
+.LBE26:
+# blake2xs.c:40:     return bxs_init(ctx, key, key_len, xof_len);
+	.loc 1 40 12 view .LVU32
+	jmp	.L1	#
+	.p2align 4,,10
+	.p2align 3
+.L4:
+	.cfi_def_cfa_offset 8
+	.cfi_restore 3
+	.cfi_restore 6
+# blake2xs.c:39:         return -1;
+	.loc 1 39 16 view .LVU33
+	movl	$-1, %eax	#, <retval>
+# blake2xs.c:41: }
+	.loc 1 41 1 view .LVU34
+	ret	
+	.cfi_endproc
+.LFE18:
+	.size	blake2xs_init_keyed, .-blake2xs_init_keyed
+	.p2align 4
+	.globl	blake2xs_init
+	.type	blake2xs_init, @function
+blake2xs_init:
+.LVL10:
+.LFB19:
+	.loc 1 44 1 is_stmt 1 view -0
+	.cfi_startproc
+	.loc 1 45 5 view .LVU36
+.LBB29:
+.LBI29:
+	.loc 1 20 12 view .LVU37
+.LBB30:
+	.loc 1 23 5 view .LVU38
+.LBE30:
+.LBE29:
+# blake2xs.c:44: {
+	.loc 1 44 1 is_stmt 0 view .LVU39
+	pushq	%rbp	#
+	.cfi_def_cfa_offset 16
+	.cfi_offset 6, -16
+	pushq	%rbx	#
+	.cfi_def_cfa_offset 24
+	.cfi_offset 3, -24
+	subq	$24, %rsp	#,
+	.cfi_def_cfa_offset 48
+.LBB33:
+.LBB31:
+# blake2xs.c:23:     const u32 P[B2S_PARAM_WORDS] = { LE32W(BLAKE2S_LEN,key_len,1,1), 0, 0,
+	.loc 1 23 15 view .LVU40
+	movq	.LC0(%rip), %rax	#, tmp87
+	movl	$0, 8(%rsp)	#, P[2]
+	movq	%rax, (%rsp)	# tmp87, MEM <vector(2) unsigned int> [(unsigned int *)&P]
+# blake2xs.c:28:     if (xof_len < 1 || xof_len > BLAKE2XS_UNKNOWN)
+	.loc 1 28 21 view .LVU41
+	leal	-1(%rsi), %eax	#, tmp88
+# blake2xs.c:23:     const u32 P[B2S_PARAM_WORDS] = { LE32W(BLAKE2S_LEN,key_len,1,1), 0, 0,
+	.loc 1 23 15 view .LVU42
+	movl	%esi, 12(%rsp)	# xof_len, P[3]
+	.loc 1 26 5 is_stmt 1 view .LVU43
+	.loc 1 28 5 view .LVU44
+# blake2xs.c:28:     if (xof_len < 1 || xof_len > BLAKE2XS_UNKNOWN)
+	.loc 1 28 8 is_stmt 0 view .LVU45
+	cmpl	$65534, %eax	#, tmp88
+	ja	.L14	#,
+	movq	%rdi, %rbp	# tmp91, ctx
+	movl	%esi, %ebx	# tmp92, xof_len
+	.loc 1 30 5 is_stmt 1 view .LVU46
+	xorl	%r9d, %r9d	#
+	movq	%rsp, %rsi	#, tmp89
+.LVL11:
+	.loc 1 30 5 is_stmt 0 view .LVU47
+	xorl	%r8d, %r8d	#
+	xorl	%ecx, %ecx	#
+	xorl	%edx, %edx	#
+	call	blake2s_init_words@PLT	#
+.LVL12:
+	.loc 1 31 5 is_stmt 1 view .LVU48
+# blake2xs.c:31:     ctx->xof_len = xof_len;
+	.loc 1 31 18 is_stmt 0 view .LVU49
+	movl	%ebx, 128(%rbp)	# xof_len, ctx_2(D)->xof_len
+	.loc 1 32 5 is_stmt 1 view .LVU50
+# blake2xs.c:32:     return 0;
+	.loc 1 32 12 is_stmt 0 view .LVU51
+	xorl	%eax, %eax	# <retval>
+.LVL13:
+.L12:
+	.loc 1 32 12 view .LVU52
+.LBE31:
+.LBE33:
+# blake2xs.c:46: }
+	.loc 1 46 1 view .LVU53
+	addq	$24, %rsp	#,
+	.cfi_remember_state
+	.cfi_def_cfa_offset 24
+	popq	%rbx	#
+	.cfi_def_cfa_offset 16
+	popq	%rbp	#
+	.cfi_def_cfa_offset 8
+	ret	
+.LVL14:
+	.p2align 4,,10
+	.p2align 3
+.L14:
+	.cfi_restore_state
+.LBB34:
+.LBB32:
+# blake2xs.c:27:         return -1;
+	.loc 1 27 16 view .LVU54
+	movl	$-1, %eax	#, <retval>
+.LVL15:
+	.loc 1 27 16 view .LVU55
+.LBE32:
+.LBE34:
+# blake2xs.c:45:     return bxs_init(ctx, NULL, 0, xof_len);
+	.loc 1 45 12 view .LVU56
+	jmp	.L12	#
+	.cfi_endproc
+.LFE19:
+	.size	blake2xs_init, .-blake2xs_init
+	.p2align 4
+	.globl	blake2xs_update
+	.type	blake2xs_update, @function
+blake2xs_update:
+.LVL16:
+.LFB20:
+	.loc 1 49 1 is_stmt 1 view -0
+	.cfi_startproc
+	.loc 1 50 5 view .LVU58
+	jmp	blake2s_update@PLT	#
+.LVL17:
+	.loc 1 50 5 is_stmt 0 view .LVU59
+	.cfi_endproc
+.LFE20:
+	.size	blake2xs_update, .-blake2xs_update
+	.p2align 4
+	.globl	blake2xs_final
+	.type	blake2xs_final, @function
+blake2xs_final:
+.LVL18:
+.LFB22:
+	.loc 1 65 1 is_stmt 1 view -0
+	.cfi_startproc
+	.loc 1 66 5 view .LVU61
+	.loc 1 67 5 view .LVU62
+	.loc 1 68 5 view .LVU63
+# blake2xs.c:65: {
+	.loc 1 65 1 is_stmt 0 view .LVU64
+	pushq	%rbp	#
+	.cfi_def_cfa_offset 16
+	.cfi_offset 6, -16
+# blake2xs.c:68:     u8 h0[BLAKE2S_BLOCK] = {0}; /* zero-padded message block */
+	.loc 1 68 8 view .LVU65
+	pxor	%xmm0, %xmm0	# tmp235
+# blake2xs.c:65: {
+	.loc 1 65 1 view .LVU66
+	movq	%rsp, %rbp	#,
+	.cfi_def_cfa_register 6
+	pushq	%r15	#
+	pushq	%r14	#
+	pushq	%r13	#
+	pushq	%r12	#
+	pushq	%rbx	#
+	andq	$-64, %rsp	#,
+	subq	$1088, %rsp	#,
+	.cfi_offset 15, -24
+	.cfi_offset 14, -32
+	.cfi_offset 13, -40
+	.cfi_offset 12, -48
+	.cfi_offset 3, -56
+# blake2xs.c:69:     unsigned width = blake2s_kern->lanes;
+	.loc 1 69 14 view .LVU67
+	movq	blake2s_kern(%rip), %rax	# blake2s_kern, blake2s_kern
+# blake2xs.c:68:     u8 h0[BLAKE2S_BLOCK] = {0}; /* zero-padded message block */
+	.loc 1 68 8 view .LVU68
+	movaps	%xmm0, 128(%rsp)	# tmp235, h0
+	movaps	%xmm0, 144(%rsp)	# tmp235, h0
+	movaps	%xmm0, 160(%rsp)	# tmp235, h0
+	movaps	%xmm0, 176(%rsp)	# tmp235, h0
+	.loc 1 69 5 is_stmt 1 view .LVU69
+# blake2xs.c:69:     unsigned width = blake2s_kern->lanes;
+	.loc 1 69 14 is_stmt 0 view .LVU70
+	movl	32(%rax), %r15d	# blake2s_kern.0_1->lanes,
+.LVL19:
+	.loc 1 70 5 is_stmt 1 view .LVU71
+# blake2xs.c:70:     size_t nblocks = (out_len + BLAKE2S_LEN - 1) / BLAKE2S_LEN;
+	.loc 1 70 36 is_stmt 0 view .LVU72
+	leaq	31(%rdx), %rax	#, tmp143
+# blake2xs.c:70:     size_t nblocks = (out_len + BLAKE2S_LEN - 1) / BLAKE2S_LEN;
+	.loc 1 70 12 view .LVU73
+	shrq	$5, %rax	#, tmp143
+# blake2xs.c:65: {
+	.loc 1 65 1 view .LVU74
+	movq	%rdi, 56(%rsp)	# ctx, %sfp
+# blake2xs.c:70:     size_t nblocks = (out_len + BLAKE2S_LEN - 1) / BLAKE2S_LEN;
+	.loc 1 70 12 view .LVU75
+	movq	%rax, 64(%rsp)	# tmp143, %sfp
+.LVL20:
+	.loc 1 72 5 is_stmt 1 view .LVU76
+# blake2xs.c:72:     if (ctx->xof_len == BLAKE2XS_UNKNOWN) {
+	.loc 1 72 12 is_stmt 0 view .LVU77
+	movl	128(%rdi), %eax	# ctx_46(D)->xof_len,
+.LVL21:
+# blake2xs.c:65: {
+	.loc 1 65 1 view .LVU78
+	movq	%rsi, 40(%rsp)	# tmp240, %sfp
+	movq	%rdx, 80(%rsp)	# out_len, %sfp
+# blake2xs.c:72:     if (ctx->xof_len == BLAKE2XS_UNKNOWN) {
+	.loc 1 72 8 view .LVU79
+	cmpl	$65535, %eax	#, _3
+	je	.L75	#,
+	.loc 1 75 12 is_stmt 1 view .LVU80
+# blake2xs.c:75:     } else if (out_len != ctx->xof_len) {
+	.loc 1 75 15 is_stmt 0 view .LVU81
+	cmpq	%rdx, %rax	# out_len, _3
+	jne	.L40	#,
+.L20:
+	.loc 1 78 5 is_stmt 1 view .LVU82
+	leaq	128(%rsp), %rbx	#, tmp233
+	movq	56(%rsp), %rdi	# %sfp,
+.LVL22:
+	.loc 1 78 5 is_stmt 0 view .LVU83
+	movq	%rbx, %rsi	# tmp233,
+.LVL23:
+	.loc 1 78 5 view .LVU84
+	call	blake2s_final@PLT	#
+.LVL24:
+	.loc 1 80 5 is_stmt 1 view .LVU85
+.LBB50:
+	.loc 1 80 10 view .LVU86
+	.loc 1 80 28 view .LVU87
+	testl	%r15d, %r15d	# width
+	je	.L26	#,
+	cmpl	$1, %r15d	#, width
+	je	.L41	#,
+	movl	%r15d, %eax	# width, bnd.34
+	movq	%rbx, %xmm0	# tmp233, tmp148
+	punpcklqdq	%xmm0, %xmm0	# tmp148
+.LVL25:
+	.loc 1 81 9 view .LVU88
+	shrl	%eax	# bnd.34
+# blake2xs.c:81:         m[l] = h0;
+	.loc 1 81 14 is_stmt 0 view .LVU89
+	movaps	%xmm0, 192(%rsp)	# tmp148, MEM <vector(2) long unsigned int> [(const void * *)&m]
+	.loc 1 80 38 is_stmt 1 view .LVU90
+	.loc 1 80 28 view .LVU91
+	cmpl	$1, %eax	#, bnd.34
+	je	.L25	#,
+	.loc 1 81 9 view .LVU92
+# blake2xs.c:81:         m[l] = h0;
+	.loc 1 81 14 is_stmt 0 view .LVU93
+	movaps	%xmm0, 208(%rsp)	# tmp148, MEM <vector(2) long unsigned int> [(const void * *)&m + 16B]
+	.loc 1 80 38 is_stmt 1 view .LVU94
+	.loc 1 80 28 view .LVU95
+	cmpl	$2, %eax	#, bnd.34
+	je	.L25	#,
+	.loc 1 81 9 view .LVU96
+# blake2xs.c:81:         m[l] = h0;
+	.loc 1 81 14 is_stmt 0 view .LVU97
+	movaps	%xmm0, 224(%rsp)	# tmp148, MEM <vector(2) long unsigned int> [(const void * *)&m + 32B]
+	.loc 1 80 38 is_stmt 1 view .LVU98
+	.loc 1 80 28 view .LVU99
+	cmpl	$3, %eax	#, bnd.34
+	je	.L25	#,
+	.loc 1 81 9 view .LVU100
+# blake2xs.c:81:         m[l] = h0;
+	.loc 1 81 14 is_stmt 0 view .LVU101
+	movaps	%xmm0, 240(%rsp)	# tmp148, MEM <vector(2) long unsigned int> [(const void * *)&m + 48B]
+	.loc 1 80 38 is_stmt 1 view .LVU102
+	.loc 1 80 28 view .LVU103
+	cmpl	$4, %eax	#, bnd.34
+	je	.L25	#,
+	.loc 1 81 9 view .LVU104
+# blake2xs.c:81:         m[l] = h0;
+	.loc 1 81 14 is_stmt 0 view .LVU105
+	movaps	%xmm0, 256(%rsp)	# tmp148, MEM <vector(2) long unsigned int> [(const void * *)&m + 64B]
+	.loc 1 80 38 is_stmt 1 view .LVU106
+	.loc 1 80 28 view .LVU107
+	cmpl	$5, %eax	#, bnd.34
+	je	.L25	#,
+	.loc 1 81 9 view .LVU108
+# blake2xs.c:81:         m[l] = h0;
+	.loc 1 81 14 is_stmt 0 view .LVU109
+	movaps	%xmm0, 272(%rsp)	# tmp148, MEM <vector(2) long unsigned int> [(const void * *)&m + 80B]
+	.loc 1 80 38 is_stmt 1 view .LVU110
+	.loc 1 80 28 view .LVU111
+	cmpl	$6, %eax	#, bnd.34
+	je	.L25	#,
+	.loc 1 81 9 view .LVU112
+# blake2xs.c:81:         m[l] = h0;
+	.loc 1 81 14 is_stmt 0 view .LVU113
+	movaps	%xmm0, 288(%rsp)	# tmp148, MEM <vector(2) long unsigned int> [(const void * *)&m + 96B]
+	.loc 1 80 38 is_stmt 1 view .LVU114
+	.loc 1 80 28 view .LVU115
+	cmpl	$7, %eax	#, bnd.34
+	je	.L25	#,
+	.loc 1 81 9 discriminator 3 view .LVU116
+# blake2xs.c:81:         m[l] = h0;
+	.loc 1 81 14 is_stmt 0 discriminator 3 view .LVU117
+	movaps	%xmm0, 304(%rsp)	# tmp148, MEM <vector(2) long unsigned int> [(const void * *)&m + 112B]
+	.loc 1 80 38 is_stmt 1 discriminator 3 view .LVU118
+	.loc 1 80 28 discriminator 3 view .LVU119
+.L25:
+	testb	$1, %r15b	#, width
+	je	.L26	#,
+	movl	%r15d, %eax	# width, l
+	andl	$-2, %eax	#,
+.L24:
+.LVL26:
+	.loc 1 81 9 view .LVU120
+# blake2xs.c:81:         m[l] = h0;
+	.loc 1 81 14 is_stmt 0 view .LVU121
+	movq	%rbx, 192(%rsp,%rax,8)	# tmp233, m[l_292]
+	.loc 1 80 38 is_stmt 1 view .LVU122
+	.loc 1 80 28 view .LVU123
+.LVL27:
+.L26:
+	.loc 1 80 28 is_stmt 0 view .LVU124
+.LBE50:
+.LBB51:
+	.loc 1 82 26 is_stmt 1 view .LVU125
+	cmpq	$0, 64(%rsp)	#, %sfp
+	je	.L23	#,
+	leaq	320(%rsp), %rax	#, tmp229
+.LBB52:
+# blake2xs.c:83:         unsigned k = nblocks - i < width ? nblocks - i : width;
+	.loc 1 83 56 is_stmt 0 view .LVU126
+	movq	64(%rsp), %r8	# %sfp, ivtmp.60
+.LBE52:
+# blake2xs.c:82:     for (size_t i = 0; i < nblocks; i += width) {
+	.loc 1 82 17 view .LVU127
+	xorl	%r13d, %r13d	# i
+	movq	%rax, 88(%rsp)	# tmp229, %sfp
+	leaq	192(%rsp), %rax	#, tmp232
+	movq	%rax, 48(%rsp)	# tmp232, %sfp
+.LBB108:
+# blake2xs.c:98:         blake2s_compress_lanes(&L, m, (1u << k) - 1);
+	.loc 1 98 43 view .LVU128
+	movq	%r15, %rax	# _275, _275
+	movq	%r8, %r15	# ivtmp.60, ivtmp.60
+.LVL28:
+	.loc 1 98 43 view .LVU129
+	movq	%rax, %r8	# _275, _275
+.LVL29:
+	.p2align 4,,10
+	.p2align 3
+.L37:
+	.loc 1 83 9 is_stmt 1 view .LVU130
+# blake2xs.c:83:         unsigned k = nblocks - i < width ? nblocks - i : width;
+	.loc 1 83 56 is_stmt 0 view .LVU131
+	cmpq	%r8, %r15	# _275, ivtmp.60
+	movq	%r8, %r14	# _275, _9
+.LBB53:
+.LBB54:
+# blake2s-internal.h:100:     blake2s_kern->compress_lanes(L, m, mask);
+	.file 2 "blake2s-internal.h"
+	.loc 2 100 17 view .LVU132
+	movq	blake2s_kern(%rip), %rax	# blake2s_kern, blake2s_kern
+.LBE54:
+.LBE53:
+# blake2xs.c:98:         blake2s_compress_lanes(&L, m, (1u << k) - 1);
+	.loc 1 98 43 view .LVU133
+	movl	$1, %r11d	#, tmp161
+# blake2xs.c:83:         unsigned k = nblocks - i < width ? nblocks - i : width;
+	.loc 1 83 56 view .LVU134
+	cmovbe	%r15, %r14	# ivtmp.60,, _9
+.LVL30:
+	.loc 1 84 9 is_stmt 1 view .LVU135
+.LBB59:
+	.loc 1 84 14 view .LVU136
+	.loc 1 84 32 view .LVU137
+.LBE59:
+# blake2xs.c:98:         blake2s_compress_lanes(&L, m, (1u << k) - 1);
+	.loc 1 98 43 is_stmt 0 view .LVU138
+	movl	%r14d, %ecx	# _9, tmp302
+	sall	%cl, %r11d	# tmp302, tmp161
+.LBB67:
+.LBB55:
+# blake2s-internal.h:100:     blake2s_kern->compress_lanes(L, m, mask);
+	.loc 2 100 17 view .LVU139
+	movq	40(%rax), %rcx	# pretmp_299->compress_lanes, pretmp_300
+.LBE55:
+.LBE67:
+# blake2xs.c:98:         blake2s_compress_lanes(&L, m, (1u << k) - 1);
+	.loc 1 98 9 view .LVU140
+	subl	$1, %r11d	#, _298
+.LBB68:
+# blake2xs.c:84:         for (unsigned l = 0; l < k; l++) {
+	.loc 1 84 32 view .LVU141
+	testq	%r14, %r14	# _9
+	je	.L28	#,
+.LBB60:
+# blake2xs.c:90:             L.H[3][l] = blake2s_iv[3] ^ BXS_PARAM3(ctx->xof_len, BLAKE2S_LEN);
+	.loc 1 90 62 view .LVU142
+	movq	56(%rsp), %rax	# %sfp, ctx
+	movq	80(%rsp), %r12	# %sfp, ivtmp.44
+	movl	%r13d, %edi	# i, ivtmp.54
+	leal	0(%r13,%r14), %r10d	#, _189
+	movl	128(%rax), %eax	# ctx_46(D)->xof_len, ctx_46(D)->xof_len
+	movl	%eax, %r9d	# ctx_46(D)->xof_len, ctx_46(D)->xof_len
+	movl	%eax, 72(%rsp)	# ctx_46(D)->xof_len, %sfp
+	movq	%r13, %rax	# i, tmp168
+	salq	$5, %rax	#, tmp168
+	orl	$536870912, %r9d	#, ctx_46(D)->xof_len
+	subq	%rax, %r12	# tmp168, ivtmp.44
+	movq	88(%rsp), %rax	# %sfp, tmp229
+# blake2xs.c:90:             L.H[3][l] = blake2s_iv[3] ^ BXS_PARAM3(ctx->xof_len, BLAKE2S_LEN);
+	.loc 1 90 39 view .LVU143
+	xorl	$-1521486534, %r9d	#, _20
+	movq	%r12, %rsi	# ivtmp.44, ivtmp.52
+	movq	%rax, %rbx	# tmp229, ivtmp.45
+.LVL31:
+	.p2align 4,,10
+	.p2align 3
+.L29:
+	.loc 1 85 13 is_stmt 1 view .LVU144
+	.loc 1 86 13 view .LVU145
+	.loc 1 87 13 view .LVU146
+# blake2xs.c:86:             unsigned dig_len = left < BLAKE2S_LEN ? left : BLAKE2S_LEN;
+	.loc 1 86 49 is_stmt 0 view .LVU147
+	movl	$32, %edx	#, tmp244
+# blake2xs.c:88:             L.H[1][l] = blake2s_iv[1] ^ BLAKE2S_LEN; /* leaf length */
+	.loc 1 88 23 view .LVU148
+	movl	$-1150832987, 64(%rax)	#, MEM[(unsigned int *)_149 + 64B]
+# blake2xs.c:86:             unsigned dig_len = left < BLAKE2S_LEN ? left : BLAKE2S_LEN;
+	.loc 1 86 49 view .LVU149
+	cmpq	%rdx, %rsi	# tmp244, ivtmp.52
+# blake2xs.c:90:             L.H[3][l] = blake2s_iv[3] ^ BXS_PARAM3(ctx->xof_len, BLAKE2S_LEN);
+	.loc 1 90 23 view .LVU150
+	movl	%r9d, 192(%rax)	# _20, MEM[(unsigned int *)_149 + 192B]
+.LBB61:
+# blake2xs.c:92:                 L.H[w][l] = blake2s_iv[w];
+	.loc 1 92 27 view .LVU151
+	movl	$1359893119, 256(%rax)	#, MEM[(unsigned int *)_149 + 256B]
+.LBE61:
+# blake2xs.c:86:             unsigned dig_len = left < BLAKE2S_LEN ? left : BLAKE2S_LEN;
+	.loc 1 86 49 view .LVU152
+	cmovbe	%rsi, %rdx	# ivtmp.52,, tmp169
+.LBE60:
+# blake2xs.c:84:         for (unsigned l = 0; l < k; l++) {
+	.loc 1 84 32 view .LVU153
+	subq	$32, %rsi	#, ivtmp.52
+.LVL32:
+	.loc 1 84 32 view .LVU154
+	addq	$4, %rax	#, ivtmp.53
+.LBB65:
+.LBB62:
+# blake2xs.c:92:                 L.H[w][l] = blake2s_iv[w];
+	.loc 1 92 27 view .LVU155
+	movl	$-1694144372, 316(%rax)	#, MEM[(unsigned int *)_149 + 320B]
+	movl	$528734635, 380(%rax)	#, MEM[(unsigned int *)_149 + 384B]
+.LBE62:
+# blake2xs.c:87:             L.H[0][l] = blake2s_iv[0] ^ LE32W(dig_len,0,0,0);
+	.loc 1 87 39 view .LVU156
+	xorl	$1779033703, %edx	#, tmp170
+	movl	%edx, -4(%rax)	# tmp170, MEM[(unsigned int *)_149]
+	.loc 1 88 13 is_stmt 1 view .LVU157
+	.loc 1 89 13 view .LVU158
+# blake2xs.c:89:             L.H[2][l] = blake2s_iv[2] ^ (u32)(i + l);
+	.loc 1 89 39 is_stmt 0 view .LVU159
+	movl	%edi, %edx	# ivtmp.54, tmp171
+.LBE65:
+# blake2xs.c:84:         for (unsigned l = 0; l < k; l++) {
+	.loc 1 84 32 view .LVU160
+	addl	$1, %edi	#, ivtmp.54
+.LVL33:
+.LBB66:
+.LBB63:
+# blake2xs.c:92:                 L.H[w][l] = blake2s_iv[w];
+	.loc 1 92 27 view .LVU161
+	movl	$1541459225, 444(%rax)	#, MEM[(unsigned int *)_149 + 448B]
+.LBE63:
+# blake2xs.c:89:             L.H[2][l] = blake2s_iv[2] ^ (u32)(i + l);
+	.loc 1 89 39 view .LVU162
+	xorl	$1013904242, %edx	#, tmp171
+.LVL34:
+	.loc 1 89 39 view .LVU163
+	movl	%edx, 124(%rax)	# tmp171, MEM[(unsigned int *)_149 + 128B]
+	.loc 1 90 13 is_stmt 1 view .LVU164
+	.loc 1 91 13 view .LVU165
+.LBB64:
+	.loc 1 91 18 view .LVU166
+.LVL35:
+	.loc 1 91 36 view .LVU167
+	.loc 1 92 17 view .LVU168
+	.loc 1 91 42 view .LVU169
+	.loc 1 91 36 view .LVU170
+	.loc 1 92 17 view .LVU171
+	.loc 1 91 42 view .LVU172
+	.loc 1 91 36 view .LVU173
+	.loc 1 92 17 view .LVU174
+	.loc 1 91 42 view .LVU175
+	.loc 1 91 36 view .LVU176
+	.loc 1 92 17 view .LVU177
+	.loc 1 91 42 view .LVU178
+	.loc 1 91 36 view .LVU179
+.LBE64:
+	.loc 1 93 13 view .LVU180
+# blake2xs.c:93:             L.t[0][l] = BLAKE2S_LEN;
+	.loc 1 93 23 is_stmt 0 view .LVU181
+	movl	$32, 508(%rax)	#, MEM[(unsigned int *)_149 + 512B]
+	.loc 1 94 13 is_stmt 1 view .LVU182
+# blake2xs.c:94:             L.t[1][l] = 0;
+	.loc 1 94 23 is_stmt 0 view .LVU183
+	movl	$0, 572(%rax)	#, MEM[(unsigned int *)_149 + 576B]
+	.loc 1 95 13 is_stmt 1 view .LVU184
+# blake2xs.c:95:             L.f[0][l] = ~0U;
+	.loc 1 95 23 is_stmt 0 view .LVU185
+	movl	$-1, 636(%rax)	#, MEM[(unsigned int *)_149 + 640B]
+	.loc 1 96 13 is_stmt 1 view .LVU186
+# blake2xs.c:96:             L.f[1][l] = 0;
+	.loc 1 96 23 is_stmt 0 view .LVU187
+	movl	$0, 700(%rax)	#, MEM[(unsigned int *)_149 + 704B]
+.LBE66:
+	.loc 1 84 38 is_stmt 1 view .LVU188
+.LVL36:
+	.loc 1 84 32 view .LVU189
+	cmpl	%r10d, %edi	# _189, ivtmp.54
+	jne	.L29	#,
+.LBE68:
+.LBB69:
+.LBB56:
+# blake2s-internal.h:100:     blake2s_kern->compress_lanes(L, m, mask);
+	.loc 2 100 5 is_stmt 0 view .LVU190
+	movq	%r8, 72(%rsp)	# _275, %sfp
+.LBE56:
+.LBE69:
+	.loc 1 98 9 is_stmt 1 view .LVU191
+.LVL37:
+.LBB70:
+.LBI53:
+	.loc 2 97 20 view .LVU192
+.LBB57:
+	.loc 2 100 5 view .LVU193
+	movq	48(%rsp), %rsi	# %sfp,
+.LVL38:
+	.loc 2 100 5 is_stmt 0 view .LVU194
+	movl	%r11d, %edx	# _298,
+	movq	88(%rsp), %rdi	# %sfp,
+	call	*%rcx	# pretmp_300
+.LVL39:
+	.loc 2 100 5 view .LVU195
+.LBE57:
+.LBE70:
+	.loc 1 99 9 is_stmt 1 view .LVU196
+.LBB71:
+	.loc 1 99 14 view .LVU197
+	.loc 1 99 32 view .LVU198
+	movq	88(%rsp), %rcx	# %sfp, tmp229
+	leal	-1(%r14), %eax	#, tmp175
+	movq	72(%rsp), %r8	# %sfp, _275
+	leaq	96(%rsp), %r9	#, tmp231
+	leaq	4(%rcx), %rsi	#, ivtmp.45
+	movq	80(%rsp), %rcx	# %sfp, out_len
+	leaq	(%rsi,%rax,4), %r11	#, _112
+	movq	40(%rsp), %rax	# %sfp, out
+	leaq	(%rax,%rcx), %r10	#, tmp228
+.LVL40:
+	.p2align 4,,10
+	.p2align 3
+.L36:
+.LBB72:
+	.loc 1 100 13 discriminator 3 view .LVU199
+	.loc 1 101 13 discriminator 3 view .LVU200
+.LBB73:
+.LBI73:
+	.loc 1 54 13 discriminator 3 view .LVU201
+.LBB74:
+	.loc 1 57 5 discriminator 3 view .LVU202
+	.loc 1 58 5 discriminator 3 view .LVU203
+.LBB75:
+	.loc 1 58 10 discriminator 3 view .LVU204
+	.loc 1 58 28 discriminator 3 view .LVU205
+	.loc 1 59 9 discriminator 3 view .LVU206
+.LBB76:
+.LBI76:
+	.loc 2 222 20 discriminator 3 view .LVU207
+.LBB77:
+	.loc 2 223 5 discriminator 3 view .LVU208
+	.loc 2 224 5 discriminator 3 view .LVU209
+	.loc 2 225 5 discriminator 3 view .LVU210
+	.loc 2 226 5 discriminator 3 view .LVU211
+# blake2s-internal.h:223:     *y++ = x & 0xff;
+	.loc 2 223 10 is_stmt 0 discriminator 3 view .LVU212
+	movl	(%rbx), %eax	# MEM[(unsigned int *)_66], MEM[(unsigned int *)_66]
+.LBE77:
+.LBE76:
+.LBE75:
+.LBE74:
+.LBE73:
+# blake2xs.c:101:             bxs_output(&L, l, out + (i + l) * BLAKE2S_LEN,
+	.loc 1 101 13 discriminator 3 view .LVU213
+	movq	%r10, %rdx	# tmp228, tmp187
+	subq	%r12, %rdx	# ivtmp.44, tmp187
+.LBB99:
+.LBB95:
+.LBB94:
+.LBB86:
+.LBB78:
+# blake2s-internal.h:223:     *y++ = x & 0xff;
+	.loc 2 223 10 discriminator 3 view .LVU214
+	movl	%eax, 96(%rsp)	# MEM[(unsigned int *)_66], MEM <unsigned int> [(unsigned char *)&digest]
+.LVL41:
+	.loc 2 223 10 discriminator 3 view .LVU215
+.LBE78:
+.LBE86:
+	.loc 1 58 34 is_stmt 1 discriminator 3 view .LVU216
+	.loc 1 58 28 discriminator 3 view .LVU217
+	.loc 1 59 9 discriminator 3 view .LVU218
+.LBB87:
+	.loc 2 222 20 discriminator 3 view .LVU219
+.LBB79:
+	.loc 2 223 5 discriminator 3 view .LVU220
+	.loc 2 224 5 discriminator 3 view .LVU221
+	.loc 2 225 5 discriminator 3 view .LVU222
+	.loc 2 226 5 discriminator 3 view .LVU223
+# blake2s-internal.h:223:     *y++ = x & 0xff;
+	.loc 2 223 10 is_stmt 0 discriminator 3 view .LVU224
+	movl	64(%rbx), %eax	# MEM[(unsigned int *)_66 + 64B], MEM[(unsigned int *)_66 + 64B]
+	movl	%eax, 100(%rsp)	# MEM[(unsigned int *)_66 + 64B], MEM <unsigned int> [(unsigned char *)&digest + 4B]
+.LVL42:
+	.loc 2 223 10 discriminator 3 view .LVU225
+.LBE79:
+.LBE87:
+	.loc 1 58 34 is_stmt 1 discriminator 3 view .LVU226
+	.loc 1 58 28 discriminator 3 view .LVU227
+	.loc 1 59 9 discriminator 3 view .LVU228
+.LBB88:
+	.loc 2 222 20 discriminator 3 view .LVU229
+.LBB80:
+	.loc 2 223 5 discriminator 3 view .LVU230
+	.loc 2 224 5 discriminator 3 view .LVU231
+	.loc 2 225 5 discriminator 3 view .LVU232
+	.loc 2 226 5 discriminator 3 view .LVU233
+# blake2s-internal.h:223:     *y++ = x & 0xff;
+	.loc 2 223 10 is_stmt 0 discriminator 3 view .LVU234
+	movl	128(%rbx), %eax	# MEM[(unsigned int *)_66 + 128B], MEM[(unsigned int *)_66 + 128B]
+	movl	%eax, 104(%rsp)	# MEM[(unsigned int *)_66 + 128B], MEM <unsigned int> [(unsigned char *)&digest + 8B]
+.LVL43:
+	.loc 2 223 10 discriminator 3 view .LVU235
+.LBE80:
+.LBE88:
+	.loc 1 58 34 is_stmt 1 discriminator 3 view .LVU236
+	.loc 1 58 28 discriminator 3 view .LVU237
+	.loc 1 59 9 discriminator 3 view .LVU238
+.LBB89:
+	.loc 2 222 20 discriminator 3 view .LVU239
+.LBB81:
+	.loc 2 223 5 discriminator 3 view .LVU240
+	.loc 2 224 5 discriminator 3 view .LVU241
+	.loc 2 225 5 discriminator 3 view .LVU242
+	.loc 2 226 5 discriminator 3 view .LVU243
+# blake2s-internal.h:223:     *y++ = x & 0xff;
+	.loc 2 223 10 is_stmt 0 discriminator 3 view .LVU244
+	movl	192(%rbx), %eax	# MEM[(unsigned int *)_66 + 192B], MEM[(unsigned int *)_66 + 192B]
+	movl	%eax, 108(%rsp)	# MEM[(unsigned int *)_66 + 192B], MEM <unsigned int> [(unsigned char *)&digest + 12B]
+.LVL44:
+	.loc 2 223 10 discriminator 3 view .LVU245
+.LBE81:
+.LBE89:
+	.loc 1 58 34 is_stmt 1 discriminator 3 view .LVU246
+	.loc 1 58 28 discriminator 3 view .LVU247
+	.loc 1 59 9 discriminator 3 view .LVU248
+.LBB90:
+	.loc 2 222 20 discriminator 3 view .LVU249
+.LBB82:
+	.loc 2 223 5 discriminator 3 view .LVU250
+	.loc 2 224 5 discriminator 3 view .LVU251
+	.loc 2 225 5 discriminator 3 view .LVU252
+	.loc 2 226 5 discriminator 3 view .LVU253
+# blake2s-internal.h:223:     *y++ = x & 0xff;
+	.loc 2 223 10 is_stmt 0 discriminator 3 view .LVU254
+	movl	256(%rbx), %eax	# MEM[(unsigned int *)_66 + 256B], MEM[(unsigned int *)_66 + 256B]
+	movl	%eax, 112(%rsp)	# MEM[(unsigned int *)_66 + 256B], MEM <unsigned int> [(unsigned char *)&digest + 16B]
+.LVL45:
+	.loc 2 223 10 discriminator 3 view .LVU255
+.LBE82:
+.LBE90:
+	.loc 1 58 34 is_stmt 1 discriminator 3 view .LVU256
+	.loc 1 58 28 discriminator 3 view .LVU257
+	.loc 1 59 9 discriminator 3 view .LVU258
+.LBB91:
+	.loc 2 222 20 discriminator 3 view .LVU259
+.LBB83:
+	.loc 2 223 5 discriminator 3 view .LVU260
+	.loc 2 224 5 discriminator 3 view .LVU261
+	.loc 2 225 5 discriminator 3 view .LVU262
+	.loc 2 226 5 discriminator 3 view .LVU263
+# blake2s-internal.h:223:     *y++ = x & 0xff;
+	.loc 2 223 10 is_stmt 0 discriminator 3 view .LVU264
+	movl	320(%rbx), %eax	# MEM[(unsigned int *)_66 + 320B], MEM[(unsigned int *)_66 + 320B]
+	movl	%eax, 116(%rsp)	# MEM[(unsigned int *)_66 + 320B], MEM <unsigned int> [(unsigned char *)&digest + 20B]
+.LVL46:
+	.loc 2 223 10 discriminator 3 view .LVU265
+.LBE83:
+.LBE91:
+	.loc 1 58 34 is_stmt 1 discriminator 3 view .LVU266
+	.loc 1 58 28 discriminator 3 view .LVU267
+	.loc 1 59 9 discriminator 3 view .LVU268
+.LBB92:
+	.loc 2 222 20 discriminator 3 view .LVU269
+.LBB84:
+	.loc 2 223 5 discriminator 3 view .LVU270
+	.loc 2 224 5 discriminator 3 view .LVU271
+	.loc 2 225 5 discriminator 3 view .LVU272
+	.loc 2 226 5 discriminator 3 view .LVU273
+# blake2s-internal.h:223:     *y++ = x & 0xff;
+	.loc 2 223 10 is_stmt 0 discriminator 3 view .LVU274
+	movl	384(%rbx), %eax	# MEM[(unsigned int *)_66 + 384B], MEM[(unsigned int *)_66 + 384B]
+	movl	%eax, 120(%rsp)	# MEM[(unsigned int *)_66 + 384B], MEM <unsigned int> [(unsigned char *)&digest + 24B]
+.LVL47:
+	.loc 2 223 10 discriminator 3 view .LVU275
+.LBE84:
+.LBE92:
+	.loc 1 58 34 is_stmt 1 discriminator 3 view .LVU276
+	.loc 1 58 28 discriminator 3 view .LVU277
+	.loc 1 59 9 discriminator 3 view .LVU278
+.LBB93:
+	.loc 2 222 20 discriminator 3 view .LVU279
+.LBB85:
+	.loc 2 223 5 discriminator 3 view .LVU280
+	.loc 2 224 5 discriminator 3 view .LVU281
+	.loc 2 225 5 discriminator 3 view .LVU282
+	.loc 2 226 5 discriminator 3 view .LVU283
+# blake2s-internal.h:223:     *y++ = x & 0xff;
+	.loc 2 223 10 is_stmt 0 discriminator 3 view .LVU284
+	movl	448(%rbx), %eax	# MEM[(unsigned int *)_66 + 448B], MEM[(unsigned int *)_66 + 448B]
+	movl	%eax, 124(%rsp)	# MEM[(unsigned int *)_66 + 448B], MEM <unsigned int> [(unsigned char *)&digest + 28B]
+.LVL48:
+	.loc 2 223 10 discriminator 3 view .LVU285
+.LBE85:
+.LBE93:
+	.loc 1 58 34 is_stmt 1 discriminator 3 view .LVU286
+	.loc 1 58 28 discriminator 3 view .LVU287
+.LBE94:
+	.loc 1 60 5 discriminator 3 view .LVU288
+.LBE95:
+.LBE99:
+# blake2xs.c:101:             bxs_output(&L, l, out + (i + l) * BLAKE2S_LEN,
+	.loc 1 101 13 is_stmt 0 discriminator 3 view .LVU289
+	movl	$32, %eax	#, tmp243
+	cmpq	%rax, %r12	# tmp243, ivtmp.44
+	cmovbe	%r12, %rax	# ivtmp.44,, tmp188
+.LBB100:
+.LBB96:
+# blake2xs.c:60:     memcpy(out, digest, len);
+	.loc 1 60 5 discriminator 3 view .LVU290
+	cmpl	$8, %eax	#, tmp188
+	jnb	.L30	#,
+	.loc 1 60 5 discriminator 3 view .LVU291
+	testb	$4, %al	#, tmp188
+	jne	.L76	#,
+	testl	%eax, %eax	# tmp188
+	je	.L31	#,
+	movzbl	(%r9), %ecx	#, tmp202
+	movb	%cl, (%rdx)	# tmp202,
+.LVL49:
+	.loc 1 60 5 discriminator 3 view .LVU292
+	testb	$2, %al	#, tmp188
+	jne	.L77	#,
+.L31:
+.LVL50:
+	.loc 1 60 5 discriminator 3 view .LVU293
+.LBE96:
+.LBE100:
+.LBE72:
+	.loc 1 99 38 is_stmt 1 discriminator 3 view .LVU294
+	.loc 1 99 32 discriminator 3 view .LVU295
+	subq	$32, %r12	#, ivtmp.44
+.LVL51:
+	.loc 1 99 32 is_stmt 0 discriminator 3 view .LVU296
+	movq	%rsi, %rbx	# ivtmp.45, ivtmp.45
+	cmpq	%r11, %rsi	# _112, ivtmp.45
+	je	.L38	#,
+.LVL52:
+.L78:
+	.loc 1 99 32 discriminator 3 view .LVU297
+	addq	$4, %rsi	#, ivtmp.45
+	jmp	.L36	#
+.LVL53:
+	.p2align 4,,10
+	.p2align 3
+.L30:
+.LBB103:
+.LBB101:
+.LBB97:
+# blake2xs.c:60:     memcpy(out, digest, len);
+	.loc 1 60 5 discriminator 3 view .LVU298
+	movq	(%r9), %rcx	#, tmp211
+	movq	%rcx, (%rdx)	# tmp211,
+.LVL54:
+	.loc 1 60 5 discriminator 3 view .LVU299
+	movl	%eax, %ecx	# tmp188, tmp212
+	movq	-8(%r9,%rcx), %rdi	#, tmp218
+	movq	%rdi, -8(%rdx,%rcx)	# tmp218,
+	leaq	8(%rdx), %rcx	#, tmp219
+	movq	%r9, %rdi	# tmp231, tmp192
+	andq	$-8, %rcx	#, tmp219
+	subq	%rcx, %rdx	# tmp219, tmp191
+	addl	%edx, %eax	# tmp191, tmp190
+	subq	%rdx, %rdi	# tmp191, tmp192
+	andl	$-8, %eax	#, tmp190
+	cmpl	$8, %eax	#, tmp190
+	jb	.L31	#,
+	andl	$-8, %eax	#, tmp221
+	xorl	%edx, %edx	# tmp220
+.LVL55:
+.L34:
+	.loc 1 60 5 discriminator 3 view .LVU300
+	movl	%edx, %ebx	# tmp220, tmp222
+	addl	$8, %edx	#, tmp220
+	movq	(%rdi,%rbx), %r14	#, tmp223
+	movq	%r14, (%rcx,%rbx)	# tmp223,
+	cmpl	%eax, %edx	# tmp221, tmp220
+	jb	.L34	#,
+.LVL56:
+	.loc 1 60 5 discriminator 3 view .LVU301
+.LBE97:
+.LBE101:
+.LBE103:
+	.loc 1 99 38 is_stmt 1 view .LVU302
+	.loc 1 99 32 view .LVU303
+	subq	$32, %r12	#, ivtmp.44
+.LVL57:
+	.loc 1 99 32 is_stmt 0 view .LVU304
+	movq	%rsi, %rbx	# ivtmp.45, ivtmp.45
+	cmpq	%r11, %rsi	# _112, ivtmp.45
+	jne	.L78	#,
+.LVL58:
+.L38:
+	.loc 1 99 32 view .LVU305
+.LBE71:
+.LBE108:
+	.loc 1 82 39 is_stmt 1 discriminator 2 view .LVU306
+# blake2xs.c:82:     for (size_t i = 0; i < nblocks; i += width) {
+	.loc 1 82 26 is_stmt 0 discriminator 2 view .LVU307
+	movq	64(%rsp), %rax	# %sfp, nblocks
+# blake2xs.c:82:     for (size_t i = 0; i < nblocks; i += width) {
+	.loc 1 82 39 discriminator 2 view .LVU308
+	addq	%r8, %r13	# _275, i
+.LVL59:
+	.loc 1 82 26 is_stmt 1 discriminator 2 view .LVU309
+	subq	%r8, %r15	# _275, ivtmp.60
+	.loc 1 82 26 is_stmt 0 discriminator 2 view .LVU310
+	cmpq	%rax, %r13	# nblocks, i
+	jb	.L37	#,
+.LVL60:
+.L23:
+	.loc 1 82 26 discriminator 2 view .LVU311
+.LBE51:
+	.loc 1 105 5 is_stmt 1 view .LVU312
+	.loc 1 106 5 view .LVU313
+	.loc 1 107 5 view .LVU314
+	movq	56(%rsp), %rax	# %sfp, ctx
+	leaq	8(%rax), %rdi	#, tmp158
+	movq	$0, (%rax)	#,* ctx
+	movq	$0, 136(%rax)	#,
+	andq	$-8, %rdi	#, tmp158
+	subq	%rdi, %rax	# tmp158, ctx
+	movq	%rax, %rcx	# ctx, ctx
+	xorl	%eax, %eax	# tmp154
+	addl	$144, %ecx	#, tmp153
+	shrl	$3, %ecx	#,
+	rep stosq
+	.loc 1 108 5 view .LVU315
+.L17:
+# blake2xs.c:109: }
+	.loc 1 109 1 is_stmt 0 view .LVU316
+	leaq	-40(%rbp), %rsp	#,
+	popq	%rbx	#
+	popq	%r12	#
+	popq	%r13	#
+	popq	%r14	#
+	popq	%r15	#
+	popq	%rbp	#
+	.cfi_remember_state
+	.cfi_def_cfa 7, 8
+	ret	
+.LVL61:
+.L76:
+	.cfi_restore_state
+.LBB110:
+.LBB109:
+.LBB105:
+.LBB104:
+.LBB102:
+.LBB98:
+# blake2xs.c:60:     memcpy(out, digest, len);
+	.loc 1 60 5 discriminator 3 view .LVU317
+	movl	(%r9), %ecx	#, tmp194
+	movl	%eax, %eax	# tmp188, tmp195
+	movl	%ecx, (%rdx)	# tmp194,
+.LVL62:
+	.loc 1 60 5 discriminator 3 view .LVU318
+	movl	-4(%r9,%rax), %ecx	#, tmp201
+	movl	%ecx, -4(%rdx,%rax)	# tmp201,
+	jmp	.L31	#
+.L77:
+	movl	%eax, %eax	# tmp188, tmp205
+	movzwl	-2(%r9,%rax), %ecx	#, tmp210
+	movw	%cx, -2(%rdx,%rax)	# tmp210,
+	jmp	.L31	#
+.LVL63:
+.L28:
+	.loc 1 60 5 discriminator 3 view .LVU319
+	movq	%r8, 72(%rsp)	# _275, %sfp
+.LBE98:
+.LBE102:
+.LBE104:
+.LBE105:
+	.loc 1 98 9 is_stmt 1 view .LVU320
+.LVL64:
+.LBB106:
+	.loc 2 97 20 view .LVU321
+.LBB58:
+	.loc 2 100 5 view .LVU322
+	movq	48(%rsp), %rsi	# %sfp,
+	movl	%r11d, %edx	# _298,
+	movq	88(%rsp), %rdi	# %sfp,
+	call	*%rcx	# pretmp_300
+.LVL65:
+	.loc 2 100 5 is_stmt 0 view .LVU323
+.LBE58:
+.LBE106:
+	.loc 1 99 9 is_stmt 1 view .LVU324
+.LBB107:
+	.loc 1 99 14 view .LVU325
+	.loc 1 99 32 view .LVU326
+	movq	72(%rsp), %r8	# %sfp, _275
+.LBE107:
+.LBE109:
+	.loc 1 82 39 view .LVU327
+# blake2xs.c:82:     for (size_t i = 0; i < nblocks; i += width) {
+	.loc 1 82 26 is_stmt 0 view .LVU328
+	movq	64(%rsp), %rax	# %sfp, nblocks
+# blake2xs.c:82:     for (size_t i = 0; i < nblocks; i += width) {
+	.loc 1 82 39 view .LVU329
+	addq	%r8, %r13	# _275, i
+.LVL66:
+	.loc 1 82 26 is_stmt 1 view .LVU330
+	subq	%r8, %r15	# _275, ivtmp.60
+	cmpq	%rax, %r13	# nblocks, i
+	jb	.L37	#,
+	jmp	.L23	#
+.LVL67:
+.L75:
+	.loc 1 82 26 is_stmt 0 view .LVU331
+.LBE110:
+	.loc 1 73 9 is_stmt 1 view .LVU332
+# blake2xs.c:73:         if (!out_len || (uint64_t)out_len > BLAKE2XS_MAX_UNKNOWN)
+	.loc 1 73 22 is_stmt 0 view .LVU333
+	movq	%rdx, %rax	# out_len, out_len
+	subq	$1, %rax	#, tmp144
+# blake2xs.c:73:         if (!out_len || (uint64_t)out_len > BLAKE2XS_MAX_UNKNOWN)
+	.loc 1 73 12 view .LVU334
+	shrq	$37, %rax	#, tmp245
+	je	.L20	#,
+.L40:
+# blake2xs.c:74:             return -1;
+	.loc 1 74 20 view .LVU335
+	movl	$-1, %eax	#, <retval>
+	jmp	.L17	#
+.LVL68:
+.L41:
+.LBB111:
+# blake2xs.c:80:     for (unsigned l = 0; l < width; l++)
+	.loc 1 80 19 view .LVU336
+	xorl	%eax, %eax	#
+	jmp	.L24	#
+.LBE111:
+	.cfi_endproc
+.LFE22:
+	.size	blake2xs_final, .-blake2xs_final
+	.section	.rodata.cst8,"aM",@progbits,8
+	.align 8
+.LC0:
+	.long	16842784
+	.long	0
+	.text
+.Letext0:
+	.file 3 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stddef.h"
+	.file 4 "/usr/include/x86_64-linux-gnu/bits/types.h"
+	.file 5 "/usr/include/x86_64-linux-gnu/bits/stdint-uintn.h"
+	.file 6 "blake2s.h"
+	.file 7 "blake2xs.h"
+	.file 8 "/usr/include/string.h"
+	.section	.debug_info,"",@progbits
+.Ldebug_info0:
+	.long	0xab3
+	.value	0x5
+	.byte	0x1
+	.byte	0x8
+	.long	.Ldebug_abbrev0
+	.uleb128 0x22
+	.long	.LASF53
+	.byte	0xc
+	.long	.LASF0
+	.long	.LASF1
+	.quad	.Ltext0
+	.quad	.Letext0-.Ltext0
+	.long	.Ldebug_line0
+	.uleb128 0xb
+	.long	.LASF8
+	.byte	0x3
+	.byte	0xd6
+	.byte	0x1b
+	.long	0x3a
+	.uleb128 0x7
+	.byte	0x8
+	.byte	0x7
+	.long	.LASF2
+	.uleb128 0x7
+	.byte	0x8
+	.byte	0x5
+	.long	.LASF3
+	.uleb128 0x23
+	.byte	0x4
+	.byte	0x5
+	.string	"int"
+	.uleb128 0x7
+	.byte	0x1
+	.byte	0x8
+	.long	.LASF4
+	.uleb128 0x7
+	.byte	0x2
+	.byte	0x7
+	.long	.LASF5
+	.uleb128 0x7
+	.byte	0x4
+	.byte	0x7
+	.long	.LASF6
+	.uleb128 0x7
+	.byte	0x1
+	.byte	0x6
+	.long	.LASF7
+	.uleb128 0xb
+	.long	.LASF9
+	.byte	0x4
+	.byte	0x26
+	.byte	0x17
+	.long	0x4f
+	.uleb128 0x7
+	.byte	0x2
+	.byte	0x5
+	.long	.LASF10
+	.uleb128 0xb
+	.long	.LASF11
+	.byte	0x4
+	.byte	0x2a
+	.byte	0x16
+	.long	0x5d
+	.uleb128 0xb
+	.long	.LASF12
+	.byte	0x4
+	.byte	0x2d
+	.byte	0x1b
+	.long	0x3a
+	.uleb128 0x24
+	.byte	0x8
+	.uleb128 0x7
+	.byte	0x1
+	.byte	0x6
+	.long	.LASF13
+	.uleb128 0xc
+	.long	0x98
+	.uleb128 0xb
+	.long	.LASF14
+	.byte	0x5
+	.byte	0x18
+	.byte	0x13
+	.long	0x6b
+	.uleb128 0xb
+	.long	.LASF15
+	.byte	0x5
+	.byte	0x1a
+	.byte	0x14
+	.long	0x7e
+	.uleb128 0xb
+	.long	.LASF16
+	.byte	0x5
+	.byte	0x1b
+	.byte	0x14
+	.long	0x8a
+	.uleb128 0x1b
+	.long	.LASF20
+	.byte	0x80
+	.byte	0x6
+	.byte	0xf7
+	.long	0x12a
+	.uleb128 0xf
+	.string	"H"
+	.byte	0x6
+	.byte	0xf8
+	.byte	0xe
+	.long	0x12a
+	.byte	0
+	.uleb128 0xf
+	.string	"buf"
+	.byte	0x6
+	.byte	0xf9
+	.byte	0x13
+	.long	0x13a
+	.byte	0x20
+	.uleb128 0xf
+	.string	"t"
+	.byte	0x6
+	.byte	0xfa
+	.byte	0xe
+	.long	0x14a
+	.byte	0x60
+	.uleb128 0xf
+	.string	"f"
+	.byte	0x6
+	.byte	0xfb
+	.byte	0xe
+	.long	0x14a
+	.byte	0x68
+	.uleb128 0x8
+	.long	.LASF17
+	.byte	0x6
+	.byte	0xfc
+	.byte	0xe
+	.long	0x5d
+	.byte	0x70
+	.uleb128 0x8
+	.long	.LASF18
+	.byte	0x6
+	.byte	0xfd
+	.byte	0xe
+	.long	0x5d
+	.byte	0x74
+	.uleb128 0x8
+	.long	.LASF19
+	.byte	0x6
+	.byte	0xfe
+	.byte	0xe
+	.long	0x5d
+	.byte	0x78
+	.byte	0
+	.uleb128 0x6
+	.long	0xb0
+	.long	0x13a
+	.uleb128 0x4
+	.long	0x3a
+	.byte	0x7
+	.byte	0
+	.uleb128 0x6
+	.long	0x4f
+	.long	0x14a
+	.uleb128 0x4
+	.long	0x3a
+	.byte	0x3f
+	.byte	0
+	.uleb128 0x6
+	.long	0xb0
+	.long	0x15a
+	.uleb128 0x4
+	.long	0x3a
+	.byte	0x1
+	.byte	0
+	.uleb128 0x5
+	.long	0xc8
+	.uleb128 0x5
+	.long	0x164
+	.uleb128 0x25
+	.uleb128 0x5
+	.long	0x4f
+	.uleb128 0x1b
+	.long	.LASF21
+	.byte	0x90
+	.byte	0x7
+	.byte	0x27
+	.long	0x190
+	.uleb128 0x26
+	.string	"S"
+	.byte	0x7
+	.byte	0x28
+	.byte	0x18
+	.long	0xc8
+	.byte	0x10
+	.byte	0
+	.uleb128 0x8
+	.long	.LASF22
+	.byte	0x7
+	.byte	0x29
+	.byte	0xe
+	.long	0x5d
+	.byte	0x80
+	.byte	0
+	.uleb128 0x7
+	.byte	0x8
+	.byte	0x7
+	.long	.LASF23
+	.uleb128 0x7
+	.byte	0x8
+	.byte	0x5
+	.long	.LASF24
+	.uleb128 0x1c
+	.string	"u8"
+	.byte	0x7
+	.byte	0x11
+	.long	0xa4
+	.uleb128 0xc
+	.long	0x19e
+	.uleb128 0x1c
+	.string	"u32"
+	.byte	0x8
+	.byte	0x12
+	.long	0xb0
+	.uleb128 0xc
+	.long	0x1ad
+	.uleb128 0x6
+	.long	0x1b8
+	.long	0x1cd
+	.uleb128 0x4
+	.long	0x3a
+	.byte	0x7
+	.byte	0
+	.uleb128 0xc
+	.long	0x1bd
+	.uleb128 0x1d
+	.long	.LASF44
+	.byte	0x2
+	.byte	0xa
+	.byte	0x12
+	.long	0x1cd
+	.uleb128 0x6
+	.long	0x1a8
+	.long	0x1f4
+	.uleb128 0x4
+	.long	0x3a
+	.byte	0x9
+	.uleb128 0x4
+	.long	0x3a
+	.byte	0xf
+	.byte	0
+	.uleb128 0xc
+	.long	0x1de
+	.uleb128 0x27
+	.long	.LASF38
+	.byte	0x2
+	.byte	0xf
+	.byte	0x11
+	.long	0x1f4
+	.byte	0xa0
+	.byte	0
+	.byte	0x1
+	.byte	0x2
+	.byte	0x3
+	.byte	0x4
+	.byte	0x5
+	.byte	0x6
+	.byte	0x7
+	.byte	0x8
+	.byte	0x9
+	.byte	0xa
+	.byte	0xb
+	.byte	0xc
+	.byte	0xd
+	.byte	0xe
+	.byte	0xf
+	.byte	0xe
+	.byte	0xa
+	.byte	0x4
+	.byte	0x8
+	.byte	0x9
+	.byte	0xf
+	.byte	0xd
+	.byte	0x6
+	.byte	0x1
+	.byte	0xc
+	.byte	0
+	.byte	0x2
+	.byte	0xb
+	.byte	0x7
+	.byte	0x5
+	.byte	0x3
+	.byte	0xb
+	.byte	0x8
+	.byte	0xc
+	.byte	0
+	.byte	0x5
+	.byte	0x2
+	.byte	0xf
+	.byte	0xd
+	.byte	0xa
+	.byte	0xe
+	.byte	0x3
+	.byte	0x6
+	.byte	0x7
+	.byte	0x1
+	.byte	0x9
+	.byte	0x4
+	.byte	0x7
+	.byte	0x9
+	.byte	0x3
+	.byte	0x1
+	.byte	0xd
+	.byte	0xc
+	.byte	0xb
+	.byte	0xe
+	.byte	0x2
+	.byte	0x6
+	.byte	0x5
+	.byte	0xa
+	.byte	0x4
+	.byte	0
+	.byte	0xf
+	.byte	0x8
+	.byte	0x9
+	.byte	0
+	.byte	0x5
+	.byte	0x7
+	.byte	0x2
+	.byte	0x4
+	.byte	0xa
+	.byte	0xf
+	.byte	0xe
+	.byte	0x1
+	.byte	0xb
+	.byte	0xc
+	.byte	0x6
+	.byte	0x8
+	.byte	0x3
+	.byte	0xd
+	.byte	0x2
+	.byte	0xc
+	.byte	0x6
+	.byte	0xa
+	.byte	0
+	.byte	0xb
+	.byte	0x8
+	.byte	0x3
+	.byte	0x4
+	.byte	0xd
+	.byte	0x7
+	.byte	0x5
+	.byte	0xf
+	.byte	0xe
+	.byte	0x1
+	.byte	0x9
+	.byte	0xc
+	.byte	0x5
+	.byte	0x1
+	.byte	0xf
+	.byte	0xe
+	.byte	0xd
+	.byte	0x4
+	.byte	0xa
+	.byte	0
+	.byte	0x7
+	.byte	0x6
+	.byte	0x3
+	.byte	0x9
+	.byte	0x2
+	.byte	0x8
+	.byte	0xb
+	.byte	0xd
+	.byte	0xb
+	.byte	0x7
+	.byte	0xe
+	.byte	0xc
+	.byte	0x1
+	.byte	0x3
+	.byte	0x9
+	.byte	0x5
+	.byte	0
+	.byte	0xf
+	.byte	0x4
+	.byte	0x8
+	.byte	0x6
+	.byte	0x2
+	.byte	0xa
+	.byte	0x6
+	.byte	0xf
+	.byte	0xe
+	.byte	0x9
+	.byte	0xb
+	.byte	0x3
+	.byte	0
+	.byte	0x8
+	.byte	0xc
+	.byte	0x2
+	.byte	0xd
+	.byte	0x7
+	.byte	0x1
+	.byte	0x4
+	.byte	0xa
+	.byte	0x5
+	.byte	0xa
+	.byte	0x2
+	.byte	0x8
+	.byte	0x4
+	.byte	0x7
+	.byte	0x6
+	.byte	0x1
+	.byte	0x5
+	.byte	0xf
+	.byte	0xb
+	.byte	0x9
+	.byte	0xe
+	.byte	0x3
+	.byte	0xc
+	.byte	0xd
+	.byte	0
+	.uleb128 0x28
+	.long	.LASF25
+	.value	0x300
+	.byte	0x40
+	.byte	0x2
+	.byte	0x25
+	.byte	0x8
+	.long	0x2d5
+	.uleb128 0xf
+	.string	"H"
+	.byte	0x2
+	.byte	0x26
+	.byte	0x9
+	.long	0x2da
+	.byte	0
+	.uleb128 0x1e
+	.string	"t"
+	.byte	0x27
+	.long	0x2f0
+	.value	0x200
+	.uleb128 0x1e
+	.string	"f"
+	.byte	0x28
+	.long	0x2f0
+	.value	0x280
+	.byte	0
+	.uleb128 0xc
+	.long	0x2a6
+	.uleb128 0x6
+	.long	0x1ad
+	.long	0x2f0
+	.uleb128 0x4
+	.long	0x3a
+	.byte	0x7
+	.uleb128 0x4
+	.long	0x3a
+	.byte	0xf
+	.byte	0
+	.uleb128 0x6
+	.long	0x1ad
+	.long	0x306
+	.uleb128 0x4
+	.long	0x3a
+	.byte	0x1
+	.uleb128 0x4
+	.long	0x3a
+	.byte	0xf
+	.byte	0
+	.uleb128 0x29
+	.long	.LASF54
+	.byte	0x30
+	.byte	0x2
+	.byte	0x31
+	.byte	0x8
+	.long	0x362
+	.uleb128 0x8
+	.long	.LASF26
+	.byte	0x2
+	.byte	0x32
+	.byte	0x11
+	.long	0x367
+	.byte	0
+	.uleb128 0x8
+	.long	.LASF27
+	.byte	0x2
+	.byte	0x33
+	.byte	0xb
+	.long	0x371
+	.byte	0x8
+	.uleb128 0x8
+	.long	.LASF28
+	.byte	0x2
+	.byte	0x34
+	.byte	0xc
+	.long	0x386
+	.byte	0x10
+	.uleb128 0x8
+	.long	.LASF29
+	.byte	0x2
+	.byte	0x35
+	.byte	0xc
+	.long	0x3a0
+	.byte	0x18
+	.uleb128 0x8
+	.long	.LASF30
+	.byte	0x2
+	.byte	0x37
+	.byte	0xe
+	.long	0x5d
+	.byte	0x20
+	.uleb128 0x8
+	.long	.LASF31
+	.byte	0x2
+	.byte	0x38
+	.byte	0xc
+	.long	0x3c4
+	.byte	0x28
+	.byte	0
+	.uleb128 0xc
+	.long	0x306
+	.uleb128 0x5
+	.long	0x9f
+	.uleb128 0x2a
+	.long	0x48
+	.uleb128 0x5
+	.long	0x36c
+	.uleb128 0x14
+	.long	0x386
+	.uleb128 0x1
+	.long	0x15a
+	.uleb128 0x1
+	.long	0x15f
+	.byte	0
+	.uleb128 0x5
+	.long	0x376
+	.uleb128 0x14
+	.long	0x3a0
+	.uleb128 0x1
+	.long	0x15a
+	.uleb128 0x1
+	.long	0x15f
+	.uleb128 0x1
+	.long	0x2e
+	.byte	0
+	.uleb128 0x5
+	.long	0x38b
+	.uleb128 0x14
+	.long	0x3ba
+	.uleb128 0x1
+	.long	0x3ba
+	.uleb128 0x1
+	.long	0x3bf
+	.uleb128 0x1
+	.long	0x5d
+	.byte	0
+	.uleb128 0x5
+	.long	0x2a6
+	.uleb128 0x5
+	.long	0x15f
+	.uleb128 0x5
+	.long	0x3a5
+	.uleb128 0x2b
+	.long	.LASF39
+	.byte	0x2
+	.byte	0x3c
+	.byte	0x25
+	.long	0x3d5
+	.uleb128 0x5
+	.long	0x362
+	.uleb128 0x1f
+	.long	.LASF32
+	.byte	0x2b
+	.long	0x96
+	.long	0x3f8
+	.uleb128 0x1
+	.long	0x96
+	.uleb128 0x1
+	.long	0x15f
+	.uleb128 0x1
+	.long	0x2e
+	.byte	0
+	.uleb128 0x1f
+	.long	.LASF33
+	.byte	0x3d
+	.long	0x96
+	.long	0x416
+	.uleb128 0x1
+	.long	0x96
+	.uleb128 0x1
+	.long	0x48
+	.uleb128 0x1
+	.long	0x2e
+	.byte	0
+	.uleb128 0x15
+	.long	.LASF34
+	.byte	0x6
+	.byte	0x47
+	.long	0x42c
+	.uleb128 0x1
+	.long	0x15a
+	.uleb128 0x1
+	.long	0x165
+	.byte	0
+	.uleb128 0x15
+	.long	.LASF35
+	.byte	0x6
+	.byte	0x46
+	.long	0x447
+	.uleb128 0x1
+	.long	0x15a
+	.uleb128 0x1
+	.long	0x15f
+	.uleb128 0x1
+	.long	0x2e
+	.byte	0
+	.uleb128 0x15
+	.long	.LASF36
+	.byte	0x2
+	.byte	0x77
+	.long	0x471
+	.uleb128 0x1
+	.long	0x15a
+	.uleb128 0x1
+	.long	0x471
+	.uleb128 0x1
+	.long	0x15f
+	.uleb128 0x1
+	.long	0x15f
+	.uleb128 0x1
+	.long	0x15f
+	.uleb128 0x1
+	.long	0x5d
+	.byte	0
+	.uleb128 0x5
+	.long	0x1b8
+	.uleb128 0x16
+	.long	.LASF46
+	.byte	0x3f
+	.long	0x48
+	.quad	.LFB22
+	.quad	.LFE22-.LFB22
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0x745
+	.uleb128 0xa
+	.string	"ctx"
+	.byte	0x3f
+	.byte	0x29
+	.long	0x745
+	.long	.LLST19
+	.long	.LVUS19
+	.uleb128 0xa
+	.string	"out"
+	.byte	0x3f
+	.byte	0x3d
+	.long	0x165
+	.long	.LLST20
+	.long	.LVUS20
+	.uleb128 0x12
+	.long	.LASF37
+	.byte	0x40
+	.byte	0x1b
+	.long	0x2e
+	.long	.LLST21
+	.long	.LVUS21
+	.uleb128 0x17
+	.string	"L"
+	.byte	0x42
+	.byte	0x1a
+	.long	0x2a6
+	.uleb128 0x3
+	.byte	0x77
+	.sleb128 320
+	.uleb128 0x17
+	.string	"m"
+	.byte	0x43
+	.byte	0x11
+	.long	0x74a
+	.uleb128 0x3
+	.byte	0x77
+	.sleb128 192
+	.uleb128 0x17
+	.string	"h0"
+	.byte	0x44
+	.byte	0x8
+	.long	0x75a
+	.uleb128 0x3
+	.byte	0x77
+	.sleb128 128
+	.uleb128 0x10
+	.long	.LASF40
+	.byte	0x45
+	.byte	0xe
+	.long	0x5d
+	.long	.LLST22
+	.long	.LVUS22
+	.uleb128 0x10
+	.long	.LASF41
+	.byte	0x46
+	.byte	0xc
+	.long	0x2e
+	.long	.LLST23
+	.long	.LVUS23
+	.uleb128 0x13
+	.long	.LLRL24
+	.long	0x538
+	.uleb128 0xe
+	.string	"l"
+	.byte	0x50
+	.byte	0x13
+	.long	0x5d
+	.long	.LLST25
+	.long	.LVUS25
+	.byte	0
+	.uleb128 0x13
+	.long	.LLRL26
+	.long	0x729
+	.uleb128 0xe
+	.string	"i"
+	.byte	0x52
+	.byte	0x11
+	.long	0x2e
+	.long	.LLST27
+	.long	.LVUS27
+	.uleb128 0xd
+	.long	.LLRL28
+	.uleb128 0xe
+	.string	"k"
+	.byte	0x53
+	.byte	0x12
+	.long	0x5d
+	.long	.LLST29
+	.long	.LVUS29
+	.uleb128 0x13
+	.long	.LLRL34
+	.long	0x5c6
+	.uleb128 0xe
+	.string	"l"
+	.byte	0x54
+	.byte	0x17
+	.long	0x5d
+	.long	.LLST35
+	.long	.LVUS35
+	.uleb128 0xd
+	.long	.LLRL36
+	.uleb128 0x10
+	.long	.LASF42
+	.byte	0x55
+	.byte	0x14
+	.long	0x2e
+	.long	.LLST37
+	.long	.LVUS37
+	.uleb128 0x10
+	.long	.LASF43
+	.byte	0x56
+	.byte	0x16
+	.long	0x5d
+	.long	.LLST38
+	.long	.LVUS38
+	.uleb128 0xd
+	.long	.LLRL39
+	.uleb128 0xe
+	.string	"w"
+	.byte	0x5b
+	.byte	0x1b
+	.long	0x5d
+	.long	.LLST40
+	.long	.LVUS40
+	.byte	0
+	.byte	0
+	.byte	0
+	.uleb128 0x13
+	.long	.LLRL41
+	.long	0x69a
+	.uleb128 0xe
+	.string	"l"
+	.byte	0x63
+	.byte	0x17
+	.long	0x5d
+	.long	.LLST42
+	.long	.LVUS42
+	.uleb128 0xd
+	.long	.LLRL43
+	.uleb128 0x10
+	.long	.LASF42
+	.byte	0x64
+	.byte	0x14
+	.long	0x2e
+	.long	.LLST44
+	.long	.LVUS44
+	.uleb128 0x11
+	.long	0x76a
+	.quad	.LBI73
+	.value	.LVU201
+	.long	.LLRL45
+	.byte	0x65
+	.byte	0xd
+	.uleb128 0x3
+	.long	0x797
+	.long	.LLST46
+	.long	.LVUS46
+	.uleb128 0x3
+	.long	0x78b
+	.long	.LLST47
+	.long	.LVUS47
+	.uleb128 0x3
+	.long	0x781
+	.long	.LLST48
+	.long	.LVUS48
+	.uleb128 0x3
+	.long	0x777
+	.long	.LLST49
+	.long	.LVUS49
+	.uleb128 0xd
+	.long	.LLRL45
+	.uleb128 0x18
+	.long	0x7a3
+	.uleb128 0x3
+	.byte	0x77
+	.sleb128 96
+	.uleb128 0x2c
+	.long	0x7af
+	.long	.LLRL50
+	.uleb128 0x2d
+	.long	0x7b0
+	.long	.LLST51
+	.long	.LVUS51
+	.uleb128 0x11
+	.long	0xa6a
+	.quad	.LBI76
+	.value	.LVU207
+	.long	.LLRL52
+	.byte	0x3b
+	.byte	0x9
+	.uleb128 0x3
+	.long	0xa81
+	.long	.LLST53
+	.long	.LVUS53
+	.uleb128 0x3
+	.long	0xa77
+	.long	.LLST54
+	.long	.LVUS54
+	.byte	0
+	.byte	0
+	.byte	0
+	.byte	0
+	.byte	0
+	.byte	0
+	.uleb128 0x11
+	.long	0xa8c
+	.quad	.LBI53
+	.value	.LVU192
+	.long	.LLRL30
+	.byte	0x62
+	.byte	0x9
+	.uleb128 0x3
+	.long	0xaa9
+	.long	.LLST31
+	.long	.LVUS31
+	.uleb128 0x3
+	.long	0xa9f
+	.long	.LLST32
+	.long	.LVUS32
+	.uleb128 0x3
+	.long	0xa95
+	.long	.LLST33
+	.long	.LVUS33
+	.uleb128 0x2e
+	.quad	.LVL39
+	.long	0x700
+	.uleb128 0x2
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x4
+	.byte	0x77
+	.sleb128 88
+	.byte	0x6
+	.uleb128 0x2
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x3
+	.byte	0x77
+	.sleb128 48
+	.byte	0x6
+	.uleb128 0x2
+	.uleb128 0x1
+	.byte	0x51
+	.uleb128 0x9
+	.byte	0x31
+	.byte	0x7e
+	.sleb128 0
+	.byte	0x8
+	.byte	0xff
+	.byte	0x1a
+	.byte	0x24
+	.byte	0x31
+	.byte	0x1c
+	.byte	0
+	.uleb128 0x2f
+	.quad	.LVL65
+	.uleb128 0x2
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x4
+	.byte	0x77
+	.sleb128 88
+	.byte	0x6
+	.uleb128 0x2
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x3
+	.byte	0x77
+	.sleb128 48
+	.byte	0x6
+	.uleb128 0x2
+	.uleb128 0x1
+	.byte	0x51
+	.uleb128 0x9
+	.byte	0x31
+	.byte	0x7e
+	.sleb128 0
+	.byte	0x8
+	.byte	0xff
+	.byte	0x1a
+	.byte	0x24
+	.byte	0x31
+	.byte	0x1c
+	.byte	0
+	.byte	0
+	.byte	0
+	.byte	0
+	.uleb128 0x19
+	.quad	.LVL24
+	.long	0x416
+	.uleb128 0x2
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x3
+	.byte	0x77
+	.sleb128 56
+	.byte	0x6
+	.uleb128 0x2
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x2
+	.byte	0x73
+	.sleb128 0
+	.byte	0
+	.byte	0
+	.uleb128 0x5
+	.long	0x16a
+	.uleb128 0x6
+	.long	0x15f
+	.long	0x75a
+	.uleb128 0x4
+	.long	0x3a
+	.byte	0xf
+	.byte	0
+	.uleb128 0x6
+	.long	0x19e
+	.long	0x76a
+	.uleb128 0x4
+	.long	0x3a
+	.byte	0x3f
+	.byte	0
+	.uleb128 0x20
+	.long	.LASF50
+	.byte	0x1
+	.byte	0x36
+	.byte	0xd
+	.byte	0x1
+	.long	0x7bb
+	.uleb128 0x9
+	.string	"L"
+	.byte	0x1
+	.byte	0x36
+	.byte	0x34
+	.long	0x7bb
+	.uleb128 0x9
+	.string	"l"
+	.byte	0x1
+	.byte	0x36
+	.byte	0x40
+	.long	0x5d
+	.uleb128 0x9
+	.string	"out"
+	.byte	0x1
+	.byte	0x37
+	.byte	0x27
+	.long	0x165
+	.uleb128 0x9
+	.string	"len"
+	.byte	0x1
+	.byte	0x37
+	.byte	0x33
+	.long	0x2e
+	.uleb128 0x1d
+	.long	.LASF45
+	.byte	0x1
+	.byte	0x39
+	.byte	0x8
+	.long	0x7c0
+	.uleb128 0x30
+	.uleb128 0x21
+	.string	"i"
+	.byte	0x3a
+	.byte	0x13
+	.long	0x5d
+	.byte	0
+	.byte	0
+	.uleb128 0x5
+	.long	0x2d5
+	.uleb128 0x6
+	.long	0x19e
+	.long	0x7d0
+	.uleb128 0x4
+	.long	0x3a
+	.byte	0x1f
+	.byte	0
+	.uleb128 0x31
+	.long	.LASF55
+	.byte	0x1
+	.byte	0x30
+	.byte	0x6
+	.quad	.LFB20
+	.quad	.LFE20-.LFB20
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0x84b
+	.uleb128 0xa
+	.string	"ctx"
+	.byte	0x30
+	.byte	0x2b
+	.long	0x745
+	.long	.LLST16
+	.long	.LVUS16
+	.uleb128 0xa
+	.string	"src"
+	.byte	0x30
+	.byte	0x3c
+	.long	0x15f
+	.long	.LLST17
+	.long	.LVUS17
+	.uleb128 0xa
+	.string	"len"
+	.byte	0x30
+	.byte	0x48
+	.long	0x2e
+	.long	.LLST18
+	.long	.LVUS18
+	.uleb128 0x32
+	.quad	.LVL17
+	.long	0x42c
+	.uleb128 0x2
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x3
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x3
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x2
+	.uleb128 0x1
+	.byte	0x51
+	.uleb128 0x3
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x51
+	.byte	0
+	.byte	0
+	.uleb128 0x16
+	.long	.LASF47
+	.byte	0x2b
+	.long	0x48
+	.quad	.LFB19
+	.quad	.LFE19-.LFB19
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0x918
+	.uleb128 0xa
+	.string	"ctx"
+	.byte	0x2b
+	.byte	0x28
+	.long	0x745
+	.long	.LLST9
+	.long	.LVUS9
+	.uleb128 0x12
+	.long	.LASF22
+	.byte	0x2b
+	.byte	0x36
+	.long	0x5d
+	.long	.LLST10
+	.long	.LVUS10
+	.uleb128 0x11
+	.long	0xa0f
+	.quad	.LBI29
+	.value	.LVU37
+	.long	.LLRL11
+	.byte	0x2d
+	.byte	0xc
+	.uleb128 0x3
+	.long	0xa44
+	.long	.LLST12
+	.long	.LVUS12
+	.uleb128 0x3
+	.long	0xa38
+	.long	.LLST13
+	.long	.LVUS13
+	.uleb128 0x3
+	.long	0xa2c
+	.long	.LLST13
+	.long	.LVUS13
+	.uleb128 0x3
+	.long	0xa20
+	.long	.LLST15
+	.long	.LVUS15
+	.uleb128 0xd
+	.long	.LLRL11
+	.uleb128 0x18
+	.long	0xa50
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -48
+	.uleb128 0x19
+	.quad	.LVL12
+	.long	0x447
+	.uleb128 0x2
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x76
+	.sleb128 0
+	.uleb128 0x2
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -48
+	.uleb128 0x2
+	.uleb128 0x1
+	.byte	0x51
+	.uleb128 0x1
+	.byte	0x30
+	.uleb128 0x2
+	.uleb128 0x1
+	.byte	0x52
+	.uleb128 0x1
+	.byte	0x30
+	.uleb128 0x2
+	.uleb128 0x1
+	.byte	0x58
+	.uleb128 0x1
+	.byte	0x30
+	.uleb128 0x2
+	.uleb128 0x1
+	.byte	0x59
+	.uleb128 0x1
+	.byte	0x30
+	.byte	0
+	.byte	0
+	.byte	0
+	.byte	0
+	.uleb128 0x16
+	.long	.LASF48
+	.byte	0x23
+	.long	0x48
+	.quad	.LFB18
+	.quad	.LFE18-.LFB18
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0xa0f
+	.uleb128 0xa
+	.string	"ctx"
+	.byte	0x23
+	.byte	0x2e
+	.long	0x745
+	.long	.LLST0
+	.long	.LVUS0
+	.uleb128 0xa
+	.string	"key"
+	.byte	0x23
+	.byte	0x3f
+	.long	0x15f
+	.long	.LLST1
+	.long	.LVUS1
+	.uleb128 0x12
+	.long	.LASF49
+	.byte	0x24
+	.byte	0x22
+	.long	0x5d
+	.long	.LLST2
+	.long	.LVUS2
+	.uleb128 0x12
+	.long	.LASF22
+	.byte	0x24
+	.byte	0x34
+	.long	0x5d
+	.long	.LLST3
+	.long	.LVUS3
+	.uleb128 0x11
+	.long	0xa0f
+	.quad	.LBI17
+	.value	.LVU8
+	.long	.LLRL4
+	.byte	0x28
+	.byte	0xc
+	.uleb128 0x3
+	.long	0xa44
+	.long	.LLST5
+	.long	.LVUS5
+	.uleb128 0x3
+	.long	0xa38
+	.long	.LLST6
+	.long	.LVUS6
+	.uleb128 0x3
+	.long	0xa2c
+	.long	.LLST7
+	.long	.LVUS7
+	.uleb128 0x3
+	.long	0xa20
+	.long	.LLST8
+	.long	.LVUS8
+	.uleb128 0xd
+	.long	.LLRL4
+	.uleb128 0x18
+	.long	0xa50
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -48
+	.uleb128 0x19
+	.quad	.LVL5
+	.long	0x447
+	.uleb128 0x2
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x76
+	.sleb128 0
+	.uleb128 0x2
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -48
+	.uleb128 0x2
+	.uleb128 0x1
+	.byte	0x51
+	.uleb128 0x1
+	.byte	0x30
+	.uleb128 0x2
+	.uleb128 0x1
+	.byte	0x52
+	.uleb128 0x1
+	.byte	0x30
+	.uleb128 0x2
+	.uleb128 0x1
+	.byte	0x58
+	.uleb128 0x3
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x2
+	.uleb128 0x1
+	.byte	0x59
+	.uleb128 0x3
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x51
+	.byte	0
+	.byte	0
+	.byte	0
+	.byte	0
+	.uleb128 0x33
+	.long	.LASF56
+	.byte	0x1
+	.byte	0x14
+	.byte	0xc
+	.long	0x48
+	.byte	0x1
+	.long	0xa5a
+	.uleb128 0x9
+	.string	"ctx"
+	.byte	0x1
+	.byte	0x14
+	.byte	0x2a
+	.long	0x745
+	.uleb128 0x9
+	.string	"key"
+	.byte	0x1
+	.byte	0x14
+	.byte	0x3b
+	.long	0x15f
+	.uleb128 0x1a
+	.long	.LASF49
+	.byte	0x1
+	.byte	0x15
+	.byte	0x1e
+	.long	0x5d
+	.uleb128 0x1a
+	.long	.LASF22
+	.byte	0x1
+	.byte	0x15
+	.byte	0x30
+	.long	0x5d
+	.uleb128 0x21
+	.string	"P"
+	.byte	0x17
+	.byte	0xf
+	.long	0xa5a
+	.byte	0
+	.uleb128 0x6
+	.long	0x1b8
+	.long	0xa6a
+	.uleb128 0x4
+	.long	0x3a
+	.byte	0x3
+	.byte	0
+	.uleb128 0x20
+	.long	.LASF51
+	.byte	0x2
+	.byte	0xde
+	.byte	0x14
+	.byte	0x3
+	.long	0xa8c
+	.uleb128 0x9
+	.string	"y"
+	.byte	0x2
+	.byte	0xde
+	.byte	0x2e
+	.long	0x165
+	.uleb128 0x9
+	.string	"x"
+	.byte	0x2
+	.byte	0xde
+	.byte	0x35
+	.long	0x1ad
+	.byte	0
+	.uleb128 0x34
+	.long	.LASF57
+	.byte	0x2
+	.byte	0x61
+	.byte	0x14
+	.byte	0x3
+	.uleb128 0x9
+	.string	"L"
+	.byte	0x2
+	.byte	0x61
+	.byte	0x41
+	.long	0x3ba
+	.uleb128 0x9
+	.string	"m"
+	.byte	0x2
+	.byte	0x62
+	.byte	0x37
+	.long	0x3bf
+	.uleb128 0x1a
+	.long	.LASF52
+	.byte	0x2
+	.byte	0x62
+	.byte	0x45
+	.long	0x5d
+	.byte	0
+	.byte	0
+	.section	.debug_abbrev,"",@progbits
+.Ldebug_abbrev0:
+	.uleb128 0x1
+	.uleb128 0x5
+	.byte	0
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x2
+	.uleb128 0x49
+	.byte	0
+	.uleb128 0x2
+	.uleb128 0x18
+	.uleb128 0x7e
+	.uleb128 0x18
+	.byte	0
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x5
+	.byte	0
+	.uleb128 0x31
+	.uleb128 0x13
+	.uleb128 0x2
+	.uleb128 0x17
+	.uleb128 0x2137
+	.uleb128 0x17
+	.byte	0
+	.byte	0
+	.uleb128 0x4
+	.uleb128 0x21
+	.byte	0
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x2f
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x5
+	.uleb128 0xf
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0x21
+	.sleb128 8
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x6
+	.uleb128 0x1
+	.byte	0x1
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x7
+	.uleb128 0x24
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x3e
+	.uleb128 0xb
+	.uleb128 0x3
+	.uleb128 0xe
+	.byte	0
+	.byte	0
+	.uleb128 0x8
+	.uleb128 0xd
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x38
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x9
+	.uleb128 0x5
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x8
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0xa
+	.uleb128 0x5
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x8
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x2
+	.uleb128 0x17
+	.uleb128 0x2137
+	.uleb128 0x17
+	.byte	0
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0x16
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0xc
+	.uleb128 0x26
+	.byte	0
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0xd
+	.uleb128 0xb
+	.byte	0x1
+	.uleb128 0x55
+	.uleb128 0x17
+	.byte	0
+	.byte	0
+	.uleb128 0xe
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x8
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x2
+	.uleb128 0x17
+	.uleb128 0x2137
+	.uleb128 0x17
+	.byte	0
+	.byte	0
+	.uleb128 0xf
+	.uleb128 0xd
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x8
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x38
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x10
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x2
+	.uleb128 0x17
+	.uleb128 0x2137
+	.uleb128 0x17
+	.byte	0
+	.byte	0
+	.uleb128 0x11
+	.uleb128 0x1d
+	.byte	0x1
+	.uleb128 0x31
+	.uleb128 0x13
+	.uleb128 0x52
+	.uleb128 0x1
+	.uleb128 0x2138
+	.uleb128 0x5
+	.uleb128 0x55
+	.uleb128 0x17
+	.uleb128 0x58
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x59
+	.uleb128 0xb
+	.uleb128 0x57
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x12
+	.uleb128 0x5
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x2
+	.uleb128 0x17
+	.uleb128 0x2137
+	.uleb128 0x17
+	.byte	0
+	.byte	0
+	.uleb128 0x13
+	.uleb128 0xb
+	.byte	0x1
+	.uleb128 0x55
+	.uleb128 0x17
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x14
+	.uleb128 0x15
+	.byte	0x1
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x15
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 6
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x3c
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x16
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 5
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x11
+	.uleb128 0x1
+	.uleb128 0x12
+	.uleb128 0x7
+	.uleb128 0x40
+	.uleb128 0x18
+	.uleb128 0x7a
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x17
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x8
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x2
+	.uleb128 0x18
+	.byte	0
+	.byte	0
+	.uleb128 0x18
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x31
+	.uleb128 0x13
+	.uleb128 0x2
+	.uleb128 0x18
+	.byte	0
+	.byte	0
+	.uleb128 0x19
+	.uleb128 0x48
+	.byte	0x1
+	.uleb128 0x7d
+	.uleb128 0x1
+	.uleb128 0x7f
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x1a
+	.uleb128 0x5
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x1b
+	.uleb128 0x13
+	.byte	0x1
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x88
+	.uleb128 0x21
+	.sleb128 16
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 8
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x1c
+	.uleb128 0x16
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x8
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 2
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x1d
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x1e
+	.uleb128 0xd
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x8
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 2
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 9
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x38
+	.uleb128 0x5
+	.byte	0
+	.byte	0
+	.uleb128 0x1f
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 8
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 14
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x3c
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x20
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x20
+	.uleb128 0xb
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x21
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x8
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x22
+	.uleb128 0x11
+	.byte	0x1
+	.uleb128 0x25
+	.uleb128 0xe
+	.uleb128 0x13
+	.uleb128 0xb
+	.uleb128 0x3
+	.uleb128 0x1f
+	.uleb128 0x1b
+	.uleb128 0x1f
+	.uleb128 0x11
+	.uleb128 0x1
+	.uleb128 0x12
+	.uleb128 0x7
+	.uleb128 0x10
+	.uleb128 0x17
+	.byte	0
+	.byte	0
+	.uleb128 0x23
+	.uleb128 0x24
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x3e
+	.uleb128 0xb
+	.uleb128 0x3
+	.uleb128 0x8
+	.byte	0
+	.byte	0
+	.uleb128 0x24
+	.uleb128 0xf
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x25
+	.uleb128 0x26
+	.byte	0
+	.byte	0
+	.byte	0
+	.uleb128 0x26
+	.uleb128 0xd
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x8
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x88
+	.uleb128 0xb
+	.uleb128 0x38
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x27
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x1c
+	.uleb128 0xa
+	.byte	0
+	.byte	0
+	.uleb128 0x28
+	.uleb128 0x13
+	.byte	0x1
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0xb
+	.uleb128 0x5
+	.uleb128 0x88
+	.uleb128 0xb
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x29
+	.uleb128 0x13
+	.byte	0x1
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x2a
+	.uleb128 0x15
+	.byte	0
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x2b
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3c
+	.uleb128 0x19
+	.byte	0
+	.byte	0
+	.uleb128 0x2c
+	.uleb128 0xb
+	.byte	0x1
+	.uleb128 0x31
+	.uleb128 0x13
+	.uleb128 0x55
+	.uleb128 0x17
+	.byte	0
+	.byte	0
+	.uleb128 0x2d
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x31
+	.uleb128 0x13
+	.uleb128 0x2
+	.uleb128 0x17
+	.uleb128 0x2137
+	.uleb128 0x17
+	.byte	0
+	.byte	0
+	.uleb128 0x2e
+	.uleb128 0x48
+	.byte	0x1
+	.uleb128 0x7d
+	.uleb128 0x1
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x2f
+	.uleb128 0x48
+	.byte	0x1
+	.uleb128 0x7d
+	.uleb128 0x1
+	.byte	0
+	.byte	0
+	.uleb128 0x30
+	.uleb128 0xb
+	.byte	0x1
+	.byte	0
+	.byte	0
+	.uleb128 0x31
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x11
+	.uleb128 0x1
+	.uleb128 0x12
+	.uleb128 0x7
+	.uleb128 0x40
+	.uleb128 0x18
+	.uleb128 0x7a
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x32
+	.uleb128 0x48
+	.byte	0x1
+	.uleb128 0x7d
+	.uleb128 0x1
+	.uleb128 0x82
+	.uleb128 0x19
+	.uleb128 0x7f
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x33
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x20
+	.uleb128 0xb
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x34
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x20
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.byte	0
+	.section	.debug_loclists,"",@progbits
+	.long	.Ldebug_loc3-.Ldebug_loc2
+.Ldebug_loc2:
+	.value	0x5
+	.byte	0x8
+	.byte	0
+	.long	0
+.Ldebug_loc0:
+.LVUS19:
+	.uleb128 0
+	.uleb128 .LVU83
+	.uleb128 .LVU83
+	.uleb128 .LVU130
+	.uleb128 .LVU130
+	.uleb128 .LVU331
+	.uleb128 .LVU331
+	.uleb128 .LVU336
+	.uleb128 .LVU336
+	.uleb128 0
+.LLST19:
+	.byte	0x4
+	.uleb128 .LVL18-.Ltext0
+	.uleb128 .LVL22-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL22-.Ltext0
+	.uleb128 .LVL29-.Ltext0
+	.uleb128 0x2
+	.byte	0x77
+	.sleb128 56
+	.byte	0x4
+	.uleb128 .LVL29-.Ltext0
+	.uleb128 .LVL67-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL67-.Ltext0
+	.uleb128 .LVL68-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL68-.Ltext0
+	.uleb128 .LFE22-.Ltext0
+	.uleb128 0x2
+	.byte	0x77
+	.sleb128 56
+	.byte	0
+.LVUS20:
+	.uleb128 0
+	.uleb128 .LVU84
+	.uleb128 .LVU84
+	.uleb128 .LVU130
+	.uleb128 .LVU130
+	.uleb128 .LVU331
+	.uleb128 .LVU331
+	.uleb128 .LVU336
+	.uleb128 .LVU336
+	.uleb128 0
+.LLST20:
+	.byte	0x4
+	.uleb128 .LVL18-.Ltext0
+	.uleb128 .LVL23-.Ltext0
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x4
+	.uleb128 .LVL23-.Ltext0
+	.uleb128 .LVL29-.Ltext0
+	.uleb128 0x2
+	.byte	0x77
+	.sleb128 40
+	.byte	0x4
+	.uleb128 .LVL29-.Ltext0
+	.uleb128 .LVL67-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL67-.Ltext0
+	.uleb128 .LVL68-.Ltext0
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x4
+	.uleb128 .LVL68-.Ltext0
+	.uleb128 .LFE22-.Ltext0
+	.uleb128 0x2
+	.byte	0x77
+	.sleb128 40
+	.byte	0
+.LVUS21:
+	.uleb128 0
+	.uleb128 .LVU85
+	.uleb128 .LVU85
+	.uleb128 .LVU130
+	.uleb128 .LVU130
+	.uleb128 .LVU331
+	.uleb128 .LVU331
+	.uleb128 .LVU336
+	.uleb128 .LVU336
+	.uleb128 0
+.LLST21:
+	.byte	0x4
+	.uleb128 .LVL18-.Ltext0
+	.uleb128 .LVL24-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x51
+	.byte	0x4
+	.uleb128 .LVL24-1-.Ltext0
+	.uleb128 .LVL29-.Ltext0
+	.uleb128 0x3
+	.byte	0x77
+	.sleb128 80
+	.byte	0x4
+	.uleb128 .LVL29-.Ltext0
+	.uleb128 .LVL67-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x51
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL67-.Ltext0
+	.uleb128 .LVL68-.Ltext0
+	.uleb128 0x1
+	.byte	0x51
+	.byte	0x4
+	.uleb128 .LVL68-.Ltext0
+	.uleb128 .LFE22-.Ltext0
+	.uleb128 0x3
+	.byte	0x77
+	.sleb128 80
+	.byte	0
+.LVUS22:
+	.uleb128 .LVU71
+	.uleb128 .LVU129
+	.uleb128 .LVU129
+	.uleb128 .LVU130
+	.uleb128 .LVU331
+	.uleb128 0
+.LLST22:
+	.byte	0x4
+	.uleb128 .LVL19-.Ltext0
+	.uleb128 .LVL28-.Ltext0
+	.uleb128 0x1
+	.byte	0x5f
+	.byte	0x4
+	.uleb128 .LVL28-.Ltext0
+	.uleb128 .LVL29-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL67-.Ltext0
+	.uleb128 .LFE22-.Ltext0
+	.uleb128 0x1
+	.byte	0x5f
+	.byte	0
+.LVUS23:
+	.uleb128 .LVU76
+	.uleb128 .LVU78
+	.uleb128 .LVU78
+	.uleb128 .LVU130
+	.uleb128 .LVU130
+	.uleb128 .LVU331
+	.uleb128 .LVU331
+	.uleb128 0
+.LLST23:
+	.byte	0x4
+	.uleb128 .LVL20-.Ltext0
+	.uleb128 .LVL21-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL21-.Ltext0
+	.uleb128 .LVL29-.Ltext0
+	.uleb128 0x3
+	.byte	0x77
+	.sleb128 64
+	.byte	0x4
+	.uleb128 .LVL29-.Ltext0
+	.uleb128 .LVL67-.Ltext0
+	.uleb128 0x8
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x51
+	.byte	0x23
+	.uleb128 0x1f
+	.byte	0x35
+	.byte	0x25
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL67-.Ltext0
+	.uleb128 .LFE22-.Ltext0
+	.uleb128 0x3
+	.byte	0x77
+	.sleb128 64
+	.byte	0
+.LVUS25:
+	.uleb128 .LVU87
+	.uleb128 .LVU88
+	.uleb128 .LVU336
+	.uleb128 0
+.LLST25:
+	.byte	0x4
+	.uleb128 .LVL24-.Ltext0
+	.uleb128 .LVL25-.Ltext0
+	.uleb128 0x2
+	.byte	0x30
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL68-.Ltext0
+	.uleb128 .LFE22-.Ltext0
+	.uleb128 0x2
+	.byte	0x30
+	.byte	0x9f
+	.byte	0
+.LVUS27:
+	.uleb128 .LVU124
+	.uleb128 .LVU130
+	.uleb128 .LVU130
+	.uleb128 .LVU311
+	.uleb128 .LVU317
+	.uleb128 .LVU331
+.LLST27:
+	.byte	0x4
+	.uleb128 .LVL27-.Ltext0
+	.uleb128 .LVL29-.Ltext0
+	.uleb128 0x2
+	.byte	0x30
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL29-.Ltext0
+	.uleb128 .LVL60-.Ltext0
+	.uleb128 0x1
+	.byte	0x5d
+	.byte	0x4
+	.uleb128 .LVL61-.Ltext0
+	.uleb128 .LVL67-.Ltext0
+	.uleb128 0x1
+	.byte	0x5d
+	.byte	0
+.LVUS29:
+	.uleb128 .LVU135
+	.uleb128 .LVU199
+	.uleb128 .LVU319
+	.uleb128 .LVU331
+.LLST29:
+	.byte	0x4
+	.uleb128 .LVL30-.Ltext0
+	.uleb128 .LVL40-.Ltext0
+	.uleb128 0x1
+	.byte	0x5e
+	.byte	0x4
+	.uleb128 .LVL63-.Ltext0
+	.uleb128 .LVL67-.Ltext0
+	.uleb128 0x1
+	.byte	0x5e
+	.byte	0
+.LVUS35:
+	.uleb128 .LVU137
+	.uleb128 .LVU144
+	.uleb128 .LVU144
+	.uleb128 .LVU161
+	.uleb128 .LVU161
+	.uleb128 .LVU163
+	.uleb128 .LVU163
+	.uleb128 .LVU189
+	.uleb128 .LVU319
+	.uleb128 .LVU331
+.LLST35:
+	.byte	0x4
+	.uleb128 .LVL30-.Ltext0
+	.uleb128 .LVL31-.Ltext0
+	.uleb128 0x2
+	.byte	0x30
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL31-.Ltext0
+	.uleb128 .LVL33-.Ltext0
+	.uleb128 0x6
+	.byte	0x75
+	.sleb128 0
+	.byte	0x7d
+	.sleb128 0
+	.byte	0x1c
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL33-.Ltext0
+	.uleb128 .LVL34-.Ltext0
+	.uleb128 0x6
+	.byte	0x71
+	.sleb128 0
+	.byte	0x7d
+	.sleb128 0
+	.byte	0x1c
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL34-.Ltext0
+	.uleb128 .LVL36-.Ltext0
+	.uleb128 0xc
+	.byte	0x71
+	.sleb128 0
+	.byte	0xc
+	.long	0x3c6ef372
+	.byte	0x27
+	.byte	0x7d
+	.sleb128 0
+	.byte	0x1c
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL63-.Ltext0
+	.uleb128 .LVL67-.Ltext0
+	.uleb128 0x2
+	.byte	0x30
+	.byte	0x9f
+	.byte	0
+.LVUS37:
+	.uleb128 .LVU145
+	.uleb128 .LVU154
+	.uleb128 .LVU154
+	.uleb128 .LVU194
+.LLST37:
+	.byte	0x4
+	.uleb128 .LVL31-.Ltext0
+	.uleb128 .LVL32-.Ltext0
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x4
+	.uleb128 .LVL32-.Ltext0
+	.uleb128 .LVL38-.Ltext0
+	.uleb128 0x3
+	.byte	0x74
+	.sleb128 32
+	.byte	0x9f
+	.byte	0
+.LVUS38:
+	.uleb128 .LVU146
+	.uleb128 .LVU154
+	.uleb128 .LVU154
+	.uleb128 .LVU194
+.LLST38:
+	.byte	0x4
+	.uleb128 .LVL31-.Ltext0
+	.uleb128 .LVL32-.Ltext0
+	.uleb128 0x24
+	.byte	0x74
+	.sleb128 0
+	.byte	0x12
+	.byte	0x23
+	.uleb128 0x8000000000000000
+	.byte	0x8
+	.byte	0x20
+	.byte	0x16
+	.byte	0x14
+	.byte	0x23
+	.uleb128 0x8000000000000000
+	.byte	0x2d
+	.byte	0x28
+	.value	0x1
+	.byte	0x16
+	.byte	0x13
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL32-.Ltext0
+	.uleb128 .LVL38-.Ltext0
+	.uleb128 0x24
+	.byte	0x74
+	.sleb128 32
+	.byte	0x12
+	.byte	0x23
+	.uleb128 0x8000000000000000
+	.byte	0x8
+	.byte	0x20
+	.byte	0x16
+	.byte	0x14
+	.byte	0x23
+	.uleb128 0x8000000000000000
+	.byte	0x2d
+	.byte	0x28
+	.value	0x1
+	.byte	0x16
+	.byte	0x13
+	.byte	0x9f
+	.byte	0
+.LVUS40:
+	.uleb128 .LVU167
+	.uleb128 .LVU170
+	.uleb128 .LVU170
+	.uleb128 .LVU173
+	.uleb128 .LVU173
+	.uleb128 .LVU176
+	.uleb128 .LVU176
+	.uleb128 .LVU179
+	.uleb128 .LVU179
+	.uleb128 .LVU311
+	.uleb128 .LVU317
+	.uleb128 .LVU319
+.LLST40:
+	.byte	0x4
+	.uleb128 .LVL35-.Ltext0
+	.uleb128 .LVL35-.Ltext0
+	.uleb128 0x2
+	.byte	0x34
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL35-.Ltext0
+	.uleb128 .LVL35-.Ltext0
+	.uleb128 0x2
+	.byte	0x35
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL35-.Ltext0
+	.uleb128 .LVL35-.Ltext0
+	.uleb128 0x2
+	.byte	0x36
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL35-.Ltext0
+	.uleb128 .LVL35-.Ltext0
+	.uleb128 0x2
+	.byte	0x37
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL35-.Ltext0
+	.uleb128 .LVL60-.Ltext0
+	.uleb128 0x2
+	.byte	0x38
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL61-.Ltext0
+	.uleb128 .LVL63-.Ltext0
+	.uleb128 0x2
+	.byte	0x38
+	.byte	0x9f
+	.byte	0
+.LVUS42:
+	.uleb128 .LVU198
+	.uleb128 .LVU199
+	.uleb128 .LVU199
+	.uleb128 .LVU295
+	.uleb128 .LVU295
+	.uleb128 .LVU296
+	.uleb128 .LVU296
+	.uleb128 .LVU297
+	.uleb128 .LVU298
+	.uleb128 .LVU300
+	.uleb128 .LVU304
+	.uleb128 .LVU305
+	.uleb128 .LVU317
+	.uleb128 .LVU319
+	.uleb128 .LVU326
+	.uleb128 .LVU331
+.LLST42:
+	.byte	0x4
+	.uleb128 .LVL39-.Ltext0
+	.uleb128 .LVL40-.Ltext0
+	.uleb128 0x2
+	.byte	0x30
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL40-.Ltext0
+	.uleb128 .LVL50-.Ltext0
+	.uleb128 0xc
+	.byte	0x73
+	.sleb128 0
+	.byte	0x77
+	.sleb128 0
+	.byte	0x1c
+	.byte	0xa
+	.value	0x140
+	.byte	0x1c
+	.byte	0x32
+	.byte	0x25
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL50-.Ltext0
+	.uleb128 .LVL51-.Ltext0
+	.uleb128 0xe
+	.byte	0x73
+	.sleb128 0
+	.byte	0x77
+	.sleb128 0
+	.byte	0x1c
+	.byte	0xa
+	.value	0x140
+	.byte	0x1c
+	.byte	0x32
+	.byte	0x25
+	.byte	0x23
+	.uleb128 0x1
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL51-.Ltext0
+	.uleb128 .LVL52-.Ltext0
+	.uleb128 0xe
+	.byte	0x74
+	.sleb128 0
+	.byte	0x77
+	.sleb128 0
+	.byte	0x1c
+	.byte	0xa
+	.value	0x140
+	.byte	0x1c
+	.byte	0x32
+	.byte	0x25
+	.byte	0x23
+	.uleb128 0x1
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL53-.Ltext0
+	.uleb128 .LVL55-.Ltext0
+	.uleb128 0xc
+	.byte	0x73
+	.sleb128 0
+	.byte	0x77
+	.sleb128 0
+	.byte	0x1c
+	.byte	0xa
+	.value	0x140
+	.byte	0x1c
+	.byte	0x32
+	.byte	0x25
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL57-.Ltext0
+	.uleb128 .LVL58-.Ltext0
+	.uleb128 0xe
+	.byte	0x74
+	.sleb128 0
+	.byte	0x77
+	.sleb128 0
+	.byte	0x1c
+	.byte	0xa
+	.value	0x140
+	.byte	0x1c
+	.byte	0x32
+	.byte	0x25
+	.byte	0x23
+	.uleb128 0x1
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL61-.Ltext0
+	.uleb128 .LVL63-.Ltext0
+	.uleb128 0xc
+	.byte	0x73
+	.sleb128 0
+	.byte	0x77
+	.sleb128 0
+	.byte	0x1c
+	.byte	0xa
+	.value	0x140
+	.byte	0x1c
+	.byte	0x32
+	.byte	0x25
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL65-.Ltext0
+	.uleb128 .LVL67-.Ltext0
+	.uleb128 0x2
+	.byte	0x30
+	.byte	0x9f
+	.byte	0
+.LVUS44:
+	.uleb128 .LVU200
+	.uleb128 .LVU296
+	.uleb128 .LVU296
+	.uleb128 .LVU297
+	.uleb128 .LVU298
+	.uleb128 .LVU304
+	.uleb128 .LVU304
+	.uleb128 .LVU305
+	.uleb128 .LVU317
+	.uleb128 .LVU319
+.LLST44:
+	.byte	0x4
+	.uleb128 .LVL40-.Ltext0
+	.uleb128 .LVL51-.Ltext0
+	.uleb128 0x1
+	.byte	0x5c
+	.byte	0x4
+	.uleb128 .LVL51-.Ltext0
+	.uleb128 .LVL52-.Ltext0
+	.uleb128 0x3
+	.byte	0x7c
+	.sleb128 32
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL53-.Ltext0
+	.uleb128 .LVL57-.Ltext0
+	.uleb128 0x1
+	.byte	0x5c
+	.byte	0x4
+	.uleb128 .LVL57-.Ltext0
+	.uleb128 .LVL58-.Ltext0
+	.uleb128 0x3
+	.byte	0x7c
+	.sleb128 32
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL61-.Ltext0
+	.uleb128 .LVL63-.Ltext0
+	.uleb128 0x1
+	.byte	0x5c
+	.byte	0
+.LVUS46:
+	.uleb128 .LVU201
+	.uleb128 .LVU293
+	.uleb128 .LVU298
+	.uleb128 .LVU301
+	.uleb128 .LVU317
+	.uleb128 .LVU319
+.LLST46:
+	.byte	0x4
+	.uleb128 .LVL40-.Ltext0
+	.uleb128 .LVL50-.Ltext0
+	.uleb128 0x24
+	.byte	0x7c
+	.sleb128 0
+	.byte	0x12
+	.byte	0x23
+	.uleb128 0x8000000000000000
+	.byte	0x8
+	.byte	0x20
+	.byte	0x16
+	.byte	0x14
+	.byte	0x23
+	.uleb128 0x8000000000000000
+	.byte	0x2d
+	.byte	0x28
+	.value	0x1
+	.byte	0x16
+	.byte	0x13
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL53-.Ltext0
+	.uleb128 .LVL56-.Ltext0
+	.uleb128 0x24
+	.byte	0x7c
+	.sleb128 0
+	.byte	0x12
+	.byte	0x23
+	.uleb128 0x8000000000000000
+	.byte	0x8
+	.byte	0x20
+	.byte	0x16
+	.byte	0x14
+	.byte	0x23
+	.uleb128 0x8000000000000000
+	.byte	0x2d
+	.byte	0x28
+	.value	0x1
+	.byte	0x16
+	.byte	0x13
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL61-.Ltext0
+	.uleb128 .LVL63-.Ltext0
+	.uleb128 0x24
+	.byte	0x7c
+	.sleb128 0
+	.byte	0x12
+	.byte	0x23
+	.uleb128 0x8000000000000000
+	.byte	0x8
+	.byte	0x20
+	.byte	0x16
+	.byte	0x14
+	.byte	0x23
+	.uleb128 0x8000000000000000
+	.byte	0x2d
+	.byte	0x28
+	.value	0x1
+	.byte	0x16
+	.byte	0x13
+	.byte	0x9f
+	.byte	0
+.LVUS47:
+	.uleb128 .LVU201
+	.uleb128 .LVU292
+	.uleb128 .LVU298
+	.uleb128 .LVU299
+	.uleb128 .LVU317
+	.uleb128 .LVU318
+.LLST47:
+	.byte	0x4
+	.uleb128 .LVL40-.Ltext0
+	.uleb128 .LVL49-.Ltext0
+	.uleb128 0xc
+	.byte	0x77
+	.sleb128 40
+	.byte	0x6
+	.byte	0x7c
+	.sleb128 0
+	.byte	0x1c
+	.byte	0x77
+	.sleb128 80
+	.byte	0x6
+	.byte	0x22
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL53-.Ltext0
+	.uleb128 .LVL54-.Ltext0
+	.uleb128 0xc
+	.byte	0x77
+	.sleb128 40
+	.byte	0x6
+	.byte	0x7c
+	.sleb128 0
+	.byte	0x1c
+	.byte	0x77
+	.sleb128 80
+	.byte	0x6
+	.byte	0x22
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL61-.Ltext0
+	.uleb128 .LVL62-.Ltext0
+	.uleb128 0xc
+	.byte	0x77
+	.sleb128 40
+	.byte	0x6
+	.byte	0x7c
+	.sleb128 0
+	.byte	0x1c
+	.byte	0x77
+	.sleb128 80
+	.byte	0x6
+	.byte	0x22
+	.byte	0x9f
+	.byte	0
+.LVUS48:
+	.uleb128 .LVU201
+	.uleb128 .LVU293
+	.uleb128 .LVU298
+	.uleb128 .LVU300
+	.uleb128 .LVU317
+	.uleb128 .LVU319
+.LLST48:
+	.byte	0x4
+	.uleb128 .LVL40-.Ltext0
+	.uleb128 .LVL50-.Ltext0
+	.uleb128 0xc
+	.byte	0x73
+	.sleb128 0
+	.byte	0x77
+	.sleb128 0
+	.byte	0x1c
+	.byte	0xa
+	.value	0x140
+	.byte	0x1c
+	.byte	0x32
+	.byte	0x25
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL53-.Ltext0
+	.uleb128 .LVL55-.Ltext0
+	.uleb128 0xc
+	.byte	0x73
+	.sleb128 0
+	.byte	0x77
+	.sleb128 0
+	.byte	0x1c
+	.byte	0xa
+	.value	0x140
+	.byte	0x1c
+	.byte	0x32
+	.byte	0x25
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL61-.Ltext0
+	.uleb128 .LVL63-.Ltext0
+	.uleb128 0xc
+	.byte	0x73
+	.sleb128 0
+	.byte	0x77
+	.sleb128 0
+	.byte	0x1c
+	.byte	0xa
+	.value	0x140
+	.byte	0x1c
+	.byte	0x32
+	.byte	0x25
+	.byte	0x9f
+	.byte	0
+.LVUS49:
+	.uleb128 .LVU201
+	.uleb128 .LVU293
+	.uleb128 .LVU298
+	.uleb128 .LVU301
+	.uleb128 .LVU317
+	.uleb128 .LVU319
+.LLST49:
+	.byte	0x4
+	.uleb128 .LVL40-.Ltext0
+	.uleb128 .LVL50-.Ltext0
+	.uleb128 0x4
+	.byte	0x77
+	.sleb128 320
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL53-.Ltext0
+	.uleb128 .LVL56-.Ltext0
+	.uleb128 0x4
+	.byte	0x77
+	.sleb128 320
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL61-.Ltext0
+	.uleb128 .LVL63-.Ltext0
+	.uleb128 0x4
+	.byte	0x77
+	.sleb128 320
+	.byte	0x9f
+	.byte	0
+.LVUS51:
+	.uleb128 .LVU205
+	.uleb128 .LVU217
+	.uleb128 .LVU217
+	.uleb128 .LVU227
+	.uleb128 .LVU227
+	.uleb128 .LVU237
+	.uleb128 .LVU237
+	.uleb128 .LVU247
+	.uleb128 .LVU247
+	.uleb128 .LVU257
+	.uleb128 .LVU257
+	.uleb128 .LVU267
+	.uleb128 .LVU267
+	.uleb128 .LVU277
+	.uleb128 .LVU277
+	.uleb128 .LVU287
+	.uleb128 .LVU287
+	.uleb128 .LVU293
+	.uleb128 .LVU298
+	.uleb128 .LVU301
+	.uleb128 .LVU317
+	.uleb128 .LVU319
+.LLST51:
+	.byte	0x4
+	.uleb128 .LVL40-.Ltext0
+	.uleb128 .LVL41-.Ltext0
+	.uleb128 0x2
+	.byte	0x30
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL41-.Ltext0
+	.uleb128 .LVL42-.Ltext0
+	.uleb128 0x2
+	.byte	0x31
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL42-.Ltext0
+	.uleb128 .LVL43-.Ltext0
+	.uleb128 0x2
+	.byte	0x32
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL43-.Ltext0
+	.uleb128 .LVL44-.Ltext0
+	.uleb128 0x2
+	.byte	0x33
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL44-.Ltext0
+	.uleb128 .LVL45-.Ltext0
+	.uleb128 0x2
+	.byte	0x34
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL45-.Ltext0
+	.uleb128 .LVL46-.Ltext0
+	.uleb128 0x2
+	.byte	0x35
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL46-.Ltext0
+	.uleb128 .LVL47-.Ltext0
+	.uleb128 0x2
+	.byte	0x36
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL47-.Ltext0
+	.uleb128 .LVL48-.Ltext0
+	.uleb128 0x2
+	.byte	0x37
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL48-.Ltext0
+	.uleb128 .LVL50-.Ltext0
+	.uleb128 0x2
+	.byte	0x38
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL53-.Ltext0
+	.uleb128 .LVL56-.Ltext0
+	.uleb128 0x2
+	.byte	0x38
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL61-.Ltext0
+	.uleb128 .LVL63-.Ltext0
+	.uleb128 0x2
+	.byte	0x38
+	.byte	0x9f
+	.byte	0
+.LVUS53:
+	.uleb128 .LVU207
+	.uleb128 .LVU215
+	.uleb128 .LVU219
+	.uleb128 .LVU225
+	.uleb128 .LVU229
+	.uleb128 .LVU235
+	.uleb128 .LVU239
+	.uleb128 .LVU245
+	.uleb128 .LVU249
+	.uleb128 .LVU255
+	.uleb128 .LVU259
+	.uleb128 .LVU265
+	.uleb128 .LVU269
+	.uleb128 .LVU275
+	.uleb128 .LVU279
+	.uleb128 .LVU285
+.LLST53:
+	.byte	0x4
+	.uleb128 .LVL40-.Ltext0
+	.uleb128 .LVL41-.Ltext0
+	.uleb128 0x2
+	.byte	0x73
+	.sleb128 0
+	.byte	0x4
+	.uleb128 .LVL41-.Ltext0
+	.uleb128 .LVL42-.Ltext0
+	.uleb128 0x3
+	.byte	0x73
+	.sleb128 64
+	.byte	0x4
+	.uleb128 .LVL42-.Ltext0
+	.uleb128 .LVL43-.Ltext0
+	.uleb128 0x3
+	.byte	0x73
+	.sleb128 128
+	.byte	0x4
+	.uleb128 .LVL43-.Ltext0
+	.uleb128 .LVL44-.Ltext0
+	.uleb128 0x3
+	.byte	0x73
+	.sleb128 192
+	.byte	0x4
+	.uleb128 .LVL44-.Ltext0
+	.uleb128 .LVL45-.Ltext0
+	.uleb128 0x3
+	.byte	0x73
+	.sleb128 256
+	.byte	0x4
+	.uleb128 .LVL45-.Ltext0
+	.uleb128 .LVL46-.Ltext0
+	.uleb128 0x3
+	.byte	0x73
+	.sleb128 320
+	.byte	0x4
+	.uleb128 .LVL46-.Ltext0
+	.uleb128 .LVL47-.Ltext0
+	.uleb128 0x3
+	.byte	0x73
+	.sleb128 384
+	.byte	0x4
+	.uleb128 .LVL47-.Ltext0
+	.uleb128 .LVL48-.Ltext0
+	.uleb128 0x3
+	.byte	0x73
+	.sleb128 448
+	.byte	0
+.LVUS54:
+	.uleb128 .LVU207
+	.uleb128 .LVU209
+	.uleb128 .LVU209
+	.uleb128 .LVU210
+	.uleb128 .LVU210
+	.uleb128 .LVU211
+	.uleb128 .LVU211
+	.uleb128 .LVU212
+	.uleb128 .LVU212
+	.uleb128 .LVU215
+	.uleb128 .LVU219
+	.uleb128 .LVU221
+	.uleb128 .LVU221
+	.uleb128 .LVU222
+	.uleb128 .LVU222
+	.uleb128 .LVU223
+	.uleb128 .LVU223
+	.uleb128 .LVU224
+	.uleb128 .LVU224
+	.uleb128 .LVU225
+	.uleb128 .LVU229
+	.uleb128 .LVU231
+	.uleb128 .LVU231
+	.uleb128 .LVU232
+	.uleb128 .LVU232
+	.uleb128 .LVU233
+	.uleb128 .LVU233
+	.uleb128 .LVU234
+	.uleb128 .LVU234
+	.uleb128 .LVU235
+	.uleb128 .LVU239
+	.uleb128 .LVU241
+	.uleb128 .LVU241
+	.uleb128 .LVU242
+	.uleb128 .LVU242
+	.uleb128 .LVU243
+	.uleb128 .LVU243
+	.uleb128 .LVU244
+	.uleb128 .LVU244
+	.uleb128 .LVU245
+	.uleb128 .LVU249
+	.uleb128 .LVU251
+	.uleb128 .LVU251
+	.uleb128 .LVU252
+	.uleb128 .LVU252
+	.uleb128 .LVU253
+	.uleb128 .LVU253
+	.uleb128 .LVU254
+	.uleb128 .LVU254
+	.uleb128 .LVU255
+	.uleb128 .LVU259
+	.uleb128 .LVU261
+	.uleb128 .LVU261
+	.uleb128 .LVU262
+	.uleb128 .LVU262
+	.uleb128 .LVU263
+	.uleb128 .LVU263
+	.uleb128 .LVU264
+	.uleb128 .LVU264
+	.uleb128 .LVU265
+	.uleb128 .LVU269
+	.uleb128 .LVU271
+	.uleb128 .LVU271
+	.uleb128 .LVU272
+	.uleb128 .LVU272
+	.uleb128 .LVU273
+	.uleb128 .LVU273
+	.uleb128 .LVU274
+	.uleb128 .LVU274
+	.uleb128 .LVU275
+	.uleb128 .LVU279
+	.uleb128 .LVU281
+	.uleb128 .LVU281
+	.uleb128 .LVU282
+	.uleb128 .LVU282
+	.uleb128 .LVU283
+	.uleb128 .LVU283
+	.uleb128 .LVU284
+	.uleb128 .LVU284
+	.uleb128 .LVU285
+.LLST54:
+	.byte	0x4
+	.uleb128 .LVL40-.Ltext0
+	.uleb128 .LVL40-.Ltext0
+	.uleb128 0x4
+	.byte	0x77
+	.sleb128 96
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL40-.Ltext0
+	.uleb128 .LVL40-.Ltext0
+	.uleb128 0x4
+	.byte	0x77
+	.sleb128 97
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL40-.Ltext0
+	.uleb128 .LVL40-.Ltext0
+	.uleb128 0x4
+	.byte	0x77
+	.sleb128 98
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL40-.Ltext0
+	.uleb128 .LVL40-.Ltext0
+	.uleb128 0x4
+	.byte	0x77
+	.sleb128 99
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL40-.Ltext0
+	.uleb128 .LVL41-.Ltext0
+	.uleb128 0x4
+	.byte	0x77
+	.sleb128 100
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL41-.Ltext0
+	.uleb128 .LVL41-.Ltext0
+	.uleb128 0x4
+	.byte	0x77
+	.sleb128 100
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL41-.Ltext0
+	.uleb128 .LVL41-.Ltext0
+	.uleb128 0x4
+	.byte	0x77
+	.sleb128 101
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL41-.Ltext0
+	.uleb128 .LVL41-.Ltext0
+	.uleb128 0x4
+	.byte	0x77
+	.sleb128 102
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL41-.Ltext0
+	.uleb128 .LVL41-.Ltext0
+	.uleb128 0x4
+	.byte	0x77
+	.sleb128 103
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL41-.Ltext0
+	.uleb128 .LVL42-.Ltext0
+	.uleb128 0x4
+	.byte	0x77
+	.sleb128 104
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL42-.Ltext0
+	.uleb128 .LVL42-.Ltext0
+	.uleb128 0x4
+	.byte	0x77
+	.sleb128 104
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL42-.Ltext0
+	.uleb128 .LVL42-.Ltext0
+	.uleb128 0x4
+	.byte	0x77
+	.sleb128 105
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL42-.Ltext0
+	.uleb128 .LVL42-.Ltext0
+	.uleb128 0x4
+	.byte	0x77
+	.sleb128 106
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL42-.Ltext0
+	.uleb128 .LVL42-.Ltext0
+	.uleb128 0x4
+	.byte	0x77
+	.sleb128 107
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL42-.Ltext0
+	.uleb128 .LVL43-.Ltext0
+	.uleb128 0x4
+	.byte	0x77
+	.sleb128 108
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL43-.Ltext0
+	.uleb128 .LVL43-.Ltext0
+	.uleb128 0x4
+	.byte	0x77
+	.sleb128 108
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL43-.Ltext0
+	.uleb128 .LVL43-.Ltext0
+	.uleb128 0x4
+	.byte	0x77
+	.sleb128 109
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL43-.Ltext0
+	.uleb128 .LVL43-.Ltext0
+	.uleb128 0x4
+	.byte	0x77
+	.sleb128 110
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL43-.Ltext0
+	.uleb128 .LVL43-.Ltext0
+	.uleb128 0x4
+	.byte	0x77
+	.sleb128 111
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL43-.Ltext0
+	.uleb128 .LVL44-.Ltext0
+	.uleb128 0x4
+	.byte	0x77
+	.sleb128 112
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL44-.Ltext0
+	.uleb128 .LVL44-.Ltext0
+	.uleb128 0x4
+	.byte	0x77
+	.sleb128 112
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL44-.Ltext0
+	.uleb128 .LVL44-.Ltext0
+	.uleb128 0x4
+	.byte	0x77
+	.sleb128 113
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL44-.Ltext0
+	.uleb128 .LVL44-.Ltext0
+	.uleb128 0x4
+	.byte	0x77
+	.sleb128 114
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL44-.Ltext0
+	.uleb128 .LVL44-.Ltext0
+	.uleb128 0x4
+	.byte	0x77
+	.sleb128 115
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL44-.Ltext0
+	.uleb128 .LVL45-.Ltext0
+	.uleb128 0x4
+	.byte	0x77
+	.sleb128 116
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL45-.Ltext0
+	.uleb128 .LVL45-.Ltext0
+	.uleb128 0x4
+	.byte	0x77
+	.sleb128 116
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL45-.Ltext0
+	.uleb128 .LVL45-.Ltext0
+	.uleb128 0x4
+	.byte	0x77
+	.sleb128 117
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL45-.Ltext0
+	.uleb128 .LVL45-.Ltext0
+	.uleb128 0x4
+	.byte	0x77
+	.sleb128 118
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL45-.Ltext0
+	.uleb128 .LVL45-.Ltext0
+	.uleb128 0x4
+	.byte	0x77
+	.sleb128 119
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL45-.Ltext0
+	.uleb128 .LVL46-.Ltext0
+	.uleb128 0x4
+	.byte	0x77
+	.sleb128 120
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL46-.Ltext0
+	.uleb128 .LVL46-.Ltext0
+	.uleb128 0x4
+	.byte	0x77
+	.sleb128 120
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL46-.Ltext0
+	.uleb128 .LVL46-.Ltext0
+	.uleb128 0x4
+	.byte	0x77
+	.sleb128 121
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL46-.Ltext0
+	.uleb128 .LVL46-.Ltext0
+	.uleb128 0x4
+	.byte	0x77
+	.sleb128 122
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL46-.Ltext0
+	.uleb128 .LVL46-.Ltext0
+	.uleb128 0x4
+	.byte	0x77
+	.sleb128 123
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL46-.Ltext0
+	.uleb128 .LVL47-.Ltext0
+	.uleb128 0x4
+	.byte	0x77
+	.sleb128 124
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL47-.Ltext0
+	.uleb128 .LVL47-.Ltext0
+	.uleb128 0x4
+	.byte	0x77
+	.sleb128 124
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL47-.Ltext0
+	.uleb128 .LVL47-.Ltext0
+	.uleb128 0x4
+	.byte	0x77
+	.sleb128 125
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL47-.Ltext0
+	.uleb128 .LVL47-.Ltext0
+	.uleb128 0x4
+	.byte	0x77
+	.sleb128 126
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL47-.Ltext0
+	.uleb128 .LVL47-.Ltext0
+	.uleb128 0x4
+	.byte	0x77
+	.sleb128 127
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL47-.Ltext0
+	.uleb128 .LVL48-.Ltext0
+	.uleb128 0x4
+	.byte	0x77
+	.sleb128 128
+	.byte	0x9f
+	.byte	0
+.LVUS31:
+	.uleb128 .LVU192
+	.uleb128 .LVU195
+	.uleb128 .LVU321
+	.uleb128 .LVU323
+.LLST31:
+	.byte	0x4
+	.uleb128 .LVL37-.Ltext0
+	.uleb128 .LVL39-.Ltext0
+	.uleb128 0x7
+	.byte	0x31
+	.byte	0x7e
+	.sleb128 0
+	.byte	0x24
+	.byte	0x31
+	.byte	0x1c
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL64-.Ltext0
+	.uleb128 .LVL65-.Ltext0
+	.uleb128 0x2
+	.byte	0x30
+	.byte	0x9f
+	.byte	0
+.LVUS32:
+	.uleb128 .LVU192
+	.uleb128 .LVU195
+	.uleb128 .LVU321
+	.uleb128 .LVU323
+.LLST32:
+	.byte	0x4
+	.uleb128 .LVL37-.Ltext0
+	.uleb128 .LVL39-.Ltext0
+	.uleb128 0x4
+	.byte	0x77
+	.sleb128 192
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL64-.Ltext0
+	.uleb128 .LVL65-.Ltext0
+	.uleb128 0x4
+	.byte	0x77
+	.sleb128 192
+	.byte	0x9f
+	.byte	0
+.LVUS33:
+	.uleb128 .LVU192
+	.uleb128 .LVU195
+	.uleb128 .LVU321
+	.uleb128 .LVU323
+.LLST33:
+	.byte	0x4
+	.uleb128 .LVL37-.Ltext0
+	.uleb128 .LVL39-.Ltext0
+	.uleb128 0x4
+	.byte	0x77
+	.sleb128 320
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL64-.Ltext0
+	.uleb128 .LVL65-.Ltext0
+	.uleb128 0x4
+	.byte	0x77
+	.sleb128 320
+	.byte	0x9f
+	.byte	0
+.LVUS16:
+	.uleb128 0
+	.uleb128 .LVU59
+	.uleb128 .LVU59
+	.uleb128 0
+.LLST16:
+	.byte	0x4
+	.uleb128 .LVL16-.Ltext0
+	.uleb128 .LVL17-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL17-1-.Ltext0
+	.uleb128 .LFE20-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x9f
+	.byte	0
+.LVUS17:
+	.uleb128 0
+	.uleb128 .LVU59
+	.uleb128 .LVU59
+	.uleb128 0
+.LLST17:
+	.byte	0x4
+	.uleb128 .LVL16-.Ltext0
+	.uleb128 .LVL17-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x4
+	.uleb128 .LVL17-1-.Ltext0
+	.uleb128 .LFE20-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x9f
+	.byte	0
+.LVUS18:
+	.uleb128 0
+	.uleb128 .LVU59
+	.uleb128 .LVU59
+	.uleb128 0
+.LLST18:
+	.byte	0x4
+	.uleb128 .LVL16-.Ltext0
+	.uleb128 .LVL17-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x51
+	.byte	0x4
+	.uleb128 .LVL17-1-.Ltext0
+	.uleb128 .LFE20-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x51
+	.byte	0x9f
+	.byte	0
+.LVUS9:
+	.uleb128 0
+	.uleb128 .LVU48
+	.uleb128 .LVU48
+	.uleb128 .LVU52
+	.uleb128 .LVU52
+	.uleb128 .LVU54
+	.uleb128 .LVU54
+	.uleb128 0
+.LLST9:
+	.byte	0x4
+	.uleb128 .LVL10-.Ltext0
+	.uleb128 .LVL12-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL12-1-.Ltext0
+	.uleb128 .LVL13-.Ltext0
+	.uleb128 0x1
+	.byte	0x56
+	.byte	0x4
+	.uleb128 .LVL13-.Ltext0
+	.uleb128 .LVL14-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL14-.Ltext0
+	.uleb128 .LFE19-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0
+.LVUS10:
+	.uleb128 0
+	.uleb128 .LVU47
+	.uleb128 .LVU47
+	.uleb128 .LVU52
+	.uleb128 .LVU52
+	.uleb128 .LVU54
+	.uleb128 .LVU54
+	.uleb128 0
+.LLST10:
+	.byte	0x4
+	.uleb128 .LVL10-.Ltext0
+	.uleb128 .LVL11-.Ltext0
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x4
+	.uleb128 .LVL11-.Ltext0
+	.uleb128 .LVL13-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0x4
+	.uleb128 .LVL13-.Ltext0
+	.uleb128 .LVL14-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL14-.Ltext0
+	.uleb128 .LFE19-.Ltext0
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0
+.LVUS12:
+	.uleb128 .LVU37
+	.uleb128 .LVU47
+	.uleb128 .LVU47
+	.uleb128 .LVU52
+	.uleb128 .LVU54
+	.uleb128 .LVU55
+.LLST12:
+	.byte	0x4
+	.uleb128 .LVL10-.Ltext0
+	.uleb128 .LVL11-.Ltext0
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x4
+	.uleb128 .LVL11-.Ltext0
+	.uleb128 .LVL13-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0x4
+	.uleb128 .LVL14-.Ltext0
+	.uleb128 .LVL15-.Ltext0
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0
+.LVUS13:
+	.uleb128 .LVU37
+	.uleb128 .LVU52
+	.uleb128 .LVU54
+	.uleb128 .LVU55
+.LLST13:
+	.byte	0x4
+	.uleb128 .LVL10-.Ltext0
+	.uleb128 .LVL13-.Ltext0
+	.uleb128 0x2
+	.byte	0x30
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL14-.Ltext0
+	.uleb128 .LVL15-.Ltext0
+	.uleb128 0x2
+	.byte	0x30
+	.byte	0x9f
+	.byte	0
+.LVUS15:
+	.uleb128 .LVU37
+	.uleb128 .LVU48
+	.uleb128 .LVU48
+	.uleb128 .LVU52
+	.uleb128 .LVU54
+	.uleb128 .LVU55
+.LLST15:
+	.byte	0x4
+	.uleb128 .LVL10-.Ltext0
+	.uleb128 .LVL12-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL12-1-.Ltext0
+	.uleb128 .LVL13-.Ltext0
+	.uleb128 0x1
+	.byte	0x56
+	.byte	0x4
+	.uleb128 .LVL14-.Ltext0
+	.uleb128 .LVL15-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0
+.LVUS0:
+	.uleb128 0
+	.uleb128 .LVU23
+	.uleb128 .LVU23
+	.uleb128 .LVU27
+	.uleb128 .LVU27
+	.uleb128 .LVU30
+	.uleb128 .LVU30
+	.uleb128 0
+.LLST0:
+	.byte	0x4
+	.uleb128 .LVL0-.Ltext0
+	.uleb128 .LVL5-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL5-1-.Ltext0
+	.uleb128 .LVL6-.Ltext0
+	.uleb128 0x1
+	.byte	0x56
+	.byte	0x4
+	.uleb128 .LVL6-.Ltext0
+	.uleb128 .LVL8-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL8-.Ltext0
+	.uleb128 .LFE18-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0
+.LVUS1:
+	.uleb128 0
+	.uleb128 .LVU21
+	.uleb128 .LVU21
+	.uleb128 .LVU23
+	.uleb128 .LVU23
+	.uleb128 .LVU30
+	.uleb128 .LVU30
+	.uleb128 0
+.LLST1:
+	.byte	0x4
+	.uleb128 .LVL0-.Ltext0
+	.uleb128 .LVL3-.Ltext0
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x4
+	.uleb128 .LVL3-.Ltext0
+	.uleb128 .LVL5-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x58
+	.byte	0x4
+	.uleb128 .LVL5-1-.Ltext0
+	.uleb128 .LVL8-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL8-.Ltext0
+	.uleb128 .LFE18-.Ltext0
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0
+.LVUS2:
+	.uleb128 0
+	.uleb128 .LVU22
+	.uleb128 .LVU22
+	.uleb128 .LVU23
+	.uleb128 .LVU23
+	.uleb128 .LVU30
+	.uleb128 .LVU30
+	.uleb128 0
+.LLST2:
+	.byte	0x4
+	.uleb128 .LVL0-.Ltext0
+	.uleb128 .LVL4-.Ltext0
+	.uleb128 0x1
+	.byte	0x51
+	.byte	0x4
+	.uleb128 .LVL4-.Ltext0
+	.uleb128 .LVL5-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x59
+	.byte	0x4
+	.uleb128 .LVL5-1-.Ltext0
+	.uleb128 .LVL8-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x51
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL8-.Ltext0
+	.uleb128 .LFE18-.Ltext0
+	.uleb128 0x1
+	.byte	0x51
+	.byte	0
+.LVUS3:
+	.uleb128 0
+	.uleb128 .LVU20
+	.uleb128 .LVU20
+	.uleb128 .LVU29
+	.uleb128 .LVU29
+	.uleb128 .LVU30
+	.uleb128 .LVU30
+	.uleb128 0
+.LLST3:
+	.byte	0x4
+	.uleb128 .LVL0-.Ltext0
+	.uleb128 .LVL2-.Ltext0
+	.uleb128 0x1
+	.byte	0x52
+	.byte	0x4
+	.uleb128 .LVL2-.Ltext0
+	.uleb128 .LVL7-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0x4
+	.uleb128 .LVL7-.Ltext0
+	.uleb128 .LVL8-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x52
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL8-.Ltext0
+	.uleb128 .LFE18-.Ltext0
+	.uleb128 0x1
+	.byte	0x52
+	.byte	0
+.LVUS5:
+	.uleb128 .LVU8
+	.uleb128 .LVU20
+	.uleb128 .LVU20
+	.uleb128 .LVU27
+	.uleb128 .LVU30
+	.uleb128 .LVU31
+.LLST5:
+	.byte	0x4
+	.uleb128 .LVL1-.Ltext0
+	.uleb128 .LVL2-.Ltext0
+	.uleb128 0x1
+	.byte	0x52
+	.byte	0x4
+	.uleb128 .LVL2-.Ltext0
+	.uleb128 .LVL6-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0x4
+	.uleb128 .LVL8-.Ltext0
+	.uleb128 .LVL9-.Ltext0
+	.uleb128 0x1
+	.byte	0x52
+	.byte	0
+.LVUS6:
+	.uleb128 .LVU8
+	.uleb128 .LVU22
+	.uleb128 .LVU22
+	.uleb128 .LVU23
+	.uleb128 .LVU23
+	.uleb128 .LVU27
+	.uleb128 .LVU30
+	.uleb128 .LVU31
+.LLST6:
+	.byte	0x4
+	.uleb128 .LVL1-.Ltext0
+	.uleb128 .LVL4-.Ltext0
+	.uleb128 0x1
+	.byte	0x51
+	.byte	0x4
+	.uleb128 .LVL4-.Ltext0
+	.uleb128 .LVL5-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x59
+	.byte	0x4
+	.uleb128 .LVL5-1-.Ltext0
+	.uleb128 .LVL6-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x51
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL8-.Ltext0
+	.uleb128 .LVL9-.Ltext0
+	.uleb128 0x1
+	.byte	0x51
+	.byte	0
+.LVUS7:
+	.uleb128 .LVU8
+	.uleb128 .LVU21
+	.uleb128 .LVU21
+	.uleb128 .LVU23
+	.uleb128 .LVU23
+	.uleb128 .LVU27
+	.uleb128 .LVU30
+	.uleb128 .LVU31
+.LLST7:
+	.byte	0x4
+	.uleb128 .LVL1-.Ltext0
+	.uleb128 .LVL3-.Ltext0
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x4
+	.uleb128 .LVL3-.Ltext0
+	.uleb128 .LVL5-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x58
+	.byte	0x4
+	.uleb128 .LVL5-1-.Ltext0
+	.uleb128 .LVL6-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL8-.Ltext0
+	.uleb128 .LVL9-.Ltext0
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0
+.LVUS8:
+	.uleb128 .LVU8
+	.uleb128 .LVU23
+	.uleb128 .LVU23
+	.uleb128 .LVU27
+	.uleb128 .LVU30
+	.uleb128 .LVU31
+.LLST8:
+	.byte	0x4
+	.uleb128 .LVL1-.Ltext0
+	.uleb128 .LVL5-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL5-1-.Ltext0
+	.uleb128 .LVL6-.Ltext0
+	.uleb128 0x1
+	.byte	0x56
+	.byte	0x4
+	.uleb128 .LVL8-.Ltext0
+	.uleb128 .LVL9-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0
+.Ldebug_loc3:
+	.section	.debug_aranges,"",@progbits
+	.long	0x2c
+	.value	0x2
+	.long	.Ldebug_info0
+	.byte	0x8
+	.byte	0
+	.value	0
+	.value	0
+	.quad	.Ltext0
+	.quad	.Letext0-.Ltext0
+	.quad	0
+	.quad	0
+	.section	.debug_rnglists,"",@progbits
+.Ldebug_ranges0:
+	.long	.Ldebug_ranges3-.Ldebug_ranges2
+.Ldebug_ranges2:
+	.value	0x5
+	.byte	0x8
+	.byte	0
+	.long	0
+.LLRL4:
+	.byte	0x4
+	.uleb128 .LBB17-.Ltext0
+	.uleb128 .LBE17-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB23-.Ltext0
+	.uleb128 .LBE23-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB24-.Ltext0
+	.uleb128 .LBE24-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB25-.Ltext0
+	.uleb128 .LBE25-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB26-.Ltext0
+	.uleb128 .LBE26-.Ltext0
+	.byte	0
+.LLRL11:
+	.byte	0x4
+	.uleb128 .LBB29-.Ltext0
+	.uleb128 .LBE29-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB33-.Ltext0
+	.uleb128 .LBE33-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB34-.Ltext0
+	.uleb128 .LBE34-.Ltext0
+	.byte	0
+.LLRL24:
+	.byte	0x4
+	.uleb128 .LBB50-.Ltext0
+	.uleb128 .LBE50-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB111-.Ltext0
+	.uleb128 .LBE111-.Ltext0
+	.byte	0
+.LLRL26:
+	.byte	0x4
+	.uleb128 .LBB51-.Ltext0
+	.uleb128 .LBE51-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB110-.Ltext0
+	.uleb128 .LBE110-.Ltext0
+	.byte	0
+.LLRL28:
+	.byte	0x4
+	.uleb128 .LBB52-.Ltext0
+	.uleb128 .LBE52-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB108-.Ltext0
+	.uleb128 .LBE108-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB109-.Ltext0
+	.uleb128 .LBE109-.Ltext0
+	.byte	0
+.LLRL30:
+	.byte	0x4
+	.uleb128 .LBB53-.Ltext0
+	.uleb128 .LBE53-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB67-.Ltext0
+	.uleb128 .LBE67-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB69-.Ltext0
+	.uleb128 .LBE69-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB70-.Ltext0
+	.uleb128 .LBE70-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB106-.Ltext0
+	.uleb128 .LBE106-.Ltext0
+	.byte	0
+.LLRL34:
+	.byte	0x4
+	.uleb128 .LBB59-.Ltext0
+	.uleb128 .LBE59-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB68-.Ltext0
+	.uleb128 .LBE68-.Ltext0
+	.byte	0
+.LLRL36:
+	.byte	0x4
+	.uleb128 .LBB60-.Ltext0
+	.uleb128 .LBE60-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB65-.Ltext0
+	.uleb128 .LBE65-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB66-.Ltext0
+	.uleb128 .LBE66-.Ltext0
+	.byte	0
+.LLRL39:
+	.byte	0x4
+	.uleb128 .LBB61-.Ltext0
+	.uleb128 .LBE61-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB62-.Ltext0
+	.uleb128 .LBE62-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB63-.Ltext0
+	.uleb128 .LBE63-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB64-.Ltext0
+	.uleb128 .LBE64-.Ltext0
+	.byte	0
+.LLRL41:
+	.byte	0x4
+	.uleb128 .LBB71-.Ltext0
+	.uleb128 .LBE71-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB105-.Ltext0
+	.uleb128 .LBE105-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB107-.Ltext0
+	.uleb128 .LBE107-.Ltext0
+	.byte	0
+.LLRL43:
+	.byte	0x4
+	.uleb128 .LBB72-.Ltext0
+	.uleb128 .LBE72-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB103-.Ltext0
+	.uleb128 .LBE103-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB104-.Ltext0
+	.uleb128 .LBE104-.Ltext0
+	.byte	0
+.LLRL45:
+	.byte	0x4
+	.uleb128 .LBB73-.Ltext0
+	.uleb128 .LBE73-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB99-.Ltext0
+	.uleb128 .LBE99-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB100-.Ltext0
+	.uleb128 .LBE100-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB101-.Ltext0
+	.uleb128 .LBE101-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB102-.Ltext0
+	.uleb128 .LBE102-.Ltext0
+	.byte	0
+.LLRL50:
+	.byte	0x4
+	.uleb128 .LBB75-.Ltext0
+	.uleb128 .LBE75-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB94-.Ltext0
+	.uleb128 .LBE94-.Ltext0
+	.byte	0
+.LLRL52:
+	.byte	0x4
+	.uleb128 .LBB76-.Ltext0
+	.uleb128 .LBE76-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB86-.Ltext0
+	.uleb128 .LBE86-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB87-.Ltext0
+	.uleb128 .LBE87-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB88-.Ltext0
+	.uleb128 .LBE88-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB89-.Ltext0
+	.uleb128 .LBE89-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB90-.Ltext0
+	.uleb128 .LBE90-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB91-.Ltext0
+	.uleb128 .LBE91-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB92-.Ltext0
+	.uleb128 .LBE92-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB93-.Ltext0
+	.uleb128 .LBE93-.Ltext0
+	.byte	0
+.Ldebug_ranges3:
+	.section	.debug_line,"",@progbits
+.Ldebug_line0:
+	.section	.debug_str,"MS",@progbits,1
+.LASF36:
+	.string	"blake2s_init_words"
+.LASF8:
+	.string	"size_t"
+.LASF16:
+	.string	"uint64_t"
+.LASF9:
+	.string	"__uint8_t"
+.LASF23:
+	.string	"long long unsigned int"
+.LASF38:
+	.string	"blake2s_sigma"
+.LASF34:
+	.string	"blake2s_final"
+.LASF43:
+	.string	"dig_len"
+.LASF56:
+	.string	"bxs_init"
+.LASF24:
+	.string	"long long int"
+.LASF7:
+	.string	"signed char"
+.LASF20:
+	.string	"blake2s_ctx"
+.LASF17:
+	.string	"buf_len"
+.LASF3:
+	.string	"long int"
+.LASF28:
+	.string	"compress"
+.LASF32:
+	.string	"memcpy"
+.LASF21:
+	.string	"blake2xs_ctx"
+.LASF49:
+	.string	"key_len"
+.LASF11:
+	.string	"__uint32_t"
+.LASF30:
+	.string	"lanes"
+.LASF25:
+	.string	"blake2s_lanes"
+.LASF6:
+	.string	"unsigned int"
+.LASF57:
+	.string	"blake2s_compress_lanes"
+.LASF2:
+	.string	"long unsigned int"
+.LASF26:
+	.string	"name"
+.LASF40:
+	.string	"width"
+.LASF5:
+	.string	"short unsigned int"
+.LASF45:
+	.string	"digest"
+.LASF22:
+	.string	"xof_len"
+.LASF53:
+	.string	"GNU C99 12.2.0 -mtune=generic -march=x86-64 -g -O3 -std=c99 -fasynchronous-unwind-tables"
+.LASF50:
+	.string	"bxs_output"
+.LASF29:
+	.string	"compress_blocks"
+.LASF12:
+	.string	"__uint64_t"
+.LASF47:
+	.string	"blake2xs_init"
+.LASF4:
+	.string	"unsigned char"
+.LASF10:
+	.string	"short int"
+.LASF18:
+	.string	"digest_len"
+.LASF15:
+	.string	"uint32_t"
+.LASF13:
+	.string	"char"
+.LASF54:
+	.string	"blake2s_kernel"
+.LASF39:
+	.string	"blake2s_kern"
+.LASF19:
+	.string	"last_node"
+.LASF27:
+	.string	"usable"
+.LASF55:
+	.string	"blake2xs_update"
+.LASF31:
+	.string	"compress_lanes"
+.LASF33:
+	.string	"memset"
+.LASF52:
+	.string	"mask"
+.LASF46:
+	.string	"blake2xs_final"
+.LASF14:
+	.string	"uint8_t"
+.LASF41:
+	.string	"nblocks"
+.LASF37:
+	.string	"out_len"
+.LASF48:
+	.string	"blake2xs_init_keyed"
+.LASF35:
+	.string	"blake2s_update"
+.LASF42:
+	.string	"left"
+.LASF51:
+	.string	"write_le32"
+.LASF44:
+	.string	"blake2s_iv"
+	.section	.debug_line_str,"MS",@progbits,1
+.LASF1:
+	.string	"/root/repo"
+.LASF0:
+	.string	"blake2xs.c"
+	.ident	"GCC: (Debian 12.2.0-14+deb12u1) 12.2.0"
+	.section	.note.GNU-stack,"",@progbits